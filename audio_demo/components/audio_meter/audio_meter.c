@@ -0,0 +1,369 @@
+// Copyright 2020 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "audio_meter.h"
+
+static const char *TAG = "audio_meter";
+
+#define AUDIO_METER_CHECK(a, str, ret_val)                        \
+    if (!(a))                                                     \
+    {                                                             \
+        ESP_LOGE(TAG, "%s(%d): %s", __FUNCTION__, __LINE__, str); \
+        return (ret_val);                                         \
+    }
+
+static const char *AUDIO_METER_PARAM_ERROR = "AUDIO METER PARAM ERROR";
+static const char *AUDIO_METER_ALLOC_ERROR = "AUDIO METER ALLOC ERROR";
+
+#define DECIMATED_RATE      (8000)
+#define LEVEL_RING          (16)    /**< tap calls whose levels wait for the analysis */
+
+/**
+ * Rings written by the tap only, read by the analysis task only; head is free running and stored with
+ * release after the data. The sample ring is twice the FFT size and the tap overwrites it: the analysis
+ * copies the newest fft_size samples and checks afterwards that the tap did not come round in between
+ */
+typedef struct {
+    int32_t peak;
+    uint32_t frames;
+    uint64_t sum_sq;
+} level_block_t;
+
+struct audio_meter {
+    audio_meter_config_t config;
+    int16_t *ring;
+    uint32_t mask;
+    uint32_t volatile head;
+    int32_t dec_acc;                   /**< tap only: sum of the frames of the sample being decimated */
+    int dec_count;
+    level_block_t level[LEVEL_RING];
+    uint32_t volatile level_head;
+    uint32_t level_tail;
+    /* analysis */
+    int16_t *re;
+    int16_t *im;
+    int16_t *window;
+    int16_t *cos_tab;                  /**< cos and sin of 2 pi k / fft_size, k < 3/4 fft_size */
+    int16_t *sin_tab;
+    uint16_t *rev;                     /**< base 4 digit reversal */
+    uint16_t band_edge[AUDIO_METER_BANDS_MAX + 1];
+    /* published, seq odd while it is written */
+    uint32_t volatile seq;
+    audio_meter_frame_t frame;
+    TaskHandle_t task;
+    SemaphoreHandle_t exit_sem;
+    bool volatile running;
+};
+
+esp_err_t audio_meter_tap(void *ctx, const int16_t *frames, size_t count)
+{
+    audio_meter_handle_t m = ctx;
+    uint32_t head = m->head;
+    int32_t peak = 0;
+    uint64_t sum_sq = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        int32_t v = (frames[2 * i] + frames[2 * i + 1]) / 2;
+        int32_t a = v < 0 ? -v : v;
+        peak = a > peak ? a : peak;
+        sum_sq += v * v;
+        m->dec_acc += v;
+        if (++m->dec_count == m->config.decimate) {
+            m->ring[head++ & m->mask] = m->dec_acc / m->config.decimate;
+            m->dec_acc = 0;
+            m->dec_count = 0;
+        }
+    }
+    __atomic_store_n(&m->head, head, __ATOMIC_RELEASE);
+
+    uint32_t lh = m->level_head;
+    if (lh - __atomic_load_n(&m->level_tail, __ATOMIC_ACQUIRE) < LEVEL_RING) {
+        m->level[lh % LEVEL_RING] = (level_block_t) {
+            .peak = peak,
+            .frames = count,
+            .sum_sq = sum_sq,
+        };
+        __atomic_store_n(&m->level_head, lh + 1, __ATOMIC_RELEASE);
+    }   // else the analysis is behind, its levels miss this block
+
+    if (m->config.next_tap) {
+        return m->config.next_tap(m->config.next_tap_ctx, frames, count);
+    }
+    return ESP_OK;
+}
+
+static inline int16_t q15_sat(int32_t v)
+{
+    return v > INT16_MAX ? INT16_MAX : (v < INT16_MIN ? INT16_MIN : v);
+}
+
+/**
+ * Radix-4 decimation in frequency, in place, Q15. The inputs of every stage are shifted down by 2, so
+ * no magnitude grows past the one of the input and the result is the transform divided by fft_size.
+ * The output is in base 4 digit reversed order
+ */
+static void fft_radix4(audio_meter_handle_t m)
+{
+    int n = m->config.fft_size;
+    int16_t *re = m->re;
+    int16_t *im = m->im;
+
+    for (int len = n; len >= 4; len >>= 2) {
+        int q = len / 4;
+        int step = n / len;
+        for (int j = 0; j < q; j++) {
+            int32_t w1r = m->cos_tab[j * step], w1i = -m->sin_tab[j * step];
+            int32_t w2r = m->cos_tab[2 * j * step], w2i = -m->sin_tab[2 * j * step];
+            int32_t w3r = m->cos_tab[3 * j * step], w3i = -m->sin_tab[3 * j * step];
+            for (int k = j; k < n; k += len) {
+                int32_t ar = re[k] >> 2, ai = im[k] >> 2;
+                int32_t br = re[k + q] >> 2, bi = im[k + q] >> 2;
+                int32_t cr = re[k + 2 * q] >> 2, ci = im[k + 2 * q] >> 2;
+                int32_t dr = re[k + 3 * q] >> 2, di = im[k + 3 * q] >> 2;
+                int32_t t0r = ar + cr, t0i = ai + ci;
+                int32_t t1r = ar - cr, t1i = ai - ci;
+                int32_t t2r = br + dr, t2i = bi + di;
+                int32_t t3r = br - dr, t3i = bi - di;
+                // y1 = t1 - j t3, y3 = t1 + j t3
+                int32_t y1r = t1r + t3i, y1i = t1i - t3r;
+                int32_t y2r = t0r - t2r, y2i = t0i - t2i;
+                int32_t y3r = t1r - t3i, y3i = t1i + t3r;
+                re[k] = q15_sat(t0r + t2r);
+                im[k] = q15_sat(t0i + t2i);
+                re[k + q] = q15_sat((y1r * w1r - y1i * w1i + (1 << 14)) >> 15);
+                im[k + q] = q15_sat((y1r * w1i + y1i * w1r + (1 << 14)) >> 15);
+                re[k + 2 * q] = q15_sat((y2r * w2r - y2i * w2i + (1 << 14)) >> 15);
+                im[k + 2 * q] = q15_sat((y2r * w2i + y2i * w2r + (1 << 14)) >> 15);
+                re[k + 3 * q] = q15_sat((y3r * w3r - y3i * w3i + (1 << 14)) >> 15);
+                im[k + 3 * q] = q15_sat((y3r * w3i + y3i * w3r + (1 << 14)) >> 15);
+            }
+        }
+    }
+}
+
+static inline uint8_t level_of_db(float db)
+{
+    float l = (db + AUDIO_METER_RANGE_DB) * (255.0f / AUDIO_METER_RANGE_DB);
+    return l <= 0 ? 0 : (l >= 255 ? 255 : (uint8_t)l);
+}
+
+// Copy the newest fft_size samples, false when there are not that many yet or the tap overwrote them meanwhile
+static bool meter_take_samples(audio_meter_handle_t m)
+{
+    int n = m->config.fft_size;
+    uint32_t head = __atomic_load_n(&m->head, __ATOMIC_ACQUIRE);
+    if (head < (uint32_t)n) {
+        return false;
+    }
+    for (int i = 0; i < n; i++) {
+        m->re[i] = m->ring[(head - n + i) & m->mask];
+    }
+    return __atomic_load_n(&m->head, __ATOMIC_ACQUIRE) - head <= m->mask + 1 - n;
+}
+
+static void meter_analyse(audio_meter_handle_t m, audio_meter_frame_t *f)
+{
+    int n = m->config.fft_size;
+    int32_t peak = 0;
+    uint64_t sum_sq = 0;
+    uint32_t frames = 0;
+
+    uint32_t lh = __atomic_load_n(&m->level_head, __ATOMIC_ACQUIRE);
+    for (; m->level_tail != lh; m->level_tail++) {
+        const level_block_t *b = &m->level[m->level_tail % LEVEL_RING];
+        peak = b->peak > peak ? b->peak : peak;
+        sum_sq += b->sum_sq;
+        frames += b->frames;
+    }
+    __atomic_store_n(&m->level_tail, lh, __ATOMIC_RELEASE);
+    f->peak = level_of_db(20.0f * log10f((peak + 0.5f) / 32768.0f));
+    f->rms = frames ? level_of_db(10.0f * log10f((float)sum_sq / frames / (32768.0f * 32768.0f) + 1e-12f)) : 0;
+
+    f->bands = m->config.bands;
+    if (!meter_take_samples(m)) {
+        memset(f->band, 0, sizeof(f->band));
+        f->overruns += __atomic_load_n(&m->head, __ATOMIC_ACQUIRE) >= (uint32_t)n;
+        return;
+    }
+    for (int i = 0; i < n; i++) {
+        m->re[i] = (m->re[i] * m->window[i] + (1 << 14)) >> 15;
+        m->im[i] = 0;
+    }
+    fft_radix4(m);
+    // a band reads its strongest bin; a full-scale sine through the Hann window and the 1/n of the FFT is 1/4 there, 2^26 in power
+    for (int b = 0; b < m->config.bands; b++) {
+        int64_t power = 0;
+        for (int k = m->band_edge[b]; k < m->band_edge[b + 1]; k++) {
+            int32_t r = m->re[m->rev[k]], i = m->im[m->rev[k]];
+            int64_t p = r * r + i * i;
+            power = p > power ? p : power;
+        }
+        f->band[b] = level_of_db(10.0f * log10f((float)power / (float)(1 << 26) + 1e-12f));
+    }
+}
+
+static void audio_meter_task(void *arg)
+{
+    audio_meter_handle_t m = arg;
+    audio_meter_frame_t f = { .seq = 0 };
+    TickType_t period = pdMS_TO_TICKS(1000 / m->config.update_hz);
+    TickType_t last = xTaskGetTickCount();
+
+    while (m->running) {
+        vTaskDelayUntil(&last, period > 0 ? period : 1);
+        meter_analyse(m, &f);
+        f.seq++;
+        f.time_us = esp_timer_get_time();
+        // seqlock: readers retry while seq is odd or changed under them
+        __atomic_store_n(&m->seq, 2 * f.seq - 1, __ATOMIC_RELEASE);
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+        m->frame = f;
+        __atomic_store_n(&m->seq, 2 * f.seq, __ATOMIC_RELEASE);
+    }
+    xSemaphoreGive(m->exit_sem);
+    vTaskDelete(NULL);
+}
+
+bool audio_meter_read(audio_meter_handle_t meter, audio_meter_frame_t *frame)
+{
+    uint32_t s1, s2;
+    do {
+        s1 = __atomic_load_n(&meter->seq, __ATOMIC_ACQUIRE);
+        if (s1 & 1) {
+            continue;
+        }
+        memcpy(frame, (const void *)&meter->frame, sizeof(audio_meter_frame_t));
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+        s2 = __atomic_load_n(&meter->seq, __ATOMIC_ACQUIRE);
+        if (s1 == s2) {
+            break;
+        }
+    } while (1);
+    return s1 != 0;
+}
+
+static esp_err_t meter_tables(audio_meter_handle_t m)
+{
+    int n = m->config.fft_size;
+    int bits = 0;
+    while ((1 << bits) < n) {
+        bits++;
+    }
+    for (int i = 0; i < n; i++) {
+        m->window[i] = lrintf(32767.0f * 0.5f * (1.0f - cosf(2.0f * M_PI * i / n)));
+        int r = 0;
+        for (int b = 0; b < bits; b += 2) {
+            r |= ((i >> b) & 3) << (bits - 2 - b);
+        }
+        m->rev[i] = r;
+    }
+    for (int i = 0; i < 3 * n / 4; i++) {
+        m->cos_tab[i] = lrintf(32767.0f * cosf(2.0f * M_PI * i / n));
+        m->sin_tab[i] = lrintf(32767.0f * sinf(2.0f * M_PI * i / n));
+    }
+    // bin 0 is the DC, the bands split bins 1 to n/2 on a log scale, one bin each at least
+    int lo = 1, hi = n / 2;
+    m->band_edge[0] = lo;
+    for (int b = 1; b <= m->config.bands; b++) {
+        int e = lrintf(lo * powf((float)hi / lo, (float)b / m->config.bands));
+        e = e <= m->band_edge[b - 1] ? m->band_edge[b - 1] + 1 : e;
+        m->band_edge[b] = e > hi ? hi : e;
+    }
+    return m->band_edge[m->config.bands] > m->band_edge[m->config.bands - 1] ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
+
+static void meter_free(audio_meter_handle_t m)
+{
+    if (m->exit_sem) {
+        vSemaphoreDelete(m->exit_sem);
+    }
+    free(m->ring);
+    free(m->re);
+    free(m->im);
+    free(m->window);
+    free(m->cos_tab);
+    free(m->sin_tab);
+    free(m->rev);
+    free(m);
+}
+
+esp_err_t audio_meter_init(const audio_meter_config_t *cfg, audio_meter_handle_t *meter)
+{
+    AUDIO_METER_CHECK(cfg != NULL && meter != NULL, AUDIO_METER_PARAM_ERROR, ESP_ERR_INVALID_ARG);
+    AUDIO_METER_CHECK(cfg->fft_size == 64 || cfg->fft_size == 256 || cfg->fft_size == 1024, AUDIO_METER_PARAM_ERROR, ESP_ERR_INVALID_ARG);
+    AUDIO_METER_CHECK(cfg->bands > 0 && cfg->bands <= AUDIO_METER_BANDS_MAX && cfg->bands <= cfg->fft_size / 2, AUDIO_METER_PARAM_ERROR, ESP_ERR_INVALID_ARG);
+    AUDIO_METER_CHECK(cfg->rate > 0 && cfg->update_hz > 0 && cfg->decimate >= 0, AUDIO_METER_PARAM_ERROR, ESP_ERR_INVALID_ARG);
+
+    audio_meter_handle_t m = calloc(1, sizeof(struct audio_meter));
+    AUDIO_METER_CHECK(m != NULL, AUDIO_METER_ALLOC_ERROR, ESP_ERR_NO_MEM);
+
+    m->config = *cfg;
+    if (0 == m->config.decimate) {
+        m->config.decimate = cfg->rate > DECIMATED_RATE ? cfg->rate / DECIMATED_RATE : 1;
+    }
+    int n = cfg->fft_size;
+    m->mask = 2 * n - 1;
+    m->ring = calloc(2 * n, sizeof(int16_t));
+    m->re = malloc(n * sizeof(int16_t));
+    m->im = malloc(n * sizeof(int16_t));
+    m->window = malloc(n * sizeof(int16_t));
+    m->cos_tab = malloc(3 * n / 4 * sizeof(int16_t));
+    m->sin_tab = malloc(3 * n / 4 * sizeof(int16_t));
+    m->rev = malloc(n * sizeof(uint16_t));
+    m->exit_sem = xSemaphoreCreateBinary();
+
+    if (!m->ring || !m->re || !m->im || !m->window || !m->cos_tab || !m->sin_tab || !m->rev || !m->exit_sem) {
+        ESP_LOGE(TAG, "%s(%d): %s", __FUNCTION__, __LINE__, AUDIO_METER_ALLOC_ERROR);
+        meter_free(m);
+        return ESP_ERR_NO_MEM;
+    }
+    if (meter_tables(m) != ESP_OK) {
+        ESP_LOGE(TAG, "%s(%d): %s", __FUNCTION__, __LINE__, AUDIO_METER_PARAM_ERROR);
+        meter_free(m);
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    m->running = true;
+
+    if (pdPASS != xTaskCreatePinnedToCore(audio_meter_task, "audio_meter", 3 * 1024, m,
+                                          cfg->task_priority, &m->task, cfg->task_core)) {
+        ESP_LOGE(TAG, "%s(%d): %s", __FUNCTION__, __LINE__, AUDIO_METER_ALLOC_ERROR);
+        meter_free(m);
+        return ESP_ERR_NO_MEM;
+    }
+
+    *meter = m;
+    return ESP_OK;
+}
+
+esp_err_t audio_meter_deinit(audio_meter_handle_t meter)
+{
+    AUDIO_METER_CHECK(meter != NULL, AUDIO_METER_PARAM_ERROR, ESP_ERR_INVALID_ARG);
+
+    meter->running = false;
+    xSemaphoreTake(meter->exit_sem, portMAX_DELAY);
+    meter_free(meter);
+    return ESP_OK;
+}
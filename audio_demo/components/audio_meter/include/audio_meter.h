@@ -0,0 +1,115 @@
+// Copyright 2020 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _AUDIO_METER_H_
+#define _AUDIO_METER_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Level meter and spectrum of the audio being played, for LED and LCD visualizers.
+ *
+ * audio_meter_tap goes in as the tap of the mixer. It only takes a peak and a sum of squares per call
+ * and averages every decimate frames into a ring, it never waits and never locks: when the analysis falls
+ * behind, the ring is overwritten and the meter skips ahead. A task of its own wakes update_hz times a
+ * second, runs a fixed-point radix-4 FFT over the newest fft_size decimated samples and publishes the
+ * result; any number of readers take the latest one with audio_meter_read, without a lock either.
+ */
+
+#define AUDIO_METER_BANDS_MAX   (32)
+#define AUDIO_METER_RANGE_DB    (60)    /*!< levels span -60 dBFS (0) to 0 dBFS (255) */
+
+/**
+ * @brief Configuration of the meter for audio_meter_init function
+ */
+typedef struct {
+    int rate;                       /*!< tap sample rate, the mixer rate */
+    int decimate;                   /*!< frames averaged per FFT sample, 0: down to about 8 kHz */
+    int fft_size;                   /*!< 64, 256 or 1024, a power of 4 */
+    int bands;                      /*!< log spaced from the lowest bin to half the decimated rate */
+    int update_hz;                  /*!< analyses per second */
+    esp_err_t (*next_tap)(void *ctx, const int16_t *frames, size_t count); /*!< called after the meter with the same block, e.g. aec_ref_tap; NULL for none */
+    void *next_tap_ctx;
+    UBaseType_t task_priority;      /*!< analysis task priority, below the audio tasks */
+    BaseType_t task_core;           /*!< analysis task core, tskNO_AFFINITY for any */
+} audio_meter_config_t;
+
+#define AUDIO_METER_DEFAULT_CONFIG() {  \
+    .rate = 44100,                      \
+    .decimate = 0,                      \
+    .fft_size = 256,                    \
+    .bands = 16,                        \
+    .update_hz = 30,                    \
+    .next_tap = NULL,                   \
+    .next_tap_ctx = NULL,               \
+    .task_priority = 2,                 \
+    .task_core = tskNO_AFFINITY,        \
+}
+
+/**
+ * @brief One analysis
+ */
+typedef struct {
+    uint32_t seq;                   /*!< analyses published so far, a reader sees a new one when it changes */
+    int64_t time_us;                /*!< esp_timer_get_time() of the analysis */
+    uint8_t rms;                    /*!< level of the blocks since the last analysis, full rate */
+    uint8_t peak;
+    int bands;
+    uint8_t band[AUDIO_METER_BANDS_MAX]; /*!< level of each band, a full-scale sine in it is 255 */
+    uint32_t overruns;              /*!< times the analysis fell behind the tap and skipped samples */
+} audio_meter_frame_t;
+
+typedef struct audio_meter *audio_meter_handle_t;
+
+/**
+ * @brief Create the meter and start its task
+ *
+ * @return
+ *     - ESP_OK Success
+ *     - ESP_ERR_INVALID_ARG Parameter error
+ *     - ESP_ERR_NO_MEM No memory
+ */
+esp_err_t audio_meter_init(const audio_meter_config_t *cfg, audio_meter_handle_t *meter);
+
+/**
+ * @brief Stop the task and free the meter, take it out of the mixer first
+ */
+esp_err_t audio_meter_deinit(audio_meter_handle_t meter);
+
+/**
+ * @brief The tap, in the form of an audio_mixer output: count frames of 16 bit stereo, ctx is the meter
+ */
+esp_err_t audio_meter_tap(void *ctx, const int16_t *frames, size_t count);
+
+/**
+ * @brief Copy the latest analysis, from any task
+ *
+ * @return false before the first analysis
+ */
+bool audio_meter_read(audio_meter_handle_t meter, audio_meter_frame_t *frame);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,486 @@
+// Copyright 2020 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "esp_err.h"
+#include "esp_log.h"
+#include "driver/i2s.h"
+#include "pwm_audio.h"
+#include "audio_mixer.h"
+
+static const char *TAG = "audio_mixer";
+
+#define AUDIO_MIXER_CHECK(a, str, ret_val)                        \
+    if (!(a))                                                     \
+    {                                                             \
+        ESP_LOGE(TAG, "%s(%d): %s", __FUNCTION__, __LINE__, str); \
+        return (ret_val);                                         \
+    }
+
+static const char *AUDIO_MIXER_PARAM_ERROR  = "AUDIO MIXER PARAM ERROR";
+static const char *AUDIO_MIXER_STATUS_ERROR = "AUDIO MIXER STATUS ERROR";
+static const char *AUDIO_MIXER_ALLOC_ERROR  = "AUDIO MIXER ALLOC ERROR";
+
+#define SAMPLE_RATE_MAX     (48000)
+#define SAMPLE_RATE_MIN     (8000)
+#define BLOCK_FRAMES        (256)
+#define QUEUE_FRAMES        (1024)
+#define GAIN_MAX            (4 * AUDIO_MIXER_GAIN_UNITY)
+#define IDLE_WAIT_MS        (20)
+
+/**
+ * Polyphase resampler: RESAMPLE_PHASES sub sample positions of a RESAMPLE_TAPS windowed sinc, Q14.
+ * The position is kept exactly in 1 / out_rate input frames, so the pitch does not drift, and picks the
+ * nearest lower phase
+ */
+#define RESAMPLE_TAPS       (16)
+#define RESAMPLE_PHASES     (64)
+#define RESAMPLE_COEF_BITS  (14)
+
+/**
+ * Stream input queue, single writer task and the mixer task as single reader, no lock:
+ * head is only stored by the writer and tail by the mixer, both free running.
+ * One frame per entry, left in the low half word and right in the high half word
+ */
+typedef struct audio_mixer_stream {
+    uint32_t *buf;
+    uint32_t volatile head;            /**< Frames written */
+    uint32_t volatile tail;            /**< Frames mixed, the resampler history starts here */
+    uint32_t size;                     /**< a power of two */
+    uint32_t mask;
+    uint32_t volatile writer_waiting;  /**< the writer found the queue full */
+    SemaphoreHandle_t semaphore_room;  /**< given by the mixer when a waiting writer has room again */
+
+    int rate;
+    int channels;
+    uint32_t volatile gain;
+    int16_t (*coef)[RESAMPLE_TAPS];    /**< NULL: same rate as the mixer, frames are mixed as they are */
+    uint32_t step;                     /**< input frames per output frame, whole part */
+    uint32_t step_rem;                 /**< and the rest, in 1 / out_rate */
+    uint32_t out_rate;
+    uint32_t phase_mul;                /**< frac to phase, RESAMPLE_PHASES / out_rate in Q32 */
+    uint32_t frac;                     /**< position past tail + RESAMPLE_TAPS / 2 - 1, in 1 / out_rate */
+    uint32_t used;
+} audio_mixer_stream_t;
+
+typedef struct {
+    audio_mixer_config_t config;
+    audio_mixer_stream_t streams[AUDIO_MIXER_STREAM_MAX];
+    SemaphoreHandle_t lock;            /**< held by the mixer task over a block and by open/close, never by writers */
+    SemaphoreHandle_t exit_sem;
+    TaskHandle_t task;
+    int32_t *acc;                      /**< block_frames stereo accumulators */
+    int16_t *out;
+    bool volatile running;
+} audio_mixer_handle;
+typedef audio_mixer_handle *audio_mixer_handle_t;
+
+static audio_mixer_handle_t g_audio_mixer_handle = NULL;
+
+static inline uint32_t queue_count(audio_mixer_stream_t *s)
+{
+    return __atomic_load_n(&s->head, __ATOMIC_ACQUIRE) - s->tail;
+}
+
+static inline uint32_t queue_free(audio_mixer_stream_t *s)
+{
+    return s->size - (s->head - __atomic_load_n(&s->tail, __ATOMIC_ACQUIRE));
+}
+
+/**
+ * Lowpass at the lower of the two Nyquist rates, a little under it to leave room for the transition band,
+ * each phase normalized to unity gain so a constant input stays constant
+ */
+static esp_err_t resample_init(audio_mixer_stream_t *s, int out_rate)
+{
+    s->coef = malloc(sizeof(int16_t) * RESAMPLE_PHASES * RESAMPLE_TAPS);
+    AUDIO_MIXER_CHECK(s->coef != NULL, AUDIO_MIXER_ALLOC_ERROR, ESP_ERR_NO_MEM);
+
+    float fc = 0.9f * (s->rate > out_rate ? (float)out_rate / s->rate : 1.0f);
+    float half = RESAMPLE_TAPS / 2;
+    float h[RESAMPLE_TAPS];
+
+    for (int p = 0; p < RESAMPLE_PHASES; p++) {
+        float sum = 0;
+
+        for (int k = 0; k < RESAMPLE_TAPS; k++) {
+            float t = (k - (half - 1)) - (float)p / RESAMPLE_PHASES;
+            float x = (float)M_PI * fc * t;
+            float sinc = (t == 0) ? 1.0f : sinf(x) / x;
+            float w = 0.42f + 0.5f * cosf((float)M_PI * t / half) + 0.08f * cosf(2 * (float)M_PI * t / half);
+            h[k] = (fabsf(t) < half) ? sinc * w : 0;
+            sum += h[k];
+        }
+
+        for (int k = 0; k < RESAMPLE_TAPS; k++) {
+            s->coef[p][k] = (int16_t)lrintf(h[k] / sum * (1 << RESAMPLE_COEF_BITS));
+        }
+    }
+
+    s->step = s->rate / out_rate;
+    s->step_rem = s->rate % out_rate;
+    s->out_rate = out_rate;
+    s->phase_mul = (uint32_t)(((uint64_t)RESAMPLE_PHASES << 32) / out_rate);
+    s->frac = 0;
+    return ESP_OK;
+}
+
+/**
+ * Add up to frames output frames of a stream to acc, fewer when its queue runs dry
+ */
+static uint32_t stream_mix(audio_mixer_stream_t *s, int32_t *acc, uint32_t frames)
+{
+    uint32_t tail = s->tail;
+    uint32_t avail = queue_count(s);
+    int32_t gain = s->gain;
+    const uint32_t *buf = s->buf;
+    uint32_t mask = s->mask;
+    uint32_t n = 0;
+
+    if (NULL == s->coef) {
+        n = avail < frames ? avail : frames;
+
+        for (uint32_t i = 0; i < n; i++) {
+            uint32_t f = buf[(tail + i) & mask];
+            acc[2 * i] += ((int16_t)(f & 0xffff) * gain) >> 8;
+            acc[2 * i + 1] += ((int16_t)(f >> 16) * gain) >> 8;
+        }
+
+        tail += n;
+    } else {
+        uint32_t frac = s->frac;
+
+        for (; n < frames && avail >= RESAMPLE_TAPS; n++) {
+            const int16_t *h = s->coef[((uint64_t)frac * s->phase_mul) >> 32];
+            int32_t l = 0;
+            int32_t r = 0;
+
+            for (int k = 0; k < RESAMPLE_TAPS; k++) {
+                uint32_t f = buf[(tail + k) & mask];
+                l += (int16_t)(f & 0xffff) * h[k];
+                r += (int16_t)(f >> 16) * h[k];
+            }
+
+            acc[2 * n] += ((l >> RESAMPLE_COEF_BITS) * gain) >> 8;
+            acc[2 * n + 1] += ((r >> RESAMPLE_COEF_BITS) * gain) >> 8;
+
+            uint32_t adv = s->step;
+            frac += s->step_rem;
+
+            if (frac >= s->out_rate) {
+                frac -= s->out_rate;
+                adv++;
+            }
+
+            tail += adv;
+            avail -= adv;
+        }
+
+        s->frac = frac;
+    }
+
+    __atomic_store_n(&s->tail, tail, __ATOMIC_RELEASE);
+
+    if (s->writer_waiting) {
+        s->writer_waiting = 0;
+        xSemaphoreGive(s->semaphore_room);
+    }
+
+    return n;
+}
+
+static void audio_mixer_task(void *arg)
+{
+    audio_mixer_handle_t handle = (audio_mixer_handle_t)arg;
+    uint32_t frames = handle->config.block_frames;
+
+    while (handle->running) {
+        uint32_t mixed = 0;
+        memset(handle->acc, 0, frames * 2 * sizeof(int32_t));
+
+        xSemaphoreTake(handle->lock, portMAX_DELAY);
+
+        for (int i = 0; i < AUDIO_MIXER_STREAM_MAX; i++) {
+            if (handle->streams[i].used) {
+                uint32_t n = stream_mix(&handle->streams[i], handle->acc, frames);
+                mixed = n > mixed ? n : mixed;
+            }
+        }
+
+        xSemaphoreGive(handle->lock);
+
+        if (0 == mixed) {
+            /**< nothing queued, sleep until a writer wakes us instead of pushing silence */
+            ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(IDLE_WAIT_MS));
+            continue;
+        }
+
+        for (uint32_t i = 0; i < mixed * 2; i++) {
+            int32_t v = handle->acc[i];
+            handle->out[i] = v > INT16_MAX ? INT16_MAX : (v < INT16_MIN ? INT16_MIN : v);
+        }
+
+        handle->config.output(handle->config.output_ctx, handle->out, mixed);
+        if (handle->config.tap) {
+            handle->config.tap(handle->config.tap_ctx, handle->out, mixed);
+        }
+    }
+
+    xSemaphoreGive(handle->exit_sem);
+    vTaskDelete(NULL);
+}
+
+static void stream_free(audio_mixer_stream_t *s)
+{
+    if (s->semaphore_room) {
+        vSemaphoreDelete(s->semaphore_room);
+    }
+
+    free(s->buf);
+    free(s->coef);
+    memset(s, 0, sizeof(audio_mixer_stream_t));
+}
+
+esp_err_t audio_mixer_init(const audio_mixer_config_t *cfg)
+{
+    AUDIO_MIXER_CHECK(cfg != NULL && cfg->output != NULL, AUDIO_MIXER_PARAM_ERROR, ESP_ERR_INVALID_ARG);
+    AUDIO_MIXER_CHECK(cfg->rate <= SAMPLE_RATE_MAX && cfg->rate >= SAMPLE_RATE_MIN, AUDIO_MIXER_PARAM_ERROR, ESP_ERR_INVALID_ARG);
+    AUDIO_MIXER_CHECK(g_audio_mixer_handle == NULL, AUDIO_MIXER_STATUS_ERROR, ESP_ERR_INVALID_STATE);
+
+    audio_mixer_handle_t handle = calloc(1, sizeof(audio_mixer_handle));
+    AUDIO_MIXER_CHECK(handle != NULL, AUDIO_MIXER_ALLOC_ERROR, ESP_ERR_NO_MEM);
+
+    handle->config = *cfg;
+
+    if (0 == handle->config.block_frames) {
+        handle->config.block_frames = BLOCK_FRAMES;
+    }
+
+    handle->acc = malloc(handle->config.block_frames * 2 * sizeof(int32_t));
+    handle->out = malloc(handle->config.block_frames * 2 * sizeof(int16_t));
+    handle->lock = xSemaphoreCreateMutex();
+    handle->exit_sem = xSemaphoreCreateBinary();
+
+    if (!handle->acc || !handle->out || !handle->lock || !handle->exit_sem) {
+        ESP_LOGE(TAG, "%s(%d): %s", __FUNCTION__, __LINE__, AUDIO_MIXER_ALLOC_ERROR);
+        goto err;
+    }
+
+    handle->running = true;
+
+    if (pdPASS != xTaskCreatePinnedToCore(audio_mixer_task, "audio_mixer", 3 * 1024, handle,
+                                          cfg->task_priority, &handle->task, cfg->task_core)) {
+        ESP_LOGE(TAG, "%s(%d): %s", __FUNCTION__, __LINE__, AUDIO_MIXER_ALLOC_ERROR);
+        goto err;
+    }
+
+    g_audio_mixer_handle = handle;
+    return ESP_OK;
+
+err:
+
+    if (handle->lock) {
+        vSemaphoreDelete(handle->lock);
+    }
+
+    if (handle->exit_sem) {
+        vSemaphoreDelete(handle->exit_sem);
+    }
+
+    free(handle->acc);
+    free(handle->out);
+    free(handle);
+    return ESP_ERR_NO_MEM;
+}
+
+esp_err_t audio_mixer_deinit(void)
+{
+    audio_mixer_handle_t handle = g_audio_mixer_handle;
+    AUDIO_MIXER_CHECK(handle != NULL, AUDIO_MIXER_STATUS_ERROR, ESP_ERR_INVALID_STATE);
+
+    handle->running = false;
+    xTaskNotifyGive(handle->task);
+    xSemaphoreTake(handle->exit_sem, portMAX_DELAY);
+
+    for (int i = 0; i < AUDIO_MIXER_STREAM_MAX; i++) {
+        if (handle->streams[i].used) {
+            stream_free(&handle->streams[i]);
+        }
+    }
+
+    vSemaphoreDelete(handle->lock);
+    vSemaphoreDelete(handle->exit_sem);
+    free(handle->acc);
+    free(handle->out);
+    free(handle);
+    g_audio_mixer_handle = NULL;
+    return ESP_OK;
+}
+
+esp_err_t audio_mixer_stream_open(const audio_mixer_stream_config_t *cfg, audio_mixer_stream_handle_t *stream)
+{
+    esp_err_t res = ESP_OK;
+    audio_mixer_handle_t handle = g_audio_mixer_handle;
+    AUDIO_MIXER_CHECK(handle != NULL, AUDIO_MIXER_STATUS_ERROR, ESP_ERR_INVALID_STATE);
+    AUDIO_MIXER_CHECK(cfg != NULL && stream != NULL, AUDIO_MIXER_PARAM_ERROR, ESP_ERR_INVALID_ARG);
+    AUDIO_MIXER_CHECK(cfg->rate <= SAMPLE_RATE_MAX && cfg->rate >= SAMPLE_RATE_MIN, AUDIO_MIXER_PARAM_ERROR, ESP_ERR_INVALID_ARG);
+    AUDIO_MIXER_CHECK(cfg->channels == 1 || cfg->channels == 2, AUDIO_MIXER_PARAM_ERROR, ESP_ERR_INVALID_ARG);
+    AUDIO_MIXER_CHECK(cfg->gain <= GAIN_MAX, AUDIO_MIXER_PARAM_ERROR, ESP_ERR_INVALID_ARG);
+
+    audio_mixer_stream_t s = {0};
+    s.rate = cfg->rate;
+    s.channels = cfg->channels;
+    s.gain = cfg->gain ? cfg->gain : AUDIO_MIXER_GAIN_UNITY;
+
+    s.size = RESAMPLE_TAPS * 2;
+
+    while (s.size < (cfg->queue_frames ? cfg->queue_frames : QUEUE_FRAMES)) {
+        s.size <<= 1;
+    }
+
+    s.mask = s.size - 1;
+    s.buf = malloc(s.size * sizeof(uint32_t));
+    s.semaphore_room = xSemaphoreCreateBinary();
+
+    if (!s.buf || !s.semaphore_room) {
+        stream_free(&s);
+        AUDIO_MIXER_CHECK(0, AUDIO_MIXER_ALLOC_ERROR, ESP_ERR_NO_MEM);
+    }
+
+    if (s.rate != handle->config.rate) {
+        res = resample_init(&s, handle->config.rate);
+
+        if (ESP_OK != res) {
+            stream_free(&s);
+            return res;
+        }
+    }
+
+    xSemaphoreTake(handle->lock, portMAX_DELAY);
+    audio_mixer_stream_t *slot = NULL;
+
+    for (int i = 0; i < AUDIO_MIXER_STREAM_MAX; i++) {
+        if (!handle->streams[i].used) {
+            slot = &handle->streams[i];
+            break;
+        }
+    }
+
+    if (slot) {
+        s.used = 1;
+        *slot = s;
+    }
+
+    xSemaphoreGive(handle->lock);
+
+    if (NULL == slot) {
+        stream_free(&s);
+        AUDIO_MIXER_CHECK(0, AUDIO_MIXER_ALLOC_ERROR, ESP_ERR_NO_MEM);
+    }
+
+    *stream = slot;
+    return ESP_OK;
+}
+
+esp_err_t audio_mixer_stream_close(audio_mixer_stream_handle_t stream)
+{
+    audio_mixer_handle_t handle = g_audio_mixer_handle;
+    AUDIO_MIXER_CHECK(handle != NULL, AUDIO_MIXER_STATUS_ERROR, ESP_ERR_INVALID_STATE);
+    AUDIO_MIXER_CHECK(stream != NULL && stream->used, AUDIO_MIXER_PARAM_ERROR, ESP_ERR_INVALID_ARG);
+
+    /**< the lock keeps the mixer task out of the stream while it goes */
+    xSemaphoreTake(handle->lock, portMAX_DELAY);
+    stream_free(stream);
+    xSemaphoreGive(handle->lock);
+    return ESP_OK;
+}
+
+esp_err_t audio_mixer_stream_write(audio_mixer_stream_handle_t stream, const int16_t *data, size_t frames,
+                                   size_t *frames_written, TickType_t ticks_to_wait)
+{
+    audio_mixer_handle_t handle = g_audio_mixer_handle;
+    AUDIO_MIXER_CHECK(stream != NULL && data != NULL && frames_written != NULL, AUDIO_MIXER_PARAM_ERROR, ESP_ERR_INVALID_ARG);
+
+    audio_mixer_stream_t *s = stream;
+    *frames_written = 0;
+
+    while (frames) {
+        uint32_t room = queue_free(s);
+
+        if (0 == room) {
+            s->writer_waiting = 1;
+
+            /**< the mixer may have made room before it saw the flag */
+            if (0 == queue_free(s) && pdTRUE != xSemaphoreTake(s->semaphore_room, ticks_to_wait)) {
+                s->writer_waiting = 0;
+                return ESP_ERR_TIMEOUT;
+            }
+
+            continue;
+        }
+
+        uint32_t n = frames < room ? frames : room;
+        uint32_t head = s->head;
+
+        if (2 == s->channels) {
+            for (uint32_t i = 0; i < n; i++) {
+                s->buf[(head + i) & s->mask] = (uint16_t)data[2 * i] | ((uint32_t)(uint16_t)data[2 * i + 1] << 16);
+            }
+        } else {
+            for (uint32_t i = 0; i < n; i++) {
+                s->buf[(head + i) & s->mask] = (uint16_t)data[i] * 0x10001UL;
+            }
+        }
+
+        __atomic_store_n(&s->head, head + n, __ATOMIC_RELEASE);
+        data += n * s->channels;
+        frames -= n;
+        *frames_written += n;
+        xTaskNotifyGive(handle->task);
+    }
+
+    return ESP_OK;
+}
+
+esp_err_t audio_mixer_stream_set_gain(audio_mixer_stream_handle_t stream, uint32_t gain)
+{
+    AUDIO_MIXER_CHECK(stream != NULL && gain <= GAIN_MAX, AUDIO_MIXER_PARAM_ERROR, ESP_ERR_INVALID_ARG);
+    stream->gain = gain;
+    return ESP_OK;
+}
+
+uint32_t audio_mixer_stream_get_queued(audio_mixer_stream_handle_t stream)
+{
+    return queue_count(stream);
+}
+
+esp_err_t audio_mixer_output_pwm_audio(void *ctx, const int16_t *frames, size_t count)
+{
+    size_t written = 0;
+    return pwm_audio_write((uint8_t *)frames, count * 4, &written, portMAX_DELAY);
+}
+
+esp_err_t audio_mixer_output_i2s(void *ctx, const int16_t *frames, size_t count)
+{
+    size_t written = 0;
+    return i2s_write((i2s_port_t)(intptr_t)ctx, frames, count * 4, &written, portMAX_DELAY);
+}
@@ -0,0 +1,161 @@
+// Copyright 2020 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _AUDIO_MIXER_H_
+#define _AUDIO_MIXER_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define AUDIO_MIXER_STREAM_MAX  (4)
+#define AUDIO_MIXER_GAIN_UNITY  (256)   /*!< stream gain is Q8 */
+
+/**
+ * @brief Mixer output, count frames of 16 bit stereo (left first) at the mixer rate.
+ *        It should block until the frames are taken, that paces the mixer task
+ */
+typedef esp_err_t (*audio_mixer_output_t)(void *ctx, const int16_t *frames, size_t count);
+
+/**
+ * @brief Configuration of the mixer for audio_mixer_init function
+ */
+typedef struct {
+    int rate;                       /*!< output sample rate, every stream is resampled to it */
+    uint32_t block_frames;          /*!< frames mixed per output call, 0: 256 */
+    audio_mixer_output_t output;    /*!< output, see audio_mixer_output_pwm_audio and audio_mixer_output_i2s */
+    void *output_ctx;               /*!< passed to output */
+    audio_mixer_output_t tap;       /*!< optional, gets every block once output took it, e.g. aec_ref_tap for the AEC reference */
+    void *tap_ctx;                  /*!< passed to tap */
+    UBaseType_t task_priority;      /*!< mixer task priority */
+    BaseType_t task_core;           /*!< mixer task core, tskNO_AFFINITY for any */
+} audio_mixer_config_t;
+
+/**
+ * @brief Configuration of a stream for audio_mixer_stream_open function
+ */
+typedef struct {
+    int rate;                       /*!< input sample rate, 8000 - 48000 */
+    int channels;                   /*!< 1 or 2, 16 bit interleaved samples */
+    uint32_t queue_frames;          /*!< input queue size in frames, rounded up to a power of two, 0: 1024 */
+    uint32_t gain;                  /*!< Q8, AUDIO_MIXER_GAIN_UNITY: unchanged, 0 is taken as unity */
+} audio_mixer_stream_config_t;
+
+typedef struct audio_mixer_stream *audio_mixer_stream_handle_t;
+
+/**
+ * @brief Initializes the mixer and starts its task
+ *
+ * @param cfg Pointer of audio_mixer_config_t struct
+ *
+ * @return
+ *     - ESP_OK Success
+ *     - ESP_ERR_INVALID_ARG Parameter error
+ *     - ESP_ERR_NO_MEM No memory
+ */
+esp_err_t audio_mixer_init(const audio_mixer_config_t *cfg);
+
+/**
+ * @brief Stop the mixer task and free every stream
+ *
+ * @return
+ *     - ESP_OK Success
+ */
+esp_err_t audio_mixer_deinit(void);
+
+/**
+ * @brief Add a stream to the mix, it plays as soon as data is written
+ *
+ * A stream at another rate than the mixer goes through a polyphase resampler
+ *
+ * @param cfg Pointer of audio_mixer_stream_config_t struct
+ * @param stream returned stream handle
+ *
+ * @return
+ *     - ESP_OK Success
+ *     - ESP_ERR_INVALID_ARG Parameter error
+ *     - ESP_ERR_NO_MEM No memory or no free stream
+ */
+esp_err_t audio_mixer_stream_open(const audio_mixer_stream_config_t *cfg, audio_mixer_stream_handle_t *stream);
+
+/**
+ * @brief Remove a stream from the mix, frames still queued are dropped
+ *
+ * @param stream stream handle, not valid after the call
+ *
+ * @return
+ *     - ESP_OK Success
+ */
+esp_err_t audio_mixer_stream_close(audio_mixer_stream_handle_t stream);
+
+/**
+ * @brief Queue frames of a stream
+ *
+ * Only one task may write a stream. The queue has no lock, the writer blocks only while it is full
+ *
+ * @param stream stream handle
+ * @param data 16 bit samples, channels interleaved
+ * @param frames number of frames in data
+ * @param frames_written frames queued
+ * @param ticks_to_wait wait for room in the queue
+ *
+ * @return
+ *     - ESP_OK Success
+ *     - ESP_ERR_TIMEOUT the queue stayed full, frames_written tells how many were taken
+ */
+esp_err_t audio_mixer_stream_write(audio_mixer_stream_handle_t stream, const int16_t *data, size_t frames,
+                                   size_t *frames_written, TickType_t ticks_to_wait);
+
+/**
+ * @brief Set the gain of a stream, takes effect on the next mixed block
+ *
+ * @param stream stream handle
+ * @param gain Q8, AUDIO_MIXER_GAIN_UNITY: unchanged, up to 4 * AUDIO_MIXER_GAIN_UNITY
+ *
+ * @return
+ *     - ESP_OK Success
+ *     - ESP_ERR_INVALID_ARG Parameter error
+ */
+esp_err_t audio_mixer_stream_set_gain(audio_mixer_stream_handle_t stream, uint32_t gain);
+
+/**
+ * @brief Frames queued on a stream and not mixed yet
+ *
+ * @param stream stream handle
+ *
+ * @return queued frames
+ */
+uint32_t audio_mixer_stream_get_queued(audio_mixer_stream_handle_t stream);
+
+/**
+ * @brief Output to pwm_audio, set it to the mixer rate, 16 bits and 2 channels and start it first
+ */
+esp_err_t audio_mixer_output_pwm_audio(void *ctx, const int16_t *frames, size_t count);
+
+/**
+ * @brief Output to an installed I2S driver at the mixer rate, 16 bits stereo, ctx is the i2s_port_t
+ */
+esp_err_t audio_mixer_output_i2s(void *ctx, const int16_t *frames, size_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,260 @@
+// Copyright 2015-2019 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_timer.h"
+#include "esp_aec.h"
+#include "esp_aec_ref.h"
+
+#define REF_DECIMATE    8       // the estimator runs at 2kHz
+#define REF_WINDOW_MS   500     // correlated per estimate
+#define REF_ANCHORS     4       // playback runs remembered
+#define REF_GAP_US      20000   // a block this late after the previous one starts a new run
+#define REF_MIN_CORR    0.3f    // normalized peak an estimate needs
+#define REF_MIN_POWER   (64 * 64) // mean square of the decimated reference, -54dBFS: nothing plays
+
+// A run of blocks played back to back, sample idx went out at time
+typedef struct {
+    int64_t time;
+    uint32_t idx;
+} ref_anchor_t;
+
+struct aec_ref {
+    aec_ref_config_t cfg;
+    int factor;                 // tap frames per reference sample
+    int16_t *ring;
+    uint32_t mask;
+    uint32_t written;
+    ref_anchor_t anchor[REF_ANCHORS];
+    int anchors;
+    portMUX_TYPE lock;
+    int16_t *mic_dec;           // decimated mic, win samples, oldest first
+    int16_t *ref_dec;           // decimated reference at lag 0, win + lags samples
+    int win;
+    int lags;
+    int fill;                   // decimated samples in the histories
+    int since;                  // decimated samples since the last estimate
+    int delay_us;
+    float corr;
+};
+
+aec_ref_handle_t aec_ref_create(const aec_ref_config_t *cfg)
+{
+    if (cfg->rate % AEC_SAMPLE_RATE || cfg->channels < 1 || cfg->buffer_ms <= cfg->max_delay_ms) {
+        return NULL;
+    }
+    aec_ref_handle_t inst = calloc(1, sizeof(struct aec_ref));
+    if (inst == NULL) {
+        return NULL;
+    }
+    inst->cfg = *cfg;
+    inst->factor = cfg->rate / AEC_SAMPLE_RATE;
+    uint32_t size = 1;
+    while (size < cfg->buffer_ms * (AEC_SAMPLE_RATE / 1000)) {
+        size <<= 1;
+    }
+    inst->mask = size - 1;
+    inst->win = REF_WINDOW_MS * AEC_SAMPLE_RATE / 1000 / REF_DECIMATE;
+    inst->lags = cfg->max_delay_ms * AEC_SAMPLE_RATE / 1000 / REF_DECIMATE;
+    inst->delay_us = cfg->delay_ms * 1000;
+    portMUX_INITIALIZE(&inst->lock);
+    inst->ring = calloc(size, sizeof(int16_t));
+    inst->mic_dec = calloc(inst->win, sizeof(int16_t));
+    inst->ref_dec = calloc(inst->win + inst->lags, sizeof(int16_t));
+    if (inst->ring == NULL || inst->mic_dec == NULL || inst->ref_dec == NULL) {
+        aec_ref_destroy(inst);
+        return NULL;
+    }
+    return inst;
+}
+
+void aec_ref_write(aec_ref_handle_t inst, const int16_t *frames, size_t count, int64_t time_us)
+{
+    int step = inst->factor * inst->cfg.channels;
+    uint32_t n = count / inst->factor;
+    uint32_t idx = inst->written;
+
+    portENTER_CRITICAL(&inst->lock);
+    const ref_anchor_t *last = inst->anchors ? &inst->anchor[(inst->anchors - 1) % REF_ANCHORS] : NULL;
+    // 输出队列满时块比播放时间早返回，只有晚于上一段的结尾才说明播放中断过
+    if (last == NULL || time_us > last->time + (int64_t)(idx - last->idx) * 1000000 / AEC_SAMPLE_RATE + REF_GAP_US) {
+        inst->anchor[inst->anchors % REF_ANCHORS] = (ref_anchor_t) {
+            .time = time_us,
+            .idx = idx,
+        };
+        inst->anchors++;
+    }
+    portEXIT_CRITICAL(&inst->lock);
+
+    for (uint32_t i = 0; i < n; i++, frames += step) {
+        int32_t sum = 0;
+        for (int k = 0; k < step; k++) {
+            sum += frames[k];
+        }
+        inst->ring[(idx + i) & inst->mask] = sum / step;
+    }
+    portENTER_CRITICAL(&inst->lock);
+    inst->written = idx + n;
+    portEXIT_CRITICAL(&inst->lock);
+}
+
+esp_err_t aec_ref_tap(void *ctx, const int16_t *frames, size_t count)
+{
+    aec_ref_write((aec_ref_handle_t)ctx, frames, count, esp_timer_get_time());
+    return ESP_OK;
+}
+
+// The reference samples that went out from time_us on, silence where nothing played or it is gone
+static void ref_copy(aec_ref_handle_t inst, int64_t time_us, int16_t *dst, int samples)
+{
+    ref_anchor_t anchor[REF_ANCHORS];
+    int anchors;
+    uint32_t written;
+
+    portENTER_CRITICAL(&inst->lock);
+    anchors = inst->anchors < REF_ANCHORS ? inst->anchors : REF_ANCHORS;
+    for (int i = 0; i < anchors; i++) {
+        anchor[i] = inst->anchor[(inst->anchors - 1 - i) % REF_ANCHORS]; // newest first
+    }
+    written = inst->written;
+    portEXIT_CRITICAL(&inst->lock);
+
+    for (int done = 0; done < samples;) {
+        int64_t t = time_us + (int64_t)done * 1000000 / AEC_SAMPLE_RATE;
+        int run = samples - done;
+        int copy = 0;
+        uint32_t idx = 0;
+        int i = 0;
+        while (i < anchors && t < anchor[i].time) {
+            i++;
+        }
+        if (i < anchors) {
+            // 一段播放的结尾是下一段的开头
+            uint32_t end = i ? anchor[i - 1].idx : written;
+            uint32_t pos = anchor[i].idx + (uint32_t)((t - anchor[i].time) * AEC_SAMPLE_RATE / 1000000);
+            if (pos < end && written - pos <= inst->mask) {
+                idx = pos;
+                copy = end - pos < run ? end - pos : run;
+            }
+        }
+        if (copy) {
+            for (int k = 0; k < copy; k++) {
+                dst[done + k] = inst->ring[(idx + k) & inst->mask];
+            }
+            done += copy;
+        } else {
+            // silence up to the next run that starts within the frame
+            if (i) {
+                int64_t next = (anchor[i - 1].time - t) * AEC_SAMPLE_RATE / 1000000;
+                run = next < 1 ? 1 : (next < run ? next : run);
+            }
+            memset(dst + done, 0, run * sizeof(int16_t));
+            done += run;
+        }
+    }
+}
+
+static void ref_push(int16_t *hist, int len, const int16_t *pcm, int n)
+{
+    memmove(hist, hist + n, (len - n) * sizeof(int16_t));
+    for (int i = 0; i < n; i++, pcm += REF_DECIMATE) {
+        int32_t sum = 0;
+        for (int k = 0; k < REF_DECIMATE; k++) {
+            sum += pcm[k];
+        }
+        hist[len - n + i] = sum / REF_DECIMATE;
+    }
+}
+
+// Lag of the strongest normalized correlation, while the reference carries enough to tell
+static void ref_estimate(aec_ref_handle_t inst)
+{
+    const int16_t *mic = inst->mic_dec;
+    const int16_t *ref = inst->ref_dec;
+    int64_t mic_pow = 0;
+    int64_t ref_pow = 0;
+    float best = 0;
+    int best_lag = -1;
+
+    for (int k = 0; k < inst->win; k++) {
+        mic_pow += mic[k] * mic[k];
+    }
+    // the reference under lag 0, slid one sample back per lag
+    for (int k = 0; k < inst->win; k++) {
+        ref_pow += ref[inst->lags + k] * ref[inst->lags + k];
+    }
+    if (mic_pow == 0) {
+        return;
+    }
+    for (int lag = 0; lag < inst->lags; lag++) {
+        const int16_t *r = ref + inst->lags - lag;
+        if (lag) {
+            ref_pow += r[0] * r[0] - r[inst->win] * r[inst->win];
+        }
+        if (ref_pow < (int64_t)REF_MIN_POWER * inst->win) {
+            continue;
+        }
+        int64_t acc = 0;
+        for (int k = 0; k < inst->win; k++) {
+            acc += mic[k] * r[k];
+        }
+        float c = fabsf((float)acc) / sqrtf((float)mic_pow * (float)ref_pow);
+        if (c > best) {
+            best = c;
+            best_lag = lag;
+        }
+    }
+    if (best_lag >= 0 && best >= REF_MIN_CORR) {
+        inst->corr = best;
+        inst->delay_us = (int64_t)best_lag * REF_DECIMATE * 1000000 / AEC_SAMPLE_RATE;
+    }
+}
+
+void aec_ref_align(aec_ref_handle_t inst, const int16_t *mic, int16_t *ref, int samples, int64_t time_us)
+{
+    int n = samples / REF_DECIMATE;
+
+    // 估计用的是零延时对齐的参考信号，ref 先当缓冲区用
+    ref_copy(inst, time_us, ref, n * REF_DECIMATE);
+    ref_push(inst->ref_dec, inst->win + inst->lags, ref, n);
+    ref_push(inst->mic_dec, inst->win, mic, n);
+    inst->fill += n;
+    inst->since += n;
+    if (inst->fill >= inst->win + inst->lags && inst->since >= inst->win) {
+        ref_estimate(inst);
+        inst->since = 0;
+    }
+    ref_copy(inst, time_us - inst->delay_us + inst->cfg.lead_ms * 1000, ref, samples);
+}
+
+int aec_ref_get_delay(aec_ref_handle_t inst, float *corr)
+{
+    if (corr) {
+        *corr = inst->corr;
+    }
+    return inst->delay_us;
+}
+
+void aec_ref_destroy(aec_ref_handle_t inst)
+{
+    if (inst == NULL) {
+        return;
+    }
+    free(inst->ring);
+    free(inst->mic_dec);
+    free(inst->ref_dec);
+    free(inst);
+}
@@ -0,0 +1,200 @@
+// Copyright 2015-2019 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License
+#include <stdlib.h>
+#include <string.h>
+#include "esp_afe.h"
+#include "esp_ns.h"
+#include "esp_agc.h"
+#include "trace.h"
+
+#define AFE_SAMPLES_PER_MS  (AFE_SAMPLE_RATE / 1000)
+
+#if (AFE_FRAME_LENGTH_MS % AEC_FRAME_LENGTH_MS) || (AFE_FRAME_LENGTH_MS % AFE_NS_FRAME_LENGTH_MS) \
+    || (AFE_FRAME_LENGTH_MS % AFE_AGC_FRAME_LENGTH_MS) || (AFE_FRAME_LENGTH_MS % AFE_VAD_FRAME_LENGTH_MS)
+#error "AFE_FRAME_LENGTH_MS must hold a whole number of frames of every stage"
+#endif
+
+/*
+ * One allocation holds the engine and its three frame buffers. A stage reads one buffer and writes
+ * another, the roles rotate, so a frame is never copied between the stages
+ */
+struct afe_engine {
+    afe_config_t cfg;
+    aec_handle_t aec;
+    ns_handle_t ns;
+    void *agc;
+    vad_handle_t vad;
+    trace_stage_t stage;        // a frame has to be through before the next one is captured
+    int16_t *mic;
+    int16_t *ref;
+    int16_t *work;
+    int16_t arena[3 * AFE_FRAME_SAMPLES];
+};
+
+static inline void afe_swap(int16_t **a, int16_t **b)
+{
+    int16_t *t = *a;
+    *a = *b;
+    *b = t;
+}
+
+afe_handle_t afe_create(const afe_config_t *cfg)
+{
+    struct afe_engine *afe = calloc(1, sizeof(struct afe_engine));
+    if (afe == NULL) {
+        return NULL;
+    }
+    afe->cfg = *cfg;
+    afe->mic = afe->arena;
+    afe->ref = afe->arena + AFE_FRAME_SAMPLES;
+    afe->work = afe->arena + 2 * AFE_FRAME_SAMPLES;
+    afe->stage = trace_stage_register("afe", AFE_FRAME_LENGTH_MS * 1000);
+
+    if (cfg->aec_enable && (afe->aec = aec_create(AFE_SAMPLE_RATE, AEC_FRAME_LENGTH_MS, AEC_FILTER_LENGTH)) == NULL) {
+        goto err;
+    }
+    if (cfg->ns_enable && (afe->ns = ns_create(AFE_NS_FRAME_LENGTH_MS)) == NULL) {
+        goto err;
+    }
+    if (cfg->agc_enable) {
+        afe->agc = esp_agc_open(cfg->agc_mode, AFE_SAMPLE_RATE);
+        if (afe->agc == NULL) {
+            goto err;
+        }
+        set_agc_config(afe->agc, cfg->agc_gain_db, cfg->agc_limiter_enable, cfg->agc_target_level_dbfs);
+    }
+    if (cfg->vad_enable && (afe->vad = vad_create(cfg->vad_mode, AFE_SAMPLE_RATE, AFE_VAD_FRAME_LENGTH_MS)) == NULL) {
+        goto err;
+    }
+    return afe;
+
+err:
+    afe_destroy(afe);
+    return NULL;
+}
+
+int16_t *afe_get_mic_buffer(afe_handle_t inst)
+{
+    return inst->mic;
+}
+
+int16_t *afe_get_ref_buffer(afe_handle_t inst)
+{
+    return inst->ref;
+}
+
+void afe_feed_interleaved(afe_handle_t inst, const int16_t *pcm, int channels, int mic_channel, int ref_channel)
+{
+    for (int i = 0; i < AFE_FRAME_SAMPLES; i++) {
+        inst->mic[i] = pcm[i * channels + mic_channel];
+        inst->ref[i] = pcm[i * channels + ref_channel];
+    }
+}
+
+void afe_feed_beamformed(afe_handle_t inst, bf_handle_t bf, const int16_t *pcm, int channels, int ref_channel)
+{
+    bf_process(bf, pcm, channels, AFE_FRAME_SAMPLES, inst->mic);
+    if (ref_channel < 0) {
+        return;
+    }
+    for (int i = 0; i < AFE_FRAME_SAMPLES; i++) {
+        inst->ref[i] = pcm[i * channels + ref_channel];
+    }
+}
+
+void afe_feed_planar(afe_handle_t inst, bf_handle_t bf, const int16_t *const *planes, int mic_channel, int ref_channel)
+{
+    if (bf) {
+        bf_process_planar(bf, planes, AFE_FRAME_SAMPLES, inst->mic);
+    } else {
+        memcpy(inst->mic, planes[mic_channel], AFE_FRAME_SAMPLES * sizeof(int16_t));
+    }
+    if (ref_channel >= 0) {
+        memcpy(inst->ref, planes[ref_channel], AFE_FRAME_SAMPLES * sizeof(int16_t));
+    }
+}
+
+int16_t *afe_process(afe_handle_t inst, vad_state_t *vad_state)
+{
+    int step;
+    trace_stage_begin(inst->stage);
+    // mic holds the input of the next stage, work takes its output
+    if (inst->aec) {
+        TRACE_BEGIN("afe_aec");
+        step = AEC_FRAME_LENGTH_MS * AFE_SAMPLES_PER_MS;
+        for (int i = 0; i < AFE_FRAME_SAMPLES; i += step) {
+            aec_process(inst->aec, inst->mic + i, inst->ref + i, inst->work + i);
+        }
+        afe_swap(&inst->mic, &inst->work);
+        TRACE_END("afe_aec");
+    }
+    if (inst->ns) {
+        TRACE_BEGIN("afe_ns");
+        step = AFE_NS_FRAME_LENGTH_MS * AFE_SAMPLES_PER_MS;
+        for (int i = 0; i < AFE_FRAME_SAMPLES; i += step) {
+            ns_process(inst->ns, inst->mic + i, inst->work + i);
+        }
+        afe_swap(&inst->mic, &inst->work);
+        TRACE_END("afe_ns");
+    }
+    if (inst->agc) {
+        TRACE_BEGIN("afe_agc");
+        step = AFE_AGC_FRAME_LENGTH_MS * AFE_SAMPLES_PER_MS;
+        for (int i = 0; i < AFE_FRAME_SAMPLES; i += step) {
+            esp_agc_process(inst->agc, inst->mic + i, inst->work + i, step, AFE_SAMPLE_RATE);
+        }
+        afe_swap(&inst->mic, &inst->work);
+        TRACE_END("afe_agc");
+    }
+
+    vad_state_t state = VAD_SILENCE;
+    if (inst->vad) {
+        TRACE_BEGIN("afe_vad");
+        step = AFE_VAD_FRAME_LENGTH_MS * AFE_SAMPLES_PER_MS;
+        for (int i = 0; i < AFE_FRAME_SAMPLES; i += step) {
+            if (vad_process(inst->vad, inst->mic + i) == VAD_SPEECH) {
+                state = VAD_SPEECH;
+            }
+        }
+        TRACE_END("afe_vad");
+    }
+    if (vad_state) {
+        *vad_state = state;
+    }
+
+    // the result leaves through work, mic is free for the next frame
+    afe_swap(&inst->mic, &inst->work);
+    trace_stage_end(inst->stage);
+    return inst->work;
+}
+
+void afe_destroy(afe_handle_t inst)
+{
+    if (inst == NULL) {
+        return;
+    }
+    if (inst->aec) {
+        aec_destroy(inst->aec);
+    }
+    if (inst->ns) {
+        ns_destroy(inst->ns);
+    }
+    if (inst->agc) {
+        esp_agc_clse(inst->agc);
+    }
+    if (inst->vad) {
+        vad_destroy(inst->vad);
+    }
+    free(inst);
+}
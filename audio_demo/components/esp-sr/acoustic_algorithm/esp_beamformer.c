@@ -0,0 +1,171 @@
+// Copyright 2015-2019 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "esp_beamformer.h"
+
+#define BF_HIST         16      // power of 2, the longest delay plus the taps of the interpolator
+#define BF_FRAC_BITS    14
+#define BF_POW_SHIFT    6       // the power of the sum follows the last ~4ms
+#define BF_FLOOR_SHIFT  13      // its noise floor rises 8dB a second at most, falls at once
+#define BF_FLOOR_MIN    4096    // -54dBFS, after digital silence the floor needs a few seconds to climb back
+#define BF_FREEZE_SHIFT 2       // no adaptation while the sum is 6dB over the floor
+#define BF_W_MAX        (2 << 15)
+
+typedef struct {
+    int delay;                  // integer part, 1 at least so the interpolator stays causal
+    int32_t coef[4];            // Lagrange taps on x[n - delay + 1] .. x[n - delay - 2]
+} bf_delay_t;
+
+struct bf_engine {
+    bf_config_t cfg;
+    bf_delay_t d[2];
+    int16_t hist[2][BF_HIST];
+    int pos;
+    int16_t u[BF_GSC_TAPS];     // the blocking signal, newest first
+    int32_t b[BF_GSC_TAPS / 2]; // the sum waits for the middle of the filter, the noise path is two sided
+    int32_t w[BF_GSC_TAPS];     // Q15
+    int64_t u_pow;
+    int64_t b_avg;
+    int64_t b_floor;
+};
+
+static void bf_delay_design(bf_delay_t *d, float delay)
+{
+    int i = (int)delay;
+    float t = delay - i;
+
+    d->delay = i;
+    d->coef[0] = lrintf(-t * (t - 1) * (t - 2) / 6 * (1 << BF_FRAC_BITS));
+    d->coef[1] = lrintf((t + 1) * (t - 1) * (t - 2) / 2 * (1 << BF_FRAC_BITS));
+    d->coef[2] = lrintf(-(t + 1) * t * (t - 2) / 2 * (1 << BF_FRAC_BITS));
+    d->coef[3] = lrintf((t + 1) * t * (t - 1) / 6 * (1 << BF_FRAC_BITS));
+}
+
+int bf_set_steering(bf_handle_t inst, int steer_deg)
+{
+    float tdoa = inst->cfg.mic_distance_mm * sinf(steer_deg * (float)M_PI / 180) * inst->cfg.sample_rate
+                 / BF_SPEED_OF_SOUND_MMPS;
+
+    if (fabsf(tdoa) >= BF_MAX_DELAY) {
+        return -1;
+    }
+    // the mic reached first waits for the other one, both keep the base delay of one sample
+    bf_delay_design(&inst->d[0], 1 + (tdoa > 0 ? tdoa : 0));
+    bf_delay_design(&inst->d[1], 1 + (tdoa < 0 ? -tdoa : 0));
+    inst->cfg.steer_deg = steer_deg;
+    memset(inst->u, 0, sizeof(inst->u));
+    memset(inst->w, 0, sizeof(inst->w));
+    memset(inst->b, 0, sizeof(inst->b));
+    inst->u_pow = 0;
+    inst->b_floor = INT64_MAX >> 2;     // taken down by the first frames
+    return 0;
+}
+
+bf_handle_t bf_create(const bf_config_t *cfg)
+{
+    struct bf_engine *bf = calloc(1, sizeof(struct bf_engine));
+    if (bf == NULL) {
+        return NULL;
+    }
+    bf->cfg = *cfg;
+    if (bf_set_steering(bf, cfg->steer_deg) != 0) {
+        free(bf);
+        return NULL;
+    }
+    return bf;
+}
+
+static inline int32_t bf_delayed(const int16_t *h, int pos, const bf_delay_t *d)
+{
+    int p = pos - d->delay;
+    int32_t acc = d->coef[0] * h[(p + 1) & (BF_HIST - 1)] + d->coef[1] * h[p & (BF_HIST - 1)]
+                  + d->coef[2] * h[(p - 1) & (BF_HIST - 1)] + d->coef[3] * h[(p - 2) & (BF_HIST - 1)];
+    return acc >> BF_FRAC_BITS;
+}
+
+static inline int16_t bf_sat16(int32_t v)
+{
+    return v > INT16_MAX ? INT16_MAX : (v < INT16_MIN ? INT16_MIN : v);
+}
+
+// the noise left in the sum b, estimated from the blocking signal u, is taken out of it
+static int32_t bf_gsc(struct bf_engine *bf, int32_t b, int32_t u)
+{
+    int64_t est = 0;
+    int32_t e;
+
+    bf->u_pow += (int64_t)u * u - (int64_t)bf->u[BF_GSC_TAPS - 1] * bf->u[BF_GSC_TAPS - 1];
+    memmove(bf->u + 1, bf->u, (BF_GSC_TAPS - 1) * sizeof(int16_t));
+    bf->u[0] = u;
+    for (int k = 0; k < BF_GSC_TAPS; k++) {
+        est += (int64_t)bf->w[k] * bf->u[k];
+    }
+    int32_t bd = bf->b[BF_GSC_TAPS / 2 - 1];
+    memmove(bf->b + 1, bf->b, (BF_GSC_TAPS / 2 - 1) * sizeof(int32_t));
+    bf->b[0] = b;
+    b = bd;
+    e = b - (int32_t)(est >> 15);
+
+    bf->b_avg += ((int64_t)b * b - bf->b_avg) >> BF_POW_SHIFT;
+    if (bf->b_avg < bf->b_floor) {
+        bf->b_floor = bf->b_avg > BF_FLOOR_MIN ? bf->b_avg : BF_FLOOR_MIN;
+    } else {
+        bf->b_floor += (bf->b_floor >> BF_FLOOR_SHIFT) + 1;
+    }
+    if (bf->b_avg <= (bf->b_floor << BF_FREEZE_SHIFT)) {
+        int64_t g = ((int64_t)bf->cfg.step_q15 * e << 16) / (bf->u_pow + (BF_GSC_TAPS << 12));
+        for (int k = 0; k < BF_GSC_TAPS; k++) {
+            int64_t w = bf->w[k] + ((g * bf->u[k]) >> 16);
+            bf->w[k] = w > BF_W_MAX ? BF_W_MAX : (w < -BF_W_MAX ? -BF_W_MAX : w);
+        }
+    }
+    return e;
+}
+
+// x0 and x1 are the samples of the two mics, stride apart: the channels of interleaved frames or 1 in planes
+static inline void bf_run(bf_handle_t inst, const int16_t *x0, const int16_t *x1, int stride, int frames, int16_t *out)
+{
+    int pos = inst->pos;
+
+    for (int n = 0; n < frames; n++) {
+        pos = (pos + 1) & (BF_HIST - 1);
+        inst->hist[0][pos] = x0[n * stride];
+        inst->hist[1][pos] = x1[n * stride];
+        int32_t y0 = bf_delayed(inst->hist[0], pos, &inst->d[0]);
+        int32_t y1 = bf_delayed(inst->hist[1], pos, &inst->d[1]);
+        int32_t b = (y0 + y1) >> 1;
+        if (inst->cfg.mode == BF_MODE_GSC) {
+            b = bf_gsc(inst, b, bf_sat16((y0 - y1) >> 1));
+        }
+        out[n] = bf_sat16(b);
+    }
+    inst->pos = pos;
+}
+
+void bf_process(bf_handle_t inst, const int16_t *pcm, int channels, int frames, int16_t *out)
+{
+    bf_run(inst, pcm + inst->cfg.mic0_channel, pcm + inst->cfg.mic1_channel, channels, frames, out);
+}
+
+void bf_process_planar(bf_handle_t inst, const int16_t *const *planes, int frames, int16_t *out)
+{
+    bf_run(inst, planes[inst->cfg.mic0_channel], planes[inst->cfg.mic1_channel], 1, frames, out);
+}
+
+void bf_destroy(bf_handle_t inst)
+{
+    free(inst);
+}
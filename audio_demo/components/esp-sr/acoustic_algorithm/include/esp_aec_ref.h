@@ -0,0 +1,94 @@
+// Copyright 2015-2019 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License
+#ifndef _ESP_AEC_REF_H_
+#define _ESP_AEC_REF_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+* Playback reference for the AEC, taken from the output pipeline instead of a loopback channel.
+* Every block written to I2S TX is kept, downmixed to mono at AEC_SAMPLE_RATE, with the time it went out.
+* For each mic frame the samples played delay earlier are handed to the AFE as its reference. The delay
+* (both DMA queues, the codec and the acoustic path) is estimated by cross-correlating the mic and the
+* reference decimated to 2kHz while something plays, and kept when nothing does.
+*/
+
+typedef struct {
+    int rate;               // tap sample rate, a multiple of AEC_SAMPLE_RATE
+    int channels;           // tap channels, averaged
+    int max_delay_ms;       // longest echo path searched
+    int delay_ms;           // used until the first estimate
+    int lead_ms;            // the reference is handed over this much early, the AEC filter is causal
+    int buffer_ms;          // reference kept, at least max_delay_ms plus a mic frame
+} aec_ref_config_t;
+
+#define AEC_REF_CONFIG_DEFAULT() { \
+    .rate = 16000, \
+    .channels = 2, \
+    .max_delay_ms = 200, \
+    .delay_ms = 40, \
+    .lead_ms = 4, \
+    .buffer_ms = 500, \
+}
+
+typedef struct aec_ref *aec_ref_handle_t;
+
+/**
+ * @brief Create the reference buffer and the delay estimator.
+ *
+ * @return
+ *         - NULL: Create failed, or rate is no multiple of AEC_SAMPLE_RATE
+ *         - Others: The instance
+ */
+aec_ref_handle_t aec_ref_create(const aec_ref_config_t *cfg);
+
+/**
+ * @brief Keep count interleaved frames the output just handed to I2S, time_us from esp_timer_get_time.
+ */
+void aec_ref_write(aec_ref_handle_t inst, const int16_t *frames, size_t count, int64_t time_us);
+
+/**
+ * @brief aec_ref_write at the current time, in the form of an audio_mixer output, ctx is the instance.
+ *        Set it as the tap of the mixer.
+ */
+esp_err_t aec_ref_tap(void *ctx, const int16_t *frames, size_t count);
+
+/**
+ * @brief Fill ref with the reference of a mic frame, e.g. afe_get_ref_buffer, and update the delay estimate.
+ *
+ * @param mic     samples mono mic samples at AEC_SAMPLE_RATE, after the beamformer if there is one
+ * @param time_us capture time of the first mic sample, the end of the I2S read less the frame length
+ */
+void aec_ref_align(aec_ref_handle_t inst, const int16_t *mic, int16_t *ref, int samples, int64_t time_us);
+
+/**
+ * @brief The delay in use, in us.
+ *
+ * @param corr normalized correlation of the last estimate taken, 0 before the first one, can be NULL
+ */
+int aec_ref_get_delay(aec_ref_handle_t inst, float *corr);
+
+void aec_ref_destroy(aec_ref_handle_t inst);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //_ESP_AEC_REF_H_
@@ -0,0 +1,118 @@
+// Copyright 2015-2019 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License
+#ifndef _ESP_AFE_H_
+#define _ESP_AFE_H_
+
+#include <stdint.h>
+#include "esp_aec.h"
+#include "esp_vad.h"
+#include "esp_beamformer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+* Audio front-end: AEC -> NS -> AGC -> VAD on one frame, in one call.
+* The frame is the least common multiple of the AEC frame (16ms) and the 10ms
+* frames of the other stages, each stage runs over it in its own sub-frames.
+* The sampling frequency must be 16000Hz, mono 16 bit.
+*/
+
+#define AFE_SAMPLE_RATE         AEC_SAMPLE_RATE
+#define AFE_FRAME_LENGTH_MS     80
+#define AFE_FRAME_SAMPLES       (AFE_FRAME_LENGTH_MS * AFE_SAMPLE_RATE / 1000)
+#define AFE_NS_FRAME_LENGTH_MS  20
+#define AFE_AGC_FRAME_LENGTH_MS 10
+#define AFE_VAD_FRAME_LENGTH_MS 20
+
+typedef struct {
+    int aec_enable;
+    int ns_enable;
+    int agc_enable;
+    int vad_enable;
+    int agc_mode;           // see esp_agc_open
+    int agc_gain_db;
+    int agc_limiter_enable;
+    int agc_target_level_dbfs;
+    vad_mode_t vad_mode;
+} afe_config_t;
+
+#define AFE_CONFIG_DEFAULT() { \
+    .aec_enable = 1, \
+    .ns_enable = 1, \
+    .agc_enable = 1, \
+    .vad_enable = 1, \
+    .agc_mode = 3, \
+    .agc_gain_db = 15, \
+    .agc_limiter_enable = 1, \
+    .agc_target_level_dbfs = -3, \
+    .vad_mode = VAD_MODE_4, \
+}
+
+typedef struct afe_engine *afe_handle_t;
+
+/**
+ * @brief Creates the engine, every stage instance and all the frame buffers are allocated here, once.
+ *
+ * @return
+ *         - NULL: Create failed
+ *         - Others: The instance of the AFE
+ */
+afe_handle_t afe_create(const afe_config_t *cfg);
+
+/**
+ * @brief The buffers of the next frame, AFE_FRAME_SAMPLES samples each.
+ *        Read the microphone and the playback reference straight into them, then call afe_process.
+ */
+int16_t *afe_get_mic_buffer(afe_handle_t inst);
+int16_t *afe_get_ref_buffer(afe_handle_t inst);
+
+/**
+ * @brief Fill the mic and reference buffers from AFE_FRAME_SAMPLES interleaved frames,
+ *        e.g. an I2S read with the codec loopback of the playback on ref_channel.
+ */
+void afe_feed_interleaved(afe_handle_t inst, const int16_t *pcm, int channels, int mic_channel, int ref_channel);
+
+/**
+ * @brief Like afe_feed_interleaved, with the two mics of the beamformer summed into the mic buffer.
+ *
+ * @param ref_channel The playback reference, -1 to leave the reference buffer alone
+ */
+void afe_feed_beamformed(afe_handle_t inst, bf_handle_t bf, const int16_t *pcm, int channels, int ref_channel);
+
+/**
+ * @brief Fill the mic and reference buffers from one plane of AFE_FRAME_SAMPLES per channel, e.g. MediaHalTdmRead.
+ *
+ * @param bf          The beamformer of the mic pair, NULL to take the mic_channel plane as is
+ * @param ref_channel The playback reference, -1 to leave the reference buffer alone
+ */
+void afe_feed_planar(afe_handle_t inst, bf_handle_t bf, const int16_t *const *planes, int mic_channel, int ref_channel);
+
+/**
+ * @brief Run the enabled stages over the frame in the mic and reference buffers.
+ *
+ * @param vad_state VAD_SPEECH when any sub-frame holds speech, can be NULL
+ *
+ * @return The processed frame, AFE_FRAME_SAMPLES samples, valid until the next afe_process
+ */
+int16_t *afe_process(afe_handle_t inst, vad_state_t *vad_state);
+
+void afe_destroy(afe_handle_t inst);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //_ESP_AFE_H_
@@ -0,0 +1,94 @@
+// Copyright 2015-2019 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License
+#ifndef _ESP_BEAMFORMER_H_
+#define _ESP_BEAMFORMER_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+* Two microphone beamformer, interleaved 16 bit frames in, one mono channel out, in one pass.
+* The mic that hears the talker first is delayed by a fractional delay (4 tap Lagrange, Q14),
+* the aligned pair is summed. In BF_MODE_GSC the difference of the pair, which holds little of the
+* talker, also feeds a short NLMS filter that takes the remaining noise out of the sum. It adapts only
+* while the sum is not clearly louder than the difference, so the talker itself is not cancelled.
+* Run it on the mic frames before the AFE, at AFE_SAMPLE_RATE, e.g. with afe_feed_beamformed.
+*/
+
+#define BF_SPEED_OF_SOUND_MMPS  343000
+#define BF_MAX_DELAY            8       // samples, 170mm at 16kHz end-fire
+#define BF_GSC_TAPS             16      // the sum is delayed by half of it
+
+typedef enum {
+    BF_MODE_DAS = 0,        // delay and sum
+    BF_MODE_GSC,            // delay and sum, then the adaptive noise canceller
+} bf_mode_t;
+
+typedef struct {
+    int sample_rate;
+    int mic_distance_mm;
+    int steer_deg;          // 0: broadside, 90: end-fire towards mic0, -90: towards mic1
+    int mic0_channel;       // channel of each mic in the interleaved frame, or its plane
+    int mic1_channel;
+    bf_mode_t mode;
+    int step_q15;           // NLMS step size, Q15
+} bf_config_t;
+
+#define BF_CONFIG_DEFAULT() { \
+    .sample_rate = 16000, \
+    .mic_distance_mm = 65, \
+    .steer_deg = 0, \
+    .mic0_channel = 0, \
+    .mic1_channel = 1, \
+    .mode = BF_MODE_GSC, \
+    .step_q15 = 3277, \
+}
+
+typedef struct bf_engine *bf_handle_t;
+
+/**
+ * @brief Create a beamformer.
+ *
+ * @return
+ *         - NULL: Create failed, or the mics are too far apart for BF_MAX_DELAY
+ *         - Others: The instance
+ */
+bf_handle_t bf_create(const bf_config_t *cfg);
+
+/**
+ * @brief Point the beam to another angle, the adaptive filter starts over.
+ */
+int bf_set_steering(bf_handle_t inst, int steer_deg);
+
+/**
+ * @brief Beamform a run of interleaved frames, channels samples each, into frames mono samples.
+ */
+void bf_process(bf_handle_t inst, const int16_t *pcm, int channels, int frames, int16_t *out);
+
+/**
+ * @brief Beamform frames samples of one plane per channel, e.g. from MediaHalTdmRead, mic0_channel and
+ *        mic1_channel index the planes.
+ */
+void bf_process_planar(bf_handle_t inst, const int16_t *const *planes, int frames, int16_t *out);
+
+void bf_destroy(bf_handle_t inst);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //_ESP_BEAMFORMER_H_
@@ -3,7 +3,9 @@ COMPONENT_ADD_INCLUDEDIRS := lib/include \
 	                         speech_command_recognition/include \
 							 acoustic_algorithm/include \
 
-COMPONENT_SRCDIRS := speech_command_recognition 
+COMPONENT_SRCDIRS := lib \
+                     speech_command_recognition \
+                     acoustic_algorithm
 	                 
 
 LIB_FILES := $(shell ls $(COMPONENT_PATH)/wake_word_engine/lib*.a) \
@@ -19,3 +21,14 @@ COMPONENT_ADD_LDFLAGS +=  -L$(COMPONENT_PATH)/lib \
                           -L$(COMPONENT_PATH)/acoustic_algorithm \
 						  $(LIBS)
 
+ifdef CONFIG_SR_DL_ARENA
+COMPONENT_ADD_LDFLAGS += -Wl,--wrap=malloc -Wl,--wrap=calloc -Wl,--wrap=free
+endif
+
+ifdef CONFIG_SR_DL_FUSED_DILATION
+COMPONENT_ADD_LDFLAGS += -Wl,--wrap=dl_dilation_layer
+endif
+
+ifdef CONFIG_SR_DL_FUSED_LSTM
+COMPONENT_ADD_LDFLAGS += -Wl,--wrap=dl_basic_lstm_layer1
+endif
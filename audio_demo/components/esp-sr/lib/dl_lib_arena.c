@@ -0,0 +1,216 @@
+// Copyright 2015-2019 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_heap_caps.h"
+#include "dl_lib_arena.h"
+
+#define DL_ARENA_ALIGN  16      //the widest alignment the matrix code asks malloc for
+#define DL_ARENA_MAX    4       //arenas alive at the same time
+
+struct dl_arena {
+    uint8_t *base;
+    size_t size;
+    size_t top;
+    size_t high_water;
+    int live;               //arena allocations not freed yet, under s_live_lock
+    int overflows;
+    TaskHandle_t task;
+};
+
+#if CONFIG_SR_DL_ARENA
+
+//The arena in use and its task, read on every malloc of the system, so kept to two words
+static dl_arena_t *s_arena;
+static TaskHandle_t s_task;
+//Every arena, free() has to recognise what a model holds on to after its step
+static dl_arena_t *s_arenas[DL_ARENA_MAX];
+//live is counted up by the bound task and down by any task, on either core
+static portMUX_TYPE s_live_lock = portMUX_INITIALIZER_UNLOCKED;
+
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t n, size_t size);
+void __real_free(void *ptr);
+
+static inline dl_arena_t *dl_arena_current(void)
+{
+    if (s_arena == NULL || xPortInIsrContext() || xTaskGetCurrentTaskHandle() != s_task) {
+        return NULL;
+    }
+    return s_arena;
+}
+
+static void *dl_arena_alloc(dl_arena_t *arena, size_t size)
+{
+    size_t top = (arena->top + DL_ARENA_ALIGN - 1) & ~(DL_ARENA_ALIGN - 1);
+    if (size > arena->size || top > arena->size - size) {
+        arena->overflows++;
+        return NULL;
+    }
+    arena->top = top + size;
+    portENTER_CRITICAL_SAFE(&s_live_lock);
+    arena->live++;
+    portEXIT_CRITICAL_SAFE(&s_live_lock);
+    if (arena->top > arena->high_water) {
+        arena->high_water = arena->top;
+    }
+    return arena->base + top;
+}
+
+void *__wrap_malloc(size_t size)
+{
+    dl_arena_t *arena = dl_arena_current();
+    void *p = arena ? dl_arena_alloc(arena, size) : NULL;
+    return p ? p : __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t n, size_t size)
+{
+    dl_arena_t *arena = dl_arena_current();
+    if (arena && (size == 0 || n <= SIZE_MAX / size)) {
+        void *p = dl_arena_alloc(arena, n * size);
+        if (p) {
+            memset(p, 0, n * size);
+            return p;
+        }
+    }
+    return __real_calloc(n, size);
+}
+
+void __wrap_free(void *ptr)
+{
+    //an arena pointer may be freed after its step, by any task
+    for (int i = 0; i < DL_ARENA_MAX; i++) {
+        dl_arena_t *arena = s_arenas[i];
+        if (arena && (uint8_t *)ptr >= arena->base && (uint8_t *)ptr < arena->base + arena->size) {
+            portENTER_CRITICAL_SAFE(&s_live_lock);
+            arena->live--;
+            portEXIT_CRITICAL_SAFE(&s_live_lock);
+            return;
+        }
+    }
+    __real_free(ptr);
+}
+
+dl_arena_t *dl_arena_create(size_t size, int caps)
+{
+    dl_arena_t *arena = calloc(1, sizeof(dl_arena_t));
+    if (arena == NULL) {
+        return NULL;
+    }
+    arena->base = heap_caps_malloc(size, caps);
+    if (arena->base == NULL) {
+        free(arena);
+        return NULL;
+    }
+    arena->size = size;
+    for (int i = 0; i < DL_ARENA_MAX; i++) {
+        if (s_arenas[i] == NULL) {
+            s_arenas[i] = arena;
+            return arena;
+        }
+    }
+    heap_caps_free(arena->base);
+    free(arena);
+    return NULL;
+}
+
+void dl_arena_destroy(dl_arena_t *arena)
+{
+    if (arena == NULL) {
+        return;
+    }
+    for (int i = 0; i < DL_ARENA_MAX; i++) {
+        if (s_arenas[i] == arena) {
+            s_arenas[i] = NULL;
+        }
+    }
+    if (s_arena == arena) {
+        s_arena = NULL;
+    }
+    heap_caps_free(arena->base);
+    free(arena);
+}
+
+void dl_arena_begin(dl_arena_t *arena)
+{
+    if (arena == NULL) {
+        return;
+    }
+    s_task = xTaskGetCurrentTaskHandle();
+    s_arena = arena;
+}
+
+void dl_arena_end(dl_arena_t *arena)
+{
+    if (arena == NULL) {
+        return;
+    }
+    s_arena = NULL;
+    s_task = NULL;
+    dl_arena_next(arena);
+}
+
+void dl_arena_next(dl_arena_t *arena)
+{
+    if (arena == NULL) {
+        return;
+    }
+    //only the bound task allocates, so once live reads 0 nothing in the arena is held
+    portENTER_CRITICAL_SAFE(&s_live_lock);
+    if (arena->live == 0) {
+        arena->top = 0;
+    }
+    portEXIT_CRITICAL_SAFE(&s_live_lock);
+}
+
+#else
+
+dl_arena_t *dl_arena_create(size_t size, int caps)
+{
+    return calloc(1, sizeof(dl_arena_t));
+}
+
+void dl_arena_destroy(dl_arena_t *arena)
+{
+    free(arena);
+}
+
+void dl_arena_begin(dl_arena_t *arena)
+{
+}
+
+void dl_arena_end(dl_arena_t *arena)
+{
+}
+
+void dl_arena_next(dl_arena_t *arena)
+{
+}
+
+#endif
+
+size_t dl_arena_high_water(const dl_arena_t *arena)
+{
+    return arena ? arena->high_water : 0;
+}
+
+int dl_arena_overflows(const dl_arena_t *arena)
+{
+    return arena ? arena->overflows : 0;
+}
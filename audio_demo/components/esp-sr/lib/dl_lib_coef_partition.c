@@ -0,0 +1,615 @@
+// Copyright 2015-2019 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <stdlib.h>
+#include <string.h>
+#include "sdkconfig.h"
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "esp_partition.h"
+#include "esp_spi_flash.h"
+#include "dl_lib_coef_partition.h"
+
+static const char *TAG = "DL_COEF";
+
+/*
+Image layout, little-endian:
+    header, the index of DL_COEF_INDEX_SIZE bytes at most
+    the matrix items, each entry on a 16 byte boundary
+    model info: dl_coef_info_t, word_num win/thresh pairs, then info_str and the words, NUL terminated
+    alphabet: item_num, then the items, NUL terminated
+The header is written last, an interrupted recording leaves no magic behind.
+*/
+#define DL_COEF_MAGIC           0x46434c44      //"DLCF"
+#define DL_COEF_VERSION         2
+#define DL_COEF_NAME_LEN        40
+#define DL_COEF_INDEX_SIZE      0x8000
+#define DL_COEF_ALIGN           16
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t count;
+    uint32_t info_offset;       //0 when the getter has no model info
+    uint32_t alphabet_offset;   //0 when the getter has no alphabet
+    char tag[DL_COEF_TAG_LEN];  //what the image holds, NUL terminated, may be empty
+} dl_coef_header_t;
+
+typedef struct {
+    char name[DL_COEF_NAME_LEN];
+    int32_t hint;
+    int32_t quantized;
+    int32_t w;
+    int32_t h;
+    int32_t stride;
+    int32_t exponent;
+    uint32_t offset;
+    uint32_t size;
+} dl_coef_entry_t;
+
+typedef struct {
+    int32_t win;
+    float thresh;
+} dl_coef_word_t;
+
+#define DL_COEF_MAX_ENTRIES     ((DL_COEF_INDEX_SIZE - sizeof(dl_coef_header_t)) / sizeof(dl_coef_entry_t))
+
+typedef struct {
+    const esp_partition_t *part;
+    spi_flash_mmap_handle_t mmap;
+    const uint8_t *base;
+    const dl_coef_header_t *header;
+    const dl_coef_entry_t *entry;
+    void **matrix;              //dl_matrix2d_t or dl_matrix2dq_t per entry, built on first use
+    model_info_t *info;
+    alphabet_t *alphabet;
+} dl_coef_slot_t;
+
+static dl_coef_slot_t s_slot[DL_COEF_PARTITION_MAX];
+
+static const dl_coef_entry_t *dl_coef_find(dl_coef_slot_t *slot, const char *name, int hint, int quantized, int *index)
+{
+    for (int i = 0; i < slot->header->count; i++) {
+        const dl_coef_entry_t *e = &slot->entry[i];
+        if (e->hint == hint && e->quantized == quantized && strncmp(e->name, name, DL_COEF_NAME_LEN) == 0) {
+            *index = i;
+            return e;
+        }
+    }
+    ESP_LOGE(TAG, "%s: no matrix %s", slot->part->label, name);
+    return NULL;
+}
+
+static const dl_matrix2d_t *dl_coef_slot_getter_f(dl_coef_slot_t *slot, const char *name, int hint)
+{
+    int i;
+    const dl_coef_entry_t *e = dl_coef_find(slot, name, hint, 0, &i);
+    if (e == NULL) {
+        return NULL;
+    }
+    if (slot->matrix[i] == NULL) {
+        dl_matrix2d_t *m = calloc(1, sizeof(dl_matrix2d_t));
+        if (m == NULL) {
+            return NULL;
+        }
+        m->w = e->w;
+        m->h = e->h;
+        m->stride = e->stride;
+        m->flags = DL_MF_FOREIGNDATA;
+        m->item = (fptp_t *)(slot->base + e->offset);
+        slot->matrix[i] = m;
+    }
+    return slot->matrix[i];
+}
+
+static const dl_matrix2dq_t *dl_coef_slot_getter_q(dl_coef_slot_t *slot, const char *name, int hint)
+{
+    int i;
+    const dl_coef_entry_t *e = dl_coef_find(slot, name, hint, 1, &i);
+    if (e == NULL) {
+        return NULL;
+    }
+    if (slot->matrix[i] == NULL) {
+        dl_matrix2dq_t *m = calloc(1, sizeof(dl_matrix2dq_t));
+        if (m == NULL) {
+            return NULL;
+        }
+        m->w = e->w;
+        m->h = e->h;
+        m->stride = e->stride;
+        m->flags = DL_MF_FOREIGNDATA;
+        m->exponent = e->exponent;
+        m->itemq = (qtp_t *)(slot->base + e->offset);
+        slot->matrix[i] = m;
+    }
+    return slot->matrix[i];
+}
+
+//The headers live as long as the mapping, the model may ask for a matrix again
+static void dl_coef_slot_free_f(const dl_matrix2d_t *m)
+{
+}
+
+static void dl_coef_slot_free_q(const dl_matrix2dq_t *m)
+{
+}
+
+//The getter interface has no context of its own, so every slot gets its own set of entry points
+#define DL_COEF_SLOT_GETTER(n) \
+static const dl_matrix2d_t *dl_coef_getter_f##n(const char *name, void *arg, int hint) \
+{ \
+    return dl_coef_slot_getter_f(&s_slot[n], name, hint); \
+} \
+static const dl_matrix2dq_t *dl_coef_getter_q##n(const char *name, void *arg, int hint) \
+{ \
+    return dl_coef_slot_getter_q(&s_slot[n], name, hint); \
+} \
+static const model_info_t *dl_coef_getter_info##n(void *arg) \
+{ \
+    return s_slot[n].info; \
+} \
+static const alphabet_t *dl_coef_getter_alphabet##n(void *arg) \
+{ \
+    return s_slot[n].alphabet; \
+}
+
+DL_COEF_SLOT_GETTER(0)
+DL_COEF_SLOT_GETTER(1)
+
+static const model_coeff_getter_t s_slot_getter[DL_COEF_PARTITION_MAX] = {
+    {dl_coef_getter_f0, dl_coef_getter_q0, dl_coef_slot_free_f, dl_coef_slot_free_q, dl_coef_getter_info0, dl_coef_getter_alphabet0},
+    {dl_coef_getter_f1, dl_coef_getter_q1, dl_coef_slot_free_f, dl_coef_slot_free_q, dl_coef_getter_info1, dl_coef_getter_alphabet1},
+};
+
+//Strings point into the mapping, only the arrays of pointers and numbers are in RAM
+static const char *dl_coef_next_str(const char **p, const char *end)
+{
+    const char *s = *p;
+    size_t len = strnlen(s, end - s);
+    if (len == end - s) {
+        return NULL;
+    }
+    *p = s + len + 1;
+    return s;
+}
+
+static int dl_coef_load_info(dl_coef_slot_t *slot)
+{
+    const char *end = (const char *)slot->base + slot->part->size;
+    const char *p = (const char *)slot->base + slot->header->info_offset;
+    uint32_t word_num;
+
+    memcpy(&word_num, p, sizeof(word_num));
+    const dl_coef_word_t *word = (const dl_coef_word_t *)(p + sizeof(word_num));
+    p = (const char *)(word + word_num);
+    if (p > end) {
+        return -1;
+    }
+    model_info_t *info = calloc(1, sizeof(model_info_t));
+    if (info == NULL) {
+        return -1;
+    }
+    slot->info = info;
+    info->word_num = word_num;
+    info->word_list = calloc(word_num + 1, sizeof(char *));
+    info->win_list = calloc(word_num + 1, sizeof(int));
+    info->thresh_list = calloc(word_num + 1, sizeof(float));
+    if (info->word_list == NULL || info->win_list == NULL || info->thresh_list == NULL) {
+        return -1;
+    }
+    info->info_str = (char *)dl_coef_next_str(&p, end);
+    for (int i = 0; i < word_num; i++) {
+        info->word_list[i] = (char *)dl_coef_next_str(&p, end);
+        info->win_list[i] = word[i].win;
+        info->thresh_list[i] = word[i].thresh;
+        if (info->word_list[i] == NULL) {
+            return -1;
+        }
+    }
+    return info->info_str ? 0 : -1;
+}
+
+static int dl_coef_load_alphabet(dl_coef_slot_t *slot)
+{
+    const char *end = (const char *)slot->base + slot->part->size;
+    const char *p = (const char *)slot->base + slot->header->alphabet_offset;
+    uint32_t item_num;
+
+    memcpy(&item_num, p, sizeof(item_num));
+    p += sizeof(item_num);
+    alphabet_t *alphabet = calloc(1, sizeof(alphabet_t));
+    if (alphabet == NULL) {
+        return -1;
+    }
+    slot->alphabet = alphabet;
+    alphabet->item_num = item_num;
+    alphabet->items = calloc(item_num + 1, sizeof(char *));
+    if (alphabet->items == NULL) {
+        return -1;
+    }
+    for (int i = 0; i < item_num; i++) {
+        alphabet->items[i] = (char *)dl_coef_next_str(&p, end);
+        if (alphabet->items[i] == NULL) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static void dl_coef_slot_release(dl_coef_slot_t *slot)
+{
+    if (slot->matrix) {
+        for (int i = 0; i < slot->header->count; i++) {
+            free(slot->matrix[i]);
+        }
+        free(slot->matrix);
+    }
+    if (slot->info) {
+        free(slot->info->word_list);
+        free(slot->info->win_list);
+        free(slot->info->thresh_list);
+        free(slot->info);
+    }
+    if (slot->alphabet) {
+        free(slot->alphabet->items);
+        free(slot->alphabet);
+    }
+    if (slot->base) {
+        spi_flash_munmap(slot->mmap);
+    }
+    memset(slot, 0, sizeof(dl_coef_slot_t));
+}
+
+const model_coeff_getter_t *dl_coef_partition_getter(const char *label)
+{
+    const esp_partition_t *part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label);
+    dl_coef_slot_t *slot = NULL;
+
+    if (part == NULL) {
+        ESP_LOGE(TAG, "partition %s not found", label);
+        return NULL;
+    }
+    for (int i = 0; i < DL_COEF_PARTITION_MAX; i++) {
+        if (s_slot[i].part == part) {
+            return &s_slot_getter[i];
+        }
+        if (slot == NULL && s_slot[i].part == NULL) {
+            slot = &s_slot[i];
+        }
+    }
+    if (slot == NULL) {
+        ESP_LOGE(TAG, "already %d coefficient partitions in use", DL_COEF_PARTITION_MAX);
+        return NULL;
+    }
+    if (esp_partition_mmap(part, 0, part->size, SPI_FLASH_MMAP_DATA, (const void **)&slot->base, &slot->mmap) != ESP_OK) {
+        ESP_LOGE(TAG, "partition %s mmap error", label);
+        slot->base = NULL;
+        return NULL;
+    }
+    slot->part = part;
+    slot->header = (const dl_coef_header_t *)slot->base;
+    slot->entry = (const dl_coef_entry_t *)(slot->header + 1);
+    if (slot->header->magic != DL_COEF_MAGIC || slot->header->version != DL_COEF_VERSION
+            || slot->header->count > DL_COEF_MAX_ENTRIES || strnlen(slot->header->tag, DL_COEF_TAG_LEN) == DL_COEF_TAG_LEN) {
+        ESP_LOGW(TAG, "partition %s holds no coefficients", label);
+        goto err;
+    }
+    for (int i = 0; i < slot->header->count; i++) {
+        const dl_coef_entry_t *e = &slot->entry[i];
+        if (e->offset > part->size || e->size > part->size - e->offset) {
+            ESP_LOGE(TAG, "%s: matrix %d out of the partition", label, i);
+            goto err;
+        }
+    }
+    slot->matrix = calloc(slot->header->count, sizeof(void *));
+    if (slot->matrix == NULL
+            || (slot->header->info_offset && dl_coef_load_info(slot) != 0)
+            || (slot->header->alphabet_offset && dl_coef_load_alphabet(slot) != 0)) {
+        ESP_LOGE(TAG, "%s: broken model info", label);
+        goto err;
+    }
+    ESP_LOGI(TAG, "%s: %d matrices mapped", label, slot->header->count);
+    return &s_slot_getter[slot - s_slot];
+
+err:
+    dl_coef_slot_release(slot);
+    return NULL;
+}
+
+/*
+Recording
+*/
+typedef struct {
+    const esp_partition_t *part;
+    const model_coeff_getter_t *src;
+    dl_coef_entry_t *entry;
+    uint32_t count;
+    uint32_t pos;
+    void *info_arg;
+    void *alphabet_arg;
+    int info_asked;
+    int alphabet_asked;
+    char tag[DL_COEF_TAG_LEN];
+    esp_err_t err;
+} dl_coef_recorder_t;
+
+static dl_coef_recorder_t *s_rec;
+
+static esp_err_t dl_coef_rec_write(const void *data, uint32_t size)
+{
+    esp_err_t err = ESP_ERR_INVALID_SIZE;
+    if (size <= s_rec->part->size - s_rec->pos) {
+        err = esp_partition_write(s_rec->part, s_rec->pos, data, size);
+    }
+    if (err == ESP_OK) {
+        s_rec->pos += size;
+    } else if (s_rec->err == ESP_OK) {
+        ESP_LOGE(TAG, "%s: write at 0x%x failed, %d", s_rec->part->label, s_rec->pos, err);
+        s_rec->err = err;
+    }
+    return err;
+}
+
+static void dl_coef_rec_matrix(const char *name, int hint, int quantized, int w, int h, int stride, int exponent,
+                               const void *items, uint32_t size)
+{
+    if (s_rec->err != ESP_OK) {
+        return;
+    }
+    for (int i = 0; i < s_rec->count; i++) {
+        dl_coef_entry_t *e = &s_rec->entry[i];
+        if (e->hint == hint && e->quantized == quantized && strncmp(e->name, name, DL_COEF_NAME_LEN) == 0) {
+            return;
+        }
+    }
+    if (s_rec->count == DL_COEF_MAX_ENTRIES || strlen(name) >= DL_COEF_NAME_LEN) {
+        ESP_LOGE(TAG, "can not index matrix %s", name);
+        s_rec->err = ESP_ERR_NO_MEM;
+        return;
+    }
+    s_rec->pos = (s_rec->pos + DL_COEF_ALIGN - 1) & ~(DL_COEF_ALIGN - 1);
+    dl_coef_entry_t *e = &s_rec->entry[s_rec->count];
+    memset(e, 0, sizeof(dl_coef_entry_t));
+    strcpy(e->name, name);
+    e->hint = hint;
+    e->quantized = quantized;
+    e->w = w;
+    e->h = h;
+    e->stride = stride;
+    e->exponent = exponent;
+    e->offset = s_rec->pos;
+    e->size = size;
+    if (dl_coef_rec_write(items, size) == ESP_OK) {
+        s_rec->count++;
+    }
+}
+
+static const dl_matrix2d_t *dl_coef_rec_getter_f(const char *name, void *arg, int hint)
+{
+    const dl_matrix2d_t *m = s_rec->src->getter_f(name, arg, hint);
+    if (m) {
+        //DL_ITM(m, x, y) is item[x + y * stride]
+        dl_coef_rec_matrix(name, hint, 0, m->w, m->h, m->stride, 0, m->item, m->stride * m->h * sizeof(fptp_t));
+    }
+    return m;
+}
+
+static const dl_matrix2dq_t *dl_coef_rec_getter_q(const char *name, void *arg, int hint)
+{
+    const dl_matrix2dq_t *m = s_rec->src->getter_q(name, arg, hint);
+    if (m) {
+        //DL_ITMQ(m, x, y) is itemq[y + x * stride]
+        dl_coef_rec_matrix(name, hint, 1, m->w, m->h, m->stride, m->exponent, m->itemq, m->stride * m->w * sizeof(qtp_t));
+    }
+    return m;
+}
+
+static void dl_coef_rec_free_f(const dl_matrix2d_t *m)
+{
+    if (s_rec->src->free_f) {
+        s_rec->src->free_f(m);
+    }
+}
+
+static void dl_coef_rec_free_q(const dl_matrix2dq_t *m)
+{
+    if (s_rec->src->free_q) {
+        s_rec->src->free_q(m);
+    }
+}
+
+//The info and the alphabet are written at the end, remember how the model asked for them
+static const model_info_t *dl_coef_rec_getter_info(void *arg)
+{
+    s_rec->info_asked = 1;
+    s_rec->info_arg = arg;
+    return s_rec->src->getter_info ? s_rec->src->getter_info(arg) : NULL;
+}
+
+static const alphabet_t *dl_coef_rec_getter_alphabet(void *arg)
+{
+    s_rec->alphabet_asked = 1;
+    s_rec->alphabet_arg = arg;
+    return s_rec->src->getter_alphabet ? s_rec->src->getter_alphabet(arg) : NULL;
+}
+
+static const model_coeff_getter_t s_rec_getter = {
+    dl_coef_rec_getter_f,
+    dl_coef_rec_getter_q,
+    dl_coef_rec_free_f,
+    dl_coef_rec_free_q,
+    dl_coef_rec_getter_info,
+    dl_coef_rec_getter_alphabet,
+};
+
+esp_err_t dl_coef_partition_record_begin(const char *label, const model_coeff_getter_t *src, const model_coeff_getter_t **recorder)
+{
+    const esp_partition_t *part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label);
+    esp_err_t err;
+
+    if (part == NULL) {
+        ESP_LOGE(TAG, "partition %s not found", label);
+        return ESP_ERR_NOT_FOUND;
+    }
+    if (s_rec) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    for (int i = 0; i < DL_COEF_PARTITION_MAX; i++) {
+        if (s_slot[i].part == part) {
+            return ESP_ERR_INVALID_STATE;   //mapped, the model may still read it
+        }
+    }
+    s_rec = calloc(1, sizeof(dl_coef_recorder_t));
+    if (s_rec == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    s_rec->entry = heap_caps_malloc(DL_COEF_MAX_ENTRIES * sizeof(dl_coef_entry_t), MALLOC_CAP_8BIT);
+    if (s_rec->entry == NULL) {
+        free(s_rec);
+        s_rec = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+    err = esp_partition_erase_range(part, 0, part->size);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "partition %s erase error", label);
+        free(s_rec->entry);
+        free(s_rec);
+        s_rec = NULL;
+        return err;
+    }
+    s_rec->part = part;
+    s_rec->src = src;
+    s_rec->pos = DL_COEF_INDEX_SIZE;
+    *recorder = &s_rec_getter;
+    return ESP_OK;
+}
+
+esp_err_t dl_coef_partition_record_tag(const char *tag)
+{
+    if (s_rec == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (strlen(tag) >= DL_COEF_TAG_LEN) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    strcpy(s_rec->tag, tag);
+    return ESP_OK;
+}
+
+static uint32_t dl_coef_rec_info(void)
+{
+    const model_info_t *info = s_rec->info_asked && s_rec->src->getter_info ? s_rec->src->getter_info(s_rec->info_arg) : NULL;
+    if (info == NULL) {
+        return 0;
+    }
+    uint32_t offset = s_rec->pos;
+    uint32_t word_num = info->word_num;
+    dl_coef_rec_write(&word_num, sizeof(word_num));
+    for (int i = 0; i < info->word_num; i++) {
+        dl_coef_word_t word = {info->win_list ? info->win_list[i] : 0, info->thresh_list ? info->thresh_list[i] : 0};
+        dl_coef_rec_write(&word, sizeof(word));
+    }
+    const char *str = info->info_str ? info->info_str : "";
+    dl_coef_rec_write(str, strlen(str) + 1);
+    for (int i = 0; i < info->word_num; i++) {
+        dl_coef_rec_write(info->word_list[i], strlen(info->word_list[i]) + 1);
+    }
+    return offset;
+}
+
+static uint32_t dl_coef_rec_alphabet(void)
+{
+    const alphabet_t *alphabet = s_rec->alphabet_asked && s_rec->src->getter_alphabet ? s_rec->src->getter_alphabet(s_rec->alphabet_arg) : NULL;
+    if (alphabet == NULL) {
+        return 0;
+    }
+    uint32_t offset = s_rec->pos;
+    uint32_t item_num = alphabet->item_num;
+    dl_coef_rec_write(&item_num, sizeof(item_num));
+    for (int i = 0; i < alphabet->item_num; i++) {
+        dl_coef_rec_write(alphabet->items[i], strlen(alphabet->items[i]) + 1);
+    }
+    return offset;
+}
+
+esp_err_t dl_coef_partition_record_end(void)
+{
+    if (s_rec == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    s_rec->pos = (s_rec->pos + 3) & ~3;
+    dl_coef_header_t header = {
+        .magic = DL_COEF_MAGIC,
+        .version = DL_COEF_VERSION,
+        .count = s_rec->count,
+        .info_offset = dl_coef_rec_info(),
+    };
+    memcpy(header.tag, s_rec->tag, DL_COEF_TAG_LEN);
+    s_rec->pos = (s_rec->pos + 3) & ~3;
+    header.alphabet_offset = dl_coef_rec_alphabet();
+
+    esp_err_t err = s_rec->err;
+    if (err == ESP_OK) {
+        err = esp_partition_write(s_rec->part, sizeof(header), s_rec->entry, s_rec->count * sizeof(dl_coef_entry_t));
+    }
+    if (err == ESP_OK) {
+        err = esp_partition_write(s_rec->part, 0, &header, sizeof(header));
+    }
+    if (err == ESP_OK) {
+        ESP_LOGI(TAG, "%s: %d matrices, %d bytes recorded", s_rec->part->label, s_rec->count, s_rec->pos);
+    } else {
+        ESP_LOGE(TAG, "%s: recording failed, %d", s_rec->part->label, err);
+    }
+    free(s_rec->entry);
+    free(s_rec);
+    s_rec = NULL;
+    return err;
+}
+
+esp_err_t dl_coef_partition_read_tag(const char *label, char *tag, size_t len)
+{
+    const esp_partition_t *part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label);
+    dl_coef_header_t header;
+
+    if (part == NULL) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    //the header alone, the partition is not mapped and takes no slot
+    esp_err_t err = esp_partition_read(part, 0, &header, sizeof(header));
+    if (err != ESP_OK) {
+        return err;
+    }
+    if (header.magic != DL_COEF_MAGIC || header.version != DL_COEF_VERSION
+            || strnlen(header.tag, DL_COEF_TAG_LEN) == DL_COEF_TAG_LEN) {
+        return ESP_ERR_INVALID_VERSION;
+    }
+    if (strlen(header.tag) >= len) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    strcpy(tag, header.tag);
+    return ESP_OK;
+}
+
+void dl_coef_placement_begin(size_t internal_limit)
+{
+#if CONFIG_SPIRAM_USE_MALLOC
+    heap_caps_malloc_extmem_enable(internal_limit);
+#endif
+}
+
+void dl_coef_placement_end(void)
+{
+#if CONFIG_SPIRAM_USE_MALLOC
+    heap_caps_malloc_extmem_enable(CONFIG_SPIRAM_MALLOC_ALWAYSINTERNAL);
+#endif
+}
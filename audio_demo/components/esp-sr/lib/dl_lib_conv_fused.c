@@ -0,0 +1,159 @@
+// Copyright 2015-2019 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <math.h>
+#include <string.h>
+#include "sdkconfig.h"
+#include "esp_log.h"
+#include "dl_lib.h"
+#include "dl_lib_conv_fused.h"
+
+static const char *TAG = "DL_FUSED";
+
+#define DL_FUSED_TOLERANCE  1e-4f       //relative, the sums are taken in another order
+
+/*
+Tap j of the window, 0 the oldest: the front slot of a queue is the oldest element, the newest
+is the slot before it.
+*/
+static inline const fptp_t *dl_fused_tap(const dl_conv_queue_t *in, int rate, int size, int j)
+{
+    int pos = (in->front - 1 - (size - 1 - j) * rate) % in->n;
+    if (pos < 0) {
+        pos += in->n;
+    }
+    return in->item + pos * in->c;
+}
+
+fptp_t *dl_dilation_layer_fused(dl_conv_queue_t *in, dl_conv_queue_t *out, int rate, int size,
+                                dl_matrix2d_t *filter_kernel, dl_matrix2d_t *filter_bias,
+                                dl_matrix2d_t *gate_kernel, dl_matrix2d_t *gate_bias)
+{
+    fptp_t gate[DL_FUSED_MAX_CHANNELS];
+    int channels = out->c;
+
+    if (channels > DL_FUSED_MAX_CHANNELS) {
+        return NULL;
+    }
+    fptp_t *filter = dl_conv_queue_pop(out);
+    if (filter_bias) {
+        memcpy(filter, filter_bias->item, channels * sizeof(fptp_t));
+    } else {
+        memset(filter, 0, channels * sizeof(fptp_t));
+    }
+    if (gate_bias) {
+        memcpy(gate, gate_bias->item, channels * sizeof(fptp_t));
+    } else {
+        memset(gate, 0, channels * sizeof(fptp_t));
+    }
+
+    //kernel row j*c+i belongs to input channel i of tap j, each row is read once, in order
+    for (int j = 0; j < size; j++) {
+        const fptp_t *x = dl_fused_tap(in, rate, size, j);
+        for (int i = 0; i < in->c; i++) {
+            int row = j * in->c + i;
+            const fptp_t *fk = filter_kernel->item + row * filter_kernel->stride;
+            const fptp_t *gk = gate_kernel->item + row * gate_kernel->stride;
+            fptp_t v = x[i];
+            for (int o = 0; o < channels; o++) {
+                filter[o] += v * fk[o];
+                gate[o] += v * gk[o];
+            }
+        }
+    }
+
+    for (int o = 0; o < channels; o++) {
+        filter[o] = dl_tanh_op(filter[o]) * dl_sigmoid_op(gate[o]);
+    }
+    return filter;
+}
+
+#if CONFIG_SR_DL_FUSED_DILATION
+
+typedef enum {
+    DL_FUSED_UNCHECKED = 0,
+    DL_FUSED_ON,
+    DL_FUSED_OFF,
+} dl_fused_state_t;
+
+typedef struct {
+    const dl_matrix2d_t *kernel;
+    dl_fused_state_t state;
+} dl_fused_layer_t;
+
+static dl_fused_layer_t s_layer[DL_FUSED_MAX_LAYERS];
+
+fptp_t *__real_dl_dilation_layer(dl_conv_queue_t *in, dl_conv_queue_t *out, int rate, int size,
+                                 dl_matrix2d_t *filter_kernel, dl_matrix2d_t *filter_bias,
+                                 dl_matrix2d_t *gate_kernel, dl_matrix2d_t *gate_bias);
+
+static dl_fused_layer_t *dl_fused_layer(const dl_matrix2d_t *kernel)
+{
+    for (int i = 0; i < DL_FUSED_MAX_LAYERS; i++) {
+        if (s_layer[i].kernel == kernel) {
+            return &s_layer[i];
+        }
+        if (s_layer[i].kernel == NULL) {
+            s_layer[i].kernel = kernel;
+            return &s_layer[i];
+        }
+    }
+    return NULL;
+}
+
+/*
+Run dl_lib first and keep its result, then run the fused step on the same slot and compare.
+Both pop the output queue, so its front is put back in between.
+*/
+static fptp_t *dl_fused_check(dl_fused_layer_t *layer, dl_conv_queue_t *in, dl_conv_queue_t *out, int rate, int size,
+                              dl_matrix2d_t *filter_kernel, dl_matrix2d_t *filter_bias,
+                              dl_matrix2d_t *gate_kernel, dl_matrix2d_t *gate_bias)
+{
+    fptp_t expect[DL_FUSED_MAX_CHANNELS];
+    int front = out->front;
+    fptp_t *res = __real_dl_dilation_layer(in, out, rate, size, filter_kernel, filter_bias, gate_kernel, gate_bias);
+    int expect_front = out->front;
+    memcpy(expect, res, out->c * sizeof(fptp_t));
+
+    out->front = front;
+    fptp_t *fused = dl_dilation_layer_fused(in, out, rate, size, filter_kernel, filter_bias, gate_kernel, gate_bias);
+    layer->state = fused == res && out->front == expect_front ? DL_FUSED_ON : DL_FUSED_OFF;
+    for (int o = 0; o < out->c && layer->state == DL_FUSED_ON; o++) {
+        if (fabsf(res[o] - expect[o]) > DL_FUSED_TOLERANCE * (1.0f + fabsf(expect[o]))) {
+            layer->state = DL_FUSED_OFF;
+        }
+    }
+    if (layer->state == DL_FUSED_OFF) {
+        ESP_LOGW(TAG, "layer %dx%d rate %d: fused step differs, using dl_lib", in->c, out->c, rate);
+        out->front = expect_front;
+        memcpy(res, expect, out->c * sizeof(fptp_t));
+    }
+    return res;
+}
+
+fptp_t *__wrap_dl_dilation_layer(dl_conv_queue_t *in, dl_conv_queue_t *out, int rate, int size,
+                                 dl_matrix2d_t *filter_kernel, dl_matrix2d_t *filter_bias,
+                                 dl_matrix2d_t *gate_kernel, dl_matrix2d_t *gate_bias)
+{
+    dl_fused_layer_t *layer = out->c <= DL_FUSED_MAX_CHANNELS ? dl_fused_layer(filter_kernel) : NULL;
+
+    if (layer && layer->state == DL_FUSED_ON) {
+        return dl_dilation_layer_fused(in, out, rate, size, filter_kernel, filter_bias, gate_kernel, gate_bias);
+    }
+    if (layer && layer->state == DL_FUSED_UNCHECKED) {
+        return dl_fused_check(layer, in, out, rate, size, filter_kernel, filter_bias, gate_kernel, gate_bias);
+    }
+    return __real_dl_dilation_layer(in, out, rate, size, filter_kernel, filter_bias, gate_kernel, gate_bias);
+}
+
+#endif
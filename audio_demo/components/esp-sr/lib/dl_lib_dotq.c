@@ -0,0 +1,241 @@
+// Copyright 2015-2019 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <stdint.h>
+#include "sdkconfig.h"
+#include "esp_log.h"
+#include "xtensa/config/core-isa.h"
+#include "dl_lib_dotq.h"
+
+static const char *TAG = "DL_DOTQ";
+
+#define DL_DOTQ_TEST_LEN    67          //odd, so the tail of every kernel runs too
+#define DL_MAC16_BLOCK      256         //products of 2^30 at most, 256 of them fit the 40 bit ACC
+
+dl_dotq_fn_t dl_dotq_impl = dl_dotq_c_impl;
+dl_addq_fn_t dl_addq_impl = dl_addq_c_impl;
+dl_dotq8_fn_t dl_dotq8_impl = dl_dotq8_c_impl;
+static const char *s_dotq_name = "c";
+
+static inline qtp_t dl_qtp_clip(int32_t v)
+{
+    if (v > DL_QTP_RANGE) {
+        return DL_QTP_RANGE;
+    }
+    if (v < -DL_QTP_RANGE - 1) {
+        return -DL_QTP_RANGE - 1;
+    }
+    return v;
+}
+
+int64_t dl_dotq_c_impl(const qtp_t *a, const qtp_t *b, int len)
+{
+    int64_t sum = 0;
+    for (int i = 0; i < len; i++) {
+        sum += (int32_t)a[i] * b[i];
+    }
+    return sum;
+}
+
+void dl_addq_c_impl(const qtp_t *a, const qtp_t *b, qtp_t *res, int len, int shift)
+{
+    for (int i = 0; i < len; i++) {
+        res[i] = dl_qtp_clip(((int32_t)a[i] + b[i]) >> shift);
+    }
+}
+
+int32_t dl_dotq8_c_impl(const q8tp_t *a, const q8tp_t *b, int len)
+{
+    int32_t sum = 0;
+    for (int i = 0; i < len; i++) {
+        sum += (int32_t)a[i] * b[i];
+    }
+    return sum;
+}
+
+/*
+Four products per step into two accumulators, so the multiplies of one step do not wait on each other
+*/
+static int64_t dl_dotq_unrolled(const qtp_t *a, const qtp_t *b, int len)
+{
+    int64_t s0 = 0, s1 = 0;
+    int i = 0;
+    for (; i + 4 <= len; i += 4) {
+        s0 += (int32_t)a[i] * b[i];
+        s1 += (int32_t)a[i + 1] * b[i + 1];
+        s0 += (int32_t)a[i + 2] * b[i + 2];
+        s1 += (int32_t)a[i + 3] * b[i + 3];
+    }
+    for (; i < len; i++) {
+        s0 += (int32_t)a[i] * b[i];
+    }
+    return s0 + s1;
+}
+
+static void dl_addq_unrolled(const qtp_t *a, const qtp_t *b, qtp_t *res, int len, int shift)
+{
+    int i = 0;
+    for (; i + 4 <= len; i += 4) {
+        int32_t r0 = ((int32_t)a[i] + b[i]) >> shift;
+        int32_t r1 = ((int32_t)a[i + 1] + b[i + 1]) >> shift;
+        int32_t r2 = ((int32_t)a[i + 2] + b[i + 2]) >> shift;
+        int32_t r3 = ((int32_t)a[i + 3] + b[i + 3]) >> shift;
+        res[i] = dl_qtp_clip(r0);
+        res[i + 1] = dl_qtp_clip(r1);
+        res[i + 2] = dl_qtp_clip(r2);
+        res[i + 3] = dl_qtp_clip(r3);
+    }
+    for (; i < len; i++) {
+        res[i] = dl_qtp_clip(((int32_t)a[i] + b[i]) >> shift);
+    }
+}
+
+/*
+One 32 bit load brings four items of each vector, the bytes are sign extended in registers: a quarter of
+the loads of the byte loop. Vectors that are not both word aligned take the byte loop.
+*/
+static int32_t dl_dotq8_words(const q8tp_t *a, const q8tp_t *b, int len)
+{
+    int32_t s0 = 0, s1 = 0;
+    int i = 0;
+    if ((((uintptr_t)a | (uintptr_t)b) & 3) == 0) {
+        const uint32_t *wa = (const uint32_t *)a;
+        const uint32_t *wb = (const uint32_t *)b;
+        for (; i + 4 <= len; i += 4) {
+            uint32_t x = *wa++;
+            uint32_t y = *wb++;
+            s0 += (int8_t)x * (int8_t)y;
+            s1 += (int8_t)(x >> 8) * (int8_t)(y >> 8);
+            s0 += (int8_t)(x >> 16) * (int8_t)(y >> 16);
+            s1 += (int8_t)(x >> 24) * (int8_t)(y >> 24);
+        }
+    }
+    for (; i < len; i++) {
+        s0 += (int32_t)a[i] * b[i];
+    }
+    return s0 + s1;
+}
+
+#if XCHAL_HAVE_MAC16
+/*
+MAC16: one 32 bit load brings two items, mula.aa.ll and mula.aa.hh multiply the low and high halves into
+the 40 bit accumulator. The accumulator is moved to the 64 bit sum every DL_MAC16_BLOCK products.
+ACCLO/ACCHI are part of the task context, a switch in the middle of the loop is fine.
+*/
+static inline int64_t dl_mac16_pairs(const uint32_t *a, const uint32_t *b, int pairs)
+{
+    uint32_t lo;
+    int32_t hi;
+    __asm__ volatile ("wsr %0, acclo\n"
+                      "wsr %0, acchi\n" :: "r"(0));
+    for (int i = 0; i < pairs; i++) {
+        __asm__ volatile ("mula.aa.ll %0, %1\n"
+                          "mula.aa.hh %0, %1\n" :: "r"(a[i]), "r"(b[i]));
+    }
+    __asm__ volatile ("rsr %0, acclo\n"
+                      "rsr %1, acchi\n" : "=r"(lo), "=r"(hi));
+    return ((int64_t)(int8_t)hi << 32) | lo;
+}
+
+static int64_t dl_dotq_mac16(const qtp_t *a, const qtp_t *b, int len)
+{
+    int64_t sum = 0;
+    if (((uintptr_t)a ^ (uintptr_t)b) & 2) {
+        //the halves of a word do not line up
+        return dl_dotq_unrolled(a, b, len);
+    }
+    if (((uintptr_t)a & 2) && len > 0) {
+        sum += (int32_t)*a++ * *b++;
+        len--;
+    }
+    while (len >= 2) {
+        int n = len < DL_MAC16_BLOCK ? len : DL_MAC16_BLOCK;
+        int pairs = n / 2;
+        sum += dl_mac16_pairs((const uint32_t *)a, (const uint32_t *)b, pairs);
+        a += 2 * pairs;
+        b += 2 * pairs;
+        len -= 2 * pairs;
+    }
+    if (len) {
+        sum += (int32_t)*a * *b;
+    }
+    return sum;
+}
+#endif
+
+static int dl_dotq_check(dl_dotq_fn_t dot, dl_addq_fn_t add, dl_dotq8_fn_t dot8)
+{
+    qtp_t a[DL_DOTQ_TEST_LEN + 1] __attribute__((aligned(4))), b[DL_DOTQ_TEST_LEN + 1] __attribute__((aligned(4)));
+    qtp_t r0[DL_DOTQ_TEST_LEN], r1[DL_DOTQ_TEST_LEN];
+    uint32_t seed = 0x2545f491;
+
+    for (int i = 0; i <= DL_DOTQ_TEST_LEN; i++) {
+        seed = seed * 1664525 + 1013904223;
+        a[i] = seed >> 16;
+        seed = seed * 1664525 + 1013904223;
+        b[i] = seed >> 16;
+    }
+    //the extremes, where a wrong accumulator width shows
+    a[0] = b[0] = a[1] = -DL_QTP_RANGE - 1;
+    b[1] = DL_QTP_RANGE;
+    for (int off = 0; off < 2; off++) {
+        if (dot(a + off, b + off, DL_DOTQ_TEST_LEN) != dl_dotq_c_impl(a + off, b + off, DL_DOTQ_TEST_LEN)
+            || dot(a, b + off, DL_DOTQ_TEST_LEN) != dl_dotq_c_impl(a, b + off, DL_DOTQ_TEST_LEN)) {
+            return 0;
+        }
+    }
+    if (dot8) {
+        const q8tp_t *a8 = (const q8tp_t *)a;
+        const q8tp_t *b8 = (const q8tp_t *)b;
+        for (int off = 0; off < 4; off++) {
+            if (dot8(a8 + off, b8 + off, DL_DOTQ_TEST_LEN) != dl_dotq8_c_impl(a8 + off, b8 + off, DL_DOTQ_TEST_LEN)
+                || dot8(a8, b8 + off, DL_DOTQ_TEST_LEN) != dl_dotq8_c_impl(a8, b8 + off, DL_DOTQ_TEST_LEN)) {
+                return 0;
+            }
+        }
+    }
+    for (int shift = 0; shift <= 1; shift++) {
+        add(a, b, r0, DL_DOTQ_TEST_LEN, shift);
+        dl_addq_c_impl(a, b, r1, DL_DOTQ_TEST_LEN, shift);
+        for (int i = 0; i < DL_DOTQ_TEST_LEN; i++) {
+            if (r0[i] != r1[i]) {
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+void dl_dotq_init(void)
+{
+    dl_dotq_fn_t dot = dl_dotq_unrolled;
+    const char *name = "unrolled";
+#if XCHAL_HAVE_MAC16
+    dot = dl_dotq_mac16;
+    name = "mac16";
+#endif
+    if (!dl_dotq_check(dot, dl_addq_unrolled, dl_dotq8_words)) {
+        ESP_LOGW(TAG, "%s kernels do not match the C version, using C", name);
+        return;
+    }
+    dl_dotq_impl = dot;
+    dl_addq_impl = dl_addq_unrolled;
+    dl_dotq8_impl = dl_dotq8_words;
+    s_dotq_name = name;
+    ESP_LOGI(TAG, "dot kernel: %s", name);
+}
+
+const char *dl_dotq_impl_name(void)
+{
+    return s_dotq_name;
+}
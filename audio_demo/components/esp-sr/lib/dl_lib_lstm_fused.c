@@ -0,0 +1,250 @@
+// Copyright 2015-2019 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <math.h>
+#include <string.h>
+#include "sdkconfig.h"
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "dl_lib_lstm_fused.h"
+
+static const char *TAG = "DL_LSTM";
+
+#define DL_LSTM_TOLERANCE   1e-3f       //the table is within 2e-5 of the functions, the sums run in another order
+
+#define DL_ACT_SHIFT        5           //table step 1/32
+#define DL_ACT_LIMIT        8           //sigmoid is 0 or 1 to 3e-4 beyond +-8
+#define DL_ACT_SIZE         (2 * DL_ACT_LIMIT << DL_ACT_SHIFT)
+
+static float s_sigmoid[DL_ACT_SIZE + 1];
+
+static void dl_act_table_init(void)
+{
+    if (s_sigmoid[DL_ACT_SIZE] != 0) {
+        return;
+    }
+    for (int i = 0; i <= DL_ACT_SIZE; i++) {
+        s_sigmoid[i] = 1.0f / (1.0f + expf(-ldexpf(i, -DL_ACT_SHIFT) + DL_ACT_LIMIT));
+    }
+}
+
+//x in 16.16 fixed point: the integer part above the step indexes the table, the rest interpolates
+static inline float dl_sigmoid_tab(float x)
+{
+    if (x <= -DL_ACT_LIMIT) {
+        return s_sigmoid[0];
+    }
+    if (x >= DL_ACT_LIMIT) {
+        return s_sigmoid[DL_ACT_SIZE];
+    }
+    int32_t q = (int32_t)((x + DL_ACT_LIMIT) * (1 << 16));
+    int i = q >> (16 - DL_ACT_SHIFT);
+    float frac = (q & ((1 << (16 - DL_ACT_SHIFT)) - 1)) * (1.0f / (1 << (16 - DL_ACT_SHIFT)));
+    return s_sigmoid[i] + (s_sigmoid[i + 1] - s_sigmoid[i]) * frac;
+}
+
+static inline float dl_tanh_tab(float x)
+{
+    return 2.0f * dl_sigmoid_tab(2.0f * x) - 1.0f;
+}
+
+int dl_lstm_pack(dl_lstm_packed_t *p, int in_c, const dl_matrix2d_t *weight, const dl_matrix2d_t *bias, float forget_bias)
+{
+    int units = weight->w / 4;
+    int k_len = in_c + units;
+
+    if (weight->w != 4 * units || weight->h != k_len || (bias && bias->w != weight->w) || units > DL_LSTM_MAX_UNITS) {
+        ESP_LOGE(TAG, "weight %dx%d does not fit %d inputs\n", weight->w, weight->h, in_c);
+        return -1;
+    }
+    size_t size = (size_t)units * (1 + k_len) * 4 * sizeof(fptp_t);
+    p->gates = heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (p->gates == NULL) {
+        p->gates = heap_caps_malloc(size, MALLOC_CAP_8BIT);
+    }
+    if (p->gates == NULL) {
+        ESP_LOGE(TAG, "%u bytes of packed weights malloc error\n", size);
+        return -1;
+    }
+    p->in_c = in_c;
+    p->units = units;
+    p->forget_bias = forget_bias;
+    //column g*units+u of the weight is gate g of unit u, its bias leads the block of the unit
+    fptp_t *dst = p->gates;
+    for (int u = 0; u < units; u++) {
+        for (int g = 0; g < 4; g++) {
+            *dst++ = (bias ? bias->item[g * units + u] : 0) + (g == 2 ? forget_bias : 0);
+        }
+        for (int k = 0; k < k_len; k++) {
+            for (int g = 0; g < 4; g++) {
+                *dst++ = DL_ITM(weight, g * units + u, k);
+            }
+        }
+    }
+    dl_act_table_init();
+    return 0;
+}
+
+void dl_lstm_unpack(dl_lstm_packed_t *p)
+{
+    heap_caps_free(p->gates);
+    p->gates = NULL;
+}
+
+dl_matrix2d_t *dl_basic_lstm_layer1_fused(const dl_conv_queue_t *in, dl_matrix2d_t *state_c, dl_matrix2d_t *state_h,
+                                          const dl_lstm_packed_t *p)
+{
+    fptp_t h_new[DL_LSTM_MAX_UNITS];
+    int units = p->units;
+    int pos = (in->front - 1 + in->n) % in->n;
+    const fptp_t *x = in->item + pos * in->c;
+    const fptp_t *h = state_h->item;
+    const fptp_t *w = p->gates;
+
+    for (int u = 0; u < units; u++) {
+        fptp_t gi = w[0], gj = w[1], gf = w[2], go = w[3];
+        w += 4;
+        for (int k = 0; k < p->in_c; k++, w += 4) {
+            fptp_t v = x[k];
+            gi += v * w[0];
+            gj += v * w[1];
+            gf += v * w[2];
+            go += v * w[3];
+        }
+        for (int k = 0; k < units; k++, w += 4) {
+            fptp_t v = h[k];
+            gi += v * w[0];
+            gj += v * w[1];
+            gf += v * w[2];
+            go += v * w[3];
+        }
+        //the cell of unit u is its own, the outputs are inputs of the other units until the step is done
+        fptp_t c = state_c->item[u] * dl_sigmoid_tab(gf) + dl_sigmoid_tab(gi) * dl_tanh_tab(gj);
+        state_c->item[u] = c;
+        h_new[u] = dl_tanh_tab(c) * dl_sigmoid_tab(go);
+    }
+    memcpy(state_h->item, h_new, units * sizeof(fptp_t));
+    return state_h;
+}
+
+#if CONFIG_SR_DL_FUSED_LSTM
+
+typedef enum {
+    DL_LSTM_UNCHECKED = 0,
+    DL_LSTM_ON,
+    DL_LSTM_OFF,
+} dl_lstm_state_t;
+
+typedef struct {
+    const dl_matrix2d_t *weight;
+    dl_lstm_state_t state;
+    dl_lstm_packed_t packed;
+} dl_lstm_layer_t;
+
+static dl_lstm_layer_t s_layer[DL_LSTM_MAX_LAYERS];
+
+dl_matrix2d_t *__real_dl_basic_lstm_layer1(const dl_conv_queue_t *in, dl_matrix2d_t *state_c, dl_matrix2d_t *state_h,
+                                          const dl_matrix2d_t *weight, const dl_matrix2d_t *bias);
+
+static dl_lstm_layer_t *dl_lstm_layer(const dl_matrix2d_t *weight)
+{
+    for (int i = 0; i < DL_LSTM_MAX_LAYERS; i++) {
+        if (s_layer[i].weight == weight) {
+            return &s_layer[i];
+        }
+        if (s_layer[i].weight == NULL) {
+            s_layer[i].weight = weight;
+            return &s_layer[i];
+        }
+    }
+    return NULL;
+}
+
+static int dl_lstm_same(const fptp_t *a, const fptp_t *b, int n)
+{
+    for (int i = 0; i < n; i++) {
+        if (fabsf(a[i] - b[i]) > DL_LSTM_TOLERANCE * (1.0f + fabsf(b[i]))) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+//The forget gate has no effect on a zero cell, a check on it would pass with any forget bias
+static int dl_lstm_cell_zero(const dl_matrix2d_t *state_c)
+{
+    for (int u = 0; u < state_c->w; u++) {
+        if (state_c->item[u] != 0) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/*
+Run dl_lib first and keep its state, then the fused step from the same state and compare. Whether the
+exporter folded the forget bias of BasicLSTMCell into the bias is not recorded in the model: without it
+first, then with 1.0 added.
+*/
+static dl_matrix2d_t *dl_lstm_check(dl_lstm_layer_t *layer, const dl_conv_queue_t *in, dl_matrix2d_t *state_c,
+                                    dl_matrix2d_t *state_h, const dl_matrix2d_t *weight, const dl_matrix2d_t *bias)
+{
+    static const float forget_bias[] = {0.0f, 1.0f};
+    fptp_t c0[DL_LSTM_MAX_UNITS], h0[DL_LSTM_MAX_UNITS];
+    fptp_t c1[DL_LSTM_MAX_UNITS], h1[DL_LSTM_MAX_UNITS];
+    int units = state_h->w;
+    size_t size = units * sizeof(fptp_t);
+
+    memcpy(c0, state_c->item, size);
+    memcpy(h0, state_h->item, size);
+    dl_matrix2d_t *res = __real_dl_basic_lstm_layer1(in, state_c, state_h, weight, bias);
+    memcpy(c1, state_c->item, size);
+    memcpy(h1, state_h->item, size);
+
+    layer->state = DL_LSTM_OFF;
+    for (int i = 0; i < sizeof(forget_bias) / sizeof(forget_bias[0]) && res == state_h; i++) {
+        if (dl_lstm_pack(&layer->packed, in->c, weight, bias, forget_bias[i]) != 0) {
+            break;
+        }
+        memcpy(state_c->item, c0, size);
+        memcpy(state_h->item, h0, size);
+        dl_basic_lstm_layer1_fused(in, state_c, state_h, &layer->packed);
+        if (dl_lstm_same(state_c->item, c1, units) && dl_lstm_same(state_h->item, h1, units)) {
+            layer->state = DL_LSTM_ON;
+            break;
+        }
+        dl_lstm_unpack(&layer->packed);
+    }
+    if (layer->state == DL_LSTM_OFF) {
+        ESP_LOGW(TAG, "layer %dx%d: fused step differs, using dl_lib", in->c, units);
+    }
+    memcpy(state_c->item, c1, size);
+    memcpy(state_h->item, h1, size);
+    return res;
+}
+
+dl_matrix2d_t *__wrap_dl_basic_lstm_layer1(const dl_conv_queue_t *in, dl_matrix2d_t *state_c, dl_matrix2d_t *state_h,
+                                          const dl_matrix2d_t *weight, const dl_matrix2d_t *bias)
+{
+    dl_lstm_layer_t *layer = state_h->w <= DL_LSTM_MAX_UNITS ? dl_lstm_layer(weight) : NULL;
+
+    if (layer && layer->state == DL_LSTM_ON) {
+        return dl_basic_lstm_layer1_fused(in, state_c, state_h, &layer->packed);
+    }
+    if (layer && layer->state == DL_LSTM_UNCHECKED && !dl_lstm_cell_zero(state_c)) {
+        return dl_lstm_check(layer, in, state_c, state_h, weight, bias);
+    }
+    return __real_dl_basic_lstm_layer1(in, state_c, state_h, weight, bias);
+}
+
+#endif
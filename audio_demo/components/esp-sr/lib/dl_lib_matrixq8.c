@@ -0,0 +1,257 @@
+// Copyright 2015-2019 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "esp_log.h"
+#include "dl_lib_matrixq8.h"
+#include "dl_lib_dotq.h"
+
+static const char *TAG = "DL_MATRIXQ8";
+
+dl_matrix2dq8_t *dl_matrixq8_alloc(int w, int h, int per_tensor)
+{
+    dl_matrix2dq8_t *m = calloc(1, sizeof(dl_matrix2dq8_t));
+    if (m == NULL) {
+        return NULL;
+    }
+    m->w = w;
+    m->h = h;
+    m->stride = h == 1 ? 1 : (h + 3) & ~3;
+    m->flags = per_tensor ? DL_MQ8_PER_TENSOR : 0;
+    m->exponent = calloc(per_tensor ? 1 : w, sizeof(int8_t));
+    m->item = calloc(m->stride * w, sizeof(q8tp_t));     //word aligned, as every malloc
+    if (m->exponent == NULL || m->item == NULL) {
+        dl_matrixq8_free(m);
+        return NULL;
+    }
+    return m;
+}
+
+void dl_matrixq8_free(dl_matrix2dq8_t *m)
+{
+    if (m == NULL) {
+        return;
+    }
+    if (!(m->flags & DL_MF_FOREIGNDATA)) {
+        free(m->item);
+    }
+    free(m->exponent);
+    free(m);
+}
+
+static dl_matrix2dq8_t *dl_matrixq8_out(int w, int h, dl_matrix2dq8_t *out, int per_tensor)
+{
+    if (out == NULL) {
+        return dl_matrixq8_alloc(w, h, per_tensor);
+    }
+    if (out->w != w || out->h != h || !(out->flags & DL_MQ8_PER_TENSOR) != !per_tensor) {
+        ESP_LOGE(TAG, "out is %dx%d, %dx%d needed", out->w, out->h, w, h);
+        return NULL;
+    }
+    return out;
+}
+
+static inline q8tp_t dl_q8_clip(int32_t v)
+{
+    return v > DL_Q8_RANGE ? DL_Q8_RANGE : (v < -DL_Q8_RANGE ? -DL_Q8_RANGE : v);
+}
+
+//shift of a group of columns so its largest magnitude fits 7 bits
+static int dl_matrixq8_group_shift(const dl_matrix2dq_t *m, int x0, int x1)
+{
+    int32_t peak = 0;
+    for (int x = x0; x < x1; x++) {
+        for (int y = 0; y < m->h; y++) {
+            int32_t v = abs(DL_ITMQ(m, x, y));
+            peak = v > peak ? v : peak;
+        }
+    }
+    int shift = 0;
+    while ((peak >> shift) > DL_Q8_RANGE) {
+        shift++;
+    }
+    return shift;
+}
+
+dl_matrix2dq8_t *dl_matrixq8_from_matrixq(const dl_matrix2dq_t *m, dl_matrix2dq8_t *out, int per_tensor)
+{
+    out = dl_matrixq8_out(m->w, m->h, out, per_tensor);
+    if (out == NULL) {
+        return NULL;
+    }
+    int shift = per_tensor ? dl_matrixq8_group_shift(m, 0, m->w) : 0;
+    if (per_tensor) {
+        out->exponent[0] = m->exponent + shift;
+    }
+    for (int x = 0; x < m->w; x++) {
+        if (!per_tensor) {
+            shift = dl_matrixq8_group_shift(m, x, x + 1);
+            out->exponent[x] = m->exponent + shift;
+        }
+        int32_t half = shift ? 1 << (shift - 1) : 0;
+        for (int y = 0; y < m->h; y++) {
+            DL_ITMQ8(out, x, y) = dl_q8_clip(((int32_t)DL_ITMQ(m, x, y) + half) >> shift);
+        }
+    }
+    return out;
+}
+
+//exponent of a group of columns so its largest magnitude fits 7 bits
+static int dl_matrixq8_group_exp(const dl_matrix2d_t *m, int x0, int x1)
+{
+    fptp_t peak = 0;
+    int exp;
+    for (int y = 0; y < m->h; y++) {
+        for (int x = x0; x < x1; x++) {
+            fptp_t v = fabsf(DL_ITM(m, x, y));
+            peak = v > peak ? v : peak;
+        }
+    }
+    if (peak == 0) {
+        return 0;
+    }
+    frexpf(peak, &exp);
+    return exp - 7;
+}
+
+dl_matrix2dq8_t *dl_matrixq8_from_matrix2d(const dl_matrix2d_t *m, dl_matrix2dq8_t *out, int per_tensor)
+{
+    out = dl_matrixq8_out(m->w, m->h, out, per_tensor);
+    if (out == NULL) {
+        return NULL;
+    }
+    int exp = per_tensor ? dl_matrixq8_group_exp(m, 0, m->w) : 0;
+    if (per_tensor) {
+        out->exponent[0] = exp;
+    }
+    for (int x = 0; x < m->w; x++) {
+        if (!per_tensor) {
+            exp = dl_matrixq8_group_exp(m, x, x + 1);
+            out->exponent[x] = exp;
+        }
+        for (int y = 0; y < m->h; y++) {
+            DL_ITMQ8(out, x, y) = dl_q8_clip(lrintf(ldexpf(DL_ITM(m, x, y), -exp)));
+        }
+    }
+    return out;
+}
+
+static inline qtp_t dl_q8_scale(int32_t acc, int shift)
+{
+    int64_t v;
+    if (shift >= 32) {
+        v = 0;
+    } else if (shift > 0) {
+        v = ((int64_t)acc + ((int64_t)1 << (shift - 1))) >> shift;
+    } else {
+        v = (int64_t)acc << (-shift < 32 ? -shift : 32);
+    }
+    return v > DL_QTP_RANGE ? DL_QTP_RANGE : (v < -DL_QTP_RANGE - 1 ? -DL_QTP_RANGE - 1 : v);
+}
+
+static int dl_matrixq8_dot_check(const dl_matrix2dq8_t *a, const dl_matrix2dq8_t *b, int w, int h)
+{
+    if (a->w != b->h || w != b->w || h != a->h || !(a->flags & DL_MQ8_PER_TENSOR)) {
+        ESP_LOGE(TAG, "dot of %dx%d%s and %dx%d into %dx%d", a->w, a->h,
+                 (a->flags & DL_MQ8_PER_TENSOR) ? "" : " per column", b->w, b->h, w, h);
+        return 0;
+    }
+    return 1;
+}
+
+/*
+Row y of a is strided in the column layout, a matrix higher than one row has it gathered first:
+w bytes per row against w * b->w products.
+*/
+static const q8tp_t *dl_matrixq8_row(const dl_matrix2dq8_t *a, int y, q8tp_t *buf)
+{
+    if (a->h == 1) {
+        return a->item;
+    }
+    for (int k = 0; k < a->w; k++) {
+        buf[k] = DL_ITMQ8(a, k, y);
+    }
+    return buf;
+}
+
+void dl_matrixq8_dot(const dl_matrix2dq8_t *a, const dl_matrix2dq8_t *b, dl_matrix2dq_t *res, int shift)
+{
+    if (!dl_matrixq8_dot_check(a, b, res->w, res->h)) {
+        return;
+    }
+    q8tp_t *buf = a->h > 1 ? malloc((a->w + 3) & ~3) : NULL;
+    if (a->h > 1 && buf == NULL) {
+        ESP_LOGE(TAG, "no memory for a row of %d", a->w);
+        return;
+    }
+    int eb_max = INT8_MIN;
+    for (int x = 0; x < b->w; x++) {
+        int e = dl_matrixq8_exp(b, x);
+        eb_max = e > eb_max ? e : eb_max;
+    }
+    //no sum of a->w products can reach 2^bits
+    int64_t bound = (int64_t)a->w * DL_Q8_RANGE * DL_Q8_RANGE;
+    int bits = 0;
+    while (((int64_t)1 << bits) <= bound) {
+        bits++;
+    }
+    int ea = a->exponent[0];
+    res->exponent = ea + eb_max + bits - DL_QTP_SHIFT - shift;
+    for (int y = 0; y < a->h; y++) {
+        const q8tp_t *row = dl_matrixq8_row(a, y, buf);
+        for (int x = 0; x < b->w; x++) {
+            int32_t acc = dl_dotq8(row, &DL_ITMQ8(b, x, 0), a->w);
+            DL_ITMQ(res, x, y) = dl_q8_scale(acc, res->exponent - ea - dl_matrixq8_exp(b, x));
+        }
+    }
+    free(buf);
+}
+
+void dl_matrixq8_dot_matrix_out(const dl_matrix2dq8_t *a, const dl_matrix2dq8_t *b, dl_matrix2d_t *res)
+{
+    if (!dl_matrixq8_dot_check(a, b, res->w, res->h)) {
+        return;
+    }
+    q8tp_t *buf = a->h > 1 ? malloc((a->w + 3) & ~3) : NULL;
+    if (a->h > 1 && buf == NULL) {
+        ESP_LOGE(TAG, "no memory for a row of %d", a->w);
+        return;
+    }
+    for (int y = 0; y < a->h; y++) {
+        const q8tp_t *row = dl_matrixq8_row(a, y, buf);
+        for (int x = 0; x < b->w; x++) {
+            int32_t acc = dl_dotq8(row, &DL_ITMQ8(b, x, 0), a->w);
+            DL_ITM(res, x, y) = ldexpf((fptp_t)acc, a->exponent[0] + dl_matrixq8_exp(b, x));
+        }
+    }
+    free(buf);
+}
+
+float dl_matrixq8_snr_db(const dl_matrix2dq_t *m, const dl_matrix2dq8_t *q)
+{
+    double sig = 0, err = 0;
+    for (int x = 0; x < m->w; x++) {
+        for (int y = 0; y < m->h; y++) {
+            double v = ldexp(DL_ITMQ(m, x, y), m->exponent);
+            double d = v - ldexp(DL_ITMQ8(q, x, y), dl_matrixq8_exp(q, x));
+            sig += v * v;
+            err += d * d;
+        }
+    }
+    if (err == 0) {
+        return INFINITY;
+    }
+    return 10 * log10(sig / err);
+}
@@ -0,0 +1,60 @@
+// Copyright 2015-2019 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef DL_LIB_ARENA_H
+#define DL_LIB_ARENA_H
+
+#include <stddef.h>
+
+/*
+Scratch arena for the matrices and queues a model allocates inside one detect() step.
+
+The dl_lib and model libraries allocate with malloc/calloc and release with free. With CONFIG_SR_DL_ARENA
+those calls are wrapped at link time: between dl_arena_begin and dl_arena_end, allocations made by that task
+are bump allocations from the arena and free on them does nothing. dl_arena_end rewinds the arena once every
+allocation of the step has been freed, so a steady model reuses the same memory on every frame.
+An allocation that outlives the step (state the model keeps) holds the arena until it is freed, and when the
+arena runs out an allocation goes to the heap as before.
+
+Without CONFIG_SR_DL_ARENA an arena reserves nothing and dl_arena_begin/dl_arena_end do nothing.
+*/
+
+typedef struct dl_arena dl_arena_t;
+
+/**
+ * @brief Reserve the arena, once for a model instance.
+ *
+ * @param size  Bytes, the activation working set of one detect()
+ * @param caps  MALLOC_CAP_* of the reservation
+ * @return The arena, NULL if out of memory or too many arenas are alive
+ */
+dl_arena_t *dl_arena_create(size_t size, int caps);
+
+void dl_arena_destroy(dl_arena_t *arena);
+
+// Bind the arena to the calling task, no nesting
+void dl_arena_begin(dl_arena_t *arena);
+
+// Unbind, and rewind the arena when the step freed everything it allocated
+void dl_arena_end(dl_arena_t *arena);
+
+// Between the steps of a batch: rewind as dl_arena_end does and stay bound
+void dl_arena_next(dl_arena_t *arena);
+
+// The most bytes a step has used, to size the arena
+size_t dl_arena_high_water(const dl_arena_t *arena);
+
+// Allocations that did not fit and went to the heap
+int dl_arena_overflows(const dl_arena_t *arena);
+
+#endif
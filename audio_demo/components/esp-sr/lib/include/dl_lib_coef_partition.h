@@ -0,0 +1,77 @@
+// Copyright 2015-2019 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef DL_LIB_COEF_PARTITION_H
+#define DL_LIB_COEF_PARTITION_H
+
+#include <stddef.h>
+#include "esp_err.h"
+#include "dl_lib_coefgetter_if.h"
+
+/*
+Coefficients in a data partition. The partition is memory-mapped and the matrices returned by the getter
+point straight into the mapping, so the weights stay in flash and only the small matrix headers, the model
+info and the alphabet take RAM.
+
+A partition is filled once from a compiled-in getter: pass the recorder of dl_coef_partition_record_begin
+to the create() of the model, every matrix the model asks for goes to the partition, then call
+dl_coef_partition_record_end. An app built that way does not need to link the compiled-in coefficients.
+A short tag recorded with the image tells which model it is for, it can be read without mapping the partition.
+*/
+
+#define DL_COEF_PARTITION_MAX   2       //Partitions served at the same time
+#define DL_COEF_TAG_LEN         32      //With the NUL
+
+/**
+ * @brief Map the partition and return a getter serving its coefficients.
+ *
+ * @param label     Partition label
+ * @return The getter, NULL if the partition holds no complete coefficient image
+ */
+const model_coeff_getter_t *dl_coef_partition_getter(const char *label);
+
+/**
+ * @brief Erase the partition and start recording the coefficients src hands out.
+ *
+ * @param label     Partition label
+ * @param src       The getter to record, usually compiled-in coefficients
+ * @param recorder  The getter to pass to the model create(), it forwards to src
+ */
+esp_err_t dl_coef_partition_record_begin(const char *label, const model_coeff_getter_t *src, const model_coeff_getter_t **recorder);
+
+/**
+ * @brief Set the tag of the image being recorded, written by dl_coef_partition_record_end.
+ */
+esp_err_t dl_coef_partition_record_tag(const char *tag);
+
+/**
+ * @brief Write the index, the partition is valid from now on.
+ */
+esp_err_t dl_coef_partition_record_end(void);
+
+/**
+ * @brief Read the tag of the image in the partition.
+ *
+ * @return ESP_ERR_NOT_FOUND without the partition, ESP_ERR_INVALID_VERSION if it holds no image
+ */
+esp_err_t dl_coef_partition_read_tag(const char *label, char *tag, size_t len);
+
+/**
+ * @brief Until dl_coef_placement_end, allocations of internal_limit bytes or more go to PSRAM first.
+ *        Wrap a model create() with it, so the activations land in PSRAM and internal RAM is kept for
+ *        the small, hot buffers. Does nothing without CONFIG_SPIRAM_USE_MALLOC.
+ */
+void dl_coef_placement_begin(size_t internal_limit);
+void dl_coef_placement_end(void);
+
+#endif
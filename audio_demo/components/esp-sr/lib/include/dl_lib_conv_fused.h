@@ -0,0 +1,41 @@
+// Copyright 2015-2019 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef DL_LIB_CONV_FUSED_H
+#define DL_LIB_CONV_FUSED_H
+
+#include "dl_lib_conv_queue.h"
+
+/*
+Fused dilation layer: both atrous convolutions and the gated activation in one pass over the queue
+window, the result goes straight into the new slot of the output queue. No matrix is allocated on the way,
+the filter sums build up in the output slot and the gate sums in a buffer on the stack.
+
+With CONFIG_SR_DL_FUSED_DILATION, calls of the models to dl_dilation_layer are wrapped at link time.
+The first call of every layer runs both and compares them; a layer whose results differ keeps the
+dl_lib version. Layers wider than DL_FUSED_MAX_CHANNELS always do.
+*/
+
+#define DL_FUSED_MAX_CHANNELS   256     //output channels, the gate sums live on the stack
+#define DL_FUSED_MAX_LAYERS     32      //layers whose check result is kept
+
+/**
+ * @brief dl_dilation_layer in one pass, same arguments and result.
+ *
+ * @return The result, NULL when the layer has more than DL_FUSED_MAX_CHANNELS output channels
+ */
+fptp_t *dl_dilation_layer_fused(dl_conv_queue_t *in, dl_conv_queue_t *out, int rate, int size,
+                                dl_matrix2d_t *filter_kernel, dl_matrix2d_t *filter_bias,
+                                dl_matrix2d_t *gate_kernel, dl_matrix2d_t *gate_bias);
+
+#endif
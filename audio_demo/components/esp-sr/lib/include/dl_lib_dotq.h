@@ -0,0 +1,75 @@
+// Copyright 2015-2019 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef DL_LIB_DOTQ_H
+#define DL_LIB_DOTQ_H
+
+#include <stdint.h>
+#include "dl_lib_matrixq.h"
+#include "dl_lib_matrixq8.h"
+
+/*
+Vector kernels on quantized items, the inner loops of a quantized matrix product and sum.
+
+dl_dotq_init picks the fastest kernel the chip runs and checks it against the C version on a test
+vector before using it, a kernel that does not give the same result is not used. All kernels are
+bit-exact with dl_dotq_c_impl and dl_addq_c_impl.
+*/
+
+typedef int64_t (*dl_dotq_fn_t)(const qtp_t *a, const qtp_t *b, int len);
+typedef void (*dl_addq_fn_t)(const qtp_t *a, const qtp_t *b, qtp_t *res, int len, int shift);
+typedef int32_t (*dl_dotq8_fn_t)(const q8tp_t *a, const q8tp_t *b, int len);
+
+extern dl_dotq_fn_t dl_dotq_impl;
+extern dl_addq_fn_t dl_addq_impl;
+extern dl_dotq8_fn_t dl_dotq8_impl;
+
+/**
+ * @brief Select the kernels, once at boot. Until then the C versions are used.
+ */
+void dl_dotq_init(void);
+
+/**
+ * @brief Name of the selected dot kernel, "c" when no faster one is available
+ */
+const char *dl_dotq_impl_name(void);
+
+/**
+ * @brief Sum of a[i]*b[i], exact: no rounding, no saturation
+ */
+static inline int64_t dl_dotq(const qtp_t *a, const qtp_t *b, int len)
+{
+    return dl_dotq_impl(a, b, len);
+}
+
+/**
+ * @brief res[i] = (a[i]+b[i]) >> shift, clipped to the qtp_t range. res may be a or b.
+ */
+static inline void dl_addq(const qtp_t *a, const qtp_t *b, qtp_t *res, int len, int shift)
+{
+    dl_addq_impl(a, b, res, len, shift);
+}
+
+/**
+ * @brief Sum of a[i]*b[i] of 8 bit items, exact in 32 bits for len up to 2^17 of items within +-DL_Q8_RANGE
+ */
+static inline int32_t dl_dotq8(const q8tp_t *a, const q8tp_t *b, int len)
+{
+    return dl_dotq8_impl(a, b, len);
+}
+
+int64_t dl_dotq_c_impl(const qtp_t *a, const qtp_t *b, int len);
+void dl_addq_c_impl(const qtp_t *a, const qtp_t *b, qtp_t *res, int len, int shift);
+int32_t dl_dotq8_c_impl(const q8tp_t *a, const q8tp_t *b, int len);
+
+#endif
@@ -0,0 +1,59 @@
+// Copyright 2015-2019 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef DL_LIB_LSTM_FUSED_H
+#define DL_LIB_LSTM_FUSED_H
+
+#include "dl_lib_conv_queue.h"
+
+/*
+Fused LSTM step: the weights of a layer are repacked once so the four gates of a unit are read as one
+contiguous stream, item k of gates i, j, f, o next to each other. A unit takes the newest input of the queue
+and the previous output without building their concatenation, and its cell update runs as soon as its four
+sums are done. Sigmoid and tanh come from one interpolated table indexed in fixed point.
+
+With CONFIG_SR_DL_FUSED_LSTM, calls of the models to dl_basic_lstm_layer1 are wrapped at link time.
+The first call of every layer with a non-zero cell packs its weights, runs both versions and compares
+them; a layer whose results differ keeps the dl_lib version and its packed copy is freed. Layers wider than
+DL_LSTM_MAX_UNITS always do.
+*/
+
+#define DL_LSTM_MAX_UNITS       256     //the new outputs of a step live on the stack
+#define DL_LSTM_MAX_LAYERS      8       //layers whose packed weights are kept
+
+typedef struct {
+    int in_c;           //input channels
+    int units;
+    float forget_bias;  //added to the f gate, folded into the bias by some exporters
+    fptp_t *gates;      //unit by unit: the 4 biases, then item k of the 4 gates for k < in_c+units
+} dl_lstm_packed_t;
+
+/**
+ * @brief Repack the weight and bias of a dl_basic_lstm_layer1 layer: weight has 4*units columns in the order
+ *        i, j, f, o and in_c+units rows, input rows first. The copy goes to PSRAM when there is some.
+ *
+ * @return 0 on success, -1 on a shape that does not fit or out of memory
+ */
+int dl_lstm_pack(dl_lstm_packed_t *p, int in_c, const dl_matrix2d_t *weight, const dl_matrix2d_t *bias, float forget_bias);
+
+void dl_lstm_unpack(dl_lstm_packed_t *p);
+
+/**
+ * @brief One step of the layer on the newest element of in, state_c and state_h are updated in place.
+ *
+ * @return state_h, as dl_basic_lstm_layer1
+ */
+dl_matrix2d_t *dl_basic_lstm_layer1_fused(const dl_conv_queue_t *in, dl_matrix2d_t *state_c, dl_matrix2d_t *state_h,
+                                          const dl_lstm_packed_t *p);
+
+#endif
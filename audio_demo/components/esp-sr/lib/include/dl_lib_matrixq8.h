@@ -0,0 +1,99 @@
+// Copyright 2015-2019 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef DL_LIB_MATRIXQ8_H
+#define DL_LIB_MATRIXQ8_H
+
+#include <stdint.h>
+#include "dl_lib_matrixq.h"
+
+/*
+8 bit quantized matrix: half the bytes of a dl_matrix2dq_t on every weight fetch from flash or PSRAM.
+
+The layout is the one of dl_matrix2dq_t, column x holds items x*stride .. x*stride+h-1, so a column of
+weights is one output channel, read in order. Each column has its own exponent (the item times
+pow(2,exponent[x]) is the real value), a channel with small weights keeps its 7 bits of precision next to
+one with large weights. Activations take one exponent for the whole matrix, DL_MQ8_PER_TENSOR.
+
+Items are kept within +-DL_Q8_RANGE, so dl_dotq8 sums a row and a column exactly in 32 bits; the sum is
+scaled once per output item. Columns of matrices higher than one row start on a word boundary.
+*/
+
+typedef int8_t q8tp_t;
+
+#define DL_Q8_RANGE         127
+#define DL_MQ8_PER_TENSOR   (1<<1)  //exponent[0] holds for every column; DL_MF_FOREIGNDATA is bit 0
+
+typedef struct {
+    int w;
+    int h;
+    int stride;         //h rounded up to 4 bytes, 1 for a single row
+    int flags;
+    int8_t *exponent;   //one per column, or one with DL_MQ8_PER_TENSOR
+    q8tp_t *item;
+} dl_matrix2dq8_t;
+
+#define DL_ITMQ8(m, x, y) m->item[(y)+(x)*m->stride]
+
+static inline int dl_matrixq8_exp(const dl_matrix2dq8_t *m, int x)
+{
+    return m->exponent[(m->flags & DL_MQ8_PER_TENSOR) ? 0 : x];
+}
+
+/**
+ * @brief Allocate a matrix, zeroed
+ *
+ * @param per_tensor One exponent for the matrix instead of one per column
+ * @return The matrix, or NULL if out of memory
+ */
+dl_matrix2dq8_t *dl_matrixq8_alloc(int w, int h, int per_tensor);
+
+void dl_matrixq8_free(dl_matrix2dq8_t *m);
+
+/**
+ * @brief Requantize a 16 bit matrix, e.g. weights of dl_matrixq_from_matrix2d_by_qmf, to 8 bits.
+ *        Each column (or the whole matrix with per_tensor) is shifted down so its largest item fits, rounding
+ *        to nearest.
+ *
+ * @param out Matrix of the same shape to re-use, with the same per_tensor. If NULL, allocate a new one.
+ * @return The 8 bit matrix, NULL if out of memory or out does not fit
+ */
+dl_matrix2dq8_t *dl_matrixq8_from_matrixq(const dl_matrix2dq_t *m, dl_matrix2dq8_t *out, int per_tensor);
+
+/**
+ * @brief Quantize a floating-point matrix to 8 bits, exponents picked from the largest magnitude as above.
+ */
+dl_matrix2dq8_t *dl_matrixq8_from_matrix2d(const dl_matrix2d_t *m, dl_matrix2dq8_t *out, int per_tensor);
+
+/**
+ * @brief res=a.b, with a per tensor (activations) and b per column (weights). Products are summed exactly,
+ *        each output item is rounded once. The shift argument has the meaning of dl_matrixq_dot: 0 picks
+ *        an exponent for res at which no item can overflow, each step above it trades a bit of headroom for
+ *        a bit of precision and clips what does not fit.
+ *
+ * @param res Allocated b->w by a->h
+ */
+void dl_matrixq8_dot(const dl_matrix2dq8_t *a, const dl_matrix2dq8_t *b, dl_matrix2dq_t *res, int shift);
+
+/**
+ * @brief res=a.b as dl_matrixq8_dot, into a floating-point matrix, for the last layer.
+ */
+void dl_matrixq8_dot_matrix_out(const dl_matrix2dq8_t *a, const dl_matrix2dq8_t *b, dl_matrix2d_t *res);
+
+/**
+ * @brief Signal to quantization noise ratio of q against the 16 bit matrix it was made from, in dB.
+ *        A model loader can keep the 16 bit version of a layer that loses too much.
+ */
+float dl_matrixq8_snr_db(const dl_matrix2dq_t *m, const dl_matrix2dq8_t *q);
+
+#endif
@@ -5,116 +5,96 @@
 #include "freertos/task.h"
 
 #include "audio_process.h"
-#include "esp_ns.h"
-#include "esp_aec.h"
-#include "esp_agc.h"
-#include "esp_vad.h"
-#include "audio_test_file.h"
+#include "esp_afe.h"
+#include "esp_aec_ref.h"
+#include "sr_corpus.h"
 
-void NSTask(void *arg)
-{
-    ns_handle_t ns_inst = ns_create(NS_FRAME_LENGTH_MS);
-    int chunks = 0;
-    int audio_chunksize = NS_FRAME_LENGTH_MS * 16;
-    int16_t *ns_in = malloc(audio_chunksize * sizeof(int16_t));
-    int16_t *ns_out = malloc(audio_chunksize * sizeof(int16_t));
-    while (1) {
-        if ((chunks + 1) * audio_chunksize * sizeof(int16_t) <= sizeof(audio_test_file)) {
-            memcpy(ns_in, audio_test_file + chunks * audio_chunksize * sizeof(int16_t), audio_chunksize * sizeof(int16_t));
-        } else {
-            break;
-        }
-        ns_process(ns_inst, ns_in, ns_out);
-        chunks++;
-    }
-    ns_destroy(ns_inst);
-    free(ns_in);
-    free(ns_out);
-    printf("NS test successfully\n\n");
-    vTaskDelete(NULL);    
-}
+#define AFE_ECHO_SHIFT      2       // the simulated echo reaches the mic at a quarter of the playback level
+#define AFE_ECHO_DELAY      (30 * AFE_SAMPLE_RATE / 1000)   // and 30ms after it was written out
 
-#define AGC_FRAME_BYTES     320
-void AGCTask(void *arg)
-{
-    void *agc_handle = esp_agc_open(3, 16000);
-    set_agc_config(agc_handle, 15, 1, -3);
-    int chunks = 0;
-    int16_t *agc_in  = malloc(AGC_FRAME_BYTES);
-    int16_t *agc_out = malloc(AGC_FRAME_BYTES);
-    while (1) {
-        if ((chunks + 1) * AGC_FRAME_BYTES <= sizeof(audio_test_file)) {
-            memcpy(agc_in, audio_test_file + chunks * AGC_FRAME_BYTES, AGC_FRAME_BYTES);
-        } else {
-            break;
-        }
-        esp_agc_process(agc_handle, agc_in, agc_out, AGC_FRAME_BYTES / 2, 16000);
-        chunks++;
-    }
-    esp_agc_clse(agc_handle);
-    free(agc_in);
-    free(agc_out);
-    printf("AGC test successfully\n\n");
-    vTaskDelete(NULL);    
-}
+typedef struct {
+    sr_corpus_reader_t speech;
+    sr_corpus_reader_t play;
+    aec_ref_handle_t aec_ref;
+    int64_t time;                                       // simulated time of the frame, us
+    int16_t out[AFE_ECHO_DELAY + AFE_FRAME_SAMPLES];    // playback, the last AFE_ECHO_DELAY samples still in the air
+} afe_test_stream_t;
 
-void AECTask(void *arg)
+/*
+ * The mic hears the test speech plus the delayed echo of what is being played. The playback is the other
+ * half of the same clip, tapped as it goes out and aligned to the mic by aec_ref for the AEC
+ */
+static int afe_fill_frame(afe_handle_t afe, afe_test_stream_t *stream)
 {
-    aec_handle_t aec_inst = aec_create(AEC_SAMPLE_RATE, AEC_FRAME_LENGTH_MS, AEC_FILTER_LENGTH);
-    int chunks = 0;
-    int audio_chunksize = AEC_FRAME_LENGTH_MS * 16;
-    int16_t *aec_in = malloc(audio_chunksize * sizeof(int16_t));
-    int16_t *aec_ref = malloc(audio_chunksize * sizeof(int16_t));
-    int16_t *aec_out = malloc(audio_chunksize * sizeof(int16_t));
-    while (1) {
-        if ((chunks + 1) * audio_chunksize * sizeof(int16_t) <= sizeof(audio_test_file)) {
-            memcpy(aec_in, audio_test_file + chunks * audio_chunksize * sizeof(int16_t), audio_chunksize * sizeof(int16_t));
-            memset(aec_ref, 0, audio_chunksize * sizeof(int16_t));
-        } else {
-            break;
+    int16_t *mic = afe_get_mic_buffer(afe);
+    int16_t *play = stream->out + AFE_ECHO_DELAY;
+
+    if (sr_corpus_reader_read(&stream->speech, mic, AFE_FRAME_SAMPLES) != AFE_FRAME_SAMPLES) {
+        return 0;
+    }
+    memmove(stream->out, stream->out + AFE_FRAME_SAMPLES, AFE_ECHO_DELAY * sizeof(int16_t));
+    for (int got = 0; got < AFE_FRAME_SAMPLES;) {
+        int n = sr_corpus_reader_read(&stream->play, play + got, AFE_FRAME_SAMPLES - got);
+        if (n <= 0) {
+            if (n < 0 || stream->play.pos == 0) {
+                return 0;
+            }
+            sr_corpus_reader_seek(&stream->play, 0);
+            continue;
         }
-        aec_process(aec_inst, aec_in, aec_ref, aec_out);
-        chunks++;
+        got += n;
+    }
+    aec_ref_write(stream->aec_ref, play, AFE_FRAME_SAMPLES, stream->time);
+    for (int i = 0; i < AFE_FRAME_SAMPLES; i++) {
+        int32_t m = mic[i] + (stream->out[i] >> AFE_ECHO_SHIFT);
+        mic[i] = m > INT16_MAX ? INT16_MAX : (m < INT16_MIN ? INT16_MIN : m);
     }
-    aec_destroy(aec_inst);
-    free(aec_in);
-    free(aec_ref);
-    free(aec_out);
-    printf("AEC test successfully\n\n");
-    vTaskDelete(NULL);    
+    aec_ref_align(stream->aec_ref, mic, afe_get_ref_buffer(afe), AFE_FRAME_SAMPLES, stream->time);
+    stream->time += AFE_FRAME_LENGTH_MS * 1000;
+    return 1;
 }
 
-void VADTask(void *arg)
+void AFETask(void *arg)
 {
-    vad_handle_t vad_inst = vad_create(VAD_MODE_4, SAMPLE_RATE_HZ, VAD_FRAME_LENGTH_MS);
+    afe_config_t cfg = AFE_CONFIG_DEFAULT();
+    afe_handle_t afe = afe_create(&cfg);
+    afe_test_stream_t *stream = calloc(1, sizeof(afe_test_stream_t));
+    aec_ref_config_t ref_cfg = AEC_REF_CONFIG_DEFAULT();
+    ref_cfg.channels = 1;
+    aec_ref_handle_t aec_ref = aec_ref_create(&ref_cfg);
+    const sr_corpus_clip_t *clip = sr_corpus_find("audio_test_file");
     int chunks = 0;
-    int audio_chunksize = VAD_FRAME_LENGTH_MS * 16;
-    int16_t *vad_in = malloc(audio_chunksize * sizeof(int16_t));
-    while (1) {
-        if ((chunks + 1) * audio_chunksize * sizeof(int16_t) <= sizeof(audio_test_file)) {
-            memcpy(vad_in, audio_test_file + chunks * audio_chunksize * sizeof(int16_t), audio_chunksize * sizeof(int16_t));
-        } else {
-            break;
+    int speech_frames = 0;
+    if (afe == NULL || stream == NULL || aec_ref == NULL || clip == NULL) {
+        printf("AFE test setup failed\n\n");
+        afe_destroy(afe);
+        aec_ref_destroy(aec_ref);
+        free(stream);
+        vTaskDelete(NULL);
+    }
+    stream->aec_ref = aec_ref;
+    sr_corpus_reader_init(&stream->speech, clip);
+    sr_corpus_reader_init(&stream->play, clip);
+    sr_corpus_reader_seek(&stream->play, clip->size / 2 & ~1);
+    while (afe_fill_frame(afe, stream)) {
+        vad_state_t vad_state;
+        afe_process(afe, &vad_state);
+        if (vad_state == VAD_SPEECH) {
+            speech_frames++;
         }
-        vad_state_t vad_state = vad_process(vad_inst, vad_in);
         chunks++;
     }
-    vad_destroy(vad_inst);
-    free(vad_in);
-    printf("VAD test successfully\n\n");
+    float corr;
+    int delay_us = aec_ref_get_delay(aec_ref, &corr);
+    afe_destroy(afe);
+    aec_ref_destroy(aec_ref);
+    free(stream);
+    printf("AFE test successfully, %d of %d frames with speech, echo delay %d us (corr %.2f)\n\n", speech_frames, chunks, delay_us, corr);
     printf("TEST3 FINISHED\n\n");
-    vTaskDelete(NULL);    
+    vTaskDelete(NULL);
 }
 
-
-
 void audio_process_test()
 {
-    xTaskCreatePinnedToCore(&NSTask, "noise_suppression", 3 * 1024, NULL, 5, NULL, 1);
-    vTaskDelay(1000 / portTICK_PERIOD_MS);
-    xTaskCreatePinnedToCore(&AGCTask, "automatic_gain_control", 3 * 1024, NULL, 5, NULL, 1);
-    vTaskDelay(1000 / portTICK_PERIOD_MS);
-    xTaskCreatePinnedToCore(&AECTask, "acoustic_echo_cancellation", 3 * 1024, NULL, 5, NULL, 0);
-    vTaskDelay(1000 / portTICK_PERIOD_MS);
-    xTaskCreatePinnedToCore(&VADTask, "voice_activity_detection", 3 * 1024, NULL, 5, NULL, 0);
+    xTaskCreatePinnedToCore(&AFETask, "audio_front_end", 4 * 1024, NULL, 5, NULL, 0);
 }
@@ -1,4985 +0,0 @@
-#include <stdio.h>
-const unsigned char dakaidiandeng[] = {
-    0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 
-    0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 
-    0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 
-    0xD3, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x20, 0x00, 0x20, 0x00, 0x2B, 0x00, 0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x15, 0x00, 
-    0x20, 0x00, 0x20, 0x00, 0x15, 0x00, 0x2B, 0x00, 0x20, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x2B, 0x00, 
-    0x37, 0x00, 0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 
-    0xDE, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-    0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 
-    0xDE, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 
-    0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 
-    0xD3, 0xFF, 0xD3, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 
-    0x2B, 0x00, 0x20, 0x00, 0x37, 0x00, 0x2B, 0x00, 0x37, 0x00, 0x37, 0x00, 0x42, 0x00, 0x4D, 0x00, 
-    0x42, 0x00, 0x42, 0x00, 0x4D, 0x00, 0x4D, 0x00, 0x58, 0x00, 0x58, 0x00, 0x58, 0x00, 0x58, 0x00, 
-    0x64, 0x00, 0x64, 0x00, 0x4D, 0x00, 0x4D, 0x00, 0x37, 0x00, 0x42, 0x00, 0x4D, 0x00, 0x37, 0x00, 
-    0x4D, 0x00, 0x2B, 0x00, 0x42, 0x00, 0x2B, 0x00, 0x37, 0x00, 0x2B, 0x00, 0x37, 0x00, 0x37, 0x00, 
-    0x2B, 0x00, 0x37, 0x00, 0x37, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xF4, 0xFF, 
-    0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 
-    0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xDE, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 0xC7, 0xFF, 
-    0xC7, 0xFF, 0xB1, 0xFF, 0xBC, 0xFF, 0xB1, 0xFF, 0xB1, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 
-    0xC7, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xDE, 0xFF, 
-    0xD3, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 
-    0xDE, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0xDE, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 
-    0xDE, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x20, 0x00, 
-    0x2C, 0x00, 0x37, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x2C, 0x00, 
-    0x20, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 
-    0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x42, 0x00, 0x42, 0x00, 0x37, 0x00, 
-    0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x37, 0x00, 0x42, 0x00, 0x37, 0x00, 0x42, 0x00, 
-    0x2C, 0x00, 0x37, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 
-    0x42, 0x00, 0x37, 0x00, 0x42, 0x00, 0x42, 0x00, 0x37, 0x00, 0x4E, 0x00, 0x42, 0x00, 0x42, 0x00, 
-    0x37, 0x00, 0x20, 0x00, 0x20, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x2C, 0x00, 
-    0x37, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x37, 0x00, 
-    0x37, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x2C, 0x00, 
-    0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 
-    0x21, 0x00, 0x2C, 0x00, 0x15, 0x00, 0x21, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 
-    0xC7, 0xFF, 0xC7, 0xFF, 0xBB, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 0xA5, 0xFF, 
-    0xB0, 0xFF, 0xB0, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 0xB0, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 
-    0xB0, 0xFF, 0xB0, 0xFF, 0xB0, 0xFF, 0xBB, 0xFF, 0xB0, 0xFF, 0xA5, 0xFF, 0xA5, 0xFF, 0xA5, 0xFF, 
-    0xA5, 0xFF, 0x8E, 0xFF, 0x99, 0xFF, 0x99, 0xFF, 0xA5, 0xFF, 0x8E, 0xFF, 0x99, 0xFF, 0x99, 0xFF, 
-    0xA5, 0xFF, 0xA5, 0xFF, 0xB0, 0xFF, 0xA5, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 
-    0xBB, 0xFF, 0xD2, 0xFF, 0xBB, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 
-    0xE9, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xD2, 0xFF, 0xE9, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 
-    0xDD, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x21, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x21, 0x00, 0x21, 0x00, 0x15, 0x00, 
-    0x21, 0x00, 0x21, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x21, 0x00, 0x21, 0x00, 
-    0x21, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x21, 0x00, 
-    0x2C, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x43, 0x00, 0x37, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x4E, 0x00, 
-    0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x43, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 
-    0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x15, 0x00, 0x15, 0x00, 0x00, 0x00, 
-    0x0A, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 
-    0xC7, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 
-    0xC7, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x2C, 0x00, 
-    0x2C, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x20, 0x00, 
-    0x20, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x20, 0x00, 0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x2C, 0x00, 
-    0x37, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x37, 0x00, 0x42, 0x00, 0x37, 0x00, 
-    0x42, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x2C, 0x00, 
-    0x2C, 0x00, 0x20, 0x00, 0x20, 0x00, 0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 
-    0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x15, 0x00, 0xF4, 0xFF, 0x00, 0x00, 
-    0xE9, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xDE, 0xFF, 0xDE, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xB1, 0xFF, 
-    0xBC, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 
-    0xBC, 0xFF, 0xBC, 0xFF, 0xB1, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 
-    0xBC, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 
-    0xD3, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x15, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x37, 0x00, 0x37, 0x00, 0x2B, 0x00, 
-    0x37, 0x00, 0x37, 0x00, 0x42, 0x00, 0x42, 0x00, 0x37, 0x00, 0x37, 0x00, 0x2B, 0x00, 0x37, 0x00, 
-    0x2B, 0x00, 0x37, 0x00, 0x2B, 0x00, 0x37, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x20, 0x00, 
-    0x2B, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x20, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 
-    0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 
-    0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x0A, 0x00, 
-    0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 
-    0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 
-    0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xC7, 0xFF, 
-    0xD3, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 
-    0xDE, 0xFF, 0xD3, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x2B, 0x00, 
-    0x37, 0x00, 0x2B, 0x00, 0x20, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x37, 0x00, 0x2B, 0x00, 0x20, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x2B, 0x00, 
-    0x2B, 0x00, 0x2B, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x42, 0x00, 0x42, 0x00, 
-    0x37, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x20, 0x00, 
-    0x20, 0x00, 0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0x00, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 0xB1, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 
-    0xC7, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 
-    0xB1, 0xFF, 0xA6, 0xFF, 0xB1, 0xFF, 0xA6, 0xFF, 0xBC, 0xFF, 0xA6, 0xFF, 0xB1, 0xFF, 0xA6, 0xFF, 
-    0xB1, 0xFF, 0xB1, 0xFF, 0xB1, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 
-    0xBC, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 
-    0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 
-    0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x20, 0x00, 0x37, 0x00, 0x2B, 0x00, 0x37, 0x00, 
-    0x37, 0x00, 0x42, 0x00, 0x4D, 0x00, 0x58, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x4D, 0x00, 
-    0x4D, 0x00, 0x42, 0x00, 0x42, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 
-    0x2B, 0x00, 0x2B, 0x00, 0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x20, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x2B, 0x00, 
-    0x2B, 0x00, 0x20, 0x00, 0x20, 0x00, 0x15, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x20, 0x00, 0x20, 0x00, 
-    0x20, 0x00, 0x20, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x15, 0x00, 
-    0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0x0A, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x20, 0x00, 
-    0x2B, 0x00, 0x37, 0x00, 0x37, 0x00, 0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 
-    0xDE, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 0xB1, 0xFF, 0xB1, 0xFF, 0xBC, 0xFF, 
-    0xB1, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xB1, 0xFF, 0xB1, 0xFF, 0xA5, 0xFF, 0xB1, 0xFF, 0xBC, 0xFF, 
-    0xC7, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 0xB1, 0xFF, 0xBC, 0xFF, 
-    0xC7, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 
-    0x2C, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x2C, 0x00, 
-    0x20, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x15, 0x00, 0x20, 0x00, 
-    0x20, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 
-    0xDE, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0x0A, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x37, 0x00, 0x37, 0x00, 0x42, 0x00, 
-    0x42, 0x00, 0x42, 0x00, 0x4D, 0x00, 0x4D, 0x00, 0x64, 0x00, 0x4D, 0x00, 0x59, 0x00, 0x42, 0x00, 
-    0x59, 0x00, 0x64, 0x00, 0x59, 0x00, 0x64, 0x00, 0x59, 0x00, 0x64, 0x00, 0x4D, 0x00, 0x59, 0x00, 
-    0x4D, 0x00, 0x6F, 0x00, 0x59, 0x00, 0x64, 0x00, 0x42, 0x00, 0x42, 0x00, 0x37, 0x00, 0x37, 0x00, 
-    0x37, 0x00, 0x42, 0x00, 0x37, 0x00, 0x37, 0x00, 0x42, 0x00, 0x37, 0x00, 0x37, 0x00, 0x2C, 0x00, 
-    0x2C, 0x00, 0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 0xBC, 0xFF, 
-    0xA6, 0xFF, 0xB1, 0xFF, 0xB1, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 
-    0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xBC, 0xFF, 
-    0xC7, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 
-    0xC7, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x20, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x42, 0x00, 0x37, 0x00, 0x2C, 0x00, 
-    0x20, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 
-    0x20, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x0A, 0x00, 
-    0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 
-    0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 
-    0xC7, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 
-    0xC7, 0xFF, 0xDE, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xD2, 0xFF, 
-    0xDE, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xC7, 0xFF, 
-    0xD2, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 
-    0xC7, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xDE, 0xFF, 0x00, 0x00, 0xE9, 0xFF, 0x0A, 0x00, 
-    0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x2C, 0x00, 
-    0x37, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x37, 0x00, 0x42, 0x00, 0x4E, 0x00, 0x59, 0x00, 0x59, 0x00, 
-    0x64, 0x00, 0x64, 0x00, 0x59, 0x00, 0x59, 0x00, 0x4E, 0x00, 0x59, 0x00, 0x59, 0x00, 0x6F, 0x00, 
-    0x59, 0x00, 0x6F, 0x00, 0x64, 0x00, 0x6F, 0x00, 0x64, 0x00, 0x64, 0x00, 0x64, 0x00, 0x59, 0x00, 
-    0x59, 0x00, 0x59, 0x00, 0x59, 0x00, 0x59, 0x00, 0x4E, 0x00, 0x42, 0x00, 0x42, 0x00, 0x37, 0x00, 
-    0x2C, 0x00, 0x20, 0x00, 0x20, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 
-    0xD2, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xC7, 0xFF, 
-    0xDE, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 
-    0xDE, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0x0A, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 
-    0xD2, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 
-    0xC7, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 
-    0xD2, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 
-    0xD2, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xF4, 0xFF, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 
-    0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x20, 0x00, 
-    0x20, 0x00, 0x20, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0x0A, 0x00, 
-    0x00, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x15, 0x00, 0x00, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 
-    0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 
-    0x2B, 0x00, 0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x15, 0x00, 0x20, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 0x0A, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 
-    0x15, 0x00, 0x20, 0x00, 0x2B, 0x00, 0x37, 0x00, 0x20, 0x00, 0x2B, 0x00, 0x37, 0x00, 0x37, 0x00, 
-    0x4D, 0x00, 0x4D, 0x00, 0x4D, 0x00, 0x4D, 0x00, 0x42, 0x00, 0x42, 0x00, 0x37, 0x00, 0x37, 0x00, 
-    0x2B, 0x00, 0x37, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x15, 0x00, 0x20, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x20, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xF4, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x0A, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xD3, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xD3, 0xFF, 0xD3, 0xFF, 0xBC, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xDE, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 
-    0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 
-    0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xF4, 0xFF, 0xDE, 0xFF, 
-    0xE9, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 
-    0xD3, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 
-    0x00, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 
-    0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xF4, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x20, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 
-    0x20, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x20, 0x00, 0x20, 0x00, 
-    0x20, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x2B, 0x00, 0x20, 0x00, 
-    0x20, 0x00, 0x20, 0x00, 0x2B, 0x00, 0x15, 0x00, 0x2B, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 
-    0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x37, 0x00, 0x2B, 0x00, 
-    0x2B, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 
-    0xD3, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 
-    0xD3, 0xFF, 0xDE, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 
-    0xD3, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 
-    0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 
-    0xDE, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 
-    0xDE, 0xFF, 0xD3, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 
-    0xD3, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 
-    0xDE, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 
-    0xDE, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x20, 0x00, 0x20, 0x00, 0x37, 0x00, 0x37, 0x00, 0x2B, 0x00, 0x20, 0x00, 0x20, 0x00, 
-    0x2B, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xF4, 0xFF, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x20, 0x00, 0x2B, 0x00, 
-    0x37, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x20, 0x00, 0x20, 0x00, 
-    0x20, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 
-    0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0x0A, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x2B, 0x00, 0x37, 0x00, 0x42, 0x00, 0x42, 0x00, 
-    0x42, 0x00, 0x4D, 0x00, 0x42, 0x00, 0x4D, 0x00, 0x4D, 0x00, 0x4D, 0x00, 0x4D, 0x00, 0x42, 0x00, 
-    0x4D, 0x00, 0x4D, 0x00, 0x4D, 0x00, 0x42, 0x00, 0x4D, 0x00, 0x37, 0x00, 0x37, 0x00, 0x20, 0x00, 
-    0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x2B, 0x00, 0x20, 0x00, 
-    0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 
-    0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x0A, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 
-    0xDE, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 
-    0xD3, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 
-    0xBC, 0xFF, 0xB1, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 0xB1, 0xFF, 0xBC, 0xFF, 
-    0xB1, 0xFF, 0xBC, 0xFF, 0xB1, 0xFF, 0xB1, 0xFF, 0xB1, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 
-    0xDE, 0xFF, 0xD3, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 
-    0xD3, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 
-    0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x20, 0x00, 0x2B, 0x00, 0x37, 0x00, 0x2B, 0x00, 0x2B, 0x00, 
-    0x2B, 0x00, 0x20, 0x00, 0x2B, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x2B, 0x00, 0x37, 0x00, 
-    0x37, 0x00, 0x42, 0x00, 0x42, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x42, 0x00, 0x37, 0x00, 
-    0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x42, 0x00, 0x37, 0x00, 0x42, 0x00, 0x20, 0x00, 0x20, 0x00, 
-    0x15, 0x00, 0x20, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x20, 0x00, 0x20, 0x00, 0x15, 0x00, 0x2B, 0x00, 
-    0x20, 0x00, 0x20, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x20, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 
-    0x20, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0xD3, 0xFF, 0xDE, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 
-    0xD3, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 0xBC, 0xFF, 
-    0xC7, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 
-    0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 
-    0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x2B, 0x00, 0x20, 0x00, 0x2B, 0x00, 0x20, 0x00, 
-    0x20, 0x00, 0x20, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x37, 0x00, 0x2B, 0x00, 
-    0x37, 0x00, 0x2B, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x42, 0x00, 0x2B, 0x00, 0x2B, 0x00, 
-    0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x20, 0x00, 0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x0A, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0xDE, 0xFF, 0xD3, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xDE, 0xFF, 0xD3, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 
-    0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x37, 0x00, 0x2B, 0x00, 0x20, 0x00, 
-    0x20, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 
-    0x2B, 0x00, 0x20, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x20, 0x00, 0x15, 0x00, 0x20, 0x00, 
-    0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x2B, 0x00, 0x42, 0x00, 0x37, 0x00, 0x4D, 0x00, 0x37, 0x00, 
-    0x42, 0x00, 0x42, 0x00, 0x37, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x37, 0x00, 0x37, 0x00, 
-    0x2B, 0x00, 0x20, 0x00, 0x20, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xFF, 
-    0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 
-    0xDE, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 
-    0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 
-    0xD2, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 
-    0xD2, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 
-    0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x37, 0x00, 
-    0x2C, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x20, 0x00, 0x20, 0x00, 0x0A, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x20, 0x00, 
-    0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x2C, 0x00, 
-    0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x2C, 0x00, 
-    0x20, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 
-    0x20, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 
-    0x20, 0x00, 0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x20, 0x00, 
-    0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 
-    0xDE, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 
-    0xD2, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 
-    0xDE, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 
-    0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 
-    0xDD, 0xFF, 0xD2, 0xFF, 0xBB, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xC7, 0xFF, 
-    0xC7, 0xFF, 0xBB, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xB0, 0xFF, 0xC7, 0xFF, 0xB0, 0xFF, 
-    0xB0, 0xFF, 0x99, 0xFF, 0x99, 0xFF, 0x99, 0xFF, 0x99, 0xFF, 0x99, 0xFF, 0x99, 0xFF, 0x8E, 0xFF, 
-    0x99, 0xFF, 0x8E, 0xFF, 0x99, 0xFF, 0x99, 0xFF, 0x83, 0xFF, 0x8E, 0xFF, 0x8E, 0xFF, 0x99, 0xFF, 
-    0x99, 0xFF, 0xB0, 0xFF, 0xBB, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 
-    0xBB, 0xFF, 0xC7, 0xFF, 0xBB, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 
-    0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x2C, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 
-    0x37, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x4E, 0x00, 
-    0x4E, 0x00, 0x43, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 
-    0x43, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x43, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 
-    0x37, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 
-    0x37, 0x00, 0x37, 0x00, 0x43, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x21, 0x00, 0x21, 0x00, 
-    0x2C, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xE9, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x2C, 0x00, 
-    0x37, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 
-    0x42, 0x00, 0x42, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 
-    0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 
-    0xC7, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 
-    0xDE, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 
-    0xC7, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 
-    0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xDE, 0xFF, 
-    0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x20, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x37, 0x00, 0x42, 0x00, 
-    0x42, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x42, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x42, 0x00, 0x42, 0x00, 
-    0x42, 0x00, 0x42, 0x00, 0x4E, 0x00, 0x42, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 
-    0x2C, 0x00, 0x20, 0x00, 0x20, 0x00, 0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x37, 0x00, 0x2C, 0x00, 
-    0x2C, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x20, 0x00, 0x15, 0x00, 
-    0x20, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x15, 0x00, 0x20, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 
-    0xC7, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xA5, 0xFF, 0xB0, 0xFF, 
-    0xA5, 0xFF, 0xA5, 0xFF, 0xA5, 0xFF, 0xB0, 0xFF, 0xBC, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 
-    0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 
-    0xDE, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 0xA5, 0xFF, 0xA5, 0xFF, 0xA5, 0xFF, 0xA5, 0xFF, 
-    0xA5, 0xFF, 0xA5, 0xFF, 0x9A, 0xFF, 0xB1, 0xFF, 0xB1, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 
-    0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 0x20, 0x00, 
-    0x20, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x42, 0x00, 
-    0x37, 0x00, 0x42, 0x00, 0x42, 0x00, 0x37, 0x00, 0x42, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x20, 0x00, 
-    0x20, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x2C, 0x00, 
-    0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 
-    0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x20, 0x00, 
-    0x20, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x42, 0x00, 0x2C, 0x00, 
-    0x37, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 
-    0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 
-    0xD3, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 
-    0xDE, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x2B, 0x00, 0x20, 0x00, 
-    0x20, 0x00, 0x20, 0x00, 0x2B, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x20, 0x00, 0x2B, 0x00, 
-    0x2B, 0x00, 0x2B, 0x00, 0x37, 0x00, 0x37, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x20, 0x00, 0x2B, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 
-    0xD3, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 0xA6, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 
-    0xD3, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 
-    0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 
-    0xD3, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xC7, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 
-    0xDE, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x20, 0x00, 0x20, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 
-    0xF4, 0xFF, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x0A, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0xF4, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xDE, 0xFF, 0xE9, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0xDE, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 
-    0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x2B, 0x00, 0x2B, 0x00, 
-    0x2B, 0x00, 0x20, 0x00, 0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x20, 0x00, 
-    0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xD2, 0xFF, 
-    0xD2, 0xFF, 0xD2, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x0A, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 
-    0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 
-    0xDE, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 
-    0x2C, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x2C, 0x00, 
-    0x2C, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x21, 0x00, 
-    0x37, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 
-    0x2C, 0x00, 0x2C, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x37, 0x00, 
-    0x37, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x21, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 
-    0xDD, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xBB, 0xFF, 
-    0xBB, 0xFF, 0xB0, 0xFF, 0xA5, 0xFF, 0xB0, 0xFF, 0xA5, 0xFF, 0xA5, 0xFF, 0x8E, 0xFF, 0x8E, 0xFF, 
-    0x82, 0xFF, 0x82, 0xFF, 0x8E, 0xFF, 0x82, 0xFF, 0x99, 0xFF, 0x99, 0xFF, 0xA5, 0xFF, 0xA5, 0xFF, 
-    0xB0, 0xFF, 0xB0, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xB0, 0xFF, 0xB0, 0xFF, 0xB0, 0xFF, 
-    0xB0, 0xFF, 0xC7, 0xFF, 0xBB, 0xFF, 0xC7, 0xFF, 0xBB, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 
-    0xD2, 0xFF, 0xD2, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x21, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x2C, 0x00, 
-    0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 
-    0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x38, 0x00, 0x37, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x2C, 0x00, 
-    0x37, 0x00, 0x37, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x5A, 0x00, 0x65, 0x00, 0x65, 0x00, 0x5A, 0x00, 
-    0x4E, 0x00, 0x5A, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x43, 0x00, 0x43, 0x00, 0x5A, 0x00, 
-    0x4E, 0x00, 0x5A, 0x00, 0x65, 0x00, 0x65, 0x00, 0x5A, 0x00, 0x5A, 0x00, 0x5A, 0x00, 0x4E, 0x00, 
-    0x4E, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x43, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x21, 0x00, 
-    0x2C, 0x00, 0x21, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 
-    0xC7, 0xFF, 0xBB, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0x00, 0x00, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x2C, 0x00, 0x20, 0x00, 
-    0x20, 0x00, 0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 
-    0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 
-    0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 0x0A, 0x00, 
-    0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x20, 0x00, 0x15, 0x00, 0x20, 0x00, 0x2B, 0x00, 0x20, 0x00, 0x20, 0x00, 0x2B, 0x00, 0x15, 0x00, 
-    0x20, 0x00, 0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xC7, 0xFF, 
-    0xC7, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xB1, 0xFF, 0xB1, 0xFF, 0xA6, 0xFF, 0xA6, 0xFF, 0xB1, 0xFF, 
-    0xB1, 0xFF, 0xA6, 0xFF, 0xB1, 0xFF, 0xA6, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 
-    0xBC, 0xFF, 0xBC, 0xFF, 0xB1, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 
-    0xC7, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 
-    0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 
-    0xDE, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 
-    0x37, 0x00, 0x37, 0x00, 0x42, 0x00, 0x42, 0x00, 0x4D, 0x00, 0x4D, 0x00, 0x59, 0x00, 0x59, 0x00, 
-    0x59, 0x00, 0x59, 0x00, 0x59, 0x00, 0x4D, 0x00, 0x4D, 0x00, 0x4E, 0x00, 0x37, 0x00, 0x4E, 0x00, 
-    0x4E, 0x00, 0x4E, 0x00, 0x42, 0x00, 0x42, 0x00, 0x37, 0x00, 0x42, 0x00, 0x4E, 0x00, 0x4E, 0x00, 
-    0x4E, 0x00, 0x42, 0x00, 0x37, 0x00, 0x42, 0x00, 0x42, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x59, 0x00, 
-    0x4E, 0x00, 0x59, 0x00, 0x42, 0x00, 0x42, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x42, 0x00, 
-    0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x2C, 0x00, 
-    0x37, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x20, 0x00, 
-    0x15, 0x00, 0x20, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xE9, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 
-    0xC7, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xBB, 0xFF, 0xB0, 0xFF, 0xB0, 0xFF, 
-    0xBB, 0xFF, 0xB0, 0xFF, 0xB0, 0xFF, 0xB0, 0xFF, 0xB0, 0xFF, 0xB0, 0xFF, 0xA5, 0xFF, 0xA5, 0xFF, 
-    0x99, 0xFF, 0x8E, 0xFF, 0x99, 0xFF, 0xA5, 0xFF, 0xA5, 0xFF, 0xB0, 0xFF, 0xA5, 0xFF, 0x99, 0xFF, 
-    0xB0, 0xFF, 0xB0, 0xFF, 0xC7, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 
-    0xC7, 0xFF, 0xC7, 0xFF, 0xBB, 0xFF, 0xC7, 0xFF, 0xBB, 0xFF, 0xC7, 0xFF, 0xBB, 0xFF, 0xC7, 0xFF, 
-    0xC7, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xBB, 0xFF, 0xC7, 0xFF, 0xBB, 0xFF, 0xC7, 0xFF, 
-    0xBB, 0xFF, 0xC7, 0xFF, 0xB0, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 
-    0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xF4, 0xFF, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0x0A, 0x00, 0x15, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x2C, 0x00, 
-    0x37, 0x00, 0x43, 0x00, 0x4E, 0x00, 0x43, 0x00, 0x4E, 0x00, 0x43, 0x00, 0x37, 0x00, 0x43, 0x00, 
-    0x4E, 0x00, 0x43, 0x00, 0x4E, 0x00, 0x43, 0x00, 0x38, 0x00, 0x38, 0x00, 0x43, 0x00, 0x43, 0x00, 
-    0x38, 0x00, 0x21, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xFF, 
-    0xDD, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 
-    0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x21, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x21, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xD2, 0xFF, 0xC6, 0xFF, 
-    0xC6, 0xFF, 0xD2, 0xFF, 0xC6, 0xFF, 0xD2, 0xFF, 0xC6, 0xFF, 0xC6, 0xFF, 0xC6, 0xFF, 0xBB, 0xFF, 
-    0xBB, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 0xC6, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 
-    0xD2, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 
-    0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 
-    0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x00, 0x00, 0x21, 0x00, 0x21, 0x00, 0x15, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x43, 0x00, 0x37, 0x00, 
-    0x43, 0x00, 0x43, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x43, 0x00, 0x5A, 0x00, 
-    0x4E, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x5A, 0x00, 0x5A, 0x00, 0x5A, 0x00, 0x4E, 0x00, 0x5A, 0x00, 
-    0x43, 0x00, 0x5A, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x43, 0x00, 0x43, 0x00, 0x37, 0x00, 0x2C, 0x00, 
-    0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x43, 0x00, 0x37, 0x00, 0x37, 0x00, 0x4E, 0x00, 
-    0x37, 0x00, 0x43, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x21, 0x00, 
-    0x21, 0x00, 0x15, 0x00, 0x21, 0x00, 0x21, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 
-    0xDD, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xDD, 0xFF, 0xC7, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xE9, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 
-    0xD2, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xBB, 0xFF, 
-    0xBB, 0xFF, 0xBB, 0xFF, 0xB0, 0xFF, 0xB0, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 0xB0, 0xFF, 0xC7, 0xFF, 
-    0xC7, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xBB, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 
-    0xD2, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xF4, 0xFF, 
-    0x0A, 0x00, 0x15, 0x00, 0x21, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x37, 0x00, 
-    0x43, 0x00, 0x37, 0x00, 0x43, 0x00, 0x43, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x43, 0x00, 
-    0x43, 0x00, 0x4E, 0x00, 0x37, 0x00, 0x43, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x37, 0x00, 
-    0x43, 0x00, 0x37, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x21, 0x00, 0x37, 0x00, 0x37, 0x00, 0x2C, 0x00, 
-    0x2C, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x43, 0x00, 0x37, 0x00, 0x4E, 0x00, 0x43, 0x00, 
-    0x43, 0x00, 0x4E, 0x00, 0x37, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x65, 0x00, 0x59, 0x00, 0x59, 0x00, 
-    0x59, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x43, 0x00, 0x37, 0x00, 0x37, 0x00, 0x2C, 0x00, 
-    0x2C, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 
-    0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xE9, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x15, 0x00, 0x15, 0x00, 0x21, 0x00, 
-    0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x21, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xDD, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 
-    0xBB, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xB0, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 0xC7, 0xFF, 
-    0xC7, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 0xA4, 0xFF, 0x99, 0xFF, 
-    0x8E, 0xFF, 0xA4, 0xFF, 0x99, 0xFF, 0x99, 0xFF, 0x8E, 0xFF, 0x99, 0xFF, 0x8E, 0xFF, 0x99, 0xFF, 
-    0x99, 0xFF, 0x99, 0xFF, 0xA4, 0xFF, 0xB0, 0xFF, 0xB0, 0xFF, 0xB0, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 
-    0xD2, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 
-    0xD2, 0xFF, 0xD2, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x2C, 0x00, 
-    0x21, 0x00, 0x21, 0x00, 0x15, 0x00, 0x21, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x43, 0x00, 
-    0x37, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x43, 0x00, 0x4E, 0x00, 0x4E, 0x00, 
-    0x5A, 0x00, 0x4E, 0x00, 0x5A, 0x00, 0x65, 0x00, 0x65, 0x00, 0x5A, 0x00, 0x5A, 0x00, 0x5A, 0x00, 
-    0x5A, 0x00, 0x5A, 0x00, 0x4E, 0x00, 0x65, 0x00, 0x5A, 0x00, 0x5A, 0x00, 0x43, 0x00, 0x4E, 0x00, 
-    0x4E, 0x00, 0x4E, 0x00, 0x43, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x65, 0x00, 0x5A, 0x00, 0x4E, 0x00, 
-    0x4E, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x21, 0x00, 0x21, 0x00, 0x15, 0x00, 0x21, 0x00, 
-    0x15, 0x00, 0x21, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 
-    0xDD, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 
-    0xDD, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xDD, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xF4, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 
-    0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 0xA5, 0xFF, 0xBB, 0xFF, 
-    0xBB, 0xFF, 0xB0, 0xFF, 0xB0, 0xFF, 0xB0, 0xFF, 0xBB, 0xFF, 0xC7, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 
-    0xC7, 0xFF, 0xC7, 0xFF, 0xBB, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 
-    0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-    0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x21, 0x00, 0x2C, 0x00, 
-    0x2C, 0x00, 0x2C, 0x00, 0x21, 0x00, 0x15, 0x00, 0x21, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x2C, 0x00, 
-    0x43, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x43, 0x00, 0x37, 0x00, 
-    0x37, 0x00, 0x2C, 0x00, 0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x00, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x20, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 
-    0xC7, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 
-    0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 
-    0xD2, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 
-    0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xB1, 0xFF, 0xB1, 0xFF, 
-    0xA6, 0xFF, 0xA6, 0xFF, 0xA6, 0xFF, 0xB1, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 
-    0xC7, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xF4, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x37, 0x00, 0x42, 0x00, 
-    0x42, 0x00, 0x4D, 0x00, 0x4D, 0x00, 0x42, 0x00, 0x4D, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 
-    0x42, 0x00, 0x37, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x20, 0x00, 0x20, 0x00, 0x15, 0x00, 
-    0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 
-    0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x2B, 0x00, 0x37, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x2B, 0x00, 
-    0x2B, 0x00, 0x2B, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x20, 0x00, 
-    0x20, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x2C, 0x00, 
-    0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 
-    0x20, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 
-    0x2C, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 
-    0x20, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xF4, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 
-    0xC7, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x15, 0x00, 
-    0x20, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x4E, 0x00, 0x4E, 0x00, 
-    0x37, 0x00, 0x42, 0x00, 0x37, 0x00, 0x42, 0x00, 0x4E, 0x00, 0x59, 0x00, 0x4E, 0x00, 0x4E, 0x00, 
-    0x42, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x42, 0x00, 0x2C, 0x00, 0x15, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x20, 0x00, 0x20, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x15, 0x00, 
-    0x0A, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 
-    0xDE, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 
-    0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 
-    0xC7, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 
-    0xB0, 0xFF, 0xBC, 0xFF, 0xB0, 0xFF, 0xB0, 0xFF, 0xB0, 0xFF, 0xB0, 0xFF, 0xB0, 0xFF, 0xB0, 0xFF, 
-    0xA5, 0xFF, 0xB0, 0xFF, 0xA5, 0xFF, 0xB0, 0xFF, 0xA5, 0xFF, 0xA5, 0xFF, 0x8E, 0xFF, 0xA5, 0xFF, 
-    0x99, 0xFF, 0x8E, 0xFF, 0x99, 0xFF, 0x99, 0xFF, 0xA5, 0xFF, 0xB0, 0xFF, 0xB0, 0xFF, 0xBB, 0xFF, 
-    0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xBB, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 
-    0xC7, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 
-    0xDD, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0xE9, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0xE9, 0xFF, 0x00, 0x00, 
-    0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x2C, 0x00, 0x15, 0x00, 0x2C, 0x00, 0x21, 0x00, 
-    0x2C, 0x00, 0x2C, 0x00, 0x43, 0x00, 0x43, 0x00, 0x43, 0x00, 0x43, 0x00, 0x43, 0x00, 0x37, 0x00, 
-    0x43, 0x00, 0x43, 0x00, 0x43, 0x00, 0x4E, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x43, 0x00, 
-    0x43, 0x00, 0x4E, 0x00, 0x59, 0x00, 0x59, 0x00, 0x59, 0x00, 0x59, 0x00, 0x4E, 0x00, 0x2C, 0x00, 
-    0x37, 0x00, 0x37, 0x00, 0x43, 0x00, 0x43, 0x00, 0x43, 0x00, 0x43, 0x00, 0x43, 0x00, 0x4E, 0x00, 
-    0x43, 0x00, 0x4E, 0x00, 0x59, 0x00, 0x43, 0x00, 0x43, 0x00, 0x4E, 0x00, 0x43, 0x00, 0x4E, 0x00, 
-    0x37, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x21, 0x00, 0x21, 0x00, 
-    0x15, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x21, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 
-    0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 
-    0x00, 0x00, 0xE9, 0xFF, 0xF4, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 
-    0xDD, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 
-    0xD2, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 
-    0xD2, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x21, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x37, 0x00, 
-    0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 
-    0x21, 0x00, 0x37, 0x00, 0x37, 0x00, 0x43, 0x00, 0x43, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x43, 0x00, 
-    0x4E, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x37, 0x00, 0x43, 0x00, 0x2C, 0x00, 
-    0x37, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x21, 0x00, 0x21, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x37, 0x00, 
-    0x2C, 0x00, 0x37, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xBB, 0xFF, 0xC7, 0xFF, 0xB0, 0xFF, 0xB0, 0xFF, 
-    0xB0, 0xFF, 0xB0, 0xFF, 0xA5, 0xFF, 0xB0, 0xFF, 0xA5, 0xFF, 0xA5, 0xFF, 0xA5, 0xFF, 0xB0, 0xFF, 
-    0xB0, 0xFF, 0xA5, 0xFF, 0xB0, 0xFF, 0xA5, 0xFF, 0xA4, 0xFF, 0xA4, 0xFF, 0xA4, 0xFF, 0xA4, 0xFF, 
-    0xBB, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 
-    0xC7, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 
-    0xDD, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 
-    0xC7, 0xFF, 0xBB, 0xFF, 0xC6, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 
-    0xC6, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-    0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x43, 0x00, 
-    0x43, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x43, 0x00, 0x43, 0x00, 0x5A, 0x00, 0x5A, 0x00, 0x65, 0x00, 
-    0x5A, 0x00, 0x65, 0x00, 0x7C, 0x00, 0x71, 0x00, 0x5A, 0x00, 0x5A, 0x00, 0x43, 0x00, 0x4F, 0x00, 
-    0x5A, 0x00, 0x5A, 0x00, 0x5A, 0x00, 0x5A, 0x00, 0x65, 0x00, 0x65, 0x00, 0x5A, 0x00, 0x71, 0x00, 
-    0x5A, 0x00, 0x65, 0x00, 0x5A, 0x00, 0x5A, 0x00, 0x5A, 0x00, 0x5A, 0x00, 0x5A, 0x00, 0x5A, 0x00, 
-    0x5A, 0x00, 0x5A, 0x00, 0x5A, 0x00, 0x5A, 0x00, 0x5A, 0x00, 0x43, 0x00, 0x4F, 0x00, 0x43, 0x00, 
-    0x4F, 0x00, 0x38, 0x00, 0x38, 0x00, 0x21, 0x00, 0x38, 0x00, 0x2C, 0x00, 0x43, 0x00, 0x38, 0x00, 
-    0x38, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xD2, 0xFF, 0xE9, 0xFF, 
-    0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 
-    0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xF4, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xDD, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 
-    0xDD, 0xFF, 0xDD, 0xFF, 0xC6, 0xFF, 0xC6, 0xFF, 0xC6, 0xFF, 0xD2, 0xFF, 0xC6, 0xFF, 0xC6, 0xFF, 
-    0xAF, 0xFF, 0xBB, 0xFF, 0xA4, 0xFF, 0xA4, 0xFF, 0x98, 0xFF, 0x8D, 0xFF, 0x8D, 0xFF, 0x81, 0xFF, 
-    0x81, 0xFF, 0x81, 0xFF, 0x76, 0xFF, 0x76, 0xFF, 0x81, 0xFF, 0x98, 0xFF, 0xA4, 0xFF, 0x98, 0xFF, 
-    0x98, 0xFF, 0x8D, 0xFF, 0x98, 0xFF, 0x98, 0xFF, 0xA4, 0xFF, 0xAF, 0xFF, 0xAF, 0xFF, 0xBB, 0xFF, 
-    0xC6, 0xFF, 0xBB, 0xFF, 0xD2, 0xFF, 0xC6, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x21, 0x00, 0x21, 0x00, 0x38, 0x00, 0x43, 0x00, 0x4F, 0x00, 0x38, 0x00, 
-    0x43, 0x00, 0x43, 0x00, 0x4F, 0x00, 0x43, 0x00, 0x43, 0x00, 0x43, 0x00, 0x4F, 0x00, 0x5A, 0x00, 
-    0x5A, 0x00, 0x5A, 0x00, 0x43, 0x00, 0x4F, 0x00, 0x4F, 0x00, 0x43, 0x00, 0x43, 0x00, 0x4F, 0x00, 
-    0x43, 0x00, 0x43, 0x00, 0x43, 0x00, 0x38, 0x00, 0x38, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x38, 0x00, 
-    0x43, 0x00, 0x38, 0x00, 0x43, 0x00, 0x43, 0x00, 0x43, 0x00, 0x43, 0x00, 0x43, 0x00, 0x2C, 0x00, 
-    0x21, 0x00, 0x21, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x00, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 
-    0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 
-    0xDD, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 
-    0xF4, 0xFF, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x0A, 0x00, 
-    0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x2C, 0x00, 
-    0x2C, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x15, 0x00, 0x20, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 
-    0xD3, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xC7, 0xFF, 
-    0xC7, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 
-    0xD3, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xDE, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xF4, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x2B, 0x00, 0x20, 0x00, 0x2B, 0x00, 0x37, 0x00, 0x2B, 0x00, 
-    0x2B, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x20, 0x00, 0x2B, 0x00, 0x37, 0x00, 0x37, 0x00, 
-    0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x2B, 0x00, 0x2B, 0x00, 
-    0x2B, 0x00, 0x37, 0x00, 0x2B, 0x00, 0x37, 0x00, 0x2B, 0x00, 0x37, 0x00, 0x20, 0x00, 0x20, 0x00, 
-    0x20, 0x00, 0x20, 0x00, 0x2B, 0x00, 0x37, 0x00, 0x37, 0x00, 0x42, 0x00, 0x2B, 0x00, 0x37, 0x00, 
-    0x2B, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x37, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x20, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xD3, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 
-    0xC7, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 
-    0xD3, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 
-    0xBC, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 
-    0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xE9, 0xFF, 
-    0xF4, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 
-    0xF4, 0xFF, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 
-    0x2B, 0x00, 0x20, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x37, 0x00, 0x37, 0x00, 
-    0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x2B, 0x00, 0x20, 0x00, 0x20, 0x00, 
-    0x20, 0x00, 0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 
-    0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-    0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x20, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x20, 0x00, 
-    0x20, 0x00, 0x37, 0x00, 0x37, 0x00, 0x2B, 0x00, 0x20, 0x00, 0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 
-    0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x2B, 0x00, 0x20, 0x00, 
-    0x20, 0x00, 0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 
-    0xC7, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 0xB1, 0xFF, 0xB1, 0xFF, 0xB1, 0xFF, 
-    0xB1, 0xFF, 0xBC, 0xFF, 0xB1, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 
-    0xBC, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 
-    0xC7, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x20, 0x00, 0x37, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x20, 0x00, 0x2B, 0x00, 0x20, 0x00, 
-    0x2B, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x37, 0x00, 0x37, 0x00, 0x2B, 0x00, 0x42, 0x00, 0x4D, 0x00, 
-    0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x42, 0x00, 0x42, 0x00, 
-    0x4D, 0x00, 0x42, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x20, 0x00, 0x2B, 0x00, 0x20, 0x00, 
-    0x2B, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x2B, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x20, 0x00, 
-    0x20, 0x00, 0x20, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0xF4, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 
-    0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 
-    0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 
-    0xDE, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xDE, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 
-    0xC7, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xDE, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 
-    0xC7, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 
-    0xD2, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x21, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x37, 0x00, 0x43, 0x00, 
-    0x43, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x43, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x21, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0A, 0x00, 
-    0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x2C, 0x00, 0x21, 0x00, 
-    0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x38, 0x00, 0x43, 0x00, 
-    0x38, 0x00, 0x43, 0x00, 0x43, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x2C, 0x00, 
-    0x2C, 0x00, 0x21, 0x00, 0x38, 0x00, 0x38, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x38, 0x00, 0x2C, 0x00, 
-    0x38, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 
-    0xD2, 0xFF, 0xC6, 0xFF, 0xBB, 0xFF, 0xC6, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xC6, 0xFF, 0xC6, 0xFF, 
-    0xBB, 0xFF, 0xC6, 0xFF, 0xC6, 0xFF, 0xC6, 0xFF, 0xC6, 0xFF, 0xC6, 0xFF, 0xBB, 0xFF, 0xAF, 0xFF, 
-    0xAF, 0xFF, 0xA4, 0xFF, 0xC6, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 
-    0xDD, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xDD, 0xFF, 
-    0x0A, 0x00, 0xA4, 0xFF, 0xE0, 0xFE, 0xBB, 0xFF, 0xCD, 0x00, 0x7A, 0x01, 0x94, 0x00, 0x53, 0xFF, 
-    0x03, 0xFF, 0xF4, 0xFF, 0x88, 0x00, 0x4F, 0x00, 0xA3, 0xFF, 0xE8, 0xFF, 0x2D, 0x00, 0x2D, 0x00, 
-    0x98, 0xFF, 0x6A, 0xFF, 0x00, 0x00, 0x94, 0x00, 0x66, 0x00, 0xDD, 0xFF, 0x81, 0xFF, 0x0A, 0x00, 
-    0x7D, 0x00, 0x66, 0x00, 0xDD, 0xFF, 0xC6, 0xFF, 0x00, 0x00, 0x44, 0x00, 0x38, 0x00, 0x00, 0x00, 
-    0xE8, 0xFF, 0x16, 0x00, 0x16, 0x00, 0x00, 0x00, 0xD1, 0xFF, 0xDD, 0xFF, 0x00, 0x00, 0x21, 0x00, 
-    0x16, 0x00, 0xE8, 0xFF, 0xF4, 0xFF, 0x21, 0x00, 0x4F, 0x00, 0x38, 0x00, 0x16, 0x00, 0x16, 0x00, 
-    0x44, 0x00, 0x72, 0x00, 0x72, 0x00, 0x4F, 0x00, 0x2D, 0x00, 0x44, 0x00, 0x5B, 0x00, 0x66, 0x00, 
-    0x44, 0x00, 0x44, 0x00, 0x44, 0x00, 0x4F, 0x00, 0x4F, 0x00, 0x4F, 0x00, 0x4F, 0x00, 0x44, 0x00, 
-    0x2D, 0x00, 0x16, 0x00, 0x2D, 0x00, 0x5B, 0x00, 0x4F, 0x00, 0x2D, 0x00, 0x16, 0x00, 0x16, 0x00, 
-    0x16, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xE8, 0xFF, 
-    0xE8, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xDD, 0xFF, 0xE8, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-    0xE8, 0xFF, 0xC6, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xE8, 0xFF, 0xD1, 0xFF, 0xBA, 0xFF, 0xBA, 0xFF, 
-    0xD1, 0xFF, 0xC6, 0xFF, 0xA3, 0xFF, 0x98, 0xFF, 0x8C, 0xFF, 0xA3, 0xFF, 0xA3, 0xFF, 0x98, 0xFF, 
-    0x81, 0xFF, 0x8C, 0xFF, 0x98, 0xFF, 0xA3, 0xFF, 0x8C, 0xFF, 0x98, 0xFF, 0x8C, 0xFF, 0xAF, 0xFF, 
-    0xA3, 0xFF, 0x98, 0xFF, 0x98, 0xFF, 0xA3, 0xFF, 0xA3, 0xFF, 0xA3, 0xFF, 0xA3, 0xFF, 0xAF, 0xFF, 
-    0xBA, 0xFF, 0xC6, 0xFF, 0xD1, 0xFF, 0xD1, 0xFF, 0xD1, 0xFF, 0xC6, 0xFF, 0xC6, 0xFF, 0xC6, 0xFF, 
-    0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xC6, 0xFF, 0xBA, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 
-    0xD2, 0xFF, 0xC6, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 
-    0xD2, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xDD, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 0xD2, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0x0A, 0x00, 
-    0x00, 0x00, 0xE9, 0xFF, 0xDD, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x15, 0x00, 0x15, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x21, 0x00, 
-    0x0A, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x15, 0x00, 0x21, 0x00, 0x15, 0x00, 0x21, 0x00, 0x21, 0x00, 
-    0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x2C, 0x00, 0x43, 0x00, 0x4F, 0x00, 0x66, 0x00, 0x5A, 0x00, 
-    0x5A, 0x00, 0x5A, 0x00, 0x5A, 0x00, 0x4F, 0x00, 0x4F, 0x00, 0x4F, 0x00, 0x65, 0x00, 0x65, 0x00, 
-    0x71, 0x00, 0x5A, 0x00, 0x4F, 0x00, 0x5A, 0x00, 0x71, 0x00, 0x65, 0x00, 0x65, 0x00, 0x65, 0x00, 
-    0x71, 0x00, 0x71, 0x00, 0x5A, 0x00, 0x4F, 0x00, 0x38, 0x00, 0x4E, 0x00, 0x65, 0x00, 0x4E, 0x00, 
-    0x38, 0x00, 0x2C, 0x00, 0x38, 0x00, 0x43, 0x00, 0x38, 0x00, 0x2C, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x21, 0x00, 
-    0x38, 0x00, 0x38, 0x00, 0x4E, 0x00, 0x43, 0x00, 0x5A, 0x00, 0x43, 0x00, 0x4E, 0x00, 0x38, 0x00, 
-    0x38, 0x00, 0x38, 0x00, 0x43, 0x00, 0x43, 0x00, 0x4E, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x37, 0x00, 
-    0x43, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x21, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 
-    0xE9, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 
-    0xE9, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xE9, 0xFF, 0xD2, 0xFF, 0xBB, 0xFF, 0xB0, 0xFF, 
-    0xC7, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xDD, 0xFF, 
-    0xDD, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xF4, 0xFF, 
-    0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 
-    0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 
-    0xD2, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 
-    0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 
-    0x20, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x20, 0x00, 
-    0x2C, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0x0A, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x0A, 0x00, 
-    0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 
-    0xF4, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xFF, 
-    0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xFF, 0xDE, 0xFF, 0xC7, 0xFF, 
-    0xC7, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 
-    0xD2, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 0x00, 0x00, 
-    0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x2C, 0x00, 0x15, 0x00, 0x20, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0xF4, 0xFF, 0xE9, 0xFF, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x00, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x2C, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x37, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x20, 0x00, 
-    0x20, 0x00, 0x37, 0x00, 0x20, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x59, 0x00, 0x42, 0x00, 0x37, 0x00, 
-    0x20, 0x00, 0x20, 0x00, 0x37, 0x00, 0x37, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x2C, 0x00, 
-    0x2C, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x4D, 0x00, 0x42, 0x00, 0x4D, 0x00, 0x2C, 0x00, 0x2C, 0x00, 
-    0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xDE, 0xFF, 
-    0xC7, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xD3, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0x15, 0x00, 0xC7, 0xFF, 0xC7, 0xFF, 0xA6, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 
-    0xC7, 0xFF, 0xC7, 0xFF, 0x00, 0x00, 0xC7, 0xFF, 0x0A, 0x00, 0xB1, 0xFF, 0x0A, 0x00, 0x0A, 0x00, 
-    0x00, 0x00, 0xC7, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0x20, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0xD2, 0xFF, 
-    0xE9, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0x42, 0x00, 0xB0, 0xFF, 0xB0, 0xFF, 0x0A, 0x00, 0x43, 0x00, 
-    0x2C, 0x00, 0x83, 0xFF, 0x00, 0x00, 0xDD, 0xFF, 0x5A, 0x00, 0xBB, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 
-    0x37, 0x00, 0xE9, 0xFF, 0x82, 0xFF, 0xBB, 0xFF, 0xDD, 0xFF, 0x15, 0x00, 0xB0, 0xFF, 0xAF, 0xFF, 
-    0xBB, 0xFF, 0xD2, 0xFF, 0xF4, 0xFF, 0xC6, 0xFF, 0xC6, 0xFF, 0xBB, 0xFF, 0xDD, 0xFF, 0xAF, 0xFF, 
-    0xBB, 0xFF, 0xA4, 0xFF, 0xC6, 0xFF, 0xBB, 0xFF, 0xC6, 0xFF, 0xBB, 0xFF, 0xAF, 0xFF, 0xD1, 0xFF, 
-    0xC6, 0xFF, 0xD1, 0xFF, 0xD1, 0xFF, 0xD1, 0xFF, 0xDD, 0xFF, 0xE8, 0xFF, 0xDD, 0xFF, 0xE8, 0xFF, 
-    0xE8, 0xFF, 0xF4, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x2D, 0x00, 0x2D, 0x00, 
-    0xF4, 0xFF, 0x0A, 0x00, 0x21, 0x00, 0x2D, 0x00, 0x21, 0x00, 0xF4, 0xFF, 0x0A, 0x00, 0x21, 0x00, 
-    0x2D, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x16, 0x00, 0x16, 0x00, 0x21, 0x00, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xE8, 0xFF, 0x16, 0x00, 0x00, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 0x16, 0x00, 
-    0xE8, 0xFF, 0xF4, 0xFF, 0xC5, 0xFF, 0x16, 0x00, 0x16, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 0x00, 0x00, 
-    0xE8, 0xFF, 0x45, 0x00, 0xDC, 0xFF, 0x22, 0x00, 0xC5, 0xFF, 0x9E, 0xFE, 0xED, 0x01, 0xB9, 0xFF, 
-    0x11, 0x02, 0xBE, 0xFD, 0xE8, 0xFF, 0x8A, 0xFF, 0x3D, 0x01, 0xB0, 0x00, 0x3A, 0x00, 0x72, 0xFF, 
-    0x95, 0xFF, 0xD0, 0xFF, 0xD3, 0x00, 0x69, 0x00, 0x51, 0x00, 0xAD, 0xFF, 0xAD, 0xFF, 0x22, 0x00, 
-    0x52, 0x00, 0x2E, 0x00, 0xB1, 0x00, 0xAC, 0xFF, 0x2E, 0x00, 0x7D, 0xFF, 0x99, 0x00, 0x00, 0x00, 
-    0x2E, 0x00, 0xD0, 0xFF, 0x00, 0x00, 0xDC, 0xFF, 0x52, 0x00, 0x00, 0x00, 0x3A, 0x00, 0xE8, 0xFF, 
-    0xE8, 0xFF, 0x16, 0x00, 0x00, 0x00, 0x3A, 0x00, 0xDC, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0x16, 0x00, 
-    0x3A, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0x52, 0x00, 0x00, 0x00, 0x23, 0x00, 0xF3, 0xFF, 
-    0x23, 0x00, 0x53, 0x00, 0xE7, 0xFF, 0x00, 0x00, 0x0B, 0x00, 0x17, 0x00, 0x53, 0x00, 0x23, 0x00, 
-    0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x83, 0x00, 0x6B, 0x00, 0x47, 0x00, 0x3B, 0x00, 
-    0xDB, 0xFF, 0x84, 0x00, 0xCF, 0xFF, 0xF1, 0x00, 0xE7, 0xFF, 0x9C, 0x00, 0x9F, 0xFF, 0xB4, 0x00, 
-    0x17, 0x00, 0x16, 0x01, 0x00, 0x00, 0x84, 0x00, 0x2F, 0x00, 0x78, 0x00, 0x22, 0x02, 0x5F, 0x02, 
-    0x5F, 0x02, 0x2F, 0x00, 0xAA, 0xFF, 0x30, 0xFF, 0x0B, 0x00, 0x0B, 0x00, 0x85, 0x00, 0x3C, 0x00, 
-    0x30, 0xFF, 0x85, 0xFE, 0x9D, 0xFE, 0xC2, 0xFF, 0xC2, 0xFF, 0x6D, 0x00, 0xF2, 0xFE, 0xE7, 0xFF, 
-    0x3C, 0xFF, 0x9E, 0x00, 0x92, 0x00, 0x4B, 0x02, 0x3D, 0x01, 0x3E, 0x01, 0xB6, 0xFF, 0xC2, 0xFF, 
-    0x11, 0x03, 0x5B, 0x03, 0x2C, 0x04, 0x32, 0x01, 0x3E, 0x01, 0x5F, 0xFF, 0x9D, 0xFF, 0x2B, 0xFE, 
-    0x22, 0xFF, 0xE4, 0xFE, 0xCB, 0xFE, 0x59, 0xFD, 0x62, 0xFC, 0xAC, 0xFC, 0xFE, 0xFB, 0x54, 0xFC, 
-    0xD8, 0xFB, 0xAA, 0xFC, 0x3B, 0xFC, 0xB6, 0xFC, 0x6B, 0xFC, 0xAD, 0xFD, 0x31, 0xFD, 0xFF, 0xFC, 
-    0x30, 0xFD, 0x0F, 0xFE, 0x39, 0xFF, 0x5E, 0xFF, 0xF7, 0x00, 0xE3, 0x01, 0xC3, 0x02, 0x22, 0x02, 
-    0x15, 0x02, 0x79, 0x02, 0x1B, 0x03, 0xC4, 0x02, 0x86, 0x02, 0xAC, 0x02, 0xD2, 0x02, 0x3C, 0x02, 
-    0xD3, 0x00, 0x56, 0x00, 0x05, 0x01, 0xD3, 0x00, 0xA7, 0x01, 0x3D, 0x00, 0x24, 0x00, 0x64, 0xFE, 
-    0x4B, 0xFE, 0xC8, 0xFC, 0x25, 0xFE, 0x2C, 0xFD, 0x19, 0xFE, 0xFA, 0xFC, 0xA8, 0xFD, 0x0C, 0xFE, 
-    0x12, 0xFF, 0x6A, 0xFF, 0xF3, 0xFF, 0x56, 0x00, 0xCE, 0xFF, 0xBA, 0x00, 0xCE, 0xFF, 0xA7, 0x01, 
-    0xAD, 0x00, 0x75, 0x01, 0xAD, 0x00, 0xD3, 0x00, 0x6F, 0x00, 0xA1, 0x00, 0x62, 0x00, 0x62, 0x00, 
-    0xE7, 0xFF, 0x30, 0x00, 0xE7, 0xFF, 0xF3, 0xFF, 0xC1, 0xFF, 0x9C, 0xFF, 0xA8, 0xFF, 0x06, 0xFF, 
-    0x44, 0xFF, 0x38, 0xFF, 0x5D, 0xFF, 0xA8, 0xFF, 0x51, 0xFF, 0xCE, 0xFF, 0xE7, 0xFF, 0xC1, 0xFF, 
-    0x30, 0x00, 0x17, 0x00, 0xBA, 0x00, 0x94, 0x00, 0xF8, 0x00, 0x05, 0x01, 0x44, 0x01, 0x50, 0x01, 
-    0x05, 0x01, 0xE0, 0x00, 0xEC, 0x00, 0xE0, 0x00, 0x05, 0x01, 0xC7, 0x00, 0xC7, 0x00, 0x6F, 0x00, 
-    0xC7, 0x00, 0xA1, 0x00, 0x95, 0x00, 0x18, 0xFE, 0xB4, 0xFD, 0x1E, 0xFF, 0x50, 0x01, 0xED, 0x02, 
-    0x63, 0x00, 0xE0, 0xFE, 0x56, 0xFE, 0x56, 0x00, 0xCD, 0xFF, 0x12, 0xFF, 0x76, 0xFF, 0xCD, 0xFF, 
-    0x69, 0x01, 0xC1, 0xFF, 0x24, 0x00, 0xD3, 0x00, 0x57, 0x02, 0x00, 0x02, 0x6F, 0x00, 0x6F, 0x00, 
-    0x8F, 0x01, 0x9C, 0x01, 0x05, 0x01, 0xE6, 0xFF, 0x31, 0x00, 0xAE, 0x00, 0x7C, 0x00, 0xDA, 0xFF, 
-    0x00, 0x00, 0x4A, 0x00, 0x18, 0x00, 0xB4, 0xFF, 0x9B, 0xFF, 0xB4, 0xFF, 0xF9, 0x00, 0x56, 0x00, 
-    0xC7, 0x00, 0x63, 0x00, 0xC7, 0x00, 0xC7, 0x00, 0xA1, 0x00, 0xBA, 0x00, 0xE0, 0x00, 0x2B, 0x01, 
-    0xEC, 0x00, 0xD3, 0x00, 0xA1, 0x00, 0xE0, 0x00, 0xBA, 0x00, 0x3D, 0x00, 0xDA, 0xFF, 0x18, 0x00, 
-    0x3D, 0x00, 0x24, 0x00, 0xF3, 0xFF, 0x76, 0xFF, 0x50, 0xFF, 0xDF, 0xFE, 0xF8, 0xFE, 0x05, 0xFF, 
-    0xEC, 0xFE, 0xAD, 0xFE, 0xA1, 0xFE, 0xBA, 0xFE, 0x76, 0xFF, 0xAD, 0xFE, 0xAD, 0xFE, 0xA0, 0xFE, 
-    0xF8, 0xFE, 0xBA, 0xFE, 0xC6, 0xFE, 0xBA, 0xFE, 0x63, 0x00, 0x6F, 0x00, 0x18, 0x00, 0xC1, 0xFF, 
-    0x9B, 0xFF, 0x3D, 0x00, 0x56, 0x00, 0x7C, 0x00, 0x5C, 0xFF, 0x9B, 0xFF, 0x37, 0xFF, 0x37, 0xFF, 
-    0xEC, 0xFE, 0xA0, 0xFE, 0xEC, 0xFE, 0xAD, 0xFE, 0x62, 0xFE, 0x48, 0xFE, 0xC6, 0xFE, 0xD2, 0xFE, 
-    0x7B, 0xFE, 0xE4, 0xFD, 0xD7, 0xFD, 0x0A, 0xFE, 0x2F, 0xFE, 0xBE, 0xFD, 0x61, 0xFE, 0xD2, 0xFE, 
-    0x11, 0xFF, 0xF8, 0xFE, 0xDF, 0xFE, 0xA0, 0xFE, 0xF8, 0xFE, 0x87, 0xFE, 0x7A, 0xFE, 0x18, 0x00, 
-    0x37, 0xFF, 0xCD, 0xFF, 0x87, 0xFE, 0xA0, 0xFE, 0x2A, 0xFF, 0x5C, 0xFF, 0x82, 0xFF, 0xAC, 0xFE, 
-    0x9B, 0xFF, 0x8E, 0xFF, 0x75, 0xFF, 0x0B, 0x00, 0xF3, 0xFF, 0xDC, 0x01, 0x0E, 0x02, 0x3D, 0x00, 
-    0xC1, 0xFF, 0x3D, 0x00, 0xA2, 0x00, 0xBB, 0x00, 0x00, 0x00, 0x9B, 0xFF, 0x00, 0x00, 0xF3, 0xFF, 
-    0xDA, 0xFF, 0x0B, 0x00, 0x5E, 0x01, 0xAA, 0x01, 0xCF, 0x01, 0xBB, 0x00, 0xD4, 0x00, 0x2C, 0x01, 
-    0xB6, 0x01, 0x2C, 0x01, 0xC8, 0x00, 0xBB, 0x00, 0x06, 0x01, 0x02, 0x02, 0x30, 0x03, 0x9C, 0x04, 
-    0x2A, 0x07, 0xBC, 0x08, 0x53, 0x09, 0x36, 0x0A, 0x5B, 0x0A, 0x1D, 0x0A, 0x60, 0x09, 0x19, 0x08, 
-    0x1E, 0x07, 0x22, 0x06, 0xCF, 0x04, 0x95, 0x03, 0xD8, 0x02, 0xE9, 0x01, 0x46, 0x01, 0x4F, 0xFF, 
-    0xD2, 0xFE, 0x86, 0xFE, 0x47, 0xFE, 0x43, 0xFF, 0x82, 0xFF, 0x9B, 0xFF, 0x7C, 0x00, 0x4A, 0x00, 
-    0x78, 0x01, 0x80, 0x02, 0xD8, 0x02, 0x06, 0x04, 0x95, 0x03, 0xE5, 0x02, 0xCC, 0x02, 0x0F, 0x02, 
-    0x91, 0x01, 0x46, 0x01, 0xDA, 0xFF, 0x10, 0xFF, 0xD6, 0xFD, 0x82, 0xFC, 0x10, 0xFC, 0x47, 0xFB, 
-    0x15, 0xFB, 0xBC, 0xFA, 0xE2, 0xFA, 0x60, 0xFB, 0x68, 0xFC, 0x4B, 0xFD, 0xFB, 0xFD, 0x86, 0xFE, 
-    0x92, 0xFE, 0xD1, 0xFE, 0xD1, 0xFE, 0xAC, 0xFE, 0x9F, 0xFE, 0xB8, 0xFE, 0xE2, 0xFD, 0xBC, 0xFD, 
-    0x00, 0xFD, 0xCD, 0xFC, 0x8E, 0xFC, 0xEB, 0xFB, 0x6D, 0xFB, 0xEF, 0xFA, 0xEF, 0xFA, 0x3A, 0xFB, 
-    0x60, 0xFB, 0x92, 0xFB, 0xC5, 0xFB, 0x9F, 0xFB, 0xD1, 0xFB, 0xC5, 0xFB, 0xC5, 0xFB, 0xC5, 0xFB, 
-    0x79, 0xFB, 0x6D, 0xFB, 0x3A, 0xFB, 0x3A, 0xFB, 0x60, 0xFB, 0x6D, 0xFB, 0x21, 0xFB, 0x6D, 0xFB, 
-    0x54, 0xFB, 0x79, 0xFB, 0x36, 0xFC, 0x2A, 0xFC, 0xC1, 0xFC, 0xF3, 0xFC, 0x9B, 0xFC, 0xDA, 0xFC, 
-    0xC1, 0xFC, 0x3F, 0xFD, 0xA3, 0xFD, 0xE6, 0xFC, 0xCD, 0xFC, 0xA7, 0xFC, 0x4F, 0xFC, 0xE6, 0xFC, 
-    0xE6, 0xFC, 0x2E, 0xFE, 0x36, 0xFF, 0xA7, 0xFF, 0x82, 0xFF, 0xC5, 0xFE, 0x92, 0xFE, 0x29, 0xFF, 
-    0x82, 0xFF, 0xF3, 0xFF, 0x96, 0x00, 0xEE, 0x00, 0x39, 0x01, 0x9E, 0x01, 0xF6, 0x01, 0x96, 0x03, 
-    0x6C, 0x04, 0xC8, 0x03, 0x24, 0x03, 0x78, 0x01, 0x70, 0x00, 0x8E, 0xFF, 0x60, 0xFE, 0x4A, 0x00, 
-    0x7C, 0x06, 0xBF, 0x0E, 0xD8, 0x14, 0x4A, 0x18, 0x24, 0x18, 0x4E, 0x17, 0x3D, 0x15, 0x28, 0x11, 
-    0x0F, 0x0E, 0x9E, 0x0A, 0xFE, 0x05, 0xD5, 0x00, 0x92, 0xFB, 0x8E, 0xF9, 0x71, 0xFA, 0xC5, 0xFB, 
-    0x1D, 0xFC, 0x8E, 0xFC, 0x3F, 0xFD, 0x2E, 0xFE, 0x4F, 0xFF, 0x57, 0x00, 0xB7, 0x01, 0x70, 0x03, 
-    0x6C, 0x04, 0x9E, 0x04, 0x5B, 0x05, 0x4A, 0x06, 0xDD, 0x07, 0x28, 0x08, 0x78, 0x07, 0x0B, 0x06, 
-    0x78, 0x04, 0x7C, 0x00, 0x8E, 0xFC, 0x4F, 0xFC, 0xE6, 0xFC, 0xDE, 0xFB, 0xE2, 0xF7, 0x5C, 0xF3, 
-    0xF3, 0xF3, 0xA3, 0xF7, 0x54, 0xFB, 0x36, 0xFC, 0x58, 0xFA, 0x58, 0xFA, 0xB4, 0xFC, 0xAF, 0x00, 
-    0xD4, 0x03, 0x95, 0x06, 0xF6, 0x07, 0x46, 0x07, 0x42, 0x05, 0xEE, 0x03, 0x24, 0x03, 0xEE, 0x03, 
-    0xA6, 0x02, 0x18, 0x00, 0x79, 0xFE, 0x43, 0xFC, 0xF7, 0xFB, 0x9F, 0xFB, 0x08, 0xFB, 0x60, 0xFB, 
-    0x2E, 0xFB, 0x64, 0xFA, 0xA3, 0xFA, 0x86, 0xFB, 0x25, 0xFD, 0x36, 0xFF, 0x68, 0xFF, 0x68, 0xFF, 
-    0x75, 0xFF, 0xCD, 0xFF, 0x63, 0x00, 0x07, 0x01, 0x20, 0x01, 0x46, 0x01, 0x20, 0x01, 0x0B, 0x00, 
-    0x9B, 0xFF, 0x1D, 0xFF, 0xC5, 0xFE, 0x15, 0xFE, 0x00, 0xFD, 0x10, 0xFC, 0x36, 0xFC, 0x36, 0xFC, 
-    0x04, 0xFC, 0x10, 0xFC, 0xC5, 0xFB, 0x75, 0xFC, 0xC1, 0xFC, 0x8E, 0xFC, 0x8E, 0xFC, 0x8E, 0xFC, 
-    0xF3, 0xFC, 0x71, 0xFD, 0x8A, 0xFD, 0xC9, 0xFD, 0x7D, 0xFD, 0x32, 0xFD, 0x4B, 0xFD, 0xEF, 0xFD, 
-    0xB8, 0xFE, 0x1D, 0xFF, 0xAC, 0xFE, 0x2E, 0xFE, 0xFB, 0xFD, 0x21, 0xFE, 0x53, 0xFE, 0xE2, 0xFD, 
-    0x7D, 0xFD, 0x25, 0xFD, 0xCD, 0xFC, 0xE6, 0xFC, 0x25, 0xFD, 0xC9, 0xFD, 0x3A, 0xFE, 0x60, 0xFE, 
-    0xD6, 0xFD, 0x7D, 0xFD, 0x0C, 0xFD, 0x19, 0xFD, 0x0C, 0xFD, 0xDA, 0xFC, 0xA7, 0xFC, 0x68, 0xFC, 
-    0xCD, 0xFC, 0x9B, 0xFC, 0x0C, 0xFD, 0x8A, 0xFD, 0xC9, 0xFD, 0xE2, 0xFD, 0x25, 0xFD, 0x64, 0xFD, 
-    0xBC, 0xFD, 0xAC, 0xFE, 0x8E, 0xFF, 0xE6, 0xFF, 0x3D, 0x00, 0xF3, 0xFF, 0xC1, 0xFF, 0x89, 0x00, 
-    0xD5, 0x00, 0xB7, 0x01, 0xAB, 0x01, 0x89, 0x00, 0x5C, 0xFF, 0xDE, 0xFE, 0x53, 0xFE, 0xB8, 0xFE, 
-    0x9B, 0xFF, 0xB4, 0xFF, 0x89, 0x00, 0x24, 0x00, 0x00, 0x00, 0x74, 0x02, 0x95, 0x09, 0x63, 0x15, 
-    0x63, 0x1E, 0x34, 0x23, 0x9D, 0x22, 0x49, 0x1E, 0x84, 0x19, 0x24, 0x12, 0x2C, 0x0D, 0x91, 0x07, 
-    0x57, 0x00, 0x93, 0xF8, 0x8A, 0xF1, 0x97, 0xEE, 0xF7, 0xEF, 0x5C, 0xF3, 0x8E, 0xF6, 0x00, 0xFA, 
-    0x8A, 0xFD, 0xE6, 0xFF, 0xBF, 0x02, 0xD9, 0x05, 0x35, 0x08, 0x52, 0x0A, 0x78, 0x0A, 0x95, 0x09, 
-    0xE5, 0x08, 0x1C, 0x08, 0x28, 0x08, 0x5B, 0x08, 0x07, 0x07, 0x4E, 0x05, 0xA6, 0x02, 0x92, 0xFE, 
-    0xE2, 0xFA, 0xB0, 0xF7, 0xDE, 0xF5, 0xFC, 0xF4, 0x32, 0xF4, 0xA8, 0xF3, 0x97, 0xF4, 0x69, 0xF6, 
-    0xB4, 0xF9, 0x71, 0xFD, 0x7C, 0x00, 0xBB, 0x03, 0xE5, 0x05, 0x52, 0x07, 0xBF, 0x08, 0xCC, 0x08, 
-    0x74, 0x08, 0xFA, 0x06, 0x85, 0x04, 0x03, 0x02, 0x10, 0xFF, 0x8E, 0xFC, 0x4B, 0xFA, 0xC5, 0xF8, 
-    0xC9, 0xF7, 0x71, 0xF7, 0x9B, 0xF6, 0x75, 0xF6, 0x64, 0xF7, 0x1D, 0xF9, 0xEB, 0xFB, 0x68, 0xFF, 
-    0x24, 0x03, 0x9A, 0x05, 0x07, 0x07, 0x13, 0x07, 0x0B, 0x06, 0xAA, 0x04, 0x8D, 0x02, 0xA2, 0x00, 
-    0xAC, 0xFE, 0x32, 0xFD, 0x0C, 0xFD, 0x32, 0xFD, 0x58, 0xFD, 0x7D, 0xFD, 0x68, 0xFC, 0xB8, 0xFB, 
-    0xAC, 0xFB, 0x36, 0xFC, 0x58, 0xFD, 0x60, 0xFE, 0x43, 0xFF, 0x31, 0x00, 0x89, 0x00, 0xAF, 0x00, 
-    0xC8, 0x00, 0xAF, 0x00, 0xCD, 0xFF, 0x04, 0xFF, 0x4B, 0xFD, 0x86, 0xFB, 0xC9, 0xFA, 0x19, 0xFA, 
-    0x58, 0xFA, 0xD6, 0xFA, 0x54, 0xFB, 0x75, 0xFC, 0xBC, 0xFD, 0xF7, 0xFE, 0x7C, 0x00, 0x91, 0x01, 
-    0x85, 0x01, 0x78, 0x01, 0x7C, 0x00, 0x5C, 0xFF, 0xDE, 0xFE, 0xD6, 0xFD, 0xF3, 0xFC, 0x36, 0xFC, 
-    0x54, 0xFB, 0x21, 0xFB, 0x15, 0xFB, 0x47, 0xFB, 0x4F, 0xFC, 0x4B, 0xFD, 0x53, 0xFE, 0x5C, 0xFF, 
-    0x31, 0x00, 0xFA, 0x00, 0x6C, 0x01, 0xC4, 0x01, 0xB7, 0x01, 0x52, 0x01, 0x7C, 0x00, 0x82, 0xFF, 
-    0x60, 0xFE, 0xF3, 0xFC, 0x86, 0xFB, 0xE6, 0xF9, 0x6D, 0xF8, 0xC9, 0xF7, 0x97, 0xF7, 0x2E, 0xF8, 
-    0x1D, 0xF9, 0x58, 0xFA, 0xA7, 0xFC, 0x08, 0xFE, 0x9B, 0xFF, 0xA2, 0x00, 0xBB, 0x00, 0x85, 0x01, 
-    0xD5, 0x00, 0x18, 0x00, 0x4A, 0x00, 0x5C, 0xFF, 0xCD, 0xFF, 0xC1, 0xFF, 0x4F, 0xFF, 0x29, 0xFF, 
-    0xB8, 0xFE, 0xFB, 0xFD, 0x8A, 0xFD, 0xC9, 0xFD, 0x0C, 0xFD, 0xC1, 0xFC, 0x86, 0xFB, 0x3F, 0xFA, 
-    0xAF, 0x00, 0xAF, 0x0C, 0xF1, 0x1A, 0x49, 0x27, 0x5E, 0x2B, 0x4D, 0x29, 0x30, 0x24, 0x4A, 0x1B, 
-    0xC8, 0x12, 0x67, 0x0B, 0xAB, 0x01, 0xC1, 0xF6, 0x6D, 0xEC, 0xC1, 0xE4, 0x1D, 0xE4, 0x3F, 0xE8, 
-    0x0C, 0xEE, 0x75, 0xF6, 0x21, 0xFE, 0x96, 0x03, 0x4E, 0x08, 0x4A, 0x0C, 0xED, 0x0F, 0xC8, 0x12, 
-    0x56, 0x12, 0xD8, 0x0E, 0xE9, 0x0A, 0x85, 0x07, 0xD9, 0x05, 0xFE, 0x05, 0x18, 0x06, 0x28, 0x05, 
-    0xD9, 0x02, 0xC5, 0xFE, 0x25, 0xFA, 0x69, 0xF6, 0x75, 0xF3, 0x64, 0xF1, 0x69, 0xF0, 0xAC, 0xEF, 
-    0x50, 0xF0, 0x11, 0xF3, 0x71, 0xF7, 0x19, 0xFD, 0xCC, 0x02, 0x6B, 0x07, 0x28, 0x0B, 0x78, 0x0D, 
-    0xA6, 0x0E, 0xB3, 0x0E, 0x07, 0x0D, 0xE1, 0x09, 0x80, 0x05, 0x7C, 0x00, 0x9F, 0xFB, 0x71, 0xF7, 
-    0xA3, 0xF4, 0xF7, 0xF2, 0x2A, 0xF3, 0x32, 0xF4, 0x54, 0xF5, 0xCD, 0xF6, 0xEF, 0xF7, 0xBC, 0xFA, 
-    0x21, 0xFE, 0x78, 0x01, 0x20, 0x04, 0x74, 0x05, 0x18, 0x06, 0x3D, 0x06, 0x57, 0x06, 0x5B, 0x05, 
-    0x52, 0x04, 0xCC, 0x02, 0xC4, 0x01, 0x91, 0x01, 0x70, 0x00, 0x89, 0x00, 0xCD, 0xFF, 0xEB, 0xFE, 
-    0x08, 0xFE, 0xCD, 0xFC, 0x8E, 0xFC, 0xA7, 0xFC, 0xF3, 0xFC, 0x58, 0xFD, 0x08, 0xFE, 0x79, 0xFE, 
-    0x86, 0xFE, 0x92, 0xFE, 0x3A, 0xFE, 0x60, 0xFE, 0xDE, 0xFE, 0xAC, 0xFE, 0xC5, 0xFE, 0x92, 0xFE, 
-    0x08, 0xFE, 0x21, 0xFE, 0x2E, 0xFE, 0xAC, 0xFE, 0x75, 0xFF, 0x5C, 0xFF, 0x04, 0xFF, 0x36, 0xFF, 
-    0x43, 0xFF, 0x75, 0xFF, 0x9B, 0xFF, 0xC5, 0xFE, 0xBC, 0xFD, 0xF3, 0xFC, 0x04, 0xFC, 0x1D, 0xFC, 
-    0x4F, 0xFC, 0xB4, 0xFC, 0x32, 0xFD, 0x3F, 0xFD, 0x58, 0xFD, 0xBC, 0xFD, 0x21, 0xFE, 0x79, 0xFE, 
-    0xD1, 0xFE, 0xDE, 0xFE, 0x79, 0xFE, 0xAC, 0xFE, 0xEB, 0xFE, 0x68, 0xFF, 0xF3, 0xFF, 0xA7, 0xFF, 
-    0xF7, 0xFE, 0x21, 0xFE, 0x58, 0xFD, 0x00, 0xFD, 0x9B, 0xFC, 0x43, 0xFC, 0x04, 0xFC, 0xDE, 0xFB, 
-    0x10, 0xFC, 0x8E, 0xFC, 0x25, 0xFD, 0xB0, 0xFD, 0xE2, 0xFD, 0xD6, 0xFD, 0xD6, 0xFD, 0xC9, 0xFD, 
-    0x47, 0xFE, 0xDE, 0xFE, 0xDA, 0xFF, 0x70, 0x00, 0x18, 0x00, 0x00, 0x00, 0x8E, 0xFF, 0xEB, 0xFE, 
-    0xF7, 0xFE, 0xAC, 0xFE, 0xAC, 0xFE, 0x04, 0xFF, 0x47, 0xFE, 0x8A, 0xFD, 0x32, 0xFD, 0x2A, 0xFC, 
-    0x47, 0xFB, 0xFB, 0xFA, 0xB0, 0xFA, 0xD6, 0xFA, 0x79, 0xFB, 0x79, 0xFB, 0x15, 0xFB, 0xCD, 0xFC, 
-    0xC4, 0x04, 0x5F, 0x13, 0x45, 0x22, 0x73, 0x2C, 0xAA, 0x2E, 0x56, 0x2A, 0x2C, 0x22, 0xF1, 0x17, 
-    0xDD, 0x0D, 0x52, 0x04, 0xCD, 0xF9, 0x3B, 0xEF, 0x6D, 0xE6, 0x82, 0xE1, 0x7E, 0xE2, 0x71, 0xE8, 
-    0xCD, 0xF0, 0x15, 0xFB, 0x52, 0x04, 0x91, 0x0A, 0x13, 0x10, 0xBF, 0x14, 0x30, 0x18, 0x13, 0x19, 
-    0xED, 0x15, 0x6B, 0x10, 0x1C, 0x0B, 0x24, 0x06, 0x18, 0x03, 0x28, 0x02, 0x39, 0x01, 0x00, 0x00, 
-    0x58, 0xFD, 0xD1, 0xF8, 0xB0, 0xF4, 0xE2, 0xF1, 0x5C, 0xF0, 0xEB, 0xEF, 0xC5, 0xEF, 0xF7, 0xEF, 
-    0x8A, 0xF1, 0x3A, 0xF5, 0x8A, 0xFA, 0x52, 0x01, 0xD0, 0x07, 0x20, 0x0D, 0x28, 0x11, 0x20, 0x13, 
-    0xBB, 0x12, 0x46, 0x10, 0xFE, 0x0B, 0x24, 0x06, 0xC1, 0xFF, 0xF7, 0xF8, 0x9F, 0xF2, 0x58, 0xEE, 
-    0xAC, 0xEC, 0x5C, 0xED, 0xDE, 0xEF, 0x36, 0xF3, 0xDA, 0xF6, 0x71, 0xFA, 0xE2, 0xFD, 0x6C, 0x01, 
-    0x0F, 0x05, 0x85, 0x07, 0x24, 0x09, 0x4A, 0x09, 0x41, 0x08, 0xE1, 0x06, 0xE9, 0x04, 0xFE, 0x02, 
-    0xC8, 0x00, 0x60, 0xFE, 0xC5, 0xFB, 0xEB, 0xF8, 0x64, 0xF7, 0x00, 0xF7, 0x64, 0xF7, 0xB8, 0xF8, 
-    0xB0, 0xFA, 0x9B, 0xFC, 0xEB, 0xFE, 0x13, 0x01, 0x74, 0x02, 0x5F, 0x04, 0x35, 0x05, 0x1C, 0x05, 
-    0x6C, 0x04, 0x9A, 0x02, 0x89, 0x00, 0x43, 0xFF, 0xD6, 0xFD, 0x71, 0xFD, 0xA3, 0xFD, 0xA3, 0xFD, 
-    0xEF, 0xFD, 0x6D, 0xFE, 0x86, 0xFE, 0x1D, 0xFF, 0x82, 0xFF, 0x43, 0xFF, 0xC1, 0xFF, 0xB4, 0xFF, 
-    0x68, 0xFF, 0xF3, 0xFF, 0x57, 0x00, 0xFA, 0x00, 0xF6, 0x01, 0xF6, 0x01, 0x85, 0x01, 0xD5, 0x00, 
-    0x75, 0xFF, 0x2E, 0xFE, 0x00, 0xFD, 0xC5, 0xFB, 0x08, 0xFB, 0xE2, 0xFA, 0xE2, 0xFA, 0x92, 0xFB, 
-    0xB4, 0xFC, 0xB0, 0xFD, 0xC5, 0xFE, 0xA7, 0xFF, 0x31, 0x00, 0xBB, 0x00, 0xC8, 0x00, 0x70, 0x00, 
-    0xE6, 0xFF, 0x43, 0xFF, 0x92, 0xFE, 0x7D, 0xFD, 0xC1, 0xFC, 0x2A, 0xFC, 0x10, 0xFC, 0x5C, 0xFC, 
-    0x8E, 0xFC, 0x32, 0xFD, 0x97, 0xFD, 0x15, 0xFE, 0x3A, 0xFE, 0x92, 0xFE, 0x5C, 0xFF, 0xC1, 0xFF, 
-    0x96, 0x00, 0xAF, 0x00, 0x4A, 0x00, 0x24, 0x00, 0x00, 0x00, 0xB4, 0xFF, 0xD1, 0xFE, 0x4B, 0xFD, 
-    0x2A, 0xFC, 0x7E, 0xFA, 0x00, 0xFA, 0xFB, 0xFA, 0xB8, 0xFB, 0x64, 0xFD, 0x53, 0xFE, 0xE2, 0xFD, 
-    0x79, 0xFE, 0x79, 0xFE, 0x60, 0xFE, 0x21, 0xFE, 0xC1, 0xFC, 0x08, 0xFB, 0xA7, 0xF9, 0x10, 0xF9, 
-    0x3A, 0xF8, 0x9F, 0xF8, 0x6D, 0xF8, 0x82, 0xF9, 0x52, 0x04, 0x28, 0x14, 0x49, 0x24, 0x7B, 0x30, 
-    0x84, 0x31, 0x80, 0x2C, 0x49, 0x24, 0xE1, 0x18, 0x28, 0x0E, 0x96, 0x03, 0x15, 0xF8, 0x36, 0xED, 
-    0x76, 0xE4, 0x1E, 0xDE, 0xF8, 0xDD, 0x82, 0xE4, 0xF3, 0xED, 0xD6, 0xFA, 0x70, 0x06, 0x74, 0x0E, 
-    0xD4, 0x15, 0x3D, 0x1B, 0x35, 0x1D, 0xA2, 0x1B, 0x13, 0x16, 0x9A, 0x0E, 0xE9, 0x07, 0xDD, 0x01, 
-    0x19, 0xFD, 0x3A, 0xFB, 0x25, 0xFA, 0x4F, 0xF9, 0x3A, 0xF8, 0x2A, 0xF6, 0xE2, 0xF4, 0xD6, 0xF4, 
-    0xD6, 0xF4, 0xA3, 0xF4, 0x3F, 0xF4, 0x0C, 0xF4, 0x08, 0xF5, 0x21, 0xF8, 0x5C, 0xFC, 0x5F, 0x01, 
-    0x89, 0x06, 0xD0, 0x0A, 0x80, 0x0E, 0x2C, 0x10, 0x89, 0x0F, 0x52, 0x0D, 0xD4, 0x09, 0x03, 0x05, 
-    0x4F, 0xFF, 0x04, 0xF9, 0x5C, 0xF3, 0xAC, 0xEF, 0x4B, 0xEE, 0x3B, 0xEF, 0xEF, 0xF1, 0xAC, 0xF5, 
-    0x82, 0xF9, 0x64, 0xFD, 0xE1, 0x00, 0x39, 0x04, 0x46, 0x07, 0x3D, 0x09, 0xAF, 0x09, 0x8D, 0x08, 
-    0x24, 0x06, 0x70, 0x03, 0xEE, 0x00, 0x53, 0xFE, 0xEB, 0xFB, 0x00, 0xFA, 0x86, 0xF8, 0xFB, 0xF7, 
-    0x15, 0xF8, 0xB8, 0xF8, 0x19, 0xFA, 0x9F, 0xFB, 0x32, 0xFD, 0x60, 0xFE, 0x18, 0x00, 0x42, 0x02, 
-    0xC8, 0x03, 0x1C, 0x05, 0xD9, 0x05, 0xBF, 0x05, 0x67, 0x05, 0x5F, 0x04, 0xCC, 0x02, 0xEE, 0x00, 
-    0x29, 0xFF, 0x8A, 0xFD, 0x36, 0xFC, 0x8A, 0xFA, 0x2A, 0xF9, 0xF7, 0xF8, 0xA7, 0xF9, 0x2E, 0xFB, 
-    0x58, 0xFD, 0x82, 0xFF, 0xB7, 0x01, 0x46, 0x04, 0xFE, 0x05, 0xEE, 0x06, 0x6B, 0x07, 0x63, 0x06, 
-    0xE9, 0x04, 0x9A, 0x02, 0x8E, 0xFF, 0x64, 0xFD, 0x92, 0xFB, 0x64, 0xFA, 0x3F, 0xFA, 0x7E, 0xFA, 
-    0xEF, 0xFA, 0x75, 0xFC, 0x3A, 0xFE, 0x00, 0x00, 0x9E, 0x01, 0x5B, 0x02, 0x81, 0x02, 0x42, 0x02, 
-    0xC4, 0x01, 0x07, 0x01, 0x0B, 0x00, 0x92, 0xFE, 0x0C, 0xFD, 0xF7, 0xFB, 0x15, 0xFB, 0x97, 0xFA, 
-    0xC9, 0xFA, 0xE2, 0xFA, 0x15, 0xFB, 0x92, 0xFB, 0x36, 0xFC, 0x71, 0xFD, 0x04, 0xFF, 0x4A, 0x00, 
-    0x13, 0x01, 0x5F, 0x01, 0x5F, 0x01, 0x5F, 0x01, 0x85, 0x01, 0x13, 0x01, 0x4A, 0x00, 0xD1, 0xFE, 
-    0xCD, 0xFC, 0x15, 0xFB, 0xC1, 0xF9, 0x2A, 0xF9, 0xDE, 0xF8, 0xF7, 0xF8, 0x32, 0xFA, 0x60, 0xFB, 
-    0x8E, 0xFC, 0xC9, 0xFD, 0xDE, 0xFE, 0x24, 0x00, 0xEE, 0x00, 0x20, 0x01, 0x18, 0x00, 0x92, 0xFE, 
-    0xDA, 0xFC, 0x60, 0xFB, 0x64, 0xFA, 0x2A, 0xF9, 0x47, 0xF8, 0x32, 0xF7, 0xE6, 0xF6, 0xA8, 0xF6, 
-    0x8E, 0xF6, 0xDE, 0xF5, 0x82, 0xF9, 0xC4, 0x07, 0x6B, 0x19, 0x95, 0x2A, 0x45, 0x34, 0xFE, 0x32, 
-    0x95, 0x2D, 0x28, 0x23, 0x80, 0x17, 0xFE, 0x0B, 0xA7, 0xFF, 0x8E, 0xF3, 0x75, 0xE7, 0xD2, 0xDD, 
-    0x2E, 0xD7, 0x58, 0xD9, 0xFC, 0xE2, 0x43, 0xF0, 0x89, 0x00, 0xBB, 0x0C, 0x5F, 0x16, 0x63, 0x1E, 
-    0xE0, 0x21, 0x63, 0x21, 0x84, 0x1C, 0x0B, 0x15, 0xD4, 0x0C, 0xE9, 0x04, 0x25, 0xFD, 0xEF, 0xF7, 
-    0x10, 0xF6, 0x86, 0xF5, 0xA8, 0xF6, 0x3F, 0xF7, 0x71, 0xF7, 0x79, 0xF8, 0x5C, 0xF9, 0x8E, 0xF9, 
-    0x2E, 0xF8, 0x5C, 0xF6, 0x79, 0xF5, 0x82, 0xF6, 0x36, 0xF9, 0x82, 0xFC, 0x70, 0x00, 0xB7, 0x04, 
-    0x89, 0x09, 0xE9, 0x0D, 0x0F, 0x11, 0x4A, 0x12, 0xD0, 0x10, 0xFA, 0x0C, 0xA2, 0x06, 0xB8, 0xFE, 
-    0x25, 0xF7, 0x8E, 0xF0, 0x9F, 0xEC, 0x3F, 0xEB, 0x2E, 0xEC, 0xE2, 0xEE, 0x2A, 0xF3, 0x2E, 0xF8, 
-    0x64, 0xFD, 0xFE, 0x02, 0x03, 0x08, 0xF2, 0x0B, 0x28, 0x0E, 0x52, 0x0D, 0xC4, 0x0A, 0x6B, 0x07, 
-    0xBB, 0x03, 0x3D, 0x00, 0xF3, 0xFC, 0xF3, 0xF9, 0xBD, 0xF7, 0x4F, 0xF6, 0x79, 0xF5, 0xD2, 0xF5, 
-    0x3F, 0xF7, 0xB4, 0xF9, 0x10, 0xFC, 0xD6, 0xFD, 0x1D, 0xFF, 0x57, 0x00, 0x67, 0x02, 0x5F, 0x04, 
-    0xBF, 0x05, 0x95, 0x06, 0x63, 0x06, 0x5B, 0x05, 0xD4, 0x03, 0x78, 0x01, 0xD1, 0xFE, 0xA7, 0xFC, 
-    0x97, 0xFA, 0xDE, 0xF8, 0x08, 0xF8, 0xB0, 0xF7, 0xC5, 0xF8, 0x3A, 0xFB, 0xFB, 0xFD, 0x6C, 0x01, 
-    0x9E, 0x04, 0x13, 0x07, 0x24, 0x09, 0x46, 0x0A, 0x20, 0x0A, 0x56, 0x09, 0x6B, 0x07, 0x28, 0x05, 
-    0xE5, 0x02, 0xC8, 0x00, 0x36, 0xFF, 0xB0, 0xFD, 0x4F, 0xFC, 0xEF, 0xFA, 0xCD, 0xF9, 0x75, 0xF9, 
-    0x9B, 0xF9, 0x7E, 0xFA, 0x54, 0xFB, 0x43, 0xFC, 0x71, 0xFD, 0x6D, 0xFE, 0xDA, 0xFF, 0x5F, 0x01, 
-    0xD9, 0x02, 0xEE, 0x03, 0x39, 0x04, 0x89, 0x03, 0x0F, 0x02, 0x31, 0x00, 0x15, 0xFE, 0xDE, 0xFB, 
-    0x32, 0xFA, 0x10, 0xF9, 0x6D, 0xF8, 0x6D, 0xF8, 0x04, 0xF9, 0x58, 0xFA, 0x82, 0xFC, 0x79, 0xFE, 
-    0x57, 0x00, 0xD0, 0x01, 0x74, 0x02, 0xF2, 0x02, 0xCC, 0x02, 0xB7, 0x01, 0x96, 0x00, 0xD1, 0xFE, 
-    0x3F, 0xFD, 0x10, 0xFC, 0xEF, 0xFA, 0x4B, 0xFA, 0xF3, 0xF9, 0x25, 0xFA, 0xE2, 0xFA, 0xD1, 0xFB, 
-    0xC1, 0xFC, 0x19, 0xFD, 0x8A, 0xFD, 0xEF, 0xFD, 0x92, 0xFE, 0x5C, 0xFF, 0xC5, 0xFE, 0x86, 0xFE, 
-    0x2E, 0xFE, 0x3F, 0xFD, 0xF3, 0xFC, 0x2E, 0xFB, 0x0C, 0xFA, 0x8E, 0xF9, 0x9F, 0xF8, 0xB8, 0xF8, 
-    0x21, 0xF8, 0x97, 0xF7, 0x32, 0xF7, 0x2A, 0xF6, 0x3A, 0xF5, 0xEB, 0xF8, 0xC8, 0x06, 0x20, 0x19, 
-    0xFA, 0x2A, 0x02, 0x35, 0xC7, 0x33, 0xF9, 0x2D, 0xD8, 0x23, 0xAE, 0x18, 0xDD, 0x0D, 0xC4, 0x01, 
-    0xD2, 0xF5, 0xDE, 0xE9, 0x3F, 0xDF, 0x04, 0xD8, 0x26, 0xD9, 0xE7, 0xE1, 0x3B, 0xEF, 0x10, 0xFF, 
-    0x28, 0x0B, 0x80, 0x14, 0xBB, 0x1B, 0x06, 0x1F, 0xFA, 0x1E, 0x24, 0x1B, 0x0B, 0x15, 0xDD, 0x0D, 
-    0x63, 0x06, 0x10, 0xFF, 0x10, 0xF9, 0x8E, 0xF6, 0x36, 0xF6, 0x7E, 0xF7, 0xDE, 0xF8, 0xF7, 0xF8, 
-    0x5C, 0xF9, 0x43, 0xF9, 0xAC, 0xF8, 0x0C, 0xF7, 0xEB, 0xF5, 0xF7, 0xF5, 0x25, 0xF7, 0xCD, 0xF9, 
-    0x5C, 0xFC, 0xB4, 0xFF, 0x91, 0x04, 0x20, 0x0A, 0xBB, 0x0F, 0xAA, 0x13, 0xCC, 0x14, 0x89, 0x12, 
-    0x91, 0x0D, 0x57, 0x06, 0x21, 0xFE, 0xA8, 0xF6, 0x8E, 0xF0, 0xD2, 0xEC, 0x58, 0xEB, 0xE2, 0xEB, 
-    0x65, 0xEE, 0xDE, 0xF2, 0x9F, 0xF8, 0x21, 0xFE, 0x70, 0x03, 0x78, 0x07, 0x39, 0x0A, 0x8D, 0x0B, 
-    0x85, 0x0A, 0x1C, 0x08, 0x8D, 0x05, 0x67, 0x02, 0x75, 0xFF, 0xA7, 0xFC, 0xCD, 0xF9, 0x6D, 0xF8, 
-    0x47, 0xF8, 0x86, 0xF8, 0xC1, 0xF9, 0x47, 0xFB, 0xE6, 0xFC, 0xDE, 0xFE, 0x4A, 0x00, 0x20, 0x01, 
-    0x4E, 0x02, 0x57, 0x03, 0xFA, 0x03, 0xAA, 0x04, 0x07, 0x04, 0x24, 0x03, 0x1C, 0x02, 0x63, 0x00, 
-    0xD1, 0xFE, 0x32, 0xFD, 0x04, 0xFC, 0x60, 0xFB, 0x54, 0xFB, 0x6D, 0xFB, 0x1D, 0xFC, 0x64, 0xFD, 
-    0xD1, 0xFE, 0xFA, 0x00, 0xF2, 0x02, 0xD0, 0x04, 0x63, 0x06, 0xBB, 0x06, 0xEE, 0x06, 0x3D, 0x06, 
-    0x5B, 0x05, 0x52, 0x04, 0x81, 0x02, 0xC8, 0x00, 0x86, 0xFE, 0x5C, 0xFC, 0x8A, 0xFA, 0x2A, 0xF9, 
-    0x86, 0xF8, 0x79, 0xF8, 0x43, 0xF9, 0xA3, 0xFA, 0x82, 0xFC, 0x86, 0xFE, 0x24, 0x00, 0xE9, 0x01, 
-    0xF2, 0x02, 0x07, 0x04, 0x85, 0x04, 0x85, 0x04, 0xD4, 0x03, 0x35, 0x02, 0x89, 0x00, 0xDE, 0xFE, 
-    0x58, 0xFD, 0x1D, 0xFC, 0x08, 0xFB, 0x19, 0xFA, 0xA7, 0xF9, 0x8E, 0xF9, 0xC1, 0xF9, 0xD6, 0xFA, 
-    0x68, 0xFC, 0xE2, 0xFD, 0x4F, 0xFF, 0x31, 0x00, 0xEE, 0x00, 0xF6, 0x01, 0xE5, 0x02, 0x57, 0x03, 
-    0x0B, 0x03, 0x03, 0x02, 0x4A, 0x00, 0x10, 0xFF, 0xB0, 0xFD, 0xD1, 0xFB, 0x64, 0xFA, 0x54, 0xF8, 
-    0xDA, 0xF6, 0x75, 0xF6, 0xA8, 0xF6, 0x3A, 0xF8, 0xC9, 0xFA, 0xC9, 0xFD, 0x70, 0x00, 0x18, 0x03, 
-    0xEE, 0x03, 0xE5, 0x02, 0xDD, 0x01, 0x68, 0xFF, 0x19, 0xFD, 0x86, 0xFB, 0x04, 0xF9, 0x08, 0xF8, 
-    0xD6, 0xF7, 0x4B, 0xF7, 0x3F, 0xF7, 0xE6, 0xF6, 0x9B, 0xF6, 0x19, 0xF7, 0x6D, 0xF8, 0x10, 0xF9, 
-    0xCD, 0xF9, 0xB4, 0xF9, 0xEF, 0xF7, 0xC5, 0xFE, 0x74, 0x0E, 0xE5, 0x20, 0x6B, 0x31, 0x06, 0x37, 
-    0xE0, 0x33, 0x1B, 0x2C, 0xBF, 0x20, 0x99, 0x14, 0xD9, 0x08, 0x97, 0xFD, 0x58, 0xF1, 0x6D, 0xE6, 
-    0xDA, 0xDB, 0x72, 0xD6, 0x76, 0xDB, 0x08, 0xE6, 0x2E, 0xF5, 0x39, 0x04, 0xE5, 0x0E, 0x28, 0x17, 
-    0x84, 0x1C, 0x88, 0x1E, 0xF6, 0x1C, 0x45, 0x19, 0xFA, 0x12, 0x74, 0x0B, 0x96, 0x03, 0x47, 0xFB, 
-    0xE6, 0xF6, 0x10, 0xF6, 0x8A, 0xF7, 0x4B, 0xFA, 0xB8, 0xFB, 0x1D, 0xFC, 0xB8, 0xFB, 0x97, 0xFA, 
-    0x47, 0xF8, 0xAC, 0xF5, 0xD6, 0xF4, 0xB0, 0xF4, 0xF7, 0xF5, 0x08, 0xF8, 0xBC, 0xFA, 0xA7, 0xFF, 
-    0x24, 0x06, 0x46, 0x0D, 0x5F, 0x13, 0x02, 0x17, 0xC3, 0x16, 0x39, 0x13, 0x52, 0x0D, 0x4E, 0x05, 
-    0x8A, 0xFD, 0x4F, 0xF6, 0xF7, 0xEF, 0xD6, 0xEB, 0xEB, 0xE9, 0x5C, 0xEA, 0xCD, 0xED, 0x36, 0xF3, 
-    0x75, 0xF9, 0x75, 0xFF, 0xDD, 0x04, 0xE5, 0x08, 0xBF, 0x0B, 0xBB, 0x0C, 0x74, 0x0B, 0x3D, 0x09, 
-    0xF2, 0x05, 0xD0, 0x01, 0xFB, 0xFD, 0x0C, 0xFA, 0xA3, 0xF7, 0xCD, 0xF6, 0x82, 0xF6, 0x19, 0xF7, 
-    0x93, 0xF8, 0x97, 0xFA, 0xE6, 0xFC, 0xEB, 0xFE, 0x18, 0x00, 0xAB, 0x01, 0x89, 0x03, 0xB7, 0x04, 
-    0xA6, 0x05, 0x8D, 0x05, 0xDD, 0x04, 0xFA, 0x03, 0x5B, 0x02, 0x31, 0x00, 0x53, 0xFE, 0xA7, 0xFC, 
-    0x86, 0xFB, 0xEF, 0xFA, 0x64, 0xFA, 0x4B, 0xFA, 0x60, 0xFB, 0x32, 0xFD, 0x43, 0xFF, 0x52, 0x01, 
-    0x81, 0x02, 0xE1, 0x03, 0xDD, 0x04, 0x67, 0x05, 0x42, 0x05, 0x9E, 0x04, 0xFA, 0x03, 0x5B, 0x02, 
-    0xE1, 0x00, 0x43, 0xFF, 0x32, 0xFD, 0xF3, 0xFC, 0x5C, 0xFC, 0xEB, 0xFB, 0x04, 0xFC, 0xD1, 0xFB, 
-    0xF7, 0xFB, 0x68, 0xFC, 0xA7, 0xFC, 0x00, 0xFD, 0xEF, 0xFD, 0x9F, 0xFE, 0x29, 0xFF, 0x3D, 0x00, 
-    0x96, 0x00, 0xDD, 0x01, 0xFE, 0x02, 0x4A, 0x03, 0x24, 0x03, 0x5B, 0x02, 0x46, 0x01, 0x63, 0x00, 
-    0x9B, 0xFF, 0x86, 0xFE, 0xBC, 0xFD, 0xF3, 0xFC, 0x36, 0xFC, 0x2A, 0xFC, 0x1D, 0xFC, 0xC1, 0xFC, 
-    0x97, 0xFD, 0x60, 0xFE, 0x43, 0xFF, 0xA7, 0xFF, 0x24, 0x00, 0x4A, 0x00, 0x57, 0x00, 0x00, 0x00, 
-    0x75, 0xFF, 0x29, 0xFF, 0x86, 0xFE, 0x15, 0xFE, 0x8A, 0xFD, 0xDA, 0xFC, 0xA7, 0xFC, 0x8E, 0xFC, 
-    0x5C, 0xFC, 0x43, 0xFC, 0x9B, 0xFC, 0xC1, 0xFC, 0x00, 0xFD, 0xF3, 0xFC, 0xEB, 0xFB, 0x47, 0xFB, 
-    0xBC, 0xFA, 0x64, 0xFA, 0xFB, 0xFA, 0x3A, 0xFB, 0x54, 0xFB, 0x43, 0xFC, 0xE6, 0xFC, 0x19, 0xFD, 
-    0x8A, 0xFD, 0x8E, 0xFC, 0x86, 0xFB, 0x25, 0xFA, 0xA3, 0xF7, 0x4F, 0xF6, 0x93, 0xF5, 0x86, 0xF5, 
-    0xDE, 0xF5, 0xE2, 0xF4, 0x86, 0xF5, 0x82, 0xFF, 0x95, 0x12, 0x67, 0x26, 0xC3, 0x34, 0x80, 0x38, 
-    0x23, 0x33, 0x56, 0x2A, 0x3D, 0x1E, 0x8D, 0x11, 0x0B, 0x06, 0x00, 0xFA, 0x9B, 0xED, 0x76, 0xE1, 
-    0xBD, 0xD6, 0x72, 0xD3, 0xA0, 0xDA, 0x0D, 0xE8, 0x08, 0xF8, 0xA2, 0x06, 0xC3, 0x10, 0x30, 0x18, 
-    0x35, 0x1D, 0x63, 0x1E, 0x78, 0x1C, 0x7C, 0x18, 0x6F, 0x12, 0x41, 0x0B, 0xE5, 0x02, 0x86, 0xFB, 
-    0x15, 0xF8, 0x60, 0xF8, 0x71, 0xFA, 0x8E, 0xFC, 0xCD, 0xFC, 0x92, 0xFB, 0xDA, 0xF9, 0x21, 0xF8, 
-    0x4F, 0xF6, 0xEB, 0xF5, 0xB4, 0xF6, 0xEF, 0xF7, 0x5C, 0xF9, 0xFB, 0xFA, 0xEF, 0xFD, 0xF2, 0x02, 
-    0x89, 0x09, 0xD4, 0x0F, 0xDD, 0x13, 0x80, 0x14, 0xBF, 0x11, 0xD4, 0x0C, 0x89, 0x06, 0xF3, 0xFF, 
-    0x9B, 0xF9, 0xDA, 0xF3, 0xEF, 0xEE, 0x7E, 0xEB, 0x8F, 0xEA, 0x54, 0xEC, 0x0C, 0xF1, 0x3F, 0xF7, 
-    0xCD, 0xFC, 0x52, 0x01, 0x9E, 0x04, 0x39, 0x07, 0x0B, 0x09, 0x95, 0x09, 0xBF, 0x08, 0xE1, 0x06, 
-    0x46, 0x04, 0xFA, 0x00, 0x7D, 0xFD, 0x97, 0xFA, 0xB8, 0xF8, 0x3A, 0xF8, 0x60, 0xF8, 0xF7, 0xF8, 
-    0x3F, 0xFA, 0xD1, 0xFB, 0x97, 0xFD, 0x1D, 0xFF, 0x70, 0x00, 0xAB, 0x01, 0xCC, 0x02, 0x18, 0x03, 
-    0xE5, 0x02, 0x4E, 0x02, 0xDD, 0x01, 0xD0, 0x01, 0xAB, 0x01, 0x6C, 0x01, 0x52, 0x01, 0x46, 0x01, 
-    0x13, 0x01, 0xAF, 0x00, 0xE6, 0xFF, 0x10, 0xFF, 0xD1, 0xFE, 0x9F, 0xFE, 0x3A, 0xFE, 0x15, 0xFE, 
-    0x21, 0xFE, 0xAC, 0xFE, 0x82, 0xFF, 0x00, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 
-    0x75, 0xFF, 0x4F, 0xFF, 0xDA, 0xFF, 0xF3, 0xFF, 0x70, 0x00, 0x0B, 0x00, 0xC5, 0xFE, 0x9F, 0xFE, 
-    0xEF, 0xFD, 0x08, 0xFE, 0x79, 0xFE, 0x79, 0xFE, 0xB8, 0xFE, 0xDE, 0xFE, 0xC5, 0xFE, 0x1D, 0xFF, 
-    0xF3, 0xFF, 0x7C, 0x00, 0xFA, 0x00, 0x13, 0x01, 0x70, 0x00, 0x4A, 0x00, 0x24, 0x00, 0x24, 0x00, 
-    0x4A, 0x00, 0x3D, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0xA2, 0x00, 0x63, 0x00, 
-    0xCD, 0xFF, 0x4F, 0xFF, 0xC5, 0xFE, 0xDE, 0xFE, 0x68, 0xFF, 0x82, 0xFF, 0x75, 0xFF, 0xEB, 0xFE, 
-    0x2E, 0xFE, 0xA3, 0xFD, 0x00, 0xFD, 0x5C, 0xFC, 0x10, 0xFC, 0x04, 0xFC, 0x1D, 0xFC, 0xA7, 0xFC, 
-    0x25, 0xFD, 0x32, 0xFD, 0x4B, 0xFD, 0xB0, 0xFD, 0xB0, 0xFD, 0xD6, 0xFD, 0xE2, 0xFD, 0xB4, 0xFC, 
-    0x9B, 0xFC, 0xA7, 0xFC, 0x4F, 0xFC, 0x82, 0xFC, 0x8E, 0xFC, 0x04, 0xFC, 0x36, 0xFC, 0x9F, 0xFB, 
-    0x0C, 0xFA, 0x69, 0xF9, 0xF7, 0xF8, 0xC5, 0xF8, 0xC1, 0xF9, 0x43, 0xF9, 0x69, 0xF9, 0x19, 0xFA, 
-    0x4B, 0xFA, 0xD6, 0xFA, 0xD6, 0xFA, 0x2A, 0xF9, 0x9F, 0xF8, 0x39, 0x01, 0x5F, 0x10, 0xA2, 0x21, 
-    0xF1, 0x2F, 0x30, 0x33, 0x23, 0x30, 0x6F, 0x27, 0x95, 0x1B, 0xF6, 0x10, 0x95, 0x06, 0x25, 0xFD, 
-    0xEF, 0xF1, 0x15, 0xE6, 0x54, 0xDA, 0xC1, 0xD5, 0x1E, 0xDB, 0xA4, 0xE5, 0x15, 0xF5, 0xD9, 0x02, 
-    0xED, 0x0C, 0x56, 0x15, 0xE9, 0x19, 0x84, 0x1C, 0xE9, 0x1C, 0x06, 0x1C, 0x63, 0x18, 0x4A, 0x12, 
-    0xD4, 0x09, 0xEE, 0x00, 0xC1, 0xFC, 0x3A, 0xFB, 0x04, 0xFC, 0xC1, 0xFC, 0x7E, 0xFA, 0x08, 0xF8, 
-    0xFC, 0xF4, 0x79, 0xF2, 0x58, 0xF1, 0x3B, 0xF2, 0x8A, 0xF4, 0xE6, 0xF6, 0x43, 0xF9, 0xB0, 0xFA, 
-    0xEF, 0xFD, 0x57, 0x03, 0xAF, 0x09, 0x5F, 0x10, 0x67, 0x14, 0x24, 0x15, 0x7C, 0x12, 0xFA, 0x0C, 
-    0x31, 0x06, 0x43, 0xFF, 0xB8, 0xF8, 0x60, 0xF2, 0x1D, 0xED, 0x15, 0xE9, 0x8F, 0xE7, 0xEB, 0xE9, 
-    0xE2, 0xEE, 0x54, 0xF5, 0x79, 0xFB, 0x89, 0x00, 0xC4, 0x04, 0x28, 0x08, 0x78, 0x0A, 0x1C, 0x0B, 
-    0x85, 0x0A, 0x9A, 0x08, 0x80, 0x05, 0x78, 0x01, 0x19, 0xFD, 0x25, 0xFA, 0xB8, 0xF8, 0x86, 0xF8, 
-    0x04, 0xF9, 0xB4, 0xF9, 0xEF, 0xFA, 0xB4, 0xFC, 0x53, 0xFE, 0x68, 0xFF, 0x7C, 0x00, 0x91, 0x01, 
-    0x81, 0x02, 0xF2, 0x02, 0xF2, 0x02, 0x31, 0x03, 0x96, 0x03, 0x5F, 0x04, 0x91, 0x04, 0xE1, 0x03, 
-    0xCC, 0x02, 0x85, 0x01, 0x0B, 0x00, 0x92, 0xFE, 0x9B, 0xFC, 0xE2, 0xFA, 0x8E, 0xF9, 0x9F, 0xF8, 
-    0x9F, 0xF8, 0x69, 0xF9, 0xE2, 0xFA, 0x19, 0xFD, 0x68, 0xFF, 0xEE, 0x00, 0xF6, 0x01, 0xBF, 0x02, 
-    0xB3, 0x02, 0xA6, 0x02, 0xDD, 0x01, 0x4A, 0x00, 0xF7, 0xFE, 0x4B, 0xFD, 0x92, 0xFB, 0x97, 0xFA, 
-    0x25, 0xFA, 0xEF, 0xFA, 0x82, 0xFC, 0xC1, 0xFF, 0xF6, 0x01, 0x4A, 0x03, 0x28, 0x05, 0x85, 0x04, 
-    0x91, 0x04, 0x28, 0x05, 0xBB, 0x03, 0xFA, 0x03, 0xFE, 0x02, 0x52, 0x01, 0x96, 0x00, 0xA7, 0xFF, 
-    0x92, 0xFE, 0xD1, 0xFE, 0x79, 0xFE, 0x3F, 0xFD, 0x71, 0xFD, 0x58, 0xFD, 0x8A, 0xFD, 0xA7, 0xFF, 
-    0x70, 0x00, 0x91, 0x01, 0xBF, 0x02, 0x0B, 0x03, 0xAF, 0x03, 0x13, 0x04, 0x89, 0x03, 0xA6, 0x02, 
-    0xE1, 0x00, 0xB0, 0xFD, 0x54, 0xFB, 0x5C, 0xF9, 0xFB, 0xF7, 0x47, 0xF8, 0xB8, 0xF8, 0xDA, 0xF9, 
-    0x79, 0xFB, 0x25, 0xFD, 0x1D, 0xFF, 0xE1, 0x00, 0x81, 0x02, 0xA2, 0x03, 0xE1, 0x03, 0x0B, 0x03, 
-    0x07, 0x01, 0xD1, 0xFE, 0xF3, 0xFC, 0x79, 0xFB, 0x15, 0xFB, 0x21, 0xFB, 0x15, 0xFB, 0x15, 0xFB, 
-    0x79, 0xFB, 0x47, 0xFB, 0x79, 0xFB, 0xEB, 0xFB, 0xC5, 0xFB, 0x79, 0xFB, 0xB0, 0xFA, 0x04, 0xF9, 
-    0x86, 0xF8, 0xEB, 0xF8, 0xC1, 0xF9, 0xB0, 0xFA, 0x08, 0xFB, 0x32, 0xFA, 0x10, 0xF9, 0x08, 0xF8, 
-    0xC1, 0xF6, 0x36, 0xF6, 0x75, 0xF6, 0xD6, 0xFD, 0x20, 0x0D, 0xD4, 0x1E, 0x9D, 0x2E, 0x41, 0x35, 
-    0xC7, 0x33, 0xBF, 0x2C, 0xFE, 0x20, 0x3D, 0x15, 0xA6, 0x08, 0x68, 0xFC, 0x86, 0xEF, 0x4C, 0xE2, 
-    0x8B, 0xD6, 0x93, 0xD1, 0x15, 0xD7, 0x93, 0xE3, 0x79, 0xF5, 0x95, 0x06, 0x20, 0x13, 0xB2, 0x1D, 
-    0xE9, 0x22, 0x6B, 0x25, 0xED, 0x24, 0xBF, 0x20, 0x28, 0x1A, 0xD0, 0x10, 0x35, 0x05, 0x71, 0xFA, 
-    0x25, 0xF4, 0xEF, 0xF1, 0x75, 0xF3, 0x75, 0xF6, 0x00, 0xF7, 0x64, 0xF7, 0xE6, 0xF6, 0x43, 0xF6, 
-    0xE6, 0xF6, 0xB0, 0xF7, 0xDE, 0xF8, 0x69, 0xF9, 0x5C, 0xF9, 0xF7, 0xF8, 0x71, 0xFA, 0xAC, 0xFE, 
-    0xAA, 0x04, 0xCC, 0x0B, 0x78, 0x10, 0x6F, 0x12, 0x5B, 0x11, 0x46, 0x0D, 0x67, 0x08, 0x9A, 0x02, 
-    0xB4, 0xFC, 0xB4, 0xF6, 0x9B, 0xF0, 0x15, 0xEC, 0xF8, 0xE9, 0x4B, 0xEB, 0xAC, 0xEF, 0xAC, 0xF5, 
-    0x3A, 0xFB, 0xE6, 0xFF, 0x07, 0x04, 0xD4, 0x06, 0x89, 0x09, 0x0F, 0x0B, 0xE9, 0x0A, 0xEE, 0x09, 
-    0x46, 0x07, 0xC8, 0x03, 0xA2, 0x00, 0xFB, 0xFD, 0xB4, 0xFC, 0x5C, 0xFC, 0x04, 0xFC, 0x92, 0xFB, 
-    0x79, 0xFB, 0x6D, 0xFB, 0xD1, 0xFB, 0x9B, 0xFC, 0x32, 0xFD, 0x6D, 0xFE, 0xDA, 0xFF, 0xFA, 0x00, 
-    0x8D, 0x02, 0xEE, 0x03, 0x35, 0x05, 0x7C, 0x06, 0x57, 0x06, 0xDD, 0x04, 0x1C, 0x02, 0xDE, 0xFE, 
-    0x86, 0xFB, 0x10, 0xF9, 0x8A, 0xF7, 0xA8, 0xF6, 0x3F, 0xF7, 0x54, 0xF8, 0xCD, 0xF9, 0xF7, 0xFB, 
-    0xFB, 0xFD, 0x57, 0x00, 0x67, 0x02, 0x96, 0x03, 0xD4, 0x03, 0x57, 0x03, 0x35, 0x02, 0x96, 0x00, 
-    0x29, 0xFF, 0x8A, 0xFD, 0x8E, 0xFC, 0x68, 0xFC, 0xDE, 0xFB, 0xB8, 0xFB, 0xEB, 0xFB, 0x75, 0xFC, 
-    0xA3, 0xFD, 0xF7, 0xFE, 0x63, 0x00, 0x52, 0x01, 0x81, 0x02, 0x31, 0x03, 0xE1, 0x03, 0xF6, 0x04, 
-    0x67, 0x05, 0x18, 0x06, 0xFE, 0x05, 0xA2, 0x06, 0x70, 0x06, 0x85, 0x04, 0x57, 0x03, 0x4A, 0x00, 
-    0x25, 0xFD, 0xB8, 0xFB, 0x43, 0xF9, 0x4F, 0xF9, 0x4B, 0xFA, 0x47, 0xFB, 0x32, 0xFD, 0xAC, 0xFE, 
-    0x36, 0xFF, 0xA2, 0x00, 0x74, 0x02, 0xFE, 0x02, 0xB7, 0x04, 0x28, 0x05, 0x57, 0x03, 0xBF, 0x02, 
-    0x89, 0x00, 0xB8, 0xFE, 0x47, 0xFE, 0x3F, 0xFD, 0xE6, 0xFC, 0xE6, 0xFC, 0x68, 0xFC, 0x9B, 0xFC, 
-    0x58, 0xFD, 0x7D, 0xFD, 0x53, 0xFE, 0x36, 0xFF, 0x29, 0xFF, 0x68, 0xFF, 0xD1, 0xFE, 0x47, 0xFE, 
-    0x2E, 0xFE, 0x60, 0xFE, 0xF7, 0xFE, 0x04, 0xFF, 0xC5, 0xFE, 0x92, 0xFE, 0x60, 0xFE, 0x47, 0xFE, 
-    0x08, 0xFE, 0xA3, 0xFD, 0xDA, 0xFC, 0x1D, 0xFC, 0xBC, 0xFA, 0x1D, 0xF9, 0xD6, 0xF7, 0x25, 0xF7, 
-    0xC9, 0xF7, 0x93, 0xF8, 0xB4, 0xF9, 0xB0, 0xFA, 0x15, 0xFB, 0x54, 0xFB, 0x47, 0xFB, 0xE2, 0xFA, 
-    0x64, 0xFA, 0x00, 0xFA, 0xC1, 0xF9, 0xF7, 0xF8, 0xBD, 0xF7, 0x43, 0xF6, 0x36, 0xF6, 0x64, 0xFD, 
-    0xAA, 0x0A, 0x13, 0x1C, 0xC3, 0x2B, 0xCB, 0x32, 0xF1, 0x32, 0x67, 0x2C, 0x49, 0x21, 0x41, 0x17, 
-    0x56, 0x0C, 0xE9, 0x01, 0x0C, 0xF7, 0xE7, 0xEA, 0x4C, 0xDF, 0x22, 0xDA, 0x15, 0xDD, 0x11, 0xE7, 
-    0xB4, 0xF6, 0x78, 0x04, 0xBF, 0x0E, 0x91, 0x16, 0xAE, 0x18, 0xAA, 0x19, 0xC7, 0x18, 0x7C, 0x15, 
-    0x74, 0x11, 0xF6, 0x0A, 0x35, 0x02, 0xE2, 0xFA, 0x32, 0xF7, 0x19, 0xF7, 0xB0, 0xFA, 0x08, 0xFE, 
-    0x47, 0xFE, 0x32, 0xFD, 0x82, 0xF9, 0xD2, 0xF5, 0x82, 0xF3, 0x47, 0xF2, 0x86, 0xF2, 0x1D, 0xF3, 
-    0x8E, 0xF3, 0x71, 0xF4, 0x58, 0xF7, 0xB4, 0xFC, 0x46, 0x04, 0xA2, 0x0C, 0xE1, 0x12, 0xED, 0x15, 
-    0x63, 0x15, 0x99, 0x11, 0x0B, 0x0C, 0xCC, 0x05, 0x5C, 0xFF, 0xC5, 0xF8, 0xB8, 0xF2, 0xA8, 0xED, 
-    0xA8, 0xEA, 0x3F, 0xEB, 0xC9, 0xEE, 0x8A, 0xF4, 0xE2, 0xFA, 0xC1, 0xFF, 0x96, 0x03, 0x7C, 0x06, 
-    0x41, 0x08, 0x95, 0x09, 0x07, 0x0A, 0x0B, 0x09, 0x6B, 0x07, 0x85, 0x04, 0x07, 0x01, 0x2E, 0xFE, 
-    0x5C, 0xFC, 0x86, 0xFB, 0x9F, 0xFB, 0x86, 0xFB, 0x54, 0xFB, 0x6D, 0xFB, 0x92, 0xFB, 0x43, 0xFC, 
-    0x32, 0xFD, 0xEF, 0xFD, 0xF7, 0xFE, 0xCD, 0xFF, 0x57, 0x00, 0x07, 0x01, 0xB7, 0x01, 0xA6, 0x02, 
-    0x96, 0x03, 0xA2, 0x03, 0xBF, 0x02, 0xEE, 0x00, 0xDE, 0xFE, 0xE6, 0xFC, 0x08, 0xFB, 0x9B, 0xF9, 
-    0xDE, 0xF8, 0xF7, 0xF8, 0xA7, 0xF9, 0x2E, 0xFB, 0x19, 0xFD, 0x5C, 0xFF, 0x5F, 0x01, 0xCC, 0x02, 
-    0x70, 0x03, 0x63, 0x03, 0xA6, 0x02, 0x78, 0x01, 0x18, 0x00, 0x9F, 0xFE, 0x97, 0xFD, 0x25, 0xFD, 
-    0x32, 0xFD, 0xC9, 0xFD, 0xDE, 0xFE, 0x24, 0x00, 0x91, 0x01, 0xFE, 0x02, 0xEE, 0x03, 0x46, 0x04, 
-    0x39, 0x04, 0xBB, 0x03, 0xF2, 0x02, 0x42, 0x02, 0x85, 0x01, 0x78, 0x01, 0x20, 0x01, 0x07, 0x01, 
-    0xC8, 0x00, 0xA2, 0x00, 0x89, 0x00, 0x3D, 0x00, 0xDA, 0xFF, 0x1D, 0xFF, 0x47, 0xFE, 0x97, 0xFD, 
-    0xA7, 0xFC, 0x82, 0xFC, 0x79, 0xFE, 0xEE, 0x00, 0x0B, 0x03, 0x80, 0x05, 0x0B, 0x06, 0xD9, 0x05, 
-    0x31, 0x06, 0x6C, 0x04, 0x18, 0x03, 0x2D, 0x01, 0x15, 0xFE, 0xB8, 0xFB, 0x43, 0xF9, 0xF3, 0xF6, 
-    0x3F, 0xF7, 0x1D, 0xF9, 0x3A, 0xFB, 0x10, 0xFF, 0xE9, 0x01, 0x3D, 0x03, 0xA6, 0x05, 0x18, 0x06, 
-    0x9A, 0x05, 0x35, 0x05, 0xCC, 0x02, 0xA2, 0x00, 0x9F, 0xFE, 0x04, 0xFC, 0xE2, 0xFA, 0xB0, 0xFA, 
-    0x7E, 0xFA, 0x15, 0xFB, 0x9F, 0xFB, 0x47, 0xFB, 0x60, 0xFB, 0x08, 0xFB, 0xD6, 0xFA, 0x08, 0xFB, 
-    0xD6, 0xFA, 0xFB, 0xFA, 0x15, 0xFB, 0x79, 0xFB, 0x75, 0xFC, 0xD6, 0xFD, 0x68, 0xFF, 0xC8, 0x00, 
-    0x2D, 0x01, 0x70, 0x00, 0x1D, 0xFF, 0x7D, 0xFD, 0x43, 0xFC, 0x54, 0xFB, 0x7E, 0xFA, 0x3F, 0xFA, 
-    0xC1, 0xF9, 0x00, 0xFA, 0x15, 0xFB, 0x8E, 0xFC, 0x9F, 0xFE, 0x89, 0x00, 0xE1, 0x00, 0xB4, 0xFF, 
-    0x8E, 0xFC, 0x1D, 0xF9, 0x36, 0xF6, 0x00, 0xF7, 0xDE, 0xFE, 0xBB, 0x0C, 0xBF, 0x1D, 0xC7, 0x2A, 
-    0xBF, 0x2F, 0x6B, 0x2E, 0x88, 0x27, 0xD4, 0x1E, 0xBB, 0x15, 0x8D, 0x0B, 0x13, 0x01, 0x15, 0xF5, 
-    0x4B, 0xE8, 0x3B, 0xDD, 0x43, 0xD8, 0x04, 0xDB, 0x71, 0xE5, 0xDA, 0xF3, 0x00, 0x00, 0x2C, 0x0A, 
-    0xAA, 0x10, 0xDD, 0x13, 0x78, 0x16, 0x13, 0x16, 0x02, 0x14, 0x13, 0x10, 0x7C, 0x09, 0xDD, 0x01, 
-    0xDE, 0xFB, 0xF7, 0xF8, 0x00, 0xFA, 0x08, 0xFE, 0xC8, 0x00, 0xAB, 0x01, 0x3D, 0x00, 0x5C, 0xFC, 
-    0xDE, 0xF8, 0x6D, 0xF5, 0xC5, 0xF2, 0x97, 0xF1, 0x75, 0xF0, 0x1D, 0xF0, 0x00, 0xF1, 0xE7, 0xF3, 
-    0xDA, 0xF9, 0x28, 0x02, 0xE9, 0x0A, 0x99, 0x11, 0x3D, 0x15, 0xBF, 0x14, 0x99, 0x11, 0x63, 0x0C, 
-    0x18, 0x06, 0x0B, 0x00, 0x3F, 0xFA, 0x3A, 0xF5, 0xBD, 0xF1, 0xAC, 0xEF, 0x75, 0xF0, 0xE7, 0xF3, 
-    0x93, 0xF8, 0x58, 0xFD, 0x07, 0x01, 0xFE, 0x02, 0xE1, 0x03, 0xFA, 0x03, 0x3D, 0x03, 0xA6, 0x02, 
-    0xE9, 0x01, 0x2D, 0x01, 0xAF, 0x00, 0x31, 0x00, 0x0B, 0x00, 0xE1, 0x00, 0x03, 0x02, 0x24, 0x03, 
-    0x89, 0x03, 0x9A, 0x02, 0xAF, 0x00, 0x92, 0xFE, 0x68, 0xFC, 0xD6, 0xFA, 0x25, 0xFA, 0x32, 0xFA, 
-    0xC9, 0xFA, 0xB8, 0xFB, 0xB4, 0xFC, 0xFB, 0xFD, 0x4F, 0xFF, 0x31, 0x00, 0x89, 0x00, 0x31, 0x00, 
-    0x29, 0xFF, 0xFB, 0xFD, 0xC1, 0xFC, 0xD1, 0xFB, 0x92, 0xFB, 0x75, 0xFC, 0x08, 0xFE, 0xCD, 0xFF, 
-    0x6C, 0x01, 0x74, 0x02, 0x3D, 0x03, 0xBB, 0x03, 0xAF, 0x03, 0x18, 0x03, 0x03, 0x02, 0xAF, 0x00, 
-    0xB4, 0xFF, 0x1D, 0xFF, 0xC5, 0xFE, 0x82, 0xFF, 0x89, 0x00, 0x78, 0x01, 0x4E, 0x02, 0x42, 0x02, 
-    0xD0, 0x01, 0x91, 0x01, 0x20, 0x01, 0xA2, 0x00, 0x24, 0x00, 0x82, 0xFF, 0x1D, 0xFF, 0x29, 0xFF, 
-    0x5C, 0xFF, 0x18, 0x00, 0x2D, 0x01, 0xAB, 0x01, 0xF6, 0x01, 0xB7, 0x01, 0xE1, 0x00, 0x4A, 0x00, 
-    0x43, 0xFF, 0x47, 0xFE, 0x97, 0xFD, 0xCD, 0xFC, 0x9B, 0xFC, 0xA7, 0xFC, 0xB4, 0xFC, 0xA3, 0xFD, 
-    0x4F, 0xFF, 0xBB, 0x00, 0x4E, 0x02, 0x4A, 0x03, 0xF2, 0x02, 0x57, 0x03, 0x39, 0x04, 0xFA, 0x03, 
-    0xFA, 0x03, 0xD9, 0x02, 0x4A, 0x00, 0x53, 0xFE, 0xC5, 0xFB, 0xA7, 0xF9, 0xCD, 0xF9, 0x0C, 0xFA, 
-    0x15, 0xFB, 0x00, 0xFD, 0xBC, 0xFD, 0x04, 0xFF, 0x2D, 0x01, 0x8D, 0x02, 0xAF, 0x03, 0x46, 0x04, 
-    0x3D, 0x03, 0xE9, 0x01, 0xBB, 0x00, 0xF7, 0xFE, 0xE2, 0xFD, 0x0C, 0xFD, 0xDE, 0xFB, 0xEF, 0xFA, 
-    0xDA, 0xF9, 0xD1, 0xF8, 0x86, 0xF8, 0x04, 0xF9, 0xC1, 0xF9, 0x97, 0xFA, 0xEB, 0xFB, 0x00, 0xFD, 
-    0x47, 0xFE, 0x9B, 0xFF, 0x24, 0x00, 0x70, 0x00, 0x07, 0x01, 0xEE, 0x00, 0x31, 0x00, 0xDA, 0xFF, 
-    0xEB, 0xFE, 0xBC, 0xFD, 0x00, 0xFD, 0xDE, 0xFB, 0x3A, 0xFB, 0x60, 0xFB, 0xF7, 0xFB, 0x25, 0xFD, 
-    0x10, 0xFF, 0x57, 0x00, 0x9E, 0x01, 0x81, 0x02, 0xA2, 0x00, 0xD6, 0xFD, 0x8A, 0xFA, 0x4B, 0xF7, 
-    0x82, 0xF6, 0xDA, 0xF6, 0x75, 0xFC, 0x2D, 0x07, 0xB7, 0x13, 0x73, 0x20, 0x7C, 0x27, 0x41, 0x29, 
-    0xD8, 0x26, 0x28, 0x20, 0xF1, 0x17, 0xDD, 0x0D, 0x70, 0x03, 0x04, 0xF9, 0x08, 0xEF, 0x2E, 0xE6, 
-    0x8F, 0xE1, 0xFC, 0xE2, 0x21, 0xE9, 0x0C, 0xF4, 0x9F, 0xFE, 0xAF, 0x06, 0x6B, 0x0D, 0xAE, 0x0F, 
-    0xBB, 0x0F, 0x80, 0x0E, 0x41, 0x0B, 0x28, 0x08, 0xB7, 0x04, 0x7C, 0x00, 0x4B, 0xFD, 0x68, 0xFC, 
-    0x71, 0xFD, 0x89, 0x00, 0x63, 0x03, 0xE1, 0x03, 0x0B, 0x03, 0xCD, 0xFF, 0x86, 0xFB, 0xB0, 0xF7, 
-    0xCD, 0xF3, 0x7E, 0xF1, 0x8E, 0xF0, 0x9B, 0xF0, 0xEF, 0xF1, 0xBD, 0xF4, 0x4F, 0xF9, 0xCD, 0xFF, 
-    0x95, 0x06, 0x56, 0x0C, 0x46, 0x10, 0xD0, 0x10, 0x17, 0x0F, 0xB3, 0x0B, 0xFA, 0x06, 0x81, 0x02, 
-    0x92, 0xFE, 0x15, 0xFB, 0xB8, 0xF8, 0x3F, 0xF7, 0xB4, 0xF6, 0x8A, 0xF7, 0x43, 0xF9, 0xFB, 0xFA, 
-    0x68, 0xFC, 0x4B, 0xFD, 0x08, 0xFE, 0xAC, 0xFE, 0x43, 0xFF, 0x31, 0x00, 0x5F, 0x01, 0x9A, 0x02, 
-    0xA2, 0x03, 0x39, 0x04, 0x20, 0x04, 0xAF, 0x03, 0x57, 0x03, 0x5B, 0x02, 0x39, 0x01, 0xDA, 0xFF, 
-    0x47, 0xFE, 0x25, 0xFD, 0x36, 0xFC, 0x9F, 0xFB, 0xAC, 0xFB, 0x5C, 0xFC, 0x58, 0xFD, 0x3A, 0xFE, 
-    0xF7, 0xFE, 0xA7, 0xFF, 0x4A, 0x00, 0xBB, 0x00, 0xBB, 0x00, 0x18, 0x00, 0x10, 0xFF, 0x21, 0xFE, 
-    0x25, 0xFD, 0x9B, 0xFC, 0x8E, 0xFC, 0x00, 0xFD, 0xD6, 0xFD, 0xC5, 0xFE, 0xCD, 0xFF, 0xC8, 0x00, 
-    0x03, 0x02, 0x31, 0x03, 0x2D, 0x04, 0x85, 0x04, 0x6C, 0x04, 0xEE, 0x03, 0x0B, 0x03, 0x28, 0x02, 
-    0x5F, 0x01, 0x96, 0x00, 0xCD, 0xFF, 0xEB, 0xFE, 0xD6, 0xFD, 0xF3, 0xFC, 0x75, 0xFC, 0x68, 0xFC, 
-    0x0C, 0xFD, 0xC9, 0xFD, 0xDE, 0xFE, 0x18, 0x00, 0x13, 0x01, 0xD0, 0x01, 0xB3, 0x02, 0xE5, 0x02, 
-    0xF2, 0x02, 0xAF, 0x03, 0xAF, 0x03, 0x57, 0x03, 0xD9, 0x02, 0xE1, 0x00, 0x1D, 0xFF, 0x64, 0xFD, 
-    0xC5, 0xFB, 0x3A, 0xFB, 0x2E, 0xFB, 0x60, 0xFB, 0xDE, 0xFB, 0x82, 0xFC, 0xB4, 0xFC, 0x8A, 0xFD, 
-    0x86, 0xFE, 0x29, 0xFF, 0x7C, 0x00, 0x13, 0x01, 0x07, 0x01, 0x13, 0x01, 0x4A, 0x00, 0xCD, 0xFF, 
-    0xE6, 0xFF, 0xDA, 0xFF, 0xF3, 0xFF, 0x0B, 0x00, 0x8E, 0xFF, 0xF7, 0xFE, 0x92, 0xFE, 0xD6, 0xFD, 
-    0x19, 0xFD, 0xB4, 0xFC, 0x10, 0xFC, 0xAC, 0xFB, 0x92, 0xFB, 0x2E, 0xFB, 0x60, 0xFB, 0x5C, 0xFC, 
-    0xC9, 0xFD, 0x00, 0x00, 0xE9, 0x01, 0x18, 0x03, 0x96, 0x03, 0x24, 0x03, 0x0F, 0x02, 0xBB, 0x00, 
-    0x5C, 0xFF, 0x53, 0xFE, 0x32, 0xFD, 0xEB, 0xFB, 0xA3, 0xFA, 0x9B, 0xF9, 0x00, 0xFA, 0x08, 0xFB, 
-    0x68, 0xFC, 0xFB, 0xFD, 0x79, 0xFE, 0x86, 0xFE, 0x21, 0xFE, 0x71, 0xFD, 0x8A, 0xFD, 0x2E, 0xFE, 
-    0xB8, 0xFE, 0x10, 0xFF, 0x1D, 0xFF, 0x3A, 0xFE, 0x00, 0xFD, 0xAC, 0xFB, 0x00, 0xFA, 0x79, 0xF8, 
-    0x86, 0xF8, 0x32, 0xFD, 0x13, 0x07, 0x99, 0x14, 0xC3, 0x1F, 0x45, 0x25, 0xD0, 0x25, 0x24, 0x21, 
-    0x8D, 0x1A, 0x6B, 0x13, 0x7C, 0x0C, 0x46, 0x07, 0x46, 0x01, 0x64, 0xFA, 0x04, 0xF3, 0x2A, 0xED, 
-    0x15, 0xEC, 0xDE, 0xEF, 0x43, 0xF6, 0xDE, 0xFB, 0xF3, 0xFF, 0x13, 0x01, 0x63, 0x00, 0x9B, 0xFF, 
-    0xEB, 0xFE, 0x3D, 0x00, 0x9A, 0x02, 0x9E, 0x04, 0xB3, 0x05, 0xFE, 0x05, 0xEE, 0x06, 0xD9, 0x08, 
-    0x4E, 0x0B, 0x4A, 0x0C, 0xAA, 0x0A, 0x70, 0x06, 0x24, 0x00, 0x82, 0xF9, 0x8E, 0xF3, 0xEB, 0xEF, 
-    0xEF, 0xEE, 0x7A, 0xEF, 0x19, 0xF1, 0x86, 0xF2, 0x64, 0xF4, 0x71, 0xF7, 0xC5, 0xFB, 0x13, 0x01, 
-    0xCC, 0x05, 0xE5, 0x08, 0x13, 0x0A, 0x24, 0x09, 0x52, 0x07, 0xA6, 0x05, 0xB7, 0x04, 0x78, 0x04, 
-    0x52, 0x04, 0xD4, 0x03, 0xB3, 0x02, 0x5F, 0x01, 0x24, 0x00, 0x43, 0xFF, 0x47, 0xFE, 0x58, 0xFD, 
-    0x82, 0xFC, 0x79, 0xFB, 0xE2, 0xFA, 0xFB, 0xFA, 0x9F, 0xFB, 0x19, 0xFD, 0xDE, 0xFE, 0xF3, 0xFF, 
-    0x4A, 0x00, 0xF3, 0xFF, 0x43, 0xFF, 0xDE, 0xFE, 0xEB, 0xFE, 0x43, 0xFF, 0x3D, 0x00, 0x46, 0x01, 
-    0x35, 0x02, 0xE5, 0x02, 0x0B, 0x03, 0x70, 0x03, 0xA2, 0x03, 0x24, 0x03, 0x42, 0x02, 0x70, 0x00, 
-    0x6D, 0xFE, 0x75, 0xFC, 0x97, 0xFA, 0x43, 0xF9, 0xD1, 0xF8, 0x36, 0xF9, 0x64, 0xFA, 0xDE, 0xFB, 
-    0x58, 0xFD, 0xC5, 0xFE, 0xF3, 0xFF, 0xFA, 0x00, 0x78, 0x01, 0x52, 0x01, 0xEE, 0x00, 0x70, 0x00, 
-    0x18, 0x00, 0x31, 0x00, 0xAF, 0x00, 0x78, 0x01, 0x5B, 0x02, 0x4A, 0x03, 0xAF, 0x03, 0xA2, 0x03, 
-    0x63, 0x03, 0x74, 0x02, 0x46, 0x01, 0xCD, 0xFF, 0x86, 0xFE, 0x8A, 0xFD, 0x3F, 0xFD, 0x8A, 0xFD, 
-    0x86, 0xFE, 0xC8, 0x00, 0x9E, 0x01, 0x28, 0x02, 0x4E, 0x02, 0xE1, 0x00, 0x24, 0x00, 0x68, 0xFF, 
-    0xD1, 0xFE, 0x1D, 0xFF, 0x29, 0xFF, 0x43, 0xFF, 0x5C, 0xFF, 0xAC, 0xFE, 0x2E, 0xFE, 0xD6, 0xFD, 
-    0x25, 0xFD, 0x00, 0xFD, 0xB4, 0xFC, 0x2A, 0xFC, 0x4F, 0xFC, 0x9B, 0xFC, 0xF3, 0xFC, 0xE2, 0xFD, 
-    0xAC, 0xFE, 0xC1, 0xFF, 0xAF, 0x00, 0xE1, 0x00, 0x07, 0x01, 0xAF, 0x00, 0xCD, 0xFF, 0xEB, 0xFE, 
-    0x21, 0xFE, 0x0C, 0xFD, 0xA7, 0xFC, 0x82, 0xFC, 0xC1, 0xFC, 0x7D, 0xFD, 0x2E, 0xFE, 0xD1, 0xFE, 
-    0x4F, 0xFF, 0x9B, 0xFF, 0xCD, 0xFF, 0xCD, 0xFF, 0x82, 0xFF, 0x4F, 0xFF, 0x29, 0xFF, 0x36, 0xFF, 
-    0x10, 0xFF, 0xD1, 0xFE, 0xDE, 0xFE, 0x86, 0xFE, 0x9F, 0xFE, 0x10, 0xFF, 0xF7, 0xFE, 0xF7, 0xFE, 
-    0xEB, 0xFE, 0xC9, 0xFD, 0x9B, 0xFC, 0x2E, 0xFB, 0x3F, 0xFA, 0x64, 0xFA, 0xFB, 0xFA, 0x43, 0xFC, 
-    0x7D, 0xFD, 0x15, 0xFE, 0xBC, 0xFD, 0x0C, 0xFD, 0x1D, 0xFC, 0xAC, 0xFB, 0x4F, 0xFC, 0x68, 0xFC, 
-    0x1D, 0xFC, 0x3A, 0xFB, 0x19, 0xFD, 0x81, 0x02, 0x13, 0x0D, 0x28, 0x1A, 0x3D, 0x21, 0x63, 0x24, 
-    0xA2, 0x21, 0x0B, 0x1B, 0x02, 0x14, 0x07, 0x0D, 0x8D, 0x08, 0xA6, 0x05, 0xC4, 0x01, 0x25, 0xFD, 
-    0xC9, 0xF7, 0x32, 0xF4, 0x15, 0xF5, 0xD1, 0xF8, 0x00, 0xFD, 0xA2, 0x00, 0xB7, 0x01, 0xC1, 0xFF, 
-    0x97, 0xFD, 0x47, 0xFB, 0xA3, 0xFA, 0x32, 0xFD, 0x68, 0xFF, 0x78, 0x01, 0x03, 0x02, 0xDD, 0x01, 
-    0xF2, 0x02, 0x91, 0x04, 0x57, 0x06, 0x5F, 0x07, 0xEE, 0x06, 0x52, 0x04, 0xBB, 0x00, 0x5C, 0xFC, 
-    0x5C, 0xF9, 0xEB, 0xF8, 0x69, 0xF9, 0xE2, 0xFA, 0x1D, 0xFC, 0x9F, 0xFB, 0x47, 0xFB, 0xE2, 0xFA, 
-    0x2E, 0xFB, 0x8E, 0xFC, 0xBC, 0xFD, 0xB8, 0xFE, 0xAC, 0xFE, 0x2E, 0xFE, 0xD6, 0xFD, 0x6D, 0xFE, 
-    0xF3, 0xFF, 0xC4, 0x01, 0x3D, 0x03, 0xBB, 0x03, 0x89, 0x03, 0xB3, 0x02, 0xB7, 0x01, 0x2D, 0x01, 
-    0xE1, 0x00, 0xBB, 0x00, 0x89, 0x00, 0x57, 0x00, 0x31, 0x00, 0x0B, 0x00, 0x57, 0x00, 0x89, 0x00, 
-    0xA2, 0x00, 0x63, 0x00, 0x10, 0xFF, 0x7D, 0xFD, 0x04, 0xFC, 0xC9, 0xFA, 0x71, 0xFA, 0xB0, 0xFA, 
-    0x6D, 0xFB, 0x9B, 0xFC, 0xC9, 0xFD, 0x1D, 0xFF, 0x7C, 0x00, 0xC4, 0x01, 0xF2, 0x02, 0xEE, 0x03, 
-    0x20, 0x04, 0xE1, 0x03, 0x63, 0x03, 0x74, 0x02, 0xC4, 0x01, 0x07, 0x01, 0xA2, 0x00, 0x70, 0x00, 
-    0x00, 0x00, 0x68, 0xFF, 0x86, 0xFE, 0x7D, 0xFD, 0x8E, 0xFC, 0x79, 0xFB, 0xBC, 0xFA, 0x58, 0xFA, 
-    0x19, 0xFA, 0xA3, 0xFA, 0xEB, 0xFB, 0x7D, 0xFD, 0x43, 0xFF, 0xC8, 0x00, 0xF6, 0x01, 0xCC, 0x02, 
-    0xFE, 0x02, 0xB3, 0x02, 0x4E, 0x02, 0x5F, 0x01, 0x96, 0x00, 0xE6, 0xFF, 0x68, 0xFF, 0xE6, 0xFF, 
-    0x57, 0x00, 0x2D, 0x01, 0x35, 0x02, 0x18, 0x03, 0x89, 0x03, 0xA2, 0x03, 0x31, 0x03, 0x9A, 0x02, 
-    0x9E, 0x01, 0x3D, 0x00, 0xEB, 0xFE, 0x97, 0xFD, 0xA7, 0xFC, 0x10, 0xFC, 0xC5, 0xFB, 0x92, 0xFB, 
-    0xD1, 0xFB, 0x68, 0xFC, 0x25, 0xFD, 0x3A, 0xFE, 0x29, 0xFF, 0x18, 0x00, 0xD5, 0x00, 0x07, 0x01, 
-    0xE1, 0x00, 0xA2, 0x00, 0x96, 0x00, 0xBB, 0x00, 0x70, 0x00, 0x0B, 0x00, 0x43, 0xFF, 0x47, 0xFE, 
-    0x64, 0xFD, 0x68, 0xFC, 0xEB, 0xFB, 0x9F, 0xFB, 0xB8, 0xFB, 0x04, 0xFC, 0x68, 0xFC, 0x0C, 0xFD, 
-    0xC9, 0xFD, 0x86, 0xFE, 0x43, 0xFF, 0x18, 0x00, 0x3D, 0x00, 0x7C, 0x00, 0x24, 0x00, 0x5C, 0xFF, 
-    0x4F, 0xFF, 0xF7, 0xFE, 0xAC, 0xFE, 0x04, 0xFF, 0x9F, 0xFE, 0xAC, 0xFE, 0xAC, 0xFE, 0x2E, 0xFE, 
-    0x08, 0xFE, 0x15, 0xFE, 0xD6, 0xFD, 0x08, 0xFE, 0xA3, 0xFD, 0x25, 0xFD, 0x32, 0xFD, 0x68, 0xFC, 
-    0xDA, 0xFC, 0xCD, 0xFC, 0x4B, 0xFD, 0x8A, 0xFD, 0xBC, 0xFD, 0x58, 0xFD, 0xA7, 0xFC, 0x68, 0xFC, 
-    0x86, 0xFE, 0x4E, 0x02, 0xAF, 0x06, 0x0B, 0x0C, 0x0B, 0x0F, 0xB7, 0x10, 0x2C, 0x10, 0xB3, 0x0E, 
-    0x6B, 0x0D, 0x95, 0x0C, 0x3D, 0x0C, 0x8D, 0x0B, 0x6B, 0x0A, 0x9A, 0x08, 0x07, 0x07, 0x67, 0x05, 
-    0x35, 0x05, 0x1C, 0x05, 0x78, 0x04, 0x89, 0x03, 0xB7, 0x01, 0x75, 0xFF, 0x8A, 0xFD, 0x10, 0xFC, 
-    0x60, 0xFB, 0xC5, 0xFB, 0xD1, 0xFB, 0x1D, 0xFC, 0x10, 0xFC, 0x10, 0xFC, 0x75, 0xFC, 0x25, 0xFD, 
-    0xC9, 0xFD, 0x9F, 0xFE, 0xAC, 0xFE, 0x86, 0xFE, 0x92, 0xFE, 0x6D, 0xFE, 0xF7, 0xFE, 0xB4, 0xFF, 
-    0x57, 0x00, 0xAF, 0x00, 0x57, 0x00, 0xB4, 0xFF, 0x04, 0xFF, 0x3A, 0xFE, 0x15, 0xFE, 0xEF, 0xFD, 
-    0x15, 0xFE, 0x47, 0xFE, 0x79, 0xFE, 0xAC, 0xFE, 0xAC, 0xFE, 0xC5, 0xFE, 0x2E, 0xFE, 0x79, 0xFE, 
-    0x86, 0xFE, 0xC5, 0xFE, 0x60, 0xFE, 0xF3, 0xFC, 0x68, 0xFC, 0x6D, 0xFB, 0x1D, 0xFC, 0x19, 0xFD, 
-    0xE6, 0xFF, 0x91, 0x01, 0x70, 0x03, 0x18, 0x03, 0x31, 0x03, 0x4E, 0x02, 0x42, 0x02, 0x03, 0x02, 
-    0xE9, 0x01, 0x5F, 0x01, 0xEE, 0x00, 0x4A, 0x00, 0xE6, 0xFF, 0x3D, 0x00, 0x70, 0x00, 0xD5, 0x00, 
-    0xAF, 0x00, 0xA7, 0xFF, 0x53, 0xFE, 0x00, 0xFD, 0xA7, 0xFC, 0x0C, 0xFD, 0xB0, 0xFD, 0xAC, 0xFE, 
-    0x43, 0xFF, 0xCD, 0xFF, 0x0B, 0x00, 0x7C, 0x00, 0xEE, 0x00, 0x13, 0x01, 0x7C, 0x00, 0x82, 0xFF, 
-    0x6D, 0xFE, 0x97, 0xFD, 0x58, 0xFD, 0x97, 0xFD, 0x47, 0xFE, 0xC5, 0xFE, 0xF7, 0xFE, 0xAC, 0xFE, 
-    0x47, 0xFE, 0xEF, 0xFD, 0xE2, 0xFD, 0xD6, 0xFD, 0xE2, 0xFD, 0xD6, 0xFD, 0xC9, 0xFD, 0xD6, 0xFD, 
-    0x2E, 0xFE, 0xD1, 0xFE, 0x9B, 0xFF, 0x24, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xE6, 0xFF, 0x18, 0x00, 
-    0xA2, 0x00, 0x46, 0x01, 0x9E, 0x01, 0xF6, 0x01, 0xF6, 0x01, 0xDD, 0x01, 0xD0, 0x01, 0x03, 0x02, 
-    0x1C, 0x02, 0x03, 0x02, 0x39, 0x01, 0x63, 0x00, 0x4F, 0xFF, 0x86, 0xFE, 0xFB, 0xFD, 0xBC, 0xFD, 
-    0xE2, 0xFD, 0x21, 0xFE, 0x53, 0xFE, 0x3A, 0xFE, 0xD6, 0xFD, 0x58, 0xFD, 0xA7, 0xFC, 0x36, 0xFC, 
-    0xC5, 0xFB, 0x04, 0xFC, 0x4F, 0xFC, 0x19, 0xFD, 0xFB, 0xFD, 0xD1, 0xFE, 0xB4, 0xFF, 0x57, 0x00, 
-    0xAF, 0x00, 0x7C, 0x00, 0x3D, 0x00, 0xC1, 0xFF, 0x5C, 0xFF, 0xD1, 0xFE, 0x79, 0xFE, 0x86, 0xFE, 
-    0x04, 0xFF, 0xB4, 0xFF, 0x89, 0x00, 0x13, 0x01, 0x52, 0x01, 0x78, 0x01, 0xEE, 0x00, 0xC8, 0x00, 
-    0x3D, 0x00, 0xF3, 0xFF, 0x9B, 0xFF, 0x5C, 0xFF, 0x36, 0xFF, 0x36, 0xFF, 0x43, 0xFF, 0x82, 0xFF, 
-    0xE6, 0xFF, 0xE1, 0x00, 0x35, 0x02, 0x89, 0x03, 0x35, 0x05, 0xA6, 0x05, 0xFE, 0x05, 0x4E, 0x05, 
-    0xF6, 0x04, 0x6C, 0x04, 0xEE, 0x03, 0xC8, 0x03, 0xFA, 0x03, 0x85, 0x04, 0x1C, 0x05, 0xB3, 0x05, 
-    0xE5, 0x05, 0x7C, 0x06, 0xA2, 0x06, 0x7C, 0x06, 0x18, 0x06, 0x42, 0x05, 0x78, 0x04, 0xAF, 0x03, 
-    0xCC, 0x02, 0x42, 0x02, 0xC4, 0x01, 0x46, 0x01, 0xC8, 0x00, 0x52, 0x01, 0x96, 0x00, 0xBB, 0x00, 
-    0x3D, 0x00, 0xB4, 0xFF, 0x00, 0x00, 0xB8, 0xFE, 0xAC, 0xFE, 0x21, 0xFE, 0x3A, 0xFE, 0x15, 0xFE, 
-    0xB0, 0xFD, 0xB0, 0xFD, 0x8A, 0xFD, 0x58, 0xFD, 0x0C, 0xFD, 0xCD, 0xFC, 0x00, 0xFD, 0x25, 0xFD, 
-    0x71, 0xFD, 0xD6, 0xFD, 0x47, 0xFE, 0xC5, 0xFE, 0xF7, 0xFE, 0x29, 0xFF, 0x43, 0xFF, 0xEB, 0xFE, 
-    0xAC, 0xFE, 0x21, 0xFE, 0x21, 0xFE, 0xEF, 0xFD, 0x15, 0xFE, 0x53, 0xFE, 0x92, 0xFE, 0xC5, 0xFE, 
-    0xEB, 0xFE, 0x04, 0xFF, 0xF7, 0xFE, 0x04, 0xFF, 0xDE, 0xFE, 0xB8, 0xFE, 0x79, 0xFE, 0x2E, 0xFE, 
-    0xBC, 0xFD, 0x8A, 0xFD, 0x64, 0xFD, 0x8A, 0xFD, 0xBC, 0xFD, 0x15, 0xFE, 0x9F, 0xFE, 0xEB, 0xFE, 
-    0x36, 0xFF, 0x82, 0xFF, 0xCD, 0xFF, 0x3D, 0x00, 0x63, 0x00, 0x70, 0x00, 0x7C, 0x00, 0x89, 0x00, 
-    0xC8, 0x00, 0xFA, 0x00, 0x39, 0x01, 0x6C, 0x01, 0x6C, 0x01, 0x13, 0x01, 0xD5, 0x00, 0x57, 0x00, 
-    0x0B, 0x00, 0xCD, 0xFF, 0xB4, 0xFF, 0xDA, 0xFF, 0xE6, 0xFF, 0x00, 0x00, 0xE6, 0xFF, 0xE6, 0xFF, 
-    0xCD, 0xFF, 0xB4, 0xFF, 0x82, 0xFF, 0x68, 0xFF, 0x43, 0xFF, 0x29, 0xFF, 0x10, 0xFF, 0x04, 0xFF, 
-    0xF7, 0xFE, 0x04, 0xFF, 0x04, 0xFF, 0xF7, 0xFE, 0xD1, 0xFE, 0xB8, 0xFE, 0xAC, 0xFE, 0xAC, 0xFE, 
-    0xB8, 0xFE, 0xDE, 0xFE, 0xEB, 0xFE, 0x04, 0xFF, 0xF7, 0xFE, 0xB8, 0xFE, 0x92, 0xFE, 0x6D, 0xFE, 
-    0x86, 0xFE, 0xAC, 0xFE, 0xEB, 0xFE, 0x43, 0xFF, 0xB4, 0xFF, 0x57, 0x00, 0xEE, 0x00, 0x91, 0x01, 
-    0xF6, 0x01, 0x28, 0x02, 0x0F, 0x02, 0xDC, 0x01, 0x84, 0x01, 0x39, 0x01, 0xED, 0x00, 0xC8, 0x00, 
-    0xBB, 0x00, 0xA2, 0x00, 0xC8, 0x00, 0xE1, 0x00, 0x39, 0x01, 0x77, 0x01, 0xB6, 0x01, 0xAA, 0x01, 
-    0x77, 0x01, 0x13, 0x01, 0xA2, 0x00, 0x4A, 0x00, 0x00, 0x00, 0x9B, 0xFF, 0x37, 0xFF, 0xC6, 0xFE, 
-    0x6E, 0xFE, 0x22, 0xFE, 0x2F, 0xFE, 0x61, 0xFE, 0xC6, 0xFE, 0x37, 0xFF, 0x9B, 0xFF, 0xDA, 0xFF, 
-    0x24, 0x00, 0x63, 0x00, 0x95, 0x00, 0xAE, 0x00, 0x95, 0x00, 0x4A, 0x00, 0xF3, 0xFF, 0x5D, 0xFF, 
-    0x05, 0xFF, 0xA0, 0xFE, 0xA1, 0xFE, 0xEC, 0xFE, 0x69, 0xFF, 0x00, 0x00, 0x88, 0x00, 0xF9, 0x00, 
-    0x38, 0x01, 0x51, 0x01, 0x12, 0x01, 0xAE, 0x00, 0x24, 0x00, 0x82, 0xFF, 0xD3, 0xFE, 0x56, 0xFE, 
-    0x3D, 0xFE, 0x6F, 0xFE, 0x05, 0xFF, 0xCD, 0xFF, 0xC7, 0x00, 0x8F, 0x01, 0x32, 0x02, 0x7D, 0x02, 
-    0xBB, 0x02, 0xA2, 0x02, 0x89, 0x02, 0x4A, 0x02, 0x0C, 0x02, 0xC1, 0x01, 0x8F, 0x01, 0x8F, 0x01, 
-    0x8F, 0x01, 0x9B, 0x01, 0x9B, 0x01, 0x8E, 0x01, 0x75, 0x01, 0x5C, 0x01, 0x37, 0x01, 0x11, 0x01, 
-    0x1E, 0x01, 0x50, 0x01, 0x5C, 0x03, 0x50, 0x03, 0xCD, 0x03, 0x56, 0x02, 0x75, 0x01, 0xEC, 0x00, 
-    0xA8, 0xFF, 0x8F, 0xFF, 0x51, 0xFF, 0x17, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x7B, 0x00, 
-    0x7B, 0x00, 0x30, 0x00, 0x8F, 0xFF, 0x5D, 0xFF, 0xAF, 0xFE, 0x57, 0xFE, 0x26, 0xFE, 0x26, 0xFE, 
-    0x4B, 0xFE, 0x3F, 0xFE, 0x0D, 0xFE, 0xC2, 0xFD, 0x46, 0xFD, 0x07, 0xFD, 0xBD, 0xFC, 0xEF, 0xFC, 
-    0x39, 0xFD, 0x91, 0xFD, 0x0D, 0xFE, 0x8A, 0xFE, 0x13, 0xFF, 0x83, 0xFF, 0xE7, 0xFF, 0x00, 0x00, 
-    0x0B, 0x00, 0xDA, 0xFF, 0xA8, 0xFF, 0x45, 0xFF, 0xFA, 0xFE, 0xC8, 0xFE, 0xD5, 0xFE, 0xEE, 0xFE, 
-    0x07, 0xFF, 0xFA, 0xFE, 0xEE, 0xFE, 0xFA, 0xFE, 0xEE, 0xFE, 0x20, 0xFF, 0x45, 0xFF, 0xB5, 0xFF, 
-    0x24, 0x00, 0x94, 0x00, 0xD2, 0x00, 0x10, 0x01, 0x1C, 0x01, 0x1C, 0x01, 0xEB, 0x00, 0x94, 0x00, 
-    0x49, 0x00, 0x3D, 0x00, 0x24, 0x00, 0x49, 0x00, 0x55, 0x00, 0x87, 0x00, 0xDE, 0x00, 0x10, 0x01, 
-    0x28, 0x01, 0xF7, 0x00, 0xB9, 0x00, 0x3D, 0x00, 0xDA, 0xFF, 0x90, 0xFF, 0x5E, 0xFF, 0x5E, 0xFF, 
-    0x77, 0xFF, 0x6B, 0xFF, 0x9C, 0xFF, 0x9C, 0xFF, 0xC1, 0xFF, 0xCE, 0xFF, 0xCE, 0xFF, 0xC2, 0xFF, 
-    0xB5, 0xFF, 0xA9, 0xFF, 0xA9, 0xFF, 0xA9, 0xFF, 0xC2, 0xFF, 0xF3, 0xFF, 0x17, 0x00, 0x24, 0x00, 
-    0xF3, 0xFF, 0xB5, 0xFF, 0x52, 0xFF, 0xFB, 0xFE, 0xBD, 0xFE, 0xA5, 0xFE, 0xBE, 0xFE, 0xE3, 0xFE, 
-    0x39, 0xFF, 0x90, 0xFF, 0x0B, 0x00, 0x9F, 0x00, 0x0F, 0x01, 0x72, 0x01, 0xA3, 0x01, 0xA3, 0x01, 
-    0x7E, 0x01, 0x59, 0x01, 0x27, 0x01, 0x0F, 0x01, 0xF6, 0x00, 0xE9, 0x00, 0xDD, 0x00, 0xC4, 0x00, 
-    0xAC, 0x00, 0xAC, 0x00, 0x9F, 0x00, 0x86, 0x00, 0x93, 0x00, 0x61, 0x00, 0x49, 0x00, 0x0B, 0x00, 
-    0xE7, 0xFF, 0xC2, 0xFF, 0xA9, 0xFF, 0xB5, 0xFF, 0xB5, 0xFF, 0xB5, 0xFF, 0xA9, 0xFF, 0x90, 0xFF, 
-    0x9D, 0xFF, 0x90, 0xFF, 0xB5, 0xFF, 0xE7, 0xFF, 0xF3, 0xFF, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 
-    0x17, 0x00, 0x17, 0x00, 0x24, 0x00, 0x0B, 0x00, 0xF3, 0xFF, 0xCE, 0xFF, 0xC2, 0xFF, 0xA9, 0xFF, 
-    0xA9, 0xFF, 0xA9, 0xFF, 0xB6, 0xFF, 0xE7, 0xFF, 0x0B, 0x00, 0x23, 0x00, 0x30, 0x00, 0x3C, 0x00, 
-    0x3C, 0x00, 0x48, 0x00, 0x23, 0x00, 0x00, 0x00, 0xC2, 0xFF, 0x6C, 0xFF, 0x3A, 0xFF, 0x22, 0xFF, 
-    0x3B, 0xFF, 0x6C, 0xFF, 0x9D, 0xFF, 0xDB, 0xFF, 0x00, 0x00, 0x30, 0x00, 0x48, 0x00, 0x79, 0x00, 
-    0x92, 0x00, 0xB7, 0x00, 0xB7, 0x00, 0x9E, 0x00, 0x92, 0x00, 0x6D, 0x00, 0x61, 0x00, 0x61, 0x00, 
-    0x86, 0x00, 0xAA, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xDB, 0x00, 0x00, 0x01, 0x31, 0x01, 0x62, 0x01, 
-    0x87, 0x01, 0x93, 0x01, 0x87, 0x01, 0x49, 0x01, 0x25, 0x01, 0x00, 0x01, 0xF4, 0x00, 0xE7, 0x00, 
-    0xC2, 0x00, 0x9E, 0x00, 0x60, 0x00, 0x00, 0x00, 0xB6, 0xFF, 0x6D, 0xFF, 0x54, 0xFF, 0x23, 0xFF, 
-    0x23, 0xFF, 0xF2, 0xFE, 0xF2, 0xFE, 0x0B, 0xFF, 0x3C, 0xFF, 0x6D, 0xFF, 0x85, 0xFF, 0x85, 0xFF, 
-    0x61, 0xFF, 0x30, 0xFF, 0xE7, 0xFE, 0x9D, 0xFE, 0x54, 0xFE, 0x48, 0xFE, 0x48, 0xFE, 0x79, 0xFE, 
-    0xC2, 0xFE, 0x0B, 0xFF, 0x61, 0xFF, 0xC3, 0xFF, 0x17, 0x00, 0x78, 0x00, 0xB5, 0x00, 0xDA, 0x00, 
-    0xCE, 0x00, 0x9D, 0x00, 0x85, 0x00, 0x6C, 0x00, 0x78, 0x00, 0x54, 0x00, 0x54, 0x00, 0x2F, 0x00, 
-    0x2F, 0x00, 0x00, 0x00, 0xDB, 0xFF, 0xB6, 0xFF, 0xAA, 0xFF, 0x92, 0xFF, 0x7A, 0xFF, 0x61, 0xFF, 
-    0x55, 0xFF, 0x6E, 0xFF, 0x86, 0xFF, 0x9E, 0xFF, 0xB7, 0xFF, 0xC3, 0xFF, 0xDB, 0xFF, 0xF3, 0xFF, 
-    0xF3, 0xFF, 0xF3, 0xFF, 0xE7, 0xFF, 0xF3, 0xFF, 0xF3, 0xFF, 0x00, 0x00, 0x0B, 0x00, 0x23, 0x00, 
-    0x2F, 0x00, 0x53, 0x00, 0x5F, 0x00, 0x6C, 0x00, 0x47, 0x00, 0x17, 0x00, 0xCF, 0xFF, 0x86, 0xFF, 
-    0x3E, 0xFF, 0x19, 0xFF, 0x01, 0xFF, 0x0D, 0xFF, 0x1A, 0xFF, 0x56, 0xFF, 0x93, 0xFF, 0xCF, 0xFF, 
-    0x0B, 0x00, 0x47, 0x00, 0x77, 0x00, 0x90, 0x00, 0xC0, 0x00, 0xCC, 0x00, 0xE4, 0x00, 0xD8, 0x00, 
-    0xD8, 0x00, 0xB4, 0x00, 0x9B, 0x00, 0x77, 0x00, 0x53, 0x00, 0x2F, 0x00, 0x3B, 0x00, 0x3B, 0x00, 
-    0x2F, 0x00, 0x2F, 0x00, 0x3B, 0x00, 0x3B, 0x00, 0x17, 0x00, 0x00, 0x00, 0xE7, 0xFF, 0x00, 0x00, 
-    0x0B, 0x00, 0x3B, 0x00, 0x53, 0x00, 0x8F, 0x00, 0xA7, 0x00, 0xBF, 0x00, 0xCB, 0x00, 0xBF, 0x00, 
-    0xBF, 0x00, 0xB3, 0x00, 0xA7, 0x00, 0xB3, 0x00, 0xBF, 0x00, 0xBF, 0x00, 0xB3, 0x00, 0x9B, 0x00, 
-    0x77, 0x00, 0x53, 0x00, 0x2F, 0x00, 0x0B, 0x00, 0xCF, 0xFF, 0xB7, 0xFF, 0x7B, 0xFF, 0x9F, 0xFF, 
-    0xB7, 0xFF, 0xE7, 0xFF, 0x0A, 0x00, 0x22, 0x00, 0x2E, 0x00, 0x16, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 
-    0xDC, 0xFF, 0xB8, 0xFF, 0x94, 0xFF, 0x7C, 0xFF, 0x94, 0xFF, 0xAC, 0xFF, 0xDC, 0xFF, 0xF4, 0xFF, 
-    0x0A, 0x00, 0x2E, 0x00, 0x2E, 0x00, 0x16, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0xE8, 0xFF, 0xE8, 0xFF, 
-    0xD0, 0xFF, 0xD0, 0xFF, 0xAC, 0xFF, 0x94, 0xFF, 0x7C, 0xFF, 0x70, 0xFF, 0x64, 0xFF, 0x64, 0xFF, 
-    0x64, 0xFF, 0x7C, 0xFF, 0x94, 0xFF, 0xC4, 0xFF, 0x0A, 0x00, 0x46, 0x00, 0x9A, 0x00, 0xA6, 0x00, 
-    0xC9, 0x00, 0xBD, 0x00, 0xA5, 0x00, 0x8E, 0x00, 0x76, 0x00, 0x76, 0x00, 0x46, 0x00, 0x22, 0x00, 
-    0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x46, 0x00, 0x76, 0x00, 0x99, 0x00, 0x99, 0x00, 
-    0x8D, 0x00, 0x75, 0x00, 0x52, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xAC, 0xFF, 0x95, 0xFF, 
-    0x95, 0xFF, 0xAC, 0xFF, 0xAC, 0xFF, 0xB8, 0xFF, 0xD0, 0xFF, 0xD0, 0xFF, 0xC4, 0xFF, 0xB8, 0xFF, 
-    0xC4, 0xFF, 0xAC, 0xFF, 0x95, 0xFF, 0x7D, 0xFF, 0x7D, 0xFF, 0x7D, 0xFF, 0x95, 0xFF, 0xAD, 0xFF, 
-    0xC4, 0xFF, 0xD0, 0xFF, 0xD0, 0xFF, 0xD0, 0xFF, 0xC4, 0xFF, 0xDC, 0xFF, 0xD0, 0xFF, 0xE8, 0xFF, 
-    0x00, 0x00, 0x16, 0x00, 0x16, 0x00, 0x2E, 0x00, 0x3A, 0x00, 0x45, 0x00, 0x51, 0x00, 0x45, 0x00, 
-    0x2E, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2E, 0x00, 0x2E, 0x00, 0x2E, 0x00, 
-    0x22, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 0xD0, 0xFF, 0xA1, 0xFF, 0x72, 0xFF, 0x43, 0xFF, 0x2B, 0xFF, 
-    0x1F, 0xFF, 0x37, 0xFF, 0x43, 0xFF, 0x66, 0xFF, 0x66, 0xFF, 0x72, 0xFF, 0x7E, 0xFF, 0x72, 0xFF, 
-    0x66, 0xFF, 0x5A, 0xFF, 0x43, 0xFF, 0x43, 0xFF, 0x5A, 0xFF, 0x7E, 0xFF, 0xA1, 0xFF, 0xAD, 0xFF, 
-    0xD0, 0xFF, 0xF4, 0xFF, 0x16, 0x00, 0x2E, 0x00, 0x2E, 0x00, 0x3A, 0x00, 0x39, 0x00, 0x39, 0x00, 
-    0x45, 0x00, 0x51, 0x00, 0x69, 0x00, 0x69, 0x00, 0x74, 0x00, 0x8C, 0x00, 0x8C, 0x00, 0x8C, 0x00, 
-    0x8C, 0x00, 0x80, 0x00, 0x74, 0x00, 0x5D, 0x00, 0x69, 0x00, 0x45, 0x00, 0x45, 0x00, 0x51, 0x00, 
-    0x5D, 0x00, 0x80, 0x00, 0xA4, 0x00, 0xBB, 0x00, 0xD3, 0x00, 0xD3, 0x00, 0xC7, 0x00, 0xBB, 0x00, 
-    0x80, 0x00, 0x69, 0x00, 0x16, 0x00, 0xF4, 0xFF, 0xD0, 0xFF, 0xC5, 0xFF, 0xC5, 0xFF, 0xD0, 0xFF, 
-    0xF4, 0xFF, 0x0A, 0x00, 0x2E, 0x00, 0x2E, 0x00, 0x39, 0x00, 0x2E, 0x00, 0x22, 0x00, 0x00, 0x00, 
-    0xE8, 0xFF, 0xC5, 0xFF, 0xC5, 0xFF, 0xC5, 0xFF, 0xF4, 0xFF, 0x0A, 0x00, 0x2E, 0x00, 0x45, 0x00, 
-    0x5D, 0x00, 0x5D, 0x00, 0x51, 0x00, 0x39, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 0xC5, 0xFF, 0x96, 0xFF, 
-    0x5B, 0xFF, 0x4F, 0xFF, 0x43, 0xFF, 0x43, 0xFF, 0x37, 0xFF, 0x37, 0xFF, 0x2C, 0xFF, 0x14, 0xFF, 
-    0x08, 0xFF, 0xF1, 0xFE, 0xF1, 0xFE, 0x08, 0xFF, 0x2C, 0xFF, 0x67, 0xFF, 0xA1, 0xFF, 0xD0, 0xFF, 
-    0xF4, 0xFF, 0x22, 0x00, 0x2E, 0x00, 0x45, 0x00, 0x51, 0x00, 0x5D, 0x00, 0x51, 0x00, 0x45, 0x00, 
-    0x45, 0x00, 0x45, 0x00, 0x45, 0x00, 0x39, 0x00, 0x2E, 0x00, 0x2E, 0x00, 0x22, 0x00, 0x16, 0x00, 
-    0x00, 0x00, 0xF4, 0xFF, 0x0A, 0x00, 0x22, 0x00, 0x39, 0x00, 0x45, 0x00, 0x51, 0x00, 0x51, 0x00, 
-    0x51, 0x00, 0x5C, 0x00, 0x5C, 0x00, 0x74, 0x00, 0x68, 0x00, 0x68, 0x00, 0x68, 0x00, 0x68, 0x00, 
-    0x74, 0x00, 0x68, 0x00, 0x68, 0x00, 0x51, 0x00, 0x39, 0x00, 0x16, 0x00, 0x00, 0x00, 0xE8, 0xFF, 
-    0xDC, 0xFF, 0xF4, 0xFF, 0x0A, 0x00, 0x39, 0x00, 0x5C, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x74, 0x00, 0x5C, 0x00, 0x2D, 0x00, 0x00, 0x00, 0xE8, 0xFF, 0xC5, 0xFF, 0xC5, 0xFF, 0xB9, 0xFF, 
-    0xB9, 0xFF, 0xAD, 0xFF, 0xAD, 0xFF, 0xA2, 0xFF, 0x96, 0xFF, 0x96, 0xFF, 0x7E, 0xFF, 0x96, 0xFF, 
-    0xA2, 0xFF, 0xAD, 0xFF, 0xC5, 0xFF, 0xC5, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x16, 0x00, 0x0A, 0x00, 
-    0x00, 0x00, 0xE8, 0xFF, 0xDC, 0xFF, 0xD1, 0xFF, 0xB9, 0xFF, 0xB9, 0xFF, 0xB9, 0xFF, 0xB9, 0xFF, 
-    0xD1, 0xFF, 0xF4, 0xFF, 0x16, 0x00, 0x45, 0x00, 0x51, 0x00, 0x68, 0x00, 0x5C, 0x00, 0x5C, 0x00, 
-    0x2D, 0x00, 0x00, 0x00, 0xD1, 0xFF, 0x96, 0xFF, 0x96, 0xFF, 0x73, 0xFF, 0x7F, 0xFF, 0x67, 0xFF, 
-    0x7F, 0xFF, 0x8A, 0xFF, 0xA2, 0xFF, 0xB9, 0xFF, 0xD1, 0xFF, 0xDC, 0xFF, 0xE8, 0xFF, 0xF4, 0xFF, 
-    0xE8, 0xFF, 0xD1, 0xFF, 0xB9, 0xFF, 0xAE, 0xFF, 0xAE, 0xFF, 0xAE, 0xFF, 0xA2, 0xFF, 0x96, 0xFF, 
-    0x8A, 0xFF, 0x96, 0xFF, 0xAE, 0xFF, 0xAE, 0xFF, 0xB9, 0xFF, 0xD1, 0xFF, 0xE8, 0xFF, 0x0A, 0x00, 
-    0x22, 0x00, 0x45, 0x00, 0x5C, 0x00, 0x73, 0x00, 0x7F, 0x00, 0x73, 0x00, 0x5C, 0x00, 0x50, 0x00, 
-    0x50, 0x00, 0x45, 0x00, 0x5C, 0x00, 0x5C, 0x00, 0x45, 0x00, 0x45, 0x00, 0x50, 0x00, 0x39, 0x00, 
-    0x45, 0x00, 0x45, 0x00, 0x45, 0x00, 0x2D, 0x00, 0x16, 0x00, 0x0A, 0x00, 0x16, 0x00, 0x0A, 0x00, 
-    0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE8, 0xFF, 0xF4, 0xFF, 0xE8, 0xFF, 
-    0xE8, 0xFF, 0xD1, 0xFF, 0xD1, 0xFF, 0xB9, 0xFF, 0xAE, 0xFF, 0xAD, 0xFF, 0xA2, 0xFF, 0xA2, 0xFF, 
-    0x96, 0xFF, 0x96, 0xFF, 0x8A, 0xFF, 0x8A, 0xFF, 0x8A, 0xFF, 0x8A, 0xFF, 0xAD, 0xFF, 0xC5, 0xFF, 
-    0xC5, 0xFF, 0xC5, 0xFF, 0xD1, 0xFF, 0xDC, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xD0, 0xFF, 
-    0xD0, 0xFF, 0xB9, 0xFF, 0xC5, 0xFF, 0xAD, 0xFF, 0xAD, 0xFF, 0xA1, 0xFF, 0x8A, 0xFF, 0x8A, 0xFF, 
-    0x7E, 0xFF, 0x7E, 0xFF, 0x8A, 0xFF, 0x95, 0xFF, 0xAD, 0xFF, 0xB9, 0xFF, 0xD0, 0xFF, 0xF4, 0xFF, 
-    0x0A, 0x00, 0x22, 0x00, 0x39, 0x00, 0x45, 0x00, 0x45, 0x00, 0x45, 0x00, 0x2E, 0x00, 0x2E, 0x00, 
-    0x22, 0x00, 0x16, 0x00, 0x16, 0x00, 0x16, 0x00, 0x0A, 0x00, 0x16, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0x0A, 0x00, 0xF4, 0xFF, 0xDC, 0xFF, 0xC4, 0xFF, 0xAD, 0xFF, 0x95, 0xFF, 0x95, 0xFF, 0x95, 0xFF, 
-    0xAD, 0xFF, 0xB8, 0xFF, 0xC4, 0xFF, 0xDC, 0xFF, 0xD0, 0xFF, 0xE8, 0xFF, 0xE8, 0xFF, 0x00, 0x00, 
-    0x0A, 0x00, 0x16, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x16, 0x00, 0x2E, 0x00, 0x2E, 0x00, 0x3A, 0x00, 0x46, 0x00, 0x6A, 0x00, 0x81, 0x00, 0x99, 0x00, 
-    0xA5, 0x00, 0xA5, 0x00, 0x8D, 0x00, 0x8E, 0x00, 0x76, 0x00, 0x5E, 0x00, 0x5E, 0x00, 0x46, 0x00, 
-    0x3A, 0x00, 0x22, 0x00, 0x16, 0x00, 0x16, 0x00, 0x16, 0x00, 0x16, 0x00, 0x0A, 0x00, 0x16, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x22, 0x00, 0x2E, 0x00, 0x46, 0x00, 0x52, 0x00, 0x76, 0x00, 
-    0x6A, 0x00, 0x76, 0x00, 0x5E, 0x00, 0x6A, 0x00, 0x76, 0x00, 0x76, 0x00, 0x76, 0x00, 0x76, 0x00, 
-    0x76, 0x00, 0x76, 0x00, 0x5E, 0x00, 0x5E, 0x00, 0x5E, 0x00, 0x5E, 0x00, 0x3A, 0x00, 0x3A, 0x00, 
-    0x22, 0x00, 0x0B, 0x00, 0x0B, 0x00, 0x17, 0x00, 0x17, 0x00, 0x23, 0x00, 0x17, 0x00, 0x17, 0x00, 
-    0x0B, 0x00, 0xF3, 0xFF, 0xF3, 0xFF, 0xCF, 0xFF, 0xC3, 0xFF, 0xAB, 0xFF, 0xAB, 0xFF, 0xB7, 0xFF, 
-    0xCF, 0xFF, 0xF3, 0xFF, 0x17, 0x00, 0x2F, 0x00, 0x3B, 0x00, 0x5F, 0x00, 0x6B, 0x00, 0x77, 0x00, 
-    0x6B, 0x00, 0x6B, 0x00, 0x6B, 0x00, 0x77, 0x00, 0x6B, 0x00, 0x8F, 0x00, 0x9B, 0x00, 0xB3, 0x00, 
-    0xB4, 0x00, 0xC0, 0x00, 0xB4, 0x00, 0xB4, 0x00, 0xA8, 0x00, 0xA8, 0x00, 0x83, 0x00, 0x6B, 0x00, 
-    0x53, 0x00, 0x3B, 0x00, 0x3B, 0x00, 0x23, 0x00, 0x17, 0x00, 0x23, 0x00, 0x17, 0x00, 0x17, 0x00, 
-    0x00, 0x00, 0xF3, 0xFF, 0xE7, 0xFF, 0xDB, 0xFF, 0xDB, 0xFF, 0xDB, 0xFF, 0xE7, 0xFF, 0xDB, 0xFF, 
-    0xE7, 0xFF, 0xDB, 0xFF, 0xDB, 0xFF, 0xCF, 0xFF, 0xC3, 0xFF, 0xB7, 0xFF, 0xAB, 0xFF, 0xB7, 0xFF, 
-    0xC3, 0xFF, 0xCF, 0xFF, 0xCF, 0xFF, 0xAA, 0xFF, 0xAA, 0xFF, 0x9E, 0xFF, 0xAA, 0xFF, 0xC3, 0xFF, 
-    0xDB, 0xFF, 0xE7, 0xFF, 0x0B, 0x00, 0xF3, 0xFF, 0x00, 0x00, 0xDB, 0xFF, 0xDB, 0xFF, 0xB6, 0xFF, 
-    0xC3, 0xFF, 0x60, 0x00, 0x78, 0x00, 0xE6, 0x00, 0x48, 0x00, 0x54, 0x00, 0x92, 0xFF, 0x61, 0xFF, 
-    0x23, 0x03, 0x48, 0x02, 0xA9, 0x05, 0x60, 0x00, 0x54, 0x00, 0xB6, 0xFB, 0x23, 0xFB, 0xB5, 0xFA, 
-    0x9D, 0xFC, 0xDB, 0xFE, 0x92, 0xFF, 0xC2, 0xFF, 0x9D, 0xFE, 0x91, 0xFE, 0xA9, 0xFD, 0xFE, 0xFD, 
-    0xA9, 0xFD, 0x0B, 0xFF, 0x16, 0xFE, 0xAA, 0xFF, 0x48, 0xFF, 0xCE, 0x00, 0xE7, 0x00, 0x49, 0x01, 
-    0xE7, 0x00, 0x48, 0x00, 0x91, 0xFF, 0x60, 0xFF, 0xC2, 0xFF, 0x60, 0x00, 0x49, 0x01, 0x62, 0x01, 
-    0x9F, 0x01, 0x3D, 0x01, 0x9E, 0x00, 0xF3, 0xFF, 0x85, 0xFF, 0x85, 0xFF, 0xCE, 0xFF, 0xDB, 0xFF, 
-    0x54, 0x00, 0x30, 0x00, 0x61, 0x00, 0xCE, 0xFF, 0xB6, 0xFF, 0xF3, 0xFF, 0x30, 0x00, 0x17, 0x00, 
-    0xF3, 0xFF, 0xB6, 0xFF, 0x0A, 0xFF, 0x3B, 0xFF, 0x52, 0xFE, 0x47, 0xFF, 0xFE, 0xFE, 0xAA, 0xFF, 
-    0xDB, 0xFF, 0x48, 0x00, 0x3C, 0x00, 0xDB, 0xFF, 0x85, 0xFF, 0x47, 0xFF, 0x60, 0xFF, 0x00, 0x00, 
-    0xE7, 0xFF, 0x0D, 0x01, 0x55, 0x00, 0x6D, 0x00, 0x23, 0x00, 0x9D, 0xFF, 0x23, 0x00, 0xC2, 0xFF, 
-    0x3C, 0x00, 0xC3, 0x00, 0xE7, 0xFF, 0xC3, 0x00, 0x53, 0xFF, 0x0D, 0x01, 0xC2, 0xFF, 0x0D, 0x01, 
-    0x17, 0x00, 0x86, 0x00, 0xB6, 0xFF, 0x78, 0xFF, 0x3A, 0xFF, 0xB6, 0xFF, 0xC2, 0xFF, 0x86, 0x00, 
-    0x61, 0x00, 0x6D, 0x00, 0xE7, 0xFF, 0x47, 0xFF, 0xB6, 0xFF, 0x21, 0xFF, 0xF3, 0xFF, 0xC2, 0xFF, 
-    0x7A, 0x00, 0x6E, 0x00, 0xE7, 0xFF, 0x6E, 0x00, 0x9D, 0xFF, 0x55, 0x00, 0xA9, 0xFF, 0x17, 0x00, 
-    0xCE, 0xFF, 0x17, 0x00, 0xC2, 0xFF, 0x61, 0x00, 0xC2, 0xFF, 0x49, 0x00, 0xB5, 0xFF, 0x6E, 0x00, 
-    0x61, 0x00, 0x3C, 0x00, 0x30, 0x00, 0x17, 0x00, 0xCE, 0xFF, 0xE7, 0xFF, 0xF3, 0xFF, 0x3C, 0x00, 
-    0x7A, 0x00, 0xE7, 0xFF, 0x0B, 0x00, 0x30, 0x00, 0x87, 0x00, 0xCE, 0xFF, 0xC2, 0xFF, 0x39, 0xFF, 
-    0x6B, 0xFF, 0xE3, 0xFE, 0xF3, 0xFF, 0x00, 0x00, 0x7A, 0x03, 0x24, 0x09, 0x66, 0x0A, 0xB9, 0x0C, 
-    0xB5, 0x05, 0xFB, 0x01, 0xAC, 0xFA, 0xCC, 0xF6, 0x02, 0xF8, 0xD5, 0xFB, 0xA0, 0x00, 0x6B, 0x02, 
-    0xDA, 0xFF, 0x93, 0xFD, 0x0E, 0xFB, 0xD0, 0xFA, 0x12, 0xFC, 0x07, 0xFF, 0xAE, 0x03, 0x21, 0x0A, 
-    0x2B, 0x0C, 0xF9, 0x0B, 0xA4, 0x06, 0x5F, 0x02, 0x50, 0xFC, 0x1C, 0xF9, 0x9F, 0xF8, 0xD3, 0xFB, 
-    0x13, 0xFF, 0xD2, 0x00, 0xD2, 0x00, 0xD2, 0x00, 0xF3, 0xFF, 0x1B, 0xFE, 0x02, 0xFE, 0x80, 0xFC, 
-    0x79, 0xFD, 0xD2, 0xFB, 0x7B, 0xFB, 0xFC, 0xFC, 0xDC, 0xFD, 0x00, 0x00, 0x3D, 0x00, 0xCE, 0xFF, 
-    0xC1, 0xFF, 0xDC, 0xFD, 0xBC, 0xFE, 0x7E, 0xFE, 0x99, 0x01, 0x54, 0x02, 0x66, 0x03, 0xD8, 0x01, 
-    0xAD, 0x00, 0x47, 0x04, 0xB8, 0x02, 0xB3, 0x01, 0xE1, 0xFE, 0x8A, 0xFC, 0x39, 0xFD, 0x77, 0xFD, 
-    0xB5, 0xFD, 0x68, 0x01, 0xD4, 0xFE, 0x56, 0x00, 0xAF, 0xFC, 0x24, 0x00, 0xBB, 0xFE, 0x6F, 0x00, 
-    0x3E, 0xFE, 0xC1, 0xFD, 0x00, 0xFE, 0xE1, 0xFC, 0xD4, 0xFE, 0x00, 0x00, 0xC0, 0x01, 0xB4, 0x01, 
-    0x5C, 0x01, 0xA8, 0xFF, 0x7B, 0x00, 0xC7, 0xFE, 0x9B, 0x01, 0xF8, 0x00, 0xF3, 0x03, 0x7C, 0x02, 
-    0xCD, 0x01, 0x7C, 0x00, 0x31, 0xFE, 0xC7, 0xFE, 0xB4, 0xFD, 0x24, 0x00, 0x56, 0x00, 0x3D, 0x00, 
-    0xBA, 0x00, 0x30, 0xFE, 0x56, 0x00, 0xCC, 0xFD, 0x25, 0x02, 0x0C, 0x02, 0xBD, 0x04, 0xB6, 0x03, 
-    0x5D, 0x01, 0x3D, 0x00, 0x6D, 0xFC, 0x0A, 0xFE, 0x4E, 0xFD, 0xAE, 0x00, 0x44, 0x01, 0xC7, 0x00, 
-    0xF3, 0xFF, 0x23, 0xFE, 0x55, 0xFE, 0x0A, 0xFE, 0x35, 0xFD, 0x95, 0x00, 0x37, 0xFF, 0x12, 0x01, 
-    0xC1, 0xFF, 0x2A, 0xFF, 0x45, 0x01, 0xC1, 0xFF, 0x01, 0x02, 0x5E, 0x01, 0xA2, 0x00, 0x5E, 0x01, 
-    0xF8, 0xFE, 0xED, 0x00, 0xBB, 0x00, 0xA5, 0x02, 0x5E, 0x01, 0x1B, 0x02, 0x0B, 0x00, 0x1D, 0xFF, 
-    0xCA, 0xFD, 0xE3, 0xFD, 0x8E, 0xFF, 0x5C, 0xFF, 0x5F, 0x01, 0x69, 0xFF, 0xA2, 0x00, 0xD6, 0xFD, 
-    0x82, 0xFF, 0xB8, 0xFE, 0x85, 0x01, 0x5F, 0x01, 0xDD, 0x01, 0x5F, 0x01, 0x5C, 0xFF, 0xC1, 0xFF, 
-    0x3A, 0xFE, 0xE1, 0x00, 0xAF, 0x00, 0x6C, 0x01, 0xE1, 0x00, 0x07, 0x01, 0x4A, 0x00, 0xE1, 0x00, 
-    0x31, 0x00, 0x28, 0x02, 0x07, 0x01, 0xAB, 0x01, 0x60, 0xFE, 0x9B, 0xFF, 0xC5, 0xFE, 0xC1, 0xFF, 
-    0x39, 0x01, 0x07, 0x01, 0x0F, 0x02, 0xF3, 0xFF, 0x4F, 0xFF, 0x5C, 0xFF, 0xB4, 0xFF, 0x5F, 0x01, 
-    0x6C, 0x01, 0x52, 0x01, 0xE1, 0x00, 0xCD, 0xFF, 0x3D, 0x00, 0x4F, 0xFF, 0x31, 0x00, 0x68, 0xFF, 
-    0x8E, 0xFF, 0x36, 0xFF, 0xC1, 0xFF, 0x18, 0x00, 0x63, 0x00, 0x00, 0x00, 0xB4, 0xFF, 0xDE, 0xFE, 
-    0xDE, 0xFE, 0x9F, 0xFE, 0x36, 0xFF, 0x9B, 0xFF, 0x5C, 0xFF, 0x00, 0x00, 0xF7, 0xFE, 0x24, 0x00, 
-    0x68, 0xFF, 0xE6, 0xFF, 0x18, 0x00, 0xB4, 0xFF, 0xCD, 0xFF, 0x04, 0xFF, 0xDA, 0xFF, 0x75, 0xFF, 
-    0x57, 0x00, 0x24, 0x00, 0xEE, 0x00, 0x89, 0x00, 0xFA, 0x00, 0x24, 0x00, 0xFA, 0x00, 0x7C, 0x00, 
-    0x24, 0x00, 0x89, 0x00, 0x75, 0xFF, 0x18, 0x00, 0x43, 0xFF, 0xE6, 0xFF, 0x75, 0xFF, 0xEB, 0xFE, 
-    0x08, 0xFE, 0x19, 0xFD, 0x29, 0xFF, 0x43, 0xFF, 0x9E, 0x01, 0x91, 0x01, 0x6C, 0x04, 0x2C, 0x0D, 
-    0xD0, 0x0A, 0xED, 0x0C, 0x42, 0x02, 0xC5, 0xFE, 0x79, 0xF8, 0x6D, 0xF8, 0x15, 0xFB, 0x5B, 0x02, 
-    0x4A, 0x03, 0x91, 0x01, 0xB8, 0xFB, 0x93, 0xF8, 0x10, 0xF9, 0x15, 0xFB, 0x0C, 0xFD, 0x96, 0x00, 
-    0x57, 0x00, 0xA3, 0xFD, 0xE2, 0xFA, 0x15, 0xFB, 0xC1, 0xFC, 0x46, 0x01, 0x81, 0x02, 0x67, 0x02, 
-    0xA2, 0x00, 0x7D, 0xFD, 0x68, 0xFC, 0xC9, 0xFD, 0xA2, 0x00, 0x35, 0x05, 0xFA, 0x06, 0x9A, 0x05, 
-    0x42, 0x02, 0x21, 0xFE, 0x5C, 0xFC, 0x64, 0xFD, 0x79, 0xFE, 0xC8, 0x00, 0x6C, 0x01, 0xD5, 0x00, 
-    0x0C, 0xFD, 0xD6, 0xFA, 0x04, 0xF9, 0x15, 0xFB, 0xB4, 0xFC, 0x31, 0x00, 0x96, 0x00, 0x63, 0x00, 
-    0x47, 0xFE, 0x9B, 0xFC, 0xA7, 0xFC, 0xA3, 0xFD, 0x8E, 0xFF, 0x89, 0x00, 0xC8, 0x00, 0x24, 0x00, 
-    0xC1, 0xFF, 0x9B, 0xFF, 0xC1, 0xFF, 0xA2, 0x00, 0x24, 0x00, 0xFA, 0x00, 0x2D, 0x01, 0x70, 0x00, 
-    0xA2, 0x00, 0xCD, 0xFF, 0xD5, 0x00, 0x57, 0x00, 0xA2, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 
-    0x75, 0xFF, 0x63, 0x00, 0x82, 0xFF, 0xD0, 0x01, 0x0B, 0x00, 0x0F, 0x05, 0xA2, 0x03, 0xFE, 0x05, 
-    0x1C, 0x02, 0xBB, 0x00, 0x08, 0xFE, 0x4B, 0xFD, 0x21, 0xFE, 0x4A, 0x00, 0x35, 0x02, 0xEE, 0x00, 
-    0x10, 0xFF, 0x9B, 0xFC, 0xDA, 0xFC, 0xE6, 0xFC, 0x29, 0xFF, 0x57, 0x00, 0x0F, 0x02, 0x78, 0x01, 
-    0x8E, 0xFF, 0x1D, 0xFF, 0x5C, 0xFF, 0x5F, 0x01, 0xF2, 0x02, 0x24, 0x03, 0x8D, 0x02, 0x52, 0x01, 
-    0x9B, 0xFF, 0xF7, 0xFE, 0x4A, 0x00, 0x9E, 0x01, 0xD4, 0x03, 0xBF, 0x02, 0xB7, 0x01, 0xF3, 0xFF, 
-    0xD1, 0xFE, 0x60, 0xFE, 0x04, 0xFF, 0xDA, 0xFF, 0x3D, 0x00, 0xC8, 0x00, 0x82, 0xFF, 0xEB, 0xFE, 
-    0x3A, 0xFE, 0x2E, 0xFE, 0x1D, 0xFF, 0x8E, 0xFF, 0x57, 0x00, 0x57, 0x00, 0x0B, 0x00, 0xA7, 0xFF, 
-    0x36, 0xFF, 0x31, 0x00, 0x07, 0x01, 0x28, 0x02, 0x1C, 0x02, 0xD0, 0x01, 0x9E, 0x01, 0x20, 0x01, 
-    0xEE, 0x00, 0x57, 0x00, 0xBB, 0x00, 0x70, 0x00, 0x39, 0x01, 0x96, 0x00, 0x7C, 0x00, 0x57, 0x00, 
-    0x24, 0x00, 0x43, 0xFF, 0x1D, 0xFF, 0x10, 0xFF, 0x29, 0xFF, 0x43, 0xFF, 0x92, 0xFE, 0x36, 0xFF, 
-    0x75, 0xFF, 0xC8, 0x00, 0xD5, 0x00, 0x6C, 0x01, 0x89, 0x00, 0x04, 0xFF, 0x47, 0xFE, 0xC9, 0xFD, 
-    0xC5, 0xFE, 0x57, 0x00, 0xE9, 0x01, 0x5B, 0x02, 0x03, 0x02, 0xE6, 0xFF, 0xD1, 0xFE, 0x3A, 0xFE, 
-    0x79, 0xFE, 0xF3, 0xFF, 0x78, 0x01, 0x67, 0x02, 0x2D, 0x01, 0xCD, 0xFF, 0xFB, 0xFD, 0x15, 0xFE, 
-    0xB8, 0xFE, 0xF7, 0xFE, 0x43, 0xFF, 0x31, 0x00, 0x36, 0xFF, 0xF3, 0xFF, 0x92, 0xFE, 0x4F, 0xFF, 
-    0x31, 0x00, 0x13, 0x01, 0x52, 0x01, 0x20, 0x01, 0xA2, 0x00, 0xA2, 0x00, 0xD4, 0x00, 0x18, 0x00, 
-    0xCD, 0xFF, 0x57, 0x00, 0xC1, 0xFF, 0x00, 0x00, 0x3D, 0x00, 0x57, 0x00, 0x5F, 0x01, 0xBB, 0x00, 
-    0xA7, 0xFF, 0x86, 0xFE, 0x2E, 0xFE, 0xF7, 0xFE, 0x5C, 0xFF, 0xB4, 0xFF, 0x89, 0x00, 0xBB, 0x03, 
-    0x17, 0x03, 0xD9, 0x02, 0x8E, 0xFF, 0x6D, 0xFE, 0x00, 0xFD, 0x71, 0xFD, 0xC5, 0xFE, 0x03, 0x02, 
-    0xBB, 0x03, 0x8D, 0x02, 0x63, 0x00, 0x15, 0xFE, 0x15, 0xFE, 0xDE, 0xFE, 0xCD, 0xFF, 0xFA, 0x00, 
-    0x78, 0x01, 0x39, 0x01, 0xC1, 0xFF, 0x21, 0xFE, 0x47, 0xFE, 0xF7, 0xFE, 0xE6, 0xFF, 0x18, 0x00, 
-    0xB4, 0xFF, 0x9F, 0xFE, 0xAC, 0xFE, 0x6D, 0xFE, 0x5C, 0xFF, 0x89, 0x00, 0x20, 0x01, 0x07, 0x01, 
-    0x68, 0xFF, 0xEF, 0xFD, 0xFC, 0xFD, 0x36, 0xFF, 0x70, 0x00, 0xAA, 0x01, 0x6B, 0x01, 0x3D, 0x00, 
-    0xC5, 0xFE, 0xA8, 0xFC, 0x5C, 0xFC, 0x97, 0xFD, 0x00, 0x00, 0xFA, 0x00, 0x78, 0x01, 0x70, 0x00, 
-    0xA7, 0xFF, 0x79, 0xFE, 0xFC, 0xFD, 0xF3, 0xFF, 0x20, 0x01, 0x1C, 0x02, 0x5F, 0x01, 0xA7, 0xFF, 
-    0xAC, 0xFE, 0xAC, 0xFE, 0xCD, 0xFF, 0x2C, 0x01, 0x02, 0x02, 0x78, 0x01, 0xBB, 0x00, 0xCD, 0xFF, 
-    0x69, 0xFF, 0x75, 0xFF, 0x95, 0x00, 0x39, 0x01, 0xEE, 0x00, 0xA7, 0xFF, 0x79, 0xFE, 0x93, 0xFE, 
-    0x47, 0xFE, 0xA7, 0xFF, 0x07, 0x01, 0x28, 0x02, 0xC3, 0x01, 0x57, 0x00, 0xC5, 0xFE, 0x10, 0xFF, 
-    0x04, 0xFF, 0x57, 0x00, 0x95, 0x00, 0x7C, 0x00, 0xA2, 0x00, 0x36, 0xFF, 0xF7, 0xFE, 0x4F, 0xFF, 
-    0x18, 0x00, 0x63, 0x00, 0xF3, 0xFF, 0x10, 0xFF, 0xAC, 0xFE, 0x7A, 0xFE, 0xAC, 0xFE, 0xB4, 0xFF, 
-    0xE1, 0x00, 0xC3, 0x01, 0x78, 0x01, 0x57, 0x00, 0x1D, 0xFF, 0x9F, 0xFE, 0xDE, 0xFE, 0x82, 0xFF, 
-    0x7C, 0x00, 0x89, 0x00, 0xE6, 0xFF, 0xEB, 0xFE, 0x7A, 0xFE, 0x04, 0xFF, 0xDA, 0xFF, 0xD4, 0x00, 
-    0x91, 0x01, 0x41, 0x02, 0x35, 0x02, 0x91, 0x01, 0x84, 0x01, 0xAA, 0x01, 0x28, 0x02, 0x34, 0x02, 
-    0x9E, 0x01, 0x18, 0x00, 0x36, 0xFF, 0x8B, 0xFD, 0x0D, 0xFD, 0x7E, 0xFD, 0x86, 0xFE, 0x82, 0xFF, 
-    0x82, 0xFF, 0x5C, 0xFF, 0xB4, 0xFF, 0xC8, 0x00, 0x91, 0x01, 0x67, 0x02, 0xCB, 0x02, 0x1B, 0x02, 
-    0xED, 0x00, 0x3D, 0x00, 0x0B, 0x00, 0x7C, 0x00, 0xE1, 0x00, 0x31, 0x00, 0x18, 0x00, 0xAC, 0xFE, 
-    0xFC, 0xFD, 0xB0, 0xFD, 0x3B, 0xFE, 0xA7, 0xFF, 0x63, 0x00, 0x13, 0x01, 0x52, 0x01, 0xD0, 0x01, 
-    0xDC, 0x01, 0x02, 0x02, 0x02, 0x02, 0x8C, 0x02, 0x8C, 0x02, 0xB7, 0x01, 0x70, 0x00, 0x18, 0x00, 
-    0x00, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0xDA, 0xFF, 0x52, 0x01, 0xC3, 0x01, 0x07, 0x01, 0xF3, 0xFF, 
-    0xC1, 0xFF, 0x24, 0x00, 0xA2, 0x00, 0xC8, 0x00, 0x52, 0x01, 0x1B, 0x02, 0x8C, 0x02, 0xED, 0x00, 
-    0x36, 0xFF, 0x2E, 0xFE, 0xFC, 0xFD, 0xB9, 0xFE, 0xC5, 0xFE, 0xEB, 0xFE, 0x75, 0xFF, 0x8E, 0xFF, 
-    0xA7, 0xFF, 0x1D, 0xFF, 0x93, 0xFE, 0x43, 0xFF, 0xB9, 0xFE, 0x86, 0xFE, 0x2A, 0xFF, 0x70, 0x00, 
-    0xE9, 0x01, 0x67, 0x02, 0x45, 0x01, 0xE6, 0xFF, 0xB9, 0xFE, 0x7A, 0xFE, 0x04, 0xFF, 0x8E, 0xFF, 
-    0x63, 0x00, 0x0B, 0x00, 0x11, 0xFF, 0x72, 0xFD, 0xB5, 0xFC, 0x90, 0xFC, 0x22, 0xFE, 0x5C, 0xFF, 
-    0x82, 0xFF, 0x18, 0x00, 0xCD, 0xFF, 0x4A, 0x00, 0x63, 0x00, 0xF3, 0xFF, 0xC1, 0xFF, 0x0B, 0x00, 
-    0x24, 0x00, 0xBB, 0x00, 0x2C, 0x01, 0x1B, 0x02, 0x4D, 0x02, 0x9D, 0x01, 0x8E, 0xFF, 0x15, 0xFE, 
-    0x8B, 0xFD, 0xFC, 0xFD, 0xD2, 0xFE, 0xCD, 0xFF, 0x3D, 0x00, 0x89, 0x00, 0xC8, 0x00, 0x3D, 0x00, 
-    0xB4, 0xFF, 0x93, 0xFE, 0x8B, 0xFD, 0x72, 0xFD, 0x2E, 0xFE, 0x9B, 0xFF, 0xC3, 0x01, 0xA5, 0x02, 
-    0x99, 0x02, 0x52, 0x01, 0x69, 0xFF, 0xBD, 0xFD, 0x61, 0xFE, 0x50, 0xFF, 0x95, 0x00, 0xBB, 0x00, 
-    0xF3, 0xFF, 0x43, 0xFF, 0x50, 0xFF, 0xCD, 0xFF, 0xA2, 0x00, 0xD0, 0x01, 0x45, 0x01, 0x4A, 0x00, 
-    0x7A, 0xFE, 0x26, 0xFD, 0xCE, 0xFC, 0xE3, 0xFD, 0xC1, 0xFF, 0x52, 0x01, 0xB7, 0x01, 0xED, 0x00, 
-    0x00, 0x00, 0xD2, 0xFE, 0x86, 0xFE, 0xB4, 0xFF, 0xD0, 0x01, 0x3C, 0x03, 0x51, 0x04, 0x6A, 0x04, 
-    0x51, 0x04, 0x2B, 0x04, 0x8C, 0x02, 0xFA, 0x00, 0xDA, 0xFF, 0x4F, 0xFF, 0x2A, 0xFF, 0x9B, 0xFF, 
-    0xBB, 0x00, 0xB2, 0x02, 0xE0, 0x03, 0xBA, 0x03, 0x30, 0x03, 0xE9, 0x01, 0x2C, 0x01, 0x0B, 0x00, 
-    0xF7, 0xFE, 0xEB, 0xFE, 0x8E, 0xFF, 0xC8, 0x00, 0xE1, 0x00, 0x31, 0x00, 0x43, 0xFF, 0xBD, 0xFD, 
-    0xB5, 0xFC, 0xEC, 0xFB, 0x9C, 0xFC, 0x3B, 0xFE, 0xCD, 0xFF, 0x84, 0x01, 0x9D, 0x01, 0x39, 0x01, 
-    0x7C, 0x00, 0x04, 0xFF, 0xB9, 0xFE, 0xAC, 0xFE, 0x36, 0xFF, 0x7C, 0x00, 0x63, 0x00, 0xE6, 0xFF, 
-    0xAC, 0xFE, 0x97, 0xFD, 0x72, 0xFD, 0x7E, 0xFD, 0x47, 0xFE, 0x1D, 0xFF, 0xB4, 0xFF, 0x63, 0x00, 
-    0x0B, 0x00, 0x8E, 0xFF, 0x69, 0xFF, 0x69, 0xFF, 0xB4, 0xFF, 0x00, 0x00, 0x63, 0x00, 0x84, 0x01, 
-    0x80, 0x02, 0x30, 0x03, 0xE5, 0x02, 0x02, 0x02, 0x20, 0x01, 0x4A, 0x00, 0x89, 0x00, 0xAF, 0x00, 
-    0xAF, 0x00, 0xAF, 0x00, 0xB4, 0xFF, 0xAC, 0xFE, 0x97, 0xFD, 0xC1, 0xFC, 0x97, 0xFD, 0x6D, 0xFE, 
-    0x04, 0xFF, 0xEB, 0xFE, 0xEF, 0xFD, 0x08, 0xFE, 0xDE, 0xFE, 0x43, 0xFF, 0x0B, 0x00, 0xBB, 0x00, 
-    0x7C, 0x00, 0xCD, 0xFF, 0x08, 0xFE, 0x76, 0xFC, 0x8F, 0xFC, 0xBD, 0xFD, 0xF7, 0xFE, 0xA7, 0xFF, 
-    0xF3, 0xFF, 0xA7, 0xFF, 0x86, 0xFE, 0xA4, 0xFD, 0x9B, 0xFC, 0x71, 0xFD, 0x1D, 0xFF, 0x4A, 0x00, 
-    0xE1, 0x00, 0x70, 0x00, 0x5C, 0xFF, 0x3B, 0xFE, 0x58, 0xFD, 0x0D, 0xFD, 0x60, 0xFE, 0x0B, 0x00, 
-    0x07, 0x01, 0x63, 0x00, 0xDA, 0xFF, 0x36, 0xFF, 0x00, 0x00, 0xBB, 0x00, 0xD4, 0x00, 0x95, 0x00, 
-    0x43, 0xFF, 0x2E, 0xFE, 0xE2, 0xFD, 0xE2, 0xFD, 0x43, 0xFF, 0xBB, 0x00, 0xC8, 0x00, 0xB4, 0xFF, 
-    0x21, 0xFE, 0x7E, 0xFD, 0x86, 0xFE, 0x31, 0x00, 0xEE, 0x00, 0x95, 0x00, 0x8E, 0xFF, 0x93, 0xFE, 
-    0xFC, 0xFD, 0x6D, 0xFE, 0x7C, 0x00, 0x4A, 0x03, 0x41, 0x05, 0x9D, 0x04, 0xA6, 0x02, 0x7C, 0x00, 
-    0x36, 0xFF, 0xF7, 0xFE, 0x79, 0xFE, 0x79, 0xFE, 0xC1, 0xFF, 0xA7, 0xFF, 0x4F, 0xFF, 0x6D, 0xFE, 
-    0xD1, 0xFE, 0x00, 0x00, 0x31, 0x00, 0xBB, 0x00, 0xB7, 0x01, 0xBF, 0x02, 0x2C, 0x04, 0x20, 0x04, 
-    0x6B, 0x04, 0xA6, 0x05, 0x6B, 0x07, 0xC7, 0x09, 0x1B, 0x0B, 0xBE, 0x0B, 0x7F, 0x0B, 0x2C, 0x0A, 
-    0x39, 0x07, 0xC8, 0x03, 0x85, 0x01, 0xFA, 0x00, 0xBB, 0x00, 0xE1, 0x00, 0xFA, 0x00, 0x52, 0x01, 
-    0xD0, 0x01, 0x78, 0x01, 0xE1, 0x00, 0xC1, 0xFF, 0xE6, 0xFF, 0x3D, 0x00, 0xD4, 0x00, 0x4E, 0x02, 
-    0x52, 0x04, 0x6F, 0x06, 0xBB, 0x06, 0x0F, 0x05, 0x5B, 0x02, 0xD1, 0xFE, 0xF3, 0xFC, 0x82, 0xFC, 
-    0x69, 0xFC, 0x6D, 0xFE, 0x63, 0x00, 0x39, 0x01, 0x96, 0x00, 0xB8, 0xFE, 0xA3, 0xFD, 0x64, 0xFD, 
-    0x64, 0xFD, 0xEF, 0xFD, 0x47, 0xFE, 0x60, 0xFE, 0x79, 0xFE, 0x21, 0xFE, 0xD6, 0xFD, 0xEF, 0xFD, 
-    0x15, 0xFE, 0xBC, 0xFD, 0xB4, 0xFC, 0x93, 0xFB, 0x47, 0xFB, 0xDE, 0xFB, 0xCD, 0xFC, 0x58, 0xFD, 
-    0x7D, 0xFD, 0x0C, 0xFD, 0x82, 0xFC, 0x04, 0xFC, 0x43, 0xFC, 0xE6, 0xFC, 0xE2, 0xFD, 0x53, 0xFE, 
-    0xFB, 0xFD, 0xDA, 0xFC, 0xAC, 0xFB, 0x3A, 0xFB, 0x6D, 0xFB, 0x10, 0xFC, 0x0C, 0xFD, 0xDA, 0xFC, 
-    0x9B, 0xFC, 0x86, 0xFB, 0x00, 0xFA, 0x10, 0xF9, 0x86, 0xF8, 0x9B, 0xF9, 0x97, 0xFA, 0x54, 0xFB, 
-    0x3F, 0xFD, 0x79, 0xFE, 0xD1, 0xFE, 0x2E, 0xFE, 0x86, 0xFB, 0x1D, 0xF9, 0x21, 0xF8, 0x9B, 0xF9, 
-    0x68, 0xFC, 0xC5, 0xFE, 0x63, 0x00, 0x9B, 0xFF, 0x08, 0xFE, 0x58, 0xFD, 0x4B, 0xFD, 0x3A, 0xFE, 
-    0xEB, 0xFE, 0x29, 0xFF, 0xC1, 0xFF, 0x82, 0xFF, 0xC1, 0xFF, 0xE1, 0x00, 0x0F, 0x02, 0xF2, 0x02, 
-    0x1C, 0x02, 0x0B, 0x00, 0xA3, 0xFD, 0x82, 0xFC, 0x58, 0xFD, 0x21, 0xFE, 0x9B, 0xFF, 0xC4, 0x01, 
-    0xF6, 0x01, 0x63, 0x00, 0x97, 0xFD, 0x36, 0xFC, 0x9F, 0xFE, 0x8D, 0x02, 0x95, 0x06, 0xF2, 0x08, 
-    0xCC, 0x08, 0x5B, 0x05, 0x46, 0x01, 0x9F, 0xFE, 0xDA, 0xFF, 0xE5, 0x05, 0xF2, 0x0B, 0xFE, 0x0E, 
-    0xFE, 0x0E, 0x85, 0x0A, 0xAF, 0x06, 0x9A, 0x05, 0xA6, 0x05, 0x91, 0x07, 0x24, 0x09, 0x18, 0x09, 
-    0x9E, 0x07, 0xF6, 0x04, 0x85, 0x04, 0xCC, 0x05, 0xFA, 0x06, 0xB7, 0x07, 0xA6, 0x05, 0x24, 0x03, 
-    0xD0, 0x01, 0xEE, 0x00, 0x0F, 0x02, 0xFA, 0x03, 0x42, 0x05, 0x57, 0x06, 0x46, 0x04, 0x85, 0x01, 
-    0x00, 0x00, 0xD1, 0xFE, 0x4A, 0x00, 0x74, 0x02, 0xF2, 0x02, 0x96, 0x03, 0x0B, 0x03, 0x2D, 0x01, 
-    0xE6, 0xFF, 0xF7, 0xFE, 0xEB, 0xFE, 0xDE, 0xFE, 0xD1, 0xFE, 0xAC, 0xFE, 0xC9, 0xFD, 0xB0, 0xFD, 
-    0xFB, 0xFD, 0x21, 0xFE, 0xB8, 0xFE, 0xD1, 0xFE, 0x6D, 0xFE, 0x21, 0xFE, 0x21, 0xFE, 0x9F, 0xFE, 
-    0x29, 0xFF, 0x82, 0xFF, 0x82, 0xFF, 0xEB, 0xFE, 0x64, 0xFD, 0xE6, 0xFC, 0xCD, 0xFC, 0x32, 0xFD, 
-    0x53, 0xFE, 0x86, 0xFE, 0x21, 0xFE, 0xE2, 0xFD, 0x32, 0xFD, 0xA7, 0xFC, 0x75, 0xFC, 0xA7, 0xFC, 
-    0x4B, 0xFD, 0xA3, 0xFD, 0xA3, 0xFD, 0x32, 0xFD, 0x5C, 0xFC, 0x04, 0xFC, 0xF7, 0xFB, 0x2A, 0xFC, 
-    0xDA, 0xFC, 0x0C, 0xFD, 0x19, 0xFD, 0xB4, 0xFC, 0x1D, 0xFC, 0xF7, 0xFB, 0xDE, 0xFB, 0xEB, 0xFB, 
-    0x36, 0xFC, 0x68, 0xFC, 0xA7, 0xFC, 0x32, 0xFD, 0x8A, 0xFD, 0x64, 0xFD, 0x00, 0xFD, 0x75, 0xFC, 
-    0x9F, 0xFB, 0x92, 0xFB, 0xC5, 0xFB, 0x04, 0xFC, 0x5C, 0xFC, 0x43, 0xFC, 0x86, 0xFB, 0x08, 0xFB, 
-    0x97, 0xFA, 0x64, 0xFA, 0x4B, 0xFA, 0xB0, 0xFA, 0xD6, 0xFA, 0x08, 0xFB, 0x15, 0xFB, 0x21, 0xFB, 
-    0xB8, 0xFB, 0x82, 0xFC, 0x0C, 0xFD, 0x19, 0xFD, 0xDA, 0xFC, 0xC1, 0xFC, 0xB4, 0xFC, 0xCD, 0xFC, 
-    0x32, 0xFD, 0x8A, 0xFD, 0x97, 0xFD, 0x3A, 0xFE, 0xAC, 0xFE, 0x68, 0xFF, 0xC4, 0x01, 0xA2, 0x03, 
-    0x89, 0x03, 0x3D, 0x03, 0xDD, 0x01, 0xC8, 0x00, 0x91, 0x01, 0x0B, 0x03, 0x5F, 0x04, 0x0F, 0x05, 
-    0xE1, 0x03, 0x42, 0x02, 0x7C, 0x00, 0x75, 0xFF, 0x7C, 0x00, 0x20, 0x01, 0xD4, 0x03, 0x4E, 0x08, 
-    0x02, 0x0B, 0x3D, 0x0F, 0x13, 0x13, 0x91, 0x13, 0x78, 0x13, 0x52, 0x10, 0x41, 0x0E, 0x9E, 0x0D, 
-    0xC8, 0x0C, 0x52, 0x0D, 0x70, 0x0C, 0x2C, 0x0A, 0x91, 0x07, 0x70, 0x03, 0x57, 0x00, 0x92, 0xFE, 
-    0x2E, 0xFE, 0xF7, 0xFE, 0x5C, 0xFF, 0xC1, 0xFF, 0xC1, 0xFF, 0x0B, 0x00, 0x63, 0x00, 0xD5, 0x00, 
-    0x5F, 0x01, 0xC4, 0x01, 0x67, 0x02, 0x8D, 0x02, 0x5B, 0x02, 0x28, 0x02, 0x6C, 0x01, 0x9E, 0x01, 
-    0x13, 0x01, 0x7C, 0x00, 0x31, 0x00, 0x29, 0xFF, 0x21, 0xFE, 0x82, 0xFC, 0x86, 0xFB, 0xAC, 0xFB, 
-    0x43, 0xFC, 0xF3, 0xFC, 0xBC, 0xFD, 0xA3, 0xFD, 0xEF, 0xFD, 0xEB, 0xFE, 0xDA, 0xFF, 0x4A, 0x00, 
-    0xBB, 0x00, 0x7C, 0x00, 0xF3, 0xFF, 0x5C, 0xFF, 0xF7, 0xFE, 0x43, 0xFF, 0x68, 0xFF, 0x82, 0xFF, 
-    0x04, 0xFF, 0xEF, 0xFD, 0x19, 0xFD, 0xCD, 0xFC, 0xDA, 0xFC, 0x4B, 0xFD, 0x53, 0xFE, 0x5C, 0xFF, 
-    0xCD, 0xFF, 0xB4, 0xFF, 0xF7, 0xFE, 0x2E, 0xFE, 0x97, 0xFD, 0xE6, 0xFC, 0x43, 0xFC, 0xB8, 0xFB, 
-    0xEF, 0xFA, 0x97, 0xFA, 0x58, 0xFA, 0x71, 0xFA, 0xEF, 0xFA, 0xAC, 0xFB, 0x1D, 0xFC, 0x1D, 0xFC, 
-    0xEB, 0xFB, 0x10, 0xFC, 0x4F, 0xFC, 0xB4, 0xFC, 0xA3, 0xFD, 0x86, 0xFE, 0x82, 0xFF, 0x0B, 0x00, 
-    0xF3, 0xFF, 0x10, 0xFF, 0xE2, 0xFD, 0xC1, 0xFC, 0xB8, 0xFB, 0x15, 0xFB, 0x08, 0xFB, 0xFB, 0xFA, 
-    0x3A, 0xFB, 0x60, 0xFB, 0xAC, 0xFB, 0xC5, 0xFB, 0xD1, 0xFB, 0xF7, 0xFB, 0xB8, 0xFB, 0x60, 0xFB, 
-    0x47, 0xFB, 0x6D, 0xFB, 0x86, 0xFB, 0xC5, 0xFB, 0x1D, 0xFC, 0xCD, 0xFC, 0x4B, 0xFD, 0x32, 0xFD, 
-    0x9B, 0xFC, 0x4F, 0xFC, 0xD1, 0xFB, 0x08, 0xFB, 0x7E, 0xFA, 0x0C, 0xFA, 0x97, 0xFA, 0x2A, 0xFC, 
-    0x08, 0xFE, 0x68, 0xFF, 0x31, 0x00, 0x96, 0x00, 0x8E, 0xFF, 0x2E, 0xFE, 0xB0, 0xFD, 0xFB, 0xFD, 
-    0x92, 0xFE, 0x8E, 0xFF, 0x07, 0x01, 0xAB, 0x01, 0x67, 0x02, 0x42, 0x02, 0x20, 0x01, 0x31, 0x00, 
-    0x96, 0x00, 0x13, 0x01, 0xCC, 0x02, 0x20, 0x04, 0xB7, 0x04, 0x0F, 0x08, 0x20, 0x0D, 0x78, 0x16, 
-    0xFE, 0x20, 0x63, 0x24, 0x1B, 0x23, 0x39, 0x1C, 0xC8, 0x12, 0x46, 0x0D, 0xFA, 0x09, 0x9E, 0x0A, 
-    0xBB, 0x0C, 0x8D, 0x0B, 0x9E, 0x07, 0x4A, 0x00, 0x4B, 0xFA, 0x58, 0xF7, 0x58, 0xF7, 0x54, 0xF8, 
-    0x04, 0xF9, 0xC1, 0xF9, 0x25, 0xFA, 0x10, 0xFC, 0xF7, 0xFE, 0xF6, 0x01, 0xFE, 0x05, 0x52, 0x07, 
-    0xD4, 0x06, 0xD0, 0x04, 0x8D, 0x02, 0xA6, 0x02, 0xBB, 0x03, 0x5B, 0x05, 0xF2, 0x05, 0xD0, 0x04, 
-    0x9A, 0x02, 0x8E, 0xFF, 0xB4, 0xFC, 0x19, 0xFA, 0xEB, 0xF8, 0xFB, 0xF7, 0x71, 0xF7, 0xA3, 0xF7, 
-    0x19, 0xF7, 0x97, 0xF7, 0xC5, 0xF8, 0x4B, 0xFA, 0x19, 0xFD, 0x31, 0x00, 0x31, 0x03, 0x35, 0x05, 
-    0x80, 0x05, 0x80, 0x05, 0x91, 0x04, 0x07, 0x04, 0xC8, 0x03, 0xE1, 0x03, 0xFA, 0x03, 0x7C, 0x03, 
-    0x5B, 0x02, 0x7C, 0x00, 0x08, 0xFE, 0x36, 0xFC, 0x8A, 0xFA, 0x00, 0xFA, 0x4B, 0xFA, 0xE2, 0xFA, 
-    0x92, 0xFB, 0xB8, 0xFB, 0xD1, 0xFB, 0x04, 0xFC, 0x2A, 0xFC, 0x8E, 0xFC, 0xDA, 0xFC, 0x19, 0xFD, 
-    0x58, 0xFD, 0x25, 0xFD, 0x4B, 0xFD, 0x7D, 0xFD, 0xEF, 0xFD, 0xAC, 0xFE, 0x10, 0xFF, 0x36, 0xFF, 
-    0xD1, 0xFE, 0x6D, 0xFE, 0x21, 0xFE, 0xE2, 0xFD, 0x64, 0xFD, 0x0C, 0xFD, 0xB4, 0xFC, 0x10, 0xFC, 
-    0x6D, 0xFB, 0xD6, 0xFA, 0x3F, 0xFA, 0x4B, 0xFA, 0x97, 0xFA, 0xD6, 0xFA, 0x15, 0xFB, 0xD6, 0xFA, 
-    0xEF, 0xFA, 0x08, 0xFB, 0x47, 0xFB, 0x10, 0xFC, 0x00, 0xFD, 0xFB, 0xFD, 0x04, 0xFF, 0x75, 0xFF, 
-    0x82, 0xFF, 0x9B, 0xFF, 0x68, 0xFF, 0x75, 0xFF, 0xCD, 0xFF, 0x8E, 0xFF, 0x29, 0xFF, 0x08, 0xFE, 
-    0x8E, 0xFC, 0x47, 0xFB, 0xA3, 0xFA, 0x71, 0xFA, 0x3F, 0xFA, 0x58, 0xFA, 0x0C, 0xFA, 0xAC, 0xF8, 
-    0x93, 0xF8, 0xC1, 0xF9, 0x60, 0xFB, 0x08, 0xFE, 0x8E, 0xFF, 0xCD, 0xFF, 0xB8, 0xFE, 0xE6, 0xFC, 
-    0x68, 0xFC, 0xDA, 0xFC, 0x15, 0xFE, 0xC1, 0xFF, 0x7C, 0x00, 0x00, 0x00, 0x31, 0x00, 0xBB, 0x00, 
-    0xA2, 0x00, 0x70, 0x00, 0x29, 0xFF, 0x25, 0xFD, 0x54, 0xFB, 0xE2, 0xFA, 0x08, 0xFB, 0x92, 0xFE, 
-    0x6B, 0x07, 0x20, 0x16, 0xDC, 0x25, 0x6F, 0x2D, 0x67, 0x2C, 0x7C, 0x24, 0xA2, 0x18, 0xA6, 0x0E, 
-    0x63, 0x09, 0xCC, 0x08, 0x52, 0x0D, 0x80, 0x0E, 0x5B, 0x0B, 0xB3, 0x02, 0x4F, 0xF9, 0x8E, 0xF3, 
-    0x4B, 0xF1, 0xF3, 0xF0, 0x54, 0xF2, 0x3F, 0xF4, 0x3F, 0xF7, 0xEF, 0xFA, 0xF7, 0xFE, 0xF2, 0x02, 
-    0x20, 0x07, 0xAF, 0x09, 0x24, 0x09, 0x13, 0x07, 0x03, 0x05, 0x74, 0x05, 0x9E, 0x07, 0xC8, 0x09, 
-    0x52, 0x0A, 0x8D, 0x08, 0xBF, 0x05, 0x78, 0x01, 0x71, 0xFD, 0x3F, 0xFA, 0x47, 0xF8, 0xC1, 0xF6, 
-    0xD6, 0xF4, 0x60, 0xF2, 0x4B, 0xF1, 0xFC, 0xF1, 0x54, 0xF5, 0xDA, 0xF9, 0x9F, 0xFE, 0xBF, 0x02, 
-    0x5B, 0x05, 0xC8, 0x06, 0x13, 0x07, 0x95, 0x06, 0x4A, 0x06, 0x4A, 0x06, 0x8D, 0x05, 0x4E, 0x05, 
-    0x67, 0x05, 0x42, 0x05, 0xAA, 0x04, 0x18, 0x03, 0x18, 0x00, 0x5C, 0xFC, 0xA7, 0xF9, 0xEB, 0xF8, 
-    0xCD, 0xF9, 0x86, 0xFB, 0x64, 0xFD, 0xFB, 0xFD, 0x58, 0xFD, 0x9B, 0xFC, 0x9F, 0xFB, 0x54, 0xFB, 
-    0xF7, 0xFB, 0xDA, 0xFC, 0x58, 0xFD, 0x7D, 0xFD, 0xE2, 0xFD, 0x29, 0xFF, 0xE1, 0x00, 0x67, 0x02, 
-    0xCC, 0x02, 0x67, 0x02, 0x2D, 0x01, 0xE6, 0xFF, 0xB8, 0xFE, 0xB0, 0xFD, 0x3F, 0xFD, 0x4B, 0xFD, 
-    0x00, 0xFD, 0x36, 0xFC, 0xB0, 0xFA, 0x69, 0xF9, 0xDE, 0xF8, 0x47, 0xF8, 0x54, 0xF8, 0x79, 0xF8, 
-    0x9F, 0xF8, 0x2A, 0xF9, 0xCD, 0xF9, 0x7E, 0xFA, 0xAC, 0xFB, 0x3F, 0xFD, 0xAC, 0xFE, 0x43, 0xFF, 
-    0x4F, 0xFF, 0x36, 0xFF, 0x68, 0xFF, 0xDA, 0xFF, 0xBB, 0x00, 0x2D, 0x01, 0xEE, 0x00, 0x3D, 0x00, 
-    0x36, 0xFF, 0x53, 0xFE, 0x08, 0xFE, 0x15, 0xFE, 0x3A, 0xFE, 0xC9, 0xFD, 0xA7, 0xFC, 0x3A, 0xFB, 
-    0x9B, 0xF9, 0x3A, 0xF8, 0xD6, 0xF7, 0xC9, 0xF7, 0xEF, 0xF7, 0x60, 0xF8, 0x10, 0xF9, 0xE6, 0xF9, 
-    0x6D, 0xFB, 0x68, 0xFC, 0x7D, 0xFD, 0x7D, 0xFD, 0x3F, 0xFD, 0x10, 0xFC, 0xA3, 0xFA, 0xC1, 0xF9, 
-    0x2E, 0xFB, 0x32, 0xFD, 0xF7, 0xFE, 0x24, 0x00, 0x10, 0xFF, 0x7D, 0xFD, 0x00, 0xFD, 0xB4, 0xFC, 
-    0x3F, 0xFD, 0x8A, 0xFD, 0x68, 0xFC, 0x08, 0xFB, 0x9F, 0xF8, 0x00, 0xF7, 0xA7, 0xF9, 0xAA, 0x04, 
-    0xC7, 0x1B, 0x5E, 0x31, 0xD3, 0x39, 0x62, 0x36, 0x91, 0x28, 0x20, 0x19, 0x0F, 0x0E, 0x80, 0x08, 
-    0x5B, 0x0B, 0x80, 0x11, 0xE1, 0x12, 0x5F, 0x0D, 0xDA, 0xFF, 0x86, 0xF5, 0xB0, 0xF1, 0x0C, 0xF1, 
-    0x71, 0xF1, 0x3B, 0xF2, 0x54, 0xF2, 0xA3, 0xF4, 0x2E, 0xF8, 0x68, 0xFC, 0x67, 0x02, 0xE5, 0x08, 
-    0x0B, 0x0C, 0xAA, 0x0A, 0xE5, 0x05, 0x7C, 0x03, 0xF6, 0x04, 0x35, 0x08, 0xB3, 0x0B, 0xD9, 0x0B, 
-    0xF2, 0x08, 0x1C, 0x05, 0x29, 0xFF, 0xF3, 0xF9, 0xCD, 0xF6, 0xDE, 0xF5, 0xEF, 0xF4, 0x2A, 0xF3, 
-    0xB4, 0xF0, 0xB8, 0xEF, 0xDA, 0xF0, 0xC9, 0xF4, 0x0C, 0xFA, 0x5C, 0xFF, 0xC8, 0x03, 0x07, 0x07, 
-    0x39, 0x07, 0xE1, 0x06, 0xA2, 0x06, 0x4E, 0x08, 0x85, 0x0A, 0x67, 0x0B, 0x1C, 0x0B, 0x4E, 0x08, 
-    0xB3, 0x05, 0xAA, 0x04, 0x3D, 0x03, 0x5B, 0x02, 0xEE, 0x00, 0x6D, 0xFE, 0x1D, 0xFC, 0x9B, 0xF9, 
-    0xD1, 0xF8, 0xB4, 0xF9, 0xD1, 0xFB, 0xA3, 0xFD, 0x4B, 0xFD, 0xD1, 0xFB, 0xE6, 0xF9, 0x10, 0xF9, 
-    0xDA, 0xF9, 0x10, 0xFC, 0x29, 0xFF, 0x6C, 0x01, 0x18, 0x03, 0xD9, 0x02, 0x6C, 0x01, 0x31, 0x00, 
-    0x36, 0xFF, 0x04, 0xFF, 0x04, 0xFF, 0x6D, 0xFE, 0x7D, 0xFD, 0xE6, 0xFC, 0xCD, 0xFC, 0x36, 0xFC, 
-    0x08, 0xFB, 0x04, 0xF9, 0xDA, 0xF6, 0xB8, 0xF5, 0x9F, 0xF5, 0xDA, 0xF6, 0xC5, 0xF8, 0xA3, 0xFA, 
-    0x43, 0xFC, 0xDA, 0xFC, 0xC1, 0xFC, 0xB4, 0xFC, 0x19, 0xFD, 0x08, 0xFE, 0x82, 0xFF, 0x89, 0x00, 
-    0x52, 0x01, 0xD0, 0x01, 0xC4, 0x01, 0x46, 0x01, 0xE1, 0x00, 0x57, 0x00, 0x24, 0x00, 0xB4, 0xFF, 
-    0xF7, 0xFE, 0x21, 0xFE, 0x4B, 0xFD, 0xB4, 0xFC, 0x1D, 0xFC, 0x47, 0xFB, 0x3F, 0xFA, 0x82, 0xF9, 
-    0xAC, 0xF8, 0x60, 0xF8, 0xAC, 0xF8, 0x1D, 0xF9, 0x25, 0xFA, 0xC9, 0xFA, 0x25, 0xFA, 0xA7, 0xF9, 
-    0x36, 0xF9, 0x75, 0xF9, 0xFB, 0xFA, 0xF7, 0xFB, 0x32, 0xFD, 0x6D, 0xFE, 0xEB, 0xFE, 0x21, 0xFE, 
-    0x43, 0xFC, 0x47, 0xFB, 0xB0, 0xFA, 0x19, 0xFA, 0xDA, 0xF9, 0x0C, 0xFA, 0x92, 0xFB, 0x64, 0xFD, 
-    0x9F, 0xFE, 0x2E, 0xFE, 0x92, 0xFB, 0xC1, 0xF9, 0xA3, 0xF7, 0xEB, 0xF5, 0x0C, 0xF7, 0xE6, 0xFF, 
-    0x7C, 0x18, 0x90, 0x34, 0xAE, 0x42, 0x49, 0x42, 0x23, 0x33, 0xA6, 0x20, 0xBF, 0x11, 0x1C, 0x08, 
-    0xF2, 0x08, 0x6B, 0x10, 0x8D, 0x14, 0x35, 0x11, 0x67, 0x02, 0xC9, 0xF4, 0xFC, 0xEE, 0x11, 0xED, 
-    0x2E, 0xEC, 0x8A, 0xEB, 0x8F, 0xEA, 0x6D, 0xEC, 0xB4, 0xF0, 0xEB, 0xF5, 0x53, 0xFE, 0x03, 0x08, 
-    0x1C, 0x0E, 0xD8, 0x0E, 0xEE, 0x09, 0x4A, 0x06, 0x2D, 0x07, 0x20, 0x0A, 0xE9, 0x0D, 0x17, 0x0F, 
-    0x3D, 0x0C, 0x8D, 0x08, 0xCC, 0x02, 0xE6, 0xFC, 0xCD, 0xF9, 0xAC, 0xF8, 0xDA, 0xF6, 0x8E, 0xF3, 
-    0x97, 0xEE, 0x97, 0xEB, 0x47, 0xEC, 0x69, 0xF0, 0x7E, 0xF7, 0xC5, 0xFE, 0x03, 0x05, 0x24, 0x09, 
-    0x31, 0x09, 0xD0, 0x07, 0x6B, 0x07, 0x35, 0x08, 0xFA, 0x09, 0xF6, 0x0A, 0x46, 0x0A, 0x31, 0x09, 
-    0x28, 0x08, 0x6B, 0x07, 0x9E, 0x07, 0xD4, 0x06, 0xAA, 0x04, 0x3D, 0x00, 0xC1, 0xF9, 0xF7, 0xF5, 
-    0x8E, 0xF6, 0x5C, 0xF9, 0xA7, 0xFC, 0xEF, 0xFD, 0x68, 0xFC, 0x1D, 0xF9, 0xD2, 0xF5, 0x47, 0xF5, 
-    0xB4, 0xF6, 0xC9, 0xFA, 0x6D, 0xFE, 0x9B, 0xFF, 0x36, 0xFF, 0x43, 0xFF, 0x3D, 0x00, 0xDD, 0x01, 
-    0xE5, 0x02, 0x0B, 0x03, 0x03, 0x02, 0x0B, 0x00, 0x08, 0xFE, 0xF3, 0xFC, 0x25, 0xFD, 0xD6, 0xFD, 
-    0xEF, 0xFD, 0x2A, 0xFC, 0x5C, 0xF9, 0x19, 0xF7, 0x82, 0xF6, 0x0C, 0xF7, 0x47, 0xF8, 0xF3, 0xF9, 
-    0x15, 0xFB, 0xB8, 0xFB, 0xC5, 0xFB, 0x36, 0xFC, 0x4B, 0xFD, 0xAC, 0xFE, 0xDA, 0xFF, 0x4A, 0x00, 
-    0x24, 0x00, 0x7C, 0x00, 0x5F, 0x01, 0x0F, 0x02, 0x67, 0x02, 0x74, 0x02, 0xC4, 0x01, 0x3D, 0x00, 
-    0x47, 0xFE, 0x82, 0xFC, 0x79, 0xFB, 0x3A, 0xFB, 0x6D, 0xFB, 0x3A, 0xFB, 0xC9, 0xFA, 0x71, 0xFA, 
-    0xC1, 0xF9, 0x8E, 0xF9, 0x25, 0xFA, 0x08, 0xFB, 0xF7, 0xFB, 0x4F, 0xFC, 0x54, 0xFB, 0xEF, 0xFA, 
-    0xD6, 0xFA, 0x64, 0xFA, 0x4B, 0xFA, 0xE2, 0xFA, 0x10, 0xFC, 0x71, 0xFD, 0x86, 0xFE, 0x60, 0xFE, 
-    0x8A, 0xFD, 0xEB, 0xFB, 0x75, 0xF9, 0x21, 0xF8, 0xE2, 0xF7, 0xB4, 0xF9, 0x4F, 0xFC, 0xB8, 0xFE, 
-    0xAC, 0xFE, 0x21, 0xFE, 0xDE, 0xFB, 0x5C, 0xF9, 0x71, 0xF7, 0x8E, 0xF6, 0xD6, 0xF7, 0xC1, 0xF9, 
-    0x6D, 0xFE, 0x5B, 0x11, 0x2C, 0x2E, 0x9D, 0x40, 0xBA, 0x45, 0x30, 0x39, 0x91, 0x25, 0x4E, 0x14, 
-    0xB3, 0x08, 0x57, 0x06, 0xE1, 0x0C, 0xED, 0x12, 0x02, 0x14, 0x85, 0x07, 0xB4, 0xF6, 0x50, 0xED, 
-    0x3B, 0xE9, 0xA4, 0xE8, 0x04, 0xEA, 0xB4, 0xEA, 0x7A, 0xEC, 0x26, 0xF1, 0xDE, 0xF5, 0xA7, 0xFC, 
-    0x5B, 0x05, 0x31, 0x0C, 0xBF, 0x0E, 0x9E, 0x0A, 0x18, 0x06, 0xD9, 0x05, 0x5B, 0x08, 0x52, 0x0D, 
-    0x1C, 0x11, 0x31, 0x0F, 0x9A, 0x0B, 0xE5, 0x05, 0xDE, 0xFE, 0xC1, 0xF9, 0x32, 0xF7, 0x9F, 0xF5, 
-    0x5C, 0xF3, 0x7A, 0xEF, 0xD2, 0xEC, 0xD2, 0xEC, 0xD2, 0xEF, 0x43, 0xF6, 0xF3, 0xFC, 0x42, 0x02, 
-    0x4A, 0x06, 0xBB, 0x06, 0x80, 0x05, 0x74, 0x05, 0xE1, 0x06, 0xA2, 0x09, 0xBF, 0x0B, 0x17, 0x0C, 
-    0x80, 0x0B, 0x78, 0x0A, 0x70, 0x09, 0x1C, 0x08, 0x42, 0x05, 0xAB, 0x01, 0x97, 0xFD, 0x0C, 0xFA, 
-    0x47, 0xF8, 0x8E, 0xF9, 0x97, 0xFA, 0xEB, 0xFB, 0xA7, 0xFC, 0xEF, 0xFA, 0xF7, 0xF8, 0x71, 0xF7, 
-    0xCD, 0xF6, 0x86, 0xF8, 0x54, 0xFB, 0x58, 0xFD, 0x1D, 0xFF, 0x9B, 0xFF, 0x89, 0x00, 0x39, 0x01, 
-    0x39, 0x01, 0x20, 0x01, 0xC8, 0x00, 0xC1, 0xFF, 0xDE, 0xFE, 0xB0, 0xFD, 0x19, 0xFD, 0x53, 0xFE, 
-    0x36, 0xFF, 0x5C, 0xFF, 0x53, 0xFE, 0x5C, 0xFC, 0x4B, 0xFA, 0xD1, 0xF8, 0x08, 0xF8, 0x3A, 0xF8, 
-    0x93, 0xF8, 0x82, 0xF9, 0x25, 0xFA, 0x32, 0xFA, 0xB0, 0xFA, 0xB8, 0xFB, 0xC1, 0xFC, 0xA3, 0xFD, 
-    0x47, 0xFE, 0xEB, 0xFE, 0x3D, 0x00, 0x91, 0x01, 0xCC, 0x02, 0xA2, 0x03, 0xC8, 0x03, 0x70, 0x03, 
-    0x5B, 0x02, 0x57, 0x00, 0x21, 0xFE, 0x8E, 0xFC, 0x79, 0xFB, 0xB0, 0xFA, 0xF3, 0xF9, 0x0C, 0xFA, 
-    0x71, 0xFA, 0x08, 0xFB, 0xB8, 0xFB, 0x04, 0xFC, 0x36, 0xFC, 0x9B, 0xFC, 0x68, 0xFC, 0x1D, 0xFC, 
-    0xEB, 0xFB, 0xFB, 0xFA, 0xEF, 0xFA, 0x58, 0xFA, 0x0C, 0xFA, 0xB0, 0xFA, 0x8A, 0xFA, 0x7E, 0xFA, 
-    0x32, 0xFA, 0x69, 0xF9, 0x54, 0xF8, 0x97, 0xF7, 0x3F, 0xF7, 0x08, 0xF8, 0x2A, 0xF9, 0x47, 0xFB, 
-    0x19, 0xFD, 0xC5, 0xFE, 0x68, 0xFF, 0xD6, 0xFD, 0xFB, 0xFA, 0x3A, 0xF8, 0x08, 0xF8, 0x1D, 0xF9, 
-    0xEF, 0xFA, 0x8E, 0xFF, 0xC8, 0x12, 0x4D, 0x2F, 0x49, 0x42, 0xE0, 0x45, 0x06, 0x3A, 0xB2, 0x26, 
-    0x6F, 0x15, 0xB3, 0x08, 0x1C, 0x05, 0x9A, 0x0B, 0x89, 0x12, 0x1C, 0x14, 0x67, 0x08, 0xC9, 0xF7, 
-    0xD6, 0xEE, 0xF3, 0xEA, 0x6D, 0xE9, 0x86, 0xE9, 0x11, 0xEA, 0x2E, 0xEC, 0x0C, 0xF1, 0xC5, 0xF5, 
-    0xE6, 0xFC, 0x4A, 0x06, 0x78, 0x0D, 0x4A, 0x0F, 0x78, 0x0A, 0xF6, 0x04, 0x03, 0x05, 0x41, 0x08, 
-    0x13, 0x0D, 0x28, 0x11, 0x2C, 0x10, 0x07, 0x0D, 0x46, 0x07, 0x43, 0xFF, 0xB4, 0xF9, 0x71, 0xF7, 
-    0x69, 0xF6, 0x3F, 0xF4, 0x36, 0xF0, 0x04, 0xED, 0x1D, 0xED, 0xC5, 0xEF, 0x60, 0xF5, 0x60, 0xFB, 
-    0x89, 0x00, 0x6C, 0x04, 0x5B, 0x05, 0xFA, 0x03, 0x91, 0x04, 0x07, 0x07, 0xF6, 0x0A, 0xDD, 0x0D, 
-    0x0F, 0x0E, 0xE1, 0x0C, 0x4E, 0x0B, 0x7C, 0x09, 0xB7, 0x07, 0x9E, 0x04, 0x2D, 0x01, 0x64, 0xFD, 
-    0xB8, 0xF8, 0x9F, 0xF5, 0x60, 0xF5, 0x32, 0xF7, 0x21, 0xFB, 0x47, 0xFE, 0x29, 0xFF, 0xA7, 0xFC, 
-    0xDE, 0xF8, 0xD2, 0xF5, 0x54, 0xF5, 0x60, 0xF8, 0x32, 0xFD, 0xAF, 0x00, 0x67, 0x02, 0x8D, 0x02, 
-    0xEE, 0x00, 0x4F, 0xFF, 0x53, 0xFE, 0xC5, 0xFE, 0x4F, 0xFF, 0x75, 0xFF, 0x29, 0xFF, 0xEB, 0xFE, 
-    0xA7, 0xFF, 0x5F, 0x01, 0x0F, 0x02, 0xE1, 0x00, 0xAC, 0xFE, 0x79, 0xFB, 0xAC, 0xF8, 0x4B, 0xF7, 
-    0x32, 0xF7, 0x3A, 0xF8, 0xCD, 0xF9, 0x71, 0xFA, 0x25, 0xFA, 0xDA, 0xF9, 0x32, 0xFA, 0x79, 0xFB, 
-    0x0C, 0xFD, 0x47, 0xFE, 0x04, 0xFF, 0x24, 0x00, 0x39, 0x01, 0x81, 0x02, 0x7C, 0x03, 0x2D, 0x04, 
-    0x52, 0x04, 0x31, 0x03, 0x96, 0x00, 0xC9, 0xFD, 0xD6, 0xFA, 0x04, 0xF9, 0x9F, 0xF8, 0x04, 0xF9, 
-    0x32, 0xFA, 0xB8, 0xFB, 0x4F, 0xFC, 0x10, 0xFC, 0xD6, 0xFA, 0xC1, 0xF9, 0xC1, 0xF9, 0x19, 0xFA, 
-    0xB0, 0xFA, 0xEB, 0xFB, 0x10, 0xFC, 0x36, 0xFC, 0x68, 0xFC, 0x79, 0xFB, 0x60, 0xFB, 0x54, 0xFB, 
-    0x32, 0xFA, 0x82, 0xF9, 0x4F, 0xF9, 0xEF, 0xF7, 0x6D, 0xF8, 0x93, 0xF8, 0xAC, 0xF8, 0xB4, 0xF9, 
-    0x4B, 0xFA, 0x2E, 0xFB, 0xA7, 0xFC, 0xE6, 0xFC, 0x4F, 0xFC, 0x79, 0xFB, 0x8E, 0xF9, 0x7E, 0xFA, 
-    0x86, 0xFB, 0x8E, 0xFC, 0xA2, 0x00, 0x52, 0x10, 0x9D, 0x2B, 0x5E, 0x40, 0xC7, 0x45, 0x0E, 0x3B, 
-    0x1F, 0x28, 0x56, 0x15, 0xFE, 0x08, 0x4E, 0x05, 0x95, 0x0C, 0xB3, 0x14, 0x78, 0x16, 0x35, 0x0B, 
-    0xC5, 0xF8, 0x75, 0xED, 0xBD, 0xE8, 0x00, 0xE8, 0xE3, 0xE8, 0xF3, 0xEA, 0xEB, 0xEC, 0x3F, 0xF1, 
-    0x6D, 0xF5, 0xD1, 0xFB, 0x78, 0x04, 0xBF, 0x0B, 0x78, 0x0D, 0x3D, 0x09, 0xA2, 0x03, 0xBB, 0x03, 
-    0x0F, 0x08, 0xC3, 0x0D, 0xED, 0x12, 0x7C, 0x12, 0x5B, 0x0E, 0x03, 0x08, 0x4F, 0xFF, 0x43, 0xF9, 
-    0xA8, 0xF6, 0x36, 0xF6, 0x7E, 0xF4, 0x26, 0xF1, 0xA8, 0xED, 0xEB, 0xEC, 0xC9, 0xEE, 0xB4, 0xF3, 
-    0x4F, 0xF9, 0x47, 0xFE, 0x67, 0x02, 0x2D, 0x04, 0x89, 0x03, 0xAA, 0x04, 0xDD, 0x07, 0xE5, 0x0B, 
-    0x63, 0x0F, 0x63, 0x0F, 0xD0, 0x0D, 0xA6, 0x0B, 0x24, 0x09, 0x5F, 0x07, 0xC4, 0x04, 0xAB, 0x01, 
-    0x79, 0xFE, 0xCD, 0xF9, 0x43, 0xF6, 0x04, 0xF6, 0x19, 0xF7, 0xC1, 0xF9, 0x4B, 0xFD, 0xD1, 0xFE, 
-    0xB4, 0xFC, 0x3F, 0xFA, 0x64, 0xF7, 0x82, 0xF6, 0xB8, 0xF8, 0x4F, 0xFC, 0x0B, 0x00, 0x28, 0x02, 
-    0xBF, 0x02, 0x9A, 0x02, 0xC8, 0x00, 0x43, 0xFF, 0x82, 0xFF, 0x36, 0xFF, 0x8E, 0xFF, 0xCD, 0xFF, 
-    0xA7, 0xFF, 0x63, 0x00, 0x6C, 0x01, 0x9E, 0x01, 0xAF, 0x00, 0xFB, 0xFD, 0xBC, 0xFA, 0x15, 0xF8, 
-    0x43, 0xF6, 0x36, 0xF6, 0xC9, 0xF7, 0x75, 0xF9, 0x08, 0xFB, 0xEF, 0xFA, 0x9B, 0xF9, 0x5C, 0xF9, 
-    0x75, 0xF9, 0x64, 0xFA, 0x43, 0xFC, 0xC9, 0xFD, 0x9B, 0xFF, 0xB7, 0x01, 0xB3, 0x02, 0x70, 0x03, 
-    0x4A, 0x03, 0xF2, 0x02, 0x1C, 0x02, 0x4A, 0x00, 0x08, 0xFE, 0xF7, 0xFB, 0x97, 0xFA, 0x19, 0xFA, 
-    0xF3, 0xF9, 0x97, 0xFA, 0x60, 0xFB, 0x86, 0xFB, 0x3A, 0xFB, 0x3F, 0xFA, 0xC1, 0xF9, 0x19, 0xFA, 
-    0xB0, 0xFA, 0xAC, 0xFB, 0x68, 0xFC, 0x43, 0xFC, 0x2A, 0xFC, 0x9F, 0xFB, 0x60, 0xFB, 0xB8, 0xFB, 
-    0x6D, 0xFB, 0x32, 0xFA, 0x36, 0xF9, 0x08, 0xF8, 0xA3, 0xF7, 0xEF, 0xF7, 0xC9, 0xF7, 0xE2, 0xF7, 
-    0x3A, 0xF8, 0x4F, 0xF9, 0xDE, 0xFB, 0x9F, 0xFE, 0x6C, 0x01, 0xBB, 0x00, 0x0C, 0xFD, 0x9F, 0xF8, 
-    0xF7, 0xF5, 0x8E, 0xF6, 0x08, 0xFB, 0xC8, 0x06, 0xFE, 0x20, 0xDC, 0x3A, 0x6F, 0x45, 0x55, 0x3F, 
-    0x0A, 0x2D, 0x67, 0x1A, 0x02, 0x0E, 0x03, 0x08, 0xE5, 0x0B, 0x89, 0x15, 0x45, 0x19, 0xAA, 0x13, 
-    0x03, 0x02, 0x7E, 0xF1, 0x19, 0xEB, 0xFC, 0xE8, 0x5C, 0xE7, 0xC9, 0xE8, 0x43, 0xEA, 0x7E, 0xEE, 
-    0x64, 0xF4, 0x43, 0xF9, 0x70, 0x00, 0x8D, 0x08, 0x9A, 0x0B, 0xA2, 0x09, 0x7C, 0x03, 0x07, 0x01, 
-    0xBF, 0x05, 0x24, 0x0C, 0xD8, 0x11, 0x80, 0x14, 0x1C, 0x11, 0x0B, 0x0C, 0x9E, 0x04, 0x5C, 0xFC, 
-    0x79, 0xF8, 0x25, 0xF7, 0xEB, 0xF5, 0x9B, 0xF3, 0xB8, 0xEF, 0x19, 0xEE, 0x54, 0xEF, 0x2E, 0xF2, 
-    0x64, 0xF7, 0x1D, 0xFC, 0x9B, 0xFF, 0x67, 0x02, 0x35, 0x02, 0xDD, 0x01, 0x85, 0x04, 0x4E, 0x08, 
-    0x7C, 0x0C, 0x17, 0x0F, 0x74, 0x0E, 0x52, 0x0D, 0x5B, 0x0B, 0x56, 0x09, 0x6B, 0x07, 0x46, 0x04, 
-    0xD5, 0x00, 0x7D, 0xFD, 0x10, 0xF9, 0x32, 0xF7, 0xD6, 0xF7, 0xA7, 0xF9, 0x9B, 0xFC, 0x0C, 0xFD, 
-    0xEF, 0xFA, 0x60, 0xF8, 0xA8, 0xF6, 0x7E, 0xF7, 0x7E, 0xFA, 0xC9, 0xFD, 0xC8, 0x00, 0x85, 0x01, 
-    0x3D, 0x00, 0xDA, 0xFF, 0x68, 0xFF, 0xCD, 0xFF, 0xEE, 0x00, 0x07, 0x01, 0x0B, 0x00, 0x10, 0xFF, 
-    0x2E, 0xFE, 0xF7, 0xFE, 0xA2, 0x00, 0x0F, 0x02, 0x28, 0x02, 0xC1, 0xFF, 0x10, 0xFC, 0xF7, 0xF8, 
-    0xCD, 0xF6, 0xC1, 0xF6, 0x15, 0xF8, 0x43, 0xF9, 0x0C, 0xFA, 0x19, 0xFA, 0x2A, 0xF9, 0xD1, 0xF8, 
-    0x69, 0xF9, 0xEF, 0xFA, 0x5C, 0xFC, 0x7D, 0xFD, 0x3A, 0xFE, 0x9B, 0xFF, 0x78, 0x01, 0xCC, 0x02, 
-    0x96, 0x03, 0x4A, 0x03, 0x5B, 0x02, 0xBB, 0x00, 0x86, 0xFE, 0x8E, 0xFC, 0x86, 0xFB, 0xC9, 0xFA, 
-    0xB0, 0xFA, 0x58, 0xFA, 0x00, 0xFA, 0x9B, 0xF9, 0x5C, 0xF9, 0xF7, 0xF8, 0x2A, 0xF9, 0x0C, 0xFA, 
-    0x97, 0xFA, 0x21, 0xFB, 0x47, 0xFB, 0x3A, 0xFB, 0xD1, 0xFB, 0x5C, 0xFC, 0xC5, 0xFB, 0x92, 0xFB, 
-    0xEB, 0xFB, 0x04, 0xFC, 0x36, 0xFC, 0x47, 0xFB, 0xB4, 0xF9, 0xAC, 0xF8, 0xE2, 0xF7, 0xCD, 0xF6, 
-    0xFB, 0xF7, 0xC1, 0xF9, 0xDA, 0xFC, 0x75, 0xFF, 0xAC, 0xFE, 0xAC, 0xFB, 0x3A, 0xF8, 0x54, 0xF5, 
-    0xB8, 0xF5, 0xF7, 0xF8, 0xA7, 0xFC, 0xE9, 0x07, 0xAA, 0x1F, 0xED, 0x36, 0xE8, 0x40, 0x62, 0x3C, 
-    0x73, 0x2C, 0x13, 0x1C, 0xC8, 0x0F, 0x20, 0x0A, 0x41, 0x0E, 0x30, 0x18, 0x1B, 0x1D, 0x67, 0x17, 
-    0x20, 0x04, 0x6D, 0xF2, 0x04, 0xEA, 0x3B, 0xE6, 0xC9, 0xE5, 0x65, 0xE8, 0xE2, 0xEB, 0xDA, 0xF0, 
-    0x47, 0xF5, 0xD6, 0xF7, 0x0C, 0xFD, 0x13, 0x04, 0x5B, 0x08, 0xC4, 0x07, 0xEE, 0x03, 0x24, 0x03, 
-    0x9E, 0x07, 0x5F, 0x0D, 0xAE, 0x12, 0x0B, 0x15, 0x95, 0x12, 0x85, 0x0D, 0x35, 0x05, 0xA7, 0xFC, 
-    0xFB, 0xF7, 0x8E, 0xF6, 0x93, 0xF5, 0x5C, 0xF3, 0xE7, 0xF0, 0x9F, 0xEF, 0x43, 0xF0, 0xD6, 0xF1, 
-    0x60, 0xF5, 0x8E, 0xF9, 0xC9, 0xFD, 0xAF, 0x00, 0xC8, 0x00, 0xBB, 0x00, 0x63, 0x03, 0x2D, 0x07, 
-    0x74, 0x0B, 0xF6, 0x0D, 0x5B, 0x0E, 0xF6, 0x0D, 0x3D, 0x0C, 0x20, 0x0A, 0x4E, 0x08, 0xFE, 0x05, 
-    0x4A, 0x03, 0x00, 0x00, 0x1D, 0xFC, 0x4B, 0xFA, 0xCD, 0xF9, 0x64, 0xFA, 0xD1, 0xFB, 0x86, 0xFB, 
-    0xC1, 0xF9, 0xA3, 0xF7, 0x47, 0xF5, 0x47, 0xF5, 0x75, 0xF9, 0xB0, 0xFD, 0x85, 0x01, 0xE5, 0x02, 
-    0x0F, 0x02, 0xE1, 0x00, 0x0B, 0x00, 0xF3, 0xFF, 0x2D, 0x01, 0x28, 0x02, 0x35, 0x02, 0x91, 0x01, 
-    0x5C, 0xFF, 0xDE, 0xFE, 0x18, 0x00, 0xE1, 0x00, 0xE1, 0x00, 0x04, 0xFF, 0xEB, 0xFB, 0x82, 0xF9, 
-    0xEF, 0xF7, 0xE2, 0xF7, 0x36, 0xF9, 0x97, 0xFA, 0x54, 0xFB, 0xB0, 0xFA, 0x43, 0xF9, 0x60, 0xF8, 
-    0xD1, 0xF8, 0x4B, 0xFA, 0x5C, 0xFC, 0xB0, 0xFD, 0x86, 0xFE, 0x8E, 0xFF, 0x57, 0x00, 0x2D, 0x01, 
-    0x1C, 0x02, 0x4E, 0x02, 0x1C, 0x02, 0x2D, 0x01, 0x4F, 0xFF, 0x64, 0xFD, 0xEB, 0xFB, 0xE2, 0xFA, 
-    0x71, 0xFA, 0x7E, 0xFA, 0x71, 0xFA, 0x64, 0xFA, 0x0C, 0xFA, 0xF3, 0xF9, 0x4B, 0xFA, 0xEF, 0xFA, 
-    0xF7, 0xFB, 0xC5, 0xFB, 0xB0, 0xFA, 0x25, 0xFA, 0x19, 0xFA, 0x4B, 0xFA, 0x3A, 0xFB, 0x92, 0xFB, 
-    0x68, 0xFC, 0xDA, 0xFC, 0x36, 0xFC, 0xBC, 0xFA, 0x79, 0xF8, 0xBD, 0xF7, 0x60, 0xF8, 0x9F, 0xF8, 
-    0xF7, 0xF8, 0x71, 0xFA, 0x9F, 0xFB, 0x64, 0xFD, 0x86, 0xFE, 0xE2, 0xFD, 0x6D, 0xFB, 0xB8, 0xF8, 
-    0xC1, 0xF6, 0x82, 0xF6, 0x3A, 0xF8, 0x68, 0xFC, 0x46, 0x0A, 0x63, 0x24, 0xA1, 0x39, 0xF1, 0x41, 
-    0x17, 0x39, 0xF1, 0x26, 0xD4, 0x15, 0xDD, 0x0A, 0x3D, 0x09, 0x6F, 0x12, 0x8D, 0x1D, 0xA6, 0x20, 
-    0x0F, 0x17, 0xBB, 0x00, 0x36, 0xF0, 0xE7, 0xE7, 0xA4, 0xE5, 0x69, 0xE7, 0xB0, 0xEB, 0xB0, 0xEE, 
-    0x2A, 0xF3, 0x08, 0xF5, 0xE2, 0xF7, 0xFB, 0xFD, 0x46, 0x04, 0x91, 0x07, 0xBF, 0x05, 0x5F, 0x01, 
-    0xDD, 0x01, 0xD4, 0x06, 0xC3, 0x0D, 0xB3, 0x14, 0xD0, 0x16, 0x45, 0x13, 0xED, 0x0C, 0x5B, 0x02, 
-    0xC9, 0xFA, 0x71, 0xF7, 0x8A, 0xF7, 0xBD, 0xF7, 0xF7, 0xF5, 0xAC, 0xF2, 0x32, 0xF1, 0x11, 0xF0, 
-    0x71, 0xF1, 0xFC, 0xF4, 0x9F, 0xF8, 0xB4, 0xFC, 0x9F, 0xFE, 0x08, 0xFE, 0xB8, 0xFE, 0xDD, 0x01, 
-    0x7C, 0x06, 0x41, 0x0B, 0x5F, 0x0D, 0x78, 0x0D, 0x07, 0x0D, 0x1C, 0x0B, 0x20, 0x0A, 0xD9, 0x08, 
-    0xD4, 0x06, 0xC4, 0x04, 0x20, 0x01, 0x32, 0xFD, 0x3A, 0xFB, 0xFB, 0xFA, 0x5C, 0xFC, 0x25, 0xFD, 
-    0x6D, 0xFB, 0xB8, 0xF8, 0x60, 0xF5, 0x43, 0xF3, 0xD6, 0xF4, 0x2E, 0xF8, 0x4F, 0xFC, 0x43, 0xFF, 
-    0x5C, 0xFF, 0x04, 0xFF, 0x9F, 0xFE, 0x8E, 0xFF, 0x9E, 0x01, 0xF2, 0x02, 0x0B, 0x03, 0x81, 0x02, 
-    0xAF, 0x00, 0xA7, 0xFF, 0x3D, 0x00, 0x9E, 0x01, 0xF2, 0x02, 0xCC, 0x02, 0x31, 0x00, 0xC1, 0xFC, 
-    0xC1, 0xF9, 0xEF, 0xF7, 0xEF, 0xF7, 0x93, 0xF8, 0x9B, 0xF9, 0xCD, 0xF9, 0x1D, 0xF9, 0x3A, 0xF8, 
-    0x21, 0xF8, 0xEB, 0xF8, 0x7E, 0xFA, 0x10, 0xFC, 0xA7, 0xFC, 0xA3, 0xFD, 0x9F, 0xFE, 0x3D, 0x00, 
-    0xC4, 0x01, 0xF2, 0x02, 0x63, 0x03, 0xB3, 0x02, 0x07, 0x01, 0x9F, 0xFE, 0x8E, 0xFC, 0x79, 0xFB, 
-    0x92, 0xFB, 0xD1, 0xFB, 0xEB, 0xFB, 0x6D, 0xFB, 0xE2, 0xFA, 0x00, 0xFA, 0x8E, 0xF9, 0x19, 0xFA, 
-    0x3A, 0xFB, 0xB8, 0xFB, 0x54, 0xFB, 0x64, 0xFA, 0xE6, 0xF9, 0x3F, 0xFA, 0x21, 0xFB, 0x36, 0xFC, 
-    0x2A, 0xFC, 0xDE, 0xFB, 0x21, 0xFB, 0xF3, 0xF9, 0x15, 0xF8, 0x82, 0xF6, 0xC1, 0xF6, 0xC9, 0xF7, 
-    0x69, 0xF9, 0xD6, 0xFA, 0x8E, 0xFC, 0x53, 0xFE, 0x1D, 0xFF, 0xC5, 0xFE, 0xEF, 0xFD, 0x54, 0xFB, 
-    0x4F, 0xF9, 0xEF, 0xF7, 0xFB, 0xF7, 0x2A, 0xF9, 0xAC, 0xFB, 0x18, 0x03, 0x20, 0x19, 0xDC, 0x31, 
-    0x62, 0x3F, 0x2C, 0x3D, 0x67, 0x2C, 0x74, 0x1A, 0x07, 0x0D, 0xA6, 0x08, 0xB3, 0x0E, 0x91, 0x1C, 
-    0x88, 0x24, 0x34, 0x20, 0x67, 0x0B, 0xB0, 0xF4, 0x8A, 0xE8, 0x76, 0xE4, 0x86, 0xE6, 0xFC, 0xEB, 
-    0xC1, 0xF0, 0xBD, 0xF4, 0x25, 0xF7, 0xA8, 0xF6, 0x75, 0xF9, 0x86, 0xFE, 0xF2, 0x02, 0x4A, 0x03, 
-    0x75, 0xFF, 0xAC, 0xFE, 0xAF, 0x03, 0xD9, 0x0B, 0x02, 0x14, 0x89, 0x18, 0x06, 0x16, 0x13, 0x10, 
-    0x63, 0x06, 0x8E, 0xFC, 0xB8, 0xF8, 0x75, 0xF9, 0x2A, 0xFC, 0x5C, 0xFC, 0x04, 0xF9, 0xB0, 0xF4, 
-    0xA3, 0xF1, 0xC5, 0xEF, 0x4B, 0xF1, 0x32, 0xF4, 0x79, 0xF8, 0x43, 0xFC, 0x32, 0xFD, 0x4B, 0xFD, 
-    0x8E, 0xFF, 0xC8, 0x03, 0x5B, 0x08, 0x5B, 0x0B, 0x5B, 0x0B, 0xE9, 0x0A, 0xEE, 0x09, 0x18, 0x09, 
-    0xD9, 0x08, 0x0F, 0x08, 0x85, 0x07, 0x1C, 0x05, 0x13, 0x01, 0x4B, 0xFD, 0x2E, 0xFB, 0xFB, 0xFA, 
-    0x8E, 0xFC, 0xB4, 0xFC, 0x47, 0xFB, 0xC5, 0xF8, 0x04, 0xF6, 0xE2, 0xF4, 0x75, 0xF6, 0xD1, 0xF8, 
-    0xF7, 0xFB, 0xC9, 0xFD, 0x53, 0xFE, 0x60, 0xFE, 0x6D, 0xFE, 0x04, 0xFF, 0x24, 0x00, 0xBB, 0x00, 
-    0x78, 0x01, 0xDD, 0x01, 0xE9, 0x01, 0x74, 0x02, 0x4A, 0x03, 0xC8, 0x03, 0x24, 0x03, 0x07, 0x01, 
-    0x15, 0xFE, 0x54, 0xFB, 0x82, 0xF9, 0x04, 0xF9, 0x1D, 0xF9, 0x69, 0xF9, 0x5C, 0xF9, 0x9F, 0xF8, 
-    0xB0, 0xF7, 0xDA, 0xF6, 0x19, 0xF7, 0x47, 0xF8, 0xB4, 0xF9, 0xFB, 0xFA, 0x68, 0xFC, 0xE2, 0xFD, 
-    0x75, 0xFF, 0xD5, 0x00, 0x03, 0x02, 0xB3, 0x02, 0xD9, 0x02, 0x0F, 0x02, 0x3D, 0x00, 0x2E, 0xFE, 
-    0xB4, 0xFC, 0x9B, 0xFC, 0xA7, 0xFC, 0xB4, 0xFC, 0xDA, 0xFC, 0xB4, 0xFC, 0x1D, 0xFC, 0x47, 0xFB, 
-    0x71, 0xFA, 0xB0, 0xFA, 0x2E, 0xFB, 0x6D, 0xFB, 0x2E, 0xFB, 0xA3, 0xFA, 0x8A, 0xFA, 0xA3, 0xFA, 
-    0x58, 0xFA, 0x8E, 0xF9, 0x4F, 0xF9, 0x2A, 0xF9, 0x2A, 0xF9, 0xDA, 0xF9, 0x69, 0xF9, 0x4F, 0xF9, 
-    0x82, 0xF9, 0xCD, 0xF9, 0x00, 0xFA, 0x32, 0xFA, 0xD1, 0xFB, 0x3A, 0xFE, 0xFA, 0x00, 0x2D, 0x01, 
-    0xB4, 0xFF, 0x6D, 0xFB, 0x15, 0xF8, 0xDA, 0xF6, 0xA3, 0xF7, 0x8A, 0xFA, 0x47, 0xFE, 0x2D, 0x04, 
-    0xFA, 0x15, 0x17, 0x2D, 0x38, 0x3A, 0x12, 0x3A, 0xE9, 0x2B, 0x7C, 0x1B, 0x74, 0x0E, 0x13, 0x0A, 
-    0x8D, 0x0E, 0x20, 0x1C, 0x78, 0x25, 0xB7, 0x22, 0xED, 0x0F, 0x64, 0xF7, 0x54, 0xE9, 0xD2, 0xE3, 
-    0x54, 0xE6, 0xF7, 0xEC, 0xF3, 0xF3, 0x15, 0xF8, 0x75, 0xF9, 0x9B, 0xF6, 0x3A, 0xF5, 0xBD, 0xF7, 
-    0x10, 0xFC, 0xD1, 0xFE, 0x9F, 0xFE, 0x9B, 0xFF, 0x03, 0x05, 0x4A, 0x0C, 0xAE, 0x12, 0x45, 0x16, 
-    0x41, 0x14, 0xFE, 0x0E, 0x9E, 0x07, 0x36, 0xFF, 0x4F, 0xFC, 0xB0, 0xFD, 0x2D, 0x01, 0x46, 0x01, 
-    0x58, 0xFD, 0x19, 0xF7, 0x8A, 0xF1, 0xA8, 0xED, 0x8F, 0xED, 0x0C, 0xF1, 0x9B, 0xF6, 0x75, 0xFC, 
-    0xAC, 0xFE, 0x3A, 0xFE, 0xEB, 0xFE, 0x07, 0x01, 0x46, 0x04, 0x20, 0x07, 0x80, 0x08, 0xC8, 0x09, 
-    0x6B, 0x0A, 0x5F, 0x0A, 0x85, 0x0A, 0x5F, 0x0A, 0x20, 0x0A, 0x91, 0x07, 0xCC, 0x02, 0xD6, 0xFD, 
-    0xD1, 0xFB, 0xCD, 0xFC, 0xEB, 0xFE, 0xA7, 0xFF, 0x47, 0xFE, 0x15, 0xFB, 0x25, 0xF7, 0x47, 0xF5, 
-    0xB8, 0xF5, 0xBD, 0xF7, 0x08, 0xFB, 0x04, 0xFC, 0x60, 0xFB, 0x4B, 0xFA, 0xFB, 0xFA, 0xDA, 0xFC, 
-    0xB4, 0xFF, 0x2D, 0x01, 0xBF, 0x02, 0xCC, 0x02, 0x5B, 0x02, 0xA6, 0x02, 0xFA, 0x03, 0x5B, 0x05, 
-    0xCC, 0x05, 0x70, 0x03, 0x5C, 0xFF, 0xC5, 0xFB, 0xCD, 0xF9, 0xF3, 0xF9, 0x71, 0xFA, 0x7E, 0xFA, 
-    0x9B, 0xF9, 0x4B, 0xF7, 0xC9, 0xF4, 0x8E, 0xF3, 0xBD, 0xF4, 0x19, 0xF7, 0xC1, 0xF9, 0x3A, 0xFB, 
-    0x4F, 0xFC, 0xC1, 0xFC, 0xC9, 0xFD, 0x4F, 0xFF, 0xA2, 0x00, 0xD0, 0x01, 0xF6, 0x01, 0x13, 0x01, 
-    0x43, 0xFF, 0xFB, 0xFD, 0xC9, 0xFD, 0x6D, 0xFE, 0xC5, 0xFE, 0xEB, 0xFE, 0x3A, 0xFE, 0xC1, 0xFC, 
-    0x47, 0xFB, 0xC1, 0xF9, 0x82, 0xF9, 0xB0, 0xFA, 0xC5, 0xFB, 0x68, 0xFC, 0x54, 0xFB, 0x10, 0xF9, 
-    0x3F, 0xF7, 0x43, 0xF6, 0xB4, 0xF6, 0x86, 0xF8, 0xF3, 0xF9, 0x0C, 0xFA, 0xC1, 0xF9, 0xA3, 0xF7, 
-    0x00, 0xF7, 0xF3, 0xF6, 0x3A, 0xF8, 0x7E, 0xFA, 0x82, 0xFC, 0xC5, 0xFE, 0x57, 0x00, 0x4E, 0x02, 
-    0x74, 0x02, 0x4E, 0x02, 0x82, 0xFF, 0x2A, 0xFC, 0x21, 0xFB, 0xA3, 0xFA, 0x0C, 0xFD, 0xC5, 0xFE, 
-    0xC8, 0x00, 0xD0, 0x04, 0x95, 0x15, 0xFE, 0x29, 0xA5, 0x35, 0x51, 0x34, 0x5A, 0x26, 0x3D, 0x18, 
-    0x20, 0x0D, 0xF2, 0x0B, 0x56, 0x12, 0x0F, 0x20, 0x24, 0x27, 0x56, 0x21, 0x24, 0x0C, 0xBD, 0xF4, 
-    0x71, 0xE8, 0x15, 0xE6, 0xEF, 0xEB, 0x19, 0xF4, 0x2E, 0xFB, 0x5C, 0xFC, 0xCD, 0xF9, 0xEB, 0xF2, 
-    0xAC, 0xEF, 0xB0, 0xF1, 0xF3, 0xF6, 0x21, 0xFB, 0x25, 0xFD, 0x4A, 0x00, 0x35, 0x05, 0x28, 0x0B, 
-    0xA2, 0x0F, 0x35, 0x11, 0x8D, 0x0E, 0xBB, 0x09, 0x39, 0x04, 0xF7, 0xFE, 0x68, 0xFF, 0x89, 0x03, 
-    0xC4, 0x07, 0xD4, 0x06, 0x46, 0x01, 0xDE, 0xF8, 0x26, 0xF1, 0x86, 0xEC, 0x1D, 0xED, 0x47, 0xF2, 
-    0x9B, 0xF9, 0xCD, 0xFF, 0xEE, 0x00, 0x9F, 0xFE, 0xCD, 0xFC, 0x0C, 0xFD, 0xC5, 0xFE, 0x78, 0x01, 
-    0x20, 0x04, 0xD4, 0x06, 0xD9, 0x08, 0x13, 0x0A, 0xE9, 0x0A, 0xD0, 0x0A, 0xC8, 0x09, 0x63, 0x06, 
-    0x39, 0x01, 0x19, 0xFD, 0x71, 0xFD, 0x00, 0x00, 0x0B, 0x03, 0x07, 0x04, 0x1C, 0x02, 0x32, 0xFD, 
-    0x47, 0xF8, 0x54, 0xF5, 0xC9, 0xF4, 0xA8, 0xF6, 0x5C, 0xF9, 0x71, 0xFA, 0xDA, 0xF9, 0x75, 0xF9, 
-    0x8E, 0xF9, 0xB0, 0xFA, 0x4F, 0xFC, 0x64, 0xFD, 0xAC, 0xFE, 0x8E, 0xFF, 0x85, 0x01, 0x96, 0x03, 
-    0xE5, 0x05, 0xFA, 0x06, 0x31, 0x06, 0x67, 0x02, 0x15, 0xFE, 0xEF, 0xFA, 0x32, 0xFA, 0xDE, 0xFB, 
-    0xFB, 0xFD, 0x6D, 0xFE, 0x36, 0xFC, 0x54, 0xF8, 0x19, 0xF4, 0xC9, 0xF1, 0x2E, 0xF2, 0xD6, 0xF4, 
-    0x2E, 0xF8, 0x21, 0xFB, 0xC1, 0xFC, 0x19, 0xFD, 0x19, 0xFD, 0xF3, 0xFC, 0x58, 0xFD, 0xFB, 0xFD, 
-    0x1D, 0xFF, 0xE6, 0xFF, 0x89, 0x00, 0x96, 0x00, 0xAF, 0x00, 0x96, 0x00, 0x18, 0x00, 0x4F, 0xFF, 
-    0xFB, 0xFD, 0x32, 0xFD, 0xE6, 0xFC, 0x32, 0xFD, 0xA3, 0xFD, 0x60, 0xFE, 0x08, 0xFE, 0x64, 0xFD, 
-    0xEF, 0xFA, 0x7E, 0xF7, 0xFC, 0xF4, 0x4B, 0xF4, 0x10, 0xF6, 0x60, 0xF8, 0x8E, 0xF9, 0xF3, 0xF9, 
-    0x4F, 0xF9, 0xE2, 0xF7, 0x9B, 0xF6, 0xCD, 0xF6, 0x2E, 0xF8, 0xC5, 0xFB, 0x3F, 0xFD, 0xEF, 0xFD, 
-    0x47, 0xFE, 0x43, 0xFF, 0x85, 0x01, 0xB3, 0x02, 0x9E, 0x01, 0x29, 0xFF, 0x82, 0xFC, 0x32, 0xFA, 
-    0x32, 0xFA, 0xB8, 0xFB, 0x04, 0xFF, 0xB3, 0x05, 0x24, 0x15, 0xA6, 0x29, 0xE9, 0x34, 0xBF, 0x32, 
-    0x63, 0x24, 0x89, 0x15, 0x0B, 0x0C, 0x4A, 0x0C, 0x8D, 0x14, 0xC7, 0x21, 0x1F, 0x2B, 0x1F, 0x25, 
-    0x5B, 0x11, 0xB0, 0xF7, 0x3B, 0xE9, 0xC9, 0xE5, 0xFC, 0xEB, 0xA3, 0xF4, 0xB4, 0xFC, 0x79, 0xFE, 
-    0x43, 0xFC, 0xE2, 0xF4, 0xD6, 0xEE, 0x69, 0xED, 0x3F, 0xF1, 0xB8, 0xF5, 0xA7, 0xF9, 0xB0, 0xFD, 
-    0x6C, 0x04, 0x35, 0x0B, 0x5F, 0x10, 0x9E, 0x10, 0x2C, 0x0D, 0x07, 0x07, 0x9A, 0x02, 0x36, 0xFF, 
-    0xF6, 0x01, 0x03, 0x08, 0xE9, 0x0D, 0x91, 0x0D, 0x20, 0x07, 0xCD, 0xFC, 0x4F, 0xF3, 0x75, 0xED, 
-    0x82, 0xED, 0x60, 0xF2, 0x3F, 0xFA, 0x96, 0x00, 0x4E, 0x02, 0x10, 0xFF, 0x6D, 0xFB, 0xD1, 0xF8, 
-    0x04, 0xF9, 0x08, 0xFB, 0x2E, 0xFE, 0xA6, 0x02, 0x07, 0x07, 0x52, 0x0A, 0x0B, 0x0C, 0xBF, 0x0B, 
-    0x4A, 0x09, 0xE9, 0x04, 0xDA, 0xFF, 0xB4, 0xFC, 0x6D, 0xFE, 0x7C, 0x03, 0x70, 0x09, 0xD0, 0x0A, 
-    0xAA, 0x07, 0x3D, 0x00, 0x54, 0xF8, 0xB4, 0xF3, 0x36, 0xF3, 0x10, 0xF6, 0xF3, 0xF9, 0x4F, 0xFC, 
-    0x2E, 0xFB, 0x36, 0xF9, 0xC1, 0xF6, 0xA8, 0xF6, 0x64, 0xF7, 0x2A, 0xF9, 0x6D, 0xFB, 0x6D, 0xFE, 
-    0x07, 0x01, 0x20, 0x04, 0x70, 0x06, 0x91, 0x07, 0xAF, 0x06, 0x31, 0x03, 0x29, 0xFF, 0x2A, 0xFC, 
-    0x1D, 0xFC, 0x79, 0xFE, 0x2D, 0x01, 0xE9, 0x01, 0xB4, 0xFF, 0x3A, 0xFB, 0xEB, 0xF5, 0x86, 0xF2, 
-    0xD6, 0xF1, 0x3F, 0xF4, 0xE2, 0xF7, 0x08, 0xFB, 0xF3, 0xFC, 0xF3, 0xFC, 0x36, 0xFC, 0x6D, 0xFB, 
-    0xBC, 0xFA, 0xE2, 0xFA, 0xB8, 0xFB, 0xB0, 0xFD, 0x43, 0xFF, 0x07, 0x01, 0xDD, 0x01, 0x42, 0x02, 
-    0x6C, 0x01, 0x4A, 0x00, 0x5C, 0xFF, 0xB8, 0xFE, 0xC5, 0xFE, 0x36, 0xFF, 0xE6, 0xFF, 0x0B, 0x00, 
-    0x70, 0x00, 0x29, 0xFF, 0xA7, 0xFC, 0x6D, 0xF8, 0xDE, 0xF5, 0x32, 0xF4, 0x54, 0xF5, 0x0C, 0xF7, 
-    0x86, 0xF8, 0xAC, 0xF8, 0xCD, 0xF6, 0x3A, 0xF5, 0x1D, 0xF3, 0x11, 0xF3, 0x21, 0xF5, 0xC1, 0xF9, 
-    0x71, 0xFD, 0x3D, 0x00, 0x1C, 0x02, 0xE9, 0x01, 0x52, 0x01, 0x18, 0x00, 0x9F, 0xFE, 0xBC, 0xFD, 
-    0x19, 0xFD, 0x1D, 0xFF, 0x89, 0x00, 0x24, 0x03, 0x63, 0x03, 0xE9, 0x04, 0x95, 0x0C, 0xA2, 0x1E, 
-    0x8C, 0x2C, 0xD8, 0x2F, 0x49, 0x27, 0x9D, 0x19, 0x46, 0x10, 0xA2, 0x0C, 0x6F, 0x12, 0xD0, 0x1C, 
-    0xD4, 0x27, 0x6B, 0x25, 0x45, 0x16, 0x25, 0xFD, 0x8F, 0xED, 0x86, 0xE9, 0x6D, 0xEF, 0x54, 0xF8, 
-    0xC1, 0xFF, 0x3D, 0x00, 0x10, 0xFC, 0xA8, 0xF3, 0xE2, 0xEB, 0x1D, 0xEA, 0x7E, 0xEE, 0xEF, 0xF4, 
-    0x75, 0xF9, 0x92, 0xFB, 0x82, 0xFF, 0xEE, 0x03, 0x67, 0x08, 0x20, 0x0A, 0x8D, 0x08, 0x35, 0x05, 
-    0x31, 0x03, 0x0F, 0x02, 0x13, 0x04, 0xEE, 0x09, 0xBF, 0x0E, 0x70, 0x0F, 0x63, 0x09, 0x96, 0x00, 
-    0xB0, 0xF7, 0x86, 0xF2, 0x47, 0xF2, 0xC1, 0xF6, 0xE6, 0xFC, 0xD0, 0x01, 0x67, 0x02, 0xEF, 0xFD, 
-    0x10, 0xF9, 0xD2, 0xF5, 0xC5, 0xF5, 0x54, 0xF8, 0x10, 0xFC, 0x63, 0x00, 0xFA, 0x03, 0x24, 0x06, 
-    0x13, 0x07, 0x89, 0x06, 0x5B, 0x05, 0xE5, 0x02, 0x31, 0x00, 0xAC, 0xFE, 0x46, 0x01, 0x46, 0x07, 
-    0x4A, 0x0C, 0x1C, 0x0E, 0x35, 0x0B, 0x42, 0x05, 0xFB, 0xFD, 0xB8, 0xF8, 0xC5, 0xF5, 0x7E, 0xF7, 
-    0x21, 0xFB, 0x53, 0xFE, 0x64, 0xFD, 0xE6, 0xF9, 0xFC, 0xF4, 0xC9, 0xF1, 0x69, 0xF0, 0x15, 0xF2, 
-    0x82, 0xF6, 0x82, 0xFC, 0xE9, 0x01, 0xAA, 0x04, 0xC4, 0x04, 0x0B, 0x03, 0x2D, 0x01, 0x04, 0xFF, 
-    0xA3, 0xFD, 0x3A, 0xFE, 0xBB, 0x00, 0xEE, 0x03, 0x67, 0x05, 0x20, 0x04, 0xF3, 0xFF, 0xBC, 0xFA, 
-    0x43, 0xF6, 0x9B, 0xF3, 0x71, 0xF4, 0x3F, 0xF7, 0x15, 0xFB, 0xE6, 0xFC, 0x8E, 0xFC, 0x3F, 0xFA, 
-    0x08, 0xF8, 0xC1, 0xF6, 0xE6, 0xF6, 0xD1, 0xF8, 0xC5, 0xFB, 0xC5, 0xFE, 0x96, 0x00, 0xAF, 0x00, 
-    0xE6, 0xFF, 0x6D, 0xFE, 0x8A, 0xFD, 0x4B, 0xFD, 0x60, 0xFE, 0x63, 0x00, 0xB3, 0x02, 0x39, 0x04, 
-    0x07, 0x04, 0x67, 0x02, 0x63, 0x00, 0x47, 0xFE, 0xEB, 0xFB, 0xDA, 0xF9, 0xF7, 0xF8, 0xC5, 0xF8, 
-    0x5C, 0xF9, 0x5C, 0xF9, 0xEB, 0xF8, 0x32, 0xF7, 0xD6, 0xF4, 0x6D, 0xF2, 0x19, 0xF1, 0x86, 0xF2, 
-    0x69, 0xF6, 0x3A, 0xFB, 0xFB, 0xFD, 0xC5, 0xFE, 0x08, 0xFE, 0x04, 0xFC, 0x47, 0xFB, 0xF7, 0xFB, 
-    0xEF, 0xFD, 0xC1, 0xFF, 0xE1, 0x00, 0x70, 0x00, 0x75, 0xFF, 0x29, 0xFF, 0x18, 0x00, 0xDD, 0x04, 
-    0xF2, 0x14, 0x17, 0x2A, 0x56, 0x33, 0x77, 0x2E, 0x1B, 0x1D, 0x02, 0x11, 0x67, 0x0B, 0xF2, 0x11, 
-    0xD4, 0x1B, 0x02, 0x29, 0xF1, 0x2C, 0xB7, 0x22, 0xDD, 0x0A, 0xDA, 0xF3, 0xE2, 0xEB, 0x86, 0xEF, 
-    0xB8, 0xF8, 0x68, 0xFF, 0xE9, 0x01, 0x7D, 0xFD, 0x00, 0xF7, 0x26, 0xEE, 0xEF, 0xE8, 0xB9, 0xE9, 
-    0xB0, 0xEE, 0xB4, 0xF3, 0xEB, 0xF5, 0x69, 0xF9, 0x10, 0xFF, 0x42, 0x05, 0x80, 0x08, 0x78, 0x07, 
-    0xBF, 0x02, 0xF3, 0xFF, 0x57, 0x00, 0xC8, 0x03, 0x91, 0x0A, 0x24, 0x12, 0x6F, 0x15, 0x5F, 0x10, 
-    0x70, 0x06, 0xEB, 0xFB, 0x2A, 0xF6, 0xDE, 0xF5, 0x8A, 0xFA, 0x00, 0x00, 0x13, 0x04, 0x5F, 0x04, 
-    0x43, 0xFF, 0xFB, 0xF7, 0x36, 0xF3, 0xAC, 0xF2, 0x47, 0xF5, 0x10, 0xF9, 0x43, 0xFC, 0x4F, 0xFF, 
-    0x5F, 0x01, 0xBF, 0x02, 0xCC, 0x02, 0xE9, 0x01, 0xAF, 0x00, 0x1D, 0xFF, 0x21, 0xFE, 0x39, 0x01, 
-    0x8D, 0x08, 0x3D, 0x0F, 0xE5, 0x11, 0x4E, 0x0E, 0xB7, 0x07, 0x00, 0x00, 0x36, 0xFC, 0x2E, 0xFB, 
-    0xFB, 0xFD, 0x78, 0x01, 0x31, 0x03, 0x0B, 0x00, 0xCD, 0xF9, 0x19, 0xF4, 0x5C, 0xF0, 0x04, 0xF0, 
-    0x71, 0xF1, 0x2E, 0xF5, 0x10, 0xF9, 0x32, 0xFD, 0x36, 0xFF, 0x5C, 0xFF, 0x21, 0xFE, 0x3F, 0xFD, 
-    0x36, 0xFC, 0xF7, 0xFB, 0x8A, 0xFD, 0x39, 0x01, 0x8D, 0x05, 0x9E, 0x07, 0x70, 0x06, 0xC4, 0x01, 
-    0x9B, 0xFC, 0x93, 0xF8, 0x8A, 0xF7, 0x36, 0xF9, 0xF3, 0xFC, 0xE6, 0xFF, 0x18, 0x00, 0x3F, 0xFD, 
-    0x04, 0xF9, 0xDE, 0xF5, 0x3A, 0xF5, 0x8E, 0xF6, 0x1D, 0xF9, 0xB8, 0xFB, 0xA3, 0xFD, 0xBC, 0xFD, 
-    0xA7, 0xFC, 0xA3, 0xFA, 0x82, 0xF9, 0xDA, 0xF9, 0xB8, 0xFB, 0x47, 0xFE, 0x96, 0x00, 0x8D, 0x02, 
-    0xD9, 0x02, 0x81, 0x02, 0xEE, 0x00, 0x0B, 0x00, 0x5C, 0xFF, 0x29, 0xFF, 0x92, 0xFE, 0x2E, 0xFE, 
-    0x71, 0xFD, 0x19, 0xFD, 0x68, 0xFC, 0x32, 0xFA, 0xA3, 0xF7, 0x8A, 0xF4, 0x79, 0xF2, 0x79, 0xF2, 
-    0x7E, 0xF4, 0xDA, 0xF6, 0xF7, 0xF8, 0x75, 0xF9, 0xEB, 0xF8, 0xD6, 0xF7, 0x86, 0xF8, 0x25, 0xFA, 
-    0xCD, 0xFC, 0xEF, 0xFD, 0xB0, 0xFD, 0x36, 0xFC, 0x82, 0xFC, 0x53, 0xFE, 0xDD, 0x01, 0x2D, 0x04, 
-    0x91, 0x07, 0xD0, 0x10, 0x24, 0x21, 0x77, 0x2B, 0xE9, 0x2B, 0x06, 0x22, 0x95, 0x18, 0xB7, 0x13, 
-    0xE5, 0x14, 0x0B, 0x1B, 0x30, 0x24, 0xBB, 0x2A, 0x2C, 0x25, 0x5A, 0x14, 0x9F, 0xFE, 0xA8, 0xF3, 
-    0x86, 0xF2, 0x04, 0xF9, 0x86, 0xFE, 0x9E, 0x01, 0x79, 0xFE, 0x21, 0xF8, 0xE2, 0xEE, 0x00, 0xE8, 
-    0x93, 0xE6, 0x75, 0xEA, 0xDE, 0xEF, 0xA8, 0xF3, 0xC1, 0xF6, 0xBC, 0xFA, 0x04, 0xFF, 0x20, 0x01, 
-    0xA2, 0x00, 0x21, 0xFE, 0xB0, 0xFD, 0x57, 0x00, 0x28, 0x05, 0xF2, 0x0B, 0xA6, 0x11, 0xE5, 0x14, 
-    0xE9, 0x10, 0x95, 0x09, 0xA2, 0x00, 0x7D, 0xFD, 0xA3, 0xFD, 0x67, 0x02, 0xCC, 0x05, 0xAA, 0x07, 
-    0xD9, 0x05, 0x57, 0x00, 0xDE, 0xF8, 0x82, 0xF3, 0xEB, 0xF2, 0x79, 0xF5, 0x69, 0xF9, 0x47, 0xFB, 
-    0x75, 0xFC, 0x75, 0xFC, 0x5C, 0xFC, 0x79, 0xFB, 0x54, 0xFB, 0xC5, 0xFB, 0x25, 0xFD, 0x9F, 0xFE, 
-    0x0F, 0x02, 0xDD, 0x07, 0x20, 0x0D, 0xFE, 0x0E, 0xA2, 0x0C, 0xD0, 0x07, 0x0B, 0x03, 0x2D, 0x01, 
-    0x78, 0x01, 0xDD, 0x04, 0xDD, 0x07, 0xFE, 0x08, 0xAA, 0x04, 0x25, 0xFD, 0x36, 0xF6, 0xEF, 0xF1, 
-    0xC9, 0xF1, 0xCD, 0xF3, 0xB0, 0xF7, 0x4B, 0xFA, 0x75, 0xFC, 0x47, 0xFB, 0xEB, 0xF8, 0x36, 0xF6, 
-    0x5C, 0xF6, 0x97, 0xF7, 0x4B, 0xFA, 0xB0, 0xFD, 0x2D, 0x01, 0xE1, 0x03, 0xD4, 0x03, 0x9E, 0x01, 
-    0xB0, 0xFD, 0x79, 0xFB, 0xEF, 0xFA, 0xCD, 0xFC, 0x9B, 0xFF, 0x81, 0x02, 0xAF, 0x03, 0xF6, 0x01, 
-    0x15, 0xFE, 0x9B, 0xF9, 0xFB, 0xF7, 0x79, 0xF8, 0x54, 0xFB, 0xF3, 0xFC, 0x53, 0xFE, 0xA3, 0xFD, 
-    0x43, 0xFC, 0x9B, 0xF9, 0x3F, 0xF7, 0x10, 0xF6, 0xDA, 0xF6, 0x10, 0xF9, 0xB8, 0xFB, 0xEF, 0xFD, 
-    0x8E, 0xFF, 0xA7, 0xFF, 0x04, 0xFF, 0x3F, 0xFD, 0xC1, 0xFC, 0xB0, 0xFD, 0x70, 0x00, 0xBF, 0x02, 
-    0xFA, 0x03, 0x74, 0x02, 0x36, 0xFF, 0x9B, 0xFC, 0x3F, 0xFA, 0x82, 0xF9, 0x2A, 0xF9, 0x5C, 0xF9, 
-    0x1D, 0xF9, 0x9F, 0xF8, 0x3F, 0xF7, 0x3F, 0xF7, 0x7E, 0xF7, 0xEB, 0xF8, 0xC5, 0xF8, 0xDE, 0xF8, 
-    0xE2, 0xF7, 0x69, 0xF9, 0x08, 0xFB, 0x8E, 0xFC, 0xF3, 0xFC, 0xDA, 0xFC, 0xB4, 0xFC, 0xEF, 0xFD, 
-    0x10, 0xFF, 0x63, 0x00, 0x57, 0x03, 0xAF, 0x0C, 0xFA, 0x1E, 0x6F, 0x2A, 0xFE, 0x2C, 0xA2, 0x21, 
-    0x5A, 0x17, 0xAA, 0x10, 0xC3, 0x13, 0xA2, 0x1B, 0x49, 0x27, 0x28, 0x2F, 0x7C, 0x2A, 0x39, 0x19, 
-    0xB3, 0x02, 0x3F, 0xF7, 0xEB, 0xF5, 0xC9, 0xFD, 0x18, 0x03, 0xF2, 0x05, 0xA2, 0x00, 0xEB, 0xF8, 
-    0xE2, 0xEE, 0x5C, 0xE7, 0x65, 0xE5, 0xF3, 0xE7, 0xAC, 0xEC, 0x93, 0xEF, 0x21, 0xF2, 0x47, 0xF5, 
-    0xEB, 0xF8, 0x08, 0xFB, 0x7E, 0xFA, 0x08, 0xF8, 0x21, 0xF8, 0xB8, 0xFB, 0xA6, 0x02, 0xAA, 0x0A, 
-    0xD8, 0x11, 0x74, 0x14, 0xF6, 0x10, 0xC8, 0x09, 0x0B, 0x03, 0x13, 0x01, 0xAF, 0x03, 0x9A, 0x08, 
-    0x17, 0x0C, 0x7C, 0x0C, 0x70, 0x09, 0xD9, 0x02, 0xF7, 0xFB, 0xF3, 0xF6, 0x2A, 0xF6, 0xD6, 0xF7, 
-    0x4B, 0xFA, 0x08, 0xFB, 0xB0, 0xFA, 0xCD, 0xF9, 0x6D, 0xF8, 0xF3, 0xF6, 0xAC, 0xF5, 0x36, 0xF6, 
-    0x32, 0xF7, 0xE6, 0xF9, 0x3A, 0xFE, 0x39, 0x04, 0x74, 0x08, 0x70, 0x09, 0xEE, 0x06, 0xA2, 0x03, 
-    0x9E, 0x01, 0x57, 0x03, 0x95, 0x06, 0x39, 0x0A, 0xBF, 0x0B, 0x89, 0x09, 0x39, 0x04, 0xBC, 0xFD, 
-    0x58, 0xFA, 0x10, 0xF9, 0x71, 0xFA, 0xEF, 0xFA, 0xE2, 0xFA, 0x75, 0xF9, 0xDE, 0xF8, 0x8A, 0xF7, 
-    0x82, 0xF6, 0xB8, 0xF5, 0x1D, 0xF6, 0x25, 0xF7, 0xFB, 0xF7, 0xDA, 0xF9, 0x9F, 0xFB, 0xC9, 0xFD, 
-    0xFB, 0xFD, 0x00, 0xFD, 0xEF, 0xFA, 0x58, 0xFA, 0x86, 0xFB, 0x47, 0xFE, 0x13, 0x01, 0x3D, 0x03, 
-    0x7C, 0x03, 0xB7, 0x01, 0x36, 0xFF, 0x3F, 0xFD, 0xD6, 0xFD, 0xA7, 0xFF, 0x28, 0x02, 0x74, 0x02, 
-    0x5F, 0x01, 0xC5, 0xFE, 0x36, 0xFC, 0xCD, 0xF9, 0x47, 0xF8, 0xBD, 0xF7, 0xAC, 0xF8, 0x0C, 0xFA, 
-    0xFB, 0xFA, 0x9F, 0xFB, 0xAC, 0xFB, 0x9F, 0xFB, 0xD6, 0xFA, 0x64, 0xFA, 0xBC, 0xFA, 0xC1, 0xFC, 
-    0x8E, 0xFF, 0x0F, 0x02, 0xDD, 0x01, 0x31, 0x00, 0x32, 0xFD, 0xC5, 0xFB, 0x92, 0xFB, 0xD1, 0xFB, 
-    0x32, 0xFD, 0x82, 0xFC, 0x04, 0xFC, 0x19, 0xFA, 0xCD, 0xF9, 0x1D, 0xF9, 0x08, 0xFB, 0xA3, 0xFA, 
-    0xB0, 0xFA, 0x36, 0xF9, 0xC1, 0xF9, 0x60, 0xFB, 0x2A, 0xFC, 0x4B, 0xFD, 0x21, 0xFB, 0x3A, 0xFB, 
-    0x8E, 0xF9, 0x04, 0xFC, 0x64, 0xFD, 0x70, 0x00, 0x9A, 0x02, 0x35, 0x08, 0x3D, 0x15, 0x95, 0x21, 
-    0xBF, 0x26, 0xD0, 0x1F, 0x95, 0x15, 0xE1, 0x0F, 0x6F, 0x12, 0x95, 0x1B, 0x41, 0x26, 0x52, 0x2E, 
-    0xED, 0x2A, 0x4E, 0x1D, 0xE5, 0x08, 0x19, 0xFD, 0x2A, 0xFC, 0x9E, 0x04, 0x4E, 0x0B, 0x70, 0x0C, 
-    0x24, 0x06, 0xB8, 0xFB, 0x2E, 0xF2, 0x8F, 0xEA, 0x4B, 0xE8, 0x54, 0xE9, 0xF7, 0xEC, 0x3B, 0xEF, 
-    0x8E, 0xF0, 0x97, 0xF1, 0xA8, 0xF3, 0x8A, 0xF4, 0x8E, 0xF3, 0xC1, 0xF0, 0xE7, 0xF0, 0xB8, 0xF5, 
-    0x29, 0xFF, 0x28, 0x08, 0x74, 0x0E, 0x63, 0x0F, 0x74, 0x0B, 0xCC, 0x05, 0x74, 0x02, 0x52, 0x04, 
-    0xAF, 0x09, 0xAE, 0x0F, 0x56, 0x12, 0x28, 0x11, 0xBB, 0x0C, 0x2D, 0x07, 0x0F, 0x02, 0x5C, 0xFF, 
-    0x36, 0xFF, 0x4A, 0x00, 0xBB, 0x00, 0x82, 0xFF, 0x25, 0xFD, 0x00, 0xFA, 0x64, 0xF7, 0x15, 0xF5, 
-    0xF3, 0xF3, 0xA8, 0xF3, 0x8A, 0xF4, 0x82, 0xF6, 0x97, 0xFA, 0xAC, 0xFE, 0x46, 0x01, 0xA2, 0x00, 
-    0xBC, 0xFD, 0x04, 0xFC, 0xF3, 0xFC, 0x46, 0x01, 0xC8, 0x06, 0xDD, 0x0A, 0xB3, 0x0B, 0x28, 0x08, 
-    0xBF, 0x02, 0x15, 0xFE, 0x3F, 0xFD, 0x82, 0xFF, 0xBF, 0x02, 0x13, 0x04, 0xD9, 0x02, 0x82, 0xFF, 
-    0x75, 0xFC, 0xE6, 0xF9, 0x54, 0xF8, 0x15, 0xF8, 0xD1, 0xF8, 0xF3, 0xF9, 0x64, 0xFA, 0x64, 0xFA, 
-    0xF3, 0xF9, 0xB8, 0xF8, 0x97, 0xF7, 0x10, 0xF6, 0xEB, 0xF5, 0x3F, 0xF7, 0xE6, 0xF9, 0x9B, 0xFC, 
-    0x53, 0xFE, 0x92, 0xFE, 0x7D, 0xFD, 0x4F, 0xFC, 0xDE, 0xFB, 0x97, 0xFD, 0x63, 0x00, 0xA2, 0x03, 
-    0x03, 0x05, 0x78, 0x04, 0x35, 0x02, 0xE6, 0xFF, 0x79, 0xFE, 0xBC, 0xFD, 0xD6, 0xFD, 0xEF, 0xFD, 
-    0x6D, 0xFE, 0x47, 0xFE, 0xFB, 0xFD, 0xE6, 0xFC, 0xB8, 0xFB, 0x8A, 0xFA, 0x9B, 0xF9, 0xC1, 0xF9, 
-    0xC9, 0xFA, 0xF3, 0xFC, 0x86, 0xFE, 0xF7, 0xFE, 0xE6, 0xFC, 0x25, 0xFA, 0x08, 0xF8, 0xC5, 0xF8, 
-    0xC9, 0xFA, 0x75, 0xFC, 0xE6, 0xFC, 0x79, 0xFB, 0xCD, 0xF9, 0xB0, 0xF7, 0xFB, 0xF7, 0x8E, 0xF9, 
-    0xA7, 0xFC, 0x15, 0xFE, 0x64, 0xFD, 0x36, 0xFC, 0xD6, 0xFA, 0xB8, 0xFB, 0xEB, 0xFB, 0x32, 0xFD, 
-    0xA7, 0xFC, 0xE6, 0xFC, 0x5C, 0xFC, 0x00, 0xFD, 0xFB, 0xFD, 0x8E, 0xFF, 0xBB, 0x00, 0xCC, 0x02, 
-    0x7C, 0x0C, 0x84, 0x19, 0x95, 0x21, 0x49, 0x1E, 0xAA, 0x13, 0x91, 0x0D, 0x7C, 0x0F, 0xC7, 0x18, 
-    0x6F, 0x21, 0x39, 0x28, 0x95, 0x27, 0xFA, 0x1E, 0xED, 0x0F, 0x03, 0x05, 0x9E, 0x04, 0x5F, 0x0A, 
-    0xE1, 0x0F, 0xD0, 0x0D, 0x1C, 0x08, 0xDA, 0xFF, 0xB0, 0xFA, 0xEB, 0xF5, 0x21, 0xF2, 0x3B, 0xEF, 
-    0xF3, 0xED, 0x58, 0xEE, 0xFC, 0xEE, 0x00, 0xF1, 0x60, 0xF2, 0xEB, 0xF2, 0x5C, 0xF0, 0x6D, 0xEC, 
-    0xC1, 0xEA, 0x47, 0xEF, 0x47, 0xF8, 0xBB, 0x00, 0x67, 0x05, 0x42, 0x05, 0x4E, 0x02, 0x9B, 0xFF, 
-    0xA7, 0xFF, 0xE1, 0x03, 0xFE, 0x08, 0x6B, 0x0D, 0x0B, 0x0F, 0x67, 0x0E, 0x13, 0x0D, 0x80, 0x0B, 
-    0xD4, 0x09, 0x1C, 0x08, 0xD4, 0x06, 0x8D, 0x05, 0x35, 0x05, 0xAA, 0x04, 0xBB, 0x03, 0x52, 0x01, 
-    0x21, 0xFE, 0xBC, 0xFA, 0xFB, 0xF7, 0x9B, 0xF6, 0x82, 0xF6, 0x6D, 0xF8, 0x8A, 0xFA, 0xF7, 0xFB, 
-    0x47, 0xFB, 0xDE, 0xF8, 0x58, 0xF7, 0x8A, 0xF7, 0x3F, 0xFA, 0xC9, 0xFD, 0xBB, 0x00, 0xE9, 0x01, 
-    0x6C, 0x01, 0xA7, 0xFF, 0x3A, 0xFE, 0x60, 0xFE, 0xA7, 0xFF, 0x28, 0x02, 0x3D, 0x03, 0x07, 0x04, 
-    0xF2, 0x02, 0xDD, 0x01, 0xD5, 0x00, 0x00, 0x00, 0x1D, 0xFF, 0x6D, 0xFE, 0xC5, 0xFE, 0x82, 0xFF, 
-    0xB4, 0xFF, 0x79, 0xFE, 0x68, 0xFC, 0xC1, 0xF9, 0x21, 0xF8, 0x97, 0xF7, 0xEF, 0xF7, 0x2A, 0xF9, 
-    0xCD, 0xF9, 0xF3, 0xF9, 0x1D, 0xF9, 0x60, 0xF8, 0x2E, 0xF8, 0xB8, 0xF8, 0xDA, 0xF9, 0x79, 0xFB, 
-    0x3F, 0xFD, 0xDE, 0xFE, 0x0B, 0x00, 0x18, 0x00, 0x82, 0xFF, 0x9F, 0xFE, 0x6D, 0xFE, 0xC5, 0xFE, 
-    0x75, 0xFF, 0x31, 0x00, 0xBB, 0x00, 0xE1, 0x00, 0x7C, 0x00, 0x82, 0xFF, 0x92, 0xFE, 0x15, 0xFE, 
-    0x15, 0xFE, 0x86, 0xFE, 0x1D, 0xFF, 0x68, 0xFF, 0xB4, 0xFF, 0xAC, 0xFE, 0x58, 0xFD, 0x15, 0xFB, 
-    0x19, 0xFA, 0xC1, 0xF9, 0x4B, 0xFA, 0x58, 0xFA, 0xE6, 0xF9, 0x1D, 0xF9, 0x8A, 0xF7, 0x4B, 0xF7, 
-    0xF3, 0xF6, 0x86, 0xF8, 0x2A, 0xF9, 0x8A, 0xFA, 0x25, 0xFA, 0x58, 0xFA, 0x64, 0xFA, 0xA3, 0xFA, 
-    0x3A, 0xFB, 0x9F, 0xFB, 0xB4, 0xFC, 0xCD, 0xFC, 0x3A, 0xFE, 0x6D, 0xFE, 0x24, 0x00, 0x31, 0x00, 
-    0xA6, 0x02, 0x18, 0x09, 0x4A, 0x15, 0xE5, 0x1D, 0x0F, 0x1D, 0x28, 0x14, 0x9E, 0x0D, 0xC8, 0x0F, 
-    0x56, 0x18, 0x0A, 0x21, 0xD0, 0x25, 0x52, 0x25, 0xAE, 0x1E, 0xC3, 0x13, 0x9A, 0x0B, 0x35, 0x0B, 
-    0x13, 0x10, 0xBB, 0x12, 0x07, 0x10, 0xE1, 0x09, 0x78, 0x04, 0x7C, 0x00, 0x3F, 0xFD, 0x36, 0xF9, 
-    0x4B, 0xF4, 0x50, 0xF0, 0xC9, 0xEE, 0x69, 0xF0, 0xAC, 0xF2, 0x4F, 0xF3, 0x0C, 0xF1, 0xF7, 0xEC, 
-    0x3B, 0xE9, 0x4B, 0xE8, 0x08, 0xEC, 0x04, 0xF3, 0x8E, 0xF9, 0xF7, 0xFB, 0x86, 0xFB, 0x3F, 0xFA, 
-    0xBC, 0xFA, 0x00, 0xFD, 0xFA, 0x00, 0xDD, 0x04, 0xDD, 0x07, 0x56, 0x09, 0xB7, 0x0A, 0x7C, 0x0C, 
-    0xC3, 0x0D, 0x07, 0x0D, 0xD0, 0x0A, 0x3D, 0x09, 0x70, 0x09, 0xB7, 0x0A, 0x8D, 0x0B, 0xAA, 0x0A, 
-    0x78, 0x07, 0x89, 0x03, 0xDA, 0xFF, 0x6D, 0xFE, 0x3A, 0xFE, 0x47, 0xFE, 0x8A, 0xFD, 0x2A, 0xFC, 
-    0xC9, 0xFA, 0x00, 0xFA, 0x5C, 0xF9, 0x36, 0xF9, 0x9F, 0xF8, 0x21, 0xF8, 0x2E, 0xF8, 0x5C, 0xF9, 
-    0x3A, 0xFB, 0x9B, 0xFC, 0xCD, 0xFC, 0xAC, 0xFB, 0x8A, 0xFA, 0x19, 0xFA, 0x9F, 0xFB, 0xE2, 0xFD, 
-    0x24, 0x00, 0xAF, 0x00, 0x31, 0x00, 0x9B, 0xFF, 0x68, 0xFF, 0xA7, 0xFF, 0x00, 0x00, 0xAF, 0x00, 
-    0x07, 0x01, 0x13, 0x01, 0x57, 0x00, 0xB4, 0xFF, 0xD1, 0xFE, 0x15, 0xFE, 0xDA, 0xFC, 0xD1, 0xFB, 
-    0x3A, 0xFB, 0x2E, 0xFB, 0x47, 0xFB, 0xFB, 0xFA, 0x4B, 0xFA, 0x82, 0xF9, 0xDE, 0xF8, 0xAC, 0xF8, 
-    0x1D, 0xF9, 0xE6, 0xF9, 0x08, 0xFB, 0x10, 0xFC, 0x4F, 0xFC, 0xF7, 0xFB, 0x60, 0xFB, 0x79, 0xFB, 
-    0x1D, 0xFC, 0xCD, 0xFC, 0x0C, 0xFD, 0x3F, 0xFD, 0x7D, 0xFD, 0x53, 0xFE, 0xD1, 0xFE, 0x43, 0xFF, 
-    0x36, 0xFF, 0x10, 0xFF, 0x4F, 0xFF, 0xF3, 0xFF, 0xEE, 0x00, 0xD0, 0x01, 0xF6, 0x01, 0x2D, 0x01, 
-    0xDA, 0xFF, 0xDE, 0xFE, 0x6D, 0xFE, 0x92, 0xFE, 0xB8, 0xFE, 0x86, 0xFE, 0x97, 0xFD, 0x2A, 0xFC, 
-    0x08, 0xFB, 0x7E, 0xFA, 0xD6, 0xFA, 0x6D, 0xFB, 0xDE, 0xFB, 0xAC, 0xFB, 0x3A, 0xFB, 0xEF, 0xFA, 
-    0xC9, 0xFA, 0x2E, 0xFB, 0x86, 0xFB, 0xEB, 0xFB, 0x04, 0xFC, 0xA7, 0xFC, 0xE2, 0xFD, 0x5C, 0xFF, 
-    0xC8, 0x00, 0x6C, 0x01, 0xB7, 0x01, 0xCC, 0x02, 0xAF, 0x06, 0x85, 0x0D, 0xD4, 0x12, 0xD0, 0x13, 
-    0xED, 0x0F, 0x95, 0x0C, 0xC8, 0x0C, 0xB7, 0x10, 0xD8, 0x14, 0xA6, 0x17, 0x3D, 0x18, 0x45, 0x16, 
-    0x56, 0x12, 0x4E, 0x0E, 0x39, 0x0D, 0x28, 0x0E, 0xBF, 0x0E, 0x2C, 0x0D, 0x85, 0x0A, 0x5B, 0x08, 
-    0x20, 0x07, 0x9A, 0x05, 0xCC, 0x02, 0x29, 0xFF, 0x86, 0xFB, 0xEB, 0xF8, 0xFB, 0xF7, 0xAC, 0xF8, 
-    0x8E, 0xF9, 0x10, 0xF9, 0x25, 0xF7, 0x7E, 0xF4, 0x9F, 0xF2, 0x9F, 0xF2, 0x71, 0xF4, 0x3F, 0xF7, 
-    0x75, 0xF9, 0x97, 0xFA, 0x8A, 0xFA, 0x97, 0xFA, 0x47, 0xFB, 0xB4, 0xFC, 0xE2, 0xFD, 0xAC, 0xFE, 
-    0x43, 0xFF, 0x7C, 0x00, 0x35, 0x02, 0xBB, 0x03, 0x6C, 0x04, 0x20, 0x04, 0x3D, 0x03, 0xF6, 0x01, 
-    0x39, 0x01, 0x39, 0x01, 0x0F, 0x02, 0xCC, 0x02, 0xE5, 0x02, 0x28, 0x02, 0xBB, 0x00, 0x5C, 0xFF, 
-    0x21, 0xFE, 0x58, 0xFD, 0x0C, 0xFD, 0xA3, 0xFD, 0xB8, 0xFE, 0x82, 0xFF, 0x75, 0xFF, 0xAC, 0xFE, 
-    0xFB, 0xFD, 0xA3, 0xFD, 0xE2, 0xFD, 0x86, 0xFE, 0x36, 0xFF, 0xC1, 0xFF, 0xDA, 0xFF, 0x9B, 0xFF, 
-    0x1D, 0xFF, 0xEB, 0xFE, 0xDE, 0xFE, 0xD1, 0xFE, 0x86, 0xFE, 0x53, 0xFE, 0x53, 0xFE, 0xB8, 0xFE, 
-    0x1D, 0xFF, 0x29, 0xFF, 0xF7, 0xFE, 0x47, 0xFE, 0xBC, 0xFD, 0x32, 0xFD, 0x25, 0xFD, 0x64, 0xFD, 
-    0xA3, 0xFD, 0xA3, 0xFD, 0x58, 0xFD, 0xB4, 0xFC, 0x10, 0xFC, 0xEB, 0xFB, 0xEB, 0xFB, 0x4F, 0xFC, 
-    0xC1, 0xFC, 0xE6, 0xFC, 0xCD, 0xFC, 0x0C, 0xFD, 0x4B, 0xFD, 0xA3, 0xFD, 0x08, 0xFE, 0xE2, 0xFD, 
-    0x53, 0xFE, 0x60, 0xFE, 0xAC, 0xFE, 0xB8, 0xFE, 0xAC, 0xFE, 0x6D, 0xFE, 0x86, 0xFE, 0xAC, 0xFE, 
-    0x1D, 0xFF, 0xDA, 0xFF, 0x3D, 0x00, 0xE1, 0x00, 0xFA, 0x00, 0x13, 0x01, 0x46, 0x01, 0x91, 0x01, 
-    0x42, 0x02, 0xA6, 0x02, 0xBF, 0x02, 0x28, 0x02, 0x52, 0x01, 0xBB, 0x00, 0xEE, 0x00, 0x2D, 0x01, 
-    0x13, 0x01, 0x70, 0x00, 0x8E, 0xFF, 0xDE, 0xFE, 0x6D, 0xFE, 0x53, 0xFE, 0x9F, 0xFE, 0xC5, 0xFE, 
-    0x53, 0xFE, 0x64, 0xFD, 0x75, 0xFC, 0x2A, 0xFC, 0x5C, 0xFC, 0x9B, 0xFC, 0xC1, 0xFC, 0xE6, 0xFC, 
-    0x25, 0xFD, 0x71, 0xFD, 0xC9, 0xFD, 0x6D, 0xFE, 0x75, 0xFF, 0xBB, 0x00, 0x03, 0x02, 0x18, 0x03, 
-    0xFA, 0x03, 0x9E, 0x04, 0x0F, 0x05, 0x74, 0x05, 0x18, 0x06, 0xA2, 0x06, 0x20, 0x07, 0x2D, 0x07, 
-    0x07, 0x07, 0xA2, 0x06, 0x4A, 0x06, 0xD9, 0x05, 0x42, 0x05, 0x6C, 0x04, 0x96, 0x03, 0xE5, 0x02, 
-    0x67, 0x02, 0xE9, 0x01, 0x46, 0x01, 0x4A, 0x00, 0xF7, 0xFE, 0x97, 0xFD, 0xC1, 0xFC, 0x82, 0xFC, 
-    0xA7, 0xFC, 0xA7, 0xFC, 0x82, 0xFC, 0x1D, 0xFC, 0x04, 0xFC, 0x43, 0xFC, 0xB4, 0xFC, 0x71, 0xFD, 
-    0x60, 0xFE, 0x9B, 0xFF, 0xEE, 0x00, 0x1C, 0x02, 0xF2, 0x02, 0x7C, 0x03, 0x2D, 0x04, 0xDD, 0x04, 
-    0x8D, 0x05, 0x0B, 0x06, 0xA2, 0x06, 0x52, 0x07, 0x03, 0x08, 0x35, 0x08, 0xD0, 0x07, 0x78, 0x07, 
-    0x46, 0x07, 0x2D, 0x07, 0xA2, 0x06, 0xBF, 0x05, 0xE9, 0x04, 0x46, 0x04, 0x96, 0x03, 0xD9, 0x02, 
-    0x0F, 0x02, 0xEE, 0x00, 0x82, 0xFF, 0xEF, 0xFD, 0xDA, 0xFC, 0x5C, 0xFC, 0x68, 0xFC, 0x5C, 0xFC, 
-    0xEB, 0xFB, 0x47, 0xFB, 0xB0, 0xFA, 0x71, 0xFA, 0x71, 0xFA, 0xC9, 0xFA, 0x15, 0xFB, 0x54, 0xFB, 
-    0x54, 0xFB, 0x54, 0xFB, 0x47, 0xFB, 0x6D, 0xFB, 0x92, 0xFB, 0xC5, 0xFB, 0x2A, 0xFC, 0x82, 0xFC, 
-    0xF3, 0xFC, 0x3F, 0xFD, 0xA3, 0xFD, 0xE2, 0xFD, 0x2E, 0xFE, 0x47, 0xFE, 0x53, 0xFE, 0x53, 0xFE, 
-    0x60, 0xFE, 0x92, 0xFE, 0xAC, 0xFE, 0xC5, 0xFE, 0xB8, 0xFE, 0x79, 0xFE, 0x2E, 0xFE, 0xFB, 0xFD, 
-    0xEF, 0xFD, 0x21, 0xFE, 0x6D, 0xFE, 0x9F, 0xFE, 0x86, 0xFE, 0x3A, 0xFE, 0x2E, 0xFE, 0x53, 0xFE, 
-    0xAC, 0xFE, 0xB8, 0xFE, 0x86, 0xFE, 0x47, 0xFE, 0x3A, 0xFE, 0x47, 0xFE, 0x3A, 0xFE, 0x21, 0xFE, 
-    0x15, 0xFE, 0x47, 0xFE, 0x86, 0xFE, 0xAC, 0xFE, 0xEB, 0xFE, 0x4F, 0xFF, 0xCD, 0xFF, 0x18, 0x00, 
-    0x70, 0x00, 0xC8, 0x00, 0x52, 0x01, 0xE9, 0x01, 0x1C, 0x02, 0xDD, 0x01, 0x78, 0x01, 0x91, 0x01, 
-    0xD0, 0x01, 0x4E, 0x02, 0x67, 0x02, 0x74, 0x02, 0x03, 0x02, 0x9E, 0x01, 0x07, 0x01, 0xE1, 0x00, 
-    0xD5, 0x00, 0xC8, 0x00, 0x63, 0x00, 0x9B, 0xFF, 0x10, 0xFF, 0x79, 0xFE, 0x15, 0xFE, 0x97, 0xFD, 
-    0x71, 0xFD, 0x58, 0xFD, 0x7D, 0xFD, 0x7D, 0xFD, 0xB0, 0xFD, 0xFB, 0xFD, 0x86, 0xFE, 0x1D, 0xFF, 
-    0xA7, 0xFF, 0x3D, 0x00, 0xAF, 0x00, 0x39, 0x01, 0xB7, 0x01, 0x4E, 0x02, 0xF2, 0x02, 0xA2, 0x03, 
-    0x13, 0x04, 0x5F, 0x04, 0xAA, 0x04, 0xB7, 0x04, 0xAA, 0x04, 0x85, 0x04, 0x6C, 0x04, 0x6C, 0x04, 
-    0x5F, 0x04, 0x20, 0x04, 0xC8, 0x03, 0x89, 0x03, 0xFE, 0x02, 0x74, 0x02, 0xAB, 0x01, 0xE1, 0x00, 
-    0x3D, 0x00, 0xDA, 0xFF, 0x5C, 0xFF, 0xEB, 0xFE, 0x92, 0xFE, 0x2E, 0xFE, 0xFB, 0xFD, 0xD6, 0xFD, 
-    0xA3, 0xFD, 0xC9, 0xFD, 0x21, 0xFE, 0xC5, 0xFE, 0x68, 0xFF, 0xDA, 0xFF, 0x4A, 0x00, 0x70, 0x00, 
-    0xEE, 0x00, 0x6C, 0x01, 0x0F, 0x02, 0x67, 0x02, 0xBF, 0x02, 0x0B, 0x03, 0x57, 0x03, 0xA2, 0x03, 
-    0xC8, 0x03, 0xD4, 0x03, 0xD4, 0x03, 0x89, 0x03, 0x0B, 0x03, 0x8D, 0x02, 0x35, 0x02, 0x03, 0x02, 
-    0x9E, 0x01, 0x20, 0x01, 0x57, 0x00, 0x75, 0xFF, 0x79, 0xFE, 0xA3, 0xFD, 0x25, 0xFD, 0x0C, 0xFD, 
-    0x32, 0xFD, 0x3F, 0xFD, 0x19, 0xFD, 0xA7, 0xFC, 0x36, 0xFC, 0x04, 0xFC, 0x36, 0xFC, 0xA7, 0xFC, 
-    0x19, 0xFD, 0x71, 0xFD, 0x7D, 0xFD, 0x71, 0xFD, 0x8A, 0xFD, 0x97, 0xFD, 0xB0, 0xFD, 0xBC, 0xFD, 
-    0xD6, 0xFD, 0x2E, 0xFE, 0x79, 0xFE, 0xD1, 0xFE, 0x04, 0xFF, 0x1D, 0xFF, 0x04, 0xFF, 0xEB, 0xFE, 
-    0xB8, 0xFE, 0xB8, 0xFE, 0xC5, 0xFE, 0xF7, 0xFE, 0x04, 0xFF, 0x10, 0xFF, 0xDE, 0xFE, 0xAC, 0xFE, 
-    0x92, 0xFE, 0x79, 0xFE, 0x86, 0xFE, 0x79, 0xFE, 0x9F, 0xFE, 0xD1, 0xFE, 0x29, 0xFF, 0x5C, 0xFF, 
-    0x75, 0xFF, 0x8E, 0xFF, 0x8E, 0xFF, 0x75, 0xFF, 0x5C, 0xFF, 0x43, 0xFF, 0x68, 0xFF, 0x8E, 0xFF, 
-    0x82, 0xFF, 0x43, 0xFF, 0x10, 0xFF, 0x1D, 0xFF, 0x43, 0xFF, 0x5C, 0xFF, 0x75, 0xFF, 0x9B, 0xFF, 
-    0xA7, 0xFF, 0xCD, 0xFF, 0x00, 0x00, 0x4A, 0x00, 0xA2, 0x00, 0xD5, 0x00, 0xD5, 0x00, 0xAF, 0x00, 
-    0x96, 0x00, 0xE1, 0x00, 0x20, 0x01, 0x52, 0x01, 0x5F, 0x01, 0x2D, 0x01, 0x13, 0x01, 0xE1, 0x00, 
-    0xD5, 0x00, 0xEE, 0x00, 0x13, 0x01, 0x07, 0x01, 0xBB, 0x00, 0x4A, 0x00, 0xE6, 0xFF, 0xA7, 0xFF, 
-    0x82, 0xFF, 0x75, 0xFF, 0x75, 0xFF, 0x8E, 0xFF, 0x9B, 0xFF, 0xA7, 0xFF, 0xB4, 0xFF, 0xE6, 0xFF, 
-    0x3D, 0x00, 0xC8, 0x00, 0x78, 0x01, 0xDD, 0x01, 0x4E, 0x02, 0x81, 0x02, 0xD9, 0x02, 0x24, 0x03, 
-    0x70, 0x03, 0xA2, 0x03, 0xE1, 0x03, 0xFA, 0x03, 0x2D, 0x04, 0x2D, 0x04, 0x13, 0x04, 0xD4, 0x03, 
-    0x7C, 0x03, 0x31, 0x03, 0xF2, 0x02, 0xB3, 0x02, 0x81, 0x02, 0x42, 0x02, 0xD0, 0x01, 0x39, 0x01, 
-    0x70, 0x00, 0x8E, 0xFF, 0xF7, 0xFE, 0x86, 0xFE, 0x3A, 0xFE, 0xC9, 0xFD, 0x3F, 0xFD, 0xC1, 0xFC, 
-    0x68, 0xFC, 0x2A, 0xFC, 0xF7, 0xFB, 0xF7, 0xFB, 0x36, 0xFC, 0x9B, 0xFC, 0x19, 0xFD, 0x8A, 0xFD, 
-    0xE2, 0xFD, 0x3A, 0xFE, 0xB8, 0xFE, 0x43, 0xFF, 0xC1, 0xFF, 0x24, 0x00, 0x96, 0x00, 0x20, 0x01, 
-    0x9E, 0x01, 0x0F, 0x02, 0x35, 0x02, 0x74, 0x02, 0x81, 0x02, 0x67, 0x02, 0x1C, 0x02, 0xF6, 0x01, 
-    0xDD, 0x01, 0xDD, 0x01, 0xB7, 0x01, 0x39, 0x01, 0x96, 0x00, 0xE6, 0xFF, 0x4F, 0xFF, 0xC5, 0xFE, 
-    0x79, 0xFE, 0x3A, 0xFE, 0x21, 0xFE, 0xEF, 0xFD, 0xBC, 0xFD, 0x64, 0xFD, 0x32, 0xFD, 0x25, 0xFD, 
-    0x3F, 0xFD, 0x8A, 0xFD, 0xD6, 0xFD, 0x15, 0xFE, 0x21, 0xFE, 0x21, 0xFE, 0x2E, 0xFE, 0x47, 0xFE, 
-    0x6D, 0xFE, 0xAC, 0xFE, 0xDE, 0xFE, 0x2A, 0xFF, 0x75, 0xFF, 0xB4, 0xFF, 0xF3, 0xFF, 0x00, 0x00, 
-    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDA, 0xFF, 0xE6, 0xFF, 0xF3, 0xFF, 0x00, 0x00, 0xDA, 0xFF, 
-    0xB4, 0xFF, 0x8E, 0xFF, 0x82, 0xFF, 0x82, 0xFF, 0x75, 0xFF, 0x75, 0xFF, 0x69, 0xFF, 0x9B, 0xFF, 
-    0xB4, 0xFF, 0xDA, 0xFF, 0xDA, 0xFF, 0xF3, 0xFF, 0xF3, 0xFF, 0xE6, 0xFF, 0xE6, 0xFF, 0x00, 0x00, 
-    0x24, 0x00, 0x24, 0x00, 0xF3, 0xFF, 0xCD, 0xFF, 0xB4, 0xFF, 0xCD, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-    0x24, 0x00, 0x0B, 0x00, 0x0B, 0x00, 0x31, 0x00, 0x7C, 0x00, 0xC7, 0x00, 0x06, 0x01, 0x1F, 0x01, 
-    0x1F, 0x01, 0x06, 0x01, 0xF9, 0x00, 0x2B, 0x01, 0x76, 0x01, 0xA8, 0x01, 0xB5, 0x01, 0x76, 0x01, 
-    0x5D, 0x01, 0x5D, 0x01, 0x51, 0x01, 0x76, 0x01, 0x8F, 0x01, 0x83, 0x01, 0x44, 0x01, 0xD3, 0x00, 
-    0x6F, 0x00, 0x24, 0x00, 0xDA, 0xFF, 0x8F, 0xFF, 0x50, 0xFF, 0x1E, 0xFF, 0xF9, 0xFE, 0xBA, 0xFE, 
-    0x6F, 0xFE, 0x63, 0xFE, 0x88, 0xFE, 0xD3, 0xFE, 0x05, 0xFF, 0x2B, 0xFF, 0x44, 0xFF, 0x5D, 0xFF, 
-    0x9B, 0xFF, 0x00, 0x00, 0x62, 0x00, 0xD3, 0x00, 0x11, 0x01, 0x2A, 0x01, 0x69, 0x01, 0x9B, 0x01, 
-    0xE6, 0x01, 0x18, 0x02, 0x31, 0x02, 0x30, 0x02, 0x3D, 0x02, 0x56, 0x02, 0x7B, 0x02, 0x7B, 0x02, 
-    0x49, 0x02, 0x0B, 0x02, 0x9A, 0x01, 0x43, 0x01, 0xEC, 0x00, 0xA1, 0x00, 0x49, 0x00, 0x00, 0x00, 
-    0x76, 0xFF, 0xED, 0xFE, 0x57, 0xFE, 0xF4, 0xFD, 0xB5, 0xFD, 0x83, 0xFD, 0x84, 0xFD, 0xA9, 0xFD, 
-    0xB6, 0xFD, 0xB6, 0xFD, 0x9D, 0xFD, 0xA9, 0xFD, 0xE8, 0xFD, 0x32, 0xFE, 0x7D, 0xFE, 0xC8, 0xFE, 
-    0x06, 0xFF, 0x5E, 0xFF, 0x8F, 0xFF, 0xE7, 0xFF, 0x17, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x62, 0x00, 
-    0x6F, 0x00, 0x87, 0x00, 0x94, 0x00, 0xAD, 0x00, 0x94, 0x00, 0x62, 0x00, 0x17, 0x00, 0xCE, 0xFF, 
-    0x9C, 0xFF, 0x6A, 0xFF, 0x45, 0xFF, 0x38, 0xFF, 0x38, 0xFF, 0x20, 0xFF, 0xEE, 0xFE, 0xE1, 0xFE, 
-    0xEE, 0xFE, 0x07, 0xFF, 0x2C, 0xFF, 0x6A, 0xFF, 0xB5, 0xFF, 0x0B, 0x00, 0x24, 0x00, 0x24, 0x00, 
-    0x24, 0x00, 0x30, 0x00, 0x7B, 0x00, 0xAC, 0x00, 0xF7, 0x00, 0x03, 0x01, 0xF7, 0x00, 0xEA, 0x00, 
-    0xEA, 0x00, 0xEA, 0x00, 0xF7, 0x00, 0xEA, 0x00, 0xB9, 0x00, 0x87, 0x00, 0x62, 0x00, 0x49, 0x00, 
-    0x30, 0x00, 0x00, 0x00, 0xCE, 0xFF, 0x9C, 0xFF, 0x77, 0xFF, 0x6B, 0xFF, 0x6B, 0xFF, 0x45, 0xFF, 
-    0x39, 0xFF, 0x2D, 0xFF, 0x45, 0xFF, 0x6B, 0xFF, 0x9C, 0xFF, 0xB5, 0xFF, 0xDA, 0xFF, 0xDA, 0xFF, 
-    0xCE, 0xFF, 0xDA, 0xFF, 0xE7, 0xFF, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x0B, 0x00, 
-    0x30, 0x00, 0x55, 0x00, 0x55, 0x00, 0x62, 0x00, 0x55, 0x00, 0x6E, 0x00, 0x93, 0x00, 0xB8, 0x00, 
-    0xD1, 0x00, 0xD1, 0x00, 0xD1, 0x00, 0xD1, 0x00, 0xB8, 0x00, 0xD1, 0x00, 0xEA, 0x00, 0x02, 0x01, 
-    0x27, 0x01, 0x0F, 0x01, 0xF6, 0x00, 0xF6, 0x00, 0xE9, 0x00, 0x0F, 0x01, 0x27, 0x01, 0x34, 0x01, 
-    0x02, 0x01, 0xD1, 0x00, 0x7A, 0x00, 0x49, 0x00, 0x17, 0x00, 0x00, 0x00, 0xC2, 0xFF, 0x9D, 0xFF, 
-    0x78, 0xFF, 0x53, 0xFF, 0x46, 0xFF, 0x46, 0xFF, 0x5F, 0xFF, 0x6B, 0xFF, 0x6B, 0xFF, 0x78, 0xFF, 
-    0x84, 0xFF, 0xB5, 0xFF, 0xF3, 0xFF, 0x24, 0x00, 0x55, 0x00, 0x6E, 0x00, 0x93, 0x00, 0xB8, 0x00, 
-    0x02, 0x01, 0x3F, 0x01, 0x89, 0x01, 0x96, 0x01, 0x96, 0x01, 0x89, 0x01, 0x89, 0x01, 0xAE, 0x01, 
-    0xC7, 0x01, 0xDF, 0x01, 0xDF, 0x01, 0xAE, 0x01, 0x58, 0x01, 0x1A, 0x01, 0xD0, 0x00, 0x92, 0x00, 
-    0x30, 0x00, 0xDB, 0xFF, 0x91, 0xFF, 0x47, 0xFF, 0xFD, 0xFE, 0xA7, 0xFE, 0x5D, 0xFE, 0x1F, 0xFE, 
-    0xEE, 0xFD, 0xE2, 0xFD, 0xE2, 0xFD, 0xD6, 0xFD, 0xD6, 0xFD, 0xE2, 0xFD, 0x13, 0xFE, 0x45, 0xFE, 
-    0x82, 0xFE, 0xB3, 0xFE, 0xE5, 0xFE, 0x2E, 0xFF, 0x78, 0xFF, 0xC2, 0xFF, 0x0B, 0x00, 0x30, 0x00, 
-    0x55, 0x00, 0x6D, 0x00, 0x79, 0x00, 0x92, 0x00, 0xB7, 0x00, 0xDC, 0x00, 0xDC, 0x00, 0xCF, 0x00, 
-    0xAA, 0x00, 0x6D, 0x00, 0x3C, 0x00, 0x17, 0x00, 0x0B, 0x00, 0x0B, 0x00, 0xF3, 0xFF, 0xCE, 0xFF, 
-    0x91, 0xFF, 0x60, 0xFF, 0x54, 0xFF, 0x60, 0xFF, 0x6C, 0xFF, 0x79, 0xFF, 0x79, 0xFF, 0x85, 0xFF, 
-    0x85, 0xFF, 0x9D, 0xFF, 0x9D, 0xFF, 0xB6, 0xFF, 0xC2, 0xFF, 0xCE, 0xFF, 0xF3, 0xFF, 0x0B, 0x00, 
-    0x17, 0x00, 0x23, 0x00, 0x17, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 
-    0x00, 0x00, 0xE7, 0xFF, 0xDB, 0xFF, 0xCF, 0xFF, 0xB6, 0xFF, 0xAA, 0xFF, 0x9E, 0xFF, 0x91, 0xFF, 
-    0x85, 0xFF, 0x79, 0xFF, 0x6D, 0xFF, 0x91, 0xFF, 0xAA, 0xFF, 0xB6, 0xFF, 0xB6, 0xFF, 0xAA, 0xFF, 
-    0x92, 0xFF, 0xB6, 0xFF, 0xCF, 0xFF, 0xE7, 0xFF, 0xE7, 0xFF, 0xF3, 0xFF, 0xDB, 0xFF, 0xC2, 0xFF, 
-    0xC2, 0xFF, 0xC2, 0xFF, 0xF3, 0xFF, 0x00, 0x00, 0x17, 0x00, 0x0B, 0x00, 0x0B, 0x00, 0x0B, 0x00, 
-    0x2F, 0x00, 0x48, 0x00, 0x54, 0x00, 0x48, 0x00, 0x48, 0x00, 0x60, 0x00, 0x78, 0x00, 0x9D, 0x00, 
-    0xB5, 0x00, 0xCE, 0x00, 0xE6, 0x00, 0xE6, 0x00, 0xDA, 0x00, 0xE6, 0x00, 0xF2, 0x00, 0xFE, 0x00, 
-    0xFE, 0x00, 0xFE, 0x00, 0xDA, 0x00, 0xB5, 0x00, 0x84, 0x00, 0x48, 0x00, 0x23, 0x00, 0x00, 0x00, 
-    0xE7, 0xFF, 0xC3, 0xFF, 0xAA, 0xFF, 0x86, 0xFF, 0x6E, 0xFF, 0x3D, 0xFF, 0x31, 0xFF, 0x18, 0xFF, 
-    0x18, 0xFF, 0x31, 0xFF, 0x25, 0xFF, 0x31, 0xFF, 0x3D, 0xFF, 0x55, 0xFF, 0x6E, 0xFF, 0x86, 0xFF, 
-    0x9E, 0xFF, 0xDB, 0xFF, 0x0B, 0x00, 0x47, 0x00, 0x6C, 0x00, 0x9C, 0x00, 0xB5, 0x00, 0xCD, 0x00, 
-    0xD9, 0x00, 0xFD, 0x00, 0x22, 0x01, 0x52, 0x01, 0x5E, 0x01, 0x52, 0x01, 0x46, 0x01, 0x2E, 0x01, 
-    0x09, 0x01, 0xE5, 0x00, 0xCD, 0x00, 0xA8, 0x00, 0x78, 0x00, 0x53, 0x00, 0x0B, 0x00, 0xDB, 0xFF, 
-    0x9F, 0xFF, 0x6E, 0xFF, 0x4A, 0xFF, 0x4A, 0xFF, 0x32, 0xFF, 0x32, 0xFF, 0x19, 0xFF, 0x25, 0xFF, 
-    0x26, 0xFF, 0x32, 0xFF, 0x32, 0xFF, 0x3E, 0xFF, 0x56, 0xFF, 0x7A, 0xFF, 0xAB, 0xFF, 0xC3, 0xFF, 
-    0xF3, 0xFF, 0x17, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x47, 0x00, 0x53, 0x00, 0x5F, 0x00, 0x6B, 0x00, 
-    0x5F, 0x00, 0x53, 0x00, 0x3B, 0x00, 0x2F, 0x00, 0x0B, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xF3, 0xFF, 
-    0xE7, 0xFF, 0xDB, 0xFF, 0xB7, 0xFF, 0xB7, 0xFF, 0xB7, 0xFF, 0xB7, 0xFF, 0xAB, 0xFF, 0xAB, 0xFF, 
-    0xC3, 0xFF, 0xCF, 0xFF, 0xE7, 0xFF, 0xE7, 0xFF, 0xE7, 0xFF, 0xE7, 0xFF, 0x00, 0x00, 0x0B, 0x00, 
-    0x2F, 0x00, 0x23, 0x00, 0x2F, 0x00, 0x17, 0x00, 0x2F, 0x00, 0x17, 0x00, 0x0B, 0x00, 0x00, 0x00, 
-    0xE7, 0xFF, 0xCF, 0xFF, 0xAB, 0xFF, 0x93, 0xFF, 0x7B, 0xFF, 0x6F, 0xFF, 0x6F, 0xFF, 0x3F, 0xFF, 
-    0x27, 0xFF, 0x0F, 0xFF, 0x0F, 0xFF, 0x0F, 0xFF, 0x0F, 0xFF, 0x1B, 0xFF, 0x3F, 0xFF, 0x3F, 0xFF, 
-    0x4B, 0xFF, 0x4B, 0xFF, 0x63, 0xFF, 0x6F, 0xFF, 0x93, 0xFF, 0xAB, 0xFF, 0xC3, 0xFF, 0xDB, 0xFF, 
-    0xF3, 0xFF, 0x00, 0x00, 0x17, 0x00, 0x3B, 0x00, 0x53, 0x00, 0x6B, 0x00, 0x6B, 0x00, 0x77, 0x00, 
-    0x83, 0x00, 0x8F, 0x00, 0x9B, 0x00, 0xB3, 0x00, 0xCB, 0x00, 0xD7, 0x00, 0xD6, 0x00, 0xEE, 0x00, 
-    0xFA, 0x00, 0x06, 0x01, 0x1E, 0x01, 0x2A, 0x01, 0x2A, 0x01, 0x12, 0x01, 0x12, 0x01, 0xFA, 0x00, 
-    0x06, 0x01, 0xFA, 0x00, 0xFA, 0x00, 0xE2, 0x00, 0xBE, 0x00, 0x82, 0x00, 0x52, 0x00, 0x2E, 0x00, 
-    0x22, 0x00, 0x00, 0x00, 0xE8, 0xFF, 0xC4, 0xFF, 0xA0, 0xFF, 0x94, 0xFF, 0x88, 0xFF, 0x7C, 0xFF, 
-    0x70, 0xFF, 0x58, 0xFF, 0x58, 0xFF, 0x58, 0xFF, 0x64, 0xFF, 0x70, 0xFF, 0x88, 0xFF, 0xA0, 0xFF, 
-    0xB8, 0xFF, 0xC4, 0xFF, 0xDC, 0xFF, 0x00, 0x00, 0x22, 0x00, 0x3A, 0x00, 0x6A, 0x00, 0x82, 0x00, 
-    0x9A, 0x00, 0xA5, 0x00, 0xA5, 0x00, 0xB1, 0x00, 0xBD, 0x00, 0xE1, 0x00, 0xED, 0x00, 0xD5, 0x00, 
-    0xC9, 0x00, 0xB1, 0x00, 0xA5, 0x00, 0x76, 0x00, 0x52, 0x00, 0x2E, 0x00, 0x16, 0x00, 0x0A, 0x00, 
-    0xDC, 0xFF, 0xB8, 0xFF, 0x89, 0xFF, 0x4D, 0xFF, 0x41, 0xFF, 0x35, 0xFF, 0x35, 0xFF, 0x2A, 0xFF, 
-    0x2A, 0xFF, 0x41, 0xFF, 0x41, 0xFF, 0x59, 0xFF, 0x7D, 0xFF, 0x89, 0xFF, 0x95, 0xFF, 0xAC, 0xFF, 
-    0xC4, 0xFF, 0xDC, 0xFF, 0xF4, 0xFF, 0x0A, 0x00, 0x0A, 0x00, 0x16, 0x00, 0x22, 0x00, 0x2E, 0x00, 
-    0x3A, 0x00, 0x46, 0x00, 0x46, 0x00, 0x3A, 0x00, 0x2E, 0x00, 0x16, 0x00, 0x00, 0x00, 0xF4, 0xFF, 
-    0xDC, 0xFF, 0xC4, 0xFF, 0xA1, 0xFF, 0x89, 0xFF, 0x89, 0xFF, 0x7D, 0xFF, 0x7D, 0xFF, 0x72, 0xFF, 
-    0x72, 0xFF, 0x72, 0xFF, 0x5A, 0xFF, 0x66, 0xFF, 0x7E, 0xFF, 0x89, 0xFF, 0xA1, 0xFF, 0xA1, 0xFF, 
-    0xA1, 0xFF, 0xAD, 0xFF, 0xC4, 0xFF, 0xD0, 0xFF, 0xDC, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 
-    0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x16, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xE8, 0xFF, 0xDC, 0xFF, 0xC5, 0xFF, 0xD0, 0xFF, 0xC5, 0xFF, 0xD0, 0xFF, 
-    0xDC, 0xFF, 0xDC, 0xFF, 0xDC, 0xFF, 0xDC, 0xFF, 0xE8, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 
-    0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xE8, 0xFF, 0xE8, 0xFF, 0xE8, 0xFF, 0xDC, 0xFF, 0xF4, 0xFF, 
-    0xE8, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0x16, 0x00, 0x22, 0x00, 0x45, 0x00, 0x51, 0x00, 0x5C, 0x00, 0x68, 0x00, 0x7F, 0x00, 0x97, 0x00, 
-    0xBA, 0x00, 0xC6, 0x00, 0xD1, 0x00, 0xDD, 0x00, 0xDD, 0x00, 0xD1, 0x00, 0xBA, 0x00, 0xAE, 0x00, 
-    0xA2, 0x00, 0x8B, 0x00, 0x7F, 0x00, 0x68, 0x00, 0x68, 0x00, 0x50, 0x00, 0x2D, 0x00, 0x0A, 0x00, 
-    0xE8, 0xFF, 0xD1, 0xFF, 0xD1, 0xFF, 0xC5, 0xFF, 0xD1, 0xFF, 0xD1, 0xFF, 0xD1, 0xFF, 0xB9, 0xFF, 
-    0xAE, 0xFF, 0xBA, 0xFF, 0xBA, 0xFF, 0xC5, 0xFF, 0xD1, 0xFF, 0xDD, 0xFF, 0xE8, 0xFF, 0x00, 0x00, 
-    0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x16, 0x00, 0x16, 0x00, 0x21, 0x00, 0x2D, 0x00, 0x39, 0x00, 
-    0x50, 0x00, 0x44, 0x00, 0x2D, 0x00, 0x2D, 0x00, 0x39, 0x00, 0x39, 0x00, 0x16, 0x00, 0x0A, 0x00, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xC5, 0xFF, 0xBA, 0xFF, 0xA3, 0xFF, 0x97, 0xFF, 0x97, 0xFF, 0x8B, 0xFF, 
-    0x8B, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x8B, 0xFF, 0x8B, 0xFF, 0x97, 0xFF, 0xA3, 0xFF, 0xA3, 0xFF, 
-    0xAE, 0xFF, 0xBA, 0xFF, 0xC6, 0xFF, 0xDD, 0xFF, 0xF4, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x16, 0x00, 
-    0x21, 0x00, 0x38, 0x00, 0x44, 0x00, 0x50, 0x00, 0x50, 0x00, 0x50, 0x00, 0x4F, 0x00, 0x44, 0x00, 
-    0x38, 0x00, 0x2D, 0x00, 0x21, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xE8, 0xFF, 0xE8, 0xFF, 0xDD, 0xFF, 
-    0xDD, 0xFF, 0xC6, 0xFF, 0xBA, 0xFF, 0xBA, 0xFF, 0xC6, 0xFF, 0xBA, 0xFF, 0xC6, 0xFF, 0xC6, 0xFF, 
-    0xD1, 0xFF, 0xDD, 0xFF, 0xD1, 0xFF, 0xD1, 0xFF, 0xDD, 0xFF, 0xE8, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 
-    0xD1, 0xFF, 0xE8, 0xFF, 0xE8, 0xFF, 0xE8, 0xFF, 0xE8, 0xFF, 0xD1, 0xFF, 0xD1, 0xFF, 0xD1, 0xFF, 
-    0xD1, 0xFF, 0xD1, 0xFF, 0xDD, 0xFF, 0xD1, 0xFF, 0xDD, 0xFF, 0xC5, 0xFF, 0xB9, 0xFF, 0xC5, 0xFF, 
-    0xC5, 0xFF, 0xDC, 0xFF, 0xDC, 0xFF, 0xE8, 0xFF, 0xF4, 0xFF, 0x0A, 0x00, 0x0A, 0x00, 0x16, 0x00, 
-    0x16, 0x00, 0x22, 0x00, 0x22, 0x00, 0x2D, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x2D, 0x00, 
-    0x39, 0x00, 0x22, 0x00, 0x22, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xE8, 0xFF, 0xDC, 0xFF, 0xDC, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 
-    0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x16, 0x00, 0x22, 0x00, 0x22, 0x00, 
-    0x2E, 0x00, 0x22, 0x00, 0x22, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xF4, 0xFF, 0xE8, 0xFF, 0xDC, 0xFF, 0xE8, 0xFF, 0xE8, 0xFF, 0xDC, 0xFF, 0xE8, 0xFF, 
-    0xE8, 0xFF, 0xE8, 0xFF, 0xE8, 0xFF, 0xDC, 0xFF, 0xF4, 0xFF, 0xE8, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-    0x0A, 0x00, 0x22, 0x00, 0x22, 0x00, 0x2E, 0x00, 0x3A, 0x00, 0x3A, 0x00, 0x3A, 0x00, 0x3A, 0x00, 
-    0x46, 0x00, 0x5E, 0x00, 0x6A, 0x00, 0x5E, 0x00, 0x46, 0x00, 0x2E, 0x00, 0x3A, 0x00, 0x3B, 0x00, 
-    0x23, 0x00, 0x17, 0x00, 0x0B, 0x00, 0x00, 0x00, 0xE7, 0xFF, 0xDB, 0xFF, 0xC3, 0xFF, 0xB7, 0xFF, 
-    0x9F, 0xFF, 0x9F, 0xFF, 0x93, 0xFF, 0x93, 0xFF, 0x87, 0xFF, 0x87, 0xFF, 0x87, 0xFF, 0x93, 0xFF, 
-    0x93, 0xFF, 0x9F, 0xFF, 0xC3, 0xFF, 0xCF, 0xFF, 0xF3, 0xFF, 0x0B, 0x00, 0x23, 0x00, 0x2F, 0x00, 
-    0x3B, 0x00, 0x3B, 0x00, 0x2F, 0x00, 0x47, 0x00, 0x47, 0x00, 0x53, 0x00, 0x53, 0x00, 0x53, 0x00, 
-    0x47, 0x00, 0x47, 0x00, 0x2F, 0x00, 0x23, 0x00, 0x2F, 0x00, 0x17, 0x00, 0x00, 0x00, 0xF3, 0xFF, 
-    0xF3, 0xFF, 0xE7, 0xFF, 0xE7, 0xFF, 0xE7, 0xFF, 0xE7, 0xFF, 0xE7, 0xFF, 0xCF, 0xFF, 0xCF, 0xFF, 
-    0xDB, 0xFF, 0xE7, 0xFF, 0xE7, 0xFF, 0xE7, 0xFF, 0xE7, 0xFF, 0xE7, 0xFF, 0xDB, 0xFF, 0xDB, 0xFF, 
-    0xDB, 0xFF, 0xE7, 0xFF, 0xDB, 0xFF, 0xDB, 0xFF, 0xDB, 0xFF, 0xDB, 0xFF, 0xCE, 0xFF, 0xB6, 0xFF, 
-    0xC2, 0xFF, 0xB6, 0xFF, 0xC2, 0xFF, 0xCE, 0xFF, 0xC2, 0xFF, 0xC2, 0xFF, 0xB6, 0xFF, 0xB6, 0xFF, 
-    0xB6, 0xFF, 0xCE, 0xFF, 0xC2, 0xFF, 0xDB, 0xFF, 0xE7, 0xFF, 0xE7, 0xFF, 0xF3, 0xFF, 0x00, 0x00, 
-    0x0B, 0x00, 0x17, 0x00, 0x0B, 0x00, 0x24, 0x00, 0x17, 0x00, 0x17, 0x00, 0x0B, 0x00, 0x0B, 0x00, 
-    0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x0B, 0x00, 0x00, 0x00, 0xF3, 0xFF, 
-    0xF3, 0xFF, 0xF3, 0xFF, 0xE7, 0xFF, 0xC1, 0xFF, 0xDA, 0xFF, 0xDA, 0xFF, 0xE7, 0xFF, 0x00, 0x00, 
-    0x0B, 0x00, 0x0B, 0x00, 0x24, 0x00, 0x24, 0x00, 0x3D, 0x00, 0x49, 0x00, 0x56, 0x00, 0x6F, 0x00, 
-    0x6F, 0x00, 0x7B, 0x00, 0x7B, 0x00, 0x6F, 0x00, 0x7B, 0x00, 0x7B, 0x00, 0x94, 0x00, 0x94, 0x00, 
-    0xAD, 0x00, 0xBA, 0x00, 0xD3, 0x00, 0xD3, 0x00, 0xEC, 0x00, 0x05, 0x01, 0x76, 0x01, 0xA8, 0x01, 
-    0x7D, 0x02, 0x4B, 0x02, 0xA0, 0x05, 0x66, 0x09, 0x78, 0x08, 0xB0, 0x02, 0xBC, 0xFB, 0x4A, 0xFB, 
-    0xB4, 0xFF, 0xE8, 0x01, 0x4A, 0x00, 0x01, 0xFD, 0xD3, 0xFB, 0x59, 0xFA, 0x61, 0xF8, 0xFC, 0xFA, 
-    0x8E, 0xFC, 0x39, 0x01, 0x82, 0xFF, 0x97, 0xFD, 0xDA, 0xFC, 0x2E, 0xFE, 0x6D, 0xFE, 0x47, 0xFE, 
-    0x00, 0x00, 0xA3, 0xFD, 0xD1, 0xFE, 0x24, 0x00, 0x31, 0x00, 0x3D, 0x03, 0x03, 0x02, 0xAC, 0xFE, 
-    0x43, 0xFF, 0x21, 0xFE, 0x2D, 0x01, 0xE9, 0x01, 0x28, 0x02, 0x35, 0x05, 0xB3, 0x02, 0x15, 0xFE, 
-    0xDA, 0xFC, 0xBC, 0xFD, 0x20, 0x01, 0xD4, 0x03, 0x42, 0x02, 0x63, 0x03, 0x52, 0x01, 0x7C, 0x00, 
-    0xEB, 0xFE, 0x18, 0x00, 0xC4, 0x01, 0x31, 0x03, 0xAB, 0x01, 0x63, 0x00, 0x5C, 0xFF, 0xB4, 0xFF, 
-    0x04, 0xFF, 0x3D, 0x00, 0x9F, 0xFE, 0x9B, 0xFF, 0x86, 0xFE, 0x68, 0xFF, 0x9B, 0xFF, 0x31, 0x00, 
-    0x31, 0x00, 0x00, 0x00, 0x60, 0xFE, 0xC9, 0xFD, 0x25, 0xFD, 0x9F, 0xFE, 0xEB, 0xFE, 0x70, 0x00, 
-    0x75, 0xFF, 0xC5, 0xFE, 0xE6, 0xFC, 0x4F, 0xFC, 0xEF, 0xFD, 0x82, 0xFF, 0x3D, 0x00, 0xCD, 0xFF, 
-    0xCD, 0xFF, 0x5C, 0xFF, 0x53, 0xFE, 0x2E, 0xFE, 0xB8, 0xFE, 0x31, 0x00, 0x7C, 0x00, 0xB4, 0xFF, 
-    0xD1, 0xFE, 0xD1, 0xFE, 0xA7, 0xFF, 0x5C, 0xFF, 0x1D, 0xFF, 0xC5, 0xFE, 0x75, 0xFF, 0x24, 0x00, 
-    0x0B, 0x00, 0x7C, 0x00, 0x68, 0xFF, 0xB4, 0xFF, 0xC1, 0xFF, 0x00, 0x00, 0x63, 0x00, 0xAF, 0x00, 
-    0x20, 0x01, 0x13, 0x01, 0x24, 0x00, 0xB4, 0xFF, 0x8E, 0xFF, 0x96, 0x00, 0xEE, 0x00, 0x46, 0x01, 
-    0x70, 0x00, 0x7C, 0x00, 0x89, 0x00, 0x96, 0x00, 0xAF, 0x00, 0x63, 0x00, 0xD5, 0x00, 0xAF, 0x00, 
-    0x67, 0x02, 0x67, 0x02, 0x1C, 0x02, 0x18, 0x00, 0x7C, 0x00, 0xC8, 0x00, 0x9A, 0x02, 0x9E, 0x01, 
-    0xE9, 0x01, 0x7C, 0x00, 0xBB, 0x00, 0x04, 0xFF, 0x24, 0x00, 0x70, 0x00, 0x96, 0x00, 0x4F, 0xFF, 
-    0xF7, 0xFE, 0x9B, 0xFF, 0x57, 0x00, 0x82, 0xFF, 0xEB, 0xFE, 0xC5, 0xFE, 0x1D, 0xFF, 0x86, 0xFE, 
-    0x43, 0xFF, 0x3D, 0x00, 0xEE, 0x00, 0x9B, 0xFF, 0xEF, 0xFD, 0x21, 0xFE, 0x8E, 0xFF, 0x91, 0x01, 
-    0xE9, 0x01, 0x46, 0x01, 0xD5, 0x00, 0x82, 0xFF, 0x68, 0xFF, 0x4A, 0x00, 0x78, 0x01, 0x1C, 0x02, 
-    0x85, 0x01, 0xBB, 0x00, 0x7C, 0x00, 0x70, 0x00, 0x7C, 0x00, 0xDA, 0xFF, 0xBB, 0x00, 0x63, 0x00, 
-    0x96, 0x00, 0x18, 0x00, 0x63, 0x00, 0xBB, 0x00, 0xAF, 0x00, 0xC1, 0xFF, 0x43, 0xFF, 0xB4, 0xFF, 
-    0x70, 0x00, 0x13, 0x01, 0x2D, 0x01, 0xE1, 0x00, 0x31, 0x00, 0xB4, 0xFF, 0x82, 0xFF, 0x31, 0x00, 
-    0xAF, 0x00, 0xEE, 0x00, 0x7C, 0x00, 0x31, 0x00, 0xCD, 0xFF, 0xE6, 0xFF, 0x57, 0x00, 0x31, 0x00, 
-    0x24, 0x00, 0x31, 0x00, 0x3D, 0x00, 0xBB, 0x00, 0x70, 0x00, 0xE6, 0xFF, 0x82, 0xFF, 0x43, 0xFF, 
-    0x43, 0xFF, 0xA7, 0xFF, 0xF3, 0xFF, 0x00, 0x00, 0xE6, 0xFF, 0x4F, 0xFF, 0xA7, 0xFF, 0xA7, 0xFF, 
-    0xF3, 0xFF, 0x0B, 0x00, 0x63, 0x00, 0xFA, 0x00, 0xEE, 0x00, 0x89, 0x00, 0x0B, 0x00, 0x18, 0x00, 
-    0x31, 0x00, 0x4A, 0x00, 0xF3, 0xFF, 0x00, 0x00, 0x18, 0x00, 0xDA, 0xFF, 0xCD, 0xFF, 0x5C, 0xFF, 
-    0x4F, 0xFF, 0x75, 0xFF, 0xF3, 0xFF, 0x0B, 0x00, 0x24, 0x00, 0x82, 0xFF, 0x36, 0xFF, 0xEB, 0xFE, 
-    0xC5, 0xFE, 0xAC, 0xFE, 0x1D, 0xFF, 0x43, 0xFF, 0x1D, 0xFF, 0x53, 0xFE, 0xEF, 0xFD, 0x60, 0xFE, 
-    0x1D, 0xFF, 0x10, 0xFF, 0x92, 0xFE, 0x47, 0xFE, 0x6D, 0xFE, 0xC5, 0xFE, 0xB8, 0xFE, 0xAC, 0xFE, 
-    0x86, 0xFE, 0x92, 0xFE, 0x79, 0xFE, 0x86, 0xFE, 0x60, 0xFE, 0xEB, 0xFE, 0x75, 0xFF, 0x5C, 0xFF, 
-    0x10, 0xFF, 0x6D, 0xFE, 0x92, 0xFE, 0x36, 0xFF, 0xCD, 0xFF, 0x31, 0x00, 0x18, 0x00, 0x9B, 0xFF, 
-    0x9B, 0xFF, 0x04, 0xFF, 0xA7, 0xFF, 0x24, 0x00, 0xAF, 0x00, 0x63, 0x00, 0x8E, 0xFF, 0x36, 0xFF, 
-    0x0B, 0x00, 0x07, 0x01, 0xDD, 0x01, 0x6C, 0x01, 0xEE, 0x00, 0x70, 0x00, 0xBB, 0x00, 0x5F, 0x01, 
-    0x28, 0x02, 0x9A, 0x02, 0x03, 0x02, 0x91, 0x01, 0xE1, 0x00, 0x91, 0x01, 0x35, 0x02, 0x3D, 0x03, 
-    0x24, 0x03, 0xA6, 0x02, 0x9E, 0x01, 0x1C, 0x02, 0x4E, 0x02, 0x70, 0x03, 0x31, 0x03, 0x3D, 0x03, 
-    0xA6, 0x02, 0xBF, 0x02, 0xBF, 0x02, 0x57, 0x03, 0x7C, 0x03, 0x89, 0x03, 0x18, 0x03, 0x18, 0x03, 
-    0x70, 0x03, 0xE1, 0x03, 0xFA, 0x03, 0xA2, 0x03, 0x31, 0x03, 0xFE, 0x02, 0x63, 0x03, 0x96, 0x03, 
-    0xBB, 0x03, 0x0B, 0x03, 0x5B, 0x02, 0x78, 0x01, 0x46, 0x01, 0x20, 0x01, 0x07, 0x01, 0x89, 0x00, 
-    0xB4, 0xFF, 0xC5, 0xFE, 0x21, 0xFE, 0xEF, 0xFD, 0xFB, 0xFD, 0xC9, 0xFD, 0x19, 0xFD, 0x75, 0xFC, 
-    0x10, 0xFC, 0x4F, 0xFC, 0x75, 0xFC, 0x68, 0xFC, 0xDE, 0xFB, 0x54, 0xFB, 0xEF, 0xFA, 0x60, 0xFB, 
-    0x9F, 0xFB, 0x2A, 0xFC, 0x2A, 0xFC, 0xDE, 0xFB, 0xB8, 0xFB, 0xAC, 0xFB, 0xEB, 0xFB, 0x5C, 0xFC, 
-    0xB4, 0xFC, 0xA7, 0xFC, 0xA7, 0xFC, 0xB4, 0xFC, 0xC1, 0xFC, 0xA7, 0xFC, 0xA7, 0xFC, 0xDA, 0xFC, 
-    0x4B, 0xFD, 0x00, 0xFD, 0xC1, 0xFC, 0x8E, 0xFC, 0x19, 0xFD, 0x19, 0xFD, 0xF3, 0xFC, 0x82, 0xFC, 
-    0x5C, 0xFC, 0x75, 0xFC, 0xDA, 0xFC, 0xA7, 0xFC, 0x9B, 0xFC, 0xF7, 0xFB, 0x6D, 0xFB, 0x15, 0xFB, 
-    0xB8, 0xFB, 0x10, 0xFC, 0x68, 0xFC, 0x2A, 0xFC, 0x92, 0xFB, 0x60, 0xFB, 0x21, 0xFB, 0xF7, 0xFB, 
-    0xDA, 0xFC, 0x3F, 0xFD, 0x3F, 0xFD, 0x1D, 0xFC, 0x54, 0xFB, 0x4F, 0xFC, 0x64, 0xFD, 0x1D, 0xFF, 
-    0x04, 0xFF, 0x4F, 0xFF, 0xAC, 0xFE, 0xA2, 0x00, 0x28, 0x05, 0xA2, 0x09, 0xD0, 0x0A, 0x13, 0x07, 
-    0xBB, 0x03, 0xE9, 0x04, 0x6B, 0x0A, 0xD0, 0x10, 0xBB, 0x12, 0x95, 0x12, 0x5F, 0x10, 0xFA, 0x0C, 
-    0xA6, 0x0B, 0xA2, 0x0C, 0x8D, 0x11, 0x41, 0x14, 0x2C, 0x13, 0x3D, 0x0F, 0x7C, 0x0C, 0x8D, 0x0B, 
-    0x1C, 0x0B, 0x80, 0x08, 0xE1, 0x06, 0x03, 0x05, 0xE9, 0x04, 0x96, 0x03, 0x18, 0x03, 0x63, 0x00, 
-    0xC9, 0xFD, 0x69, 0xF9, 0x4B, 0xF7, 0x32, 0xF7, 0xDE, 0xF8, 0xC1, 0xF9, 0xD1, 0xF8, 0xAC, 0xF5, 
-    0x43, 0xF3, 0xBD, 0xF1, 0xB8, 0xF2, 0x97, 0xF4, 0x43, 0xF6, 0xDA, 0xF6, 0x82, 0xF6, 0x43, 0xF6, 
-    0xB4, 0xF6, 0x2E, 0xF8, 0xC1, 0xF9, 0xE2, 0xFA, 0x60, 0xFB, 0x10, 0xFC, 0x15, 0xFE, 0x00, 0x00, 
-    0x91, 0x01, 0xD0, 0x01, 0xF6, 0x01, 0xD4, 0x03, 0xEE, 0x06, 0x31, 0x09, 0x63, 0x09, 0xB7, 0x07, 
-    0x52, 0x07, 0x35, 0x08, 0x78, 0x0A, 0xD9, 0x0B, 0x4A, 0x0C, 0xB7, 0x0A, 0xE5, 0x08, 0x57, 0x06, 
-    0x9A, 0x05, 0x70, 0x06, 0x20, 0x07, 0x18, 0x06, 0x7C, 0x03, 0xD5, 0x00, 0xC1, 0xFF, 0xD1, 0xFE, 
-    0xFB, 0xFD, 0x2A, 0xFC, 0x4B, 0xFA, 0x2A, 0xF9, 0x2E, 0xF8, 0x15, 0xF8, 0xEF, 0xF7, 0x25, 0xF7, 
-    0x6D, 0xF5, 0x32, 0xF4, 0xF3, 0xF3, 0x54, 0xF5, 0x69, 0xF6, 0xDA, 0xF6, 0x36, 0xF6, 0xC5, 0xF5, 
-    0xB8, 0xF5, 0xE6, 0xF6, 0x21, 0xF8, 0xB4, 0xF9, 0x3F, 0xFA, 0xD6, 0xFA, 0x2E, 0xFB, 0x1D, 0xFC, 
-    0x32, 0xFD, 0x47, 0xFE, 0xC5, 0xFE, 0x10, 0xFF, 0x10, 0xFF, 0xE6, 0xFF, 0x89, 0x00, 0x2D, 0x01, 
-    0xEE, 0x00, 0x3D, 0x00, 0xCD, 0xFF, 0x75, 0xFF, 0xC1, 0xFF, 0xCD, 0xFF, 0x5C, 0xFF, 0x79, 0xFE, 
-    0x0C, 0xFD, 0x75, 0xFC, 0x5C, 0xFC, 0x36, 0xFC, 0x1D, 0xFC, 0xA3, 0xFA, 0x9B, 0xF9, 0x1D, 0xF9, 
-    0x4F, 0xF9, 0x58, 0xFA, 0x32, 0xFA, 0x9B, 0xF9, 0xDE, 0xF8, 0x79, 0xF8, 0xD1, 0xF8, 0x86, 0xF8, 
-    0x86, 0xF8, 0x1D, 0xF9, 0x32, 0xFA, 0xBC, 0xFA, 0x8A, 0xFD, 0x63, 0x06, 0x9A, 0x0B, 0x9A, 0x0B, 
-    0x85, 0x01, 0x43, 0xFC, 0x67, 0x02, 0x8D, 0x0E, 0xD4, 0x18, 0xD0, 0x19, 0x5F, 0x16, 0x35, 0x14, 
-    0x5F, 0x0D, 0x95, 0x0C, 0x0B, 0x0F, 0xFA, 0x18, 0x6F, 0x1E, 0x78, 0x1C, 0x78, 0x16, 0x07, 0x13, 
-    0xFE, 0x11, 0x78, 0x10, 0xF2, 0x0B, 0x20, 0x0A, 0xDD, 0x0A, 0xE1, 0x0C, 0x5B, 0x0B, 0x0F, 0x08, 
-    0xE9, 0x01, 0xB8, 0xFB, 0x8A, 0xF7, 0x6D, 0xF5, 0xFB, 0xF7, 0x8A, 0xFA, 0x60, 0xFB, 0x08, 0xF8, 
-    0x08, 0xF2, 0x69, 0xED, 0x54, 0xEC, 0xE7, 0xED, 0xF3, 0xF0, 0x79, 0xF2, 0x1D, 0xF3, 0xEB, 0xF2, 
-    0x54, 0xF2, 0x7E, 0xF1, 0x54, 0xF2, 0x0C, 0xF4, 0x36, 0xF6, 0x21, 0xF8, 0x58, 0xFA, 0x58, 0xFD, 
-    0x68, 0xFF, 0xE6, 0xFF, 0x04, 0xFF, 0x5C, 0xFF, 0x07, 0x01, 0xE9, 0x04, 0xE9, 0x07, 0x07, 0x0A, 
-    0x13, 0x0A, 0x80, 0x08, 0x6B, 0x07, 0x41, 0x08, 0x80, 0x0B, 0x35, 0x0E, 0x1C, 0x0E, 0xBF, 0x0B, 
-    0x70, 0x09, 0xCC, 0x08, 0x70, 0x09, 0xA2, 0x09, 0x74, 0x08, 0xAF, 0x06, 0x0F, 0x05, 0xFE, 0x02, 
-    0x74, 0x02, 0x13, 0x01, 0xE1, 0x00, 0xC5, 0xFE, 0x2A, 0xFC, 0x00, 0xFA, 0xC1, 0xF9, 0x4B, 0xFA, 
-    0xD6, 0xFA, 0xAC, 0xF8, 0xF3, 0xF6, 0x08, 0xF5, 0x79, 0xF5, 0xDE, 0xF5, 0x9B, 0xF6, 0x75, 0xF6, 
-    0x8E, 0xF6, 0xC5, 0xF5, 0xC5, 0xF5, 0x36, 0xF6, 0x58, 0xF7, 0xAC, 0xF8, 0x5C, 0xF9, 0x75, 0xF9, 
-    0x00, 0xFA, 0x71, 0xFA, 0x92, 0xFB, 0x36, 0xFC, 0x9B, 0xFC, 0xE6, 0xFC, 0x64, 0xFD, 0x79, 0xFE, 
-    0x36, 0xFF, 0xB4, 0xFF, 0x8E, 0xFF, 0x82, 0xFF, 0xF7, 0xFE, 0xEB, 0xFE, 0xC5, 0xFE, 0x36, 0xFF, 
-    0x8E, 0xFF, 0x36, 0xFF, 0x15, 0xFE, 0x25, 0xFD, 0x10, 0xFC, 0x04, 0xFC, 0xB8, 0xFB, 0x10, 0xFC, 
-    0x2A, 0xFC, 0xF7, 0xFB, 0x21, 0xFB, 0x8E, 0xF9, 0xDE, 0xF8, 0xAC, 0xF8, 0x1D, 0xF9, 0x04, 0xF9, 
-    0xC5, 0xF8, 0x69, 0xF9, 0x19, 0xFA, 0x71, 0xFA, 0x75, 0xF9, 0x3A, 0xF8, 0xD1, 0xF8, 0x9B, 0xF9, 
-    0x21, 0xFB, 0x79, 0xFB, 0x86, 0xFB, 0x36, 0xFC, 0xB0, 0xFD, 0x4E, 0x08, 0x13, 0x10, 0x17, 0x12, 
-    0xE9, 0x07, 0x71, 0xFD, 0x13, 0x01, 0xCC, 0x0E, 0x41, 0x1D, 0x56, 0x21, 0xAE, 0x1B, 0x30, 0x18, 
-    0x46, 0x10, 0xDD, 0x0D, 0x89, 0x0F, 0x5F, 0x19, 0x39, 0x22, 0x49, 0x21, 0x52, 0x19, 0x74, 0x11, 
-    0xC8, 0x0F, 0x3D, 0x0F, 0xFE, 0x0B, 0x5B, 0x08, 0xAA, 0x07, 0x70, 0x09, 0x24, 0x09, 0x03, 0x05, 
-    0x36, 0xFF, 0x58, 0xF7, 0x8E, 0xF3, 0x8E, 0xF0, 0xF7, 0xF2, 0x8E, 0xF6, 0xEB, 0xF8, 0x2A, 0xF6, 
-    0xD2, 0xEF, 0x3B, 0xE9, 0x32, 0xE8, 0x5C, 0xEA, 0x7A, 0xEF, 0x15, 0xF2, 0x5C, 0xF3, 0xAC, 0xF2, 
-    0x15, 0xF2, 0xA3, 0xF1, 0x8E, 0xF3, 0x8E, 0xF6, 0x0C, 0xFA, 0xC5, 0xFB, 0xA3, 0xFD, 0xCD, 0xFF, 
-    0xB3, 0x02, 0xFA, 0x03, 0x4A, 0x03, 0xBF, 0x02, 0x96, 0x03, 0x85, 0x07, 0x4E, 0x0B, 0x6B, 0x0D, 
-    0x2C, 0x0D, 0x91, 0x0A, 0x1C, 0x08, 0x5F, 0x07, 0x3D, 0x09, 0x70, 0x0C, 0xAA, 0x0D, 0x2C, 0x0D, 
-    0x78, 0x0A, 0x91, 0x07, 0x67, 0x05, 0x96, 0x03, 0x89, 0x03, 0xA2, 0x03, 0x78, 0x04, 0x31, 0x03, 
-    0xBB, 0x00, 0xEF, 0xFD, 0x86, 0xFB, 0xDA, 0xF9, 0x36, 0xF9, 0x1D, 0xF9, 0xA3, 0xFA, 0xEF, 0xFA, 
-    0x7E, 0xFA, 0xC9, 0xF7, 0x6D, 0xF5, 0x8A, 0xF4, 0xB8, 0xF5, 0xA3, 0xF7, 0x36, 0xF9, 0xA7, 0xF9, 
-    0x5C, 0xF9, 0x47, 0xF8, 0xB0, 0xF7, 0x4B, 0xF7, 0x93, 0xF8, 0x7E, 0xFA, 0x68, 0xFC, 0x8A, 0xFD, 
-    0x64, 0xFD, 0x00, 0xFD, 0x43, 0xFC, 0x43, 0xFC, 0xE6, 0xFC, 0xFB, 0xFD, 0x4F, 0xFF, 0x00, 0x00, 
-    0x9B, 0xFF, 0xDE, 0xFE, 0x97, 0xFD, 0x3F, 0xFD, 0x3F, 0xFD, 0x2E, 0xFE, 0xEB, 0xFE, 0x68, 0xFF, 
-    0x1D, 0xFF, 0x15, 0xFE, 0xA7, 0xFC, 0xF7, 0xFB, 0xAC, 0xFB, 0x8E, 0xFC, 0x4B, 0xFD, 0xEF, 0xFD, 
-    0x97, 0xFD, 0x82, 0xFC, 0x54, 0xFB, 0x58, 0xFA, 0x64, 0xFA, 0x3A, 0xFB, 0x4F, 0xFC, 0x25, 0xFD, 
-    0xE6, 0xFC, 0x15, 0xFB, 0x00, 0xFA, 0x43, 0xF9, 0x58, 0xFA, 0x04, 0xFC, 0x5C, 0xFC, 0xB4, 0xFC, 
-    0x21, 0xFB, 0x8A, 0xFA, 0x7E, 0xFA, 0x8A, 0xFA, 0xF7, 0xFB, 0x79, 0xFB, 0x15, 0xFB, 0x8A, 0xFA, 
-    0x64, 0xFA, 0xF2, 0x02, 0xF6, 0x0D, 0xB3, 0x11, 0xDD, 0x0A, 0xB8, 0xFB, 0xE2, 0xFA, 0x24, 0x06, 
-    0x9E, 0x16, 0xE1, 0x1E, 0xF1, 0x1A, 0x06, 0x16, 0x39, 0x10, 0x46, 0x0A, 0xB3, 0x0B, 0xCC, 0x11, 
-    0x8D, 0x1D, 0x78, 0x1F, 0x99, 0x1A, 0x24, 0x12, 0xA2, 0x0F, 0x31, 0x0F, 0xA2, 0x0C, 0x8D, 0x08, 
-    0x46, 0x07, 0x20, 0x0A, 0x56, 0x0C, 0x3D, 0x09, 0xE1, 0x03, 0xAC, 0xFB, 0xF3, 0xF6, 0xA3, 0xF4, 
-    0x2E, 0xF5, 0x43, 0xF9, 0xC5, 0xFB, 0xD6, 0xFA, 0x15, 0xF5, 0xC1, 0xED, 0xA8, 0xEA, 0xFC, 0xEB, 
-    0xDE, 0xEF, 0x69, 0xF3, 0x97, 0xF4, 0xBD, 0xF4, 0x9B, 0xF3, 0xAC, 0xF2, 0x93, 0xF2, 0xBD, 0xF4, 
-    0x21, 0xF8, 0xBC, 0xFA, 0x8E, 0xFC, 0x60, 0xFE, 0x57, 0x00, 0x0F, 0x02, 0x9E, 0x01, 0xE1, 0x00, 
-    0x78, 0x01, 0x5F, 0x04, 0x24, 0x09, 0xBF, 0x0B, 0x67, 0x0B, 0x7C, 0x09, 0xC8, 0x06, 0xA2, 0x06, 
-    0xA6, 0x08, 0x35, 0x0B, 0x6B, 0x0D, 0x02, 0x0E, 0xA6, 0x0B, 0xB3, 0x08, 0x5B, 0x05, 0x6C, 0x04, 
-    0xE9, 0x04, 0x8D, 0x05, 0x70, 0x06, 0x42, 0x05, 0x9A, 0x02, 0xE6, 0xFF, 0x68, 0xFC, 0x92, 0xFB, 
-    0x60, 0xFB, 0x1D, 0xFC, 0x36, 0xFC, 0x2A, 0xFC, 0x2E, 0xFB, 0x75, 0xF9, 0x4B, 0xF7, 0xF7, 0xF5, 
-    0x8E, 0xF6, 0x7E, 0xF7, 0xDE, 0xF8, 0x75, 0xF9, 0x1D, 0xF9, 0x93, 0xF8, 0x4B, 0xF7, 0x69, 0xF6, 
-    0x0C, 0xF7, 0x93, 0xF8, 0x08, 0xFB, 0x43, 0xFC, 0x4F, 0xFC, 0x79, 0xFB, 0x3F, 0xFA, 0xF3, 0xF9, 
-    0x08, 0xFB, 0xE6, 0xFC, 0xEB, 0xFE, 0xCD, 0xFF, 0x4F, 0xFF, 0x08, 0xFE, 0x3F, 0xFD, 0xB0, 0xFD, 
-    0xD1, 0xFE, 0x00, 0x00, 0x57, 0x00, 0x57, 0x00, 0x63, 0x00, 0x00, 0x00, 0x82, 0xFF, 0xFB, 0xFD, 
-    0x58, 0xFD, 0xA3, 0xFD, 0x3A, 0xFE, 0x43, 0xFF, 0xEB, 0xFE, 0xEF, 0xFD, 0x9B, 0xFC, 0xE2, 0xFA, 
-    0x4B, 0xFA, 0x71, 0xFA, 0x79, 0xFB, 0x2A, 0xFC, 0x47, 0xFB, 0x69, 0xF9, 0x86, 0xF8, 0xE2, 0xF7, 
-    0x79, 0xF8, 0xF7, 0xF8, 0xB8, 0xF8, 0xF7, 0xF8, 0xDE, 0xF8, 0x93, 0xF8, 0xEB, 0xF8, 0x54, 0xF8, 
-    0x86, 0xF8, 0xE2, 0xF7, 0x19, 0xF7, 0x21, 0xF8, 0x97, 0xFA, 0x28, 0x05, 0xFA, 0x0F, 0x28, 0x11, 
-    0x5F, 0x07, 0x8E, 0xF9, 0x2E, 0xFB, 0xAF, 0x09, 0x17, 0x1B, 0xDC, 0x22, 0x88, 0x1E, 0x56, 0x18, 
-    0x9E, 0x10, 0xB3, 0x0B, 0xB7, 0x0D, 0x74, 0x17, 0xD0, 0x22, 0x49, 0x24, 0xD8, 0x1D, 0x99, 0x14, 
-    0xE5, 0x11, 0xF6, 0x10, 0x80, 0x0E, 0x9E, 0x0A, 0x70, 0x09, 0x0B, 0x0C, 0x46, 0x0D, 0x31, 0x09, 
-    0x9A, 0x02, 0x0C, 0xFA, 0xA3, 0xF4, 0x54, 0xF2, 0xEB, 0xF2, 0x32, 0xF7, 0xE6, 0xF9, 0x08, 0xF8, 
-    0xC1, 0xF0, 0x4B, 0xE8, 0x32, 0xE5, 0x75, 0xE7, 0x6D, 0xEC, 0x75, 0xF0, 0xBD, 0xF1, 0x4B, 0xF1, 
-    0xDE, 0xEF, 0xEF, 0xEE, 0x93, 0xEF, 0xDE, 0xF2, 0x32, 0xF7, 0xA3, 0xFA, 0x25, 0xFD, 0x36, 0xFF, 
-    0x46, 0x01, 0xBF, 0x02, 0xCC, 0x02, 0x18, 0x03, 0x85, 0x04, 0x67, 0x08, 0x39, 0x0D, 0x20, 0x10, 
-    0xED, 0x0F, 0x6B, 0x0D, 0x78, 0x0A, 0x13, 0x0A, 0xE1, 0x0C, 0xED, 0x0F, 0xBF, 0x11, 0x46, 0x10, 
-    0x41, 0x0E, 0xC4, 0x0A, 0x74, 0x08, 0x31, 0x06, 0x80, 0x05, 0xFE, 0x05, 0x0B, 0x06, 0x4E, 0x05, 
-    0x1C, 0x02, 0xC5, 0xFE, 0x43, 0xFC, 0x43, 0xF9, 0x86, 0xF8, 0xFB, 0xF7, 0x10, 0xF9, 0x0C, 0xFA, 
-    0xEB, 0xF8, 0x5C, 0xF6, 0x4F, 0xF3, 0xFC, 0xF1, 0xB8, 0xF2, 0x3F, 0xF4, 0x6D, 0xF5, 0x82, 0xF6, 
-    0x69, 0xF6, 0x1D, 0xF6, 0x60, 0xF5, 0xC9, 0xF4, 0x47, 0xF5, 0x64, 0xF7, 0x75, 0xF9, 0x92, 0xFB, 
-    0x36, 0xFC, 0x5C, 0xFC, 0xB8, 0xFB, 0x3A, 0xFB, 0xD1, 0xFB, 0xBC, 0xFD, 0x0B, 0x00, 0x35, 0x02, 
-    0x1C, 0x02, 0xBB, 0x00, 0x4F, 0xFF, 0x1D, 0xFF, 0x57, 0x00, 0x85, 0x01, 0x4E, 0x02, 0x67, 0x02, 
-    0xD0, 0x01, 0x07, 0x01, 0xC1, 0xFF, 0x2E, 0xFE, 0x7D, 0xFD, 0x71, 0xFD, 0xC9, 0xFD, 0x7D, 0xFD, 
-    0x4B, 0xFD, 0x10, 0xFC, 0xFB, 0xFA, 0x5C, 0xF9, 0x79, 0xF8, 0x86, 0xF8, 0xD1, 0xF8, 0xC1, 0xF9, 
-    0xDE, 0xF8, 0x7E, 0xF7, 0x75, 0xF6, 0x9F, 0xF5, 0xCD, 0xF6, 0xA3, 0xF7, 0x69, 0xF9, 0x2A, 0xF9, 
-    0x60, 0xF8, 0x25, 0xF7, 0xB4, 0xF6, 0x93, 0xF8, 0xF3, 0xF9, 0x54, 0xFB, 0xD6, 0xFA, 0x3F, 0xFA, 
-    0x9F, 0xFB, 0x4A, 0x00, 0x2C, 0x0D, 0xE9, 0x13, 0x67, 0x11, 0xDD, 0x04, 0x00, 0xFD, 0x8D, 0x05, 
-    0x4A, 0x15, 0x78, 0x22, 0x1B, 0x23, 0x9D, 0x1C, 0xAA, 0x16, 0xE1, 0x0F, 0xC3, 0x0D, 0x95, 0x12, 
-    0xDC, 0x1C, 0x5A, 0x23, 0x34, 0x20, 0x35, 0x17, 0xE1, 0x0F, 0x4E, 0x0E, 0x63, 0x0C, 0xAF, 0x09, 
-    0x31, 0x06, 0x4A, 0x06, 0xF6, 0x07, 0x4A, 0x06, 0x78, 0x01, 0xBC, 0xFA, 0xDA, 0xF3, 0xC1, 0xF0, 
-    0x7A, 0xEF, 0x7E, 0xF1, 0x60, 0xF5, 0xC1, 0xF6, 0x00, 0xF4, 0xD2, 0xEC, 0x04, 0xE7, 0xB9, 0xE6, 
-    0xCE, 0xEA, 0x36, 0xF0, 0xE7, 0xF3, 0xA3, 0xF4, 0x64, 0xF4, 0x9B, 0xF3, 0x82, 0xF3, 0x86, 0xF5, 
-    0x8E, 0xF9, 0x08, 0xFE, 0x46, 0x01, 0x18, 0x03, 0x5F, 0x04, 0x31, 0x06, 0x46, 0x07, 0xB7, 0x07, 
-    0xD0, 0x07, 0x24, 0x09, 0x63, 0x0C, 0x89, 0x0F, 0xAA, 0x10, 0x17, 0x0F, 0x31, 0x0C, 0x39, 0x0A, 
-    0x2C, 0x0A, 0x4A, 0x0C, 0x91, 0x0D, 0xB7, 0x0D, 0x0F, 0x0B, 0xBF, 0x08, 0x18, 0x06, 0x20, 0x04, 
-    0xE5, 0x02, 0xEE, 0x00, 0xD5, 0x00, 0x0B, 0x00, 0x1D, 0xFF, 0xA3, 0xFD, 0x15, 0xFB, 0x36, 0xF9, 
-    0x82, 0xF6, 0x97, 0xF4, 0xFC, 0xF4, 0xA8, 0xF6, 0xEB, 0xF8, 0xDE, 0xF8, 0xC1, 0xF6, 0x64, 0xF4, 
-    0xDA, 0xF3, 0x8A, 0xF4, 0x4F, 0xF6, 0xBD, 0xF7, 0xDE, 0xF8, 0x82, 0xF9, 0x5C, 0xF9, 0xD1, 0xF8, 
-    0xC5, 0xF8, 0x43, 0xF9, 0x8A, 0xFA, 0x5C, 0xFC, 0x71, 0xFD, 0xF7, 0xFE, 0xEB, 0xFE, 0x47, 0xFE, 
-    0xD6, 0xFD, 0x4B, 0xFD, 0xAC, 0xFE, 0x4A, 0x00, 0x39, 0x01, 0xEE, 0x00, 0x68, 0xFF, 0x92, 0xFE, 
-    0x86, 0xFE, 0xF7, 0xFE, 0x75, 0xFF, 0xB4, 0xFF, 0xCD, 0xFF, 0x43, 0xFF, 0x92, 0xFE, 0x00, 0xFD, 
-    0x43, 0xFC, 0xD1, 0xFB, 0x04, 0xFC, 0x1D, 0xFC, 0x10, 0xFC, 0x9F, 0xFB, 0x2E, 0xFB, 0x00, 0xFA, 
-    0xEB, 0xF8, 0x86, 0xF8, 0xF7, 0xF8, 0x19, 0xFA, 0x21, 0xFB, 0x32, 0xFA, 0xAC, 0xF8, 0x7E, 0xF7, 
-    0x8A, 0xF7, 0x1D, 0xF9, 0x7E, 0xFA, 0xAC, 0xFB, 0xAC, 0xFB, 0x82, 0xF9, 0xD1, 0xF8, 0x2A, 0xF9, 
-    0x97, 0xFA, 0x8E, 0xFC, 0x68, 0xFC, 0x92, 0xFB, 0x54, 0xFB, 0x9F, 0xFB, 0x5C, 0xFF, 0x70, 0x09, 
-    0x89, 0x12, 0x45, 0x13, 0xD9, 0x08, 0xD6, 0xFD, 0xF6, 0x01, 0xA6, 0x0E, 0xE9, 0x1C, 0x06, 0x22, 
-    0xA6, 0x1D, 0x39, 0x19, 0x24, 0x12, 0xFE, 0x0B, 0x5F, 0x0D, 0x06, 0x16, 0x67, 0x20, 0x13, 0x22, 
-    0x8D, 0x1A, 0xB3, 0x11, 0x52, 0x0D, 0xF6, 0x0A, 0x70, 0x09, 0x4A, 0x06, 0xFE, 0x05, 0x9A, 0x08, 
-    0xC4, 0x07, 0xFA, 0x03, 0xA3, 0xFD, 0xDA, 0xF6, 0xEB, 0xF2, 0x0C, 0xF1, 0xB0, 0xF1, 0x6D, 0xF5, 
-    0x54, 0xF8, 0xFB, 0xF7, 0x60, 0xF2, 0x3F, 0xEB, 0x71, 0xE8, 0xF3, 0xEA, 0xF7, 0xEF, 0xFC, 0xF4, 
-    0x4B, 0xF7, 0x8A, 0xF7, 0x5C, 0xF6, 0x97, 0xF4, 0x47, 0xF5, 0xF7, 0xF8, 0x3A, 0xFE, 0xDD, 0x01, 
-    0x18, 0x03, 0x7C, 0x03, 0xE9, 0x04, 0x7C, 0x06, 0xE1, 0x06, 0xAF, 0x06, 0xFA, 0x06, 0x24, 0x09, 
-    0x17, 0x0C, 0x85, 0x0D, 0x13, 0x0D, 0xDD, 0x0A, 0x9A, 0x08, 0x20, 0x07, 0x6B, 0x07, 0xFE, 0x08, 
-    0x39, 0x0A, 0x24, 0x09, 0x4A, 0x06, 0xD4, 0x03, 0x5F, 0x01, 0xFA, 0x00, 0xDA, 0xFF, 0x1D, 0xFF, 
-    0xDE, 0xFE, 0x2E, 0xFE, 0x7D, 0xFD, 0xD1, 0xFB, 0xE6, 0xF9, 0x9F, 0xF8, 0x19, 0xF7, 0xCD, 0xF6, 
-    0xFB, 0xF7, 0x82, 0xF9, 0x7E, 0xFA, 0x32, 0xFA, 0xC9, 0xF7, 0x8E, 0xF6, 0x8E, 0xF6, 0xB0, 0xF7, 
-    0x82, 0xF9, 0x64, 0xFA, 0xEF, 0xFA, 0xFB, 0xFA, 0x3F, 0xFA, 0xCD, 0xF9, 0xC1, 0xF9, 0x64, 0xFA, 
-    0x68, 0xFC, 0x58, 0xFD, 0xD6, 0xFD, 0x8A, 0xFD, 0xE6, 0xFC, 0xCD, 0xFC, 0xCD, 0xFC, 0x71, 0xFD, 
-    0x15, 0xFE, 0x79, 0xFE, 0x6D, 0xFE, 0x21, 0xFE, 0x15, 0xFE, 0x08, 0xFE, 0xE2, 0xFD, 0x97, 0xFD, 
-    0xBC, 0xFD, 0x92, 0xFE, 0x4F, 0xFF, 0x82, 0xFF, 0x86, 0xFE, 0x3F, 0xFD, 0x43, 0xFC, 0x04, 0xFC, 
-    0x68, 0xFC, 0x64, 0xFD, 0xE2, 0xFD, 0x2E, 0xFE, 0x00, 0xFD, 0x60, 0xFB, 0xC1, 0xF9, 0x9B, 0xF9, 
-    0x97, 0xFA, 0xF7, 0xFB, 0x4F, 0xFC, 0x08, 0xFB, 0xCD, 0xF9, 0xB8, 0xF8, 0x4F, 0xF9, 0x00, 0xFA, 
-    0xDA, 0xF9, 0xA7, 0xF9, 0x4F, 0xF9, 0x69, 0xF9, 0xC1, 0xF9, 0xC1, 0xF9, 0x32, 0xFA, 0x71, 0xFA, 
-    0x00, 0xFA, 0x9B, 0xF9, 0xB4, 0xF9, 0x7E, 0xFA, 0x32, 0xFD, 0xAF, 0x03, 0x1C, 0x0E, 0xD8, 0x11, 
-    0x9E, 0x0D, 0x91, 0x01, 0x36, 0xFF, 0x41, 0x08, 0x20, 0x16, 0xA6, 0x20, 0xCC, 0x20, 0x5A, 0x1D, 
-    0xC3, 0x16, 0x74, 0x0E, 0xF2, 0x0B, 0x3D, 0x12, 0x49, 0x1E, 0x6F, 0x24, 0x4E, 0x20, 0x13, 0x16, 
-    0xCC, 0x0E, 0xA6, 0x0B, 0x07, 0x0A, 0x31, 0x09, 0x39, 0x07, 0xBF, 0x08, 0x4E, 0x08, 0xE9, 0x04, 
-    0x68, 0xFF, 0xD1, 0xF8, 0x0C, 0xF4, 0xE2, 0xF1, 0xC1, 0xF0, 0x2E, 0xF2, 0x3A, 0xF5, 0xB4, 0xF6, 
-    0xC9, 0xF4, 0xE7, 0xED, 0xB0, 0xE8, 0x71, 0xE8, 0x9F, 0xEC, 0xB8, 0xF2, 0x9B, 0xF6, 0x7E, 0xF7, 
-    0x0C, 0xF7, 0xAC, 0xF5, 0x2A, 0xF6, 0xC5, 0xF8, 0x71, 0xFD, 0x5F, 0x01, 0x89, 0x03, 0xAA, 0x04, 
-    0xFE, 0x05, 0x85, 0x07, 0x35, 0x08, 0x67, 0x08, 0x4E, 0x08, 0xFE, 0x08, 0x4E, 0x0B, 0xBB, 0x0C, 
-    0xB7, 0x0D, 0xBB, 0x0C, 0x39, 0x0A, 0xE9, 0x07, 0x4A, 0x06, 0x46, 0x07, 0x5B, 0x08, 0x28, 0x08, 
-    0x20, 0x07, 0xD0, 0x04, 0x13, 0x01, 0x36, 0xFF, 0x97, 0xFD, 0x53, 0xFE, 0x60, 0xFE, 0x71, 0xFD, 
-    0xB8, 0xFB, 0x4F, 0xF9, 0x2E, 0xF8, 0x54, 0xF8, 0xB0, 0xF7, 0x71, 0xF7, 0x25, 0xF7, 0x4B, 0xF7, 
-    0x08, 0xF8, 0x36, 0xF9, 0xEB, 0xF8, 0x86, 0xF8, 0x97, 0xF7, 0x97, 0xF7, 0x60, 0xF8, 0x36, 0xF9, 
-    0x54, 0xFB, 0x68, 0xFC, 0x43, 0xFC, 0xB8, 0xFB, 0xA3, 0xFA, 0xEF, 0xFA, 0x82, 0xFC, 0x47, 0xFE, 
-    0x68, 0xFF, 0x75, 0xFF, 0xD1, 0xFE, 0x47, 0xFE, 0x2E, 0xFE, 0x86, 0xFE, 0x04, 0xFF, 0x29, 0xFF, 
-    0x75, 0xFF, 0xB4, 0xFF, 0x10, 0xFF, 0xAC, 0xFE, 0x21, 0xFE, 0xD6, 0xFD, 0x53, 0xFE, 0x79, 0xFE, 
-    0xAC, 0xFE, 0x3A, 0xFE, 0xE2, 0xFD, 0x19, 0xFD, 0x04, 0xFC, 0x54, 0xFB, 0x15, 0xFB, 0x92, 0xFB, 
-    0x68, 0xFC, 0xA7, 0xFC, 0x36, 0xFC, 0x8A, 0xFA, 0x2A, 0xF9, 0x54, 0xF8, 0x4F, 0xF9, 0xFB, 0xFA, 
-    0xEB, 0xFB, 0x3A, 0xFB, 0x4F, 0xF9, 0x3A, 0xF8, 0x21, 0xF8, 0x10, 0xF9, 0xF3, 0xF9, 0xFB, 0xFA, 
-    0x7E, 0xFA, 0xF3, 0xF9, 0xDE, 0xF8, 0xB8, 0xF8, 0x7E, 0xFA, 0x47, 0xFB, 0xB8, 0xFB, 0x8A, 0xFA, 
-    0x75, 0xF9, 0xA3, 0xFA, 0xF3, 0xFC, 0x2D, 0x07, 0x35, 0x11, 0x9E, 0x13, 0x17, 0x0C, 0x29, 0xFF, 
-    0x00, 0x00, 0x28, 0x0B, 0xFE, 0x1A, 0x8D, 0x23, 0x88, 0x21, 0x2C, 0x1C, 0xD0, 0x13, 0x89, 0x0C, 
-    0x56, 0x0C, 0x6F, 0x15, 0xFE, 0x20, 0x6F, 0x24, 0xA6, 0x1D, 0xE5, 0x11, 0x9A, 0x0B, 0x70, 0x09, 
-    0x0B, 0x09, 0x80, 0x08, 0xBB, 0x06, 0x03, 0x08, 0x63, 0x06, 0xD0, 0x01, 0x36, 0xFC, 0x04, 0xF6, 
-    0xEF, 0xF1, 0x82, 0xF0, 0x7A, 0xEF, 0x54, 0xF2, 0x47, 0xF5, 0xDA, 0xF6, 0x4F, 0xF3, 0x04, 0xED, 
-    0x21, 0xE9, 0xDA, 0xEA, 0xC1, 0xF0, 0x3F, 0xF7, 0x7E, 0xFA, 0xEF, 0xFA, 0xCD, 0xF9, 0x1D, 0xF9, 
-    0x7E, 0xFA, 0x08, 0xFE, 0xFE, 0x02, 0x18, 0x06, 0x78, 0x07, 0x13, 0x07, 0x2D, 0x07, 0x85, 0x07, 
-    0x9E, 0x07, 0x20, 0x07, 0x63, 0x06, 0x89, 0x06, 0x6B, 0x07, 0x8D, 0x08, 0x67, 0x08, 0x31, 0x06, 
-    0x24, 0x03, 0xF3, 0xFF, 0xF3, 0xFF, 0x5F, 0x01, 0x31, 0x03, 0x31, 0x03, 0x24, 0x00, 0xC9, 0xFD, 
-    0xDE, 0xFB, 0xF7, 0xFB, 0x3F, 0xFD, 0x04, 0xFF, 0x18, 0x00, 0x46, 0x01, 0xC5, 0xFE, 0x25, 0xFD, 
-    0x43, 0xFC, 0x25, 0xFD, 0xCD, 0xFF, 0x31, 0x00, 0xE1, 0x00, 0x5F, 0x01, 0x18, 0x00, 0x9B, 0xFF, 
-    0xCD, 0xFC, 0xDE, 0xFB, 0x19, 0xFD, 0x60, 0xFE, 0xF7, 0xFE, 0xA3, 0xFD, 0x3A, 0xFB, 0x8E, 0xF9, 
-    0x93, 0xF8, 0x08, 0xF8, 0x2A, 0xF9, 0xCD, 0xF9, 0xEF, 0xFA, 0xC9, 0xFA, 0x9F, 0xF8, 0xB0, 0xF7, 
-    0x8A, 0xF7, 0xAC, 0xF8, 0xBC, 0xFA, 0x6D, 0xFB, 0x9B, 0xFC, 0x9B, 0xFC, 0x8E, 0xFC, 0x75, 0xFC, 
-    0x82, 0xFC, 0x71, 0xFD, 0xD1, 0xFE, 0x18, 0x00, 0xD5, 0x00, 0x13, 0x01, 0xD5, 0x00, 0x18, 0x00, 
-    0x75, 0xFF, 0x10, 0xFF, 0x8E, 0xFF, 0xB4, 0xFF, 0xC1, 0xFF, 0xB8, 0xFE, 0x7D, 0xFD, 0x9B, 0xFC, 
-    0xD1, 0xFB, 0x08, 0xFB, 0x9B, 0xF9, 0x36, 0xF9, 0x10, 0xF9, 0x1D, 0xF9, 0x8E, 0xF9, 0x3A, 0xF8, 
-    0x7E, 0xF7, 0xC1, 0xF6, 0xCD, 0xF6, 0xD6, 0xF7, 0xC9, 0xF7, 0xEB, 0xF8, 0xB8, 0xF8, 0x86, 0xF8, 
-    0xDE, 0xF8, 0xD1, 0xF8, 0xE2, 0xFA, 0x43, 0xFC, 0xB0, 0xFD, 0x9B, 0xFC, 0x15, 0xFB, 0xF3, 0xF9, 
-    0xBC, 0xFA, 0xE6, 0xFC, 0xD5, 0x00, 0x8D, 0x08, 0x4A, 0x12, 0x80, 0x14, 0x9A, 0x0E, 0xA2, 0x03, 
-    0x31, 0x03, 0x3D, 0x0C, 0x91, 0x19, 0x17, 0x21, 0x67, 0x20, 0x67, 0x1A, 0x31, 0x12, 0x7C, 0x09, 
-    0x78, 0x07, 0xF6, 0x0D, 0x95, 0x18, 0xFA, 0x1B, 0x9E, 0x16, 0xAF, 0x0C, 0xD9, 0x05, 0x3D, 0x03, 
-    0x5B, 0x02, 0x4E, 0x02, 0xD9, 0x02, 0x5B, 0x05, 0x18, 0x06, 0xE1, 0x03, 0xA7, 0xFF, 0x43, 0xFC, 
-    0xCD, 0xF9, 0xB4, 0xF9, 0x64, 0xFA, 0x64, 0xFD, 0x46, 0x01, 0x31, 0x03, 0x20, 0x01, 0x36, 0xFC, 
-    0x79, 0xF8, 0xC5, 0xF8, 0x1D, 0xFC, 0x0B, 0x00, 0xCC, 0x02, 0xA6, 0x02, 0xAF, 0x00, 0xE2, 0xFD, 
-    0xB8, 0xFB, 0xAC, 0xFB, 0x71, 0xFD, 0x1D, 0xFF, 0x82, 0xFF, 0x92, 0xFE, 0x19, 0xFD, 0xAC, 0xFB, 
-    0x00, 0xFA, 0x86, 0xF8, 0x15, 0xF8, 0xEB, 0xF8, 0x86, 0xFB, 0x7D, 0xFD, 0xBC, 0xFD, 0x82, 0xFC, 
-    0xE2, 0xFA, 0x25, 0xFA, 0xD1, 0xFB, 0xF7, 0xFE, 0x74, 0x02, 0xE1, 0x03, 0x0B, 0x03, 0x5F, 0x01, 
-    0x2D, 0x01, 0x9A, 0x02, 0xDD, 0x04, 0xF2, 0x05, 0xA2, 0x06, 0xBB, 0x06, 0xAF, 0x06, 0xE5, 0x05, 
-    0xC4, 0x04, 0xA2, 0x03, 0xF6, 0x01, 0x20, 0x01, 0xAF, 0x00, 0x52, 0x01, 0x07, 0x01, 0xEB, 0xFE, 
-    0x6D, 0xFB, 0xAC, 0xF8, 0xD6, 0xF7, 0xF7, 0xF8, 0x58, 0xFA, 0x97, 0xFA, 0xCD, 0xF9, 0xFB, 0xF7, 
-    0x5C, 0xF6, 0xD2, 0xF5, 0xDA, 0xF6, 0x9B, 0xF9, 0xD1, 0xFB, 0x19, 0xFD, 0x0C, 0xFD, 0x43, 0xFC, 
-    0xF7, 0xFB, 0xC1, 0xFC, 0xE2, 0xFD, 0x43, 0xFF, 0xFA, 0x00, 0x1C, 0x02, 0x8D, 0x02, 0x78, 0x01, 
-    0x24, 0x00, 0x8E, 0xFF, 0x82, 0xFF, 0x96, 0x00, 0x78, 0x01, 0x2D, 0x01, 0xC8, 0x00, 0xD1, 0xFE, 
-    0xF3, 0xFC, 0x54, 0xFB, 0xE2, 0xFA, 0xB8, 0xFB, 0x2A, 0xFC, 0x04, 0xFC, 0xD6, 0xFA, 0x5C, 0xF9, 
-    0x9F, 0xF8, 0xB0, 0xF7, 0x00, 0xF7, 0x3F, 0xF7, 0x21, 0xF8, 0x10, 0xF9, 0x00, 0xFA, 0x2A, 0xF9, 
-    0x93, 0xF8, 0xB0, 0xF7, 0x00, 0xF7, 0xEF, 0xF7, 0xAC, 0xF8, 0x47, 0xFB, 0x0C, 0xFD, 0x36, 0xFC, 
-    0x60, 0xFB, 0xB4, 0xF9, 0x00, 0xFA, 0xD1, 0xFB, 0x4B, 0xFD, 0x21, 0xFE, 0x3F, 0xFD, 0xAC, 0xFB, 
-    0x3A, 0xFB, 0x3A, 0xFB, 0x36, 0xFC, 0x79, 0xFE, 0xD9, 0x02, 0xC8, 0x0C, 0xED, 0x12, 0x5B, 0x11, 
-    0x7C, 0x09, 0x5F, 0x04, 0x7C, 0x09, 0x52, 0x13, 0x6B, 0x1C, 0x52, 0x1F, 0x39, 0x1C, 0x6B, 0x16, 
-    0x85, 0x0D, 0x4E, 0x08, 0xAA, 0x0A, 0xDD, 0x13, 0xE9, 0x19, 0x3D, 0x18, 0xFA, 0x0F, 0x85, 0x07, 
-    0xFE, 0x02, 0x20, 0x01, 0xAB, 0x01, 0x4E, 0x02, 0x39, 0x04, 0xE9, 0x04, 0x8D, 0x02, 0x92, 0xFE, 
-    0x86, 0xFB, 0x75, 0xF9, 0x43, 0xF9, 0x19, 0xFA, 0x04, 0xFC, 0x43, 0xFF, 0x52, 0x01, 0x52, 0x01, 
-    0xE2, 0xFD, 0xC9, 0xFA, 0xDA, 0xF9, 0x43, 0xFC, 0xB4, 0xFF, 0x7C, 0x03, 0x6C, 0x04, 0x4A, 0x03, 
-    0x63, 0x00, 0xA3, 0xFD, 0x9B, 0xFC, 0xD6, 0xFD, 0xDA, 0xFF, 0xE1, 0x00, 0x18, 0x00, 0x60, 0xFE, 
-    0x36, 0xFC, 0x64, 0xFA, 0x10, 0xF9, 0x9F, 0xF8, 0x43, 0xF9, 0xE2, 0xFA, 0x82, 0xFC, 0x75, 0xFC, 
-    0x79, 0xFB, 0x25, 0xFA, 0x5C, 0xF9, 0x7E, 0xFA, 0x9B, 0xFC, 0x4F, 0xFF, 0x2D, 0x01, 0xFA, 0x00, 
-    0x63, 0x00, 0x82, 0xFF, 0x82, 0xFF, 0x20, 0x01, 0x4E, 0x02, 0x46, 0x04, 0x74, 0x05, 0xF6, 0x04, 
-    0xBB, 0x03, 0x91, 0x01, 0x0B, 0x00, 0x9B, 0xFF, 0x10, 0xFF, 0x82, 0xFF, 0xE6, 0xFF, 0xE6, 0xFF, 
-    0xC5, 0xFE, 0xEB, 0xFB, 0x1D, 0xF9, 0xAC, 0xF8, 0xCD, 0xF9, 0x82, 0xFC, 0x71, 0xFD, 0xE6, 0xFC, 
-    0xB8, 0xFB, 0x58, 0xFA, 0x32, 0xFA, 0xEF, 0xFA, 0xE6, 0xFC, 0x4F, 0xFF, 0x89, 0x00, 0x89, 0x00, 
-    0x9B, 0xFF, 0xEB, 0xFE, 0x75, 0xFF, 0x00, 0x00, 0xD5, 0x00, 0x2D, 0x01, 0xE9, 0x01, 0x03, 0x02, 
-    0x2D, 0x01, 0xCD, 0xFF, 0x60, 0xFE, 0xE2, 0xFD, 0xD6, 0xFD, 0xA3, 0xFD, 0x58, 0xFD, 0x5C, 0xFC, 
-    0x79, 0xFB, 0xC1, 0xF9, 0x93, 0xF8, 0x08, 0xF8, 0x47, 0xF8, 0x36, 0xF9, 0x36, 0xF9, 0x6D, 0xF8, 
-    0x64, 0xF7, 0xF3, 0xF6, 0x25, 0xF7, 0xB0, 0xF7, 0xC9, 0xF7, 0x93, 0xF8, 0x2A, 0xF9, 0x19, 0xFA, 
-    0x60, 0xFB, 0x47, 0xFB, 0x21, 0xFB, 0x0C, 0xFA, 0x25, 0xFA, 0x21, 0xFB, 0x0C, 0xFD, 0x36, 0xFF, 
-    0xDA, 0xFF, 0x04, 0xFF, 0x9B, 0xFC, 0x97, 0xFA, 0x64, 0xFA, 0x10, 0xFC, 0x43, 0xFF, 0x00, 0x00, 
-    0x43, 0xFF, 0x04, 0xFC, 0x3F, 0xFA, 0x43, 0xF9, 0xEF, 0xFA, 0x57, 0x00, 0x8D, 0x0B, 0x95, 0x15, 
-    0xD4, 0x15, 0x2C, 0x0D, 0xFA, 0x03, 0xE9, 0x04, 0xFE, 0x0E, 0xB7, 0x19, 0x67, 0x20, 0xAA, 0x1F, 
-    0xE9, 0x19, 0xB7, 0x10, 0x5F, 0x07, 0x31, 0x06, 0x5F, 0x0D, 0x56, 0x15, 0xE9, 0x16, 0x35, 0x11, 
-    0x74, 0x08, 0x42, 0x02, 0x92, 0xFE, 0x25, 0xFD, 0x64, 0xFD, 0x29, 0xFF, 0x85, 0x01, 0xB7, 0x01, 
-    0xB8, 0xFE, 0x5C, 0xFC, 0x32, 0xFA, 0x75, 0xF9, 0xDA, 0xF9, 0x2E, 0xFB, 0x86, 0xFE, 0xF2, 0x02, 
-    0x35, 0x05, 0xC8, 0x03, 0x57, 0x00, 0xFB, 0xFD, 0xF7, 0xFE, 0xAB, 0x01, 0x1C, 0x05, 0x46, 0x07, 
-    0x39, 0x07, 0x0F, 0x05, 0xF6, 0x01, 0x10, 0xFF, 0x08, 0xFE, 0x36, 0xFF, 0x18, 0x00, 0xCD, 0xFF, 
-    0x92, 0xFE, 0x2A, 0xFC, 0x19, 0xFA, 0x8A, 0xF7, 0xDE, 0xF5, 0x93, 0xF5, 0xDA, 0xF6, 0x4F, 0xF9, 
-    0x7E, 0xFA, 0xE6, 0xF9, 0xAC, 0xF8, 0xD6, 0xF7, 0x3A, 0xF8, 0xB0, 0xFA, 0x19, 0xFD, 0x82, 0xFF, 
-    0x70, 0x00, 0x63, 0x00, 0x0B, 0x00, 0xE6, 0xFF, 0xFA, 0x00, 0x4E, 0x02, 0xFE, 0x02, 0xAF, 0x03, 
-    0x89, 0x03, 0x5F, 0x04, 0x6C, 0x04, 0x78, 0x04, 0x1C, 0x02, 0x43, 0xFF, 0x7D, 0xFD, 0x32, 0xFD, 
-    0x75, 0xFF, 0x20, 0x01, 0xAB, 0x01, 0x68, 0xFF, 0x9F, 0xFB, 0xEB, 0xF8, 0x15, 0xF8, 0x97, 0xFA, 
-    0x92, 0xFE, 0x39, 0x01, 0xFA, 0x00, 0x79, 0xFE, 0xD1, 0xFB, 0x8A, 0xFA, 0x36, 0xFC, 0x10, 0xFF, 
-    0x0F, 0x02, 0x4A, 0x03, 0xF2, 0x02, 0x13, 0x01, 0x1D, 0xFF, 0xFB, 0xFD, 0x60, 0xFE, 0x5C, 0xFF, 
-    0x7C, 0x00, 0xEE, 0x00, 0x57, 0x00, 0xF7, 0xFE, 0x25, 0xFD, 0xBC, 0xFA, 0x2A, 0xF9, 0xD1, 0xF8, 
-    0xF3, 0xF9, 0x54, 0xFB, 0x04, 0xFC, 0x21, 0xFB, 0x9B, 0xF9, 0xC9, 0xF7, 0x8A, 0xF7, 0x6D, 0xF8, 
-    0x97, 0xFA, 0x5C, 0xFC, 0x19, 0xFD, 0x75, 0xFC, 0xF7, 0xFB, 0xEF, 0xFA, 0x08, 0xFB, 0x79, 0xFB, 
-    0x10, 0xFC, 0x3F, 0xFD, 0x3A, 0xFE, 0x29, 0xFF, 0xEB, 0xFE, 0xA7, 0xFC, 0x08, 0xFB, 0x5C, 0xF9, 
-    0x32, 0xFA, 0xB8, 0xFB, 0xF3, 0xFC, 0x0C, 0xFD, 0x2A, 0xFC, 0x2E, 0xFB, 0x4F, 0xF9, 0x9B, 0xF9, 
-    0x8E, 0xF9, 0xD6, 0xFA, 0x2E, 0xFB, 0x79, 0xFB, 0x79, 0xFB, 0xB8, 0xFB, 0xB4, 0xFC, 0x71, 0xFD, 
-    0xCD, 0xFF, 0x24, 0x06, 0x84, 0x10, 0x24, 0x15, 0xB7, 0x13, 0xB7, 0x0D, 0xD0, 0x0A, 0x07, 0x10, 
-    0x06, 0x16, 0x5A, 0x1D, 0x95, 0x1E, 0x20, 0x1C, 0x95, 0x15, 0x9A, 0x0B, 0x4A, 0x06, 0x03, 0x08, 
-    0xB3, 0x0E, 0xBF, 0x11, 0xED, 0x0F, 0xD0, 0x07, 0x7C, 0x00, 0xD1, 0xFB, 0xDA, 0xF9, 0xB0, 0xFA, 
-    0x68, 0xFC, 0x36, 0xFF, 0xA2, 0x00, 0xEB, 0xFE, 0x9B, 0xFC, 0x6D, 0xFB, 0xC9, 0xFA, 0xC1, 0xFC, 
-    0x79, 0xFE, 0x39, 0x01, 0xF6, 0x04, 0xAA, 0x07, 0xF6, 0x07, 0xE5, 0x05, 0x4A, 0x03, 0x42, 0x02, 
-    0x3D, 0x03, 0x03, 0x05, 0x2D, 0x07, 0x52, 0x07, 0x28, 0x05, 0xE9, 0x01, 0xFB, 0xFD, 0x6D, 0xFB, 
-    0x54, 0xFB, 0x86, 0xFB, 0xC5, 0xFB, 0x21, 0xFB, 0x1D, 0xF9, 0x0C, 0xF7, 0xEF, 0xF4, 0x69, 0xF3, 
-    0xC1, 0xF3, 0x71, 0xF4, 0xC1, 0xF6, 0xF7, 0xF8, 0x00, 0xFA, 0x00, 0xFA, 0x1D, 0xF9, 0xD1, 0xF8, 
-    0xB0, 0xFA, 0xE2, 0xFD, 0xD5, 0x00, 0x81, 0x02, 0x67, 0x02, 0x6C, 0x01, 0x63, 0x00, 0x89, 0x00, 
-    0x9E, 0x01, 0x96, 0x03, 0xFA, 0x03, 0x7C, 0x03, 0x4E, 0x02, 0x70, 0x00, 0x96, 0x00, 0xEE, 0x00, 
-    0xAB, 0x01, 0xF6, 0x01, 0x4A, 0x00, 0xA7, 0xFF, 0x79, 0xFE, 0x6D, 0xFE, 0x04, 0xFF, 0xCD, 0xFF, 
-    0x0B, 0x00, 0x18, 0x00, 0x10, 0xFF, 0x21, 0xFE, 0x3A, 0xFE, 0x1D, 0xFF, 0x2D, 0x01, 0x1C, 0x02, 
-    0x1C, 0x02, 0x2D, 0x01, 0x18, 0x00, 0xC1, 0xFF, 0x70, 0x00, 0xC8, 0x00, 0x20, 0x01, 0x70, 0x00, 
-    0xDA, 0xFF, 0x86, 0xFE, 0xEF, 0xFD, 0xE6, 0xFC, 0x8E, 0xFC, 0xB8, 0xFB, 0xC9, 0xFA, 0x00, 0xFA, 
-    0x4F, 0xF9, 0xEB, 0xF8, 0x9F, 0xF8, 0xFB, 0xF7, 0x8A, 0xF7, 0xC9, 0xF7, 0x54, 0xF8, 0xA7, 0xF9, 
-    0x19, 0xFA, 0x71, 0xFA, 0xE2, 0xFA, 0x2E, 0xFB, 0x2A, 0xFC, 0x58, 0xFD, 0x79, 0xFE, 0xD1, 0xFE, 
-    0x15, 0xFE, 0x58, 0xFD, 0x3F, 0xFD, 0x3A, 0xFE, 0xB8, 0xFE, 0x60, 0xFE, 0x19, 0xFD, 0x10, 0xFC, 
-    0x2E, 0xFB, 0x47, 0xFB, 0xAC, 0xFB, 0x2A, 0xFC, 0x68, 0xFC, 0x7E, 0xFA, 0xCD, 0xF9, 0x1D, 0xF9, 
-    0x19, 0xFA, 0xB8, 0xFB, 0x68, 0xFC, 0x8E, 0xFC, 0xB4, 0xFC, 0xC5, 0xFB, 0x10, 0xFC, 0x36, 0xFC, 
-    0x8E, 0xFC, 0xD1, 0xFE, 0x4F, 0xFF, 0x89, 0x00, 0x89, 0x00, 0xBB, 0x00, 0x31, 0x03, 0x91, 0x0A, 
-    0x41, 0x14, 0x0F, 0x17, 0x3D, 0x15, 0x3D, 0x0C, 0xE1, 0x09, 0x3D, 0x0C, 0xE5, 0x11, 0x28, 0x1A, 
-    0x28, 0x1A, 0x8D, 0x17, 0xC3, 0x0D, 0x67, 0x02, 0xE2, 0xFD, 0x96, 0x00, 0x35, 0x08, 0x4A, 0x0C, 
-    0x9A, 0x0B, 0xE1, 0x03, 0xD6, 0xFD, 0x2E, 0xF8, 0x08, 0xF8, 0x7E, 0xFA, 0xF7, 0xFE, 0x70, 0x03, 
-    0xE5, 0x05, 0x91, 0x04, 0x31, 0x03, 0xD0, 0x01, 0x6C, 0x01, 0x39, 0x04, 0x3D, 0x06, 0xA2, 0x09, 
-    0x89, 0x0C, 0x91, 0x0D, 0x0B, 0x0C, 0xE5, 0x08, 0x1C, 0x05, 0x96, 0x03, 0xCC, 0x02, 0x57, 0x03, 
-    0xC8, 0x03, 0xBF, 0x02, 0xCD, 0xFF, 0x1D, 0xFC, 0xFB, 0xF7, 0xAC, 0xF5, 0x47, 0xF5, 0xE2, 0xF4, 
-    0x3A, 0xF5, 0x3A, 0xF5, 0xB0, 0xF4, 0x3F, 0xF4, 0x1D, 0xF3, 0x2E, 0xF2, 0xAC, 0xF2, 0xF3, 0xF3, 
-    0x19, 0xF7, 0xE6, 0xF9, 0xB8, 0xFB, 0x4F, 0xFC, 0xEB, 0xFB, 0x9F, 0xFB, 0xB0, 0xFD, 0x70, 0x00, 
-    0xA2, 0x03, 0x42, 0x05, 0x85, 0x04, 0xFE, 0x02, 0xFA, 0x00, 0x7C, 0x00, 0x39, 0x01, 0x74, 0x02, 
-    0xFA, 0x03, 0x70, 0x03, 0xA6, 0x02, 0xEE, 0x00, 0x70, 0x00, 0xE6, 0xFF, 0xAF, 0x00, 0xB7, 0x01, 
-    0xB3, 0x02, 0x24, 0x03, 0xCC, 0x02, 0xDD, 0x01, 0x13, 0x01, 0xAF, 0x00, 0xAB, 0x01, 0x81, 0x02, 
-    0x57, 0x03, 0xD4, 0x03, 0x74, 0x02, 0xC8, 0x00, 0x9B, 0xFF, 0xF7, 0xFE, 0xC1, 0xFF, 0x4A, 0x00, 
-    0x31, 0x00, 0xEB, 0xFE, 0xE6, 0xFC, 0x79, 0xFB, 0xBC, 0xFA, 0x8A, 0xFA, 0xFB, 0xFA, 0x2E, 0xFB, 
-    0x71, 0xFA, 0xC1, 0xF9, 0x86, 0xF8, 0x97, 0xF7, 0x7E, 0xF7, 0xA3, 0xF7, 0x6D, 0xF8, 0xB4, 0xF9, 
-    0x0C, 0xFA, 0x54, 0xFB, 0xFB, 0xFA, 0x3A, 0xFB, 0x6D, 0xFB, 0x1D, 0xFC, 0xEF, 0xFD, 0x9B, 0xFF, 
-    0xA2, 0x00, 0xD5, 0x00, 0x7C, 0x00, 0x57, 0x00, 0x70, 0x00, 0x7C, 0x00, 0x4A, 0x00, 0x4A, 0x00, 
-    0xDA, 0xFF, 0x1D, 0xFF, 0x2E, 0xFE, 0x0C, 0xFD, 0x1D, 0xFC, 0x92, 0xFB, 0xBC, 0xFA, 0x15, 0xFB, 
-    0x8A, 0xFA, 0x79, 0xFB, 0xEF, 0xFA, 0xE6, 0xF9, 0xDE, 0xF8, 0x79, 0xF8, 0xC1, 0xF9, 0x86, 0xFB, 
-    0xE6, 0xFC, 0xC9, 0xFD, 0x3F, 0xFD, 0xA7, 0xFC, 0x4F, 0xFC, 0xB4, 0xFC, 0xF3, 0xFC, 0x60, 0xFE, 
-    0x92, 0xFE, 0xCD, 0xFF, 0x24, 0x00, 0xDA, 0xFF, 0x92, 0xFE, 0x5C, 0xFF, 0x78, 0x04, 0x46, 0x10, 
-    0xA2, 0x15, 0xA2, 0x15, 0x20, 0x0D, 0x20, 0x07, 0x0F, 0x08, 0x46, 0x0D, 0x0B, 0x15, 0xC3, 0x19, 
-    0xED, 0x18, 0xED, 0x12, 0xD4, 0x06, 0x1D, 0xFF, 0x92, 0xFE, 0xA2, 0x06, 0xA2, 0x0C, 0x4A, 0x0F, 
-    0x39, 0x0A, 0x96, 0x03, 0x3A, 0xFE, 0x3A, 0xFB, 0x4F, 0xFC, 0xCD, 0xFF, 0xE9, 0x04, 0xBF, 0x08, 
-    0xF2, 0x08, 0xAF, 0x06, 0x4E, 0x05, 0x7C, 0x03, 0xD0, 0x04, 0x80, 0x05, 0x9E, 0x07, 0x7C, 0x09, 
-    0xDD, 0x0A, 0x95, 0x09, 0xAF, 0x06, 0xD9, 0x02, 0xDA, 0xFF, 0xB0, 0xFD, 0x32, 0xFD, 0x25, 0xFD, 
-    0x64, 0xFD, 0xF7, 0xFB, 0x9B, 0xF9, 0x5C, 0xF6, 0x69, 0xF3, 0x9F, 0xF2, 0x86, 0xF2, 0xCD, 0xF3, 
-    0x2E, 0xF5, 0x36, 0xF6, 0x5C, 0xF6, 0xB8, 0xF5, 0xEF, 0xF4, 0x21, 0xF5, 0xDA, 0xF6, 0x0C, 0xFA, 
-    0x58, 0xFD, 0x36, 0xFF, 0x00, 0x00, 0x9B, 0xFF, 0x82, 0xFF, 0x70, 0x00, 0x5B, 0x02, 0x9E, 0x04, 
-    0x5B, 0x05, 0xE9, 0x04, 0x24, 0x03, 0x13, 0x01, 0x31, 0x00, 0xB4, 0xFF, 0x4A, 0x00, 0x57, 0x00, 
-    0x78, 0x01, 0x2D, 0x01, 0x7C, 0x00, 0xB4, 0xFF, 0x9F, 0xFE, 0xDE, 0xFE, 0x10, 0xFF, 0x96, 0x00, 
-    0xD9, 0x02, 0x46, 0x04, 0xE9, 0x04, 0x4A, 0x03, 0xFA, 0x00, 0xDA, 0xFF, 0x57, 0x00, 0x78, 0x01, 
-    0x0B, 0x03, 0x31, 0x03, 0xE9, 0x01, 0xC1, 0xFF, 0x82, 0xFC, 0x2E, 0xFB, 0x71, 0xFA, 0x9F, 0xFB, 
-    0x64, 0xFD, 0x2E, 0xFE, 0xF3, 0xFC, 0x54, 0xFB, 0xAC, 0xF8, 0x3F, 0xF7, 0xD6, 0xF7, 0x4F, 0xF9, 
-    0xDE, 0xFB, 0x58, 0xFD, 0x32, 0xFD, 0x1D, 0xFC, 0xA3, 0xFA, 0xF3, 0xF9, 0x54, 0xFB, 0xC1, 0xFC, 
-    0x82, 0xFF, 0x07, 0x01, 0x13, 0x01, 0xF3, 0xFF, 0x47, 0xFE, 0x4B, 0xFD, 0xA3, 0xFD, 0xDE, 0xFE, 
-    0x18, 0x00, 0xD5, 0x00, 0x7C, 0x00, 0x9B, 0xFF, 0x47, 0xFE, 0x00, 0xFD, 0x82, 0xFC, 0xCD, 0xFC, 
-    0x9B, 0xFC, 0xE6, 0xFC, 0xD1, 0xFB, 0x21, 0xFB, 0x58, 0xFA, 0x32, 0xFA, 0xDA, 0xF9, 0x0C, 0xFA, 
-    0x00, 0xFA, 0xBC, 0xFA, 0xC9, 0xFA, 0x2E, 0xFB, 0x21, 0xFB, 0x75, 0xFC, 0x64, 0xFD, 0x2E, 0xFE, 
-    0x15, 0xFE, 0xBC, 0xFD, 0xA3, 0xFD, 0x79, 0xFE, 0xDE, 0xFE, 0x00, 0x00, 0x8E, 0xFF, 0x04, 0xFF, 
-    0x92, 0xFE, 0x3F, 0xFD, 0x25, 0xFD, 0x71, 0xFD, 0xC9, 0xFD, 0x79, 0xFE, 0xFB, 0xFD, 0xF7, 0xFE, 
-    0x0B, 0x03, 0xA2, 0x0C, 0x20, 0x13, 0xF6, 0x13, 0x02, 0x0E, 0x1C, 0x08, 0xCC, 0x08, 0xD4, 0x0C, 
-    0x17, 0x15, 0xD0, 0x19, 0xD4, 0x18, 0x45, 0x13, 0xE9, 0x07, 0x63, 0x00, 0x75, 0xFF, 0xE5, 0x05, 
-    0xFE, 0x0B, 0x31, 0x0F, 0x1C, 0x0B, 0xF6, 0x04, 0x60, 0xFE, 0xE2, 0xFA, 0x79, 0xFB, 0x92, 0xFE, 
-    0xA2, 0x03, 0x85, 0x07, 0x0F, 0x08, 0xB3, 0x05, 0x39, 0x04, 0xDD, 0x01, 0xA6, 0x02, 0x31, 0x03, 
-    0x35, 0x05, 0x13, 0x07, 0xF2, 0x08, 0xB7, 0x07, 0x42, 0x05, 0xEE, 0x00, 0xE2, 0xFD, 0xDE, 0xFB, 
-    0x54, 0xFB, 0x4F, 0xFC, 0xC1, 0xFC, 0xDE, 0xFB, 0x8E, 0xF9, 0x69, 0xF6, 0xC1, 0xF3, 0x36, 0xF3, 
-    0x4B, 0xF4, 0x10, 0xF6, 0x2E, 0xF8, 0xA7, 0xF9, 0x0C, 0xFA, 0xB4, 0xF9, 0x6D, 0xF8, 0x93, 0xF8, 
-    0x69, 0xF9, 0x68, 0xFC, 0x82, 0xFF, 0xD0, 0x01, 0x03, 0x02, 0xEE, 0x00, 0x5C, 0xFF, 0x1D, 0xFF, 
-    0x70, 0x00, 0x8D, 0x02, 0x3D, 0x03, 0x31, 0x03, 0x52, 0x01, 0x82, 0xFF, 0xEF, 0xFD, 0xA3, 0xFD, 
-    0xA3, 0xFD, 0x60, 0xFE, 0xEF, 0xFD, 0x29, 0xFF, 0x43, 0xFF, 0xA7, 0xFF, 0x24, 0x00, 0x79, 0xFE, 
-    0xD1, 0xFE, 0xB8, 0xFE, 0x6C, 0x01, 0x52, 0x04, 0xA6, 0x05, 0x42, 0x05, 0xB3, 0x02, 0x3D, 0x00, 
-    0xF7, 0xFE, 0x82, 0xFF, 0x20, 0x01, 0xA6, 0x02, 0xBF, 0x02, 0xBB, 0x00, 0x64, 0xFD, 0x3F, 0xFA, 
-    0x5C, 0xF9, 0x3F, 0xFA, 0x5C, 0xFC, 0xFB, 0xFD, 0x53, 0xFE, 0x00, 0xFD, 0x08, 0xFB, 0xC1, 0xF9, 
-    0x36, 0xF9, 0xEF, 0xFA, 0x3F, 0xFD, 0x5C, 0xFF, 0x31, 0x00, 0x9B, 0xFF, 0x60, 0xFE, 0xB0, 0xFD, 
-    0xEF, 0xFD, 0x92, 0xFE, 0xCD, 0xFF, 0x24, 0x00, 0x63, 0x00, 0xCD, 0xFF, 0xD1, 0xFE, 0xE2, 0xFD, 
-    0x00, 0xFD, 0x19, 0xFD, 0x97, 0xFD, 0x2E, 0xFE, 0x79, 0xFE, 0x53, 0xFE, 0x64, 0xFD, 0x04, 0xFC, 
-    0xB0, 0xFA, 0x4B, 0xFA, 0xEF, 0xFA, 0xD1, 0xFB, 0xB4, 0xFC, 0x43, 0xFC, 0xD1, 0xFB, 0x15, 0xFB, 
-    0xA3, 0xFA, 0x71, 0xFA, 0x47, 0xFB, 0xE6, 0xFC, 0xB0, 0xFD, 0x6D, 0xFE, 0x21, 0xFE, 0x21, 0xFE, 
-    0x6D, 0xFE, 0x9F, 0xFE, 0xC5, 0xFE, 0x92, 0xFE, 0x5C, 0xFF, 0x00, 0x00, 0xC8, 0x00, 0xA2, 0x00, 
-    0x0B, 0x00, 0x82, 0xFF, 0xE2, 0xFD, 0x97, 0xFD, 0x7D, 0xFD, 0xA3, 0xFD, 0x75, 0xFF, 0x68, 0xFF, 
-    0x5C, 0xFF, 0xD6, 0xFD, 0x8E, 0xFC, 0x9B, 0xFC, 0x2D, 0x01, 0x35, 0x0B, 0x78, 0x13, 0x0B, 0x15, 
-    0x56, 0x0F, 0x5F, 0x07, 0x1C, 0x05, 0x03, 0x08, 0x70, 0x0F, 0xAE, 0x15, 0x45, 0x16, 0x6F, 0x12, 
-    0x28, 0x08, 0x0B, 0x00, 0x25, 0xFD, 0x39, 0x01, 0xAF, 0x06, 0xD4, 0x09, 0x9A, 0x08, 0x07, 0x04, 
-    0x18, 0x00, 0x8E, 0xFC, 0x4F, 0xFC, 0x71, 0xFD, 0xAB, 0x01, 0xF2, 0x05, 0xFE, 0x08, 0x4A, 0x09, 
-    0x31, 0x09, 0x2D, 0x07, 0x31, 0x06, 0x9A, 0x05, 0x4A, 0x06, 0xF6, 0x07, 0xEE, 0x09, 0xFA, 0x09, 
-    0xE9, 0x07, 0xD4, 0x03, 0x10, 0xFF, 0xAC, 0xFB, 0xA7, 0xF9, 0xF3, 0xF9, 0x64, 0xFA, 0x71, 0xFA, 
-    0x69, 0xF9, 0xEF, 0xF7, 0xB8, 0xF5, 0xA3, 0xF4, 0x58, 0xF4, 0x3A, 0xF5, 0x25, 0xF7, 0xB4, 0xF9, 
-    0x54, 0xFB, 0xEB, 0xFB, 0xD6, 0xFA, 0x9B, 0xF9, 0x75, 0xF9, 0x3A, 0xFB, 0x6D, 0xFE, 0x5F, 0x01, 
-    0x5B, 0x02, 0xE9, 0x01, 0x3D, 0x00, 0x75, 0xFF, 0xDA, 0xFF, 0xA2, 0x00, 0x46, 0x01, 0x13, 0x01, 
-    0x24, 0x00, 0xDE, 0xFE, 0x08, 0xFE, 0x32, 0xFD, 0xE6, 0xFC, 0x10, 0xFC, 0x5C, 0xFC, 0x82, 0xFC, 
-    0x92, 0xFE, 0x31, 0x00, 0x2D, 0x01, 0xE1, 0x00, 0x8E, 0xFF, 0x75, 0xFF, 0xD5, 0x00, 0xEE, 0x03, 
-    0x07, 0x07, 0x41, 0x08, 0x78, 0x07, 0x39, 0x04, 0xEE, 0x00, 0x29, 0xFF, 0x00, 0x00, 0x4E, 0x02, 
-    0x4A, 0x03, 0xF2, 0x02, 0xCD, 0xFF, 0x75, 0xFC, 0x00, 0xFA, 0x75, 0xF9, 0xC9, 0xFA, 0xF3, 0xFC, 
-    0xF7, 0xFE, 0xDE, 0xFE, 0x97, 0xFD, 0xC5, 0xFB, 0x71, 0xFA, 0x7E, 0xFA, 0x10, 0xFC, 0x3A, 0xFE, 
-    0xF3, 0xFF, 0xAF, 0x00, 0x4A, 0x00, 0xF7, 0xFE, 0x32, 0xFD, 0xCD, 0xFC, 0x9B, 0xFC, 0xFB, 0xFD, 
-    0x43, 0xFF, 0xDA, 0xFF, 0x4F, 0xFF, 0xA3, 0xFD, 0x5C, 0xFC, 0x92, 0xFB, 0x92, 0xFB, 0x2A, 0xFC, 
-    0x00, 0xFD, 0x71, 0xFD, 0x97, 0xFD, 0xB4, 0xFC, 0x10, 0xFC, 0xEB, 0xFB, 0x5C, 0xFC, 0x19, 0xFD, 
-    0xA3, 0xFD, 0xEF, 0xFD, 0x79, 0xFE, 0xC5, 0xFE, 0x29, 0xFF, 0xEB, 0xFE, 0xD1, 0xFE, 0x9F, 0xFE, 
-    0x21, 0xFE, 0x47, 0xFE, 0x60, 0xFE, 0x10, 0xFF, 0xCD, 0xFF, 0x68, 0xFF, 0x79, 0xFE, 0x64, 0xFD, 
-    0xCD, 0xFC, 0x58, 0xFD, 0xFB, 0xFD, 0xE2, 0xFD, 0x47, 0xFE, 0x58, 0xFD, 0x36, 0xFC, 0xAC, 0xFB, 
-    0xF3, 0xF9, 0x4B, 0xFA, 0xFB, 0xFA, 0x60, 0xFB, 0x75, 0xFC, 0x2A, 0xFC, 0xEB, 0xFB, 0xC9, 0xFA, 
-    0x4F, 0xFC, 0x78, 0x01, 0x24, 0x0C, 0x31, 0x12, 0xA2, 0x12, 0xED, 0x0C, 0xA2, 0x06, 0x91, 0x07, 
-    0xA6, 0x0B, 0xB3, 0x11, 0x78, 0x16, 0xB3, 0x14, 0x2C, 0x10, 0xA2, 0x06, 0x89, 0x00, 0x79, 0xFE, 
-    0xBB, 0x03, 0x2D, 0x07, 0x91, 0x0A, 0xD0, 0x07, 0x5F, 0x04, 0xEE, 0x00, 0x2E, 0xFE, 0xB0, 0xFD, 
-    0xC1, 0xFF, 0xBB, 0x03, 0x67, 0x08, 0x35, 0x0B, 0x52, 0x0A, 0x18, 0x09, 0x3D, 0x06, 0x8D, 0x05, 
-    0x5B, 0x05, 0x7C, 0x06, 0x78, 0x07, 0xCC, 0x08, 0xC8, 0x06, 0x52, 0x04, 0x18, 0x00, 0xF3, 0xFC, 
-    0xB0, 0xFA, 0xC1, 0xF9, 0x04, 0xF9, 0x36, 0xF9, 0xC5, 0xF8, 0xD1, 0xF8, 0x21, 0xF8, 0xB4, 0xF6, 
-    0x9F, 0xF5, 0x47, 0xF5, 0x82, 0xF6, 0x04, 0xF9, 0xAC, 0xFB, 0x32, 0xFD, 0x8A, 0xFD, 0x2A, 0xFC, 
-    0x6D, 0xFB, 0x2E, 0xFB, 0x00, 0xFD, 0x43, 0xFF, 0x9E, 0x01, 0x91, 0x01, 0x89, 0x00, 0xF7, 0xFE, 
-    0x15, 0xFE, 0x86, 0xFE, 0xC5, 0xFE, 0xAC, 0xFE, 0x2E, 0xFE, 0x8A, 0xFD, 0x64, 0xFD, 0x32, 0xFD, 
-    0x75, 0xFC, 0x5C, 0xFC, 0xDE, 0xFB, 0x5C, 0xFC, 0xF3, 0xFC, 0x92, 0xFE, 0xC8, 0x00, 0x28, 0x02, 
-    0x74, 0x02, 0xC4, 0x01, 0x96, 0x00, 0xC4, 0x01, 0x4A, 0x03, 0x5B, 0x05, 0xBB, 0x06, 0x7C, 0x06, 
-    0x9A, 0x05, 0x7C, 0x03, 0xE1, 0x00, 0xC1, 0xFF, 0x10, 0xFF, 0xCD, 0xFF, 0x07, 0x01, 0xC8, 0x00, 
-    0xCD, 0xFF, 0xA3, 0xFD, 0x86, 0xFB, 0x64, 0xFA, 0x97, 0xFA, 0x10, 0xFC, 0x92, 0xFE, 0x43, 0xFF, 
-    0x5C, 0xFF, 0x47, 0xFE, 0xC1, 0xFC, 0x00, 0xFD, 0x64, 0xFD, 0xC5, 0xFE, 0x7C, 0x00, 0xFA, 0x00, 
-    0x39, 0x01, 0x0B, 0x00, 0x9F, 0xFE, 0xEF, 0xFD, 0x71, 0xFD, 0xBC, 0xFD, 0x47, 0xFE, 0x53, 0xFE, 
-    0x6D, 0xFE, 0xFB, 0xFD, 0x3F, 0xFD, 0x4F, 0xFC, 0x9F, 0xFB, 0xDE, 0xFB, 0xE6, 0xFC, 0xC9, 0xFD, 
-    0x6D, 0xFE, 0x6D, 0xFE, 0x60, 0xFE, 0xC5, 0xFE, 0xB8, 0xFE, 0x29, 0xFF, 0x36, 0xFF, 0x5C, 0xFF, 
-    0x75, 0xFF, 0x36, 0xFF, 0x5C, 0xFF, 0x75, 0xFF, 0x29, 0xFF, 0x92, 0xFE, 0x64, 0xFD, 0xE6, 0xFC, 
-    0xF3, 0xFC, 0xBC, 0xFD, 0xEF, 0xFD, 0xBC, 0xFD, 0x8E, 0xFC, 0x9F, 0xFB, 0xE2, 0xFA, 0xC9, 0xFA, 
-    0xEF, 0xFA, 0x5C, 0xFC, 0x5C, 0xFC, 0x19, 0xFD, 0xDE, 0xFB, 0xEF, 0xFA, 0xDA, 0xF9, 0x0C, 0xFA, 
-    0x7E, 0xFA, 0xEB, 0xFB, 0x68, 0xFC, 0x64, 0xFD, 0x82, 0xFC, 0xD1, 0xFB, 0x64, 0xFA, 0xA3, 0xFD, 
-    0xA2, 0x03, 0x02, 0x0E, 0xDD, 0x13, 0xF2, 0x11, 0xBB, 0x0C, 0xBB, 0x06, 0x52, 0x07, 0x5B, 0x0B, 
-    0x41, 0x11, 0xF2, 0x14, 0x1C, 0x14, 0x5B, 0x0E, 0xFE, 0x05, 0x18, 0x00, 0x92, 0xFE, 0x7C, 0x03, 
-    0xFA, 0x06, 0x56, 0x09, 0x35, 0x08, 0x35, 0x05, 0x0F, 0x02, 0xF3, 0xFF, 0x47, 0xFE, 0x63, 0x00, 
-    0x6C, 0x04, 0x70, 0x09, 0x95, 0x0C, 0x31, 0x0C, 0x52, 0x0A, 0xF6, 0x07, 0xF2, 0x05, 0xBF, 0x05, 
-    0x95, 0x06, 0x85, 0x07, 0xCC, 0x08, 0xB7, 0x07, 0xD0, 0x04, 0x20, 0x01, 0x64, 0xFD, 0x25, 0xFA, 
-    0x86, 0xF8, 0x58, 0xF7, 0x08, 0xF8, 0xD1, 0xF8, 0x36, 0xF9, 0xC5, 0xF8, 0xC1, 0xF6, 0x47, 0xF5, 
-    0xA3, 0xF4, 0xF7, 0xF5, 0x21, 0xF8, 0x79, 0xFB, 0x25, 0xFD, 0x8A, 0xFD, 0x5C, 0xFC, 0xD6, 0xFA, 
-    0xBC, 0xFA, 0x4F, 0xFC, 0x86, 0xFE, 0x7C, 0x00, 0xC8, 0x00, 0xF3, 0xFF, 0x10, 0xFF, 0x2E, 0xFE, 
-    0x6D, 0xFE, 0x53, 0xFE, 0x2E, 0xFE, 0x15, 0xFE, 0xE2, 0xFD, 0xE2, 0xFD, 0x15, 0xFE, 0xC9, 0xFD, 
-    0x3F, 0xFD, 0xB4, 0xFC, 0x00, 0xFD, 0xD6, 0xFD, 0x82, 0xFF, 0x2D, 0x01, 0x81, 0x02, 0xA6, 0x02, 
-    0x8D, 0x02, 0x8D, 0x02, 0x3D, 0x03, 0x78, 0x04, 0x80, 0x05, 0x24, 0x06, 0x24, 0x06, 0xE5, 0x05, 
-    0xB7, 0x04, 0xE5, 0x02, 0x5F, 0x01, 0xE6, 0xFF, 0x18, 0x00, 0x68, 0xFF, 0x9B, 0xFF, 0x47, 0xFE, 
-    0x4B, 0xFD, 0x92, 0xFB, 0x3F, 0xFA, 0x5C, 0xF9, 0xB4, 0xF9, 0x15, 0xFB, 0x36, 0xFC, 0x25, 0xFD, 
-    0x0C, 0xFD, 0xC1, 0xFC, 0xDA, 0xFC, 0x32, 0xFD, 0xBC, 0xFD, 0xB8, 0xFE, 0xB4, 0xFF, 0x31, 0x00, 
-    0x70, 0x00, 0xCD, 0xFF, 0x43, 0xFF, 0xD1, 0xFE, 0xD1, 0xFE, 0x10, 0xFF, 0x43, 0xFF, 0x43, 0xFF, 
-    0xEB, 0xFE, 0x15, 0xFE, 0x58, 0xFD, 0x25, 0xFD, 0x64, 0xFD, 0xFB, 0xFD, 0x86, 0xFE, 0xAC, 0xFE, 
-    0x53, 0xFE, 0x3A, 0xFE, 0x15, 0xFE, 0x47, 0xFE, 0x47, 0xFE, 0x60, 0xFE, 0x21, 0xFE, 0x08, 0xFE, 
-    0x3A, 0xFE, 0x60, 0xFE, 0x6D, 0xFE, 0x21, 0xFE, 0xC9, 0xFD, 0x7D, 0xFD, 0x7D, 0xFD, 0x97, 0xFD, 
-    0x7D, 0xFD, 0x97, 0xFD, 0x00, 0xFD, 0x68, 0xFC, 0xEB, 0xFB, 0x54, 0xFB, 0xF7, 0xFB, 0xD1, 0xFB, 
-    0x1D, 0xFC, 0x10, 0xFC, 0xB8, 0xFB, 0xB4, 0xFC, 0x75, 0xFC, 0xDA, 0xFC, 0x04, 0xFC, 0xF7, 0xFB, 
-    0x04, 0xFC, 0x8E, 0xFC, 0x19, 0xFD, 0xE6, 0xFC, 0x82, 0xFC, 0x6D, 0xFB, 0x9F, 0xFB, 0x15, 0xFB, 
-    0x1D, 0xFC, 0x46, 0x01, 0xAF, 0x06, 0x80, 0x0E, 0xAE, 0x0F, 0x4A, 0x0C, 0x74, 0x08, 0xE5, 0x05, 
-    0xF2, 0x08, 0x5B, 0x0E, 0xD8, 0x11, 0x24, 0x15, 0xCC, 0x11, 0xD9, 0x0B, 0x0F, 0x05, 0xC4, 0x01, 
-    0xD0, 0x01, 0xE1, 0x06, 0x18, 0x09, 0x85, 0x0A, 0xD4, 0x09, 0xBB, 0x06, 0x07, 0x04, 0x07, 0x01, 
-    0xE6, 0xFF, 0xE5, 0x02, 0x07, 0x07, 0xF6, 0x0A, 0x85, 0x0D, 0x8D, 0x0B, 0x7C, 0x09, 0x57, 0x06, 
-    0xFA, 0x03, 0x57, 0x03, 0xC4, 0x04, 0x4E, 0x05, 0x4A, 0x06, 0x9E, 0x04, 0xC4, 0x01, 0x79, 0xFE, 
-    0x4B, 0xFA, 0x64, 0xF7, 0x2A, 0xF6, 0x36, 0xF6, 0x6D, 0xF8, 0xDA, 0xF9, 0xB4, 0xF9, 0x1D, 0xF9, 
-    0xE6, 0xF6, 0x54, 0xF5, 0x2E, 0xF5, 0x69, 0xF6, 0x36, 0xF9, 0x2A, 0xFC, 0x7D, 0xFD, 0x8A, 0xFD, 
-    0xEB, 0xFB, 0x2E, 0xFB, 0x54, 0xFB, 0x68, 0xFC, 0x08, 0xFE, 0x9B, 0xFF, 0x00, 0x00, 0xE6, 0xFF, 
-    0x82, 0xFF, 0xEB, 0xFE, 0xB8, 0xFE, 0x08, 0xFE, 0xBC, 0xFD, 0x4B, 0xFD, 0xE2, 0xFD, 0xD1, 0xFE, 
-    0x4F, 0xFF, 0x1D, 0xFF, 0xC5, 0xFE, 0x53, 0xFE, 0xB8, 0xFE, 0x8E, 0xFF, 0x46, 0x01, 0x67, 0x02, 
-    0x89, 0x03, 0x4A, 0x03, 0xFE, 0x02, 0x81, 0x02, 0xBF, 0x02, 0x0B, 0x03, 0x3D, 0x03, 0x63, 0x03, 
-    0x18, 0x03, 0xFE, 0x02, 0x28, 0x02, 0x78, 0x01, 0x96, 0x00, 0xF3, 0xFF, 0x18, 0x00, 0xE6, 0xFF, 
-    0xDA, 0xFF, 0x36, 0xFF, 0x15, 0xFE, 0x32, 0xFD, 0xB4, 0xFC, 0xB4, 0xFC, 0x0C, 0xFD, 0x19, 0xFD, 
-    0xF3, 0xFC, 0xCD, 0xFC, 0xDA, 0xFC, 0xA3, 0xFD, 0x08, 0xFE, 0xB8, 0xFE, 0x86, 0xFE, 0x43, 0xFF, 
-    0x29, 0xFF, 0x00, 0x00, 0x24, 0x00, 0xF3, 0xFF, 0x24, 0x00, 0x00, 0x00, 0x18, 0x00, 0xF3, 0xFF, 
-    0xB4, 0xFF, 0x04, 0xFF, 0x6D, 0xFE, 0x64, 0xFD, 0x4B, 0xFD, 0x64, 0xFD, 0xB0, 0xFD, 0xD6, 0xFD, 
-    0x4B, 0xFD, 0x43, 0xFC, 0x9F, 0xFB, 0xAC, 0xFB, 0xF7, 0xFB, 0xF3, 0xFC, 0x7D, 0xFD, 0x08, 0xFE, 
-    0x2E, 0xFE, 0xFB, 0xFD, 0x15, 0xFE, 0xC9, 0xFD, 0x21, 0xFE, 0x60, 0xFE, 0x92, 0xFE, 0xD1, 0xFE, 
-    0x79, 0xFE, 0x86, 0xFE, 0xD6, 0xFD, 0xD6, 0xFD, 0x19, 0xFD, 0x82, 0xFC, 0x21, 0xFB, 0xBC, 0xFA, 
-    0x71, 0xFA, 0x8A, 0xFA, 0xEF, 0xFA, 0xFB, 0xFA, 0x54, 0xFB, 0xF7, 0xFB, 0xD1, 0xFB, 0x3A, 0xFB, 
-    0xE2, 0xFA, 0x21, 0xFB, 0x10, 0xFC, 0x58, 0xFD, 0x3F, 0xFD, 0xD6, 0xFD, 0x00, 0xFD, 0xA7, 0xFC, 
-    0xF3, 0xFC, 0x8E, 0xFC, 0xE6, 0xFC, 0xDD, 0x01, 0x13, 0x07, 0xB7, 0x0D, 0x5B, 0x11, 0xA6, 0x0E, 
-    0xAF, 0x0C, 0x63, 0x09, 0xC8, 0x09, 0xAA, 0x0D, 0x13, 0x10, 0x84, 0x13, 0xFA, 0x12, 0x0F, 0x0E, 
-    0x28, 0x08, 0x5F, 0x04, 0x5F, 0x01, 0xC8, 0x03, 0x8D, 0x05, 0xE1, 0x06, 0xCC, 0x08, 0xB7, 0x07, 
-    0xA6, 0x05, 0x70, 0x03, 0xFA, 0x00, 0x1C, 0x02, 0x1C, 0x05, 0xDD, 0x07, 0x8D, 0x0B, 0xFE, 0x0B, 
-    0xE9, 0x0A, 0x31, 0x09, 0x57, 0x06, 0x5F, 0x04, 0x6C, 0x04, 0xBB, 0x03, 0xA2, 0x03, 0x24, 0x03, 
-    0xD0, 0x01, 0x31, 0x00, 0xA3, 0xFD, 0x0C, 0xFA, 0x97, 0xF7, 0x6D, 0xF5, 0x60, 0xF5, 0xF3, 0xF6, 
-    0xEF, 0xF7, 0x4F, 0xF9, 0xF7, 0xF8, 0x58, 0xF7, 0xDE, 0xF5, 0xEB, 0xF5, 0x0C, 0xF7, 0xA7, 0xF9, 
-    0xB8, 0xFB, 0x58, 0xFD, 0xBC, 0xFD, 0xD6, 0xFD, 0xB0, 0xFD, 0x64, 0xFD, 0x7D, 0xFD, 0x53, 0xFE, 
-    0xC5, 0xFE, 0xA7, 0xFF, 0xAF, 0x00, 0x20, 0x01, 0x2D, 0x01, 0xCD, 0xFF, 0x15, 0xFE, 0x25, 0xFD, 
-    0x9B, 0xFC, 0x08, 0xFE, 0x36, 0xFF, 0x36, 0xFF, 0x24, 0x00, 0xC5, 0xFE, 0x6D, 0xFE, 0x2E, 0xFE, 
-    0x86, 0xFE, 0xF3, 0xFF, 0x20, 0x01, 0xD0, 0x01, 0x5B, 0x02, 0x4E, 0x02, 0x03, 0x02, 0x67, 0x02, 
-    0xDD, 0x01, 0x0F, 0x02, 0xE5, 0x02, 0xA6, 0x02, 0xFE, 0x02, 0x5B, 0x02, 0x20, 0x01, 0x57, 0x00, 
-    0xDA, 0xFF, 0x82, 0xFF, 0xEE, 0x00, 0x0B, 0x00, 0x5C, 0xFF, 0x08, 0xFE, 0x36, 0xFC, 0x10, 0xFC, 
-    0x2A, 0xFC, 0x8E, 0xFC, 0x7D, 0xFD, 0x3F, 0xFD, 0x25, 0xFD, 0xCD, 0xFC, 0x68, 0xFC, 0xCD, 0xFC, 
-    0xBC, 0xFD, 0x2E, 0xFE, 0x36, 0xFF, 0xF3, 0xFF, 0xE6, 0xFF, 0xA2, 0x00, 0x89, 0x00, 0xFA, 0x00, 
-    0x46, 0x01, 0x20, 0x01, 0x5F, 0x01, 0x52, 0x01, 0xBB, 0x00, 0xEE, 0x00, 0x24, 0x00, 0xCD, 0xFF, 
-    0x68, 0xFF, 0xD1, 0xFE, 0xA3, 0xFD, 0x32, 0xFD, 0x10, 0xFC, 0x4F, 0xFC, 0x68, 0xFC, 0xC1, 0xFC, 
-    0xDA, 0xFC, 0x68, 0xFC, 0xC5, 0xFB, 0xEB, 0xFB, 0x1D, 0xFC, 0x25, 0xFD, 0x9F, 0xFE, 0xEB, 0xFE, 
-    0x4F, 0xFF, 0xC5, 0xFE, 0x2E, 0xFE, 0x08, 0xFE, 0xFB, 0xFD, 0xC9, 0xFD, 0xE2, 0xFD, 0x19, 0xFD, 
-    0x00, 0xFD, 0x5C, 0xFC, 0xAC, 0xFB, 0x15, 0xFB, 0x64, 0xFA, 0x8A, 0xFA, 0x64, 0xFA, 0x7E, 0xFA, 
-    0x3A, 0xFB, 0x92, 0xFB, 0x9B, 0xFC, 0x82, 0xFC, 0xB4, 0xFC, 0x75, 0xFC, 0x00, 0xFD, 0x4B, 0xFD, 
-    0xD6, 0xFD, 0x47, 0xFE, 0xAC, 0xFE, 0x5C, 0xFF, 0x43, 0xFF, 0x1D, 0xFF, 0xCD, 0xFF, 0x8E, 0xFF, 
-    0x75, 0xFF, 0x04, 0xFF, 0x20, 0x01, 0xDD, 0x04, 0xD4, 0x09, 0xE9, 0x0D, 0x52, 0x0D, 0x70, 0x0C, 
-    0xFA, 0x09, 0x9A, 0x08, 0xBB, 0x09, 0x41, 0x0B, 0x02, 0x0E, 0x7C, 0x0F, 0x52, 0x0D, 0x46, 0x0A, 
-    0xE1, 0x06, 0x6C, 0x04, 0x5F, 0x04, 0x8D, 0x05, 0xE1, 0x06, 0x63, 0x09, 0x89, 0x09, 0xC4, 0x07, 
-    0x9A, 0x05, 0xCC, 0x02, 0x0F, 0x02, 0x57, 0x03, 0xE1, 0x03, 0x4A, 0x06, 0xC8, 0x06, 0x95, 0x06, 
-    0xF2, 0x05, 0x85, 0x04, 0xFE, 0x02, 0x4E, 0x02, 0x7C, 0x00, 0xF3, 0xFF, 0x0B, 0x00, 0x96, 0x00, 
-    0x5F, 0x01, 0xBB, 0x00, 0x60, 0xFE, 0xD1, 0xFB, 0x2A, 0xF9, 0x8A, 0xF7, 0x08, 0xF8, 0x43, 0xF9, 
-    0x47, 0xFB, 0x2A, 0xFC, 0x92, 0xFB, 0x0C, 0xFA, 0xB8, 0xF8, 0x21, 0xF8, 0xAC, 0xF8, 0xF3, 0xF9, 
-    0x21, 0xFB, 0x75, 0xFC, 0x0C, 0xFD, 0x4B, 0xFD, 0x4B, 0xFD, 0x32, 0xFD, 0x19, 0xFD, 0x19, 0xFD, 
-    0x97, 0xFD, 0x79, 0xFE, 0x9B, 0xFF, 0xFA, 0x00, 0xFA, 0x00, 0x70, 0x00, 0xF7, 0xFE, 0x21, 0xFE, 
-    0x71, 0xFD, 0x15, 0xFE, 0xDE, 0xFE, 0x0B, 0x00, 0x89, 0x00, 0x63, 0x00, 0x9B, 0xFF, 0xEB, 0xFE, 
-    0x6D, 0xFE, 0x1D, 0xFF, 0x68, 0xFF, 0xA2, 0x00, 0x91, 0x01, 0x4E, 0x02, 0x8D, 0x02, 0x5B, 0x02, 
-    0xE9, 0x01, 0x9E, 0x01, 0x52, 0x01, 0xDD, 0x01, 0x03, 0x02, 0xA6, 0x02, 0x4E, 0x02, 0x9E, 0x01, 
-    0xD5, 0x00, 0x5C, 0xFF, 0xC5, 0xFE, 0x53, 0xFE, 0xE2, 0xFD, 0xC5, 0xFE, 0xF7, 0xFE, 0x1D, 0xFF, 
-    0x1D, 0xFF, 0xD6, 0xFD, 0x97, 0xFD, 0x32, 0xFD, 0xBC, 0xFD, 0x92, 0xFE, 0xC1, 0xFF, 0xF3, 0xFF, 
-    0x4A, 0x00, 0x63, 0x00, 0xF3, 0xFF, 0x24, 0x00, 0xDA, 0xFF, 0xF3, 0xFF, 0x18, 0x00, 0x18, 0x00, 
-    0x00, 0x00, 0xF3, 0xFF, 0xB4, 0xFF, 0x04, 0xFF, 0x9F, 0xFE, 0xD6, 0xFD, 0x32, 0xFD, 0x64, 0xFD, 
-    0x0C, 0xFD, 0x8A, 0xFD, 0xC9, 0xFD, 0xB0, 0xFD, 0xB0, 0xFD, 0x19, 0xFD, 0xDA, 0xFC, 0x0C, 0xFD, 
-    0x3F, 0xFD, 0x08, 0xFE, 0xAC, 0xFE, 0x1D, 0xFF, 0x43, 0xFF, 0x29, 0xFF, 0x6D, 0xFE, 0x08, 0xFE, 
-    0x08, 0xFE, 0xBC, 0xFD, 0x47, 0xFE, 0x08, 0xFE, 0xE2, 0xFD, 0x8A, 0xFD, 0x25, 0xFD, 0xCD, 0xFC, 
-    0xDA, 0xFC, 0x2A, 0xFC, 0x75, 0xFC, 0xCD, 0xFC, 0xCD, 0xFC, 0xA3, 0xFD, 0xA3, 0xFD, 0xC9, 0xFD, 
-    0xBC, 0xFD, 0x25, 0xFD, 0x3F, 0xFD, 0x4B, 0xFD, 0x15, 0xFE, 0xAC, 0xFE, 0xD1, 0xFE, 0xB8, 0xFE, 
-    0x6D, 0xFE, 0x86, 0xFE, 0xD6, 0xFD, 0x53, 0xFE, 0x6D, 0xFE, 0xF7, 0xFE, 0x4F, 0xFF, 0xB8, 0xFE, 
-    0x6D, 0xFE, 0x9B, 0xFF, 0x39, 0x01, 0xE1, 0x03, 0x89, 0x06, 0xAA, 0x07, 0xFE, 0x08, 0x03, 0x08, 
-    0x07, 0x07, 0xAA, 0x07, 0x28, 0x08, 0x78, 0x0A, 0x0B, 0x0C, 0x56, 0x0C, 0xA6, 0x0B, 0x2C, 0x0A, 
-    0x9A, 0x08, 0x46, 0x07, 0x9E, 0x07, 0x03, 0x08, 0xD9, 0x08, 0x41, 0x08, 0xB7, 0x07, 0x89, 0x06, 
-    0x74, 0x05, 0x03, 0x05, 0x9E, 0x04, 0xEE, 0x03, 0xEE, 0x03, 0xD4, 0x03, 0x07, 0x04, 0x78, 0x04, 
-    0xD0, 0x04, 0x5F, 0x04, 0xFE, 0x02, 0xD0, 0x01, 0x70, 0x00, 0x24, 0x00, 0x63, 0x00, 0x39, 0x01, 
-    0x6C, 0x01, 0x13, 0x01, 0xF3, 0xFF, 0x47, 0xFE, 0xC1, 0xFC, 0xF7, 0xFB, 0xAC, 0xFB, 0xF7, 0xFB, 
-    0x75, 0xFC, 0xDA, 0xFC, 0x75, 0xFC, 0xDE, 0xFB, 0x54, 0xFB, 0x7E, 0xFA, 0x32, 0xFA, 0x00, 0xFA, 
-    0x0C, 0xFA, 0x00, 0xFA, 0x8A, 0xFA, 0x2E, 0xFB, 0x1D, 0xFC, 0x75, 0xFC, 0x9B, 0xFC, 0x04, 0xFC, 
-    0xC5, 0xFB, 0xF7, 0xFB, 0xDA, 0xFC, 0x3A, 0xFE, 0x82, 0xFF, 0x18, 0x00, 0xB4, 0xFF, 0x10, 0xFF, 
-    0x86, 0xFE, 0x47, 0xFE, 0xB8, 0xFE, 0x4F, 0xFF, 0xCD, 0xFF, 0x00, 0x00, 0x18, 0x00, 0xCD, 0xFF, 
-    0x9B, 0xFF, 0x5C, 0xFF, 0x4F, 0xFF, 0x29, 0xFF, 0x5C, 0xFF, 0xF3, 0xFF, 0x3D, 0x00, 0xC8, 0x00, 
-    0x89, 0x00, 0x70, 0x00, 0xCD, 0xFF, 0x82, 0xFF, 0x5C, 0xFF, 0x68, 0xFF, 0x8E, 0xFF, 0xDA, 0xFF, 
-    0xC1, 0xFF, 0xC1, 0xFF, 0x9B, 0xFF, 0x8E, 0xFF, 0x8E, 0xFF, 0xC1, 0xFF, 0xF3, 0xFF, 0x31, 0x00, 
-    0x4A, 0x00, 0x00, 0x00, 0x4A, 0x00, 0x18, 0x00, 0x57, 0x00, 0x24, 0x00, 0x00, 0x00, 0x82, 0xFF, 
-    0x68, 0xFF, 0x36, 0xFF, 0x75, 0xFF, 0x36, 0xFF, 0x36, 0xFF, 0xB8, 0xFE, 0x6D, 0xFE, 0x21, 0xFE, 
-    0x2E, 0xFE, 0x86, 0xFE, 0xEB, 0xFE, 0x4F, 0xFF, 0x68, 0xFF, 0x68, 0xFF, 0x36, 0xFF, 0x75, 0xFF, 
-    0x8E, 0xFF, 0x00, 0x00, 0xF3, 0xFF, 0xCD, 0xFF, 0x68, 0xFF, 0x43, 0xFF, 0x04, 0xFF, 0x36, 0xFF, 
-    0x04, 0xFF, 0x10, 0xFF, 0xDE, 0xFE, 0xD1, 0xFE, 0x6D, 0xFE, 0x3A, 0xFE, 0xE2, 0xFD, 0xB0, 0xFD, 
-    0x71, 0xFD, 0x4B, 0xFD, 0x19, 0xFD, 0x0C, 0xFD, 0x58, 0xFD, 0x64, 0xFD, 0x7D, 0xFD, 0x58, 0xFD, 
-    0x4B, 0xFD, 0x3F, 0xFD, 0x7D, 0xFD, 0xBC, 0xFD, 0x15, 0xFE, 0x53, 0xFE, 0x6D, 0xFE, 0x21, 0xFE, 
-    0xEF, 0xFD, 0xB0, 0xFD, 0xE2, 0xFD, 0x15, 0xFE, 0x92, 0xFE, 0x9F, 0xFE, 0x86, 0xFE, 0x79, 0xFE, 
-    0x79, 0xFE, 0x79, 0xFE, 0xDE, 0xFE, 0x10, 0xFF, 0x1D, 0xFF, 0x4F, 0xFF, 0x1D, 0xFF, 0xF7, 0xFE, 
-    0xDE, 0xFE, 0xC5, 0xFE, 0x9F, 0xFE, 0x9F, 0xFE, 0x36, 0xFF, 0xCD, 0xFF, 0xE1, 0x00, 0x1C, 0x02, 
-    0xE5, 0x02, 0xF2, 0x02, 0x18, 0x03, 0xD9, 0x02, 0x7C, 0x03, 0x85, 0x04, 0x31, 0x06, 0x20, 0x07, 
-    0xB7, 0x07, 0xB7, 0x07, 0x85, 0x07, 0x78, 0x07, 0x5B, 0x08, 0x24, 0x09, 0xC8, 0x09, 0x20, 0x0A, 
-    0xA2, 0x09, 0xFE, 0x08, 0x8D, 0x08, 0x9A, 0x08, 0x67, 0x08, 0x74, 0x08, 0xDD, 0x07, 0x13, 0x07, 
-    0x0B, 0x06, 0xCC, 0x05, 0x28, 0x05, 0xC4, 0x04, 0x39, 0x04, 0x63, 0x03, 0x5B, 0x02, 0xAB, 0x01, 
-    0x52, 0x01, 0x39, 0x01, 0x46, 0x01, 0x52, 0x01, 0xD5, 0x00, 0x0B, 0x00, 0x75, 0xFF, 0xC5, 0xFE, 
-    0x6D, 0xFE, 0x53, 0xFE, 0x60, 0xFE, 0xFB, 0xFD, 0x97, 0xFD, 0x0C, 0xFD, 0x5C, 0xFC, 0xDE, 0xFB, 
-    0x6D, 0xFB, 0x08, 0xFB, 0xC9, 0xFA, 0xA3, 0xFA, 0x97, 0xFA, 0xB0, 0xFA, 0xC9, 0xFA, 0xC9, 0xFA, 
-    0xA3, 0xFA, 0x64, 0xFA, 0x64, 0xFA, 0x71, 0xFA, 0xBC, 0xFA, 0xEF, 0xFA, 0x2E, 0xFB, 0x08, 0xFB, 
-    0x08, 0xFB, 0xE2, 0xFA, 0x08, 0xFB, 0x79, 0xFB, 0x2A, 0xFC, 0xA7, 0xFC, 0x0C, 0xFD, 0x4B, 0xFD, 
-    0x71, 0xFD, 0x8A, 0xFD, 0xEF, 0xFD, 0x79, 0xFE, 0x04, 0xFF, 0x82, 0xFF, 0xDA, 0xFF, 0xF3, 0xFF, 
-    0xDA, 0xFF, 0x18, 0x00, 0x00, 0x00, 0x31, 0x00, 0x70, 0x00, 0xAF, 0x00, 0xAF, 0x00, 0xE1, 0x00, 
-    0xEE, 0x00, 0x20, 0x01, 0x20, 0x01, 0x39, 0x01, 0x07, 0x01, 0xEE, 0x00, 0x07, 0x01, 0x13, 0x01, 
-    0x20, 0x01, 0x6C, 0x01, 0x6C, 0x01, 0x39, 0x01, 0x20, 0x01, 0x2D, 0x01, 0x52, 0x01, 0xC4, 0x01, 
-    0x1C, 0x02, 0x35, 0x02, 0xDD, 0x01, 0xD0, 0x01, 0x46, 0x01, 0x46, 0x01, 0x39, 0x01, 0x6C, 0x01, 
-    0x70, 0x00, 0xD5, 0x00, 0x24, 0x00, 0x31, 0x00, 0x3D, 0x00, 0x68, 0xFF, 0xB4, 0xFF, 0x9F, 0xFE, 
-    0x29, 0xFF, 0x86, 0xFE, 0xB8, 0xFE, 0x86, 0xFE, 0x86, 0xFE, 0x21, 0xFE, 0x21, 0xFE, 0x7D, 0xFD, 
-    0x8A, 0xFD, 0x58, 0xFD, 0x8A, 0xFD, 0xBC, 0xFD, 0xB0, 0xFD, 0xEF, 0xFD, 0xB0, 0xFD, 0xB0, 0xFD, 
-    0x7D, 0xFD, 0x97, 0xFD, 0x97, 0xFD, 0xB0, 0xFD, 0x08, 0xFE, 0x15, 0xFE, 0x47, 0xFE, 0x53, 0xFE, 
-    0xFB, 0xFD, 0xBC, 0xFD, 0x64, 0xFD, 0x4B, 0xFD, 0x58, 0xFD, 0x7D, 0xFD, 0xBC, 0xFD, 0xBC, 0xFD, 
-    0xB0, 0xFD, 0xD6, 0xFD, 0xFB, 0xFD, 0x2E, 0xFE, 0xB8, 0xFE, 0xEB, 0xFE, 0x36, 0xFF, 0x75, 0xFF, 
-    0xA7, 0xFF, 0xB4, 0xFF, 0xF3, 0xFF, 0x00, 0x00, 0x0B, 0x00, 0x0B, 0x00, 0x00, 0x00, 0xE6, 0xFF, 
-    0xCD, 0xFF, 0xB4, 0xFF, 0x8E, 0xFF, 0x43, 0xFF, 0x1D, 0xFF, 0x1D, 0xFF, 0x82, 0xFF, 0x31, 0x00, 
-    0xE1, 0x00, 0x2D, 0x01, 0x5F, 0x01, 0x5F, 0x01, 0x85, 0x01, 0x28, 0x02, 0xF2, 0x02, 0x20, 0x04, 
-    0xAA, 0x04, 0x42, 0x05, 0x67, 0x05, 0xF2, 0x05, 0x95, 0x06, 0x85, 0x07, 0x28, 0x08, 0x9A, 0x08, 
-    0x4E, 0x08, 0x35, 0x08, 0x0F, 0x08, 0x4E, 0x08, 0x67, 0x08, 0x35, 0x08, 0xB7, 0x07, 0xFA, 0x06, 
-    0x70, 0x06, 0x18, 0x06, 0xE5, 0x05, 0xA6, 0x05, 0x42, 0x05, 0x6C, 0x04, 0xC8, 0x03, 0x24, 0x03, 
-    0xF2, 0x02, 0xB3, 0x02, 0xA6, 0x02, 0x28, 0x02, 0xDD, 0x01, 0x20, 0x01, 0xD5, 0x00, 0x63, 0x00, 
-    0x24, 0x00, 0xDA, 0xFF, 0x68, 0xFF, 0x10, 0xFF, 0xDE, 0xFE, 0x92, 0xFE, 0x60, 0xFE, 0x15, 0xFE, 
-    0xBC, 0xFD, 0x58, 0xFD, 0x00, 0xFD, 0x9B, 0xFC, 0x5C, 0xFC, 0x36, 0xFC, 0x1D, 0xFC, 0xF7, 0xFB, 
-    0xB8, 0xFB, 0x92, 0xFB, 0x47, 0xFB, 0xEF, 0xFA, 0xD6, 0xFA, 0xD6, 0xFA, 0xC9, 0xFA, 0x08, 0xFB, 
-    0x15, 0xFB, 0x2E, 0xFB, 0x60, 0xFB, 0xB8, 0xFB, 0x2A, 0xFC, 0x75, 0xFC, 0xB4, 0xFC, 0xDA, 0xFC, 
-    0xE6, 0xFC, 0x00, 0xFD, 0x64, 0xFD, 0xA3, 0xFD, 0xE2, 0xFD, 0x08, 0xFE, 0x15, 0xFE, 0x21, 0xFE, 
-    0x6D, 0xFE, 0xB8, 0xFE, 0xDE, 0xFE, 0x10, 0xFF, 0xF7, 0xFE, 0x04, 0xFF, 0x10, 0xFF, 0x5C, 0xFF, 
-    0x8E, 0xFF, 0xCD, 0xFF, 0xCD, 0xFF, 0xDA, 0xFF, 0x9B, 0xFF, 0xCD, 0xFF, 0xCD, 0xFF, 0x00, 0x00, 
-    0x31, 0x00, 0x7C, 0x00, 0x96, 0x00, 0xE1, 0x00, 0xFA, 0x00, 0x13, 0x01, 0x2D, 0x01, 0x46, 0x01, 
-    0x5F, 0x01, 0x46, 0x01, 0x6C, 0x01, 0x78, 0x01, 0x78, 0x01, 0x46, 0x01, 0x2D, 0x01, 0xE1, 0x00, 
-    0xC8, 0x00, 0xA2, 0x00, 0xA2, 0x00, 0x96, 0x00, 0xAF, 0x00, 0x89, 0x00, 0x63, 0x00, 0x18, 0x00, 
-    0xCD, 0xFF, 0xB4, 0xFF, 0xB4, 0xFF, 0xE6, 0xFF, 0x00, 0x00, 0xB4, 0xFF, 0x43, 0xFF, 0xEB, 0xFE, 
-    0x86, 0xFE, 0x92, 0xFE, 0x86, 0xFE, 0x6D, 0xFE, 0x2E, 0xFE, 0x15, 0xFE, 0xD6, 0xFD, 0xE2, 0xFD, 
-    0xD6, 0xFD, 0xC9, 0xFD, 0xA3, 0xFD, 0x71, 0xFD, 0x64, 0xFD, 0x71, 0xFD, 0xBC, 0xFD, 0xC9, 0xFD, 
-    0xD6, 0xFD, 0x8A, 0xFD, 0x4B, 0xFD, 0x4B, 0xFD, 0x97, 0xFD, 0xEF, 0xFD, 0x3A, 0xFE, 0x47, 0xFE, 
-    0x60, 0xFE, 0x60, 0xFE, 0xB8, 0xFE, 0x1D, 0xFF, 0x9B, 0xFF, 0xCD, 0xFF, 0xE6, 0xFF, 0xDA, 0xFF, 
-    0xCD, 0xFF, 0x00, 0x00, 0x24, 0x00, 0x57, 0x00, 0x57, 0x00, 0x3D, 0x00, 0x0B, 0x00, 0xF3, 0xFF, 
-    0xCD, 0xFF, 0x00, 0x00, 0x31, 0x00, 0x63, 0x00, 0x70, 0x00, 0x18, 0x00, 0xB4, 0xFF, 0xB4, 0xFF, 
-    0x00, 0x00, 0x96, 0x00, 0x78, 0x01, 0x91, 0x01, 0xB7, 0x01, 0x39, 0x01, 0x78, 0x01, 0x0F, 0x02, 
-    0x3D, 0x03, 0xE1, 0x03, 0x9E, 0x04, 0x20, 0x04, 0x85, 0x04, 0x91, 0x04, 0x80, 0x05, 0x24, 0x06, 
-    0xC8, 0x06, 0x70, 0x06, 0x70, 0x06, 0xFE, 0x05, 0x57, 0x06, 0xAF, 0x06, 0xE1, 0x06, 0xC8, 0x06, 
-    0x18, 0x06, 0xA6, 0x05, 0x74, 0x05, 0x9A, 0x05, 0xB3, 0x05, 0xB3, 0x05, 0xB7, 0x04, 0x39, 0x04, 
-    0x3D, 0x03, 0x57, 0x03, 0x18, 0x03, 0x57, 0x03, 0xB3, 0x02, 0x4E, 0x02, 0x46, 0x01, 0x20, 0x01, 
-    0xA2, 0x00, 0xC8, 0x00, 0x57, 0x00, 0x24, 0x00, 0x68, 0xFF, 0x10, 0xFF, 0xD1, 0xFE, 0xDE, 0xFE, 
-    0xAC, 0xFE, 0x79, 0xFE, 0x2E, 0xFE, 0xA3, 0xFD, 0x64, 0xFD, 0x3F, 0xFD, 0x19, 0xFD, 0x00, 0xFD, 
-    0xF3, 0xFC, 0xB4, 0xFC, 0xA7, 0xFC, 0x4F, 0xFC, 0x68, 0xFC, 0x43, 0xFC, 0x5C, 0xFC, 0x82, 0xFC, 
-    0x82, 0xFC, 0x75, 0xFC, 0x5C, 0xFC, 0x36, 0xFC, 0x43, 0xFC, 0x43, 0xFC, 0x8E, 0xFC, 0x75, 0xFC, 
-    0x4F, 0xFC, 0x2A, 0xFC, 0x36, 0xFC, 0x4F, 0xFC, 0xC1, 0xFC, 0x00, 0xFD, 0x25, 0xFD, 0x32, 0xFD, 
-    0x4B, 0xFD, 0x58, 0xFD, 0xD6, 0xFD, 0x08, 0xFE, 0x86, 0xFE, 0x79, 0xFE, 0x9F, 0xFE, 0x04, 0xFF, 
-    0xC1, 0xFF, 0x3D, 0x00, 0xFA, 0x00, 0xAF, 0x00, 0x63, 0x00, 0x24, 0x00, 0x63, 0x00, 0xAF, 0x00, 
-    0x85, 0x01, 0xB7, 0x01, 0x78, 0x01, 0xEE, 0x00, 0xA2, 0x00, 0xBB, 0x00, 0x07, 0x01, 0xAB, 0x01, 
-    0x78, 0x01, 0x2D, 0x01, 0x89, 0x00, 0x7C, 0x00, 0x63, 0x00, 0xD5, 0x00, 0xD5, 0x00, 0xC8, 0x00, 
-    0x24, 0x00, 0x24, 0x00, 0xF3, 0xFF, 0x57, 0x00, 0x57, 0x00, 0x70, 0x00, 0xB4, 0xFF, 0x68, 0xFF, 
-    0xDE, 0xFE, 0xEB, 0xFE, 0xEB, 0xFE, 0x1D, 0xFF, 0xB8, 0xFE, 0x92, 0xFE, 0x21, 0xFE, 0x08, 0xFE, 
-    0xEF, 0xFD, 0x15, 0xFE, 0xFB, 0xFD, 0xE2, 0xFD, 0x97, 0xFD, 0x97, 0xFD, 0x97, 0xFD, 0xE2, 0xFD, 
-    0x08, 0xFE, 0xFB, 0xFD, 0xB0, 0xFD, 0x97, 0xFD, 0x58, 0xFD, 0xA3, 0xFD, 0xD6, 0xFD, 0x3A, 0xFE, 
-    0x53, 0xFE, 0x92, 0xFE, 0x79, 0xFE, 0xAC, 0xFE, 0xB8, 0xFE, 0xF7, 0xFE, 0xF7, 0xFE, 0x10, 0xFF, 
-    0x04, 0xFF, 0x10, 0xFF, 0x36, 0xFF, 0x8E, 0xFF, 0xB4, 0xFF, 0xE6, 0xFF, 0x24, 0x00, 0x31, 0x00, 
-    0x7C, 0x00, 0x96, 0x00, 0xBB, 0x00, 0xC8, 0x00, 0xFA, 0x00, 0xFA, 0x00, 0x46, 0x01, 0x20, 0x01, 
-    0x52, 0x01, 0x13, 0x01, 0x07, 0x01, 0xC8, 0x00, 0xD5, 0x00, 0xEE, 0x00, 0x78, 0x01, 0x52, 0x01, 
-    0x52, 0x01, 0x13, 0x01, 0xEE, 0x00, 0x13, 0x01, 0xAB, 0x01, 0x28, 0x02, 0xCC, 0x02, 0xE5, 0x02, 
-    0xCC, 0x02, 0xB3, 0x02, 0xE5, 0x02, 0x96, 0x03, 0x07, 0x04, 0x6C, 0x04, 0x6C, 0x04, 0x5F, 0x04, 
-    0x2D, 0x04, 0xB7, 0x04, 0xD0, 0x04, 0x42, 0x05, 0x03, 0x05, 0xDD, 0x04, 0x85, 0x04, 0x91, 0x04, 
-    0xAA, 0x04, 0x0F, 0x05, 0x9E, 0x04, 0xAA, 0x04, 0x07, 0x04, 0xC8, 0x03, 0x96, 0x03, 0xBB, 0x03, 
-    0x4A, 0x03, 0x31, 0x03, 0x67, 0x02, 0x35, 0x02, 0xAB, 0x01, 0xB7, 0x01, 0x5F, 0x01, 0x2D, 0x01, 
-    0xA2, 0x00, 0x70, 0x00, 0xCD, 0xFF, 0xA7, 0xFF, 0x36, 0xFF, 0xF7, 0xFE, 0x92, 0xFE, 0x53, 0xFE, 
-    0x08, 0xFE, 0xEF, 0xFD, 0x97, 0xFD, 0x7D, 0xFD, 0x32, 0xFD, 0x0C, 0xFD, 0x25, 0xFD, 0x32, 0xFD, 
-    0x4B, 0xFD, 0x3F, 0xFD, 0x19, 0xFD, 0x19, 0xFD, 0x32, 0xFD, 0x58, 0xFD, 0x7D, 0xFD, 0x64, 0xFD, 
-    0x58, 0xFD, 0x32, 0xFD, 0x32, 0xFD, 0x4B, 0xFD, 0x8A, 0xFD, 0x71, 0xFD, 0x58, 0xFD, 0x32, 0xFD, 
-    0x3F, 0xFD, 0x58, 0xFD, 0x97, 0xFD, 0xC9, 0xFD, 0xD6, 0xFD, 0xC9, 0xFD, 0xD6, 0xFD, 0xD6, 0xFD, 
-    0xEF, 0xFD, 0x53, 0xFE, 0x60, 0xFE, 0x6D, 0xFE, 0x6D, 0xFE, 0x6D, 0xFE, 0x9F, 0xFE, 0x04, 0xFF, 
-    0x29, 0xFF, 0x4F, 0xFF, 0x4F, 0xFF, 0x36, 0xFF, 0x4F, 0xFF, 0x4F, 0xFF, 0x75, 0xFF, 0x68, 0xFF, 
-    0x5C, 0xFF, 0x4F, 0xFF, 0x68, 0xFF, 0x75, 0xFF, 0xCD, 0xFF, 0xC1, 0xFF, 0xE6, 0xFF, 0x00, 0x00, 
-    0x00, 0x00, 0x18, 0x00, 0x57, 0x00, 0x57, 0x00, 0x70, 0x00, 0x7C, 0x00, 0x89, 0x00, 0x89, 0x00, 
-    0x96, 0x00, 0x89, 0x00, 0x70, 0x00, 0x4A, 0x00, 0x3D, 0x00, 0x0B, 0x00, 0x00, 0x00, 0xCD, 0xFF, 
-    0xC1, 0xFF, 0xCD, 0xFF, 0xC1, 0xFF, 0xF3, 0xFF, 0xE6, 0xFF, 0xDA, 0xFF, 0xCD, 0xFF, 0xB4, 0xFF, 
-    0x8E, 0xFF, 0x9B, 0xFF, 0x75, 0xFF, 0x75, 0xFF, 0x5C, 0xFF, 0x4F, 0xFF, 0x36, 0xFF, 0x43, 0xFF, 
-    0x1D, 0xFF, 0x1D, 0xFF, 0xD1, 0xFE, 0xDE, 0xFE, 0xAC, 0xFE, 0xD1, 0xFE, 0xB8, 0xFE, 0xDE, 0xFE, 
-    0xB8, 0xFE, 0xAC, 0xFE, 0x86, 0xFE, 0x86, 0xFE, 0x9F, 0xFE, 0xD1, 0xFE, 0xDE, 0xFE, 0x04, 0xFF, 
-    0xF7, 0xFE, 0xD1, 0xFE, 0xEB, 0xFE, 0x04, 0xFF, 0x43, 0xFF, 0x9B, 0xFF, 0xE6, 0xFF, 0xF3, 0xFF, 
-    0x18, 0x00, 0x24, 0x00, 0x57, 0x00, 0x7C, 0x00, 0xA2, 0x00, 0xC8, 0x00, 0xAF, 0x00, 0xBB, 0x00, 
-    0xBB, 0x00, 0xA2, 0x00, 0x89, 0x00, 0xAF, 0x00, 0x7C, 0x00, 0xBB, 0x00, 0xBB, 0x00, 0xFA, 0x00, 
-    0xE1, 0x00, 0xE1, 0x00, 0xBB, 0x00, 0xAF, 0x00, 0xC8, 0x00, 0x13, 0x01, 0x13, 0x01, 0x20, 0x01, 
-    0x20, 0x01, 0xD5, 0x00, 0xFA, 0x00, 0x46, 0x01, 0x91, 0x01, 0xDD, 0x01, 0x03, 0x02, 0x03, 0x02, 
-    0x42, 0x02, 0x67, 0x02, 0xF2, 0x02, 0x31, 0x03, 0x70, 0x03, 0x89, 0x03, 0x7C, 0x03, 0x96, 0x03, 
-    0xFA, 0x03, 0x07, 0x04, 0x20, 0x04, 0x20, 0x04, 0xA2, 0x03, 0xBB, 0x03, 0x96, 0x03, 0xE1, 0x03, 
-    0xBB, 0x03, 0xEE, 0x03, 0x70, 0x03, 0x7C, 0x03, 0x0B, 0x03, 0x63, 0x03, 0xF2, 0x02, 0x31, 0x03, 
-    0xB3, 0x02, 0x74, 0x02, 0xC4, 0x01, 0xC4, 0x01, 0x46, 0x01, 0x46, 0x01, 0xBB, 0x00, 0x89, 0x00, 
-    0x00, 0x00, 0xF3, 0xFF, 0xA7, 0xFF, 0x9B, 0xFF, 0x4F, 0xFF, 0x29, 0xFF, 0xB8, 0xFE, 0xAC, 0xFE, 
-    0x86, 0xFE, 0x86, 0xFE, 0x6D, 0xFE, 0x2E, 0xFE, 0xE2, 0xFD, 0xC9, 0xFD, 0x97, 0xFD, 0xA3, 0xFD, 
-    0x7D, 0xFD, 0x64, 0xFD, 0x3F, 0xFD, 0x25, 0xFD, 0x0C, 0xFD, 0x25, 0xFD, 0x19, 0xFD, 0x25, 0xFD, 
-    0x0C, 0xFD, 0x0C, 0xFD, 0x19, 0xFD, 0x0C, 0xFD, 0x19, 0xFD, 0x0C, 0xFD, 0x00, 0xFD, 0x00, 0xFD, 
-    0x32, 0xFD, 0x32, 0xFD, 0x7D, 0xFD, 0x8A, 0xFD, 0xC9, 0xFD, 0xE2, 0xFD, 0x21, 0xFE, 0x3A, 0xFE, 
-    0x92, 0xFE, 0xC5, 0xFE, 0x04, 0xFF, 0x1D, 0xFF, 0x4F, 0xFF, 0x68, 0xFF, 0x82, 0xFF, 0x8E, 0xFF, 
-    0xB4, 0xFF, 0xCD, 0xFF, 0xDA, 0xFF, 0x0B, 0x00, 0x0B, 0x00, 0x24, 0x00, 0x3D, 0x00, 0x3D, 0x00, 
-    0x3D, 0x00, 0x57, 0x00, 0x63, 0x00, 0x7C, 0x00, 0x63, 0x00, 0x89, 0x00, 0x57, 0x00, 0x63, 0x00, 
-    0x4A, 0x00, 0x3D, 0x00, 0x18, 0x00, 0x24, 0x00, 0xF3, 0xFF, 0xF3, 0xFF, 0xB4, 0xFF, 0xB4, 0xFF, 
-    0x8E, 0xFF, 0x9B, 0xFF, 0x8E, 0xFF, 0x8E, 0xFF, 0x5C, 0xFF, 0x5C, 0xFF, 0x29, 0xFF, 0x1D, 0xFF, 
-    0x04, 0xFF, 0x04, 0xFF, 0xEB, 0xFE, 0xDE, 0xFE, 0xAC, 0xFE, 0xAC, 0xFE, 0x86, 0xFE, 0x9F, 0xFE, 
-    0xB8, 0xFE, 0x9F, 0xFE, 0x92, 0xFE, 0x79, 0xFE, 0x79, 0xFE, 0x9F, 0xFE, 0xEB, 0xFE, 0x1D, 0xFF, 
-    0x29, 0xFF, 0x1D, 0xFF, 0x36, 0xFF, 0x1D, 0xFF, 0x8E, 0xFF, 0xB4, 0xFF, 0xE6, 0xFF, 0xCD, 0xFF, 
-    0xDA, 0xFF, 0xE6, 0xFF, 0x0B, 0x00, 0x4A, 0x00, 0x70, 0x00, 0x63, 0x00, 0x7C, 0x00, 0x57, 0x00, 
-    0x7C, 0x00, 0xBB, 0x00, 0xAF, 0x00, 0xE1, 0x00, 0xAE, 0x00, 0xA2, 0x00, 0xAE, 0x00, 0xD4, 0x00, 
-    0x06, 0x01, 0x13, 0x01, 0xED, 0x00, 0x13, 0x01, 0x06, 0x01, 0x45, 0x01, 0x6B, 0x01, 0x77, 0x01, 
-    0x5E, 0x01, 0x6A, 0x01, 0x2C, 0x01, 0x5E, 0x01, 0x5E, 0x01, 0x77, 0x01, 0x51, 0x01, 0x1F, 0x01, 
-    0xC7, 0x00, 0xC7, 0x00, 0xAE, 0x00, 0xD4, 0x00, 0xD4, 0x00, 0xBB, 0x00, 0xAE, 0x00, 0x7C, 0x00, 
-    0x95, 0x00, 0xC7, 0x00, 0xF9, 0x00, 0x1F, 0x01, 0x12, 0x01, 0xF9, 0x00, 0x05, 0x01, 0x2B, 0x01, 
-    0x69, 0x01, 0xA8, 0x01, 0xB4, 0x01, 0xB4, 0x01, 0xB4, 0x01, 0xC1, 0x01, 0xE6, 0x01, 0x18, 0x02, 
-    0x25, 0x02, 0x0C, 0x02, 0xF3, 0x01, 0xDA, 0x01, 0xF2, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xD9, 0x01, 
-    0xC0, 0x01, 0x75, 0x01, 0x75, 0x01, 0x82, 0x01, 0x75, 0x01, 0x75, 0x01, 0x50, 0x01, 0x05, 0x01, 
-    0xEC, 0x00, 0xBA, 0x00, 0xBA, 0x00, 0xAD, 0x00, 0x94, 0x00, 0x6F, 0x00, 0x56, 0x00, 0x30, 0x00, 
-    0x24, 0x00, 0x0B, 0x00, 0x00, 0x00, 0xDA, 0xFF, 0xB5, 0xFF, 0x9C, 0xFF, 0x8F, 0xFF, 0x76, 0xFF, 
-    0x76, 0xFF, 0x38, 0xFF, 0x13, 0xFF, 0xE1, 0xFE, 0xC8, 0xFE, 0xC8, 0xFE, 0xBC, 0xFE, 0xBC, 0xFE, 
-    0xBC, 0xFE, 0x71, 0xFE, 0x71, 0xFE, 0x33, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x1B, 0xFE, 0xF5, 0xFD, 
-    0x02, 0xFE, 0xD0, 0xFD, 0x02, 0xFE, 0xE9, 0xFD, 0x02, 0xFE, 0x02, 0xFE, 0xF6, 0xFD, 0xF6, 0xFD, 
-    0x02, 0xFE, 0x1B, 0xFE, 0x40, 0xFE, 0x4D, 0xFE, 0x41, 0xFE, 0x59, 0xFE, 0x41, 0xFE, 0x72, 0xFE, 
-    0x4D, 0xFE, 0x5A, 0xFE, 0x5A, 0xFE, 0x7F, 0xFE, 0x73, 0xFE, 0xA4, 0xFE, 0xA4, 0xFE, 0xEF, 0xFE, 
-    0xE2, 0xFE, 0xFB, 0xFE, 0x14, 0xFF, 0x2D, 0xFF, 0x5E, 0xFF, 0x90, 0xFF, 0x84, 0xFF, 0xC2, 0xFF, 
-    0xDA, 0xFF, 0xF3, 0xFF, 0x00, 0x00, 0x17, 0x00, 0x49, 0x00, 0x30, 0x00, 0x49, 0x00, 0x30, 0x00, 
-    0x49, 0x00, 0x24, 0x00, 0x3C, 0x00, 0x49, 0x00, 0x49, 0x00, 0x7A, 0x00, 0x55, 0x00, 0x61, 0x00, 
-    0x3C, 0x00, 0x3C, 0x00, 0x17, 0x00, 0x24, 0x00, 0x0B, 0x00, 0x24, 0x00, 0xF3, 0xFF, 0x0B, 0x00, 
-    0xE7, 0xFF, 0xE7, 0xFF, 0xDA, 0xFF, 0xDA, 0xFF, 0xCE, 0xFF, 0xDA, 0xFF, 0xC2, 0xFF, 0xCE, 0xFF, 
-    0xCE, 0xFF, 0xE7, 0xFF, 0xE7, 0xFF, 0x00, 0x00, 0x0B, 0x00, 0x17, 0x00, 0x30, 0x00, 0x48, 0x00, 
-    0x61, 0x00, 0x7A, 0x00, 0x86, 0x00, 0x7A, 0x00, 0x7A, 0x00, 0x92, 0x00, 0xB7, 0x00, 0xC4, 0x00, 
-    0xDC, 0x00, 0xDC, 0x00, 0xE8, 0x00, 0xC3, 0x00, 0xD0, 0x00, 0xB7, 0x00, 0xD0, 0x00, 0xC3, 0x00, 
-    0xDC, 0x00, 0xC3, 0x00, 0xD0, 0x00, 0xD0, 0x00, 0xB7, 0x00, 0xAB, 0x00, 0xB7, 0x00, 0xB7, 0x00, 
-    0xAB, 0x00, 0xC3, 0x00, 0xAA, 0x00, 0xB7, 0x00, 0x92, 0x00, 0x9E, 0x00, 0x86, 0x00, 0x86, 0x00, 
-    0x86, 0x00, 0x6D, 0x00, 0x61, 0x00, 0x48, 0x00, 0x23, 0x00, 0x17, 0x00, 0x0B, 0x00, 0xE7, 0xFF, 
-    0xF3, 0xFF, 0xCE, 0xFF, 0xDB, 0xFF, 0xE7, 0xFF, 0xDB, 0xFF, 0xE7, 0xFF, 0xDB, 0xFF, 0xCE, 0xFF, 
-    0xAA, 0xFF, 0x9D, 0xFF, 0x9E, 0xFF, 0x9E, 0xFF, 0xCF, 0xFF, 0xCF, 0xFF, 0xDB, 0xFF, 0xB6, 0xFF, 
-    0xC2, 0xFF, 0xB6, 0xFF, 0xB6, 0xFF, 0xC2, 0xFF, 0xCF, 0xFF, 0xDB, 0xFF, 0xE7, 0xFF, 0xF3, 0xFF, 
-    0xE7, 0xFF, 0xF3, 0xFF, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x0B, 0x00, 0x23, 0x00, 
-    0x23, 0x00, 0x23, 0x00, 0x17, 0x00, 0x2F, 0x00, 0x0B, 0x00, 0x23, 0x00, 0x2F, 0x00, 0x48, 0x00, 
-    0x79, 0x00, 0x85, 0x00, 0x79, 0x00, 0xA9, 0x00, 0x9D, 0x00, 0xCE, 0x00, 0xDA, 0x00, 0xCE, 0x00, 
-    0xFF, 0x00, 0xCE, 0x00, 0xF2, 0x00, 0x0B, 0x01, 0xFE, 0x00, 0x23, 0x01, 0x0A, 0x01, 0x0A, 0x01, 
-    0x0A, 0x01, 0x17, 0x01, 0x23, 0x01, 0x2F, 0x01, 0x16, 0x01, 0xFE, 0x00, 0xCD, 0x00, 0xC1, 0x00, 
-    0xC1, 0x00, 0xA9, 0x00, 0xB5, 0x00, 0x6C, 0x00, 0x54, 0x00, 0x17, 0x00, 0x23, 0x00, 0x0B, 0x00, 
-    0x00, 0x00, 0xDB, 0xFF, 0xCF, 0xFF, 0x9E, 0xFF, 0x7A, 0xFF, 0x7A, 0xFF, 0x6E, 0xFF, 0x6E, 0xFF, 
-    0x49, 0xFF, 0x3D, 0xFF, 0x31, 0xFF, 0x3D, 0xFF, 0x31, 0xFF, 0x19, 0xFF, 0x0D, 0xFF, 0x01, 0xFF, 
-    0x01, 0xFF, 0x01, 0xFF, 0x19, 0xFF, 0x0D, 0xFF, 0x0D, 0xFF, 0x0D, 0xFF, 0xF5, 0xFE, 0x0D, 0xFF, 
-    0x01, 0xFF, 0x19, 0xFF, 0x0D, 0xFF, 0x19, 0xFF, 0x19, 0xFF, 0x26, 0xFF, 0x32, 0xFF, 0x32, 0xFF, 
-    0x32, 0xFF, 0x32, 0xFF, 0x3E, 0xFF, 0x32, 0xFF, 0x3E, 0xFF, 0x4A, 0xFF, 0x62, 0xFF, 0x56, 0xFF, 
-    0x62, 0xFF, 0x4A, 0xFF, 0x6E, 0xFF, 0x56, 0xFF, 0x7B, 0xFF, 0x62, 0xFF, 0x7B, 0xFF, 0x62, 0xFF, 
-    0x63, 0xFF, 0x56, 0xFF, 0x56, 0xFF, 0x56, 0xFF, 0x4A, 0xFF, 0x4A, 0xFF, 0x57, 0xFF, 0x6F, 0xFF, 
-    0x7B, 0xFF, 0x6F, 0xFF, 0x87, 0xFF, 0x6F, 0xFF, 0x93, 0xFF, 0x87, 0xFF, 0x93, 0xFF, 0x87, 0xFF, 
-    0xC3, 0xFF, 0xAB, 0xFF, 0xE7, 0xFF, 0xDB, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 
-    0x2F, 0x00, 0x53, 0x00, 0x6B, 0x00, 0x6B, 0x00, 0x8F, 0x00, 0x9B, 0x00, 0xA7, 0x00, 0xCB, 0x00, 
-    0xBF, 0x00, 0xD7, 0x00, 0xE3, 0x00, 0xD7, 0x00, 0xD7, 0x00, 0xCB, 0x00, 0xE3, 0x00, 0xE3, 0x00, 
-    0xEF, 0x00, 0xFB, 0x00, 0xEF, 0x00, 0xEF, 0x00, 0xEF, 0x00, 0xD7, 0x00, 0xE3, 0x00, 0xD7, 0x00, 
-    0xBF, 0x00, 0xCA, 0x00, 0xB2, 0x00, 0xB2, 0x00, 0xB2, 0x00, 0x9A, 0x00, 0x8E, 0x00, 0x8E, 0x00, 
-    0x82, 0x00, 0x8E, 0x00, 0x76, 0x00, 0x82, 0x00, 0x5E, 0x00, 0x5E, 0x00, 0x5E, 0x00, 0x52, 0x00, 
-    0x5E, 0x00, 0x52, 0x00, 0x3A, 0x00, 0x46, 0x00, 0x16, 0x00, 0x16, 0x00, 0x00, 0x00, 0xDC, 0xFF, 
-    0xDC, 0xFF, 0xC4, 0xFF, 0xC4, 0xFF, 0xC4, 0xFF, 0xA0, 0xFF, 0xA0, 0xFF, 0xA0, 0xFF, 0xA0, 0xFF, 
-    0xA0, 0xFF, 0x94, 0xFF, 0x88, 0xFF, 0x7C, 0xFF, 0x7C, 0xFF, 0x88, 0xFF, 0xA0, 0xFF, 0xA0, 0xFF, 
-    0xAC, 0xFF, 0x88, 0xFF, 0x94, 0xFF, 0x7C, 0xFF, 0x88, 0xFF, 0x88, 0xFF, 0xA0, 0xFF, 0xA0, 0xFF, 
-    0xC4, 0xFF, 0xAC, 0xFF, 0xDC, 0xFF, 0xC4, 0xFF, 0xDC, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0x0A, 0x00, 
-    0x00, 0x00, 0x22, 0x00, 0x22, 0x00, 0x3A, 0x00, 0x2E, 0x00, 0x3A, 0x00, 0x22, 0x00, 0x3A, 0x00, 
-    0x3A, 0x00, 0x6A, 0x00, 0x6A, 0x00, 0x75, 0x00, 0x75, 0x00, 0x81, 0x00, 0x8D, 0x00, 0x8D, 0x00, 
-    0xA5, 0x00, 0xA5, 0x00, 0xA5, 0x00, 0xA5, 0x00, 0x99, 0x00, 0xA5, 0x00, 0xA5, 0x00, 0x99, 0x00, 
-    0x8D, 0x00, 0x81, 0x00, 0x75, 0x00, 0x69, 0x00, 0x69, 0x00, 0x52, 0x00, 0x52, 0x00, 0x22, 0x00, 
-    0x22, 0x00, 0xF4, 0xFF, 0xE8, 0xFF, 0xDC, 0xFF, 0xD0, 0xFF, 0xD0, 0xFF, 0xB8, 0xFF, 0xB8, 0xFF, 
-    0xAD, 0xFF, 0xAD, 0xFF, 0xA1, 0xFF, 0xAD, 0xFF, 0xA1, 0xFF, 0xA1, 0xFF, 0x89, 0xFF, 0x7D, 0xFF, 
-    0x7D, 0xFF, 0x71, 0xFF, 0x89, 0xFF, 0x95, 0xFF, 0x95, 0xFF, 0xAD, 0xFF, 0xA1, 0xFF, 0xB9, 0xFF, 
-    0xB9, 0xFF, 0xA1, 0xFF, 0xAD, 0xFF, 0xA1, 0xFF, 0x95, 0xFF, 0xA1, 0xFF, 0x95, 0xFF, 0xAD, 0xFF, 
-    0xAD, 0xFF, 0xB9, 0xFF, 0xB9, 0xFF, 0x95, 0xFF, 0xA1, 0xFF, 0xA1, 0xFF, 0xA1, 0xFF, 0xAD, 0xFF, 
-    0xB9, 0xFF, 0xC5, 0xFF, 0xC5, 0xFF, 0xB9, 0xFF, 0xB9, 0xFF, 0xC5, 0xFF, 0xD0, 0xFF, 0xE8, 0xFF, 
-    0xE8, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xE8, 0xFF, 0xE8, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x16, 0x00, 0x16, 0x00, 0x22, 0x00, 0x2D, 0x00, 
-    0x2D, 0x00, 0x2D, 0x00, 0x2D, 0x00, 0x39, 0x00, 0x39, 0x00, 0x39, 0x00, 0x39, 0x00, 0x45, 0x00, 
-    0x39, 0x00, 0x45, 0x00, 0x45, 0x00, 0x51, 0x00, 0x51, 0x00, 0x45, 0x00, 0x45, 0x00, 0x45, 0x00, 
-    0x45, 0x00, 0x39, 0x00, 0x45, 0x00, 0x50, 0x00, 0x45, 0x00, 0x45, 0x00, 0x39, 0x00, 0x45, 0x00, 
-    0x39, 0x00, 0x39, 0x00, 0x39, 0x00, 0x45, 0x00, 0x50, 0x00, 0x45, 0x00, 0x39, 0x00, 0x39, 0x00, 
-    0x22, 0x00, 0x22, 0x00, 0x2D, 0x00, 0x16, 0x00, 0x16, 0x00, 0x22, 0x00, 0x16, 0x00, 0x16, 0x00, 
-    0x21, 0x00, 0x2D, 0x00, 0x2D, 0x00, 0x2D, 0x00, 0x16, 0x00, 0x16, 0x00, 0xF4, 0xFF, 0x0A, 0x00, 
-    0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xDD, 0xFF, 0xD1, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 
-    0xDD, 0xFF, 0xD1, 0xFF, 0xBA, 0xFF, 0xAE, 0xFF, 0xAE, 0xFF, 0xBA, 0xFF, 0xC5, 0xFF, 0xC5, 0xFF, 
-    0xD1, 0xFF, 0xC5, 0xFF, 0xC5, 0xFF, 0xC5, 0xFF, 0xD1, 0xFF, 0xD1, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 
-    0xDD, 0xFF, 0xDD, 0xFF, 0xD1, 0xFF, 0xD1, 0xFF, 0xD1, 0xFF, 0xC6, 0xFF, 0xC6, 0xFF, 0xD1, 0xFF, 
-    0xE8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x16, 0x00, 0x16, 0x00, 0x21, 0x00, 0x21, 0x00, 0x16, 0x00, 
-    0x21, 0x00, 0x2D, 0x00, 0x38, 0x00, 0x44, 0x00, 0x2D, 0x00, 0x44, 0x00, 0x44, 0x00, 0x38, 0x00, 
-    0x44, 0x00, 0x44, 0x00, 0x44, 0x00, 0x44, 0x00, 0x38, 0x00, 0x38, 0x00, 0x2D, 0x00, 0x21, 0x00, 
-    0x21, 0x00, 0x16, 0x00, 0x16, 0x00, 0x00, 0x00, 0xE8, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 
-    0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x21, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 
-    0xD2, 0xFF, 0xC6, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xC6, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xBB, 0xFF, 
-    0xBB, 0xFF, 0xBB, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 
-    0xDD, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x21, 0x00, 0x2C, 0x00, 
-    0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 
-    0x15, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x20, 0x00, 0x2C, 0x00, 
-    0x2C, 0x00, 0x37, 0x00, 0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x0A, 0x00, 0x20, 0x00, 0x20, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x20, 0x00, 
-    0x21, 0x00, 0x15, 0x00, 0x2C, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x21, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x21, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x21, 0x00, 0x2C, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xD2, 0xFF, 0xC6, 0xFF, 0xBB, 0xFF, 0xAF, 0xFF, 
-    0xAF, 0xFF, 0xA3, 0xFF, 0xA3, 0xFF, 0xAF, 0xFF, 0xBA, 0xFF, 0xBA, 0xFF, 0xBA, 0xFF, 0xBA, 0xFF, 
-    0xBA, 0xFF, 0xA3, 0xFF, 0xAF, 0xFF, 0xBA, 0xFF, 0xAF, 0xFF, 0xC6, 0xFF, 0xC6, 0xFF, 0xBA, 0xFF, 
-    0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xD1, 0xFF, 0xD1, 0xFF, 0xE8, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x21, 0x00, 0x2D, 0x00, 0x44, 0x00, 0x39, 0x00, 0x44, 0x00, 
-    0x44, 0x00, 0x50, 0x00, 0x5C, 0x00, 0x5C, 0x00, 0x5C, 0x00, 0x50, 0x00, 0x50, 0x00, 0x50, 0x00, 
-    0x45, 0x00, 0x5C, 0x00, 0x50, 0x00, 0x74, 0x00, 0x68, 0x00, 0x74, 0x00, 0x74, 0x00, 0x68, 0x00, 
-    0x5C, 0x00, 0x51, 0x00, 0x51, 0x00, 0x45, 0x00, 0x39, 0x00, 0x39, 0x00, 0x2E, 0x00, 0x2E, 0x00, 
-    0x16, 0x00, 0x16, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0xE8, 0xFF, 0xE8, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xDC, 0xFF, 
-    0xDC, 0xFF, 0xE8, 0xFF, 0xDC, 0xFF, 0xDC, 0xFF, 0xD0, 0xFF, 0xD0, 0xFF, 0xC4, 0xFF, 0xC4, 0xFF, 
-    0xC4, 0xFF, 0xB8, 0xFF, 0xAC, 0xFF, 0xAC, 0xFF, 0xA0, 0xFF, 0xA0, 0xFF, 0xAC, 0xFF, 0xA0, 0xFF, 
-    0xAC, 0xFF, 0xAC, 0xFF, 0xB8, 0xFF, 0xAC, 0xFF, 0xAC, 0xFF, 0xAC, 0xFF, 0xAC, 0xFF, 0xAC, 0xFF, 
-    0xC4, 0xFF, 0xD0, 0xFF, 0xC4, 0xFF, 0xB7, 0xFF, 0xB7, 0xFF, 0xCF, 0xFF, 0xCF, 0xFF, 0xE7, 0xFF, 
-    0xF3, 0xFF, 0xF3, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x17, 0x00, 0x53, 0x00, 0x3B, 0x00, 
-    0xB4, 0x00, 0x53, 0x00, 0x14, 0x01, 0x77, 0x00, 0x55, 0x05, 0x3F, 0x0A, 0xBF, 0x07, 0xDF, 0x03, 
-    0x96, 0xFD, 0x64, 0xFE, 0xF6, 0xFD, 0x92, 0xFF, 0x60, 0x00, 0x16, 0x01, 0x53, 0x00, 0x6F, 0xFE, 
-    0x10, 0xFB, 0x6F, 0xFD, 0xF5, 0xFC, 0x7A, 0xFE, 0xE8, 0xFE, 0x86, 0xFE, 0xCF, 0xFF, 0x55, 0xFE, 
-    0xAA, 0xFE, 0x18, 0xFE, 0x30, 0xFD, 0x54, 0xFD, 0xB5, 0xFC, 0xCD, 0xFC, 0x9D, 0xFE, 0x3B, 0xFE, 
-    0x79, 0xFF, 0x3B, 0xFE, 0x48, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xB6, 0xFF, 
-    0xDB, 0xFF, 0x6C, 0xFF, 0x22, 0xFF, 0x30, 0x00, 0xF7, 0x01, 0x18, 0x06, 0x1C, 0x02, 0xE3, 0x03, 
-    0x55, 0x00, 0xD5, 0x02, 0x64, 0x01, 0x33, 0x01, 0x0E, 0x01, 0x4C, 0x01, 0xA9, 0xFF, 0x9F, 0x00, 
-    0x05, 0xFE, 0x93, 0x00, 0x4F, 0xFE, 0x64, 0xFD, 0xE8, 0xFC, 0x6F, 0xFD, 0x5F, 0xFF, 0x7F, 0xFE, 
-    0x5E, 0xFF, 0x73, 0xFE, 0xA4, 0xFE, 0x7F, 0xFE, 0x07, 0xFF, 0x72, 0xFE, 0x55, 0x00, 0x40, 0xFE, 
-    0x51, 0xFF, 0x2E, 0xFD, 0x38, 0xFF, 0xDA, 0xFF, 0x17, 0x00, 0x62, 0x00, 0x5D, 0xFF, 0x8F, 0xFF, 
-    0xCE, 0xFF, 0x5D, 0xFF, 0x30, 0x00, 0x88, 0x00, 0x7B, 0x00, 0x24, 0x00, 0x6F, 0xFE, 0xA8, 0xFF, 
-    0xDA, 0xFF, 0x31, 0x00, 0x9B, 0xFF, 0x2A, 0xFF, 0x7B, 0xFE, 0xD3, 0xFE, 0x23, 0xFE, 0x1E, 0xFF, 
-    0x37, 0xFF, 0x63, 0x00, 0x75, 0xFF, 0xEB, 0xFE, 0xC6, 0xFE, 0x24, 0x00, 0x7C, 0x00, 0x70, 0x00, 
-    0xC1, 0xFF, 0xB4, 0xFF, 0x00, 0x00, 0x70, 0x00, 0x13, 0x01, 0xED, 0x00, 0xB6, 0x01, 0xA2, 0x00, 
-    0xA2, 0x00, 0x00, 0x00, 0x1F, 0x01, 0x52, 0x01, 0x45, 0x01, 0x70, 0x00, 0xBB, 0x00, 0xD4, 0x00, 
-    0xC3, 0x01, 0x6B, 0x01, 0x77, 0x01, 0x06, 0x01, 0xBB, 0x00, 0x31, 0x00, 0x0B, 0x00, 0xAE, 0x00, 
-    0x1F, 0x01, 0x1F, 0x01, 0x63, 0x00, 0xB4, 0xFF, 0xA8, 0xFF, 0x0B, 0x00, 0xDA, 0xFF, 0xC1, 0xFF, 
-    0x69, 0xFF, 0xCD, 0xFF, 0xA8, 0xFF, 0x0B, 0x00, 0x4A, 0x00, 0xD4, 0x00, 0xAE, 0x00, 0x24, 0x00, 
-    0xF3, 0xFF, 0x18, 0x00, 0xFA, 0x00, 0x13, 0x01, 0xED, 0x00, 0xE1, 0x00, 0xE1, 0x00, 0xE1, 0x00, 
-    0xFA, 0x00, 0x39, 0x01, 0xCF, 0x01, 0x9D, 0x01, 0x84, 0x01, 0x2C, 0x01, 0x91, 0x01, 0x27, 0x02, 
-    0x34, 0x02, 0xCF, 0x01, 0x6B, 0x01, 0x52, 0x01, 0x9D, 0x01, 0x6B, 0x01, 0x6B, 0x01, 0xD4, 0x00, 
-    0xED, 0x00, 0xFA, 0x00, 0xD4, 0x00, 0x45, 0x01, 0x91, 0x01, 0x02, 0x02, 0x0E, 0x02, 0x06, 0x01, 
-    0x95, 0x00, 0x7C, 0x00, 0xC1, 0xFF, 0x3D, 0x00, 0x0B, 0x00, 0x18, 0x00, 0x63, 0x00, 0x0B, 0x00, 
-    0x9B, 0xFF, 0xDA, 0xFF, 0x43, 0xFF, 0xEB, 0xFE, 0xC5, 0xFE, 0xAC, 0xFE, 0xD2, 0xFE, 0x2A, 0xFF, 
-    0x69, 0xFF, 0x00, 0x00, 0xF3, 0xFF, 0xB4, 0xFF, 0x9B, 0xFF, 0xC1, 0xFF, 0xF3, 0xFF, 0x4A, 0x00, 
-    0x00, 0x00, 0xE6, 0xFF, 0x9B, 0xFF, 0x9B, 0xFF, 0xC1, 0xFF, 0xC1, 0xFF, 0x69, 0xFF, 0x50, 0xFF, 
-    0xD2, 0xFE, 0xDE, 0xFE, 0xAC, 0xFE, 0xA0, 0xFE, 0x93, 0xFE, 0x3B, 0xFE, 0xEF, 0xFD, 0x97, 0xFD, 
-    0x26, 0xFD, 0x0D, 0xFD, 0xE7, 0xFC, 0x9C, 0xFC, 0x83, 0xFC, 0x2B, 0xFC, 0xF9, 0xFB, 0xDF, 0xFB, 
-    0x12, 0xFC, 0x37, 0xFC, 0x44, 0xFC, 0x76, 0xFC, 0xC2, 0xFC, 0x01, 0xFD, 0x97, 0xFD, 0x7E, 0xFD, 
-    0x4C, 0xFD, 0xF4, 0xFC, 0xC2, 0xFC, 0x33, 0xFD, 0x8B, 0xFD, 0xEF, 0xFD, 0xA4, 0xFD, 0x33, 0xFD, 
-    0x26, 0xFD, 0x72, 0xFD, 0x58, 0xFD, 0xD6, 0xFD, 0xD6, 0xFD, 0x47, 0xFE, 0xEF, 0xFD, 0xBD, 0xFD, 
-    0xBD, 0xFD, 0xFC, 0xFD, 0x86, 0xFE, 0x9F, 0xFE, 0x47, 0xFE, 0x2A, 0xFF, 0x36, 0xFF, 0xB4, 0xFF, 
-    0xB4, 0xFF, 0x5C, 0xFF, 0x00, 0x00, 0x8E, 0xFF, 0x2A, 0xFF, 0x75, 0xFF, 0x52, 0x01, 0x4D, 0x05, 
-    0xAC, 0x09, 0x8E, 0x0D, 0x1C, 0x10, 0x57, 0x11, 0x96, 0x11, 0x42, 0x10, 0xD1, 0x0F, 0xEF, 0x0E, 
-    0x92, 0x0F, 0x9F, 0x0F, 0xC9, 0x0E, 0xBC, 0x0E, 0x00, 0x0E, 0x75, 0x0D, 0x09, 0x0C, 0x40, 0x08, 
-    0x34, 0x05, 0x2C, 0x01, 0x08, 0xFE, 0x04, 0xFC, 0x59, 0xFA, 0x4C, 0xFA, 0x51, 0xF9, 0x61, 0xF8, 
-    0x27, 0xF7, 0x83, 0xF6, 0x44, 0xF6, 0xEC, 0xF5, 0x6E, 0xF5, 0x55, 0xF5, 0xE0, 0xF5, 0xA5, 0xF7, 
-    0x44, 0xF9, 0x76, 0xFC, 0x60, 0xFE, 0x89, 0x00, 0x91, 0x01, 0xB7, 0x01, 0x74, 0x02, 0xA6, 0x02, 
-    0x63, 0x03, 0x1F, 0x04, 0x6B, 0x04, 0x73, 0x05, 0x30, 0x06, 0x38, 0x07, 0x9D, 0x07, 0xC7, 0x06, 
-    0xE5, 0x05, 0xD4, 0x03, 0x02, 0x02, 0x00, 0x00, 0x9F, 0xFE, 0x97, 0xFD, 0xCD, 0xFC, 0xEB, 0xFB, 
-    0x47, 0xFB, 0xEF, 0xFA, 0x08, 0xFB, 0x58, 0xFA, 0xC1, 0xF9, 0x04, 0xF9, 0xB9, 0xF8, 0x5C, 0xF9, 
-    0x19, 0xFA, 0xD2, 0xFB, 0x25, 0xFD, 0x47, 0xFE, 0x4F, 0xFF, 0xF3, 0xFF, 0x57, 0x00, 0x46, 0x01, 
-    0xFA, 0x00, 0x52, 0x01, 0x52, 0x01, 0x03, 0x02, 0x18, 0x03, 0x07, 0x04, 0x85, 0x04, 0x78, 0x04, 
-    0x07, 0x04, 0x4A, 0x03, 0xDD, 0x01, 0x96, 0x00, 0x9B, 0xFF, 0x79, 0xFE, 0xA3, 0xFD, 0x5C, 0xFC, 
-    0xD1, 0xFB, 0x86, 0xFB, 0x54, 0xFB, 0xD6, 0xFA, 0x25, 0xFA, 0x9B, 0xF9, 0x8E, 0xF9, 0xCD, 0xF9, 
-    0x97, 0xFA, 0x92, 0xFB, 0xB4, 0xFC, 0xBC, 0xFD, 0x92, 0xFE, 0x68, 0xFF, 0x57, 0x00, 0xD5, 0x00, 
-    0x39, 0x01, 0x39, 0x01, 0xA2, 0x00, 0x70, 0x00, 0x3D, 0x00, 0x4A, 0x00, 0x63, 0x00, 0xF3, 0xFF, 
-    0xF7, 0xFE, 0xD6, 0xFD, 0x68, 0xFC, 0x92, 0xFB, 0x60, 0xFB, 0x60, 0xFB, 0xC5, 0xFB, 0xB8, 0xFB, 
-    0x47, 0xFB, 0xBC, 0xFA, 0xD6, 0xFA, 0x97, 0xFA, 0x08, 0xFB, 0x97, 0xFA, 0xF3, 0xF9, 0xC1, 0xF9, 
-    0xDA, 0xF9, 0x8A, 0xFA, 0x92, 0xFB, 0x04, 0xFC, 0xC1, 0xFC, 0xCD, 0xFC, 0x9B, 0xFC, 0x8A, 0xFD, 
-    0xB0, 0xFD, 0x47, 0xFE, 0x08, 0xFE, 0x19, 0xFD, 0x64, 0xFD, 0x8A, 0xFD, 0x47, 0xFE, 0x5C, 0xFF, 
-    0xEB, 0xFE, 0x68, 0xFF, 0x04, 0xFF, 0x53, 0xFE, 0xFB, 0xFD, 0x19, 0xFD, 0xCD, 0xFC, 0x0C, 0xFD, 
-    0xF3, 0xFC, 0x8A, 0xFD, 0x21, 0xFE, 0xCD, 0xFF, 0x28, 0x05, 0xE9, 0x0D, 0xD8, 0x17, 0x35, 0x1D, 
-    0xCC, 0x1D, 0x30, 0x1B, 0xA2, 0x18, 0x74, 0x17, 0xED, 0x15, 0x95, 0x15, 0x95, 0x15, 0xC3, 0x13, 
-    0x0F, 0x11, 0x52, 0x0D, 0x0F, 0x0B, 0x1C, 0x0B, 0xC4, 0x07, 0xB3, 0x02, 0x54, 0xFB, 0x54, 0xF5, 
-    0x2A, 0xF3, 0x9F, 0xF2, 0x8E, 0xF3, 0x82, 0xF3, 0x36, 0xF3, 0xEB, 0xF2, 0xB8, 0xF2, 0xDA, 0xF3, 
-    0x6D, 0xF5, 0x2E, 0xF8, 0xA7, 0xF9, 0x75, 0xF9, 0x71, 0xFA, 0x9B, 0xFC, 0xF6, 0x01, 0x7C, 0x06, 
-    0x18, 0x09, 0x6B, 0x0A, 0x95, 0x09, 0x63, 0x09, 0xF2, 0x08, 0x8D, 0x08, 0x28, 0x08, 0x4A, 0x06, 
-    0x6C, 0x04, 0xBF, 0x02, 0xA6, 0x02, 0x70, 0x03, 0xFA, 0x03, 0xFE, 0x02, 0x75, 0xFF, 0x04, 0xFC, 
-    0x93, 0xF8, 0x58, 0xF7, 0xDA, 0xF6, 0x04, 0xF6, 0x4F, 0xF6, 0x69, 0xF6, 0x58, 0xF7, 0xDA, 0xF9, 
-    0xAC, 0xFB, 0x3A, 0xFE, 0x5C, 0xFF, 0x4F, 0xFF, 0xCD, 0xFF, 0xA2, 0x00, 0x0F, 0x02, 0x13, 0x04, 
-    0x5B, 0x05, 0x80, 0x05, 0xB3, 0x05, 0x03, 0x05, 0xAA, 0x04, 0x9E, 0x04, 0x0B, 0x03, 0x39, 0x01, 
-    0x4F, 0xFF, 0x3F, 0xFD, 0x19, 0xFD, 0x9B, 0xFC, 0x9B, 0xFC, 0x1D, 0xFC, 0x60, 0xFB, 0xEF, 0xFA, 
-    0xB0, 0xFA, 0x92, 0xFB, 0xDE, 0xFB, 0x86, 0xFB, 0x15, 0xFB, 0x10, 0xF9, 0xAC, 0xF8, 0xC1, 0xF9, 
-    0xE2, 0xFA, 0xB0, 0xFD, 0x00, 0x00, 0xC8, 0x00, 0xD0, 0x01, 0x91, 0x01, 0x5F, 0x01, 0x8D, 0x02, 
-    0xF6, 0x01, 0x2D, 0x01, 0xBB, 0x00, 0xC1, 0xFF, 0xA2, 0x00, 0x91, 0x01, 0x91, 0x01, 0x28, 0x02, 
-    0x07, 0x01, 0x9B, 0xFF, 0x79, 0xFE, 0x19, 0xFD, 0x0C, 0xFD, 0x4F, 0xFC, 0xDE, 0xFB, 0x47, 0xFB, 
-    0xBC, 0xFA, 0xDE, 0xFB, 0xDA, 0xFC, 0xBC, 0xFD, 0x08, 0xFE, 0xF3, 0xFC, 0xB4, 0xFC, 0x43, 0xFC, 
-    0x43, 0xFC, 0x7D, 0xFD, 0x53, 0xFE, 0x4F, 0xFF, 0xC1, 0xFF, 0x5C, 0xFF, 0x8E, 0xFF, 0x31, 0x00, 
-    0xDA, 0xFF, 0xD1, 0xFE, 0xF3, 0xFC, 0xC9, 0xFA, 0x00, 0xFA, 0xCD, 0xF9, 0xE6, 0xF9, 0xB0, 0xFA, 
-    0xD6, 0xFA, 0xD6, 0xFA, 0xA3, 0xFA, 0x0C, 0xFA, 0x32, 0xFA, 0xE6, 0xF9, 0x4F, 0xF9, 0x9F, 0xF8, 
-    0x8A, 0xF7, 0x86, 0xF8, 0x7E, 0xFA, 0xF3, 0xFC, 0xC5, 0xFE, 0x36, 0xFF, 0x4F, 0xFF, 0xB4, 0xFF, 
-    0xDA, 0xFF, 0x13, 0x01, 0xDD, 0x01, 0x74, 0x02, 0x28, 0x02, 0x9E, 0x01, 0x85, 0x01, 0xD0, 0x01, 
-    0x42, 0x02, 0xD4, 0x03, 0x70, 0x09, 0x99, 0x14, 0x13, 0x1F, 0x73, 0x23, 0x2C, 0x22, 0xDC, 0x1C, 
-    0x20, 0x19, 0x20, 0x16, 0x63, 0x12, 0xBB, 0x0F, 0x5F, 0x0D, 0xFA, 0x09, 0x18, 0x06, 0xE9, 0x01, 
-    0x13, 0x01, 0x9A, 0x02, 0x9E, 0x01, 0xDA, 0xFC, 0x54, 0xF5, 0x60, 0xEF, 0xF3, 0xED, 0xD2, 0xEF, 
-    0xB0, 0xF1, 0xC5, 0xF2, 0xF3, 0xF3, 0xB8, 0xF5, 0xD1, 0xF8, 0x75, 0xFC, 0x96, 0x00, 0xE9, 0x04, 
-    0x89, 0x06, 0xCC, 0x05, 0x46, 0x04, 0x46, 0x04, 0x1C, 0x08, 0x74, 0x0B, 0xD4, 0x0C, 0xFE, 0x0B, 
-    0xE1, 0x09, 0x8D, 0x08, 0x91, 0x07, 0x8D, 0x05, 0xFE, 0x02, 0x04, 0xFF, 0xEF, 0xFA, 0x86, 0xF8, 
-    0x8A, 0xF7, 0x10, 0xF9, 0xC5, 0xFB, 0xC1, 0xFC, 0x1D, 0xFC, 0x19, 0xFA, 0xEF, 0xF7, 0xFB, 0xF7, 
-    0xFB, 0xF7, 0x2E, 0xF8, 0x3A, 0xF8, 0xAC, 0xF8, 0xD6, 0xFA, 0x2E, 0xFE, 0xC4, 0x01, 0xF6, 0x04, 
-    0x89, 0x06, 0x7C, 0x06, 0xBF, 0x05, 0x35, 0x05, 0xDD, 0x04, 0x8D, 0x05, 0x9A, 0x05, 0x6C, 0x04, 
-    0xBF, 0x02, 0x89, 0x00, 0xCD, 0xFF, 0xA7, 0xFF, 0xDE, 0xFE, 0x4B, 0xFD, 0xB0, 0xFA, 0xB8, 0xF8, 
-    0xD6, 0xF7, 0x71, 0xF7, 0x3A, 0xF8, 0xDE, 0xF8, 0xC1, 0xF9, 0x32, 0xFA, 0xA3, 0xFA, 0x86, 0xFB, 
-    0x32, 0xFD, 0x68, 0xFF, 0xAF, 0x00, 0xC8, 0x00, 0x4A, 0x00, 0x4A, 0x00, 0xB7, 0x01, 0xBF, 0x02, 
-    0x85, 0x04, 0x35, 0x05, 0x2D, 0x04, 0x2D, 0x04, 0x81, 0x02, 0x28, 0x02, 0x74, 0x02, 0xFA, 0x00, 
-    0x4F, 0xFF, 0xDA, 0xFC, 0x58, 0xFA, 0x0C, 0xFA, 0xF3, 0xF9, 0xA3, 0xFA, 0x3A, 0xFB, 0x08, 0xFB, 
-    0xEF, 0xFA, 0x79, 0xFB, 0x75, 0xFC, 0x4B, 0xFD, 0x53, 0xFE, 0x47, 0xFE, 0xD6, 0xFD, 0xE2, 0xFD, 
-    0x79, 0xFE, 0x00, 0x00, 0x78, 0x01, 0xD0, 0x01, 0x52, 0x01, 0x57, 0x00, 0x68, 0xFF, 0xC5, 0xFE, 
-    0x47, 0xFE, 0x7D, 0xFD, 0x36, 0xFC, 0x2E, 0xFB, 0x58, 0xFA, 0x64, 0xFA, 0x8A, 0xFA, 0x3F, 0xFA, 
-    0xB4, 0xF9, 0xAC, 0xF8, 0xD6, 0xF7, 0x71, 0xF7, 0x97, 0xF7, 0x60, 0xF8, 0xF7, 0xF8, 0x69, 0xF9, 
-    0x4B, 0xFA, 0xAC, 0xFB, 0x3F, 0xFD, 0x43, 0xFF, 0x57, 0x00, 0x00, 0x00, 0x43, 0xFF, 0x86, 0xFE, 
-    0x04, 0xFF, 0x89, 0x00, 0x39, 0x01, 0x91, 0x01, 0x78, 0x01, 0xEE, 0x00, 0x63, 0x00, 0x57, 0x00, 
-    0x57, 0x00, 0x4A, 0x00, 0xDA, 0xFF, 0x8A, 0xFD, 0xB8, 0xFB, 0x4B, 0xFA, 0x8E, 0xF9, 0x3F, 0xFA, 
-    0x0C, 0xFA, 0x64, 0xFD, 0x7C, 0x06, 0x67, 0x14, 0xC3, 0x1F, 0x99, 0x23, 0xFE, 0x20, 0xD0, 0x1C, 
-    0x8D, 0x1A, 0x6F, 0x18, 0x7C, 0x15, 0xE1, 0x12, 0x13, 0x10, 0x24, 0x0C, 0x9E, 0x07, 0x46, 0x04, 
-    0x03, 0x05, 0xD4, 0x06, 0x5B, 0x05, 0x5C, 0xFF, 0x3F, 0xF7, 0xE2, 0xF1, 0xCD, 0xF0, 0xAC, 0xF2, 
-    0x4F, 0xF3, 0xEB, 0xF2, 0xC5, 0xF2, 0x64, 0xF4, 0x47, 0xF8, 0xF3, 0xFC, 0x5B, 0x02, 0x70, 0x06, 
-    0xDD, 0x07, 0xFE, 0x05, 0x31, 0x03, 0x31, 0x03, 0xBF, 0x05, 0x74, 0x08, 0x24, 0x09, 0x39, 0x07, 
-    0xA6, 0x05, 0xE9, 0x04, 0x4E, 0x05, 0x42, 0x05, 0xD9, 0x02, 0x43, 0xFF, 0x60, 0xFB, 0x93, 0xF8, 
-    0xBD, 0xF7, 0xAC, 0xF8, 0x71, 0xFA, 0x47, 0xFB, 0x97, 0xFA, 0x93, 0xF8, 0x15, 0xF8, 0x43, 0xF9, 
-    0xEF, 0xFA, 0x10, 0xFC, 0x92, 0xFB, 0x6D, 0xFB, 0xA7, 0xFC, 0x1D, 0xFF, 0x8D, 0x02, 0x03, 0x05, 
-    0x4A, 0x06, 0x52, 0x07, 0x9E, 0x07, 0xF6, 0x07, 0x03, 0x08, 0x03, 0x08, 0x6B, 0x07, 0x5B, 0x05, 
-    0xD0, 0x01, 0x79, 0xFE, 0x43, 0xFC, 0x86, 0xFB, 0xFB, 0xFA, 0x8E, 0xF9, 0x47, 0xF8, 0xD6, 0xF7, 
-    0xB0, 0xF7, 0x21, 0xF8, 0xEF, 0xF7, 0xD6, 0xF7, 0x75, 0xF9, 0x79, 0xFB, 0x4F, 0xFC, 0x64, 0xFD, 
-    0x0C, 0xFD, 0x97, 0xFD, 0x36, 0xFF, 0x1D, 0xFF, 0xF3, 0xFF, 0x2D, 0x01, 0x0F, 0x02, 0x4A, 0x03, 
-    0x18, 0x03, 0x74, 0x02, 0x31, 0x03, 0x89, 0x03, 0x70, 0x03, 0xCC, 0x02, 0x2D, 0x01, 0x00, 0x00, 
-    0x8E, 0xFF, 0x29, 0xFF, 0x15, 0xFE, 0x64, 0xFD, 0xDA, 0xFC, 0xCD, 0xFC, 0xF3, 0xFC, 0x32, 0xFD, 
-    0xB0, 0xFD, 0x15, 0xFE, 0x6D, 0xFE, 0xBC, 0xFD, 0xDA, 0xFC, 0x9B, 0xFC, 0xB4, 0xFC, 0xBC, 0xFD, 
-    0x2E, 0xFE, 0xE2, 0xFD, 0xEF, 0xFD, 0x21, 0xFE, 0x79, 0xFE, 0xDE, 0xFE, 0x9F, 0xFE, 0x2E, 0xFE, 
-    0x15, 0xFE, 0xC9, 0xFD, 0x25, 0xFD, 0x25, 0xFD, 0x00, 0xFD, 0xDA, 0xFC, 0x04, 0xFC, 0x32, 0xFA, 
-    0x04, 0xF9, 0x47, 0xF8, 0x3A, 0xF8, 0x3A, 0xF8, 0x3A, 0xF8, 0x04, 0xF9, 0x32, 0xFA, 0x04, 0xFC, 
-    0x0C, 0xFD, 0xD6, 0xFD, 0x3A, 0xFE, 0x3A, 0xFE, 0x25, 0xFD, 0xF7, 0xFB, 0x2A, 0xFC, 0x43, 0xFC, 
-    0x21, 0xFE, 0x04, 0xFF, 0x9B, 0xFF, 0x3D, 0x00, 0x63, 0x00, 0x89, 0x00, 0x70, 0x00, 0xA7, 0xFF, 
-    0x75, 0xFF, 0x86, 0xFE, 0xB4, 0xFC, 0xFB, 0xFA, 0xE6, 0xF9, 0xEF, 0xFA, 0x15, 0xFB, 0x9B, 0xFC, 
-    0xC4, 0x01, 0xF6, 0x0D, 0x91, 0x1C, 0x3D, 0x24, 0x91, 0x25, 0xE0, 0x21, 0x13, 0x1F, 0x73, 0x1D, 
-    0x13, 0x19, 0x30, 0x15, 0x35, 0x11, 0xED, 0x0C, 0x5B, 0x08, 0x81, 0x02, 0xBB, 0x00, 0x67, 0x02, 
-    0xC8, 0x03, 0x0F, 0x02, 0xC5, 0xFB, 0x3A, 0xF5, 0x58, 0xF1, 0x58, 0xF1, 0xA3, 0xF1, 0x69, 0xF0, 
-    0x08, 0xEF, 0x08, 0xEF, 0x54, 0xF2, 0xB4, 0xF6, 0xB4, 0xFC, 0x7C, 0x03, 0x35, 0x08, 0xE9, 0x0A, 
-    0x95, 0x09, 0xE9, 0x07, 0x5B, 0x08, 0x31, 0x09, 0x89, 0x09, 0xB7, 0x07, 0xDD, 0x04, 0x0B, 0x03, 
-    0xE5, 0x02, 0x89, 0x03, 0x31, 0x03, 0x78, 0x01, 0x53, 0xFE, 0x2A, 0xFC, 0x71, 0xFA, 0x04, 0xF9, 
-    0x5C, 0xF9, 0x10, 0xF9, 0xF7, 0xF8, 0x2E, 0xF8, 0xCD, 0xF6, 0x7E, 0xF7, 0x36, 0xF9, 0x92, 0xFB, 
-    0x0C, 0xFD, 0xA3, 0xFD, 0x9F, 0xFE, 0x70, 0x00, 0xA6, 0x02, 0x6C, 0x04, 0x80, 0x05, 0xCC, 0x05, 
-    0x7C, 0x06, 0x5F, 0x07, 0xB7, 0x07, 0x35, 0x08, 0x03, 0x08, 0xD4, 0x06, 0x91, 0x04, 0xE1, 0x00, 
-    0xC9, 0xFD, 0x3A, 0xFB, 0x75, 0xF9, 0xC9, 0xF7, 0xF7, 0xF5, 0xFC, 0xF4, 0x47, 0xF5, 0xE6, 0xF6, 
-    0x54, 0xF8, 0xB4, 0xF9, 0x7E, 0xFA, 0x54, 0xFB, 0xF3, 0xFC, 0x00, 0xFD, 0x7D, 0xFD, 0xBC, 0xFD, 
-    0xFB, 0xFD, 0xDE, 0xFE, 0x1D, 0xFF, 0x63, 0x00, 0xA6, 0x02, 0x39, 0x04, 0x42, 0x05, 0x5F, 0x04, 
-    0xCC, 0x02, 0xE9, 0x01, 0xD5, 0x00, 0x31, 0x00, 0xEB, 0xFE, 0x71, 0xFD, 0xEB, 0xFB, 0x47, 0xFB, 
-    0x47, 0xFB, 0x2A, 0xFC, 0x8A, 0xFD, 0xFB, 0xFD, 0x60, 0xFE, 0x58, 0xFD, 0xB4, 0xFC, 0x0C, 0xFD, 
-    0x8A, 0xFD, 0x08, 0xFE, 0xFB, 0xFD, 0x58, 0xFD, 0x7D, 0xFD, 0xE2, 0xFD, 0x4F, 0xFF, 0x07, 0x01, 
-    0x0F, 0x02, 0xCC, 0x02, 0x67, 0x02, 0x03, 0x02, 0x52, 0x01, 0x89, 0x00, 0xF3, 0xFF, 0xD1, 0xFE, 
-    0xA3, 0xFD, 0x5C, 0xFC, 0xB8, 0xFB, 0x15, 0xFB, 0xBC, 0xFA, 0xA7, 0xF9, 0xFB, 0xF7, 0xDA, 0xF6, 
-    0x43, 0xF6, 0x69, 0xF6, 0xE6, 0xF6, 0x3F, 0xF7, 0x64, 0xF7, 0xEF, 0xF7, 0xC5, 0xF8, 0x25, 0xFA, 
-    0x47, 0xFB, 0x4F, 0xFC, 0x25, 0xFD, 0x3A, 0xFE, 0x75, 0xFF, 0x24, 0x00, 0xBB, 0x00, 0x96, 0x00, 
-    0x0B, 0x00, 0x3D, 0x00, 0x4A, 0x00, 0x20, 0x01, 0x1C, 0x02, 0xA6, 0x02, 0xAB, 0x01, 0xF3, 0xFF, 
-    0x58, 0xFD, 0x36, 0xFC, 0x79, 0xFB, 0x0C, 0xFA, 0x92, 0xFB, 0x2D, 0x04, 0x9E, 0x13, 0x67, 0x20, 
-    0xBF, 0x26, 0xA1, 0x24, 0x9D, 0x22, 0x3D, 0x21, 0x78, 0x1F, 0x56, 0x1B, 0x13, 0x16, 0x07, 0x10, 
-    0xFE, 0x08, 0xE1, 0x00, 0x54, 0xFB, 0x04, 0xFC, 0x43, 0xFF, 0x9E, 0x01, 0x4F, 0xFF, 0x00, 0xFA, 
-    0x1D, 0xF6, 0x79, 0xF5, 0x36, 0xF6, 0xFC, 0xF4, 0xD6, 0xF1, 0x58, 0xEE, 0x9B, 0xED, 0xF7, 0xEF, 
-    0x47, 0xF5, 0xB4, 0xFC, 0xD4, 0x03, 0xD4, 0x09, 0x31, 0x0C, 0xC8, 0x0C, 0x39, 0x0D, 0x80, 0x0E, 
-    0xF2, 0x0E, 0x07, 0x0D, 0x0F, 0x08, 0x9A, 0x02, 0x82, 0xFF, 0x36, 0xFF, 0x4A, 0x00, 0xC1, 0xFF, 
-    0x60, 0xFE, 0xCD, 0xFC, 0x4F, 0xFC, 0x68, 0xFC, 0x58, 0xFD, 0xF3, 0xFC, 0xC5, 0xFB, 0x82, 0xF9, 
-    0x82, 0xF6, 0x60, 0xF5, 0xB8, 0xF5, 0xB0, 0xF7, 0xC1, 0xF9, 0x54, 0xFB, 0x82, 0xFC, 0x92, 0xFE, 
-    0x78, 0x01, 0x46, 0x04, 0xE5, 0x05, 0xF2, 0x05, 0xE5, 0x05, 0xFE, 0x05, 0x70, 0x06, 0x57, 0x06, 
-    0xF2, 0x05, 0xE9, 0x04, 0xD4, 0x03, 0xE9, 0x01, 0x0B, 0x00, 0x3A, 0xFE, 0xC1, 0xFC, 0x2E, 0xFB, 
-    0xF7, 0xF8, 0x0C, 0xF7, 0x5C, 0xF6, 0xA8, 0xF6, 0xC9, 0xF7, 0x79, 0xF8, 0xDE, 0xF8, 0x7E, 0xFA, 
-    0xE6, 0xFC, 0x10, 0xFF, 0x57, 0x00, 0x7C, 0x00, 0xF3, 0xFF, 0xCD, 0xFF, 0x75, 0xFF, 0x9B, 0xFF, 
-    0x0B, 0x00, 0x07, 0x01, 0x9E, 0x01, 0xD0, 0x01, 0x52, 0x01, 0x07, 0x01, 0x39, 0x01, 0x13, 0x01, 
-    0xAF, 0x00, 0xF7, 0xFE, 0xD6, 0xFD, 0x0C, 0xFD, 0xDA, 0xFC, 0x82, 0xFC, 0x2A, 0xFC, 0xEB, 0xFB, 
-    0x04, 0xFC, 0x10, 0xFC, 0x5C, 0xFC, 0x3F, 0xFD, 0xE2, 0xFD, 0x79, 0xFE, 0x86, 0xFE, 0x3A, 0xFE, 
-    0x9F, 0xFE, 0x5C, 0xFF, 0x24, 0x00, 0x70, 0x00, 0x70, 0x00, 0x63, 0x00, 0xE1, 0x00, 0x78, 0x01, 
-    0xD0, 0x01, 0xAB, 0x01, 0x2D, 0x01, 0x3D, 0x00, 0x9F, 0xFE, 0x71, 0xFD, 0x5C, 0xFC, 0xB8, 0xFB, 
-    0x97, 0xFA, 0xF7, 0xF8, 0x58, 0xF7, 0x75, 0xF6, 0x43, 0xF6, 0x69, 0xF6, 0x00, 0xF7, 0x00, 0xF7, 
-    0xC1, 0xF6, 0x5C, 0xF6, 0x69, 0xF6, 0x4B, 0xF7, 0xC5, 0xF8, 0xE2, 0xFA, 0x19, 0xFD, 0x15, 0xFE, 
-    0xB8, 0xFE, 0x04, 0xFF, 0x8E, 0xFF, 0xBB, 0x00, 0x39, 0x01, 0x78, 0x01, 0xE1, 0x00, 0x52, 0x01, 
-    0x9E, 0x01, 0xCC, 0x02, 0x81, 0x02, 0x91, 0x01, 0xDA, 0xFF, 0xA3, 0xFD, 0xB8, 0xFB, 0x0C, 0xFA, 
-    0x9B, 0xFC, 0xAA, 0x07, 0x45, 0x16, 0x02, 0x20, 0x30, 0x24, 0x39, 0x22, 0x9D, 0x22, 0x78, 0x22, 
-    0x6F, 0x21, 0x9D, 0x1C, 0xF6, 0x16, 0x8D, 0x0E, 0x35, 0x05, 0x25, 0xFD, 0xAC, 0xF8, 0x3F, 0xFA, 
-    0x86, 0xFB, 0x10, 0xFC, 0x7E, 0xFA, 0x86, 0xF8, 0x3A, 0xF8, 0x19, 0xFA, 0xB0, 0xFA, 0xDE, 0xF8, 
-    0xA3, 0xF4, 0x5C, 0xF0, 0xFC, 0xEE, 0x26, 0xF1, 0xEB, 0xF5, 0xDE, 0xFB, 0xAF, 0x00, 0x0F, 0x05, 
-    0x28, 0x08, 0xA6, 0x0B, 0x70, 0x0F, 0x67, 0x11, 0x0F, 0x11, 0xE9, 0x0D, 0x24, 0x09, 0x3D, 0x03, 
-    0x75, 0xFF, 0xF3, 0xFC, 0x3A, 0xFB, 0x4F, 0xF9, 0xA8, 0xF6, 0x1D, 0xF6, 0xB0, 0xF7, 0x32, 0xFA, 
-    0x0C, 0xFD, 0xC9, 0xFD, 0x64, 0xFD, 0xA7, 0xFC, 0x9F, 0xFB, 0xB0, 0xFA, 0x3F, 0xFA, 0xCD, 0xF9, 
-    0x25, 0xFA, 0x3A, 0xFB, 0x3F, 0xFD, 0xCD, 0xFF, 0x63, 0x03, 0x24, 0x06, 0x0F, 0x08, 0xE5, 0x08, 
-    0xAF, 0x09, 0x46, 0x0A, 0x0B, 0x09, 0xAF, 0x06, 0x0B, 0x03, 0x8E, 0xFF, 0xC1, 0xFC, 0xBC, 0xFA, 
-    0x69, 0xF9, 0x86, 0xF8, 0xBD, 0xF7, 0x58, 0xF7, 0x97, 0xF7, 0x93, 0xF8, 0x25, 0xFA, 0x79, 0xFB, 
-    0x2A, 0xFC, 0x4F, 0xFC, 0x97, 0xFD, 0x4F, 0xFF, 0x13, 0x01, 0x4E, 0x02, 0x67, 0x02, 0x81, 0x02, 
-    0xB3, 0x02, 0x0B, 0x03, 0x70, 0x03, 0x0B, 0x03, 0xDD, 0x01, 0x68, 0xFF, 0x7D, 0xFD, 0x1D, 0xFC, 
-    0x86, 0xFB, 0x54, 0xFB, 0x2E, 0xFB, 0x21, 0xFB, 0x79, 0xFB, 0xEB, 0xFB, 0x58, 0xFD, 0x79, 0xFE, 
-    0x43, 0xFF, 0x36, 0xFF, 0xD1, 0xFE, 0x47, 0xFE, 0x21, 0xFE, 0x60, 0xFE, 0xD1, 0xFE, 0x68, 0xFF, 
-    0xC1, 0xFF, 0x00, 0x00, 0x4A, 0x00, 0xE1, 0x00, 0x9E, 0x01, 0x42, 0x02, 0x5B, 0x02, 0xAB, 0x01, 
-    0x70, 0x00, 0x29, 0xFF, 0x6D, 0xFE, 0x8A, 0xFD, 0xC1, 0xFC, 0xD1, 0xFB, 0x6D, 0xFB, 0x2E, 0xFB, 
-    0xC9, 0xFA, 0x8A, 0xFA, 0x32, 0xFA, 0xF3, 0xF9, 0x4F, 0xF9, 0x6D, 0xF8, 0xD6, 0xF7, 0x7E, 0xF7, 
-    0xD6, 0xF7, 0x3A, 0xF8, 0xB8, 0xF8, 0xF7, 0xF8, 0x36, 0xF9, 0x4F, 0xF9, 0xA7, 0xF9, 0x32, 0xFA, 
-    0x86, 0xFB, 0x8E, 0xFC, 0x8A, 0xFD, 0xA3, 0xFD, 0x86, 0xFE, 0x68, 0xFF, 0x57, 0x00, 0x9E, 0x01, 
-    0x91, 0x01, 0xDD, 0x01, 0x78, 0x01, 0x13, 0x01, 0x20, 0x01, 0x07, 0x01, 0xBB, 0x00, 0x24, 0x00, 
-    0xAC, 0xFE, 0x0C, 0xFD, 0xAC, 0xFB, 0xE2, 0xFD, 0x24, 0x06, 0x7C, 0x12, 0x7C, 0x1B, 0x80, 0x20, 
-    0x8D, 0x20, 0x0F, 0x20, 0x1F, 0x1F, 0x84, 0x1C, 0x63, 0x18, 0xC8, 0x12, 0xDD, 0x0A, 0x0F, 0x02, 
-    0xF3, 0xF9, 0xD2, 0xF5, 0x9F, 0xF5, 0xDA, 0xF6, 0x54, 0xF8, 0x25, 0xFA, 0xA7, 0xFC, 0xC1, 0xFF, 
-    0xBF, 0x02, 0xAA, 0x04, 0x03, 0x05, 0x46, 0x04, 0x9A, 0x02, 0xAF, 0x00, 0xDA, 0xFF, 0xE1, 0x00, 
-    0x4A, 0x03, 0x95, 0x06, 0x63, 0x09, 0xCC, 0x0B, 0xE9, 0x0D, 0x17, 0x0F, 0x80, 0x0E, 0x3D, 0x0C, 
-    0xD9, 0x08, 0xFA, 0x03, 0xD6, 0xFD, 0x19, 0xF7, 0x8A, 0xF1, 0xF3, 0xED, 0x2E, 0xEC, 0x08, 0xEC, 
-    0x5C, 0xED, 0x43, 0xF0, 0x3F, 0xF4, 0x04, 0xF9, 0x4B, 0xFD, 0x4A, 0x00, 0xBF, 0x02, 0x89, 0x03, 
-    0x3D, 0x03, 0xF6, 0x01, 0x00, 0x00, 0xD1, 0xFE, 0xAC, 0xFE, 0xF7, 0xFE, 0xA7, 0xFF, 0x31, 0x00, 
-    0x52, 0x01, 0xD9, 0x02, 0x52, 0x04, 0xCC, 0x05, 0xA6, 0x05, 0x20, 0x04, 0x39, 0x01, 0xE2, 0xFD, 
-    0x21, 0xFB, 0xC5, 0xF8, 0x64, 0xF7, 0x43, 0xF6, 0xB8, 0xF5, 0x9B, 0xF6, 0x47, 0xF8, 0xDE, 0xFB, 
-    0xA7, 0xFF, 0x18, 0x03, 0xC4, 0x04, 0xFE, 0x05, 0x67, 0x05, 0x42, 0x05, 0x0F, 0x05, 0x13, 0x04, 
-    0x3D, 0x03, 0x5F, 0x01, 0x0B, 0x00, 0x10, 0xFF, 0x47, 0xFE, 0x53, 0xFE, 0x21, 0xFE, 0x97, 0xFD, 
-    0x36, 0xFC, 0xBC, 0xFA, 0x8E, 0xF9, 0x9F, 0xF8, 0x3A, 0xF8, 0x21, 0xF8, 0x6D, 0xF8, 0x5C, 0xF9, 
-    0xA3, 0xFA, 0x36, 0xFC, 0x2E, 0xFE, 0x31, 0x00, 0xAB, 0x01, 0xFE, 0x02, 0xAF, 0x03, 0x89, 0x03, 
-    0xE5, 0x02, 0xE9, 0x01, 0xEE, 0x00, 0x18, 0x00, 0x43, 0xFF, 0x2E, 0xFE, 0x64, 0xFD, 0xF3, 0xFC, 
-    0x9B, 0xFC, 0x0C, 0xFD, 0x25, 0xFD, 0xE6, 0xFC, 0x8E, 0xFC, 0xF7, 0xFB, 0x92, 0xFB, 0x47, 0xFB, 
-    0x08, 0xFB, 0xA3, 0xFA, 0x25, 0xFA, 0xB4, 0xF9, 0x8E, 0xF9, 0xE6, 0xF9, 0xA3, 0xFA, 0x54, 0xFB, 
-    0xEB, 0xFB, 0xB4, 0xFC, 0x58, 0xFD, 0xC9, 0xFD, 0x15, 0xFE, 0xEF, 0xFD, 0x8A, 0xFD, 0xA7, 0xFC, 
-    0x3A, 0xFB, 0xA3, 0xFA, 0xDA, 0xF9, 0x4B, 0xFA, 0x15, 0xFB, 0xEB, 0xFB, 0x68, 0xFC, 0x82, 0xFC, 
-    0x68, 0xFC, 0xE6, 0xFC, 0x71, 0xFD, 0xEB, 0xFE, 0x75, 0xFF, 0x18, 0x00, 0x2D, 0x01, 0x31, 0x00, 
-    0x96, 0x00, 0x75, 0xFF, 0xEB, 0xFE, 0x21, 0xFE, 0x08, 0xFE, 0x0B, 0x03, 0x2C, 0x0D, 0xF6, 0x16, 
-    0xF1, 0x1D, 0x4E, 0x20, 0xD8, 0x20, 0x1F, 0x22, 0xC3, 0x1F, 0xA2, 0x1B, 0x06, 0x16, 0x4A, 0x0F, 
-    0x9E, 0x07, 0x6D, 0xFE, 0x00, 0xF7, 0xCD, 0xF3, 0x4F, 0xF3, 0x4B, 0xF4, 0xC5, 0xF5, 0xC5, 0xF8, 
-    0xDA, 0xFC, 0x13, 0x01, 0xE1, 0x03, 0xB3, 0x05, 0xAF, 0x06, 0xEE, 0x06, 0xFE, 0x05, 0x39, 0x04, 
-    0xFE, 0x02, 0x3D, 0x03, 0x0F, 0x05, 0x78, 0x07, 0xA2, 0x09, 0xA6, 0x0B, 0x6B, 0x0D, 0x9E, 0x0D, 
-    0xFA, 0x0C, 0xF6, 0x0A, 0x28, 0x08, 0x0B, 0x03, 0x75, 0xFC, 0x60, 0xF5, 0x9F, 0xEF, 0xE2, 0xEB, 
-    0xF8, 0xE9, 0xF8, 0xE9, 0xBD, 0xEB, 0x15, 0xEF, 0xA8, 0xF3, 0x10, 0xF9, 0x60, 0xFE, 0xF2, 0x02, 
-    0xA6, 0x05, 0x31, 0x06, 0x28, 0x05, 0x4A, 0x03, 0x6C, 0x01, 0x0B, 0x00, 0x60, 0xFE, 0xB0, 0xFD, 
-    0x7D, 0xFD, 0x3A, 0xFE, 0x5C, 0xFF, 0xBB, 0x00, 0x74, 0x02, 0xC8, 0x03, 0xD4, 0x03, 0x74, 0x02, 
-    0xE6, 0xFF, 0x00, 0xFD, 0x97, 0xFA, 0xE2, 0xF7, 0x43, 0xF6, 0x15, 0xF5, 0x3A, 0xF5, 0x19, 0xF7, 
-    0xF3, 0xF9, 0x7D, 0xFD, 0x9E, 0x01, 0x5B, 0x05, 0x28, 0x08, 0x20, 0x0A, 0xE9, 0x0A, 0xB7, 0x0A, 
-    0x4A, 0x09, 0x85, 0x07, 0x03, 0x05, 0x8D, 0x02, 0x70, 0x00, 0x86, 0xFE, 0x4B, 0xFD, 0x75, 0xFC, 
-    0xC5, 0xFB, 0x86, 0xFB, 0xD6, 0xFA, 0x8A, 0xFA, 0xB4, 0xF9, 0x2A, 0xF9, 0x6D, 0xF8, 0x9F, 0xF8, 
-    0xC5, 0xF8, 0xF7, 0xF8, 0xDA, 0xF9, 0x21, 0xFB, 0xB4, 0xFC, 0xF7, 0xFE, 0xAF, 0x00, 0xDD, 0x01, 
-    0xA6, 0x02, 0xD9, 0x02, 0xD9, 0x02, 0x4E, 0x02, 0xAB, 0x01, 0x63, 0x00, 0x04, 0xFF, 0x71, 0xFD, 
-    0x1D, 0xFC, 0x6D, 0xFB, 0x3A, 0xFB, 0x15, 0xFB, 0x08, 0xFB, 0xD6, 0xFA, 0xB0, 0xFA, 0x2E, 0xFB, 
-    0xAC, 0xFB, 0x75, 0xFC, 0xC1, 0xFC, 0x9B, 0xFC, 0xDE, 0xFB, 0x3A, 0xFB, 0x7E, 0xFA, 0xBC, 0xFA, 
-    0xE2, 0xFA, 0xAC, 0xFB, 0xEB, 0xFB, 0x5C, 0xFC, 0x58, 0xFD, 0xB0, 0xFD, 0xC5, 0xFE, 0x10, 0xFF, 
-    0xD1, 0xFE, 0x9F, 0xFE, 0x19, 0xFD, 0xA7, 0xFC, 0x04, 0xFC, 0xB8, 0xFB, 0xB8, 0xFB, 0xA3, 0xFA, 
-    0xA3, 0xFA, 0x64, 0xFA, 0xC9, 0xFA, 0xB8, 0xFB, 0x75, 0xFC, 0x71, 0xFD, 0xDE, 0xFE, 0xC5, 0xFE, 
-    0x92, 0xFE, 0x58, 0xFD, 0x10, 0xFC, 0x10, 0xFC, 0x5C, 0xFF, 0xC4, 0x07, 0x45, 0x13, 0x0B, 0x1B, 
-    0x67, 0x20, 0x56, 0x21, 0x28, 0x23, 0x99, 0x23, 0x24, 0x21, 0xF6, 0x1C, 0x39, 0x16, 0x4E, 0x0E, 
-    0x03, 0x05, 0xF7, 0xFB, 0x2A, 0xF6, 0xDA, 0xF3, 0x5C, 0xF3, 0x58, 0xF4, 0x19, 0xF7, 0xFB, 0xFA, 
-    0x9B, 0xFF, 0x31, 0x03, 0x8D, 0x05, 0xFA, 0x06, 0xDD, 0x07, 0x78, 0x07, 0x8D, 0x05, 0x31, 0x03, 
-    0x5B, 0x02, 0x3D, 0x03, 0x9A, 0x05, 0x1C, 0x08, 0x46, 0x0A, 0xF2, 0x0B, 0xC8, 0x0C, 0xBB, 0x0C, 
-    0x31, 0x0C, 0x52, 0x0A, 0xE1, 0x06, 0x96, 0x00, 0x69, 0xF9, 0x9F, 0xF2, 0x82, 0xED, 0x04, 0xEA, 
-    0x7E, 0xE8, 0xA4, 0xE8, 0xC1, 0xEA, 0xBD, 0xEE, 0xC1, 0xF3, 0x9B, 0xF9, 0xC5, 0xFE, 0x70, 0x03, 
-    0xF2, 0x05, 0x95, 0x06, 0xA6, 0x05, 0xA2, 0x03, 0xAB, 0x01, 0xB4, 0xFF, 0x08, 0xFE, 0x00, 0xFD, 
-    0x9B, 0xFC, 0x19, 0xFD, 0x9F, 0xFE, 0xEE, 0x00, 0xC8, 0x03, 0x80, 0x05, 0x35, 0x05, 0xD4, 0x03, 
-    0x07, 0x01, 0xEF, 0xFD, 0xB0, 0xFA, 0x32, 0xF7, 0x64, 0xF4, 0x54, 0xF2, 0x47, 0xF2, 0x4B, 0xF4, 
-    0xA3, 0xF7, 0x36, 0xFC, 0xF6, 0x01, 0xD4, 0x06, 0xE9, 0x0A, 0x20, 0x0D, 0x9E, 0x0D, 0xC8, 0x0C, 
-    0x91, 0x0A, 0x52, 0x07, 0xFA, 0x03, 0xAF, 0x00, 0xA3, 0xFD, 0x54, 0xFB, 0xCD, 0xF9, 0xDA, 0xF9, 
-    0x64, 0xFA, 0x54, 0xFB, 0x4F, 0xFC, 0x0C, 0xFD, 0xD6, 0xFD, 0x58, 0xFD, 0x9B, 0xFC, 0x79, 0xFB, 
-    0x0C, 0xFA, 0x1D, 0xF9, 0x3A, 0xF8, 0x60, 0xF8, 0x4F, 0xF9, 0x21, 0xFB, 0x64, 0xFD, 0x75, 0xFF, 
-    0x6C, 0x01, 0xF2, 0x02, 0xE1, 0x03, 0xD4, 0x03, 0x57, 0x03, 0xDD, 0x01, 0x31, 0x00, 0xE2, 0xFD, 
-    0xEB, 0xFB, 0x58, 0xFA, 0x82, 0xF9, 0x36, 0xF9, 0x69, 0xF9, 0xF3, 0xF9, 0xD6, 0xFA, 0x10, 0xFC, 
-    0x32, 0xFD, 0x6D, 0xFE, 0x29, 0xFF, 0x10, 0xFF, 0xD6, 0xFD, 0x75, 0xFC, 0x2E, 0xFB, 0x64, 0xFA, 
-    0x00, 0xFA, 0xA7, 0xF9, 0xF3, 0xF9, 0x15, 0xFB, 0x43, 0xFC, 0xEF, 0xFD, 0x53, 0xFE, 0x10, 0xFF, 
-    0x29, 0xFF, 0xB8, 0xFE, 0xDE, 0xFE, 0xE2, 0xFD, 0xA3, 0xFD, 0xF3, 0xFC, 0xDE, 0xFB, 0xD1, 0xFB, 
-    0xE2, 0xFA, 0x86, 0xFB, 0xDE, 0xFB, 0xF7, 0xFB, 0xB4, 0xFC, 0x58, 0xFD, 0xEF, 0xFD, 0x9F, 0xFE, 
-    0xD6, 0xFD, 0xC9, 0xFD, 0x75, 0xFC, 0xA7, 0xFC, 0xE1, 0x00, 0x7C, 0x09, 0xC3, 0x13, 0x17, 0x1B, 
-    0x5E, 0x1F, 0x0A, 0x21, 0xE9, 0x22, 0x39, 0x22, 0x5E, 0x1F, 0x67, 0x1A, 0x35, 0x14, 0x7C, 0x0C, 
-    0x89, 0x03, 0x21, 0xFB, 0x6D, 0xF5, 0xEB, 0xF2, 0x86, 0xF2, 0x58, 0xF4, 0x7E, 0xF7, 0xF7, 0xFB, 
-    0x70, 0x00, 0x46, 0x04, 0x39, 0x07, 0x89, 0x09, 0xD0, 0x0A, 0x20, 0x0A, 0x91, 0x07, 0xD0, 0x04, 
-    0x63, 0x03, 0x7C, 0x03, 0x0F, 0x05, 0x07, 0x07, 0x0B, 0x09, 0xB7, 0x0A, 0x17, 0x0C, 0xD4, 0x0C, 
-    0x20, 0x0D, 0xBF, 0x0B, 0xE9, 0x07, 0x9E, 0x01, 0x8A, 0xFA, 0x75, 0xF3, 0xDA, 0xED, 0x54, 0xE9, 
-    0x2A, 0xE7, 0xC5, 0xE6, 0xBD, 0xE8, 0xB9, 0xEC, 0x54, 0xF2, 0x93, 0xF8, 0xEB, 0xFE, 0xEE, 0x03, 
-    0x5F, 0x07, 0x74, 0x08, 0xDD, 0x07, 0xF2, 0x05, 0xFE, 0x02, 0x31, 0x00, 0x7D, 0xFD, 0x92, 0xFB, 
-    0x71, 0xFA, 0x4B, 0xFA, 0x54, 0xFB, 0xC9, 0xFD, 0x20, 0x01, 0xD4, 0x03, 0xF6, 0x04, 0x07, 0x04, 
-    0x0F, 0x02, 0x43, 0xFF, 0x2A, 0xFC, 0xD1, 0xF8, 0x60, 0xF5, 0xDE, 0xF2, 0xFC, 0xF1, 0x11, 0xF3, 
-    0xB8, 0xF5, 0x32, 0xFA, 0x68, 0xFF, 0xD0, 0x04, 0xBB, 0x09, 0xFA, 0x0C, 0x0B, 0x0F, 0x56, 0x0F, 
-    0xD0, 0x0D, 0x1C, 0x0B, 0xEE, 0x06, 0xB3, 0x02, 0x9F, 0xFE, 0x2E, 0xFB, 0xEB, 0xF8, 0xA3, 0xF7, 
-    0x71, 0xF7, 0xFB, 0xF7, 0x1D, 0xF9, 0xBC, 0xFA, 0xD1, 0xFB, 0xE6, 0xFC, 0x25, 0xFD, 0xA7, 0xFC, 
-    0xDE, 0xFB, 0xBC, 0xFA, 0xCD, 0xF9, 0x9B, 0xF9, 0x19, 0xFA, 0x2E, 0xFB, 0xCD, 0xFC, 0x79, 0xFE, 
-    0x31, 0x00, 0xDD, 0x01, 0xF2, 0x02, 0xA2, 0x03, 0x24, 0x03, 0xD0, 0x01, 0xE6, 0xFF, 0xFB, 0xFD, 
-    0x1D, 0xFC, 0x64, 0xFA, 0x4F, 0xF9, 0xB8, 0xF8, 0xEB, 0xF8, 0x9B, 0xF9, 0xB0, 0xFA, 0xD1, 0xFB, 
-    0x32, 0xFD, 0x60, 0xFE, 0x5C, 0xFF, 0x9B, 0xFF, 0x04, 0xFF, 0xD6, 0xFD, 0x82, 0xFC, 0x2E, 0xFB, 
-    0x19, 0xFA, 0x36, 0xF9, 0x43, 0xF9, 0x43, 0xF9, 0x25, 0xFA, 0x2E, 0xFB, 0x5C, 0xFC, 0xEF, 0xFD, 
-    0x6D, 0xFE, 0x29, 0xFF, 0x75, 0xFF, 0x29, 0xFF, 0x04, 0xFF, 0x08, 0xFE, 0x0C, 0xFD, 0x68, 0xFC, 
-    0x15, 0xFB, 0x58, 0xFA, 0x3F, 0xFA, 0xBC, 0xFA, 0xEB, 0xFB, 0xEF, 0xFD, 0x18, 0x00, 0x5F, 0x01, 
-    0x4E, 0x02, 0x85, 0x01, 0xEE, 0x00, 0x75, 0xFF, 0xA7, 0xFF, 0x13, 0x04, 0xF2, 0x0B, 0x5F, 0x13, 
-    0x56, 0x18, 0x8D, 0x1A, 0x78, 0x1C, 0x13, 0x1F, 0xED, 0x1E, 0xAA, 0x1C, 0xA2, 0x18, 0x20, 0x13, 
-    0x4A, 0x0C, 0xD4, 0x03, 0x04, 0xFC, 0xDA, 0xF6, 0x3F, 0xF4, 0xF3, 0xF3, 0x6D, 0xF5, 0x79, 0xF8, 
-    0xE6, 0xFC, 0x39, 0x01, 0x9A, 0x05, 0x3D, 0x09, 0x31, 0x0C, 0x9E, 0x0D, 0xBB, 0x0C, 0xFA, 0x09, 
-    0x5F, 0x07, 0x74, 0x05, 0xC4, 0x04, 0xE9, 0x04, 0x28, 0x05, 0xFE, 0x05, 0x39, 0x07, 0x74, 0x08, 
-    0xAF, 0x09, 0x6B, 0x0A, 0x3D, 0x09, 0xFE, 0x05, 0xEE, 0x00, 0xEF, 0xFA, 0x54, 0xF5, 0x1D, 0xF0, 
-    0xB0, 0xEB, 0xE3, 0xE8, 0xE7, 0xE7, 0xB9, 0xE9, 0x8F, 0xED, 0xC5, 0xF2, 0xAC, 0xF8, 0x6D, 0xFE, 
-    0x96, 0x03, 0x46, 0x07, 0x70, 0x09, 0x31, 0x09, 0x85, 0x07, 0x9E, 0x04, 0x52, 0x01, 0x60, 0xFE, 
-    0xC5, 0xFB, 0xCD, 0xF9, 0xAC, 0xF8, 0x36, 0xF9, 0xAC, 0xFB, 0xD1, 0xFE, 0x2D, 0x01, 0x9A, 0x02, 
-    0xCC, 0x02, 0x0F, 0x02, 0xC8, 0x00, 0x60, 0xFE, 0xAC, 0xFB, 0xC5, 0xF8, 0xB4, 0xF6, 0x2E, 0xF5, 
-    0x47, 0xF5, 0xCD, 0xF6, 0x58, 0xFA, 0x9B, 0xFF, 0x13, 0x04, 0x74, 0x08, 0x67, 0x0B, 0x07, 0x0D, 
-    0xF6, 0x0D, 0xC8, 0x0C, 0x13, 0x0A, 0xBB, 0x06, 0x5B, 0x02, 0x47, 0xFE, 0x19, 0xFA, 0xDA, 0xF6, 
-    0x21, 0xF5, 0xC9, 0xF4, 0xDE, 0xF5, 0x15, 0xF8, 0x25, 0xFA, 0xEB, 0xFB, 0x3F, 0xFD, 0x21, 0xFE, 
-    0xC5, 0xFE, 0x53, 0xFE, 0xB0, 0xFD, 0x43, 0xFC, 0xE2, 0xFA, 0x58, 0xFA, 0x97, 0xFA, 0x2E, 0xFB, 
-    0xDA, 0xFC, 0x47, 0xFE, 0xC1, 0xFF, 0x2D, 0x01, 0xE9, 0x01, 0x9A, 0x02, 0x5B, 0x02, 0x52, 0x01, 
-    0x82, 0xFF, 0x25, 0xFD, 0x2E, 0xFB, 0x5C, 0xF9, 0x54, 0xF8, 0xE2, 0xF7, 0x15, 0xF8, 0xC5, 0xF8, 
-    0x00, 0xFA, 0xD1, 0xFB, 0xEF, 0xFD, 0x36, 0xFF, 0xB4, 0xFF, 0x82, 0xFF, 0xC5, 0xFE, 0xD6, 0xFD, 
-    0xA7, 0xFC, 0x2E, 0xFB, 0x3F, 0xFA, 0xB4, 0xF9, 0xE6, 0xF9, 0x64, 0xFA, 0x86, 0xFB, 0xE6, 0xFC, 
-    0x53, 0xFE, 0x8E, 0xFF, 0xD5, 0x00, 0x2D, 0x01, 0xBB, 0x00, 0xB4, 0xFF, 0x08, 0xFE, 0xB4, 0xFC, 
-    0xC5, 0xFB, 0x58, 0xFA, 0x58, 0xFA, 0x25, 0xFA, 0x15, 0xFB, 0xF3, 0xFC, 0x60, 0xFE, 0xA7, 0xFF, 
-    0xA2, 0x00, 0x7C, 0x00, 0x70, 0x00, 0xDA, 0xFF, 0x96, 0x00, 0xA6, 0x05, 0x85, 0x0D, 0x9E, 0x13, 
-    0x63, 0x18, 0x9D, 0x19, 0x95, 0x1B, 0x28, 0x1D, 0x52, 0x1C, 0x41, 0x1A, 0x5F, 0x16, 0x0B, 0x12, 
-    0x4A, 0x0C, 0x85, 0x04, 0x58, 0xFD, 0x54, 0xF8, 0x93, 0xF5, 0x79, 0xF5, 0x0C, 0xF7, 0x9B, 0xF9, 
-    0xE6, 0xFC, 0x4A, 0x00, 0x2D, 0x04, 0x35, 0x08, 0xA6, 0x0B, 0x46, 0x0D, 0xE1, 0x0C, 0xB7, 0x0A, 
-    0xBF, 0x08, 0x39, 0x07, 0x57, 0x06, 0x63, 0x06, 0x24, 0x06, 0x31, 0x06, 0xBB, 0x06, 0xFA, 0x06, 
-    0x41, 0x08, 0xB3, 0x08, 0x35, 0x08, 0x0F, 0x05, 0x96, 0x00, 0x2E, 0xFB, 0xD2, 0xF5, 0xDA, 0xF0, 
-    0x21, 0xEC, 0x3B, 0xE9, 0x4B, 0xE8, 0x86, 0xE9, 0xDE, 0xEC, 0xDA, 0xF0, 0xEB, 0xF5, 0xF7, 0xFB, 
-    0x52, 0x01, 0xBF, 0x05, 0x1C, 0x08, 0x4E, 0x08, 0x2D, 0x07, 0xE9, 0x04, 0x28, 0x02, 0x75, 0xFF, 
-    0x36, 0xFC, 0xC1, 0xF9, 0x47, 0xF8, 0x86, 0xF8, 0xEF, 0xFA, 0xC9, 0xFD, 0x4A, 0x00, 0xF6, 0x01, 
-    0x9A, 0x02, 0xD9, 0x02, 0x35, 0x02, 0x89, 0x00, 0xFB, 0xFD, 0x15, 0xFB, 0x6D, 0xF8, 0xA8, 0xF6, 
-    0xDE, 0xF5, 0x5C, 0xF6, 0x1D, 0xF9, 0x8E, 0xFC, 0x46, 0x01, 0xA6, 0x05, 0xAF, 0x09, 0x13, 0x0D, 
-    0xB3, 0x0E, 0x24, 0x0F, 0xDD, 0x0D, 0x02, 0x0B, 0x78, 0x07, 0x4E, 0x02, 0x71, 0xFD, 0xEB, 0xF8, 
-    0x79, 0xF5, 0xB4, 0xF3, 0x5C, 0xF3, 0x25, 0xF4, 0xB8, 0xF5, 0x58, 0xF7, 0xB4, 0xF9, 0xF7, 0xFB, 
-    0xEF, 0xFD, 0x04, 0xFF, 0x04, 0xFF, 0x92, 0xFE, 0xE2, 0xFD, 0x3F, 0xFD, 0x0C, 0xFD, 0xDA, 0xFC, 
-    0xF3, 0xFC, 0x7D, 0xFD, 0x47, 0xFE, 0x68, 0xFF, 0x7C, 0x00, 0x2D, 0x01, 0x9E, 0x01, 0x39, 0x01, 
-    0x70, 0x00, 0xB8, 0xFE, 0xB4, 0xFC, 0x7E, 0xFA, 0xEB, 0xF8, 0xC9, 0xF7, 0x32, 0xF7, 0x00, 0xF7, 
-    0xBD, 0xF7, 0xDE, 0xF8, 0x08, 0xFB, 0xDA, 0xFC, 0x2E, 0xFE, 0x36, 0xFF, 0x8E, 0xFF, 0xA7, 0xFF, 
-    0x04, 0xFF, 0xFB, 0xFD, 0x25, 0xFD, 0x43, 0xFC, 0x54, 0xFB, 0xE2, 0xFA, 0x0C, 0xFA, 0x7E, 0xFA, 
-    0x60, 0xFB, 0xA7, 0xFC, 0x9F, 0xFE, 0xDA, 0xFF, 0xA2, 0x00, 0x20, 0x01, 0xA2, 0x00, 0xCD, 0xFF, 
-    0xDE, 0xFE, 0x0C, 0xFD, 0xF7, 0xFB, 0x54, 0xFB, 0xD6, 0xFA, 0x86, 0xFB, 0x36, 0xFC, 0x00, 0xFD, 
-    0x79, 0xFE, 0x29, 0xFF, 0xCD, 0xFF, 0xF3, 0xFF, 0xC8, 0x00, 0x5B, 0x05, 0xED, 0x0C, 0x9E, 0x13, 
-    0x6F, 0x18, 0x02, 0x1A, 0x17, 0x1B, 0x06, 0x1C, 0xCC, 0x1A, 0x63, 0x18, 0xCC, 0x14, 0x28, 0x11, 
-    0xE1, 0x0C, 0x70, 0x06, 0x5C, 0xFF, 0x3F, 0xFA, 0x7E, 0xF7, 0x8A, 0xF7, 0x2A, 0xF9, 0xE2, 0xFA, 
-    0x4B, 0xFD, 0xF3, 0xFF, 0x31, 0x03, 0x95, 0x06, 0x95, 0x09, 0x35, 0x0B, 0xA6, 0x0B, 0x91, 0x0A, 
-    0xE5, 0x08, 0x52, 0x07, 0x95, 0x06, 0xAF, 0x06, 0x20, 0x07, 0x20, 0x07, 0xEE, 0x06, 0xFA, 0x06, 
-    0x5F, 0x07, 0xF6, 0x07, 0x46, 0x07, 0xD0, 0x04, 0x07, 0x01, 0x5C, 0xFC, 0x8A, 0xF7, 0xC5, 0xF2, 
-    0xDA, 0xED, 0x00, 0xEB, 0x93, 0xE9, 0x50, 0xEA, 0xDE, 0xEC, 0x11, 0xF0, 0x8A, 0xF4, 0xE6, 0xF9, 
-    0x10, 0xFF, 0xA2, 0x03, 0x63, 0x06, 0x52, 0x07, 0x70, 0x06, 0x9E, 0x04, 0x35, 0x02, 0xCD, 0xFF, 
-    0x0C, 0xFD, 0x64, 0xFA, 0x93, 0xF8, 0x08, 0xF8, 0xB4, 0xF9, 0x75, 0xFC, 0xF7, 0xFE, 0x2D, 0x01, 
-    0x03, 0x02, 0x8D, 0x02, 0x42, 0x02, 0xEE, 0x00, 0x1D, 0xFF, 0x9B, 0xFC, 0x4B, 0xFA, 0x47, 0xF8, 
-    0xC1, 0xF6, 0x32, 0xF7, 0x32, 0xFA, 0x19, 0xFD, 0xC4, 0x01, 0x4E, 0x05, 0x67, 0x08, 0x74, 0x0B, 
-    0xA2, 0x0C, 0x52, 0x0D, 0x24, 0x0C, 0xEE, 0x09, 0xD4, 0x06, 0x42, 0x02, 0x64, 0xFD, 0x4F, 0xF9, 
-    0x4F, 0xF6, 0xFC, 0xF4, 0x47, 0xF5, 0x2A, 0xF6, 0x25, 0xF7, 0xDE, 0xF8, 0x2E, 0xFB, 0x8A, 0xFD, 
-    0x75, 0xFF, 0x4A, 0x00, 0x18, 0x00, 0xB8, 0xFE, 0xC9, 0xFD, 0xC1, 0xFC, 0x86, 0xFB, 0x15, 0xFB, 
-    0xE2, 0xFA, 0x15, 0xFB, 0x1D, 0xFC, 0x58, 0xFD, 0x1D, 0xFF, 0x89, 0x00, 0x9E, 0x01, 0x35, 0x02, 
-    0xD0, 0x01, 0x96, 0x00, 0x04, 0xFF, 0x00, 0xFD, 0xFB, 0xFA, 0x75, 0xF9, 0x79, 0xF8, 0xA3, 0xF7, 
-    0xD6, 0xF7, 0x93, 0xF8, 0x25, 0xFA, 0x36, 0xFC, 0xE2, 0xFD, 0xEB, 0xFE, 0x1D, 0xFF, 0xF7, 0xFE, 
-    0x92, 0xFE, 0x8A, 0xFD, 0xDA, 0xFC, 0xD1, 0xFB, 0x47, 0xFB, 0xD6, 0xFA, 0x7E, 0xFA, 0x15, 0xFB, 
-    0x04, 0xFC, 0x64, 0xFD, 0x29, 0xFF, 0x18, 0x00, 0x39, 0x01, 0xEE, 0x00, 0xE1, 0x00, 0x82, 0xFF, 
-    0xAC, 0xFE, 0x64, 0xFD, 0x10, 0xFC, 0x9F, 0xFB, 0xE2, 0xFA, 0x6D, 0xFB, 0x10, 0xFC, 0x58, 0xFD, 
-    0x60, 0xFE, 0xDA, 0xFF, 0x7C, 0x00, 0xEE, 0x00, 0xBB, 0x00, 0x9E, 0x01, 0x18, 0x06, 0x95, 0x0C, 
-    0xAE, 0x12, 0x1B, 0x17, 0xD4, 0x18, 0xA6, 0x1A, 0x56, 0x1B, 0x1B, 0x1A, 0xFE, 0x17, 0xA6, 0x14, 
-    0xD8, 0x11, 0x78, 0x0D, 0xC8, 0x06, 0x00, 0x00, 0xA3, 0xFA, 0x21, 0xF8, 0x54, 0xF8, 0x82, 0xF9, 
-    0x60, 0xFB, 0x97, 0xFD, 0x31, 0x00, 0xC8, 0x03, 0x20, 0x07, 0x6B, 0x0A, 0x56, 0x0C, 0xE1, 0x0C, 
-    0x80, 0x0B, 0xEE, 0x09, 0xF6, 0x07, 0xE1, 0x06, 0x7C, 0x06, 0xD9, 0x05, 0x8D, 0x05, 0x35, 0x05, 
-    0x0F, 0x05, 0xCC, 0x05, 0x31, 0x06, 0xE5, 0x05, 0x2D, 0x04, 0xEE, 0x00, 0x19, 0xFD, 0x93, 0xF8, 
-    0x9B, 0xF3, 0x15, 0xEF, 0xE2, 0xEB, 0xA8, 0xEA, 0x19, 0xEB, 0x04, 0xED, 0x9F, 0xEF, 0xDA, 0xF3, 
-    0x36, 0xF9, 0xB8, 0xFE, 0x70, 0x03, 0x3D, 0x06, 0x2D, 0x07, 0xD4, 0x06, 0x5B, 0x05, 0x70, 0x03, 
-    0xA2, 0x00, 0x7D, 0xFD, 0x8A, 0xFA, 0x3A, 0xF8, 0xA3, 0xF7, 0xB8, 0xF8, 0xB0, 0xFA, 0xDA, 0xFC, 
-    0xB8, 0xFE, 0x3D, 0x00, 0x52, 0x01, 0xAB, 0x01, 0x13, 0x01, 0xB4, 0xFF, 0x71, 0xFD, 0x60, 0xFB, 
-    0x2A, 0xF9, 0xBD, 0xF7, 0x8A, 0xF7, 0xD1, 0xF8, 0x86, 0xFB, 0xF7, 0xFE, 0x7C, 0x03, 0x20, 0x07, 
-    0x78, 0x0A, 0xAF, 0x0C, 0x52, 0x0D, 0x07, 0x0D, 0x02, 0x0B, 0xDD, 0x07, 0x3D, 0x03, 0x60, 0xFE, 
-    0xE6, 0xF9, 0x10, 0xF6, 0x00, 0xF4, 0x69, 0xF3, 0xE7, 0xF3, 0x47, 0xF5, 0x8A, 0xF7, 0x64, 0xFA, 
-    0x25, 0xFD, 0x68, 0xFF, 0x07, 0x01, 0x91, 0x01, 0x78, 0x01, 0xAF, 0x00, 0x43, 0xFF, 0x32, 0xFD, 
-    0x9F, 0xFB, 0x8A, 0xFA, 0xDA, 0xF9, 0x58, 0xFA, 0x2E, 0xFB, 0x4F, 0xFC, 0xEF, 0xFD, 0x75, 0xFF, 
-    0x96, 0x00, 0xC8, 0x00, 0x57, 0x00, 0x10, 0xFF, 0x64, 0xFD, 0xC5, 0xFB, 0xF3, 0xF9, 0x60, 0xF8, 
-    0x3F, 0xF7, 0x00, 0xF7, 0xD6, 0xF7, 0x1D, 0xF9, 0xC9, 0xFA, 0x4F, 0xFC, 0x8A, 0xFD, 0x9F, 0xFE, 
-    0x68, 0xFF, 0x75, 0xFF, 0x5C, 0xFF, 0x79, 0xFE, 0x8A, 0xFD, 0x68, 0xFC, 0x2E, 0xFB, 0xA3, 0xFA, 
-    0x25, 0xFA, 0x8A, 0xFA, 0x92, 0xFB, 0x19, 0xFD, 0xF7, 0xFE, 0xA2, 0x00, 0x9E, 0x01, 0x42, 0x02, 
-    0x28, 0x02, 0x52, 0x01, 0x18, 0x00, 0x2E, 0xFE, 0xA7, 0xFC, 0x6D, 0xFB, 0x60, 0xFB, 0x3A, 0xFB, 
-    0xC5, 0xFB, 0xD1, 0xFB, 0xC1, 0xFC, 0x97, 0xFD, 0x60, 0xFE, 0x68, 0xFF, 0xF2, 0x02, 0xE1, 0x09, 
-    0x0F, 0x11, 0xF6, 0x16, 0xB7, 0x19, 0xF1, 0x1A, 0xA2, 0x1B, 0xA6, 0x1A, 0x30, 0x18, 0x0B, 0x15, 
-    0x17, 0x12, 0x80, 0x0E, 0x56, 0x09, 0x9A, 0x02, 0x58, 0xFD, 0x7E, 0xFA, 0xF3, 0xF9, 0x3A, 0xFB, 
-    0xA7, 0xFC, 0x2E, 0xFE, 0x31, 0x00, 0xA6, 0x02, 0x4E, 0x05, 0xAA, 0x07, 0xAF, 0x09, 0x78, 0x0A, 
-    0x5F, 0x0A, 0x70, 0x09, 0x4E, 0x08, 0x46, 0x07, 0x13, 0x07, 0x46, 0x07, 0x2D, 0x07, 0x13, 0x07, 
-    0xAF, 0x06, 0x89, 0x06, 0x70, 0x06, 0x24, 0x06, 0xB7, 0x04, 0x0F, 0x02, 0x9F, 0xFE, 0x71, 0xFA, 
-    0xD2, 0xF5, 0x32, 0xF1, 0x82, 0xED, 0xC9, 0xEB, 0xA4, 0xEB, 0x04, 0xED, 0x08, 0xEF, 0xFC, 0xF1, 
-    0x9B, 0xF6, 0xD1, 0xFB, 0x4A, 0x00, 0xD4, 0x03, 0x80, 0x05, 0xD9, 0x05, 0x28, 0x05, 0xA2, 0x03, 
-    0x91, 0x01, 0x04, 0xFF, 0x75, 0xFC, 0x71, 0xFA, 0x36, 0xF9, 0x8E, 0xF9, 0xFB, 0xFA, 0xC1, 0xFC, 
-    0x60, 0xFE, 0xDA, 0xFF, 0xC8, 0x00, 0x78, 0x01, 0xFA, 0x00, 0x18, 0x00, 0x53, 0xFE, 0xB4, 0xFC, 
-    0x21, 0xFB, 0x0C, 0xFA, 0x00, 0xFA, 0x97, 0xFA, 0xC1, 0xFC, 0x29, 0xFF, 0x03, 0x02, 0x35, 0x05, 
-    0x91, 0x07, 0xA2, 0x09, 0xE9, 0x0A, 0xF6, 0x0A, 0x52, 0x0A, 0xF6, 0x07, 0x85, 0x04, 0xBB, 0x00, 
-    0xF3, 0xFC, 0x4B, 0xFA, 0x3A, 0xF8, 0x0C, 0xF7, 0xB4, 0xF6, 0x19, 0xF7, 0x6D, 0xF8, 0xF3, 0xF9, 
-    0x1D, 0xFC, 0xFB, 0xFD, 0x43, 0xFF, 0xF3, 0xFF, 0xCD, 0xFF, 0x29, 0xFF, 0x2E, 0xFE, 0x0C, 0xFD, 
-    0x36, 0xFC, 0x54, 0xFB, 0xFB, 0xFA, 0xD6, 0xFA, 0x3A, 0xFB, 0x10, 0xFC, 0x19, 0xFD, 0x79, 0xFE, 
-    0x82, 0xFF, 0xE6, 0xFF, 0x0B, 0x00, 0x1D, 0xFF, 0x21, 0xFE, 0xE6, 0xFC, 0xF7, 0xFB, 0xEF, 0xFA, 
-    0xE6, 0xF9, 0x4F, 0xF9, 0x10, 0xF9, 0x0C, 0xFA, 0xFB, 0xFA, 0x36, 0xFC, 0xE6, 0xFC, 0x97, 0xFD, 
-    0x3A, 0xFE, 0x6D, 0xFE, 0x3A, 0xFE, 0xC9, 0xFD, 0x64, 0xFD, 0x00, 0xFD, 0xA7, 0xFC, 0x10, 0xFC, 
-    0xAC, 0xFB, 0xD1, 0xFB, 0x36, 0xFC, 0x19, 0xFD, 0xB0, 0xFD, 0xB8, 0xFE, 0x1D, 0xFF, 0xC1, 0xFF, 
-    0xCD, 0xFF, 0xDA, 0xFF, 0x43, 0xFF, 0xD1, 0xFE, 0x2E, 0xFE, 0x71, 0xFD, 0xB0, 0xFD, 0xA3, 0xFD, 
-    0xEF, 0xFD, 0x60, 0xFE, 0x60, 0xFE, 0x79, 0xFE, 0x3A, 0xFE, 0x08, 0xFE, 0x8E, 0xFF, 0x46, 0x04, 
-    0x46, 0x0A, 0x91, 0x10, 0xBF, 0x14, 0x67, 0x17, 0x39, 0x19, 0x84, 0x19, 0x56, 0x18, 0x6B, 0x16, 
-    0x28, 0x14, 0x80, 0x11, 0x6B, 0x0D, 0x39, 0x07, 0x2D, 0x01, 0xE6, 0xFC, 0x21, 0xFB, 0x3A, 0xFB, 
-    0x36, 0xFC, 0x8A, 0xFD, 0x75, 0xFF, 0x03, 0x02, 0xDD, 0x04, 0x46, 0x07, 0xAF, 0x09, 0x28, 0x0B, 
-    0x74, 0x0B, 0x91, 0x0A, 0xE5, 0x08, 0x46, 0x07, 0x24, 0x06, 0xBF, 0x05, 0x80, 0x05, 0x1C, 0x05, 
-    0x03, 0x05, 0xC4, 0x04, 0x42, 0x05, 0xA6, 0x05, 0x4E, 0x05, 0x13, 0x04, 0x85, 0x01, 0x47, 0xFE, 
-    0x25, 0xFA, 0x86, 0xF5, 0x7E, 0xF1, 0x7E, 0xEE, 0x36, 0xED, 0x1D, 0xED, 0x19, 0xEE, 0x04, 0xF0, 
-    0x4F, 0xF3, 0xFB, 0xF7, 0xC1, 0xFC, 0xC8, 0x00, 0xA2, 0x03, 0x0F, 0x05, 0x4E, 0x05, 0x85, 0x04, 
-    0xCC, 0x02, 0x96, 0x00, 0xC9, 0xFD, 0x47, 0xFB, 0x4F, 0xF9, 0x47, 0xF8, 0xDE, 0xF8, 0x32, 0xFA, 
-    0xF7, 0xFB, 0xC9, 0xFD, 0x75, 0xFF, 0xD5, 0x00, 0x91, 0x01, 0xAB, 0x01, 0xBB, 0x00, 0x43, 0xFF, 
-    0x7D, 0xFD, 0x92, 0xFB, 0x25, 0xFA, 0x43, 0xF9, 0x32, 0xFA, 0x04, 0xFC, 0x86, 0xFE, 0x03, 0x02, 
-    0x5F, 0x04, 0x2D, 0x07, 0x24, 0x09, 0x85, 0x0A, 0x02, 0x0B, 0x39, 0x0A, 0x28, 0x08, 0xC4, 0x04, 
-    0x96, 0x00, 0x75, 0xFC, 0x2A, 0xF9, 0xE6, 0xF6, 0xEB, 0xF5, 0xC5, 0xF5, 0x36, 0xF6, 0x58, 0xF7, 
-    0x82, 0xF9, 0xF7, 0xFB, 0x60, 0xFE, 0x7C, 0x00, 0x91, 0x01, 0xB7, 0x01, 0xEE, 0x00, 0xA7, 0xFF, 
-    0xEF, 0xFD, 0x4F, 0xFC, 0x15, 0xFB, 0x19, 0xFA, 0x9B, 0xF9, 0xA7, 0xF9, 0x25, 0xFA, 0x6D, 0xFB, 
-    0x0C, 0xFD, 0xB8, 0xFE, 0xB4, 0xFF, 0xE6, 0xFF, 0xCD, 0xFF, 0x29, 0xFF, 0x3A, 0xFE, 0x19, 0xFD, 
-    0xAC, 0xFB, 0x25, 0xFA, 0x1D, 0xF9, 0xC5, 0xF8, 0x1D, 0xF9, 0xB4, 0xF9, 0xEF, 0xFA, 0x10, 0xFC, 
-    0x71, 0xFD, 0x92, 0xFE, 0xF7, 0xFE, 0x43, 0xFF, 0x43, 0xFF, 0x10, 0xFF, 0xAC, 0xFE, 0x97, 0xFD, 
-    0x9B, 0xFC, 0x9F, 0xFB, 0x3A, 0xFB, 0x2E, 0xFB, 0xDE, 0xFB, 0x8E, 0xFC, 0x32, 0xFD, 0x47, 0xFE, 
-    0xC5, 0xFE, 0x9B, 0xFF, 0x70, 0x00, 0xD5, 0x00, 0x13, 0x01, 0x89, 0x00, 0x00, 0x00, 0xD1, 0xFE, 
-    0xFB, 0xFD, 0x64, 0xFD, 0xE6, 0xFC, 0xF3, 0xFC, 0x82, 0xFC, 0xC1, 0xFC, 0xC1, 0xFC, 0x3A, 0xFE, 
-    0x8D, 0x02, 0x74, 0x08, 0xF2, 0x0E, 0x80, 0x14, 0xD8, 0x17, 0xC3, 0x19, 0xC3, 0x19, 0x56, 0x18, 
-    0x6B, 0x16, 0xF6, 0x13, 0x41, 0x11, 0x2C, 0x0D, 0x46, 0x07, 0xE9, 0x01, 0xD6, 0xFD, 0x04, 0xFC, 
-    0x43, 0xFC, 0x8A, 0xFD, 0x4F, 0xFF, 0x5F, 0x01, 0x89, 0x03, 0xBF, 0x05, 0xF6, 0x07, 0xEE, 0x09, 
-    0x4E, 0x0B, 0x74, 0x0B, 0x20, 0x0A, 0x67, 0x08, 0x7C, 0x06, 0x35, 0x05, 0xF6, 0x04, 0xAA, 0x04, 
-    0xC4, 0x04, 0x03, 0x05, 0x03, 0x05, 0x80, 0x05, 0xE5, 0x05, 0xA6, 0x05, 0xC4, 0x04, 0x81, 0x02, 
-    0x1D, 0xFF, 0x21, 0xFB, 0x5C, 0xF6, 0x47, 0xF2, 0x86, 0xEF, 0xDA, 0xED, 0xCD, 0xED, 0x97, 0xEE, 
-    0x5C, 0xF0, 0xB4, 0xF3, 0xD6, 0xF7, 0x75, 0xFC, 0x89, 0x00, 0x57, 0x03, 0xE9, 0x04, 0x0F, 0x05, 
-    0x2D, 0x04, 0xB3, 0x02, 0x96, 0x00, 0x15, 0xFE, 0xB8, 0xFB, 0xB4, 0xF9, 0xAC, 0xF8, 0xDE, 0xF8, 
-    0x0C, 0xFA, 0xAC, 0xFB, 0xA3, 0xFD, 0x5C, 0xFF, 0xEE, 0x00, 0x28, 0x02, 0x5B, 0x02, 0x03, 0x02, 
-    0x89, 0x00, 0xC5, 0xFE, 0x32, 0xFD, 0x79, 0xFB, 0x97, 0xFA, 0x8A, 0xFA, 0x79, 0xFB, 0x64, 0xFD, 
-    0xA7, 0xFF, 0x28, 0x02, 0xC4, 0x04, 0xFA, 0x06, 0xFE, 0x08, 0xE1, 0x09, 0x95, 0x09, 0xF6, 0x07, 
-    0x42, 0x05, 0xF6, 0x01, 0x86, 0xFE, 0xAC, 0xFB, 0x36, 0xF9, 0x7E, 0xF7, 0x8E, 0xF6, 0x4F, 0xF6, 
-    0x19, 0xF7, 0xB8, 0xF8, 0x15, 0xFB, 0x71, 0xFD, 0x5C, 0xFF, 0xAF, 0x00, 0x13, 0x01, 0xE1, 0x00, 
-    0x24, 0x00, 0xEB, 0xFE, 0x58, 0xFD, 0xEB, 0xFB, 0xA3, 0xFA, 0xB4, 0xF9, 0x69, 0xF9, 0xB4, 0xF9, 
-    0xC9, 0xFA, 0x43, 0xFC, 0xBC, 0xFD, 0x10, 0xFF, 0xB4, 0xFF, 0x18, 0x00, 0x0B, 0x00, 0x9B, 0xFF, 
-    0xD1, 0xFE, 0x8A, 0xFD, 0x1D, 0xFC, 0xE2, 0xFA, 0xF3, 0xF9, 0x75, 0xF9, 0x69, 0xF9, 0x8E, 0xF9, 
-    0x4B, 0xFA, 0x47, 0xFB, 0x5C, 0xFC, 0x97, 0xFD, 0x60, 0xFE, 0x43, 0xFF, 0xA7, 0xFF, 0x8E, 0xFF, 
-    0x36, 0xFF, 0xAC, 0xFE, 0x2E, 0xFE, 0xA3, 0xFD, 0x32, 0xFD, 0xF3, 0xFC, 0x19, 0xFD, 0x25, 0xFD, 
-    0xEF, 0xFD, 0xD1, 0xFE, 0x9B, 0xFF, 0x89, 0x00, 0x96, 0x00, 0x96, 0x00, 0x89, 0x00, 0x57, 0x00, 
-    0x7C, 0x00, 0x24, 0x00, 0x75, 0xFF, 0x04, 0xFF, 0xC9, 0xFD, 0x0C, 0xFD, 0x43, 0xFC, 0xD1, 0xFB, 
-    0xDA, 0xFC, 0x63, 0x00, 0x9A, 0x05, 0x8D, 0x0B, 0x41, 0x11, 0x3D, 0x15, 0x4A, 0x18, 0x06, 0x19, 
-    0x4A, 0x18, 0xDD, 0x16, 0xF2, 0x14, 0xC8, 0x12, 0xFE, 0x0E, 0x7C, 0x09, 0xBB, 0x03, 0x68, 0xFF, 
-    0xC1, 0xFC, 0x36, 0xFC, 0xCD, 0xFC, 0x47, 0xFE, 0x57, 0x00, 0x9A, 0x02, 0xC4, 0x04, 0xFA, 0x06, 
-    0x18, 0x09, 0x0F, 0x0B, 0xD9, 0x0B, 0x5B, 0x0B, 0xAF, 0x09, 0x5F, 0x07, 0x8D, 0x05, 0x78, 0x04, 
-    0xD4, 0x03, 0x7C, 0x03, 0x3D, 0x03, 0xE5, 0x02, 0x3D, 0x03, 0xC8, 0x03, 0x07, 0x04, 0xD4, 0x03, 
-    0x5B, 0x02, 0xF3, 0xFF, 0xB4, 0xFC, 0x54, 0xF8, 0x71, 0xF4, 0x00, 0xF1, 0xFC, 0xEE, 0x4B, 0xEE, 
-    0x7E, 0xEE, 0xAC, 0xEF, 0xEF, 0xF1, 0x60, 0xF5, 0x36, 0xF9, 0x3F, 0xFD, 0x63, 0x00, 0xB3, 0x02, 
-    0xA2, 0x03, 0x89, 0x03, 0x81, 0x02, 0x2D, 0x01, 0x5C, 0xFF, 0x64, 0xFD, 0x47, 0xFB, 0x4F, 0xF9, 
-    0xDE, 0xF8, 0xAC, 0xF8, 0x00, 0xFA, 0xD1, 0xFB, 0xC9, 0xFD, 0xA2, 0x00, 0xAB, 0x01, 0x9A, 0x02, 
-    0x0F, 0x02, 0x20, 0x01, 0x7C, 0x00, 0x1D, 0xFF, 0xA3, 0xFD, 0x10, 0xFC, 0xA3, 0xFA, 0x64, 0xFA, 
-    0xE2, 0xFA, 0xA7, 0xFC, 0xDE, 0xFE, 0x78, 0x01, 0x13, 0x04, 0xFE, 0x05, 0x9E, 0x07, 0x4E, 0x08, 
-    0x5B, 0x08, 0x5F, 0x07, 0x28, 0x05, 0x5B, 0x02, 0xD1, 0xFE, 0x9F, 0xFB, 0xDE, 0xF8, 0xDA, 0xF6, 
-    0x10, 0xF6, 0xC5, 0xF5, 0x9B, 0xF6, 0x15, 0xF8, 0xDA, 0xF9, 0xF7, 0xFB, 0xBC, 0xFD, 0x5C, 0xFF, 
-    0x70, 0x00, 0xE1, 0x00, 0x3D, 0x00, 0xF7, 0xFE, 0x58, 0xFD, 0xD1, 0xFB, 0x8A, 0xFA, 0xCD, 0xF9, 
-    0x69, 0xF9, 0x9B, 0xF9, 0x3F, 0xFA, 0x2E, 0xFB, 0x75, 0xFC, 0xB0, 0xFD, 0xD1, 0xFE, 0x8E, 0xFF, 
-    0xDA, 0xFF, 0x9B, 0xFF, 0x43, 0xFF, 0x6D, 0xFE, 0x4B, 0xFD, 0x4F, 0xFC, 0x2E, 0xFB, 0x71, 0xFA, 
-    0x0C, 0xFA, 0x0C, 0xFA, 0x7E, 0xFA, 0x08, 0xFB, 0x10, 0xFC, 0xF3, 0xFC, 0x3A, 0xFE, 0x5C, 0xFF, 
-    0xF3, 0xFF, 0x63, 0x00, 0x31, 0x00, 0xCD, 0xFF, 0x5C, 0xFF, 0xB8, 0xFE, 0x79, 0xFE, 0x3A, 0xFE, 
-    0x3A, 0xFE, 0x9F, 0xFE, 0xB8, 0xFE, 0x4F, 0xFF, 0xB4, 0xFF, 0x00, 0x00, 0x89, 0x00, 0xA2, 0x00, 
-    0xFA, 0x00, 0xA2, 0x00, 0x7C, 0x00, 0xE6, 0xFF, 0x75, 0xFF, 0xB8, 0xFE, 0xBC, 0xFD, 0x00, 0xFD, 
-    0x75, 0xFC, 0x2E, 0xFE, 0xF6, 0x01, 0x20, 0x07, 0x39, 0x0D, 0x4A, 0x12, 0xAE, 0x15, 0xB3, 0x17, 
-    0x35, 0x17, 0x91, 0x16, 0x89, 0x15, 0x4E, 0x14, 0x4A, 0x12, 0xB7, 0x0D, 0x41, 0x08, 0xE5, 0x02, 
-    0x1D, 0xFF, 0x32, 0xFD, 0xDA, 0xFC, 0x71, 0xFD, 0x10, 0xFF, 0xFA, 0x00, 0x31, 0x03, 0x28, 0x05, 
-    0x5F, 0x07, 0xAF, 0x09, 0xB3, 0x0B, 0x56, 0x0C, 0x80, 0x0B, 0x95, 0x09, 0x52, 0x07, 0xB3, 0x05, 
-    0x78, 0x04, 0x96, 0x03, 0xA6, 0x02, 0x0F, 0x02, 0x85, 0x01, 0xE9, 0x01, 0x35, 0x02, 0x8D, 0x02, 
-    0x35, 0x02, 0xFA, 0x00, 0xF7, 0xFE, 0xEB, 0xFB, 0x54, 0xF8, 0x15, 0xF5, 0x54, 0xF2, 0xE7, 0xF0, 
-    0x50, 0xF0, 0x36, 0xF0, 0x3F, 0xF1, 0x1D, 0xF3, 0x10, 0xF6, 0x82, 0xF9, 0x00, 0xFD, 0xC1, 0xFF, 
-    0xB7, 0x01, 0x74, 0x02, 0xBF, 0x02, 0x4E, 0x02, 0x6C, 0x01, 0xB4, 0xFF, 0xA3, 0xFD, 0x60, 0xFB, 
-    0x00, 0xFA, 0xB4, 0xF9, 0xF3, 0xF9, 0x15, 0xFB, 0x43, 0xFC, 0xEF, 0xFD, 0x5C, 0xFF, 0x07, 0x01, 
-    0x03, 0x02, 0x9A, 0x02, 0xFE, 0x02, 0x28, 0x02, 0xFA, 0x00, 0x36, 0xFF, 0x71, 0xFD, 0x5C, 0xFC, 
-    0x43, 0xFC, 0xCD, 0xFC, 0x15, 0xFE, 0x75, 0xFF, 0x20, 0x01, 0x18, 0x03, 0xE9, 0x04, 0xAF, 0x06, 
-    0xC4, 0x07, 0xF6, 0x07, 0xC8, 0x06, 0xC4, 0x04, 0x0F, 0x02, 0x43, 0xFF, 0xCD, 0xFC, 0x8A, 0xFA, 
-    0xAC, 0xF8, 0x32, 0xF7, 0x82, 0xF6, 0xC1, 0xF6, 0xE2, 0xF7, 0xA7, 0xF9, 0xAC, 0xFB, 0x8A, 0xFD, 
-    0x43, 0xFF, 0x31, 0x00, 0x70, 0x00, 0x00, 0x00, 0xEB, 0xFE, 0xC9, 0xFD, 0x36, 0xFC, 0xD6, 0xFA, 
-    0x69, 0xF9, 0x86, 0xF8, 0x6D, 0xF8, 0xDE, 0xF8, 0x0C, 0xFA, 0x47, 0xFB, 0xA7, 0xFC, 0xC9, 0xFD, 
-    0xEB, 0xFE, 0xCD, 0xFF, 0x0B, 0x00, 0xE6, 0xFF, 0x10, 0xFF, 0xE2, 0xFD, 0xA7, 0xFC, 0x6D, 0xFB, 
-    0x4B, 0xFA, 0x8E, 0xF9, 0x2A, 0xF9, 0x36, 0xF9, 0xC1, 0xF9, 0x58, 0xFA, 0xB8, 0xFB, 0x0C, 0xFD, 
-    0x47, 0xFE, 0x8E, 0xFF, 0x4A, 0x00, 0x96, 0x00, 0xA2, 0x00, 0x7C, 0x00, 0xF3, 0xFF, 0xC1, 0xFF, 
-    0x1D, 0xFF, 0x6D, 0xFE, 0x21, 0xFE, 0x97, 0xFD, 0x15, 0xFE, 0x86, 0xFE, 0x8E, 0xFF, 0xAF, 0x00, 
-    0x91, 0x01, 0x1C, 0x02, 0x0F, 0x02, 0x9E, 0x01, 0xEE, 0x00, 0x18, 0x00, 0x10, 0xFF, 0x08, 0xFE, 
-    0x08, 0xFE, 0x75, 0xFF, 0xF2, 0x02, 0x91, 0x07, 0xD4, 0x0C, 0xDD, 0x10, 0x78, 0x13, 0xB3, 0x14, 
-    0xA6, 0x14, 0xF2, 0x14, 0xB3, 0x14, 0x0F, 0x14, 0xA6, 0x11, 0xAA, 0x0D, 0xA6, 0x08, 0xEE, 0x03, 
-    0xA2, 0x00, 0xB8, 0xFE, 0x53, 0xFE, 0xB8, 0xFE, 0x00, 0x00, 0x78, 0x01, 0x31, 0x03, 0xE9, 0x04, 
-    0x52, 0x07, 0xBB, 0x09, 0x9A, 0x0B, 0x17, 0x0C, 0xDD, 0x0A, 0xFE, 0x08, 0xFA, 0x06, 0x4E, 0x05, 
-    0x13, 0x04, 0xBF, 0x02, 0xD0, 0x01, 0xE1, 0x00, 0x96, 0x00, 0xC8, 0x00, 0x20, 0x01, 0x52, 0x01, 
-    0x20, 0x01, 0x57, 0x00, 0x79, 0xFE, 0x10, 0xFC, 0xD1, 0xF8, 0xEB, 0xF5, 0xB4, 0xF3, 0x60, 0xF2, 
-    0xB0, 0xF1, 0x8A, 0xF1, 0xE2, 0xF1, 0x82, 0xF3, 0xD2, 0xF5, 0xEB, 0xF8, 0xF7, 0xFB, 0x9F, 0xFE, 
-    0x96, 0x00, 0xF6, 0x01, 0x67, 0x02, 0x67, 0x02, 0x52, 0x01, 0xB4, 0xFF, 0xC9, 0xFD, 0xDE, 0xFB, 
-    0x54, 0xFB, 0xC9, 0xFA, 0x08, 0xFB, 0x3A, 0xFB, 0x92, 0xFB, 0xA7, 0xFC, 0xC9, 0xFD, 0x29, 0xFF, 
-    0x63, 0x00, 0x13, 0x01, 0x52, 0x01, 0xEE, 0x00, 0x00, 0x00, 0xEB, 0xFE, 0xEF, 0xFD, 0x3F, 0xFD, 
-    0x25, 0xFD, 0x7D, 0xFD, 0x2E, 0xFE, 0x68, 0xFF, 0xD5, 0x00, 0xB3, 0x02, 0x5F, 0x04, 0xD9, 0x05, 
-    0x7C, 0x06, 0x31, 0x06, 0x1C, 0x05, 0x70, 0x03, 0x39, 0x01, 0xF7, 0xFE, 0x8E, 0xFC, 0x3F, 0xFA, 
-    0x86, 0xF8, 0x4B, 0xF7, 0xCD, 0xF6, 0x0C, 0xF7, 0x15, 0xF8, 0xB4, 0xF9, 0x86, 0xFB, 0x3F, 0xFD, 
-    0xB8, 0xFE, 0xA7, 0xFF, 0x4A, 0x00, 0x3D, 0x00, 0xCD, 0xFF, 0xAC, 0xFE, 0x25, 0xFD, 0xB8, 0xFB, 
-    0x32, 0xFA, 0x69, 0xF9, 0x36, 0xF9, 0x82, 0xF9, 0x3F, 0xFA, 0x2E, 0xFB, 0x10, 0xFC, 0x58, 0xFD, 
-    0x86, 0xFE, 0xA7, 0xFF, 0x63, 0x00, 0x63, 0x00, 0xF3, 0xFF, 0xD1, 0xFE, 0x7D, 0xFD, 0x1D, 0xFC, 
-    0x15, 0xFB, 0xF3, 0xF9, 0x82, 0xF9, 0x4F, 0xF9, 0x82, 0xF9, 0x4B, 0xFA, 0x3A, 0xFB, 0xA7, 0xFC, 
-    0x08, 0xFE, 0x43, 0xFF, 0x63, 0x00, 0x39, 0x01, 0x91, 0x01, 0x03, 0x02, 0x03, 0x02, 0x91, 0x01, 
-    0x13, 0x01, 0xF3, 0xFF, 0x1D, 0xFF, 0xAC, 0xFE, 0x9F, 0xFE, 0xEB, 0xFE, 0x75, 0xFF, 0xCD, 0xFF, 
-    0x00, 0x00, 0x89, 0x00, 0x89, 0x00, 0xE1, 0x00, 0xA2, 0x00, 0x57, 0x00, 0xC1, 0xFF, 0x82, 0xFF, 
-    0x7C, 0x00, 0x24, 0x03, 0x5F, 0x07, 0xFE, 0x0B, 0x13, 0x10, 0x24, 0x12, 0x13, 0x13, 0xD4, 0x12, 
-    0x2C, 0x13, 0x6B, 0x13, 0x39, 0x13, 0x0B, 0x12, 0xE5, 0x0E, 0x0F, 0x0B, 0x07, 0x07, 0xC8, 0x03, 
-    0x91, 0x01, 0xA2, 0x00, 0x70, 0x00, 0x13, 0x01, 0xDD, 0x01, 0xE5, 0x02, 0x07, 0x04, 0xCC, 0x05, 
-    0xDD, 0x07, 0xD4, 0x09, 0xDD, 0x0A, 0x5F, 0x0A, 0xE5, 0x08, 0x52, 0x07, 0xFE, 0x05, 0xE9, 0x04, 
-    0xA2, 0x03, 0x8D, 0x02, 0x6C, 0x01, 0xC8, 0x00, 0xC8, 0x00, 0xC8, 0x00, 0xD5, 0x00, 0x70, 0x00, 
-    0xB4, 0xFF, 0x92, 0xFE, 0xA7, 0xFC, 0x25, 0xFA, 0x8A, 0xF7, 0x6D, 0xF5, 0x00, 0xF4, 0x1D, 0xF3, 
-    0x60, 0xF2, 0x47, 0xF2, 0xF7, 0xF2, 0xBD, 0xF4, 0x25, 0xF7, 0xDA, 0xF9, 0x75, 0xFC, 0xD1, 0xFE, 
-    0x7C, 0x00, 0xB7, 0x01, 0x1C, 0x02, 0x91, 0x01, 0x63, 0x00, 0x9F, 0xFE, 0x32, 0xFD, 0x04, 0xFC, 
-    0x15, 0xFB, 0x71, 0xFA, 0xC1, 0xF9, 0xDA, 0xF9, 0xD6, 0xFA, 0x43, 0xFC, 0x08, 0xFE, 0x5C, 0xFF, 
-    0x63, 0x00, 0xFA, 0x00, 0x2D, 0x01, 0xBB, 0x00, 0x00, 0x00, 0x29, 0xFF, 0x86, 0xFE, 0x21, 0xFE, 
-    0xEF, 0xFD, 0xD6, 0xFD, 0x47, 0xFE, 0x10, 0xFF, 0x63, 0x00, 0x1C, 0x02, 0x7C, 0x03, 0x85, 0x04, 
-    0xF6, 0x04, 0xC4, 0x04, 0x39, 0x04, 0xE5, 0x02, 0x07, 0x01, 0xC5, 0xFE, 0x4F, 0xFC, 0x4B, 0xFA, 
-    0x86, 0xF8, 0x7E, 0xF7, 0x19, 0xF7, 0x64, 0xF7, 0x6D, 0xF8, 0xDA, 0xF9, 0x86, 0xFB, 0x3F, 0xFD, 
-    0x79, 0xFE, 0x68, 0xFF, 0x00, 0x00, 0xF3, 0xFF, 0x8E, 0xFF, 0x53, 0xFE, 0xF3, 0xFC, 0x6D, 0xFB, 
-    0x4B, 0xFA, 0x8E, 0xF9, 0x2A, 0xF9, 0x82, 0xF9, 0x3F, 0xFA, 0x47, 0xFB, 0xA7, 0xFC, 0xD6, 0xFD, 
-    0x10, 0xFF, 0xE6, 0xFF, 0x57, 0x00, 0x57, 0x00, 0xDA, 0xFF, 0x04, 0xFF, 0xC9, 0xFD, 0x82, 0xFC, 
-    0x21, 0xFB, 0x25, 0xFA, 0x43, 0xF9, 0x1D, 0xF9, 0x69, 0xF9, 0x64, 0xFA, 0xC5, 0xFB, 0x3F, 0xFD, 
-    0xB8, 0xFE, 0xDA, 0xFF, 0xFA, 0x00, 0xB7, 0x01, 0x4E, 0x02, 0xF2, 0x02, 0xBF, 0x02, 0xA6, 0x02, 
-    0x0F, 0x02, 0x07, 0x01, 0x89, 0x00, 0xE6, 0xFF, 0xA7, 0xFF, 0xF3, 0xFF, 0xCD, 0xFF, 0x0B, 0x00, 
-    0x31, 0x00, 0x4A, 0x00, 0xD5, 0x00, 0x39, 0x01, 0x78, 0x01, 0x20, 0x01, 0xBB, 0x00, 0xEE, 0x00, 
-    0x81, 0x02, 0xF2, 0x05, 0xAA, 0x0A, 0x8D, 0x0E, 0x35, 0x11, 0x80, 0x11, 0xF6, 0x10, 0xD0, 0x10, 
-    0x1C, 0x11, 0xBF, 0x11, 0x4E, 0x11, 0x7C, 0x0F, 0x63, 0x0C, 0xFE, 0x08, 0xCC, 0x05, 0x96, 0x03, 
-    0x35, 0x02, 0xF6, 0x01, 0xF6, 0x01, 0x8D, 0x02, 0x9A, 0x02, 0xF2, 0x02, 0xC8, 0x03, 0x5B, 0x05, 
-    0x46, 0x07, 0xA6, 0x08, 0x9A, 0x08, 0xAA, 0x07, 0x95, 0x06, 0xCC, 0x05, 0x35, 0x05, 0x6C, 0x04, 
-    0x70, 0x03, 0x28, 0x02, 0x78, 0x01, 0xD5, 0x00, 0xA2, 0x00, 0x57, 0x00, 0xDA, 0xFF, 0x68, 0xFF, 
-    0x79, 0xFE, 0x00, 0xFD, 0x08, 0xFB, 0x9F, 0xF8, 0xCD, 0xF6, 0x93, 0xF5, 0xBD, 0xF4, 0x3F, 0xF4, 
-    0x9B, 0xF3, 0xE7, 0xF3, 0xB0, 0xF4, 0x9B, 0xF6, 0xAC, 0xF8, 0x97, 0xFA, 0x68, 0xFC, 0xD6, 0xFD, 
-    0x1D, 0xFF, 0x18, 0x00, 0x89, 0x00, 0x57, 0x00, 0xC1, 0xFF, 0xDE, 0xFE, 0x21, 0xFE, 0x8A, 0xFD, 
-    0x8E, 0xFC, 0x10, 0xFC, 0x9F, 0xFB, 0x36, 0xFC, 0x0C, 0xFD, 0xA3, 0xFD, 0x47, 0xFE, 0x2E, 0xFE, 
-    0xB8, 0xFE, 0xEB, 0xFE, 0x29, 0xFF, 0xD1, 0xFE, 0x60, 0xFE, 0xD6, 0xFD, 0xD6, 0xFD, 0xBC, 0xFD, 
-    0x15, 0xFE, 0x79, 0xFE, 0x10, 0xFF, 0x3D, 0x00, 0x46, 0x01, 0x81, 0x02, 0x0B, 0x03, 0x70, 0x03, 
-    0x4A, 0x03, 0xF2, 0x02, 0x28, 0x02, 0xBB, 0x00, 0xF7, 0xFE, 0x00, 0xFD, 0x3A, 0xFB, 0x00, 0xFA, 
-    0xDE, 0xF8, 0x54, 0xF8, 0x2E, 0xF8, 0x9F, 0xF8, 0x75, 0xF9, 0x64, 0xFA, 0xC5, 0xFB, 0xDA, 0xFC, 
-    0xEF, 0xFD, 0xDE, 0xFE, 0x43, 0xFF, 0x4F, 0xFF, 0xC5, 0xFE, 0xFB, 0xFD, 0x25, 0xFD, 0x43, 0xFC, 
-    0xB8, 0xFB, 0x47, 0xFB, 0x3A, 0xFB, 0x79, 0xFB, 0xF7, 0xFB, 0x9B, 0xFC, 0x4B, 0xFD, 0x08, 0xFE, 
-    0xC5, 0xFE, 0x36, 0xFF, 0x75, 0xFF, 0x68, 0xFF, 0xEB, 0xFE, 0x6D, 0xFE, 0x7D, 0xFD, 0xDA, 0xFC, 
-    0x04, 0xFC, 0x3A, 0xFB, 0xB0, 0xFA, 0x8A, 0xFA, 0xB0, 0xFA, 0x60, 0xFB, 0x43, 0xFC, 0x3F, 0xFD, 
-    0xB8, 0xFE, 0xC1, 0xFF, 0x39, 0x01, 0xDD, 0x01, 0x42, 0x02, 0x67, 0x02, 0x35, 0x02, 0x67, 0x02, 
-    0xE9, 0x01, 0xAB, 0x01, 0x07, 0x01, 0x3D, 0x00, 0xCD, 0xFF, 0x68, 0xFF, 0xEB, 0xFE, 0xF7, 0xFE, 
-    0x04, 0xFF, 0x4F, 0xFF, 0x31, 0x00, 0x70, 0x00, 0x07, 0x01, 0x42, 0x02, 0x78, 0x04, 0x41, 0x08, 
-    0xBB, 0x0C, 0xED, 0x0F, 0xA6, 0x11, 0x35, 0x11, 0x52, 0x10, 0xD4, 0x0F, 0xFA, 0x0F, 0x39, 0x10, 
-    0x70, 0x0F, 0xC3, 0x0D, 0x4E, 0x0B, 0xE5, 0x08, 0xA2, 0x06, 0x67, 0x05, 0xAA, 0x04, 0xC4, 0x04, 
-    0x1C, 0x05, 0x4E, 0x05, 0x42, 0x05, 0x0F, 0x05, 0x67, 0x05, 0x7C, 0x06, 0xAA, 0x07, 0x03, 0x08, 
-    0x9E, 0x07, 0x0B, 0x06, 0xF6, 0x04, 0x46, 0x04, 0xE1, 0x03, 0x70, 0x03, 0xF2, 0x02, 0x28, 0x02, 
-    0xB7, 0x01, 0x39, 0x01, 0xC8, 0x00, 0x57, 0x00, 0x9B, 0xFF, 0xDE, 0xFE, 0xB0, 0xFD, 0x04, 0xFC, 
-    0xF3, 0xF9, 0xD6, 0xF7, 0x5C, 0xF6, 0xAC, 0xF5, 0x60, 0xF5, 0x21, 0xF5, 0xA3, 0xF4, 0xB0, 0xF4, 
-    0x2E, 0xF5, 0xB4, 0xF6, 0x54, 0xF8, 0xF3, 0xF9, 0x60, 0xFB, 0x82, 0xFC, 0xC9, 0xFD, 0xDE, 0xFE, 
-    0x75, 0xFF, 0xA7, 0xFF, 0x1D, 0xFF, 0x3A, 0xFE, 0xBC, 0xFD, 0xCD, 0xFC, 0x75, 0xFC, 0x36, 0xFC, 
-    0x5C, 0xFC, 0x25, 0xFD, 0xB0, 0xFD, 0x15, 0xFE, 0x21, 0xFE, 0x21, 0xFE, 0x86, 0xFE, 0xB8, 0xFE, 
-    0xEB, 0xFE, 0xD1, 0xFE, 0xAC, 0xFE, 0x92, 0xFE, 0x92, 0xFE, 0xC5, 0xFE, 0xD1, 0xFE, 0x29, 0xFF, 
-    0x82, 0xFF, 0x24, 0x00, 0x13, 0x01, 0xDD, 0x01, 0x74, 0x02, 0xD9, 0x02, 0x8D, 0x02, 0x74, 0x02, 
-    0x9E, 0x01, 0x89, 0x00, 0x36, 0xFF, 0xA3, 0xFD, 0x43, 0xFC, 0xEF, 0xFA, 0xF3, 0xF9, 0x36, 0xF9, 
-    0x04, 0xF9, 0x4F, 0xF9, 0x00, 0xFA, 0xBC, 0xFA, 0x92, 0xFB, 0x5C, 0xFC, 0x25, 0xFD, 0xEF, 0xFD, 
-    0x92, 0xFE, 0xB8, 0xFE, 0x92, 0xFE, 0x15, 0xFE, 0x64, 0xFD, 0xCD, 0xFC, 0x5C, 0xFC, 0xEB, 0xFB, 
-    0xEB, 0xFB, 0xF7, 0xFB, 0x82, 0xFC, 0xE6, 0xFC, 0x71, 0xFD, 0xFB, 0xFD, 0x92, 0xFE, 0xF7, 0xFE, 
-    0x36, 0xFF, 0x10, 0xFF, 0x9F, 0xFE, 0x2E, 0xFE, 0x8A, 0xFD, 0x25, 0xFD, 0xB4, 0xFC, 0x1D, 0xFC, 
-    0xC5, 0xFB, 0x86, 0xFB, 0x9F, 0xFB, 0x36, 0xFC, 0x8E, 0xFC, 0x71, 0xFD, 0x2E, 0xFE, 0x36, 0xFF, 
-    0x00, 0x00, 0x7C, 0x00, 0xEE, 0x00, 0x46, 0x01, 0x85, 0x01, 0x67, 0x02, 0x81, 0x02, 0x67, 0x02, 
-    0x5B, 0x02, 0x2D, 0x01, 0xD5, 0x00, 0x24, 0x00, 0xE6, 0xFF, 0x75, 0xFF, 0x68, 0xFF, 0x4F, 0xFF, 
-    0xA7, 0xFF, 0xCD, 0xFF, 0x0B, 0x00, 0x31, 0x00, 0x5F, 0x01, 0x70, 0x03, 0x07, 0x07, 0x8D, 0x0B, 
-    0x5B, 0x0E, 0x6B, 0x10, 0xBB, 0x0F, 0x24, 0x0F, 0xCC, 0x0E, 0x17, 0x0F, 0x24, 0x0F, 0x8D, 0x0E, 
-    0xED, 0x0C, 0xAA, 0x0A, 0x35, 0x08, 0x31, 0x06, 0xE9, 0x04, 0x2D, 0x04, 0xB7, 0x04, 0xDD, 0x04, 
-    0x5B, 0x05, 0x1C, 0x05, 0xE9, 0x04, 0x0F, 0x05, 0x0B, 0x06, 0xEE, 0x06, 0x6B, 0x07, 0xA2, 0x06, 
-    0x74, 0x05, 0x46, 0x04, 0xA2, 0x03, 0x4A, 0x03, 0xBF, 0x02, 0x67, 0x02, 0x9E, 0x01, 0x91, 0x01, 
-    0x2D, 0x01, 0xE1, 0x00, 0x63, 0x00, 0xC1, 0xFF, 0xF7, 0xFE, 0x15, 0xFE, 0x68, 0xFC, 0xA3, 0xFA, 
-    0xAC, 0xF8, 0x32, 0xF7, 0xC1, 0xF6, 0x69, 0xF6, 0x36, 0xF6, 0xC5, 0xF5, 0x9F, 0xF5, 0x5C, 0xF6, 
-    0xD6, 0xF7, 0xA7, 0xF9, 0x6D, 0xFB, 0xC1, 0xFC, 0xBC, 0xFD, 0x53, 0xFE, 0x86, 0xFE, 0x86, 0xFE, 
-    0x2E, 0xFE, 0xE2, 0xFD, 0x97, 0xFD, 0x58, 0xFD, 0x32, 0xFD, 0xC1, 0xFC, 0x9B, 0xFC, 0xCD, 0xFC, 
-    0x58, 0xFD, 0x3A, 0xFE, 0xAC, 0xFE, 0xF7, 0xFE, 0x04, 0xFF, 0xD1, 0xFE, 0xF7, 0xFE, 0xD1, 0xFE, 
-    0x79, 0xFE, 0x53, 0xFE, 0xE2, 0xFD, 0xC9, 0xFD, 0xA3, 0xFD, 0xB0, 0xFD, 0x15, 0xFE, 0x86, 0xFE, 
-    0x82, 0xFF, 0x7C, 0x00, 0x85, 0x01, 0x5B, 0x02, 0x8D, 0x02, 0x81, 0x02, 0xE9, 0x01, 0x39, 0x01, 
-    0x31, 0x00, 0xDE, 0xFE, 0xA3, 0xFD, 0x5C, 0xFC, 0x15, 0xFB, 0x3F, 0xFA, 0x9B, 0xF9, 0x75, 0xF9, 
-    0xE6, 0xF9, 0x58, 0xFA, 0x21, 0xFB, 0xAC, 0xFB, 0x75, 0xFC, 0x4B, 0xFD, 0xC9, 0xFD, 0x53, 0xFE, 
-    0x79, 0xFE, 0x53, 0xFE, 0x08, 0xFE, 0x7D, 0xFD, 0xF3, 0xFC, 0x43, 0xFC, 0x04, 0xFC, 0x1D, 0xFC, 
-    0x75, 0xFC, 0x0C, 0xFD, 0x7D, 0xFD, 0xE2, 0xFD, 0x86, 0xFE, 0x43, 0xFF, 0xDA, 0xFF, 0x18, 0x00, 
-    0xCD, 0xFF, 0x5C, 0xFF, 0x9F, 0xFE, 0xEF, 0xFD, 0x3F, 0xFD, 0x82, 0xFC, 0xF7, 0xFB, 0x6D, 0xFB, 
-    0x79, 0xFB, 0x9F, 0xFB, 0x75, 0xFC, 0x4B, 0xFD, 0x53, 0xFE, 0xDE, 0xFE, 0x9B, 0xFF, 0xC1, 0xFF, 
-    0x31, 0x00, 0xD5, 0x00, 0x52, 0x01, 0x81, 0x02, 0xA6, 0x02, 0xF2, 0x02, 0x1C, 0x02, 0x52, 0x01, 
-    0xAF, 0x00, 0x4A, 0x00, 0x4A, 0x00, 0x7C, 0x00, 0x70, 0x00, 0x7C, 0x00, 0x57, 0x00, 0x31, 0x00, 
-    0x4A, 0x00, 0x24, 0x00, 0x07, 0x01, 0x0F, 0x02, 0xD0, 0x04, 0xB3, 0x08, 0xF2, 0x0B, 0x5B, 0x0E, 
-    0x5B, 0x0E, 0x78, 0x0D, 0x5F, 0x0D, 0x91, 0x0D, 0x8D, 0x0E, 0x9A, 0x0E, 0x02, 0x0E, 0x7C, 0x0C, 
-    0x52, 0x0A, 0x74, 0x08, 0xAF, 0x06, 0xD9, 0x05, 0xA6, 0x05, 0xCC, 0x05, 0x18, 0x06, 0x18, 0x06, 
-    0x8D, 0x05, 0xBF, 0x05, 0xCC, 0x05, 0xE1, 0x06, 0x52, 0x07, 0x20, 0x07, 0x24, 0x06, 0xDD, 0x04, 
-    0xFA, 0x03, 0x24, 0x03, 0xBF, 0x02, 0x28, 0x02, 0x91, 0x01, 0x20, 0x01, 0xD5, 0x00, 0x57, 0x00, 
-    0x3D, 0x00, 0xB4, 0xFF, 0x75, 0xFF, 0xC5, 0xFE, 0xBC, 0xFD, 0x68, 0xFC, 0x7E, 0xFA, 0x2A, 0xF9, 
-    0x47, 0xF8, 0xE2, 0xF7, 0xA3, 0xF7, 0x0C, 0xF7, 0x69, 0xF6, 0x5C, 0xF6, 0xDA, 0xF6, 0x2E, 0xF8, 
-    0x69, 0xF9, 0xA3, 0xFA, 0xDE, 0xFB, 0xB4, 0xFC, 0x4B, 0xFD, 0xC9, 0xFD, 0xA3, 0xFD, 0xEF, 0xFD, 
-    0xB0, 0xFD, 0x8A, 0xFD, 0x97, 0xFD, 0x25, 0xFD, 0x32, 0xFD, 0x00, 0xFD, 0x0C, 0xFD, 0x8A, 0xFD, 
-    0xBC, 0xFD, 0x2E, 0xFE, 0x53, 0xFE, 0x60, 0xFE, 0xAC, 0xFE, 0x92, 0xFE, 0x9F, 0xFE, 0x86, 0xFE, 
-    0x6D, 0xFE, 0x53, 0xFE, 0x47, 0xFE, 0x3A, 0xFE, 0x6D, 0xFE, 0xC5, 0xFE, 0x5C, 0xFF, 0xB4, 0xFF, 
-    0x63, 0x00, 0xE1, 0x00, 0x46, 0x01, 0x6C, 0x01, 0x46, 0x01, 0x07, 0x01, 0x89, 0x00, 0xDA, 0xFF, 
-    0xF7, 0xFE, 0xEF, 0xFD, 0xF3, 0xFC, 0x04, 0xFC, 0x47, 0xFB, 0xEF, 0xFA, 0xB0, 0xFA, 0xE2, 0xFA, 
-    0x08, 0xFB, 0x47, 0xFB, 0xD1, 0xFB, 0x4F, 0xFC, 0xDA, 0xFC, 0x71, 0xFD, 0xD6, 0xFD, 0x47, 0xFE, 
-    0x60, 0xFE, 0x21, 0xFE, 0xC9, 0xFD, 0x32, 0xFD, 0xF3, 0xFC, 0xCD, 0xFC, 0x0C, 0xFD, 0x71, 0xFD, 
-    0xB0, 0xFD, 0xBC, 0xFD, 0xFB, 0xFD, 0xFB, 0xFD, 0x79, 0xFE, 0xC5, 0xFE, 0xD1, 0xFE, 0xC5, 0xFE, 
-    0x60, 0xFE, 0x2E, 0xFE, 0xE2, 0xFD, 0xE2, 0xFD, 0xE2, 0xFD, 0x97, 0xFD, 0x32, 0xFD, 0xB4, 0xFC, 
-    0x1D, 0xFC, 0x43, 0xFC, 0x9B, 0xFC, 0xA3, 0xFD, 0xB8, 0xFE, 0x9B, 0xFF, 0x3D, 0x00, 0x4A, 0x00, 
-    0xA2, 0x00, 0xD5, 0x00, 0x39, 0x01, 0x9E, 0x01, 0x5F, 0x01, 0x13, 0x01, 0x89, 0x00, 0x3D, 0x00, 
-    0x70, 0x00, 0x57, 0x00, 0x70, 0x00, 0xCD, 0xFF, 0x75, 0xFF, 0x75, 0xFF, 0xA7, 0xFF, 0x4A, 0x00, 
-    0xEE, 0x00, 0x46, 0x01, 0x03, 0x02, 0x70, 0x03, 0x95, 0x06, 0xBB, 0x09, 0x24, 0x0C, 0xBB, 0x0C, 
-    0xE5, 0x0B, 0x67, 0x0B, 0x35, 0x0B, 0x8D, 0x0B, 0xBF, 0x0B, 0xF2, 0x0B, 0xBF, 0x0B, 0xE9, 0x0A, 
-    0x70, 0x09, 0x1C, 0x08, 0xAF, 0x06, 0x63, 0x06, 0xA2, 0x06, 0x13, 0x07, 0x2D, 0x07, 0xA2, 0x06, 
-    0x18, 0x06, 0xA6, 0x05, 0x18, 0x06, 0xAF, 0x06, 0xC8, 0x06, 0x4A, 0x06, 0x74, 0x05, 0x6C, 0x04, 
-    0xAF, 0x03, 0xE5, 0x02, 0x4E, 0x02, 0xD0, 0x01, 0x9E, 0x01, 0x78, 0x01, 0x07, 0x01, 0x70, 0x00, 
-    0xCD, 0xFF, 0x1D, 0xFF, 0x86, 0xFE, 0xEF, 0xFD, 0xF3, 0xFC, 0x9F, 0xFB, 0x64, 0xFA, 0xB4, 0xF9, 
-    0x2A, 0xF9, 0x04, 0xF9, 0x6D, 0xF8, 0xEF, 0xF7, 0xB0, 0xF7, 0x3A, 0xF8, 0xEB, 0xF8, 0xCD, 0xF9, 
-    0x8A, 0xFA, 0xEF, 0xFA, 0x79, 0xFB, 0xF7, 0xFB, 0xB4, 0xFC, 0x19, 0xFD, 0x58, 0xFD, 0x32, 0xFD, 
-    0x00, 0xFD, 0xE6, 0xFC, 0x19, 0xFD, 0x00, 0xFD, 0x3F, 0xFD, 0x3F, 0xFD, 0x97, 0xFD, 0xE2, 0xFD, 
-    0xFB, 0xFD, 0x15, 0xFE, 0xFB, 0xFD, 0x2E, 0xFE, 0x53, 0xFE, 0x60, 0xFE, 0x2E, 0xFE, 0xEF, 0xFD, 
-    0xB0, 0xFD, 0xC9, 0xFD, 0xEF, 0xFD, 0x53, 0xFE, 0x60, 0xFE, 0xD1, 0xFE, 0x10, 0xFF, 0x82, 0xFF, 
-    0x3D, 0x00, 0x7C, 0x00, 0xA2, 0x00, 0xA2, 0x00, 0x70, 0x00, 0x57, 0x00, 0xC1, 0xFF, 0x1D, 0xFF, 
-    0x60, 0xFE, 0x97, 0xFD, 0x3F, 0xFD, 0xB4, 0xFC, 0x68, 0xFC, 0x04, 0xFC, 0xEB, 0xFB, 0x10, 0xFC, 
-    0x68, 0xFC, 0xF3, 0xFC, 0x64, 0xFD, 0x8A, 0xFD, 0xFB, 0xFD, 0x53, 0xFE, 0xD1, 0xFE, 0x10, 0xFF, 
-    0xF7, 0xFE, 0x9F, 0xFE, 0x21, 0xFE, 0xE2, 0xFD, 0xC9, 0xFD, 0xD6, 0xFD, 0x08, 0xFE, 0x2E, 0xFE, 
-    0x47, 0xFE, 0x53, 0xFE, 0x6D, 0xFE, 0x92, 0xFE, 0xDE, 0xFE, 0x29, 0xFF, 0x5C, 0xFF, 0x68, 0xFF, 
-    0x5C, 0xFF, 0x04, 0xFF, 0xC5, 0xFE, 0x92, 0xFE, 0x60, 0xFE, 0x15, 0xFE, 0x71, 0xFD, 0xF3, 0xFC, 
-    0xA7, 0xFC, 0xB4, 0xFC, 0x32, 0xFD, 0xB0, 0xFD, 0x3A, 0xFE, 0x1D, 0xFF, 0xC1, 0xFF, 0x3D, 0x00, 
-    0x7C, 0x00, 0x7C, 0x00, 0xD5, 0x00, 0x07, 0x01, 0x91, 0x01, 0x2D, 0x01, 0xBB, 0x00, 0x63, 0x00, 
-    0x4A, 0x00, 0x63, 0x00, 0x4A, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0x57, 0x00, 0xC8, 0x00, 0x5F, 0x01, 
-    0xFA, 0x00, 0x2D, 0x01, 0xD5, 0x00, 0x78, 0x01, 0x7C, 0x03, 0x3D, 0x06, 0xD9, 0x08, 0xFA, 0x09, 
-    0x70, 0x09, 0x5B, 0x08, 0x1C, 0x08, 0x8D, 0x08, 0x7C, 0x09, 0x07, 0x0A, 0xD0, 0x0A, 0xD0, 0x0A, 
-    0x46, 0x0A, 0x4A, 0x09, 0x5B, 0x08, 0xDD, 0x07, 0xD0, 0x07, 0x41, 0x08, 0x35, 0x08, 0xB7, 0x07, 
-    0xBB, 0x06, 0xD9, 0x05, 0x9A, 0x05, 0x18, 0x06, 0x63, 0x06, 0x57, 0x06, 0x8D, 0x05, 0x03, 0x05, 
-    0x85, 0x04, 0xFA, 0x03, 0x96, 0x03, 0xF2, 0x02, 0x81, 0x02, 0x67, 0x02, 0xF6, 0x01, 0x46, 0x01, 
-    0x89, 0x00, 0x82, 0xFF, 0x10, 0xFF, 0x79, 0xFE, 0xFB, 0xFD, 0x19, 0xFD, 0xF7, 0xFB, 0x15, 0xFB, 
-    0x7E, 0xFA, 0x4B, 0xFA, 0x71, 0xFA, 0x19, 0xFA, 0xDA, 0xF9, 0xB4, 0xF9, 0x82, 0xF9, 0xB4, 0xF9, 
-    0x8E, 0xF9, 0xC1, 0xF9, 0x19, 0xFA, 0xB0, 0xFA, 0x2E, 0xFB, 0x47, 0xFB, 0x15, 0xFB, 0x2E, 0xFB, 
-    0x47, 0xFB, 0xF7, 0xFB, 0x9B, 0xFC, 0xE6, 0xFC, 0xDA, 0xFC, 0x8E, 0xFC, 0x8E, 0xFC, 0xF3, 0xFC, 
-    0x58, 0xFD, 0x7D, 0xFD, 0x8A, 0xFD, 0x97, 0xFD, 0xB0, 0xFD, 0xB0, 0xFD, 0xA3, 0xFD, 0x3F, 0xFD, 
-    0x3F, 0xFD, 0x58, 0xFD, 0xB0, 0xFD, 0xFB, 0xFD, 0x15, 0xFE, 0x79, 0xFE, 0xAC, 0xFE, 0x29, 0xFF, 
-    0xA7, 0xFF, 0xC1, 0xFF, 0xCD, 0xFF, 0xCD, 0xFF, 0xCD, 0xFF, 0xF3, 0xFF, 0xB4, 0xFF, 0x68, 0xFF, 
-    0xEB, 0xFE, 0x92, 0xFE, 0x6D, 0xFE, 0x21, 0xFE, 0xC9, 0xFD, 0x7D, 0xFD, 0x64, 0xFD, 0x7D, 0xFD, 
-    0xB0, 0xFD, 0xD6, 0xFD, 0x2E, 0xFE, 0x47, 0xFE, 0xAC, 0xFE, 0xD1, 0xFE, 0xC5, 0xFE, 0x86, 0xFE, 
-    0x3A, 0xFE, 0xEF, 0xFD, 0xD6, 0xFD, 0xE2, 0xFD, 0xD6, 0xFD, 0xD6, 0xFD, 0xC9, 0xFD, 0xBC, 0xFD, 
-    0xD6, 0xFD, 0xD6, 0xFD, 0x21, 0xFE, 0x6D, 0xFE, 0xAC, 0xFE, 0xC5, 0xFE, 0xEB, 0xFE, 0x1D, 0xFF, 
-    0x36, 0xFF, 0x10, 0xFF, 0xDE, 0xFE, 0x60, 0xFE, 0x15, 0xFE, 0x97, 0xFD, 0x4B, 0xFD, 0x4B, 0xFD, 
-    0x0C, 0xFD, 0x64, 0xFD, 0x97, 0xFD, 0x15, 0xFE, 0xC5, 0xFE, 0x36, 0xFF, 0x8E, 0xFF, 0xC1, 0xFF, 
-    0x24, 0x00, 0xA2, 0x00, 0xE1, 0x00, 0xE1, 0x00, 0xC8, 0x00, 0x63, 0x00, 0xA2, 0x00, 0xA2, 0x00, 
-    0x89, 0x00, 0x70, 0x00, 0x24, 0x00, 0x31, 0x00, 0x63, 0x00, 0x07, 0x01, 0x91, 0x01, 0xE9, 0x01, 
-    0xC4, 0x01, 0xB7, 0x01, 0x6C, 0x01, 0xD0, 0x01, 0x24, 0x03, 0x28, 0x05, 0xAA, 0x07, 0xF2, 0x08, 
-    0xE5, 0x08, 0xE9, 0x07, 0x39, 0x07, 0x91, 0x07, 0x9A, 0x08, 0xA2, 0x09, 0x52, 0x0A, 0x6B, 0x0A, 
-    0xEE, 0x09, 0x31, 0x09, 0x67, 0x08, 0x03, 0x08, 0xDD, 0x07, 0xF6, 0x07, 0xD0, 0x07, 0x78, 0x07, 
-    0xAF, 0x06, 0xBF, 0x05, 0x80, 0x05, 0x74, 0x05, 0x0B, 0x06, 0x0B, 0x06, 0x8D, 0x05, 0x03, 0x05, 
-    0x46, 0x04, 0xFA, 0x03, 0xA2, 0x03, 0x3D, 0x03, 0xBF, 0x02, 0x42, 0x02, 0xC4, 0x01, 0x52, 0x01, 
-    0x89, 0x00, 0x0B, 0x00, 0x4F, 0xFF, 0xDE, 0xFE, 0x53, 0xFE, 0xA3, 0xFD, 0xCD, 0xFC, 0x04, 0xFC, 
-    0xB8, 0xFB, 0x86, 0xFB, 0x6D, 0xFB, 0x2E, 0xFB, 0x97, 0xFA, 0x32, 0xFA, 0x32, 0xFA, 0x32, 0xFA, 
-    0x8A, 0xFA, 0x58, 0xFA, 0x4B, 0xFA, 0x3F, 0xFA, 0x71, 0xFA, 0x08, 0xFB, 0x60, 0xFB, 0xB8, 0xFB, 
-    0xC5, 0xFB, 0x10, 0xFC, 0x5C, 0xFC, 0x75, 0xFC, 0x8E, 0xFC, 0xA7, 0xFC, 0xE6, 0xFC, 0x4B, 0xFD, 
-    0x64, 0xFD, 0x32, 0xFD, 0xE6, 0xFC, 0xC1, 0xFC, 0x25, 0xFD, 0x3F, 0xFD, 0xA3, 0xFD, 0x64, 0xFD, 
-    0x0C, 0xFD, 0x00, 0xFD, 0x64, 0xFD, 0xD6, 0xFD, 0x60, 0xFE, 0xAC, 0xFE, 0xF7, 0xFE, 0x1D, 0xFF, 
-    0x4F, 0xFF, 0x82, 0xFF, 0x8E, 0xFF, 0xB4, 0xFF, 0xDA, 0xFF, 0xDA, 0xFF, 0xA7, 0xFF, 0x43, 0xFF, 
-    0xC5, 0xFE, 0x92, 0xFE, 0x86, 0xFE, 0x86, 0xFE, 0x53, 0xFE, 0x15, 0xFE, 0xE2, 0xFD, 0xE2, 0xFD, 
-    0x15, 0xFE, 0x6D, 0xFE, 0x92, 0xFE, 0xAC, 0xFE, 0xDE, 0xFE, 0xD1, 0xFE, 0x92, 0xFE, 0x60, 0xFE, 
-    0x2E, 0xFE, 0x15, 0xFE, 0x21, 0xFE, 0x47, 0xFE, 0x47, 0xFE, 0x21, 0xFE, 0x21, 0xFE, 0x15, 0xFE, 
-    0x15, 0xFE, 0x2E, 0xFE, 0x79, 0xFE, 0x92, 0xFE, 0xD1, 0xFE, 0xF7, 0xFE, 0x04, 0xFF, 0x1D, 0xFF, 
-    0x36, 0xFF, 0x4F, 0xFF, 0x29, 0xFF, 0xF7, 0xFE, 0xAC, 0xFE, 0x79, 0xFE, 0x60, 0xFE, 0x79, 0xFE, 
-    0xDE, 0xFE, 0xEB, 0xFE, 0x29, 0xFF, 0x04, 0xFF, 0x1D, 0xFF, 0x75, 0xFF, 0xE6, 0xFF, 0x96, 0x00, 
-    0xFA, 0x00, 0x78, 0x01, 0x39, 0x01, 0xFA, 0x00, 0x13, 0x01, 0x20, 0x01, 0xB7, 0x01, 0xF6, 0x01, 
-    0xC4, 0x01, 0x91, 0x01, 0x13, 0x01, 0xEE, 0x00, 0xEE, 0x00, 0x13, 0x01, 0xC4, 0x01, 0xD0, 0x01, 
-    0x42, 0x02, 0x42, 0x02, 0xD0, 0x01, 0xF6, 0x01, 0xB7, 0x01, 0x9A, 0x02, 0xBB, 0x03, 0x9A, 0x05, 
-    0x39, 0x07, 0x91, 0x07, 0x78, 0x07, 0xEE, 0x06, 0x95, 0x06, 0x2D, 0x07, 0xAA, 0x07, 0x35, 0x08, 
-    0xA6, 0x08, 0x4E, 0x08, 0x41, 0x08, 0x2D, 0x07, 0xAF, 0x06, 0x57, 0x06, 0xF2, 0x05, 0x4A, 0x06, 
-    0x18, 0x06, 0x9A, 0x05, 0xF6, 0x04, 0x6C, 0x04, 0x5F, 0x04, 0x9E, 0x04, 0xAA, 0x04, 0xB7, 0x04, 
-    0x13, 0x04, 0xE1, 0x03, 0x96, 0x03, 0x0B, 0x03, 0x9A, 0x02, 0x35, 0x02, 0xE9, 0x01, 0xAB, 0x01, 
-    0x2D, 0x01, 0x7C, 0x00, 0x8E, 0xFF, 0xD1, 0xFE, 0x92, 0xFE, 0x2E, 0xFE, 0xEF, 0xFD, 0x25, 0xFD, 
-    0x1D, 0xFC, 0x79, 0xFB, 0x21, 0xFB, 0x47, 0xFB, 0x3A, 0xFB, 0xC9, 0xFA, 0xC9, 0xFA, 0x7E, 0xFA, 
-    0x97, 0xFA, 0xA3, 0xFA, 0x4B, 0xFA, 0x3F, 0xFA, 0x32, 0xFA, 0x64, 0xFA, 0xB0, 0xFA, 0xBC, 0xFA, 
-    0x08, 0xFB, 0x2E, 0xFB, 0x79, 0xFB, 0x1D, 0xFC, 0x2A, 0xFC, 0x68, 0xFC, 0x5C, 0xFC, 0x75, 0xFC, 
-    0xC1, 0xFC, 0xDA, 0xFC, 0xE6, 0xFC, 0xA7, 0xFC, 0xA7, 0xFC, 0xF3, 0xFC, 0x00, 0xFD, 0x32, 0xFD, 
-    0x00, 0xFD, 0xC1, 0xFC, 0x00, 0xFD, 0x25, 0xFD, 0xD6, 0xFD, 0x21, 0xFE, 0x79, 0xFE, 0xF7, 0xFE, 
-    0x10, 0xFF, 0x68, 0xFF, 0xB4, 0xFF, 0x9B, 0xFF, 0xCD, 0xFF, 0xB4, 0xFF, 0xB4, 0xFF, 0xA7, 0xFF, 
-    0x68, 0xFF, 0x4F, 0xFF, 0x1D, 0xFF, 0x10, 0xFF, 0x10, 0xFF, 0xD1, 0xFE, 0xAC, 0xFE, 0x9F, 0xFE, 
-    0x9F, 0xFE, 0xD1, 0xFE, 0xDE, 0xFE, 0xF7, 0xFE, 0xEB, 0xFE, 0xDE, 0xFE, 0xDE, 0xFE, 0xAC, 0xFE, 
-    0x86, 0xFE, 0x60, 0xFE, 0x53, 0xFE, 0x53, 0xFE, 0x47, 0xFE, 0x53, 0xFE, 0x47, 0xFE, 0x21, 0xFE, 
-    0x3A, 0xFE, 0x08, 0xFE, 0x3A, 0xFE, 0x79, 0xFE, 0x9F, 0xFE, 0xC5, 0xFE, 0xD1, 0xFE, 0xD1, 0xFE, 
-    0xD1, 0xFE, 0xDE, 0xFE, 0xEB, 0xFE, 0xD1, 0xFE, 0xD1, 0xFE, 0xDE, 0xFE, 0xEB, 0xFE, 0x36, 0xFF, 
-    0x1D, 0xFF, 0x10, 0xFF, 0xF7, 0xFE, 0x5C, 0xFF, 0xF3, 0xFF, 0x70, 0x00, 0xE1, 0x00, 0x13, 0x01, 
-    0x2D, 0x01, 0x9E, 0x01, 0x78, 0x01, 0x85, 0x01, 0x5F, 0x01, 0x6C, 0x01, 0x91, 0x01, 0x91, 0x01, 
-    0xDD, 0x01, 0xF6, 0x01, 0x0F, 0x02, 0x4E, 0x02, 0x81, 0x02, 0x74, 0x02, 0x8D, 0x02, 0x35, 0x02, 
-    0x35, 0x02, 0x5B, 0x02, 0xBF, 0x02, 0xE5, 0x02, 0xC8, 0x03, 0xDD, 0x04, 0x57, 0x06, 0x5F, 0x07, 
-    0x46, 0x07, 0xFA, 0x06, 0x57, 0x06, 0x7C, 0x06, 0xEE, 0x06, 0x5F, 0x07, 0xB7, 0x07, 0x1C, 0x08, 
-    0x91, 0x07, 0x78, 0x07, 0x89, 0x06, 0x24, 0x06, 0xA6, 0x05, 0x67, 0x05, 0x80, 0x05, 0x28, 0x05, 
-    0xE9, 0x04, 0x52, 0x04, 0x13, 0x04, 0xFA, 0x03, 0x6C, 0x04, 0x52, 0x04, 0x39, 0x04, 0xAF, 0x03, 
-    0x4A, 0x03, 0xB3, 0x02, 0x81, 0x02, 0x28, 0x02, 0xDD, 0x01, 0xC4, 0x01, 0x5F, 0x01, 0x20, 0x01, 
-    0x63, 0x00, 0xB4, 0xFF, 0x04, 0xFF, 0x86, 0xFE, 0x21, 0xFE, 0xE2, 0xFD, 0x3F, 0xFD, 0xB4, 0xFC, 
-    0x04, 0xFC, 0xD1, 0xFB, 0xD1, 0xFB, 0xDE, 0xFB, 0xC5, 0xFB, 0x60, 0xFB, 0xEF, 0xFA, 0xB0, 0xFA, 
-    0x7E, 0xFA, 0x4B, 0xFA, 0x64, 0xFA, 0xB0, 0xFA, 0x21, 0xFB, 0x79, 0xFB, 0xAC, 0xFB, 0x86, 0xFB, 
-    0x60, 0xFB, 0x6D, 0xFB, 0xD1, 0xFB, 0x36, 0xFC, 0xB4, 0xFC, 0xB4, 0xFC, 0x9B, 0xFC, 0x82, 0xFC, 
-    0x82, 0xFC, 0x9B, 0xFC, 0xB4, 0xFC, 0xB4, 0xFC, 0xDA, 0xFC, 0xA7, 0xFC, 0x9B, 0xFC, 0x82, 0xFC, 
-    0x75, 0xFC, 0xB4, 0xFC, 0x0C, 0xFD, 0x64, 0xFD, 0xBC, 0xFD, 0xFB, 0xFD, 0x2E, 0xFE, 0x6D, 0xFE, 
-    0x9F, 0xFE, 0xEB, 0xFE, 0xF7, 0xFE, 0x29, 0xFF, 0x43, 0xFF, 0x43, 0xFF, 0x1D, 0xFF, 0xEB, 0xFE, 
-    0xD1, 0xFE, 0x9F, 0xFE, 0xD1, 0xFE, 0xB8, 0xFE, 0x9F, 0xFE, 0x47, 0xFE, 0x08, 0xFE, 0xE2, 0xFD, 
-    0x15, 0xFE, 0x60, 0xFE, 0x92, 0xFE, 0x92, 0xFE, 0x86, 0xFE, 0x60, 0xFE, 0x2E, 0xFE, 0x08, 0xFE, 
-    0xE2, 0xFD, 0xBC, 0xFD, 0xE2, 0xFD, 0x08, 0xFE, 0x15, 0xFE, 0x08, 0xFE, 0xFB, 0xFD, 0x15, 0xFE, 
-    0x15, 0xFE, 0x47, 0xFE, 0x6D, 0xFE, 0x9F, 0xFE, 0xEB, 0xFE, 0x4F, 0xFF, 0x82, 0xFF, 0xB4, 0xFF, 
-    0x82, 0xFF, 0x43, 0xFF, 0x1D, 0xFF, 0x43, 0xFF, 0x82, 0xFF, 0xE6, 0xFF, 0xDA, 0xFF, 0x00, 0x00, 
-    0xCD, 0xFF, 0xA7, 0xFF, 0xE6, 0xFF, 0xF3, 0xFF, 0xBB, 0x00, 0x52, 0x01, 0xE9, 0x01, 0x5B, 0x02, 
-    0x74, 0x02, 0x81, 0x02, 0x8D, 0x02, 0x5B, 0x02, 0xBF, 0x02, 0xE5, 0x02, 0xFE, 0x02, 0x3D, 0x03, 
-    0xE5, 0x02, 0x0B, 0x03, 0xE5, 0x02, 0x31, 0x03, 0x3D, 0x03, 0x57, 0x03, 0x57, 0x03, 0x24, 0x03, 
-    0x24, 0x03, 0xE1, 0x03, 0xDD, 0x04, 0x31, 0x06, 0x13, 0x07, 0x07, 0x07, 0xFA, 0x06, 0x4A, 0x06, 
-    0x57, 0x06, 0x57, 0x06, 0xC8, 0x06, 0x5F, 0x07, 0x9E, 0x07, 0x85, 0x07, 0x07, 0x07, 0x3D, 0x06, 
-    0xF2, 0x05, 0x8D, 0x05, 0xA6, 0x05, 0xA6, 0x05, 0x5B, 0x05, 0x0F, 0x05, 0x6C, 0x04, 0x13, 0x04, 
-    0xEE, 0x03, 0xC8, 0x03, 0xBB, 0x03, 0x70, 0x03, 0xFE, 0x02, 0xB3, 0x02, 0x0F, 0x02, 0xC4, 0x01, 
-    0x5F, 0x01, 0x13, 0x01, 0x13, 0x01, 0xC8, 0x00, 0x7C, 0x00, 0x18, 0x00, 0x8E, 0xFF, 0x04, 0xFF, 
-    0x92, 0xFE, 0x2E, 0xFE, 0xC9, 0xFD, 0x7D, 0xFD, 0x25, 0xFD, 0xDA, 0xFC, 0x82, 0xFC, 0x04, 0xFC, 
-    0x86, 0xFB, 0x54, 0xFB, 0xEF, 0xFA, 0xE2, 0xFA, 0xBC, 0xFA, 0xA3, 0xFA, 0xC9, 0xFA, 0xB0, 0xFA, 
-    0xD6, 0xFA, 0xFB, 0xFA, 0x08, 0xFB, 0x6D, 0xFB, 0x6D, 0xFB, 0xB8, 0xFB, 0xD1, 0xFB, 0xEB, 0xFB, 
-    0x10, 0xFC, 0x1D, 0xFC, 0x43, 0xFC, 0x68, 0xFC, 0x8E, 0xFC, 0x9B, 0xFC, 0xA7, 0xFC, 0x82, 0xFC, 
-    0x82, 0xFC, 0x43, 0xFC, 0x4F, 0xFC, 0x43, 0xFC, 0x68, 0xFC, 0x8E, 0xFC, 0xB4, 0xFC, 0xDA, 0xFC, 
-    0xE6, 0xFC, 0x0C, 0xFD, 0x32, 0xFD, 0x64, 0xFD, 0xB0, 0xFD, 0xEF, 0xFD, 0x6D, 0xFE, 0xC5, 0xFE, 
-    0x1D, 0xFF, 0x36, 0xFF, 0x4F, 0xFF, 0x4F, 0xFF, 0x5C, 0xFF, 0x43, 0xFF, 0x4F, 0xFF, 0x36, 0xFF, 
-    0xF7, 0xFE, 0xDE, 0xFE, 0xC5, 0xFE, 0xDE, 0xFE, 0xD1, 0xFE, 0xEB, 0xFE, 0xD1, 0xFE, 0xD1, 0xFE, 
-    0xB8, 0xFE, 0xB8, 0xFE, 0x92, 0xFE, 0xAC, 0xFE, 0xAC, 0xFE, 0xAC, 0xFE, 0xAC, 0xFE, 0x92, 0xFE, 
-    0x92, 0xFE, 0x6D, 0xFE, 0x6D, 0xFE, 0x6D, 0xFE, 0x60, 0xFE, 0x79, 0xFE, 0xC5, 0xFE, 0xDE, 0xFE, 
-    0x4F, 0xFF, 0x43, 0xFF, 0x82, 0xFF, 0x9B, 0xFF, 0xDA, 0xFF, 0x24, 0x00, 0x18, 0x00, 0x18, 0x00, 
-    0xCD, 0xFF, 0xA7, 0xFF, 0xC1, 0xFF, 0xE6, 0xFF, 0x24, 0x00, 0x70, 0x00, 0x89, 0x00, 0xFA, 0x00, 
-    0xAF, 0x00, 0xEE, 0x00, 0xC8, 0x00, 0x07, 0x01, 0x91, 0x01, 0x0F, 0x02, 0x8D, 0x02, 0xFE, 0x02, 
-    0x57, 0x03, 0xA2, 0x03, 0xD4, 0x03, 0xD4, 0x03, 0xFA, 0x03, 0x7C, 0x03, 0xEE, 0x03, 0xAF, 0x03, 
-    0x07, 0x04, 0x13, 0x04, 0x07, 0x04, 0x07, 0x04, 0xC8, 0x03, 0x13, 0x04, 0xD0, 0x04, 0x8D, 0x05, 
-    0x3D, 0x06, 0xAF, 0x06, 0x4A, 0x06, 0x7C, 0x06, 0xE5, 0x05, 0x24, 0x06, 0x31, 0x06, 0x4A, 0x06, 
-    0xA2, 0x06, 0x89, 0x06, 0x57, 0x06, 0x0B, 0x06, 0x42, 0x05, 0xF6, 0x04, 0x9E, 0x04, 0x6C, 0x04, 
-    0x6C, 0x04, 0xFA, 0x03, 0xC8, 0x03, 0x63, 0x03, 0x4A, 0x03, 0x31, 0x03, 0xD9, 0x02, 0xA6, 0x02, 
-    0x1C, 0x02, 0xAB, 0x01, 0x46, 0x01, 0xBB, 0x00, 0x57, 0x00, 0x0B, 0x00, 0xC1, 0xFF, 0xC1, 0xFF, 
-    0x43, 0xFF, 0x04, 0xFF, 0x86, 0xFE, 0x2E, 0xFE, 0x3A, 0xFE, 0xEF, 0xFD, 0xA3, 0xFD, 0x19, 0xFD, 
-    0x82, 0xFC, 0x75, 0xFC, 0x43, 0xFC, 0x36, 0xFC, 0x36, 0xFC, 0xF7, 0xFB, 0x1D, 0xFC, 0xB8, 0xFB, 
-    0x79, 0xFB, 0x3A, 0xFB, 0xC9, 0xFA, 0x21, 0xFB, 0x54, 0xFB, 0xC5, 0xFB, 0x10, 0xFC, 0xF7, 0xFB, 
-    0xEB, 0xFB, 0xC5, 0xFB, 0xB8, 0xFB, 0xEB, 0xFB, 0xD1, 0xFB, 0x04, 0xFC, 0x36, 0xFC, 0x43, 0xFC, 
-    0x68, 0xFC, 0x36, 0xFC, 0x4F, 0xFC, 0x68, 0xFC, 0x9B, 0xFC, 0xCD, 0xFC, 0xA7, 0xFC, 0x8E, 0xFC, 
-    0x82, 0xFC, 0x68, 0xFC, 0xA7, 0xFC, 0xCD, 0xFC, 0xF3, 0xFC, 0x25, 0xFD, 0x25, 0xFD, 0x4B, 0xFD, 
-    0x3F, 0xFD, 0x71, 0xFD, 0x97, 0xFD, 0x97, 0xFD, 0xEF, 0xFD, 0x21, 0xFE, 0x53, 0xFE, 0xAC, 0xFE, 
-    0xC5, 0xFE, 0xEB, 0xFE, 0xEB, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0x79, 0xFE, 0x6D, 0xFE, 0x53, 0xFE, 
-    0x53, 0xFE, 0x60, 0xFE, 0x60, 0xFE, 0x60, 0xFE, 0x60, 0xFE, 0x53, 0xFE, 0x79, 0xFE, 0x86, 0xFE, 
-    0x9F, 0xFE, 0xAC, 0xFE, 0xAC, 0xFE, 0xD1, 0xFE, 0xF7, 0xFE, 0x36, 0xFF, 0x43, 0xFF, 0x75, 0xFF, 
-    0x8E, 0xFF, 0x8E, 0xFF, 0x8E, 0xFF, 0x9B, 0xFF, 0xB4, 0xFF, 0xDA, 0xFF, 0x4A, 0x00, 0xE1, 0x00, 
-    0x20, 0x01, 0x39, 0x01, 0x6C, 0x01, 0xFA, 0x00, 0x46, 0x01, 0x6C, 0x01, 0x6C, 0x01, 0xDD, 0x01, 
-    0xC4, 0x01, 0x0F, 0x02, 0xE9, 0x01, 0xDD, 0x01, 0xF6, 0x01, 0xE9, 0x01, 0x4E, 0x02, 0xCC, 0x02, 
-    0xA6, 0x02, 0xE5, 0x02, 0xE5, 0x02, 0xFE, 0x02, 0x7C, 0x03, 0xA2, 0x03, 0x5F, 0x04, 0x20, 0x04, 
-    0x5F, 0x04, 0x39, 0x04, 0xE1, 0x03, 0xC8, 0x03, 0xAF, 0x03, 0xAF, 0x03, 0xFA, 0x03, 0xAA, 0x04, 
-    0x5B, 0x05, 0xBF, 0x05, 0xCC, 0x05, 0xE5, 0x05, 0x80, 0x05, 0xBF, 0x05, 0xE5, 0x05, 0xFE, 0x05, 
-    0x31, 0x06, 0x31, 0x06, 0x57, 0x06, 0x0B, 0x06, 0xF2, 0x05, 0xA6, 0x05, 0x03, 0x05, 0xC4, 0x04, 
-    0x6C, 0x04, 0x07, 0x04, 0xD4, 0x03, 0xAF, 0x03, 0xA2, 0x03, 0xC8, 0x03, 0x96, 0x03, 0xAF, 0x03, 
-    0x0B, 0x03, 0xCC, 0x02, 0x67, 0x02, 0x03, 0x02, 0xB7, 0x01, 0x46, 0x01, 0xD5, 0x00, 0x63, 0x00, 
-    0x18, 0x00, 0xCD, 0xFF, 0x68, 0xFF, 0xD1, 0xFE, 0xB8, 0xFE, 0x60, 0xFE, 0x21, 0xFE, 0xBC, 0xFD, 
-    0x19, 0xFD, 0xCD, 0xFC, 0xA7, 0xFC, 0xB4, 0xFC, 0x8E, 0xFC, 0xA7, 0xFC, 0x8E, 0xFC, 0x5C, 0xFC, 
-    0x04, 0xFC, 0xEB, 0xFB, 0x92, 0xFB, 0x86, 0xFB, 0x92, 0xFB, 0xB8, 0xFB, 0xD1, 0xFB, 0xD1, 0xFB, 
-    0xEB, 0xFB, 0xC5, 0xFB, 0xC5, 0xFB, 0xAC, 0xFB, 0xD1, 0xFB, 0xB8, 0xFB, 0xF7, 0xFB, 0xEB, 0xFB, 
-    0x1D, 0xFC, 0x2A, 0xFC, 0x36, 0xFC, 0x68, 0xFC, 0x82, 0xFC, 0x8E, 0xFC, 0x8E, 0xFC, 0x8E, 0xFC, 
-    0x82, 0xFC, 0x8E, 0xFC, 0x9B, 0xFC, 0xDA, 0xFC, 0xF3, 0xFC, 0x32, 0xFD, 0x3F, 0xFD, 0x58, 0xFD, 
-    0x64, 0xFD, 0x4B, 0xFD, 0x64, 0xFD, 0x3F, 0xFD, 0x58, 0xFD, 0x71, 0xFD, 0xA3, 0xFD, 0xB0, 0xFD, 
-    0xBC, 0xFD, 0xB0, 0xFD, 0xC9, 0xFD, 0xC9, 0xFD, 0xE2, 0xFD, 0xE2, 0xFD, 0xE2, 0xFD, 0xD6, 0xFD, 
-    0xE2, 0xFD, 0xEF, 0xFD, 0x15, 0xFE, 0x08, 0xFE, 0x2E, 0xFE, 0x3A, 0xFE, 0x47, 0xFE, 0x47, 0xFE, 
-    0x2E, 0xFE, 0x15, 0xFE, 0xE2, 0xFD, 0xBC, 0xFD, 0xEF, 0xFD, 0x3A, 0xFE, 0x92, 0xFE, 0xAC, 0xFE, 
-    0xB8, 0xFE, 0xDE, 0xFE, 0x04, 0xFF, 0x4F, 0xFF, 0x82, 0xFF, 0x8E, 0xFF, 0x75, 0xFF, 0xB4, 0xFF, 
-    0xDA, 0xFF, 0x57, 0x00, 0xBB, 0x00, 0x07, 0x01, 0x6C, 0x01, 0x78, 0x01, 0x9E, 0x01, 0x5F, 0x01, 
-    0x2D, 0x01, 0x5F, 0x01, 0x91, 0x01, 0x42, 0x02, 0xBF, 0x02, 0xBF, 0x02, 0x18, 0x03, 0xCC, 0x02, 
-    0xF2, 0x02, 0xD9, 0x02, 0xB3, 0x02, 0x31, 0x03, 0x4A, 0x03, 0xC8, 0x03, 0xEE, 0x03, 0xBB, 0x03, 
-    0xD4, 0x03, 0xC8, 0x03, 0xC8, 0x03, 0x20, 0x04, 0xFA, 0x03, 0x52, 0x04, 0x13, 0x04, 0x2D, 0x04, 
-    0x78, 0x04, 0x78, 0x04, 0xE9, 0x04, 0x42, 0x05, 0x8D, 0x05, 0xD9, 0x05, 0xBF, 0x05, 0xBF, 0x05, 
-    0x80, 0x05, 0x42, 0x05, 0x4E, 0x05, 0x35, 0x05, 0x67, 0x05, 0x74, 0x05, 0x4E, 0x05, 0x42, 0x05, 
-    0xC4, 0x04, 0x6C, 0x04, 0xFA, 0x03, 0x96, 0x03, 0xAF, 0x03, 0x63, 0x03, 0x4A, 0x03, 0x4A, 0x03, 
-    0xD9, 0x02, 0xE5, 0x02, 0x8D, 0x02, 0x28, 0x02, 0xF6, 0x01, 0x91, 0x01, 0x6C, 0x01, 0x2D, 0x01, 
-    0xAF, 0x00, 0xAF, 0x00, 0x18, 0x00, 0xF3, 0xFF, 0xDA, 0xFF, 0x75, 0xFF, 0x1D, 0xFF, 0x79, 0xFE, 
-    0xFB, 0xFD, 0xB0, 0xFD, 0x58, 0xFD, 0x32, 0xFD, 0x00, 0xFD, 0xCD, 0xFC, 0x0C, 0xFD, 0xC1, 0xFC, 
-    0xB4, 0xFC, 0x68, 0xFC, 0x1D, 0xFC, 0x10, 0xFC, 0x10, 0xFC, 0x2A, 0xFC, 0x2A, 0xFC, 0x36, 0xFC, 
-    0x43, 0xFC, 0x68, 0xFC, 0x82, 0xFC, 0x82, 0xFC, 0x68, 0xFC, 0x5C, 0xFC, 0x43, 0xFC, 0x43, 0xFC, 
-    0x5C, 0xFC, 0x4F, 0xFC, 0x68, 0xFC, 0x75, 0xFC, 0x9B, 0xFC, 0xCD, 0xFC, 0x9B, 0xFC, 0xB4, 0xFC, 
-    0x8E, 0xFC, 0x8E, 0xFC, 0xB4, 0xFC, 0xC1, 0xFC, 0xF3, 0xFC, 0x0C, 0xFD, 0x19, 0xFD, 0x3F, 0xFD, 
-    0x58, 0xFD, 0x64, 0xFD, 0x71, 0xFD, 0x4B, 0xFD, 0x8A, 0xFD, 0x97, 0xFD, 0xD6, 0xFD, 0xE2, 0xFD, 
-    0xFB, 0xFD, 0xEF, 0xFD, 0xFB, 0xFD, 0x15, 0xFE, 0x21, 0xFE, 0x21, 0xFE, 0x2E, 0xFE, 0x2E, 0xFE, 
-    0x21, 0xFE, 0x15, 0xFE, 0x08, 0xFE, 0xFB, 0xFD, 0xE2, 0xFD, 0x08, 0xFE, 0x2E, 0xFE, 0x53, 0xFE, 
-    0x60, 0xFE, 0x47, 0xFE, 0x21, 0xFE, 0x21, 0xFE, 0x3A, 0xFE, 0x6D, 0xFE, 0xB8, 0xFE, 0x04, 0xFF, 
-    0x43, 0xFF, 0x68, 0xFF, 0x5C, 0xFF, 0x29, 0xFF, 0x29, 0xFF, 0x4F, 0xFF, 0xA7, 0xFF, 0xF3, 0xFF, 
-    0xF3, 0xFF, 0x3D, 0x00, 0x89, 0x00, 0xD5, 0x00, 0xD5, 0x00, 0xFA, 0x00, 0x39, 0x01, 0xB7, 0x01, 
-    0x35, 0x02, 0x8D, 0x02, 0x8D, 0x02, 0x8D, 0x02, 0x74, 0x02, 0x81, 0x02, 0xB3, 0x02, 0xFE, 0x02, 
-    0x57, 0x03, 0x4A, 0x03, 0x63, 0x03, 0x4A, 0x03, 0xE5, 0x02, 0xFE, 0x02, 0x18, 0x03, 0x7C, 0x03, 
-    0xC8, 0x03, 0xD4, 0x03, 0xC8, 0x03, 0x89, 0x03, 0x7C, 0x03, 0xA2, 0x03, 0x89, 0x03, 0xAF, 0x03, 
-    0xD4, 0x03, 0xBB, 0x03, 0xBB, 0x03, 0x7C, 0x03, 0x7C, 0x03, 0x7C, 0x03, 0xAF, 0x03, 0xEE, 0x03, 
-    0xE1, 0x03, 0xE1, 0x03, 0xC8, 0x03, 0xD4, 0x03, 0xEE, 0x03, 0x46, 0x04, 0x46, 0x04, 0x46, 0x04, 
-    0x07, 0x04, 0xEE, 0x03, 0x63, 0x03, 0x57, 0x03, 0x63, 0x03, 0x63, 0x03, 0x96, 0x03, 0x63, 0x03, 
-    0x3D, 0x03, 0xBF, 0x02, 0x81, 0x02, 0x4E, 0x02, 0x35, 0x02, 0x0F, 0x02, 0x0F, 0x02, 0xAB, 0x01, 
-    0x91, 0x01, 0x5F, 0x01, 0x20, 0x01, 0xC8, 0x00, 0x63, 0x00, 0x57, 0x00, 0x18, 0x00, 0x0B, 0x00, 
-    0xE6, 0xFF, 0x9B, 0xFF, 0x4F, 0xFF, 0x36, 0xFF, 0x04, 0xFF, 0xD1, 0xFE, 0x79, 0xFE, 0x15, 0xFE, 
-    0xB0, 0xFD, 0x64, 0xFD, 0x4B, 0xFD, 0x0C, 0xFD, 0xF3, 0xFC, 0xDA, 0xFC, 0xB4, 0xFC, 0xB4, 0xFC, 
-    0x8E, 0xFC, 0x68, 0xFC, 0x43, 0xFC, 0x10, 0xFC, 0x2A, 0xFC, 0x04, 0xFC, 0x10, 0xFC, 0x10, 0xFC, 
-    0x04, 0xFC, 0x04, 0xFC, 0x1D, 0xFC, 0x2A, 0xFC, 0x2A, 0xFC, 0x1D, 0xFC, 0x10, 0xFC, 0x1D, 0xFC, 
-    0x2A, 0xFC, 0x2A, 0xFC, 0x43, 0xFC, 0x5C, 0xFC, 0x9B, 0xFC, 0xA7, 0xFC, 0x9B, 0xFC, 0x9B, 0xFC, 
-    0x82, 0xFC, 0xA7, 0xFC, 0xA7, 0xFC, 0xDA, 0xFC, 0xCD, 0xFC, 0xF3, 0xFC, 0x25, 0xFD, 0x4B, 0xFD, 
-    0x8A, 0xFD, 0xB0, 0xFD, 0xC9, 0xFD, 0xE2, 0xFD, 0xFB, 0xFD, 0x15, 0xFE, 0x21, 0xFE, 0x3A, 0xFE, 
-    0x6D, 0xFE, 0x6D, 0xFE, 0x86, 0xFE, 0x79, 0xFE, 0x47, 0xFE, 0x2E, 0xFE, 0x2E, 0xFE, 0x47, 0xFE, 
-    0x6D, 0xFE, 0x6D, 0xFE, 0x53, 0xFE, 0x3A, 0xFE, 0x53, 0xFE, 0x79, 0xFE, 0xAC, 0xFE, 0xC5, 0xFE, 
-    0xDE, 0xFE, 0x04, 0xFF, 0x10, 0xFF, 0x1D, 0xFF, 0x29, 0xFF, 0x1D, 0xFF, 0x5C, 0xFF, 0x8E, 0xFF, 
-    0xC1, 0xFF, 0xE6, 0xFF, 0xCD, 0xFF, 0x0B, 0x00, 0x4A, 0x00, 0xBB, 0x00, 0xEE, 0x00, 0x2D, 0x01, 
-    0x52, 0x01, 0x91, 0x01, 0xD0, 0x01, 0x03, 0x02, 0xF6, 0x01, 0x03, 0x02, 0x0F, 0x02, 0x35, 0x02, 
-    0xA6, 0x02, 0xCC, 0x02, 0x24, 0x03, 0xFE, 0x02, 0x3D, 0x03, 0x31, 0x03, 0x63, 0x03, 0x57, 0x03, 
-    0x96, 0x03, 0xAF, 0x03, 0xE1, 0x03, 0x07, 0x04, 0xFA, 0x03, 0xFA, 0x03, 0xC8, 0x03, 0xE1, 0x03, 
-    0xE1, 0x03, 0xD4, 0x03, 0xE1, 0x03, 0xC8, 0x03, 0xA2, 0x03, 0xBB, 0x03, 0xAF, 0x03, 0xAF, 0x03, 
-    0xBB, 0x03, 0x7C, 0x03, 0xA2, 0x03, 0x57, 0x03, 0x70, 0x03, 0x3D, 0x03, 0x18, 0x03, 0x4A, 0x03, 
-    0x24, 0x03, 0x24, 0x03, 0x18, 0x03, 0xE5, 0x02, 0xD9, 0x02, 0xA6, 0x02, 0xB3, 0x02, 0x9A, 0x02, 
-    0x67, 0x02, 0x74, 0x02, 0x28, 0x02, 0x1C, 0x02, 0x03, 0x02, 0xB7, 0x01, 0xAB, 0x01, 0x9E, 0x01, 
-    0x78, 0x01, 0x78, 0x01, 0x20, 0x01, 0x07, 0x01, 0xC8, 0x00, 0xA2, 0x00, 0x96, 0x00, 0x57, 0x00, 
-    0x31, 0x00, 0x00, 0x00, 0xB4, 0xFF, 0xB4, 0xFF, 0x4F, 0xFF, 0x43, 0xFF, 0x29, 0xFF, 0xF7, 0xFE, 
-    0xD1, 0xFE, 0x9F, 0xFE, 0x6D, 0xFE, 0x60, 0xFE, 0x08, 0xFE, 0x21, 0xFE, 0xC9, 0xFD, 0xB0, 0xFD, 
-    0x7D, 0xFD, 0x3F, 0xFD, 0x32, 0xFD, 0x00, 0xFD, 0xDA, 0xFC, 0xB4, 0xFC, 0x75, 0xFC, 0x8E, 0xFC, 
-    0x75, 0xFC, 0x75, 0xFC, 0x43, 0xFC, 0x1D, 0xFC, 0x10, 0xFC, 0x10, 0xFC, 0x04, 0xFC, 0x1D, 0xFC, 
-    0x10, 0xFC, 0x1D, 0xFC, 0x2A, 0xFC, 0x2A, 0xFC, 0x4F, 0xFC, 0x43, 0xFC, 0x5C, 0xFC, 0x5C, 0xFC, 
-    0x82, 0xFC, 0x8E, 0xFC, 0xA7, 0xFC, 0xA7, 0xFC, 0xCD, 0xFC, 0xE6, 0xFC, 0x0C, 0xFD, 0x00, 0xFD, 
-    0x19, 0xFD, 0x3F, 0xFD, 0x71, 0xFD, 0xB0, 0xFD, 0xD6, 0xFD, 0xE2, 0xFD, 0xE2, 0xFD, 0xEF, 0xFD, 
-    0x15, 0xFE, 0x47, 0xFE, 0x79, 0xFE, 0x9F, 0xFE, 0xC5, 0xFE, 0xEB, 0xFE, 0xF7, 0xFE, 0xF7, 0xFE, 
-    0xF7, 0xFE, 0x04, 0xFF, 0x1D, 0xFF, 0x36, 0xFF, 0x4F, 0xFF, 0x4F, 0xFF, 0x68, 0xFF, 0x5C, 0xFF, 
-    0x75, 0xFF, 0x9B, 0xFF, 0x8E, 0xFF, 0xA7, 0xFF, 0xA7, 0xFF, 0xA7, 0xFF, 0xE6, 0xFF, 0x0B, 0x00, 
-    0x57, 0x00, 0x70, 0x00, 0x63, 0x00, 0xAF, 0x00, 0xC8, 0x00, 0x07, 0x01, 0x39, 0x01, 0x07, 0x01, 
-    0x46, 0x01, 0x85, 0x01, 0xDD, 0x01, 0x28, 0x02, 0x28, 0x02, 0x8D, 0x02, 0x74, 0x02, 0x81, 0x02, 
-    0xA6, 0x02, 0x9A, 0x02, 0xE5, 0x02, 0x31, 0x03, 0x4A, 0x03, 0x70, 0x03, 0x4A, 0x03, 0x63, 0x03, 
-    0x31, 0x03, 0x31, 0x03, 0x7C, 0x03, 0x89, 0x03, 0xA2, 0x03, 0xD4, 0x03, 0xAF, 0x03, 0xBB, 0x03, 
-    0xA2, 0x03, 0xBB, 0x03, 0xBB, 0x03, 0xC8, 0x03, 0xE1, 0x03, 0x96, 0x03, 0x57, 0x03, 0x24, 0x03, 
-    0xFE, 0x02, 0xE5, 0x02, 0xFE, 0x02, 0xF2, 0x02, 0xE5, 0x02, 0xCC, 0x02, 0xBF, 0x02, 0x81, 0x02, 
-    0x42, 0x02, 0x35, 0x02, 0xDD, 0x01, 0xE9, 0x01, 0xD0, 0x01, 0xAB, 0x01, 0x85, 0x01, 0x85, 0x01, 
-    0x78, 0x01, 0x52, 0x01, 0x20, 0x01, 0xFA, 0x00, 0xC8, 0x00, 0xA2, 0x00, 0xAF, 0x00, 0x89, 0x00, 
-    0x89, 0x00, 0x70, 0x00, 0x63, 0x00, 0x31, 0x00, 0x18, 0x00, 0xE6, 0xFF, 0xA7, 0xFF, 0x8E, 0xFF, 
-    0x75, 0xFF, 0x5C, 0xFF, 0x36, 0xFF, 0x29, 0xFF, 0xF7, 0xFE, 0xEB, 0xFE, 0xDE, 0xFE, 0xC5, 0xFE, 
-    0x9F, 0xFE, 0x92, 0xFE, 0x53, 0xFE, 0x53, 0xFE, 0x2E, 0xFE, 0x2E, 0xFE, 0x3A, 0xFE, 0x3A, 0xFE, 
-    0x53, 0xFE, 0x2E, 0xFE, 0x21, 0xFE, 0xFB, 0xFD, 0xEF, 0xFD, 0xE2, 0xFD, 0xE2, 0xFD, 0xE2, 0xFD, 
-    0xE2, 0xFD, 0xC9, 0xFD, 0xBC, 0xFD, 0xB0, 0xFD, 0x97, 0xFD, 0xA3, 0xFD, 0x8A, 0xFD, 0x97, 0xFD, 
-    0x97, 0xFD, 0x7D, 0xFD, 0x8A, 0xFD, 0x7E, 0xFD, 0x97, 0xFD, 0xA3, 0xFD, 0xBD, 0xFD, 0xD6, 0xFD, 
-    0xD6, 0xFD, 0xC9, 0xFD, 0xD6, 0xFD, 0xC9, 0xFD, 0xE2, 0xFD, 0xC9, 0xFD, 0xC9, 0xFD, 0xD6, 0xFD, 
-    0xE3, 0xFD, 0xFC, 0xFD, 0xFC, 0xFD, 0xFC, 0xFD, 0xEF, 0xFD, 0xE3, 0xFD, 0xE3, 0xFD, 0xFC, 0xFD, 
-    0x15, 0xFE, 0x22, 0xFE, 0x3B, 0xFE, 0x6D, 0xFE, 0x86, 0xFE, 0x93, 0xFE, 0xA0, 0xFE, 0xA0, 0xFE, 
-    0xA0, 0xFE, 0x93, 0xFE, 0x93, 0xFE, 0x86, 0xFE, 0xA0, 0xFE, 0xB9, 0xFE, 0xDF, 0xFE, 0x04, 0xFF, 
-    0x2A, 0xFF, 0x36, 0xFF, 0x2A, 0xFF, 0x1D, 0xFF, 0x2A, 0xFF, 0x43, 0xFF, 0x82, 0xFF, 0x9B, 0xFF, 
-    0xB4, 0xFF, 0xDA, 0xFF, 0xF3, 0xFF, 0x00, 0x00, 0x31, 0x00, 0x56, 0x00, 0x7C, 0x00, 0x89, 0x00, 
-    0x95, 0x00, 0xA2, 0x00, 0xD4, 0x00, 0x2C, 0x01, 0x6A, 0x01, 0x84, 0x01, 0x9D, 0x01, 0xA9, 0x01, 
-    0xB6, 0x01, 0xF4, 0x01, 0x1A, 0x02, 0x40, 0x02, 0x40, 0x02, 0x4C, 0x02, 0x65, 0x02, 0x72, 0x02, 
-    0x97, 0x02, 0xB0, 0x02, 0xE2, 0x02, 0x08, 0x03, 0xFB, 0x02, 0xE2, 0x02, 0xBD, 0x02, 0xBD, 0x02, 
-    0xA4, 0x02, 0xD6, 0x02, 0xEF, 0x02, 0xC9, 0x02, 0xD6, 0x02, 0xBC, 0x02, 0x97, 0x02, 0x97, 0x02, 
-    0x8A, 0x02, 0xA3, 0x02, 0xA3, 0x02, 0x97, 0x02, 0xA3, 0x02, 0x3F, 0x02, 0x26, 0x02, 0x0D, 0x02, 
-    0xC1, 0x01, 0xC1, 0x01, 0xB5, 0x01, 0x51, 0x01, 0x1F, 0x01, 0xEC, 0x00, 0xE0, 0x00, 0xC7, 0x00, 
-    0xBA, 0x00, 0xD3, 0x00, 0x95, 0x00, 0x95, 0x00, 0xAE, 0x00, 0x88, 0x00, 0x88, 0x00, 0x6F, 0x00, 
-    0x56, 0x00, 0x3D, 0x00, 0x31, 0x00, 0x24, 0x00, 0xDA, 0xFF, 0xC1, 0xFF, 0xE6, 0xFF, 0xC1, 0xFF, 
-    0xB4, 0xFF, 0x76, 0xFF, 0x1E, 0xFF, 0xE0, 0xFE, 0xEC, 0xFE, 0x05, 0xFF, 0x12, 0xFF, 0x12, 0xFF, 
-    0x2B, 0xFF, 0x1E, 0xFF, 0x12, 0xFF, 0x1E, 0xFF, 0xEC, 0xFE, 0xEC, 0xFE, 0xEC, 0xFE, 0x05, 0xFF, 
-    0xEC, 0xFE, 0x05, 0xFF, 0xF9, 0xFE, 0xD4, 0xFE, 0xC7, 0xFE, 0xD4, 0xFE, 0xBB, 0xFE, 0xD4, 0xFE, 
-    0xF9, 0xFE, 0x12, 0xFF, 0x1F, 0xFF, 0x1F, 0xFF, 0x06, 0xFF, 0x06, 0xFF, 0x12, 0xFF, 0x2B, 0xFF, 
-    0x1F, 0xFF, 0x12, 0xFF, 0x12, 0xFF, 0xED, 0xFE, 0xF9, 0xFE, 0x06, 0xFF, 0x06, 0xFF, 0xED, 0xFE, 
-    0xF9, 0xFE, 0xE0, 0xFE, 0xED, 0xFE, 0xF9, 0xFE, 0x06, 0xFF, 0x06, 0xFF, 0x12, 0xFF, 0x1F, 0xFF, 
-    0x12, 0xFF, 0xED, 0xFE, 0xE0, 0xFE, 0xC8, 0xFE, 0xE0, 0xFE, 0xED, 0xFE, 0x06, 0xFF, 0x06, 0xFF, 
-    0xED, 0xFE, 0xFA, 0xFE, 0xC8, 0xFE, 0xBB, 0xFE, 0xBB, 0xFE, 0xA2, 0xFE, 0xAF, 0xFE, 0xAF, 0xFE, 
-    0xBB, 0xFE, 0xAF, 0xFE, 0xA2, 0xFE, 0xAF, 0xFE, 0xA2, 0xFE, 0xA2, 0xFE, 0xAF, 0xFE, 0xC8, 0xFE, 
-    0xED, 0xFE, 0x13, 0xFF, 0x2C, 0xFF, 0x38, 0xFF, 0x2C, 0xFF, 0x2C, 0xFF, 0x1F, 0xFF, 0x38, 0xFF, 
-    0x51, 0xFF, 0x76, 0xFF, 0x6A, 0xFF, 0x5E, 0xFF, 0x45, 0xFF, 0x51, 0xFF, 0x6A, 0xFF, 0x8F, 0xFF, 
-    0xCE, 0xFF, 0xF3, 0xFF, 0x0B, 0x00, 0xE7, 0xFF, 0xE7, 0xFF, 0xF3, 0xFF, 0x30, 0x00, 0x87, 0x00, 
-    0xD2, 0x00, 0x1D, 0x01, 0x1D, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x4F, 0x01, 0x99, 0x01, 
-    0xCB, 0x01, 0xE4, 0x01, 0xCB, 0x01, 0x99, 0x01, 0x80, 0x01, 0x99, 0x01, 0xFD, 0x01, 0x54, 0x02, 
-    0x79, 0x02, 0x79, 0x02, 0x15, 0x02, 0xCB, 0x01, 0x99, 0x01, 0x99, 0x01, 0xBE, 0x01, 0x09, 0x02, 
-    0x47, 0x02, 0x60, 0x02, 0x53, 0x02, 0x22, 0x02, 0xF0, 0x01, 0x99, 0x01, 0x99, 0x01, 0xD7, 0x01, 
-    0xD7, 0x01, 0xFC, 0x01, 0xD7, 0x01, 0xBE, 0x01, 0x8C, 0x01, 0x80, 0x01, 0x80, 0x01, 0x67, 0x01, 
-    0x42, 0x01, 0x29, 0x01, 0xD2, 0x00, 0xEA, 0x00, 0xDE, 0x00, 0xDE, 0x00, 0x03, 0x01, 0x03, 0x01, 
-    0x1C, 0x01, 0xD1, 0x00, 0x7B, 0x00, 0x49, 0x00, 0x17, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x30, 0x00, 
-    0x30, 0x00, 0xF3, 0xFF, 0xE7, 0xFF, 0xB5, 0xFF, 0x90, 0xFF, 0x90, 0xFF, 0x84, 0xFF, 0xA9, 0xFF, 
-    0xA9, 0xFF, 0x6B, 0xFF, 0x5F, 0xFF, 0x46, 0xFF, 0x6B, 0xFF, 0x6B, 0xFF, 0x77, 0xFF, 0x5F, 0xFF, 
-    0x2D, 0xFF, 0x08, 0xFF, 0xE3, 0xFE, 0xBE, 0xFE, 0xB2, 0xFE, 0xBE, 0xFE, 0xE3, 0xFE, 0xFC, 0xFE, 
-    0x15, 0xFF, 0x08, 0xFF, 0xD7, 0xFE, 0xBE, 0xFE, 0xB2, 0xFE, 0xCB, 0xFE, 0xF0, 0xFE, 0x3A, 0xFF, 
-    0x53, 0xFF, 0x6B, 0xFF, 0x78, 0xFF, 0x78, 0xFF, 0x5F, 0xFF, 0x46, 0xFF, 0x53, 0xFF, 0x46, 0xFF, 
-    0x5F, 0xFF, 0x5F, 0xFF, 0x78, 0xFF, 0x6B, 0xFF, 0x91, 0xFF, 0x91, 0xFF, 0xA9, 0xFF, 0xB6, 0xFF, 
-    0xA9, 0xFF, 0xA9, 0xFF, 0x9D, 0xFF, 0xC2, 0xFF, 0xC2, 0xFF, 0xC2, 0xFF, 0xB6, 0xFF, 0xCE, 0xFF, 
-    0xC2, 0xFF, 0xC2, 0xFF, 0x9D, 0xFF, 0x9D, 0xFF, 0x91, 0xFF, 0x91, 0xFF, 0x84, 0xFF, 0x78, 0xFF, 
-    0x91, 0xFF, 0x78, 0xFF, 0x9D, 0xFF, 0x91, 0xFF, 0x78, 0xFF, 0x91, 0xFF, 0x78, 0xFF, 0x6C, 0xFF, 
-    0x47, 0xFF, 0x3B, 0xFF, 0x53, 0xFF, 0x47, 0xFF, 0x60, 0xFF, 0x54, 0xFF, 0x47, 0xFF, 0x54, 0xFF, 
-    0x3B, 0xFF, 0x47, 0xFF, 0x60, 0xFF, 0x60, 0xFF, 0x79, 0xFF, 0x60, 0xFF, 0x60, 0xFF, 0x60, 0xFF, 
-    0x54, 0xFF, 0x6C, 0xFF, 0x6C, 0xFF, 0x85, 0xFF, 0xAA, 0xFF, 0xB6, 0xFF, 0x9D, 0xFF, 0x85, 0xFF, 
-    0x6C, 0xFF, 0x85, 0xFF, 0xCF, 0xFF, 0x0B, 0x00, 0x2F, 0x00, 0x3C, 0x00, 0x2F, 0x00, 0x23, 0x00, 
-    0x17, 0x00, 0x23, 0x00, 0x2F, 0x00, 0x54, 0x00, 0x6D, 0x00, 0x91, 0x00, 0xB6, 0x00, 0x9D, 0x00, 
-    0xC2, 0x00, 0xAA, 0x00, 0xCE, 0x00, 0xCE, 0x00, 0xAA, 0x00, 0x9D, 0x00, 0x91, 0x00, 0xB6, 0x00, 
-    0xC2, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x17, 0x01, 0x0B, 0x01, 0xF3, 0x00, 0xA9, 0x00, 0x9D, 0x00, 
-    0x85, 0x00, 0x9D, 0x00, 0xDA, 0x00, 0x17, 0x01, 0x48, 0x01, 0x3C, 0x01, 0x23, 0x01, 0x17, 0x01, 
-    0xF2, 0x00, 0x17, 0x01, 0x0B, 0x01, 0x3B, 0x01, 0x48, 0x01, 0x91, 0x01, 0x60, 0x01, 0x78, 0x01, 
-    0x0A, 0x01, 0x0A, 0x01, 0xDA, 0x00, 0xCD, 0x00, 0xF2, 0x00, 0xFE, 0x00, 0xF2, 0x00, 0xC1, 0x00, 
-    0xA9, 0x00, 0x9D, 0x00, 0x9D, 0x00, 0xA9, 0x00, 0xC1, 0x00, 0xE6, 0x00, 0xD9, 0x00, 0x84, 0x00, 
-    0x47, 0x00, 0xF3, 0xFF, 0xE7, 0xFF, 0xF3, 0xFF, 0x17, 0x00, 0x17, 0x00, 0x00, 0x00, 0xC3, 0xFF, 
-    0xAB, 0xFF, 0x7A, 0xFF, 0x7A, 0xFF, 0x62, 0xFF, 0x6E, 0xFF, 0x62, 0xFF, 0x56, 0xFF, 0x31, 0xFF, 
-    0x25, 0xFF, 0x01, 0xFF, 0x0D, 0xFF, 0x19, 0xFF, 0x0D, 0xFF, 0x0D, 0xFF, 0xDD, 0xFE, 0xC4, 0xFE, 
-    0xAC, 0xFE, 0xB8, 0xFE, 0xC5, 0xFE, 0xD1, 0xFE, 0xDD, 0xFE, 0xF5, 0xFE, 0xE9, 0xFE, 0xD1, 0xFE, 
-    0xC5, 0xFE, 0xA0, 0xFE, 0xAD, 0xFE, 0xA1, 0xFE, 0xF5, 0xFE, 0x01, 0xFF, 0x3E, 0xFF, 0x56, 0xFF, 
-    0x4A, 0xFF, 0x62, 0xFF, 0x32, 0xFF, 0x3E, 0xFF, 0x32, 0xFF, 0x3E, 0xFF, 0x62, 0xFF, 0x7B, 0xFF, 
-    0xAB, 0xFF, 0xB7, 0xFF, 0xC3, 0xFF, 0xC3, 0xFF, 0xC3, 0xFF, 0xB7, 0xFF, 0xCF, 0xFF, 0xB7, 0xFF, 
-    0xE7, 0xFF, 0x17, 0x00, 0x2F, 0x00, 0x5F, 0x00, 0x3B, 0x00, 0x5F, 0x00, 0x53, 0x00, 0x77, 0x00, 
-    0x9B, 0x00, 0x8F, 0x00, 0xA7, 0x00, 0x9B, 0x00, 0x9B, 0x00, 0x8F, 0x00, 0x77, 0x00, 0x83, 0x00, 
-    0x8F, 0x00, 0x8F, 0x00, 0x83, 0x00, 0x53, 0x00, 0x53, 0x00, 0x3B, 0x00, 0x23, 0x00, 0x23, 0x00, 
-    0x17, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x17, 0x00, 0x0B, 0x00, 
-    0x00, 0x00, 0x0B, 0x00, 0xE7, 0xFF, 0xF3, 0xFF, 0xE8, 0xFF, 0x00, 0x00, 0x3A, 0x00, 0x46, 0x00, 
-    0x5E, 0x00, 0x3A, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0xE8, 0xFF, 0x0A, 0x00, 0x22, 0x00, 0x3A, 0x00, 
-    0x46, 0x00, 0x52, 0x00, 0x52, 0x00, 0x3A, 0x00, 0x2E, 0x00, 0x3A, 0x00, 0x52, 0x00, 0x5E, 0x00, 
-    0x82, 0x00, 0x8E, 0x00, 0x82, 0x00, 0x76, 0x00, 0x6A, 0x00, 0x5E, 0x00, 0x52, 0x00, 0x46, 0x00, 
-    0x2E, 0x00, 0x3A, 0x00, 0x2E, 0x00, 0x3A, 0x00, 0x46, 0x00, 0x2E, 0x00, 0x2E, 0x00, 0x16, 0x00, 
-    0x0A, 0x00, 0x00, 0x00, 0xE8, 0xFF, 0xE8, 0xFF, 0xDC, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 
-    0x00, 0x00, 0xE8, 0xFF, 0xD0, 0xFF, 0xD0, 0xFF, 0xD0, 0xFF, 0xDC, 0xFF, 0xC4, 0xFF, 0xD0, 0xFF, 
-    0xE8, 0xFF, 0xF4, 0xFF, 0x16, 0x00, 0x16, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0xDC, 0xFF, 0xDC, 0xFF, 
-    0xB9, 0xFF, 0xB9, 0xFF, 0xC4, 0xFF, 0xC4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x16, 0x00, 0x16, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x16, 0x00, 
-    0x0A, 0x00, 0xF4, 0xFF, 0xE8, 0xFF, 0xE8, 0xFF, 0xDC, 0xFF, 0xF4, 0xFF, 0xDC, 0xFF, 0xD0, 0xFF, 
-    0xE8, 0xFF, 0xE8, 0xFF, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x16, 0x00, 0x39, 0x00, 0x22, 0x00, 0x22, 0x00, 0x16, 0x00, 
-    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xE8, 0xFF, 0xD1, 0xFF, 
-    0xDC, 0xFF, 0xE8, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xDC, 0xFF, 0xD1, 0xFF, 0xB9, 0xFF, 
-    0xAE, 0xFF, 0xD1, 0xFF, 0xE8, 0xFF, 0xDC, 0xFF, 0xD1, 0xFF, 0xBA, 0xFF, 0xBA, 0xFF, 0xA2, 0xFF, 
-    0xA2, 0xFF, 0x97, 0xFF, 0xBA, 0xFF, 0xBA, 0xFF, 0xBA, 0xFF, 0xAE, 0xFF, 0xD1, 0xFF, 0xA2, 0xFF, 
-    0xD1, 0xFF, 0x8B, 0xFF, 0xA2, 0xFF, 0x97, 0xFF, 0xC5, 0xFF, 0xE8, 0xFF, 0xE8, 0xFF, 0xF4, 0xFF, 
-    0xBA, 0xFF, 0x97, 0xFF, 0x8B, 0xFF, 0xAE, 0xFF, 0xBA, 0xFF, 0xDD, 0xFF, 0xE8, 0xFF, 0x00, 0x00, 
-    0xE8, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xDD, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 
-    0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x16, 0x00, 0x2D, 0x00, 0x44, 0x00, 
-    0x4F, 0x00, 0x44, 0x00, 0x38, 0x00, 0x38, 0x00, 0x4F, 0x00, 0x4F, 0x00, 0x44, 0x00, 0x5B, 0x00, 
-    0x4F, 0x00, 0x2D, 0x00, 0x2D, 0x00, 0x21, 0x00, 0x0A, 0x00, 0x21, 0x00, 0x2D, 0x00, 0x43, 0x00, 
-    0x71, 0x00, 0x7D, 0x00, 0x88, 0x00, 0x88, 0x00, 0x71, 0x00, 0x43, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0x0A, 0x00, 0x21, 0x00, 0x38, 0x00, 0x43, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x0A, 0x00, 0xE9, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x0A, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0xDD, 0xFF, 0xE9, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 
-    0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xDD, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x21, 0x00, 
-    0x00, 0x00, 0xE9, 0xFF, 0xDD, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0x15, 0x00, 0x00, 0x00, 0x2C, 0x00, 
-    0x37, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0x15, 0x00, 0x21, 0x00, 0x4E, 0x00, 0x4E, 0x00, 
-    0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x15, 0x00, 0x2C, 0x00, 0x42, 0x00, 0x37, 0x00, 0x20, 0x00, 
-    0x00, 0x00, 0xE9, 0xFF, 0xD2, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x2C, 0x00, 
-    0x0A, 0x00, 0x15, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x00, 0x00, 0xE9, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xDE, 0xFF, 0xF4, 0xFF, 0xDE, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 
-    0xDE, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xE9, 0xFF, 
-    0xDE, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0x15, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xDE, 0xFF, 
-    0xD2, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xD2, 0xFF, 
-    0xBC, 0xFF, 0xA5, 0xFF, 0xB0, 0xFF, 0xA5, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x15, 0x00, 
-    0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 0xD2, 0xFF, 0xBB, 0xFF, 
-    0x99, 0xFF, 0xA5, 0xFF, 0xB0, 0xFF, 0xB0, 0xFF, 0xC7, 0xFF, 0xBB, 0xFF, 0xB0, 0xFF, 0xA5, 0xFF, 
-    0x83, 0xFF, 0x8E, 0xFF, 0x83, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xC7, 0xFF, 
-    0xD2, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xF4, 0xFF, 0xD2, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0x00, 0x00, 
-    0x0A, 0x00, 0x00, 0x00, 0x21, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x21, 0x00, 
-    0x15, 0x00, 0x37, 0x00, 0x21, 0x00, 0x37, 0x00, 0x59, 0x00, 0x2C, 0x00, 0x43, 0x00, 0x37, 0x00, 
-    0x2C, 0x00, 0x2C, 0x00, 0x65, 0x00, 0x65, 0x00, 0x65, 0x00, 0x65, 0x00, 0x7B, 0x00, 0x65, 0x00, 
-    0x92, 0x00, 0x70, 0x00, 0x70, 0x00, 0x65, 0x00, 0x59, 0x00, 0x59, 0x00, 0x65, 0x00, 0x70, 0x00, 
-    0x59, 0x00, 0x65, 0x00, 0x59, 0x00, 0x43, 0x00, 0x43, 0x00, 0x43, 0x00, 0x37, 0x00, 0x2C, 0x00, 
-    0x4E, 0x00, 0x4E, 0x00, 0x59, 0x00, 0x70, 0x00, 0x59, 0x00, 0x4E, 0x00, 0x65, 0x00, 0x43, 0x00, 
-    0x37, 0x00, 0x2C, 0x00, 0x21, 0x00, 0xF4, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0x15, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xF4, 0xFF, 0xBB, 0xFF, 
-    0xDD, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xE9, 0xFF, 0x00, 0x00, 0xD2, 0xFF, 0x0A, 0x00, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xE9, 0xFF, 0x21, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x00, 0x00, 0xF4, 0xFF, 0xBB, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0x0A, 0x00, 0x15, 0x00, 
-    0x2C, 0x00, 0x21, 0x00, 0x0A, 0x00, 0xE9, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0x15, 0x00, 0x21, 0x00, 0x21, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xE9, 0xFF, 0xDD, 0xFF, 0x00, 0x00, 
-    0xD2, 0xFF, 0x0A, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 
-    0xDD, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 0x15, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0xE9, 0xFF, 0xD2, 0xFF, 
-    0xD2, 0xFF, 0xB0, 0xFF, 0x00, 0x00, 0xDD, 0xFF, 0x0A, 0x00, 0xE9, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 
-    0xDD, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xB0, 0xFF, 0xBB, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 
-    0xD2, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 0xE9, 0xFF, 0xDD, 0xFF, 0x00, 0x00, 
-    0xE9, 0xFF, 0x00, 0x00, 0xE9, 0xFF, 0xF4, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 
-    0xDD, 0xFF, 0xF4, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x2C, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 0x0A, 0x00, 
-    0x15, 0x00, 0x21, 0x00, 0x0A, 0x00, 0x21, 0x00, 0xF4, 0xFF, 0x0A, 0x00, 0xDD, 0xFF, 0xF4, 0xFF, 
-    0xDD, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0xF4, 0xFF, 
-    0x21, 0x00, 0x00, 0x00, 0x21, 0x00, 0x15, 0x00, 0x21, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x2C, 0x00, 0x21, 0x00, 0x00, 0x00, 0x0A, 0x00, 0xD2, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 
-    0xC7, 0xFF, 0xD2, 0xFF, 0xB0, 0xFF, 0xE9, 0xFF, 0xD2, 0xFF, 0x0A, 0x00, 0xDE, 0xFF, 0xD2, 0xFF, 
-    0xDE, 0xFF, 0x9A, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x15, 0x00, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xF4, 0xFF, 0x0A, 0x00, 0x20, 0x00, 
-    0x37, 0x00, 0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x20, 0x00, 0x37, 0x00, 0x15, 0x00, 0x42, 0x00, 0x0A, 0x00, 0x20, 0x00, 0x15, 0x00, 0x20, 0x00, 
-    0x0A, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x0A, 0x00, 0x20, 0x00, 
-    0xF4, 0xFF, 0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 
-    0x2C, 0x00, 0x2C, 0x00, 0x15, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 
-    0xF4, 0xFF, 0x15, 0x00, 0x0A, 0x00, 0x20, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xE9, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xBC, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 
-    0xC7, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xBC, 0xFF, 0xD2, 0xFF, 0xA5, 0xFF, 0xC7, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0x00, 0x00, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 
-    0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x20, 0x00, 0x37, 0x00, 0x37, 0x00, 0x20, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x15, 0x00, 0x20, 0x00, 
-    0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x15, 0x00, 0x37, 0x00, 0x20, 0x00, 0x42, 0x00, 
-    0x20, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x20, 0x00, 0x37, 0x00, 0x42, 0x00, 
-    0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 0x37, 0x00, 0x42, 0x00, 0x37, 0x00, 0x20, 0x00, 0x15, 0x00, 
-    0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xFF, 
-    0xF4, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xBC, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 
-    0xD3, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xC7, 0xFF, 
-    0xDE, 0xFF, 0xD3, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0x0A, 0x00, 
-    0x0A, 0x00, 0x2B, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x20, 0x00, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x00, 
-    0x20, 0x00, 0x0A, 0x00, 0x2B, 0x00, 0x37, 0x00, 0x20, 0x00, 0x15, 0x00, 0x00, 0x00, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0x15, 0x00, 0x0A, 0x00, 0x20, 0x00, 0x20, 0x00, 0x0A, 0x00, 
-    0xF4, 0xFF, 0x00, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 
-    0x37, 0x00, 0x20, 0x00, 0x0A, 0x00, 0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 
-    0xDE, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 
-    0xE9, 0xFF, 0xDE, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x00, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0xF4, 0xFF, 0x00, 0x00, 
-    0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xFF, 0xF4, 0xFF, 0x0A, 0x00, 
-    0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xE9, 0xFF, 0x0A, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0xE9, 0xFF, 
-    0x00, 0x00, 0x15, 0x00, 0x20, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x42, 0x00, 0x37, 0x00, 
-    0x42, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xE9, 0xFF, 0xDE, 0xFF, 
-    0xDE, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 0x2C, 0x00, 0x37, 0x00, 
-    0x42, 0x00, 0x4D, 0x00, 0x42, 0x00, 0x4D, 0x00, 0x4D, 0x00, 0x59, 0x00, 0x4D, 0x00, 0x64, 0x00, 
-    0x4D, 0x00, 0x59, 0x00, 0x59, 0x00, 0x6F, 0x00, 0x64, 0x00, 0x6F, 0x00, 0x4E, 0x00, 0x59, 0x00, 
-    0x4E, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x20, 0x00, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xDE, 0xFF, 0xDE, 0xFF, 0xC7, 0xFF, 
-    0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xBC, 0xFF, 
-    0xA5, 0xFF, 0x9A, 0xFF, 0xA5, 0xFF, 0xA5, 0xFF, 0x8E, 0xFF, 0xA5, 0xFF, 0x8E, 0xFF, 0x8E, 0xFF, 
-    0xA5, 0xFF, 0x9A, 0xFF, 0x9A, 0xFF, 0x9A, 0xFF, 0x8E, 0xFF, 0xBC, 0xFF, 0xB0, 0xFF, 0xB0, 0xFF, 
-    0xC7, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 
-    0xC7, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0x15, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x20, 0x00, 
-    0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x20, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 
-    0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 
-    0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xDE, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 
-    0xC7, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 0xD2, 0xFF, 
-    0xBB, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xDD, 0xFF, 
-    0xD2, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 
-    0xD2, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0x15, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xDD, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x21, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x15, 0x00, 
-    0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x15, 0x00, 
-    0x2C, 0x00, 0x37, 0x00, 0x21, 0x00, 0x21, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x2C, 0x00, 
-    0x21, 0x00, 0x21, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x21, 0x00, 
-    0x2C, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x21, 0x00, 0x37, 0x00, 
-    0x2C, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x21, 0x00, 0x21, 0x00, 0x37, 0x00, 0x37, 0x00, 
-    0x2C, 0x00, 0x2C, 0x00, 0x21, 0x00, 0x15, 0x00, 0x21, 0x00, 0x21, 0x00, 0x37, 0x00, 0x37, 0x00, 
-    0x21, 0x00, 0x21, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x00, 0x00, 0x15, 0x00, 
-    0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0xE9, 0xFF, 0xE9, 0xFF, 0xD2, 0xFF, 
-    0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xBB, 0xFF, 0xB0, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 
-    0xC6, 0xFF, 0xA4, 0xFF, 0x99, 0xFF, 0x99, 0xFF, 0xBB, 0xFF, 0xC6, 0xFF, 0xBB, 0xFF, 0xB0, 0xFF, 
-    0x99, 0xFF, 0xB0, 0xFF, 0xB0, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xE9, 0xFF, 0xD2, 0xFF, 0xE9, 0xFF, 
-    0xDD, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x21, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0A, 0x00, 
-    0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x21, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xFF, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x0A, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xE9, 0xFF, 
-    0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xE9, 0xFF, 0xC6, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x15, 0x00, 0x2C, 0x00, 0x38, 0x00, 0x43, 0x00, 0x38, 0x00, 0x21, 0x00, 0x21, 0x00, 
-    0x21, 0x00, 0x2C, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x15, 0x00, 0x21, 0x00, 0x15, 0x00, 
-    0x2C, 0x00, 0x2C, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x21, 0x00, 
-    0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x21, 0x00, 0x38, 0x00, 0x2C, 0x00, 
-    0x38, 0x00, 0x43, 0x00, 0x38, 0x00, 0x43, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xFF, 
-    0xE8, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xDD, 0xFF, 0xE8, 0xFF, 0xE8, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 
-    0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x16, 0x00, 0x21, 0x00, 0x21, 0x00, 0x16, 0x00, 
-    0x16, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 
-    0xBA, 0xFF, 0xD1, 0xFF, 0xBA, 0xFF, 0xBA, 0xFF, 0xAF, 0xFF, 0xAF, 0xFF, 0xA3, 0xFF, 0xAF, 0xFF, 
-    0xA3, 0xFF, 0xBA, 0xFF, 0xBA, 0xFF, 0xA3, 0xFF, 0x8C, 0xFF, 0x81, 0xFF, 0x75, 0xFF, 0x75, 0xFF, 
-    0x98, 0xFF, 0x98, 0xFF, 0xA3, 0xFF, 0x98, 0xFF, 0xA3, 0xFF, 0xA3, 0xFF, 0x8C, 0xFF, 0x98, 0xFF, 
-    0x98, 0xFF, 0xA3, 0xFF, 0xA3, 0xFF, 0xBA, 0xFF, 0xC6, 0xFF, 0xD1, 0xFF, 0xE8, 0xFF, 0xE8, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x16, 0x00, 0x21, 0x00, 0x38, 0x00, 0x38, 0x00, 
-    0x44, 0x00, 0x4F, 0x00, 0x5B, 0x00, 0x4F, 0x00, 0x5B, 0x00, 0x5B, 0x00, 0x66, 0x00, 0x89, 0x00, 
-    0x94, 0x00, 0xAB, 0x00, 0xA0, 0x00, 0xAB, 0x00, 0x89, 0x00, 0x7D, 0x00, 0x94, 0x00, 0xA0, 0x00, 
-    0xA0, 0x00, 0xB7, 0x00, 0xB7, 0x00, 0xA0, 0x00, 0x89, 0x00, 0x72, 0x00, 0x72, 0x00, 0x66, 0x00, 
-    0x7D, 0x00, 0x72, 0x00, 0x7D, 0x00, 0x66, 0x00, 0x72, 0x00, 0x5B, 0x00, 0x4F, 0x00, 0x4F, 0x00, 
-    0x4F, 0x00, 0x44, 0x00, 0x44, 0x00, 0x2D, 0x00, 0x21, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xE9, 0xFF, 
-    0xDD, 0xFF, 0xF4, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xBB, 0xFF, 0xC6, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 
-    0xDD, 0xFF, 0xE9, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 
-    0xD2, 0xFF, 0xC6, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x0A, 0x00, 
-    0x21, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x38, 0x00, 0x21, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 
-    0x38, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x15, 0x00, 0x15, 0x00, 0x2C, 0x00, 
-    0x2C, 0x00, 0x38, 0x00, 0x21, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0xDD, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 
-    0xE9, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xD2, 0xFF, 
-    0xD2, 0xFF, 0xD2, 0xFF, 0xC6, 0xFF, 0xC6, 0xFF, 0xC6, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 
-    0x00, 0x00, 0xF4, 0xFF, 0x0A, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 
-    0xAF, 0xFF, 0xAF, 0xFF, 0xAF, 0xFF, 0xC6, 0xFF, 0xAF, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 
-    0xC6, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0x00, 0x00, 0x15, 0x00, 0x2C, 0x00, 0x38, 0x00, 0x2C, 0x00, 0x38, 0x00, 0x43, 0x00, 
-    0x4F, 0x00, 0x4F, 0x00, 0x4F, 0x00, 0x4F, 0x00, 0x5A, 0x00, 0x5A, 0x00, 0x5A, 0x00, 0x4F, 0x00, 
-    0x66, 0x00, 0x5A, 0x00, 0x71, 0x00, 0x66, 0x00, 0x71, 0x00, 0x66, 0x00, 0x66, 0x00, 0x66, 0x00, 
-    0x71, 0x00, 0x66, 0x00, 0x71, 0x00, 0x5A, 0x00, 0x4F, 0x00, 0x4F, 0x00, 0x43, 0x00, 0x2C, 0x00, 
-    0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 
-    0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 
-    0xDD, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xA4, 0xFF, 0x99, 0xFF, 0x8D, 0xFF, 
-    0x8D, 0xFF, 0x99, 0xFF, 0x82, 0xFF, 0x82, 0xFF, 0x76, 0xFF, 0x6B, 0xFF, 0x6B, 0xFF, 0x82, 0xFF, 
-    0x76, 0xFF, 0x82, 0xFF, 0x82, 0xFF, 0x8D, 0xFF, 0x8D, 0xFF, 0x99, 0xFF, 0x99, 0xFF, 0x99, 0xFF, 
-    0xA4, 0xFF, 0x99, 0xFF, 0x99, 0xFF, 0x99, 0xFF, 0x99, 0xFF, 0xAF, 0xFF, 0xBB, 0xFF, 0xC6, 0xFF, 
-    0xC6, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 0xAF, 0xFF, 0xBB, 0xFF, 0xC6, 0xFF, 0xBB, 0xFF, 0xD2, 0xFF, 
-    0xD2, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-    0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x2C, 0x00, 0x21, 0x00, 0x21, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x2C, 0x00, 
-    0x21, 0x00, 0x2C, 0x00, 0x38, 0x00, 0x2C, 0x00, 0x38, 0x00, 0x38, 0x00, 0x4E, 0x00, 0x65, 0x00, 
-    0x71, 0x00, 0x71, 0x00, 0x5A, 0x00, 0x5A, 0x00, 0x5A, 0x00, 0x65, 0x00, 0x4E, 0x00, 0x4E, 0x00, 
-    0x5A, 0x00, 0x65, 0x00, 0x71, 0x00, 0x71, 0x00, 0x7C, 0x00, 0x71, 0x00, 0x7C, 0x00, 0x7C, 0x00, 
-    0x87, 0x00, 0x87, 0x00, 0x87, 0x00, 0x7C, 0x00, 0x71, 0x00, 0x71, 0x00, 0x65, 0x00, 0x5A, 0x00, 
-    0x5A, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x5A, 0x00, 0x43, 0x00, 0x38, 0x00, 0x21, 0x00, 
-    0x21, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 
-    0xDD, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xE9, 0xFF, 0x00, 0x00, 
-    0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xD2, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xDD, 0xFF, 
-    0xDD, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 
-    0xC7, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 
-    0xDD, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 
-    0xC7, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 
-    0xD2, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x21, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x21, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x21, 0x00, 
-    0x21, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x21, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xE9, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 
-    0xD2, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xBB, 0xFF, 0xB0, 0xFF, 0xB0, 0xFF, 
-    0xB0, 0xFF, 0xB0, 0xFF, 0xB0, 0xFF, 0xB0, 0xFF, 0xBB, 0xFF, 0xC7, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 
-    0xDD, 0xFF, 0xD2, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 
-    0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x37, 0x00, 
-    0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x43, 0x00, 0x43, 0x00, 0x4E, 0x00, 0x43, 0x00, 
-    0x37, 0x00, 0x37, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x15, 0x00, 0x21, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xC7, 0xFF, 
-    0xD2, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 
-    0xC7, 0xFF, 0xBB, 0xFF, 0xB0, 0xFF, 0xB0, 0xFF, 0xC7, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 
-    0xBB, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x21, 0x00, 0x2C, 0x00, 
-    0x37, 0x00, 0x37, 0x00, 0x43, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x37, 0x00, 0x4E, 0x00, 0x4E, 0x00, 
-    0x4E, 0x00, 0x59, 0x00, 0x4E, 0x00, 0x59, 0x00, 0x43, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x4E, 0x00, 
-    0x43, 0x00, 0x37, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x43, 0x00, 0x37, 0x00, 0x21, 0x00, 
-    0x21, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x21, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x21, 0x00, 
-    0x21, 0x00, 0x2C, 0x00, 0x21, 0x00, 0x37, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x37, 0x00, 
-    0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x4E, 0x00, 0x43, 0x00, 0x37, 0x00, 
-    0x2C, 0x00, 0x21, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x15, 0x00, 
-    0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x21, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x21, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 
-    0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x21, 0x00, 0x15, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xFF, 0xDD, 0xFF, 
-    0xC7, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 0xC7, 0xFF, 0xBB, 0xFF, 0xB0, 0xFF, 0xC7, 0xFF, 0xBB, 0xFF, 
-    0xA4, 0xFF, 0x99, 0xFF, 0x99, 0xFF, 0x99, 0xFF, 0x99, 0xFF, 0x99, 0xFF, 0x99, 0xFF, 0x99, 0xFF, 
-    0x8E, 0xFF, 0x8E, 0xFF, 0x8E, 0xFF, 0x99, 0xFF, 0xA4, 0xFF, 0xA4, 0xFF, 0xA4, 0xFF, 0xA4, 0xFF, 
-    0xA4, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 
-    0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x0A, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 
-    0x2C, 0x00, 0x38, 0x00, 0x43, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x43, 0x00, 0x5A, 0x00, 0x65, 0x00, 
-    0x65, 0x00, 0x71, 0x00, 0x65, 0x00, 0x4E, 0x00, 0x43, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x5A, 0x00, 
-    0x4E, 0x00, 0x38, 0x00, 0x2C, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x21, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xC6, 0xFF, 
-    0xBB, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 0xAF, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 
-    0xAF, 0xFF, 0xAF, 0xFF, 0xAF, 0xFF, 0xAF, 0xFF, 0xBB, 0xFF, 0xC6, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 
-    0xBB, 0xFF, 0xC6, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 
-    0xDD, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x21, 0x00, 
-    0x21, 0x00, 0x38, 0x00, 0x38, 0x00, 0x4F, 0x00, 0x4F, 0x00, 0x5A, 0x00, 0x4F, 0x00, 0x5A, 0x00, 
-    0x5A, 0x00, 0x66, 0x00, 0x5A, 0x00, 0x5A, 0x00, 0x4F, 0x00, 0x38, 0x00, 0x38, 0x00, 0x2C, 0x00, 
-    0x38, 0x00, 0x38, 0x00, 0x2C, 0x00, 0x38, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 
-    0xC6, 0xFF, 0xC6, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 
-    0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 
-    0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x21, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x21, 0x00, 0x15, 0x00, 0x21, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xE9, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 
-    0xD1, 0xFF, 0xD1, 0xFF, 0xC6, 0xFF, 0xC6, 0xFF, 0xC6, 0xFF, 0xD1, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 
-    0xDD, 0xFF, 0xDD, 0xFF, 0xD1, 0xFF, 0xD1, 0xFF, 0xE8, 0xFF, 0xDD, 0xFF, 0xE8, 0xFF, 0xE8, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x16, 0x00, 0x16, 0x00, 
-    0x2D, 0x00, 0x38, 0x00, 0x44, 0x00, 0x44, 0x00, 0x44, 0x00, 0x44, 0x00, 0x4F, 0x00, 0x4F, 0x00, 
-    0x5B, 0x00, 0x66, 0x00, 0x66, 0x00, 0x7D, 0x00, 0x89, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0x94, 0x00, 
-    0x94, 0x00, 0xAB, 0x00, 0xB7, 0x00, 0xB7, 0x00, 0xB7, 0x00, 0xAB, 0x00, 0xA0, 0x00, 0x94, 0x00, 
-    0x94, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x71, 0x00, 0x71, 0x00, 0x66, 0x00, 0x5A, 0x00, 
-    0x43, 0x00, 0x38, 0x00, 0x2C, 0x00, 0x21, 0x00, 0x15, 0x00, 0x15, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xD2, 0xFF, 
-    0xDD, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xC6, 0xFF, 0xD2, 0xFF, 
-    0xC6, 0xFF, 0xBB, 0xFF, 0xAF, 0xFF, 0xBB, 0xFF, 0xAF, 0xFF, 0xBB, 0xFF, 0xC6, 0xFF, 0xC6, 0xFF, 
-    0xD2, 0xFF, 0xC6, 0xFF, 0xC6, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 
-    0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 
-    0xBB, 0xFF, 0xB0, 0xFF, 0xBB, 0xFF, 0xC6, 0xFF, 0xC6, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 
-    0xBB, 0xFF, 0xB0, 0xFF, 0xB0, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 0xB0, 0xFF, 0xB0, 0xFF, 0xA4, 0xFF, 
-    0xB0, 0xFF, 0xB0, 0xFF, 0xBB, 0xFF, 0xB0, 0xFF, 0xBB, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 
-    0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-    0x0A, 0x00, 0x15, 0x00, 0x21, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x21, 0x00, 
-    0x21, 0x00, 0x21, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 
-    0x2C, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x37, 0x00, 0x42, 0x00, 
-    0x37, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x42, 0x00, 0x2C, 0x00, 
-    0x2C, 0x00, 0x20, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 
-    0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 
-    0xC7, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 
-    0xDE, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 
-    0xD2, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x20, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x20, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0xDD, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0x00, 0x00, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x21, 0x00, 0x2C, 0x00, 0x21, 0x00, 0x38, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x21, 0x00, 0x21, 0x00, 
-    0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x38, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 
-    0x21, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x0A, 0x00, 
-    0x0A, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 
-    0xC6, 0xFF, 0xBB, 0xFF, 0xAF, 0xFF, 0xAF, 0xFF, 0xAF, 0xFF, 0xAF, 0xFF, 0xC6, 0xFF, 0xC6, 0xFF, 
-    0xC6, 0xFF, 0xC6, 0xFF, 0xC6, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 
-    0xD1, 0xFF, 0xDD, 0xFF, 0xD1, 0xFF, 0xD1, 0xFF, 0xC6, 0xFF, 0xBA, 0xFF, 0xC6, 0xFF, 0xBA, 0xFF, 
-    0xC6, 0xFF, 0xC6, 0xFF, 0xC6, 0xFF, 0xC6, 0xFF, 0xD1, 0xFF, 0xD1, 0xFF, 0xE8, 0xFF, 0xDD, 0xFF, 
-    0xDD, 0xFF, 0xD1, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xD1, 0xFF, 0xC6, 0xFF, 
-    0xD1, 0xFF, 0xAF, 0xFF, 0xDD, 0xFF, 0x8C, 0xFF, 0x2D, 0x00, 0x5E, 0xFF, 0x21, 0x00, 0x97, 0xFF, 
-    0x44, 0x00, 0xBA, 0xFF, 0xF4, 0xFF, 0xAF, 0xFF, 0xD1, 0xFF, 0xAF, 0xFF, 0xBA, 0xFF, 0x75, 0xFF, 
-    0xBA, 0xFF, 0x97, 0xFF, 0xA3, 0xFF, 0x8C, 0xFF, 0x97, 0xFF, 0xAE, 0xFF, 0xA3, 0xFF, 0xC6, 0xFF, 
-    0x74, 0xFF, 0xAE, 0xFF, 0x46, 0xFF, 0x52, 0xFF, 0x18, 0xFF, 0x2F, 0xFF, 0x23, 0xFF, 0x2F, 0xFF, 
-    0x23, 0xFF, 0x3A, 0xFF, 0x69, 0xFF, 0x97, 0xFF, 0xA3, 0xFF, 0xD1, 0xFF, 0xDD, 0xFF, 0xF4, 0xFF, 
-    0x0A, 0x00, 0x0A, 0x00, 0x39, 0x00, 0x39, 0x00, 0x50, 0x00, 0x39, 0x00, 0x5C, 0x00, 0x5C, 0x00, 
-    0x73, 0x00, 0x67, 0x00, 0x8A, 0x00, 0x7F, 0x00, 0x96, 0x00, 0x8A, 0x00, 0xA2, 0x00, 0xAD, 0x00, 
-    0xAD, 0x00, 0xD0, 0x00, 0xB9, 0x00, 0xC5, 0x00, 0xA2, 0x00, 0xA2, 0x00, 0x8A, 0x00, 0x96, 0x00, 
-    0x96, 0x00, 0x8B, 0x00, 0x96, 0x00, 0x8B, 0x00, 0x96, 0x00, 0x7F, 0x00, 0x8B, 0x00, 0x73, 0x00, 
-    0x7F, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x73, 0x00, 0x73, 0x00, 0x73, 0x00, 0x73, 0x00, 
-    0x68, 0x00, 0x50, 0x00, 0x45, 0x00, 0x2D, 0x00, 0x22, 0x00, 0x22, 0x00, 0x16, 0x00, 0x16, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x16, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x16, 0x00, 0x16, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x21, 0x00, 0x39, 0x00, 0x44, 0x00, 0x50, 0x00, 0x44, 0x00, 0x50, 0x00, 0x44, 0x00, 
-    0x50, 0x00, 0x50, 0x00, 0x73, 0x00, 0x67, 0x00, 0x67, 0x00, 0x73, 0x00, 0x73, 0x00, 0x7E, 0x00, 
-    0x73, 0x00, 0x96, 0x00, 0x8A, 0x00, 0x8A, 0x00, 0x8A, 0x00, 0x7E, 0x00, 0x7E, 0x00, 0x7E, 0x00, 
-    0x8A, 0x00, 0x7E, 0x00, 0x7E, 0x00, 0x73, 0x00, 0x73, 0x00, 0x73, 0x00, 0x67, 0x00, 0x50, 0x00, 
-    0x44, 0x00, 0x38, 0x00, 0x2D, 0x00, 0x2D, 0x00, 0x21, 0x00, 0x16, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xDD, 0xFF, 0xD1, 0xFF, 0xC6, 0xFF, 0xBA, 0xFF, 
-    0xC6, 0xFF, 0xBA, 0xFF, 0xBA, 0xFF, 0xAF, 0xFF, 0xAF, 0xFF, 0xAF, 0xFF, 0xC6, 0xFF, 0xBA, 0xFF, 
-    0xC6, 0xFF, 0xC6, 0xFF, 0xC6, 0xFF, 0xC6, 0xFF, 0xBA, 0xFF, 0xC6, 0xFF, 0xBA, 0xFF, 0xC6, 0xFF, 
-    0xBA, 0xFF, 0xBA, 0xFF, 0xBA, 0xFF, 0xC6, 0xFF, 0xBA, 0xFF, 0xD1, 0xFF, 0xC6, 0xFF, 0xD1, 0xFF, 
-    0xD1, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xE8, 0xFF, 0xD1, 0xFF, 0xD1, 0xFF, 0xC6, 0xFF, 
-    0xDD, 0xFF, 0xDD, 0xFF, 0xE8, 0xFF, 0xE8, 0xFF, 0xDD, 0xFF, 0xD1, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 
-    0xD2, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 0xC6, 0xFF, 0xC6, 0xFF, 0xBB, 0xFF, 0xC6, 0xFF, 
-    0xBB, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 0xC6, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xAF, 0xFF, 
-    0xAF, 0xFF, 0xAF, 0xFF, 0xBB, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 
-    0xE9, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 
-    0xE9, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 
-    0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x2C, 0x00, 0x2C, 0x00, 
-    0x20, 0x00, 0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 
-    0x20, 0x00, 0x2C, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xF4, 0xFF, 
-    0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x0A, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 
-    0xD3, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xF4, 0xFF, 
-    0x00, 0x00, 0x0A, 0x00, 0x20, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x20, 0x00, 
-    0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x00, 0x00, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xBC, 0xFF, 0xB1, 0xFF, 
-    0xA5, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 0xB1, 0xFF, 0xC7, 0xFF, 0xB1, 0xFF, 0xC7, 0xFF, 
-    0xBC, 0xFF, 0xB1, 0xFF, 0xB1, 0xFF, 0xB1, 0xFF, 0xB1, 0xFF, 0xA5, 0xFF, 0xA5, 0xFF, 0xA5, 0xFF, 
-    0xB1, 0xFF, 0xBC, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xF4, 0xFF, 
-    0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x20, 0x00, 0x0A, 0x00, 0x2C, 0x00, 0x15, 0x00, 0x20, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0xE9, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 
-    0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 
-    0xE9, 0xFF, 0xD2, 0xFF, 0xE9, 0xFF, 0xC7, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 
-    0xDE, 0xFF, 0xDE, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x2C, 0x00, 
-    0x20, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x42, 0x00, 0x37, 0x00, 0x42, 0x00, 0x37, 0x00, 0x2C, 0x00, 
-    0x59, 0x00, 0x59, 0x00, 0x64, 0x00, 0x4E, 0x00, 0x42, 0x00, 0x4E, 0x00, 0x59, 0x00, 0x59, 0x00, 
-    0x4E, 0x00, 0x37, 0x00, 0x4E, 0x00, 0x64, 0x00, 0x70, 0x00, 0x70, 0x00, 0x4E, 0x00, 0x4E, 0x00, 
-    0x59, 0x00, 0x59, 0x00, 0x64, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x59, 0x00, 0x59, 0x00, 0x64, 0x00, 
-    0x4E, 0x00, 0x64, 0x00, 0x59, 0x00, 0x59, 0x00, 0x59, 0x00, 0x4E, 0x00, 0x59, 0x00, 0x4E, 0x00, 
-    0x59, 0x00, 0x59, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x42, 0x00, 0x37, 0x00, 0x37, 0x00, 
-    0x2C, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x20, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0xF4, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 
-    0xDE, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xE9, 0xFF, 
-    0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xF4, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 
-    0xD2, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xC7, 0xFF, 0xBB, 0xFF, 0xD2, 0xFF, 
-    0xC7, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xBB, 0xFF, 0xD2, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 
-    0xBB, 0xFF, 0xC7, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xBB, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xDD, 0xFF, 
-    0xDD, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 
-    0xD2, 0xFF, 0xD2, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 
-    0xF4, 0xFF, 0xDD, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xDD, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 
-    0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 
-    0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xC7, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 
-    0x2C, 0x00, 0x2C, 0x00, 0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 0x37, 0x00, 0x42, 0x00, 0x37, 0x00, 
-    0x2C, 0x00, 0x20, 0x00, 0x42, 0x00, 0x4E, 0x00, 0x64, 0x00, 0x59, 0x00, 0x59, 0x00, 0x64, 0x00, 
-    0x64, 0x00, 0x70, 0x00, 0x64, 0x00, 0x64, 0x00, 0x64, 0x00, 0x64, 0x00, 0x70, 0x00, 0x64, 0x00, 
-    0x64, 0x00, 0x4E, 0x00, 0x64, 0x00, 0x59, 0x00, 0x64, 0x00, 0x59, 0x00, 0x4E, 0x00, 0x4E, 0x00, 
-    0x4E, 0x00, 0x59, 0x00, 0x37, 0x00, 0x42, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x20, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x20, 0x00, 0x00, 0x00, 0x15, 0x00, 
-    0xF4, 0xFF, 0x0A, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0x0A, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 
-    0xD2, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 
-    0xC7, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 
-    0xD2, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xF4, 0xFF, 
-    0xDE, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 
-    0xDE, 0xFF, 0x00, 0x00, 0xDE, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xDE, 0xFF, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xF4, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xE9, 0xFF, 
-    0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x00, 0x00, 0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x0A, 0x00, 
-    0xE9, 0xFF, 0xF4, 0xFF, 0xDE, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x15, 0x00, 0xF4, 0xFF, 0x00, 0x00, 
-    0x00, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0xDE, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0x0A, 0x00, 
-    0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 
-    0xF4, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x20, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0xF4, 0xFF, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x20, 0x00, 
-    0x20, 0x00, 0x37, 0x00, 0x20, 0x00, 0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0x15, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x20, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0xF4, 0xFF, 0x0A, 0x00, 0x15, 0x00, 0x20, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xF4, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 
-    0x00, 0x00, 0xDE, 0xFF, 0xF4, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xC7, 0xFF, 0xDE, 0xFF, 
-    0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 
-    0xDE, 0xFF, 0xD3, 0xFF, 0xC7, 0xFF, 0xDE, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x20, 0x00, 0x20, 0x00, 
-    0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x2B, 0x00, 0x20, 0x00, 0x37, 0x00, 0x20, 0x00, 0x2B, 0x00, 
-    0x2B, 0x00, 0x2B, 0x00, 0x0A, 0x00, 0x20, 0x00, 0x0A, 0x00, 0x20, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x20, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 
-    0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xD3, 0xFF, 
-    0xD3, 0xFF, 0xD3, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 
-    0xBC, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 
-    0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x20, 0x00, 
-    0x37, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x20, 0x00, 0x37, 0x00, 0x2B, 0x00, 0x37, 0x00, 
-    0x37, 0x00, 0x37, 0x00, 0x42, 0x00, 0x2B, 0x00, 0x20, 0x00, 0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xDE, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0x00, 0x00, 0xE9, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x2B, 0x00, 0x37, 0x00, 0x42, 0x00, 0x37, 0x00, 0x37, 0x00, 
-    0x42, 0x00, 0x4D, 0x00, 0x42, 0x00, 0x42, 0x00, 0x37, 0x00, 0x37, 0x00, 0x2B, 0x00, 0x37, 0x00, 
-    0x2B, 0x00, 0x2B, 0x00, 0x20, 0x00, 0x20, 0x00, 0x2B, 0x00, 0x37, 0x00, 0x37, 0x00, 0x2C, 0x00, 
-    0x37, 0x00, 0x42, 0x00, 0x4D, 0x00, 0x64, 0x00, 0x4D, 0x00, 0x42, 0x00, 0x20, 0x00, 0x37, 0x00, 
-    0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x2C, 0x00, 
-    0x37, 0x00, 0x15, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x15, 0x00, 0x20, 0x00, 
-    0x20, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 
-    0xC7, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 
-    0xBC, 0xFF, 0xA5, 0xFF, 0xBC, 0xFF, 0xB1, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 
-    0xD2, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 
-    0xD2, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 
-    0xD2, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xE9, 0xFF, 
-    0xD2, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 
-    0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xE9, 0xFF, 0xD2, 0xFF, 
-    0xDE, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 
-    0xDE, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 
-    0xDE, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x0A, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x42, 0x00, 
-    0x37, 0x00, 0x37, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 
-    0x37, 0x00, 0x43, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x43, 0x00, 0x4E, 0x00, 0x43, 0x00, 0x43, 0x00, 
-    0x43, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x59, 0x00, 0x59, 0x00, 0x43, 0x00, 0x43, 0x00, 0x4E, 0x00, 
-    0x59, 0x00, 0x59, 0x00, 0x59, 0x00, 0x65, 0x00, 0x65, 0x00, 0x59, 0x00, 0x65, 0x00, 0x65, 0x00, 
-    0x70, 0x00, 0x65, 0x00, 0x70, 0x00, 0x65, 0x00, 0x65, 0x00, 0x65, 0x00, 0x65, 0x00, 0x70, 0x00, 
-    0x70, 0x00, 0x59, 0x00, 0x59, 0x00, 0x43, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x43, 0x00, 0x2C, 0x00, 
-    0x21, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x2C, 0x00, 
-    0x2C, 0x00, 0x2C, 0x00, 0x21, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x00, 0x00, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x15, 0x00, 0x21, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0x00, 0x00, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 
-    0xBC, 0xFF, 0xBC, 0xFF, 0xB0, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xB0, 0xFF, 
-    0xBC, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 
-    0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0A, 0x00, 
-    0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xF4, 0xFF, 
-    0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x15, 0x00, 0x20, 0x00, 
-    0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 
-    0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 
-    0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 
-    0xE9, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 
-    0xBC, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xB1, 0xFF, 0xB1, 0xFF, 0xA5, 0xFF, 0xB1, 0xFF, 
-    0xB1, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 
-    0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 
-    0xF4, 0xFF, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x00, 0x00, 0xF4, 0xFF, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x37, 0x00, 
-    0x2B, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x20, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x15, 0x00, 0x20, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x37, 0x00, 0x37, 0x00, 0x42, 0x00, 
-    0x37, 0x00, 0x37, 0x00, 0x42, 0x00, 0x42, 0x00, 0x37, 0x00, 0x4D, 0x00, 0x37, 0x00, 0x4D, 0x00, 
-    0x4D, 0x00, 0x42, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x42, 0x00, 0x4D, 0x00, 0x4D, 0x00, 
-    0x4D, 0x00, 0x4D, 0x00, 0x4D, 0x00, 0x42, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 
-    0x42, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x2B, 0x00, 0x20, 0x00, 0x20, 0x00, 0x15, 0x00, 
-    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xE9, 0xFF, 
-    0xDE, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 
-    0xD3, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 
-    0xB1, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 
-    0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 
-    0xC7, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 
-    0xBC, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 0xC7, 0xFF, 0xDE, 0xFF, 
-    0xD3, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xF4, 0xFF, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x37, 0x00, 
-    0x2B, 0x00, 0x37, 0x00, 0x37, 0x00, 0x2B, 0x00, 0x37, 0x00, 0x2B, 0x00, 0x37, 0x00, 0x37, 0x00, 
-    0x42, 0x00, 0x37, 0x00, 0x2B, 0x00, 0x37, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x20, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xFF, 
-    0xDE, 0xFF, 0xD3, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xC7, 0xFF, 
-    0xD3, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 
-    0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 
-    0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0x0A, 0x00, 
-    0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xDE, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xE9, 0xFF, 
-    0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 
-    0xD2, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 
-    0x20, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x2C, 0x00, 
-    0x37, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 
-    0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 
-    0x37, 0x00, 0x37, 0x00, 0x42, 0x00, 0x42, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x20, 0x00, 
-    0x20, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 
-    0x37, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 
-    0x2C, 0x00, 0x37, 0x00, 0x37, 0x00, 0x42, 0x00, 0x42, 0x00, 0x4D, 0x00, 0x4D, 0x00, 0x4D, 0x00, 
-    0x42, 0x00, 0x42, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 
-    0x42, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x42, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x20, 0x00, 0x15, 0x00, 
-    0x20, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 
-    0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 
-    0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 
-    0xC7, 0xFF, 0xBC, 0xFF, 0xB0, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xB0, 0xFF, 0xBC, 0xFF, 
-    0xBC, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 
-    0xBC, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 
-    0xBC, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 0xB0, 0xFF, 
-    0xB0, 0xFF, 0xB0, 0xFF, 0xB0, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 
-    0xC7, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0xF4, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 
-    0x21, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x21, 0x00, 0x2C, 0x00, 
-    0x2C, 0x00, 0x37, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x21, 0x00, 0x21, 0x00, 0x15, 0x00, 
-    0x0A, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x21, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x21, 0x00, 
-    0x21, 0x00, 0x21, 0x00, 0x15, 0x00, 0x21, 0x00, 0x15, 0x00, 0x21, 0x00, 0x15, 0x00, 0x2C, 0x00, 
-    0x2C, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x43, 0x00, 0x37, 0x00, 
-    0x37, 0x00, 0x43, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x37, 0x00, 
-    0x43, 0x00, 0x43, 0x00, 0x2C, 0x00, 0x21, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x2C, 0x00, 
-    0x21, 0x00, 0x21, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x15, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 
-    0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xBB, 0xFF, 0xA5, 0xFF, 0xB0, 0xFF, 0xA5, 0xFF, 0x99, 0xFF, 
-    0xBB, 0xFF, 0xB0, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 0xB0, 0xFF, 0xBB, 0xFF, 0xB0, 0xFF, 
-    0xB0, 0xFF, 0xA5, 0xFF, 0xB0, 0xFF, 0x99, 0xFF, 0xA5, 0xFF, 0xA5, 0xFF, 0xB0, 0xFF, 0xBB, 0xFF, 
-    0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x21, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x43, 0x00, 0x43, 0x00, 0x43, 0x00, 
-    0x37, 0x00, 0x43, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x43, 0x00, 0x43, 0x00, 0x43, 0x00, 0x37, 0x00, 
-    0x43, 0x00, 0x43, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x59, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x43, 0x00, 
-    0x2C, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x43, 0x00, 
-    0x43, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x21, 0x00, 0x21, 0x00, 0x15, 0x00, 0x21, 0x00, 0x15, 0x00, 
-    0x21, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 
-    0xDD, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x2C, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x21, 0x00, 0x21, 0x00, 
-    0x21, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x21, 0x00, 0x2C, 0x00, 
-    0x21, 0x00, 0x15, 0x00, 0x2C, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x37, 0x00, 
-    0x43, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x15, 0x00, 0x21, 0x00, 0x15, 0x00, 
-    0x21, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0x0A, 0x00, 0x0A, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xC7, 0xFF, 
-    0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 0xB0, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 
-    0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xBB, 0xFF, 0xB0, 0xFF, 0xA5, 0xFF, 0xBB, 0xFF, 
-    0xBB, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 0xB0, 0xFF, 0xA5, 0xFF, 0xB0, 0xFF, 
-    0xB0, 0xFF, 0xB0, 0xFF, 0xB0, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 0xB0, 0xFF, 0xB0, 0xFF, 0xA5, 0xFF, 
-    0xB0, 0xFF, 0xB0, 0xFF, 0xBB, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 
-    0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xF4, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 0x00, 0x00, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 
-    0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 
-    0x20, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 
-    0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 
-    0xF4, 0xFF, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 
-    0xD2, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 
-    0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x20, 0x00, 0x2B, 0x00, 0x20, 0x00, 0x20, 0x00, 0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 
-    0x15, 0x00, 0x20, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x20, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0xF4, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xC7, 0xFF, 
-    0xD3, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 
-    0xDE, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 
-    0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 
-    0xD3, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xF4, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 
-    0xE9, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 
-    0x15, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x2C, 0x00, 
-    0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x15, 0x00, 
-    0x0A, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 
-    0xDE, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x2C, 0x00, 
-    0x42, 0x00, 0x42, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x42, 0x00, 0x4E, 0x00, 0x59, 0x00, 0x4E, 0x00, 
-    0x59, 0x00, 0x59, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x59, 0x00, 0x42, 0x00, 0x4E, 0x00, 0x37, 0x00, 
-    0x37, 0x00, 0x42, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x15, 0x00, 
-    0x0A, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x37, 0x00, 
-    0x37, 0x00, 0x42, 0x00, 0x42, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x64, 0x00, 0x64, 0x00, 0x59, 0x00, 
-    0x64, 0x00, 0x64, 0x00, 0x59, 0x00, 0x59, 0x00, 0x4E, 0x00, 0x37, 0x00, 0x37, 0x00, 0x20, 0x00, 
-    0x15, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 
-    0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 
-    0xBB, 0xFF, 0xC7, 0xFF, 0xBB, 0xFF, 0xC7, 0xFF, 0xBB, 0xFF, 0xC7, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 
-    0xBB, 0xFF, 0xC7, 0xFF, 0xBB, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xBB, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 
-    0xBB, 0xFF, 0xB0, 0xFF, 0xB0, 0xFF, 0xC7, 0xFF, 0xBB, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 
-    0xBB, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 
-    0xE9, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x15, 0x00, 0x21, 0x00, 0x21, 0x00, 
-    0x2C, 0x00, 0x37, 0x00, 0x43, 0x00, 0x43, 0x00, 0x43, 0x00, 0x59, 0x00, 0x4E, 0x00, 0x59, 0x00, 
-    0x59, 0x00, 0x59, 0x00, 0x4E, 0x00, 0x59, 0x00, 0x59, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x37, 0x00, 
-    0x37, 0x00, 0x37, 0x00, 0x43, 0x00, 0x37, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 
-    0xDD, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x0A, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 
-    0xD2, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 
-    0xDD, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x21, 0x00, 0x21, 0x00, 
-    0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 
-    0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x2C, 0x00, 
-    0x21, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 
-    0xDD, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0xDD, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xBB, 0xFF, 0xB0, 0xFF, 
-    0xB0, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 0xC7, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 0xB0, 0xFF, 0xB0, 0xFF, 
-    0xB0, 0xFF, 0xA5, 0xFF, 0xA5, 0xFF, 0xB0, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 
-    0xDE, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 
-    0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x42, 0x00, 0x37, 0x00, 
-    0x42, 0x00, 0x37, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 
-    0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 
-    0xD2, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0xDE, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xBB, 0xFF, 0xC7, 0xFF, 0xB0, 0xFF, 
-    0xC7, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xBB, 0xFF, 0xC7, 0xFF, 
-    0xBB, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x21, 0x00, 0x15, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x2C, 0x00, 
-    0x43, 0x00, 0x59, 0x00, 0x65, 0x00, 0x7B, 0x00, 0x7B, 0x00, 0x7B, 0x00, 0x70, 0x00, 0x70, 0x00, 
-    0x65, 0x00, 0x65, 0x00, 0x65, 0x00, 0x7B, 0x00, 0x7B, 0x00, 0x7B, 0x00, 0x65, 0x00, 0x65, 0x00, 
-    0x4E, 0x00, 0x43, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x21, 0x00, 0x21, 0x00, 
-    0x15, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 
-    0x00, 0x00, 0x15, 0x00, 0x15, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x2C, 0x00, 
-    0x2C, 0x00, 0x43, 0x00, 0x59, 0x00, 0x59, 0x00, 0x65, 0x00, 0x65, 0x00, 0x59, 0x00, 0x59, 0x00, 
-    0x59, 0x00, 0x4E, 0x00, 0x43, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x21, 0x00, 0x21, 0x00, 
-    0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 
-    0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 
-    0xE9, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x21, 0x00, 0x37, 0x00, 0x43, 0x00, 0x4E, 0x00, 0x5A, 0x00, 0x43, 0x00, 0x4E, 0x00, 0x43, 0x00, 
-    0x43, 0x00, 0x43, 0x00, 0x43, 0x00, 0x2C, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 
-    0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xB0, 0xFF, 
-    0xA4, 0xFF, 0x99, 0xFF, 0xA4, 0xFF, 0xA4, 0xFF, 0x99, 0xFF, 0xA4, 0xFF, 0x99, 0xFF, 0x99, 0xFF, 
-    0x99, 0xFF, 0xA4, 0xFF, 0xB0, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 0xC6, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 
-    0xD2, 0xFF, 0xC6, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 0xA4, 0xFF, 0xB0, 0xFF, 0x8D, 0xFF, 0x99, 0xFF, 
-    0x8D, 0xFF, 0x8D, 0xFF, 0x99, 0xFF, 0x8D, 0xFF, 0x99, 0xFF, 0xA4, 0xFF, 0x99, 0xFF, 0xA4, 0xFF, 
-    0xA4, 0xFF, 0xA4, 0xFF, 0xA4, 0xFF, 0xB0, 0xFF, 0xB0, 0xFF, 0xC6, 0xFF, 0xC6, 0xFF, 0xD2, 0xFF, 
-    0xDD, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x38, 0x00, 0x4F, 0x00, 
-    0x5A, 0x00, 0x4F, 0x00, 0x5A, 0x00, 0x5A, 0x00, 0x65, 0x00, 0x65, 0x00, 0x65, 0x00, 0x65, 0x00, 
-    0x5A, 0x00, 0x65, 0x00, 0x71, 0x00, 0x5A, 0x00, 0x71, 0x00, 0x65, 0x00, 0x65, 0x00, 0x5A, 0x00, 
-    0x5A, 0x00, 0x4F, 0x00, 0x43, 0x00, 0x38, 0x00, 0x38, 0x00, 0x2C, 0x00, 0x21, 0x00, 0x15, 0x00, 
-    0x0A, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0xDD, 0xFF, 0xF4, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 
-    0x0A, 0x00, 0x15, 0x00, 0x21, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xE9, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 
-    0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 
-    0xDD, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-    0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x21, 0x00, 0x21, 0x00, 0x38, 0x00, 0x2C, 0x00, 0x2C, 0x00, 
-    0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x21, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x21, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x15, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 
-    0xD2, 0xFF, 0xD2, 0xFF, 0xC6, 0xFF, 0xBB, 0xFF, 0xC6, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 0xD2, 0xFF, 
-    0xC6, 0xFF, 0xC6, 0xFF, 0xC6, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 0xC6, 0xFF, 0xD2, 0xFF, 
-    0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x15, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 
-    0x2C, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x38, 0x00, 0x4E, 0x00, 0x5A, 0x00, 0x5A, 0x00, 0x5A, 0x00, 
-    0x5A, 0x00, 0x5A, 0x00, 0x5A, 0x00, 0x5A, 0x00, 0x5A, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x4E, 0x00, 
-    0x4E, 0x00, 0x5A, 0x00, 0x5A, 0x00, 0x5A, 0x00, 0x5A, 0x00, 0x4E, 0x00, 0x5A, 0x00, 0x4E, 0x00, 
-    0x4E, 0x00, 0x4E, 0x00, 0x43, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x5A, 0x00, 0x4E, 0x00, 0x43, 0x00, 
-    0x38, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 
-    0x2C, 0x00, 0x2C, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 
-    0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-    0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x21, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 
-    0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xC6, 0xFF, 
-    0xC6, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 0xB0, 0xFF, 0xA4, 0xFF, 0x8D, 0xFF, 0x8D, 0xFF, 0x8D, 0xFF, 
-    0x82, 0xFF, 0x82, 0xFF, 0x82, 0xFF, 0x82, 0xFF, 0x8E, 0xFF, 0x8E, 0xFF, 0x8E, 0xFF, 0x82, 0xFF, 
-    0x99, 0xFF, 0x99, 0xFF, 0xA4, 0xFF, 0xA4, 0xFF, 0xB0, 0xFF, 0xBB, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 
-    0xD2, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x00, 0x00, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 
-    0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xE9, 0xFF, 
-    0xDD, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 
-    0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 
-    0x15, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x2C, 0x00, 
-    0x37, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x43, 0x00, 0x43, 0x00, 
-    0x43, 0x00, 0x43, 0x00, 0x4E, 0x00, 0x43, 0x00, 0x4E, 0x00, 0x43, 0x00, 0x43, 0x00, 0x21, 0x00, 
-    0x21, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x21, 0x00, 
-    0x37, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x15, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 
-    0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xFF, 0xE9, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 
-    0xDD, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 
-    0xD2, 0xFF, 0xC7, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 
-    0xDD, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x21, 0x00, 0x15, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 
-    0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 0x20, 0x00, 0x2C, 0x00, 
-    0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x42, 0x00, 0x4E, 0x00, 0x59, 0x00, 0x64, 0x00, 0x59, 0x00, 
-    0x59, 0x00, 0x59, 0x00, 0x59, 0x00, 0x59, 0x00, 0x4E, 0x00, 0x42, 0x00, 0x4E, 0x00, 0x42, 0x00, 
-    0x42, 0x00, 0x37, 0x00, 0x42, 0x00, 0x42, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x37, 0x00, 
-    0x20, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xDE, 0xFF, 
-    0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 
-    0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 
-    0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x20, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 
-    0xD2, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 
-    0xC7, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 0xB0, 0xFF, 0xA5, 0xFF, 0xA5, 0xFF, 0xB0, 0xFF, 0xB0, 0xFF, 
-    0xA5, 0xFF, 0xB0, 0xFF, 0xA5, 0xFF, 0xBC, 0xFF, 0xB0, 0xFF, 0xBC, 0xFF, 0xB0, 0xFF, 0xBC, 0xFF, 
-    0xBC, 0xFF, 0xBC, 0xFF, 0xB0, 0xFF, 0xA5, 0xFF, 0xA5, 0xFF, 0xA5, 0xFF, 0xA5, 0xFF, 0xBC, 0xFF, 
-    0xC7, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 
-    0xDE, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 
-    0xDE, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x0A, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x37, 0x00, 0x43, 0x00, 
-    0x43, 0x00, 0x43, 0x00, 0x43, 0x00, 0x43, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x43, 0x00, 
-    0x37, 0x00, 0x43, 0x00, 0x43, 0x00, 0x43, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x43, 0x00, 0x4E, 0x00, 
-    0x59, 0x00, 0x59, 0x00, 0x59, 0x00, 0x65, 0x00, 0x65, 0x00, 0x65, 0x00, 0x65, 0x00, 0x59, 0x00, 
-    0x4E, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x43, 0x00, 0x37, 0x00, 0x37, 0x00, 0x2C, 0x00, 
-    0x2C, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 
-    0x21, 0x00, 0x15, 0x00, 0x15, 0x00, 0x21, 0x00, 0x15, 0x00, 0x15, 0x00, 0x21, 0x00, 0x21, 0x00, 
-    0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 
-    0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 
-    0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xBB, 0xFF, 0xC7, 0xFF, 0xBB, 0xFF, 0xBB, 0xFF, 
-    0xBB, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 
-    0xD2, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 
-    0xDD, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 
-    0xDD, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 
-    0xC7, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 
-    0xD2, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 
-    0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x21, 0x00, 0x21, 0x00, 
-    0x2C, 0x00, 0x37, 0x00, 0x37, 0x00, 0x43, 0x00, 0x43, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 
-    0x43, 0x00, 0x43, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x43, 0x00, 0x43, 0x00, 0x43, 0x00, 0x43, 0x00, 
-    0x43, 0x00, 0x43, 0x00, 0x37, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x37, 0x00, 0x43, 0x00, 
-    0x37, 0x00, 0x43, 0x00, 0x37, 0x00, 0x37, 0x00, 0x43, 0x00, 0x43, 0x00, 0x37, 0x00, 0x37, 0x00, 
-    0x4E, 0x00, 0x4E, 0x00, 0x59, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x37, 0x00, 0x4E, 0x00, 0x43, 0x00, 
-    0x4E, 0x00, 0x59, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x43, 0x00, 
-    0x43, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x43, 0x00, 0x37, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x21, 0x00, 
-    0x21, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 
-    0xDD, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 
-    0xDD, 0xFF, 0xDD, 0xFF, 0xD2, 0xFF, 0xE9, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x15, 0x00, 0x20, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xDE, 0xFF, 0xE9, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 
-    0xBC, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 
-    0xB0, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xB0, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 
-    0xC7, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 
-    0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x2C, 0x00, 
-    0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 
-    0xDE, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xB1, 0xFF, 
-    0xBC, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xDE, 0xFF, 
-    0xD2, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x15, 0x00, 0x20, 0x00, 
-    0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 
-    0x20, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 
-    0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 
-    0x2C, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x15, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xB1, 0xFF, 0xA5, 0xFF, 
-    0xA5, 0xFF, 0x9A, 0xFF, 0xA5, 0xFF, 0x9A, 0xFF, 0xB1, 0xFF, 0xB1, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 
-    0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 
-    0xD2, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xDE, 0xFF, 
-    0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 
-    0xD2, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 
-    0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x20, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x2C, 0x00, 
-    0x20, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x4D, 0x00, 0x37, 0x00, 
-    0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x4D, 0x00, 0x59, 0x00, 0x64, 0x00, 0x59, 0x00, 0x59, 0x00, 
-    0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x4D, 0x00, 0x4D, 0x00, 0x4D, 0x00, 0x42, 0x00, 
-    0x42, 0x00, 0x4D, 0x00, 0x59, 0x00, 0x4D, 0x00, 0x59, 0x00, 0x42, 0x00, 0x42, 0x00, 0x2C, 0x00, 
-    0x20, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 
-    0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 
-    0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 
-    0x00, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 
-    0xF4, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 
-    0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 0xB0, 0xFF, 0xBC, 0xFF, 
-    0xB0, 0xFF, 0xB0, 0xFF, 0xB0, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 
-    0xD2, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x20, 0x00, 
-    0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 
-    0x2C, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x2C, 0x00, 
-    0x2C, 0x00, 0x37, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x37, 0x00, 0x37, 0x00, 0x42, 0x00, 
-    0x37, 0x00, 0x42, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x42, 0x00, 0x37, 0x00, 0x42, 0x00, 0x37, 0x00, 
-    0x37, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x2C, 0x00, 
-    0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x15, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x2C, 0x00, 
-    0x2C, 0x00, 0x20, 0x00, 0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0xDE, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x20, 0x00, 0x2C, 0x00, 
-    0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 0x20, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0xDE, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 
-    0xB1, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xC7, 0xFF, 0xDE, 0xFF, 
-    0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 
-    0xD2, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 
-    0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 
-    0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x37, 0x00, 
-    0x37, 0x00, 0x42, 0x00, 0x37, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 
-    0x20, 0x00, 0x2C, 0x00, 0x15, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 
-    0x37, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x42, 0x00, 
-    0x37, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x20, 0x00, 
-    0x2B, 0x00, 0x37, 0x00, 0x20, 0x00, 0x2B, 0x00, 0x20, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x2B, 0x00, 
-    0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x20, 0x00, 
-    0x20, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0xE9, 0xFF, 0xDE, 0xFF, 
-    0xD3, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 0xC7, 0xFF, 
-    0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 
-    0xBC, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 
-    0xC7, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 
-    0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 
-    0xD3, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 
-    0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-    0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x20, 0x00, 
-    0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x0A, 0x00, 
-    0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x2B, 0x00, 0x20, 0x00, 0x20, 0x00, 
-    0x2B, 0x00, 0x37, 0x00, 0x37, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x42, 0x00, 0x42, 0x00, 
-    0x37, 0x00, 0x37, 0x00, 0x20, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 
-    0x37, 0x00, 0x2B, 0x00, 0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x2B, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 
-    0xBC, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 
-    0xC7, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 
-    0xC7, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 
-    0xDE, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x20, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x20, 0x00, 0x20, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x37, 0x00, 
-    0x2B, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x4D, 0x00, 0x42, 0x00, 0x42, 0x00, 0x2B, 0x00, 0x2B, 0x00, 
-    0x20, 0x00, 0x37, 0x00, 0x20, 0x00, 0x2B, 0x00, 0x20, 0x00, 0x20, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 
-    0xD3, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 
-    0xD3, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xD3, 0xFF, 0xD3, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 
-    0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 
-    0xBC, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xB1, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xDE, 0xFF, 
-    0xDE, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xBC, 0xFF, 
-    0xC7, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xB0, 0xFF, 0xB0, 0xFF, 0xB0, 0xFF, 0x9A, 0xFF, 
-    0x8E, 0xFF, 0xA5, 0xFF, 0xB0, 0xFF, 0xB0, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xC7, 0xFF, 0xD2, 0xFF, 
-    0xD2, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 
-    0xE9, 0xFF, 0xDE, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 
-    0x00, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x2C, 0x00, 
-    0x2C, 0x00, 0x37, 0x00, 0x43, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x59, 0x00, 0x59, 0x00, 0x65, 0x00, 
-    0x65, 0x00, 0x70, 0x00, 0x7B, 0x00, 0x7B, 0x00, 0x70, 0x00, 0x70, 0x00, 0x65, 0x00, 0x65, 0x00, 
-    0x70, 0x00, 0x70, 0x00, 0x7C, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x7C, 0x00, 0x70, 0x00, 
-    0x7C, 0x00, 0x65, 0x00, 0x70, 0x00, 0x65, 0x00, 0x65, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x43, 0x00, 
-    0x37, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x21, 0x00, 0x15, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xE9, 0xFF, 0xC7, 0xFF, 0xC7, 0xFF, 0xBB, 0xFF, 
-    0xC7, 0xFF, 0xBB, 0xFF, 0xB0, 0xFF, 0xB0, 0xFF, 0xBB, 0xFF, 0xB0, 0xFF, 0xB0, 0xFF, 0xBB, 0xFF, 
-    0xA4, 0xFF, 0xB0, 0xFF, 0xB0, 0xFF, 0xB0, 0xFF, 0x99, 0xFF, 0xA4, 0xFF, 0xB0, 0xFF, 0xC6, 0xFF, 
-    0xD2, 0xFF, 0xD2, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 
-    0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0x00, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x21, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x0A, 0x00, 0x15, 0x00, 0x15, 0x00, 0x21, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 
-    0x21, 0x00, 0x15, 0x00, 0x21, 0x00, 0x21, 0x00, 0x38, 0x00, 0x38, 0x00, 0x43, 0x00, 0x43, 0x00, 
-    0x5A, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x43, 0x00, 0x4E, 0x00, 0x5A, 0x00, 0x4E, 0x00, 0x5A, 0x00, 
-    0x4E, 0x00, 0x5A, 0x00, 0x43, 0x00, 0x38, 0x00, 0x2C, 0x00, 0x21, 0x00, 0x15, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xF4, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 
-    0x15, 0x00, 0x21, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x21, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x21, 0x00, 
-    0x21, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x21, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x15, 0x00, 0x21, 0x00, 
-    0x21, 0x00, 0x21, 0x00, 0x2C, 0x00, 0x21, 0x00, 0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 
-    0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x21, 0x00, 0x21, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 
-    0xF4, 0xFF, 0xE9, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xDD, 0xFF, 0xDD, 0xFF, 0xE9, 0xFF, 0xDE, 0xFF, 
-    0xE9, 0xFF, 0xDE, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF
-};
\ No newline at end of file
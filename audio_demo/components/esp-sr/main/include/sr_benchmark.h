@@ -0,0 +1,27 @@
+#pragma once
+#include "esp_wn_iface.h"
+#include "esp_mn_iface.h"
+
+/*
+ * Speech model benchmark: run a model over a corpus and print per detect() latency, real-time factor
+ * and heap use as CSV lines, "SR_BENCH,..." for the summary and "SR_BENCH_HIST,..." for the histogram.
+ *
+ * The model runs over every clip of the sr_corpus partition (sr_corpus.h), 16 bit mono PCM at the model
+ * sample rate. Open the corpus with sr_corpus_open() first.
+ *
+ * WakeNet runs a second time in batches of CONFIG_SR_BENCH_WN_BATCH chunks, mode "<mode>/batch<n>", and
+ * "SR_BENCH_TRIGGERS,..." of both passes tell whether the batched results match.
+ */
+
+void sr_bench_wakenet(const esp_wn_iface_t *wakenet, const model_coeff_getter_t *coeff, det_mode_t det_mode, const char *name);
+
+void sr_bench_multinet(const esp_mn_iface_t *multinet, const model_coeff_getter_t *coeff, int sample_length_ms, const char *name);
+
+// Time the dl_dotq kernels and the dl_lib matrix product against their C versions, "SR_BENCH_KERNEL,..." lines
+void sr_bench_kernels();
+
+// Time the dl_dotq kernels, the dl_lib matrix product and memcpy in CPU cycles, "UBENCH {...}" JSON lines
+void sr_ubench_run();
+
+// Benchmark the WakeNet model of menuconfig in both detection modes and the MultiNet model
+void sr_benchmark_test();
@@ -0,0 +1,53 @@
+#pragma once
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_partition.h"
+
+/*
+ * Test audio in the "sr_corpus" data partition, packed by tools/mk_sr_corpus/mk_sr_corpus.py.
+ * Clips are 16 bit mono PCM, read block by block so a test keeps only a small buffer in RAM.
+ */
+
+#define SR_CORPUS_PARTITION     "sr_corpus"
+#define SR_CORPUS_NAME_LEN      32
+#define SR_CORPUS_BLOCK_SIZE    4096        // one flash sector per esp_partition_read
+
+typedef struct {
+    char name[SR_CORPUS_NAME_LEN];
+    uint32_t offset;            // from the partition start
+    uint32_t size;              // bytes
+} sr_corpus_clip_t;
+
+typedef struct {
+    const sr_corpus_clip_t *clip;
+    uint32_t pos;               // next byte of the clip to hand out
+    uint32_t block_pos;         // clip position of block[0]
+    uint32_t block_len;
+    uint8_t block[SR_CORPUS_BLOCK_SIZE];
+} sr_corpus_reader_t;
+
+/**
+ * @brief Load the clip index, once; later calls return at once.
+ *
+ * @return ESP_ERR_NOT_FOUND no partition, ESP_ERR_INVALID_VERSION not a corpus image
+ */
+esp_err_t sr_corpus_open(void);
+
+int sr_corpus_count(void);
+
+// NULL when index is out of range or the corpus is not open
+const sr_corpus_clip_t *sr_corpus_get(int index);
+
+// NULL when there is no such clip, opens the corpus when needed
+const sr_corpus_clip_t *sr_corpus_find(const char *name);
+
+void sr_corpus_reader_init(sr_corpus_reader_t *reader, const sr_corpus_clip_t *clip);
+
+void sr_corpus_reader_seek(sr_corpus_reader_t *reader, uint32_t pos);
+
+/**
+ * @brief Copy the next samples of the clip.
+ *
+ * @return The samples copied, less than samples at the end of the clip, -1 on a flash error
+ */
+int sr_corpus_reader_read(sr_corpus_reader_t *reader, int16_t *buf, int samples);
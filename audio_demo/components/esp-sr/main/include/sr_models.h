@@ -0,0 +1,44 @@
+#pragma once
+#include "esp_wn_iface.h"
+#include "esp_mn_iface.h"
+#include "dl_lib_arena.h"
+
+/*
+ * Where the test models get their coefficients and their buffers.
+ * With CONFIG_SR_MODEL_FROM_PARTITION the coefficients are served memory-mapped from the wn_model and
+ * mn_model partitions, recorded from the compiled-in ones the first time. Otherwise builtin is returned.
+ */
+const model_coeff_getter_t *sr_wakenet_coeff(const esp_wn_iface_t *wakenet, const model_coeff_getter_t *builtin);
+const model_coeff_getter_t *sr_multinet_coeff(const esp_mn_iface_t *multinet, const model_coeff_getter_t *builtin);
+
+/*
+ * The WakeNet to run, picked at boot from the model partitions instead of esp_wn_models.h.
+ * The NVS key "wakenet" of namespace "sr_models" names the partition, wn_model without it. An image tagged
+ * for a known net is used whatever the firmware was built with, so copying another wn_model image into the
+ * partition changes the wake word. Otherwise it falls back to the WAKENET_MODEL of menuconfig, or NULL
+ * without CONFIG_SR_WN_BUILTIN.
+ */
+const esp_wn_iface_t *sr_wakenet_select(const model_coeff_getter_t **coeff);
+
+// Pick the WakeNet in partition label from the next boot, ESP_ERR_NOT_FOUND if it holds none
+esp_err_t sr_wakenet_use(const char *label);
+
+// Print the model partitions holding a WakeNet and their tags
+void sr_wakenet_list();
+
+// Wrap a model create(), allocations of CONFIG_SR_MODEL_PSRAM_LIMIT bytes or more go to PSRAM
+void sr_model_create_begin();
+void sr_model_create_end();
+
+// With CONFIG_SR_DL_ARENA the arena one model runs its detect() from, NULL otherwise
+dl_arena_t *sr_model_arena_create();
+
+/*
+ * detect() over n consecutive chunks of one stream, oldest first, chunk i at chunks + i * chunksize, from
+ * one arena binding. results[i] is what detect() returns for chunk i, the same as n calls one by one: the
+ * nets keep the state of the stream inside the library and take one chunk per call, so a batch saves the
+ * work around the calls, not the matrix-vector products in them. results may be NULL.
+ * Returns the first chunk with a non-zero result, -1 when there is none.
+ */
+int sr_model_detect_batch(int (*detect)(model_iface_data_t *, int16_t *), model_iface_data_t *model,
+                          dl_arena_t *arena, int16_t *chunks, int n, int chunksize, int *results);
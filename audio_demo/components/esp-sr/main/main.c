@@ -9,9 +9,23 @@
 #include "wakenet_test.h"
 #include "multinet_test.h"
 #include "audio_process.h"
+#include "sr_benchmark.h"
+#include "dl_lib_dotq.h"
+#include "sdkconfig.h"
 
 void app_main()
 {
+    dl_dotq_init();
+
+#ifdef CONFIG_SR_UBENCH
+    sr_ubench_run();
+#endif
+
+#ifdef CONFIG_SR_BENCHMARK
+    sr_benchmark_test();
+    return;
+#endif
+
     // test wakenet
     wakenet_test();
     vTaskDelay(3000 / portTICK_PERIOD_MS);
@@ -5,37 +5,85 @@
 
 #include "esp_mn_iface.h"
 #include "esp_mn_models.h"
+#include "esp_wn_models.h"
 #include "dl_lib_coefgetter_if.h"
+#include "sr_engine.h"
 #include "multinet_test.h"
-#include "dakaidiandeng.h"
+#include "sr_corpus.h"
+#include "sr_models.h"
 
 static const esp_mn_iface_t *multinet = &MULTINET_MODEL;
 
+#define MN_COMMAND_WINDOW_MS    6000
+
+/*
+ * The mic stream: the wake word, then the command right after it
+ */
+static const char *mic_stream_clips[] = {"hilexin", "dakaidiandeng"};
+
+typedef struct {
+    sr_corpus_reader_t reader;
+    int clip;
+} mic_stream_t;
+
+static const int16_t *mic_stream_chunk(mic_stream_t *stream, int16_t *buffer, int audio_chunksize)
+{
+    int got = 0;
+
+    while (got < audio_chunksize) {
+        if (stream->reader.clip == NULL || stream->reader.pos == stream->reader.clip->size) {
+            if (stream->clip == sizeof(mic_stream_clips) / sizeof(mic_stream_clips[0])) {
+                return NULL;
+            }
+            const sr_corpus_clip_t *clip = sr_corpus_find(mic_stream_clips[stream->clip++]);
+            if (clip == NULL) {
+                return NULL;
+            }
+            sr_corpus_reader_init(&stream->reader, clip);
+        }
+        int n = sr_corpus_reader_read(&stream->reader, buffer + got, audio_chunksize - got);
+        if (n < 0) {
+            return NULL;
+        }
+        got += n;
+    }
+    return buffer;
+}
+
 void multinetTask(void *arg)
 {
-    model_iface_data_t *model_data = arg;
-    int audio_chunksize = multinet->get_samp_chunksize(model_data);
-    int chunk_num = multinet->get_samp_chunknum(model_data);
-    int16_t *buffer = malloc(audio_chunksize * sizeof(int16_t));
-    assert(buffer);
+    sr_engine_handle_t engine = arg;
+    int audio_chunksize = sr_engine_get_chunksize(engine);
     int chunks = 0;
+    int wakeup_chunk = -1;
+    mic_stream_t *stream = calloc(1, sizeof(mic_stream_t));
+    assert(stream);
     while (1) {
-        if ((chunks+1)*audio_chunksize*sizeof(int16_t) <= sizeof(dakaidiandeng)) {
-            memcpy(buffer, dakaidiandeng+chunks*audio_chunksize*sizeof(int16_t), audio_chunksize * sizeof(int16_t));   
-        } else {
-            memset(buffer, 0, audio_chunksize*sizeof(int16_t));
+        int16_t *buffer = sr_engine_get_buffer(engine);
+        if (mic_stream_chunk(stream, buffer, audio_chunksize) == NULL) {
+            // keep feeding silence until MultiNet gives up
+            memset(buffer, 0, audio_chunksize * sizeof(int16_t));
+            if (wakeup_chunk < 0) {
+                printf("can not detect the wake word\n");
+                break;
+            }
         }
-        int command_id = multinet->detect(model_data, buffer);
+        int result;
+        sr_event_t event = sr_engine_feed(engine, &result);
         chunks++;
-        if (chunks == chunk_num || command_id > -1) {
-            if (command_id > -1) {
-                printf("MN test successfully, Commands ID: %d.\n", command_id);
-            } else {
-                printf("can not recognize any speech commands\n");
-            }
+        if (event == SR_EVENT_WAKEUP) {
+            wakeup_chunk = chunks;
+            printf("WakeNet triggered output %d, listening for a command\n", result);
+        } else if (event == SR_EVENT_COMMAND) {
+            printf("MN test successfully, Commands ID: %d, %d chunks after the wake word.\n", result, chunks - wakeup_chunk);
+            break;
+        } else if (event == SR_EVENT_TIMEOUT) {
+            printf("can not recognize any speech commands\n");
             break;
         }
     }
+    free(stream);
+    sr_engine_destroy(engine);
     printf("TEST2 FINISHED\n\n");
     vTaskDelete(NULL);
 }
@@ -45,12 +93,31 @@ void multinet_test()
     int start_size = heap_caps_get_free_size(MALLOC_CAP_8BIT);
     printf("Start free RAM size: %d\n", start_size);
 
-    //Initialize multinet model
-    model_iface_data_t *model_data = multinet->create(&MULTINET_COEFF, 6000);
+    //Initialize wakenet and multinet on one audio ring
+    const model_coeff_getter_t *wakenet_coeff;
+    const esp_wn_iface_t *wakenet = sr_wakenet_select(&wakenet_coeff);
+    if (wakenet == NULL) {
+        printf("No WakeNet in the model partitions\n");
+        return;
+    }
+    sr_engine_config_t config = {
+        .wakenet = wakenet,
+        .wakenet_coeff = wakenet_coeff,
+        .det_mode = DET_MODE_90,
+        .multinet = multinet,
+        .multinet_coeff = sr_multinet_coeff(multinet, &MULTINET_COEFF),
+        .command_window_ms = MN_COMMAND_WINDOW_MS,
+    };
+    sr_model_create_begin();
+    sr_engine_handle_t engine = sr_engine_create(&config);
+    sr_model_create_end();
+    if (engine == NULL) {
+        printf("speech recognition engine create failed\n");
+        return;
+    }
 
-    //define_speech_commands(multinet, model_data);
-    printf("multinet RAM size: %d\nRAM size after multinet init: %d\n",
+    printf("WakeNet + multinet RAM size: %d\nRAM size after init: %d\n",
            start_size - heap_caps_get_free_size(MALLOC_CAP_8BIT), heap_caps_get_free_size(MALLOC_CAP_8BIT));
 
-    xTaskCreatePinnedToCore(&multinetTask, "multinet", 2 * 1024, (void*)model_data, 5, NULL, 1);
+    xTaskCreatePinnedToCore(&multinetTask, "multinet", 3 * 1024, (void*)engine, 5, NULL, 1);
 }
@@ -0,0 +1,334 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "esp_system.h"
+#include "sdkconfig.h"
+
+#include "esp_wn_models.h"
+#include "esp_mn_models.h"
+#include "sr_benchmark.h"
+#include "sr_corpus.h"
+#include "sr_models.h"
+#include "dl_lib_dotq.h"
+
+#define SR_BENCH_HIST_US        250     // histogram bucket width
+#define SR_BENCH_HIST_BUCKETS   200     // up to 50 ms, slower calls land in the last bucket
+#define SR_BENCH_MN_WINDOW_MS   6000
+#define SR_BENCH_KERNEL_RUNS    200
+#define SR_BENCH_KERNEL_MAX     1024    // longest vector, the widest layer of the models
+
+#ifdef CONFIG_SR_BENCH_WN_BATCH
+#define SR_BENCH_WN_BATCH       CONFIG_SR_BENCH_WN_BATCH
+#else
+#define SR_BENCH_WN_BATCH       1
+#endif
+
+typedef struct {
+    sr_corpus_reader_t reader;
+    int clip;                               // next clip of the corpus
+    uint32_t hist[SR_BENCH_HIST_BUCKETS + 1];
+    int64_t total_us;
+    uint32_t min_us;
+    uint32_t max_us;
+    int chunks;
+} sr_bench_t;
+
+typedef struct {
+    size_t internal;
+    size_t spiram;
+} sr_bench_heap_t;
+
+static void sr_bench_heap_free(sr_bench_heap_t *heap)
+{
+    heap->internal = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+    heap->spiram = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+}
+
+static void sr_bench_heap_min(sr_bench_heap_t *heap)
+{
+    // the low-water mark since boot, so a peak reads 0 when the heap was lower before the benchmark
+    heap->internal = heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL);
+    heap->spiram = heap_caps_get_minimum_free_size(MALLOC_CAP_SPIRAM);
+}
+
+static uint32_t sr_bench_used(size_t before, size_t after)
+{
+    return before > after ? before - after : 0;
+}
+
+/*
+ * The next whole chunk of the corpus, the clips are run one after the other and
+ * the tail of a clip shorter than a chunk is skipped
+ */
+static int sr_bench_read(sr_bench_t *bench, int16_t *buffer, int chunksize)
+{
+    while (1) {
+        if (bench->reader.clip) {
+            int n = sr_corpus_reader_read(&bench->reader, buffer, chunksize);
+            if (n == chunksize) {
+                return 1;
+            }
+            if (n < 0) {
+                return 0;
+            }
+        }
+        const sr_corpus_clip_t *clip = sr_corpus_get(bench->clip++);
+        if (clip == NULL) {
+            return 0;
+        }
+        sr_corpus_reader_init(&bench->reader, clip);
+    }
+}
+
+static uint32_t sr_bench_percentile(sr_bench_t *bench, int percent)
+{
+    uint32_t target = ((uint64_t)bench->chunks * percent + 99) / 100;
+    uint32_t count = 0;
+
+    for (int i = 0; i < SR_BENCH_HIST_BUCKETS; i++) {
+        count += bench->hist[i];
+        if (count >= target) {
+            uint32_t edge = (i + 1) * SR_BENCH_HIST_US;
+            return edge < bench->max_us ? edge : bench->max_us;
+        }
+    }
+    return bench->max_us;
+}
+
+/*
+ * Time every detect() over the corpus, the flash reads stay out of the measurement.
+ * With batch > 1 the chunks go through sr_model_detect_batch batch at a time and each chunk of a batch
+ * counts its share of the batch time. The triggers and the chunks they fell on are summed up, so
+ * runs of a fresh model with different batches can be checked to give the same results.
+ */
+static void sr_bench_run(const char *name, const char *mode, model_iface_data_t *model,
+                         int (*detect)(model_iface_data_t *, int16_t *), int chunksize, int rate, int batch,
+                         const sr_bench_heap_t *start, const sr_bench_heap_t *created)
+{
+    sr_bench_t *bench = calloc(1, sizeof(sr_bench_t));
+    int16_t *buffer = malloc(batch * chunksize * sizeof(int16_t));
+    int *results = malloc(batch * sizeof(int));
+    dl_arena_t *arena = sr_model_arena_create();
+    int triggers = 0;
+    uint32_t trigger_sum = 0;
+    if (bench == NULL || buffer == NULL || results == NULL) {
+        printf("%s: no memory for the benchmark\n", name);
+        goto out;
+    }
+    bench->min_us = UINT32_MAX;
+
+    while (1) {
+        int n = 0;
+        while (n < batch && sr_bench_read(bench, buffer + n * chunksize, chunksize)) {
+            n++;
+        }
+        if (n == 0) {
+            break;
+        }
+        int64_t t0 = esp_timer_get_time();
+        sr_model_detect_batch(detect, model, arena, buffer, n, chunksize, results);
+        uint32_t us = (esp_timer_get_time() - t0) / n;
+
+        for (int i = 0; i < n; i++) {
+            int bucket = us / SR_BENCH_HIST_US;
+            bench->hist[bucket < SR_BENCH_HIST_BUCKETS ? bucket : SR_BENCH_HIST_BUCKETS]++;
+            bench->total_us += us;
+            bench->min_us = us < bench->min_us ? us : bench->min_us;
+            bench->max_us = us > bench->max_us ? us : bench->max_us;
+            if (results[i]) {
+                triggers++;
+                trigger_sum += (bench->chunks + 1) * results[i];
+            }
+            bench->chunks++;
+        }
+    }
+    if (bench->chunks == 0) {
+        printf("%s: no corpus clip as long as one chunk\n", name);
+        goto out;
+    }
+
+    sr_bench_heap_t steady, low;
+    sr_bench_heap_free(&steady);
+    sr_bench_heap_min(&low);
+    int64_t audio_us = (int64_t)bench->chunks * chunksize * 1000000 / rate;
+
+    printf("SR_BENCH_FIELDS,name,mode,clips,chunks,chunk_samples,audio_ms,min_us,avg_us,p50_us,p99_us,max_us,rtf,"
+           "internal_model,internal_steady,internal_peak,spiram_model,spiram_steady,spiram_peak\n");
+    printf("SR_BENCH,%s,%s,%d,%d,%d,%d,%u,%u,%u,%u,%u,%.4f,%u,%u,%u,%u,%u,%u\n",
+           name, mode, sr_corpus_count(), bench->chunks, chunksize, (int)(audio_us / 1000),
+           bench->min_us, (uint32_t)(bench->total_us / bench->chunks), sr_bench_percentile(bench, 50),
+           sr_bench_percentile(bench, 99), bench->max_us, (double)bench->total_us / audio_us,
+           sr_bench_used(start->internal, created->internal), sr_bench_used(start->internal, steady.internal),
+           sr_bench_used(start->internal, low.internal),
+           sr_bench_used(start->spiram, created->spiram), sr_bench_used(start->spiram, steady.spiram),
+           sr_bench_used(start->spiram, low.spiram));
+    for (int i = 0; i <= SR_BENCH_HIST_BUCKETS; i++) {
+        if (bench->hist[i]) {
+            printf("SR_BENCH_HIST,%s,%s,%d,%u\n", name, mode, i * SR_BENCH_HIST_US, bench->hist[i]);
+        }
+    }
+    printf("SR_BENCH_TRIGGERS,%s,%s,%d,%d,%u\n", name, mode, batch, triggers, trigger_sum);
+    if (arena) {
+        printf("SR_BENCH_ARENA,%s,%s,%d,%d\n", name, mode, (int)dl_arena_high_water(arena), dl_arena_overflows(arena));
+    }
+
+out:
+    dl_arena_destroy(arena);
+    free(results);
+    free(buffer);
+    free(bench);
+}
+
+static void sr_bench_fill(qtp_t *v, int len)
+{
+    for (int i = 0; i < len; i++) {
+        v[i] = esp_random();
+    }
+}
+
+static uint32_t sr_bench_time_dot(dl_dotq_fn_t dot, const qtp_t *a, const qtp_t *b, int len, int64_t *result)
+{
+    int64_t t0 = esp_timer_get_time();
+    for (int i = 0; i < SR_BENCH_KERNEL_RUNS; i++) {
+        *result = dot(a, b, len);
+    }
+    return esp_timer_get_time() - t0;
+}
+
+static uint32_t sr_bench_time_add(dl_addq_fn_t add, const qtp_t *a, const qtp_t *b, qtp_t *res, int len)
+{
+    int64_t t0 = esp_timer_get_time();
+    for (int i = 0; i < SR_BENCH_KERNEL_RUNS; i++) {
+        add(a, b, res, len, 1);
+    }
+    return esp_timer_get_time() - t0;
+}
+
+/*
+ * The selected dot and add kernels against the C ones, then the dl_lib matrix product against its
+ * C version, on vectors of random items. exact is 1 when both give the same bits.
+ */
+void sr_bench_kernels()
+{
+    static const int lens[] = {16, 63, 160, 256, 512, SR_BENCH_KERNEL_MAX};
+    qtp_t *buf = malloc(4 * SR_BENCH_KERNEL_MAX * sizeof(qtp_t));
+    if (buf == NULL) {
+        printf("kernels: no memory for the benchmark\n");
+        return;
+    }
+    qtp_t *a = buf, *b = buf + SR_BENCH_KERNEL_MAX;
+    qtp_t *r0 = buf + 2 * SR_BENCH_KERNEL_MAX, *r1 = buf + 3 * SR_BENCH_KERNEL_MAX;
+    sr_bench_fill(a, SR_BENCH_KERNEL_MAX);
+    sr_bench_fill(b, SR_BENCH_KERNEL_MAX);
+
+    printf("SR_BENCH_KERNEL_FIELDS,kernel,impl,len,runs,c_us,impl_us,exact\n");
+    for (int i = 0; i < (int)(sizeof(lens) / sizeof(lens[0])); i++) {
+        int len = lens[i];
+        int64_t c_sum, sum;
+        uint32_t c_us = sr_bench_time_dot(dl_dotq_c_impl, a, b, len, &c_sum);
+        uint32_t us = sr_bench_time_dot(dl_dotq_impl, a, b, len, &sum);
+        printf("SR_BENCH_KERNEL,dotq,%s,%d,%d,%u,%u,%d\n", dl_dotq_impl_name(), len, SR_BENCH_KERNEL_RUNS,
+               c_us, us, c_sum == sum);
+
+        c_us = sr_bench_time_add(dl_addq_c_impl, a, b, r0, len);
+        us = sr_bench_time_add(dl_addq_impl, a, b, r1, len);
+        printf("SR_BENCH_KERNEL,addq,%s,%d,%d,%u,%u,%d\n", dl_dotq_impl_name(), len, SR_BENCH_KERNEL_RUNS,
+               c_us, us, memcmp(r0, r1, len * sizeof(qtp_t)) == 0);
+    }
+    free(buf);
+
+    // one frame through a dense layer: 1 x len times len x 128
+    for (int i = 0; i < (int)(sizeof(lens) / sizeof(lens[0])); i++) {
+        int len = lens[i];
+        dl_matrix2dq_t *in = dl_matrixq_alloc(len, 1);
+        dl_matrix2dq_t *w = dl_matrixq_alloc(128, len);
+        dl_matrix2dq_t *out0 = dl_matrixq_alloc(128, 1);
+        dl_matrix2dq_t *out1 = dl_matrixq_alloc(128, 1);
+        if (in && w && out0 && out1) {
+            sr_bench_fill(in->itemq, len);
+            sr_bench_fill(w->itemq, 128 * len);
+            in->exponent = w->exponent = -15;
+            int64_t t0 = esp_timer_get_time();
+            dl_matrixq_dot_c_impl(in, w, out0, 0);
+            uint32_t c_us = esp_timer_get_time() - t0;
+            t0 = esp_timer_get_time();
+            dl_matrixq_dot(in, w, out1, 0);
+            uint32_t us = esp_timer_get_time() - t0;
+            printf("SR_BENCH_KERNEL,matrixq_dot,dl_lib,%d,1,%u,%u,%d\n", len, c_us, us,
+                   out0->exponent == out1->exponent && memcmp(out0->itemq, out1->itemq, 128 * sizeof(qtp_t)) == 0);
+        }
+        dl_matrix2dq_t *m[] = {in, w, out0, out1};
+        for (int j = 0; j < 4; j++) {
+            if (m[j]) {
+                dl_matrixq_free(m[j]);
+            }
+        }
+    }
+}
+
+void sr_bench_wakenet(const esp_wn_iface_t *wakenet, const model_coeff_getter_t *coeff, det_mode_t det_mode, const char *name)
+{
+    const char *det = det_mode == DET_MODE_90 ? "DET_MODE_90" : "DET_MODE_95";
+    char mode[24];
+    // a fresh model per pass, the batched one has to start from the same state
+    for (int batch = 1; batch; batch = batch < SR_BENCH_WN_BATCH ? SR_BENCH_WN_BATCH : 0) {
+        sr_bench_heap_t start, created;
+        sr_bench_heap_free(&start);
+        model_iface_data_t *model = wakenet->create(coeff, det_mode);
+        sr_bench_heap_free(&created);
+        if (model == NULL) {
+            printf("%s: create failed\n", name);
+            return;
+        }
+        if (batch > 1) {
+            snprintf(mode, sizeof(mode), "%s/batch%d", det, batch);
+        } else {
+            snprintf(mode, sizeof(mode), "%s", det);
+        }
+        sr_bench_run(name, mode, model, wakenet->detect, wakenet->get_samp_chunksize(model),
+                     wakenet->get_samp_rate(model), batch, &start, &created);
+        wakenet->destroy(model);
+    }
+}
+
+void sr_bench_multinet(const esp_mn_iface_t *multinet, const model_coeff_getter_t *coeff, int sample_length_ms, const char *name)
+{
+    char mode[16];
+    sr_bench_heap_t start, created;
+    sr_bench_heap_free(&start);
+    model_iface_data_t *model = multinet->create(coeff, sample_length_ms);
+    sr_bench_heap_free(&created);
+    if (model == NULL) {
+        printf("%s: create failed\n", name);
+        return;
+    }
+    snprintf(mode, sizeof(mode), "%dms", sample_length_ms);
+    sr_bench_run(name, mode, model, multinet->detect,
+                 multinet->get_samp_chunksize(model), multinet->get_samp_rate(model), 1, &start, &created);
+    multinet->destroy(model);
+}
+
+static void sr_benchmark_task(void *arg)
+{
+    sr_bench_kernels();
+    if (sr_corpus_open() != ESP_OK) {
+        printf("SR_BENCH_DONE\n\n");
+        vTaskDelete(NULL);
+    }
+#if !defined(CONFIG_SR_MODEL_FROM_PARTITION) || defined(CONFIG_SR_WN_BUILTIN)
+    sr_bench_wakenet(&WAKENET_MODEL, &WAKENET_COEFF, DET_MODE_90, "wakenet");
+    sr_bench_wakenet(&WAKENET_MODEL, &WAKENET_COEFF, DET_MODE_95, "wakenet");
+#endif
+    sr_bench_multinet(&MULTINET_MODEL, &MULTINET_COEFF, SR_BENCH_MN_WINDOW_MS, "multinet");
+    printf("SR_BENCH_DONE\n\n");
+    vTaskDelete(NULL);
+}
+
+void sr_benchmark_test()
+{
+    xTaskCreatePinnedToCore(&sr_benchmark_task, "sr_benchmark", 4 * 1024, NULL, 5, NULL, 1);
+}
@@ -0,0 +1,125 @@
+#include <stdio.h>
+#include <string.h>
+#include "sr_corpus.h"
+
+#define SR_CORPUS_MAGIC         "SRCI"
+#define SR_CORPUS_VERSION       1
+#define SR_CORPUS_MAX_CLIPS     64
+
+typedef struct {
+    char magic[4];
+    uint32_t version;
+    uint32_t count;
+} sr_corpus_header_t;
+
+static const esp_partition_t *s_part;
+static sr_corpus_clip_t s_clips[SR_CORPUS_MAX_CLIPS];
+static int s_count;
+
+esp_err_t sr_corpus_open(void)
+{
+    sr_corpus_header_t header;
+    esp_err_t ret;
+
+    if (s_part) {
+        return ESP_OK;
+    }
+    const esp_partition_t *part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, SR_CORPUS_PARTITION);
+    if (part == NULL) {
+        printf("no %s partition\n", SR_CORPUS_PARTITION);
+        return ESP_ERR_NOT_FOUND;
+    }
+    ret = esp_partition_read(part, 0, &header, sizeof(header));
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    if (memcmp(header.magic, SR_CORPUS_MAGIC, 4) || header.version != SR_CORPUS_VERSION) {
+        printf("%s holds no corpus, flash it with mk_sr_corpus.py\n", SR_CORPUS_PARTITION);
+        return ESP_ERR_INVALID_VERSION;
+    }
+    if (header.count > SR_CORPUS_MAX_CLIPS) {
+        printf("%s: %u clips, only the first %d are used\n", SR_CORPUS_PARTITION, header.count, SR_CORPUS_MAX_CLIPS);
+        header.count = SR_CORPUS_MAX_CLIPS;
+    }
+    ret = esp_partition_read(part, sizeof(header), s_clips, header.count * sizeof(sr_corpus_clip_t));
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    for (uint32_t i = 0; i < header.count; i++) {
+        s_clips[i].name[SR_CORPUS_NAME_LEN - 1] = '\0';
+        if (s_clips[i].offset > part->size || s_clips[i].size > part->size - s_clips[i].offset) {
+            printf("%s: clip %s out of the partition\n", SR_CORPUS_PARTITION, s_clips[i].name);
+            return ESP_ERR_INVALID_SIZE;
+        }
+    }
+    s_count = header.count;
+    s_part = part;
+    return ESP_OK;
+}
+
+int sr_corpus_count(void)
+{
+    return s_count;
+}
+
+const sr_corpus_clip_t *sr_corpus_get(int index)
+{
+    if (index < 0 || index >= s_count) {
+        return NULL;
+    }
+    return &s_clips[index];
+}
+
+const sr_corpus_clip_t *sr_corpus_find(const char *name)
+{
+    if (sr_corpus_open() != ESP_OK) {
+        return NULL;
+    }
+    for (int i = 0; i < s_count; i++) {
+        if (strcmp(s_clips[i].name, name) == 0) {
+            return &s_clips[i];
+        }
+    }
+    printf("no clip %s in %s\n", name, SR_CORPUS_PARTITION);
+    return NULL;
+}
+
+void sr_corpus_reader_init(sr_corpus_reader_t *reader, const sr_corpus_clip_t *clip)
+{
+    reader->clip = clip;
+    reader->pos = 0;
+    reader->block_pos = 0;
+    reader->block_len = 0;
+}
+
+void sr_corpus_reader_seek(sr_corpus_reader_t *reader, uint32_t pos)
+{
+    reader->pos = pos < reader->clip->size ? pos : reader->clip->size;
+}
+
+int sr_corpus_reader_read(sr_corpus_reader_t *reader, int16_t *buf, int samples)
+{
+    uint8_t *out = (uint8_t *)buf;
+    uint32_t want = samples * sizeof(int16_t);
+    uint32_t done = 0;
+
+    while (done < want && reader->pos < reader->clip->size) {
+        if (reader->pos < reader->block_pos || reader->pos >= reader->block_pos + reader->block_len) {
+            // refill from the block the position falls in
+            uint32_t len = reader->clip->size - reader->pos;
+            len = len < SR_CORPUS_BLOCK_SIZE ? len : SR_CORPUS_BLOCK_SIZE;
+            if (esp_partition_read(s_part, reader->clip->offset + reader->pos, reader->block, len) != ESP_OK) {
+                return -1;
+            }
+            reader->block_pos = reader->pos;
+            reader->block_len = len;
+        }
+        uint32_t off = reader->pos - reader->block_pos;
+        uint32_t n = reader->block_len - off;
+        n = n < want - done ? n : want - done;
+        memcpy(out + done, reader->block + off, n);
+        done += n;
+        reader->pos += n;
+    }
+    return done / sizeof(int16_t);
+}
@@ -0,0 +1,246 @@
+#include <stdio.h>
+#include <string.h>
+#include "sdkconfig.h"
+#include "esp_heap_caps.h"
+#include "esp_partition.h"
+#include "nvs_flash.h"
+#include "nvs.h"
+#include "esp_wn_models.h"
+#include "dl_lib_coef_partition.h"
+#include "sr_models.h"
+
+#define SR_WN_PARTITION     "wn_model"
+#define SR_MN_PARTITION     "mn_model"
+#define SR_MN_RECORD_MS     6000
+#define SR_MODEL_SUBTYPE    0x41
+#define SR_NVS_NAMESPACE    "sr_models"
+#define SR_NVS_WAKENET      "wakenet"
+
+/*
+ * A WakeNet image is tagged "<net>:<wake word>", the net tells which library interface reads it.
+ */
+static const struct {
+    const char *name;
+    const esp_wn_iface_t *wakenet;
+} sr_wn_nets[] = {
+    { "wakenet3_quantized", &esp_sr_wakenet3_quantized },
+    { "wakenet4_quantized", &esp_sr_wakenet4_quantized },
+    { "wakenet5_quantized", &esp_sr_wakenet5_quantized },
+    { "wakenet5_float", &esp_sr_wakenet5_float },
+    { "wakenet6_quantized", &esp_sr_wakenet6_quantized },
+};
+
+#define SR_WN_NET_NUM   (sizeof(sr_wn_nets) / sizeof(sr_wn_nets[0]))
+
+#ifdef CONFIG_SR_MODEL_FROM_PARTITION
+static const char *sr_wn_net_name(const esp_wn_iface_t *wakenet)
+{
+    for (int i = 0; i < SR_WN_NET_NUM; i++) {
+        if (sr_wn_nets[i].wakenet == wakenet) {
+            return sr_wn_nets[i].name;
+        }
+    }
+    return NULL;
+}
+#endif
+
+static const esp_wn_iface_t *sr_wn_net_of_tag(const char *tag)
+{
+    const char *end = strchr(tag, ':');
+    size_t len = end ? end - tag : strlen(tag);
+
+    for (int i = 0; i < SR_WN_NET_NUM; i++) {
+        if (strlen(sr_wn_nets[i].name) == len && strncmp(sr_wn_nets[i].name, tag, len) == 0) {
+            return sr_wn_nets[i].wakenet;
+        }
+    }
+    return NULL;
+}
+
+// NULL if the partition holds no WakeNet image
+static const esp_wn_iface_t *sr_wn_partition_net(const char *label)
+{
+    char tag[DL_COEF_TAG_LEN];
+
+    if (dl_coef_partition_read_tag(label, tag, sizeof(tag)) != ESP_OK) {
+        return NULL;
+    }
+    return sr_wn_net_of_tag(tag);
+}
+
+const model_coeff_getter_t *sr_wakenet_coeff(const esp_wn_iface_t *wakenet, const model_coeff_getter_t *builtin)
+{
+#ifdef CONFIG_SR_MODEL_FROM_PARTITION
+    const model_coeff_getter_t *coeff = NULL;
+    const model_coeff_getter_t *recorder;
+    char tag[DL_COEF_TAG_LEN];
+    esp_err_t err = dl_coef_partition_read_tag(SR_WN_PARTITION, tag, sizeof(tag));
+
+    if (err == ESP_OK && sr_wn_net_of_tag(tag) == wakenet) {
+        coeff = dl_coef_partition_getter(SR_WN_PARTITION);
+    } else if (err == ESP_OK) {
+        // an image for another net, flashed on purpose, keep it
+        printf("%s holds %s\n", SR_WN_PARTITION, tag);
+    } else if (dl_coef_partition_record_begin(SR_WN_PARTITION, builtin, &recorder) == ESP_OK) {
+        // create() fetches every coefficient the model uses
+        model_iface_data_t *model = wakenet->create(recorder, DET_MODE_90);
+        if (model) {
+            snprintf(tag, sizeof(tag), "%s:%s", sr_wn_net_name(wakenet), wakenet->get_word_name(model, 1));
+            dl_coef_partition_record_tag(tag);
+            wakenet->destroy(model);
+        }
+        if (dl_coef_partition_record_end() == ESP_OK) {
+            coeff = dl_coef_partition_getter(SR_WN_PARTITION);
+        }
+    }
+    if (coeff) {
+        return coeff;
+    }
+    printf("WakeNet uses the compiled-in coefficients\n");
+#endif
+    return builtin;
+}
+
+static void sr_nvs_get_wakenet(char *label, size_t len)
+{
+    nvs_handle_t nvs;
+    esp_err_t err = nvs_flash_init();
+
+    // already up is fine, anything else and the default partition is used
+    if (err == ESP_OK && nvs_open(SR_NVS_NAMESPACE, NVS_READONLY, &nvs) == ESP_OK) {
+        err = nvs_get_str(nvs, SR_NVS_WAKENET, label, &len);
+        nvs_close(nvs);
+        if (err == ESP_OK) {
+            return;
+        }
+    }
+    strcpy(label, SR_WN_PARTITION);
+}
+
+const esp_wn_iface_t *sr_wakenet_select(const model_coeff_getter_t **coeff)
+{
+#ifdef CONFIG_SR_MODEL_FROM_PARTITION
+    char label[sizeof(((esp_partition_t *)0)->label)];
+    sr_nvs_get_wakenet(label, sizeof(label));
+
+    const esp_wn_iface_t *wakenet = sr_wn_partition_net(label);
+    if (wakenet && (*coeff = dl_coef_partition_getter(label)) != NULL) {
+        printf("WakeNet from %s\n", label);
+        return wakenet;
+    }
+    printf("No WakeNet image in %s\n", label);
+#endif
+#if !defined(CONFIG_SR_MODEL_FROM_PARTITION) || defined(CONFIG_SR_WN_BUILTIN)
+    *coeff = sr_wakenet_coeff(&WAKENET_MODEL, &WAKENET_COEFF);
+    return &WAKENET_MODEL;
+#else
+    return NULL;
+#endif
+}
+
+esp_err_t sr_wakenet_use(const char *label)
+{
+    nvs_handle_t nvs;
+    esp_err_t err;
+
+    if (sr_wn_partition_net(label) == NULL) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    err = nvs_flash_init();
+    if (err != ESP_OK) {
+        return err;
+    }
+    err = nvs_open(SR_NVS_NAMESPACE, NVS_READWRITE, &nvs);
+    if (err != ESP_OK) {
+        return err;
+    }
+    err = nvs_set_str(nvs, SR_NVS_WAKENET, label);
+    if (err == ESP_OK) {
+        err = nvs_commit(nvs);
+    }
+    nvs_close(nvs);
+    return err;
+}
+
+void sr_wakenet_list()
+{
+    esp_partition_iterator_t it = esp_partition_find(ESP_PARTITION_TYPE_DATA, SR_MODEL_SUBTYPE, NULL);
+    char tag[DL_COEF_TAG_LEN];
+
+    for (; it; it = esp_partition_next(it)) {
+        const esp_partition_t *part = esp_partition_get(it);
+        if (dl_coef_partition_read_tag(part->label, tag, sizeof(tag)) == ESP_OK && sr_wn_net_of_tag(tag)) {
+            printf("%s: %s\n", part->label, tag);
+        }
+    }
+    esp_partition_iterator_release(it);
+}
+
+const model_coeff_getter_t *sr_multinet_coeff(const esp_mn_iface_t *multinet, const model_coeff_getter_t *builtin)
+{
+#ifdef CONFIG_SR_MODEL_FROM_PARTITION
+    const model_coeff_getter_t *coeff = dl_coef_partition_getter(SR_MN_PARTITION);
+    const model_coeff_getter_t *recorder;
+    if (coeff == NULL && dl_coef_partition_record_begin(SR_MN_PARTITION, builtin, &recorder) == ESP_OK) {
+        model_iface_data_t *model = multinet->create(recorder, SR_MN_RECORD_MS);
+        if (model) {
+            multinet->destroy(model);
+        }
+        if (dl_coef_partition_record_end() == ESP_OK) {
+            coeff = dl_coef_partition_getter(SR_MN_PARTITION);
+        }
+    }
+    if (coeff) {
+        return coeff;
+    }
+    printf("MultiNet uses the compiled-in coefficients\n");
+#endif
+    return builtin;
+}
+
+void sr_model_create_begin()
+{
+#ifdef CONFIG_SR_MODEL_PSRAM_LIMIT
+    dl_coef_placement_begin(CONFIG_SR_MODEL_PSRAM_LIMIT);
+#endif
+}
+
+void sr_model_create_end()
+{
+#ifdef CONFIG_SR_MODEL_PSRAM_LIMIT
+    dl_coef_placement_end();
+#endif
+}
+
+dl_arena_t *sr_model_arena_create()
+{
+#ifdef CONFIG_SR_DL_ARENA
+    dl_arena_t *arena = dl_arena_create(CONFIG_SR_DL_ARENA_SIZE, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (arena == NULL) {
+        printf("No memory for a %d bytes model arena, detect() uses the heap\n", CONFIG_SR_DL_ARENA_SIZE);
+    }
+    return arena;
+#else
+    return NULL;
+#endif
+}
+
+int sr_model_detect_batch(int (*detect)(model_iface_data_t *, int16_t *), model_iface_data_t *model,
+                          dl_arena_t *arena, int16_t *chunks, int n, int chunksize, int *results)
+{
+    int first = -1;
+
+    dl_arena_begin(arena);
+    for (int i = 0; i < n; i++) {
+        int r = detect(model, chunks + i * chunksize);
+        dl_arena_next(arena);
+        if (results) {
+            results[i] = r;
+        }
+        if (r && first < 0) {
+            first = i;
+        }
+    }
+    dl_arena_end(arena);
+    return first;
+}
@@ -0,0 +1,128 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "esp_system.h"
+
+#include "sr_benchmark.h"
+#include "dl_lib_dotq.h"
+#include "ubench.h"
+
+#define SR_UBENCH_LEN   512     // a wide layer of the models
+#define SR_UBENCH_OUT   128     // outputs of the dense layer case
+
+typedef struct {
+    qtp_t *a;
+    qtp_t *b;
+    qtp_t *res;
+    dl_matrix2dq_t *in;
+    dl_matrix2dq_t *w;
+    dl_matrix2dq_t *out;
+} sr_ubench_t;
+
+static volatile int64_t sr_ubench_sink;    // keeps the dot products from being optimized away
+
+static void sr_ubench_fill(qtp_t *v, int len)
+{
+    for (int i = 0; i < len; i++) {
+        v[i] = esp_random();
+    }
+}
+
+static void sr_ubench_teardown(void *ctx)
+{
+    sr_ubench_t *s = (sr_ubench_t *)ctx;
+    free(s->a);
+    if (s->in) {
+        dl_matrixq_free(s->in);
+    }
+    if (s->w) {
+        dl_matrixq_free(s->w);
+    }
+    if (s->out) {
+        dl_matrixq_free(s->out);
+    }
+    free(s);
+}
+
+static int sr_ubench_vec_setup(void **ctx)
+{
+    sr_ubench_t *s = calloc(1, sizeof(sr_ubench_t));
+    if (s == NULL) {
+        return -1;
+    }
+    s->a = malloc(3 * SR_UBENCH_LEN * sizeof(qtp_t));
+    if (s->a == NULL) {
+        free(s);
+        return -1;
+    }
+    s->b = s->a + SR_UBENCH_LEN;
+    s->res = s->b + SR_UBENCH_LEN;
+    sr_ubench_fill(s->a, 2 * SR_UBENCH_LEN);
+    *ctx = s;
+    return 0;
+}
+
+static int sr_ubench_dense_setup(void **ctx)
+{
+    sr_ubench_t *s = calloc(1, sizeof(sr_ubench_t));
+    if (s == NULL) {
+        return -1;
+    }
+    s->in = dl_matrixq_alloc(SR_UBENCH_LEN, 1);
+    s->w = dl_matrixq_alloc(SR_UBENCH_OUT, SR_UBENCH_LEN);
+    s->out = dl_matrixq_alloc(SR_UBENCH_OUT, 1);
+    if (s->in == NULL || s->w == NULL || s->out == NULL) {
+        sr_ubench_teardown(s);
+        return -1;
+    }
+    sr_ubench_fill(s->in->itemq, SR_UBENCH_LEN);
+    sr_ubench_fill(s->w->itemq, SR_UBENCH_OUT * SR_UBENCH_LEN);
+    s->in->exponent = s->w->exponent = -15;
+    *ctx = s;
+    return 0;
+}
+
+static void sr_ubench_dotq(void *ctx)
+{
+    sr_ubench_t *s = (sr_ubench_t *)ctx;
+    sr_ubench_sink = dl_dotq(s->a, s->b, SR_UBENCH_LEN);
+}
+
+static void sr_ubench_dotq_c(void *ctx)
+{
+    sr_ubench_t *s = (sr_ubench_t *)ctx;
+    sr_ubench_sink = dl_dotq_c_impl(s->a, s->b, SR_UBENCH_LEN);
+}
+
+static void sr_ubench_addq(void *ctx)
+{
+    sr_ubench_t *s = (sr_ubench_t *)ctx;
+    dl_addq(s->a, s->b, s->res, SR_UBENCH_LEN, 1);
+}
+
+static void sr_ubench_matrixq_dot(void *ctx)
+{
+    sr_ubench_t *s = (sr_ubench_t *)ctx;
+    dl_matrixq_dot(s->in, s->w, s->out, 0);
+}
+
+// bytes: the inputs each iteration reads
+UBENCH_CASE(dl_dotq_512, .setup = sr_ubench_vec_setup, .run = sr_ubench_dotq, .teardown = sr_ubench_teardown,
+            .bytes = 2 * SR_UBENCH_LEN * sizeof(qtp_t), .mode = UBENCH_NO_IRQ);
+UBENCH_CASE(dl_dotq_c_512, .setup = sr_ubench_vec_setup, .run = sr_ubench_dotq_c, .teardown = sr_ubench_teardown,
+            .bytes = 2 * SR_UBENCH_LEN * sizeof(qtp_t), .mode = UBENCH_NO_IRQ);
+UBENCH_CASE(dl_addq_512, .setup = sr_ubench_vec_setup, .run = sr_ubench_addq, .teardown = sr_ubench_teardown,
+            .bytes = 2 * SR_UBENCH_LEN * sizeof(qtp_t), .mode = UBENCH_NO_IRQ);
+UBENCH_CASE(dl_matrixq_dot_512x128, .setup = sr_ubench_dense_setup, .run = sr_ubench_matrixq_dot,
+            .teardown = sr_ubench_teardown, .bytes = (SR_UBENCH_OUT + 1) * SR_UBENCH_LEN * sizeof(qtp_t),
+            .mode = UBENCH_NO_IRQ, .iterations = 16);
+
+void sr_ubench_run()
+{
+    ubench_register_mem();
+    UBENCH_REGISTER(dl_dotq_512);
+    UBENCH_REGISTER(dl_dotq_c_512);
+    UBENCH_REGISTER(dl_addq_512);
+    UBENCH_REGISTER(dl_matrixq_dot_512x128);
+    ubench_config_t config = UBENCH_DEFAULT_CONFIG();
+    ubench_run(&config);
+}
@@ -5,42 +5,120 @@
 
 #include "esp_wn_iface.h"
 #include "esp_wn_models.h"
+#include "esp_vad.h"
 #include "dl_lib_coefgetter_if.h"
 #include "wakenet_test.h"
-#include "hilexin.h"
+#include "sr_corpus.h"
+#include "sr_models.h"
 #include <sys/time.h>
+#include "sdkconfig.h"
 
-static const esp_wn_iface_t *wakenet = &WAKENET_MODEL;
-static const model_coeff_getter_t *model_coeff_getter = &WAKENET_COEFF;
+static const esp_wn_iface_t *wakenet;
 
+#ifdef CONFIG_SR_WN_VAD_GATE
+#define WN_PREROLL_CHUNKS   CONFIG_SR_WN_VAD_PREROLL_CHUNKS
+#define WN_HANGOVER_CHUNKS  CONFIG_SR_WN_VAD_HANGOVER_CHUNKS
+#else
+#define WN_PREROLL_CHUNKS   0
+#define WN_HANGOVER_CHUNKS  0
+#endif
+
+/*
+ * With CONFIG_SR_WN_VAD_GATE the VAD looks at every chunk and WakeNet only runs while there is speech,
+ * plus WN_HANGOVER_CHUNKS after it, so the tail of the wake word is not cut by a short pause.
+ * The last WN_PREROLL_CHUNKS chunks stay in a ring, on the speech onset WakeNet catches up on them first,
+ * as one batch.
+ */
 void wakenetTask(void *arg)
 {
     model_iface_data_t *model_data = arg;
     int frequency = wakenet->get_samp_rate(model_data);
     int audio_chunksize = wakenet->get_samp_chunksize(model_data);
-    int16_t *buffer = malloc(audio_chunksize * sizeof(int16_t));
-    assert(buffer);
+    int ring_len = WN_PREROLL_CHUNKS + 1;
+    int16_t *ring = malloc(ring_len * audio_chunksize * sizeof(int16_t));
+    assert(ring);
+    int *results = malloc(ring_len * sizeof(int));
+    assert(results);
+    sr_corpus_reader_t *reader = malloc(sizeof(sr_corpus_reader_t));
+    assert(reader);
+    const sr_corpus_clip_t *clip = sr_corpus_find("hilexin");
+    if (clip == NULL) {
+        free(reader);
+        free(results);
+        free(ring);
+        vTaskDelete(NULL);
+    }
+    sr_corpus_reader_init(reader, clip);
+    dl_arena_t *arena = sr_model_arena_create();
+
+    vad_handle_t vad_inst = NULL;
+#ifdef CONFIG_SR_WN_VAD_GATE
+    vad_inst = vad_create(VAD_MODE_3, frequency, audio_chunksize * 1000 / frequency);
+    if (vad_inst == NULL) {
+        printf("VAD does not support %d samples chunks, WakeNet runs on every chunk\n", audio_chunksize);
+    }
+#endif
 
     int chunks = 0;
+    int detected = 0;           // chunks WakeNet has seen
+    int pending = 0;            // chunks in the ring WakeNet has not seen yet
+    int hangover = 0;
     struct timeval tv_start, tv_end;
     gettimeofday(&tv_start, NULL);
     while (1) {
-        if ((chunks + 1)*audio_chunksize * sizeof(int16_t) <= sizeof(hilexin)) {
-            memcpy(buffer, hilexin + chunks * audio_chunksize * sizeof(int16_t), audio_chunksize * sizeof(int16_t));
-        } else {
+        int16_t *buffer = ring + (chunks % ring_len) * audio_chunksize;
+        if (sr_corpus_reader_read(reader, buffer, audio_chunksize) != audio_chunksize) {
             break;
         }
-        int r = wakenet->detect(model_data, buffer);
-        if (r) {
-            int ms = (chunks * audio_chunksize * 1000) / frequency;
-            printf("WN test successfully, %.2f: Neural network detection triggered output %d.\n", (float)ms / 1000.0, r);
+        if (vad_inst) {
+            if (vad_process(vad_inst, buffer) == VAD_SPEECH) {
+                hangover = WN_HANGOVER_CHUNKS + 1;
+            }
+            if (hangover == 0) {
+                if (pending < WN_PREROLL_CHUNKS) {
+                    pending++;
+                }
+                chunks++;
+                continue;
+            }
+            hangover--;
         }
+        // oldest first, the current chunk is the last one, in at most two batches where the ring wraps
+        for (int c = chunks - pending; c <= chunks;) {
+            int slot = c % ring_len;
+            int n = chunks + 1 - c < ring_len - slot ? chunks + 1 - c : ring_len - slot;
+            if (sr_model_detect_batch(wakenet->detect, model_data, arena, ring + slot * audio_chunksize,
+                                      n, audio_chunksize, results) >= 0) {
+                for (int i = 0; i < n; i++) {
+                    if (results[i]) {
+                        int ms = ((c + i) * audio_chunksize * 1000) / frequency;
+                        printf("WN test successfully, %.2f: Neural network detection triggered output %d.\n", (float)ms / 1000.0, results[i]);
+                    }
+                }
+            }
+            detected += n;
+            c += n;
+        }
+        pending = 0;
         chunks++;
     }
     gettimeofday(&tv_end, NULL);
     int tv_ms=(tv_end.tv_sec-tv_start.tv_sec)*1000+(tv_end.tv_usec-tv_start.tv_usec)/1000;
+    int audio_ms = (int)((int64_t)chunks * audio_chunksize * 1000 / frequency);
     printf("Done! Took %d ms to parse %d ms worth of samples in %d iterations. CPU loading(single core):%.1f%%\n", 
-            tv_ms, chunks*30, chunks, tv_ms*1.0/chunks/3*10);
+            tv_ms, audio_ms, chunks, tv_ms * 100.0 / audio_ms);
+    if (vad_inst) {
+        printf("VAD gate: WakeNet ran on %d of %d chunks\n", detected, chunks);
+        vad_destroy(vad_inst);
+    }
+    if (arena) {
+        printf("Model arena: %d bytes high water, %d allocations went to the heap\n",
+               (int)dl_arena_high_water(arena), dl_arena_overflows(arena));
+        dl_arena_destroy(arena);
+    }
+    free(reader);
+    free(results);
+    free(ring);
     printf("TEST1 FINISHED\n\n");
     vTaskDelete(NULL);
 }
@@ -51,7 +129,15 @@ void wakenet_test()
     printf("Start free RAM size: %d\n", start_size);
 
     //Initialize wakenet model
+    const model_coeff_getter_t *model_coeff_getter;
+    wakenet = sr_wakenet_select(&model_coeff_getter);
+    if (wakenet == NULL) {
+        printf("No WakeNet in the model partitions\n");
+        return;
+    }
+    sr_model_create_begin();
     model_iface_data_t *model_data = wakenet->create(model_coeff_getter, DET_MODE_90);
+    sr_model_create_end();
     printf("WakeNet RAM size: %d\nRAM size after WakeNet init: %d\n",
            start_size - heap_caps_get_free_size(MALLOC_CAP_8BIT), heap_caps_get_free_size(MALLOC_CAP_8BIT));
 
@@ -1,4 +1,8 @@
+#pragma once
+#include "esp_err.h"
+
 #define SPEECH_COMMANDS_NUM CONFIG_SPEECH_COMMANDS_NUM
+#define MN_COMMAND_ID_MAX   100
 #define MN_SPEECH_COMMAND_ID0   CONFIG_SPEECH_COMMAND_ID0
 #define MN_SPEECH_COMMAND_ID1   CONFIG_SPEECH_COMMAND_ID1
 #define MN_SPEECH_COMMAND_ID2   CONFIG_SPEECH_COMMAND_ID2
@@ -100,4 +104,23 @@
 #define MN_SPEECH_COMMAND_ID98   CONFIG_SPEECH_COMMAND_ID98
 #define MN_SPEECH_COMMAND_ID99   CONFIG_SPEECH_COMMAND_ID99
 
-char *get_id_name(int i);
\ No newline at end of file
+char *get_id_name(int i);
+
+/*
+ * The command table MultiNet reads when it is created, the menuconfig commands until changed below.
+ * A change takes effect on the next create(), sr_engine_update_commands() re-creates MultiNet alone.
+ * Not thread safe, change it from the task that runs the model.
+ */
+
+/**
+ * @brief Add a command or replace its phrases.
+ *
+ * @param command_id  0~99, the id detect() returns for it
+ * @param phrases     Pinyin syllables separated by spaces, several phrases separated by ','. Copied.
+ */
+esp_err_t mn_commands_set(int command_id, const char *phrases);
+
+esp_err_t mn_commands_remove(int command_id);
+
+// Back to the menuconfig commands
+void mn_commands_reset();
@@ -0,0 +1,80 @@
+#pragma once
+#include "stdint.h"
+#include "esp_wn_iface.h"
+#include "esp_mn_iface.h"
+
+/*
+ * One mic stream through WakeNet and MultiNet.
+ * WakeNet runs until it triggers, MultiNet then takes over on the same audio ring,
+ * starting right after the chunk that woke it, and stops on the first command or when the window is over.
+ * Up to SR_ENGINE_MAX_WAKENET WakeNets can listen for different wake words, they all run on the same chunk
+ * of the ring and share the arena. Each keeps the feature front-end of its library, which has no entry to
+ * take features computed elsewhere, so it costs a full WakeNet per model.
+ */
+
+#define SR_ENGINE_MAX_WAKENET   3
+
+typedef enum {
+    SR_EVENT_NONE = 0,      // nothing yet, keep feeding
+    SR_EVENT_WAKEUP,        // result: the wake word index, MultiNet listens from now on
+    SR_EVENT_COMMAND,       // result: the command id, back to WakeNet
+    SR_EVENT_TIMEOUT,       // no command in the window, back to WakeNet
+} sr_event_t;
+
+typedef struct {
+    const esp_wn_iface_t *wakenet;
+    const model_coeff_getter_t *coeff;
+} sr_wakenet_t;
+
+typedef struct {
+    const esp_wn_iface_t *wakenet;
+    const model_coeff_getter_t *wakenet_coeff;
+    det_mode_t det_mode;
+    const sr_wakenet_t *extra_wakenets;     // more wake words, same chunk size and sample rate; can be NULL
+    int extra_wakenet_num;
+    const esp_mn_iface_t *multinet;
+    const model_coeff_getter_t *multinet_coeff;
+    int command_window_ms;      // the longest a command may take, 0~6000
+} sr_engine_config_t;
+
+typedef struct sr_engine *sr_engine_handle_t;
+
+/**
+ * @brief Create both models and the audio ring they share.
+ *
+ * @return NULL on failure
+ */
+sr_engine_handle_t sr_engine_create(const sr_engine_config_t *config);
+
+/**
+ * @brief Samples per sr_engine_feed, from the WakeNet chunk size.
+ */
+int sr_engine_get_chunksize(sr_engine_handle_t engine);
+
+/**
+ * @brief The ring slot of the next chunk, read the mic straight into it and call sr_engine_feed.
+ */
+int16_t *sr_engine_get_buffer(sr_engine_handle_t engine);
+
+/**
+ * @brief Run the active model over the chunk written to sr_engine_get_buffer.
+ *
+ * @param result The wake word index or the command id, depending on the event; can be NULL
+ */
+sr_event_t sr_engine_feed(sr_engine_handle_t engine, int *result);
+
+/**
+ * @brief The WakeNet of the last SR_EVENT_WAKEUP, 0 for wakenet of the config, 1.. for extra_wakenets.
+ */
+int sr_engine_get_wake_model(sr_engine_handle_t engine);
+
+/**
+ * @brief Apply the command table of mn_process_commands.h, WakeNet and the audio ring are kept.
+ *        MultiNet is created again beside the old instance, which is dropped once the new one is up.
+ *
+ * @return ESP_ERR_INVALID_STATE while MultiNet listens for a command, call it again after the event;
+ *         ESP_ERR_NO_MEM and the old commands stay.
+ */
+esp_err_t sr_engine_update_commands(sr_engine_handle_t engine);
+
+void sr_engine_destroy(sr_engine_handle_t engine);
@@ -1,10 +1,21 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <stdint.h>
 #include "sdkconfig.h"
 #include "mn_process_commands.h"
 
-char *get_id_name(int i)
+typedef enum {
+    MN_COMMAND_DEFAULT = 0,     // the menuconfig phrase
+    MN_COMMAND_SET,
+    MN_COMMAND_REMOVED,
+} mn_command_state_t;
+
+// Commands set at run time, on top of the menuconfig ones
+static char *s_phrase[MN_COMMAND_ID_MAX];
+static uint8_t s_state[MN_COMMAND_ID_MAX];
+
+static char *get_default_id_name(int i)
 {
     if (i == 0)
         return MN_SPEECH_COMMAND_ID0;
@@ -210,3 +221,51 @@ char *get_id_name(int i)
         return NULL;
 }
 
+char *get_id_name(int i)
+{
+    if (i < 0 || i >= MN_COMMAND_ID_MAX) {
+        return NULL;
+    }
+    if (s_state[i] == MN_COMMAND_SET) {
+        return s_phrase[i];
+    }
+    if (s_state[i] == MN_COMMAND_REMOVED) {
+        return NULL;
+    }
+    return get_default_id_name(i);
+}
+
+esp_err_t mn_commands_set(int command_id, const char *phrases)
+{
+    if (command_id < 0 || command_id >= MN_COMMAND_ID_MAX || phrases == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    char *copy = strdup(phrases);
+    if (copy == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    free(s_phrase[command_id]);
+    s_phrase[command_id] = copy;
+    s_state[command_id] = MN_COMMAND_SET;
+    return ESP_OK;
+}
+
+esp_err_t mn_commands_remove(int command_id)
+{
+    if (command_id < 0 || command_id >= MN_COMMAND_ID_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    free(s_phrase[command_id]);
+    s_phrase[command_id] = NULL;
+    s_state[command_id] = MN_COMMAND_REMOVED;
+    return ESP_OK;
+}
+
+void mn_commands_reset()
+{
+    for (int i = 0; i < MN_COMMAND_ID_MAX; i++) {
+        free(s_phrase[i]);
+        s_phrase[i] = NULL;
+        s_state[i] = MN_COMMAND_DEFAULT;
+    }
+}
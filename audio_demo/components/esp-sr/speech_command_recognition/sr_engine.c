@@ -0,0 +1,206 @@
+#include <stdlib.h>
+#include <string.h>
+#include "sdkconfig.h"
+#include "esp_heap_caps.h"
+#include "dl_lib_arena.h"
+#include "sr_engine.h"
+#include "trace.h"
+
+/*
+ * The ring holds whole WakeNet chunks, so the write slot is always contiguous, and has room for one
+ * MultiNet chunk on top, the most MultiNet can leave unread. Positions count samples from the start.
+ */
+struct sr_engine {
+    const esp_wn_iface_t *wakenet[SR_ENGINE_MAX_WAKENET];
+    const esp_mn_iface_t *multinet;
+    model_iface_data_t *wn_data[SR_ENGINE_MAX_WAKENET];
+    int wn_num;
+    int wn_woke;                // the WakeNet of the last wakeup
+    model_iface_data_t *mn_data;
+    const model_coeff_getter_t *mn_coeff;
+    int command_window_ms;
+    int wn_chunksize;
+    int mn_chunksize;
+    int mn_chunknum;
+    int ring_size;
+    uint32_t written;
+    uint32_t mn_read;
+    int mn_chunks;
+    int listening;
+    int16_t *mn_scratch;        // a MultiNet chunk that wraps around the ring end
+    int16_t *ring;
+    dl_arena_t *arena;          // only one model runs per feed, they share it
+};
+
+sr_engine_handle_t sr_engine_create(const sr_engine_config_t *config)
+{
+    struct sr_engine *engine = calloc(1, sizeof(struct sr_engine));
+    if (engine == NULL) {
+        return NULL;
+    }
+    if (config->extra_wakenet_num < 0 || config->extra_wakenet_num >= SR_ENGINE_MAX_WAKENET) {
+        goto err;
+    }
+    engine->multinet = config->multinet;
+    engine->mn_coeff = config->multinet_coeff;
+    engine->command_window_ms = config->command_window_ms;
+    engine->wakenet[0] = config->wakenet;
+    engine->wn_data[0] = config->wakenet->create(config->wakenet_coeff, config->det_mode);
+    engine->wn_num = 1;
+    if (engine->wn_data[0] == NULL) {
+        goto err;
+    }
+    engine->wn_chunksize = engine->wakenet[0]->get_samp_chunksize(engine->wn_data[0]);
+    for (int i = 0; i < config->extra_wakenet_num; i++) {
+        const sr_wakenet_t *wn = &config->extra_wakenets[i];
+        engine->wakenet[i + 1] = wn->wakenet;
+        engine->wn_data[i + 1] = wn->wakenet->create(wn->coeff, config->det_mode);
+        if (engine->wn_data[i + 1] == NULL) {
+            goto err;
+        }
+        engine->wn_num++;
+        // they all take the same chunk of the ring
+        if (wn->wakenet->get_samp_chunksize(engine->wn_data[i + 1]) != engine->wn_chunksize
+                || wn->wakenet->get_samp_rate(engine->wn_data[i + 1]) != engine->wakenet[0]->get_samp_rate(engine->wn_data[0])) {
+            goto err;
+        }
+    }
+    engine->mn_data = config->multinet->create(config->multinet_coeff, config->command_window_ms);
+    if (engine->mn_data == NULL) {
+        goto err;
+    }
+    engine->mn_chunksize = engine->multinet->get_samp_chunksize(engine->mn_data);
+    engine->mn_chunknum = engine->multinet->get_samp_chunknum(engine->mn_data);
+    engine->ring_size = engine->wn_chunksize * (1 + (engine->mn_chunksize + engine->wn_chunksize - 1) / engine->wn_chunksize);
+    engine->ring = malloc(engine->ring_size * sizeof(int16_t));
+    engine->mn_scratch = malloc(engine->mn_chunksize * sizeof(int16_t));
+    if (engine->ring == NULL || engine->mn_scratch == NULL) {
+        goto err;
+    }
+#ifdef CONFIG_SR_DL_ARENA
+    // without it detect() allocates from the heap as before
+    engine->arena = dl_arena_create(CONFIG_SR_DL_ARENA_SIZE, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+#endif
+    return engine;
+
+err:
+    sr_engine_destroy(engine);
+    return NULL;
+}
+
+int sr_engine_get_chunksize(sr_engine_handle_t engine)
+{
+    return engine->wn_chunksize;
+}
+
+int16_t *sr_engine_get_buffer(sr_engine_handle_t engine)
+{
+    return engine->ring + engine->written % engine->ring_size;
+}
+
+static int16_t *sr_engine_mn_chunk(struct sr_engine *engine)
+{
+    int pos = engine->mn_read % engine->ring_size;
+    int tail = engine->ring_size - pos;
+
+    if (tail >= engine->mn_chunksize) {
+        return engine->ring + pos;
+    }
+    memcpy(engine->mn_scratch, engine->ring + pos, tail * sizeof(int16_t));
+    memcpy(engine->mn_scratch + tail, engine->ring, (engine->mn_chunksize - tail) * sizeof(int16_t));
+    return engine->mn_scratch;
+}
+
+sr_event_t sr_engine_feed(sr_engine_handle_t engine, int *result)
+{
+    int16_t *chunk = sr_engine_get_buffer(engine);
+    engine->written += engine->wn_chunksize;
+
+    if (!engine->listening) {
+        int r = 0;
+        // every WakeNet sees every chunk, so each keeps its own history whichever woke up last
+        TRACE_BEGIN("wakenet");
+        for (int i = 0; i < engine->wn_num; i++) {
+            dl_arena_begin(engine->arena);
+            int w = engine->wakenet[i]->detect(engine->wn_data[i], chunk);
+            dl_arena_end(engine->arena);
+            if (w && r == 0) {
+                r = w;
+                engine->wn_woke = i;
+            }
+        }
+        TRACE_END("wakenet");
+        if (r == 0) {
+            return SR_EVENT_NONE;
+        }
+        // the command starts with the next chunk
+        engine->listening = 1;
+        engine->mn_read = engine->written;
+        engine->mn_chunks = 0;
+        if (result) {
+            *result = r;
+        }
+        return SR_EVENT_WAKEUP;
+    }
+
+    while (engine->written - engine->mn_read >= engine->mn_chunksize) {
+        TRACE_BEGIN("multinet");
+        dl_arena_begin(engine->arena);
+        int command_id = engine->multinet->detect(engine->mn_data, sr_engine_mn_chunk(engine));
+        dl_arena_end(engine->arena);
+        TRACE_END("multinet");
+        engine->mn_read += engine->mn_chunksize;
+        engine->mn_chunks++;
+        if (command_id > -1) {
+            engine->listening = 0;
+            if (result) {
+                *result = command_id;
+            }
+            return SR_EVENT_COMMAND;
+        }
+        if (engine->mn_chunks >= engine->mn_chunknum) {
+            engine->listening = 0;
+            return SR_EVENT_TIMEOUT;
+        }
+    }
+    return SR_EVENT_NONE;
+}
+
+int sr_engine_get_wake_model(sr_engine_handle_t engine)
+{
+    return engine->wn_woke;
+}
+
+esp_err_t sr_engine_update_commands(sr_engine_handle_t engine)
+{
+    if (engine->listening) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    // the new instance first, so a failure leaves the old command set working
+    model_iface_data_t *mn_data = engine->multinet->create(engine->mn_coeff, engine->command_window_ms);
+    if (mn_data == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    engine->multinet->destroy(engine->mn_data);
+    engine->mn_data = mn_data;
+    return ESP_OK;
+}
+
+void sr_engine_destroy(sr_engine_handle_t engine)
+{
+    if (engine == NULL) {
+        return;
+    }
+    for (int i = 0; i < engine->wn_num; i++) {
+        if (engine->wn_data[i]) {
+            engine->wakenet[i]->destroy(engine->wn_data[i]);
+        }
+    }
+    if (engine->mn_data) {
+        engine->multinet->destroy(engine->mn_data);
+    }
+    dl_arena_destroy(engine->arena);
+    free(engine->mn_scratch);
+    free(engine->ring);
+    free(engine);
+}
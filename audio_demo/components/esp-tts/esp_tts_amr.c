@@ -0,0 +1,177 @@
+// Copyright 2015-2019 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License
+#include <stdlib.h>
+#include <string.h>
+#include "esp_log.h"
+#include "esp_tts_amr.h"
+
+static const char *TAG = "TTS_AMR";
+
+#define AMR_MAGIC       "#!AMR\n"
+#define AMR_MAGIC_LEN   6
+#define AMR_WB_MAGIC    "#!AMR-WB\n"
+#define AMR_WB_MAGIC_LEN 9
+
+/* From WmfDecBytesPerFrame in dec_input_format_tab.cpp, speech bytes after the header, by frame type */
+static const uint8_t amr_frame_bytes[16] = { 12, 13, 15, 17, 19, 20, 26, 31, 5, 6, 5, 5, 0, 0, 0, 0 };
+/* The AMR-WB modes of 3GPP TS 26.201, 6.60 to 23.85 kbit/s and SID */
+static const uint8_t amr_wb_frame_bytes[16] = { 17, 23, 32, 36, 40, 46, 50, 58, 60, 5, 0, 0, 0, 0, 0, 0 };
+
+struct esp_tts_amr {
+    const esp_tts_amr_decoder_t *decoder;
+    void *dec;
+    esp_tts_amr_read_t read;
+    void *ctx;
+    const uint8_t *mem;             // the memory source, read is not used then
+    int mem_size;
+    int mem_pos;
+    const uint8_t *frame_bytes;     // amr_frame_bytes or amr_wb_frame_bytes
+    int frame_samples;
+    int pcm_pos;                    // samples of pcm handed out already
+    int pcm_len;
+    int16_t pcm[ESP_TTS_AMR_WB_FRAME_SAMPLES];
+    uint8_t frame[ESP_TTS_AMR_WB_FRAME_MAX];
+};
+
+static int tts_amr_source(esp_tts_amr_t *amr, uint8_t *buf, int len)
+{
+    if (amr->mem == NULL) {
+        return amr->read(amr->ctx, buf, len);
+    }
+    int n = amr->mem_size - amr->mem_pos;
+    if (n > len) {
+        n = len;
+    }
+    memcpy(buf, amr->mem + amr->mem_pos, n);
+    amr->mem_pos += n;
+    return n;
+}
+
+static esp_tts_amr_t *tts_amr_start(esp_tts_amr_t *amr)
+{
+    uint8_t magic[AMR_WB_MAGIC_LEN];
+
+    if (tts_amr_source(amr, magic, AMR_MAGIC_LEN) != AMR_MAGIC_LEN) {
+        magic[0] = 0;
+    }
+    if (memcmp(magic, AMR_MAGIC, AMR_MAGIC_LEN) == 0) {
+        amr->frame_bytes = amr_frame_bytes;
+        amr->frame_samples = ESP_TTS_AMR_FRAME_SAMPLES;
+    } else if (memcmp(magic, AMR_WB_MAGIC, AMR_MAGIC_LEN) == 0 &&
+               tts_amr_source(amr, magic + AMR_MAGIC_LEN, AMR_WB_MAGIC_LEN - AMR_MAGIC_LEN) == AMR_WB_MAGIC_LEN - AMR_MAGIC_LEN &&
+               memcmp(magic, AMR_WB_MAGIC, AMR_WB_MAGIC_LEN) == 0) {
+        amr->frame_bytes = amr_wb_frame_bytes;
+        amr->frame_samples = ESP_TTS_AMR_WB_FRAME_SAMPLES;
+    } else {
+        ESP_LOGE(TAG, "not an AMR stream");
+        free(amr);
+        return NULL;
+    }
+    amr->dec = amr->decoder->open();
+    if (amr->dec == NULL) {
+        free(amr);
+        return NULL;
+    }
+    return amr;
+}
+
+esp_tts_amr_t *esp_tts_amr_open(const esp_tts_amr_decoder_t *decoder, esp_tts_amr_read_t read, void *ctx)
+{
+    esp_tts_amr_t *amr = calloc(1, sizeof(esp_tts_amr_t));
+    if (amr == NULL) {
+        return NULL;
+    }
+    amr->decoder = decoder;
+    amr->read = read;
+    amr->ctx = ctx;
+    return tts_amr_start(amr);
+}
+
+esp_tts_amr_t *esp_tts_amr_open_mem(const esp_tts_amr_decoder_t *decoder, const uint8_t *data, int size)
+{
+    esp_tts_amr_t *amr = calloc(1, sizeof(esp_tts_amr_t));
+    if (amr == NULL) {
+        return NULL;
+    }
+    amr->decoder = decoder;
+    amr->mem = data;
+    amr->mem_size = size;
+    return tts_amr_start(amr);
+}
+
+// one frame into pcm, 0 at the end of the stream or on a truncated frame
+static int tts_amr_decode_frame(esp_tts_amr_t *amr)
+{
+    // the padding bit is 0 in every header, erased flash behind a prompt in a partition ends it
+    if (tts_amr_source(amr, amr->frame, 1) != 1 || (amr->frame[0] & 0x80)) {
+        return 0;
+    }
+    int n = amr->frame_bytes[(amr->frame[0] >> 3) & 0x0f];
+    if (n && tts_amr_source(amr, amr->frame + 1, n) != n) {
+        ESP_LOGW(TAG, "truncated frame at the end");
+        return 0;
+    }
+    amr->decoder->decode(amr->dec, amr->frame, amr->pcm);
+    amr->pcm_pos = 0;
+    amr->pcm_len = amr->frame_samples;
+    return amr->frame_samples;
+}
+
+int esp_tts_amr_sample_rate(const esp_tts_amr_t *amr)
+{
+    return amr->frame_samples == ESP_TTS_AMR_WB_FRAME_SAMPLES ? ESP_TTS_AMR_WB_SAMPLE_RATE : ESP_TTS_AMR_SAMPLE_RATE;
+}
+
+int esp_tts_amr_read(esp_tts_amr_t *amr, int16_t *pcm, int samples)
+{
+    int done = 0;
+
+    while (done < samples) {
+        if (amr->pcm_pos == amr->pcm_len && tts_amr_decode_frame(amr) == 0) {
+            break;
+        }
+        int n = amr->pcm_len - amr->pcm_pos;
+        if (n > samples - done) {
+            n = samples - done;
+        }
+        memcpy(pcm + done, amr->pcm + amr->pcm_pos, n * sizeof(int16_t));
+        amr->pcm_pos += n;
+        done += n;
+    }
+    return done;
+}
+
+void esp_tts_amr_close(esp_tts_amr_t *amr)
+{
+    if (amr == NULL) {
+        return;
+    }
+    amr->decoder->close(amr->dec);
+    free(amr);
+}
+
+esp_err_t esp_tts_play_by_amr(const esp_tts_amr_decoder_t *decoder, const uint8_t *data, int size,
+                              esp_tts_sink_t sink, void *ctx)
+{
+    esp_tts_amr_t *amr = esp_tts_amr_open_mem(decoder, data, size);
+    if (amr == NULL) {
+        return ESP_FAIL;
+    }
+    // straight from the frame buffer, no copy
+    while (tts_amr_decode_frame(amr)) {
+        sink(amr->pcm, amr->frame_samples, ctx);
+    }
+    esp_tts_amr_close(amr);
+    return ESP_OK;
+}
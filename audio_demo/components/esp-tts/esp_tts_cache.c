@@ -0,0 +1,126 @@
+// Copyright 2015-2019 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License
+#include <stdlib.h>
+#include <string.h>
+#include "esp_heap_caps.h"
+#include "esp_tts_cache.h"
+
+/*
+ * Entries are a list in use order, most recent first. The text and the PCM are one allocation,
+ * the text follows the samples.
+ */
+typedef struct tts_cache_entry {
+    struct tts_cache_entry *next;
+    const esp_tts_voice_t *voice;
+    unsigned int speed;
+    int samples;
+    int16_t pcm[];
+} tts_cache_entry_t;
+
+typedef struct {
+    tts_cache_entry_t *head;
+    size_t max_bytes;
+    size_t used;
+} tts_cache_t;
+
+static inline const char *tts_cache_text(const tts_cache_entry_t *e)
+{
+    return (const char *)(e->pcm + e->samples);
+}
+
+static void *tts_cache_alloc(size_t size)
+{
+    void *p = heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    return p ? p : malloc(size);
+}
+
+esp_tts_cache_handle_t esp_tts_cache_create(size_t max_bytes)
+{
+    tts_cache_t *cache = calloc(1, sizeof(tts_cache_t));
+    if (cache) {
+        cache->max_bytes = max_bytes;
+    }
+    return cache;
+}
+
+const int16_t *esp_tts_cache_find(esp_tts_cache_handle_t handle, const char *text, const esp_tts_voice_t *voice,
+                                  unsigned int speed, int *samples)
+{
+    tts_cache_t *cache = handle;
+    tts_cache_entry_t **link = &cache->head;
+
+    for (tts_cache_entry_t *e = cache->head; e; link = &e->next, e = e->next) {
+        if (e->voice == voice && e->speed == speed && strcmp(tts_cache_text(e), text) == 0) {
+            *link = e->next;
+            e->next = cache->head;
+            cache->head = e;
+            *samples = e->samples;
+            return e->pcm;
+        }
+    }
+    return NULL;
+}
+
+static void tts_cache_drop_last(tts_cache_t *cache)
+{
+    tts_cache_entry_t **link = &cache->head;
+    while ((*link)->next) {
+        link = &(*link)->next;
+    }
+    cache->used -= (*link)->samples * sizeof(int16_t);
+    free(*link);
+    *link = NULL;
+}
+
+esp_err_t esp_tts_cache_add(esp_tts_cache_handle_t handle, const char *text, const esp_tts_voice_t *voice,
+                            unsigned int speed, const int16_t *pcm, int samples)
+{
+    tts_cache_t *cache = handle;
+    size_t bytes = samples * sizeof(int16_t);
+    size_t text_len = strlen(text) + 1;
+
+    if (bytes > cache->max_bytes) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    while (cache->head && cache->used + bytes > cache->max_bytes) {
+        tts_cache_drop_last(cache);
+    }
+    tts_cache_entry_t *e = tts_cache_alloc(sizeof(tts_cache_entry_t) + bytes + text_len);
+    if (e == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    e->voice = voice;
+    e->speed = speed;
+    e->samples = samples;
+    memcpy(e->pcm, pcm, bytes);
+    memcpy(e->pcm + samples, text, text_len);
+    e->next = cache->head;
+    cache->head = e;
+    cache->used += bytes;
+    return ESP_OK;
+}
+
+void esp_tts_cache_destroy(esp_tts_cache_handle_t handle)
+{
+    tts_cache_t *cache = handle;
+    if (cache == NULL) {
+        return;
+    }
+    while (cache->head) {
+        tts_cache_entry_t *e = cache->head;
+        cache->head = e->next;
+        free(e);
+    }
+    free(cache);
+}
@@ -0,0 +1,164 @@
+// Copyright 2015-2019 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License
+#include <stdlib.h>
+#include <string.h>
+#include "esp_log.h"
+#include "esp_tts_concat.h"
+
+static const char *TAG = "TTS_CONCAT";
+
+#define WAV_FORMAT_PCM  1
+
+static inline uint32_t wav_u32(const uint8_t *p)
+{
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static inline uint16_t wav_u16(const uint8_t *p)
+{
+    return p[0] | (p[1] << 8);
+}
+
+/*
+ * Walk the chunks up to "data" and leave the file there. rate and width are checked against
+ * the first clip when it is set already.
+ */
+static esp_err_t tts_concat_open_clip(esp_tts_concat_t *c, const char *path)
+{
+    uint8_t hdr[16];
+    int rate = 0, width = 0, channels = 0;
+
+    c->fp = fopen(path, "rb");
+    if (c->fp == NULL) {
+        ESP_LOGW(TAG, "%s: cannot open", path);
+        return ESP_FAIL;
+    }
+    if (fread(hdr, 1, 12, c->fp) != 12 || memcmp(hdr, "RIFF", 4) || memcmp(hdr + 8, "WAVE", 4)) {
+        goto bad;
+    }
+    while (fread(hdr, 1, 8, c->fp) == 8) {
+        uint32_t size = wav_u32(hdr + 4);
+        if (memcmp(hdr, "fmt ", 4) == 0 && size >= 16) {
+            if (fread(hdr, 1, 16, c->fp) != 16 || wav_u16(hdr) != WAV_FORMAT_PCM) {
+                goto bad;
+            }
+            channels = wav_u16(hdr + 2);
+            rate = wav_u32(hdr + 4);
+            width = wav_u16(hdr + 14) / 8;
+            size -= 16;
+        } else if (memcmp(hdr, "data", 4) == 0) {
+            if (channels != 1 || (width != 1 && width != 2)) {
+                goto bad;
+            }
+            if (c->sample_rate && (rate != c->sample_rate || width != c->sample_width)) {
+                ESP_LOGW(TAG, "%s: %d Hz %d bit, not like the first clip", path, rate, width * 8);
+                goto skip;
+            }
+            c->sample_rate = rate;
+            c->sample_width = width;
+            c->left = size;
+            return ESP_OK;
+        }
+        // chunks are padded to an even size
+        if (fseek(c->fp, size + (size & 1), SEEK_CUR)) {
+            break;
+        }
+    }
+
+bad:
+    ESP_LOGW(TAG, "%s: not a mono PCM WAV file", path);
+skip:
+    fclose(c->fp);
+    c->fp = NULL;
+    return ESP_FAIL;
+}
+
+static esp_err_t tts_concat_next_clip(esp_tts_concat_t *c)
+{
+    if (c->fp) {
+        fclose(c->fp);
+        c->fp = NULL;
+    }
+    while (++c->index < c->file_num) {
+        if (tts_concat_open_clip(c, c->file_list[c->index]) == ESP_OK) {
+            return ESP_OK;
+        }
+    }
+    return ESP_ERR_NOT_FOUND;
+}
+
+esp_err_t esp_tts_concat_open(esp_tts_concat_t *concat, const char **file_list, int file_num)
+{
+    memset(concat, 0, sizeof(esp_tts_concat_t));
+    concat->file_list = file_list;
+    concat->file_num = file_num;
+    concat->index = -1;
+    return tts_concat_next_clip(concat);
+}
+
+int esp_tts_concat_read(esp_tts_concat_t *concat, int16_t *pcm, int samples)
+{
+    int n = 0;
+
+    while (n < samples && concat->fp) {
+        uint32_t want = (samples - n) * concat->sample_width;
+        want = want < concat->left ? want : concat->left;
+        // 8-bit samples go to the upper half of the buffer and are widened in place below
+        uint8_t *dst = concat->sample_width == 2 ? (uint8_t *)(pcm + n) : (uint8_t *)(pcm + n) + (samples - n);
+        size_t got = want ? fread(dst, 1, want, concat->fp) : 0;
+        int count = got / concat->sample_width;
+        if (concat->sample_width == 1) {
+            for (int i = 0; i < count; i++) {
+                pcm[n + i] = ((int)dst[i] - 128) << 8;
+            }
+        }
+        n += count;
+        concat->left -= got;
+        if (got < want || concat->left == 0) {
+            tts_concat_next_clip(concat);
+        }
+    }
+    return n;
+}
+
+void esp_tts_concat_close(esp_tts_concat_t *concat)
+{
+    if (concat->fp) {
+        fclose(concat->fp);
+        concat->fp = NULL;
+    }
+}
+
+esp_err_t esp_tts_play_by_concat(const char **file_list, int file_num, esp_tts_sink_t sink, void *ctx,
+                                 int block_samples, int *sample_rate)
+{
+    esp_tts_concat_t concat;
+    int16_t *block = malloc(block_samples * sizeof(int16_t));
+    if (block == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    esp_err_t ret = esp_tts_concat_open(&concat, file_list, file_num);
+    if (ret == ESP_OK) {
+        if (sample_rate) {
+            *sample_rate = concat.sample_rate;
+        }
+        int n;
+        while ((n = esp_tts_concat_read(&concat, block, block_samples)) > 0) {
+            sink(block, n, ctx);
+        }
+        esp_tts_concat_close(&concat);
+    }
+    free(block);
+    return ret;
+}
@@ -0,0 +1,312 @@
+// Copyright 2015-2019 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "esp_tts_money.h"
+
+static const char *TAG = "TTS_MONEY";
+
+#define MONEY_TRIM_LEVEL    256     // a clip starts and ends where it first gets louder than this
+#define MONEY_TRIM_PAD_MS   3       // kept around that
+#define MONEY_MAX_UNITS     48
+#define MONEY_YUAN_MAX      999999999999LL
+
+// The vocabulary, 0~9 are the digits
+enum {
+    MONEY_LIANG = 10,
+    MONEY_SHI,
+    MONEY_BAI,
+    MONEY_QIAN,
+    MONEY_WAN,
+    MONEY_YI,
+    MONEY_YUAN,
+    MONEY_JIAO,
+    MONEY_FEN,
+    MONEY_ALIPAY,
+    MONEY_WEIXIN,
+    MONEY_CLIPS,
+    MONEY_PAUSE = MONEY_CLIPS,      // silence, not a clip
+};
+
+static const char *const money_pinyin[MONEY_CLIPS] = {
+    "ling2", "yi1", "er4", "san1", "si4", "wu3", "liu4", "qi1", "ba1", "jiu3",
+    "liang3", "shi2", "bai3", "qian1", "wan4", "yi4", "yuan2", "jiao3", "fen1",
+    "zhi1 fu4 bao3 shou1 kuan3",
+    "wei1 xin4 shou1 kuan3",
+};
+
+typedef struct {
+    int16_t *pcm;
+    int len;
+} money_clip_t;
+
+struct esp_tts_money {
+    money_clip_t clip[MONEY_CLIPS];
+    int sample_rate;
+    size_t size;
+};
+
+static void *money_alloc(size_t size)
+{
+    void *p = heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    return p ? p : malloc(size);
+}
+
+static int money_render(esp_tts_handle_t tts, unsigned int speed, const char *pinyin, int16_t *buf, int max)
+{
+    int n = 0;
+    int len;
+
+    if (!esp_tts_parse_pinyin(tts, pinyin)) {
+        ESP_LOGE(TAG, "%s: parse error", pinyin);
+        return -1;
+    }
+    // the stream runs to its end, the instance is left clean for the next text
+    do {
+        short *pcm = esp_tts_stream_play(tts, &len, speed);
+        int copy = len < max - n ? len : max - n;
+        memcpy(buf + n, pcm, copy * sizeof(int16_t));
+        n += copy;
+    } while (len > 0);
+    if (n == max) {
+        ESP_LOGW(TAG, "%s: cut to %d ms", pinyin, ESP_TTS_MONEY_CLIP_MS);
+    }
+    return n;
+}
+
+static esp_err_t money_trim(esp_tts_money_t *money, money_clip_t *clip, const int16_t *pcm, int n)
+{
+    int pad = money->sample_rate * MONEY_TRIM_PAD_MS / 1000;
+    int start = 0, end = n;
+    while (start < end && abs(pcm[start]) <= MONEY_TRIM_LEVEL) {
+        start++;
+    }
+    while (end > start && abs(pcm[end - 1]) <= MONEY_TRIM_LEVEL) {
+        end--;
+    }
+    start = start > pad ? start - pad : 0;
+    end = end + pad < n ? end + pad : n;
+    clip->len = end - start;
+    clip->pcm = money_alloc(clip->len * sizeof(int16_t) + 1);     // a silent clip is empty, not NULL
+    if (clip->pcm == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    memcpy(clip->pcm, pcm + start, clip->len * sizeof(int16_t));
+    money->size += clip->len * sizeof(int16_t);
+    return ESP_OK;
+}
+
+esp_tts_money_t *esp_tts_money_create(esp_tts_handle_t tts, const esp_tts_voice_t *voice, unsigned int speed)
+{
+    esp_tts_money_t *money = calloc(1, sizeof(esp_tts_money_t));
+    if (money == NULL) {
+        return NULL;
+    }
+    money->sample_rate = voice->sample_rate;
+    int max = money->sample_rate * ESP_TTS_MONEY_CLIP_MS / 1000;
+    int16_t *buf = money_alloc(max * sizeof(int16_t));
+    if (buf == NULL) {
+        free(money);
+        return NULL;
+    }
+    for (int i = 0; i < MONEY_CLIPS; i++) {
+        int n = money_render(tts, speed, money_pinyin[i], buf, max);
+        if (n < 0 || money_trim(money, &money->clip[i], buf, n) != ESP_OK) {
+            free(buf);
+            esp_tts_money_destroy(money);
+            return NULL;
+        }
+    }
+    free(buf);
+    ESP_LOGI(TAG, "%d clips, %u bytes", MONEY_CLIPS, money->size);
+    return money;
+}
+
+/*
+ * A group of four digits, as 千 百 十 and the ones. A zero after something was read is held in *zero
+ * and read before the next digit, so runs of zeros, within the group or across groups, read as one 零
+ * and trailing ones not at all. The first group read says 十 for 一十.
+ */
+static int money_group(uint8_t *u, int n, int v, bool first, bool *zero, bool *read)
+{
+    static const uint8_t unit[3] = {MONEY_QIAN, MONEY_BAI, MONEY_SHI};
+    int d[4] = {v / 1000, v / 100 % 10, v / 10 % 10, v % 10};
+
+    for (int i = 0; i < 4; i++) {
+        if (d[i] == 0) {
+            *zero = *read;
+            continue;
+        }
+        if (*zero) {
+            u[n++] = 0;
+            *zero = false;
+        }
+        if (!(i == 2 && d[i] == 1 && first && v < 20)) {
+            // 两千 两百
+            u[n++] = d[i] == 2 && i < 2 ? MONEY_LIANG : d[i];
+        }
+        if (i < 3) {
+            u[n++] = unit[i];
+        }
+        *read = true;
+    }
+    return n;
+}
+
+// The units of an announcement, as esp_tts_parse_money reads it
+static int money_units(uint8_t *u, int64_t yuan, int jiao, int fen, pay_mode_t mode)
+{
+    static const uint8_t group_unit[3] = {MONEY_YI, MONEY_WAN, 0};
+    int group[3] = {yuan / 100000000, yuan / 10000 % 10000, yuan % 10000};
+    bool zero = false, read = false;
+    int n = 0;
+
+    if (mode == ALI_PAY_MODE || mode == WEIXIN_PAY_MODE) {
+        u[n++] = mode == ALI_PAY_MODE ? MONEY_ALIPAY : MONEY_WEIXIN;
+        u[n++] = MONEY_PAUSE;
+    }
+    if (yuan || (!jiao && !fen)) {
+        for (int g = 0; g < 3; g++) {
+            if (group[g] == 0) {
+                zero = read;
+                continue;
+            }
+            n = money_group(u, n, group[g], !read, &zero, &read);
+            if (group_unit[g]) {
+                u[n++] = group_unit[g];
+            }
+        }
+        if (!read) {
+            u[n++] = 0;
+        }
+        u[n++] = MONEY_YUAN;
+    }
+    if (jiao) {
+        u[n++] = jiao;
+        u[n++] = MONEY_JIAO;
+    }
+    if (fen) {
+        if (!jiao && yuan) {
+            u[n++] = 0;
+        }
+        u[n++] = fen;
+        u[n++] = MONEY_FEN;
+    }
+    return n;
+}
+
+typedef struct {
+    esp_tts_sink_t sink;
+    void *ctx;
+    int16_t *block;
+    int size;
+    int fill;
+} money_out_t;
+
+static inline void money_put(money_out_t *o, int16_t v)
+{
+    o->block[o->fill++] = v;
+    if (o->fill == o->size) {
+        o->sink(o->block, o->fill, o->ctx);
+        o->fill = 0;
+    }
+}
+
+// n samples of pcm, of silence when pcm is NULL
+static void money_emit(money_out_t *o, const int16_t *pcm, int n)
+{
+    while (n > 0) {
+        int copy = o->size - o->fill < n ? o->size - o->fill : n;
+        if (pcm) {
+            memcpy(o->block + o->fill, pcm, copy * sizeof(int16_t));
+            pcm += copy;
+        } else {
+            memset(o->block + o->fill, 0, copy * sizeof(int16_t));
+        }
+        o->fill += copy;
+        n -= copy;
+        if (o->fill == o->size) {
+            o->sink(o->block, o->fill, o->ctx);
+            o->fill = 0;
+        }
+    }
+}
+
+esp_err_t esp_tts_money_play(esp_tts_money_t *money, int64_t yuan, int jiao, int fen, pay_mode_t mode,
+                             esp_tts_sink_t sink, void *ctx, int block_samples)
+{
+    uint8_t units[MONEY_MAX_UNITS];
+
+    if (yuan < 0 || yuan > MONEY_YUAN_MAX || jiao < 0 || jiao > 9 || fen < 0 || fen > 9) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    money_out_t o = {
+        .sink = sink,
+        .ctx = ctx,
+        .block = malloc(block_samples * sizeof(int16_t)),
+        .size = block_samples,
+    };
+    if (o.block == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    int xfade = money->sample_rate * ESP_TTS_MONEY_XFADE_MS / 1000;
+    int count = money_units(units, yuan, jiao, fen, mode);
+    // the end of every clip is held back until the next one is there to fade into
+    const int16_t *tail = NULL;
+    int tail_len = 0;
+
+    for (int i = 0; i < count; i++) {
+        if (units[i] == MONEY_PAUSE) {
+            money_emit(&o, tail, tail_len);
+            tail_len = 0;
+            money_emit(&o, NULL, money->sample_rate * ESP_TTS_MONEY_PAUSE_MS / 1000);
+            continue;
+        }
+        const money_clip_t *c = &money->clip[units[i]];
+        int x = tail_len < c->len / 2 ? tail_len : c->len / 2;
+        x = x < xfade ? x : xfade;
+        money_emit(&o, tail, tail_len - x);
+        for (int k = 0; k < x; k++) {
+            money_put(&o, (tail[tail_len - x + k] * (x - k) + c->pcm[k] * k) / x);
+        }
+        tail_len = xfade < (c->len - x) / 2 ? xfade : (c->len - x) / 2;
+        money_emit(&o, c->pcm + x, c->len - x - tail_len);
+        tail = c->pcm + c->len - tail_len;
+    }
+    money_emit(&o, tail, tail_len);
+    if (o.fill) {
+        sink(o.block, o.fill, ctx);
+    }
+    free(o.block);
+    return ESP_OK;
+}
+
+size_t esp_tts_money_size(const esp_tts_money_t *money)
+{
+    return money->size;
+}
+
+void esp_tts_money_destroy(esp_tts_money_t *money)
+{
+    if (money == NULL) {
+        return;
+    }
+    for (int i = 0; i < MONEY_CLIPS; i++) {
+        free(money->clip[i].pcm);
+    }
+    free(money);
+}
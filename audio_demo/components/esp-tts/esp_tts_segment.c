@@ -0,0 +1,93 @@
+// Copyright 2015-2019 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License
+#include <string.h>
+#include "esp_tts_segment.h"
+
+// Full-width punctuation a segment ends after, UTF-8
+static const char *const tts_breaks[] = {"，", "。", "！", "？", "；", "：", "、"};
+
+static inline int tts_is_digit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+// Length of the break at s + at, 0 if there is none. "25.5" and "1,000" are numbers, not breaks
+static size_t tts_break_len(const char *s, size_t at)
+{
+    const char *p = s + at;
+    if ((*p == ',' || *p == '.') && at > 0 && tts_is_digit(p[-1]) && tts_is_digit(p[1])) {
+        return 0;
+    }
+    if (*p == ',' || *p == '.' || *p == '!' || *p == '?' || *p == ';' || *p == ':' || *p == '\n') {
+        return 1;
+    }
+    for (int i = 0; i < (int)(sizeof(tts_breaks) / sizeof(tts_breaks[0])); i++) {
+        size_t n = strlen(tts_breaks[i]);
+        if (strncmp(p, tts_breaks[i], n) == 0) {
+            return n;
+        }
+    }
+    return 0;
+}
+
+void esp_tts_segmenter_init(esp_tts_segmenter_t *seg, const char *text)
+{
+    seg->text = text;
+    seg->pos = 0;
+    seg->segment[0] = '\0';
+}
+
+const char *esp_tts_segmenter_next(esp_tts_segmenter_t *seg)
+{
+    const char *start = seg->text + seg->pos;
+    size_t len = 0;
+    size_t cut = 0;                 // the last character boundary that fits
+
+    if (*start == '\0') {
+        return NULL;
+    }
+    while (start[len] && len < ESP_TTS_SEGMENT_MAX) {
+        size_t n = tts_break_len(start, len);
+        if (n && len + n <= ESP_TTS_SEGMENT_MAX) {
+            len += n;
+            cut = len;
+            break;
+        }
+        // step over one UTF-8 character
+        n = 1;
+        while ((start[len + n] & 0xc0) == 0x80) {
+            n++;
+        }
+        if (len + n > ESP_TTS_SEGMENT_MAX) {
+            break;
+        }
+        len += n;
+        cut = len;
+    }
+    memcpy(seg->segment, start, cut);
+    seg->segment[cut] = '\0';
+    seg->pos += cut;
+    return seg->segment;
+}
+
+int esp_tts_parse_chinese_next(esp_tts_handle_t tts_handle, esp_tts_segmenter_t *seg)
+{
+    const char *segment;
+    while ((segment = esp_tts_segmenter_next(seg)) != NULL) {
+        if (esp_tts_parse_chinese(tts_handle, segment)) {
+            return 1;
+        }
+    }
+    return 0;
+}
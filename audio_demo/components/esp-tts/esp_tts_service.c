@@ -0,0 +1,410 @@
+// Copyright 2015-2019 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "esp_heap_caps.h"
+#include "esp_tts_service.h"
+#include "esp_tts_segment.h"
+#include "esp_tts_stretcher.h"
+
+#define TTS_SERVICE_STACK   (4 * 1024)
+#define TTS_PITCH_MAX_HZ    333         // pitch range the stretcher looks for periods in
+#define TTS_PITCH_MIN_HZ    55
+#define TTS_RATE_MIN        0.5f        // the stretcher scales 1/2 to 2 times
+#define TTS_RATE_MAX        2.0f
+
+typedef struct {
+    char *text;                     // NULL stops the synthesis task
+    uint32_t gen;
+    bool play;                      // false: into the cache only
+} tts_text_msg_t;
+
+typedef struct {
+    int16_t *buf;                   // NULL: the utterance is over, or the output task stops
+    int samples;                    // < 0 together with a NULL buf stops the output task
+    uint32_t gen;
+} tts_pcm_msg_t;
+
+/*
+ * The buffers circulate between free_q and full_q. A cancel bumps gen: the synthesis task stops
+ * the utterance it works on and skips queued ones of an older gen, the output task drops buffers
+ * of an older gen instead of playing them.
+ */
+typedef struct {
+    esp_tts_service_config_t cfg;
+    QueueHandle_t text_q;
+    QueueHandle_t free_q;
+    QueueHandle_t full_q;
+    SemaphoreHandle_t exited;
+    portMUX_TYPE lock;
+    volatile uint32_t gen;
+    volatile int pending;           // utterances said and not over yet
+    int16_t *pcm;
+    int16_t *record;                // the utterance being synthesized, for the cache
+    int record_len;
+    int record_size;
+    esp_tts_segmenter_t segmenter;
+    StretchHandle stretch;          // NULL without rate_control
+    int16_t *stretched;
+    volatile float rate;
+    bool stretching;                // the utterance goes through the stretcher, until its end
+} tts_service_t;
+
+static void tts_service_send(tts_service_t *s, int16_t *buf, int samples, uint32_t gen)
+{
+    tts_pcm_msg_t msg = {buf, samples, gen};
+    xQueueSend(s->full_q, &msg, portMAX_DELAY);
+}
+
+/*
+ * Keep what is synthesized for the cache, the buffer grows as needed. Recording stops, and the
+ * utterance is not cached, when it gets longer than cache_max_samples or memory runs out.
+ */
+static void tts_synth_record(tts_service_t *s, const short *pcm, int len)
+{
+    if (s->record_len < 0) {
+        return;
+    }
+    if (s->record_len + len > s->cfg.cache_max_samples) {
+        s->record_len = -1;
+        return;
+    }
+    if (s->record_len + len > s->record_size) {
+        int size = s->record_size ? s->record_size : len;
+        while (size < s->record_len + len) {
+            size *= 2;
+        }
+        size = size < s->cfg.cache_max_samples ? size : s->cfg.cache_max_samples;
+        int16_t *record = heap_caps_realloc(s->record, size * sizeof(int16_t), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        if (record == NULL) {
+            record = realloc(s->record, size * sizeof(int16_t));
+        }
+        if (record == NULL) {
+            s->record_len = -1;
+            return;
+        }
+        s->record = record;
+        s->record_size = size;
+    }
+    memcpy(s->record + s->record_len, pcm, len * sizeof(int16_t));
+    s->record_len += len;
+}
+
+// Split PCM over the ring buffers, *buf is the one being filled
+static void tts_synth_emit(tts_service_t *s, const tts_text_msg_t *msg, const int16_t *pcm, int len,
+                           int16_t **buf, int *fill)
+{
+    int off = 0;
+    while (off < len && msg->gen == s->gen) {
+        if (*buf == NULL) {
+            xQueueReceive(s->free_q, buf, portMAX_DELAY);
+            *fill = 0;
+        }
+        int n = len - off < s->cfg.buffer_samples - *fill ? len - off : s->cfg.buffer_samples - *fill;
+        memcpy(*buf + *fill, pcm + off, n * sizeof(int16_t));
+        *fill += n;
+        off += n;
+        if (*fill == s->cfg.buffer_samples) {
+            tts_service_send(s, *buf, *fill, msg->gen);
+            *buf = NULL;
+        }
+    }
+}
+
+static void tts_synth_utterance(tts_service_t *s, const tts_text_msg_t *msg)
+{
+    esp_tts_handle_t tts = s->cfg.tts;
+    int16_t *buf = NULL;
+    int fill = 0;
+    int len = 0;
+
+    if (s->cfg.cache) {
+        const int16_t *pcm = esp_tts_cache_find(s->cfg.cache, msg->text, s->cfg.voice, s->cfg.speed, &len);
+        if (pcm) {
+            if (msg->play) {
+                tts_synth_emit(s, msg, pcm, len, &buf, &fill);
+                len = 0;
+                goto out;
+            }
+            return;
+        }
+    }
+    // one segment is parsed while the previous one plays from the ring
+    s->record_len = s->cfg.cache ? 0 : -1;
+    esp_tts_segmenter_init(&s->segmenter, msg->text);
+    while (msg->gen == s->gen && esp_tts_parse_chinese_next(tts, &s->segmenter)) {
+        do {
+            short *pcm = esp_tts_stream_play(tts, &len, s->cfg.speed);
+            tts_synth_record(s, pcm, len);
+            if (msg->play) {
+                tts_synth_emit(s, msg, pcm, len, &buf, &fill);
+            }
+        } while (len > 0 && msg->gen == s->gen);
+    }
+
+    if (len > 0) {
+        // cancelled in the middle
+        esp_tts_stream_reset(tts);
+    } else if (s->record_len > 0 && msg->gen == s->gen) {
+        esp_tts_cache_add(s->cfg.cache, msg->text, s->cfg.voice, s->cfg.speed, s->record, s->record_len);
+    }
+
+out:
+    if (buf && fill && msg->gen == s->gen) {
+        tts_service_send(s, buf, fill, msg->gen);
+    } else if (buf) {
+        xQueueSend(s->free_q, &buf, portMAX_DELAY);
+    }
+}
+
+static void tts_synth_task(void *arg)
+{
+    tts_service_t *s = arg;
+    tts_text_msg_t msg;
+
+    while (xQueueReceive(s->text_q, &msg, portMAX_DELAY) == pdTRUE && msg.text) {
+        if (msg.gen == s->gen) {
+            tts_synth_utterance(s, &msg);
+        }
+        free(msg.text);
+        if (msg.play) {
+            tts_service_send(s, NULL, 0, msg.gen);
+        }
+    }
+    tts_service_send(s, NULL, -1, 0);
+    xSemaphoreGive(s->exited);
+    vTaskDelete(NULL);
+}
+
+/*
+ * Once an utterance has gone through the stretcher it stays on it until its end, even at rate 1,
+ * so the samples the stretcher holds come out in order. stretch_flush empties it at the end.
+ */
+static void tts_output_block(tts_service_t *s, int16_t *pcm, int samples)
+{
+    float rate = s->rate;
+    if (s->stretch && (rate != 1.0f || s->stretching)) {
+        s->stretching = true;
+        samples = stretch_samples(s->stretch, pcm, samples, s->stretched, 1.0f / rate);
+        pcm = s->stretched;
+    }
+    if (samples > 0) {
+        s->cfg.sink(pcm, samples, s->cfg.sink_ctx);
+    }
+}
+
+static void tts_output_end(tts_service_t *s, bool play)
+{
+    if (s->stretching) {
+        int samples = stretch_flush(s->stretch, s->stretched);
+        if (play && samples > 0) {
+            s->cfg.sink(s->stretched, samples, s->cfg.sink_ctx);
+        }
+        s->stretching = false;
+    }
+}
+
+static void tts_output_task(void *arg)
+{
+    tts_service_t *s = arg;
+    tts_pcm_msg_t msg;
+
+    while (xQueueReceive(s->full_q, &msg, portMAX_DELAY) == pdTRUE) {
+        if (msg.buf) {
+            if (msg.gen == s->gen) {
+                tts_output_block(s, msg.buf, msg.samples);
+            }
+            xQueueSend(s->free_q, &msg.buf, portMAX_DELAY);
+            continue;
+        }
+        if (msg.samples < 0) {
+            break;
+        }
+        tts_output_end(s, msg.gen == s->gen);
+        portENTER_CRITICAL(&s->lock);
+        bool idle = --s->pending == 0;
+        portEXIT_CRITICAL(&s->lock);
+        // the next utterance follows on the same DMA stream, the sink only hears of the end when none is queued
+        if (idle && s->cfg.end) {
+            s->cfg.end(s->cfg.sink_ctx);
+        }
+    }
+    xSemaphoreGive(s->exited);
+    vTaskDelete(NULL);
+}
+
+esp_tts_service_handle_t esp_tts_service_create(const esp_tts_service_config_t *config)
+{
+    if (config->tts == NULL || config->sink == NULL || config->buffer_count < 1 || config->buffer_samples < 1) {
+        return NULL;
+    }
+    tts_service_t *s = calloc(1, sizeof(tts_service_t));
+    if (s == NULL) {
+        return NULL;
+    }
+    s->cfg = *config;
+    s->lock = (portMUX_TYPE)portMUX_INITIALIZER_UNLOCKED;
+    s->pcm = malloc(config->buffer_count * config->buffer_samples * sizeof(int16_t));
+    s->rate = 1.0f;
+    if (config->rate_control) {
+        int rate = config->voice ? config->voice->sample_rate : 16000;
+        int longest = rate / TTS_PITCH_MIN_HZ;
+        s->stretch = stretch_init(rate / TTS_PITCH_MAX_HZ, longest, 1, 1);
+        // a block at the slowest rate, and what the stretcher may still hold back
+        s->stretched = malloc((config->buffer_samples * TTS_RATE_MAX + longest * 4) * sizeof(int16_t));
+        if (s->stretch == NULL || s->stretched == NULL) {
+            goto err;
+        }
+    }
+    // one more slot each for the stop message
+    s->text_q = xQueueCreate(config->queue_len + 1, sizeof(tts_text_msg_t));
+    s->free_q = xQueueCreate(config->buffer_count, sizeof(int16_t *));
+    s->full_q = xQueueCreate(config->buffer_count + 1, sizeof(tts_pcm_msg_t));
+    s->exited = xSemaphoreCreateCounting(2, 0);
+    if (s->pcm == NULL || s->text_q == NULL || s->free_q == NULL || s->full_q == NULL || s->exited == NULL) {
+        goto err;
+    }
+    for (int i = 0; i < config->buffer_count; i++) {
+        int16_t *buf = s->pcm + i * config->buffer_samples;
+        xQueueSend(s->free_q, &buf, 0);
+    }
+    if (xTaskCreatePinnedToCore(&tts_output_task, "tts_output", TTS_SERVICE_STACK, s, config->task_priority, NULL, config->output_core) != pdPASS) {
+        goto err;
+    }
+    if (xTaskCreatePinnedToCore(&tts_synth_task, "tts_synth", TTS_SERVICE_STACK, s, config->task_priority, NULL, config->synth_core) != pdPASS) {
+        // the output task is running, stop it the way destroy would
+        tts_service_send(s, NULL, -1, 0);
+        xSemaphoreTake(s->exited, portMAX_DELAY);
+        goto err;
+    }
+    return s;
+
+err:
+    if (s->exited) {
+        vSemaphoreDelete(s->exited);
+    }
+    if (s->full_q) {
+        vQueueDelete(s->full_q);
+    }
+    if (s->free_q) {
+        vQueueDelete(s->free_q);
+    }
+    if (s->text_q) {
+        vQueueDelete(s->text_q);
+    }
+    if (s->stretch) {
+        stretch_deinit(s->stretch);
+    }
+    free(s->stretched);
+    free(s->pcm);
+    free(s);
+    return NULL;
+}
+
+esp_err_t esp_tts_service_say_take(esp_tts_service_handle_t service, char *text, esp_tts_say_mode_t mode)
+{
+    tts_service_t *s = service;
+    if (mode == ESP_TTS_SAY_PREEMPT) {
+        esp_tts_service_cancel(service);
+    }
+    tts_text_msg_t msg = {text, s->gen, true};
+    portENTER_CRITICAL(&s->lock);
+    s->pending++;
+    portEXIT_CRITICAL(&s->lock);
+    if (xQueueSend(s->text_q, &msg, 0) != pdTRUE) {
+        portENTER_CRITICAL(&s->lock);
+        s->pending--;
+        portEXIT_CRITICAL(&s->lock);
+        return ESP_ERR_TIMEOUT;
+    }
+    return ESP_OK;
+}
+
+esp_err_t esp_tts_service_say(esp_tts_service_handle_t service, const char *text, esp_tts_say_mode_t mode)
+{
+    char *copy = strdup(text);
+    if (copy == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    esp_err_t ret = esp_tts_service_say_take(service, copy, mode);
+    if (ret != ESP_OK) {
+        free(copy);
+    }
+    return ret;
+}
+
+esp_err_t esp_tts_service_prewarm(esp_tts_service_handle_t service, const char *text)
+{
+    tts_service_t *s = service;
+    if (s->cfg.cache == NULL) {
+        return ESP_OK;
+    }
+    tts_text_msg_t msg = {strdup(text), s->gen, false};
+    if (msg.text == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    if (xQueueSend(s->text_q, &msg, 0) != pdTRUE) {
+        free(msg.text);
+        return ESP_ERR_TIMEOUT;
+    }
+    return ESP_OK;
+}
+
+void esp_tts_service_cancel(esp_tts_service_handle_t service)
+{
+    tts_service_t *s = service;
+    portENTER_CRITICAL(&s->lock);
+    s->gen++;
+    portEXIT_CRITICAL(&s->lock);
+}
+
+void esp_tts_service_set_rate(esp_tts_service_handle_t service, float rate)
+{
+    tts_service_t *s = service;
+    s->rate = rate < TTS_RATE_MIN ? TTS_RATE_MIN : rate > TTS_RATE_MAX ? TTS_RATE_MAX : rate;
+}
+
+bool esp_tts_service_busy(esp_tts_service_handle_t service)
+{
+    tts_service_t *s = service;
+    return s->pending > 0;
+}
+
+void esp_tts_service_destroy(esp_tts_service_handle_t service)
+{
+    tts_service_t *s = service;
+    if (s == NULL) {
+        return;
+    }
+    esp_tts_service_cancel(service);
+    tts_text_msg_t stop = {NULL, 0, false};
+    xQueueSend(s->text_q, &stop, portMAX_DELAY);
+    xSemaphoreTake(s->exited, portMAX_DELAY);
+    xSemaphoreTake(s->exited, portMAX_DELAY);
+    vSemaphoreDelete(s->exited);
+    vQueueDelete(s->full_q);
+    vQueueDelete(s->free_q);
+    vQueueDelete(s->text_q);
+    if (s->stretch) {
+        stretch_deinit(s->stretch);
+    }
+    free(s->stretched);
+    free(s->record);
+    free(s->pcm);
+    free(s);
+}
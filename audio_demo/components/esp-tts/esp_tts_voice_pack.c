@@ -0,0 +1,407 @@
+// Copyright 2015-2019 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License
+#include <stdlib.h>
+#include <string.h>
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "esp_partition.h"
+#include "mem_place.h"
+#include "part_delta.h"
+#include "esp_tts_voice_pack.h"
+
+static const char *TAG = "TTS_PACK";
+
+/*
+ * Pack layout, little-endian, see tools/voice_pack.py:
+ *     header
+ *     syllables: syll_num of tts_pack_syll_t, byte positions in the syllable data
+ *     index: block_count + 1 offsets of the compressed blocks, relative to data_offset
+ *     the blocks; one stored as long as its raw size is not compressed
+ */
+#define TTS_PACK_MAGIC          0x4b505654      // "TVPK"
+#define TTS_PACK_VERSION        1
+#define TTS_PACK_NAME_LEN       8
+#define TTS_PACK_FORMAT_LEN     8
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t block_size;
+    uint32_t block_count;
+    uint32_t raw_size;
+    uint32_t syll_num;
+    uint32_t sample_rate;
+    uint32_t syll_offset;
+    uint32_t index_offset;
+    uint32_t data_offset;
+    char format[TTS_PACK_FORMAT_LEN];   // NUL padded
+} tts_pack_header_t;
+
+typedef struct {
+    char name[TTS_PACK_NAME_LEN];   // NUL padded, not terminated at full length
+    uint32_t pos;
+    uint32_t len;
+} tts_pack_syll_t;
+
+typedef struct {
+    int block;                      // -1 when empty
+    uint32_t used;                  // tick of the last use
+} tts_pack_slot_t;
+
+struct esp_tts_voice_pack {
+    const esp_partition_t *part;
+    tts_pack_header_t hdr;
+    tts_pack_syll_t *syll;
+    uint32_t *index;
+    int16_t *block_slot;            // slot of every block, -1 when not cached
+    tts_pack_slot_t *slot;
+    int slot_num;
+    uint8_t *cache;                 // slot_num blocks
+    uint8_t *packed;                // one compressed block
+    uint32_t tick;
+    uint32_t hits;
+    uint32_t misses;
+};
+
+static void *tts_pack_alloc(size_t size)
+{
+    void *p = heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    return p ? p : malloc(size);
+}
+
+/*
+ * LZ4 block format: a token of literal and match length, the literals, a 16-bit offset back into the
+ * output and the match; the last sequence has literals only. Every length is checked, a damaged
+ * block fails instead of writing past the slot.
+ */
+static int lz4_len(const uint8_t **ip, const uint8_t *iend, int len)
+{
+    if (len == 15) {
+        int b;
+        do {
+            if (*ip >= iend) {
+                return -1;
+            }
+            b = *(*ip)++;
+            len += b;
+        } while (b == 255);
+    }
+    return len;
+}
+
+static int lz4_decode(const uint8_t *src, int src_len, uint8_t *dst, int dst_len)
+{
+    const uint8_t *ip = src;
+    const uint8_t *iend = src + src_len;
+    uint8_t *op = dst;
+    uint8_t *oend = dst + dst_len;
+
+    while (ip < iend) {
+        int token = *ip++;
+        int len = lz4_len(&ip, iend, token >> 4);
+        if (len < 0 || len > iend - ip || len > oend - op) {
+            return -1;
+        }
+        memcpy(op, ip, len);
+        op += len;
+        ip += len;
+        if (ip == iend) {
+            break;
+        }
+        if (iend - ip < 2) {
+            return -1;
+        }
+        int offset = ip[0] | (ip[1] << 8);
+        ip += 2;
+        len = lz4_len(&ip, iend, token & 15);
+        if (offset == 0 || offset > op - dst || len < 0 || len + 4 > oend - op) {
+            return -1;
+        }
+        // the match may overlap what it writes, byte by byte
+        const uint8_t *match = op - offset;
+        for (len += 4; len > 0; len--) {
+            *op++ = *match++;
+        }
+    }
+    return op - dst;
+}
+
+static inline uint32_t tts_pack_block_len(const esp_tts_voice_pack_t *pack, int block)
+{
+    uint32_t start = block * pack->hdr.block_size;
+    uint32_t left = pack->hdr.raw_size - start;
+    return left < pack->hdr.block_size ? left : pack->hdr.block_size;
+}
+
+// The cached block, read and decompressed into the least recently used slot on a miss
+static const uint8_t *tts_pack_block(esp_tts_voice_pack_t *pack, int block)
+{
+    int s = pack->block_slot[block];
+    if (s >= 0) {
+        pack->slot[s].used = ++pack->tick;
+        pack->hits++;
+        return pack->cache + s * pack->hdr.block_size;
+    }
+    s = 0;
+    for (int i = 1; i < pack->slot_num; i++) {
+        if (pack->slot[i].used < pack->slot[s].used) {
+            s = i;
+        }
+    }
+    if (pack->slot[s].block >= 0) {
+        pack->block_slot[pack->slot[s].block] = -1;
+        pack->slot[s].block = -1;
+    }
+    uint8_t *dst = pack->cache + s * pack->hdr.block_size;
+    uint32_t raw_len = tts_pack_block_len(pack, block);
+    uint32_t size = pack->index[block + 1] - pack->index[block];
+    uint32_t offset = pack->hdr.data_offset + pack->index[block];
+    if (size > raw_len) {
+        ESP_LOGE(TAG, "block %d: %u bytes for %u", block, size, raw_len);
+        return NULL;
+    }
+    // 压缩不了的块原样存放，直接读进缓存
+    uint8_t *src = size == raw_len ? dst : pack->packed;
+    if (esp_partition_read(pack->part, offset, src, size) != ESP_OK) {
+        ESP_LOGE(TAG, "block %d: read error", block);
+        return NULL;
+    }
+    mem_place_bw_io(MEM_PLACE_BW_TTS, src, size);
+    if (src != dst && lz4_decode(src, size, dst, raw_len) != raw_len) {
+        ESP_LOGE(TAG, "block %d: bad data", block);
+        return NULL;
+    }
+    if (src != dst) {
+        mem_place_bw_copy(MEM_PLACE_BW_TTS, dst, src, raw_len);
+    }
+    pack->slot[s].block = block;
+    pack->slot[s].used = ++pack->tick;
+    pack->block_slot[block] = s;
+    pack->misses++;
+    return dst;
+}
+
+static esp_err_t tts_pack_load(esp_tts_voice_pack_t *pack, size_t cache_bytes)
+{
+    const tts_pack_header_t *h = &pack->hdr;
+    if (esp_partition_read(pack->part, 0, &pack->hdr, sizeof(tts_pack_header_t)) != ESP_OK ||
+            h->magic != TTS_PACK_MAGIC || h->version != TTS_PACK_VERSION) {
+        ESP_LOGE(TAG, "%s: no voice pack", pack->part->label);
+        return ESP_ERR_NOT_FOUND;
+    }
+    if (h->block_size == 0 || h->block_count != (h->raw_size + h->block_size - 1) / h->block_size ||
+            h->block_count > INT16_MAX || h->data_offset > pack->part->size) {
+        ESP_LOGE(TAG, "%s: bad header", pack->part->label);
+        return ESP_ERR_INVALID_SIZE;
+    }
+    pack->slot_num = cache_bytes / h->block_size;
+    pack->slot_num = pack->slot_num < 1 ? 1 : pack->slot_num;
+    pack->slot_num = pack->slot_num > h->block_count ? h->block_count : pack->slot_num;
+    pack->syll = tts_pack_alloc(h->syll_num * sizeof(tts_pack_syll_t));
+    pack->index = malloc((h->block_count + 1) * sizeof(uint32_t));
+    pack->block_slot = malloc(h->block_count * sizeof(int16_t));
+    pack->slot = malloc(pack->slot_num * sizeof(tts_pack_slot_t));
+    pack->cache = tts_pack_alloc(pack->slot_num * h->block_size);
+    pack->packed = malloc(h->block_size);
+    if (!pack->syll || !pack->index || !pack->block_slot || !pack->slot || !pack->cache || !pack->packed) {
+        return ESP_ERR_NO_MEM;
+    }
+    if (esp_partition_read(pack->part, h->syll_offset, pack->syll, h->syll_num * sizeof(tts_pack_syll_t)) != ESP_OK ||
+            esp_partition_read(pack->part, h->index_offset, pack->index, (h->block_count + 1) * sizeof(uint32_t)) != ESP_OK) {
+        return ESP_FAIL;
+    }
+    for (int i = 0; i < h->syll_num; i++) {
+        if (pack->syll[i].pos > h->raw_size || pack->syll[i].len > h->raw_size - pack->syll[i].pos) {
+            ESP_LOGE(TAG, "%s: syllable %d out of the data", pack->part->label, i);
+            return ESP_ERR_INVALID_SIZE;
+        }
+    }
+    if (h->data_offset + (uint64_t)pack->index[h->block_count] > pack->part->size) {
+        ESP_LOGE(TAG, "%s: blocks past the partition", pack->part->label);
+        return ESP_ERR_INVALID_SIZE;
+    }
+    memset(pack->block_slot, 0xff, h->block_count * sizeof(int16_t));
+    for (int i = 0; i < pack->slot_num; i++) {
+        pack->slot[i].block = -1;
+        pack->slot[i].used = 0;
+    }
+    return ESP_OK;
+}
+
+esp_tts_voice_pack_t *esp_tts_voice_pack_open(const char *label, size_t cache_bytes)
+{
+    esp_tts_voice_pack_t *pack = calloc(1, sizeof(esp_tts_voice_pack_t));
+    if (pack == NULL) {
+        return NULL;
+    }
+    // the slot the last delta update went to, if the pack has two
+    pack->part = part_delta_active(label);
+    if (pack->part == NULL) {
+        ESP_LOGE(TAG, "no partition %s", label);
+        free(pack);
+        return NULL;
+    }
+    if (tts_pack_load(pack, cache_bytes) != ESP_OK) {
+        esp_tts_voice_pack_close(pack);
+        return NULL;
+    }
+    ESP_LOGI(TAG, "%s: %u syllables, %u of %u bytes, %d blocks cached", label, pack->hdr.syll_num,
+             pack->index[pack->hdr.block_count], pack->hdr.raw_size, pack->slot_num);
+    return pack;
+}
+
+int esp_tts_voice_pack_find(esp_tts_voice_pack_t *pack, const char *syll)
+{
+    for (int i = 0; i < pack->hdr.syll_num; i++) {
+        if (strncmp(pack->syll[i].name, syll, TTS_PACK_NAME_LEN) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+int esp_tts_voice_pack_syll_size(esp_tts_voice_pack_t *pack, int index)
+{
+    return pack->syll[index].len;
+}
+
+int esp_tts_voice_pack_read(esp_tts_voice_pack_t *pack, int index, int offset, void *buf, int len)
+{
+    const tts_pack_syll_t *syll = &pack->syll[index];
+    if (offset >= syll->len) {
+        return 0;
+    }
+    uint32_t want = len < syll->len - offset ? len : syll->len - offset;
+    uint32_t pos = syll->pos + offset;
+
+    // a syllable spans blocks
+    for (uint32_t done = 0; done < want;) {
+        int block = (pos + done) / pack->hdr.block_size;
+        uint32_t at = (pos + done) % pack->hdr.block_size;
+        uint32_t n = pack->hdr.block_size - at < want - done ? pack->hdr.block_size - at : want - done;
+        const uint8_t *src = tts_pack_block(pack, block);
+        if (src == NULL) {
+            return -1;
+        }
+        memcpy((uint8_t *)buf + done, src + at, n);
+        done += n;
+    }
+    return want;
+}
+
+void esp_tts_voice_pack_get_info(esp_tts_voice_pack_t *pack, esp_tts_voice_pack_info_t *info)
+{
+    memcpy(info->format, pack->hdr.format, TTS_PACK_FORMAT_LEN);
+    info->format[TTS_PACK_FORMAT_LEN] = '\0';
+    info->sample_rate = pack->hdr.sample_rate;
+    info->syll_num = pack->hdr.syll_num;
+    info->raw_size = pack->hdr.raw_size;
+    info->block_size = pack->hdr.block_size;
+    info->hits = pack->hits;
+    info->misses = pack->misses;
+}
+
+void esp_tts_voice_pack_close(esp_tts_voice_pack_t *pack)
+{
+    if (pack == NULL) {
+        return;
+    }
+    free(pack->syll);
+    free(pack->index);
+    free(pack->block_slot);
+    free(pack->slot);
+    free(pack->cache);
+    free(pack->packed);
+    free(pack);
+}
+
+typedef struct {
+    esp_tts_voice_pack_t *pack;
+    int index;
+    int offset;
+} tts_pack_cursor_t;
+
+static int tts_pack_amr_read(void *ctx, uint8_t *buf, int len)
+{
+    tts_pack_cursor_t *c = ctx;
+    int n = esp_tts_voice_pack_read(c->pack, c->index, c->offset, buf, len);
+    n = n < 0 ? 0 : n;
+    c->offset += n;
+    return n;
+}
+
+// One syllable to the sink through block
+static esp_err_t tts_pack_play_syll(esp_tts_voice_pack_t *pack, int index, const esp_tts_amr_decoder_t *decoder,
+                                    esp_tts_sink_t sink, void *ctx, int16_t *block, int block_samples)
+{
+    tts_pack_cursor_t cursor = { .pack = pack, .index = index, .offset = 0 };
+    int n;
+
+    if (decoder == NULL) {
+        while ((n = esp_tts_voice_pack_read(pack, index, cursor.offset, block, block_samples * sizeof(int16_t))) > 0) {
+            sink(block, n / sizeof(int16_t), ctx);
+            cursor.offset += n;
+        }
+        return n < 0 ? ESP_FAIL : ESP_OK;
+    }
+    // every syllable is an AMR-WB stream of its own, magic included
+    esp_tts_amr_t *amr = esp_tts_amr_open(decoder, tts_pack_amr_read, &cursor);
+    if (amr == NULL) {
+        return ESP_FAIL;
+    }
+    while ((n = esp_tts_amr_read(amr, block, block_samples)) > 0) {
+        sink(block, n, ctx);
+    }
+    esp_tts_amr_close(amr);
+    return ESP_OK;
+}
+
+esp_err_t esp_tts_play_by_pack(esp_tts_voice_pack_t *pack, const char *pinyin, const esp_tts_amr_decoder_t *decoder,
+                               esp_tts_sink_t sink, void *ctx, int block_samples)
+{
+    char syll[TTS_PACK_NAME_LEN + 1];
+    int amr = strncmp(pack->hdr.format, "amr", TTS_PACK_FORMAT_LEN) == 0;
+
+    if (amr ? decoder == NULL : strncmp(pack->hdr.format, "pcm", TTS_PACK_FORMAT_LEN) != 0) {
+        ESP_LOGE(TAG, "cannot play %.*s syllables", TTS_PACK_FORMAT_LEN, pack->hdr.format);
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    int16_t *block = malloc(block_samples * sizeof(int16_t));
+    if (block == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    esp_err_t ret = ESP_OK;
+    const char *p = pinyin;
+    while (ret == ESP_OK && *p) {
+        size_t len = strcspn(p, " ");
+        if (len == 0) {
+            p++;
+            continue;
+        }
+        int index = -1;
+        if (len <= TTS_PACK_NAME_LEN) {
+            memcpy(syll, p, len);
+            syll[len] = '\0';
+            index = esp_tts_voice_pack_find(pack, syll);
+        }
+        if (index < 0) {
+            ESP_LOGW(TAG, "no syllable %.*s", (int)len, p);
+        } else {
+            ret = tts_pack_play_syll(pack, index, amr ? decoder : NULL, sink, ctx, block, block_samples);
+        }
+        p += len;
+    }
+    free(block);
+    return ret;
+}
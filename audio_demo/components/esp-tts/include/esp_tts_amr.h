@@ -0,0 +1,94 @@
+// Copyright 2015-2019 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License
+#ifndef _ESP_TTS_AMR_H_
+#define _ESP_TTS_AMR_H_
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_tts_service.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * AMR-NB prompts in the storage format of RFC 4867 ("#!AMR\n", then one header byte and the speech
+ * bits per frame), decoded a 20 ms frame at a time as the output asks for samples. 12.2 kbit/s
+ * takes 32 bytes per frame against 320 of 8 kHz PCM. AMR-WB streams ("#!AMR-WB\n", 16 kHz, as the
+ * syllables of the xiaole voice) are taken the same way when the decoder is an AMR-WB one.
+ *
+ * The codec itself is not part of this component, the application hands in its decoder, e.g. the
+ * amrnb or amrwb decoder of esp-adf or opencore-amr, through esp_tts_amr_decoder_t.
+ */
+
+#define ESP_TTS_AMR_SAMPLE_RATE     8000
+#define ESP_TTS_AMR_FRAME_SAMPLES   160
+#define ESP_TTS_AMR_FRAME_MAX       32      // header byte and the 12.2 kbit/s speech bits
+#define ESP_TTS_AMR_WB_SAMPLE_RATE  16000
+#define ESP_TTS_AMR_WB_FRAME_SAMPLES 320
+#define ESP_TTS_AMR_WB_FRAME_MAX    61      // header byte and the 23.85 kbit/s speech bits
+
+typedef struct {
+    void *(*open)(void);
+    // frame: the header byte and its speech bits, NO_DATA frames included; pcm: 160 samples, 320 for AMR-WB
+    int (*decode)(void *dec, const uint8_t *frame, int16_t *pcm);
+    void (*close)(void *dec);
+} esp_tts_amr_decoder_t;
+
+/*
+ * Source of the encoded stream, e.g. rb_read on a ring buffer or a file.
+ * return: bytes read, less than len only at the end of the stream
+ */
+typedef int (*esp_tts_amr_read_t)(void *ctx, uint8_t *buf, int len);
+
+typedef struct esp_tts_amr esp_tts_amr_t;
+
+/**
+ * @brief Check the "#!AMR\n" or "#!AMR-WB\n" magic and set up the decoder.
+ *
+ * @return NULL if the stream is not AMR or there is no memory
+ */
+esp_tts_amr_t *esp_tts_amr_open(const esp_tts_amr_decoder_t *decoder, esp_tts_amr_read_t read, void *ctx);
+
+/**
+ * @brief Decode from memory, a partition mapped with esp_partition_mmap or an embedded file.
+ */
+esp_tts_amr_t *esp_tts_amr_open_mem(const esp_tts_amr_decoder_t *decoder, const uint8_t *data, int size);
+
+/**
+ * @brief ESP_TTS_AMR_SAMPLE_RATE, or ESP_TTS_AMR_WB_SAMPLE_RATE for an AMR-WB stream
+ */
+int esp_tts_amr_sample_rate(const esp_tts_amr_t *amr);
+
+/**
+ * @brief Decode just as many frames as the samples asked for need.
+ *
+ * @return The number of samples, 0 at the end of the stream
+ */
+int esp_tts_amr_read(esp_tts_amr_t *amr, int16_t *pcm, int samples);
+
+void esp_tts_amr_close(esp_tts_amr_t *amr);
+
+/**
+ * @brief Play a prompt held in memory to a sink, see esp_tts_service.h, a frame per sink call.
+ *        The sink runs at esp_tts_amr_sample_rate of the prompt.
+ */
+esp_err_t esp_tts_play_by_amr(const esp_tts_amr_decoder_t *decoder, const uint8_t *data, int size,
+                              esp_tts_sink_t sink, void *ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,74 @@
+// Copyright 2015-2019 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License
+#ifndef _ESP_TTS_CACHE_H_
+#define _ESP_TTS_CACHE_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+#include "esp_tts_voice.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Synthesized phrases kept as PCM, keyed by text, voice and speed, so a repeated phrase is played
+ * without parsing and synthesis. The cache holds max_bytes of PCM at most and drops the least
+ * recently used phrases to make room. It is placed in PSRAM when there is PSRAM.
+ *
+ * Not thread safe, the TTS service uses it from its synthesis task only.
+ */
+
+typedef void * esp_tts_cache_handle_t;
+
+/**
+ * @brief Create an empty cache.
+ *
+ * @param max_bytes  PCM bytes the cache holds at most
+ * @return
+ *         - NULL: out of memory
+ *         - Others: The instance of the cache
+ */
+esp_tts_cache_handle_t esp_tts_cache_create(size_t max_bytes);
+
+/**
+ * @brief Look a phrase up, a hit becomes the most recently used phrase.
+ *
+ * @param samples  The number of samples on a hit
+ * @return
+ *         - NULL: not cached
+ *         - Others: The PCM, valid until the next esp_tts_cache_add
+ */
+const int16_t *esp_tts_cache_find(esp_tts_cache_handle_t cache, const char *text, const esp_tts_voice_t *voice,
+                                  unsigned int speed, int *samples);
+
+/**
+ * @brief Store a phrase, the PCM is copied.
+ *
+ * @return
+ *         - ESP_OK
+ *         - ESP_ERR_INVALID_SIZE: larger than the whole cache
+ *         - ESP_ERR_NO_MEM
+ */
+esp_err_t esp_tts_cache_add(esp_tts_cache_handle_t cache, const char *text, const esp_tts_voice_t *voice,
+                            unsigned int speed, const int16_t *pcm, int samples);
+
+void esp_tts_cache_destroy(esp_tts_cache_handle_t cache);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
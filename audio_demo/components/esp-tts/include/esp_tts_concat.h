@@ -0,0 +1,78 @@
+// Copyright 2015-2019 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License
+#ifndef _ESP_TTS_CONCAT_H_
+#define _ESP_TTS_CONCAT_H_
+
+#include <stdio.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_tts_service.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Clips played one after the other, streamed from their files. Unlike esp_tts_stream_play_by_concat
+ * nothing is assembled: a clip is read a block at a time while the previous block plays, so the
+ * first block plays right away and the memory needed is one block.
+ *
+ * The clips are mono WAV files (PCM, 8 or 16 bit) on a mounted file system, e.g. SPIFFS or FAT.
+ * A clip whose sample rate or width differs from the first one is skipped.
+ */
+
+typedef struct {
+    const char **file_list;         // not copied
+    int file_num;
+    int index;                      // the clip being read
+    FILE *fp;
+    uint32_t left;                  // bytes of the data chunk not read yet
+    int sample_rate;                // of the first clip
+    int sample_width;               // bytes per sample, 1 or 2
+} esp_tts_concat_t;
+
+/**
+ * @brief Open the first clip that is a valid WAV file.
+ *
+ * @return
+ *         - ESP_OK: sample_rate and sample_width are set
+ *         - ESP_ERR_NOT_FOUND: none of the files is a valid clip
+ */
+esp_err_t esp_tts_concat_open(esp_tts_concat_t *concat, const char **file_list, int file_num);
+
+/**
+ * @brief Read the next block of samples, going on with the next clip at the end of one.
+ *
+ * @param pcm      16-bit samples, 8-bit clips are converted
+ * @param samples  Size of pcm
+ * @return The number of samples read, 0 after the last clip
+ */
+int esp_tts_concat_read(esp_tts_concat_t *concat, int16_t *pcm, int samples);
+
+void esp_tts_concat_close(esp_tts_concat_t *concat);
+
+/**
+ * @brief Stream the clips to a sink, see esp_tts_service.h, block by block.
+ *
+ * @param block_samples  Samples per sink call, the only buffer used
+ * @param sample_rate    The sample rate of the clips, can be NULL
+ */
+esp_err_t esp_tts_play_by_concat(const char **file_list, int file_num, esp_tts_sink_t sink, void *ctx,
+                                 int block_samples, int *sample_rate);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,79 @@
+// Copyright 2015-2019 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License
+#ifndef _ESP_TTS_MONEY_H_
+#define _ESP_TTS_MONEY_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+#include "esp_tts.h"
+#include "esp_tts_service.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Payment announcements without synthesis: the digits, the units (十 百 千 万 亿 元 角 分) and the
+ * pay mode prefixes are synthesized once at create and kept as PCM, trimmed of their silence, in PSRAM
+ * when there is PSRAM. An announcement is read out as esp_tts_parse_money would and streamed from those
+ * clips, each joined to the previous one with a short crossfade, so it starts at once and costs a
+ * copy per sample.
+ *
+ * esp_tts_money_create runs the TTS instance: call it before the instance is handed to the TTS service
+ * or while the service is idle. Playing does not use the instance.
+ */
+
+#define ESP_TTS_MONEY_XFADE_MS      6       // overlap of two clips
+#define ESP_TTS_MONEY_PAUSE_MS      150     // after the pay mode prefix
+#define ESP_TTS_MONEY_CLIP_MS       3000    // a clip is cut to this length
+
+typedef struct esp_tts_money esp_tts_money_t;
+
+/**
+ * @brief Synthesize the vocabulary, about 30 esp_tts_stream_play runs.
+ *
+ * @param voice  The voice of tts, for its sample rate
+ * @param speed  0~5, see esp_tts_stream_play
+ * @return NULL if out of memory or a clip cannot be synthesized
+ */
+esp_tts_money_t *esp_tts_money_create(esp_tts_handle_t tts, const esp_tts_voice_t *voice, unsigned int speed);
+
+/**
+ * @brief Announce an amount to a sink, see esp_tts_service.h.
+ *
+ * @param yuan           0 ~ 999999999999
+ * @param jiao           0 ~ 9
+ * @param fen            0 ~ 9
+ * @param block_samples  Samples per sink call, the only buffer used
+ * @return
+ *         - ESP_OK
+ *         - ESP_ERR_INVALID_ARG: an amount out of range
+ *         - ESP_ERR_NO_MEM
+ */
+esp_err_t esp_tts_money_play(esp_tts_money_t *money, int64_t yuan, int jiao, int fen, pay_mode_t mode,
+                             esp_tts_sink_t sink, void *ctx, int block_samples);
+
+/**
+ * @brief Bytes of PCM the clips take
+ */
+size_t esp_tts_money_size(const esp_tts_money_t *money);
+
+void esp_tts_money_destroy(esp_tts_money_t *money);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,72 @@
+// Copyright 2015-2019 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License
+#ifndef _ESP_TTS_SEGMENT_H_
+#define _ESP_TTS_SEGMENT_H_
+
+#include <stddef.h>
+#include "esp_tts.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Long text spoken segment by segment: the text is cut after punctuation, or at a character
+ * boundary when a sentence is longer than ESP_TTS_SEGMENT_MAX bytes, and every segment is parsed
+ * right before it is played. The first sound comes after parsing one segment instead of the whole
+ * text, and the parser never holds more than one segment.
+ *
+ *     esp_tts_segmenter_t seg;
+ *     esp_tts_segmenter_init(&seg, text);
+ *     while (esp_tts_parse_chinese_next(tts_handle, &seg)) {
+ *         do {
+ *             short *data = esp_tts_stream_play(tts_handle, &len, 4);
+ *             i2s_audio_play(data, len * 2, portMAX_DELAY);
+ *         } while (len > 0);
+ *     }
+ */
+
+#define ESP_TTS_SEGMENT_MAX     96      // bytes, 32 Chinese characters in UTF-8
+
+typedef struct {
+    const char *text;               // not copied, keep it until the last segment
+    size_t pos;
+    char segment[ESP_TTS_SEGMENT_MAX + 1];
+} esp_tts_segmenter_t;
+
+void esp_tts_segmenter_init(esp_tts_segmenter_t *seg, const char *text);
+
+/**
+ * @brief Cut the next segment.
+ *
+ * @return
+ *         - NULL: the text is over
+ *         - Others: The segment, NUL terminated, valid until the next call
+ */
+const char *esp_tts_segmenter_next(esp_tts_segmenter_t *seg);
+
+/**
+ * @brief esp_tts_parse_chinese on the next segment the parser takes, segments it fails on are skipped.
+ *
+ * @return
+ *         - 0: the text is over
+ *         - 1: a segment is parsed, play it with esp_tts_stream_play
+ */
+int esp_tts_parse_chinese_next(esp_tts_handle_t tts_handle, esp_tts_segmenter_t *seg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
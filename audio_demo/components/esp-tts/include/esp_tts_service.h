@@ -0,0 +1,151 @@
+// Copyright 2015-2019 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License
+#ifndef _ESP_TTS_SERVICE_H_
+#define _ESP_TTS_SERVICE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_tts.h"
+#include "esp_tts_cache.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * TTS service: utterances are queued and spoken in order without blocking the caller.
+ * A synthesis task runs esp_tts_stream_play into a ring of PCM buffers while an output task writes
+ * the filled ones to the sink, so synthesis stays up to buffer_count buffers ahead of the output.
+ * Queued utterances play back to back in one stream, keep the I2S DMA running between them and let it
+ * play silence on an underrun (tx_desc_auto_clear) rather than stop and restart it for each.
+ */
+
+typedef void * esp_tts_service_handle_t;
+
+/**
+ * @brief Write PCM to the output, blocking until it is taken, e.g. i2s_write with portMAX_DELAY.
+ *
+ * @param pcm      16-bit mono samples at the voice sample rate
+ * @param samples  Number of samples
+ * @param ctx      sink_ctx of the config
+ */
+typedef void (*esp_tts_sink_t)(const int16_t *pcm, int samples, void *ctx);
+
+typedef struct {
+    esp_tts_handle_t tts;           // created by esp_tts_create, owned by the caller
+    unsigned int speed;             // 0~5, see esp_tts_stream_play
+    esp_tts_sink_t sink;
+    void (*end)(void *ctx);         // when the last queued utterance is over, not between them; can be NULL
+    void *sink_ctx;
+    int queue_len;                  // utterances waiting at most
+    int buffer_count;               // PCM buffers, 2 for double buffering
+    int buffer_samples;             // samples per PCM buffer
+    int task_priority;              // both tasks
+    int synth_core;                 // tskNO_AFFINITY or a core
+    int output_core;
+    esp_tts_cache_handle_t cache;   // phrases played from PCM, NULL for none; owned by the caller
+    const esp_tts_voice_t *voice;   // the voice of tts, part of the cache key
+    int cache_max_samples;          // longer utterances are not cached
+    bool rate_control;              // allow esp_tts_service_set_rate, adds the stretcher to the output
+} esp_tts_service_config_t;
+
+#define ESP_TTS_SERVICE_DEFAULT_CONFIG() {  \
+    .tts = NULL,                            \
+    .speed = 4,                             \
+    .sink = NULL,                           \
+    .end = NULL,                            \
+    .sink_ctx = NULL,                       \
+    .queue_len = 4,                         \
+    .buffer_count = 2,                      \
+    .buffer_samples = 1024,                 \
+    .task_priority = 5,                     \
+    .synth_core = tskNO_AFFINITY,           \
+    .output_core = tskNO_AFFINITY,          \
+    .cache = NULL,                          \
+    .voice = NULL,                          \
+    .cache_max_samples = 48000,             \
+    .rate_control = false,                  \
+}
+
+typedef enum {
+    ESP_TTS_SAY_QUEUE = 0,          // after what is queued
+    ESP_TTS_SAY_PREEMPT,            // cancel everything first, speak now
+} esp_tts_say_mode_t;
+
+/**
+ * @brief Create the service and start its tasks.
+ *
+ * @return
+ *         - NULL: out of memory or invalid config
+ *         - Others: The instance of the service
+ */
+esp_tts_service_handle_t esp_tts_service_create(const esp_tts_service_config_t *config);
+
+/**
+ * @brief Queue a Chinese string, see esp_tts_parse_chinese. Returns at once.
+ *
+ * @param text  Copied, the caller can free it
+ * @return
+ *         - ESP_OK
+ *         - ESP_ERR_TIMEOUT: the queue is full
+ *         - ESP_ERR_NO_MEM
+ */
+esp_err_t esp_tts_service_say(esp_tts_service_handle_t service, const char *text, esp_tts_say_mode_t mode);
+
+/**
+ * @brief Queue a Chinese string without copying it, e.g. a line read straight into its own buffer.
+ *
+ * @param text  From malloc, the service frees it once spoken or dropped; on an error it stays the caller's
+ * @return
+ *         - ESP_OK
+ *         - ESP_ERR_TIMEOUT: the queue is full
+ */
+esp_err_t esp_tts_service_say_take(esp_tts_service_handle_t service, char *text, esp_tts_say_mode_t mode);
+
+/**
+ * @brief Synthesize a phrase into the cache without playing it, e.g. the prompts of the UI at boot.
+ *        Queued like an utterance, does nothing without a cache.
+ */
+esp_err_t esp_tts_service_prewarm(esp_tts_service_handle_t service, const char *text);
+
+/**
+ * @brief Stop the utterance being spoken and drop the queued ones. The sink gets no buffer of them
+ *        after this returns, except the one it is writing.
+ */
+void esp_tts_service_cancel(esp_tts_service_handle_t service);
+
+/**
+ * @brief Playback rate, 0.5~2.0, 1.5 plays 50% faster. Takes effect on the next PCM buffer, the pitch
+ *        is kept and nothing is synthesized again. Needs rate_control in the config.
+ */
+void esp_tts_service_set_rate(esp_tts_service_handle_t service, float rate);
+
+/**
+ * @brief Whether an utterance is queued, being synthesized or being played
+ */
+bool esp_tts_service_busy(esp_tts_service_handle_t service);
+
+/**
+ * @brief Cancel, stop the tasks and free the service. The TTS instance is not destroyed.
+ */
+void esp_tts_service_destroy(esp_tts_service_handle_t service);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,107 @@
+// Copyright 2015-2019 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License
+#ifndef _ESP_TTS_VOICE_PACK_H_
+#define _ESP_TTS_VOICE_PACK_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+#include "esp_tts_service.h"
+#include "esp_tts_amr.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Syllables of a voice set packed into a data partition by tools/voice_pack.py: the syllable data in
+ * fixed-size blocks, each LZ4-compressed, and the syllable names and positions. A block is read with
+ * esp_partition_read and decompressed on first use into a cache of cache_bytes, placed in PSRAM when
+ * there is PSRAM, which drops the least recently used block to make room. The syllables in use stay
+ * decompressed, playing them costs no flash access.
+ *
+ * The syllables keep the format of the voice: 16-bit PCM, or an AMR-WB stream per syllable as in the
+ * xiaole voice, which LZ4 hardly shrinks further; the cache still keeps synthesis off the flash cache.
+ *
+ * The synthesizer of esp_tts_stream_play reads esp_tts_voice_t.data directly, so it keeps its linked
+ * voice. A pack is played by esp_tts_play_by_pack, syllable by syllable from a pinyin string.
+ *
+ * Not thread safe, use a pack from one task.
+ */
+
+typedef struct esp_tts_voice_pack esp_tts_voice_pack_t;
+
+typedef struct {
+    char format[9];                 // "pcm" or "amr", as esp_tts_voice_t
+    int sample_rate;
+    int syll_num;
+    uint32_t raw_size;              // bytes of syllable data, decompressed
+    uint32_t block_size;
+    uint32_t hits;                  // block reads served by the cache
+    uint32_t misses;                // blocks read from flash and decompressed
+} esp_tts_voice_pack_info_t;
+
+/**
+ * @brief Open the pack in a data partition and allocate its cache.
+ *
+ * @param label        Partition label, with a "<label>_b" partition the active slot of part_delta
+ * @param cache_bytes  Decompressed bytes kept, rounded down to whole blocks, at least one
+ * @return NULL if there is no such partition, it holds no pack or there is no memory
+ */
+esp_tts_voice_pack_t *esp_tts_voice_pack_open(const char *label, size_t cache_bytes);
+
+/**
+ * @brief Index of a syllable by name, e.g. "hao3"
+ *
+ * @return The index, -1 if the voice has no such syllable
+ */
+int esp_tts_voice_pack_find(esp_tts_voice_pack_t *pack, const char *syll);
+
+/**
+ * @brief Bytes of syllable index
+ */
+int esp_tts_voice_pack_syll_size(esp_tts_voice_pack_t *pack, int index);
+
+/**
+ * @brief Copy bytes of a syllable from the cache, filling it from flash as needed.
+ *
+ * @param offset  First byte of the syllable to copy
+ * @return The number of bytes copied, less than len at the end of the syllable, -1 on a flash or data error
+ */
+int esp_tts_voice_pack_read(esp_tts_voice_pack_t *pack, int index, int offset, void *buf, int len);
+
+void esp_tts_voice_pack_get_info(esp_tts_voice_pack_t *pack, esp_tts_voice_pack_info_t *info);
+
+void esp_tts_voice_pack_close(esp_tts_voice_pack_t *pack);
+
+/**
+ * @brief Play pinyin syllables, e.g. "da4 jia1 hao3", back to back to a sink, see esp_tts_service.h.
+ *        Syllables the voice does not have are skipped.
+ *
+ * @param decoder        An AMR-WB decoder for an "amr" pack, see esp_tts_amr.h; NULL for "pcm"
+ * @param block_samples  Samples per sink call, the only buffer used
+ * @return
+ *         - ESP_OK
+ *         - ESP_ERR_NO_MEM
+ *         - ESP_ERR_NOT_SUPPORTED: an "amr" pack without a decoder, or another format
+ *         - ESP_FAIL: a block could not be read, what was read before it is played
+ */
+esp_err_t esp_tts_play_by_pack(esp_tts_voice_pack_t *pack, const char *pinyin, const esp_tts_amr_decoder_t *decoder,
+                               esp_tts_sink_t sink, void *ctx, int block_samples);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
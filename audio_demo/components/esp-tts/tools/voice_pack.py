@@ -0,0 +1,167 @@
+#!/usr/bin/env python
+#
+# Pack the syllables of a TTS voice set into an image of a data partition, see esp_tts_voice_pack.h and
+# the layout in esp_tts_voice_pack.c. The voice is read from an application ELF that links it, e.g. the
+# esp_chinese_tts example, through its esp_tts_voice_t.
+#
+#   python voice_pack.py build/esp_chinese_tts.elf esp_tts_voice_xiaole voice.bin --block-size 4096
+#   parttool.py write_partition --partition-name=voice --input=voice.bin
+#
+# Needs pyelftools, part of the ESP-IDF Python requirements.
+#
+import argparse
+import struct
+import sys
+
+from elftools.elf.elffile import ELFFile
+
+MAGIC = 0x4b505654  # "TVPK"
+VERSION = 1
+HEADER = struct.Struct('<10I8s')
+SYLL = struct.Struct('<8sII')
+NAME_LEN = 8
+# esp_tts_voice_t: voice_name, format, sample_rate, bit_width, syll_num, syll_pos, sylls, pinyin_idx,
+# phrase_dict, data
+VOICE = struct.Struct('<10I')
+
+
+class Image(object):
+    def __init__(self, elf):
+        self.elf = elf
+        self.symtab = elf.get_section_by_name('.symtab')
+        if self.symtab is None:
+            sys.exit('the ELF has no symbol table')
+
+    def read(self, addr, size):
+        for seg in self.elf.iter_segments():
+            start = seg['p_vaddr']
+            if seg['p_type'] == 'PT_LOAD' and start <= addr and addr + size <= start + seg['p_filesz']:
+                return seg.data()[addr - start:addr - start + size]
+        sys.exit('0x%08x: not in the image' % addr)
+
+    def u32(self, addr, count=1):
+        return struct.unpack('<%dI' % count, self.read(addr, 4 * count))
+
+    def string(self, addr):
+        out = b''
+        while True:
+            c = self.read(addr + len(out), 1)
+            if c == b'\0':
+                return out
+            out += c
+
+    def symbol(self, name):
+        syms = self.symtab.get_symbol_by_name(name)
+        if not syms:
+            sys.exit('no symbol %s' % name)
+        return syms[0]['st_value']
+
+    def object_end(self, addr):
+        for sym in self.symtab.iter_symbols():
+            if sym['st_info']['type'] == 'STT_OBJECT' and sym['st_value'] <= addr < sym['st_value'] + sym['st_size']:
+                return sym['st_value'] + sym['st_size']
+        sys.exit('0x%08x: not an object of the symbol table' % addr)
+
+
+def lz4_sequence(out, literals, offset=None, match=0):
+    lit = len(literals)
+    token = min(lit, 15) << 4
+    if offset is not None:
+        token |= min(match - 4, 15)
+    out.append(token)
+    if lit >= 15:
+        n = lit - 15
+        while n >= 255:
+            out.append(255)
+            n -= 255
+        out.append(n)
+    out += literals
+    if offset is not None:
+        out += struct.pack('<H', offset)
+        if match - 4 >= 15:
+            n = match - 4 - 15
+            while n >= 255:
+                out.append(255)
+                n -= 255
+            out.append(n)
+
+
+def lz4_block(src):
+    # greedy, one candidate per 4-byte sequence; the last match ends 5 bytes before the end and starts
+    # 12 before it, as the format asks
+    out = bytearray()
+    table = {}
+    anchor = 0
+    i = 0
+    end = len(src) - 5
+    while i < len(src) - 12:
+        key = src[i:i + 4]
+        ref = table.get(key)
+        table[key] = i
+        if ref is None or i - ref > 65535:
+            i += 1
+            continue
+        m = 4
+        while i + m < end and src[ref + m] == src[i + m]:
+            m += 1
+        lz4_sequence(out, src[anchor:i], i - ref, m)
+        i += m
+        anchor = i
+    lz4_sequence(out, src[anchor:])
+    return bytes(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='TTS voice pack partition image')
+    parser.add_argument('elf', help='application ELF that links the voice')
+    parser.add_argument('voice', help='the esp_tts_voice_t, e.g. esp_tts_voice_xiaole')
+    parser.add_argument('output')
+    parser.add_argument('--block-size', type=lambda s: int(s, 0), default=4096,
+                        help='decompressed bytes per block, the unit of the cache')
+    parser.add_argument('--size', type=lambda s: int(s, 0), help='check it fits the partition')
+    args = parser.parse_args()
+
+    img = Image(ELFFile(open(args.elf, 'rb')))
+    (_, fmt, rate, width, syll_num, syll_pos, sylls, _, _, data) = VOICE.unpack(img.read(img.symbol(args.voice), VOICE.size))
+    fmt = img.string(fmt)
+    if fmt not in (b'pcm', b'amr') or width != 16:
+        sys.exit('%s: %s %d bit, packs hold 16 bit pcm or amr voices' % (args.voice, fmt.decode(), width))
+    # the data array is an object of its own and bounds the last syllable when syll_pos has no end entry
+    raw = img.read(data, img.object_end(data) - data)
+    pos = img.u32(syll_pos, min((img.object_end(syll_pos) - syll_pos) // 4, syll_num + 1))
+    pos = pos if len(pos) > syll_num else pos + (len(raw),)
+    names = [img.string(p) for p in img.u32(sylls, syll_num)]
+
+    table = bytearray()
+    for i, name in enumerate(names):
+        if len(name) > NAME_LEN or pos[i + 1] < pos[i]:
+            sys.exit('syllable %d (%s) does not fit the pack' % (i, name.decode()))
+        table += SYLL.pack(name, pos[i], pos[i + 1] - pos[i])
+
+    blocks = []
+    for start in range(0, len(raw), args.block_size):
+        chunk = raw[start:start + args.block_size]
+        packed = lz4_block(chunk)
+        blocks.append(packed if len(packed) < len(chunk) else chunk)
+    index = [0]
+    for b in blocks:
+        index.append(index[-1] + len(b))
+
+    syll_offset = HEADER.size
+    index_offset = syll_offset + len(table)
+    data_offset = index_offset + 4 * len(index)
+    out = bytearray(HEADER.pack(MAGIC, VERSION, args.block_size, len(blocks), len(raw), syll_num, rate,
+                                syll_offset, index_offset, data_offset, fmt))
+    out += table
+    out += struct.pack('<%dI' % len(index), *index)
+    for b in blocks:
+        out += b
+    if args.size is not None and len(out) > args.size:
+        sys.exit('%d bytes do not fit the %d byte partition' % (len(out), args.size))
+    open(args.output, 'wb').write(out)
+    print('%s: %s, %d syllables, %d bytes in %d blocks of %d, %d bytes packed' %
+          (args.output, fmt.decode(), syll_num, len(raw), len(blocks), args.block_size, len(out)))
+
+
+if __name__ == '__main__':
+    main()
@@ -25,6 +25,7 @@
 #include "ES8374_interface.h"
 #include "esp_system.h"
 #include "esp_log.h"
+#include "ESCodec_regcache.h"
 
 #define ES8374_TAG "8374"
 
@@ -36,6 +37,9 @@
 
 #define LOG_8374(fmt, ...)   ESP_LOGW(ES8374_TAG, fmt, ##__VA_ARGS__)
 
+// 0x00 bits 0 - 5 are the reset bits, 0x80 alone only starts the chip
+static EsRegCache es8374_regs = ES_REG_CACHE_DEFAULT(ES8374_ADDR, 0x00, 0x3F);
+
 /**
  * @brief Write ES8374 register
  *
@@ -49,15 +53,7 @@
  */
 int Es8374WriteReg(uint8_t slaveAdd, uint8_t regAdd, uint8_t data)
 {
-    int res = 0;
-    i2c_cmd_handle_t cmd = i2c_cmd_link_create();
-    res |= i2c_master_start(cmd);
-    res |= i2c_master_write_byte(cmd, slaveAdd, 1 /*ACK_CHECK_EN*/);
-    res |= i2c_master_write_byte(cmd, regAdd, 1 /*ACK_CHECK_EN*/);
-    res |= i2c_master_write_byte(cmd, data, 1 /*ACK_CHECK_EN*/);
-    res |= i2c_master_stop(cmd);
-    res |= i2c_master_cmd_begin(0, cmd, 1000 / portTICK_RATE_MS);
-    i2c_cmd_link_delete(cmd);
+    int res = EsRegCacheWrite(&es8374_regs, regAdd, data);
     ES_ASSERT(res, "ESCodecWriteReg error", -1);
     return res;
 }
@@ -75,27 +71,8 @@ int Es8374WriteReg(uint8_t slaveAdd, uint8_t regAdd, uint8_t data)
  */
 int Es8374ReadReg(uint8_t slaveAdd, uint8_t regAdd, uint8_t *pData)
 {
-    uint8_t data;
-    int res = 0;
-    i2c_cmd_handle_t cmd = i2c_cmd_link_create();
-
-    res |= i2c_master_start(cmd);
-    res |= i2c_master_write_byte(cmd, slaveAdd, 1 /*ACK_CHECK_EN*/);
-    res |= i2c_master_write_byte(cmd, regAdd, 1 /*ACK_CHECK_EN*/);
-    res |= i2c_master_stop(cmd);
-    res |= i2c_master_cmd_begin(0, cmd, 1000 / portTICK_RATE_MS);
-    i2c_cmd_link_delete(cmd);
-
-    cmd = i2c_cmd_link_create();
-    res |= i2c_master_start(cmd);
-    res |= i2c_master_write_byte(cmd, slaveAdd | 0x01, 1 /*ACK_CHECK_EN*/);
-    res |= i2c_master_read_byte(cmd, &data, 0x01/*NACK_VAL*/);
-    res |= i2c_master_stop(cmd);
-    res |= i2c_master_cmd_begin(0, cmd, 1000 / portTICK_RATE_MS);
-    i2c_cmd_link_delete(cmd);
-
+    int res = EsRegCacheRead(&es8374_regs, regAdd, pData);
     ES_ASSERT(res, "Es8374ReadReg error", -1);
-    *pData = data;
     return res;
 }
 
@@ -172,6 +149,7 @@ int Es8374SetBitsPerSample(ESCodecModule mode, BitsLength bitPerSample)
     uint8_t reg = 0;
     int bits = (int)bitPerSample & 0x0f;
 
+    EsRegCacheBatchBegin(&es8374_regs);
     if (mode == ES_MODULE_ADC || mode == ES_MODULE_ADC_DAC) {
         res |= ES8374ReadReg(0x10, &reg);
         if(res == 0) {
@@ -187,6 +165,7 @@ int Es8374SetBitsPerSample(ESCodecModule mode, BitsLength bitPerSample)
         }
     }
 
+    res |= EsRegCacheBatchEnd(&es8374_regs);
     return res;
 }
 
@@ -196,6 +175,7 @@ int Es8374ConfigFmt(ESCodecModule mode, ESCodecI2SFmt fmt)
     uint8_t reg = 0;
     int fmt_tmp,fmt_i2s;
 
+    EsRegCacheBatchBegin(&es8374_regs);
     fmt_tmp = ((fmt & 0xf0) >> 4);
     fmt_i2s =  fmt & 0x0f;
     if (mode == ES_MODULE_ADC || mode == ES_MODULE_ADC_DAC) {
@@ -215,6 +195,7 @@ int Es8374ConfigFmt(ESCodecModule mode, ESCodecI2SFmt fmt)
         }
     }
 
+    res |= EsRegCacheBatchEnd(&es8374_regs);
     return res;
 }
 
@@ -223,6 +204,7 @@ int Es8374Start(ESCodecModule mode)
     int res = 0;
     uint8_t reg = 0;
 
+    EsRegCacheBatchBegin(&es8374_regs);
     if (mode == ES_MODULE_LINE) {
         res |= ES8374ReadReg(0x1a, &reg);       //set monomixer
         reg |= 0x60;
@@ -267,6 +249,7 @@ int Es8374Start(ESCodecModule mode)
         res |= Es8374SetVoiceMute(false);
     }
 
+    res |= EsRegCacheBatchEnd(&es8374_regs);
     return res;
 }
 
@@ -276,6 +259,7 @@ int Es8374Stop(ESCodecModule mode)
     int res = 0;
     uint8_t reg = 0;
 
+    EsRegCacheBatchBegin(&es8374_regs);
     if (mode == ES_MODULE_LINE) {
         res |= ES8374ReadReg(0x1a, &reg);       //disable lout
         reg |= 0x08;
@@ -313,6 +297,7 @@ int Es8374Stop(ESCodecModule mode)
         res |= ES8374WriteReg(0x21,reg);
     }
 
+    res |= EsRegCacheBatchEnd(&es8374_regs);
     return res;
 }
 
@@ -672,6 +657,7 @@ int Es8374InitReg(ESCodecMode ms_mode, ESCodecI2SFmt fmt, ESCodecI2sClock cfg, D
     int res = 0;
     uint8_t reg;
 
+    EsRegCacheBatchBegin(&es8374_regs);
     res |= ES8374WriteReg(0x00,0x3F); //IC Rst start
     res |= ES8374WriteReg(0x00,0x03); //IC Rst stop
     res |= ES8374WriteReg(0x01,0x7F); //IC clk on
@@ -733,6 +719,7 @@ int Es8374InitReg(ESCodecMode ms_mode, ESCodecI2SFmt fmt, ESCodecI2sClock cfg, D
 
     res |= ES8374WriteReg(0x37,0x00); // dac set
 
+    res |= EsRegCacheBatchEnd(&es8374_regs);
     return res;
 }
 
@@ -745,6 +732,7 @@ int Es8374Init(Es8374Config *cfg)
     clkdiv.sclkDiv = MclkDiv_4;
 
     Es8374I2cInit(&cfg->i2c_cfg, cfg->i2c_port_num); // ESP32 in master mode
+    res |= EsRegCacheInit(&es8374_regs, NULL, 0);
 
     res |= Es8374Stop(ES_MODULE_ADC_DAC);
     res |= Es8374InitReg(cfg->esMode, (BIT_LENGTH_16BITS << 4) | ES_I2S_NORMAL, clkdiv,
@@ -26,6 +26,7 @@
 #include "esp_log.h"
 #include "driver/i2c.h"
 #include "ES8388_interface.h"
+#include "ESCodec_regcache.h"
 
 #define ES8388_TAG "8388"
 
@@ -37,6 +38,9 @@
 
 #define LOG_8388(fmt, ...)   ESP_LOGW(ES8388_TAG, fmt, ##__VA_ARGS__)
 
+// CONTROL1 bit 7 is SCPReset, it puts every register back to default
+static EsRegCache es8388_regs = ES_REG_CACHE_DEFAULT(ES8388_ADDR, ES8388_CONTROL1, 0x80);
+
 /**
  * @brief Write ES8388 register
  *
@@ -50,15 +54,7 @@
  */
 static int Es8388WriteReg(uint8_t slaveAdd, uint8_t regAdd, uint8_t data)
 {
-    int res = 0;
-    i2c_cmd_handle_t cmd = i2c_cmd_link_create();
-    res |= i2c_master_start(cmd);
-    res |= i2c_master_write_byte(cmd, slaveAdd, 1 /*ACK_CHECK_EN*/);
-    res |= i2c_master_write_byte(cmd, regAdd, 1 /*ACK_CHECK_EN*/);
-    res |= i2c_master_write_byte(cmd, data, 1 /*ACK_CHECK_EN*/);
-    res |= i2c_master_stop(cmd);
-    res |= i2c_master_cmd_begin(0, cmd, 1000 / portTICK_RATE_MS);
-    i2c_cmd_link_delete(cmd);
+    int res = EsRegCacheWrite(&es8388_regs, regAdd, data);
     ES_ASSERT(res, "Es8388WriteReg error", -1);
     return res;
 }
@@ -74,27 +70,8 @@ static int Es8388WriteReg(uint8_t slaveAdd, uint8_t regAdd, uint8_t data)
  */
 static int Es8388ReadReg(uint8_t regAdd, uint8_t *pData)
 {
-    uint8_t data;
-    int res = 0;
-    i2c_cmd_handle_t cmd = i2c_cmd_link_create();
-
-    res |= i2c_master_start(cmd);
-    res |= i2c_master_write_byte(cmd, ES8388_ADDR, 1 /*ACK_CHECK_EN*/);
-    res |= i2c_master_write_byte(cmd, regAdd, 1 /*ACK_CHECK_EN*/);
-    res |= i2c_master_stop(cmd);
-    res |= i2c_master_cmd_begin(0, cmd, 1000 / portTICK_RATE_MS);
-    i2c_cmd_link_delete(cmd);
-
-    cmd = i2c_cmd_link_create();
-    res |= i2c_master_start(cmd);
-    res |= i2c_master_write_byte(cmd, ES8388_ADDR | 0x01, 1 /*ACK_CHECK_EN*/);
-    res |= i2c_master_read_byte(cmd, &data, 0x01/*NACK_VAL*/);
-    res |= i2c_master_stop(cmd);
-    res |= i2c_master_cmd_begin(0, cmd, 1000 / portTICK_RATE_MS);
-    i2c_cmd_link_delete(cmd);
-
+    int res = EsRegCacheRead(&es8388_regs, regAdd, pData);
     ES_ASSERT(res, "Es8388ReadReg error", -1);
-    *pData = data;
     return res;
 }
 
@@ -164,6 +141,7 @@ int Es8388Start(ESCodecModule mode)
 {
     int res = 0;
     uint8_t prevData = 0, data = 0;
+    EsRegCacheBatchBegin(&es8388_regs);
     Es8388ReadReg(ES8388_DACCONTROL21, &prevData);
     if (mode == ES_MODULE_LINE) {
         res |= Es8388WriteReg(ES8388_ADDR, ES8388_DACCONTROL16, 0x09); // 0x00 audio on LIN1&RIN1,  0x09 LIN2&RIN2 by pass enable
@@ -188,7 +166,7 @@ int Es8388Start(ESCodecModule mode)
         res |= Es8388SetVoiceMute(false);
         //res |= Es8388SetAdcDacVolume(ES_MODULE_DAC, 0, 0);      // 0db
     }
-
+    res |= EsRegCacheBatchEnd(&es8388_regs);
     return res;
 }
 /**
@@ -204,11 +182,13 @@ int Es8388Start(ESCodecModule mode)
 int Es8388Stop(ESCodecModule mode)
 {
     int res = 0;
+    EsRegCacheBatchBegin(&es8388_regs);
     if (mode == ES_MODULE_LINE) {
         res |= Es8388WriteReg(ES8388_ADDR, ES8388_DACCONTROL21, 0x80); //enable dac
         res |= Es8388WriteReg(ES8388_ADDR, ES8388_DACCONTROL16, 0x00); // 0x00 audio on LIN1&RIN1,  0x09 LIN2&RIN2
         res |= Es8388WriteReg(ES8388_ADDR, ES8388_DACCONTROL17, 0x90); // only left DAC to left mixer enable 0db
         res |= Es8388WriteReg(ES8388_ADDR, ES8388_DACCONTROL20, 0x90); // only right DAC to right mixer enable 0db
+        res |= EsRegCacheBatchEnd(&es8388_regs);
         return res;
     }
     if (mode == ES_MODULE_DAC || mode == ES_MODULE_ADC_DAC) {
@@ -227,10 +207,69 @@ int Es8388Stop(ESCodecModule mode)
 //        res |= Es8388WriteReg(ES8388_ADDR, ES8388_CONTROL2, 0x58);
 //        res |= Es8388WriteReg(ES8388_ADDR, ES8388_CHIPPOWER, 0xF3);  //stop state machine
     }
-
+    res |= EsRegCacheBatchEnd(&es8388_regs);
     return res;
 }
 
+/*
+ * Standby keeps the ADC and DAC references up and every register in the cache, and powers down the
+ * converters, the outputs, the DLLs and the digital blocks, with the reference buffer in low power
+ * (CONTROL2 0x58). Leaving it writes the saved values back in reverse order in one I2C transaction,
+ * restarting the state machine on the way as Es8388Start does
+ */
+static const uint8_t es8388_standby_regs[] = {
+    ES8388_DACCONTROL3, ES8388_DACPOWER, ES8388_ADCPOWER, ES8388_CHIPPOWER, ES8388_CONTROL2,
+};
+static const uint8_t es8388_standby_vals[] = {
+    0x04, 0xC0, 0xFF, 0xCC, 0x58,
+};
+static uint8_t es8388_standby_saved[sizeof(es8388_standby_regs)];
+static int es8388_standby;
+
+/**
+ * @brief Low-power standby with the references kept biased
+ *
+ * @param enable:   1 enter, 0 leave and restore what was running
+ *
+ * @return
+ *     - (-1)  Error
+ *     - (0)   Success
+ */
+int Es8388Standby(int enable)
+{
+    int res = 0;
+    int n = sizeof(es8388_standby_regs);
+    if (enable == es8388_standby) {
+        return 0;
+    }
+    EsRegCacheBatchBegin(&es8388_regs);
+    if (enable) {
+        for (int i = 0; i < n; i++) {
+            res |= Es8388ReadReg(es8388_standby_regs[i], &es8388_standby_saved[i]);
+        }
+        if (res != 0) {
+            EsRegCacheBatchEnd(&es8388_regs);
+            return -1;
+        }
+        // DACCONTROL3 keeps its ramp bits, only the mute is forced
+        res |= Es8388WriteReg(ES8388_ADDR, ES8388_DACCONTROL3, es8388_standby_saved[0] | es8388_standby_vals[0]);
+        for (int i = 1; i < n; i++) {
+            res |= Es8388WriteReg(ES8388_ADDR, es8388_standby_regs[i], es8388_standby_vals[i]);
+        }
+    } else {
+        for (int i = n - 1; i >= 0; i--) {
+            if (es8388_standby_regs[i] == ES8388_CHIPPOWER) {
+                res |= Es8388WriteReg(ES8388_ADDR, ES8388_CHIPPOWER, 0xF0);   //start state machine
+            }
+            res |= Es8388WriteReg(ES8388_ADDR, es8388_standby_regs[i], es8388_standby_saved[i]);
+        }
+    }
+    res |= EsRegCacheBatchEnd(&es8388_regs);
+    if (res == 0) {
+        es8388_standby = enable;
+    }
+    return res;
+}
 
 /**
  * @brief Config I2s clock in MSATER mode
@@ -245,14 +284,17 @@ int Es8388Stop(ESCodecModule mode)
 int Es8388I2sConfigClock(ESCodecI2sClock cfg)
 {
     int res = 0;
+    EsRegCacheBatchBegin(&es8388_regs);
     res |= Es8388WriteReg(ES8388_ADDR, ES8388_MASTERMODE, cfg.sclkDiv);
     res |= Es8388WriteReg(ES8388_ADDR, ES8388_ADCCONTROL5, cfg.lclkDiv);  //ADCFsMode,singel SPEED,RATIO=256
     res |= Es8388WriteReg(ES8388_ADDR, ES8388_DACCONTROL2, cfg.lclkDiv);  //ADCFsMode,singel SPEED,RATIO=256
+    res |= EsRegCacheBatchEnd(&es8388_regs);
     return res;
 }
 
 void Es8388Uninit()
 {
+    es8388_standby = 0;
     Es8388WriteReg(ES8388_ADDR, ES8388_CHIPPOWER, 0xFF);  //reset and stop es8388
     // i2c_driver_delete(cfg->i2c_port_num);
 }
@@ -266,6 +308,8 @@ int Es8388Init(Es8388Config *cfg)
 {
     int res = 0;
     res = I2cInit(&cfg->i2c_cfg, cfg->i2c_port_num); // ESP32 in master mode
+    res |= EsRegCacheInit(&es8388_regs, NULL, 0);
+    EsRegCacheBatchBegin(&es8388_regs);
     res |= Es8388WriteReg(ES8388_ADDR, ES8388_DACCONTROL3, 0x04);  // 0x04 mute/0x00 unmute&ramp;DAC unmute and  disabled digital volume control soft ramp
     /* Chip Control and Power Management */
     res |= Es8388WriteReg(ES8388_ADDR, ES8388_CONTROL2, 0x50);
@@ -295,6 +339,7 @@ int Es8388Init(Es8388Config *cfg)
     //ALC for Microphone
     res |= Es8388SetAdcDacVolume(ES_MODULE_ADC, 0, 0);      // 0db
     res |= Es8388WriteReg(ES8388_ADDR, ES8388_ADCPOWER, 0x09); //Power up ADC, Enable LIN&RIN, Power down MICBIAS, set int1lp to low power mode
+    res |= EsRegCacheBatchEnd(&es8388_regs);
     /* stop all */
 //    Es8388Stop(ES_MODULE_ADC_DAC);
     return res;
@@ -314,6 +359,7 @@ int Es8388ConfigFmt(ESCodecModule mode, ESCodecI2SFmt fmt)
 {
     int res = 0;
     uint8_t reg = 0;
+    EsRegCacheBatchBegin(&es8388_regs);
     if (mode == ES_MODULE_ADC || mode == ES_MODULE_ADC_DAC) {
         res = Es8388ReadReg(ES8388_ADCCONTROL4, &reg);
         reg = reg & 0xfc;
@@ -324,6 +370,7 @@ int Es8388ConfigFmt(ESCodecModule mode, ESCodecI2SFmt fmt)
         reg = reg & 0xf9;
         res |= Es8388WriteReg(ES8388_ADDR, ES8388_DACCONTROL1, reg | (fmt << 1));
     }
+    res |= EsRegCacheBatchEnd(&es8388_regs);
     return res;
 }
 
@@ -342,10 +389,12 @@ int Es8388SetVoiceVolume(int volume)
     else if (volume > 100)
         volume = 100;
     volume /= 3;
+    EsRegCacheBatchBegin(&es8388_regs);
     res = Es8388WriteReg(ES8388_ADDR, ES8388_DACCONTROL24, volume);
     res |= Es8388WriteReg(ES8388_ADDR, ES8388_DACCONTROL25, volume);  //ADC Right Volume=0db
     res |= Es8388WriteReg(ES8388_ADDR, ES8388_DACCONTROL26, 0);
     res |= Es8388WriteReg(ES8388_ADDR, ES8388_DACCONTROL27, 0);
+    res |= EsRegCacheBatchEnd(&es8388_regs);
     return res;
 }
 /**
@@ -385,6 +434,7 @@ int Es8388SetBitsPerSample(ESCodecModule mode, BitsLength bitPerSample)
     uint8_t reg = 0;
     int bits = (int)bitPerSample;
 
+    EsRegCacheBatchBegin(&es8388_regs);
     if (mode == ES_MODULE_ADC || mode == ES_MODULE_ADC_DAC) {
         res = Es8388ReadReg(ES8388_ADCCONTROL4, &reg);
         reg = reg & 0xe3;
@@ -395,6 +445,7 @@ int Es8388SetBitsPerSample(ESCodecModule mode, BitsLength bitPerSample)
         reg = reg & 0xc7;
         res |= Es8388WriteReg(ES8388_ADDR, ES8388_DACCONTROL1, reg | (bits << 3));
     }
+    res |= EsRegCacheBatchEnd(&es8388_regs);
     return res;
 }
 
@@ -134,6 +134,11 @@ int Es8388SetBitsPerSample(ESCodecModule mode, BitsLength bitPerSample);
 int Es8388Start(ESCodecModule mode);
 int Es8388Stop(ESCodecModule mode);
 
+/**
+ * @brief Low-power standby with the references kept biased and the registers kept, see MediaHalStandby
+ */
+int Es8388Standby(int enable);
+
 int Es8388SetVoiceVolume(int volume);
 int Es8388GetVoiceVolume(int *volume);
 int Es8388SetVoiceMute(int enable);
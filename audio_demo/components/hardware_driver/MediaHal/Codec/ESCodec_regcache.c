@@ -0,0 +1,280 @@
+/*
+ * ESPRESSIF MIT License
+ *
+ * Copyright (c) 2018 <ESPRESSIF SYSTEMS (SHANGHAI) PTE LTD>
+ *
+ * Permission is hereby granted for use on all ESPRESSIF SYSTEMS products, in which case,
+ * it is free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <string.h>
+#include "esp_log.h"
+#include "ESCodec_regcache.h"
+
+#define REGCACHE_TAG "ES_REGCACHE"
+
+#define REG_BIT(map, reg)       ((map)[(reg) >> 5] & (1u << ((reg) & 31)))
+#define REG_SET(map, reg)       ((map)[(reg) >> 5] |= (1u << ((reg) & 31)))
+#define REG_CLR(map, reg)       ((map)[(reg) >> 5] &= ~(1u << ((reg) & 31)))
+
+static void RegCacheLock(EsRegCache *c)
+{
+    if (c->lock) {
+        xSemaphoreTakeRecursive(c->lock, portMAX_DELAY);
+    }
+}
+
+static void RegCacheUnlock(EsRegCache *c)
+{
+    if (c->lock) {
+        xSemaphoreGiveRecursive(c->lock);
+    }
+}
+
+static int RegCacheCmdBegin(EsRegCache *c, i2c_cmd_handle_t cmd)
+{
+    if (c->bus) {
+        return i2c_arb_cmd_begin(c->bus, cmd, 1000);
+    }
+    return i2c_master_cmd_begin(ES_REG_CACHE_I2C_PORT, cmd, 1000 / portTICK_RATE_MS);
+}
+
+static int RegCacheBusWrite(EsRegCache *c, uint8_t regAdd, uint8_t data)
+{
+    int res = 0;
+    i2c_cmd_handle_t cmd = i2c_cmd_link_create();
+    res |= i2c_master_start(cmd);
+    res |= i2c_master_write_byte(cmd, c->addr, 1 /*ACK_CHECK_EN*/);
+    res |= i2c_master_write_byte(cmd, regAdd, 1 /*ACK_CHECK_EN*/);
+    res |= i2c_master_write_byte(cmd, data, 1 /*ACK_CHECK_EN*/);
+    res |= i2c_master_stop(cmd);
+    res |= RegCacheCmdBegin(c, cmd);
+    i2c_cmd_link_delete(cmd);
+    if (res) {
+        ESP_LOGE(REGCACHE_TAG, "write reg 0x%02x of 0x%02x failed", regAdd, c->addr);
+        return -1;
+    }
+    return 0;
+}
+
+static int RegCacheBusRead(EsRegCache *c, uint8_t regAdd, uint8_t *pData)
+{
+    uint8_t data = 0;
+    int res = 0;
+    // no other device between the register address and the read
+    if (c->bus && i2c_arb_acquire(c->bus, 1000) != ESP_OK) {
+        ESP_LOGE(REGCACHE_TAG, "read reg 0x%02x of 0x%02x: bus busy", regAdd, c->addr);
+        return -1;
+    }
+    i2c_cmd_handle_t cmd = i2c_cmd_link_create();
+
+    res |= i2c_master_start(cmd);
+    res |= i2c_master_write_byte(cmd, c->addr, 1 /*ACK_CHECK_EN*/);
+    res |= i2c_master_write_byte(cmd, regAdd, 1 /*ACK_CHECK_EN*/);
+    res |= i2c_master_stop(cmd);
+    res |= RegCacheCmdBegin(c, cmd);
+    i2c_cmd_link_delete(cmd);
+
+    cmd = i2c_cmd_link_create();
+    res |= i2c_master_start(cmd);
+    res |= i2c_master_write_byte(cmd, c->addr | 0x01, 1 /*ACK_CHECK_EN*/);
+    res |= i2c_master_read_byte(cmd, &data, 0x01 /*NACK_VAL*/);
+    res |= i2c_master_stop(cmd);
+    res |= RegCacheCmdBegin(c, cmd);
+    i2c_cmd_link_delete(cmd);
+    if (c->bus) {
+        i2c_arb_release(c->bus);
+    }
+
+    if (res) {
+        ESP_LOGE(REGCACHE_TAG, "read reg 0x%02x of 0x%02x failed", regAdd, c->addr);
+        return -1;
+    }
+    *pData = data;
+    return 0;
+}
+
+/*
+ * Send what the open batch holds: one start, address, register, data per write, back to back
+ * with repeated starts, and a single stop, so the whole sequence costs one cmd_begin
+ */
+static void RegCacheFlush(EsRegCache *c)
+{
+    if (c->batch == NULL) {
+        return;
+    }
+    int res = i2c_master_stop(c->batch);
+    res |= RegCacheCmdBegin(c, c->batch);
+    i2c_cmd_link_delete(c->batch);
+    c->batch = NULL;
+    if (res) {
+        // no telling which writes made it, the chip has to be read again
+        ESP_LOGE(REGCACHE_TAG, "batch of %d writes to 0x%02x failed", c->batch_count, c->addr);
+        memset(c->valid, 0, sizeof(c->valid));
+        c->batch_res = -1;
+    }
+    c->batch_count = 0;
+}
+
+static int RegCacheQueue(EsRegCache *c, uint8_t regAdd, uint8_t data)
+{
+    if (c->batch == NULL) {
+        c->batch = i2c_cmd_link_create();
+        if (c->batch == NULL) {
+            return RegCacheBusWrite(c, regAdd, data);
+        }
+    }
+    int res = i2c_master_start(c->batch);
+    res |= i2c_master_write_byte(c->batch, c->addr, 1 /*ACK_CHECK_EN*/);
+    res |= i2c_master_write_byte(c->batch, regAdd, 1 /*ACK_CHECK_EN*/);
+    res |= i2c_master_write_byte(c->batch, data, 1 /*ACK_CHECK_EN*/);
+    if (res) {
+        return -1;
+    }
+    if (++c->batch_count >= ES_REG_CACHE_BATCH_MAX) {
+        RegCacheFlush(c);
+    }
+    return 0;
+}
+
+int EsRegCacheInit(EsRegCache *c, const uint8_t *volatile_regs, int count)
+{
+    if (c->lock == NULL) {
+        c->lock = xSemaphoreCreateRecursiveMutex();
+        if (c->lock == NULL) {
+            ESP_LOGE(REGCACHE_TAG, "create lock failed");
+            return -1;
+        }
+    }
+    RegCacheLock(c);
+    memset(c->valid, 0, sizeof(c->valid));
+    memset(c->volatile_map, 0, sizeof(c->volatile_map));
+    for (int i = 0; i < count; i++) {
+        REG_SET(c->volatile_map, volatile_regs[i]);
+    }
+    REG_SET(c->volatile_map, c->reset_reg);
+    RegCacheUnlock(c);
+    return 0;
+}
+
+void EsRegCacheDeinit(EsRegCache *c)
+{
+    if (c->lock == NULL) {
+        return;
+    }
+    RegCacheLock(c);
+    RegCacheFlush(c);
+    c->batch_depth = 0;
+    memset(c->valid, 0, sizeof(c->valid));
+    xSemaphoreHandle lock = c->lock;
+    c->lock = NULL;
+    xSemaphoreGiveRecursive(lock);
+    vSemaphoreDelete(lock);
+}
+
+void EsRegCacheInvalidate(EsRegCache *c)
+{
+    RegCacheLock(c);
+    memset(c->valid, 0, sizeof(c->valid));
+    RegCacheUnlock(c);
+}
+
+int EsRegCacheWrite(EsRegCache *c, uint8_t regAdd, uint8_t data)
+{
+    int res;
+    RegCacheLock(c);
+    if (c->batch_depth > 0) {
+        res = RegCacheQueue(c, regAdd, data);
+    } else {
+        res = RegCacheBusWrite(c, regAdd, data);
+    }
+    if (c->lock == NULL) {
+        // not initialized, nothing is cached
+    } else if (regAdd == c->reset_reg) {
+        if (data & c->reset_mask) {
+            memset(c->valid, 0, sizeof(c->valid));
+        }
+    } else if (res == 0 && !REG_BIT(c->volatile_map, regAdd)) {
+        c->val[regAdd] = data;
+        REG_SET(c->valid, regAdd);
+    } else {
+        REG_CLR(c->valid, regAdd);
+    }
+    RegCacheUnlock(c);
+    return res;
+}
+
+int EsRegCacheRead(EsRegCache *c, uint8_t regAdd, uint8_t *pData)
+{
+    int res = 0;
+    RegCacheLock(c);
+    if (c->lock && REG_BIT(c->valid, regAdd)) {
+        *pData = c->val[regAdd];
+    } else {
+        // the chip has to see the queued writes before it is asked
+        RegCacheFlush(c);
+        res = RegCacheBusRead(c, regAdd, pData);
+        if (res == 0 && c->lock && !REG_BIT(c->volatile_map, regAdd)) {
+            c->val[regAdd] = *pData;
+            REG_SET(c->valid, regAdd);
+        }
+    }
+    RegCacheUnlock(c);
+    return res;
+}
+
+int EsRegCacheUpdate(EsRegCache *c, uint8_t regAdd, uint8_t mask, uint8_t data)
+{
+    uint8_t reg = 0;
+    RegCacheLock(c);
+    int res = EsRegCacheRead(c, regAdd, &reg);
+    if (res == 0) {
+        uint8_t next = (reg & ~mask) | (data & mask);
+        if (next != reg || !REG_BIT(c->valid, regAdd)) {
+            res = EsRegCacheWrite(c, regAdd, next);
+        }
+    }
+    RegCacheUnlock(c);
+    return res;
+}
+
+void EsRegCacheBatchBegin(EsRegCache *c)
+{
+    RegCacheLock(c);
+    if (c->lock == NULL) {
+        return;
+    }
+    if (c->batch_depth++ == 0) {
+        c->batch_res = 0;
+        c->batch_count = 0;
+    }
+}
+
+int EsRegCacheBatchEnd(EsRegCache *c)
+{
+    int res = 0;
+    if (c->lock == NULL || c->batch_depth == 0) {
+        return 0;
+    }
+    if (--c->batch_depth == 0) {
+        RegCacheFlush(c);
+        res = c->batch_res;
+    }
+    RegCacheUnlock(c);
+    return res;
+}
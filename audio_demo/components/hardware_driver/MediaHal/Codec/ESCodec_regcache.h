@@ -0,0 +1,101 @@
+/*
+ * ESPRESSIF MIT License
+ *
+ * Copyright (c) 2018 <ESPRESSIF SYSTEMS (SHANGHAI) PTE LTD>
+ *
+ * Permission is hereby granted for use on all ESPRESSIF SYSTEMS products, in which case,
+ * it is free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef __ESCODEC_REGCACHE_H__
+#define __ESCODEC_REGCACHE_H__
+
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "driver/i2c.h"
+#include "i2c_arb.h"
+
+#define ES_REG_CACHE_I2C_PORT   0
+#define ES_REG_CACHE_BATCH_MAX  32      // writes queued before a batch goes out on its own
+
+/*
+ * Shadow of the 8 bit registers of one codec. Reads of a known register are served from it,
+ * writes inside EsRegCacheBatchBegin/End go out as one I2C command link
+ */
+typedef struct {
+    uint8_t addr;                   // 7 bit address << 1, as ES8311_ADDR
+    i2c_arb_dev_t *bus;             // shared bus arbitration, NULL: ES_REG_CACHE_I2C_PORT owned by the codec alone
+    uint8_t reset_reg;              // never cached, a write to it with a reset_mask bit set forgets the cache
+    uint8_t reset_mask;
+    uint8_t val[256];
+    uint32_t valid[8];
+    uint32_t volatile_map[8];       // registers the chip changes by itself, always read from the bus
+    xSemaphoreHandle lock;
+    i2c_cmd_handle_t batch;
+    int batch_depth;
+    int batch_count;
+    int batch_res;
+} EsRegCache;
+
+#define ES_REG_CACHE_DEFAULT(slave, reset, mask) { .addr = (slave), .reset_reg = (reset), .reset_mask = (mask) }
+
+/**
+ * @brief Create the lock and forget every cached value. Before it the cache passes every access to the bus
+ *
+ * @param volatile_regs : registers never served from the cache, can be NULL
+ * @param count         : number of volatile_regs
+ *
+ * @return
+ *     - (-1)  Error
+ *     - (0)   Success
+ */
+int EsRegCacheInit(EsRegCache *c, const uint8_t *volatile_regs, int count);
+void EsRegCacheDeinit(EsRegCache *c);
+void EsRegCacheInvalidate(EsRegCache *c);
+
+/**
+ * @brief Write a register, queued when a batch is open, the cache holds the value at once
+ *
+ * @return
+ *     - (-1)  Error
+ *     - (0)   Success
+ */
+int EsRegCacheWrite(EsRegCache *c, uint8_t regAdd, uint8_t data);
+
+/**
+ * @brief Read a register from the cache, or flush the open batch and read it from the bus
+ *
+ * @return
+ *     - (-1)  Error
+ *     - (0)   Success
+ */
+int EsRegCacheRead(EsRegCache *c, uint8_t regAdd, uint8_t *pData);
+
+// reg = (reg & ~mask) | (data & mask), no bus write when nothing changes
+int EsRegCacheUpdate(EsRegCache *c, uint8_t regAdd, uint8_t mask, uint8_t data);
+
+/**
+ * @brief Open a batch, calls nest and the outermost End sends it. The cache stays locked in between
+ *
+ * @return End returns -1 when a write of the batch failed, the whole cache is then forgotten
+ */
+void EsRegCacheBatchBegin(EsRegCache *c);
+int EsRegCacheBatchEnd(EsRegCache *c);
+
+#endif  //__ESCODEC_REGCACHE_H__
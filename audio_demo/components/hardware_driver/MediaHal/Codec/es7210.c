@@ -0,0 +1,138 @@
+/*
+* es7210.c  --  ES7210 4 channel audio ADC
+*
+* This program is free software; you can redistribute it and/or modify
+* it under the terms of the GNU General Public License version 2 as
+* published by the Free Software Foundation.
+*/
+
+#include <string.h>
+#include "esp_log.h"
+#include "es7210.h"
+#include "ESCodec_regcache.h"
+
+/* ES7210 address
+ * 0x80:AD1=0,AD0=0
+ */
+#define ES7210_ADDR         0x80
+
+#define ES7210_I2C_PRIORITY 4   // after the codec, the gain is set once
+
+static char *TAG = "DRV7210";
+
+static EsRegCache es7210_regs = ES_REG_CACHE_DEFAULT(ES7210_ADDR, ES7210_RESET_REG00, 0xFF);
+
+#define ES_ASSERT(a, format, b, ...) \
+    if ((a) != 0) { \
+        ESP_LOGE(TAG, format, ##__VA_ARGS__); \
+        return b;\
+    }
+
+static int Es7210WriteReg(uint8_t regAdd, uint8_t data)
+{
+    int res = EsRegCacheWrite(&es7210_regs, regAdd, data);
+    ES_ASSERT(res, "Es7210 Write Reg error", -1);
+    return res;
+}
+
+int Es7210ReadReg(uint8_t regAdd)
+{
+    uint8_t data = 0;
+    int res = EsRegCacheRead(&es7210_regs, regAdd, &data);
+    ES_ASSERT(res, "Es7210 Read Reg error", -1);
+    return (int)data;
+}
+
+// on the bus of the codec, the arbiter shares the port installed first
+static int I2cInit(i2c_config_t *conf, int i2cMasterPort)
+{
+    i2c_arb_config_t config = {
+        .name = "es7210",
+        .port = i2cMasterPort,
+        .conf = *conf,
+        .priority = ES7210_I2C_PRIORITY,
+    };
+    if (es7210_regs.bus == NULL) {
+        es7210_regs.bus = i2c_arb_add(&config);
+    }
+    ES_ASSERT(es7210_regs.bus == NULL, "I2cInit error", -1);
+    return 0;
+}
+
+static uint8_t es7210_gain_reg(MicGain gain)
+{
+    int step = gain <= MIC_GAIN_0DB ? 0 : gain / 3;
+    return 0x10 | (step > 0x0D ? 0x0D : step);
+}
+
+int Es7210SetMicGain(MicGain gain)
+{
+    int res = 0;
+    EsRegCacheBatchBegin(&es7210_regs);
+    for (int reg = ES7210_MIC1_GAIN_REG43; reg <= ES7210_MIC4_GAIN_REG46; reg++) {
+        res |= Es7210WriteReg(reg, es7210_gain_reg(gain));
+    }
+    res |= EsRegCacheBatchEnd(&es7210_regs);
+    return res;
+}
+
+int Es7210Init(Es7210Config *cfg)
+{
+    int res = 0;
+    int tdm = cfg->mics > 2;
+    if (cfg->mics != 2 && cfg->mics != 4) {
+        ESP_LOGE(TAG, "%d mics not supported", cfg->mics);
+        return -1;
+    }
+    res |= I2cInit(&cfg->i2c_cfg, cfg->i2c_port_num);
+    res |= EsRegCacheInit(&es7210_regs, NULL, 0);
+    ES_ASSERT(res, "Es7210 Init error", -1);
+
+    EsRegCacheBatchBegin(&es7210_regs);
+    res |= Es7210WriteReg(ES7210_RESET_REG00, 0xFF);
+    res |= Es7210WriteReg(ES7210_RESET_REG00, 0x41);
+    res |= Es7210WriteReg(ES7210_CLOCK_OFF_REG01, 0x3F);       // clocks off while configuring
+    res |= Es7210WriteReg(ES7210_TIME_CONTROL0_REG09, 0x30);
+    res |= Es7210WriteReg(ES7210_TIME_CONTROL1_REG0A, 0x30);
+    res |= Es7210WriteReg(ES7210_ADC12_HPF2_REG23, 0x2A);
+    res |= Es7210WriteReg(ES7210_ADC12_HPF1_REG22, 0x0A);
+    res |= Es7210WriteReg(ES7210_ADC34_HPF2_REG20, 0x0A);
+    res |= Es7210WriteReg(ES7210_ADC34_HPF1_REG21, 0x2A);
+    res |= Es7210WriteReg(ES7210_MODE_CONFIG_REG08, 0x00);     // slave
+    res |= Es7210WriteReg(ES7210_ANALOG_REG40, 0xC3);
+    res |= Es7210WriteReg(ES7210_MIC12_BIAS_REG41, 0x70);
+    res |= Es7210WriteReg(ES7210_MIC34_BIAS_REG42, 0x70);
+    res |= Es7210WriteReg(ES7210_OSR_REG07, 0x20);
+    res |= Es7210WriteReg(ES7210_MAINCLK_REG02, 0xC1);         // adc clock = mclk, dll on
+    res |= Es7210WriteReg(ES7210_MASTER_CLK_REG03, 0x00);      // mclk from the pad
+    res |= Es7210WriteReg(ES7210_LRCK_DIVH_REG04, 0x01);       // mclk = 256 lrck
+    res |= Es7210WriteReg(ES7210_LRCK_DIVL_REG05, 0x00);
+    res |= Es7210WriteReg(ES7210_SDP_INTERFACE1_REG11, 0x60);  // 16 bit, I2S
+    res |= Es7210WriteReg(ES7210_SDP_INTERFACE2_REG12, tdm ? 0x02 : 0x00);
+    for (int reg = ES7210_MIC1_GAIN_REG43; reg <= ES7210_MIC4_GAIN_REG46; reg++) {
+        res |= Es7210WriteReg(reg, es7210_gain_reg(cfg->gain));
+    }
+    for (int reg = ES7210_MIC1_POWER_REG47; reg <= ES7210_MIC4_POWER_REG4A; reg++) {
+        res |= Es7210WriteReg(reg, 0x08);
+    }
+    res |= Es7210WriteReg(ES7210_MIC12_POWER_REG4B, 0x00);
+    res |= Es7210WriteReg(ES7210_MIC34_POWER_REG4C, tdm ? 0x00 : 0xFF);
+    res |= Es7210WriteReg(ES7210_CLOCK_OFF_REG01, tdm ? 0x00 : 0x0A);
+    res |= Es7210WriteReg(ES7210_POWER_DOWN_REG06, 0x00);
+    res |= Es7210WriteReg(ES7210_ANALOG_REG40, 0x43);
+    res |= EsRegCacheBatchEnd(&es7210_regs);
+    ES_ASSERT(res, "Es7210 Init error", -1);
+    ESP_LOGI(TAG, "%d mics, %s", cfg->mics, tdm ? "TDM" : "I2S");
+    return 0;
+}
+
+void Es7210Uninit(void)
+{
+    EsRegCacheBatchBegin(&es7210_regs);
+    Es7210WriteReg(ES7210_MIC12_POWER_REG4B, 0xFF);
+    Es7210WriteReg(ES7210_MIC34_POWER_REG4C, 0xFF);
+    Es7210WriteReg(ES7210_POWER_DOWN_REG06, 0x07);
+    Es7210WriteReg(ES7210_ANALOG_REG40, 0x80);
+    Es7210WriteReg(ES7210_CLOCK_OFF_REG01, 0x7F);
+    EsRegCacheBatchEnd(&es7210_regs);
+}
@@ -0,0 +1,76 @@
+/*
+* es7210.h  --  ES7210 4 channel audio ADC
+*
+* This program is free software; you can redistribute it and/or modify
+* it under the terms of the GNU General Public License version 2 as
+* published by the Free Software Foundation.
+*/
+
+#ifndef _ES7210_H
+#define _ES7210_H
+#include "driver/i2c.h"
+#include "ESCodec_common.h"
+
+#define ES7210_RESET_REG00              0x00 /* reset control */
+#define ES7210_CLOCK_OFF_REG01          0x01 /* clock gating of the adcs and the mclk */
+#define ES7210_MAINCLK_REG02            0x02 /* adc clock divider, dll */
+#define ES7210_MASTER_CLK_REG03         0x03 /* mclk source, sclk divider in master mode */
+#define ES7210_LRCK_DIVH_REG04          0x04 /* mclk / lrck ratio */
+#define ES7210_LRCK_DIVL_REG05          0x05
+#define ES7210_POWER_DOWN_REG06         0x06
+#define ES7210_OSR_REG07                0x07
+#define ES7210_MODE_CONFIG_REG08        0x08 /* master / slave */
+#define ES7210_TIME_CONTROL0_REG09      0x09 /* power up state periods */
+#define ES7210_TIME_CONTROL1_REG0A      0x0A
+#define ES7210_SDP_INTERFACE1_REG11     0x11 /* word length and format */
+#define ES7210_SDP_INTERFACE2_REG12     0x12 /* tdm */
+#define ES7210_ADC34_HPF2_REG20         0x20
+#define ES7210_ADC34_HPF1_REG21         0x21
+#define ES7210_ADC12_HPF1_REG22         0x22
+#define ES7210_ADC12_HPF2_REG23         0x23
+#define ES7210_ANALOG_REG40             0x40 /* vmid, reference */
+#define ES7210_MIC12_BIAS_REG41         0x41
+#define ES7210_MIC34_BIAS_REG42         0x42
+#define ES7210_MIC1_GAIN_REG43          0x43 /* bit4 pga on, bit3:0 gain in 3dB steps */
+#define ES7210_MIC2_GAIN_REG44          0x44
+#define ES7210_MIC3_GAIN_REG45          0x45
+#define ES7210_MIC4_GAIN_REG46          0x46
+#define ES7210_MIC1_POWER_REG47         0x47
+#define ES7210_MIC2_POWER_REG48         0x48
+#define ES7210_MIC3_POWER_REG49         0x49
+#define ES7210_MIC4_POWER_REG4A         0x4A
+#define ES7210_MIC12_POWER_REG4B        0x4B
+#define ES7210_MIC34_POWER_REG4C        0x4C
+#define ES7210_CHIP_ID1_REG3D           0x3D
+
+typedef struct {
+    i2c_port_t i2c_port_num;
+    i2c_config_t i2c_cfg;
+    int mics;                   // 2 or 4, more than 2 go out in TDM
+    MicGain gain;
+} Es7210Config;
+
+#define AUDIO_CODEC_ES7210_DEFAULT(){ \
+    .i2c_port_num = I2C_NUM_0, \
+    .i2c_cfg = { \
+        .mode = I2C_MODE_MASTER, \
+        .sda_io_num = IIC_DATA, \
+        .scl_io_num = IIC_CLK, \
+        .sda_pullup_en = GPIO_PULLUP_ENABLE,\
+        .scl_pullup_en = GPIO_PULLUP_ENABLE,\
+        .master.clk_speed = 100000\
+    }, \
+    .mics = 4, \
+    .gain = MIC_GAIN_24DB, \
+};
+
+/*
+ * Slave on the I2S port of the codec, MCLK at 256 fs from the same pin, 16 bit slots.
+ * With 4 mics the frame carries them in TDM, slot n in bit clocks 16n..16n+15 after the LRCK edge,
+ * so the I2S reads them as 32 bit stereo: mic 1 and 2 in the first word, mic 3 and 4 in the second
+ */
+int Es7210Init(Es7210Config *cfg);
+void Es7210Uninit(void);
+int Es7210SetMicGain(MicGain gain);
+int Es7210ReadReg(uint8_t regAdd);
+#endif
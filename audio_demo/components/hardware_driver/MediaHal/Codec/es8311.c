@@ -25,6 +25,7 @@
 #include <string.h>
 #include "esp_log.h"
 #include "es8311.h"
+#include "ESCodec_regcache.h"
 
 /* ES8311 address
  * 0x32:CE=1;0x30:CE=0
@@ -33,6 +34,8 @@
 
 #define ES7243_ADDR         0x26
 
+#define ES8311_I2C_PRIORITY 5   // volume and mute go ahead of the camera sensor table loads on a shared bus
+
 /*
 * to define the clock soure of MCLK
 */
@@ -71,6 +74,10 @@ struct  es8311_private {
 };
 static struct es8311_private *es8311_priv;
 
+// chip id and version are read only
+static const uint8_t es8311_volatile_regs[] = {ES8311_CHD1_REGFD, ES8311_CHD2_REGFE, ES8311_CHVER_REGFF};
+static EsRegCache es8311_regs = ES_REG_CACHE_DEFAULT(ES8311_ADDR, ES8311_RESET_REG00, 0x1F);
+
 /*
 * Clock coefficient structer
 */
@@ -201,56 +208,28 @@ static char *TAG = "DRV8311";
 
 static int Es8311WriteReg(uint8_t regAdd, uint8_t data)
 {
-//     int res = 0; 
-//     res = DspI2cWriteReg(ES8311_ADDR, (uint8_t *)&regAdd, 1, (uint8_t *)&data, 1);
-//     // DSP_I2C_ASSERT(res, "DspI2cWriteReg error", -1);
-// ES_ASSERT(res, "Es8311 Write Reg error", -1);
-//     return res;
-    int res = 0;
-    i2c_cmd_handle_t cmd = i2c_cmd_link_create();
-    res |= i2c_master_start(cmd);
-    res |= i2c_master_write_byte(cmd, ES8311_ADDR, 1 /*ACK_CHECK_EN*/);
-    res |= i2c_master_write_byte(cmd, regAdd, 1 /*ACK_CHECK_EN*/);
-    res |= i2c_master_write_byte(cmd, data, 1 /*ACK_CHECK_EN*/);
-    res |= i2c_master_stop(cmd);
-    res |= i2c_master_cmd_begin(0, cmd, 1000 / portTICK_RATE_MS);
-    i2c_cmd_link_delete(cmd);
+    int res = EsRegCacheWrite(&es8311_regs, regAdd, data);
     ES_ASSERT(res, "Es8311 Write Reg error", -1);
     return res;
 }
 
 int Es8311ReadReg(uint8_t regAdd)
 {
-    // int res = 0;
-    // uint8_t data;
-    // res |= i2c_bus_write_data(0, ES8311_ADDR, (uint8_t *)&regAdd, 1);
-    // res |= i2c_bus_read_bytes(0, ES8311_ADDR | 0x01, (uint8_t *)&data, 1);
-    // // DSP_I2C_ASSERT(res, "DspI2cReadReg error", -1);
-    // ES_ASSERT(res, "Es8311 Read Reg error", -1);
-    // return (int)data;
-    uint8_t data;
-    int res = 0;
-    i2c_cmd_handle_t cmd = i2c_cmd_link_create();
-
-    res |= i2c_master_start(cmd);
-    res |= i2c_master_write_byte(cmd, ES8311_ADDR, 1 /*ACK_CHECK_EN*/);
-    res |= i2c_master_write_byte(cmd, regAdd, 1 /*ACK_CHECK_EN*/);
-    res |= i2c_master_stop(cmd);
-    res |= i2c_master_cmd_begin(0, cmd, 1000 / portTICK_RATE_MS);
-    i2c_cmd_link_delete(cmd);
-
-    cmd = i2c_cmd_link_create();
-    res |= i2c_master_start(cmd);
-    res |= i2c_master_write_byte(cmd, ES8311_ADDR | 0x01, 1 /*ACK_CHECK_EN*/);
-    res |= i2c_master_read_byte(cmd, &data, 0x01 /*NACK_VAL*/);
-    res |= i2c_master_stop(cmd);
-    res |= i2c_master_cmd_begin(0, cmd, 1000 / portTICK_RATE_MS);
-    i2c_cmd_link_delete(cmd);
-
+    uint8_t data = 0;
+    int res = EsRegCacheRead(&es8311_regs, regAdd, &data);
     ES_ASSERT(res, "Es8311 Read Reg error", -1);
     return (int)data;
 }
 
+// The ES7243 sits on the bus of the ES8311 and shares its arbitration device
+static int Es7243CmdBegin(i2c_cmd_handle_t cmd)
+{
+    if (es8311_regs.bus) {
+        return i2c_arb_cmd_begin(es8311_regs.bus, cmd, 1000);
+    }
+    return i2c_master_cmd_begin(0, cmd, 1000 / portTICK_RATE_MS);
+}
+
 static int Es7243WriteReg(uint8_t regAdd, uint8_t data)
 {
     int res = 0;
@@ -260,7 +239,7 @@ static int Es7243WriteReg(uint8_t regAdd, uint8_t data)
     res |= i2c_master_write_byte(cmd, regAdd, 1 /*ACK_CHECK_EN*/);
     res |= i2c_master_write_byte(cmd, data, 1 /*ACK_CHECK_EN*/);
     res |= i2c_master_stop(cmd);
-    res |= i2c_master_cmd_begin(0, cmd, 1000 / portTICK_RATE_MS);
+    res |= Es7243CmdBegin(cmd);
     i2c_cmd_link_delete(cmd);
     ES_ASSERT(res, "Es7243 Write Reg error", -1);
     return res;
@@ -271,13 +250,17 @@ int Es7243ReadReg(uint8_t regAdd)
 {
     uint8_t data;
     int res = 0;
+    if (es8311_regs.bus && i2c_arb_acquire(es8311_regs.bus, 1000) != ESP_OK) {
+        ESP_LOGE(TAG, "Es7243 Read Reg: bus busy");
+        return -1;
+    }
     i2c_cmd_handle_t cmd = i2c_cmd_link_create();
 
     res |= i2c_master_start(cmd);
     res |= i2c_master_write_byte(cmd, ES7243_ADDR, 1 /*ACK_CHECK_EN*/);
     res |= i2c_master_write_byte(cmd, regAdd, 1 /*ACK_CHECK_EN*/);
     res |= i2c_master_stop(cmd);
-    res |= i2c_master_cmd_begin(0, cmd, 1000 / portTICK_RATE_MS);
+    res |= Es7243CmdBegin(cmd);
     i2c_cmd_link_delete(cmd);
 
     cmd = i2c_cmd_link_create();
@@ -285,8 +268,11 @@ int Es7243ReadReg(uint8_t regAdd)
     res |= i2c_master_write_byte(cmd, ES7243_ADDR | 0x01, 1 /*ACK_CHECK_EN*/);
     res |= i2c_master_read_byte(cmd, &data, 0x01 /*NACK_VAL*/);
     res |= i2c_master_stop(cmd);
-    res |= i2c_master_cmd_begin(0, cmd, 1000 / portTICK_RATE_MS);
+    res |= Es7243CmdBegin(cmd);
     i2c_cmd_link_delete(cmd);
+    if (es8311_regs.bus) {
+        i2c_arb_release(es8311_regs.bus);
+    }
 
     ES_ASSERT(res, "Es7243 Read Reg error", -1);
     return (int)data;
@@ -308,13 +294,23 @@ esp_err_t Es7243Init(void)
     return ret;
 }
 
+/*
+ * On Kaluga the codec shares GPIO 7/8 with the camera SCCB, the arbiter installs the driver
+ * once for both and lets codec transfers in between the batches of a sensor table load
+ */
 static int I2cInit(i2c_config_t *conf, int i2cMasterPort)
 {
-    int res;
-    res = i2c_param_config(i2cMasterPort, conf);
-    res |= i2c_driver_install(i2cMasterPort, conf->mode, 0, 0, 0);
-    ES_ASSERT(res, "I2cInit error", -1);
-    return res;
+    i2c_arb_config_t config = {
+        .name = "es8311",
+        .port = i2cMasterPort,
+        .conf = *conf,
+        .priority = ES8311_I2C_PRIORITY,
+    };
+    if (es8311_regs.bus == NULL) {
+        es8311_regs.bus = i2c_arb_add(&config);
+    }
+    ES_ASSERT(es8311_regs.bus == NULL, "I2cInit error", -1);
+    return 0;
 }
 
 /*
@@ -331,7 +327,7 @@ static int get_coeff(uint32_t mclk, uint32_t rate)
 /*
 * set es8311 clock parameter and PCM/I2S interface
 */
-static void es8311_pcm_hw_params(uint32_t mclk, uint32_t lrck)
+static int es8311_pcm_hw_params(uint32_t mclk, uint32_t lrck)
 {
     int coeff;
     uint8_t regv, datmp;
@@ -339,7 +335,7 @@ static void es8311_pcm_hw_params(uint32_t mclk, uint32_t lrck)
     coeff = get_coeff(mclk, lrck);
     if (coeff < 0) {
         ESP_LOGE(TAG, "Unable to configure sample rate %dHz with %dHz MCLK\n",  lrck, mclk);
-        return;
+        return -1;
     }
 
     /*
@@ -398,6 +394,7 @@ static void es8311_pcm_hw_params(uint32_t mclk, uint32_t lrck)
         }
         Es8311WriteReg(ES8311_CLK_MANAGER_REG06, regv);
     }
+    return 0;
 }
 /*
 * set data and clock in tri-state mode
@@ -424,6 +421,7 @@ static void es8311_mute(int mute)
 {
     uint8_t regv;
     ESP_LOGI(TAG, "Enter into es8311_mute(), mute = %d\n", mute);
+    EsRegCacheBatchBegin(&es8311_regs);
     regv = Es8311ReadReg(ES8311_DAC_REG31) & 0x9f;
     if (mute) {
         Es8311WriteReg(ES8311_SYSTEM_REG12, 0x02);
@@ -434,6 +432,7 @@ static void es8311_mute(int mute)
         Es8311WriteReg(ES8311_DAC_REG31, regv);
         Es8311WriteReg(ES8311_SYSTEM_REG12, 0x00);
     }
+    EsRegCacheBatchEnd(&es8311_regs);
 }
 /*
 * set es8311 into suspend mode
@@ -580,7 +579,9 @@ static void es8311_Codec_Startup(uint32_t mclk_freq, uint32_t lrck_freq)
     es8311_priv->master_slave_mode = SLAVE_MODE;
     es8311_priv->mclk_src = FROM_MCLK_PIN;
 
+    EsRegCacheBatchBegin(&es8311_regs);
     es8311_init(mclk_freq, lrck_freq);
+    EsRegCacheBatchEnd(&es8311_regs);
 
     ESP_LOGI(TAG, "Exit es8311_Codec_Startup()\n");
 }
@@ -618,6 +619,7 @@ int Es8311Init(Es8311Config *cfg)
 {
     es8311_priv = calloc(1, sizeof(struct es8311_private));
     I2cInit(&cfg->i2c_cfg, cfg->i2c_port_num); // ESP32 in master mode
+    EsRegCacheInit(&es8311_regs, es8311_volatile_regs, sizeof(es8311_volatile_regs) / sizeof(es8311_volatile_regs[0]));
 
 
 
@@ -647,6 +649,7 @@ int Es8311Init(Es8311Config *cfg)
 
 void Es8311Uninit()
 {
+    es8311_standby = false;
     Es8311WriteReg(ES8311_RESET_REG00, 0x3f);
     free(es8311_priv);
     es8311_priv = NULL;
@@ -656,6 +659,7 @@ int Es8311ConfigFmt(ESCodecModule mode, ESCodecI2SFmt fmt)
 {
     int res = 0;
     uint8_t regAdc = 0, regDac = 0;
+    EsRegCacheBatchBegin(&es8311_regs);
     if (mode == ES_MODULE_ADC || mode == ES_MODULE_ADC_DAC) {
         res |= Es8311WriteReg(ES8311_ADC_REG17, 0xBF);
     }
@@ -689,6 +693,7 @@ int Es8311ConfigFmt(ESCodecModule mode, ESCodecI2SFmt fmt)
     }
     res |= Es8311WriteReg(ES8311_SDPIN_REG09, regAdc);
     res |= Es8311WriteReg(ES8311_SDPOUT_REG0A, regDac);
+    res |= EsRegCacheBatchEnd(&es8311_regs);
     return res;
 }
 
@@ -698,12 +703,28 @@ int Es8311I2sConfigClock(ESCodecI2sClock cfg)
     return res;
 }
 
+/*
+ * The ESP32 drives MCLK from the APLL at 256 fs, the dividers follow the rate. All clock registers
+ * go out in one I2C transaction so the codec never runs on half of them
+ */
+int Es8311SetSampleRate(uint32_t rate)
+{
+    if (get_coeff(rate * 256, rate) < 0) {
+        ESP_LOGE(TAG, "Sample rate %d not supported", rate);
+        return -1;
+    }
+    EsRegCacheBatchBegin(&es8311_regs);
+    es8311_pcm_hw_params(rate * 256, rate);
+    return EsRegCacheBatchEnd(&es8311_regs);
+}
+
 int Es8311SetBitsPerSample(ESCodecModule mode, BitsLength bitPerSample)
 {
     int res = 0;
     uint8_t reg = 0;
     int bits = (int)bitPerSample;
 
+    EsRegCacheBatchBegin(&es8311_regs);
     if (mode == ES_MODULE_ADC || mode == ES_MODULE_ADC_DAC) {
         reg = Es8311ReadReg(ES8311_SDPIN_REG09);
         reg = reg & 0xe3;
@@ -714,30 +735,84 @@ int Es8311SetBitsPerSample(ESCodecModule mode, BitsLength bitPerSample)
         reg = reg & 0xe3;
         res |= Es8311WriteReg(ES8311_SDPOUT_REG0A, reg | (bits << 2));
     }
+    res |= EsRegCacheBatchEnd(&es8311_regs);
     return res;
 }
 
 int Es8311Start(ESCodecModule mode)
 {
     int res = 0;
+    EsRegCacheBatchBegin(&es8311_regs);
     if (mode == ES_MODULE_ADC || mode == ES_MODULE_ADC_DAC) {
         res |= Es8311WriteReg(ES8311_ADC_REG17, 0xBF);
     }
     if (mode == ES_MODULE_DAC || mode == ES_MODULE_ADC_DAC) {
         res |= Es8311WriteReg(ES8311_SYSTEM_REG12, Es8311ReadReg(ES8311_SYSTEM_REG12) & 0xfd);
     }
+    res |= EsRegCacheBatchEnd(&es8311_regs);
     return res;
 }
 
 int Es8311Stop(ESCodecModule mode)
 {
     int res = 0;
+    EsRegCacheBatchBegin(&es8311_regs);
     if (mode == ES_MODULE_ADC || mode == ES_MODULE_ADC_DAC) {
         res |= Es8311WriteReg(ES8311_ADC_REG17, 0x00);
     }
     if (mode == ES_MODULE_DAC || mode == ES_MODULE_ADC_DAC) {
         res |= Es8311WriteReg(ES8311_SYSTEM_REG12, Es8311ReadReg(ES8311_SYSTEM_REG12) | 0x02);
     }
+    res |= EsRegCacheBatchEnd(&es8311_regs);
+    return res;
+}
+
+/*
+ * Standby keeps VMID and the references up (REG0D) and every register in the cache, and powers down
+ * what draws the current: DAC, ADC modulator and PGA, the output driver and the codec clocks. The output
+ * is muted first, as a PA still on would hear the driver go. Leaving it writes the saved values back in
+ * reverse order, one I2C transaction, and the outputs are biased again within a millisecond or two
+ */
+static const uint8_t es8311_standby_regs[] = {
+    ES8311_DAC_REG31, ES8311_DAC_REG32, ES8311_SYSTEM_REG12, ES8311_ADC_REG17,
+    ES8311_SYSTEM_REG0E, ES8311_SYSTEM_REG13, ES8311_CLK_MANAGER_REG01,
+};
+static uint8_t es8311_standby_saved[sizeof(es8311_standby_regs)];
+static bool es8311_standby;
+
+int Es8311Standby(int enable)
+{
+    int res = 0;
+    int n = sizeof(es8311_standby_regs);
+    if (enable == es8311_standby) {
+        return 0;
+    }
+    EsRegCacheBatchBegin(&es8311_regs);
+    if (enable) {
+        for (int i = 0; i < n; i++) {
+            int regv = Es8311ReadReg(es8311_standby_regs[i]);
+            if (regv < 0) {
+                EsRegCacheBatchEnd(&es8311_regs);
+                return -1;
+            }
+            es8311_standby_saved[i] = regv;
+        }
+        res |= Es8311WriteReg(ES8311_DAC_REG31, es8311_standby_saved[0] | 0x60);   // mute
+        res |= Es8311WriteReg(ES8311_DAC_REG32, 0x00);                              // volume
+        res |= Es8311WriteReg(ES8311_SYSTEM_REG12, 0x02);                           // DAC off
+        res |= Es8311WriteReg(ES8311_ADC_REG17, 0x00);                              // ADC volume
+        res |= Es8311WriteReg(ES8311_SYSTEM_REG0E, es8311_standby_saved[4] | 0x60); // PGA and modulator off
+        res |= Es8311WriteReg(ES8311_SYSTEM_REG13, 0x00);                           // output driver off
+        res |= Es8311WriteReg(ES8311_CLK_MANAGER_REG01, es8311_standby_saved[6] & 0xF0); // ADC and DAC clocks off
+    } else {
+        for (int i = n - 1; i >= 0; i--) {
+            res |= Es8311WriteReg(es8311_standby_regs[i], es8311_standby_saved[i]);
+        }
+    }
+    res |= EsRegCacheBatchEnd(&es8311_regs);
+    if (res == 0) {
+        es8311_standby = enable;
+    }
     return res;
 }
 
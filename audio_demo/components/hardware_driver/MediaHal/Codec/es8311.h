@@ -102,10 +102,22 @@ int Es7243ReadReg(uint8_t regAdd);
 int Es8311ConfigFmt(ESCodecModule mode, ESCodecI2SFmt fmt);
 int Es8311I2sConfigClock(ESCodecI2sClock cfg);
 int Es8311SetBitsPerSample(ESCodecModule mode, BitsLength bitPerSample);
+int Es8311SetSampleRate(uint32_t rate);
 
 int Es8311Start(ESCodecModule mode);
 int Es8311Stop(ESCodecModule mode);
 
+/**
+ * @brief Low-power standby with the references kept biased and the registers kept, see MediaHalStandby
+ *
+ * @param enable : 1 enter, 0 leave and restore what was running
+ *
+ * @return
+ *     - (-1)  Error
+ *     - (0)   Success
+ */
+int Es8311Standby(int enable);
+
 int Es8311SetVoiceVolume(int volume);
 int Es8311GetVoiceVolume(int *volume);
 int Es8311SetVoiceMute(int enable);
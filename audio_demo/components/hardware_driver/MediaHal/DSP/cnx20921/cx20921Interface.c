@@ -31,6 +31,9 @@
 #include <fcntl.h>
 #include <unistd.h>
 #include "esp_spiffs.h"
+#include "esp_spi_flash.h"
+#include "nvs.h"
+#include "esp32/rom/crc.h"
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
@@ -43,9 +46,34 @@
 
 #define CX20921_TAG "CX20921"
 
+#ifndef CX20921_REFLASH_FORCE
+#define CX20921_REFLASH_FORCE 2     // cx20921Init: flash even when the firmware did not change
+#endif
+
 #define BOOTLOADER_BIN "/spiffs/bootloader.bin"
 #define ALEXA_FW "/spiffs/alexa.sfs"
 
+/*
+ * Firmware partition written by mkcxfw.py: a cx20921_fw_header_t, then the bootloader and the .sfs image.
+ * It is memory mapped and handed to DownloadFW as it is, the cache fetches the flash a line at a time while
+ * the image goes out over I2C, nothing is copied into RAM. The version and CRC of the last firmware flashed
+ * are kept in NVS, an unchanged partition is not flashed again.
+ */
+#define CX20921_FW_PARTITION "cx_fw"
+#define CX20921_FW_MAGIC     0x57465843  // "CXFW"
+#define CX20921_FW_CRC_BLOCK 4096
+#define CX20921_NVS          "cx20921"
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t loader_offset;     // from the start of the partition
+    uint32_t loader_len;
+    uint32_t image_offset;
+    uint32_t image_len;
+    uint32_t crc;               // crc32_le of the bootloader, then the image
+} cx20921_fw_header_t;
+
 #define CX2091_ASSERT(a, format, b, ...) \
     if ((a) != 0) { \
         ESP_LOGE(CX20921_TAG, format, ##__VA_ARGS__); \
@@ -152,6 +180,98 @@ static esp_err_t spiffs_load_fw(int img, uint8_t **outdata, size_t *outsize)
     return ESP_OK;
 }
 
+// Map the firmware partition, NULL when there is none or it does not check out
+static const uint8_t *partition_map_fw(cx20921_fw_header_t *hdr, spi_flash_mmap_handle_t *handle)
+{
+    const esp_partition_t *part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, CX20921_FW_PARTITION);
+    const uint8_t *base = NULL;
+    if (part == NULL || esp_partition_read(part, 0, hdr, sizeof(cx20921_fw_header_t)) != ESP_OK || hdr->magic != CX20921_FW_MAGIC) {
+        return NULL;
+    }
+    if (hdr->loader_offset + hdr->loader_len > part->size || hdr->image_offset + hdr->image_len > part->size) {
+        ESP_LOGE(CX20921_TAG, "firmware partition header error");
+        return NULL;
+    }
+    uint32_t size = hdr->image_offset + hdr->image_len;
+    if (esp_partition_mmap(part, 0, size, SPI_FLASH_MMAP_DATA, (const void **)&base, handle) != ESP_OK) {
+        ESP_LOGE(CX20921_TAG, "firmware partition mmap error");
+        return NULL;
+    }
+    // 分块计算 CRC，和下载一样直接读映射的 flash
+    uint32_t crc = 0;
+    for (uint32_t pos = 0; pos < hdr->loader_len; pos += CX20921_FW_CRC_BLOCK) {
+        uint32_t n = hdr->loader_len - pos < CX20921_FW_CRC_BLOCK ? hdr->loader_len - pos : CX20921_FW_CRC_BLOCK;
+        crc = crc32_le(crc, base + hdr->loader_offset + pos, n);
+    }
+    for (uint32_t pos = 0; pos < hdr->image_len; pos += CX20921_FW_CRC_BLOCK) {
+        uint32_t n = hdr->image_len - pos < CX20921_FW_CRC_BLOCK ? hdr->image_len - pos : CX20921_FW_CRC_BLOCK;
+        crc = crc32_le(crc, base + hdr->image_offset + pos, n);
+    }
+    if (crc != hdr->crc) {
+        ESP_LOGE(CX20921_TAG, "firmware partition crc %08x, expected %08x", crc, hdr->crc);
+        spi_flash_munmap(*handle);
+        return NULL;
+    }
+    return base;
+}
+
+// Whether the firmware with this version and crc is the one flashed last
+static int fw_is_flashed(const cx20921_fw_header_t *hdr)
+{
+    nvs_handle nvs;
+    uint32_t version = 0, crc = 0;
+    if (nvs_open(CX20921_NVS, NVS_READONLY, &nvs) != ESP_OK) {
+        return 0;
+    }
+    int same = nvs_get_u32(nvs, "version", &version) == ESP_OK && nvs_get_u32(nvs, "crc", &crc) == ESP_OK &&
+               version == hdr->version && crc == hdr->crc;
+    nvs_close(nvs);
+    return same;
+}
+
+static void fw_set_flashed(const cx20921_fw_header_t *hdr)
+{
+    nvs_handle nvs;
+    if (nvs_open(CX20921_NVS, NVS_READWRITE, &nvs) != ESP_OK) {
+        return;
+    }
+    nvs_set_u32(nvs, "version", hdr->version);
+    nvs_set_u32(nvs, "crc", hdr->crc);
+    nvs_commit(nvs);
+    nvs_close(nvs);
+}
+
+// Flash the firmware of the partition, 1: no partition, use SPIFFS
+static int partition_download_fw(int reflash)
+{
+    cx20921_fw_header_t hdr;
+    spi_flash_mmap_handle_t handle;
+    const uint8_t *base = partition_map_fw(&hdr, &handle);
+    if (base == NULL) {
+        return 1;
+    }
+    if (reflash != CX20921_REFLASH_FORCE && fw_is_flashed(&hdr)) {
+        ESP_LOGI(CX20921_TAG, "firmware %08x already flashed", hdr.version);
+        spi_flash_munmap(handle);
+        return 0;
+    }
+    char *buf = esp_audio_mem_calloc(1, GetSizeOfBuffer());
+    if (!buf) {
+        ESP_LOGE(CX20921_TAG, "Error in allocating buf");
+        spi_flash_munmap(handle);
+        return -1;
+    }
+    ESP_LOGI(CX20921_TAG, "flashing firmware %08x, %d + %d bytes", hdr.version, hdr.loader_len, hdr.image_len);
+    int ret = DownloadFW(buf, (uint8_t *)base + hdr.loader_offset, hdr.loader_len, (uint8_t *)base + hdr.image_offset, hdr.image_len,
+                         CX20921_I2C_ADDR >> 1, SFS_UPDATE_AUTO, 1, 0);
+    free(buf);
+    spi_flash_munmap(handle);
+    if (ret == 0) {
+        fw_set_flashed(&hdr);
+    }
+    return ret;
+}
+
 int cx20921GpioInit()
 {
     int res = 0;
@@ -200,6 +320,8 @@ int cx20921IntrInit(void *queue)
  * @param reflash  a flag indicating whether to reflash the flash used by DSP,
  *                  two different binaries must be flashed, one of which is for boot while another is a .sys file,
  *                  the two binaries are stored in different flash areas indicated by the partition table in 'partitions_esp_audio.csv'.
+ *                  With a "cx_fw" partition they come from it and are only flashed when they changed since the
+ *                  last time, CX20921_REFLASH_FORCE flashes them anyway. Without one they are loaded from SPIFFS.
  *
  * @return
  *     - (-1) Failed
@@ -221,6 +343,10 @@ int cx20921Init(int reflash)
 
     //download firmware
     if (reflash)
+    {
+        ret = partition_download_fw(reflash);
+    }
+    if (reflash && ret == 1)
     {
         uint8_t *loader = NULL;
         uint8_t *img = NULL;
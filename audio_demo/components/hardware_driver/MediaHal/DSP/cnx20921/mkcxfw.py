@@ -0,0 +1,44 @@
+#!/usr/bin/env python
+#
+# Pack the CX20921 bootloader and .sfs firmware into an image of the "cx_fw" data partition,
+# see cx20921_fw_header_t in cx20921Interface.c for the layout.
+#
+#   python mkcxfw.py cx_fw.bin bootloader.bin alexa.sfs --version 0x01020304
+#   parttool.py write_partition --partition-name=cx_fw --input=cx_fw.bin
+#
+import argparse
+import binascii
+import struct
+import sys
+
+MAGIC = 0x57465843  # "CXFW"
+HEADER = struct.Struct('<7I')
+
+
+def main():
+    parser = argparse.ArgumentParser(description='CX20921 firmware partition image')
+    parser.add_argument('output')
+    parser.add_argument('loader', help='bootloader.bin')
+    parser.add_argument('image', help='firmware .sfs file')
+    parser.add_argument('--version', type=lambda s: int(s, 0), required=True,
+                        help='firmware version, a partition with the version and crc flashed last is skipped')
+    parser.add_argument('--size', type=lambda s: int(s, 0), help='check it fits the partition')
+    args = parser.parse_args()
+
+    loader = open(args.loader, 'rb').read()
+    image = open(args.image, 'rb').read()
+    loader_offset = HEADER.size
+    image_offset = (loader_offset + len(loader) + 3) & ~3
+    crc = binascii.crc32(image, binascii.crc32(loader)) & 0xFFFFFFFF
+    out = bytearray(HEADER.pack(MAGIC, args.version, loader_offset, len(loader), image_offset, len(image), crc))
+    out += loader
+    out += b'\xff' * (image_offset - len(out))
+    out += image
+    if args.size is not None and len(out) > args.size:
+        sys.exit('%d bytes do not fit the %d byte partition' % (len(out), args.size))
+    open(args.output, 'wb').write(out)
+    print('%s: version %08x, crc %08x, %d bytes' % (args.output, args.version, crc, len(out)))
+
+
+if __name__ == '__main__':
+    main()
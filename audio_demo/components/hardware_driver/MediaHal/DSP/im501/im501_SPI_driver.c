@@ -28,6 +28,7 @@
 #include <stdio.h>
 #include <string.h>
 #include "esp_log.h"
+#include "esp_timer.h"
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
@@ -36,10 +37,13 @@
 
 #include "im501_i2c_driver.h"
 #include "driver/spi_master.h"
+#include "esp_heap_caps.h"
 #include "soc/gpio_struct.h"
 #include "driver/gpio.h"
 #include "esp_partition.h"
 #include "EspAudioAlloc.h"
+#include "EspAudioPool.h"
+#include "dsp_boot_state.h"
 #include "im501_spi.h"
 #include "im501_SPI_driver.h"
 
@@ -69,6 +73,12 @@ extern SemaphoreHandle_t dsp_asr_sema;
 
 #define INTERNAL_SIZE                   (4000)
 
+#define IM501_SPI_CLK_HZ                (10 * 1000 * 1000)
+#define IM501_BOOT_KEY                  "im501"
+#define IM501_BOOT_POLL_MS              5
+#define IM501_BOOT_TIMEOUT_MS           100     // the frame counter moves every few ms once the firmware runs
+#define IM501_FW_RING_NUM               3       // chunks in flight while the next one is read and swapped
+
 #define  IM501_SPI_CMD_DM_WR             0x05
 #define  IM501_SPI_CMD_DM_RD             0x01
 #define  IM501_SPI_CMD_IM_WR             0x04
@@ -104,6 +114,29 @@ typedef struct to_host_cmd_t {
 } to_host_cmd;
 
 
+// firmware upload clocks, tried from the top, each checked by a write / read back before it is used
+static const int im501_fw_clk_hz[] = {26 * 1000 * 1000, 20 * 1000 * 1000, 16 * 1000 * 1000, IM501_SPI_CLK_HZ};
+
+static int im501_spi_add_device(int clock_hz)
+{
+    spi_device_interface_config_t devcfg = {
+        .clock_speed_hz = clock_hz,
+        .mode = 0,                              //SPI mode 0
+        .spics_io_num = DSP_FT_SPI_CS,             //CS pin
+        .queue_size = 7,                        //We want to be able to queue 7 transactions at a time
+        .pre_cb = NULL, //Specify pre-transfer callback to handle D/C line
+    };
+    return spi_bus_add_device(HSPI_HOST, &devcfg, &im501_spi);
+}
+
+static int im501_spi_set_clock(int clock_hz)
+{
+    int ret = spi_bus_remove_device(im501_spi);
+    ret |= im501_spi_add_device(clock_hz);
+    IM501_ASSERT(ret, "set spi clock %d failed", -1, clock_hz);
+    return ret;
+}
+
 static void esp32_spi_init(void *handle)
 {
     int ret;
@@ -394,105 +427,154 @@ int im501_spi_burst_read_dram(uint32_t addr, uint8_t *rxbuf, size_t len)
     return 0;
 }
 
+static void im501_8byte_swap(uint8_t *rxbuf, uint32_t len);
+
+/*
+ * Burst write chunks, each in its own DMA buffer and transaction. A slot is only refilled after the
+ * driver gave its transaction back, so the CPU prepares chunk n + 1 while chunk n is on the wire
+ */
+typedef struct {
+    uint8_t *buf[IM501_FW_RING_NUM];        // 6 header bytes, then up to IM501_SPI_BUF_LEN of data
+    EspAudioPool *pool[IM501_FW_RING_NUM];  // where buf came from
+    spi_transaction_t t[IM501_FW_RING_NUM];
+    int slot;
+    int queued;
+    int ret;
+} im501_fw_ring_t;
+
+// Ring buffers of the driver, made on the first burst write and kept: a write is a few pool operations, no heap
+static EspAudioPool *im501_ring_pool;
+
+// A block of the boot DMA pool when its blocks are large enough, one of the driver's own otherwise
+static uint8_t *im501_ring_alloc(EspAudioPool **from)
+{
+    EspAudioPool *dma = EspAudioPoolDma();
+    if (dma && EspAudioPoolBlockSize(dma) >= IM501_SPI_BUF_LEN + 6) {
+        uint8_t *buf = EspAudioPoolAlloc(dma);
+        if (buf) {
+            *from = dma;
+            return buf;
+        }
+    }
+    EspAudioPool *own = __atomic_load_n(&im501_ring_pool, __ATOMIC_ACQUIRE);
+    if (own == NULL) {
+        EspAudioPool *expected = NULL;
+        own = EspAudioPoolCreate(IM501_SPI_BUF_LEN + 6, IM501_FW_RING_NUM, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+        if (own && !__atomic_compare_exchange_n(&im501_ring_pool, &expected, own, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+            EspAudioPoolDestroy(own);   // another writer made it first
+            own = expected;
+        }
+    }
+    *from = own;
+    return own ? EspAudioPoolAlloc(own) : NULL;
+}
+
+static int im501_ring_init(im501_fw_ring_t *ring)
+{
+    memset(ring, 0, sizeof(im501_fw_ring_t));
+    for (int i = 0; i < IM501_FW_RING_NUM; i++) {
+        ring->buf[i] = im501_ring_alloc(&ring->pool[i]);
+        if (ring->buf[i] == NULL) {
+            ESP_LOGE(IM501_TAG, "NO memory in %s, line: %d", __func__, __LINE__);
+            return -ENOMEM;
+        }
+    }
+    return 0;
+}
+
+static int im501_ring_flush(im501_fw_ring_t *ring)
+{
+    spi_transaction_t *r;
+    while (ring->queued > 0) {
+        ring->ret |= spi_device_get_trans_result(im501_spi, &r, portMAX_DELAY);
+        ring->queued--;
+    }
+    return ring->ret;
+}
+
+static void im501_ring_deinit(im501_fw_ring_t *ring)
+{
+    im501_ring_flush(ring);
+    for (int i = 0; i < IM501_FW_RING_NUM; i++) {
+        if (ring->buf[i]) {
+            EspAudioPoolFree(ring->pool[i], ring->buf[i]);
+        }
+        ring->buf[i] = NULL;
+    }
+}
+
+// data area of the next free slot, waits for the oldest transfer when all are in flight
+static uint8_t *im501_ring_get(im501_fw_ring_t *ring)
+{
+    spi_transaction_t *r;
+    if (ring->queued == IM501_FW_RING_NUM) {
+        ring->ret |= spi_device_get_trans_result(im501_spi, &r, portMAX_DELAY);
+        ring->queued--;
+    }
+    return ring->buf[ring->slot] + 6;
+}
+
+// len is a multiple of 8, the data is already in the slot returned by im501_ring_get
+static int im501_ring_queue(im501_fw_ring_t *ring, uint32_t addr, int len)
+{
+    uint8_t *buf = ring->buf[ring->slot];
+    spi_transaction_t *t = &ring->t[ring->slot];
+
+    buf[0] = ((addr >> 24) == 0x10) ? IM501_SPI_CMD_IM_WR : IM501_SPI_CMD_DM_WR;
+    buf[1] = (addr & 0x000000ff) >> 0;      //The memory address
+    buf[2] = (addr & 0x0000ff00) >> 8;
+    buf[3] = (addr & 0x00ff0000) >> 16;
+    buf[4] = ((len / 2) & 0x00ff) >> 0;     //The word counter
+    buf[5] = ((len / 2) & 0xff00) >> 8;
+
+    memset(t, 0, sizeof(spi_transaction_t));
+    t->length = (len + 6) * 8;
+    t->tx_buffer = buf;
+    if (spi_device_queue_trans(im501_spi, t, portMAX_DELAY) != ESP_OK) {
+        ESP_LOGE(IM501_TAG, "in %s line %d", __func__, __LINE__);
+        ring->ret = -1;
+        return -1;
+    }
+    ring->queued++;
+    ring->slot = (ring->slot + 1) % IM501_FW_RING_NUM;
+    return 0;
+}
+
 /**
  * im501_spi_burst_write - Write data to SPI by im501 dsp memory address.
  * @addr: Start address.
  * @txbuf: Data Buffer for writng.
- * @len: Data length, it must be a multiple of 8.
+ * @len: Data length, it is padded with zeros to a multiple of 8.
  * @type: Firmware type, MSB and LSB, the iM501 firmware is in MSB, but the EFT firmware is in LSB.
  *
  * Returns true for success.
  */
 int im501_spi_burst_write(uint32_t addr, const uint8_t *txbuf, size_t len, int fw_type)
 {
-    spi_transaction_t t;
-    spi_transaction_t *r;
-    int ret = 0;
-
-    uint8_t spi_cmd, *write_buf;
+    im501_fw_ring_t ring;
     uint32_t offset = 0;
-    int local_len, end, i, counter = 0;
-
-    memset(&t, 0, sizeof(t));
-    uint32_t addr_buf = 0x00000000;
-    addr_buf = addr >> 24;
+    int ret = im501_ring_init(&ring);
 
-    spi_cmd = (addr_buf == 0x10) ? IM501_SPI_CMD_IM_WR : IM501_SPI_CMD_DM_WR;
-    local_len = (len % 8) ? (((len / 8) + 1) * 8) : len;
-
-    write_buf = EspAudioAllocInner(1, IM501_SPI_BUF_LEN + 6);
-
-    if (write_buf == NULL) {
-        return -ENOMEM;
-    }
-
-    write_buf[0] = spi_cmd;                                         //Assign the command byte first, since it is fixed.
-
-    while (offset < local_len) {
-        if (offset + IM501_SPI_BUF_LEN <= local_len) {
-            end = IM501_SPI_BUF_LEN;
-        } else {
-            end = local_len % IM501_SPI_BUF_LEN;
-        }
-
-        write_buf[1] = ((addr + offset) & 0x000000ff) >> 0;     //The memory address
-        write_buf[2] = ((addr + offset) & 0x0000ff00) >> 8;
-        write_buf[3] = ((addr + offset) & 0x00ff0000) >> 16;
-        write_buf[4] = ((end / 2) & 0x00ff) >> 0;               //The word counter low byte.
-        write_buf[5] = ((end / 2) & 0xff00) >> 8;               //Assign the high order word counter, since it is fixed.
+    while (ret == 0 && offset < len) {
+        int end = (len - offset > IM501_SPI_BUF_LEN) ? IM501_SPI_BUF_LEN : len - offset;
+        int padded = (end + 7) & ~7;
+        uint8_t *p = im501_ring_get(&ring);
 
+        memcpy(p, txbuf + offset, end);
+        memset(p + end, 0, padded - end);
         if (fw_type == IM501_DSP_FW) {
-            for (i = 0; i < end; i += 8) {
-                write_buf[i + 13] = txbuf[offset + i + 0];
-                write_buf[i + 12] = txbuf[offset + i + 1];
-                write_buf[i + 11] = txbuf[offset + i + 2];
-                write_buf[i + 10] = txbuf[offset + i + 3];
-                write_buf[i + 9] = txbuf[offset + i + 4];
-                write_buf[i + 8] = txbuf[offset + i + 5];
-                write_buf[i + 7] = txbuf[offset + i + 6];
-                write_buf[i + 6] = txbuf[offset + i + 7];
-            }
-        } else if (fw_type == IM501_EFT_FW) {
-            memcpy(write_buf + 6, txbuf + offset, end);
-//              for (i = 0; i < end; i += 8) {
-//                  write_buf[i + 6] = txbuf[offset + i + 0];
-//                  write_buf[i + 7] = txbuf[offset + i + 1];
-//                  write_buf[i + 8] = txbuf[offset + i + 2];
-//                  write_buf[i + 9] = txbuf[offset + i + 3];
-//                  write_buf[i + 10] = txbuf[offset + i + 4];
-//                  write_buf[i + 11] = txbuf[offset + i + 5];
-//                  write_buf[i + 12] = txbuf[offset + i + 6];
-//                  write_buf[i + 13] = txbuf[offset + i + 7];
-//              }
+            im501_8byte_swap(p, padded);    // the iM501 firmware is MSB first in 8 byte words
         }
-
-        t.length = (end + 6) * 8;                     //Command is 8 bits
-        t.flags = 0;
-        t.tx_buffer = write_buf;
-
-        ret = spi_device_queue_trans(im501_spi, &t, portMAX_DELAY);
-        counter++;
-
-        if (ret) {
-            ESP_LOGE(IM501_TAG, "in %s line %d", __func__, __LINE__);
-            ret = -1;
-            break;
-        }
-
-        offset += IM501_SPI_BUF_LEN;
-    }
-
-    for (i = 0; i < counter; i++) {
-        ret |= spi_device_get_trans_result(im501_spi, &r, portMAX_DELAY);
+        ret = im501_ring_queue(&ring, addr + offset, padded);
+        offset += end;
     }
 
+    ret |= im501_ring_flush(&ring);
+    im501_ring_deinit(&ring);
     if (ret) {
         ESP_LOGE(IM501_TAG, "in %s line %d", __func__, __LINE__);
         ret = -1;
     }
-
-    free(write_buf);
-
     return ret;
 }
 
@@ -610,14 +692,237 @@ int request_stop_voice_buf_trans(void)
     return err;
 }
 
+/*
+ * Voice stream: every TO_HOST_CMD_DATA_BUF_RDY bank is read straight into a free block of the ring, in
+ * IM501_VOICE_CHUNK pieces. Up to IM501_VOICE_INFLIGHT pieces stay queued on the bus, so piece n is swapped
+ * while the next ones are on the wire. All transactions are collected before the bank is acked, the ack and
+ * the other register accesses use spi_device_transmit on the same device.
+ */
+#define IM501_VOICE_CHUNK               512
+#define IM501_VOICE_INFLIGHT            3       // header + data per piece, the device queue holds 7
+#define IM501_VOICE_CHUNK_NUM           (HW_VOICE_BUF_BANK_SIZE / IM501_VOICE_CHUNK)
+
+typedef struct {
+    int slot;
+    uint32_t index;
+} im501_voice_msg_t;
+
+typedef struct {
+    uint8_t *blocks;
+    int block_num;
+    QueueHandle_t free_q;
+    QueueHandle_t full_q;
+    int cur;                    // the block held by the consumer, -1 for none
+    uint32_t dropped;
+} im501_voice_stream_t;
+
+static im501_voice_stream_t *im501_voice;
+static SemaphoreHandle_t im501_voice_lock;     // keeps the ring alive while the irq work fills it
+static TaskHandle_t im501_reader;
+
+static int im501_voice_queue_chunk(uint8_t *hdr, spi_transaction_t *t, uint32_t addr, uint8_t *rx)
+{
+    hdr[0] = IM501_SPI_CMD_DM_RD;
+    hdr[1] = (addr & 0x000000ff) >> 0;
+    hdr[2] = (addr & 0x0000ff00) >> 8;
+    hdr[3] = (addr & 0x00ff0000) >> 16;
+    hdr[4] = (IM501_VOICE_CHUNK >> 1) & 0xff;
+    hdr[5] = (IM501_VOICE_CHUNK >> (1 + 8)) & 0xff;
+
+    memset(t, 0, sizeof(spi_transaction_t) * 2);
+    t[0].length = 6 * 8;
+    t[0].tx_buffer = hdr;
+    t[1].length = IM501_VOICE_CHUNK * 8;
+    t[1].rx_buffer = rx;
+    int ret = spi_device_queue_trans(im501_spi, &t[0], portMAX_DELAY);
+    ret |= spi_device_queue_trans(im501_spi, &t[1], portMAX_DELAY);
+    return ret;
+}
+
+// one voice bank into buf, swapped to host order
+static int im501_voice_read_bank(uint32_t addr, uint8_t *buf)
+{
+    uint8_t hdr[IM501_VOICE_INFLIGHT][6];
+    spi_transaction_t t[IM501_VOICE_INFLIGHT][2];
+    spi_transaction_t *r;
+    int queued = 0, ret = 0;
+
+    while (queued < IM501_VOICE_INFLIGHT && queued < IM501_VOICE_CHUNK_NUM) {
+        ret |= im501_voice_queue_chunk(hdr[queued], t[queued], addr + queued * IM501_VOICE_CHUNK,
+                                       buf + queued * IM501_VOICE_CHUNK);
+        queued++;
+    }
+    for (int i = 0; i < IM501_VOICE_CHUNK_NUM; i++) {
+        ret |= spi_device_get_trans_result(im501_spi, &r, portMAX_DELAY);
+        ret |= spi_device_get_trans_result(im501_spi, &r, portMAX_DELAY);
+        if (queued < IM501_VOICE_CHUNK_NUM) {
+            int s = queued % IM501_VOICE_INFLIGHT;
+            ret |= im501_voice_queue_chunk(hdr[s], t[s], addr + queued * IM501_VOICE_CHUNK,
+                                           buf + queued * IM501_VOICE_CHUNK);
+            queued++;
+        }
+        im501_8byte_swap(buf + i * IM501_VOICE_CHUNK, IM501_VOICE_CHUNK);
+    }
+    if (ret) {
+        ESP_LOGE(IM501_TAG, "in %s line %d", __func__, __LINE__);
+        return -1;
+    }
+    return 0;
+}
+
+// called from the irq work, a full ring drops the bank, the DSP does not wait for the host
+static int im501_voice_push(uint32_t addr, uint32_t index)
+{
+    im501_voice_stream_t *vs;
+    im501_voice_msg_t msg = {.index = index};
+    int ret = 0;
+
+    if (im501_voice_lock == NULL) {
+        return 0;
+    }
+    xSemaphoreTake(im501_voice_lock, portMAX_DELAY);
+    vs = im501_voice;
+    if (vs == NULL) {
+        // not streaming
+    } else if (xQueueReceive(vs->free_q, &msg.slot, 0) != pdTRUE) {
+        vs->dropped++;
+    } else if (im501_voice_read_bank(addr, vs->blocks + msg.slot * HW_VOICE_BUF_BANK_SIZE) != 0) {
+        xQueueSend(vs->free_q, &msg.slot, 0);
+        ret = -1;
+    } else {
+        xQueueSend(vs->full_q, &msg, 0);
+    }
+    xSemaphoreGive(im501_voice_lock);
+    return ret;
+}
+
+/**
+ * im501_voice_stream_start - Start the DSP voice buffer transfer and the reader task.
+ * @block_num: Blocks of HW_VOICE_BUF_BANK_SIZE in the ring, at least 2.
+ *
+ * The reader is the im501_int task, created on the first start and kept, each DSP interrupt
+ * reads the ready bank into the ring.
+ * Returns 0 for success.
+ */
+int im501_voice_stream_start(int block_num)
+{
+    IM501_ASSERT(im501_voice != NULL, "voice stream already started", -1);
+    IM501_ASSERT(block_num < 2, "voice stream needs 2 blocks at least", -1);
+
+    im501_voice_stream_t *vs = calloc(1, sizeof(im501_voice_stream_t));
+    IM501_CHECK_NULL(vs, "NO memory in %s, line: %d", -ENOMEM, __func__, __LINE__);
+    vs->block_num = block_num;
+    vs->cur = -1;
+    vs->blocks = EspAudioMalloc(block_num * HW_VOICE_BUF_BANK_SIZE, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL, 4);
+    vs->free_q = xQueueCreate(block_num, sizeof(int));
+    vs->full_q = xQueueCreate(block_num, sizeof(im501_voice_msg_t));
+    if (vs->blocks == NULL || vs->free_q == NULL || vs->full_q == NULL) {
+        ESP_LOGE(IM501_TAG, "NO memory in %s, line: %d", __func__, __LINE__);
+        goto err;
+    }
+    for (int i = 0; i < block_num; i++) {
+        xQueueSend(vs->free_q, &i, 0);
+    }
+    if (im501_voice_lock == NULL && (im501_voice_lock = xSemaphoreCreateMutex()) == NULL) {
+        ESP_LOGE(IM501_TAG, "NO memory in %s, line: %d", __func__, __LINE__);
+        goto err;
+    }
+    if (im501_reader == NULL && xTaskCreate(im501_int, "im501_int", 3 * 1024, NULL, 10, &im501_reader) != pdPASS) {
+        ESP_LOGE(IM501_TAG, "create im501_int failed");
+        im501_reader = NULL;
+        goto err;
+    }
+    xSemaphoreTake(im501_voice_lock, portMAX_DELAY);
+    im501_voice = vs;
+    xSemaphoreGive(im501_voice_lock);
+    if (request_start_voice_buf_trans() != 0) {
+        im501_voice_stream_stop();
+        return -1;
+    }
+    return 0;
+
+err:
+    if (vs->free_q) {
+        vQueueDelete(vs->free_q);
+    }
+    if (vs->full_q) {
+        vQueueDelete(vs->full_q);
+    }
+    EspAudioFree(vs->blocks);
+    free(vs);
+    return -1;
+}
+
+/**
+ * im501_voice_stream_stop - Stop the transfer and free the ring, the blocks handed out become invalid.
+ */
+int im501_voice_stream_stop(void)
+{
+    im501_voice_stream_t *vs = im501_voice;
+    IM501_CHECK_NULL(vs, "voice stream not started", -1);
+
+    int err = request_stop_voice_buf_trans();
+    xSemaphoreTake(im501_voice_lock, portMAX_DELAY);
+    im501_voice = NULL;
+    xSemaphoreGive(im501_voice_lock);
+    if (vs->dropped) {
+        ESP_LOGW(IM501_TAG, "voice stream dropped %u banks", vs->dropped);
+    }
+    vQueueDelete(vs->free_q);
+    vQueueDelete(vs->full_q);
+    EspAudioFree(vs->blocks);
+    free(vs);
+    return err;
+}
+
+/**
+ * im501_voice_acquire - Take the oldest voice bank, the data stays in the ring until im501_voice_release.
+ * @data: The bank, 16 bit PCM in host order.
+ * @index: The DSP package index of the bank, can be NULL.
+ * @wait: Ticks to wait for a bank.
+ *
+ * Returns the bank length, or -1 if none came in time. One consumer, one bank held at a time.
+ */
+int im501_voice_acquire(uint8_t **data, uint32_t *index, TickType_t wait)
+{
+    im501_voice_stream_t *vs = im501_voice;
+    im501_voice_msg_t msg;
+    IM501_CHECK_NULL(vs, "voice stream not started", -1);
+
+    if (vs->cur >= 0 || xQueueReceive(vs->full_q, &msg, wait) != pdTRUE) {
+        return -1;
+    }
+    vs->cur = msg.slot;
+    *data = vs->blocks + msg.slot * HW_VOICE_BUF_BANK_SIZE;
+    if (index) {
+        *index = msg.index;
+    }
+    return HW_VOICE_BUF_BANK_SIZE;
+}
+
+void im501_voice_release(void)
+{
+    im501_voice_stream_t *vs = im501_voice;
+    if (vs == NULL || vs->cur < 0) {
+        return;
+    }
+    xQueueSend(vs->free_q, &vs->cur, 0);
+    vs->cur = -1;
+}
+
+uint32_t im501_voice_dropped(void)
+{
+    return im501_voice ? im501_voice->dropped : 0;
+}
+
 int parse_to_host_command(to_host_cmd cmd)
 {
     int err = 0;
     uint8_t *pdata;
     uint32_t pdm_clki_rate = 2 * 1000 * 1000;
-    uint32_t address;
+    uint32_t address = 0;
 
-    ESP_LOGI(IM501_TAG, "IRQ line %d cmd_byte = %#x\n", __LINE__, cmd.cmd_byte);
+    ESP_LOGD(IM501_TAG, "IRQ line %d cmd_byte = %#x\n", __LINE__, cmd.cmd_byte);
 
     if (cmd.cmd_byte == TO_HOST_CMD_KEYWORD_DET) { //Info host Keywords detected
 
@@ -660,11 +965,9 @@ int parse_to_host_command(to_host_cmd cmd)
             address = HW_VOICE_BUF_START + HW_VOICE_BUF_BANK_SIZE ; //BANK1 address
         }
 
-        ESP_LOGI(IM501_TAG, "ADD queue here to recieve recording data");
-
-//        sendqueue();
-//        err = im501_spi_burst_read_dram( address, buf, HW_VOICE_BUF_BANK_SIZE );
-//        err |= request_stop_voice_buf_trans();
+        if (address) {
+            err = im501_voice_push(address, voice_buf_data.index);
+        }
 
         if (err != NO_ERR) {
             return err;
@@ -750,84 +1053,148 @@ static void im501_8byte_swap(uint8_t *rxbuf, uint32_t len)
     }
 }
 
-static int im501_dsp_load_single_fw_file(int file_index, uint32_t addr, int fw_type)
+#ifdef FW_BURST_RD_CHECK
+// read every chunk back and compare it with the flash, after the upload so it does not stall the ring
+static int im501_dsp_verify_fw(const esp_partition_t *DspBin, uint32_t addr, int fw_type)
 {
-    uint8_t *local_buf = NULL, *data = NULL;
-    int i, ret = 0;
+    uint8_t *data = EspAudioAllocInner(1, INTERNAL_SIZE);
+    uint8_t *local_buf = EspAudioAllocInner(1, INTERNAL_SIZE);
+    int partitionOffset = 0, ret_len, ret = 0;
 
-    esp_partition_t *DspBin = NULL;
-    int index = 0, partitionOffset = 0, ret_len;
-    index = 0x20 + file_index;
-
-    // partition table
-    DspBin = im501_partition_init(index);
-    IM501_CHECK_NULL(DspBin, "partition init", -1);
-    data = EspAudioAllocInner(1, INTERNAL_SIZE);
-    IM501_CHECK_NULL(data, "EspAudioAllocInner", -1);
-
-#ifdef FW_RD_CHECK
-    local_buf = (uint8_t *)EspAudioAllocInner(1, INTERNAL_SIZE);
-
-    if (!local_buf) {
+    if (data == NULL || local_buf == NULL) {
         ESP_LOGE(IM501_TAG, "NO memory in %s, line: %d", __func__, __LINE__);
         ret = -1;
         goto END;
     }
-
-#endif
-
     while (partitionOffset < DspBin->size) {
-        if (partitionOffset + INTERNAL_SIZE < DspBin->size) {
-            ret_len = INTERNAL_SIZE;
-        } else {
-            ret_len = DspBin->size - partitionOffset;
-        }
-
-        if (esp_partition_read(DspBin, partitionOffset, data, ret_len) != 0) {
+        ret_len = (DspBin->size - partitionOffset > INTERNAL_SIZE) ? INTERNAL_SIZE : DspBin->size - partitionOffset;
+        if (esp_partition_read(DspBin, partitionOffset, data, ret_len) != 0
+            || im501_spi_burst_read_dram(addr + partitionOffset, local_buf, (ret_len + 7) & ~7) != 0) {
             ESP_LOGE(IM501_TAG, "in %s, line: %d", __func__, __LINE__);
+            ret = -1;
             break;
         }
-
-        im501_spi_burst_write(addr + partitionOffset, data, ret_len, fw_type);
-
-#ifdef FW_BURST_RD_CHECK
-        im501_spi_burst_read_dram(addr + partitionOffset, local_buf, ret_len);
-
         if (fw_type == IM501_DSP_FW) {
-            im501_8byte_swap(local_buf, ret_len);
+            im501_8byte_swap(local_buf, (ret_len + 7) & ~7);
         }
-
-        for (i = 0; i < ret_len; i++) {
+        for (int i = 0; i < ret_len; i++) {
             if (local_buf[i] != data[i]) {
-                ESP_LOGE(IM501_TAG, "%s: fw read %#x vs write %#x @ %#x\n", __func__, local_buf[i], data[i], addr + i);
+                ESP_LOGE(IM501_TAG, "%s: fw read %#x vs write %#x @ %#x\n", __func__, local_buf[i], data[i], addr + partitionOffset + i);
                 ret = -1;
                 goto END;
             }
         }
-
-#endif
         partitionOffset += ret_len;
-
     }
 
 END:
-
     free(data);
+    free(local_buf);
+    return ret;
+}
+#endif
+
+/*
+ * Flash is read straight into the DMA buffer of a free slot and swapped there, while the
+ * slots queued before it are being sent
+ */
+static int im501_dsp_load_single_fw_file(im501_fw_ring_t *ring, int file_index, uint32_t addr, int fw_type)
+{
+    esp_partition_t *DspBin = NULL;
+    int partitionOffset = 0, ret_len, ret = 0;
+    int64_t start = esp_timer_get_time();
+
+    // partition table
+    DspBin = im501_partition_init(0x20 + file_index);
+    IM501_CHECK_NULL(DspBin, "partition init", -1);
 
-    if (local_buf) {
-        free(local_buf);
+    while (partitionOffset < DspBin->size) {
+        ret_len = (DspBin->size - partitionOffset > IM501_SPI_BUF_LEN) ? IM501_SPI_BUF_LEN : DspBin->size - partitionOffset;
+        int padded = (ret_len + 7) & ~7;
+        uint8_t *p = im501_ring_get(ring);
+
+        if (esp_partition_read(DspBin, partitionOffset, p, ret_len) != 0) {
+            ESP_LOGE(IM501_TAG, "in %s, line: %d", __func__, __LINE__);
+            ret = -1;
+            break;
+        }
+        memset(p + ret_len, 0, padded - ret_len);
+        if (fw_type == IM501_DSP_FW) {
+            im501_8byte_swap(p, padded);
+        }
+        if (im501_ring_queue(ring, addr + partitionOffset, padded) != 0) {
+            ret = -1;
+            break;
+        }
+        partitionOffset += ret_len;
     }
+    ret |= im501_ring_flush(ring);
+    int64_t written = esp_timer_get_time();
 
+#ifdef FW_BURST_RD_CHECK
+    if (ret == 0) {
+        ret = im501_dsp_verify_fw(DspBin, addr, fw_type);
+    }
+#endif
+    int us = (int)(written - start);
+    ESP_LOGI(IM501_TAG, "fw %d: %d bytes in %d us (%d KB/s), verify %d us", file_index, DspBin->size, us,
+             us ? (int)((int64_t)DspBin->size * 1000000 / 1024 / us) : 0, (int)(esp_timer_get_time() - written));
     return ret;
 }
 
+// pick the fastest clock at which a test pattern reads back the same
+static int im501_spi_negotiate_clock(uint32_t addr)
+{
+    uint8_t *pattern = EspAudioAllocInner(1, 64);
+    uint8_t *readback = EspAudioAllocInner(1, 64);
+    int clk = IM501_SPI_CLK_HZ;
+
+    if (pattern && readback) {
+        for (int i = 0; i < 64; i++) {
+            pattern[i] = (i & 1) ? 0xA5 ^ i : 0x5A + i;
+        }
+        for (int n = 0; n < sizeof(im501_fw_clk_hz) / sizeof(im501_fw_clk_hz[0]); n++) {
+            if (im501_spi_set_clock(im501_fw_clk_hz[n]) != 0) {
+                continue;
+            }
+            memset(readback, 0, 64);
+            if (im501_spi_burst_write(addr, pattern, 64, IM501_EFT_FW) == 0
+                && im501_spi_burst_read_dram(addr, readback, 64) == 0
+                && memcmp(pattern, readback, 64) == 0) {
+                clk = im501_fw_clk_hz[n];
+                break;
+            }
+            ESP_LOGW(IM501_TAG, "spi at %d Hz failed the read back", im501_fw_clk_hz[n]);
+        }
+    }
+    if (clk == IM501_SPI_CLK_HZ) {
+        im501_spi_set_clock(clk);
+    }
+    free(pattern);
+    free(readback);
+    return clk;
+}
+
 static void im501_dsp_load_fw(void)
 {
+    im501_fw_ring_t ring;
+    int ret;
+    int64_t start = esp_timer_get_time();
     ESP_LOGI(IM501_TAG, "%s: entering...\n", __func__);
 
-    im501_dsp_load_single_fw_file(FILE_IRAM0_FM, 0x10000000, IM501_DSP_FW);
-    im501_dsp_load_single_fw_file(FILE_DRAM0_FM, 0x0ffc0000, IM501_DSP_FW);
-    im501_dsp_load_single_fw_file(FILE_DRAM1_FM, 0x0ffe0000, IM501_DSP_FW);
+    int clk = im501_spi_negotiate_clock(0x0ffc0000);
+    ret = im501_ring_init(&ring);
+    if (ret == 0) {
+        ret |= im501_dsp_load_single_fw_file(&ring, FILE_IRAM0_FM, 0x10000000, IM501_DSP_FW);
+        ret |= im501_dsp_load_single_fw_file(&ring, FILE_DRAM0_FM, 0x0ffc0000, IM501_DSP_FW);
+        ret |= im501_dsp_load_single_fw_file(&ring, FILE_DRAM1_FM, 0x0ffe0000, IM501_DSP_FW);
+    }
+    im501_ring_deinit(&ring);
+    if (clk != IM501_SPI_CLK_HZ) {
+        // the voice buffer reads keep the clock they were tuned at
+        im501_spi_set_clock(IM501_SPI_CLK_HZ);
+    }
+    ESP_LOGI(IM501_TAG, "%s: %s at %d Hz in %d us", __func__, ret ? "failed" : "done", clk, (int)(esp_timer_get_time() - start));
 }
 
 int im501_fw_loaded()
@@ -905,7 +1272,7 @@ static void im501_irq_handling_work()
     cmd.status = pdata[3] >> 7;
     cmd.cmd_byte = pdata[3] & 0x7F;
     cmd.attri = pdata[0] | (pdata[1] * 256) | (pdata[2] * 256 * 256);
-    ESP_LOGI(IM501_TAG, "%s: cmd[%#x, %#x, %#x]\n", __func__, cmd.status, cmd.cmd_byte, cmd.attri);
+    ESP_LOGD(IM501_TAG, "%s: cmd[%#x, %#x, %#x]\n", __func__, cmd.status, cmd.cmd_byte, cmd.attri);
 
     err = parse_to_host_command(cmd);
 
@@ -951,9 +1318,43 @@ int im501_intr_init(void *queue)
     return res;
 }
 
+static uint32_t im501_frame_counter(void)
+{
+    uint8_t read_data[4] = {0};
+    im501_spi_read_dram(TO_DSP_FRAMECOUNTER_ADDR, read_data);
+    return read_data[3] << 24 | read_data[2] << 16 | read_data[1] << 8 | read_data[0];
+}
+
+static int im501_boot_poll(void *ctx)
+{
+    return im501_frame_counter() != *(uint32_t *)ctx;
+}
+
+static int im501_fw_running(void)
+{
+    uint32_t first = im501_frame_counter();
+    return dsp_boot_wait(im501_boot_poll, &first, IM501_BOOT_TIMEOUT_MS, IM501_BOOT_POLL_MS) > 0;
+}
+
+// the sha-256 of the firmware partitions folded into one, 0 when one is missing
+static uint32_t im501_fw_hash(void)
+{
+    uint8_t sha[32];
+    uint32_t hash = DSP_BOOT_HASH_INIT;
+    for (int i = 0; i < NUM_FLASH_FILES; i++) {
+        esp_partition_t *part = im501_partition_init(0x20 + i);
+        if (part == NULL || esp_partition_get_sha256(part, sha) != ESP_OK) {
+            return 0;
+        }
+        hash = dsp_boot_hash(hash, sha, sizeof(sha));
+    }
+    return hash;
+}
+
 int initial_im501()
 {
-    unsigned int counter1, counter2;
+    dsp_boot_record_t rec = {0};
+    uint32_t hash;
 
     esp_err_t ret;
     spi_bus_config_t buscfg = {
@@ -963,18 +1364,11 @@ int initial_im501()
         .quadwp_io_num = -1,
         .quadhd_io_num = -1
     };
-    spi_device_interface_config_t devcfg = {
-        .clock_speed_hz = 10 * 1000 * 1000,     //Clock out at 10 MHz
-        .mode = 0,                              //SPI mode 0
-        .spics_io_num = DSP_FT_SPI_CS,             //CS pin
-        .queue_size = 7,                        //We want to be able to queue 7 transactions at a time
-        .pre_cb = NULL, //Specify pre-transfer callback to handle D/C line
-    };
     //Initialize the SPI bus
     ret = spi_bus_initialize(HSPI_HOST, &buscfg, 1);
     assert(ret == ESP_OK);
-    //Attach the LCD to the SPI bus
-    ret = spi_bus_add_device(HSPI_HOST, &devcfg, &im501_spi);
+    //Attach the LCD to the SPI bus, at 10 MHz
+    ret = im501_spi_add_device(IM501_SPI_CLK_HZ);
     assert(ret == ESP_OK);
 
     // //check
@@ -1007,26 +1401,29 @@ int initial_im501()
 //        vTaskDelete(NULL);
 //    }
 
-    if (im501_fw_loaded() != 0) {
-        ESP_LOGE(IM501_TAG, "im501_fw_loaded failed");
-        return -1;
-    }
-
-    //check counter
-    char read_data[4];
-    im501_spi_read_dram(TO_DSP_FRAMECOUNTER_ADDR, read_data);
-    counter1 = read_data[3] << 24 | read_data[2] << 16 | read_data[1] << 8 | read_data[0];
-    vTaskDelay(50 / portTICK_RATE_MS);
-    im501_spi_read_dram(TO_DSP_FRAMECOUNTER_ADDR, read_data);
-    counter2 = read_data[3] << 24 | read_data[2] << 16 | read_data[1] << 8 | read_data[0];
+    // a warm boot finds the DSP still running the firmware it was given last time
+    hash = im501_fw_hash();
+    if (hash && dsp_boot_record_get(IM501_BOOT_KEY, &rec) == 0 && rec.hash == hash && im501_fw_running()) {
+        ESP_LOGI(IM501_TAG, "firmware 0x%08x already runs, upload skipped", hash);
+        im501_dsp_mode = 1;
+    } else {
+        if (im501_fw_loaded() != 0) {
+            ESP_LOGE(IM501_TAG, "im501_fw_loaded failed");
+            return -1;
+        }
 
-    if (counter1 == counter2) {
-        ESP_LOGE(IM501_TAG, "%d %d not running", counter2, counter1);
-        return -1;
+        //check counter
+        if (!im501_fw_running()) {
+            ESP_LOGE(IM501_TAG, "frame counter 0x%x, not running", im501_frame_counter());
+            return -1;
+        }
+        if (hash) {
+            rec.hash = hash;
+            rec.flags = 0;
+            dsp_boot_record_set(IM501_BOOT_KEY, &rec);
+        }
     }
 
-    ESP_LOGI(IM501_TAG, "counter2 %d counter1 %d", counter2, counter1);
-
     //vTaskDelay(3000);
 
     // int set_mic_gain(uint16_t mic, uint16_t gain);
@@ -1081,8 +1478,10 @@ void im501_int(void *arg)
     while (1) {
         xQueueReceive(im501xQueue, &queueMessage, portMAX_DELAY);
         im501_irq_handling_work();
-        im501_spi_read_dram(TO_DSP_FRAMECOUNTER_ADDR, read_data);
-        ESP_LOGI(IM501_TAG, "counter2 : %x %x %x %x", read_data[3], read_data[2], read_data[1], read_data[0]);
+        if (im501_voice == NULL) {     // one more bus access per bank otherwise
+            im501_spi_read_dram(TO_DSP_FRAMECOUNTER_ADDR, read_data);
+            ESP_LOGI(IM501_TAG, "counter2 : %x %x %x %x", read_data[3], read_data[2], read_data[1], read_data[0]);
+        }
     }
     vQueueDelete(im501xQueue);
     vTaskDelete(NULL);
@@ -25,6 +25,9 @@
 #ifndef __IM501_SPI_H__
 #define __IM501_SPI_H__
 
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+
 typedef enum {
     FILE_IRAM0_FM,
     FILE_DRAM0_FM,
@@ -48,6 +51,16 @@ int request_start_voice_buf_trans(void);
 int request_stop_voice_buf_trans(void);
 int request_enter_psm(void);
 
+/*
+ * Voice stream, the DSP voice banks in a ring of DMA blocks, read by the im501_int task on each DSP
+ * interrupt. The consumer takes a bank with im501_voice_acquire and gives it back with im501_voice_release.
+ */
+int im501_voice_stream_start(int block_num);
+int im501_voice_stream_stop(void);
+int im501_voice_acquire(uint8_t **data, uint32_t *index, TickType_t wait);
+void im501_voice_release(void);
+uint32_t im501_voice_dropped(void);
+
 /**
  * codec2im501_pdm_clki_set - external function to set/unset the pdm_clki to im501
  * @set_flag: the flag to set or unset the pdm_clki.
@@ -7,7 +7,8 @@
 #include "esp_log.h"
 #include "board.h"
 #include "EspAudioAlloc.h"
-#include "FatFsSal.h"
+#include "sdcard_recorder.h"
+#include "audio_encoder.h"
 
 static char *TAG = "REC_TEST";
 
@@ -42,6 +43,9 @@ static char *TAG = "REC_TEST";
 //     return res;
 // }
 #define PLAYBACK_EN 0
+#define RECORD_ADPCM 1          // IMA ADPCM WAV, a quarter of the PCM bytes
+#define REC_SAMPLE_RATE 16000
+#define ADPCM_BLOCK_BYTES 256
 
 void putTask(void *pv)
 {
@@ -49,34 +53,61 @@ void putTask(void *pv)
     vTaskDelay(5000 / portTICK_RATE_MS);
 #define OUTBUF_SIZE (5 * 1024)
 #if PLAYBACK_EN == 0
-    FILE *file = fopen("/sdcard/DspPdmMono.pcm", "w+");//pdm is always mono
-    if (NULL == file) {
+#if RECORD_ADPCM
+    sd_recorder_config_t rec_cfg = SD_RECORDER_DEFAULT_CONFIG("/sdcard/DspPdmMono.wav");//pdm is always mono
+#else
+    sd_recorder_config_t rec_cfg = SD_RECORDER_DEFAULT_CONFIG("/sdcard/DspPdmMono.pcm");
+#endif
+    sd_recorder_handle_t rec = sd_recorder_open(&rec_cfg);
+    if (NULL == rec) {
         ESP_LOGE(TAG, "open file failed,[%d]", __LINE__);
         vTaskDelete(NULL);
         return;
     }
+#endif
+#if PLAYBACK_EN == 0 && RECORD_ADPCM
+    // one block per read, so a block is on its way to the card 32 ms after its first sample
+    audio_encoder_t *enc = audio_encoder_adpcm_create(REC_SAMPLE_RATE, ADPCM_BLOCK_BYTES);
+    if (NULL == enc) {
+        sd_recorder_close(rec);
+        vTaskDelete(NULL);
+        return;
+    }
+    uint8_t block[ADPCM_BLOCK_BYTES];
+    audio_adpcm_wav_header(block, REC_SAMPLE_RATE, ADPCM_BLOCK_BYTES, 0);
+    sd_recorder_write(rec, block, 60, portMAX_DELAY);
 #endif
     uint8_t *outBuf = (uint8_t *)EspAudioAllocInner(1, OUTBUF_SIZE);
     if (NULL == outBuf) {
 #if PLAYBACK_EN == 0
-        fclose(file);
+        sd_recorder_close(rec);
 #endif
         ESP_LOGE(TAG, "outBuf malloc failed[%d]", __LINE__);
         vTaskDelete(NULL);
         return;
     }
+    int read_len = OUTBUF_SIZE;
+#if PLAYBACK_EN == 0 && RECORD_ADPCM
+    read_len = enc->frame_samples * sizeof(int16_t);
+#endif
     while (1) {
         // ESP_LOGI(TAG, "put running,%d", OUTBUF_SIZE);
-        int ret = i2s_read_bytes(1, (char *)outBuf, OUTBUF_SIZE, portMAX_DELAY);
+        int ret = i2s_read_bytes(1, (char *)outBuf, read_len, portMAX_DELAY);
 #if PLAYBACK_EN == 1
-        i2s_write_bytes(0, (char *)outBuf, OUTBUF_SIZE, portMAX_DELAY);
+        i2s_write_bytes(0, (char *)outBuf, read_len, portMAX_DELAY);
+#elif RECORD_ADPCM
+        enc->encode(enc, (int16_t *)outBuf, block);
+        sd_recorder_write(rec, block, ADPCM_BLOCK_BYTES, portMAX_DELAY);
 #else
-        FatfsComboWrite(outBuf, 1, OUTBUF_SIZE, file);
+        sd_recorder_write(rec, outBuf, OUTBUF_SIZE, portMAX_DELAY);
 #endif
     }
     free(outBuf);
 #if PLAYBACK_EN == 0
-    fclose(file);
+#if RECORD_ADPCM
+    audio_encoder_destroy(enc);
+#endif
+    sd_recorder_close(rec);
 #endif
     vTaskDelete(NULL);
 }
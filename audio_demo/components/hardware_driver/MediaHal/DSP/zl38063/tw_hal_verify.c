@@ -40,16 +40,9 @@ VprocStatusType LoadFwrConfig_Alt(uint8 mode)
 {
     VprocStatusType status = VPROC_STATUS_SUCCESS;
     if ((mode == 0) || (mode == 1)) {
-        twFirmware st_Firmware;
-        st_Firmware.st_Fwr = (twFwr*)st_twFirmware;
-        st_Firmware.twFirmwareStreamLen = (uint16)firmwareStreamLen;
-        st_Firmware.execAddr  = (uint32)executionAddress;
-        st_Firmware.havePrgmBase = (uint8)haveProgramBaseAddress;
-        st_Firmware.prgmBase = (uint32)programBaseAddress;
-
         printf("\t1- Firmware boot loading started ....\n");
 
-        status  = VprocTwolfHbiBoot_alt(&st_Firmware);
+        status  = VprocTwolfHbiBoot_alt(zl38063_fw_image, zl38063_fw_image_len);
         if (status != VPROC_STATUS_SUCCESS) {
             printf("Error %d:VprocTwolfHbiBoot()\n", status);
 
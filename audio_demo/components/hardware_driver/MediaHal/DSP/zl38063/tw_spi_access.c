@@ -15,10 +15,32 @@
 // #include "zl38063_firmware.c"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "esp_timer.h"
 
 #include "board.h"
+#include "dsp_boot_state.h"
 /*quick test*/
 
+#define TW_BOOT_KEY         "zl38063"
+#define TW_BOOT_POLL_MS     20
+#define TW_BOOT_TIMEOUT_MS  1000    /*the device boots the image from its own flash*/
+
+static int tw_boot_poll(void *ctx)
+{
+    uint16 status = 0;
+    if (VprocTwolfGetAppStatus(&status) != VPROC_STATUS_SUCCESS) {
+        return 0;
+    }
+    return status;
+}
+
+/*what goes into the device: the firmware image and the config record*/
+static uint32_t tw_fw_hash(void)
+{
+    uint32_t hash = dsp_boot_hash(DSP_BOOT_HASH_INIT, zl38063_fw_image, zl38063_fw_image_len);
+    return dsp_boot_hash(hash, st_twConfig, configStreamLen * sizeof(dataArr));
+}
+
 /*LoadFwrConfig_Alt - to load a converted *s3, *cr2 to c code into the device.
 * Basically instead of loading the *.s3, *cr2 directly,
 * use the tw_convert tool to convert the ascii hex fwr mage into code and compile
@@ -35,15 +57,21 @@ int tw_upload_dsp_firmware(int mode)
         short a;
         char b;
     } test_bigendian;
+    dsp_boot_record_t rec = {0};
+    uint32_t hash = tw_fw_hash();
     if (mode >= 0) {
-        uint16 vol = 0;
-        vTaskDelay(1000 / portTICK_PERIOD_MS);
-        int ret = VprocTwolfGetAppStatus(&vol);
-        if (vol) {
-            ESP_LOGW(TAG_SPI, "MCS ret:%d,Status:%d", ret, vol);
+        /* Only wait for the device when it has this image in its flash to boot,
+         * else just see whether it still runs it from RAM since a warm reset
+         */
+        dsp_boot_record_t saved;
+        int known = (dsp_boot_record_get(TW_BOOT_KEY, &saved) == 0) && (saved.hash == hash);
+        int timeout = (known && (saved.flags & DSP_BOOT_IN_FLASH)) ? TW_BOOT_TIMEOUT_MS : 0;
+        int state = dsp_boot_wait(tw_boot_poll, NULL, timeout, TW_BOOT_POLL_MS);
+        if (known && state > 0) {
+            ESP_LOGW(TAG_SPI, "MCS already runs image 0x%08x, Status:%d", hash, state);
             return 0;
         }
-        ESP_LOGI(TAG_SPI, "** Loading DSP firmware ret:%d,Status:%d **", ret, vol);
+        ESP_LOGI(TAG_SPI, "** Loading DSP firmware 0x%08x, Status:%d **", hash, state);
     } else {
         mode = 0;
     }
@@ -57,23 +85,18 @@ int tw_upload_dsp_firmware(int mode)
     }
 
     if ((mode == 0) || (mode == 1)) {
-        twFirmware st_Firmware;
-        st_Firmware.st_Fwr = (twFwr *)st_twFirmware;
-        st_Firmware.twFirmwareStreamLen = (uint16)firmwareStreamLen;
-        st_Firmware.execAddr  = (uint32)executionAddress;
-        st_Firmware.havePrgmBase = (uint8)haveProgramBaseAddress;
-        st_Firmware.prgmBase = (uint32)programBaseAddress;
-
+        int64_t start = esp_timer_get_time();
         ESP_LOGI(TAG_SPI, "1- Firmware boot loading started ....\n");
 
-        status  = VprocTwolfHbiBoot_alt(&st_Firmware);
+        status  = VprocTwolfHbiBoot_alt(zl38063_fw_image, zl38063_fw_image_len);
         if (status != VPROC_STATUS_SUCCESS) {
             DEBUG_LOGE(TAG_SPI, "Error %d:VprocTwolfHbiBoot()\n", status);
             // VprocTwolfHbiCleanup();
             return -1;
         }
 
-        ESP_LOGI(TAG_SPI, "2- Loading the image to RAM....done\n");
+        ESP_LOGI(TAG_SPI, "2- Loading the image to RAM....done, %d bytes in %d ms\n",
+                 (int)zl38063_fw_image_len, (int)((esp_timer_get_time() - start) / 1000));
 #ifdef SAVE_IMAGE_TO_FLASH
         ESP_LOGI(TAG_SPI, "-- Saving firmware to flash....\n");
         status = VprocTwolfSaveImgToFlash();
@@ -83,7 +106,7 @@ int tw_upload_dsp_firmware(int mode)
             return status;
         }
         ESP_LOGI(TAG_SPI, "-- Saving firmware to flash....done\n");
-
+        rec.flags |= DSP_BOOT_IN_FLASH;
 #endif
 
         status  = VprocTwolfFirmwareStart();
@@ -123,6 +146,11 @@ int tw_upload_dsp_firmware(int mode)
         return status;
     }
 #endif
+    if (mode == 0) {
+        /*a later boot finding this image running skips the upload*/
+        rec.hash = hash;
+        dsp_boot_record_set(TW_BOOT_KEY, &rec);
+    }
     // VprocTwolfHbiCleanup();
     ESP_LOGI(TAG_SPI, "Device boot loading completed successfully...\n");
     return status;
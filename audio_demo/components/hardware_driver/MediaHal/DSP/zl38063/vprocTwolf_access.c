@@ -77,9 +77,22 @@
 
 #define TOTAL_FWR_DATA_WORD_PER_LINE 24
 #define TOTAL_FWR_DATA_BYTE_PER_LINE 128
+
+/*binary firmware image made by the zl38063_fw2img tool, fields are big-endian*/
+#define TWOLF_IMG_HDR_LEN           12   /*"ZLFW", execution address, program base*/
+#define TWOLF_IMG_BLOCK_HDR_LEN     6    /*target address, number of words*/
+#define TWOLF_IMG_BLOCK_MAX_WORDS   (TOTAL_FWR_DATA_BYTE_PER_LINE / 2)
+#define TWOLF_IMG_RD32(p) \
+    (((uint32)(p)[0] << 24) | ((uint32)(p)[1] << 16) | ((uint32)(p)[2] << 8) | (uint32)(p)[3])
+#define TWOLF_IMG_RD16(p) \
+    ((uint16)(((uint16)(p)[0] << 8) | (p)[1]))
+
 #define TWOLF_STATUS_NEED_MORE_DATA 22
 #define TWOLF_STATUS_BOOT_COMPLETE 23
 
+#define TWOLF_HBI_PAGE_WORDS       128  /*a page is 256 bytes*/
+#define TWOLF_HBI_BURST_MAX_WORDS  126  /*one HBI command, fits VPROC_HAL_BUF_MAX*/
+
 #define TWOLF_MBCMDREG_SPINWAIT  10000
 #define TWOLF_MAILBOX_SPINWAIT  1000
 
@@ -209,149 +222,140 @@ static VprocStatusType VprocTwolfCheckCmdResult(void)
     return VPROC_STATUS_SUCCESS;
 }
 
-/* spis_tw_hbi_rd16()- Decode the 16-bit T-WOLF Regs Host address into
- * page, offset and build the 16-bit command acordingly to the access type.
- * then read the 16-bit word data and store it in pdata
- *  \param[in]
- *                .addr     the 16-bit HBI address
+/******************************************************************************
+ * TwolfHbiBurst()
+ * This function decodes the 16-bit T-WOLF Regs Host address into page and
+ * offset, and moves the number of specified words with a single HBI command.
+ * The command and all the words go out in one SPI transfer. The words must
+ * not cross the end of the page.
  *
- *  return ::status
- */
-static int spis_tw_hbi_rd16(uint16 *pdata)
-{
-    /*perform the HBI access*/
-    if (VprocHALRead(pdata) != 0) {
-        return VPROC_STATUS_ERR_HBI;
-    }
-    return 0;
-}
-
-/* spis_tw_hbi_wr16_cmd()- this function is used for single word access
- * It decodes the 16-bit T-WOLF Regs Host address into
- * page, offset and build the 16-bit command acordingly to the access type.
- * then write the command to the device
- *  \param[in]
- *                .addr      the 16-bit HBI address
+ * \param[in] addr the 16-bit HBI address
+ * \param[in] numWords Number of words (1 - TWOLF_HBI_BURST_MAX_WORDS)
+ * \param[in,out] pData Pointer to the words to write or the words read
+ * \param[in] write 1 to write, 0 to read
+ * \param[in,out] pPage the page selected last, a run of accesses on the same
+ *                page selects it once. Start a run with -1
  *
- *  return ::status
- */
-static int spis_tw_hbi_wr16_cmd(uint16 addr, uint8 numwords)
+ * \retval ::VP_STATUS_SUCCESS
+ * \retval ::VP_STATUS_ERR_HBI
+ ******************************************************************************/
+static VprocStatusType
+TwolfHbiBurst(
+    uint16 addr,
+    uint8 numWords,
+    uint16 *pData,
+    int write,
+    int *pPage)
 {
+    unsigned char buf[2 + TWOLF_HBI_BURST_MAX_WORDS * 2];
     uint16 cmd;
-    int status = 0;
-    uint8 page;
-    uint8 offset;
-
-    page = addr >> 8;
-    offset = (addr & 0xFF) / 2;
+    uint8 page = addr >> 8;
+    uint8 offset = (addr & 0xFF) / 2;
+    uint8 i;
 
+    if ((numWords == 0) || (numWords > TWOLF_HBI_BURST_MAX_WORDS) ||
+        (offset + numWords > TWOLF_HBI_PAGE_WORDS)) {
+        return VPROC_STATUS_INVALID_ARG;
+    }
     if (page == 0) { /*Direct page access*/
-        cmd = HBI_DIRECT_WRITE(offset, numwords - 1); /*build the cmd*/
+        cmd = write ? HBI_DIRECT_WRITE(offset, numWords - 1) : HBI_DIRECT_READ(offset, numWords - 1);
     } else {
         /*indirect page access*/
         if (page != 0xFF) {
             page  -=  1;
         }
-        cmd = HBI_SELECT_PAGE(page);
-        /*select the page*/
-        if (VprocHALWrite(cmd) != 0) {
-            return status;
+        if (*pPage != page) {
+            if (VprocHALWrite(HBI_SELECT_PAGE(page)) != 0) {
+                *pPage = -1;
+                return VPROC_STATUS_ERR_HBI;
+            }
+            *pPage = page;
         }
-        cmd = HBI_PAGED_WRITE(offset, numwords - 1); /*build the cmd*/
-    }
-    /*perform the HBI access*/
-    if (VprocHALWrite(cmd) != 0) { /*write the register address*/
-        return status;
+        cmd = write ? HBI_PAGED_WRITE(offset, numWords - 1) : HBI_PAGED_READ(offset, numWords - 1);
     }
-    return 0;
-}
 
+    if (!write) {
+        if (VprocHALReadBuf(cmd, pData, numWords) != 0) {
+            return VPROC_STATUS_ERR_HBI;
+        }
+        return VPROC_STATUS_SUCCESS;
+    }
+    buf[0] = (unsigned char)(cmd >> 8);
+    buf[1] = (unsigned char)(cmd & 0xFF);
+    for (i = 0; i < numWords; i++) {
+        buf[2 + i * 2] = (unsigned char)(pData[i] >> 8);
+        buf[3 + i * 2] = (unsigned char)(pData[i] & 0xFF);
+    }
+    if (VprocHALWriteBuf(buf, 2 + numWords * 2) != 0) {
+        return VPROC_STATUS_ERR_HBI;
+    }
+    return VPROC_STATUS_SUCCESS;
+} /* TwolfHbiBurst() */
 
-/* spis_tw_hbi_rd16()- Decode the 16-bit T-WOLF Regs Host address into
- * page, offset and build the 16-bit command acordingly to the access type.
- * then read the 16-bit word data and store it in pdata
- *  \param[in]
- *                .addr     the 16-bit HBI address
- *
- *  return ::status
+/* TwolfHbiRun() - the words of a run of consecutive registers, split into
+ * bursts at the page ends
  */
-static int spis_tw_hbi_rd16_cmd(uint16 addr, uint8 numwords)
+static VprocStatusType TwolfHbiRun(uint16 addr, unsigned char numwords, uint16 *pData, int write, int *pPage)
 {
-    uint16 cmd;
-    int status = 0;
-    uint8 page;
-    uint8 offset;
-
-    page = addr >> 8;
-    offset = (addr & 0xFF) / 2;
+    VprocStatusType status = VPROC_STATUS_SUCCESS;
 
-    if (page == 0) {
-        /*Direct page access*/
-        cmd = HBI_DIRECT_READ(offset, numwords - 1); /*build the cmd*/
-    } else {
-        /*Indirect page access*/
-        if (page != 0xFF) {
-            page  -=  1;
+    while (numwords > 0) {
+        unsigned char n = TWOLF_HBI_PAGE_WORDS - (addr & 0xFF) / 2;
+        if (n > TWOLF_HBI_BURST_MAX_WORDS) {
+            n = TWOLF_HBI_BURST_MAX_WORDS;
+        }
+        if (n > numwords) {
+            n = numwords;
         }
-        cmd = HBI_SELECT_PAGE(page);
-        /*select the page*/
-        if (VprocHALWrite(cmd) != 0) {
+        status = TwolfHbiBurst(addr, n, pData, write, pPage);
+        if (status != VPROC_STATUS_SUCCESS) {
             return status;
         }
-        cmd = HBI_PAGED_READ(offset, numwords - 1); /*build the cmd*/
+        addr += n * 2;
+        pData += n;
+        numwords -= n;
     }
-
-    /*perform the HBI access*/
-    if (VprocHALWrite(cmd) != 0) { /*write the register address*/
-        return status;
-    }
-    return 0;
-}
-
-
-/* spis_tw_hbi_wr16()- this function is used for single word access by the
- * ioctl read. It decodes the 16-bit T-WOLF Regs Host address into
- * page, offset and build the 16-bit command acordingly to the access type.
- * then write the command and data to the device
- *  \param[in]
- *                .addr      the 16-bit HBI address
- *
- *  return ::status
- */
-static int spis_tw_hbi_wr16_data(uint16 data)
-{
-    if (VprocHALWrite(data) != 0) {
-        return VPROC_STATUS_ERR_HBI;
-    }
-    return 0;
+    return status;
 }
 
 /******************************************************************************
- * TwolfPagedWrite()
- * This function selects the specified page, writes the number of specified
- * words, starting at the specified offset from a source buffer.
+ * TwolfHbiPage255BurstWrite()
+ * This function selects page 255 and writes the number of specified words,
+ * already in big-endian wire order, starting at the specified offset. The
+ * command and all the words go out in one SPI transfer instead of one
+ * transfer per word.
  *
- * \param[in] page Page to select
- * \param[in] offset Offset of the requested Page to read from
- * \param[in] numWords Number of words to read starting from the offset
- * \param[in] pSrc Pointer to the date to write
+ * \param[in] offset Byte offset in page 255
+ * \param[in] numWords Number of words to write (1 - TWOLF_IMG_BLOCK_MAX_WORDS)
+ * \param[in] pSrc Pointer to the big-endian words
  *
  * \retval ::VP_STATUS_SUCCESS
  * \retval ::VP_STATUS_ERR_HBI
  ******************************************************************************/
 static VprocStatusType
-TwolfHbiPage255Write(
-    unsigned char page,
+TwolfHbiPage255BurstWrite(
     unsigned char offset,
     unsigned char numWords,
-    unsigned short *pDdata)
+    const unsigned char *pSrc)
 {
-    uint16 cmdWrd = (uint16)(page << 8) | (uint16)offset;
-    if (VprocTwolfHbiWrite(cmdWrd, numWords, pDdata) != VPROC_STATUS_SUCCESS) {
+    unsigned char buf[2 + TWOLF_IMG_BLOCK_MAX_WORDS * 2];
+    uint16 cmd;
+
+    if ((numWords == 0) || (numWords > TWOLF_IMG_BLOCK_MAX_WORDS)) {
+        return VPROC_STATUS_INVALID_ARG;
+    }
+    if (VprocHALWrite(HBI_SELECT_PAGE(0xFF)) != 0) {
+        return VPROC_STATUS_ERR_HBI;
+    }
+    cmd = HBI_PAGED_WRITE(offset / 2, numWords - 1);
+    buf[0] = (unsigned char)(cmd >> 8);
+    buf[1] = (unsigned char)(cmd & 0xFF);
+    memcpy(&buf[2], pSrc, numWords * 2);
+    if (VprocHALWriteBuf(buf, 2 + numWords * 2) != 0) {
         return VPROC_STATUS_ERR_HBI;
     }
     return VPROC_STATUS_SUCCESS;
-} /* TwolfHbiPagedWrite() */
+} /* TwolfHbiPage255BurstWrite() */
 
 /*------------------------------------------------------
  * Higher level functions - Can be called by a host application
@@ -387,6 +391,7 @@ VprocStatusType VprocTwolfHbiCleanup(void)
     return VPROC_STATUS_SUCCESS;
 }
 /*VprocTwolfHbiRead - use this function to read up to 254 words from the device
+ *   the words are read with one SPI transfer per page they span
  * \param[in] cmd of the requested device register to read from
  * \param[in] numWords Number of words to read starting from the offset
  * \param[in] pData Pointer to the data read
@@ -399,30 +404,17 @@ VprocStatusType VprocTwolfHbiRead(
     unsigned char numwords,
     unsigned short *pData)
 {
-    VprocStatusType  status = VPROC_STATUS_SUCCESS;
-    unsigned short tempBuf = 0x0BAD;
-    unsigned char i = 0;
+    int page = -1;
 
-    // DEBUG_LOGE(TAG_SPI, "cmd = 0x%04x\n", cmd);
-    status = spis_tw_hbi_rd16_cmd(cmd, numwords);
-    if (status != VPROC_STATUS_SUCCESS) {
+    if (TwolfHbiRun(cmd, numwords, pData, 0, &page) != VPROC_STATUS_SUCCESS) {
         DEBUG_LOGE(TAG_SPI, "ERROR: VPROC_STATUS_RD_FAILED,CMD:0x%04x\n", cmd);
-        return VPROC_STATUS_WR_FAILED;
+        return VPROC_STATUS_RD_FAILED;
     }
-
-    for (i = 0; i < numwords; i++) {
-        status = spis_tw_hbi_rd16(&tempBuf);
-        pData[i] = tempBuf;
-        // DEBUG_LOGE(TAG_SPI, "pData[%d] = 0x%04x\n", i, pData[i]);
-        if (status != VPROC_STATUS_SUCCESS) {
-            DEBUG_LOGE(TAG_SPI, "ERROR: VPROC_STATUS_RD_FAILED,CMD:0x%04x\n", cmd);
-            return VPROC_STATUS_RD_FAILED;
-        }
-    }
-    return status;
+    return VPROC_STATUS_SUCCESS;
 }
 
-/*VprocTwolfHbiWrite - use this function to write up to 252 words to the device
+/*VprocTwolfHbiWrite - use this function to write up to 126 words to the device
+ *   the command and the words go out in one SPI transfer per page they span
  * \param[in] cmd of the requested device register to write to
  * \param[in] numWords Number of words to write starting from the offset
  * \param[in] pData Pointer to the data to write
@@ -435,133 +427,135 @@ VprocStatusType VprocTwolfHbiWrite(
     unsigned char numwords,
     unsigned short *pData)
 {
-    VprocStatusType status = VPROC_STATUS_SUCCESS;
-    unsigned char i = 0;
+    int page = -1;
 
     if ((numwords == 0) || (numwords > 126)) {
         DEBUG_LOGE(TAG_SPI, "number of words is out of range. Maximum is 126\n");
         return VPROC_STATUS_INVALID_ARG;
     }
-    /*16-bit SPI access mode - Send only 1 word within the same CS*/
-    status = spis_tw_hbi_wr16_cmd(cmd, numwords);
-    if (status != VPROC_STATUS_SUCCESS) {
+    if (TwolfHbiRun(cmd, numwords, pData, 1, &page) != VPROC_STATUS_SUCCESS) {
         DEBUG_LOGE(TAG_SPI, "ERROR: VPROC_STATUS_WR_FAILED\n");
         return VPROC_STATUS_WR_FAILED;
     }
-    for (i = 0; i < numwords; i++) {
-        status = spis_tw_hbi_wr16_data(pData[i]);
-        if (status != VPROC_STATUS_SUCCESS) {
-            DEBUG_LOGE(TAG_SPI, "ERROR: VPROC_STATUS_WR_FAILED\n");
-            return VPROC_STATUS_WR_FAILED;
-        }
-    }
     return VPROC_STATUS_SUCCESS;
 }
 
 
 /*VprocTwolfLoadConfig() - use this function to load a custom or new config
  * record into the device RAM to override the default config
+ *   runs of consecutive registers go out as one burst, and a page is only
+ *   selected again when the run moves to another page
  * \retval ::VPROC_STATUS_SUCCESS
  * \retval ::VPROC_STATUS_ERR_HBI
  */
 VprocStatusType VprocTwolfLoadConfig(dataArr *pCr2Buf, unsigned short numElements)
 {
     VprocStatusType status = VPROC_STATUS_SUCCESS;
-    unsigned short i, buf;
+    unsigned short i = 0, n;
+    unsigned short buf[TWOLF_HBI_BURST_MAX_WORDS];
+    int page = -1;
     /*stop the current firmware but do not reset the device and do not go to boot mode*/
 
     /*send the config to the device RAM*/
-    for (i = 0; i < numElements; i++) {
-        buf = pCr2Buf[i].value;
-        status = VprocTwolfHbiWrite(pCr2Buf[i].reg, 1, &buf);
+    while (i < numElements) {
+        buf[0] = pCr2Buf[i].value;
+        n = 1;
+        while ((i + n < numElements) && (n < TWOLF_HBI_BURST_MAX_WORDS) &&
+               (pCr2Buf[i + n].reg == pCr2Buf[i].reg + n * 2) &&
+               (((pCr2Buf[i].reg & 0xFF) / 2 + n) < TWOLF_HBI_PAGE_WORDS)) {
+            buf[n] = pCr2Buf[i + n].value;
+            n++;
+        }
+        status = TwolfHbiBurst(pCr2Buf[i].reg, n, buf, 1, &page);
         if (status != VPROC_STATUS_SUCCESS) {
             return VPROC_STATUS_ERR_HBI;
         }
-
+        i += n;
     }
 
     return status;
 }
 
-/* HbiSrecBoot_alt() Use this alternate method to load the st_twFirmware.c
- *(converted *.s3 to c code) to the device
+/* HbiImageBoot() - stream the blocks of a binary image made by the
+ * zl38063_fw2img tool to the device: a page 255 base address write and a
+ * single burst write per block, nothing to parse or convert on the host
  */
-static VprocStatusType HbiSrecBoot_alt(twFirmware *st_firmware)
+static VprocStatusType HbiImageBoot(const unsigned char *image, unsigned long len)
 {
-    uint16 index = 0;
+    unsigned long pos = TWOLF_IMG_HDR_LEN;
     uint16 gTargetAddr[2] = {0, 0};
+    uint16 numBlocks = 0;
+    uint32 prgmBase, execAddr, address;
+    uint16 numWords;
     VprocStatusType status = VPROC_STATUS_SUCCESS;
-    while (index < st_firmware->twFirmwareStreamLen) {
-
-        /* put the address into our global target addr */
-        gTargetAddr[0] = (uint16)((st_firmware->st_Fwr[index].targetAddr &
-                                   0xFFFF0000) >> 16);
-        gTargetAddr[1] = (uint16)(st_firmware->st_Fwr[index].targetAddr &
-                                  0x0000FFFF);
-
-        //DEBUG_LOGE(TAG_SPI, "gTargetAddr[0] = 0x%04x, gTargetAddr[1] = 0x%04x: \n",
-        //                                   gTargetAddr[0], gTargetAddr[1]);
-
-        //DEBUG_LOGE(TAG_SPI, "numWords = %d: \n",
-        //                             st_firmware->st_Fwr[index].numWords);
-
-        /* write the data to the device */
-        if (st_firmware->st_Fwr[index].numWords != 0) {
-            if (st_firmware->st_Fwr[index].useTargetAddr) {
-                status = VprocTwolfHbiWrite(PAGE_255_BASE_HI_REG, 2, gTargetAddr);
-                if (status != VPROC_STATUS_SUCCESS) {
-                    DEBUG_LOGE(TAG_SPI, "Unable to set gTargetAddr[0] = 0x%04x,"
-                               " gTargetAddr[1] = 0x%04x: \n", gTargetAddr[0], gTargetAddr[1]);
-                    return VPROC_STATUS_ERR_HBI;
-                }
-            }
-            status = TwolfHbiPage255Write(0xFF, (uint8)((gTargetAddr[1] & 0x00FF)),
-                                          st_firmware->st_Fwr[index].numWords, st_firmware->st_Fwr[index].buf);
-            if (status != VPROC_STATUS_SUCCESS) {
-                DEBUG_LOGE(TAG_SPI, "status = %d, numWords = %d: \n",
-                           status, st_firmware->st_Fwr[index].numWords);
-                return status;
-            }
 
+    if ((image == NULL) || (len < TWOLF_IMG_HDR_LEN) || (memcmp(image, "ZLFW", 4) != 0)) {
+        DEBUG_LOGE(TAG_SPI, "not a zl38063_fw2img image\n");
+        return VPROC_STATUS_ERR_IMAGE;
+    }
+    execAddr = TWOLF_IMG_RD32(&image[4]);
+    prgmBase = TWOLF_IMG_RD32(&image[8]);
+
+    while (pos < len) {
+        if (pos + TWOLF_IMG_BLOCK_HDR_LEN > len) {
+            break;
         }
-        // DEBUG_LOGE(TAG_SPI, "index %d\n", index);
-        if (index == 9) {
-            // break;
+        address = TWOLF_IMG_RD32(&image[pos]);
+        numWords = TWOLF_IMG_RD16(&image[pos + 4]);
+        pos += TWOLF_IMG_BLOCK_HDR_LEN;
+        /*a block stays in its 256 byte page 255 window*/
+        if ((numWords == 0) || (numWords > TWOLF_IMG_BLOCK_MAX_WORDS) ||
+                (pos + numWords * 2 > len) || ((address & 0xFF) + numWords * 2 > 0x100)) {
+            break;
         }
-        index++;
-    }
 
-    /*
-     * convert the number of bytes to two 16 bit
-     * values and write them to the requested page register
-     */
-    /* even number of bytes required */
+        gTargetAddr[0] = (uint16)((address & 0xFFFF0000) >> 16);
+        gTargetAddr[1] = (uint16)(address & 0x0000FFFF);
+        status = VprocTwolfHbiWrite(PAGE_255_BASE_HI_REG, 2, gTargetAddr);
+        if (status != VPROC_STATUS_SUCCESS) {
+            DEBUG_LOGE(TAG_SPI, "Unable to set gTargetAddr[0] = 0x%04x,"
+                       " gTargetAddr[1] = 0x%04x: \n", gTargetAddr[0], gTargetAddr[1]);
+            return VPROC_STATUS_ERR_HBI;
+        }
+        status = TwolfHbiPage255BurstWrite((uint8)(address & 0xFF), (uint8)numWords, &image[pos]);
+        if (status != VPROC_STATUS_SUCCESS) {
+            DEBUG_LOGE(TAG_SPI, "status = %d, numWords = %d: \n", status, numWords);
+            return status;
+        }
+        pos += numWords * 2;
+        numBlocks++;
+    }
+    if (pos != len) {
+        DEBUG_LOGE(TAG_SPI, "bad block %d at image offset %lu\n", numBlocks, pos);
+        return VPROC_STATUS_ERR_IMAGE;
+    }
 
     /* program the program's execution start register */
-    gTargetAddr[0] = (uint16)((st_firmware->execAddr & 0xFFFF0000) >> 16);
-    gTargetAddr[1] = (uint16)(st_firmware->execAddr & 0x0000FFFF);
+    gTargetAddr[0] = (uint16)((execAddr & 0xFFFF0000) >> 16);
+    gTargetAddr[1] = (uint16)(execAddr & 0x0000FFFF);
     status = VprocTwolfHbiWrite(0x12C, 2, gTargetAddr);
     if (status != VPROC_STATUS_SUCCESS) {
         DEBUG_LOGE(TAG_SPI, " unable to program page 1 execution address\n");
         return status;
     }
 
-    /* print out the srecord program info */
-    DEBUG_LOGI(TAG_SPI, "prgmBase 0x%08x\n", st_firmware->prgmBase);
-    DEBUG_LOGI(TAG_SPI, "execAddr 0x%08x\n", st_firmware->execAddr);
-    DEBUG_LOGI(TAG_SPI, "DONE\n");
+    /* print out the image info */
+    DEBUG_LOGI(TAG_SPI, "prgmBase 0x%08x\n", prgmBase);
+    DEBUG_LOGI(TAG_SPI, "execAddr 0x%08x\n", execAddr);
+    DEBUG_LOGI(TAG_SPI, "DONE, %d blocks\n", numBlocks);
     return VPROC_STATUS_SUCCESS;
 }
 
 /*VprocTwolfHbiBoot_alt - use this function to bootload the firmware
  * into the device
- * \param[in] pointer to image data structure
+ * \param[in] image binary image made by the zl38063_fw2img tool
+ * \param[in] len size of the image in bytes
  *
  * \retval ::VPROC_STATUS_SUCCESS
  * \retval ::VPROC_STATUS_ERR_HBI
  * \retval ::VPROC_STATUS_MAILBOX_BUSY
 */
-VprocStatusType VprocTwolfHbiBoot_alt(twFirmware *st_firmware)
+VprocStatusType VprocTwolfHbiBoot_alt(const unsigned char *image, unsigned long len)
 {
     VprocStatusType status = VPROC_STATUS_SUCCESS;
     unsigned short buf[2] = {0, 0};
@@ -588,7 +582,7 @@ VprocStatusType VprocTwolfHbiBoot_alt(twFirmware *st_firmware)
         return VPROC_STATUS_ERR_HBI;
     }
     /*Transfer the image*/
-    status =  HbiSrecBoot_alt(st_firmware);
+    status =  HbiImageBoot(image, len);
     if (status != VPROC_STATUS_SUCCESS) {
         DEBUG_LOGE(TAG_SPI, "ERROR %d: \n", status);
         return status;
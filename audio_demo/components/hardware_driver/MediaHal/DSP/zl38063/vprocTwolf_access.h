@@ -59,11 +59,12 @@ VprocStatusType TwolfHbiNoOp( /*send no-op command to the device*/
     unsigned char numWords);  /* The number of no-op (0-255) to write*/
 
 /*An alternative method to loading the firmware into the device
-* USe this method if you have used the provided tool to convert the *.s3 into
-* c code that can be compiled with the application
+* USe this method if you have used the zl38063_fw2img tool to convert the *.s3
+* into a binary block image that can be compiled with the application
 */
-VprocStatusType VprocTwolfHbiBoot_alt( /*use this function to boot load the firmware (*.c) from the host to the device RAM*/
-    twFirmware* st_firmware); /*Pointer to the firmware image in host RAM*/
+VprocStatusType VprocTwolfHbiBoot_alt( /*use this function to boot load the firmware image from the host to the device RAM*/
+    const unsigned char* image,  /*Pointer to the firmware image in host memory*/
+    unsigned long len);          /*Size of the image in bytes*/
 
 
 VprocStatusType VprocTwolfLoadConfig(dataArr* pCr2Buf, unsigned short numElements);
@@ -9,6 +9,9 @@
 
 static spi_device_handle_t g_spi = NULL;
 
+#define VPROC_SPI_DMA_CHAN  HSPI_HOST   /*the host number is a valid channel on both the esp32 and the esp32s2*/
+#define VPROC_HAL_BUF_MAX   256
+
 int VprocHALInit(void)
 {
     /*if the customer platform requires any init
@@ -35,7 +38,8 @@ int VprocHALInit(void)
     if (g_spi) {
         return ret;
     }
-    ret = spi_bus_initialize(HSPI_HOST, &buscfg, 0);
+    // DMA for the firmware burst writes, without it a transfer holds 64 bytes at most
+    ret = spi_bus_initialize(HSPI_HOST, &buscfg, VPROC_SPI_DMA_CHAN);
     assert(ret == ESP_OK);
     ret = spi_bus_add_device(HSPI_HOST, &devcfg, &g_spi);
     assert(ret == ESP_OK);
@@ -119,6 +123,34 @@ int VprocHALWrite(unsigned short val)
     return 0;
 }
 
+/* This is the platform dependant low level spi
+ * function to write a run of 16-bit words, already big-endian, within one CS
+ */
+int VprocHALWriteBuf(const unsigned char* buf, int len)
+{
+    esp_err_t ret;
+    spi_transaction_t t;
+#if !BIGENDIAN
+    static unsigned char swapped[VPROC_HAL_BUF_MAX];
+    int i;
+    if (len > VPROC_HAL_BUF_MAX) {
+        return -1;
+    }
+    for (i = 0; i + 1 < len; i += 2) {
+        swapped[i] = buf[i + 1];
+        swapped[i + 1] = buf[i];
+    }
+    buf = swapped;
+#endif
+    memset(&t, 0, sizeof(t));
+    t.length = len * 8;
+    t.tx_buffer = buf;
+    ret = spi_device_transmit(g_spi, &t);
+    assert(ret == ESP_OK);
+
+    return 0;
+}
+
 /* This is the platform dependant low level spi
  * function to read 16-bit data from the ZL380xx device
  */
@@ -145,3 +177,44 @@ int VprocHALRead(unsigned short* pVal)
     return 0;
 }
 
+
+/* This is the platform dependant low level spi
+ * function to send an HBI read command and read the numWords that follow
+ * within the same CS
+ */
+int VprocHALReadBuf(unsigned short cmd, unsigned short* pVal, int numWords)
+{
+    esp_err_t ret;
+    spi_transaction_t t;
+    static unsigned char tx[VPROC_HAL_BUF_MAX];
+    static unsigned char rx[VPROC_HAL_BUF_MAX];
+    unsigned short data;
+    int i, len = 2 + numWords * 2;
+
+    if (numWords <= 0 || len > VPROC_HAL_BUF_MAX) {
+        return -1;
+    }
+#if BIGENDIAN
+    data = htons(cmd);
+#else
+    data = cmd;
+#endif
+    memset(tx, 0, len);
+    memcpy(tx, &data, 2);
+    memset(&t, 0, sizeof(t));
+    t.length = len * 8;
+    t.tx_buffer = tx;
+    t.rx_buffer = rx;
+    ret = spi_device_transmit(g_spi, &t);
+    assert(ret == ESP_OK);
+
+    for (i = 0; i < numWords; i++) {
+        memcpy(&data, &rx[2 + i * 2], 2);
+#if BIGENDIAN
+        pVal[i] = ntohs(data);
+#else
+        pVal[i] = data;
+#endif
+    }
+    return 0;
+}
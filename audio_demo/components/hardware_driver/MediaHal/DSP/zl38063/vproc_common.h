@@ -88,5 +88,7 @@ extern int VprocHALInit(void);
 extern void Vproc_msDelay(unsigned short time);
 extern void VprocWait(unsigned long int time);
 extern int VprocHALWrite(unsigned short val);
+extern int VprocHALWriteBuf(const unsigned char* buf, int len);
 extern int VprocHALRead(unsigned short* pVal);
+extern int VprocHALReadBuf(unsigned short cmd, unsigned short* pVal, int numWords);
 #endif /* VPROC_COMMON_H */
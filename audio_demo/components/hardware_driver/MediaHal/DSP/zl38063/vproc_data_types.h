@@ -78,23 +78,6 @@ typedef   Int32T*  int32p;
 #define VP_INT32_MAX    (LONG_MAX)
 #define VP_INT32_MIN    (LONG_MIN)
 
-/*firmware data structures*/
-typedef struct {
-    uint16 buf[16];      /*the firmware data block to send to the device*/
-    uint16  numWords;    /*the number of words within the block of data stored in buf[]*/
-    uint32 targetAddr;   /*the target base address to write to register 0x00c of the device*/
-    uint8 useTargetAddr; /*this value is either 0 or 1. When 1 the tarGetAddr must be written to the device*/
-} twFwr;
-
-typedef struct {
-    twFwr* st_Fwr;
-    uint32 byteCount;   /*The total number of bytes within the firmware - NOT USED*/
-    uint8 havePrgmBase;
-    uint32 prgmBase;
-    uint32 execAddr;   /*The execution start address of the firmware in RAM*/
-    uint16 twFirmwareStreamLen;  /*The number of blocks within the firmware*/
-} twFirmware;
-
 /*config record structures*/
 typedef struct {
     uint16 reg;   /*the register */
@@ -1,2463 +1,5138 @@
-/*Source file Microsemi_ZLS38063_1_P1_1_0_firmware.s3, modified: Fri Dec 15 15:24:33 2017
- */ 
-#include "vproc_data_types.h"
+/*Generated by zl38063_fw2img.py from the tw_convert table of Microsemi_ZLS38063_1_P1_1_0_firmware.s3, 613 blocks, do not edit*/
+#include "zl38063_firmware.h"
 
-const twFwr st_twFirmware[] ={
-	{{0x0000, 0x1c0f, 0x0010, 0x1000, 0x0001, 0x0000, 0x0000, 0x0000, 0x000d, 0x0000, 0x000e, 0x000e, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x00080200, 1},
-	{{0x0000, 0x0000, 0x0001, 0x0005, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x00080220, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x00080240, 1},
-	{{0x8004, 0x81f2, 0xc0c0, 0x0000, 0x0100, 0x0101, 0x0104, 0x0106, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4040, 0x0000 }, 16, 0x00080260, 1},
-	{{0x0000, 0x0002, 0x0004, 0x0006, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0010 }, 16, 0x00080280, 1},
-	{{0x8000, 0x8000, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x000f, 0x0003, 0x000c, 0x0000, 0x815e, 0xfff0, 0x01e0, 0xffa0 }, 16, 0x000802a0, 1},
-	{{0x03ec, 0xfff6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3fff, 0x0000, 0x0000 }, 16, 0x000802c0, 1},
-	{{0x0ff7, 0xffff, 0x0000, 0x0000, 0x0000, 0xffff, 0x0000, 0x0000, 0xffff, 0x0000, 0x0000, 0xffff, 0x0000, 0x0000, 0xffff, 0x0000 }, 16, 0x000802e0, 1},
-	{{0x3808, 0x1000, 0x1400, 0x7fff, 0xffff, 0x0040, 0x0818, 0xa001, 0x0078, 0x0000, 0x0000, 0x7fff, 0x0000, 0x0000, 0x7fff, 0x7fff }, 16, 0x00080300, 1},
-	{{0x7fff, 0x7fff, 0xc476, 0x001f, 0x3040, 0x010c, 0x0006, 0x0a3f, 0x04a1, 0x003f, 0x0020, 0x0000, 0x4801, 0x0096, 0x000a, 0x0004 }, 16, 0x00080320, 1},
-	{{0x0000, 0x0c00, 0x0000, 0x0005, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0123, 0x4567, 0x0806, 0x0228, 0x81f4, 0x0000 }, 16, 0x00080340, 1},
-	{{0x0013, 0x0cf1, 0x0a00, 0x4000, 0x0026, 0x1a00, 0x0800, 0x0400, 0x0fa0, 0x0640, 0x0b0b, 0x8400, 0x0a05, 0x0010, 0x01aa, 0x2000 }, 16, 0x00080360, 1},
-	{{0x0400, 0x0200, 0x7801, 0x0280, 0x0023, 0x003c, 0x2801, 0x08a1, 0x0000, 0xa000, 0x7fdf, 0x0020, 0x3628, 0x0000, 0x0000, 0x0000 }, 16, 0x00080380, 1},
-	{{0x0000, 0x0080, 0x0002, 0x0064, 0x01f4, 0x3333, 0x7fbe, 0x3333, 0x7eb8, 0xafff, 0x0001, 0x7fdf, 0x00c2, 0x7333, 0x6000, 0x0031 }, 16, 0x000803a0, 1},
-	{{0x0000, 0x6666, 0x0064, 0x0000, 0x16c3, 0x0100, 0x0002, 0x7f02, 0x7f02, 0x2d6a, 0x0002, 0x7000, 0x0ccc, 0x0000, 0x0000, 0x8240 }, 16, 0x000803c0, 1},
-	{{0x1818, 0x502d, 0x2020, 0x0002, 0x01f0, 0x0078, 0x0050, 0x0004, 0x01f0, 0x0078, 0x0050, 0x087a, 0x0100, 0x0190, 0x0004, 0x1717 }, 16, 0x000803e0, 1},
-	{{0x0400, 0x0320, 0x0033, 0x0000, 0x0b27, 0x1358, 0x0c52, 0x1560, 0x0da2, 0x17a2, 0x0f0e, 0x1a21, 0x123d, 0x170a, 0x0000, 0x0000 }, 16, 0x00080400, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0190, 0x0190, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7fff, 0x0001, 0x000a }, 16, 0x00080420, 1},
-	{{0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x00080440, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x00080460, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0003, 0x6666, 0x4000, 0x000c, 0xfffd, 0x0200, 0x16c3, 0x7333, 0x0006, 0x0000, 0x0000, 0x0000 }, 16, 0x00080480, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x000804a0, 1},
-	{{0x0002, 0x003c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x000804c0, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x001e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x000804e0, 1},
-	{{0x0000, 0x0000, 0x0006, 0x012c, 0x0100, 0xfffd, 0x0006, 0x04e2, 0x0100, 0xfffa, 0x0008, 0x1194, 0x0100, 0x0006, 0x0009, 0x03e8 }, 16, 0x00080500, 1},
-	{{0x0200, 0xfffa, 0x0009, 0x03e8, 0x0200, 0x0000, 0x0009, 0x03e8, 0x0200, 0x0000, 0x0009, 0x03e8, 0x0200, 0x0000, 0x0009, 0x03e8 }, 16, 0x00080520, 1},
-	{{0x0200, 0x0000, 0x0001, 0x0000, 0x0002, 0x0064, 0x00c0, 0x0000, 0x0002, 0x0050, 0x00c0, 0x0000, 0x0006, 0x0096, 0x0100, 0x0006 }, 16, 0x00080540, 1},
-	{{0x0006, 0x03e8, 0x0100, 0xfffa, 0x0006, 0x0708, 0x0100, 0x0003, 0x0006, 0x0bb8, 0x0180, 0xfffd, 0x0006, 0x1388, 0x0100, 0x0003 }, 16, 0x00080560, 1},
-	{{0x0009, 0x03e8, 0x0200, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x00080580, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x000805a0, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x000805c0, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x000805e0, 1},
-	{{0x3e80, 0x0000, 0x0000, 0x0000, 0xfe80, 0x0080, 0x0002, 0x0200, 0xd300, 0x0080, 0x0066, 0x0133, 0x0000, 0x0500, 0x0002, 0x0200 }, 16, 0x00080600, 1},
-	{{0x3e80, 0x0004, 0x0000, 0x0000, 0xf700, 0x0100, 0x0002, 0x0200, 0xd300, 0x0080, 0x0066, 0x0133, 0x0000, 0x0600, 0x0002, 0x0200 }, 16, 0x00080620, 1},
-	{{0x3e80, 0x0002, 0x0600, 0x0000, 0xf700, 0x0100, 0x0002, 0x0200, 0xd300, 0x0080, 0x0066, 0x0133, 0xfe00, 0x0500, 0x0001, 0x0200 }, 16, 0x00080640, 1},
-	{{0x0000, 0xee80, 0x0000, 0x0000, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0xee80, 0x0000, 0x0000, 0xfe00, 0xffff, 0x0000, 0x0000 }, 16, 0x00080660, 1},
-	{{0x0000, 0xee80, 0x0000, 0x0000, 0x8000, 0x8000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x00080680, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x000806a0, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x000806c0, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x000806e0, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x00080700, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x00080720, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x00080740, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x00080760, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x00080780, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x000807a0, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x000807c0, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x000807e0, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x00080800, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x00080820, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x00080840, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x00080860, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x00080880, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x000808a0, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x000808c0, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x000808e0, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x00080900, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x00080920, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x00080940, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x00080960, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x00080980, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x000809a0, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x000809c0, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x000809e0, 1},
-	{{0x3144, 0x20cc, 0x8008, 0x3503, 0x200c, 0x80e4, 0x0846, 0x2c78, 0x8009, 0x3103, 0x3000, 0x8000, 0x90c0, 0xe7e8, 0x90c0, 0x90c0 }, 16, 0x00084000, 1},
-	{{0x944e, 0x3928, 0x2000, 0xbfff, 0x3000, 0x2000, 0x8000, 0x92c8, 0x4099, 0x9f7c, 0x3364, 0x20cc, 0x8008, 0x3144, 0x20c8, 0x8008 }, 16, 0x00084020, 1},
-	{{0x3503, 0x200c, 0x80e4, 0x90c0, 0x90c0, 0x94c0, 0xc080, 0xc180, 0x9cc0, 0x7550, 0x7650, 0x75d1, 0x76d1, 0xc980, 0xca80, 0x3e00 }, 16, 0x00084040, 1},
-	{{0xa00a, 0x7750, 0x7450, 0x77d1, 0x74d1, 0xcb80, 0xcc80, 0x3e00, 0xa00f, 0x7550, 0x7650, 0x75d1, 0x76d1, 0xede9, 0xeee9, 0x3a00 }, 16, 0x00084060, 1},
-	{{0xa10c, 0x7750, 0x77d1, 0xefe9, 0xe8e9, 0x3680, 0xa100, 0xe9e9, 0xeae9, 0x3680, 0xa100, 0xebe9, 0xece9, 0x3680, 0xa100, 0xede9 }, 16, 0x00084080, 1},
-	{{0xeee9, 0x3680, 0xa000, 0xefe9, 0xe0e9, 0x94c0, 0xe1e9, 0xe2e9, 0x94c0, 0xe3e9, 0xc760, 0x94c0, 0xcc50, 0xcd50, 0x94c0, 0xce50 }, 16, 0x000840a0, 1},
-	{{0xcf50, 0x3144, 0x2000, 0x8008, 0x9f79, 0x9f71, 0x0146, 0x2bcc, 0x8009, 0x3a40, 0x2bc8, 0x8009, 0x24ea, 0x3d40, 0x2bc4, 0x8009 }, 16, 0x000840c0, 1},
-	{{0x8447, 0x96c0, 0x9b41, 0x2b03, 0x8008, 0x2c30, 0x1492, 0x5395, 0x266a, 0x34f8, 0x3fff, 0xbfff, 0x8427, 0x6cd3, 0x7261, 0x96c1 }, 16, 0x000840e0, 1},
-	{{0x6d30, 0x31e0, 0x9fff, 0x94c3, 0xcc40, 0xc843, 0x7841, 0x92c3, 0xec18, 0x92c3, 0x929c, 0x5292, 0x7170, 0x81e1, 0x90c0, 0x92d0 }, 16, 0x00084100, 1},
-	{{0xed48, 0xea48, 0x90c0, 0x3960, 0x3ff8, 0x8004, 0xc281, 0x1391, 0xd912, 0x71e2, 0x2718, 0x8034, 0x3800, 0x24ec, 0x8004, 0xc19c }, 16, 0x00084120, 1},
-	{{0x5a98, 0x5998, 0x5b98, 0x5c98, 0x9f4b, 0x90c0, 0x2103, 0x800a, 0x92d0, 0x9de1, 0x9d82, 0x9f4c, 0x6c10, 0x2103, 0x8008, 0x92c8 }, 16, 0x00084140, 1},
-	{{0x9082, 0x78e1, 0x64e9, 0x85db, 0x3840, 0x2064, 0x8009, 0x6c10, 0x5a98, 0x90c0, 0x2a0a, 0x8001, 0xeaf1, 0xea61, 0x3544, 0x2006 }, 16, 0x00084160, 1},
-	{{0x8008, 0x5998, 0x5b98, 0x5c98, 0x9f4b, 0x90c0, 0x2103, 0x800a, 0x92d0, 0x9de1, 0x9d82, 0x9f4c, 0x90c0, 0x21e3, 0x9fd7, 0x92c8 }, 16, 0x00084180, 1},
-	{{0x9082, 0x8fcf, 0x9f71, 0x9f71, 0x9f71, 0x90c0, 0x90c0, 0x9f71, 0x3480, 0xa000, 0x9f63, 0x9f71, 0x2d10, 0xe748, 0x2c90, 0x3880 }, 16, 0x000841a0, 1},
-	{{0x2c00, 0x8009, 0x2000, 0x8200, 0xf041, 0x0282, 0x333c, 0x8009, 0x0281, 0x3a36, 0x8009, 0x0282, 0x3338, 0x8009, 0x0282, 0x3334 }, 16, 0x000841c0, 1},
-	{{0x8009, 0x0282, 0x3330, 0x8009, 0x0282, 0x331c, 0x8009, 0x0282, 0x3318, 0x8009, 0x0282, 0x3314, 0x8009, 0x32e4, 0x3c8a, 0x8001 }, 16, 0x000841e0, 1},
-	{{0x0282, 0x3310, 0x8009, 0x2c10, 0x0486, 0x2c00, 0x8009, 0x2c90, 0xc281, 0x2300, 0x8200, 0x30ec, 0x804f, 0xf341, 0x3880, 0x3000 }, 16, 0x00084200, 1},
-	{{0x8009, 0x0082, 0x3320, 0x8009, 0x0482, 0x2c00, 0x8009, 0x0081, 0x3a35, 0x8009, 0x0082, 0x32fc, 0x8009, 0x0082, 0x32f8, 0x8009 }, 16, 0x00084220, 1},
-	{{0x0082, 0x32f4, 0x8009, 0x0082, 0x32f0, 0x8009, 0x0082, 0x332c, 0x8009, 0x0082, 0x3328, 0x8009, 0x0082, 0x3324, 0x8009, 0x32e4 }, 16, 0x00084240, 1},
-	{{0x3c8a, 0x8001, 0x0281, 0x3a36, 0x8009, 0x2c90, 0x0086, 0x3000, 0x8009, 0x32e8, 0x804f, 0xc181, 0xe768, 0x0082, 0x3000, 0x8009 }, 16, 0x00084260, 1},
-	{{0x9f70, 0x0181, 0x3a35, 0x8009, 0x3324, 0x3f30, 0x8009, 0x2469, 0x3750, 0xc08e, 0x8411, 0x33e4, 0x39ea, 0x8001, 0xc084, 0x0081 }, 16, 0x00084280, 1},
-	{{0x3a36, 0x8009, 0xd321, 0x8413, 0x32e4, 0x39ea, 0x8001, 0xc08f, 0xc084, 0x0081, 0x3a35, 0x8009, 0x3124, 0x3f50, 0x8009, 0x31e4 }, 16, 0x000842a0, 1},
-	{{0x3a5c, 0x8001, 0x31e4, 0x3a62, 0x8001, 0x3124, 0x3f30, 0x8009, 0x83fb, 0x2469, 0x3750, 0x0085, 0x3a36, 0x8009, 0x8443, 0x6469 }, 16, 0x000842c0, 1},
-	{{0x803f, 0xd023, 0x803b, 0x3980, 0x3358, 0x8009, 0x38e8, 0x2c00, 0xbfff, 0x1091, 0x3ae8, 0x2c04, 0xbfff, 0x0090, 0xc0a6, 0x3181 }, 16, 0x000842e0, 1},
-	{{0x2c00, 0x8009, 0x83ba, 0x0192, 0x3940, 0x35b4, 0x8008, 0x32e4, 0x39e4, 0x8001, 0xc08e, 0xc083, 0x0081, 0x3a36, 0x8009, 0xd321 }, 16, 0x00084300, 1},
-	{{0x8461, 0x0085, 0x3a35, 0x8009, 0x6469, 0x8057, 0xd023, 0x8053, 0x3880, 0x3354, 0x8009, 0x3ae8, 0x2800, 0xbfff, 0x1090, 0x39e8 }, 16, 0x00084320, 1},
-	{{0x2804, 0xbfff, 0x4092, 0x3081, 0x3000, 0x8009, 0x0091, 0x3940, 0x3846, 0x8008, 0x0886, 0x3a58, 0x8009, 0x90c0, 0x1090, 0x8078 }, 16, 0x00084340, 1},
-	{{0x0d40, 0xa000, 0x800d, 0x8358, 0xc0a2, 0xc184, 0x8358, 0xc0a2, 0x32e4, 0x39e4, 0x8001, 0xc08f, 0xc083, 0x0081, 0x3a35, 0x8009 }, 16, 0x00084360, 1},
-	{{0x3124, 0x3f50, 0x8009, 0x31e4, 0x39d2, 0x8001, 0x833f, 0x2e10, 0xe8f1, 0xe758, 0xc081, 0xefe8, 0xeee9, 0x2418, 0x82e0, 0xf045 }, 16, 0x00084380, 1},
-	{{0x39e8, 0x3c14, 0xbfff, 0x31f1, 0x3fff, 0xbfff, 0x1291, 0x38c8, 0x3c10, 0xbfff, 0xdc82, 0x0191, 0x39e8, 0x3c04, 0xbfff, 0x3141 }, 16, 0x000843a0, 1},
-	{{0x2e00, 0x9200, 0x0191, 0x30e9, 0x3fff, 0xb000, 0x1190, 0xf799, 0xdc01, 0x0090, 0x39c8, 0x3c00, 0xbfff, 0x5090, 0x0990, 0xa000 }, 16, 0x000843c0, 1},
-	{{0x4090, 0x5090, 0x0c90, 0xa000, 0x8408, 0x92c3, 0x6f10, 0xc681, 0x3a41, 0x2d90, 0xc111, 0x33f4, 0x3200, 0x2000, 0x8042, 0x92c2 }, 16, 0x000843e0, 1},
-	{{0x6e90, 0xd4c2, 0x92c3, 0xc581, 0x1505, 0xa001, 0x840a, 0x24e0, 0xd443, 0xc381, 0xd443, 0xc311, 0x2461, 0x25e0, 0xf044, 0x3170 }, 16, 0x00084400, 1},
-	{{0xf143, 0x8027, 0x7160, 0x840b, 0x70e3, 0x801f, 0x70fb, 0x841b, 0x90c0, 0xc111, 0x24e0, 0xf2c4, 0x3170, 0xf3c3, 0x81f4, 0x65e0 }, 16, 0x00084420, 1},
-	{{0x7160, 0x8407, 0x71f9, 0x81eb, 0x6769, 0x8407, 0x66e9, 0x8195, 0x2769, 0x3700, 0x2000, 0x8200, 0x2518, 0x80f4, 0x38e8, 0x3c38 }, 16, 0x00084440, 1},
-	{{0xbfff, 0x90c0, 0x5090, 0x8320, 0x31ff, 0x9fff, 0x32e4, 0x3c4e, 0x8001, 0x34ff, 0x6760, 0x38c8, 0x3c10, 0xbfff, 0x31a1, 0x33b0 }, 16, 0x00084460, 1},
-	{{0x8000, 0x3079, 0x5190, 0x3309, 0x87ff, 0xd909, 0x8034, 0x92c2, 0xc986, 0x3181, 0x2020, 0x8000, 0x7079, 0x8026, 0x92c2, 0xc985 }, 16, 0x00084480, 1},
-	{{0x3670, 0x8018, 0x801c, 0x92c2, 0xc984, 0x3650, 0x8010, 0x8012, 0x92c2, 0xc983, 0x3630, 0x8008, 0x8008, 0x92c2, 0xc982, 0xc981 }, 16, 0x000844a0, 1},
-	{{0x3840, 0x2cba, 0x8009, 0x0981, 0x3a37, 0x8009, 0xe9fc, 0xe918, 0x18d1, 0xf246, 0x2aff, 0x9eb3, 0xc84f, 0x2760, 0x0185, 0x3a37 }, 16, 0x000844c0, 1},
-	{{0x8009, 0x34e1, 0x3940, 0x2cea, 0x8009, 0x3cc1, 0xf2c6, 0xc841, 0x90c0, 0xe918, 0x59d1, 0xc949, 0x32e4, 0x3c4e, 0x8001, 0x64e0 }, 16, 0x000844e0, 1},
-	{{0x3d44, 0x3a40, 0x2cba, 0x8009, 0x3a01, 0x8007, 0x3600, 0x8007, 0xe81a, 0x17d0, 0xd891, 0x3fdc, 0xd441, 0x0910, 0xa200, 0xdf98 }, 16, 0x00084500, 1},
-	{{0x0085, 0x3a37, 0x8009, 0x3460, 0x39c8, 0x3c18, 0xbfff, 0xdc1a, 0xb03b, 0x0085, 0x3a37, 0x8009, 0x7c44, 0x0080, 0x3a2c, 0x8009 }, 16, 0x00084520, 1},
-	{{0x5091, 0x0c00, 0xa003, 0x8407, 0x0997, 0xa000, 0x2769, 0x3281, 0x2000, 0x8000, 0x2718, 0x8112, 0x357a, 0x1097, 0x8004, 0x3118 }, 16, 0x00084540, 1},
-	{{0x8007, 0x3460, 0x0081, 0x3a37, 0x8009, 0x1197, 0x8004, 0x3399, 0x8000, 0x7161, 0x84e7, 0x2469, 0x38c8, 0x3c10, 0xbfff, 0x80dd }, 16, 0x00084560, 1},
-	{{0x1190, 0x30e9, 0x3fff, 0xb000, 0xdc01, 0x4090, 0x1090, 0x1197, 0x8004, 0x337e, 0x9ff0, 0x7f64, 0xd896, 0xdc98, 0x4190, 0x5090 }, 16, 0x00084580, 1},
-	{{0x0910, 0xa800, 0x2aff, 0x9de3, 0x4090, 0x3b41, 0x1197, 0x8004, 0x3319, 0x8007, 0x3cc1, 0x3840, 0x2cea, 0x8009, 0xc941, 0x90c0 }, 16, 0x000845a0, 1},
-	{{0xe918, 0x51d1, 0x32e4, 0x3c4e, 0x8001, 0x36c1, 0x8001, 0xcd40, 0x3602, 0x8006, 0x3a03, 0x8006, 0x30c8, 0x87c1, 0xed61, 0xcd49 }, 16, 0x000845c0, 1},
-	{{0xcd40, 0x38e8, 0x3c24, 0xbfff, 0x39e8, 0x3c20, 0xbfff, 0xed61, 0x0d90, 0x3ae8, 0x3c14, 0xbfff, 0x09b1, 0xa000, 0x0191, 0xd813 }, 16, 0x000845e0, 1},
-	{{0x1092, 0xd540, 0x0950, 0xa000, 0x0092, 0x3b40, 0x2cba, 0x8009, 0x0085, 0x3a37, 0x8009, 0x3460, 0x3c40, 0x2cca, 0x8009, 0x3119 }, 16, 0x00084600, 1},
-	{{0x8007, 0x3cc1, 0xc940, 0xc841, 0xe9fc, 0xe81b, 0x11d0, 0xe91c, 0x3651, 0x3cdc, 0x59d1, 0x3a43, 0x8004, 0x3642, 0x8004, 0xd993 }, 16, 0x00084620, 1},
-	{{0xd543, 0xe9fc, 0xdf9a, 0x0980, 0x3a2c, 0x8009, 0xdf99, 0x1197, 0x8004, 0x3379, 0x9ff0, 0x880e, 0xdc19, 0x6c10, 0xf045, 0x0081 }, 16, 0x00084640, 1},
-	{{0x3a37, 0x8009, 0xb03b, 0x3800, 0x20e0, 0x8008, 0x39e8, 0x3c04, 0xbfff, 0x1a97, 0x8006, 0x4a10, 0x4791, 0x2e10, 0xeef1, 0x2518 }, 16, 0x00084660, 1},
-	{{0x82bc, 0x39e8, 0x3c14, 0xbfff, 0x31e9, 0x3fff, 0xbfff, 0x1291, 0x38c8, 0x3c10, 0xbfff, 0xdc82, 0x0191, 0x39e8, 0x3c08, 0xbfff }, 16, 0x00084680, 1},
-	{{0x3141, 0x2e00, 0x9000, 0x0191, 0x3079, 0x3000, 0xbfff, 0x1190, 0xf799, 0xdc01, 0x0090, 0x39c8, 0x3c00, 0xbfff, 0x5090, 0x0980 }, 16, 0x000846a0, 1},
-	{{0xa000, 0x4090, 0x5090, 0x0c80, 0xa000, 0x8408, 0x92c3, 0x6f10, 0xc681, 0x3a41, 0x2d90, 0xc111, 0x33f4, 0x3200, 0x2000, 0x8042 }, 16, 0x000846c0, 1},
-	{{0x92c2, 0x6e90, 0xd4c2, 0x92c3, 0xc581, 0x1505, 0xa001, 0x840a, 0x24e0, 0xd443, 0xc381, 0xd443, 0xc311, 0x2461, 0x25e0, 0xf044 }, 16, 0x000846e0, 1},
-	{{0x3170, 0xf143, 0x8027, 0x7160, 0x840b, 0x70e3, 0x801f, 0x70fb, 0x841b, 0x90c0, 0xc111, 0x24e0, 0xf2c4, 0x3170, 0xf3c3, 0x81f4 }, 16, 0x00084700, 1},
-	{{0x65e0, 0x7160, 0x8407, 0x71f9, 0x81eb, 0x6769, 0x8407, 0x66e9, 0x8195, 0x2769, 0x2c10, 0x38e8, 0x3c38, 0xbfff, 0x80d2, 0xf042 }, 16, 0x00084720, 1},
-	{{0x5090, 0x31e8, 0x9fff, 0x2aff, 0x9c41, 0x30cf, 0x8410, 0x32e4, 0x3c4e, 0x8001, 0x34ff, 0x6760, 0x31a1, 0x33b0, 0x8000, 0x3079 }, 16, 0x00084740, 1},
-	{{0x38c8, 0x3c10, 0xbfff, 0x90c0, 0x5190, 0x331f, 0x87ff, 0x8034, 0x92c2, 0xc886, 0x3181, 0x2020, 0x8000, 0x7079, 0x8026, 0x92c2 }, 16, 0x00084760, 1},
-	{{0xc885, 0x3670, 0x8018, 0x801c, 0x92c2, 0xc884, 0x3650, 0x8010, 0x8012, 0x92c2, 0xc883, 0x3630, 0x8008, 0x8008, 0x92c2, 0xc882 }, 16, 0x00084780, 1},
-	{{0xc881, 0x0881, 0x3a3a, 0x8009, 0x2aff, 0x9bdf, 0xefe8, 0x2760, 0x0185, 0x3a3a, 0x8009, 0x34e1, 0x3840, 0x2cea, 0x8009, 0x3cc1 }, 16, 0x000847a0, 1},
-	{{0xcf4a, 0xc941, 0x90c0, 0xe918, 0x58d1, 0xc849, 0x32e4, 0x3c4e, 0x8001, 0x64e0, 0x3fc4, 0x0385, 0x3a3a, 0x8009, 0x35e3, 0x0185 }, 16, 0x000847c0, 1},
-	{{0x3a3a, 0x8009, 0x34e1, 0xdd9f, 0xb333, 0x3a43, 0x8000, 0x3843, 0x8000, 0x3640, 0x8000, 0x3cdc, 0xd913, 0xd540, 0x0085, 0x3a3a }, 16, 0x000847e0, 1},
-	{{0x8009, 0x3c44, 0xdc9a, 0xf142, 0x0080, 0x3a2e, 0x8009, 0x2769, 0x3181, 0x2000, 0x8000, 0x2718, 0x810e, 0x34f9, 0x1096, 0x8004 }, 16, 0x00084800, 1},
-	{{0x3198, 0x8000, 0x30e0, 0x38c8, 0x3c10, 0xbfff, 0x84ed, 0x1190, 0x3079, 0x3000, 0xbfff, 0xdc01, 0x4090, 0x1090, 0x1196, 0x8004 }, 16, 0x00084820, 1},
-	{{0x337e, 0x9ff0, 0x7f64, 0xdc1e, 0x4090, 0x5090, 0x0900, 0xa800, 0x4090, 0x1096, 0x8004, 0x3118, 0x8007, 0x2aff, 0x9b2d, 0x0081 }, 16, 0x00084840, 1},
-	{{0x3a3a, 0x8009, 0x3b41, 0x0185, 0x3a3a, 0x8009, 0x34e1, 0x3840, 0x2cea, 0x8009, 0x7cc1, 0xc941, 0x90c0, 0xe918, 0x51d1, 0x32e4 }, 16, 0x00084860, 1},
-	{{0x3c4e, 0x8001, 0x36c1, 0x8001, 0xc940, 0x3a01, 0x8006, 0x3602, 0x8006, 0x30c8, 0x87c1, 0xcf40, 0x38e8, 0x3c24, 0xbfff, 0xe961 }, 16, 0x00084880, 1},
-	{{0xc948, 0x3ae8, 0x3c20, 0xbfff, 0xef61, 0x0f90, 0x3be8, 0x3c14, 0xbfff, 0x09b0, 0xa000, 0x0092, 0xd891, 0x1093, 0xd541, 0x0990 }, 16, 0x000848a0, 1},
-	{{0xa000, 0x0093, 0x3c40, 0x2cba, 0x8009, 0x0085, 0x3a3a, 0x8009, 0x3460, 0x3d40, 0x2cca, 0x8009, 0x3119, 0x8007, 0x3cc1, 0xc940 }, 16, 0x000848c0, 1},
-	{{0xc841, 0xe9fc, 0xe81c, 0x11d0, 0xe91d, 0x36d1, 0x3cdc, 0x19d1, 0xf4c2, 0x3a43, 0x8005, 0x3642, 0x8005, 0xd993, 0xe9fc, 0xd543 }, 16, 0x000848e0, 1},
-	{{0x0980, 0x3a2e, 0x8009, 0xde1a, 0x1296, 0x8004, 0xde19, 0x3579, 0x9ff0, 0xf442, 0x880e, 0xdc19, 0x6c10, 0xf045, 0x0081, 0x3a3a }, 16, 0x00084900, 1},
-	{{0x8009, 0xb033, 0x3800, 0x20e2, 0x8008, 0x1a96, 0x8006, 0x0a10, 0x39e8, 0x3c08, 0xbfff, 0xf0c2, 0x4091, 0x2704, 0x8e64, 0x90c0 }, 16, 0x00084920, 1},
-	{{0x90c0, 0x90c8, 0x38c8, 0x3c10, 0xbfff, 0xf0c5, 0x3468, 0x1190, 0xe778, 0x3024, 0x3f50, 0x8009, 0x4190, 0x2469, 0xc841, 0xe748 }, 16, 0x00084940, 1},
-	{{0x840c, 0xe8fe, 0x880e, 0x3980, 0x2c00, 0x8009, 0x3980, 0x3000, 0x8009, 0xf289, 0xe918, 0x1191, 0xd121, 0x8416, 0xf142, 0x12fc }, 16, 0x00084960, 1},
-	{{0x9fec, 0x34e9, 0x810a, 0xf28b, 0xf142, 0x8816, 0x34e9, 0x8280, 0x12fc, 0x9fec, 0x34e9, 0x811a, 0xf28b, 0xf142, 0x34e9, 0x8290 }, 16, 0x00084980, 1},
-	{{0x2469, 0xf142, 0x840b, 0x8810, 0x3980, 0x2c00, 0x8009, 0x3980, 0x3000, 0x8009, 0x90c0, 0xe819, 0x27e9, 0x9ff8, 0x5091, 0x0090 }, 16, 0x000849a0, 1},
-	{{0xe768, 0x9f71, 0x3118, 0x8700, 0x3410, 0x8100, 0x8409, 0xc282, 0x8808, 0xc08a, 0x2d10, 0x6c10, 0xd0a1, 0xd05a, 0x9f70, 0x7478 }, 16, 0x000849c0, 1},
-	{{0x2bff, 0x98eb, 0xcd50, 0xcc51, 0xcd5f, 0x3be1, 0xc19c, 0xcc58, 0x2469, 0xe748, 0x36e0, 0x8001, 0x34e1, 0x8001, 0xd891, 0xd4c0 }, 16, 0x000849e0, 1},
-	{{0x8414, 0xcd57, 0xc841, 0x3980, 0x3200, 0x8009, 0x8816, 0x0085, 0x335b, 0x8009, 0xc841, 0x3980, 0x3270, 0x8009, 0x0085, 0x3357 }, 16, 0x00084a00, 1},
-	{{0x8009, 0xe819, 0x39c8, 0x3c10, 0xbfff, 0xb286, 0x30cb, 0x8041, 0x1091, 0xf692, 0x34f2, 0x9fff, 0xf591, 0x1090, 0x8002, 0xb487 }, 16, 0x00084a20, 1},
-	{{0xb607, 0xb506, 0x8048, 0xce50, 0x32e2, 0x34d2, 0x3fc2, 0xcc58, 0x803d, 0x3bc2, 0x1801, 0xa001, 0xf703, 0x2f90, 0xcf57, 0x2aff }, 16, 0x00084a40, 1},
-	{{0x9efd, 0x37d2, 0xf702, 0x25e9, 0xce58, 0x8423, 0x8358, 0xc181, 0x3557, 0xd02a, 0x8419, 0x3941, 0xcf5f, 0x34f2, 0x2d10, 0xcc58 }, 16, 0x00084a60, 1},
-	{{0xf202, 0xf703, 0x2aff, 0x9ed7, 0x1801, 0xa001, 0x34f4, 0x9fff, 0x803f, 0x3364, 0x34d4, 0xcc58, 0x8037, 0xcd5f, 0x3fc2, 0x1801 }, 16, 0x00084a80, 1},
-	{{0xa002, 0x2d10, 0xf703, 0x2aff, 0x9eb5, 0xf202, 0x25e9, 0xce58, 0x841f, 0x8312, 0xc182, 0x3a41, 0xd022, 0x8415, 0x2d10, 0x34f4 }, 16, 0x00084aa0, 1},
-	{{0xcc58, 0xf703, 0xf202, 0x2aff, 0x9e95, 0x1801, 0xa002, 0xce58, 0x2aff, 0x9ef5, 0xc181, 0x3650, 0x34d5, 0xcd5f, 0x3fc2, 0xcc5a }, 16, 0x00084ac0, 1},
-	{{0x3bc2, 0x3452, 0xcd57, 0xf402, 0xf703, 0x2aff, 0x9e71, 0x1801, 0xa001, 0x65e9, 0x841b, 0x3ac1, 0xd22a, 0x8415, 0x34f5, 0xcc58 }, 16, 0x00084ae0, 1},
-	{{0xf703, 0x1802, 0xa008, 0x2aff, 0x9e55, 0x1801, 0xa001, 0xce58, 0x2aff, 0x9eb5, 0xc182, 0x3650, 0x34d6, 0xcc5a, 0x3452, 0xcd5f }, 16, 0x00084b00, 1},
-	{{0xf402, 0xf703, 0x2aff, 0x9e37, 0x1801, 0xa002, 0x65e9, 0x841b, 0x3b41, 0xd222, 0x8415, 0x34f6, 0xcc58, 0xf703, 0x1802, 0xa008 }, 16, 0x00084b20, 1},
-	{{0x2aff, 0x9e1b, 0x1801, 0xa002, 0x3024, 0x3f50, 0x8009, 0xe768, 0x3184, 0x357c, 0x8008, 0x2bff, 0x9775, 0xe748, 0xeee9, 0x2aff }, 16, 0x00084b40, 1},
-	{{0x965b, 0xefe8, 0x2c10, 0x3900, 0x20e0, 0x8008, 0x3800, 0x20e2, 0x8008, 0x0011, 0xeff1, 0x4010, 0x0081, 0x3a37, 0x8009, 0x0081 }, 16, 0x00084b60, 1},
-	{{0x3a3a, 0x8009, 0x2418, 0x84a0, 0x2c10, 0x0081, 0x3a34, 0x8009, 0x2bff, 0x96f9, 0x0085, 0x3a36, 0x8009, 0x6469, 0x800b, 0x5097 }, 16, 0x00084b80, 1},
-	{{0x0082, 0x3358, 0x8009, 0x2aff, 0x972b, 0x6c10, 0xe939, 0xe8ef, 0x2aff, 0x97dd, 0x1801, 0xa005, 0x2469, 0x2c10, 0x38c8, 0x3c10 }, 16, 0x00084ba0, 1},
-	{{0xbfff, 0x840b, 0x2bff, 0x96c5, 0x2118, 0x845c, 0x1190, 0x0086, 0x3358, 0x8009, 0x0c00, 0xa002, 0x32c9, 0x82d0, 0x8418, 0x92c3 }, 16, 0x00084bc0, 1},
-	{{0xc082, 0xc081, 0xd441, 0x30c8, 0x8743, 0x3610, 0x8080, 0x8407, 0x2000, 0x8080, 0x35f0, 0x2c90, 0x3880, 0x2c00, 0x8009, 0x39e1 }, 16, 0x00084be0, 1},
-	{{0x0084, 0x3a2c, 0x8009, 0x3dc2, 0xc940, 0xcc43, 0x3311, 0x2000, 0x8000, 0xec18, 0x0394, 0xc2ff, 0x1497, 0x8008, 0x0080, 0x3204 }, 16, 0x00084c00, 1},
-	{{0x8009, 0x0080, 0x320a, 0x8009, 0x0080, 0x3208, 0x8009, 0x0180, 0x3206, 0x8009, 0x0280, 0x320e, 0x8009, 0x0280, 0x320c, 0x8009 }, 16, 0x00084c20, 1},
-	{{0x0480, 0x3202, 0x8009, 0xc383, 0x29b3, 0x1197, 0x800a, 0xe9fc, 0x0080, 0x3224, 0x8009, 0x0080, 0x3226, 0x8009, 0x0180, 0x321e }, 16, 0x00084c40, 1},
-	{{0x8009, 0x0980, 0x3222, 0x8009, 0x0280, 0x3228, 0x8009, 0x0280, 0x322a, 0x8009, 0x0380, 0x3220, 0x8009, 0x1197, 0x800c, 0xca40 }, 16, 0x00084c60, 1},
-	{{0x0180, 0x323a, 0x8009, 0xc185, 0x28b1, 0xeafe, 0x0080, 0x3240, 0x8009, 0x0080, 0x3242, 0x8009, 0x0180, 0x323c, 0x8009, 0x0280 }, 16, 0x00084c80, 1},
-	{{0x3244, 0x8009, 0x0280, 0x3246, 0x8009, 0x0a80, 0x323e, 0x8009, 0x1197, 0x800e, 0x0180, 0x3256, 0x8009, 0xc187, 0x0280, 0x3262 }, 16, 0x00084ca0, 1},
-	{{0x8009, 0x2931, 0x0280, 0x3260, 0x8009, 0xc186, 0x0b86, 0x3a58, 0x8009, 0x0080, 0x325e, 0x8009, 0x2831, 0x0080, 0x325c, 0x8009 }, 16, 0x00084cc0, 1},
-	{{0x0080, 0x325a, 0x8009, 0x0280, 0x3258, 0x8009, 0x1093, 0x8014, 0x3118, 0x80ff, 0x3c42, 0x38c0, 0x3e5c, 0x8009, 0xc940, 0x90c0 }, 16, 0x00084ce0, 1},
-	{{0xe918, 0x5091, 0x0082, 0x3210, 0x8009, 0x1093, 0x803c, 0x3118, 0x80ff, 0x2aff, 0x9e3f, 0x7460, 0x0a86, 0x3a58, 0x8009, 0x0080 }, 16, 0x00084d00, 1},
-	{{0x3218, 0x8009, 0x1092, 0x8016, 0x3118, 0x80ff, 0x3c42, 0x39c0, 0x3e5c, 0x8009, 0xc840, 0x90c0, 0xe819, 0x5090, 0x0082, 0x322c }, 16, 0x00084d20, 1},
-	{{0x8009, 0x1092, 0x803e, 0x3118, 0x80ff, 0x2aff, 0x9e07, 0x7460, 0x0a86, 0x3a58, 0x8009, 0x0080, 0x3234, 0x8009, 0x1092, 0x8018 }, 16, 0x00084d40, 1},
-	{{0x3118, 0x80ff, 0x3c42, 0x39c0, 0x3e5c, 0x8009, 0xc840, 0x90c0, 0xe819, 0x5090, 0x0082, 0x3248, 0x8009, 0x1092, 0x8040, 0x3118 }, 16, 0x00084d60, 1},
-	{{0x80ff, 0x2aff, 0x9dcf, 0x7460, 0x0a86, 0x3a58, 0x8009, 0x0080, 0x3250, 0x8009, 0x1092, 0x801a, 0x3118, 0x80ff, 0x3c42, 0x39c0 }, 16, 0x00084d80, 1},
-	{{0x3e5c, 0x8009, 0xc840, 0x90c0, 0xe819, 0x5090, 0x0082, 0x3264, 0x8009, 0x1092, 0x8042, 0x3118, 0x80ff, 0x2aff, 0x9d97, 0x7460 }, 16, 0x00084da0, 1},
-	{{0x0a86, 0x3a58, 0x8009, 0x0080, 0x326c, 0x8009, 0x1092, 0x8014, 0x3c68, 0x39c0, 0x3e5c, 0x8009, 0x7c42, 0xc840, 0x90c0, 0xe819 }, 16, 0x00084dc0, 1},
-	{{0x5090, 0x0082, 0x3214, 0x8009, 0x1092, 0x803c, 0x7c68, 0x2aff, 0x9d63, 0x7460, 0x0a86, 0x3a58, 0x8009, 0x0080, 0x321a, 0x8009 }, 16, 0x00084de0, 1},
-	{{0x1092, 0x8016, 0x3c68, 0x39c0, 0x3e5c, 0x8009, 0x7c42, 0xc840, 0x90c0, 0xe819, 0x5090, 0x0082, 0x3230, 0x8009, 0x1092, 0x803e }, 16, 0x00084e00, 1},
-	{{0x7c68, 0x2aff, 0x9d2f, 0x7460, 0x0a86, 0x3a58, 0x8009, 0x0080, 0x3236, 0x8009, 0x1092, 0x8018, 0x3c68, 0x39c0, 0x3e5c, 0x8009 }, 16, 0x00084e20, 1},
-	{{0x7c42, 0xc840, 0x90c0, 0xe819, 0x5090, 0x0082, 0x324c, 0x8009, 0x1092, 0x8040, 0x7c68, 0x2aff, 0x9cfb, 0x7460, 0x0a86, 0x3a58 }, 16, 0x00084e40, 1},
-	{{0x8009, 0x0080, 0x3252, 0x8009, 0x1092, 0x801a, 0x3c68, 0x39c0, 0x3e5c, 0x8009, 0x7c42, 0xc840, 0x90c0, 0xe819, 0x5090, 0x0082 }, 16, 0x00084e60, 1},
-	{{0x3268, 0x8009, 0x1092, 0x8042, 0x7c68, 0x2aff, 0x9cc7, 0x7460, 0xc840, 0x0087, 0x321e, 0x8009, 0x0187, 0x3202, 0x8009, 0x331a }, 16, 0x00084e80, 1},
-	{{0x80ff, 0x3119, 0x80ff, 0x30e2, 0x0880, 0x326e, 0x8009, 0x840f, 0x0900, 0xa0ff, 0xc840, 0x0880, 0x321e, 0x8009, 0x0087, 0x3202 }, 16, 0x00084ea0, 1},
-	{{0x8009, 0x311a, 0x80ff, 0x0087, 0x323a, 0x8009, 0x3119, 0x80ff, 0x70e2, 0x840f, 0x0900, 0xa0ff, 0xc840, 0x0880, 0x323a, 0x8009 }, 16, 0x00084ec0, 1},
-	{{0x0087, 0x3202, 0x8009, 0x311a, 0x80ff, 0x0087, 0x3256, 0x8009, 0x3119, 0x80ff, 0x70e2, 0x840f, 0x0900, 0xa0ff, 0xc840, 0x0880 }, 16, 0x00084ee0, 1},
-	{{0x3256, 0x8009, 0x0087, 0x321e, 0x8009, 0x311a, 0x80ff, 0x0087, 0x323a, 0x8009, 0x3119, 0x80ff, 0x70e2, 0x840f, 0x0900, 0xa0ff }, 16, 0x00084f00, 1},
-	{{0xc840, 0x0880, 0x323a, 0x8009, 0x0087, 0x321e, 0x8009, 0x311a, 0x80ff, 0x0087, 0x3256, 0x8009, 0x3119, 0x80ff, 0x70e2, 0x840f }, 16, 0x00084f20, 1},
-	{{0x0900, 0xa0ff, 0xc840, 0x0880, 0x3256, 0x8009, 0x0087, 0x323a, 0x8009, 0x311a, 0x80ff, 0x0087, 0x3256, 0x8009, 0x3119, 0x80ff }, 16, 0x00084f40, 1},
-	{{0x70e2, 0x840f, 0x0900, 0xa0ff, 0xc840, 0x0880, 0x3256, 0x8009, 0x2c90, 0x0886, 0x3a58, 0x8009, 0x90c0, 0x1090, 0x8002, 0x0c00 }, 16, 0x00084f60, 1},
-	{{0xa004, 0x8017, 0x0087, 0x3202, 0x8009, 0x3118, 0x80ff, 0xf002, 0xf001, 0x2aff, 0x9a4f, 0xc081, 0x2c90, 0x0886, 0x3a58, 0x8009 }, 16, 0x00084f80, 1},
-	{{0x90c0, 0x1090, 0x8002, 0x0c00, 0xa008, 0x8017, 0x0087, 0x321e, 0x8009, 0x3118, 0x80ff, 0xf002, 0xf001, 0x2aff, 0x9a27, 0xc082 }, 16, 0x00084fa0, 1},
-	{{0x2c90, 0x0886, 0x3a58, 0x8009, 0x90c0, 0x1090, 0x8002, 0x0c00, 0xa010, 0x8017, 0x0087, 0x323a, 0x8009, 0x3118, 0x80ff, 0xf002 }, 16, 0x00084fc0, 1},
-	{{0xf001, 0x2aff, 0x99ff, 0xc083, 0x2c90, 0x0886, 0x3a58, 0x8009, 0x90c0, 0x1090, 0x8002, 0x0c00, 0xa020, 0x8017, 0x0087, 0x3256 }, 16, 0x00084fe0, 1},
-	{{0x8009, 0x3118, 0x80ff, 0xf002, 0xf001, 0x2aff, 0x99d7, 0xc084, 0xc181, 0x3061, 0x2c00, 0x8009, 0x0181, 0x3a38, 0x8009, 0x0082 }, 16, 0x00085000, 1},
-	{{0x3350, 0x8009, 0x0085, 0x3a37, 0x8009, 0x34e0, 0x3840, 0x2cda, 0x8009, 0x3cc1, 0x0085, 0x3a34, 0x8009, 0x2469, 0xc941, 0x90c0 }, 16, 0x00085020, 1},
-	{{0xe918, 0x5811, 0x8008, 0xc84e, 0xe8fc, 0xc84e, 0x2c10, 0xeef1, 0x0081, 0x3a34, 0x8009, 0x2418, 0x83d6, 0x0680, 0x3a32, 0x8009 }, 16, 0x00085040, 1},
-	{{0x2aff, 0x9229, 0xc081, 0x0085, 0x3a35, 0x8009, 0x6469, 0x800b, 0x5096, 0x0082, 0x3354, 0x8009, 0x2aff, 0x9259, 0xc081, 0xe9ee }, 16, 0x00085060, 1},
-	{{0xe838, 0x2aff, 0x930b, 0x1801, 0xa005, 0x2469, 0xc081, 0x8409, 0x2bff, 0x91f9, 0x8b99, 0x0886, 0x3a58, 0x8009, 0x39c8, 0x3c10 }, 16, 0x00085080, 1},
-	{{0xbfff, 0x1090, 0x8078, 0x0d40, 0xa000, 0x840b, 0xc090, 0x0080, 0x3a2e, 0x8009, 0x1191, 0x0086, 0x3354, 0x8009, 0x0c00, 0xa002 }, 16, 0x000850a0, 1},
-	{{0x32c9, 0x82c0, 0x8418, 0x92c3, 0xc082, 0xc081, 0xd441, 0x30c8, 0x8743, 0x3610, 0x8080, 0x8407, 0x2000, 0x8080, 0x35f0, 0x2d10 }, 16, 0x000850c0, 1},
-	{{0x3980, 0x3000, 0x8009, 0x39e1, 0x0084, 0x3a2e, 0x8009, 0x3dc2, 0xca40, 0xcc43, 0x3311, 0x2000, 0x8000, 0xec19, 0x0394, 0xc1ff }, 16, 0x000850e0, 1},
-	{{0x1396, 0x8008, 0x0080, 0x3274, 0x8009, 0x0080, 0x3278, 0x8009, 0x0080, 0x327a, 0x8009, 0x0280, 0x3276, 0x8009, 0x0180, 0x327c }, 16, 0x00085100, 1},
-	{{0x8009, 0x0180, 0x327e, 0x8009, 0xc283, 0x29b2, 0x0380, 0x3272, 0x8009, 0x1996, 0x800a, 0xcb40, 0xeafc, 0x0080, 0x3294, 0x8009 }, 16, 0x00085120, 1},
-	{{0x0080, 0x3296, 0x8009, 0x0a80, 0x3292, 0x8009, 0x0180, 0x329a, 0x8009, 0x0180, 0x3298, 0x8009, 0x0980, 0x328e, 0x8009, 0xc285 }, 16, 0x00085140, 1},
-	{{0x2932, 0x0380, 0x3290, 0x8009, 0x1996, 0x800c, 0xebfe, 0x0080, 0x32b0, 0x8009, 0x0080, 0x32b2, 0x8009, 0x0180, 0x32b4, 0x8009 }, 16, 0x00085160, 1},
-	{{0x0180, 0x32b6, 0x8009, 0x0280, 0x32ac, 0x8009, 0x0980, 0x32aa, 0x8009, 0x0b80, 0x32ae, 0x8009, 0x1996, 0x800e, 0x0180, 0x32d0 }, 16, 0x00085180, 1},
-	{{0x8009, 0x0180, 0x32d2, 0x8009, 0xc187, 0x2931, 0xc186, 0x0080, 0x32cc, 0x8009, 0x2831, 0x0080, 0x32ce, 0x8009, 0x0080, 0x32ca }, 16, 0x000851a0, 1},
-	{{0x8009, 0x0980, 0x32c6, 0x8009, 0x0280, 0x32c8, 0x8009, 0x1090, 0x801c, 0x3118, 0x80ff, 0x3c42, 0x39c0, 0x3e5c, 0x8009, 0xca40 }, 16, 0x000851c0, 1},
-	{{0x90c0, 0xea19, 0x5092, 0x0082, 0x3280, 0x8009, 0x1090, 0x8044, 0x3118, 0x80ff, 0x2aff, 0x995d, 0x7460, 0x0a86, 0x3a58, 0x8009 }, 16, 0x000851e0, 1},
-	{{0x0080, 0x3288, 0x8009, 0x1092, 0x801e, 0x3118, 0x80ff, 0x3c42, 0x39c0, 0x3e5c, 0x8009, 0xc840, 0x90c0, 0xe819, 0x5090, 0x0082 }, 16, 0x00085200, 1},
-	{{0x329c, 0x8009, 0x1092, 0x8046, 0x3118, 0x80ff, 0x2aff, 0x9925, 0x7460, 0x0a86, 0x3a58, 0x8009, 0x0080, 0x32a4, 0x8009, 0x1092 }, 16, 0x00085220, 1},
-	{{0x8020, 0x3118, 0x80ff, 0x3c42, 0x39c0, 0x3e5c, 0x8009, 0xc840, 0x90c0, 0xe819, 0x5090, 0x0082, 0x32b8, 0x8009, 0x1092, 0x8048 }, 16, 0x00085240, 1},
-	{{0x3118, 0x80ff, 0x2aff, 0x98ed, 0x7460, 0x0a86, 0x3a58, 0x8009, 0x0080, 0x32c0, 0x8009, 0x1092, 0x8022, 0x3118, 0x80ff, 0x3c42 }, 16, 0x00085260, 1},
-	{{0x39c0, 0x3e5c, 0x8009, 0xc840, 0x90c0, 0xe819, 0x5090, 0x0082, 0x32d4, 0x8009, 0x1092, 0x804a, 0x3118, 0x80ff, 0x2aff, 0x98b5 }, 16, 0x00085280, 1},
-	{{0x7460, 0x0a86, 0x3a58, 0x8009, 0x0080, 0x32dc, 0x8009, 0x1092, 0x801c, 0x3c68, 0x39c0, 0x3e5c, 0x8009, 0x7c42, 0xc840, 0x90c0 }, 16, 0x000852a0, 1},
-	{{0xe819, 0x5090, 0x0082, 0x3284, 0x8009, 0x1092, 0x8044, 0x7c68, 0x2aff, 0x9881, 0x7460, 0x0a86, 0x3a58, 0x8009, 0x0080, 0x328a }, 16, 0x000852c0, 1},
-	{{0x8009, 0x1092, 0x801e, 0x3c68, 0x39c0, 0x3e5c, 0x8009, 0x7c42, 0xc840, 0x90c0, 0xe819, 0x5090, 0x0082, 0x32a0, 0x8009, 0x1092 }, 16, 0x000852e0, 1},
-	{{0x8046, 0x7c68, 0x2aff, 0x984d, 0x7460, 0x0a86, 0x3a58, 0x8009, 0x0080, 0x32a6, 0x8009, 0x1092, 0x8020, 0x3c68, 0x39c0, 0x3e5c }, 16, 0x00085300, 1},
-	{{0x8009, 0x7c42, 0xc840, 0x90c0, 0xe819, 0x5090, 0x0082, 0x32bc, 0x8009, 0x1092, 0x8048, 0x7c68, 0x2aff, 0x9819, 0x7460, 0x0a86 }, 16, 0x00085320, 1},
-	{{0x3a58, 0x8009, 0x0080, 0x32c2, 0x8009, 0x1092, 0x8022, 0x3c68, 0x39c0, 0x3e5c, 0x8009, 0x7c42, 0xc840, 0x90c0, 0xe819, 0x5090 }, 16, 0x00085340, 1},
-	{{0x0082, 0x32d8, 0x8009, 0x1092, 0x804a, 0x7c68, 0x2aff, 0x97e5, 0x7460, 0xc940, 0x0886, 0x3a58, 0x8009, 0x0980, 0x32de, 0x8009 }, 16, 0x00085360, 1},
-	{{0x1890, 0x8002, 0x0c08, 0xa040, 0x8019, 0x0087, 0x3272, 0x8009, 0x3118, 0x80ff, 0xc181, 0xf001, 0x2aff, 0x9649, 0x3451, 0xf002 }, 16, 0x00085380, 1},
-	{{0x0886, 0x3a58, 0x8009, 0x0087, 0x328e, 0x8009, 0x1890, 0x8002, 0x0c08, 0xa080, 0x8013, 0x3118, 0x80ff, 0xf002, 0xf001, 0xc181 }, 16, 0x000853a0, 1},
-	{{0x2aff, 0x9621, 0xc082, 0x0886, 0x3a58, 0x8009, 0x0087, 0x32aa, 0x8009, 0x1890, 0x8002, 0x0c08, 0xa100, 0x8013, 0x3118, 0x80ff }, 16, 0x000853c0, 1},
-	{{0xf002, 0xf001, 0xc181, 0x2aff, 0x95fb, 0xc083, 0x0886, 0x3a58, 0x8009, 0x0087, 0x32c6, 0x8009, 0x1890, 0x8002, 0x0c08, 0xa200 }, 16, 0x000853e0, 1},
-	{{0x8013, 0x3118, 0x80ff, 0xf002, 0xf001, 0xc181, 0x2aff, 0x95d5, 0xc084, 0xc181, 0x3061, 0x3c00, 0x8009, 0x0181, 0x3a39, 0x8009 }, 16, 0x00085400, 1},
-	{{0x0082, 0x3348, 0x8009, 0x0182, 0x3340, 0x8009, 0x0085, 0x3a3a, 0x8009, 0x34e0, 0x3840, 0x2cda, 0x8009, 0x3cc1, 0x0085, 0x3a34 }, 16, 0x00085420, 1},
-	{{0x8009, 0x2469, 0xc941, 0x90c0, 0xe918, 0x5811, 0xc848, 0x8012, 0x0080, 0x3a30, 0x8009, 0xe8fc, 0xc848, 0x0080, 0x3a30, 0x8009 }, 16, 0x00085440, 1},
-	{{0x0185, 0x3a37, 0x8009, 0x74e1, 0x24e9, 0x0185, 0x3a3a, 0x8009, 0x8409, 0x74e1, 0x64e9, 0xd358, 0x3776, 0x34f0, 0xc2b0, 0x2e7d }, 16, 0x00085460, 1},
-	{{0xc290, 0x2e7c, 0x0084, 0x3a32, 0x8009, 0x3264, 0x38ba, 0x8008, 0xf601, 0x3024, 0x3f50, 0x8009, 0x3456, 0xe768, 0xf085, 0x646a }, 16, 0x00085480, 1},
-	{{0x840f, 0x9f40, 0x90c0, 0x90c0, 0x92d0, 0x5019, 0x4018, 0x9f71, 0x3324, 0x3f30, 0x8009, 0xe750, 0xc184, 0xc790, 0x3e80, 0x3300 }, 16, 0x000854a0, 1},
-	{{0x8009, 0x3fc0, 0x34a8, 0x8009, 0x36c1, 0x34e8, 0x8009, 0x189f, 0xf143, 0xf701, 0xb643, 0x3264, 0x3a12, 0x8008, 0x5996, 0xe9e8 }, 16, 0x000854c0, 1},
-	{{0x189e, 0xf1c3, 0x83b8, 0x1801, 0xa020, 0x78e1, 0x64ea, 0x81e1, 0x3024, 0x3f50, 0x8009, 0xe770, 0x2469, 0x0185, 0x3a36, 0x8009 }, 16, 0x000854e0, 1},
-	{{0x844f, 0xd0a3, 0x844b, 0x0286, 0x3350, 0x8009, 0x0184, 0x3a2c, 0x8009, 0x0902, 0xa300, 0xdc9a, 0x38e8, 0x2c08, 0xbfff, 0x0182 }, 16, 0x00085500, 1},
-	{{0x334c, 0x8009, 0x0190, 0x3261, 0x2c00, 0x8009, 0x0185, 0x3a38, 0x8009, 0x24e9, 0xc181, 0x8405, 0x880b, 0x2c90, 0x3281, 0x2400 }, 16, 0x00085520, 1},
-	{{0x8009, 0x0282, 0x3350, 0x8009, 0x0181, 0x3a38, 0x8009, 0xd021, 0x8455, 0x0085, 0x3a35, 0x8009, 0xd023, 0x844b, 0x0186, 0x3348 }, 16, 0x00085540, 1},
-	{{0x8009, 0x0084, 0x3a2e, 0x8009, 0x0901, 0xa300, 0xdc19, 0x38e8, 0x2808, 0xbfff, 0x0082, 0x3344, 0x8009, 0x0090, 0x3161, 0x3c00 }, 16, 0x00085560, 1},
-	{{0x8009, 0x0085, 0x3a39, 0x8009, 0x2469, 0xc081, 0x8405, 0x880b, 0x2c10, 0x3161, 0x3400, 0x8009, 0x0182, 0x3348, 0x8009, 0x0081 }, 16, 0x00085580, 1},
-	{{0x3a39, 0x8009, 0x9f71, 0x9f71, 0x31e4, 0x3a68, 0x8001, 0x31e4, 0x203c, 0x8008, 0x2bff, 0x8d17, 0x2708, 0x8020, 0xe7e8, 0x83ea }, 16, 0x000855a0, 1},
-	{{0xc0a6, 0x38a8, 0x3c20, 0xbfff, 0x09c6, 0x3e10, 0x8009, 0x1c90, 0x0a86, 0x3a54, 0x8009, 0x3be8, 0x280c, 0xbfff, 0xe8ec, 0xe839 }, 16, 0x000855c0, 1},
-	{{0x0892, 0x3161, 0x2000, 0x8005, 0x0886, 0x3a54, 0x8009, 0x0cc2, 0x3e10, 0x8009, 0x5093, 0x0080, 0x8060, 0x00c4, 0x3e56, 0x8009 }, 16, 0x000855e0, 1},
-	{{0x3841, 0x0886, 0x3a54, 0x8009, 0x00c0, 0x3e56, 0x8009, 0x5090, 0x3079, 0x3101, 0x3000, 0x8003, 0x8007, 0x70f8, 0x8417, 0x0085 }, 16, 0x00085600, 1},
-	{{0x3a5e, 0x8009, 0x2469, 0xc081, 0x840b, 0x893e, 0x0081, 0x3a5c, 0x8009, 0x9244, 0x2a03, 0x8010, 0x3c80, 0x3206, 0x8009, 0x3880 }, 16, 0x00085620, 1},
-	{{0x3300, 0x8009, 0x1a14, 0xec44, 0x1014, 0x0b86, 0x3350, 0x8009, 0x246a, 0x1998, 0xeafc, 0xea1b, 0x94c3, 0x2203, 0x801a, 0xec58 }, 16, 0x00085640, 1},
-	{{0x9f40, 0x90c0, 0x90c0, 0x92d0, 0x501a, 0x92d0, 0x4019, 0x90c0, 0x90c0, 0x0084, 0x3a32, 0x8009, 0xd028, 0x8407, 0x2bff, 0x9e35 }, 16, 0x00085660, 1},
-	{{0x00c5, 0x3e58, 0x8009, 0x7460, 0xd021, 0x8409, 0x3384, 0x3306, 0x8008, 0x3880, 0x3204, 0x8009, 0xc84f, 0x280a, 0x8004, 0x2a08 }, 16, 0x00085680, 1},
-	{{0x8012, 0xeee8, 0xefe8, 0xf846, 0xe86a, 0x39c0, 0x34d8, 0x8009, 0xc684, 0xfa45, 0xf947, 0xee66, 0xef62, 0xf848, 0x1212, 0xf8c8 }, 16, 0x000856a0, 1},
-	{{0x13d7, 0x0084, 0x3a32, 0x8009, 0x1990, 0xf8c6, 0x1096, 0xd028, 0x8452, 0x11d0, 0x3880, 0x371c, 0x8009, 0x3d41, 0xf105, 0xf206 }, 16, 0x000856c0, 1},
-	{{0xf042, 0xf301, 0x2aff, 0x9ecb, 0x1807, 0xa001, 0xf9c7, 0x1801, 0xa010, 0x3264, 0x396a, 0x8008, 0x1891, 0x3980, 0x371c, 0x8009 }, 16, 0x000856e0, 1},
-	{{0xc847, 0x0986, 0x3350, 0x8009, 0x1810, 0x1801, 0xa010, 0x90c0, 0xe8fc, 0xe819, 0xf9c7, 0x90c0, 0x5991, 0x2aff, 0x9d83, 0xb9cb }, 16, 0x00085700, 1},
-	{{0x8821, 0xc847, 0x0a86, 0x3350, 0x8009, 0x1810, 0xf105, 0xf042, 0xf206, 0xf301, 0xe8fc, 0x1807, 0xa001, 0x2aff, 0x9e75, 0xe81a }, 16, 0x00085720, 1},
-	{{0x3b61, 0xf8c8, 0x276a, 0xf9c7, 0xe85c, 0xf848, 0xf8c6, 0xfac5, 0xe85c, 0xf846, 0xc847, 0xe944, 0xea5c, 0xe85c, 0xee5c, 0xef5c }, 16, 0x00085740, 1},
-	{{0xfa45, 0xc84f, 0x8158, 0xf947, 0x38e8, 0x2c0c, 0xbfff, 0xc181, 0x1090, 0x0886, 0x3a54, 0x8009, 0x30c8, 0x8200, 0x2469, 0x3261 }, 16, 0x00085760, 1},
-	{{0x2c00, 0x8009, 0x8427, 0x1090, 0x8036, 0x7841, 0x2c10, 0x0000, 0x8036, 0x0181, 0x3a38, 0x8009, 0x2aff, 0x9d61, 0x0282, 0x3350 }, 16, 0x00085780, 1},
-	{{0x8009, 0x2aff, 0x9d57, 0x6c10, 0x8809, 0x2aff, 0x9d4f, 0x6c10, 0x2bff, 0x9df7, 0x3aa8, 0x3c20, 0xbfff, 0x08c6, 0x3e10, 0x8009 }, 16, 0x000857a0, 1},
-	{{0x1a92, 0x0986, 0x3a54, 0x8009, 0x90c0, 0xea38, 0xba4d, 0x0886, 0x3a54, 0x8009, 0x90c0, 0xb4c5, 0x1080, 0x8058, 0x6c7c, 0x0480 }, 16, 0x000857c0, 1},
-	{{0x8058, 0x27e8, 0x9fe0, 0x3024, 0x3f50, 0x8009, 0xe7e8, 0x3324, 0x3f30, 0x8009, 0xe750, 0xc184, 0xc790, 0x3e80, 0x32e0, 0x8009 }, 16, 0x000857e0, 1},
-	{{0x3fc0, 0x34c8, 0x8009, 0x3ac0, 0x34a8, 0x8009, 0x36c1, 0x34e8, 0x8009, 0x189a, 0xf143, 0xf701, 0xb643, 0x189f, 0x5996, 0x3264 }, 16, 0x00085800, 1},
-	{{0x3a12, 0x8008, 0xfa44, 0xe9e8, 0x189e, 0xf1c3, 0xfac4, 0x2aff, 0x9c6f, 0x1801, 0xa020, 0x78e1, 0x64ea, 0x81d9, 0x3024, 0x3f50 }, 16, 0x00085820, 1},
-	{{0x8009, 0xe770, 0x9f71, 0x2bff, 0x8a85, 0x2708, 0x8028, 0xe7e8, 0x2aff, 0x9d59, 0xc0a2, 0x3aa8, 0x3c20, 0xbfff, 0x09c6, 0x3e10 }, 16, 0x00085840, 1},
-	{{0x8009, 0x1092, 0xe8ea, 0x00c2, 0x3e14, 0x8009, 0x1b90, 0x0a86, 0x3a54, 0x8009, 0x0bc2, 0x3e14, 0x8009, 0xeb39, 0xbb51, 0x00c4 }, 16, 0x00085860, 1},
-	{{0x3e54, 0x8009, 0x3841, 0x3880, 0x3276, 0x8009, 0x9244, 0x2a03, 0x8010, 0x3c80, 0x32e0, 0x8009, 0x00c0, 0x3e54, 0x8009, 0x1a10 }, 16, 0x00085880, 1},
-	{{0xe844, 0x1010, 0x0b86, 0x3348, 0x8009, 0x246a, 0x199c, 0xeafc, 0xea1b, 0x94c3, 0x2203, 0x801a, 0xe858, 0x9f40, 0x90c0, 0x90c0 }, 16, 0x000858a0, 1},
-	{{0x92d0, 0x501a, 0x92d0, 0x4019, 0x90c0, 0x90c0, 0x0084, 0x3a30, 0x8009, 0xd028, 0x8405, 0x8319, 0x00c5, 0x3e58, 0x8009, 0x7460 }, 16, 0x000858c0, 1},
-	{{0xd025, 0x8409, 0x3384, 0x3306, 0x8008, 0x3a80, 0x3274, 0x8009, 0xc084, 0x2a0e, 0x8004, 0x2e0f, 0x8012, 0xe8ef, 0xebef, 0xecef }, 16, 0x000858e0, 1},
-	{{0xe86a, 0x39c0, 0x34b8, 0x8009, 0xf946, 0xf045, 0xeb66, 0xec62, 0xf847, 0xc790, 0xc681, 0x1990, 0x0084, 0x3a30, 0x8009, 0x1316 }, 16, 0x00085900, 1},
-	{{0x10d4, 0xd028, 0x8454, 0x1193, 0x52d7, 0x3dc1, 0xf607, 0xf306, 0xf205, 0xf142, 0xf001, 0xfa48, 0xfb49, 0xfc4a, 0x2aff, 0x9c73 }, 16, 0x00085920, 1},
-	{{0x3880, 0x371c, 0x8009, 0xf9c6, 0xf701, 0x3264, 0x396a, 0x8008, 0x1891, 0x3980, 0x371c, 0x8009, 0xfac8, 0x0986, 0x3348, 0x8009 }, 16, 0x00085940, 1},
-	{{0x1812, 0xfcca, 0xf701, 0xe8fc, 0xe819, 0xf9c6, 0xfbc9, 0x5991, 0x2aff, 0x9b2d, 0xb9cb, 0x8829, 0x1812, 0x0d86, 0x3348, 0x8009 }, 16, 0x00085960, 1},
-	{{0xf607, 0xf306, 0xf205, 0xf142, 0xf001, 0xe8fc, 0xfa48, 0xfb49, 0xfc4a, 0x2aff, 0x9c1d, 0xe81d, 0xfac8, 0xfbc9, 0xfcca, 0xf8c7 }, 16, 0x00085980, 1},
-	{{0xf9c6, 0xf0c5, 0x3861, 0xe85c, 0x246a, 0xe944, 0xec5c, 0xf847, 0xf045, 0xeb5c, 0xef5c, 0xee5c, 0xea5c, 0x815c, 0xf946, 0x38e8 }, 16, 0x000859a0, 1},
-	{{0x280c, 0xbfff, 0x3161, 0x3c00, 0x8009, 0x1090, 0x0886, 0x3a54, 0x8009, 0x30c8, 0x8200, 0x2469, 0xc081, 0x8425, 0x1290, 0x8038 }, 16, 0x000859c0, 1},
-	{{0x7941, 0x0200, 0x8038, 0x0081, 0x3a39, 0x8009, 0x2aff, 0x9b0d, 0x0182, 0x3348, 0x8009, 0x2aff, 0x9b03, 0xc081, 0x8809, 0x2aff }, 16, 0x000859e0, 1},
-	{{0x9afb, 0xc081, 0x2bff, 0x9e41, 0x27e8, 0x9fd8, 0x3024, 0x3f50, 0x8009, 0xe7e8, 0x38e8, 0x2404, 0xbfff, 0x20e0, 0x83ff, 0x1190 }, 16, 0x00085a00, 1},
-	{{0x3940, 0x3a54, 0x8008, 0xdc01, 0x2aff, 0x8897, 0x0090, 0xc090, 0xc186, 0x2aff, 0x8893, 0xc090, 0xc08c, 0x2aff, 0x8885, 0x3940 }, 16, 0x00085a20, 1},
-	{{0x3ae8, 0x8008, 0xc186, 0x3044, 0x22c4, 0x8008, 0xc08c, 0x31e4, 0x3a7a, 0x8001, 0x2aff, 0x9b55, 0x7468, 0x3800, 0x20e4, 0x8008 }, 16, 0x00085a40, 1},
-	{{0x39c8, 0x3c14, 0xbfff, 0x10d0, 0x3a00, 0x2040, 0x8008, 0x7841, 0x4010, 0x0886, 0x3a54, 0x8009, 0x90c0, 0x1090, 0x8050, 0x7841 }, 16, 0x00085a60, 1},
-	{{0x0000, 0x8050, 0x5091, 0x10d2, 0x0c10, 0xa400, 0x8049, 0x3118, 0x8fff, 0x3100, 0x9000, 0x2aff, 0x87f3, 0x2c10, 0x4012, 0x2aff }, 16, 0x00085a80, 1},
-	{{0x87eb, 0xc081, 0x83aa, 0xc0aa, 0x83a6, 0xc0ac, 0x83a2, 0xc0a2, 0x839e, 0xc0a6, 0x839a, 0xc0b2, 0x8396, 0xc0b4, 0x8392, 0xc0b6 }, 16, 0x00085aa0, 1},
-	{{0x838e, 0xc0ae, 0x38e8, 0x3c0c, 0xbfff, 0x3001, 0x2ccc, 0x8f58, 0x9f70, 0x4090, 0x31f8, 0x90ff, 0x3100, 0x8300, 0x0012, 0xc081 }, 16, 0x00085ac0, 1},
-	{{0x9f70, 0x0081, 0x3a5c, 0x8009, 0x2bff, 0x87e3, 0x2aff, 0x9abd, 0x3750, 0x7468, 0x38c8, 0x3c14, 0xbfff, 0x3b80, 0x341c, 0x8009 }, 16, 0x00085ae0, 1},
-	{{0x1090, 0x3880, 0x389c, 0x8009, 0x2c10, 0x0c10, 0xa100, 0x801d, 0x2704, 0x8060, 0x3980, 0x365c, 0x8009, 0x3a80, 0x34dc, 0x8009 }, 16, 0x00085b00, 1},
-	{{0x94d0, 0x4019, 0x4018, 0x001a, 0x401b, 0x2760, 0x38c8, 0x3c18, 0xbfff, 0xd32c, 0x8427, 0x1090, 0x38c8, 0x3c10, 0xbfff, 0x0c00 }, 16, 0x00085b20, 1},
-	{{0xa003, 0x8419, 0x1090, 0x38e8, 0x3c04, 0xbfff, 0x0d10, 0xa800, 0x800b, 0x5090, 0x0990, 0xa000, 0x4090, 0xd32c, 0x8415, 0x0986 }, 16, 0x00085b40, 1},
-	{{0x3a54, 0x8009, 0x90c0, 0x2908, 0x8052, 0x8816, 0x2909, 0x8052, 0x0986, 0x3a54, 0x8009, 0x90c0, 0x2908, 0x8054, 0x2909, 0x8054 }, 16, 0x00085b60, 1},
-	{{0x50d0, 0x7841, 0x3024, 0x3f50, 0x8009, 0x4011, 0x0886, 0x3a58, 0x8009, 0x90c0, 0x1090, 0x803c, 0x3118, 0x80ff, 0x2aff, 0x8fb5 }, 16, 0x00085b80, 1},
-	{{0x7460, 0x0886, 0x3a58, 0x8009, 0x0080, 0x3218, 0x8009, 0x1090, 0x803e, 0x3118, 0x80ff, 0x2aff, 0x8f9b, 0x7460, 0x0886, 0x3a58 }, 16, 0x00085ba0, 1},
-	{{0x8009, 0x0080, 0x3234, 0x8009, 0x1090, 0x8040, 0x3118, 0x80ff, 0x2aff, 0x8f81, 0x7460, 0x0886, 0x3a58, 0x8009, 0x0080, 0x3250 }, 16, 0x00085bc0, 1},
-	{{0x8009, 0x1090, 0x8042, 0x3118, 0x80ff, 0x2aff, 0x8f67, 0x7460, 0x0886, 0x3a58, 0x8009, 0x0080, 0x326c, 0x8009, 0x1090, 0x803c }, 16, 0x00085be0, 1},
-	{{0x7c68, 0x2aff, 0x8f4f, 0x7460, 0x0886, 0x3a58, 0x8009, 0x0080, 0x321a, 0x8009, 0x1090, 0x803e, 0x7c68, 0x2aff, 0x8f37, 0x7460 }, 16, 0x00085c00, 1},
-	{{0x0886, 0x3a58, 0x8009, 0x0080, 0x3236, 0x8009, 0x1090, 0x8040, 0x7c68, 0x2aff, 0x8f1f, 0x7460, 0x0886, 0x3a58, 0x8009, 0x0080 }, 16, 0x00085c20, 1},
-	{{0x3252, 0x8009, 0x1090, 0x8042, 0x7c68, 0x2aff, 0x8f07, 0x7460, 0x0886, 0x3a58, 0x8009, 0x0080, 0x326e, 0x8009, 0x1090, 0x8044 }, 16, 0x00085c40, 1},
-	{{0x3118, 0x80ff, 0x2aff, 0x8eed, 0x7460, 0x0886, 0x3a58, 0x8009, 0x0080, 0x3288, 0x8009, 0x1090, 0x8046, 0x3118, 0x80ff, 0x2aff }, 16, 0x00085c60, 1},
-	{{0x8ed3, 0x7460, 0x0886, 0x3a58, 0x8009, 0x0080, 0x32a4, 0x8009, 0x1090, 0x8048, 0x3118, 0x80ff, 0x2aff, 0x8eb9, 0x7460, 0x0886 }, 16, 0x00085c80, 1},
-	{{0x3a58, 0x8009, 0x0080, 0x32c0, 0x8009, 0x1090, 0x804a, 0x3118, 0x80ff, 0x2aff, 0x8e9f, 0x7460, 0x0886, 0x3a58, 0x8009, 0x0080 }, 16, 0x00085ca0, 1},
-	{{0x32dc, 0x8009, 0x1090, 0x8044, 0x7c68, 0x2aff, 0x8e87, 0x7460, 0x0886, 0x3a58, 0x8009, 0x0080, 0x328a, 0x8009, 0x1090, 0x8046 }, 16, 0x00085cc0, 1},
-	{{0x7c68, 0x2aff, 0x8e6f, 0x7460, 0x0886, 0x3a58, 0x8009, 0x0080, 0x32a6, 0x8009, 0x1090, 0x8048, 0x7c68, 0x2aff, 0x8e57, 0x7460 }, 16, 0x00085ce0, 1},
-	{{0x0886, 0x3a58, 0x8009, 0x0080, 0x32c2, 0x8009, 0x1090, 0x804a, 0x7c68, 0x2aff, 0x8e3f, 0x7460, 0x9f70, 0x0080, 0x32de, 0x8009 }, 16, 0x00085d00, 1},
-	{{0x3124, 0x3f30, 0x8009, 0x83fb, 0x3750, 0x38e8, 0x3c00, 0xbfff, 0x90c0, 0x5090, 0x3128, 0x9f00, 0xdc38, 0x7360, 0x808b, 0x3610 }, 16, 0x00085d20, 1},
-	{{0x8029, 0x8009, 0x3616, 0x802a, 0x800f, 0x3610, 0x802a, 0x841f, 0x3616, 0x8029, 0x8019, 0x32e4, 0x2b2c, 0x8008, 0x30e1, 0x3000 }, 16, 0x00085d40, 1},
-	{{0x8003, 0x2744, 0x8650, 0x90c0, 0x90c0, 0x90c8, 0x3e16, 0x9800, 0x7456, 0x32e4, 0x2b2c, 0x8008, 0x6460, 0x39e8, 0x3c04, 0xbfff }, 16, 0x00085d60, 1},
-	{{0x3041, 0x2e00, 0x9200, 0x0091, 0x38e8, 0x3c08, 0xbfff, 0x2744, 0x8e20, 0x3041, 0x2e00, 0x9000, 0x4090, 0x90c8, 0x38c8, 0x3c14 }, 16, 0x00085d80, 1},
-	{{0xbfff, 0x3000, 0x2d40, 0x8003, 0x1190, 0x38c8, 0x3c14, 0xbfff, 0x0c11, 0xa400, 0x8013, 0x90c0, 0x7861, 0x646a, 0x840b, 0x5190 }, 16, 0x00085da0, 1},
-	{{0x0d11, 0xa400, 0x81f3, 0x3124, 0x3f50, 0x8009, 0x31e4, 0x3a5c, 0x8001, 0x31e4, 0x3a62, 0x8001, 0x31e4, 0x3a7a, 0x8001, 0xe748 }, 16, 0x00085dc0, 1},
-	{{0x9f7d, 0x1015, 0xa0e0, 0x90c0, 0x1115, 0xa0e0, 0x90c0, 0x9f7c, 0x1105, 0xa004, 0x90c0, 0x1105, 0xa008, 0x90c0, 0x90c0, 0x3384 }, 16, 0x00085de0, 1},
-	{{0x31f8, 0x8008, 0x32e4, 0x3aaa, 0x8001, 0xc083, 0x33e4, 0x3a56, 0x8001, 0x32e4, 0x3a74, 0x8001, 0x38e0, 0x3aa4, 0x8001, 0xc0ba }, 16, 0x00085e00, 1},
-	{{0x83ac, 0x39e0, 0x3bca, 0x8001, 0xc182, 0x83a8, 0xc0ba, 0x38c8, 0x3800, 0xbfff, 0xc082, 0x0090, 0xc0bc, 0x8392, 0x3960, 0x2446 }, 16, 0x00085e20, 1},
-	{{0x8008, 0xc182, 0x838e, 0xc0bc, 0x38c8, 0x3800, 0xbfff, 0xc084, 0x0090, 0xc0be, 0x8378, 0x3960, 0x2424, 0x8008, 0xc182, 0x8374 }, 16, 0x00085e40, 1},
-	{{0xc0be, 0x32e4, 0x37c8, 0x8001, 0x6c10, 0x32e4, 0x37c2, 0x8001, 0x6c10, 0x8366, 0xc084, 0x0906, 0x357c, 0x8008, 0xc0fd, 0x2908 }, 16, 0x00085e60, 1},
-	{{0x800c, 0x12d0, 0xc186, 0xdc02, 0xb00e, 0x8348, 0xc084, 0x32e4, 0x2c5e, 0x8008, 0xc08a, 0x2c10, 0x31e1, 0x3990, 0x8001, 0xf141 }, 16, 0x00085e80, 1},
-	{{0x32e4, 0x395a, 0x8001, 0xc182, 0x30e1, 0x3990, 0x8001, 0xf041, 0xc182, 0x32e4, 0x395a, 0x8001, 0xc081, 0xc098, 0x8310, 0x3960 }, 16, 0x00085ea0, 1},
-	{{0x23ec, 0x8008, 0xc187, 0x830c, 0xc098, 0x9f7d, 0x1015, 0xa0e0, 0x90c0, 0x9f7c, 0x9f7c, 0xe768, 0x9f71, 0x39c0, 0x3dd8, 0x8009 }, 16, 0x00085ec0, 1},
-	{{0x3284, 0x301c, 0x8008, 0x38c0, 0x3db8, 0x8009, 0x0886, 0x3a58, 0x8009, 0x39c0, 0x3dd8, 0x8009, 0x1890, 0x807a, 0x0c08, 0xa007 }, 16, 0x00085ee0, 1},
-	{{0x8011, 0x3244, 0x2b56, 0x8008, 0x38c0, 0x3db8, 0x8009, 0x8811, 0xe939, 0x3244, 0x2b56, 0x8008, 0x38c0, 0x3db8, 0x8009, 0xc840 }, 16, 0x00085f00, 1},
-	{{0xd028, 0xe8fc, 0x0000, 0x386c, 0x800a, 0x92c2, 0xc088, 0x800a, 0x0800, 0x386e, 0x800a, 0xc090, 0x0986, 0x3a58, 0x8009, 0x0000 }, 16, 0x00085f20, 1},
-	{{0x3870, 0x800a, 0x9f70, 0xb00a, 0x3800, 0x201c, 0x8008, 0x0067, 0x3f82, 0x8004, 0x0010, 0x3900, 0x201e, 0x8008, 0x0a47, 0x2c74 }, 16, 0x00085f40, 1},
-	{{0x8009, 0x0a11, 0x3800, 0x2022, 0x8008, 0x2a80, 0x94af, 0x0a10, 0x3900, 0x2024, 0x8008, 0x38a8, 0x3c58, 0xbfff, 0x2000, 0x9100 }, 16, 0x00085f60, 1},
-	{{0x0011, 0x3900, 0x2048, 0x8008, 0x1090, 0xe748, 0x31e8, 0x9fff, 0x30c8, 0x8410, 0x4011, 0x3284, 0x2fde, 0x8008, 0x0004, 0x386c }, 16, 0x00085f80, 1},
-	{{0x800a, 0x3364, 0x256a, 0x8008, 0x3284, 0x2e4c, 0x8008, 0x3880, 0x3a3c, 0x8009, 0x3264, 0x2d5a, 0x8008, 0x3880, 0x3a3c, 0x8009 }, 16, 0x00085fa0, 1},
-	{{0x33e4, 0x38ac, 0x8001, 0x32c4, 0x3d3c, 0x8008, 0x0004, 0x386c, 0x800a, 0x3264, 0x37c0, 0x8008, 0x0004, 0x386e, 0x800a, 0x9f7d }, 16, 0x00085fc0, 1},
-	{{0x0085, 0x3a37, 0x8009, 0x3460, 0x0886, 0x3a58, 0x8009, 0x6469, 0x8442, 0x92c3, 0xc981, 0x1990, 0x8002, 0x0c09, 0xa003, 0x8434 }, 16, 0x00085fe0, 1},
-	{{0x92c3, 0xc982, 0x1090, 0x80b0, 0x0c00, 0xa003, 0x8426, 0x92c3, 0xc983, 0x0c00, 0xa00c, 0x841c, 0x92c3, 0xc984, 0x1090, 0x807a }, 16, 0x00086000, 1},
-	{{0x0c00, 0xa007, 0x800d, 0x0c80, 0xa000, 0x8408, 0x92c3, 0xc985, 0xc986, 0x2c10, 0x3800, 0x2066, 0x8008, 0x09c1, 0x3e58, 0x8009 }, 16, 0x00086020, 1},
-	{{0x3244, 0x3a14, 0x8008, 0x4010, 0x33e4, 0x21a8, 0x8008, 0x33e4, 0x2720, 0x8008, 0x2c90, 0x38c0, 0x39f0, 0x8009, 0x2000, 0x8200 }, 16, 0x00086040, 1},
-	{{0x32e4, 0x3c8a, 0x8001, 0xf041, 0x00c5, 0x3e58, 0x8009, 0x3460, 0xc183, 0xd021, 0x8441, 0xc081, 0x0081, 0x3a5e, 0x8009, 0xc0a6 }, 16, 0x00086060, 1},
-	{{0x32e4, 0x3a68, 0x8001, 0x01c1, 0x3e59, 0x8009, 0x38a8, 0x3c20, 0xbfff, 0xc184, 0x1290, 0xc0a6, 0x2aff, 0x9d3b, 0x02c2, 0x3e10 }, 16, 0x00086080, 1},
-	{{0x8009, 0x3244, 0x34f8, 0x8008, 0x6c10, 0x3244, 0x34f8, 0x8008, 0x6c10, 0x880b, 0x3284, 0x3216, 0x8008, 0xe838, 0x9f7d, 0x1015 }, 16, 0x000860a0, 1},
-	{{0xa0e0, 0x90c0, 0x9f7c, 0x9f7c, 0xe768, 0x9f71, 0x2c90, 0x3800, 0x20e4, 0x8008, 0xe748, 0x2c90, 0x4110, 0x2000, 0x8070, 0xf041 }, 16, 0x000860c0, 1},
-	{{0x32e4, 0x3c8a, 0x8001, 0x0886, 0x3a54, 0x8009, 0x2c90, 0x3ac8, 0x3c00, 0xbfff, 0x3800, 0x2048, 0x8008, 0x1092, 0x3a00, 0x2064 }, 16, 0x000860e0, 1},
-	{{0x8008, 0x0090, 0x3800, 0x2060, 0x8008, 0x0112, 0x3a00, 0x2062, 0x8008, 0x0110, 0x38e8, 0x3c00, 0xbfff, 0x0112, 0x30f9, 0x3fff }, 16, 0x00086100, 1},
-	{{0xbff0, 0x1290, 0x39c8, 0x2428, 0xbfff, 0xdd00, 0x0912, 0xa009, 0x0290, 0x3ea8, 0x3c50, 0xbfff, 0x1091, 0x3f00, 0x2034, 0x8008 }, 16, 0x00086120, 1},
-	{{0x0900, 0xa080, 0x4091, 0x0101, 0x3c4a, 0x8008, 0x2c10, 0x0886, 0x3a54, 0x8009, 0xc186, 0x1290, 0x804c, 0x7941, 0x0200, 0x804c }, 16, 0x00086140, 1},
-	{{0x01c1, 0x3e58, 0x8009, 0x0001, 0x3a95, 0x800a, 0x0081, 0x3a5c, 0x8009, 0x9f7d, 0x1015, 0xa0e0, 0x90c0, 0x1115, 0xa0e0, 0x90c0 }, 16, 0x00086160, 1},
-	{{0x9f7c, 0x3800, 0x2028, 0x8008, 0xc0ae, 0x51d0, 0x3399, 0x800f, 0x0901, 0xa100, 0x2aff, 0x9b93, 0x4110, 0x2bff, 0x9c45, 0x2bff }, 16, 0x00086180, 1},
-	{{0x9d3d, 0x33c4, 0x2f56, 0x8008, 0x6c10, 0x2aff, 0x9d9f, 0x0000, 0x3a98, 0x800a, 0x3304, 0x351c, 0x8009, 0x38a8, 0x3c58, 0xbfff }, 16, 0x000861a0, 1},
-	{{0x90c0, 0x5090, 0x0ce0, 0xbfff, 0x841b, 0x1096, 0x3840, 0x2d29, 0x8009, 0x0d00, 0xa800, 0x800d, 0x33e4, 0x37da, 0x8001, 0x8806 }, 16, 0x000861c0, 1},
-	{{0xc68c, 0xc68b, 0x38a8, 0x3c58, 0xbfff, 0x90c0, 0x5090, 0x31f8, 0x9fff, 0x3410, 0x803f, 0x8065, 0x5090, 0x0ce0, 0xbfff, 0x840b }, 16, 0x000861e0, 1},
-	{{0x5096, 0x0d00, 0xa800, 0x8055, 0x2aff, 0x9b1f, 0xc09a, 0x32e4, 0x37da, 0x8001, 0x3840, 0x2d0f, 0x8009, 0x2aff, 0x9bbf, 0xc094 }, 16, 0x00086200, 1},
-	{{0x2aff, 0x9bb9, 0xc092, 0x2aff, 0x9bb3, 0xc0a2, 0x2aff, 0x9bad, 0xc0a6, 0x2aff, 0x9ba7, 0xc0aa, 0x2aff, 0x9ba1, 0xc0ac, 0x2aff }, 16, 0x00086220, 1},
-	{{0x9b9b, 0xc0ae, 0x2aff, 0x9b95, 0xc090, 0x2aff, 0x9b8f, 0xc09c, 0x6c10, 0x880a, 0x0081, 0x3a5c, 0x8009, 0x6f10, 0x2c90, 0x0886 }, 16, 0x00086240, 1},
-	{{0x3a54, 0x8009, 0x3041, 0x21aa, 0x8008, 0x0100, 0x8020, 0x0886, 0x3a54, 0x8009, 0x90c0, 0x0100, 0x8024, 0x0886, 0x3a54, 0x8009 }, 16, 0x00086260, 1},
-	{{0x90c0, 0x0100, 0x8026, 0x0886, 0x3a54, 0x8009, 0x90c0, 0x0100, 0x8028, 0x0886, 0x3a54, 0x8009, 0x90c0, 0x0100, 0x802a, 0x0886 }, 16, 0x00086280, 1},
-	{{0x3a54, 0x8009, 0x90c0, 0x0100, 0x802c, 0x0886, 0x3a54, 0x8009, 0x90c0, 0x0100, 0x8022, 0x0886, 0x3a54, 0x8009, 0x90c0, 0x0100 }, 16, 0x000862a0, 1},
-	{{0x8034, 0x0886, 0x3a54, 0x8009, 0x90c0, 0x0100, 0x802e, 0x0886, 0x3a54, 0x8009, 0x90c0, 0x0100, 0x803a, 0x0886, 0x3a54, 0x8009 }, 16, 0x000862c0, 1},
-	{{0x90c0, 0x0100, 0x803c, 0x0886, 0x3a54, 0x8009, 0x90c0, 0x0100, 0x803e, 0x0886, 0x3a54, 0x8009, 0x90c0, 0x0100, 0x8040, 0x0886 }, 16, 0x000862e0, 1},
-	{{0x3a54, 0x8009, 0x90c0, 0x0100, 0x8042, 0x0886, 0x3a54, 0x8009, 0x90c0, 0x0100, 0x8044, 0x0886, 0x3a54, 0x8009, 0x90c0, 0x0100 }, 16, 0x00086300, 1},
-	{{0x8046, 0x0886, 0x3a54, 0x8009, 0x90c0, 0x0100, 0x8048, 0x0886, 0x3a54, 0x8009, 0x90c0, 0x0100, 0x804a, 0x0617, 0x3800, 0x2032 }, 16, 0x00086320, 1},
-	{{0x8008, 0x90c0, 0x4110, 0x0185, 0x3a5c, 0x8009, 0x24e9, 0x0002, 0x3b30, 0x8008, 0x8453, 0x3284, 0x2976, 0x8008, 0x3800, 0x3c4c }, 16, 0x00086340, 1},
-	{{0x8008, 0x33e4, 0x2720, 0x8008, 0x33e4, 0x2394, 0x8008, 0x0085, 0x3a5d, 0x8009, 0x6469, 0x8011, 0x33e4, 0x3606, 0x8008, 0x6c10 }, 16, 0x00086360, 1},
-	{{0x0081, 0x3a5d, 0x8009, 0x32e4, 0x39f6, 0x8001, 0x2000, 0x83e8, 0x33c4, 0x27f8, 0x8008, 0x3384, 0x3574, 0x8008, 0x0085, 0x3a5c }, 16, 0x00086380, 1},
-	{{0x8009, 0x6469, 0x81b3, 0x33e4, 0x3a38, 0x8001, 0x2764, 0x9530, 0x90c0, 0x90c0, 0x90c8, 0x3264, 0x3610, 0x8008, 0xc081, 0x38c8 }, 16, 0x000863a0, 1},
-	{{0x2400, 0xbfff, 0x23c4, 0x8350, 0x2b03, 0x8008, 0xc082, 0x4090, 0x38c8, 0x2400, 0xbfff, 0x90c0, 0x5090, 0x0c00, 0xa007, 0x2dff }, 16, 0x000863c0, 1},
-	{{0x9d6f, 0x90c0, 0x90d0, 0x90c0, 0x90c0, 0x8d63, 0x33e4, 0x2010, 0x8008, 0x3908, 0x2914, 0xbff8, 0x10e0, 0x9ed0, 0x0091, 0x3a08 }, 16, 0x000863e0, 1},
-	{{0x2934, 0xbff8, 0x10e0, 0x9ed4, 0x0092, 0x3908, 0x2954, 0xbff8, 0x10e0, 0x9ed8, 0x0091, 0x3a08, 0x2974, 0xbff8, 0x10e0, 0x9edc }, 16, 0x00086400, 1},
-	{{0x9f70, 0x4092, 0xca40, 0xc8ba, 0x39c8, 0x3800, 0xbfff, 0xea38, 0xca49, 0xc081, 0x32c9, 0x87c1, 0xd411, 0x0091, 0xc081, 0x9f70 }, 16, 0x00086420, 1},
-	{{0x0081, 0x3a5d, 0x8009, 0xcb40, 0xc8ba, 0x39c8, 0x3800, 0xbfff, 0xeb38, 0xcb49, 0x32c9, 0x87c1, 0xc081, 0x3a00, 0x2042, 0x8008 }, 16, 0x00086440, 1},
-	{{0xd411, 0x0091, 0x39c8, 0x3c00, 0xbfff, 0x11d2, 0x3800, 0x2044, 0x8008, 0x38c1, 0xc081, 0x4112, 0x5191, 0x4190, 0x9f70, 0x0081 }, 16, 0x00086460, 1},
-	{{0x3a5c, 0x8009, 0x3124, 0x3f30, 0x8009, 0x2c90, 0x3ba0, 0x2680, 0x8009, 0x2704, 0x8040, 0x38a0, 0x2780, 0x8009, 0x39a0, 0x2700 }, 16, 0x00086480, 1},
-	{{0x8009, 0x3aa0, 0x2800, 0x8009, 0x94d0, 0x4119, 0x4118, 0x011a, 0x411b, 0x2c90, 0x3ba0, 0x3130, 0x8009, 0x2704, 0x8060, 0x38a0 }, 16, 0x000864a0, 1},
-	{{0x3070, 0x8009, 0x39a0, 0x2fb0, 0x8009, 0x3aa0, 0x2ef0, 0x8009, 0x94d0, 0x4119, 0x4118, 0x011a, 0x411b, 0x2469, 0x30a1, 0x2780 }, 16, 0x000864c0, 1},
-	{{0x8009, 0x31a1, 0x2700, 0x8009, 0x33a1, 0x2680, 0x8009, 0x32a1, 0x2800, 0x8009, 0x00a2, 0x2880, 0x8009, 0x01a2, 0x28b4, 0x8009 }, 16, 0x000864e0, 1},
-	{{0x01a2, 0x28b0, 0x8009, 0x00a2, 0x2884, 0x8009, 0x03a2, 0x2890, 0x8009, 0x03a2, 0x2894, 0x8009, 0x02a2, 0x28a0, 0x8009, 0x8012 }, 16, 0x00086500, 1},
-	{{0x02a2, 0x28a4, 0x8009, 0xc081, 0x8810, 0x3141, 0x3984, 0x8009, 0x2c10, 0x3141, 0x3904, 0x8009, 0x01a2, 0x2898, 0x8009, 0x01a2 }, 16, 0x00086520, 1},
-	{{0x2888, 0x8009, 0x01a2, 0x28b8, 0x8009, 0x01a2, 0x28a8, 0x8009, 0x00a0, 0x289c, 0x8009, 0x00a0, 0x288c, 0x8009, 0x00a0, 0x28bc }, 16, 0x00086540, 1},
-	{{0x8009, 0x9f70, 0x00a0, 0x28ac, 0x8009, 0x2bff, 0x9f1b, 0x2c90, 0x3ba0, 0x2d70, 0x8009, 0x2704, 0x8060, 0x38a0, 0x2a70, 0x8009 }, 16, 0x00086560, 1},
-	{{0x39a0, 0x2bf0, 0x8009, 0x3aa0, 0x28f0, 0x8009, 0x94d0, 0x4119, 0x4118, 0x011a, 0x411b, 0x6469, 0x8407, 0x2000, 0x814d, 0x38c8 }, 16, 0x00086580, 1},
-	{{0x3000, 0xbfff, 0x90c0, 0x1190, 0x38c8, 0x3008, 0xbfff, 0x0c01, 0xa001, 0x8037, 0x1290, 0xc183, 0x351a, 0x8fff, 0x30fa, 0x3ac8 }, 16, 0x000865a0, 1},
-	{{0x3000, 0xbfff, 0x8425, 0x2920, 0x8000, 0x38c8, 0x3008, 0xbfff, 0xe961, 0xe9f1, 0x8015, 0x5292, 0x0c02, 0xa001, 0x800d, 0x5290 }, 16, 0x000865c0, 1},
-	{{0x351a, 0x8fff, 0x70fa, 0x81eb, 0x39c8, 0x3000, 0xbfff, 0x38c8, 0x3400, 0xbfff, 0xc182, 0x4191, 0x1290, 0x38c8, 0x3408, 0xbfff }, 16, 0x000865e0, 1},
-	{{0x0c02, 0xa001, 0x8037, 0x1390, 0xc283, 0x371b, 0x8fff, 0x317b, 0x3ac8, 0x3400, 0xbfff, 0x8425, 0x2920, 0x8000, 0x38c8, 0x3408 }, 16, 0x00086600, 1},
-	{{0xbfff, 0xe961, 0xe9f1, 0x8015, 0x5392, 0x0c03, 0xa001, 0x800d, 0x5390, 0x371b, 0x8fff, 0x717b, 0x81eb, 0x2d90, 0x38c8, 0x3400 }, 16, 0x00086620, 1},
-	{{0xbfff, 0x311c, 0x80ff, 0x0190, 0xc281, 0x01a4, 0x31f6, 0x8009, 0x3411, 0x8030, 0xd544, 0xc490, 0x801e, 0x03a1, 0x31fc, 0x8009 }, 16, 0x00086640, 1},
-	{{0xd0b8, 0x8015, 0xd0b0, 0x8011, 0x2560, 0xc381, 0x256e, 0xc4a0, 0x03a1, 0x31fc, 0x8009, 0xc842, 0x21e0, 0x9f00, 0xe861, 0x3453 }, 16, 0x00086660, 1},
-	{{0xdc80, 0xc84e, 0x2aff, 0x9e07, 0xd741, 0x3cc8, 0x8049, 0x01a4, 0x31f6, 0x8009, 0x3ce3, 0x00a1, 0x3201, 0x8009, 0x3cc8, 0x804b }, 16, 0x00086680, 1},
-	{{0x00a1, 0x31fe, 0x8009, 0xd811, 0x3cca, 0x8048, 0x3400, 0x8004, 0x0d26, 0xa000, 0xc940, 0x02a1, 0x31ff, 0x8009, 0x3cca, 0x804a }, 16, 0x000866a0, 1},
-	{{0x09a0, 0x31fa, 0x8009, 0x8012, 0x02a1, 0x31fd, 0x8009, 0xe9f8, 0xe9fc, 0x09a0, 0x31fa, 0x8009, 0x3cc8, 0x8088, 0xe9f8, 0xd023 }, 16, 0x000866c0, 1},
-	{{0xe9fc, 0x8408, 0xc948, 0x7478, 0x7c41, 0x2d10, 0x2c90, 0x3880, 0x3a68, 0x8009, 0x0282, 0x3a60, 0x8009, 0x32ea, 0x805f, 0x0282 }, 16, 0x000866e0, 1},
-	{{0x3a60, 0x8009, 0x32ea, 0x805e, 0xc181, 0x0282, 0x3a60, 0x8009, 0x32ea, 0x805d, 0x3381, 0x3a80, 0x8009, 0x0282, 0x3a60, 0x8009 }, 16, 0x00086700, 1},
-	{{0x30ea, 0x8310, 0x0382, 0x3a64, 0x8009, 0x2d90, 0x0282, 0x3a60, 0x8009, 0x32ea, 0x804f, 0x0282, 0x3a60, 0x8009, 0x0382, 0x3a68 }, 16, 0x00086720, 1},
-	{{0x8009, 0x1290, 0x33a1, 0x2080, 0x8009, 0x32ea, 0x805f, 0x0290, 0xc94a, 0x5490, 0x32ec, 0x805e, 0x4490, 0x5490, 0x32ec, 0x805d }, 16, 0x00086740, 1},
-	{{0x4490, 0x5490, 0x30ec, 0x8310, 0x4490, 0x5090, 0x32e8, 0x804f, 0x4090, 0x3cc8, 0x808a, 0xd023, 0x840c, 0x0382, 0x3a6c, 0x8009 }, 16, 0x00086760, 1},
-	{{0x757a, 0x7d41, 0x2d90, 0x3a80, 0x3a78, 0x8009, 0x2c10, 0x0382, 0x3a70, 0x8009, 0x30eb, 0x805f, 0x0382, 0x3a70, 0x8009, 0x30eb }, 16, 0x00086780, 1},
-	{{0x805e, 0x0382, 0x3a70, 0x8009, 0x32eb, 0x805d, 0x0382, 0x3a70, 0x8009, 0x34eb, 0x8310, 0x0382, 0x3a70, 0x8009, 0x32eb, 0x804f }, 16, 0x000867a0, 1},
-	{{0x0382, 0x3a70, 0x8009, 0x33a1, 0x2380, 0x8009, 0x0382, 0x3a74, 0x8009, 0x0082, 0x3a78, 0x8009, 0x1092, 0x3381, 0x3d80, 0x8009 }, 16, 0x000867c0, 1},
-	{{0x32e8, 0x805f, 0x0092, 0x38c8, 0x3820, 0xbfff, 0x1492, 0xc0aa, 0x32ec, 0x805e, 0x0492, 0x3960, 0x288e, 0x8008, 0x5492, 0x32ec }, 16, 0x000867e0, 1},
-	{{0x805d, 0x4492, 0x5492, 0x34ec, 0x8310, 0x4492, 0x5292, 0x32ea, 0x804f, 0x4292, 0x0382, 0x3a7c, 0x8009, 0x3101, 0x2000, 0x8030 }, 16, 0x00086800, 1},
-	{{0x32e4, 0x3a5c, 0x8001, 0x4190, 0xc184, 0x32e4, 0x3a62, 0x8001, 0xc0aa, 0xc0ac, 0x32e4, 0x3a5c, 0x8001, 0x3960, 0x288e, 0x8008 }, 16, 0x00086820, 1},
-	{{0xc184, 0x32e4, 0x3a62, 0x8001, 0xc0ac, 0x9f7d, 0x38e8, 0x3c2c, 0xbfff, 0x0c06, 0xa300, 0x8014, 0x0690, 0x3080, 0x3a60, 0x8009 }, 16, 0x00086840, 1},
-	{{0x0900, 0xa001, 0x00a2, 0x28d8, 0x8009, 0x0c06, 0xac00, 0x8013, 0x3080, 0x3a70, 0x8009, 0x0900, 0xa001, 0x00a2, 0x28e0, 0x8009 }, 16, 0x00086860, 1},
-	{{0x9f7c, 0x3124, 0x3f50, 0x8009, 0x3164, 0x3ad8, 0x8008, 0x2bff, 0x9bf7, 0x0886, 0x3a58, 0x8009, 0x3410, 0x802a, 0x1000, 0x80b2 }, 16, 0x00086880, 1},
-	{{0x38a8, 0x3c20, 0xbfff, 0x311e, 0x8007, 0xe748, 0x2618, 0x81f6, 0x3ee8, 0x3c2c, 0xbfff, 0x1190, 0xc0aa, 0x32e4, 0x3a68, 0x8001 }, 16, 0x000868a0, 1},
-	{{0x01c2, 0x3e04, 0x8009, 0x08c6, 0x3e10, 0x8009, 0x0ac6, 0x3e04, 0x8009, 0x0986, 0x3a54, 0x8009, 0xea38, 0xba4a, 0x0a86, 0x3a54 }, 16, 0x000868c0, 1},
-	{{0x8009, 0x38c8, 0x3004, 0xbfff, 0x1092, 0x8030, 0x3841, 0x3980, 0x3a60, 0x8009, 0x0002, 0x8030, 0x5096, 0x5890, 0x3118, 0x8f00 }, 16, 0x000868e0, 1},
-	{{0xe9a8, 0xdc28, 0x8010, 0x96c2, 0x38a0, 0x2080, 0x8009, 0x3880, 0x3a80, 0x8009, 0x3118, 0x8003, 0xc940, 0xca82, 0xe961, 0xe98a }, 16, 0x00086900, 1},
-	{{0x2518, 0x8108, 0x3aa0, 0x28c0, 0x8009, 0x01a7, 0x31fa, 0x8009, 0xa9d1, 0x24ea, 0x00a7, 0x31fa, 0x8009, 0x9961, 0x84ed, 0x2b03 }, 16, 0x00086920, 1},
-	{{0x8012, 0x9b41, 0x39a0, 0x2d70, 0x8009, 0x00a6, 0x28dc, 0x8009, 0x5118, 0x30ca, 0x950c, 0x6d38, 0xd442, 0x30ca, 0x950c, 0x2cb8 }, 16, 0x00086940, 1},
-	{{0x00a2, 0x28dc, 0x8009, 0xd496, 0x64e1, 0x7cc8, 0x64e5, 0x92d0, 0x7cc8, 0x74d9, 0x4159, 0x88b3, 0x01a7, 0x31fa, 0x8009, 0x24ea }, 16, 0x00086960, 1},
-	{{0x39a0, 0x2a70, 0x8009, 0x84a3, 0x2b03, 0x800c, 0x9b41, 0x00a6, 0x28e4, 0x8009, 0x5118, 0x30ca, 0x950c, 0x6d38, 0xd442, 0x30ca }, 16, 0x00086980, 1},
-	{{0x950c, 0x2cb8, 0x00a2, 0x28e4, 0x8009, 0xd496, 0x64e1, 0x7cc8, 0x64e5, 0x92d0, 0x7cc8, 0x74d9, 0x4159, 0x886f, 0x246a, 0x3aa0 }, 16, 0x000869a0, 1},
-	{{0x2d70, 0x8009, 0x8465, 0x9b40, 0x2b03, 0x8010, 0x39a0, 0x2a70, 0x8009, 0x00a6, 0x28dc, 0x8009, 0x1118, 0x03a6, 0x28e4, 0x8009 }, 16, 0x000869c0, 1},
-	{{0x36cc, 0x950c, 0x2e24, 0x5218, 0xd5c4, 0x03a2, 0x28e4, 0x8009, 0x36cb, 0x950c, 0x6cb9, 0xd496, 0x64e1, 0x7cc8, 0x64e5, 0x30cb }, 16, 0x000869e0, 1},
-	{{0x950c, 0x3cc8, 0x6dbd, 0x34d9, 0xd443, 0x0159, 0x00a2, 0x28dc, 0x8009, 0x30c9, 0x950c, 0x6c98, 0xd496, 0x64e1, 0x7cc8, 0x64e5 }, 16, 0x00086a00, 1},
-	{{0x92d0, 0x7cc8, 0x74d9, 0x415a, 0x00a5, 0x31ff, 0x8009, 0x3460, 0x01a4, 0x289c, 0x8009, 0x2469, 0x38c1, 0x06a7, 0x31fa, 0x8009 }, 16, 0x00086a20, 1},
-	{{0x8022, 0xd719, 0x30a1, 0x2890, 0x8009, 0xf603, 0xf041, 0x1804, 0xa001, 0x39a0, 0x3130, 0x8009, 0x2aff, 0x9e31, 0x38a0, 0x2d70 }, 16, 0x00086a40, 1},
-	{{0x8009, 0x00a5, 0x3201, 0x8009, 0x3460, 0x39a0, 0x3070, 0x8009, 0x2469, 0x30a1, 0x2880, 0x8009, 0x8015, 0xf603, 0xf041, 0x1804 }, 16, 0x00086a60, 1},
-	{{0xa001, 0x2aff, 0x9e07, 0x38a0, 0x2a70, 0x8009, 0x00c5, 0x3e58, 0x8009, 0x7460, 0xd023, 0x2718, 0x81ea, 0x3384, 0x3306, 0x8008 }, 16, 0x00086a80, 1},
-	{{0x89e1, 0x1a90, 0x08c6, 0x3e10, 0x8009, 0x0986, 0x3a54, 0x8009, 0x0ac2, 0x3e08, 0x8009, 0xea38, 0xba4b, 0x0886, 0x3a54, 0x8009 }, 16, 0x00086aa0, 1},
-	{{0xc0ac, 0x1190, 0x8032, 0x78c1, 0x32e4, 0x3a68, 0x8001, 0x0100, 0x8032, 0x1096, 0x38c8, 0x3404, 0xbfff, 0x3118, 0x8f00, 0x1a90 }, 16, 0x00086ac0, 1},
-	{{0x3880, 0x3a70, 0x8009, 0xdc2a, 0xe8aa, 0xc940, 0x8010, 0x96c2, 0x3880, 0x3d80, 0x8009, 0x38a0, 0x2380, 0x8009, 0xca82, 0xe961 }, 16, 0x00086ae0, 1},
-	{{0xe98a, 0x2518, 0x8108, 0x3aa0, 0x28cc, 0x8009, 0x01a7, 0x31fa, 0x8009, 0xa9d1, 0x24ea, 0x00a7, 0x31fa, 0x8009, 0x9961, 0x84ed }, 16, 0x00086b00, 1},
-	{{0x2b03, 0x8012, 0x9b41, 0x39a0, 0x2bf0, 0x8009, 0x00a6, 0x28ec, 0x8009, 0x5118, 0x30ca, 0x950c, 0x6d38, 0xd442, 0x30ca, 0x950c }, 16, 0x00086b20, 1},
-	{{0x2cb8, 0x00a2, 0x28ec, 0x8009, 0xd496, 0x64e1, 0x7cc8, 0x64e5, 0x92d0, 0x7cc8, 0x74d9, 0x4159, 0x88b3, 0x01a7, 0x31fa, 0x8009 }, 16, 0x00086b40, 1},
-	{{0x24ea, 0x39a0, 0x28f0, 0x8009, 0x84a3, 0x2b03, 0x800c, 0x9b41, 0x00a6, 0x28e8, 0x8009, 0x5118, 0x30ca, 0x950c, 0x6d38, 0xd442 }, 16, 0x00086b60, 1},
-	{{0x30ca, 0x950c, 0x2cb8, 0x00a2, 0x28e8, 0x8009, 0xd496, 0x64e1, 0x7cc8, 0x64e5, 0x92d0, 0x7cc8, 0x74d9, 0x4159, 0x886f, 0x246a }, 16, 0x00086b80, 1},
-	{{0x3aa0, 0x2bf0, 0x8009, 0x8465, 0x9b40, 0x2b03, 0x8010, 0x39a0, 0x28f0, 0x8009, 0x00a6, 0x28ec, 0x8009, 0x1118, 0x03a6, 0x28e8 }, 16, 0x00086ba0, 1},
-	{{0x8009, 0x36cc, 0x950c, 0x2e24, 0x5218, 0xd5c4, 0x03a2, 0x28e8, 0x8009, 0x36cb, 0x950c, 0x6cb9, 0xd496, 0x64e1, 0x7cc8, 0x64e5 }, 16, 0x00086bc0, 1},
-	{{0x30cb, 0x950c, 0x3cc8, 0x6dbd, 0x34d9, 0xd443, 0x0159, 0x00a2, 0x28ec, 0x8009, 0x30c9, 0x950c, 0x6c98, 0xd496, 0x64e1, 0x7cc8 }, 16, 0x00086be0, 1},
-	{{0x64e5, 0x92d0, 0x7cc8, 0x74d9, 0x415a, 0x00a5, 0x31fd, 0x8009, 0x3460, 0x01a4, 0x28bc, 0x8009, 0x2469, 0x38c1, 0x06a7, 0x31fa }, 16, 0x00086c00, 1},
-	{{0x8009, 0x8022, 0xd719, 0x30a1, 0x28b0, 0x8009, 0xf603, 0xf041, 0x1804, 0xa001, 0x39a0, 0x2fb0, 0x8009, 0x2aff, 0x9c4f, 0x38a0 }, 16, 0x00086c20, 1},
-	{{0x2bf0, 0x8009, 0x00a5, 0x31fe, 0x8009, 0x3460, 0x39a0, 0x2ef0, 0x8009, 0x2469, 0x30a1, 0x28a0, 0x8009, 0x8015, 0xf603, 0xf041 }, 16, 0x00086c40, 1},
-	{{0x1804, 0xa001, 0x2aff, 0x9c25, 0x38a0, 0x28f0, 0x8009, 0x00c5, 0x3e58, 0x8009, 0x7460, 0xd024, 0x8409, 0x3384, 0x3306, 0x8008 }, 16, 0x00086c60, 1},
-	{{0x3024, 0x3f50, 0x8009, 0xe768, 0x0104, 0x3a34, 0x800a, 0x3411, 0x8030, 0xe748, 0x801e, 0xf004, 0x3411, 0x8060, 0x800f, 0x3411 }, 16, 0x00086c80, 1},
-	{{0x8020, 0x841f, 0x7440, 0x8816, 0xd810, 0x7440, 0xd810, 0x00fe, 0x9ff8, 0x2121, 0x8aaa, 0x00fc, 0x9ff8, 0x6431, 0x00fe, 0x9ff8 }, 16, 0x00086ca0, 1},
-	{{0xf184, 0x3081, 0x2937, 0x8000, 0xd911, 0x3443, 0x8000, 0xd81b, 0x2200, 0x8041, 0x2818, 0xe768, 0x7c4d, 0x36c9, 0x8343, 0x6461 }, 16, 0x00086cc0, 1},
-	{{0x9f70, 0xd441, 0x3550, 0x2460, 0x3111, 0x2000, 0x8000, 0x30e0, 0x2566, 0xc941, 0x92c2, 0x6d10, 0x0c52, 0xa000, 0x800b, 0xc842 }, 16, 0x00086ce0, 1},
-	{{0x90c0, 0xe938, 0xc94a, 0x3108, 0x2000, 0x8000, 0x70e2, 0x8409, 0x32e0, 0x3fff, 0xbfff, 0x2461, 0x0966, 0x3fb8, 0x8004, 0x34c9 }, 16, 0x00086d00, 1},
-	{{0x9296, 0x3cc1, 0x6468, 0xc841, 0x31e1, 0x3fff, 0x803f, 0xe918, 0x1011, 0x0966, 0x3fbc, 0x8004, 0xdc82, 0xd810, 0x2461, 0xe819 }, 16, 0x00086d20, 1},
-	{{0x32c9, 0x8647, 0x1250, 0xd891, 0x6018, 0x92c3, 0x6464, 0x7448, 0x9f70, 0xd818, 0x3184, 0x357c, 0x8008, 0x3324, 0x3f30, 0x8009 }, 16, 0x00086d40, 1},
-	{{0x39c8, 0x2400, 0xbfff, 0xeee8, 0x1091, 0xe748, 0x0c00, 0xa007, 0x8027, 0x38c8, 0x2400, 0xbfff, 0x23c4, 0x8350, 0x2b03, 0x8008 }, 16, 0x00086d60, 1},
-	{{0xc082, 0x4090, 0x5090, 0x0c00, 0xa007, 0x8407, 0x2003, 0x800a, 0x90d0, 0x90c0, 0x90c0, 0x1096, 0x0886, 0x3a58, 0x8009, 0x00a2 }, 16, 0x00086d80, 1},
-	{{0x35a4, 0x8009, 0x1090, 0x8010, 0x3118, 0x80ff, 0x3c42, 0x39c0, 0x3e5c, 0x8009, 0xca40, 0x90c0, 0xea19, 0x5092, 0x00a2, 0x3580 }, 16, 0x00086da0, 1},
-	{{0x8009, 0x1090, 0x8010, 0x30c8, 0x8208, 0xca40, 0x90c0, 0xa0ca, 0x00a2, 0x3584, 0x8009, 0x1090, 0x8038, 0x3118, 0x80ff, 0x8376 }, 16, 0x00086dc0, 1},
-	{{0x7460, 0x0886, 0x3a58, 0x8009, 0x00a0, 0x3588, 0x8009, 0x1090, 0x8038, 0x30c8, 0x8208, 0x835e, 0x7460, 0x0886, 0x3a58, 0x8009 }, 16, 0x00086de0, 1},
-	{{0x00a0, 0x358a, 0x8009, 0x1090, 0x8012, 0x3118, 0x80ff, 0x3c42, 0x39c0, 0x3e5c, 0x8009, 0xca40, 0x90c0, 0xea19, 0x5092, 0x00a2 }, 16, 0x00086e00, 1},
-	{{0x358c, 0x8009, 0x1090, 0x8012, 0x30c8, 0x8208, 0xca40, 0x90c0, 0xa0ca, 0x00a2, 0x3590, 0x8009, 0x1090, 0x803a, 0x3118, 0x80ff }, 16, 0x00086e20, 1},
-	{{0x2aff, 0x9f15, 0x7460, 0x0886, 0x3a58, 0x8009, 0x00a0, 0x3594, 0x8009, 0x1090, 0x803a, 0x30c8, 0x8208, 0x2aff, 0x9efb, 0x7460 }, 16, 0x00086e40, 1},
-	{{0x2d90, 0x31a1, 0x3580, 0x8009, 0x2704, 0x8060, 0x32a1, 0x358c, 0x8009, 0x39a0, 0x3218, 0x8009, 0x38a0, 0x3398, 0x8009, 0x01a2 }, 16, 0x00086e60, 1},
-	{{0x359c, 0x8009, 0x00a0, 0x3596, 0x8009, 0x02a2, 0x35a0, 0x8009, 0x94c8, 0x4398, 0x4399, 0x08a6, 0x35a4, 0x8009, 0x3001, 0x2605 }, 16, 0x00086e80, 1},
-	{{0x8020, 0xe8f1, 0x8409, 0x00a2, 0x35a4, 0x8009, 0x00a6, 0x35a4, 0x8009, 0x3119, 0x8300, 0x310a, 0x8030, 0x3001, 0x2000, 0x8030 }, 16, 0x00086ea0, 1},
-	{{0x3062, 0xdca8, 0x92c3, 0x6c10, 0x92c2, 0xc081, 0xd0a2, 0x8010, 0x00a1, 0x37b7, 0x8009, 0xd0a1, 0x840d, 0x880c, 0xc8a0, 0x8808 }, 16, 0x00086ec0, 1},
-	{{0x2800, 0x8060, 0xc890, 0x2469, 0x08a0, 0x37b0, 0x8009, 0xe8f8, 0xe8fc, 0x8008, 0xc849, 0x74f9, 0x7cc1, 0x2c10, 0x2d90, 0x2e10 }, 16, 0x00086ee0, 1},
-	{{0xc281, 0x00a2, 0x3208, 0x8009, 0x36e8, 0x805f, 0x00a2, 0x3208, 0x8009, 0x36e8, 0x805e, 0x00a2, 0x3208, 0x8009, 0x34e8, 0x805d }, 16, 0x00086f00, 1},
-	{{0x00a2, 0x3208, 0x8009, 0x32e8, 0x8310, 0x00a2, 0x3208, 0x8009, 0x33a1, 0x3218, 0x8009, 0x38e8, 0x804f, 0x03a2, 0x320c, 0x8009 }, 16, 0x00086f20, 1},
-	{{0x2d90, 0x00a2, 0x3208, 0x8009, 0x30a1, 0x3210, 0x8009, 0x2d90, 0x03a2, 0x3210, 0x8009, 0xc840, 0xc0ae, 0x1590, 0x34a1, 0x3398 }, 16, 0x00086f40, 1},
-	{{0x8009, 0x34ed, 0x805f, 0x4590, 0x5590, 0x34ed, 0x805e, 0x4590, 0x5590, 0x34ed, 0x805d, 0x4590, 0x5290, 0x32ea, 0x8310, 0x4290 }, 16, 0x00086f60, 1},
-	{{0x5190, 0x36e9, 0x804f, 0x4190, 0x32e4, 0x3a68, 0x8001, 0x04a2, 0x3214, 0x8009, 0xc0ae, 0x32e4, 0x3a5c, 0x8001, 0x3960, 0x325e }, 16, 0x00086f80, 1},
-	{{0x8008, 0xc184, 0x32e4, 0x3a62, 0x8001, 0xc0ae, 0x9f7d, 0x38c8, 0x2418, 0xbfff, 0x31f9, 0x3fff, 0xbfef, 0x5090, 0x0d10, 0xa010 }, 16, 0x00086fa0, 1},
-	{{0x800f, 0x00a6, 0x35a4, 0x8009, 0xdc80, 0x880c, 0x4190, 0x00a6, 0x35a4, 0x8009, 0x4090, 0x38c8, 0x2418, 0xbfff, 0x31f9, 0x3fff }, 16, 0x00086fc0, 1},
-	{{0xbfdf, 0x1090, 0x38c8, 0x2418, 0xbfff, 0x0d10, 0xa020, 0x800f, 0x00a6, 0x35a4, 0x8009, 0xdc80, 0x8812, 0x4190, 0x38c8, 0x2418 }, 16, 0x00086fe0, 1},
-	{{0xbfff, 0x00a6, 0x35a4, 0x8009, 0x4090, 0x2c90, 0x38c8, 0x241c, 0xbfff, 0xb2f1, 0x0290, 0xc0b0, 0xf041, 0x32e4, 0x3c8a, 0x8001 }, 16, 0x00087000, 1},
-	{{0x38a0, 0x3518, 0x8009, 0x38c8, 0x241c, 0xbfff, 0x31a0, 0x3208, 0x8009, 0x1090, 0xe9e8, 0x3118, 0x8f00, 0xdc28, 0x00a0, 0x351c }, 16, 0x00087020, 1},
-	{{0x8009, 0x00a0, 0x351a, 0x8009, 0x5090, 0x31f8, 0x9000, 0xdc2c, 0x00a0, 0x3528, 0x8009, 0x00a0, 0x3526, 0x8009, 0x1090, 0x38e8 }, 16, 0x00087040, 1},
-	{{0x3c30, 0xbfff, 0x3108, 0x800f, 0xd808, 0x00a0, 0x3534, 0x8009, 0x00a0, 0x3532, 0x8009, 0x5091, 0x3108, 0x80f0, 0xdc34, 0x00a0 }, 16, 0x00087060, 1},
-	{{0x3540, 0x8009, 0x00a0, 0x353e, 0x8009, 0x3009, 0x20ff, 0x9f55, 0x4090, 0x00a6, 0x35a4, 0x8009, 0x0c10, 0xa030, 0x8015, 0xc083 }, 16, 0x00087080, 1},
-	{{0x0901, 0xa001, 0x01a2, 0x3598, 0x8009, 0x00a1, 0x37b5, 0x8009, 0x9f7c, 0x00a7, 0x37b0, 0x8009, 0x32e4, 0x3c48, 0x8001, 0x0104 }, 16, 0x000870a0, 1},
-	{{0x386e, 0x800a, 0x3770, 0x37d0, 0x2c90, 0x39a0, 0x376c, 0x8009, 0xd321, 0x807d, 0xf702, 0xf142, 0x1801, 0xa020, 0x3264, 0x3708 }, 16, 0x000870c0, 1},
-	{{0x8008, 0x38a0, 0x3564, 0x8009, 0x2c10, 0xf702, 0xf042, 0x1801, 0xa020, 0x39a0, 0x372c, 0x8009, 0x3264, 0x3708, 0x8008, 0x38a0 }, 16, 0x000870e0, 1},
-	{{0x3548, 0x8009, 0x2c10, 0xd326, 0x8421, 0x3141, 0x36c4, 0x8009, 0x01a2, 0x356c, 0x8009, 0x01a2, 0x3550, 0x8009, 0x00a0, 0x357e }, 16, 0x00087100, 1},
-	{{0x8009, 0x00a0, 0x3562, 0x8009, 0x2c10, 0xd323, 0x8431, 0x3141, 0x3844, 0x8009, 0x01a2, 0x356c, 0x8009, 0x01a2, 0x3550, 0x8009 }, 16, 0x00087120, 1},
-	{{0x00a0, 0x357e, 0x8009, 0x8816, 0x00a0, 0x3562, 0x8009, 0xc081, 0x00a0, 0x3576, 0x8009, 0x00a0, 0x355a, 0x8009, 0x2c90, 0xc081 }, 16, 0x00087140, 1},
-	{{0x01a1, 0x37b4, 0x8009, 0x00a1, 0x37b6, 0x8009, 0xe768, 0x3024, 0x3f50, 0x8009, 0x01a0, 0x37b2, 0x8009, 0x0886, 0x3a58, 0x8009 }, 16, 0x00087160, 1},
-	{{0x90c0, 0x1090, 0x8038, 0x3118, 0x80ff, 0x2aff, 0x9bcb, 0x7460, 0x08a6, 0x359c, 0x8009, 0x90c0, 0xb004, 0x0886, 0x3a58, 0x8009 }, 16, 0x00087180, 1},
-	{{0x90c0, 0x1090, 0x8038, 0x30c8, 0x8208, 0x2aff, 0x9bab, 0x7460, 0x08a6, 0x359c, 0x8009, 0x90c0, 0xb005, 0x0886, 0x3a58, 0x8009 }, 16, 0x000871a0, 1},
-	{{0x90c0, 0x1090, 0x803a, 0x3118, 0x80ff, 0x2aff, 0x9b8b, 0x7460, 0x08a6, 0x35a0, 0x8009, 0x90c0, 0xb004, 0x0886, 0x3a58, 0x8009 }, 16, 0x000871c0, 1},
-	{{0x90c0, 0x1090, 0x803a, 0x30c8, 0x8208, 0x2aff, 0x9b6b, 0x7460, 0x09a6, 0x35a0, 0x8009, 0x9f70, 0xb00d, 0x00a5, 0x37b4, 0x8009 }, 16, 0x000871e0, 1},
-	{{0x6469, 0x802b, 0x01a4, 0x37b2, 0x8009, 0x00a4, 0x37ae, 0x8009, 0x6c11, 0x00a0, 0x37b2, 0x8009, 0x00a4, 0x37b2, 0x8009, 0x2468 }, 16, 0x00087200, 1},
-	{{0x6c10, 0x803b, 0x8832, 0x00a0, 0x37b2, 0x8009, 0x01a4, 0x37ae, 0x8009, 0x00a4, 0x37b2, 0x8009, 0x6c51, 0x00a0, 0x37b2, 0x8009 }, 16, 0x00087220, 1},
-	{{0x00a4, 0x37b2, 0x8009, 0x6468, 0x8015, 0x2060, 0x9fff, 0x2c10, 0x00a0, 0x37b2, 0x8009, 0x00a1, 0x37b6, 0x8009, 0x9f71, 0x3324 }, 16, 0x00087240, 1},
-	{{0x3f30, 0x8009, 0x38a8, 0x3c20, 0xbfff, 0xe750, 0x1090, 0x3ea0, 0x366c, 0x8009, 0x00c2, 0x3e2c, 0x8009, 0xc0ae, 0x32e4, 0x3a68 }, 16, 0x00087260, 1},
-	{{0x8001, 0x3fa0, 0x35ac, 0x8009, 0x08c6, 0x3e10, 0x8009, 0x0ac6, 0x3e2c, 0x8009, 0x0986, 0x3a54, 0x8009, 0xea38, 0xba4c, 0x0886 }, 16, 0x00087280, 1},
-	{{0x3a54, 0x8009, 0x90c0, 0x1090, 0x8034, 0x7841, 0x0000, 0x8034, 0x00c5, 0x3e58, 0x8009, 0x7460, 0xd022, 0x8409, 0x3384, 0x3306 }, 16, 0x000872a0, 1},
-	{{0x8008, 0x2bff, 0x9eb9, 0x38c8, 0x3c14, 0xbfff, 0x3b80, 0x341c, 0x8009, 0x1090, 0x3880, 0x389c, 0x8009, 0x2c10, 0x0c10, 0xa100 }, 16, 0x000872c0, 1},
-	{{0x801d, 0x2704, 0x8060, 0x3980, 0x365c, 0x8009, 0x3a80, 0x34dc, 0x8009, 0x94d0, 0x4019, 0x4018, 0x001a, 0x401b, 0x08a6, 0x359c }, 16, 0x000872e0, 1},
-	{{0x8009, 0x0204, 0x386e, 0x800a, 0x1990, 0xf206, 0xb185, 0xb384, 0xb0c1, 0xf105, 0xf042, 0xf301, 0x1807, 0xa001, 0x32e4, 0x203c }, 16, 0x00087300, 1},
-	{{0x8008, 0x38a0, 0x366c, 0x8009, 0x08a6, 0x35a0, 0x8009, 0x0204, 0x386e, 0x800a, 0x1990, 0xf206, 0xb185, 0xb384, 0xb0c1, 0xf105 }, 16, 0x00087320, 1},
-	{{0xf042, 0xf301, 0x1807, 0xa001, 0x32e4, 0x203c, 0x8008, 0x38a0, 0x35ac, 0x8009, 0x3304, 0x3a9a, 0x8009, 0x3304, 0x3aa6, 0x8009 }, 16, 0x00087340, 1},
-	{{0x00a6, 0x35a4, 0x8009, 0x0c10, 0xa010, 0x8035, 0x00a4, 0x3576, 0x8009, 0xd021, 0x802b, 0x0004, 0x386e, 0x800a, 0xf001, 0x31c1 }, 16, 0x00087360, 1},
-	{{0x34e8, 0x8009, 0x39a0, 0x366c, 0x8009, 0x38a0, 0x3564, 0x8009, 0x3264, 0x3a12, 0x8008, 0x01a2, 0x3570, 0x8009, 0xeee8, 0x00a6 }, 16, 0x00087380, 1},
-	{{0x35a4, 0x8009, 0x0c10, 0xa020, 0x8035, 0x00a4, 0x355a, 0x8009, 0xd021, 0x802b, 0x0004, 0x386e, 0x800a, 0xf001, 0x31a1, 0x366c }, 16, 0x000873a0, 1},
-	{{0x8009, 0x39a0, 0x35ac, 0x8009, 0x38a0, 0x3548, 0x8009, 0x3264, 0x3a12, 0x8008, 0x01a2, 0x3554, 0x8009, 0xefe8, 0x39c8, 0x2404 }, 16, 0x000873c0, 1},
-	{{0xbfff, 0x38a0, 0x3208, 0x8009, 0x5991, 0x90c0, 0xe8a9, 0x8010, 0x96c2, 0x39a0, 0x3398, 0x8009, 0x39a0, 0x3218, 0x8009, 0x2e10 }, 16, 0x000873e0, 1},
-	{{0x00a5, 0x37b6, 0x8009, 0x2469, 0x36d4, 0xc381, 0x2518, 0x815c, 0x0886, 0x3a58, 0x8009, 0xc087, 0x1100, 0x80a4, 0x2d7c, 0x02a7 }, 16, 0x00087400, 1},
-	{{0x37b0, 0x8009, 0x7655, 0x6c7d, 0xd594, 0x3660, 0x8002, 0x00a2, 0x35a8, 0x8009, 0x00a6, 0x35a8, 0x8009, 0x3670, 0x9ffe, 0x8407 }, 16, 0x00087420, 1},
-	{{0x881a, 0xc081, 0x3081, 0x2000, 0x8000, 0x32e4, 0x3c48, 0x8001, 0x3478, 0x01a6, 0x35a8, 0x8009, 0x6560, 0x00a0, 0x37ae, 0x8009 }, 16, 0x00087440, 1},
-	{{0x00a5, 0x37b7, 0x8009, 0x2469, 0x00a6, 0x35a4, 0x8009, 0x8073, 0x256a, 0x00a4, 0x3536, 0x8009, 0x2718, 0x8190, 0x04a4, 0x3542 }, 16, 0x00087460, 1},
-	{{0x8009, 0x2c7c, 0x01a4, 0x351e, 0x8009, 0x05a4, 0x352a, 0x8009, 0x6d7c, 0x131f, 0x00a4, 0x37b2, 0x8009, 0xd59c, 0x3461, 0x8000 }, 16, 0x00087480, 1},
-	{{0x3061, 0x8000, 0x3660, 0x8000, 0xd891, 0xd4c0, 0x32c8, 0x944f, 0x0019, 0x00a4, 0x37b2, 0x8009, 0x531e, 0xd59d, 0x3461, 0x8000 }, 16, 0x000874a0, 1},
-	{{0x3061, 0x8000, 0x3660, 0x8000, 0xd891, 0xd4c0, 0x32c8, 0x944f, 0x2aff, 0x9d2b, 0x4019, 0x6561, 0x7961, 0x656a, 0x81b7, 0x892b }, 16, 0x000874c0, 1},
-	{{0x0c10, 0xa010, 0x8045, 0x256a, 0x00a4, 0x351e, 0x8009, 0x2718, 0x811a, 0x04a4, 0x352a, 0x8009, 0x6c7c, 0x131e, 0x00a4, 0x37b2 }, 16, 0x000874e0, 1},
-	{{0x8009, 0xd59c, 0x3461, 0x8000, 0x3061, 0x8000, 0x3660, 0x8000, 0xd891, 0xd4c0, 0x32c8, 0x944f, 0x2aff, 0x9ce3, 0x4019, 0x6561 }, 16, 0x00087500, 1},
-	{{0x7961, 0x656a, 0x81d7, 0x88e3, 0x256a, 0x00a4, 0x3536, 0x8009, 0x84d9, 0x04a4, 0x3542, 0x8009, 0x6c7c, 0x131f, 0x00a4, 0x37b2 }, 16, 0x00087520, 1},
-	{{0x8009, 0xd59c, 0x3461, 0x8000, 0x3061, 0x8000, 0x3660, 0x8000, 0xd891, 0xd4c0, 0x32c8, 0x944f, 0x2aff, 0x9ca3, 0x4019, 0x6561 }, 16, 0x00087540, 1},
-	{{0x7961, 0x656a, 0x81d7, 0x88a3, 0x00a5, 0x37b7, 0x8009, 0x2469, 0x01a7, 0x37b0, 0x8009, 0x8039, 0x24ea, 0x00a4, 0x3536, 0x8009 }, 16, 0x00087560, 1},
-	{{0x8489, 0x9b41, 0x2b03, 0x801a, 0x04a4, 0x3542, 0x8009, 0x2c7c, 0x01a4, 0x351e, 0x8009, 0x05a4, 0x352a, 0x8009, 0x6d7c, 0x501f }, 16, 0x00087580, 1},
-	{{0xd41c, 0x4019, 0x92d0, 0x501e, 0xd41d, 0x4019, 0x885d, 0x00a6, 0x35a4, 0x8009, 0x0c10, 0xa010, 0x802b, 0x01a7, 0x37b0, 0x8009 }, 16, 0x000875a0, 1},
-	{{0x24ea, 0x00a4, 0x351e, 0x8009, 0x8441, 0x2b03, 0x800e, 0x9b41, 0x04a4, 0x352a, 0x8009, 0x6c7c, 0x92d0, 0x501e, 0xd41c, 0x4019 }, 16, 0x000875c0, 1},
-	{{0x8829, 0x01a7, 0x37b0, 0x8009, 0x24ea, 0x00a4, 0x3536, 0x8009, 0x8419, 0x2b03, 0x800e, 0x9b41, 0x04a4, 0x3542, 0x8009, 0x6c7c }, 16, 0x000875e0, 1},
-	{{0x92d0, 0x501f, 0xd41c, 0x4019, 0x3024, 0x3f50, 0x8009, 0xe770, 0x01a7, 0x37ac, 0x8009, 0x24e9, 0x6c90, 0x8053, 0x00a1, 0x37b4 }, 16, 0x00087600, 1},
-	{{0x8009, 0xc081, 0x00a1, 0x37b6, 0x8009, 0x2000, 0x83e8, 0x32e4, 0x39f6, 0x8001, 0x01a0, 0x37ac, 0x8009, 0x00a5, 0x37b6, 0x8009 }, 16, 0x00087620, 1},
-	{{0xd021, 0x8421, 0x38c8, 0x3c0c, 0xbfff, 0x2000, 0x8064, 0x5190, 0x33f9, 0x9fff, 0x7079, 0x800d, 0x01a5, 0x37b6, 0x8009, 0xd0a1 }, 16, 0x00087640, 1},
-	{{0x81ef, 0x32e4, 0x39f6, 0x8001, 0x2000, 0x83e8, 0x9f71, 0x3124, 0x3f30, 0x8009, 0x0990, 0xf185, 0x24ea, 0xc0a0, 0xb941, 0x0100 }, 16, 0x00087660, 1},
-	{{0x8010, 0x8410, 0x0000, 0x8016, 0x9f41, 0x6c90, 0x90c0, 0x92c8, 0x4119, 0xf1c4, 0x64e9, 0x8409, 0x31c1, 0x34e8, 0x8009, 0x2304 }, 16, 0x00087680, 1},
-	{{0x8060, 0x2b03, 0x800a, 0xb143, 0x2d10, 0x6c90, 0x3942, 0xc942, 0xbac3, 0x90d0, 0xea19, 0x4112, 0xf286, 0xd121, 0x8042, 0x0200 }, 16, 0x000876a0, 1},
-	{{0x8012, 0xd123, 0x8017, 0xd126, 0x8423, 0x0066, 0x3fa0, 0x8004, 0xb042, 0x2000, 0x80c0, 0x8828, 0xc182, 0x0066, 0x3fa4, 0x8004 }, 16, 0x000876c0, 1},
-	{{0xb042, 0x2000, 0x8060, 0x8818, 0xc181, 0xc082, 0x0000, 0x8012, 0x0066, 0x3fa8, 0x8004, 0xb042, 0x2000, 0x8040, 0xc181, 0x0100 }, 16, 0x000876e0, 1},
-	{{0x8014, 0x9f70, 0x0000, 0x8018, 0x0990, 0xf185, 0x24ea, 0xc0a0, 0xb941, 0x0100, 0x8010, 0x8410, 0x0000, 0x8016, 0x9f41, 0x6c90 }, 16, 0x00087700, 1},
-	{{0x90c0, 0x92c8, 0x4119, 0xf1c4, 0x64e9, 0x8409, 0x31c1, 0x34e8, 0x8009, 0x2304, 0x8060, 0x2b03, 0x800a, 0xb143, 0x2d10, 0x6c90 }, 16, 0x00087720, 1},
-	{{0x3942, 0xc942, 0xbac3, 0x90d0, 0xea19, 0x4112, 0xf286, 0xd121, 0x8046, 0x0200, 0x8012, 0xd123, 0x8023, 0xd126, 0x8441, 0x0266 }, 16, 0x00087740, 1},
-	{{0x3fa0, 0x8004, 0xc082, 0x2140, 0x8000, 0x0000, 0x8014, 0xb242, 0x2000, 0x80c0, 0x8846, 0x0100, 0x801a, 0x0266, 0x3fa4, 0x8004 }, 16, 0x00087760, 1},
-	{{0xc081, 0x2140, 0x8000, 0x0000, 0x8014, 0xb242, 0x2000, 0x8060, 0x882a, 0x0100, 0x801a, 0x8824, 0x0100, 0x8014, 0x2c90, 0xc082 }, 16, 0x00087780, 1},
-	{{0x0000, 0x8012, 0x0266, 0x3fa8, 0x8004, 0xc081, 0x0000, 0x8014, 0xb242, 0x2000, 0x8040, 0x0100, 0x801a, 0x9f70, 0x0000, 0x8018 }, 16, 0x000877a0, 1},
-	{{0x0004, 0x386e, 0x800a, 0x3610, 0x8020, 0x84c6, 0xe748, 0x3410, 0x8040, 0x8008, 0x92c2, 0xc382, 0xc383, 0x3001, 0x20d8, 0x800a }, 16, 0x000877c0, 1},
-	{{0xf042, 0xf302, 0x1801, 0xa0c0, 0x39c0, 0x2a00, 0x8009, 0x2aff, 0x9e87, 0x38c0, 0x3304, 0x8009, 0x30e1, 0x3dd8, 0x8009, 0xf042 }, 16, 0x000877e0, 1},
-	{{0xf302, 0x1801, 0xa0c0, 0x39c0, 0x2e00, 0x8009, 0x2aff, 0x9e69, 0x38c0, 0x3294, 0x8009, 0x3001, 0x2018, 0x800a, 0xf042, 0xf302 }, 16, 0x00087800, 1},
-	{{0x1801, 0xa0c0, 0x39c0, 0x2600, 0x8009, 0x2aff, 0x9e4b, 0x38c0, 0x3240, 0x8009, 0x30e1, 0x3e98, 0x8009, 0xf042, 0xf302, 0x1801 }, 16, 0x00087820, 1},
-	{{0xa0c0, 0x39a0, 0x3e00, 0x8009, 0x2aff, 0x9e2d, 0x38c0, 0x3400, 0x8009, 0x3001, 0x23d8, 0x800a, 0xf042, 0xf302, 0x1801, 0xa020 }, 16, 0x00087840, 1},
-	{{0x39c0, 0x3080, 0x8009, 0x2aff, 0x9ea3, 0x38c0, 0x33c8, 0x8009, 0x3001, 0x2198, 0x800a, 0xf042, 0xf302, 0x1801, 0xa020, 0x39c0 }, 16, 0x00087860, 1},
-	{{0x31c0, 0x8009, 0x2aff, 0x9e85, 0x38c0, 0x3374, 0x8009, 0x8829, 0xc081, 0x00c0, 0x33da, 0x8009, 0x00c0, 0x3386, 0x8009, 0x00c0 }, 16, 0x00087880, 1},
-	{{0x3316, 0x8009, 0x00c0, 0x32a6, 0x8009, 0x00c0, 0x3252, 0x8009, 0x00c0, 0x3412, 0x8009, 0xe768, 0x9f71, 0x2bff, 0x9db5, 0x37d1 }, 16, 0x000878a0, 1},
-	{{0xd028, 0xe748, 0x8008, 0x92c2, 0xc382, 0xc381, 0x2600, 0x80c0, 0xc484, 0xc5a0, 0x3bc0, 0x3220, 0x8009, 0x3cc0, 0x34d8, 0x8009 }, 16, 0x000878c0, 1},
-	{{0x3dc0, 0x3200, 0x8009, 0x3ec0, 0x34a8, 0x8009, 0x2c10, 0x199d, 0xf302, 0x189e, 0xf042, 0x2aff, 0x9e13, 0xf501, 0x2c10, 0x189c }, 16, 0x000878e0, 1},
-	{{0x599b, 0xf042, 0xf302, 0x2aff, 0x9d6f, 0xf601, 0x7a61, 0x666a, 0x81dd, 0xd3a8, 0x8008, 0x92c2, 0xc382, 0xc381, 0x2600, 0x80c0 }, 16, 0x00087900, 1},
-	{{0xc484, 0xc5a0, 0x3bc0, 0x3230, 0x8009, 0x3cc0, 0x3210, 0x8009, 0x3dc0, 0x34b8, 0x8009, 0x3ec0, 0x34c8, 0x8009, 0x2c10, 0x199c }, 16, 0x00087920, 1},
-	{{0xf302, 0x189e, 0xf042, 0x2aff, 0x9dc3, 0xf501, 0x2c10, 0x189d, 0x599b, 0xf042, 0xf302, 0x2aff, 0x9d1f, 0xf601, 0x7a61, 0x666a }, 16, 0x00087940, 1},
-	{{0x81dd, 0x3024, 0x3f50, 0x8009, 0xe768, 0x3600, 0xa100, 0xf185, 0xefe8, 0x9730, 0x94c0, 0x9c22, 0x9530, 0x1c98, 0x1005, 0xa004 }, 16, 0x00087960, 1},
-	{{0x3420, 0xa000, 0x5c98, 0x3820, 0xa000, 0x5898, 0x2803, 0x8040, 0x3420, 0xa000, 0x5e98, 0x3640, 0xa100, 0x5018, 0xeaec, 0x1418 }, 16, 0x00087980, 1},
-	{{0x6c50, 0x1518, 0xcc50, 0x94c0, 0x9841, 0x5018, 0x3420, 0xa000, 0x5118, 0x3620, 0xa008, 0x5018, 0x64ed, 0x3a40, 0xa000, 0x3703 }, 16, 0x000879a0, 1},
-	{{0x2800, 0x8008, 0xe8ee, 0x9d44, 0x3420, 0xa000, 0xebe8, 0x90c0, 0x92d0, 0x5059, 0x903c, 0x2c10, 0xeaec, 0x3420, 0xa000, 0x9d41 }, 16, 0x000879c0, 1},
-	{{0x90c0, 0x125a, 0x535b, 0x96c8, 0x601d, 0x525a, 0x535b, 0x641d, 0x92d0, 0xd41d, 0x7458, 0x94c0, 0x9028, 0x6c10, 0x94c0, 0x9c23 }, 16, 0x000879e0, 1},
-	{{0x9531, 0x90c0, 0x90c0, 0x9731, 0x9f70, 0x36c0, 0xa000, 0x4c97, 0xe8ee, 0x3600, 0xa100, 0xf185, 0xefe8, 0x9730, 0x94c0, 0x9b22 }, 16, 0x00087a00, 1},
-	{{0x9c22, 0x94c0, 0x9530, 0x5c98, 0x3820, 0xa000, 0x5c98, 0x1005, 0xa004, 0x3420, 0xa000, 0x5898, 0x3420, 0xa000, 0x5e98, 0x3640 }, 16, 0x00087a20, 1},
-	{{0xa100, 0x5018, 0xeaec, 0x98c0, 0x6c50, 0x5418, 0x2803, 0x802e, 0x1518, 0xcc50, 0x3620, 0xa000, 0x5118, 0x9841, 0x1018, 0xcb54 }, 16, 0x00087a40, 1},
-	{{0x3c40, 0xa004, 0x64ed, 0x5058, 0x3703, 0x2800, 0x8008, 0x3420, 0xa000, 0xe8ee, 0x96c0, 0x9944, 0x2903, 0x8012, 0x5059, 0x3640 }, 16, 0x00087a60, 1},
-	{{0xa000, 0x983c, 0xede8, 0x3420, 0xa000, 0x9e41, 0x94c0, 0xebed, 0xeaec, 0x3640, 0xa000, 0x6c10, 0x571d, 0x125a, 0x537b, 0x96c8 }, 16, 0x00087a80, 1},
-	{{0x601d, 0x525a, 0x537b, 0x3610, 0xa008, 0x601d, 0x6469, 0x3611, 0xb000, 0x7448, 0x6410, 0x4058, 0x3620, 0xa000, 0x574c, 0x6c10 }, 16, 0x00087aa0, 1},
-	{{0x9531, 0x90c0, 0x90c0, 0x94c0, 0x9b23, 0x9c23, 0x9731, 0x9f70, 0x36c0, 0xa000, 0x4c97, 0xe8ee, 0xfbc3, 0xf287, 0x94c0, 0x9530 }, 16, 0x00087ac0, 1},
-	{{0x9822, 0x94c0, 0x9730, 0x9c22, 0x3820, 0xa000, 0x5a9b, 0x1005, 0xa004, 0x1a9b, 0xedeb, 0x96c0, 0x5c9b, 0x2803, 0x8028, 0x94c0 }, 16, 0x00087ae0, 1},
-	{{0x9842, 0x5313, 0x9ac0, 0x2c02, 0x8080, 0x90c0, 0x187a, 0x9fe0, 0x3703, 0x2800, 0x8000, 0x3680, 0xa000, 0xe8ec, 0x65e9, 0x957f }, 16, 0x00087b00, 1},
-	{{0x94c1, 0xc118, 0x5198, 0x94c1, 0xc01a, 0x419a, 0x115a, 0x105c, 0x6d10, 0x96d8, 0x6111, 0x505c, 0x515a, 0x3840, 0xa000, 0x6511 }, 16, 0x00087b20, 1},
-	{{0xece8, 0x65e9, 0x4261, 0x94c0, 0x9731, 0x9c23, 0x94c0, 0x9531, 0x9823, 0x90c0, 0x90c0, 0x9f70, 0x4a95, 0x3620, 0xa100, 0xf785 }, 16, 0x00087b40, 1},
-	{{0xe9e8, 0x3680, 0xa000, 0xca47, 0xe9e8, 0x3600, 0xa008, 0x9730, 0x74d1, 0x94c0, 0x9c22, 0x9530, 0x3c02, 0x2016, 0x8000, 0x94c0 }, 16, 0x00087b60, 1},
-	{{0x9632, 0x9732, 0x94c0, 0x9620, 0x9720, 0x1005, 0xa004, 0xe90a, 0x3703, 0x2080, 0x8000, 0x3a40, 0x3640, 0x8009, 0x944a, 0x2c10 }, 16, 0x00087b80, 1},
-	{{0x2c90, 0x2d10, 0x6d90, 0x3640, 0xa000, 0x4dda, 0x5059, 0x3e48, 0xa0f0, 0x6000, 0x6081, 0x6102, 0x6183, 0x4dda, 0x5059, 0x3a00 }, 16, 0x00087ba0, 1},
-	{{0xa0f0, 0x6000, 0x6081, 0x6102, 0x6183, 0x2465, 0x24e5, 0x2565, 0x65e5, 0x3600, 0xb800, 0x7651, 0x76d1, 0x3600, 0xa004, 0x3683 }, 16, 0x00087bc0, 1},
-	{{0x8005, 0x3400, 0xa804, 0xd99b, 0x3600, 0xa004, 0x3883, 0x8005, 0x3600, 0xa004, 0x38a3, 0x8004, 0x3600, 0xa804, 0xd99b, 0xda1c }, 16, 0x00087be0, 1},
-	{{0x3600, 0xa004, 0x3883, 0x8005, 0x3800, 0xba01, 0x7653, 0x76d3, 0x7551, 0x3c00, 0xa846, 0x3645, 0x8003, 0x90c0, 0x3686, 0x8005 }, 16, 0x00087c00, 1},
-	{{0x3600, 0xb80c, 0xda9d, 0xdb1e, 0x3c00, 0xa846, 0x3845, 0x8003, 0x90c0, 0x3886, 0x8005, 0x3c00, 0xa846, 0x3865, 0x8002, 0x90c0 }, 16, 0x00087c20, 1},
-	{{0x38a6, 0x8004, 0x3a00, 0xba0d, 0xda9d, 0xdb1e, 0xd91a, 0xda1c, 0x3c00, 0xa846, 0x3845, 0x8003, 0x90c0, 0x3886, 0x8005, 0x3800 }, 16, 0x00087c40, 1},
-	{{0xa00d, 0x7451, 0x7552, 0x7653, 0x3c00, 0xac60, 0x3605, 0x8001, 0x90c0, 0x3646, 0x8003, 0x3a00, 0xa840, 0x3687, 0x8005, 0xda9d }, 16, 0x00087c60, 1},
-	{{0xdb1e, 0x3c00, 0xac60, 0x3805, 0x8001, 0xdb9f, 0x3846, 0x8003, 0x3600, 0xa840, 0x3887, 0x8005, 0x3c00, 0xac60, 0x3025, 0x8000 }, 16, 0x00087c80, 1},
-	{{0x90c0, 0x3066, 0x8002, 0x3a00, 0xa840, 0x30a7, 0x8004, 0xda9d, 0xdb1e, 0x3a00, 0xb603, 0xdb9f, 0xda19, 0xd99b, 0xdb9d, 0x3c00 }, 16, 0x00087ca0, 1},
-	{{0xac20, 0x3085, 0x8000, 0x90c0, 0x3066, 0x8002, 0x3600, 0xa840, 0x30e7, 0x8004, 0x3600, 0xa004, 0x6fc1, 0x6cdf, 0x3400, 0xa804 }, 16, 0x00087cc0, 1},
-	{{0x6fc7, 0x3400, 0xa004, 0x6769, 0x90c0, 0x96c2, 0x3164, 0x3d9e, 0x8008, 0x3a40, 0x3698, 0x8009, 0x944a, 0x2c10, 0x6c90, 0x3640 }, 16, 0x00087ce0, 1},
-	{{0xa000, 0x5d5a, 0x5059, 0x3a48, 0xa0c0, 0x6000, 0x6081, 0x5d5a, 0x5059, 0x3a00, 0xa6c3, 0x6000, 0x6081, 0x7651, 0x76d6, 0x3600 }, 16, 0x00087d00, 1},
-	{{0xa840, 0x3683, 0x8005, 0xd99b, 0x3600, 0xa840, 0x3883, 0x8005, 0x3600, 0xa840, 0x38a3, 0x8004, 0x3600, 0xb008, 0xd99b, 0xda1c }, 16, 0x00087d20, 1},
-	{{0x3a00, 0xa841, 0x3883, 0x8005, 0x7650, 0x7551, 0x3c00, 0xa840, 0x3684, 0x8005, 0x90c0, 0x3645, 0x8003, 0x94c0, 0xda1c, 0xda9d }, 16, 0x00087d40, 1},
-	{{0x3c00, 0xa840, 0x3884, 0x8005, 0x90c0, 0x3845, 0x8003, 0x3c00, 0xa840, 0x30a4, 0x8004, 0x90c0, 0x3065, 0x8002, 0x3a00, 0xa200 }, 16, 0x00087d60, 1},
-	{{0xda1c, 0xda9d, 0xdb1d, 0xdb9b, 0x3c00, 0xa800, 0x30c4, 0x8004, 0x90c0, 0x30e5, 0x8002, 0x6d55, 0x3400, 0xa804, 0x6fcb, 0x3600 }, 16, 0x00087d80, 1},
-	{{0xa808, 0x745f, 0x67e5, 0x94c0, 0x9621, 0x9721, 0x94c0, 0x9633, 0x9733, 0x94c0, 0x9531, 0x9c23, 0x90c0, 0x90c0, 0x9731, 0x9f70 }, 16, 0x00087da0, 1},
-	{{0x3400, 0xa800, 0x7457, 0x9730, 0x94c0, 0x9c22, 0x9530, 0x5c58, 0x1a98, 0x6d54, 0x2d5c, 0x1998, 0xece8, 0x3800, 0xa100, 0x7a61 }, 16, 0x00087dc0, 1},
-	{{0xe9e8, 0xcc52, 0x1005, 0xa004, 0x3703, 0x2080, 0x8000, 0x9c44, 0x4191, 0x2c10, 0x2c90, 0x135a, 0x5299, 0x98c8, 0x6c61, 0x609d }, 16, 0x00087de0, 1},
-	{{0x535a, 0x5299, 0x2c61, 0x609d, 0x1489, 0xd818, 0x2c51, 0x4994, 0xd415, 0x94c0, 0x9531, 0x9c23, 0x90c0, 0x90c0, 0x94c0, 0x9731 }, 16, 0x00087e00, 1},
-	{{0x7458, 0x9f70, 0xd818, 0x00c6, 0x37cc, 0x8009, 0x6469, 0x8085, 0x0806, 0x357c, 0x8008, 0xc08f, 0x2808, 0x8008, 0x5190, 0x3319 }, 16, 0x00087e20, 1},
-	{{0x8f00, 0xdca8, 0x34f9, 0x04c4, 0x37ce, 0x8009, 0x6c31, 0x6c7d, 0x9f7d, 0x747c, 0x6469, 0x8059, 0x9b40, 0x2b03, 0x800a, 0x30c1 }, 16, 0x00087e40, 1},
-	{{0x39f0, 0x8009, 0x08c6, 0x37b8, 0x8009, 0x90c0, 0x91b8, 0x0806, 0x357c, 0x8008, 0x90c0, 0xb101, 0x08c6, 0x37b8, 0x8009, 0x02c6 }, 16, 0x00087e60, 1},
-	{{0x37cc, 0x8009, 0x3961, 0xe841, 0xc849, 0x3079, 0x08c2, 0x37b8, 0x8009, 0x02c2, 0x37cc, 0x8009, 0x94c2, 0x2303, 0x8016, 0x96d0 }, 16, 0x00087e80, 1},
-	{{0x38c0, 0x37e8, 0x8009, 0x08c2, 0x37b8, 0x8009, 0x90c0, 0x9f7c, 0x9f71, 0x90c0, 0x9f71, 0x01c6, 0x37cc, 0x8009, 0x3411, 0x8208 }, 16, 0x00087ea0, 1},
-	{{0x8415, 0x8364, 0x75d0, 0x3453, 0x01c6, 0x37cc, 0x8009, 0x3411, 0x8208, 0x81f1, 0xc569, 0x9f7d, 0x02c6, 0x37cc, 0x8009, 0x2569 }, 16, 0x00087ec0, 1},
-	{{0x0906, 0x357c, 0x8008, 0x8413, 0x2908, 0x8008, 0x5290, 0x0c02, 0xa020, 0x8442, 0x92c3, 0xb009, 0x02c6, 0x37cc, 0x8009, 0x3941 }, 16, 0x00087ee0, 1},
-	{{0x38c0, 0x39f0, 0x8009, 0x02c2, 0x37cc, 0x8009, 0x09c6, 0x37dc, 0x8009, 0x90c0, 0x9099, 0x09c6, 0x37dc, 0x8009, 0x30c1, 0x37e8 }, 16, 0x00087f00, 1},
-	{{0x8009, 0xe941, 0xe889, 0x800e, 0x09c2, 0x37dc, 0x8009, 0x00c2, 0x37dc, 0x8009, 0xc561, 0x90c0, 0x9f7c, 0x9f71, 0x3124, 0x3f30 }, 16, 0x00087f20, 1},
-	{{0x8009, 0x83fb, 0x36d0, 0x2c10, 0xe758, 0xf043, 0x2000, 0x8082, 0xf504, 0x8364, 0xf944, 0x8360, 0x107c, 0x9fcf, 0x107c, 0x9fcf }, 16, 0x00087f40, 1},
-	{{0x2469, 0xf045, 0x2718, 0x8166, 0x3ac9, 0x9608, 0x834a, 0x3469, 0xf146, 0x8344, 0x746d, 0xf684, 0x276a, 0x37d6, 0xf9c4, 0x2718 }, 16, 0x00087f60, 1},
-	{{0x8134, 0x3ae8, 0x2400, 0xbfff, 0x3ec8, 0x3800, 0xbfff, 0x3fc8, 0x3c10, 0xbfff, 0x3bc8, 0x3c14, 0xbfff, 0x3ce8, 0x2418, 0xbfff }, 16, 0x00087f80, 1},
-	{{0x3800, 0x201a, 0x8008, 0x90c0, 0xe8a9, 0x2518, 0x80d2, 0x3800, 0x2018, 0x8008, 0x90c0, 0xe8a9, 0x80c1, 0x3800, 0x2016, 0x8008 }, 16, 0x00087fa0, 1},
-	{{0x90c0, 0xe8a9, 0x80b1, 0x3800, 0x2014, 0x8008, 0x90c0, 0xe8a9, 0x80a1, 0x3800, 0x2012, 0x8008, 0x90c0, 0xe8a9, 0x8091, 0x3800 }, 16, 0x00087fc0, 1},
-	{{0x2010, 0x8008, 0x90c0, 0xe8a9, 0x8081, 0x3800, 0x2006, 0x8008, 0x90c0, 0xe8a9, 0x8071, 0x3800, 0x2002, 0x8008, 0x01c7, 0x37be }, 16, 0x00087fe0, 1},
-	{{0x8009, 0xe8a9, 0x807b, 0x11d1, 0x3800, 0x2000, 0x8008, 0x90c0, 0xe8a9, 0x846d, 0x1192, 0x38c0, 0x37bc, 0x8009, 0x33e8, 0x9fff }, 16, 0x00088000, 1},
-	{{0xd020, 0x8436, 0x01c2, 0x37bc, 0x8009, 0x32e4, 0x3a92, 0x8001, 0xf944, 0x08c6, 0x37bc, 0x8009, 0x3ae8, 0x2400, 0xbfff, 0xe8f1 }, 16, 0x00088020, 1},
-	{{0xf9c4, 0x3bc8, 0x3c14, 0xbfff, 0x8410, 0x3ce8, 0x2418, 0xbfff, 0x5092, 0x00c2, 0x37bc, 0x8009, 0x00c6, 0x37bc, 0x8009, 0x30c9 }, 16, 0x00088040, 1},
-	{{0x8410, 0x881d, 0x881a, 0x5196, 0x8ff6, 0x5097, 0x8812, 0x5197, 0x8fee, 0x5093, 0x880a, 0x5193, 0x8fe6, 0x5094, 0x5194, 0x36f9 }, 16, 0x00088060, 1},
-	{{0xf0c3, 0x34f8, 0xf944, 0x3aca, 0x9608, 0x346a, 0x756a, 0x6cb8, 0x2aff, 0x9e27, 0xcc51, 0x356d, 0x346d, 0xcc59, 0x74f9, 0x6cb8 }, 16, 0x00088080, 1},
-	{{0x2aff, 0x9e17, 0xf143, 0x3be1, 0xf9c4, 0x67ea, 0x2cff, 0x9ef5, 0xe942, 0xf0c3, 0x3578, 0xf1c6, 0x3469, 0x74ee, 0x3c12, 0x8082 }, 16, 0x000880a0, 1},
-	{{0x757a, 0x6c12, 0x7478, 0x880a, 0x6c31, 0x30e1, 0x3f7e, 0x8000, 0x34f8, 0xf0c5, 0x6c11, 0x76f8, 0x3ac8, 0x9608, 0x2aff, 0x9ddb }, 16, 0x000880c0, 1},
-	{{0x7468, 0x2aff, 0x9dd5, 0x746d, 0x2c10, 0xe778, 0x3024, 0x3f50, 0x8009, 0x00c2, 0x37d0, 0x8009, 0x76d0, 0x2aff, 0x9dbd, 0x2000 }, 16, 0x000880e0, 1},
-	{{0x8092, 0x2aff, 0x9db5, 0x7455, 0x30e1, 0x3f6e, 0x8000, 0x7478, 0x6ea1, 0x3ac8, 0x9608, 0x2aff, 0x9da1, 0x7468, 0x2aff, 0x9d9b }, 16, 0x00088100, 1},
-	{{0x746d, 0x6c10, 0x9f70, 0x00c2, 0x37d0, 0x8009, 0x31e4, 0x37e6, 0x8001, 0x31e4, 0x37da, 0x8001, 0x2bff, 0x9e05, 0x2f10, 0xe750 }, 16, 0x00088120, 1},
-	{{0x32e4, 0x3a14, 0x8001, 0x2c90, 0xe838, 0x2469, 0x2c10, 0x0ec6, 0x37d0, 0x8009, 0x2518, 0x87d8, 0x39c0, 0x39f0, 0x8009, 0x0806 }, 16, 0x00088140, 1},
-	{{0x3c00, 0x8008, 0x007c, 0x9ff0, 0xee19, 0xb9c2, 0x27e8, 0x9ff0, 0x9962, 0xc181, 0x2469, 0x02c5, 0x3dad, 0x8009, 0x2618, 0x87f2 }, 16, 0x00088160, 1},
-	{{0x92c3, 0x6c10, 0xd520, 0x2718, 0x8212, 0x01c6, 0x3e1c, 0x8009, 0xd124, 0xc081, 0x3319, 0x8fff, 0x00c1, 0x3dae, 0x8009, 0x2418 }, 16, 0x00088180, 1},
-	{{0x812a, 0x01c0, 0x37e4, 0x8009, 0xd122, 0x8085, 0xd121, 0x8465, 0x2d90, 0x08c6, 0x37d4, 0x8009, 0x3ac0, 0x3d98, 0x8009, 0xc984 }, 16, 0x000881a0, 1},
-	{{0xea18, 0xe841, 0xe9a8, 0x107c, 0x9ff0, 0x909a, 0x2618, 0x875c, 0x08c2, 0x37d4, 0x8009, 0x02c5, 0x3d98, 0x8009, 0x3d58, 0x04c5 }, 16, 0x000881c0, 1},
-	{{0x3d99, 0x8009, 0x03c2, 0x37d4, 0x8009, 0xd994, 0x01c5, 0x3d9a, 0x8009, 0x3cc8, 0xdd9a, 0x00c5, 0x3d9b, 0x8009, 0xdd99, 0xdd98 }, 16, 0x000881e0, 1},
-	{{0xc082, 0x03c2, 0x37d8, 0x8009, 0x2018, 0x8720, 0x00c1, 0x3dad, 0x8009, 0x0005, 0x3c4a, 0x8008, 0x2469, 0x3041, 0x3387, 0x8009 }, 16, 0x00088200, 1},
-	{{0x2518, 0x8708, 0xf242, 0x8306, 0xf041, 0x2118, 0x86fe, 0x08c6, 0x37d4, 0x8009, 0x3ac0, 0x3d98, 0x8009, 0xc982, 0xea18, 0xe841 }, 16, 0x00088220, 1},
-	{{0xe9a8, 0x107c, 0x9ff0, 0x909a, 0x2618, 0x86e0, 0x2c10, 0x08c2, 0x37d4, 0x8009, 0x01c5, 0x3d98, 0x8009, 0x3cc8, 0x02c5, 0x3d99 }, 16, 0x00088240, 1},
-	{{0x8009, 0xdd19, 0x34fa, 0xc384, 0x3611, 0x8100, 0x00c2, 0x37d4, 0x8009, 0x02c0, 0x37e6, 0x8009, 0x2618, 0x86b0, 0x03c1, 0x3dad }, 16, 0x00088260, 1},
-	{{0x8009, 0x2000, 0x80e3, 0x3471, 0x007c, 0x9fff, 0x2aff, 0x9cb7, 0x09c6, 0x37d8, 0x8009, 0x2c90, 0x0005, 0x3c4a, 0x8008, 0x2469 }, 16, 0x00088280, 1},
-	{{0x01c1, 0x3dad, 0x8009, 0x2418, 0x8682, 0x01c1, 0x3dae, 0x8009, 0x01c7, 0x37e6, 0x8009, 0x3041, 0x3405, 0x8009, 0xf142, 0x2aff }, 16, 0x000882a0, 1},
-	{{0x9e6f, 0xf041, 0x2118, 0x8664, 0x08c6, 0x37d4, 0x8009, 0x3ac0, 0x3d98, 0x8009, 0xc982, 0xea18, 0xe841, 0x107c, 0x9ff0, 0xe9a8 }, 16, 0x000882c0, 1},
-	{{0x909a, 0x2618, 0x8646, 0x08c2, 0x37d4, 0x8009, 0x02c5, 0x3d98, 0x8009, 0x3d48, 0x01c6, 0x37d8, 0x8009, 0x3469, 0x05c5, 0x3d99 }, 16, 0x000882e0, 1},
-	{{0x8009, 0x32cf, 0x8608, 0x37ef, 0xde9a, 0x377d, 0xd7c0, 0x32ca, 0x8410, 0x356a, 0x05c0, 0x37e0, 0x8009, 0x2c4b, 0x05c7, 0x37e6 }, 16, 0x00088300, 1},
-	{{0x8009, 0x32cb, 0x8218, 0x35eb, 0x04c5, 0x37e7, 0x8009, 0x6c53, 0x3aca, 0x9608, 0x2464, 0x756a, 0x3478, 0xd544, 0x6c32, 0x7478 }, 16, 0x00088320, 1},
-	{{0x3c10, 0x8081, 0x7478, 0x3360, 0x3001, 0x2000, 0x8008, 0x842c, 0x94c3, 0x2800, 0x80e5, 0x3079, 0x3201, 0x3000, 0x8008, 0x8019 }, 16, 0x00088340, 1},
-	{{0x30fa, 0x7455, 0x8013, 0xd441, 0x707a, 0x8010, 0x94c2, 0x2800, 0x80e4, 0x8808, 0xe838, 0x2800, 0x80e2, 0x3475, 0xc941, 0x2aff }, 16, 0x00088360, 1},
-	{{0x9bc5, 0x087c, 0x9fff, 0x6c10, 0x00c1, 0x3dad, 0x8009, 0x00c1, 0x3dae, 0x8009, 0x2118, 0x8594, 0x00c5, 0x3daa, 0x8009, 0xd420 }, 16, 0x00088380, 1},
-	{{0x2718, 0x839a, 0x02c6, 0x3e1c, 0x8009, 0xd025, 0xc181, 0x351a, 0x8fff, 0x01c1, 0x3dae, 0x8009, 0x2418, 0x81b0, 0x02c0, 0x37e4 }, 16, 0x000883a0, 1},
-	{{0x8009, 0xd026, 0x2518, 0x8188, 0xd024, 0x80e1, 0x2c90, 0xd022, 0x8087, 0xd021, 0x8465, 0x2d90, 0x08c6, 0x37d4, 0x8009, 0x3ac0 }, 16, 0x000883c0, 1},
-	{{0x3d98, 0x8009, 0xc984, 0xea18, 0xe841, 0xe9a8, 0x107c, 0x9ff0, 0x909a, 0x2618, 0x8536, 0x08c2, 0x37d4, 0x8009, 0x02c5, 0x3d98 }, 16, 0x000883e0, 1},
-	{{0x8009, 0x3d58, 0x04c5, 0x3d99, 0x8009, 0x03c2, 0x37d4, 0x8009, 0xd994, 0x01c5, 0x3d9a, 0x8009, 0x3cc8, 0xdd9a, 0xdd99, 0x00c5 }, 16, 0x00088400, 1},
-	{{0x3d9b, 0x8009, 0xdd98, 0xc082, 0x03c2, 0x37d8, 0x8009, 0x2018, 0x84fa, 0x00c1, 0x3daa, 0x8009, 0x0105, 0x3c4a, 0x8008, 0x24e9 }, 16, 0x00088420, 1},
-	{{0x3141, 0x3399, 0x8009, 0x2518, 0x84e2, 0xf042, 0x2aff, 0x9ce1, 0xf141, 0x2118, 0x84d6, 0x08c6, 0x37d4, 0x8009, 0x3ac0, 0x3d98 }, 16, 0x00088440, 1},
-	{{0x8009, 0xc982, 0xea18, 0xe841, 0x107c, 0x9ff0, 0xe9a8, 0x909a, 0x2c90, 0x01c0, 0x37e2, 0x8009, 0x2618, 0x84b0, 0x08c2, 0x37d4 }, 16, 0x00088460, 1},
-	{{0x8009, 0x02c5, 0x3d98, 0x8009, 0x3d48, 0x00c5, 0x3d99, 0x8009, 0xdc1a, 0xc284, 0x02c1, 0x3daa, 0x8009, 0x00c0, 0x37e6, 0x8009 }, 16, 0x00088480, 1},
-	{{0x2018, 0x8488, 0x01c2, 0x37d4, 0x8009, 0x2c90, 0x08c6, 0x37d4, 0x8009, 0x3ac0, 0x3d98, 0x8009, 0xc982, 0xea18, 0xe841, 0xe9a8 }, 16, 0x000884a0, 1},
-	{{0x107c, 0x9ff0, 0x909a, 0x2618, 0x8462, 0x08c2, 0x37d4, 0x8009, 0x09c7, 0x37e2, 0x8009, 0x38c0, 0x39f0, 0x8009, 0x04c5, 0x3d98 }, 16, 0x000884c0, 1},
-	{{0x8009, 0x3e48, 0x02c6, 0x37d8, 0x8009, 0x3301, 0x2000, 0x8008, 0x317b, 0xe9fc, 0x00c5, 0x3d99, 0x8009, 0x01c2, 0x37d4, 0x8009 }, 16, 0x000884e0, 1},
-	{{0xdc1c, 0x8446, 0xe918, 0x3101, 0x3000, 0x8008, 0x3179, 0x01c7, 0x37e6, 0x8009, 0x8035, 0x3611, 0x8100, 0x802f, 0x0011, 0x00c7 }, 16, 0x00088500, 1},
-	{{0x37e2, 0x8009, 0x7841, 0x3478, 0x00c0, 0x37e2, 0x8009, 0x30f8, 0x2c10, 0xc185, 0x2518, 0x83f4, 0x01c1, 0x3daa, 0x8009, 0x2018 }, 16, 0x00088520, 1},
-	{{0x83ea, 0x00c2, 0x37d4, 0x8009, 0x8ee6, 0xc086, 0x00c7, 0x37e6, 0x8009, 0x3610, 0x8100, 0x800c, 0x94c2, 0x2000, 0x80e3, 0x2000 }, 16, 0x00088540, 1},
-	{{0x80e2, 0x2bff, 0x9b97, 0x89c5, 0x2c10, 0x08c6, 0x37d4, 0x8009, 0x3ac0, 0x3d98, 0x8009, 0xc982, 0xea18, 0xe841, 0xe9a8, 0x117c }, 16, 0x00088560, 1},
-	{{0x9ff0, 0x919a, 0x2618, 0x83a4, 0x08c2, 0x37d4, 0x8009, 0x03c5, 0x3d98, 0x8009, 0x3dc8, 0x02c7, 0x37e2, 0x8009, 0x3d41, 0x01c5 }, 16, 0x00088580, 1},
-	{{0x3d99, 0x8009, 0x256a, 0xdc9b, 0x01c0, 0x37e0, 0x8009, 0x38c0, 0x39f0, 0x8009, 0x841c, 0x09c6, 0x37d8, 0x8009, 0x9b42, 0x2b03 }, 16, 0x000885a0, 1},
-	{{0x800a, 0x3ac0, 0x39f0, 0x8009, 0x92d0, 0x7478, 0x92a2, 0x6c32, 0x3678, 0x3779, 0x00c6, 0x37d8, 0x8009, 0x34e8, 0xcc56, 0x30cf }, 16, 0x000885c0, 1},
-	{{0x8608, 0x37ef, 0x05c5, 0x37e7, 0x8009, 0x30ca, 0x8218, 0x35ea, 0xd7c1, 0x30ce, 0x8410, 0x356e, 0x06c7, 0x37e6, 0x8009, 0x6ccb }, 16, 0x000885e0, 1},
-	{{0x3cca, 0x9608, 0x2dd9, 0x756a, 0x2f8c, 0xd545, 0x75ff, 0x6f9d, 0x36ff, 0xcc5f, 0x3c15, 0x8091, 0x757d, 0x33e2, 0x7556, 0xd540 }, 16, 0x00088600, 1},
-	{{0x2618, 0x8104, 0x94c3, 0x2500, 0x80e5, 0x2c90, 0x3501, 0x3000, 0x8008, 0x717d, 0x2418, 0x80f0, 0x94c2, 0x2500, 0x80e4, 0x2769 }, 16, 0x00088620, 1},
-	{{0x01c0, 0x37e2, 0x8009, 0x2518, 0x80dc, 0x3201, 0x2000, 0x8008, 0xca40, 0xd540, 0x3bc8, 0x3c14, 0xbfff, 0x3cc8, 0x3c16, 0xbfff }, 16, 0x00088640, 1},
-	{{0x3301, 0x2000, 0x8008, 0x3de8, 0x2418, 0xbfff, 0x3ee8, 0x241a, 0xbfff, 0x31f8, 0x3501, 0x201a, 0x8008, 0x8093, 0x307d, 0x14d0 }, 16, 0x00088660, 1},
-	{{0xcf45, 0x808b, 0xefaa, 0x8077, 0x3f00, 0x2018, 0x8008, 0x90c0, 0xefaa, 0x8067, 0x3f00, 0x2016, 0x8008, 0x90c0, 0xefaa, 0x8057 }, 16, 0x00088680, 1},
-	{{0x3f00, 0x2014, 0x8008, 0x90c0, 0xefaa, 0x8047, 0x3f00, 0x2012, 0x8008, 0x90c0, 0xefaa, 0x8033, 0x3f00, 0x2010, 0x8008, 0x90c0 }, 16, 0x000886a0, 1},
-	{{0xefaa, 0x801d, 0x3f00, 0x2006, 0x8008, 0x90c0, 0xefaa, 0x8433, 0x3fc8, 0x3804, 0xbfff, 0x39fc, 0x9fff, 0x8836, 0x4497, 0x3fc8 }, 16, 0x000886c0, 1},
-	{{0x3c10, 0xbfff, 0x882c, 0x4417, 0x8ffc, 0x3fc8, 0x3c12, 0xbfff, 0x8820, 0x4413, 0x881c, 0x4414, 0x8818, 0x4415, 0x8814, 0x4416 }, 16, 0x000886e0, 1},
-	{{0xcf42, 0x0fc2, 0x37c4, 0x8009, 0x8808, 0x4417, 0x54d0, 0x4411, 0x38c1, 0xe942, 0x34f9, 0x01c0, 0x37e2, 0x8009, 0x3379, 0xe842 }, 16, 0x00088700, 1},
-	{{0x8153, 0x6e90, 0x2aff, 0x99d5, 0x7455, 0x6c10, 0x00c1, 0x3daa, 0x8009, 0x00c1, 0x3dae, 0x8009, 0x89f1, 0x117c, 0x9ff0, 0x3411 }, 16, 0x00088720, 1},
-	{{0x8081, 0x2518, 0x8186, 0x3411, 0x8091, 0x2518, 0x817e, 0x3411, 0x8083, 0x840d, 0x2aff, 0x9763, 0x2000, 0x8084, 0x89cd, 0x3411 }, 16, 0x00088740, 1},
-	{{0x8085, 0x8415, 0x6c10, 0x0001, 0x3c4a, 0x8008, 0x2aff, 0x974b, 0x2000, 0x8086, 0x89b5, 0x3411, 0x8087, 0x8415, 0xc081, 0x0001 }, 16, 0x00088760, 1},
-	{{0x3c4a, 0x8008, 0x2aff, 0x9733, 0x2000, 0x8088, 0x899d, 0x6569, 0x2718, 0x81dc, 0x6469, 0x2718, 0x81d6, 0xd0aa, 0x2518, 0x80da }, 16, 0x00088780, 1},
-	{{0xd0ad, 0x80cf, 0xd0a5, 0x80bf, 0x3411, 0x803b, 0x8095, 0x3411, 0x807f, 0x8059, 0xd0a8, 0x8055, 0xd0bb, 0x8411, 0x3041, 0x30f0 }, 16, 0x000887a0, 1},
-	{{0x8009, 0x88de, 0x00c2, 0x37c0, 0x8009, 0x64e9, 0x80d5, 0x3611, 0x807f, 0x80cf, 0x00c5, 0x3da9, 0x8009, 0x2469, 0x00c6, 0x37d0 }, 16, 0x000887c0, 1},
-	{{0x8009, 0x840d, 0x7841, 0x919e, 0x00c2, 0x37d0, 0x8009, 0x00c5, 0x3da8, 0x8009, 0x2469, 0x0806, 0x3c00, 0x8008, 0x80a5, 0xb9c1 }, 16, 0x000887e0, 1},
-	{{0x27e8, 0x9ff0, 0x9962, 0xc181, 0x8899, 0x00c6, 0x37d0, 0x8009, 0x246a, 0x00c5, 0x3da8, 0x8009, 0x8489, 0x2469, 0x0806, 0x3c00 }, 16, 0x00088800, 1},
-	{{0x8008, 0x800f, 0xb9c1, 0xc183, 0x9962, 0x3840, 0x343c, 0x8009, 0x00c6, 0x37d0, 0x8009, 0x7861, 0x8868, 0x00c2, 0x37d0, 0x8009 }, 16, 0x00088820, 1},
-	{{0x00c5, 0x3da8, 0x8009, 0x2469, 0xc181, 0x8056, 0x01c1, 0x3da9, 0x8009, 0x0806, 0x3c00, 0x8008, 0xc181, 0xb9c1, 0x27e8, 0x9ff0 }, 16, 0x00088840, 1},
-	{{0x9963, 0x883f, 0x00c6, 0x37d0, 0x8009, 0x919e, 0x8fcc, 0x7841, 0xc08a, 0x007c, 0x9ff0, 0x2c90, 0x00c5, 0x3da8, 0x8009, 0x2469 }, 16, 0x00088860, 1},
-	{{0x0806, 0x3c00, 0x8008, 0x800e, 0x919e, 0xb9c1, 0x27e8, 0x9ff0, 0x9962, 0xc181, 0x6c10, 0x0016, 0x8001, 0x00c1, 0x3da9, 0x8009 }, 16, 0x00088880, 1},
-	{{0x00c6, 0x37d0, 0x8009, 0x3610, 0x81fe, 0x8413, 0x2aff, 0x9887, 0x3840, 0x33cd, 0x8009, 0xc08a, 0x007c, 0x9ff0, 0x107c, 0x9ff0 }, 16, 0x000888a0, 1},
-	{{0xd02a, 0x84ab, 0x88a8, 0xc681, 0x2d10, 0xc084, 0x2c90, 0xf041, 0x38c0, 0x3d98, 0x8009, 0x02c2, 0x37d8, 0x8009, 0x02c0, 0x37e6 }, 16, 0x000888c0, 1},
-	{{0x8009, 0x02c2, 0x37d4, 0x8009, 0x32e4, 0x3c8a, 0x8001, 0x0201, 0x3c4a, 0x8008, 0x01c6, 0x3e1c, 0x8009, 0x331a, 0x8fff, 0x117c }, 16, 0x000888e0, 1},
-	{{0x9ff0, 0xc081, 0x3411, 0x8081, 0x00c1, 0x3dae, 0x8009, 0x8412, 0x02c0, 0x37e4, 0x8009, 0xc081, 0x8810, 0x00c1, 0x3dad, 0x8009 }, 16, 0x00088900, 1},
-	{{0xc081, 0x00c1, 0x3daa, 0x8009, 0x8846, 0x6c10, 0x00c5, 0x3dae, 0x8009, 0xd021, 0x8439, 0x01c6, 0x3e1c, 0x8009, 0x00c7, 0x37e4 }, 16, 0x00088920, 1},
-	{{0x8009, 0x3319, 0x8fff, 0x3071, 0x6c11, 0x8409, 0x7470, 0x3100, 0x9000, 0x7470, 0x2c10, 0xd43f, 0x8415, 0x00c1, 0x3dae, 0x8009 }, 16, 0x00088940, 1},
-	{{0x00c1, 0x3daa, 0x8009, 0x00c1, 0x3dad, 0x8009, 0x7456, 0x3024, 0x3f50, 0x8009, 0xe770, 0x2aff, 0x94b1, 0xe750, 0x33e4, 0x3a20 }, 16, 0x00088960, 1},
-	{{0x8001, 0x00c5, 0x3dac, 0x8009, 0x2469, 0x31c1, 0x3da2, 0x8009, 0x8419, 0x3041, 0x3431, 0x8009, 0xf142, 0x2aff, 0x9793, 0xf041 }, 16, 0x00088980, 1},
-	{{0xc081, 0x00c1, 0x3dac, 0x8009, 0x2100, 0x8200, 0x2aff, 0x978d, 0x38c0, 0x39f0, 0x8009, 0xd021, 0x2718, 0x80e8, 0x27e8, 0x9ff0 }, 16, 0x000889a0, 1},
-	{{0xf841, 0x39c0, 0x35a8, 0x8009, 0x32e4, 0x3816, 0x8001, 0x38c0, 0x39f0, 0x8009, 0x2c10, 0xf1c4, 0x24e9, 0xc185, 0x8051, 0xc081 }, 16, 0x000889c0, 1},
-	{{0x27e8, 0x9ff4, 0xf041, 0x017c, 0x9ff4, 0x32e4, 0x3ca2, 0x8001, 0x09c6, 0x35a8, 0x8009, 0x2469, 0x3840, 0x3418, 0x8009, 0x841d }, 16, 0x000889e0, 1},
-	{{0x2bff, 0x9733, 0x6c10, 0x00c1, 0x3da8, 0x8009, 0x00c1, 0x3dac, 0x8009, 0x888e, 0x00c2, 0x37d0, 0x8009, 0x09c6, 0x35a8, 0x8009 }, 16, 0x00088a00, 1},
-	{{0x32e4, 0x3804, 0x8001, 0x08c6, 0x37c0, 0x8009, 0x2468, 0x2d10, 0x3840, 0x32ea, 0x8009, 0x8033, 0x2bff, 0x96fb, 0x00c6, 0x37d0 }, 16, 0x00088a20, 1},
-	{{0x8009, 0x2469, 0x01c6, 0x35a8, 0x8009, 0x8011, 0x3041, 0x3420, 0x8009, 0xf142, 0x2aff, 0x96d9, 0xf041, 0x2aff, 0x96d9, 0x3840 }, 16, 0x00088a40, 1},
-	{{0x3439, 0x8009, 0x8fa8, 0x6c10, 0xf1c4, 0x24e9, 0x02c2, 0x37d0, 0x8009, 0x8027, 0x24e9, 0x3c44, 0x08c6, 0x37c0, 0x8009, 0x801b }, 16, 0x00088a60, 1},
-	{{0xc940, 0x90c0, 0xe918, 0xb0cb, 0x2469, 0x38c0, 0x35a8, 0x8009, 0x8009, 0xc940, 0x90c0, 0x9963, 0x6c10, 0x00c1, 0x3dac, 0x8009 }, 16, 0x00088a80, 1},
-	{{0xe770, 0x9f71, 0x31e4, 0x37e0, 0x8001, 0x3324, 0x3f30, 0x8009, 0xe758, 0x2aff, 0x9681, 0x3840, 0x332b, 0x8009, 0xc184, 0x83e6 }, 16, 0x00088aa0, 1},
-	{{0x3081, 0x34af, 0x8000, 0x2aff, 0x966d, 0x3840, 0x343f, 0x8009, 0x3800, 0x2028, 0x8008, 0xc184, 0x50d0, 0x3178, 0x9f00, 0x83c6 }, 16, 0x00088ac0, 1},
-	{{0x7c68, 0x3900, 0x2024, 0x8008, 0x3840, 0x3302, 0x8009, 0x2aff, 0x9645, 0x56d1, 0x2760, 0xc194, 0x83ac, 0x7456, 0x2aff, 0x9637 }, 16, 0x00088ae0, 1},
-	{{0x3840, 0x3436, 0x8009, 0x0446, 0x2c64, 0x8009, 0x0046, 0x2c68, 0x8009, 0x0146, 0x2c6c, 0x8009, 0x0246, 0x2c70, 0x8009, 0x3341 }, 16, 0x00088b00, 1},
-	{{0x31a0, 0x8009, 0xf245, 0xf144, 0xf043, 0xf442, 0x2aff, 0x9601, 0xf341, 0x3024, 0x3f50, 0x8009, 0xe778, 0xd4a1, 0xe748, 0xc081 }, 16, 0x00088b20, 1},
-	{{0x8424, 0xf042, 0x27e9, 0x9ff8, 0xf941, 0x32e4, 0x389a, 0x8001, 0xc181, 0x34f0, 0x9fff, 0x840f, 0x2aff, 0x95db, 0x3840, 0x3363 }, 16, 0x00088b40, 1},
-	{{0x8009, 0x883f, 0x32e4, 0x2d96, 0x8008, 0x10fc, 0x9ffa, 0xd026, 0x8419, 0x0005, 0x3c4a, 0x8008, 0x2469, 0x3840, 0x3351, 0x8009 }, 16, 0x00088b60, 1},
-	{{0x8021, 0x2bff, 0x95b1, 0x881b, 0xd021, 0x8417, 0x0005, 0x3c4a, 0x8008, 0x2469, 0x3840, 0x3375, 0x8009, 0x8007, 0x2bff, 0x9597 }, 16, 0x00088b80, 1},
-	{{0xe768, 0x9f71, 0xc081, 0x9f70, 0x00c1, 0x3da8, 0x8009, 0x6c10, 0x9f70, 0x00c1, 0x3da8, 0x8009, 0x39e8, 0x2400, 0xbfff, 0xe750 }, 16, 0x00088ba0, 1},
-	{{0x1091, 0x3840, 0x31e7, 0x8009, 0x2aff, 0x956b, 0x00c2, 0x37c8, 0x8009, 0x01c6, 0x37c8, 0x8009, 0x32c8, 0x8410, 0x3579, 0x3141 }, 16, 0x00088bc0, 1},
-	{{0x33fb, 0x8009, 0xf243, 0xf042, 0x2aff, 0x9545, 0xf141, 0xe770, 0x9f71, 0x2bff, 0x934b, 0xe750, 0xf0cb, 0xd421, 0x842e, 0xeee8 }, 16, 0x00088be0, 1},
-	{{0xb9c9, 0x32e4, 0x3804, 0x8001, 0xe8ee, 0x2468, 0x3c44, 0x3141, 0x33de, 0x8009, 0x8455, 0xc840, 0xf141, 0xe81e, 0xb1c1, 0xb0c2 }, 16, 0x00088c00, 1},
-	{{0xf043, 0x2aff, 0x950b, 0xf142, 0x8841, 0x2aff, 0x9509, 0x3840, 0x33ef, 0x8009, 0x1096, 0xe9ee, 0x2469, 0xefee, 0x802d, 0x1897 }, 16, 0x00088c20, 1},
-	{{0xc94e, 0x90c0, 0x90f8, 0x3410, 0x802e, 0x8015, 0xb1f9, 0x3041, 0x342c, 0x8009, 0xf142, 0x2aff, 0x94d7, 0xf041, 0xc946, 0xef50 }, 16, 0x00088c40, 1},
-	{{0xe950, 0x5091, 0x6469, 0x85d9, 0x08c6, 0x37c0, 0x8009, 0x90c0, 0xe8ae, 0x840d, 0x2aff, 0x94bf, 0x3840, 0x320e, 0x8009, 0x3024 }, 16, 0x00088c60, 1},
-	{{0x3f50, 0x8009, 0xe770, 0x3324, 0x3f30, 0x8009, 0x3751, 0xd0a1, 0xeee8, 0x840e, 0xe748, 0x2aff, 0x949d, 0x3840, 0x3299, 0x8009 }, 16, 0x00088c80, 1},
-	{{0xf641, 0xe9ee, 0x834e, 0x08c6, 0x37c0, 0x8009, 0x3024, 0x3f50, 0x8009, 0xe768, 0x3324, 0x3f30, 0x8009, 0x3751, 0xd0a1, 0xeee8 }, 16, 0x00088ca0, 1},
-	{{0x840e, 0xe748, 0x2aff, 0x946f, 0x38c0, 0x3d44, 0x8009, 0xf641, 0xe9ee, 0x8320, 0x3840, 0x2ff0, 0x8009, 0x3024, 0x3f50, 0x8009 }, 16, 0x00088cc0, 1},
-	{{0xe768, 0xe750, 0x2aff, 0x944f, 0x3840, 0x32b6, 0x8009, 0x01c6, 0x3e0c, 0x8009, 0x3041, 0x33bc, 0x8009, 0xf142, 0x2aff, 0x9431 }, 16, 0x00088ce0, 1},
-	{{0xf041, 0x01c6, 0x3e00, 0x8009, 0x3041, 0x33ab, 0x8009, 0xf142, 0x2aff, 0x941d, 0xf041, 0x02c6, 0x3df8, 0x8009, 0x00c6, 0x3dfc }, 16, 0x00088d00, 1},
-	{{0x8009, 0x3141, 0x3258, 0x8009, 0xf243, 0xf042, 0x2aff, 0x9401, 0xf141, 0x00c6, 0x3e48, 0x8009, 0x2100, 0x83e8, 0x32e4, 0x3c4e }, 16, 0x00088d20, 1},
-	{{0x8001, 0x6460, 0x34d0, 0x00c6, 0x3e0c, 0x8009, 0x32e4, 0x3c4e, 0x8001, 0x6460, 0x32e4, 0x3c4e, 0x8001, 0x3550, 0xc18a, 0x6560 }, 16, 0x00088d40, 1},
-	{{0x32e4, 0x3c60, 0x8001, 0x3550, 0x3452, 0xc18a, 0x3141, 0x3234, 0x8009, 0xf043, 0xf242, 0x2aff, 0x93b7, 0xf141, 0x00c6, 0x3e30 }, 16, 0x00088d60, 1},
-	{{0x8009, 0x2100, 0x83e8, 0x32e4, 0x3c4e, 0x8001, 0x6460, 0x34d0, 0x00c6, 0x3e3c, 0x8009, 0x32e4, 0x3c4e, 0x8001, 0x6460, 0x3650 }, 16, 0x00088d80, 1},
-	{{0xc18a, 0x2000, 0x83e8, 0x6c7d, 0x3224, 0x3fb0, 0x8009, 0x7454, 0x2660, 0x3550, 0xc18a, 0x3244, 0x2020, 0x8009, 0x7454, 0x3141 }, 16, 0x00088da0, 1},
-	{{0x3279, 0x8009, 0xf043, 0xf242, 0x2aff, 0x9365, 0xf141, 0x00c6, 0x3e48, 0x8009, 0x30c9, 0x8782, 0x3041, 0x3317, 0x8009, 0xf142 }, 16, 0x00088dc0, 1},
-	{{0x2aff, 0x934d, 0xf041, 0x2aff, 0x934d, 0x3840, 0x340f, 0x8009, 0xe770, 0x9f71, 0x3041, 0x2ff0, 0x8009, 0x9f70, 0x00c2, 0x37c0 }, 16, 0x00088de0, 1},
-	{{0x8009, 0x30e4, 0x2e60, 0x8008, 0x7479, 0x3324, 0x3f30, 0x8009, 0xb8c1, 0x90c0, 0x90f8, 0x3c10, 0x8030, 0x32e4, 0x3266, 0x8008 }, 16, 0x00088e00, 1},
-	{{0x7478, 0x2469, 0x3750, 0x3840, 0x333e, 0x8009, 0x800b, 0x2bff, 0x9305, 0x7456, 0x6460, 0x2aff, 0x9c6f, 0xc194, 0x2aff, 0x92f7 }, 16, 0x00088e20, 1},
-	{{0x3840, 0x3441, 0x8009, 0x3124, 0x3f50, 0x8009, 0x2c90, 0x39e8, 0x3c00, 0xbfff, 0xcc56, 0x1091, 0xcd57, 0x3128, 0x9f00, 0xdc38 }, 16, 0x00088e40, 1},
-	{{0x246e, 0xca87, 0xc940, 0xe748, 0xe961, 0xea89, 0x840c, 0xf942, 0xc948, 0x0900, 0xa400, 0xf042, 0x0986, 0x3a58, 0x8009, 0xf0c2 }, 16, 0x00088e60, 1},
-	{{0x1a91, 0x8002, 0x0c0a, 0xa001, 0x8010, 0x0900, 0xa200, 0x0910, 0xa010, 0xc181, 0x0910, 0xa001, 0x38c1, 0x0c0a, 0xa002, 0x800b }, 16, 0x00088e80, 1},
-	{{0x3cd2, 0x0910, 0xa020, 0xdc19, 0x3a00, 0x2048, 0x8008, 0x0940, 0xb800, 0x51d2, 0x0c41, 0xa000, 0x8025, 0x21a0, 0x9fff, 0x3551 }, 16, 0x00088ea0, 1},
-	{{0x1391, 0x80a0, 0xdc83, 0x0101, 0x80a0, 0x0986, 0x3a58, 0x8009, 0x90c0, 0x1191, 0x80a2, 0xdd01, 0x0201, 0x80a2, 0x2f10, 0x0986 }, 16, 0x00088ec0, 1},
-	{{0x3a58, 0x8009, 0xe768, 0x1391, 0x80a0, 0x36c9, 0x804e, 0x3cd9, 0x1291, 0x80a2, 0x36cb, 0x804f, 0x7dd8, 0xdc1b, 0xdc19, 0x34c9 }, 16, 0x00088ee0, 1},
-	{{0x804e, 0x34ca, 0x804f, 0x3d5a, 0x7cdb, 0xdc1a, 0xdc19, 0x4098, 0x0986, 0x3a58, 0x8009, 0x90c0, 0x1091, 0x80a2, 0x3119, 0x8003 }, 16, 0x00088f00, 1},
-	{{0x3cd4, 0x1791, 0x80a0, 0x30cb, 0x8086, 0x30ca, 0x8084, 0x3d46, 0x7dc4, 0x30c8, 0x8082, 0xd810, 0xdc19, 0x3ecc, 0x8084, 0x3ec9 }, 16, 0x00088f20, 1},
-	{{0x8082, 0x3cc8, 0x7e42, 0x3ecd, 0x8086, 0x3f1f, 0x8003, 0x7fcc, 0xdc1f, 0xdc19, 0xdc1a, 0xdc1b, 0xdc1c, 0xdc1d, 0x0090, 0xcd5f }, 16, 0x00088f40, 1},
-	{{0x0986, 0x3a58, 0x8009, 0x90c0, 0x1091, 0x8010, 0x3118, 0x80ff, 0x0010, 0x8005, 0x0610, 0x8004, 0x0986, 0x3a58, 0x8009, 0x90c0 }, 16, 0x00088f60, 1},
-	{{0x1091, 0x8012, 0x3118, 0x80ff, 0x0010, 0x8007, 0x0610, 0x8006, 0x0986, 0x3a58, 0x8009, 0xcc5e, 0x1091, 0x8038, 0x3118, 0x80ff }, 16, 0x00088f80, 1},
-	{{0x0010, 0x8009, 0x0986, 0x3a58, 0x8009, 0x90c0, 0x1091, 0x8038, 0x7c68, 0x0010, 0x8008, 0x0986, 0x3a58, 0x8009, 0x90c0, 0x1091 }, 16, 0x00088fa0, 1},
-	{{0x803a, 0x3118, 0x80ff, 0x0010, 0x800b, 0x0986, 0x3a58, 0x8009, 0x90c0, 0x1091, 0x803a, 0x7c68, 0x9f70, 0x0010, 0x800a, 0x38e8 }, 16, 0x00088fc0, 1},
-	{{0x3c00, 0xbfff, 0x2460, 0x00a0, 0x31f6, 0x8009, 0x34d0, 0x5090, 0x3128, 0x9f00, 0xdc38, 0x32e4, 0x3c4e, 0x8001, 0x3e10, 0x8018 }, 16, 0x00088fe0, 1},
-	{{0x0886, 0x3a58, 0x8009, 0xc940, 0x1090, 0x80b0, 0x3119, 0x800f, 0x3cc8, 0xe961, 0xc948, 0xdc19, 0x9f70, 0x6460, 0x0a86, 0x3a58 }, 16, 0x00089000, 1},
-	{{0x8009, 0x3119, 0x27fd, 0xbfff, 0x1292, 0x8064, 0xd912, 0x1092, 0x8060, 0xdd18, 0x0c80, 0xa000, 0xdd01, 0x800a, 0x0902, 0xa200 }, 16, 0x00089020, 1},
-	{{0x0902, 0xa002, 0x0298, 0x3119, 0x27ff, 0xbfff, 0x0a86, 0x3a58, 0x8009, 0x90c0, 0x1092, 0x8062, 0x4010, 0x0a86, 0x3a58, 0x8009 }, 16, 0x00089040, 1},
-	{{0x90c0, 0x1092, 0x8068, 0xb002, 0x0a86, 0x3a58, 0x8009, 0x90c0, 0x1092, 0x806a, 0xb003, 0x0a86, 0x3a58, 0x8009, 0x90c0, 0x1092 }, 16, 0x00089060, 1},
-	{{0x806c, 0xb004, 0x0a86, 0x3a58, 0x8009, 0x90c0, 0x1092, 0x806e, 0xb005, 0x0a86, 0x3a58, 0x8009, 0x90c0, 0x1092, 0x803c, 0xb006 }, 16, 0x00089080, 1},
-	{{0x0a86, 0x3a58, 0x8009, 0x90c0, 0x1092, 0x803e, 0xb007, 0x0a86, 0x3a58, 0x8009, 0x90c0, 0x1092, 0x8040, 0x0000, 0x8010, 0x0a86 }, 16, 0x000890a0, 1},
-	{{0x3a58, 0x8009, 0x90c0, 0x1092, 0x8042, 0x0000, 0x8012, 0x0a86, 0x3a58, 0x8009, 0x90c0, 0x1092, 0x8014, 0x0000, 0x8014, 0x0a86 }, 16, 0x000890c0, 1},
-	{{0x3a58, 0x8009, 0x90c0, 0x1092, 0x8016, 0x0000, 0x8016, 0x0a86, 0x3a58, 0x8009, 0x90c0, 0x1092, 0x8018, 0x0000, 0x8018, 0x0a86 }, 16, 0x000890e0, 1},
-	{{0x3a58, 0x8009, 0x90c0, 0x1092, 0x801a, 0x0000, 0x801a, 0x0886, 0x3a58, 0x8009, 0x90c0, 0x1290, 0x807c, 0xd912, 0x1090, 0x8078 }, 16, 0x00089100, 1},
-	{{0xdd18, 0x0c80, 0xa000, 0xdd01, 0x800a, 0x0902, 0xa200, 0x0902, 0xa002, 0x4299, 0x0a86, 0x3a58, 0x8009, 0x90c0, 0x1092, 0x807a }, 16, 0x00089120, 1},
-	{{0x4011, 0x0a86, 0x3a58, 0x8009, 0x90c0, 0x1092, 0x8080, 0xb00a, 0x0a86, 0x3a58, 0x8009, 0x90c0, 0x1092, 0x8082, 0xb00b, 0x0a86 }, 16, 0x00089140, 1},
-	{{0x3a58, 0x8009, 0x90c0, 0x1092, 0x8084, 0xb00c, 0x0a86, 0x3a58, 0x8009, 0x90c0, 0x1092, 0x8086, 0xb00d, 0x0a86, 0x3a58, 0x8009 }, 16, 0x00089160, 1},
-	{{0x90c0, 0x1092, 0x8044, 0xb00e, 0x0a86, 0x3a58, 0x8009, 0x90c0, 0x1092, 0x8046, 0xb00f, 0x0a86, 0x3a58, 0x8009, 0x90c0, 0x1092 }, 16, 0x00089180, 1},
-	{{0x8048, 0x0001, 0x8010, 0x0a86, 0x3a58, 0x8009, 0x90c0, 0x1092, 0x804a, 0x0001, 0x8012, 0x0a86, 0x3a58, 0x8009, 0x90c0, 0x1092 }, 16, 0x000891a0, 1},
-	{{0x801c, 0x0001, 0x8014, 0x0a86, 0x3a58, 0x8009, 0x90c0, 0x1092, 0x801e, 0x0001, 0x8016, 0x0a86, 0x3a58, 0x8009, 0x90c0, 0x1092 }, 16, 0x000891c0, 1},
-	{{0x8020, 0x0001, 0x8018, 0x0a86, 0x3a58, 0x8009, 0x90c0, 0x1092, 0x8022, 0x9f70, 0x0001, 0x801a, 0x39e8, 0x3c0c, 0xbfff, 0x30f9 }, 16, 0x000891e0, 1},
-	{{0x3ccc, 0xbf59, 0x0091, 0x38a8, 0x3c00, 0xbfff, 0x3001, 0x2020, 0x8020, 0x9f70, 0x4090, 0x0986, 0x3a54, 0x8009, 0x38a8, 0x3c20 }, 16, 0x00089200, 1},
-	{{0xbfff, 0x1091, 0x8028, 0x3841, 0xe748, 0x0001, 0x8028, 0x5090, 0x00c2, 0x3e2c, 0x8009, 0x9f7d, 0x0086, 0x3340, 0x8009, 0x2469 }, 16, 0x00089220, 1},
-	{{0xc0a2, 0x802b, 0x33e4, 0x3a68, 0x8001, 0xc184, 0x32e4, 0x3a62, 0x8001, 0xc0a2, 0x3244, 0x34f8, 0x8008, 0xc081, 0x3244, 0x34f8 }, 16, 0x00089240, 1},
-	{{0x8008, 0xc081, 0x6c10, 0x0082, 0x3340, 0x8009, 0x2784, 0x88b8, 0x90c0, 0x90c0, 0x90c8, 0x00a6, 0x28d8, 0x8009, 0x2469, 0x38c8 }, 16, 0x00089260, 1},
-	{{0x3000, 0xbfff, 0x8005, 0x4090, 0x00a6, 0x28e0, 0x8009, 0x2469, 0x38c8, 0x3400, 0xbfff, 0x8005, 0x4090, 0x01a6, 0x3598, 0x8009 }, 16, 0x00089280, 1},
-	{{0x24e9, 0x38c8, 0x2400, 0xbfff, 0x800d, 0x0190, 0xc081, 0x00a0, 0x37ac, 0x8009, 0x6c10, 0x00a2, 0x3598, 0x8009, 0x00a2, 0x28e0 }, 16, 0x000892a0, 1},
-	{{0x8009, 0x00a2, 0x28d8, 0x8009, 0x9f7c, 0x0886, 0x3a58, 0x8009, 0xc081, 0xb883, 0x0d08, 0xa020, 0x8009, 0x0001, 0x3a95, 0x800a }, 16, 0x000892c0, 1},
-	{{0x32e4, 0x394e, 0x8001, 0xc081, 0x30e1, 0x3990, 0x8001, 0xf041, 0xc182, 0x32e4, 0x395a, 0x8001, 0xc081, 0x2c10, 0xe768, 0x9f70 }, 16, 0x000892e0, 1},
-	{{0x0081, 0x3a5e, 0x8009, 0x08c6, 0x3e1c, 0x8009, 0x39a8, 0x3c20, 0xbfff, 0x00c5, 0x3e59, 0x8009, 0x3460, 0x1191, 0xe841, 0x2469 }, 16, 0x00089300, 1},
-	{{0xe748, 0x08c2, 0x3e1c, 0x8009, 0x803e, 0x01c2, 0x3e18, 0x8009, 0x646d, 0x8434, 0x00c1, 0x3e59, 0x8009, 0x32e4, 0x394e, 0x8001 }, 16, 0x00089320, 1},
-	{{0xc081, 0x3081, 0x3216, 0x8008, 0xf041, 0xc185, 0x32e4, 0x395a, 0x8001, 0xc081, 0xc081, 0x007c, 0x9fff, 0x32e4, 0x2bc0, 0x8008 }, 16, 0x00089340, 1},
-	{{0x31e1, 0x2664, 0x8000, 0x3344, 0x3b8c, 0x8008, 0x33c4, 0x3eaa, 0x8008, 0x0886, 0x3a58, 0x8009, 0x90c0, 0x1090, 0x8026, 0x6469 }, 16, 0x00089360, 1},
-	{{0x8425, 0x1090, 0x8024, 0x2469, 0x2c10, 0x3900, 0x23d8, 0x800a, 0x8415, 0x2704, 0x8060, 0x3800, 0x2198, 0x800a, 0x92d0, 0x4019 }, 16, 0x00089380, 1},
-	{{0x4018, 0x8809, 0x33c4, 0x33c0, 0x8008, 0xe768, 0x9f71, 0x3ba8, 0x3c24, 0xbfff, 0x38a8, 0x3c20, 0xbfff, 0x5993, 0x5190, 0x5293 }, 16, 0x000893a0, 1},
-	{{0xca42, 0x90c0, 0xeaa9, 0x85f5, 0x2c10, 0xc3a0, 0xd513, 0xd4c2, 0x9f70, 0x64e0, 0x2c10, 0xd021, 0x8424, 0xe748, 0x31e9, 0x3fff }, 16, 0x000893c0, 1},
-	{{0xbfff, 0x01c2, 0x3e24, 0x8009, 0x00c2, 0x3e40, 0x8009, 0x00c2, 0x3e38, 0x8009, 0x897c, 0x00c2, 0x3e20, 0x8009, 0xc081, 0x04c6 }, 16, 0x000893e0, 1},
-	{{0x3e38, 0x8009, 0xd640, 0x83a8, 0x04c2, 0x3e38, 0x8009, 0x02c6, 0x3e20, 0x8009, 0x2569, 0xf141, 0x8418, 0xf042, 0x38c8, 0x3c00 }, 16, 0x00089400, 1},
-	{{0xbfff, 0x90c0, 0x5890, 0x90c0, 0xe841, 0x08c2, 0x3e20, 0x8009, 0x02c6, 0x3e40, 0x8009, 0xd122, 0x805f, 0xd121, 0x8019, 0x2569 }, 16, 0x00089420, 1},
-	{{0x2c90, 0xc081, 0x84dd, 0x01c2, 0x3e50, 0x8009, 0x88d4, 0x00c2, 0x3e40, 0x8009, 0x9f7d, 0x35d1, 0x04c6, 0x3db4, 0x8009, 0x2660 }, 16, 0x00089440, 1},
-	{{0xc281, 0xda04, 0xd642, 0xd5c4, 0x3453, 0x01c6, 0x3e50, 0x8009, 0x38c1, 0x2460, 0x04c6, 0x3e24, 0x8009, 0x2660, 0x01c2, 0x3e50 }, 16, 0x00089460, 1},
-	{{0x8009, 0x3611, 0x8032, 0x6c7d, 0x8498, 0x04c2, 0x3e24, 0x8009, 0x9f7c, 0x8fba, 0xc082, 0x03c6, 0x3db4, 0x8009, 0x25e0, 0x39c8 }, 16, 0x00089480, 1},
-	{{0x3c00, 0xbfff, 0xd983, 0x1991, 0xc281, 0xd5c2, 0xd4c3, 0x24e0, 0x05c6, 0x3e24, 0x8009, 0x26e0, 0x08c6, 0x3e20, 0x8009, 0x6d7d }, 16, 0x000894a0, 1},
-	{{0xe9a8, 0x845e, 0x05c2, 0x3e24, 0x8009, 0x3a80, 0x8005, 0x3880, 0x8005, 0x3681, 0x8005, 0xd810, 0xd441, 0x01c6, 0x3e34, 0x8009 }, 16, 0x000894c0, 1},
-	{{0xd441, 0x32e4, 0x3c4e, 0x8001, 0x2460, 0x3121, 0x26c8, 0x8002, 0x2c90, 0xc840, 0x2900, 0x83e8, 0x3b00, 0x20dc, 0x8008, 0x3ac8 }, 16, 0x000894e0, 1},
-	{{0x3c00, 0xbfff, 0xe938, 0x0913, 0x01c2, 0x3e38, 0x8009, 0x1892, 0x01c2, 0x3e34, 0x8009, 0x90c0, 0xe841, 0x08c2, 0x3e20, 0x8009 }, 16, 0x00089500, 1},
-	{{0x9f7d, 0x0886, 0x3a58, 0x8009, 0x90c0, 0xb883, 0x0c08, 0xa001, 0x802f, 0x33c4, 0x2842, 0x8008, 0x6469, 0x8025, 0x2bff, 0x9e73 }, 16, 0x00089520, 1},
-	{{0x76d1, 0x9f78, 0x2bff, 0x9e6b, 0xd985, 0xc281, 0xd5c2, 0x00c6, 0x3e34, 0x8009, 0xd4c3, 0xd441, 0x00c2, 0x3e34, 0x8009, 0x9f7c }, 16, 0x00089540, 1},
-	{{0xf1c1, 0xf0c2, 0x01c2, 0x3db4, 0x8009, 0x00c2, 0x3db0, 0x8009, 0xe768, 0x9f71, 0x3084, 0x33d4, 0x8008, 0x6c10, 0x3650, 0xc586 }, 16, 0x00089560, 1},
-	{{0x20e0, 0x9fa6, 0x2c7c, 0x3455, 0x0866, 0x3fc4, 0x8004, 0x74e4, 0x6d7d, 0x74e5, 0x6c31, 0x7c41, 0xca40, 0x90c0, 0xea18, 0x9f70 }, 16, 0x00089580, 1},
-	{{0x50d2, 0x3324, 0x3f30, 0x8009, 0x32c4, 0x3996, 0x8008, 0xeee8, 0x0604, 0x3870, 0x800a, 0x3f63, 0xe8ee, 0x3284, 0x3fa0, 0x8008 }, 16, 0x000895a0, 1},
-	{{0x0986, 0x3a58, 0x8009, 0x2c10, 0x2f90, 0x38e0, 0x3f58, 0x8009, 0x2704, 0x8060, 0xb071, 0x92c8, 0x4718, 0x3f44, 0xc183, 0x2e0e }, 16, 0x000895c0, 1},
-	{{0x807e, 0x3457, 0x0986, 0x3a58, 0x8009, 0x32a4, 0x2c40, 0x8008, 0xcf41, 0x32a4, 0x28fa, 0x8008, 0x3457, 0x0986, 0x3a58, 0x8009 }, 16, 0x000895e0, 1},
-	{{0x2c10, 0x3bc1, 0x060e, 0xcf49, 0x38e1, 0x4016, 0x24ea, 0xee44, 0x4016, 0x81d0, 0x2e0e, 0x8092, 0x3900, 0x20f8, 0x8008, 0x3024 }, 16, 0x00089600, 1},
-	{{0x3f50, 0x8009, 0x4011, 0x3184, 0x3d30, 0x8008, 0x3324, 0x3f30, 0x8009, 0x270a, 0x8050, 0xe7ea, 0xfadc, 0xfbdb, 0x1552, 0xc84e }, 16, 0x00089620, 1},
-	{{0x1753, 0xf543, 0x32c4, 0x3996, 0x8008, 0xefe9, 0x1e90, 0x0ae6, 0x2024, 0x8009, 0x0b86, 0x3a58, 0x8009, 0xea41, 0x0ae2, 0x2024 }, 16, 0x00089640, 1},
-	{{0x8009, 0x1193, 0x8102, 0x1093, 0x8100, 0xd891, 0xdc98, 0x0c11, 0xa008, 0xf144, 0x802e, 0xc946, 0xc081, 0x0016, 0x811e, 0x0016 }, 16, 0x00089660, 1},
-	{{0x808a, 0x0016, 0x81b2, 0x0886, 0x3a58, 0x8009, 0x30f8, 0x3fff, 0xbff7, 0xdc01, 0xc2f7, 0xf044, 0x1090, 0x8102, 0xdd00, 0x0200 }, 16, 0x00089680, 1},
-	{{0x8102, 0xff41, 0x3284, 0x3f50, 0x8008, 0xe8ee, 0xf9dd, 0xf945, 0x8376, 0x1011, 0x1106, 0x82a0, 0xf1c4, 0x0c01, 0xa002, 0x3451 }, 16, 0x000896a0, 1},
-	{{0x0006, 0x82a0, 0x2618, 0x8646, 0xf5c3, 0x0c00, 0xa001, 0x800d, 0x33a4, 0x2370, 0x8008, 0x2118, 0x8634, 0x3108, 0x8200, 0x2461 }, 16, 0x000896c0, 1},
-	{{0x2f10, 0xc283, 0x2469, 0xf046, 0x2718, 0x83c2, 0x2e09, 0x801c, 0x290d, 0x8042, 0xf947, 0x2d08, 0x803a, 0xe9e8, 0xe964, 0x2a00 }, 16, 0x000896e0, 1},
-	{{0x8044, 0xf949, 0xe9e8, 0xe93a, 0xf94a, 0xf9c7, 0x2a00, 0x806c, 0xf94b, 0xe9e8, 0xe93a, 0xf94c, 0x2900, 0x804c, 0xefe8, 0xef39 }, 16, 0x00089700, 1},
-	{{0x2900, 0x8050, 0xeae8, 0xea39, 0xc9a8, 0xece8, 0xec39, 0xe9e8, 0xebe8, 0xe97e, 0x331b, 0x8010, 0xfd48, 0xeb6e, 0xf94d, 0x3456 }, 16, 0x00089720, 1},
-	{{0xf9cb, 0xf24e, 0xf34f, 0xf850, 0xfa51, 0xfb52, 0x32a4, 0x2b24, 0x8008, 0xfc53, 0xf9cd, 0xf3cf, 0x25e9, 0x0011, 0xfcd3, 0xfbd2 }, 16, 0x00089740, 1},
-	{{0x8406, 0xfad1, 0x4014, 0x90bb, 0x2469, 0x2c90, 0x7456, 0x8037, 0x919b, 0x0192, 0xf9cc, 0x4197, 0x0191, 0xf9ca, 0x2100, 0x8200 }, 16, 0x00089760, 1},
-	{{0x4191, 0x32a4, 0x28fa, 0x8008, 0x0986, 0x3a58, 0x8009, 0x2c10, 0xf9c9, 0xf8d0, 0x0091, 0xf3cf, 0x0090, 0xfad1, 0xf2ce, 0xfbd2 }, 16, 0x00089780, 1},
-	{{0x8828, 0xfcd3, 0x3456, 0xf9c5, 0xfdc8, 0x1111, 0xf9cd, 0x5415, 0x1411, 0xf401, 0x32a4, 0x2a84, 0x8008, 0xf402, 0xf2ce, 0xf3cf }, 16, 0x000897a0, 1},
-	{{0xf8d0, 0xfad1, 0xfbd2, 0xfcd3, 0x3961, 0x3b41, 0xf9cd, 0x256a, 0xfdc8, 0x2909, 0x8094, 0xf94d, 0xf9cc, 0x2d0d, 0x8094, 0x2909 }, 16, 0x000897c0, 1},
-	{{0x8094, 0xf94c, 0xf9ca, 0x2b0b, 0x8094, 0x2909, 0x8094, 0xf94a, 0xf9c9, 0x2a0a, 0x8094, 0x2909, 0x8094, 0xf949, 0xf9cb, 0x2f0f }, 16, 0x000897e0, 1},
-	{{0x8094, 0x2909, 0x8094, 0x2808, 0x8094, 0x2c0c, 0x8094, 0xfd48, 0x812e, 0xf94b, 0x1086, 0x8020, 0x3204, 0x39fe, 0x8009, 0xb071 }, 16, 0x00089800, 1},
-	{{0x3304, 0x3a0a, 0x8009, 0x3304, 0x3a16, 0x8009, 0x3304, 0x3a2e, 0x8009, 0x3304, 0x3a3a, 0x8009, 0x3304, 0x3a46, 0x8009, 0x3304 }, 16, 0x00089820, 1},
-	{{0x3a5e, 0x8009, 0x3304, 0x3a6a, 0x8009, 0x3304, 0x3a76, 0x8009, 0xf9c7, 0x1806, 0x827a, 0x290a, 0x805c, 0x1906, 0x8278, 0x0906 }, 16, 0x00089840, 1},
-	{{0x8286, 0x0906, 0x827c, 0x2900, 0x8058, 0xedea, 0xed39, 0xefea, 0xf5c3, 0xebea, 0xecea, 0xf9c7, 0x0806, 0x8288, 0x0806, 0x805e }, 16, 0x00089860, 1},
-	{{0x38e0, 0x2050, 0x8009, 0xc683, 0xef64, 0xeb62, 0xec7a, 0xf848, 0xf949, 0x0796, 0x80f2, 0x0596, 0x8186, 0x1010, 0xe8ee, 0xf001 }, 16, 0x00089880, 1},
-	{{0xfa4a, 0xfb4b, 0xfc4c, 0x3284, 0x3d50, 0x8008, 0xfd4d, 0x2469, 0xfdcd, 0x800e, 0xfccc, 0x20a0, 0x9fff, 0x5195, 0xdc01, 0x4095 }, 16, 0x000898a0, 1},
-	{{0x90c0, 0x1014, 0x38e0, 0x2028, 0x8009, 0xb3b6, 0x3719, 0x8003, 0x3cc1, 0xc28e, 0xc941, 0x371b, 0x801c, 0x3de2, 0xe918, 0x2d3d }, 16, 0x000898c0, 1},
-	{{0x5111, 0x6831, 0x3284, 0x3f30, 0x8008, 0xd41a, 0xfccc, 0xfbcb, 0x4014, 0x2aff, 0x9d35, 0x5113, 0x3550, 0x1017, 0xfbcb, 0xfaca }, 16, 0x000898e0, 1},
-	{{0x4213, 0x2aff, 0x9d25, 0x5112, 0x3b61, 0xfaca, 0x276a, 0xf8c8, 0x0012, 0xf9c9, 0xfccc, 0xfbcb, 0xfdcd, 0x2909, 0x8094, 0xe854 }, 16, 0x00089900, 1},
-	{{0x2d0d, 0x8094, 0x2c0c, 0x8094, 0x2b0b, 0x8094, 0x2f0f, 0x8094, 0x2a0a, 0x8094, 0xf848, 0x8164, 0xf949, 0xf0c4, 0x0d00, 0xa200 }, 16, 0x00089920, 1},
-	{{0x2480, 0x8001, 0x1006, 0x827c, 0x6c7c, 0x801e, 0x34d4, 0x0406, 0x827c, 0xf9c7, 0x1006, 0x8010, 0x2908, 0x8258, 0x3284, 0x3f10 }, 16, 0x00089940, 1},
-	{{0x8008, 0xf841, 0x0006, 0x827c, 0x3304, 0x3a8e, 0x8009, 0x2c90, 0xf0c4, 0x0c00, 0xa080, 0x1806, 0x827c, 0x1006, 0x8016, 0x8020 }, 16, 0x00089960, 1},
-	{{0x3540, 0x0806, 0x828a, 0x1006, 0x8286, 0x2832, 0x0206, 0x8016, 0x7c6f, 0x0006, 0x8286, 0x883c, 0x0100, 0x27a8, 0x800a, 0x7c41 }, 16, 0x00089980, 1},
-	{{0x2160, 0x9fff, 0x32a4, 0x3610, 0x8008, 0x7841, 0x1106, 0x827c, 0x2831, 0x0006, 0x8016, 0x3c6f, 0x38e0, 0x3dac, 0x8009, 0x0006 }, 16, 0x000899a0, 1},
-	{{0x8286, 0x0000, 0x27a8, 0x800a, 0x3204, 0x24a0, 0x8009, 0x1106, 0x8296, 0x2f10, 0xfac7, 0xc283, 0x2a0b, 0x805e, 0x3fe0, 0x2050 }, 16, 0x000899c0, 1},
-	{{0x8009, 0x90c0, 0x34d6, 0x1913, 0xeb70, 0x0913, 0xf9c5, 0x2b0b, 0x80a4, 0x1011, 0xe8ee, 0xf001, 0xf247, 0xfa48, 0x32a4, 0x24c0 }, 16, 0x000899e0, 1},
-	{{0x8008, 0xfb49, 0x32a4, 0x2cf2, 0x8008, 0x3456, 0xe9ee, 0x0017, 0xfac8, 0x3284, 0x3e40, 0x8008, 0xe8ea, 0x3b41, 0xf2c7, 0x3961 }, 16, 0x00089a00, 1},
-	{{0xfac8, 0x256a, 0xef54, 0x2a0a, 0x8094, 0xf5c3, 0x81b6, 0xfbc9, 0x3800, 0x20e6, 0x8008, 0x1086, 0x8020, 0xb071, 0x30c8, 0x80dc }, 16, 0x00089a20, 1},
-	{{0x0010, 0x3900, 0x20ee, 0x8008, 0x1cd0, 0x0886, 0x3a54, 0x8009, 0x3a00, 0x20f0, 0x8008, 0x0c00, 0x803a, 0xb0f1, 0x3188, 0x8000 }, 16, 0x00089a40, 1},
-	{{0x30c8, 0x805f, 0x0011, 0x3b00, 0x20f2, 0x8008, 0x19d1, 0x0886, 0x3a54, 0x8009, 0x90c0, 0x0900, 0x8042, 0xb0f1, 0x3108, 0x8800 }, 16, 0x00089a60, 1},
-	{{0x7c7b, 0x4012, 0x19d2, 0x0886, 0x3a54, 0x8009, 0x90c0, 0x0900, 0x8044, 0xb0f1, 0x3158, 0x8000, 0x7c6e, 0x4013, 0x19d3, 0x0886 }, 16, 0x00089a80, 1},
-	{{0x3a54, 0x8009, 0x90c0, 0x0900, 0x8046, 0x2e0c, 0x8020, 0x2c08, 0x8046, 0x2809, 0x800e, 0x2b03, 0x8012, 0x9343, 0xeae9, 0x2b02 }, 16, 0x00089aa0, 1},
-	{{0x804a, 0x2a02, 0x8025, 0xea64, 0x103a, 0x5110, 0x4039, 0x1006, 0x82a0, 0x3610, 0x81ff, 0x8021, 0x0b86, 0x3a58, 0x8009, 0x90c0 }, 16, 0x00089ac0, 1},
-	{{0x1003, 0x8126, 0x6464, 0x30f0, 0x1194, 0x3081, 0x2000, 0x8000, 0x8007, 0x880e, 0xdc19, 0x1194, 0x3078, 0x3fff, 0xbfff, 0xdc01 }, 16, 0x00089ae0, 1},
-	{{0x94d0, 0x2808, 0x8094, 0x40b4, 0x90c0, 0x1086, 0x8020, 0x0c80, 0xa000, 0xb071, 0x800e, 0xb1f2, 0x3081, 0x2000, 0x8000, 0x880c }, 16, 0x00089b00, 1},
-	{{0xdc19, 0x3078, 0x3fff, 0xbfff, 0xdc01, 0xb072, 0xf0c4, 0x0d00, 0xa020, 0x80d5, 0x35d7, 0xf0c6, 0x2469, 0x1086, 0x8298, 0x8061 }, 16, 0x00089b20, 1},
-	{{0x0996, 0x827a, 0x2174, 0x3800, 0x249c, 0x800a, 0x2d74, 0x74d5, 0x7442, 0x7c48, 0x6465, 0x7c48, 0x7458, 0x0003, 0x27aa, 0x800a }, 16, 0x00089b40, 1},
-	{{0x1906, 0x8278, 0x0900, 0x27a8, 0x800a, 0x1686, 0x8298, 0x3456, 0x3556, 0x7656, 0x2074, 0x60f5, 0x2cf7, 0x6c76, 0x3440, 0x74c1 }, 16, 0x00089b60, 1},
-	{{0x3c48, 0x7cc8, 0x24e5, 0x6465, 0x3c48, 0x7cc8, 0x34d9, 0x7458, 0xd899, 0x32c4, 0x2b88, 0x8008, 0x00fe, 0x9ffe, 0x8859, 0x0996 }, 16, 0x00089b80, 1},
-	{{0x8074, 0x2174, 0x3800, 0x249c, 0x800a, 0x6d74, 0x7442, 0x7c48, 0x6465, 0x7c48, 0x7458, 0x0003, 0x27aa, 0x800a, 0x1286, 0x8298 }, 16, 0x00089ba0, 1},
-	{{0x3452, 0x0996, 0x8108, 0x2274, 0x3452, 0x0b96, 0x819c, 0x2e74, 0x6075, 0x2c75, 0x74c4, 0x3440, 0x7cc8, 0x3c48, 0x64e5, 0x2465 }, 16, 0x00089bc0, 1},
-	{{0x7cc8, 0x3c48, 0x74d9, 0x3458, 0xd899, 0x32c4, 0x2b88, 0x8008, 0x00fe, 0x9ffe, 0xf0c6, 0x2469, 0x0804, 0x27ac, 0x800a, 0x8082 }, 16, 0x00089be0, 1},
-	{{0x0806, 0x8288, 0x8907, 0x0886, 0x3a58, 0x8009, 0x1106, 0x801c, 0xb884, 0x0c08, 0xa001, 0x800b, 0x1806, 0x8074, 0x8806, 0xc848 }, 16, 0x00089c00, 1},
-	{{0x6c10, 0x2931, 0x1006, 0x80b0, 0x0206, 0x8288, 0x0886, 0x3a58, 0x8009, 0x90c0, 0xb884, 0x0c08, 0xa002, 0x800b, 0x1806, 0x8108 }, 16, 0x00089c20, 1},
-	{{0x8806, 0xc849, 0x6c90, 0x28b1, 0xd812, 0x3571, 0x2461, 0x1106, 0x8144, 0xd912, 0x6c52, 0x0096, 0x8288, 0x0886, 0x3a58, 0x8009 }, 16, 0x00089c40, 1},
-	{{0x90c0, 0xb884, 0x0c08, 0xa004, 0x800b, 0x1806, 0x819c, 0x8806, 0xc84a, 0x6d10, 0x68b8, 0xd891, 0x64e1, 0x6c51, 0x0096, 0x8288 }, 16, 0x00089c60, 1},
-	{{0xb1b6, 0x3204, 0x2502, 0x8009, 0x38e0, 0x2bb8, 0x8009, 0xf0c4, 0x0c00, 0xa100, 0x800a, 0x1006, 0x8018, 0x8812, 0x7440, 0x7c41 }, 16, 0x00089c80, 1},
-	{{0x2160, 0x9fff, 0x32a4, 0x3610, 0x8008, 0x7841, 0x0006, 0x8018, 0x1006, 0x8018, 0x1106, 0x8288, 0x2831, 0x1106, 0x829e, 0x7c6f }, 16, 0x00089ca0, 1},
-	{{0x2aff, 0x9967, 0x3470, 0x0006, 0x8288, 0x3550, 0x1006, 0x828a, 0x1106, 0x829c, 0x2aff, 0x9953, 0x0206, 0x829e, 0x2e0f, 0x8054 }, 16, 0x00089cc0, 1},
-	{{0xc683, 0x0006, 0x829c, 0x38e0, 0x2056, 0x8009, 0x1097, 0xef6c, 0x1197, 0xc84f, 0x32a4, 0x2c0e, 0x8008, 0x2f0f, 0x80a0, 0x3b61 }, 16, 0x00089ce0, 1},
-	{{0xc847, 0x676a, 0x4010, 0x81e6, 0xe854, 0xf0c4, 0x0096, 0xf0de, 0xf041, 0xf9c5, 0x3284, 0x3f70, 0x8008, 0xe8ee, 0x27e8, 0x9fb0 }, 16, 0x00089d00, 1},
-	{{0x3024, 0x3f50, 0x8009, 0xe7e8, 0x90c0, 0x90c0, 0x90c0, 0x90c0, 0x6466, 0x30f0, 0x2eb1, 0x7cc1, 0x92c2, 0x7ee9, 0xd6c1, 0x94c0 }, 16, 0x00089d20, 1},
-	{{0x7545, 0x9f70, 0x7472, 0x90c0, 0x90c0, 0x90c0, 0x90c0, 0x90c0, 0x96c0, 0x6f90, 0x9620, 0x9720, 0x94c0, 0x9e20, 0x9f20, 0x96c0 }, 16, 0x00089d40, 1},
-	{{0xc84e, 0x290f, 0x8030, 0x32a4, 0x35c0, 0x8008, 0x5097, 0x96c0, 0x67e0, 0xc846, 0xecef, 0x90c0, 0x96c0, 0xc8ac, 0x280e, 0x8292 }, 16, 0x00089d60, 1},
-	{{0x5216, 0x3170, 0xec38, 0x94c0, 0x5094, 0x80ab, 0x310c, 0x8800, 0x6669, 0x94c0, 0xf68d, 0x840f, 0x6769, 0x94c6, 0x8099, 0x6c10 }, 16, 0x00089d80, 1},
-	{{0x94c0, 0xcaa0, 0xebef, 0x90c0, 0x98c0, 0xeb3a, 0x32a4, 0x35c0, 0x8008, 0x5093, 0x3750, 0xedef, 0x98c0, 0xed64, 0x32a4, 0x35c0 }, 16, 0x00089da0, 1},
-	{{0x8008, 0x5095, 0x9cc0, 0x6e02, 0x67e0, 0x6f10, 0xee42, 0x2f09, 0x8034, 0x5016, 0x3074, 0x5011, 0x94c0, 0x7841, 0x801b, 0x35f0 }, 16, 0x00089dc0, 1},
-	{{0x4011, 0x3613, 0x802f, 0x840f, 0x98c0, 0xc781, 0x3184, 0x3df4, 0x8008, 0x4611, 0x96c0, 0xd3a1, 0xeee9, 0xe8e9, 0x94c7, 0xee64 }, 16, 0x00089de0, 1},
-	{{0x6f10, 0x94c6, 0xe864, 0x5416, 0x94c1, 0x4616, 0x7a41, 0x98c6, 0x280c, 0x8002, 0x90c0, 0x4416, 0x1010, 0x5114, 0x7071, 0x92c2 }, 16, 0x00089e00, 1},
-	{{0x6f10, 0x94c2, 0xe94a, 0xc081, 0x92c2, 0x4610, 0x92c2, 0x9099, 0x7457, 0x94c0, 0x9e21, 0x9f21, 0x94c0, 0x9621, 0x9721, 0x9f71 }, 16, 0x00089e20, 1},
-	{{0xe844, 0x5190, 0x98c0, 0x339f, 0x8000, 0x9620, 0x9720, 0x96c0, 0x67e9, 0x9e20, 0xc84e, 0x96c0, 0x84a7, 0x280e, 0x8008, 0x32a4 }, 16, 0x00089e40, 1},
-	{{0x35c0, 0x8008, 0x5096, 0x9ac0, 0x77d0, 0xee44, 0x32a4, 0x35c0, 0x8008, 0x5096, 0x98c0, 0x2e0d, 0x802c, 0x6c03, 0xc846, 0x96c0 }, 16, 0x00089e60, 1},
-	{{0x7650, 0x2d0e, 0x8016, 0x3e41, 0xeaee, 0x2661, 0xea74, 0x6ec0, 0x3b03, 0x8004, 0x7de3, 0x4315, 0x1612, 0x03e4, 0x204c, 0x8009 }, 16, 0x00089e80, 1},
-	{{0x31f6, 0x3b41, 0x5316, 0x8424, 0x9ac0, 0x36cd, 0x9608, 0x90c0, 0x371f, 0x80ff, 0x0612, 0xee72, 0x32a4, 0x3630, 0x8008, 0x1015 }, 16, 0x00089ea0, 1},
-	{{0x5116, 0x0016, 0x3184, 0x3efc, 0x8008, 0xe9ee, 0x94c0, 0xe972, 0xee6e, 0x5311, 0x32f3, 0x5316, 0x94c0, 0x79c1, 0x801f, 0x3573 }, 16, 0x00089ec0, 1},
-	{{0x0316, 0xc5df, 0x33f2, 0x6d10, 0x800f, 0x4216, 0x5190, 0x0941, 0xa000, 0xde81, 0x4590, 0x6c90, 0x4112, 0x4111, 0x9e21, 0x94c0 }, 16, 0x00089ee0, 1},
-	{{0x9621, 0x9721, 0x9f71, 0x90c0, 0x90c0, 0x90c0, 0x90c0, 0x90c0, 0x96c0, 0xd991, 0xd890, 0xfcc3, 0x90c0, 0x5094, 0x6174, 0x6d74 }, 16, 0x00089f00, 1},
-	{{0x6e32, 0x6219, 0x96c0, 0x71cc, 0x4494, 0x9f70, 0xd81b, 0x90c0, 0x32a4, 0x3600, 0x8008, 0x2160, 0x9fff, 0x30a4, 0x3630, 0x8008 }, 16, 0x00089f20, 1},
-	{{0x2180, 0x8001, 0x90c0, 0x90c0, 0x90c0, 0x90c0, 0x90c0, 0x90c0, 0x96c0, 0xfcc3, 0x280a, 0x8278, 0x5211, 0x421a, 0x5114, 0x4112 }, 16, 0x00089f40, 1},
-	{{0x94c0, 0xea4e, 0x9f70, 0x4112, 0x90c0, 0x90c0, 0x90c0, 0x90c0, 0x96c0, 0xfcc3, 0x2808, 0x8286, 0x1310, 0xe84a, 0x0311, 0xeae8 }, 16, 0x00089f60, 1},
-	{{0xea68, 0x5412, 0x94c0, 0x4410, 0x9f70, 0x4414, 0x90c0, 0x90c0, 0x98c0, 0x3800, 0x35c0, 0x800a, 0x9f71, 0x90c0, 0x90c0, 0x90c0 }, 16, 0x00089f80, 1},
-	{{0x96c0, 0x6c90, 0x9620, 0x9720, 0x94c0, 0x9e20, 0x9f20, 0x96c0, 0xe750, 0x2500, 0x82a4, 0x98c0, 0xc94e, 0x32e4, 0x3c8a, 0x8001 }, 16, 0x00089fa0, 1},
-	{{0x94c0, 0xf541, 0xf843, 0x9ac0, 0x6f90, 0x6d10, 0x6c90, 0xc946, 0xfac3, 0x3a40, 0xa000, 0x6d90, 0xcbaa, 0x2d00, 0x81ae, 0x9ac0 }, 16, 0x00089fc0, 1},
-	{{0x2908, 0x810c, 0x90c0, 0x2a0b, 0x800c, 0x3820, 0xa000, 0x55d0, 0x280c, 0x8002, 0x3820, 0xa000, 0x451b, 0x2c0f, 0x802c, 0x14d4 }, 16, 0x00089fe0, 1},
-	{{0xccb2, 0x96c0, 0x4413, 0x2900, 0x811a, 0x96c0, 0xeb48, 0x2002, 0x8242, 0x3840, 0xa000, 0x471b, 0x2400, 0x8200, 0x96c0, 0x4713 }, 16, 0x0008a000, 1},
-	{{0x2b0e, 0x827a, 0x3840, 0xa000, 0x561f, 0x2000, 0x80ff, 0x061e, 0xebef, 0x1517, 0xeb3c, 0x3600, 0xa100, 0x451e, 0xedef, 0x3600 }, 16, 0x0008a020, 1},
-	{{0xa100, 0xecee, 0xeeee, 0x3680, 0xa100, 0xecee, 0xefee, 0x3600, 0xa100, 0x5413, 0xec39, 0x3640, 0xa100, 0xec3d, 0xee38, 0x3680 }, 16, 0x0008a040, 1},
-	{{0xa000, 0xef6a, 0x4416, 0x3640, 0xa100, 0xc69e, 0x4097, 0x38e0, 0xa000, 0x7656, 0x4494, 0x4496, 0x36e0, 0xa100, 0x4494, 0xed3b }, 16, 0x0008a060, 1},
-	{{0x3a80, 0xa000, 0x5015, 0x3500, 0x2000, 0xbfe0, 0x9cc0, 0x6c7d, 0x7455, 0x3708, 0x2000, 0x8170, 0xf844, 0x3754, 0x32e4, 0x3e52 }, 16, 0x0008a080, 1},
-	{{0x8001, 0x2e7c, 0x7557, 0x32e4, 0x3ea0, 0x8001, 0x37d0, 0x3456, 0x7751, 0x2760, 0x3550, 0x35d1, 0x3457, 0x32e4, 0x3eac, 0x8001 }, 16, 0x0008a0a0, 1},
-	{{0x74d6, 0x33e4, 0x3ebe, 0x8001, 0x3304, 0x2a86, 0x8009, 0x98c0, 0x2e09, 0x8002, 0x6e10, 0xf8c4, 0x0091, 0xfac3, 0x3a00, 0xa100 }, 16, 0x0008a0c0, 1},
-	{{0x0204, 0x3870, 0x800a, 0xe8e8, 0x3880, 0xa000, 0x7d45, 0xe86a, 0xe86c, 0x3a00, 0xa100, 0x02e0, 0x204c, 0x8009, 0xeee9, 0x3600 }, 16, 0x0008a0e0, 1},
-	{{0xa100, 0x56d0, 0x52d0, 0x9ac0, 0x2002, 0x81e0, 0xdb16, 0x2402, 0x822a, 0x9ac0, 0x2d00, 0x8196, 0xdf1a, 0x2b00, 0x8102, 0x0692 }, 16, 0x0008a100, 1},
-	{{0xe8e9, 0x36a0, 0xa000, 0xee38, 0xece9, 0x96c0, 0xef6e, 0x2002, 0x821a, 0x96c0, 0x5617, 0x2302, 0x80f4, 0x94c0, 0xe83d, 0xec3b }, 16, 0x0008a120, 1},
-	{{0x96c0, 0x4610, 0x2102, 0x814c, 0x94c0, 0xebe9, 0xe8e9, 0x36c0, 0xa000, 0xefe9, 0xeb38, 0x3660, 0xa100, 0xe839, 0xef3c, 0x3880 }, 16, 0x0008a140, 1},
-	{{0xa000, 0xe8e9, 0x2102, 0x8188, 0x96c0, 0x4614, 0x2202, 0x8274, 0x3680, 0xa000, 0x4617, 0xc188, 0x3aa0, 0xa000, 0xe83b, 0x01e0 }, 16, 0x0008a160, 1},
-	{{0x2030, 0x8009, 0x96c0, 0xece9, 0x2300, 0x8200, 0x3880, 0xa000, 0xebe9, 0x2502, 0x80f0, 0x3880, 0xa000, 0x4396, 0x2702, 0x821c }, 16, 0x0008a180, 1},
-	{{0x3660, 0xa100, 0xec3a, 0xeb39, 0x96c0, 0x4390, 0x2202, 0x8184, 0x3880, 0xa000, 0xe9e9, 0x2800, 0x80f2, 0x3880, 0xa000, 0xeee9 }, 16, 0x0008a1a0, 1},
-	{{0x2402, 0x8218, 0x96c0, 0x4394, 0x2c00, 0x8186, 0x36e0, 0xa100, 0xe93f, 0xee3d, 0x98c0, 0xeae9, 0x0504, 0x3870, 0x800a, 0x98c0 }, 16, 0x0008a1c0, 1},
-	{{0x3e15, 0x8014, 0xea38, 0xede9, 0x3680, 0xa100, 0xede9, 0xefe9, 0x3640, 0xa100, 0xe8ef, 0xef3a, 0x36a0, 0xa000, 0xed3c, 0xed3c }, 16, 0x0008a1e0, 1},
-	{{0x3680, 0xa100, 0x4410, 0x4413, 0x3680, 0xa100, 0x4415, 0x4411, 0x3680, 0xa100, 0x4417, 0x4416, 0x0513, 0x4512, 0x0515, 0xe87e }, 16, 0x0008a200, 1},
-	{{0x10d0, 0xc483, 0x9ac0, 0x2000, 0x812c, 0x6c7c, 0x2200, 0x8c91, 0x2c7d, 0x3120, 0x243f, 0x8003, 0x9ac0, 0x3422, 0x8004, 0x68a8 }, 16, 0x0008a220, 1},
-	{{0x3623, 0x8004, 0x9ac0, 0xd812, 0x7cea, 0x0404, 0x3870, 0x800a, 0x96c0, 0xd443, 0x2200, 0x83e8, 0x32e4, 0x3c48, 0x8001, 0x2888 }, 16, 0x0008a240, 1},
-	{{0x6461, 0x98c0, 0x2800, 0x8288, 0x7c48, 0xef54, 0x2465, 0xc184, 0x3c48, 0xe938, 0x7458, 0x0051, 0x32a4, 0x3630, 0x8008, 0x5017 }, 16, 0x0008a260, 1},
-	{{0x2469, 0x2d10, 0x1017, 0xc184, 0x8013, 0x33a4, 0x3630, 0x8008, 0xd990, 0xd213, 0x7674, 0x3902, 0x800e, 0x9ac0, 0x7472, 0x0204 }, 16, 0x0008a280, 1},
-	{{0x3870, 0x800a, 0xc581, 0x9cc0, 0x656a, 0x7655, 0xc688, 0x0d86, 0x3a58, 0x8009, 0x96c7, 0x6c7c, 0x7947, 0xc18f, 0x9cc0, 0x7d63 }, 16, 0x0008a2a0, 1},
-	{{0x76d4, 0x3be0, 0x2034, 0x8009, 0xc381, 0x9cc0, 0x6e7d, 0x2d0f, 0x8024, 0x6d7d, 0x2800, 0x827a, 0x9ac0, 0x7f41, 0x6ca5, 0xecee }, 16, 0x0008a2c0, 1},
-	{{0x2900, 0x81e6, 0x96c0, 0xd591, 0xcd46, 0xec38, 0x98c0, 0x03e0, 0x2048, 0x8009, 0xe8ee, 0x94c0, 0xed1b, 0xe839, 0x96c0, 0x5315 }, 16, 0x0008a2e0, 1},
-	{{0x2d00, 0x8152, 0x98c0, 0x03e0, 0x2046, 0x8009, 0xe770, 0x98c0, 0x03e0, 0x204a, 0x8009, 0xee3d, 0x54d7, 0x6669, 0x92c2, 0x6d10 }, 16, 0x0008a300, 1},
-	{{0x92c3, 0xc281, 0x4214, 0x0b86, 0x3a58, 0x8009, 0x90c0, 0x2b09, 0x8028, 0x54d1, 0x6669, 0x92c2, 0x6c90, 0x92c3, 0xc181, 0x4110 }, 16, 0x0008a320, 1},
-	{{0x0b86, 0x3a58, 0x8009, 0x90c0, 0x2b09, 0x802a, 0x52d1, 0x6569, 0x92c2, 0x6f10, 0x92c3, 0xc681, 0x4616, 0x94c0, 0x9e21, 0x9f21 }, 16, 0x0008a340, 1},
-	{{0x94c0, 0x9621, 0x9721, 0x9f71, 0x90c0, 0x90c0, 0x90c0, 0x90c0, 0x94c0, 0x9620, 0x9720, 0x32c4, 0x3996, 0x8008, 0x9f20, 0x1f90 }, 16, 0x0008a360, 1},
-	{{0x0986, 0x3a58, 0x8009, 0x90c0, 0x1197, 0xe8ef, 0x3318, 0x8001, 0x2469, 0x6c10, 0x8051, 0x3384, 0x3fa0, 0x8008, 0x2f10, 0xc783 }, 16, 0x0008a380, 1},
-	{{0x32a4, 0x2c40, 0x8008, 0x3456, 0x0986, 0x3a58, 0x8009, 0x32a4, 0x28fa, 0x8008, 0x3456, 0x0986, 0x3a58, 0x8009, 0x3be1, 0x7b41 }, 16, 0x0008a3a0, 1},
-	{{0x67ea, 0x81df, 0x98c0, 0x0a86, 0x3a58, 0x8009, 0xc1fe, 0x94c0, 0xc2fe, 0xc081, 0x2a09, 0x8100, 0x55d1, 0xdc85, 0x4111, 0x5397 }, 16, 0x0008a3c0, 1},
-	{{0xdd03, 0x4297, 0x9f21, 0x94c0, 0x9621, 0x9721, 0x9f71, 0x90c0, 0x2468, 0x7650, 0x8438, 0x92c3, 0xc0ff, 0x9cc0, 0x6669, 0xd294 }, 16, 0x0008a3e0, 1},
-	{{0x3c40, 0x3a06, 0x8009, 0xc39e, 0x96c6, 0x66e4, 0x6c10, 0x8025, 0x2dad, 0xd615, 0x96c0, 0x38cd, 0x8210, 0x7dc8, 0xcd45, 0x90c0 }, 16, 0x0008a400, 1},
-	{{0xedf9, 0xed1c, 0x9dbd, 0xcd4a, 0x7472, 0xd443, 0x9f71, 0x90c0, 0x96c0, 0x6931, 0x9620, 0x9720, 0x94c0, 0x9e20, 0x9f20, 0x98c0 }, 16, 0x0008a420, 1},
-	{{0x3681, 0x2000, 0x8000, 0xf593, 0x98c0, 0x03fc, 0x9fd8, 0x767e, 0xf0c9, 0x2cb5, 0x6375, 0x3cc8, 0x6f75, 0x64e5, 0x7cc8, 0x74d9 }, 16, 0x0008a440, 1},
-	{{0x6174, 0x6d74, 0x6f4a, 0x3456, 0x32a4, 0x35c0, 0x8008, 0x6466, 0x94c0, 0xcf40, 0xf0c7, 0x32a4, 0x35c0, 0x8008, 0xeffc, 0x32a4 }, 16, 0x0008a460, 1},
-	{{0x3620, 0x8008, 0xf197, 0x32a4, 0x35c0, 0x8008, 0x94c0, 0xce40, 0xf0c8, 0x32a4, 0x3620, 0x8008, 0xf197, 0x98c0, 0x74d0, 0x7456 }, 16, 0x0008a480, 1},
-	{{0xef3e, 0xfbcb, 0x96c0, 0xcf4f, 0x25e0, 0x9faa, 0x96c0, 0x6c87, 0x9e21, 0x9f21, 0x96c0, 0x6d7c, 0x9621, 0x9721, 0x9f70, 0x4513 }, 16, 0x0008a4a0, 1},
-	{{0x96c0, 0x6c10, 0xc39c, 0xc84d, 0x96c0, 0xd5c5, 0x9620, 0x9720, 0x3a40, 0xa000, 0x2600, 0x8094, 0x7653, 0xc9a0, 0x9ac0, 0x6a06 }, 16, 0x0008a4c0, 1},
-	{{0x07e4, 0x2046, 0x8009, 0xcdb4, 0x9ac0, 0x67e9, 0xcc44, 0x3581, 0x2000, 0x8000, 0x94c7, 0x76fd, 0xd917, 0x9ac7, 0x6ebb, 0xd312 }, 16, 0x0008a4e0, 1},
-	{{0x3281, 0x2000, 0x8000, 0x9cc1, 0x7676, 0x2c09, 0x804c, 0x6f90, 0x2c09, 0x804c, 0x3e07, 0xa100, 0x90c0, 0xeae9, 0x90c0, 0x757a }, 16, 0x0008a500, 1},
-	{{0x3907, 0x800e, 0x3c40, 0xa100, 0xd51f, 0x7ec8, 0x64e9, 0xea39, 0x5611, 0x3c00, 0xa100, 0x7961, 0x66e5, 0x6b3e, 0x5492, 0xece9 }, 16, 0x0008a520, 1},
-	{{0x9cc0, 0x6e08, 0x7ec8, 0x0fe3, 0x204a, 0x8009, 0xeae9, 0x3e00, 0xa004, 0x63f7, 0x6c7c, 0x76dd, 0x6c10, 0x9e20, 0x9f20, 0x3e00 }, 16, 0x0008a540, 1},
-	{{0xa004, 0x6ff7, 0x2e00, 0x8040, 0x63f6, 0x270b, 0x8038, 0x96c0, 0x6ff6, 0xe7eb, 0xea3d, 0x3800, 0xa800, 0x6363, 0xec3e, 0xcf43 }, 16, 0x0008a560, 1},
-	{{0x94c0, 0xd742, 0xfc47, 0x96c0, 0x6e7c, 0x2f0f, 0x8260, 0x3680, 0xa000, 0x4692, 0x842e, 0x0692, 0x4694, 0x1617, 0xef50, 0x2b3e }, 16, 0x0008a580, 1},
-	{{0x1497, 0x0fe3, 0x204a, 0x8009, 0x2e08, 0x61f7, 0x2c7c, 0x6df7, 0x6376, 0x6f76, 0x6f4e, 0xd742, 0x6e7c, 0x4697, 0x3a00, 0xa100 }, 16, 0x0008a5a0, 1},
-	{{0x2b00, 0x8044, 0x6c10, 0xe8e9, 0x96c0, 0xf3a9, 0x290d, 0x8002, 0x3c20, 0xa104, 0x6875, 0xe83b, 0x09e3, 0x204a, 0x8009, 0x3800 }, 16, 0x0008a5c0, 1},
-	{{0xa940, 0x61f4, 0x5790, 0xcfba, 0x3a00, 0xb080, 0x6e0b, 0x6df4, 0x5715, 0xeced, 0x3a00, 0xa008, 0x6c7c, 0x6a77, 0xec3f, 0xcbbc }, 16, 0x0008a5e0, 1},
-	{{0x3a40, 0xa000, 0x63f6, 0x5794, 0x2d0f, 0x8002, 0x3a40, 0xb000, 0x6ff6, 0x6e0b, 0xe8ef, 0xcea8, 0x3a20, 0xa000, 0x6f4f, 0x6c7c }, 16, 0x0008a600, 1},
-	{{0xe839, 0xeee9, 0x98c0, 0xd742, 0x61f6, 0x5790, 0xee3b, 0x3c20, 0xa100, 0x6e7c, 0x6df6, 0x6e0b, 0xefe9, 0x5317, 0x3ac0, 0xb188 }, 16, 0x0008a620, 1},
-	{{0x6c7c, 0x6975, 0x4690, 0xef3e, 0x3cc0, 0xa000, 0x6076, 0x0de3, 0x204a, 0x8009, 0x5797, 0x3a40, 0xa844, 0x6376, 0x6c76, 0xf743 }, 16, 0x0008a640, 1},
-	{{0xcaac, 0x3a20, 0xa844, 0x6f76, 0x7650, 0xccb0, 0xebe9, 0x3820, 0xa900, 0x6f4e, 0xebe9, 0xeb3a, 0x38c0, 0xa100, 0xd742, 0xeb3c }, 16, 0x0008a660, 1},
-	{{0xe8e9, 0x3a00, 0xa100, 0x2300, 0x807d, 0x6e7c, 0xe866, 0x0694, 0x4696, 0x3a20, 0xa000, 0x0be3, 0x204a, 0x8009, 0x5594, 0x3820 }, 16, 0x0008a680, 1},
-	{{0xa840, 0x63f5, 0xf30b, 0xf845, 0x3800, 0xa840, 0x6ff5, 0x5115, 0xf542, 0x3820, 0xa000, 0x6f57, 0xf948, 0xf049, 0x96c0, 0xd742 }, 16, 0x0008a6a0, 1},
-	{{0x5017, 0xfd4a, 0x3860, 0xa000, 0x6e7c, 0xfb4b, 0xff4c, 0x0693, 0x4690, 0x3600, 0xa100, 0x5293, 0x4693, 0x98c0, 0x07e4, 0x204a }, 16, 0x0008a6c0, 1},
-	{{0x8009, 0xf241, 0x98c0, 0x02e4, 0x2046, 0x8009, 0xf708, 0x98c0, 0xcc4f, 0x32a4, 0x2430, 0x8008, 0x94c0, 0xf207, 0xca4e, 0x3640 }, 16, 0x0008a6e0, 1},
-	{{0xa000, 0xf9c8, 0xffcc, 0x3620, 0xa000, 0xcda4, 0xcc47, 0x94c0, 0xca46, 0xe8e9, 0x3600, 0xa100, 0xfdca, 0x4097, 0x3820, 0xa000 }, 16, 0x0008a700, 1},
-	{{0xe83d, 0x2500, 0x807d, 0x1792, 0xebe9, 0x1294, 0x5390, 0x98c0, 0xf50b, 0x05e4, 0x204a, 0x8009, 0x98c0, 0x04e4, 0x2046, 0x8009 }, 16, 0x0008a720, 1},
-	{{0xeb64, 0x1011, 0xfb45, 0x1115, 0xf508, 0x94c0, 0xf407, 0xf343, 0x94c0, 0xf242, 0xf741, 0x32a4, 0x2430, 0x8008, 0xf84d, 0x3640 }, 16, 0x0008a740, 1},
-	{{0xa000, 0xf9c8, 0xfbcb, 0x94c0, 0xf8cd, 0xfac7, 0x94c0, 0xebe9, 0xece9, 0x0090, 0xeb78, 0x3680, 0xa000, 0x5793, 0x5592, 0x1293 }, 16, 0x0008a760, 1},
-	{{0x06e4, 0x2046, 0x8009, 0x96c0, 0xec62, 0x2300, 0x8055, 0x98c0, 0x04e4, 0x204a, 0x8009, 0xf607, 0x1017, 0x5111, 0x94c0, 0xfc45 }, 16, 0x0008a780, 1},
-	{{0xf30b, 0x94c0, 0xf408, 0xf243, 0x98c0, 0xcb4e, 0x32a4, 0x2430, 0x8008, 0x94c0, 0xf542, 0xf741, 0x9cc0, 0x75d0, 0x6c10, 0xcb46 }, 16, 0x0008a7a0, 1},
-	{{0x3581, 0x2000, 0x8000, 0x9ac0, 0x767d, 0xf9c8, 0x3781, 0x2000, 0x8000, 0x34ff, 0x0393, 0xfcc7, 0x98c0, 0x03e4, 0x2048, 0x8009 }, 16, 0x0008a7c0, 1},
-	{{0xf8cd, 0x25e9, 0x2e8c, 0x1296, 0xe974, 0x90c0, 0x3e01, 0xa008, 0x5490, 0xdb13, 0x6d90, 0x7ec8, 0x7ec8, 0x5490, 0x3e07, 0xa804 }, 16, 0x0008a7e0, 1},
-	{{0x90c0, 0x5791, 0x90c0, 0x6d08, 0xd196, 0x66e5, 0x3e47, 0xa804, 0x90c0, 0x5494, 0x90c0, 0x6566, 0x77f3, 0x7ec8, 0x3e47, 0xa800 }, 16, 0x0008a800, 1},
-	{{0x90c0, 0x2101, 0x8080, 0x76dd, 0x3f03, 0x800e, 0x3c40, 0xb000, 0xd49b, 0x6db4, 0x6568, 0xf0c9, 0xfdca, 0x3600, 0xb080, 0x78e1 }, 16, 0x0008a820, 1},
-	{{0x6374, 0x3600, 0xb080, 0x6e07, 0x6f74, 0x94c7, 0x6c7c, 0xc0ff, 0x63f6, 0x6ff6, 0x6edf, 0xd6c1, 0x94c0, 0x6d7c, 0x843c, 0x4591 }, 16, 0x0008a840, 1},
-	{{0x9ac0, 0x6569, 0xd312, 0x3b40, 0x3a06, 0x8009, 0x96c6, 0x6764, 0x6c10, 0x8029, 0x94c0, 0xd516, 0xc09e, 0x96c0, 0x34cf, 0x8210 }, 16, 0x0008a860, 1},
-	{{0x6ea2, 0x3ec8, 0xcc47, 0x90c0, 0xecf9, 0xec1b, 0x9cbc, 0xcc4a, 0x7472, 0xd445, 0x65e6, 0x65e8, 0x843a, 0x92c3, 0xc7ff, 0x9ac0 }, 16, 0x0008a880, 1},
-	{{0x65e9, 0xd113, 0x3c40, 0x3a06, 0x8009, 0x96c6, 0x6564, 0x6f90, 0x8029, 0x94c0, 0xd592, 0xc79e, 0x96c0, 0x6d0b, 0x36cf, 0x8210 }, 16, 0x0008a8a0, 1},
-	{{0x3d48, 0xc847, 0x90c0, 0xe8f9, 0xe81c, 0x9bb8, 0xcb4f, 0x77f7, 0xd7c2, 0x98c0, 0x27ec, 0x9fc8, 0x6c23, 0xed58, 0x0015, 0xe7ec }, 16, 0x0008a8c0, 1},
-	{{0x94c0, 0x9e21, 0x9f21, 0x94c0, 0x9621, 0x9721, 0x9f71, 0x31e4, 0x3a68, 0x8001, 0x3124, 0x3f30, 0x8009, 0x83fb, 0x3750, 0xca40 }, 16, 0x0008a8e0, 1},
-	{{0x2708, 0x8020, 0xe7e8, 0x3840, 0x3b40, 0x8009, 0xeafe, 0xe81a, 0x1e90, 0xc094, 0xf941, 0x37e1, 0x2050, 0x8009, 0x32c4, 0x3996 }, 16, 0x0008a900, 1},
-	{{0x8008, 0x2b82, 0xefea, 0x2d10, 0x3b40, 0x3b34, 0x8009, 0xeaef, 0xcf47, 0xf9c1, 0xea1b, 0x5192, 0xb87c, 0xf142, 0xc184, 0x1001 }, 16, 0x0008a920, 1},
-	{{0x8142, 0x32a4, 0x3630, 0x8008, 0x0201, 0x8140, 0xf9c1, 0xb039, 0x1801, 0x8144, 0xb83d, 0x1001, 0x8140, 0xb03a, 0xb03c, 0xc1f7 }, 16, 0x0008a940, 1},
-	{{0x1201, 0x8146, 0xdc82, 0xb13e, 0xb1b9, 0x2c51, 0x1101, 0x8154, 0x3861, 0xd891, 0xf041, 0x33e8, 0x9fff, 0x1101, 0x8156, 0xc846 }, 16, 0x0008a960, 1},
-	{{0x33fe, 0x9fff, 0x1101, 0x8150, 0xdf18, 0xd811, 0x1101, 0x8152, 0x31e8, 0x9fff, 0x33f9, 0x9fff, 0xdc98, 0x1001, 0x814c, 0xd810 }, 16, 0x0008a980, 1},
-	{{0xf143, 0x1101, 0x814e, 0x31e8, 0x9fff, 0x33f9, 0x9fff, 0xdc98, 0x1001, 0x8148, 0x3a40, 0x3b4c, 0x8009, 0xd810, 0xf144, 0x1101 }, 16, 0x0008a9a0, 1},
-	{{0x814a, 0x31e8, 0x9fff, 0x33f9, 0x9fff, 0xdc98, 0x1291, 0x8140, 0xea18, 0x90ba, 0xf145, 0xf246, 0xf847, 0x32e4, 0x39e4, 0x8001 }, 16, 0x0008a9c0, 1},
-	{{0x1791, 0x8144, 0xf8c7, 0x3940, 0x3b4f, 0x8009, 0x90c0, 0xe819, 0xf847, 0x2aff, 0x9efd, 0x90b8, 0x27e0, 0xf0c1, 0x34f8, 0x2c10 }, 16, 0x0008a9e0, 1},
-	{{0xf2c6, 0xd912, 0xdc9a, 0xb171, 0x001e, 0x39c8, 0x3820, 0xbfff, 0x000e, 0xf0c2, 0x1291, 0xf8c7, 0xdd00, 0xd120, 0x8413, 0x39c8 }, 16, 0x0008aa00, 1},
-	{{0x3820, 0xbfff, 0x90c0, 0x5291, 0xdd00, 0x6569, 0x81fb, 0xf141, 0x2aff, 0x9ebf, 0x90b8, 0x27e0, 0xf1c1, 0xb171, 0xf2c6, 0xb272 }, 16, 0x0008aa20, 1},
-	{{0xb677, 0xf1c3, 0x0186, 0x8020, 0xf1c4, 0x0186, 0x8024, 0xf1c5, 0x0186, 0x8028, 0xd897, 0x0901, 0xa004, 0xb173, 0x2c10, 0xc181 }, 16, 0x0008aa40, 1},
-	{{0x0086, 0x802c, 0x0086, 0x8030, 0x0086, 0x8034, 0x0086, 0x8038, 0x27e8, 0x9fe0, 0x0117, 0x800e, 0x0017, 0x800f, 0x3024, 0x3f50 }, 16, 0x0008aa60, 1},
-	{{0x8009, 0xe7e8, 0x3551, 0xcc56, 0x311b, 0x8003, 0x3dc2, 0xcd57, 0xc943, 0x3840, 0x3b40, 0x8009, 0x01fc, 0x9ff4, 0x24e6, 0xc394 }, 16, 0x0008aa80, 1},
-	{{0x0cf1, 0xbfff, 0xe918, 0x1c91, 0x31e1, 0x2050, 0x8009, 0x8012, 0x6893, 0x00fc, 0x9ff4, 0x6466, 0xd818, 0xd010, 0x8806, 0x785e }, 16, 0x0008aaa0, 1},
-	{{0x6c10, 0x2e10, 0x2f90, 0xc841, 0xc18b, 0x2c11, 0xf186, 0x3470, 0xc58e, 0xb383, 0x6c7c, 0x33fe, 0x9fff, 0x6c8c, 0x6d7d, 0x66e4 }, 16, 0x0008aac0, 1},
-	{{0xb503, 0xb265, 0x34f5, 0x5910, 0x2c99, 0x0904, 0x8012, 0xb083, 0x7cc8, 0x3118, 0x801f, 0x3319, 0x9f00, 0xdc19, 0x4014, 0x2c0a }, 16, 0x0008aae0, 1},
-	{{0x802c, 0x5092, 0x31e8, 0x9fff, 0xdf18, 0x0684, 0x802c, 0xf085, 0xb066, 0xb086, 0x3118, 0x800f, 0xb021, 0x0710, 0x800e, 0xcd5f }, 16, 0x0008ab00, 1},
-	{{0x9f70, 0xcc5e, 0x2bff, 0x9dd1, 0x311a, 0x8003, 0x3d42, 0x31e1, 0x2050, 0x8009, 0xca42, 0xc294, 0x2892, 0x3840, 0x3b40, 0x8009 }, 16, 0x0008ab20, 1},
-	{{0xce41, 0xe748, 0x1116, 0x800f, 0x24e9, 0xea18, 0x80ae, 0x1892, 0xefe9, 0x1116, 0x800e, 0x2c90, 0xd0a1, 0x8409, 0x8830, 0x0116 }, 16, 0x0008ab40, 1},
-	{{0x800e, 0x3940, 0x3b34, 0x8009, 0xca40, 0x90c0, 0xa1ca, 0x39c8, 0x3820, 0xbfff, 0x90c0, 0x1291, 0x39c8, 0x3820, 0xbfff, 0xdd01 }, 16, 0x0008ab60, 1},
-	{{0xd120, 0x840b, 0x5291, 0xdd01, 0x6569, 0x81fb, 0xca40, 0x3940, 0x3b4f, 0x8009, 0xc84e, 0xea19, 0x2aff, 0x9d57, 0x90ba, 0xc846 }, 16, 0x0008ab80, 1},
-	{{0xc9b8, 0x1007, 0x8042, 0x280a, 0x8040, 0x0007, 0x804c, 0x0007, 0x8054, 0x1092, 0xe8ea, 0xe839, 0x1090, 0xea44, 0xb032, 0x5192 }, 16, 0x0008aba0, 1},
-	{{0x3320, 0x8000, 0xdc90, 0x0c91, 0xa000, 0x800d, 0x6468, 0x8009, 0x30e8, 0x3fff, 0xbfff, 0x3c6e, 0x1207, 0x8042, 0x7c48, 0x6465 }, 16, 0x0008abc0, 1},
-	{{0x7c48, 0x7458, 0xd898, 0x2c18, 0x0097, 0x8050, 0x7c48, 0x6465, 0x7c48, 0x7458, 0x8810, 0x00fe, 0x9ff8, 0x2c10, 0xc181, 0xf004 }, 16, 0x0008abe0, 1},
-	{{0x0116, 0x800f, 0xf084, 0x3024, 0x3f50, 0x8009, 0xe768, 0x2469, 0xd010, 0x8009, 0x8808, 0x3101, 0x801e, 0x6c90, 0x64e8, 0x8005 }, 16, 0x0008ac00, 1},
-	{{0xc19f, 0xc097, 0x2c31, 0x01e4, 0x2030, 0x8009, 0xc286, 0x6c98, 0x6c51, 0x30a4, 0x3610, 0x8008, 0x6c90, 0x3124, 0x3f30, 0x8009 }, 16, 0x0008ac20, 1},
-	{{0x83fb, 0x3750, 0xc1b4, 0x30e1, 0x208c, 0x8009, 0x2806, 0x0704, 0x3870, 0x800a, 0x3fe3, 0xe748, 0x2c90, 0xf141, 0xc840, 0xcf40 }, 16, 0x0008ac40, 1},
-	{{0x32e4, 0x3c8a, 0x8001, 0xeee9, 0x33c4, 0x3996, 0x8008, 0x2769, 0xcf48, 0xc940, 0x92c2, 0xc09c, 0xb84a, 0x8018, 0x92c2, 0x5190 }, 16, 0x0008ac60, 1},
-	{{0x1190, 0xd321, 0x8409, 0x880c, 0x2000, 0x80b0, 0x2000, 0x8144, 0x5190, 0x2c90, 0xd441, 0xb049, 0x1896, 0x8130, 0x0811, 0x30e8 }, 16, 0x0008ac80, 1},
-	{{0x3fff, 0xbfff, 0x0101, 0x8028, 0x0111, 0x800c, 0x1896, 0x81de, 0x0801, 0x802a, 0x1896, 0x81e0, 0x0801, 0x802c, 0xb8c9, 0x3e17 }, 16, 0x0008aca0, 1},
-	{{0x8190, 0x0701, 0x8030, 0x0101, 0x802e, 0x2240, 0x8000, 0xe768, 0x0100, 0x8070, 0x0100, 0x8072, 0x0200, 0x8074, 0x0180, 0x8080 }, 16, 0x0008acc0, 1},
-	{{0x0180, 0x8084, 0x0180, 0x8088, 0x3024, 0x3f50, 0x8009, 0x0080, 0x808c, 0x8349, 0x32e1, 0x208c, 0x8009, 0xc1b4, 0x2911, 0x0886 }, 16, 0x0008ace0, 1},
-	{{0x3a58, 0x8009, 0xcf42, 0xe750, 0xbef9, 0xb082, 0x3c63, 0xc94f, 0xb6f1, 0x00e0, 0x2148, 0x8009, 0x2f08, 0x800c, 0xb0f3, 0x32a4 }, 16, 0x0008ad00, 1},
-	{{0x23f0, 0x8008, 0xf843, 0x3550, 0x3470, 0x1186, 0x8080, 0x3071, 0xc947, 0x8426, 0xf8c3, 0x3c50, 0x0b96, 0x8090, 0x2561, 0x9999 }, 16, 0x0008ad20, 1},
-	{{0x204d, 0xda11, 0x2101, 0x851e, 0x61f4, 0x6df4, 0x3973, 0x9fbe, 0x7df0, 0x880a, 0x0386, 0x8080, 0x0086, 0x8080, 0x1386, 0x8080 }, 16, 0x0008ad40, 1},
-	{{0x1186, 0x808c, 0x30f3, 0x0206, 0x8090, 0x3028, 0x3b64, 0xbfdf, 0x8022, 0x94c2, 0x0386, 0x808c, 0xd891, 0x2274, 0xd993, 0x2e74 }, 16, 0x0008ad60, 1},
-	{{0x32c0, 0x249b, 0x8020, 0x6075, 0x6c75, 0x6c40, 0x7c70, 0x0086, 0x808c, 0x1086, 0x808c, 0x3610, 0x8a00, 0x8013, 0x3081, 0x2000 }, 16, 0x0008ad80, 1},
-	{{0x8000, 0x0086, 0x8068, 0x886c, 0x2000, 0x9fff, 0x3610, 0x8e80, 0x8013, 0x3081, 0x2000, 0x8000, 0x0086, 0x8068, 0x8856, 0x2000 }, 16, 0x0008ada0, 1},
-	{{0x9fff, 0x3610, 0x8f80, 0x8013, 0x30e1, 0x3ae1, 0x8000, 0x0086, 0x8068, 0x8840, 0x2000, 0x9fff, 0x3610, 0x95ff, 0x8013, 0x3080 }, 16, 0x0008adc0, 1},
-	{{0x2000, 0x8003, 0x0086, 0x8068, 0x882a, 0x2020, 0x9fff, 0x3610, 0x98ff, 0x8013, 0x3000, 0x2000, 0x8004, 0x0086, 0x8068, 0x8814 }, 16, 0x0008ade0, 1},
-	{{0x2060, 0x9fff, 0x30c0, 0x2000, 0x8004, 0x0086, 0x8068, 0x2060, 0x9fff, 0x0c96, 0xa000, 0x00e0, 0x2144, 0x8009, 0x0106, 0x2764 }, 16, 0x0008ae00, 1},
-	{{0x800a, 0x8022, 0x1086, 0x8068, 0x70f0, 0x8045, 0x1007, 0x8024, 0x3861, 0xd420, 0x803a, 0x0007, 0x8024, 0x30e8, 0x3fff, 0xbfff }, 16, 0x0008ae20, 1},
-	{{0xdf00, 0x882d, 0x70f0, 0x8429, 0x1006, 0x806c, 0x7841, 0x3470, 0x0006, 0x806c, 0x3610, 0x807f, 0x841d, 0x00e4, 0x2148, 0x8009 }, 16, 0x0008ae40, 1},
-	{{0x3e10, 0x84b0, 0x0007, 0x8024, 0x880c, 0x0996, 0xa000, 0x6c10, 0x0006, 0x806c, 0x1091, 0x31f8, 0x3fff, 0xb7ff, 0x2c10, 0x0c10 }, 16, 0x0008ae60, 1},
-	{{0xa002, 0x8009, 0xdf01, 0x882e, 0xb671, 0x2c90, 0x0d46, 0xa000, 0x800f, 0x30f8, 0x3fff, 0xb7ff, 0xdf00, 0x0117, 0x800c, 0xb671 }, 16, 0x0008ae80, 1},
-	{{0x1a17, 0x800c, 0x3be0, 0x2128, 0x8009, 0xf941, 0xaada, 0xe9ef, 0x9a63, 0xd810, 0x0996, 0x8074, 0x2031, 0xe770, 0x6c50, 0x3024 }, 16, 0x0008aea0, 1},
-	{{0x3f50, 0x8009, 0xd818, 0xbac9, 0x1911, 0x30f8, 0x3fff, 0xafff, 0xb1d1, 0x32f8, 0x3fff, 0x9fff, 0xdc80, 0xdc82, 0x32f0, 0x3fff }, 16, 0x0008aec0, 1},
-	{{0xbfff, 0xdc82, 0xc948, 0x3c41, 0x0d41, 0xa000, 0x8010, 0x3178, 0x9e00, 0x32f8, 0x3fff, 0xbfbf, 0x8816, 0xdc82, 0xc281, 0x9298 }, 16, 0x0008aee0, 1},
-	{{0x02e4, 0x2148, 0x8009, 0x3e12, 0x8c80, 0x0200, 0x801a, 0x9f70, 0xb151, 0x34d0, 0x2c10, 0x3908, 0x2000, 0x8000, 0xc841, 0x3109 }, 16, 0x0008af00, 1},
-	{{0x2000, 0x8000, 0xe988, 0x840b, 0xc84a, 0xdca2, 0x70fa, 0x81fd, 0x64e9, 0x8021, 0x3551, 0xca41, 0x3d41, 0xc940, 0x90c0, 0xea19 }, 16, 0x0008af20, 1},
-	{{0xea88, 0x8007, 0xe83a, 0xd442, 0x2460, 0xdca2, 0x24e9, 0x646e, 0x85e5, 0x9f71, 0x36d0, 0x24e9, 0x35c1, 0xf085, 0xd215, 0x6664 }, 16, 0x0008af40, 1},
-	{{0x6c7d, 0x2d20, 0xd694, 0x66e1, 0x800c, 0x6c4d, 0x33e4, 0x3c48, 0x8001, 0x8805, 0x6c10, 0x3024, 0x3ee0, 0x8009, 0x74f2, 0x2bff }, 16, 0x0008af60, 1},
-	{{0x9cbd, 0x37d0, 0xe748, 0xf0c9, 0x30f0, 0x6c11, 0x6460, 0x844a, 0x96c3, 0x06e7, 0x2144, 0x8009, 0x837b, 0x34d0, 0xf4ca, 0x2000 }, 16, 0x0008af80, 1},
-	{{0x8064, 0x3ccf, 0x6c7c, 0x836c, 0x3454, 0xf142, 0x7c4f, 0x6460, 0x6469, 0x8405, 0xc081, 0x34d0, 0xf0c2, 0x839a, 0x24e1, 0x1801 }, 16, 0x0008afa0, 1},
-	{{0xa00f, 0x2880, 0x8000, 0xc940, 0xe8f8, 0xe839, 0xc84e, 0x2766, 0x02e7, 0x2144, 0x8009, 0x6e7d, 0x107c, 0x9fd7, 0x6469, 0x802f }, 16, 0x0008afc0, 1},
-	{{0x27e9, 0x34d7, 0x3008, 0x2000, 0x8000, 0x8023, 0x8368, 0x1801, 0xa00f, 0x34fe, 0x02e7, 0x2144, 0x8009, 0x3603, 0x8001, 0x3400 }, 16, 0x0008afe0, 1},
-	{{0x8001, 0xd810, 0xd443, 0x30ce, 0x944f, 0x6e7d, 0x32a4, 0x3610, 0x8008, 0x347e, 0x01e4, 0x2144, 0x8009, 0x3024, 0x3f50, 0x8009 }, 16, 0x0008b000, 1},
-	{{0x3478, 0xe768, 0x2bff, 0x9c17, 0xbec9, 0x1911, 0xe750, 0xb7f1, 0x0917, 0xb000, 0x31f8, 0x3fff, 0x9fff, 0xdf81, 0x31f0, 0x3fff }, 16, 0x0008b020, 1},
-	{{0xbfff, 0xc948, 0x3c41, 0xdf81, 0x0d87, 0xa000, 0x317e, 0x9e00, 0x804c, 0xefe8, 0x2c10, 0x0c97, 0xa000, 0x800f, 0xc1ff, 0xb17a }, 16, 0x0008b040, 1},
-	{{0xc184, 0x919f, 0x8830, 0xf008, 0xc083, 0x909f, 0xb2f7, 0xf241, 0xb2f4, 0xf242, 0x02e5, 0x214a, 0x8009, 0xb1f3, 0xb0f2, 0x2aff }, 16, 0x0008b060, 1},
-	{{0x9f01, 0x027c, 0x9ff7, 0xd810, 0xd896, 0x2431, 0x0097, 0x801c, 0x00fe, 0x9ff0, 0x20e0, 0x97ff, 0x881c, 0xdf80, 0x0c97, 0xa000 }, 16, 0x0008b080, 1},
-	{{0x800d, 0x21e0, 0x97ff, 0xc082, 0x8806, 0xdf81, 0xc081, 0x6c90, 0x909f, 0xf108, 0xc081, 0x0006, 0x8070, 0xb771, 0xf088, 0x3024 }, 16, 0x0008b0a0, 1},
-	{{0x3f50, 0x8009, 0xe770, 0xb9c9, 0x31f8, 0x3fff, 0xafff, 0xb0c9, 0xdc01, 0x0930, 0xa000, 0x31f0, 0x3fff, 0xbfff, 0xdc01, 0x0d80 }, 16, 0x0008b0c0, 1},
-	{{0xa000, 0x803d, 0x0c90, 0xa000, 0x8011, 0xc284, 0x9298, 0xc1ff, 0xb142, 0x886c, 0x0100, 0x8016, 0xb1c2, 0x24e8, 0x01e4, 0x2148 }, 16, 0x0008b0e0, 1},
-	{{0x8009, 0x800b, 0x3e11, 0x8640, 0xb142, 0xb141, 0xb1c1, 0x38e1, 0xd4a1, 0x804c, 0xb141, 0xc183, 0x9198, 0x8fd8, 0xc1ff, 0x0c90 }, 16, 0x0008b100, 1},
-	{{0xa000, 0x800d, 0xc182, 0x9198, 0xc1ff, 0x8834, 0xb142, 0xb1c2, 0x24e8, 0x01e4, 0x2148, 0x8009, 0x800b, 0x3e11, 0x8640, 0xb142 }, 16, 0x0008b120, 1},
-	{{0xb141, 0xb1c1, 0x38e1, 0xd4a1, 0x8016, 0xb141, 0xc181, 0x9198, 0x01e4, 0x2148, 0x8009, 0x3e11, 0x8c80, 0x0100, 0x801a, 0xb049 }, 16, 0x0008b140, 1},
-	{{0x9f70, 0x6c10, 0x2bff, 0x9ad7, 0xbec9, 0x1911, 0xe750, 0xb7f1, 0x0917, 0xb000, 0x30f0, 0x3fff, 0xbfff, 0x0937, 0xa000, 0xc949 }, 16, 0x0008b160, 1},
-	{{0x3cc1, 0xdf80, 0x0d87, 0xa000, 0x337e, 0x9e00, 0x809a, 0xefe8, 0x0886, 0x3a58, 0x8009, 0x1106, 0x8066, 0x1000, 0x8104, 0x70f0 }, 16, 0x0008b180, 1},
-	{{0x8487, 0x3f88, 0x8000, 0x6460, 0x6469, 0x8461, 0xb2f7, 0xf241, 0xb2f4, 0xf242, 0x02e5, 0x214a, 0x8009, 0xb1f3, 0xb0f2, 0x2aff }, 16, 0x0008b1a0, 1},
-	{{0x9dc1, 0x027c, 0x9ff7, 0xd896, 0xd810, 0x2531, 0x1107, 0x8016, 0x24e8, 0x0097, 0x801c, 0x8018, 0x02fe, 0x9ff0, 0x08e4, 0x2148 }, 16, 0x0008b1c0, 1},
-	{{0x8009, 0x90c0, 0xe8fc, 0x0807, 0x8016, 0x0807, 0x8014, 0x1007, 0x8014, 0x3861, 0xd421, 0x802a, 0x0007, 0x8014, 0xc085, 0x0917 }, 16, 0x0008b1e0, 1},
-	{{0xa800, 0x909f, 0x881c, 0x0917, 0xa040, 0x2c90, 0xc284, 0x929f, 0xc2ff, 0x30f8, 0x3fff, 0xbfbf, 0xdf80, 0xf108, 0x0207, 0x8016 }, 16, 0x0008b200, 1},
-	{{0xc0ff, 0x88be, 0xb07a, 0x30f8, 0x3fff, 0xb7ff, 0xdf80, 0x0d87, 0xa000, 0x8059, 0x2c90, 0x0c97, 0xa000, 0x8013, 0xc084, 0x32f8 }, 16, 0x0008b220, 1},
-	{{0x3fff, 0xbfbf, 0x909f, 0xdf82, 0x8838, 0xf108, 0xc083, 0x3200, 0x2000, 0x8040, 0x909f, 0xdf9a, 0xb2f7, 0xf241, 0xb2f4, 0xf242 }, 16, 0x0008b240, 1},
-	{{0x02e5, 0x214a, 0x8009, 0xb1f3, 0xb0f2, 0x2aff, 0x9d15, 0x027c, 0x9ff7, 0xd810, 0xd896, 0x2431, 0x0097, 0x801c, 0x00fe, 0x9ff0 }, 16, 0x0008b260, 1},
-	{{0xc0ff, 0xb07a, 0x885c, 0x0007, 0x8016, 0x30f8, 0x3fff, 0xbfbf, 0xdf80, 0x0c97, 0xa000, 0x800f, 0xc182, 0x919f, 0xc1ff, 0xb17a }, 16, 0x0008b280, 1},
-	{{0x883c, 0xdf80, 0xb1fa, 0x24e8, 0x01e4, 0x2148, 0x8009, 0x800b, 0x3e11, 0x8640, 0xb17a, 0xb179, 0xb1f9, 0x38e1, 0xd4a1, 0x801a }, 16, 0x0008b2a0, 1},
-	{{0xb179, 0xc181, 0x919f, 0x01e4, 0x2148, 0x8009, 0x3e11, 0x8c80, 0xdf80, 0x880a, 0x0107, 0x801a, 0x0917, 0xa040, 0x6c10, 0xf008 }, 16, 0x0008b2c0, 1},
-	{{0xb771, 0xf088, 0x3024, 0x3f50, 0x8009, 0xe770, 0xb9c9, 0x32f8, 0x3fff, 0xafff, 0xb0c9, 0xdc02, 0x32f8, 0x3fff, 0x9fff, 0x1190 }, 16, 0x0008b2e0, 1},
-	{{0x801e, 0xdc02, 0xb2c2, 0x2568, 0x33f8, 0x3fff, 0xbfbf, 0x3319, 0x8f00, 0x3ce8, 0x0950, 0xa000, 0x8014, 0xdc03, 0x3e11, 0x8320 }, 16, 0x0008b300, 1},
-	{{0x02e4, 0x2148, 0x8009, 0x68b8, 0xb142, 0xb141, 0xb1c4, 0x24e8, 0x01e4, 0x2148, 0x8009, 0x800b, 0x3e11, 0x8640, 0xb144, 0xb143 }, 16, 0x0008b320, 1},
-	{{0x0d80, 0xa000, 0x804b, 0x0a86, 0x3a58, 0x8009, 0x1201, 0x8066, 0x1102, 0x8104, 0x7171, 0x8439, 0x1100, 0x8016, 0x24e8, 0x0ae4 }, 16, 0x0008b340, 1},
-	{{0x2148, 0x8009, 0x800d, 0xeafe, 0x0a00, 0x8016, 0x0a00, 0x8014, 0x1100, 0x8014, 0x38e1, 0xd4a1, 0x800e, 0x0100, 0x8014, 0xc186 }, 16, 0x0008b360, 1},
-	{{0x9198, 0x0910, 0xa800, 0xc1ff, 0xb142, 0x8876, 0xb144, 0x31f8, 0x3fff, 0xb7ff, 0xdc01, 0x0d80, 0xa000, 0x8027, 0x0c90, 0xa000 }, 16, 0x0008b380, 1},
-	{{0xc2ff, 0x800c, 0xb244, 0xc184, 0x9198, 0x8852, 0xb242, 0xb3c1, 0x39e1, 0xd5a1, 0x8048, 0xb341, 0xc383, 0x9398, 0x8840, 0xdc01 }, 16, 0x0008b3a0, 1},
-	{{0x0c90, 0xa000, 0x8017, 0xb1c3, 0x38e1, 0xd4a1, 0xc2ff, 0xb143, 0x802c, 0xb242, 0xc182, 0x8826, 0x9198, 0xb3c1, 0x39e1, 0xd5a1 }, 16, 0x0008b3c0, 1},
-	{{0xc2ff, 0xb341, 0x8018, 0xb244, 0xc381, 0x9398, 0x03e4, 0x2148, 0x8009, 0x3e13, 0x8c80, 0xdc01, 0x0300, 0x801a, 0x0200, 0x8016 }, 16, 0x0008b3e0, 1},
-	{{0xb049, 0x9f70, 0x6c10, 0x2bff, 0x9835, 0xbec9, 0x1911, 0xe750, 0xc949, 0x3cc1, 0x30f8, 0x3fff, 0x9fff, 0xb7f1, 0x0917, 0xb000 }, 16, 0x0008b400, 1},
-	{{0xdf80, 0x337e, 0x9e00, 0xf608, 0x0957, 0xa000, 0x0d87, 0xa000, 0xf088, 0xefe8, 0x8070, 0xf007, 0x0886, 0x3a58, 0x8009, 0x1106 }, 16, 0x0008b420, 1},
-	{{0x8066, 0x1000, 0x8104, 0x70f0, 0x845d, 0x2c90, 0x0c97, 0xa000, 0x8019, 0xc284, 0x929f, 0xc2ff, 0x30f8, 0x3fff, 0xbfbf, 0xdf80 }, 16, 0x0008b440, 1},
-	{{0xf107, 0x883a, 0x0207, 0x8016, 0x3200, 0x2000, 0x8040, 0xdf9a, 0xb2f7, 0xf241, 0xb2f4, 0xf242, 0x02e5, 0x214a, 0x8009, 0xb1f3 }, 16, 0x0008b460, 1},
-	{{0xb0f2, 0x2aff, 0x9afd, 0x027c, 0x9ff7, 0xd810, 0xd896, 0x24b1, 0x0097, 0x801c, 0xc085, 0x909f, 0x01fe, 0x9ff2, 0xc0ff, 0x889a }, 16, 0x0008b480, 1},
-	{{0x0917, 0xa800, 0x0886, 0x3a58, 0x8009, 0x31f8, 0x3fff, 0xbfbf, 0x1006, 0x8066, 0xdf81, 0x1100, 0x8104, 0x30f0, 0xc0ff, 0x8473 }, 16, 0x0008b4a0, 1},
-	{{0x2d10, 0x0c97, 0xa000, 0x8013, 0xc084, 0x909f, 0xc1ff, 0xb17a, 0xf207, 0x8868, 0x0107, 0x8016, 0xb0fa, 0x2468, 0x0917, 0xa040 }, 16, 0x0008b4c0, 1},
-	{{0x8011, 0x00e4, 0x2148, 0x8009, 0x3e10, 0x8640, 0xb07a, 0xb079, 0xb0f9, 0x3861, 0xd421, 0x8010, 0xb079, 0xc083, 0x31f8, 0x3fff }, 16, 0x0008b4e0, 1},
-	{{0xb7ff, 0x909f, 0xdf81, 0xb2f7, 0xf241, 0xb2f4, 0xf242, 0x02e5, 0x214a, 0x8009, 0xb1f3, 0xb0f2, 0x2aff, 0x9a67, 0x027c, 0x9ff7 }, 16, 0x0008b500, 1},
-	{{0xd810, 0xd896, 0x2431, 0x0097, 0x801c, 0x8810, 0x00fe, 0x9ff2, 0x0917, 0xa800, 0x0917, 0xa040, 0xb07a, 0xb771, 0xf087, 0x3024 }, 16, 0x0008b520, 1},
-	{{0x3f50, 0x8009, 0xe770, 0xb9c9, 0x31f8, 0x3fff, 0xafff, 0xb0c9, 0xdc01, 0x0930, 0xa000, 0x0950, 0xa000, 0x0c80, 0xa000, 0x800b }, 16, 0x0008b540, 1},
-	{{0x1190, 0x8022, 0x8806, 0x78c1, 0x6c90, 0x0910, 0xa800, 0x0c90, 0xa000, 0x8010, 0x0100, 0x8022, 0xc186, 0x9198, 0xc1ff, 0x8826 }, 16, 0x0008b560, 1},
-	{{0xb142, 0xb1c2, 0x24e8, 0x01e4, 0x2148, 0x8009, 0x800b, 0x3e11, 0x8640, 0xb142, 0xb141, 0xb1c1, 0x38e1, 0xd4a1, 0x8008, 0xb141 }, 16, 0x0008b580, 1},
-	{{0xc185, 0x9198, 0x1290, 0x8022, 0x1190, 0x8024, 0x30fa, 0x2c90, 0xc282, 0x8009, 0x9298, 0x0100, 0x8022, 0xb049, 0x9f70, 0x6c10 }, 16, 0x0008b5a0, 1},
-	{{0x2468, 0x74d0, 0x842e, 0x92c3, 0xc0ff, 0x96c0, 0x64e9, 0xd211, 0xc283, 0x96c6, 0x7a61, 0x6c10, 0x8021, 0xd011, 0x3105, 0x801e }, 16, 0x0008b5c0, 1},
-	{{0x2d89, 0x7ec3, 0x7473, 0x6c7c, 0xd49c, 0x64e5, 0x3318, 0x8007, 0xdc1d, 0x9f71, 0x90c0, 0x90c0, 0x90c0, 0x90c0, 0x90c0, 0x90c0 }, 16, 0x0008b5e0, 1},
-	{{0x7651, 0x94c0, 0x6c7d, 0x9f70, 0x7454, 0x90c0, 0x90c0, 0x90c0, 0x7071, 0x94c0, 0xd0d8, 0x9f70, 0x7471, 0x90c0, 0x90c0, 0x90c0 }, 16, 0x0008b600, 1},
-	{{0x76d0, 0x94c0, 0x6d7c, 0x9f70, 0x7455, 0x90c0, 0x90c0, 0x90c0, 0x7071, 0x94c0, 0xd059, 0x9f70, 0x7470, 0x3324, 0x3f30, 0x8009 }, 16, 0x0008b620, 1},
-	{{0x3751, 0x34d0, 0xc281, 0x2e7c, 0x7451, 0xd321, 0x840d, 0x3224, 0x3ee0, 0x8009, 0xf18d, 0x88cd, 0x32a4, 0x35c0, 0x8008, 0x3456 }, 16, 0x0008b640, 1},
-	{{0xce41, 0x35d0, 0x2e10, 0x2f90, 0x36d6, 0x3840, 0x3b78, 0x8009, 0x3de3, 0xce49, 0x79ee, 0x3700, 0x800b, 0x2c7c, 0x6f7c, 0x2d37 }, 16, 0x0008b660, 1},
-	{{0xd71f, 0xd69a, 0xd69f, 0x7ae1, 0x7ec1, 0xc945, 0x90c0, 0xe918, 0x5011, 0x6a22, 0x6666, 0xd61a, 0x6664, 0x397b, 0x9fff, 0x29b3 }, 16, 0x0008b680, 1},
-	{{0x3c4f, 0x0c84, 0xa000, 0x8006, 0x65e6, 0xd5c0, 0x3740, 0x8000, 0x7c6f, 0x75f0, 0x6a2e, 0x6666, 0xd61a, 0x6664, 0x397b, 0x9fff }, 16, 0x0008b6a0, 1},
-	{{0x29b3, 0x3c4f, 0x0c84, 0xa000, 0x8006, 0x65e6, 0xd5c0, 0x3451, 0xcf42, 0x3746, 0x8000, 0x32a4, 0x35c0, 0x8008, 0x7f6f, 0x3650 }, 16, 0x0008b6c0, 1},
-	{{0x2c10, 0xce49, 0x3e63, 0xf38d, 0x3a6e, 0xcf4a, 0x6c7c, 0x2664, 0xd49c, 0x7471, 0x3901, 0x800f, 0x2cb9, 0x6822, 0x64e8, 0x840b }, 16, 0x0008b6e0, 1},
-	{{0xd419, 0xd41a, 0x881c, 0xd41f, 0xd4c2, 0x64e8, 0x8407, 0x8ff6, 0xd419, 0xd4c7, 0x64e8, 0x800a, 0x94c6, 0x64e4, 0xd419, 0xd411 }, 16, 0x0008b700, 1},
-	{{0x6461, 0x3124, 0x3f50, 0x8009, 0x90c0, 0x90c0, 0x90c0, 0x90c0, 0x3e00, 0xa00c, 0x74d6, 0x7557, 0x03e4, 0x2a4a, 0x8009, 0xc694 }, 16, 0x0008b720, 1},
-	{{0x3373, 0x2c0e, 0x5199, 0x9ac6, 0x842b, 0x90c0, 0x7551, 0x7470, 0xd211, 0x36d0, 0x7a61, 0x3ae1, 0x6c7c, 0x94c0, 0xd49d, 0xd51c }, 16, 0x0008b740, 1},
-	{{0x96c0, 0x331f, 0x8001, 0x6565, 0x2ccb, 0x31a4, 0x377c, 0x8008, 0x3470, 0xd211, 0x7a61, 0x6c7c, 0xd49c, 0x64e5, 0x3cc8, 0x3373 }, 16, 0x0008b760, 1},
-	{{0x37d0, 0x5699, 0x24e5, 0x3556, 0x3be1, 0xd216, 0x9ac6, 0x8422, 0xd71f, 0x7cc8, 0x90c0, 0x7a61, 0x98c0, 0x74d9, 0x6c7c, 0x3d1b }, 16, 0x0008b780, 1},
-	{{0x8001, 0xd51c, 0x2565, 0x30a4, 0x37b8, 0x8008, 0x6f5d, 0xd216, 0x7a61, 0x6c7c, 0xd71c, 0x6765, 0x98c0, 0xdb99, 0x7f48, 0x76d0 }, 16, 0x0008b7a0, 1},
-	{{0xc381, 0x28f7, 0x6765, 0x3f48, 0x34d0, 0x4198, 0x375e, 0x38e1, 0x04e4, 0x2a4c, 0x8009, 0x266a, 0xdb1e, 0x94c7, 0x6bbe, 0x7a41 }, 16, 0x0008b7c0, 1},
-	{{0x3600, 0xa008, 0x7644, 0x7457, 0xd621, 0x849f, 0x26ea, 0x5699, 0x94c0, 0x77d6, 0x8423, 0x94c0, 0xd217, 0xd719, 0x96c0, 0x7a61 }, 16, 0x0008b7e0, 1},
-	{{0x3d1a, 0x8001, 0x6c7c, 0xd79c, 0x27e5, 0x30a4, 0x381c, 0x8008, 0x6f4b, 0xd216, 0x7a61, 0x6c7c, 0xd71c, 0x6765, 0x3f48, 0x26ea }, 16, 0x0008b800, 1},
-	{{0x5799, 0x2765, 0x7557, 0x9ac6, 0x842a, 0x90c0, 0xd212, 0xd799, 0x7f48, 0x3a00, 0xa008, 0x775e, 0x3f1f, 0x8001, 0x7a61, 0x6c7c }, 16, 0x0008b820, 1},
-	{{0xd51c, 0x2565, 0x30a4, 0x385a, 0x8008, 0x3400, 0xa800, 0x6fcb, 0xd217, 0x7a61, 0x6c7c, 0xd79c, 0x67e5, 0x3fc8, 0x39c1, 0xda1e }, 16, 0x0008b840, 1},
-	{{0x27e5, 0x6a34, 0x7fc8, 0x77df, 0xdb1f, 0x6b3e, 0x6d56, 0x4298, 0x02e4, 0x2a4c, 0x8009, 0x656a, 0x92c3, 0x7941, 0x7542, 0x7173 }, 16, 0x0008b860, 1},
-	{{0x816d, 0x3400, 0xa800, 0x77d0, 0x9f70, 0x3800, 0xb800, 0x77d2, 0x7751, 0x4790, 0x90c0, 0x90c0, 0x90c0, 0x90c0, 0x90c0, 0x90c0 }, 16, 0x0008b880, 1},
-	{{0x3e00, 0xa00c, 0x7456, 0x74d7, 0x05e6, 0x21a8, 0x8009, 0xc94a, 0x3a80, 0xa100, 0x66ea, 0x7655, 0xe8ee, 0xc84a, 0x3a00, 0xa100 }, 16, 0x0008b8a0, 1},
-	{{0x7ae1, 0xe9ef, 0x2718, 0x80ec, 0x98c0, 0x2a03, 0x801e, 0x7ec1, 0x9a44, 0x9ac0, 0xd6c2, 0xc384, 0x3ee0, 0x2150, 0x8009, 0x3600 }, 16, 0x0008b8c0, 1},
-	{{0xa800, 0xd5c2, 0xcc42, 0x3800, 0xa804, 0x7752, 0x585e, 0xc488, 0x3a00, 0xa001, 0x77d0, 0x7cc1, 0x6b00, 0xc684, 0x3880, 0xa000 }, 16, 0x0008b8e0, 1},
-	{{0x7fc1, 0x6b00, 0xcf46, 0x3a00, 0xa202, 0x73f1, 0x6d27, 0xd742, 0xd744, 0x98c0, 0x3500, 0x8002, 0x5154, 0x808f, 0x9cc0, 0x7540 }, 16, 0x0008b900, 1},
-	{{0x67e9, 0x7bc2, 0x5097, 0x2b03, 0x8044, 0x94c0, 0x7961, 0x9d5c, 0x96c7, 0x6174, 0xcb46, 0x9b42, 0x94c2, 0xcd45, 0xcb43, 0x96c7 }, 16, 0x0008b920, 1},
-	{{0x6d74, 0xc846, 0xd744, 0x94c6, 0x4297, 0xc843, 0x1093, 0x5155, 0x6174, 0x9cc0, 0x6d74, 0x2103, 0x804c, 0x90c0, 0x90c0, 0x90c0 }, 16, 0x0008b940, 1},
-	{{0x3c00, 0xa108, 0x67e9, 0xd744, 0x7bc2, 0xc946, 0x4290, 0x94c0, 0x5154, 0x9b5c, 0x94c6, 0x5091, 0xcb45, 0x98c1, 0x6174, 0xcf43 }, 16, 0x0008b960, 1},
-	{{0xcf46, 0x6174, 0x9cc1, 0x6d74, 0xc843, 0xd744, 0xd744, 0xc846, 0x6d74, 0x4291, 0x94d0, 0x5097, 0x5153, 0x6174, 0x6d74, 0x4290 }, 16, 0x0008b980, 1},
-	{{0x92d0, 0xec42, 0x90c0, 0x90c0, 0x9f70, 0x3a60, 0xb800, 0x77d1, 0x7750, 0xefe9, 0xeee8, 0x90c0, 0x90c0, 0x90c0, 0x90c0, 0x90c0 }, 16, 0x0008b9a0, 1},
-	{{0x3e00, 0xa008, 0x75d6, 0x7457, 0x00e6, 0x21a8, 0x8009, 0xc84c, 0x3c00, 0xa100, 0x646a, 0xe8ef, 0x3be0, 0x21ac, 0x8009, 0x846f }, 16, 0x0008b9c0, 1},
-	{{0x96c0, 0x9a40, 0x2a03, 0x8010, 0x3de0, 0x2150, 0x8009, 0x90c0, 0x2f10, 0x185d, 0xcc44, 0x3071, 0x6d11, 0x96c0, 0x7c42, 0x7941 }, 16, 0x0008b9e0, 1},
-	{{0x8047, 0x94c0, 0xd522, 0xcf40, 0x94c6, 0x801a, 0x7962, 0xef1c, 0x9f42, 0x90c0, 0x90c0, 0x92d0, 0x529f, 0x6f4a, 0x31a4, 0x3a40 }, 16, 0x0008ba00, 1},
-	{{0x8008, 0x94c0, 0x9f42, 0x559f, 0x3555, 0x559f, 0x37d5, 0x76d2, 0x96c8, 0x6f5a, 0x76d7, 0x579f, 0x3555, 0x76d7, 0x6f4a, 0x6f5a }, 16, 0x0008ba20, 1},
-	{{0x2765, 0x575b, 0x92d0, 0x60f7, 0x6cf7, 0x4199, 0x3a20, 0xa800, 0x77d0, 0x7753, 0xefe8, 0x9f71, 0x90c0, 0x90c0, 0x90c0, 0x90c0 }, 16, 0x0008ba40, 1},
-	{{0x3a00, 0xa00c, 0x74d7, 0x7456, 0xf785, 0x5491, 0x3a80, 0xa000, 0x2909, 0x8008, 0x67ea, 0x4490, 0x98c7, 0x280d, 0x8004, 0x90c0 }, 16, 0x0008ba60, 1},
-	{{0x7bc1, 0x3880, 0xa000, 0x77c7, 0xf085, 0x5691, 0x3e00, 0xa100, 0xd7a1, 0x7861, 0x3f05, 0x8001, 0x4695, 0xe8ee, 0x3c00, 0xa100 }, 16, 0x0008ba80, 1},
-	{{0x7c43, 0x7557, 0x7ec3, 0xebef, 0x8487, 0x96c0, 0x7961, 0xcd40, 0xc255, 0x96c0, 0x9b42, 0x2b03, 0x8042, 0x3600, 0xa100, 0xed19 }, 16, 0x0008baa0, 1},
-	{{0xea18, 0x9ac0, 0x290e, 0x8010, 0x90c0, 0x2d0a, 0x8004, 0x3c20, 0xa000, 0x2a0b, 0x8004, 0x90c0, 0x280f, 0x800c, 0x96c0, 0xe954 }, 16, 0x0008bac0, 1},
-	{{0x280c, 0x8008, 0x9ac0, 0x2902, 0x8002, 0x90c0, 0x2ae2, 0x9ffc, 0x2b02, 0x8004, 0x1395, 0x5296, 0x6cdd, 0x76c1, 0x45ac, 0x1091 }, 16, 0x0008bae0, 1},
-	{{0x5692, 0x6f22, 0x7546, 0x42af, 0x14b9, 0x50b2, 0x6dc0, 0x7643, 0x3480, 0xa000, 0x44aa, 0x11b5, 0x55be, 0x92d0, 0x6e25, 0x7544 }, 16, 0x0008bb00, 1},
-	{{0x42ab, 0x3a60, 0xb000, 0x7fc3, 0x7750, 0xede9, 0xeee8, 0x3800, 0xa800, 0x77d1, 0xcf47, 0xed64, 0x3600, 0xa100, 0x5395, 0xe944 }, 16, 0x0008bb20, 1},
-	{{0xef18, 0x96c0, 0x4397, 0x2f0a, 0x8004, 0x36c0, 0xa000, 0x5291, 0xefeb, 0x9f70, 0x4292, 0x90c0, 0x90c0, 0x90c0, 0x90c0, 0x90c0 }, 16, 0x0008bb40, 1},
-	{{0x3e80, 0xa004, 0x74d7, 0x6f90, 0x6d10, 0xfcc3, 0x2808, 0x8004, 0x3c00, 0xa001, 0x2304, 0x807f, 0x7456, 0x2b03, 0x8070, 0x3800 }, 16, 0x0008bb60, 1},
-	{{0xa100, 0x5494, 0x2c09, 0x8004, 0x3800, 0xa100, 0x4490, 0x290c, 0x8004, 0x3680, 0xa100, 0x4790, 0xebef, 0x3680, 0xa100, 0x5191 }, 16, 0x0008bb80, 1},
-	{{0xeaee, 0x96c0, 0x4191, 0x2c0b, 0x87f8, 0x9ac0, 0x290e, 0x8008, 0x90c0, 0x2c0d, 0x87fc, 0x9ac0, 0x280a, 0x8008, 0x90c0, 0x2c0f }, 16, 0x0008bba0, 1},
-	{{0x8010, 0x3680, 0xa000, 0x4294, 0xe94c, 0x94c0, 0xe84c, 0xec54, 0x9ac0, 0x29e2, 0x9ffc, 0x90c0, 0x2a02, 0x8004, 0x2b02, 0x8002 }, 16, 0x0008bbc0, 1},
-	{{0x1797, 0x5493, 0x6cd7, 0x7741, 0x46ba, 0x1095, 0x5194, 0x6c91, 0x77c1, 0x47b8, 0x10ad, 0x51b4, 0x6d51, 0x76c2, 0x45be, 0x13ab }, 16, 0x0008bbe0, 1},
-	{{0x55b7, 0x92d0, 0x6c2d, 0x77c0, 0x47b9, 0x3e20, 0xa300, 0x6f10, 0x6e90, 0x77d1, 0xe944, 0x280e, 0x83fc, 0x38c0, 0xa000, 0x5399 }, 16, 0x0008bc00, 1},
-	{{0x2c09, 0x83fc, 0x3640, 0xa000, 0x439e, 0xefeb, 0x3600, 0xa800, 0x7750, 0x4696, 0x36c0, 0xa000, 0x5491, 0xeeea, 0x94c0, 0x4499 }, 16, 0x0008bc20, 1},
-	{{0x9f70, 0x4591, 0x90c0, 0x90c0, 0x90c0, 0x90c0, 0x90c0, 0x90c0, 0x3a00, 0xa00c, 0x7456, 0x74d7, 0xf385, 0x5491, 0x3800, 0xa100 }, 16, 0x0008bc40, 1},
-	{{0x65ea, 0xe8ee, 0x4490, 0x94c7, 0xf185, 0x79c1, 0x3c80, 0xa000, 0x75c3, 0x280e, 0x8004, 0x78e1, 0xeaef, 0x3e80, 0xa000, 0x7753 }, 16, 0x0008bc60, 1},
-	{{0xd5a1, 0x77d3, 0x7cc3, 0x280c, 0x8008, 0x9cc0, 0x7f43, 0x79c1, 0x7be1, 0xcb41, 0x280c, 0x800c, 0x3a80, 0xa000, 0x7dc3, 0xc656 }, 16, 0x0008bc80, 1},
-	{{0x2909, 0x8008, 0x94c0, 0xcd43, 0xeb18, 0x3880, 0xa000, 0xee19, 0x2b0f, 0x8004, 0x3680, 0xa000, 0x5496, 0xed19, 0x94c0, 0x4496 }, 16, 0x0008bca0, 1},
-	{{0x8455, 0x96c0, 0x9b47, 0x2b03, 0x8020, 0x9ac0, 0x290a, 0x800c, 0x90c0, 0x2d0e, 0x8004, 0x9ac0, 0x2a02, 0x8002, 0x90c0, 0x2be2 }, 16, 0x0008bcc0, 1},
-	{{0x9ffe, 0x1792, 0x5495, 0x6cb7, 0x41bf, 0x3680, 0xa000, 0x5291, 0x5396, 0x6fdd, 0x47bb, 0x3600, 0xa100, 0x57b6, 0x54b1, 0x6eb7 }, 16, 0x0008bce0, 1},
-	{{0x3480, 0xa000, 0x45b4, 0x94d0, 0x50b2, 0x57b5, 0x6ec3, 0x45b4, 0x3800, 0xa800, 0x7750, 0xcb46, 0xe944, 0x3600, 0xa100, 0x5491 }, 16, 0x0008bd00, 1},
-	{{0xee44, 0x3640, 0xa000, 0xeb18, 0xeee8, 0x96c0, 0x4493, 0x2b0f, 0x8004, 0x3480, 0xa000, 0x5796, 0x3800, 0xa800, 0x77d1, 0x4797 }, 16, 0x0008bd20, 1},
-	{{0x9f70, 0x3420, 0xa000, 0xefea, 0x3550, 0x3451, 0x03fc, 0x9ff6, 0x2275, 0xd89b, 0x2e75, 0x3281, 0x2000, 0x8000, 0x757a, 0x6c98 }, 16, 0x0008bd40, 1},
-	{{0xd891, 0x6174, 0x6d74, 0x9f70, 0x6c48, 0x3550, 0x3451, 0x03fc, 0x9ff6, 0x2275, 0x01fc, 0x9ff4, 0x2e75, 0x6174, 0x6d74, 0x9f70 }, 16, 0x0008bd60, 1},
-	{{0x6c48, 0x2c10, 0x39e0, 0x2208, 0x8009, 0x9356, 0x2b03, 0x800a, 0x3800, 0x270c, 0x800a, 0x5159, 0x92d0, 0x5298, 0xd912, 0x6018 }, 16, 0x0008bd80, 1},
-	{{0x09e3, 0x223c, 0x8009, 0x6174, 0x6d74, 0x7d47, 0x6565, 0x9f70, 0x0202, 0x2764, 0x800a, 0x31a4, 0x3730, 0x8008, 0x31a4, 0x39c0 }, 16, 0x0008bda0, 1},
-	{{0x8008, 0x31a4, 0x3d6a, 0x8008, 0x31a4, 0x363a, 0x8008, 0x31a4, 0x3620, 0x8008, 0x3324, 0x3f30, 0x8009, 0xeee8, 0x1096, 0x82e8 }, 16, 0x0008bdc0, 1},
-	{{0x0d00, 0xa001, 0x2709, 0x8040, 0x2618, 0x8a04, 0xe7e9, 0xc984, 0x1896, 0x9120, 0x90c0, 0xe889, 0x2518, 0x89f4, 0x39e0, 0x21f0 }, 16, 0x0008bde0, 1},
-	{{0x8009, 0x90c0, 0xa8c8, 0x90c0, 0x9861, 0x0886, 0x3a58, 0x8009, 0x2e0f, 0x8714, 0x1090, 0x81c8, 0x0006, 0x82e6, 0x0886, 0x3a58 }, 16, 0x0008be00, 1},
-	{{0x8009, 0xe9ef, 0x1000, 0x82c0, 0x3118, 0x800f, 0xd421, 0x84d3, 0x30c1, 0x2000, 0x800c, 0xf041, 0x32a4, 0x3b60, 0x8008, 0x3860 }, 16, 0x0008be20, 1},
-	{{0x2788, 0x800a, 0x38e8, 0x3c28, 0xbfff, 0x1086, 0x8b14, 0x0086, 0x8718, 0x1190, 0x30a1, 0x2000, 0x8000, 0x33b9, 0x8000, 0x3478 }, 16, 0x0008be40, 1},
-	{{0x38e8, 0x3c28, 0xbfff, 0x7061, 0x800d, 0x5190, 0x33b9, 0x8000, 0x7061, 0x85f9, 0x3860, 0x2b90, 0x800a, 0x30c1, 0x3000, 0x800c }, 16, 0x0008be60, 1},
-	{{0x2809, 0x8408, 0x32a4, 0x3b60, 0x8008, 0xf041, 0x0886, 0x3a58, 0x8009, 0x1686, 0x8718, 0x1000, 0x82c0, 0x3119, 0x800f, 0xd0a3 }, 16, 0x0008be80, 1},
-	{{0x8428, 0x1786, 0x8714, 0x3118, 0x80f0, 0x3c64, 0x3860, 0x2788, 0x800a, 0xd021, 0x8415, 0x2900, 0x8400, 0x90c0, 0xef39, 0x3224 }, 16, 0x0008bea0, 1},
-	{{0x31c0, 0x8009, 0xe9ef, 0x8817, 0x2900, 0x8400, 0x3860, 0x2788, 0x800a, 0xef39, 0x3204, 0x3c70, 0x8009, 0xe9ef, 0x1086, 0x8714 }, 16, 0x0008bec0, 1},
-	{{0x1286, 0x8318, 0x1186, 0x8718, 0x0086, 0x8318, 0x1086, 0x8714, 0xf246, 0xf144, 0xf045, 0x0686, 0x8718, 0x881e, 0x0786, 0x8714 }, 16, 0x0008bee0, 1},
-	{{0x00e4, 0x2a4c, 0x8009, 0x2e08, 0x8314, 0xf001, 0x32a4, 0x3a60, 0x8008, 0x39c0, 0x2000, 0x800c, 0x08e6, 0x2bb4, 0x8009, 0x3061 }, 16, 0x0008bf00, 1},
-	{{0x2788, 0x800a, 0x4090, 0x08e6, 0x2bb4, 0x8009, 0x2e09, 0x8314, 0x2aff, 0x9e87, 0x1890, 0xf947, 0x09e6, 0x2bb4, 0x8009, 0x2aff }, 16, 0x0008bf20, 1},
-	{{0x9e7f, 0x5899, 0x00e4, 0x2a4c, 0x8009, 0x3440, 0xfcc7, 0x3c43, 0x08e6, 0x2bb4, 0x8009, 0xc940, 0x5890, 0x2aff, 0x9e5d, 0xe91c }, 16, 0x0008bf40, 1},
-	{{0x09e6, 0x2bb4, 0x8009, 0x90c0, 0x5891, 0x2aff, 0x9e53, 0x2909, 0x805c, 0xc081, 0x1106, 0x82cc, 0xd411, 0x2461, 0x1196, 0x8212 }, 16, 0x0008bf60, 1},
-	{{0x7071, 0x844d, 0x2c10, 0x1106, 0x9122, 0x24ea, 0x2c90, 0xe8ee, 0x2718, 0x85d2, 0x3841, 0x38c2, 0xc941, 0x1206, 0x82e2, 0x4298 }, 16, 0x0008bf80, 1},
-	{{0x0ae6, 0x2bb4, 0x8009, 0x2260, 0x9fff, 0x2a0a, 0x8138, 0xea19, 0x4212, 0x0ae6, 0x2bb4, 0x8009, 0x90c0, 0x2a0a, 0x810c, 0xea19 }, 16, 0x0008bfa0, 1},
-	{{0x4212, 0x1206, 0x9122, 0x7170, 0x81cd, 0x2118, 0x8598, 0x30e0, 0x6c10, 0x8437, 0x1106, 0x9122, 0x24ea, 0xcab2, 0x842d, 0xf8c7 }, 16, 0x0008bfc0, 1},
-	{{0x2be2, 0x9fbe, 0x2ae2, 0x9feb, 0xe9ee, 0xe83a, 0x3841, 0x5110, 0x4191, 0x2909, 0x8108, 0x4191, 0x2909, 0x8058, 0x41b9, 0x41b1 }, 16, 0x0008bfe0, 1},
-	{{0x1106, 0x9122, 0x70f0, 0x81e7, 0x2f10, 0x2f90, 0x1896, 0x82d0, 0x3181, 0x2000, 0x8000, 0x3579, 0xc848, 0x1196, 0x82d4, 0x2c98 }, 16, 0x0008c000, 1},
-	{{0x2d12, 0x1006, 0x9122, 0x246a, 0xf249, 0x2618, 0x8166, 0xf148, 0xfcc7, 0x2b00, 0x8046, 0xcab2, 0x2d00, 0x80a4, 0xe9ec, 0xe8ec }, 16, 0x0008c020, 1},
-	{{0xec3a, 0xe83b, 0x2e0f, 0x8218, 0x2e0a, 0x81b8, 0x2e0b, 0x8058, 0xfc4a, 0xe93d, 0x1093, 0x0de6, 0x2bb4, 0x8009, 0xcc47, 0x1196 }, 16, 0x0008c040, 1},
-	{{0x82d0, 0xf2c9, 0xed44, 0xf101, 0xed1c, 0x1195, 0xf202, 0xf84b, 0xf94c, 0xfa4d, 0xfb4e, 0x2aff, 0x9d4d, 0xfc4f, 0x3650, 0xfbce }, 16, 0x0008c060, 1},
-	{{0x1006, 0x82e2, 0x2c7c, 0xfccf, 0x0493, 0xf1c8, 0x0de6, 0x2bb4, 0x8009, 0xfacd, 0xf102, 0x1092, 0x1196, 0x82d4, 0x2d0d, 0x805c }, 16, 0x0008c080, 1},
-	{{0xf101, 0xed1c, 0x2aff, 0x9d1f, 0x5195, 0x3650, 0xfacd, 0x1006, 0x82ce, 0x2c7c, 0xfcca, 0x0492, 0xfbce, 0x1d14, 0xf8cb, 0x1c9b }, 16, 0x0008c0a0, 1},
-	{{0xf9cc, 0x90c0, 0xecad, 0x80b3, 0x2c10, 0x1d10, 0xcc44, 0xc181, 0xecad, 0x80a7, 0x0de6, 0x2bb4, 0x8009, 0xcc47, 0xed44, 0xed1c }, 16, 0x0008c0c0, 1},
-	{{0x1095, 0xf001, 0xfc4f, 0x32c4, 0x3b40, 0x8008, 0xfb4e, 0x3550, 0x2c10, 0x0de6, 0x2bb4, 0x8009, 0xfccf, 0x2d0d, 0x805c, 0xed1c }, 16, 0x0008c0e0, 1},
-	{{0x1095, 0xf001, 0xf24f, 0x32c4, 0x3b40, 0x8008, 0xc181, 0x2c90, 0xf2cf, 0x24e1, 0x33e1, 0x3fff, 0x9fff, 0x3444, 0x8000, 0x3044 }, 16, 0x0008c100, 1},
-	{{0x8000, 0x3642, 0x8000, 0xd814, 0xd442, 0x6461, 0x6468, 0x92c2, 0x6d10, 0x92c3, 0xc2ff, 0x6561, 0x70f2, 0x8015, 0x70e2, 0x840b }, 16, 0x0008c120, 1},
-	{{0x7063, 0x800d, 0x707b, 0x8409, 0x30e0, 0x3fff, 0x9fff, 0x34d0, 0x1097, 0xf2c9, 0xf202, 0x1296, 0x82d0, 0x2aff, 0x9c69, 0xf201 }, 16, 0x0008c140, 1},
-	{{0x0097, 0xfacd, 0x1801, 0xa008, 0x2aff, 0x9c61, 0x5192, 0xf8cb, 0xf9cc, 0xfacd, 0x8806, 0xfbce, 0x6c10, 0x3b41, 0x3bc4, 0x0091 }, 16, 0x0008c160, 1},
-	{{0xef44, 0x1006, 0x9122, 0x3076, 0xea44, 0x2cff, 0x9ecb, 0xe944, 0x2bff, 0x9bf3, 0x2c90, 0x1096, 0x8210, 0x6469, 0x8043, 0x1006 }, 16, 0x0008c180, 1},
-	{{0x9122, 0x646a, 0x843b, 0x2be2, 0x9fbe, 0x2e09, 0x8160, 0x2800, 0x80b0, 0x2a02, 0x8042, 0x29e2, 0x9fea, 0x28e2, 0x9fd4, 0x38c1 }, 16, 0x0008c1a0, 1},
-	{{0x50b9, 0x54b1, 0x6c7d, 0x44a9, 0x50a1, 0x1491, 0xe918, 0x6c7d, 0x4491, 0x1006, 0x9122, 0x7071, 0x81e6, 0x2909, 0x805c, 0x2f10 }, 16, 0x0008c1c0, 1},
-	{{0x1006, 0x9122, 0x246a, 0xc9ba, 0x8481, 0xffc7, 0xebee, 0xef39, 0x2e09, 0x8108, 0x3800, 0x20f4, 0x8008, 0x1491, 0x5117, 0x3454 }, 16, 0x0008c1e0, 1},
-	{{0x1306, 0x82d8, 0xd413, 0x2461, 0xd641, 0x2661, 0x12e1, 0x9f50, 0x2c7c, 0xc081, 0x3174, 0xcb4f, 0x8043, 0x0010, 0xf948, 0x10d0 }, 16, 0x0008c200, 1},
-	{{0x0a86, 0x3a54, 0x8009, 0x90c0, 0x0002, 0x8048, 0x1093, 0x1296, 0x82dc, 0xf201, 0x32a4, 0x3d48, 0x8008, 0x11e1, 0x9f50, 0x2aff }, 16, 0x0008c220, 1},
-	{{0x9b91, 0x1106, 0x82e2, 0xcb47, 0x34e0, 0x3fff, 0xbfff, 0x2c7d, 0xf9c8, 0x0493, 0x3800, 0x20f4, 0x8008, 0x3b41, 0x1006, 0x9122 }, 16, 0x0008c240, 1},
-	{{0x3076, 0xe944, 0x8196, 0xeb44, 0x2c90, 0x1996, 0x82d2, 0x2880, 0x8000, 0x1006, 0x9122, 0x246a, 0x2c10, 0xe8f8, 0xe839, 0xf843 }, 16, 0x0008c260, 1},
-	{{0x2618, 0x810e, 0xf148, 0xf049, 0xf085, 0xf04a, 0xe8ee, 0x2c90, 0x1990, 0x0ae6, 0x2bb4, 0x8009, 0xffc9, 0xea44, 0xea1f, 0x1a92 }, 16, 0x0008c280, 1},
-	{{0xc84e, 0x90c0, 0xea39, 0x2aff, 0x9b29, 0xca48, 0x34d0, 0xc846, 0xf0ca, 0x2808, 0x80b0, 0x1090, 0xf002, 0x1296, 0x82d2, 0xf201 }, 16, 0x0008c2a0, 1},
-	{{0x2aff, 0x9b03, 0xf84b, 0x0ae6, 0x2bb4, 0x8009, 0xf8cb, 0x2900, 0x8058, 0x2a0a, 0x80b4, 0xea1f, 0x0092, 0xe839, 0x1090, 0xe839 }, 16, 0x0008c2c0, 1},
-	{{0x1190, 0xf84b, 0x2aff, 0x9ae5, 0x1801, 0xa006, 0x3550, 0x09e6, 0x2bb4, 0x8009, 0xf8cb, 0x2909, 0x80b4, 0x1190, 0xe91f, 0x1091 }, 16, 0x0008c2e0, 1},
-	{{0x3680, 0x2000, 0x8000, 0x2e7d, 0xd4c0, 0xf142, 0xf1c2, 0x2aff, 0x9abb, 0x1801, 0xa00f, 0x35d0, 0x3780, 0x2000, 0x8000, 0x6f7d }, 16, 0x0008c300, 1},
-	{{0x7477, 0x6822, 0x6466, 0x7c6f, 0x2aff, 0x9aa7, 0x6c90, 0xd43f, 0x800e, 0xf8cb, 0x881c, 0x3c41, 0x3940, 0x3e90, 0x8009, 0x3610 }, 16, 0x0008c320, 1},
-	{{0x80df, 0x802b, 0x3c64, 0x3940, 0x3e90, 0x8009, 0x785e, 0x7c41, 0xca40, 0x90c0, 0xea19, 0x5112, 0x34e0, 0x8001, 0x30e0, 0x8001 }, 16, 0x0008c340, 1},
-	{{0x36e1, 0x8001, 0xd810, 0xd441, 0x30cf, 0x950c, 0x27e6, 0xf0c9, 0x3844, 0xf1c8, 0x38c1, 0xf049, 0x2808, 0x80b0, 0x0790, 0xf148 }, 16, 0x0008c360, 1},
-	{{0x2900, 0x80ac, 0x1006, 0x9122, 0x3071, 0xe839, 0x8103, 0x2f10, 0x2f90, 0x1006, 0x9122, 0x246a, 0x6c10, 0x8467, 0x2e0f, 0x80b0 }, 16, 0x0008c380, 1},
-	{{0xf048, 0x1097, 0x1106, 0x82e6, 0x2aff, 0x9a27, 0x6466, 0x32a4, 0x3610, 0x8008, 0x2160, 0x9fff, 0x28b0, 0x3b41, 0x3bc2, 0xc947 }, 16, 0x0008c3a0, 1},
-	{{0x3cef, 0x0ae6, 0x2bb4, 0x8009, 0x00e0, 0x2238, 0x8009, 0xf0c8, 0x3844, 0xc840, 0xea44, 0xea18, 0x1092, 0xf048, 0xd891, 0x6174 }, 16, 0x0008c3c0, 1},
-	{{0x6d74, 0x429f, 0x08e6, 0x2bb4, 0x8009, 0x00e4, 0x2238, 0x8009, 0x2808, 0x810c, 0xe819, 0x4010, 0x1006, 0x9122, 0x7076, 0x81a5 }, 16, 0x0008c3e0, 1},
-	{{0x2c90, 0x1096, 0x8210, 0x6469, 0x8439, 0x1006, 0x9122, 0x646a, 0x8431, 0x2e09, 0x8058, 0x2be2, 0x9fea, 0x2ae2, 0x9fd4, 0x29e2 }, 16, 0x0008c400, 1},
-	{{0x9fbf, 0x38c1, 0x5091, 0x2908, 0x8108, 0x54b8, 0x6c7d, 0x44b0, 0x5090, 0x2809, 0x8108, 0x40a9, 0x1006, 0x9122, 0x7071, 0x81e5 }, 16, 0x0008c420, 1},
-	{{0x0886, 0x3a58, 0x8009, 0x90c0, 0x1000, 0x8288, 0x3118, 0x8002, 0x7440, 0xd021, 0x8467, 0x1000, 0x82c0, 0x3118, 0x800f, 0xd421 }, 16, 0x0008c440, 1},
-	{{0x8441, 0xf9c7, 0xf2c4, 0xf1c6, 0xf0c5, 0xf941, 0x1686, 0x8718, 0x1786, 0x8714, 0xe8ee, 0x0286, 0x8718, 0x0086, 0x8714, 0x0186 }, 16, 0x0008c460, 1},
-	{{0x8318, 0x3224, 0x37f6, 0x8009, 0x3960, 0x38b8, 0x800a, 0x1086, 0x8714, 0x0086, 0x8318, 0x0686, 0x8718, 0x8820, 0x0786, 0x8714 }, 16, 0x0008c480, 1},
-	{{0xf9c7, 0xf941, 0xe8ee, 0x3224, 0x37f6, 0x8009, 0x3960, 0x38b8, 0x800a, 0x1086, 0x8714, 0x0086, 0x8318, 0x2f10, 0x2f90, 0x1006 }, 16, 0x0008c4a0, 1},
-	{{0x9122, 0x646a, 0x847d, 0x09e6, 0x2bb4, 0x8009, 0xc847, 0x290b, 0x8138, 0xc9ac, 0xe81b, 0xca47, 0xeb39, 0xeb1a, 0x5013, 0x4010 }, 16, 0x0008c4c0, 1},
-	{{0x0886, 0x3a58, 0x8009, 0x90c0, 0x1000, 0x8288, 0x3118, 0x8002, 0x3440, 0x08e6, 0x2bb4, 0x8009, 0xd021, 0x843b, 0x2808, 0x8138 }, 16, 0x0008c4e0, 1},
-	{{0xe81a, 0x2060, 0x9fff, 0x4010, 0x0886, 0x3a58, 0x8009, 0x90c0, 0x1000, 0x8288, 0x0d00, 0xa001, 0x841d, 0x08e6, 0x2bb4, 0x8009 }, 16, 0x0008c500, 1},
-	{{0xf9c7, 0x2aff, 0x9895, 0x5890, 0x09e6, 0x2bb4, 0x8009, 0x2aff, 0x988f, 0x5899, 0x3b41, 0x3bc2, 0x1006, 0x9122, 0x7076, 0x8189 }, 16, 0x0008c520, 1},
-	{{0x1096, 0x8210, 0x7841, 0x3478, 0x0006, 0x8210, 0x0886, 0x3a58, 0x8009, 0x90c0, 0x1100, 0x81a2, 0x30f0, 0x6c10, 0x8007, 0x0006 }, 16, 0x0008c540, 1},
-	{{0x8210, 0x1096, 0x8212, 0x2160, 0x9fff, 0x32a4, 0x3600, 0x8008, 0x7841, 0x2c90, 0x3800, 0x20f6, 0x8008, 0x0006, 0x8212, 0x0110 }, 16, 0x0008c560, 1},
-	{{0xe9ee, 0x10d0, 0x0886, 0x3a54, 0x8009, 0x90c0, 0x0000, 0x804a, 0x0886, 0x3a58, 0x8009, 0x90c0, 0x1000, 0x8288, 0x0d00, 0xa001 }, 16, 0x0008c580, 1},
-	{{0x8451, 0x08e6, 0x2bb4, 0x8009, 0x90c0, 0xe844, 0xf841, 0x3224, 0x3cf6, 0x8009, 0x3860, 0x3ac4, 0x800a, 0x2c10, 0x1106, 0x9122 }, 16, 0x0008c5a0, 1},
-	{{0x24ea, 0x2c90, 0x3860, 0x3f58, 0x800a, 0x8427, 0x3841, 0x38c2, 0x1258, 0xc941, 0x0ae6, 0x2bb4, 0x8009, 0x90c0, 0x2a0a, 0x8138 }, 16, 0x0008c5c0, 1},
-	{{0xea19, 0x5352, 0x653d, 0x4252, 0x1206, 0x9122, 0x7170, 0x81df, 0x0ae6, 0x2bb4, 0x8009, 0xf8c7, 0x32a4, 0x38a0, 0x8008, 0x2a09 }, 16, 0x0008c5e0, 1},
-	{{0x8138, 0x00e4, 0x2a4c, 0x8009, 0xf001, 0xf9c7, 0x32a4, 0x3c50, 0x8008, 0x38a0, 0x2000, 0x800c, 0x38e8, 0x3c0c, 0xbfff, 0x31e9 }, 16, 0x0008c600, 1},
-	{{0x3fff, 0xbfff, 0x1290, 0xc0b2, 0xdc82, 0x0991, 0xa000, 0x32e4, 0x3a68, 0x8001, 0x4190, 0x38e8, 0x3c28, 0xbfff, 0xc0fd, 0x1590 }, 16, 0x0008c620, 1},
-	{{0xc1f7, 0xdc05, 0x0090, 0xc2fb, 0x1090, 0xc4fe, 0xdc80, 0x0901, 0xa008, 0x4190, 0x5090, 0xdd00, 0x0902, 0xa004, 0x4290, 0x1190 }, 16, 0x0008c640, 1},
-	{{0x00e4, 0x2a4a, 0x8009, 0x7c44, 0x23e0, 0x9f0f, 0x3118, 0x80f0, 0xdd81, 0xdc1b, 0x0090, 0xc083, 0x0006, 0x9120, 0x5090, 0xde00 }, 16, 0x0008c660, 1},
-	{{0x0904, 0xa001, 0x4490, 0x9f7d, 0x1096, 0x9120, 0xd024, 0x9f7c, 0x2718, 0x815c, 0x00e4, 0x2a4a, 0x8009, 0xc18f, 0x2d11, 0x1096 }, 16, 0x0008c680, 1},
-	{{0x82fc, 0x6469, 0x840c, 0x94c3, 0x2c00, 0x8b1c, 0x2c00, 0x8d1c, 0x2d90, 0x3672, 0x36f2, 0x01e4, 0x2a46, 0x8009, 0x3441, 0x3a61 }, 16, 0x0008c6a0, 1},
-	{{0xcc51, 0x246a, 0x39c0, 0x2004, 0x800c, 0x2e08, 0x8f1c, 0x847e, 0xec1e, 0x2b02, 0x8004, 0x3ac0, 0x2000, 0x800c, 0xebe8, 0x26ea }, 16, 0x0008c6c0, 1},
-	{{0x34f2, 0x56ba, 0x8415, 0x3224, 0x3eb0, 0x8009, 0x7456, 0xd71c, 0x3d19, 0x8001, 0x880e, 0x6c51, 0x3224, 0x3eb0, 0x8009, 0x3456 }, 16, 0x0008c6e0, 1},
-	{{0x74f2, 0x26ea, 0x111b, 0x57b9, 0x8418, 0x2f51, 0x3457, 0x74f2, 0x3324, 0x3eb0, 0x8009, 0xd79c, 0x3f19, 0x8001, 0x880e, 0x6c51 }, 16, 0x0008c700, 1},
-	{{0x3224, 0x3eb0, 0x8009, 0x3457, 0x74f2, 0x3f48, 0x39c1, 0x511b, 0x2c51, 0x2765, 0xcc59, 0x3c48, 0x3f48, 0x74c1, 0x2465, 0x375e }, 16, 0x0008c720, 1},
-	{{0x70f3, 0x3c48, 0x465c, 0x7458, 0x8196, 0x405c, 0x3672, 0x36f2, 0xcc59, 0x35c1, 0x3a61, 0x3ac0, 0x200c, 0x800c, 0x30f3, 0x39c0 }, 16, 0x0008c740, 1},
-	{{0x2008, 0x800c, 0x846d, 0x2b02, 0x8004, 0x26ea, 0x74f2, 0x8416, 0x56b9, 0x3224, 0x3eb0, 0x8009, 0x7456, 0xd71c, 0x3d19, 0x8001 }, 16, 0x0008c760, 1},
-	{{0x8810, 0x6f51, 0x3224, 0x3eb0, 0x8009, 0x3456, 0x74f2, 0x7750, 0x26ea, 0x34f2, 0x57ba, 0x8415, 0x3224, 0x3eb0, 0x8009, 0x7457 }, 16, 0x0008c780, 1},
-	{{0xd79c, 0x3f19, 0x8001, 0x880e, 0x6c51, 0x3224, 0x3eb0, 0x8009, 0x3457, 0x74f2, 0x3f48, 0x3c48, 0x39c1, 0xcc59, 0x2765, 0x2465 }, 16, 0x0008c7a0, 1},
-	{{0x70f3, 0x3f48, 0x7c48, 0x375e, 0x7458, 0x4658, 0x819e, 0x4058, 0x9f7d, 0x1196, 0x82e8, 0x0901, 0xa002, 0x34f9, 0xc0fe, 0xdc01 }, 16, 0x0008c7c0, 1},
-	{{0x0006, 0x82e8, 0x9f7c, 0x6c10, 0x0006, 0x9120, 0x27e8, 0x9fc0, 0x3024, 0x3f50, 0x8009, 0xe7e8, 0x2aff, 0x95dd, 0x3800, 0x249c }, 16, 0x0008c7e0, 1},
-	{{0x800a, 0x0207, 0x2786, 0x800a, 0x0c02, 0xa001, 0x8035, 0xc0fe, 0x0107, 0x2780, 0x800a, 0x38c1, 0x3800, 0x2064, 0x8008, 0xdc02 }, 16, 0x0008c800, 1},
-	{{0x0000, 0x2786, 0x800a, 0x0100, 0x2780, 0x800a, 0x10d0, 0x39e8, 0x2404, 0xbfff, 0x7841, 0x4010, 0x5091, 0x0910, 0xa001, 0x4091 }, 16, 0x0008c820, 1},
-	{{0x9f71, 0x33c4, 0x3996, 0x8008, 0x2c10, 0x5890, 0x90c0, 0x5190, 0x0d01, 0xa020, 0x8015, 0x0107, 0x35bc, 0x800a, 0xd0a1, 0x800b }, 16, 0x0008c840, 1},
-	{{0xd0a3, 0x8007, 0x64e9, 0x8405, 0xc081, 0x9f71, 0x3324, 0x3f30, 0x8009, 0x2c90, 0xe748, 0x2000, 0x9124, 0xf041, 0xeee9, 0x32e4 }, 16, 0x0008c860, 1},
-	{{0x3c8a, 0x8001, 0xefe8, 0x0004, 0x3870, 0x800a, 0xd030, 0x2100, 0x8100, 0xc288, 0x94c2, 0x2000, 0x8080, 0x01e0, 0x2a4c, 0x8009 }, 16, 0x0008c880, 1},
-	{{0x8010, 0x02e0, 0x2a4a, 0x8009, 0x2100, 0x8080, 0x2000, 0x8040, 0x2f90, 0x00e0, 0x2a44, 0x8009, 0x2c90, 0x01e0, 0x2a46, 0x8009 }, 16, 0x0008c8a0, 1},
-	{{0xc096, 0x0007, 0x9122, 0x1006, 0x81a4, 0x0007, 0x82cc, 0x1006, 0x81a6, 0x0007, 0x82ce, 0x1006, 0x81aa, 0x0007, 0x82d0, 0x1006 }, 16, 0x0008c8c0, 1},
-	{{0x81ac, 0x0007, 0x82d2, 0x1006, 0x81ae, 0x0007, 0x82d4, 0x1006, 0x81b2, 0x0007, 0x82d6, 0x1206, 0x81b8, 0x3d64, 0xc59e, 0x3a00 }, 16, 0x0008c8e0, 1},
-	{{0xa004, 0x7655, 0x3000, 0x2000, 0xbfe0, 0x0207, 0x82da, 0x1306, 0x81ce, 0x3dcf, 0x3208, 0x2000, 0x8170, 0x2d90, 0x03e2, 0x2204 }, 16, 0x0008c900, 1},
-	{{0x8009, 0x1406, 0x8196, 0x04e0, 0x223a, 0x8009, 0x1406, 0x81b8, 0x391c, 0x800f, 0x0407, 0x82d8, 0x1406, 0x81bc, 0x0407, 0x82dc }, 16, 0x0008c920, 1},
-	{{0x1406, 0x81c0, 0x0407, 0x82e0, 0x1406, 0x81c4, 0x0407, 0x82e2, 0x1496, 0x81c8, 0x0407, 0x82e6, 0x1406, 0x8114, 0x3400, 0xa004 }, 16, 0x0008c940, 1},
-	{{0x7454, 0x3400, 0xa804, 0x6c7d, 0x3600, 0xa80c, 0x7454, 0x7657, 0x3400, 0xa804, 0x6c7c, 0x3a00, 0xa800, 0x7754, 0x33e4, 0x3e52 }, 16, 0x0008c960, 1},
-	{{0x8001, 0x32e4, 0x3ea0, 0x8001, 0x37d0, 0x3456, 0x7751, 0x2760, 0x3550, 0x35d1, 0x7457, 0x32e4, 0x3eac, 0x8001, 0x74d6, 0x33e4 }, 16, 0x0008c980, 1},
-	{{0x3ebe, 0x8001, 0x3304, 0x2a86, 0x8009, 0x2c90, 0x0087, 0x911c, 0x2704, 0x8100, 0x1006, 0x81c6, 0x39e0, 0x2844, 0x8009, 0x38e0 }, 16, 0x0008c9a0, 1},
-	{{0x2644, 0x8009, 0x0117, 0x82ec, 0x0007, 0x8306, 0x0107, 0x82ee, 0x94c8, 0x4118, 0x4119, 0x2f08, 0x8b1c, 0x0887, 0x82f4, 0x2808 }, 16, 0x0008c9c0, 1},
-	{{0x8200, 0x0887, 0x82f8, 0x0004, 0x3870, 0x800a, 0xd030, 0x8423, 0x2100, 0x807f, 0x0107, 0x8214, 0x1806, 0x81be, 0x1097, 0x82e0 }, 16, 0x0008c9e0, 1},
-	{{0xe8fc, 0x0900, 0xa001, 0x0807, 0x82de, 0x8820, 0x0007, 0x82e0, 0xc2bf, 0xc1fe, 0x1097, 0x82e0, 0x0207, 0x8214, 0x1206, 0x81be }, 16, 0x0008ca00, 1},
-	{{0xdc80, 0x0207, 0x82de, 0x0107, 0x82e0, 0x2c10, 0x39c0, 0x2eea, 0x8008, 0x0007, 0x9120, 0x32e4, 0x3a5c, 0x8001, 0xc0b2, 0xc183 }, 16, 0x0008ca20, 1},
-	{{0x32e4, 0x3a62, 0x8001, 0xc0b2, 0x1106, 0x82c0, 0x3318, 0x800f, 0xd023, 0x8415, 0x3318, 0x80f0, 0x7c64, 0xd021, 0x840b, 0x3324 }, 16, 0x0008ca40, 1},
-	{{0x2250, 0x8009, 0x8809, 0x3304, 0x3ac0, 0x8009, 0x1006, 0x8288, 0x0d00, 0xa001, 0x840f, 0x3224, 0x3a3e, 0x8009, 0x3860, 0x3ac4 }, 16, 0x0008ca60, 1},
-	{{0x800a, 0x1006, 0x8288, 0x3118, 0x8002, 0x3440, 0xe9ee, 0xd021, 0x840f, 0x3224, 0x37ba, 0x8009, 0x3860, 0x38b8, 0x800a, 0x3024 }, 16, 0x0008ca80, 1},
-	{{0x3f50, 0x8009, 0xe768, 0x1051, 0xf186, 0x64ea, 0x8417, 0x9b41, 0x2b03, 0x8008, 0x01fc, 0x9ff6, 0x92d0, 0x5250, 0x2551, 0x7452 }, 16, 0x0008caa0, 1},
-	{{0x4258, 0x9f70, 0x4051, 0x3324, 0x3f30, 0x8009, 0x2c90, 0x2d10, 0x0a07, 0x277c, 0x800a, 0x0d0a, 0xa001, 0x94c6, 0xc94c, 0x6d90 }, 16, 0x0008cac0, 1},
-	{{0x00e4, 0x2a46, 0x8009, 0xe748, 0x94c7, 0x646a, 0xc381, 0xc848, 0x8490, 0x037c, 0x9ff8, 0xc944, 0xc840, 0xfac9, 0x137c, 0x9ff8 }, 16, 0x0008cae0, 1},
-	{{0x3b40, 0x3c7e, 0x8009, 0xf593, 0x04e4, 0x2a44, 0x8009, 0x3e41, 0xd6c1, 0x7265, 0x8409, 0xf593, 0x6e15, 0xf413, 0x37d2, 0x3650 }, 16, 0x0008cb00, 1},
-	{{0x25e9, 0xf593, 0x3fc1, 0xd6c1, 0x3ec1, 0x3bc1, 0xcd47, 0x3fc2, 0xcc45, 0xce45, 0xec1a, 0x1614, 0xcc47, 0xed1b, 0x1715, 0xee19 }, 16, 0x0008cb20, 1},
-	{{0x5516, 0x2b3b, 0x2bbf, 0xec18, 0xc588, 0x6a09, 0x3650, 0xcd44, 0x90c0, 0x2f10, 0x4695, 0x801c, 0x4794, 0x7941, 0x2a09, 0x76d2 }, 16, 0x0008cb40, 1},
-	{{0x3ec1, 0xcc44, 0x7ac1, 0x3ec2, 0x4694, 0xcc45, 0x90c0, 0xec18, 0x4694, 0x3941, 0x38c1, 0x04e4, 0x2a46, 0x8009, 0x7272, 0x8189 }, 16, 0x0008cb60, 1},
-	{{0x3024, 0x3f50, 0x8009, 0xe768, 0x3324, 0x3f30, 0x8009, 0xeee8, 0x1096, 0x82f0, 0x3610, 0x80ff, 0x840a, 0x2c10, 0xe748, 0x0006 }, 16, 0x0008cb80, 1},
-	{{0x82f0, 0x1096, 0x82f0, 0x1206, 0x82ee, 0x2d52, 0x39e0, 0x2644, 0x8009, 0xc842, 0x1006, 0x830c, 0xe8f9, 0xe8fc, 0xe918, 0x0011 }, 16, 0x0008cba0, 1},
-	{{0x39e0, 0x2844, 0x8009, 0x1006, 0x830e, 0xe918, 0x0011, 0x3ae0, 0x2444, 0x8009, 0x39e0, 0x2244, 0x8009, 0xea18, 0x0112, 0xf091 }, 16, 0x0008cbc0, 1},
-	{{0xe819, 0x0010, 0x3800, 0x20f4, 0x8008, 0x1096, 0x82f0, 0x3841, 0x39e0, 0x2644, 0x8009, 0x34f8, 0x0006, 0x82f0, 0x00e4, 0x2a44 }, 16, 0x0008cbe0, 1},
-	{{0x8009, 0x3071, 0x6c90, 0x2518, 0x81da, 0x1096, 0x82e8, 0x0900, 0xa005, 0x0106, 0x82f0, 0x0006, 0x82e8, 0x4110, 0x10d0, 0x0886 }, 16, 0x0008cc00, 1},
-	{{0x3a54, 0x8009, 0x2e0a, 0x82fe, 0x0000, 0x8048, 0x0006, 0x35c4, 0x800a, 0x3169, 0x9000, 0x3cfc, 0x00e4, 0x2a44, 0x8009, 0x01e0 }, 16, 0x0008cc20, 1},
-	{{0x2a48, 0x8009, 0x1806, 0x82ee, 0x1106, 0x8306, 0xe8fc, 0xe819, 0xf101, 0xf002, 0x2aff, 0x9e53, 0xe9ea, 0x1806, 0x82ee, 0x39e0 }, 16, 0x0008cc40, 1},
-	{{0x2844, 0x8009, 0xe8fc, 0xe819, 0x1106, 0x8306, 0xea44, 0x00e4, 0x2a44, 0x8009, 0xf002, 0xf101, 0x2aff, 0x9e2f, 0xe9ea, 0x1806 }, 16, 0x0008cc60, 1},
-	{{0x82ee, 0x39e0, 0x2444, 0x8009, 0xe8fc, 0xe819, 0x1106, 0x8306, 0xea46, 0x00e4, 0x2a44, 0x8009, 0xf002, 0xf101, 0x2aff, 0x9e0b }, 16, 0x0008cc80, 1},
-	{{0xe9ea, 0x1806, 0x82ee, 0x39e0, 0x2244, 0x8009, 0xe8fc, 0xe819, 0x1106, 0x8306, 0xea42, 0x00e4, 0x2a44, 0x8009, 0xf002, 0xf101 }, 16, 0x0008cca0, 1},
-	{{0x2aff, 0x9de7, 0xe9ea, 0x1006, 0x82ee, 0x2469, 0x1016, 0x82ec, 0x92c3, 0x6c90, 0x98c6, 0x6469, 0x01e4, 0x2a44, 0x8009, 0x840e }, 16, 0x0008ccc0, 1},
-	{{0x98c7, 0x0106, 0x82ee, 0x90c0, 0x6d10, 0xc281, 0x1006, 0x82ee, 0x31e1, 0x2644, 0x8009, 0xf003, 0xf141, 0x0216, 0x82ec, 0x39e0 }, 16, 0x0008cce0, 1},
-	{{0x2844, 0x8009, 0x2aff, 0x9dc3, 0x38a0, 0x2000, 0x800c, 0x38e8, 0x3c0c, 0xbfff, 0x31e9, 0x3fff, 0xbfff, 0x1290, 0xc0b2, 0xdc82 }, 16, 0x0008cd00, 1},
-	{{0x0991, 0xa000, 0x32e4, 0x3a68, 0x8001, 0x4190, 0x38e8, 0x3c28, 0xbfff, 0xc0fd, 0x1590, 0xc1f7, 0xdc05, 0x0090, 0xc2fb, 0x1090 }, 16, 0x0008cd20, 1},
-	{{0xc4fe, 0xdc80, 0x0190, 0x30e1, 0x2244, 0x8009, 0x1090, 0xf041, 0xdd00, 0x0902, 0xa004, 0x0290, 0x39e0, 0x2444, 0x8009, 0x1190 }, 16, 0x0008cd40, 1},
-	{{0x00e4, 0x2a4a, 0x8009, 0x7c44, 0x23e0, 0x9f0f, 0x3118, 0x80f0, 0xdd81, 0xdc1b, 0x0090, 0xc081, 0x0006, 0x9120, 0x5090, 0xde00 }, 16, 0x0008cd60, 1},
-	{{0x0904, 0xa001, 0x0490, 0x38a0, 0x3000, 0x800c, 0x1006, 0x82ee, 0x2aff, 0x9d37, 0xf003, 0x2c10, 0x38e8, 0x3c28, 0xbfff, 0x00e2 }, 16, 0x0008cd80, 1},
-	{{0x2240, 0x8009, 0x1190, 0x38e8, 0x3c28, 0xbfff, 0x0d81, 0xa000, 0x8013, 0x7841, 0x00e2, 0x2240, 0x8009, 0x5190, 0x0c81, 0xa000 }, 16, 0x0008cda0, 1},
-	{{0x81f3, 0x38e8, 0x3c28, 0xbfff, 0xc0fd, 0x1290, 0xc1fe, 0xdc02, 0x0900, 0xa002, 0x4090, 0x5090, 0xdc80, 0x0901, 0xa001, 0x4190 }, 16, 0x0008cdc0, 1},
-	{{0x1096, 0x82e8, 0x0c00, 0xa004, 0x8063, 0x2d10, 0x1196, 0x82f2, 0x38c1, 0x1006, 0x82de, 0x34f9, 0x0106, 0x82f2, 0x3071, 0xc1fb }, 16, 0x0008cde0, 1},
-	{{0x804b, 0x1096, 0x82e8, 0xdc80, 0x3479, 0x0206, 0x82f2, 0x0d00, 0xa002, 0x8012, 0x0106, 0x82e8, 0x1096, 0x82ea, 0x0900, 0xa001 }, 16, 0x0008ce00, 1},
-	{{0x0006, 0x82ea, 0x2e09, 0x8b1c, 0xc0fd, 0x1296, 0x82e8, 0x1196, 0x82fc, 0x2908, 0x8200, 0xdc02, 0xd881, 0x0006, 0x82e8, 0x0106 }, 16, 0x0008ce20, 1},
-	{{0x82fc, 0x0986, 0x82f4, 0x0886, 0x82f8, 0x1096, 0x82fc, 0x6469, 0x8431, 0x1886, 0x82f4, 0x1096, 0x82e0, 0x1010, 0x0d00, 0xa001 }, 16, 0x0008ce40, 1},
-	{{0xe844, 0x8008, 0x0006, 0x830e, 0xe844, 0x2e09, 0x8d1c, 0xe988, 0x800b, 0x2a00, 0x8200, 0xe8e9, 0xe83a, 0x8832, 0x2a00, 0x8a28 }, 16, 0x0008ce60, 1},
-	{{0x1886, 0x82f8, 0x1096, 0x82e0, 0x1010, 0x0d00, 0xa001, 0xe844, 0x8008, 0x0006, 0x830e, 0xe844, 0x2e09, 0x8f1c, 0xe988, 0x800b }, 16, 0x0008ce80, 1},
-	{{0x2a00, 0x8200, 0xe8e9, 0xe83a, 0x2a00, 0x8c24, 0xe768, 0xe93a, 0x4891, 0x1106, 0x830e, 0x3ccf, 0x1006, 0x8300, 0x1206, 0x8306 }, 16, 0x0008cea0, 1},
-	{{0x2892, 0x1006, 0x830c, 0x24e8, 0x0006, 0x8312, 0x94c3, 0x3341, 0x8000, 0x7cef, 0x7cc8, 0x64e5, 0x7cc8, 0x74d9, 0x0196, 0x8300 }, 16, 0x0008cec0, 1},
-	{{0x3024, 0x3f50, 0x8009, 0x0196, 0x8310, 0x32e4, 0x3a68, 0x8001, 0xc0b2, 0x0007, 0x35bc, 0x800a, 0xd021, 0x8407, 0x880a, 0xc082 }, 16, 0x0008cee0, 1},
-	{{0xd023, 0x840b, 0xc084, 0x0000, 0x35bc, 0x800a, 0x38c8, 0x380c, 0xbfff, 0x30f9, 0x3fff, 0xbff7, 0x5190, 0xdc01, 0x9f70, 0x4090 }, 16, 0x0008cf00, 1},
-	{{0x2c10, 0x7651, 0x6c7c, 0x2500, 0x8140, 0x74d4, 0x6d7d, 0xb501, 0x2704, 0x8140, 0x4010, 0xe844, 0x92c8, 0x4018, 0x9f71, 0x3184 }, 16, 0x0008cf20, 1},
-	{{0x357c, 0x8008, 0x31e4, 0x3802, 0x8008, 0x3104, 0x2312, 0x8009, 0x3124, 0x3f30, 0x8009, 0x32c4, 0x399e, 0x8008, 0xe748, 0x33c4 }, 16, 0x0008cf40, 1},
-	{{0x3976, 0x8008, 0x0986, 0x3a58, 0x8009, 0x38c0, 0x3e5c, 0x8009, 0x1091, 0x8026, 0x3118, 0x80ff, 0x3c42, 0x09e6, 0x3dcc, 0x8009 }, 16, 0x0008cf60, 1},
-	{{0xca40, 0x90c0, 0xea18, 0x5092, 0x4091, 0x0a86, 0x3a58, 0x8009, 0x09e6, 0x3dcc, 0x8009, 0x1092, 0x8026, 0x30c8, 0x8208, 0xca40 }, 16, 0x0008cf80, 1},
-	{{0x90c0, 0xa0c2, 0xb049, 0x0886, 0x3a58, 0x8009, 0x90c0, 0x1090, 0x804e, 0x3118, 0x80ff, 0x8388, 0x7460, 0x08e6, 0x3dcc, 0x8009 }, 16, 0x0008cfa0, 1},
-	{{0x90c0, 0xb004, 0x0886, 0x3a58, 0x8009, 0x90c0, 0x1090, 0x804e, 0x30c8, 0x8208, 0x836a, 0x7460, 0x09e6, 0x3dcc, 0x8009, 0x38c0 }, 16, 0x0008cfc0, 1},
-	{{0x3e5c, 0x8009, 0xb00d, 0x0a86, 0x3a58, 0x8009, 0x09e6, 0x3dd0, 0x8009, 0x1092, 0x8024, 0x3118, 0x80ff, 0x7c42, 0xca40, 0x90c0 }, 16, 0x0008cfe0, 1},
-	{{0xea18, 0x5092, 0x4091, 0x0a86, 0x3a58, 0x8009, 0x09e6, 0x3dd0, 0x8009, 0x1092, 0x8024, 0x30c8, 0x8208, 0xca40, 0x90c0, 0xa0c2 }, 16, 0x0008d000, 1},
-	{{0xb049, 0x0886, 0x3a58, 0x8009, 0x90c0, 0x1090, 0x804c, 0x3118, 0x80ff, 0x830c, 0x7460, 0x08e6, 0x3dd0, 0x8009, 0x90c0, 0xb004 }, 16, 0x0008d020, 1},
-	{{0x0886, 0x3a58, 0x8009, 0x90c0, 0x1090, 0x804c, 0x30c8, 0x8208, 0x2aff, 0x9eef, 0x7460, 0x08e6, 0x3dd0, 0x8009, 0x90c0, 0xb005 }, 16, 0x0008d040, 1},
-	{{0x0986, 0x3a58, 0x8009, 0x0007, 0x3a98, 0x800a, 0x1891, 0x8100, 0x0d08, 0xa002, 0x8019, 0x2469, 0x0104, 0x386e, 0x800a, 0x840f }, 16, 0x0008d060, 1},
-	{{0x3224, 0x3f60, 0x8009, 0x1001, 0x8142, 0x8805, 0x6c10, 0x0000, 0x249a, 0x800a, 0x1101, 0x80b6, 0x2aff, 0x9e89, 0x38e0, 0x30a4 }, 16, 0x0008d080, 1},
-	{{0x8009, 0x0986, 0x3a58, 0x8009, 0x38e0, 0x3328, 0x8009, 0x2aff, 0x9e73, 0x1101, 0x80b6, 0x0986, 0x3a58, 0x8009, 0x38e0, 0x35ac }, 16, 0x0008d0a0, 1},
-	{{0x8009, 0x2aff, 0x9e5f, 0x1101, 0x80b6, 0x0986, 0x3a58, 0x8009, 0x38c0, 0x3e5c, 0x8009, 0x1091, 0x8028, 0x3118, 0x80ff, 0x3c42 }, 16, 0x0008d0c0, 1},
-	{{0x09e6, 0x3dc8, 0x8009, 0xca40, 0x90c0, 0xea18, 0x5092, 0x4091, 0x0a86, 0x3a58, 0x8009, 0x09e6, 0x3dc8, 0x8009, 0x1092, 0x8028 }, 16, 0x0008d0e0, 1},
-	{{0x30c8, 0x8208, 0xca40, 0x90c0, 0xa0c2, 0xb049, 0x0886, 0x3a58, 0x8009, 0x90c0, 0x1090, 0x8050, 0x3118, 0x80ff, 0x2aff, 0x9e23 }, 16, 0x0008d100, 1},
-	{{0x7460, 0x08e6, 0x3dc8, 0x8009, 0x90c0, 0xb004, 0x0886, 0x3a58, 0x8009, 0x90c0, 0x1090, 0x8050, 0x30c8, 0x8208, 0x2aff, 0x9e03 }, 16, 0x0008d120, 1},
-	{{0x7460, 0x09e6, 0x3dc8, 0x8009, 0x38c0, 0x3e5c, 0x8009, 0xb00d, 0x0a86, 0x3a58, 0x8009, 0x09e6, 0x3dd4, 0x8009, 0x1092, 0x802a }, 16, 0x0008d140, 1},
-	{{0x3118, 0x80ff, 0x7c42, 0xca40, 0x90c0, 0xea18, 0x5092, 0x4091, 0x0a86, 0x3a58, 0x8009, 0x09e6, 0x3dd4, 0x8009, 0x1092, 0x802a }, 16, 0x0008d160, 1},
-	{{0x30c8, 0x8208, 0xca40, 0x90c0, 0xa0c2, 0xb049, 0x0886, 0x3a58, 0x8009, 0x90c0, 0x1090, 0x8052, 0x3118, 0x80ff, 0x2aff, 0x9da3 }, 16, 0x0008d180, 1},
-	{{0x7460, 0x08e6, 0x3dd4, 0x8009, 0x90c0, 0xb004, 0x0886, 0x3a58, 0x8009, 0x90c0, 0x1090, 0x8052, 0x30c8, 0x8208, 0x2aff, 0x9d83 }, 16, 0x0008d1a0, 1},
-	{{0x7460, 0x09e6, 0x3dd4, 0x8009, 0x38e0, 0x3bb8, 0x8009, 0x2aff, 0x9d77, 0xb00d, 0x2aff, 0x9d71, 0x38e0, 0x3830, 0x8009, 0x2aff }, 16, 0x0008d1c0, 1},
-	{{0x9d67, 0x38e0, 0x39f4, 0x8009, 0x0986, 0x3a58, 0x8009, 0x38e0, 0x3bb8, 0x8009, 0x2909, 0x8344, 0x290a, 0x825c, 0x2aff, 0x9d4f }, 16, 0x0008d1e0, 1},
-	{{0xfa41, 0x0986, 0x3a58, 0x8009, 0x38e0, 0x3830, 0x8009, 0x2909, 0x8344, 0x290a, 0x825c, 0x2aff, 0x9d35, 0xfa41, 0x0986, 0x3a58 }, 16, 0x0008d200, 1},
-	{{0x8009, 0x38e0, 0x39f4, 0x8009, 0x2909, 0x8344, 0x290a, 0x825c, 0x2aff, 0x9d1b, 0xfa41, 0x2c10, 0x0886, 0x3a58, 0x8009, 0xf042 }, 16, 0x0008d220, 1},
-	{{0x2809, 0x8420, 0x2908, 0x8050, 0xf841, 0x3204, 0x26f8, 0x8009, 0x38e0, 0x2bb8, 0x8009, 0xe768, 0x9f71, 0x1010, 0x1290, 0x8002 }, 16, 0x0008d240, 1},
-	{{0x6569, 0x8039, 0x3170, 0xf185, 0x94c7, 0x64ea, 0x6c10, 0x842b, 0x9b41, 0x2b03, 0x8008, 0x280a, 0x8004, 0x3841, 0x1111, 0xcb40 }, 16, 0x0008d260, 1},
-	{{0x90c0, 0xebfc, 0xeb1a, 0x1113, 0x4113, 0x4119, 0x94d0, 0x1190, 0x8002, 0x70f0, 0x92c3, 0x6c10, 0x4010, 0x9f71, 0x2bff, 0x9cb5 }, 16, 0x0008d280, 1},
-	{{0x2e90, 0x38e0, 0x3dbc, 0x8009, 0x0e86, 0x3a58, 0x8009, 0x2700, 0x80a3, 0x2b02, 0x8025, 0x2a02, 0x804a, 0x2600, 0x9900, 0xc383 }, 16, 0x0008d2a0, 1},
-	{{0x3900, 0x3650, 0x800a, 0x3a00, 0x364e, 0x800a, 0x3b00, 0x364c, 0x800a, 0x3c00, 0x3654, 0x800a, 0x3d00, 0x3658, 0x800a, 0x2c10 }, 16, 0x0008d2c0, 1},
-	{{0x1f98, 0x1106, 0x8142, 0x64ea, 0x8413, 0x9b41, 0x2b03, 0x8006, 0x90c0, 0x92d0, 0x519f, 0x64e6, 0x6c51, 0x1495, 0x40bd, 0x2e20 }, 16, 0x0008d2e0, 1},
-	{{0x1094, 0x3160, 0x2666, 0x8066, 0x3224, 0x3f00, 0x8009, 0x6666, 0x3650, 0x7454, 0x3224, 0x3f00, 0x8009, 0x3180, 0x3999, 0x8019 }, 16, 0x0008d300, 1},
-	{{0x2461, 0x6661, 0x6c40, 0x40bc, 0x5133, 0x1112, 0xd0a1, 0x843f, 0x64e9, 0x843b, 0x3610, 0x8063, 0x8011, 0x2040, 0x8000, 0x4011 }, 16, 0x0008d320, 1},
-	{{0x2000, 0x8640, 0x8828, 0x4012, 0x3610, 0x812b, 0x800f, 0x2020, 0x8000, 0x4011, 0x8ff0, 0x2000, 0x8c80, 0x3610, 0x81f3, 0x800b }, 16, 0x0008d340, 1},
-	{{0x2000, 0x8666, 0x8806, 0x4011, 0x4711, 0x4612, 0xbfb2, 0x1112, 0xcf48, 0x7c41, 0x3071, 0x6c11, 0x8406, 0x4012, 0x4512, 0x79e1 }, 16, 0x0008d360, 1},
-	{{0x65ea, 0x2909, 0x8094, 0x8158, 0x2a0a, 0x8094, 0x3124, 0x3f50, 0x8009, 0xe750, 0xf3ca, 0xf0c9, 0xf1c8, 0xf2c7, 0xf344, 0xf043 }, 16, 0x0008d380, 1},
-	{{0xf142, 0x3284, 0x362c, 0x8008, 0xf241, 0xe770, 0x9f71, 0x31e4, 0x203c, 0x8008, 0x3164, 0x396a, 0x8008, 0x31e4, 0x3896, 0x8008 }, 16, 0x0008d3a0, 1},
-	{{0x2bff, 0x9b91, 0x2708, 0x8020, 0xe7e8, 0x32c4, 0x39c2, 0x8008, 0x0604, 0x386e, 0x800a, 0x0886, 0x3a58, 0x8009, 0x90c0, 0x1090 }, 16, 0x0008d3c0, 1},
-	{{0x804e, 0x3118, 0x80ff, 0x2aff, 0x9b59, 0x7460, 0x08e6, 0x3dcc, 0x8009, 0x90c0, 0xb004, 0x0886, 0x3a58, 0x8009, 0x90c0, 0x1090 }, 16, 0x0008d3e0, 1},
-	{{0x804e, 0x30c8, 0x8208, 0x2aff, 0x9b39, 0x7460, 0x08e6, 0x3dcc, 0x8009, 0x90c0, 0xb005, 0x0886, 0x3a58, 0x8009, 0x90c0, 0x1090 }, 16, 0x0008d400, 1},
-	{{0x804c, 0x3118, 0x80ff, 0x2aff, 0x9b19, 0x7460, 0x08e6, 0x3dd0, 0x8009, 0x90c0, 0xb004, 0x0886, 0x3a58, 0x8009, 0x90c0, 0x1090 }, 16, 0x0008d420, 1},
-	{{0x804c, 0x30c8, 0x8208, 0x2aff, 0x9af9, 0x7460, 0x08e6, 0x3dd0, 0x8009, 0x90c0, 0xb005, 0x0886, 0x3a58, 0x8009, 0x90c0, 0x1090 }, 16, 0x0008d440, 1},
-	{{0x8050, 0x3118, 0x80ff, 0x2aff, 0x9ad9, 0x7460, 0x08e6, 0x3dc8, 0x8009, 0x90c0, 0xb004, 0x0886, 0x3a58, 0x8009, 0x90c0, 0x1090 }, 16, 0x0008d460, 1},
-	{{0x8050, 0x30c8, 0x8208, 0x2aff, 0x9ab9, 0x7460, 0x08e6, 0x3dc8, 0x8009, 0x90c0, 0xb005, 0x0886, 0x3a58, 0x8009, 0x90c0, 0x1090 }, 16, 0x0008d480, 1},
-	{{0x8052, 0x3118, 0x80ff, 0x2aff, 0x9a99, 0x7460, 0x08e6, 0x3dd4, 0x8009, 0x90c0, 0xb004, 0x0886, 0x3a58, 0x8009, 0x90c0, 0x1090 }, 16, 0x0008d4a0, 1},
-	{{0x8052, 0x30c8, 0x8208, 0x2aff, 0x9a79, 0x7460, 0x08e6, 0x3dd4, 0x8009, 0x90c0, 0xb005, 0x0104, 0x249a, 0x800a, 0x24ea, 0x38e1 }, 16, 0x0008d4c0, 1},
-	{{0x00c6, 0x3e5c, 0x8009, 0x8421, 0x08e6, 0x3dd0, 0x8009, 0x0100, 0x249a, 0x800a, 0x4090, 0x08e6, 0x3dd0, 0x8009, 0x00c6, 0x3e5c }, 16, 0x0008d4e0, 1},
-	{{0x8009, 0x8846, 0xb041, 0x0986, 0x3a58, 0x8009, 0x38c0, 0x3e5c, 0x8009, 0x1091, 0x8024, 0x3118, 0x80ff, 0x3c42, 0x09e6, 0x3dd0 }, 16, 0x0008d500, 1},
-	{{0x8009, 0xca40, 0x90c0, 0xea18, 0x5092, 0x4091, 0x0a86, 0x3a58, 0x8009, 0x09e6, 0x3dd0, 0x8009, 0x1092, 0x8024, 0x30c8, 0x8208 }, 16, 0x0008d520, 1},
-	{{0xca40, 0x90c0, 0xa0c2, 0xb049, 0x00c4, 0x3316, 0x8009, 0xd021, 0x8045, 0x08e6, 0x3dcc, 0x8009, 0x0204, 0x386e, 0x800a, 0x1990 }, 16, 0x0008d540, 1},
-	{{0xf206, 0xb384, 0xb0c1, 0xb185, 0xf105, 0xf042, 0xf301, 0x1807, 0xa001, 0xc6a0, 0x2aff, 0x9e3b, 0x38c0, 0x34e8, 0x8009, 0x1801 }, 16, 0x0008d560, 1},
-	{{0xa020, 0x39c0, 0x34e8, 0x8009, 0x2aff, 0x9e2d, 0x38c0, 0x3304, 0x8009, 0x882d, 0x08e6, 0x3dcc, 0x8009, 0x0204, 0x386e, 0x800a }, 16, 0x0008d580, 1},
-	{{0x1990, 0xf206, 0xb185, 0xb384, 0xb0c1, 0xf105, 0xf042, 0xf301, 0x1807, 0xa001, 0x2aff, 0x9dfb, 0x3800, 0x20d8, 0x800a, 0xc846 }, 16, 0x0008d5a0, 1},
-	{{0x00c4, 0x32a6, 0x8009, 0xe8fc, 0xd021, 0x0800, 0x3ef2, 0x800a, 0x8046, 0x0600, 0x3eec, 0x800a, 0x08e6, 0x3dd0, 0x8009, 0x0204 }, 16, 0x0008d5c0, 1},
-	{{0x386e, 0x800a, 0x1990, 0xf206, 0xb185, 0xb384, 0xb0c1, 0xf105, 0xf042, 0xf301, 0x1807, 0xa001, 0x2aff, 0x9db7, 0x38c0, 0x34e8 }, 16, 0x0008d5e0, 1},
-	{{0x8009, 0xf601, 0x39c0, 0x34e8, 0x8009, 0x2aff, 0x9dab, 0x38c0, 0x3294, 0x8009, 0x882d, 0x08e6, 0x3dd0, 0x8009, 0x0204, 0x386e }, 16, 0x0008d600, 1},
-	{{0x800a, 0x1990, 0xf206, 0xb185, 0xb384, 0xb0c1, 0xf105, 0xf042, 0xf301, 0x1807, 0xa001, 0x2aff, 0x9d79, 0x38e0, 0x3dd8, 0x8009 }, 16, 0x0008d620, 1},
-	{{0x00c4, 0x3252, 0x8009, 0xd021, 0x8041, 0x08e6, 0x3dc8, 0x8009, 0x0204, 0x386e, 0x800a, 0x1990, 0xf206, 0xb185, 0xb384, 0xb0c1 }, 16, 0x0008d640, 1},
-	{{0xf105, 0xf042, 0xf301, 0x1807, 0xa001, 0x2aff, 0x9d45, 0x38c0, 0x34e8, 0x8009, 0xf601, 0x39c0, 0x34e8, 0x8009, 0x2aff, 0x9d39 }, 16, 0x0008d660, 1},
-	{{0x38c0, 0x3240, 0x8009, 0x882d, 0x08e6, 0x3dc8, 0x8009, 0x0204, 0x386e, 0x800a, 0x1990, 0xf206, 0xb185, 0xb384, 0xb0c1, 0xf105 }, 16, 0x0008d680, 1},
-	{{0xf042, 0xf301, 0x1807, 0xa001, 0x2aff, 0x9d07, 0x3800, 0x2018, 0x800a, 0x00c4, 0x3412, 0x8009, 0xd021, 0x8041, 0x08e6, 0x3dd4 }, 16, 0x0008d6a0, 1},
-	{{0x8009, 0x0204, 0x386e, 0x800a, 0x1990, 0xf206, 0xb185, 0xb384, 0xb0c1, 0xf105, 0xf042, 0xf301, 0x1807, 0xa001, 0x2aff, 0x9cd3 }, 16, 0x0008d6c0, 1},
-	{{0x38c0, 0x34e8, 0x8009, 0xf601, 0x39c0, 0x34e8, 0x8009, 0x2aff, 0x9cc7, 0x38c0, 0x3400, 0x8009, 0x882d, 0x08e6, 0x3dd4, 0x8009 }, 16, 0x0008d6e0, 1},
-	{{0x0204, 0x386e, 0x800a, 0x1990, 0xf206, 0xb185, 0xb384, 0xb0c1, 0xf105, 0xf042, 0xf301, 0x1807, 0xa001, 0x2aff, 0x9c95, 0x38e0 }, 16, 0x0008d700, 1},
-	{{0x3e98, 0x8009, 0x3304, 0x39f2, 0x8009, 0x3304, 0x3a22, 0x8009, 0x3304, 0x3a52, 0x8009, 0x0886, 0x3a58, 0x8009, 0x39e0, 0x3dd8 }, 16, 0x0008d720, 1},
-	{{0x8009, 0x1890, 0x8100, 0x0d08, 0xa002, 0x8033, 0xf641, 0x2aff, 0x9c6d, 0x38e0, 0x3bb8, 0x8009, 0xf641, 0x3900, 0x2018, 0x800a }, 16, 0x0008d740, 1},
-	{{0x2aff, 0x9c5b, 0x38e0, 0x3830, 0x8009, 0xf641, 0x39e0, 0x3e98, 0x8009, 0x2aff, 0x9c49, 0x38e0, 0x39f4, 0x8009, 0x276a, 0x3900 }, 16, 0x0008d760, 1},
-	{{0x2258, 0x800a, 0x8413, 0x9f46, 0x38e0, 0x3f58, 0x8009, 0x90c0, 0x92d0, 0x5018, 0x4019, 0xf601, 0x39e0, 0x3dd8, 0x8009, 0x2aff }, 16, 0x0008d780, 1},
-	{{0x9abd, 0x38e0, 0x30a4, 0x8009, 0xf601, 0x3900, 0x2018, 0x800a, 0x2aff, 0x9aab, 0x38e0, 0x3328, 0x8009, 0xf601, 0x39e0, 0x3e98 }, 16, 0x0008d7a0, 1},
-	{{0x8009, 0x2aff, 0x9a99, 0x38e0, 0x35ac, 0x8009, 0x2bff, 0x9ad1, 0x276a, 0x37d6, 0x3d00, 0x2318, 0x800a, 0x8461, 0x3a00, 0x2258 }, 16, 0x0008d7c0, 1},
-	{{0x800a, 0x3be0, 0x3e98, 0x8009, 0x3e00, 0x2018, 0x800a, 0x3fe0, 0x3dd8, 0x8009, 0x3c00, 0x20d8, 0x800a, 0x0006, 0x3864, 0x800a }, 16, 0x0008d7e0, 1},
-	{{0x3841, 0xfd44, 0xfa43, 0xfb42, 0xfe41, 0xe9ef, 0xe8ec, 0xfd45, 0xfa46, 0xfb47, 0xfc48, 0x2aff, 0x9b7d, 0x0002, 0x3864, 0x800a }, 16, 0x0008d800, 1},
-	{{0x3be1, 0xfdc5, 0x27ea, 0xfac6, 0xfbc7, 0xfcc8, 0xef42, 0xec42, 0xee42, 0xeb42, 0xea42, 0x81c4, 0xed42, 0x0886, 0x3a58, 0x8009 }, 16, 0x0008d820, 1},
-	{{0x90c0, 0x1090, 0x8100, 0x3118, 0x8002, 0x6469, 0x802b, 0x276a, 0x3b00, 0x2258, 0x800a, 0x8421, 0x9f46, 0x3800, 0x20d8, 0x800a }, 16, 0x0008d840, 1},
-	{{0x3ae0, 0x3dd8, 0x8009, 0x3900, 0x2318, 0x800a, 0x94d0, 0x521a, 0x5118, 0x0219, 0x411b, 0x2469, 0x3001, 0x2258, 0x800a, 0x844d }, 16, 0x0008d860, 1},
-	{{0xf642, 0xf041, 0xc940, 0x3204, 0x2ac6, 0x8009, 0x38e0, 0x3dac, 0x8009, 0x3001, 0x2318, 0x800a, 0xf642, 0xf041, 0xc940, 0x3204 }, 16, 0x0008d880, 1},
-	{{0x2af0, 0x8009, 0x38e0, 0x2bb8, 0x8009, 0x3304, 0x3a82, 0x8009, 0x276a, 0x39e0, 0x3f58, 0x8009, 0x8413, 0x9f46, 0x3800, 0x2258 }, 16, 0x0008d8a0, 1},
-	{{0x800a, 0x90c0, 0x92d0, 0x5018, 0x4019, 0x00c4, 0x33da, 0x8009, 0xd021, 0x8019, 0xf601, 0x3900, 0x2318, 0x800a, 0x3264, 0x3a12 }, 16, 0x0008d8c0, 1},
-	{{0x8008, 0x38c0, 0x33c8, 0x8009, 0x8823, 0x0004, 0x386e, 0x800a, 0x246a, 0x3a00, 0x23d8, 0x800a, 0x8413, 0x9f40, 0x3800, 0x2318 }, 16, 0x0008d8e0, 1},
-	{{0x800a, 0x90c0, 0x92d0, 0x5918, 0x491a, 0x00c4, 0x3386, 0x8009, 0xd021, 0x8019, 0xf601, 0x3900, 0x2258, 0x800a, 0x3264, 0x3a12 }, 16, 0x0008d900, 1},
-	{{0x8008, 0x38c0, 0x3374, 0x8009, 0x8823, 0x0004, 0x386e, 0x800a, 0x246a, 0x3900, 0x2198, 0x800a, 0x8413, 0x9f40, 0x3800, 0x2258 }, 16, 0x0008d920, 1},
-	{{0x800a, 0x90c0, 0x92d0, 0x5018, 0x4019, 0x33c4, 0x3a3a, 0x8008, 0x3304, 0x36bc, 0x8009, 0x3304, 0x389e, 0x8009, 0x27e8, 0x9fe0 }, 16, 0x0008d940, 1},
-	{{0x3024, 0x3f50, 0x8009, 0xe7e8, 0x3384, 0x3f90, 0x8008, 0x9f70, 0x0802, 0x3868, 0x800a, 0x0986, 0x3a58, 0x8009, 0x32c4, 0x286c }, 16, 0x0008d960, 1},
-	{{0x8008, 0x3800, 0x249c, 0x800a, 0x83e1, 0x3084, 0x35a2, 0x8008, 0x3800, 0x35c0, 0x800a, 0x3800, 0x3868, 0x800a, 0x9f71, 0x0004 }, 16, 0x0008d980, 1},
-	{{0x3870, 0x800a, 0x0886, 0x3a58, 0x8009, 0xd028, 0x840c, 0x1100, 0x81c0, 0xc0fe, 0x8808, 0xdc01, 0xc081, 0xdc19, 0x9f70, 0x0000 }, 16, 0x0008d9a0, 1},
-	{{0x81c0, 0x0886, 0x3a58, 0x8009, 0xc0fe, 0x1290, 0x8100, 0xdc02, 0x0000, 0x8100, 0x0886, 0x3a58, 0x8009, 0xc1f7, 0x1090, 0x8102 }, 16, 0x0008d9c0, 1},
-	{{0xdc80, 0x0100, 0x8102, 0x0a86, 0x3a58, 0x8009, 0x90c0, 0x1892, 0x810e, 0x0800, 0x35ce, 0x800a, 0x1092, 0x810c, 0x0000, 0x35cc }, 16, 0x0008d9e0, 1},
-	{{0x800a, 0x1002, 0x810a, 0x0000, 0x3856, 0x800a, 0x1002, 0x812e, 0x0000, 0x36c2, 0x800a, 0x0000, 0x3756, 0x800a, 0x0000, 0x362e }, 16, 0x0008da00, 1},
-	{{0x800a, 0x1092, 0x8130, 0x00e0, 0x20f4, 0x8009, 0x00e0, 0x20c0, 0x8009, 0x9f70, 0x00e0, 0x208c, 0x8009, 0x3800, 0x2068, 0x8008 }, 16, 0x0008da20, 1},
-	{{0x0106, 0x35c4, 0x800a, 0x3900, 0x206a, 0x8008, 0x33f8, 0x9fff, 0x0010, 0x3800, 0x206c, 0x8008, 0x32c9, 0x8410, 0x0111, 0x3900 }, 16, 0x0008da40, 1},
-	{{0x206e, 0x8008, 0x00e7, 0x2050, 0x8009, 0x0010, 0x3800, 0x2072, 0x8008, 0x0a04, 0x3618, 0x800a, 0x0a11, 0x3900, 0x2074, 0x8008 }, 16, 0x0008da60, 1},
-	{{0x0a04, 0x3636, 0x800a, 0x0a10, 0x3800, 0x207c, 0x8008, 0x0a04, 0x3638, 0x800a, 0x0a11, 0x3900, 0x2078, 0x8008, 0x0a04, 0x385e }, 16, 0x0008da80, 1},
-	{{0x800a, 0x0a10, 0x3800, 0x2076, 0x8008, 0x0a04, 0x385c, 0x800a, 0x0a11, 0x3900, 0x2088, 0x8008, 0x0a04, 0x3860, 0x800a, 0x0a10 }, 16, 0x0008daa0, 1},
-	{{0x3800, 0x208a, 0x8008, 0x0a04, 0x3636, 0x800a, 0x0a11, 0x3900, 0x208c, 0x8008, 0x0a04, 0x36ca, 0x800a, 0x0a10, 0x3800, 0x2080 }, 16, 0x0008dac0, 1},
-	{{0x8008, 0x0a04, 0x375e, 0x800a, 0x0a11, 0x3900, 0x2082, 0x8008, 0x0a04, 0x3638, 0x800a, 0x0a10, 0x3800, 0x2084, 0x8008, 0x0a04 }, 16, 0x0008dae0, 1},
-	{{0x36cc, 0x800a, 0x0a11, 0x3900, 0x2090, 0x8008, 0x0a04, 0x3760, 0x800a, 0x0a10, 0x3800, 0x2092, 0x8008, 0x0a04, 0x3618, 0x800a }, 16, 0x0008db00, 1},
-	{{0x0a11, 0x3900, 0x2094, 0x8008, 0x0a04, 0x36ac, 0x800a, 0x4a10, 0x0804, 0x3740, 0x800a, 0x9f70, 0x4811, 0x31a4, 0x35c0, 0x8008 }, 16, 0x0008db20, 1},
-	{{0x3324, 0x3f30, 0x8009, 0x24e8, 0x36d0, 0x3751, 0xce40, 0x94c3, 0x66e4, 0x6764, 0x94c7, 0x6769, 0xce45, 0x2418, 0x8182, 0x94c6 }, 16, 0x0008db40, 1},
-	{{0xce4d, 0x6c10, 0x66ea, 0x2618, 0x8176, 0x92c3, 0x6c10, 0x83cc, 0x7456, 0x35d0, 0xce4d, 0x3de3, 0x7455, 0x79ee, 0x6f90, 0x83bc }, 16, 0x0008db60, 1},
-	{{0x6f7c, 0x3c63, 0x2e10, 0xd71f, 0x386e, 0x34f6, 0xce4d, 0x2c7c, 0xc281, 0xd69c, 0x2b25, 0xd7c4, 0x2766, 0xce45, 0x2e7c, 0xcf44 }, 16, 0x0008db80, 1},
-	{{0x839a, 0x7456, 0x3c63, 0x2e10, 0x2e90, 0x3840, 0x3f14, 0x8009, 0x7863, 0x34d0, 0x786b, 0x2c7c, 0x6d7c, 0x2c95, 0xd7c4, 0xd71c }, 16, 0x0008dba0, 1},
-	{{0x3556, 0x0c07, 0xa001, 0x94c1, 0x7be1, 0x6c10, 0xd519, 0x94c7, 0x7961, 0xc081, 0x3d41, 0x3447, 0xcc50, 0x3476, 0xcd50, 0xc942 }, 16, 0x0008dbc0, 1},
-	{{0xd810, 0xe918, 0x5211, 0x69bc, 0x7def, 0x3403, 0x8003, 0x25e6, 0x3081, 0x2000, 0x8000, 0x3478, 0xd599, 0x71f0, 0x800b, 0x6db3 }, 16, 0x0008dbe0, 1},
-	{{0x6a3d, 0x880c, 0x6666, 0x6db3, 0x6a3d, 0x6666, 0x6664, 0x35f6, 0xd640, 0x7e70, 0x6e48, 0x77f4, 0x6b37, 0x7f6f, 0x34c5, 0x8003 }, 16, 0x0008dc00, 1},
-	{{0x30c5, 0x8003, 0x36c2, 0x8003, 0xd995, 0xd5c2, 0x65e1, 0x65e6, 0xd599, 0x71f0, 0x800d, 0x6db3, 0x75f3, 0x69ac, 0x880e, 0x65e6 }, 16, 0x0008dc20, 1},
-	{{0x6db3, 0x75f3, 0x69ac, 0x65e6, 0x65e4, 0xd5c0, 0x3df0, 0xcf4a, 0xd643, 0xc38f, 0x2f9d, 0xf08d, 0x2f83, 0x0c01, 0xa001, 0xcc58 }, 16, 0x0008dc40, 1},
-	{{0x94c3, 0x7841, 0x78e1, 0x92c3, 0xcc50, 0xcc58, 0x0c00, 0xa001, 0x8013, 0x7474, 0x3e50, 0x9a82, 0x6466, 0x3144, 0x8000, 0x880c }, 16, 0x0008dc60, 1},
-	{{0x7e6f, 0x36c0, 0xcd58, 0xd445, 0xcd50, 0x27e8, 0x34c1, 0xce4d, 0x802d, 0xcd58, 0x2f43, 0x7475, 0x2768, 0x6820, 0x8014, 0x6466 }, 16, 0x0008dc80, 1},
-	{{0xd741, 0x6768, 0x8009, 0x6764, 0x8832, 0xd416, 0x882e, 0xd41e, 0x31f6, 0xd41e, 0x92c3, 0x7c6f, 0x8822, 0xd419, 0xcd58, 0x2db3 }, 16, 0x0008dca0, 1},
-	{{0xce4d, 0x3475, 0x65e8, 0x6820, 0x6466, 0xd41f, 0xd419, 0xcd59, 0x840a, 0x92c3, 0xd419, 0xd41b, 0x7c6f, 0x6461, 0x3124, 0x3f50 }, 16, 0x0008dcc0, 1},
-	{{0x8009, 0x3164, 0x2c88, 0x8008, 0x3184, 0x357c, 0x8008, 0x3324, 0x3f30, 0x8009, 0x2c10, 0xeee8, 0x0096, 0xefe9, 0x50d7, 0x30c9 }, 16, 0x0008dce0, 1},
-	{{0x804f, 0xb135, 0x83de, 0x3178, 0x9fff, 0xb071, 0xb0b9, 0x83da, 0x7460, 0x6c90, 0xb034, 0xb173, 0x1097, 0x8004, 0x30c9, 0x804f }, 16, 0x0008dd00, 1},
-	{{0x0106, 0x8016, 0x83be, 0x3178, 0x9fff, 0xb074, 0xb0bb, 0x83ba, 0x7460, 0x3024, 0x3f50, 0x8009, 0x0006, 0x8014, 0xc840, 0x3410 }, 16, 0x0008dd20, 1},
-	{{0x8030, 0xe8fc, 0x802e, 0x0800, 0x3a34, 0x800a, 0x3410, 0x8020, 0x801b, 0xd038, 0x800f, 0xd030, 0x8423, 0x8388, 0x2000, 0x9c20 }, 16, 0x0008dd40, 1},
-	{{0x8821, 0x8380, 0x2020, 0x8bc0, 0x8819, 0x8378, 0x2020, 0x99d0, 0x8811, 0x8370, 0x2040, 0x8e20, 0x8809, 0x8368, 0x2000, 0x8d48 }, 16, 0x0008dd60, 1},
-	{{0x0986, 0x3a58, 0x8009, 0x3800, 0x3874, 0x800a, 0x2909, 0x80b8, 0x835e, 0x0002, 0x3a24, 0x800a, 0x0986, 0x3a58, 0x8009, 0x3800 }, 16, 0x0008dd80, 1},
-	{{0x394c, 0x800a, 0x834a, 0x2909, 0x80c0, 0x2aff, 0x9f39, 0x2000, 0x8064, 0x0002, 0x3a2c, 0x800a, 0x2aff, 0x9f2b, 0x2000, 0x83e8 }, 16, 0x0008dda0, 1},
-	{{0x0106, 0x3a2c, 0x800a, 0x2cd1, 0x0006, 0x3a24, 0x800a, 0x3071, 0x30e8, 0x3fff, 0xbfff, 0x8009, 0x0002, 0x3a24, 0x800a, 0x9f71 }, 16, 0x0008ddc0, 1},
-	{{0x3324, 0x3f30, 0x8009, 0xeee9, 0x1016, 0xefe8, 0x2468, 0xc0fe, 0x800c, 0xb1bd, 0x0901, 0xa001, 0x8810, 0xb13d, 0xdc01, 0xb03d }, 16, 0x0008dde0, 1},
-	{{0x2aff, 0x9ee3, 0x5016, 0xb079, 0xb0b1, 0x2aff, 0x9edf, 0x7460, 0xb03c, 0xb0b2, 0x6468, 0x8011, 0x1007, 0x8016, 0x0900, 0xa001 }, 16, 0x0008de00, 1},
-	{{0x881a, 0x0007, 0x8016, 0xc0fe, 0x1107, 0x8016, 0xdc01, 0x0007, 0x8016, 0x2aff, 0x9eb1, 0xb0b2, 0xb07c, 0xb0b3, 0x2aff, 0x9ead }, 16, 0x0008de20, 1},
-	{{0x7460, 0x3024, 0x3f50, 0x8009, 0x0007, 0x8014, 0xe748, 0x0904, 0x3a32, 0x800a, 0xf904, 0x0803, 0x3a30, 0x800a, 0x2361, 0x9541 }, 16, 0x0008de40, 1},
-	{{0x04fc, 0x9ff8, 0x21ac, 0x0804, 0x3a2a, 0x800a, 0xd818, 0x2c53, 0xf803, 0x0a03, 0x3a28, 0x800a, 0x04fc, 0x9ffa, 0x23e1, 0x83af }, 16, 0x0008de60, 1},
-	{{0x21ac, 0xd91a, 0x2d5d, 0x0002, 0x3a30, 0x800a, 0x2c52, 0x0903, 0x3a24, 0x800a, 0x2174, 0x0202, 0x3a28, 0x800a, 0x2d74, 0xe768 }, 16, 0x0008de80, 1},
-	{{0x9f70, 0x7452, 0x3164, 0x2ce4, 0x8008, 0x3324, 0x3f30, 0x8009, 0x0986, 0x3a58, 0x8009, 0xe750, 0x2909, 0x80b8, 0x8324, 0x3800 }, 16, 0x0008dea0, 1},
-	{{0x3874, 0x800a, 0x0986, 0x3a58, 0x8009, 0x3800, 0x394c, 0x800a, 0x8310, 0x2909, 0x80c0, 0x2c90, 0x0004, 0x3a34, 0x800a, 0x246a }, 16, 0x0008dec0, 1},
-	{{0xcf41, 0x0104, 0x388a, 0x800a, 0x0204, 0x387e, 0x800a, 0x351e, 0x8001, 0x8498, 0x331f, 0x8001, 0x3e00, 0x388c, 0x800a, 0x0b03 }, 16, 0x0008dee0, 1},
-	{{0x387c, 0x800a, 0xf341, 0x839e, 0x0006, 0x3874, 0x800a, 0x3550, 0x0006, 0x3874, 0x800a, 0x0106, 0x3878, 0x800a, 0xd441, 0x0903 }, 16, 0x0008df00, 1},
-	{{0x3888, 0x800a, 0xf242, 0xf143, 0x0002, 0x3874, 0x800a, 0x8376, 0x0006, 0x3880, 0x800a, 0x2769, 0xd810, 0xf1c3, 0x2031, 0xf2c2 }, 16, 0x0008df20, 1},
-	{{0xd912, 0x31e8, 0x9fff, 0xf3c1, 0x201d, 0x0106, 0x3880, 0x800a, 0x0206, 0x3884, 0x800a, 0xd541, 0x0202, 0x3880, 0x800a, 0x800e }, 16, 0x0008df40, 1},
-	{{0x405e, 0x2bff, 0x9eeb, 0x0002, 0x3878, 0x800a, 0x67e9, 0x800d, 0x2bff, 0x9edd, 0x0002, 0x3884, 0x800a, 0xcf49, 0x38c1, 0x0004 }, 16, 0x0008df60, 1},
-	{{0x3a34, 0x800a, 0x3071, 0xcf41, 0x8177, 0x246a, 0x2f10, 0x3e00, 0x3964, 0x800a, 0x846d, 0x0f03, 0x3954, 0x800a, 0x8308, 0x0006 }, 16, 0x0008df80, 1},
-	{{0x394c, 0x800a, 0x3550, 0x0006, 0x394c, 0x800a, 0x0106, 0x3950, 0x800a, 0xd441, 0x0903, 0x3960, 0x800a, 0xf141, 0x0002, 0x394c }, 16, 0x0008dfa0, 1},
-	{{0x800a, 0xcf42, 0x2aff, 0x9ee1, 0x0006, 0x3958, 0x800a, 0x3b41, 0xd810, 0xf1c1, 0x2031, 0xcf4a, 0x31e8, 0x9fff, 0xd912, 0x200b }, 16, 0x0008dfc0, 1},
-	{{0x0106, 0x3958, 0x800a, 0x0206, 0x395c, 0x800a, 0xd541, 0x0202, 0x3958, 0x800a, 0x005e, 0x0004, 0x3a34, 0x800a, 0x7076, 0x8199 }, 16, 0x0008dfe0, 1},
-	{{0x3024, 0x3f50, 0x8009, 0xe770, 0x90c0, 0x90c0, 0x90c0, 0x90c0, 0xe8e7, 0xc848, 0x90c0, 0x9f71, 0x96c0, 0xf485, 0x10fc, 0x9ff4 }, 16, 0x0008e000, 1},
-	{{0x666a, 0x2718, 0x8018, 0x2803, 0x800a, 0x9844, 0x90c0, 0x5159, 0x92d0, 0x6174, 0x2565, 0x5159, 0x4258, 0x9f71, 0x96c0, 0xf48a }, 16, 0x0008e020, 1},
-	{{0x10fc, 0x9ff6, 0x266a, 0x12fc, 0x9fee, 0x2718, 0x802c, 0x9822, 0x96c0, 0xfbc6, 0x187a, 0x9fe2, 0x96c0, 0x9844, 0x2803, 0x800c }, 16, 0x0008e040, 1},
-	{{0x5161, 0x5363, 0x2274, 0x22f5, 0x5161, 0x94d0, 0x6e55, 0x5363, 0x6665, 0x4458, 0x9823, 0x9f71, 0xc088, 0x33e4, 0x3bd0, 0x8001 }, 16, 0x0008e060, 1},
-	{{0x3104, 0x2100, 0x8000, 0x98c0, 0x3928, 0x2000, 0xbfff, 0xc188, 0x94c0, 0xc280, 0xda11, 0x0299, 0x35d4, 0x7e48, 0x4299, 0x4299 }, 16, 0x0008e080, 1},
-	{{0x4499, 0x4199, 0x4299, 0x4299, 0x4299, 0x4299, 0x4299, 0x4299, 0x4299, 0x4299, 0x4299, 0x4299, 0x4291, 0x39e0, 0x3600, 0x800d }, 16, 0x0008e0a0, 1},
-	{{0x90c0, 0xe7e9, 0xebe9, 0x90c0, 0x90c0, 0x3ae0, 0x2078, 0x8008, 0x270c, 0x8018, 0xe7ec, 0xc31a, 0xc219, 0xc31a, 0xc219, 0x4b91 }, 16, 0x0008e0c0, 1},
-	{{0x3800, 0x2034, 0x8008, 0x90c0, 0x4010, 0x3000, 0x2002, 0x8000, 0x31e4, 0x3bd0, 0x8001, 0x1005, 0xa004, 0x3860, 0x3fc0, 0x8004 }, 16, 0x0008e0e0, 1},
-	{{0x2341, 0x8000, 0x3c00, 0xa008, 0x74d0, 0x6cd3, 0x6466, 0x2481, 0x8000, 0x3c00, 0xa805, 0x32c8, 0x87c0, 0x64e1, 0x38cc, 0x8800 }, 16, 0x0008e100, 1},
-	{{0x1890, 0x0d50, 0xa000, 0x92c2, 0x6c00, 0x3620, 0xa000, 0x0d50, 0xa000, 0x3606, 0xa04c, 0x6c00, 0x6e93, 0x3600, 0xa08c, 0x66e9 }, 16, 0x0008e120, 1},
-	{{0x6e13, 0x92c2, 0x7861, 0x3600, 0xa004, 0x6669, 0x7550, 0x3606, 0xa004, 0x7861, 0x7d76, 0x3e00, 0xa603, 0x30cc, 0x8580, 0x7550 }, 16, 0x0008e140, 1},
-	{{0x30cc, 0x8580, 0xc852, 0x3800, 0xa009, 0x7e49, 0x7e49, 0x7d76, 0x3620, 0xa100, 0x5f40, 0xc852, 0x3600, 0xa804, 0x6317, 0x5b40 }, 16, 0x0008e160, 1},
-	{{0x3600, 0xb000, 0x64e8, 0x610c, 0x3607, 0xa00c, 0x6764, 0x64e8, 0x3607, 0xb000, 0x6564, 0x74ce, 0x344a, 0xf5c1, 0x4952, 0x9f70 }, 16, 0x0008e180, 1},
-	{{0xc565, 0x3124, 0x3f30, 0x8009, 0x0886, 0x3a58, 0x8009, 0xe748, 0xc088, 0x2809, 0x8248, 0xf041, 0x32e4, 0x3c84, 0x8001, 0x3800 }, 16, 0x0008e1a0, 1},
-	{{0x3a38, 0x800a, 0x2c10, 0x3908, 0x29f4, 0xbff8, 0x38d8, 0x33c4, 0xb1e2, 0x1991, 0x3a08, 0x2994, 0xbff8, 0x90c0, 0xe8a9, 0x8465 }, 16, 0x0008e1c0, 1},
-	{{0x3808, 0x29d4, 0xbff8, 0x39c8, 0x3808, 0xbfff, 0x1190, 0x3800, 0x20d0, 0x8008, 0x0100, 0x3a4a, 0x800a, 0x1191, 0x3908, 0x29b4 }, 16, 0x0008e1e0, 1},
-	{{0xbff8, 0x33f9, 0x9fff, 0x4110, 0x1191, 0xe8e9, 0x0986, 0x3a58, 0x8009, 0x32c9, 0x8410, 0x0100, 0x3a50, 0x800a, 0x0101, 0x80dc }, 16, 0x0008e200, 1},
-	{{0x1190, 0x0886, 0x3a58, 0x8009, 0x0100, 0x3a88, 0x800a, 0x1192, 0x3908, 0x29f4, 0xbff8, 0x0100, 0x3a4e, 0x800a, 0x0100, 0x80da }, 16, 0x0008e220, 1},
-	{{0x4091, 0x0986, 0x3a58, 0x8009, 0xc0a8, 0x2909, 0x80d8, 0xf041, 0x32e4, 0x3c84, 0x8001, 0x3800, 0x3a4c, 0x800a, 0x2d10, 0x0307 }, 16, 0x0008e240, 1},
-	{{0x3a4c, 0x800a, 0x0007, 0x3a50, 0x800a, 0x371b, 0x8020, 0xdd98, 0xc0df, 0x0107, 0x3a4c, 0x800a, 0xdc01, 0xd800, 0xdc03, 0x0886 }, 16, 0x0008e260, 1},
-	{{0x3a58, 0x8009, 0x0300, 0x3a50, 0x800a, 0x0000, 0x3a50, 0x800a, 0x0200, 0x3a4c, 0x800a, 0x1090, 0x8100, 0xd800, 0x0000, 0x3a88 }, 16, 0x0008e280, 1},
-	{{0x800a, 0x1190, 0x80e0, 0x1090, 0x80e2, 0x38e8, 0x3c10, 0xbfff, 0xd891, 0xdc19, 0x0090, 0x3ae8, 0x3c14, 0xbfff, 0x0886, 0x3a58 }, 16, 0x0008e2a0, 1},
-	{{0x8009, 0x32f9, 0x3fff, 0xbf00, 0xb983, 0x0900, 0x3a48, 0x800a, 0x1092, 0x1390, 0x80de, 0xdd00, 0x3718, 0x80ff, 0xd810, 0xdd18 }, 16, 0x0008e2c0, 1},
-	{{0x31f9, 0x3f00, 0xbcff, 0xdd01, 0x0292, 0x39c8, 0x380c, 0xbfff, 0x0807, 0x3a4e, 0x800a, 0x1191, 0xc848, 0x33e9, 0x9fff, 0x0911 }, 16, 0x0008e2e0, 1},
-	{{0xa00f, 0xdc19, 0x0091, 0x3800, 0x2048, 0x8008, 0x90c0, 0x10d0, 0x0886, 0x3a58, 0x8009, 0x0c40, 0xa000, 0x8021, 0x20e0, 0x8fef }, 16, 0x0008e300, 1},
-	{{0x34d0, 0x1290, 0x80dc, 0xdc02, 0x0000, 0x80dc, 0x0007, 0x3a50, 0x800a, 0xdc80, 0x0100, 0x3a50, 0x800a, 0x2c10, 0x38c8, 0x3818 }, 16, 0x0008e320, 1},
-	{{0xbfff, 0x39c8, 0x3814, 0xbfff, 0x0090, 0x38c8, 0x3810, 0xbfff, 0x30f9, 0x3fff, 0xbfff, 0x0091, 0x39c8, 0x3808, 0xbfff, 0x0007 }, 16, 0x0008e340, 1},
-	{{0x3a50, 0x800a, 0x0910, 0xa00f, 0x0090, 0x3800, 0x20d0, 0x8008, 0x1091, 0xe768, 0x31f8, 0x9fff, 0x9f70, 0x4010, 0x0886, 0x3a58 }, 16, 0x0008e360, 1},
-	{{0x8009, 0x90c0, 0x58d0, 0x0c08, 0xa001, 0x8009, 0x33e4, 0x3a8c, 0x8001, 0x9f71, 0x2bff, 0x9e0f, 0x39c8, 0x3808, 0xbfff, 0x3800 }, 16, 0x0008e380, 1},
-	{{0x20d0, 0x8008, 0x1091, 0xe748, 0x4010, 0x0886, 0x3a58, 0x8009, 0x0107, 0x3a88, 0x800a, 0x1290, 0x8100, 0x351b, 0x8100, 0x31e1 }, 16, 0x0008e3a0, 1},
-	{{0x7553, 0x8075, 0xdd11, 0x0c02, 0xa100, 0x806d, 0x0807, 0x3a4c, 0x800a, 0x0c08, 0xa020, 0x8051, 0x0207, 0x3a8e, 0x800a, 0x0c03 }, 16, 0x0008e3c0, 1},
-	{{0xa100, 0x0902, 0xa020, 0x0200, 0x3a8e, 0x800a, 0x8020, 0x0407, 0x3a4e, 0x800a, 0x0904, 0xa020, 0xc844, 0x0901, 0xa100, 0x0800 }, 16, 0x0008e3e0, 1},
-	{{0x3a4e, 0x800a, 0x8832, 0x0100, 0x3a88, 0x800a, 0xc2df, 0x23e0, 0x9eff, 0xdd04, 0xdd81, 0xc842, 0x0800, 0x3a4e, 0x800a, 0x8818 }, 16, 0x0008e400, 1},
-	{{0x0300, 0x3a88, 0x800a, 0xc2df, 0x0107, 0x3a8e, 0x800a, 0xdd01, 0x0200, 0x3a8e, 0x800a, 0x3478, 0x2f10, 0x0107, 0x3a4a, 0x800a }, 16, 0x0008e420, 1},
-	{{0xdc90, 0xcf40, 0x0007, 0x3a50, 0x800a, 0xd800, 0x31f8, 0x9fff, 0xdc80, 0x3479, 0xc781, 0x2469, 0xf041, 0x2518, 0x82be, 0xcf48 }, 16, 0x0008e440, 1},
-	{{0xc840, 0xd800, 0xf042, 0x0800, 0x3a4a, 0x800a, 0x3ee8, 0x2004, 0xbfff, 0x34ff, 0xf0c1, 0xdc80, 0x64ea, 0x2718, 0x828c, 0x377e }, 16, 0x0008e460, 1},
-	{{0x0807, 0x3a4c, 0x800a, 0xd327, 0x2518, 0x81f2, 0xd326, 0x2518, 0x81ca, 0x34ff, 0xd324, 0x2518, 0x8184, 0xd323, 0x2518, 0x814a }, 16, 0x0008e480, 1},
-	{{0xd322, 0x2518, 0x8108, 0xd321, 0x8089, 0x2769, 0x0007, 0x3a4c, 0x800a, 0x2718, 0x8210, 0x311b, 0x8001, 0x25e9, 0x0106, 0x3a74 }, 16, 0x0008e4a0, 1},
-	{{0x800a, 0x8033, 0x24e9, 0x357f, 0xcf48, 0x802b, 0xdd00, 0x256a, 0xc841, 0x8423, 0x11d0, 0x0007, 0x3a5e, 0x800a, 0xdc01, 0x4010 }, 16, 0x0008e4c0, 1},
-	{{0x0806, 0x3a74, 0x800a, 0x0007, 0x3a60, 0x800a, 0x51d0, 0xdc19, 0x89d2, 0x4010, 0x25e9, 0x0206, 0x3a78, 0x800a, 0x2518, 0x81c6 }, 16, 0x0008e4e0, 1},
-	{{0x2569, 0x74ff, 0x2518, 0x81be, 0xf0c2, 0xdc80, 0x24e1, 0xc842, 0x24ea, 0x0007, 0x3a64, 0x800a, 0x2718, 0x81aa, 0x51d0, 0xdc01 }, 16, 0x0008e500, 1},
-	{{0x4010, 0x0806, 0x3a78, 0x800a, 0x8fc4, 0x0007, 0x3a66, 0x800a, 0x0007, 0x3a4c, 0x800a, 0x311b, 0x8002, 0x25e9, 0x0106, 0x3a80 }, 16, 0x0008e520, 1},
-	{{0x800a, 0x802d, 0x24e9, 0x357f, 0xcf48, 0x8025, 0xdd00, 0x256a, 0xc841, 0x841d, 0x11d0, 0x0007, 0x3a6a, 0x800a, 0xdc01, 0x4010 }, 16, 0x0008e540, 1},
-	{{0x0806, 0x3a80, 0x800a, 0x8f86, 0x0007, 0x3a6c, 0x800a, 0x25e9, 0x0206, 0x3a7c, 0x800a, 0x2518, 0x814c, 0x2569, 0x74ff, 0x2518 }, 16, 0x0008e560, 1},
-	{{0x8144, 0xf0c2, 0xdc80, 0x24e1, 0xc842, 0x24ea, 0x0007, 0x3a70, 0x800a, 0x2718, 0x8130, 0x51d0, 0xdc01, 0x4010, 0x0806, 0x3a7c }, 16, 0x0008e580, 1},
-	{{0x800a, 0x8f4a, 0x0007, 0x3a72, 0x800a, 0x34ff, 0x0807, 0x3a4c, 0x800a, 0x0c08, 0xa004, 0x2518, 0x810c, 0xcf48, 0x2c10, 0xdc80 }, 16, 0x0008e5a0, 1},
-	{{0x24ea, 0x0886, 0x3a58, 0x8009, 0x2718, 0x80fa, 0x1200, 0x810a, 0x351c, 0x807f, 0x21e0, 0x9f80, 0x3a61, 0xdc82, 0x6c7c, 0xde19 }, 16, 0x0008e5c0, 1},
-	{{0x88e2, 0x0400, 0x810a, 0x34ff, 0x0807, 0x3a4c, 0x800a, 0x0c08, 0xa008, 0x80d1, 0xcf48, 0xdc80, 0x24ea, 0x0886, 0x3a58, 0x8009 }, 16, 0x0008e5e0, 1},
-	{{0x84c3, 0x1000, 0x810a, 0x311c, 0x807f, 0x21e0, 0x9f80, 0x3a41, 0xdc80, 0x2000, 0x8078, 0x8fc8, 0x6c7d, 0xcf48, 0xdc80, 0x24ea }, 16, 0x0008e600, 1},
-	{{0x0807, 0x3a4c, 0x800a, 0x8433, 0x0c08, 0xa010, 0x802d, 0x9f7d, 0x0886, 0x3a58, 0x8009, 0x20e0, 0x9eff, 0x1190, 0x8100, 0x0c01 }, 16, 0x0008e620, 1},
-	{{0xa100, 0x800b, 0xdc01, 0x880e, 0x0000, 0x8100, 0x0901, 0xa100, 0x0100, 0x8100, 0x9f7c, 0x886d, 0x34ff, 0xcf48, 0xdc80, 0x24ea }, 16, 0x0008e640, 1},
-	{{0x0807, 0x3a4c, 0x800a, 0x845d, 0x0c08, 0xa040, 0x8057, 0x32e4, 0x2d96, 0x8008, 0xc081, 0x884c, 0x6760, 0x2c10, 0x0c08, 0xa080 }, 16, 0x0008e660, 1},
-	{{0x8043, 0x33e4, 0x39e4, 0x8001, 0x1196, 0xc081, 0x0911, 0xa080, 0x32e4, 0x2e60, 0x8008, 0x4196, 0x2760, 0x1196, 0x30f9, 0x3fff }, 16, 0x0008e680, 1},
-	{{0xbf7f, 0xdc01, 0x4096, 0x0007, 0x3a38, 0x800a, 0x2469, 0x0007, 0x3a3a, 0x800a, 0x840f, 0x2469, 0x6c10, 0x8409, 0x33e4, 0x39ea }, 16, 0x0008e6a0, 1},
-	{{0x8001, 0x34ff, 0x2760, 0xcf48, 0xdc80, 0x24ea, 0x0007, 0x3a58, 0x800a, 0x8417, 0x37ff, 0x74d6, 0xdc07, 0x2469, 0xc082, 0x8021 }, 16, 0x0008e6c0, 1},
-	{{0x2bff, 0x9c9d, 0x881a, 0x67e0, 0x37ff, 0x34d6, 0x0007, 0x3a5a, 0x800a, 0xdc07, 0x2469, 0xc083, 0x8007, 0x2bff, 0x9c83, 0x27e0 }, 16, 0x0008e6e0, 1},
-	{{0xf0c1, 0xd887, 0xdc01, 0x3478, 0x377e, 0x77ff, 0x2469, 0x3b41, 0x3fc1, 0xf041, 0x2fff, 0x9d5f, 0x3024, 0x3f50, 0x8009, 0xe768 }, 16, 0x0008e700, 1},
-	{{0x0886, 0x3a58, 0x8009, 0x0207, 0x3a4c, 0x800a, 0x1090, 0x80d8, 0x3062, 0xc181, 0x8093, 0xc940, 0x0900, 0x3a4c, 0x800a, 0x0007 }, 16, 0x0008e720, 1},
-	{{0x3a86, 0x800a, 0x34f9, 0x0207, 0x3a4c, 0x800a, 0x351a, 0x80ff, 0xdd01, 0x2569, 0xd981, 0x8051, 0x331a, 0x8020, 0x3411, 0x8200 }, 16, 0x0008e740, 1},
-	{{0xdd18, 0x8036, 0x3452, 0x0200, 0x3a86, 0x800a, 0x3411, 0x8020, 0x844d, 0x1990, 0x8100, 0x0c09, 0xa100, 0x8016, 0x0307, 0x3a4e }, 16, 0x0008e760, 1},
-	{{0x800a, 0x0903, 0xa020, 0xc943, 0x8834, 0x0900, 0x3a4e, 0x800a, 0xc2df, 0xdd03, 0x8ff4, 0xc942, 0x7452, 0x0900, 0xa200, 0x881e }, 16, 0x0008e780, 1},
-	{{0x0000, 0x3a86, 0x800a, 0x0207, 0x3a8e, 0x800a, 0xdc03, 0xdd03, 0x0000, 0x3a86, 0x800a, 0x0200, 0x3a8e, 0x800a, 0x7cc1, 0x3339 }, 16, 0x0008e7a0, 1},
-	{{0x9fff, 0x64e9, 0x8581, 0x0107, 0x3a4c, 0x800a, 0xd901, 0x1090, 0x80dc, 0xdd00, 0x0007, 0x3a86, 0x800a, 0xdd18, 0x357a, 0xc942 }, 16, 0x0008e7c0, 1},
-	{{0x0900, 0x3a50, 0x800a, 0x3900, 0x2048, 0x8008, 0x21e0, 0x8fef, 0x19d1, 0xdc82, 0x0c49, 0xa000, 0x800b, 0xc941, 0x0900, 0x3a50 }, 16, 0x0008e7e0, 1},
-	{{0x800a, 0x0507, 0x3a84, 0x800a, 0x0207, 0x3a54, 0x800a, 0x35d2, 0x1490, 0x80e0, 0xd885, 0xde01, 0x2661, 0xdd81, 0x25e1, 0xde82 }, 16, 0x0008e800, 1},
-	{{0x3263, 0x38e8, 0x3c10, 0xbfff, 0x8021, 0xde9c, 0x0500, 0x3a54, 0x800a, 0x5190, 0x33f9, 0x9fff, 0x4190, 0x1190, 0x0207, 0x3a54 }, 16, 0x0008e820, 1},
-	{{0x800a, 0xd912, 0xdd19, 0x4290, 0x0886, 0x3a58, 0x8009, 0x0107, 0x3a8a, 0x800a, 0xda01, 0x0107, 0x3a56, 0x800a, 0x35d1, 0x1290 }, 16, 0x0008e840, 1},
-	{{0x80e2, 0xdd84, 0x25e1, 0xde02, 0x2661, 0x38e8, 0x3c10, 0xbfff, 0x3263, 0x0407, 0x3a84, 0x800a, 0x8025, 0xd984, 0xde01, 0xdd82 }, 16, 0x0008e860, 1},
-	{{0xde1b, 0x0400, 0x3a56, 0x800a, 0x5190, 0x33e9, 0x9fff, 0x4190, 0x1190, 0x0207, 0x3a56, 0x800a, 0xdd19, 0x4290, 0x38c8, 0x3810 }, 16, 0x0008e880, 1},
-	{{0xbfff, 0x0207, 0x3a50, 0x800a, 0x1390, 0xdd18, 0x37f9, 0x9fff, 0x3161, 0x0886, 0x3a58, 0x8009, 0x8021, 0x0207, 0x3a4c, 0x800a }, 16, 0x0008e8a0, 1},
-	{{0x37e9, 0x9fff, 0xd902, 0x1390, 0x80dc, 0xdd03, 0x38c8, 0x3810, 0xbfff, 0xdd18, 0xdc9a, 0x4190, 0x38c8, 0x380c, 0xbfff, 0x0107 }, 16, 0x0008e8c0, 1},
-	{{0x3a50, 0x800a, 0x1290, 0x0007, 0x3a4e, 0x800a, 0x357a, 0xdc01, 0xdd01, 0x3062, 0xd901, 0x8015, 0x38c8, 0x380c, 0xbfff, 0x09f0 }, 16, 0x0008e8e0, 1},
-	{{0xbfff, 0x5190, 0xdd01, 0xdd18, 0x4290, 0x0107, 0x3a4c, 0x800a, 0xd881, 0x0207, 0x3a50, 0x800a, 0xdc82, 0x0207, 0x3a8e, 0x800a }, 16, 0x0008e900, 1},
-	{{0xd902, 0xdc82, 0x34f9, 0x0007, 0x3a4e, 0x800a, 0xd901, 0xdd00, 0x2561, 0x0986, 0x3a58, 0x8009, 0x7160, 0x1391, 0x80da, 0xdc83 }, 16, 0x0008e920, 1},
-	{{0x94c1, 0xc081, 0x6c10, 0xdc19, 0x2461, 0xdc9a, 0x2469, 0xc841, 0x8009, 0x0800, 0x3a4e, 0x800a, 0x1091, 0x80de, 0x0107, 0x3a52 }, 16, 0x0008e940, 1},
-	{{0x800a, 0x3061, 0x38e8, 0x3c14, 0xbfff, 0x802b, 0x0000, 0x3a52, 0x800a, 0x1190, 0x30f9, 0x3fff, 0xbf00, 0xdc01, 0x0090, 0xe9e8 }, 16, 0x0008e960, 1},
-	{{0x1091, 0x0886, 0x3a58, 0x8009, 0x90c0, 0x1190, 0x80de, 0xd891, 0xdc98, 0x4191, 0x0886, 0x3a58, 0x8009, 0x0107, 0x3a58, 0x800a }, 16, 0x0008e980, 1},
-	{{0x1090, 0x80e4, 0x3061, 0xc940, 0x8009, 0x0900, 0x3a58, 0x800a, 0x1090, 0x80e6, 0x0107, 0x3a5a, 0x800a, 0x3061, 0xc940, 0x8009 }, 16, 0x0008e9a0, 1},
-	{{0x0900, 0x3a5a, 0x800a, 0x1090, 0x80e8, 0x0107, 0x3a5c, 0x800a, 0x3061, 0xc940, 0x801f, 0x0900, 0x3a5c, 0x800a, 0x1090, 0x80e8 }, 16, 0x0008e9c0, 1},
-	{{0x3119, 0x8ffe, 0x3000, 0x2000, 0x8008, 0x6c51, 0x0002, 0x3a74, 0x800a, 0x1090, 0x80ea, 0x0107, 0x3a5e, 0x800a, 0x3061, 0xc940 }, 16, 0x0008e9e0, 1},
-	{{0x8009, 0x0900, 0x3a5e, 0x800a, 0x1090, 0x80ec, 0x0107, 0x3a60, 0x800a, 0x3061, 0xc940, 0x8009, 0x0900, 0x3a60, 0x800a, 0x1090 }, 16, 0x0008ea00, 1},
-	{{0x80ee, 0x0107, 0x3a62, 0x800a, 0x3061, 0xc940, 0x801f, 0x0900, 0x3a62, 0x800a, 0x1090, 0x80ee, 0x3119, 0x8ffe, 0x3000, 0x2000 }, 16, 0x0008ea20, 1},
-	{{0x8008, 0x6c51, 0x0002, 0x3a78, 0x800a, 0x1090, 0x80f0, 0x0107, 0x3a64, 0x800a, 0x3061, 0xc940, 0x8009, 0x0900, 0x3a64, 0x800a }, 16, 0x0008ea40, 1},
-	{{0x1090, 0x80f2, 0x0107, 0x3a66, 0x800a, 0x3061, 0xc940, 0x8009, 0x0900, 0x3a66, 0x800a, 0x1090, 0x80f4, 0x0107, 0x3a68, 0x800a }, 16, 0x0008ea60, 1},
-	{{0x3061, 0xc940, 0x801f, 0x0900, 0x3a68, 0x800a, 0x1090, 0x80f4, 0x3119, 0x8ffe, 0x3000, 0x2000, 0x8008, 0x6c51, 0x0002, 0x3a80 }, 16, 0x0008ea80, 1},
-	{{0x800a, 0x1090, 0x80f6, 0x0107, 0x3a6a, 0x800a, 0x3061, 0xc940, 0x8009, 0x0900, 0x3a6a, 0x800a, 0x1090, 0x80f8, 0x0107, 0x3a6c }, 16, 0x0008eaa0, 1},
-	{{0x800a, 0x3061, 0xc940, 0x8009, 0x0900, 0x3a6c, 0x800a, 0x1090, 0x80fa, 0x0107, 0x3a6e, 0x800a, 0x3061, 0xc940, 0x801f, 0x0900 }, 16, 0x0008eac0, 1},
-	{{0x3a6e, 0x800a, 0x1090, 0x80fa, 0x3119, 0x8ffe, 0x3000, 0x2000, 0x8008, 0x6c51, 0x0002, 0x3a7c, 0x800a, 0x1090, 0x80fc, 0x0107 }, 16, 0x0008eae0, 1},
-	{{0x3a70, 0x800a, 0x3061, 0xc940, 0x8009, 0x0900, 0x3a70, 0x800a, 0x0107, 0x3a72, 0x800a, 0x1090, 0x80fe, 0x7061, 0x8009, 0x0000 }, 16, 0x0008eb00, 1},
-	{{0x3a72, 0x800a, 0x9f71, 0x3124, 0x3f30, 0x8009, 0x39c8, 0x3c18, 0xbfff, 0xc840, 0x5091, 0x0c00, 0xa003, 0x8449, 0xc848, 0x2100 }, 16, 0x0008eb20, 1},
-	{{0x9770, 0x32e4, 0x3c4e, 0x8001, 0x6460, 0xc2fe, 0xdd00, 0x2100, 0x9770, 0x3640, 0x8001, 0x3441, 0x8001, 0xd891, 0xd4c0, 0xc941 }, 16, 0x0008eb40, 1},
-	{{0x2100, 0x87d0, 0xe839, 0xc848, 0x7c48, 0x6461, 0x6468, 0x32e4, 0x3c48, 0x8001, 0x9ac1, 0x3c10, 0x83e8, 0x90c0, 0x3100, 0x83e8 }, 16, 0x0008eb60, 1},
-	{{0x8815, 0xc848, 0x2100, 0x9800, 0x32e4, 0x3c4e, 0x8001, 0x6460, 0x3550, 0x6c10, 0x7d58, 0x3529, 0x9f00, 0x311c, 0x87ff, 0xc568 }, 16, 0x0008eb80, 1},
-	{{0x9f7d, 0x38e8, 0x3c00, 0xbfff, 0x33f9, 0x3800, 0x80ff, 0x5290, 0xdd82, 0xdc9b, 0xdc9c, 0x4190, 0xc560, 0x90c0, 0x90c0, 0x9f71 }, 16, 0x0008eba0, 1},
-	{{0x8367, 0x37d0, 0x3751, 0xd422, 0x8090, 0x92c2, 0xc0ff, 0x32e4, 0x394e, 0x8001, 0x7457, 0x2760, 0x67e0, 0x6769, 0x807c, 0x92c2 }, 16, 0x0008ebc0, 1},
-	{{0xc0ff, 0xd3a1, 0x8035, 0x27e9, 0x2c90, 0x3001, 0x2000, 0x8008, 0x8449, 0x3378, 0x7f45, 0x7b61, 0x8060, 0x92c2, 0xc0ff, 0x107c }, 16, 0x0008ebe0, 1},
-	{{0x9fe7, 0xd021, 0x840a, 0x0996, 0xa000, 0x0916, 0xb000, 0x38e8, 0x3c18, 0xbfff, 0x8842, 0x4690, 0x30e1, 0x3fff, 0x80ff, 0xdf00 }, 16, 0x0008ec00, 1},
-	{{0x107c, 0x9fe7, 0xd021, 0x840a, 0x09d6, 0xa000, 0x0916, 0xb000, 0x8fe4, 0x38e8, 0x3c1c, 0xbfff, 0xc846, 0x3900, 0x3556, 0x8008 }, 16, 0x0008ec20, 1},
-	{{0xe849, 0xc848, 0x9199, 0x32e4, 0x3c4e, 0x8001, 0x2460, 0xc18a, 0x0002, 0x3550, 0x8008, 0x6c10, 0x3124, 0x3f50, 0x8009, 0xd421 }, 16, 0x0008ec40, 1},
-	{{0x845d, 0x38c8, 0x3c08, 0xbfff, 0xd890, 0x4190, 0x1190, 0x38c8, 0x3c08, 0xbfff, 0x33f9, 0x9fff, 0x7061, 0x800d, 0x5190, 0x33f9 }, 16, 0x0008ec60, 1},
-	{{0x9fff, 0x7061, 0x85f9, 0x2c90, 0xc08b, 0x01c0, 0x3e56, 0x8009, 0x32e4, 0x39e4, 0x8001, 0x0101, 0x3a94, 0x800a, 0xc09c, 0x32e4 }, 16, 0x0008ec80, 1},
-	{{0x3a5c, 0x8001, 0x39e0, 0x2cbe, 0x8008, 0x32e4, 0x3a68, 0x8001, 0xc09c, 0xc181, 0x32e4, 0x3a62, 0x8001, 0xc09c, 0x9f71, 0x38a8 }, 16, 0x0008eca0, 1},
-	{{0x3c20, 0xbfff, 0x0906, 0x3a90, 0x800a, 0x1b90, 0x0a86, 0x3a54, 0x8009, 0xc09c, 0xe8eb, 0xe839, 0x0882, 0x8064, 0x32e4, 0x3a68 }, 16, 0x0008ecc0, 1},
-	{{0x8001, 0x0b02, 0x3a90, 0x800a, 0x0906, 0x354c, 0x8008, 0x3800, 0x2036, 0x8008, 0xe941, 0x0902, 0x354c, 0x8008, 0x0007, 0x354e }, 16, 0x0008ece0, 1},
-	{{0x8008, 0x4010, 0x0006, 0x3550, 0x8008, 0x2469, 0xc840, 0x8019, 0xe861, 0xe8f1, 0x8412, 0x0802, 0x3550, 0x8008, 0x3800, 0x3556 }, 16, 0x0008ed00, 1},
-	{{0x8008, 0xc081, 0x9098, 0x0005, 0x3a94, 0x800a, 0x2469, 0x0085, 0x3a37, 0x8009, 0x803f, 0x3460, 0x38c8, 0x3c10, 0xbfff, 0x2469 }, 16, 0x0008ed20, 1},
-	{{0x00c4, 0x3e56, 0x8009, 0x800d, 0xd422, 0x8421, 0xd427, 0x8425, 0x881b, 0x5090, 0x0106, 0x354c, 0x8008, 0x3319, 0x803f, 0xd0a0 }, 16, 0x0008ed40, 1},
-	{{0x8412, 0x3188, 0x8000, 0xd020, 0x840b, 0xc081, 0x0081, 0x3a5c, 0x8009, 0x2c90, 0x0005, 0x3a95, 0x800a, 0x01c0, 0x3e56, 0x8009 }, 16, 0x0008ed60, 1},
-	{{0x9f70, 0x0001, 0x3a94, 0x800a, 0x90c0, 0x90c0, 0x90c0, 0x90c0, 0x3124, 0x3f30, 0x8009, 0x83fb, 0x32e4, 0x38ac, 0x8001, 0x3750 }, 16, 0x0008ed80, 1},
-	{{0xe750, 0x32e4, 0x3a7a, 0x8001, 0xc09e, 0xc183, 0x32e4, 0x3a62, 0x8001, 0xc09e, 0x33e4, 0x3b3a, 0x8001, 0x2760, 0x0007, 0x39c0 }, 16, 0x0008eda0, 1},
-	{{0x8008, 0x2469, 0x3800, 0x38a8, 0x8008, 0x3900, 0x2026, 0x8008, 0x807e, 0x92c2, 0xc086, 0x7456, 0x7861, 0x7c41, 0x10d1, 0xc940 }, 16, 0x0008edc0, 1},
-	{{0x7378, 0xe918, 0x8068, 0x56d1, 0xd720, 0x8463, 0x3656, 0x8000, 0x805d, 0x32e4, 0x39f6, 0x8001, 0x2000, 0x83e8, 0x2760, 0x3900 }, 16, 0x0008ede0, 1},
-	{{0x2114, 0x8008, 0x27e8, 0x9ff0, 0x11d1, 0xf841, 0x3cc8, 0xc082, 0x3622, 0x8006, 0x3421, 0x8006, 0xd891, 0x2d10, 0xd4c2, 0x24e1 }, 16, 0x0008ee00, 1},
-	{{0x027c, 0x9ffb, 0x78ce, 0x32e4, 0x3b76, 0x8001, 0x64e0, 0x2760, 0x10fc, 0x9ff0, 0xd446, 0x3861, 0x3800, 0x21f2, 0x8008, 0x2c90 }, 16, 0x0008ee20, 1},
-	{{0x7478, 0x32e4, 0x3b58, 0x8001, 0x4110, 0x8805, 0xc081, 0x3024, 0x3f50, 0x8009, 0xe770, 0x90c0, 0x90c0, 0x90c0, 0x90c0, 0x90c0 }, 16, 0x0008ee40, 1},
-	{{0x94c0, 0x9620, 0x9720, 0x94c0, 0x9e20, 0x9f20, 0x270a, 0x8030, 0xe7ea, 0x270a, 0x8000, 0xc8b0, 0x7450, 0xf018, 0xc081, 0x3364 }, 16, 0x0008ee60, 1},
-	{{0x3610, 0x8008, 0x3da8, 0x3c20, 0xbfff, 0xfd45, 0xfec5, 0x90c0, 0x5696, 0xf64b, 0x9f7d, 0xc681, 0x0600, 0x3a98, 0x800a, 0x0886 }, 16, 0x0008ee80, 1},
-	{{0x3a58, 0x8009, 0x90c0, 0xe846, 0xf845, 0xfdc5, 0x90c0, 0x5e15, 0xfe08, 0xf588, 0x3b19, 0x8008, 0xf145, 0xf1c5, 0x64e9, 0x37e4 }, 16, 0x0008eea0, 1},
-	{{0x2f08, 0x8008, 0x3ac8, 0x2428, 0xbfff, 0xfa45, 0xf9c5, 0x90c0, 0x5791, 0xf744, 0xf4c4, 0x3918, 0x8080, 0xf045, 0xf3c5, 0xf344 }, 16, 0x0008eec0, 1},
-	{{0x1ffc, 0x9ff2, 0xff0c, 0x37c9, 0x2428, 0xbfff, 0xf745, 0xfcc5, 0x90c0, 0x5594, 0xf544, 0x20e0, 0x9f7f, 0xf1c4, 0xdc01, 0xf044 }, 16, 0x0008eee0, 1},
-	{{0xf4c4, 0xffc5, 0x90c0, 0x4497, 0x3ce8, 0x3c2c, 0xbfff, 0xfc45, 0xfcc5, 0x90c0, 0x5094, 0xf044, 0xf5c4, 0x3b1c, 0x8f00, 0xf445 }, 16, 0x0008ef00, 1},
-	{{0xf5c5, 0x3acf, 0x8608, 0xf745, 0xf1c5, 0xf144, 0x1bfc, 0x9ff2, 0xfb0d, 0x31c9, 0x2418, 0xbfff, 0xf145, 0xf9c5, 0x90c0, 0x5791 }, 16, 0x0008ef20, 1},
-	{{0xf744, 0xf4c4, 0x390a, 0x8030, 0xf245, 0xf0c5, 0x30cf, 0x8410, 0xf744, 0xf4c4, 0xf445, 0x19fc, 0x9fee, 0xf90f, 0x34c9, 0x2418 }, 16, 0x0008ef40, 1},
-	{{0xbfff, 0xf445, 0xfac5, 0x90c0, 0x5492, 0xf444, 0xf7c4, 0x3f0f, 0x8f00, 0xf745, 0xf2c5, 0x34ca, 0x8218, 0xf244, 0xf2c4, 0xf245 }, 16, 0x0008ef60, 1},
-	{{0x1afc, 0x9fee, 0xfa10, 0x37e9, 0x3c2c, 0xbfff, 0xf745, 0xfcc5, 0x90c0, 0x5194, 0xf144, 0x20e0, 0x90ff, 0xf7c4, 0xdc07, 0xf044 }, 16, 0x0008ef80, 1},
-	{{0xf7c4, 0xfbc5, 0x90c0, 0x4793, 0x34c9, 0x2418, 0xbfff, 0xf445, 0xf9c5, 0x90c0, 0x5391, 0xf344, 0x35f9, 0x3fff, 0xbfcf, 0xf7c4 }, 16, 0x0008efa0, 1},
-	{{0xde87, 0xf544, 0xf7c4, 0xffc5, 0x90c0, 0x4797, 0x37c9, 0x2418, 0xbfff, 0xf745, 0xfec5, 0x90c0, 0x5196, 0xf144, 0x31f9, 0x3fff }, 16, 0x0008efc0, 1},
-	{{0xb0ff, 0xf2c4, 0xdc82, 0xf143, 0xf5c3, 0xfac5, 0x90c0, 0x4592, 0x35e9, 0x3c0c, 0xbfff, 0xf545, 0xfdc5, 0x90c0, 0x5195, 0xf144 }, 16, 0x0008efe0, 1},
-	{{0xf7c4, 0x3f8c, 0x8000, 0xf445, 0xf2c5, 0x34c9, 0x805f, 0xf144, 0xf2c4, 0xf245, 0x14fc, 0x9fee, 0xf40e, 0x30e9, 0x3c0c, 0xbfff }, 16, 0x0008f000, 1},
-	{{0xf045, 0xf8c5, 0x90c0, 0x5790, 0xf744, 0x34e9, 0x3fff, 0xbfff, 0xf5c4, 0xde05, 0xf444, 0xf7c4, 0xfac5, 0x90c0, 0x4792, 0x14fc }, 16, 0x0008f020, 1},
-	{{0x9fd0, 0x7364, 0x35e4, 0x306a, 0x8008, 0x34a9, 0x3c4c, 0xbfff, 0xf445, 0xfcc5, 0x90c0, 0x5394, 0xf344, 0xf0c4, 0x0910, 0xa800 }, 16, 0x0008f040, 1},
-	{{0xf044, 0xf0c4, 0xfdc5, 0x90c0, 0x4095, 0x30e9, 0x3c00, 0xbfff, 0xf045, 0xffc5, 0x90c0, 0x5097, 0xf04a, 0xc090, 0x3344, 0x3d26 }, 16, 0x0008f060, 1},
-	{{0x8008, 0xc08b, 0x33e4, 0x39ea, 0x8001, 0xc08a, 0x33e4, 0x39ea, 0x8001, 0xc087, 0x33e4, 0x39ea, 0x8001, 0x90c0, 0x90c0, 0x90c0 }, 16, 0x0008f080, 1},
-	{{0x90c0, 0x90c0, 0x90c0, 0x90c0, 0x90c0, 0x90c0, 0x9f79, 0x2000, 0x83e8, 0x33e4, 0x39f6, 0x8001, 0xc08b, 0x33e4, 0x39e4, 0x8001 }, 16, 0x0008f0a0, 1},
-	{{0xc08a, 0x33e4, 0x39e4, 0x8001, 0xc381, 0x0381, 0x3a5c, 0x8009, 0x0e86, 0x3a58, 0x8009, 0x90c0, 0xee44, 0xfe45, 0xfdc5, 0x90c0 }, 16, 0x0008f0c0, 1},
-	{{0x5715, 0xf708, 0xf288, 0xd128, 0x37e4, 0x30fc, 0x8008, 0xc09a, 0x3344, 0x3d26, 0x8008, 0x31e4, 0x3104, 0x8008, 0xc0ae, 0x3344 }, 16, 0x0008f0e0, 1},
-	{{0x3d26, 0x8008, 0x34e9, 0x3c2c, 0xbfff, 0xf445, 0x18fc, 0x9fe6, 0xf808, 0x14fc, 0x9ff0, 0x7e48, 0xf444, 0xfac5, 0x90c0, 0x5292 }, 16, 0x0008f100, 1},
-	{{0xf243, 0xf1c4, 0xf7c3, 0xdc9f, 0xf143, 0xf5c3, 0xffc5, 0x90c0, 0x4597, 0x39c8, 0x2418, 0xbfff, 0xf945, 0x1afc, 0x9fe2, 0xfa08 }, 16, 0x0008f120, 1},
-	{{0x11fc, 0x9ff0, 0xd911, 0xf243, 0xfcc5, 0x90c0, 0x5594, 0xf542, 0xf1c3, 0xf7c2, 0xdc9f, 0xf142, 0xf7c2, 0xfec5, 0x90c0, 0x4796 }, 16, 0x0008f140, 1},
-	{{0x3bc8, 0x2418, 0xbfff, 0xfb45, 0x1cfc, 0x9fe0, 0xfc08, 0x11fc, 0x9ff0, 0x7cd8, 0xf144, 0xfdc5, 0x90c0, 0x5195, 0xf143, 0xf1c4 }, 16, 0x0008f160, 1},
-	{{0xf0c3, 0xdc98, 0xf144, 0xf7c4, 0xfcc5, 0x90c0, 0x4794, 0x3ee8, 0x3c0c, 0xbfff, 0xfe45, 0x1efc, 0x9fe4, 0xfe08, 0x11fc, 0x9ff0 }, 16, 0x0008f180, 1},
-	{{0x7cdf, 0xf144, 0xfac5, 0x90c0, 0x5792, 0xf743, 0xf6c4, 0xf1c3, 0xdf19, 0xf644, 0xf0c4, 0xfbc5, 0x90c0, 0x4093, 0x17fc, 0x9fd0 }, 16, 0x0008f1a0, 1},
-	{{0xd3a1, 0x35e4, 0x31ec, 0x8008, 0x32a9, 0x3c4c, 0xbfff, 0xf245, 0xf8c5, 0x90c0, 0x5290, 0xf244, 0x36f9, 0x3fff, 0xb7ff, 0xf3c4 }, 16, 0x0008f1c0, 1},
-	{{0xdf03, 0xf644, 0xf1c4, 0xfdc5, 0x90c0, 0x4195, 0x0b86, 0x3a58, 0x8009, 0x90c0, 0xeb46, 0xfb45, 0xf9c5, 0x90c0, 0x5211, 0xf208 }, 16, 0x0008f1e0, 1},
-	{{0xf688, 0x3d19, 0x8008, 0xf145, 0xf2c5, 0x6569, 0x37e4, 0x323a, 0x8008, 0x31c9, 0x2428, 0xbfff, 0xf145, 0x1efc, 0x9fe8, 0xfe08 }, 16, 0x0008f200, 1},
-	{{0xf8c5, 0x90c0, 0x5090, 0xf043, 0x14fc, 0x9ff0, 0xf1c3, 0xde19, 0xf444, 0xf4c4, 0xfdc5, 0x90c0, 0x4495, 0x9f7c, 0x33a9, 0x3c20 }, 16, 0x0008f220, 1},
-	{{0xbfff, 0xf345, 0xfac5, 0x90c0, 0x5092, 0xf049, 0xc8b0, 0x270d, 0x8000, 0x27ed, 0x9fd0, 0xe7ed, 0x94c0, 0x9e21, 0x9f21, 0x94c0 }, 16, 0x0008f240, 1},
-	{{0x9621, 0x9721, 0x9f71, 0x2bff, 0x9b2b, 0x37d0, 0x3808, 0x29f4, 0xbff8, 0x30d9, 0x33c4, 0xb1e2, 0x0090, 0x3808, 0x29d4, 0xbff8 }, 16, 0x0008f260, 1},
-	{{0x0107, 0x3a4c, 0x800a, 0x0007, 0x3a4a, 0x800a, 0xd891, 0xdc19, 0x0090, 0x3808, 0x29b4, 0xbff8, 0x0107, 0x3a50, 0x800a, 0x0007 }, 16, 0x0008f280, 1},
-	{{0x3a88, 0x800a, 0xd891, 0xdc19, 0x0090, 0x3808, 0x2994, 0xbff8, 0x0907, 0x3a4e, 0x800a, 0x0990, 0xc281, 0x3652, 0x0886, 0x3a58 }, 16, 0x0008f2a0, 1},
-	{{0x8009, 0xe748, 0x1000, 0x809e, 0x2c7c, 0xc690, 0x7554, 0x32e4, 0x39d2, 0x8001, 0x6e7d, 0x3e16, 0x8fa0, 0x32e4, 0x3c4e, 0x8001 }, 16, 0x0008f2c0, 1},
-	{{0x34d6, 0x67e0, 0x2100, 0x83e7, 0xd441, 0x2100, 0x83e8, 0x32e4, 0x3c4e, 0x8001, 0x6460, 0x2d90, 0xc840, 0x39e8, 0x3814, 0xbfff }, 16, 0x0008f2e0, 1},
-	{{0xe861, 0x1091, 0xf804, 0x22e0, 0x9f00, 0xdd00, 0x10fc, 0x9ff8, 0xdc1a, 0xe8e9, 0x0090, 0x38a8, 0x3c54, 0xbfff, 0x0321, 0x250e }, 16, 0x0008f300, 1},
-	{{0x8008, 0x1090, 0xc481, 0x34ec, 0xf402, 0x30c8, 0x8146, 0x32e4, 0x3942, 0x8001, 0x047c, 0x9fff, 0x3800, 0x2030, 0x8008, 0x2000 }, 16, 0x0008f320, 1},
-	{{0x83e8, 0x32e4, 0x39f6, 0x8001, 0x56d0, 0x2760, 0x27e0, 0x39e8, 0x2c08, 0xbfff, 0x20e0, 0x9cff, 0x34d0, 0x1291, 0x38e8, 0x2808 }, 16, 0x0008f340, 1},
-	{{0xbfff, 0xdc02, 0x0091, 0x3ac8, 0x2400, 0xbfff, 0x1090, 0x39c8, 0x3000, 0xbfff, 0xdc80, 0x0190, 0x38c8, 0x3008, 0xbfff, 0xc082 }, 16, 0x0008f360, 1},
-	{{0x4092, 0x5191, 0x0c01, 0xa001, 0x8037, 0x1290, 0xc183, 0x351a, 0x8fff, 0x30fa, 0x39c8, 0x3000, 0xbfff, 0x8425, 0x2220, 0x8000 }, 16, 0x0008f380, 1},
-	{{0x38c8, 0x3008, 0xbfff, 0x7961, 0x656a, 0x8415, 0x5391, 0x0c03, 0xa001, 0x800d, 0x5390, 0x371b, 0x8fff, 0x70fb, 0x81eb, 0x39c8 }, 16, 0x0008f3a0, 1},
-	{{0x3000, 0xbfff, 0x38c8, 0x3400, 0xbfff, 0x4091, 0x1190, 0x38c8, 0x3408, 0xbfff, 0x0c01, 0xa001, 0x8037, 0x1290, 0xc183, 0x351a }, 16, 0x0008f3c0, 1},
-	{{0x8fff, 0x30fa, 0x39c8, 0x3400, 0xbfff, 0x8425, 0x2220, 0x8000, 0x38c8, 0x3408, 0xbfff, 0x7961, 0x656a, 0x8415, 0x5391, 0x0c03 }, 16, 0x0008f3e0, 1},
-	{{0xa001, 0x800d, 0x5390, 0x371b, 0x8fff, 0x70fb, 0x81eb, 0x39c8, 0x3400, 0xbfff, 0x3800, 0x2030, 0x8008, 0x0091, 0xc1fe, 0x10d0 }, 16, 0x0008f400, 1},
-	{{0x3800, 0x2034, 0x8008, 0xdc80, 0x24e1, 0xc08a, 0x3471, 0x8000, 0x842d, 0x32e4, 0x3bd0, 0x8001, 0x4710, 0x3778, 0x27e0, 0x38e8 }, 16, 0x0008f420, 1},
-	{{0x3c0c, 0xbfff, 0x2769, 0x3457, 0x31f1, 0x3fff, 0xbfff, 0x840f, 0x5290, 0xdc82, 0x32e4, 0x2086, 0x8008, 0x4190, 0x2760, 0xe768 }, 16, 0x0008f440, 1},
-	{{0x3024, 0x3f50, 0x8009, 0x7456, 0x2bff, 0x9929, 0x3808, 0x29f4, 0xbff8, 0x30d9, 0x33c4, 0xb1e2, 0x0090, 0x3808, 0x29d4, 0xbff8 }, 16, 0x0008f460, 1},
-	{{0x0107, 0x3a4c, 0x800a, 0x0007, 0x3a4a, 0x800a, 0xd891, 0xdc19, 0x0090, 0x3808, 0x29b4, 0xbff8, 0x0107, 0x3a50, 0x800a, 0x0007 }, 16, 0x0008f480, 1},
-	{{0x3a88, 0x800a, 0xd891, 0xdc19, 0x0090, 0x3808, 0x2994, 0xbff8, 0x0907, 0x3a4e, 0x800a, 0x0990, 0xc281, 0x3652, 0x0886, 0x3a58 }, 16, 0x0008f4a0, 1},
-	{{0x8009, 0xe748, 0x1000, 0x809e, 0x2c7c, 0xc690, 0x7554, 0x32e4, 0x39d2, 0x8001, 0x6e7d, 0x3e16, 0x8fa0, 0x32e4, 0x3c4e, 0x8001 }, 16, 0x0008f4c0, 1},
-	{{0x74d6, 0x2100, 0x83e7, 0xd441, 0x2100, 0x83e8, 0x32e4, 0x3c4e, 0x8001, 0x6460, 0x2d10, 0xca40, 0x3be8, 0x3814, 0xbfff, 0xea61 }, 16, 0x0008f4e0, 1},
-	{{0x1493, 0xfa04, 0x21e0, 0x9f00, 0xdc84, 0x14fc, 0x9ff8, 0xde19, 0xeaeb, 0x0492, 0x38e8, 0x2c08, 0xbfff, 0x0221, 0x250e, 0x8008 }, 16, 0x0008f500, 1},
-	{{0x1190, 0x39e8, 0x2808, 0xbfff, 0x20e0, 0x9cff, 0x35d0, 0xdc01, 0x0090, 0x3bc8, 0x2400, 0xbfff, 0x1091, 0x3ac8, 0x3000, 0xbfff }, 16, 0x0008f520, 1},
-	{{0xdd80, 0x0391, 0x38c8, 0x3008, 0xbfff, 0xc082, 0x4093, 0x5192, 0x0c01, 0xa001, 0x8037, 0x1290, 0xc183, 0x351a, 0x8fff, 0x30fa }, 16, 0x0008f540, 1},
-	{{0x39c8, 0x3000, 0xbfff, 0x8425, 0x2220, 0x8000, 0x38c8, 0x3008, 0xbfff, 0x7961, 0x656a, 0x8415, 0x5391, 0x0c03, 0xa001, 0x800d }, 16, 0x0008f560, 1},
-	{{0x5390, 0x371b, 0x8fff, 0x70fb, 0x81eb, 0x39c8, 0x3000, 0xbfff, 0x38c8, 0x3400, 0xbfff, 0x4091, 0x1190, 0x38c8, 0x3408, 0xbfff }, 16, 0x0008f580, 1},
-	{{0x0c01, 0xa001, 0x8037, 0x1290, 0xc183, 0x351a, 0x8fff, 0x30fa, 0x39c8, 0x3400, 0xbfff, 0x8425, 0x2220, 0x8000, 0x38c8, 0x3408 }, 16, 0x0008f5a0, 1},
-	{{0xbfff, 0x7961, 0x656a, 0x8415, 0x5391, 0x0c03, 0xa001, 0x800d, 0x5390, 0x371b, 0x8fff, 0x70fb, 0x81eb, 0x2c90, 0x39c8, 0x3400 }, 16, 0x0008f5c0, 1},
-	{{0xbfff, 0x9752, 0x0091, 0x3828, 0x2000, 0xbfff, 0x90c0, 0x92c8, 0x4198, 0x2000, 0x8100, 0xc840, 0x90c0, 0x9863, 0x3024, 0x3f50 }, 16, 0x0008f5e0, 1},
-	{{0x8009, 0x2c10, 0xe768, 0x3800, 0x2032, 0x8008, 0x3900, 0x2034, 0x8008, 0x18d0, 0x3b00, 0x203e, 0x8008, 0x10d1, 0x3900, 0x2032 }, 16, 0x0008f600, 1},
-	{{0x8008, 0x11d3, 0xe748, 0x2a80, 0x8001, 0x78c1, 0x0113, 0xeaf8, 0xeaa8, 0xcaff, 0x840a, 0x4a11, 0x6c10, 0x8852, 0xf004, 0x2980 }, 16, 0x0008f620, 1},
-	{{0x8002, 0x90c0, 0xe9f8, 0xe9a8, 0x8409, 0x2bff, 0x974d, 0x8fed, 0x2980, 0x8005, 0x90c0, 0xe9f8, 0xe9a8, 0x840b, 0x2aff, 0x9805 }, 16, 0x0008f640, 1},
-	{{0x6c10, 0x882b, 0x2980, 0x8009, 0x90c0, 0xe9f8, 0xe9a8, 0x8409, 0x2bff, 0x9bf7, 0x8fc7, 0x2980, 0x800a, 0x90c0, 0xe9f8, 0xe9a8 }, 16, 0x0008f660, 1},
-	{{0x8409, 0x2bff, 0x9de7, 0x8fb5, 0x1804, 0xa008, 0x2c10, 0x3900, 0x2034, 0x8008, 0x3800, 0x2032, 0x8008, 0x11fc, 0x9ff8, 0x0111 }, 16, 0x0008f680, 1},
-	{{0xe768, 0x9f70, 0x4010, 0x90c0, 0x94c0, 0x9620, 0x9720, 0x94c0, 0x9e20, 0x9f20, 0x96c0, 0x5d98, 0x2a03, 0x806c, 0x1998, 0x1005 }, 16, 0x0008f6a0, 1},
-	{{0xa03f, 0x5a98, 0x5c98, 0x3420, 0xa000, 0x5318, 0x3600, 0xa004, 0x7de2, 0xeeec, 0x3420, 0xa000, 0x9a43, 0x545a, 0x555a, 0x565a }, 16, 0x0008f6c0, 1},
-	{{0x575a, 0x3420, 0xa000, 0x5052, 0x1059, 0x535c, 0x3600, 0xa004, 0x63a0, 0x5159, 0x3800, 0xa00c, 0x6324, 0x638d, 0x525c, 0x3800 }, 16, 0x0008f6e0, 1},
-	{{0xa00c, 0x6301, 0x638a, 0x5259, 0x3420, 0xa000, 0x555c, 0x3a00, 0xa21d, 0x62a8, 0x630e, 0x63c1, 0x5359, 0x3420, 0xa000, 0x545c }, 16, 0x0008f700, 1},
-	{{0x3a00, 0xa23f, 0x622c, 0x6285, 0x6340, 0x63d7, 0x3400, 0xa844, 0x63e3, 0x3c20, 0xa20d, 0x6209, 0x6282, 0x6b6b, 0x5059, 0x972d }, 16, 0x0008f720, 1},
-	{{0x3400, 0xa844, 0x6f5e, 0x3c20, 0xa21d, 0x63a0, 0x6206, 0x62c3, 0x5159, 0x962d, 0x3a00, 0xa23f, 0x6324, 0x638d, 0x6242, 0x62df }, 16, 0x0008f740, 1},
-	{{0x3400, 0xa844, 0x62e2, 0x3c30, 0xa01d, 0x6301, 0x638a, 0x625b, 0x5259, 0x952d, 0x3400, 0xa844, 0x6e54, 0x3c20, 0xa21d, 0x62a8 }, 16, 0x0008f760, 1},
-	{{0x630e, 0x63c1, 0x5359, 0x942d, 0xecee, 0x08f1, 0x9ff6, 0x96c0, 0x902c, 0x09f1, 0x9ff4, 0x96c0, 0x912c, 0x08f5, 0x9ffc, 0x96c0 }, 16, 0x0008f780, 1},
-	{{0x902c, 0x09f5, 0x9ffe, 0x993c, 0x94c0, 0x9e21, 0x9f21, 0x94c0, 0x9621, 0x9721, 0x94c0, 0x9f70, 0xf3c1, 0xc563, 0x3c47, 0xe748 }, 16, 0x0008f7a0, 1},
-	{{0xf042, 0xf0c2, 0xe768, 0x9f71, 0x2468, 0x75d0, 0x92c2, 0x6d10, 0x94c7, 0x64e8, 0xc2ff, 0x92c2, 0x6c10, 0x32e4, 0x3d62, 0x8001 }, 16, 0x0008f7c0, 1},
-	{{0x92c3, 0xc0ff, 0xc398, 0x65e8, 0x92c2, 0x6d10, 0x32e4, 0x3d86, 0x8001, 0x92c3, 0xc2ff, 0x7451, 0x9f70, 0x6461, 0x3124, 0x3f30 }, 16, 0x0008f7e0, 1},
-	{{0x8009, 0x83fb, 0x2c10, 0x2d10, 0xc188, 0x4010, 0x2809, 0x8004, 0x280a, 0x801c, 0x2808, 0x8038, 0x2b02, 0x801c, 0x2a02, 0x800e }, 16, 0x0008f800, 1},
-	{{0x0238, 0xebea, 0x9744, 0x90c0, 0x92c8, 0x429b, 0x9746, 0xebe9, 0x92c8, 0x429b, 0x8388, 0x3000, 0x2000, 0x8100, 0x38e1, 0x7440 }, 16, 0x0008f820, 1},
-	{{0x24ea, 0x40b1, 0x81dc, 0x2a0a, 0x8038, 0x0604, 0x3870, 0x800a, 0xd328, 0x8409, 0x880e, 0x2000, 0x8831, 0xd330, 0x840d, 0x2000 }, 16, 0x0008f840, 1},
-	{{0x8418, 0x0002, 0x3d14, 0x800a, 0x3120, 0x3f6c, 0x8324, 0x835a, 0x3000, 0x2000, 0x8200, 0x8352, 0x0106, 0x3d14, 0x800a, 0x2c10 }, 16, 0x0008f860, 1},
-	{{0x0002, 0x3d10, 0x800a, 0x3e16, 0x81f4, 0x3024, 0x3f50, 0x8009, 0x0600, 0x3d1c, 0x800a, 0x8367, 0xeae8, 0x1012, 0xe750, 0x6469 }, 16, 0x0008f880, 1},
-	{{0x2418, 0x819a, 0x92c2, 0x6c10, 0xf6cb, 0x3616, 0x8040, 0x84af, 0x2a0b, 0x8004, 0x2a0e, 0x802c, 0x2a0f, 0x801c, 0x2a0c, 0x8036 }, 16, 0x0008f8a0, 1},
-	{{0x2a0a, 0x8038, 0xc788, 0x5012, 0x1014, 0xd021, 0x8463, 0x1096, 0xd029, 0x803f, 0xf941, 0xfb42, 0xfc43, 0xfa44, 0x3800, 0x3cd8 }, 16, 0x0008f8c0, 1},
-	{{0x800a, 0x0600, 0x3ce8, 0x800a, 0x0f02, 0x3ce4, 0x800a, 0x0b02, 0x3ce0, 0x800a, 0x0902, 0x3cdc, 0x800a, 0x3204, 0x323c, 0x8009 }, 16, 0x0008f8e0, 1},
-	{{0x0902, 0x3cd8, 0x800a, 0xf9c1, 0xfbc2, 0xfcc3, 0x8822, 0xfac4, 0x276a, 0xe8e9, 0x841b, 0x2b03, 0x8006, 0x9b46, 0x5150, 0x6174 }, 16, 0x0008f900, 1},
-	{{0x6d74, 0x7d48, 0x6565, 0x92d0, 0x7d48, 0x755a, 0x4258, 0x7be1, 0x67ea, 0x2a0a, 0x8038, 0x2c0c, 0x8038, 0x2f0f, 0x8038, 0x2e0e }, 16, 0x0008f920, 1},
-	{{0x8038, 0x8184, 0x2b0b, 0x8038, 0x3001, 0x3a9c, 0x800a, 0x0002, 0x3cdc, 0x800a, 0x88e4, 0x0002, 0x3cd8, 0x800a, 0x276a, 0x3b00 }, 16, 0x0008f940, 1},
-	{{0x3a9c, 0x800a, 0x840f, 0x9f46, 0xe8e9, 0x90c0, 0x92d0, 0x5058, 0x409b, 0x2a0c, 0x8004, 0x2c0e, 0x8018, 0x2e0f, 0x801a, 0x2f0b }, 16, 0x0008f960, 1},
-	{{0x8002, 0xc788, 0x5013, 0x1017, 0xd021, 0x8435, 0xd029, 0x8031, 0xf941, 0xfa42, 0xfc43, 0xfb44, 0x3800, 0x3cd8, 0x800a, 0x0600 }, 16, 0x0008f980, 1},
-	{{0x3ce8, 0x800a, 0x0e02, 0x3ce4, 0x800a, 0x3204, 0x3388, 0x8009, 0x0c02, 0x3ce0, 0x800a, 0xf9c1, 0xfac2, 0xfcc3, 0xfbc4, 0x7be1 }, 16, 0x0008f9a0, 1},
-	{{0x67ea, 0x2b0b, 0x8038, 0x2f0f, 0x8038, 0x2e0e, 0x8038, 0x81b6, 0x2c0c, 0x8038, 0x276a, 0xebe9, 0x8413, 0x9f46, 0x3800, 0x3a9c }, 16, 0x0008f9c0, 1},
-	{{0x800a, 0x90c0, 0x92d0, 0x5098, 0x405b, 0x2a0c, 0x802c, 0x9248, 0x2a03, 0x8014, 0x2b03, 0x8026, 0x2c08, 0x800a, 0x2b02, 0x801c }, 16, 0x0008f9e0, 1},
-	{{0x280a, 0x8002, 0x503a, 0x1010, 0xd021, 0x8423, 0x1094, 0xd029, 0x841d, 0x276a, 0xebe9, 0x8417, 0x9b46, 0x5153, 0x6174, 0x6d74 }, 16, 0x0008fa00, 1},
-	{{0x7d48, 0x6565, 0x92d0, 0x7d48, 0x755a, 0x425b, 0x94d0, 0x2808, 0x8038, 0x2c0c, 0x8038, 0x90c0, 0x6c10, 0x3024, 0x3f50, 0x8009 }, 16, 0x0008fa20, 1},
-	{{0xe770, 0xc298, 0x2c98, 0xe748, 0xd411, 0xf042, 0xf0c2, 0xe768, 0x9f71, 0x3324, 0x3f30, 0x8009, 0x2468, 0x3751, 0x34d0, 0xc298 }, 16, 0x0008fa40, 1},
-	{{0x94c6, 0x75d2, 0x6c10, 0x94c7, 0x6568, 0xc0ff, 0x92c2, 0x6d10, 0x32e4, 0x3d8c, 0x8001, 0x92c3, 0xc2ff, 0x2768, 0x75d6, 0x92c2 }, 16, 0x0008fa60, 1},
-	{{0x6d10, 0x32e4, 0x3d74, 0x8001, 0x92c3, 0xc2ff, 0x7451, 0x3024, 0x3f50, 0x8009, 0x6461, 0x2bff, 0x9d67, 0x2708, 0x8028, 0x9747 }, 16, 0x0008fa80, 1},
-	{{0xe7e8, 0x3900, 0x3cbc, 0x800a, 0x27e8, 0x9fe0, 0x92d0, 0x5099, 0x4098, 0x2c90, 0x3000, 0x2005, 0x8a00, 0xce41, 0x3100, 0x2000 }, 16, 0x0008faa0, 1},
-	{{0x8200, 0x3440, 0xce4a, 0x3071, 0x7941, 0x81f8, 0xce42, 0x3200, 0x2000, 0x8100, 0x6f32, 0x837c, 0x3456, 0xd4c6, 0x2aff, 0x9ced }, 16, 0x0008fac0, 1},
-	{{0x34d0, 0x77d0, 0x2aff, 0x9ce5, 0x34d0, 0xcf40, 0xf049, 0x2aff, 0x9cdb, 0xf1c3, 0x3550, 0xf1c9, 0x3451, 0xf1c5, 0x2aff, 0x9ccd }, 16, 0x0008fae0, 1},
-	{{0x6cd8, 0x3550, 0xf1c9, 0x3451, 0xf1c7, 0x2aff, 0x9cbf, 0x6cd8, 0xf1c9, 0x3451, 0xf04a, 0x2aff, 0x9cb3, 0xf1c2, 0x3550, 0xf1c9 }, 16, 0x0008fb00, 1},
-	{{0x3451, 0xf1c4, 0x2aff, 0x9ca5, 0x6cd8, 0x3550, 0xf1c9, 0x3451, 0xf1c6, 0x2aff, 0x9c97, 0x6cd8, 0x3550, 0xcf49, 0x3451, 0xf1c8 }, 16, 0x0008fb20, 1},
-	{{0x2aff, 0x9c89, 0x6cd8, 0x3550, 0xf1ca, 0x2d58, 0xce49, 0x3cd8, 0x3060, 0x3218, 0x80b1, 0xf141, 0xf1c1, 0x2aff, 0x9c6f, 0xce42 }, 16, 0x0008fb40, 1},
-	{{0xce4a, 0x2c8a, 0x3550, 0x7457, 0x2aff, 0x9c61, 0x6f4a, 0x27e8, 0x9fd8, 0x3024, 0x3f50, 0x8009, 0x2c02, 0xe7e8, 0x2bff, 0x9c81 }, 16, 0x0008fb60, 1},
-	{{0xe750, 0x0106, 0x3d08, 0x800a, 0x0206, 0x3d0c, 0x800a, 0xf144, 0xf243, 0x3160, 0x3ed8, 0x8648, 0x32e4, 0x3c5a, 0x8001, 0xc681 }, 16, 0x0008fb80, 1},
-	{{0x2468, 0x37d0, 0x3060, 0x3ed8, 0x8648, 0x8005, 0xd7c0, 0x3000, 0x3fb6, 0x8192, 0x33f0, 0x3020, 0x3f6c, 0x8324, 0x840b, 0x73f0 }, 16, 0x0008fba0, 1},
-	{{0x8436, 0x92c3, 0x6fa3, 0x3120, 0x3f6c, 0x8324, 0x33f1, 0x3040, 0x3f22, 0x84b6, 0x840f, 0x73f0, 0x92c3, 0x6f87, 0x841a, 0x92c3 }, 16, 0x0008fbc0, 1},
-	{{0xc6ff, 0x3040, 0x3f22, 0x84b6, 0x33f0, 0x3060, 0x3ed8, 0x8648, 0x8407, 0x2fa3, 0xc6ff, 0x2aff, 0x9bd3, 0x34d7, 0x7457, 0x3550 }, 16, 0x0008fbe0, 1},
-	{{0xf0c4, 0x2aff, 0x9bc7, 0x34d2, 0xce42, 0xce4a, 0x34d2, 0xf2c3, 0x2aff, 0x9bb9, 0x6c32, 0x34d7, 0x3200, 0x2000, 0x8100, 0x2aff }, 16, 0x0008fc00, 1},
-	{{0x9bab, 0xd442, 0x34c2, 0x8000, 0x30c2, 0x8000, 0x36c1, 0x8000, 0xd812, 0xd441, 0xf042, 0xf0c2, 0x3024, 0x3f50, 0x8009, 0xe770 }, 16, 0x0008fc20, 1},
-	{{0x2bff, 0x9bbd, 0x2468, 0x3550, 0x2f10, 0xe748, 0xc798, 0x8484, 0x92c3, 0xc0ff, 0x2569, 0x3000, 0x2000, 0x8100, 0x8075, 0x7062 }, 16, 0x0008fc40, 1},
-	{{0x8071, 0x7072, 0x8411, 0x34d2, 0xd526, 0x840b, 0x2aff, 0x9de7, 0xc681, 0x7550, 0x3000, 0x2000, 0x8100, 0x3170, 0x7452, 0x840d }, 16, 0x0008fc60, 1},
-	{{0x6f90, 0x3c62, 0x7bc1, 0x646a, 0x81fb, 0x27ea, 0x35c2, 0x6e10, 0x842a, 0x79c1, 0x25e9, 0x34d3, 0xce42, 0x8038, 0x94c6, 0xcf43 }, 16, 0x0008fc80, 1},
-	{{0x6c10, 0x2aff, 0x9db1, 0x3452, 0xf441, 0xf4c1, 0x3a41, 0xcf4b, 0x33f4, 0x2c53, 0xce4a, 0x81de, 0x75c0, 0x2769, 0x34d3, 0x3000 }, 16, 0x0008fca0, 1},
-	{{0x2000, 0x8100, 0x8009, 0x2bff, 0x9d8d, 0x8809, 0x8806, 0x7453, 0x7452, 0x3024, 0x3f50, 0x8009, 0xe768, 0x2bff, 0x9b23, 0x2c90 }, 16, 0x0008fcc0, 1},
-	{{0xeee8, 0x2709, 0x8048, 0x1206, 0x8030, 0x3452, 0xe7e9, 0x2aff, 0x9d55, 0xf24f, 0x35d0, 0xc188, 0x2aff, 0x9d4b, 0x1006, 0x802e }, 16, 0x0008fce0, 1},
-	{{0x2aff, 0x9ac9, 0x3750, 0x3453, 0x0106, 0x3d18, 0x800a, 0x2469, 0x77d0, 0x90c0, 0x96c2, 0x3000, 0x2000, 0x8100, 0x2418, 0x8102 }, 16, 0x0008fd00, 1},
-	{{0x92c2, 0xf050, 0x2aff, 0x9d73, 0x3000, 0x2005, 0x8a00, 0x2aff, 0x9a9b, 0x74d7, 0x35d0, 0x37d0, 0x3900, 0x3cf4, 0x800a, 0x9745 }, 16, 0x0008fd20, 1},
-	{{0x27e8, 0x9fe8, 0x92d0, 0x5099, 0x4098, 0x67e9, 0x90c0, 0x96c2, 0x3000, 0x2000, 0x8100, 0x80c8, 0x92c2, 0xf050, 0x27e8, 0x7453 }, 16, 0x0008fd40, 1},
-	{{0x8007, 0x8806, 0x6464, 0x7453, 0x3140, 0x3477, 0x8171, 0x2aff, 0x9a5b, 0xcf43, 0x27e8, 0x3400, 0x2000, 0x8080, 0xd444, 0x31ef }, 16, 0x0008fd60, 1},
-	{{0x9f00, 0x98c7, 0x3160, 0x3218, 0x80b1, 0x67e4, 0x2aff, 0x9a3d, 0x7457, 0xcf4b, 0x6c93, 0x2aff, 0x9a33, 0x3451, 0xcf41, 0xf050 }, 16, 0x0008fd80, 1},
-	{{0x2aff, 0x9a29, 0xf1c2, 0x35d0, 0xf1d0, 0x3451, 0xf1c3, 0x2aff, 0x9a1b, 0x6cd9, 0x35d0, 0xf1d0, 0x3451, 0xf1c4, 0x2aff, 0x9a0d }, 16, 0x0008fda0, 1},
-	{{0x6cd9, 0x35d0, 0xf1d0, 0x3451, 0xf1c5, 0x2aff, 0x99ff, 0x6cd9, 0x35d0, 0xf1d0, 0x3451, 0xf1c6, 0x2aff, 0x99f1, 0x6cd9, 0x35d0 }, 16, 0x0008fdc0, 1},
-	{{0xcf49, 0x3451, 0x3100, 0x2000, 0x8200, 0x6dd9, 0x2aff, 0x99dd, 0xf350, 0xf3d0, 0xcf49, 0x2aff, 0x9c5d, 0x6c99, 0x27e8, 0x34d0 }, 16, 0x0008fde0, 1},
-	{{0x3000, 0x2000, 0x8100, 0x800c, 0x6cd1, 0x67e4, 0x7ff8, 0x8808, 0xd41f, 0x7ff8, 0xd417, 0x2aff, 0x99b3, 0x6461, 0xf050, 0x1006 }, 16, 0x0008fe00, 1},
-	{{0x802c, 0xf1d0, 0x0306, 0x3d10, 0x800a, 0xf151, 0x3461, 0x8000, 0x3061, 0x8000, 0xda11, 0x3660, 0x8000, 0xd640, 0xf446, 0xf0c6 }, 16, 0x0008fe20, 1},
-	{{0x2aff, 0x9d3d, 0xf44e, 0x37d0, 0xf4ce, 0x3000, 0x3fb6, 0x8192, 0x2aff, 0x9d2d, 0x6c20, 0x2aff, 0x9973, 0x3750, 0x3456, 0x3100 }, 16, 0x0008fe40, 1},
-	{{0x2000, 0x8200, 0x74d7, 0x2aff, 0x9bed, 0x34d0, 0x7451, 0x37d0, 0xc98a, 0x2e08, 0x8032, 0x1810, 0xf2cf, 0x90c0, 0xe861, 0xe889 }, 16, 0x0008fe60, 1},
-	{{0x2518, 0x8310, 0x3456, 0x2d90, 0x3900, 0x3c90, 0x800a, 0x3118, 0x2000, 0xbe00, 0xa8c8, 0x90c0, 0x9861, 0x3200, 0x2000, 0x8100 }, 16, 0x0008fe80, 1},
-	{{0x6daa, 0x35c3, 0xf34b, 0xd547, 0xf34c, 0xf34a, 0x2aff, 0x991d, 0xf247, 0x3100, 0x2000, 0x8100, 0x8ad6, 0x2c27, 0xf049, 0x3456 }, 16, 0x0008fea0, 1},
-	{{0x3200, 0x2000, 0x8100, 0x2e4a, 0x3118, 0x2000, 0xbe00, 0x35c4, 0x6664, 0xd547, 0xf34a, 0xf44b, 0xf34c, 0x2aff, 0x98ef, 0xf247 }, 16, 0x0008fec0, 1},
-	{{0x3100, 0x2000, 0x8100, 0x8aa8, 0x2c27, 0xf049, 0x34d7, 0x3456, 0x3200, 0x2000, 0x8100, 0x24e4, 0xd547, 0xf14a, 0xf74c, 0xf34b }, 16, 0x0008fee0, 1},
-	{{0xf247, 0x2aff, 0x98c7, 0x3118, 0x2000, 0xbe00, 0x3100, 0x2000, 0x8100, 0x8a7c, 0x2c27, 0xf049, 0x3456, 0x3100, 0x2000, 0x8100 }, 16, 0x0008ff00, 1},
-	{{0xf14c, 0x2aff, 0x98a7, 0x3118, 0x2000, 0xbe00, 0x3550, 0x3456, 0x3100, 0x2000, 0x8100, 0xf14a, 0xd4c7, 0xf147, 0xf24b, 0x2aff }, 16, 0x0008ff20, 1},
-	{{0x988b, 0x3118, 0x2000, 0xbe00, 0x3100, 0x2000, 0x8100, 0x8a40, 0x2c27, 0xf049, 0x3456, 0x3100, 0x2000, 0x8100, 0x2d27, 0x3118 }, 16, 0x0008ff40, 1},
-	{{0x2000, 0xbe00, 0xf24c, 0x2aff, 0x9863, 0xcf42, 0x3550, 0x3456, 0x3100, 0x2000, 0x8100, 0x2cc7, 0xf24b, 0xf14a, 0xf147, 0x2aff }, 16, 0x0008ff60, 1},
-	{{0x984b, 0x3118, 0x2000, 0xbe00, 0xcf4a, 0xf248, 0x8a04, 0xf049, 0x2aff, 0x9ac3, 0x3457, 0xf1d1, 0x34d7, 0xf3d1, 0x2aff, 0x982d }, 16, 0x0008ff80, 1},
-	{{0x3453, 0xcf40, 0x35d0, 0x3456, 0x3200, 0x2000, 0x8100, 0x2d5d, 0x3118, 0x2000, 0xbe00, 0x2aff, 0x9813, 0xf24c, 0x3550, 0x34d7 }, 16, 0x0008ffa0, 1},
-	{{0xf3d1, 0x2aff, 0x9807, 0x3453, 0xf24b, 0x34d0, 0x3456, 0x3200, 0x2000, 0x8100, 0x2d98, 0x3118, 0x2000, 0xbe00, 0xf34a, 0xcf4b }, 16, 0x0008ffc0, 1},
-	{{0xd543, 0x2aff, 0x97e7, 0xf247, 0xcf4b, 0x3100, 0x2000, 0x8100, 0x899e, 0x2c39, 0xf049, 0x2aff, 0x9c4b, 0xf0d1, 0x2aff, 0x97cd }, 16, 0x0008ffe0, 1},
-	{{0x74d7, 0xf1d0, 0x3456, 0xcf40, 0x3200, 0x2000, 0x8100, 0x2d38, 0xeffc, 0x2aff, 0x97b7, 0x34d2, 0xf24f, 0x3456, 0xf050, 0xf2cf }, 16, 0x00090000, 1},
-	{{0x3600, 0x2000, 0x8200, 0xd742, 0x2aff, 0x97a1, 0x74d6, 0x37d0, 0xf1d0, 0x2d06, 0xf3d1, 0x3453, 0xcf49, 0x2aff, 0x978f, 0x2cd8 }, 16, 0x00090020, 1},
-	{{0xf252, 0x34d0, 0xf3d1, 0x3453, 0xf2cf, 0x2aff, 0x977f, 0x2cab, 0xf14c, 0xc840, 0xf3d1, 0x3453, 0xf2d2, 0xcf49, 0x2c98, 0xe8fc }, 16, 0x00090040, 1},
-	{{0x2aff, 0x9769, 0xf84b, 0xf2cf, 0x2dcb, 0xf1d0, 0x2d46, 0x25e4, 0xcf49, 0x2c18, 0x2cd8, 0x3dc1, 0xf04a, 0xf147, 0x8912, 0xf349 }, 16, 0x00090060, 1},
-	{{0x2aff, 0x9bc1, 0xf0d1, 0x2aff, 0x9743, 0x74d7, 0xf1d0, 0x3456, 0xcf40, 0x3200, 0x2000, 0x8100, 0x2d38, 0xeffc, 0x2aff, 0x972d }, 16, 0x00090080, 1},
-	{{0x34d2, 0xf24f, 0x3456, 0xf050, 0xf2cf, 0x3600, 0x2000, 0x8200, 0xd742, 0x2aff, 0x9717, 0x74d6, 0x37d0, 0xf3d1, 0x3453, 0xf1d0 }, 16, 0x000900a0, 1},
-	{{0x2dc6, 0xcf49, 0x2aff, 0x9705, 0x2cd9, 0xf352, 0x34d0, 0xf3d1, 0x3453, 0xf2cf, 0x2aff, 0x96f5, 0x2ccb, 0xf14c, 0xc840, 0xc84a }, 16, 0x000900c0, 1},
-	{{0x3d41, 0xf3d1, 0x2561, 0x3453, 0xf3d2, 0x2564, 0xcf49, 0x2aff, 0x96db, 0x2c99, 0xf24b, 0xf1d0, 0xf2cf, 0x2dab, 0x2d06, 0xcf49 }, 16, 0x000900e0, 1},
-	{{0x3dc1, 0x2c18, 0x2cd8, 0xf04a, 0xf147, 0x8884, 0xf349, 0x2c90, 0xc6dc, 0x2e7c, 0xc298, 0x2e7d, 0x3800, 0x3b9c, 0x800a, 0x3d02 }, 16, 0x00090100, 1},
-	{{0x8024, 0x3d42, 0xf0d0, 0xc942, 0xf04c, 0x3000, 0x2000, 0x8100, 0xe918, 0x1091, 0xf047, 0xf14b, 0xf14a, 0xf149, 0xf148, 0x8852 }, 16, 0x00090120, 1},
-	{{0x0086, 0x8028, 0x2d90, 0xf0d0, 0x2464, 0xf04c, 0x3100, 0x2000, 0x8100, 0x3298, 0x2f5c, 0xbf02, 0xf04b, 0xf34a, 0xf147, 0xf249 }, 16, 0x00090140, 1},
-	{{0x8830, 0xf348, 0x3456, 0x3200, 0x2000, 0x8100, 0x2daa, 0x3118, 0x2000, 0xbe00, 0x35c3, 0xf34b, 0xd547, 0xf34c, 0xf34a, 0x2aff }, 16, 0x00090160, 1},
-	{{0x964b, 0xf247, 0x3100, 0x2000, 0x8100, 0x2c27, 0xf049, 0xf048, 0x1006, 0x8032, 0xd02f, 0x80a5, 0xf1c7, 0x3cc1, 0x3000, 0x2000 }, 16, 0x00090180, 1},
-	{{0x8100, 0xf146, 0x2aff, 0x98af, 0xf1c6, 0x3750, 0xf0cc, 0x2aff, 0x961b, 0x74d6, 0x34d6, 0xf04c, 0x2aff, 0x9611, 0xf0cb, 0x3550 }, 16, 0x000901a0, 1},
-	{{0x34d6, 0xf0ca, 0x2aff, 0x9605, 0xf24b, 0x3550, 0x34d6, 0xf0c9, 0x2aff, 0x95f9, 0xf24a, 0x3550, 0x34d6, 0xf0c8, 0x2aff, 0x95ed }, 16, 0x000901c0, 1},
-	{{0xf249, 0x3550, 0x34d6, 0xf0c7, 0x2aff, 0x95e1, 0xf248, 0x27ef, 0x9fd0, 0xc686, 0xf047, 0x2aff, 0x95d3, 0x1097, 0x3100, 0x2000 }, 16, 0x000901e0, 1},
-	{{0x8020, 0x3b61, 0x409f, 0x676a, 0x81ef, 0x2aff, 0x95b3, 0xf0cc, 0x34d0, 0xf0cb, 0x2aff, 0x95a9, 0x4196, 0x34d0, 0xf0ca, 0x2aff }, 16, 0x00090200, 1},
-	{{0x959f, 0xb171, 0x34d0, 0xf0c9, 0x2aff, 0x9595, 0xb172, 0x34d0, 0xf0c8, 0x2aff, 0x958b, 0xb173, 0xb074, 0x27e8, 0x9fb8, 0x3024 }, 16, 0x00090220, 1},
-	{{0x3f50, 0x8009, 0x2c10, 0xe7e8, 0x24e8, 0xe9e8, 0x847b, 0xd4a7, 0x8077, 0x3e11, 0x8038, 0xc841, 0xf185, 0xd0ab, 0xe944, 0x843e }, 16, 0x00090240, 1},
-	{{0xe819, 0x0204, 0x3870, 0x800a, 0x2000, 0x8064, 0xf486, 0x3e12, 0x8005, 0x6c7d, 0x3443, 0x8004, 0x3043, 0x8004, 0x3640, 0x8004 }, 16, 0x00090260, 1},
-	{{0xd913, 0xd540, 0x35f2, 0x0200, 0x802c, 0x0004, 0x3d1c, 0x800a, 0x71f0, 0x8011, 0x880e, 0x0200, 0x3d1c, 0x800a, 0xf086, 0x0000 }, 16, 0x00090280, 1},
-	{{0x802c, 0x2d10, 0xf387, 0x9744, 0xf088, 0x2809, 0x8018, 0x0300, 0x802e, 0x0000, 0x8030, 0x0100, 0x8032, 0x92c8, 0x4299, 0x2bff }, 16, 0x000902a0, 1},
-	{{0x9a1d, 0x9f70, 0x6c10, 0x9f70, 0xc0ff, 0x64e8, 0x8443, 0x2c10, 0xd4a7, 0x803d, 0x3e11, 0x8038, 0xc941, 0x280a, 0x8004, 0xe91a }, 16, 0x000902c0, 1},
-	{{0xf185, 0x9348, 0x2b03, 0x800e, 0x0101, 0x8034, 0x2a09, 0x8034, 0x4010, 0x5011, 0xd021, 0x840b, 0xc081, 0x4010, 0x2003, 0x800e }, 16, 0x000902e0, 1},
-	{{0x94d0, 0x2909, 0x8038, 0x90c0, 0x90c0, 0x9f70, 0x6c10, 0x9f70, 0xc0ff, 0x2bff, 0x94eb, 0x2f90, 0x1611, 0xc088, 0x270a, 0x8028 }, 16, 0x00090300, 1},
-	{{0xe7ea, 0xeae8, 0x2808, 0x8004, 0x2a0b, 0x8018, 0x2a0e, 0x8014, 0x2a0f, 0x8010, 0x2a0c, 0x800c, 0x2a0d, 0x8008, 0xe944, 0xc281 }, 16, 0x00090320, 1},
-	{{0xf043, 0xf844, 0x5319, 0x1019, 0xd1af, 0xcc50, 0x3000, 0x2000, 0x8100, 0x5419, 0x8436, 0x5119, 0xf8d1, 0x90c0, 0x5598, 0x3ee3 }, 16, 0x00090340, 1},
-	{{0xe0e8, 0xf8c4, 0x90c0, 0x4590, 0xe8e0, 0x5598, 0x7ee3, 0x4595, 0x5598, 0x7ee3, 0x4594, 0x5598, 0x7ee3, 0x4597, 0x5598, 0x3ee3 }, 16, 0x00090360, 1},
-	{{0xf851, 0x2aff, 0x943b, 0x4596, 0x4093, 0xd5a0, 0x8451, 0xd5af, 0x804d, 0x2669, 0xcc58, 0x8047, 0x34d7, 0xf104, 0xf403, 0xf002 }, 16, 0x00090380, 1},
-	{{0xf301, 0xe8ea, 0xf945, 0xfa46, 0xf247, 0xfb48, 0xfc49, 0x2aff, 0x9e9b, 0xfd4a, 0x3776, 0x34d7, 0xf2c7, 0x3472, 0xfac6, 0xdc06 }, 16, 0x000903a0, 1},
-	{{0x2469, 0xfbc8, 0xfcc9, 0xf9c5, 0x801a, 0xfdca, 0xe8ea, 0x2aff, 0x9efd, 0x1801, 0xa001, 0xf9c5, 0x880a, 0xfac6, 0x7572, 0xd802 }, 16, 0x000903c0, 1},
-	{{0xdf00, 0x3d41, 0x3bc1, 0xf8c4, 0xf0c3, 0x7861, 0x246a, 0xf043, 0x2808, 0x8038, 0x2c0c, 0x8038, 0x2d0d, 0x8038, 0x2f0f, 0x8038 }, 16, 0x000903e0, 1},
-	{{0x2e0e, 0x8038, 0x2b0b, 0x8038, 0x813c, 0xf844, 0x2d10, 0xc081, 0x9348, 0x2b03, 0x8010, 0x2a08, 0x8038, 0x2a09, 0x8030, 0x2a0a }, 16, 0x00090400, 1},
-	{{0x8036, 0x34f0, 0x7776, 0xdc86, 0x24e9, 0x5112, 0x8015, 0x1311, 0xd0af, 0x800f, 0x0104, 0x3d1c, 0x800a, 0x71f1, 0x8405, 0x4210 }, 16, 0x00090420, 1},
-	{{0x2a0a, 0x8038, 0x94d0, 0x2909, 0x8038, 0x2808, 0x8038, 0x7c41, 0x27e8, 0x9fd8, 0x3024, 0x3f50, 0x8009, 0xe7e8, 0x94c0, 0xc848 }, 16, 0x00090440, 1},
-	{{0xc949, 0x9ac0, 0x3604, 0x8001, 0x90c0, 0x3405, 0x8001, 0x96c0, 0x7e78, 0x3005, 0x8001, 0x3ee8, 0x6331, 0x2fd5, 0x7f47, 0x6c5f }, 16, 0x00090460, 1},
-	{{0xc840, 0x90c0, 0x9f71, 0x3324, 0x3f30, 0x8009, 0xc941, 0x83ce, 0xc840, 0x3024, 0x3f50, 0x8009, 0xc848, 0x3124, 0x3f30, 0x8009 }, 16, 0x00090480, 1},
-	{{0x83fb, 0x3318, 0x807f, 0x3e70, 0x8000, 0x3c48, 0x3400, 0x200c, 0x9800, 0x2461, 0xc298, 0x2f20, 0x35d2, 0xeee8, 0x32c8, 0x80c7 }, 16, 0x000904a0, 1},
-	{{0x74f0, 0x64e8, 0x92c2, 0x6c10, 0x94c7, 0x6568, 0xc0ff, 0x92c2, 0x6d10, 0x32e4, 0x3d8c, 0x8001, 0x92c3, 0xc2ff, 0x3451, 0x3100 }, 16, 0x000904c0, 1},
-	{{0x2003, 0x8600, 0x83a2, 0x6461, 0x2464, 0x3418, 0x200f, 0xa200, 0x7270, 0x8007, 0x6e10, 0x6c7d, 0x6c56, 0x3024, 0x3f50, 0x8009 }, 16, 0x000904e0, 1},
-	{{0x4096, 0x331a, 0x8f00, 0x3d68, 0x3000, 0x2001, 0x8300, 0x3601, 0x8002, 0x3400, 0x8002, 0xd810, 0xd441, 0x2461, 0x3100, 0x200c }, 16, 0x00090500, 1},
-	{{0x9800, 0x6c31, 0x9f70, 0x0080, 0x8048, 0x8371, 0x2469, 0x3750, 0xe758, 0x3900, 0x3d20, 0x800a, 0x2418, 0x814a, 0x96c2, 0x3000 }, 16, 0x00090520, 1},
-	{{0x2000, 0x8100, 0x9745, 0x27e8, 0x9fe8, 0x92d0, 0x5099, 0x4098, 0x32e4, 0x3c48, 0x8001, 0x30d8, 0x2cce, 0xbdcc, 0x2468, 0x34d0 }, 16, 0x00090540, 1},
-	{{0xc298, 0x94c6, 0x75d2, 0x6c10, 0x94c7, 0x6568, 0xc0ff, 0x92c2, 0x6d10, 0x32e4, 0x3d8c, 0x8001, 0x92c3, 0xc2ff, 0x2768, 0x75d6 }, 16, 0x00090560, 1},
-	{{0x92c2, 0x6d10, 0x32e4, 0x3d74, 0x8001, 0x92c3, 0xc2ff, 0x7551, 0x6561, 0x6569, 0x2418, 0x80e6, 0x96c2, 0x3000, 0x2000, 0x8100 }, 16, 0x00090580, 1},
-	{{0x2568, 0x7452, 0x8007, 0x8806, 0x6464, 0x7452, 0x2aff, 0x9edb, 0x3140, 0x3477, 0x8171, 0x2568, 0x3100, 0x2000, 0x8080, 0xd441 }, 16, 0x000905a0, 1},
-	{{0x31ee, 0x9f00, 0x98c7, 0x3160, 0x3218, 0x80b1, 0x6764, 0x2aff, 0x9eb9, 0x7456, 0x6d12, 0x2aff, 0x9eb1, 0x34d2, 0x7452, 0x2aff }, 16, 0x000905c0, 1},
-	{{0x9ea9, 0x35d0, 0xf1c2, 0x3650, 0x3453, 0xf1c3, 0x2aff, 0x9e9b, 0x6cc4, 0x3650, 0x3453, 0xf1c4, 0x2aff, 0x9e8f, 0x6cc4, 0x3650 }, 16, 0x000905e0, 1},
-	{{0x3453, 0xf1c5, 0x2aff, 0x9e83, 0x6cc4, 0x35d0, 0x3453, 0xf1c6, 0x2aff, 0x9e77, 0x6cd9, 0x35d0, 0x3452, 0x3100, 0x2000, 0x8200 }, 16, 0x00090600, 1},
-	{{0x2aff, 0x9e67, 0x6dd9, 0x2468, 0x2f9d, 0x34d0, 0xc298, 0x94c6, 0x75d2, 0x6c10, 0x94c7, 0x6568, 0xc0ff, 0x92c2, 0x6d10, 0x32e4 }, 16, 0x00090620, 1},
-	{{0x3d8c, 0x8001, 0x92c3, 0xc2ff, 0x27e8, 0x75d7, 0x92c2, 0x6d10, 0x32e4, 0x3d74, 0x8001, 0x92c3, 0xc2ff, 0x2768, 0x24e1, 0x3000 }, 16, 0x00090640, 1},
-	{{0x2000, 0x8100, 0x800c, 0x6cd1, 0x6764, 0x7f78, 0x8808, 0xd41e, 0x7f78, 0xd416, 0x2aff, 0x9e13, 0x6461, 0x3100, 0x2000, 0x8100 }, 16, 0x00090660, 1},
-	{{0x6c11, 0x3024, 0x3f50, 0x8009, 0xe778, 0x2d90, 0x2c10, 0x3210, 0x2000, 0x8000, 0x2900, 0x8400, 0x280a, 0x8408, 0x0a80, 0x840c }, 16, 0x00090680, 1},
-	{{0xea39, 0x0380, 0x8410, 0x1000, 0x3d50, 0x800a, 0x0380, 0x8420, 0x0a80, 0x8408, 0x0390, 0x0106, 0x3d50, 0x800a, 0x2704, 0x8100 }, 16, 0x000906a0, 1},
-	{{0xb241, 0x0380, 0x8414, 0x0080, 0x8418, 0x0180, 0x841c, 0x92c8, 0x439a, 0x2d10, 0x30e0, 0x2148, 0x80fa, 0x2100, 0x8040, 0x0380 }, 16, 0x000906c0, 1},
-	{{0x8428, 0x0380, 0x8424, 0x0080, 0x842c, 0x0280, 0x8430, 0x0180, 0x843c, 0x9f70, 0x0280, 0x8440, 0x2bff, 0x9da3, 0x11d9, 0xeee8 }, 16, 0x000906e0, 1},
-	{{0x019e, 0xf0c7, 0x1111, 0xcf40, 0x411e, 0x5109, 0x0116, 0xc94f, 0xee46, 0x499e, 0x4096, 0xb1b9, 0x3cd1, 0x1066, 0x9ff4, 0x0c00 }, 16, 0x00090700, 1},
-	{{0xa010, 0x0186, 0x804c, 0x80a0, 0xee70, 0xb1ba, 0x7cc9, 0x0186, 0x8060, 0x0006, 0x3d40, 0x800a, 0x0206, 0x3d4c, 0x800a, 0x2aff }, 16, 0x00090720, 1},
-	{{0x9d49, 0x6c32, 0x2d52, 0x1186, 0x8060, 0x0286, 0x8044, 0x0006, 0x3d44, 0x800a, 0x0406, 0x3d48, 0x800a, 0x2c00, 0x3300, 0x2000 }, 16, 0x00090740, 1},
-	{{0x8100, 0x2aff, 0x9d25, 0x6c99, 0x1086, 0x805c, 0x2c32, 0x1186, 0x8044, 0xb075, 0x0606, 0x3d54, 0x800a, 0x30f6, 0xc947, 0x843b }, 16, 0x00090760, 1},
-	{{0x24e8, 0xc298, 0x94c6, 0x75d2, 0x6c10, 0x94c7, 0x6568, 0xc0ff, 0x92c2, 0x6d10, 0x32e4, 0x3d8c, 0x8001, 0x92c3, 0xc2ff, 0x2768 }, 16, 0x00090780, 1},
-	{{0x75d6, 0x92c2, 0x6d10, 0x32e4, 0x3d74, 0x8001, 0x92c3, 0xc2ff, 0x3651, 0xc947, 0x8806, 0x6661, 0xc481, 0x3000, 0x2010, 0xa000 }, 16, 0x000907a0, 1},
-	{{0x6c7d, 0x8818, 0xb476, 0xb08c, 0x7c51, 0xb075, 0xb08d, 0x7c51, 0xb076, 0xb08a, 0x7c51, 0x0086, 0x8044, 0x2c90, 0xc081, 0xb28e }, 16, 0x000907c0, 1},
-	{{0x7d4e, 0xb277, 0xb28f, 0x7d4e, 0x0286, 0x8020, 0x1201, 0x8010, 0x7d51, 0x0286, 0x8024, 0x1201, 0x8012, 0x7d51, 0x0286, 0x8028 }, 16, 0x000907e0, 1},
-	{{0x1201, 0x8014, 0x7d4e, 0x0286, 0x802c, 0x1201, 0x8016, 0x7d4e, 0x0286, 0x8030, 0x1201, 0x8018, 0x7d51, 0x0286, 0x8034, 0x1201 }, 16, 0x00090800, 1},
-	{{0x801c, 0x7d4e, 0x0286, 0x8038, 0x1201, 0x801e, 0x7d4e, 0x0286, 0x803c, 0x1201, 0x801a, 0x7d51, 0x0286, 0x8040, 0x1017, 0x0086 }, 16, 0x00090820, 1},
-	{{0x8098, 0x9744, 0x7c51, 0x2e08, 0x8048, 0x0086, 0x8058, 0x92c8, 0x4198, 0x3410, 0x2029, 0xae00, 0xb0f5, 0x7270, 0x8007, 0x6e10 }, 16, 0x00090840, 1},
-	{{0x6c7d, 0x3500, 0x2000, 0x8100, 0xb1f6, 0x72f1, 0x800c, 0xb475, 0x3500, 0x2014, 0xa800, 0x6d7d, 0xb4f7, 0x2668, 0x3000, 0x2005 }, 16, 0x00090860, 1},
-	{{0x8a00, 0x92c3, 0x6e10, 0x8406, 0xb576, 0x6c7d, 0x1586, 0x8020, 0x26e8, 0x3100, 0x2005, 0x8a00, 0x92c3, 0x6e90, 0x8406, 0xb477 }, 16, 0x00090880, 1},
-	{{0x6d7d, 0x3410, 0x2029, 0xae00, 0x1086, 0x8034, 0x3270, 0x0586, 0x8020, 0x8007, 0x6e10, 0x6c7d, 0x3500, 0x2000, 0x8100, 0x1186 }, 16, 0x000908a0, 1},
-	{{0x8040, 0x32f1, 0x0486, 0x8034, 0x800b, 0x3500, 0x2014, 0xa800, 0x6d7d, 0x1486, 0x8038, 0x2668, 0x0586, 0x8040, 0x840e, 0x98c7 }, 16, 0x000908c0, 1},
-	{{0x3000, 0x2005, 0x8a00, 0x6e10, 0x6c7d, 0x1586, 0x803c, 0x26e8, 0x0486, 0x8038, 0x840e, 0x98c7, 0x3100, 0x2005, 0x8a00, 0x6e90 }, 16, 0x000908e0, 1},
-	{{0x6d7d, 0x3410, 0x2029, 0xae00, 0x1086, 0x8024, 0x3270, 0x0586, 0x803c, 0x8007, 0x6e10, 0x6c7d, 0x3500, 0x2000, 0x8100, 0x1186 }, 16, 0x00090900, 1},
-	{{0x8028, 0x32f1, 0x0486, 0x8024, 0x800b, 0x3500, 0x2004, 0x8800, 0x6d7d, 0x1486, 0x802c, 0x2668, 0x0586, 0x8028, 0x840e, 0x98c7 }, 16, 0x00090920, 1},
-	{{0x3000, 0x2005, 0x8a00, 0x6e10, 0x6c7d, 0x1586, 0x8030, 0x26e8, 0x0486, 0x802c, 0x840e, 0x98c7, 0x3100, 0x2005, 0x8a00, 0x6e90 }, 16, 0x00090940, 1},
-	{{0x6d7d, 0x1486, 0x8044, 0x2668, 0x0586, 0x8030, 0x840e, 0x98c7, 0x3000, 0x201e, 0xbc00, 0x6e10, 0x6c7d, 0x3510, 0x2029, 0xae00 }, 16, 0x00090960, 1},
-	{{0x1186, 0x8058, 0x32f1, 0x0486, 0x8044, 0x8007, 0x6e90, 0x6d7d, 0x1196, 0x0586, 0x8058, 0x2aff, 0x9b95, 0xb0f7, 0x3550, 0x1196 }, 16, 0x00090980, 1},
-	{{0x1086, 0x8020, 0x2aff, 0x9b87, 0x0286, 0x8064, 0x3550, 0x1196, 0x1086, 0x802c, 0x2aff, 0x9b77, 0x0286, 0x8068, 0x3550, 0x1196 }, 16, 0x000909a0, 1},
-	{{0x1086, 0x8030, 0x2aff, 0x9b67, 0x0286, 0x8070, 0x3550, 0x1196, 0x1086, 0x8038, 0x2aff, 0x9b57, 0x0286, 0x8074, 0x3550, 0x1196 }, 16, 0x000909c0, 1},
-	{{0x1086, 0x803c, 0x2aff, 0x9b47, 0x0286, 0x8078, 0x2c90, 0x3200, 0x2000, 0x8100, 0xb3f6, 0x25e8, 0x3400, 0x2000, 0x8001, 0x0286 }, 16, 0x000909e0, 1},
-	{{0x8084, 0x94c1, 0xc2ff, 0x6d10, 0x32e4, 0x3d74, 0x8001, 0x3454, 0x0086, 0x807c, 0x24e1, 0x1386, 0x8040, 0x25e8, 0x3600, 0x2000 }, 16, 0x00090a00, 1},
-	{{0x8100, 0x2c86, 0x3000, 0x2000, 0x8001, 0x2c90, 0x0186, 0x806c, 0x32e4, 0x3d74, 0x8001, 0x94c1, 0xc2ff, 0x6d10, 0x64e1, 0x6c06 }, 16, 0x00090a20, 1},
-	{{0x2e08, 0x80a8, 0x2aff, 0x9c47, 0x0086, 0x8080, 0xf1c8, 0x24e8, 0xf08f, 0x1286, 0x8044, 0xb034, 0x841a, 0x0286, 0x8088, 0x3cc2 }, 16, 0x00090a40, 1},
-	{{0xd4a3, 0x8011, 0xc941, 0x3800, 0x3d34, 0x800a, 0x90c0, 0xe918, 0x4e91, 0x3024, 0x3f50, 0x8009, 0x6c10, 0x9744, 0x6c10, 0x92d0 }, 16, 0x00090a60, 1},
-	{{0x5198, 0xd441, 0x9f71, 0x36d0, 0x0106, 0x3d58, 0x800a, 0x2d7c, 0x3cf8, 0x0006, 0x3d5c, 0x800a, 0x3655, 0x3860, 0x264c, 0x8009 }, 16, 0x00090a80, 1},
-	{{0x2c7d, 0x32e0, 0x3fff, 0x80ff, 0x38c8, 0x9218, 0x2c31, 0xdd04, 0x3841, 0x34d2, 0xca40, 0xc940, 0xa2c2, 0xa0c1, 0x2aff, 0x99cb }, 16, 0x00090aa0, 1},
-	{{0x6c32, 0x9f70, 0x6c52, 0xfbc3, 0x83b2, 0xece9, 0x83bb, 0xf1c4, 0x64ea, 0x841d, 0x9b41, 0x2b03, 0x8004, 0x515c, 0x6174, 0x6d74 }, 16, 0x00090ac0, 1},
-	{{0x74c2, 0x7cc8, 0x64e5, 0x92d0, 0x7cc8, 0x74d9, 0x415b, 0x9f71, 0x2bff, 0x99ab, 0xeee8, 0xb8f3, 0xb2b2, 0x1090, 0x8002, 0x270a }, 16, 0x00090ae0, 1},
-	{{0x8028, 0x3119, 0x8100, 0x351a, 0x8100, 0x3161, 0xe7ea, 0xefe9, 0x8014, 0xfad1, 0xb8f4, 0xb032, 0x2080, 0x8000, 0xb004, 0xb005 }, 16, 0x00090b00, 1},
-	{{0x6c10, 0xb035, 0xb0b2, 0x6469, 0x840f, 0xb0b4, 0x6469, 0x8009, 0xd022, 0x2718, 0x827a, 0xe8e9, 0x1b86, 0x84b0, 0xc56e, 0x1005 }, 16, 0x00090b20, 1},
-	{{0xa004, 0x0006, 0x3d60, 0x800a, 0x90c0, 0xf7d2, 0x27ea, 0xd447, 0x2e0c, 0x84c0, 0x109c, 0x0002, 0x3d60, 0x800a, 0x128c, 0x1186 }, 16, 0x00090b40, 1},
-	{{0x84bc, 0x0202, 0x3d50, 0x800a, 0x843c, 0x1800, 0x3d50, 0x800a, 0x2b03, 0x8006, 0x9b47, 0x1258, 0x5393, 0x22bc, 0x3653, 0x7de7 }, 16, 0x00090b60, 1},
-	{{0x2c41, 0x459b, 0x2c20, 0x1d86, 0x84b4, 0x3aca, 0x9647, 0xed8b, 0xd4c2, 0x94c2, 0x2203, 0x8012, 0x6cb9, 0x94d0, 0x2d00, 0x8410 }, 16, 0x00090b80, 1},
-	{{0xebec, 0xeb3d, 0x2d10, 0x1000, 0x3d50, 0x800a, 0x3c67, 0x0086, 0x84c0, 0x2465, 0x0186, 0x84bc, 0x0106, 0x3d50, 0x800a, 0x2500 }, 16, 0x00090ba0, 1},
-	{{0x8051, 0xc3a8, 0x0186, 0x84c4, 0x0b86, 0x84b0, 0x3860, 0x23bc, 0x8009, 0x7653, 0x7e43, 0xcb44, 0x90c0, 0xeb18, 0x5493, 0x707c }, 16, 0x00090bc0, 1},
-	{{0x8054, 0x94c2, 0x3702, 0x8001, 0x39e1, 0xd89c, 0x76d3, 0x7ec3, 0xcb45, 0x39ec, 0x9fff, 0xeb18, 0x5593, 0x72f8, 0x8037, 0xd91d }, 16, 0x00090be0, 1},
-	{{0x2cb8, 0xd818, 0x3bed, 0x9fff, 0x32e4, 0x6c32, 0x801a, 0xb3d9, 0xf947, 0xfa48, 0x3244, 0x2000, 0x8009, 0xf349, 0x3c49, 0xf9c7 }, 16, 0x00090c00, 1},
-	{{0xfac8, 0x8806, 0xf3c9, 0x6c10, 0x646a, 0x92c2, 0xd5c0, 0x8812, 0xf344, 0x76d3, 0x3175, 0x6dc9, 0x859a, 0x75c3, 0x6c10, 0xf044 }, 16, 0x00090c20, 1},
-	{{0xc566, 0x90c0, 0x90c0, 0x27ea, 0xf0c4, 0xf046, 0x845a, 0xebe9, 0x125b, 0x1086, 0x84e4, 0x246a, 0x6566, 0x840f, 0xd89a, 0x1086 }, 16, 0x00090c40, 1},
-	{{0x84d0, 0x70f0, 0x8433, 0x881d, 0xf947, 0x1086, 0x84cc, 0x2aff, 0x9819, 0x1186, 0x84d4, 0xd89a, 0x30f0, 0x0086, 0x84cc, 0x8412 }, 16, 0x00090c60, 1},
-	{{0xf9c7, 0x2000, 0x8040, 0x0186, 0x84d0, 0x8808, 0x0186, 0x84cc, 0xc081, 0x0086, 0x84e4, 0x3be1, 0x1086, 0x84e4, 0x27ea, 0x7861 }, 16, 0x00090c80, 1},
-	{{0x81b0, 0x0086, 0x84e4, 0x2c10, 0x1186, 0x84d0, 0x3571, 0xc1a8, 0x2400, 0x8051, 0x3860, 0x212c, 0x8009, 0x75d1, 0x7dc3, 0xcb43 }, 16, 0x00090ca0, 1},
-	{{0x90c0, 0xeb18, 0x5313, 0x7173, 0x8044, 0x94c2, 0x3300, 0x8001, 0x78e1, 0x7651, 0x7e43, 0xcb44, 0x90c0, 0xeb18, 0x5413, 0x7272 }, 16, 0x00090cc0, 1},
-	{{0x802b, 0x3263, 0x6cac, 0x8016, 0xb6d9, 0x2c28, 0xf947, 0x3244, 0x2000, 0x8009, 0xfa48, 0xf9c7, 0x8806, 0xfac8, 0x6c10, 0x246a }, 16, 0x00090ce0, 1},
-	{{0x7c49, 0x8405, 0xd740, 0x8812, 0xf643, 0x7651, 0x3074, 0x6cc0, 0x85aa, 0x74c1, 0x6c10, 0xf043, 0xbbf4, 0xf0c3, 0xf7c4, 0xf045 }, 16, 0x00090d00, 1},
-	{{0x3eca, 0x93d1, 0xb39c, 0x3173, 0xf6c3, 0x8408, 0x3ccc, 0x93d1, 0xb21c, 0xb39d, 0x74f4, 0x70f3, 0x8405, 0xb41d, 0xb8b2, 0x0c08 }, 16, 0x00090d20, 1},
-	{{0xa040, 0x8047, 0xb0b5, 0x6469, 0x8441, 0x0c08, 0xa080, 0x801c, 0xb09b, 0x3572, 0xc181, 0x3170, 0xc088, 0x842f, 0xf947, 0xfa48 }, 16, 0x00090d40, 1},
-	{{0x32e4, 0x3a8c, 0x8001, 0xf249, 0x8817, 0x30f0, 0xc181, 0x841b, 0xc088, 0xf947, 0xfa48, 0x32e4, 0x3a8c, 0x8001, 0xf249, 0xc081 }, 16, 0x00090d60, 1},
-	{{0xb035, 0xf9c7, 0xfac8, 0xf2c9, 0xb0b4, 0x2469, 0x0786, 0x80a0, 0x840e, 0x0686, 0x80a4, 0x8814, 0x3800, 0x20a4, 0x8008, 0xd022 }, 16, 0x00090d80, 1},
-	{{0x840d, 0x3800, 0x20a8, 0x8008, 0x90c0, 0x4210, 0xb0b2, 0x2d10, 0x2d90, 0x2e90, 0x2f10, 0x0c00, 0xa007, 0x845b, 0x2e0b, 0x8048 }, 16, 0x00090da0, 1},
-	{{0x2aff, 0x9cbb, 0xe8eb, 0x6469, 0x841b, 0xf8d1, 0x90c0, 0xe8a9, 0x2518, 0x81e8, 0xf0d2, 0x7c41, 0x32e4, 0x3c84, 0x8001, 0xf041 }, 16, 0x00090dc0, 1},
-	{{0x89d9, 0x2aff, 0x9c99, 0xe8eb, 0x2aff, 0x9c9f, 0xfa48, 0xf1d2, 0x24ea, 0xfac8, 0x2718, 0x81c4, 0x9b41, 0x2b03, 0x8004, 0x515f }, 16, 0x00090de0, 1},
-	{{0x6174, 0x6d74, 0x74c2, 0x7cc8, 0x64e5, 0x92d0, 0x7cc8, 0x74d9, 0x415a, 0x89a7, 0xb4f5, 0xf1c6, 0x3271, 0x1786, 0x8088, 0x802a }, 16, 0x00090e00, 1},
-	{{0xcc57, 0x0c00, 0xa001, 0x8023, 0xf0c6, 0x2c20, 0x1186, 0x806c, 0x2aff, 0x9657, 0x6464, 0x3650, 0x1686, 0x8068, 0xc381, 0x1586 }, 16, 0x00090e20, 1},
-	{{0x8064, 0x884e, 0x0686, 0x8084, 0x1786, 0x8024, 0x73f1, 0x843f, 0x0c00, 0xa004, 0x8039, 0xf0c6, 0x3410, 0x203c, 0x8800, 0x2c7c }, 16, 0x00090e40, 1},
-	{{0x1186, 0x8028, 0x2c37, 0x3300, 0x2000, 0x8100, 0x2aff, 0x961b, 0x6cb9, 0x3650, 0x1686, 0x8074, 0x3018, 0x2012, 0x9c00, 0x2c7c }, 16, 0x00090e60, 1},
-	{{0xc384, 0x0686, 0x8084, 0x880a, 0x1586, 0x8070, 0x2e10, 0xc281, 0xb0b4, 0x2469, 0x6f90, 0x842b, 0xb8b2, 0x0c08, 0xa008, 0x8023 }, 16, 0x00090e80, 1},
-	{{0x0806, 0x3d3c, 0x800a, 0x1086, 0x8058, 0x1180, 0x80a0, 0x70f0, 0x8413, 0x2fb1, 0x1086, 0x8044, 0x6464, 0x7077, 0x8806, 0xd3d0 }, 16, 0x00090ea0, 1},
-	{{0x6f90, 0x1086, 0x8044, 0x2e08, 0x8048, 0x2aff, 0x9bb1, 0x6e40, 0x2c40, 0xf1c5, 0x2fc3, 0x1086, 0x8034, 0xd4c7, 0x70f0, 0x842b }, 16, 0x00090ec0, 1},
-	{{0xb8b2, 0x2c11, 0x0c08, 0xa002, 0x8021, 0x2aff, 0x959d, 0x2464, 0x1186, 0x8080, 0x1686, 0x807c, 0xd7c0, 0xc283, 0x0686, 0x8084 }, 16, 0x00090ee0, 1},
-	{{0x1586, 0x8078, 0x0903, 0xa002, 0xd121, 0x840d, 0x1086, 0x8084, 0x8818, 0x0086, 0x8090, 0x1086, 0x8088, 0x7077, 0x800c, 0x94c2 }, 16, 0x00090f00, 1},
-	{{0x0586, 0x8090, 0x0686, 0x8090, 0x3000, 0x2000, 0x8100, 0x1186, 0x8090, 0x2c31, 0x0786, 0x808c, 0x0086, 0x8094, 0xb0b4, 0x2469 }, 16, 0x00090f20, 1},
-	{{0x3800, 0x20a6, 0x8008, 0x8405, 0x880f, 0xd022, 0x840d, 0x3800, 0x20aa, 0x8008, 0x90c0, 0x4310, 0x1686, 0x808c, 0xc56f, 0x1105 }, 16, 0x00090f40, 1},
-	{{0xa004, 0x90c0, 0x90c0, 0xf1d2, 0x24ea, 0xcd51, 0x8445, 0x2aff, 0x9519, 0x3456, 0x135f, 0x1186, 0x8090, 0x3550, 0xcc59, 0x2aff }, 16, 0x00090f60, 1},
-	{{0x9509, 0x3451, 0x1186, 0x8094, 0x2c52, 0xfa48, 0x2aff, 0x9afb, 0xcc50, 0x3550, 0xcd59, 0x2075, 0x38e1, 0xfac8, 0x2c75, 0x24ea }, 16, 0x00090f80, 1},
-	{{0xcd51, 0x7440, 0x7c48, 0x6465, 0x7c48, 0x7458, 0x81c2, 0x405a, 0xc567, 0xcc59, 0x0186, 0x8088, 0x27e8, 0x9fd8, 0x3024, 0x3f50 }, 16, 0x00090fa0, 1},
-	{{0x8009, 0xe7e8, 0x3124, 0x3f30, 0x8009, 0x83fb, 0x2f90, 0xf1c7, 0x64e9, 0x8409, 0xf0c8, 0x8860, 0x6466, 0xf0c8, 0x2469, 0xc3fe }, 16, 0x00090fc0, 1},
-	{{0x8409, 0x64e6, 0x8852, 0x7451, 0xd110, 0x2564, 0xd311, 0x2764, 0xdd03, 0xdf03, 0x2e7d, 0x3208, 0x2000, 0x8000, 0xd496, 0x28f0 }, 16, 0x00090fe0, 1},
-	{{0xd416, 0x2030, 0x7651, 0x6c7c, 0x7272, 0x94c2, 0x7c62, 0x7ce2, 0x70c0, 0xd819, 0x3204, 0x31e0, 0x8009, 0x92c2, 0xc781, 0x2cbf }, 16, 0x00091000, 1},
-	{{0xd730, 0x840e, 0xd810, 0x78e1, 0xd419, 0x7841, 0x880a, 0x7440, 0x3324, 0x3eb0, 0x8009, 0x3124, 0x3f50, 0x8009, 0x8389, 0x24e9 }, 16, 0x00091020, 1},
-	{{0x37d1, 0xe748, 0x8406, 0xeeea, 0xc781, 0x27e8, 0xf0ca, 0x94c7, 0x6466, 0x67e6, 0x7077, 0x8407, 0xf7ca, 0x67e6, 0xf1c9, 0x7451 }, 16, 0x00091040, 1},
-	{{0x6466, 0x7077, 0x8407, 0x77d1, 0x67e6, 0x2d10, 0xd197, 0x25e4, 0xc190, 0x2f39, 0xf0ca, 0x2e7c, 0x6466, 0xd79e, 0x34f7, 0xd41e }, 16, 0x00091060, 1},
-	{{0x3244, 0x2000, 0x8009, 0x7470, 0xf1ca, 0x24e8, 0x2464, 0xf042, 0x8005, 0xf042, 0x34f7, 0xf7c9, 0x7457, 0x6466, 0xd41e, 0x3244 }, 16, 0x00091080, 1},
-	{{0x2000, 0x8009, 0x7470, 0x27e8, 0x2464, 0xc840, 0x8008, 0xf841, 0xc840, 0xf841, 0xf0c2, 0x009e, 0xf0c1, 0x3024, 0x3f50, 0x8009 }, 16, 0x000910a0, 1},
-	{{0x0096, 0xe768, 0x2bff, 0x9f01, 0xe750, 0xf0cc, 0x2466, 0xeeea, 0x3610, 0x8fff, 0x801b, 0xf0cb, 0x6466, 0x3610, 0x8fff, 0x8011 }, 16, 0x000910c0, 1},
-	{{0xf0cb, 0x3c4c, 0xf1cc, 0x3ccc, 0xc840, 0xf14c, 0xf84b, 0xf0cc, 0x6469, 0x8413, 0xf0cb, 0x2469, 0x2c10, 0xe838, 0x8409, 0xf044 }, 16, 0x000910e0, 1},
-	{{0x8820, 0xf843, 0xf1cc, 0xf0cb, 0xf142, 0x2aff, 0x9ec1, 0xf041, 0x34d0, 0xf2cc, 0xf0cb, 0x27ea, 0x9ff0, 0xf242, 0x8320, 0xf041 }, 16, 0x00091100, 1},
-	{{0xf0c4, 0x009e, 0xf0c3, 0x3024, 0x3f50, 0x8009, 0x0096, 0xe770, 0x3550, 0x3451, 0xe750, 0x3d4e, 0x3c4e, 0xf4c8, 0x3e4e, 0xcc56 }, 16, 0x00091120, 1},
-	{{0xf448, 0x05fc, 0x9fe0, 0x20f6, 0xf6c7, 0x2cf6, 0x3f4e, 0xf244, 0x36d1, 0xf043, 0x03fc, 0x9ff0, 0x2275, 0x01fc, 0x9ff4, 0x2e75 }, 16, 0x00091140, 1},
-	{{0x2174, 0xf647, 0x2d74, 0xcd57, 0x2cc8, 0x07fc, 0x9fe4, 0x2077, 0x7cee, 0x2c77, 0x3cc2, 0xcd5f, 0x2c41, 0xf142, 0x3c6e, 0xcc5e }, 16, 0x00091160, 1},
-	{{0x7c42, 0xc840, 0xf0c2, 0x009a, 0xf841, 0xf0c1, 0x0092, 0xe770, 0x9f71, 0x3550, 0x3451, 0xe748, 0x3c4e, 0x7d4e, 0xf041, 0x01fc }, 16, 0x00091180, 1},
-	{{0x9ffc, 0x2274, 0xf242, 0x2e74, 0x03fc, 0x9ff8, 0x2075, 0xe768, 0x6c75, 0x6c40, 0x7c6e, 0x9f70, 0x7c42, 0x3164, 0x2ce4, 0x8008 }, 16, 0x000911a0, 1},
-	{{0x3109, 0x2000, 0x8000, 0xe748, 0xd4c0, 0xf142, 0x83ee, 0xf0c2, 0xe768, 0x9f71, 0x3104, 0x31ba, 0x8009, 0x90c0, 0x90c0, 0x90c0 }, 16, 0x000911c0, 1},
-	{{0x1005, 0xa03b, 0x90c0, 0x2161, 0x8000, 0x98c0, 0xd110, 0xd210, 0x6466, 0xf5c1, 0x35d1, 0x6469, 0x98c0, 0x7941, 0x6664, 0x2b03 }, 16, 0x000911e0, 1},
-	{{0x8022, 0x96c2, 0x3104, 0x3232, 0x8009, 0x98c0, 0x35fa, 0x9ffe, 0x7e61, 0x9346, 0x94c0, 0xd41a, 0x7a47, 0x3810, 0xa00d, 0x6039 }, 16, 0x00091200, 1},
-	{{0x60b1, 0x6970, 0x3400, 0xa844, 0x6058, 0x3400, 0xa840, 0x6cd0, 0x6031, 0x94c0, 0x9f70, 0xd41c, 0xc565, 0x90c0, 0x94c0, 0x9620 }, 16, 0x00091220, 1},
-	{{0x9720, 0x96c0, 0x5d98, 0x2a03, 0x80b2, 0x1998, 0x1005, 0xa03f, 0x1a98, 0x1105, 0xa004, 0x5c98, 0x3420, 0xa000, 0x5318, 0x3800 }, 16, 0x00091240, 1},
-	{{0xa101, 0x509a, 0xefec, 0x79e1, 0x3640, 0xa000, 0x529a, 0x9a43, 0x549a, 0x569a, 0x3420, 0xa000, 0x5092, 0x3800, 0xa008, 0x6764 }, 16, 0x00091260, 1},
-	{{0x6464, 0x5159, 0x139c, 0x7ce2, 0x559c, 0x579c, 0x3420, 0xa000, 0x519c, 0x3a00, 0xa00f, 0x6e68, 0x6ee9, 0x6f6a, 0x6feb, 0x3a00 }, 16, 0x00091280, 1},
-	{{0xa42f, 0x6e60, 0x6ee1, 0x6f62, 0x6de8, 0x3a00, 0xa42f, 0x7e70, 0x7ef0, 0x6fe3, 0x6de0, 0x3a00, 0xa00f, 0x6211, 0x7f70, 0x7ff0 }, 16, 0x000912a0, 1},
-	{{0x7df0, 0x3a00, 0xa42f, 0x629d, 0x6315, 0x639f, 0x6191, 0x3800, 0xb8cc, 0x6ed5, 0x6fdf, 0xc543, 0x3600, 0xa844, 0x6fdb, 0xc341 }, 16, 0x000912c0, 1},
-	{{0x3820, 0xa844, 0x6d4f, 0x5159, 0xc147, 0x3800, 0xa841, 0x6fdc, 0x7ce2, 0x7d43, 0x3a00, 0xa00f, 0x6e68, 0x6ee9, 0x6f6a, 0x6feb }, 16, 0x000912e0, 1},
-	{{0x3a00, 0xa42f, 0x6e60, 0x6ee1, 0x6f62, 0x6de8, 0x3a00, 0xa42f, 0x7e70, 0x7ef0, 0x6fe3, 0x6de0, 0x3a00, 0xa00f, 0x6211, 0x7f70 }, 16, 0x00091300, 1},
-	{{0x7ff0, 0x7df0, 0x3a00, 0xa42f, 0x629d, 0x6315, 0x639f, 0x6191, 0x3a00, 0xb8ce, 0x6ed5, 0x6fdf, 0xc543, 0x6565, 0x3830, 0xa844 }, 16, 0x00091320, 1},
-	{{0x6fdb, 0xc341, 0x425d, 0x3820, 0xa844, 0x6d4f, 0x5159, 0xc147, 0x3800, 0xa841, 0x6fdc, 0x7ce2, 0x7d43, 0x3420, 0xa000, 0xecef }, 16, 0x00091340, 1},
-	{{0x3400, 0xa004, 0x6565, 0x3420, 0xa000, 0x425d, 0x94c0, 0x4394, 0xb561, 0x3640, 0xa000, 0xb762, 0xb163, 0x94c0, 0x9621, 0x9721 }, 16, 0x00091360, 1},
-	{{0x94c0, 0x9f70, 0xf3c1, 0xc563, 0x94c0, 0x9620, 0x9720, 0x96c0, 0x5d98, 0x2a03, 0x80b2, 0x1998, 0x1005, 0xa03f, 0x1a98, 0x1105 }, 16, 0x00091380, 1},
-	{{0xa004, 0x5c98, 0x3420, 0xa000, 0x5318, 0x3800, 0xa101, 0x509a, 0xefec, 0x79e1, 0x3640, 0xa000, 0x529a, 0x9a43, 0x549a, 0x569a }, 16, 0x000913a0, 1},
-	{{0x3420, 0xa000, 0x5092, 0x3800, 0xa008, 0x6764, 0x6464, 0x5199, 0x139c, 0x7ce2, 0x559c, 0x579c, 0x3420, 0xa000, 0x519c, 0x3a00 }, 16, 0x000913c0, 1},
-	{{0xa00f, 0x6e68, 0x6ee9, 0x6f6a, 0x6feb, 0x3a00, 0xa42f, 0x6e60, 0x6ee1, 0x6f62, 0x6de8, 0x3a00, 0xa42f, 0x7e70, 0x7ef0, 0x6fe3 }, 16, 0x000913e0, 1},
-	{{0x6de0, 0x3a00, 0xa00f, 0x6211, 0x7f70, 0x7ff0, 0x7df0, 0x3a00, 0xa42f, 0x629d, 0x6315, 0x639f, 0x6191, 0x3800, 0xb8cc, 0x6ed5 }, 16, 0x00091400, 1},
-	{{0x6fdf, 0xc543, 0x3600, 0xa844, 0x6fdb, 0xc341, 0x3820, 0xa840, 0x6fcf, 0x5199, 0xc147, 0x3820, 0xa000, 0x7fc4, 0x7ce2, 0xc247 }, 16, 0x00091420, 1},
-	{{0x3a00, 0xa00f, 0x6e68, 0x6ee9, 0x6f6a, 0x6feb, 0x3a00, 0xa42f, 0x6e60, 0x6ee1, 0x6f62, 0x6de8, 0x3a00, 0xa42f, 0x7e70, 0x7ef0 }, 16, 0x00091440, 1},
-	{{0x6fe3, 0x6de0, 0x3a00, 0xa00f, 0x6211, 0x7f70, 0x7ff0, 0x7df0, 0x3a00, 0xa42f, 0x629d, 0x6315, 0x639f, 0x6191, 0x3a00, 0xb8ce }, 16, 0x00091460, 1},
-	{{0x6ed5, 0x6fdf, 0xc543, 0x7d46, 0x3810, 0xa845, 0x6fdb, 0xc341, 0x6565, 0x3820, 0xa840, 0x6fcf, 0x5199, 0xc147, 0x3a60, 0xa000 }, 16, 0x00091480, 1},
-	{{0x7fc4, 0x7ce2, 0xc247, 0x42dd, 0x3620, 0xa008, 0xecef, 0x7d46, 0x3400, 0xa004, 0x6565, 0x3420, 0xa000, 0x42dd, 0x94c0, 0x4394 }, 16, 0x000914a0, 1},
-	{{0xb561, 0x3640, 0xa000, 0xb762, 0xb163, 0x94c0, 0x9621, 0x9721, 0x94c0, 0x9f70, 0xf3c1, 0xc563, 0x3860, 0x2880, 0x8009, 0xc940 }, 16, 0x000914c0, 1},
-	{{0x90c0, 0xa9c1, 0x2880, 0x9f71, 0x9f70, 0x4811, 0xc840, 0x3960, 0x2880, 0x8009, 0xe8fe, 0x3a00, 0x3e10, 0x800a, 0xe918, 0x1991 }, 16, 0x000914e0, 1},
-	{{0xe81a, 0x5090, 0x6469, 0x8009, 0x2880, 0x90c0, 0x4811, 0x9f71, 0x31e4, 0x3c8a, 0x8001, 0x3124, 0x3f30, 0x8009, 0x83fb, 0x2c90 }, 16, 0x00091500, 1},
-	{{0x3b00, 0x361e, 0x800a, 0x0b02, 0x3e28, 0x800a, 0xeb4e, 0x0b02, 0x3e2c, 0x800a, 0xeb44, 0x2b08, 0x8082, 0x0802, 0x3e38, 0x800a }, 16, 0x00091520, 1},
-	{{0xe84e, 0x0802, 0x3e3c, 0x800a, 0xe844, 0x2809, 0x8082, 0x0902, 0x3e48, 0x800a, 0xe94e, 0x0902, 0x3e4c, 0x800a, 0x3401, 0x3eac }, 16, 0x00091540, 1},
-	{{0x800a, 0x33e1, 0x3dd8, 0x8009, 0x3001, 0x2018, 0x800a, 0xe944, 0x32e1, 0x3e98, 0x8009, 0x290a, 0x80e4, 0x0402, 0x3e10, 0x800a }, 16, 0x00091560, 1},
-	{{0x0002, 0x3e34, 0x800a, 0x30a1, 0x35ac, 0x8009, 0x0302, 0x3e24, 0x800a, 0x34a1, 0x366c, 0x8009, 0x3301, 0x2318, 0x800a, 0x0202 }, 16, 0x00091580, 1},
-	{{0x3e44, 0x800a, 0xe758, 0xc2a3, 0x0b02, 0x3e30, 0x800a, 0x0802, 0x3e40, 0x800a, 0x0902, 0x3e50, 0x800a, 0x0302, 0x3e6c, 0x800a }, 16, 0x000915a0, 1},
-	{{0x0a02, 0x3e70, 0x800a, 0x0402, 0x3e94, 0x800a, 0x0002, 0x3e98, 0x800a, 0x2aff, 0x9f07, 0x7451, 0x3961, 0x78c1, 0x656a, 0x81f5 }, 16, 0x000915c0, 1},
-	{{0x2c90, 0x2f10, 0x2d10, 0x3900, 0x3d68, 0x800a, 0x3001, 0x3eac, 0x800a, 0xc782, 0xeee9, 0x0100, 0x3ef4, 0x800a, 0x0100, 0x3ef0 }, 16, 0x000915e0, 1},
-	{{0x800a, 0x0002, 0x3ea0, 0x800a, 0x0002, 0x3ea8, 0x800a, 0x0002, 0x3e9c, 0x800a, 0x0002, 0x3ea4, 0x800a, 0x3f00, 0x3e10, 0x800a }, 16, 0x00091600, 1},
-	{{0x2c90, 0xc842, 0x0a86, 0x3a4c, 0x8009, 0x2000, 0x8054, 0xea18, 0xf041, 0xf243, 0xf944, 0xfa45, 0x2aff, 0x9ed9, 0xe8e9, 0xfac5 }, 16, 0x00091620, 1},
-	{{0xf2c3, 0x10d2, 0xf9c4, 0x3610, 0x8022, 0x8007, 0x8806, 0xc840, 0xe838, 0x2769, 0x0816, 0xf804, 0x8421, 0xe8f9, 0xa0f8, 0x290b }, 16, 0x00091640, 1},
-	{{0x8014, 0x0002, 0x3e9c, 0x800a, 0xf084, 0x0b02, 0x3ea0, 0x800a, 0x8824, 0x0000, 0x3ef0, 0x800a, 0xe8f9, 0xa0f8, 0x290b, 0x8014 }, 16, 0x00091660, 1},
-	{{0x0002, 0x3ea4, 0x800a, 0xf084, 0x0b02, 0x3ea8, 0x800a, 0x0000, 0x3ef4, 0x800a, 0xb891, 0xee44, 0x4816, 0x2aff, 0x9e53, 0x2e0e }, 16, 0x00091680, 1},
-	{{0x8050, 0x3be1, 0x3b41, 0xf9c4, 0x67ea, 0x2909, 0x8054, 0x8172, 0x3502, 0x8020, 0x3024, 0x3f50, 0x8009, 0xe778, 0x2bff, 0x9e5b }, 16, 0x000916a0, 1},
-	{{0x2c90, 0x2d90, 0x2e10, 0x3800, 0x3d6c, 0x800a, 0xc84e, 0x280a, 0x8010, 0xe8ea, 0xeeea, 0xe864, 0xedea, 0xecea, 0xebea, 0x2b02 }, 16, 0x000916c0, 1},
-	{{0x802a, 0xe748, 0xc282, 0xc84f, 0xeb6e, 0xec68, 0xed6c, 0xee72, 0x3900, 0x3d68, 0x800a, 0xc843, 0x0f86, 0x3a50, 0x8009, 0x90c0 }, 16, 0x000916e0, 1},
-	{{0xe81f, 0xe1e8, 0x0886, 0x3a4c, 0x8009, 0xcf43, 0x90c0, 0xef18, 0x10d7, 0xe0ef, 0x3610, 0x8022, 0x8007, 0x8806, 0xc840, 0xe838 }, 16, 0x00091700, 1},
-	{{0x24e9, 0x0811, 0xf804, 0x8427, 0x3f00, 0x3e10, 0x800a, 0xe8f9, 0xa0f8, 0x2908, 0x8014, 0xf584, 0x0002, 0x3e9c, 0x800a, 0x0802 }, 16, 0x00091720, 1},
-	{{0x3ea0, 0x800a, 0x882a, 0x0500, 0x3ef0, 0x800a, 0x3f00, 0x3e10, 0x800a, 0xe8f9, 0xa0f8, 0x2908, 0x8014, 0xf584, 0x0002, 0x3ea4 }, 16, 0x00091740, 1},
-	{{0x800a, 0x0802, 0x3ea8, 0x800a, 0x0500, 0x3ef4, 0x800a, 0x5016, 0x3065, 0xc94d, 0x8039, 0x2bff, 0x9d63, 0xc945, 0xe2ea, 0x2aff }, 16, 0x00091760, 1},
-	{{0x9d6f, 0x5011, 0xc846, 0x90c0, 0x0410, 0xc847, 0x0495, 0xeae2, 0x0494, 0xc945, 0x4413, 0x9760, 0x4490, 0xe8ea, 0x92c8, 0x4418 }, 16, 0x00091780, 1},
-	{{0xe8e1, 0x4418, 0x4418, 0x4410, 0x5011, 0x4016, 0x3961, 0x38c1, 0xc846, 0x256a, 0xefe0, 0xb0b9, 0x4038, 0xc84e, 0xc847, 0x2d0d }, 16, 0x000917a0, 1},
-	{{0x8054, 0x2808, 0x8054, 0x2c0c, 0x8054, 0x2e0e, 0x8054, 0x2b0b, 0x8054, 0x2a0a, 0x8054, 0x2909, 0x8054, 0x3703, 0x8020, 0x8118 }, 16, 0x000917c0, 1},
-	{{0xc84f, 0x3024, 0x3f50, 0x8009, 0xe768, 0x0104, 0x3ef0, 0x800a, 0x30e0, 0x0906, 0x3e9c, 0x800a, 0x841f, 0x1911, 0x0806, 0x3ea0 }, 16, 0x000917e0, 1},
-	{{0x800a, 0x90c0, 0x4910, 0x0806, 0x3ea0, 0x800a, 0x90c0, 0xe842, 0x0802, 0x3ea0, 0x800a, 0x0104, 0x3ef4, 0x800a, 0x30e0, 0x0906 }, 16, 0x00091800, 1},
-	{{0x3ea4, 0x800a, 0x841f, 0x1911, 0x0806, 0x3ea8, 0x800a, 0x90c0, 0x4910, 0x0806, 0x3ea8, 0x800a, 0x90c0, 0xe842, 0x0802, 0x3ea8 }, 16, 0x00091820, 1},
-	{{0x800a, 0x9f71, 0x3324, 0x3f30, 0x8009, 0x3750, 0x0004, 0x3ef0, 0x800a, 0x3066, 0xe748, 0x841d, 0x0004, 0x3ef2, 0x800a, 0xf041 }, 16, 0x00091840, 1},
-	{{0x0906, 0x3e9c, 0x800a, 0x32e4, 0x3c84, 0x8001, 0x0806, 0x3ea0, 0x800a, 0x0004, 0x3ef4, 0x800a, 0x3066, 0x0004, 0x3ef2, 0x800a }, 16, 0x00091860, 1},
-	{{0x8417, 0xf041, 0x0906, 0x3ea4, 0x800a, 0x32e4, 0x3c84, 0x8001, 0x0806, 0x3ea8, 0x800a, 0x3024, 0x3f50, 0x8009, 0xe768, 0x2bff }, 16, 0x00091880, 1},
-	{{0x9c79, 0x2d10, 0x2d90, 0x3800, 0x3d6e, 0x800a, 0x3e00, 0x3d68, 0x800a, 0x280a, 0x800a, 0x2a0b, 0x8004, 0x9242, 0x2a03, 0x8022 }, 16, 0x000918a0, 1},
-	{{0xedeb, 0xeceb, 0xe9e8, 0x2121, 0x8688, 0x2b02, 0x802a, 0x27c0, 0x83ca, 0xe748, 0xe0ee, 0xe962, 0xec6c, 0xed68, 0xc49e, 0xeee0 }, 16, 0x000918c0, 1},
-	{{0x103e, 0x0f86, 0x3a50, 0x8009, 0x2469, 0xe0ee, 0xce42, 0x80c2, 0xef1e, 0x501f, 0x100f, 0xda90, 0x31f8, 0x9fff, 0x1595, 0xdc1d }, 16, 0x000918e0, 1},
-	{{0x2461, 0xe1ef, 0x72e0, 0x8005, 0x4394, 0x0004, 0x3eec, 0x800a, 0x246a, 0xeeeb, 0x843b, 0x9b40, 0x2b03, 0x8004, 0x151e, 0x5092 }, 16, 0x00091900, 1},
-	{{0x2b76, 0x5511, 0x6f02, 0xd71d, 0x6c42, 0x2468, 0x0092, 0x30e8, 0x3fff, 0xbfff, 0x8005, 0x4092, 0x1592, 0x5094, 0x72f0, 0x90c0 }, 16, 0x00091920, 1},
-	{{0x94c3, 0x2303, 0x800e, 0x92d0, 0x4594, 0x90c0, 0x90c0, 0x1592, 0x3f40, 0x3a06, 0x8009, 0x66e9, 0x90c0, 0x92c2, 0xc581, 0x26ea }, 16, 0x00091940, 1},
-	{{0xd015, 0x6464, 0x8424, 0x92c3, 0xf742, 0x2c00, 0xd690, 0x3acd, 0x8216, 0x3c48, 0xce45, 0x90c0, 0xee1f, 0x95be, 0x6c41, 0x3e10 }, 16, 0x00091960, 1},
-	{{0x800a, 0x62f4, 0x6ef4, 0xf542, 0xf0c2, 0x3c48, 0xefe1, 0x6465, 0x7c48, 0x7458, 0xd818, 0x3c50, 0x9d52, 0x4010, 0x5594, 0x3ace }, 16, 0x00091980, 1},
-	{{0x8410, 0x461f, 0x3bfe, 0x9fff, 0x461f, 0x4595, 0x881c, 0x4017, 0x0311, 0xeeeb, 0x4394, 0x4395, 0x9760, 0x4310, 0x4392, 0x92c8 }, 16, 0x000919a0, 1},
-	{{0x431e, 0x431f, 0x431f, 0x4317, 0x2d0d, 0x8054, 0x2c0c, 0x8054, 0x2b0b, 0x8054, 0x2a0a, 0x8054, 0x94d0, 0x2909, 0x8054, 0x2808 }, 16, 0x000919c0, 1},
-	{{0x8054, 0x3502, 0x8020, 0x3024, 0x3f50, 0x8009, 0xe768, 0x9f71, 0x9f71, 0x9f71, 0x3204, 0x3844, 0x8009, 0xc085, 0x9f71, 0x9f71 }, 16, 0x000919e0, 1},
-	{{0x3204, 0x37ea, 0x8009, 0xc086, 0x9f71, 0x9f71, 0x3204, 0x37ea, 0x8009, 0xc087, 0x9f71, 0x9f71, 0x3204, 0x37ea, 0x8009, 0xc088 }, 16, 0x00091a00, 1},
-	{{0x9f71, 0x9f71, 0x3204, 0x3844, 0x8009, 0xc089, 0x9f71, 0x9f71, 0x3204, 0x37ea, 0x8009, 0xc08a, 0x9f71, 0x9f71, 0x3204, 0x37ea }, 16, 0x00091a20, 1},
-	{{0x8009, 0xc08b, 0x9f71, 0x9f71, 0x3204, 0x37ea, 0x8009, 0xc08c, 0x9f71, 0x9f71, 0x3204, 0x3844, 0x8009, 0xc08d, 0x9f71, 0x9f71 }, 16, 0x00091a40, 1},
-	{{0x3204, 0x37ea, 0x8009, 0xc08e, 0x9f71, 0x9f71, 0x3204, 0x37ea, 0x8009, 0xc08f, 0x9f71, 0x9f71, 0x3204, 0x37ea, 0x8009, 0xc090 }, 16, 0x00091a60, 1},
-	{{0x9f71, 0x9f71, 0x3204, 0x3844, 0x8009, 0xc097, 0x9f71, 0x9f71, 0x3204, 0x37ea, 0x8009, 0xc098, 0x9f71, 0x9f71, 0x3204, 0x3844 }, 16, 0x00091a80, 1},
-	{{0x8009, 0xc0a1, 0x9f71, 0x9f71, 0x3204, 0x3844, 0x8009, 0xc0a2, 0x9f71, 0x90c0, 0x90c0, 0x90c0, 0x90c0, 0x90c0, 0x90c0, 0x90c0 }, 16, 0x00091aa0, 1},
-	{{0x98c0, 0x0886, 0x3a58, 0x8009, 0xc9aa, 0x96c0, 0x6f90, 0x9620, 0x9720, 0x96c0, 0xc292, 0x280a, 0x82c2, 0x94c0, 0x9e20, 0x9f20 }, 16, 0x00091ac0, 1},
-	{{0x9ac0, 0x2a0b, 0x8028, 0x90c0, 0x270f, 0x8030, 0x1d13, 0xeb39, 0x3640, 0xa000, 0xe7ef, 0x5313, 0x3a00, 0xa800, 0x371f, 0x800f }, 16, 0x00091ae0, 1},
-	{{0xf747, 0xcd4b, 0x3c60, 0xa000, 0xd7a2, 0x5512, 0x3118, 0x30b5, 0xbff4, 0x3e47, 0xb000, 0x90c0, 0x32e0, 0x2f4b, 0x800b, 0x6d90 }, 16, 0x00091b00, 1},
-	{{0xd815, 0x3c00, 0xac22, 0x3465, 0x8002, 0xdb93, 0x3420, 0x8005, 0x31a1, 0x2e97, 0x8000, 0x3c00, 0xac22, 0x3065, 0x8002, 0x90c0 }, 16, 0x00091b20, 1},
-	{{0x3020, 0x8005, 0x3c00, 0xae44, 0x3627, 0x8005, 0xda10, 0x3666, 0x8002, 0x96c0, 0x3405, 0x8001, 0xd815, 0x3a00, 0xa200, 0x34e7 }, 16, 0x00091b40, 1},
-	{{0x8001, 0xd647, 0xd446, 0x3f00, 0x3ef8, 0x800a, 0x3e40, 0x2340, 0x800a, 0x96c0, 0xf444, 0x2300, 0x8081, 0x94c0, 0xf348, 0xf046 }, 16, 0x00091b60, 1},
-	{{0x94c0, 0xf249, 0xf54a, 0xf74b, 0x94c0, 0xf6c7, 0xf1c4, 0x9ac0, 0x3423, 0x8006, 0x90c0, 0x3620, 0x8006, 0xdb13, 0xd740, 0x98c0 }, 16, 0x00091b80, 1},
-	{{0xf642, 0x3204, 0x31c0, 0x8009, 0xf0c2, 0x3750, 0xf0c2, 0x7f48, 0x6765, 0x3f48, 0x3204, 0x31d4, 0x8009, 0x775e, 0x96c0, 0x77d0 }, 16, 0x00091ba0, 1},
-	{{0xf1c7, 0xf3c6, 0x9ac0, 0x3464, 0x8001, 0x67e4, 0x3661, 0x8001, 0x3fc8, 0xd814, 0x67e5, 0x7fc8, 0x37df, 0xd441, 0x0f56, 0xf041 }, 16, 0x00091bc0, 1},
-	{{0x3204, 0x31c0, 0x8009, 0xf0c1, 0x3750, 0xf0c1, 0x7f48, 0x6765, 0x3f48, 0x3204, 0x31d4, 0x8009, 0x775e, 0x96c0, 0x77d0, 0xf4c8 }, 16, 0x00091be0, 1},
-	{{0xf3c7, 0x9ac0, 0x67e4, 0x7a61, 0x79c1, 0x2e0e, 0x8048, 0x98c0, 0x7fc8, 0x666a, 0xf347, 0xf448, 0x67e5, 0x7fc8, 0x94c0, 0x77df }, 16, 0x00091c00, 1},
-	{{0x816c, 0x96c0, 0x4f57, 0x2f0f, 0x8048, 0x98c0, 0x6d90, 0xf2c9, 0x2c20, 0x8444, 0x96c0, 0x7961, 0xf4c4, 0xf0c6, 0x9ac0, 0x656a }, 16, 0x00091c20, 1},
-	{{0x6661, 0x6461, 0xf5ca, 0xf7cb, 0x96c0, 0xef3c, 0x2cff, 0x9f2b, 0x98c0, 0xd645, 0x6c23, 0xee3c, 0xf347, 0x27ea, 0x9fd0, 0xe7ea }, 16, 0x00091c40, 1},
-	{{0x94c0, 0x9e21, 0x9f21, 0x94c0, 0x9621, 0x9721, 0x9f71, 0x90c0, 0x3a40, 0xa000, 0x6e10, 0x0f86, 0x3a58, 0x8009, 0x94c0, 0x9620 }, 16, 0x00091c60, 1},
-	{{0x9720, 0x3c20, 0xa000, 0x2f0b, 0x82c0, 0x90c0, 0x280c, 0x8814, 0x96c0, 0x5513, 0x280a, 0x8810, 0x98c0, 0x3b18, 0x800f, 0x9e20 }, 16, 0x00091c80, 1},
-	{{0x9f20, 0x9ac0, 0x270d, 0x8128, 0xd022, 0x2b02, 0x8002, 0x94c0, 0xe7ed, 0x8413, 0x2704, 0x8081, 0x90c0, 0x94c8, 0x44ba, 0x44bc }, 16, 0x00091ca0, 1},
-	{{0x94c0, 0x6c90, 0x9749, 0x9ac0, 0x2b02, 0x8002, 0x7451, 0x27ee, 0x9f38, 0x27ed, 0x9f30, 0x94c8, 0xc03d, 0xc03e, 0x9ac0, 0x27ea }, 16, 0x00091cc0, 1},
-	{{0x9f30, 0x90c0, 0x2700, 0x8046, 0x98c0, 0x3002, 0x3fd0, 0x800a, 0xf975, 0x98c0, 0x3142, 0x2418, 0x800a, 0xf876, 0x3c00, 0xa100 }, 16, 0x00091ce0, 1},
-	{{0x27ec, 0x9fbc, 0x90c0, 0x280e, 0x8828, 0x9ac0, 0x280f, 0x8420, 0x90c0, 0x280e, 0x8018, 0x36c0, 0xa000, 0xefea, 0xf877, 0x3620 }, 16, 0x00091d00, 1},
-	{{0xa000, 0xf978, 0xf679, 0x3620, 0xa000, 0x529e, 0xfc7a, 0x96c0, 0x539e, 0x27ea, 0x9fc8, 0x3640, 0xa000, 0xf341, 0xf242, 0x3204 }, 16, 0x00091d20, 1},
-	{{0x30c4, 0x8009, 0x3660, 0xa000, 0xff7b, 0xfe7c, 0x96c0, 0x509f, 0x27ea, 0x9fd8, 0x159f, 0xf042, 0x3204, 0x30c4, 0x8009, 0xf541 }, 16, 0x00091d40, 1},
-	{{0x3820, 0xa000, 0xfefc, 0x27ea, 0x9fd0, 0x90c0, 0x3480, 0xa000, 0x549e, 0x3680, 0xa000, 0x519e, 0xf442, 0x3204, 0x30c4, 0x8009 }, 16, 0x00091d60, 1},
-	{{0x3640, 0xa000, 0xf141, 0xfe7c, 0x3c80, 0xa000, 0x27ed, 0x9fdc, 0x90c0, 0x27ed, 0x9fcc, 0x96c0, 0xf1ce, 0x27eb, 0x9fd4, 0x96c0 }, 16, 0x00091d80, 1},
-	{{0x7751, 0xc092, 0xf5ca, 0x3680, 0xa000, 0x5395, 0xfcfa, 0x3620, 0xa000, 0xfffb, 0x5295, 0x94c0, 0xf37d, 0xf57e, 0x3660, 0xa000 }, 16, 0x00091da0, 1},
-	{{0xf6cc, 0x5493, 0x96c0, 0xf07f, 0x07f8, 0x9f00, 0x3620, 0xa000, 0xfbf7, 0xf8f8, 0x9ac0, 0x90c0, 0x90c0, 0x90c0, 0x90c0, 0x90c0 }, 16, 0x00091dc0, 1},
-	{{0x3e00, 0xa009, 0x7656, 0x7456, 0x7552, 0x5958, 0x27ea, 0x9fc0, 0x3a80, 0xa000, 0x75d1, 0x77d0, 0x595b, 0xfc7a, 0x3e60, 0xa006 }, 16, 0x00091de0, 1},
-	{{0x76d0, 0x7452, 0x76d3, 0x77d1, 0xff7b, 0xfb77, 0x3e20, 0xa009, 0x74d7, 0x75d3, 0x74d7, 0xf878, 0x06f8, 0x9efc, 0x3e20, 0xa84c }, 16, 0x00091e00, 1},
-	{{0x6074, 0x60f4, 0x7452, 0x74d7, 0x04f8, 0x9ef8, 0x3a00, 0xa84c, 0x6175, 0x61f6, 0x76d3, 0x7656, 0x3a00, 0xa60c, 0x6cf4, 0x6df6 }, 16, 0x00091e20, 1},
-	{{0x7454, 0x76d5, 0x3a00, 0xa60c, 0x6c77, 0x6d75, 0x74d7, 0x7656, 0x3a00, 0xae62, 0x6dd2, 0x63f4, 0x7454, 0x6d32, 0x3a00, 0xb604 }, 16, 0x00091e40, 1},
-	{{0x6076, 0x76d5, 0x74d7, 0x7656, 0x3c00, 0xa638, 0x6ff4, 0x6c76, 0x6276, 0x62f7, 0xf0fe, 0x3a00, 0xa438, 0xd5c0, 0xd540, 0x6c43 }, 16, 0x00091e60, 1},
-	{{0x6cd9, 0x3c20, 0xb6b2, 0xd5c0, 0x6e76, 0x6ef7, 0x6eb9, 0xf7fd, 0x3c00, 0xbc06, 0x6ca3, 0xd4c7, 0x6dd5, 0xd6c7, 0xf341, 0x3a00 }, 16, 0x00091e80, 1},
-	{{0xa805, 0xd541, 0xd4c3, 0x6db5, 0x77d2, 0x3c00, 0xb804, 0xd6c3, 0x7452, 0x3204, 0x3130, 0x8009, 0x3420, 0xa000, 0xf542, 0x3860 }, 16, 0x00091ea0, 1},
-	{{0xa000, 0x7557, 0xfffb, 0xf7d0, 0x94c0, 0xfcfa, 0xf5ff, 0x3a00, 0xa100, 0x7ae1, 0x5097, 0x27e9, 0x9fc4, 0x3a20, 0xa004, 0xd7c0 }, 16, 0x00091ec0, 1},
-	{{0x66ea, 0x5591, 0xf8f8, 0x36a0, 0xa000, 0x479f, 0xf57f, 0x3860, 0xa000, 0x5394, 0x16f8, 0x9efc, 0x3a60, 0xa210, 0x14f8, 0x9ef8 }, 16, 0x00091ee0, 1},
-	{{0x6ccd, 0xfbf7, 0x96c0, 0x418c, 0x2dff, 0x9edd, 0x9ac0, 0x17f8, 0x9f00, 0x90c0, 0x2402, 0x8048, 0x3640, 0xa000, 0x7be1, 0xfefc }, 16, 0x00091f00, 1},
-	{{0x3a40, 0xa100, 0x67ea, 0xef3c, 0x2c0c, 0x8048, 0x2dff, 0x9dfb, 0x9ac0, 0x6d90, 0x0f86, 0x3a58, 0x8009, 0x9363, 0x98c0, 0x0066 }, 16, 0x00091f20, 1},
-	{{0x33a0, 0x800a, 0xf6f9, 0x9ac0, 0x2161, 0x9f00, 0x90c0, 0x2f0a, 0x82c0, 0x98c0, 0x6174, 0x5512, 0x2440, 0x8600, 0x9cc0, 0x27ee }, 16, 0x00091f40, 1},
-	{{0x9f30, 0x6d74, 0x3b19, 0x800f, 0xf9f5, 0x98c0, 0x6aa4, 0x509e, 0x2b03, 0x8026, 0x2ec9, 0xf8f6, 0x3075, 0x0562, 0x33a0, 0x800a }, 16, 0x00091f60, 1},
-	{{0x9ec0, 0xd353, 0xd2d0, 0x79c1, 0x90c0, 0x90c0, 0x90c0, 0x90c0, 0x98d6, 0x549e, 0x0662, 0x33a4, 0x800a, 0x98c6, 0x7275, 0x0562 }, 16, 0x00091f80, 1},
-	{{0x33a0, 0x800a, 0x96c0, 0xd2d4, 0xd353, 0x79c1, 0x3a06, 0xa100, 0x0662, 0x33a4, 0x800a, 0xeae8, 0x98c6, 0xd0a2, 0x0562, 0x33a0 }, 16, 0x00091fa0, 1},
-	{{0x800a, 0x0066, 0x33a4, 0x800a, 0x9cc1, 0xd431, 0x2440, 0x8000, 0xd431, 0x2420, 0x8aab, 0x3a00, 0xa004, 0xda94, 0x3402, 0x3ef8 }, 16, 0x00091fc0, 1},
-	{{0x800a, 0x94c2, 0xca40, 0xcda3, 0x98c7, 0x3c40, 0x2340, 0x800a, 0xcb40, 0x94c1, 0xfb48, 0xed3a, 0x98c6, 0x2500, 0x8081, 0x90c0 }, 16, 0x00091fe0, 1},
-	{{0xfd48, 0x96c0, 0xf1c8, 0x05f8, 0x9ef4, 0x3a61, 0xa000, 0xc7ff, 0x7cc2, 0x7cc2, 0xc781, 0x98c0, 0xca41, 0x3b00, 0x35b8, 0x800a }, 16, 0x00092000, 1},
-	{{0x9ac0, 0x280d, 0x8814, 0x90c0, 0x280e, 0x8004, 0x3800, 0xa100, 0xec1a, 0x280f, 0x840c, 0x3820, 0xa100, 0xea1c, 0x280d, 0x8810 }, 16, 0x00092020, 1},
-	{{0x280f, 0x8408, 0x3640, 0xa000, 0x5954, 0x5095, 0x3c80, 0xa000, 0x76d0, 0x75d1, 0x77d1, 0x5096, 0x5492, 0x3e00, 0xa009, 0x7550 }, 16, 0x00092040, 1},
-	{{0x7550, 0x75d5, 0x74d5, 0x0cf8, 0x9ef0, 0x3c00, 0xb28d, 0x6375, 0x6275, 0x7550, 0x7750, 0x5b52, 0x3c80, 0xa00f, 0x75d3, 0x74d2 }, 16, 0x00092060, 1},
-	{{0x6f77, 0x6e74, 0x5095, 0x3e00, 0xb27c, 0x36e3, 0x8004, 0x6175, 0x34e6, 0x8004, 0x7550, 0x3e00, 0xa882, 0x74d3, 0x30e6, 0x8004 }, 16, 0x00092080, 1},
-	{{0x75d3, 0x07fa, 0x9eec, 0x3c00, 0xac6a, 0x6d75, 0x75d1, 0xdb16, 0x34e2, 0x8006, 0x3c00, 0xac65, 0x30e2, 0x8006, 0x65e0, 0x36e1 }, 16, 0x000920a0, 1},
-	{{0x8006, 0x3c00, 0xb829, 0xd743, 0xdb12, 0x75d2, 0x34e2, 0x8000, 0x3e00, 0xb063, 0x30e2, 0x8000, 0xd741, 0x36e2, 0x8000, 0x74d1 }, 16, 0x000920c0, 1},
-	{{0x3e00, 0xa004, 0x6761, 0x0df8, 0x9ee8, 0xd912, 0x02fa, 0x9ee4, 0x3e20, 0xa404, 0x6176, 0x05fa, 0x9ee0, 0xd542, 0x05f8, 0x9edc }, 16, 0x000920e0, 1},
-	{{0x3a00, 0xb084, 0x6d76, 0x34e5, 0x8003, 0x6277, 0x3c20, 0xac60, 0x30e5, 0x8003, 0x6e77, 0x6faa, 0x5297, 0x3c00, 0xa622, 0xdb15 }, 16, 0x00092100, 1},
-	{{0x62f4, 0x74d1, 0x36e6, 0x8003, 0x3ca0, 0xa624, 0x61f5, 0x6ef4, 0x6c54, 0x6274, 0x5497, 0x3a00, 0xb685, 0x6df5, 0x6e74, 0x6c40 }, 16, 0x00092120, 1},
-	{{0xd746, 0x3a00, 0xb4c8, 0x6fcb, 0x6c53, 0x6761, 0x74d5, 0x3a00, 0xa28c, 0x6cdb, 0x6e40, 0x75d5, 0xca4f, 0x3800, 0xba00, 0x6c26 }, 16, 0x00092140, 1},
-	{{0x7554, 0x7757, 0x3800, 0xb004, 0x60f4, 0x74d5, 0x61f5, 0x3600, 0xb084, 0x6cf4, 0x6df6, 0x3640, 0xa004, 0x7cc2, 0x4199, 0x3640 }, 16, 0x00092160, 1},
-	{{0xa000, 0x4391, 0xf147, 0x1393, 0xf0c7, 0x3dc8, 0xf975, 0x98c0, 0xf346, 0x3204, 0x2486, 0x8009, 0xf1c6, 0x9ac0, 0x7c62, 0xf9f5 }, 16, 0x00092180, 1},
-	{{0x3b00, 0x35b8, 0x800a, 0x90c0, 0xe964, 0x4099, 0x1191, 0x5393, 0x3cc2, 0xf975, 0x3dc8, 0xf145, 0x94c0, 0xf344, 0xf0c5, 0x3204 }, 16, 0x000921a0, 1},
-	{{0x2486, 0x8009, 0xf1c4, 0x3e00, 0xa002, 0x7c62, 0x16f8, 0x9ef4, 0x77d6, 0x17fa, 0x9eec, 0x9ac0, 0x12fa, 0x9ee4, 0x7b61, 0x15fa }, 16, 0x000921c0, 1},
-	{{0x9ee0, 0x98c0, 0x1cf8, 0x9ef0, 0x676a, 0xf9f5, 0x96c0, 0xca47, 0x1df8, 0x9ee8, 0x3a00, 0xa100, 0x3b00, 0x35b8, 0x800a, 0xed48 }, 16, 0x000921e0, 1},
-	{{0x3840, 0xa000, 0xef48, 0x15f8, 0x9edc, 0x96c0, 0xee48, 0x06f8, 0x9ef4, 0x3680, 0xa000, 0xea48, 0x4099, 0x3600, 0xa100, 0xed48 }, 16, 0x00092200, 1},
-	{{0xef48, 0x2cff, 0x9e23, 0x9ac0, 0x2a0a, 0x8048, 0x90c0, 0x2c0c, 0x8048, 0x27ec, 0x9ed8, 0xe7ec, 0x94c0, 0x9e21, 0x9f21, 0x94c0 }, 16, 0x00092220, 1},
-	{{0x9621, 0x9721, 0x9f71, 0x90c0, 0x90c0, 0x90c0, 0x90c0, 0x90c0, 0x94c0, 0x9620, 0x9720, 0x94c0, 0x9e20, 0x9f20, 0x98c0, 0x3b60 }, 16, 0x00092240, 1},
-	{{0x384c, 0x800a, 0x9744, 0x270e, 0x8058, 0x109b, 0xe7ee, 0x27e9, 0x9fd0, 0x94c8, 0x4099, 0x509b, 0x98c0, 0x3f60, 0x3860, 0x800a }, 16, 0x00092260, 1},
-	{{0x9744, 0x4091, 0x96c0, 0x509f, 0x27ed, 0x9fe4, 0x94c8, 0x409d, 0x509f, 0x2f10, 0x2c90, 0x0095, 0x0d86, 0x3a58, 0x8009, 0x2704 }, 16, 0x00092280, 1},
-	{{0x8081, 0x2d0c, 0x82c2, 0x1614, 0x0662, 0x388c, 0x800a, 0x3d60, 0x3468, 0x800a, 0x3d1b, 0x80ff, 0x92c8, 0x419d, 0x96c0, 0x6c10 }, 16, 0x000922a0, 1},
-	{{0xc782, 0xc487, 0x94c0, 0xc28a, 0xc18f, 0x94c0, 0xc692, 0xc597, 0x98c0, 0x0762, 0x3894, 0x800a, 0xf051, 0x98c0, 0xc785, 0x0462 }, 16, 0x000922c0, 1},
-	{{0x38b0, 0x800a, 0x0262, 0x38b4, 0x800a, 0x0162, 0x38ac, 0x800a, 0x0662, 0x38a4, 0x800a, 0x0562, 0x3898, 0x800a, 0x9ac0, 0x27eb }, 16, 0x000922e0, 1},
-	{{0x9fe4, 0x90c0, 0x27ea, 0x9fd0, 0x3e00, 0x3ef8, 0x800a, 0x3f40, 0x2340, 0x800a, 0x90c0, 0x169a, 0x519b, 0x9cc0, 0x34c2, 0x8003 }, 16, 0x00092300, 1},
-	{{0xf353, 0x3424, 0x8003, 0xf754, 0x9cc0, 0x36c4, 0x8003, 0xd912, 0x3620, 0x8003, 0xdb14, 0x9ac0, 0xd544, 0x2100, 0x8081, 0xd740 }, 16, 0x00092320, 1},
-	{{0xfb55, 0x94c0, 0xf152, 0xfa56, 0x96c0, 0xf24e, 0xf650, 0x90c0, 0x94c0, 0xf6ce, 0xf5d1, 0x9ac0, 0x34c2, 0x8005, 0x90c0, 0x36c0 }, 16, 0x00092340, 1},
-	{{0x8005, 0xd892, 0xd4c0, 0x98c0, 0xf142, 0x3204, 0x31c0, 0x8009, 0xf0c2, 0x3204, 0x31d4, 0x8009, 0x3750, 0xf0c2, 0x96c0, 0x77d0 }, 16, 0x00092360, 1},
-	{{0xf5d0, 0xf2d1, 0x9ac0, 0x34a0, 0x8002, 0x4e57, 0x36a4, 0x8002, 0xda90, 0xd6c4, 0x98c0, 0xf541, 0x3204, 0x31c0, 0x8009, 0xf0c1 }, 16, 0x00092380, 1},
-	{{0x3204, 0x31d4, 0x8009, 0x3750, 0xf0c1, 0x96c0, 0x77d0, 0xf4d2, 0xf5d1, 0x9ac0, 0x7a61, 0x7ac1, 0x4e56, 0x2f0f, 0x8048, 0x96c0 }, 16, 0x000923a0, 1},
-	{{0x666a, 0xf452, 0xf551, 0x96c0, 0x818b, 0x2e0e, 0x8048, 0x98c0, 0x6e10, 0xf7d4, 0x2d20, 0x8444, 0x96c0, 0x7be1, 0xf3d3, 0xfbd5 }, 16, 0x000923c0, 1},
-	{{0x96c0, 0x67ea, 0xee3d, 0xef3d, 0x2cff, 0x9f2d, 0x94c0, 0xf451, 0xfad6, 0x2d90, 0x2f10, 0x2c90, 0xc7ff, 0x98c0, 0xc085, 0x0362 }, 16, 0x000923e0, 1},
-	{{0x3888, 0x800a, 0x0362, 0x38a0, 0x800a, 0x0762, 0x38a8, 0x800a, 0x9ec0, 0xd724, 0x6da2, 0x6e10, 0xcf46, 0x3860, 0x33a8, 0x800a }, 16, 0x00092400, 1},
-	{{0x92c3, 0x6f4e, 0xeffe, 0x94c0, 0xe81f, 0x801a, 0x4190, 0x98c0, 0x3860, 0x366c, 0x800a, 0x9f43, 0x90c0, 0xe81f, 0x92c8, 0x4498 }, 16, 0x00092420, 1},
-	{{0x7b41, 0xd737, 0x85cd, 0x94c0, 0x6c90, 0x9746, 0x96c0, 0x7451, 0x2b02, 0x8002, 0x3f60, 0x3410, 0x800a, 0x3b60, 0x3408, 0x800a }, 16, 0x00092440, 1},
-	{{0x90c0, 0x94c8, 0xc03b, 0xc03f, 0x27ea, 0x9fa8, 0xe7ea, 0x94c0, 0x9e21, 0x9f21, 0x94c0, 0x9621, 0x9721, 0x9f71, 0x90c0, 0x90c0 }, 16, 0x00092460, 1},
-	{{0x96c0, 0x6c90, 0x9620, 0x9720, 0x94c0, 0x9e20, 0x9f20, 0x9ac0, 0x270d, 0x8060, 0x90c0, 0x2700, 0x8408, 0x3840, 0xa000, 0xe7ed }, 16, 0x00092480, 1},
-	{{0x2040, 0x8000, 0x96c0, 0xf0e0, 0x27ed, 0x9fe8, 0x9cc0, 0x3400, 0x8007, 0xc84e, 0x3607, 0x8007, 0xe9e9, 0x96c0, 0xd910, 0xebed }, 16, 0x000924a0, 1},
-	{{0xeeed, 0x98c0, 0xd547, 0xefed, 0x2700, 0x8081, 0x3840, 0xa000, 0xd546, 0xf6df, 0x4191, 0x94c0, 0xca42, 0xf74b, 0x94c0, 0xeb64 }, 16, 0x000924c0, 1},
-	{{0xee68, 0x94c0, 0xcc42, 0xea44, 0x98c0, 0xef6c, 0x3462, 0x3468, 0x800a, 0x3c60, 0xa000, 0xf64c, 0x2701, 0x999a, 0x90c0, 0x90c0 }, 16, 0x000924e0, 1},
-	{{0x3640, 0xa000, 0xf6cc, 0x5494, 0x3a40, 0xa108, 0xd725, 0x7e42, 0x5692, 0x5694, 0x3860, 0xa000, 0x7f42, 0xf445, 0xf643, 0x3800 }, 16, 0x00092500, 1},
-	{{0xa800, 0x7756, 0xf644, 0x8065, 0x94c0, 0xf1c5, 0xf0c5, 0x3640, 0xa000, 0xf94d, 0xf04e, 0x94c0, 0xfc4f, 0xfa50, 0x3204, 0x2486 }, 16, 0x00092520, 1},
-	{{0x8009, 0x3640, 0xa000, 0xfb51, 0xfc52, 0x3204, 0x2486, 0x8009, 0x96c0, 0x77d0, 0xf1c4, 0xf0c4, 0x3a40, 0xa004, 0x7756, 0xd7c0 }, 16, 0x00092540, 1},
-	{{0xf9cd, 0xf0ce, 0x3800, 0xa044, 0x6f5f, 0xfccf, 0xfad0, 0x3a60, 0xa000, 0xfcd2, 0x3700, 0x2000, 0x999a, 0x3640, 0xa000, 0xfbd1 }, 16, 0x00092560, 1},
-	{{0xf643, 0x94c0, 0xf6cc, 0xf1c5, 0xd724, 0x96c0, 0xf0c5, 0x2718, 0x831a, 0x3820, 0xa000, 0xd325, 0xf94d, 0xf04e, 0x3606, 0xa840 }, 16, 0x00092580, 1},
-	{{0x6277, 0xfc4f, 0x3606, 0xa840, 0x6e77, 0xfa50, 0x94c6, 0xfb51, 0xf443, 0x3204, 0x2486, 0x8009, 0x3420, 0xa000, 0xfc52, 0x3204 }, 16, 0x000925a0, 1},
-	{{0x2486, 0x8009, 0x96c0, 0x7750, 0xf1c4, 0xf0c4, 0x9ac0, 0xd740, 0xc18f, 0x32a4, 0x2f54, 0x8008, 0x96c0, 0x7456, 0xf101, 0xf1c3 }, 16, 0x000925c0, 1},
-	{{0x3c40, 0xa004, 0x7650, 0x3508, 0x2000, 0xbc13, 0xf9cd, 0x3c20, 0xa840, 0x6276, 0x3358, 0x21eb, 0xbffe, 0xf0ce, 0x3c20, 0xa840 }, 16, 0x000925e0, 1},
-	{{0x6e76, 0x3108, 0x2000, 0x9500, 0xfcd2, 0x3c20, 0xa000, 0x6d4c, 0xfbd1, 0x3700, 0x2000, 0x999a, 0x9ac0, 0x7171, 0xfad0, 0x3508 }, 16, 0x00092600, 1},
-	{{0x2000, 0xbfff, 0x3a20, 0xa000, 0x3108, 0x2000, 0xa666, 0xfccf, 0x9ac6, 0x2418, 0x8200, 0x90c0, 0x2161, 0x9fff, 0x3820, 0xa000 }, 16, 0x00092620, 1},
-	{{0x3300, 0x2000, 0x9999, 0x98c0, 0x3860, 0x3874, 0x800a, 0x9744, 0x3680, 0xa000, 0x27ef, 0x9fd8, 0x5398, 0x3688, 0xa000, 0x439f }, 16, 0x00092640, 1},
-	{{0x5398, 0x3c00, 0xa100, 0x7d49, 0x4397, 0x3140, 0x3477, 0x8171, 0x6561, 0x6564, 0x2569, 0x7452, 0x96c0, 0x6466, 0x2418, 0x8162 }, 16, 0x00092660, 1},
-	{{0x96c2, 0x3400, 0x2000, 0x8100, 0x3204, 0x2486, 0x8009, 0xf253, 0x98c0, 0x3300, 0x2000, 0x8080, 0xf2d3, 0x9ac0, 0xd443, 0x6568 }, 16, 0x00092680, 1},
-	{{0x3160, 0x3218, 0x80b1, 0x31ef, 0x9f00, 0x98c7, 0x3204, 0x2486, 0x8009, 0x67e4, 0x7457, 0xf2d3, 0x2d12, 0x3204, 0x2486, 0x8009 }, 16, 0x000926a0, 1},
-	{{0x34d2, 0x3452, 0xf254, 0x96c0, 0xf055, 0x27ed, 0x9fe8, 0x3204, 0x2486, 0x8009, 0x5195, 0x3820, 0xa004, 0x7750, 0xfbd1, 0xf2d5 }, 16, 0x000926c0, 1},
-	{{0x3400, 0xa800, 0x7452, 0x1193, 0x3204, 0x2486, 0x8009, 0x3400, 0xa800, 0x6cc6, 0x3840, 0xa004, 0x7750, 0xf2d5, 0x5196, 0x3204 }, 16, 0x000926e0, 1},
-	{{0x2486, 0x8009, 0x3600, 0xb800, 0x7452, 0x6cc6, 0x3840, 0xa004, 0x7750, 0xf2d5, 0x5197, 0x3204, 0x2486, 0x8009, 0x3600, 0xb800 }, 16, 0x00092700, 1},
-	{{0x7452, 0x6cc6, 0x3640, 0xa000, 0x74d0, 0xf2d5, 0x3c40, 0xa800, 0x7452, 0xf2ca, 0x3204, 0x2486, 0x8009, 0x3400, 0xa800, 0x6cd8 }, 16, 0x00092720, 1},
-	{{0x9ac0, 0x7650, 0x3100, 0x2000, 0x8200, 0xf2d4, 0x3c00, 0xa004, 0x6d44, 0x7452, 0x3204, 0x2486, 0x8009, 0x3420, 0xa000, 0xf256 }, 16, 0x00092740, 1},
-	{{0x3a40, 0xa000, 0x6468, 0x74d0, 0xf2d4, 0xf2d6, 0x3800, 0xa804, 0x6d3c, 0xc298, 0xc398, 0x98c1, 0x6568, 0x6568, 0xc0ff, 0x6c10 }, 16, 0x00092760, 1},
-	{{0x3a46, 0xa000, 0x90c0, 0xf257, 0x6d10, 0x65e0, 0x32e4, 0x3d8c, 0x8001, 0x92c3, 0xc2ff, 0x3420, 0xa000, 0xf2d7, 0x3600, 0xb004 }, 16, 0x00092780, 1},
-	{{0x6568, 0x75d2, 0x98c6, 0x32e4, 0x3d74, 0x8001, 0x6d10, 0x92c3, 0xc2ff, 0x27e8, 0x24e1, 0x3000, 0x2000, 0x8100, 0x94c7, 0x6cd1 }, 16, 0x000927a0, 1},
-	{{0x67e4, 0x7ff8, 0x94c1, 0xd41f, 0xd417, 0x3204, 0x2486, 0x8009, 0x6461, 0x3650, 0x3508, 0x2000, 0xbfff, 0x3c20, 0xa000, 0x63f6 }, 16, 0x000927c0, 1},
-	{{0x3000, 0x2000, 0x8100, 0xc29f, 0x3e20, 0xa000, 0x74d0, 0x6ff6, 0xf201, 0x32a4, 0x2f54, 0x8008, 0x6cc7, 0x3820, 0xa000, 0x74d0 }, 16, 0x000927e0, 1},
-	{{0xf9cd, 0xf0ce, 0x94c0, 0xfccf, 0xfad0, 0x3640, 0xa000, 0xfbd1, 0xfcd2, 0x3820, 0xa000, 0x3700, 0x2000, 0x999a, 0x3820, 0xa000 }, 16, 0x00092800, 1},
-	{{0x3108, 0x2000, 0xa666, 0x3820, 0xa000, 0x3300, 0x2000, 0x9999, 0x3e40, 0xa804, 0x7770, 0x2200, 0x8ccc, 0xd919, 0x2360, 0x9333 }, 16, 0x00092820, 1},
-	{{0x3800, 0xa044, 0x6a3c, 0xf0c3, 0x5491, 0x3c40, 0xa80c, 0x6a0e, 0x7450, 0xd642, 0x2260, 0x9fff, 0x3a00, 0xb085, 0x7e6f, 0x63f4 }, 16, 0x00092840, 1},
-	{{0x7450, 0x4491, 0x3a00, 0xa616, 0x3674, 0x9eb8, 0x6ff4, 0x7454, 0x75d7, 0x94c2, 0x2161, 0x9eb8, 0x23f4, 0xd919, 0x3600, 0xb000 }, 16, 0x00092860, 1},
-	{{0x6ff4, 0x6cbc, 0x3457, 0xdb91, 0x60f7, 0x6cf7, 0x3400, 0xa004, 0x6d51, 0x3400, 0xa840, 0x6375, 0x3400, 0xa840, 0x6f75, 0x3400 }, 16, 0x00092880, 1},
-	{{0xa004, 0x6f4e, 0x94c0, 0xf0cb, 0xec48, 0x3840, 0xa100, 0x7861, 0x469c, 0xea48, 0x246a, 0xf04b, 0x2dff, 0x9c49, 0x27ec, 0x9fa0 }, 16, 0x000928a0, 1},
-	{{0xe7ec, 0x94c0, 0x9e21, 0x9f21, 0x94c0, 0x9621, 0x9721, 0x9f71, 0x94c0, 0x9620, 0x9720, 0xe748, 0x9ac0, 0x27eb, 0x9fde, 0x90c0 }, 16, 0x000928c0, 1},
-	{{0x27e9, 0x9fe4, 0x1353, 0xf2c8, 0x3e00, 0xa004, 0x01fc, 0x9fdc, 0x7752, 0x77d3, 0x7552, 0x5091, 0x3e00, 0xa003, 0x7650, 0x76d1 }, 16, 0x000928e0, 1},
-	{{0x75d1, 0x74d3, 0x27eb, 0x9ffc, 0x3a00, 0xa21f, 0x7450, 0x62f6, 0x6275, 0x61f7, 0x3a00, 0xa422, 0x76d3, 0x7752, 0x7650, 0x6374 }, 16, 0x00092900, 1},
-	{{0x3a00, 0xa00b, 0x77d1, 0x6f76, 0x6df5, 0x6ef4, 0x3600, 0xb084, 0x6e77, 0x6e4d, 0x3400, 0xa840, 0x6d36, 0xf242, 0x4493, 0x94c0 }, 16, 0x00092920, 1},
-	{{0xf3c1, 0xf5c2, 0x059a, 0xe768, 0x94c0, 0x9621, 0x9721, 0x9f70, 0x4392, 0x90c0, 0x90c0, 0x90c0, 0x90c0, 0x90c0, 0x90c0, 0x90c0 }, 16, 0x00092940, 1},
-	{{0x96c0, 0x6e90, 0x9620, 0x9720, 0x94c0, 0x9e20, 0x9f20, 0x96c0, 0x974c, 0x270e, 0x8190, 0xe7ee, 0x96c0, 0xece9, 0x2b02, 0x8002 }, 16, 0x00092960, 1},
-	{{0x290e, 0x8004, 0x94c8, 0x45bc, 0x45be, 0x96c0, 0xe858, 0x2700, 0x8046, 0x3502, 0x3fd0, 0x800a, 0x3042, 0x2418, 0x800a, 0x90c0 }, 16, 0x00092980, 1},
-	{{0x3820, 0xa000, 0x5298, 0x09f8, 0x9e9c, 0x96c0, 0x5588, 0x27ea, 0x9fc0, 0x3640, 0xa000, 0xf541, 0xf242, 0x9ac0, 0x08f8, 0x9e98 }, 16, 0x000929a0, 1},
-	{{0x90c0, 0x05fa, 0x9e94, 0x3204, 0x30c4, 0x8009, 0x00fa, 0x9e90, 0x9ac0, 0x18f8, 0x9e98, 0x90c0, 0x27ea, 0x9f90, 0x90c0, 0x280e }, 16, 0x000929c0, 1},
-	{{0x8408, 0x509e, 0x128e, 0xf042, 0x3204, 0x30c4, 0x8009, 0xf241, 0x9ac0, 0x2e0e, 0x8408, 0x90c0, 0x27ef, 0x9fe0, 0x96c0, 0xfe4a }, 16, 0x000929e0, 1},
-	{{0x2a00, 0x8808, 0x169e, 0xf8ca, 0x069f, 0x5696, 0x9742, 0x0697, 0xe83a, 0x9ac0, 0x27ef, 0x9ff8, 0x90c0, 0x27ee, 0x9fe0, 0x92d0 }, 16, 0x00092a00, 1},
-	{{0x519e, 0x419f, 0x3204, 0x30c4, 0x8009, 0x9ac0, 0x27ea, 0x9fb0, 0x90c0, 0x08f8, 0x9e98, 0x9ac0, 0x15fa, 0x9e94, 0x90c0, 0x10fa }, 16, 0x00092a20, 1},
-	{{0x9e90, 0x3c00, 0xa100, 0x27ee, 0x9f18, 0x90c0, 0x27e9, 0x9f40, 0x3640, 0xa000, 0xe1ee, 0xefed, 0x3620, 0xa000, 0xeae8, 0xc185 }, 16, 0x00092a40, 1},
-	{{0x3820, 0xa000, 0xe0e9, 0x27ee, 0x9ea0, 0x3c80, 0xa100, 0x27ef, 0x9f68, 0x90c0, 0x27ee, 0x9ef0, 0x3820, 0xa100, 0xfd46, 0x27ea }, 16, 0x00092a60, 1},
-	{{0x9ec8, 0x3420, 0xa000, 0xf845, 0x9741, 0x27eb, 0x9ff4, 0x92d0, 0x509a, 0x409b, 0x3660, 0xa000, 0xf4d0, 0xf7cf, 0x3660, 0xa000 }, 16, 0x00092a80, 1},
-	{{0xf442, 0xf741, 0x3224, 0x28d0, 0x8009, 0x96c0, 0xcc51, 0x27ea, 0x9fb8, 0x3620, 0xa000, 0xf5d2, 0x9741, 0x3420, 0xa000, 0xf2d1 }, 16, 0x00092aa0, 1},
-	{{0x38a0, 0xa000, 0x459a, 0x27eb, 0x9ff4, 0x34a0, 0xa000, 0x429a, 0x92d0, 0x559f, 0x459b, 0x3660, 0xa000, 0xf6d0, 0xf3cf, 0x3660 }, 16, 0x00092ac0, 1},
-	{{0xa000, 0xf642, 0xf341, 0x3224, 0x28d0, 0x8009, 0x27ea, 0x9fa8, 0x3620, 0xa000, 0xf0d6, 0x9741, 0x3420, 0xa000, 0xf3d5, 0x36a0 }, 16, 0x00092ae0, 1},
-	{{0xa000, 0x409e, 0xffc5, 0x38a0, 0xa000, 0x439e, 0x27eb, 0x9ff4, 0x92d0, 0x529f, 0x429b, 0x3660, 0xa000, 0xf0dc, 0xf6db, 0x3660 }, 16, 0x00092b00, 1},
-	{{0xa000, 0xf042, 0xf641, 0x3224, 0x28d0, 0x8009, 0x27ea, 0x9fd0, 0x3620, 0xa000, 0xf2cc, 0x9741, 0x3420, 0xa000, 0xf5cb, 0x36a0 }, 16, 0x00092b20, 1},
-	{{0xa000, 0x429f, 0xffc6, 0x38a0, 0xa000, 0x459f, 0x27eb, 0x9ff4, 0x92d0, 0x509f, 0x409b, 0x3660, 0xa000, 0xf7dc, 0xf4db, 0x3660 }, 16, 0x00092b40, 1},
-	{{0xa000, 0xf742, 0xf441, 0x3224, 0x28d0, 0x8009, 0x27ea, 0x9f98, 0x3620, 0xa000, 0xf1da, 0x9741, 0xf5d9, 0x3620, 0xa000, 0x419e }, 16, 0x00092b60, 1},
-	{{0xfbc5, 0x96c0, 0x459e, 0x27ed, 0x9ff4, 0x92d0, 0x549b, 0x449d, 0x94c0, 0xf6d4, 0xf0d3, 0x94c0, 0xf642, 0xf041, 0x3224, 0x28d0 }, 16, 0x00092b80, 1},
-	{{0x8009, 0x27ea, 0x9fc8, 0x94c0, 0xefe0, 0xf6ce, 0x069f, 0xf2cd, 0x9741, 0x029f, 0xfbc6, 0x96c0, 0xe0ef, 0x27ec, 0x9ff4, 0x92d0 }, 16, 0x00092ba0, 1},
-	{{0x509b, 0x409c, 0x94c0, 0xf4d4, 0xf3d3, 0x94c0, 0xf442, 0xf341, 0x3224, 0x28d0, 0x8009, 0x27ea, 0x9fa0, 0x94c0, 0xece1, 0xf5d8 }, 16, 0x00092bc0, 1},
-	{{0x94c0, 0xffc6, 0xfac5, 0x059c, 0xcc59, 0x3820, 0xa000, 0x78e1, 0xedec, 0xf1d7, 0x96c0, 0x64ea, 0xea44, 0xef44, 0x3620, 0xa000 }, 16, 0x00092be0, 1},
-	{{0x419d, 0xfa45, 0x2cff, 0x9e85, 0x94c0, 0xff46, 0xe1ed, 0x96c0, 0xc685, 0x19f8, 0x9e9c, 0x9ac0, 0x27ef, 0x9f18, 0x90c0, 0x27ee }, 16, 0x00092c00, 1},
-	{{0x9f68, 0x290a, 0x8008, 0x3640, 0xa000, 0xc11e, 0xf4d0, 0x3a00, 0xa200, 0x27ed, 0x9fc4, 0x6ec0, 0xc31f, 0x2c49, 0x1495, 0x0af8 }, 16, 0x00092c20, 1},
-	{{0x9e8c, 0x2e44, 0x3204, 0x3192, 0x8009, 0x6ccc, 0x3b61, 0x1af8, 0x9e8c, 0x676a, 0x3420, 0xa000, 0x5292, 0x3600, 0xa804, 0x6c52 }, 16, 0x00092c40, 1},
-	{{0x81cc, 0x3420, 0xa000, 0x409a, 0x96c0, 0xc683, 0x19f8, 0x9e9c, 0x9ac0, 0x27ef, 0x9f30, 0x90c0, 0x27ee, 0x9ee0, 0x290a, 0x801c }, 16, 0x00092c60, 1},
-	{{0x3640, 0xa000, 0xc10e, 0xf6dc, 0x3a00, 0xa200, 0x27ed, 0x9f94, 0x6ec2, 0xc30f, 0x2c49, 0x1495, 0x0af8, 0x9e88, 0x2e44, 0x3204 }, 16, 0x00092c80, 1},
-	{{0x3192, 0x8009, 0x6ccc, 0x3b61, 0x1af8, 0x9e88, 0x676a, 0x3420, 0xa000, 0x5792, 0x3600, 0xa804, 0x6ec3, 0x81cc, 0x3420, 0xa000 }, 16, 0x00092ca0, 1},
-	{{0x459a, 0x96c0, 0xc685, 0x19f8, 0x9e9c, 0x9ac0, 0x27ef, 0x9ef0, 0x90c0, 0x27ea, 0x9f40, 0x98c0, 0x290e, 0x8028, 0x90c0, 0x90c0 }, 16, 0x00092cc0, 1},
-	{{0x3640, 0xa000, 0xc11a, 0xf0dc, 0x3a00, 0xa010, 0x27eb, 0x9f94, 0x6e50, 0xc31f, 0x2c48, 0x1593, 0x0af8, 0x9e84, 0x2ec5, 0x3204 }, 16, 0x00092ce0, 1},
-	{{0x3192, 0x8009, 0x6ccd, 0x3a40, 0xa000, 0x7b61, 0x5196, 0x1af8, 0x9e84, 0x3600, 0xb008, 0x676a, 0x6d51, 0x3620, 0xa000, 0x429e }, 16, 0x00092d00, 1},
-	{{0x81c7, 0x96c0, 0xc683, 0x19f8, 0x9e9c, 0x9ac0, 0x27ef, 0x9f08, 0x90c0, 0x27ee, 0x9f80, 0x98c0, 0x290a, 0x803c, 0x90c0, 0x90c0 }, 16, 0x00092d20, 1},
-	{{0x3640, 0xa000, 0xc10e, 0xf2d4, 0x3a00, 0xa200, 0x27ed, 0x9fb4, 0x6ed2, 0xc30f, 0x2c49, 0x1495, 0x0af8, 0x9e80, 0x2d44, 0x3204 }, 16, 0x00092d40, 1},
-	{{0x3192, 0x8009, 0x6cdd, 0x3b61, 0x1af8, 0x9e80, 0x676a, 0x3420, 0xa000, 0x5792, 0x3600, 0xa804, 0x6cc3, 0x81cc, 0x3420, 0xa000 }, 16, 0x00092d60, 1},
-	{{0x419a, 0x96c0, 0xc585, 0x19f8, 0x9e9c, 0x9ac0, 0x27ef, 0x9ea0, 0x90c0, 0x27ee, 0x9ec8, 0x98c0, 0x290a, 0x8048, 0x90c0, 0x90c0 }, 16, 0x00092d80, 1},
-	{{0x3640, 0xa000, 0xc11e, 0xf5d4, 0x3a00, 0xa200, 0x27eb, 0x9fb4, 0x6f41, 0xc31f, 0x2c4a, 0x1493, 0x0af8, 0x9e7c, 0x2f44, 0x3204 }, 16, 0x00092da0, 1},
-	{{0x3192, 0x8009, 0x2cce, 0x7755, 0x36d6, 0x1af8, 0x9e7c, 0x7ae1, 0x3640, 0xa000, 0x66ea, 0x5092, 0x3600, 0xa044, 0x6fd0, 0x81c8 }, 16, 0x00092dc0, 1},
-	{{0x3420, 0xa000, 0x479a, 0x94c0, 0xc383, 0xc681, 0x3c00, 0xa001, 0x27ea, 0x9eb8, 0x7453, 0x27ef, 0x9f58, 0x94c0, 0x27ec, 0x9fc4 }, 16, 0x00092de0, 1},
-	{{0x98c0, 0x3d04, 0x8016, 0xf5d0, 0xc10f, 0x98c0, 0x6c41, 0xd637, 0x5594, 0xc30a, 0x3c80, 0xa000, 0x6ec5, 0x0af8, 0x9e78, 0x6c52 }, 16, 0x00092e00, 1},
-	{{0xce40, 0x2ccd, 0xc582, 0x98c6, 0x3204, 0x3192, 0x8009, 0x6e1a, 0x04f8, 0x9e74, 0x9ac0, 0x1bf8, 0x9e74, 0x7b41, 0x19f8, 0x9e9c }, 16, 0x00092e20, 1},
-	{{0x3880, 0xa000, 0xce48, 0x27ec, 0x9fc4, 0x3a00, 0xa004, 0x7861, 0xebfe, 0x1af8, 0x9e78, 0x3600, 0xa004, 0x646a, 0xeb19, 0x5493 }, 16, 0x00092e40, 1},
-	{{0x94c0, 0x6dc0, 0x81a0, 0x4393, 0x9ac0, 0x15fa, 0x9e94, 0x7be1, 0x10fa, 0x9e90, 0x27ea, 0x18f8, 0x9e98, 0x2cff, 0x9b27, 0x3ce0 }, 16, 0x00092e60, 1},
-	{{0xa100, 0x2808, 0x8048, 0x90c0, 0x2d0d, 0x8048, 0x27e8, 0x9e70, 0xe7e8, 0x94c0, 0x9e21, 0x9f21, 0x94c0, 0x9621, 0x9721, 0x9f71 }, 16, 0x00092e80, 1},
-	{{0x94c0, 0x9620, 0x9720, 0x94c0, 0x9e20, 0x9f20, 0x98c0, 0x0766, 0x3890, 0x800a, 0xc848, 0x0366, 0x3894, 0x800a, 0x96c0, 0x71f7 }, 16, 0x00092ea0, 1},
-	{{0x270f, 0x8030, 0x94c0, 0xe7ef, 0x802b, 0x0566, 0x38b0, 0x800a, 0x72f7, 0x94c2, 0x6e10, 0x6d0f, 0x94c2, 0xc181, 0xc582, 0x98c6 }, 16, 0x00092ec0, 1},
-	{{0x2418, 0x80e2, 0x90c0, 0xf246, 0x94c2, 0xf448, 0xf147, 0x0266, 0x38b0, 0x800a, 0x3177, 0x0666, 0x38b4, 0x800a, 0x8021, 0x7377 }, 16, 0x00092ee0, 1},
-	{{0x94c2, 0x6f0b, 0x6e10, 0x94c2, 0xc281, 0xc583, 0x96c2, 0x6d3a, 0xf248, 0xf447, 0x80ac, 0x94c2, 0xf246, 0xc582, 0x0166, 0x38b4 }, 16, 0x00092f00, 1},
-	{{0x800a, 0x30f7, 0x0566, 0x38ac, 0x800a, 0x801d, 0x72f7, 0x94c2, 0x6d07, 0x6e90, 0x94c2, 0xc481, 0xc682, 0x94c6, 0x8086, 0xf246 }, 16, 0x00092f20, 1},
-	{{0x94c2, 0xf448, 0xf647, 0x0466, 0x38ac, 0x800a, 0x3277, 0x0666, 0x38a4, 0x800a, 0x8021, 0x7377, 0x94c2, 0x6e17, 0x6e90, 0x94c2 }, 16, 0x00092f40, 1},
-	{{0xc283, 0xc682, 0x96c2, 0x6ca8, 0xc281, 0xf648, 0x8054, 0x94c2, 0xf247, 0xf146, 0x0666, 0x38a4, 0x800a, 0x3377, 0x0166, 0x3898 }, 16, 0x00092f60, 1},
-	{{0x800a, 0x801d, 0x70f7, 0x94c2, 0x6d1f, 0x6e10, 0x94c2, 0xc682, 0xc581, 0x94c6, 0x802e, 0xf246, 0x94c2, 0xf447, 0xf648, 0x9ac0 }, 16, 0x00092f80, 1},
-	{{0x71f7, 0x0566, 0x3898, 0x800a, 0xc283, 0x94c6, 0xc682, 0x7bd8, 0x98c0, 0x6d9b, 0x6e10, 0xf647, 0xc581, 0x2cbd, 0xf448, 0xf146 }, 16, 0x00092fa0, 1},
-	{{0x98c0, 0x3e15, 0x8408, 0xf2c6, 0xf1c8, 0x9ac0, 0x7d42, 0xf7c7, 0x3b00, 0x3ef8, 0x800a, 0x9cc0, 0x3e11, 0x8408, 0xcc42, 0x3e17 }, 16, 0x00092fc0, 1},
-	{{0x8408, 0xcd40, 0x9ac0, 0xd4c0, 0x3a40, 0x2340, 0x800a, 0xce45, 0x94c0, 0xcf47, 0xc841, 0x96c0, 0xeb1c, 0x2500, 0x8081, 0x94c0 }, 16, 0x00092fe0, 1},
-	{{0xec1a, 0xee1d, 0x94c0, 0xef1d, 0xf549, 0x94c0, 0xe844, 0xca41, 0x3d00, 0x35b8, 0x800a, 0x3820, 0xa000, 0x2721, 0x8aab, 0x90c0 }, 16, 0x00093000, 1},
-	{{0x1492, 0x5954, 0x35d1, 0x34d0, 0x37d0, 0x1d53, 0xcc54, 0x3e00, 0xa00d, 0x75d4, 0x74d3, 0x76d5, 0x76d1, 0xcc5c, 0xfb4a, 0x0499 }, 16, 0x00093020, 1},
-	{{0xf84c, 0x3620, 0xa000, 0x5290, 0xfa4b, 0x3420, 0xa000, 0x4289, 0x549f, 0x3800, 0xa004, 0x7454, 0x7754, 0x509f, 0x3a00, 0xa426 }, 16, 0x00093040, 1},
-	{{0x6377, 0x7550, 0x7750, 0x6274, 0x3c00, 0xa00b, 0x77d1, 0x7454, 0x74d3, 0x6f76, 0xcc5c, 0x3a00, 0xb089, 0x6377, 0x6e74, 0x6075 }, 16, 0x00093060, 1},
-	{{0x7550, 0x3a00, 0xa608, 0x6f74, 0x6c75, 0x75d3, 0x76d5, 0x3800, 0xaac8, 0x6f82, 0x6f56, 0x74d3, 0x3600, 0xa848, 0x6f4a, 0x6f57 }, 16, 0x00093080, 1},
-	{{0x3420, 0xa000, 0x4699, 0x4689, 0x509e, 0x3820, 0xa000, 0x7550, 0x7650, 0x529e, 0x3a00, 0xb601, 0x63f5, 0x75d3, 0x7652, 0x7552 }, 16, 0x000930a0, 1},
-	{{0x3a00, 0xa208, 0x6ff4, 0x60f6, 0x76d5, 0x7650, 0x3a00, 0xb28b, 0x6075, 0x6076, 0x7652, 0x6cf6, 0x3a00, 0xbec8, 0x6c75, 0x6c76 }, 16, 0x000930c0, 1},
-	{{0x74d7, 0x75d7, 0x3800, 0xa88c, 0x6ed1, 0x6d03, 0xcc4f, 0x3600, 0xa8c8, 0x6c4a, 0x6f5a, 0x3a00, 0xb204, 0x61f4, 0x74d7, 0x7556 }, 16, 0x000930e0, 1},
-	{{0x4099, 0x3820, 0xa004, 0x6df4, 0x62f5, 0x4689, 0x3820, 0xa848, 0x6ef7, 0x7dc2, 0x4399, 0x3640, 0xa000, 0x4591, 0xf345, 0x1595 }, 16, 0x00093100, 1},
-	{{0xf0c5, 0x3ec8, 0xc94e, 0x98c0, 0xf544, 0x3204, 0x2486, 0x8009, 0xf1c4, 0x9ac0, 0x7c62, 0xc946, 0x3d00, 0x35b8, 0x800a, 0x90c0 }, 16, 0x00093120, 1},
-	{{0xe964, 0x4099, 0x1291, 0x5595, 0x3d42, 0xc94e, 0x3ec8, 0xf243, 0x94c0, 0xf542, 0xf0c3, 0x3204, 0x2486, 0x8009, 0xf1c2, 0x96c0 }, 16, 0x00093140, 1},
-	{{0x7c62, 0xcc47, 0xf7c9, 0x96c0, 0x7be1, 0xc946, 0xfbca, 0x96c0, 0x67ea, 0xfacb, 0xf8cc, 0x98c0, 0x3d00, 0x35b8, 0x800a, 0xf749 }, 16, 0x00093160, 1},
-	{{0x3a20, 0xa000, 0x3700, 0x2000, 0xaaab, 0xe848, 0x9ac0, 0x2c0c, 0x8048, 0x90c0, 0x2b0b, 0x8048, 0x2cff, 0x9e89, 0x0099, 0xea48 }, 16, 0x00093180, 1},
-	{{0x27e9, 0x9fd0, 0xe7e9, 0x94c0, 0x9e21, 0x9f21, 0x94c0, 0x9621, 0x9721, 0x9f71, 0x90c0, 0x90c0, 0x90c0, 0x90c0, 0x90c0, 0x90c0 }, 16, 0x000931a0, 1},
-	{{0x94c0, 0x9620, 0x9720, 0x94c0, 0x9e20, 0x9f20, 0x98c0, 0x0666, 0x388c, 0x800a, 0xeee9, 0x96c0, 0x7b41, 0x270f, 0x80f0, 0x9ac0 }, 16, 0x000931c0, 1},
-	{{0x6d10, 0xe7ef, 0x0662, 0x388c, 0x800a, 0x96c0, 0xf641, 0x27e9, 0x9f70, 0x3224, 0x2480, 0x8009, 0x94c0, 0xf242, 0xefe8, 0x3224 }, 16, 0x000931e0, 1},
-	{{0x2960, 0x8009, 0x96c0, 0xe8ef, 0x27e9, 0x9f10, 0x98c0, 0x0c86, 0x3a58, 0x8009, 0x974b, 0x9ac0, 0x2161, 0x9f00, 0x90c0, 0x27ed }, 16, 0x00093200, 1},
-	{{0x9f68, 0x0066, 0x389c, 0x800a, 0x9ac0, 0x2c09, 0x82c0, 0x62f4, 0x2d0c, 0x8004, 0x2ef4, 0x5211, 0x9ac0, 0x3519, 0x800f, 0x5295 }, 16, 0x00093220, 1},
-	{{0x27eb, 0x9f7c, 0x98c0, 0x3e51, 0x8600, 0xf262, 0x5794, 0x98c0, 0x27e8, 0x9f10, 0x6dc5, 0x4793, 0x98c0, 0xc118, 0x0362, 0x389c }, 16, 0x00093240, 1},
-	{{0x800a, 0x27ea, 0x9f80, 0x94c8, 0xc01a, 0xc118, 0x9ac0, 0x6c90, 0x6e90, 0xc012, 0x2a00, 0x8054, 0x96c0, 0xf6fc, 0x2b0c, 0x8064 }, 16, 0x00093260, 1},
-	{{0x94c0, 0xed3a, 0xc7ff, 0x1495, 0x469c, 0x96c0, 0x9358, 0x2b03, 0x8036, 0x96c0, 0xf708, 0x27e8, 0x9ff2, 0x96c0, 0xf146, 0x27eb }, 16, 0x00093280, 1},
-	{{0x9fec, 0x0494, 0x4193, 0x3800, 0xa100, 0x4710, 0x27ea, 0x9f10, 0x9ac0, 0x27ed, 0x9f84, 0x90c0, 0x27e9, 0x9f7c, 0x27ec, 0x9f80 }, 16, 0x000932a0, 1},
-	{{0x1099, 0x549d, 0x2c7c, 0x509c, 0x7074, 0x94c0, 0xf2c6, 0x8433, 0x7072, 0x90c0, 0x94c2, 0xf488, 0x4293, 0x3602, 0xa100, 0x4410 }, 16, 0x000932c0, 1},
-	{{0x5492, 0x801a, 0x94c2, 0xf446, 0xf508, 0x5193, 0x7071, 0x90c0, 0x3682, 0xa000, 0x5692, 0x4510, 0x92c2, 0x4693, 0x3610, 0xa100 }, 16, 0x000932e0, 1},
-	{{0x7ac1, 0xea44, 0x90c0, 0x90c0, 0x1410, 0xf088, 0x96c0, 0x6c7d, 0x2161, 0x8000, 0x3277, 0x5493, 0x94c0, 0xf0c6, 0x8417, 0x62f4 }, 16, 0x00093300, 1},
-	{{0x6ef4, 0x72f4, 0x92c2, 0x6e10, 0x94c2, 0x4493, 0x4710, 0x9ac0, 0x6e90, 0x6c10, 0x9358, 0x2b03, 0x801a, 0x98c0, 0x3d60, 0x3408 }, 16, 0x00093320, 1},
-	{{0x800a, 0xf188, 0x2200, 0x8040, 0x30e5, 0x5495, 0x8417, 0x7a41, 0x96c0, 0x3614, 0x8040, 0x4495, 0x8415, 0x0295, 0x3124, 0x336c }, 16, 0x00093340, 1},
-	{{0x8009, 0x3a61, 0xd620, 0x4495, 0x92c3, 0x4095, 0x94d0, 0x7ac1, 0xed44, 0x90c0, 0x90c0, 0x30f7, 0x6f10, 0x84a5, 0x24ea, 0x3c60 }, 16, 0x00093360, 1},
-	{{0x3408, 0x800a, 0x94c7, 0xd051, 0x6c10, 0x94c6, 0xd4b6, 0x7861, 0x9ac7, 0xc940, 0x90c0, 0x7670, 0x3305, 0x8001, 0x92c2, 0xc597 }, 16, 0x00093380, 1},
-	{{0x7575, 0x3272, 0xc94c, 0x94c0, 0x7474, 0x801d, 0x2e12, 0x7c42, 0x3a41, 0xcd40, 0x9f44, 0xed1c, 0x90c0, 0x94d0, 0x7776, 0x529d }, 16, 0x000933a0, 1},
-	{{0x6f4a, 0x3676, 0x3580, 0x2000, 0x8011, 0xd63f, 0x94c0, 0xf2e4, 0x8027, 0x7175, 0x94c0, 0xf6c6, 0x844b, 0x3373, 0xcc41, 0x8441 }, 16, 0x000933c0, 1},
-	{{0x0662, 0x389c, 0x800a, 0x3024, 0x341e, 0x8009, 0x0c62, 0x3890, 0x800a, 0x1210, 0x3580, 0x2000, 0x8011, 0x7177, 0x94c0, 0xf6e4 }, 16, 0x000933e0, 1},
-	{{0x8423, 0x3375, 0x5093, 0x8419, 0x7073, 0x90c0, 0x98c2, 0xcd42, 0x0062, 0x389c, 0x800a, 0x96c2, 0x0d62, 0x3890, 0x800a, 0x3c00 }, 16, 0x00093400, 1},
-	{{0xa004, 0x6d90, 0x0866, 0x3890, 0x800a, 0xc183, 0x98c0, 0x3b60, 0x33a8, 0x800a, 0xc557, 0x98c0, 0xe8fe, 0x0266, 0x38a0, 0x800a }, 16, 0x00093420, 1},
-	{{0x9ac0, 0x7941, 0xe81b, 0x3d60, 0x3400, 0x800a, 0x9ac0, 0xd52b, 0x5590, 0x0262, 0x38a0, 0x800a, 0x9ac0, 0x2602, 0x8058, 0x7ac1 }, 16, 0x00093440, 1},
-	{{0x2702, 0x8050, 0x96c0, 0x4590, 0x2718, 0x8326, 0x159d, 0x0466, 0x33a8, 0x800a, 0x9cc0, 0x3685, 0x8001, 0xcc55, 0x3484, 0x8001 }, 16, 0x00093460, 1},
-	{{0xc154, 0x3800, 0xa004, 0xda14, 0x5395, 0xe8ed, 0x3e20, 0xa006, 0x76d3, 0x3462, 0x8001, 0xd645, 0xe83e, 0xcc5d, 0x3e40, 0xa00a }, 16, 0x00093480, 1},
-	{{0x7555, 0x7ec1, 0xdb12, 0x3660, 0x8001, 0x5690, 0x3e00, 0xac0c, 0x74d6, 0x66e1, 0x7d41, 0xd740, 0xe9ed, 0xeced, 0x3e80, 0xa80d }, 16, 0x000934a0, 1},
-	{{0x6062, 0x7cc1, 0x6661, 0x6561, 0xeaed, 0xec3a, 0x3e00, 0xb11c, 0x64e1, 0xd640, 0x34c0, 0x8001, 0xed68, 0xcd50, 0x3e20, 0xa914 }, 16, 0x000934c0, 1},
-	{{0xd4c4, 0x6761, 0x36c4, 0x8001, 0x5295, 0xc15f, 0x3e20, 0xa802, 0xd542, 0x34a3, 0x8001, 0x7fc1, 0x5094, 0xc853, 0x3e00, 0xa210 }, 16, 0x000934e0, 1},
-	{{0xd742, 0xd913, 0x6dd1, 0x36a5, 0x8001, 0xc452, 0x3e20, 0xa401, 0xd810, 0xd545, 0x67e1, 0x76d2, 0xe93f, 0xcf53, 0x3e00, 0xa001 }, 16, 0x00093500, 1},
-	{{0xd444, 0x7ec1, 0x7c41, 0x6561, 0x5191, 0xc85b, 0x3e00, 0xa902, 0x6ccf, 0x6461, 0x66e1, 0xd7c6, 0xcb51, 0xea6c, 0x3a80, 0xb008 }, 16, 0x00093520, 1},
-	{{0xd441, 0xd747, 0x5392, 0xcb5c, 0x3e00, 0xa004, 0xd440, 0xd6c3, 0xc951, 0x0166, 0x3888, 0x800a, 0x3e00, 0xa900, 0xd640, 0x3e11 }, 16, 0x00093540, 1},
-	{{0x8060, 0xd545, 0x9358, 0xce51, 0x3c00, 0xa004, 0xd6c2, 0x3762, 0x366c, 0x800a, 0xc841, 0x94c0, 0xcb54, 0xc15c, 0x3a00, 0xa300 }, 16, 0x00093560, 1},
-	{{0x2b03, 0x8054, 0xd645, 0xc055, 0x3c00, 0xa104, 0x6f90, 0xc257, 0x3c60, 0x33a0, 0x800a, 0x3a40, 0xa000, 0x3960, 0x33b0, 0x800a }, 16, 0x00093580, 1},
-	{{0xe81f, 0x3a20, 0xa000, 0x0362, 0x38a0, 0x800a, 0xc154, 0x3a00, 0xa100, 0x3d60, 0x33ac, 0x800a, 0xc356, 0x3a00, 0xa100, 0x3a60 }, 16, 0x000935a0, 1},
-	{{0x33a4, 0x800a, 0xca50, 0x38c0, 0xa000, 0xc45d, 0xc183, 0x90c0, 0x3820, 0xa004, 0x65e9, 0xcc59, 0x4790, 0x3600, 0xa100, 0xcd5c }, 16, 0x000935c0, 1},
-	{{0xce5e, 0x94c6, 0xcf59, 0x4190, 0x94c6, 0xc95c, 0x4490, 0x3626, 0xa100, 0x4490, 0xcb58, 0x3626, 0xa100, 0x4690, 0xc85e, 0x98c6 }, 16, 0x000935e0, 1},
-	{{0x2518, 0x80be, 0x90c0, 0x4190, 0x3600, 0xa004, 0xd1a1, 0xca59, 0x90c0, 0x3626, 0xa100, 0x4690, 0xc15e, 0x94c6, 0xc05c, 0x4490 }, 16, 0x00093600, 1},
-	{{0x92c2, 0x4090, 0x94c6, 0x8098, 0x4190, 0x3422, 0xa000, 0x4090, 0x3600, 0xa004, 0xd1b6, 0xc359, 0x90c0, 0x92c2, 0x4390, 0x92c2 }, 16, 0x00093620, 1},
-	{{0x4590, 0x92c2, 0x4290, 0x94c6, 0xc25c, 0x4490, 0x3626, 0xa000, 0x4690, 0x8071, 0x3640, 0xa004, 0xd1b7, 0x5093, 0x3c00, 0xac62 }, 16, 0x00093640, 1},
-	{{0x3407, 0x8001, 0x90c0, 0x3606, 0x8001, 0x3666, 0xa000, 0x4290, 0x5091, 0x3422, 0xa000, 0x4590, 0x92c2, 0x4690, 0x94c6, 0x5494 }, 16, 0x00093660, 1},
-	{{0x4490, 0x94c6, 0x803b, 0x4190, 0x1192, 0x4490, 0x7cc1, 0x64e1, 0x2fc4, 0x1495, 0xd897, 0x3800, 0xa800, 0xd4c6, 0x7e41, 0x4790 }, 16, 0x00093680, 1},
-	{{0x24e1, 0x6661, 0x3400, 0xa004, 0x6f47, 0x3640, 0xa804, 0x6f56, 0x4690, 0x3640, 0xa840, 0x6cc2, 0x4690, 0x4190, 0x3810, 0xa004 }, 16, 0x000936a0, 1},
-	{{0x79c1, 0xe844, 0xeb44, 0x94c0, 0xec44, 0xea44, 0x94c0, 0xed44, 0xe944, 0x98c0, 0x0466, 0x3888, 0x800a, 0x9258, 0x96c0, 0x7a41 }, 16, 0x000936c0, 1},
-	{{0x2a03, 0x8034, 0x9ac0, 0xd624, 0x0462, 0x3888, 0x800a, 0xc55f, 0x98c6, 0x2b02, 0x8018, 0x90c0, 0x6f10, 0x96c2, 0x0662, 0x3888 }, 16, 0x000936e0, 1},
-	{{0x800a, 0x3d60, 0x33a8, 0x800a, 0x96c0, 0x2900, 0x81dc, 0x90c0, 0x3880, 0xa000, 0x6c90, 0x9744, 0x55bf, 0x4195, 0x3618, 0xa100 }, 16, 0x00093700, 1},
-	{{0xd4c5, 0x55bf, 0x3600, 0xa100, 0xd4c5, 0xef39, 0x419d, 0x9ac0, 0x6f10, 0x3b60, 0x33a8, 0x800a, 0x9757, 0xc5ff, 0x549b, 0x7277 }, 16, 0x00093720, 1},
-	{{0x98d0, 0xd3d4, 0xd2d6, 0x7b41, 0x549b, 0x7277, 0x98c0, 0xd2d6, 0x6c10, 0x6c90, 0x9746, 0x96c0, 0x66e8, 0x2b02, 0x8002, 0x94c2 }, 16, 0x00093740, 1},
-	{{0x3e15, 0x800f, 0x98c7, 0x3960, 0x33b0, 0x800a, 0xc6ff, 0x3a60, 0x33a8, 0x800a, 0x96c3, 0x0662, 0x38a8, 0x800a, 0x96c2, 0x0562 }, 16, 0x00093760, 1},
-	{{0x38a8, 0x800a, 0x94c8, 0xc03a, 0xc039, 0x98c0, 0x3c00, 0x20a0, 0x8008, 0xe9ee, 0x98c0, 0x0664, 0x38aa, 0x800a, 0xe8ef, 0x3224 }, 16, 0x00093780, 1},
-	{{0x2ea0, 0x8009, 0x4614, 0x27e8, 0x9f10, 0xe7e8, 0x94c0, 0x9e21, 0x9f21, 0x94c0, 0x9621, 0x9721, 0x9f71, 0x35d6, 0x2d10, 0x1401 }, 16, 0x000937a0, 1},
-	{{0x8292, 0x2000, 0x8340, 0x2c7d, 0xc194, 0x2000, 0x8100, 0x6c7c, 0x4418, 0x1601, 0x8294, 0x6e7c, 0x4618, 0x1601, 0x8298, 0x76d6 }, 16, 0x000937c0, 1},
-	{{0x6d7d, 0x7755, 0x6e7c, 0x2704, 0x8081, 0x4610, 0xe844, 0x92c8, 0x4298, 0x9f70, 0x7753, 0x3324, 0x3f30, 0x8009, 0x2f10, 0x1000 }, 16, 0x000937e0, 1},
-	{{0x9122, 0x246a, 0x0891, 0x8002, 0x270a, 0x8260, 0xe7ea, 0x290a, 0x8002, 0x843e, 0x00f8, 0x9dc4, 0x27ee, 0x9fcc, 0xefe8, 0x109f }, 16, 0x00093800, 1},
-	{{0x1801, 0xa00a, 0x3100, 0x2000, 0x8010, 0x09f8, 0x9dc0, 0x0af8, 0x9dbc, 0x32c4, 0x3b40, 0x8008, 0xc84f, 0x3b41, 0x001e, 0xc847 }, 16, 0x00093820, 1},
-	{{0x19f8, 0x9dc0, 0x1100, 0x9122, 0x30f6, 0x1af8, 0x9dbc, 0x81d1, 0x2d10, 0x00e5, 0x21d8, 0x8009, 0x3560, 0x02f8, 0x9db8, 0x3181 }, 16, 0x00093840, 1},
-	{{0x2000, 0x8000, 0x3579, 0x02f8, 0x9db4, 0x2000, 0x8081, 0x27ec, 0x9fcc, 0x27ee, 0x9dc8, 0x290f, 0x8008, 0x00f8, 0x9db0, 0x38e0 }, 16, 0x00093860, 1},
-	{{0x21d8, 0x8009, 0x02f8, 0x9dac, 0x1bf8, 0x9d84, 0x09f8, 0x9dc0, 0x109b, 0x0af8, 0x9dbc, 0x109b, 0xf042, 0xf041, 0x08f8, 0x9da8 }, 16, 0x00093880, 1},
-	{{0x0bf8, 0x9da4, 0x3204, 0x2fca, 0x8009, 0xcc4e, 0x34d0, 0x12f8, 0x9db8, 0xd52f, 0xcc46, 0x19f8, 0x9dc0, 0x1af8, 0x9dbc, 0x18f8 }, 16, 0x000938a0, 1},
-	{{0x9da8, 0x1bf8, 0x9da4, 0x8414, 0x92c3, 0x6f90, 0xd53f, 0x840c, 0x94c3, 0x2741, 0x8ccc, 0x2761, 0x9333, 0x12f8, 0x9db4, 0x6569 }, 16, 0x000938c0, 1},
-	{{0x8409, 0xe841, 0x92f8, 0xec42, 0x3961, 0x5054, 0x1251, 0x02f8, 0x9db4, 0x6032, 0x6469, 0x8044, 0x94c2, 0x2561, 0x9fff, 0x24e9 }, 16, 0x000938e0, 1},
-	{{0xcc4e, 0x8038, 0x92c2, 0x5552, 0x1801, 0xa012, 0x32a4, 0x2f54, 0x8008, 0x08f8, 0x9da8, 0x12f8, 0x9dac, 0x2e92, 0x1af8, 0x9dbc }, 16, 0x00093900, 1},
-	{{0x3ec8, 0xcc46, 0x26e5, 0x1152, 0x18f8, 0x9da8, 0x3ec8, 0x19f8, 0x9dc0, 0x36dd, 0x1bf8, 0x9da4, 0x6d7c, 0x20bb, 0x1697, 0x10f8 }, 16, 0x00093920, 1},
-	{{0x9db0, 0x3861, 0x12f8, 0x9db8, 0x246a, 0x2c05, 0x20f7, 0x3941, 0x00f8, 0x9db0, 0x2cf7, 0x02f8, 0x9db8, 0x6cd1, 0x3651, 0x3551 }, 16, 0x00093940, 1},
-	{{0x35d1, 0x419f, 0x2076, 0x3651, 0x6175, 0x6c76, 0x3650, 0x7451, 0x6d74, 0x6c08, 0x70c0, 0x8116, 0x415e, 0x2704, 0x8081, 0x27ea }, 16, 0x00093960, 1},
-	{{0x9eca, 0x27e8, 0x9dc8, 0x92d0, 0x5018, 0x401a, 0x2300, 0x8081, 0x27ee, 0x9eca, 0x2200, 0x8080, 0x6f90, 0xb68a, 0x2c10, 0x2e1f }, 16, 0x00093980, 1},
-	{{0xd747, 0x2c10, 0x2e7d, 0xcf40, 0x6c7c, 0x3276, 0x2c16, 0xc844, 0x801a, 0x7841, 0x2b03, 0x800c, 0x9b40, 0x27ea, 0x9dc8, 0xea08 }, 16, 0x000939a0, 1},
-	{{0x94d0, 0xcf4d, 0x541a, 0xd6c4, 0xcf45, 0x36c0, 0x34f0, 0x3753, 0xcf4c, 0xd645, 0xc081, 0x3244, 0x2000, 0x8009, 0xcf44, 0x35d6 }, 16, 0x000939c0, 1},
-	{{0x3bc1, 0xd890, 0x39e1, 0xcf48, 0x2274, 0x25ea, 0x19f8, 0x9dc0, 0x2e74, 0x10f8, 0x9dc4, 0x7e48, 0x6665, 0x7e48, 0x765c, 0x6c7c }, 16, 0x000939e0, 1},
-	{{0x2200, 0x8080, 0x8196, 0x445e, 0x2304, 0x8081, 0x2b03, 0x800c, 0x19f8, 0x9d84, 0x27e8, 0x9eca, 0x1091, 0x5158, 0x6174, 0x6d74 }, 16, 0x00093a00, 1},
-	{{0x4299, 0x5091, 0x92d0, 0x6174, 0x6d74, 0x4299, 0x27e8, 0x9da0, 0x3024, 0x3f50, 0x8009, 0xe7e8, 0x3104, 0x2486, 0x8009, 0x3324 }, 16, 0x00093a20, 1},
-	{{0x3f30, 0x8009, 0x2f90, 0x2e10, 0x2e90, 0x0986, 0x3a58, 0x8009, 0xeee8, 0x1301, 0x828a, 0x2f7c, 0xc6e2, 0x0701, 0x828a, 0x0886 }, 16, 0x00093a40, 1},
-	{{0x3a58, 0x8009, 0xc798, 0x35d7, 0x1000, 0x828c, 0x2c7c, 0x2c10, 0xe758, 0x0400, 0x828c, 0x0886, 0x3a58, 0x8009, 0x90c0, 0x1100 }, 16, 0x00093a60, 1},
-	{{0x828e, 0x6d7c, 0x0500, 0x828e, 0x0886, 0x3a58, 0x8009, 0x90c0, 0x1200, 0x8290, 0x6e7c, 0x0600, 0x8290, 0x0006, 0x8018, 0x0886 }, 16, 0x00093a80, 1},
-	{{0x3a58, 0x8009, 0x90c0, 0x1000, 0x828a, 0x7c49, 0x4096, 0x0886, 0x3a58, 0x8009, 0x90c0, 0x1000, 0x828c, 0x7c49, 0xb071, 0x0886 }, 16, 0x00093aa0, 1},
-	{{0x3a58, 0x8009, 0x90c0, 0x1100, 0x828e, 0x3cc3, 0x0106, 0x801a, 0x64e8, 0x92c2, 0x6c10, 0x94c7, 0x67e8, 0xc0ff, 0x92c2, 0x6d10 }, 16, 0x00093ac0, 1},
-	{{0x32e4, 0x3d8c, 0x8001, 0x92c3, 0xc2ff, 0x2300, 0x83e8, 0x32e4, 0x3d74, 0x8001, 0x6d10, 0xb172, 0x0886, 0x3a58, 0x8009, 0x90c0 }, 16, 0x00093ae0, 1},
-	{{0x1600, 0x8290, 0x6768, 0x8010, 0x96c2, 0x3000, 0x2000, 0xbfe0, 0x3010, 0x2000, 0xbfe0, 0x2c90, 0x3208, 0x2000, 0x8170, 0x32e4 }, 16, 0x00093b00, 1},
-	{{0x3e52, 0x8001, 0x6d90, 0x32e4, 0x3ea0, 0x8001, 0x37d0, 0x3456, 0x7751, 0x2760, 0x3550, 0x35d1, 0x7457, 0x32e4, 0x3eac, 0x8001 }, 16, 0x00093b20, 1},
-	{{0x74d6, 0x33e4, 0x3ebe, 0x8001, 0x3304, 0x2a86, 0x8009, 0x3650, 0x30e0, 0x2865, 0x8006, 0xb3f1, 0x25e8, 0x3111, 0x2000, 0x9800 }, 16, 0x00093b40, 1},
-	{{0xb473, 0x32e4, 0x3d74, 0x8001, 0x94c1, 0xc2ff, 0x6d10, 0x3551, 0x24e1, 0x3000, 0x2000, 0x8200, 0x2aff, 0x9ec1, 0xb274, 0x2aff }, 16, 0x00093b60, 1},
-	{{0x9ebb, 0xb1f2, 0x37d0, 0x3960, 0x3f84, 0x800a, 0x9745, 0x27e8, 0x9fe8, 0x92d0, 0x5199, 0x4198, 0x27e4, 0x3140, 0x3477, 0x8171 }, 16, 0x00093b80, 1},
-	{{0x67e9, 0x2418, 0x80e2, 0x96c2, 0x3000, 0x2000, 0x8100, 0x7457, 0x2aff, 0x9e89, 0x6466, 0x27e8, 0x3100, 0x2000, 0x8080, 0xd441 }, 16, 0x00093ba0, 1},
-	{{0x31ee, 0x9f00, 0x98c7, 0x3160, 0x3218, 0x80b1, 0x6764, 0x2aff, 0x9e6b, 0x7456, 0x6f83, 0x2aff, 0x9e63, 0x34d7, 0x7457, 0xf1c2 }, 16, 0x00093bc0, 1},
-	{{0x2aff, 0x9e59, 0xcf40, 0x3550, 0xcf49, 0x3451, 0xf1c3, 0x2aff, 0x9e4b, 0x6cd8, 0x3550, 0xcf49, 0x3451, 0xf1c4, 0x2aff, 0x9e3d }, 16, 0x00093be0, 1},
-	{{0x6cd8, 0x3550, 0xcf49, 0x3451, 0xf1c5, 0x2aff, 0x9e2f, 0x6cd8, 0x3550, 0xcf49, 0x3451, 0xf1c6, 0x2aff, 0x9e21, 0x6cd8, 0x3550 }, 16, 0x00093c00, 1},
-	{{0x3457, 0x3100, 0x2000, 0x8200, 0x6d58, 0x2aff, 0x9e0f, 0xcf42, 0x2468, 0x34d0, 0xcf4a, 0x2fab, 0xc298, 0x94c1, 0xc0ff, 0x6c10 }, 16, 0x00093c20, 1},
-	{{0x2568, 0x75d2, 0x92c2, 0x6d10, 0x32e4, 0x3d8c, 0x8001, 0x92c3, 0xc2ff, 0x27e8, 0x75d7, 0x92c2, 0x6d10, 0x32e4, 0x3d74, 0x8001 }, 16, 0x00093c40, 1},
-	{{0x92c3, 0xc2ff, 0x2768, 0x24e1, 0x3000, 0x2000, 0x8100, 0x800c, 0x6cd1, 0x6764, 0x7f78, 0x8808, 0xd41e, 0x7f78, 0xd416, 0x2aff }, 16, 0x00093c60, 1},
-	{{0x9dbb, 0x6461, 0x2c90, 0x1206, 0x801a, 0x7941, 0x656a, 0x8424, 0xb075, 0x2e09, 0x801c, 0x2c10, 0xe8e9, 0x9756, 0x90c0, 0x92c8 }, 16, 0x00093c80, 1},
-	{{0x4098, 0x38c1, 0x1006, 0x801a, 0x7841, 0x7071, 0x81ea, 0x2909, 0x8058, 0x9356, 0x2b03, 0x8008, 0x2e08, 0x8494, 0x92d0, 0xb0f3 }, 16, 0x00093ca0, 1},
-	{{0x7440, 0x4018, 0x3024, 0x3f50, 0x8009, 0xe778, 0x36d0, 0x24e9, 0x35c1, 0xf085, 0xd215, 0x6664, 0x6c7d, 0x2d20, 0xd694, 0x66e1 }, 16, 0x00093cc0, 1},
-	{{0x800c, 0x6c4d, 0x33e4, 0x3c48, 0x8001, 0x8805, 0x6c10, 0x3024, 0x3ee0, 0x8009, 0x74f2, 0x3324, 0x3f30, 0x8009, 0x270a, 0x8020 }, 16, 0x00093ce0, 1},
-	{{0x2c10, 0xe7ea, 0x9756, 0x280e, 0x8494, 0xeaee, 0x92c8, 0x401a, 0x1100, 0x801a, 0x64ea, 0x8429, 0x280c, 0x8074, 0x2a00, 0x8058 }, 16, 0x00093d00, 1},
-	{{0x9756, 0x2be2, 0x9fea, 0x2a02, 0x8017, 0xebec, 0x92d0, 0x51bb, 0x41b3, 0x3841, 0x1100, 0x801a, 0x30f0, 0xec1a, 0x81e5, 0x2d10 }, 16, 0x00093d20, 1},
-	{{0xefee, 0x2a00, 0x8478, 0x2300, 0x8058, 0xef3a, 0xcf49, 0x9756, 0x6893, 0xca41, 0x90c0, 0x92c8, 0x429a, 0x2c10, 0xc196, 0x2909 }, 16, 0x00093d40, 1},
-	{{0x8058, 0xf043, 0xf144, 0xfacf, 0xc694, 0x3700, 0x2000, 0x8010, 0x1391, 0x1100, 0x8018, 0x24ea, 0xcf48, 0x845d, 0x38e1, 0xfbc3 }, 16, 0x00093d60, 1},
-	{{0x3e11, 0x8058, 0x1090, 0xd4c0, 0xcc41, 0xf845, 0xec1b, 0x1194, 0xf946, 0x2aff, 0x9ca7, 0xfa47, 0x3550, 0xf8c5, 0xfac7, 0x1190 }, 16, 0x00093d80, 1},
-	{{0x3000, 0x2000, 0x8100, 0x2c31, 0x1192, 0xf248, 0x7cc4, 0xf142, 0x2aff, 0x9c89, 0xf1c2, 0xf8c5, 0xf2c8, 0x2d52, 0xcf49, 0x1300 }, 16, 0x00093da0, 1},
-	{{0x8018, 0x2000, 0x8058, 0x2893, 0xfbc3, 0xcc41, 0xf9c6, 0xec1b, 0x881a, 0x0294, 0xfac7, 0x3dc4, 0xcf4a, 0x2000, 0x8058, 0x2911 }, 16, 0x00093dc0, 1},
-	{{0xfbc3, 0xcc42, 0x90c0, 0xec1b, 0x4394, 0x1100, 0x801a, 0x1200, 0x8018, 0x30f2, 0x6c18, 0x8069, 0x2200, 0x8058, 0x3401, 0x8002 }, 16, 0x00093de0, 1},
-	{{0xd891, 0x3600, 0x8002, 0xd4c0, 0xcc41, 0xfbc3, 0xec1f, 0xb0c5, 0xec1b, 0x1194, 0xf845, 0xf946, 0x2aff, 0x9c21, 0xfa47, 0x2469 }, 16, 0x00093e00, 1},
-	{{0x34d0, 0xfac7, 0xf8c5, 0x8032, 0x1092, 0xf9c6, 0x3c44, 0x1801, 0xa008, 0xf042, 0x2aff, 0x9e99, 0xf0c2, 0x34d0, 0xf601, 0x32c4 }, 16, 0x00093e20, 1},
-	{{0x3b40, 0x8008, 0x2000, 0x8100, 0x2469, 0x2d03, 0xf8c5, 0x3d65, 0xf9c6, 0x800c, 0xfac7, 0x880d, 0x880a, 0x2260, 0x9fff, 0xb0c3 }, 16, 0x00093e40, 1},
-	{{0x7540, 0x3672, 0xf0c3, 0x3844, 0xf1c4, 0x38e1, 0xf043, 0x24ea, 0xf144, 0xb0c3, 0x3440, 0xea44, 0x3470, 0xe944, 0x6c7c, 0x2cff }, 16, 0x00093e60, 1},
-	{{0x9ef3, 0x441e, 0x1100, 0x8018, 0x38c1, 0x1000, 0x801a, 0x34f1, 0x0100, 0x8018, 0x7071, 0x8007, 0x0000, 0x8018, 0x27e8, 0x9fe0 }, 16, 0x00093e80, 1},
-	{{0x3024, 0x3f50, 0x8009, 0xe7e8, 0x90c0, 0x90c0, 0x90c0, 0x90c0, 0x64e8, 0x2418, 0x8020, 0x92c3, 0x64e6, 0xd4a8, 0x90c0, 0x94c3 }, 16, 0x00093ea0, 1},
-	{{0x9f70, 0xd411, 0x92c3, 0x6465, 0x96c2, 0x8ff2, 0x78e8, 0x7c48, 0x6465, 0x94c0, 0x9f70, 0xd419, 0x6465, 0x90c0, 0x90c0, 0x90c0 }, 16, 0x00093ec0, 1},
-	{{0xd4a8, 0x90c0, 0x94c3, 0x9f70, 0xd411, 0x92c3, 0x6465, 0x96c2, 0x8ff2, 0x78e8, 0x7c48, 0x6465, 0x90c0, 0x90c0, 0x90c0, 0x90c0 }, 16, 0x00093ee0, 1},
-	{{0x94c0, 0x9220, 0x9320, 0x9420, 0x6d6c, 0x75fa, 0x6d70, 0x6d60, 0xda12, 0x6661, 0x6d74, 0x6ccc, 0x7452, 0x64e0, 0x9421, 0x94c0 }, 16, 0x00093f00, 1},
-	{{0x9221, 0x9321, 0x9f71, 0x90c0, 0x90c0, 0x90c0, 0x90c0, 0x90c0, 0x94c0, 0x9e20, 0x9f20, 0x94c0, 0xfec4, 0xffc3, 0x94c0, 0x9e20 }, 16, 0x00093f20, 1},
-	{{0x9f20, 0x94c0, 0xf646, 0xf745, 0x9f71, 0x90c0, 0x90c0, 0x90c0, 0x94c0, 0x9e21, 0x9f21, 0x94c0, 0x9621, 0x9721, 0x9f75, 0x90c0 }, 16, 0x00093f40, 1},
-	{{0x9530, 0x1005, 0xa004, 0x90c0, 0x90c0, 0x9220, 0x7550, 0xd0a1, 0x8029, 0x34f1, 0x9fff, 0x8021, 0x9750, 0xd891, 0x6466, 0x6c50 }, 16, 0x00093f60, 1},
-	{{0x1005, 0xa001, 0x90c0, 0x90c0, 0x92c8, 0x7051, 0x7470, 0xdd11, 0x656a, 0x2518, 0x8006, 0x6464, 0x9221, 0x9531, 0x90c0, 0x90c0 }, 16, 0x00093f80, 1},
-	{{0x9f71, 0x90c0, 0x90c0, 0x90c0, 0x90c0, 0x90c0, 0x90c0, 0x90c0, 0x9530, 0x1005, 0xa004, 0x90c0, 0x90c0, 0x9220, 0x7478, 0x74f9 }, 16, 0x00093fa0, 1},
-	{{0x3260, 0x3fff, 0x8000, 0xd0a1, 0x2518, 0x8026, 0x70fa, 0x2518, 0x8014, 0x9750, 0x6c50, 0xd891, 0x92c8, 0x7051, 0x7470, 0x2118 }, 16, 0x00093fc0, 1},
-	{{0x8010, 0x7061, 0x92c3, 0x7079, 0x6c10, 0x92c2, 0x7841, 0x9221, 0x9531, 0x90c0, 0x90c0, 0x9f71, 0x90c0, 0x90c0, 0x90c0, 0x90c0 }, 16, 0x00093fe0, 1},
-	{{0x9750, 0x1005, 0xa001, 0xd810, 0xd891, 0x92c8, 0x7051, 0x7470, 0x9f71, 0x90c0, 0x90c0, 0x90c0, 0x90c0, 0x90c0, 0x90c0, 0x90c0 }, 16, 0x00094000, 1},
-	{{0x9530, 0x1005, 0xa004, 0x90c0, 0x90c0, 0x9220, 0x64e8, 0x8417, 0x9750, 0x7478, 0xd911, 0x92c8, 0x7052, 0xd818, 0x6468, 0x92c3 }, 16, 0x00094020, 1},
-	{{0x6c51, 0x8809, 0x7079, 0x92c2, 0x6c31, 0x9221, 0x9531, 0x90c0, 0x90c0, 0x9f71, 0x90c0, 0x90c0, 0x90c0, 0x90c0, 0x90c0, 0x90c0 }, 16, 0x00094040, 1},
-	{{0x0009, 0x4ba4, 0x0009, 0x4c78, 0x0009, 0x4bac, 0x0000, 0x0018, 0x0000, 0x0000, 0x0009, 0x92e0, 0x0009, 0x4c90, 0x0000, 0x0010 }, 16, 0x00094060, 1},
-	{{0x0000, 0x0000, 0x0009, 0x9300, 0x0009, 0x4ca0, 0x0000, 0x0010, 0x0000, 0x0000, 0x0009, 0x9340, 0x0009, 0x4cb0, 0x0000, 0x0000 }, 16, 0x00094080, 1},
-	{{0x0000, 0x0004, 0x0009, 0x9a30, 0x0009, 0x4cb4, 0x0000, 0x0002, 0x0000, 0x0000, 0x0009, 0x9a32, 0x0009, 0x4cb6, 0x0000, 0x0002 }, 16, 0x000940a0, 1},
-	{{0x0000, 0x0000, 0x0009, 0x9a37, 0x0009, 0x4cb8, 0x0000, 0x0000, 0x0000, 0x0001, 0x0009, 0x9a3a, 0x0009, 0x4cb9, 0x0000, 0x0000 }, 16, 0x000940c0, 1},
-	{{0x0000, 0x0001, 0x0009, 0x9a4c, 0x0009, 0x4cfc, 0x0000, 0x0004, 0x0000, 0x0000, 0x0009, 0x9a50, 0x0009, 0x4d00, 0x0000, 0x0004 }, 16, 0x000940e0, 1},
-	{{0x0000, 0x0000, 0x0009, 0x9a54, 0x0009, 0x4d04, 0x0000, 0x0004, 0x0000, 0x0000, 0x0009, 0x9a58, 0x0009, 0x4d08, 0x0000, 0x0004 }, 16, 0x00094100, 1},
-	{{0x0000, 0x0000, 0x0009, 0x9a5c, 0x0009, 0x4d0c, 0x0000, 0x0000, 0x0000, 0x0001, 0x0009, 0x9a5d, 0x0009, 0x4d0d, 0x0000, 0x0000 }, 16, 0x00094120, 1},
-	{{0x0000, 0x0001, 0x0009, 0x9a5e, 0x0009, 0x4d0e, 0x0000, 0x0000, 0x0000, 0x0001, 0x0009, 0xa8c0, 0x0009, 0x4d3c, 0x0000, 0x000c }, 16, 0x00094140, 1},
-	{{0x0000, 0x0000, 0x0009, 0xa8cc, 0x0009, 0x4d48, 0x0000, 0x000c, 0x0000, 0x0000, 0x0009, 0xa8d8, 0x0009, 0x4d54, 0x0000, 0x0000 }, 16, 0x00094160, 1},
-	{{0x0000, 0x0004, 0x0009, 0xa8dc, 0x0009, 0x4d58, 0x0000, 0x0000, 0x0000, 0x0004, 0x0009, 0xa8e0, 0x0009, 0x4d5c, 0x0000, 0x0000 }, 16, 0x00094180, 1},
-	{{0x0000, 0x0004, 0x0009, 0xa8e4, 0x0009, 0x4d60, 0x0000, 0x0000, 0x0000, 0x0004, 0x0009, 0xa8e8, 0x0009, 0x4d64, 0x0000, 0x0000 }, 16, 0x000941a0, 1},
-	{{0x0000, 0x0004, 0x0009, 0xa8ec, 0x0009, 0x4d68, 0x0000, 0x0000, 0x0000, 0x0004, 0x0009, 0xb1f6, 0x0009, 0x4d6e, 0x0000, 0x0002 }, 16, 0x000941c0, 1},
-	{{0x0000, 0x0000, 0x0009, 0xb1fa, 0x0009, 0x4d72, 0x0000, 0x0002, 0x0000, 0x0000, 0x0009, 0xb1fc, 0x0009, 0x4d74, 0x0000, 0x0000 }, 16, 0x000941e0, 1},
-	{{0x0000, 0x0001, 0x0009, 0xb598, 0x0009, 0x4d78, 0x0000, 0x0000, 0x0000, 0x0004, 0x0009, 0xb59c, 0x0009, 0x4d7c, 0x0000, 0x0004 }, 16, 0x00094200, 1},
-	{{0x0000, 0x0000, 0x0009, 0xb5a0, 0x0009, 0x4d80, 0x0000, 0x0004, 0x0000, 0x0000, 0x0009, 0xb5a4, 0x0009, 0x4d84, 0x0000, 0x0000 }, 16, 0x00094220, 1},
-	{{0x0000, 0x0004, 0x0009, 0xb5a8, 0x0009, 0x4d88, 0x0000, 0x0004, 0x0000, 0x0000, 0x0009, 0xb7ac, 0x0009, 0x4d8c, 0x0000, 0x0000 }, 16, 0x00094240, 1},
-	{{0x0000, 0x0002, 0x0009, 0xb7ae, 0x0009, 0x4d8e, 0x0000, 0x0002, 0x0000, 0x0000, 0x0009, 0xb7b0, 0x0009, 0x4d90, 0x0000, 0x0002 }, 16, 0x00094260, 1},
-	{{0x0000, 0x0000, 0x0009, 0xb7b2, 0x0009, 0x4d92, 0x0000, 0x0000, 0x0000, 0x0002, 0x0009, 0xb7b4, 0x0009, 0x4d94, 0x0000, 0x0000 }, 16, 0x00094280, 1},
-	{{0x0000, 0x0001, 0x0009, 0xb7b5, 0x0009, 0x4d95, 0x0000, 0x0000, 0x0000, 0x0001, 0x0009, 0xb7b6, 0x0009, 0x4d96, 0x0000, 0x0000 }, 16, 0x000942a0, 1},
-	{{0x0000, 0x0001, 0x0009, 0xb7b7, 0x0009, 0x4d97, 0x0000, 0x0000, 0x0000, 0x0001, 0x0009, 0xd200, 0x0009, 0x4d98, 0x0000, 0x0020 }, 16, 0x000942c0, 1},
-	{{0x0000, 0x0000, 0x0009, 0xd220, 0x0009, 0x4db8, 0x0000, 0x0020, 0x0000, 0x0000, 0x0009, 0xd4a8, 0x0009, 0x4dd8, 0x0000, 0x0010 }, 16, 0x000942e0, 1},
-	{{0x0000, 0x0000, 0x0009, 0xd4b8, 0x0009, 0x4de8, 0x0000, 0x0010, 0x0000, 0x0000, 0x0009, 0xd4c8, 0x0009, 0x4df8, 0x0000, 0x0010 }, 16, 0x00094300, 1},
-	{{0x0000, 0x0000, 0x0009, 0xd4d8, 0x0009, 0x4e08, 0x0000, 0x0010, 0x0000, 0x0000, 0x0009, 0xd7b8, 0x0009, 0x4e18, 0x0000, 0x0004 }, 16, 0x00094320, 1},
-	{{0x0000, 0x0000, 0x0009, 0xd7bc, 0x0009, 0x4e1c, 0x0000, 0x0000, 0x0000, 0x0004, 0x0009, 0xd7c0, 0x0009, 0x4e20, 0x0000, 0x0004 }, 16, 0x00094340, 1},
-	{{0x0000, 0x0000, 0x0009, 0xd7c8, 0x0009, 0x4e24, 0x0000, 0x0000, 0x0000, 0x0004, 0x0009, 0xd7cc, 0x0009, 0x4e28, 0x0000, 0x0000 }, 16, 0x00094360, 1},
-	{{0x0000, 0x0004, 0x0009, 0xd7d0, 0x0009, 0x4e2c, 0x0000, 0x0000, 0x0000, 0x0004, 0x0009, 0xd7dc, 0x0009, 0x4e30, 0x0000, 0x0004 }, 16, 0x00094380, 1},
-	{{0x0000, 0x0000, 0x0009, 0xdbf0, 0x0009, 0x4e34, 0x0000, 0x0029, 0x0000, 0x0001, 0x0009, 0xdc1a, 0x0009, 0x4e5e, 0x0000, 0x0024 }, 16, 0x000943a0, 1},
-	{{0x0000, 0x0001, 0x0009, 0xdc3f, 0x0009, 0x4e83, 0x0000, 0x0023, 0x0000, 0x0001, 0x0009, 0xdc63, 0x0009, 0x4ea7, 0x0000, 0x001e }, 16, 0x000943c0, 1},
-	{{0x0000, 0x0001, 0x0009, 0xdc82, 0x0009, 0x4ec6, 0x0000, 0x001d, 0x0000, 0x0001, 0x0009, 0xdca0, 0x0009, 0x4ee4, 0x0000, 0x001b }, 16, 0x000943e0, 1},
-	{{0x0000, 0x0001, 0x0009, 0xdcbc, 0x0009, 0x4f00, 0x0000, 0x0016, 0x0000, 0x0001, 0x0009, 0xdcd3, 0x0009, 0x4f17, 0x0000, 0x0015 }, 16, 0x00094400, 1},
-	{{0x0000, 0x0001, 0x0009, 0xdce9, 0x0009, 0x4f2d, 0x0000, 0x0014, 0x0000, 0x0001, 0x0009, 0xdcfe, 0x0009, 0x4f42, 0x0000, 0x0012 }, 16, 0x00094420, 1},
-	{{0x0000, 0x0001, 0x0009, 0xdd11, 0x0009, 0x4f55, 0x0000, 0x0011, 0x0000, 0x0001, 0x0009, 0xdd23, 0x0009, 0x4f67, 0x0000, 0x0010 }, 16, 0x00094440, 1},
-	{{0x0000, 0x0001, 0x0009, 0xdd34, 0x0009, 0x4f78, 0x0000, 0x000f, 0x0000, 0x0001, 0x0009, 0xdd44, 0x0009, 0x4f88, 0x0000, 0x000f }, 16, 0x00094460, 1},
-	{{0x0000, 0x0001, 0x0009, 0xdd54, 0x0009, 0x4f98, 0x0000, 0x000e, 0x0000, 0x0001, 0x0009, 0xdd63, 0x0009, 0x4fa7, 0x0000, 0x000e }, 16, 0x00094480, 1},
-	{{0x0000, 0x0001, 0x0009, 0xdd72, 0x0009, 0x4fb6, 0x0000, 0x0007, 0x0000, 0x0001, 0x0009, 0xdd7a, 0x0009, 0x4fbe, 0x0000, 0x0006 }, 16, 0x000944a0, 1},
-	{{0x0000, 0x0001, 0x0009, 0xdd81, 0x0009, 0x4fc5, 0x0000, 0x0006, 0x0000, 0x0001, 0x0009, 0xdd88, 0x0009, 0x4fcc, 0x0000, 0x0005 }, 16, 0x000944c0, 1},
-	{{0x0000, 0x0001, 0x0009, 0xdd8e, 0x0009, 0x4fd2, 0x0000, 0x0004, 0x0000, 0x0001, 0x0009, 0xdd93, 0x0009, 0x4fd7, 0x0000, 0x0004 }, 16, 0x000944e0, 1},
-	{{0x0000, 0x0001, 0x0009, 0xdd9c, 0x0009, 0x4fdc, 0x0000, 0x0002, 0x0000, 0x0001, 0x0009, 0xdd9f, 0x0009, 0x4fdf, 0x0000, 0x0002 }, 16, 0x00094500, 1},
-	{{0x0000, 0x0001, 0x0009, 0xdda2, 0x0009, 0x4fe2, 0x0000, 0x0002, 0x0000, 0x0001, 0x0009, 0xdda5, 0x0009, 0x4fe5, 0x0000, 0x0002 }, 16, 0x00094520, 1},
-	{{0x0000, 0x0001, 0x0009, 0xdda8, 0x0009, 0x4fe8, 0x0000, 0x0001, 0x0000, 0x0000, 0x0009, 0xdda9, 0x0009, 0x4fe9, 0x0000, 0x0000 }, 16, 0x00094540, 1},
-	{{0x0000, 0x0001, 0x0009, 0xddaa, 0x0009, 0x4fea, 0x0000, 0x0000, 0x0000, 0x0001, 0x0009, 0xddab, 0x0009, 0x4feb, 0x0000, 0x0000 }, 16, 0x00094560, 1},
-	{{0x0000, 0x0001, 0x0009, 0xddac, 0x0009, 0x4fec, 0x0000, 0x0000, 0x0000, 0x0001, 0x0009, 0xddad, 0x0009, 0x4fed, 0x0000, 0x0000 }, 16, 0x00094580, 1},
-	{{0x0000, 0x0001, 0x0009, 0xddae, 0x0009, 0x4fee, 0x0000, 0x0000, 0x0000, 0x0001, 0x0009, 0xde04, 0x0009, 0x5444, 0x0000, 0x0000 }, 16, 0x000945a0, 1},
-	{{0x0000, 0x0004, 0x0009, 0xde08, 0x0009, 0x5448, 0x0000, 0x0000, 0x0000, 0x0004, 0x0009, 0xde10, 0x0009, 0x544c, 0x0000, 0x0000 }, 16, 0x000945c0, 1},
-	{{0x0000, 0x0004, 0x0009, 0xde14, 0x0009, 0x5450, 0x0000, 0x0000, 0x0000, 0x0004, 0x0009, 0xde18, 0x0009, 0x5454, 0x0000, 0x0000 }, 16, 0x000945e0, 1},
-	{{0x0000, 0x0004, 0x0009, 0xde1c, 0x0009, 0x5458, 0x0000, 0x0000, 0x0000, 0x0004, 0x0009, 0xde20, 0x0009, 0x545c, 0x0000, 0x0000 }, 16, 0x00094600, 1},
-	{{0x0000, 0x0004, 0x0009, 0xde24, 0x0009, 0x5460, 0x0000, 0x0004, 0x0000, 0x0000, 0x0009, 0xde2c, 0x0009, 0x5464, 0x0000, 0x0000 }, 16, 0x00094620, 1},
-	{{0x0000, 0x0004, 0x0009, 0xde38, 0x0009, 0x5468, 0x0000, 0x0000, 0x0000, 0x0004, 0x0009, 0xde40, 0x0009, 0x546c, 0x0000, 0x0000 }, 16, 0x00094640, 1},
-	{{0x0000, 0x0004, 0x0009, 0xde54, 0x0009, 0x5470, 0x0000, 0x0002, 0x0000, 0x0000, 0x0009, 0xde56, 0x0009, 0x5472, 0x0000, 0x0002 }, 16, 0x00094660, 1},
-	{{0x0000, 0x0000, 0x0009, 0xde58, 0x0009, 0x5474, 0x0000, 0x0001, 0x0000, 0x0000, 0x0009, 0xde59, 0x0009, 0x5475, 0x0000, 0x0000 }, 16, 0x00094680, 1},
-	{{0x0000, 0x0001, 0x0009, 0xde5c, 0x0009, 0x5478, 0x0000, 0x0048, 0x0000, 0x0000, 0x0009, 0xdea4, 0x0009, 0x54c0, 0x0000, 0x0000 }, 16, 0x000946a0, 1},
-	{{0x0000, 0x00c0, 0x0009, 0xdf64, 0x0009, 0x5580, 0x0000, 0x0000, 0x0000, 0x00c0, 0x0009, 0xe024, 0x0009, 0x5b08, 0x0000, 0x0000 }, 16, 0x000946c0, 1},
-	{{0x0000, 0x0004, 0x0009, 0xe028, 0x0009, 0x5b0c, 0x0000, 0x0008, 0x0000, 0x0000, 0x0009, 0xe030, 0x0009, 0x5b14, 0x0000, 0x0002 }, 16, 0x000946e0, 1},
-	{{0x0000, 0x0000, 0x0009, 0xe034, 0x0009, 0x5b18, 0x0000, 0x0012, 0x0000, 0x0000, 0x0009, 0xe046, 0x0009, 0x5b2a, 0x0000, 0x0002 }, 16, 0x00094700, 1},
-	{{0x0000, 0x0000, 0x0009, 0xe048, 0x0009, 0x5b2c, 0x0000, 0x0002, 0x0000, 0x0000, 0x0009, 0xe04a, 0x0009, 0x5b2e, 0x0000, 0x0002 }, 16, 0x00094720, 1},
-	{{0x0000, 0x0000, 0x0009, 0xe04c, 0x0009, 0x5b30, 0x0000, 0x0002, 0x0000, 0x0000, 0x0009, 0xe128, 0x0009, 0x5b54, 0x0000, 0x001c }, 16, 0x00094740, 1},
-	{{0x0000, 0x0000, 0x0009, 0xe144, 0x0009, 0x5b70, 0x0000, 0x0002, 0x0000, 0x0000, 0x0009, 0xe148, 0x0009, 0x5b74, 0x0000, 0x0002 }, 16, 0x00094760, 1},
-	{{0x0000, 0x0000, 0x0009, 0xe14a, 0x0009, 0x5b76, 0x0000, 0x0000, 0x0000, 0x0001, 0x0009, 0xe150, 0x0009, 0x5b98, 0x0000, 0x0058 }, 16, 0x00094780, 1},
-	{{0x0000, 0x0000, 0x0009, 0xe1a8, 0x0009, 0x5bf0, 0x0000, 0x0004, 0x0000, 0x0000, 0x0009, 0xe1ac, 0x0009, 0x5bf4, 0x0000, 0x002c }, 16, 0x000947a0, 1},
-	{{0x0000, 0x0000, 0x0009, 0xe1d8, 0x0009, 0x5c20, 0x0000, 0x0016, 0x0000, 0x0000, 0x0009, 0xe1f0, 0x0009, 0x5c38, 0x0000, 0x0014 }, 16, 0x000947c0, 1},
-	{{0x0000, 0x0000, 0x0009, 0xe208, 0x0009, 0x5c4c, 0x0000, 0x002c, 0x0000, 0x0004, 0x0009, 0xe23c, 0x0009, 0x5c7c, 0x0000, 0x0002 }, 16, 0x000947e0, 1},
-	{{0x0000, 0x0000, 0x0009, 0xe240, 0x0009, 0x5e80, 0x0000, 0x0000, 0x0000, 0x0004, 0x0009, 0xea44, 0x0009, 0x5e84, 0x0000, 0x0002 }, 16, 0x00094800, 1},
-	{{0x0000, 0x0000, 0x0009, 0xea46, 0x0009, 0x5e86, 0x0000, 0x0002, 0x0000, 0x0000, 0x0009, 0xea4a, 0x0009, 0x5e88, 0x0000, 0x0002 }, 16, 0x00094820, 1},
-	{{0x0000, 0x0000, 0x0009, 0xea4c, 0x0009, 0x5e8a, 0x0000, 0x0002, 0x0000, 0x0000, 0x0009, 0xebb4, 0x0009, 0x5e8c, 0x0000, 0x0004 }, 16, 0x00094840, 1},
-	{{0x0000, 0x0000, 0x0009, 0xfdbc, 0x0009, 0x5ee8, 0x0000, 0x000c, 0x0000, 0x0000, 0x0009, 0xfdc8, 0x0009, 0x5ef4, 0x0000, 0x0004 }, 16, 0x00094860, 1},
-	{{0x0000, 0x0000, 0x0009, 0xfdcc, 0x0009, 0x5ef8, 0x0000, 0x0004, 0x0000, 0x0000, 0x0009, 0xfdd0, 0x0009, 0x5efc, 0x0000, 0x0004 }, 16, 0x00094880, 1},
-	{{0x0000, 0x0000, 0x0009, 0xfdd4, 0x0009, 0x5f00, 0x0000, 0x0004, 0x0000, 0x0000, 0x000a, 0x049a, 0x0009, 0x5f04, 0x0000, 0x0000 }, 16, 0x000948a0, 1},
-	{{0x0000, 0x0002, 0x000a, 0x1864, 0x0009, 0x5f08, 0x0000, 0x0000, 0x0000, 0x0004, 0x000a, 0x186c, 0x0009, 0x5f0c, 0x0000, 0x0002 }, 16, 0x000948c0, 1},
-	{{0x0000, 0x0000, 0x000a, 0x186e, 0x0009, 0x5f0e, 0x0000, 0x0002, 0x0000, 0x0000, 0x000a, 0x1870, 0x0009, 0x5f10, 0x0000, 0x0002 }, 16, 0x000948e0, 1},
-	{{0x0000, 0x0000, 0x000a, 0x1a24, 0x0009, 0x5f34, 0x0000, 0x0004, 0x0000, 0x0000, 0x000a, 0x1a28, 0x0009, 0x5f38, 0x0000, 0x0004 }, 16, 0x00094900, 1},
-	{{0x0000, 0x0000, 0x000a, 0x1a2c, 0x0009, 0x5f3c, 0x0000, 0x0004, 0x0000, 0x0000, 0x000a, 0x1a30, 0x0009, 0x5f40, 0x0000, 0x0004 }, 16, 0x00094920, 1},
-	{{0x0000, 0x0000, 0x000a, 0x1a34, 0x0009, 0x5f44, 0x0000, 0x0002, 0x0000, 0x0000, 0x000a, 0x1a74, 0x0009, 0x5f48, 0x0000, 0x0000 }, 16, 0x00094940, 1},
-	{{0x0000, 0x0004, 0x000a, 0x1a78, 0x0009, 0x5f4c, 0x0000, 0x0000, 0x0000, 0x0004, 0x000a, 0x1a7c, 0x0009, 0x5f50, 0x0000, 0x0000 }, 16, 0x00094960, 1},
-	{{0x0000, 0x0004, 0x000a, 0x1a80, 0x0009, 0x5f54, 0x0000, 0x0000, 0x0000, 0x0004, 0x000a, 0x1a86, 0x0009, 0x5f58, 0x0000, 0x0000 }, 16, 0x00094980, 1},
-	{{0x0000, 0x0002, 0x000a, 0x1a8e, 0x0009, 0x5f5c, 0x0000, 0x0000, 0x0000, 0x0002, 0x000a, 0x1a90, 0x0009, 0x5f60, 0x0000, 0x0000 }, 16, 0x000949a0, 1},
-	{{0x0000, 0x0004, 0x000a, 0x1a94, 0x0009, 0x5f64, 0x0000, 0x0000, 0x0000, 0x0001, 0x000a, 0x1a95, 0x0009, 0x5f65, 0x0000, 0x0000 }, 16, 0x000949c0, 1},
-	{{0x0000, 0x0001, 0x000a, 0x1a98, 0x0009, 0x5f68, 0x0000, 0x0000, 0x0000, 0x0002, 0x000a, 0x1b9c, 0x0009, 0x5f6c, 0x0000, 0x00f4 }, 16, 0x000949e0, 1},
-	{{0x0000, 0x0000, 0x000a, 0x1c90, 0x0009, 0x6060, 0x0000, 0x002c, 0x0000, 0x0000, 0x000a, 0x1cbc, 0x0009, 0x608c, 0x0000, 0x001c }, 16, 0x00094a00, 1},
-	{{0x0000, 0x0000, 0x000a, 0x1cd8, 0x0009, 0x60a8, 0x0000, 0x0008, 0x0000, 0x0014, 0x000a, 0x1cf4, 0x0009, 0x60c4, 0x0000, 0x0010 }, 16, 0x00094a20, 1},
-	{{0x0000, 0x0004, 0x000a, 0x1d08, 0x0009, 0x60d8, 0x0000, 0x0008, 0x0000, 0x0000, 0x000a, 0x1d14, 0x0009, 0x60e0, 0x0000, 0x0004 }, 16, 0x00094a40, 1},
-	{{0x0000, 0x0000, 0x000a, 0x1d18, 0x0009, 0x60e4, 0x0000, 0x0004, 0x0000, 0x0000, 0x000a, 0x1d1c, 0x0009, 0x60e8, 0x0000, 0x0000 }, 16, 0x00094a60, 1},
-	{{0x0000, 0x0002, 0x000a, 0x1d20, 0x0009, 0x60ec, 0x0000, 0x0010, 0x0000, 0x0004, 0x000a, 0x1d34, 0x0009, 0x6100, 0x0000, 0x0000 }, 16, 0x00094a80, 1},
-	{{0x0000, 0x000c, 0x000a, 0x1d40, 0x0009, 0x610c, 0x0000, 0x0004, 0x0000, 0x0000, 0x000a, 0x1d44, 0x0009, 0x6110, 0x0000, 0x0004 }, 16, 0x00094aa0, 1},
-	{{0x0000, 0x0000, 0x000a, 0x1d48, 0x0009, 0x6114, 0x0000, 0x0004, 0x0000, 0x0000, 0x000a, 0x1d4c, 0x0009, 0x6118, 0x0000, 0x0000 }, 16, 0x00094ac0, 1},
-	{{0x0000, 0x0004, 0x000a, 0x1d54, 0x0009, 0x611c, 0x0000, 0x0004, 0x0000, 0x0000, 0x000a, 0x1d58, 0x0009, 0x6120, 0x0000, 0x0004 }, 16, 0x00094ae0, 1},
-	{{0x0000, 0x0000, 0x000a, 0x1d5c, 0x0009, 0x6124, 0x0000, 0x0004, 0x0000, 0x0000, 0x000a, 0x1d60, 0x0009, 0x6128, 0x0000, 0x0000 }, 16, 0x00094b00, 1},
-	{{0x0000, 0x0004, 0x000a, 0x73a0, 0x0009, 0x690c, 0x0000, 0x0000, 0x0000, 0x0004, 0x000a, 0x73a4, 0x0009, 0x6910, 0x0000, 0x0000 }, 16, 0x00094b20, 1},
-	{{0x0000, 0x0004, 0x000a, 0x784c, 0x0009, 0x6914, 0x0000, 0x0010, 0x0000, 0x0004, 0x000a, 0x7860, 0x0009, 0x6928, 0x0000, 0x0014 }, 16, 0x00094b40, 1},
-	{{0x0000, 0x0000, 0x000a, 0x7874, 0x0009, 0x693c, 0x0000, 0x0010, 0x0000, 0x0004, 0x000a, 0x7890, 0x0009, 0x6950, 0x0000, 0x0000 }, 16, 0x00094b60, 1},
-	{{0x0000, 0x0004, 0x000a, 0x789c, 0x0009, 0x6954, 0x0000, 0x0000, 0x0000, 0x0004, 0x000a, 0x7f84, 0x0009, 0x6958, 0x0000, 0x0010 }, 16, 0x00094b80, 1},
-	{{0x0000, 0x0004, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 6, 0x00094ba0, 1},
-	{{0x000c, 0x5600, 0x000c, 0x5500, 0x000c, 0xa000, 0x0000, 0x0100, 0x000c, 0xa000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 12, 0x00094bac, 1},
-	{{0x0009, 0x6c00, 0x0001, 0x1398, 0x0000, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 6, 0x00094bc4, 1},
-	{{0x6874, 0x7470, 0x733a, 0x2f2f, 0x6175, 0x7373, 0x766e, 0x3031, 0x3a38, 0x302f, 0x7376, 0x6e2f, 0x7469, 0x6d62, 0x6572, 0x776f }, 16, 0x00094bd0, 1},
-	{{0x6c66, 0x2d73, 0x772f, 0x6669, 0x726d, 0x7761, 0x7265, 0x2f7a, 0x6c73, 0x3338, 0x3036, 0x332f, 0x6272, 0x616e, 0x6368, 0x6573 }, 16, 0x00094bf0, 1},
-	{{0x2f33, 0x4d69, 0x6373, 0x5f32, 0x445f, 0x4265, 0x616d, 0x666f, 0x726d, 0x6572, 0x0031, 0x3038, 0x3432, 0x0055, 0x6e6d, 0x6f64 }, 16, 0x00094c10, 1},
-	{{0x6966, 0x6965, 0x6400, 0x3230, 0x3137, 0x2f30, 0x392f, 0x3232, 0x2031, 0x323a, 0x3539, 0x3a33, 0x3100, 0x3230, 0x3137, 0x2f30 }, 16, 0x00094c30, 1},
-	{{0x392f, 0x3235, 0x2031, 0x323a, 0x3130, 0x3a34, 0x3100, 0x0000, 0x0009, 0x4bd0, 0x0009, 0x4c25, 0x0009, 0x4c2b, 0x0009, 0x4c36 }, 16, 0x00094c50, 1},
-	{{0x0009, 0x4c4a, 0x2a53, 0x0000, 0x000c, 0x5600, 0x000c, 0x5500, 0x000c, 0xa000, 0x0000, 0x0100, 0x000c, 0xa000, 0x0000, 0x0000 }, 16, 0x00094c70, 1},
-	{{0x0009, 0x935c, 0x0009, 0x995c, 0x0009, 0x959c, 0x0009, 0x97dc, 0x0009, 0x941c, 0x0009, 0x989c, 0x0009, 0x965c, 0x0009, 0x94dc }, 16, 0x00094c90, 1},
-	{{0x0000, 0x0000, 0x0010, 0x0010, 0x0000, 0x0001, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0005, 0x0008, 0x0008, 0x0010 }, 16, 0x00094cb0, 1},
-	{{0x0018, 0x0020, 0x002c, 0x0030, 0x0028, 0x0030, 0x0008, 0x0010, 0x0018, 0x0030, 0x0030, 0x0030, 0x0030, 0x1f40, 0x1f40, 0x3e80 }, 16, 0x00094cd0, 1},
-	{{0x5dc0, 0x7d00, 0xac44, 0xbb80, 0x9c40, 0x0000, 0x0008, 0x0e00, 0x0008, 0x0e80, 0x0008, 0x0f00, 0x0008, 0x0200, 0x0000, 0x0049 }, 16, 0x00094cf0, 1},
-	{{0x6e63, 0x6f6d, 0x7061, 0x7469, 0x626c, 0x6520, 0x4170, 0x706c, 0x6963, 0x6174, 0x696f, 0x6e0a, 0x0055, 0x6e74, 0x7269, 0x6d6d }, 16, 0x00094d10, 1},
-	{{0x6564, 0x2050, 0x6172, 0x740a, 0x0000, 0x0000, 0x0008, 0x693c, 0x0008, 0x6978, 0x0008, 0x69bc, 0x0008, 0x6b1e, 0x0008, 0x6b5a }, 16, 0x00094d30, 1},
-	{{0x0008, 0x6b9e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0030 }, 16, 0x00094d50, 1},
-	{{0x0000, 0x0010, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0xb580, 0x0009, 0xb58c, 0x0000, 0x0000, 0x0000, 0x0001, 0x0000, 0x0001 }, 16, 0x00094d70, 1},
-	{{0x0010, 0x0000, 0x0000, 0x0000, 0x0009, 0xd140, 0x0009, 0xcf80, 0x0009, 0xd040, 0x0009, 0xd100, 0x0009, 0xd0c0, 0x0009, 0xcfc0 }, 16, 0x00094d90, 1},
-	{{0x0009, 0xd000, 0x0009, 0xd180, 0x0009, 0xb800, 0x0009, 0xbc00, 0x0009, 0xc400, 0x0009, 0xcc00, 0x0009, 0xba00, 0x0009, 0xc200 }, 16, 0x00094db0, 1},
-	{{0x0009, 0xc800, 0x0009, 0xc000, 0x0009, 0xd33c, 0x0009, 0xd2e8, 0x0009, 0xd48c, 0x0009, 0xd2b0, 0x0009, 0xd2cc, 0x0009, 0xd278 }, 16, 0x00094dd0, 1},
-	{{0x0009, 0xd3e4, 0x0009, 0xd25c, 0x0009, 0xd390, 0x0009, 0xd438, 0x0009, 0xd454, 0x0009, 0xd41c, 0x0009, 0xd3ac, 0x0009, 0xd358 }, 16, 0x00094df0, 1},
-	{{0x0009, 0xd470, 0x0009, 0xd320, 0x0009, 0xd7e8, 0x0000, 0x0000, 0x0009, 0x50f0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x00094e10, 1},
-	{{0x0009, 0xd7e8, 0x5075, 0x7420, 0x4350, 0x5520, 0x746f, 0x2073, 0x6c65, 0x6570, 0x2e20, 0x5365, 0x7420, 0x4842, 0x493d, 0x3078 }, 16, 0x00094e30, 1},
-	{{0x4644, 0x3830, 0x2074, 0x6f20, 0x6177, 0x616b, 0x6500, 0x7772, 0x203c, 0x6164, 0x6472, 0x3e20, 0x3c77, 0x6f72, 0x6430, 0x3e20 }, 16, 0x00094e50, 1},
-	{{0x5b77, 0x6f72, 0x6431, 0x5d2e, 0x2e2e, 0x5b77, 0x6f72, 0x6439, 0x395d, 0x0057, 0x7269, 0x7465, 0x2075, 0x7020, 0x746f, 0x2031 }, 16, 0x00094e70, 1},
-	{{0x3030, 0x2077, 0x6f72, 0x6473, 0x2062, 0x6567, 0x696e, 0x2040, 0x3c61, 0x6464, 0x723e, 0x0052, 0x6561, 0x6420, 0x5379, 0x7374 }, 16, 0x00094e90, 1},
-	{{0x656d, 0x2049, 0x6e74, 0x6572, 0x7275, 0x7074, 0x2052, 0x6567, 0x6973, 0x7465, 0x7200, 0x7772, 0x203c, 0x6164, 0x6472, 0x3e20 }, 16, 0x00094eb0, 1},
-	{{0x3c77, 0x6f72, 0x6430, 0x3e20, 0x5b77, 0x6f72, 0x6431, 0x5d20, 0x2e2e, 0x2e00, 0x5265, 0x6164, 0x205b, 0x6c65, 0x6e5d, 0x2077 }, 16, 0x00094ed0, 1},
-	{{0x6f72, 0x6473, 0x2066, 0x726f, 0x6d3c, 0x6164, 0x6472, 0x3e00, 0x666c, 0x4372, 0x203c, 0x6170, 0x704e, 0x756d, 0x206f, 0x7074 }, 16, 0x00094ef0, 1},
-	{{0x696f, 0x6e61, 0x6c3e, 0x0052, 0x6570, 0x726f, 0x6772, 0x616d, 0x2043, 0x5220, 0x696e, 0x2066, 0x6c61, 0x7368, 0x0053, 0x686f }, 16, 0x00094f10, 1},
-	{{0x7720, 0x6370, 0x7520, 0x7574, 0x696c, 0x697a, 0x6174, 0x696f, 0x6e00, 0x5475, 0x726e, 0x2063, 0x6861, 0x7220, 0x6563, 0x686f }, 16, 0x00094f30, 1},
-	{{0x206f, 0x6666, 0x0054, 0x7572, 0x6e20, 0x6368, 0x6172, 0x2065, 0x6368, 0x6f20, 0x6f6e, 0x004c, 0x6f61, 0x6420, 0x2620, 0x7275 }, 16, 0x00094f50, 1},
-	{{0x6e20, 0x6170, 0x7020, 0x2300, 0x7264, 0x203c, 0x6164, 0x6472, 0x3e20, 0x5b6c, 0x656e, 0x5d00, 0x5375, 0x7065, 0x7255, 0x7365 }, 16, 0x00094f70, 1},
-	{{0x7220, 0x4d6f, 0x6465, 0x0a00, 0x7275, 0x6e61, 0x7070, 0x203c, 0x6170, 0x7020, 0x233e, 0x0053, 0x686f, 0x7720, 0x6170, 0x7020 }, 16, 0x00094f90, 1},
-	{{0x7376, 0x6e20, 0x2300, 0x4563, 0x686f, 0x4f66, 0x6600, 0x4563, 0x686f, 0x4f6e, 0x0072, 0x756e, 0x6170, 0x7000, 0x736c, 0x6565 }, 16, 0x00094fb0, 1},
-	{{0x7000, 0x666c, 0x4372, 0x0073, 0x686f, 0x7700, 0x7264, 0x0077, 0x7200, 0x5457, 0x0073, 0x7500, 0x0100, 0x0000, 0x0000, 0x0000 }, 16, 0x00094fd0, 1},
-	{{0x0004, 0x1977, 0x0004, 0x18ef, 0x0004, 0x16ac, 0x0008, 0x8cb4, 0x0009, 0xdd9c, 0x0009, 0xdd34, 0x0004, 0x0cba, 0x0001, 0xfba6 }, 16, 0x00094ff0, 1},
-	{{0x0009, 0xdd9f, 0x0009, 0xdc82, 0x0004, 0x0d50, 0x0001, 0xfbac, 0x0004, 0x0fa2, 0x0004, 0x0f7c, 0x0004, 0x0c44, 0x0001, 0xf858 }, 16, 0x00095010, 1},
-	{{0x0004, 0x0fb9, 0x0004, 0x0f15, 0x0004, 0x0ced, 0x0001, 0xf828, 0x0004, 0x0fad, 0x0004, 0x0eff, 0x0004, 0x0cba, 0x0001, 0xf82e }, 16, 0x00095030, 1},
-	{{0x0004, 0x0fa6, 0x0004, 0x0ee8, 0x0004, 0x0c82, 0x0001, 0xf834, 0x0004, 0x0fb6, 0x0004, 0x0e3c, 0x0004, 0x0d7d, 0x0001, 0xf840 }, 16, 0x00095050, 1},
-	{{0x0004, 0x0fb3, 0x0004, 0x0e1b, 0x0004, 0x0d50, 0x0001, 0xf846, 0x0004, 0x0f9e, 0x0004, 0x0df7, 0x0004, 0x0d20, 0x0001, 0xf84c }, 16, 0x00095070, 1},
-	{{0x0004, 0x0f99, 0x0004, 0x0e5d, 0x0004, 0x0da8, 0x0001, 0xf852, 0x0004, 0x0f92, 0x0004, 0x0f92, 0x0004, 0x0ed0, 0x0001, 0xf864 }, 16, 0x00095090, 1},
-	{{0x0009, 0xdd81, 0x0009, 0xdd54, 0x0009, 0xdd23, 0x0008, 0x8e0a, 0x0004, 0x0f8a, 0x0004, 0x0f8a, 0x0009, 0x52d0, 0x0001, 0xf85e }, 16, 0x000950b0, 1},
-	{{0x0009, 0xdd93, 0x0009, 0xdd93, 0x0009, 0xdce9, 0x0008, 0x8ce2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x000950d0, 1},
-	{{0x0004, 0x1977, 0x0004, 0x18ef, 0x0004, 0x16ac, 0x0008, 0x8c86, 0x0009, 0xdd9c, 0x0009, 0xdd34, 0x0009, 0xdca0, 0x0001, 0xfba6 }, 16, 0x000950f0, 1},
-	{{0x0009, 0xdd9f, 0x0009, 0xdc1a, 0x0009, 0xdc3f, 0x0001, 0xfbac, 0x0004, 0x1959, 0x0004, 0x1959, 0x0009, 0xdd63, 0x0008, 0x8aaa }, 16, 0x00095110, 1},
-	{{0x0009, 0xdd8e, 0x0009, 0xdcbc, 0x0009, 0xdcd3, 0x0008, 0x8b3a, 0x0009, 0x5427, 0x0009, 0x5427, 0x0009, 0xdc63, 0x0008, 0x8bb8 }, 16, 0x00095130, 1},
-	{{0x0009, 0xdd72, 0x0009, 0xdd72, 0x0009, 0xdcfe, 0x0008, 0x8bae, 0x0009, 0xdd7a, 0x0009, 0xdd7a, 0x0009, 0xdd11, 0x0008, 0x8ba4 }, 16, 0x00095150, 1},
-	{{0x0009, 0xdd88, 0x0009, 0xdd88, 0x0009, 0xdbf0, 0x0008, 0x8e02, 0x0009, 0xdda5, 0x0009, 0xddab, 0x0009, 0xddab, 0x0008, 0x8df4 }, 16, 0x00095170, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0a21, 0x2020, 0x5356, 0x4e20, 0x494e, 0x464f, 0x3a0a, 0x2109 }, 16, 0x00095190, 1},
-	{{0x5265, 0x7669, 0x7369, 0x6f6e, 0x3a20, 0x2573, 0x202d, 0x2d20, 0x2573, 0x0a21, 0x0943, 0x6f6d, 0x6d69, 0x7420, 0x5469, 0x6d65 }, 16, 0x000951b0, 1},
-	{{0x3a20, 0x2573, 0x0a21, 0x0942, 0x7569, 0x6c64, 0x2054, 0x696d, 0x653a, 0x2025, 0x730a, 0x000a, 0x5379, 0x7374, 0x656d, 0x2049 }, 16, 0x000951d0, 1},
-	{{0x6e74, 0x6572, 0x7275, 0x7074, 0x2049, 0x6e64, 0x6963, 0x6174, 0x696f, 0x6e20, 0x5265, 0x6769, 0x7374, 0x6572, 0x3a00, 0x0a50 }, 16, 0x000951f0, 1},
-	{{0x7265, 0x7373, 0x2045, 0x7363, 0x2074, 0x6f20, 0x5265, 0x7475, 0x726e, 0x2074, 0x6f20, 0x4e6f, 0x726d, 0x616c, 0x204d, 0x6f64 }, 16, 0x00095210, 1},
-	{{0x653a, 0x0a00, 0x4375, 0x7272, 0x656e, 0x7420, 0x4350, 0x5520, 0x7574, 0x696c, 0x697a, 0x6174, 0x696f, 0x6e3a, 0x2025, 0x3364 }, 16, 0x00095230, 1},
-	{{0x2e25, 0x3164, 0x2525, 0x0a00, 0x4964, 0x6c65, 0x2066, 0x756e, 0x6320, 0x6361, 0x6c6c, 0x2063, 0x6f75, 0x6e74, 0x3a20, 0x2535 }, 16, 0x00095250, 1},
-	{{0x642c, 0x2530, 0x2e33, 0x640a, 0x0057, 0x6f72, 0x7374, 0x2035, 0x306d, 0x7320, 0x696e, 0x7465, 0x7276, 0x616c, 0x3a20, 0x2533 }, 16, 0x00095270, 1},
-	{{0x642e, 0x2531, 0x6425, 0x250a, 0x0041, 0x7070, 0x6c69, 0x6361, 0x7469, 0x6f6e, 0x2043, 0x6f6d, 0x6d61, 0x6e64, 0x2043, 0x6f6e }, 16, 0x00095290, 1},
-	{{0x7465, 0x7874, 0x0a00, 0x2a2a, 0x2a2a, 0x2a20, 0x496e, 0x2034, 0x2073, 0x6563, 0x6f6e, 0x6473, 0x202a, 0x2a2a, 0x2a2a, 0x0a00 }, 16, 0x000952b0, 1},
-	{{0x446f, 0x2061, 0x6e20, 0x696c, 0x6c65, 0x6761, 0x6c20, 0x696e, 0x7374, 0x7275, 0x6374, 0x696f, 0x6e00, 0x4572, 0x726f, 0x723a }, 16, 0x000952d0, 1},
-	{{0x2055, 0x6e6b, 0x6e6f, 0x776e, 0x2063, 0x6f6d, 0x6d61, 0x6e64, 0x2000, 0x0a20, 0x7377, 0x5265, 0x6741, 0x7070, 0x5265, 0x7643 }, 16, 0x000952f0, 1},
-	{{0x6f64, 0x6520, 0x3d20, 0x0045, 0x7374, 0x2043, 0x5055, 0x2063, 0x6c6f, 0x636b, 0x3a20, 0x2539, 0x640a, 0x000a, 0x2050, 0x726f }, 16, 0x00095310, 1},
-	{{0x6475, 0x6374, 0x2049, 0x4420, 0x3d20, 0x5a4c, 0x5300, 0x0a46, 0x6c61, 0x7368, 0x2065, 0x7272, 0x6f72, 0x2063, 0x6f64, 0x6520 }, 16, 0x00095330, 1},
-	{{0x004e, 0x6f20, 0x666c, 0x6173, 0x6820, 0x7072, 0x6573, 0x656e, 0x740a, 0x0041, 0x6464, 0x7220, 0x6d75, 0x7374, 0x2062, 0x6520 }, 16, 0x00095350, 1},
-	{{0x6865, 0x780a, 0x0042, 0x6164, 0x2049, 0x6d61, 0x6765, 0x204e, 0x756d, 0x6265, 0x720a, 0x004e, 0x6f74, 0x2070, 0x6f73, 0x7369 }, 16, 0x00095370, 1},
-	{{0x626c, 0x6520, 0x2564, 0x0a20, 0x004e, 0x6f74, 0x2070, 0x6f73, 0x7369, 0x626c, 0x6520, 0x2564, 0x0a20, 0x0049, 0x646c, 0x6520 }, 16, 0x00095390, 1},
-	{{0x7469, 0x636b, 0x733a, 0x2025, 0x3964, 0x0a00, 0x4275, 0x7379, 0x2074, 0x6963, 0x6b73, 0x3a20, 0x2539, 0x640a, 0x0045, 0x6e74 }, 16, 0x000953b0, 1},
-	{{0x7279, 0x2054, 0x6f6f, 0x204c, 0x6f6e, 0x670a, 0x2000, 0x5573, 0x6167, 0x653a, 0x0a20, 0x2573, 0x0a0a, 0x2573, 0x0a0a, 0x000a }, 16, 0x000953d0, 1},
-	{{0x436f, 0x6d6d, 0x616e, 0x6473, 0x3a0a, 0x0020, 0x2534, 0x7820, 0x2534, 0x780a, 0x004c, 0x454e, 0x2025, 0x3478, 0x0a20, 0x002d }, 16, 0x000953f0, 1},
-	{{0x2d2d, 0x2d2d, 0x2d2d, 0x0a00, 0x4563, 0x686f, 0x4f66, 0x6600, 0x2225, 0x7322, 0x200a, 0x0072, 0x6453, 0x6900, 0x2025, 0x730a }, 16, 0x00095410, 1},
-	{{0x0025, 0x733e, 0x2000, 0x0a20, 0x0020, 0x0a00, 0x0820, 0x082e, 0x000a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x00095430, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7fff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x00095450, 1},
-	{{0x0001, 0x0001, 0x0600, 0x0000, 0x0009, 0xdf64, 0x0009, 0xb130, 0x0009, 0xb070, 0x0009, 0xafb0, 0x0009, 0xaef0, 0x0009, 0x941c }, 16, 0x00095470, 1},
-	{{0x0009, 0x989c, 0x0009, 0x965c, 0x0009, 0x94dc, 0x0009, 0x935c, 0x0009, 0x995c, 0x0009, 0x959c, 0x0009, 0x97dc, 0x000a, 0x0198 }, 16, 0x00095490, 1},
-	{{0x000a, 0x03d8, 0x000a, 0x188c, 0x000a, 0x1964, 0x0009, 0xdea4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x000954b0, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x000954d0, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x000954f0, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x00095510, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x00095530, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x00095550, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x00095570, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x00095590, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x000955b0, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x000955d0, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x000955f0, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x00095610, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0076, 0xfefb, 0x003b, 0x0160, 0x006e, 0x0350, 0xfa43, 0x023a }, 16, 0x00095630, 1},
-	{{0xf8ba, 0x0736, 0x0998, 0xf256, 0x068e, 0xd4e8, 0x1eba, 0x086a, 0x3fd2, 0xd002, 0xdc63, 0x1929, 0x3fd3, 0x2ff3, 0xdda3, 0xe4d4 }, 16, 0x00095650, 1},
-	{{0x068d, 0x2b2b, 0x1e60, 0xfafa, 0xf8ba, 0xf8c3, 0x093d, 0x0c53, 0x006e, 0xfcad, 0xfaa6, 0xfd68, 0x0076, 0x010f, 0x0054, 0xffd8 }, 16, 0x00095670, 1},
-	{{0x0003, 0xfff1, 0x00b5, 0xfee7, 0xfe50, 0x00a6, 0x00ba, 0xff81, 0x04e4, 0xffab, 0xf301, 0x0320, 0x0553, 0xfbdb, 0x0d96, 0x0000 }, 16, 0x00095690, 1},
-	{{0xf09c, 0x0425, 0x02a1, 0xfce0, 0x033d, 0x0055, 0xfe3d, 0x007f, 0x018c, 0xff5a, 0x0001, 0x0000, 0xffff, 0xfff8, 0xfff4, 0xfff0 }, 16, 0x000956b0, 1},
-	{{0xffee, 0xfff0, 0xfff7, 0x0005, 0x0018, 0x002e, 0x0043, 0x0051, 0x0054, 0x0049, 0x002f, 0x000a, 0xffde, 0xffb6, 0xff9b, 0xff96 }, 16, 0x000956d0, 1},
-	{{0xffaa, 0xffd8, 0x0017, 0x005c, 0x0095, 0x00b4, 0x00ac, 0x0079, 0x0023, 0xffb7, 0xff4f, 0xff03, 0xfeea, 0xff11, 0xff78, 0x000d }, 16, 0x000956f0, 1},
-	{{0x00b2, 0x0141, 0x0194, 0x018f, 0x0129, 0x006e, 0xff83, 0xfe9a, 0xfded, 0xfdad, 0xfdf6, 0xfec6, 0xfff9, 0x0151, 0x027d, 0x0330 }, 16, 0x00095710, 1},
-	{{0x0330, 0x026a, 0x00f8, 0xff22, 0xfd4f, 0xfbf1, 0xfb6a, 0xfbf1, 0xfd85, 0xffde, 0x0282, 0x04d3, 0x0639, 0x0642, 0x04c5, 0x01f2 }, 16, 0x00095730, 1},
-	{{0xfe53, 0xfaaf, 0xf7ea, 0xf6ca, 0xf7ca, 0xfaf0, 0xffbf, 0x0545, 0x0a44, 0x0d72, 0x0dc2, 0x0ab0, 0x046a, 0xfbe7, 0xf2c8, 0xeb22 }, 16, 0x00095750, 1},
-	{{0xe71a, 0xe880, 0xf06c, 0xfef5, 0x1316, 0x2ac2, 0x4329, 0x5928, 0x69c8, 0x72b9, 0x72b9, 0x69c8, 0x5928, 0x4329, 0x2ac2, 0x1316 }, 16, 0x00095770, 1},
-	{{0xfef5, 0xf06c, 0xe880, 0xe71a, 0xeb22, 0xf2c8, 0xfbe7, 0x046a, 0x0ab0, 0x0dc2, 0x0d72, 0x0a44, 0x0545, 0xffbf, 0xfaf0, 0xf7ca }, 16, 0x00095790, 1},
-	{{0xf6ca, 0xf7ea, 0xfaaf, 0xfe53, 0x01f2, 0x04c5, 0x0642, 0x0639, 0x04d3, 0x0282, 0xffde, 0xfd85, 0xfbf1, 0xfb6a, 0xfbf1, 0xfd4f }, 16, 0x000957b0, 1},
-	{{0xff22, 0x00f8, 0x026a, 0x0330, 0x0330, 0x027d, 0x0151, 0xfff9, 0xfec6, 0xfdf6, 0xfdad, 0xfded, 0xfe9a, 0xff83, 0x006e, 0x0129 }, 16, 0x000957d0, 1},
-	{{0x018f, 0x0194, 0x0141, 0x00b2, 0x000d, 0xff78, 0xff11, 0xfeea, 0xff03, 0xff4f, 0xffb7, 0x0023, 0x0079, 0x00ac, 0x00b4, 0x0095 }, 16, 0x000957f0, 1},
-	{{0x005c, 0x0017, 0xffd8, 0xffaa, 0xff96, 0xff9b, 0xffb6, 0xffde, 0x000a, 0x002f, 0x0049, 0x0054, 0x0051, 0x0043, 0x002e, 0x0018 }, 16, 0x00095810, 1},
-	{{0x0005, 0xfff7, 0xfff0, 0xffee, 0xfff0, 0xfff4, 0xfff8, 0xffff, 0x0000, 0x0001, 0xffef, 0xffbe, 0xff84, 0xff5d, 0xff7c, 0xffe4 }, 16, 0x00095830, 1},
-	{{0x0060, 0x0096, 0x004c, 0xffad, 0xff39, 0xff66, 0x0030, 0x00fb, 0x0106, 0x001a, 0xfee2, 0xfe76, 0xff6b, 0x0120, 0x021d, 0x0149 }, 16, 0x00095850, 1},
-	{{0xff12, 0xfd4c, 0xfdc1, 0x0071, 0x033a, 0x0377, 0x0071, 0xfc69, 0xfb08, 0xfe25, 0x03ac, 0x06cb, 0x0402, 0xfcb7, 0xf6f4, 0xf8b0 }, 16, 0x00095870, 1},
-	{{0x0219, 0x0c0a, 0x0cdb, 0x00be, 0xef0b, 0xe75e, 0xf72d, 0x1eec, 0x4efc, 0x6fb0, 0x6fb0, 0x4efc, 0x1eec, 0xf72d, 0xe75e, 0xef0b }, 16, 0x00095890, 1},
-	{{0x00be, 0x0cdb, 0x0c0a, 0x0219, 0xf8b0, 0xf6f4, 0xfcb7, 0x0402, 0x06cb, 0x03ac, 0xfe25, 0xfb08, 0xfc69, 0x0071, 0x0377, 0x033a }, 16, 0x000958b0, 1},
-	{{0x0071, 0xfdc1, 0xfd4c, 0xff12, 0x0149, 0x021d, 0x0120, 0xff6b, 0xfe76, 0xfee2, 0x001a, 0x0106, 0x00fb, 0x0030, 0xff66, 0xff39 }, 16, 0x000958d0, 1},
-	{{0xffad, 0x004c, 0x0096, 0x0060, 0xffe4, 0xff7c, 0xff5d, 0xff84, 0xffbe, 0xffef, 0xfffe, 0x0019, 0xffea, 0xffe3, 0x001b, 0x0037 }, 16, 0x000958f0, 1},
-	{{0xffde, 0xffa0, 0x001f, 0x009a, 0xfff8, 0xff1c, 0xffd3, 0x013a, 0x0090, 0xfe71, 0xfed0, 0x01d2, 0x021a, 0xfe1a, 0xfca4, 0x01a4 }, 16, 0x00095910, 1},
-	{{0x0507, 0xff31, 0xf8cd, 0xfef9, 0x0a1d, 0x04f4, 0xf19e, 0xf0fe, 0x152b, 0x3e82, 0x3e82, 0x152b, 0xf0fe, 0xf19e, 0x04f4, 0x0a1d }, 16, 0x00095930, 1},
-	{{0xfef9, 0xf8cd, 0xff31, 0x0507, 0x01a4, 0xfca4, 0xfe1a, 0x021a, 0x01d2, 0xfed0, 0xfe71, 0x0090, 0x013a, 0xffd3, 0xff1c, 0xfff8 }, 16, 0x00095950, 1},
-	{{0x009a, 0x001f, 0xffa0, 0xffde, 0x0037, 0x001b, 0xffe3, 0xffea, 0x0019, 0xfffe, 0x0080, 0xfe65, 0xff40, 0x00b3, 0x0135, 0x00f4 }, 16, 0x00095970, 1},
-	{{0x0024, 0xff43, 0xfeb5, 0xfed5, 0xff9f, 0x00be, 0x019f, 0x01b8, 0x00d8, 0xff53, 0xfde8, 0xfd6e, 0xfe5a, 0x006e, 0x02b8, 0x03f2 }, 16, 0x00095990, 1},
-	{{0x0326, 0x0042, 0xfc5b, 0xf95e, 0xf957, 0xfd82, 0x0599, 0x0fc2, 0x1911, 0x1e9f, 0x1e9f, 0x1911, 0x0fc2, 0x0599, 0xfd82, 0xf957 }, 16, 0x000959b0, 1},
-	{{0xf95e, 0xfc5b, 0x0042, 0x0326, 0x03f2, 0x02b8, 0x006e, 0xfe5a, 0xfd6e, 0xfde8, 0xff53, 0x00d8, 0x01b8, 0x019f, 0x00be, 0xff9f }, 16, 0x000959d0, 1},
-	{{0xfed5, 0xfeb5, 0xff43, 0x0024, 0x00f4, 0x0135, 0x00b3, 0xff40, 0xfe65, 0x0080, 0x0000, 0x0001, 0x0304, 0x0607, 0x090a, 0x0b0d }, 16, 0x000959f0, 1},
-	{{0x0e10, 0x1112, 0x1415, 0x1618, 0x191a, 0x1c1d, 0x1e20, 0x2122, 0x2425, 0x2628, 0x292a, 0x2c2d, 0x2e2f, 0x3132, 0x3334, 0x3637 }, 16, 0x00095a10, 1},
-	{{0x3839, 0x3b3c, 0x3d3e, 0x3f41, 0x4243, 0x4445, 0x4748, 0x494a, 0x4b4d, 0x4e4f, 0x5051, 0x5254, 0x5556, 0x5758, 0x595a, 0x5c5d }, 16, 0x00095a30, 1},
-	{{0x5e5f, 0x6061, 0x6263, 0x6466, 0x6768, 0x696a, 0x6b6c, 0x6d6e, 0x6f70, 0x7172, 0x7475, 0x7677, 0x7879, 0x7a7b, 0x7c7d, 0x7e7f }, 16, 0x00095a50, 1},
-	{{0x8081, 0x8283, 0x8485, 0x8687, 0x8889, 0x8a8b, 0x8c8d, 0x8e8f, 0x9091, 0x9293, 0x9495, 0x9697, 0x9899, 0x9a9b, 0x9b9c, 0x9d9e }, 16, 0x00095a70, 1},
-	{{0x9fa0, 0xa1a2, 0xa3a4, 0xa5a6, 0xa7a8, 0xa9a9, 0xaaab, 0xacad, 0xaeaf, 0xb0b1, 0xb2b2, 0xb3b4, 0xb5b6, 0xb7b8, 0xb9b9, 0xbabb }, 16, 0x00095a90, 1},
-	{{0xbcbd, 0xbebf, 0xc0c0, 0xc1c2, 0xc3c4, 0xc5c6, 0xc6c7, 0xc8c9, 0xcacb, 0xcbcc, 0xcdce, 0xcfd0, 0xd0d1, 0xd2d3, 0xd4d4, 0xd5d6 }, 16, 0x00095ab0, 1},
-	{{0xd7d8, 0xd8d9, 0xdadb, 0xdcdc, 0xddde, 0xdfe0, 0xe0e1, 0xe2e3, 0xe4e4, 0xe5e6, 0xe7e7, 0xe8e9, 0xeaea, 0xebec, 0xedee, 0xeeef }, 16, 0x00095ad0, 1},
-	{{0xf0f1, 0xf1f2, 0xf3f4, 0xf4f5, 0xf6f7, 0xf7f8, 0xf9f9, 0xfafb, 0xfcfc, 0xfdfe, 0xffff, 0x0000, 0x0000, 0x0000, 0x0400, 0x04c1 }, 16, 0x00095af0, 1},
-	{{0x05a6, 0x06b7, 0x0008, 0x0000, 0x00ff, 0x00ff, 0x0080, 0x0055, 0x0040, 0x0033, 0x002b, 0x0025, 0x0020, 0x0080, 0x0020, 0x0080 }, 16, 0x00095b10, 1},
-	{{0x0200, 0x0000, 0x0200, 0x0000, 0x0400, 0x0000, 0x0800, 0x0000, 0x7fff, 0xa000, 0x7fff, 0xa100, 0x7fff, 0xa200, 0x1c1d, 0x1e34 }, 16, 0x00095b30, 1},
-	{{0x3638, 0x0000, 0x0008, 0xaec6, 0x0008, 0xb024, 0x0008, 0xb0c6, 0x0008, 0xb164, 0x0008, 0xb2ec, 0x0008, 0xb406, 0x0008, 0xb546 }, 16, 0x00095b50, 1},
-	{{0x7fff, 0x0000, 0x0001, 0x0000, 0x8000, 0x4000, 0x2aab, 0x2000, 0x199a, 0x1555, 0x1249, 0x1000, 0x0e39, 0x0ccd, 0x0ba3, 0x0aab }, 16, 0x00095b70, 1},
-	{{0x09d9, 0x0925, 0x0889, 0x0800, 0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000a, 0x000b }, 16, 0x00095b90, 1},
-	{{0x000c, 0x000d, 0x000e, 0x0010, 0x0011, 0x0013, 0x0014, 0x0016, 0x0017, 0x001a, 0x001b, 0x001e, 0x001f, 0x0023, 0x0024, 0x0029 }, 16, 0x00095bb0, 1},
-	{{0x002a, 0x0030, 0x0031, 0x0037, 0x0038, 0x003f, 0x0040, 0x0048, 0x0049, 0x0053, 0x0054, 0x005f, 0x0060, 0x006e, 0x006f, 0x0080 }, 16, 0x00095bd0, 1},
-	{{0x0000, 0x0016, 0x3fff, 0x3fff, 0x3fff, 0x3fff, 0x3fff, 0x3fff, 0x3fff, 0x2aaa, 0x2aaa, 0x2aaa, 0x1fff, 0x1fff, 0x1999, 0x1555 }, 16, 0x00095bf0, 1},
-	{{0x1249, 0x1249, 0x0fff, 0x0e38, 0x0ba2, 0x0aaa, 0x0888, 0x071c, 0x0202, 0x0202, 0x0202, 0x0203, 0x0303, 0x0404, 0x0506, 0x0707 }, 16, 0x00095c10, 1},
-	{{0x0809, 0x0b0c, 0x0f12, 0x0000, 0x0008, 0xc7ec, 0x0008, 0xc7ec, 0x0008, 0xbe0a, 0x0008, 0xc686, 0x0008, 0xc694, 0x0000, 0x0001 }, 16, 0x00095c30, 1},
-	{{0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0006, 0x0005, 0x0004, 0x0003, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001 }, 16, 0x00095c50, 1},
-	{{0x0002, 0x0003, 0x0002, 0x0001, 0x0000, 0x0000, 0x0222, 0x0005, 0x0014, 0x002c, 0x004f, 0x007b, 0x00b1, 0x00f1, 0x013b, 0x018e }, 16, 0x00095c70, 1},
-	{{0x01eb, 0x0251, 0x02c1, 0x033b, 0x03be, 0x044a, 0x04df, 0x057e, 0x0625, 0x06d5, 0x078f, 0x0850, 0x091b, 0x09ee, 0x0ac9, 0x0bad }, 16, 0x00095c90, 1},
-	{{0x0c98, 0x0d8c, 0x0e87, 0x0f8a, 0x1094, 0x11a6, 0x12bf, 0x13de, 0x1505, 0x1632, 0x1766, 0x18a0, 0x19e0, 0x1b26, 0x1c71, 0x1dc2 }, 16, 0x00095cb0, 1},
-	{{0x1f19, 0x2074, 0x21d5, 0x2339, 0x24a3, 0x2610, 0x2782, 0x28f7, 0x2a70, 0x2bec, 0x2d6c, 0x2eee, 0x3073, 0x31fa, 0x3383, 0x350f }, 16, 0x00095cd0, 1},
-	{{0x369c, 0x382a, 0x39ba, 0x3b4a, 0x3cdc, 0x3e6e, 0x4000, 0x4192, 0x4324, 0x44b5, 0x4646, 0x47d5, 0x4964, 0x4af1, 0x4c7c, 0x4e05 }, 16, 0x00095cf0, 1},
-	{{0x4f8d, 0x5112, 0x5294, 0x5413, 0x558f, 0x5708, 0x587e, 0x59ef, 0x5b5d, 0x5cc6, 0x5e2b, 0x5f8b, 0x60e7, 0x623d, 0x638e, 0x64da }, 16, 0x00095d10, 1},
-	{{0x6620, 0x6760, 0x6899, 0x69cd, 0x6afa, 0x6c21, 0x6d41, 0x6e5a, 0x6f6b, 0x7076, 0x7179, 0x7274, 0x7367, 0x7453, 0x7536, 0x7612 }, 16, 0x00095d30, 1},
-	{{0x76e5, 0x77af, 0x7871, 0x792a, 0x79da, 0x7a82, 0x7b20, 0x7bb6, 0x7c42, 0x7cc5, 0x7d3e, 0x7dae, 0x7e14, 0x7e71, 0x7ec5, 0x7f0e }, 16, 0x00095d50, 1},
-	{{0x7f4e, 0x7f84, 0x7fb1, 0x7fd3, 0x7fec, 0x7ffb, 0x7fff, 0x7ffb, 0x7fec, 0x7fd3, 0x7fb1, 0x7f84, 0x7f4e, 0x7f0e, 0x7ec5, 0x7e71 }, 16, 0x00095d70, 1},
-	{{0x7e14, 0x7dae, 0x7d3e, 0x7cc5, 0x7c42, 0x7bb6, 0x7b20, 0x7a82, 0x79da, 0x792a, 0x7871, 0x77af, 0x76e5, 0x7612, 0x7536, 0x7453 }, 16, 0x00095d90, 1},
-	{{0x7367, 0x7274, 0x7179, 0x7076, 0x6f6b, 0x6e5a, 0x6d41, 0x6c21, 0x6afa, 0x69cd, 0x6899, 0x6760, 0x6620, 0x64da, 0x638e, 0x623d }, 16, 0x00095db0, 1},
-	{{0x60e7, 0x5f8b, 0x5e2b, 0x5cc6, 0x5b5d, 0x59ef, 0x587e, 0x5708, 0x558f, 0x5413, 0x5294, 0x5112, 0x4f8d, 0x4e05, 0x4c7c, 0x4af1 }, 16, 0x00095dd0, 1},
-	{{0x4964, 0x47d5, 0x4646, 0x44b5, 0x4324, 0x4192, 0x4000, 0x3e6e, 0x3cdc, 0x3b4a, 0x39ba, 0x382a, 0x369c, 0x350f, 0x3383, 0x31fa }, 16, 0x00095df0, 1},
-	{{0x3073, 0x2eee, 0x2d6c, 0x2bec, 0x2a70, 0x28f7, 0x2782, 0x2610, 0x24a3, 0x2339, 0x21d5, 0x2074, 0x1f19, 0x1dc2, 0x1c71, 0x1b26 }, 16, 0x00095e10, 1},
-	{{0x19e0, 0x18a0, 0x1766, 0x1632, 0x1505, 0x13de, 0x12bf, 0x11a6, 0x1094, 0x0f8a, 0x0e87, 0x0d8c, 0x0c98, 0x0bad, 0x0ac9, 0x09ee }, 16, 0x00095e30, 1},
-	{{0x091b, 0x0850, 0x078f, 0x06d5, 0x0625, 0x057e, 0x04df, 0x044a, 0x03be, 0x033b, 0x02c1, 0x0251, 0x01eb, 0x018e, 0x013b, 0x00f1 }, 16, 0x00095e50, 1},
-	{{0x00b1, 0x007b, 0x004f, 0x002c, 0x0014, 0x0005, 0x0000, 0x0000, 0x0000, 0x0000, 0x0080, 0x0100, 0x0008, 0x0100, 0x0009, 0xea50 }, 16, 0x00095e70, 1},
-	{{0x60a9, 0x44e1, 0x38ac, 0x3175, 0x2c92, 0x28fe, 0x263c, 0x2408, 0x2238, 0x20b3, 0x1f67, 0x1e48, 0x1d4d, 0x1c6f, 0x1baa, 0x1af8 }, 16, 0x00095e90, 1},
-	{{0x1a59, 0x19c8, 0x1943, 0x18ca, 0x185b, 0x17f4, 0x1795, 0x173c, 0x16ea, 0x169e, 0x1656, 0x1613, 0x15d4, 0x1598, 0x1560, 0x152b }, 16, 0x00095eb0, 1},
-	{{0x152b, 0x12f8, 0x11db, 0x1137, 0x10d2, 0x1091, 0x1066, 0x1048, 0x1033, 0x1025, 0x1018, 0x100d, 0x000d, 0x0000, 0x000d, 0x6000 }, 16, 0x00095ed0, 1},
-	{{0x000d, 0xc000, 0x0009, 0xfd94, 0x0009, 0xfd7c, 0x0009, 0xfd88, 0x0009, 0xfda0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0010, 0x0020 }, 16, 0x00095ef0, 1},
-	{{0x0010, 0x0000, 0x8000, 0x5a82, 0x49e7, 0x4000, 0x393e, 0x3441, 0x3061, 0x2d41, 0x2aab, 0x287a, 0x2698, 0x24f3, 0x2380, 0x2236 }, 16, 0x00095f10, 1},
-	{{0x210d, 0x2000, 0x7fff, 0xffff, 0x2311, 0x8963, 0x0000, 0x0001, 0x9678, 0x5429, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x00095f30, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0207 }, 16, 0x00095f50, 1},
-	{{0x0000, 0x0246, 0x0000, 0x028d, 0x0000, 0x02dd, 0x0000, 0x0337, 0x0000, 0x039b, 0x0000, 0x040c, 0x0000, 0x048a, 0x0000, 0x0518 }, 16, 0x00095f70, 1},
-	{{0x0000, 0x05b7, 0x0000, 0x066a, 0x0000, 0x0732, 0x0000, 0x0813, 0x0000, 0x090f, 0x0000, 0x0a2a, 0x0000, 0x0b68, 0x0000, 0x0ccc }, 16, 0x00095f90, 1},
-	{{0x0000, 0x0e5c, 0x0000, 0x101d, 0x0000, 0x1214, 0x0000, 0x1449, 0x0000, 0x16c3, 0x0000, 0x198a, 0x0000, 0x1ca7, 0x0000, 0x2026 }, 16, 0x00095fb0, 1},
-	{{0x0000, 0x2413, 0x0000, 0x287a, 0x0000, 0x2d6a, 0x0000, 0x32f5, 0x0000, 0x392c, 0x0000, 0x4026, 0x0000, 0x47fa, 0x0000, 0x50c3 }, 16, 0x00095fd0, 1},
-	{{0x0000, 0x5a9d, 0x0000, 0x65ac, 0x0000, 0x7214, 0x0000, 0x8000, 0x0000, 0x8f9e, 0x0000, 0xa124, 0x0000, 0xb4ce, 0x0000, 0xcadd }, 16, 0x00095ff0, 1},
-	{{0x0000, 0xe39e, 0x0000, 0xff64, 0x0001, 0x1e8e, 0x0001, 0x4185, 0x0001, 0x68c0, 0x0001, 0x94c5, 0x0001, 0xc629, 0x0001, 0xfd93 }, 16, 0x00096010, 1},
-	{{0x0002, 0x3bc1, 0x0002, 0x8185, 0x0002, 0xcfcc, 0x0003, 0x27a0, 0x0003, 0x8a2b, 0x0003, 0xf8bd, 0x0004, 0x74cd, 0x0005, 0x0000 }, 16, 0x00096030, 1},
-	{{0x0005, 0x9c2f, 0x0006, 0x4b6c, 0x0007, 0x100c, 0x0007, 0xeca9, 0x0008, 0xfe9a, 0x0008, 0xfebe, 0x0008, 0xfeec, 0x0008, 0xff18 }, 16, 0x00096050, 1},
-	{{0x0008, 0xff54, 0x0008, 0xff90, 0x0008, 0xfff6, 0x0009, 0x0080, 0x0009, 0x010e, 0x0009, 0x0144, 0x0009, 0x0164, 0x00aa, 0xaaab }, 16, 0x00096070, 1},
-	{{0x0066, 0x6666, 0x0049, 0x2492, 0x0038, 0xe38a, 0x002e, 0x8cc9, 0x0027, 0x3413, 0x0025, 0xe225, 0x000a, 0x1a9c, 0x000a, 0x1a9c }, 16, 0x00096090, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x002a, 0xaaaa, 0xffff, 0x49f5, 0x0000, 0x0455 }, 16, 0x000960b0, 1},
-	{{0xffff, 0xffe5, 0x0000, 0x0000, 0x0001, 0xf2ba, 0x002a, 0x8240, 0x0000, 0x0418, 0x0006, 0x6666, 0x0000, 0x0000, 0x002a, 0xaaaa }, 16, 0x000960d0, 1},
-	{{0xffff, 0x49f5, 0x0000, 0x0455, 0xffff, 0xffe5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1800, 0x000c }, 16, 0x000960f0, 1},
-	{{0x0600, 0x0003, 0x1800, 0x000c, 0x0000, 0x0000, 0x0300, 0x0001, 0xb000, 0x0028, 0x3c00, 0x001e, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x00096110, 1},
-	{{0xb000, 0x0028, 0x0003, 0x0000, 0xb000, 0x0028, 0x0003, 0x0000, 0xb100, 0x0028, 0x0004, 0x0000, 0xb200, 0x0027, 0x0004, 0x0000 }, 16, 0x00096130, 1},
-	{{0xb300, 0x0027, 0x0005, 0x0000, 0xb400, 0x0026, 0x0005, 0x0000, 0xb500, 0x0026, 0x0006, 0x0000, 0xb600, 0x0025, 0x0007, 0x0000 }, 16, 0x00096150, 1},
-	{{0xb700, 0x0025, 0x0008, 0x0000, 0xb800, 0x0024, 0x0009, 0x0000, 0xb900, 0x0024, 0x000a, 0x0000, 0xba00, 0x0023, 0x000b, 0x0000 }, 16, 0x00096170, 1},
-	{{0xbb00, 0x0023, 0x000d, 0x0000, 0xbc00, 0x0022, 0x000e, 0x0000, 0xbd00, 0x0022, 0x0010, 0x0000, 0xbe00, 0x0021, 0x0012, 0x0000 }, 16, 0x00096190, 1},
-	{{0xbf00, 0x0021, 0x0014, 0x0000, 0xc000, 0x0020, 0x0017, 0x0000, 0xc100, 0x0020, 0x001a, 0x0000, 0xc200, 0x001f, 0x001d, 0x0000 }, 16, 0x000961b0, 1},
-	{{0xc300, 0x001f, 0x0020, 0x0000, 0xc400, 0x001e, 0x0024, 0x0000, 0xc500, 0x001e, 0x0029, 0x0000, 0xc600, 0x001d, 0x002e, 0x0000 }, 16, 0x000961d0, 1},
-	{{0xc700, 0x001d, 0x0033, 0x0000, 0xc800, 0x001c, 0x003a, 0x0000, 0xc900, 0x001c, 0x0041, 0x0000, 0xca00, 0x001b, 0x0049, 0x0000 }, 16, 0x000961f0, 1},
-	{{0xcb00, 0x001b, 0x0052, 0x0000, 0xcc00, 0x001a, 0x005c, 0x0000, 0xcd00, 0x001a, 0x0067, 0x0000, 0xce00, 0x0019, 0x0074, 0x0000 }, 16, 0x00096210, 1},
-	{{0xcf00, 0x0019, 0x0082, 0x0000, 0xd000, 0x0018, 0x0092, 0x0000, 0xd100, 0x0018, 0x00a4, 0x0000, 0xd200, 0x0017, 0x00b8, 0x0000 }, 16, 0x00096230, 1},
-	{{0xd300, 0x0017, 0x00ce, 0x0000, 0xd400, 0x0016, 0x00e7, 0x0000, 0xd500, 0x0016, 0x0104, 0x0000, 0xd600, 0x0015, 0x0124, 0x0000 }, 16, 0x00096250, 1},
-	{{0xd700, 0x0015, 0x0147, 0x0000, 0xd800, 0x0014, 0x016f, 0x0000, 0xd900, 0x0014, 0x019c, 0x0000, 0xda00, 0x0013, 0x01ce, 0x0000 }, 16, 0x00096270, 1},
-	{{0xdb00, 0x0013, 0x0207, 0x0000, 0xdc00, 0x0012, 0x0246, 0x0000, 0xdd00, 0x0012, 0x028d, 0x0000, 0xde00, 0x0011, 0x02dd, 0x0000 }, 16, 0x00096290, 1},
-	{{0xdf00, 0x0011, 0x0337, 0x0000, 0xe000, 0x0010, 0x039b, 0x0000, 0xe100, 0x0010, 0x040c, 0x0000, 0xe200, 0x000f, 0x048a, 0x0000 }, 16, 0x000962b0, 1},
-	{{0xe300, 0x000f, 0x0518, 0x0000, 0xe400, 0x000e, 0x05b7, 0x0000, 0xe500, 0x000e, 0x066a, 0x0000, 0xe600, 0x000d, 0x0732, 0x0000 }, 16, 0x000962d0, 1},
-	{{0xe700, 0x000d, 0x0813, 0x0000, 0xe800, 0x000c, 0x090f, 0x0000, 0xe900, 0x000c, 0x0a2a, 0x0000, 0xea00, 0x000b, 0x0b68, 0x0000 }, 16, 0x000962f0, 1},
-	{{0xeb00, 0x000b, 0x0ccc, 0x0000, 0xec00, 0x000a, 0x0e5c, 0x0000, 0xed00, 0x000a, 0x101d, 0x0000, 0xee00, 0x0009, 0x1214, 0x0000 }, 16, 0x00096310, 1},
-	{{0xef00, 0x0009, 0x1449, 0x0000, 0xf000, 0x0008, 0x16c2, 0x0000, 0xf100, 0x0008, 0x1989, 0x0000, 0xf200, 0x0007, 0x1ca7, 0x0000 }, 16, 0x00096330, 1},
-	{{0xf300, 0x0007, 0x2026, 0x0000, 0xf400, 0x0006, 0x2412, 0x0000, 0xf500, 0x0006, 0x2879, 0x0000, 0xf600, 0x0005, 0x2d6a, 0x0000 }, 16, 0x00096350, 1},
-	{{0xf700, 0x0005, 0x32f4, 0x0000, 0xf800, 0x0004, 0x392c, 0x0000, 0xf900, 0x0004, 0x4026, 0x0000, 0xfa00, 0x0003, 0x47fa, 0x0000 }, 16, 0x00096370, 1},
-	{{0xfb00, 0x0003, 0x50c2, 0x0000, 0xfc00, 0x0002, 0x5a9d, 0x0000, 0xfd00, 0x0002, 0x65ab, 0x0000, 0xfe00, 0x0001, 0x7213, 0x0000 }, 16, 0x00096390, 1},
-	{{0xff00, 0x0001, 0x7fff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xb000, 0x0028, 0x0000, 0x002a, 0xb000, 0x0028, 0x0000, 0x0036 }, 16, 0x000963b0, 1},
-	{{0xb100, 0x0028, 0x0000, 0x0044, 0xb200, 0x0027, 0x0000, 0x0055, 0xb300, 0x0027, 0x0000, 0x006b, 0xb400, 0x0026, 0x0000, 0x0087 }, 16, 0x000963d0, 1},
-	{{0xb500, 0x0026, 0x0000, 0x00aa, 0xb600, 0x0025, 0x0000, 0x00d7, 0xb700, 0x0025, 0x0000, 0x010e, 0xb800, 0x0024, 0x0000, 0x0155 }, 16, 0x000963f0, 1},
-	{{0xb900, 0x0024, 0x0000, 0x01ad, 0xba00, 0x0023, 0x0000, 0x021c, 0xbb00, 0x0023, 0x0000, 0x02a8, 0xbc00, 0x0022, 0x0000, 0x0358 }, 16, 0x00096410, 1},
-	{{0xbd00, 0x0022, 0x0000, 0x0436, 0xbe00, 0x0021, 0x0000, 0x054e, 0xbf00, 0x0021, 0x0000, 0x06ad, 0xc000, 0x0020, 0x0000, 0x0868 }, 16, 0x00096430, 1},
-	{{0xc100, 0x0020, 0x0000, 0x0a95, 0xc200, 0x001f, 0x0000, 0x0d53, 0xc300, 0x001f, 0x0000, 0x10c6, 0xc400, 0x001e, 0x0000, 0x151f }, 16, 0x00096450, 1},
-	{{0xc500, 0x001e, 0x0000, 0x1a97, 0xc600, 0x001d, 0x0000, 0x2179, 0xc700, 0x001d, 0x0000, 0x2a24, 0xc800, 0x001c, 0x0000, 0x350d }, 16, 0x00096470, 1},
-	{{0xc900, 0x001c, 0x0000, 0x42ca, 0xca00, 0x001b, 0x0000, 0x5415, 0xcb00, 0x001b, 0x0000, 0x69db, 0xcc00, 0x001a, 0x0000, 0x8544 }, 16, 0x00096490, 1},
-	{{0xcd00, 0x001a, 0x0000, 0xa7c5, 0xce00, 0x0019, 0x0000, 0xd336, 0xcf00, 0x0019, 0x0001, 0x09e6, 0xd000, 0x0018, 0x0001, 0x4ebf }, 16, 0x000964b0, 1},
-	{{0xd100, 0x0018, 0x0001, 0xa56c, 0xd200, 0x0017, 0x0002, 0x128a, 0xd300, 0x0017, 0x0002, 0x9be9, 0xd400, 0x0016, 0x0003, 0x48da }, 16, 0x000964d0, 1},
-	{{0xd500, 0x0016, 0x0004, 0x2292, 0xd600, 0x0015, 0x0005, 0x34a9, 0xd700, 0x0015, 0x0006, 0x8db8, 0xd800, 0x0014, 0x0008, 0x4020 }, 16, 0x000964f0, 1},
-	{{0xd900, 0x0014, 0x000a, 0x6302, 0xda00, 0x0013, 0x000d, 0x137e, 0xdb00, 0x0013, 0x0010, 0x763f, 0xdc00, 0x0012, 0x0014, 0xb96b }, 16, 0x00096510, 1},
-	{{0xdd00, 0x0012, 0x001a, 0x1721, 0xde00, 0x0011, 0x0020, 0xd886, 0xdf00, 0x0011, 0x0029, 0x59b5, 0xe000, 0x0010, 0x0034, 0x0e9d }, 16, 0x00096530, 1},
-	{{0xe100, 0x0010, 0x0041, 0x8937, 0xe200, 0x000f, 0x0052, 0x8143, 0xe300, 0x000f, 0x0067, 0xde18, 0xe400, 0x000e, 0x0082, 0xc2f2 }, 16, 0x00096550, 1},
-	{{0xe500, 0x000e, 0x00a4, 0x9e76, 0xe600, 0x000d, 0x00cf, 0x3e37, 0xe700, 0x000d, 0x0104, 0xe74c, 0xe800, 0x000c, 0x0148, 0x7543 }, 16, 0x00096570, 1},
-	{{0xe900, 0x000c, 0x019d, 0x8113, 0xea00, 0x000b, 0x0208, 0x9229, 0xeb00, 0x000b, 0x028f, 0x5c28, 0xec00, 0x000a, 0x0339, 0x0ca2 }, 16, 0x00096590, 1},
-	{{0xed00, 0x000a, 0x040e, 0xacf4, 0xee00, 0x0009, 0x051b, 0x9d77, 0xef00, 0x0009, 0x066e, 0x309c, 0xf000, 0x0008, 0x0818, 0x6e27 }, 16, 0x000965b0, 1},
-	{{0xf100, 0x0008, 0x0a31, 0x08ff, 0xf200, 0x0007, 0x0cd4, 0x94a5, 0xf300, 0x0007, 0x1027, 0x0ac3, 0xf400, 0x0006, 0x1455, 0xb5a2 }, 16, 0x000965d0, 1},
-	{{0xf500, 0x0006, 0x1999, 0x9999, 0xf600, 0x0005, 0x203a, 0x7e5b, 0xf700, 0x0005, 0x2892, 0xc18a, 0xf800, 0x0004, 0x3314, 0x26ae }, 16, 0x000965f0, 1},
-	{{0xf900, 0x0004, 0x404d, 0xe61f, 0xfa00, 0x0003, 0x50f4, 0x4d88, 0xfb00, 0x0003, 0x65ea, 0x59fd, 0xfc00, 0x0002, 0x804d, 0xce79 }, 16, 0x00096610, 1},
-	{{0xfd00, 0x0002, 0xa186, 0x6ba7, 0xfe00, 0x0001, 0xcb59, 0x185d, 0xff00, 0x0001, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0007 }, 16, 0x00096630, 1},
-	{{0x0000, 0x0007, 0x0000, 0x0008, 0x0000, 0x0009, 0x0000, 0x000a, 0x0000, 0x000c, 0x0000, 0x000d, 0x0000, 0x000f, 0x0000, 0x0010 }, 16, 0x00096650, 1},
-	{{0x0000, 0x0012, 0x0000, 0x0015, 0x0000, 0x0017, 0x0000, 0x001a, 0x0000, 0x001d, 0x0000, 0x0021, 0x0000, 0x0025, 0x0000, 0x0029 }, 16, 0x00096670, 1},
-	{{0x0000, 0x002e, 0x0000, 0x0034, 0x0000, 0x003a, 0x0000, 0x0042, 0x0000, 0x004a, 0x0000, 0x0053, 0x0000, 0x005d, 0x0000, 0x0068 }, 16, 0x00096690, 1},
-	{{0x0000, 0x0075, 0x0000, 0x0083, 0x0000, 0x0093, 0x0000, 0x00a5, 0x0000, 0x00b9, 0x0000, 0x00cf, 0x0000, 0x00e9, 0x0000, 0x0105 }, 16, 0x000966b0, 1},
-	{{0x0000, 0x0125, 0x0000, 0x0148, 0x0000, 0x0171, 0x0000, 0x019e, 0x0000, 0x01d0, 0x0000, 0x0209, 0x0000, 0x0248, 0x0000, 0x028f }, 16, 0x000966d0, 1},
-	{{0x0000, 0x02df, 0x0000, 0x0339, 0x0000, 0x039e, 0x0000, 0x040f, 0x0000, 0x048d, 0x0000, 0x051c, 0x0000, 0x05bb, 0x0000, 0x066e }, 16, 0x000966f0, 1},
-	{{0x0000, 0x0737, 0x0000, 0x0818, 0x0000, 0x0915, 0x0000, 0x0a31, 0x0000, 0x0b6f, 0x0000, 0x0cd5, 0x0000, 0x0e65, 0x0000, 0x1027 }, 16, 0x00096710, 1},
-	{{0x0000, 0x1220, 0x0000, 0x1456, 0x0000, 0x16d1, 0x0000, 0x199a, 0x0000, 0x1cb9, 0x0000, 0x203a, 0x0000, 0x2429, 0x0000, 0x2893 }, 16, 0x00096730, 1},
-	{{0x0000, 0x2d86, 0x0000, 0x3314, 0x0000, 0x3950, 0x0000, 0x404e, 0x0000, 0x4827, 0x0000, 0x50f4, 0x0000, 0x5ad5, 0x0000, 0x65ea }, 16, 0x00096750, 1},
-	{{0x0000, 0x725a, 0x0000, 0x804e, 0x0000, 0x8ff6, 0x0000, 0xa186, 0x0000, 0xb53c, 0x0000, 0xcb59, 0x0000, 0xe429, 0x0001, 0x0000 }, 16, 0x00096770, 1},
-	{{0x0001, 0x1f3d, 0x0001, 0x4249, 0x0001, 0x699c, 0x0001, 0x95bc, 0x0001, 0xc73d, 0x0001, 0xfeca, 0x0002, 0x3d1d, 0x0002, 0x830b }, 16, 0x00096790, 1},
-	{{0x0002, 0xd182, 0x0003, 0x298b, 0x0003, 0x8c53, 0x0003, 0xfb28, 0x0004, 0x7783, 0x0005, 0x030a, 0x0005, 0x9f98, 0x0006, 0x4f40 }, 16, 0x000967b0, 1},
-	{{0x0007, 0x1457, 0x0007, 0xf17b, 0x0008, 0xe99a, 0x000a, 0x0000, 0x000b, 0x385e, 0x000c, 0x96d9, 0x000e, 0x2019, 0x000f, 0xd954 }, 16, 0x000967d0, 1},
-	{{0x0011, 0xc865, 0x0013, 0xf3df, 0x0016, 0x6320, 0x0019, 0x1e6e, 0x001c, 0x2f0f, 0x001f, 0x9f6e, 0x0023, 0x7b39, 0x0027, 0xcf8b }, 16, 0x000967f0, 1},
-	{{0x002c, 0xab1a, 0x0032, 0x1e65, 0x0038, 0x3bf0, 0x003f, 0x1882, 0x0046, 0xcb69, 0x004f, 0x6ece, 0x0059, 0x2006, 0x0064, 0x0000 }, 16, 0x00096810, 1},
-	{{0x0070, 0x33ac, 0x007d, 0xe47e, 0x008d, 0x40f6, 0x009e, 0x7d44, 0x00b1, 0xd3f4, 0x00c7, 0x86b7, 0x00df, 0xdf43, 0x00fb, 0x304b }, 16, 0x00096830, 1},
-	{{0x0119, 0xd69a, 0x013c, 0x3a4f, 0x0162, 0xd03a, 0x018e, 0x1b70, 0x01be, 0xaf00, 0x01f5, 0x2fef, 0x0232, 0x5761, 0x0276, 0xf515 }, 16, 0x00096850, 1},
-	{{0x02c3, 0xf21f, 0x031a, 0x5407, 0x037b, 0x403d, 0x03e8, 0x0000, 0x0009, 0x19ee, 0x0009, 0x19ee, 0x0009, 0x19ee, 0x0009, 0x19ee }, 16, 0x00096870, 1},
-	{{0x0009, 0x19ee, 0x0009, 0x19f2, 0x0009, 0x19fe, 0x0009, 0x1a0a, 0x0009, 0x1a16, 0x0009, 0x1a22, 0x0009, 0x1a2e, 0x0009, 0x1a3a }, 16, 0x00096890, 1},
-	{{0x0009, 0x1a46, 0x0009, 0x1a52, 0x0009, 0x1a5e, 0x0009, 0x1a6a, 0x0009, 0x1a76, 0x0009, 0x19ee, 0x0009, 0x19ee, 0x0009, 0x19ee }, 16, 0x000968b0, 1},
-	{{0x0009, 0x19ee, 0x0009, 0x19ee, 0x0009, 0x19ee, 0x0009, 0x1a82, 0x0009, 0x1a8e, 0x0009, 0x19ee, 0x0009, 0x19ee, 0x0009, 0x19ee }, 16, 0x000968d0, 1},
-	{{0x0009, 0x19ee, 0x0009, 0x19ee, 0x0009, 0x19ee, 0x0009, 0x19ee, 0x0009, 0x19ee, 0x0009, 0x1a9a, 0x0009, 0x1aa6, 0x0000, 0x0000 }, 16, 0x000968f0, 1},
-	{{0x0000, 0x0000, 0x000a, 0x55f6, 0x0008, 0x706b, 0x0005, 0xf7a5, 0x0003, 0x16c5, 0x0000, 0x0000, 0x000a, 0x55f6, 0x000b, 0x872f }, 16, 0x00096910, 1},
-	{{0x000b, 0xef4b, 0x000b, 0x872f, 0x000a, 0x55f6, 0x002a, 0xaaaa, 0xffff, 0x49f5, 0x0000, 0x0455, 0xffff, 0xffe5, 0x0000, 0x0000 }, 16, 0x00096930, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x002a, 0xaaaa, 0xffff, 0x49f5, 0x0000, 0x0455, 0xffff, 0xffe5, 0x0000, 0x0000, 0x0000, 0x0000 }, 14, 0x00096950, 1},
-	{{0x0000, 0x2a53, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 2, 0x0009696c, 1},
-	{{0xfdc6, 0x0000, 0x0008, 0x4040, 0x913d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0101, 0x2970, 0x0008, 0x4000 }, 16, 0x00080128, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x00080148, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x00080168, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x00080188, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x000801a8, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 16, 0x000801c8, 1},
-	{{0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x77c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }, 12, 0x000801e8, 1},
+const unsigned char zl38063_fw_image[] = {
+    0x5a, 0x4c, 0x46, 0x57, 0x00, 0x08, 0x40, 0x40, 0x00, 0x08, 0x02, 0x00, 0x00, 0x08, 0x02, 0x00,
+    0x00, 0x40, 0x00, 0x00, 0x1c, 0x0f, 0x00, 0x10, 0x10, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0x04, 0x81, 0xf2, 0xc0, 0xc0, 0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x01, 0x04,
+    0x01, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40,
+    0x00, 0x00, 0x00, 0x08, 0x02, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x04, 0x00, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x80, 0x00, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x0c, 0x00, 0x00,
+    0x81, 0x5e, 0xff, 0xf0, 0x01, 0xe0, 0xff, 0xa0, 0x03, 0xec, 0xff, 0xf6, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf7, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x08, 0x03, 0x00, 0x00, 0x40, 0x38, 0x08,
+    0x10, 0x00, 0x14, 0x00, 0x7f, 0xff, 0xff, 0xff, 0x00, 0x40, 0x08, 0x18, 0xa0, 0x01, 0x00, 0x78,
+    0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+    0x7f, 0xff, 0xc4, 0x76, 0x00, 0x1f, 0x30, 0x40, 0x01, 0x0c, 0x00, 0x06, 0x0a, 0x3f, 0x04, 0xa1,
+    0x00, 0x3f, 0x00, 0x20, 0x00, 0x00, 0x48, 0x01, 0x00, 0x96, 0x00, 0x0a, 0x00, 0x04, 0x00, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x23, 0x45, 0x67, 0x08, 0x06, 0x02, 0x28, 0x81, 0xf4, 0x00, 0x00, 0x00, 0x13,
+    0x0c, 0xf1, 0x0a, 0x00, 0x40, 0x00, 0x00, 0x26, 0x1a, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0f, 0xa0,
+    0x06, 0x40, 0x0b, 0x0b, 0x84, 0x00, 0x0a, 0x05, 0x00, 0x10, 0x01, 0xaa, 0x20, 0x00, 0x00, 0x08,
+    0x03, 0x80, 0x00, 0x40, 0x04, 0x00, 0x02, 0x00, 0x78, 0x01, 0x02, 0x80, 0x00, 0x23, 0x00, 0x3c,
+    0x28, 0x01, 0x08, 0xa1, 0x00, 0x00, 0xa0, 0x00, 0x7f, 0xdf, 0x00, 0x20, 0x36, 0x28, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x02, 0x00, 0x64, 0x01, 0xf4, 0x33, 0x33,
+    0x7f, 0xbe, 0x33, 0x33, 0x7e, 0xb8, 0xaf, 0xff, 0x00, 0x01, 0x7f, 0xdf, 0x00, 0xc2, 0x73, 0x33,
+    0x60, 0x00, 0x00, 0x31, 0x00, 0x00, 0x66, 0x66, 0x00, 0x64, 0x00, 0x00, 0x16, 0xc3, 0x01, 0x00,
+    0x00, 0x02, 0x7f, 0x02, 0x7f, 0x02, 0x2d, 0x6a, 0x00, 0x02, 0x70, 0x00, 0x0c, 0xcc, 0x00, 0x00,
+    0x00, 0x00, 0x82, 0x40, 0x18, 0x18, 0x50, 0x2d, 0x20, 0x20, 0x00, 0x02, 0x01, 0xf0, 0x00, 0x78,
+    0x00, 0x50, 0x00, 0x04, 0x01, 0xf0, 0x00, 0x78, 0x00, 0x50, 0x08, 0x7a, 0x01, 0x00, 0x01, 0x90,
+    0x00, 0x04, 0x17, 0x17, 0x00, 0x08, 0x04, 0x00, 0x00, 0x40, 0x04, 0x00, 0x03, 0x20, 0x00, 0x33,
+    0x00, 0x00, 0x0b, 0x27, 0x13, 0x58, 0x0c, 0x52, 0x15, 0x60, 0x0d, 0xa2, 0x17, 0xa2, 0x0f, 0x0e,
+    0x1a, 0x21, 0x12, 0x3d, 0x17, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x90, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x00, 0x01, 0x00, 0x0a, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x04, 0x80, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x66, 0x66, 0x40, 0x00, 0x00, 0x0c,
+    0xff, 0xfd, 0x02, 0x00, 0x16, 0xc3, 0x73, 0x33, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x05, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x01, 0x2c, 0x01, 0x00,
+    0xff, 0xfd, 0x00, 0x06, 0x04, 0xe2, 0x01, 0x00, 0xff, 0xfa, 0x00, 0x08, 0x11, 0x94, 0x01, 0x00,
+    0x00, 0x06, 0x00, 0x09, 0x03, 0xe8, 0x02, 0x00, 0xff, 0xfa, 0x00, 0x09, 0x03, 0xe8, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0x03, 0xe8, 0x02, 0x00, 0x00, 0x00, 0x00, 0x09, 0x03, 0xe8, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0x03, 0xe8, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x64, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x02, 0x00, 0x50, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x06,
+    0x00, 0x96, 0x01, 0x00, 0x00, 0x06, 0x00, 0x06, 0x03, 0xe8, 0x01, 0x00, 0xff, 0xfa, 0x00, 0x06,
+    0x07, 0x08, 0x01, 0x00, 0x00, 0x03, 0x00, 0x06, 0x0b, 0xb8, 0x01, 0x80, 0xff, 0xfd, 0x00, 0x06,
+    0x13, 0x88, 0x01, 0x00, 0x00, 0x03, 0x00, 0x08, 0x05, 0x80, 0x00, 0x40, 0x00, 0x09, 0x03, 0xe8,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x06, 0x00,
+    0x00, 0x40, 0x3e, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x80, 0x00, 0x80, 0x00, 0x02,
+    0x02, 0x00, 0xd3, 0x00, 0x00, 0x80, 0x00, 0x66, 0x01, 0x33, 0x00, 0x00, 0x05, 0x00, 0x00, 0x02,
+    0x02, 0x00, 0x3e, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x01, 0x00, 0x00, 0x02,
+    0x02, 0x00, 0xd3, 0x00, 0x00, 0x80, 0x00, 0x66, 0x01, 0x33, 0x00, 0x00, 0x06, 0x00, 0x00, 0x02,
+    0x02, 0x00, 0x3e, 0x80, 0x00, 0x02, 0x06, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x01, 0x00, 0x00, 0x02,
+    0x02, 0x00, 0xd3, 0x00, 0x00, 0x80, 0x00, 0x66, 0x01, 0x33, 0xfe, 0x00, 0x05, 0x00, 0x00, 0x01,
+    0x02, 0x00, 0x00, 0x00, 0xee, 0x80, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xee, 0x80, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0xff, 0xff, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0x06, 0x80, 0x00, 0x40, 0x00, 0x00, 0xee, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x07, 0x00, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0x07, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x80, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x09, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x09, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x40, 0x00,
+    0x00, 0x40, 0x31, 0x44, 0x20, 0xcc, 0x80, 0x08, 0x35, 0x03, 0x20, 0x0c, 0x80, 0xe4, 0x08, 0x46,
+    0x2c, 0x78, 0x80, 0x09, 0x31, 0x03, 0x30, 0x00, 0x80, 0x00, 0x90, 0xc0, 0xe7, 0xe8, 0x90, 0xc0,
+    0x90, 0xc0, 0x94, 0x4e, 0x39, 0x28, 0x20, 0x00, 0xbf, 0xff, 0x30, 0x00, 0x20, 0x00, 0x80, 0x00,
+    0x92, 0xc8, 0x40, 0x99, 0x9f, 0x7c, 0x33, 0x64, 0x20, 0xcc, 0x80, 0x08, 0x31, 0x44, 0x20, 0xc8,
+    0x80, 0x08, 0x35, 0x03, 0x20, 0x0c, 0x80, 0xe4, 0x90, 0xc0, 0x90, 0xc0, 0x94, 0xc0, 0xc0, 0x80,
+    0xc1, 0x80, 0x9c, 0xc0, 0x75, 0x50, 0x76, 0x50, 0x75, 0xd1, 0x76, 0xd1, 0xc9, 0x80, 0xca, 0x80,
+    0x3e, 0x00, 0xa0, 0x0a, 0x77, 0x50, 0x74, 0x50, 0x77, 0xd1, 0x74, 0xd1, 0xcb, 0x80, 0xcc, 0x80,
+    0x3e, 0x00, 0xa0, 0x0f, 0x75, 0x50, 0x76, 0x50, 0x75, 0xd1, 0x76, 0xd1, 0xed, 0xe9, 0xee, 0xe9,
+    0x3a, 0x00, 0x00, 0x08, 0x40, 0x80, 0x00, 0x40, 0xa1, 0x0c, 0x77, 0x50, 0x77, 0xd1, 0xef, 0xe9,
+    0xe8, 0xe9, 0x36, 0x80, 0xa1, 0x00, 0xe9, 0xe9, 0xea, 0xe9, 0x36, 0x80, 0xa1, 0x00, 0xeb, 0xe9,
+    0xec, 0xe9, 0x36, 0x80, 0xa1, 0x00, 0xed, 0xe9, 0xee, 0xe9, 0x36, 0x80, 0xa0, 0x00, 0xef, 0xe9,
+    0xe0, 0xe9, 0x94, 0xc0, 0xe1, 0xe9, 0xe2, 0xe9, 0x94, 0xc0, 0xe3, 0xe9, 0xc7, 0x60, 0x94, 0xc0,
+    0xcc, 0x50, 0xcd, 0x50, 0x94, 0xc0, 0xce, 0x50, 0xcf, 0x50, 0x31, 0x44, 0x20, 0x00, 0x80, 0x08,
+    0x9f, 0x79, 0x9f, 0x71, 0x01, 0x46, 0x2b, 0xcc, 0x80, 0x09, 0x3a, 0x40, 0x2b, 0xc8, 0x80, 0x09,
+    0x24, 0xea, 0x3d, 0x40, 0x2b, 0xc4, 0x80, 0x09, 0x84, 0x47, 0x96, 0xc0, 0x9b, 0x41, 0x2b, 0x03,
+    0x80, 0x08, 0x2c, 0x30, 0x14, 0x92, 0x53, 0x95, 0x26, 0x6a, 0x34, 0xf8, 0x3f, 0xff, 0xbf, 0xff,
+    0x84, 0x27, 0x6c, 0xd3, 0x72, 0x61, 0x96, 0xc1, 0x00, 0x08, 0x41, 0x00, 0x00, 0x40, 0x6d, 0x30,
+    0x31, 0xe0, 0x9f, 0xff, 0x94, 0xc3, 0xcc, 0x40, 0xc8, 0x43, 0x78, 0x41, 0x92, 0xc3, 0xec, 0x18,
+    0x92, 0xc3, 0x92, 0x9c, 0x52, 0x92, 0x71, 0x70, 0x81, 0xe1, 0x90, 0xc0, 0x92, 0xd0, 0xed, 0x48,
+    0xea, 0x48, 0x90, 0xc0, 0x39, 0x60, 0x3f, 0xf8, 0x80, 0x04, 0xc2, 0x81, 0x13, 0x91, 0xd9, 0x12,
+    0x71, 0xe2, 0x27, 0x18, 0x80, 0x34, 0x38, 0x00, 0x24, 0xec, 0x80, 0x04, 0xc1, 0x9c, 0x5a, 0x98,
+    0x59, 0x98, 0x5b, 0x98, 0x5c, 0x98, 0x9f, 0x4b, 0x90, 0xc0, 0x21, 0x03, 0x80, 0x0a, 0x92, 0xd0,
+    0x9d, 0xe1, 0x9d, 0x82, 0x9f, 0x4c, 0x6c, 0x10, 0x21, 0x03, 0x80, 0x08, 0x92, 0xc8, 0x90, 0x82,
+    0x78, 0xe1, 0x64, 0xe9, 0x85, 0xdb, 0x38, 0x40, 0x20, 0x64, 0x80, 0x09, 0x6c, 0x10, 0x5a, 0x98,
+    0x90, 0xc0, 0x2a, 0x0a, 0x80, 0x01, 0xea, 0xf1, 0xea, 0x61, 0x35, 0x44, 0x20, 0x06, 0x00, 0x08,
+    0x41, 0x80, 0x00, 0x40, 0x80, 0x08, 0x59, 0x98, 0x5b, 0x98, 0x5c, 0x98, 0x9f, 0x4b, 0x90, 0xc0,
+    0x21, 0x03, 0x80, 0x0a, 0x92, 0xd0, 0x9d, 0xe1, 0x9d, 0x82, 0x9f, 0x4c, 0x90, 0xc0, 0x21, 0xe3,
+    0x9f, 0xd7, 0x92, 0xc8, 0x90, 0x82, 0x8f, 0xcf, 0x9f, 0x71, 0x9f, 0x71, 0x9f, 0x71, 0x90, 0xc0,
+    0x90, 0xc0, 0x9f, 0x71, 0x34, 0x80, 0xa0, 0x00, 0x9f, 0x63, 0x9f, 0x71, 0x2d, 0x10, 0xe7, 0x48,
+    0x2c, 0x90, 0x38, 0x80, 0x2c, 0x00, 0x80, 0x09, 0x20, 0x00, 0x82, 0x00, 0xf0, 0x41, 0x02, 0x82,
+    0x33, 0x3c, 0x80, 0x09, 0x02, 0x81, 0x3a, 0x36, 0x80, 0x09, 0x02, 0x82, 0x33, 0x38, 0x80, 0x09,
+    0x02, 0x82, 0x33, 0x34, 0x80, 0x09, 0x02, 0x82, 0x33, 0x30, 0x80, 0x09, 0x02, 0x82, 0x33, 0x1c,
+    0x80, 0x09, 0x02, 0x82, 0x33, 0x18, 0x80, 0x09, 0x02, 0x82, 0x33, 0x14, 0x80, 0x09, 0x32, 0xe4,
+    0x3c, 0x8a, 0x80, 0x01, 0x00, 0x08, 0x42, 0x00, 0x00, 0x40, 0x02, 0x82, 0x33, 0x10, 0x80, 0x09,
+    0x2c, 0x10, 0x04, 0x86, 0x2c, 0x00, 0x80, 0x09, 0x2c, 0x90, 0xc2, 0x81, 0x23, 0x00, 0x82, 0x00,
+    0x30, 0xec, 0x80, 0x4f, 0xf3, 0x41, 0x38, 0x80, 0x30, 0x00, 0x80, 0x09, 0x00, 0x82, 0x33, 0x20,
+    0x80, 0x09, 0x04, 0x82, 0x2c, 0x00, 0x80, 0x09, 0x00, 0x81, 0x3a, 0x35, 0x80, 0x09, 0x00, 0x82,
+    0x32, 0xfc, 0x80, 0x09, 0x00, 0x82, 0x32, 0xf8, 0x80, 0x09, 0x00, 0x82, 0x32, 0xf4, 0x80, 0x09,
+    0x00, 0x82, 0x32, 0xf0, 0x80, 0x09, 0x00, 0x82, 0x33, 0x2c, 0x80, 0x09, 0x00, 0x82, 0x33, 0x28,
+    0x80, 0x09, 0x00, 0x82, 0x33, 0x24, 0x80, 0x09, 0x32, 0xe4, 0x3c, 0x8a, 0x80, 0x01, 0x02, 0x81,
+    0x3a, 0x36, 0x80, 0x09, 0x2c, 0x90, 0x00, 0x86, 0x30, 0x00, 0x80, 0x09, 0x32, 0xe8, 0x80, 0x4f,
+    0xc1, 0x81, 0xe7, 0x68, 0x00, 0x82, 0x30, 0x00, 0x80, 0x09, 0x00, 0x08, 0x42, 0x80, 0x00, 0x40,
+    0x9f, 0x70, 0x01, 0x81, 0x3a, 0x35, 0x80, 0x09, 0x33, 0x24, 0x3f, 0x30, 0x80, 0x09, 0x24, 0x69,
+    0x37, 0x50, 0xc0, 0x8e, 0x84, 0x11, 0x33, 0xe4, 0x39, 0xea, 0x80, 0x01, 0xc0, 0x84, 0x00, 0x81,
+    0x3a, 0x36, 0x80, 0x09, 0xd3, 0x21, 0x84, 0x13, 0x32, 0xe4, 0x39, 0xea, 0x80, 0x01, 0xc0, 0x8f,
+    0xc0, 0x84, 0x00, 0x81, 0x3a, 0x35, 0x80, 0x09, 0x31, 0x24, 0x3f, 0x50, 0x80, 0x09, 0x31, 0xe4,
+    0x3a, 0x5c, 0x80, 0x01, 0x31, 0xe4, 0x3a, 0x62, 0x80, 0x01, 0x31, 0x24, 0x3f, 0x30, 0x80, 0x09,
+    0x83, 0xfb, 0x24, 0x69, 0x37, 0x50, 0x00, 0x85, 0x3a, 0x36, 0x80, 0x09, 0x84, 0x43, 0x64, 0x69,
+    0x80, 0x3f, 0xd0, 0x23, 0x80, 0x3b, 0x39, 0x80, 0x33, 0x58, 0x80, 0x09, 0x38, 0xe8, 0x2c, 0x00,
+    0xbf, 0xff, 0x10, 0x91, 0x3a, 0xe8, 0x2c, 0x04, 0xbf, 0xff, 0x00, 0x90, 0xc0, 0xa6, 0x31, 0x81,
+    0x00, 0x08, 0x43, 0x00, 0x00, 0x40, 0x2c, 0x00, 0x80, 0x09, 0x83, 0xba, 0x01, 0x92, 0x39, 0x40,
+    0x35, 0xb4, 0x80, 0x08, 0x32, 0xe4, 0x39, 0xe4, 0x80, 0x01, 0xc0, 0x8e, 0xc0, 0x83, 0x00, 0x81,
+    0x3a, 0x36, 0x80, 0x09, 0xd3, 0x21, 0x84, 0x61, 0x00, 0x85, 0x3a, 0x35, 0x80, 0x09, 0x64, 0x69,
+    0x80, 0x57, 0xd0, 0x23, 0x80, 0x53, 0x38, 0x80, 0x33, 0x54, 0x80, 0x09, 0x3a, 0xe8, 0x28, 0x00,
+    0xbf, 0xff, 0x10, 0x90, 0x39, 0xe8, 0x28, 0x04, 0xbf, 0xff, 0x40, 0x92, 0x30, 0x81, 0x30, 0x00,
+    0x80, 0x09, 0x00, 0x91, 0x39, 0x40, 0x38, 0x46, 0x80, 0x08, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09,
+    0x90, 0xc0, 0x10, 0x90, 0x80, 0x78, 0x0d, 0x40, 0xa0, 0x00, 0x80, 0x0d, 0x83, 0x58, 0xc0, 0xa2,
+    0xc1, 0x84, 0x83, 0x58, 0xc0, 0xa2, 0x32, 0xe4, 0x39, 0xe4, 0x80, 0x01, 0xc0, 0x8f, 0xc0, 0x83,
+    0x00, 0x81, 0x3a, 0x35, 0x80, 0x09, 0x00, 0x08, 0x43, 0x80, 0x00, 0x40, 0x31, 0x24, 0x3f, 0x50,
+    0x80, 0x09, 0x31, 0xe4, 0x39, 0xd2, 0x80, 0x01, 0x83, 0x3f, 0x2e, 0x10, 0xe8, 0xf1, 0xe7, 0x58,
+    0xc0, 0x81, 0xef, 0xe8, 0xee, 0xe9, 0x24, 0x18, 0x82, 0xe0, 0xf0, 0x45, 0x39, 0xe8, 0x3c, 0x14,
+    0xbf, 0xff, 0x31, 0xf1, 0x3f, 0xff, 0xbf, 0xff, 0x12, 0x91, 0x38, 0xc8, 0x3c, 0x10, 0xbf, 0xff,
+    0xdc, 0x82, 0x01, 0x91, 0x39, 0xe8, 0x3c, 0x04, 0xbf, 0xff, 0x31, 0x41, 0x2e, 0x00, 0x92, 0x00,
+    0x01, 0x91, 0x30, 0xe9, 0x3f, 0xff, 0xb0, 0x00, 0x11, 0x90, 0xf7, 0x99, 0xdc, 0x01, 0x00, 0x90,
+    0x39, 0xc8, 0x3c, 0x00, 0xbf, 0xff, 0x50, 0x90, 0x09, 0x90, 0xa0, 0x00, 0x40, 0x90, 0x50, 0x90,
+    0x0c, 0x90, 0xa0, 0x00, 0x84, 0x08, 0x92, 0xc3, 0x6f, 0x10, 0xc6, 0x81, 0x3a, 0x41, 0x2d, 0x90,
+    0xc1, 0x11, 0x33, 0xf4, 0x32, 0x00, 0x20, 0x00, 0x80, 0x42, 0x92, 0xc2, 0x00, 0x08, 0x44, 0x00,
+    0x00, 0x40, 0x6e, 0x90, 0xd4, 0xc2, 0x92, 0xc3, 0xc5, 0x81, 0x15, 0x05, 0xa0, 0x01, 0x84, 0x0a,
+    0x24, 0xe0, 0xd4, 0x43, 0xc3, 0x81, 0xd4, 0x43, 0xc3, 0x11, 0x24, 0x61, 0x25, 0xe0, 0xf0, 0x44,
+    0x31, 0x70, 0xf1, 0x43, 0x80, 0x27, 0x71, 0x60, 0x84, 0x0b, 0x70, 0xe3, 0x80, 0x1f, 0x70, 0xfb,
+    0x84, 0x1b, 0x90, 0xc0, 0xc1, 0x11, 0x24, 0xe0, 0xf2, 0xc4, 0x31, 0x70, 0xf3, 0xc3, 0x81, 0xf4,
+    0x65, 0xe0, 0x71, 0x60, 0x84, 0x07, 0x71, 0xf9, 0x81, 0xeb, 0x67, 0x69, 0x84, 0x07, 0x66, 0xe9,
+    0x81, 0x95, 0x27, 0x69, 0x37, 0x00, 0x20, 0x00, 0x82, 0x00, 0x25, 0x18, 0x80, 0xf4, 0x38, 0xe8,
+    0x3c, 0x38, 0xbf, 0xff, 0x90, 0xc0, 0x50, 0x90, 0x83, 0x20, 0x31, 0xff, 0x9f, 0xff, 0x32, 0xe4,
+    0x3c, 0x4e, 0x80, 0x01, 0x34, 0xff, 0x67, 0x60, 0x38, 0xc8, 0x3c, 0x10, 0xbf, 0xff, 0x31, 0xa1,
+    0x33, 0xb0, 0x00, 0x08, 0x44, 0x80, 0x00, 0x40, 0x80, 0x00, 0x30, 0x79, 0x51, 0x90, 0x33, 0x09,
+    0x87, 0xff, 0xd9, 0x09, 0x80, 0x34, 0x92, 0xc2, 0xc9, 0x86, 0x31, 0x81, 0x20, 0x20, 0x80, 0x00,
+    0x70, 0x79, 0x80, 0x26, 0x92, 0xc2, 0xc9, 0x85, 0x36, 0x70, 0x80, 0x18, 0x80, 0x1c, 0x92, 0xc2,
+    0xc9, 0x84, 0x36, 0x50, 0x80, 0x10, 0x80, 0x12, 0x92, 0xc2, 0xc9, 0x83, 0x36, 0x30, 0x80, 0x08,
+    0x80, 0x08, 0x92, 0xc2, 0xc9, 0x82, 0xc9, 0x81, 0x38, 0x40, 0x2c, 0xba, 0x80, 0x09, 0x09, 0x81,
+    0x3a, 0x37, 0x80, 0x09, 0xe9, 0xfc, 0xe9, 0x18, 0x18, 0xd1, 0xf2, 0x46, 0x2a, 0xff, 0x9e, 0xb3,
+    0xc8, 0x4f, 0x27, 0x60, 0x01, 0x85, 0x3a, 0x37, 0x80, 0x09, 0x34, 0xe1, 0x39, 0x40, 0x2c, 0xea,
+    0x80, 0x09, 0x3c, 0xc1, 0xf2, 0xc6, 0xc8, 0x41, 0x90, 0xc0, 0xe9, 0x18, 0x59, 0xd1, 0xc9, 0x49,
+    0x32, 0xe4, 0x3c, 0x4e, 0x80, 0x01, 0x64, 0xe0, 0x00, 0x08, 0x45, 0x00, 0x00, 0x40, 0x3d, 0x44,
+    0x3a, 0x40, 0x2c, 0xba, 0x80, 0x09, 0x3a, 0x01, 0x80, 0x07, 0x36, 0x00, 0x80, 0x07, 0xe8, 0x1a,
+    0x17, 0xd0, 0xd8, 0x91, 0x3f, 0xdc, 0xd4, 0x41, 0x09, 0x10, 0xa2, 0x00, 0xdf, 0x98, 0x00, 0x85,
+    0x3a, 0x37, 0x80, 0x09, 0x34, 0x60, 0x39, 0xc8, 0x3c, 0x18, 0xbf, 0xff, 0xdc, 0x1a, 0xb0, 0x3b,
+    0x00, 0x85, 0x3a, 0x37, 0x80, 0x09, 0x7c, 0x44, 0x00, 0x80, 0x3a, 0x2c, 0x80, 0x09, 0x50, 0x91,
+    0x0c, 0x00, 0xa0, 0x03, 0x84, 0x07, 0x09, 0x97, 0xa0, 0x00, 0x27, 0x69, 0x32, 0x81, 0x20, 0x00,
+    0x80, 0x00, 0x27, 0x18, 0x81, 0x12, 0x35, 0x7a, 0x10, 0x97, 0x80, 0x04, 0x31, 0x18, 0x80, 0x07,
+    0x34, 0x60, 0x00, 0x81, 0x3a, 0x37, 0x80, 0x09, 0x11, 0x97, 0x80, 0x04, 0x33, 0x99, 0x80, 0x00,
+    0x71, 0x61, 0x84, 0xe7, 0x24, 0x69, 0x38, 0xc8, 0x3c, 0x10, 0xbf, 0xff, 0x80, 0xdd, 0x00, 0x08,
+    0x45, 0x80, 0x00, 0x40, 0x11, 0x90, 0x30, 0xe9, 0x3f, 0xff, 0xb0, 0x00, 0xdc, 0x01, 0x40, 0x90,
+    0x10, 0x90, 0x11, 0x97, 0x80, 0x04, 0x33, 0x7e, 0x9f, 0xf0, 0x7f, 0x64, 0xd8, 0x96, 0xdc, 0x98,
+    0x41, 0x90, 0x50, 0x90, 0x09, 0x10, 0xa8, 0x00, 0x2a, 0xff, 0x9d, 0xe3, 0x40, 0x90, 0x3b, 0x41,
+    0x11, 0x97, 0x80, 0x04, 0x33, 0x19, 0x80, 0x07, 0x3c, 0xc1, 0x38, 0x40, 0x2c, 0xea, 0x80, 0x09,
+    0xc9, 0x41, 0x90, 0xc0, 0xe9, 0x18, 0x51, 0xd1, 0x32, 0xe4, 0x3c, 0x4e, 0x80, 0x01, 0x36, 0xc1,
+    0x80, 0x01, 0xcd, 0x40, 0x36, 0x02, 0x80, 0x06, 0x3a, 0x03, 0x80, 0x06, 0x30, 0xc8, 0x87, 0xc1,
+    0xed, 0x61, 0xcd, 0x49, 0xcd, 0x40, 0x38, 0xe8, 0x3c, 0x24, 0xbf, 0xff, 0x39, 0xe8, 0x3c, 0x20,
+    0xbf, 0xff, 0xed, 0x61, 0x0d, 0x90, 0x3a, 0xe8, 0x3c, 0x14, 0xbf, 0xff, 0x09, 0xb1, 0xa0, 0x00,
+    0x01, 0x91, 0xd8, 0x13, 0x00, 0x08, 0x46, 0x00, 0x00, 0x40, 0x10, 0x92, 0xd5, 0x40, 0x09, 0x50,
+    0xa0, 0x00, 0x00, 0x92, 0x3b, 0x40, 0x2c, 0xba, 0x80, 0x09, 0x00, 0x85, 0x3a, 0x37, 0x80, 0x09,
+    0x34, 0x60, 0x3c, 0x40, 0x2c, 0xca, 0x80, 0x09, 0x31, 0x19, 0x80, 0x07, 0x3c, 0xc1, 0xc9, 0x40,
+    0xc8, 0x41, 0xe9, 0xfc, 0xe8, 0x1b, 0x11, 0xd0, 0xe9, 0x1c, 0x36, 0x51, 0x3c, 0xdc, 0x59, 0xd1,
+    0x3a, 0x43, 0x80, 0x04, 0x36, 0x42, 0x80, 0x04, 0xd9, 0x93, 0xd5, 0x43, 0xe9, 0xfc, 0xdf, 0x9a,
+    0x09, 0x80, 0x3a, 0x2c, 0x80, 0x09, 0xdf, 0x99, 0x11, 0x97, 0x80, 0x04, 0x33, 0x79, 0x9f, 0xf0,
+    0x88, 0x0e, 0xdc, 0x19, 0x6c, 0x10, 0xf0, 0x45, 0x00, 0x81, 0x3a, 0x37, 0x80, 0x09, 0xb0, 0x3b,
+    0x38, 0x00, 0x20, 0xe0, 0x80, 0x08, 0x39, 0xe8, 0x3c, 0x04, 0xbf, 0xff, 0x1a, 0x97, 0x80, 0x06,
+    0x4a, 0x10, 0x47, 0x91, 0x2e, 0x10, 0xee, 0xf1, 0x25, 0x18, 0x00, 0x08, 0x46, 0x80, 0x00, 0x40,
+    0x82, 0xbc, 0x39, 0xe8, 0x3c, 0x14, 0xbf, 0xff, 0x31, 0xe9, 0x3f, 0xff, 0xbf, 0xff, 0x12, 0x91,
+    0x38, 0xc8, 0x3c, 0x10, 0xbf, 0xff, 0xdc, 0x82, 0x01, 0x91, 0x39, 0xe8, 0x3c, 0x08, 0xbf, 0xff,
+    0x31, 0x41, 0x2e, 0x00, 0x90, 0x00, 0x01, 0x91, 0x30, 0x79, 0x30, 0x00, 0xbf, 0xff, 0x11, 0x90,
+    0xf7, 0x99, 0xdc, 0x01, 0x00, 0x90, 0x39, 0xc8, 0x3c, 0x00, 0xbf, 0xff, 0x50, 0x90, 0x09, 0x80,
+    0xa0, 0x00, 0x40, 0x90, 0x50, 0x90, 0x0c, 0x80, 0xa0, 0x00, 0x84, 0x08, 0x92, 0xc3, 0x6f, 0x10,
+    0xc6, 0x81, 0x3a, 0x41, 0x2d, 0x90, 0xc1, 0x11, 0x33, 0xf4, 0x32, 0x00, 0x20, 0x00, 0x80, 0x42,
+    0x92, 0xc2, 0x6e, 0x90, 0xd4, 0xc2, 0x92, 0xc3, 0xc5, 0x81, 0x15, 0x05, 0xa0, 0x01, 0x84, 0x0a,
+    0x24, 0xe0, 0xd4, 0x43, 0xc3, 0x81, 0xd4, 0x43, 0xc3, 0x11, 0x24, 0x61, 0x25, 0xe0, 0xf0, 0x44,
+    0x00, 0x08, 0x47, 0x00, 0x00, 0x40, 0x31, 0x70, 0xf1, 0x43, 0x80, 0x27, 0x71, 0x60, 0x84, 0x0b,
+    0x70, 0xe3, 0x80, 0x1f, 0x70, 0xfb, 0x84, 0x1b, 0x90, 0xc0, 0xc1, 0x11, 0x24, 0xe0, 0xf2, 0xc4,
+    0x31, 0x70, 0xf3, 0xc3, 0x81, 0xf4, 0x65, 0xe0, 0x71, 0x60, 0x84, 0x07, 0x71, 0xf9, 0x81, 0xeb,
+    0x67, 0x69, 0x84, 0x07, 0x66, 0xe9, 0x81, 0x95, 0x27, 0x69, 0x2c, 0x10, 0x38, 0xe8, 0x3c, 0x38,
+    0xbf, 0xff, 0x80, 0xd2, 0xf0, 0x42, 0x50, 0x90, 0x31, 0xe8, 0x9f, 0xff, 0x2a, 0xff, 0x9c, 0x41,
+    0x30, 0xcf, 0x84, 0x10, 0x32, 0xe4, 0x3c, 0x4e, 0x80, 0x01, 0x34, 0xff, 0x67, 0x60, 0x31, 0xa1,
+    0x33, 0xb0, 0x80, 0x00, 0x30, 0x79, 0x38, 0xc8, 0x3c, 0x10, 0xbf, 0xff, 0x90, 0xc0, 0x51, 0x90,
+    0x33, 0x1f, 0x87, 0xff, 0x80, 0x34, 0x92, 0xc2, 0xc8, 0x86, 0x31, 0x81, 0x20, 0x20, 0x80, 0x00,
+    0x70, 0x79, 0x80, 0x26, 0x92, 0xc2, 0x00, 0x08, 0x47, 0x80, 0x00, 0x40, 0xc8, 0x85, 0x36, 0x70,
+    0x80, 0x18, 0x80, 0x1c, 0x92, 0xc2, 0xc8, 0x84, 0x36, 0x50, 0x80, 0x10, 0x80, 0x12, 0x92, 0xc2,
+    0xc8, 0x83, 0x36, 0x30, 0x80, 0x08, 0x80, 0x08, 0x92, 0xc2, 0xc8, 0x82, 0xc8, 0x81, 0x08, 0x81,
+    0x3a, 0x3a, 0x80, 0x09, 0x2a, 0xff, 0x9b, 0xdf, 0xef, 0xe8, 0x27, 0x60, 0x01, 0x85, 0x3a, 0x3a,
+    0x80, 0x09, 0x34, 0xe1, 0x38, 0x40, 0x2c, 0xea, 0x80, 0x09, 0x3c, 0xc1, 0xcf, 0x4a, 0xc9, 0x41,
+    0x90, 0xc0, 0xe9, 0x18, 0x58, 0xd1, 0xc8, 0x49, 0x32, 0xe4, 0x3c, 0x4e, 0x80, 0x01, 0x64, 0xe0,
+    0x3f, 0xc4, 0x03, 0x85, 0x3a, 0x3a, 0x80, 0x09, 0x35, 0xe3, 0x01, 0x85, 0x3a, 0x3a, 0x80, 0x09,
+    0x34, 0xe1, 0xdd, 0x9f, 0xb3, 0x33, 0x3a, 0x43, 0x80, 0x00, 0x38, 0x43, 0x80, 0x00, 0x36, 0x40,
+    0x80, 0x00, 0x3c, 0xdc, 0xd9, 0x13, 0xd5, 0x40, 0x00, 0x85, 0x3a, 0x3a, 0x00, 0x08, 0x48, 0x00,
+    0x00, 0x40, 0x80, 0x09, 0x3c, 0x44, 0xdc, 0x9a, 0xf1, 0x42, 0x00, 0x80, 0x3a, 0x2e, 0x80, 0x09,
+    0x27, 0x69, 0x31, 0x81, 0x20, 0x00, 0x80, 0x00, 0x27, 0x18, 0x81, 0x0e, 0x34, 0xf9, 0x10, 0x96,
+    0x80, 0x04, 0x31, 0x98, 0x80, 0x00, 0x30, 0xe0, 0x38, 0xc8, 0x3c, 0x10, 0xbf, 0xff, 0x84, 0xed,
+    0x11, 0x90, 0x30, 0x79, 0x30, 0x00, 0xbf, 0xff, 0xdc, 0x01, 0x40, 0x90, 0x10, 0x90, 0x11, 0x96,
+    0x80, 0x04, 0x33, 0x7e, 0x9f, 0xf0, 0x7f, 0x64, 0xdc, 0x1e, 0x40, 0x90, 0x50, 0x90, 0x09, 0x00,
+    0xa8, 0x00, 0x40, 0x90, 0x10, 0x96, 0x80, 0x04, 0x31, 0x18, 0x80, 0x07, 0x2a, 0xff, 0x9b, 0x2d,
+    0x00, 0x81, 0x3a, 0x3a, 0x80, 0x09, 0x3b, 0x41, 0x01, 0x85, 0x3a, 0x3a, 0x80, 0x09, 0x34, 0xe1,
+    0x38, 0x40, 0x2c, 0xea, 0x80, 0x09, 0x7c, 0xc1, 0xc9, 0x41, 0x90, 0xc0, 0xe9, 0x18, 0x51, 0xd1,
+    0x32, 0xe4, 0x00, 0x08, 0x48, 0x80, 0x00, 0x40, 0x3c, 0x4e, 0x80, 0x01, 0x36, 0xc1, 0x80, 0x01,
+    0xc9, 0x40, 0x3a, 0x01, 0x80, 0x06, 0x36, 0x02, 0x80, 0x06, 0x30, 0xc8, 0x87, 0xc1, 0xcf, 0x40,
+    0x38, 0xe8, 0x3c, 0x24, 0xbf, 0xff, 0xe9, 0x61, 0xc9, 0x48, 0x3a, 0xe8, 0x3c, 0x20, 0xbf, 0xff,
+    0xef, 0x61, 0x0f, 0x90, 0x3b, 0xe8, 0x3c, 0x14, 0xbf, 0xff, 0x09, 0xb0, 0xa0, 0x00, 0x00, 0x92,
+    0xd8, 0x91, 0x10, 0x93, 0xd5, 0x41, 0x09, 0x90, 0xa0, 0x00, 0x00, 0x93, 0x3c, 0x40, 0x2c, 0xba,
+    0x80, 0x09, 0x00, 0x85, 0x3a, 0x3a, 0x80, 0x09, 0x34, 0x60, 0x3d, 0x40, 0x2c, 0xca, 0x80, 0x09,
+    0x31, 0x19, 0x80, 0x07, 0x3c, 0xc1, 0xc9, 0x40, 0xc8, 0x41, 0xe9, 0xfc, 0xe8, 0x1c, 0x11, 0xd0,
+    0xe9, 0x1d, 0x36, 0xd1, 0x3c, 0xdc, 0x19, 0xd1, 0xf4, 0xc2, 0x3a, 0x43, 0x80, 0x05, 0x36, 0x42,
+    0x80, 0x05, 0xd9, 0x93, 0xe9, 0xfc, 0xd5, 0x43, 0x00, 0x08, 0x49, 0x00, 0x00, 0x40, 0x09, 0x80,
+    0x3a, 0x2e, 0x80, 0x09, 0xde, 0x1a, 0x12, 0x96, 0x80, 0x04, 0xde, 0x19, 0x35, 0x79, 0x9f, 0xf0,
+    0xf4, 0x42, 0x88, 0x0e, 0xdc, 0x19, 0x6c, 0x10, 0xf0, 0x45, 0x00, 0x81, 0x3a, 0x3a, 0x80, 0x09,
+    0xb0, 0x33, 0x38, 0x00, 0x20, 0xe2, 0x80, 0x08, 0x1a, 0x96, 0x80, 0x06, 0x0a, 0x10, 0x39, 0xe8,
+    0x3c, 0x08, 0xbf, 0xff, 0xf0, 0xc2, 0x40, 0x91, 0x27, 0x04, 0x8e, 0x64, 0x90, 0xc0, 0x90, 0xc0,
+    0x90, 0xc8, 0x38, 0xc8, 0x3c, 0x10, 0xbf, 0xff, 0xf0, 0xc5, 0x34, 0x68, 0x11, 0x90, 0xe7, 0x78,
+    0x30, 0x24, 0x3f, 0x50, 0x80, 0x09, 0x41, 0x90, 0x24, 0x69, 0xc8, 0x41, 0xe7, 0x48, 0x84, 0x0c,
+    0xe8, 0xfe, 0x88, 0x0e, 0x39, 0x80, 0x2c, 0x00, 0x80, 0x09, 0x39, 0x80, 0x30, 0x00, 0x80, 0x09,
+    0xf2, 0x89, 0xe9, 0x18, 0x11, 0x91, 0xd1, 0x21, 0x84, 0x16, 0xf1, 0x42, 0x12, 0xfc, 0x00, 0x08,
+    0x49, 0x80, 0x00, 0x40, 0x9f, 0xec, 0x34, 0xe9, 0x81, 0x0a, 0xf2, 0x8b, 0xf1, 0x42, 0x88, 0x16,
+    0x34, 0xe9, 0x82, 0x80, 0x12, 0xfc, 0x9f, 0xec, 0x34, 0xe9, 0x81, 0x1a, 0xf2, 0x8b, 0xf1, 0x42,
+    0x34, 0xe9, 0x82, 0x90, 0x24, 0x69, 0xf1, 0x42, 0x84, 0x0b, 0x88, 0x10, 0x39, 0x80, 0x2c, 0x00,
+    0x80, 0x09, 0x39, 0x80, 0x30, 0x00, 0x80, 0x09, 0x90, 0xc0, 0xe8, 0x19, 0x27, 0xe9, 0x9f, 0xf8,
+    0x50, 0x91, 0x00, 0x90, 0xe7, 0x68, 0x9f, 0x71, 0x31, 0x18, 0x87, 0x00, 0x34, 0x10, 0x81, 0x00,
+    0x84, 0x09, 0xc2, 0x82, 0x88, 0x08, 0xc0, 0x8a, 0x2d, 0x10, 0x6c, 0x10, 0xd0, 0xa1, 0xd0, 0x5a,
+    0x9f, 0x70, 0x74, 0x78, 0x2b, 0xff, 0x98, 0xeb, 0xcd, 0x50, 0xcc, 0x51, 0xcd, 0x5f, 0x3b, 0xe1,
+    0xc1, 0x9c, 0xcc, 0x58, 0x24, 0x69, 0xe7, 0x48, 0x36, 0xe0, 0x80, 0x01, 0x34, 0xe1, 0x80, 0x01,
+    0xd8, 0x91, 0xd4, 0xc0, 0x00, 0x08, 0x4a, 0x00, 0x00, 0x40, 0x84, 0x14, 0xcd, 0x57, 0xc8, 0x41,
+    0x39, 0x80, 0x32, 0x00, 0x80, 0x09, 0x88, 0x16, 0x00, 0x85, 0x33, 0x5b, 0x80, 0x09, 0xc8, 0x41,
+    0x39, 0x80, 0x32, 0x70, 0x80, 0x09, 0x00, 0x85, 0x33, 0x57, 0x80, 0x09, 0xe8, 0x19, 0x39, 0xc8,
+    0x3c, 0x10, 0xbf, 0xff, 0xb2, 0x86, 0x30, 0xcb, 0x80, 0x41, 0x10, 0x91, 0xf6, 0x92, 0x34, 0xf2,
+    0x9f, 0xff, 0xf5, 0x91, 0x10, 0x90, 0x80, 0x02, 0xb4, 0x87, 0xb6, 0x07, 0xb5, 0x06, 0x80, 0x48,
+    0xce, 0x50, 0x32, 0xe2, 0x34, 0xd2, 0x3f, 0xc2, 0xcc, 0x58, 0x80, 0x3d, 0x3b, 0xc2, 0x18, 0x01,
+    0xa0, 0x01, 0xf7, 0x03, 0x2f, 0x90, 0xcf, 0x57, 0x2a, 0xff, 0x9e, 0xfd, 0x37, 0xd2, 0xf7, 0x02,
+    0x25, 0xe9, 0xce, 0x58, 0x84, 0x23, 0x83, 0x58, 0xc1, 0x81, 0x35, 0x57, 0xd0, 0x2a, 0x84, 0x19,
+    0x39, 0x41, 0xcf, 0x5f, 0x34, 0xf2, 0x2d, 0x10, 0xcc, 0x58, 0x00, 0x08, 0x4a, 0x80, 0x00, 0x40,
+    0xf2, 0x02, 0xf7, 0x03, 0x2a, 0xff, 0x9e, 0xd7, 0x18, 0x01, 0xa0, 0x01, 0x34, 0xf4, 0x9f, 0xff,
+    0x80, 0x3f, 0x33, 0x64, 0x34, 0xd4, 0xcc, 0x58, 0x80, 0x37, 0xcd, 0x5f, 0x3f, 0xc2, 0x18, 0x01,
+    0xa0, 0x02, 0x2d, 0x10, 0xf7, 0x03, 0x2a, 0xff, 0x9e, 0xb5, 0xf2, 0x02, 0x25, 0xe9, 0xce, 0x58,
+    0x84, 0x1f, 0x83, 0x12, 0xc1, 0x82, 0x3a, 0x41, 0xd0, 0x22, 0x84, 0x15, 0x2d, 0x10, 0x34, 0xf4,
+    0xcc, 0x58, 0xf7, 0x03, 0xf2, 0x02, 0x2a, 0xff, 0x9e, 0x95, 0x18, 0x01, 0xa0, 0x02, 0xce, 0x58,
+    0x2a, 0xff, 0x9e, 0xf5, 0xc1, 0x81, 0x36, 0x50, 0x34, 0xd5, 0xcd, 0x5f, 0x3f, 0xc2, 0xcc, 0x5a,
+    0x3b, 0xc2, 0x34, 0x52, 0xcd, 0x57, 0xf4, 0x02, 0xf7, 0x03, 0x2a, 0xff, 0x9e, 0x71, 0x18, 0x01,
+    0xa0, 0x01, 0x65, 0xe9, 0x84, 0x1b, 0x3a, 0xc1, 0xd2, 0x2a, 0x84, 0x15, 0x34, 0xf5, 0xcc, 0x58,
+    0x00, 0x08, 0x4b, 0x00, 0x00, 0x40, 0xf7, 0x03, 0x18, 0x02, 0xa0, 0x08, 0x2a, 0xff, 0x9e, 0x55,
+    0x18, 0x01, 0xa0, 0x01, 0xce, 0x58, 0x2a, 0xff, 0x9e, 0xb5, 0xc1, 0x82, 0x36, 0x50, 0x34, 0xd6,
+    0xcc, 0x5a, 0x34, 0x52, 0xcd, 0x5f, 0xf4, 0x02, 0xf7, 0x03, 0x2a, 0xff, 0x9e, 0x37, 0x18, 0x01,
+    0xa0, 0x02, 0x65, 0xe9, 0x84, 0x1b, 0x3b, 0x41, 0xd2, 0x22, 0x84, 0x15, 0x34, 0xf6, 0xcc, 0x58,
+    0xf7, 0x03, 0x18, 0x02, 0xa0, 0x08, 0x2a, 0xff, 0x9e, 0x1b, 0x18, 0x01, 0xa0, 0x02, 0x30, 0x24,
+    0x3f, 0x50, 0x80, 0x09, 0xe7, 0x68, 0x31, 0x84, 0x35, 0x7c, 0x80, 0x08, 0x2b, 0xff, 0x97, 0x75,
+    0xe7, 0x48, 0xee, 0xe9, 0x2a, 0xff, 0x96, 0x5b, 0xef, 0xe8, 0x2c, 0x10, 0x39, 0x00, 0x20, 0xe0,
+    0x80, 0x08, 0x38, 0x00, 0x20, 0xe2, 0x80, 0x08, 0x00, 0x11, 0xef, 0xf1, 0x40, 0x10, 0x00, 0x81,
+    0x3a, 0x37, 0x80, 0x09, 0x00, 0x81, 0x00, 0x08, 0x4b, 0x80, 0x00, 0x40, 0x3a, 0x3a, 0x80, 0x09,
+    0x24, 0x18, 0x84, 0xa0, 0x2c, 0x10, 0x00, 0x81, 0x3a, 0x34, 0x80, 0x09, 0x2b, 0xff, 0x96, 0xf9,
+    0x00, 0x85, 0x3a, 0x36, 0x80, 0x09, 0x64, 0x69, 0x80, 0x0b, 0x50, 0x97, 0x00, 0x82, 0x33, 0x58,
+    0x80, 0x09, 0x2a, 0xff, 0x97, 0x2b, 0x6c, 0x10, 0xe9, 0x39, 0xe8, 0xef, 0x2a, 0xff, 0x97, 0xdd,
+    0x18, 0x01, 0xa0, 0x05, 0x24, 0x69, 0x2c, 0x10, 0x38, 0xc8, 0x3c, 0x10, 0xbf, 0xff, 0x84, 0x0b,
+    0x2b, 0xff, 0x96, 0xc5, 0x21, 0x18, 0x84, 0x5c, 0x11, 0x90, 0x00, 0x86, 0x33, 0x58, 0x80, 0x09,
+    0x0c, 0x00, 0xa0, 0x02, 0x32, 0xc9, 0x82, 0xd0, 0x84, 0x18, 0x92, 0xc3, 0xc0, 0x82, 0xc0, 0x81,
+    0xd4, 0x41, 0x30, 0xc8, 0x87, 0x43, 0x36, 0x10, 0x80, 0x80, 0x84, 0x07, 0x20, 0x00, 0x80, 0x80,
+    0x35, 0xf0, 0x2c, 0x90, 0x38, 0x80, 0x2c, 0x00, 0x80, 0x09, 0x39, 0xe1, 0x00, 0x08, 0x4c, 0x00,
+    0x00, 0x40, 0x00, 0x84, 0x3a, 0x2c, 0x80, 0x09, 0x3d, 0xc2, 0xc9, 0x40, 0xcc, 0x43, 0x33, 0x11,
+    0x20, 0x00, 0x80, 0x00, 0xec, 0x18, 0x03, 0x94, 0xc2, 0xff, 0x14, 0x97, 0x80, 0x08, 0x00, 0x80,
+    0x32, 0x04, 0x80, 0x09, 0x00, 0x80, 0x32, 0x0a, 0x80, 0x09, 0x00, 0x80, 0x32, 0x08, 0x80, 0x09,
+    0x01, 0x80, 0x32, 0x06, 0x80, 0x09, 0x02, 0x80, 0x32, 0x0e, 0x80, 0x09, 0x02, 0x80, 0x32, 0x0c,
+    0x80, 0x09, 0x04, 0x80, 0x32, 0x02, 0x80, 0x09, 0xc3, 0x83, 0x29, 0xb3, 0x11, 0x97, 0x80, 0x0a,
+    0xe9, 0xfc, 0x00, 0x80, 0x32, 0x24, 0x80, 0x09, 0x00, 0x80, 0x32, 0x26, 0x80, 0x09, 0x01, 0x80,
+    0x32, 0x1e, 0x80, 0x09, 0x09, 0x80, 0x32, 0x22, 0x80, 0x09, 0x02, 0x80, 0x32, 0x28, 0x80, 0x09,
+    0x02, 0x80, 0x32, 0x2a, 0x80, 0x09, 0x03, 0x80, 0x32, 0x20, 0x80, 0x09, 0x11, 0x97, 0x80, 0x0c,
+    0xca, 0x40, 0x00, 0x08, 0x4c, 0x80, 0x00, 0x40, 0x01, 0x80, 0x32, 0x3a, 0x80, 0x09, 0xc1, 0x85,
+    0x28, 0xb1, 0xea, 0xfe, 0x00, 0x80, 0x32, 0x40, 0x80, 0x09, 0x00, 0x80, 0x32, 0x42, 0x80, 0x09,
+    0x01, 0x80, 0x32, 0x3c, 0x80, 0x09, 0x02, 0x80, 0x32, 0x44, 0x80, 0x09, 0x02, 0x80, 0x32, 0x46,
+    0x80, 0x09, 0x0a, 0x80, 0x32, 0x3e, 0x80, 0x09, 0x11, 0x97, 0x80, 0x0e, 0x01, 0x80, 0x32, 0x56,
+    0x80, 0x09, 0xc1, 0x87, 0x02, 0x80, 0x32, 0x62, 0x80, 0x09, 0x29, 0x31, 0x02, 0x80, 0x32, 0x60,
+    0x80, 0x09, 0xc1, 0x86, 0x0b, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x00, 0x80, 0x32, 0x5e, 0x80, 0x09,
+    0x28, 0x31, 0x00, 0x80, 0x32, 0x5c, 0x80, 0x09, 0x00, 0x80, 0x32, 0x5a, 0x80, 0x09, 0x02, 0x80,
+    0x32, 0x58, 0x80, 0x09, 0x10, 0x93, 0x80, 0x14, 0x31, 0x18, 0x80, 0xff, 0x3c, 0x42, 0x38, 0xc0,
+    0x3e, 0x5c, 0x80, 0x09, 0xc9, 0x40, 0x90, 0xc0, 0x00, 0x08, 0x4d, 0x00, 0x00, 0x40, 0xe9, 0x18,
+    0x50, 0x91, 0x00, 0x82, 0x32, 0x10, 0x80, 0x09, 0x10, 0x93, 0x80, 0x3c, 0x31, 0x18, 0x80, 0xff,
+    0x2a, 0xff, 0x9e, 0x3f, 0x74, 0x60, 0x0a, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x00, 0x80, 0x32, 0x18,
+    0x80, 0x09, 0x10, 0x92, 0x80, 0x16, 0x31, 0x18, 0x80, 0xff, 0x3c, 0x42, 0x39, 0xc0, 0x3e, 0x5c,
+    0x80, 0x09, 0xc8, 0x40, 0x90, 0xc0, 0xe8, 0x19, 0x50, 0x90, 0x00, 0x82, 0x32, 0x2c, 0x80, 0x09,
+    0x10, 0x92, 0x80, 0x3e, 0x31, 0x18, 0x80, 0xff, 0x2a, 0xff, 0x9e, 0x07, 0x74, 0x60, 0x0a, 0x86,
+    0x3a, 0x58, 0x80, 0x09, 0x00, 0x80, 0x32, 0x34, 0x80, 0x09, 0x10, 0x92, 0x80, 0x18, 0x31, 0x18,
+    0x80, 0xff, 0x3c, 0x42, 0x39, 0xc0, 0x3e, 0x5c, 0x80, 0x09, 0xc8, 0x40, 0x90, 0xc0, 0xe8, 0x19,
+    0x50, 0x90, 0x00, 0x82, 0x32, 0x48, 0x80, 0x09, 0x10, 0x92, 0x80, 0x40, 0x31, 0x18, 0x00, 0x08,
+    0x4d, 0x80, 0x00, 0x40, 0x80, 0xff, 0x2a, 0xff, 0x9d, 0xcf, 0x74, 0x60, 0x0a, 0x86, 0x3a, 0x58,
+    0x80, 0x09, 0x00, 0x80, 0x32, 0x50, 0x80, 0x09, 0x10, 0x92, 0x80, 0x1a, 0x31, 0x18, 0x80, 0xff,
+    0x3c, 0x42, 0x39, 0xc0, 0x3e, 0x5c, 0x80, 0x09, 0xc8, 0x40, 0x90, 0xc0, 0xe8, 0x19, 0x50, 0x90,
+    0x00, 0x82, 0x32, 0x64, 0x80, 0x09, 0x10, 0x92, 0x80, 0x42, 0x31, 0x18, 0x80, 0xff, 0x2a, 0xff,
+    0x9d, 0x97, 0x74, 0x60, 0x0a, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x00, 0x80, 0x32, 0x6c, 0x80, 0x09,
+    0x10, 0x92, 0x80, 0x14, 0x3c, 0x68, 0x39, 0xc0, 0x3e, 0x5c, 0x80, 0x09, 0x7c, 0x42, 0xc8, 0x40,
+    0x90, 0xc0, 0xe8, 0x19, 0x50, 0x90, 0x00, 0x82, 0x32, 0x14, 0x80, 0x09, 0x10, 0x92, 0x80, 0x3c,
+    0x7c, 0x68, 0x2a, 0xff, 0x9d, 0x63, 0x74, 0x60, 0x0a, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x00, 0x80,
+    0x32, 0x1a, 0x80, 0x09, 0x00, 0x08, 0x4e, 0x00, 0x00, 0x40, 0x10, 0x92, 0x80, 0x16, 0x3c, 0x68,
+    0x39, 0xc0, 0x3e, 0x5c, 0x80, 0x09, 0x7c, 0x42, 0xc8, 0x40, 0x90, 0xc0, 0xe8, 0x19, 0x50, 0x90,
+    0x00, 0x82, 0x32, 0x30, 0x80, 0x09, 0x10, 0x92, 0x80, 0x3e, 0x7c, 0x68, 0x2a, 0xff, 0x9d, 0x2f,
+    0x74, 0x60, 0x0a, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x00, 0x80, 0x32, 0x36, 0x80, 0x09, 0x10, 0x92,
+    0x80, 0x18, 0x3c, 0x68, 0x39, 0xc0, 0x3e, 0x5c, 0x80, 0x09, 0x7c, 0x42, 0xc8, 0x40, 0x90, 0xc0,
+    0xe8, 0x19, 0x50, 0x90, 0x00, 0x82, 0x32, 0x4c, 0x80, 0x09, 0x10, 0x92, 0x80, 0x40, 0x7c, 0x68,
+    0x2a, 0xff, 0x9c, 0xfb, 0x74, 0x60, 0x0a, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x00, 0x80, 0x32, 0x52,
+    0x80, 0x09, 0x10, 0x92, 0x80, 0x1a, 0x3c, 0x68, 0x39, 0xc0, 0x3e, 0x5c, 0x80, 0x09, 0x7c, 0x42,
+    0xc8, 0x40, 0x90, 0xc0, 0xe8, 0x19, 0x50, 0x90, 0x00, 0x82, 0x00, 0x08, 0x4e, 0x80, 0x00, 0x40,
+    0x32, 0x68, 0x80, 0x09, 0x10, 0x92, 0x80, 0x42, 0x7c, 0x68, 0x2a, 0xff, 0x9c, 0xc7, 0x74, 0x60,
+    0xc8, 0x40, 0x00, 0x87, 0x32, 0x1e, 0x80, 0x09, 0x01, 0x87, 0x32, 0x02, 0x80, 0x09, 0x33, 0x1a,
+    0x80, 0xff, 0x31, 0x19, 0x80, 0xff, 0x30, 0xe2, 0x08, 0x80, 0x32, 0x6e, 0x80, 0x09, 0x84, 0x0f,
+    0x09, 0x00, 0xa0, 0xff, 0xc8, 0x40, 0x08, 0x80, 0x32, 0x1e, 0x80, 0x09, 0x00, 0x87, 0x32, 0x02,
+    0x80, 0x09, 0x31, 0x1a, 0x80, 0xff, 0x00, 0x87, 0x32, 0x3a, 0x80, 0x09, 0x31, 0x19, 0x80, 0xff,
+    0x70, 0xe2, 0x84, 0x0f, 0x09, 0x00, 0xa0, 0xff, 0xc8, 0x40, 0x08, 0x80, 0x32, 0x3a, 0x80, 0x09,
+    0x00, 0x87, 0x32, 0x02, 0x80, 0x09, 0x31, 0x1a, 0x80, 0xff, 0x00, 0x87, 0x32, 0x56, 0x80, 0x09,
+    0x31, 0x19, 0x80, 0xff, 0x70, 0xe2, 0x84, 0x0f, 0x09, 0x00, 0xa0, 0xff, 0xc8, 0x40, 0x08, 0x80,
+    0x00, 0x08, 0x4f, 0x00, 0x00, 0x40, 0x32, 0x56, 0x80, 0x09, 0x00, 0x87, 0x32, 0x1e, 0x80, 0x09,
+    0x31, 0x1a, 0x80, 0xff, 0x00, 0x87, 0x32, 0x3a, 0x80, 0x09, 0x31, 0x19, 0x80, 0xff, 0x70, 0xe2,
+    0x84, 0x0f, 0x09, 0x00, 0xa0, 0xff, 0xc8, 0x40, 0x08, 0x80, 0x32, 0x3a, 0x80, 0x09, 0x00, 0x87,
+    0x32, 0x1e, 0x80, 0x09, 0x31, 0x1a, 0x80, 0xff, 0x00, 0x87, 0x32, 0x56, 0x80, 0x09, 0x31, 0x19,
+    0x80, 0xff, 0x70, 0xe2, 0x84, 0x0f, 0x09, 0x00, 0xa0, 0xff, 0xc8, 0x40, 0x08, 0x80, 0x32, 0x56,
+    0x80, 0x09, 0x00, 0x87, 0x32, 0x3a, 0x80, 0x09, 0x31, 0x1a, 0x80, 0xff, 0x00, 0x87, 0x32, 0x56,
+    0x80, 0x09, 0x31, 0x19, 0x80, 0xff, 0x70, 0xe2, 0x84, 0x0f, 0x09, 0x00, 0xa0, 0xff, 0xc8, 0x40,
+    0x08, 0x80, 0x32, 0x56, 0x80, 0x09, 0x2c, 0x90, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0,
+    0x10, 0x90, 0x80, 0x02, 0x0c, 0x00, 0x00, 0x08, 0x4f, 0x80, 0x00, 0x40, 0xa0, 0x04, 0x80, 0x17,
+    0x00, 0x87, 0x32, 0x02, 0x80, 0x09, 0x31, 0x18, 0x80, 0xff, 0xf0, 0x02, 0xf0, 0x01, 0x2a, 0xff,
+    0x9a, 0x4f, 0xc0, 0x81, 0x2c, 0x90, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0, 0x10, 0x90,
+    0x80, 0x02, 0x0c, 0x00, 0xa0, 0x08, 0x80, 0x17, 0x00, 0x87, 0x32, 0x1e, 0x80, 0x09, 0x31, 0x18,
+    0x80, 0xff, 0xf0, 0x02, 0xf0, 0x01, 0x2a, 0xff, 0x9a, 0x27, 0xc0, 0x82, 0x2c, 0x90, 0x08, 0x86,
+    0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0, 0x10, 0x90, 0x80, 0x02, 0x0c, 0x00, 0xa0, 0x10, 0x80, 0x17,
+    0x00, 0x87, 0x32, 0x3a, 0x80, 0x09, 0x31, 0x18, 0x80, 0xff, 0xf0, 0x02, 0xf0, 0x01, 0x2a, 0xff,
+    0x99, 0xff, 0xc0, 0x83, 0x2c, 0x90, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0, 0x10, 0x90,
+    0x80, 0x02, 0x0c, 0x00, 0xa0, 0x20, 0x80, 0x17, 0x00, 0x87, 0x32, 0x56, 0x00, 0x08, 0x50, 0x00,
+    0x00, 0x40, 0x80, 0x09, 0x31, 0x18, 0x80, 0xff, 0xf0, 0x02, 0xf0, 0x01, 0x2a, 0xff, 0x99, 0xd7,
+    0xc0, 0x84, 0xc1, 0x81, 0x30, 0x61, 0x2c, 0x00, 0x80, 0x09, 0x01, 0x81, 0x3a, 0x38, 0x80, 0x09,
+    0x00, 0x82, 0x33, 0x50, 0x80, 0x09, 0x00, 0x85, 0x3a, 0x37, 0x80, 0x09, 0x34, 0xe0, 0x38, 0x40,
+    0x2c, 0xda, 0x80, 0x09, 0x3c, 0xc1, 0x00, 0x85, 0x3a, 0x34, 0x80, 0x09, 0x24, 0x69, 0xc9, 0x41,
+    0x90, 0xc0, 0xe9, 0x18, 0x58, 0x11, 0x80, 0x08, 0xc8, 0x4e, 0xe8, 0xfc, 0xc8, 0x4e, 0x2c, 0x10,
+    0xee, 0xf1, 0x00, 0x81, 0x3a, 0x34, 0x80, 0x09, 0x24, 0x18, 0x83, 0xd6, 0x06, 0x80, 0x3a, 0x32,
+    0x80, 0x09, 0x2a, 0xff, 0x92, 0x29, 0xc0, 0x81, 0x00, 0x85, 0x3a, 0x35, 0x80, 0x09, 0x64, 0x69,
+    0x80, 0x0b, 0x50, 0x96, 0x00, 0x82, 0x33, 0x54, 0x80, 0x09, 0x2a, 0xff, 0x92, 0x59, 0xc0, 0x81,
+    0xe9, 0xee, 0x00, 0x08, 0x50, 0x80, 0x00, 0x40, 0xe8, 0x38, 0x2a, 0xff, 0x93, 0x0b, 0x18, 0x01,
+    0xa0, 0x05, 0x24, 0x69, 0xc0, 0x81, 0x84, 0x09, 0x2b, 0xff, 0x91, 0xf9, 0x8b, 0x99, 0x08, 0x86,
+    0x3a, 0x58, 0x80, 0x09, 0x39, 0xc8, 0x3c, 0x10, 0xbf, 0xff, 0x10, 0x90, 0x80, 0x78, 0x0d, 0x40,
+    0xa0, 0x00, 0x84, 0x0b, 0xc0, 0x90, 0x00, 0x80, 0x3a, 0x2e, 0x80, 0x09, 0x11, 0x91, 0x00, 0x86,
+    0x33, 0x54, 0x80, 0x09, 0x0c, 0x00, 0xa0, 0x02, 0x32, 0xc9, 0x82, 0xc0, 0x84, 0x18, 0x92, 0xc3,
+    0xc0, 0x82, 0xc0, 0x81, 0xd4, 0x41, 0x30, 0xc8, 0x87, 0x43, 0x36, 0x10, 0x80, 0x80, 0x84, 0x07,
+    0x20, 0x00, 0x80, 0x80, 0x35, 0xf0, 0x2d, 0x10, 0x39, 0x80, 0x30, 0x00, 0x80, 0x09, 0x39, 0xe1,
+    0x00, 0x84, 0x3a, 0x2e, 0x80, 0x09, 0x3d, 0xc2, 0xca, 0x40, 0xcc, 0x43, 0x33, 0x11, 0x20, 0x00,
+    0x80, 0x00, 0xec, 0x19, 0x03, 0x94, 0xc1, 0xff, 0x00, 0x08, 0x51, 0x00, 0x00, 0x40, 0x13, 0x96,
+    0x80, 0x08, 0x00, 0x80, 0x32, 0x74, 0x80, 0x09, 0x00, 0x80, 0x32, 0x78, 0x80, 0x09, 0x00, 0x80,
+    0x32, 0x7a, 0x80, 0x09, 0x02, 0x80, 0x32, 0x76, 0x80, 0x09, 0x01, 0x80, 0x32, 0x7c, 0x80, 0x09,
+    0x01, 0x80, 0x32, 0x7e, 0x80, 0x09, 0xc2, 0x83, 0x29, 0xb2, 0x03, 0x80, 0x32, 0x72, 0x80, 0x09,
+    0x19, 0x96, 0x80, 0x0a, 0xcb, 0x40, 0xea, 0xfc, 0x00, 0x80, 0x32, 0x94, 0x80, 0x09, 0x00, 0x80,
+    0x32, 0x96, 0x80, 0x09, 0x0a, 0x80, 0x32, 0x92, 0x80, 0x09, 0x01, 0x80, 0x32, 0x9a, 0x80, 0x09,
+    0x01, 0x80, 0x32, 0x98, 0x80, 0x09, 0x09, 0x80, 0x32, 0x8e, 0x80, 0x09, 0xc2, 0x85, 0x29, 0x32,
+    0x03, 0x80, 0x32, 0x90, 0x80, 0x09, 0x19, 0x96, 0x80, 0x0c, 0xeb, 0xfe, 0x00, 0x80, 0x32, 0xb0,
+    0x80, 0x09, 0x00, 0x80, 0x32, 0xb2, 0x80, 0x09, 0x01, 0x80, 0x32, 0xb4, 0x80, 0x09, 0x00, 0x08,
+    0x51, 0x80, 0x00, 0x40, 0x01, 0x80, 0x32, 0xb6, 0x80, 0x09, 0x02, 0x80, 0x32, 0xac, 0x80, 0x09,
+    0x09, 0x80, 0x32, 0xaa, 0x80, 0x09, 0x0b, 0x80, 0x32, 0xae, 0x80, 0x09, 0x19, 0x96, 0x80, 0x0e,
+    0x01, 0x80, 0x32, 0xd0, 0x80, 0x09, 0x01, 0x80, 0x32, 0xd2, 0x80, 0x09, 0xc1, 0x87, 0x29, 0x31,
+    0xc1, 0x86, 0x00, 0x80, 0x32, 0xcc, 0x80, 0x09, 0x28, 0x31, 0x00, 0x80, 0x32, 0xce, 0x80, 0x09,
+    0x00, 0x80, 0x32, 0xca, 0x80, 0x09, 0x09, 0x80, 0x32, 0xc6, 0x80, 0x09, 0x02, 0x80, 0x32, 0xc8,
+    0x80, 0x09, 0x10, 0x90, 0x80, 0x1c, 0x31, 0x18, 0x80, 0xff, 0x3c, 0x42, 0x39, 0xc0, 0x3e, 0x5c,
+    0x80, 0x09, 0xca, 0x40, 0x90, 0xc0, 0xea, 0x19, 0x50, 0x92, 0x00, 0x82, 0x32, 0x80, 0x80, 0x09,
+    0x10, 0x90, 0x80, 0x44, 0x31, 0x18, 0x80, 0xff, 0x2a, 0xff, 0x99, 0x5d, 0x74, 0x60, 0x0a, 0x86,
+    0x3a, 0x58, 0x80, 0x09, 0x00, 0x08, 0x52, 0x00, 0x00, 0x40, 0x00, 0x80, 0x32, 0x88, 0x80, 0x09,
+    0x10, 0x92, 0x80, 0x1e, 0x31, 0x18, 0x80, 0xff, 0x3c, 0x42, 0x39, 0xc0, 0x3e, 0x5c, 0x80, 0x09,
+    0xc8, 0x40, 0x90, 0xc0, 0xe8, 0x19, 0x50, 0x90, 0x00, 0x82, 0x32, 0x9c, 0x80, 0x09, 0x10, 0x92,
+    0x80, 0x46, 0x31, 0x18, 0x80, 0xff, 0x2a, 0xff, 0x99, 0x25, 0x74, 0x60, 0x0a, 0x86, 0x3a, 0x58,
+    0x80, 0x09, 0x00, 0x80, 0x32, 0xa4, 0x80, 0x09, 0x10, 0x92, 0x80, 0x20, 0x31, 0x18, 0x80, 0xff,
+    0x3c, 0x42, 0x39, 0xc0, 0x3e, 0x5c, 0x80, 0x09, 0xc8, 0x40, 0x90, 0xc0, 0xe8, 0x19, 0x50, 0x90,
+    0x00, 0x82, 0x32, 0xb8, 0x80, 0x09, 0x10, 0x92, 0x80, 0x48, 0x31, 0x18, 0x80, 0xff, 0x2a, 0xff,
+    0x98, 0xed, 0x74, 0x60, 0x0a, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x00, 0x80, 0x32, 0xc0, 0x80, 0x09,
+    0x10, 0x92, 0x80, 0x22, 0x31, 0x18, 0x80, 0xff, 0x3c, 0x42, 0x00, 0x08, 0x52, 0x80, 0x00, 0x40,
+    0x39, 0xc0, 0x3e, 0x5c, 0x80, 0x09, 0xc8, 0x40, 0x90, 0xc0, 0xe8, 0x19, 0x50, 0x90, 0x00, 0x82,
+    0x32, 0xd4, 0x80, 0x09, 0x10, 0x92, 0x80, 0x4a, 0x31, 0x18, 0x80, 0xff, 0x2a, 0xff, 0x98, 0xb5,
+    0x74, 0x60, 0x0a, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x00, 0x80, 0x32, 0xdc, 0x80, 0x09, 0x10, 0x92,
+    0x80, 0x1c, 0x3c, 0x68, 0x39, 0xc0, 0x3e, 0x5c, 0x80, 0x09, 0x7c, 0x42, 0xc8, 0x40, 0x90, 0xc0,
+    0xe8, 0x19, 0x50, 0x90, 0x00, 0x82, 0x32, 0x84, 0x80, 0x09, 0x10, 0x92, 0x80, 0x44, 0x7c, 0x68,
+    0x2a, 0xff, 0x98, 0x81, 0x74, 0x60, 0x0a, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x00, 0x80, 0x32, 0x8a,
+    0x80, 0x09, 0x10, 0x92, 0x80, 0x1e, 0x3c, 0x68, 0x39, 0xc0, 0x3e, 0x5c, 0x80, 0x09, 0x7c, 0x42,
+    0xc8, 0x40, 0x90, 0xc0, 0xe8, 0x19, 0x50, 0x90, 0x00, 0x82, 0x32, 0xa0, 0x80, 0x09, 0x10, 0x92,
+    0x00, 0x08, 0x53, 0x00, 0x00, 0x40, 0x80, 0x46, 0x7c, 0x68, 0x2a, 0xff, 0x98, 0x4d, 0x74, 0x60,
+    0x0a, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x00, 0x80, 0x32, 0xa6, 0x80, 0x09, 0x10, 0x92, 0x80, 0x20,
+    0x3c, 0x68, 0x39, 0xc0, 0x3e, 0x5c, 0x80, 0x09, 0x7c, 0x42, 0xc8, 0x40, 0x90, 0xc0, 0xe8, 0x19,
+    0x50, 0x90, 0x00, 0x82, 0x32, 0xbc, 0x80, 0x09, 0x10, 0x92, 0x80, 0x48, 0x7c, 0x68, 0x2a, 0xff,
+    0x98, 0x19, 0x74, 0x60, 0x0a, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x00, 0x80, 0x32, 0xc2, 0x80, 0x09,
+    0x10, 0x92, 0x80, 0x22, 0x3c, 0x68, 0x39, 0xc0, 0x3e, 0x5c, 0x80, 0x09, 0x7c, 0x42, 0xc8, 0x40,
+    0x90, 0xc0, 0xe8, 0x19, 0x50, 0x90, 0x00, 0x82, 0x32, 0xd8, 0x80, 0x09, 0x10, 0x92, 0x80, 0x4a,
+    0x7c, 0x68, 0x2a, 0xff, 0x97, 0xe5, 0x74, 0x60, 0xc9, 0x40, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09,
+    0x09, 0x80, 0x32, 0xde, 0x80, 0x09, 0x00, 0x08, 0x53, 0x80, 0x00, 0x40, 0x18, 0x90, 0x80, 0x02,
+    0x0c, 0x08, 0xa0, 0x40, 0x80, 0x19, 0x00, 0x87, 0x32, 0x72, 0x80, 0x09, 0x31, 0x18, 0x80, 0xff,
+    0xc1, 0x81, 0xf0, 0x01, 0x2a, 0xff, 0x96, 0x49, 0x34, 0x51, 0xf0, 0x02, 0x08, 0x86, 0x3a, 0x58,
+    0x80, 0x09, 0x00, 0x87, 0x32, 0x8e, 0x80, 0x09, 0x18, 0x90, 0x80, 0x02, 0x0c, 0x08, 0xa0, 0x80,
+    0x80, 0x13, 0x31, 0x18, 0x80, 0xff, 0xf0, 0x02, 0xf0, 0x01, 0xc1, 0x81, 0x2a, 0xff, 0x96, 0x21,
+    0xc0, 0x82, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x00, 0x87, 0x32, 0xaa, 0x80, 0x09, 0x18, 0x90,
+    0x80, 0x02, 0x0c, 0x08, 0xa1, 0x00, 0x80, 0x13, 0x31, 0x18, 0x80, 0xff, 0xf0, 0x02, 0xf0, 0x01,
+    0xc1, 0x81, 0x2a, 0xff, 0x95, 0xfb, 0xc0, 0x83, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x00, 0x87,
+    0x32, 0xc6, 0x80, 0x09, 0x18, 0x90, 0x80, 0x02, 0x0c, 0x08, 0xa2, 0x00, 0x00, 0x08, 0x54, 0x00,
+    0x00, 0x40, 0x80, 0x13, 0x31, 0x18, 0x80, 0xff, 0xf0, 0x02, 0xf0, 0x01, 0xc1, 0x81, 0x2a, 0xff,
+    0x95, 0xd5, 0xc0, 0x84, 0xc1, 0x81, 0x30, 0x61, 0x3c, 0x00, 0x80, 0x09, 0x01, 0x81, 0x3a, 0x39,
+    0x80, 0x09, 0x00, 0x82, 0x33, 0x48, 0x80, 0x09, 0x01, 0x82, 0x33, 0x40, 0x80, 0x09, 0x00, 0x85,
+    0x3a, 0x3a, 0x80, 0x09, 0x34, 0xe0, 0x38, 0x40, 0x2c, 0xda, 0x80, 0x09, 0x3c, 0xc1, 0x00, 0x85,
+    0x3a, 0x34, 0x80, 0x09, 0x24, 0x69, 0xc9, 0x41, 0x90, 0xc0, 0xe9, 0x18, 0x58, 0x11, 0xc8, 0x48,
+    0x80, 0x12, 0x00, 0x80, 0x3a, 0x30, 0x80, 0x09, 0xe8, 0xfc, 0xc8, 0x48, 0x00, 0x80, 0x3a, 0x30,
+    0x80, 0x09, 0x01, 0x85, 0x3a, 0x37, 0x80, 0x09, 0x74, 0xe1, 0x24, 0xe9, 0x01, 0x85, 0x3a, 0x3a,
+    0x80, 0x09, 0x84, 0x09, 0x74, 0xe1, 0x64, 0xe9, 0xd3, 0x58, 0x37, 0x76, 0x34, 0xf0, 0xc2, 0xb0,
+    0x2e, 0x7d, 0x00, 0x08, 0x54, 0x80, 0x00, 0x40, 0xc2, 0x90, 0x2e, 0x7c, 0x00, 0x84, 0x3a, 0x32,
+    0x80, 0x09, 0x32, 0x64, 0x38, 0xba, 0x80, 0x08, 0xf6, 0x01, 0x30, 0x24, 0x3f, 0x50, 0x80, 0x09,
+    0x34, 0x56, 0xe7, 0x68, 0xf0, 0x85, 0x64, 0x6a, 0x84, 0x0f, 0x9f, 0x40, 0x90, 0xc0, 0x90, 0xc0,
+    0x92, 0xd0, 0x50, 0x19, 0x40, 0x18, 0x9f, 0x71, 0x33, 0x24, 0x3f, 0x30, 0x80, 0x09, 0xe7, 0x50,
+    0xc1, 0x84, 0xc7, 0x90, 0x3e, 0x80, 0x33, 0x00, 0x80, 0x09, 0x3f, 0xc0, 0x34, 0xa8, 0x80, 0x09,
+    0x36, 0xc1, 0x34, 0xe8, 0x80, 0x09, 0x18, 0x9f, 0xf1, 0x43, 0xf7, 0x01, 0xb6, 0x43, 0x32, 0x64,
+    0x3a, 0x12, 0x80, 0x08, 0x59, 0x96, 0xe9, 0xe8, 0x18, 0x9e, 0xf1, 0xc3, 0x83, 0xb8, 0x18, 0x01,
+    0xa0, 0x20, 0x78, 0xe1, 0x64, 0xea, 0x81, 0xe1, 0x30, 0x24, 0x3f, 0x50, 0x80, 0x09, 0xe7, 0x70,
+    0x24, 0x69, 0x01, 0x85, 0x3a, 0x36, 0x80, 0x09, 0x00, 0x08, 0x55, 0x00, 0x00, 0x40, 0x84, 0x4f,
+    0xd0, 0xa3, 0x84, 0x4b, 0x02, 0x86, 0x33, 0x50, 0x80, 0x09, 0x01, 0x84, 0x3a, 0x2c, 0x80, 0x09,
+    0x09, 0x02, 0xa3, 0x00, 0xdc, 0x9a, 0x38, 0xe8, 0x2c, 0x08, 0xbf, 0xff, 0x01, 0x82, 0x33, 0x4c,
+    0x80, 0x09, 0x01, 0x90, 0x32, 0x61, 0x2c, 0x00, 0x80, 0x09, 0x01, 0x85, 0x3a, 0x38, 0x80, 0x09,
+    0x24, 0xe9, 0xc1, 0x81, 0x84, 0x05, 0x88, 0x0b, 0x2c, 0x90, 0x32, 0x81, 0x24, 0x00, 0x80, 0x09,
+    0x02, 0x82, 0x33, 0x50, 0x80, 0x09, 0x01, 0x81, 0x3a, 0x38, 0x80, 0x09, 0xd0, 0x21, 0x84, 0x55,
+    0x00, 0x85, 0x3a, 0x35, 0x80, 0x09, 0xd0, 0x23, 0x84, 0x4b, 0x01, 0x86, 0x33, 0x48, 0x80, 0x09,
+    0x00, 0x84, 0x3a, 0x2e, 0x80, 0x09, 0x09, 0x01, 0xa3, 0x00, 0xdc, 0x19, 0x38, 0xe8, 0x28, 0x08,
+    0xbf, 0xff, 0x00, 0x82, 0x33, 0x44, 0x80, 0x09, 0x00, 0x90, 0x31, 0x61, 0x3c, 0x00, 0x00, 0x08,
+    0x55, 0x80, 0x00, 0x40, 0x80, 0x09, 0x00, 0x85, 0x3a, 0x39, 0x80, 0x09, 0x24, 0x69, 0xc0, 0x81,
+    0x84, 0x05, 0x88, 0x0b, 0x2c, 0x10, 0x31, 0x61, 0x34, 0x00, 0x80, 0x09, 0x01, 0x82, 0x33, 0x48,
+    0x80, 0x09, 0x00, 0x81, 0x3a, 0x39, 0x80, 0x09, 0x9f, 0x71, 0x9f, 0x71, 0x31, 0xe4, 0x3a, 0x68,
+    0x80, 0x01, 0x31, 0xe4, 0x20, 0x3c, 0x80, 0x08, 0x2b, 0xff, 0x8d, 0x17, 0x27, 0x08, 0x80, 0x20,
+    0xe7, 0xe8, 0x83, 0xea, 0xc0, 0xa6, 0x38, 0xa8, 0x3c, 0x20, 0xbf, 0xff, 0x09, 0xc6, 0x3e, 0x10,
+    0x80, 0x09, 0x1c, 0x90, 0x0a, 0x86, 0x3a, 0x54, 0x80, 0x09, 0x3b, 0xe8, 0x28, 0x0c, 0xbf, 0xff,
+    0xe8, 0xec, 0xe8, 0x39, 0x08, 0x92, 0x31, 0x61, 0x20, 0x00, 0x80, 0x05, 0x08, 0x86, 0x3a, 0x54,
+    0x80, 0x09, 0x0c, 0xc2, 0x3e, 0x10, 0x80, 0x09, 0x50, 0x93, 0x00, 0x80, 0x80, 0x60, 0x00, 0xc4,
+    0x3e, 0x56, 0x80, 0x09, 0x00, 0x08, 0x56, 0x00, 0x00, 0x40, 0x38, 0x41, 0x08, 0x86, 0x3a, 0x54,
+    0x80, 0x09, 0x00, 0xc0, 0x3e, 0x56, 0x80, 0x09, 0x50, 0x90, 0x30, 0x79, 0x31, 0x01, 0x30, 0x00,
+    0x80, 0x03, 0x80, 0x07, 0x70, 0xf8, 0x84, 0x17, 0x00, 0x85, 0x3a, 0x5e, 0x80, 0x09, 0x24, 0x69,
+    0xc0, 0x81, 0x84, 0x0b, 0x89, 0x3e, 0x00, 0x81, 0x3a, 0x5c, 0x80, 0x09, 0x92, 0x44, 0x2a, 0x03,
+    0x80, 0x10, 0x3c, 0x80, 0x32, 0x06, 0x80, 0x09, 0x38, 0x80, 0x33, 0x00, 0x80, 0x09, 0x1a, 0x14,
+    0xec, 0x44, 0x10, 0x14, 0x0b, 0x86, 0x33, 0x50, 0x80, 0x09, 0x24, 0x6a, 0x19, 0x98, 0xea, 0xfc,
+    0xea, 0x1b, 0x94, 0xc3, 0x22, 0x03, 0x80, 0x1a, 0xec, 0x58, 0x9f, 0x40, 0x90, 0xc0, 0x90, 0xc0,
+    0x92, 0xd0, 0x50, 0x1a, 0x92, 0xd0, 0x40, 0x19, 0x90, 0xc0, 0x90, 0xc0, 0x00, 0x84, 0x3a, 0x32,
+    0x80, 0x09, 0xd0, 0x28, 0x84, 0x07, 0x2b, 0xff, 0x9e, 0x35, 0x00, 0x08, 0x56, 0x80, 0x00, 0x40,
+    0x00, 0xc5, 0x3e, 0x58, 0x80, 0x09, 0x74, 0x60, 0xd0, 0x21, 0x84, 0x09, 0x33, 0x84, 0x33, 0x06,
+    0x80, 0x08, 0x38, 0x80, 0x32, 0x04, 0x80, 0x09, 0xc8, 0x4f, 0x28, 0x0a, 0x80, 0x04, 0x2a, 0x08,
+    0x80, 0x12, 0xee, 0xe8, 0xef, 0xe8, 0xf8, 0x46, 0xe8, 0x6a, 0x39, 0xc0, 0x34, 0xd8, 0x80, 0x09,
+    0xc6, 0x84, 0xfa, 0x45, 0xf9, 0x47, 0xee, 0x66, 0xef, 0x62, 0xf8, 0x48, 0x12, 0x12, 0xf8, 0xc8,
+    0x13, 0xd7, 0x00, 0x84, 0x3a, 0x32, 0x80, 0x09, 0x19, 0x90, 0xf8, 0xc6, 0x10, 0x96, 0xd0, 0x28,
+    0x84, 0x52, 0x11, 0xd0, 0x38, 0x80, 0x37, 0x1c, 0x80, 0x09, 0x3d, 0x41, 0xf1, 0x05, 0xf2, 0x06,
+    0xf0, 0x42, 0xf3, 0x01, 0x2a, 0xff, 0x9e, 0xcb, 0x18, 0x07, 0xa0, 0x01, 0xf9, 0xc7, 0x18, 0x01,
+    0xa0, 0x10, 0x32, 0x64, 0x39, 0x6a, 0x80, 0x08, 0x18, 0x91, 0x39, 0x80, 0x37, 0x1c, 0x80, 0x09,
+    0x00, 0x08, 0x57, 0x00, 0x00, 0x40, 0xc8, 0x47, 0x09, 0x86, 0x33, 0x50, 0x80, 0x09, 0x18, 0x10,
+    0x18, 0x01, 0xa0, 0x10, 0x90, 0xc0, 0xe8, 0xfc, 0xe8, 0x19, 0xf9, 0xc7, 0x90, 0xc0, 0x59, 0x91,
+    0x2a, 0xff, 0x9d, 0x83, 0xb9, 0xcb, 0x88, 0x21, 0xc8, 0x47, 0x0a, 0x86, 0x33, 0x50, 0x80, 0x09,
+    0x18, 0x10, 0xf1, 0x05, 0xf0, 0x42, 0xf2, 0x06, 0xf3, 0x01, 0xe8, 0xfc, 0x18, 0x07, 0xa0, 0x01,
+    0x2a, 0xff, 0x9e, 0x75, 0xe8, 0x1a, 0x3b, 0x61, 0xf8, 0xc8, 0x27, 0x6a, 0xf9, 0xc7, 0xe8, 0x5c,
+    0xf8, 0x48, 0xf8, 0xc6, 0xfa, 0xc5, 0xe8, 0x5c, 0xf8, 0x46, 0xc8, 0x47, 0xe9, 0x44, 0xea, 0x5c,
+    0xe8, 0x5c, 0xee, 0x5c, 0xef, 0x5c, 0xfa, 0x45, 0xc8, 0x4f, 0x81, 0x58, 0xf9, 0x47, 0x38, 0xe8,
+    0x2c, 0x0c, 0xbf, 0xff, 0xc1, 0x81, 0x10, 0x90, 0x08, 0x86, 0x3a, 0x54, 0x80, 0x09, 0x30, 0xc8,
+    0x82, 0x00, 0x24, 0x69, 0x32, 0x61, 0x00, 0x08, 0x57, 0x80, 0x00, 0x40, 0x2c, 0x00, 0x80, 0x09,
+    0x84, 0x27, 0x10, 0x90, 0x80, 0x36, 0x78, 0x41, 0x2c, 0x10, 0x00, 0x00, 0x80, 0x36, 0x01, 0x81,
+    0x3a, 0x38, 0x80, 0x09, 0x2a, 0xff, 0x9d, 0x61, 0x02, 0x82, 0x33, 0x50, 0x80, 0x09, 0x2a, 0xff,
+    0x9d, 0x57, 0x6c, 0x10, 0x88, 0x09, 0x2a, 0xff, 0x9d, 0x4f, 0x6c, 0x10, 0x2b, 0xff, 0x9d, 0xf7,
+    0x3a, 0xa8, 0x3c, 0x20, 0xbf, 0xff, 0x08, 0xc6, 0x3e, 0x10, 0x80, 0x09, 0x1a, 0x92, 0x09, 0x86,
+    0x3a, 0x54, 0x80, 0x09, 0x90, 0xc0, 0xea, 0x38, 0xba, 0x4d, 0x08, 0x86, 0x3a, 0x54, 0x80, 0x09,
+    0x90, 0xc0, 0xb4, 0xc5, 0x10, 0x80, 0x80, 0x58, 0x6c, 0x7c, 0x04, 0x80, 0x80, 0x58, 0x27, 0xe8,
+    0x9f, 0xe0, 0x30, 0x24, 0x3f, 0x50, 0x80, 0x09, 0xe7, 0xe8, 0x33, 0x24, 0x3f, 0x30, 0x80, 0x09,
+    0xe7, 0x50, 0xc1, 0x84, 0xc7, 0x90, 0x3e, 0x80, 0x32, 0xe0, 0x80, 0x09, 0x00, 0x08, 0x58, 0x00,
+    0x00, 0x40, 0x3f, 0xc0, 0x34, 0xc8, 0x80, 0x09, 0x3a, 0xc0, 0x34, 0xa8, 0x80, 0x09, 0x36, 0xc1,
+    0x34, 0xe8, 0x80, 0x09, 0x18, 0x9a, 0xf1, 0x43, 0xf7, 0x01, 0xb6, 0x43, 0x18, 0x9f, 0x59, 0x96,
+    0x32, 0x64, 0x3a, 0x12, 0x80, 0x08, 0xfa, 0x44, 0xe9, 0xe8, 0x18, 0x9e, 0xf1, 0xc3, 0xfa, 0xc4,
+    0x2a, 0xff, 0x9c, 0x6f, 0x18, 0x01, 0xa0, 0x20, 0x78, 0xe1, 0x64, 0xea, 0x81, 0xd9, 0x30, 0x24,
+    0x3f, 0x50, 0x80, 0x09, 0xe7, 0x70, 0x9f, 0x71, 0x2b, 0xff, 0x8a, 0x85, 0x27, 0x08, 0x80, 0x28,
+    0xe7, 0xe8, 0x2a, 0xff, 0x9d, 0x59, 0xc0, 0xa2, 0x3a, 0xa8, 0x3c, 0x20, 0xbf, 0xff, 0x09, 0xc6,
+    0x3e, 0x10, 0x80, 0x09, 0x10, 0x92, 0xe8, 0xea, 0x00, 0xc2, 0x3e, 0x14, 0x80, 0x09, 0x1b, 0x90,
+    0x0a, 0x86, 0x3a, 0x54, 0x80, 0x09, 0x0b, 0xc2, 0x3e, 0x14, 0x80, 0x09, 0xeb, 0x39, 0xbb, 0x51,
+    0x00, 0xc4, 0x00, 0x08, 0x58, 0x80, 0x00, 0x40, 0x3e, 0x54, 0x80, 0x09, 0x38, 0x41, 0x38, 0x80,
+    0x32, 0x76, 0x80, 0x09, 0x92, 0x44, 0x2a, 0x03, 0x80, 0x10, 0x3c, 0x80, 0x32, 0xe0, 0x80, 0x09,
+    0x00, 0xc0, 0x3e, 0x54, 0x80, 0x09, 0x1a, 0x10, 0xe8, 0x44, 0x10, 0x10, 0x0b, 0x86, 0x33, 0x48,
+    0x80, 0x09, 0x24, 0x6a, 0x19, 0x9c, 0xea, 0xfc, 0xea, 0x1b, 0x94, 0xc3, 0x22, 0x03, 0x80, 0x1a,
+    0xe8, 0x58, 0x9f, 0x40, 0x90, 0xc0, 0x90, 0xc0, 0x92, 0xd0, 0x50, 0x1a, 0x92, 0xd0, 0x40, 0x19,
+    0x90, 0xc0, 0x90, 0xc0, 0x00, 0x84, 0x3a, 0x30, 0x80, 0x09, 0xd0, 0x28, 0x84, 0x05, 0x83, 0x19,
+    0x00, 0xc5, 0x3e, 0x58, 0x80, 0x09, 0x74, 0x60, 0xd0, 0x25, 0x84, 0x09, 0x33, 0x84, 0x33, 0x06,
+    0x80, 0x08, 0x3a, 0x80, 0x32, 0x74, 0x80, 0x09, 0xc0, 0x84, 0x2a, 0x0e, 0x80, 0x04, 0x2e, 0x0f,
+    0x80, 0x12, 0xe8, 0xef, 0xeb, 0xef, 0xec, 0xef, 0x00, 0x08, 0x59, 0x00, 0x00, 0x40, 0xe8, 0x6a,
+    0x39, 0xc0, 0x34, 0xb8, 0x80, 0x09, 0xf9, 0x46, 0xf0, 0x45, 0xeb, 0x66, 0xec, 0x62, 0xf8, 0x47,
+    0xc7, 0x90, 0xc6, 0x81, 0x19, 0x90, 0x00, 0x84, 0x3a, 0x30, 0x80, 0x09, 0x13, 0x16, 0x10, 0xd4,
+    0xd0, 0x28, 0x84, 0x54, 0x11, 0x93, 0x52, 0xd7, 0x3d, 0xc1, 0xf6, 0x07, 0xf3, 0x06, 0xf2, 0x05,
+    0xf1, 0x42, 0xf0, 0x01, 0xfa, 0x48, 0xfb, 0x49, 0xfc, 0x4a, 0x2a, 0xff, 0x9c, 0x73, 0x38, 0x80,
+    0x37, 0x1c, 0x80, 0x09, 0xf9, 0xc6, 0xf7, 0x01, 0x32, 0x64, 0x39, 0x6a, 0x80, 0x08, 0x18, 0x91,
+    0x39, 0x80, 0x37, 0x1c, 0x80, 0x09, 0xfa, 0xc8, 0x09, 0x86, 0x33, 0x48, 0x80, 0x09, 0x18, 0x12,
+    0xfc, 0xca, 0xf7, 0x01, 0xe8, 0xfc, 0xe8, 0x19, 0xf9, 0xc6, 0xfb, 0xc9, 0x59, 0x91, 0x2a, 0xff,
+    0x9b, 0x2d, 0xb9, 0xcb, 0x88, 0x29, 0x18, 0x12, 0x0d, 0x86, 0x33, 0x48, 0x80, 0x09, 0x00, 0x08,
+    0x59, 0x80, 0x00, 0x40, 0xf6, 0x07, 0xf3, 0x06, 0xf2, 0x05, 0xf1, 0x42, 0xf0, 0x01, 0xe8, 0xfc,
+    0xfa, 0x48, 0xfb, 0x49, 0xfc, 0x4a, 0x2a, 0xff, 0x9c, 0x1d, 0xe8, 0x1d, 0xfa, 0xc8, 0xfb, 0xc9,
+    0xfc, 0xca, 0xf8, 0xc7, 0xf9, 0xc6, 0xf0, 0xc5, 0x38, 0x61, 0xe8, 0x5c, 0x24, 0x6a, 0xe9, 0x44,
+    0xec, 0x5c, 0xf8, 0x47, 0xf0, 0x45, 0xeb, 0x5c, 0xef, 0x5c, 0xee, 0x5c, 0xea, 0x5c, 0x81, 0x5c,
+    0xf9, 0x46, 0x38, 0xe8, 0x28, 0x0c, 0xbf, 0xff, 0x31, 0x61, 0x3c, 0x00, 0x80, 0x09, 0x10, 0x90,
+    0x08, 0x86, 0x3a, 0x54, 0x80, 0x09, 0x30, 0xc8, 0x82, 0x00, 0x24, 0x69, 0xc0, 0x81, 0x84, 0x25,
+    0x12, 0x90, 0x80, 0x38, 0x79, 0x41, 0x02, 0x00, 0x80, 0x38, 0x00, 0x81, 0x3a, 0x39, 0x80, 0x09,
+    0x2a, 0xff, 0x9b, 0x0d, 0x01, 0x82, 0x33, 0x48, 0x80, 0x09, 0x2a, 0xff, 0x9b, 0x03, 0xc0, 0x81,
+    0x88, 0x09, 0x2a, 0xff, 0x00, 0x08, 0x5a, 0x00, 0x00, 0x40, 0x9a, 0xfb, 0xc0, 0x81, 0x2b, 0xff,
+    0x9e, 0x41, 0x27, 0xe8, 0x9f, 0xd8, 0x30, 0x24, 0x3f, 0x50, 0x80, 0x09, 0xe7, 0xe8, 0x38, 0xe8,
+    0x24, 0x04, 0xbf, 0xff, 0x20, 0xe0, 0x83, 0xff, 0x11, 0x90, 0x39, 0x40, 0x3a, 0x54, 0x80, 0x08,
+    0xdc, 0x01, 0x2a, 0xff, 0x88, 0x97, 0x00, 0x90, 0xc0, 0x90, 0xc1, 0x86, 0x2a, 0xff, 0x88, 0x93,
+    0xc0, 0x90, 0xc0, 0x8c, 0x2a, 0xff, 0x88, 0x85, 0x39, 0x40, 0x3a, 0xe8, 0x80, 0x08, 0xc1, 0x86,
+    0x30, 0x44, 0x22, 0xc4, 0x80, 0x08, 0xc0, 0x8c, 0x31, 0xe4, 0x3a, 0x7a, 0x80, 0x01, 0x2a, 0xff,
+    0x9b, 0x55, 0x74, 0x68, 0x38, 0x00, 0x20, 0xe4, 0x80, 0x08, 0x39, 0xc8, 0x3c, 0x14, 0xbf, 0xff,
+    0x10, 0xd0, 0x3a, 0x00, 0x20, 0x40, 0x80, 0x08, 0x78, 0x41, 0x40, 0x10, 0x08, 0x86, 0x3a, 0x54,
+    0x80, 0x09, 0x90, 0xc0, 0x10, 0x90, 0x80, 0x50, 0x78, 0x41, 0x00, 0x08, 0x5a, 0x80, 0x00, 0x40,
+    0x00, 0x00, 0x80, 0x50, 0x50, 0x91, 0x10, 0xd2, 0x0c, 0x10, 0xa4, 0x00, 0x80, 0x49, 0x31, 0x18,
+    0x8f, 0xff, 0x31, 0x00, 0x90, 0x00, 0x2a, 0xff, 0x87, 0xf3, 0x2c, 0x10, 0x40, 0x12, 0x2a, 0xff,
+    0x87, 0xeb, 0xc0, 0x81, 0x83, 0xaa, 0xc0, 0xaa, 0x83, 0xa6, 0xc0, 0xac, 0x83, 0xa2, 0xc0, 0xa2,
+    0x83, 0x9e, 0xc0, 0xa6, 0x83, 0x9a, 0xc0, 0xb2, 0x83, 0x96, 0xc0, 0xb4, 0x83, 0x92, 0xc0, 0xb6,
+    0x83, 0x8e, 0xc0, 0xae, 0x38, 0xe8, 0x3c, 0x0c, 0xbf, 0xff, 0x30, 0x01, 0x2c, 0xcc, 0x8f, 0x58,
+    0x9f, 0x70, 0x40, 0x90, 0x31, 0xf8, 0x90, 0xff, 0x31, 0x00, 0x83, 0x00, 0x00, 0x12, 0xc0, 0x81,
+    0x9f, 0x70, 0x00, 0x81, 0x3a, 0x5c, 0x80, 0x09, 0x2b, 0xff, 0x87, 0xe3, 0x2a, 0xff, 0x9a, 0xbd,
+    0x37, 0x50, 0x74, 0x68, 0x38, 0xc8, 0x3c, 0x14, 0xbf, 0xff, 0x3b, 0x80, 0x34, 0x1c, 0x80, 0x09,
+    0x00, 0x08, 0x5b, 0x00, 0x00, 0x40, 0x10, 0x90, 0x38, 0x80, 0x38, 0x9c, 0x80, 0x09, 0x2c, 0x10,
+    0x0c, 0x10, 0xa1, 0x00, 0x80, 0x1d, 0x27, 0x04, 0x80, 0x60, 0x39, 0x80, 0x36, 0x5c, 0x80, 0x09,
+    0x3a, 0x80, 0x34, 0xdc, 0x80, 0x09, 0x94, 0xd0, 0x40, 0x19, 0x40, 0x18, 0x00, 0x1a, 0x40, 0x1b,
+    0x27, 0x60, 0x38, 0xc8, 0x3c, 0x18, 0xbf, 0xff, 0xd3, 0x2c, 0x84, 0x27, 0x10, 0x90, 0x38, 0xc8,
+    0x3c, 0x10, 0xbf, 0xff, 0x0c, 0x00, 0xa0, 0x03, 0x84, 0x19, 0x10, 0x90, 0x38, 0xe8, 0x3c, 0x04,
+    0xbf, 0xff, 0x0d, 0x10, 0xa8, 0x00, 0x80, 0x0b, 0x50, 0x90, 0x09, 0x90, 0xa0, 0x00, 0x40, 0x90,
+    0xd3, 0x2c, 0x84, 0x15, 0x09, 0x86, 0x3a, 0x54, 0x80, 0x09, 0x90, 0xc0, 0x29, 0x08, 0x80, 0x52,
+    0x88, 0x16, 0x29, 0x09, 0x80, 0x52, 0x09, 0x86, 0x3a, 0x54, 0x80, 0x09, 0x90, 0xc0, 0x29, 0x08,
+    0x80, 0x54, 0x29, 0x09, 0x80, 0x54, 0x00, 0x08, 0x5b, 0x80, 0x00, 0x40, 0x50, 0xd0, 0x78, 0x41,
+    0x30, 0x24, 0x3f, 0x50, 0x80, 0x09, 0x40, 0x11, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0,
+    0x10, 0x90, 0x80, 0x3c, 0x31, 0x18, 0x80, 0xff, 0x2a, 0xff, 0x8f, 0xb5, 0x74, 0x60, 0x08, 0x86,
+    0x3a, 0x58, 0x80, 0x09, 0x00, 0x80, 0x32, 0x18, 0x80, 0x09, 0x10, 0x90, 0x80, 0x3e, 0x31, 0x18,
+    0x80, 0xff, 0x2a, 0xff, 0x8f, 0x9b, 0x74, 0x60, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x00, 0x80,
+    0x32, 0x34, 0x80, 0x09, 0x10, 0x90, 0x80, 0x40, 0x31, 0x18, 0x80, 0xff, 0x2a, 0xff, 0x8f, 0x81,
+    0x74, 0x60, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x00, 0x80, 0x32, 0x50, 0x80, 0x09, 0x10, 0x90,
+    0x80, 0x42, 0x31, 0x18, 0x80, 0xff, 0x2a, 0xff, 0x8f, 0x67, 0x74, 0x60, 0x08, 0x86, 0x3a, 0x58,
+    0x80, 0x09, 0x00, 0x80, 0x32, 0x6c, 0x80, 0x09, 0x10, 0x90, 0x80, 0x3c, 0x00, 0x08, 0x5c, 0x00,
+    0x00, 0x40, 0x7c, 0x68, 0x2a, 0xff, 0x8f, 0x4f, 0x74, 0x60, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09,
+    0x00, 0x80, 0x32, 0x1a, 0x80, 0x09, 0x10, 0x90, 0x80, 0x3e, 0x7c, 0x68, 0x2a, 0xff, 0x8f, 0x37,
+    0x74, 0x60, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x00, 0x80, 0x32, 0x36, 0x80, 0x09, 0x10, 0x90,
+    0x80, 0x40, 0x7c, 0x68, 0x2a, 0xff, 0x8f, 0x1f, 0x74, 0x60, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09,
+    0x00, 0x80, 0x32, 0x52, 0x80, 0x09, 0x10, 0x90, 0x80, 0x42, 0x7c, 0x68, 0x2a, 0xff, 0x8f, 0x07,
+    0x74, 0x60, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x00, 0x80, 0x32, 0x6e, 0x80, 0x09, 0x10, 0x90,
+    0x80, 0x44, 0x31, 0x18, 0x80, 0xff, 0x2a, 0xff, 0x8e, 0xed, 0x74, 0x60, 0x08, 0x86, 0x3a, 0x58,
+    0x80, 0x09, 0x00, 0x80, 0x32, 0x88, 0x80, 0x09, 0x10, 0x90, 0x80, 0x46, 0x31, 0x18, 0x80, 0xff,
+    0x2a, 0xff, 0x00, 0x08, 0x5c, 0x80, 0x00, 0x40, 0x8e, 0xd3, 0x74, 0x60, 0x08, 0x86, 0x3a, 0x58,
+    0x80, 0x09, 0x00, 0x80, 0x32, 0xa4, 0x80, 0x09, 0x10, 0x90, 0x80, 0x48, 0x31, 0x18, 0x80, 0xff,
+    0x2a, 0xff, 0x8e, 0xb9, 0x74, 0x60, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x00, 0x80, 0x32, 0xc0,
+    0x80, 0x09, 0x10, 0x90, 0x80, 0x4a, 0x31, 0x18, 0x80, 0xff, 0x2a, 0xff, 0x8e, 0x9f, 0x74, 0x60,
+    0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x00, 0x80, 0x32, 0xdc, 0x80, 0x09, 0x10, 0x90, 0x80, 0x44,
+    0x7c, 0x68, 0x2a, 0xff, 0x8e, 0x87, 0x74, 0x60, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x00, 0x80,
+    0x32, 0x8a, 0x80, 0x09, 0x10, 0x90, 0x80, 0x46, 0x7c, 0x68, 0x2a, 0xff, 0x8e, 0x6f, 0x74, 0x60,
+    0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x00, 0x80, 0x32, 0xa6, 0x80, 0x09, 0x10, 0x90, 0x80, 0x48,
+    0x7c, 0x68, 0x2a, 0xff, 0x8e, 0x57, 0x74, 0x60, 0x00, 0x08, 0x5d, 0x00, 0x00, 0x40, 0x08, 0x86,
+    0x3a, 0x58, 0x80, 0x09, 0x00, 0x80, 0x32, 0xc2, 0x80, 0x09, 0x10, 0x90, 0x80, 0x4a, 0x7c, 0x68,
+    0x2a, 0xff, 0x8e, 0x3f, 0x74, 0x60, 0x9f, 0x70, 0x00, 0x80, 0x32, 0xde, 0x80, 0x09, 0x31, 0x24,
+    0x3f, 0x30, 0x80, 0x09, 0x83, 0xfb, 0x37, 0x50, 0x38, 0xe8, 0x3c, 0x00, 0xbf, 0xff, 0x90, 0xc0,
+    0x50, 0x90, 0x31, 0x28, 0x9f, 0x00, 0xdc, 0x38, 0x73, 0x60, 0x80, 0x8b, 0x36, 0x10, 0x80, 0x29,
+    0x80, 0x09, 0x36, 0x16, 0x80, 0x2a, 0x80, 0x0f, 0x36, 0x10, 0x80, 0x2a, 0x84, 0x1f, 0x36, 0x16,
+    0x80, 0x29, 0x80, 0x19, 0x32, 0xe4, 0x2b, 0x2c, 0x80, 0x08, 0x30, 0xe1, 0x30, 0x00, 0x80, 0x03,
+    0x27, 0x44, 0x86, 0x50, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc8, 0x3e, 0x16, 0x98, 0x00, 0x74, 0x56,
+    0x32, 0xe4, 0x2b, 0x2c, 0x80, 0x08, 0x64, 0x60, 0x39, 0xe8, 0x3c, 0x04, 0xbf, 0xff, 0x00, 0x08,
+    0x5d, 0x80, 0x00, 0x40, 0x30, 0x41, 0x2e, 0x00, 0x92, 0x00, 0x00, 0x91, 0x38, 0xe8, 0x3c, 0x08,
+    0xbf, 0xff, 0x27, 0x44, 0x8e, 0x20, 0x30, 0x41, 0x2e, 0x00, 0x90, 0x00, 0x40, 0x90, 0x90, 0xc8,
+    0x38, 0xc8, 0x3c, 0x14, 0xbf, 0xff, 0x30, 0x00, 0x2d, 0x40, 0x80, 0x03, 0x11, 0x90, 0x38, 0xc8,
+    0x3c, 0x14, 0xbf, 0xff, 0x0c, 0x11, 0xa4, 0x00, 0x80, 0x13, 0x90, 0xc0, 0x78, 0x61, 0x64, 0x6a,
+    0x84, 0x0b, 0x51, 0x90, 0x0d, 0x11, 0xa4, 0x00, 0x81, 0xf3, 0x31, 0x24, 0x3f, 0x50, 0x80, 0x09,
+    0x31, 0xe4, 0x3a, 0x5c, 0x80, 0x01, 0x31, 0xe4, 0x3a, 0x62, 0x80, 0x01, 0x31, 0xe4, 0x3a, 0x7a,
+    0x80, 0x01, 0xe7, 0x48, 0x9f, 0x7d, 0x10, 0x15, 0xa0, 0xe0, 0x90, 0xc0, 0x11, 0x15, 0xa0, 0xe0,
+    0x90, 0xc0, 0x9f, 0x7c, 0x11, 0x05, 0xa0, 0x04, 0x90, 0xc0, 0x11, 0x05, 0xa0, 0x08, 0x90, 0xc0,
+    0x90, 0xc0, 0x33, 0x84, 0x00, 0x08, 0x5e, 0x00, 0x00, 0x40, 0x31, 0xf8, 0x80, 0x08, 0x32, 0xe4,
+    0x3a, 0xaa, 0x80, 0x01, 0xc0, 0x83, 0x33, 0xe4, 0x3a, 0x56, 0x80, 0x01, 0x32, 0xe4, 0x3a, 0x74,
+    0x80, 0x01, 0x38, 0xe0, 0x3a, 0xa4, 0x80, 0x01, 0xc0, 0xba, 0x83, 0xac, 0x39, 0xe0, 0x3b, 0xca,
+    0x80, 0x01, 0xc1, 0x82, 0x83, 0xa8, 0xc0, 0xba, 0x38, 0xc8, 0x38, 0x00, 0xbf, 0xff, 0xc0, 0x82,
+    0x00, 0x90, 0xc0, 0xbc, 0x83, 0x92, 0x39, 0x60, 0x24, 0x46, 0x80, 0x08, 0xc1, 0x82, 0x83, 0x8e,
+    0xc0, 0xbc, 0x38, 0xc8, 0x38, 0x00, 0xbf, 0xff, 0xc0, 0x84, 0x00, 0x90, 0xc0, 0xbe, 0x83, 0x78,
+    0x39, 0x60, 0x24, 0x24, 0x80, 0x08, 0xc1, 0x82, 0x83, 0x74, 0xc0, 0xbe, 0x32, 0xe4, 0x37, 0xc8,
+    0x80, 0x01, 0x6c, 0x10, 0x32, 0xe4, 0x37, 0xc2, 0x80, 0x01, 0x6c, 0x10, 0x83, 0x66, 0xc0, 0x84,
+    0x09, 0x06, 0x35, 0x7c, 0x80, 0x08, 0xc0, 0xfd, 0x29, 0x08, 0x00, 0x08, 0x5e, 0x80, 0x00, 0x40,
+    0x80, 0x0c, 0x12, 0xd0, 0xc1, 0x86, 0xdc, 0x02, 0xb0, 0x0e, 0x83, 0x48, 0xc0, 0x84, 0x32, 0xe4,
+    0x2c, 0x5e, 0x80, 0x08, 0xc0, 0x8a, 0x2c, 0x10, 0x31, 0xe1, 0x39, 0x90, 0x80, 0x01, 0xf1, 0x41,
+    0x32, 0xe4, 0x39, 0x5a, 0x80, 0x01, 0xc1, 0x82, 0x30, 0xe1, 0x39, 0x90, 0x80, 0x01, 0xf0, 0x41,
+    0xc1, 0x82, 0x32, 0xe4, 0x39, 0x5a, 0x80, 0x01, 0xc0, 0x81, 0xc0, 0x98, 0x83, 0x10, 0x39, 0x60,
+    0x23, 0xec, 0x80, 0x08, 0xc1, 0x87, 0x83, 0x0c, 0xc0, 0x98, 0x9f, 0x7d, 0x10, 0x15, 0xa0, 0xe0,
+    0x90, 0xc0, 0x9f, 0x7c, 0x9f, 0x7c, 0xe7, 0x68, 0x9f, 0x71, 0x39, 0xc0, 0x3d, 0xd8, 0x80, 0x09,
+    0x32, 0x84, 0x30, 0x1c, 0x80, 0x08, 0x38, 0xc0, 0x3d, 0xb8, 0x80, 0x09, 0x08, 0x86, 0x3a, 0x58,
+    0x80, 0x09, 0x39, 0xc0, 0x3d, 0xd8, 0x80, 0x09, 0x18, 0x90, 0x80, 0x7a, 0x0c, 0x08, 0xa0, 0x07,
+    0x00, 0x08, 0x5f, 0x00, 0x00, 0x40, 0x80, 0x11, 0x32, 0x44, 0x2b, 0x56, 0x80, 0x08, 0x38, 0xc0,
+    0x3d, 0xb8, 0x80, 0x09, 0x88, 0x11, 0xe9, 0x39, 0x32, 0x44, 0x2b, 0x56, 0x80, 0x08, 0x38, 0xc0,
+    0x3d, 0xb8, 0x80, 0x09, 0xc8, 0x40, 0xd0, 0x28, 0xe8, 0xfc, 0x00, 0x00, 0x38, 0x6c, 0x80, 0x0a,
+    0x92, 0xc2, 0xc0, 0x88, 0x80, 0x0a, 0x08, 0x00, 0x38, 0x6e, 0x80, 0x0a, 0xc0, 0x90, 0x09, 0x86,
+    0x3a, 0x58, 0x80, 0x09, 0x00, 0x00, 0x38, 0x70, 0x80, 0x0a, 0x9f, 0x70, 0xb0, 0x0a, 0x38, 0x00,
+    0x20, 0x1c, 0x80, 0x08, 0x00, 0x67, 0x3f, 0x82, 0x80, 0x04, 0x00, 0x10, 0x39, 0x00, 0x20, 0x1e,
+    0x80, 0x08, 0x0a, 0x47, 0x2c, 0x74, 0x80, 0x09, 0x0a, 0x11, 0x38, 0x00, 0x20, 0x22, 0x80, 0x08,
+    0x2a, 0x80, 0x94, 0xaf, 0x0a, 0x10, 0x39, 0x00, 0x20, 0x24, 0x80, 0x08, 0x38, 0xa8, 0x3c, 0x58,
+    0xbf, 0xff, 0x20, 0x00, 0x91, 0x00, 0x00, 0x08, 0x5f, 0x80, 0x00, 0x40, 0x00, 0x11, 0x39, 0x00,
+    0x20, 0x48, 0x80, 0x08, 0x10, 0x90, 0xe7, 0x48, 0x31, 0xe8, 0x9f, 0xff, 0x30, 0xc8, 0x84, 0x10,
+    0x40, 0x11, 0x32, 0x84, 0x2f, 0xde, 0x80, 0x08, 0x00, 0x04, 0x38, 0x6c, 0x80, 0x0a, 0x33, 0x64,
+    0x25, 0x6a, 0x80, 0x08, 0x32, 0x84, 0x2e, 0x4c, 0x80, 0x08, 0x38, 0x80, 0x3a, 0x3c, 0x80, 0x09,
+    0x32, 0x64, 0x2d, 0x5a, 0x80, 0x08, 0x38, 0x80, 0x3a, 0x3c, 0x80, 0x09, 0x33, 0xe4, 0x38, 0xac,
+    0x80, 0x01, 0x32, 0xc4, 0x3d, 0x3c, 0x80, 0x08, 0x00, 0x04, 0x38, 0x6c, 0x80, 0x0a, 0x32, 0x64,
+    0x37, 0xc0, 0x80, 0x08, 0x00, 0x04, 0x38, 0x6e, 0x80, 0x0a, 0x9f, 0x7d, 0x00, 0x85, 0x3a, 0x37,
+    0x80, 0x09, 0x34, 0x60, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x64, 0x69, 0x84, 0x42, 0x92, 0xc3,
+    0xc9, 0x81, 0x19, 0x90, 0x80, 0x02, 0x0c, 0x09, 0xa0, 0x03, 0x84, 0x34, 0x00, 0x08, 0x60, 0x00,
+    0x00, 0x40, 0x92, 0xc3, 0xc9, 0x82, 0x10, 0x90, 0x80, 0xb0, 0x0c, 0x00, 0xa0, 0x03, 0x84, 0x26,
+    0x92, 0xc3, 0xc9, 0x83, 0x0c, 0x00, 0xa0, 0x0c, 0x84, 0x1c, 0x92, 0xc3, 0xc9, 0x84, 0x10, 0x90,
+    0x80, 0x7a, 0x0c, 0x00, 0xa0, 0x07, 0x80, 0x0d, 0x0c, 0x80, 0xa0, 0x00, 0x84, 0x08, 0x92, 0xc3,
+    0xc9, 0x85, 0xc9, 0x86, 0x2c, 0x10, 0x38, 0x00, 0x20, 0x66, 0x80, 0x08, 0x09, 0xc1, 0x3e, 0x58,
+    0x80, 0x09, 0x32, 0x44, 0x3a, 0x14, 0x80, 0x08, 0x40, 0x10, 0x33, 0xe4, 0x21, 0xa8, 0x80, 0x08,
+    0x33, 0xe4, 0x27, 0x20, 0x80, 0x08, 0x2c, 0x90, 0x38, 0xc0, 0x39, 0xf0, 0x80, 0x09, 0x20, 0x00,
+    0x82, 0x00, 0x32, 0xe4, 0x3c, 0x8a, 0x80, 0x01, 0xf0, 0x41, 0x00, 0xc5, 0x3e, 0x58, 0x80, 0x09,
+    0x34, 0x60, 0xc1, 0x83, 0xd0, 0x21, 0x84, 0x41, 0xc0, 0x81, 0x00, 0x81, 0x3a, 0x5e, 0x80, 0x09,
+    0xc0, 0xa6, 0x00, 0x08, 0x60, 0x80, 0x00, 0x40, 0x32, 0xe4, 0x3a, 0x68, 0x80, 0x01, 0x01, 0xc1,
+    0x3e, 0x59, 0x80, 0x09, 0x38, 0xa8, 0x3c, 0x20, 0xbf, 0xff, 0xc1, 0x84, 0x12, 0x90, 0xc0, 0xa6,
+    0x2a, 0xff, 0x9d, 0x3b, 0x02, 0xc2, 0x3e, 0x10, 0x80, 0x09, 0x32, 0x44, 0x34, 0xf8, 0x80, 0x08,
+    0x6c, 0x10, 0x32, 0x44, 0x34, 0xf8, 0x80, 0x08, 0x6c, 0x10, 0x88, 0x0b, 0x32, 0x84, 0x32, 0x16,
+    0x80, 0x08, 0xe8, 0x38, 0x9f, 0x7d, 0x10, 0x15, 0xa0, 0xe0, 0x90, 0xc0, 0x9f, 0x7c, 0x9f, 0x7c,
+    0xe7, 0x68, 0x9f, 0x71, 0x2c, 0x90, 0x38, 0x00, 0x20, 0xe4, 0x80, 0x08, 0xe7, 0x48, 0x2c, 0x90,
+    0x41, 0x10, 0x20, 0x00, 0x80, 0x70, 0xf0, 0x41, 0x32, 0xe4, 0x3c, 0x8a, 0x80, 0x01, 0x08, 0x86,
+    0x3a, 0x54, 0x80, 0x09, 0x2c, 0x90, 0x3a, 0xc8, 0x3c, 0x00, 0xbf, 0xff, 0x38, 0x00, 0x20, 0x48,
+    0x80, 0x08, 0x10, 0x92, 0x3a, 0x00, 0x20, 0x64, 0x00, 0x08, 0x61, 0x00, 0x00, 0x40, 0x80, 0x08,
+    0x00, 0x90, 0x38, 0x00, 0x20, 0x60, 0x80, 0x08, 0x01, 0x12, 0x3a, 0x00, 0x20, 0x62, 0x80, 0x08,
+    0x01, 0x10, 0x38, 0xe8, 0x3c, 0x00, 0xbf, 0xff, 0x01, 0x12, 0x30, 0xf9, 0x3f, 0xff, 0xbf, 0xf0,
+    0x12, 0x90, 0x39, 0xc8, 0x24, 0x28, 0xbf, 0xff, 0xdd, 0x00, 0x09, 0x12, 0xa0, 0x09, 0x02, 0x90,
+    0x3e, 0xa8, 0x3c, 0x50, 0xbf, 0xff, 0x10, 0x91, 0x3f, 0x00, 0x20, 0x34, 0x80, 0x08, 0x09, 0x00,
+    0xa0, 0x80, 0x40, 0x91, 0x01, 0x01, 0x3c, 0x4a, 0x80, 0x08, 0x2c, 0x10, 0x08, 0x86, 0x3a, 0x54,
+    0x80, 0x09, 0xc1, 0x86, 0x12, 0x90, 0x80, 0x4c, 0x79, 0x41, 0x02, 0x00, 0x80, 0x4c, 0x01, 0xc1,
+    0x3e, 0x58, 0x80, 0x09, 0x00, 0x01, 0x3a, 0x95, 0x80, 0x0a, 0x00, 0x81, 0x3a, 0x5c, 0x80, 0x09,
+    0x9f, 0x7d, 0x10, 0x15, 0xa0, 0xe0, 0x90, 0xc0, 0x11, 0x15, 0xa0, 0xe0, 0x90, 0xc0, 0x00, 0x08,
+    0x61, 0x80, 0x00, 0x40, 0x9f, 0x7c, 0x38, 0x00, 0x20, 0x28, 0x80, 0x08, 0xc0, 0xae, 0x51, 0xd0,
+    0x33, 0x99, 0x80, 0x0f, 0x09, 0x01, 0xa1, 0x00, 0x2a, 0xff, 0x9b, 0x93, 0x41, 0x10, 0x2b, 0xff,
+    0x9c, 0x45, 0x2b, 0xff, 0x9d, 0x3d, 0x33, 0xc4, 0x2f, 0x56, 0x80, 0x08, 0x6c, 0x10, 0x2a, 0xff,
+    0x9d, 0x9f, 0x00, 0x00, 0x3a, 0x98, 0x80, 0x0a, 0x33, 0x04, 0x35, 0x1c, 0x80, 0x09, 0x38, 0xa8,
+    0x3c, 0x58, 0xbf, 0xff, 0x90, 0xc0, 0x50, 0x90, 0x0c, 0xe0, 0xbf, 0xff, 0x84, 0x1b, 0x10, 0x96,
+    0x38, 0x40, 0x2d, 0x29, 0x80, 0x09, 0x0d, 0x00, 0xa8, 0x00, 0x80, 0x0d, 0x33, 0xe4, 0x37, 0xda,
+    0x80, 0x01, 0x88, 0x06, 0xc6, 0x8c, 0xc6, 0x8b, 0x38, 0xa8, 0x3c, 0x58, 0xbf, 0xff, 0x90, 0xc0,
+    0x50, 0x90, 0x31, 0xf8, 0x9f, 0xff, 0x34, 0x10, 0x80, 0x3f, 0x80, 0x65, 0x50, 0x90, 0x0c, 0xe0,
+    0xbf, 0xff, 0x84, 0x0b, 0x00, 0x08, 0x62, 0x00, 0x00, 0x40, 0x50, 0x96, 0x0d, 0x00, 0xa8, 0x00,
+    0x80, 0x55, 0x2a, 0xff, 0x9b, 0x1f, 0xc0, 0x9a, 0x32, 0xe4, 0x37, 0xda, 0x80, 0x01, 0x38, 0x40,
+    0x2d, 0x0f, 0x80, 0x09, 0x2a, 0xff, 0x9b, 0xbf, 0xc0, 0x94, 0x2a, 0xff, 0x9b, 0xb9, 0xc0, 0x92,
+    0x2a, 0xff, 0x9b, 0xb3, 0xc0, 0xa2, 0x2a, 0xff, 0x9b, 0xad, 0xc0, 0xa6, 0x2a, 0xff, 0x9b, 0xa7,
+    0xc0, 0xaa, 0x2a, 0xff, 0x9b, 0xa1, 0xc0, 0xac, 0x2a, 0xff, 0x9b, 0x9b, 0xc0, 0xae, 0x2a, 0xff,
+    0x9b, 0x95, 0xc0, 0x90, 0x2a, 0xff, 0x9b, 0x8f, 0xc0, 0x9c, 0x6c, 0x10, 0x88, 0x0a, 0x00, 0x81,
+    0x3a, 0x5c, 0x80, 0x09, 0x6f, 0x10, 0x2c, 0x90, 0x08, 0x86, 0x3a, 0x54, 0x80, 0x09, 0x30, 0x41,
+    0x21, 0xaa, 0x80, 0x08, 0x01, 0x00, 0x80, 0x20, 0x08, 0x86, 0x3a, 0x54, 0x80, 0x09, 0x90, 0xc0,
+    0x01, 0x00, 0x80, 0x24, 0x08, 0x86, 0x3a, 0x54, 0x80, 0x09, 0x00, 0x08, 0x62, 0x80, 0x00, 0x40,
+    0x90, 0xc0, 0x01, 0x00, 0x80, 0x26, 0x08, 0x86, 0x3a, 0x54, 0x80, 0x09, 0x90, 0xc0, 0x01, 0x00,
+    0x80, 0x28, 0x08, 0x86, 0x3a, 0x54, 0x80, 0x09, 0x90, 0xc0, 0x01, 0x00, 0x80, 0x2a, 0x08, 0x86,
+    0x3a, 0x54, 0x80, 0x09, 0x90, 0xc0, 0x01, 0x00, 0x80, 0x2c, 0x08, 0x86, 0x3a, 0x54, 0x80, 0x09,
+    0x90, 0xc0, 0x01, 0x00, 0x80, 0x22, 0x08, 0x86, 0x3a, 0x54, 0x80, 0x09, 0x90, 0xc0, 0x01, 0x00,
+    0x80, 0x34, 0x08, 0x86, 0x3a, 0x54, 0x80, 0x09, 0x90, 0xc0, 0x01, 0x00, 0x80, 0x2e, 0x08, 0x86,
+    0x3a, 0x54, 0x80, 0x09, 0x90, 0xc0, 0x01, 0x00, 0x80, 0x3a, 0x08, 0x86, 0x3a, 0x54, 0x80, 0x09,
+    0x90, 0xc0, 0x01, 0x00, 0x80, 0x3c, 0x08, 0x86, 0x3a, 0x54, 0x80, 0x09, 0x90, 0xc0, 0x01, 0x00,
+    0x80, 0x3e, 0x08, 0x86, 0x3a, 0x54, 0x80, 0x09, 0x90, 0xc0, 0x01, 0x00, 0x80, 0x40, 0x08, 0x86,
+    0x00, 0x08, 0x63, 0x00, 0x00, 0x40, 0x3a, 0x54, 0x80, 0x09, 0x90, 0xc0, 0x01, 0x00, 0x80, 0x42,
+    0x08, 0x86, 0x3a, 0x54, 0x80, 0x09, 0x90, 0xc0, 0x01, 0x00, 0x80, 0x44, 0x08, 0x86, 0x3a, 0x54,
+    0x80, 0x09, 0x90, 0xc0, 0x01, 0x00, 0x80, 0x46, 0x08, 0x86, 0x3a, 0x54, 0x80, 0x09, 0x90, 0xc0,
+    0x01, 0x00, 0x80, 0x48, 0x08, 0x86, 0x3a, 0x54, 0x80, 0x09, 0x90, 0xc0, 0x01, 0x00, 0x80, 0x4a,
+    0x06, 0x17, 0x38, 0x00, 0x20, 0x32, 0x80, 0x08, 0x90, 0xc0, 0x41, 0x10, 0x01, 0x85, 0x3a, 0x5c,
+    0x80, 0x09, 0x24, 0xe9, 0x00, 0x02, 0x3b, 0x30, 0x80, 0x08, 0x84, 0x53, 0x32, 0x84, 0x29, 0x76,
+    0x80, 0x08, 0x38, 0x00, 0x3c, 0x4c, 0x80, 0x08, 0x33, 0xe4, 0x27, 0x20, 0x80, 0x08, 0x33, 0xe4,
+    0x23, 0x94, 0x80, 0x08, 0x00, 0x85, 0x3a, 0x5d, 0x80, 0x09, 0x64, 0x69, 0x80, 0x11, 0x33, 0xe4,
+    0x36, 0x06, 0x80, 0x08, 0x6c, 0x10, 0x00, 0x08, 0x63, 0x80, 0x00, 0x40, 0x00, 0x81, 0x3a, 0x5d,
+    0x80, 0x09, 0x32, 0xe4, 0x39, 0xf6, 0x80, 0x01, 0x20, 0x00, 0x83, 0xe8, 0x33, 0xc4, 0x27, 0xf8,
+    0x80, 0x08, 0x33, 0x84, 0x35, 0x74, 0x80, 0x08, 0x00, 0x85, 0x3a, 0x5c, 0x80, 0x09, 0x64, 0x69,
+    0x81, 0xb3, 0x33, 0xe4, 0x3a, 0x38, 0x80, 0x01, 0x27, 0x64, 0x95, 0x30, 0x90, 0xc0, 0x90, 0xc0,
+    0x90, 0xc8, 0x32, 0x64, 0x36, 0x10, 0x80, 0x08, 0xc0, 0x81, 0x38, 0xc8, 0x24, 0x00, 0xbf, 0xff,
+    0x23, 0xc4, 0x83, 0x50, 0x2b, 0x03, 0x80, 0x08, 0xc0, 0x82, 0x40, 0x90, 0x38, 0xc8, 0x24, 0x00,
+    0xbf, 0xff, 0x90, 0xc0, 0x50, 0x90, 0x0c, 0x00, 0xa0, 0x07, 0x2d, 0xff, 0x9d, 0x6f, 0x90, 0xc0,
+    0x90, 0xd0, 0x90, 0xc0, 0x90, 0xc0, 0x8d, 0x63, 0x33, 0xe4, 0x20, 0x10, 0x80, 0x08, 0x39, 0x08,
+    0x29, 0x14, 0xbf, 0xf8, 0x10, 0xe0, 0x9e, 0xd0, 0x00, 0x91, 0x3a, 0x08, 0x00, 0x08, 0x64, 0x00,
+    0x00, 0x40, 0x29, 0x34, 0xbf, 0xf8, 0x10, 0xe0, 0x9e, 0xd4, 0x00, 0x92, 0x39, 0x08, 0x29, 0x54,
+    0xbf, 0xf8, 0x10, 0xe0, 0x9e, 0xd8, 0x00, 0x91, 0x3a, 0x08, 0x29, 0x74, 0xbf, 0xf8, 0x10, 0xe0,
+    0x9e, 0xdc, 0x9f, 0x70, 0x40, 0x92, 0xca, 0x40, 0xc8, 0xba, 0x39, 0xc8, 0x38, 0x00, 0xbf, 0xff,
+    0xea, 0x38, 0xca, 0x49, 0xc0, 0x81, 0x32, 0xc9, 0x87, 0xc1, 0xd4, 0x11, 0x00, 0x91, 0xc0, 0x81,
+    0x9f, 0x70, 0x00, 0x81, 0x3a, 0x5d, 0x80, 0x09, 0xcb, 0x40, 0xc8, 0xba, 0x39, 0xc8, 0x38, 0x00,
+    0xbf, 0xff, 0xeb, 0x38, 0xcb, 0x49, 0x32, 0xc9, 0x87, 0xc1, 0xc0, 0x81, 0x3a, 0x00, 0x20, 0x42,
+    0x80, 0x08, 0xd4, 0x11, 0x00, 0x91, 0x39, 0xc8, 0x3c, 0x00, 0xbf, 0xff, 0x11, 0xd2, 0x38, 0x00,
+    0x20, 0x44, 0x80, 0x08, 0x38, 0xc1, 0xc0, 0x81, 0x41, 0x12, 0x51, 0x91, 0x41, 0x90, 0x9f, 0x70,
+    0x00, 0x81, 0x00, 0x08, 0x64, 0x80, 0x00, 0x40, 0x3a, 0x5c, 0x80, 0x09, 0x31, 0x24, 0x3f, 0x30,
+    0x80, 0x09, 0x2c, 0x90, 0x3b, 0xa0, 0x26, 0x80, 0x80, 0x09, 0x27, 0x04, 0x80, 0x40, 0x38, 0xa0,
+    0x27, 0x80, 0x80, 0x09, 0x39, 0xa0, 0x27, 0x00, 0x80, 0x09, 0x3a, 0xa0, 0x28, 0x00, 0x80, 0x09,
+    0x94, 0xd0, 0x41, 0x19, 0x41, 0x18, 0x01, 0x1a, 0x41, 0x1b, 0x2c, 0x90, 0x3b, 0xa0, 0x31, 0x30,
+    0x80, 0x09, 0x27, 0x04, 0x80, 0x60, 0x38, 0xa0, 0x30, 0x70, 0x80, 0x09, 0x39, 0xa0, 0x2f, 0xb0,
+    0x80, 0x09, 0x3a, 0xa0, 0x2e, 0xf0, 0x80, 0x09, 0x94, 0xd0, 0x41, 0x19, 0x41, 0x18, 0x01, 0x1a,
+    0x41, 0x1b, 0x24, 0x69, 0x30, 0xa1, 0x27, 0x80, 0x80, 0x09, 0x31, 0xa1, 0x27, 0x00, 0x80, 0x09,
+    0x33, 0xa1, 0x26, 0x80, 0x80, 0x09, 0x32, 0xa1, 0x28, 0x00, 0x80, 0x09, 0x00, 0xa2, 0x28, 0x80,
+    0x80, 0x09, 0x01, 0xa2, 0x28, 0xb4, 0x80, 0x09, 0x00, 0x08, 0x65, 0x00, 0x00, 0x40, 0x01, 0xa2,
+    0x28, 0xb0, 0x80, 0x09, 0x00, 0xa2, 0x28, 0x84, 0x80, 0x09, 0x03, 0xa2, 0x28, 0x90, 0x80, 0x09,
+    0x03, 0xa2, 0x28, 0x94, 0x80, 0x09, 0x02, 0xa2, 0x28, 0xa0, 0x80, 0x09, 0x80, 0x12, 0x02, 0xa2,
+    0x28, 0xa4, 0x80, 0x09, 0xc0, 0x81, 0x88, 0x10, 0x31, 0x41, 0x39, 0x84, 0x80, 0x09, 0x2c, 0x10,
+    0x31, 0x41, 0x39, 0x04, 0x80, 0x09, 0x01, 0xa2, 0x28, 0x98, 0x80, 0x09, 0x01, 0xa2, 0x28, 0x88,
+    0x80, 0x09, 0x01, 0xa2, 0x28, 0xb8, 0x80, 0x09, 0x01, 0xa2, 0x28, 0xa8, 0x80, 0x09, 0x00, 0xa0,
+    0x28, 0x9c, 0x80, 0x09, 0x00, 0xa0, 0x28, 0x8c, 0x80, 0x09, 0x00, 0xa0, 0x28, 0xbc, 0x80, 0x09,
+    0x9f, 0x70, 0x00, 0xa0, 0x28, 0xac, 0x80, 0x09, 0x2b, 0xff, 0x9f, 0x1b, 0x2c, 0x90, 0x3b, 0xa0,
+    0x2d, 0x70, 0x80, 0x09, 0x27, 0x04, 0x80, 0x60, 0x38, 0xa0, 0x2a, 0x70, 0x80, 0x09, 0x00, 0x08,
+    0x65, 0x80, 0x00, 0x40, 0x39, 0xa0, 0x2b, 0xf0, 0x80, 0x09, 0x3a, 0xa0, 0x28, 0xf0, 0x80, 0x09,
+    0x94, 0xd0, 0x41, 0x19, 0x41, 0x18, 0x01, 0x1a, 0x41, 0x1b, 0x64, 0x69, 0x84, 0x07, 0x20, 0x00,
+    0x81, 0x4d, 0x38, 0xc8, 0x30, 0x00, 0xbf, 0xff, 0x90, 0xc0, 0x11, 0x90, 0x38, 0xc8, 0x30, 0x08,
+    0xbf, 0xff, 0x0c, 0x01, 0xa0, 0x01, 0x80, 0x37, 0x12, 0x90, 0xc1, 0x83, 0x35, 0x1a, 0x8f, 0xff,
+    0x30, 0xfa, 0x3a, 0xc8, 0x30, 0x00, 0xbf, 0xff, 0x84, 0x25, 0x29, 0x20, 0x80, 0x00, 0x38, 0xc8,
+    0x30, 0x08, 0xbf, 0xff, 0xe9, 0x61, 0xe9, 0xf1, 0x80, 0x15, 0x52, 0x92, 0x0c, 0x02, 0xa0, 0x01,
+    0x80, 0x0d, 0x52, 0x90, 0x35, 0x1a, 0x8f, 0xff, 0x70, 0xfa, 0x81, 0xeb, 0x39, 0xc8, 0x30, 0x00,
+    0xbf, 0xff, 0x38, 0xc8, 0x34, 0x00, 0xbf, 0xff, 0xc1, 0x82, 0x41, 0x91, 0x12, 0x90, 0x38, 0xc8,
+    0x34, 0x08, 0xbf, 0xff, 0x00, 0x08, 0x66, 0x00, 0x00, 0x40, 0x0c, 0x02, 0xa0, 0x01, 0x80, 0x37,
+    0x13, 0x90, 0xc2, 0x83, 0x37, 0x1b, 0x8f, 0xff, 0x31, 0x7b, 0x3a, 0xc8, 0x34, 0x00, 0xbf, 0xff,
+    0x84, 0x25, 0x29, 0x20, 0x80, 0x00, 0x38, 0xc8, 0x34, 0x08, 0xbf, 0xff, 0xe9, 0x61, 0xe9, 0xf1,
+    0x80, 0x15, 0x53, 0x92, 0x0c, 0x03, 0xa0, 0x01, 0x80, 0x0d, 0x53, 0x90, 0x37, 0x1b, 0x8f, 0xff,
+    0x71, 0x7b, 0x81, 0xeb, 0x2d, 0x90, 0x38, 0xc8, 0x34, 0x00, 0xbf, 0xff, 0x31, 0x1c, 0x80, 0xff,
+    0x01, 0x90, 0xc2, 0x81, 0x01, 0xa4, 0x31, 0xf6, 0x80, 0x09, 0x34, 0x11, 0x80, 0x30, 0xd5, 0x44,
+    0xc4, 0x90, 0x80, 0x1e, 0x03, 0xa1, 0x31, 0xfc, 0x80, 0x09, 0xd0, 0xb8, 0x80, 0x15, 0xd0, 0xb0,
+    0x80, 0x11, 0x25, 0x60, 0xc3, 0x81, 0x25, 0x6e, 0xc4, 0xa0, 0x03, 0xa1, 0x31, 0xfc, 0x80, 0x09,
+    0xc8, 0x42, 0x21, 0xe0, 0x9f, 0x00, 0xe8, 0x61, 0x34, 0x53, 0x00, 0x08, 0x66, 0x80, 0x00, 0x40,
+    0xdc, 0x80, 0xc8, 0x4e, 0x2a, 0xff, 0x9e, 0x07, 0xd7, 0x41, 0x3c, 0xc8, 0x80, 0x49, 0x01, 0xa4,
+    0x31, 0xf6, 0x80, 0x09, 0x3c, 0xe3, 0x00, 0xa1, 0x32, 0x01, 0x80, 0x09, 0x3c, 0xc8, 0x80, 0x4b,
+    0x00, 0xa1, 0x31, 0xfe, 0x80, 0x09, 0xd8, 0x11, 0x3c, 0xca, 0x80, 0x48, 0x34, 0x00, 0x80, 0x04,
+    0x0d, 0x26, 0xa0, 0x00, 0xc9, 0x40, 0x02, 0xa1, 0x31, 0xff, 0x80, 0x09, 0x3c, 0xca, 0x80, 0x4a,
+    0x09, 0xa0, 0x31, 0xfa, 0x80, 0x09, 0x80, 0x12, 0x02, 0xa1, 0x31, 0xfd, 0x80, 0x09, 0xe9, 0xf8,
+    0xe9, 0xfc, 0x09, 0xa0, 0x31, 0xfa, 0x80, 0x09, 0x3c, 0xc8, 0x80, 0x88, 0xe9, 0xf8, 0xd0, 0x23,
+    0xe9, 0xfc, 0x84, 0x08, 0xc9, 0x48, 0x74, 0x78, 0x7c, 0x41, 0x2d, 0x10, 0x2c, 0x90, 0x38, 0x80,
+    0x3a, 0x68, 0x80, 0x09, 0x02, 0x82, 0x3a, 0x60, 0x80, 0x09, 0x32, 0xea, 0x80, 0x5f, 0x02, 0x82,
+    0x00, 0x08, 0x67, 0x00, 0x00, 0x40, 0x3a, 0x60, 0x80, 0x09, 0x32, 0xea, 0x80, 0x5e, 0xc1, 0x81,
+    0x02, 0x82, 0x3a, 0x60, 0x80, 0x09, 0x32, 0xea, 0x80, 0x5d, 0x33, 0x81, 0x3a, 0x80, 0x80, 0x09,
+    0x02, 0x82, 0x3a, 0x60, 0x80, 0x09, 0x30, 0xea, 0x83, 0x10, 0x03, 0x82, 0x3a, 0x64, 0x80, 0x09,
+    0x2d, 0x90, 0x02, 0x82, 0x3a, 0x60, 0x80, 0x09, 0x32, 0xea, 0x80, 0x4f, 0x02, 0x82, 0x3a, 0x60,
+    0x80, 0x09, 0x03, 0x82, 0x3a, 0x68, 0x80, 0x09, 0x12, 0x90, 0x33, 0xa1, 0x20, 0x80, 0x80, 0x09,
+    0x32, 0xea, 0x80, 0x5f, 0x02, 0x90, 0xc9, 0x4a, 0x54, 0x90, 0x32, 0xec, 0x80, 0x5e, 0x44, 0x90,
+    0x54, 0x90, 0x32, 0xec, 0x80, 0x5d, 0x44, 0x90, 0x54, 0x90, 0x30, 0xec, 0x83, 0x10, 0x44, 0x90,
+    0x50, 0x90, 0x32, 0xe8, 0x80, 0x4f, 0x40, 0x90, 0x3c, 0xc8, 0x80, 0x8a, 0xd0, 0x23, 0x84, 0x0c,
+    0x03, 0x82, 0x3a, 0x6c, 0x80, 0x09, 0x00, 0x08, 0x67, 0x80, 0x00, 0x40, 0x75, 0x7a, 0x7d, 0x41,
+    0x2d, 0x90, 0x3a, 0x80, 0x3a, 0x78, 0x80, 0x09, 0x2c, 0x10, 0x03, 0x82, 0x3a, 0x70, 0x80, 0x09,
+    0x30, 0xeb, 0x80, 0x5f, 0x03, 0x82, 0x3a, 0x70, 0x80, 0x09, 0x30, 0xeb, 0x80, 0x5e, 0x03, 0x82,
+    0x3a, 0x70, 0x80, 0x09, 0x32, 0xeb, 0x80, 0x5d, 0x03, 0x82, 0x3a, 0x70, 0x80, 0x09, 0x34, 0xeb,
+    0x83, 0x10, 0x03, 0x82, 0x3a, 0x70, 0x80, 0x09, 0x32, 0xeb, 0x80, 0x4f, 0x03, 0x82, 0x3a, 0x70,
+    0x80, 0x09, 0x33, 0xa1, 0x23, 0x80, 0x80, 0x09, 0x03, 0x82, 0x3a, 0x74, 0x80, 0x09, 0x00, 0x82,
+    0x3a, 0x78, 0x80, 0x09, 0x10, 0x92, 0x33, 0x81, 0x3d, 0x80, 0x80, 0x09, 0x32, 0xe8, 0x80, 0x5f,
+    0x00, 0x92, 0x38, 0xc8, 0x38, 0x20, 0xbf, 0xff, 0x14, 0x92, 0xc0, 0xaa, 0x32, 0xec, 0x80, 0x5e,
+    0x04, 0x92, 0x39, 0x60, 0x28, 0x8e, 0x80, 0x08, 0x54, 0x92, 0x32, 0xec, 0x00, 0x08, 0x68, 0x00,
+    0x00, 0x40, 0x80, 0x5d, 0x44, 0x92, 0x54, 0x92, 0x34, 0xec, 0x83, 0x10, 0x44, 0x92, 0x52, 0x92,
+    0x32, 0xea, 0x80, 0x4f, 0x42, 0x92, 0x03, 0x82, 0x3a, 0x7c, 0x80, 0x09, 0x31, 0x01, 0x20, 0x00,
+    0x80, 0x30, 0x32, 0xe4, 0x3a, 0x5c, 0x80, 0x01, 0x41, 0x90, 0xc1, 0x84, 0x32, 0xe4, 0x3a, 0x62,
+    0x80, 0x01, 0xc0, 0xaa, 0xc0, 0xac, 0x32, 0xe4, 0x3a, 0x5c, 0x80, 0x01, 0x39, 0x60, 0x28, 0x8e,
+    0x80, 0x08, 0xc1, 0x84, 0x32, 0xe4, 0x3a, 0x62, 0x80, 0x01, 0xc0, 0xac, 0x9f, 0x7d, 0x38, 0xe8,
+    0x3c, 0x2c, 0xbf, 0xff, 0x0c, 0x06, 0xa3, 0x00, 0x80, 0x14, 0x06, 0x90, 0x30, 0x80, 0x3a, 0x60,
+    0x80, 0x09, 0x09, 0x00, 0xa0, 0x01, 0x00, 0xa2, 0x28, 0xd8, 0x80, 0x09, 0x0c, 0x06, 0xac, 0x00,
+    0x80, 0x13, 0x30, 0x80, 0x3a, 0x70, 0x80, 0x09, 0x09, 0x00, 0xa0, 0x01, 0x00, 0xa2, 0x28, 0xe0,
+    0x80, 0x09, 0x00, 0x08, 0x68, 0x80, 0x00, 0x40, 0x9f, 0x7c, 0x31, 0x24, 0x3f, 0x50, 0x80, 0x09,
+    0x31, 0x64, 0x3a, 0xd8, 0x80, 0x08, 0x2b, 0xff, 0x9b, 0xf7, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09,
+    0x34, 0x10, 0x80, 0x2a, 0x10, 0x00, 0x80, 0xb2, 0x38, 0xa8, 0x3c, 0x20, 0xbf, 0xff, 0x31, 0x1e,
+    0x80, 0x07, 0xe7, 0x48, 0x26, 0x18, 0x81, 0xf6, 0x3e, 0xe8, 0x3c, 0x2c, 0xbf, 0xff, 0x11, 0x90,
+    0xc0, 0xaa, 0x32, 0xe4, 0x3a, 0x68, 0x80, 0x01, 0x01, 0xc2, 0x3e, 0x04, 0x80, 0x09, 0x08, 0xc6,
+    0x3e, 0x10, 0x80, 0x09, 0x0a, 0xc6, 0x3e, 0x04, 0x80, 0x09, 0x09, 0x86, 0x3a, 0x54, 0x80, 0x09,
+    0xea, 0x38, 0xba, 0x4a, 0x0a, 0x86, 0x3a, 0x54, 0x80, 0x09, 0x38, 0xc8, 0x30, 0x04, 0xbf, 0xff,
+    0x10, 0x92, 0x80, 0x30, 0x38, 0x41, 0x39, 0x80, 0x3a, 0x60, 0x80, 0x09, 0x00, 0x02, 0x80, 0x30,
+    0x50, 0x96, 0x58, 0x90, 0x31, 0x18, 0x8f, 0x00, 0x00, 0x08, 0x69, 0x00, 0x00, 0x40, 0xe9, 0xa8,
+    0xdc, 0x28, 0x80, 0x10, 0x96, 0xc2, 0x38, 0xa0, 0x20, 0x80, 0x80, 0x09, 0x38, 0x80, 0x3a, 0x80,
+    0x80, 0x09, 0x31, 0x18, 0x80, 0x03, 0xc9, 0x40, 0xca, 0x82, 0xe9, 0x61, 0xe9, 0x8a, 0x25, 0x18,
+    0x81, 0x08, 0x3a, 0xa0, 0x28, 0xc0, 0x80, 0x09, 0x01, 0xa7, 0x31, 0xfa, 0x80, 0x09, 0xa9, 0xd1,
+    0x24, 0xea, 0x00, 0xa7, 0x31, 0xfa, 0x80, 0x09, 0x99, 0x61, 0x84, 0xed, 0x2b, 0x03, 0x80, 0x12,
+    0x9b, 0x41, 0x39, 0xa0, 0x2d, 0x70, 0x80, 0x09, 0x00, 0xa6, 0x28, 0xdc, 0x80, 0x09, 0x51, 0x18,
+    0x30, 0xca, 0x95, 0x0c, 0x6d, 0x38, 0xd4, 0x42, 0x30, 0xca, 0x95, 0x0c, 0x2c, 0xb8, 0x00, 0xa2,
+    0x28, 0xdc, 0x80, 0x09, 0xd4, 0x96, 0x64, 0xe1, 0x7c, 0xc8, 0x64, 0xe5, 0x92, 0xd0, 0x7c, 0xc8,
+    0x74, 0xd9, 0x41, 0x59, 0x88, 0xb3, 0x01, 0xa7, 0x31, 0xfa, 0x80, 0x09, 0x24, 0xea, 0x00, 0x08,
+    0x69, 0x80, 0x00, 0x40, 0x39, 0xa0, 0x2a, 0x70, 0x80, 0x09, 0x84, 0xa3, 0x2b, 0x03, 0x80, 0x0c,
+    0x9b, 0x41, 0x00, 0xa6, 0x28, 0xe4, 0x80, 0x09, 0x51, 0x18, 0x30, 0xca, 0x95, 0x0c, 0x6d, 0x38,
+    0xd4, 0x42, 0x30, 0xca, 0x95, 0x0c, 0x2c, 0xb8, 0x00, 0xa2, 0x28, 0xe4, 0x80, 0x09, 0xd4, 0x96,
+    0x64, 0xe1, 0x7c, 0xc8, 0x64, 0xe5, 0x92, 0xd0, 0x7c, 0xc8, 0x74, 0xd9, 0x41, 0x59, 0x88, 0x6f,
+    0x24, 0x6a, 0x3a, 0xa0, 0x2d, 0x70, 0x80, 0x09, 0x84, 0x65, 0x9b, 0x40, 0x2b, 0x03, 0x80, 0x10,
+    0x39, 0xa0, 0x2a, 0x70, 0x80, 0x09, 0x00, 0xa6, 0x28, 0xdc, 0x80, 0x09, 0x11, 0x18, 0x03, 0xa6,
+    0x28, 0xe4, 0x80, 0x09, 0x36, 0xcc, 0x95, 0x0c, 0x2e, 0x24, 0x52, 0x18, 0xd5, 0xc4, 0x03, 0xa2,
+    0x28, 0xe4, 0x80, 0x09, 0x36, 0xcb, 0x95, 0x0c, 0x6c, 0xb9, 0xd4, 0x96, 0x64, 0xe1, 0x7c, 0xc8,
+    0x64, 0xe5, 0x30, 0xcb, 0x00, 0x08, 0x6a, 0x00, 0x00, 0x40, 0x95, 0x0c, 0x3c, 0xc8, 0x6d, 0xbd,
+    0x34, 0xd9, 0xd4, 0x43, 0x01, 0x59, 0x00, 0xa2, 0x28, 0xdc, 0x80, 0x09, 0x30, 0xc9, 0x95, 0x0c,
+    0x6c, 0x98, 0xd4, 0x96, 0x64, 0xe1, 0x7c, 0xc8, 0x64, 0xe5, 0x92, 0xd0, 0x7c, 0xc8, 0x74, 0xd9,
+    0x41, 0x5a, 0x00, 0xa5, 0x31, 0xff, 0x80, 0x09, 0x34, 0x60, 0x01, 0xa4, 0x28, 0x9c, 0x80, 0x09,
+    0x24, 0x69, 0x38, 0xc1, 0x06, 0xa7, 0x31, 0xfa, 0x80, 0x09, 0x80, 0x22, 0xd7, 0x19, 0x30, 0xa1,
+    0x28, 0x90, 0x80, 0x09, 0xf6, 0x03, 0xf0, 0x41, 0x18, 0x04, 0xa0, 0x01, 0x39, 0xa0, 0x31, 0x30,
+    0x80, 0x09, 0x2a, 0xff, 0x9e, 0x31, 0x38, 0xa0, 0x2d, 0x70, 0x80, 0x09, 0x00, 0xa5, 0x32, 0x01,
+    0x80, 0x09, 0x34, 0x60, 0x39, 0xa0, 0x30, 0x70, 0x80, 0x09, 0x24, 0x69, 0x30, 0xa1, 0x28, 0x80,
+    0x80, 0x09, 0x80, 0x15, 0xf6, 0x03, 0xf0, 0x41, 0x18, 0x04, 0x00, 0x08, 0x6a, 0x80, 0x00, 0x40,
+    0xa0, 0x01, 0x2a, 0xff, 0x9e, 0x07, 0x38, 0xa0, 0x2a, 0x70, 0x80, 0x09, 0x00, 0xc5, 0x3e, 0x58,
+    0x80, 0x09, 0x74, 0x60, 0xd0, 0x23, 0x27, 0x18, 0x81, 0xea, 0x33, 0x84, 0x33, 0x06, 0x80, 0x08,
+    0x89, 0xe1, 0x1a, 0x90, 0x08, 0xc6, 0x3e, 0x10, 0x80, 0x09, 0x09, 0x86, 0x3a, 0x54, 0x80, 0x09,
+    0x0a, 0xc2, 0x3e, 0x08, 0x80, 0x09, 0xea, 0x38, 0xba, 0x4b, 0x08, 0x86, 0x3a, 0x54, 0x80, 0x09,
+    0xc0, 0xac, 0x11, 0x90, 0x80, 0x32, 0x78, 0xc1, 0x32, 0xe4, 0x3a, 0x68, 0x80, 0x01, 0x01, 0x00,
+    0x80, 0x32, 0x10, 0x96, 0x38, 0xc8, 0x34, 0x04, 0xbf, 0xff, 0x31, 0x18, 0x8f, 0x00, 0x1a, 0x90,
+    0x38, 0x80, 0x3a, 0x70, 0x80, 0x09, 0xdc, 0x2a, 0xe8, 0xaa, 0xc9, 0x40, 0x80, 0x10, 0x96, 0xc2,
+    0x38, 0x80, 0x3d, 0x80, 0x80, 0x09, 0x38, 0xa0, 0x23, 0x80, 0x80, 0x09, 0xca, 0x82, 0xe9, 0x61,
+    0x00, 0x08, 0x6b, 0x00, 0x00, 0x40, 0xe9, 0x8a, 0x25, 0x18, 0x81, 0x08, 0x3a, 0xa0, 0x28, 0xcc,
+    0x80, 0x09, 0x01, 0xa7, 0x31, 0xfa, 0x80, 0x09, 0xa9, 0xd1, 0x24, 0xea, 0x00, 0xa7, 0x31, 0xfa,
+    0x80, 0x09, 0x99, 0x61, 0x84, 0xed, 0x2b, 0x03, 0x80, 0x12, 0x9b, 0x41, 0x39, 0xa0, 0x2b, 0xf0,
+    0x80, 0x09, 0x00, 0xa6, 0x28, 0xec, 0x80, 0x09, 0x51, 0x18, 0x30, 0xca, 0x95, 0x0c, 0x6d, 0x38,
+    0xd4, 0x42, 0x30, 0xca, 0x95, 0x0c, 0x2c, 0xb8, 0x00, 0xa2, 0x28, 0xec, 0x80, 0x09, 0xd4, 0x96,
+    0x64, 0xe1, 0x7c, 0xc8, 0x64, 0xe5, 0x92, 0xd0, 0x7c, 0xc8, 0x74, 0xd9, 0x41, 0x59, 0x88, 0xb3,
+    0x01, 0xa7, 0x31, 0xfa, 0x80, 0x09, 0x24, 0xea, 0x39, 0xa0, 0x28, 0xf0, 0x80, 0x09, 0x84, 0xa3,
+    0x2b, 0x03, 0x80, 0x0c, 0x9b, 0x41, 0x00, 0xa6, 0x28, 0xe8, 0x80, 0x09, 0x51, 0x18, 0x30, 0xca,
+    0x95, 0x0c, 0x6d, 0x38, 0xd4, 0x42, 0x00, 0x08, 0x6b, 0x80, 0x00, 0x40, 0x30, 0xca, 0x95, 0x0c,
+    0x2c, 0xb8, 0x00, 0xa2, 0x28, 0xe8, 0x80, 0x09, 0xd4, 0x96, 0x64, 0xe1, 0x7c, 0xc8, 0x64, 0xe5,
+    0x92, 0xd0, 0x7c, 0xc8, 0x74, 0xd9, 0x41, 0x59, 0x88, 0x6f, 0x24, 0x6a, 0x3a, 0xa0, 0x2b, 0xf0,
+    0x80, 0x09, 0x84, 0x65, 0x9b, 0x40, 0x2b, 0x03, 0x80, 0x10, 0x39, 0xa0, 0x28, 0xf0, 0x80, 0x09,
+    0x00, 0xa6, 0x28, 0xec, 0x80, 0x09, 0x11, 0x18, 0x03, 0xa6, 0x28, 0xe8, 0x80, 0x09, 0x36, 0xcc,
+    0x95, 0x0c, 0x2e, 0x24, 0x52, 0x18, 0xd5, 0xc4, 0x03, 0xa2, 0x28, 0xe8, 0x80, 0x09, 0x36, 0xcb,
+    0x95, 0x0c, 0x6c, 0xb9, 0xd4, 0x96, 0x64, 0xe1, 0x7c, 0xc8, 0x64, 0xe5, 0x30, 0xcb, 0x95, 0x0c,
+    0x3c, 0xc8, 0x6d, 0xbd, 0x34, 0xd9, 0xd4, 0x43, 0x01, 0x59, 0x00, 0xa2, 0x28, 0xec, 0x80, 0x09,
+    0x30, 0xc9, 0x95, 0x0c, 0x6c, 0x98, 0xd4, 0x96, 0x64, 0xe1, 0x7c, 0xc8, 0x00, 0x08, 0x6c, 0x00,
+    0x00, 0x40, 0x64, 0xe5, 0x92, 0xd0, 0x7c, 0xc8, 0x74, 0xd9, 0x41, 0x5a, 0x00, 0xa5, 0x31, 0xfd,
+    0x80, 0x09, 0x34, 0x60, 0x01, 0xa4, 0x28, 0xbc, 0x80, 0x09, 0x24, 0x69, 0x38, 0xc1, 0x06, 0xa7,
+    0x31, 0xfa, 0x80, 0x09, 0x80, 0x22, 0xd7, 0x19, 0x30, 0xa1, 0x28, 0xb0, 0x80, 0x09, 0xf6, 0x03,
+    0xf0, 0x41, 0x18, 0x04, 0xa0, 0x01, 0x39, 0xa0, 0x2f, 0xb0, 0x80, 0x09, 0x2a, 0xff, 0x9c, 0x4f,
+    0x38, 0xa0, 0x2b, 0xf0, 0x80, 0x09, 0x00, 0xa5, 0x31, 0xfe, 0x80, 0x09, 0x34, 0x60, 0x39, 0xa0,
+    0x2e, 0xf0, 0x80, 0x09, 0x24, 0x69, 0x30, 0xa1, 0x28, 0xa0, 0x80, 0x09, 0x80, 0x15, 0xf6, 0x03,
+    0xf0, 0x41, 0x18, 0x04, 0xa0, 0x01, 0x2a, 0xff, 0x9c, 0x25, 0x38, 0xa0, 0x28, 0xf0, 0x80, 0x09,
+    0x00, 0xc5, 0x3e, 0x58, 0x80, 0x09, 0x74, 0x60, 0xd0, 0x24, 0x84, 0x09, 0x33, 0x84, 0x33, 0x06,
+    0x80, 0x08, 0x00, 0x08, 0x6c, 0x80, 0x00, 0x40, 0x30, 0x24, 0x3f, 0x50, 0x80, 0x09, 0xe7, 0x68,
+    0x01, 0x04, 0x3a, 0x34, 0x80, 0x0a, 0x34, 0x11, 0x80, 0x30, 0xe7, 0x48, 0x80, 0x1e, 0xf0, 0x04,
+    0x34, 0x11, 0x80, 0x60, 0x80, 0x0f, 0x34, 0x11, 0x80, 0x20, 0x84, 0x1f, 0x74, 0x40, 0x88, 0x16,
+    0xd8, 0x10, 0x74, 0x40, 0xd8, 0x10, 0x00, 0xfe, 0x9f, 0xf8, 0x21, 0x21, 0x8a, 0xaa, 0x00, 0xfc,
+    0x9f, 0xf8, 0x64, 0x31, 0x00, 0xfe, 0x9f, 0xf8, 0xf1, 0x84, 0x30, 0x81, 0x29, 0x37, 0x80, 0x00,
+    0xd9, 0x11, 0x34, 0x43, 0x80, 0x00, 0xd8, 0x1b, 0x22, 0x00, 0x80, 0x41, 0x28, 0x18, 0xe7, 0x68,
+    0x7c, 0x4d, 0x36, 0xc9, 0x83, 0x43, 0x64, 0x61, 0x9f, 0x70, 0xd4, 0x41, 0x35, 0x50, 0x24, 0x60,
+    0x31, 0x11, 0x20, 0x00, 0x80, 0x00, 0x30, 0xe0, 0x25, 0x66, 0xc9, 0x41, 0x92, 0xc2, 0x6d, 0x10,
+    0x0c, 0x52, 0xa0, 0x00, 0x80, 0x0b, 0xc8, 0x42, 0x00, 0x08, 0x6d, 0x00, 0x00, 0x40, 0x90, 0xc0,
+    0xe9, 0x38, 0xc9, 0x4a, 0x31, 0x08, 0x20, 0x00, 0x80, 0x00, 0x70, 0xe2, 0x84, 0x09, 0x32, 0xe0,
+    0x3f, 0xff, 0xbf, 0xff, 0x24, 0x61, 0x09, 0x66, 0x3f, 0xb8, 0x80, 0x04, 0x34, 0xc9, 0x92, 0x96,
+    0x3c, 0xc1, 0x64, 0x68, 0xc8, 0x41, 0x31, 0xe1, 0x3f, 0xff, 0x80, 0x3f, 0xe9, 0x18, 0x10, 0x11,
+    0x09, 0x66, 0x3f, 0xbc, 0x80, 0x04, 0xdc, 0x82, 0xd8, 0x10, 0x24, 0x61, 0xe8, 0x19, 0x32, 0xc9,
+    0x86, 0x47, 0x12, 0x50, 0xd8, 0x91, 0x60, 0x18, 0x92, 0xc3, 0x64, 0x64, 0x74, 0x48, 0x9f, 0x70,
+    0xd8, 0x18, 0x31, 0x84, 0x35, 0x7c, 0x80, 0x08, 0x33, 0x24, 0x3f, 0x30, 0x80, 0x09, 0x39, 0xc8,
+    0x24, 0x00, 0xbf, 0xff, 0xee, 0xe8, 0x10, 0x91, 0xe7, 0x48, 0x0c, 0x00, 0xa0, 0x07, 0x80, 0x27,
+    0x38, 0xc8, 0x24, 0x00, 0xbf, 0xff, 0x23, 0xc4, 0x83, 0x50, 0x2b, 0x03, 0x80, 0x08, 0x00, 0x08,
+    0x6d, 0x80, 0x00, 0x40, 0xc0, 0x82, 0x40, 0x90, 0x50, 0x90, 0x0c, 0x00, 0xa0, 0x07, 0x84, 0x07,
+    0x20, 0x03, 0x80, 0x0a, 0x90, 0xd0, 0x90, 0xc0, 0x90, 0xc0, 0x10, 0x96, 0x08, 0x86, 0x3a, 0x58,
+    0x80, 0x09, 0x00, 0xa2, 0x35, 0xa4, 0x80, 0x09, 0x10, 0x90, 0x80, 0x10, 0x31, 0x18, 0x80, 0xff,
+    0x3c, 0x42, 0x39, 0xc0, 0x3e, 0x5c, 0x80, 0x09, 0xca, 0x40, 0x90, 0xc0, 0xea, 0x19, 0x50, 0x92,
+    0x00, 0xa2, 0x35, 0x80, 0x80, 0x09, 0x10, 0x90, 0x80, 0x10, 0x30, 0xc8, 0x82, 0x08, 0xca, 0x40,
+    0x90, 0xc0, 0xa0, 0xca, 0x00, 0xa2, 0x35, 0x84, 0x80, 0x09, 0x10, 0x90, 0x80, 0x38, 0x31, 0x18,
+    0x80, 0xff, 0x83, 0x76, 0x74, 0x60, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x00, 0xa0, 0x35, 0x88,
+    0x80, 0x09, 0x10, 0x90, 0x80, 0x38, 0x30, 0xc8, 0x82, 0x08, 0x83, 0x5e, 0x74, 0x60, 0x08, 0x86,
+    0x3a, 0x58, 0x80, 0x09, 0x00, 0x08, 0x6e, 0x00, 0x00, 0x40, 0x00, 0xa0, 0x35, 0x8a, 0x80, 0x09,
+    0x10, 0x90, 0x80, 0x12, 0x31, 0x18, 0x80, 0xff, 0x3c, 0x42, 0x39, 0xc0, 0x3e, 0x5c, 0x80, 0x09,
+    0xca, 0x40, 0x90, 0xc0, 0xea, 0x19, 0x50, 0x92, 0x00, 0xa2, 0x35, 0x8c, 0x80, 0x09, 0x10, 0x90,
+    0x80, 0x12, 0x30, 0xc8, 0x82, 0x08, 0xca, 0x40, 0x90, 0xc0, 0xa0, 0xca, 0x00, 0xa2, 0x35, 0x90,
+    0x80, 0x09, 0x10, 0x90, 0x80, 0x3a, 0x31, 0x18, 0x80, 0xff, 0x2a, 0xff, 0x9f, 0x15, 0x74, 0x60,
+    0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x00, 0xa0, 0x35, 0x94, 0x80, 0x09, 0x10, 0x90, 0x80, 0x3a,
+    0x30, 0xc8, 0x82, 0x08, 0x2a, 0xff, 0x9e, 0xfb, 0x74, 0x60, 0x2d, 0x90, 0x31, 0xa1, 0x35, 0x80,
+    0x80, 0x09, 0x27, 0x04, 0x80, 0x60, 0x32, 0xa1, 0x35, 0x8c, 0x80, 0x09, 0x39, 0xa0, 0x32, 0x18,
+    0x80, 0x09, 0x38, 0xa0, 0x33, 0x98, 0x80, 0x09, 0x01, 0xa2, 0x00, 0x08, 0x6e, 0x80, 0x00, 0x40,
+    0x35, 0x9c, 0x80, 0x09, 0x00, 0xa0, 0x35, 0x96, 0x80, 0x09, 0x02, 0xa2, 0x35, 0xa0, 0x80, 0x09,
+    0x94, 0xc8, 0x43, 0x98, 0x43, 0x99, 0x08, 0xa6, 0x35, 0xa4, 0x80, 0x09, 0x30, 0x01, 0x26, 0x05,
+    0x80, 0x20, 0xe8, 0xf1, 0x84, 0x09, 0x00, 0xa2, 0x35, 0xa4, 0x80, 0x09, 0x00, 0xa6, 0x35, 0xa4,
+    0x80, 0x09, 0x31, 0x19, 0x83, 0x00, 0x31, 0x0a, 0x80, 0x30, 0x30, 0x01, 0x20, 0x00, 0x80, 0x30,
+    0x30, 0x62, 0xdc, 0xa8, 0x92, 0xc3, 0x6c, 0x10, 0x92, 0xc2, 0xc0, 0x81, 0xd0, 0xa2, 0x80, 0x10,
+    0x00, 0xa1, 0x37, 0xb7, 0x80, 0x09, 0xd0, 0xa1, 0x84, 0x0d, 0x88, 0x0c, 0xc8, 0xa0, 0x88, 0x08,
+    0x28, 0x00, 0x80, 0x60, 0xc8, 0x90, 0x24, 0x69, 0x08, 0xa0, 0x37, 0xb0, 0x80, 0x09, 0xe8, 0xf8,
+    0xe8, 0xfc, 0x80, 0x08, 0xc8, 0x49, 0x74, 0xf9, 0x7c, 0xc1, 0x2c, 0x10, 0x2d, 0x90, 0x2e, 0x10,
+    0x00, 0x08, 0x6f, 0x00, 0x00, 0x40, 0xc2, 0x81, 0x00, 0xa2, 0x32, 0x08, 0x80, 0x09, 0x36, 0xe8,
+    0x80, 0x5f, 0x00, 0xa2, 0x32, 0x08, 0x80, 0x09, 0x36, 0xe8, 0x80, 0x5e, 0x00, 0xa2, 0x32, 0x08,
+    0x80, 0x09, 0x34, 0xe8, 0x80, 0x5d, 0x00, 0xa2, 0x32, 0x08, 0x80, 0x09, 0x32, 0xe8, 0x83, 0x10,
+    0x00, 0xa2, 0x32, 0x08, 0x80, 0x09, 0x33, 0xa1, 0x32, 0x18, 0x80, 0x09, 0x38, 0xe8, 0x80, 0x4f,
+    0x03, 0xa2, 0x32, 0x0c, 0x80, 0x09, 0x2d, 0x90, 0x00, 0xa2, 0x32, 0x08, 0x80, 0x09, 0x30, 0xa1,
+    0x32, 0x10, 0x80, 0x09, 0x2d, 0x90, 0x03, 0xa2, 0x32, 0x10, 0x80, 0x09, 0xc8, 0x40, 0xc0, 0xae,
+    0x15, 0x90, 0x34, 0xa1, 0x33, 0x98, 0x80, 0x09, 0x34, 0xed, 0x80, 0x5f, 0x45, 0x90, 0x55, 0x90,
+    0x34, 0xed, 0x80, 0x5e, 0x45, 0x90, 0x55, 0x90, 0x34, 0xed, 0x80, 0x5d, 0x45, 0x90, 0x52, 0x90,
+    0x32, 0xea, 0x83, 0x10, 0x42, 0x90, 0x00, 0x08, 0x6f, 0x80, 0x00, 0x40, 0x51, 0x90, 0x36, 0xe9,
+    0x80, 0x4f, 0x41, 0x90, 0x32, 0xe4, 0x3a, 0x68, 0x80, 0x01, 0x04, 0xa2, 0x32, 0x14, 0x80, 0x09,
+    0xc0, 0xae, 0x32, 0xe4, 0x3a, 0x5c, 0x80, 0x01, 0x39, 0x60, 0x32, 0x5e, 0x80, 0x08, 0xc1, 0x84,
+    0x32, 0xe4, 0x3a, 0x62, 0x80, 0x01, 0xc0, 0xae, 0x9f, 0x7d, 0x38, 0xc8, 0x24, 0x18, 0xbf, 0xff,
+    0x31, 0xf9, 0x3f, 0xff, 0xbf, 0xef, 0x50, 0x90, 0x0d, 0x10, 0xa0, 0x10, 0x80, 0x0f, 0x00, 0xa6,
+    0x35, 0xa4, 0x80, 0x09, 0xdc, 0x80, 0x88, 0x0c, 0x41, 0x90, 0x00, 0xa6, 0x35, 0xa4, 0x80, 0x09,
+    0x40, 0x90, 0x38, 0xc8, 0x24, 0x18, 0xbf, 0xff, 0x31, 0xf9, 0x3f, 0xff, 0xbf, 0xdf, 0x10, 0x90,
+    0x38, 0xc8, 0x24, 0x18, 0xbf, 0xff, 0x0d, 0x10, 0xa0, 0x20, 0x80, 0x0f, 0x00, 0xa6, 0x35, 0xa4,
+    0x80, 0x09, 0xdc, 0x80, 0x88, 0x12, 0x41, 0x90, 0x38, 0xc8, 0x24, 0x18, 0x00, 0x08, 0x70, 0x00,
+    0x00, 0x40, 0xbf, 0xff, 0x00, 0xa6, 0x35, 0xa4, 0x80, 0x09, 0x40, 0x90, 0x2c, 0x90, 0x38, 0xc8,
+    0x24, 0x1c, 0xbf, 0xff, 0xb2, 0xf1, 0x02, 0x90, 0xc0, 0xb0, 0xf0, 0x41, 0x32, 0xe4, 0x3c, 0x8a,
+    0x80, 0x01, 0x38, 0xa0, 0x35, 0x18, 0x80, 0x09, 0x38, 0xc8, 0x24, 0x1c, 0xbf, 0xff, 0x31, 0xa0,
+    0x32, 0x08, 0x80, 0x09, 0x10, 0x90, 0xe9, 0xe8, 0x31, 0x18, 0x8f, 0x00, 0xdc, 0x28, 0x00, 0xa0,
+    0x35, 0x1c, 0x80, 0x09, 0x00, 0xa0, 0x35, 0x1a, 0x80, 0x09, 0x50, 0x90, 0x31, 0xf8, 0x90, 0x00,
+    0xdc, 0x2c, 0x00, 0xa0, 0x35, 0x28, 0x80, 0x09, 0x00, 0xa0, 0x35, 0x26, 0x80, 0x09, 0x10, 0x90,
+    0x38, 0xe8, 0x3c, 0x30, 0xbf, 0xff, 0x31, 0x08, 0x80, 0x0f, 0xd8, 0x08, 0x00, 0xa0, 0x35, 0x34,
+    0x80, 0x09, 0x00, 0xa0, 0x35, 0x32, 0x80, 0x09, 0x50, 0x91, 0x31, 0x08, 0x80, 0xf0, 0xdc, 0x34,
+    0x00, 0xa0, 0x00, 0x08, 0x70, 0x80, 0x00, 0x40, 0x35, 0x40, 0x80, 0x09, 0x00, 0xa0, 0x35, 0x3e,
+    0x80, 0x09, 0x30, 0x09, 0x20, 0xff, 0x9f, 0x55, 0x40, 0x90, 0x00, 0xa6, 0x35, 0xa4, 0x80, 0x09,
+    0x0c, 0x10, 0xa0, 0x30, 0x80, 0x15, 0xc0, 0x83, 0x09, 0x01, 0xa0, 0x01, 0x01, 0xa2, 0x35, 0x98,
+    0x80, 0x09, 0x00, 0xa1, 0x37, 0xb5, 0x80, 0x09, 0x9f, 0x7c, 0x00, 0xa7, 0x37, 0xb0, 0x80, 0x09,
+    0x32, 0xe4, 0x3c, 0x48, 0x80, 0x01, 0x01, 0x04, 0x38, 0x6e, 0x80, 0x0a, 0x37, 0x70, 0x37, 0xd0,
+    0x2c, 0x90, 0x39, 0xa0, 0x37, 0x6c, 0x80, 0x09, 0xd3, 0x21, 0x80, 0x7d, 0xf7, 0x02, 0xf1, 0x42,
+    0x18, 0x01, 0xa0, 0x20, 0x32, 0x64, 0x37, 0x08, 0x80, 0x08, 0x38, 0xa0, 0x35, 0x64, 0x80, 0x09,
+    0x2c, 0x10, 0xf7, 0x02, 0xf0, 0x42, 0x18, 0x01, 0xa0, 0x20, 0x39, 0xa0, 0x37, 0x2c, 0x80, 0x09,
+    0x32, 0x64, 0x37, 0x08, 0x80, 0x08, 0x38, 0xa0, 0x00, 0x08, 0x71, 0x00, 0x00, 0x40, 0x35, 0x48,
+    0x80, 0x09, 0x2c, 0x10, 0xd3, 0x26, 0x84, 0x21, 0x31, 0x41, 0x36, 0xc4, 0x80, 0x09, 0x01, 0xa2,
+    0x35, 0x6c, 0x80, 0x09, 0x01, 0xa2, 0x35, 0x50, 0x80, 0x09, 0x00, 0xa0, 0x35, 0x7e, 0x80, 0x09,
+    0x00, 0xa0, 0x35, 0x62, 0x80, 0x09, 0x2c, 0x10, 0xd3, 0x23, 0x84, 0x31, 0x31, 0x41, 0x38, 0x44,
+    0x80, 0x09, 0x01, 0xa2, 0x35, 0x6c, 0x80, 0x09, 0x01, 0xa2, 0x35, 0x50, 0x80, 0x09, 0x00, 0xa0,
+    0x35, 0x7e, 0x80, 0x09, 0x88, 0x16, 0x00, 0xa0, 0x35, 0x62, 0x80, 0x09, 0xc0, 0x81, 0x00, 0xa0,
+    0x35, 0x76, 0x80, 0x09, 0x00, 0xa0, 0x35, 0x5a, 0x80, 0x09, 0x2c, 0x90, 0xc0, 0x81, 0x01, 0xa1,
+    0x37, 0xb4, 0x80, 0x09, 0x00, 0xa1, 0x37, 0xb6, 0x80, 0x09, 0xe7, 0x68, 0x30, 0x24, 0x3f, 0x50,
+    0x80, 0x09, 0x01, 0xa0, 0x37, 0xb2, 0x80, 0x09, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x00, 0x08,
+    0x71, 0x80, 0x00, 0x40, 0x90, 0xc0, 0x10, 0x90, 0x80, 0x38, 0x31, 0x18, 0x80, 0xff, 0x2a, 0xff,
+    0x9b, 0xcb, 0x74, 0x60, 0x08, 0xa6, 0x35, 0x9c, 0x80, 0x09, 0x90, 0xc0, 0xb0, 0x04, 0x08, 0x86,
+    0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0, 0x10, 0x90, 0x80, 0x38, 0x30, 0xc8, 0x82, 0x08, 0x2a, 0xff,
+    0x9b, 0xab, 0x74, 0x60, 0x08, 0xa6, 0x35, 0x9c, 0x80, 0x09, 0x90, 0xc0, 0xb0, 0x05, 0x08, 0x86,
+    0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0, 0x10, 0x90, 0x80, 0x3a, 0x31, 0x18, 0x80, 0xff, 0x2a, 0xff,
+    0x9b, 0x8b, 0x74, 0x60, 0x08, 0xa6, 0x35, 0xa0, 0x80, 0x09, 0x90, 0xc0, 0xb0, 0x04, 0x08, 0x86,
+    0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0, 0x10, 0x90, 0x80, 0x3a, 0x30, 0xc8, 0x82, 0x08, 0x2a, 0xff,
+    0x9b, 0x6b, 0x74, 0x60, 0x09, 0xa6, 0x35, 0xa0, 0x80, 0x09, 0x9f, 0x70, 0xb0, 0x0d, 0x00, 0xa5,
+    0x37, 0xb4, 0x80, 0x09, 0x00, 0x08, 0x72, 0x00, 0x00, 0x40, 0x64, 0x69, 0x80, 0x2b, 0x01, 0xa4,
+    0x37, 0xb2, 0x80, 0x09, 0x00, 0xa4, 0x37, 0xae, 0x80, 0x09, 0x6c, 0x11, 0x00, 0xa0, 0x37, 0xb2,
+    0x80, 0x09, 0x00, 0xa4, 0x37, 0xb2, 0x80, 0x09, 0x24, 0x68, 0x6c, 0x10, 0x80, 0x3b, 0x88, 0x32,
+    0x00, 0xa0, 0x37, 0xb2, 0x80, 0x09, 0x01, 0xa4, 0x37, 0xae, 0x80, 0x09, 0x00, 0xa4, 0x37, 0xb2,
+    0x80, 0x09, 0x6c, 0x51, 0x00, 0xa0, 0x37, 0xb2, 0x80, 0x09, 0x00, 0xa4, 0x37, 0xb2, 0x80, 0x09,
+    0x64, 0x68, 0x80, 0x15, 0x20, 0x60, 0x9f, 0xff, 0x2c, 0x10, 0x00, 0xa0, 0x37, 0xb2, 0x80, 0x09,
+    0x00, 0xa1, 0x37, 0xb6, 0x80, 0x09, 0x9f, 0x71, 0x33, 0x24, 0x3f, 0x30, 0x80, 0x09, 0x38, 0xa8,
+    0x3c, 0x20, 0xbf, 0xff, 0xe7, 0x50, 0x10, 0x90, 0x3e, 0xa0, 0x36, 0x6c, 0x80, 0x09, 0x00, 0xc2,
+    0x3e, 0x2c, 0x80, 0x09, 0xc0, 0xae, 0x32, 0xe4, 0x3a, 0x68, 0x00, 0x08, 0x72, 0x80, 0x00, 0x40,
+    0x80, 0x01, 0x3f, 0xa0, 0x35, 0xac, 0x80, 0x09, 0x08, 0xc6, 0x3e, 0x10, 0x80, 0x09, 0x0a, 0xc6,
+    0x3e, 0x2c, 0x80, 0x09, 0x09, 0x86, 0x3a, 0x54, 0x80, 0x09, 0xea, 0x38, 0xba, 0x4c, 0x08, 0x86,
+    0x3a, 0x54, 0x80, 0x09, 0x90, 0xc0, 0x10, 0x90, 0x80, 0x34, 0x78, 0x41, 0x00, 0x00, 0x80, 0x34,
+    0x00, 0xc5, 0x3e, 0x58, 0x80, 0x09, 0x74, 0x60, 0xd0, 0x22, 0x84, 0x09, 0x33, 0x84, 0x33, 0x06,
+    0x80, 0x08, 0x2b, 0xff, 0x9e, 0xb9, 0x38, 0xc8, 0x3c, 0x14, 0xbf, 0xff, 0x3b, 0x80, 0x34, 0x1c,
+    0x80, 0x09, 0x10, 0x90, 0x38, 0x80, 0x38, 0x9c, 0x80, 0x09, 0x2c, 0x10, 0x0c, 0x10, 0xa1, 0x00,
+    0x80, 0x1d, 0x27, 0x04, 0x80, 0x60, 0x39, 0x80, 0x36, 0x5c, 0x80, 0x09, 0x3a, 0x80, 0x34, 0xdc,
+    0x80, 0x09, 0x94, 0xd0, 0x40, 0x19, 0x40, 0x18, 0x00, 0x1a, 0x40, 0x1b, 0x08, 0xa6, 0x35, 0x9c,
+    0x00, 0x08, 0x73, 0x00, 0x00, 0x40, 0x80, 0x09, 0x02, 0x04, 0x38, 0x6e, 0x80, 0x0a, 0x19, 0x90,
+    0xf2, 0x06, 0xb1, 0x85, 0xb3, 0x84, 0xb0, 0xc1, 0xf1, 0x05, 0xf0, 0x42, 0xf3, 0x01, 0x18, 0x07,
+    0xa0, 0x01, 0x32, 0xe4, 0x20, 0x3c, 0x80, 0x08, 0x38, 0xa0, 0x36, 0x6c, 0x80, 0x09, 0x08, 0xa6,
+    0x35, 0xa0, 0x80, 0x09, 0x02, 0x04, 0x38, 0x6e, 0x80, 0x0a, 0x19, 0x90, 0xf2, 0x06, 0xb1, 0x85,
+    0xb3, 0x84, 0xb0, 0xc1, 0xf1, 0x05, 0xf0, 0x42, 0xf3, 0x01, 0x18, 0x07, 0xa0, 0x01, 0x32, 0xe4,
+    0x20, 0x3c, 0x80, 0x08, 0x38, 0xa0, 0x35, 0xac, 0x80, 0x09, 0x33, 0x04, 0x3a, 0x9a, 0x80, 0x09,
+    0x33, 0x04, 0x3a, 0xa6, 0x80, 0x09, 0x00, 0xa6, 0x35, 0xa4, 0x80, 0x09, 0x0c, 0x10, 0xa0, 0x10,
+    0x80, 0x35, 0x00, 0xa4, 0x35, 0x76, 0x80, 0x09, 0xd0, 0x21, 0x80, 0x2b, 0x00, 0x04, 0x38, 0x6e,
+    0x80, 0x0a, 0xf0, 0x01, 0x31, 0xc1, 0x00, 0x08, 0x73, 0x80, 0x00, 0x40, 0x34, 0xe8, 0x80, 0x09,
+    0x39, 0xa0, 0x36, 0x6c, 0x80, 0x09, 0x38, 0xa0, 0x35, 0x64, 0x80, 0x09, 0x32, 0x64, 0x3a, 0x12,
+    0x80, 0x08, 0x01, 0xa2, 0x35, 0x70, 0x80, 0x09, 0xee, 0xe8, 0x00, 0xa6, 0x35, 0xa4, 0x80, 0x09,
+    0x0c, 0x10, 0xa0, 0x20, 0x80, 0x35, 0x00, 0xa4, 0x35, 0x5a, 0x80, 0x09, 0xd0, 0x21, 0x80, 0x2b,
+    0x00, 0x04, 0x38, 0x6e, 0x80, 0x0a, 0xf0, 0x01, 0x31, 0xa1, 0x36, 0x6c, 0x80, 0x09, 0x39, 0xa0,
+    0x35, 0xac, 0x80, 0x09, 0x38, 0xa0, 0x35, 0x48, 0x80, 0x09, 0x32, 0x64, 0x3a, 0x12, 0x80, 0x08,
+    0x01, 0xa2, 0x35, 0x54, 0x80, 0x09, 0xef, 0xe8, 0x39, 0xc8, 0x24, 0x04, 0xbf, 0xff, 0x38, 0xa0,
+    0x32, 0x08, 0x80, 0x09, 0x59, 0x91, 0x90, 0xc0, 0xe8, 0xa9, 0x80, 0x10, 0x96, 0xc2, 0x39, 0xa0,
+    0x33, 0x98, 0x80, 0x09, 0x39, 0xa0, 0x32, 0x18, 0x80, 0x09, 0x2e, 0x10, 0x00, 0x08, 0x74, 0x00,
+    0x00, 0x40, 0x00, 0xa5, 0x37, 0xb6, 0x80, 0x09, 0x24, 0x69, 0x36, 0xd4, 0xc3, 0x81, 0x25, 0x18,
+    0x81, 0x5c, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0xc0, 0x87, 0x11, 0x00, 0x80, 0xa4, 0x2d, 0x7c,
+    0x02, 0xa7, 0x37, 0xb0, 0x80, 0x09, 0x76, 0x55, 0x6c, 0x7d, 0xd5, 0x94, 0x36, 0x60, 0x80, 0x02,
+    0x00, 0xa2, 0x35, 0xa8, 0x80, 0x09, 0x00, 0xa6, 0x35, 0xa8, 0x80, 0x09, 0x36, 0x70, 0x9f, 0xfe,
+    0x84, 0x07, 0x88, 0x1a, 0xc0, 0x81, 0x30, 0x81, 0x20, 0x00, 0x80, 0x00, 0x32, 0xe4, 0x3c, 0x48,
+    0x80, 0x01, 0x34, 0x78, 0x01, 0xa6, 0x35, 0xa8, 0x80, 0x09, 0x65, 0x60, 0x00, 0xa0, 0x37, 0xae,
+    0x80, 0x09, 0x00, 0xa5, 0x37, 0xb7, 0x80, 0x09, 0x24, 0x69, 0x00, 0xa6, 0x35, 0xa4, 0x80, 0x09,
+    0x80, 0x73, 0x25, 0x6a, 0x00, 0xa4, 0x35, 0x36, 0x80, 0x09, 0x27, 0x18, 0x81, 0x90, 0x04, 0xa4,
+    0x35, 0x42, 0x00, 0x08, 0x74, 0x80, 0x00, 0x40, 0x80, 0x09, 0x2c, 0x7c, 0x01, 0xa4, 0x35, 0x1e,
+    0x80, 0x09, 0x05, 0xa4, 0x35, 0x2a, 0x80, 0x09, 0x6d, 0x7c, 0x13, 0x1f, 0x00, 0xa4, 0x37, 0xb2,
+    0x80, 0x09, 0xd5, 0x9c, 0x34, 0x61, 0x80, 0x00, 0x30, 0x61, 0x80, 0x00, 0x36, 0x60, 0x80, 0x00,
+    0xd8, 0x91, 0xd4, 0xc0, 0x32, 0xc8, 0x94, 0x4f, 0x00, 0x19, 0x00, 0xa4, 0x37, 0xb2, 0x80, 0x09,
+    0x53, 0x1e, 0xd5, 0x9d, 0x34, 0x61, 0x80, 0x00, 0x30, 0x61, 0x80, 0x00, 0x36, 0x60, 0x80, 0x00,
+    0xd8, 0x91, 0xd4, 0xc0, 0x32, 0xc8, 0x94, 0x4f, 0x2a, 0xff, 0x9d, 0x2b, 0x40, 0x19, 0x65, 0x61,
+    0x79, 0x61, 0x65, 0x6a, 0x81, 0xb7, 0x89, 0x2b, 0x0c, 0x10, 0xa0, 0x10, 0x80, 0x45, 0x25, 0x6a,
+    0x00, 0xa4, 0x35, 0x1e, 0x80, 0x09, 0x27, 0x18, 0x81, 0x1a, 0x04, 0xa4, 0x35, 0x2a, 0x80, 0x09,
+    0x6c, 0x7c, 0x13, 0x1e, 0x00, 0xa4, 0x37, 0xb2, 0x00, 0x08, 0x75, 0x00, 0x00, 0x40, 0x80, 0x09,
+    0xd5, 0x9c, 0x34, 0x61, 0x80, 0x00, 0x30, 0x61, 0x80, 0x00, 0x36, 0x60, 0x80, 0x00, 0xd8, 0x91,
+    0xd4, 0xc0, 0x32, 0xc8, 0x94, 0x4f, 0x2a, 0xff, 0x9c, 0xe3, 0x40, 0x19, 0x65, 0x61, 0x79, 0x61,
+    0x65, 0x6a, 0x81, 0xd7, 0x88, 0xe3, 0x25, 0x6a, 0x00, 0xa4, 0x35, 0x36, 0x80, 0x09, 0x84, 0xd9,
+    0x04, 0xa4, 0x35, 0x42, 0x80, 0x09, 0x6c, 0x7c, 0x13, 0x1f, 0x00, 0xa4, 0x37, 0xb2, 0x80, 0x09,
+    0xd5, 0x9c, 0x34, 0x61, 0x80, 0x00, 0x30, 0x61, 0x80, 0x00, 0x36, 0x60, 0x80, 0x00, 0xd8, 0x91,
+    0xd4, 0xc0, 0x32, 0xc8, 0x94, 0x4f, 0x2a, 0xff, 0x9c, 0xa3, 0x40, 0x19, 0x65, 0x61, 0x79, 0x61,
+    0x65, 0x6a, 0x81, 0xd7, 0x88, 0xa3, 0x00, 0xa5, 0x37, 0xb7, 0x80, 0x09, 0x24, 0x69, 0x01, 0xa7,
+    0x37, 0xb0, 0x80, 0x09, 0x80, 0x39, 0x24, 0xea, 0x00, 0xa4, 0x35, 0x36, 0x80, 0x09, 0x00, 0x08,
+    0x75, 0x80, 0x00, 0x40, 0x84, 0x89, 0x9b, 0x41, 0x2b, 0x03, 0x80, 0x1a, 0x04, 0xa4, 0x35, 0x42,
+    0x80, 0x09, 0x2c, 0x7c, 0x01, 0xa4, 0x35, 0x1e, 0x80, 0x09, 0x05, 0xa4, 0x35, 0x2a, 0x80, 0x09,
+    0x6d, 0x7c, 0x50, 0x1f, 0xd4, 0x1c, 0x40, 0x19, 0x92, 0xd0, 0x50, 0x1e, 0xd4, 0x1d, 0x40, 0x19,
+    0x88, 0x5d, 0x00, 0xa6, 0x35, 0xa4, 0x80, 0x09, 0x0c, 0x10, 0xa0, 0x10, 0x80, 0x2b, 0x01, 0xa7,
+    0x37, 0xb0, 0x80, 0x09, 0x24, 0xea, 0x00, 0xa4, 0x35, 0x1e, 0x80, 0x09, 0x84, 0x41, 0x2b, 0x03,
+    0x80, 0x0e, 0x9b, 0x41, 0x04, 0xa4, 0x35, 0x2a, 0x80, 0x09, 0x6c, 0x7c, 0x92, 0xd0, 0x50, 0x1e,
+    0xd4, 0x1c, 0x40, 0x19, 0x88, 0x29, 0x01, 0xa7, 0x37, 0xb0, 0x80, 0x09, 0x24, 0xea, 0x00, 0xa4,
+    0x35, 0x36, 0x80, 0x09, 0x84, 0x19, 0x2b, 0x03, 0x80, 0x0e, 0x9b, 0x41, 0x04, 0xa4, 0x35, 0x42,
+    0x80, 0x09, 0x6c, 0x7c, 0x00, 0x08, 0x76, 0x00, 0x00, 0x40, 0x92, 0xd0, 0x50, 0x1f, 0xd4, 0x1c,
+    0x40, 0x19, 0x30, 0x24, 0x3f, 0x50, 0x80, 0x09, 0xe7, 0x70, 0x01, 0xa7, 0x37, 0xac, 0x80, 0x09,
+    0x24, 0xe9, 0x6c, 0x90, 0x80, 0x53, 0x00, 0xa1, 0x37, 0xb4, 0x80, 0x09, 0xc0, 0x81, 0x00, 0xa1,
+    0x37, 0xb6, 0x80, 0x09, 0x20, 0x00, 0x83, 0xe8, 0x32, 0xe4, 0x39, 0xf6, 0x80, 0x01, 0x01, 0xa0,
+    0x37, 0xac, 0x80, 0x09, 0x00, 0xa5, 0x37, 0xb6, 0x80, 0x09, 0xd0, 0x21, 0x84, 0x21, 0x38, 0xc8,
+    0x3c, 0x0c, 0xbf, 0xff, 0x20, 0x00, 0x80, 0x64, 0x51, 0x90, 0x33, 0xf9, 0x9f, 0xff, 0x70, 0x79,
+    0x80, 0x0d, 0x01, 0xa5, 0x37, 0xb6, 0x80, 0x09, 0xd0, 0xa1, 0x81, 0xef, 0x32, 0xe4, 0x39, 0xf6,
+    0x80, 0x01, 0x20, 0x00, 0x83, 0xe8, 0x9f, 0x71, 0x31, 0x24, 0x3f, 0x30, 0x80, 0x09, 0x09, 0x90,
+    0xf1, 0x85, 0x24, 0xea, 0xc0, 0xa0, 0xb9, 0x41, 0x01, 0x00, 0x00, 0x08, 0x76, 0x80, 0x00, 0x40,
+    0x80, 0x10, 0x84, 0x10, 0x00, 0x00, 0x80, 0x16, 0x9f, 0x41, 0x6c, 0x90, 0x90, 0xc0, 0x92, 0xc8,
+    0x41, 0x19, 0xf1, 0xc4, 0x64, 0xe9, 0x84, 0x09, 0x31, 0xc1, 0x34, 0xe8, 0x80, 0x09, 0x23, 0x04,
+    0x80, 0x60, 0x2b, 0x03, 0x80, 0x0a, 0xb1, 0x43, 0x2d, 0x10, 0x6c, 0x90, 0x39, 0x42, 0xc9, 0x42,
+    0xba, 0xc3, 0x90, 0xd0, 0xea, 0x19, 0x41, 0x12, 0xf2, 0x86, 0xd1, 0x21, 0x80, 0x42, 0x02, 0x00,
+    0x80, 0x12, 0xd1, 0x23, 0x80, 0x17, 0xd1, 0x26, 0x84, 0x23, 0x00, 0x66, 0x3f, 0xa0, 0x80, 0x04,
+    0xb0, 0x42, 0x20, 0x00, 0x80, 0xc0, 0x88, 0x28, 0xc1, 0x82, 0x00, 0x66, 0x3f, 0xa4, 0x80, 0x04,
+    0xb0, 0x42, 0x20, 0x00, 0x80, 0x60, 0x88, 0x18, 0xc1, 0x81, 0xc0, 0x82, 0x00, 0x00, 0x80, 0x12,
+    0x00, 0x66, 0x3f, 0xa8, 0x80, 0x04, 0xb0, 0x42, 0x20, 0x00, 0x80, 0x40, 0xc1, 0x81, 0x01, 0x00,
+    0x00, 0x08, 0x77, 0x00, 0x00, 0x40, 0x80, 0x14, 0x9f, 0x70, 0x00, 0x00, 0x80, 0x18, 0x09, 0x90,
+    0xf1, 0x85, 0x24, 0xea, 0xc0, 0xa0, 0xb9, 0x41, 0x01, 0x00, 0x80, 0x10, 0x84, 0x10, 0x00, 0x00,
+    0x80, 0x16, 0x9f, 0x41, 0x6c, 0x90, 0x90, 0xc0, 0x92, 0xc8, 0x41, 0x19, 0xf1, 0xc4, 0x64, 0xe9,
+    0x84, 0x09, 0x31, 0xc1, 0x34, 0xe8, 0x80, 0x09, 0x23, 0x04, 0x80, 0x60, 0x2b, 0x03, 0x80, 0x0a,
+    0xb1, 0x43, 0x2d, 0x10, 0x6c, 0x90, 0x39, 0x42, 0xc9, 0x42, 0xba, 0xc3, 0x90, 0xd0, 0xea, 0x19,
+    0x41, 0x12, 0xf2, 0x86, 0xd1, 0x21, 0x80, 0x46, 0x02, 0x00, 0x80, 0x12, 0xd1, 0x23, 0x80, 0x23,
+    0xd1, 0x26, 0x84, 0x41, 0x02, 0x66, 0x3f, 0xa0, 0x80, 0x04, 0xc0, 0x82, 0x21, 0x40, 0x80, 0x00,
+    0x00, 0x00, 0x80, 0x14, 0xb2, 0x42, 0x20, 0x00, 0x80, 0xc0, 0x88, 0x46, 0x01, 0x00, 0x80, 0x1a,
+    0x02, 0x66, 0x3f, 0xa4, 0x80, 0x04, 0x00, 0x08, 0x77, 0x80, 0x00, 0x40, 0xc0, 0x81, 0x21, 0x40,
+    0x80, 0x00, 0x00, 0x00, 0x80, 0x14, 0xb2, 0x42, 0x20, 0x00, 0x80, 0x60, 0x88, 0x2a, 0x01, 0x00,
+    0x80, 0x1a, 0x88, 0x24, 0x01, 0x00, 0x80, 0x14, 0x2c, 0x90, 0xc0, 0x82, 0x00, 0x00, 0x80, 0x12,
+    0x02, 0x66, 0x3f, 0xa8, 0x80, 0x04, 0xc0, 0x81, 0x00, 0x00, 0x80, 0x14, 0xb2, 0x42, 0x20, 0x00,
+    0x80, 0x40, 0x01, 0x00, 0x80, 0x1a, 0x9f, 0x70, 0x00, 0x00, 0x80, 0x18, 0x00, 0x04, 0x38, 0x6e,
+    0x80, 0x0a, 0x36, 0x10, 0x80, 0x20, 0x84, 0xc6, 0xe7, 0x48, 0x34, 0x10, 0x80, 0x40, 0x80, 0x08,
+    0x92, 0xc2, 0xc3, 0x82, 0xc3, 0x83, 0x30, 0x01, 0x20, 0xd8, 0x80, 0x0a, 0xf0, 0x42, 0xf3, 0x02,
+    0x18, 0x01, 0xa0, 0xc0, 0x39, 0xc0, 0x2a, 0x00, 0x80, 0x09, 0x2a, 0xff, 0x9e, 0x87, 0x38, 0xc0,
+    0x33, 0x04, 0x80, 0x09, 0x30, 0xe1, 0x3d, 0xd8, 0x80, 0x09, 0xf0, 0x42, 0x00, 0x08, 0x78, 0x00,
+    0x00, 0x40, 0xf3, 0x02, 0x18, 0x01, 0xa0, 0xc0, 0x39, 0xc0, 0x2e, 0x00, 0x80, 0x09, 0x2a, 0xff,
+    0x9e, 0x69, 0x38, 0xc0, 0x32, 0x94, 0x80, 0x09, 0x30, 0x01, 0x20, 0x18, 0x80, 0x0a, 0xf0, 0x42,
+    0xf3, 0x02, 0x18, 0x01, 0xa0, 0xc0, 0x39, 0xc0, 0x26, 0x00, 0x80, 0x09, 0x2a, 0xff, 0x9e, 0x4b,
+    0x38, 0xc0, 0x32, 0x40, 0x80, 0x09, 0x30, 0xe1, 0x3e, 0x98, 0x80, 0x09, 0xf0, 0x42, 0xf3, 0x02,
+    0x18, 0x01, 0xa0, 0xc0, 0x39, 0xa0, 0x3e, 0x00, 0x80, 0x09, 0x2a, 0xff, 0x9e, 0x2d, 0x38, 0xc0,
+    0x34, 0x00, 0x80, 0x09, 0x30, 0x01, 0x23, 0xd8, 0x80, 0x0a, 0xf0, 0x42, 0xf3, 0x02, 0x18, 0x01,
+    0xa0, 0x20, 0x39, 0xc0, 0x30, 0x80, 0x80, 0x09, 0x2a, 0xff, 0x9e, 0xa3, 0x38, 0xc0, 0x33, 0xc8,
+    0x80, 0x09, 0x30, 0x01, 0x21, 0x98, 0x80, 0x0a, 0xf0, 0x42, 0xf3, 0x02, 0x18, 0x01, 0xa0, 0x20,
+    0x39, 0xc0, 0x00, 0x08, 0x78, 0x80, 0x00, 0x40, 0x31, 0xc0, 0x80, 0x09, 0x2a, 0xff, 0x9e, 0x85,
+    0x38, 0xc0, 0x33, 0x74, 0x80, 0x09, 0x88, 0x29, 0xc0, 0x81, 0x00, 0xc0, 0x33, 0xda, 0x80, 0x09,
+    0x00, 0xc0, 0x33, 0x86, 0x80, 0x09, 0x00, 0xc0, 0x33, 0x16, 0x80, 0x09, 0x00, 0xc0, 0x32, 0xa6,
+    0x80, 0x09, 0x00, 0xc0, 0x32, 0x52, 0x80, 0x09, 0x00, 0xc0, 0x34, 0x12, 0x80, 0x09, 0xe7, 0x68,
+    0x9f, 0x71, 0x2b, 0xff, 0x9d, 0xb5, 0x37, 0xd1, 0xd0, 0x28, 0xe7, 0x48, 0x80, 0x08, 0x92, 0xc2,
+    0xc3, 0x82, 0xc3, 0x81, 0x26, 0x00, 0x80, 0xc0, 0xc4, 0x84, 0xc5, 0xa0, 0x3b, 0xc0, 0x32, 0x20,
+    0x80, 0x09, 0x3c, 0xc0, 0x34, 0xd8, 0x80, 0x09, 0x3d, 0xc0, 0x32, 0x00, 0x80, 0x09, 0x3e, 0xc0,
+    0x34, 0xa8, 0x80, 0x09, 0x2c, 0x10, 0x19, 0x9d, 0xf3, 0x02, 0x18, 0x9e, 0xf0, 0x42, 0x2a, 0xff,
+    0x9e, 0x13, 0xf5, 0x01, 0x2c, 0x10, 0x18, 0x9c, 0x00, 0x08, 0x79, 0x00, 0x00, 0x40, 0x59, 0x9b,
+    0xf0, 0x42, 0xf3, 0x02, 0x2a, 0xff, 0x9d, 0x6f, 0xf6, 0x01, 0x7a, 0x61, 0x66, 0x6a, 0x81, 0xdd,
+    0xd3, 0xa8, 0x80, 0x08, 0x92, 0xc2, 0xc3, 0x82, 0xc3, 0x81, 0x26, 0x00, 0x80, 0xc0, 0xc4, 0x84,
+    0xc5, 0xa0, 0x3b, 0xc0, 0x32, 0x30, 0x80, 0x09, 0x3c, 0xc0, 0x32, 0x10, 0x80, 0x09, 0x3d, 0xc0,
+    0x34, 0xb8, 0x80, 0x09, 0x3e, 0xc0, 0x34, 0xc8, 0x80, 0x09, 0x2c, 0x10, 0x19, 0x9c, 0xf3, 0x02,
+    0x18, 0x9e, 0xf0, 0x42, 0x2a, 0xff, 0x9d, 0xc3, 0xf5, 0x01, 0x2c, 0x10, 0x18, 0x9d, 0x59, 0x9b,
+    0xf0, 0x42, 0xf3, 0x02, 0x2a, 0xff, 0x9d, 0x1f, 0xf6, 0x01, 0x7a, 0x61, 0x66, 0x6a, 0x81, 0xdd,
+    0x30, 0x24, 0x3f, 0x50, 0x80, 0x09, 0xe7, 0x68, 0x36, 0x00, 0xa1, 0x00, 0xf1, 0x85, 0xef, 0xe8,
+    0x97, 0x30, 0x94, 0xc0, 0x9c, 0x22, 0x95, 0x30, 0x1c, 0x98, 0x10, 0x05, 0xa0, 0x04, 0x00, 0x08,
+    0x79, 0x80, 0x00, 0x40, 0x34, 0x20, 0xa0, 0x00, 0x5c, 0x98, 0x38, 0x20, 0xa0, 0x00, 0x58, 0x98,
+    0x28, 0x03, 0x80, 0x40, 0x34, 0x20, 0xa0, 0x00, 0x5e, 0x98, 0x36, 0x40, 0xa1, 0x00, 0x50, 0x18,
+    0xea, 0xec, 0x14, 0x18, 0x6c, 0x50, 0x15, 0x18, 0xcc, 0x50, 0x94, 0xc0, 0x98, 0x41, 0x50, 0x18,
+    0x34, 0x20, 0xa0, 0x00, 0x51, 0x18, 0x36, 0x20, 0xa0, 0x08, 0x50, 0x18, 0x64, 0xed, 0x3a, 0x40,
+    0xa0, 0x00, 0x37, 0x03, 0x28, 0x00, 0x80, 0x08, 0xe8, 0xee, 0x9d, 0x44, 0x34, 0x20, 0xa0, 0x00,
+    0xeb, 0xe8, 0x90, 0xc0, 0x92, 0xd0, 0x50, 0x59, 0x90, 0x3c, 0x2c, 0x10, 0xea, 0xec, 0x34, 0x20,
+    0xa0, 0x00, 0x9d, 0x41, 0x90, 0xc0, 0x12, 0x5a, 0x53, 0x5b, 0x96, 0xc8, 0x60, 0x1d, 0x52, 0x5a,
+    0x53, 0x5b, 0x64, 0x1d, 0x92, 0xd0, 0xd4, 0x1d, 0x74, 0x58, 0x94, 0xc0, 0x90, 0x28, 0x6c, 0x10,
+    0x94, 0xc0, 0x9c, 0x23, 0x00, 0x08, 0x7a, 0x00, 0x00, 0x40, 0x95, 0x31, 0x90, 0xc0, 0x90, 0xc0,
+    0x97, 0x31, 0x9f, 0x70, 0x36, 0xc0, 0xa0, 0x00, 0x4c, 0x97, 0xe8, 0xee, 0x36, 0x00, 0xa1, 0x00,
+    0xf1, 0x85, 0xef, 0xe8, 0x97, 0x30, 0x94, 0xc0, 0x9b, 0x22, 0x9c, 0x22, 0x94, 0xc0, 0x95, 0x30,
+    0x5c, 0x98, 0x38, 0x20, 0xa0, 0x00, 0x5c, 0x98, 0x10, 0x05, 0xa0, 0x04, 0x34, 0x20, 0xa0, 0x00,
+    0x58, 0x98, 0x34, 0x20, 0xa0, 0x00, 0x5e, 0x98, 0x36, 0x40, 0xa1, 0x00, 0x50, 0x18, 0xea, 0xec,
+    0x98, 0xc0, 0x6c, 0x50, 0x54, 0x18, 0x28, 0x03, 0x80, 0x2e, 0x15, 0x18, 0xcc, 0x50, 0x36, 0x20,
+    0xa0, 0x00, 0x51, 0x18, 0x98, 0x41, 0x10, 0x18, 0xcb, 0x54, 0x3c, 0x40, 0xa0, 0x04, 0x64, 0xed,
+    0x50, 0x58, 0x37, 0x03, 0x28, 0x00, 0x80, 0x08, 0x34, 0x20, 0xa0, 0x00, 0xe8, 0xee, 0x96, 0xc0,
+    0x99, 0x44, 0x29, 0x03, 0x80, 0x12, 0x50, 0x59, 0x36, 0x40, 0x00, 0x08, 0x7a, 0x80, 0x00, 0x40,
+    0xa0, 0x00, 0x98, 0x3c, 0xed, 0xe8, 0x34, 0x20, 0xa0, 0x00, 0x9e, 0x41, 0x94, 0xc0, 0xeb, 0xed,
+    0xea, 0xec, 0x36, 0x40, 0xa0, 0x00, 0x6c, 0x10, 0x57, 0x1d, 0x12, 0x5a, 0x53, 0x7b, 0x96, 0xc8,
+    0x60, 0x1d, 0x52, 0x5a, 0x53, 0x7b, 0x36, 0x10, 0xa0, 0x08, 0x60, 0x1d, 0x64, 0x69, 0x36, 0x11,
+    0xb0, 0x00, 0x74, 0x48, 0x64, 0x10, 0x40, 0x58, 0x36, 0x20, 0xa0, 0x00, 0x57, 0x4c, 0x6c, 0x10,
+    0x95, 0x31, 0x90, 0xc0, 0x90, 0xc0, 0x94, 0xc0, 0x9b, 0x23, 0x9c, 0x23, 0x97, 0x31, 0x9f, 0x70,
+    0x36, 0xc0, 0xa0, 0x00, 0x4c, 0x97, 0xe8, 0xee, 0xfb, 0xc3, 0xf2, 0x87, 0x94, 0xc0, 0x95, 0x30,
+    0x98, 0x22, 0x94, 0xc0, 0x97, 0x30, 0x9c, 0x22, 0x38, 0x20, 0xa0, 0x00, 0x5a, 0x9b, 0x10, 0x05,
+    0xa0, 0x04, 0x1a, 0x9b, 0xed, 0xeb, 0x96, 0xc0, 0x5c, 0x9b, 0x28, 0x03, 0x80, 0x28, 0x94, 0xc0,
+    0x00, 0x08, 0x7b, 0x00, 0x00, 0x40, 0x98, 0x42, 0x53, 0x13, 0x9a, 0xc0, 0x2c, 0x02, 0x80, 0x80,
+    0x90, 0xc0, 0x18, 0x7a, 0x9f, 0xe0, 0x37, 0x03, 0x28, 0x00, 0x80, 0x00, 0x36, 0x80, 0xa0, 0x00,
+    0xe8, 0xec, 0x65, 0xe9, 0x95, 0x7f, 0x94, 0xc1, 0xc1, 0x18, 0x51, 0x98, 0x94, 0xc1, 0xc0, 0x1a,
+    0x41, 0x9a, 0x11, 0x5a, 0x10, 0x5c, 0x6d, 0x10, 0x96, 0xd8, 0x61, 0x11, 0x50, 0x5c, 0x51, 0x5a,
+    0x38, 0x40, 0xa0, 0x00, 0x65, 0x11, 0xec, 0xe8, 0x65, 0xe9, 0x42, 0x61, 0x94, 0xc0, 0x97, 0x31,
+    0x9c, 0x23, 0x94, 0xc0, 0x95, 0x31, 0x98, 0x23, 0x90, 0xc0, 0x90, 0xc0, 0x9f, 0x70, 0x4a, 0x95,
+    0x36, 0x20, 0xa1, 0x00, 0xf7, 0x85, 0xe9, 0xe8, 0x36, 0x80, 0xa0, 0x00, 0xca, 0x47, 0xe9, 0xe8,
+    0x36, 0x00, 0xa0, 0x08, 0x97, 0x30, 0x74, 0xd1, 0x94, 0xc0, 0x9c, 0x22, 0x95, 0x30, 0x3c, 0x02,
+    0x20, 0x16, 0x80, 0x00, 0x94, 0xc0, 0x00, 0x08, 0x7b, 0x80, 0x00, 0x40, 0x96, 0x32, 0x97, 0x32,
+    0x94, 0xc0, 0x96, 0x20, 0x97, 0x20, 0x10, 0x05, 0xa0, 0x04, 0xe9, 0x0a, 0x37, 0x03, 0x20, 0x80,
+    0x80, 0x00, 0x3a, 0x40, 0x36, 0x40, 0x80, 0x09, 0x94, 0x4a, 0x2c, 0x10, 0x2c, 0x90, 0x2d, 0x10,
+    0x6d, 0x90, 0x36, 0x40, 0xa0, 0x00, 0x4d, 0xda, 0x50, 0x59, 0x3e, 0x48, 0xa0, 0xf0, 0x60, 0x00,
+    0x60, 0x81, 0x61, 0x02, 0x61, 0x83, 0x4d, 0xda, 0x50, 0x59, 0x3a, 0x00, 0xa0, 0xf0, 0x60, 0x00,
+    0x60, 0x81, 0x61, 0x02, 0x61, 0x83, 0x24, 0x65, 0x24, 0xe5, 0x25, 0x65, 0x65, 0xe5, 0x36, 0x00,
+    0xb8, 0x00, 0x76, 0x51, 0x76, 0xd1, 0x36, 0x00, 0xa0, 0x04, 0x36, 0x83, 0x80, 0x05, 0x34, 0x00,
+    0xa8, 0x04, 0xd9, 0x9b, 0x36, 0x00, 0xa0, 0x04, 0x38, 0x83, 0x80, 0x05, 0x36, 0x00, 0xa0, 0x04,
+    0x38, 0xa3, 0x80, 0x04, 0x36, 0x00, 0xa8, 0x04, 0xd9, 0x9b, 0xda, 0x1c, 0x00, 0x08, 0x7c, 0x00,
+    0x00, 0x40, 0x36, 0x00, 0xa0, 0x04, 0x38, 0x83, 0x80, 0x05, 0x38, 0x00, 0xba, 0x01, 0x76, 0x53,
+    0x76, 0xd3, 0x75, 0x51, 0x3c, 0x00, 0xa8, 0x46, 0x36, 0x45, 0x80, 0x03, 0x90, 0xc0, 0x36, 0x86,
+    0x80, 0x05, 0x36, 0x00, 0xb8, 0x0c, 0xda, 0x9d, 0xdb, 0x1e, 0x3c, 0x00, 0xa8, 0x46, 0x38, 0x45,
+    0x80, 0x03, 0x90, 0xc0, 0x38, 0x86, 0x80, 0x05, 0x3c, 0x00, 0xa8, 0x46, 0x38, 0x65, 0x80, 0x02,
+    0x90, 0xc0, 0x38, 0xa6, 0x80, 0x04, 0x3a, 0x00, 0xba, 0x0d, 0xda, 0x9d, 0xdb, 0x1e, 0xd9, 0x1a,
+    0xda, 0x1c, 0x3c, 0x00, 0xa8, 0x46, 0x38, 0x45, 0x80, 0x03, 0x90, 0xc0, 0x38, 0x86, 0x80, 0x05,
+    0x38, 0x00, 0xa0, 0x0d, 0x74, 0x51, 0x75, 0x52, 0x76, 0x53, 0x3c, 0x00, 0xac, 0x60, 0x36, 0x05,
+    0x80, 0x01, 0x90, 0xc0, 0x36, 0x46, 0x80, 0x03, 0x3a, 0x00, 0xa8, 0x40, 0x36, 0x87, 0x80, 0x05,
+    0xda, 0x9d, 0x00, 0x08, 0x7c, 0x80, 0x00, 0x40, 0xdb, 0x1e, 0x3c, 0x00, 0xac, 0x60, 0x38, 0x05,
+    0x80, 0x01, 0xdb, 0x9f, 0x38, 0x46, 0x80, 0x03, 0x36, 0x00, 0xa8, 0x40, 0x38, 0x87, 0x80, 0x05,
+    0x3c, 0x00, 0xac, 0x60, 0x30, 0x25, 0x80, 0x00, 0x90, 0xc0, 0x30, 0x66, 0x80, 0x02, 0x3a, 0x00,
+    0xa8, 0x40, 0x30, 0xa7, 0x80, 0x04, 0xda, 0x9d, 0xdb, 0x1e, 0x3a, 0x00, 0xb6, 0x03, 0xdb, 0x9f,
+    0xda, 0x19, 0xd9, 0x9b, 0xdb, 0x9d, 0x3c, 0x00, 0xac, 0x20, 0x30, 0x85, 0x80, 0x00, 0x90, 0xc0,
+    0x30, 0x66, 0x80, 0x02, 0x36, 0x00, 0xa8, 0x40, 0x30, 0xe7, 0x80, 0x04, 0x36, 0x00, 0xa0, 0x04,
+    0x6f, 0xc1, 0x6c, 0xdf, 0x34, 0x00, 0xa8, 0x04, 0x6f, 0xc7, 0x34, 0x00, 0xa0, 0x04, 0x67, 0x69,
+    0x90, 0xc0, 0x96, 0xc2, 0x31, 0x64, 0x3d, 0x9e, 0x80, 0x08, 0x3a, 0x40, 0x36, 0x98, 0x80, 0x09,
+    0x94, 0x4a, 0x2c, 0x10, 0x6c, 0x90, 0x36, 0x40, 0x00, 0x08, 0x7d, 0x00, 0x00, 0x40, 0xa0, 0x00,
+    0x5d, 0x5a, 0x50, 0x59, 0x3a, 0x48, 0xa0, 0xc0, 0x60, 0x00, 0x60, 0x81, 0x5d, 0x5a, 0x50, 0x59,
+    0x3a, 0x00, 0xa6, 0xc3, 0x60, 0x00, 0x60, 0x81, 0x76, 0x51, 0x76, 0xd6, 0x36, 0x00, 0xa8, 0x40,
+    0x36, 0x83, 0x80, 0x05, 0xd9, 0x9b, 0x36, 0x00, 0xa8, 0x40, 0x38, 0x83, 0x80, 0x05, 0x36, 0x00,
+    0xa8, 0x40, 0x38, 0xa3, 0x80, 0x04, 0x36, 0x00, 0xb0, 0x08, 0xd9, 0x9b, 0xda, 0x1c, 0x3a, 0x00,
+    0xa8, 0x41, 0x38, 0x83, 0x80, 0x05, 0x76, 0x50, 0x75, 0x51, 0x3c, 0x00, 0xa8, 0x40, 0x36, 0x84,
+    0x80, 0x05, 0x90, 0xc0, 0x36, 0x45, 0x80, 0x03, 0x94, 0xc0, 0xda, 0x1c, 0xda, 0x9d, 0x3c, 0x00,
+    0xa8, 0x40, 0x38, 0x84, 0x80, 0x05, 0x90, 0xc0, 0x38, 0x45, 0x80, 0x03, 0x3c, 0x00, 0xa8, 0x40,
+    0x30, 0xa4, 0x80, 0x04, 0x90, 0xc0, 0x30, 0x65, 0x80, 0x02, 0x3a, 0x00, 0xa2, 0x00, 0x00, 0x08,
+    0x7d, 0x80, 0x00, 0x40, 0xda, 0x1c, 0xda, 0x9d, 0xdb, 0x1d, 0xdb, 0x9b, 0x3c, 0x00, 0xa8, 0x00,
+    0x30, 0xc4, 0x80, 0x04, 0x90, 0xc0, 0x30, 0xe5, 0x80, 0x02, 0x6d, 0x55, 0x34, 0x00, 0xa8, 0x04,
+    0x6f, 0xcb, 0x36, 0x00, 0xa8, 0x08, 0x74, 0x5f, 0x67, 0xe5, 0x94, 0xc0, 0x96, 0x21, 0x97, 0x21,
+    0x94, 0xc0, 0x96, 0x33, 0x97, 0x33, 0x94, 0xc0, 0x95, 0x31, 0x9c, 0x23, 0x90, 0xc0, 0x90, 0xc0,
+    0x97, 0x31, 0x9f, 0x70, 0x34, 0x00, 0xa8, 0x00, 0x74, 0x57, 0x97, 0x30, 0x94, 0xc0, 0x9c, 0x22,
+    0x95, 0x30, 0x5c, 0x58, 0x1a, 0x98, 0x6d, 0x54, 0x2d, 0x5c, 0x19, 0x98, 0xec, 0xe8, 0x38, 0x00,
+    0xa1, 0x00, 0x7a, 0x61, 0xe9, 0xe8, 0xcc, 0x52, 0x10, 0x05, 0xa0, 0x04, 0x37, 0x03, 0x20, 0x80,
+    0x80, 0x00, 0x9c, 0x44, 0x41, 0x91, 0x2c, 0x10, 0x2c, 0x90, 0x13, 0x5a, 0x52, 0x99, 0x98, 0xc8,
+    0x6c, 0x61, 0x60, 0x9d, 0x00, 0x08, 0x7e, 0x00, 0x00, 0x40, 0x53, 0x5a, 0x52, 0x99, 0x2c, 0x61,
+    0x60, 0x9d, 0x14, 0x89, 0xd8, 0x18, 0x2c, 0x51, 0x49, 0x94, 0xd4, 0x15, 0x94, 0xc0, 0x95, 0x31,
+    0x9c, 0x23, 0x90, 0xc0, 0x90, 0xc0, 0x94, 0xc0, 0x97, 0x31, 0x74, 0x58, 0x9f, 0x70, 0xd8, 0x18,
+    0x00, 0xc6, 0x37, 0xcc, 0x80, 0x09, 0x64, 0x69, 0x80, 0x85, 0x08, 0x06, 0x35, 0x7c, 0x80, 0x08,
+    0xc0, 0x8f, 0x28, 0x08, 0x80, 0x08, 0x51, 0x90, 0x33, 0x19, 0x8f, 0x00, 0xdc, 0xa8, 0x34, 0xf9,
+    0x04, 0xc4, 0x37, 0xce, 0x80, 0x09, 0x6c, 0x31, 0x6c, 0x7d, 0x9f, 0x7d, 0x74, 0x7c, 0x64, 0x69,
+    0x80, 0x59, 0x9b, 0x40, 0x2b, 0x03, 0x80, 0x0a, 0x30, 0xc1, 0x39, 0xf0, 0x80, 0x09, 0x08, 0xc6,
+    0x37, 0xb8, 0x80, 0x09, 0x90, 0xc0, 0x91, 0xb8, 0x08, 0x06, 0x35, 0x7c, 0x80, 0x08, 0x90, 0xc0,
+    0xb1, 0x01, 0x08, 0xc6, 0x37, 0xb8, 0x80, 0x09, 0x02, 0xc6, 0x00, 0x08, 0x7e, 0x80, 0x00, 0x40,
+    0x37, 0xcc, 0x80, 0x09, 0x39, 0x61, 0xe8, 0x41, 0xc8, 0x49, 0x30, 0x79, 0x08, 0xc2, 0x37, 0xb8,
+    0x80, 0x09, 0x02, 0xc2, 0x37, 0xcc, 0x80, 0x09, 0x94, 0xc2, 0x23, 0x03, 0x80, 0x16, 0x96, 0xd0,
+    0x38, 0xc0, 0x37, 0xe8, 0x80, 0x09, 0x08, 0xc2, 0x37, 0xb8, 0x80, 0x09, 0x90, 0xc0, 0x9f, 0x7c,
+    0x9f, 0x71, 0x90, 0xc0, 0x9f, 0x71, 0x01, 0xc6, 0x37, 0xcc, 0x80, 0x09, 0x34, 0x11, 0x82, 0x08,
+    0x84, 0x15, 0x83, 0x64, 0x75, 0xd0, 0x34, 0x53, 0x01, 0xc6, 0x37, 0xcc, 0x80, 0x09, 0x34, 0x11,
+    0x82, 0x08, 0x81, 0xf1, 0xc5, 0x69, 0x9f, 0x7d, 0x02, 0xc6, 0x37, 0xcc, 0x80, 0x09, 0x25, 0x69,
+    0x09, 0x06, 0x35, 0x7c, 0x80, 0x08, 0x84, 0x13, 0x29, 0x08, 0x80, 0x08, 0x52, 0x90, 0x0c, 0x02,
+    0xa0, 0x20, 0x84, 0x42, 0x92, 0xc3, 0xb0, 0x09, 0x02, 0xc6, 0x37, 0xcc, 0x80, 0x09, 0x39, 0x41,
+    0x00, 0x08, 0x7f, 0x00, 0x00, 0x40, 0x38, 0xc0, 0x39, 0xf0, 0x80, 0x09, 0x02, 0xc2, 0x37, 0xcc,
+    0x80, 0x09, 0x09, 0xc6, 0x37, 0xdc, 0x80, 0x09, 0x90, 0xc0, 0x90, 0x99, 0x09, 0xc6, 0x37, 0xdc,
+    0x80, 0x09, 0x30, 0xc1, 0x37, 0xe8, 0x80, 0x09, 0xe9, 0x41, 0xe8, 0x89, 0x80, 0x0e, 0x09, 0xc2,
+    0x37, 0xdc, 0x80, 0x09, 0x00, 0xc2, 0x37, 0xdc, 0x80, 0x09, 0xc5, 0x61, 0x90, 0xc0, 0x9f, 0x7c,
+    0x9f, 0x71, 0x31, 0x24, 0x3f, 0x30, 0x80, 0x09, 0x83, 0xfb, 0x36, 0xd0, 0x2c, 0x10, 0xe7, 0x58,
+    0xf0, 0x43, 0x20, 0x00, 0x80, 0x82, 0xf5, 0x04, 0x83, 0x64, 0xf9, 0x44, 0x83, 0x60, 0x10, 0x7c,
+    0x9f, 0xcf, 0x10, 0x7c, 0x9f, 0xcf, 0x24, 0x69, 0xf0, 0x45, 0x27, 0x18, 0x81, 0x66, 0x3a, 0xc9,
+    0x96, 0x08, 0x83, 0x4a, 0x34, 0x69, 0xf1, 0x46, 0x83, 0x44, 0x74, 0x6d, 0xf6, 0x84, 0x27, 0x6a,
+    0x37, 0xd6, 0xf9, 0xc4, 0x27, 0x18, 0x00, 0x08, 0x7f, 0x80, 0x00, 0x40, 0x81, 0x34, 0x3a, 0xe8,
+    0x24, 0x00, 0xbf, 0xff, 0x3e, 0xc8, 0x38, 0x00, 0xbf, 0xff, 0x3f, 0xc8, 0x3c, 0x10, 0xbf, 0xff,
+    0x3b, 0xc8, 0x3c, 0x14, 0xbf, 0xff, 0x3c, 0xe8, 0x24, 0x18, 0xbf, 0xff, 0x38, 0x00, 0x20, 0x1a,
+    0x80, 0x08, 0x90, 0xc0, 0xe8, 0xa9, 0x25, 0x18, 0x80, 0xd2, 0x38, 0x00, 0x20, 0x18, 0x80, 0x08,
+    0x90, 0xc0, 0xe8, 0xa9, 0x80, 0xc1, 0x38, 0x00, 0x20, 0x16, 0x80, 0x08, 0x90, 0xc0, 0xe8, 0xa9,
+    0x80, 0xb1, 0x38, 0x00, 0x20, 0x14, 0x80, 0x08, 0x90, 0xc0, 0xe8, 0xa9, 0x80, 0xa1, 0x38, 0x00,
+    0x20, 0x12, 0x80, 0x08, 0x90, 0xc0, 0xe8, 0xa9, 0x80, 0x91, 0x38, 0x00, 0x20, 0x10, 0x80, 0x08,
+    0x90, 0xc0, 0xe8, 0xa9, 0x80, 0x81, 0x38, 0x00, 0x20, 0x06, 0x80, 0x08, 0x90, 0xc0, 0xe8, 0xa9,
+    0x80, 0x71, 0x38, 0x00, 0x20, 0x02, 0x80, 0x08, 0x01, 0xc7, 0x37, 0xbe, 0x00, 0x08, 0x80, 0x00,
+    0x00, 0x40, 0x80, 0x09, 0xe8, 0xa9, 0x80, 0x7b, 0x11, 0xd1, 0x38, 0x00, 0x20, 0x00, 0x80, 0x08,
+    0x90, 0xc0, 0xe8, 0xa9, 0x84, 0x6d, 0x11, 0x92, 0x38, 0xc0, 0x37, 0xbc, 0x80, 0x09, 0x33, 0xe8,
+    0x9f, 0xff, 0xd0, 0x20, 0x84, 0x36, 0x01, 0xc2, 0x37, 0xbc, 0x80, 0x09, 0x32, 0xe4, 0x3a, 0x92,
+    0x80, 0x01, 0xf9, 0x44, 0x08, 0xc6, 0x37, 0xbc, 0x80, 0x09, 0x3a, 0xe8, 0x24, 0x00, 0xbf, 0xff,
+    0xe8, 0xf1, 0xf9, 0xc4, 0x3b, 0xc8, 0x3c, 0x14, 0xbf, 0xff, 0x84, 0x10, 0x3c, 0xe8, 0x24, 0x18,
+    0xbf, 0xff, 0x50, 0x92, 0x00, 0xc2, 0x37, 0xbc, 0x80, 0x09, 0x00, 0xc6, 0x37, 0xbc, 0x80, 0x09,
+    0x30, 0xc9, 0x84, 0x10, 0x88, 0x1d, 0x88, 0x1a, 0x51, 0x96, 0x8f, 0xf6, 0x50, 0x97, 0x88, 0x12,
+    0x51, 0x97, 0x8f, 0xee, 0x50, 0x93, 0x88, 0x0a, 0x51, 0x93, 0x8f, 0xe6, 0x50, 0x94, 0x51, 0x94,
+    0x36, 0xf9, 0x00, 0x08, 0x80, 0x80, 0x00, 0x40, 0xf0, 0xc3, 0x34, 0xf8, 0xf9, 0x44, 0x3a, 0xca,
+    0x96, 0x08, 0x34, 0x6a, 0x75, 0x6a, 0x6c, 0xb8, 0x2a, 0xff, 0x9e, 0x27, 0xcc, 0x51, 0x35, 0x6d,
+    0x34, 0x6d, 0xcc, 0x59, 0x74, 0xf9, 0x6c, 0xb8, 0x2a, 0xff, 0x9e, 0x17, 0xf1, 0x43, 0x3b, 0xe1,
+    0xf9, 0xc4, 0x67, 0xea, 0x2c, 0xff, 0x9e, 0xf5, 0xe9, 0x42, 0xf0, 0xc3, 0x35, 0x78, 0xf1, 0xc6,
+    0x34, 0x69, 0x74, 0xee, 0x3c, 0x12, 0x80, 0x82, 0x75, 0x7a, 0x6c, 0x12, 0x74, 0x78, 0x88, 0x0a,
+    0x6c, 0x31, 0x30, 0xe1, 0x3f, 0x7e, 0x80, 0x00, 0x34, 0xf8, 0xf0, 0xc5, 0x6c, 0x11, 0x76, 0xf8,
+    0x3a, 0xc8, 0x96, 0x08, 0x2a, 0xff, 0x9d, 0xdb, 0x74, 0x68, 0x2a, 0xff, 0x9d, 0xd5, 0x74, 0x6d,
+    0x2c, 0x10, 0xe7, 0x78, 0x30, 0x24, 0x3f, 0x50, 0x80, 0x09, 0x00, 0xc2, 0x37, 0xd0, 0x80, 0x09,
+    0x76, 0xd0, 0x2a, 0xff, 0x9d, 0xbd, 0x20, 0x00, 0x00, 0x08, 0x81, 0x00, 0x00, 0x40, 0x80, 0x92,
+    0x2a, 0xff, 0x9d, 0xb5, 0x74, 0x55, 0x30, 0xe1, 0x3f, 0x6e, 0x80, 0x00, 0x74, 0x78, 0x6e, 0xa1,
+    0x3a, 0xc8, 0x96, 0x08, 0x2a, 0xff, 0x9d, 0xa1, 0x74, 0x68, 0x2a, 0xff, 0x9d, 0x9b, 0x74, 0x6d,
+    0x6c, 0x10, 0x9f, 0x70, 0x00, 0xc2, 0x37, 0xd0, 0x80, 0x09, 0x31, 0xe4, 0x37, 0xe6, 0x80, 0x01,
+    0x31, 0xe4, 0x37, 0xda, 0x80, 0x01, 0x2b, 0xff, 0x9e, 0x05, 0x2f, 0x10, 0xe7, 0x50, 0x32, 0xe4,
+    0x3a, 0x14, 0x80, 0x01, 0x2c, 0x90, 0xe8, 0x38, 0x24, 0x69, 0x2c, 0x10, 0x0e, 0xc6, 0x37, 0xd0,
+    0x80, 0x09, 0x25, 0x18, 0x87, 0xd8, 0x39, 0xc0, 0x39, 0xf0, 0x80, 0x09, 0x08, 0x06, 0x3c, 0x00,
+    0x80, 0x08, 0x00, 0x7c, 0x9f, 0xf0, 0xee, 0x19, 0xb9, 0xc2, 0x27, 0xe8, 0x9f, 0xf0, 0x99, 0x62,
+    0xc1, 0x81, 0x24, 0x69, 0x02, 0xc5, 0x3d, 0xad, 0x80, 0x09, 0x26, 0x18, 0x87, 0xf2, 0x00, 0x08,
+    0x81, 0x80, 0x00, 0x40, 0x92, 0xc3, 0x6c, 0x10, 0xd5, 0x20, 0x27, 0x18, 0x82, 0x12, 0x01, 0xc6,
+    0x3e, 0x1c, 0x80, 0x09, 0xd1, 0x24, 0xc0, 0x81, 0x33, 0x19, 0x8f, 0xff, 0x00, 0xc1, 0x3d, 0xae,
+    0x80, 0x09, 0x24, 0x18, 0x81, 0x2a, 0x01, 0xc0, 0x37, 0xe4, 0x80, 0x09, 0xd1, 0x22, 0x80, 0x85,
+    0xd1, 0x21, 0x84, 0x65, 0x2d, 0x90, 0x08, 0xc6, 0x37, 0xd4, 0x80, 0x09, 0x3a, 0xc0, 0x3d, 0x98,
+    0x80, 0x09, 0xc9, 0x84, 0xea, 0x18, 0xe8, 0x41, 0xe9, 0xa8, 0x10, 0x7c, 0x9f, 0xf0, 0x90, 0x9a,
+    0x26, 0x18, 0x87, 0x5c, 0x08, 0xc2, 0x37, 0xd4, 0x80, 0x09, 0x02, 0xc5, 0x3d, 0x98, 0x80, 0x09,
+    0x3d, 0x58, 0x04, 0xc5, 0x3d, 0x99, 0x80, 0x09, 0x03, 0xc2, 0x37, 0xd4, 0x80, 0x09, 0xd9, 0x94,
+    0x01, 0xc5, 0x3d, 0x9a, 0x80, 0x09, 0x3c, 0xc8, 0xdd, 0x9a, 0x00, 0xc5, 0x3d, 0x9b, 0x80, 0x09,
+    0xdd, 0x99, 0xdd, 0x98, 0x00, 0x08, 0x82, 0x00, 0x00, 0x40, 0xc0, 0x82, 0x03, 0xc2, 0x37, 0xd8,
+    0x80, 0x09, 0x20, 0x18, 0x87, 0x20, 0x00, 0xc1, 0x3d, 0xad, 0x80, 0x09, 0x00, 0x05, 0x3c, 0x4a,
+    0x80, 0x08, 0x24, 0x69, 0x30, 0x41, 0x33, 0x87, 0x80, 0x09, 0x25, 0x18, 0x87, 0x08, 0xf2, 0x42,
+    0x83, 0x06, 0xf0, 0x41, 0x21, 0x18, 0x86, 0xfe, 0x08, 0xc6, 0x37, 0xd4, 0x80, 0x09, 0x3a, 0xc0,
+    0x3d, 0x98, 0x80, 0x09, 0xc9, 0x82, 0xea, 0x18, 0xe8, 0x41, 0xe9, 0xa8, 0x10, 0x7c, 0x9f, 0xf0,
+    0x90, 0x9a, 0x26, 0x18, 0x86, 0xe0, 0x2c, 0x10, 0x08, 0xc2, 0x37, 0xd4, 0x80, 0x09, 0x01, 0xc5,
+    0x3d, 0x98, 0x80, 0x09, 0x3c, 0xc8, 0x02, 0xc5, 0x3d, 0x99, 0x80, 0x09, 0xdd, 0x19, 0x34, 0xfa,
+    0xc3, 0x84, 0x36, 0x11, 0x81, 0x00, 0x00, 0xc2, 0x37, 0xd4, 0x80, 0x09, 0x02, 0xc0, 0x37, 0xe6,
+    0x80, 0x09, 0x26, 0x18, 0x86, 0xb0, 0x03, 0xc1, 0x3d, 0xad, 0x00, 0x08, 0x82, 0x80, 0x00, 0x40,
+    0x80, 0x09, 0x20, 0x00, 0x80, 0xe3, 0x34, 0x71, 0x00, 0x7c, 0x9f, 0xff, 0x2a, 0xff, 0x9c, 0xb7,
+    0x09, 0xc6, 0x37, 0xd8, 0x80, 0x09, 0x2c, 0x90, 0x00, 0x05, 0x3c, 0x4a, 0x80, 0x08, 0x24, 0x69,
+    0x01, 0xc1, 0x3d, 0xad, 0x80, 0x09, 0x24, 0x18, 0x86, 0x82, 0x01, 0xc1, 0x3d, 0xae, 0x80, 0x09,
+    0x01, 0xc7, 0x37, 0xe6, 0x80, 0x09, 0x30, 0x41, 0x34, 0x05, 0x80, 0x09, 0xf1, 0x42, 0x2a, 0xff,
+    0x9e, 0x6f, 0xf0, 0x41, 0x21, 0x18, 0x86, 0x64, 0x08, 0xc6, 0x37, 0xd4, 0x80, 0x09, 0x3a, 0xc0,
+    0x3d, 0x98, 0x80, 0x09, 0xc9, 0x82, 0xea, 0x18, 0xe8, 0x41, 0x10, 0x7c, 0x9f, 0xf0, 0xe9, 0xa8,
+    0x90, 0x9a, 0x26, 0x18, 0x86, 0x46, 0x08, 0xc2, 0x37, 0xd4, 0x80, 0x09, 0x02, 0xc5, 0x3d, 0x98,
+    0x80, 0x09, 0x3d, 0x48, 0x01, 0xc6, 0x37, 0xd8, 0x80, 0x09, 0x34, 0x69, 0x05, 0xc5, 0x3d, 0x99,
+    0x00, 0x08, 0x83, 0x00, 0x00, 0x40, 0x80, 0x09, 0x32, 0xcf, 0x86, 0x08, 0x37, 0xef, 0xde, 0x9a,
+    0x37, 0x7d, 0xd7, 0xc0, 0x32, 0xca, 0x84, 0x10, 0x35, 0x6a, 0x05, 0xc0, 0x37, 0xe0, 0x80, 0x09,
+    0x2c, 0x4b, 0x05, 0xc7, 0x37, 0xe6, 0x80, 0x09, 0x32, 0xcb, 0x82, 0x18, 0x35, 0xeb, 0x04, 0xc5,
+    0x37, 0xe7, 0x80, 0x09, 0x6c, 0x53, 0x3a, 0xca, 0x96, 0x08, 0x24, 0x64, 0x75, 0x6a, 0x34, 0x78,
+    0xd5, 0x44, 0x6c, 0x32, 0x74, 0x78, 0x3c, 0x10, 0x80, 0x81, 0x74, 0x78, 0x33, 0x60, 0x30, 0x01,
+    0x20, 0x00, 0x80, 0x08, 0x84, 0x2c, 0x94, 0xc3, 0x28, 0x00, 0x80, 0xe5, 0x30, 0x79, 0x32, 0x01,
+    0x30, 0x00, 0x80, 0x08, 0x80, 0x19, 0x30, 0xfa, 0x74, 0x55, 0x80, 0x13, 0xd4, 0x41, 0x70, 0x7a,
+    0x80, 0x10, 0x94, 0xc2, 0x28, 0x00, 0x80, 0xe4, 0x88, 0x08, 0xe8, 0x38, 0x28, 0x00, 0x80, 0xe2,
+    0x34, 0x75, 0xc9, 0x41, 0x2a, 0xff, 0x00, 0x08, 0x83, 0x80, 0x00, 0x40, 0x9b, 0xc5, 0x08, 0x7c,
+    0x9f, 0xff, 0x6c, 0x10, 0x00, 0xc1, 0x3d, 0xad, 0x80, 0x09, 0x00, 0xc1, 0x3d, 0xae, 0x80, 0x09,
+    0x21, 0x18, 0x85, 0x94, 0x00, 0xc5, 0x3d, 0xaa, 0x80, 0x09, 0xd4, 0x20, 0x27, 0x18, 0x83, 0x9a,
+    0x02, 0xc6, 0x3e, 0x1c, 0x80, 0x09, 0xd0, 0x25, 0xc1, 0x81, 0x35, 0x1a, 0x8f, 0xff, 0x01, 0xc1,
+    0x3d, 0xae, 0x80, 0x09, 0x24, 0x18, 0x81, 0xb0, 0x02, 0xc0, 0x37, 0xe4, 0x80, 0x09, 0xd0, 0x26,
+    0x25, 0x18, 0x81, 0x88, 0xd0, 0x24, 0x80, 0xe1, 0x2c, 0x90, 0xd0, 0x22, 0x80, 0x87, 0xd0, 0x21,
+    0x84, 0x65, 0x2d, 0x90, 0x08, 0xc6, 0x37, 0xd4, 0x80, 0x09, 0x3a, 0xc0, 0x3d, 0x98, 0x80, 0x09,
+    0xc9, 0x84, 0xea, 0x18, 0xe8, 0x41, 0xe9, 0xa8, 0x10, 0x7c, 0x9f, 0xf0, 0x90, 0x9a, 0x26, 0x18,
+    0x85, 0x36, 0x08, 0xc2, 0x37, 0xd4, 0x80, 0x09, 0x02, 0xc5, 0x3d, 0x98, 0x00, 0x08, 0x84, 0x00,
+    0x00, 0x40, 0x80, 0x09, 0x3d, 0x58, 0x04, 0xc5, 0x3d, 0x99, 0x80, 0x09, 0x03, 0xc2, 0x37, 0xd4,
+    0x80, 0x09, 0xd9, 0x94, 0x01, 0xc5, 0x3d, 0x9a, 0x80, 0x09, 0x3c, 0xc8, 0xdd, 0x9a, 0xdd, 0x99,
+    0x00, 0xc5, 0x3d, 0x9b, 0x80, 0x09, 0xdd, 0x98, 0xc0, 0x82, 0x03, 0xc2, 0x37, 0xd8, 0x80, 0x09,
+    0x20, 0x18, 0x84, 0xfa, 0x00, 0xc1, 0x3d, 0xaa, 0x80, 0x09, 0x01, 0x05, 0x3c, 0x4a, 0x80, 0x08,
+    0x24, 0xe9, 0x31, 0x41, 0x33, 0x99, 0x80, 0x09, 0x25, 0x18, 0x84, 0xe2, 0xf0, 0x42, 0x2a, 0xff,
+    0x9c, 0xe1, 0xf1, 0x41, 0x21, 0x18, 0x84, 0xd6, 0x08, 0xc6, 0x37, 0xd4, 0x80, 0x09, 0x3a, 0xc0,
+    0x3d, 0x98, 0x80, 0x09, 0xc9, 0x82, 0xea, 0x18, 0xe8, 0x41, 0x10, 0x7c, 0x9f, 0xf0, 0xe9, 0xa8,
+    0x90, 0x9a, 0x2c, 0x90, 0x01, 0xc0, 0x37, 0xe2, 0x80, 0x09, 0x26, 0x18, 0x84, 0xb0, 0x08, 0xc2,
+    0x37, 0xd4, 0x00, 0x08, 0x84, 0x80, 0x00, 0x40, 0x80, 0x09, 0x02, 0xc5, 0x3d, 0x98, 0x80, 0x09,
+    0x3d, 0x48, 0x00, 0xc5, 0x3d, 0x99, 0x80, 0x09, 0xdc, 0x1a, 0xc2, 0x84, 0x02, 0xc1, 0x3d, 0xaa,
+    0x80, 0x09, 0x00, 0xc0, 0x37, 0xe6, 0x80, 0x09, 0x20, 0x18, 0x84, 0x88, 0x01, 0xc2, 0x37, 0xd4,
+    0x80, 0x09, 0x2c, 0x90, 0x08, 0xc6, 0x37, 0xd4, 0x80, 0x09, 0x3a, 0xc0, 0x3d, 0x98, 0x80, 0x09,
+    0xc9, 0x82, 0xea, 0x18, 0xe8, 0x41, 0xe9, 0xa8, 0x10, 0x7c, 0x9f, 0xf0, 0x90, 0x9a, 0x26, 0x18,
+    0x84, 0x62, 0x08, 0xc2, 0x37, 0xd4, 0x80, 0x09, 0x09, 0xc7, 0x37, 0xe2, 0x80, 0x09, 0x38, 0xc0,
+    0x39, 0xf0, 0x80, 0x09, 0x04, 0xc5, 0x3d, 0x98, 0x80, 0x09, 0x3e, 0x48, 0x02, 0xc6, 0x37, 0xd8,
+    0x80, 0x09, 0x33, 0x01, 0x20, 0x00, 0x80, 0x08, 0x31, 0x7b, 0xe9, 0xfc, 0x00, 0xc5, 0x3d, 0x99,
+    0x80, 0x09, 0x01, 0xc2, 0x37, 0xd4, 0x80, 0x09, 0x00, 0x08, 0x85, 0x00, 0x00, 0x40, 0xdc, 0x1c,
+    0x84, 0x46, 0xe9, 0x18, 0x31, 0x01, 0x30, 0x00, 0x80, 0x08, 0x31, 0x79, 0x01, 0xc7, 0x37, 0xe6,
+    0x80, 0x09, 0x80, 0x35, 0x36, 0x11, 0x81, 0x00, 0x80, 0x2f, 0x00, 0x11, 0x00, 0xc7, 0x37, 0xe2,
+    0x80, 0x09, 0x78, 0x41, 0x34, 0x78, 0x00, 0xc0, 0x37, 0xe2, 0x80, 0x09, 0x30, 0xf8, 0x2c, 0x10,
+    0xc1, 0x85, 0x25, 0x18, 0x83, 0xf4, 0x01, 0xc1, 0x3d, 0xaa, 0x80, 0x09, 0x20, 0x18, 0x83, 0xea,
+    0x00, 0xc2, 0x37, 0xd4, 0x80, 0x09, 0x8e, 0xe6, 0xc0, 0x86, 0x00, 0xc7, 0x37, 0xe6, 0x80, 0x09,
+    0x36, 0x10, 0x81, 0x00, 0x80, 0x0c, 0x94, 0xc2, 0x20, 0x00, 0x80, 0xe3, 0x20, 0x00, 0x80, 0xe2,
+    0x2b, 0xff, 0x9b, 0x97, 0x89, 0xc5, 0x2c, 0x10, 0x08, 0xc6, 0x37, 0xd4, 0x80, 0x09, 0x3a, 0xc0,
+    0x3d, 0x98, 0x80, 0x09, 0xc9, 0x82, 0xea, 0x18, 0xe8, 0x41, 0xe9, 0xa8, 0x11, 0x7c, 0x00, 0x08,
+    0x85, 0x80, 0x00, 0x40, 0x9f, 0xf0, 0x91, 0x9a, 0x26, 0x18, 0x83, 0xa4, 0x08, 0xc2, 0x37, 0xd4,
+    0x80, 0x09, 0x03, 0xc5, 0x3d, 0x98, 0x80, 0x09, 0x3d, 0xc8, 0x02, 0xc7, 0x37, 0xe2, 0x80, 0x09,
+    0x3d, 0x41, 0x01, 0xc5, 0x3d, 0x99, 0x80, 0x09, 0x25, 0x6a, 0xdc, 0x9b, 0x01, 0xc0, 0x37, 0xe0,
+    0x80, 0x09, 0x38, 0xc0, 0x39, 0xf0, 0x80, 0x09, 0x84, 0x1c, 0x09, 0xc6, 0x37, 0xd8, 0x80, 0x09,
+    0x9b, 0x42, 0x2b, 0x03, 0x80, 0x0a, 0x3a, 0xc0, 0x39, 0xf0, 0x80, 0x09, 0x92, 0xd0, 0x74, 0x78,
+    0x92, 0xa2, 0x6c, 0x32, 0x36, 0x78, 0x37, 0x79, 0x00, 0xc6, 0x37, 0xd8, 0x80, 0x09, 0x34, 0xe8,
+    0xcc, 0x56, 0x30, 0xcf, 0x86, 0x08, 0x37, 0xef, 0x05, 0xc5, 0x37, 0xe7, 0x80, 0x09, 0x30, 0xca,
+    0x82, 0x18, 0x35, 0xea, 0xd7, 0xc1, 0x30, 0xce, 0x84, 0x10, 0x35, 0x6e, 0x06, 0xc7, 0x37, 0xe6,
+    0x80, 0x09, 0x6c, 0xcb, 0x00, 0x08, 0x86, 0x00, 0x00, 0x40, 0x3c, 0xca, 0x96, 0x08, 0x2d, 0xd9,
+    0x75, 0x6a, 0x2f, 0x8c, 0xd5, 0x45, 0x75, 0xff, 0x6f, 0x9d, 0x36, 0xff, 0xcc, 0x5f, 0x3c, 0x15,
+    0x80, 0x91, 0x75, 0x7d, 0x33, 0xe2, 0x75, 0x56, 0xd5, 0x40, 0x26, 0x18, 0x81, 0x04, 0x94, 0xc3,
+    0x25, 0x00, 0x80, 0xe5, 0x2c, 0x90, 0x35, 0x01, 0x30, 0x00, 0x80, 0x08, 0x71, 0x7d, 0x24, 0x18,
+    0x80, 0xf0, 0x94, 0xc2, 0x25, 0x00, 0x80, 0xe4, 0x27, 0x69, 0x01, 0xc0, 0x37, 0xe2, 0x80, 0x09,
+    0x25, 0x18, 0x80, 0xdc, 0x32, 0x01, 0x20, 0x00, 0x80, 0x08, 0xca, 0x40, 0xd5, 0x40, 0x3b, 0xc8,
+    0x3c, 0x14, 0xbf, 0xff, 0x3c, 0xc8, 0x3c, 0x16, 0xbf, 0xff, 0x33, 0x01, 0x20, 0x00, 0x80, 0x08,
+    0x3d, 0xe8, 0x24, 0x18, 0xbf, 0xff, 0x3e, 0xe8, 0x24, 0x1a, 0xbf, 0xff, 0x31, 0xf8, 0x35, 0x01,
+    0x20, 0x1a, 0x80, 0x08, 0x80, 0x93, 0x30, 0x7d, 0x14, 0xd0, 0x00, 0x08, 0x86, 0x80, 0x00, 0x40,
+    0xcf, 0x45, 0x80, 0x8b, 0xef, 0xaa, 0x80, 0x77, 0x3f, 0x00, 0x20, 0x18, 0x80, 0x08, 0x90, 0xc0,
+    0xef, 0xaa, 0x80, 0x67, 0x3f, 0x00, 0x20, 0x16, 0x80, 0x08, 0x90, 0xc0, 0xef, 0xaa, 0x80, 0x57,
+    0x3f, 0x00, 0x20, 0x14, 0x80, 0x08, 0x90, 0xc0, 0xef, 0xaa, 0x80, 0x47, 0x3f, 0x00, 0x20, 0x12,
+    0x80, 0x08, 0x90, 0xc0, 0xef, 0xaa, 0x80, 0x33, 0x3f, 0x00, 0x20, 0x10, 0x80, 0x08, 0x90, 0xc0,
+    0xef, 0xaa, 0x80, 0x1d, 0x3f, 0x00, 0x20, 0x06, 0x80, 0x08, 0x90, 0xc0, 0xef, 0xaa, 0x84, 0x33,
+    0x3f, 0xc8, 0x38, 0x04, 0xbf, 0xff, 0x39, 0xfc, 0x9f, 0xff, 0x88, 0x36, 0x44, 0x97, 0x3f, 0xc8,
+    0x3c, 0x10, 0xbf, 0xff, 0x88, 0x2c, 0x44, 0x17, 0x8f, 0xfc, 0x3f, 0xc8, 0x3c, 0x12, 0xbf, 0xff,
+    0x88, 0x20, 0x44, 0x13, 0x88, 0x1c, 0x44, 0x14, 0x88, 0x18, 0x44, 0x15, 0x88, 0x14, 0x44, 0x16,
+    0x00, 0x08, 0x87, 0x00, 0x00, 0x40, 0xcf, 0x42, 0x0f, 0xc2, 0x37, 0xc4, 0x80, 0x09, 0x88, 0x08,
+    0x44, 0x17, 0x54, 0xd0, 0x44, 0x11, 0x38, 0xc1, 0xe9, 0x42, 0x34, 0xf9, 0x01, 0xc0, 0x37, 0xe2,
+    0x80, 0x09, 0x33, 0x79, 0xe8, 0x42, 0x81, 0x53, 0x6e, 0x90, 0x2a, 0xff, 0x99, 0xd5, 0x74, 0x55,
+    0x6c, 0x10, 0x00, 0xc1, 0x3d, 0xaa, 0x80, 0x09, 0x00, 0xc1, 0x3d, 0xae, 0x80, 0x09, 0x89, 0xf1,
+    0x11, 0x7c, 0x9f, 0xf0, 0x34, 0x11, 0x80, 0x81, 0x25, 0x18, 0x81, 0x86, 0x34, 0x11, 0x80, 0x91,
+    0x25, 0x18, 0x81, 0x7e, 0x34, 0x11, 0x80, 0x83, 0x84, 0x0d, 0x2a, 0xff, 0x97, 0x63, 0x20, 0x00,
+    0x80, 0x84, 0x89, 0xcd, 0x34, 0x11, 0x80, 0x85, 0x84, 0x15, 0x6c, 0x10, 0x00, 0x01, 0x3c, 0x4a,
+    0x80, 0x08, 0x2a, 0xff, 0x97, 0x4b, 0x20, 0x00, 0x80, 0x86, 0x89, 0xb5, 0x34, 0x11, 0x80, 0x87,
+    0x84, 0x15, 0xc0, 0x81, 0x00, 0x01, 0x00, 0x08, 0x87, 0x80, 0x00, 0x40, 0x3c, 0x4a, 0x80, 0x08,
+    0x2a, 0xff, 0x97, 0x33, 0x20, 0x00, 0x80, 0x88, 0x89, 0x9d, 0x65, 0x69, 0x27, 0x18, 0x81, 0xdc,
+    0x64, 0x69, 0x27, 0x18, 0x81, 0xd6, 0xd0, 0xaa, 0x25, 0x18, 0x80, 0xda, 0xd0, 0xad, 0x80, 0xcf,
+    0xd0, 0xa5, 0x80, 0xbf, 0x34, 0x11, 0x80, 0x3b, 0x80, 0x95, 0x34, 0x11, 0x80, 0x7f, 0x80, 0x59,
+    0xd0, 0xa8, 0x80, 0x55, 0xd0, 0xbb, 0x84, 0x11, 0x30, 0x41, 0x30, 0xf0, 0x80, 0x09, 0x88, 0xde,
+    0x00, 0xc2, 0x37, 0xc0, 0x80, 0x09, 0x64, 0xe9, 0x80, 0xd5, 0x36, 0x11, 0x80, 0x7f, 0x80, 0xcf,
+    0x00, 0xc5, 0x3d, 0xa9, 0x80, 0x09, 0x24, 0x69, 0x00, 0xc6, 0x37, 0xd0, 0x80, 0x09, 0x84, 0x0d,
+    0x78, 0x41, 0x91, 0x9e, 0x00, 0xc2, 0x37, 0xd0, 0x80, 0x09, 0x00, 0xc5, 0x3d, 0xa8, 0x80, 0x09,
+    0x24, 0x69, 0x08, 0x06, 0x3c, 0x00, 0x80, 0x08, 0x80, 0xa5, 0xb9, 0xc1, 0x00, 0x08, 0x88, 0x00,
+    0x00, 0x40, 0x27, 0xe8, 0x9f, 0xf0, 0x99, 0x62, 0xc1, 0x81, 0x88, 0x99, 0x00, 0xc6, 0x37, 0xd0,
+    0x80, 0x09, 0x24, 0x6a, 0x00, 0xc5, 0x3d, 0xa8, 0x80, 0x09, 0x84, 0x89, 0x24, 0x69, 0x08, 0x06,
+    0x3c, 0x00, 0x80, 0x08, 0x80, 0x0f, 0xb9, 0xc1, 0xc1, 0x83, 0x99, 0x62, 0x38, 0x40, 0x34, 0x3c,
+    0x80, 0x09, 0x00, 0xc6, 0x37, 0xd0, 0x80, 0x09, 0x78, 0x61, 0x88, 0x68, 0x00, 0xc2, 0x37, 0xd0,
+    0x80, 0x09, 0x00, 0xc5, 0x3d, 0xa8, 0x80, 0x09, 0x24, 0x69, 0xc1, 0x81, 0x80, 0x56, 0x01, 0xc1,
+    0x3d, 0xa9, 0x80, 0x09, 0x08, 0x06, 0x3c, 0x00, 0x80, 0x08, 0xc1, 0x81, 0xb9, 0xc1, 0x27, 0xe8,
+    0x9f, 0xf0, 0x99, 0x63, 0x88, 0x3f, 0x00, 0xc6, 0x37, 0xd0, 0x80, 0x09, 0x91, 0x9e, 0x8f, 0xcc,
+    0x78, 0x41, 0xc0, 0x8a, 0x00, 0x7c, 0x9f, 0xf0, 0x2c, 0x90, 0x00, 0xc5, 0x3d, 0xa8, 0x80, 0x09,
+    0x24, 0x69, 0x00, 0x08, 0x88, 0x80, 0x00, 0x40, 0x08, 0x06, 0x3c, 0x00, 0x80, 0x08, 0x80, 0x0e,
+    0x91, 0x9e, 0xb9, 0xc1, 0x27, 0xe8, 0x9f, 0xf0, 0x99, 0x62, 0xc1, 0x81, 0x6c, 0x10, 0x00, 0x16,
+    0x80, 0x01, 0x00, 0xc1, 0x3d, 0xa9, 0x80, 0x09, 0x00, 0xc6, 0x37, 0xd0, 0x80, 0x09, 0x36, 0x10,
+    0x81, 0xfe, 0x84, 0x13, 0x2a, 0xff, 0x98, 0x87, 0x38, 0x40, 0x33, 0xcd, 0x80, 0x09, 0xc0, 0x8a,
+    0x00, 0x7c, 0x9f, 0xf0, 0x10, 0x7c, 0x9f, 0xf0, 0xd0, 0x2a, 0x84, 0xab, 0x88, 0xa8, 0xc6, 0x81,
+    0x2d, 0x10, 0xc0, 0x84, 0x2c, 0x90, 0xf0, 0x41, 0x38, 0xc0, 0x3d, 0x98, 0x80, 0x09, 0x02, 0xc2,
+    0x37, 0xd8, 0x80, 0x09, 0x02, 0xc0, 0x37, 0xe6, 0x80, 0x09, 0x02, 0xc2, 0x37, 0xd4, 0x80, 0x09,
+    0x32, 0xe4, 0x3c, 0x8a, 0x80, 0x01, 0x02, 0x01, 0x3c, 0x4a, 0x80, 0x08, 0x01, 0xc6, 0x3e, 0x1c,
+    0x80, 0x09, 0x33, 0x1a, 0x8f, 0xff, 0x11, 0x7c, 0x00, 0x08, 0x89, 0x00, 0x00, 0x40, 0x9f, 0xf0,
+    0xc0, 0x81, 0x34, 0x11, 0x80, 0x81, 0x00, 0xc1, 0x3d, 0xae, 0x80, 0x09, 0x84, 0x12, 0x02, 0xc0,
+    0x37, 0xe4, 0x80, 0x09, 0xc0, 0x81, 0x88, 0x10, 0x00, 0xc1, 0x3d, 0xad, 0x80, 0x09, 0xc0, 0x81,
+    0x00, 0xc1, 0x3d, 0xaa, 0x80, 0x09, 0x88, 0x46, 0x6c, 0x10, 0x00, 0xc5, 0x3d, 0xae, 0x80, 0x09,
+    0xd0, 0x21, 0x84, 0x39, 0x01, 0xc6, 0x3e, 0x1c, 0x80, 0x09, 0x00, 0xc7, 0x37, 0xe4, 0x80, 0x09,
+    0x33, 0x19, 0x8f, 0xff, 0x30, 0x71, 0x6c, 0x11, 0x84, 0x09, 0x74, 0x70, 0x31, 0x00, 0x90, 0x00,
+    0x74, 0x70, 0x2c, 0x10, 0xd4, 0x3f, 0x84, 0x15, 0x00, 0xc1, 0x3d, 0xae, 0x80, 0x09, 0x00, 0xc1,
+    0x3d, 0xaa, 0x80, 0x09, 0x00, 0xc1, 0x3d, 0xad, 0x80, 0x09, 0x74, 0x56, 0x30, 0x24, 0x3f, 0x50,
+    0x80, 0x09, 0xe7, 0x70, 0x2a, 0xff, 0x94, 0xb1, 0xe7, 0x50, 0x33, 0xe4, 0x3a, 0x20, 0x00, 0x08,
+    0x89, 0x80, 0x00, 0x40, 0x80, 0x01, 0x00, 0xc5, 0x3d, 0xac, 0x80, 0x09, 0x24, 0x69, 0x31, 0xc1,
+    0x3d, 0xa2, 0x80, 0x09, 0x84, 0x19, 0x30, 0x41, 0x34, 0x31, 0x80, 0x09, 0xf1, 0x42, 0x2a, 0xff,
+    0x97, 0x93, 0xf0, 0x41, 0xc0, 0x81, 0x00, 0xc1, 0x3d, 0xac, 0x80, 0x09, 0x21, 0x00, 0x82, 0x00,
+    0x2a, 0xff, 0x97, 0x8d, 0x38, 0xc0, 0x39, 0xf0, 0x80, 0x09, 0xd0, 0x21, 0x27, 0x18, 0x80, 0xe8,
+    0x27, 0xe8, 0x9f, 0xf0, 0xf8, 0x41, 0x39, 0xc0, 0x35, 0xa8, 0x80, 0x09, 0x32, 0xe4, 0x38, 0x16,
+    0x80, 0x01, 0x38, 0xc0, 0x39, 0xf0, 0x80, 0x09, 0x2c, 0x10, 0xf1, 0xc4, 0x24, 0xe9, 0xc1, 0x85,
+    0x80, 0x51, 0xc0, 0x81, 0x27, 0xe8, 0x9f, 0xf4, 0xf0, 0x41, 0x01, 0x7c, 0x9f, 0xf4, 0x32, 0xe4,
+    0x3c, 0xa2, 0x80, 0x01, 0x09, 0xc6, 0x35, 0xa8, 0x80, 0x09, 0x24, 0x69, 0x38, 0x40, 0x34, 0x18,
+    0x80, 0x09, 0x84, 0x1d, 0x00, 0x08, 0x8a, 0x00, 0x00, 0x40, 0x2b, 0xff, 0x97, 0x33, 0x6c, 0x10,
+    0x00, 0xc1, 0x3d, 0xa8, 0x80, 0x09, 0x00, 0xc1, 0x3d, 0xac, 0x80, 0x09, 0x88, 0x8e, 0x00, 0xc2,
+    0x37, 0xd0, 0x80, 0x09, 0x09, 0xc6, 0x35, 0xa8, 0x80, 0x09, 0x32, 0xe4, 0x38, 0x04, 0x80, 0x01,
+    0x08, 0xc6, 0x37, 0xc0, 0x80, 0x09, 0x24, 0x68, 0x2d, 0x10, 0x38, 0x40, 0x32, 0xea, 0x80, 0x09,
+    0x80, 0x33, 0x2b, 0xff, 0x96, 0xfb, 0x00, 0xc6, 0x37, 0xd0, 0x80, 0x09, 0x24, 0x69, 0x01, 0xc6,
+    0x35, 0xa8, 0x80, 0x09, 0x80, 0x11, 0x30, 0x41, 0x34, 0x20, 0x80, 0x09, 0xf1, 0x42, 0x2a, 0xff,
+    0x96, 0xd9, 0xf0, 0x41, 0x2a, 0xff, 0x96, 0xd9, 0x38, 0x40, 0x34, 0x39, 0x80, 0x09, 0x8f, 0xa8,
+    0x6c, 0x10, 0xf1, 0xc4, 0x24, 0xe9, 0x02, 0xc2, 0x37, 0xd0, 0x80, 0x09, 0x80, 0x27, 0x24, 0xe9,
+    0x3c, 0x44, 0x08, 0xc6, 0x37, 0xc0, 0x80, 0x09, 0x80, 0x1b, 0x00, 0x08, 0x8a, 0x80, 0x00, 0x40,
+    0xc9, 0x40, 0x90, 0xc0, 0xe9, 0x18, 0xb0, 0xcb, 0x24, 0x69, 0x38, 0xc0, 0x35, 0xa8, 0x80, 0x09,
+    0x80, 0x09, 0xc9, 0x40, 0x90, 0xc0, 0x99, 0x63, 0x6c, 0x10, 0x00, 0xc1, 0x3d, 0xac, 0x80, 0x09,
+    0xe7, 0x70, 0x9f, 0x71, 0x31, 0xe4, 0x37, 0xe0, 0x80, 0x01, 0x33, 0x24, 0x3f, 0x30, 0x80, 0x09,
+    0xe7, 0x58, 0x2a, 0xff, 0x96, 0x81, 0x38, 0x40, 0x33, 0x2b, 0x80, 0x09, 0xc1, 0x84, 0x83, 0xe6,
+    0x30, 0x81, 0x34, 0xaf, 0x80, 0x00, 0x2a, 0xff, 0x96, 0x6d, 0x38, 0x40, 0x34, 0x3f, 0x80, 0x09,
+    0x38, 0x00, 0x20, 0x28, 0x80, 0x08, 0xc1, 0x84, 0x50, 0xd0, 0x31, 0x78, 0x9f, 0x00, 0x83, 0xc6,
+    0x7c, 0x68, 0x39, 0x00, 0x20, 0x24, 0x80, 0x08, 0x38, 0x40, 0x33, 0x02, 0x80, 0x09, 0x2a, 0xff,
+    0x96, 0x45, 0x56, 0xd1, 0x27, 0x60, 0xc1, 0x94, 0x83, 0xac, 0x74, 0x56, 0x2a, 0xff, 0x96, 0x37,
+    0x00, 0x08, 0x8b, 0x00, 0x00, 0x40, 0x38, 0x40, 0x34, 0x36, 0x80, 0x09, 0x04, 0x46, 0x2c, 0x64,
+    0x80, 0x09, 0x00, 0x46, 0x2c, 0x68, 0x80, 0x09, 0x01, 0x46, 0x2c, 0x6c, 0x80, 0x09, 0x02, 0x46,
+    0x2c, 0x70, 0x80, 0x09, 0x33, 0x41, 0x31, 0xa0, 0x80, 0x09, 0xf2, 0x45, 0xf1, 0x44, 0xf0, 0x43,
+    0xf4, 0x42, 0x2a, 0xff, 0x96, 0x01, 0xf3, 0x41, 0x30, 0x24, 0x3f, 0x50, 0x80, 0x09, 0xe7, 0x78,
+    0xd4, 0xa1, 0xe7, 0x48, 0xc0, 0x81, 0x84, 0x24, 0xf0, 0x42, 0x27, 0xe9, 0x9f, 0xf8, 0xf9, 0x41,
+    0x32, 0xe4, 0x38, 0x9a, 0x80, 0x01, 0xc1, 0x81, 0x34, 0xf0, 0x9f, 0xff, 0x84, 0x0f, 0x2a, 0xff,
+    0x95, 0xdb, 0x38, 0x40, 0x33, 0x63, 0x80, 0x09, 0x88, 0x3f, 0x32, 0xe4, 0x2d, 0x96, 0x80, 0x08,
+    0x10, 0xfc, 0x9f, 0xfa, 0xd0, 0x26, 0x84, 0x19, 0x00, 0x05, 0x3c, 0x4a, 0x80, 0x08, 0x24, 0x69,
+    0x38, 0x40, 0x33, 0x51, 0x80, 0x09, 0x00, 0x08, 0x8b, 0x80, 0x00, 0x40, 0x80, 0x21, 0x2b, 0xff,
+    0x95, 0xb1, 0x88, 0x1b, 0xd0, 0x21, 0x84, 0x17, 0x00, 0x05, 0x3c, 0x4a, 0x80, 0x08, 0x24, 0x69,
+    0x38, 0x40, 0x33, 0x75, 0x80, 0x09, 0x80, 0x07, 0x2b, 0xff, 0x95, 0x97, 0xe7, 0x68, 0x9f, 0x71,
+    0xc0, 0x81, 0x9f, 0x70, 0x00, 0xc1, 0x3d, 0xa8, 0x80, 0x09, 0x6c, 0x10, 0x9f, 0x70, 0x00, 0xc1,
+    0x3d, 0xa8, 0x80, 0x09, 0x39, 0xe8, 0x24, 0x00, 0xbf, 0xff, 0xe7, 0x50, 0x10, 0x91, 0x38, 0x40,
+    0x31, 0xe7, 0x80, 0x09, 0x2a, 0xff, 0x95, 0x6b, 0x00, 0xc2, 0x37, 0xc8, 0x80, 0x09, 0x01, 0xc6,
+    0x37, 0xc8, 0x80, 0x09, 0x32, 0xc8, 0x84, 0x10, 0x35, 0x79, 0x31, 0x41, 0x33, 0xfb, 0x80, 0x09,
+    0xf2, 0x43, 0xf0, 0x42, 0x2a, 0xff, 0x95, 0x45, 0xf1, 0x41, 0xe7, 0x70, 0x9f, 0x71, 0x2b, 0xff,
+    0x93, 0x4b, 0xe7, 0x50, 0xf0, 0xcb, 0xd4, 0x21, 0x84, 0x2e, 0xee, 0xe8, 0x00, 0x08, 0x8c, 0x00,
+    0x00, 0x40, 0xb9, 0xc9, 0x32, 0xe4, 0x38, 0x04, 0x80, 0x01, 0xe8, 0xee, 0x24, 0x68, 0x3c, 0x44,
+    0x31, 0x41, 0x33, 0xde, 0x80, 0x09, 0x84, 0x55, 0xc8, 0x40, 0xf1, 0x41, 0xe8, 0x1e, 0xb1, 0xc1,
+    0xb0, 0xc2, 0xf0, 0x43, 0x2a, 0xff, 0x95, 0x0b, 0xf1, 0x42, 0x88, 0x41, 0x2a, 0xff, 0x95, 0x09,
+    0x38, 0x40, 0x33, 0xef, 0x80, 0x09, 0x10, 0x96, 0xe9, 0xee, 0x24, 0x69, 0xef, 0xee, 0x80, 0x2d,
+    0x18, 0x97, 0xc9, 0x4e, 0x90, 0xc0, 0x90, 0xf8, 0x34, 0x10, 0x80, 0x2e, 0x80, 0x15, 0xb1, 0xf9,
+    0x30, 0x41, 0x34, 0x2c, 0x80, 0x09, 0xf1, 0x42, 0x2a, 0xff, 0x94, 0xd7, 0xf0, 0x41, 0xc9, 0x46,
+    0xef, 0x50, 0xe9, 0x50, 0x50, 0x91, 0x64, 0x69, 0x85, 0xd9, 0x08, 0xc6, 0x37, 0xc0, 0x80, 0x09,
+    0x90, 0xc0, 0xe8, 0xae, 0x84, 0x0d, 0x2a, 0xff, 0x94, 0xbf, 0x38, 0x40, 0x32, 0x0e, 0x80, 0x09,
+    0x30, 0x24, 0x00, 0x08, 0x8c, 0x80, 0x00, 0x40, 0x3f, 0x50, 0x80, 0x09, 0xe7, 0x70, 0x33, 0x24,
+    0x3f, 0x30, 0x80, 0x09, 0x37, 0x51, 0xd0, 0xa1, 0xee, 0xe8, 0x84, 0x0e, 0xe7, 0x48, 0x2a, 0xff,
+    0x94, 0x9d, 0x38, 0x40, 0x32, 0x99, 0x80, 0x09, 0xf6, 0x41, 0xe9, 0xee, 0x83, 0x4e, 0x08, 0xc6,
+    0x37, 0xc0, 0x80, 0x09, 0x30, 0x24, 0x3f, 0x50, 0x80, 0x09, 0xe7, 0x68, 0x33, 0x24, 0x3f, 0x30,
+    0x80, 0x09, 0x37, 0x51, 0xd0, 0xa1, 0xee, 0xe8, 0x84, 0x0e, 0xe7, 0x48, 0x2a, 0xff, 0x94, 0x6f,
+    0x38, 0xc0, 0x3d, 0x44, 0x80, 0x09, 0xf6, 0x41, 0xe9, 0xee, 0x83, 0x20, 0x38, 0x40, 0x2f, 0xf0,
+    0x80, 0x09, 0x30, 0x24, 0x3f, 0x50, 0x80, 0x09, 0xe7, 0x68, 0xe7, 0x50, 0x2a, 0xff, 0x94, 0x4f,
+    0x38, 0x40, 0x32, 0xb6, 0x80, 0x09, 0x01, 0xc6, 0x3e, 0x0c, 0x80, 0x09, 0x30, 0x41, 0x33, 0xbc,
+    0x80, 0x09, 0xf1, 0x42, 0x2a, 0xff, 0x94, 0x31, 0x00, 0x08, 0x8d, 0x00, 0x00, 0x40, 0xf0, 0x41,
+    0x01, 0xc6, 0x3e, 0x00, 0x80, 0x09, 0x30, 0x41, 0x33, 0xab, 0x80, 0x09, 0xf1, 0x42, 0x2a, 0xff,
+    0x94, 0x1d, 0xf0, 0x41, 0x02, 0xc6, 0x3d, 0xf8, 0x80, 0x09, 0x00, 0xc6, 0x3d, 0xfc, 0x80, 0x09,
+    0x31, 0x41, 0x32, 0x58, 0x80, 0x09, 0xf2, 0x43, 0xf0, 0x42, 0x2a, 0xff, 0x94, 0x01, 0xf1, 0x41,
+    0x00, 0xc6, 0x3e, 0x48, 0x80, 0x09, 0x21, 0x00, 0x83, 0xe8, 0x32, 0xe4, 0x3c, 0x4e, 0x80, 0x01,
+    0x64, 0x60, 0x34, 0xd0, 0x00, 0xc6, 0x3e, 0x0c, 0x80, 0x09, 0x32, 0xe4, 0x3c, 0x4e, 0x80, 0x01,
+    0x64, 0x60, 0x32, 0xe4, 0x3c, 0x4e, 0x80, 0x01, 0x35, 0x50, 0xc1, 0x8a, 0x65, 0x60, 0x32, 0xe4,
+    0x3c, 0x60, 0x80, 0x01, 0x35, 0x50, 0x34, 0x52, 0xc1, 0x8a, 0x31, 0x41, 0x32, 0x34, 0x80, 0x09,
+    0xf0, 0x43, 0xf2, 0x42, 0x2a, 0xff, 0x93, 0xb7, 0xf1, 0x41, 0x00, 0xc6, 0x3e, 0x30, 0x00, 0x08,
+    0x8d, 0x80, 0x00, 0x40, 0x80, 0x09, 0x21, 0x00, 0x83, 0xe8, 0x32, 0xe4, 0x3c, 0x4e, 0x80, 0x01,
+    0x64, 0x60, 0x34, 0xd0, 0x00, 0xc6, 0x3e, 0x3c, 0x80, 0x09, 0x32, 0xe4, 0x3c, 0x4e, 0x80, 0x01,
+    0x64, 0x60, 0x36, 0x50, 0xc1, 0x8a, 0x20, 0x00, 0x83, 0xe8, 0x6c, 0x7d, 0x32, 0x24, 0x3f, 0xb0,
+    0x80, 0x09, 0x74, 0x54, 0x26, 0x60, 0x35, 0x50, 0xc1, 0x8a, 0x32, 0x44, 0x20, 0x20, 0x80, 0x09,
+    0x74, 0x54, 0x31, 0x41, 0x32, 0x79, 0x80, 0x09, 0xf0, 0x43, 0xf2, 0x42, 0x2a, 0xff, 0x93, 0x65,
+    0xf1, 0x41, 0x00, 0xc6, 0x3e, 0x48, 0x80, 0x09, 0x30, 0xc9, 0x87, 0x82, 0x30, 0x41, 0x33, 0x17,
+    0x80, 0x09, 0xf1, 0x42, 0x2a, 0xff, 0x93, 0x4d, 0xf0, 0x41, 0x2a, 0xff, 0x93, 0x4d, 0x38, 0x40,
+    0x34, 0x0f, 0x80, 0x09, 0xe7, 0x70, 0x9f, 0x71, 0x30, 0x41, 0x2f, 0xf0, 0x80, 0x09, 0x9f, 0x70,
+    0x00, 0xc2, 0x37, 0xc0, 0x00, 0x08, 0x8e, 0x00, 0x00, 0x40, 0x80, 0x09, 0x30, 0xe4, 0x2e, 0x60,
+    0x80, 0x08, 0x74, 0x79, 0x33, 0x24, 0x3f, 0x30, 0x80, 0x09, 0xb8, 0xc1, 0x90, 0xc0, 0x90, 0xf8,
+    0x3c, 0x10, 0x80, 0x30, 0x32, 0xe4, 0x32, 0x66, 0x80, 0x08, 0x74, 0x78, 0x24, 0x69, 0x37, 0x50,
+    0x38, 0x40, 0x33, 0x3e, 0x80, 0x09, 0x80, 0x0b, 0x2b, 0xff, 0x93, 0x05, 0x74, 0x56, 0x64, 0x60,
+    0x2a, 0xff, 0x9c, 0x6f, 0xc1, 0x94, 0x2a, 0xff, 0x92, 0xf7, 0x38, 0x40, 0x34, 0x41, 0x80, 0x09,
+    0x31, 0x24, 0x3f, 0x50, 0x80, 0x09, 0x2c, 0x90, 0x39, 0xe8, 0x3c, 0x00, 0xbf, 0xff, 0xcc, 0x56,
+    0x10, 0x91, 0xcd, 0x57, 0x31, 0x28, 0x9f, 0x00, 0xdc, 0x38, 0x24, 0x6e, 0xca, 0x87, 0xc9, 0x40,
+    0xe7, 0x48, 0xe9, 0x61, 0xea, 0x89, 0x84, 0x0c, 0xf9, 0x42, 0xc9, 0x48, 0x09, 0x00, 0xa4, 0x00,
+    0xf0, 0x42, 0x09, 0x86, 0x3a, 0x58, 0x80, 0x09, 0xf0, 0xc2, 0x00, 0x08, 0x8e, 0x80, 0x00, 0x40,
+    0x1a, 0x91, 0x80, 0x02, 0x0c, 0x0a, 0xa0, 0x01, 0x80, 0x10, 0x09, 0x00, 0xa2, 0x00, 0x09, 0x10,
+    0xa0, 0x10, 0xc1, 0x81, 0x09, 0x10, 0xa0, 0x01, 0x38, 0xc1, 0x0c, 0x0a, 0xa0, 0x02, 0x80, 0x0b,
+    0x3c, 0xd2, 0x09, 0x10, 0xa0, 0x20, 0xdc, 0x19, 0x3a, 0x00, 0x20, 0x48, 0x80, 0x08, 0x09, 0x40,
+    0xb8, 0x00, 0x51, 0xd2, 0x0c, 0x41, 0xa0, 0x00, 0x80, 0x25, 0x21, 0xa0, 0x9f, 0xff, 0x35, 0x51,
+    0x13, 0x91, 0x80, 0xa0, 0xdc, 0x83, 0x01, 0x01, 0x80, 0xa0, 0x09, 0x86, 0x3a, 0x58, 0x80, 0x09,
+    0x90, 0xc0, 0x11, 0x91, 0x80, 0xa2, 0xdd, 0x01, 0x02, 0x01, 0x80, 0xa2, 0x2f, 0x10, 0x09, 0x86,
+    0x3a, 0x58, 0x80, 0x09, 0xe7, 0x68, 0x13, 0x91, 0x80, 0xa0, 0x36, 0xc9, 0x80, 0x4e, 0x3c, 0xd9,
+    0x12, 0x91, 0x80, 0xa2, 0x36, 0xcb, 0x80, 0x4f, 0x7d, 0xd8, 0xdc, 0x1b, 0xdc, 0x19, 0x34, 0xc9,
+    0x00, 0x08, 0x8f, 0x00, 0x00, 0x40, 0x80, 0x4e, 0x34, 0xca, 0x80, 0x4f, 0x3d, 0x5a, 0x7c, 0xdb,
+    0xdc, 0x1a, 0xdc, 0x19, 0x40, 0x98, 0x09, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0, 0x10, 0x91,
+    0x80, 0xa2, 0x31, 0x19, 0x80, 0x03, 0x3c, 0xd4, 0x17, 0x91, 0x80, 0xa0, 0x30, 0xcb, 0x80, 0x86,
+    0x30, 0xca, 0x80, 0x84, 0x3d, 0x46, 0x7d, 0xc4, 0x30, 0xc8, 0x80, 0x82, 0xd8, 0x10, 0xdc, 0x19,
+    0x3e, 0xcc, 0x80, 0x84, 0x3e, 0xc9, 0x80, 0x82, 0x3c, 0xc8, 0x7e, 0x42, 0x3e, 0xcd, 0x80, 0x86,
+    0x3f, 0x1f, 0x80, 0x03, 0x7f, 0xcc, 0xdc, 0x1f, 0xdc, 0x19, 0xdc, 0x1a, 0xdc, 0x1b, 0xdc, 0x1c,
+    0xdc, 0x1d, 0x00, 0x90, 0xcd, 0x5f, 0x09, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0, 0x10, 0x91,
+    0x80, 0x10, 0x31, 0x18, 0x80, 0xff, 0x00, 0x10, 0x80, 0x05, 0x06, 0x10, 0x80, 0x04, 0x09, 0x86,
+    0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0, 0x00, 0x08, 0x8f, 0x80, 0x00, 0x40, 0x10, 0x91, 0x80, 0x12,
+    0x31, 0x18, 0x80, 0xff, 0x00, 0x10, 0x80, 0x07, 0x06, 0x10, 0x80, 0x06, 0x09, 0x86, 0x3a, 0x58,
+    0x80, 0x09, 0xcc, 0x5e, 0x10, 0x91, 0x80, 0x38, 0x31, 0x18, 0x80, 0xff, 0x00, 0x10, 0x80, 0x09,
+    0x09, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0, 0x10, 0x91, 0x80, 0x38, 0x7c, 0x68, 0x00, 0x10,
+    0x80, 0x08, 0x09, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0, 0x10, 0x91, 0x80, 0x3a, 0x31, 0x18,
+    0x80, 0xff, 0x00, 0x10, 0x80, 0x0b, 0x09, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0, 0x10, 0x91,
+    0x80, 0x3a, 0x7c, 0x68, 0x9f, 0x70, 0x00, 0x10, 0x80, 0x0a, 0x38, 0xe8, 0x3c, 0x00, 0xbf, 0xff,
+    0x24, 0x60, 0x00, 0xa0, 0x31, 0xf6, 0x80, 0x09, 0x34, 0xd0, 0x50, 0x90, 0x31, 0x28, 0x9f, 0x00,
+    0xdc, 0x38, 0x32, 0xe4, 0x3c, 0x4e, 0x80, 0x01, 0x3e, 0x10, 0x80, 0x18, 0x00, 0x08, 0x90, 0x00,
+    0x00, 0x40, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0xc9, 0x40, 0x10, 0x90, 0x80, 0xb0, 0x31, 0x19,
+    0x80, 0x0f, 0x3c, 0xc8, 0xe9, 0x61, 0xc9, 0x48, 0xdc, 0x19, 0x9f, 0x70, 0x64, 0x60, 0x0a, 0x86,
+    0x3a, 0x58, 0x80, 0x09, 0x31, 0x19, 0x27, 0xfd, 0xbf, 0xff, 0x12, 0x92, 0x80, 0x64, 0xd9, 0x12,
+    0x10, 0x92, 0x80, 0x60, 0xdd, 0x18, 0x0c, 0x80, 0xa0, 0x00, 0xdd, 0x01, 0x80, 0x0a, 0x09, 0x02,
+    0xa2, 0x00, 0x09, 0x02, 0xa0, 0x02, 0x02, 0x98, 0x31, 0x19, 0x27, 0xff, 0xbf, 0xff, 0x0a, 0x86,
+    0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0, 0x10, 0x92, 0x80, 0x62, 0x40, 0x10, 0x0a, 0x86, 0x3a, 0x58,
+    0x80, 0x09, 0x90, 0xc0, 0x10, 0x92, 0x80, 0x68, 0xb0, 0x02, 0x0a, 0x86, 0x3a, 0x58, 0x80, 0x09,
+    0x90, 0xc0, 0x10, 0x92, 0x80, 0x6a, 0xb0, 0x03, 0x0a, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0,
+    0x10, 0x92, 0x00, 0x08, 0x90, 0x80, 0x00, 0x40, 0x80, 0x6c, 0xb0, 0x04, 0x0a, 0x86, 0x3a, 0x58,
+    0x80, 0x09, 0x90, 0xc0, 0x10, 0x92, 0x80, 0x6e, 0xb0, 0x05, 0x0a, 0x86, 0x3a, 0x58, 0x80, 0x09,
+    0x90, 0xc0, 0x10, 0x92, 0x80, 0x3c, 0xb0, 0x06, 0x0a, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0,
+    0x10, 0x92, 0x80, 0x3e, 0xb0, 0x07, 0x0a, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0, 0x10, 0x92,
+    0x80, 0x40, 0x00, 0x00, 0x80, 0x10, 0x0a, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0, 0x10, 0x92,
+    0x80, 0x42, 0x00, 0x00, 0x80, 0x12, 0x0a, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0, 0x10, 0x92,
+    0x80, 0x14, 0x00, 0x00, 0x80, 0x14, 0x0a, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0, 0x10, 0x92,
+    0x80, 0x16, 0x00, 0x00, 0x80, 0x16, 0x0a, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0, 0x10, 0x92,
+    0x80, 0x18, 0x00, 0x00, 0x80, 0x18, 0x0a, 0x86, 0x00, 0x08, 0x91, 0x00, 0x00, 0x40, 0x3a, 0x58,
+    0x80, 0x09, 0x90, 0xc0, 0x10, 0x92, 0x80, 0x1a, 0x00, 0x00, 0x80, 0x1a, 0x08, 0x86, 0x3a, 0x58,
+    0x80, 0x09, 0x90, 0xc0, 0x12, 0x90, 0x80, 0x7c, 0xd9, 0x12, 0x10, 0x90, 0x80, 0x78, 0xdd, 0x18,
+    0x0c, 0x80, 0xa0, 0x00, 0xdd, 0x01, 0x80, 0x0a, 0x09, 0x02, 0xa2, 0x00, 0x09, 0x02, 0xa0, 0x02,
+    0x42, 0x99, 0x0a, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0, 0x10, 0x92, 0x80, 0x7a, 0x40, 0x11,
+    0x0a, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0, 0x10, 0x92, 0x80, 0x80, 0xb0, 0x0a, 0x0a, 0x86,
+    0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0, 0x10, 0x92, 0x80, 0x82, 0xb0, 0x0b, 0x0a, 0x86, 0x3a, 0x58,
+    0x80, 0x09, 0x90, 0xc0, 0x10, 0x92, 0x80, 0x84, 0xb0, 0x0c, 0x0a, 0x86, 0x3a, 0x58, 0x80, 0x09,
+    0x90, 0xc0, 0x10, 0x92, 0x80, 0x86, 0xb0, 0x0d, 0x0a, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x00, 0x08,
+    0x91, 0x80, 0x00, 0x40, 0x90, 0xc0, 0x10, 0x92, 0x80, 0x44, 0xb0, 0x0e, 0x0a, 0x86, 0x3a, 0x58,
+    0x80, 0x09, 0x90, 0xc0, 0x10, 0x92, 0x80, 0x46, 0xb0, 0x0f, 0x0a, 0x86, 0x3a, 0x58, 0x80, 0x09,
+    0x90, 0xc0, 0x10, 0x92, 0x80, 0x48, 0x00, 0x01, 0x80, 0x10, 0x0a, 0x86, 0x3a, 0x58, 0x80, 0x09,
+    0x90, 0xc0, 0x10, 0x92, 0x80, 0x4a, 0x00, 0x01, 0x80, 0x12, 0x0a, 0x86, 0x3a, 0x58, 0x80, 0x09,
+    0x90, 0xc0, 0x10, 0x92, 0x80, 0x1c, 0x00, 0x01, 0x80, 0x14, 0x0a, 0x86, 0x3a, 0x58, 0x80, 0x09,
+    0x90, 0xc0, 0x10, 0x92, 0x80, 0x1e, 0x00, 0x01, 0x80, 0x16, 0x0a, 0x86, 0x3a, 0x58, 0x80, 0x09,
+    0x90, 0xc0, 0x10, 0x92, 0x80, 0x20, 0x00, 0x01, 0x80, 0x18, 0x0a, 0x86, 0x3a, 0x58, 0x80, 0x09,
+    0x90, 0xc0, 0x10, 0x92, 0x80, 0x22, 0x9f, 0x70, 0x00, 0x01, 0x80, 0x1a, 0x39, 0xe8, 0x3c, 0x0c,
+    0xbf, 0xff, 0x30, 0xf9, 0x00, 0x08, 0x92, 0x00, 0x00, 0x40, 0x3c, 0xcc, 0xbf, 0x59, 0x00, 0x91,
+    0x38, 0xa8, 0x3c, 0x00, 0xbf, 0xff, 0x30, 0x01, 0x20, 0x20, 0x80, 0x20, 0x9f, 0x70, 0x40, 0x90,
+    0x09, 0x86, 0x3a, 0x54, 0x80, 0x09, 0x38, 0xa8, 0x3c, 0x20, 0xbf, 0xff, 0x10, 0x91, 0x80, 0x28,
+    0x38, 0x41, 0xe7, 0x48, 0x00, 0x01, 0x80, 0x28, 0x50, 0x90, 0x00, 0xc2, 0x3e, 0x2c, 0x80, 0x09,
+    0x9f, 0x7d, 0x00, 0x86, 0x33, 0x40, 0x80, 0x09, 0x24, 0x69, 0xc0, 0xa2, 0x80, 0x2b, 0x33, 0xe4,
+    0x3a, 0x68, 0x80, 0x01, 0xc1, 0x84, 0x32, 0xe4, 0x3a, 0x62, 0x80, 0x01, 0xc0, 0xa2, 0x32, 0x44,
+    0x34, 0xf8, 0x80, 0x08, 0xc0, 0x81, 0x32, 0x44, 0x34, 0xf8, 0x80, 0x08, 0xc0, 0x81, 0x6c, 0x10,
+    0x00, 0x82, 0x33, 0x40, 0x80, 0x09, 0x27, 0x84, 0x88, 0xb8, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc8,
+    0x00, 0xa6, 0x28, 0xd8, 0x80, 0x09, 0x24, 0x69, 0x38, 0xc8, 0x00, 0x08, 0x92, 0x80, 0x00, 0x40,
+    0x30, 0x00, 0xbf, 0xff, 0x80, 0x05, 0x40, 0x90, 0x00, 0xa6, 0x28, 0xe0, 0x80, 0x09, 0x24, 0x69,
+    0x38, 0xc8, 0x34, 0x00, 0xbf, 0xff, 0x80, 0x05, 0x40, 0x90, 0x01, 0xa6, 0x35, 0x98, 0x80, 0x09,
+    0x24, 0xe9, 0x38, 0xc8, 0x24, 0x00, 0xbf, 0xff, 0x80, 0x0d, 0x01, 0x90, 0xc0, 0x81, 0x00, 0xa0,
+    0x37, 0xac, 0x80, 0x09, 0x6c, 0x10, 0x00, 0xa2, 0x35, 0x98, 0x80, 0x09, 0x00, 0xa2, 0x28, 0xe0,
+    0x80, 0x09, 0x00, 0xa2, 0x28, 0xd8, 0x80, 0x09, 0x9f, 0x7c, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09,
+    0xc0, 0x81, 0xb8, 0x83, 0x0d, 0x08, 0xa0, 0x20, 0x80, 0x09, 0x00, 0x01, 0x3a, 0x95, 0x80, 0x0a,
+    0x32, 0xe4, 0x39, 0x4e, 0x80, 0x01, 0xc0, 0x81, 0x30, 0xe1, 0x39, 0x90, 0x80, 0x01, 0xf0, 0x41,
+    0xc1, 0x82, 0x32, 0xe4, 0x39, 0x5a, 0x80, 0x01, 0xc0, 0x81, 0x2c, 0x10, 0xe7, 0x68, 0x9f, 0x70,
+    0x00, 0x08, 0x93, 0x00, 0x00, 0x40, 0x00, 0x81, 0x3a, 0x5e, 0x80, 0x09, 0x08, 0xc6, 0x3e, 0x1c,
+    0x80, 0x09, 0x39, 0xa8, 0x3c, 0x20, 0xbf, 0xff, 0x00, 0xc5, 0x3e, 0x59, 0x80, 0x09, 0x34, 0x60,
+    0x11, 0x91, 0xe8, 0x41, 0x24, 0x69, 0xe7, 0x48, 0x08, 0xc2, 0x3e, 0x1c, 0x80, 0x09, 0x80, 0x3e,
+    0x01, 0xc2, 0x3e, 0x18, 0x80, 0x09, 0x64, 0x6d, 0x84, 0x34, 0x00, 0xc1, 0x3e, 0x59, 0x80, 0x09,
+    0x32, 0xe4, 0x39, 0x4e, 0x80, 0x01, 0xc0, 0x81, 0x30, 0x81, 0x32, 0x16, 0x80, 0x08, 0xf0, 0x41,
+    0xc1, 0x85, 0x32, 0xe4, 0x39, 0x5a, 0x80, 0x01, 0xc0, 0x81, 0xc0, 0x81, 0x00, 0x7c, 0x9f, 0xff,
+    0x32, 0xe4, 0x2b, 0xc0, 0x80, 0x08, 0x31, 0xe1, 0x26, 0x64, 0x80, 0x00, 0x33, 0x44, 0x3b, 0x8c,
+    0x80, 0x08, 0x33, 0xc4, 0x3e, 0xaa, 0x80, 0x08, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0,
+    0x10, 0x90, 0x80, 0x26, 0x64, 0x69, 0x00, 0x08, 0x93, 0x80, 0x00, 0x40, 0x84, 0x25, 0x10, 0x90,
+    0x80, 0x24, 0x24, 0x69, 0x2c, 0x10, 0x39, 0x00, 0x23, 0xd8, 0x80, 0x0a, 0x84, 0x15, 0x27, 0x04,
+    0x80, 0x60, 0x38, 0x00, 0x21, 0x98, 0x80, 0x0a, 0x92, 0xd0, 0x40, 0x19, 0x40, 0x18, 0x88, 0x09,
+    0x33, 0xc4, 0x33, 0xc0, 0x80, 0x08, 0xe7, 0x68, 0x9f, 0x71, 0x3b, 0xa8, 0x3c, 0x24, 0xbf, 0xff,
+    0x38, 0xa8, 0x3c, 0x20, 0xbf, 0xff, 0x59, 0x93, 0x51, 0x90, 0x52, 0x93, 0xca, 0x42, 0x90, 0xc0,
+    0xea, 0xa9, 0x85, 0xf5, 0x2c, 0x10, 0xc3, 0xa0, 0xd5, 0x13, 0xd4, 0xc2, 0x9f, 0x70, 0x64, 0xe0,
+    0x2c, 0x10, 0xd0, 0x21, 0x84, 0x24, 0xe7, 0x48, 0x31, 0xe9, 0x3f, 0xff, 0xbf, 0xff, 0x01, 0xc2,
+    0x3e, 0x24, 0x80, 0x09, 0x00, 0xc2, 0x3e, 0x40, 0x80, 0x09, 0x00, 0xc2, 0x3e, 0x38, 0x80, 0x09,
+    0x89, 0x7c, 0x00, 0xc2, 0x3e, 0x20, 0x80, 0x09, 0xc0, 0x81, 0x04, 0xc6, 0x00, 0x08, 0x94, 0x00,
+    0x00, 0x40, 0x3e, 0x38, 0x80, 0x09, 0xd6, 0x40, 0x83, 0xa8, 0x04, 0xc2, 0x3e, 0x38, 0x80, 0x09,
+    0x02, 0xc6, 0x3e, 0x20, 0x80, 0x09, 0x25, 0x69, 0xf1, 0x41, 0x84, 0x18, 0xf0, 0x42, 0x38, 0xc8,
+    0x3c, 0x00, 0xbf, 0xff, 0x90, 0xc0, 0x58, 0x90, 0x90, 0xc0, 0xe8, 0x41, 0x08, 0xc2, 0x3e, 0x20,
+    0x80, 0x09, 0x02, 0xc6, 0x3e, 0x40, 0x80, 0x09, 0xd1, 0x22, 0x80, 0x5f, 0xd1, 0x21, 0x80, 0x19,
+    0x25, 0x69, 0x2c, 0x90, 0xc0, 0x81, 0x84, 0xdd, 0x01, 0xc2, 0x3e, 0x50, 0x80, 0x09, 0x88, 0xd4,
+    0x00, 0xc2, 0x3e, 0x40, 0x80, 0x09, 0x9f, 0x7d, 0x35, 0xd1, 0x04, 0xc6, 0x3d, 0xb4, 0x80, 0x09,
+    0x26, 0x60, 0xc2, 0x81, 0xda, 0x04, 0xd6, 0x42, 0xd5, 0xc4, 0x34, 0x53, 0x01, 0xc6, 0x3e, 0x50,
+    0x80, 0x09, 0x38, 0xc1, 0x24, 0x60, 0x04, 0xc6, 0x3e, 0x24, 0x80, 0x09, 0x26, 0x60, 0x01, 0xc2,
+    0x3e, 0x50, 0x00, 0x08, 0x94, 0x80, 0x00, 0x40, 0x80, 0x09, 0x36, 0x11, 0x80, 0x32, 0x6c, 0x7d,
+    0x84, 0x98, 0x04, 0xc2, 0x3e, 0x24, 0x80, 0x09, 0x9f, 0x7c, 0x8f, 0xba, 0xc0, 0x82, 0x03, 0xc6,
+    0x3d, 0xb4, 0x80, 0x09, 0x25, 0xe0, 0x39, 0xc8, 0x3c, 0x00, 0xbf, 0xff, 0xd9, 0x83, 0x19, 0x91,
+    0xc2, 0x81, 0xd5, 0xc2, 0xd4, 0xc3, 0x24, 0xe0, 0x05, 0xc6, 0x3e, 0x24, 0x80, 0x09, 0x26, 0xe0,
+    0x08, 0xc6, 0x3e, 0x20, 0x80, 0x09, 0x6d, 0x7d, 0xe9, 0xa8, 0x84, 0x5e, 0x05, 0xc2, 0x3e, 0x24,
+    0x80, 0x09, 0x3a, 0x80, 0x80, 0x05, 0x38, 0x80, 0x80, 0x05, 0x36, 0x81, 0x80, 0x05, 0xd8, 0x10,
+    0xd4, 0x41, 0x01, 0xc6, 0x3e, 0x34, 0x80, 0x09, 0xd4, 0x41, 0x32, 0xe4, 0x3c, 0x4e, 0x80, 0x01,
+    0x24, 0x60, 0x31, 0x21, 0x26, 0xc8, 0x80, 0x02, 0x2c, 0x90, 0xc8, 0x40, 0x29, 0x00, 0x83, 0xe8,
+    0x3b, 0x00, 0x20, 0xdc, 0x80, 0x08, 0x3a, 0xc8, 0x00, 0x08, 0x95, 0x00, 0x00, 0x40, 0x3c, 0x00,
+    0xbf, 0xff, 0xe9, 0x38, 0x09, 0x13, 0x01, 0xc2, 0x3e, 0x38, 0x80, 0x09, 0x18, 0x92, 0x01, 0xc2,
+    0x3e, 0x34, 0x80, 0x09, 0x90, 0xc0, 0xe8, 0x41, 0x08, 0xc2, 0x3e, 0x20, 0x80, 0x09, 0x9f, 0x7d,
+    0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0, 0xb8, 0x83, 0x0c, 0x08, 0xa0, 0x01, 0x80, 0x2f,
+    0x33, 0xc4, 0x28, 0x42, 0x80, 0x08, 0x64, 0x69, 0x80, 0x25, 0x2b, 0xff, 0x9e, 0x73, 0x76, 0xd1,
+    0x9f, 0x78, 0x2b, 0xff, 0x9e, 0x6b, 0xd9, 0x85, 0xc2, 0x81, 0xd5, 0xc2, 0x00, 0xc6, 0x3e, 0x34,
+    0x80, 0x09, 0xd4, 0xc3, 0xd4, 0x41, 0x00, 0xc2, 0x3e, 0x34, 0x80, 0x09, 0x9f, 0x7c, 0xf1, 0xc1,
+    0xf0, 0xc2, 0x01, 0xc2, 0x3d, 0xb4, 0x80, 0x09, 0x00, 0xc2, 0x3d, 0xb0, 0x80, 0x09, 0xe7, 0x68,
+    0x9f, 0x71, 0x30, 0x84, 0x33, 0xd4, 0x80, 0x08, 0x6c, 0x10, 0x36, 0x50, 0xc5, 0x86, 0x00, 0x08,
+    0x95, 0x80, 0x00, 0x40, 0x20, 0xe0, 0x9f, 0xa6, 0x2c, 0x7c, 0x34, 0x55, 0x08, 0x66, 0x3f, 0xc4,
+    0x80, 0x04, 0x74, 0xe4, 0x6d, 0x7d, 0x74, 0xe5, 0x6c, 0x31, 0x7c, 0x41, 0xca, 0x40, 0x90, 0xc0,
+    0xea, 0x18, 0x9f, 0x70, 0x50, 0xd2, 0x33, 0x24, 0x3f, 0x30, 0x80, 0x09, 0x32, 0xc4, 0x39, 0x96,
+    0x80, 0x08, 0xee, 0xe8, 0x06, 0x04, 0x38, 0x70, 0x80, 0x0a, 0x3f, 0x63, 0xe8, 0xee, 0x32, 0x84,
+    0x3f, 0xa0, 0x80, 0x08, 0x09, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x2c, 0x10, 0x2f, 0x90, 0x38, 0xe0,
+    0x3f, 0x58, 0x80, 0x09, 0x27, 0x04, 0x80, 0x60, 0xb0, 0x71, 0x92, 0xc8, 0x47, 0x18, 0x3f, 0x44,
+    0xc1, 0x83, 0x2e, 0x0e, 0x80, 0x7e, 0x34, 0x57, 0x09, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x32, 0xa4,
+    0x2c, 0x40, 0x80, 0x08, 0xcf, 0x41, 0x32, 0xa4, 0x28, 0xfa, 0x80, 0x08, 0x34, 0x57, 0x09, 0x86,
+    0x3a, 0x58, 0x80, 0x09, 0x00, 0x08, 0x96, 0x00, 0x00, 0x40, 0x2c, 0x10, 0x3b, 0xc1, 0x06, 0x0e,
+    0xcf, 0x49, 0x38, 0xe1, 0x40, 0x16, 0x24, 0xea, 0xee, 0x44, 0x40, 0x16, 0x81, 0xd0, 0x2e, 0x0e,
+    0x80, 0x92, 0x39, 0x00, 0x20, 0xf8, 0x80, 0x08, 0x30, 0x24, 0x3f, 0x50, 0x80, 0x09, 0x40, 0x11,
+    0x31, 0x84, 0x3d, 0x30, 0x80, 0x08, 0x33, 0x24, 0x3f, 0x30, 0x80, 0x09, 0x27, 0x0a, 0x80, 0x50,
+    0xe7, 0xea, 0xfa, 0xdc, 0xfb, 0xdb, 0x15, 0x52, 0xc8, 0x4e, 0x17, 0x53, 0xf5, 0x43, 0x32, 0xc4,
+    0x39, 0x96, 0x80, 0x08, 0xef, 0xe9, 0x1e, 0x90, 0x0a, 0xe6, 0x20, 0x24, 0x80, 0x09, 0x0b, 0x86,
+    0x3a, 0x58, 0x80, 0x09, 0xea, 0x41, 0x0a, 0xe2, 0x20, 0x24, 0x80, 0x09, 0x11, 0x93, 0x81, 0x02,
+    0x10, 0x93, 0x81, 0x00, 0xd8, 0x91, 0xdc, 0x98, 0x0c, 0x11, 0xa0, 0x08, 0xf1, 0x44, 0x80, 0x2e,
+    0xc9, 0x46, 0xc0, 0x81, 0x00, 0x16, 0x81, 0x1e, 0x00, 0x16, 0x00, 0x08, 0x96, 0x80, 0x00, 0x40,
+    0x80, 0x8a, 0x00, 0x16, 0x81, 0xb2, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x30, 0xf8, 0x3f, 0xff,
+    0xbf, 0xf7, 0xdc, 0x01, 0xc2, 0xf7, 0xf0, 0x44, 0x10, 0x90, 0x81, 0x02, 0xdd, 0x00, 0x02, 0x00,
+    0x81, 0x02, 0xff, 0x41, 0x32, 0x84, 0x3f, 0x50, 0x80, 0x08, 0xe8, 0xee, 0xf9, 0xdd, 0xf9, 0x45,
+    0x83, 0x76, 0x10, 0x11, 0x11, 0x06, 0x82, 0xa0, 0xf1, 0xc4, 0x0c, 0x01, 0xa0, 0x02, 0x34, 0x51,
+    0x00, 0x06, 0x82, 0xa0, 0x26, 0x18, 0x86, 0x46, 0xf5, 0xc3, 0x0c, 0x00, 0xa0, 0x01, 0x80, 0x0d,
+    0x33, 0xa4, 0x23, 0x70, 0x80, 0x08, 0x21, 0x18, 0x86, 0x34, 0x31, 0x08, 0x82, 0x00, 0x24, 0x61,
+    0x2f, 0x10, 0xc2, 0x83, 0x24, 0x69, 0xf0, 0x46, 0x27, 0x18, 0x83, 0xc2, 0x2e, 0x09, 0x80, 0x1c,
+    0x29, 0x0d, 0x80, 0x42, 0xf9, 0x47, 0x2d, 0x08, 0x80, 0x3a, 0xe9, 0xe8, 0xe9, 0x64, 0x2a, 0x00,
+    0x00, 0x08, 0x97, 0x00, 0x00, 0x40, 0x80, 0x44, 0xf9, 0x49, 0xe9, 0xe8, 0xe9, 0x3a, 0xf9, 0x4a,
+    0xf9, 0xc7, 0x2a, 0x00, 0x80, 0x6c, 0xf9, 0x4b, 0xe9, 0xe8, 0xe9, 0x3a, 0xf9, 0x4c, 0x29, 0x00,
+    0x80, 0x4c, 0xef, 0xe8, 0xef, 0x39, 0x29, 0x00, 0x80, 0x50, 0xea, 0xe8, 0xea, 0x39, 0xc9, 0xa8,
+    0xec, 0xe8, 0xec, 0x39, 0xe9, 0xe8, 0xeb, 0xe8, 0xe9, 0x7e, 0x33, 0x1b, 0x80, 0x10, 0xfd, 0x48,
+    0xeb, 0x6e, 0xf9, 0x4d, 0x34, 0x56, 0xf9, 0xcb, 0xf2, 0x4e, 0xf3, 0x4f, 0xf8, 0x50, 0xfa, 0x51,
+    0xfb, 0x52, 0x32, 0xa4, 0x2b, 0x24, 0x80, 0x08, 0xfc, 0x53, 0xf9, 0xcd, 0xf3, 0xcf, 0x25, 0xe9,
+    0x00, 0x11, 0xfc, 0xd3, 0xfb, 0xd2, 0x84, 0x06, 0xfa, 0xd1, 0x40, 0x14, 0x90, 0xbb, 0x24, 0x69,
+    0x2c, 0x90, 0x74, 0x56, 0x80, 0x37, 0x91, 0x9b, 0x01, 0x92, 0xf9, 0xcc, 0x41, 0x97, 0x01, 0x91,
+    0xf9, 0xca, 0x21, 0x00, 0x82, 0x00, 0x00, 0x08, 0x97, 0x80, 0x00, 0x40, 0x41, 0x91, 0x32, 0xa4,
+    0x28, 0xfa, 0x80, 0x08, 0x09, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x2c, 0x10, 0xf9, 0xc9, 0xf8, 0xd0,
+    0x00, 0x91, 0xf3, 0xcf, 0x00, 0x90, 0xfa, 0xd1, 0xf2, 0xce, 0xfb, 0xd2, 0x88, 0x28, 0xfc, 0xd3,
+    0x34, 0x56, 0xf9, 0xc5, 0xfd, 0xc8, 0x11, 0x11, 0xf9, 0xcd, 0x54, 0x15, 0x14, 0x11, 0xf4, 0x01,
+    0x32, 0xa4, 0x2a, 0x84, 0x80, 0x08, 0xf4, 0x02, 0xf2, 0xce, 0xf3, 0xcf, 0xf8, 0xd0, 0xfa, 0xd1,
+    0xfb, 0xd2, 0xfc, 0xd3, 0x39, 0x61, 0x3b, 0x41, 0xf9, 0xcd, 0x25, 0x6a, 0xfd, 0xc8, 0x29, 0x09,
+    0x80, 0x94, 0xf9, 0x4d, 0xf9, 0xcc, 0x2d, 0x0d, 0x80, 0x94, 0x29, 0x09, 0x80, 0x94, 0xf9, 0x4c,
+    0xf9, 0xca, 0x2b, 0x0b, 0x80, 0x94, 0x29, 0x09, 0x80, 0x94, 0xf9, 0x4a, 0xf9, 0xc9, 0x2a, 0x0a,
+    0x80, 0x94, 0x29, 0x09, 0x80, 0x94, 0xf9, 0x49, 0xf9, 0xcb, 0x2f, 0x0f, 0x00, 0x08, 0x98, 0x00,
+    0x00, 0x40, 0x80, 0x94, 0x29, 0x09, 0x80, 0x94, 0x28, 0x08, 0x80, 0x94, 0x2c, 0x0c, 0x80, 0x94,
+    0xfd, 0x48, 0x81, 0x2e, 0xf9, 0x4b, 0x10, 0x86, 0x80, 0x20, 0x32, 0x04, 0x39, 0xfe, 0x80, 0x09,
+    0xb0, 0x71, 0x33, 0x04, 0x3a, 0x0a, 0x80, 0x09, 0x33, 0x04, 0x3a, 0x16, 0x80, 0x09, 0x33, 0x04,
+    0x3a, 0x2e, 0x80, 0x09, 0x33, 0x04, 0x3a, 0x3a, 0x80, 0x09, 0x33, 0x04, 0x3a, 0x46, 0x80, 0x09,
+    0x33, 0x04, 0x3a, 0x5e, 0x80, 0x09, 0x33, 0x04, 0x3a, 0x6a, 0x80, 0x09, 0x33, 0x04, 0x3a, 0x76,
+    0x80, 0x09, 0xf9, 0xc7, 0x18, 0x06, 0x82, 0x7a, 0x29, 0x0a, 0x80, 0x5c, 0x19, 0x06, 0x82, 0x78,
+    0x09, 0x06, 0x82, 0x86, 0x09, 0x06, 0x82, 0x7c, 0x29, 0x00, 0x80, 0x58, 0xed, 0xea, 0xed, 0x39,
+    0xef, 0xea, 0xf5, 0xc3, 0xeb, 0xea, 0xec, 0xea, 0xf9, 0xc7, 0x08, 0x06, 0x82, 0x88, 0x08, 0x06,
+    0x80, 0x5e, 0x00, 0x08, 0x98, 0x80, 0x00, 0x40, 0x38, 0xe0, 0x20, 0x50, 0x80, 0x09, 0xc6, 0x83,
+    0xef, 0x64, 0xeb, 0x62, 0xec, 0x7a, 0xf8, 0x48, 0xf9, 0x49, 0x07, 0x96, 0x80, 0xf2, 0x05, 0x96,
+    0x81, 0x86, 0x10, 0x10, 0xe8, 0xee, 0xf0, 0x01, 0xfa, 0x4a, 0xfb, 0x4b, 0xfc, 0x4c, 0x32, 0x84,
+    0x3d, 0x50, 0x80, 0x08, 0xfd, 0x4d, 0x24, 0x69, 0xfd, 0xcd, 0x80, 0x0e, 0xfc, 0xcc, 0x20, 0xa0,
+    0x9f, 0xff, 0x51, 0x95, 0xdc, 0x01, 0x40, 0x95, 0x90, 0xc0, 0x10, 0x14, 0x38, 0xe0, 0x20, 0x28,
+    0x80, 0x09, 0xb3, 0xb6, 0x37, 0x19, 0x80, 0x03, 0x3c, 0xc1, 0xc2, 0x8e, 0xc9, 0x41, 0x37, 0x1b,
+    0x80, 0x1c, 0x3d, 0xe2, 0xe9, 0x18, 0x2d, 0x3d, 0x51, 0x11, 0x68, 0x31, 0x32, 0x84, 0x3f, 0x30,
+    0x80, 0x08, 0xd4, 0x1a, 0xfc, 0xcc, 0xfb, 0xcb, 0x40, 0x14, 0x2a, 0xff, 0x9d, 0x35, 0x51, 0x13,
+    0x35, 0x50, 0x10, 0x17, 0xfb, 0xcb, 0xfa, 0xca, 0x00, 0x08, 0x99, 0x00, 0x00, 0x40, 0x42, 0x13,
+    0x2a, 0xff, 0x9d, 0x25, 0x51, 0x12, 0x3b, 0x61, 0xfa, 0xca, 0x27, 0x6a, 0xf8, 0xc8, 0x00, 0x12,
+    0xf9, 0xc9, 0xfc, 0xcc, 0xfb, 0xcb, 0xfd, 0xcd, 0x29, 0x09, 0x80, 0x94, 0xe8, 0x54, 0x2d, 0x0d,
+    0x80, 0x94, 0x2c, 0x0c, 0x80, 0x94, 0x2b, 0x0b, 0x80, 0x94, 0x2f, 0x0f, 0x80, 0x94, 0x2a, 0x0a,
+    0x80, 0x94, 0xf8, 0x48, 0x81, 0x64, 0xf9, 0x49, 0xf0, 0xc4, 0x0d, 0x00, 0xa2, 0x00, 0x24, 0x80,
+    0x80, 0x01, 0x10, 0x06, 0x82, 0x7c, 0x6c, 0x7c, 0x80, 0x1e, 0x34, 0xd4, 0x04, 0x06, 0x82, 0x7c,
+    0xf9, 0xc7, 0x10, 0x06, 0x80, 0x10, 0x29, 0x08, 0x82, 0x58, 0x32, 0x84, 0x3f, 0x10, 0x80, 0x08,
+    0xf8, 0x41, 0x00, 0x06, 0x82, 0x7c, 0x33, 0x04, 0x3a, 0x8e, 0x80, 0x09, 0x2c, 0x90, 0xf0, 0xc4,
+    0x0c, 0x00, 0xa0, 0x80, 0x18, 0x06, 0x82, 0x7c, 0x10, 0x06, 0x80, 0x16, 0x80, 0x20, 0x00, 0x08,
+    0x99, 0x80, 0x00, 0x40, 0x35, 0x40, 0x08, 0x06, 0x82, 0x8a, 0x10, 0x06, 0x82, 0x86, 0x28, 0x32,
+    0x02, 0x06, 0x80, 0x16, 0x7c, 0x6f, 0x00, 0x06, 0x82, 0x86, 0x88, 0x3c, 0x01, 0x00, 0x27, 0xa8,
+    0x80, 0x0a, 0x7c, 0x41, 0x21, 0x60, 0x9f, 0xff, 0x32, 0xa4, 0x36, 0x10, 0x80, 0x08, 0x78, 0x41,
+    0x11, 0x06, 0x82, 0x7c, 0x28, 0x31, 0x00, 0x06, 0x80, 0x16, 0x3c, 0x6f, 0x38, 0xe0, 0x3d, 0xac,
+    0x80, 0x09, 0x00, 0x06, 0x82, 0x86, 0x00, 0x00, 0x27, 0xa8, 0x80, 0x0a, 0x32, 0x04, 0x24, 0xa0,
+    0x80, 0x09, 0x11, 0x06, 0x82, 0x96, 0x2f, 0x10, 0xfa, 0xc7, 0xc2, 0x83, 0x2a, 0x0b, 0x80, 0x5e,
+    0x3f, 0xe0, 0x20, 0x50, 0x80, 0x09, 0x90, 0xc0, 0x34, 0xd6, 0x19, 0x13, 0xeb, 0x70, 0x09, 0x13,
+    0xf9, 0xc5, 0x2b, 0x0b, 0x80, 0xa4, 0x10, 0x11, 0xe8, 0xee, 0xf0, 0x01, 0xf2, 0x47, 0xfa, 0x48,
+    0x32, 0xa4, 0x24, 0xc0, 0x00, 0x08, 0x9a, 0x00, 0x00, 0x40, 0x80, 0x08, 0xfb, 0x49, 0x32, 0xa4,
+    0x2c, 0xf2, 0x80, 0x08, 0x34, 0x56, 0xe9, 0xee, 0x00, 0x17, 0xfa, 0xc8, 0x32, 0x84, 0x3e, 0x40,
+    0x80, 0x08, 0xe8, 0xea, 0x3b, 0x41, 0xf2, 0xc7, 0x39, 0x61, 0xfa, 0xc8, 0x25, 0x6a, 0xef, 0x54,
+    0x2a, 0x0a, 0x80, 0x94, 0xf5, 0xc3, 0x81, 0xb6, 0xfb, 0xc9, 0x38, 0x00, 0x20, 0xe6, 0x80, 0x08,
+    0x10, 0x86, 0x80, 0x20, 0xb0, 0x71, 0x30, 0xc8, 0x80, 0xdc, 0x00, 0x10, 0x39, 0x00, 0x20, 0xee,
+    0x80, 0x08, 0x1c, 0xd0, 0x08, 0x86, 0x3a, 0x54, 0x80, 0x09, 0x3a, 0x00, 0x20, 0xf0, 0x80, 0x08,
+    0x0c, 0x00, 0x80, 0x3a, 0xb0, 0xf1, 0x31, 0x88, 0x80, 0x00, 0x30, 0xc8, 0x80, 0x5f, 0x00, 0x11,
+    0x3b, 0x00, 0x20, 0xf2, 0x80, 0x08, 0x19, 0xd1, 0x08, 0x86, 0x3a, 0x54, 0x80, 0x09, 0x90, 0xc0,
+    0x09, 0x00, 0x80, 0x42, 0xb0, 0xf1, 0x31, 0x08, 0x88, 0x00, 0x00, 0x08, 0x9a, 0x80, 0x00, 0x40,
+    0x7c, 0x7b, 0x40, 0x12, 0x19, 0xd2, 0x08, 0x86, 0x3a, 0x54, 0x80, 0x09, 0x90, 0xc0, 0x09, 0x00,
+    0x80, 0x44, 0xb0, 0xf1, 0x31, 0x58, 0x80, 0x00, 0x7c, 0x6e, 0x40, 0x13, 0x19, 0xd3, 0x08, 0x86,
+    0x3a, 0x54, 0x80, 0x09, 0x90, 0xc0, 0x09, 0x00, 0x80, 0x46, 0x2e, 0x0c, 0x80, 0x20, 0x2c, 0x08,
+    0x80, 0x46, 0x28, 0x09, 0x80, 0x0e, 0x2b, 0x03, 0x80, 0x12, 0x93, 0x43, 0xea, 0xe9, 0x2b, 0x02,
+    0x80, 0x4a, 0x2a, 0x02, 0x80, 0x25, 0xea, 0x64, 0x10, 0x3a, 0x51, 0x10, 0x40, 0x39, 0x10, 0x06,
+    0x82, 0xa0, 0x36, 0x10, 0x81, 0xff, 0x80, 0x21, 0x0b, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0,
+    0x10, 0x03, 0x81, 0x26, 0x64, 0x64, 0x30, 0xf0, 0x11, 0x94, 0x30, 0x81, 0x20, 0x00, 0x80, 0x00,
+    0x80, 0x07, 0x88, 0x0e, 0xdc, 0x19, 0x11, 0x94, 0x30, 0x78, 0x3f, 0xff, 0xbf, 0xff, 0xdc, 0x01,
+    0x00, 0x08, 0x9b, 0x00, 0x00, 0x40, 0x94, 0xd0, 0x28, 0x08, 0x80, 0x94, 0x40, 0xb4, 0x90, 0xc0,
+    0x10, 0x86, 0x80, 0x20, 0x0c, 0x80, 0xa0, 0x00, 0xb0, 0x71, 0x80, 0x0e, 0xb1, 0xf2, 0x30, 0x81,
+    0x20, 0x00, 0x80, 0x00, 0x88, 0x0c, 0xdc, 0x19, 0x30, 0x78, 0x3f, 0xff, 0xbf, 0xff, 0xdc, 0x01,
+    0xb0, 0x72, 0xf0, 0xc4, 0x0d, 0x00, 0xa0, 0x20, 0x80, 0xd5, 0x35, 0xd7, 0xf0, 0xc6, 0x24, 0x69,
+    0x10, 0x86, 0x82, 0x98, 0x80, 0x61, 0x09, 0x96, 0x82, 0x7a, 0x21, 0x74, 0x38, 0x00, 0x24, 0x9c,
+    0x80, 0x0a, 0x2d, 0x74, 0x74, 0xd5, 0x74, 0x42, 0x7c, 0x48, 0x64, 0x65, 0x7c, 0x48, 0x74, 0x58,
+    0x00, 0x03, 0x27, 0xaa, 0x80, 0x0a, 0x19, 0x06, 0x82, 0x78, 0x09, 0x00, 0x27, 0xa8, 0x80, 0x0a,
+    0x16, 0x86, 0x82, 0x98, 0x34, 0x56, 0x35, 0x56, 0x76, 0x56, 0x20, 0x74, 0x60, 0xf5, 0x2c, 0xf7,
+    0x6c, 0x76, 0x34, 0x40, 0x74, 0xc1, 0x00, 0x08, 0x9b, 0x80, 0x00, 0x40, 0x3c, 0x48, 0x7c, 0xc8,
+    0x24, 0xe5, 0x64, 0x65, 0x3c, 0x48, 0x7c, 0xc8, 0x34, 0xd9, 0x74, 0x58, 0xd8, 0x99, 0x32, 0xc4,
+    0x2b, 0x88, 0x80, 0x08, 0x00, 0xfe, 0x9f, 0xfe, 0x88, 0x59, 0x09, 0x96, 0x80, 0x74, 0x21, 0x74,
+    0x38, 0x00, 0x24, 0x9c, 0x80, 0x0a, 0x6d, 0x74, 0x74, 0x42, 0x7c, 0x48, 0x64, 0x65, 0x7c, 0x48,
+    0x74, 0x58, 0x00, 0x03, 0x27, 0xaa, 0x80, 0x0a, 0x12, 0x86, 0x82, 0x98, 0x34, 0x52, 0x09, 0x96,
+    0x81, 0x08, 0x22, 0x74, 0x34, 0x52, 0x0b, 0x96, 0x81, 0x9c, 0x2e, 0x74, 0x60, 0x75, 0x2c, 0x75,
+    0x74, 0xc4, 0x34, 0x40, 0x7c, 0xc8, 0x3c, 0x48, 0x64, 0xe5, 0x24, 0x65, 0x7c, 0xc8, 0x3c, 0x48,
+    0x74, 0xd9, 0x34, 0x58, 0xd8, 0x99, 0x32, 0xc4, 0x2b, 0x88, 0x80, 0x08, 0x00, 0xfe, 0x9f, 0xfe,
+    0xf0, 0xc6, 0x24, 0x69, 0x08, 0x04, 0x27, 0xac, 0x80, 0x0a, 0x80, 0x82, 0x00, 0x08, 0x9c, 0x00,
+    0x00, 0x40, 0x08, 0x06, 0x82, 0x88, 0x89, 0x07, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x11, 0x06,
+    0x80, 0x1c, 0xb8, 0x84, 0x0c, 0x08, 0xa0, 0x01, 0x80, 0x0b, 0x18, 0x06, 0x80, 0x74, 0x88, 0x06,
+    0xc8, 0x48, 0x6c, 0x10, 0x29, 0x31, 0x10, 0x06, 0x80, 0xb0, 0x02, 0x06, 0x82, 0x88, 0x08, 0x86,
+    0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0, 0xb8, 0x84, 0x0c, 0x08, 0xa0, 0x02, 0x80, 0x0b, 0x18, 0x06,
+    0x81, 0x08, 0x88, 0x06, 0xc8, 0x49, 0x6c, 0x90, 0x28, 0xb1, 0xd8, 0x12, 0x35, 0x71, 0x24, 0x61,
+    0x11, 0x06, 0x81, 0x44, 0xd9, 0x12, 0x6c, 0x52, 0x00, 0x96, 0x82, 0x88, 0x08, 0x86, 0x3a, 0x58,
+    0x80, 0x09, 0x90, 0xc0, 0xb8, 0x84, 0x0c, 0x08, 0xa0, 0x04, 0x80, 0x0b, 0x18, 0x06, 0x81, 0x9c,
+    0x88, 0x06, 0xc8, 0x4a, 0x6d, 0x10, 0x68, 0xb8, 0xd8, 0x91, 0x64, 0xe1, 0x6c, 0x51, 0x00, 0x96,
+    0x82, 0x88, 0x00, 0x08, 0x9c, 0x80, 0x00, 0x40, 0xb1, 0xb6, 0x32, 0x04, 0x25, 0x02, 0x80, 0x09,
+    0x38, 0xe0, 0x2b, 0xb8, 0x80, 0x09, 0xf0, 0xc4, 0x0c, 0x00, 0xa1, 0x00, 0x80, 0x0a, 0x10, 0x06,
+    0x80, 0x18, 0x88, 0x12, 0x74, 0x40, 0x7c, 0x41, 0x21, 0x60, 0x9f, 0xff, 0x32, 0xa4, 0x36, 0x10,
+    0x80, 0x08, 0x78, 0x41, 0x00, 0x06, 0x80, 0x18, 0x10, 0x06, 0x80, 0x18, 0x11, 0x06, 0x82, 0x88,
+    0x28, 0x31, 0x11, 0x06, 0x82, 0x9e, 0x7c, 0x6f, 0x2a, 0xff, 0x99, 0x67, 0x34, 0x70, 0x00, 0x06,
+    0x82, 0x88, 0x35, 0x50, 0x10, 0x06, 0x82, 0x8a, 0x11, 0x06, 0x82, 0x9c, 0x2a, 0xff, 0x99, 0x53,
+    0x02, 0x06, 0x82, 0x9e, 0x2e, 0x0f, 0x80, 0x54, 0xc6, 0x83, 0x00, 0x06, 0x82, 0x9c, 0x38, 0xe0,
+    0x20, 0x56, 0x80, 0x09, 0x10, 0x97, 0xef, 0x6c, 0x11, 0x97, 0xc8, 0x4f, 0x32, 0xa4, 0x2c, 0x0e,
+    0x80, 0x08, 0x2f, 0x0f, 0x80, 0xa0, 0x3b, 0x61, 0x00, 0x08, 0x9d, 0x00, 0x00, 0x40, 0xc8, 0x47,
+    0x67, 0x6a, 0x40, 0x10, 0x81, 0xe6, 0xe8, 0x54, 0xf0, 0xc4, 0x00, 0x96, 0xf0, 0xde, 0xf0, 0x41,
+    0xf9, 0xc5, 0x32, 0x84, 0x3f, 0x70, 0x80, 0x08, 0xe8, 0xee, 0x27, 0xe8, 0x9f, 0xb0, 0x30, 0x24,
+    0x3f, 0x50, 0x80, 0x09, 0xe7, 0xe8, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x64, 0x66,
+    0x30, 0xf0, 0x2e, 0xb1, 0x7c, 0xc1, 0x92, 0xc2, 0x7e, 0xe9, 0xd6, 0xc1, 0x94, 0xc0, 0x75, 0x45,
+    0x9f, 0x70, 0x74, 0x72, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x96, 0xc0,
+    0x6f, 0x90, 0x96, 0x20, 0x97, 0x20, 0x94, 0xc0, 0x9e, 0x20, 0x9f, 0x20, 0x96, 0xc0, 0xc8, 0x4e,
+    0x29, 0x0f, 0x80, 0x30, 0x32, 0xa4, 0x35, 0xc0, 0x80, 0x08, 0x50, 0x97, 0x96, 0xc0, 0x67, 0xe0,
+    0xc8, 0x46, 0xec, 0xef, 0x90, 0xc0, 0x96, 0xc0, 0xc8, 0xac, 0x28, 0x0e, 0x82, 0x92, 0x00, 0x08,
+    0x9d, 0x80, 0x00, 0x40, 0x52, 0x16, 0x31, 0x70, 0xec, 0x38, 0x94, 0xc0, 0x50, 0x94, 0x80, 0xab,
+    0x31, 0x0c, 0x88, 0x00, 0x66, 0x69, 0x94, 0xc0, 0xf6, 0x8d, 0x84, 0x0f, 0x67, 0x69, 0x94, 0xc6,
+    0x80, 0x99, 0x6c, 0x10, 0x94, 0xc0, 0xca, 0xa0, 0xeb, 0xef, 0x90, 0xc0, 0x98, 0xc0, 0xeb, 0x3a,
+    0x32, 0xa4, 0x35, 0xc0, 0x80, 0x08, 0x50, 0x93, 0x37, 0x50, 0xed, 0xef, 0x98, 0xc0, 0xed, 0x64,
+    0x32, 0xa4, 0x35, 0xc0, 0x80, 0x08, 0x50, 0x95, 0x9c, 0xc0, 0x6e, 0x02, 0x67, 0xe0, 0x6f, 0x10,
+    0xee, 0x42, 0x2f, 0x09, 0x80, 0x34, 0x50, 0x16, 0x30, 0x74, 0x50, 0x11, 0x94, 0xc0, 0x78, 0x41,
+    0x80, 0x1b, 0x35, 0xf0, 0x40, 0x11, 0x36, 0x13, 0x80, 0x2f, 0x84, 0x0f, 0x98, 0xc0, 0xc7, 0x81,
+    0x31, 0x84, 0x3d, 0xf4, 0x80, 0x08, 0x46, 0x11, 0x96, 0xc0, 0xd3, 0xa1, 0xee, 0xe9, 0xe8, 0xe9,
+    0x94, 0xc7, 0xee, 0x64, 0x00, 0x08, 0x9e, 0x00, 0x00, 0x40, 0x6f, 0x10, 0x94, 0xc6, 0xe8, 0x64,
+    0x54, 0x16, 0x94, 0xc1, 0x46, 0x16, 0x7a, 0x41, 0x98, 0xc6, 0x28, 0x0c, 0x80, 0x02, 0x90, 0xc0,
+    0x44, 0x16, 0x10, 0x10, 0x51, 0x14, 0x70, 0x71, 0x92, 0xc2, 0x6f, 0x10, 0x94, 0xc2, 0xe9, 0x4a,
+    0xc0, 0x81, 0x92, 0xc2, 0x46, 0x10, 0x92, 0xc2, 0x90, 0x99, 0x74, 0x57, 0x94, 0xc0, 0x9e, 0x21,
+    0x9f, 0x21, 0x94, 0xc0, 0x96, 0x21, 0x97, 0x21, 0x9f, 0x71, 0xe8, 0x44, 0x51, 0x90, 0x98, 0xc0,
+    0x33, 0x9f, 0x80, 0x00, 0x96, 0x20, 0x97, 0x20, 0x96, 0xc0, 0x67, 0xe9, 0x9e, 0x20, 0xc8, 0x4e,
+    0x96, 0xc0, 0x84, 0xa7, 0x28, 0x0e, 0x80, 0x08, 0x32, 0xa4, 0x35, 0xc0, 0x80, 0x08, 0x50, 0x96,
+    0x9a, 0xc0, 0x77, 0xd0, 0xee, 0x44, 0x32, 0xa4, 0x35, 0xc0, 0x80, 0x08, 0x50, 0x96, 0x98, 0xc0,
+    0x2e, 0x0d, 0x80, 0x2c, 0x6c, 0x03, 0xc8, 0x46, 0x96, 0xc0, 0x00, 0x08, 0x9e, 0x80, 0x00, 0x40,
+    0x76, 0x50, 0x2d, 0x0e, 0x80, 0x16, 0x3e, 0x41, 0xea, 0xee, 0x26, 0x61, 0xea, 0x74, 0x6e, 0xc0,
+    0x3b, 0x03, 0x80, 0x04, 0x7d, 0xe3, 0x43, 0x15, 0x16, 0x12, 0x03, 0xe4, 0x20, 0x4c, 0x80, 0x09,
+    0x31, 0xf6, 0x3b, 0x41, 0x53, 0x16, 0x84, 0x24, 0x9a, 0xc0, 0x36, 0xcd, 0x96, 0x08, 0x90, 0xc0,
+    0x37, 0x1f, 0x80, 0xff, 0x06, 0x12, 0xee, 0x72, 0x32, 0xa4, 0x36, 0x30, 0x80, 0x08, 0x10, 0x15,
+    0x51, 0x16, 0x00, 0x16, 0x31, 0x84, 0x3e, 0xfc, 0x80, 0x08, 0xe9, 0xee, 0x94, 0xc0, 0xe9, 0x72,
+    0xee, 0x6e, 0x53, 0x11, 0x32, 0xf3, 0x53, 0x16, 0x94, 0xc0, 0x79, 0xc1, 0x80, 0x1f, 0x35, 0x73,
+    0x03, 0x16, 0xc5, 0xdf, 0x33, 0xf2, 0x6d, 0x10, 0x80, 0x0f, 0x42, 0x16, 0x51, 0x90, 0x09, 0x41,
+    0xa0, 0x00, 0xde, 0x81, 0x45, 0x90, 0x6c, 0x90, 0x41, 0x12, 0x41, 0x11, 0x9e, 0x21, 0x94, 0xc0,
+    0x00, 0x08, 0x9f, 0x00, 0x00, 0x40, 0x96, 0x21, 0x97, 0x21, 0x9f, 0x71, 0x90, 0xc0, 0x90, 0xc0,
+    0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x96, 0xc0, 0xd9, 0x91, 0xd8, 0x90, 0xfc, 0xc3, 0x90, 0xc0,
+    0x50, 0x94, 0x61, 0x74, 0x6d, 0x74, 0x6e, 0x32, 0x62, 0x19, 0x96, 0xc0, 0x71, 0xcc, 0x44, 0x94,
+    0x9f, 0x70, 0xd8, 0x1b, 0x90, 0xc0, 0x32, 0xa4, 0x36, 0x00, 0x80, 0x08, 0x21, 0x60, 0x9f, 0xff,
+    0x30, 0xa4, 0x36, 0x30, 0x80, 0x08, 0x21, 0x80, 0x80, 0x01, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0,
+    0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x96, 0xc0, 0xfc, 0xc3, 0x28, 0x0a, 0x82, 0x78, 0x52, 0x11,
+    0x42, 0x1a, 0x51, 0x14, 0x41, 0x12, 0x94, 0xc0, 0xea, 0x4e, 0x9f, 0x70, 0x41, 0x12, 0x90, 0xc0,
+    0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x96, 0xc0, 0xfc, 0xc3, 0x28, 0x08, 0x82, 0x86, 0x13, 0x10,
+    0xe8, 0x4a, 0x03, 0x11, 0xea, 0xe8, 0x00, 0x08, 0x9f, 0x80, 0x00, 0x40, 0xea, 0x68, 0x54, 0x12,
+    0x94, 0xc0, 0x44, 0x10, 0x9f, 0x70, 0x44, 0x14, 0x90, 0xc0, 0x90, 0xc0, 0x98, 0xc0, 0x38, 0x00,
+    0x35, 0xc0, 0x80, 0x0a, 0x9f, 0x71, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x96, 0xc0, 0x6c, 0x90,
+    0x96, 0x20, 0x97, 0x20, 0x94, 0xc0, 0x9e, 0x20, 0x9f, 0x20, 0x96, 0xc0, 0xe7, 0x50, 0x25, 0x00,
+    0x82, 0xa4, 0x98, 0xc0, 0xc9, 0x4e, 0x32, 0xe4, 0x3c, 0x8a, 0x80, 0x01, 0x94, 0xc0, 0xf5, 0x41,
+    0xf8, 0x43, 0x9a, 0xc0, 0x6f, 0x90, 0x6d, 0x10, 0x6c, 0x90, 0xc9, 0x46, 0xfa, 0xc3, 0x3a, 0x40,
+    0xa0, 0x00, 0x6d, 0x90, 0xcb, 0xaa, 0x2d, 0x00, 0x81, 0xae, 0x9a, 0xc0, 0x29, 0x08, 0x81, 0x0c,
+    0x90, 0xc0, 0x2a, 0x0b, 0x80, 0x0c, 0x38, 0x20, 0xa0, 0x00, 0x55, 0xd0, 0x28, 0x0c, 0x80, 0x02,
+    0x38, 0x20, 0xa0, 0x00, 0x45, 0x1b, 0x2c, 0x0f, 0x80, 0x2c, 0x14, 0xd4, 0x00, 0x08, 0xa0, 0x00,
+    0x00, 0x40, 0xcc, 0xb2, 0x96, 0xc0, 0x44, 0x13, 0x29, 0x00, 0x81, 0x1a, 0x96, 0xc0, 0xeb, 0x48,
+    0x20, 0x02, 0x82, 0x42, 0x38, 0x40, 0xa0, 0x00, 0x47, 0x1b, 0x24, 0x00, 0x82, 0x00, 0x96, 0xc0,
+    0x47, 0x13, 0x2b, 0x0e, 0x82, 0x7a, 0x38, 0x40, 0xa0, 0x00, 0x56, 0x1f, 0x20, 0x00, 0x80, 0xff,
+    0x06, 0x1e, 0xeb, 0xef, 0x15, 0x17, 0xeb, 0x3c, 0x36, 0x00, 0xa1, 0x00, 0x45, 0x1e, 0xed, 0xef,
+    0x36, 0x00, 0xa1, 0x00, 0xec, 0xee, 0xee, 0xee, 0x36, 0x80, 0xa1, 0x00, 0xec, 0xee, 0xef, 0xee,
+    0x36, 0x00, 0xa1, 0x00, 0x54, 0x13, 0xec, 0x39, 0x36, 0x40, 0xa1, 0x00, 0xec, 0x3d, 0xee, 0x38,
+    0x36, 0x80, 0xa0, 0x00, 0xef, 0x6a, 0x44, 0x16, 0x36, 0x40, 0xa1, 0x00, 0xc6, 0x9e, 0x40, 0x97,
+    0x38, 0xe0, 0xa0, 0x00, 0x76, 0x56, 0x44, 0x94, 0x44, 0x96, 0x36, 0xe0, 0xa1, 0x00, 0x44, 0x94,
+    0xed, 0x3b, 0x00, 0x08, 0xa0, 0x80, 0x00, 0x40, 0x3a, 0x80, 0xa0, 0x00, 0x50, 0x15, 0x35, 0x00,
+    0x20, 0x00, 0xbf, 0xe0, 0x9c, 0xc0, 0x6c, 0x7d, 0x74, 0x55, 0x37, 0x08, 0x20, 0x00, 0x81, 0x70,
+    0xf8, 0x44, 0x37, 0x54, 0x32, 0xe4, 0x3e, 0x52, 0x80, 0x01, 0x2e, 0x7c, 0x75, 0x57, 0x32, 0xe4,
+    0x3e, 0xa0, 0x80, 0x01, 0x37, 0xd0, 0x34, 0x56, 0x77, 0x51, 0x27, 0x60, 0x35, 0x50, 0x35, 0xd1,
+    0x34, 0x57, 0x32, 0xe4, 0x3e, 0xac, 0x80, 0x01, 0x74, 0xd6, 0x33, 0xe4, 0x3e, 0xbe, 0x80, 0x01,
+    0x33, 0x04, 0x2a, 0x86, 0x80, 0x09, 0x98, 0xc0, 0x2e, 0x09, 0x80, 0x02, 0x6e, 0x10, 0xf8, 0xc4,
+    0x00, 0x91, 0xfa, 0xc3, 0x3a, 0x00, 0xa1, 0x00, 0x02, 0x04, 0x38, 0x70, 0x80, 0x0a, 0xe8, 0xe8,
+    0x38, 0x80, 0xa0, 0x00, 0x7d, 0x45, 0xe8, 0x6a, 0xe8, 0x6c, 0x3a, 0x00, 0xa1, 0x00, 0x02, 0xe0,
+    0x20, 0x4c, 0x80, 0x09, 0xee, 0xe9, 0x36, 0x00, 0x00, 0x08, 0xa1, 0x00, 0x00, 0x40, 0xa1, 0x00,
+    0x56, 0xd0, 0x52, 0xd0, 0x9a, 0xc0, 0x20, 0x02, 0x81, 0xe0, 0xdb, 0x16, 0x24, 0x02, 0x82, 0x2a,
+    0x9a, 0xc0, 0x2d, 0x00, 0x81, 0x96, 0xdf, 0x1a, 0x2b, 0x00, 0x81, 0x02, 0x06, 0x92, 0xe8, 0xe9,
+    0x36, 0xa0, 0xa0, 0x00, 0xee, 0x38, 0xec, 0xe9, 0x96, 0xc0, 0xef, 0x6e, 0x20, 0x02, 0x82, 0x1a,
+    0x96, 0xc0, 0x56, 0x17, 0x23, 0x02, 0x80, 0xf4, 0x94, 0xc0, 0xe8, 0x3d, 0xec, 0x3b, 0x96, 0xc0,
+    0x46, 0x10, 0x21, 0x02, 0x81, 0x4c, 0x94, 0xc0, 0xeb, 0xe9, 0xe8, 0xe9, 0x36, 0xc0, 0xa0, 0x00,
+    0xef, 0xe9, 0xeb, 0x38, 0x36, 0x60, 0xa1, 0x00, 0xe8, 0x39, 0xef, 0x3c, 0x38, 0x80, 0xa0, 0x00,
+    0xe8, 0xe9, 0x21, 0x02, 0x81, 0x88, 0x96, 0xc0, 0x46, 0x14, 0x22, 0x02, 0x82, 0x74, 0x36, 0x80,
+    0xa0, 0x00, 0x46, 0x17, 0xc1, 0x88, 0x3a, 0xa0, 0xa0, 0x00, 0xe8, 0x3b, 0x01, 0xe0, 0x00, 0x08,
+    0xa1, 0x80, 0x00, 0x40, 0x20, 0x30, 0x80, 0x09, 0x96, 0xc0, 0xec, 0xe9, 0x23, 0x00, 0x82, 0x00,
+    0x38, 0x80, 0xa0, 0x00, 0xeb, 0xe9, 0x25, 0x02, 0x80, 0xf0, 0x38, 0x80, 0xa0, 0x00, 0x43, 0x96,
+    0x27, 0x02, 0x82, 0x1c, 0x36, 0x60, 0xa1, 0x00, 0xec, 0x3a, 0xeb, 0x39, 0x96, 0xc0, 0x43, 0x90,
+    0x22, 0x02, 0x81, 0x84, 0x38, 0x80, 0xa0, 0x00, 0xe9, 0xe9, 0x28, 0x00, 0x80, 0xf2, 0x38, 0x80,
+    0xa0, 0x00, 0xee, 0xe9, 0x24, 0x02, 0x82, 0x18, 0x96, 0xc0, 0x43, 0x94, 0x2c, 0x00, 0x81, 0x86,
+    0x36, 0xe0, 0xa1, 0x00, 0xe9, 0x3f, 0xee, 0x3d, 0x98, 0xc0, 0xea, 0xe9, 0x05, 0x04, 0x38, 0x70,
+    0x80, 0x0a, 0x98, 0xc0, 0x3e, 0x15, 0x80, 0x14, 0xea, 0x38, 0xed, 0xe9, 0x36, 0x80, 0xa1, 0x00,
+    0xed, 0xe9, 0xef, 0xe9, 0x36, 0x40, 0xa1, 0x00, 0xe8, 0xef, 0xef, 0x3a, 0x36, 0xa0, 0xa0, 0x00,
+    0xed, 0x3c, 0xed, 0x3c, 0x00, 0x08, 0xa2, 0x00, 0x00, 0x40, 0x36, 0x80, 0xa1, 0x00, 0x44, 0x10,
+    0x44, 0x13, 0x36, 0x80, 0xa1, 0x00, 0x44, 0x15, 0x44, 0x11, 0x36, 0x80, 0xa1, 0x00, 0x44, 0x17,
+    0x44, 0x16, 0x05, 0x13, 0x45, 0x12, 0x05, 0x15, 0xe8, 0x7e, 0x10, 0xd0, 0xc4, 0x83, 0x9a, 0xc0,
+    0x20, 0x00, 0x81, 0x2c, 0x6c, 0x7c, 0x22, 0x00, 0x8c, 0x91, 0x2c, 0x7d, 0x31, 0x20, 0x24, 0x3f,
+    0x80, 0x03, 0x9a, 0xc0, 0x34, 0x22, 0x80, 0x04, 0x68, 0xa8, 0x36, 0x23, 0x80, 0x04, 0x9a, 0xc0,
+    0xd8, 0x12, 0x7c, 0xea, 0x04, 0x04, 0x38, 0x70, 0x80, 0x0a, 0x96, 0xc0, 0xd4, 0x43, 0x22, 0x00,
+    0x83, 0xe8, 0x32, 0xe4, 0x3c, 0x48, 0x80, 0x01, 0x28, 0x88, 0x64, 0x61, 0x98, 0xc0, 0x28, 0x00,
+    0x82, 0x88, 0x7c, 0x48, 0xef, 0x54, 0x24, 0x65, 0xc1, 0x84, 0x3c, 0x48, 0xe9, 0x38, 0x74, 0x58,
+    0x00, 0x51, 0x32, 0xa4, 0x36, 0x30, 0x80, 0x08, 0x50, 0x17, 0x00, 0x08, 0xa2, 0x80, 0x00, 0x40,
+    0x24, 0x69, 0x2d, 0x10, 0x10, 0x17, 0xc1, 0x84, 0x80, 0x13, 0x33, 0xa4, 0x36, 0x30, 0x80, 0x08,
+    0xd9, 0x90, 0xd2, 0x13, 0x76, 0x74, 0x39, 0x02, 0x80, 0x0e, 0x9a, 0xc0, 0x74, 0x72, 0x02, 0x04,
+    0x38, 0x70, 0x80, 0x0a, 0xc5, 0x81, 0x9c, 0xc0, 0x65, 0x6a, 0x76, 0x55, 0xc6, 0x88, 0x0d, 0x86,
+    0x3a, 0x58, 0x80, 0x09, 0x96, 0xc7, 0x6c, 0x7c, 0x79, 0x47, 0xc1, 0x8f, 0x9c, 0xc0, 0x7d, 0x63,
+    0x76, 0xd4, 0x3b, 0xe0, 0x20, 0x34, 0x80, 0x09, 0xc3, 0x81, 0x9c, 0xc0, 0x6e, 0x7d, 0x2d, 0x0f,
+    0x80, 0x24, 0x6d, 0x7d, 0x28, 0x00, 0x82, 0x7a, 0x9a, 0xc0, 0x7f, 0x41, 0x6c, 0xa5, 0xec, 0xee,
+    0x29, 0x00, 0x81, 0xe6, 0x96, 0xc0, 0xd5, 0x91, 0xcd, 0x46, 0xec, 0x38, 0x98, 0xc0, 0x03, 0xe0,
+    0x20, 0x48, 0x80, 0x09, 0xe8, 0xee, 0x94, 0xc0, 0xed, 0x1b, 0xe8, 0x39, 0x96, 0xc0, 0x53, 0x15,
+    0x00, 0x08, 0xa3, 0x00, 0x00, 0x40, 0x2d, 0x00, 0x81, 0x52, 0x98, 0xc0, 0x03, 0xe0, 0x20, 0x46,
+    0x80, 0x09, 0xe7, 0x70, 0x98, 0xc0, 0x03, 0xe0, 0x20, 0x4a, 0x80, 0x09, 0xee, 0x3d, 0x54, 0xd7,
+    0x66, 0x69, 0x92, 0xc2, 0x6d, 0x10, 0x92, 0xc3, 0xc2, 0x81, 0x42, 0x14, 0x0b, 0x86, 0x3a, 0x58,
+    0x80, 0x09, 0x90, 0xc0, 0x2b, 0x09, 0x80, 0x28, 0x54, 0xd1, 0x66, 0x69, 0x92, 0xc2, 0x6c, 0x90,
+    0x92, 0xc3, 0xc1, 0x81, 0x41, 0x10, 0x0b, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0, 0x2b, 0x09,
+    0x80, 0x2a, 0x52, 0xd1, 0x65, 0x69, 0x92, 0xc2, 0x6f, 0x10, 0x92, 0xc3, 0xc6, 0x81, 0x46, 0x16,
+    0x94, 0xc0, 0x9e, 0x21, 0x9f, 0x21, 0x94, 0xc0, 0x96, 0x21, 0x97, 0x21, 0x9f, 0x71, 0x90, 0xc0,
+    0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x94, 0xc0, 0x96, 0x20, 0x97, 0x20, 0x32, 0xc4, 0x39, 0x96,
+    0x80, 0x08, 0x9f, 0x20, 0x1f, 0x90, 0x00, 0x08, 0xa3, 0x80, 0x00, 0x40, 0x09, 0x86, 0x3a, 0x58,
+    0x80, 0x09, 0x90, 0xc0, 0x11, 0x97, 0xe8, 0xef, 0x33, 0x18, 0x80, 0x01, 0x24, 0x69, 0x6c, 0x10,
+    0x80, 0x51, 0x33, 0x84, 0x3f, 0xa0, 0x80, 0x08, 0x2f, 0x10, 0xc7, 0x83, 0x32, 0xa4, 0x2c, 0x40,
+    0x80, 0x08, 0x34, 0x56, 0x09, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x32, 0xa4, 0x28, 0xfa, 0x80, 0x08,
+    0x34, 0x56, 0x09, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x3b, 0xe1, 0x7b, 0x41, 0x67, 0xea, 0x81, 0xdf,
+    0x98, 0xc0, 0x0a, 0x86, 0x3a, 0x58, 0x80, 0x09, 0xc1, 0xfe, 0x94, 0xc0, 0xc2, 0xfe, 0xc0, 0x81,
+    0x2a, 0x09, 0x81, 0x00, 0x55, 0xd1, 0xdc, 0x85, 0x41, 0x11, 0x53, 0x97, 0xdd, 0x03, 0x42, 0x97,
+    0x9f, 0x21, 0x94, 0xc0, 0x96, 0x21, 0x97, 0x21, 0x9f, 0x71, 0x90, 0xc0, 0x24, 0x68, 0x76, 0x50,
+    0x84, 0x38, 0x92, 0xc3, 0xc0, 0xff, 0x9c, 0xc0, 0x66, 0x69, 0xd2, 0x94, 0x00, 0x08, 0xa4, 0x00,
+    0x00, 0x40, 0x3c, 0x40, 0x3a, 0x06, 0x80, 0x09, 0xc3, 0x9e, 0x96, 0xc6, 0x66, 0xe4, 0x6c, 0x10,
+    0x80, 0x25, 0x2d, 0xad, 0xd6, 0x15, 0x96, 0xc0, 0x38, 0xcd, 0x82, 0x10, 0x7d, 0xc8, 0xcd, 0x45,
+    0x90, 0xc0, 0xed, 0xf9, 0xed, 0x1c, 0x9d, 0xbd, 0xcd, 0x4a, 0x74, 0x72, 0xd4, 0x43, 0x9f, 0x71,
+    0x90, 0xc0, 0x96, 0xc0, 0x69, 0x31, 0x96, 0x20, 0x97, 0x20, 0x94, 0xc0, 0x9e, 0x20, 0x9f, 0x20,
+    0x98, 0xc0, 0x36, 0x81, 0x20, 0x00, 0x80, 0x00, 0xf5, 0x93, 0x98, 0xc0, 0x03, 0xfc, 0x9f, 0xd8,
+    0x76, 0x7e, 0xf0, 0xc9, 0x2c, 0xb5, 0x63, 0x75, 0x3c, 0xc8, 0x6f, 0x75, 0x64, 0xe5, 0x7c, 0xc8,
+    0x74, 0xd9, 0x61, 0x74, 0x6d, 0x74, 0x6f, 0x4a, 0x34, 0x56, 0x32, 0xa4, 0x35, 0xc0, 0x80, 0x08,
+    0x64, 0x66, 0x94, 0xc0, 0xcf, 0x40, 0xf0, 0xc7, 0x32, 0xa4, 0x35, 0xc0, 0x80, 0x08, 0xef, 0xfc,
+    0x32, 0xa4, 0x00, 0x08, 0xa4, 0x80, 0x00, 0x40, 0x36, 0x20, 0x80, 0x08, 0xf1, 0x97, 0x32, 0xa4,
+    0x35, 0xc0, 0x80, 0x08, 0x94, 0xc0, 0xce, 0x40, 0xf0, 0xc8, 0x32, 0xa4, 0x36, 0x20, 0x80, 0x08,
+    0xf1, 0x97, 0x98, 0xc0, 0x74, 0xd0, 0x74, 0x56, 0xef, 0x3e, 0xfb, 0xcb, 0x96, 0xc0, 0xcf, 0x4f,
+    0x25, 0xe0, 0x9f, 0xaa, 0x96, 0xc0, 0x6c, 0x87, 0x9e, 0x21, 0x9f, 0x21, 0x96, 0xc0, 0x6d, 0x7c,
+    0x96, 0x21, 0x97, 0x21, 0x9f, 0x70, 0x45, 0x13, 0x96, 0xc0, 0x6c, 0x10, 0xc3, 0x9c, 0xc8, 0x4d,
+    0x96, 0xc0, 0xd5, 0xc5, 0x96, 0x20, 0x97, 0x20, 0x3a, 0x40, 0xa0, 0x00, 0x26, 0x00, 0x80, 0x94,
+    0x76, 0x53, 0xc9, 0xa0, 0x9a, 0xc0, 0x6a, 0x06, 0x07, 0xe4, 0x20, 0x46, 0x80, 0x09, 0xcd, 0xb4,
+    0x9a, 0xc0, 0x67, 0xe9, 0xcc, 0x44, 0x35, 0x81, 0x20, 0x00, 0x80, 0x00, 0x94, 0xc7, 0x76, 0xfd,
+    0xd9, 0x17, 0x9a, 0xc7, 0x6e, 0xbb, 0xd3, 0x12, 0x00, 0x08, 0xa5, 0x00, 0x00, 0x40, 0x32, 0x81,
+    0x20, 0x00, 0x80, 0x00, 0x9c, 0xc1, 0x76, 0x76, 0x2c, 0x09, 0x80, 0x4c, 0x6f, 0x90, 0x2c, 0x09,
+    0x80, 0x4c, 0x3e, 0x07, 0xa1, 0x00, 0x90, 0xc0, 0xea, 0xe9, 0x90, 0xc0, 0x75, 0x7a, 0x39, 0x07,
+    0x80, 0x0e, 0x3c, 0x40, 0xa1, 0x00, 0xd5, 0x1f, 0x7e, 0xc8, 0x64, 0xe9, 0xea, 0x39, 0x56, 0x11,
+    0x3c, 0x00, 0xa1, 0x00, 0x79, 0x61, 0x66, 0xe5, 0x6b, 0x3e, 0x54, 0x92, 0xec, 0xe9, 0x9c, 0xc0,
+    0x6e, 0x08, 0x7e, 0xc8, 0x0f, 0xe3, 0x20, 0x4a, 0x80, 0x09, 0xea, 0xe9, 0x3e, 0x00, 0xa0, 0x04,
+    0x63, 0xf7, 0x6c, 0x7c, 0x76, 0xdd, 0x6c, 0x10, 0x9e, 0x20, 0x9f, 0x20, 0x3e, 0x00, 0xa0, 0x04,
+    0x6f, 0xf7, 0x2e, 0x00, 0x80, 0x40, 0x63, 0xf6, 0x27, 0x0b, 0x80, 0x38, 0x96, 0xc0, 0x6f, 0xf6,
+    0xe7, 0xeb, 0xea, 0x3d, 0x38, 0x00, 0xa8, 0x00, 0x63, 0x63, 0xec, 0x3e, 0xcf, 0x43, 0x00, 0x08,
+    0xa5, 0x80, 0x00, 0x40, 0x94, 0xc0, 0xd7, 0x42, 0xfc, 0x47, 0x96, 0xc0, 0x6e, 0x7c, 0x2f, 0x0f,
+    0x82, 0x60, 0x36, 0x80, 0xa0, 0x00, 0x46, 0x92, 0x84, 0x2e, 0x06, 0x92, 0x46, 0x94, 0x16, 0x17,
+    0xef, 0x50, 0x2b, 0x3e, 0x14, 0x97, 0x0f, 0xe3, 0x20, 0x4a, 0x80, 0x09, 0x2e, 0x08, 0x61, 0xf7,
+    0x2c, 0x7c, 0x6d, 0xf7, 0x63, 0x76, 0x6f, 0x76, 0x6f, 0x4e, 0xd7, 0x42, 0x6e, 0x7c, 0x46, 0x97,
+    0x3a, 0x00, 0xa1, 0x00, 0x2b, 0x00, 0x80, 0x44, 0x6c, 0x10, 0xe8, 0xe9, 0x96, 0xc0, 0xf3, 0xa9,
+    0x29, 0x0d, 0x80, 0x02, 0x3c, 0x20, 0xa1, 0x04, 0x68, 0x75, 0xe8, 0x3b, 0x09, 0xe3, 0x20, 0x4a,
+    0x80, 0x09, 0x38, 0x00, 0xa9, 0x40, 0x61, 0xf4, 0x57, 0x90, 0xcf, 0xba, 0x3a, 0x00, 0xb0, 0x80,
+    0x6e, 0x0b, 0x6d, 0xf4, 0x57, 0x15, 0xec, 0xed, 0x3a, 0x00, 0xa0, 0x08, 0x6c, 0x7c, 0x6a, 0x77,
+    0xec, 0x3f, 0xcb, 0xbc, 0x00, 0x08, 0xa6, 0x00, 0x00, 0x40, 0x3a, 0x40, 0xa0, 0x00, 0x63, 0xf6,
+    0x57, 0x94, 0x2d, 0x0f, 0x80, 0x02, 0x3a, 0x40, 0xb0, 0x00, 0x6f, 0xf6, 0x6e, 0x0b, 0xe8, 0xef,
+    0xce, 0xa8, 0x3a, 0x20, 0xa0, 0x00, 0x6f, 0x4f, 0x6c, 0x7c, 0xe8, 0x39, 0xee, 0xe9, 0x98, 0xc0,
+    0xd7, 0x42, 0x61, 0xf6, 0x57, 0x90, 0xee, 0x3b, 0x3c, 0x20, 0xa1, 0x00, 0x6e, 0x7c, 0x6d, 0xf6,
+    0x6e, 0x0b, 0xef, 0xe9, 0x53, 0x17, 0x3a, 0xc0, 0xb1, 0x88, 0x6c, 0x7c, 0x69, 0x75, 0x46, 0x90,
+    0xef, 0x3e, 0x3c, 0xc0, 0xa0, 0x00, 0x60, 0x76, 0x0d, 0xe3, 0x20, 0x4a, 0x80, 0x09, 0x57, 0x97,
+    0x3a, 0x40, 0xa8, 0x44, 0x63, 0x76, 0x6c, 0x76, 0xf7, 0x43, 0xca, 0xac, 0x3a, 0x20, 0xa8, 0x44,
+    0x6f, 0x76, 0x76, 0x50, 0xcc, 0xb0, 0xeb, 0xe9, 0x38, 0x20, 0xa9, 0x00, 0x6f, 0x4e, 0xeb, 0xe9,
+    0xeb, 0x3a, 0x38, 0xc0, 0xa1, 0x00, 0xd7, 0x42, 0xeb, 0x3c, 0x00, 0x08, 0xa6, 0x80, 0x00, 0x40,
+    0xe8, 0xe9, 0x3a, 0x00, 0xa1, 0x00, 0x23, 0x00, 0x80, 0x7d, 0x6e, 0x7c, 0xe8, 0x66, 0x06, 0x94,
+    0x46, 0x96, 0x3a, 0x20, 0xa0, 0x00, 0x0b, 0xe3, 0x20, 0x4a, 0x80, 0x09, 0x55, 0x94, 0x38, 0x20,
+    0xa8, 0x40, 0x63, 0xf5, 0xf3, 0x0b, 0xf8, 0x45, 0x38, 0x00, 0xa8, 0x40, 0x6f, 0xf5, 0x51, 0x15,
+    0xf5, 0x42, 0x38, 0x20, 0xa0, 0x00, 0x6f, 0x57, 0xf9, 0x48, 0xf0, 0x49, 0x96, 0xc0, 0xd7, 0x42,
+    0x50, 0x17, 0xfd, 0x4a, 0x38, 0x60, 0xa0, 0x00, 0x6e, 0x7c, 0xfb, 0x4b, 0xff, 0x4c, 0x06, 0x93,
+    0x46, 0x90, 0x36, 0x00, 0xa1, 0x00, 0x52, 0x93, 0x46, 0x93, 0x98, 0xc0, 0x07, 0xe4, 0x20, 0x4a,
+    0x80, 0x09, 0xf2, 0x41, 0x98, 0xc0, 0x02, 0xe4, 0x20, 0x46, 0x80, 0x09, 0xf7, 0x08, 0x98, 0xc0,
+    0xcc, 0x4f, 0x32, 0xa4, 0x24, 0x30, 0x80, 0x08, 0x94, 0xc0, 0xf2, 0x07, 0xca, 0x4e, 0x36, 0x40,
+    0x00, 0x08, 0xa7, 0x00, 0x00, 0x40, 0xa0, 0x00, 0xf9, 0xc8, 0xff, 0xcc, 0x36, 0x20, 0xa0, 0x00,
+    0xcd, 0xa4, 0xcc, 0x47, 0x94, 0xc0, 0xca, 0x46, 0xe8, 0xe9, 0x36, 0x00, 0xa1, 0x00, 0xfd, 0xca,
+    0x40, 0x97, 0x38, 0x20, 0xa0, 0x00, 0xe8, 0x3d, 0x25, 0x00, 0x80, 0x7d, 0x17, 0x92, 0xeb, 0xe9,
+    0x12, 0x94, 0x53, 0x90, 0x98, 0xc0, 0xf5, 0x0b, 0x05, 0xe4, 0x20, 0x4a, 0x80, 0x09, 0x98, 0xc0,
+    0x04, 0xe4, 0x20, 0x46, 0x80, 0x09, 0xeb, 0x64, 0x10, 0x11, 0xfb, 0x45, 0x11, 0x15, 0xf5, 0x08,
+    0x94, 0xc0, 0xf4, 0x07, 0xf3, 0x43, 0x94, 0xc0, 0xf2, 0x42, 0xf7, 0x41, 0x32, 0xa4, 0x24, 0x30,
+    0x80, 0x08, 0xf8, 0x4d, 0x36, 0x40, 0xa0, 0x00, 0xf9, 0xc8, 0xfb, 0xcb, 0x94, 0xc0, 0xf8, 0xcd,
+    0xfa, 0xc7, 0x94, 0xc0, 0xeb, 0xe9, 0xec, 0xe9, 0x00, 0x90, 0xeb, 0x78, 0x36, 0x80, 0xa0, 0x00,
+    0x57, 0x93, 0x55, 0x92, 0x12, 0x93, 0x00, 0x08, 0xa7, 0x80, 0x00, 0x40, 0x06, 0xe4, 0x20, 0x46,
+    0x80, 0x09, 0x96, 0xc0, 0xec, 0x62, 0x23, 0x00, 0x80, 0x55, 0x98, 0xc0, 0x04, 0xe4, 0x20, 0x4a,
+    0x80, 0x09, 0xf6, 0x07, 0x10, 0x17, 0x51, 0x11, 0x94, 0xc0, 0xfc, 0x45, 0xf3, 0x0b, 0x94, 0xc0,
+    0xf4, 0x08, 0xf2, 0x43, 0x98, 0xc0, 0xcb, 0x4e, 0x32, 0xa4, 0x24, 0x30, 0x80, 0x08, 0x94, 0xc0,
+    0xf5, 0x42, 0xf7, 0x41, 0x9c, 0xc0, 0x75, 0xd0, 0x6c, 0x10, 0xcb, 0x46, 0x35, 0x81, 0x20, 0x00,
+    0x80, 0x00, 0x9a, 0xc0, 0x76, 0x7d, 0xf9, 0xc8, 0x37, 0x81, 0x20, 0x00, 0x80, 0x00, 0x34, 0xff,
+    0x03, 0x93, 0xfc, 0xc7, 0x98, 0xc0, 0x03, 0xe4, 0x20, 0x48, 0x80, 0x09, 0xf8, 0xcd, 0x25, 0xe9,
+    0x2e, 0x8c, 0x12, 0x96, 0xe9, 0x74, 0x90, 0xc0, 0x3e, 0x01, 0xa0, 0x08, 0x54, 0x90, 0xdb, 0x13,
+    0x6d, 0x90, 0x7e, 0xc8, 0x7e, 0xc8, 0x54, 0x90, 0x3e, 0x07, 0xa8, 0x04, 0x00, 0x08, 0xa8, 0x00,
+    0x00, 0x40, 0x90, 0xc0, 0x57, 0x91, 0x90, 0xc0, 0x6d, 0x08, 0xd1, 0x96, 0x66, 0xe5, 0x3e, 0x47,
+    0xa8, 0x04, 0x90, 0xc0, 0x54, 0x94, 0x90, 0xc0, 0x65, 0x66, 0x77, 0xf3, 0x7e, 0xc8, 0x3e, 0x47,
+    0xa8, 0x00, 0x90, 0xc0, 0x21, 0x01, 0x80, 0x80, 0x76, 0xdd, 0x3f, 0x03, 0x80, 0x0e, 0x3c, 0x40,
+    0xb0, 0x00, 0xd4, 0x9b, 0x6d, 0xb4, 0x65, 0x68, 0xf0, 0xc9, 0xfd, 0xca, 0x36, 0x00, 0xb0, 0x80,
+    0x78, 0xe1, 0x63, 0x74, 0x36, 0x00, 0xb0, 0x80, 0x6e, 0x07, 0x6f, 0x74, 0x94, 0xc7, 0x6c, 0x7c,
+    0xc0, 0xff, 0x63, 0xf6, 0x6f, 0xf6, 0x6e, 0xdf, 0xd6, 0xc1, 0x94, 0xc0, 0x6d, 0x7c, 0x84, 0x3c,
+    0x45, 0x91, 0x9a, 0xc0, 0x65, 0x69, 0xd3, 0x12, 0x3b, 0x40, 0x3a, 0x06, 0x80, 0x09, 0x96, 0xc6,
+    0x67, 0x64, 0x6c, 0x10, 0x80, 0x29, 0x94, 0xc0, 0xd5, 0x16, 0xc0, 0x9e, 0x96, 0xc0, 0x34, 0xcf,
+    0x82, 0x10, 0x00, 0x08, 0xa8, 0x80, 0x00, 0x40, 0x6e, 0xa2, 0x3e, 0xc8, 0xcc, 0x47, 0x90, 0xc0,
+    0xec, 0xf9, 0xec, 0x1b, 0x9c, 0xbc, 0xcc, 0x4a, 0x74, 0x72, 0xd4, 0x45, 0x65, 0xe6, 0x65, 0xe8,
+    0x84, 0x3a, 0x92, 0xc3, 0xc7, 0xff, 0x9a, 0xc0, 0x65, 0xe9, 0xd1, 0x13, 0x3c, 0x40, 0x3a, 0x06,
+    0x80, 0x09, 0x96, 0xc6, 0x65, 0x64, 0x6f, 0x90, 0x80, 0x29, 0x94, 0xc0, 0xd5, 0x92, 0xc7, 0x9e,
+    0x96, 0xc0, 0x6d, 0x0b, 0x36, 0xcf, 0x82, 0x10, 0x3d, 0x48, 0xc8, 0x47, 0x90, 0xc0, 0xe8, 0xf9,
+    0xe8, 0x1c, 0x9b, 0xb8, 0xcb, 0x4f, 0x77, 0xf7, 0xd7, 0xc2, 0x98, 0xc0, 0x27, 0xec, 0x9f, 0xc8,
+    0x6c, 0x23, 0xed, 0x58, 0x00, 0x15, 0xe7, 0xec, 0x94, 0xc0, 0x9e, 0x21, 0x9f, 0x21, 0x94, 0xc0,
+    0x96, 0x21, 0x97, 0x21, 0x9f, 0x71, 0x31, 0xe4, 0x3a, 0x68, 0x80, 0x01, 0x31, 0x24, 0x3f, 0x30,
+    0x80, 0x09, 0x83, 0xfb, 0x37, 0x50, 0xca, 0x40, 0x00, 0x08, 0xa9, 0x00, 0x00, 0x40, 0x27, 0x08,
+    0x80, 0x20, 0xe7, 0xe8, 0x38, 0x40, 0x3b, 0x40, 0x80, 0x09, 0xea, 0xfe, 0xe8, 0x1a, 0x1e, 0x90,
+    0xc0, 0x94, 0xf9, 0x41, 0x37, 0xe1, 0x20, 0x50, 0x80, 0x09, 0x32, 0xc4, 0x39, 0x96, 0x80, 0x08,
+    0x2b, 0x82, 0xef, 0xea, 0x2d, 0x10, 0x3b, 0x40, 0x3b, 0x34, 0x80, 0x09, 0xea, 0xef, 0xcf, 0x47,
+    0xf9, 0xc1, 0xea, 0x1b, 0x51, 0x92, 0xb8, 0x7c, 0xf1, 0x42, 0xc1, 0x84, 0x10, 0x01, 0x81, 0x42,
+    0x32, 0xa4, 0x36, 0x30, 0x80, 0x08, 0x02, 0x01, 0x81, 0x40, 0xf9, 0xc1, 0xb0, 0x39, 0x18, 0x01,
+    0x81, 0x44, 0xb8, 0x3d, 0x10, 0x01, 0x81, 0x40, 0xb0, 0x3a, 0xb0, 0x3c, 0xc1, 0xf7, 0x12, 0x01,
+    0x81, 0x46, 0xdc, 0x82, 0xb1, 0x3e, 0xb1, 0xb9, 0x2c, 0x51, 0x11, 0x01, 0x81, 0x54, 0x38, 0x61,
+    0xd8, 0x91, 0xf0, 0x41, 0x33, 0xe8, 0x9f, 0xff, 0x11, 0x01, 0x81, 0x56, 0xc8, 0x46, 0x00, 0x08,
+    0xa9, 0x80, 0x00, 0x40, 0x33, 0xfe, 0x9f, 0xff, 0x11, 0x01, 0x81, 0x50, 0xdf, 0x18, 0xd8, 0x11,
+    0x11, 0x01, 0x81, 0x52, 0x31, 0xe8, 0x9f, 0xff, 0x33, 0xf9, 0x9f, 0xff, 0xdc, 0x98, 0x10, 0x01,
+    0x81, 0x4c, 0xd8, 0x10, 0xf1, 0x43, 0x11, 0x01, 0x81, 0x4e, 0x31, 0xe8, 0x9f, 0xff, 0x33, 0xf9,
+    0x9f, 0xff, 0xdc, 0x98, 0x10, 0x01, 0x81, 0x48, 0x3a, 0x40, 0x3b, 0x4c, 0x80, 0x09, 0xd8, 0x10,
+    0xf1, 0x44, 0x11, 0x01, 0x81, 0x4a, 0x31, 0xe8, 0x9f, 0xff, 0x33, 0xf9, 0x9f, 0xff, 0xdc, 0x98,
+    0x12, 0x91, 0x81, 0x40, 0xea, 0x18, 0x90, 0xba, 0xf1, 0x45, 0xf2, 0x46, 0xf8, 0x47, 0x32, 0xe4,
+    0x39, 0xe4, 0x80, 0x01, 0x17, 0x91, 0x81, 0x44, 0xf8, 0xc7, 0x39, 0x40, 0x3b, 0x4f, 0x80, 0x09,
+    0x90, 0xc0, 0xe8, 0x19, 0xf8, 0x47, 0x2a, 0xff, 0x9e, 0xfd, 0x90, 0xb8, 0x27, 0xe0, 0xf0, 0xc1,
+    0x34, 0xf8, 0x2c, 0x10, 0x00, 0x08, 0xaa, 0x00, 0x00, 0x40, 0xf2, 0xc6, 0xd9, 0x12, 0xdc, 0x9a,
+    0xb1, 0x71, 0x00, 0x1e, 0x39, 0xc8, 0x38, 0x20, 0xbf, 0xff, 0x00, 0x0e, 0xf0, 0xc2, 0x12, 0x91,
+    0xf8, 0xc7, 0xdd, 0x00, 0xd1, 0x20, 0x84, 0x13, 0x39, 0xc8, 0x38, 0x20, 0xbf, 0xff, 0x90, 0xc0,
+    0x52, 0x91, 0xdd, 0x00, 0x65, 0x69, 0x81, 0xfb, 0xf1, 0x41, 0x2a, 0xff, 0x9e, 0xbf, 0x90, 0xb8,
+    0x27, 0xe0, 0xf1, 0xc1, 0xb1, 0x71, 0xf2, 0xc6, 0xb2, 0x72, 0xb6, 0x77, 0xf1, 0xc3, 0x01, 0x86,
+    0x80, 0x20, 0xf1, 0xc4, 0x01, 0x86, 0x80, 0x24, 0xf1, 0xc5, 0x01, 0x86, 0x80, 0x28, 0xd8, 0x97,
+    0x09, 0x01, 0xa0, 0x04, 0xb1, 0x73, 0x2c, 0x10, 0xc1, 0x81, 0x00, 0x86, 0x80, 0x2c, 0x00, 0x86,
+    0x80, 0x30, 0x00, 0x86, 0x80, 0x34, 0x00, 0x86, 0x80, 0x38, 0x27, 0xe8, 0x9f, 0xe0, 0x01, 0x17,
+    0x80, 0x0e, 0x00, 0x17, 0x80, 0x0f, 0x30, 0x24, 0x3f, 0x50, 0x00, 0x08, 0xaa, 0x80, 0x00, 0x40,
+    0x80, 0x09, 0xe7, 0xe8, 0x35, 0x51, 0xcc, 0x56, 0x31, 0x1b, 0x80, 0x03, 0x3d, 0xc2, 0xcd, 0x57,
+    0xc9, 0x43, 0x38, 0x40, 0x3b, 0x40, 0x80, 0x09, 0x01, 0xfc, 0x9f, 0xf4, 0x24, 0xe6, 0xc3, 0x94,
+    0x0c, 0xf1, 0xbf, 0xff, 0xe9, 0x18, 0x1c, 0x91, 0x31, 0xe1, 0x20, 0x50, 0x80, 0x09, 0x80, 0x12,
+    0x68, 0x93, 0x00, 0xfc, 0x9f, 0xf4, 0x64, 0x66, 0xd8, 0x18, 0xd0, 0x10, 0x88, 0x06, 0x78, 0x5e,
+    0x6c, 0x10, 0x2e, 0x10, 0x2f, 0x90, 0xc8, 0x41, 0xc1, 0x8b, 0x2c, 0x11, 0xf1, 0x86, 0x34, 0x70,
+    0xc5, 0x8e, 0xb3, 0x83, 0x6c, 0x7c, 0x33, 0xfe, 0x9f, 0xff, 0x6c, 0x8c, 0x6d, 0x7d, 0x66, 0xe4,
+    0xb5, 0x03, 0xb2, 0x65, 0x34, 0xf5, 0x59, 0x10, 0x2c, 0x99, 0x09, 0x04, 0x80, 0x12, 0xb0, 0x83,
+    0x7c, 0xc8, 0x31, 0x18, 0x80, 0x1f, 0x33, 0x19, 0x9f, 0x00, 0xdc, 0x19, 0x40, 0x14, 0x2c, 0x0a,
+    0x00, 0x08, 0xab, 0x00, 0x00, 0x40, 0x80, 0x2c, 0x50, 0x92, 0x31, 0xe8, 0x9f, 0xff, 0xdf, 0x18,
+    0x06, 0x84, 0x80, 0x2c, 0xf0, 0x85, 0xb0, 0x66, 0xb0, 0x86, 0x31, 0x18, 0x80, 0x0f, 0xb0, 0x21,
+    0x07, 0x10, 0x80, 0x0e, 0xcd, 0x5f, 0x9f, 0x70, 0xcc, 0x5e, 0x2b, 0xff, 0x9d, 0xd1, 0x31, 0x1a,
+    0x80, 0x03, 0x3d, 0x42, 0x31, 0xe1, 0x20, 0x50, 0x80, 0x09, 0xca, 0x42, 0xc2, 0x94, 0x28, 0x92,
+    0x38, 0x40, 0x3b, 0x40, 0x80, 0x09, 0xce, 0x41, 0xe7, 0x48, 0x11, 0x16, 0x80, 0x0f, 0x24, 0xe9,
+    0xea, 0x18, 0x80, 0xae, 0x18, 0x92, 0xef, 0xe9, 0x11, 0x16, 0x80, 0x0e, 0x2c, 0x90, 0xd0, 0xa1,
+    0x84, 0x09, 0x88, 0x30, 0x01, 0x16, 0x80, 0x0e, 0x39, 0x40, 0x3b, 0x34, 0x80, 0x09, 0xca, 0x40,
+    0x90, 0xc0, 0xa1, 0xca, 0x39, 0xc8, 0x38, 0x20, 0xbf, 0xff, 0x90, 0xc0, 0x12, 0x91, 0x39, 0xc8,
+    0x38, 0x20, 0xbf, 0xff, 0xdd, 0x01, 0x00, 0x08, 0xab, 0x80, 0x00, 0x40, 0xd1, 0x20, 0x84, 0x0b,
+    0x52, 0x91, 0xdd, 0x01, 0x65, 0x69, 0x81, 0xfb, 0xca, 0x40, 0x39, 0x40, 0x3b, 0x4f, 0x80, 0x09,
+    0xc8, 0x4e, 0xea, 0x19, 0x2a, 0xff, 0x9d, 0x57, 0x90, 0xba, 0xc8, 0x46, 0xc9, 0xb8, 0x10, 0x07,
+    0x80, 0x42, 0x28, 0x0a, 0x80, 0x40, 0x00, 0x07, 0x80, 0x4c, 0x00, 0x07, 0x80, 0x54, 0x10, 0x92,
+    0xe8, 0xea, 0xe8, 0x39, 0x10, 0x90, 0xea, 0x44, 0xb0, 0x32, 0x51, 0x92, 0x33, 0x20, 0x80, 0x00,
+    0xdc, 0x90, 0x0c, 0x91, 0xa0, 0x00, 0x80, 0x0d, 0x64, 0x68, 0x80, 0x09, 0x30, 0xe8, 0x3f, 0xff,
+    0xbf, 0xff, 0x3c, 0x6e, 0x12, 0x07, 0x80, 0x42, 0x7c, 0x48, 0x64, 0x65, 0x7c, 0x48, 0x74, 0x58,
+    0xd8, 0x98, 0x2c, 0x18, 0x00, 0x97, 0x80, 0x50, 0x7c, 0x48, 0x64, 0x65, 0x7c, 0x48, 0x74, 0x58,
+    0x88, 0x10, 0x00, 0xfe, 0x9f, 0xf8, 0x2c, 0x10, 0xc1, 0x81, 0xf0, 0x04, 0x00, 0x08, 0xac, 0x00,
+    0x00, 0x40, 0x01, 0x16, 0x80, 0x0f, 0xf0, 0x84, 0x30, 0x24, 0x3f, 0x50, 0x80, 0x09, 0xe7, 0x68,
+    0x24, 0x69, 0xd0, 0x10, 0x80, 0x09, 0x88, 0x08, 0x31, 0x01, 0x80, 0x1e, 0x6c, 0x90, 0x64, 0xe8,
+    0x80, 0x05, 0xc1, 0x9f, 0xc0, 0x97, 0x2c, 0x31, 0x01, 0xe4, 0x20, 0x30, 0x80, 0x09, 0xc2, 0x86,
+    0x6c, 0x98, 0x6c, 0x51, 0x30, 0xa4, 0x36, 0x10, 0x80, 0x08, 0x6c, 0x90, 0x31, 0x24, 0x3f, 0x30,
+    0x80, 0x09, 0x83, 0xfb, 0x37, 0x50, 0xc1, 0xb4, 0x30, 0xe1, 0x20, 0x8c, 0x80, 0x09, 0x28, 0x06,
+    0x07, 0x04, 0x38, 0x70, 0x80, 0x0a, 0x3f, 0xe3, 0xe7, 0x48, 0x2c, 0x90, 0xf1, 0x41, 0xc8, 0x40,
+    0xcf, 0x40, 0x32, 0xe4, 0x3c, 0x8a, 0x80, 0x01, 0xee, 0xe9, 0x33, 0xc4, 0x39, 0x96, 0x80, 0x08,
+    0x27, 0x69, 0xcf, 0x48, 0xc9, 0x40, 0x92, 0xc2, 0xc0, 0x9c, 0xb8, 0x4a, 0x80, 0x18, 0x92, 0xc2,
+    0x51, 0x90, 0x00, 0x08, 0xac, 0x80, 0x00, 0x40, 0x11, 0x90, 0xd3, 0x21, 0x84, 0x09, 0x88, 0x0c,
+    0x20, 0x00, 0x80, 0xb0, 0x20, 0x00, 0x81, 0x44, 0x51, 0x90, 0x2c, 0x90, 0xd4, 0x41, 0xb0, 0x49,
+    0x18, 0x96, 0x81, 0x30, 0x08, 0x11, 0x30, 0xe8, 0x3f, 0xff, 0xbf, 0xff, 0x01, 0x01, 0x80, 0x28,
+    0x01, 0x11, 0x80, 0x0c, 0x18, 0x96, 0x81, 0xde, 0x08, 0x01, 0x80, 0x2a, 0x18, 0x96, 0x81, 0xe0,
+    0x08, 0x01, 0x80, 0x2c, 0xb8, 0xc9, 0x3e, 0x17, 0x81, 0x90, 0x07, 0x01, 0x80, 0x30, 0x01, 0x01,
+    0x80, 0x2e, 0x22, 0x40, 0x80, 0x00, 0xe7, 0x68, 0x01, 0x00, 0x80, 0x70, 0x01, 0x00, 0x80, 0x72,
+    0x02, 0x00, 0x80, 0x74, 0x01, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x84, 0x01, 0x80, 0x80, 0x88,
+    0x30, 0x24, 0x3f, 0x50, 0x80, 0x09, 0x00, 0x80, 0x80, 0x8c, 0x83, 0x49, 0x32, 0xe1, 0x20, 0x8c,
+    0x80, 0x09, 0xc1, 0xb4, 0x29, 0x11, 0x08, 0x86, 0x00, 0x08, 0xad, 0x00, 0x00, 0x40, 0x3a, 0x58,
+    0x80, 0x09, 0xcf, 0x42, 0xe7, 0x50, 0xbe, 0xf9, 0xb0, 0x82, 0x3c, 0x63, 0xc9, 0x4f, 0xb6, 0xf1,
+    0x00, 0xe0, 0x21, 0x48, 0x80, 0x09, 0x2f, 0x08, 0x80, 0x0c, 0xb0, 0xf3, 0x32, 0xa4, 0x23, 0xf0,
+    0x80, 0x08, 0xf8, 0x43, 0x35, 0x50, 0x34, 0x70, 0x11, 0x86, 0x80, 0x80, 0x30, 0x71, 0xc9, 0x47,
+    0x84, 0x26, 0xf8, 0xc3, 0x3c, 0x50, 0x0b, 0x96, 0x80, 0x90, 0x25, 0x61, 0x99, 0x99, 0x20, 0x4d,
+    0xda, 0x11, 0x21, 0x01, 0x85, 0x1e, 0x61, 0xf4, 0x6d, 0xf4, 0x39, 0x73, 0x9f, 0xbe, 0x7d, 0xf0,
+    0x88, 0x0a, 0x03, 0x86, 0x80, 0x80, 0x00, 0x86, 0x80, 0x80, 0x13, 0x86, 0x80, 0x80, 0x11, 0x86,
+    0x80, 0x8c, 0x30, 0xf3, 0x02, 0x06, 0x80, 0x90, 0x30, 0x28, 0x3b, 0x64, 0xbf, 0xdf, 0x80, 0x22,
+    0x94, 0xc2, 0x03, 0x86, 0x80, 0x8c, 0xd8, 0x91, 0x22, 0x74, 0xd9, 0x93, 0x2e, 0x74, 0x00, 0x08,
+    0xad, 0x80, 0x00, 0x40, 0x32, 0xc0, 0x24, 0x9b, 0x80, 0x20, 0x60, 0x75, 0x6c, 0x75, 0x6c, 0x40,
+    0x7c, 0x70, 0x00, 0x86, 0x80, 0x8c, 0x10, 0x86, 0x80, 0x8c, 0x36, 0x10, 0x8a, 0x00, 0x80, 0x13,
+    0x30, 0x81, 0x20, 0x00, 0x80, 0x00, 0x00, 0x86, 0x80, 0x68, 0x88, 0x6c, 0x20, 0x00, 0x9f, 0xff,
+    0x36, 0x10, 0x8e, 0x80, 0x80, 0x13, 0x30, 0x81, 0x20, 0x00, 0x80, 0x00, 0x00, 0x86, 0x80, 0x68,
+    0x88, 0x56, 0x20, 0x00, 0x9f, 0xff, 0x36, 0x10, 0x8f, 0x80, 0x80, 0x13, 0x30, 0xe1, 0x3a, 0xe1,
+    0x80, 0x00, 0x00, 0x86, 0x80, 0x68, 0x88, 0x40, 0x20, 0x00, 0x9f, 0xff, 0x36, 0x10, 0x95, 0xff,
+    0x80, 0x13, 0x30, 0x80, 0x20, 0x00, 0x80, 0x03, 0x00, 0x86, 0x80, 0x68, 0x88, 0x2a, 0x20, 0x20,
+    0x9f, 0xff, 0x36, 0x10, 0x98, 0xff, 0x80, 0x13, 0x30, 0x00, 0x20, 0x00, 0x80, 0x04, 0x00, 0x86,
+    0x80, 0x68, 0x88, 0x14, 0x00, 0x08, 0xae, 0x00, 0x00, 0x40, 0x20, 0x60, 0x9f, 0xff, 0x30, 0xc0,
+    0x20, 0x00, 0x80, 0x04, 0x00, 0x86, 0x80, 0x68, 0x20, 0x60, 0x9f, 0xff, 0x0c, 0x96, 0xa0, 0x00,
+    0x00, 0xe0, 0x21, 0x44, 0x80, 0x09, 0x01, 0x06, 0x27, 0x64, 0x80, 0x0a, 0x80, 0x22, 0x10, 0x86,
+    0x80, 0x68, 0x70, 0xf0, 0x80, 0x45, 0x10, 0x07, 0x80, 0x24, 0x38, 0x61, 0xd4, 0x20, 0x80, 0x3a,
+    0x00, 0x07, 0x80, 0x24, 0x30, 0xe8, 0x3f, 0xff, 0xbf, 0xff, 0xdf, 0x00, 0x88, 0x2d, 0x70, 0xf0,
+    0x84, 0x29, 0x10, 0x06, 0x80, 0x6c, 0x78, 0x41, 0x34, 0x70, 0x00, 0x06, 0x80, 0x6c, 0x36, 0x10,
+    0x80, 0x7f, 0x84, 0x1d, 0x00, 0xe4, 0x21, 0x48, 0x80, 0x09, 0x3e, 0x10, 0x84, 0xb0, 0x00, 0x07,
+    0x80, 0x24, 0x88, 0x0c, 0x09, 0x96, 0xa0, 0x00, 0x6c, 0x10, 0x00, 0x06, 0x80, 0x6c, 0x10, 0x91,
+    0x31, 0xf8, 0x3f, 0xff, 0xb7, 0xff, 0x2c, 0x10, 0x0c, 0x10, 0x00, 0x08, 0xae, 0x80, 0x00, 0x40,
+    0xa0, 0x02, 0x80, 0x09, 0xdf, 0x01, 0x88, 0x2e, 0xb6, 0x71, 0x2c, 0x90, 0x0d, 0x46, 0xa0, 0x00,
+    0x80, 0x0f, 0x30, 0xf8, 0x3f, 0xff, 0xb7, 0xff, 0xdf, 0x00, 0x01, 0x17, 0x80, 0x0c, 0xb6, 0x71,
+    0x1a, 0x17, 0x80, 0x0c, 0x3b, 0xe0, 0x21, 0x28, 0x80, 0x09, 0xf9, 0x41, 0xaa, 0xda, 0xe9, 0xef,
+    0x9a, 0x63, 0xd8, 0x10, 0x09, 0x96, 0x80, 0x74, 0x20, 0x31, 0xe7, 0x70, 0x6c, 0x50, 0x30, 0x24,
+    0x3f, 0x50, 0x80, 0x09, 0xd8, 0x18, 0xba, 0xc9, 0x19, 0x11, 0x30, 0xf8, 0x3f, 0xff, 0xaf, 0xff,
+    0xb1, 0xd1, 0x32, 0xf8, 0x3f, 0xff, 0x9f, 0xff, 0xdc, 0x80, 0xdc, 0x82, 0x32, 0xf0, 0x3f, 0xff,
+    0xbf, 0xff, 0xdc, 0x82, 0xc9, 0x48, 0x3c, 0x41, 0x0d, 0x41, 0xa0, 0x00, 0x80, 0x10, 0x31, 0x78,
+    0x9e, 0x00, 0x32, 0xf8, 0x3f, 0xff, 0xbf, 0xbf, 0x88, 0x16, 0xdc, 0x82, 0xc2, 0x81, 0x92, 0x98,
+    0x00, 0x08, 0xaf, 0x00, 0x00, 0x40, 0x02, 0xe4, 0x21, 0x48, 0x80, 0x09, 0x3e, 0x12, 0x8c, 0x80,
+    0x02, 0x00, 0x80, 0x1a, 0x9f, 0x70, 0xb1, 0x51, 0x34, 0xd0, 0x2c, 0x10, 0x39, 0x08, 0x20, 0x00,
+    0x80, 0x00, 0xc8, 0x41, 0x31, 0x09, 0x20, 0x00, 0x80, 0x00, 0xe9, 0x88, 0x84, 0x0b, 0xc8, 0x4a,
+    0xdc, 0xa2, 0x70, 0xfa, 0x81, 0xfd, 0x64, 0xe9, 0x80, 0x21, 0x35, 0x51, 0xca, 0x41, 0x3d, 0x41,
+    0xc9, 0x40, 0x90, 0xc0, 0xea, 0x19, 0xea, 0x88, 0x80, 0x07, 0xe8, 0x3a, 0xd4, 0x42, 0x24, 0x60,
+    0xdc, 0xa2, 0x24, 0xe9, 0x64, 0x6e, 0x85, 0xe5, 0x9f, 0x71, 0x36, 0xd0, 0x24, 0xe9, 0x35, 0xc1,
+    0xf0, 0x85, 0xd2, 0x15, 0x66, 0x64, 0x6c, 0x7d, 0x2d, 0x20, 0xd6, 0x94, 0x66, 0xe1, 0x80, 0x0c,
+    0x6c, 0x4d, 0x33, 0xe4, 0x3c, 0x48, 0x80, 0x01, 0x88, 0x05, 0x6c, 0x10, 0x30, 0x24, 0x3e, 0xe0,
+    0x80, 0x09, 0x74, 0xf2, 0x2b, 0xff, 0x00, 0x08, 0xaf, 0x80, 0x00, 0x40, 0x9c, 0xbd, 0x37, 0xd0,
+    0xe7, 0x48, 0xf0, 0xc9, 0x30, 0xf0, 0x6c, 0x11, 0x64, 0x60, 0x84, 0x4a, 0x96, 0xc3, 0x06, 0xe7,
+    0x21, 0x44, 0x80, 0x09, 0x83, 0x7b, 0x34, 0xd0, 0xf4, 0xca, 0x20, 0x00, 0x80, 0x64, 0x3c, 0xcf,
+    0x6c, 0x7c, 0x83, 0x6c, 0x34, 0x54, 0xf1, 0x42, 0x7c, 0x4f, 0x64, 0x60, 0x64, 0x69, 0x84, 0x05,
+    0xc0, 0x81, 0x34, 0xd0, 0xf0, 0xc2, 0x83, 0x9a, 0x24, 0xe1, 0x18, 0x01, 0xa0, 0x0f, 0x28, 0x80,
+    0x80, 0x00, 0xc9, 0x40, 0xe8, 0xf8, 0xe8, 0x39, 0xc8, 0x4e, 0x27, 0x66, 0x02, 0xe7, 0x21, 0x44,
+    0x80, 0x09, 0x6e, 0x7d, 0x10, 0x7c, 0x9f, 0xd7, 0x64, 0x69, 0x80, 0x2f, 0x27, 0xe9, 0x34, 0xd7,
+    0x30, 0x08, 0x20, 0x00, 0x80, 0x00, 0x80, 0x23, 0x83, 0x68, 0x18, 0x01, 0xa0, 0x0f, 0x34, 0xfe,
+    0x02, 0xe7, 0x21, 0x44, 0x80, 0x09, 0x36, 0x03, 0x80, 0x01, 0x34, 0x00, 0x00, 0x08, 0xb0, 0x00,
+    0x00, 0x40, 0x80, 0x01, 0xd8, 0x10, 0xd4, 0x43, 0x30, 0xce, 0x94, 0x4f, 0x6e, 0x7d, 0x32, 0xa4,
+    0x36, 0x10, 0x80, 0x08, 0x34, 0x7e, 0x01, 0xe4, 0x21, 0x44, 0x80, 0x09, 0x30, 0x24, 0x3f, 0x50,
+    0x80, 0x09, 0x34, 0x78, 0xe7, 0x68, 0x2b, 0xff, 0x9c, 0x17, 0xbe, 0xc9, 0x19, 0x11, 0xe7, 0x50,
+    0xb7, 0xf1, 0x09, 0x17, 0xb0, 0x00, 0x31, 0xf8, 0x3f, 0xff, 0x9f, 0xff, 0xdf, 0x81, 0x31, 0xf0,
+    0x3f, 0xff, 0xbf, 0xff, 0xc9, 0x48, 0x3c, 0x41, 0xdf, 0x81, 0x0d, 0x87, 0xa0, 0x00, 0x31, 0x7e,
+    0x9e, 0x00, 0x80, 0x4c, 0xef, 0xe8, 0x2c, 0x10, 0x0c, 0x97, 0xa0, 0x00, 0x80, 0x0f, 0xc1, 0xff,
+    0xb1, 0x7a, 0xc1, 0x84, 0x91, 0x9f, 0x88, 0x30, 0xf0, 0x08, 0xc0, 0x83, 0x90, 0x9f, 0xb2, 0xf7,
+    0xf2, 0x41, 0xb2, 0xf4, 0xf2, 0x42, 0x02, 0xe5, 0x21, 0x4a, 0x80, 0x09, 0xb1, 0xf3, 0xb0, 0xf2,
+    0x2a, 0xff, 0x00, 0x08, 0xb0, 0x80, 0x00, 0x40, 0x9f, 0x01, 0x02, 0x7c, 0x9f, 0xf7, 0xd8, 0x10,
+    0xd8, 0x96, 0x24, 0x31, 0x00, 0x97, 0x80, 0x1c, 0x00, 0xfe, 0x9f, 0xf0, 0x20, 0xe0, 0x97, 0xff,
+    0x88, 0x1c, 0xdf, 0x80, 0x0c, 0x97, 0xa0, 0x00, 0x80, 0x0d, 0x21, 0xe0, 0x97, 0xff, 0xc0, 0x82,
+    0x88, 0x06, 0xdf, 0x81, 0xc0, 0x81, 0x6c, 0x90, 0x90, 0x9f, 0xf1, 0x08, 0xc0, 0x81, 0x00, 0x06,
+    0x80, 0x70, 0xb7, 0x71, 0xf0, 0x88, 0x30, 0x24, 0x3f, 0x50, 0x80, 0x09, 0xe7, 0x70, 0xb9, 0xc9,
+    0x31, 0xf8, 0x3f, 0xff, 0xaf, 0xff, 0xb0, 0xc9, 0xdc, 0x01, 0x09, 0x30, 0xa0, 0x00, 0x31, 0xf0,
+    0x3f, 0xff, 0xbf, 0xff, 0xdc, 0x01, 0x0d, 0x80, 0xa0, 0x00, 0x80, 0x3d, 0x0c, 0x90, 0xa0, 0x00,
+    0x80, 0x11, 0xc2, 0x84, 0x92, 0x98, 0xc1, 0xff, 0xb1, 0x42, 0x88, 0x6c, 0x01, 0x00, 0x80, 0x16,
+    0xb1, 0xc2, 0x24, 0xe8, 0x01, 0xe4, 0x21, 0x48, 0x00, 0x08, 0xb1, 0x00, 0x00, 0x40, 0x80, 0x09,
+    0x80, 0x0b, 0x3e, 0x11, 0x86, 0x40, 0xb1, 0x42, 0xb1, 0x41, 0xb1, 0xc1, 0x38, 0xe1, 0xd4, 0xa1,
+    0x80, 0x4c, 0xb1, 0x41, 0xc1, 0x83, 0x91, 0x98, 0x8f, 0xd8, 0xc1, 0xff, 0x0c, 0x90, 0xa0, 0x00,
+    0x80, 0x0d, 0xc1, 0x82, 0x91, 0x98, 0xc1, 0xff, 0x88, 0x34, 0xb1, 0x42, 0xb1, 0xc2, 0x24, 0xe8,
+    0x01, 0xe4, 0x21, 0x48, 0x80, 0x09, 0x80, 0x0b, 0x3e, 0x11, 0x86, 0x40, 0xb1, 0x42, 0xb1, 0x41,
+    0xb1, 0xc1, 0x38, 0xe1, 0xd4, 0xa1, 0x80, 0x16, 0xb1, 0x41, 0xc1, 0x81, 0x91, 0x98, 0x01, 0xe4,
+    0x21, 0x48, 0x80, 0x09, 0x3e, 0x11, 0x8c, 0x80, 0x01, 0x00, 0x80, 0x1a, 0xb0, 0x49, 0x9f, 0x70,
+    0x6c, 0x10, 0x2b, 0xff, 0x9a, 0xd7, 0xbe, 0xc9, 0x19, 0x11, 0xe7, 0x50, 0xb7, 0xf1, 0x09, 0x17,
+    0xb0, 0x00, 0x30, 0xf0, 0x3f, 0xff, 0xbf, 0xff, 0x09, 0x37, 0xa0, 0x00, 0xc9, 0x49, 0x00, 0x08,
+    0xb1, 0x80, 0x00, 0x40, 0x3c, 0xc1, 0xdf, 0x80, 0x0d, 0x87, 0xa0, 0x00, 0x33, 0x7e, 0x9e, 0x00,
+    0x80, 0x9a, 0xef, 0xe8, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x11, 0x06, 0x80, 0x66, 0x10, 0x00,
+    0x81, 0x04, 0x70, 0xf0, 0x84, 0x87, 0x3f, 0x88, 0x80, 0x00, 0x64, 0x60, 0x64, 0x69, 0x84, 0x61,
+    0xb2, 0xf7, 0xf2, 0x41, 0xb2, 0xf4, 0xf2, 0x42, 0x02, 0xe5, 0x21, 0x4a, 0x80, 0x09, 0xb1, 0xf3,
+    0xb0, 0xf2, 0x2a, 0xff, 0x9d, 0xc1, 0x02, 0x7c, 0x9f, 0xf7, 0xd8, 0x96, 0xd8, 0x10, 0x25, 0x31,
+    0x11, 0x07, 0x80, 0x16, 0x24, 0xe8, 0x00, 0x97, 0x80, 0x1c, 0x80, 0x18, 0x02, 0xfe, 0x9f, 0xf0,
+    0x08, 0xe4, 0x21, 0x48, 0x80, 0x09, 0x90, 0xc0, 0xe8, 0xfc, 0x08, 0x07, 0x80, 0x16, 0x08, 0x07,
+    0x80, 0x14, 0x10, 0x07, 0x80, 0x14, 0x38, 0x61, 0xd4, 0x21, 0x80, 0x2a, 0x00, 0x07, 0x80, 0x14,
+    0xc0, 0x85, 0x09, 0x17, 0x00, 0x08, 0xb2, 0x00, 0x00, 0x40, 0xa8, 0x00, 0x90, 0x9f, 0x88, 0x1c,
+    0x09, 0x17, 0xa0, 0x40, 0x2c, 0x90, 0xc2, 0x84, 0x92, 0x9f, 0xc2, 0xff, 0x30, 0xf8, 0x3f, 0xff,
+    0xbf, 0xbf, 0xdf, 0x80, 0xf1, 0x08, 0x02, 0x07, 0x80, 0x16, 0xc0, 0xff, 0x88, 0xbe, 0xb0, 0x7a,
+    0x30, 0xf8, 0x3f, 0xff, 0xb7, 0xff, 0xdf, 0x80, 0x0d, 0x87, 0xa0, 0x00, 0x80, 0x59, 0x2c, 0x90,
+    0x0c, 0x97, 0xa0, 0x00, 0x80, 0x13, 0xc0, 0x84, 0x32, 0xf8, 0x3f, 0xff, 0xbf, 0xbf, 0x90, 0x9f,
+    0xdf, 0x82, 0x88, 0x38, 0xf1, 0x08, 0xc0, 0x83, 0x32, 0x00, 0x20, 0x00, 0x80, 0x40, 0x90, 0x9f,
+    0xdf, 0x9a, 0xb2, 0xf7, 0xf2, 0x41, 0xb2, 0xf4, 0xf2, 0x42, 0x02, 0xe5, 0x21, 0x4a, 0x80, 0x09,
+    0xb1, 0xf3, 0xb0, 0xf2, 0x2a, 0xff, 0x9d, 0x15, 0x02, 0x7c, 0x9f, 0xf7, 0xd8, 0x10, 0xd8, 0x96,
+    0x24, 0x31, 0x00, 0x97, 0x80, 0x1c, 0x00, 0xfe, 0x9f, 0xf0, 0x00, 0x08, 0xb2, 0x80, 0x00, 0x40,
+    0xc0, 0xff, 0xb0, 0x7a, 0x88, 0x5c, 0x00, 0x07, 0x80, 0x16, 0x30, 0xf8, 0x3f, 0xff, 0xbf, 0xbf,
+    0xdf, 0x80, 0x0c, 0x97, 0xa0, 0x00, 0x80, 0x0f, 0xc1, 0x82, 0x91, 0x9f, 0xc1, 0xff, 0xb1, 0x7a,
+    0x88, 0x3c, 0xdf, 0x80, 0xb1, 0xfa, 0x24, 0xe8, 0x01, 0xe4, 0x21, 0x48, 0x80, 0x09, 0x80, 0x0b,
+    0x3e, 0x11, 0x86, 0x40, 0xb1, 0x7a, 0xb1, 0x79, 0xb1, 0xf9, 0x38, 0xe1, 0xd4, 0xa1, 0x80, 0x1a,
+    0xb1, 0x79, 0xc1, 0x81, 0x91, 0x9f, 0x01, 0xe4, 0x21, 0x48, 0x80, 0x09, 0x3e, 0x11, 0x8c, 0x80,
+    0xdf, 0x80, 0x88, 0x0a, 0x01, 0x07, 0x80, 0x1a, 0x09, 0x17, 0xa0, 0x40, 0x6c, 0x10, 0xf0, 0x08,
+    0xb7, 0x71, 0xf0, 0x88, 0x30, 0x24, 0x3f, 0x50, 0x80, 0x09, 0xe7, 0x70, 0xb9, 0xc9, 0x32, 0xf8,
+    0x3f, 0xff, 0xaf, 0xff, 0xb0, 0xc9, 0xdc, 0x02, 0x32, 0xf8, 0x3f, 0xff, 0x9f, 0xff, 0x11, 0x90,
+    0x00, 0x08, 0xb3, 0x00, 0x00, 0x40, 0x80, 0x1e, 0xdc, 0x02, 0xb2, 0xc2, 0x25, 0x68, 0x33, 0xf8,
+    0x3f, 0xff, 0xbf, 0xbf, 0x33, 0x19, 0x8f, 0x00, 0x3c, 0xe8, 0x09, 0x50, 0xa0, 0x00, 0x80, 0x14,
+    0xdc, 0x03, 0x3e, 0x11, 0x83, 0x20, 0x02, 0xe4, 0x21, 0x48, 0x80, 0x09, 0x68, 0xb8, 0xb1, 0x42,
+    0xb1, 0x41, 0xb1, 0xc4, 0x24, 0xe8, 0x01, 0xe4, 0x21, 0x48, 0x80, 0x09, 0x80, 0x0b, 0x3e, 0x11,
+    0x86, 0x40, 0xb1, 0x44, 0xb1, 0x43, 0x0d, 0x80, 0xa0, 0x00, 0x80, 0x4b, 0x0a, 0x86, 0x3a, 0x58,
+    0x80, 0x09, 0x12, 0x01, 0x80, 0x66, 0x11, 0x02, 0x81, 0x04, 0x71, 0x71, 0x84, 0x39, 0x11, 0x00,
+    0x80, 0x16, 0x24, 0xe8, 0x0a, 0xe4, 0x21, 0x48, 0x80, 0x09, 0x80, 0x0d, 0xea, 0xfe, 0x0a, 0x00,
+    0x80, 0x16, 0x0a, 0x00, 0x80, 0x14, 0x11, 0x00, 0x80, 0x14, 0x38, 0xe1, 0xd4, 0xa1, 0x80, 0x0e,
+    0x01, 0x00, 0x80, 0x14, 0xc1, 0x86, 0x00, 0x08, 0xb3, 0x80, 0x00, 0x40, 0x91, 0x98, 0x09, 0x10,
+    0xa8, 0x00, 0xc1, 0xff, 0xb1, 0x42, 0x88, 0x76, 0xb1, 0x44, 0x31, 0xf8, 0x3f, 0xff, 0xb7, 0xff,
+    0xdc, 0x01, 0x0d, 0x80, 0xa0, 0x00, 0x80, 0x27, 0x0c, 0x90, 0xa0, 0x00, 0xc2, 0xff, 0x80, 0x0c,
+    0xb2, 0x44, 0xc1, 0x84, 0x91, 0x98, 0x88, 0x52, 0xb2, 0x42, 0xb3, 0xc1, 0x39, 0xe1, 0xd5, 0xa1,
+    0x80, 0x48, 0xb3, 0x41, 0xc3, 0x83, 0x93, 0x98, 0x88, 0x40, 0xdc, 0x01, 0x0c, 0x90, 0xa0, 0x00,
+    0x80, 0x17, 0xb1, 0xc3, 0x38, 0xe1, 0xd4, 0xa1, 0xc2, 0xff, 0xb1, 0x43, 0x80, 0x2c, 0xb2, 0x42,
+    0xc1, 0x82, 0x88, 0x26, 0x91, 0x98, 0xb3, 0xc1, 0x39, 0xe1, 0xd5, 0xa1, 0xc2, 0xff, 0xb3, 0x41,
+    0x80, 0x18, 0xb2, 0x44, 0xc3, 0x81, 0x93, 0x98, 0x03, 0xe4, 0x21, 0x48, 0x80, 0x09, 0x3e, 0x13,
+    0x8c, 0x80, 0xdc, 0x01, 0x03, 0x00, 0x80, 0x1a, 0x02, 0x00, 0x80, 0x16, 0x00, 0x08, 0xb4, 0x00,
+    0x00, 0x40, 0xb0, 0x49, 0x9f, 0x70, 0x6c, 0x10, 0x2b, 0xff, 0x98, 0x35, 0xbe, 0xc9, 0x19, 0x11,
+    0xe7, 0x50, 0xc9, 0x49, 0x3c, 0xc1, 0x30, 0xf8, 0x3f, 0xff, 0x9f, 0xff, 0xb7, 0xf1, 0x09, 0x17,
+    0xb0, 0x00, 0xdf, 0x80, 0x33, 0x7e, 0x9e, 0x00, 0xf6, 0x08, 0x09, 0x57, 0xa0, 0x00, 0x0d, 0x87,
+    0xa0, 0x00, 0xf0, 0x88, 0xef, 0xe8, 0x80, 0x70, 0xf0, 0x07, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09,
+    0x11, 0x06, 0x80, 0x66, 0x10, 0x00, 0x81, 0x04, 0x70, 0xf0, 0x84, 0x5d, 0x2c, 0x90, 0x0c, 0x97,
+    0xa0, 0x00, 0x80, 0x19, 0xc2, 0x84, 0x92, 0x9f, 0xc2, 0xff, 0x30, 0xf8, 0x3f, 0xff, 0xbf, 0xbf,
+    0xdf, 0x80, 0xf1, 0x07, 0x88, 0x3a, 0x02, 0x07, 0x80, 0x16, 0x32, 0x00, 0x20, 0x00, 0x80, 0x40,
+    0xdf, 0x9a, 0xb2, 0xf7, 0xf2, 0x41, 0xb2, 0xf4, 0xf2, 0x42, 0x02, 0xe5, 0x21, 0x4a, 0x80, 0x09,
+    0xb1, 0xf3, 0x00, 0x08, 0xb4, 0x80, 0x00, 0x40, 0xb0, 0xf2, 0x2a, 0xff, 0x9a, 0xfd, 0x02, 0x7c,
+    0x9f, 0xf7, 0xd8, 0x10, 0xd8, 0x96, 0x24, 0xb1, 0x00, 0x97, 0x80, 0x1c, 0xc0, 0x85, 0x90, 0x9f,
+    0x01, 0xfe, 0x9f, 0xf2, 0xc0, 0xff, 0x88, 0x9a, 0x09, 0x17, 0xa8, 0x00, 0x08, 0x86, 0x3a, 0x58,
+    0x80, 0x09, 0x31, 0xf8, 0x3f, 0xff, 0xbf, 0xbf, 0x10, 0x06, 0x80, 0x66, 0xdf, 0x81, 0x11, 0x00,
+    0x81, 0x04, 0x30, 0xf0, 0xc0, 0xff, 0x84, 0x73, 0x2d, 0x10, 0x0c, 0x97, 0xa0, 0x00, 0x80, 0x13,
+    0xc0, 0x84, 0x90, 0x9f, 0xc1, 0xff, 0xb1, 0x7a, 0xf2, 0x07, 0x88, 0x68, 0x01, 0x07, 0x80, 0x16,
+    0xb0, 0xfa, 0x24, 0x68, 0x09, 0x17, 0xa0, 0x40, 0x80, 0x11, 0x00, 0xe4, 0x21, 0x48, 0x80, 0x09,
+    0x3e, 0x10, 0x86, 0x40, 0xb0, 0x7a, 0xb0, 0x79, 0xb0, 0xf9, 0x38, 0x61, 0xd4, 0x21, 0x80, 0x10,
+    0xb0, 0x79, 0xc0, 0x83, 0x31, 0xf8, 0x3f, 0xff, 0x00, 0x08, 0xb5, 0x00, 0x00, 0x40, 0xb7, 0xff,
+    0x90, 0x9f, 0xdf, 0x81, 0xb2, 0xf7, 0xf2, 0x41, 0xb2, 0xf4, 0xf2, 0x42, 0x02, 0xe5, 0x21, 0x4a,
+    0x80, 0x09, 0xb1, 0xf3, 0xb0, 0xf2, 0x2a, 0xff, 0x9a, 0x67, 0x02, 0x7c, 0x9f, 0xf7, 0xd8, 0x10,
+    0xd8, 0x96, 0x24, 0x31, 0x00, 0x97, 0x80, 0x1c, 0x88, 0x10, 0x00, 0xfe, 0x9f, 0xf2, 0x09, 0x17,
+    0xa8, 0x00, 0x09, 0x17, 0xa0, 0x40, 0xb0, 0x7a, 0xb7, 0x71, 0xf0, 0x87, 0x30, 0x24, 0x3f, 0x50,
+    0x80, 0x09, 0xe7, 0x70, 0xb9, 0xc9, 0x31, 0xf8, 0x3f, 0xff, 0xaf, 0xff, 0xb0, 0xc9, 0xdc, 0x01,
+    0x09, 0x30, 0xa0, 0x00, 0x09, 0x50, 0xa0, 0x00, 0x0c, 0x80, 0xa0, 0x00, 0x80, 0x0b, 0x11, 0x90,
+    0x80, 0x22, 0x88, 0x06, 0x78, 0xc1, 0x6c, 0x90, 0x09, 0x10, 0xa8, 0x00, 0x0c, 0x90, 0xa0, 0x00,
+    0x80, 0x10, 0x01, 0x00, 0x80, 0x22, 0xc1, 0x86, 0x91, 0x98, 0xc1, 0xff, 0x88, 0x26, 0x00, 0x08,
+    0xb5, 0x80, 0x00, 0x40, 0xb1, 0x42, 0xb1, 0xc2, 0x24, 0xe8, 0x01, 0xe4, 0x21, 0x48, 0x80, 0x09,
+    0x80, 0x0b, 0x3e, 0x11, 0x86, 0x40, 0xb1, 0x42, 0xb1, 0x41, 0xb1, 0xc1, 0x38, 0xe1, 0xd4, 0xa1,
+    0x80, 0x08, 0xb1, 0x41, 0xc1, 0x85, 0x91, 0x98, 0x12, 0x90, 0x80, 0x22, 0x11, 0x90, 0x80, 0x24,
+    0x30, 0xfa, 0x2c, 0x90, 0xc2, 0x82, 0x80, 0x09, 0x92, 0x98, 0x01, 0x00, 0x80, 0x22, 0xb0, 0x49,
+    0x9f, 0x70, 0x6c, 0x10, 0x24, 0x68, 0x74, 0xd0, 0x84, 0x2e, 0x92, 0xc3, 0xc0, 0xff, 0x96, 0xc0,
+    0x64, 0xe9, 0xd2, 0x11, 0xc2, 0x83, 0x96, 0xc6, 0x7a, 0x61, 0x6c, 0x10, 0x80, 0x21, 0xd0, 0x11,
+    0x31, 0x05, 0x80, 0x1e, 0x2d, 0x89, 0x7e, 0xc3, 0x74, 0x73, 0x6c, 0x7c, 0xd4, 0x9c, 0x64, 0xe5,
+    0x33, 0x18, 0x80, 0x07, 0xdc, 0x1d, 0x9f, 0x71, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0,
+    0x90, 0xc0, 0x90, 0xc0, 0x00, 0x08, 0xb6, 0x00, 0x00, 0x40, 0x76, 0x51, 0x94, 0xc0, 0x6c, 0x7d,
+    0x9f, 0x70, 0x74, 0x54, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x70, 0x71, 0x94, 0xc0, 0xd0, 0xd8,
+    0x9f, 0x70, 0x74, 0x71, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x76, 0xd0, 0x94, 0xc0, 0x6d, 0x7c,
+    0x9f, 0x70, 0x74, 0x55, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x70, 0x71, 0x94, 0xc0, 0xd0, 0x59,
+    0x9f, 0x70, 0x74, 0x70, 0x33, 0x24, 0x3f, 0x30, 0x80, 0x09, 0x37, 0x51, 0x34, 0xd0, 0xc2, 0x81,
+    0x2e, 0x7c, 0x74, 0x51, 0xd3, 0x21, 0x84, 0x0d, 0x32, 0x24, 0x3e, 0xe0, 0x80, 0x09, 0xf1, 0x8d,
+    0x88, 0xcd, 0x32, 0xa4, 0x35, 0xc0, 0x80, 0x08, 0x34, 0x56, 0xce, 0x41, 0x35, 0xd0, 0x2e, 0x10,
+    0x2f, 0x90, 0x36, 0xd6, 0x38, 0x40, 0x3b, 0x78, 0x80, 0x09, 0x3d, 0xe3, 0xce, 0x49, 0x79, 0xee,
+    0x37, 0x00, 0x80, 0x0b, 0x2c, 0x7c, 0x6f, 0x7c, 0x2d, 0x37, 0x00, 0x08, 0xb6, 0x80, 0x00, 0x40,
+    0xd7, 0x1f, 0xd6, 0x9a, 0xd6, 0x9f, 0x7a, 0xe1, 0x7e, 0xc1, 0xc9, 0x45, 0x90, 0xc0, 0xe9, 0x18,
+    0x50, 0x11, 0x6a, 0x22, 0x66, 0x66, 0xd6, 0x1a, 0x66, 0x64, 0x39, 0x7b, 0x9f, 0xff, 0x29, 0xb3,
+    0x3c, 0x4f, 0x0c, 0x84, 0xa0, 0x00, 0x80, 0x06, 0x65, 0xe6, 0xd5, 0xc0, 0x37, 0x40, 0x80, 0x00,
+    0x7c, 0x6f, 0x75, 0xf0, 0x6a, 0x2e, 0x66, 0x66, 0xd6, 0x1a, 0x66, 0x64, 0x39, 0x7b, 0x9f, 0xff,
+    0x29, 0xb3, 0x3c, 0x4f, 0x0c, 0x84, 0xa0, 0x00, 0x80, 0x06, 0x65, 0xe6, 0xd5, 0xc0, 0x34, 0x51,
+    0xcf, 0x42, 0x37, 0x46, 0x80, 0x00, 0x32, 0xa4, 0x35, 0xc0, 0x80, 0x08, 0x7f, 0x6f, 0x36, 0x50,
+    0x2c, 0x10, 0xce, 0x49, 0x3e, 0x63, 0xf3, 0x8d, 0x3a, 0x6e, 0xcf, 0x4a, 0x6c, 0x7c, 0x26, 0x64,
+    0xd4, 0x9c, 0x74, 0x71, 0x39, 0x01, 0x80, 0x0f, 0x2c, 0xb9, 0x68, 0x22, 0x64, 0xe8, 0x84, 0x0b,
+    0x00, 0x08, 0xb7, 0x00, 0x00, 0x40, 0xd4, 0x19, 0xd4, 0x1a, 0x88, 0x1c, 0xd4, 0x1f, 0xd4, 0xc2,
+    0x64, 0xe8, 0x84, 0x07, 0x8f, 0xf6, 0xd4, 0x19, 0xd4, 0xc7, 0x64, 0xe8, 0x80, 0x0a, 0x94, 0xc6,
+    0x64, 0xe4, 0xd4, 0x19, 0xd4, 0x11, 0x64, 0x61, 0x31, 0x24, 0x3f, 0x50, 0x80, 0x09, 0x90, 0xc0,
+    0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x3e, 0x00, 0xa0, 0x0c, 0x74, 0xd6, 0x75, 0x57, 0x03, 0xe4,
+    0x2a, 0x4a, 0x80, 0x09, 0xc6, 0x94, 0x33, 0x73, 0x2c, 0x0e, 0x51, 0x99, 0x9a, 0xc6, 0x84, 0x2b,
+    0x90, 0xc0, 0x75, 0x51, 0x74, 0x70, 0xd2, 0x11, 0x36, 0xd0, 0x7a, 0x61, 0x3a, 0xe1, 0x6c, 0x7c,
+    0x94, 0xc0, 0xd4, 0x9d, 0xd5, 0x1c, 0x96, 0xc0, 0x33, 0x1f, 0x80, 0x01, 0x65, 0x65, 0x2c, 0xcb,
+    0x31, 0xa4, 0x37, 0x7c, 0x80, 0x08, 0x34, 0x70, 0xd2, 0x11, 0x7a, 0x61, 0x6c, 0x7c, 0xd4, 0x9c,
+    0x64, 0xe5, 0x3c, 0xc8, 0x33, 0x73, 0x00, 0x08, 0xb7, 0x80, 0x00, 0x40, 0x37, 0xd0, 0x56, 0x99,
+    0x24, 0xe5, 0x35, 0x56, 0x3b, 0xe1, 0xd2, 0x16, 0x9a, 0xc6, 0x84, 0x22, 0xd7, 0x1f, 0x7c, 0xc8,
+    0x90, 0xc0, 0x7a, 0x61, 0x98, 0xc0, 0x74, 0xd9, 0x6c, 0x7c, 0x3d, 0x1b, 0x80, 0x01, 0xd5, 0x1c,
+    0x25, 0x65, 0x30, 0xa4, 0x37, 0xb8, 0x80, 0x08, 0x6f, 0x5d, 0xd2, 0x16, 0x7a, 0x61, 0x6c, 0x7c,
+    0xd7, 0x1c, 0x67, 0x65, 0x98, 0xc0, 0xdb, 0x99, 0x7f, 0x48, 0x76, 0xd0, 0xc3, 0x81, 0x28, 0xf7,
+    0x67, 0x65, 0x3f, 0x48, 0x34, 0xd0, 0x41, 0x98, 0x37, 0x5e, 0x38, 0xe1, 0x04, 0xe4, 0x2a, 0x4c,
+    0x80, 0x09, 0x26, 0x6a, 0xdb, 0x1e, 0x94, 0xc7, 0x6b, 0xbe, 0x7a, 0x41, 0x36, 0x00, 0xa0, 0x08,
+    0x76, 0x44, 0x74, 0x57, 0xd6, 0x21, 0x84, 0x9f, 0x26, 0xea, 0x56, 0x99, 0x94, 0xc0, 0x77, 0xd6,
+    0x84, 0x23, 0x94, 0xc0, 0xd2, 0x17, 0xd7, 0x19, 0x96, 0xc0, 0x7a, 0x61, 0x00, 0x08, 0xb8, 0x00,
+    0x00, 0x40, 0x3d, 0x1a, 0x80, 0x01, 0x6c, 0x7c, 0xd7, 0x9c, 0x27, 0xe5, 0x30, 0xa4, 0x38, 0x1c,
+    0x80, 0x08, 0x6f, 0x4b, 0xd2, 0x16, 0x7a, 0x61, 0x6c, 0x7c, 0xd7, 0x1c, 0x67, 0x65, 0x3f, 0x48,
+    0x26, 0xea, 0x57, 0x99, 0x27, 0x65, 0x75, 0x57, 0x9a, 0xc6, 0x84, 0x2a, 0x90, 0xc0, 0xd2, 0x12,
+    0xd7, 0x99, 0x7f, 0x48, 0x3a, 0x00, 0xa0, 0x08, 0x77, 0x5e, 0x3f, 0x1f, 0x80, 0x01, 0x7a, 0x61,
+    0x6c, 0x7c, 0xd5, 0x1c, 0x25, 0x65, 0x30, 0xa4, 0x38, 0x5a, 0x80, 0x08, 0x34, 0x00, 0xa8, 0x00,
+    0x6f, 0xcb, 0xd2, 0x17, 0x7a, 0x61, 0x6c, 0x7c, 0xd7, 0x9c, 0x67, 0xe5, 0x3f, 0xc8, 0x39, 0xc1,
+    0xda, 0x1e, 0x27, 0xe5, 0x6a, 0x34, 0x7f, 0xc8, 0x77, 0xdf, 0xdb, 0x1f, 0x6b, 0x3e, 0x6d, 0x56,
+    0x42, 0x98, 0x02, 0xe4, 0x2a, 0x4c, 0x80, 0x09, 0x65, 0x6a, 0x92, 0xc3, 0x79, 0x41, 0x75, 0x42,
+    0x71, 0x73, 0x00, 0x08, 0xb8, 0x80, 0x00, 0x40, 0x81, 0x6d, 0x34, 0x00, 0xa8, 0x00, 0x77, 0xd0,
+    0x9f, 0x70, 0x38, 0x00, 0xb8, 0x00, 0x77, 0xd2, 0x77, 0x51, 0x47, 0x90, 0x90, 0xc0, 0x90, 0xc0,
+    0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x3e, 0x00, 0xa0, 0x0c, 0x74, 0x56, 0x74, 0xd7,
+    0x05, 0xe6, 0x21, 0xa8, 0x80, 0x09, 0xc9, 0x4a, 0x3a, 0x80, 0xa1, 0x00, 0x66, 0xea, 0x76, 0x55,
+    0xe8, 0xee, 0xc8, 0x4a, 0x3a, 0x00, 0xa1, 0x00, 0x7a, 0xe1, 0xe9, 0xef, 0x27, 0x18, 0x80, 0xec,
+    0x98, 0xc0, 0x2a, 0x03, 0x80, 0x1e, 0x7e, 0xc1, 0x9a, 0x44, 0x9a, 0xc0, 0xd6, 0xc2, 0xc3, 0x84,
+    0x3e, 0xe0, 0x21, 0x50, 0x80, 0x09, 0x36, 0x00, 0xa8, 0x00, 0xd5, 0xc2, 0xcc, 0x42, 0x38, 0x00,
+    0xa8, 0x04, 0x77, 0x52, 0x58, 0x5e, 0xc4, 0x88, 0x3a, 0x00, 0xa0, 0x01, 0x77, 0xd0, 0x7c, 0xc1,
+    0x6b, 0x00, 0xc6, 0x84, 0x38, 0x80, 0xa0, 0x00, 0x00, 0x08, 0xb9, 0x00, 0x00, 0x40, 0x7f, 0xc1,
+    0x6b, 0x00, 0xcf, 0x46, 0x3a, 0x00, 0xa2, 0x02, 0x73, 0xf1, 0x6d, 0x27, 0xd7, 0x42, 0xd7, 0x44,
+    0x98, 0xc0, 0x35, 0x00, 0x80, 0x02, 0x51, 0x54, 0x80, 0x8f, 0x9c, 0xc0, 0x75, 0x40, 0x67, 0xe9,
+    0x7b, 0xc2, 0x50, 0x97, 0x2b, 0x03, 0x80, 0x44, 0x94, 0xc0, 0x79, 0x61, 0x9d, 0x5c, 0x96, 0xc7,
+    0x61, 0x74, 0xcb, 0x46, 0x9b, 0x42, 0x94, 0xc2, 0xcd, 0x45, 0xcb, 0x43, 0x96, 0xc7, 0x6d, 0x74,
+    0xc8, 0x46, 0xd7, 0x44, 0x94, 0xc6, 0x42, 0x97, 0xc8, 0x43, 0x10, 0x93, 0x51, 0x55, 0x61, 0x74,
+    0x9c, 0xc0, 0x6d, 0x74, 0x21, 0x03, 0x80, 0x4c, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x3c, 0x00,
+    0xa1, 0x08, 0x67, 0xe9, 0xd7, 0x44, 0x7b, 0xc2, 0xc9, 0x46, 0x42, 0x90, 0x94, 0xc0, 0x51, 0x54,
+    0x9b, 0x5c, 0x94, 0xc6, 0x50, 0x91, 0xcb, 0x45, 0x98, 0xc1, 0x61, 0x74, 0xcf, 0x43, 0x00, 0x08,
+    0xb9, 0x80, 0x00, 0x40, 0xcf, 0x46, 0x61, 0x74, 0x9c, 0xc1, 0x6d, 0x74, 0xc8, 0x43, 0xd7, 0x44,
+    0xd7, 0x44, 0xc8, 0x46, 0x6d, 0x74, 0x42, 0x91, 0x94, 0xd0, 0x50, 0x97, 0x51, 0x53, 0x61, 0x74,
+    0x6d, 0x74, 0x42, 0x90, 0x92, 0xd0, 0xec, 0x42, 0x90, 0xc0, 0x90, 0xc0, 0x9f, 0x70, 0x3a, 0x60,
+    0xb8, 0x00, 0x77, 0xd1, 0x77, 0x50, 0xef, 0xe9, 0xee, 0xe8, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0,
+    0x90, 0xc0, 0x90, 0xc0, 0x3e, 0x00, 0xa0, 0x08, 0x75, 0xd6, 0x74, 0x57, 0x00, 0xe6, 0x21, 0xa8,
+    0x80, 0x09, 0xc8, 0x4c, 0x3c, 0x00, 0xa1, 0x00, 0x64, 0x6a, 0xe8, 0xef, 0x3b, 0xe0, 0x21, 0xac,
+    0x80, 0x09, 0x84, 0x6f, 0x96, 0xc0, 0x9a, 0x40, 0x2a, 0x03, 0x80, 0x10, 0x3d, 0xe0, 0x21, 0x50,
+    0x80, 0x09, 0x90, 0xc0, 0x2f, 0x10, 0x18, 0x5d, 0xcc, 0x44, 0x30, 0x71, 0x6d, 0x11, 0x96, 0xc0,
+    0x7c, 0x42, 0x79, 0x41, 0x00, 0x08, 0xba, 0x00, 0x00, 0x40, 0x80, 0x47, 0x94, 0xc0, 0xd5, 0x22,
+    0xcf, 0x40, 0x94, 0xc6, 0x80, 0x1a, 0x79, 0x62, 0xef, 0x1c, 0x9f, 0x42, 0x90, 0xc0, 0x90, 0xc0,
+    0x92, 0xd0, 0x52, 0x9f, 0x6f, 0x4a, 0x31, 0xa4, 0x3a, 0x40, 0x80, 0x08, 0x94, 0xc0, 0x9f, 0x42,
+    0x55, 0x9f, 0x35, 0x55, 0x55, 0x9f, 0x37, 0xd5, 0x76, 0xd2, 0x96, 0xc8, 0x6f, 0x5a, 0x76, 0xd7,
+    0x57, 0x9f, 0x35, 0x55, 0x76, 0xd7, 0x6f, 0x4a, 0x6f, 0x5a, 0x27, 0x65, 0x57, 0x5b, 0x92, 0xd0,
+    0x60, 0xf7, 0x6c, 0xf7, 0x41, 0x99, 0x3a, 0x20, 0xa8, 0x00, 0x77, 0xd0, 0x77, 0x53, 0xef, 0xe8,
+    0x9f, 0x71, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x3a, 0x00, 0xa0, 0x0c, 0x74, 0xd7,
+    0x74, 0x56, 0xf7, 0x85, 0x54, 0x91, 0x3a, 0x80, 0xa0, 0x00, 0x29, 0x09, 0x80, 0x08, 0x67, 0xea,
+    0x44, 0x90, 0x98, 0xc7, 0x28, 0x0d, 0x80, 0x04, 0x90, 0xc0, 0x00, 0x08, 0xba, 0x80, 0x00, 0x40,
+    0x7b, 0xc1, 0x38, 0x80, 0xa0, 0x00, 0x77, 0xc7, 0xf0, 0x85, 0x56, 0x91, 0x3e, 0x00, 0xa1, 0x00,
+    0xd7, 0xa1, 0x78, 0x61, 0x3f, 0x05, 0x80, 0x01, 0x46, 0x95, 0xe8, 0xee, 0x3c, 0x00, 0xa1, 0x00,
+    0x7c, 0x43, 0x75, 0x57, 0x7e, 0xc3, 0xeb, 0xef, 0x84, 0x87, 0x96, 0xc0, 0x79, 0x61, 0xcd, 0x40,
+    0xc2, 0x55, 0x96, 0xc0, 0x9b, 0x42, 0x2b, 0x03, 0x80, 0x42, 0x36, 0x00, 0xa1, 0x00, 0xed, 0x19,
+    0xea, 0x18, 0x9a, 0xc0, 0x29, 0x0e, 0x80, 0x10, 0x90, 0xc0, 0x2d, 0x0a, 0x80, 0x04, 0x3c, 0x20,
+    0xa0, 0x00, 0x2a, 0x0b, 0x80, 0x04, 0x90, 0xc0, 0x28, 0x0f, 0x80, 0x0c, 0x96, 0xc0, 0xe9, 0x54,
+    0x28, 0x0c, 0x80, 0x08, 0x9a, 0xc0, 0x29, 0x02, 0x80, 0x02, 0x90, 0xc0, 0x2a, 0xe2, 0x9f, 0xfc,
+    0x2b, 0x02, 0x80, 0x04, 0x13, 0x95, 0x52, 0x96, 0x6c, 0xdd, 0x76, 0xc1, 0x45, 0xac, 0x10, 0x91,
+    0x00, 0x08, 0xbb, 0x00, 0x00, 0x40, 0x56, 0x92, 0x6f, 0x22, 0x75, 0x46, 0x42, 0xaf, 0x14, 0xb9,
+    0x50, 0xb2, 0x6d, 0xc0, 0x76, 0x43, 0x34, 0x80, 0xa0, 0x00, 0x44, 0xaa, 0x11, 0xb5, 0x55, 0xbe,
+    0x92, 0xd0, 0x6e, 0x25, 0x75, 0x44, 0x42, 0xab, 0x3a, 0x60, 0xb0, 0x00, 0x7f, 0xc3, 0x77, 0x50,
+    0xed, 0xe9, 0xee, 0xe8, 0x38, 0x00, 0xa8, 0x00, 0x77, 0xd1, 0xcf, 0x47, 0xed, 0x64, 0x36, 0x00,
+    0xa1, 0x00, 0x53, 0x95, 0xe9, 0x44, 0xef, 0x18, 0x96, 0xc0, 0x43, 0x97, 0x2f, 0x0a, 0x80, 0x04,
+    0x36, 0xc0, 0xa0, 0x00, 0x52, 0x91, 0xef, 0xeb, 0x9f, 0x70, 0x42, 0x92, 0x90, 0xc0, 0x90, 0xc0,
+    0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x3e, 0x80, 0xa0, 0x04, 0x74, 0xd7, 0x6f, 0x90, 0x6d, 0x10,
+    0xfc, 0xc3, 0x28, 0x08, 0x80, 0x04, 0x3c, 0x00, 0xa0, 0x01, 0x23, 0x04, 0x80, 0x7f, 0x74, 0x56,
+    0x2b, 0x03, 0x80, 0x70, 0x38, 0x00, 0x00, 0x08, 0xbb, 0x80, 0x00, 0x40, 0xa1, 0x00, 0x54, 0x94,
+    0x2c, 0x09, 0x80, 0x04, 0x38, 0x00, 0xa1, 0x00, 0x44, 0x90, 0x29, 0x0c, 0x80, 0x04, 0x36, 0x80,
+    0xa1, 0x00, 0x47, 0x90, 0xeb, 0xef, 0x36, 0x80, 0xa1, 0x00, 0x51, 0x91, 0xea, 0xee, 0x96, 0xc0,
+    0x41, 0x91, 0x2c, 0x0b, 0x87, 0xf8, 0x9a, 0xc0, 0x29, 0x0e, 0x80, 0x08, 0x90, 0xc0, 0x2c, 0x0d,
+    0x87, 0xfc, 0x9a, 0xc0, 0x28, 0x0a, 0x80, 0x08, 0x90, 0xc0, 0x2c, 0x0f, 0x80, 0x10, 0x36, 0x80,
+    0xa0, 0x00, 0x42, 0x94, 0xe9, 0x4c, 0x94, 0xc0, 0xe8, 0x4c, 0xec, 0x54, 0x9a, 0xc0, 0x29, 0xe2,
+    0x9f, 0xfc, 0x90, 0xc0, 0x2a, 0x02, 0x80, 0x04, 0x2b, 0x02, 0x80, 0x02, 0x17, 0x97, 0x54, 0x93,
+    0x6c, 0xd7, 0x77, 0x41, 0x46, 0xba, 0x10, 0x95, 0x51, 0x94, 0x6c, 0x91, 0x77, 0xc1, 0x47, 0xb8,
+    0x10, 0xad, 0x51, 0xb4, 0x6d, 0x51, 0x76, 0xc2, 0x45, 0xbe, 0x13, 0xab, 0x00, 0x08, 0xbc, 0x00,
+    0x00, 0x40, 0x55, 0xb7, 0x92, 0xd0, 0x6c, 0x2d, 0x77, 0xc0, 0x47, 0xb9, 0x3e, 0x20, 0xa3, 0x00,
+    0x6f, 0x10, 0x6e, 0x90, 0x77, 0xd1, 0xe9, 0x44, 0x28, 0x0e, 0x83, 0xfc, 0x38, 0xc0, 0xa0, 0x00,
+    0x53, 0x99, 0x2c, 0x09, 0x83, 0xfc, 0x36, 0x40, 0xa0, 0x00, 0x43, 0x9e, 0xef, 0xeb, 0x36, 0x00,
+    0xa8, 0x00, 0x77, 0x50, 0x46, 0x96, 0x36, 0xc0, 0xa0, 0x00, 0x54, 0x91, 0xee, 0xea, 0x94, 0xc0,
+    0x44, 0x99, 0x9f, 0x70, 0x45, 0x91, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0,
+    0x90, 0xc0, 0x3a, 0x00, 0xa0, 0x0c, 0x74, 0x56, 0x74, 0xd7, 0xf3, 0x85, 0x54, 0x91, 0x38, 0x00,
+    0xa1, 0x00, 0x65, 0xea, 0xe8, 0xee, 0x44, 0x90, 0x94, 0xc7, 0xf1, 0x85, 0x79, 0xc1, 0x3c, 0x80,
+    0xa0, 0x00, 0x75, 0xc3, 0x28, 0x0e, 0x80, 0x04, 0x78, 0xe1, 0xea, 0xef, 0x3e, 0x80, 0xa0, 0x00,
+    0x77, 0x53, 0x00, 0x08, 0xbc, 0x80, 0x00, 0x40, 0xd5, 0xa1, 0x77, 0xd3, 0x7c, 0xc3, 0x28, 0x0c,
+    0x80, 0x08, 0x9c, 0xc0, 0x7f, 0x43, 0x79, 0xc1, 0x7b, 0xe1, 0xcb, 0x41, 0x28, 0x0c, 0x80, 0x0c,
+    0x3a, 0x80, 0xa0, 0x00, 0x7d, 0xc3, 0xc6, 0x56, 0x29, 0x09, 0x80, 0x08, 0x94, 0xc0, 0xcd, 0x43,
+    0xeb, 0x18, 0x38, 0x80, 0xa0, 0x00, 0xee, 0x19, 0x2b, 0x0f, 0x80, 0x04, 0x36, 0x80, 0xa0, 0x00,
+    0x54, 0x96, 0xed, 0x19, 0x94, 0xc0, 0x44, 0x96, 0x84, 0x55, 0x96, 0xc0, 0x9b, 0x47, 0x2b, 0x03,
+    0x80, 0x20, 0x9a, 0xc0, 0x29, 0x0a, 0x80, 0x0c, 0x90, 0xc0, 0x2d, 0x0e, 0x80, 0x04, 0x9a, 0xc0,
+    0x2a, 0x02, 0x80, 0x02, 0x90, 0xc0, 0x2b, 0xe2, 0x9f, 0xfe, 0x17, 0x92, 0x54, 0x95, 0x6c, 0xb7,
+    0x41, 0xbf, 0x36, 0x80, 0xa0, 0x00, 0x52, 0x91, 0x53, 0x96, 0x6f, 0xdd, 0x47, 0xbb, 0x36, 0x00,
+    0xa1, 0x00, 0x57, 0xb6, 0x54, 0xb1, 0x6e, 0xb7, 0x00, 0x08, 0xbd, 0x00, 0x00, 0x40, 0x34, 0x80,
+    0xa0, 0x00, 0x45, 0xb4, 0x94, 0xd0, 0x50, 0xb2, 0x57, 0xb5, 0x6e, 0xc3, 0x45, 0xb4, 0x38, 0x00,
+    0xa8, 0x00, 0x77, 0x50, 0xcb, 0x46, 0xe9, 0x44, 0x36, 0x00, 0xa1, 0x00, 0x54, 0x91, 0xee, 0x44,
+    0x36, 0x40, 0xa0, 0x00, 0xeb, 0x18, 0xee, 0xe8, 0x96, 0xc0, 0x44, 0x93, 0x2b, 0x0f, 0x80, 0x04,
+    0x34, 0x80, 0xa0, 0x00, 0x57, 0x96, 0x38, 0x00, 0xa8, 0x00, 0x77, 0xd1, 0x47, 0x97, 0x9f, 0x70,
+    0x34, 0x20, 0xa0, 0x00, 0xef, 0xea, 0x35, 0x50, 0x34, 0x51, 0x03, 0xfc, 0x9f, 0xf6, 0x22, 0x75,
+    0xd8, 0x9b, 0x2e, 0x75, 0x32, 0x81, 0x20, 0x00, 0x80, 0x00, 0x75, 0x7a, 0x6c, 0x98, 0xd8, 0x91,
+    0x61, 0x74, 0x6d, 0x74, 0x9f, 0x70, 0x6c, 0x48, 0x35, 0x50, 0x34, 0x51, 0x03, 0xfc, 0x9f, 0xf6,
+    0x22, 0x75, 0x01, 0xfc, 0x9f, 0xf4, 0x2e, 0x75, 0x61, 0x74, 0x6d, 0x74, 0x9f, 0x70, 0x00, 0x08,
+    0xbd, 0x80, 0x00, 0x40, 0x6c, 0x48, 0x2c, 0x10, 0x39, 0xe0, 0x22, 0x08, 0x80, 0x09, 0x93, 0x56,
+    0x2b, 0x03, 0x80, 0x0a, 0x38, 0x00, 0x27, 0x0c, 0x80, 0x0a, 0x51, 0x59, 0x92, 0xd0, 0x52, 0x98,
+    0xd9, 0x12, 0x60, 0x18, 0x09, 0xe3, 0x22, 0x3c, 0x80, 0x09, 0x61, 0x74, 0x6d, 0x74, 0x7d, 0x47,
+    0x65, 0x65, 0x9f, 0x70, 0x02, 0x02, 0x27, 0x64, 0x80, 0x0a, 0x31, 0xa4, 0x37, 0x30, 0x80, 0x08,
+    0x31, 0xa4, 0x39, 0xc0, 0x80, 0x08, 0x31, 0xa4, 0x3d, 0x6a, 0x80, 0x08, 0x31, 0xa4, 0x36, 0x3a,
+    0x80, 0x08, 0x31, 0xa4, 0x36, 0x20, 0x80, 0x08, 0x33, 0x24, 0x3f, 0x30, 0x80, 0x09, 0xee, 0xe8,
+    0x10, 0x96, 0x82, 0xe8, 0x0d, 0x00, 0xa0, 0x01, 0x27, 0x09, 0x80, 0x40, 0x26, 0x18, 0x8a, 0x04,
+    0xe7, 0xe9, 0xc9, 0x84, 0x18, 0x96, 0x91, 0x20, 0x90, 0xc0, 0xe8, 0x89, 0x25, 0x18, 0x89, 0xf4,
+    0x39, 0xe0, 0x21, 0xf0, 0x00, 0x08, 0xbe, 0x00, 0x00, 0x40, 0x80, 0x09, 0x90, 0xc0, 0xa8, 0xc8,
+    0x90, 0xc0, 0x98, 0x61, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x2e, 0x0f, 0x87, 0x14, 0x10, 0x90,
+    0x81, 0xc8, 0x00, 0x06, 0x82, 0xe6, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0xe9, 0xef, 0x10, 0x00,
+    0x82, 0xc0, 0x31, 0x18, 0x80, 0x0f, 0xd4, 0x21, 0x84, 0xd3, 0x30, 0xc1, 0x20, 0x00, 0x80, 0x0c,
+    0xf0, 0x41, 0x32, 0xa4, 0x3b, 0x60, 0x80, 0x08, 0x38, 0x60, 0x27, 0x88, 0x80, 0x0a, 0x38, 0xe8,
+    0x3c, 0x28, 0xbf, 0xff, 0x10, 0x86, 0x8b, 0x14, 0x00, 0x86, 0x87, 0x18, 0x11, 0x90, 0x30, 0xa1,
+    0x20, 0x00, 0x80, 0x00, 0x33, 0xb9, 0x80, 0x00, 0x34, 0x78, 0x38, 0xe8, 0x3c, 0x28, 0xbf, 0xff,
+    0x70, 0x61, 0x80, 0x0d, 0x51, 0x90, 0x33, 0xb9, 0x80, 0x00, 0x70, 0x61, 0x85, 0xf9, 0x38, 0x60,
+    0x2b, 0x90, 0x80, 0x0a, 0x30, 0xc1, 0x30, 0x00, 0x80, 0x0c, 0x00, 0x08, 0xbe, 0x80, 0x00, 0x40,
+    0x28, 0x09, 0x84, 0x08, 0x32, 0xa4, 0x3b, 0x60, 0x80, 0x08, 0xf0, 0x41, 0x08, 0x86, 0x3a, 0x58,
+    0x80, 0x09, 0x16, 0x86, 0x87, 0x18, 0x10, 0x00, 0x82, 0xc0, 0x31, 0x19, 0x80, 0x0f, 0xd0, 0xa3,
+    0x84, 0x28, 0x17, 0x86, 0x87, 0x14, 0x31, 0x18, 0x80, 0xf0, 0x3c, 0x64, 0x38, 0x60, 0x27, 0x88,
+    0x80, 0x0a, 0xd0, 0x21, 0x84, 0x15, 0x29, 0x00, 0x84, 0x00, 0x90, 0xc0, 0xef, 0x39, 0x32, 0x24,
+    0x31, 0xc0, 0x80, 0x09, 0xe9, 0xef, 0x88, 0x17, 0x29, 0x00, 0x84, 0x00, 0x38, 0x60, 0x27, 0x88,
+    0x80, 0x0a, 0xef, 0x39, 0x32, 0x04, 0x3c, 0x70, 0x80, 0x09, 0xe9, 0xef, 0x10, 0x86, 0x87, 0x14,
+    0x12, 0x86, 0x83, 0x18, 0x11, 0x86, 0x87, 0x18, 0x00, 0x86, 0x83, 0x18, 0x10, 0x86, 0x87, 0x14,
+    0xf2, 0x46, 0xf1, 0x44, 0xf0, 0x45, 0x06, 0x86, 0x87, 0x18, 0x88, 0x1e, 0x07, 0x86, 0x87, 0x14,
+    0x00, 0x08, 0xbf, 0x00, 0x00, 0x40, 0x00, 0xe4, 0x2a, 0x4c, 0x80, 0x09, 0x2e, 0x08, 0x83, 0x14,
+    0xf0, 0x01, 0x32, 0xa4, 0x3a, 0x60, 0x80, 0x08, 0x39, 0xc0, 0x20, 0x00, 0x80, 0x0c, 0x08, 0xe6,
+    0x2b, 0xb4, 0x80, 0x09, 0x30, 0x61, 0x27, 0x88, 0x80, 0x0a, 0x40, 0x90, 0x08, 0xe6, 0x2b, 0xb4,
+    0x80, 0x09, 0x2e, 0x09, 0x83, 0x14, 0x2a, 0xff, 0x9e, 0x87, 0x18, 0x90, 0xf9, 0x47, 0x09, 0xe6,
+    0x2b, 0xb4, 0x80, 0x09, 0x2a, 0xff, 0x9e, 0x7f, 0x58, 0x99, 0x00, 0xe4, 0x2a, 0x4c, 0x80, 0x09,
+    0x34, 0x40, 0xfc, 0xc7, 0x3c, 0x43, 0x08, 0xe6, 0x2b, 0xb4, 0x80, 0x09, 0xc9, 0x40, 0x58, 0x90,
+    0x2a, 0xff, 0x9e, 0x5d, 0xe9, 0x1c, 0x09, 0xe6, 0x2b, 0xb4, 0x80, 0x09, 0x90, 0xc0, 0x58, 0x91,
+    0x2a, 0xff, 0x9e, 0x53, 0x29, 0x09, 0x80, 0x5c, 0xc0, 0x81, 0x11, 0x06, 0x82, 0xcc, 0xd4, 0x11,
+    0x24, 0x61, 0x11, 0x96, 0x82, 0x12, 0x00, 0x08, 0xbf, 0x80, 0x00, 0x40, 0x70, 0x71, 0x84, 0x4d,
+    0x2c, 0x10, 0x11, 0x06, 0x91, 0x22, 0x24, 0xea, 0x2c, 0x90, 0xe8, 0xee, 0x27, 0x18, 0x85, 0xd2,
+    0x38, 0x41, 0x38, 0xc2, 0xc9, 0x41, 0x12, 0x06, 0x82, 0xe2, 0x42, 0x98, 0x0a, 0xe6, 0x2b, 0xb4,
+    0x80, 0x09, 0x22, 0x60, 0x9f, 0xff, 0x2a, 0x0a, 0x81, 0x38, 0xea, 0x19, 0x42, 0x12, 0x0a, 0xe6,
+    0x2b, 0xb4, 0x80, 0x09, 0x90, 0xc0, 0x2a, 0x0a, 0x81, 0x0c, 0xea, 0x19, 0x42, 0x12, 0x12, 0x06,
+    0x91, 0x22, 0x71, 0x70, 0x81, 0xcd, 0x21, 0x18, 0x85, 0x98, 0x30, 0xe0, 0x6c, 0x10, 0x84, 0x37,
+    0x11, 0x06, 0x91, 0x22, 0x24, 0xea, 0xca, 0xb2, 0x84, 0x2d, 0xf8, 0xc7, 0x2b, 0xe2, 0x9f, 0xbe,
+    0x2a, 0xe2, 0x9f, 0xeb, 0xe9, 0xee, 0xe8, 0x3a, 0x38, 0x41, 0x51, 0x10, 0x41, 0x91, 0x29, 0x09,
+    0x81, 0x08, 0x41, 0x91, 0x29, 0x09, 0x80, 0x58, 0x41, 0xb9, 0x41, 0xb1, 0x00, 0x08, 0xc0, 0x00,
+    0x00, 0x40, 0x11, 0x06, 0x91, 0x22, 0x70, 0xf0, 0x81, 0xe7, 0x2f, 0x10, 0x2f, 0x90, 0x18, 0x96,
+    0x82, 0xd0, 0x31, 0x81, 0x20, 0x00, 0x80, 0x00, 0x35, 0x79, 0xc8, 0x48, 0x11, 0x96, 0x82, 0xd4,
+    0x2c, 0x98, 0x2d, 0x12, 0x10, 0x06, 0x91, 0x22, 0x24, 0x6a, 0xf2, 0x49, 0x26, 0x18, 0x81, 0x66,
+    0xf1, 0x48, 0xfc, 0xc7, 0x2b, 0x00, 0x80, 0x46, 0xca, 0xb2, 0x2d, 0x00, 0x80, 0xa4, 0xe9, 0xec,
+    0xe8, 0xec, 0xec, 0x3a, 0xe8, 0x3b, 0x2e, 0x0f, 0x82, 0x18, 0x2e, 0x0a, 0x81, 0xb8, 0x2e, 0x0b,
+    0x80, 0x58, 0xfc, 0x4a, 0xe9, 0x3d, 0x10, 0x93, 0x0d, 0xe6, 0x2b, 0xb4, 0x80, 0x09, 0xcc, 0x47,
+    0x11, 0x96, 0x82, 0xd0, 0xf2, 0xc9, 0xed, 0x44, 0xf1, 0x01, 0xed, 0x1c, 0x11, 0x95, 0xf2, 0x02,
+    0xf8, 0x4b, 0xf9, 0x4c, 0xfa, 0x4d, 0xfb, 0x4e, 0x2a, 0xff, 0x9d, 0x4d, 0xfc, 0x4f, 0x36, 0x50,
+    0xfb, 0xce, 0x00, 0x08, 0xc0, 0x80, 0x00, 0x40, 0x10, 0x06, 0x82, 0xe2, 0x2c, 0x7c, 0xfc, 0xcf,
+    0x04, 0x93, 0xf1, 0xc8, 0x0d, 0xe6, 0x2b, 0xb4, 0x80, 0x09, 0xfa, 0xcd, 0xf1, 0x02, 0x10, 0x92,
+    0x11, 0x96, 0x82, 0xd4, 0x2d, 0x0d, 0x80, 0x5c, 0xf1, 0x01, 0xed, 0x1c, 0x2a, 0xff, 0x9d, 0x1f,
+    0x51, 0x95, 0x36, 0x50, 0xfa, 0xcd, 0x10, 0x06, 0x82, 0xce, 0x2c, 0x7c, 0xfc, 0xca, 0x04, 0x92,
+    0xfb, 0xce, 0x1d, 0x14, 0xf8, 0xcb, 0x1c, 0x9b, 0xf9, 0xcc, 0x90, 0xc0, 0xec, 0xad, 0x80, 0xb3,
+    0x2c, 0x10, 0x1d, 0x10, 0xcc, 0x44, 0xc1, 0x81, 0xec, 0xad, 0x80, 0xa7, 0x0d, 0xe6, 0x2b, 0xb4,
+    0x80, 0x09, 0xcc, 0x47, 0xed, 0x44, 0xed, 0x1c, 0x10, 0x95, 0xf0, 0x01, 0xfc, 0x4f, 0x32, 0xc4,
+    0x3b, 0x40, 0x80, 0x08, 0xfb, 0x4e, 0x35, 0x50, 0x2c, 0x10, 0x0d, 0xe6, 0x2b, 0xb4, 0x80, 0x09,
+    0xfc, 0xcf, 0x2d, 0x0d, 0x80, 0x5c, 0xed, 0x1c, 0x00, 0x08, 0xc1, 0x00, 0x00, 0x40, 0x10, 0x95,
+    0xf0, 0x01, 0xf2, 0x4f, 0x32, 0xc4, 0x3b, 0x40, 0x80, 0x08, 0xc1, 0x81, 0x2c, 0x90, 0xf2, 0xcf,
+    0x24, 0xe1, 0x33, 0xe1, 0x3f, 0xff, 0x9f, 0xff, 0x34, 0x44, 0x80, 0x00, 0x30, 0x44, 0x80, 0x00,
+    0x36, 0x42, 0x80, 0x00, 0xd8, 0x14, 0xd4, 0x42, 0x64, 0x61, 0x64, 0x68, 0x92, 0xc2, 0x6d, 0x10,
+    0x92, 0xc3, 0xc2, 0xff, 0x65, 0x61, 0x70, 0xf2, 0x80, 0x15, 0x70, 0xe2, 0x84, 0x0b, 0x70, 0x63,
+    0x80, 0x0d, 0x70, 0x7b, 0x84, 0x09, 0x30, 0xe0, 0x3f, 0xff, 0x9f, 0xff, 0x34, 0xd0, 0x10, 0x97,
+    0xf2, 0xc9, 0xf2, 0x02, 0x12, 0x96, 0x82, 0xd0, 0x2a, 0xff, 0x9c, 0x69, 0xf2, 0x01, 0x00, 0x97,
+    0xfa, 0xcd, 0x18, 0x01, 0xa0, 0x08, 0x2a, 0xff, 0x9c, 0x61, 0x51, 0x92, 0xf8, 0xcb, 0xf9, 0xcc,
+    0xfa, 0xcd, 0x88, 0x06, 0xfb, 0xce, 0x6c, 0x10, 0x3b, 0x41, 0x3b, 0xc4, 0x00, 0x91, 0x00, 0x08,
+    0xc1, 0x80, 0x00, 0x40, 0xef, 0x44, 0x10, 0x06, 0x91, 0x22, 0x30, 0x76, 0xea, 0x44, 0x2c, 0xff,
+    0x9e, 0xcb, 0xe9, 0x44, 0x2b, 0xff, 0x9b, 0xf3, 0x2c, 0x90, 0x10, 0x96, 0x82, 0x10, 0x64, 0x69,
+    0x80, 0x43, 0x10, 0x06, 0x91, 0x22, 0x64, 0x6a, 0x84, 0x3b, 0x2b, 0xe2, 0x9f, 0xbe, 0x2e, 0x09,
+    0x81, 0x60, 0x28, 0x00, 0x80, 0xb0, 0x2a, 0x02, 0x80, 0x42, 0x29, 0xe2, 0x9f, 0xea, 0x28, 0xe2,
+    0x9f, 0xd4, 0x38, 0xc1, 0x50, 0xb9, 0x54, 0xb1, 0x6c, 0x7d, 0x44, 0xa9, 0x50, 0xa1, 0x14, 0x91,
+    0xe9, 0x18, 0x6c, 0x7d, 0x44, 0x91, 0x10, 0x06, 0x91, 0x22, 0x70, 0x71, 0x81, 0xe6, 0x29, 0x09,
+    0x80, 0x5c, 0x2f, 0x10, 0x10, 0x06, 0x91, 0x22, 0x24, 0x6a, 0xc9, 0xba, 0x84, 0x81, 0xff, 0xc7,
+    0xeb, 0xee, 0xef, 0x39, 0x2e, 0x09, 0x81, 0x08, 0x38, 0x00, 0x20, 0xf4, 0x80, 0x08, 0x14, 0x91,
+    0x51, 0x17, 0x34, 0x54, 0x00, 0x08, 0xc2, 0x00, 0x00, 0x40, 0x13, 0x06, 0x82, 0xd8, 0xd4, 0x13,
+    0x24, 0x61, 0xd6, 0x41, 0x26, 0x61, 0x12, 0xe1, 0x9f, 0x50, 0x2c, 0x7c, 0xc0, 0x81, 0x31, 0x74,
+    0xcb, 0x4f, 0x80, 0x43, 0x00, 0x10, 0xf9, 0x48, 0x10, 0xd0, 0x0a, 0x86, 0x3a, 0x54, 0x80, 0x09,
+    0x90, 0xc0, 0x00, 0x02, 0x80, 0x48, 0x10, 0x93, 0x12, 0x96, 0x82, 0xdc, 0xf2, 0x01, 0x32, 0xa4,
+    0x3d, 0x48, 0x80, 0x08, 0x11, 0xe1, 0x9f, 0x50, 0x2a, 0xff, 0x9b, 0x91, 0x11, 0x06, 0x82, 0xe2,
+    0xcb, 0x47, 0x34, 0xe0, 0x3f, 0xff, 0xbf, 0xff, 0x2c, 0x7d, 0xf9, 0xc8, 0x04, 0x93, 0x38, 0x00,
+    0x20, 0xf4, 0x80, 0x08, 0x3b, 0x41, 0x10, 0x06, 0x91, 0x22, 0x30, 0x76, 0xe9, 0x44, 0x81, 0x96,
+    0xeb, 0x44, 0x2c, 0x90, 0x19, 0x96, 0x82, 0xd2, 0x28, 0x80, 0x80, 0x00, 0x10, 0x06, 0x91, 0x22,
+    0x24, 0x6a, 0x2c, 0x10, 0xe8, 0xf8, 0xe8, 0x39, 0xf8, 0x43, 0x00, 0x08, 0xc2, 0x80, 0x00, 0x40,
+    0x26, 0x18, 0x81, 0x0e, 0xf1, 0x48, 0xf0, 0x49, 0xf0, 0x85, 0xf0, 0x4a, 0xe8, 0xee, 0x2c, 0x90,
+    0x19, 0x90, 0x0a, 0xe6, 0x2b, 0xb4, 0x80, 0x09, 0xff, 0xc9, 0xea, 0x44, 0xea, 0x1f, 0x1a, 0x92,
+    0xc8, 0x4e, 0x90, 0xc0, 0xea, 0x39, 0x2a, 0xff, 0x9b, 0x29, 0xca, 0x48, 0x34, 0xd0, 0xc8, 0x46,
+    0xf0, 0xca, 0x28, 0x08, 0x80, 0xb0, 0x10, 0x90, 0xf0, 0x02, 0x12, 0x96, 0x82, 0xd2, 0xf2, 0x01,
+    0x2a, 0xff, 0x9b, 0x03, 0xf8, 0x4b, 0x0a, 0xe6, 0x2b, 0xb4, 0x80, 0x09, 0xf8, 0xcb, 0x29, 0x00,
+    0x80, 0x58, 0x2a, 0x0a, 0x80, 0xb4, 0xea, 0x1f, 0x00, 0x92, 0xe8, 0x39, 0x10, 0x90, 0xe8, 0x39,
+    0x11, 0x90, 0xf8, 0x4b, 0x2a, 0xff, 0x9a, 0xe5, 0x18, 0x01, 0xa0, 0x06, 0x35, 0x50, 0x09, 0xe6,
+    0x2b, 0xb4, 0x80, 0x09, 0xf8, 0xcb, 0x29, 0x09, 0x80, 0xb4, 0x11, 0x90, 0xe9, 0x1f, 0x10, 0x91,
+    0x00, 0x08, 0xc3, 0x00, 0x00, 0x40, 0x36, 0x80, 0x20, 0x00, 0x80, 0x00, 0x2e, 0x7d, 0xd4, 0xc0,
+    0xf1, 0x42, 0xf1, 0xc2, 0x2a, 0xff, 0x9a, 0xbb, 0x18, 0x01, 0xa0, 0x0f, 0x35, 0xd0, 0x37, 0x80,
+    0x20, 0x00, 0x80, 0x00, 0x6f, 0x7d, 0x74, 0x77, 0x68, 0x22, 0x64, 0x66, 0x7c, 0x6f, 0x2a, 0xff,
+    0x9a, 0xa7, 0x6c, 0x90, 0xd4, 0x3f, 0x80, 0x0e, 0xf8, 0xcb, 0x88, 0x1c, 0x3c, 0x41, 0x39, 0x40,
+    0x3e, 0x90, 0x80, 0x09, 0x36, 0x10, 0x80, 0xdf, 0x80, 0x2b, 0x3c, 0x64, 0x39, 0x40, 0x3e, 0x90,
+    0x80, 0x09, 0x78, 0x5e, 0x7c, 0x41, 0xca, 0x40, 0x90, 0xc0, 0xea, 0x19, 0x51, 0x12, 0x34, 0xe0,
+    0x80, 0x01, 0x30, 0xe0, 0x80, 0x01, 0x36, 0xe1, 0x80, 0x01, 0xd8, 0x10, 0xd4, 0x41, 0x30, 0xcf,
+    0x95, 0x0c, 0x27, 0xe6, 0xf0, 0xc9, 0x38, 0x44, 0xf1, 0xc8, 0x38, 0xc1, 0xf0, 0x49, 0x28, 0x08,
+    0x80, 0xb0, 0x07, 0x90, 0xf1, 0x48, 0x00, 0x08, 0xc3, 0x80, 0x00, 0x40, 0x29, 0x00, 0x80, 0xac,
+    0x10, 0x06, 0x91, 0x22, 0x30, 0x71, 0xe8, 0x39, 0x81, 0x03, 0x2f, 0x10, 0x2f, 0x90, 0x10, 0x06,
+    0x91, 0x22, 0x24, 0x6a, 0x6c, 0x10, 0x84, 0x67, 0x2e, 0x0f, 0x80, 0xb0, 0xf0, 0x48, 0x10, 0x97,
+    0x11, 0x06, 0x82, 0xe6, 0x2a, 0xff, 0x9a, 0x27, 0x64, 0x66, 0x32, 0xa4, 0x36, 0x10, 0x80, 0x08,
+    0x21, 0x60, 0x9f, 0xff, 0x28, 0xb0, 0x3b, 0x41, 0x3b, 0xc2, 0xc9, 0x47, 0x3c, 0xef, 0x0a, 0xe6,
+    0x2b, 0xb4, 0x80, 0x09, 0x00, 0xe0, 0x22, 0x38, 0x80, 0x09, 0xf0, 0xc8, 0x38, 0x44, 0xc8, 0x40,
+    0xea, 0x44, 0xea, 0x18, 0x10, 0x92, 0xf0, 0x48, 0xd8, 0x91, 0x61, 0x74, 0x6d, 0x74, 0x42, 0x9f,
+    0x08, 0xe6, 0x2b, 0xb4, 0x80, 0x09, 0x00, 0xe4, 0x22, 0x38, 0x80, 0x09, 0x28, 0x08, 0x81, 0x0c,
+    0xe8, 0x19, 0x40, 0x10, 0x10, 0x06, 0x91, 0x22, 0x70, 0x76, 0x81, 0xa5, 0x00, 0x08, 0xc4, 0x00,
+    0x00, 0x40, 0x2c, 0x90, 0x10, 0x96, 0x82, 0x10, 0x64, 0x69, 0x84, 0x39, 0x10, 0x06, 0x91, 0x22,
+    0x64, 0x6a, 0x84, 0x31, 0x2e, 0x09, 0x80, 0x58, 0x2b, 0xe2, 0x9f, 0xea, 0x2a, 0xe2, 0x9f, 0xd4,
+    0x29, 0xe2, 0x9f, 0xbf, 0x38, 0xc1, 0x50, 0x91, 0x29, 0x08, 0x81, 0x08, 0x54, 0xb8, 0x6c, 0x7d,
+    0x44, 0xb0, 0x50, 0x90, 0x28, 0x09, 0x81, 0x08, 0x40, 0xa9, 0x10, 0x06, 0x91, 0x22, 0x70, 0x71,
+    0x81, 0xe5, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0, 0x10, 0x00, 0x82, 0x88, 0x31, 0x18,
+    0x80, 0x02, 0x74, 0x40, 0xd0, 0x21, 0x84, 0x67, 0x10, 0x00, 0x82, 0xc0, 0x31, 0x18, 0x80, 0x0f,
+    0xd4, 0x21, 0x84, 0x41, 0xf9, 0xc7, 0xf2, 0xc4, 0xf1, 0xc6, 0xf0, 0xc5, 0xf9, 0x41, 0x16, 0x86,
+    0x87, 0x18, 0x17, 0x86, 0x87, 0x14, 0xe8, 0xee, 0x02, 0x86, 0x87, 0x18, 0x00, 0x86, 0x87, 0x14,
+    0x01, 0x86, 0x00, 0x08, 0xc4, 0x80, 0x00, 0x40, 0x83, 0x18, 0x32, 0x24, 0x37, 0xf6, 0x80, 0x09,
+    0x39, 0x60, 0x38, 0xb8, 0x80, 0x0a, 0x10, 0x86, 0x87, 0x14, 0x00, 0x86, 0x83, 0x18, 0x06, 0x86,
+    0x87, 0x18, 0x88, 0x20, 0x07, 0x86, 0x87, 0x14, 0xf9, 0xc7, 0xf9, 0x41, 0xe8, 0xee, 0x32, 0x24,
+    0x37, 0xf6, 0x80, 0x09, 0x39, 0x60, 0x38, 0xb8, 0x80, 0x0a, 0x10, 0x86, 0x87, 0x14, 0x00, 0x86,
+    0x83, 0x18, 0x2f, 0x10, 0x2f, 0x90, 0x10, 0x06, 0x91, 0x22, 0x64, 0x6a, 0x84, 0x7d, 0x09, 0xe6,
+    0x2b, 0xb4, 0x80, 0x09, 0xc8, 0x47, 0x29, 0x0b, 0x81, 0x38, 0xc9, 0xac, 0xe8, 0x1b, 0xca, 0x47,
+    0xeb, 0x39, 0xeb, 0x1a, 0x50, 0x13, 0x40, 0x10, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0,
+    0x10, 0x00, 0x82, 0x88, 0x31, 0x18, 0x80, 0x02, 0x34, 0x40, 0x08, 0xe6, 0x2b, 0xb4, 0x80, 0x09,
+    0xd0, 0x21, 0x84, 0x3b, 0x28, 0x08, 0x81, 0x38, 0x00, 0x08, 0xc5, 0x00, 0x00, 0x40, 0xe8, 0x1a,
+    0x20, 0x60, 0x9f, 0xff, 0x40, 0x10, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0, 0x10, 0x00,
+    0x82, 0x88, 0x0d, 0x00, 0xa0, 0x01, 0x84, 0x1d, 0x08, 0xe6, 0x2b, 0xb4, 0x80, 0x09, 0xf9, 0xc7,
+    0x2a, 0xff, 0x98, 0x95, 0x58, 0x90, 0x09, 0xe6, 0x2b, 0xb4, 0x80, 0x09, 0x2a, 0xff, 0x98, 0x8f,
+    0x58, 0x99, 0x3b, 0x41, 0x3b, 0xc2, 0x10, 0x06, 0x91, 0x22, 0x70, 0x76, 0x81, 0x89, 0x10, 0x96,
+    0x82, 0x10, 0x78, 0x41, 0x34, 0x78, 0x00, 0x06, 0x82, 0x10, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09,
+    0x90, 0xc0, 0x11, 0x00, 0x81, 0xa2, 0x30, 0xf0, 0x6c, 0x10, 0x80, 0x07, 0x00, 0x06, 0x82, 0x10,
+    0x10, 0x96, 0x82, 0x12, 0x21, 0x60, 0x9f, 0xff, 0x32, 0xa4, 0x36, 0x00, 0x80, 0x08, 0x78, 0x41,
+    0x2c, 0x90, 0x38, 0x00, 0x20, 0xf6, 0x80, 0x08, 0x00, 0x06, 0x82, 0x12, 0x01, 0x10, 0x00, 0x08,
+    0xc5, 0x80, 0x00, 0x40, 0xe9, 0xee, 0x10, 0xd0, 0x08, 0x86, 0x3a, 0x54, 0x80, 0x09, 0x90, 0xc0,
+    0x00, 0x00, 0x80, 0x4a, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0, 0x10, 0x00, 0x82, 0x88,
+    0x0d, 0x00, 0xa0, 0x01, 0x84, 0x51, 0x08, 0xe6, 0x2b, 0xb4, 0x80, 0x09, 0x90, 0xc0, 0xe8, 0x44,
+    0xf8, 0x41, 0x32, 0x24, 0x3c, 0xf6, 0x80, 0x09, 0x38, 0x60, 0x3a, 0xc4, 0x80, 0x0a, 0x2c, 0x10,
+    0x11, 0x06, 0x91, 0x22, 0x24, 0xea, 0x2c, 0x90, 0x38, 0x60, 0x3f, 0x58, 0x80, 0x0a, 0x84, 0x27,
+    0x38, 0x41, 0x38, 0xc2, 0x12, 0x58, 0xc9, 0x41, 0x0a, 0xe6, 0x2b, 0xb4, 0x80, 0x09, 0x90, 0xc0,
+    0x2a, 0x0a, 0x81, 0x38, 0xea, 0x19, 0x53, 0x52, 0x65, 0x3d, 0x42, 0x52, 0x12, 0x06, 0x91, 0x22,
+    0x71, 0x70, 0x81, 0xdf, 0x0a, 0xe6, 0x2b, 0xb4, 0x80, 0x09, 0xf8, 0xc7, 0x32, 0xa4, 0x38, 0xa0,
+    0x80, 0x08, 0x2a, 0x09, 0x00, 0x08, 0xc6, 0x00, 0x00, 0x40, 0x81, 0x38, 0x00, 0xe4, 0x2a, 0x4c,
+    0x80, 0x09, 0xf0, 0x01, 0xf9, 0xc7, 0x32, 0xa4, 0x3c, 0x50, 0x80, 0x08, 0x38, 0xa0, 0x20, 0x00,
+    0x80, 0x0c, 0x38, 0xe8, 0x3c, 0x0c, 0xbf, 0xff, 0x31, 0xe9, 0x3f, 0xff, 0xbf, 0xff, 0x12, 0x90,
+    0xc0, 0xb2, 0xdc, 0x82, 0x09, 0x91, 0xa0, 0x00, 0x32, 0xe4, 0x3a, 0x68, 0x80, 0x01, 0x41, 0x90,
+    0x38, 0xe8, 0x3c, 0x28, 0xbf, 0xff, 0xc0, 0xfd, 0x15, 0x90, 0xc1, 0xf7, 0xdc, 0x05, 0x00, 0x90,
+    0xc2, 0xfb, 0x10, 0x90, 0xc4, 0xfe, 0xdc, 0x80, 0x09, 0x01, 0xa0, 0x08, 0x41, 0x90, 0x50, 0x90,
+    0xdd, 0x00, 0x09, 0x02, 0xa0, 0x04, 0x42, 0x90, 0x11, 0x90, 0x00, 0xe4, 0x2a, 0x4a, 0x80, 0x09,
+    0x7c, 0x44, 0x23, 0xe0, 0x9f, 0x0f, 0x31, 0x18, 0x80, 0xf0, 0xdd, 0x81, 0xdc, 0x1b, 0x00, 0x90,
+    0xc0, 0x83, 0x00, 0x06, 0x91, 0x20, 0x50, 0x90, 0xde, 0x00, 0x00, 0x08, 0xc6, 0x80, 0x00, 0x40,
+    0x09, 0x04, 0xa0, 0x01, 0x44, 0x90, 0x9f, 0x7d, 0x10, 0x96, 0x91, 0x20, 0xd0, 0x24, 0x9f, 0x7c,
+    0x27, 0x18, 0x81, 0x5c, 0x00, 0xe4, 0x2a, 0x4a, 0x80, 0x09, 0xc1, 0x8f, 0x2d, 0x11, 0x10, 0x96,
+    0x82, 0xfc, 0x64, 0x69, 0x84, 0x0c, 0x94, 0xc3, 0x2c, 0x00, 0x8b, 0x1c, 0x2c, 0x00, 0x8d, 0x1c,
+    0x2d, 0x90, 0x36, 0x72, 0x36, 0xf2, 0x01, 0xe4, 0x2a, 0x46, 0x80, 0x09, 0x34, 0x41, 0x3a, 0x61,
+    0xcc, 0x51, 0x24, 0x6a, 0x39, 0xc0, 0x20, 0x04, 0x80, 0x0c, 0x2e, 0x08, 0x8f, 0x1c, 0x84, 0x7e,
+    0xec, 0x1e, 0x2b, 0x02, 0x80, 0x04, 0x3a, 0xc0, 0x20, 0x00, 0x80, 0x0c, 0xeb, 0xe8, 0x26, 0xea,
+    0x34, 0xf2, 0x56, 0xba, 0x84, 0x15, 0x32, 0x24, 0x3e, 0xb0, 0x80, 0x09, 0x74, 0x56, 0xd7, 0x1c,
+    0x3d, 0x19, 0x80, 0x01, 0x88, 0x0e, 0x6c, 0x51, 0x32, 0x24, 0x3e, 0xb0, 0x80, 0x09, 0x34, 0x56,
+    0x00, 0x08, 0xc7, 0x00, 0x00, 0x40, 0x74, 0xf2, 0x26, 0xea, 0x11, 0x1b, 0x57, 0xb9, 0x84, 0x18,
+    0x2f, 0x51, 0x34, 0x57, 0x74, 0xf2, 0x33, 0x24, 0x3e, 0xb0, 0x80, 0x09, 0xd7, 0x9c, 0x3f, 0x19,
+    0x80, 0x01, 0x88, 0x0e, 0x6c, 0x51, 0x32, 0x24, 0x3e, 0xb0, 0x80, 0x09, 0x34, 0x57, 0x74, 0xf2,
+    0x3f, 0x48, 0x39, 0xc1, 0x51, 0x1b, 0x2c, 0x51, 0x27, 0x65, 0xcc, 0x59, 0x3c, 0x48, 0x3f, 0x48,
+    0x74, 0xc1, 0x24, 0x65, 0x37, 0x5e, 0x70, 0xf3, 0x3c, 0x48, 0x46, 0x5c, 0x74, 0x58, 0x81, 0x96,
+    0x40, 0x5c, 0x36, 0x72, 0x36, 0xf2, 0xcc, 0x59, 0x35, 0xc1, 0x3a, 0x61, 0x3a, 0xc0, 0x20, 0x0c,
+    0x80, 0x0c, 0x30, 0xf3, 0x39, 0xc0, 0x20, 0x08, 0x80, 0x0c, 0x84, 0x6d, 0x2b, 0x02, 0x80, 0x04,
+    0x26, 0xea, 0x74, 0xf2, 0x84, 0x16, 0x56, 0xb9, 0x32, 0x24, 0x3e, 0xb0, 0x80, 0x09, 0x74, 0x56,
+    0xd7, 0x1c, 0x3d, 0x19, 0x80, 0x01, 0x00, 0x08, 0xc7, 0x80, 0x00, 0x40, 0x88, 0x10, 0x6f, 0x51,
+    0x32, 0x24, 0x3e, 0xb0, 0x80, 0x09, 0x34, 0x56, 0x74, 0xf2, 0x77, 0x50, 0x26, 0xea, 0x34, 0xf2,
+    0x57, 0xba, 0x84, 0x15, 0x32, 0x24, 0x3e, 0xb0, 0x80, 0x09, 0x74, 0x57, 0xd7, 0x9c, 0x3f, 0x19,
+    0x80, 0x01, 0x88, 0x0e, 0x6c, 0x51, 0x32, 0x24, 0x3e, 0xb0, 0x80, 0x09, 0x34, 0x57, 0x74, 0xf2,
+    0x3f, 0x48, 0x3c, 0x48, 0x39, 0xc1, 0xcc, 0x59, 0x27, 0x65, 0x24, 0x65, 0x70, 0xf3, 0x3f, 0x48,
+    0x7c, 0x48, 0x37, 0x5e, 0x74, 0x58, 0x46, 0x58, 0x81, 0x9e, 0x40, 0x58, 0x9f, 0x7d, 0x11, 0x96,
+    0x82, 0xe8, 0x09, 0x01, 0xa0, 0x02, 0x34, 0xf9, 0xc0, 0xfe, 0xdc, 0x01, 0x00, 0x06, 0x82, 0xe8,
+    0x9f, 0x7c, 0x6c, 0x10, 0x00, 0x06, 0x91, 0x20, 0x27, 0xe8, 0x9f, 0xc0, 0x30, 0x24, 0x3f, 0x50,
+    0x80, 0x09, 0xe7, 0xe8, 0x2a, 0xff, 0x95, 0xdd, 0x38, 0x00, 0x24, 0x9c, 0x00, 0x08, 0xc8, 0x00,
+    0x00, 0x40, 0x80, 0x0a, 0x02, 0x07, 0x27, 0x86, 0x80, 0x0a, 0x0c, 0x02, 0xa0, 0x01, 0x80, 0x35,
+    0xc0, 0xfe, 0x01, 0x07, 0x27, 0x80, 0x80, 0x0a, 0x38, 0xc1, 0x38, 0x00, 0x20, 0x64, 0x80, 0x08,
+    0xdc, 0x02, 0x00, 0x00, 0x27, 0x86, 0x80, 0x0a, 0x01, 0x00, 0x27, 0x80, 0x80, 0x0a, 0x10, 0xd0,
+    0x39, 0xe8, 0x24, 0x04, 0xbf, 0xff, 0x78, 0x41, 0x40, 0x10, 0x50, 0x91, 0x09, 0x10, 0xa0, 0x01,
+    0x40, 0x91, 0x9f, 0x71, 0x33, 0xc4, 0x39, 0x96, 0x80, 0x08, 0x2c, 0x10, 0x58, 0x90, 0x90, 0xc0,
+    0x51, 0x90, 0x0d, 0x01, 0xa0, 0x20, 0x80, 0x15, 0x01, 0x07, 0x35, 0xbc, 0x80, 0x0a, 0xd0, 0xa1,
+    0x80, 0x0b, 0xd0, 0xa3, 0x80, 0x07, 0x64, 0xe9, 0x84, 0x05, 0xc0, 0x81, 0x9f, 0x71, 0x33, 0x24,
+    0x3f, 0x30, 0x80, 0x09, 0x2c, 0x90, 0xe7, 0x48, 0x20, 0x00, 0x91, 0x24, 0xf0, 0x41, 0xee, 0xe9,
+    0x32, 0xe4, 0x00, 0x08, 0xc8, 0x80, 0x00, 0x40, 0x3c, 0x8a, 0x80, 0x01, 0xef, 0xe8, 0x00, 0x04,
+    0x38, 0x70, 0x80, 0x0a, 0xd0, 0x30, 0x21, 0x00, 0x81, 0x00, 0xc2, 0x88, 0x94, 0xc2, 0x20, 0x00,
+    0x80, 0x80, 0x01, 0xe0, 0x2a, 0x4c, 0x80, 0x09, 0x80, 0x10, 0x02, 0xe0, 0x2a, 0x4a, 0x80, 0x09,
+    0x21, 0x00, 0x80, 0x80, 0x20, 0x00, 0x80, 0x40, 0x2f, 0x90, 0x00, 0xe0, 0x2a, 0x44, 0x80, 0x09,
+    0x2c, 0x90, 0x01, 0xe0, 0x2a, 0x46, 0x80, 0x09, 0xc0, 0x96, 0x00, 0x07, 0x91, 0x22, 0x10, 0x06,
+    0x81, 0xa4, 0x00, 0x07, 0x82, 0xcc, 0x10, 0x06, 0x81, 0xa6, 0x00, 0x07, 0x82, 0xce, 0x10, 0x06,
+    0x81, 0xaa, 0x00, 0x07, 0x82, 0xd0, 0x10, 0x06, 0x81, 0xac, 0x00, 0x07, 0x82, 0xd2, 0x10, 0x06,
+    0x81, 0xae, 0x00, 0x07, 0x82, 0xd4, 0x10, 0x06, 0x81, 0xb2, 0x00, 0x07, 0x82, 0xd6, 0x12, 0x06,
+    0x81, 0xb8, 0x3d, 0x64, 0xc5, 0x9e, 0x3a, 0x00, 0x00, 0x08, 0xc9, 0x00, 0x00, 0x40, 0xa0, 0x04,
+    0x76, 0x55, 0x30, 0x00, 0x20, 0x00, 0xbf, 0xe0, 0x02, 0x07, 0x82, 0xda, 0x13, 0x06, 0x81, 0xce,
+    0x3d, 0xcf, 0x32, 0x08, 0x20, 0x00, 0x81, 0x70, 0x2d, 0x90, 0x03, 0xe2, 0x22, 0x04, 0x80, 0x09,
+    0x14, 0x06, 0x81, 0x96, 0x04, 0xe0, 0x22, 0x3a, 0x80, 0x09, 0x14, 0x06, 0x81, 0xb8, 0x39, 0x1c,
+    0x80, 0x0f, 0x04, 0x07, 0x82, 0xd8, 0x14, 0x06, 0x81, 0xbc, 0x04, 0x07, 0x82, 0xdc, 0x14, 0x06,
+    0x81, 0xc0, 0x04, 0x07, 0x82, 0xe0, 0x14, 0x06, 0x81, 0xc4, 0x04, 0x07, 0x82, 0xe2, 0x14, 0x96,
+    0x81, 0xc8, 0x04, 0x07, 0x82, 0xe6, 0x14, 0x06, 0x81, 0x14, 0x34, 0x00, 0xa0, 0x04, 0x74, 0x54,
+    0x34, 0x00, 0xa8, 0x04, 0x6c, 0x7d, 0x36, 0x00, 0xa8, 0x0c, 0x74, 0x54, 0x76, 0x57, 0x34, 0x00,
+    0xa8, 0x04, 0x6c, 0x7c, 0x3a, 0x00, 0xa8, 0x00, 0x77, 0x54, 0x33, 0xe4, 0x3e, 0x52, 0x00, 0x08,
+    0xc9, 0x80, 0x00, 0x40, 0x80, 0x01, 0x32, 0xe4, 0x3e, 0xa0, 0x80, 0x01, 0x37, 0xd0, 0x34, 0x56,
+    0x77, 0x51, 0x27, 0x60, 0x35, 0x50, 0x35, 0xd1, 0x74, 0x57, 0x32, 0xe4, 0x3e, 0xac, 0x80, 0x01,
+    0x74, 0xd6, 0x33, 0xe4, 0x3e, 0xbe, 0x80, 0x01, 0x33, 0x04, 0x2a, 0x86, 0x80, 0x09, 0x2c, 0x90,
+    0x00, 0x87, 0x91, 0x1c, 0x27, 0x04, 0x81, 0x00, 0x10, 0x06, 0x81, 0xc6, 0x39, 0xe0, 0x28, 0x44,
+    0x80, 0x09, 0x38, 0xe0, 0x26, 0x44, 0x80, 0x09, 0x01, 0x17, 0x82, 0xec, 0x00, 0x07, 0x83, 0x06,
+    0x01, 0x07, 0x82, 0xee, 0x94, 0xc8, 0x41, 0x18, 0x41, 0x19, 0x2f, 0x08, 0x8b, 0x1c, 0x08, 0x87,
+    0x82, 0xf4, 0x28, 0x08, 0x82, 0x00, 0x08, 0x87, 0x82, 0xf8, 0x00, 0x04, 0x38, 0x70, 0x80, 0x0a,
+    0xd0, 0x30, 0x84, 0x23, 0x21, 0x00, 0x80, 0x7f, 0x01, 0x07, 0x82, 0x14, 0x18, 0x06, 0x81, 0xbe,
+    0x10, 0x97, 0x82, 0xe0, 0x00, 0x08, 0xca, 0x00, 0x00, 0x40, 0xe8, 0xfc, 0x09, 0x00, 0xa0, 0x01,
+    0x08, 0x07, 0x82, 0xde, 0x88, 0x20, 0x00, 0x07, 0x82, 0xe0, 0xc2, 0xbf, 0xc1, 0xfe, 0x10, 0x97,
+    0x82, 0xe0, 0x02, 0x07, 0x82, 0x14, 0x12, 0x06, 0x81, 0xbe, 0xdc, 0x80, 0x02, 0x07, 0x82, 0xde,
+    0x01, 0x07, 0x82, 0xe0, 0x2c, 0x10, 0x39, 0xc0, 0x2e, 0xea, 0x80, 0x08, 0x00, 0x07, 0x91, 0x20,
+    0x32, 0xe4, 0x3a, 0x5c, 0x80, 0x01, 0xc0, 0xb2, 0xc1, 0x83, 0x32, 0xe4, 0x3a, 0x62, 0x80, 0x01,
+    0xc0, 0xb2, 0x11, 0x06, 0x82, 0xc0, 0x33, 0x18, 0x80, 0x0f, 0xd0, 0x23, 0x84, 0x15, 0x33, 0x18,
+    0x80, 0xf0, 0x7c, 0x64, 0xd0, 0x21, 0x84, 0x0b, 0x33, 0x24, 0x22, 0x50, 0x80, 0x09, 0x88, 0x09,
+    0x33, 0x04, 0x3a, 0xc0, 0x80, 0x09, 0x10, 0x06, 0x82, 0x88, 0x0d, 0x00, 0xa0, 0x01, 0x84, 0x0f,
+    0x32, 0x24, 0x3a, 0x3e, 0x80, 0x09, 0x38, 0x60, 0x3a, 0xc4, 0x00, 0x08, 0xca, 0x80, 0x00, 0x40,
+    0x80, 0x0a, 0x10, 0x06, 0x82, 0x88, 0x31, 0x18, 0x80, 0x02, 0x34, 0x40, 0xe9, 0xee, 0xd0, 0x21,
+    0x84, 0x0f, 0x32, 0x24, 0x37, 0xba, 0x80, 0x09, 0x38, 0x60, 0x38, 0xb8, 0x80, 0x0a, 0x30, 0x24,
+    0x3f, 0x50, 0x80, 0x09, 0xe7, 0x68, 0x10, 0x51, 0xf1, 0x86, 0x64, 0xea, 0x84, 0x17, 0x9b, 0x41,
+    0x2b, 0x03, 0x80, 0x08, 0x01, 0xfc, 0x9f, 0xf6, 0x92, 0xd0, 0x52, 0x50, 0x25, 0x51, 0x74, 0x52,
+    0x42, 0x58, 0x9f, 0x70, 0x40, 0x51, 0x33, 0x24, 0x3f, 0x30, 0x80, 0x09, 0x2c, 0x90, 0x2d, 0x10,
+    0x0a, 0x07, 0x27, 0x7c, 0x80, 0x0a, 0x0d, 0x0a, 0xa0, 0x01, 0x94, 0xc6, 0xc9, 0x4c, 0x6d, 0x90,
+    0x00, 0xe4, 0x2a, 0x46, 0x80, 0x09, 0xe7, 0x48, 0x94, 0xc7, 0x64, 0x6a, 0xc3, 0x81, 0xc8, 0x48,
+    0x84, 0x90, 0x03, 0x7c, 0x9f, 0xf8, 0xc9, 0x44, 0xc8, 0x40, 0xfa, 0xc9, 0x13, 0x7c, 0x9f, 0xf8,
+    0x00, 0x08, 0xcb, 0x00, 0x00, 0x40, 0x3b, 0x40, 0x3c, 0x7e, 0x80, 0x09, 0xf5, 0x93, 0x04, 0xe4,
+    0x2a, 0x44, 0x80, 0x09, 0x3e, 0x41, 0xd6, 0xc1, 0x72, 0x65, 0x84, 0x09, 0xf5, 0x93, 0x6e, 0x15,
+    0xf4, 0x13, 0x37, 0xd2, 0x36, 0x50, 0x25, 0xe9, 0xf5, 0x93, 0x3f, 0xc1, 0xd6, 0xc1, 0x3e, 0xc1,
+    0x3b, 0xc1, 0xcd, 0x47, 0x3f, 0xc2, 0xcc, 0x45, 0xce, 0x45, 0xec, 0x1a, 0x16, 0x14, 0xcc, 0x47,
+    0xed, 0x1b, 0x17, 0x15, 0xee, 0x19, 0x55, 0x16, 0x2b, 0x3b, 0x2b, 0xbf, 0xec, 0x18, 0xc5, 0x88,
+    0x6a, 0x09, 0x36, 0x50, 0xcd, 0x44, 0x90, 0xc0, 0x2f, 0x10, 0x46, 0x95, 0x80, 0x1c, 0x47, 0x94,
+    0x79, 0x41, 0x2a, 0x09, 0x76, 0xd2, 0x3e, 0xc1, 0xcc, 0x44, 0x7a, 0xc1, 0x3e, 0xc2, 0x46, 0x94,
+    0xcc, 0x45, 0x90, 0xc0, 0xec, 0x18, 0x46, 0x94, 0x39, 0x41, 0x38, 0xc1, 0x04, 0xe4, 0x2a, 0x46,
+    0x80, 0x09, 0x72, 0x72, 0x81, 0x89, 0x00, 0x08, 0xcb, 0x80, 0x00, 0x40, 0x30, 0x24, 0x3f, 0x50,
+    0x80, 0x09, 0xe7, 0x68, 0x33, 0x24, 0x3f, 0x30, 0x80, 0x09, 0xee, 0xe8, 0x10, 0x96, 0x82, 0xf0,
+    0x36, 0x10, 0x80, 0xff, 0x84, 0x0a, 0x2c, 0x10, 0xe7, 0x48, 0x00, 0x06, 0x82, 0xf0, 0x10, 0x96,
+    0x82, 0xf0, 0x12, 0x06, 0x82, 0xee, 0x2d, 0x52, 0x39, 0xe0, 0x26, 0x44, 0x80, 0x09, 0xc8, 0x42,
+    0x10, 0x06, 0x83, 0x0c, 0xe8, 0xf9, 0xe8, 0xfc, 0xe9, 0x18, 0x00, 0x11, 0x39, 0xe0, 0x28, 0x44,
+    0x80, 0x09, 0x10, 0x06, 0x83, 0x0e, 0xe9, 0x18, 0x00, 0x11, 0x3a, 0xe0, 0x24, 0x44, 0x80, 0x09,
+    0x39, 0xe0, 0x22, 0x44, 0x80, 0x09, 0xea, 0x18, 0x01, 0x12, 0xf0, 0x91, 0xe8, 0x19, 0x00, 0x10,
+    0x38, 0x00, 0x20, 0xf4, 0x80, 0x08, 0x10, 0x96, 0x82, 0xf0, 0x38, 0x41, 0x39, 0xe0, 0x26, 0x44,
+    0x80, 0x09, 0x34, 0xf8, 0x00, 0x06, 0x82, 0xf0, 0x00, 0xe4, 0x2a, 0x44, 0x00, 0x08, 0xcc, 0x00,
+    0x00, 0x40, 0x80, 0x09, 0x30, 0x71, 0x6c, 0x90, 0x25, 0x18, 0x81, 0xda, 0x10, 0x96, 0x82, 0xe8,
+    0x09, 0x00, 0xa0, 0x05, 0x01, 0x06, 0x82, 0xf0, 0x00, 0x06, 0x82, 0xe8, 0x41, 0x10, 0x10, 0xd0,
+    0x08, 0x86, 0x3a, 0x54, 0x80, 0x09, 0x2e, 0x0a, 0x82, 0xfe, 0x00, 0x00, 0x80, 0x48, 0x00, 0x06,
+    0x35, 0xc4, 0x80, 0x0a, 0x31, 0x69, 0x90, 0x00, 0x3c, 0xfc, 0x00, 0xe4, 0x2a, 0x44, 0x80, 0x09,
+    0x01, 0xe0, 0x2a, 0x48, 0x80, 0x09, 0x18, 0x06, 0x82, 0xee, 0x11, 0x06, 0x83, 0x06, 0xe8, 0xfc,
+    0xe8, 0x19, 0xf1, 0x01, 0xf0, 0x02, 0x2a, 0xff, 0x9e, 0x53, 0xe9, 0xea, 0x18, 0x06, 0x82, 0xee,
+    0x39, 0xe0, 0x28, 0x44, 0x80, 0x09, 0xe8, 0xfc, 0xe8, 0x19, 0x11, 0x06, 0x83, 0x06, 0xea, 0x44,
+    0x00, 0xe4, 0x2a, 0x44, 0x80, 0x09, 0xf0, 0x02, 0xf1, 0x01, 0x2a, 0xff, 0x9e, 0x2f, 0xe9, 0xea,
+    0x18, 0x06, 0x00, 0x08, 0xcc, 0x80, 0x00, 0x40, 0x82, 0xee, 0x39, 0xe0, 0x24, 0x44, 0x80, 0x09,
+    0xe8, 0xfc, 0xe8, 0x19, 0x11, 0x06, 0x83, 0x06, 0xea, 0x46, 0x00, 0xe4, 0x2a, 0x44, 0x80, 0x09,
+    0xf0, 0x02, 0xf1, 0x01, 0x2a, 0xff, 0x9e, 0x0b, 0xe9, 0xea, 0x18, 0x06, 0x82, 0xee, 0x39, 0xe0,
+    0x22, 0x44, 0x80, 0x09, 0xe8, 0xfc, 0xe8, 0x19, 0x11, 0x06, 0x83, 0x06, 0xea, 0x42, 0x00, 0xe4,
+    0x2a, 0x44, 0x80, 0x09, 0xf0, 0x02, 0xf1, 0x01, 0x2a, 0xff, 0x9d, 0xe7, 0xe9, 0xea, 0x10, 0x06,
+    0x82, 0xee, 0x24, 0x69, 0x10, 0x16, 0x82, 0xec, 0x92, 0xc3, 0x6c, 0x90, 0x98, 0xc6, 0x64, 0x69,
+    0x01, 0xe4, 0x2a, 0x44, 0x80, 0x09, 0x84, 0x0e, 0x98, 0xc7, 0x01, 0x06, 0x82, 0xee, 0x90, 0xc0,
+    0x6d, 0x10, 0xc2, 0x81, 0x10, 0x06, 0x82, 0xee, 0x31, 0xe1, 0x26, 0x44, 0x80, 0x09, 0xf0, 0x03,
+    0xf1, 0x41, 0x02, 0x16, 0x82, 0xec, 0x39, 0xe0, 0x00, 0x08, 0xcd, 0x00, 0x00, 0x40, 0x28, 0x44,
+    0x80, 0x09, 0x2a, 0xff, 0x9d, 0xc3, 0x38, 0xa0, 0x20, 0x00, 0x80, 0x0c, 0x38, 0xe8, 0x3c, 0x0c,
+    0xbf, 0xff, 0x31, 0xe9, 0x3f, 0xff, 0xbf, 0xff, 0x12, 0x90, 0xc0, 0xb2, 0xdc, 0x82, 0x09, 0x91,
+    0xa0, 0x00, 0x32, 0xe4, 0x3a, 0x68, 0x80, 0x01, 0x41, 0x90, 0x38, 0xe8, 0x3c, 0x28, 0xbf, 0xff,
+    0xc0, 0xfd, 0x15, 0x90, 0xc1, 0xf7, 0xdc, 0x05, 0x00, 0x90, 0xc2, 0xfb, 0x10, 0x90, 0xc4, 0xfe,
+    0xdc, 0x80, 0x01, 0x90, 0x30, 0xe1, 0x22, 0x44, 0x80, 0x09, 0x10, 0x90, 0xf0, 0x41, 0xdd, 0x00,
+    0x09, 0x02, 0xa0, 0x04, 0x02, 0x90, 0x39, 0xe0, 0x24, 0x44, 0x80, 0x09, 0x11, 0x90, 0x00, 0xe4,
+    0x2a, 0x4a, 0x80, 0x09, 0x7c, 0x44, 0x23, 0xe0, 0x9f, 0x0f, 0x31, 0x18, 0x80, 0xf0, 0xdd, 0x81,
+    0xdc, 0x1b, 0x00, 0x90, 0xc0, 0x81, 0x00, 0x06, 0x91, 0x20, 0x50, 0x90, 0xde, 0x00, 0x00, 0x08,
+    0xcd, 0x80, 0x00, 0x40, 0x09, 0x04, 0xa0, 0x01, 0x04, 0x90, 0x38, 0xa0, 0x30, 0x00, 0x80, 0x0c,
+    0x10, 0x06, 0x82, 0xee, 0x2a, 0xff, 0x9d, 0x37, 0xf0, 0x03, 0x2c, 0x10, 0x38, 0xe8, 0x3c, 0x28,
+    0xbf, 0xff, 0x00, 0xe2, 0x22, 0x40, 0x80, 0x09, 0x11, 0x90, 0x38, 0xe8, 0x3c, 0x28, 0xbf, 0xff,
+    0x0d, 0x81, 0xa0, 0x00, 0x80, 0x13, 0x78, 0x41, 0x00, 0xe2, 0x22, 0x40, 0x80, 0x09, 0x51, 0x90,
+    0x0c, 0x81, 0xa0, 0x00, 0x81, 0xf3, 0x38, 0xe8, 0x3c, 0x28, 0xbf, 0xff, 0xc0, 0xfd, 0x12, 0x90,
+    0xc1, 0xfe, 0xdc, 0x02, 0x09, 0x00, 0xa0, 0x02, 0x40, 0x90, 0x50, 0x90, 0xdc, 0x80, 0x09, 0x01,
+    0xa0, 0x01, 0x41, 0x90, 0x10, 0x96, 0x82, 0xe8, 0x0c, 0x00, 0xa0, 0x04, 0x80, 0x63, 0x2d, 0x10,
+    0x11, 0x96, 0x82, 0xf2, 0x38, 0xc1, 0x10, 0x06, 0x82, 0xde, 0x34, 0xf9, 0x01, 0x06, 0x82, 0xf2,
+    0x30, 0x71, 0xc1, 0xfb, 0x00, 0x08, 0xce, 0x00, 0x00, 0x40, 0x80, 0x4b, 0x10, 0x96, 0x82, 0xe8,
+    0xdc, 0x80, 0x34, 0x79, 0x02, 0x06, 0x82, 0xf2, 0x0d, 0x00, 0xa0, 0x02, 0x80, 0x12, 0x01, 0x06,
+    0x82, 0xe8, 0x10, 0x96, 0x82, 0xea, 0x09, 0x00, 0xa0, 0x01, 0x00, 0x06, 0x82, 0xea, 0x2e, 0x09,
+    0x8b, 0x1c, 0xc0, 0xfd, 0x12, 0x96, 0x82, 0xe8, 0x11, 0x96, 0x82, 0xfc, 0x29, 0x08, 0x82, 0x00,
+    0xdc, 0x02, 0xd8, 0x81, 0x00, 0x06, 0x82, 0xe8, 0x01, 0x06, 0x82, 0xfc, 0x09, 0x86, 0x82, 0xf4,
+    0x08, 0x86, 0x82, 0xf8, 0x10, 0x96, 0x82, 0xfc, 0x64, 0x69, 0x84, 0x31, 0x18, 0x86, 0x82, 0xf4,
+    0x10, 0x96, 0x82, 0xe0, 0x10, 0x10, 0x0d, 0x00, 0xa0, 0x01, 0xe8, 0x44, 0x80, 0x08, 0x00, 0x06,
+    0x83, 0x0e, 0xe8, 0x44, 0x2e, 0x09, 0x8d, 0x1c, 0xe9, 0x88, 0x80, 0x0b, 0x2a, 0x00, 0x82, 0x00,
+    0xe8, 0xe9, 0xe8, 0x3a, 0x88, 0x32, 0x2a, 0x00, 0x8a, 0x28, 0x00, 0x08, 0xce, 0x80, 0x00, 0x40,
+    0x18, 0x86, 0x82, 0xf8, 0x10, 0x96, 0x82, 0xe0, 0x10, 0x10, 0x0d, 0x00, 0xa0, 0x01, 0xe8, 0x44,
+    0x80, 0x08, 0x00, 0x06, 0x83, 0x0e, 0xe8, 0x44, 0x2e, 0x09, 0x8f, 0x1c, 0xe9, 0x88, 0x80, 0x0b,
+    0x2a, 0x00, 0x82, 0x00, 0xe8, 0xe9, 0xe8, 0x3a, 0x2a, 0x00, 0x8c, 0x24, 0xe7, 0x68, 0xe9, 0x3a,
+    0x48, 0x91, 0x11, 0x06, 0x83, 0x0e, 0x3c, 0xcf, 0x10, 0x06, 0x83, 0x00, 0x12, 0x06, 0x83, 0x06,
+    0x28, 0x92, 0x10, 0x06, 0x83, 0x0c, 0x24, 0xe8, 0x00, 0x06, 0x83, 0x12, 0x94, 0xc3, 0x33, 0x41,
+    0x80, 0x00, 0x7c, 0xef, 0x7c, 0xc8, 0x64, 0xe5, 0x7c, 0xc8, 0x74, 0xd9, 0x01, 0x96, 0x83, 0x00,
+    0x30, 0x24, 0x3f, 0x50, 0x80, 0x09, 0x01, 0x96, 0x83, 0x10, 0x32, 0xe4, 0x3a, 0x68, 0x80, 0x01,
+    0xc0, 0xb2, 0x00, 0x07, 0x35, 0xbc, 0x80, 0x0a, 0xd0, 0x21, 0x84, 0x07, 0x88, 0x0a, 0xc0, 0x82,
+    0x00, 0x08, 0xcf, 0x00, 0x00, 0x40, 0xd0, 0x23, 0x84, 0x0b, 0xc0, 0x84, 0x00, 0x00, 0x35, 0xbc,
+    0x80, 0x0a, 0x38, 0xc8, 0x38, 0x0c, 0xbf, 0xff, 0x30, 0xf9, 0x3f, 0xff, 0xbf, 0xf7, 0x51, 0x90,
+    0xdc, 0x01, 0x9f, 0x70, 0x40, 0x90, 0x2c, 0x10, 0x76, 0x51, 0x6c, 0x7c, 0x25, 0x00, 0x81, 0x40,
+    0x74, 0xd4, 0x6d, 0x7d, 0xb5, 0x01, 0x27, 0x04, 0x81, 0x40, 0x40, 0x10, 0xe8, 0x44, 0x92, 0xc8,
+    0x40, 0x18, 0x9f, 0x71, 0x31, 0x84, 0x35, 0x7c, 0x80, 0x08, 0x31, 0xe4, 0x38, 0x02, 0x80, 0x08,
+    0x31, 0x04, 0x23, 0x12, 0x80, 0x09, 0x31, 0x24, 0x3f, 0x30, 0x80, 0x09, 0x32, 0xc4, 0x39, 0x9e,
+    0x80, 0x08, 0xe7, 0x48, 0x33, 0xc4, 0x39, 0x76, 0x80, 0x08, 0x09, 0x86, 0x3a, 0x58, 0x80, 0x09,
+    0x38, 0xc0, 0x3e, 0x5c, 0x80, 0x09, 0x10, 0x91, 0x80, 0x26, 0x31, 0x18, 0x80, 0xff, 0x3c, 0x42,
+    0x09, 0xe6, 0x3d, 0xcc, 0x80, 0x09, 0x00, 0x08, 0xcf, 0x80, 0x00, 0x40, 0xca, 0x40, 0x90, 0xc0,
+    0xea, 0x18, 0x50, 0x92, 0x40, 0x91, 0x0a, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x09, 0xe6, 0x3d, 0xcc,
+    0x80, 0x09, 0x10, 0x92, 0x80, 0x26, 0x30, 0xc8, 0x82, 0x08, 0xca, 0x40, 0x90, 0xc0, 0xa0, 0xc2,
+    0xb0, 0x49, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0, 0x10, 0x90, 0x80, 0x4e, 0x31, 0x18,
+    0x80, 0xff, 0x83, 0x88, 0x74, 0x60, 0x08, 0xe6, 0x3d, 0xcc, 0x80, 0x09, 0x90, 0xc0, 0xb0, 0x04,
+    0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0, 0x10, 0x90, 0x80, 0x4e, 0x30, 0xc8, 0x82, 0x08,
+    0x83, 0x6a, 0x74, 0x60, 0x09, 0xe6, 0x3d, 0xcc, 0x80, 0x09, 0x38, 0xc0, 0x3e, 0x5c, 0x80, 0x09,
+    0xb0, 0x0d, 0x0a, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x09, 0xe6, 0x3d, 0xd0, 0x80, 0x09, 0x10, 0x92,
+    0x80, 0x24, 0x31, 0x18, 0x80, 0xff, 0x7c, 0x42, 0xca, 0x40, 0x90, 0xc0, 0x00, 0x08, 0xd0, 0x00,
+    0x00, 0x40, 0xea, 0x18, 0x50, 0x92, 0x40, 0x91, 0x0a, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x09, 0xe6,
+    0x3d, 0xd0, 0x80, 0x09, 0x10, 0x92, 0x80, 0x24, 0x30, 0xc8, 0x82, 0x08, 0xca, 0x40, 0x90, 0xc0,
+    0xa0, 0xc2, 0xb0, 0x49, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0, 0x10, 0x90, 0x80, 0x4c,
+    0x31, 0x18, 0x80, 0xff, 0x83, 0x0c, 0x74, 0x60, 0x08, 0xe6, 0x3d, 0xd0, 0x80, 0x09, 0x90, 0xc0,
+    0xb0, 0x04, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0, 0x10, 0x90, 0x80, 0x4c, 0x30, 0xc8,
+    0x82, 0x08, 0x2a, 0xff, 0x9e, 0xef, 0x74, 0x60, 0x08, 0xe6, 0x3d, 0xd0, 0x80, 0x09, 0x90, 0xc0,
+    0xb0, 0x05, 0x09, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x00, 0x07, 0x3a, 0x98, 0x80, 0x0a, 0x18, 0x91,
+    0x81, 0x00, 0x0d, 0x08, 0xa0, 0x02, 0x80, 0x19, 0x24, 0x69, 0x01, 0x04, 0x38, 0x6e, 0x80, 0x0a,
+    0x84, 0x0f, 0x00, 0x08, 0xd0, 0x80, 0x00, 0x40, 0x32, 0x24, 0x3f, 0x60, 0x80, 0x09, 0x10, 0x01,
+    0x81, 0x42, 0x88, 0x05, 0x6c, 0x10, 0x00, 0x00, 0x24, 0x9a, 0x80, 0x0a, 0x11, 0x01, 0x80, 0xb6,
+    0x2a, 0xff, 0x9e, 0x89, 0x38, 0xe0, 0x30, 0xa4, 0x80, 0x09, 0x09, 0x86, 0x3a, 0x58, 0x80, 0x09,
+    0x38, 0xe0, 0x33, 0x28, 0x80, 0x09, 0x2a, 0xff, 0x9e, 0x73, 0x11, 0x01, 0x80, 0xb6, 0x09, 0x86,
+    0x3a, 0x58, 0x80, 0x09, 0x38, 0xe0, 0x35, 0xac, 0x80, 0x09, 0x2a, 0xff, 0x9e, 0x5f, 0x11, 0x01,
+    0x80, 0xb6, 0x09, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x38, 0xc0, 0x3e, 0x5c, 0x80, 0x09, 0x10, 0x91,
+    0x80, 0x28, 0x31, 0x18, 0x80, 0xff, 0x3c, 0x42, 0x09, 0xe6, 0x3d, 0xc8, 0x80, 0x09, 0xca, 0x40,
+    0x90, 0xc0, 0xea, 0x18, 0x50, 0x92, 0x40, 0x91, 0x0a, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x09, 0xe6,
+    0x3d, 0xc8, 0x80, 0x09, 0x10, 0x92, 0x80, 0x28, 0x00, 0x08, 0xd1, 0x00, 0x00, 0x40, 0x30, 0xc8,
+    0x82, 0x08, 0xca, 0x40, 0x90, 0xc0, 0xa0, 0xc2, 0xb0, 0x49, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09,
+    0x90, 0xc0, 0x10, 0x90, 0x80, 0x50, 0x31, 0x18, 0x80, 0xff, 0x2a, 0xff, 0x9e, 0x23, 0x74, 0x60,
+    0x08, 0xe6, 0x3d, 0xc8, 0x80, 0x09, 0x90, 0xc0, 0xb0, 0x04, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09,
+    0x90, 0xc0, 0x10, 0x90, 0x80, 0x50, 0x30, 0xc8, 0x82, 0x08, 0x2a, 0xff, 0x9e, 0x03, 0x74, 0x60,
+    0x09, 0xe6, 0x3d, 0xc8, 0x80, 0x09, 0x38, 0xc0, 0x3e, 0x5c, 0x80, 0x09, 0xb0, 0x0d, 0x0a, 0x86,
+    0x3a, 0x58, 0x80, 0x09, 0x09, 0xe6, 0x3d, 0xd4, 0x80, 0x09, 0x10, 0x92, 0x80, 0x2a, 0x31, 0x18,
+    0x80, 0xff, 0x7c, 0x42, 0xca, 0x40, 0x90, 0xc0, 0xea, 0x18, 0x50, 0x92, 0x40, 0x91, 0x0a, 0x86,
+    0x3a, 0x58, 0x80, 0x09, 0x09, 0xe6, 0x3d, 0xd4, 0x80, 0x09, 0x10, 0x92, 0x80, 0x2a, 0x00, 0x08,
+    0xd1, 0x80, 0x00, 0x40, 0x30, 0xc8, 0x82, 0x08, 0xca, 0x40, 0x90, 0xc0, 0xa0, 0xc2, 0xb0, 0x49,
+    0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0, 0x10, 0x90, 0x80, 0x52, 0x31, 0x18, 0x80, 0xff,
+    0x2a, 0xff, 0x9d, 0xa3, 0x74, 0x60, 0x08, 0xe6, 0x3d, 0xd4, 0x80, 0x09, 0x90, 0xc0, 0xb0, 0x04,
+    0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0, 0x10, 0x90, 0x80, 0x52, 0x30, 0xc8, 0x82, 0x08,
+    0x2a, 0xff, 0x9d, 0x83, 0x74, 0x60, 0x09, 0xe6, 0x3d, 0xd4, 0x80, 0x09, 0x38, 0xe0, 0x3b, 0xb8,
+    0x80, 0x09, 0x2a, 0xff, 0x9d, 0x77, 0xb0, 0x0d, 0x2a, 0xff, 0x9d, 0x71, 0x38, 0xe0, 0x38, 0x30,
+    0x80, 0x09, 0x2a, 0xff, 0x9d, 0x67, 0x38, 0xe0, 0x39, 0xf4, 0x80, 0x09, 0x09, 0x86, 0x3a, 0x58,
+    0x80, 0x09, 0x38, 0xe0, 0x3b, 0xb8, 0x80, 0x09, 0x29, 0x09, 0x83, 0x44, 0x29, 0x0a, 0x82, 0x5c,
+    0x2a, 0xff, 0x9d, 0x4f, 0x00, 0x08, 0xd2, 0x00, 0x00, 0x40, 0xfa, 0x41, 0x09, 0x86, 0x3a, 0x58,
+    0x80, 0x09, 0x38, 0xe0, 0x38, 0x30, 0x80, 0x09, 0x29, 0x09, 0x83, 0x44, 0x29, 0x0a, 0x82, 0x5c,
+    0x2a, 0xff, 0x9d, 0x35, 0xfa, 0x41, 0x09, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x38, 0xe0, 0x39, 0xf4,
+    0x80, 0x09, 0x29, 0x09, 0x83, 0x44, 0x29, 0x0a, 0x82, 0x5c, 0x2a, 0xff, 0x9d, 0x1b, 0xfa, 0x41,
+    0x2c, 0x10, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0xf0, 0x42, 0x28, 0x09, 0x84, 0x20, 0x29, 0x08,
+    0x80, 0x50, 0xf8, 0x41, 0x32, 0x04, 0x26, 0xf8, 0x80, 0x09, 0x38, 0xe0, 0x2b, 0xb8, 0x80, 0x09,
+    0xe7, 0x68, 0x9f, 0x71, 0x10, 0x10, 0x12, 0x90, 0x80, 0x02, 0x65, 0x69, 0x80, 0x39, 0x31, 0x70,
+    0xf1, 0x85, 0x94, 0xc7, 0x64, 0xea, 0x6c, 0x10, 0x84, 0x2b, 0x9b, 0x41, 0x2b, 0x03, 0x80, 0x08,
+    0x28, 0x0a, 0x80, 0x04, 0x38, 0x41, 0x11, 0x11, 0xcb, 0x40, 0x00, 0x08, 0xd2, 0x80, 0x00, 0x40,
+    0x90, 0xc0, 0xeb, 0xfc, 0xeb, 0x1a, 0x11, 0x13, 0x41, 0x13, 0x41, 0x19, 0x94, 0xd0, 0x11, 0x90,
+    0x80, 0x02, 0x70, 0xf0, 0x92, 0xc3, 0x6c, 0x10, 0x40, 0x10, 0x9f, 0x71, 0x2b, 0xff, 0x9c, 0xb5,
+    0x2e, 0x90, 0x38, 0xe0, 0x3d, 0xbc, 0x80, 0x09, 0x0e, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x27, 0x00,
+    0x80, 0xa3, 0x2b, 0x02, 0x80, 0x25, 0x2a, 0x02, 0x80, 0x4a, 0x26, 0x00, 0x99, 0x00, 0xc3, 0x83,
+    0x39, 0x00, 0x36, 0x50, 0x80, 0x0a, 0x3a, 0x00, 0x36, 0x4e, 0x80, 0x0a, 0x3b, 0x00, 0x36, 0x4c,
+    0x80, 0x0a, 0x3c, 0x00, 0x36, 0x54, 0x80, 0x0a, 0x3d, 0x00, 0x36, 0x58, 0x80, 0x0a, 0x2c, 0x10,
+    0x1f, 0x98, 0x11, 0x06, 0x81, 0x42, 0x64, 0xea, 0x84, 0x13, 0x9b, 0x41, 0x2b, 0x03, 0x80, 0x06,
+    0x90, 0xc0, 0x92, 0xd0, 0x51, 0x9f, 0x64, 0xe6, 0x6c, 0x51, 0x14, 0x95, 0x40, 0xbd, 0x2e, 0x20,
+    0x00, 0x08, 0xd3, 0x00, 0x00, 0x40, 0x10, 0x94, 0x31, 0x60, 0x26, 0x66, 0x80, 0x66, 0x32, 0x24,
+    0x3f, 0x00, 0x80, 0x09, 0x66, 0x66, 0x36, 0x50, 0x74, 0x54, 0x32, 0x24, 0x3f, 0x00, 0x80, 0x09,
+    0x31, 0x80, 0x39, 0x99, 0x80, 0x19, 0x24, 0x61, 0x66, 0x61, 0x6c, 0x40, 0x40, 0xbc, 0x51, 0x33,
+    0x11, 0x12, 0xd0, 0xa1, 0x84, 0x3f, 0x64, 0xe9, 0x84, 0x3b, 0x36, 0x10, 0x80, 0x63, 0x80, 0x11,
+    0x20, 0x40, 0x80, 0x00, 0x40, 0x11, 0x20, 0x00, 0x86, 0x40, 0x88, 0x28, 0x40, 0x12, 0x36, 0x10,
+    0x81, 0x2b, 0x80, 0x0f, 0x20, 0x20, 0x80, 0x00, 0x40, 0x11, 0x8f, 0xf0, 0x20, 0x00, 0x8c, 0x80,
+    0x36, 0x10, 0x81, 0xf3, 0x80, 0x0b, 0x20, 0x00, 0x86, 0x66, 0x88, 0x06, 0x40, 0x11, 0x47, 0x11,
+    0x46, 0x12, 0xbf, 0xb2, 0x11, 0x12, 0xcf, 0x48, 0x7c, 0x41, 0x30, 0x71, 0x6c, 0x11, 0x84, 0x06,
+    0x40, 0x12, 0x45, 0x12, 0x79, 0xe1, 0x00, 0x08, 0xd3, 0x80, 0x00, 0x40, 0x65, 0xea, 0x29, 0x09,
+    0x80, 0x94, 0x81, 0x58, 0x2a, 0x0a, 0x80, 0x94, 0x31, 0x24, 0x3f, 0x50, 0x80, 0x09, 0xe7, 0x50,
+    0xf3, 0xca, 0xf0, 0xc9, 0xf1, 0xc8, 0xf2, 0xc7, 0xf3, 0x44, 0xf0, 0x43, 0xf1, 0x42, 0x32, 0x84,
+    0x36, 0x2c, 0x80, 0x08, 0xf2, 0x41, 0xe7, 0x70, 0x9f, 0x71, 0x31, 0xe4, 0x20, 0x3c, 0x80, 0x08,
+    0x31, 0x64, 0x39, 0x6a, 0x80, 0x08, 0x31, 0xe4, 0x38, 0x96, 0x80, 0x08, 0x2b, 0xff, 0x9b, 0x91,
+    0x27, 0x08, 0x80, 0x20, 0xe7, 0xe8, 0x32, 0xc4, 0x39, 0xc2, 0x80, 0x08, 0x06, 0x04, 0x38, 0x6e,
+    0x80, 0x0a, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0, 0x10, 0x90, 0x80, 0x4e, 0x31, 0x18,
+    0x80, 0xff, 0x2a, 0xff, 0x9b, 0x59, 0x74, 0x60, 0x08, 0xe6, 0x3d, 0xcc, 0x80, 0x09, 0x90, 0xc0,
+    0xb0, 0x04, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0, 0x10, 0x90, 0x00, 0x08, 0xd4, 0x00,
+    0x00, 0x40, 0x80, 0x4e, 0x30, 0xc8, 0x82, 0x08, 0x2a, 0xff, 0x9b, 0x39, 0x74, 0x60, 0x08, 0xe6,
+    0x3d, 0xcc, 0x80, 0x09, 0x90, 0xc0, 0xb0, 0x05, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0,
+    0x10, 0x90, 0x80, 0x4c, 0x31, 0x18, 0x80, 0xff, 0x2a, 0xff, 0x9b, 0x19, 0x74, 0x60, 0x08, 0xe6,
+    0x3d, 0xd0, 0x80, 0x09, 0x90, 0xc0, 0xb0, 0x04, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0,
+    0x10, 0x90, 0x80, 0x4c, 0x30, 0xc8, 0x82, 0x08, 0x2a, 0xff, 0x9a, 0xf9, 0x74, 0x60, 0x08, 0xe6,
+    0x3d, 0xd0, 0x80, 0x09, 0x90, 0xc0, 0xb0, 0x05, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0,
+    0x10, 0x90, 0x80, 0x50, 0x31, 0x18, 0x80, 0xff, 0x2a, 0xff, 0x9a, 0xd9, 0x74, 0x60, 0x08, 0xe6,
+    0x3d, 0xc8, 0x80, 0x09, 0x90, 0xc0, 0xb0, 0x04, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0,
+    0x10, 0x90, 0x00, 0x08, 0xd4, 0x80, 0x00, 0x40, 0x80, 0x50, 0x30, 0xc8, 0x82, 0x08, 0x2a, 0xff,
+    0x9a, 0xb9, 0x74, 0x60, 0x08, 0xe6, 0x3d, 0xc8, 0x80, 0x09, 0x90, 0xc0, 0xb0, 0x05, 0x08, 0x86,
+    0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0, 0x10, 0x90, 0x80, 0x52, 0x31, 0x18, 0x80, 0xff, 0x2a, 0xff,
+    0x9a, 0x99, 0x74, 0x60, 0x08, 0xe6, 0x3d, 0xd4, 0x80, 0x09, 0x90, 0xc0, 0xb0, 0x04, 0x08, 0x86,
+    0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0, 0x10, 0x90, 0x80, 0x52, 0x30, 0xc8, 0x82, 0x08, 0x2a, 0xff,
+    0x9a, 0x79, 0x74, 0x60, 0x08, 0xe6, 0x3d, 0xd4, 0x80, 0x09, 0x90, 0xc0, 0xb0, 0x05, 0x01, 0x04,
+    0x24, 0x9a, 0x80, 0x0a, 0x24, 0xea, 0x38, 0xe1, 0x00, 0xc6, 0x3e, 0x5c, 0x80, 0x09, 0x84, 0x21,
+    0x08, 0xe6, 0x3d, 0xd0, 0x80, 0x09, 0x01, 0x00, 0x24, 0x9a, 0x80, 0x0a, 0x40, 0x90, 0x08, 0xe6,
+    0x3d, 0xd0, 0x80, 0x09, 0x00, 0xc6, 0x3e, 0x5c, 0x00, 0x08, 0xd5, 0x00, 0x00, 0x40, 0x80, 0x09,
+    0x88, 0x46, 0xb0, 0x41, 0x09, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x38, 0xc0, 0x3e, 0x5c, 0x80, 0x09,
+    0x10, 0x91, 0x80, 0x24, 0x31, 0x18, 0x80, 0xff, 0x3c, 0x42, 0x09, 0xe6, 0x3d, 0xd0, 0x80, 0x09,
+    0xca, 0x40, 0x90, 0xc0, 0xea, 0x18, 0x50, 0x92, 0x40, 0x91, 0x0a, 0x86, 0x3a, 0x58, 0x80, 0x09,
+    0x09, 0xe6, 0x3d, 0xd0, 0x80, 0x09, 0x10, 0x92, 0x80, 0x24, 0x30, 0xc8, 0x82, 0x08, 0xca, 0x40,
+    0x90, 0xc0, 0xa0, 0xc2, 0xb0, 0x49, 0x00, 0xc4, 0x33, 0x16, 0x80, 0x09, 0xd0, 0x21, 0x80, 0x45,
+    0x08, 0xe6, 0x3d, 0xcc, 0x80, 0x09, 0x02, 0x04, 0x38, 0x6e, 0x80, 0x0a, 0x19, 0x90, 0xf2, 0x06,
+    0xb3, 0x84, 0xb0, 0xc1, 0xb1, 0x85, 0xf1, 0x05, 0xf0, 0x42, 0xf3, 0x01, 0x18, 0x07, 0xa0, 0x01,
+    0xc6, 0xa0, 0x2a, 0xff, 0x9e, 0x3b, 0x38, 0xc0, 0x34, 0xe8, 0x80, 0x09, 0x18, 0x01, 0x00, 0x08,
+    0xd5, 0x80, 0x00, 0x40, 0xa0, 0x20, 0x39, 0xc0, 0x34, 0xe8, 0x80, 0x09, 0x2a, 0xff, 0x9e, 0x2d,
+    0x38, 0xc0, 0x33, 0x04, 0x80, 0x09, 0x88, 0x2d, 0x08, 0xe6, 0x3d, 0xcc, 0x80, 0x09, 0x02, 0x04,
+    0x38, 0x6e, 0x80, 0x0a, 0x19, 0x90, 0xf2, 0x06, 0xb1, 0x85, 0xb3, 0x84, 0xb0, 0xc1, 0xf1, 0x05,
+    0xf0, 0x42, 0xf3, 0x01, 0x18, 0x07, 0xa0, 0x01, 0x2a, 0xff, 0x9d, 0xfb, 0x38, 0x00, 0x20, 0xd8,
+    0x80, 0x0a, 0xc8, 0x46, 0x00, 0xc4, 0x32, 0xa6, 0x80, 0x09, 0xe8, 0xfc, 0xd0, 0x21, 0x08, 0x00,
+    0x3e, 0xf2, 0x80, 0x0a, 0x80, 0x46, 0x06, 0x00, 0x3e, 0xec, 0x80, 0x0a, 0x08, 0xe6, 0x3d, 0xd0,
+    0x80, 0x09, 0x02, 0x04, 0x38, 0x6e, 0x80, 0x0a, 0x19, 0x90, 0xf2, 0x06, 0xb1, 0x85, 0xb3, 0x84,
+    0xb0, 0xc1, 0xf1, 0x05, 0xf0, 0x42, 0xf3, 0x01, 0x18, 0x07, 0xa0, 0x01, 0x2a, 0xff, 0x9d, 0xb7,
+    0x38, 0xc0, 0x34, 0xe8, 0x00, 0x08, 0xd6, 0x00, 0x00, 0x40, 0x80, 0x09, 0xf6, 0x01, 0x39, 0xc0,
+    0x34, 0xe8, 0x80, 0x09, 0x2a, 0xff, 0x9d, 0xab, 0x38, 0xc0, 0x32, 0x94, 0x80, 0x09, 0x88, 0x2d,
+    0x08, 0xe6, 0x3d, 0xd0, 0x80, 0x09, 0x02, 0x04, 0x38, 0x6e, 0x80, 0x0a, 0x19, 0x90, 0xf2, 0x06,
+    0xb1, 0x85, 0xb3, 0x84, 0xb0, 0xc1, 0xf1, 0x05, 0xf0, 0x42, 0xf3, 0x01, 0x18, 0x07, 0xa0, 0x01,
+    0x2a, 0xff, 0x9d, 0x79, 0x38, 0xe0, 0x3d, 0xd8, 0x80, 0x09, 0x00, 0xc4, 0x32, 0x52, 0x80, 0x09,
+    0xd0, 0x21, 0x80, 0x41, 0x08, 0xe6, 0x3d, 0xc8, 0x80, 0x09, 0x02, 0x04, 0x38, 0x6e, 0x80, 0x0a,
+    0x19, 0x90, 0xf2, 0x06, 0xb1, 0x85, 0xb3, 0x84, 0xb0, 0xc1, 0xf1, 0x05, 0xf0, 0x42, 0xf3, 0x01,
+    0x18, 0x07, 0xa0, 0x01, 0x2a, 0xff, 0x9d, 0x45, 0x38, 0xc0, 0x34, 0xe8, 0x80, 0x09, 0xf6, 0x01,
+    0x39, 0xc0, 0x34, 0xe8, 0x80, 0x09, 0x2a, 0xff, 0x9d, 0x39, 0x00, 0x08, 0xd6, 0x80, 0x00, 0x40,
+    0x38, 0xc0, 0x32, 0x40, 0x80, 0x09, 0x88, 0x2d, 0x08, 0xe6, 0x3d, 0xc8, 0x80, 0x09, 0x02, 0x04,
+    0x38, 0x6e, 0x80, 0x0a, 0x19, 0x90, 0xf2, 0x06, 0xb1, 0x85, 0xb3, 0x84, 0xb0, 0xc1, 0xf1, 0x05,
+    0xf0, 0x42, 0xf3, 0x01, 0x18, 0x07, 0xa0, 0x01, 0x2a, 0xff, 0x9d, 0x07, 0x38, 0x00, 0x20, 0x18,
+    0x80, 0x0a, 0x00, 0xc4, 0x34, 0x12, 0x80, 0x09, 0xd0, 0x21, 0x80, 0x41, 0x08, 0xe6, 0x3d, 0xd4,
+    0x80, 0x09, 0x02, 0x04, 0x38, 0x6e, 0x80, 0x0a, 0x19, 0x90, 0xf2, 0x06, 0xb1, 0x85, 0xb3, 0x84,
+    0xb0, 0xc1, 0xf1, 0x05, 0xf0, 0x42, 0xf3, 0x01, 0x18, 0x07, 0xa0, 0x01, 0x2a, 0xff, 0x9c, 0xd3,
+    0x38, 0xc0, 0x34, 0xe8, 0x80, 0x09, 0xf6, 0x01, 0x39, 0xc0, 0x34, 0xe8, 0x80, 0x09, 0x2a, 0xff,
+    0x9c, 0xc7, 0x38, 0xc0, 0x34, 0x00, 0x80, 0x09, 0x88, 0x2d, 0x08, 0xe6, 0x3d, 0xd4, 0x80, 0x09,
+    0x00, 0x08, 0xd7, 0x00, 0x00, 0x40, 0x02, 0x04, 0x38, 0x6e, 0x80, 0x0a, 0x19, 0x90, 0xf2, 0x06,
+    0xb1, 0x85, 0xb3, 0x84, 0xb0, 0xc1, 0xf1, 0x05, 0xf0, 0x42, 0xf3, 0x01, 0x18, 0x07, 0xa0, 0x01,
+    0x2a, 0xff, 0x9c, 0x95, 0x38, 0xe0, 0x3e, 0x98, 0x80, 0x09, 0x33, 0x04, 0x39, 0xf2, 0x80, 0x09,
+    0x33, 0x04, 0x3a, 0x22, 0x80, 0x09, 0x33, 0x04, 0x3a, 0x52, 0x80, 0x09, 0x08, 0x86, 0x3a, 0x58,
+    0x80, 0x09, 0x39, 0xe0, 0x3d, 0xd8, 0x80, 0x09, 0x18, 0x90, 0x81, 0x00, 0x0d, 0x08, 0xa0, 0x02,
+    0x80, 0x33, 0xf6, 0x41, 0x2a, 0xff, 0x9c, 0x6d, 0x38, 0xe0, 0x3b, 0xb8, 0x80, 0x09, 0xf6, 0x41,
+    0x39, 0x00, 0x20, 0x18, 0x80, 0x0a, 0x2a, 0xff, 0x9c, 0x5b, 0x38, 0xe0, 0x38, 0x30, 0x80, 0x09,
+    0xf6, 0x41, 0x39, 0xe0, 0x3e, 0x98, 0x80, 0x09, 0x2a, 0xff, 0x9c, 0x49, 0x38, 0xe0, 0x39, 0xf4,
+    0x80, 0x09, 0x27, 0x6a, 0x39, 0x00, 0x00, 0x08, 0xd7, 0x80, 0x00, 0x40, 0x22, 0x58, 0x80, 0x0a,
+    0x84, 0x13, 0x9f, 0x46, 0x38, 0xe0, 0x3f, 0x58, 0x80, 0x09, 0x90, 0xc0, 0x92, 0xd0, 0x50, 0x18,
+    0x40, 0x19, 0xf6, 0x01, 0x39, 0xe0, 0x3d, 0xd8, 0x80, 0x09, 0x2a, 0xff, 0x9a, 0xbd, 0x38, 0xe0,
+    0x30, 0xa4, 0x80, 0x09, 0xf6, 0x01, 0x39, 0x00, 0x20, 0x18, 0x80, 0x0a, 0x2a, 0xff, 0x9a, 0xab,
+    0x38, 0xe0, 0x33, 0x28, 0x80, 0x09, 0xf6, 0x01, 0x39, 0xe0, 0x3e, 0x98, 0x80, 0x09, 0x2a, 0xff,
+    0x9a, 0x99, 0x38, 0xe0, 0x35, 0xac, 0x80, 0x09, 0x2b, 0xff, 0x9a, 0xd1, 0x27, 0x6a, 0x37, 0xd6,
+    0x3d, 0x00, 0x23, 0x18, 0x80, 0x0a, 0x84, 0x61, 0x3a, 0x00, 0x22, 0x58, 0x80, 0x0a, 0x3b, 0xe0,
+    0x3e, 0x98, 0x80, 0x09, 0x3e, 0x00, 0x20, 0x18, 0x80, 0x0a, 0x3f, 0xe0, 0x3d, 0xd8, 0x80, 0x09,
+    0x3c, 0x00, 0x20, 0xd8, 0x80, 0x0a, 0x00, 0x06, 0x38, 0x64, 0x80, 0x0a, 0x00, 0x08, 0xd8, 0x00,
+    0x00, 0x40, 0x38, 0x41, 0xfd, 0x44, 0xfa, 0x43, 0xfb, 0x42, 0xfe, 0x41, 0xe9, 0xef, 0xe8, 0xec,
+    0xfd, 0x45, 0xfa, 0x46, 0xfb, 0x47, 0xfc, 0x48, 0x2a, 0xff, 0x9b, 0x7d, 0x00, 0x02, 0x38, 0x64,
+    0x80, 0x0a, 0x3b, 0xe1, 0xfd, 0xc5, 0x27, 0xea, 0xfa, 0xc6, 0xfb, 0xc7, 0xfc, 0xc8, 0xef, 0x42,
+    0xec, 0x42, 0xee, 0x42, 0xeb, 0x42, 0xea, 0x42, 0x81, 0xc4, 0xed, 0x42, 0x08, 0x86, 0x3a, 0x58,
+    0x80, 0x09, 0x90, 0xc0, 0x10, 0x90, 0x81, 0x00, 0x31, 0x18, 0x80, 0x02, 0x64, 0x69, 0x80, 0x2b,
+    0x27, 0x6a, 0x3b, 0x00, 0x22, 0x58, 0x80, 0x0a, 0x84, 0x21, 0x9f, 0x46, 0x38, 0x00, 0x20, 0xd8,
+    0x80, 0x0a, 0x3a, 0xe0, 0x3d, 0xd8, 0x80, 0x09, 0x39, 0x00, 0x23, 0x18, 0x80, 0x0a, 0x94, 0xd0,
+    0x52, 0x1a, 0x51, 0x18, 0x02, 0x19, 0x41, 0x1b, 0x24, 0x69, 0x30, 0x01, 0x22, 0x58, 0x80, 0x0a,
+    0x84, 0x4d, 0x00, 0x08, 0xd8, 0x80, 0x00, 0x40, 0xf6, 0x42, 0xf0, 0x41, 0xc9, 0x40, 0x32, 0x04,
+    0x2a, 0xc6, 0x80, 0x09, 0x38, 0xe0, 0x3d, 0xac, 0x80, 0x09, 0x30, 0x01, 0x23, 0x18, 0x80, 0x0a,
+    0xf6, 0x42, 0xf0, 0x41, 0xc9, 0x40, 0x32, 0x04, 0x2a, 0xf0, 0x80, 0x09, 0x38, 0xe0, 0x2b, 0xb8,
+    0x80, 0x09, 0x33, 0x04, 0x3a, 0x82, 0x80, 0x09, 0x27, 0x6a, 0x39, 0xe0, 0x3f, 0x58, 0x80, 0x09,
+    0x84, 0x13, 0x9f, 0x46, 0x38, 0x00, 0x22, 0x58, 0x80, 0x0a, 0x90, 0xc0, 0x92, 0xd0, 0x50, 0x18,
+    0x40, 0x19, 0x00, 0xc4, 0x33, 0xda, 0x80, 0x09, 0xd0, 0x21, 0x80, 0x19, 0xf6, 0x01, 0x39, 0x00,
+    0x23, 0x18, 0x80, 0x0a, 0x32, 0x64, 0x3a, 0x12, 0x80, 0x08, 0x38, 0xc0, 0x33, 0xc8, 0x80, 0x09,
+    0x88, 0x23, 0x00, 0x04, 0x38, 0x6e, 0x80, 0x0a, 0x24, 0x6a, 0x3a, 0x00, 0x23, 0xd8, 0x80, 0x0a,
+    0x84, 0x13, 0x9f, 0x40, 0x38, 0x00, 0x23, 0x18, 0x00, 0x08, 0xd9, 0x00, 0x00, 0x40, 0x80, 0x0a,
+    0x90, 0xc0, 0x92, 0xd0, 0x59, 0x18, 0x49, 0x1a, 0x00, 0xc4, 0x33, 0x86, 0x80, 0x09, 0xd0, 0x21,
+    0x80, 0x19, 0xf6, 0x01, 0x39, 0x00, 0x22, 0x58, 0x80, 0x0a, 0x32, 0x64, 0x3a, 0x12, 0x80, 0x08,
+    0x38, 0xc0, 0x33, 0x74, 0x80, 0x09, 0x88, 0x23, 0x00, 0x04, 0x38, 0x6e, 0x80, 0x0a, 0x24, 0x6a,
+    0x39, 0x00, 0x21, 0x98, 0x80, 0x0a, 0x84, 0x13, 0x9f, 0x40, 0x38, 0x00, 0x22, 0x58, 0x80, 0x0a,
+    0x90, 0xc0, 0x92, 0xd0, 0x50, 0x18, 0x40, 0x19, 0x33, 0xc4, 0x3a, 0x3a, 0x80, 0x08, 0x33, 0x04,
+    0x36, 0xbc, 0x80, 0x09, 0x33, 0x04, 0x38, 0x9e, 0x80, 0x09, 0x27, 0xe8, 0x9f, 0xe0, 0x30, 0x24,
+    0x3f, 0x50, 0x80, 0x09, 0xe7, 0xe8, 0x33, 0x84, 0x3f, 0x90, 0x80, 0x08, 0x9f, 0x70, 0x08, 0x02,
+    0x38, 0x68, 0x80, 0x0a, 0x09, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x32, 0xc4, 0x28, 0x6c, 0x00, 0x08,
+    0xd9, 0x80, 0x00, 0x40, 0x80, 0x08, 0x38, 0x00, 0x24, 0x9c, 0x80, 0x0a, 0x83, 0xe1, 0x30, 0x84,
+    0x35, 0xa2, 0x80, 0x08, 0x38, 0x00, 0x35, 0xc0, 0x80, 0x0a, 0x38, 0x00, 0x38, 0x68, 0x80, 0x0a,
+    0x9f, 0x71, 0x00, 0x04, 0x38, 0x70, 0x80, 0x0a, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0xd0, 0x28,
+    0x84, 0x0c, 0x11, 0x00, 0x81, 0xc0, 0xc0, 0xfe, 0x88, 0x08, 0xdc, 0x01, 0xc0, 0x81, 0xdc, 0x19,
+    0x9f, 0x70, 0x00, 0x00, 0x81, 0xc0, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0xc0, 0xfe, 0x12, 0x90,
+    0x81, 0x00, 0xdc, 0x02, 0x00, 0x00, 0x81, 0x00, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0xc1, 0xf7,
+    0x10, 0x90, 0x81, 0x02, 0xdc, 0x80, 0x01, 0x00, 0x81, 0x02, 0x0a, 0x86, 0x3a, 0x58, 0x80, 0x09,
+    0x90, 0xc0, 0x18, 0x92, 0x81, 0x0e, 0x08, 0x00, 0x35, 0xce, 0x80, 0x0a, 0x10, 0x92, 0x81, 0x0c,
+    0x00, 0x00, 0x35, 0xcc, 0x00, 0x08, 0xda, 0x00, 0x00, 0x40, 0x80, 0x0a, 0x10, 0x02, 0x81, 0x0a,
+    0x00, 0x00, 0x38, 0x56, 0x80, 0x0a, 0x10, 0x02, 0x81, 0x2e, 0x00, 0x00, 0x36, 0xc2, 0x80, 0x0a,
+    0x00, 0x00, 0x37, 0x56, 0x80, 0x0a, 0x00, 0x00, 0x36, 0x2e, 0x80, 0x0a, 0x10, 0x92, 0x81, 0x30,
+    0x00, 0xe0, 0x20, 0xf4, 0x80, 0x09, 0x00, 0xe0, 0x20, 0xc0, 0x80, 0x09, 0x9f, 0x70, 0x00, 0xe0,
+    0x20, 0x8c, 0x80, 0x09, 0x38, 0x00, 0x20, 0x68, 0x80, 0x08, 0x01, 0x06, 0x35, 0xc4, 0x80, 0x0a,
+    0x39, 0x00, 0x20, 0x6a, 0x80, 0x08, 0x33, 0xf8, 0x9f, 0xff, 0x00, 0x10, 0x38, 0x00, 0x20, 0x6c,
+    0x80, 0x08, 0x32, 0xc9, 0x84, 0x10, 0x01, 0x11, 0x39, 0x00, 0x20, 0x6e, 0x80, 0x08, 0x00, 0xe7,
+    0x20, 0x50, 0x80, 0x09, 0x00, 0x10, 0x38, 0x00, 0x20, 0x72, 0x80, 0x08, 0x0a, 0x04, 0x36, 0x18,
+    0x80, 0x0a, 0x0a, 0x11, 0x39, 0x00, 0x20, 0x74, 0x80, 0x08, 0x00, 0x08, 0xda, 0x80, 0x00, 0x40,
+    0x0a, 0x04, 0x36, 0x36, 0x80, 0x0a, 0x0a, 0x10, 0x38, 0x00, 0x20, 0x7c, 0x80, 0x08, 0x0a, 0x04,
+    0x36, 0x38, 0x80, 0x0a, 0x0a, 0x11, 0x39, 0x00, 0x20, 0x78, 0x80, 0x08, 0x0a, 0x04, 0x38, 0x5e,
+    0x80, 0x0a, 0x0a, 0x10, 0x38, 0x00, 0x20, 0x76, 0x80, 0x08, 0x0a, 0x04, 0x38, 0x5c, 0x80, 0x0a,
+    0x0a, 0x11, 0x39, 0x00, 0x20, 0x88, 0x80, 0x08, 0x0a, 0x04, 0x38, 0x60, 0x80, 0x0a, 0x0a, 0x10,
+    0x38, 0x00, 0x20, 0x8a, 0x80, 0x08, 0x0a, 0x04, 0x36, 0x36, 0x80, 0x0a, 0x0a, 0x11, 0x39, 0x00,
+    0x20, 0x8c, 0x80, 0x08, 0x0a, 0x04, 0x36, 0xca, 0x80, 0x0a, 0x0a, 0x10, 0x38, 0x00, 0x20, 0x80,
+    0x80, 0x08, 0x0a, 0x04, 0x37, 0x5e, 0x80, 0x0a, 0x0a, 0x11, 0x39, 0x00, 0x20, 0x82, 0x80, 0x08,
+    0x0a, 0x04, 0x36, 0x38, 0x80, 0x0a, 0x0a, 0x10, 0x38, 0x00, 0x20, 0x84, 0x80, 0x08, 0x0a, 0x04,
+    0x00, 0x08, 0xdb, 0x00, 0x00, 0x40, 0x36, 0xcc, 0x80, 0x0a, 0x0a, 0x11, 0x39, 0x00, 0x20, 0x90,
+    0x80, 0x08, 0x0a, 0x04, 0x37, 0x60, 0x80, 0x0a, 0x0a, 0x10, 0x38, 0x00, 0x20, 0x92, 0x80, 0x08,
+    0x0a, 0x04, 0x36, 0x18, 0x80, 0x0a, 0x0a, 0x11, 0x39, 0x00, 0x20, 0x94, 0x80, 0x08, 0x0a, 0x04,
+    0x36, 0xac, 0x80, 0x0a, 0x4a, 0x10, 0x08, 0x04, 0x37, 0x40, 0x80, 0x0a, 0x9f, 0x70, 0x48, 0x11,
+    0x31, 0xa4, 0x35, 0xc0, 0x80, 0x08, 0x33, 0x24, 0x3f, 0x30, 0x80, 0x09, 0x24, 0xe8, 0x36, 0xd0,
+    0x37, 0x51, 0xce, 0x40, 0x94, 0xc3, 0x66, 0xe4, 0x67, 0x64, 0x94, 0xc7, 0x67, 0x69, 0xce, 0x45,
+    0x24, 0x18, 0x81, 0x82, 0x94, 0xc6, 0xce, 0x4d, 0x6c, 0x10, 0x66, 0xea, 0x26, 0x18, 0x81, 0x76,
+    0x92, 0xc3, 0x6c, 0x10, 0x83, 0xcc, 0x74, 0x56, 0x35, 0xd0, 0xce, 0x4d, 0x3d, 0xe3, 0x74, 0x55,
+    0x79, 0xee, 0x6f, 0x90, 0x83, 0xbc, 0x00, 0x08, 0xdb, 0x80, 0x00, 0x40, 0x6f, 0x7c, 0x3c, 0x63,
+    0x2e, 0x10, 0xd7, 0x1f, 0x38, 0x6e, 0x34, 0xf6, 0xce, 0x4d, 0x2c, 0x7c, 0xc2, 0x81, 0xd6, 0x9c,
+    0x2b, 0x25, 0xd7, 0xc4, 0x27, 0x66, 0xce, 0x45, 0x2e, 0x7c, 0xcf, 0x44, 0x83, 0x9a, 0x74, 0x56,
+    0x3c, 0x63, 0x2e, 0x10, 0x2e, 0x90, 0x38, 0x40, 0x3f, 0x14, 0x80, 0x09, 0x78, 0x63, 0x34, 0xd0,
+    0x78, 0x6b, 0x2c, 0x7c, 0x6d, 0x7c, 0x2c, 0x95, 0xd7, 0xc4, 0xd7, 0x1c, 0x35, 0x56, 0x0c, 0x07,
+    0xa0, 0x01, 0x94, 0xc1, 0x7b, 0xe1, 0x6c, 0x10, 0xd5, 0x19, 0x94, 0xc7, 0x79, 0x61, 0xc0, 0x81,
+    0x3d, 0x41, 0x34, 0x47, 0xcc, 0x50, 0x34, 0x76, 0xcd, 0x50, 0xc9, 0x42, 0xd8, 0x10, 0xe9, 0x18,
+    0x52, 0x11, 0x69, 0xbc, 0x7d, 0xef, 0x34, 0x03, 0x80, 0x03, 0x25, 0xe6, 0x30, 0x81, 0x20, 0x00,
+    0x80, 0x00, 0x34, 0x78, 0xd5, 0x99, 0x71, 0xf0, 0x80, 0x0b, 0x6d, 0xb3, 0x00, 0x08, 0xdc, 0x00,
+    0x00, 0x40, 0x6a, 0x3d, 0x88, 0x0c, 0x66, 0x66, 0x6d, 0xb3, 0x6a, 0x3d, 0x66, 0x66, 0x66, 0x64,
+    0x35, 0xf6, 0xd6, 0x40, 0x7e, 0x70, 0x6e, 0x48, 0x77, 0xf4, 0x6b, 0x37, 0x7f, 0x6f, 0x34, 0xc5,
+    0x80, 0x03, 0x30, 0xc5, 0x80, 0x03, 0x36, 0xc2, 0x80, 0x03, 0xd9, 0x95, 0xd5, 0xc2, 0x65, 0xe1,
+    0x65, 0xe6, 0xd5, 0x99, 0x71, 0xf0, 0x80, 0x0d, 0x6d, 0xb3, 0x75, 0xf3, 0x69, 0xac, 0x88, 0x0e,
+    0x65, 0xe6, 0x6d, 0xb3, 0x75, 0xf3, 0x69, 0xac, 0x65, 0xe6, 0x65, 0xe4, 0xd5, 0xc0, 0x3d, 0xf0,
+    0xcf, 0x4a, 0xd6, 0x43, 0xc3, 0x8f, 0x2f, 0x9d, 0xf0, 0x8d, 0x2f, 0x83, 0x0c, 0x01, 0xa0, 0x01,
+    0xcc, 0x58, 0x94, 0xc3, 0x78, 0x41, 0x78, 0xe1, 0x92, 0xc3, 0xcc, 0x50, 0xcc, 0x58, 0x0c, 0x00,
+    0xa0, 0x01, 0x80, 0x13, 0x74, 0x74, 0x3e, 0x50, 0x9a, 0x82, 0x64, 0x66, 0x31, 0x44, 0x80, 0x00,
+    0x88, 0x0c, 0x00, 0x08, 0xdc, 0x80, 0x00, 0x40, 0x7e, 0x6f, 0x36, 0xc0, 0xcd, 0x58, 0xd4, 0x45,
+    0xcd, 0x50, 0x27, 0xe8, 0x34, 0xc1, 0xce, 0x4d, 0x80, 0x2d, 0xcd, 0x58, 0x2f, 0x43, 0x74, 0x75,
+    0x27, 0x68, 0x68, 0x20, 0x80, 0x14, 0x64, 0x66, 0xd7, 0x41, 0x67, 0x68, 0x80, 0x09, 0x67, 0x64,
+    0x88, 0x32, 0xd4, 0x16, 0x88, 0x2e, 0xd4, 0x1e, 0x31, 0xf6, 0xd4, 0x1e, 0x92, 0xc3, 0x7c, 0x6f,
+    0x88, 0x22, 0xd4, 0x19, 0xcd, 0x58, 0x2d, 0xb3, 0xce, 0x4d, 0x34, 0x75, 0x65, 0xe8, 0x68, 0x20,
+    0x64, 0x66, 0xd4, 0x1f, 0xd4, 0x19, 0xcd, 0x59, 0x84, 0x0a, 0x92, 0xc3, 0xd4, 0x19, 0xd4, 0x1b,
+    0x7c, 0x6f, 0x64, 0x61, 0x31, 0x24, 0x3f, 0x50, 0x80, 0x09, 0x31, 0x64, 0x2c, 0x88, 0x80, 0x08,
+    0x31, 0x84, 0x35, 0x7c, 0x80, 0x08, 0x33, 0x24, 0x3f, 0x30, 0x80, 0x09, 0x2c, 0x10, 0xee, 0xe8,
+    0x00, 0x96, 0xef, 0xe9, 0x50, 0xd7, 0x30, 0xc9, 0x00, 0x08, 0xdd, 0x00, 0x00, 0x40, 0x80, 0x4f,
+    0xb1, 0x35, 0x83, 0xde, 0x31, 0x78, 0x9f, 0xff, 0xb0, 0x71, 0xb0, 0xb9, 0x83, 0xda, 0x74, 0x60,
+    0x6c, 0x90, 0xb0, 0x34, 0xb1, 0x73, 0x10, 0x97, 0x80, 0x04, 0x30, 0xc9, 0x80, 0x4f, 0x01, 0x06,
+    0x80, 0x16, 0x83, 0xbe, 0x31, 0x78, 0x9f, 0xff, 0xb0, 0x74, 0xb0, 0xbb, 0x83, 0xba, 0x74, 0x60,
+    0x30, 0x24, 0x3f, 0x50, 0x80, 0x09, 0x00, 0x06, 0x80, 0x14, 0xc8, 0x40, 0x34, 0x10, 0x80, 0x30,
+    0xe8, 0xfc, 0x80, 0x2e, 0x08, 0x00, 0x3a, 0x34, 0x80, 0x0a, 0x34, 0x10, 0x80, 0x20, 0x80, 0x1b,
+    0xd0, 0x38, 0x80, 0x0f, 0xd0, 0x30, 0x84, 0x23, 0x83, 0x88, 0x20, 0x00, 0x9c, 0x20, 0x88, 0x21,
+    0x83, 0x80, 0x20, 0x20, 0x8b, 0xc0, 0x88, 0x19, 0x83, 0x78, 0x20, 0x20, 0x99, 0xd0, 0x88, 0x11,
+    0x83, 0x70, 0x20, 0x40, 0x8e, 0x20, 0x88, 0x09, 0x83, 0x68, 0x20, 0x00, 0x8d, 0x48, 0x00, 0x08,
+    0xdd, 0x80, 0x00, 0x40, 0x09, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x38, 0x00, 0x38, 0x74, 0x80, 0x0a,
+    0x29, 0x09, 0x80, 0xb8, 0x83, 0x5e, 0x00, 0x02, 0x3a, 0x24, 0x80, 0x0a, 0x09, 0x86, 0x3a, 0x58,
+    0x80, 0x09, 0x38, 0x00, 0x39, 0x4c, 0x80, 0x0a, 0x83, 0x4a, 0x29, 0x09, 0x80, 0xc0, 0x2a, 0xff,
+    0x9f, 0x39, 0x20, 0x00, 0x80, 0x64, 0x00, 0x02, 0x3a, 0x2c, 0x80, 0x0a, 0x2a, 0xff, 0x9f, 0x2b,
+    0x20, 0x00, 0x83, 0xe8, 0x01, 0x06, 0x3a, 0x2c, 0x80, 0x0a, 0x2c, 0xd1, 0x00, 0x06, 0x3a, 0x24,
+    0x80, 0x0a, 0x30, 0x71, 0x30, 0xe8, 0x3f, 0xff, 0xbf, 0xff, 0x80, 0x09, 0x00, 0x02, 0x3a, 0x24,
+    0x80, 0x0a, 0x9f, 0x71, 0x33, 0x24, 0x3f, 0x30, 0x80, 0x09, 0xee, 0xe9, 0x10, 0x16, 0xef, 0xe8,
+    0x24, 0x68, 0xc0, 0xfe, 0x80, 0x0c, 0xb1, 0xbd, 0x09, 0x01, 0xa0, 0x01, 0x88, 0x10, 0xb1, 0x3d,
+    0xdc, 0x01, 0xb0, 0x3d, 0x00, 0x08, 0xde, 0x00, 0x00, 0x40, 0x2a, 0xff, 0x9e, 0xe3, 0x50, 0x16,
+    0xb0, 0x79, 0xb0, 0xb1, 0x2a, 0xff, 0x9e, 0xdf, 0x74, 0x60, 0xb0, 0x3c, 0xb0, 0xb2, 0x64, 0x68,
+    0x80, 0x11, 0x10, 0x07, 0x80, 0x16, 0x09, 0x00, 0xa0, 0x01, 0x88, 0x1a, 0x00, 0x07, 0x80, 0x16,
+    0xc0, 0xfe, 0x11, 0x07, 0x80, 0x16, 0xdc, 0x01, 0x00, 0x07, 0x80, 0x16, 0x2a, 0xff, 0x9e, 0xb1,
+    0xb0, 0xb2, 0xb0, 0x7c, 0xb0, 0xb3, 0x2a, 0xff, 0x9e, 0xad, 0x74, 0x60, 0x30, 0x24, 0x3f, 0x50,
+    0x80, 0x09, 0x00, 0x07, 0x80, 0x14, 0xe7, 0x48, 0x09, 0x04, 0x3a, 0x32, 0x80, 0x0a, 0xf9, 0x04,
+    0x08, 0x03, 0x3a, 0x30, 0x80, 0x0a, 0x23, 0x61, 0x95, 0x41, 0x04, 0xfc, 0x9f, 0xf8, 0x21, 0xac,
+    0x08, 0x04, 0x3a, 0x2a, 0x80, 0x0a, 0xd8, 0x18, 0x2c, 0x53, 0xf8, 0x03, 0x0a, 0x03, 0x3a, 0x28,
+    0x80, 0x0a, 0x04, 0xfc, 0x9f, 0xfa, 0x23, 0xe1, 0x83, 0xaf, 0x00, 0x08, 0xde, 0x80, 0x00, 0x40,
+    0x21, 0xac, 0xd9, 0x1a, 0x2d, 0x5d, 0x00, 0x02, 0x3a, 0x30, 0x80, 0x0a, 0x2c, 0x52, 0x09, 0x03,
+    0x3a, 0x24, 0x80, 0x0a, 0x21, 0x74, 0x02, 0x02, 0x3a, 0x28, 0x80, 0x0a, 0x2d, 0x74, 0xe7, 0x68,
+    0x9f, 0x70, 0x74, 0x52, 0x31, 0x64, 0x2c, 0xe4, 0x80, 0x08, 0x33, 0x24, 0x3f, 0x30, 0x80, 0x09,
+    0x09, 0x86, 0x3a, 0x58, 0x80, 0x09, 0xe7, 0x50, 0x29, 0x09, 0x80, 0xb8, 0x83, 0x24, 0x38, 0x00,
+    0x38, 0x74, 0x80, 0x0a, 0x09, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x38, 0x00, 0x39, 0x4c, 0x80, 0x0a,
+    0x83, 0x10, 0x29, 0x09, 0x80, 0xc0, 0x2c, 0x90, 0x00, 0x04, 0x3a, 0x34, 0x80, 0x0a, 0x24, 0x6a,
+    0xcf, 0x41, 0x01, 0x04, 0x38, 0x8a, 0x80, 0x0a, 0x02, 0x04, 0x38, 0x7e, 0x80, 0x0a, 0x35, 0x1e,
+    0x80, 0x01, 0x84, 0x98, 0x33, 0x1f, 0x80, 0x01, 0x3e, 0x00, 0x38, 0x8c, 0x80, 0x0a, 0x0b, 0x03,
+    0x00, 0x08, 0xdf, 0x00, 0x00, 0x40, 0x38, 0x7c, 0x80, 0x0a, 0xf3, 0x41, 0x83, 0x9e, 0x00, 0x06,
+    0x38, 0x74, 0x80, 0x0a, 0x35, 0x50, 0x00, 0x06, 0x38, 0x74, 0x80, 0x0a, 0x01, 0x06, 0x38, 0x78,
+    0x80, 0x0a, 0xd4, 0x41, 0x09, 0x03, 0x38, 0x88, 0x80, 0x0a, 0xf2, 0x42, 0xf1, 0x43, 0x00, 0x02,
+    0x38, 0x74, 0x80, 0x0a, 0x83, 0x76, 0x00, 0x06, 0x38, 0x80, 0x80, 0x0a, 0x27, 0x69, 0xd8, 0x10,
+    0xf1, 0xc3, 0x20, 0x31, 0xf2, 0xc2, 0xd9, 0x12, 0x31, 0xe8, 0x9f, 0xff, 0xf3, 0xc1, 0x20, 0x1d,
+    0x01, 0x06, 0x38, 0x80, 0x80, 0x0a, 0x02, 0x06, 0x38, 0x84, 0x80, 0x0a, 0xd5, 0x41, 0x02, 0x02,
+    0x38, 0x80, 0x80, 0x0a, 0x80, 0x0e, 0x40, 0x5e, 0x2b, 0xff, 0x9e, 0xeb, 0x00, 0x02, 0x38, 0x78,
+    0x80, 0x0a, 0x67, 0xe9, 0x80, 0x0d, 0x2b, 0xff, 0x9e, 0xdd, 0x00, 0x02, 0x38, 0x84, 0x80, 0x0a,
+    0xcf, 0x49, 0x38, 0xc1, 0x00, 0x04, 0x00, 0x08, 0xdf, 0x80, 0x00, 0x40, 0x3a, 0x34, 0x80, 0x0a,
+    0x30, 0x71, 0xcf, 0x41, 0x81, 0x77, 0x24, 0x6a, 0x2f, 0x10, 0x3e, 0x00, 0x39, 0x64, 0x80, 0x0a,
+    0x84, 0x6d, 0x0f, 0x03, 0x39, 0x54, 0x80, 0x0a, 0x83, 0x08, 0x00, 0x06, 0x39, 0x4c, 0x80, 0x0a,
+    0x35, 0x50, 0x00, 0x06, 0x39, 0x4c, 0x80, 0x0a, 0x01, 0x06, 0x39, 0x50, 0x80, 0x0a, 0xd4, 0x41,
+    0x09, 0x03, 0x39, 0x60, 0x80, 0x0a, 0xf1, 0x41, 0x00, 0x02, 0x39, 0x4c, 0x80, 0x0a, 0xcf, 0x42,
+    0x2a, 0xff, 0x9e, 0xe1, 0x00, 0x06, 0x39, 0x58, 0x80, 0x0a, 0x3b, 0x41, 0xd8, 0x10, 0xf1, 0xc1,
+    0x20, 0x31, 0xcf, 0x4a, 0x31, 0xe8, 0x9f, 0xff, 0xd9, 0x12, 0x20, 0x0b, 0x01, 0x06, 0x39, 0x58,
+    0x80, 0x0a, 0x02, 0x06, 0x39, 0x5c, 0x80, 0x0a, 0xd5, 0x41, 0x02, 0x02, 0x39, 0x58, 0x80, 0x0a,
+    0x00, 0x5e, 0x00, 0x04, 0x3a, 0x34, 0x80, 0x0a, 0x70, 0x76, 0x81, 0x99, 0x00, 0x08, 0xe0, 0x00,
+    0x00, 0x40, 0x30, 0x24, 0x3f, 0x50, 0x80, 0x09, 0xe7, 0x70, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0,
+    0x90, 0xc0, 0xe8, 0xe7, 0xc8, 0x48, 0x90, 0xc0, 0x9f, 0x71, 0x96, 0xc0, 0xf4, 0x85, 0x10, 0xfc,
+    0x9f, 0xf4, 0x66, 0x6a, 0x27, 0x18, 0x80, 0x18, 0x28, 0x03, 0x80, 0x0a, 0x98, 0x44, 0x90, 0xc0,
+    0x51, 0x59, 0x92, 0xd0, 0x61, 0x74, 0x25, 0x65, 0x51, 0x59, 0x42, 0x58, 0x9f, 0x71, 0x96, 0xc0,
+    0xf4, 0x8a, 0x10, 0xfc, 0x9f, 0xf6, 0x26, 0x6a, 0x12, 0xfc, 0x9f, 0xee, 0x27, 0x18, 0x80, 0x2c,
+    0x98, 0x22, 0x96, 0xc0, 0xfb, 0xc6, 0x18, 0x7a, 0x9f, 0xe2, 0x96, 0xc0, 0x98, 0x44, 0x28, 0x03,
+    0x80, 0x0c, 0x51, 0x61, 0x53, 0x63, 0x22, 0x74, 0x22, 0xf5, 0x51, 0x61, 0x94, 0xd0, 0x6e, 0x55,
+    0x53, 0x63, 0x66, 0x65, 0x44, 0x58, 0x98, 0x23, 0x9f, 0x71, 0xc0, 0x88, 0x33, 0xe4, 0x3b, 0xd0,
+    0x80, 0x01, 0x00, 0x08, 0xe0, 0x80, 0x00, 0x40, 0x31, 0x04, 0x21, 0x00, 0x80, 0x00, 0x98, 0xc0,
+    0x39, 0x28, 0x20, 0x00, 0xbf, 0xff, 0xc1, 0x88, 0x94, 0xc0, 0xc2, 0x80, 0xda, 0x11, 0x02, 0x99,
+    0x35, 0xd4, 0x7e, 0x48, 0x42, 0x99, 0x42, 0x99, 0x44, 0x99, 0x41, 0x99, 0x42, 0x99, 0x42, 0x99,
+    0x42, 0x99, 0x42, 0x99, 0x42, 0x99, 0x42, 0x99, 0x42, 0x99, 0x42, 0x99, 0x42, 0x99, 0x42, 0x99,
+    0x42, 0x91, 0x39, 0xe0, 0x36, 0x00, 0x80, 0x0d, 0x90, 0xc0, 0xe7, 0xe9, 0xeb, 0xe9, 0x90, 0xc0,
+    0x90, 0xc0, 0x3a, 0xe0, 0x20, 0x78, 0x80, 0x08, 0x27, 0x0c, 0x80, 0x18, 0xe7, 0xec, 0xc3, 0x1a,
+    0xc2, 0x19, 0xc3, 0x1a, 0xc2, 0x19, 0x4b, 0x91, 0x38, 0x00, 0x20, 0x34, 0x80, 0x08, 0x90, 0xc0,
+    0x40, 0x10, 0x30, 0x00, 0x20, 0x02, 0x80, 0x00, 0x31, 0xe4, 0x3b, 0xd0, 0x80, 0x01, 0x10, 0x05,
+    0xa0, 0x04, 0x38, 0x60, 0x3f, 0xc0, 0x80, 0x04, 0x00, 0x08, 0xe1, 0x00, 0x00, 0x40, 0x23, 0x41,
+    0x80, 0x00, 0x3c, 0x00, 0xa0, 0x08, 0x74, 0xd0, 0x6c, 0xd3, 0x64, 0x66, 0x24, 0x81, 0x80, 0x00,
+    0x3c, 0x00, 0xa8, 0x05, 0x32, 0xc8, 0x87, 0xc0, 0x64, 0xe1, 0x38, 0xcc, 0x88, 0x00, 0x18, 0x90,
+    0x0d, 0x50, 0xa0, 0x00, 0x92, 0xc2, 0x6c, 0x00, 0x36, 0x20, 0xa0, 0x00, 0x0d, 0x50, 0xa0, 0x00,
+    0x36, 0x06, 0xa0, 0x4c, 0x6c, 0x00, 0x6e, 0x93, 0x36, 0x00, 0xa0, 0x8c, 0x66, 0xe9, 0x6e, 0x13,
+    0x92, 0xc2, 0x78, 0x61, 0x36, 0x00, 0xa0, 0x04, 0x66, 0x69, 0x75, 0x50, 0x36, 0x06, 0xa0, 0x04,
+    0x78, 0x61, 0x7d, 0x76, 0x3e, 0x00, 0xa6, 0x03, 0x30, 0xcc, 0x85, 0x80, 0x75, 0x50, 0x30, 0xcc,
+    0x85, 0x80, 0xc8, 0x52, 0x38, 0x00, 0xa0, 0x09, 0x7e, 0x49, 0x7e, 0x49, 0x7d, 0x76, 0x36, 0x20,
+    0xa1, 0x00, 0x5f, 0x40, 0xc8, 0x52, 0x36, 0x00, 0xa8, 0x04, 0x63, 0x17, 0x5b, 0x40, 0x00, 0x08,
+    0xe1, 0x80, 0x00, 0x40, 0x36, 0x00, 0xb0, 0x00, 0x64, 0xe8, 0x61, 0x0c, 0x36, 0x07, 0xa0, 0x0c,
+    0x67, 0x64, 0x64, 0xe8, 0x36, 0x07, 0xb0, 0x00, 0x65, 0x64, 0x74, 0xce, 0x34, 0x4a, 0xf5, 0xc1,
+    0x49, 0x52, 0x9f, 0x70, 0xc5, 0x65, 0x31, 0x24, 0x3f, 0x30, 0x80, 0x09, 0x08, 0x86, 0x3a, 0x58,
+    0x80, 0x09, 0xe7, 0x48, 0xc0, 0x88, 0x28, 0x09, 0x82, 0x48, 0xf0, 0x41, 0x32, 0xe4, 0x3c, 0x84,
+    0x80, 0x01, 0x38, 0x00, 0x3a, 0x38, 0x80, 0x0a, 0x2c, 0x10, 0x39, 0x08, 0x29, 0xf4, 0xbf, 0xf8,
+    0x38, 0xd8, 0x33, 0xc4, 0xb1, 0xe2, 0x19, 0x91, 0x3a, 0x08, 0x29, 0x94, 0xbf, 0xf8, 0x90, 0xc0,
+    0xe8, 0xa9, 0x84, 0x65, 0x38, 0x08, 0x29, 0xd4, 0xbf, 0xf8, 0x39, 0xc8, 0x38, 0x08, 0xbf, 0xff,
+    0x11, 0x90, 0x38, 0x00, 0x20, 0xd0, 0x80, 0x08, 0x01, 0x00, 0x3a, 0x4a, 0x80, 0x0a, 0x11, 0x91,
+    0x39, 0x08, 0x29, 0xb4, 0x00, 0x08, 0xe2, 0x00, 0x00, 0x40, 0xbf, 0xf8, 0x33, 0xf9, 0x9f, 0xff,
+    0x41, 0x10, 0x11, 0x91, 0xe8, 0xe9, 0x09, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x32, 0xc9, 0x84, 0x10,
+    0x01, 0x00, 0x3a, 0x50, 0x80, 0x0a, 0x01, 0x01, 0x80, 0xdc, 0x11, 0x90, 0x08, 0x86, 0x3a, 0x58,
+    0x80, 0x09, 0x01, 0x00, 0x3a, 0x88, 0x80, 0x0a, 0x11, 0x92, 0x39, 0x08, 0x29, 0xf4, 0xbf, 0xf8,
+    0x01, 0x00, 0x3a, 0x4e, 0x80, 0x0a, 0x01, 0x00, 0x80, 0xda, 0x40, 0x91, 0x09, 0x86, 0x3a, 0x58,
+    0x80, 0x09, 0xc0, 0xa8, 0x29, 0x09, 0x80, 0xd8, 0xf0, 0x41, 0x32, 0xe4, 0x3c, 0x84, 0x80, 0x01,
+    0x38, 0x00, 0x3a, 0x4c, 0x80, 0x0a, 0x2d, 0x10, 0x03, 0x07, 0x3a, 0x4c, 0x80, 0x0a, 0x00, 0x07,
+    0x3a, 0x50, 0x80, 0x0a, 0x37, 0x1b, 0x80, 0x20, 0xdd, 0x98, 0xc0, 0xdf, 0x01, 0x07, 0x3a, 0x4c,
+    0x80, 0x0a, 0xdc, 0x01, 0xd8, 0x00, 0xdc, 0x03, 0x08, 0x86, 0x00, 0x08, 0xe2, 0x80, 0x00, 0x40,
+    0x3a, 0x58, 0x80, 0x09, 0x03, 0x00, 0x3a, 0x50, 0x80, 0x0a, 0x00, 0x00, 0x3a, 0x50, 0x80, 0x0a,
+    0x02, 0x00, 0x3a, 0x4c, 0x80, 0x0a, 0x10, 0x90, 0x81, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x3a, 0x88,
+    0x80, 0x0a, 0x11, 0x90, 0x80, 0xe0, 0x10, 0x90, 0x80, 0xe2, 0x38, 0xe8, 0x3c, 0x10, 0xbf, 0xff,
+    0xd8, 0x91, 0xdc, 0x19, 0x00, 0x90, 0x3a, 0xe8, 0x3c, 0x14, 0xbf, 0xff, 0x08, 0x86, 0x3a, 0x58,
+    0x80, 0x09, 0x32, 0xf9, 0x3f, 0xff, 0xbf, 0x00, 0xb9, 0x83, 0x09, 0x00, 0x3a, 0x48, 0x80, 0x0a,
+    0x10, 0x92, 0x13, 0x90, 0x80, 0xde, 0xdd, 0x00, 0x37, 0x18, 0x80, 0xff, 0xd8, 0x10, 0xdd, 0x18,
+    0x31, 0xf9, 0x3f, 0x00, 0xbc, 0xff, 0xdd, 0x01, 0x02, 0x92, 0x39, 0xc8, 0x38, 0x0c, 0xbf, 0xff,
+    0x08, 0x07, 0x3a, 0x4e, 0x80, 0x0a, 0x11, 0x91, 0xc8, 0x48, 0x33, 0xe9, 0x9f, 0xff, 0x09, 0x11,
+    0x00, 0x08, 0xe3, 0x00, 0x00, 0x40, 0xa0, 0x0f, 0xdc, 0x19, 0x00, 0x91, 0x38, 0x00, 0x20, 0x48,
+    0x80, 0x08, 0x90, 0xc0, 0x10, 0xd0, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x0c, 0x40, 0xa0, 0x00,
+    0x80, 0x21, 0x20, 0xe0, 0x8f, 0xef, 0x34, 0xd0, 0x12, 0x90, 0x80, 0xdc, 0xdc, 0x02, 0x00, 0x00,
+    0x80, 0xdc, 0x00, 0x07, 0x3a, 0x50, 0x80, 0x0a, 0xdc, 0x80, 0x01, 0x00, 0x3a, 0x50, 0x80, 0x0a,
+    0x2c, 0x10, 0x38, 0xc8, 0x38, 0x18, 0xbf, 0xff, 0x39, 0xc8, 0x38, 0x14, 0xbf, 0xff, 0x00, 0x90,
+    0x38, 0xc8, 0x38, 0x10, 0xbf, 0xff, 0x30, 0xf9, 0x3f, 0xff, 0xbf, 0xff, 0x00, 0x91, 0x39, 0xc8,
+    0x38, 0x08, 0xbf, 0xff, 0x00, 0x07, 0x3a, 0x50, 0x80, 0x0a, 0x09, 0x10, 0xa0, 0x0f, 0x00, 0x90,
+    0x38, 0x00, 0x20, 0xd0, 0x80, 0x08, 0x10, 0x91, 0xe7, 0x68, 0x31, 0xf8, 0x9f, 0xff, 0x9f, 0x70,
+    0x40, 0x10, 0x08, 0x86, 0x3a, 0x58, 0x00, 0x08, 0xe3, 0x80, 0x00, 0x40, 0x80, 0x09, 0x90, 0xc0,
+    0x58, 0xd0, 0x0c, 0x08, 0xa0, 0x01, 0x80, 0x09, 0x33, 0xe4, 0x3a, 0x8c, 0x80, 0x01, 0x9f, 0x71,
+    0x2b, 0xff, 0x9e, 0x0f, 0x39, 0xc8, 0x38, 0x08, 0xbf, 0xff, 0x38, 0x00, 0x20, 0xd0, 0x80, 0x08,
+    0x10, 0x91, 0xe7, 0x48, 0x40, 0x10, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x01, 0x07, 0x3a, 0x88,
+    0x80, 0x0a, 0x12, 0x90, 0x81, 0x00, 0x35, 0x1b, 0x81, 0x00, 0x31, 0xe1, 0x75, 0x53, 0x80, 0x75,
+    0xdd, 0x11, 0x0c, 0x02, 0xa1, 0x00, 0x80, 0x6d, 0x08, 0x07, 0x3a, 0x4c, 0x80, 0x0a, 0x0c, 0x08,
+    0xa0, 0x20, 0x80, 0x51, 0x02, 0x07, 0x3a, 0x8e, 0x80, 0x0a, 0x0c, 0x03, 0xa1, 0x00, 0x09, 0x02,
+    0xa0, 0x20, 0x02, 0x00, 0x3a, 0x8e, 0x80, 0x0a, 0x80, 0x20, 0x04, 0x07, 0x3a, 0x4e, 0x80, 0x0a,
+    0x09, 0x04, 0xa0, 0x20, 0xc8, 0x44, 0x09, 0x01, 0xa1, 0x00, 0x08, 0x00, 0x00, 0x08, 0xe4, 0x00,
+    0x00, 0x40, 0x3a, 0x4e, 0x80, 0x0a, 0x88, 0x32, 0x01, 0x00, 0x3a, 0x88, 0x80, 0x0a, 0xc2, 0xdf,
+    0x23, 0xe0, 0x9e, 0xff, 0xdd, 0x04, 0xdd, 0x81, 0xc8, 0x42, 0x08, 0x00, 0x3a, 0x4e, 0x80, 0x0a,
+    0x88, 0x18, 0x03, 0x00, 0x3a, 0x88, 0x80, 0x0a, 0xc2, 0xdf, 0x01, 0x07, 0x3a, 0x8e, 0x80, 0x0a,
+    0xdd, 0x01, 0x02, 0x00, 0x3a, 0x8e, 0x80, 0x0a, 0x34, 0x78, 0x2f, 0x10, 0x01, 0x07, 0x3a, 0x4a,
+    0x80, 0x0a, 0xdc, 0x90, 0xcf, 0x40, 0x00, 0x07, 0x3a, 0x50, 0x80, 0x0a, 0xd8, 0x00, 0x31, 0xf8,
+    0x9f, 0xff, 0xdc, 0x80, 0x34, 0x79, 0xc7, 0x81, 0x24, 0x69, 0xf0, 0x41, 0x25, 0x18, 0x82, 0xbe,
+    0xcf, 0x48, 0xc8, 0x40, 0xd8, 0x00, 0xf0, 0x42, 0x08, 0x00, 0x3a, 0x4a, 0x80, 0x0a, 0x3e, 0xe8,
+    0x20, 0x04, 0xbf, 0xff, 0x34, 0xff, 0xf0, 0xc1, 0xdc, 0x80, 0x64, 0xea, 0x27, 0x18, 0x82, 0x8c,
+    0x37, 0x7e, 0x00, 0x08, 0xe4, 0x80, 0x00, 0x40, 0x08, 0x07, 0x3a, 0x4c, 0x80, 0x0a, 0xd3, 0x27,
+    0x25, 0x18, 0x81, 0xf2, 0xd3, 0x26, 0x25, 0x18, 0x81, 0xca, 0x34, 0xff, 0xd3, 0x24, 0x25, 0x18,
+    0x81, 0x84, 0xd3, 0x23, 0x25, 0x18, 0x81, 0x4a, 0xd3, 0x22, 0x25, 0x18, 0x81, 0x08, 0xd3, 0x21,
+    0x80, 0x89, 0x27, 0x69, 0x00, 0x07, 0x3a, 0x4c, 0x80, 0x0a, 0x27, 0x18, 0x82, 0x10, 0x31, 0x1b,
+    0x80, 0x01, 0x25, 0xe9, 0x01, 0x06, 0x3a, 0x74, 0x80, 0x0a, 0x80, 0x33, 0x24, 0xe9, 0x35, 0x7f,
+    0xcf, 0x48, 0x80, 0x2b, 0xdd, 0x00, 0x25, 0x6a, 0xc8, 0x41, 0x84, 0x23, 0x11, 0xd0, 0x00, 0x07,
+    0x3a, 0x5e, 0x80, 0x0a, 0xdc, 0x01, 0x40, 0x10, 0x08, 0x06, 0x3a, 0x74, 0x80, 0x0a, 0x00, 0x07,
+    0x3a, 0x60, 0x80, 0x0a, 0x51, 0xd0, 0xdc, 0x19, 0x89, 0xd2, 0x40, 0x10, 0x25, 0xe9, 0x02, 0x06,
+    0x3a, 0x78, 0x80, 0x0a, 0x25, 0x18, 0x81, 0xc6, 0x00, 0x08, 0xe5, 0x00, 0x00, 0x40, 0x25, 0x69,
+    0x74, 0xff, 0x25, 0x18, 0x81, 0xbe, 0xf0, 0xc2, 0xdc, 0x80, 0x24, 0xe1, 0xc8, 0x42, 0x24, 0xea,
+    0x00, 0x07, 0x3a, 0x64, 0x80, 0x0a, 0x27, 0x18, 0x81, 0xaa, 0x51, 0xd0, 0xdc, 0x01, 0x40, 0x10,
+    0x08, 0x06, 0x3a, 0x78, 0x80, 0x0a, 0x8f, 0xc4, 0x00, 0x07, 0x3a, 0x66, 0x80, 0x0a, 0x00, 0x07,
+    0x3a, 0x4c, 0x80, 0x0a, 0x31, 0x1b, 0x80, 0x02, 0x25, 0xe9, 0x01, 0x06, 0x3a, 0x80, 0x80, 0x0a,
+    0x80, 0x2d, 0x24, 0xe9, 0x35, 0x7f, 0xcf, 0x48, 0x80, 0x25, 0xdd, 0x00, 0x25, 0x6a, 0xc8, 0x41,
+    0x84, 0x1d, 0x11, 0xd0, 0x00, 0x07, 0x3a, 0x6a, 0x80, 0x0a, 0xdc, 0x01, 0x40, 0x10, 0x08, 0x06,
+    0x3a, 0x80, 0x80, 0x0a, 0x8f, 0x86, 0x00, 0x07, 0x3a, 0x6c, 0x80, 0x0a, 0x25, 0xe9, 0x02, 0x06,
+    0x3a, 0x7c, 0x80, 0x0a, 0x25, 0x18, 0x81, 0x4c, 0x25, 0x69, 0x74, 0xff, 0x25, 0x18, 0x00, 0x08,
+    0xe5, 0x80, 0x00, 0x40, 0x81, 0x44, 0xf0, 0xc2, 0xdc, 0x80, 0x24, 0xe1, 0xc8, 0x42, 0x24, 0xea,
+    0x00, 0x07, 0x3a, 0x70, 0x80, 0x0a, 0x27, 0x18, 0x81, 0x30, 0x51, 0xd0, 0xdc, 0x01, 0x40, 0x10,
+    0x08, 0x06, 0x3a, 0x7c, 0x80, 0x0a, 0x8f, 0x4a, 0x00, 0x07, 0x3a, 0x72, 0x80, 0x0a, 0x34, 0xff,
+    0x08, 0x07, 0x3a, 0x4c, 0x80, 0x0a, 0x0c, 0x08, 0xa0, 0x04, 0x25, 0x18, 0x81, 0x0c, 0xcf, 0x48,
+    0x2c, 0x10, 0xdc, 0x80, 0x24, 0xea, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x27, 0x18, 0x80, 0xfa,
+    0x12, 0x00, 0x81, 0x0a, 0x35, 0x1c, 0x80, 0x7f, 0x21, 0xe0, 0x9f, 0x80, 0x3a, 0x61, 0xdc, 0x82,
+    0x6c, 0x7c, 0xde, 0x19, 0x88, 0xe2, 0x04, 0x00, 0x81, 0x0a, 0x34, 0xff, 0x08, 0x07, 0x3a, 0x4c,
+    0x80, 0x0a, 0x0c, 0x08, 0xa0, 0x08, 0x80, 0xd1, 0xcf, 0x48, 0xdc, 0x80, 0x24, 0xea, 0x08, 0x86,
+    0x3a, 0x58, 0x80, 0x09, 0x00, 0x08, 0xe6, 0x00, 0x00, 0x40, 0x84, 0xc3, 0x10, 0x00, 0x81, 0x0a,
+    0x31, 0x1c, 0x80, 0x7f, 0x21, 0xe0, 0x9f, 0x80, 0x3a, 0x41, 0xdc, 0x80, 0x20, 0x00, 0x80, 0x78,
+    0x8f, 0xc8, 0x6c, 0x7d, 0xcf, 0x48, 0xdc, 0x80, 0x24, 0xea, 0x08, 0x07, 0x3a, 0x4c, 0x80, 0x0a,
+    0x84, 0x33, 0x0c, 0x08, 0xa0, 0x10, 0x80, 0x2d, 0x9f, 0x7d, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09,
+    0x20, 0xe0, 0x9e, 0xff, 0x11, 0x90, 0x81, 0x00, 0x0c, 0x01, 0xa1, 0x00, 0x80, 0x0b, 0xdc, 0x01,
+    0x88, 0x0e, 0x00, 0x00, 0x81, 0x00, 0x09, 0x01, 0xa1, 0x00, 0x01, 0x00, 0x81, 0x00, 0x9f, 0x7c,
+    0x88, 0x6d, 0x34, 0xff, 0xcf, 0x48, 0xdc, 0x80, 0x24, 0xea, 0x08, 0x07, 0x3a, 0x4c, 0x80, 0x0a,
+    0x84, 0x5d, 0x0c, 0x08, 0xa0, 0x40, 0x80, 0x57, 0x32, 0xe4, 0x2d, 0x96, 0x80, 0x08, 0xc0, 0x81,
+    0x88, 0x4c, 0x67, 0x60, 0x2c, 0x10, 0x0c, 0x08, 0xa0, 0x80, 0x00, 0x08, 0xe6, 0x80, 0x00, 0x40,
+    0x80, 0x43, 0x33, 0xe4, 0x39, 0xe4, 0x80, 0x01, 0x11, 0x96, 0xc0, 0x81, 0x09, 0x11, 0xa0, 0x80,
+    0x32, 0xe4, 0x2e, 0x60, 0x80, 0x08, 0x41, 0x96, 0x27, 0x60, 0x11, 0x96, 0x30, 0xf9, 0x3f, 0xff,
+    0xbf, 0x7f, 0xdc, 0x01, 0x40, 0x96, 0x00, 0x07, 0x3a, 0x38, 0x80, 0x0a, 0x24, 0x69, 0x00, 0x07,
+    0x3a, 0x3a, 0x80, 0x0a, 0x84, 0x0f, 0x24, 0x69, 0x6c, 0x10, 0x84, 0x09, 0x33, 0xe4, 0x39, 0xea,
+    0x80, 0x01, 0x34, 0xff, 0x27, 0x60, 0xcf, 0x48, 0xdc, 0x80, 0x24, 0xea, 0x00, 0x07, 0x3a, 0x58,
+    0x80, 0x0a, 0x84, 0x17, 0x37, 0xff, 0x74, 0xd6, 0xdc, 0x07, 0x24, 0x69, 0xc0, 0x82, 0x80, 0x21,
+    0x2b, 0xff, 0x9c, 0x9d, 0x88, 0x1a, 0x67, 0xe0, 0x37, 0xff, 0x34, 0xd6, 0x00, 0x07, 0x3a, 0x5a,
+    0x80, 0x0a, 0xdc, 0x07, 0x24, 0x69, 0xc0, 0x83, 0x80, 0x07, 0x2b, 0xff, 0x9c, 0x83, 0x27, 0xe0,
+    0x00, 0x08, 0xe7, 0x00, 0x00, 0x40, 0xf0, 0xc1, 0xd8, 0x87, 0xdc, 0x01, 0x34, 0x78, 0x37, 0x7e,
+    0x77, 0xff, 0x24, 0x69, 0x3b, 0x41, 0x3f, 0xc1, 0xf0, 0x41, 0x2f, 0xff, 0x9d, 0x5f, 0x30, 0x24,
+    0x3f, 0x50, 0x80, 0x09, 0xe7, 0x68, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x02, 0x07, 0x3a, 0x4c,
+    0x80, 0x0a, 0x10, 0x90, 0x80, 0xd8, 0x30, 0x62, 0xc1, 0x81, 0x80, 0x93, 0xc9, 0x40, 0x09, 0x00,
+    0x3a, 0x4c, 0x80, 0x0a, 0x00, 0x07, 0x3a, 0x86, 0x80, 0x0a, 0x34, 0xf9, 0x02, 0x07, 0x3a, 0x4c,
+    0x80, 0x0a, 0x35, 0x1a, 0x80, 0xff, 0xdd, 0x01, 0x25, 0x69, 0xd9, 0x81, 0x80, 0x51, 0x33, 0x1a,
+    0x80, 0x20, 0x34, 0x11, 0x82, 0x00, 0xdd, 0x18, 0x80, 0x36, 0x34, 0x52, 0x02, 0x00, 0x3a, 0x86,
+    0x80, 0x0a, 0x34, 0x11, 0x80, 0x20, 0x84, 0x4d, 0x19, 0x90, 0x81, 0x00, 0x0c, 0x09, 0xa1, 0x00,
+    0x80, 0x16, 0x03, 0x07, 0x3a, 0x4e, 0x00, 0x08, 0xe7, 0x80, 0x00, 0x40, 0x80, 0x0a, 0x09, 0x03,
+    0xa0, 0x20, 0xc9, 0x43, 0x88, 0x34, 0x09, 0x00, 0x3a, 0x4e, 0x80, 0x0a, 0xc2, 0xdf, 0xdd, 0x03,
+    0x8f, 0xf4, 0xc9, 0x42, 0x74, 0x52, 0x09, 0x00, 0xa2, 0x00, 0x88, 0x1e, 0x00, 0x00, 0x3a, 0x86,
+    0x80, 0x0a, 0x02, 0x07, 0x3a, 0x8e, 0x80, 0x0a, 0xdc, 0x03, 0xdd, 0x03, 0x00, 0x00, 0x3a, 0x86,
+    0x80, 0x0a, 0x02, 0x00, 0x3a, 0x8e, 0x80, 0x0a, 0x7c, 0xc1, 0x33, 0x39, 0x9f, 0xff, 0x64, 0xe9,
+    0x85, 0x81, 0x01, 0x07, 0x3a, 0x4c, 0x80, 0x0a, 0xd9, 0x01, 0x10, 0x90, 0x80, 0xdc, 0xdd, 0x00,
+    0x00, 0x07, 0x3a, 0x86, 0x80, 0x0a, 0xdd, 0x18, 0x35, 0x7a, 0xc9, 0x42, 0x09, 0x00, 0x3a, 0x50,
+    0x80, 0x0a, 0x39, 0x00, 0x20, 0x48, 0x80, 0x08, 0x21, 0xe0, 0x8f, 0xef, 0x19, 0xd1, 0xdc, 0x82,
+    0x0c, 0x49, 0xa0, 0x00, 0x80, 0x0b, 0xc9, 0x41, 0x09, 0x00, 0x3a, 0x50, 0x00, 0x08, 0xe8, 0x00,
+    0x00, 0x40, 0x80, 0x0a, 0x05, 0x07, 0x3a, 0x84, 0x80, 0x0a, 0x02, 0x07, 0x3a, 0x54, 0x80, 0x0a,
+    0x35, 0xd2, 0x14, 0x90, 0x80, 0xe0, 0xd8, 0x85, 0xde, 0x01, 0x26, 0x61, 0xdd, 0x81, 0x25, 0xe1,
+    0xde, 0x82, 0x32, 0x63, 0x38, 0xe8, 0x3c, 0x10, 0xbf, 0xff, 0x80, 0x21, 0xde, 0x9c, 0x05, 0x00,
+    0x3a, 0x54, 0x80, 0x0a, 0x51, 0x90, 0x33, 0xf9, 0x9f, 0xff, 0x41, 0x90, 0x11, 0x90, 0x02, 0x07,
+    0x3a, 0x54, 0x80, 0x0a, 0xd9, 0x12, 0xdd, 0x19, 0x42, 0x90, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09,
+    0x01, 0x07, 0x3a, 0x8a, 0x80, 0x0a, 0xda, 0x01, 0x01, 0x07, 0x3a, 0x56, 0x80, 0x0a, 0x35, 0xd1,
+    0x12, 0x90, 0x80, 0xe2, 0xdd, 0x84, 0x25, 0xe1, 0xde, 0x02, 0x26, 0x61, 0x38, 0xe8, 0x3c, 0x10,
+    0xbf, 0xff, 0x32, 0x63, 0x04, 0x07, 0x3a, 0x84, 0x80, 0x0a, 0x80, 0x25, 0xd9, 0x84, 0xde, 0x01,
+    0xdd, 0x82, 0x00, 0x08, 0xe8, 0x80, 0x00, 0x40, 0xde, 0x1b, 0x04, 0x00, 0x3a, 0x56, 0x80, 0x0a,
+    0x51, 0x90, 0x33, 0xe9, 0x9f, 0xff, 0x41, 0x90, 0x11, 0x90, 0x02, 0x07, 0x3a, 0x56, 0x80, 0x0a,
+    0xdd, 0x19, 0x42, 0x90, 0x38, 0xc8, 0x38, 0x10, 0xbf, 0xff, 0x02, 0x07, 0x3a, 0x50, 0x80, 0x0a,
+    0x13, 0x90, 0xdd, 0x18, 0x37, 0xf9, 0x9f, 0xff, 0x31, 0x61, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09,
+    0x80, 0x21, 0x02, 0x07, 0x3a, 0x4c, 0x80, 0x0a, 0x37, 0xe9, 0x9f, 0xff, 0xd9, 0x02, 0x13, 0x90,
+    0x80, 0xdc, 0xdd, 0x03, 0x38, 0xc8, 0x38, 0x10, 0xbf, 0xff, 0xdd, 0x18, 0xdc, 0x9a, 0x41, 0x90,
+    0x38, 0xc8, 0x38, 0x0c, 0xbf, 0xff, 0x01, 0x07, 0x3a, 0x50, 0x80, 0x0a, 0x12, 0x90, 0x00, 0x07,
+    0x3a, 0x4e, 0x80, 0x0a, 0x35, 0x7a, 0xdc, 0x01, 0xdd, 0x01, 0x30, 0x62, 0xd9, 0x01, 0x80, 0x15,
+    0x38, 0xc8, 0x38, 0x0c, 0xbf, 0xff, 0x09, 0xf0, 0x00, 0x08, 0xe9, 0x00, 0x00, 0x40, 0xbf, 0xff,
+    0x51, 0x90, 0xdd, 0x01, 0xdd, 0x18, 0x42, 0x90, 0x01, 0x07, 0x3a, 0x4c, 0x80, 0x0a, 0xd8, 0x81,
+    0x02, 0x07, 0x3a, 0x50, 0x80, 0x0a, 0xdc, 0x82, 0x02, 0x07, 0x3a, 0x8e, 0x80, 0x0a, 0xd9, 0x02,
+    0xdc, 0x82, 0x34, 0xf9, 0x00, 0x07, 0x3a, 0x4e, 0x80, 0x0a, 0xd9, 0x01, 0xdd, 0x00, 0x25, 0x61,
+    0x09, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x71, 0x60, 0x13, 0x91, 0x80, 0xda, 0xdc, 0x83, 0x94, 0xc1,
+    0xc0, 0x81, 0x6c, 0x10, 0xdc, 0x19, 0x24, 0x61, 0xdc, 0x9a, 0x24, 0x69, 0xc8, 0x41, 0x80, 0x09,
+    0x08, 0x00, 0x3a, 0x4e, 0x80, 0x0a, 0x10, 0x91, 0x80, 0xde, 0x01, 0x07, 0x3a, 0x52, 0x80, 0x0a,
+    0x30, 0x61, 0x38, 0xe8, 0x3c, 0x14, 0xbf, 0xff, 0x80, 0x2b, 0x00, 0x00, 0x3a, 0x52, 0x80, 0x0a,
+    0x11, 0x90, 0x30, 0xf9, 0x3f, 0xff, 0xbf, 0x00, 0xdc, 0x01, 0x00, 0x90, 0xe9, 0xe8, 0x00, 0x08,
+    0xe9, 0x80, 0x00, 0x40, 0x10, 0x91, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0, 0x11, 0x90,
+    0x80, 0xde, 0xd8, 0x91, 0xdc, 0x98, 0x41, 0x91, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x01, 0x07,
+    0x3a, 0x58, 0x80, 0x0a, 0x10, 0x90, 0x80, 0xe4, 0x30, 0x61, 0xc9, 0x40, 0x80, 0x09, 0x09, 0x00,
+    0x3a, 0x58, 0x80, 0x0a, 0x10, 0x90, 0x80, 0xe6, 0x01, 0x07, 0x3a, 0x5a, 0x80, 0x0a, 0x30, 0x61,
+    0xc9, 0x40, 0x80, 0x09, 0x09, 0x00, 0x3a, 0x5a, 0x80, 0x0a, 0x10, 0x90, 0x80, 0xe8, 0x01, 0x07,
+    0x3a, 0x5c, 0x80, 0x0a, 0x30, 0x61, 0xc9, 0x40, 0x80, 0x1f, 0x09, 0x00, 0x3a, 0x5c, 0x80, 0x0a,
+    0x10, 0x90, 0x80, 0xe8, 0x31, 0x19, 0x8f, 0xfe, 0x30, 0x00, 0x20, 0x00, 0x80, 0x08, 0x6c, 0x51,
+    0x00, 0x02, 0x3a, 0x74, 0x80, 0x0a, 0x10, 0x90, 0x80, 0xea, 0x01, 0x07, 0x3a, 0x5e, 0x80, 0x0a,
+    0x30, 0x61, 0xc9, 0x40, 0x00, 0x08, 0xea, 0x00, 0x00, 0x40, 0x80, 0x09, 0x09, 0x00, 0x3a, 0x5e,
+    0x80, 0x0a, 0x10, 0x90, 0x80, 0xec, 0x01, 0x07, 0x3a, 0x60, 0x80, 0x0a, 0x30, 0x61, 0xc9, 0x40,
+    0x80, 0x09, 0x09, 0x00, 0x3a, 0x60, 0x80, 0x0a, 0x10, 0x90, 0x80, 0xee, 0x01, 0x07, 0x3a, 0x62,
+    0x80, 0x0a, 0x30, 0x61, 0xc9, 0x40, 0x80, 0x1f, 0x09, 0x00, 0x3a, 0x62, 0x80, 0x0a, 0x10, 0x90,
+    0x80, 0xee, 0x31, 0x19, 0x8f, 0xfe, 0x30, 0x00, 0x20, 0x00, 0x80, 0x08, 0x6c, 0x51, 0x00, 0x02,
+    0x3a, 0x78, 0x80, 0x0a, 0x10, 0x90, 0x80, 0xf0, 0x01, 0x07, 0x3a, 0x64, 0x80, 0x0a, 0x30, 0x61,
+    0xc9, 0x40, 0x80, 0x09, 0x09, 0x00, 0x3a, 0x64, 0x80, 0x0a, 0x10, 0x90, 0x80, 0xf2, 0x01, 0x07,
+    0x3a, 0x66, 0x80, 0x0a, 0x30, 0x61, 0xc9, 0x40, 0x80, 0x09, 0x09, 0x00, 0x3a, 0x66, 0x80, 0x0a,
+    0x10, 0x90, 0x80, 0xf4, 0x01, 0x07, 0x3a, 0x68, 0x80, 0x0a, 0x00, 0x08, 0xea, 0x80, 0x00, 0x40,
+    0x30, 0x61, 0xc9, 0x40, 0x80, 0x1f, 0x09, 0x00, 0x3a, 0x68, 0x80, 0x0a, 0x10, 0x90, 0x80, 0xf4,
+    0x31, 0x19, 0x8f, 0xfe, 0x30, 0x00, 0x20, 0x00, 0x80, 0x08, 0x6c, 0x51, 0x00, 0x02, 0x3a, 0x80,
+    0x80, 0x0a, 0x10, 0x90, 0x80, 0xf6, 0x01, 0x07, 0x3a, 0x6a, 0x80, 0x0a, 0x30, 0x61, 0xc9, 0x40,
+    0x80, 0x09, 0x09, 0x00, 0x3a, 0x6a, 0x80, 0x0a, 0x10, 0x90, 0x80, 0xf8, 0x01, 0x07, 0x3a, 0x6c,
+    0x80, 0x0a, 0x30, 0x61, 0xc9, 0x40, 0x80, 0x09, 0x09, 0x00, 0x3a, 0x6c, 0x80, 0x0a, 0x10, 0x90,
+    0x80, 0xfa, 0x01, 0x07, 0x3a, 0x6e, 0x80, 0x0a, 0x30, 0x61, 0xc9, 0x40, 0x80, 0x1f, 0x09, 0x00,
+    0x3a, 0x6e, 0x80, 0x0a, 0x10, 0x90, 0x80, 0xfa, 0x31, 0x19, 0x8f, 0xfe, 0x30, 0x00, 0x20, 0x00,
+    0x80, 0x08, 0x6c, 0x51, 0x00, 0x02, 0x3a, 0x7c, 0x80, 0x0a, 0x10, 0x90, 0x80, 0xfc, 0x01, 0x07,
+    0x00, 0x08, 0xeb, 0x00, 0x00, 0x40, 0x3a, 0x70, 0x80, 0x0a, 0x30, 0x61, 0xc9, 0x40, 0x80, 0x09,
+    0x09, 0x00, 0x3a, 0x70, 0x80, 0x0a, 0x01, 0x07, 0x3a, 0x72, 0x80, 0x0a, 0x10, 0x90, 0x80, 0xfe,
+    0x70, 0x61, 0x80, 0x09, 0x00, 0x00, 0x3a, 0x72, 0x80, 0x0a, 0x9f, 0x71, 0x31, 0x24, 0x3f, 0x30,
+    0x80, 0x09, 0x39, 0xc8, 0x3c, 0x18, 0xbf, 0xff, 0xc8, 0x40, 0x50, 0x91, 0x0c, 0x00, 0xa0, 0x03,
+    0x84, 0x49, 0xc8, 0x48, 0x21, 0x00, 0x97, 0x70, 0x32, 0xe4, 0x3c, 0x4e, 0x80, 0x01, 0x64, 0x60,
+    0xc2, 0xfe, 0xdd, 0x00, 0x21, 0x00, 0x97, 0x70, 0x36, 0x40, 0x80, 0x01, 0x34, 0x41, 0x80, 0x01,
+    0xd8, 0x91, 0xd4, 0xc0, 0xc9, 0x41, 0x21, 0x00, 0x87, 0xd0, 0xe8, 0x39, 0xc8, 0x48, 0x7c, 0x48,
+    0x64, 0x61, 0x64, 0x68, 0x32, 0xe4, 0x3c, 0x48, 0x80, 0x01, 0x9a, 0xc1, 0x3c, 0x10, 0x83, 0xe8,
+    0x90, 0xc0, 0x31, 0x00, 0x83, 0xe8, 0x00, 0x08, 0xeb, 0x80, 0x00, 0x40, 0x88, 0x15, 0xc8, 0x48,
+    0x21, 0x00, 0x98, 0x00, 0x32, 0xe4, 0x3c, 0x4e, 0x80, 0x01, 0x64, 0x60, 0x35, 0x50, 0x6c, 0x10,
+    0x7d, 0x58, 0x35, 0x29, 0x9f, 0x00, 0x31, 0x1c, 0x87, 0xff, 0xc5, 0x68, 0x9f, 0x7d, 0x38, 0xe8,
+    0x3c, 0x00, 0xbf, 0xff, 0x33, 0xf9, 0x38, 0x00, 0x80, 0xff, 0x52, 0x90, 0xdd, 0x82, 0xdc, 0x9b,
+    0xdc, 0x9c, 0x41, 0x90, 0xc5, 0x60, 0x90, 0xc0, 0x90, 0xc0, 0x9f, 0x71, 0x83, 0x67, 0x37, 0xd0,
+    0x37, 0x51, 0xd4, 0x22, 0x80, 0x90, 0x92, 0xc2, 0xc0, 0xff, 0x32, 0xe4, 0x39, 0x4e, 0x80, 0x01,
+    0x74, 0x57, 0x27, 0x60, 0x67, 0xe0, 0x67, 0x69, 0x80, 0x7c, 0x92, 0xc2, 0xc0, 0xff, 0xd3, 0xa1,
+    0x80, 0x35, 0x27, 0xe9, 0x2c, 0x90, 0x30, 0x01, 0x20, 0x00, 0x80, 0x08, 0x84, 0x49, 0x33, 0x78,
+    0x7f, 0x45, 0x7b, 0x61, 0x80, 0x60, 0x92, 0xc2, 0xc0, 0xff, 0x10, 0x7c, 0x00, 0x08, 0xec, 0x00,
+    0x00, 0x40, 0x9f, 0xe7, 0xd0, 0x21, 0x84, 0x0a, 0x09, 0x96, 0xa0, 0x00, 0x09, 0x16, 0xb0, 0x00,
+    0x38, 0xe8, 0x3c, 0x18, 0xbf, 0xff, 0x88, 0x42, 0x46, 0x90, 0x30, 0xe1, 0x3f, 0xff, 0x80, 0xff,
+    0xdf, 0x00, 0x10, 0x7c, 0x9f, 0xe7, 0xd0, 0x21, 0x84, 0x0a, 0x09, 0xd6, 0xa0, 0x00, 0x09, 0x16,
+    0xb0, 0x00, 0x8f, 0xe4, 0x38, 0xe8, 0x3c, 0x1c, 0xbf, 0xff, 0xc8, 0x46, 0x39, 0x00, 0x35, 0x56,
+    0x80, 0x08, 0xe8, 0x49, 0xc8, 0x48, 0x91, 0x99, 0x32, 0xe4, 0x3c, 0x4e, 0x80, 0x01, 0x24, 0x60,
+    0xc1, 0x8a, 0x00, 0x02, 0x35, 0x50, 0x80, 0x08, 0x6c, 0x10, 0x31, 0x24, 0x3f, 0x50, 0x80, 0x09,
+    0xd4, 0x21, 0x84, 0x5d, 0x38, 0xc8, 0x3c, 0x08, 0xbf, 0xff, 0xd8, 0x90, 0x41, 0x90, 0x11, 0x90,
+    0x38, 0xc8, 0x3c, 0x08, 0xbf, 0xff, 0x33, 0xf9, 0x9f, 0xff, 0x70, 0x61, 0x80, 0x0d, 0x51, 0x90,
+    0x33, 0xf9, 0x00, 0x08, 0xec, 0x80, 0x00, 0x40, 0x9f, 0xff, 0x70, 0x61, 0x85, 0xf9, 0x2c, 0x90,
+    0xc0, 0x8b, 0x01, 0xc0, 0x3e, 0x56, 0x80, 0x09, 0x32, 0xe4, 0x39, 0xe4, 0x80, 0x01, 0x01, 0x01,
+    0x3a, 0x94, 0x80, 0x0a, 0xc0, 0x9c, 0x32, 0xe4, 0x3a, 0x5c, 0x80, 0x01, 0x39, 0xe0, 0x2c, 0xbe,
+    0x80, 0x08, 0x32, 0xe4, 0x3a, 0x68, 0x80, 0x01, 0xc0, 0x9c, 0xc1, 0x81, 0x32, 0xe4, 0x3a, 0x62,
+    0x80, 0x01, 0xc0, 0x9c, 0x9f, 0x71, 0x38, 0xa8, 0x3c, 0x20, 0xbf, 0xff, 0x09, 0x06, 0x3a, 0x90,
+    0x80, 0x0a, 0x1b, 0x90, 0x0a, 0x86, 0x3a, 0x54, 0x80, 0x09, 0xc0, 0x9c, 0xe8, 0xeb, 0xe8, 0x39,
+    0x08, 0x82, 0x80, 0x64, 0x32, 0xe4, 0x3a, 0x68, 0x80, 0x01, 0x0b, 0x02, 0x3a, 0x90, 0x80, 0x0a,
+    0x09, 0x06, 0x35, 0x4c, 0x80, 0x08, 0x38, 0x00, 0x20, 0x36, 0x80, 0x08, 0xe9, 0x41, 0x09, 0x02,
+    0x35, 0x4c, 0x80, 0x08, 0x00, 0x07, 0x35, 0x4e, 0x00, 0x08, 0xed, 0x00, 0x00, 0x40, 0x80, 0x08,
+    0x40, 0x10, 0x00, 0x06, 0x35, 0x50, 0x80, 0x08, 0x24, 0x69, 0xc8, 0x40, 0x80, 0x19, 0xe8, 0x61,
+    0xe8, 0xf1, 0x84, 0x12, 0x08, 0x02, 0x35, 0x50, 0x80, 0x08, 0x38, 0x00, 0x35, 0x56, 0x80, 0x08,
+    0xc0, 0x81, 0x90, 0x98, 0x00, 0x05, 0x3a, 0x94, 0x80, 0x0a, 0x24, 0x69, 0x00, 0x85, 0x3a, 0x37,
+    0x80, 0x09, 0x80, 0x3f, 0x34, 0x60, 0x38, 0xc8, 0x3c, 0x10, 0xbf, 0xff, 0x24, 0x69, 0x00, 0xc4,
+    0x3e, 0x56, 0x80, 0x09, 0x80, 0x0d, 0xd4, 0x22, 0x84, 0x21, 0xd4, 0x27, 0x84, 0x25, 0x88, 0x1b,
+    0x50, 0x90, 0x01, 0x06, 0x35, 0x4c, 0x80, 0x08, 0x33, 0x19, 0x80, 0x3f, 0xd0, 0xa0, 0x84, 0x12,
+    0x31, 0x88, 0x80, 0x00, 0xd0, 0x20, 0x84, 0x0b, 0xc0, 0x81, 0x00, 0x81, 0x3a, 0x5c, 0x80, 0x09,
+    0x2c, 0x90, 0x00, 0x05, 0x3a, 0x95, 0x80, 0x0a, 0x01, 0xc0, 0x3e, 0x56, 0x80, 0x09, 0x00, 0x08,
+    0xed, 0x80, 0x00, 0x40, 0x9f, 0x70, 0x00, 0x01, 0x3a, 0x94, 0x80, 0x0a, 0x90, 0xc0, 0x90, 0xc0,
+    0x90, 0xc0, 0x90, 0xc0, 0x31, 0x24, 0x3f, 0x30, 0x80, 0x09, 0x83, 0xfb, 0x32, 0xe4, 0x38, 0xac,
+    0x80, 0x01, 0x37, 0x50, 0xe7, 0x50, 0x32, 0xe4, 0x3a, 0x7a, 0x80, 0x01, 0xc0, 0x9e, 0xc1, 0x83,
+    0x32, 0xe4, 0x3a, 0x62, 0x80, 0x01, 0xc0, 0x9e, 0x33, 0xe4, 0x3b, 0x3a, 0x80, 0x01, 0x27, 0x60,
+    0x00, 0x07, 0x39, 0xc0, 0x80, 0x08, 0x24, 0x69, 0x38, 0x00, 0x38, 0xa8, 0x80, 0x08, 0x39, 0x00,
+    0x20, 0x26, 0x80, 0x08, 0x80, 0x7e, 0x92, 0xc2, 0xc0, 0x86, 0x74, 0x56, 0x78, 0x61, 0x7c, 0x41,
+    0x10, 0xd1, 0xc9, 0x40, 0x73, 0x78, 0xe9, 0x18, 0x80, 0x68, 0x56, 0xd1, 0xd7, 0x20, 0x84, 0x63,
+    0x36, 0x56, 0x80, 0x00, 0x80, 0x5d, 0x32, 0xe4, 0x39, 0xf6, 0x80, 0x01, 0x20, 0x00, 0x83, 0xe8,
+    0x27, 0x60, 0x39, 0x00, 0x00, 0x08, 0xee, 0x00, 0x00, 0x40, 0x21, 0x14, 0x80, 0x08, 0x27, 0xe8,
+    0x9f, 0xf0, 0x11, 0xd1, 0xf8, 0x41, 0x3c, 0xc8, 0xc0, 0x82, 0x36, 0x22, 0x80, 0x06, 0x34, 0x21,
+    0x80, 0x06, 0xd8, 0x91, 0x2d, 0x10, 0xd4, 0xc2, 0x24, 0xe1, 0x02, 0x7c, 0x9f, 0xfb, 0x78, 0xce,
+    0x32, 0xe4, 0x3b, 0x76, 0x80, 0x01, 0x64, 0xe0, 0x27, 0x60, 0x10, 0xfc, 0x9f, 0xf0, 0xd4, 0x46,
+    0x38, 0x61, 0x38, 0x00, 0x21, 0xf2, 0x80, 0x08, 0x2c, 0x90, 0x74, 0x78, 0x32, 0xe4, 0x3b, 0x58,
+    0x80, 0x01, 0x41, 0x10, 0x88, 0x05, 0xc0, 0x81, 0x30, 0x24, 0x3f, 0x50, 0x80, 0x09, 0xe7, 0x70,
+    0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x94, 0xc0, 0x96, 0x20, 0x97, 0x20,
+    0x94, 0xc0, 0x9e, 0x20, 0x9f, 0x20, 0x27, 0x0a, 0x80, 0x30, 0xe7, 0xea, 0x27, 0x0a, 0x80, 0x00,
+    0xc8, 0xb0, 0x74, 0x50, 0xf0, 0x18, 0xc0, 0x81, 0x33, 0x64, 0x00, 0x08, 0xee, 0x80, 0x00, 0x40,
+    0x36, 0x10, 0x80, 0x08, 0x3d, 0xa8, 0x3c, 0x20, 0xbf, 0xff, 0xfd, 0x45, 0xfe, 0xc5, 0x90, 0xc0,
+    0x56, 0x96, 0xf6, 0x4b, 0x9f, 0x7d, 0xc6, 0x81, 0x06, 0x00, 0x3a, 0x98, 0x80, 0x0a, 0x08, 0x86,
+    0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0, 0xe8, 0x46, 0xf8, 0x45, 0xfd, 0xc5, 0x90, 0xc0, 0x5e, 0x15,
+    0xfe, 0x08, 0xf5, 0x88, 0x3b, 0x19, 0x80, 0x08, 0xf1, 0x45, 0xf1, 0xc5, 0x64, 0xe9, 0x37, 0xe4,
+    0x2f, 0x08, 0x80, 0x08, 0x3a, 0xc8, 0x24, 0x28, 0xbf, 0xff, 0xfa, 0x45, 0xf9, 0xc5, 0x90, 0xc0,
+    0x57, 0x91, 0xf7, 0x44, 0xf4, 0xc4, 0x39, 0x18, 0x80, 0x80, 0xf0, 0x45, 0xf3, 0xc5, 0xf3, 0x44,
+    0x1f, 0xfc, 0x9f, 0xf2, 0xff, 0x0c, 0x37, 0xc9, 0x24, 0x28, 0xbf, 0xff, 0xf7, 0x45, 0xfc, 0xc5,
+    0x90, 0xc0, 0x55, 0x94, 0xf5, 0x44, 0x20, 0xe0, 0x9f, 0x7f, 0xf1, 0xc4, 0xdc, 0x01, 0xf0, 0x44,
+    0x00, 0x08, 0xef, 0x00, 0x00, 0x40, 0xf4, 0xc4, 0xff, 0xc5, 0x90, 0xc0, 0x44, 0x97, 0x3c, 0xe8,
+    0x3c, 0x2c, 0xbf, 0xff, 0xfc, 0x45, 0xfc, 0xc5, 0x90, 0xc0, 0x50, 0x94, 0xf0, 0x44, 0xf5, 0xc4,
+    0x3b, 0x1c, 0x8f, 0x00, 0xf4, 0x45, 0xf5, 0xc5, 0x3a, 0xcf, 0x86, 0x08, 0xf7, 0x45, 0xf1, 0xc5,
+    0xf1, 0x44, 0x1b, 0xfc, 0x9f, 0xf2, 0xfb, 0x0d, 0x31, 0xc9, 0x24, 0x18, 0xbf, 0xff, 0xf1, 0x45,
+    0xf9, 0xc5, 0x90, 0xc0, 0x57, 0x91, 0xf7, 0x44, 0xf4, 0xc4, 0x39, 0x0a, 0x80, 0x30, 0xf2, 0x45,
+    0xf0, 0xc5, 0x30, 0xcf, 0x84, 0x10, 0xf7, 0x44, 0xf4, 0xc4, 0xf4, 0x45, 0x19, 0xfc, 0x9f, 0xee,
+    0xf9, 0x0f, 0x34, 0xc9, 0x24, 0x18, 0xbf, 0xff, 0xf4, 0x45, 0xfa, 0xc5, 0x90, 0xc0, 0x54, 0x92,
+    0xf4, 0x44, 0xf7, 0xc4, 0x3f, 0x0f, 0x8f, 0x00, 0xf7, 0x45, 0xf2, 0xc5, 0x34, 0xca, 0x82, 0x18,
+    0xf2, 0x44, 0xf2, 0xc4, 0xf2, 0x45, 0x00, 0x08, 0xef, 0x80, 0x00, 0x40, 0x1a, 0xfc, 0x9f, 0xee,
+    0xfa, 0x10, 0x37, 0xe9, 0x3c, 0x2c, 0xbf, 0xff, 0xf7, 0x45, 0xfc, 0xc5, 0x90, 0xc0, 0x51, 0x94,
+    0xf1, 0x44, 0x20, 0xe0, 0x90, 0xff, 0xf7, 0xc4, 0xdc, 0x07, 0xf0, 0x44, 0xf7, 0xc4, 0xfb, 0xc5,
+    0x90, 0xc0, 0x47, 0x93, 0x34, 0xc9, 0x24, 0x18, 0xbf, 0xff, 0xf4, 0x45, 0xf9, 0xc5, 0x90, 0xc0,
+    0x53, 0x91, 0xf3, 0x44, 0x35, 0xf9, 0x3f, 0xff, 0xbf, 0xcf, 0xf7, 0xc4, 0xde, 0x87, 0xf5, 0x44,
+    0xf7, 0xc4, 0xff, 0xc5, 0x90, 0xc0, 0x47, 0x97, 0x37, 0xc9, 0x24, 0x18, 0xbf, 0xff, 0xf7, 0x45,
+    0xfe, 0xc5, 0x90, 0xc0, 0x51, 0x96, 0xf1, 0x44, 0x31, 0xf9, 0x3f, 0xff, 0xb0, 0xff, 0xf2, 0xc4,
+    0xdc, 0x82, 0xf1, 0x43, 0xf5, 0xc3, 0xfa, 0xc5, 0x90, 0xc0, 0x45, 0x92, 0x35, 0xe9, 0x3c, 0x0c,
+    0xbf, 0xff, 0xf5, 0x45, 0xfd, 0xc5, 0x90, 0xc0, 0x51, 0x95, 0xf1, 0x44, 0x00, 0x08, 0xf0, 0x00,
+    0x00, 0x40, 0xf7, 0xc4, 0x3f, 0x8c, 0x80, 0x00, 0xf4, 0x45, 0xf2, 0xc5, 0x34, 0xc9, 0x80, 0x5f,
+    0xf1, 0x44, 0xf2, 0xc4, 0xf2, 0x45, 0x14, 0xfc, 0x9f, 0xee, 0xf4, 0x0e, 0x30, 0xe9, 0x3c, 0x0c,
+    0xbf, 0xff, 0xf0, 0x45, 0xf8, 0xc5, 0x90, 0xc0, 0x57, 0x90, 0xf7, 0x44, 0x34, 0xe9, 0x3f, 0xff,
+    0xbf, 0xff, 0xf5, 0xc4, 0xde, 0x05, 0xf4, 0x44, 0xf7, 0xc4, 0xfa, 0xc5, 0x90, 0xc0, 0x47, 0x92,
+    0x14, 0xfc, 0x9f, 0xd0, 0x73, 0x64, 0x35, 0xe4, 0x30, 0x6a, 0x80, 0x08, 0x34, 0xa9, 0x3c, 0x4c,
+    0xbf, 0xff, 0xf4, 0x45, 0xfc, 0xc5, 0x90, 0xc0, 0x53, 0x94, 0xf3, 0x44, 0xf0, 0xc4, 0x09, 0x10,
+    0xa8, 0x00, 0xf0, 0x44, 0xf0, 0xc4, 0xfd, 0xc5, 0x90, 0xc0, 0x40, 0x95, 0x30, 0xe9, 0x3c, 0x00,
+    0xbf, 0xff, 0xf0, 0x45, 0xff, 0xc5, 0x90, 0xc0, 0x50, 0x97, 0xf0, 0x4a, 0xc0, 0x90, 0x33, 0x44,
+    0x3d, 0x26, 0x00, 0x08, 0xf0, 0x80, 0x00, 0x40, 0x80, 0x08, 0xc0, 0x8b, 0x33, 0xe4, 0x39, 0xea,
+    0x80, 0x01, 0xc0, 0x8a, 0x33, 0xe4, 0x39, 0xea, 0x80, 0x01, 0xc0, 0x87, 0x33, 0xe4, 0x39, 0xea,
+    0x80, 0x01, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0,
+    0x90, 0xc0, 0x90, 0xc0, 0x9f, 0x79, 0x20, 0x00, 0x83, 0xe8, 0x33, 0xe4, 0x39, 0xf6, 0x80, 0x01,
+    0xc0, 0x8b, 0x33, 0xe4, 0x39, 0xe4, 0x80, 0x01, 0xc0, 0x8a, 0x33, 0xe4, 0x39, 0xe4, 0x80, 0x01,
+    0xc3, 0x81, 0x03, 0x81, 0x3a, 0x5c, 0x80, 0x09, 0x0e, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0,
+    0xee, 0x44, 0xfe, 0x45, 0xfd, 0xc5, 0x90, 0xc0, 0x57, 0x15, 0xf7, 0x08, 0xf2, 0x88, 0xd1, 0x28,
+    0x37, 0xe4, 0x30, 0xfc, 0x80, 0x08, 0xc0, 0x9a, 0x33, 0x44, 0x3d, 0x26, 0x80, 0x08, 0x31, 0xe4,
+    0x31, 0x04, 0x80, 0x08, 0xc0, 0xae, 0x33, 0x44, 0x00, 0x08, 0xf1, 0x00, 0x00, 0x40, 0x3d, 0x26,
+    0x80, 0x08, 0x34, 0xe9, 0x3c, 0x2c, 0xbf, 0xff, 0xf4, 0x45, 0x18, 0xfc, 0x9f, 0xe6, 0xf8, 0x08,
+    0x14, 0xfc, 0x9f, 0xf0, 0x7e, 0x48, 0xf4, 0x44, 0xfa, 0xc5, 0x90, 0xc0, 0x52, 0x92, 0xf2, 0x43,
+    0xf1, 0xc4, 0xf7, 0xc3, 0xdc, 0x9f, 0xf1, 0x43, 0xf5, 0xc3, 0xff, 0xc5, 0x90, 0xc0, 0x45, 0x97,
+    0x39, 0xc8, 0x24, 0x18, 0xbf, 0xff, 0xf9, 0x45, 0x1a, 0xfc, 0x9f, 0xe2, 0xfa, 0x08, 0x11, 0xfc,
+    0x9f, 0xf0, 0xd9, 0x11, 0xf2, 0x43, 0xfc, 0xc5, 0x90, 0xc0, 0x55, 0x94, 0xf5, 0x42, 0xf1, 0xc3,
+    0xf7, 0xc2, 0xdc, 0x9f, 0xf1, 0x42, 0xf7, 0xc2, 0xfe, 0xc5, 0x90, 0xc0, 0x47, 0x96, 0x3b, 0xc8,
+    0x24, 0x18, 0xbf, 0xff, 0xfb, 0x45, 0x1c, 0xfc, 0x9f, 0xe0, 0xfc, 0x08, 0x11, 0xfc, 0x9f, 0xf0,
+    0x7c, 0xd8, 0xf1, 0x44, 0xfd, 0xc5, 0x90, 0xc0, 0x51, 0x95, 0xf1, 0x43, 0xf1, 0xc4, 0x00, 0x08,
+    0xf1, 0x80, 0x00, 0x40, 0xf0, 0xc3, 0xdc, 0x98, 0xf1, 0x44, 0xf7, 0xc4, 0xfc, 0xc5, 0x90, 0xc0,
+    0x47, 0x94, 0x3e, 0xe8, 0x3c, 0x0c, 0xbf, 0xff, 0xfe, 0x45, 0x1e, 0xfc, 0x9f, 0xe4, 0xfe, 0x08,
+    0x11, 0xfc, 0x9f, 0xf0, 0x7c, 0xdf, 0xf1, 0x44, 0xfa, 0xc5, 0x90, 0xc0, 0x57, 0x92, 0xf7, 0x43,
+    0xf6, 0xc4, 0xf1, 0xc3, 0xdf, 0x19, 0xf6, 0x44, 0xf0, 0xc4, 0xfb, 0xc5, 0x90, 0xc0, 0x40, 0x93,
+    0x17, 0xfc, 0x9f, 0xd0, 0xd3, 0xa1, 0x35, 0xe4, 0x31, 0xec, 0x80, 0x08, 0x32, 0xa9, 0x3c, 0x4c,
+    0xbf, 0xff, 0xf2, 0x45, 0xf8, 0xc5, 0x90, 0xc0, 0x52, 0x90, 0xf2, 0x44, 0x36, 0xf9, 0x3f, 0xff,
+    0xb7, 0xff, 0xf3, 0xc4, 0xdf, 0x03, 0xf6, 0x44, 0xf1, 0xc4, 0xfd, 0xc5, 0x90, 0xc0, 0x41, 0x95,
+    0x0b, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0, 0xeb, 0x46, 0xfb, 0x45, 0xf9, 0xc5, 0x90, 0xc0,
+    0x52, 0x11, 0xf2, 0x08, 0x00, 0x08, 0xf2, 0x00, 0x00, 0x40, 0xf6, 0x88, 0x3d, 0x19, 0x80, 0x08,
+    0xf1, 0x45, 0xf2, 0xc5, 0x65, 0x69, 0x37, 0xe4, 0x32, 0x3a, 0x80, 0x08, 0x31, 0xc9, 0x24, 0x28,
+    0xbf, 0xff, 0xf1, 0x45, 0x1e, 0xfc, 0x9f, 0xe8, 0xfe, 0x08, 0xf8, 0xc5, 0x90, 0xc0, 0x50, 0x90,
+    0xf0, 0x43, 0x14, 0xfc, 0x9f, 0xf0, 0xf1, 0xc3, 0xde, 0x19, 0xf4, 0x44, 0xf4, 0xc4, 0xfd, 0xc5,
+    0x90, 0xc0, 0x44, 0x95, 0x9f, 0x7c, 0x33, 0xa9, 0x3c, 0x20, 0xbf, 0xff, 0xf3, 0x45, 0xfa, 0xc5,
+    0x90, 0xc0, 0x50, 0x92, 0xf0, 0x49, 0xc8, 0xb0, 0x27, 0x0d, 0x80, 0x00, 0x27, 0xed, 0x9f, 0xd0,
+    0xe7, 0xed, 0x94, 0xc0, 0x9e, 0x21, 0x9f, 0x21, 0x94, 0xc0, 0x96, 0x21, 0x97, 0x21, 0x9f, 0x71,
+    0x2b, 0xff, 0x9b, 0x2b, 0x37, 0xd0, 0x38, 0x08, 0x29, 0xf4, 0xbf, 0xf8, 0x30, 0xd9, 0x33, 0xc4,
+    0xb1, 0xe2, 0x00, 0x90, 0x38, 0x08, 0x29, 0xd4, 0xbf, 0xf8, 0x00, 0x08, 0xf2, 0x80, 0x00, 0x40,
+    0x01, 0x07, 0x3a, 0x4c, 0x80, 0x0a, 0x00, 0x07, 0x3a, 0x4a, 0x80, 0x0a, 0xd8, 0x91, 0xdc, 0x19,
+    0x00, 0x90, 0x38, 0x08, 0x29, 0xb4, 0xbf, 0xf8, 0x01, 0x07, 0x3a, 0x50, 0x80, 0x0a, 0x00, 0x07,
+    0x3a, 0x88, 0x80, 0x0a, 0xd8, 0x91, 0xdc, 0x19, 0x00, 0x90, 0x38, 0x08, 0x29, 0x94, 0xbf, 0xf8,
+    0x09, 0x07, 0x3a, 0x4e, 0x80, 0x0a, 0x09, 0x90, 0xc2, 0x81, 0x36, 0x52, 0x08, 0x86, 0x3a, 0x58,
+    0x80, 0x09, 0xe7, 0x48, 0x10, 0x00, 0x80, 0x9e, 0x2c, 0x7c, 0xc6, 0x90, 0x75, 0x54, 0x32, 0xe4,
+    0x39, 0xd2, 0x80, 0x01, 0x6e, 0x7d, 0x3e, 0x16, 0x8f, 0xa0, 0x32, 0xe4, 0x3c, 0x4e, 0x80, 0x01,
+    0x34, 0xd6, 0x67, 0xe0, 0x21, 0x00, 0x83, 0xe7, 0xd4, 0x41, 0x21, 0x00, 0x83, 0xe8, 0x32, 0xe4,
+    0x3c, 0x4e, 0x80, 0x01, 0x64, 0x60, 0x2d, 0x90, 0xc8, 0x40, 0x39, 0xe8, 0x38, 0x14, 0xbf, 0xff,
+    0x00, 0x08, 0xf3, 0x00, 0x00, 0x40, 0xe8, 0x61, 0x10, 0x91, 0xf8, 0x04, 0x22, 0xe0, 0x9f, 0x00,
+    0xdd, 0x00, 0x10, 0xfc, 0x9f, 0xf8, 0xdc, 0x1a, 0xe8, 0xe9, 0x00, 0x90, 0x38, 0xa8, 0x3c, 0x54,
+    0xbf, 0xff, 0x03, 0x21, 0x25, 0x0e, 0x80, 0x08, 0x10, 0x90, 0xc4, 0x81, 0x34, 0xec, 0xf4, 0x02,
+    0x30, 0xc8, 0x81, 0x46, 0x32, 0xe4, 0x39, 0x42, 0x80, 0x01, 0x04, 0x7c, 0x9f, 0xff, 0x38, 0x00,
+    0x20, 0x30, 0x80, 0x08, 0x20, 0x00, 0x83, 0xe8, 0x32, 0xe4, 0x39, 0xf6, 0x80, 0x01, 0x56, 0xd0,
+    0x27, 0x60, 0x27, 0xe0, 0x39, 0xe8, 0x2c, 0x08, 0xbf, 0xff, 0x20, 0xe0, 0x9c, 0xff, 0x34, 0xd0,
+    0x12, 0x91, 0x38, 0xe8, 0x28, 0x08, 0xbf, 0xff, 0xdc, 0x02, 0x00, 0x91, 0x3a, 0xc8, 0x24, 0x00,
+    0xbf, 0xff, 0x10, 0x90, 0x39, 0xc8, 0x30, 0x00, 0xbf, 0xff, 0xdc, 0x80, 0x01, 0x90, 0x38, 0xc8,
+    0x30, 0x08, 0xbf, 0xff, 0xc0, 0x82, 0x00, 0x08, 0xf3, 0x80, 0x00, 0x40, 0x40, 0x92, 0x51, 0x91,
+    0x0c, 0x01, 0xa0, 0x01, 0x80, 0x37, 0x12, 0x90, 0xc1, 0x83, 0x35, 0x1a, 0x8f, 0xff, 0x30, 0xfa,
+    0x39, 0xc8, 0x30, 0x00, 0xbf, 0xff, 0x84, 0x25, 0x22, 0x20, 0x80, 0x00, 0x38, 0xc8, 0x30, 0x08,
+    0xbf, 0xff, 0x79, 0x61, 0x65, 0x6a, 0x84, 0x15, 0x53, 0x91, 0x0c, 0x03, 0xa0, 0x01, 0x80, 0x0d,
+    0x53, 0x90, 0x37, 0x1b, 0x8f, 0xff, 0x70, 0xfb, 0x81, 0xeb, 0x39, 0xc8, 0x30, 0x00, 0xbf, 0xff,
+    0x38, 0xc8, 0x34, 0x00, 0xbf, 0xff, 0x40, 0x91, 0x11, 0x90, 0x38, 0xc8, 0x34, 0x08, 0xbf, 0xff,
+    0x0c, 0x01, 0xa0, 0x01, 0x80, 0x37, 0x12, 0x90, 0xc1, 0x83, 0x35, 0x1a, 0x8f, 0xff, 0x30, 0xfa,
+    0x39, 0xc8, 0x34, 0x00, 0xbf, 0xff, 0x84, 0x25, 0x22, 0x20, 0x80, 0x00, 0x38, 0xc8, 0x34, 0x08,
+    0xbf, 0xff, 0x79, 0x61, 0x65, 0x6a, 0x84, 0x15, 0x53, 0x91, 0x0c, 0x03, 0x00, 0x08, 0xf4, 0x00,
+    0x00, 0x40, 0xa0, 0x01, 0x80, 0x0d, 0x53, 0x90, 0x37, 0x1b, 0x8f, 0xff, 0x70, 0xfb, 0x81, 0xeb,
+    0x39, 0xc8, 0x34, 0x00, 0xbf, 0xff, 0x38, 0x00, 0x20, 0x30, 0x80, 0x08, 0x00, 0x91, 0xc1, 0xfe,
+    0x10, 0xd0, 0x38, 0x00, 0x20, 0x34, 0x80, 0x08, 0xdc, 0x80, 0x24, 0xe1, 0xc0, 0x8a, 0x34, 0x71,
+    0x80, 0x00, 0x84, 0x2d, 0x32, 0xe4, 0x3b, 0xd0, 0x80, 0x01, 0x47, 0x10, 0x37, 0x78, 0x27, 0xe0,
+    0x38, 0xe8, 0x3c, 0x0c, 0xbf, 0xff, 0x27, 0x69, 0x34, 0x57, 0x31, 0xf1, 0x3f, 0xff, 0xbf, 0xff,
+    0x84, 0x0f, 0x52, 0x90, 0xdc, 0x82, 0x32, 0xe4, 0x20, 0x86, 0x80, 0x08, 0x41, 0x90, 0x27, 0x60,
+    0xe7, 0x68, 0x30, 0x24, 0x3f, 0x50, 0x80, 0x09, 0x74, 0x56, 0x2b, 0xff, 0x99, 0x29, 0x38, 0x08,
+    0x29, 0xf4, 0xbf, 0xf8, 0x30, 0xd9, 0x33, 0xc4, 0xb1, 0xe2, 0x00, 0x90, 0x38, 0x08, 0x29, 0xd4,
+    0xbf, 0xf8, 0x00, 0x08, 0xf4, 0x80, 0x00, 0x40, 0x01, 0x07, 0x3a, 0x4c, 0x80, 0x0a, 0x00, 0x07,
+    0x3a, 0x4a, 0x80, 0x0a, 0xd8, 0x91, 0xdc, 0x19, 0x00, 0x90, 0x38, 0x08, 0x29, 0xb4, 0xbf, 0xf8,
+    0x01, 0x07, 0x3a, 0x50, 0x80, 0x0a, 0x00, 0x07, 0x3a, 0x88, 0x80, 0x0a, 0xd8, 0x91, 0xdc, 0x19,
+    0x00, 0x90, 0x38, 0x08, 0x29, 0x94, 0xbf, 0xf8, 0x09, 0x07, 0x3a, 0x4e, 0x80, 0x0a, 0x09, 0x90,
+    0xc2, 0x81, 0x36, 0x52, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0xe7, 0x48, 0x10, 0x00, 0x80, 0x9e,
+    0x2c, 0x7c, 0xc6, 0x90, 0x75, 0x54, 0x32, 0xe4, 0x39, 0xd2, 0x80, 0x01, 0x6e, 0x7d, 0x3e, 0x16,
+    0x8f, 0xa0, 0x32, 0xe4, 0x3c, 0x4e, 0x80, 0x01, 0x74, 0xd6, 0x21, 0x00, 0x83, 0xe7, 0xd4, 0x41,
+    0x21, 0x00, 0x83, 0xe8, 0x32, 0xe4, 0x3c, 0x4e, 0x80, 0x01, 0x64, 0x60, 0x2d, 0x10, 0xca, 0x40,
+    0x3b, 0xe8, 0x38, 0x14, 0xbf, 0xff, 0xea, 0x61, 0x00, 0x08, 0xf5, 0x00, 0x00, 0x40, 0x14, 0x93,
+    0xfa, 0x04, 0x21, 0xe0, 0x9f, 0x00, 0xdc, 0x84, 0x14, 0xfc, 0x9f, 0xf8, 0xde, 0x19, 0xea, 0xeb,
+    0x04, 0x92, 0x38, 0xe8, 0x2c, 0x08, 0xbf, 0xff, 0x02, 0x21, 0x25, 0x0e, 0x80, 0x08, 0x11, 0x90,
+    0x39, 0xe8, 0x28, 0x08, 0xbf, 0xff, 0x20, 0xe0, 0x9c, 0xff, 0x35, 0xd0, 0xdc, 0x01, 0x00, 0x90,
+    0x3b, 0xc8, 0x24, 0x00, 0xbf, 0xff, 0x10, 0x91, 0x3a, 0xc8, 0x30, 0x00, 0xbf, 0xff, 0xdd, 0x80,
+    0x03, 0x91, 0x38, 0xc8, 0x30, 0x08, 0xbf, 0xff, 0xc0, 0x82, 0x40, 0x93, 0x51, 0x92, 0x0c, 0x01,
+    0xa0, 0x01, 0x80, 0x37, 0x12, 0x90, 0xc1, 0x83, 0x35, 0x1a, 0x8f, 0xff, 0x30, 0xfa, 0x39, 0xc8,
+    0x30, 0x00, 0xbf, 0xff, 0x84, 0x25, 0x22, 0x20, 0x80, 0x00, 0x38, 0xc8, 0x30, 0x08, 0xbf, 0xff,
+    0x79, 0x61, 0x65, 0x6a, 0x84, 0x15, 0x53, 0x91, 0x0c, 0x03, 0xa0, 0x01, 0x80, 0x0d, 0x00, 0x08,
+    0xf5, 0x80, 0x00, 0x40, 0x53, 0x90, 0x37, 0x1b, 0x8f, 0xff, 0x70, 0xfb, 0x81, 0xeb, 0x39, 0xc8,
+    0x30, 0x00, 0xbf, 0xff, 0x38, 0xc8, 0x34, 0x00, 0xbf, 0xff, 0x40, 0x91, 0x11, 0x90, 0x38, 0xc8,
+    0x34, 0x08, 0xbf, 0xff, 0x0c, 0x01, 0xa0, 0x01, 0x80, 0x37, 0x12, 0x90, 0xc1, 0x83, 0x35, 0x1a,
+    0x8f, 0xff, 0x30, 0xfa, 0x39, 0xc8, 0x34, 0x00, 0xbf, 0xff, 0x84, 0x25, 0x22, 0x20, 0x80, 0x00,
+    0x38, 0xc8, 0x34, 0x08, 0xbf, 0xff, 0x79, 0x61, 0x65, 0x6a, 0x84, 0x15, 0x53, 0x91, 0x0c, 0x03,
+    0xa0, 0x01, 0x80, 0x0d, 0x53, 0x90, 0x37, 0x1b, 0x8f, 0xff, 0x70, 0xfb, 0x81, 0xeb, 0x2c, 0x90,
+    0x39, 0xc8, 0x34, 0x00, 0xbf, 0xff, 0x97, 0x52, 0x00, 0x91, 0x38, 0x28, 0x20, 0x00, 0xbf, 0xff,
+    0x90, 0xc0, 0x92, 0xc8, 0x41, 0x98, 0x20, 0x00, 0x81, 0x00, 0xc8, 0x40, 0x90, 0xc0, 0x98, 0x63,
+    0x30, 0x24, 0x3f, 0x50, 0x00, 0x08, 0xf6, 0x00, 0x00, 0x40, 0x80, 0x09, 0x2c, 0x10, 0xe7, 0x68,
+    0x38, 0x00, 0x20, 0x32, 0x80, 0x08, 0x39, 0x00, 0x20, 0x34, 0x80, 0x08, 0x18, 0xd0, 0x3b, 0x00,
+    0x20, 0x3e, 0x80, 0x08, 0x10, 0xd1, 0x39, 0x00, 0x20, 0x32, 0x80, 0x08, 0x11, 0xd3, 0xe7, 0x48,
+    0x2a, 0x80, 0x80, 0x01, 0x78, 0xc1, 0x01, 0x13, 0xea, 0xf8, 0xea, 0xa8, 0xca, 0xff, 0x84, 0x0a,
+    0x4a, 0x11, 0x6c, 0x10, 0x88, 0x52, 0xf0, 0x04, 0x29, 0x80, 0x80, 0x02, 0x90, 0xc0, 0xe9, 0xf8,
+    0xe9, 0xa8, 0x84, 0x09, 0x2b, 0xff, 0x97, 0x4d, 0x8f, 0xed, 0x29, 0x80, 0x80, 0x05, 0x90, 0xc0,
+    0xe9, 0xf8, 0xe9, 0xa8, 0x84, 0x0b, 0x2a, 0xff, 0x98, 0x05, 0x6c, 0x10, 0x88, 0x2b, 0x29, 0x80,
+    0x80, 0x09, 0x90, 0xc0, 0xe9, 0xf8, 0xe9, 0xa8, 0x84, 0x09, 0x2b, 0xff, 0x9b, 0xf7, 0x8f, 0xc7,
+    0x29, 0x80, 0x80, 0x0a, 0x90, 0xc0, 0xe9, 0xf8, 0xe9, 0xa8, 0x00, 0x08, 0xf6, 0x80, 0x00, 0x40,
+    0x84, 0x09, 0x2b, 0xff, 0x9d, 0xe7, 0x8f, 0xb5, 0x18, 0x04, 0xa0, 0x08, 0x2c, 0x10, 0x39, 0x00,
+    0x20, 0x34, 0x80, 0x08, 0x38, 0x00, 0x20, 0x32, 0x80, 0x08, 0x11, 0xfc, 0x9f, 0xf8, 0x01, 0x11,
+    0xe7, 0x68, 0x9f, 0x70, 0x40, 0x10, 0x90, 0xc0, 0x94, 0xc0, 0x96, 0x20, 0x97, 0x20, 0x94, 0xc0,
+    0x9e, 0x20, 0x9f, 0x20, 0x96, 0xc0, 0x5d, 0x98, 0x2a, 0x03, 0x80, 0x6c, 0x19, 0x98, 0x10, 0x05,
+    0xa0, 0x3f, 0x5a, 0x98, 0x5c, 0x98, 0x34, 0x20, 0xa0, 0x00, 0x53, 0x18, 0x36, 0x00, 0xa0, 0x04,
+    0x7d, 0xe2, 0xee, 0xec, 0x34, 0x20, 0xa0, 0x00, 0x9a, 0x43, 0x54, 0x5a, 0x55, 0x5a, 0x56, 0x5a,
+    0x57, 0x5a, 0x34, 0x20, 0xa0, 0x00, 0x50, 0x52, 0x10, 0x59, 0x53, 0x5c, 0x36, 0x00, 0xa0, 0x04,
+    0x63, 0xa0, 0x51, 0x59, 0x38, 0x00, 0xa0, 0x0c, 0x63, 0x24, 0x63, 0x8d, 0x52, 0x5c, 0x38, 0x00,
+    0x00, 0x08, 0xf7, 0x00, 0x00, 0x40, 0xa0, 0x0c, 0x63, 0x01, 0x63, 0x8a, 0x52, 0x59, 0x34, 0x20,
+    0xa0, 0x00, 0x55, 0x5c, 0x3a, 0x00, 0xa2, 0x1d, 0x62, 0xa8, 0x63, 0x0e, 0x63, 0xc1, 0x53, 0x59,
+    0x34, 0x20, 0xa0, 0x00, 0x54, 0x5c, 0x3a, 0x00, 0xa2, 0x3f, 0x62, 0x2c, 0x62, 0x85, 0x63, 0x40,
+    0x63, 0xd7, 0x34, 0x00, 0xa8, 0x44, 0x63, 0xe3, 0x3c, 0x20, 0xa2, 0x0d, 0x62, 0x09, 0x62, 0x82,
+    0x6b, 0x6b, 0x50, 0x59, 0x97, 0x2d, 0x34, 0x00, 0xa8, 0x44, 0x6f, 0x5e, 0x3c, 0x20, 0xa2, 0x1d,
+    0x63, 0xa0, 0x62, 0x06, 0x62, 0xc3, 0x51, 0x59, 0x96, 0x2d, 0x3a, 0x00, 0xa2, 0x3f, 0x63, 0x24,
+    0x63, 0x8d, 0x62, 0x42, 0x62, 0xdf, 0x34, 0x00, 0xa8, 0x44, 0x62, 0xe2, 0x3c, 0x30, 0xa0, 0x1d,
+    0x63, 0x01, 0x63, 0x8a, 0x62, 0x5b, 0x52, 0x59, 0x95, 0x2d, 0x34, 0x00, 0xa8, 0x44, 0x6e, 0x54,
+    0x3c, 0x20, 0xa2, 0x1d, 0x62, 0xa8, 0x00, 0x08, 0xf7, 0x80, 0x00, 0x40, 0x63, 0x0e, 0x63, 0xc1,
+    0x53, 0x59, 0x94, 0x2d, 0xec, 0xee, 0x08, 0xf1, 0x9f, 0xf6, 0x96, 0xc0, 0x90, 0x2c, 0x09, 0xf1,
+    0x9f, 0xf4, 0x96, 0xc0, 0x91, 0x2c, 0x08, 0xf5, 0x9f, 0xfc, 0x96, 0xc0, 0x90, 0x2c, 0x09, 0xf5,
+    0x9f, 0xfe, 0x99, 0x3c, 0x94, 0xc0, 0x9e, 0x21, 0x9f, 0x21, 0x94, 0xc0, 0x96, 0x21, 0x97, 0x21,
+    0x94, 0xc0, 0x9f, 0x70, 0xf3, 0xc1, 0xc5, 0x63, 0x3c, 0x47, 0xe7, 0x48, 0xf0, 0x42, 0xf0, 0xc2,
+    0xe7, 0x68, 0x9f, 0x71, 0x24, 0x68, 0x75, 0xd0, 0x92, 0xc2, 0x6d, 0x10, 0x94, 0xc7, 0x64, 0xe8,
+    0xc2, 0xff, 0x92, 0xc2, 0x6c, 0x10, 0x32, 0xe4, 0x3d, 0x62, 0x80, 0x01, 0x92, 0xc3, 0xc0, 0xff,
+    0xc3, 0x98, 0x65, 0xe8, 0x92, 0xc2, 0x6d, 0x10, 0x32, 0xe4, 0x3d, 0x86, 0x80, 0x01, 0x92, 0xc3,
+    0xc2, 0xff, 0x74, 0x51, 0x9f, 0x70, 0x64, 0x61, 0x31, 0x24, 0x3f, 0x30, 0x00, 0x08, 0xf8, 0x00,
+    0x00, 0x40, 0x80, 0x09, 0x83, 0xfb, 0x2c, 0x10, 0x2d, 0x10, 0xc1, 0x88, 0x40, 0x10, 0x28, 0x09,
+    0x80, 0x04, 0x28, 0x0a, 0x80, 0x1c, 0x28, 0x08, 0x80, 0x38, 0x2b, 0x02, 0x80, 0x1c, 0x2a, 0x02,
+    0x80, 0x0e, 0x02, 0x38, 0xeb, 0xea, 0x97, 0x44, 0x90, 0xc0, 0x92, 0xc8, 0x42, 0x9b, 0x97, 0x46,
+    0xeb, 0xe9, 0x92, 0xc8, 0x42, 0x9b, 0x83, 0x88, 0x30, 0x00, 0x20, 0x00, 0x81, 0x00, 0x38, 0xe1,
+    0x74, 0x40, 0x24, 0xea, 0x40, 0xb1, 0x81, 0xdc, 0x2a, 0x0a, 0x80, 0x38, 0x06, 0x04, 0x38, 0x70,
+    0x80, 0x0a, 0xd3, 0x28, 0x84, 0x09, 0x88, 0x0e, 0x20, 0x00, 0x88, 0x31, 0xd3, 0x30, 0x84, 0x0d,
+    0x20, 0x00, 0x84, 0x18, 0x00, 0x02, 0x3d, 0x14, 0x80, 0x0a, 0x31, 0x20, 0x3f, 0x6c, 0x83, 0x24,
+    0x83, 0x5a, 0x30, 0x00, 0x20, 0x00, 0x82, 0x00, 0x83, 0x52, 0x01, 0x06, 0x3d, 0x14, 0x80, 0x0a,
+    0x2c, 0x10, 0x00, 0x08, 0xf8, 0x80, 0x00, 0x40, 0x00, 0x02, 0x3d, 0x10, 0x80, 0x0a, 0x3e, 0x16,
+    0x81, 0xf4, 0x30, 0x24, 0x3f, 0x50, 0x80, 0x09, 0x06, 0x00, 0x3d, 0x1c, 0x80, 0x0a, 0x83, 0x67,
+    0xea, 0xe8, 0x10, 0x12, 0xe7, 0x50, 0x64, 0x69, 0x24, 0x18, 0x81, 0x9a, 0x92, 0xc2, 0x6c, 0x10,
+    0xf6, 0xcb, 0x36, 0x16, 0x80, 0x40, 0x84, 0xaf, 0x2a, 0x0b, 0x80, 0x04, 0x2a, 0x0e, 0x80, 0x2c,
+    0x2a, 0x0f, 0x80, 0x1c, 0x2a, 0x0c, 0x80, 0x36, 0x2a, 0x0a, 0x80, 0x38, 0xc7, 0x88, 0x50, 0x12,
+    0x10, 0x14, 0xd0, 0x21, 0x84, 0x63, 0x10, 0x96, 0xd0, 0x29, 0x80, 0x3f, 0xf9, 0x41, 0xfb, 0x42,
+    0xfc, 0x43, 0xfa, 0x44, 0x38, 0x00, 0x3c, 0xd8, 0x80, 0x0a, 0x06, 0x00, 0x3c, 0xe8, 0x80, 0x0a,
+    0x0f, 0x02, 0x3c, 0xe4, 0x80, 0x0a, 0x0b, 0x02, 0x3c, 0xe0, 0x80, 0x0a, 0x09, 0x02, 0x3c, 0xdc,
+    0x80, 0x0a, 0x32, 0x04, 0x32, 0x3c, 0x80, 0x09, 0x00, 0x08, 0xf9, 0x00, 0x00, 0x40, 0x09, 0x02,
+    0x3c, 0xd8, 0x80, 0x0a, 0xf9, 0xc1, 0xfb, 0xc2, 0xfc, 0xc3, 0x88, 0x22, 0xfa, 0xc4, 0x27, 0x6a,
+    0xe8, 0xe9, 0x84, 0x1b, 0x2b, 0x03, 0x80, 0x06, 0x9b, 0x46, 0x51, 0x50, 0x61, 0x74, 0x6d, 0x74,
+    0x7d, 0x48, 0x65, 0x65, 0x92, 0xd0, 0x7d, 0x48, 0x75, 0x5a, 0x42, 0x58, 0x7b, 0xe1, 0x67, 0xea,
+    0x2a, 0x0a, 0x80, 0x38, 0x2c, 0x0c, 0x80, 0x38, 0x2f, 0x0f, 0x80, 0x38, 0x2e, 0x0e, 0x80, 0x38,
+    0x81, 0x84, 0x2b, 0x0b, 0x80, 0x38, 0x30, 0x01, 0x3a, 0x9c, 0x80, 0x0a, 0x00, 0x02, 0x3c, 0xdc,
+    0x80, 0x0a, 0x88, 0xe4, 0x00, 0x02, 0x3c, 0xd8, 0x80, 0x0a, 0x27, 0x6a, 0x3b, 0x00, 0x3a, 0x9c,
+    0x80, 0x0a, 0x84, 0x0f, 0x9f, 0x46, 0xe8, 0xe9, 0x90, 0xc0, 0x92, 0xd0, 0x50, 0x58, 0x40, 0x9b,
+    0x2a, 0x0c, 0x80, 0x04, 0x2c, 0x0e, 0x80, 0x18, 0x2e, 0x0f, 0x80, 0x1a, 0x2f, 0x0b, 0x00, 0x08,
+    0xf9, 0x80, 0x00, 0x40, 0x80, 0x02, 0xc7, 0x88, 0x50, 0x13, 0x10, 0x17, 0xd0, 0x21, 0x84, 0x35,
+    0xd0, 0x29, 0x80, 0x31, 0xf9, 0x41, 0xfa, 0x42, 0xfc, 0x43, 0xfb, 0x44, 0x38, 0x00, 0x3c, 0xd8,
+    0x80, 0x0a, 0x06, 0x00, 0x3c, 0xe8, 0x80, 0x0a, 0x0e, 0x02, 0x3c, 0xe4, 0x80, 0x0a, 0x32, 0x04,
+    0x33, 0x88, 0x80, 0x09, 0x0c, 0x02, 0x3c, 0xe0, 0x80, 0x0a, 0xf9, 0xc1, 0xfa, 0xc2, 0xfc, 0xc3,
+    0xfb, 0xc4, 0x7b, 0xe1, 0x67, 0xea, 0x2b, 0x0b, 0x80, 0x38, 0x2f, 0x0f, 0x80, 0x38, 0x2e, 0x0e,
+    0x80, 0x38, 0x81, 0xb6, 0x2c, 0x0c, 0x80, 0x38, 0x27, 0x6a, 0xeb, 0xe9, 0x84, 0x13, 0x9f, 0x46,
+    0x38, 0x00, 0x3a, 0x9c, 0x80, 0x0a, 0x90, 0xc0, 0x92, 0xd0, 0x50, 0x98, 0x40, 0x5b, 0x2a, 0x0c,
+    0x80, 0x2c, 0x92, 0x48, 0x2a, 0x03, 0x80, 0x14, 0x2b, 0x03, 0x80, 0x26, 0x2c, 0x08, 0x80, 0x0a,
+    0x2b, 0x02, 0x80, 0x1c, 0x00, 0x08, 0xfa, 0x00, 0x00, 0x40, 0x28, 0x0a, 0x80, 0x02, 0x50, 0x3a,
+    0x10, 0x10, 0xd0, 0x21, 0x84, 0x23, 0x10, 0x94, 0xd0, 0x29, 0x84, 0x1d, 0x27, 0x6a, 0xeb, 0xe9,
+    0x84, 0x17, 0x9b, 0x46, 0x51, 0x53, 0x61, 0x74, 0x6d, 0x74, 0x7d, 0x48, 0x65, 0x65, 0x92, 0xd0,
+    0x7d, 0x48, 0x75, 0x5a, 0x42, 0x5b, 0x94, 0xd0, 0x28, 0x08, 0x80, 0x38, 0x2c, 0x0c, 0x80, 0x38,
+    0x90, 0xc0, 0x6c, 0x10, 0x30, 0x24, 0x3f, 0x50, 0x80, 0x09, 0xe7, 0x70, 0xc2, 0x98, 0x2c, 0x98,
+    0xe7, 0x48, 0xd4, 0x11, 0xf0, 0x42, 0xf0, 0xc2, 0xe7, 0x68, 0x9f, 0x71, 0x33, 0x24, 0x3f, 0x30,
+    0x80, 0x09, 0x24, 0x68, 0x37, 0x51, 0x34, 0xd0, 0xc2, 0x98, 0x94, 0xc6, 0x75, 0xd2, 0x6c, 0x10,
+    0x94, 0xc7, 0x65, 0x68, 0xc0, 0xff, 0x92, 0xc2, 0x6d, 0x10, 0x32, 0xe4, 0x3d, 0x8c, 0x80, 0x01,
+    0x92, 0xc3, 0xc2, 0xff, 0x27, 0x68, 0x75, 0xd6, 0x92, 0xc2, 0x00, 0x08, 0xfa, 0x80, 0x00, 0x40,
+    0x6d, 0x10, 0x32, 0xe4, 0x3d, 0x74, 0x80, 0x01, 0x92, 0xc3, 0xc2, 0xff, 0x74, 0x51, 0x30, 0x24,
+    0x3f, 0x50, 0x80, 0x09, 0x64, 0x61, 0x2b, 0xff, 0x9d, 0x67, 0x27, 0x08, 0x80, 0x28, 0x97, 0x47,
+    0xe7, 0xe8, 0x39, 0x00, 0x3c, 0xbc, 0x80, 0x0a, 0x27, 0xe8, 0x9f, 0xe0, 0x92, 0xd0, 0x50, 0x99,
+    0x40, 0x98, 0x2c, 0x90, 0x30, 0x00, 0x20, 0x05, 0x8a, 0x00, 0xce, 0x41, 0x31, 0x00, 0x20, 0x00,
+    0x82, 0x00, 0x34, 0x40, 0xce, 0x4a, 0x30, 0x71, 0x79, 0x41, 0x81, 0xf8, 0xce, 0x42, 0x32, 0x00,
+    0x20, 0x00, 0x81, 0x00, 0x6f, 0x32, 0x83, 0x7c, 0x34, 0x56, 0xd4, 0xc6, 0x2a, 0xff, 0x9c, 0xed,
+    0x34, 0xd0, 0x77, 0xd0, 0x2a, 0xff, 0x9c, 0xe5, 0x34, 0xd0, 0xcf, 0x40, 0xf0, 0x49, 0x2a, 0xff,
+    0x9c, 0xdb, 0xf1, 0xc3, 0x35, 0x50, 0xf1, 0xc9, 0x34, 0x51, 0xf1, 0xc5, 0x2a, 0xff, 0x9c, 0xcd,
+    0x00, 0x08, 0xfb, 0x00, 0x00, 0x40, 0x6c, 0xd8, 0x35, 0x50, 0xf1, 0xc9, 0x34, 0x51, 0xf1, 0xc7,
+    0x2a, 0xff, 0x9c, 0xbf, 0x6c, 0xd8, 0xf1, 0xc9, 0x34, 0x51, 0xf0, 0x4a, 0x2a, 0xff, 0x9c, 0xb3,
+    0xf1, 0xc2, 0x35, 0x50, 0xf1, 0xc9, 0x34, 0x51, 0xf1, 0xc4, 0x2a, 0xff, 0x9c, 0xa5, 0x6c, 0xd8,
+    0x35, 0x50, 0xf1, 0xc9, 0x34, 0x51, 0xf1, 0xc6, 0x2a, 0xff, 0x9c, 0x97, 0x6c, 0xd8, 0x35, 0x50,
+    0xcf, 0x49, 0x34, 0x51, 0xf1, 0xc8, 0x2a, 0xff, 0x9c, 0x89, 0x6c, 0xd8, 0x35, 0x50, 0xf1, 0xca,
+    0x2d, 0x58, 0xce, 0x49, 0x3c, 0xd8, 0x30, 0x60, 0x32, 0x18, 0x80, 0xb1, 0xf1, 0x41, 0xf1, 0xc1,
+    0x2a, 0xff, 0x9c, 0x6f, 0xce, 0x42, 0xce, 0x4a, 0x2c, 0x8a, 0x35, 0x50, 0x74, 0x57, 0x2a, 0xff,
+    0x9c, 0x61, 0x6f, 0x4a, 0x27, 0xe8, 0x9f, 0xd8, 0x30, 0x24, 0x3f, 0x50, 0x80, 0x09, 0x2c, 0x02,
+    0xe7, 0xe8, 0x2b, 0xff, 0x9c, 0x81, 0x00, 0x08, 0xfb, 0x80, 0x00, 0x40, 0xe7, 0x50, 0x01, 0x06,
+    0x3d, 0x08, 0x80, 0x0a, 0x02, 0x06, 0x3d, 0x0c, 0x80, 0x0a, 0xf1, 0x44, 0xf2, 0x43, 0x31, 0x60,
+    0x3e, 0xd8, 0x86, 0x48, 0x32, 0xe4, 0x3c, 0x5a, 0x80, 0x01, 0xc6, 0x81, 0x24, 0x68, 0x37, 0xd0,
+    0x30, 0x60, 0x3e, 0xd8, 0x86, 0x48, 0x80, 0x05, 0xd7, 0xc0, 0x30, 0x00, 0x3f, 0xb6, 0x81, 0x92,
+    0x33, 0xf0, 0x30, 0x20, 0x3f, 0x6c, 0x83, 0x24, 0x84, 0x0b, 0x73, 0xf0, 0x84, 0x36, 0x92, 0xc3,
+    0x6f, 0xa3, 0x31, 0x20, 0x3f, 0x6c, 0x83, 0x24, 0x33, 0xf1, 0x30, 0x40, 0x3f, 0x22, 0x84, 0xb6,
+    0x84, 0x0f, 0x73, 0xf0, 0x92, 0xc3, 0x6f, 0x87, 0x84, 0x1a, 0x92, 0xc3, 0xc6, 0xff, 0x30, 0x40,
+    0x3f, 0x22, 0x84, 0xb6, 0x33, 0xf0, 0x30, 0x60, 0x3e, 0xd8, 0x86, 0x48, 0x84, 0x07, 0x2f, 0xa3,
+    0xc6, 0xff, 0x2a, 0xff, 0x9b, 0xd3, 0x34, 0xd7, 0x74, 0x57, 0x35, 0x50, 0x00, 0x08, 0xfc, 0x00,
+    0x00, 0x40, 0xf0, 0xc4, 0x2a, 0xff, 0x9b, 0xc7, 0x34, 0xd2, 0xce, 0x42, 0xce, 0x4a, 0x34, 0xd2,
+    0xf2, 0xc3, 0x2a, 0xff, 0x9b, 0xb9, 0x6c, 0x32, 0x34, 0xd7, 0x32, 0x00, 0x20, 0x00, 0x81, 0x00,
+    0x2a, 0xff, 0x9b, 0xab, 0xd4, 0x42, 0x34, 0xc2, 0x80, 0x00, 0x30, 0xc2, 0x80, 0x00, 0x36, 0xc1,
+    0x80, 0x00, 0xd8, 0x12, 0xd4, 0x41, 0xf0, 0x42, 0xf0, 0xc2, 0x30, 0x24, 0x3f, 0x50, 0x80, 0x09,
+    0xe7, 0x70, 0x2b, 0xff, 0x9b, 0xbd, 0x24, 0x68, 0x35, 0x50, 0x2f, 0x10, 0xe7, 0x48, 0xc7, 0x98,
+    0x84, 0x84, 0x92, 0xc3, 0xc0, 0xff, 0x25, 0x69, 0x30, 0x00, 0x20, 0x00, 0x81, 0x00, 0x80, 0x75,
+    0x70, 0x62, 0x80, 0x71, 0x70, 0x72, 0x84, 0x11, 0x34, 0xd2, 0xd5, 0x26, 0x84, 0x0b, 0x2a, 0xff,
+    0x9d, 0xe7, 0xc6, 0x81, 0x75, 0x50, 0x30, 0x00, 0x20, 0x00, 0x81, 0x00, 0x31, 0x70, 0x74, 0x52,
+    0x84, 0x0d, 0x00, 0x08, 0xfc, 0x80, 0x00, 0x40, 0x6f, 0x90, 0x3c, 0x62, 0x7b, 0xc1, 0x64, 0x6a,
+    0x81, 0xfb, 0x27, 0xea, 0x35, 0xc2, 0x6e, 0x10, 0x84, 0x2a, 0x79, 0xc1, 0x25, 0xe9, 0x34, 0xd3,
+    0xce, 0x42, 0x80, 0x38, 0x94, 0xc6, 0xcf, 0x43, 0x6c, 0x10, 0x2a, 0xff, 0x9d, 0xb1, 0x34, 0x52,
+    0xf4, 0x41, 0xf4, 0xc1, 0x3a, 0x41, 0xcf, 0x4b, 0x33, 0xf4, 0x2c, 0x53, 0xce, 0x4a, 0x81, 0xde,
+    0x75, 0xc0, 0x27, 0x69, 0x34, 0xd3, 0x30, 0x00, 0x20, 0x00, 0x81, 0x00, 0x80, 0x09, 0x2b, 0xff,
+    0x9d, 0x8d, 0x88, 0x09, 0x88, 0x06, 0x74, 0x53, 0x74, 0x52, 0x30, 0x24, 0x3f, 0x50, 0x80, 0x09,
+    0xe7, 0x68, 0x2b, 0xff, 0x9b, 0x23, 0x2c, 0x90, 0xee, 0xe8, 0x27, 0x09, 0x80, 0x48, 0x12, 0x06,
+    0x80, 0x30, 0x34, 0x52, 0xe7, 0xe9, 0x2a, 0xff, 0x9d, 0x55, 0xf2, 0x4f, 0x35, 0xd0, 0xc1, 0x88,
+    0x2a, 0xff, 0x9d, 0x4b, 0x10, 0x06, 0x80, 0x2e, 0x00, 0x08, 0xfd, 0x00, 0x00, 0x40, 0x2a, 0xff,
+    0x9a, 0xc9, 0x37, 0x50, 0x34, 0x53, 0x01, 0x06, 0x3d, 0x18, 0x80, 0x0a, 0x24, 0x69, 0x77, 0xd0,
+    0x90, 0xc0, 0x96, 0xc2, 0x30, 0x00, 0x20, 0x00, 0x81, 0x00, 0x24, 0x18, 0x81, 0x02, 0x92, 0xc2,
+    0xf0, 0x50, 0x2a, 0xff, 0x9d, 0x73, 0x30, 0x00, 0x20, 0x05, 0x8a, 0x00, 0x2a, 0xff, 0x9a, 0x9b,
+    0x74, 0xd7, 0x35, 0xd0, 0x37, 0xd0, 0x39, 0x00, 0x3c, 0xf4, 0x80, 0x0a, 0x97, 0x45, 0x27, 0xe8,
+    0x9f, 0xe8, 0x92, 0xd0, 0x50, 0x99, 0x40, 0x98, 0x67, 0xe9, 0x90, 0xc0, 0x96, 0xc2, 0x30, 0x00,
+    0x20, 0x00, 0x81, 0x00, 0x80, 0xc8, 0x92, 0xc2, 0xf0, 0x50, 0x27, 0xe8, 0x74, 0x53, 0x80, 0x07,
+    0x88, 0x06, 0x64, 0x64, 0x74, 0x53, 0x31, 0x40, 0x34, 0x77, 0x81, 0x71, 0x2a, 0xff, 0x9a, 0x5b,
+    0xcf, 0x43, 0x27, 0xe8, 0x34, 0x00, 0x20, 0x00, 0x80, 0x80, 0xd4, 0x44, 0x31, 0xef, 0x00, 0x08,
+    0xfd, 0x80, 0x00, 0x40, 0x9f, 0x00, 0x98, 0xc7, 0x31, 0x60, 0x32, 0x18, 0x80, 0xb1, 0x67, 0xe4,
+    0x2a, 0xff, 0x9a, 0x3d, 0x74, 0x57, 0xcf, 0x4b, 0x6c, 0x93, 0x2a, 0xff, 0x9a, 0x33, 0x34, 0x51,
+    0xcf, 0x41, 0xf0, 0x50, 0x2a, 0xff, 0x9a, 0x29, 0xf1, 0xc2, 0x35, 0xd0, 0xf1, 0xd0, 0x34, 0x51,
+    0xf1, 0xc3, 0x2a, 0xff, 0x9a, 0x1b, 0x6c, 0xd9, 0x35, 0xd0, 0xf1, 0xd0, 0x34, 0x51, 0xf1, 0xc4,
+    0x2a, 0xff, 0x9a, 0x0d, 0x6c, 0xd9, 0x35, 0xd0, 0xf1, 0xd0, 0x34, 0x51, 0xf1, 0xc5, 0x2a, 0xff,
+    0x99, 0xff, 0x6c, 0xd9, 0x35, 0xd0, 0xf1, 0xd0, 0x34, 0x51, 0xf1, 0xc6, 0x2a, 0xff, 0x99, 0xf1,
+    0x6c, 0xd9, 0x35, 0xd0, 0xcf, 0x49, 0x34, 0x51, 0x31, 0x00, 0x20, 0x00, 0x82, 0x00, 0x6d, 0xd9,
+    0x2a, 0xff, 0x99, 0xdd, 0xf3, 0x50, 0xf3, 0xd0, 0xcf, 0x49, 0x2a, 0xff, 0x9c, 0x5d, 0x6c, 0x99,
+    0x27, 0xe8, 0x34, 0xd0, 0x00, 0x08, 0xfe, 0x00, 0x00, 0x40, 0x30, 0x00, 0x20, 0x00, 0x81, 0x00,
+    0x80, 0x0c, 0x6c, 0xd1, 0x67, 0xe4, 0x7f, 0xf8, 0x88, 0x08, 0xd4, 0x1f, 0x7f, 0xf8, 0xd4, 0x17,
+    0x2a, 0xff, 0x99, 0xb3, 0x64, 0x61, 0xf0, 0x50, 0x10, 0x06, 0x80, 0x2c, 0xf1, 0xd0, 0x03, 0x06,
+    0x3d, 0x10, 0x80, 0x0a, 0xf1, 0x51, 0x34, 0x61, 0x80, 0x00, 0x30, 0x61, 0x80, 0x00, 0xda, 0x11,
+    0x36, 0x60, 0x80, 0x00, 0xd6, 0x40, 0xf4, 0x46, 0xf0, 0xc6, 0x2a, 0xff, 0x9d, 0x3d, 0xf4, 0x4e,
+    0x37, 0xd0, 0xf4, 0xce, 0x30, 0x00, 0x3f, 0xb6, 0x81, 0x92, 0x2a, 0xff, 0x9d, 0x2d, 0x6c, 0x20,
+    0x2a, 0xff, 0x99, 0x73, 0x37, 0x50, 0x34, 0x56, 0x31, 0x00, 0x20, 0x00, 0x82, 0x00, 0x74, 0xd7,
+    0x2a, 0xff, 0x9b, 0xed, 0x34, 0xd0, 0x74, 0x51, 0x37, 0xd0, 0xc9, 0x8a, 0x2e, 0x08, 0x80, 0x32,
+    0x18, 0x10, 0xf2, 0xcf, 0x90, 0xc0, 0xe8, 0x61, 0xe8, 0x89, 0x00, 0x08, 0xfe, 0x80, 0x00, 0x40,
+    0x25, 0x18, 0x83, 0x10, 0x34, 0x56, 0x2d, 0x90, 0x39, 0x00, 0x3c, 0x90, 0x80, 0x0a, 0x31, 0x18,
+    0x20, 0x00, 0xbe, 0x00, 0xa8, 0xc8, 0x90, 0xc0, 0x98, 0x61, 0x32, 0x00, 0x20, 0x00, 0x81, 0x00,
+    0x6d, 0xaa, 0x35, 0xc3, 0xf3, 0x4b, 0xd5, 0x47, 0xf3, 0x4c, 0xf3, 0x4a, 0x2a, 0xff, 0x99, 0x1d,
+    0xf2, 0x47, 0x31, 0x00, 0x20, 0x00, 0x81, 0x00, 0x8a, 0xd6, 0x2c, 0x27, 0xf0, 0x49, 0x34, 0x56,
+    0x32, 0x00, 0x20, 0x00, 0x81, 0x00, 0x2e, 0x4a, 0x31, 0x18, 0x20, 0x00, 0xbe, 0x00, 0x35, 0xc4,
+    0x66, 0x64, 0xd5, 0x47, 0xf3, 0x4a, 0xf4, 0x4b, 0xf3, 0x4c, 0x2a, 0xff, 0x98, 0xef, 0xf2, 0x47,
+    0x31, 0x00, 0x20, 0x00, 0x81, 0x00, 0x8a, 0xa8, 0x2c, 0x27, 0xf0, 0x49, 0x34, 0xd7, 0x34, 0x56,
+    0x32, 0x00, 0x20, 0x00, 0x81, 0x00, 0x24, 0xe4, 0xd5, 0x47, 0xf1, 0x4a, 0xf7, 0x4c, 0xf3, 0x4b,
+    0x00, 0x08, 0xff, 0x00, 0x00, 0x40, 0xf2, 0x47, 0x2a, 0xff, 0x98, 0xc7, 0x31, 0x18, 0x20, 0x00,
+    0xbe, 0x00, 0x31, 0x00, 0x20, 0x00, 0x81, 0x00, 0x8a, 0x7c, 0x2c, 0x27, 0xf0, 0x49, 0x34, 0x56,
+    0x31, 0x00, 0x20, 0x00, 0x81, 0x00, 0xf1, 0x4c, 0x2a, 0xff, 0x98, 0xa7, 0x31, 0x18, 0x20, 0x00,
+    0xbe, 0x00, 0x35, 0x50, 0x34, 0x56, 0x31, 0x00, 0x20, 0x00, 0x81, 0x00, 0xf1, 0x4a, 0xd4, 0xc7,
+    0xf1, 0x47, 0xf2, 0x4b, 0x2a, 0xff, 0x98, 0x8b, 0x31, 0x18, 0x20, 0x00, 0xbe, 0x00, 0x31, 0x00,
+    0x20, 0x00, 0x81, 0x00, 0x8a, 0x40, 0x2c, 0x27, 0xf0, 0x49, 0x34, 0x56, 0x31, 0x00, 0x20, 0x00,
+    0x81, 0x00, 0x2d, 0x27, 0x31, 0x18, 0x20, 0x00, 0xbe, 0x00, 0xf2, 0x4c, 0x2a, 0xff, 0x98, 0x63,
+    0xcf, 0x42, 0x35, 0x50, 0x34, 0x56, 0x31, 0x00, 0x20, 0x00, 0x81, 0x00, 0x2c, 0xc7, 0xf2, 0x4b,
+    0xf1, 0x4a, 0xf1, 0x47, 0x2a, 0xff, 0x00, 0x08, 0xff, 0x80, 0x00, 0x40, 0x98, 0x4b, 0x31, 0x18,
+    0x20, 0x00, 0xbe, 0x00, 0xcf, 0x4a, 0xf2, 0x48, 0x8a, 0x04, 0xf0, 0x49, 0x2a, 0xff, 0x9a, 0xc3,
+    0x34, 0x57, 0xf1, 0xd1, 0x34, 0xd7, 0xf3, 0xd1, 0x2a, 0xff, 0x98, 0x2d, 0x34, 0x53, 0xcf, 0x40,
+    0x35, 0xd0, 0x34, 0x56, 0x32, 0x00, 0x20, 0x00, 0x81, 0x00, 0x2d, 0x5d, 0x31, 0x18, 0x20, 0x00,
+    0xbe, 0x00, 0x2a, 0xff, 0x98, 0x13, 0xf2, 0x4c, 0x35, 0x50, 0x34, 0xd7, 0xf3, 0xd1, 0x2a, 0xff,
+    0x98, 0x07, 0x34, 0x53, 0xf2, 0x4b, 0x34, 0xd0, 0x34, 0x56, 0x32, 0x00, 0x20, 0x00, 0x81, 0x00,
+    0x2d, 0x98, 0x31, 0x18, 0x20, 0x00, 0xbe, 0x00, 0xf3, 0x4a, 0xcf, 0x4b, 0xd5, 0x43, 0x2a, 0xff,
+    0x97, 0xe7, 0xf2, 0x47, 0xcf, 0x4b, 0x31, 0x00, 0x20, 0x00, 0x81, 0x00, 0x89, 0x9e, 0x2c, 0x39,
+    0xf0, 0x49, 0x2a, 0xff, 0x9c, 0x4b, 0xf0, 0xd1, 0x2a, 0xff, 0x97, 0xcd, 0x00, 0x09, 0x00, 0x00,
+    0x00, 0x40, 0x74, 0xd7, 0xf1, 0xd0, 0x34, 0x56, 0xcf, 0x40, 0x32, 0x00, 0x20, 0x00, 0x81, 0x00,
+    0x2d, 0x38, 0xef, 0xfc, 0x2a, 0xff, 0x97, 0xb7, 0x34, 0xd2, 0xf2, 0x4f, 0x34, 0x56, 0xf0, 0x50,
+    0xf2, 0xcf, 0x36, 0x00, 0x20, 0x00, 0x82, 0x00, 0xd7, 0x42, 0x2a, 0xff, 0x97, 0xa1, 0x74, 0xd6,
+    0x37, 0xd0, 0xf1, 0xd0, 0x2d, 0x06, 0xf3, 0xd1, 0x34, 0x53, 0xcf, 0x49, 0x2a, 0xff, 0x97, 0x8f,
+    0x2c, 0xd8, 0xf2, 0x52, 0x34, 0xd0, 0xf3, 0xd1, 0x34, 0x53, 0xf2, 0xcf, 0x2a, 0xff, 0x97, 0x7f,
+    0x2c, 0xab, 0xf1, 0x4c, 0xc8, 0x40, 0xf3, 0xd1, 0x34, 0x53, 0xf2, 0xd2, 0xcf, 0x49, 0x2c, 0x98,
+    0xe8, 0xfc, 0x2a, 0xff, 0x97, 0x69, 0xf8, 0x4b, 0xf2, 0xcf, 0x2d, 0xcb, 0xf1, 0xd0, 0x2d, 0x46,
+    0x25, 0xe4, 0xcf, 0x49, 0x2c, 0x18, 0x2c, 0xd8, 0x3d, 0xc1, 0xf0, 0x4a, 0xf1, 0x47, 0x89, 0x12,
+    0xf3, 0x49, 0x00, 0x09, 0x00, 0x80, 0x00, 0x40, 0x2a, 0xff, 0x9b, 0xc1, 0xf0, 0xd1, 0x2a, 0xff,
+    0x97, 0x43, 0x74, 0xd7, 0xf1, 0xd0, 0x34, 0x56, 0xcf, 0x40, 0x32, 0x00, 0x20, 0x00, 0x81, 0x00,
+    0x2d, 0x38, 0xef, 0xfc, 0x2a, 0xff, 0x97, 0x2d, 0x34, 0xd2, 0xf2, 0x4f, 0x34, 0x56, 0xf0, 0x50,
+    0xf2, 0xcf, 0x36, 0x00, 0x20, 0x00, 0x82, 0x00, 0xd7, 0x42, 0x2a, 0xff, 0x97, 0x17, 0x74, 0xd6,
+    0x37, 0xd0, 0xf3, 0xd1, 0x34, 0x53, 0xf1, 0xd0, 0x2d, 0xc6, 0xcf, 0x49, 0x2a, 0xff, 0x97, 0x05,
+    0x2c, 0xd9, 0xf3, 0x52, 0x34, 0xd0, 0xf3, 0xd1, 0x34, 0x53, 0xf2, 0xcf, 0x2a, 0xff, 0x96, 0xf5,
+    0x2c, 0xcb, 0xf1, 0x4c, 0xc8, 0x40, 0xc8, 0x4a, 0x3d, 0x41, 0xf3, 0xd1, 0x25, 0x61, 0x34, 0x53,
+    0xf3, 0xd2, 0x25, 0x64, 0xcf, 0x49, 0x2a, 0xff, 0x96, 0xdb, 0x2c, 0x99, 0xf2, 0x4b, 0xf1, 0xd0,
+    0xf2, 0xcf, 0x2d, 0xab, 0x2d, 0x06, 0xcf, 0x49, 0x00, 0x09, 0x01, 0x00, 0x00, 0x40, 0x3d, 0xc1,
+    0x2c, 0x18, 0x2c, 0xd8, 0xf0, 0x4a, 0xf1, 0x47, 0x88, 0x84, 0xf3, 0x49, 0x2c, 0x90, 0xc6, 0xdc,
+    0x2e, 0x7c, 0xc2, 0x98, 0x2e, 0x7d, 0x38, 0x00, 0x3b, 0x9c, 0x80, 0x0a, 0x3d, 0x02, 0x80, 0x24,
+    0x3d, 0x42, 0xf0, 0xd0, 0xc9, 0x42, 0xf0, 0x4c, 0x30, 0x00, 0x20, 0x00, 0x81, 0x00, 0xe9, 0x18,
+    0x10, 0x91, 0xf0, 0x47, 0xf1, 0x4b, 0xf1, 0x4a, 0xf1, 0x49, 0xf1, 0x48, 0x88, 0x52, 0x00, 0x86,
+    0x80, 0x28, 0x2d, 0x90, 0xf0, 0xd0, 0x24, 0x64, 0xf0, 0x4c, 0x31, 0x00, 0x20, 0x00, 0x81, 0x00,
+    0x32, 0x98, 0x2f, 0x5c, 0xbf, 0x02, 0xf0, 0x4b, 0xf3, 0x4a, 0xf1, 0x47, 0xf2, 0x49, 0x88, 0x30,
+    0xf3, 0x48, 0x34, 0x56, 0x32, 0x00, 0x20, 0x00, 0x81, 0x00, 0x2d, 0xaa, 0x31, 0x18, 0x20, 0x00,
+    0xbe, 0x00, 0x35, 0xc3, 0xf3, 0x4b, 0xd5, 0x47, 0xf3, 0x4c, 0xf3, 0x4a, 0x2a, 0xff, 0x00, 0x09,
+    0x01, 0x80, 0x00, 0x40, 0x96, 0x4b, 0xf2, 0x47, 0x31, 0x00, 0x20, 0x00, 0x81, 0x00, 0x2c, 0x27,
+    0xf0, 0x49, 0xf0, 0x48, 0x10, 0x06, 0x80, 0x32, 0xd0, 0x2f, 0x80, 0xa5, 0xf1, 0xc7, 0x3c, 0xc1,
+    0x30, 0x00, 0x20, 0x00, 0x81, 0x00, 0xf1, 0x46, 0x2a, 0xff, 0x98, 0xaf, 0xf1, 0xc6, 0x37, 0x50,
+    0xf0, 0xcc, 0x2a, 0xff, 0x96, 0x1b, 0x74, 0xd6, 0x34, 0xd6, 0xf0, 0x4c, 0x2a, 0xff, 0x96, 0x11,
+    0xf0, 0xcb, 0x35, 0x50, 0x34, 0xd6, 0xf0, 0xca, 0x2a, 0xff, 0x96, 0x05, 0xf2, 0x4b, 0x35, 0x50,
+    0x34, 0xd6, 0xf0, 0xc9, 0x2a, 0xff, 0x95, 0xf9, 0xf2, 0x4a, 0x35, 0x50, 0x34, 0xd6, 0xf0, 0xc8,
+    0x2a, 0xff, 0x95, 0xed, 0xf2, 0x49, 0x35, 0x50, 0x34, 0xd6, 0xf0, 0xc7, 0x2a, 0xff, 0x95, 0xe1,
+    0xf2, 0x48, 0x27, 0xef, 0x9f, 0xd0, 0xc6, 0x86, 0xf0, 0x47, 0x2a, 0xff, 0x95, 0xd3, 0x10, 0x97,
+    0x31, 0x00, 0x20, 0x00, 0x00, 0x09, 0x02, 0x00, 0x00, 0x40, 0x80, 0x20, 0x3b, 0x61, 0x40, 0x9f,
+    0x67, 0x6a, 0x81, 0xef, 0x2a, 0xff, 0x95, 0xb3, 0xf0, 0xcc, 0x34, 0xd0, 0xf0, 0xcb, 0x2a, 0xff,
+    0x95, 0xa9, 0x41, 0x96, 0x34, 0xd0, 0xf0, 0xca, 0x2a, 0xff, 0x95, 0x9f, 0xb1, 0x71, 0x34, 0xd0,
+    0xf0, 0xc9, 0x2a, 0xff, 0x95, 0x95, 0xb1, 0x72, 0x34, 0xd0, 0xf0, 0xc8, 0x2a, 0xff, 0x95, 0x8b,
+    0xb1, 0x73, 0xb0, 0x74, 0x27, 0xe8, 0x9f, 0xb8, 0x30, 0x24, 0x3f, 0x50, 0x80, 0x09, 0x2c, 0x10,
+    0xe7, 0xe8, 0x24, 0xe8, 0xe9, 0xe8, 0x84, 0x7b, 0xd4, 0xa7, 0x80, 0x77, 0x3e, 0x11, 0x80, 0x38,
+    0xc8, 0x41, 0xf1, 0x85, 0xd0, 0xab, 0xe9, 0x44, 0x84, 0x3e, 0xe8, 0x19, 0x02, 0x04, 0x38, 0x70,
+    0x80, 0x0a, 0x20, 0x00, 0x80, 0x64, 0xf4, 0x86, 0x3e, 0x12, 0x80, 0x05, 0x6c, 0x7d, 0x34, 0x43,
+    0x80, 0x04, 0x30, 0x43, 0x80, 0x04, 0x36, 0x40, 0x80, 0x04, 0x00, 0x09, 0x02, 0x80, 0x00, 0x40,
+    0xd9, 0x13, 0xd5, 0x40, 0x35, 0xf2, 0x02, 0x00, 0x80, 0x2c, 0x00, 0x04, 0x3d, 0x1c, 0x80, 0x0a,
+    0x71, 0xf0, 0x80, 0x11, 0x88, 0x0e, 0x02, 0x00, 0x3d, 0x1c, 0x80, 0x0a, 0xf0, 0x86, 0x00, 0x00,
+    0x80, 0x2c, 0x2d, 0x10, 0xf3, 0x87, 0x97, 0x44, 0xf0, 0x88, 0x28, 0x09, 0x80, 0x18, 0x03, 0x00,
+    0x80, 0x2e, 0x00, 0x00, 0x80, 0x30, 0x01, 0x00, 0x80, 0x32, 0x92, 0xc8, 0x42, 0x99, 0x2b, 0xff,
+    0x9a, 0x1d, 0x9f, 0x70, 0x6c, 0x10, 0x9f, 0x70, 0xc0, 0xff, 0x64, 0xe8, 0x84, 0x43, 0x2c, 0x10,
+    0xd4, 0xa7, 0x80, 0x3d, 0x3e, 0x11, 0x80, 0x38, 0xc9, 0x41, 0x28, 0x0a, 0x80, 0x04, 0xe9, 0x1a,
+    0xf1, 0x85, 0x93, 0x48, 0x2b, 0x03, 0x80, 0x0e, 0x01, 0x01, 0x80, 0x34, 0x2a, 0x09, 0x80, 0x34,
+    0x40, 0x10, 0x50, 0x11, 0xd0, 0x21, 0x84, 0x0b, 0xc0, 0x81, 0x40, 0x10, 0x20, 0x03, 0x80, 0x0e,
+    0x00, 0x09, 0x03, 0x00, 0x00, 0x40, 0x94, 0xd0, 0x29, 0x09, 0x80, 0x38, 0x90, 0xc0, 0x90, 0xc0,
+    0x9f, 0x70, 0x6c, 0x10, 0x9f, 0x70, 0xc0, 0xff, 0x2b, 0xff, 0x94, 0xeb, 0x2f, 0x90, 0x16, 0x11,
+    0xc0, 0x88, 0x27, 0x0a, 0x80, 0x28, 0xe7, 0xea, 0xea, 0xe8, 0x28, 0x08, 0x80, 0x04, 0x2a, 0x0b,
+    0x80, 0x18, 0x2a, 0x0e, 0x80, 0x14, 0x2a, 0x0f, 0x80, 0x10, 0x2a, 0x0c, 0x80, 0x0c, 0x2a, 0x0d,
+    0x80, 0x08, 0xe9, 0x44, 0xc2, 0x81, 0xf0, 0x43, 0xf8, 0x44, 0x53, 0x19, 0x10, 0x19, 0xd1, 0xaf,
+    0xcc, 0x50, 0x30, 0x00, 0x20, 0x00, 0x81, 0x00, 0x54, 0x19, 0x84, 0x36, 0x51, 0x19, 0xf8, 0xd1,
+    0x90, 0xc0, 0x55, 0x98, 0x3e, 0xe3, 0xe0, 0xe8, 0xf8, 0xc4, 0x90, 0xc0, 0x45, 0x90, 0xe8, 0xe0,
+    0x55, 0x98, 0x7e, 0xe3, 0x45, 0x95, 0x55, 0x98, 0x7e, 0xe3, 0x45, 0x94, 0x55, 0x98, 0x7e, 0xe3,
+    0x45, 0x97, 0x55, 0x98, 0x3e, 0xe3, 0x00, 0x09, 0x03, 0x80, 0x00, 0x40, 0xf8, 0x51, 0x2a, 0xff,
+    0x94, 0x3b, 0x45, 0x96, 0x40, 0x93, 0xd5, 0xa0, 0x84, 0x51, 0xd5, 0xaf, 0x80, 0x4d, 0x26, 0x69,
+    0xcc, 0x58, 0x80, 0x47, 0x34, 0xd7, 0xf1, 0x04, 0xf4, 0x03, 0xf0, 0x02, 0xf3, 0x01, 0xe8, 0xea,
+    0xf9, 0x45, 0xfa, 0x46, 0xf2, 0x47, 0xfb, 0x48, 0xfc, 0x49, 0x2a, 0xff, 0x9e, 0x9b, 0xfd, 0x4a,
+    0x37, 0x76, 0x34, 0xd7, 0xf2, 0xc7, 0x34, 0x72, 0xfa, 0xc6, 0xdc, 0x06, 0x24, 0x69, 0xfb, 0xc8,
+    0xfc, 0xc9, 0xf9, 0xc5, 0x80, 0x1a, 0xfd, 0xca, 0xe8, 0xea, 0x2a, 0xff, 0x9e, 0xfd, 0x18, 0x01,
+    0xa0, 0x01, 0xf9, 0xc5, 0x88, 0x0a, 0xfa, 0xc6, 0x75, 0x72, 0xd8, 0x02, 0xdf, 0x00, 0x3d, 0x41,
+    0x3b, 0xc1, 0xf8, 0xc4, 0xf0, 0xc3, 0x78, 0x61, 0x24, 0x6a, 0xf0, 0x43, 0x28, 0x08, 0x80, 0x38,
+    0x2c, 0x0c, 0x80, 0x38, 0x2d, 0x0d, 0x80, 0x38, 0x2f, 0x0f, 0x80, 0x38, 0x00, 0x09, 0x04, 0x00,
+    0x00, 0x40, 0x2e, 0x0e, 0x80, 0x38, 0x2b, 0x0b, 0x80, 0x38, 0x81, 0x3c, 0xf8, 0x44, 0x2d, 0x10,
+    0xc0, 0x81, 0x93, 0x48, 0x2b, 0x03, 0x80, 0x10, 0x2a, 0x08, 0x80, 0x38, 0x2a, 0x09, 0x80, 0x30,
+    0x2a, 0x0a, 0x80, 0x36, 0x34, 0xf0, 0x77, 0x76, 0xdc, 0x86, 0x24, 0xe9, 0x51, 0x12, 0x80, 0x15,
+    0x13, 0x11, 0xd0, 0xaf, 0x80, 0x0f, 0x01, 0x04, 0x3d, 0x1c, 0x80, 0x0a, 0x71, 0xf1, 0x84, 0x05,
+    0x42, 0x10, 0x2a, 0x0a, 0x80, 0x38, 0x94, 0xd0, 0x29, 0x09, 0x80, 0x38, 0x28, 0x08, 0x80, 0x38,
+    0x7c, 0x41, 0x27, 0xe8, 0x9f, 0xd8, 0x30, 0x24, 0x3f, 0x50, 0x80, 0x09, 0xe7, 0xe8, 0x94, 0xc0,
+    0xc8, 0x48, 0xc9, 0x49, 0x9a, 0xc0, 0x36, 0x04, 0x80, 0x01, 0x90, 0xc0, 0x34, 0x05, 0x80, 0x01,
+    0x96, 0xc0, 0x7e, 0x78, 0x30, 0x05, 0x80, 0x01, 0x3e, 0xe8, 0x63, 0x31, 0x2f, 0xd5, 0x7f, 0x47,
+    0x6c, 0x5f, 0x00, 0x09, 0x04, 0x80, 0x00, 0x40, 0xc8, 0x40, 0x90, 0xc0, 0x9f, 0x71, 0x33, 0x24,
+    0x3f, 0x30, 0x80, 0x09, 0xc9, 0x41, 0x83, 0xce, 0xc8, 0x40, 0x30, 0x24, 0x3f, 0x50, 0x80, 0x09,
+    0xc8, 0x48, 0x31, 0x24, 0x3f, 0x30, 0x80, 0x09, 0x83, 0xfb, 0x33, 0x18, 0x80, 0x7f, 0x3e, 0x70,
+    0x80, 0x00, 0x3c, 0x48, 0x34, 0x00, 0x20, 0x0c, 0x98, 0x00, 0x24, 0x61, 0xc2, 0x98, 0x2f, 0x20,
+    0x35, 0xd2, 0xee, 0xe8, 0x32, 0xc8, 0x80, 0xc7, 0x74, 0xf0, 0x64, 0xe8, 0x92, 0xc2, 0x6c, 0x10,
+    0x94, 0xc7, 0x65, 0x68, 0xc0, 0xff, 0x92, 0xc2, 0x6d, 0x10, 0x32, 0xe4, 0x3d, 0x8c, 0x80, 0x01,
+    0x92, 0xc3, 0xc2, 0xff, 0x34, 0x51, 0x31, 0x00, 0x20, 0x03, 0x86, 0x00, 0x83, 0xa2, 0x64, 0x61,
+    0x24, 0x64, 0x34, 0x18, 0x20, 0x0f, 0xa2, 0x00, 0x72, 0x70, 0x80, 0x07, 0x6e, 0x10, 0x6c, 0x7d,
+    0x6c, 0x56, 0x30, 0x24, 0x3f, 0x50, 0x80, 0x09, 0x00, 0x09, 0x05, 0x00, 0x00, 0x40, 0x40, 0x96,
+    0x33, 0x1a, 0x8f, 0x00, 0x3d, 0x68, 0x30, 0x00, 0x20, 0x01, 0x83, 0x00, 0x36, 0x01, 0x80, 0x02,
+    0x34, 0x00, 0x80, 0x02, 0xd8, 0x10, 0xd4, 0x41, 0x24, 0x61, 0x31, 0x00, 0x20, 0x0c, 0x98, 0x00,
+    0x6c, 0x31, 0x9f, 0x70, 0x00, 0x80, 0x80, 0x48, 0x83, 0x71, 0x24, 0x69, 0x37, 0x50, 0xe7, 0x58,
+    0x39, 0x00, 0x3d, 0x20, 0x80, 0x0a, 0x24, 0x18, 0x81, 0x4a, 0x96, 0xc2, 0x30, 0x00, 0x20, 0x00,
+    0x81, 0x00, 0x97, 0x45, 0x27, 0xe8, 0x9f, 0xe8, 0x92, 0xd0, 0x50, 0x99, 0x40, 0x98, 0x32, 0xe4,
+    0x3c, 0x48, 0x80, 0x01, 0x30, 0xd8, 0x2c, 0xce, 0xbd, 0xcc, 0x24, 0x68, 0x34, 0xd0, 0xc2, 0x98,
+    0x94, 0xc6, 0x75, 0xd2, 0x6c, 0x10, 0x94, 0xc7, 0x65, 0x68, 0xc0, 0xff, 0x92, 0xc2, 0x6d, 0x10,
+    0x32, 0xe4, 0x3d, 0x8c, 0x80, 0x01, 0x92, 0xc3, 0xc2, 0xff, 0x27, 0x68, 0x75, 0xd6, 0x00, 0x09,
+    0x05, 0x80, 0x00, 0x40, 0x92, 0xc2, 0x6d, 0x10, 0x32, 0xe4, 0x3d, 0x74, 0x80, 0x01, 0x92, 0xc3,
+    0xc2, 0xff, 0x75, 0x51, 0x65, 0x61, 0x65, 0x69, 0x24, 0x18, 0x80, 0xe6, 0x96, 0xc2, 0x30, 0x00,
+    0x20, 0x00, 0x81, 0x00, 0x25, 0x68, 0x74, 0x52, 0x80, 0x07, 0x88, 0x06, 0x64, 0x64, 0x74, 0x52,
+    0x2a, 0xff, 0x9e, 0xdb, 0x31, 0x40, 0x34, 0x77, 0x81, 0x71, 0x25, 0x68, 0x31, 0x00, 0x20, 0x00,
+    0x80, 0x80, 0xd4, 0x41, 0x31, 0xee, 0x9f, 0x00, 0x98, 0xc7, 0x31, 0x60, 0x32, 0x18, 0x80, 0xb1,
+    0x67, 0x64, 0x2a, 0xff, 0x9e, 0xb9, 0x74, 0x56, 0x6d, 0x12, 0x2a, 0xff, 0x9e, 0xb1, 0x34, 0xd2,
+    0x74, 0x52, 0x2a, 0xff, 0x9e, 0xa9, 0x35, 0xd0, 0xf1, 0xc2, 0x36, 0x50, 0x34, 0x53, 0xf1, 0xc3,
+    0x2a, 0xff, 0x9e, 0x9b, 0x6c, 0xc4, 0x36, 0x50, 0x34, 0x53, 0xf1, 0xc4, 0x2a, 0xff, 0x9e, 0x8f,
+    0x6c, 0xc4, 0x36, 0x50, 0x00, 0x09, 0x06, 0x00, 0x00, 0x40, 0x34, 0x53, 0xf1, 0xc5, 0x2a, 0xff,
+    0x9e, 0x83, 0x6c, 0xc4, 0x35, 0xd0, 0x34, 0x53, 0xf1, 0xc6, 0x2a, 0xff, 0x9e, 0x77, 0x6c, 0xd9,
+    0x35, 0xd0, 0x34, 0x52, 0x31, 0x00, 0x20, 0x00, 0x82, 0x00, 0x2a, 0xff, 0x9e, 0x67, 0x6d, 0xd9,
+    0x24, 0x68, 0x2f, 0x9d, 0x34, 0xd0, 0xc2, 0x98, 0x94, 0xc6, 0x75, 0xd2, 0x6c, 0x10, 0x94, 0xc7,
+    0x65, 0x68, 0xc0, 0xff, 0x92, 0xc2, 0x6d, 0x10, 0x32, 0xe4, 0x3d, 0x8c, 0x80, 0x01, 0x92, 0xc3,
+    0xc2, 0xff, 0x27, 0xe8, 0x75, 0xd7, 0x92, 0xc2, 0x6d, 0x10, 0x32, 0xe4, 0x3d, 0x74, 0x80, 0x01,
+    0x92, 0xc3, 0xc2, 0xff, 0x27, 0x68, 0x24, 0xe1, 0x30, 0x00, 0x20, 0x00, 0x81, 0x00, 0x80, 0x0c,
+    0x6c, 0xd1, 0x67, 0x64, 0x7f, 0x78, 0x88, 0x08, 0xd4, 0x1e, 0x7f, 0x78, 0xd4, 0x16, 0x2a, 0xff,
+    0x9e, 0x13, 0x64, 0x61, 0x31, 0x00, 0x20, 0x00, 0x81, 0x00, 0x00, 0x09, 0x06, 0x80, 0x00, 0x40,
+    0x6c, 0x11, 0x30, 0x24, 0x3f, 0x50, 0x80, 0x09, 0xe7, 0x78, 0x2d, 0x90, 0x2c, 0x10, 0x32, 0x10,
+    0x20, 0x00, 0x80, 0x00, 0x29, 0x00, 0x84, 0x00, 0x28, 0x0a, 0x84, 0x08, 0x0a, 0x80, 0x84, 0x0c,
+    0xea, 0x39, 0x03, 0x80, 0x84, 0x10, 0x10, 0x00, 0x3d, 0x50, 0x80, 0x0a, 0x03, 0x80, 0x84, 0x20,
+    0x0a, 0x80, 0x84, 0x08, 0x03, 0x90, 0x01, 0x06, 0x3d, 0x50, 0x80, 0x0a, 0x27, 0x04, 0x81, 0x00,
+    0xb2, 0x41, 0x03, 0x80, 0x84, 0x14, 0x00, 0x80, 0x84, 0x18, 0x01, 0x80, 0x84, 0x1c, 0x92, 0xc8,
+    0x43, 0x9a, 0x2d, 0x10, 0x30, 0xe0, 0x21, 0x48, 0x80, 0xfa, 0x21, 0x00, 0x80, 0x40, 0x03, 0x80,
+    0x84, 0x28, 0x03, 0x80, 0x84, 0x24, 0x00, 0x80, 0x84, 0x2c, 0x02, 0x80, 0x84, 0x30, 0x01, 0x80,
+    0x84, 0x3c, 0x9f, 0x70, 0x02, 0x80, 0x84, 0x40, 0x2b, 0xff, 0x9d, 0xa3, 0x11, 0xd9, 0xee, 0xe8,
+    0x00, 0x09, 0x07, 0x00, 0x00, 0x40, 0x01, 0x9e, 0xf0, 0xc7, 0x11, 0x11, 0xcf, 0x40, 0x41, 0x1e,
+    0x51, 0x09, 0x01, 0x16, 0xc9, 0x4f, 0xee, 0x46, 0x49, 0x9e, 0x40, 0x96, 0xb1, 0xb9, 0x3c, 0xd1,
+    0x10, 0x66, 0x9f, 0xf4, 0x0c, 0x00, 0xa0, 0x10, 0x01, 0x86, 0x80, 0x4c, 0x80, 0xa0, 0xee, 0x70,
+    0xb1, 0xba, 0x7c, 0xc9, 0x01, 0x86, 0x80, 0x60, 0x00, 0x06, 0x3d, 0x40, 0x80, 0x0a, 0x02, 0x06,
+    0x3d, 0x4c, 0x80, 0x0a, 0x2a, 0xff, 0x9d, 0x49, 0x6c, 0x32, 0x2d, 0x52, 0x11, 0x86, 0x80, 0x60,
+    0x02, 0x86, 0x80, 0x44, 0x00, 0x06, 0x3d, 0x44, 0x80, 0x0a, 0x04, 0x06, 0x3d, 0x48, 0x80, 0x0a,
+    0x2c, 0x00, 0x33, 0x00, 0x20, 0x00, 0x81, 0x00, 0x2a, 0xff, 0x9d, 0x25, 0x6c, 0x99, 0x10, 0x86,
+    0x80, 0x5c, 0x2c, 0x32, 0x11, 0x86, 0x80, 0x44, 0xb0, 0x75, 0x06, 0x06, 0x3d, 0x54, 0x80, 0x0a,
+    0x30, 0xf6, 0xc9, 0x47, 0x84, 0x3b, 0x00, 0x09, 0x07, 0x80, 0x00, 0x40, 0x24, 0xe8, 0xc2, 0x98,
+    0x94, 0xc6, 0x75, 0xd2, 0x6c, 0x10, 0x94, 0xc7, 0x65, 0x68, 0xc0, 0xff, 0x92, 0xc2, 0x6d, 0x10,
+    0x32, 0xe4, 0x3d, 0x8c, 0x80, 0x01, 0x92, 0xc3, 0xc2, 0xff, 0x27, 0x68, 0x75, 0xd6, 0x92, 0xc2,
+    0x6d, 0x10, 0x32, 0xe4, 0x3d, 0x74, 0x80, 0x01, 0x92, 0xc3, 0xc2, 0xff, 0x36, 0x51, 0xc9, 0x47,
+    0x88, 0x06, 0x66, 0x61, 0xc4, 0x81, 0x30, 0x00, 0x20, 0x10, 0xa0, 0x00, 0x6c, 0x7d, 0x88, 0x18,
+    0xb4, 0x76, 0xb0, 0x8c, 0x7c, 0x51, 0xb0, 0x75, 0xb0, 0x8d, 0x7c, 0x51, 0xb0, 0x76, 0xb0, 0x8a,
+    0x7c, 0x51, 0x00, 0x86, 0x80, 0x44, 0x2c, 0x90, 0xc0, 0x81, 0xb2, 0x8e, 0x7d, 0x4e, 0xb2, 0x77,
+    0xb2, 0x8f, 0x7d, 0x4e, 0x02, 0x86, 0x80, 0x20, 0x12, 0x01, 0x80, 0x10, 0x7d, 0x51, 0x02, 0x86,
+    0x80, 0x24, 0x12, 0x01, 0x80, 0x12, 0x7d, 0x51, 0x02, 0x86, 0x80, 0x28, 0x00, 0x09, 0x08, 0x00,
+    0x00, 0x40, 0x12, 0x01, 0x80, 0x14, 0x7d, 0x4e, 0x02, 0x86, 0x80, 0x2c, 0x12, 0x01, 0x80, 0x16,
+    0x7d, 0x4e, 0x02, 0x86, 0x80, 0x30, 0x12, 0x01, 0x80, 0x18, 0x7d, 0x51, 0x02, 0x86, 0x80, 0x34,
+    0x12, 0x01, 0x80, 0x1c, 0x7d, 0x4e, 0x02, 0x86, 0x80, 0x38, 0x12, 0x01, 0x80, 0x1e, 0x7d, 0x4e,
+    0x02, 0x86, 0x80, 0x3c, 0x12, 0x01, 0x80, 0x1a, 0x7d, 0x51, 0x02, 0x86, 0x80, 0x40, 0x10, 0x17,
+    0x00, 0x86, 0x80, 0x98, 0x97, 0x44, 0x7c, 0x51, 0x2e, 0x08, 0x80, 0x48, 0x00, 0x86, 0x80, 0x58,
+    0x92, 0xc8, 0x41, 0x98, 0x34, 0x10, 0x20, 0x29, 0xae, 0x00, 0xb0, 0xf5, 0x72, 0x70, 0x80, 0x07,
+    0x6e, 0x10, 0x6c, 0x7d, 0x35, 0x00, 0x20, 0x00, 0x81, 0x00, 0xb1, 0xf6, 0x72, 0xf1, 0x80, 0x0c,
+    0xb4, 0x75, 0x35, 0x00, 0x20, 0x14, 0xa8, 0x00, 0x6d, 0x7d, 0xb4, 0xf7, 0x26, 0x68, 0x30, 0x00,
+    0x20, 0x05, 0x00, 0x09, 0x08, 0x80, 0x00, 0x40, 0x8a, 0x00, 0x92, 0xc3, 0x6e, 0x10, 0x84, 0x06,
+    0xb5, 0x76, 0x6c, 0x7d, 0x15, 0x86, 0x80, 0x20, 0x26, 0xe8, 0x31, 0x00, 0x20, 0x05, 0x8a, 0x00,
+    0x92, 0xc3, 0x6e, 0x90, 0x84, 0x06, 0xb4, 0x77, 0x6d, 0x7d, 0x34, 0x10, 0x20, 0x29, 0xae, 0x00,
+    0x10, 0x86, 0x80, 0x34, 0x32, 0x70, 0x05, 0x86, 0x80, 0x20, 0x80, 0x07, 0x6e, 0x10, 0x6c, 0x7d,
+    0x35, 0x00, 0x20, 0x00, 0x81, 0x00, 0x11, 0x86, 0x80, 0x40, 0x32, 0xf1, 0x04, 0x86, 0x80, 0x34,
+    0x80, 0x0b, 0x35, 0x00, 0x20, 0x14, 0xa8, 0x00, 0x6d, 0x7d, 0x14, 0x86, 0x80, 0x38, 0x26, 0x68,
+    0x05, 0x86, 0x80, 0x40, 0x84, 0x0e, 0x98, 0xc7, 0x30, 0x00, 0x20, 0x05, 0x8a, 0x00, 0x6e, 0x10,
+    0x6c, 0x7d, 0x15, 0x86, 0x80, 0x3c, 0x26, 0xe8, 0x04, 0x86, 0x80, 0x38, 0x84, 0x0e, 0x98, 0xc7,
+    0x31, 0x00, 0x20, 0x05, 0x8a, 0x00, 0x6e, 0x90, 0x00, 0x09, 0x09, 0x00, 0x00, 0x40, 0x6d, 0x7d,
+    0x34, 0x10, 0x20, 0x29, 0xae, 0x00, 0x10, 0x86, 0x80, 0x24, 0x32, 0x70, 0x05, 0x86, 0x80, 0x3c,
+    0x80, 0x07, 0x6e, 0x10, 0x6c, 0x7d, 0x35, 0x00, 0x20, 0x00, 0x81, 0x00, 0x11, 0x86, 0x80, 0x28,
+    0x32, 0xf1, 0x04, 0x86, 0x80, 0x24, 0x80, 0x0b, 0x35, 0x00, 0x20, 0x04, 0x88, 0x00, 0x6d, 0x7d,
+    0x14, 0x86, 0x80, 0x2c, 0x26, 0x68, 0x05, 0x86, 0x80, 0x28, 0x84, 0x0e, 0x98, 0xc7, 0x30, 0x00,
+    0x20, 0x05, 0x8a, 0x00, 0x6e, 0x10, 0x6c, 0x7d, 0x15, 0x86, 0x80, 0x30, 0x26, 0xe8, 0x04, 0x86,
+    0x80, 0x2c, 0x84, 0x0e, 0x98, 0xc7, 0x31, 0x00, 0x20, 0x05, 0x8a, 0x00, 0x6e, 0x90, 0x6d, 0x7d,
+    0x14, 0x86, 0x80, 0x44, 0x26, 0x68, 0x05, 0x86, 0x80, 0x30, 0x84, 0x0e, 0x98, 0xc7, 0x30, 0x00,
+    0x20, 0x1e, 0xbc, 0x00, 0x6e, 0x10, 0x6c, 0x7d, 0x35, 0x10, 0x20, 0x29, 0xae, 0x00, 0x00, 0x09,
+    0x09, 0x80, 0x00, 0x40, 0x11, 0x86, 0x80, 0x58, 0x32, 0xf1, 0x04, 0x86, 0x80, 0x44, 0x80, 0x07,
+    0x6e, 0x90, 0x6d, 0x7d, 0x11, 0x96, 0x05, 0x86, 0x80, 0x58, 0x2a, 0xff, 0x9b, 0x95, 0xb0, 0xf7,
+    0x35, 0x50, 0x11, 0x96, 0x10, 0x86, 0x80, 0x20, 0x2a, 0xff, 0x9b, 0x87, 0x02, 0x86, 0x80, 0x64,
+    0x35, 0x50, 0x11, 0x96, 0x10, 0x86, 0x80, 0x2c, 0x2a, 0xff, 0x9b, 0x77, 0x02, 0x86, 0x80, 0x68,
+    0x35, 0x50, 0x11, 0x96, 0x10, 0x86, 0x80, 0x30, 0x2a, 0xff, 0x9b, 0x67, 0x02, 0x86, 0x80, 0x70,
+    0x35, 0x50, 0x11, 0x96, 0x10, 0x86, 0x80, 0x38, 0x2a, 0xff, 0x9b, 0x57, 0x02, 0x86, 0x80, 0x74,
+    0x35, 0x50, 0x11, 0x96, 0x10, 0x86, 0x80, 0x3c, 0x2a, 0xff, 0x9b, 0x47, 0x02, 0x86, 0x80, 0x78,
+    0x2c, 0x90, 0x32, 0x00, 0x20, 0x00, 0x81, 0x00, 0xb3, 0xf6, 0x25, 0xe8, 0x34, 0x00, 0x20, 0x00,
+    0x80, 0x01, 0x02, 0x86, 0x00, 0x09, 0x0a, 0x00, 0x00, 0x40, 0x80, 0x84, 0x94, 0xc1, 0xc2, 0xff,
+    0x6d, 0x10, 0x32, 0xe4, 0x3d, 0x74, 0x80, 0x01, 0x34, 0x54, 0x00, 0x86, 0x80, 0x7c, 0x24, 0xe1,
+    0x13, 0x86, 0x80, 0x40, 0x25, 0xe8, 0x36, 0x00, 0x20, 0x00, 0x81, 0x00, 0x2c, 0x86, 0x30, 0x00,
+    0x20, 0x00, 0x80, 0x01, 0x2c, 0x90, 0x01, 0x86, 0x80, 0x6c, 0x32, 0xe4, 0x3d, 0x74, 0x80, 0x01,
+    0x94, 0xc1, 0xc2, 0xff, 0x6d, 0x10, 0x64, 0xe1, 0x6c, 0x06, 0x2e, 0x08, 0x80, 0xa8, 0x2a, 0xff,
+    0x9c, 0x47, 0x00, 0x86, 0x80, 0x80, 0xf1, 0xc8, 0x24, 0xe8, 0xf0, 0x8f, 0x12, 0x86, 0x80, 0x44,
+    0xb0, 0x34, 0x84, 0x1a, 0x02, 0x86, 0x80, 0x88, 0x3c, 0xc2, 0xd4, 0xa3, 0x80, 0x11, 0xc9, 0x41,
+    0x38, 0x00, 0x3d, 0x34, 0x80, 0x0a, 0x90, 0xc0, 0xe9, 0x18, 0x4e, 0x91, 0x30, 0x24, 0x3f, 0x50,
+    0x80, 0x09, 0x6c, 0x10, 0x97, 0x44, 0x6c, 0x10, 0x92, 0xd0, 0x00, 0x09, 0x0a, 0x80, 0x00, 0x40,
+    0x51, 0x98, 0xd4, 0x41, 0x9f, 0x71, 0x36, 0xd0, 0x01, 0x06, 0x3d, 0x58, 0x80, 0x0a, 0x2d, 0x7c,
+    0x3c, 0xf8, 0x00, 0x06, 0x3d, 0x5c, 0x80, 0x0a, 0x36, 0x55, 0x38, 0x60, 0x26, 0x4c, 0x80, 0x09,
+    0x2c, 0x7d, 0x32, 0xe0, 0x3f, 0xff, 0x80, 0xff, 0x38, 0xc8, 0x92, 0x18, 0x2c, 0x31, 0xdd, 0x04,
+    0x38, 0x41, 0x34, 0xd2, 0xca, 0x40, 0xc9, 0x40, 0xa2, 0xc2, 0xa0, 0xc1, 0x2a, 0xff, 0x99, 0xcb,
+    0x6c, 0x32, 0x9f, 0x70, 0x6c, 0x52, 0xfb, 0xc3, 0x83, 0xb2, 0xec, 0xe9, 0x83, 0xbb, 0xf1, 0xc4,
+    0x64, 0xea, 0x84, 0x1d, 0x9b, 0x41, 0x2b, 0x03, 0x80, 0x04, 0x51, 0x5c, 0x61, 0x74, 0x6d, 0x74,
+    0x74, 0xc2, 0x7c, 0xc8, 0x64, 0xe5, 0x92, 0xd0, 0x7c, 0xc8, 0x74, 0xd9, 0x41, 0x5b, 0x9f, 0x71,
+    0x2b, 0xff, 0x99, 0xab, 0xee, 0xe8, 0xb8, 0xf3, 0xb2, 0xb2, 0x10, 0x90, 0x80, 0x02, 0x27, 0x0a,
+    0x00, 0x09, 0x0b, 0x00, 0x00, 0x40, 0x80, 0x28, 0x31, 0x19, 0x81, 0x00, 0x35, 0x1a, 0x81, 0x00,
+    0x31, 0x61, 0xe7, 0xea, 0xef, 0xe9, 0x80, 0x14, 0xfa, 0xd1, 0xb8, 0xf4, 0xb0, 0x32, 0x20, 0x80,
+    0x80, 0x00, 0xb0, 0x04, 0xb0, 0x05, 0x6c, 0x10, 0xb0, 0x35, 0xb0, 0xb2, 0x64, 0x69, 0x84, 0x0f,
+    0xb0, 0xb4, 0x64, 0x69, 0x80, 0x09, 0xd0, 0x22, 0x27, 0x18, 0x82, 0x7a, 0xe8, 0xe9, 0x1b, 0x86,
+    0x84, 0xb0, 0xc5, 0x6e, 0x10, 0x05, 0xa0, 0x04, 0x00, 0x06, 0x3d, 0x60, 0x80, 0x0a, 0x90, 0xc0,
+    0xf7, 0xd2, 0x27, 0xea, 0xd4, 0x47, 0x2e, 0x0c, 0x84, 0xc0, 0x10, 0x9c, 0x00, 0x02, 0x3d, 0x60,
+    0x80, 0x0a, 0x12, 0x8c, 0x11, 0x86, 0x84, 0xbc, 0x02, 0x02, 0x3d, 0x50, 0x80, 0x0a, 0x84, 0x3c,
+    0x18, 0x00, 0x3d, 0x50, 0x80, 0x0a, 0x2b, 0x03, 0x80, 0x06, 0x9b, 0x47, 0x12, 0x58, 0x53, 0x93,
+    0x22, 0xbc, 0x36, 0x53, 0x7d, 0xe7, 0x00, 0x09, 0x0b, 0x80, 0x00, 0x40, 0x2c, 0x41, 0x45, 0x9b,
+    0x2c, 0x20, 0x1d, 0x86, 0x84, 0xb4, 0x3a, 0xca, 0x96, 0x47, 0xed, 0x8b, 0xd4, 0xc2, 0x94, 0xc2,
+    0x22, 0x03, 0x80, 0x12, 0x6c, 0xb9, 0x94, 0xd0, 0x2d, 0x00, 0x84, 0x10, 0xeb, 0xec, 0xeb, 0x3d,
+    0x2d, 0x10, 0x10, 0x00, 0x3d, 0x50, 0x80, 0x0a, 0x3c, 0x67, 0x00, 0x86, 0x84, 0xc0, 0x24, 0x65,
+    0x01, 0x86, 0x84, 0xbc, 0x01, 0x06, 0x3d, 0x50, 0x80, 0x0a, 0x25, 0x00, 0x80, 0x51, 0xc3, 0xa8,
+    0x01, 0x86, 0x84, 0xc4, 0x0b, 0x86, 0x84, 0xb0, 0x38, 0x60, 0x23, 0xbc, 0x80, 0x09, 0x76, 0x53,
+    0x7e, 0x43, 0xcb, 0x44, 0x90, 0xc0, 0xeb, 0x18, 0x54, 0x93, 0x70, 0x7c, 0x80, 0x54, 0x94, 0xc2,
+    0x37, 0x02, 0x80, 0x01, 0x39, 0xe1, 0xd8, 0x9c, 0x76, 0xd3, 0x7e, 0xc3, 0xcb, 0x45, 0x39, 0xec,
+    0x9f, 0xff, 0xeb, 0x18, 0x55, 0x93, 0x72, 0xf8, 0x80, 0x37, 0xd9, 0x1d, 0x00, 0x09, 0x0c, 0x00,
+    0x00, 0x40, 0x2c, 0xb8, 0xd8, 0x18, 0x3b, 0xed, 0x9f, 0xff, 0x32, 0xe4, 0x6c, 0x32, 0x80, 0x1a,
+    0xb3, 0xd9, 0xf9, 0x47, 0xfa, 0x48, 0x32, 0x44, 0x20, 0x00, 0x80, 0x09, 0xf3, 0x49, 0x3c, 0x49,
+    0xf9, 0xc7, 0xfa, 0xc8, 0x88, 0x06, 0xf3, 0xc9, 0x6c, 0x10, 0x64, 0x6a, 0x92, 0xc2, 0xd5, 0xc0,
+    0x88, 0x12, 0xf3, 0x44, 0x76, 0xd3, 0x31, 0x75, 0x6d, 0xc9, 0x85, 0x9a, 0x75, 0xc3, 0x6c, 0x10,
+    0xf0, 0x44, 0xc5, 0x66, 0x90, 0xc0, 0x90, 0xc0, 0x27, 0xea, 0xf0, 0xc4, 0xf0, 0x46, 0x84, 0x5a,
+    0xeb, 0xe9, 0x12, 0x5b, 0x10, 0x86, 0x84, 0xe4, 0x24, 0x6a, 0x65, 0x66, 0x84, 0x0f, 0xd8, 0x9a,
+    0x10, 0x86, 0x84, 0xd0, 0x70, 0xf0, 0x84, 0x33, 0x88, 0x1d, 0xf9, 0x47, 0x10, 0x86, 0x84, 0xcc,
+    0x2a, 0xff, 0x98, 0x19, 0x11, 0x86, 0x84, 0xd4, 0xd8, 0x9a, 0x30, 0xf0, 0x00, 0x86, 0x84, 0xcc,
+    0x84, 0x12, 0x00, 0x09, 0x0c, 0x80, 0x00, 0x40, 0xf9, 0xc7, 0x20, 0x00, 0x80, 0x40, 0x01, 0x86,
+    0x84, 0xd0, 0x88, 0x08, 0x01, 0x86, 0x84, 0xcc, 0xc0, 0x81, 0x00, 0x86, 0x84, 0xe4, 0x3b, 0xe1,
+    0x10, 0x86, 0x84, 0xe4, 0x27, 0xea, 0x78, 0x61, 0x81, 0xb0, 0x00, 0x86, 0x84, 0xe4, 0x2c, 0x10,
+    0x11, 0x86, 0x84, 0xd0, 0x35, 0x71, 0xc1, 0xa8, 0x24, 0x00, 0x80, 0x51, 0x38, 0x60, 0x21, 0x2c,
+    0x80, 0x09, 0x75, 0xd1, 0x7d, 0xc3, 0xcb, 0x43, 0x90, 0xc0, 0xeb, 0x18, 0x53, 0x13, 0x71, 0x73,
+    0x80, 0x44, 0x94, 0xc2, 0x33, 0x00, 0x80, 0x01, 0x78, 0xe1, 0x76, 0x51, 0x7e, 0x43, 0xcb, 0x44,
+    0x90, 0xc0, 0xeb, 0x18, 0x54, 0x13, 0x72, 0x72, 0x80, 0x2b, 0x32, 0x63, 0x6c, 0xac, 0x80, 0x16,
+    0xb6, 0xd9, 0x2c, 0x28, 0xf9, 0x47, 0x32, 0x44, 0x20, 0x00, 0x80, 0x09, 0xfa, 0x48, 0xf9, 0xc7,
+    0x88, 0x06, 0xfa, 0xc8, 0x6c, 0x10, 0x24, 0x6a, 0x00, 0x09, 0x0d, 0x00, 0x00, 0x40, 0x7c, 0x49,
+    0x84, 0x05, 0xd7, 0x40, 0x88, 0x12, 0xf6, 0x43, 0x76, 0x51, 0x30, 0x74, 0x6c, 0xc0, 0x85, 0xaa,
+    0x74, 0xc1, 0x6c, 0x10, 0xf0, 0x43, 0xbb, 0xf4, 0xf0, 0xc3, 0xf7, 0xc4, 0xf0, 0x45, 0x3e, 0xca,
+    0x93, 0xd1, 0xb3, 0x9c, 0x31, 0x73, 0xf6, 0xc3, 0x84, 0x08, 0x3c, 0xcc, 0x93, 0xd1, 0xb2, 0x1c,
+    0xb3, 0x9d, 0x74, 0xf4, 0x70, 0xf3, 0x84, 0x05, 0xb4, 0x1d, 0xb8, 0xb2, 0x0c, 0x08, 0xa0, 0x40,
+    0x80, 0x47, 0xb0, 0xb5, 0x64, 0x69, 0x84, 0x41, 0x0c, 0x08, 0xa0, 0x80, 0x80, 0x1c, 0xb0, 0x9b,
+    0x35, 0x72, 0xc1, 0x81, 0x31, 0x70, 0xc0, 0x88, 0x84, 0x2f, 0xf9, 0x47, 0xfa, 0x48, 0x32, 0xe4,
+    0x3a, 0x8c, 0x80, 0x01, 0xf2, 0x49, 0x88, 0x17, 0x30, 0xf0, 0xc1, 0x81, 0x84, 0x1b, 0xc0, 0x88,
+    0xf9, 0x47, 0xfa, 0x48, 0x32, 0xe4, 0x3a, 0x8c, 0x80, 0x01, 0xf2, 0x49, 0xc0, 0x81, 0x00, 0x09,
+    0x0d, 0x80, 0x00, 0x40, 0xb0, 0x35, 0xf9, 0xc7, 0xfa, 0xc8, 0xf2, 0xc9, 0xb0, 0xb4, 0x24, 0x69,
+    0x07, 0x86, 0x80, 0xa0, 0x84, 0x0e, 0x06, 0x86, 0x80, 0xa4, 0x88, 0x14, 0x38, 0x00, 0x20, 0xa4,
+    0x80, 0x08, 0xd0, 0x22, 0x84, 0x0d, 0x38, 0x00, 0x20, 0xa8, 0x80, 0x08, 0x90, 0xc0, 0x42, 0x10,
+    0xb0, 0xb2, 0x2d, 0x10, 0x2d, 0x90, 0x2e, 0x90, 0x2f, 0x10, 0x0c, 0x00, 0xa0, 0x07, 0x84, 0x5b,
+    0x2e, 0x0b, 0x80, 0x48, 0x2a, 0xff, 0x9c, 0xbb, 0xe8, 0xeb, 0x64, 0x69, 0x84, 0x1b, 0xf8, 0xd1,
+    0x90, 0xc0, 0xe8, 0xa9, 0x25, 0x18, 0x81, 0xe8, 0xf0, 0xd2, 0x7c, 0x41, 0x32, 0xe4, 0x3c, 0x84,
+    0x80, 0x01, 0xf0, 0x41, 0x89, 0xd9, 0x2a, 0xff, 0x9c, 0x99, 0xe8, 0xeb, 0x2a, 0xff, 0x9c, 0x9f,
+    0xfa, 0x48, 0xf1, 0xd2, 0x24, 0xea, 0xfa, 0xc8, 0x27, 0x18, 0x81, 0xc4, 0x9b, 0x41, 0x2b, 0x03,
+    0x80, 0x04, 0x51, 0x5f, 0x00, 0x09, 0x0e, 0x00, 0x00, 0x40, 0x61, 0x74, 0x6d, 0x74, 0x74, 0xc2,
+    0x7c, 0xc8, 0x64, 0xe5, 0x92, 0xd0, 0x7c, 0xc8, 0x74, 0xd9, 0x41, 0x5a, 0x89, 0xa7, 0xb4, 0xf5,
+    0xf1, 0xc6, 0x32, 0x71, 0x17, 0x86, 0x80, 0x88, 0x80, 0x2a, 0xcc, 0x57, 0x0c, 0x00, 0xa0, 0x01,
+    0x80, 0x23, 0xf0, 0xc6, 0x2c, 0x20, 0x11, 0x86, 0x80, 0x6c, 0x2a, 0xff, 0x96, 0x57, 0x64, 0x64,
+    0x36, 0x50, 0x16, 0x86, 0x80, 0x68, 0xc3, 0x81, 0x15, 0x86, 0x80, 0x64, 0x88, 0x4e, 0x06, 0x86,
+    0x80, 0x84, 0x17, 0x86, 0x80, 0x24, 0x73, 0xf1, 0x84, 0x3f, 0x0c, 0x00, 0xa0, 0x04, 0x80, 0x39,
+    0xf0, 0xc6, 0x34, 0x10, 0x20, 0x3c, 0x88, 0x00, 0x2c, 0x7c, 0x11, 0x86, 0x80, 0x28, 0x2c, 0x37,
+    0x33, 0x00, 0x20, 0x00, 0x81, 0x00, 0x2a, 0xff, 0x96, 0x1b, 0x6c, 0xb9, 0x36, 0x50, 0x16, 0x86,
+    0x80, 0x74, 0x30, 0x18, 0x20, 0x12, 0x9c, 0x00, 0x2c, 0x7c, 0x00, 0x09, 0x0e, 0x80, 0x00, 0x40,
+    0xc3, 0x84, 0x06, 0x86, 0x80, 0x84, 0x88, 0x0a, 0x15, 0x86, 0x80, 0x70, 0x2e, 0x10, 0xc2, 0x81,
+    0xb0, 0xb4, 0x24, 0x69, 0x6f, 0x90, 0x84, 0x2b, 0xb8, 0xb2, 0x0c, 0x08, 0xa0, 0x08, 0x80, 0x23,
+    0x08, 0x06, 0x3d, 0x3c, 0x80, 0x0a, 0x10, 0x86, 0x80, 0x58, 0x11, 0x80, 0x80, 0xa0, 0x70, 0xf0,
+    0x84, 0x13, 0x2f, 0xb1, 0x10, 0x86, 0x80, 0x44, 0x64, 0x64, 0x70, 0x77, 0x88, 0x06, 0xd3, 0xd0,
+    0x6f, 0x90, 0x10, 0x86, 0x80, 0x44, 0x2e, 0x08, 0x80, 0x48, 0x2a, 0xff, 0x9b, 0xb1, 0x6e, 0x40,
+    0x2c, 0x40, 0xf1, 0xc5, 0x2f, 0xc3, 0x10, 0x86, 0x80, 0x34, 0xd4, 0xc7, 0x70, 0xf0, 0x84, 0x2b,
+    0xb8, 0xb2, 0x2c, 0x11, 0x0c, 0x08, 0xa0, 0x02, 0x80, 0x21, 0x2a, 0xff, 0x95, 0x9d, 0x24, 0x64,
+    0x11, 0x86, 0x80, 0x80, 0x16, 0x86, 0x80, 0x7c, 0xd7, 0xc0, 0xc2, 0x83, 0x06, 0x86, 0x80, 0x84,
+    0x00, 0x09, 0x0f, 0x00, 0x00, 0x40, 0x15, 0x86, 0x80, 0x78, 0x09, 0x03, 0xa0, 0x02, 0xd1, 0x21,
+    0x84, 0x0d, 0x10, 0x86, 0x80, 0x84, 0x88, 0x18, 0x00, 0x86, 0x80, 0x90, 0x10, 0x86, 0x80, 0x88,
+    0x70, 0x77, 0x80, 0x0c, 0x94, 0xc2, 0x05, 0x86, 0x80, 0x90, 0x06, 0x86, 0x80, 0x90, 0x30, 0x00,
+    0x20, 0x00, 0x81, 0x00, 0x11, 0x86, 0x80, 0x90, 0x2c, 0x31, 0x07, 0x86, 0x80, 0x8c, 0x00, 0x86,
+    0x80, 0x94, 0xb0, 0xb4, 0x24, 0x69, 0x38, 0x00, 0x20, 0xa6, 0x80, 0x08, 0x84, 0x05, 0x88, 0x0f,
+    0xd0, 0x22, 0x84, 0x0d, 0x38, 0x00, 0x20, 0xaa, 0x80, 0x08, 0x90, 0xc0, 0x43, 0x10, 0x16, 0x86,
+    0x80, 0x8c, 0xc5, 0x6f, 0x11, 0x05, 0xa0, 0x04, 0x90, 0xc0, 0x90, 0xc0, 0xf1, 0xd2, 0x24, 0xea,
+    0xcd, 0x51, 0x84, 0x45, 0x2a, 0xff, 0x95, 0x19, 0x34, 0x56, 0x13, 0x5f, 0x11, 0x86, 0x80, 0x90,
+    0x35, 0x50, 0xcc, 0x59, 0x2a, 0xff, 0x00, 0x09, 0x0f, 0x80, 0x00, 0x40, 0x95, 0x09, 0x34, 0x51,
+    0x11, 0x86, 0x80, 0x94, 0x2c, 0x52, 0xfa, 0x48, 0x2a, 0xff, 0x9a, 0xfb, 0xcc, 0x50, 0x35, 0x50,
+    0xcd, 0x59, 0x20, 0x75, 0x38, 0xe1, 0xfa, 0xc8, 0x2c, 0x75, 0x24, 0xea, 0xcd, 0x51, 0x74, 0x40,
+    0x7c, 0x48, 0x64, 0x65, 0x7c, 0x48, 0x74, 0x58, 0x81, 0xc2, 0x40, 0x5a, 0xc5, 0x67, 0xcc, 0x59,
+    0x01, 0x86, 0x80, 0x88, 0x27, 0xe8, 0x9f, 0xd8, 0x30, 0x24, 0x3f, 0x50, 0x80, 0x09, 0xe7, 0xe8,
+    0x31, 0x24, 0x3f, 0x30, 0x80, 0x09, 0x83, 0xfb, 0x2f, 0x90, 0xf1, 0xc7, 0x64, 0xe9, 0x84, 0x09,
+    0xf0, 0xc8, 0x88, 0x60, 0x64, 0x66, 0xf0, 0xc8, 0x24, 0x69, 0xc3, 0xfe, 0x84, 0x09, 0x64, 0xe6,
+    0x88, 0x52, 0x74, 0x51, 0xd1, 0x10, 0x25, 0x64, 0xd3, 0x11, 0x27, 0x64, 0xdd, 0x03, 0xdf, 0x03,
+    0x2e, 0x7d, 0x32, 0x08, 0x20, 0x00, 0x80, 0x00, 0xd4, 0x96, 0x28, 0xf0, 0x00, 0x09, 0x10, 0x00,
+    0x00, 0x40, 0xd4, 0x16, 0x20, 0x30, 0x76, 0x51, 0x6c, 0x7c, 0x72, 0x72, 0x94, 0xc2, 0x7c, 0x62,
+    0x7c, 0xe2, 0x70, 0xc0, 0xd8, 0x19, 0x32, 0x04, 0x31, 0xe0, 0x80, 0x09, 0x92, 0xc2, 0xc7, 0x81,
+    0x2c, 0xbf, 0xd7, 0x30, 0x84, 0x0e, 0xd8, 0x10, 0x78, 0xe1, 0xd4, 0x19, 0x78, 0x41, 0x88, 0x0a,
+    0x74, 0x40, 0x33, 0x24, 0x3e, 0xb0, 0x80, 0x09, 0x31, 0x24, 0x3f, 0x50, 0x80, 0x09, 0x83, 0x89,
+    0x24, 0xe9, 0x37, 0xd1, 0xe7, 0x48, 0x84, 0x06, 0xee, 0xea, 0xc7, 0x81, 0x27, 0xe8, 0xf0, 0xca,
+    0x94, 0xc7, 0x64, 0x66, 0x67, 0xe6, 0x70, 0x77, 0x84, 0x07, 0xf7, 0xca, 0x67, 0xe6, 0xf1, 0xc9,
+    0x74, 0x51, 0x64, 0x66, 0x70, 0x77, 0x84, 0x07, 0x77, 0xd1, 0x67, 0xe6, 0x2d, 0x10, 0xd1, 0x97,
+    0x25, 0xe4, 0xc1, 0x90, 0x2f, 0x39, 0xf0, 0xca, 0x2e, 0x7c, 0x64, 0x66, 0xd7, 0x9e, 0x34, 0xf7,
+    0xd4, 0x1e, 0x00, 0x09, 0x10, 0x80, 0x00, 0x40, 0x32, 0x44, 0x20, 0x00, 0x80, 0x09, 0x74, 0x70,
+    0xf1, 0xca, 0x24, 0xe8, 0x24, 0x64, 0xf0, 0x42, 0x80, 0x05, 0xf0, 0x42, 0x34, 0xf7, 0xf7, 0xc9,
+    0x74, 0x57, 0x64, 0x66, 0xd4, 0x1e, 0x32, 0x44, 0x20, 0x00, 0x80, 0x09, 0x74, 0x70, 0x27, 0xe8,
+    0x24, 0x64, 0xc8, 0x40, 0x80, 0x08, 0xf8, 0x41, 0xc8, 0x40, 0xf8, 0x41, 0xf0, 0xc2, 0x00, 0x9e,
+    0xf0, 0xc1, 0x30, 0x24, 0x3f, 0x50, 0x80, 0x09, 0x00, 0x96, 0xe7, 0x68, 0x2b, 0xff, 0x9f, 0x01,
+    0xe7, 0x50, 0xf0, 0xcc, 0x24, 0x66, 0xee, 0xea, 0x36, 0x10, 0x8f, 0xff, 0x80, 0x1b, 0xf0, 0xcb,
+    0x64, 0x66, 0x36, 0x10, 0x8f, 0xff, 0x80, 0x11, 0xf0, 0xcb, 0x3c, 0x4c, 0xf1, 0xcc, 0x3c, 0xcc,
+    0xc8, 0x40, 0xf1, 0x4c, 0xf8, 0x4b, 0xf0, 0xcc, 0x64, 0x69, 0x84, 0x13, 0xf0, 0xcb, 0x24, 0x69,
+    0x2c, 0x10, 0xe8, 0x38, 0x84, 0x09, 0xf0, 0x44, 0x00, 0x09, 0x11, 0x00, 0x00, 0x40, 0x88, 0x20,
+    0xf8, 0x43, 0xf1, 0xcc, 0xf0, 0xcb, 0xf1, 0x42, 0x2a, 0xff, 0x9e, 0xc1, 0xf0, 0x41, 0x34, 0xd0,
+    0xf2, 0xcc, 0xf0, 0xcb, 0x27, 0xea, 0x9f, 0xf0, 0xf2, 0x42, 0x83, 0x20, 0xf0, 0x41, 0xf0, 0xc4,
+    0x00, 0x9e, 0xf0, 0xc3, 0x30, 0x24, 0x3f, 0x50, 0x80, 0x09, 0x00, 0x96, 0xe7, 0x70, 0x35, 0x50,
+    0x34, 0x51, 0xe7, 0x50, 0x3d, 0x4e, 0x3c, 0x4e, 0xf4, 0xc8, 0x3e, 0x4e, 0xcc, 0x56, 0xf4, 0x48,
+    0x05, 0xfc, 0x9f, 0xe0, 0x20, 0xf6, 0xf6, 0xc7, 0x2c, 0xf6, 0x3f, 0x4e, 0xf2, 0x44, 0x36, 0xd1,
+    0xf0, 0x43, 0x03, 0xfc, 0x9f, 0xf0, 0x22, 0x75, 0x01, 0xfc, 0x9f, 0xf4, 0x2e, 0x75, 0x21, 0x74,
+    0xf6, 0x47, 0x2d, 0x74, 0xcd, 0x57, 0x2c, 0xc8, 0x07, 0xfc, 0x9f, 0xe4, 0x20, 0x77, 0x7c, 0xee,
+    0x2c, 0x77, 0x3c, 0xc2, 0xcd, 0x5f, 0x2c, 0x41, 0xf1, 0x42, 0x3c, 0x6e, 0xcc, 0x5e, 0x00, 0x09,
+    0x11, 0x80, 0x00, 0x40, 0x7c, 0x42, 0xc8, 0x40, 0xf0, 0xc2, 0x00, 0x9a, 0xf8, 0x41, 0xf0, 0xc1,
+    0x00, 0x92, 0xe7, 0x70, 0x9f, 0x71, 0x35, 0x50, 0x34, 0x51, 0xe7, 0x48, 0x3c, 0x4e, 0x7d, 0x4e,
+    0xf0, 0x41, 0x01, 0xfc, 0x9f, 0xfc, 0x22, 0x74, 0xf2, 0x42, 0x2e, 0x74, 0x03, 0xfc, 0x9f, 0xf8,
+    0x20, 0x75, 0xe7, 0x68, 0x6c, 0x75, 0x6c, 0x40, 0x7c, 0x6e, 0x9f, 0x70, 0x7c, 0x42, 0x31, 0x64,
+    0x2c, 0xe4, 0x80, 0x08, 0x31, 0x09, 0x20, 0x00, 0x80, 0x00, 0xe7, 0x48, 0xd4, 0xc0, 0xf1, 0x42,
+    0x83, 0xee, 0xf0, 0xc2, 0xe7, 0x68, 0x9f, 0x71, 0x31, 0x04, 0x31, 0xba, 0x80, 0x09, 0x90, 0xc0,
+    0x90, 0xc0, 0x90, 0xc0, 0x10, 0x05, 0xa0, 0x3b, 0x90, 0xc0, 0x21, 0x61, 0x80, 0x00, 0x98, 0xc0,
+    0xd1, 0x10, 0xd2, 0x10, 0x64, 0x66, 0xf5, 0xc1, 0x35, 0xd1, 0x64, 0x69, 0x98, 0xc0, 0x79, 0x41,
+    0x66, 0x64, 0x2b, 0x03, 0x00, 0x09, 0x12, 0x00, 0x00, 0x40, 0x80, 0x22, 0x96, 0xc2, 0x31, 0x04,
+    0x32, 0x32, 0x80, 0x09, 0x98, 0xc0, 0x35, 0xfa, 0x9f, 0xfe, 0x7e, 0x61, 0x93, 0x46, 0x94, 0xc0,
+    0xd4, 0x1a, 0x7a, 0x47, 0x38, 0x10, 0xa0, 0x0d, 0x60, 0x39, 0x60, 0xb1, 0x69, 0x70, 0x34, 0x00,
+    0xa8, 0x44, 0x60, 0x58, 0x34, 0x00, 0xa8, 0x40, 0x6c, 0xd0, 0x60, 0x31, 0x94, 0xc0, 0x9f, 0x70,
+    0xd4, 0x1c, 0xc5, 0x65, 0x90, 0xc0, 0x94, 0xc0, 0x96, 0x20, 0x97, 0x20, 0x96, 0xc0, 0x5d, 0x98,
+    0x2a, 0x03, 0x80, 0xb2, 0x19, 0x98, 0x10, 0x05, 0xa0, 0x3f, 0x1a, 0x98, 0x11, 0x05, 0xa0, 0x04,
+    0x5c, 0x98, 0x34, 0x20, 0xa0, 0x00, 0x53, 0x18, 0x38, 0x00, 0xa1, 0x01, 0x50, 0x9a, 0xef, 0xec,
+    0x79, 0xe1, 0x36, 0x40, 0xa0, 0x00, 0x52, 0x9a, 0x9a, 0x43, 0x54, 0x9a, 0x56, 0x9a, 0x34, 0x20,
+    0xa0, 0x00, 0x50, 0x92, 0x38, 0x00, 0xa0, 0x08, 0x67, 0x64, 0x00, 0x09, 0x12, 0x80, 0x00, 0x40,
+    0x64, 0x64, 0x51, 0x59, 0x13, 0x9c, 0x7c, 0xe2, 0x55, 0x9c, 0x57, 0x9c, 0x34, 0x20, 0xa0, 0x00,
+    0x51, 0x9c, 0x3a, 0x00, 0xa0, 0x0f, 0x6e, 0x68, 0x6e, 0xe9, 0x6f, 0x6a, 0x6f, 0xeb, 0x3a, 0x00,
+    0xa4, 0x2f, 0x6e, 0x60, 0x6e, 0xe1, 0x6f, 0x62, 0x6d, 0xe8, 0x3a, 0x00, 0xa4, 0x2f, 0x7e, 0x70,
+    0x7e, 0xf0, 0x6f, 0xe3, 0x6d, 0xe0, 0x3a, 0x00, 0xa0, 0x0f, 0x62, 0x11, 0x7f, 0x70, 0x7f, 0xf0,
+    0x7d, 0xf0, 0x3a, 0x00, 0xa4, 0x2f, 0x62, 0x9d, 0x63, 0x15, 0x63, 0x9f, 0x61, 0x91, 0x38, 0x00,
+    0xb8, 0xcc, 0x6e, 0xd5, 0x6f, 0xdf, 0xc5, 0x43, 0x36, 0x00, 0xa8, 0x44, 0x6f, 0xdb, 0xc3, 0x41,
+    0x38, 0x20, 0xa8, 0x44, 0x6d, 0x4f, 0x51, 0x59, 0xc1, 0x47, 0x38, 0x00, 0xa8, 0x41, 0x6f, 0xdc,
+    0x7c, 0xe2, 0x7d, 0x43, 0x3a, 0x00, 0xa0, 0x0f, 0x6e, 0x68, 0x6e, 0xe9, 0x6f, 0x6a, 0x6f, 0xeb,
+    0x00, 0x09, 0x13, 0x00, 0x00, 0x40, 0x3a, 0x00, 0xa4, 0x2f, 0x6e, 0x60, 0x6e, 0xe1, 0x6f, 0x62,
+    0x6d, 0xe8, 0x3a, 0x00, 0xa4, 0x2f, 0x7e, 0x70, 0x7e, 0xf0, 0x6f, 0xe3, 0x6d, 0xe0, 0x3a, 0x00,
+    0xa0, 0x0f, 0x62, 0x11, 0x7f, 0x70, 0x7f, 0xf0, 0x7d, 0xf0, 0x3a, 0x00, 0xa4, 0x2f, 0x62, 0x9d,
+    0x63, 0x15, 0x63, 0x9f, 0x61, 0x91, 0x3a, 0x00, 0xb8, 0xce, 0x6e, 0xd5, 0x6f, 0xdf, 0xc5, 0x43,
+    0x65, 0x65, 0x38, 0x30, 0xa8, 0x44, 0x6f, 0xdb, 0xc3, 0x41, 0x42, 0x5d, 0x38, 0x20, 0xa8, 0x44,
+    0x6d, 0x4f, 0x51, 0x59, 0xc1, 0x47, 0x38, 0x00, 0xa8, 0x41, 0x6f, 0xdc, 0x7c, 0xe2, 0x7d, 0x43,
+    0x34, 0x20, 0xa0, 0x00, 0xec, 0xef, 0x34, 0x00, 0xa0, 0x04, 0x65, 0x65, 0x34, 0x20, 0xa0, 0x00,
+    0x42, 0x5d, 0x94, 0xc0, 0x43, 0x94, 0xb5, 0x61, 0x36, 0x40, 0xa0, 0x00, 0xb7, 0x62, 0xb1, 0x63,
+    0x94, 0xc0, 0x96, 0x21, 0x97, 0x21, 0x00, 0x09, 0x13, 0x80, 0x00, 0x40, 0x94, 0xc0, 0x9f, 0x70,
+    0xf3, 0xc1, 0xc5, 0x63, 0x94, 0xc0, 0x96, 0x20, 0x97, 0x20, 0x96, 0xc0, 0x5d, 0x98, 0x2a, 0x03,
+    0x80, 0xb2, 0x19, 0x98, 0x10, 0x05, 0xa0, 0x3f, 0x1a, 0x98, 0x11, 0x05, 0xa0, 0x04, 0x5c, 0x98,
+    0x34, 0x20, 0xa0, 0x00, 0x53, 0x18, 0x38, 0x00, 0xa1, 0x01, 0x50, 0x9a, 0xef, 0xec, 0x79, 0xe1,
+    0x36, 0x40, 0xa0, 0x00, 0x52, 0x9a, 0x9a, 0x43, 0x54, 0x9a, 0x56, 0x9a, 0x34, 0x20, 0xa0, 0x00,
+    0x50, 0x92, 0x38, 0x00, 0xa0, 0x08, 0x67, 0x64, 0x64, 0x64, 0x51, 0x99, 0x13, 0x9c, 0x7c, 0xe2,
+    0x55, 0x9c, 0x57, 0x9c, 0x34, 0x20, 0xa0, 0x00, 0x51, 0x9c, 0x3a, 0x00, 0xa0, 0x0f, 0x6e, 0x68,
+    0x6e, 0xe9, 0x6f, 0x6a, 0x6f, 0xeb, 0x3a, 0x00, 0xa4, 0x2f, 0x6e, 0x60, 0x6e, 0xe1, 0x6f, 0x62,
+    0x6d, 0xe8, 0x3a, 0x00, 0xa4, 0x2f, 0x7e, 0x70, 0x7e, 0xf0, 0x6f, 0xe3, 0x00, 0x09, 0x14, 0x00,
+    0x00, 0x40, 0x6d, 0xe0, 0x3a, 0x00, 0xa0, 0x0f, 0x62, 0x11, 0x7f, 0x70, 0x7f, 0xf0, 0x7d, 0xf0,
+    0x3a, 0x00, 0xa4, 0x2f, 0x62, 0x9d, 0x63, 0x15, 0x63, 0x9f, 0x61, 0x91, 0x38, 0x00, 0xb8, 0xcc,
+    0x6e, 0xd5, 0x6f, 0xdf, 0xc5, 0x43, 0x36, 0x00, 0xa8, 0x44, 0x6f, 0xdb, 0xc3, 0x41, 0x38, 0x20,
+    0xa8, 0x40, 0x6f, 0xcf, 0x51, 0x99, 0xc1, 0x47, 0x38, 0x20, 0xa0, 0x00, 0x7f, 0xc4, 0x7c, 0xe2,
+    0xc2, 0x47, 0x3a, 0x00, 0xa0, 0x0f, 0x6e, 0x68, 0x6e, 0xe9, 0x6f, 0x6a, 0x6f, 0xeb, 0x3a, 0x00,
+    0xa4, 0x2f, 0x6e, 0x60, 0x6e, 0xe1, 0x6f, 0x62, 0x6d, 0xe8, 0x3a, 0x00, 0xa4, 0x2f, 0x7e, 0x70,
+    0x7e, 0xf0, 0x6f, 0xe3, 0x6d, 0xe0, 0x3a, 0x00, 0xa0, 0x0f, 0x62, 0x11, 0x7f, 0x70, 0x7f, 0xf0,
+    0x7d, 0xf0, 0x3a, 0x00, 0xa4, 0x2f, 0x62, 0x9d, 0x63, 0x15, 0x63, 0x9f, 0x61, 0x91, 0x3a, 0x00,
+    0xb8, 0xce, 0x00, 0x09, 0x14, 0x80, 0x00, 0x40, 0x6e, 0xd5, 0x6f, 0xdf, 0xc5, 0x43, 0x7d, 0x46,
+    0x38, 0x10, 0xa8, 0x45, 0x6f, 0xdb, 0xc3, 0x41, 0x65, 0x65, 0x38, 0x20, 0xa8, 0x40, 0x6f, 0xcf,
+    0x51, 0x99, 0xc1, 0x47, 0x3a, 0x60, 0xa0, 0x00, 0x7f, 0xc4, 0x7c, 0xe2, 0xc2, 0x47, 0x42, 0xdd,
+    0x36, 0x20, 0xa0, 0x08, 0xec, 0xef, 0x7d, 0x46, 0x34, 0x00, 0xa0, 0x04, 0x65, 0x65, 0x34, 0x20,
+    0xa0, 0x00, 0x42, 0xdd, 0x94, 0xc0, 0x43, 0x94, 0xb5, 0x61, 0x36, 0x40, 0xa0, 0x00, 0xb7, 0x62,
+    0xb1, 0x63, 0x94, 0xc0, 0x96, 0x21, 0x97, 0x21, 0x94, 0xc0, 0x9f, 0x70, 0xf3, 0xc1, 0xc5, 0x63,
+    0x38, 0x60, 0x28, 0x80, 0x80, 0x09, 0xc9, 0x40, 0x90, 0xc0, 0xa9, 0xc1, 0x28, 0x80, 0x9f, 0x71,
+    0x9f, 0x70, 0x48, 0x11, 0xc8, 0x40, 0x39, 0x60, 0x28, 0x80, 0x80, 0x09, 0xe8, 0xfe, 0x3a, 0x00,
+    0x3e, 0x10, 0x80, 0x0a, 0xe9, 0x18, 0x19, 0x91, 0x00, 0x09, 0x15, 0x00, 0x00, 0x40, 0xe8, 0x1a,
+    0x50, 0x90, 0x64, 0x69, 0x80, 0x09, 0x28, 0x80, 0x90, 0xc0, 0x48, 0x11, 0x9f, 0x71, 0x31, 0xe4,
+    0x3c, 0x8a, 0x80, 0x01, 0x31, 0x24, 0x3f, 0x30, 0x80, 0x09, 0x83, 0xfb, 0x2c, 0x90, 0x3b, 0x00,
+    0x36, 0x1e, 0x80, 0x0a, 0x0b, 0x02, 0x3e, 0x28, 0x80, 0x0a, 0xeb, 0x4e, 0x0b, 0x02, 0x3e, 0x2c,
+    0x80, 0x0a, 0xeb, 0x44, 0x2b, 0x08, 0x80, 0x82, 0x08, 0x02, 0x3e, 0x38, 0x80, 0x0a, 0xe8, 0x4e,
+    0x08, 0x02, 0x3e, 0x3c, 0x80, 0x0a, 0xe8, 0x44, 0x28, 0x09, 0x80, 0x82, 0x09, 0x02, 0x3e, 0x48,
+    0x80, 0x0a, 0xe9, 0x4e, 0x09, 0x02, 0x3e, 0x4c, 0x80, 0x0a, 0x34, 0x01, 0x3e, 0xac, 0x80, 0x0a,
+    0x33, 0xe1, 0x3d, 0xd8, 0x80, 0x09, 0x30, 0x01, 0x20, 0x18, 0x80, 0x0a, 0xe9, 0x44, 0x32, 0xe1,
+    0x3e, 0x98, 0x80, 0x09, 0x29, 0x0a, 0x80, 0xe4, 0x04, 0x02, 0x3e, 0x10, 0x80, 0x0a, 0x00, 0x09,
+    0x15, 0x80, 0x00, 0x40, 0x00, 0x02, 0x3e, 0x34, 0x80, 0x0a, 0x30, 0xa1, 0x35, 0xac, 0x80, 0x09,
+    0x03, 0x02, 0x3e, 0x24, 0x80, 0x0a, 0x34, 0xa1, 0x36, 0x6c, 0x80, 0x09, 0x33, 0x01, 0x23, 0x18,
+    0x80, 0x0a, 0x02, 0x02, 0x3e, 0x44, 0x80, 0x0a, 0xe7, 0x58, 0xc2, 0xa3, 0x0b, 0x02, 0x3e, 0x30,
+    0x80, 0x0a, 0x08, 0x02, 0x3e, 0x40, 0x80, 0x0a, 0x09, 0x02, 0x3e, 0x50, 0x80, 0x0a, 0x03, 0x02,
+    0x3e, 0x6c, 0x80, 0x0a, 0x0a, 0x02, 0x3e, 0x70, 0x80, 0x0a, 0x04, 0x02, 0x3e, 0x94, 0x80, 0x0a,
+    0x00, 0x02, 0x3e, 0x98, 0x80, 0x0a, 0x2a, 0xff, 0x9f, 0x07, 0x74, 0x51, 0x39, 0x61, 0x78, 0xc1,
+    0x65, 0x6a, 0x81, 0xf5, 0x2c, 0x90, 0x2f, 0x10, 0x2d, 0x10, 0x39, 0x00, 0x3d, 0x68, 0x80, 0x0a,
+    0x30, 0x01, 0x3e, 0xac, 0x80, 0x0a, 0xc7, 0x82, 0xee, 0xe9, 0x01, 0x00, 0x3e, 0xf4, 0x80, 0x0a,
+    0x01, 0x00, 0x3e, 0xf0, 0x00, 0x09, 0x16, 0x00, 0x00, 0x40, 0x80, 0x0a, 0x00, 0x02, 0x3e, 0xa0,
+    0x80, 0x0a, 0x00, 0x02, 0x3e, 0xa8, 0x80, 0x0a, 0x00, 0x02, 0x3e, 0x9c, 0x80, 0x0a, 0x00, 0x02,
+    0x3e, 0xa4, 0x80, 0x0a, 0x3f, 0x00, 0x3e, 0x10, 0x80, 0x0a, 0x2c, 0x90, 0xc8, 0x42, 0x0a, 0x86,
+    0x3a, 0x4c, 0x80, 0x09, 0x20, 0x00, 0x80, 0x54, 0xea, 0x18, 0xf0, 0x41, 0xf2, 0x43, 0xf9, 0x44,
+    0xfa, 0x45, 0x2a, 0xff, 0x9e, 0xd9, 0xe8, 0xe9, 0xfa, 0xc5, 0xf2, 0xc3, 0x10, 0xd2, 0xf9, 0xc4,
+    0x36, 0x10, 0x80, 0x22, 0x80, 0x07, 0x88, 0x06, 0xc8, 0x40, 0xe8, 0x38, 0x27, 0x69, 0x08, 0x16,
+    0xf8, 0x04, 0x84, 0x21, 0xe8, 0xf9, 0xa0, 0xf8, 0x29, 0x0b, 0x80, 0x14, 0x00, 0x02, 0x3e, 0x9c,
+    0x80, 0x0a, 0xf0, 0x84, 0x0b, 0x02, 0x3e, 0xa0, 0x80, 0x0a, 0x88, 0x24, 0x00, 0x00, 0x3e, 0xf0,
+    0x80, 0x0a, 0xe8, 0xf9, 0xa0, 0xf8, 0x29, 0x0b, 0x80, 0x14, 0x00, 0x09, 0x16, 0x80, 0x00, 0x40,
+    0x00, 0x02, 0x3e, 0xa4, 0x80, 0x0a, 0xf0, 0x84, 0x0b, 0x02, 0x3e, 0xa8, 0x80, 0x0a, 0x00, 0x00,
+    0x3e, 0xf4, 0x80, 0x0a, 0xb8, 0x91, 0xee, 0x44, 0x48, 0x16, 0x2a, 0xff, 0x9e, 0x53, 0x2e, 0x0e,
+    0x80, 0x50, 0x3b, 0xe1, 0x3b, 0x41, 0xf9, 0xc4, 0x67, 0xea, 0x29, 0x09, 0x80, 0x54, 0x81, 0x72,
+    0x35, 0x02, 0x80, 0x20, 0x30, 0x24, 0x3f, 0x50, 0x80, 0x09, 0xe7, 0x78, 0x2b, 0xff, 0x9e, 0x5b,
+    0x2c, 0x90, 0x2d, 0x90, 0x2e, 0x10, 0x38, 0x00, 0x3d, 0x6c, 0x80, 0x0a, 0xc8, 0x4e, 0x28, 0x0a,
+    0x80, 0x10, 0xe8, 0xea, 0xee, 0xea, 0xe8, 0x64, 0xed, 0xea, 0xec, 0xea, 0xeb, 0xea, 0x2b, 0x02,
+    0x80, 0x2a, 0xe7, 0x48, 0xc2, 0x82, 0xc8, 0x4f, 0xeb, 0x6e, 0xec, 0x68, 0xed, 0x6c, 0xee, 0x72,
+    0x39, 0x00, 0x3d, 0x68, 0x80, 0x0a, 0xc8, 0x43, 0x0f, 0x86, 0x3a, 0x50, 0x80, 0x09, 0x90, 0xc0,
+    0x00, 0x09, 0x17, 0x00, 0x00, 0x40, 0xe8, 0x1f, 0xe1, 0xe8, 0x08, 0x86, 0x3a, 0x4c, 0x80, 0x09,
+    0xcf, 0x43, 0x90, 0xc0, 0xef, 0x18, 0x10, 0xd7, 0xe0, 0xef, 0x36, 0x10, 0x80, 0x22, 0x80, 0x07,
+    0x88, 0x06, 0xc8, 0x40, 0xe8, 0x38, 0x24, 0xe9, 0x08, 0x11, 0xf8, 0x04, 0x84, 0x27, 0x3f, 0x00,
+    0x3e, 0x10, 0x80, 0x0a, 0xe8, 0xf9, 0xa0, 0xf8, 0x29, 0x08, 0x80, 0x14, 0xf5, 0x84, 0x00, 0x02,
+    0x3e, 0x9c, 0x80, 0x0a, 0x08, 0x02, 0x3e, 0xa0, 0x80, 0x0a, 0x88, 0x2a, 0x05, 0x00, 0x3e, 0xf0,
+    0x80, 0x0a, 0x3f, 0x00, 0x3e, 0x10, 0x80, 0x0a, 0xe8, 0xf9, 0xa0, 0xf8, 0x29, 0x08, 0x80, 0x14,
+    0xf5, 0x84, 0x00, 0x02, 0x3e, 0xa4, 0x80, 0x0a, 0x08, 0x02, 0x3e, 0xa8, 0x80, 0x0a, 0x05, 0x00,
+    0x3e, 0xf4, 0x80, 0x0a, 0x50, 0x16, 0x30, 0x65, 0xc9, 0x4d, 0x80, 0x39, 0x2b, 0xff, 0x9d, 0x63,
+    0xc9, 0x45, 0xe2, 0xea, 0x2a, 0xff, 0x00, 0x09, 0x17, 0x80, 0x00, 0x40, 0x9d, 0x6f, 0x50, 0x11,
+    0xc8, 0x46, 0x90, 0xc0, 0x04, 0x10, 0xc8, 0x47, 0x04, 0x95, 0xea, 0xe2, 0x04, 0x94, 0xc9, 0x45,
+    0x44, 0x13, 0x97, 0x60, 0x44, 0x90, 0xe8, 0xea, 0x92, 0xc8, 0x44, 0x18, 0xe8, 0xe1, 0x44, 0x18,
+    0x44, 0x18, 0x44, 0x10, 0x50, 0x11, 0x40, 0x16, 0x39, 0x61, 0x38, 0xc1, 0xc8, 0x46, 0x25, 0x6a,
+    0xef, 0xe0, 0xb0, 0xb9, 0x40, 0x38, 0xc8, 0x4e, 0xc8, 0x47, 0x2d, 0x0d, 0x80, 0x54, 0x28, 0x08,
+    0x80, 0x54, 0x2c, 0x0c, 0x80, 0x54, 0x2e, 0x0e, 0x80, 0x54, 0x2b, 0x0b, 0x80, 0x54, 0x2a, 0x0a,
+    0x80, 0x54, 0x29, 0x09, 0x80, 0x54, 0x37, 0x03, 0x80, 0x20, 0x81, 0x18, 0xc8, 0x4f, 0x30, 0x24,
+    0x3f, 0x50, 0x80, 0x09, 0xe7, 0x68, 0x01, 0x04, 0x3e, 0xf0, 0x80, 0x0a, 0x30, 0xe0, 0x09, 0x06,
+    0x3e, 0x9c, 0x80, 0x0a, 0x84, 0x1f, 0x19, 0x11, 0x08, 0x06, 0x3e, 0xa0, 0x00, 0x09, 0x18, 0x00,
+    0x00, 0x40, 0x80, 0x0a, 0x90, 0xc0, 0x49, 0x10, 0x08, 0x06, 0x3e, 0xa0, 0x80, 0x0a, 0x90, 0xc0,
+    0xe8, 0x42, 0x08, 0x02, 0x3e, 0xa0, 0x80, 0x0a, 0x01, 0x04, 0x3e, 0xf4, 0x80, 0x0a, 0x30, 0xe0,
+    0x09, 0x06, 0x3e, 0xa4, 0x80, 0x0a, 0x84, 0x1f, 0x19, 0x11, 0x08, 0x06, 0x3e, 0xa8, 0x80, 0x0a,
+    0x90, 0xc0, 0x49, 0x10, 0x08, 0x06, 0x3e, 0xa8, 0x80, 0x0a, 0x90, 0xc0, 0xe8, 0x42, 0x08, 0x02,
+    0x3e, 0xa8, 0x80, 0x0a, 0x9f, 0x71, 0x33, 0x24, 0x3f, 0x30, 0x80, 0x09, 0x37, 0x50, 0x00, 0x04,
+    0x3e, 0xf0, 0x80, 0x0a, 0x30, 0x66, 0xe7, 0x48, 0x84, 0x1d, 0x00, 0x04, 0x3e, 0xf2, 0x80, 0x0a,
+    0xf0, 0x41, 0x09, 0x06, 0x3e, 0x9c, 0x80, 0x0a, 0x32, 0xe4, 0x3c, 0x84, 0x80, 0x01, 0x08, 0x06,
+    0x3e, 0xa0, 0x80, 0x0a, 0x00, 0x04, 0x3e, 0xf4, 0x80, 0x0a, 0x30, 0x66, 0x00, 0x04, 0x3e, 0xf2,
+    0x80, 0x0a, 0x00, 0x09, 0x18, 0x80, 0x00, 0x40, 0x84, 0x17, 0xf0, 0x41, 0x09, 0x06, 0x3e, 0xa4,
+    0x80, 0x0a, 0x32, 0xe4, 0x3c, 0x84, 0x80, 0x01, 0x08, 0x06, 0x3e, 0xa8, 0x80, 0x0a, 0x30, 0x24,
+    0x3f, 0x50, 0x80, 0x09, 0xe7, 0x68, 0x2b, 0xff, 0x9c, 0x79, 0x2d, 0x10, 0x2d, 0x90, 0x38, 0x00,
+    0x3d, 0x6e, 0x80, 0x0a, 0x3e, 0x00, 0x3d, 0x68, 0x80, 0x0a, 0x28, 0x0a, 0x80, 0x0a, 0x2a, 0x0b,
+    0x80, 0x04, 0x92, 0x42, 0x2a, 0x03, 0x80, 0x22, 0xed, 0xeb, 0xec, 0xeb, 0xe9, 0xe8, 0x21, 0x21,
+    0x86, 0x88, 0x2b, 0x02, 0x80, 0x2a, 0x27, 0xc0, 0x83, 0xca, 0xe7, 0x48, 0xe0, 0xee, 0xe9, 0x62,
+    0xec, 0x6c, 0xed, 0x68, 0xc4, 0x9e, 0xee, 0xe0, 0x10, 0x3e, 0x0f, 0x86, 0x3a, 0x50, 0x80, 0x09,
+    0x24, 0x69, 0xe0, 0xee, 0xce, 0x42, 0x80, 0xc2, 0xef, 0x1e, 0x50, 0x1f, 0x10, 0x0f, 0xda, 0x90,
+    0x31, 0xf8, 0x9f, 0xff, 0x15, 0x95, 0xdc, 0x1d, 0x00, 0x09, 0x19, 0x00, 0x00, 0x40, 0x24, 0x61,
+    0xe1, 0xef, 0x72, 0xe0, 0x80, 0x05, 0x43, 0x94, 0x00, 0x04, 0x3e, 0xec, 0x80, 0x0a, 0x24, 0x6a,
+    0xee, 0xeb, 0x84, 0x3b, 0x9b, 0x40, 0x2b, 0x03, 0x80, 0x04, 0x15, 0x1e, 0x50, 0x92, 0x2b, 0x76,
+    0x55, 0x11, 0x6f, 0x02, 0xd7, 0x1d, 0x6c, 0x42, 0x24, 0x68, 0x00, 0x92, 0x30, 0xe8, 0x3f, 0xff,
+    0xbf, 0xff, 0x80, 0x05, 0x40, 0x92, 0x15, 0x92, 0x50, 0x94, 0x72, 0xf0, 0x90, 0xc0, 0x94, 0xc3,
+    0x23, 0x03, 0x80, 0x0e, 0x92, 0xd0, 0x45, 0x94, 0x90, 0xc0, 0x90, 0xc0, 0x15, 0x92, 0x3f, 0x40,
+    0x3a, 0x06, 0x80, 0x09, 0x66, 0xe9, 0x90, 0xc0, 0x92, 0xc2, 0xc5, 0x81, 0x26, 0xea, 0xd0, 0x15,
+    0x64, 0x64, 0x84, 0x24, 0x92, 0xc3, 0xf7, 0x42, 0x2c, 0x00, 0xd6, 0x90, 0x3a, 0xcd, 0x82, 0x16,
+    0x3c, 0x48, 0xce, 0x45, 0x90, 0xc0, 0xee, 0x1f, 0x95, 0xbe, 0x6c, 0x41, 0x3e, 0x10, 0x00, 0x09,
+    0x19, 0x80, 0x00, 0x40, 0x80, 0x0a, 0x62, 0xf4, 0x6e, 0xf4, 0xf5, 0x42, 0xf0, 0xc2, 0x3c, 0x48,
+    0xef, 0xe1, 0x64, 0x65, 0x7c, 0x48, 0x74, 0x58, 0xd8, 0x18, 0x3c, 0x50, 0x9d, 0x52, 0x40, 0x10,
+    0x55, 0x94, 0x3a, 0xce, 0x84, 0x10, 0x46, 0x1f, 0x3b, 0xfe, 0x9f, 0xff, 0x46, 0x1f, 0x45, 0x95,
+    0x88, 0x1c, 0x40, 0x17, 0x03, 0x11, 0xee, 0xeb, 0x43, 0x94, 0x43, 0x95, 0x97, 0x60, 0x43, 0x10,
+    0x43, 0x92, 0x92, 0xc8, 0x43, 0x1e, 0x43, 0x1f, 0x43, 0x1f, 0x43, 0x17, 0x2d, 0x0d, 0x80, 0x54,
+    0x2c, 0x0c, 0x80, 0x54, 0x2b, 0x0b, 0x80, 0x54, 0x2a, 0x0a, 0x80, 0x54, 0x94, 0xd0, 0x29, 0x09,
+    0x80, 0x54, 0x28, 0x08, 0x80, 0x54, 0x35, 0x02, 0x80, 0x20, 0x30, 0x24, 0x3f, 0x50, 0x80, 0x09,
+    0xe7, 0x68, 0x9f, 0x71, 0x9f, 0x71, 0x9f, 0x71, 0x32, 0x04, 0x38, 0x44, 0x80, 0x09, 0xc0, 0x85,
+    0x9f, 0x71, 0x9f, 0x71, 0x00, 0x09, 0x1a, 0x00, 0x00, 0x40, 0x32, 0x04, 0x37, 0xea, 0x80, 0x09,
+    0xc0, 0x86, 0x9f, 0x71, 0x9f, 0x71, 0x32, 0x04, 0x37, 0xea, 0x80, 0x09, 0xc0, 0x87, 0x9f, 0x71,
+    0x9f, 0x71, 0x32, 0x04, 0x37, 0xea, 0x80, 0x09, 0xc0, 0x88, 0x9f, 0x71, 0x9f, 0x71, 0x32, 0x04,
+    0x38, 0x44, 0x80, 0x09, 0xc0, 0x89, 0x9f, 0x71, 0x9f, 0x71, 0x32, 0x04, 0x37, 0xea, 0x80, 0x09,
+    0xc0, 0x8a, 0x9f, 0x71, 0x9f, 0x71, 0x32, 0x04, 0x37, 0xea, 0x80, 0x09, 0xc0, 0x8b, 0x9f, 0x71,
+    0x9f, 0x71, 0x32, 0x04, 0x37, 0xea, 0x80, 0x09, 0xc0, 0x8c, 0x9f, 0x71, 0x9f, 0x71, 0x32, 0x04,
+    0x38, 0x44, 0x80, 0x09, 0xc0, 0x8d, 0x9f, 0x71, 0x9f, 0x71, 0x32, 0x04, 0x37, 0xea, 0x80, 0x09,
+    0xc0, 0x8e, 0x9f, 0x71, 0x9f, 0x71, 0x32, 0x04, 0x37, 0xea, 0x80, 0x09, 0xc0, 0x8f, 0x9f, 0x71,
+    0x9f, 0x71, 0x32, 0x04, 0x37, 0xea, 0x80, 0x09, 0xc0, 0x90, 0x00, 0x09, 0x1a, 0x80, 0x00, 0x40,
+    0x9f, 0x71, 0x9f, 0x71, 0x32, 0x04, 0x38, 0x44, 0x80, 0x09, 0xc0, 0x97, 0x9f, 0x71, 0x9f, 0x71,
+    0x32, 0x04, 0x37, 0xea, 0x80, 0x09, 0xc0, 0x98, 0x9f, 0x71, 0x9f, 0x71, 0x32, 0x04, 0x38, 0x44,
+    0x80, 0x09, 0xc0, 0xa1, 0x9f, 0x71, 0x9f, 0x71, 0x32, 0x04, 0x38, 0x44, 0x80, 0x09, 0xc0, 0xa2,
+    0x9f, 0x71, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0,
+    0x98, 0xc0, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0xc9, 0xaa, 0x96, 0xc0, 0x6f, 0x90, 0x96, 0x20,
+    0x97, 0x20, 0x96, 0xc0, 0xc2, 0x92, 0x28, 0x0a, 0x82, 0xc2, 0x94, 0xc0, 0x9e, 0x20, 0x9f, 0x20,
+    0x9a, 0xc0, 0x2a, 0x0b, 0x80, 0x28, 0x90, 0xc0, 0x27, 0x0f, 0x80, 0x30, 0x1d, 0x13, 0xeb, 0x39,
+    0x36, 0x40, 0xa0, 0x00, 0xe7, 0xef, 0x53, 0x13, 0x3a, 0x00, 0xa8, 0x00, 0x37, 0x1f, 0x80, 0x0f,
+    0x00, 0x09, 0x1b, 0x00, 0x00, 0x40, 0xf7, 0x47, 0xcd, 0x4b, 0x3c, 0x60, 0xa0, 0x00, 0xd7, 0xa2,
+    0x55, 0x12, 0x31, 0x18, 0x30, 0xb5, 0xbf, 0xf4, 0x3e, 0x47, 0xb0, 0x00, 0x90, 0xc0, 0x32, 0xe0,
+    0x2f, 0x4b, 0x80, 0x0b, 0x6d, 0x90, 0xd8, 0x15, 0x3c, 0x00, 0xac, 0x22, 0x34, 0x65, 0x80, 0x02,
+    0xdb, 0x93, 0x34, 0x20, 0x80, 0x05, 0x31, 0xa1, 0x2e, 0x97, 0x80, 0x00, 0x3c, 0x00, 0xac, 0x22,
+    0x30, 0x65, 0x80, 0x02, 0x90, 0xc0, 0x30, 0x20, 0x80, 0x05, 0x3c, 0x00, 0xae, 0x44, 0x36, 0x27,
+    0x80, 0x05, 0xda, 0x10, 0x36, 0x66, 0x80, 0x02, 0x96, 0xc0, 0x34, 0x05, 0x80, 0x01, 0xd8, 0x15,
+    0x3a, 0x00, 0xa2, 0x00, 0x34, 0xe7, 0x80, 0x01, 0xd6, 0x47, 0xd4, 0x46, 0x3f, 0x00, 0x3e, 0xf8,
+    0x80, 0x0a, 0x3e, 0x40, 0x23, 0x40, 0x80, 0x0a, 0x96, 0xc0, 0xf4, 0x44, 0x23, 0x00, 0x80, 0x81,
+    0x94, 0xc0, 0xf3, 0x48, 0xf0, 0x46, 0x00, 0x09, 0x1b, 0x80, 0x00, 0x40, 0x94, 0xc0, 0xf2, 0x49,
+    0xf5, 0x4a, 0xf7, 0x4b, 0x94, 0xc0, 0xf6, 0xc7, 0xf1, 0xc4, 0x9a, 0xc0, 0x34, 0x23, 0x80, 0x06,
+    0x90, 0xc0, 0x36, 0x20, 0x80, 0x06, 0xdb, 0x13, 0xd7, 0x40, 0x98, 0xc0, 0xf6, 0x42, 0x32, 0x04,
+    0x31, 0xc0, 0x80, 0x09, 0xf0, 0xc2, 0x37, 0x50, 0xf0, 0xc2, 0x7f, 0x48, 0x67, 0x65, 0x3f, 0x48,
+    0x32, 0x04, 0x31, 0xd4, 0x80, 0x09, 0x77, 0x5e, 0x96, 0xc0, 0x77, 0xd0, 0xf1, 0xc7, 0xf3, 0xc6,
+    0x9a, 0xc0, 0x34, 0x64, 0x80, 0x01, 0x67, 0xe4, 0x36, 0x61, 0x80, 0x01, 0x3f, 0xc8, 0xd8, 0x14,
+    0x67, 0xe5, 0x7f, 0xc8, 0x37, 0xdf, 0xd4, 0x41, 0x0f, 0x56, 0xf0, 0x41, 0x32, 0x04, 0x31, 0xc0,
+    0x80, 0x09, 0xf0, 0xc1, 0x37, 0x50, 0xf0, 0xc1, 0x7f, 0x48, 0x67, 0x65, 0x3f, 0x48, 0x32, 0x04,
+    0x31, 0xd4, 0x80, 0x09, 0x77, 0x5e, 0x96, 0xc0, 0x77, 0xd0, 0xf4, 0xc8, 0x00, 0x09, 0x1c, 0x00,
+    0x00, 0x40, 0xf3, 0xc7, 0x9a, 0xc0, 0x67, 0xe4, 0x7a, 0x61, 0x79, 0xc1, 0x2e, 0x0e, 0x80, 0x48,
+    0x98, 0xc0, 0x7f, 0xc8, 0x66, 0x6a, 0xf3, 0x47, 0xf4, 0x48, 0x67, 0xe5, 0x7f, 0xc8, 0x94, 0xc0,
+    0x77, 0xdf, 0x81, 0x6c, 0x96, 0xc0, 0x4f, 0x57, 0x2f, 0x0f, 0x80, 0x48, 0x98, 0xc0, 0x6d, 0x90,
+    0xf2, 0xc9, 0x2c, 0x20, 0x84, 0x44, 0x96, 0xc0, 0x79, 0x61, 0xf4, 0xc4, 0xf0, 0xc6, 0x9a, 0xc0,
+    0x65, 0x6a, 0x66, 0x61, 0x64, 0x61, 0xf5, 0xca, 0xf7, 0xcb, 0x96, 0xc0, 0xef, 0x3c, 0x2c, 0xff,
+    0x9f, 0x2b, 0x98, 0xc0, 0xd6, 0x45, 0x6c, 0x23, 0xee, 0x3c, 0xf3, 0x47, 0x27, 0xea, 0x9f, 0xd0,
+    0xe7, 0xea, 0x94, 0xc0, 0x9e, 0x21, 0x9f, 0x21, 0x94, 0xc0, 0x96, 0x21, 0x97, 0x21, 0x9f, 0x71,
+    0x90, 0xc0, 0x3a, 0x40, 0xa0, 0x00, 0x6e, 0x10, 0x0f, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x94, 0xc0,
+    0x96, 0x20, 0x00, 0x09, 0x1c, 0x80, 0x00, 0x40, 0x97, 0x20, 0x3c, 0x20, 0xa0, 0x00, 0x2f, 0x0b,
+    0x82, 0xc0, 0x90, 0xc0, 0x28, 0x0c, 0x88, 0x14, 0x96, 0xc0, 0x55, 0x13, 0x28, 0x0a, 0x88, 0x10,
+    0x98, 0xc0, 0x3b, 0x18, 0x80, 0x0f, 0x9e, 0x20, 0x9f, 0x20, 0x9a, 0xc0, 0x27, 0x0d, 0x81, 0x28,
+    0xd0, 0x22, 0x2b, 0x02, 0x80, 0x02, 0x94, 0xc0, 0xe7, 0xed, 0x84, 0x13, 0x27, 0x04, 0x80, 0x81,
+    0x90, 0xc0, 0x94, 0xc8, 0x44, 0xba, 0x44, 0xbc, 0x94, 0xc0, 0x6c, 0x90, 0x97, 0x49, 0x9a, 0xc0,
+    0x2b, 0x02, 0x80, 0x02, 0x74, 0x51, 0x27, 0xee, 0x9f, 0x38, 0x27, 0xed, 0x9f, 0x30, 0x94, 0xc8,
+    0xc0, 0x3d, 0xc0, 0x3e, 0x9a, 0xc0, 0x27, 0xea, 0x9f, 0x30, 0x90, 0xc0, 0x27, 0x00, 0x80, 0x46,
+    0x98, 0xc0, 0x30, 0x02, 0x3f, 0xd0, 0x80, 0x0a, 0xf9, 0x75, 0x98, 0xc0, 0x31, 0x42, 0x24, 0x18,
+    0x80, 0x0a, 0xf8, 0x76, 0x3c, 0x00, 0xa1, 0x00, 0x00, 0x09, 0x1d, 0x00, 0x00, 0x40, 0x27, 0xec,
+    0x9f, 0xbc, 0x90, 0xc0, 0x28, 0x0e, 0x88, 0x28, 0x9a, 0xc0, 0x28, 0x0f, 0x84, 0x20, 0x90, 0xc0,
+    0x28, 0x0e, 0x80, 0x18, 0x36, 0xc0, 0xa0, 0x00, 0xef, 0xea, 0xf8, 0x77, 0x36, 0x20, 0xa0, 0x00,
+    0xf9, 0x78, 0xf6, 0x79, 0x36, 0x20, 0xa0, 0x00, 0x52, 0x9e, 0xfc, 0x7a, 0x96, 0xc0, 0x53, 0x9e,
+    0x27, 0xea, 0x9f, 0xc8, 0x36, 0x40, 0xa0, 0x00, 0xf3, 0x41, 0xf2, 0x42, 0x32, 0x04, 0x30, 0xc4,
+    0x80, 0x09, 0x36, 0x60, 0xa0, 0x00, 0xff, 0x7b, 0xfe, 0x7c, 0x96, 0xc0, 0x50, 0x9f, 0x27, 0xea,
+    0x9f, 0xd8, 0x15, 0x9f, 0xf0, 0x42, 0x32, 0x04, 0x30, 0xc4, 0x80, 0x09, 0xf5, 0x41, 0x38, 0x20,
+    0xa0, 0x00, 0xfe, 0xfc, 0x27, 0xea, 0x9f, 0xd0, 0x90, 0xc0, 0x34, 0x80, 0xa0, 0x00, 0x54, 0x9e,
+    0x36, 0x80, 0xa0, 0x00, 0x51, 0x9e, 0xf4, 0x42, 0x32, 0x04, 0x30, 0xc4, 0x80, 0x09, 0x00, 0x09,
+    0x1d, 0x80, 0x00, 0x40, 0x36, 0x40, 0xa0, 0x00, 0xf1, 0x41, 0xfe, 0x7c, 0x3c, 0x80, 0xa0, 0x00,
+    0x27, 0xed, 0x9f, 0xdc, 0x90, 0xc0, 0x27, 0xed, 0x9f, 0xcc, 0x96, 0xc0, 0xf1, 0xce, 0x27, 0xeb,
+    0x9f, 0xd4, 0x96, 0xc0, 0x77, 0x51, 0xc0, 0x92, 0xf5, 0xca, 0x36, 0x80, 0xa0, 0x00, 0x53, 0x95,
+    0xfc, 0xfa, 0x36, 0x20, 0xa0, 0x00, 0xff, 0xfb, 0x52, 0x95, 0x94, 0xc0, 0xf3, 0x7d, 0xf5, 0x7e,
+    0x36, 0x60, 0xa0, 0x00, 0xf6, 0xcc, 0x54, 0x93, 0x96, 0xc0, 0xf0, 0x7f, 0x07, 0xf8, 0x9f, 0x00,
+    0x36, 0x20, 0xa0, 0x00, 0xfb, 0xf7, 0xf8, 0xf8, 0x9a, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0,
+    0x90, 0xc0, 0x90, 0xc0, 0x3e, 0x00, 0xa0, 0x09, 0x76, 0x56, 0x74, 0x56, 0x75, 0x52, 0x59, 0x58,
+    0x27, 0xea, 0x9f, 0xc0, 0x3a, 0x80, 0xa0, 0x00, 0x75, 0xd1, 0x77, 0xd0, 0x59, 0x5b, 0xfc, 0x7a,
+    0x3e, 0x60, 0xa0, 0x06, 0x00, 0x09, 0x1e, 0x00, 0x00, 0x40, 0x76, 0xd0, 0x74, 0x52, 0x76, 0xd3,
+    0x77, 0xd1, 0xff, 0x7b, 0xfb, 0x77, 0x3e, 0x20, 0xa0, 0x09, 0x74, 0xd7, 0x75, 0xd3, 0x74, 0xd7,
+    0xf8, 0x78, 0x06, 0xf8, 0x9e, 0xfc, 0x3e, 0x20, 0xa8, 0x4c, 0x60, 0x74, 0x60, 0xf4, 0x74, 0x52,
+    0x74, 0xd7, 0x04, 0xf8, 0x9e, 0xf8, 0x3a, 0x00, 0xa8, 0x4c, 0x61, 0x75, 0x61, 0xf6, 0x76, 0xd3,
+    0x76, 0x56, 0x3a, 0x00, 0xa6, 0x0c, 0x6c, 0xf4, 0x6d, 0xf6, 0x74, 0x54, 0x76, 0xd5, 0x3a, 0x00,
+    0xa6, 0x0c, 0x6c, 0x77, 0x6d, 0x75, 0x74, 0xd7, 0x76, 0x56, 0x3a, 0x00, 0xae, 0x62, 0x6d, 0xd2,
+    0x63, 0xf4, 0x74, 0x54, 0x6d, 0x32, 0x3a, 0x00, 0xb6, 0x04, 0x60, 0x76, 0x76, 0xd5, 0x74, 0xd7,
+    0x76, 0x56, 0x3c, 0x00, 0xa6, 0x38, 0x6f, 0xf4, 0x6c, 0x76, 0x62, 0x76, 0x62, 0xf7, 0xf0, 0xfe,
+    0x3a, 0x00, 0xa4, 0x38, 0xd5, 0xc0, 0xd5, 0x40, 0x6c, 0x43, 0x00, 0x09, 0x1e, 0x80, 0x00, 0x40,
+    0x6c, 0xd9, 0x3c, 0x20, 0xb6, 0xb2, 0xd5, 0xc0, 0x6e, 0x76, 0x6e, 0xf7, 0x6e, 0xb9, 0xf7, 0xfd,
+    0x3c, 0x00, 0xbc, 0x06, 0x6c, 0xa3, 0xd4, 0xc7, 0x6d, 0xd5, 0xd6, 0xc7, 0xf3, 0x41, 0x3a, 0x00,
+    0xa8, 0x05, 0xd5, 0x41, 0xd4, 0xc3, 0x6d, 0xb5, 0x77, 0xd2, 0x3c, 0x00, 0xb8, 0x04, 0xd6, 0xc3,
+    0x74, 0x52, 0x32, 0x04, 0x31, 0x30, 0x80, 0x09, 0x34, 0x20, 0xa0, 0x00, 0xf5, 0x42, 0x38, 0x60,
+    0xa0, 0x00, 0x75, 0x57, 0xff, 0xfb, 0xf7, 0xd0, 0x94, 0xc0, 0xfc, 0xfa, 0xf5, 0xff, 0x3a, 0x00,
+    0xa1, 0x00, 0x7a, 0xe1, 0x50, 0x97, 0x27, 0xe9, 0x9f, 0xc4, 0x3a, 0x20, 0xa0, 0x04, 0xd7, 0xc0,
+    0x66, 0xea, 0x55, 0x91, 0xf8, 0xf8, 0x36, 0xa0, 0xa0, 0x00, 0x47, 0x9f, 0xf5, 0x7f, 0x38, 0x60,
+    0xa0, 0x00, 0x53, 0x94, 0x16, 0xf8, 0x9e, 0xfc, 0x3a, 0x60, 0xa2, 0x10, 0x14, 0xf8, 0x9e, 0xf8,
+    0x00, 0x09, 0x1f, 0x00, 0x00, 0x40, 0x6c, 0xcd, 0xfb, 0xf7, 0x96, 0xc0, 0x41, 0x8c, 0x2d, 0xff,
+    0x9e, 0xdd, 0x9a, 0xc0, 0x17, 0xf8, 0x9f, 0x00, 0x90, 0xc0, 0x24, 0x02, 0x80, 0x48, 0x36, 0x40,
+    0xa0, 0x00, 0x7b, 0xe1, 0xfe, 0xfc, 0x3a, 0x40, 0xa1, 0x00, 0x67, 0xea, 0xef, 0x3c, 0x2c, 0x0c,
+    0x80, 0x48, 0x2d, 0xff, 0x9d, 0xfb, 0x9a, 0xc0, 0x6d, 0x90, 0x0f, 0x86, 0x3a, 0x58, 0x80, 0x09,
+    0x93, 0x63, 0x98, 0xc0, 0x00, 0x66, 0x33, 0xa0, 0x80, 0x0a, 0xf6, 0xf9, 0x9a, 0xc0, 0x21, 0x61,
+    0x9f, 0x00, 0x90, 0xc0, 0x2f, 0x0a, 0x82, 0xc0, 0x98, 0xc0, 0x61, 0x74, 0x55, 0x12, 0x24, 0x40,
+    0x86, 0x00, 0x9c, 0xc0, 0x27, 0xee, 0x9f, 0x30, 0x6d, 0x74, 0x3b, 0x19, 0x80, 0x0f, 0xf9, 0xf5,
+    0x98, 0xc0, 0x6a, 0xa4, 0x50, 0x9e, 0x2b, 0x03, 0x80, 0x26, 0x2e, 0xc9, 0xf8, 0xf6, 0x30, 0x75,
+    0x05, 0x62, 0x33, 0xa0, 0x80, 0x0a, 0x00, 0x09, 0x1f, 0x80, 0x00, 0x40, 0x9e, 0xc0, 0xd3, 0x53,
+    0xd2, 0xd0, 0x79, 0xc1, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x98, 0xd6, 0x54, 0x9e,
+    0x06, 0x62, 0x33, 0xa4, 0x80, 0x0a, 0x98, 0xc6, 0x72, 0x75, 0x05, 0x62, 0x33, 0xa0, 0x80, 0x0a,
+    0x96, 0xc0, 0xd2, 0xd4, 0xd3, 0x53, 0x79, 0xc1, 0x3a, 0x06, 0xa1, 0x00, 0x06, 0x62, 0x33, 0xa4,
+    0x80, 0x0a, 0xea, 0xe8, 0x98, 0xc6, 0xd0, 0xa2, 0x05, 0x62, 0x33, 0xa0, 0x80, 0x0a, 0x00, 0x66,
+    0x33, 0xa4, 0x80, 0x0a, 0x9c, 0xc1, 0xd4, 0x31, 0x24, 0x40, 0x80, 0x00, 0xd4, 0x31, 0x24, 0x20,
+    0x8a, 0xab, 0x3a, 0x00, 0xa0, 0x04, 0xda, 0x94, 0x34, 0x02, 0x3e, 0xf8, 0x80, 0x0a, 0x94, 0xc2,
+    0xca, 0x40, 0xcd, 0xa3, 0x98, 0xc7, 0x3c, 0x40, 0x23, 0x40, 0x80, 0x0a, 0xcb, 0x40, 0x94, 0xc1,
+    0xfb, 0x48, 0xed, 0x3a, 0x98, 0xc6, 0x25, 0x00, 0x80, 0x81, 0x90, 0xc0, 0x00, 0x09, 0x20, 0x00,
+    0x00, 0x40, 0xfd, 0x48, 0x96, 0xc0, 0xf1, 0xc8, 0x05, 0xf8, 0x9e, 0xf4, 0x3a, 0x61, 0xa0, 0x00,
+    0xc7, 0xff, 0x7c, 0xc2, 0x7c, 0xc2, 0xc7, 0x81, 0x98, 0xc0, 0xca, 0x41, 0x3b, 0x00, 0x35, 0xb8,
+    0x80, 0x0a, 0x9a, 0xc0, 0x28, 0x0d, 0x88, 0x14, 0x90, 0xc0, 0x28, 0x0e, 0x80, 0x04, 0x38, 0x00,
+    0xa1, 0x00, 0xec, 0x1a, 0x28, 0x0f, 0x84, 0x0c, 0x38, 0x20, 0xa1, 0x00, 0xea, 0x1c, 0x28, 0x0d,
+    0x88, 0x10, 0x28, 0x0f, 0x84, 0x08, 0x36, 0x40, 0xa0, 0x00, 0x59, 0x54, 0x50, 0x95, 0x3c, 0x80,
+    0xa0, 0x00, 0x76, 0xd0, 0x75, 0xd1, 0x77, 0xd1, 0x50, 0x96, 0x54, 0x92, 0x3e, 0x00, 0xa0, 0x09,
+    0x75, 0x50, 0x75, 0x50, 0x75, 0xd5, 0x74, 0xd5, 0x0c, 0xf8, 0x9e, 0xf0, 0x3c, 0x00, 0xb2, 0x8d,
+    0x63, 0x75, 0x62, 0x75, 0x75, 0x50, 0x77, 0x50, 0x5b, 0x52, 0x3c, 0x80, 0xa0, 0x0f, 0x75, 0xd3,
+    0x74, 0xd2, 0x00, 0x09, 0x20, 0x80, 0x00, 0x40, 0x6f, 0x77, 0x6e, 0x74, 0x50, 0x95, 0x3e, 0x00,
+    0xb2, 0x7c, 0x36, 0xe3, 0x80, 0x04, 0x61, 0x75, 0x34, 0xe6, 0x80, 0x04, 0x75, 0x50, 0x3e, 0x00,
+    0xa8, 0x82, 0x74, 0xd3, 0x30, 0xe6, 0x80, 0x04, 0x75, 0xd3, 0x07, 0xfa, 0x9e, 0xec, 0x3c, 0x00,
+    0xac, 0x6a, 0x6d, 0x75, 0x75, 0xd1, 0xdb, 0x16, 0x34, 0xe2, 0x80, 0x06, 0x3c, 0x00, 0xac, 0x65,
+    0x30, 0xe2, 0x80, 0x06, 0x65, 0xe0, 0x36, 0xe1, 0x80, 0x06, 0x3c, 0x00, 0xb8, 0x29, 0xd7, 0x43,
+    0xdb, 0x12, 0x75, 0xd2, 0x34, 0xe2, 0x80, 0x00, 0x3e, 0x00, 0xb0, 0x63, 0x30, 0xe2, 0x80, 0x00,
+    0xd7, 0x41, 0x36, 0xe2, 0x80, 0x00, 0x74, 0xd1, 0x3e, 0x00, 0xa0, 0x04, 0x67, 0x61, 0x0d, 0xf8,
+    0x9e, 0xe8, 0xd9, 0x12, 0x02, 0xfa, 0x9e, 0xe4, 0x3e, 0x20, 0xa4, 0x04, 0x61, 0x76, 0x05, 0xfa,
+    0x9e, 0xe0, 0xd5, 0x42, 0x05, 0xf8, 0x9e, 0xdc, 0x00, 0x09, 0x21, 0x00, 0x00, 0x40, 0x3a, 0x00,
+    0xb0, 0x84, 0x6d, 0x76, 0x34, 0xe5, 0x80, 0x03, 0x62, 0x77, 0x3c, 0x20, 0xac, 0x60, 0x30, 0xe5,
+    0x80, 0x03, 0x6e, 0x77, 0x6f, 0xaa, 0x52, 0x97, 0x3c, 0x00, 0xa6, 0x22, 0xdb, 0x15, 0x62, 0xf4,
+    0x74, 0xd1, 0x36, 0xe6, 0x80, 0x03, 0x3c, 0xa0, 0xa6, 0x24, 0x61, 0xf5, 0x6e, 0xf4, 0x6c, 0x54,
+    0x62, 0x74, 0x54, 0x97, 0x3a, 0x00, 0xb6, 0x85, 0x6d, 0xf5, 0x6e, 0x74, 0x6c, 0x40, 0xd7, 0x46,
+    0x3a, 0x00, 0xb4, 0xc8, 0x6f, 0xcb, 0x6c, 0x53, 0x67, 0x61, 0x74, 0xd5, 0x3a, 0x00, 0xa2, 0x8c,
+    0x6c, 0xdb, 0x6e, 0x40, 0x75, 0xd5, 0xca, 0x4f, 0x38, 0x00, 0xba, 0x00, 0x6c, 0x26, 0x75, 0x54,
+    0x77, 0x57, 0x38, 0x00, 0xb0, 0x04, 0x60, 0xf4, 0x74, 0xd5, 0x61, 0xf5, 0x36, 0x00, 0xb0, 0x84,
+    0x6c, 0xf4, 0x6d, 0xf6, 0x36, 0x40, 0xa0, 0x04, 0x7c, 0xc2, 0x41, 0x99, 0x36, 0x40, 0x00, 0x09,
+    0x21, 0x80, 0x00, 0x40, 0xa0, 0x00, 0x43, 0x91, 0xf1, 0x47, 0x13, 0x93, 0xf0, 0xc7, 0x3d, 0xc8,
+    0xf9, 0x75, 0x98, 0xc0, 0xf3, 0x46, 0x32, 0x04, 0x24, 0x86, 0x80, 0x09, 0xf1, 0xc6, 0x9a, 0xc0,
+    0x7c, 0x62, 0xf9, 0xf5, 0x3b, 0x00, 0x35, 0xb8, 0x80, 0x0a, 0x90, 0xc0, 0xe9, 0x64, 0x40, 0x99,
+    0x11, 0x91, 0x53, 0x93, 0x3c, 0xc2, 0xf9, 0x75, 0x3d, 0xc8, 0xf1, 0x45, 0x94, 0xc0, 0xf3, 0x44,
+    0xf0, 0xc5, 0x32, 0x04, 0x24, 0x86, 0x80, 0x09, 0xf1, 0xc4, 0x3e, 0x00, 0xa0, 0x02, 0x7c, 0x62,
+    0x16, 0xf8, 0x9e, 0xf4, 0x77, 0xd6, 0x17, 0xfa, 0x9e, 0xec, 0x9a, 0xc0, 0x12, 0xfa, 0x9e, 0xe4,
+    0x7b, 0x61, 0x15, 0xfa, 0x9e, 0xe0, 0x98, 0xc0, 0x1c, 0xf8, 0x9e, 0xf0, 0x67, 0x6a, 0xf9, 0xf5,
+    0x96, 0xc0, 0xca, 0x47, 0x1d, 0xf8, 0x9e, 0xe8, 0x3a, 0x00, 0xa1, 0x00, 0x3b, 0x00, 0x35, 0xb8,
+    0x80, 0x0a, 0xed, 0x48, 0x00, 0x09, 0x22, 0x00, 0x00, 0x40, 0x38, 0x40, 0xa0, 0x00, 0xef, 0x48,
+    0x15, 0xf8, 0x9e, 0xdc, 0x96, 0xc0, 0xee, 0x48, 0x06, 0xf8, 0x9e, 0xf4, 0x36, 0x80, 0xa0, 0x00,
+    0xea, 0x48, 0x40, 0x99, 0x36, 0x00, 0xa1, 0x00, 0xed, 0x48, 0xef, 0x48, 0x2c, 0xff, 0x9e, 0x23,
+    0x9a, 0xc0, 0x2a, 0x0a, 0x80, 0x48, 0x90, 0xc0, 0x2c, 0x0c, 0x80, 0x48, 0x27, 0xec, 0x9e, 0xd8,
+    0xe7, 0xec, 0x94, 0xc0, 0x9e, 0x21, 0x9f, 0x21, 0x94, 0xc0, 0x96, 0x21, 0x97, 0x21, 0x9f, 0x71,
+    0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x94, 0xc0, 0x96, 0x20, 0x97, 0x20,
+    0x94, 0xc0, 0x9e, 0x20, 0x9f, 0x20, 0x98, 0xc0, 0x3b, 0x60, 0x38, 0x4c, 0x80, 0x0a, 0x97, 0x44,
+    0x27, 0x0e, 0x80, 0x58, 0x10, 0x9b, 0xe7, 0xee, 0x27, 0xe9, 0x9f, 0xd0, 0x94, 0xc8, 0x40, 0x99,
+    0x50, 0x9b, 0x98, 0xc0, 0x3f, 0x60, 0x38, 0x60, 0x80, 0x0a, 0x00, 0x09, 0x22, 0x80, 0x00, 0x40,
+    0x97, 0x44, 0x40, 0x91, 0x96, 0xc0, 0x50, 0x9f, 0x27, 0xed, 0x9f, 0xe4, 0x94, 0xc8, 0x40, 0x9d,
+    0x50, 0x9f, 0x2f, 0x10, 0x2c, 0x90, 0x00, 0x95, 0x0d, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x27, 0x04,
+    0x80, 0x81, 0x2d, 0x0c, 0x82, 0xc2, 0x16, 0x14, 0x06, 0x62, 0x38, 0x8c, 0x80, 0x0a, 0x3d, 0x60,
+    0x34, 0x68, 0x80, 0x0a, 0x3d, 0x1b, 0x80, 0xff, 0x92, 0xc8, 0x41, 0x9d, 0x96, 0xc0, 0x6c, 0x10,
+    0xc7, 0x82, 0xc4, 0x87, 0x94, 0xc0, 0xc2, 0x8a, 0xc1, 0x8f, 0x94, 0xc0, 0xc6, 0x92, 0xc5, 0x97,
+    0x98, 0xc0, 0x07, 0x62, 0x38, 0x94, 0x80, 0x0a, 0xf0, 0x51, 0x98, 0xc0, 0xc7, 0x85, 0x04, 0x62,
+    0x38, 0xb0, 0x80, 0x0a, 0x02, 0x62, 0x38, 0xb4, 0x80, 0x0a, 0x01, 0x62, 0x38, 0xac, 0x80, 0x0a,
+    0x06, 0x62, 0x38, 0xa4, 0x80, 0x0a, 0x05, 0x62, 0x38, 0x98, 0x80, 0x0a, 0x9a, 0xc0, 0x27, 0xeb,
+    0x00, 0x09, 0x23, 0x00, 0x00, 0x40, 0x9f, 0xe4, 0x90, 0xc0, 0x27, 0xea, 0x9f, 0xd0, 0x3e, 0x00,
+    0x3e, 0xf8, 0x80, 0x0a, 0x3f, 0x40, 0x23, 0x40, 0x80, 0x0a, 0x90, 0xc0, 0x16, 0x9a, 0x51, 0x9b,
+    0x9c, 0xc0, 0x34, 0xc2, 0x80, 0x03, 0xf3, 0x53, 0x34, 0x24, 0x80, 0x03, 0xf7, 0x54, 0x9c, 0xc0,
+    0x36, 0xc4, 0x80, 0x03, 0xd9, 0x12, 0x36, 0x20, 0x80, 0x03, 0xdb, 0x14, 0x9a, 0xc0, 0xd5, 0x44,
+    0x21, 0x00, 0x80, 0x81, 0xd7, 0x40, 0xfb, 0x55, 0x94, 0xc0, 0xf1, 0x52, 0xfa, 0x56, 0x96, 0xc0,
+    0xf2, 0x4e, 0xf6, 0x50, 0x90, 0xc0, 0x94, 0xc0, 0xf6, 0xce, 0xf5, 0xd1, 0x9a, 0xc0, 0x34, 0xc2,
+    0x80, 0x05, 0x90, 0xc0, 0x36, 0xc0, 0x80, 0x05, 0xd8, 0x92, 0xd4, 0xc0, 0x98, 0xc0, 0xf1, 0x42,
+    0x32, 0x04, 0x31, 0xc0, 0x80, 0x09, 0xf0, 0xc2, 0x32, 0x04, 0x31, 0xd4, 0x80, 0x09, 0x37, 0x50,
+    0xf0, 0xc2, 0x96, 0xc0, 0x77, 0xd0, 0x00, 0x09, 0x23, 0x80, 0x00, 0x40, 0xf5, 0xd0, 0xf2, 0xd1,
+    0x9a, 0xc0, 0x34, 0xa0, 0x80, 0x02, 0x4e, 0x57, 0x36, 0xa4, 0x80, 0x02, 0xda, 0x90, 0xd6, 0xc4,
+    0x98, 0xc0, 0xf5, 0x41, 0x32, 0x04, 0x31, 0xc0, 0x80, 0x09, 0xf0, 0xc1, 0x32, 0x04, 0x31, 0xd4,
+    0x80, 0x09, 0x37, 0x50, 0xf0, 0xc1, 0x96, 0xc0, 0x77, 0xd0, 0xf4, 0xd2, 0xf5, 0xd1, 0x9a, 0xc0,
+    0x7a, 0x61, 0x7a, 0xc1, 0x4e, 0x56, 0x2f, 0x0f, 0x80, 0x48, 0x96, 0xc0, 0x66, 0x6a, 0xf4, 0x52,
+    0xf5, 0x51, 0x96, 0xc0, 0x81, 0x8b, 0x2e, 0x0e, 0x80, 0x48, 0x98, 0xc0, 0x6e, 0x10, 0xf7, 0xd4,
+    0x2d, 0x20, 0x84, 0x44, 0x96, 0xc0, 0x7b, 0xe1, 0xf3, 0xd3, 0xfb, 0xd5, 0x96, 0xc0, 0x67, 0xea,
+    0xee, 0x3d, 0xef, 0x3d, 0x2c, 0xff, 0x9f, 0x2d, 0x94, 0xc0, 0xf4, 0x51, 0xfa, 0xd6, 0x2d, 0x90,
+    0x2f, 0x10, 0x2c, 0x90, 0xc7, 0xff, 0x98, 0xc0, 0xc0, 0x85, 0x03, 0x62, 0x00, 0x09, 0x24, 0x00,
+    0x00, 0x40, 0x38, 0x88, 0x80, 0x0a, 0x03, 0x62, 0x38, 0xa0, 0x80, 0x0a, 0x07, 0x62, 0x38, 0xa8,
+    0x80, 0x0a, 0x9e, 0xc0, 0xd7, 0x24, 0x6d, 0xa2, 0x6e, 0x10, 0xcf, 0x46, 0x38, 0x60, 0x33, 0xa8,
+    0x80, 0x0a, 0x92, 0xc3, 0x6f, 0x4e, 0xef, 0xfe, 0x94, 0xc0, 0xe8, 0x1f, 0x80, 0x1a, 0x41, 0x90,
+    0x98, 0xc0, 0x38, 0x60, 0x36, 0x6c, 0x80, 0x0a, 0x9f, 0x43, 0x90, 0xc0, 0xe8, 0x1f, 0x92, 0xc8,
+    0x44, 0x98, 0x7b, 0x41, 0xd7, 0x37, 0x85, 0xcd, 0x94, 0xc0, 0x6c, 0x90, 0x97, 0x46, 0x96, 0xc0,
+    0x74, 0x51, 0x2b, 0x02, 0x80, 0x02, 0x3f, 0x60, 0x34, 0x10, 0x80, 0x0a, 0x3b, 0x60, 0x34, 0x08,
+    0x80, 0x0a, 0x90, 0xc0, 0x94, 0xc8, 0xc0, 0x3b, 0xc0, 0x3f, 0x27, 0xea, 0x9f, 0xa8, 0xe7, 0xea,
+    0x94, 0xc0, 0x9e, 0x21, 0x9f, 0x21, 0x94, 0xc0, 0x96, 0x21, 0x97, 0x21, 0x9f, 0x71, 0x90, 0xc0,
+    0x90, 0xc0, 0x00, 0x09, 0x24, 0x80, 0x00, 0x40, 0x96, 0xc0, 0x6c, 0x90, 0x96, 0x20, 0x97, 0x20,
+    0x94, 0xc0, 0x9e, 0x20, 0x9f, 0x20, 0x9a, 0xc0, 0x27, 0x0d, 0x80, 0x60, 0x90, 0xc0, 0x27, 0x00,
+    0x84, 0x08, 0x38, 0x40, 0xa0, 0x00, 0xe7, 0xed, 0x20, 0x40, 0x80, 0x00, 0x96, 0xc0, 0xf0, 0xe0,
+    0x27, 0xed, 0x9f, 0xe8, 0x9c, 0xc0, 0x34, 0x00, 0x80, 0x07, 0xc8, 0x4e, 0x36, 0x07, 0x80, 0x07,
+    0xe9, 0xe9, 0x96, 0xc0, 0xd9, 0x10, 0xeb, 0xed, 0xee, 0xed, 0x98, 0xc0, 0xd5, 0x47, 0xef, 0xed,
+    0x27, 0x00, 0x80, 0x81, 0x38, 0x40, 0xa0, 0x00, 0xd5, 0x46, 0xf6, 0xdf, 0x41, 0x91, 0x94, 0xc0,
+    0xca, 0x42, 0xf7, 0x4b, 0x94, 0xc0, 0xeb, 0x64, 0xee, 0x68, 0x94, 0xc0, 0xcc, 0x42, 0xea, 0x44,
+    0x98, 0xc0, 0xef, 0x6c, 0x34, 0x62, 0x34, 0x68, 0x80, 0x0a, 0x3c, 0x60, 0xa0, 0x00, 0xf6, 0x4c,
+    0x27, 0x01, 0x99, 0x9a, 0x90, 0xc0, 0x90, 0xc0, 0x00, 0x09, 0x25, 0x00, 0x00, 0x40, 0x36, 0x40,
+    0xa0, 0x00, 0xf6, 0xcc, 0x54, 0x94, 0x3a, 0x40, 0xa1, 0x08, 0xd7, 0x25, 0x7e, 0x42, 0x56, 0x92,
+    0x56, 0x94, 0x38, 0x60, 0xa0, 0x00, 0x7f, 0x42, 0xf4, 0x45, 0xf6, 0x43, 0x38, 0x00, 0xa8, 0x00,
+    0x77, 0x56, 0xf6, 0x44, 0x80, 0x65, 0x94, 0xc0, 0xf1, 0xc5, 0xf0, 0xc5, 0x36, 0x40, 0xa0, 0x00,
+    0xf9, 0x4d, 0xf0, 0x4e, 0x94, 0xc0, 0xfc, 0x4f, 0xfa, 0x50, 0x32, 0x04, 0x24, 0x86, 0x80, 0x09,
+    0x36, 0x40, 0xa0, 0x00, 0xfb, 0x51, 0xfc, 0x52, 0x32, 0x04, 0x24, 0x86, 0x80, 0x09, 0x96, 0xc0,
+    0x77, 0xd0, 0xf1, 0xc4, 0xf0, 0xc4, 0x3a, 0x40, 0xa0, 0x04, 0x77, 0x56, 0xd7, 0xc0, 0xf9, 0xcd,
+    0xf0, 0xce, 0x38, 0x00, 0xa0, 0x44, 0x6f, 0x5f, 0xfc, 0xcf, 0xfa, 0xd0, 0x3a, 0x60, 0xa0, 0x00,
+    0xfc, 0xd2, 0x37, 0x00, 0x20, 0x00, 0x99, 0x9a, 0x36, 0x40, 0xa0, 0x00, 0xfb, 0xd1, 0x00, 0x09,
+    0x25, 0x80, 0x00, 0x40, 0xf6, 0x43, 0x94, 0xc0, 0xf6, 0xcc, 0xf1, 0xc5, 0xd7, 0x24, 0x96, 0xc0,
+    0xf0, 0xc5, 0x27, 0x18, 0x83, 0x1a, 0x38, 0x20, 0xa0, 0x00, 0xd3, 0x25, 0xf9, 0x4d, 0xf0, 0x4e,
+    0x36, 0x06, 0xa8, 0x40, 0x62, 0x77, 0xfc, 0x4f, 0x36, 0x06, 0xa8, 0x40, 0x6e, 0x77, 0xfa, 0x50,
+    0x94, 0xc6, 0xfb, 0x51, 0xf4, 0x43, 0x32, 0x04, 0x24, 0x86, 0x80, 0x09, 0x34, 0x20, 0xa0, 0x00,
+    0xfc, 0x52, 0x32, 0x04, 0x24, 0x86, 0x80, 0x09, 0x96, 0xc0, 0x77, 0x50, 0xf1, 0xc4, 0xf0, 0xc4,
+    0x9a, 0xc0, 0xd7, 0x40, 0xc1, 0x8f, 0x32, 0xa4, 0x2f, 0x54, 0x80, 0x08, 0x96, 0xc0, 0x74, 0x56,
+    0xf1, 0x01, 0xf1, 0xc3, 0x3c, 0x40, 0xa0, 0x04, 0x76, 0x50, 0x35, 0x08, 0x20, 0x00, 0xbc, 0x13,
+    0xf9, 0xcd, 0x3c, 0x20, 0xa8, 0x40, 0x62, 0x76, 0x33, 0x58, 0x21, 0xeb, 0xbf, 0xfe, 0xf0, 0xce,
+    0x3c, 0x20, 0xa8, 0x40, 0x00, 0x09, 0x26, 0x00, 0x00, 0x40, 0x6e, 0x76, 0x31, 0x08, 0x20, 0x00,
+    0x95, 0x00, 0xfc, 0xd2, 0x3c, 0x20, 0xa0, 0x00, 0x6d, 0x4c, 0xfb, 0xd1, 0x37, 0x00, 0x20, 0x00,
+    0x99, 0x9a, 0x9a, 0xc0, 0x71, 0x71, 0xfa, 0xd0, 0x35, 0x08, 0x20, 0x00, 0xbf, 0xff, 0x3a, 0x20,
+    0xa0, 0x00, 0x31, 0x08, 0x20, 0x00, 0xa6, 0x66, 0xfc, 0xcf, 0x9a, 0xc6, 0x24, 0x18, 0x82, 0x00,
+    0x90, 0xc0, 0x21, 0x61, 0x9f, 0xff, 0x38, 0x20, 0xa0, 0x00, 0x33, 0x00, 0x20, 0x00, 0x99, 0x99,
+    0x98, 0xc0, 0x38, 0x60, 0x38, 0x74, 0x80, 0x0a, 0x97, 0x44, 0x36, 0x80, 0xa0, 0x00, 0x27, 0xef,
+    0x9f, 0xd8, 0x53, 0x98, 0x36, 0x88, 0xa0, 0x00, 0x43, 0x9f, 0x53, 0x98, 0x3c, 0x00, 0xa1, 0x00,
+    0x7d, 0x49, 0x43, 0x97, 0x31, 0x40, 0x34, 0x77, 0x81, 0x71, 0x65, 0x61, 0x65, 0x64, 0x25, 0x69,
+    0x74, 0x52, 0x96, 0xc0, 0x64, 0x66, 0x24, 0x18, 0x81, 0x62, 0x00, 0x09, 0x26, 0x80, 0x00, 0x40,
+    0x96, 0xc2, 0x34, 0x00, 0x20, 0x00, 0x81, 0x00, 0x32, 0x04, 0x24, 0x86, 0x80, 0x09, 0xf2, 0x53,
+    0x98, 0xc0, 0x33, 0x00, 0x20, 0x00, 0x80, 0x80, 0xf2, 0xd3, 0x9a, 0xc0, 0xd4, 0x43, 0x65, 0x68,
+    0x31, 0x60, 0x32, 0x18, 0x80, 0xb1, 0x31, 0xef, 0x9f, 0x00, 0x98, 0xc7, 0x32, 0x04, 0x24, 0x86,
+    0x80, 0x09, 0x67, 0xe4, 0x74, 0x57, 0xf2, 0xd3, 0x2d, 0x12, 0x32, 0x04, 0x24, 0x86, 0x80, 0x09,
+    0x34, 0xd2, 0x34, 0x52, 0xf2, 0x54, 0x96, 0xc0, 0xf0, 0x55, 0x27, 0xed, 0x9f, 0xe8, 0x32, 0x04,
+    0x24, 0x86, 0x80, 0x09, 0x51, 0x95, 0x38, 0x20, 0xa0, 0x04, 0x77, 0x50, 0xfb, 0xd1, 0xf2, 0xd5,
+    0x34, 0x00, 0xa8, 0x00, 0x74, 0x52, 0x11, 0x93, 0x32, 0x04, 0x24, 0x86, 0x80, 0x09, 0x34, 0x00,
+    0xa8, 0x00, 0x6c, 0xc6, 0x38, 0x40, 0xa0, 0x04, 0x77, 0x50, 0xf2, 0xd5, 0x51, 0x96, 0x32, 0x04,
+    0x00, 0x09, 0x27, 0x00, 0x00, 0x40, 0x24, 0x86, 0x80, 0x09, 0x36, 0x00, 0xb8, 0x00, 0x74, 0x52,
+    0x6c, 0xc6, 0x38, 0x40, 0xa0, 0x04, 0x77, 0x50, 0xf2, 0xd5, 0x51, 0x97, 0x32, 0x04, 0x24, 0x86,
+    0x80, 0x09, 0x36, 0x00, 0xb8, 0x00, 0x74, 0x52, 0x6c, 0xc6, 0x36, 0x40, 0xa0, 0x00, 0x74, 0xd0,
+    0xf2, 0xd5, 0x3c, 0x40, 0xa8, 0x00, 0x74, 0x52, 0xf2, 0xca, 0x32, 0x04, 0x24, 0x86, 0x80, 0x09,
+    0x34, 0x00, 0xa8, 0x00, 0x6c, 0xd8, 0x9a, 0xc0, 0x76, 0x50, 0x31, 0x00, 0x20, 0x00, 0x82, 0x00,
+    0xf2, 0xd4, 0x3c, 0x00, 0xa0, 0x04, 0x6d, 0x44, 0x74, 0x52, 0x32, 0x04, 0x24, 0x86, 0x80, 0x09,
+    0x34, 0x20, 0xa0, 0x00, 0xf2, 0x56, 0x3a, 0x40, 0xa0, 0x00, 0x64, 0x68, 0x74, 0xd0, 0xf2, 0xd4,
+    0xf2, 0xd6, 0x38, 0x00, 0xa8, 0x04, 0x6d, 0x3c, 0xc2, 0x98, 0xc3, 0x98, 0x98, 0xc1, 0x65, 0x68,
+    0x65, 0x68, 0xc0, 0xff, 0x6c, 0x10, 0x00, 0x09, 0x27, 0x80, 0x00, 0x40, 0x3a, 0x46, 0xa0, 0x00,
+    0x90, 0xc0, 0xf2, 0x57, 0x6d, 0x10, 0x65, 0xe0, 0x32, 0xe4, 0x3d, 0x8c, 0x80, 0x01, 0x92, 0xc3,
+    0xc2, 0xff, 0x34, 0x20, 0xa0, 0x00, 0xf2, 0xd7, 0x36, 0x00, 0xb0, 0x04, 0x65, 0x68, 0x75, 0xd2,
+    0x98, 0xc6, 0x32, 0xe4, 0x3d, 0x74, 0x80, 0x01, 0x6d, 0x10, 0x92, 0xc3, 0xc2, 0xff, 0x27, 0xe8,
+    0x24, 0xe1, 0x30, 0x00, 0x20, 0x00, 0x81, 0x00, 0x94, 0xc7, 0x6c, 0xd1, 0x67, 0xe4, 0x7f, 0xf8,
+    0x94, 0xc1, 0xd4, 0x1f, 0xd4, 0x17, 0x32, 0x04, 0x24, 0x86, 0x80, 0x09, 0x64, 0x61, 0x36, 0x50,
+    0x35, 0x08, 0x20, 0x00, 0xbf, 0xff, 0x3c, 0x20, 0xa0, 0x00, 0x63, 0xf6, 0x30, 0x00, 0x20, 0x00,
+    0x81, 0x00, 0xc2, 0x9f, 0x3e, 0x20, 0xa0, 0x00, 0x74, 0xd0, 0x6f, 0xf6, 0xf2, 0x01, 0x32, 0xa4,
+    0x2f, 0x54, 0x80, 0x08, 0x6c, 0xc7, 0x38, 0x20, 0xa0, 0x00, 0x74, 0xd0, 0x00, 0x09, 0x28, 0x00,
+    0x00, 0x40, 0xf9, 0xcd, 0xf0, 0xce, 0x94, 0xc0, 0xfc, 0xcf, 0xfa, 0xd0, 0x36, 0x40, 0xa0, 0x00,
+    0xfb, 0xd1, 0xfc, 0xd2, 0x38, 0x20, 0xa0, 0x00, 0x37, 0x00, 0x20, 0x00, 0x99, 0x9a, 0x38, 0x20,
+    0xa0, 0x00, 0x31, 0x08, 0x20, 0x00, 0xa6, 0x66, 0x38, 0x20, 0xa0, 0x00, 0x33, 0x00, 0x20, 0x00,
+    0x99, 0x99, 0x3e, 0x40, 0xa8, 0x04, 0x77, 0x70, 0x22, 0x00, 0x8c, 0xcc, 0xd9, 0x19, 0x23, 0x60,
+    0x93, 0x33, 0x38, 0x00, 0xa0, 0x44, 0x6a, 0x3c, 0xf0, 0xc3, 0x54, 0x91, 0x3c, 0x40, 0xa8, 0x0c,
+    0x6a, 0x0e, 0x74, 0x50, 0xd6, 0x42, 0x22, 0x60, 0x9f, 0xff, 0x3a, 0x00, 0xb0, 0x85, 0x7e, 0x6f,
+    0x63, 0xf4, 0x74, 0x50, 0x44, 0x91, 0x3a, 0x00, 0xa6, 0x16, 0x36, 0x74, 0x9e, 0xb8, 0x6f, 0xf4,
+    0x74, 0x54, 0x75, 0xd7, 0x94, 0xc2, 0x21, 0x61, 0x9e, 0xb8, 0x23, 0xf4, 0xd9, 0x19, 0x36, 0x00,
+    0xb0, 0x00, 0x00, 0x09, 0x28, 0x80, 0x00, 0x40, 0x6f, 0xf4, 0x6c, 0xbc, 0x34, 0x57, 0xdb, 0x91,
+    0x60, 0xf7, 0x6c, 0xf7, 0x34, 0x00, 0xa0, 0x04, 0x6d, 0x51, 0x34, 0x00, 0xa8, 0x40, 0x63, 0x75,
+    0x34, 0x00, 0xa8, 0x40, 0x6f, 0x75, 0x34, 0x00, 0xa0, 0x04, 0x6f, 0x4e, 0x94, 0xc0, 0xf0, 0xcb,
+    0xec, 0x48, 0x38, 0x40, 0xa1, 0x00, 0x78, 0x61, 0x46, 0x9c, 0xea, 0x48, 0x24, 0x6a, 0xf0, 0x4b,
+    0x2d, 0xff, 0x9c, 0x49, 0x27, 0xec, 0x9f, 0xa0, 0xe7, 0xec, 0x94, 0xc0, 0x9e, 0x21, 0x9f, 0x21,
+    0x94, 0xc0, 0x96, 0x21, 0x97, 0x21, 0x9f, 0x71, 0x94, 0xc0, 0x96, 0x20, 0x97, 0x20, 0xe7, 0x48,
+    0x9a, 0xc0, 0x27, 0xeb, 0x9f, 0xde, 0x90, 0xc0, 0x27, 0xe9, 0x9f, 0xe4, 0x13, 0x53, 0xf2, 0xc8,
+    0x3e, 0x00, 0xa0, 0x04, 0x01, 0xfc, 0x9f, 0xdc, 0x77, 0x52, 0x77, 0xd3, 0x75, 0x52, 0x50, 0x91,
+    0x3e, 0x00, 0xa0, 0x03, 0x76, 0x50, 0x76, 0xd1, 0x00, 0x09, 0x29, 0x00, 0x00, 0x40, 0x75, 0xd1,
+    0x74, 0xd3, 0x27, 0xeb, 0x9f, 0xfc, 0x3a, 0x00, 0xa2, 0x1f, 0x74, 0x50, 0x62, 0xf6, 0x62, 0x75,
+    0x61, 0xf7, 0x3a, 0x00, 0xa4, 0x22, 0x76, 0xd3, 0x77, 0x52, 0x76, 0x50, 0x63, 0x74, 0x3a, 0x00,
+    0xa0, 0x0b, 0x77, 0xd1, 0x6f, 0x76, 0x6d, 0xf5, 0x6e, 0xf4, 0x36, 0x00, 0xb0, 0x84, 0x6e, 0x77,
+    0x6e, 0x4d, 0x34, 0x00, 0xa8, 0x40, 0x6d, 0x36, 0xf2, 0x42, 0x44, 0x93, 0x94, 0xc0, 0xf3, 0xc1,
+    0xf5, 0xc2, 0x05, 0x9a, 0xe7, 0x68, 0x94, 0xc0, 0x96, 0x21, 0x97, 0x21, 0x9f, 0x70, 0x43, 0x92,
+    0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x96, 0xc0,
+    0x6e, 0x90, 0x96, 0x20, 0x97, 0x20, 0x94, 0xc0, 0x9e, 0x20, 0x9f, 0x20, 0x96, 0xc0, 0x97, 0x4c,
+    0x27, 0x0e, 0x81, 0x90, 0xe7, 0xee, 0x96, 0xc0, 0xec, 0xe9, 0x2b, 0x02, 0x80, 0x02, 0x00, 0x09,
+    0x29, 0x80, 0x00, 0x40, 0x29, 0x0e, 0x80, 0x04, 0x94, 0xc8, 0x45, 0xbc, 0x45, 0xbe, 0x96, 0xc0,
+    0xe8, 0x58, 0x27, 0x00, 0x80, 0x46, 0x35, 0x02, 0x3f, 0xd0, 0x80, 0x0a, 0x30, 0x42, 0x24, 0x18,
+    0x80, 0x0a, 0x90, 0xc0, 0x38, 0x20, 0xa0, 0x00, 0x52, 0x98, 0x09, 0xf8, 0x9e, 0x9c, 0x96, 0xc0,
+    0x55, 0x88, 0x27, 0xea, 0x9f, 0xc0, 0x36, 0x40, 0xa0, 0x00, 0xf5, 0x41, 0xf2, 0x42, 0x9a, 0xc0,
+    0x08, 0xf8, 0x9e, 0x98, 0x90, 0xc0, 0x05, 0xfa, 0x9e, 0x94, 0x32, 0x04, 0x30, 0xc4, 0x80, 0x09,
+    0x00, 0xfa, 0x9e, 0x90, 0x9a, 0xc0, 0x18, 0xf8, 0x9e, 0x98, 0x90, 0xc0, 0x27, 0xea, 0x9f, 0x90,
+    0x90, 0xc0, 0x28, 0x0e, 0x84, 0x08, 0x50, 0x9e, 0x12, 0x8e, 0xf0, 0x42, 0x32, 0x04, 0x30, 0xc4,
+    0x80, 0x09, 0xf2, 0x41, 0x9a, 0xc0, 0x2e, 0x0e, 0x84, 0x08, 0x90, 0xc0, 0x27, 0xef, 0x9f, 0xe0,
+    0x96, 0xc0, 0xfe, 0x4a, 0x00, 0x09, 0x2a, 0x00, 0x00, 0x40, 0x2a, 0x00, 0x88, 0x08, 0x16, 0x9e,
+    0xf8, 0xca, 0x06, 0x9f, 0x56, 0x96, 0x97, 0x42, 0x06, 0x97, 0xe8, 0x3a, 0x9a, 0xc0, 0x27, 0xef,
+    0x9f, 0xf8, 0x90, 0xc0, 0x27, 0xee, 0x9f, 0xe0, 0x92, 0xd0, 0x51, 0x9e, 0x41, 0x9f, 0x32, 0x04,
+    0x30, 0xc4, 0x80, 0x09, 0x9a, 0xc0, 0x27, 0xea, 0x9f, 0xb0, 0x90, 0xc0, 0x08, 0xf8, 0x9e, 0x98,
+    0x9a, 0xc0, 0x15, 0xfa, 0x9e, 0x94, 0x90, 0xc0, 0x10, 0xfa, 0x9e, 0x90, 0x3c, 0x00, 0xa1, 0x00,
+    0x27, 0xee, 0x9f, 0x18, 0x90, 0xc0, 0x27, 0xe9, 0x9f, 0x40, 0x36, 0x40, 0xa0, 0x00, 0xe1, 0xee,
+    0xef, 0xed, 0x36, 0x20, 0xa0, 0x00, 0xea, 0xe8, 0xc1, 0x85, 0x38, 0x20, 0xa0, 0x00, 0xe0, 0xe9,
+    0x27, 0xee, 0x9e, 0xa0, 0x3c, 0x80, 0xa1, 0x00, 0x27, 0xef, 0x9f, 0x68, 0x90, 0xc0, 0x27, 0xee,
+    0x9e, 0xf0, 0x38, 0x20, 0xa1, 0x00, 0xfd, 0x46, 0x27, 0xea, 0x00, 0x09, 0x2a, 0x80, 0x00, 0x40,
+    0x9e, 0xc8, 0x34, 0x20, 0xa0, 0x00, 0xf8, 0x45, 0x97, 0x41, 0x27, 0xeb, 0x9f, 0xf4, 0x92, 0xd0,
+    0x50, 0x9a, 0x40, 0x9b, 0x36, 0x60, 0xa0, 0x00, 0xf4, 0xd0, 0xf7, 0xcf, 0x36, 0x60, 0xa0, 0x00,
+    0xf4, 0x42, 0xf7, 0x41, 0x32, 0x24, 0x28, 0xd0, 0x80, 0x09, 0x96, 0xc0, 0xcc, 0x51, 0x27, 0xea,
+    0x9f, 0xb8, 0x36, 0x20, 0xa0, 0x00, 0xf5, 0xd2, 0x97, 0x41, 0x34, 0x20, 0xa0, 0x00, 0xf2, 0xd1,
+    0x38, 0xa0, 0xa0, 0x00, 0x45, 0x9a, 0x27, 0xeb, 0x9f, 0xf4, 0x34, 0xa0, 0xa0, 0x00, 0x42, 0x9a,
+    0x92, 0xd0, 0x55, 0x9f, 0x45, 0x9b, 0x36, 0x60, 0xa0, 0x00, 0xf6, 0xd0, 0xf3, 0xcf, 0x36, 0x60,
+    0xa0, 0x00, 0xf6, 0x42, 0xf3, 0x41, 0x32, 0x24, 0x28, 0xd0, 0x80, 0x09, 0x27, 0xea, 0x9f, 0xa8,
+    0x36, 0x20, 0xa0, 0x00, 0xf0, 0xd6, 0x97, 0x41, 0x34, 0x20, 0xa0, 0x00, 0xf3, 0xd5, 0x36, 0xa0,
+    0x00, 0x09, 0x2b, 0x00, 0x00, 0x40, 0xa0, 0x00, 0x40, 0x9e, 0xff, 0xc5, 0x38, 0xa0, 0xa0, 0x00,
+    0x43, 0x9e, 0x27, 0xeb, 0x9f, 0xf4, 0x92, 0xd0, 0x52, 0x9f, 0x42, 0x9b, 0x36, 0x60, 0xa0, 0x00,
+    0xf0, 0xdc, 0xf6, 0xdb, 0x36, 0x60, 0xa0, 0x00, 0xf0, 0x42, 0xf6, 0x41, 0x32, 0x24, 0x28, 0xd0,
+    0x80, 0x09, 0x27, 0xea, 0x9f, 0xd0, 0x36, 0x20, 0xa0, 0x00, 0xf2, 0xcc, 0x97, 0x41, 0x34, 0x20,
+    0xa0, 0x00, 0xf5, 0xcb, 0x36, 0xa0, 0xa0, 0x00, 0x42, 0x9f, 0xff, 0xc6, 0x38, 0xa0, 0xa0, 0x00,
+    0x45, 0x9f, 0x27, 0xeb, 0x9f, 0xf4, 0x92, 0xd0, 0x50, 0x9f, 0x40, 0x9b, 0x36, 0x60, 0xa0, 0x00,
+    0xf7, 0xdc, 0xf4, 0xdb, 0x36, 0x60, 0xa0, 0x00, 0xf7, 0x42, 0xf4, 0x41, 0x32, 0x24, 0x28, 0xd0,
+    0x80, 0x09, 0x27, 0xea, 0x9f, 0x98, 0x36, 0x20, 0xa0, 0x00, 0xf1, 0xda, 0x97, 0x41, 0xf5, 0xd9,
+    0x36, 0x20, 0xa0, 0x00, 0x41, 0x9e, 0x00, 0x09, 0x2b, 0x80, 0x00, 0x40, 0xfb, 0xc5, 0x96, 0xc0,
+    0x45, 0x9e, 0x27, 0xed, 0x9f, 0xf4, 0x92, 0xd0, 0x54, 0x9b, 0x44, 0x9d, 0x94, 0xc0, 0xf6, 0xd4,
+    0xf0, 0xd3, 0x94, 0xc0, 0xf6, 0x42, 0xf0, 0x41, 0x32, 0x24, 0x28, 0xd0, 0x80, 0x09, 0x27, 0xea,
+    0x9f, 0xc8, 0x94, 0xc0, 0xef, 0xe0, 0xf6, 0xce, 0x06, 0x9f, 0xf2, 0xcd, 0x97, 0x41, 0x02, 0x9f,
+    0xfb, 0xc6, 0x96, 0xc0, 0xe0, 0xef, 0x27, 0xec, 0x9f, 0xf4, 0x92, 0xd0, 0x50, 0x9b, 0x40, 0x9c,
+    0x94, 0xc0, 0xf4, 0xd4, 0xf3, 0xd3, 0x94, 0xc0, 0xf4, 0x42, 0xf3, 0x41, 0x32, 0x24, 0x28, 0xd0,
+    0x80, 0x09, 0x27, 0xea, 0x9f, 0xa0, 0x94, 0xc0, 0xec, 0xe1, 0xf5, 0xd8, 0x94, 0xc0, 0xff, 0xc6,
+    0xfa, 0xc5, 0x05, 0x9c, 0xcc, 0x59, 0x38, 0x20, 0xa0, 0x00, 0x78, 0xe1, 0xed, 0xec, 0xf1, 0xd7,
+    0x96, 0xc0, 0x64, 0xea, 0xea, 0x44, 0xef, 0x44, 0x36, 0x20, 0xa0, 0x00, 0x00, 0x09, 0x2c, 0x00,
+    0x00, 0x40, 0x41, 0x9d, 0xfa, 0x45, 0x2c, 0xff, 0x9e, 0x85, 0x94, 0xc0, 0xff, 0x46, 0xe1, 0xed,
+    0x96, 0xc0, 0xc6, 0x85, 0x19, 0xf8, 0x9e, 0x9c, 0x9a, 0xc0, 0x27, 0xef, 0x9f, 0x18, 0x90, 0xc0,
+    0x27, 0xee, 0x9f, 0x68, 0x29, 0x0a, 0x80, 0x08, 0x36, 0x40, 0xa0, 0x00, 0xc1, 0x1e, 0xf4, 0xd0,
+    0x3a, 0x00, 0xa2, 0x00, 0x27, 0xed, 0x9f, 0xc4, 0x6e, 0xc0, 0xc3, 0x1f, 0x2c, 0x49, 0x14, 0x95,
+    0x0a, 0xf8, 0x9e, 0x8c, 0x2e, 0x44, 0x32, 0x04, 0x31, 0x92, 0x80, 0x09, 0x6c, 0xcc, 0x3b, 0x61,
+    0x1a, 0xf8, 0x9e, 0x8c, 0x67, 0x6a, 0x34, 0x20, 0xa0, 0x00, 0x52, 0x92, 0x36, 0x00, 0xa8, 0x04,
+    0x6c, 0x52, 0x81, 0xcc, 0x34, 0x20, 0xa0, 0x00, 0x40, 0x9a, 0x96, 0xc0, 0xc6, 0x83, 0x19, 0xf8,
+    0x9e, 0x9c, 0x9a, 0xc0, 0x27, 0xef, 0x9f, 0x30, 0x90, 0xc0, 0x27, 0xee, 0x9e, 0xe0, 0x29, 0x0a,
+    0x80, 0x1c, 0x00, 0x09, 0x2c, 0x80, 0x00, 0x40, 0x36, 0x40, 0xa0, 0x00, 0xc1, 0x0e, 0xf6, 0xdc,
+    0x3a, 0x00, 0xa2, 0x00, 0x27, 0xed, 0x9f, 0x94, 0x6e, 0xc2, 0xc3, 0x0f, 0x2c, 0x49, 0x14, 0x95,
+    0x0a, 0xf8, 0x9e, 0x88, 0x2e, 0x44, 0x32, 0x04, 0x31, 0x92, 0x80, 0x09, 0x6c, 0xcc, 0x3b, 0x61,
+    0x1a, 0xf8, 0x9e, 0x88, 0x67, 0x6a, 0x34, 0x20, 0xa0, 0x00, 0x57, 0x92, 0x36, 0x00, 0xa8, 0x04,
+    0x6e, 0xc3, 0x81, 0xcc, 0x34, 0x20, 0xa0, 0x00, 0x45, 0x9a, 0x96, 0xc0, 0xc6, 0x85, 0x19, 0xf8,
+    0x9e, 0x9c, 0x9a, 0xc0, 0x27, 0xef, 0x9e, 0xf0, 0x90, 0xc0, 0x27, 0xea, 0x9f, 0x40, 0x98, 0xc0,
+    0x29, 0x0e, 0x80, 0x28, 0x90, 0xc0, 0x90, 0xc0, 0x36, 0x40, 0xa0, 0x00, 0xc1, 0x1a, 0xf0, 0xdc,
+    0x3a, 0x00, 0xa0, 0x10, 0x27, 0xeb, 0x9f, 0x94, 0x6e, 0x50, 0xc3, 0x1f, 0x2c, 0x48, 0x15, 0x93,
+    0x0a, 0xf8, 0x9e, 0x84, 0x2e, 0xc5, 0x32, 0x04, 0x00, 0x09, 0x2d, 0x00, 0x00, 0x40, 0x31, 0x92,
+    0x80, 0x09, 0x6c, 0xcd, 0x3a, 0x40, 0xa0, 0x00, 0x7b, 0x61, 0x51, 0x96, 0x1a, 0xf8, 0x9e, 0x84,
+    0x36, 0x00, 0xb0, 0x08, 0x67, 0x6a, 0x6d, 0x51, 0x36, 0x20, 0xa0, 0x00, 0x42, 0x9e, 0x81, 0xc7,
+    0x96, 0xc0, 0xc6, 0x83, 0x19, 0xf8, 0x9e, 0x9c, 0x9a, 0xc0, 0x27, 0xef, 0x9f, 0x08, 0x90, 0xc0,
+    0x27, 0xee, 0x9f, 0x80, 0x98, 0xc0, 0x29, 0x0a, 0x80, 0x3c, 0x90, 0xc0, 0x90, 0xc0, 0x36, 0x40,
+    0xa0, 0x00, 0xc1, 0x0e, 0xf2, 0xd4, 0x3a, 0x00, 0xa2, 0x00, 0x27, 0xed, 0x9f, 0xb4, 0x6e, 0xd2,
+    0xc3, 0x0f, 0x2c, 0x49, 0x14, 0x95, 0x0a, 0xf8, 0x9e, 0x80, 0x2d, 0x44, 0x32, 0x04, 0x31, 0x92,
+    0x80, 0x09, 0x6c, 0xdd, 0x3b, 0x61, 0x1a, 0xf8, 0x9e, 0x80, 0x67, 0x6a, 0x34, 0x20, 0xa0, 0x00,
+    0x57, 0x92, 0x36, 0x00, 0xa8, 0x04, 0x6c, 0xc3, 0x81, 0xcc, 0x34, 0x20, 0xa0, 0x00, 0x00, 0x09,
+    0x2d, 0x80, 0x00, 0x40, 0x41, 0x9a, 0x96, 0xc0, 0xc5, 0x85, 0x19, 0xf8, 0x9e, 0x9c, 0x9a, 0xc0,
+    0x27, 0xef, 0x9e, 0xa0, 0x90, 0xc0, 0x27, 0xee, 0x9e, 0xc8, 0x98, 0xc0, 0x29, 0x0a, 0x80, 0x48,
+    0x90, 0xc0, 0x90, 0xc0, 0x36, 0x40, 0xa0, 0x00, 0xc1, 0x1e, 0xf5, 0xd4, 0x3a, 0x00, 0xa2, 0x00,
+    0x27, 0xeb, 0x9f, 0xb4, 0x6f, 0x41, 0xc3, 0x1f, 0x2c, 0x4a, 0x14, 0x93, 0x0a, 0xf8, 0x9e, 0x7c,
+    0x2f, 0x44, 0x32, 0x04, 0x31, 0x92, 0x80, 0x09, 0x2c, 0xce, 0x77, 0x55, 0x36, 0xd6, 0x1a, 0xf8,
+    0x9e, 0x7c, 0x7a, 0xe1, 0x36, 0x40, 0xa0, 0x00, 0x66, 0xea, 0x50, 0x92, 0x36, 0x00, 0xa0, 0x44,
+    0x6f, 0xd0, 0x81, 0xc8, 0x34, 0x20, 0xa0, 0x00, 0x47, 0x9a, 0x94, 0xc0, 0xc3, 0x83, 0xc6, 0x81,
+    0x3c, 0x00, 0xa0, 0x01, 0x27, 0xea, 0x9e, 0xb8, 0x74, 0x53, 0x27, 0xef, 0x9f, 0x58, 0x94, 0xc0,
+    0x27, 0xec, 0x9f, 0xc4, 0x00, 0x09, 0x2e, 0x00, 0x00, 0x40, 0x98, 0xc0, 0x3d, 0x04, 0x80, 0x16,
+    0xf5, 0xd0, 0xc1, 0x0f, 0x98, 0xc0, 0x6c, 0x41, 0xd6, 0x37, 0x55, 0x94, 0xc3, 0x0a, 0x3c, 0x80,
+    0xa0, 0x00, 0x6e, 0xc5, 0x0a, 0xf8, 0x9e, 0x78, 0x6c, 0x52, 0xce, 0x40, 0x2c, 0xcd, 0xc5, 0x82,
+    0x98, 0xc6, 0x32, 0x04, 0x31, 0x92, 0x80, 0x09, 0x6e, 0x1a, 0x04, 0xf8, 0x9e, 0x74, 0x9a, 0xc0,
+    0x1b, 0xf8, 0x9e, 0x74, 0x7b, 0x41, 0x19, 0xf8, 0x9e, 0x9c, 0x38, 0x80, 0xa0, 0x00, 0xce, 0x48,
+    0x27, 0xec, 0x9f, 0xc4, 0x3a, 0x00, 0xa0, 0x04, 0x78, 0x61, 0xeb, 0xfe, 0x1a, 0xf8, 0x9e, 0x78,
+    0x36, 0x00, 0xa0, 0x04, 0x64, 0x6a, 0xeb, 0x19, 0x54, 0x93, 0x94, 0xc0, 0x6d, 0xc0, 0x81, 0xa0,
+    0x43, 0x93, 0x9a, 0xc0, 0x15, 0xfa, 0x9e, 0x94, 0x7b, 0xe1, 0x10, 0xfa, 0x9e, 0x90, 0x27, 0xea,
+    0x18, 0xf8, 0x9e, 0x98, 0x2c, 0xff, 0x9b, 0x27, 0x3c, 0xe0, 0x00, 0x09, 0x2e, 0x80, 0x00, 0x40,
+    0xa1, 0x00, 0x28, 0x08, 0x80, 0x48, 0x90, 0xc0, 0x2d, 0x0d, 0x80, 0x48, 0x27, 0xe8, 0x9e, 0x70,
+    0xe7, 0xe8, 0x94, 0xc0, 0x9e, 0x21, 0x9f, 0x21, 0x94, 0xc0, 0x96, 0x21, 0x97, 0x21, 0x9f, 0x71,
+    0x94, 0xc0, 0x96, 0x20, 0x97, 0x20, 0x94, 0xc0, 0x9e, 0x20, 0x9f, 0x20, 0x98, 0xc0, 0x07, 0x66,
+    0x38, 0x90, 0x80, 0x0a, 0xc8, 0x48, 0x03, 0x66, 0x38, 0x94, 0x80, 0x0a, 0x96, 0xc0, 0x71, 0xf7,
+    0x27, 0x0f, 0x80, 0x30, 0x94, 0xc0, 0xe7, 0xef, 0x80, 0x2b, 0x05, 0x66, 0x38, 0xb0, 0x80, 0x0a,
+    0x72, 0xf7, 0x94, 0xc2, 0x6e, 0x10, 0x6d, 0x0f, 0x94, 0xc2, 0xc1, 0x81, 0xc5, 0x82, 0x98, 0xc6,
+    0x24, 0x18, 0x80, 0xe2, 0x90, 0xc0, 0xf2, 0x46, 0x94, 0xc2, 0xf4, 0x48, 0xf1, 0x47, 0x02, 0x66,
+    0x38, 0xb0, 0x80, 0x0a, 0x31, 0x77, 0x06, 0x66, 0x38, 0xb4, 0x80, 0x0a, 0x80, 0x21, 0x73, 0x77,
+    0x00, 0x09, 0x2f, 0x00, 0x00, 0x40, 0x94, 0xc2, 0x6f, 0x0b, 0x6e, 0x10, 0x94, 0xc2, 0xc2, 0x81,
+    0xc5, 0x83, 0x96, 0xc2, 0x6d, 0x3a, 0xf2, 0x48, 0xf4, 0x47, 0x80, 0xac, 0x94, 0xc2, 0xf2, 0x46,
+    0xc5, 0x82, 0x01, 0x66, 0x38, 0xb4, 0x80, 0x0a, 0x30, 0xf7, 0x05, 0x66, 0x38, 0xac, 0x80, 0x0a,
+    0x80, 0x1d, 0x72, 0xf7, 0x94, 0xc2, 0x6d, 0x07, 0x6e, 0x90, 0x94, 0xc2, 0xc4, 0x81, 0xc6, 0x82,
+    0x94, 0xc6, 0x80, 0x86, 0xf2, 0x46, 0x94, 0xc2, 0xf4, 0x48, 0xf6, 0x47, 0x04, 0x66, 0x38, 0xac,
+    0x80, 0x0a, 0x32, 0x77, 0x06, 0x66, 0x38, 0xa4, 0x80, 0x0a, 0x80, 0x21, 0x73, 0x77, 0x94, 0xc2,
+    0x6e, 0x17, 0x6e, 0x90, 0x94, 0xc2, 0xc2, 0x83, 0xc6, 0x82, 0x96, 0xc2, 0x6c, 0xa8, 0xc2, 0x81,
+    0xf6, 0x48, 0x80, 0x54, 0x94, 0xc2, 0xf2, 0x47, 0xf1, 0x46, 0x06, 0x66, 0x38, 0xa4, 0x80, 0x0a,
+    0x33, 0x77, 0x01, 0x66, 0x38, 0x98, 0x00, 0x09, 0x2f, 0x80, 0x00, 0x40, 0x80, 0x0a, 0x80, 0x1d,
+    0x70, 0xf7, 0x94, 0xc2, 0x6d, 0x1f, 0x6e, 0x10, 0x94, 0xc2, 0xc6, 0x82, 0xc5, 0x81, 0x94, 0xc6,
+    0x80, 0x2e, 0xf2, 0x46, 0x94, 0xc2, 0xf4, 0x47, 0xf6, 0x48, 0x9a, 0xc0, 0x71, 0xf7, 0x05, 0x66,
+    0x38, 0x98, 0x80, 0x0a, 0xc2, 0x83, 0x94, 0xc6, 0xc6, 0x82, 0x7b, 0xd8, 0x98, 0xc0, 0x6d, 0x9b,
+    0x6e, 0x10, 0xf6, 0x47, 0xc5, 0x81, 0x2c, 0xbd, 0xf4, 0x48, 0xf1, 0x46, 0x98, 0xc0, 0x3e, 0x15,
+    0x84, 0x08, 0xf2, 0xc6, 0xf1, 0xc8, 0x9a, 0xc0, 0x7d, 0x42, 0xf7, 0xc7, 0x3b, 0x00, 0x3e, 0xf8,
+    0x80, 0x0a, 0x9c, 0xc0, 0x3e, 0x11, 0x84, 0x08, 0xcc, 0x42, 0x3e, 0x17, 0x84, 0x08, 0xcd, 0x40,
+    0x9a, 0xc0, 0xd4, 0xc0, 0x3a, 0x40, 0x23, 0x40, 0x80, 0x0a, 0xce, 0x45, 0x94, 0xc0, 0xcf, 0x47,
+    0xc8, 0x41, 0x96, 0xc0, 0xeb, 0x1c, 0x25, 0x00, 0x80, 0x81, 0x94, 0xc0, 0x00, 0x09, 0x30, 0x00,
+    0x00, 0x40, 0xec, 0x1a, 0xee, 0x1d, 0x94, 0xc0, 0xef, 0x1d, 0xf5, 0x49, 0x94, 0xc0, 0xe8, 0x44,
+    0xca, 0x41, 0x3d, 0x00, 0x35, 0xb8, 0x80, 0x0a, 0x38, 0x20, 0xa0, 0x00, 0x27, 0x21, 0x8a, 0xab,
+    0x90, 0xc0, 0x14, 0x92, 0x59, 0x54, 0x35, 0xd1, 0x34, 0xd0, 0x37, 0xd0, 0x1d, 0x53, 0xcc, 0x54,
+    0x3e, 0x00, 0xa0, 0x0d, 0x75, 0xd4, 0x74, 0xd3, 0x76, 0xd5, 0x76, 0xd1, 0xcc, 0x5c, 0xfb, 0x4a,
+    0x04, 0x99, 0xf8, 0x4c, 0x36, 0x20, 0xa0, 0x00, 0x52, 0x90, 0xfa, 0x4b, 0x34, 0x20, 0xa0, 0x00,
+    0x42, 0x89, 0x54, 0x9f, 0x38, 0x00, 0xa0, 0x04, 0x74, 0x54, 0x77, 0x54, 0x50, 0x9f, 0x3a, 0x00,
+    0xa4, 0x26, 0x63, 0x77, 0x75, 0x50, 0x77, 0x50, 0x62, 0x74, 0x3c, 0x00, 0xa0, 0x0b, 0x77, 0xd1,
+    0x74, 0x54, 0x74, 0xd3, 0x6f, 0x76, 0xcc, 0x5c, 0x3a, 0x00, 0xb0, 0x89, 0x63, 0x77, 0x6e, 0x74,
+    0x60, 0x75, 0x00, 0x09, 0x30, 0x80, 0x00, 0x40, 0x75, 0x50, 0x3a, 0x00, 0xa6, 0x08, 0x6f, 0x74,
+    0x6c, 0x75, 0x75, 0xd3, 0x76, 0xd5, 0x38, 0x00, 0xaa, 0xc8, 0x6f, 0x82, 0x6f, 0x56, 0x74, 0xd3,
+    0x36, 0x00, 0xa8, 0x48, 0x6f, 0x4a, 0x6f, 0x57, 0x34, 0x20, 0xa0, 0x00, 0x46, 0x99, 0x46, 0x89,
+    0x50, 0x9e, 0x38, 0x20, 0xa0, 0x00, 0x75, 0x50, 0x76, 0x50, 0x52, 0x9e, 0x3a, 0x00, 0xb6, 0x01,
+    0x63, 0xf5, 0x75, 0xd3, 0x76, 0x52, 0x75, 0x52, 0x3a, 0x00, 0xa2, 0x08, 0x6f, 0xf4, 0x60, 0xf6,
+    0x76, 0xd5, 0x76, 0x50, 0x3a, 0x00, 0xb2, 0x8b, 0x60, 0x75, 0x60, 0x76, 0x76, 0x52, 0x6c, 0xf6,
+    0x3a, 0x00, 0xbe, 0xc8, 0x6c, 0x75, 0x6c, 0x76, 0x74, 0xd7, 0x75, 0xd7, 0x38, 0x00, 0xa8, 0x8c,
+    0x6e, 0xd1, 0x6d, 0x03, 0xcc, 0x4f, 0x36, 0x00, 0xa8, 0xc8, 0x6c, 0x4a, 0x6f, 0x5a, 0x3a, 0x00,
+    0xb2, 0x04, 0x61, 0xf4, 0x74, 0xd7, 0x75, 0x56, 0x00, 0x09, 0x31, 0x00, 0x00, 0x40, 0x40, 0x99,
+    0x38, 0x20, 0xa0, 0x04, 0x6d, 0xf4, 0x62, 0xf5, 0x46, 0x89, 0x38, 0x20, 0xa8, 0x48, 0x6e, 0xf7,
+    0x7d, 0xc2, 0x43, 0x99, 0x36, 0x40, 0xa0, 0x00, 0x45, 0x91, 0xf3, 0x45, 0x15, 0x95, 0xf0, 0xc5,
+    0x3e, 0xc8, 0xc9, 0x4e, 0x98, 0xc0, 0xf5, 0x44, 0x32, 0x04, 0x24, 0x86, 0x80, 0x09, 0xf1, 0xc4,
+    0x9a, 0xc0, 0x7c, 0x62, 0xc9, 0x46, 0x3d, 0x00, 0x35, 0xb8, 0x80, 0x0a, 0x90, 0xc0, 0xe9, 0x64,
+    0x40, 0x99, 0x12, 0x91, 0x55, 0x95, 0x3d, 0x42, 0xc9, 0x4e, 0x3e, 0xc8, 0xf2, 0x43, 0x94, 0xc0,
+    0xf5, 0x42, 0xf0, 0xc3, 0x32, 0x04, 0x24, 0x86, 0x80, 0x09, 0xf1, 0xc2, 0x96, 0xc0, 0x7c, 0x62,
+    0xcc, 0x47, 0xf7, 0xc9, 0x96, 0xc0, 0x7b, 0xe1, 0xc9, 0x46, 0xfb, 0xca, 0x96, 0xc0, 0x67, 0xea,
+    0xfa, 0xcb, 0xf8, 0xcc, 0x98, 0xc0, 0x3d, 0x00, 0x35, 0xb8, 0x80, 0x0a, 0xf7, 0x49, 0x00, 0x09,
+    0x31, 0x80, 0x00, 0x40, 0x3a, 0x20, 0xa0, 0x00, 0x37, 0x00, 0x20, 0x00, 0xaa, 0xab, 0xe8, 0x48,
+    0x9a, 0xc0, 0x2c, 0x0c, 0x80, 0x48, 0x90, 0xc0, 0x2b, 0x0b, 0x80, 0x48, 0x2c, 0xff, 0x9e, 0x89,
+    0x00, 0x99, 0xea, 0x48, 0x27, 0xe9, 0x9f, 0xd0, 0xe7, 0xe9, 0x94, 0xc0, 0x9e, 0x21, 0x9f, 0x21,
+    0x94, 0xc0, 0x96, 0x21, 0x97, 0x21, 0x9f, 0x71, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0,
+    0x90, 0xc0, 0x90, 0xc0, 0x94, 0xc0, 0x96, 0x20, 0x97, 0x20, 0x94, 0xc0, 0x9e, 0x20, 0x9f, 0x20,
+    0x98, 0xc0, 0x06, 0x66, 0x38, 0x8c, 0x80, 0x0a, 0xee, 0xe9, 0x96, 0xc0, 0x7b, 0x41, 0x27, 0x0f,
+    0x80, 0xf0, 0x9a, 0xc0, 0x6d, 0x10, 0xe7, 0xef, 0x06, 0x62, 0x38, 0x8c, 0x80, 0x0a, 0x96, 0xc0,
+    0xf6, 0x41, 0x27, 0xe9, 0x9f, 0x70, 0x32, 0x24, 0x24, 0x80, 0x80, 0x09, 0x94, 0xc0, 0xf2, 0x42,
+    0xef, 0xe8, 0x32, 0x24, 0x00, 0x09, 0x32, 0x00, 0x00, 0x40, 0x29, 0x60, 0x80, 0x09, 0x96, 0xc0,
+    0xe8, 0xef, 0x27, 0xe9, 0x9f, 0x10, 0x98, 0xc0, 0x0c, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x97, 0x4b,
+    0x9a, 0xc0, 0x21, 0x61, 0x9f, 0x00, 0x90, 0xc0, 0x27, 0xed, 0x9f, 0x68, 0x00, 0x66, 0x38, 0x9c,
+    0x80, 0x0a, 0x9a, 0xc0, 0x2c, 0x09, 0x82, 0xc0, 0x62, 0xf4, 0x2d, 0x0c, 0x80, 0x04, 0x2e, 0xf4,
+    0x52, 0x11, 0x9a, 0xc0, 0x35, 0x19, 0x80, 0x0f, 0x52, 0x95, 0x27, 0xeb, 0x9f, 0x7c, 0x98, 0xc0,
+    0x3e, 0x51, 0x86, 0x00, 0xf2, 0x62, 0x57, 0x94, 0x98, 0xc0, 0x27, 0xe8, 0x9f, 0x10, 0x6d, 0xc5,
+    0x47, 0x93, 0x98, 0xc0, 0xc1, 0x18, 0x03, 0x62, 0x38, 0x9c, 0x80, 0x0a, 0x27, 0xea, 0x9f, 0x80,
+    0x94, 0xc8, 0xc0, 0x1a, 0xc1, 0x18, 0x9a, 0xc0, 0x6c, 0x90, 0x6e, 0x90, 0xc0, 0x12, 0x2a, 0x00,
+    0x80, 0x54, 0x96, 0xc0, 0xf6, 0xfc, 0x2b, 0x0c, 0x80, 0x64, 0x00, 0x09, 0x32, 0x80, 0x00, 0x40,
+    0x94, 0xc0, 0xed, 0x3a, 0xc7, 0xff, 0x14, 0x95, 0x46, 0x9c, 0x96, 0xc0, 0x93, 0x58, 0x2b, 0x03,
+    0x80, 0x36, 0x96, 0xc0, 0xf7, 0x08, 0x27, 0xe8, 0x9f, 0xf2, 0x96, 0xc0, 0xf1, 0x46, 0x27, 0xeb,
+    0x9f, 0xec, 0x04, 0x94, 0x41, 0x93, 0x38, 0x00, 0xa1, 0x00, 0x47, 0x10, 0x27, 0xea, 0x9f, 0x10,
+    0x9a, 0xc0, 0x27, 0xed, 0x9f, 0x84, 0x90, 0xc0, 0x27, 0xe9, 0x9f, 0x7c, 0x27, 0xec, 0x9f, 0x80,
+    0x10, 0x99, 0x54, 0x9d, 0x2c, 0x7c, 0x50, 0x9c, 0x70, 0x74, 0x94, 0xc0, 0xf2, 0xc6, 0x84, 0x33,
+    0x70, 0x72, 0x90, 0xc0, 0x94, 0xc2, 0xf4, 0x88, 0x42, 0x93, 0x36, 0x02, 0xa1, 0x00, 0x44, 0x10,
+    0x54, 0x92, 0x80, 0x1a, 0x94, 0xc2, 0xf4, 0x46, 0xf5, 0x08, 0x51, 0x93, 0x70, 0x71, 0x90, 0xc0,
+    0x36, 0x82, 0xa0, 0x00, 0x56, 0x92, 0x45, 0x10, 0x92, 0xc2, 0x46, 0x93, 0x36, 0x10, 0xa1, 0x00,
+    0x00, 0x09, 0x33, 0x00, 0x00, 0x40, 0x7a, 0xc1, 0xea, 0x44, 0x90, 0xc0, 0x90, 0xc0, 0x14, 0x10,
+    0xf0, 0x88, 0x96, 0xc0, 0x6c, 0x7d, 0x21, 0x61, 0x80, 0x00, 0x32, 0x77, 0x54, 0x93, 0x94, 0xc0,
+    0xf0, 0xc6, 0x84, 0x17, 0x62, 0xf4, 0x6e, 0xf4, 0x72, 0xf4, 0x92, 0xc2, 0x6e, 0x10, 0x94, 0xc2,
+    0x44, 0x93, 0x47, 0x10, 0x9a, 0xc0, 0x6e, 0x90, 0x6c, 0x10, 0x93, 0x58, 0x2b, 0x03, 0x80, 0x1a,
+    0x98, 0xc0, 0x3d, 0x60, 0x34, 0x08, 0x80, 0x0a, 0xf1, 0x88, 0x22, 0x00, 0x80, 0x40, 0x30, 0xe5,
+    0x54, 0x95, 0x84, 0x17, 0x7a, 0x41, 0x96, 0xc0, 0x36, 0x14, 0x80, 0x40, 0x44, 0x95, 0x84, 0x15,
+    0x02, 0x95, 0x31, 0x24, 0x33, 0x6c, 0x80, 0x09, 0x3a, 0x61, 0xd6, 0x20, 0x44, 0x95, 0x92, 0xc3,
+    0x40, 0x95, 0x94, 0xd0, 0x7a, 0xc1, 0xed, 0x44, 0x90, 0xc0, 0x90, 0xc0, 0x30, 0xf7, 0x6f, 0x10,
+    0x84, 0xa5, 0x24, 0xea, 0x3c, 0x60, 0x00, 0x09, 0x33, 0x80, 0x00, 0x40, 0x34, 0x08, 0x80, 0x0a,
+    0x94, 0xc7, 0xd0, 0x51, 0x6c, 0x10, 0x94, 0xc6, 0xd4, 0xb6, 0x78, 0x61, 0x9a, 0xc7, 0xc9, 0x40,
+    0x90, 0xc0, 0x76, 0x70, 0x33, 0x05, 0x80, 0x01, 0x92, 0xc2, 0xc5, 0x97, 0x75, 0x75, 0x32, 0x72,
+    0xc9, 0x4c, 0x94, 0xc0, 0x74, 0x74, 0x80, 0x1d, 0x2e, 0x12, 0x7c, 0x42, 0x3a, 0x41, 0xcd, 0x40,
+    0x9f, 0x44, 0xed, 0x1c, 0x90, 0xc0, 0x94, 0xd0, 0x77, 0x76, 0x52, 0x9d, 0x6f, 0x4a, 0x36, 0x76,
+    0x35, 0x80, 0x20, 0x00, 0x80, 0x11, 0xd6, 0x3f, 0x94, 0xc0, 0xf2, 0xe4, 0x80, 0x27, 0x71, 0x75,
+    0x94, 0xc0, 0xf6, 0xc6, 0x84, 0x4b, 0x33, 0x73, 0xcc, 0x41, 0x84, 0x41, 0x06, 0x62, 0x38, 0x9c,
+    0x80, 0x0a, 0x30, 0x24, 0x34, 0x1e, 0x80, 0x09, 0x0c, 0x62, 0x38, 0x90, 0x80, 0x0a, 0x12, 0x10,
+    0x35, 0x80, 0x20, 0x00, 0x80, 0x11, 0x71, 0x77, 0x94, 0xc0, 0xf6, 0xe4, 0x00, 0x09, 0x34, 0x00,
+    0x00, 0x40, 0x84, 0x23, 0x33, 0x75, 0x50, 0x93, 0x84, 0x19, 0x70, 0x73, 0x90, 0xc0, 0x98, 0xc2,
+    0xcd, 0x42, 0x00, 0x62, 0x38, 0x9c, 0x80, 0x0a, 0x96, 0xc2, 0x0d, 0x62, 0x38, 0x90, 0x80, 0x0a,
+    0x3c, 0x00, 0xa0, 0x04, 0x6d, 0x90, 0x08, 0x66, 0x38, 0x90, 0x80, 0x0a, 0xc1, 0x83, 0x98, 0xc0,
+    0x3b, 0x60, 0x33, 0xa8, 0x80, 0x0a, 0xc5, 0x57, 0x98, 0xc0, 0xe8, 0xfe, 0x02, 0x66, 0x38, 0xa0,
+    0x80, 0x0a, 0x9a, 0xc0, 0x79, 0x41, 0xe8, 0x1b, 0x3d, 0x60, 0x34, 0x00, 0x80, 0x0a, 0x9a, 0xc0,
+    0xd5, 0x2b, 0x55, 0x90, 0x02, 0x62, 0x38, 0xa0, 0x80, 0x0a, 0x9a, 0xc0, 0x26, 0x02, 0x80, 0x58,
+    0x7a, 0xc1, 0x27, 0x02, 0x80, 0x50, 0x96, 0xc0, 0x45, 0x90, 0x27, 0x18, 0x83, 0x26, 0x15, 0x9d,
+    0x04, 0x66, 0x33, 0xa8, 0x80, 0x0a, 0x9c, 0xc0, 0x36, 0x85, 0x80, 0x01, 0xcc, 0x55, 0x34, 0x84,
+    0x80, 0x01, 0x00, 0x09, 0x34, 0x80, 0x00, 0x40, 0xc1, 0x54, 0x38, 0x00, 0xa0, 0x04, 0xda, 0x14,
+    0x53, 0x95, 0xe8, 0xed, 0x3e, 0x20, 0xa0, 0x06, 0x76, 0xd3, 0x34, 0x62, 0x80, 0x01, 0xd6, 0x45,
+    0xe8, 0x3e, 0xcc, 0x5d, 0x3e, 0x40, 0xa0, 0x0a, 0x75, 0x55, 0x7e, 0xc1, 0xdb, 0x12, 0x36, 0x60,
+    0x80, 0x01, 0x56, 0x90, 0x3e, 0x00, 0xac, 0x0c, 0x74, 0xd6, 0x66, 0xe1, 0x7d, 0x41, 0xd7, 0x40,
+    0xe9, 0xed, 0xec, 0xed, 0x3e, 0x80, 0xa8, 0x0d, 0x60, 0x62, 0x7c, 0xc1, 0x66, 0x61, 0x65, 0x61,
+    0xea, 0xed, 0xec, 0x3a, 0x3e, 0x00, 0xb1, 0x1c, 0x64, 0xe1, 0xd6, 0x40, 0x34, 0xc0, 0x80, 0x01,
+    0xed, 0x68, 0xcd, 0x50, 0x3e, 0x20, 0xa9, 0x14, 0xd4, 0xc4, 0x67, 0x61, 0x36, 0xc4, 0x80, 0x01,
+    0x52, 0x95, 0xc1, 0x5f, 0x3e, 0x20, 0xa8, 0x02, 0xd5, 0x42, 0x34, 0xa3, 0x80, 0x01, 0x7f, 0xc1,
+    0x50, 0x94, 0xc8, 0x53, 0x3e, 0x00, 0xa2, 0x10, 0x00, 0x09, 0x35, 0x00, 0x00, 0x40, 0xd7, 0x42,
+    0xd9, 0x13, 0x6d, 0xd1, 0x36, 0xa5, 0x80, 0x01, 0xc4, 0x52, 0x3e, 0x20, 0xa4, 0x01, 0xd8, 0x10,
+    0xd5, 0x45, 0x67, 0xe1, 0x76, 0xd2, 0xe9, 0x3f, 0xcf, 0x53, 0x3e, 0x00, 0xa0, 0x01, 0xd4, 0x44,
+    0x7e, 0xc1, 0x7c, 0x41, 0x65, 0x61, 0x51, 0x91, 0xc8, 0x5b, 0x3e, 0x00, 0xa9, 0x02, 0x6c, 0xcf,
+    0x64, 0x61, 0x66, 0xe1, 0xd7, 0xc6, 0xcb, 0x51, 0xea, 0x6c, 0x3a, 0x80, 0xb0, 0x08, 0xd4, 0x41,
+    0xd7, 0x47, 0x53, 0x92, 0xcb, 0x5c, 0x3e, 0x00, 0xa0, 0x04, 0xd4, 0x40, 0xd6, 0xc3, 0xc9, 0x51,
+    0x01, 0x66, 0x38, 0x88, 0x80, 0x0a, 0x3e, 0x00, 0xa9, 0x00, 0xd6, 0x40, 0x3e, 0x11, 0x80, 0x60,
+    0xd5, 0x45, 0x93, 0x58, 0xce, 0x51, 0x3c, 0x00, 0xa0, 0x04, 0xd6, 0xc2, 0x37, 0x62, 0x36, 0x6c,
+    0x80, 0x0a, 0xc8, 0x41, 0x94, 0xc0, 0xcb, 0x54, 0xc1, 0x5c, 0x3a, 0x00, 0xa3, 0x00, 0x00, 0x09,
+    0x35, 0x80, 0x00, 0x40, 0x2b, 0x03, 0x80, 0x54, 0xd6, 0x45, 0xc0, 0x55, 0x3c, 0x00, 0xa1, 0x04,
+    0x6f, 0x90, 0xc2, 0x57, 0x3c, 0x60, 0x33, 0xa0, 0x80, 0x0a, 0x3a, 0x40, 0xa0, 0x00, 0x39, 0x60,
+    0x33, 0xb0, 0x80, 0x0a, 0xe8, 0x1f, 0x3a, 0x20, 0xa0, 0x00, 0x03, 0x62, 0x38, 0xa0, 0x80, 0x0a,
+    0xc1, 0x54, 0x3a, 0x00, 0xa1, 0x00, 0x3d, 0x60, 0x33, 0xac, 0x80, 0x0a, 0xc3, 0x56, 0x3a, 0x00,
+    0xa1, 0x00, 0x3a, 0x60, 0x33, 0xa4, 0x80, 0x0a, 0xca, 0x50, 0x38, 0xc0, 0xa0, 0x00, 0xc4, 0x5d,
+    0xc1, 0x83, 0x90, 0xc0, 0x38, 0x20, 0xa0, 0x04, 0x65, 0xe9, 0xcc, 0x59, 0x47, 0x90, 0x36, 0x00,
+    0xa1, 0x00, 0xcd, 0x5c, 0xce, 0x5e, 0x94, 0xc6, 0xcf, 0x59, 0x41, 0x90, 0x94, 0xc6, 0xc9, 0x5c,
+    0x44, 0x90, 0x36, 0x26, 0xa1, 0x00, 0x44, 0x90, 0xcb, 0x58, 0x36, 0x26, 0xa1, 0x00, 0x46, 0x90,
+    0xc8, 0x5e, 0x98, 0xc6, 0x00, 0x09, 0x36, 0x00, 0x00, 0x40, 0x25, 0x18, 0x80, 0xbe, 0x90, 0xc0,
+    0x41, 0x90, 0x36, 0x00, 0xa0, 0x04, 0xd1, 0xa1, 0xca, 0x59, 0x90, 0xc0, 0x36, 0x26, 0xa1, 0x00,
+    0x46, 0x90, 0xc1, 0x5e, 0x94, 0xc6, 0xc0, 0x5c, 0x44, 0x90, 0x92, 0xc2, 0x40, 0x90, 0x94, 0xc6,
+    0x80, 0x98, 0x41, 0x90, 0x34, 0x22, 0xa0, 0x00, 0x40, 0x90, 0x36, 0x00, 0xa0, 0x04, 0xd1, 0xb6,
+    0xc3, 0x59, 0x90, 0xc0, 0x92, 0xc2, 0x43, 0x90, 0x92, 0xc2, 0x45, 0x90, 0x92, 0xc2, 0x42, 0x90,
+    0x94, 0xc6, 0xc2, 0x5c, 0x44, 0x90, 0x36, 0x26, 0xa0, 0x00, 0x46, 0x90, 0x80, 0x71, 0x36, 0x40,
+    0xa0, 0x04, 0xd1, 0xb7, 0x50, 0x93, 0x3c, 0x00, 0xac, 0x62, 0x34, 0x07, 0x80, 0x01, 0x90, 0xc0,
+    0x36, 0x06, 0x80, 0x01, 0x36, 0x66, 0xa0, 0x00, 0x42, 0x90, 0x50, 0x91, 0x34, 0x22, 0xa0, 0x00,
+    0x45, 0x90, 0x92, 0xc2, 0x46, 0x90, 0x94, 0xc6, 0x54, 0x94, 0x00, 0x09, 0x36, 0x80, 0x00, 0x40,
+    0x44, 0x90, 0x94, 0xc6, 0x80, 0x3b, 0x41, 0x90, 0x11, 0x92, 0x44, 0x90, 0x7c, 0xc1, 0x64, 0xe1,
+    0x2f, 0xc4, 0x14, 0x95, 0xd8, 0x97, 0x38, 0x00, 0xa8, 0x00, 0xd4, 0xc6, 0x7e, 0x41, 0x47, 0x90,
+    0x24, 0xe1, 0x66, 0x61, 0x34, 0x00, 0xa0, 0x04, 0x6f, 0x47, 0x36, 0x40, 0xa8, 0x04, 0x6f, 0x56,
+    0x46, 0x90, 0x36, 0x40, 0xa8, 0x40, 0x6c, 0xc2, 0x46, 0x90, 0x41, 0x90, 0x38, 0x10, 0xa0, 0x04,
+    0x79, 0xc1, 0xe8, 0x44, 0xeb, 0x44, 0x94, 0xc0, 0xec, 0x44, 0xea, 0x44, 0x94, 0xc0, 0xed, 0x44,
+    0xe9, 0x44, 0x98, 0xc0, 0x04, 0x66, 0x38, 0x88, 0x80, 0x0a, 0x92, 0x58, 0x96, 0xc0, 0x7a, 0x41,
+    0x2a, 0x03, 0x80, 0x34, 0x9a, 0xc0, 0xd6, 0x24, 0x04, 0x62, 0x38, 0x88, 0x80, 0x0a, 0xc5, 0x5f,
+    0x98, 0xc6, 0x2b, 0x02, 0x80, 0x18, 0x90, 0xc0, 0x6f, 0x10, 0x96, 0xc2, 0x06, 0x62, 0x38, 0x88,
+    0x00, 0x09, 0x37, 0x00, 0x00, 0x40, 0x80, 0x0a, 0x3d, 0x60, 0x33, 0xa8, 0x80, 0x0a, 0x96, 0xc0,
+    0x29, 0x00, 0x81, 0xdc, 0x90, 0xc0, 0x38, 0x80, 0xa0, 0x00, 0x6c, 0x90, 0x97, 0x44, 0x55, 0xbf,
+    0x41, 0x95, 0x36, 0x18, 0xa1, 0x00, 0xd4, 0xc5, 0x55, 0xbf, 0x36, 0x00, 0xa1, 0x00, 0xd4, 0xc5,
+    0xef, 0x39, 0x41, 0x9d, 0x9a, 0xc0, 0x6f, 0x10, 0x3b, 0x60, 0x33, 0xa8, 0x80, 0x0a, 0x97, 0x57,
+    0xc5, 0xff, 0x54, 0x9b, 0x72, 0x77, 0x98, 0xd0, 0xd3, 0xd4, 0xd2, 0xd6, 0x7b, 0x41, 0x54, 0x9b,
+    0x72, 0x77, 0x98, 0xc0, 0xd2, 0xd6, 0x6c, 0x10, 0x6c, 0x90, 0x97, 0x46, 0x96, 0xc0, 0x66, 0xe8,
+    0x2b, 0x02, 0x80, 0x02, 0x94, 0xc2, 0x3e, 0x15, 0x80, 0x0f, 0x98, 0xc7, 0x39, 0x60, 0x33, 0xb0,
+    0x80, 0x0a, 0xc6, 0xff, 0x3a, 0x60, 0x33, 0xa8, 0x80, 0x0a, 0x96, 0xc3, 0x06, 0x62, 0x38, 0xa8,
+    0x80, 0x0a, 0x96, 0xc2, 0x05, 0x62, 0x00, 0x09, 0x37, 0x80, 0x00, 0x40, 0x38, 0xa8, 0x80, 0x0a,
+    0x94, 0xc8, 0xc0, 0x3a, 0xc0, 0x39, 0x98, 0xc0, 0x3c, 0x00, 0x20, 0xa0, 0x80, 0x08, 0xe9, 0xee,
+    0x98, 0xc0, 0x06, 0x64, 0x38, 0xaa, 0x80, 0x0a, 0xe8, 0xef, 0x32, 0x24, 0x2e, 0xa0, 0x80, 0x09,
+    0x46, 0x14, 0x27, 0xe8, 0x9f, 0x10, 0xe7, 0xe8, 0x94, 0xc0, 0x9e, 0x21, 0x9f, 0x21, 0x94, 0xc0,
+    0x96, 0x21, 0x97, 0x21, 0x9f, 0x71, 0x35, 0xd6, 0x2d, 0x10, 0x14, 0x01, 0x82, 0x92, 0x20, 0x00,
+    0x83, 0x40, 0x2c, 0x7d, 0xc1, 0x94, 0x20, 0x00, 0x81, 0x00, 0x6c, 0x7c, 0x44, 0x18, 0x16, 0x01,
+    0x82, 0x94, 0x6e, 0x7c, 0x46, 0x18, 0x16, 0x01, 0x82, 0x98, 0x76, 0xd6, 0x6d, 0x7d, 0x77, 0x55,
+    0x6e, 0x7c, 0x27, 0x04, 0x80, 0x81, 0x46, 0x10, 0xe8, 0x44, 0x92, 0xc8, 0x42, 0x98, 0x9f, 0x70,
+    0x77, 0x53, 0x33, 0x24, 0x3f, 0x30, 0x80, 0x09, 0x2f, 0x10, 0x10, 0x00, 0x00, 0x09, 0x38, 0x00,
+    0x00, 0x40, 0x91, 0x22, 0x24, 0x6a, 0x08, 0x91, 0x80, 0x02, 0x27, 0x0a, 0x82, 0x60, 0xe7, 0xea,
+    0x29, 0x0a, 0x80, 0x02, 0x84, 0x3e, 0x00, 0xf8, 0x9d, 0xc4, 0x27, 0xee, 0x9f, 0xcc, 0xef, 0xe8,
+    0x10, 0x9f, 0x18, 0x01, 0xa0, 0x0a, 0x31, 0x00, 0x20, 0x00, 0x80, 0x10, 0x09, 0xf8, 0x9d, 0xc0,
+    0x0a, 0xf8, 0x9d, 0xbc, 0x32, 0xc4, 0x3b, 0x40, 0x80, 0x08, 0xc8, 0x4f, 0x3b, 0x41, 0x00, 0x1e,
+    0xc8, 0x47, 0x19, 0xf8, 0x9d, 0xc0, 0x11, 0x00, 0x91, 0x22, 0x30, 0xf6, 0x1a, 0xf8, 0x9d, 0xbc,
+    0x81, 0xd1, 0x2d, 0x10, 0x00, 0xe5, 0x21, 0xd8, 0x80, 0x09, 0x35, 0x60, 0x02, 0xf8, 0x9d, 0xb8,
+    0x31, 0x81, 0x20, 0x00, 0x80, 0x00, 0x35, 0x79, 0x02, 0xf8, 0x9d, 0xb4, 0x20, 0x00, 0x80, 0x81,
+    0x27, 0xec, 0x9f, 0xcc, 0x27, 0xee, 0x9d, 0xc8, 0x29, 0x0f, 0x80, 0x08, 0x00, 0xf8, 0x9d, 0xb0,
+    0x38, 0xe0, 0x00, 0x09, 0x38, 0x80, 0x00, 0x40, 0x21, 0xd8, 0x80, 0x09, 0x02, 0xf8, 0x9d, 0xac,
+    0x1b, 0xf8, 0x9d, 0x84, 0x09, 0xf8, 0x9d, 0xc0, 0x10, 0x9b, 0x0a, 0xf8, 0x9d, 0xbc, 0x10, 0x9b,
+    0xf0, 0x42, 0xf0, 0x41, 0x08, 0xf8, 0x9d, 0xa8, 0x0b, 0xf8, 0x9d, 0xa4, 0x32, 0x04, 0x2f, 0xca,
+    0x80, 0x09, 0xcc, 0x4e, 0x34, 0xd0, 0x12, 0xf8, 0x9d, 0xb8, 0xd5, 0x2f, 0xcc, 0x46, 0x19, 0xf8,
+    0x9d, 0xc0, 0x1a, 0xf8, 0x9d, 0xbc, 0x18, 0xf8, 0x9d, 0xa8, 0x1b, 0xf8, 0x9d, 0xa4, 0x84, 0x14,
+    0x92, 0xc3, 0x6f, 0x90, 0xd5, 0x3f, 0x84, 0x0c, 0x94, 0xc3, 0x27, 0x41, 0x8c, 0xcc, 0x27, 0x61,
+    0x93, 0x33, 0x12, 0xf8, 0x9d, 0xb4, 0x65, 0x69, 0x84, 0x09, 0xe8, 0x41, 0x92, 0xf8, 0xec, 0x42,
+    0x39, 0x61, 0x50, 0x54, 0x12, 0x51, 0x02, 0xf8, 0x9d, 0xb4, 0x60, 0x32, 0x64, 0x69, 0x80, 0x44,
+    0x94, 0xc2, 0x25, 0x61, 0x9f, 0xff, 0x24, 0xe9, 0x00, 0x09, 0x39, 0x00, 0x00, 0x40, 0xcc, 0x4e,
+    0x80, 0x38, 0x92, 0xc2, 0x55, 0x52, 0x18, 0x01, 0xa0, 0x12, 0x32, 0xa4, 0x2f, 0x54, 0x80, 0x08,
+    0x08, 0xf8, 0x9d, 0xa8, 0x12, 0xf8, 0x9d, 0xac, 0x2e, 0x92, 0x1a, 0xf8, 0x9d, 0xbc, 0x3e, 0xc8,
+    0xcc, 0x46, 0x26, 0xe5, 0x11, 0x52, 0x18, 0xf8, 0x9d, 0xa8, 0x3e, 0xc8, 0x19, 0xf8, 0x9d, 0xc0,
+    0x36, 0xdd, 0x1b, 0xf8, 0x9d, 0xa4, 0x6d, 0x7c, 0x20, 0xbb, 0x16, 0x97, 0x10, 0xf8, 0x9d, 0xb0,
+    0x38, 0x61, 0x12, 0xf8, 0x9d, 0xb8, 0x24, 0x6a, 0x2c, 0x05, 0x20, 0xf7, 0x39, 0x41, 0x00, 0xf8,
+    0x9d, 0xb0, 0x2c, 0xf7, 0x02, 0xf8, 0x9d, 0xb8, 0x6c, 0xd1, 0x36, 0x51, 0x35, 0x51, 0x35, 0xd1,
+    0x41, 0x9f, 0x20, 0x76, 0x36, 0x51, 0x61, 0x75, 0x6c, 0x76, 0x36, 0x50, 0x74, 0x51, 0x6d, 0x74,
+    0x6c, 0x08, 0x70, 0xc0, 0x81, 0x16, 0x41, 0x5e, 0x27, 0x04, 0x80, 0x81, 0x27, 0xea, 0x00, 0x09,
+    0x39, 0x80, 0x00, 0x40, 0x9e, 0xca, 0x27, 0xe8, 0x9d, 0xc8, 0x92, 0xd0, 0x50, 0x18, 0x40, 0x1a,
+    0x23, 0x00, 0x80, 0x81, 0x27, 0xee, 0x9e, 0xca, 0x22, 0x00, 0x80, 0x80, 0x6f, 0x90, 0xb6, 0x8a,
+    0x2c, 0x10, 0x2e, 0x1f, 0xd7, 0x47, 0x2c, 0x10, 0x2e, 0x7d, 0xcf, 0x40, 0x6c, 0x7c, 0x32, 0x76,
+    0x2c, 0x16, 0xc8, 0x44, 0x80, 0x1a, 0x78, 0x41, 0x2b, 0x03, 0x80, 0x0c, 0x9b, 0x40, 0x27, 0xea,
+    0x9d, 0xc8, 0xea, 0x08, 0x94, 0xd0, 0xcf, 0x4d, 0x54, 0x1a, 0xd6, 0xc4, 0xcf, 0x45, 0x36, 0xc0,
+    0x34, 0xf0, 0x37, 0x53, 0xcf, 0x4c, 0xd6, 0x45, 0xc0, 0x81, 0x32, 0x44, 0x20, 0x00, 0x80, 0x09,
+    0xcf, 0x44, 0x35, 0xd6, 0x3b, 0xc1, 0xd8, 0x90, 0x39, 0xe1, 0xcf, 0x48, 0x22, 0x74, 0x25, 0xea,
+    0x19, 0xf8, 0x9d, 0xc0, 0x2e, 0x74, 0x10, 0xf8, 0x9d, 0xc4, 0x7e, 0x48, 0x66, 0x65, 0x7e, 0x48,
+    0x76, 0x5c, 0x6c, 0x7c, 0x00, 0x09, 0x3a, 0x00, 0x00, 0x40, 0x22, 0x00, 0x80, 0x80, 0x81, 0x96,
+    0x44, 0x5e, 0x23, 0x04, 0x80, 0x81, 0x2b, 0x03, 0x80, 0x0c, 0x19, 0xf8, 0x9d, 0x84, 0x27, 0xe8,
+    0x9e, 0xca, 0x10, 0x91, 0x51, 0x58, 0x61, 0x74, 0x6d, 0x74, 0x42, 0x99, 0x50, 0x91, 0x92, 0xd0,
+    0x61, 0x74, 0x6d, 0x74, 0x42, 0x99, 0x27, 0xe8, 0x9d, 0xa0, 0x30, 0x24, 0x3f, 0x50, 0x80, 0x09,
+    0xe7, 0xe8, 0x31, 0x04, 0x24, 0x86, 0x80, 0x09, 0x33, 0x24, 0x3f, 0x30, 0x80, 0x09, 0x2f, 0x90,
+    0x2e, 0x10, 0x2e, 0x90, 0x09, 0x86, 0x3a, 0x58, 0x80, 0x09, 0xee, 0xe8, 0x13, 0x01, 0x82, 0x8a,
+    0x2f, 0x7c, 0xc6, 0xe2, 0x07, 0x01, 0x82, 0x8a, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0xc7, 0x98,
+    0x35, 0xd7, 0x10, 0x00, 0x82, 0x8c, 0x2c, 0x7c, 0x2c, 0x10, 0xe7, 0x58, 0x04, 0x00, 0x82, 0x8c,
+    0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0, 0x11, 0x00, 0x00, 0x09, 0x3a, 0x80, 0x00, 0x40,
+    0x82, 0x8e, 0x6d, 0x7c, 0x05, 0x00, 0x82, 0x8e, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0,
+    0x12, 0x00, 0x82, 0x90, 0x6e, 0x7c, 0x06, 0x00, 0x82, 0x90, 0x00, 0x06, 0x80, 0x18, 0x08, 0x86,
+    0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0, 0x10, 0x00, 0x82, 0x8a, 0x7c, 0x49, 0x40, 0x96, 0x08, 0x86,
+    0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0, 0x10, 0x00, 0x82, 0x8c, 0x7c, 0x49, 0xb0, 0x71, 0x08, 0x86,
+    0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0, 0x11, 0x00, 0x82, 0x8e, 0x3c, 0xc3, 0x01, 0x06, 0x80, 0x1a,
+    0x64, 0xe8, 0x92, 0xc2, 0x6c, 0x10, 0x94, 0xc7, 0x67, 0xe8, 0xc0, 0xff, 0x92, 0xc2, 0x6d, 0x10,
+    0x32, 0xe4, 0x3d, 0x8c, 0x80, 0x01, 0x92, 0xc3, 0xc2, 0xff, 0x23, 0x00, 0x83, 0xe8, 0x32, 0xe4,
+    0x3d, 0x74, 0x80, 0x01, 0x6d, 0x10, 0xb1, 0x72, 0x08, 0x86, 0x3a, 0x58, 0x80, 0x09, 0x90, 0xc0,
+    0x00, 0x09, 0x3b, 0x00, 0x00, 0x40, 0x16, 0x00, 0x82, 0x90, 0x67, 0x68, 0x80, 0x10, 0x96, 0xc2,
+    0x30, 0x00, 0x20, 0x00, 0xbf, 0xe0, 0x30, 0x10, 0x20, 0x00, 0xbf, 0xe0, 0x2c, 0x90, 0x32, 0x08,
+    0x20, 0x00, 0x81, 0x70, 0x32, 0xe4, 0x3e, 0x52, 0x80, 0x01, 0x6d, 0x90, 0x32, 0xe4, 0x3e, 0xa0,
+    0x80, 0x01, 0x37, 0xd0, 0x34, 0x56, 0x77, 0x51, 0x27, 0x60, 0x35, 0x50, 0x35, 0xd1, 0x74, 0x57,
+    0x32, 0xe4, 0x3e, 0xac, 0x80, 0x01, 0x74, 0xd6, 0x33, 0xe4, 0x3e, 0xbe, 0x80, 0x01, 0x33, 0x04,
+    0x2a, 0x86, 0x80, 0x09, 0x36, 0x50, 0x30, 0xe0, 0x28, 0x65, 0x80, 0x06, 0xb3, 0xf1, 0x25, 0xe8,
+    0x31, 0x11, 0x20, 0x00, 0x98, 0x00, 0xb4, 0x73, 0x32, 0xe4, 0x3d, 0x74, 0x80, 0x01, 0x94, 0xc1,
+    0xc2, 0xff, 0x6d, 0x10, 0x35, 0x51, 0x24, 0xe1, 0x30, 0x00, 0x20, 0x00, 0x82, 0x00, 0x2a, 0xff,
+    0x9e, 0xc1, 0xb2, 0x74, 0x2a, 0xff, 0x00, 0x09, 0x3b, 0x80, 0x00, 0x40, 0x9e, 0xbb, 0xb1, 0xf2,
+    0x37, 0xd0, 0x39, 0x60, 0x3f, 0x84, 0x80, 0x0a, 0x97, 0x45, 0x27, 0xe8, 0x9f, 0xe8, 0x92, 0xd0,
+    0x51, 0x99, 0x41, 0x98, 0x27, 0xe4, 0x31, 0x40, 0x34, 0x77, 0x81, 0x71, 0x67, 0xe9, 0x24, 0x18,
+    0x80, 0xe2, 0x96, 0xc2, 0x30, 0x00, 0x20, 0x00, 0x81, 0x00, 0x74, 0x57, 0x2a, 0xff, 0x9e, 0x89,
+    0x64, 0x66, 0x27, 0xe8, 0x31, 0x00, 0x20, 0x00, 0x80, 0x80, 0xd4, 0x41, 0x31, 0xee, 0x9f, 0x00,
+    0x98, 0xc7, 0x31, 0x60, 0x32, 0x18, 0x80, 0xb1, 0x67, 0x64, 0x2a, 0xff, 0x9e, 0x6b, 0x74, 0x56,
+    0x6f, 0x83, 0x2a, 0xff, 0x9e, 0x63, 0x34, 0xd7, 0x74, 0x57, 0xf1, 0xc2, 0x2a, 0xff, 0x9e, 0x59,
+    0xcf, 0x40, 0x35, 0x50, 0xcf, 0x49, 0x34, 0x51, 0xf1, 0xc3, 0x2a, 0xff, 0x9e, 0x4b, 0x6c, 0xd8,
+    0x35, 0x50, 0xcf, 0x49, 0x34, 0x51, 0xf1, 0xc4, 0x2a, 0xff, 0x9e, 0x3d, 0x00, 0x09, 0x3c, 0x00,
+    0x00, 0x40, 0x6c, 0xd8, 0x35, 0x50, 0xcf, 0x49, 0x34, 0x51, 0xf1, 0xc5, 0x2a, 0xff, 0x9e, 0x2f,
+    0x6c, 0xd8, 0x35, 0x50, 0xcf, 0x49, 0x34, 0x51, 0xf1, 0xc6, 0x2a, 0xff, 0x9e, 0x21, 0x6c, 0xd8,
+    0x35, 0x50, 0x34, 0x57, 0x31, 0x00, 0x20, 0x00, 0x82, 0x00, 0x6d, 0x58, 0x2a, 0xff, 0x9e, 0x0f,
+    0xcf, 0x42, 0x24, 0x68, 0x34, 0xd0, 0xcf, 0x4a, 0x2f, 0xab, 0xc2, 0x98, 0x94, 0xc1, 0xc0, 0xff,
+    0x6c, 0x10, 0x25, 0x68, 0x75, 0xd2, 0x92, 0xc2, 0x6d, 0x10, 0x32, 0xe4, 0x3d, 0x8c, 0x80, 0x01,
+    0x92, 0xc3, 0xc2, 0xff, 0x27, 0xe8, 0x75, 0xd7, 0x92, 0xc2, 0x6d, 0x10, 0x32, 0xe4, 0x3d, 0x74,
+    0x80, 0x01, 0x92, 0xc3, 0xc2, 0xff, 0x27, 0x68, 0x24, 0xe1, 0x30, 0x00, 0x20, 0x00, 0x81, 0x00,
+    0x80, 0x0c, 0x6c, 0xd1, 0x67, 0x64, 0x7f, 0x78, 0x88, 0x08, 0xd4, 0x1e, 0x7f, 0x78, 0xd4, 0x16,
+    0x2a, 0xff, 0x00, 0x09, 0x3c, 0x80, 0x00, 0x40, 0x9d, 0xbb, 0x64, 0x61, 0x2c, 0x90, 0x12, 0x06,
+    0x80, 0x1a, 0x79, 0x41, 0x65, 0x6a, 0x84, 0x24, 0xb0, 0x75, 0x2e, 0x09, 0x80, 0x1c, 0x2c, 0x10,
+    0xe8, 0xe9, 0x97, 0x56, 0x90, 0xc0, 0x92, 0xc8, 0x40, 0x98, 0x38, 0xc1, 0x10, 0x06, 0x80, 0x1a,
+    0x78, 0x41, 0x70, 0x71, 0x81, 0xea, 0x29, 0x09, 0x80, 0x58, 0x93, 0x56, 0x2b, 0x03, 0x80, 0x08,
+    0x2e, 0x08, 0x84, 0x94, 0x92, 0xd0, 0xb0, 0xf3, 0x74, 0x40, 0x40, 0x18, 0x30, 0x24, 0x3f, 0x50,
+    0x80, 0x09, 0xe7, 0x78, 0x36, 0xd0, 0x24, 0xe9, 0x35, 0xc1, 0xf0, 0x85, 0xd2, 0x15, 0x66, 0x64,
+    0x6c, 0x7d, 0x2d, 0x20, 0xd6, 0x94, 0x66, 0xe1, 0x80, 0x0c, 0x6c, 0x4d, 0x33, 0xe4, 0x3c, 0x48,
+    0x80, 0x01, 0x88, 0x05, 0x6c, 0x10, 0x30, 0x24, 0x3e, 0xe0, 0x80, 0x09, 0x74, 0xf2, 0x33, 0x24,
+    0x3f, 0x30, 0x80, 0x09, 0x27, 0x0a, 0x80, 0x20, 0x00, 0x09, 0x3d, 0x00, 0x00, 0x40, 0x2c, 0x10,
+    0xe7, 0xea, 0x97, 0x56, 0x28, 0x0e, 0x84, 0x94, 0xea, 0xee, 0x92, 0xc8, 0x40, 0x1a, 0x11, 0x00,
+    0x80, 0x1a, 0x64, 0xea, 0x84, 0x29, 0x28, 0x0c, 0x80, 0x74, 0x2a, 0x00, 0x80, 0x58, 0x97, 0x56,
+    0x2b, 0xe2, 0x9f, 0xea, 0x2a, 0x02, 0x80, 0x17, 0xeb, 0xec, 0x92, 0xd0, 0x51, 0xbb, 0x41, 0xb3,
+    0x38, 0x41, 0x11, 0x00, 0x80, 0x1a, 0x30, 0xf0, 0xec, 0x1a, 0x81, 0xe5, 0x2d, 0x10, 0xef, 0xee,
+    0x2a, 0x00, 0x84, 0x78, 0x23, 0x00, 0x80, 0x58, 0xef, 0x3a, 0xcf, 0x49, 0x97, 0x56, 0x68, 0x93,
+    0xca, 0x41, 0x90, 0xc0, 0x92, 0xc8, 0x42, 0x9a, 0x2c, 0x10, 0xc1, 0x96, 0x29, 0x09, 0x80, 0x58,
+    0xf0, 0x43, 0xf1, 0x44, 0xfa, 0xcf, 0xc6, 0x94, 0x37, 0x00, 0x20, 0x00, 0x80, 0x10, 0x13, 0x91,
+    0x11, 0x00, 0x80, 0x18, 0x24, 0xea, 0xcf, 0x48, 0x84, 0x5d, 0x38, 0xe1, 0xfb, 0xc3, 0x00, 0x09,
+    0x3d, 0x80, 0x00, 0x40, 0x3e, 0x11, 0x80, 0x58, 0x10, 0x90, 0xd4, 0xc0, 0xcc, 0x41, 0xf8, 0x45,
+    0xec, 0x1b, 0x11, 0x94, 0xf9, 0x46, 0x2a, 0xff, 0x9c, 0xa7, 0xfa, 0x47, 0x35, 0x50, 0xf8, 0xc5,
+    0xfa, 0xc7, 0x11, 0x90, 0x30, 0x00, 0x20, 0x00, 0x81, 0x00, 0x2c, 0x31, 0x11, 0x92, 0xf2, 0x48,
+    0x7c, 0xc4, 0xf1, 0x42, 0x2a, 0xff, 0x9c, 0x89, 0xf1, 0xc2, 0xf8, 0xc5, 0xf2, 0xc8, 0x2d, 0x52,
+    0xcf, 0x49, 0x13, 0x00, 0x80, 0x18, 0x20, 0x00, 0x80, 0x58, 0x28, 0x93, 0xfb, 0xc3, 0xcc, 0x41,
+    0xf9, 0xc6, 0xec, 0x1b, 0x88, 0x1a, 0x02, 0x94, 0xfa, 0xc7, 0x3d, 0xc4, 0xcf, 0x4a, 0x20, 0x00,
+    0x80, 0x58, 0x29, 0x11, 0xfb, 0xc3, 0xcc, 0x42, 0x90, 0xc0, 0xec, 0x1b, 0x43, 0x94, 0x11, 0x00,
+    0x80, 0x1a, 0x12, 0x00, 0x80, 0x18, 0x30, 0xf2, 0x6c, 0x18, 0x80, 0x69, 0x22, 0x00, 0x80, 0x58,
+    0x34, 0x01, 0x80, 0x02, 0x00, 0x09, 0x3e, 0x00, 0x00, 0x40, 0xd8, 0x91, 0x36, 0x00, 0x80, 0x02,
+    0xd4, 0xc0, 0xcc, 0x41, 0xfb, 0xc3, 0xec, 0x1f, 0xb0, 0xc5, 0xec, 0x1b, 0x11, 0x94, 0xf8, 0x45,
+    0xf9, 0x46, 0x2a, 0xff, 0x9c, 0x21, 0xfa, 0x47, 0x24, 0x69, 0x34, 0xd0, 0xfa, 0xc7, 0xf8, 0xc5,
+    0x80, 0x32, 0x10, 0x92, 0xf9, 0xc6, 0x3c, 0x44, 0x18, 0x01, 0xa0, 0x08, 0xf0, 0x42, 0x2a, 0xff,
+    0x9e, 0x99, 0xf0, 0xc2, 0x34, 0xd0, 0xf6, 0x01, 0x32, 0xc4, 0x3b, 0x40, 0x80, 0x08, 0x20, 0x00,
+    0x81, 0x00, 0x24, 0x69, 0x2d, 0x03, 0xf8, 0xc5, 0x3d, 0x65, 0xf9, 0xc6, 0x80, 0x0c, 0xfa, 0xc7,
+    0x88, 0x0d, 0x88, 0x0a, 0x22, 0x60, 0x9f, 0xff, 0xb0, 0xc3, 0x75, 0x40, 0x36, 0x72, 0xf0, 0xc3,
+    0x38, 0x44, 0xf1, 0xc4, 0x38, 0xe1, 0xf0, 0x43, 0x24, 0xea, 0xf1, 0x44, 0xb0, 0xc3, 0x34, 0x40,
+    0xea, 0x44, 0x34, 0x70, 0xe9, 0x44, 0x6c, 0x7c, 0x2c, 0xff, 0x00, 0x09, 0x3e, 0x80, 0x00, 0x40,
+    0x9e, 0xf3, 0x44, 0x1e, 0x11, 0x00, 0x80, 0x18, 0x38, 0xc1, 0x10, 0x00, 0x80, 0x1a, 0x34, 0xf1,
+    0x01, 0x00, 0x80, 0x18, 0x70, 0x71, 0x80, 0x07, 0x00, 0x00, 0x80, 0x18, 0x27, 0xe8, 0x9f, 0xe0,
+    0x30, 0x24, 0x3f, 0x50, 0x80, 0x09, 0xe7, 0xe8, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0,
+    0x64, 0xe8, 0x24, 0x18, 0x80, 0x20, 0x92, 0xc3, 0x64, 0xe6, 0xd4, 0xa8, 0x90, 0xc0, 0x94, 0xc3,
+    0x9f, 0x70, 0xd4, 0x11, 0x92, 0xc3, 0x64, 0x65, 0x96, 0xc2, 0x8f, 0xf2, 0x78, 0xe8, 0x7c, 0x48,
+    0x64, 0x65, 0x94, 0xc0, 0x9f, 0x70, 0xd4, 0x19, 0x64, 0x65, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0,
+    0xd4, 0xa8, 0x90, 0xc0, 0x94, 0xc3, 0x9f, 0x70, 0xd4, 0x11, 0x92, 0xc3, 0x64, 0x65, 0x96, 0xc2,
+    0x8f, 0xf2, 0x78, 0xe8, 0x7c, 0x48, 0x64, 0x65, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0,
+    0x00, 0x09, 0x3f, 0x00, 0x00, 0x40, 0x94, 0xc0, 0x92, 0x20, 0x93, 0x20, 0x94, 0x20, 0x6d, 0x6c,
+    0x75, 0xfa, 0x6d, 0x70, 0x6d, 0x60, 0xda, 0x12, 0x66, 0x61, 0x6d, 0x74, 0x6c, 0xcc, 0x74, 0x52,
+    0x64, 0xe0, 0x94, 0x21, 0x94, 0xc0, 0x92, 0x21, 0x93, 0x21, 0x9f, 0x71, 0x90, 0xc0, 0x90, 0xc0,
+    0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x94, 0xc0, 0x9e, 0x20, 0x9f, 0x20, 0x94, 0xc0, 0xfe, 0xc4,
+    0xff, 0xc3, 0x94, 0xc0, 0x9e, 0x20, 0x9f, 0x20, 0x94, 0xc0, 0xf6, 0x46, 0xf7, 0x45, 0x9f, 0x71,
+    0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x94, 0xc0, 0x9e, 0x21, 0x9f, 0x21, 0x94, 0xc0, 0x96, 0x21,
+    0x97, 0x21, 0x9f, 0x75, 0x90, 0xc0, 0x95, 0x30, 0x10, 0x05, 0xa0, 0x04, 0x90, 0xc0, 0x90, 0xc0,
+    0x92, 0x20, 0x75, 0x50, 0xd0, 0xa1, 0x80, 0x29, 0x34, 0xf1, 0x9f, 0xff, 0x80, 0x21, 0x97, 0x50,
+    0xd8, 0x91, 0x64, 0x66, 0x6c, 0x50, 0x00, 0x09, 0x3f, 0x80, 0x00, 0x40, 0x10, 0x05, 0xa0, 0x01,
+    0x90, 0xc0, 0x90, 0xc0, 0x92, 0xc8, 0x70, 0x51, 0x74, 0x70, 0xdd, 0x11, 0x65, 0x6a, 0x25, 0x18,
+    0x80, 0x06, 0x64, 0x64, 0x92, 0x21, 0x95, 0x31, 0x90, 0xc0, 0x90, 0xc0, 0x9f, 0x71, 0x90, 0xc0,
+    0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x95, 0x30, 0x10, 0x05,
+    0xa0, 0x04, 0x90, 0xc0, 0x90, 0xc0, 0x92, 0x20, 0x74, 0x78, 0x74, 0xf9, 0x32, 0x60, 0x3f, 0xff,
+    0x80, 0x00, 0xd0, 0xa1, 0x25, 0x18, 0x80, 0x26, 0x70, 0xfa, 0x25, 0x18, 0x80, 0x14, 0x97, 0x50,
+    0x6c, 0x50, 0xd8, 0x91, 0x92, 0xc8, 0x70, 0x51, 0x74, 0x70, 0x21, 0x18, 0x80, 0x10, 0x70, 0x61,
+    0x92, 0xc3, 0x70, 0x79, 0x6c, 0x10, 0x92, 0xc2, 0x78, 0x41, 0x92, 0x21, 0x95, 0x31, 0x90, 0xc0,
+    0x90, 0xc0, 0x9f, 0x71, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x00, 0x09, 0x40, 0x00,
+    0x00, 0x40, 0x97, 0x50, 0x10, 0x05, 0xa0, 0x01, 0xd8, 0x10, 0xd8, 0x91, 0x92, 0xc8, 0x70, 0x51,
+    0x74, 0x70, 0x9f, 0x71, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0,
+    0x90, 0xc0, 0x95, 0x30, 0x10, 0x05, 0xa0, 0x04, 0x90, 0xc0, 0x90, 0xc0, 0x92, 0x20, 0x64, 0xe8,
+    0x84, 0x17, 0x97, 0x50, 0x74, 0x78, 0xd9, 0x11, 0x92, 0xc8, 0x70, 0x52, 0xd8, 0x18, 0x64, 0x68,
+    0x92, 0xc3, 0x6c, 0x51, 0x88, 0x09, 0x70, 0x79, 0x92, 0xc2, 0x6c, 0x31, 0x92, 0x21, 0x95, 0x31,
+    0x90, 0xc0, 0x90, 0xc0, 0x9f, 0x71, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0, 0x90, 0xc0,
+    0x90, 0xc0, 0x00, 0x09, 0x4b, 0xa4, 0x00, 0x09, 0x4c, 0x78, 0x00, 0x09, 0x4b, 0xac, 0x00, 0x00,
+    0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x92, 0xe0, 0x00, 0x09, 0x4c, 0x90, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x09, 0x40, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x93, 0x00,
+    0x00, 0x09, 0x4c, 0xa0, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x93, 0x40,
+    0x00, 0x09, 0x4c, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x09, 0x9a, 0x30,
+    0x00, 0x09, 0x4c, 0xb4, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x9a, 0x32,
+    0x00, 0x09, 0x4c, 0xb6, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x9a, 0x37,
+    0x00, 0x09, 0x4c, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0x9a, 0x3a,
+    0x00, 0x09, 0x4c, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0x9a, 0x4c,
+    0x00, 0x09, 0x4c, 0xfc, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x9a, 0x50,
+    0x00, 0x09, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x09, 0x41, 0x00, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0x9a, 0x54, 0x00, 0x09, 0x4d, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0x9a, 0x58, 0x00, 0x09, 0x4d, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0x9a, 0x5c, 0x00, 0x09, 0x4d, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x09, 0x9a, 0x5d, 0x00, 0x09, 0x4d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x09, 0x9a, 0x5e, 0x00, 0x09, 0x4d, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x09, 0xa8, 0xc0, 0x00, 0x09, 0x4d, 0x3c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0xa8, 0xcc, 0x00, 0x09, 0x4d, 0x48, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0xa8, 0xd8, 0x00, 0x09, 0x4d, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0x41, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x09, 0xa8, 0xdc, 0x00, 0x09, 0x4d, 0x58,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x09, 0xa8, 0xe0, 0x00, 0x09, 0x4d, 0x5c,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x09, 0xa8, 0xe4, 0x00, 0x09, 0x4d, 0x60,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x09, 0xa8, 0xe8, 0x00, 0x09, 0x4d, 0x64,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x09, 0xa8, 0xec, 0x00, 0x09, 0x4d, 0x68,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x09, 0xb1, 0xf6, 0x00, 0x09, 0x4d, 0x6e,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xb1, 0xfa, 0x00, 0x09, 0x4d, 0x72,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xb1, 0xfc, 0x00, 0x09, 0x4d, 0x74,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x42, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09,
+    0xb5, 0x98, 0x00, 0x09, 0x4d, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x09,
+    0xb5, 0x9c, 0x00, 0x09, 0x4d, 0x7c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0xb5, 0xa0, 0x00, 0x09, 0x4d, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0xb5, 0xa4, 0x00, 0x09, 0x4d, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x09,
+    0xb5, 0xa8, 0x00, 0x09, 0x4d, 0x88, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0xb7, 0xac, 0x00, 0x09, 0x4d, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x09,
+    0xb7, 0xae, 0x00, 0x09, 0x4d, 0x8e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0xb7, 0xb0, 0x00, 0x09, 0x4d, 0x90, 0x00, 0x00, 0x00, 0x02, 0x00, 0x09, 0x42, 0x80, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xb7, 0xb2, 0x00, 0x09, 0x4d, 0x92, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x09, 0xb7, 0xb4, 0x00, 0x09, 0x4d, 0x94, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0xb7, 0xb5, 0x00, 0x09, 0x4d, 0x95, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0xb7, 0xb6, 0x00, 0x09, 0x4d, 0x96, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0xb7, 0xb7, 0x00, 0x09, 0x4d, 0x97, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0xd2, 0x00, 0x00, 0x09, 0x4d, 0x98, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xd2, 0x20, 0x00, 0x09, 0x4d, 0xb8, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xd4, 0xa8, 0x00, 0x09, 0x4d, 0xd8, 0x00, 0x00, 0x00, 0x10,
+    0x00, 0x09, 0x43, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xd4, 0xb8, 0x00, 0x09,
+    0x4d, 0xe8, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xd4, 0xc8, 0x00, 0x09,
+    0x4d, 0xf8, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xd4, 0xd8, 0x00, 0x09,
+    0x4e, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xd7, 0xb8, 0x00, 0x09,
+    0x4e, 0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xd7, 0xbc, 0x00, 0x09,
+    0x4e, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x09, 0xd7, 0xc0, 0x00, 0x09,
+    0x4e, 0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xd7, 0xc8, 0x00, 0x09,
+    0x4e, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x09, 0xd7, 0xcc, 0x00, 0x09,
+    0x4e, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x43, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x09, 0xd7, 0xd0, 0x00, 0x09, 0x4e, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x09, 0xd7, 0xdc, 0x00, 0x09, 0x4e, 0x30, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x09, 0xdb, 0xf0, 0x00, 0x09, 0x4e, 0x34, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x09, 0xdc, 0x1a, 0x00, 0x09, 0x4e, 0x5e, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x09, 0xdc, 0x3f, 0x00, 0x09, 0x4e, 0x83, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x09, 0xdc, 0x63, 0x00, 0x09, 0x4e, 0xa7, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x09, 0xdc, 0x82, 0x00, 0x09, 0x4e, 0xc6, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x09, 0xdc, 0xa0, 0x00, 0x09, 0x4e, 0xe4, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x09, 0x44, 0x00,
+    0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0xdc, 0xbc, 0x00, 0x09, 0x4f, 0x00, 0x00, 0x00,
+    0x00, 0x16, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0xdc, 0xd3, 0x00, 0x09, 0x4f, 0x17, 0x00, 0x00,
+    0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0xdc, 0xe9, 0x00, 0x09, 0x4f, 0x2d, 0x00, 0x00,
+    0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0xdc, 0xfe, 0x00, 0x09, 0x4f, 0x42, 0x00, 0x00,
+    0x00, 0x12, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0xdd, 0x11, 0x00, 0x09, 0x4f, 0x55, 0x00, 0x00,
+    0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0xdd, 0x23, 0x00, 0x09, 0x4f, 0x67, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0xdd, 0x34, 0x00, 0x09, 0x4f, 0x78, 0x00, 0x00,
+    0x00, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0xdd, 0x44, 0x00, 0x09, 0x4f, 0x88, 0x00, 0x00,
+    0x00, 0x0f, 0x00, 0x09, 0x44, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0xdd, 0x54,
+    0x00, 0x09, 0x4f, 0x98, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0xdd, 0x63,
+    0x00, 0x09, 0x4f, 0xa7, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0xdd, 0x72,
+    0x00, 0x09, 0x4f, 0xb6, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0xdd, 0x7a,
+    0x00, 0x09, 0x4f, 0xbe, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0xdd, 0x81,
+    0x00, 0x09, 0x4f, 0xc5, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0xdd, 0x88,
+    0x00, 0x09, 0x4f, 0xcc, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0xdd, 0x8e,
+    0x00, 0x09, 0x4f, 0xd2, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0xdd, 0x93,
+    0x00, 0x09, 0x4f, 0xd7, 0x00, 0x00, 0x00, 0x04, 0x00, 0x09, 0x45, 0x00, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x09, 0xdd, 0x9c, 0x00, 0x09, 0x4f, 0xdc, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x09, 0xdd, 0x9f, 0x00, 0x09, 0x4f, 0xdf, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x09, 0xdd, 0xa2, 0x00, 0x09, 0x4f, 0xe2, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x09, 0xdd, 0xa5, 0x00, 0x09, 0x4f, 0xe5, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x09, 0xdd, 0xa8, 0x00, 0x09, 0x4f, 0xe8, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0xdd, 0xa9, 0x00, 0x09, 0x4f, 0xe9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x09, 0xdd, 0xaa, 0x00, 0x09, 0x4f, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x09, 0xdd, 0xab, 0x00, 0x09, 0x4f, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0x45, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0xdd, 0xac, 0x00, 0x09, 0x4f, 0xec,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0xdd, 0xad, 0x00, 0x09, 0x4f, 0xed,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0xdd, 0xae, 0x00, 0x09, 0x4f, 0xee,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0xde, 0x04, 0x00, 0x09, 0x54, 0x44,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x09, 0xde, 0x08, 0x00, 0x09, 0x54, 0x48,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x09, 0xde, 0x10, 0x00, 0x09, 0x54, 0x4c,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x09, 0xde, 0x14, 0x00, 0x09, 0x54, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x09, 0xde, 0x18, 0x00, 0x09, 0x54, 0x54,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x46, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x09,
+    0xde, 0x1c, 0x00, 0x09, 0x54, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x09,
+    0xde, 0x20, 0x00, 0x09, 0x54, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x09,
+    0xde, 0x24, 0x00, 0x09, 0x54, 0x60, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0xde, 0x2c, 0x00, 0x09, 0x54, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x09,
+    0xde, 0x38, 0x00, 0x09, 0x54, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x09,
+    0xde, 0x40, 0x00, 0x09, 0x54, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x09,
+    0xde, 0x54, 0x00, 0x09, 0x54, 0x70, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0xde, 0x56, 0x00, 0x09, 0x54, 0x72, 0x00, 0x00, 0x00, 0x02, 0x00, 0x09, 0x46, 0x80, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xde, 0x58, 0x00, 0x09, 0x54, 0x74, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xde, 0x59, 0x00, 0x09, 0x54, 0x75, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0xde, 0x5c, 0x00, 0x09, 0x54, 0x78, 0x00, 0x00, 0x00, 0x48,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xde, 0xa4, 0x00, 0x09, 0x54, 0xc0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xc0, 0x00, 0x09, 0xdf, 0x64, 0x00, 0x09, 0x55, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xc0, 0x00, 0x09, 0xe0, 0x24, 0x00, 0x09, 0x5b, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x09, 0xe0, 0x28, 0x00, 0x09, 0x5b, 0x0c, 0x00, 0x00, 0x00, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xe0, 0x30, 0x00, 0x09, 0x5b, 0x14, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x09, 0x47, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xe0, 0x34, 0x00, 0x09,
+    0x5b, 0x18, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xe0, 0x46, 0x00, 0x09,
+    0x5b, 0x2a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xe0, 0x48, 0x00, 0x09,
+    0x5b, 0x2c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xe0, 0x4a, 0x00, 0x09,
+    0x5b, 0x2e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xe0, 0x4c, 0x00, 0x09,
+    0x5b, 0x30, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xe1, 0x28, 0x00, 0x09,
+    0x5b, 0x54, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xe1, 0x44, 0x00, 0x09,
+    0x5b, 0x70, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xe1, 0x48, 0x00, 0x09,
+    0x5b, 0x74, 0x00, 0x00, 0x00, 0x02, 0x00, 0x09, 0x47, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x09, 0xe1, 0x4a, 0x00, 0x09, 0x5b, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x09, 0xe1, 0x50, 0x00, 0x09, 0x5b, 0x98, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x09, 0xe1, 0xa8, 0x00, 0x09, 0x5b, 0xf0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x09, 0xe1, 0xac, 0x00, 0x09, 0x5b, 0xf4, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x09, 0xe1, 0xd8, 0x00, 0x09, 0x5c, 0x20, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x09, 0xe1, 0xf0, 0x00, 0x09, 0x5c, 0x38, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x09, 0xe2, 0x08, 0x00, 0x09, 0x5c, 0x4c, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x09, 0xe2, 0x3c, 0x00, 0x09, 0x5c, 0x7c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x09, 0x48, 0x00,
+    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xe2, 0x40, 0x00, 0x09, 0x5e, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x09, 0xea, 0x44, 0x00, 0x09, 0x5e, 0x84, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xea, 0x46, 0x00, 0x09, 0x5e, 0x86, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xea, 0x4a, 0x00, 0x09, 0x5e, 0x88, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xea, 0x4c, 0x00, 0x09, 0x5e, 0x8a, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xeb, 0xb4, 0x00, 0x09, 0x5e, 0x8c, 0x00, 0x00,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xfd, 0xbc, 0x00, 0x09, 0x5e, 0xe8, 0x00, 0x00,
+    0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xfd, 0xc8, 0x00, 0x09, 0x5e, 0xf4, 0x00, 0x00,
+    0x00, 0x04, 0x00, 0x09, 0x48, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xfd, 0xcc,
+    0x00, 0x09, 0x5e, 0xf8, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xfd, 0xd0,
+    0x00, 0x09, 0x5e, 0xfc, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xfd, 0xd4,
+    0x00, 0x09, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x04, 0x9a,
+    0x00, 0x09, 0x5f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0a, 0x18, 0x64,
+    0x00, 0x09, 0x5f, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0a, 0x18, 0x6c,
+    0x00, 0x09, 0x5f, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x18, 0x6e,
+    0x00, 0x09, 0x5f, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x18, 0x70,
+    0x00, 0x09, 0x5f, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x09, 0x49, 0x00, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0a, 0x1a, 0x24, 0x00, 0x09, 0x5f, 0x34, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0a, 0x1a, 0x28, 0x00, 0x09, 0x5f, 0x38, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0a, 0x1a, 0x2c, 0x00, 0x09, 0x5f, 0x3c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0a, 0x1a, 0x30, 0x00, 0x09, 0x5f, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0a, 0x1a, 0x34, 0x00, 0x09, 0x5f, 0x44, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0a, 0x1a, 0x74, 0x00, 0x09, 0x5f, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x00, 0x0a, 0x1a, 0x78, 0x00, 0x09, 0x5f, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x00, 0x0a, 0x1a, 0x7c, 0x00, 0x09, 0x5f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0x49, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0a, 0x1a, 0x80, 0x00, 0x09, 0x5f, 0x54,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0a, 0x1a, 0x86, 0x00, 0x09, 0x5f, 0x58,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0a, 0x1a, 0x8e, 0x00, 0x09, 0x5f, 0x5c,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0a, 0x1a, 0x90, 0x00, 0x09, 0x5f, 0x60,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0a, 0x1a, 0x94, 0x00, 0x09, 0x5f, 0x64,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0a, 0x1a, 0x95, 0x00, 0x09, 0x5f, 0x65,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0a, 0x1a, 0x98, 0x00, 0x09, 0x5f, 0x68,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0a, 0x1b, 0x9c, 0x00, 0x09, 0x5f, 0x6c,
+    0x00, 0x00, 0x00, 0xf4, 0x00, 0x09, 0x4a, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a,
+    0x1c, 0x90, 0x00, 0x09, 0x60, 0x60, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a,
+    0x1c, 0xbc, 0x00, 0x09, 0x60, 0x8c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a,
+    0x1c, 0xd8, 0x00, 0x09, 0x60, 0xa8, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x0a,
+    0x1c, 0xf4, 0x00, 0x09, 0x60, 0xc4, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0a,
+    0x1d, 0x08, 0x00, 0x09, 0x60, 0xd8, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a,
+    0x1d, 0x14, 0x00, 0x09, 0x60, 0xe0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a,
+    0x1d, 0x18, 0x00, 0x09, 0x60, 0xe4, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a,
+    0x1d, 0x1c, 0x00, 0x09, 0x60, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x4a, 0x80, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x0a, 0x1d, 0x20, 0x00, 0x09, 0x60, 0xec, 0x00, 0x00, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x0a, 0x1d, 0x34, 0x00, 0x09, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0c, 0x00, 0x0a, 0x1d, 0x40, 0x00, 0x09, 0x61, 0x0c, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x1d, 0x44, 0x00, 0x09, 0x61, 0x10, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x1d, 0x48, 0x00, 0x09, 0x61, 0x14, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x1d, 0x4c, 0x00, 0x09, 0x61, 0x18, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x0a, 0x1d, 0x54, 0x00, 0x09, 0x61, 0x1c, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x1d, 0x58, 0x00, 0x09, 0x61, 0x20, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x09, 0x4b, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x1d, 0x5c, 0x00, 0x09,
+    0x61, 0x24, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x1d, 0x60, 0x00, 0x09,
+    0x61, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0a, 0x73, 0xa0, 0x00, 0x09,
+    0x69, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0a, 0x73, 0xa4, 0x00, 0x09,
+    0x69, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0a, 0x78, 0x4c, 0x00, 0x09,
+    0x69, 0x14, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0a, 0x78, 0x60, 0x00, 0x09,
+    0x69, 0x28, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x78, 0x74, 0x00, 0x09,
+    0x69, 0x3c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0a, 0x78, 0x90, 0x00, 0x09,
+    0x69, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x4b, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x0a, 0x78, 0x9c, 0x00, 0x09, 0x69, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x0a, 0x7f, 0x84, 0x00, 0x09, 0x69, 0x58, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x0c, 0x56, 0x00, 0x00, 0x0c, 0x55, 0x00,
+    0x00, 0x0c, 0xa0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0c, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x09, 0x6c, 0x00, 0x00, 0x01, 0x13, 0x98, 0x00, 0x00, 0x00, 0x01, 0x68, 0x74, 0x74, 0x70,
+    0x73, 0x3a, 0x2f, 0x2f, 0x61, 0x75, 0x73, 0x73, 0x76, 0x6e, 0x30, 0x31, 0x3a, 0x38, 0x30, 0x2f,
+    0x73, 0x76, 0x6e, 0x2f, 0x74, 0x69, 0x6d, 0x62, 0x65, 0x72, 0x77, 0x6f, 0x6c, 0x66, 0x2d, 0x73,
+    0x77, 0x2f, 0x66, 0x69, 0x72, 0x6d, 0x77, 0x61, 0x72, 0x65, 0x2f, 0x7a, 0x00, 0x09, 0x4c, 0x00,
+    0x00, 0x40, 0x6c, 0x73, 0x33, 0x38, 0x30, 0x36, 0x33, 0x2f, 0x62, 0x72, 0x61, 0x6e, 0x63, 0x68,
+    0x65, 0x73, 0x2f, 0x33, 0x4d, 0x69, 0x63, 0x73, 0x5f, 0x32, 0x44, 0x5f, 0x42, 0x65, 0x61, 0x6d,
+    0x66, 0x6f, 0x72, 0x6d, 0x65, 0x72, 0x00, 0x31, 0x30, 0x38, 0x34, 0x32, 0x00, 0x55, 0x6e, 0x6d,
+    0x6f, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x00, 0x32, 0x30, 0x31, 0x37, 0x2f, 0x30, 0x39, 0x2f,
+    0x32, 0x32, 0x20, 0x31, 0x32, 0x3a, 0x35, 0x39, 0x3a, 0x33, 0x31, 0x00, 0x32, 0x30, 0x31, 0x37,
+    0x2f, 0x30, 0x39, 0x2f, 0x32, 0x35, 0x20, 0x31, 0x32, 0x3a, 0x31, 0x30, 0x3a, 0x34, 0x31, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0x4b, 0xd0, 0x00, 0x09, 0x4c, 0x25, 0x00, 0x09, 0x4c, 0x2b, 0x00, 0x09,
+    0x4c, 0x36, 0x00, 0x09, 0x4c, 0x4a, 0x2a, 0x53, 0x00, 0x00, 0x00, 0x0c, 0x56, 0x00, 0x00, 0x0c,
+    0x55, 0x00, 0x00, 0x09, 0x4c, 0x80, 0x00, 0x40, 0x00, 0x0c, 0xa0, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x0c, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x93, 0x5c, 0x00, 0x09, 0x99, 0x5c,
+    0x00, 0x09, 0x95, 0x9c, 0x00, 0x09, 0x97, 0xdc, 0x00, 0x09, 0x94, 0x1c, 0x00, 0x09, 0x98, 0x9c,
+    0x00, 0x09, 0x96, 0x5c, 0x00, 0x09, 0x94, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x04, 0x00, 0x05, 0x00, 0x06,
+    0x00, 0x05, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x00, 0x18, 0x00, 0x20, 0x00, 0x2c, 0x00, 0x30,
+    0x00, 0x28, 0x00, 0x30, 0x00, 0x08, 0x00, 0x10, 0x00, 0x18, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30,
+    0x00, 0x30, 0x1f, 0x40, 0x1f, 0x40, 0x3e, 0x80, 0x5d, 0xc0, 0x7d, 0x00, 0xac, 0x44, 0xbb, 0x80,
+    0x9c, 0x40, 0x00, 0x00, 0x00, 0x08, 0x0e, 0x00, 0x00, 0x09, 0x4d, 0x00, 0x00, 0x40, 0x00, 0x08,
+    0x0e, 0x80, 0x00, 0x08, 0x0f, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x49, 0x6e, 0x63,
+    0x6f, 0x6d, 0x70, 0x61, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x20, 0x41, 0x70, 0x70, 0x6c, 0x69, 0x63,
+    0x61, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x00, 0x55, 0x6e, 0x74, 0x72, 0x69, 0x6d, 0x6d, 0x65, 0x64,
+    0x20, 0x50, 0x61, 0x72, 0x74, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x69, 0x3c, 0x00, 0x08,
+    0x69, 0x78, 0x00, 0x08, 0x69, 0xbc, 0x00, 0x08, 0x6b, 0x1e, 0x00, 0x08, 0x6b, 0x5a, 0x00, 0x08,
+    0x6b, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xb5, 0x80, 0x00, 0x09,
+    0x4d, 0x80, 0x00, 0x40, 0x00, 0x09, 0xb5, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xd1, 0x40,
+    0x00, 0x09, 0xcf, 0x80, 0x00, 0x09, 0xd0, 0x40, 0x00, 0x09, 0xd1, 0x00, 0x00, 0x09, 0xd0, 0xc0,
+    0x00, 0x09, 0xcf, 0xc0, 0x00, 0x09, 0xd0, 0x00, 0x00, 0x09, 0xd1, 0x80, 0x00, 0x09, 0xb8, 0x00,
+    0x00, 0x09, 0xbc, 0x00, 0x00, 0x09, 0xc4, 0x00, 0x00, 0x09, 0xcc, 0x00, 0x00, 0x09, 0xba, 0x00,
+    0x00, 0x09, 0xc2, 0x00, 0x00, 0x09, 0xc8, 0x00, 0x00, 0x09, 0xc0, 0x00, 0x00, 0x09, 0xd3, 0x3c,
+    0x00, 0x09, 0xd2, 0xe8, 0x00, 0x09, 0xd4, 0x8c, 0x00, 0x09, 0xd2, 0xb0, 0x00, 0x09, 0xd2, 0xcc,
+    0x00, 0x09, 0xd2, 0x78, 0x00, 0x09, 0xd3, 0xe4, 0x00, 0x09, 0xd2, 0x5c, 0x00, 0x09, 0xd3, 0x90,
+    0x00, 0x09, 0xd4, 0x38, 0x00, 0x09, 0x4e, 0x00, 0x00, 0x40, 0x00, 0x09, 0xd4, 0x54, 0x00, 0x09,
+    0xd4, 0x1c, 0x00, 0x09, 0xd3, 0xac, 0x00, 0x09, 0xd3, 0x58, 0x00, 0x09, 0xd4, 0x70, 0x00, 0x09,
+    0xd3, 0x20, 0x00, 0x09, 0xd7, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x50, 0xf0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xd7, 0xe8, 0x50, 0x75,
+    0x74, 0x20, 0x43, 0x50, 0x55, 0x20, 0x74, 0x6f, 0x20, 0x73, 0x6c, 0x65, 0x65, 0x70, 0x2e, 0x20,
+    0x53, 0x65, 0x74, 0x20, 0x48, 0x42, 0x49, 0x3d, 0x30, 0x78, 0x46, 0x44, 0x38, 0x30, 0x20, 0x74,
+    0x6f, 0x20, 0x61, 0x77, 0x61, 0x6b, 0x65, 0x00, 0x77, 0x72, 0x20, 0x3c, 0x61, 0x64, 0x64, 0x72,
+    0x3e, 0x20, 0x3c, 0x77, 0x6f, 0x72, 0x64, 0x30, 0x3e, 0x20, 0x5b, 0x77, 0x6f, 0x72, 0x64, 0x31,
+    0x5d, 0x2e, 0x2e, 0x2e, 0x5b, 0x77, 0x6f, 0x72, 0x64, 0x39, 0x00, 0x09, 0x4e, 0x80, 0x00, 0x40,
+    0x39, 0x5d, 0x00, 0x57, 0x72, 0x69, 0x74, 0x65, 0x20, 0x75, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x31,
+    0x30, 0x30, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x73, 0x20, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x20, 0x40,
+    0x3c, 0x61, 0x64, 0x64, 0x72, 0x3e, 0x00, 0x52, 0x65, 0x61, 0x64, 0x20, 0x53, 0x79, 0x73, 0x74,
+    0x65, 0x6d, 0x20, 0x49, 0x6e, 0x74, 0x65, 0x72, 0x72, 0x75, 0x70, 0x74, 0x20, 0x52, 0x65, 0x67,
+    0x69, 0x73, 0x74, 0x65, 0x72, 0x00, 0x77, 0x72, 0x20, 0x3c, 0x61, 0x64, 0x64, 0x72, 0x3e, 0x20,
+    0x3c, 0x77, 0x6f, 0x72, 0x64, 0x30, 0x3e, 0x20, 0x5b, 0x77, 0x6f, 0x72, 0x64, 0x31, 0x5d, 0x20,
+    0x2e, 0x2e, 0x2e, 0x00, 0x52, 0x65, 0x61, 0x64, 0x20, 0x5b, 0x6c, 0x65, 0x6e, 0x5d, 0x20, 0x77,
+    0x6f, 0x72, 0x64, 0x73, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3c, 0x61, 0x64, 0x64, 0x72, 0x3e, 0x00,
+    0x00, 0x09, 0x4f, 0x00, 0x00, 0x40, 0x66, 0x6c, 0x43, 0x72, 0x20, 0x3c, 0x61, 0x70, 0x70, 0x4e,
+    0x75, 0x6d, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x3e, 0x00, 0x52, 0x65, 0x70,
+    0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x20, 0x43, 0x52, 0x20, 0x69, 0x6e, 0x20, 0x66, 0x6c, 0x61,
+    0x73, 0x68, 0x00, 0x53, 0x68, 0x6f, 0x77, 0x20, 0x63, 0x70, 0x75, 0x20, 0x75, 0x74, 0x69, 0x6c,
+    0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x54, 0x75, 0x72, 0x6e, 0x20, 0x63, 0x68, 0x61,
+    0x72, 0x20, 0x65, 0x63, 0x68, 0x6f, 0x20, 0x6f, 0x66, 0x66, 0x00, 0x54, 0x75, 0x72, 0x6e, 0x20,
+    0x63, 0x68, 0x61, 0x72, 0x20, 0x65, 0x63, 0x68, 0x6f, 0x20, 0x6f, 0x6e, 0x00, 0x4c, 0x6f, 0x61,
+    0x64, 0x20, 0x26, 0x20, 0x72, 0x75, 0x6e, 0x20, 0x61, 0x70, 0x70, 0x20, 0x23, 0x00, 0x72, 0x64,
+    0x20, 0x3c, 0x61, 0x64, 0x64, 0x72, 0x00, 0x09, 0x4f, 0x80, 0x00, 0x40, 0x3e, 0x20, 0x5b, 0x6c,
+    0x65, 0x6e, 0x5d, 0x00, 0x53, 0x75, 0x70, 0x65, 0x72, 0x55, 0x73, 0x65, 0x72, 0x20, 0x4d, 0x6f,
+    0x64, 0x65, 0x0a, 0x00, 0x72, 0x75, 0x6e, 0x61, 0x70, 0x70, 0x20, 0x3c, 0x61, 0x70, 0x70, 0x20,
+    0x23, 0x3e, 0x00, 0x53, 0x68, 0x6f, 0x77, 0x20, 0x61, 0x70, 0x70, 0x20, 0x73, 0x76, 0x6e, 0x20,
+    0x23, 0x00, 0x45, 0x63, 0x68, 0x6f, 0x4f, 0x66, 0x66, 0x00, 0x45, 0x63, 0x68, 0x6f, 0x4f, 0x6e,
+    0x00, 0x72, 0x75, 0x6e, 0x61, 0x70, 0x70, 0x00, 0x73, 0x6c, 0x65, 0x65, 0x70, 0x00, 0x66, 0x6c,
+    0x43, 0x72, 0x00, 0x73, 0x68, 0x6f, 0x77, 0x00, 0x72, 0x64, 0x00, 0x77, 0x72, 0x00, 0x54, 0x57,
+    0x00, 0x73, 0x75, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x19, 0x77,
+    0x00, 0x04, 0x18, 0xef, 0x00, 0x04, 0x16, 0xac, 0x00, 0x08, 0x8c, 0xb4, 0x00, 0x09, 0x50, 0x00,
+    0x00, 0x40, 0x00, 0x09, 0xdd, 0x9c, 0x00, 0x09, 0xdd, 0x34, 0x00, 0x04, 0x0c, 0xba, 0x00, 0x01,
+    0xfb, 0xa6, 0x00, 0x09, 0xdd, 0x9f, 0x00, 0x09, 0xdc, 0x82, 0x00, 0x04, 0x0d, 0x50, 0x00, 0x01,
+    0xfb, 0xac, 0x00, 0x04, 0x0f, 0xa2, 0x00, 0x04, 0x0f, 0x7c, 0x00, 0x04, 0x0c, 0x44, 0x00, 0x01,
+    0xf8, 0x58, 0x00, 0x04, 0x0f, 0xb9, 0x00, 0x04, 0x0f, 0x15, 0x00, 0x04, 0x0c, 0xed, 0x00, 0x01,
+    0xf8, 0x28, 0x00, 0x04, 0x0f, 0xad, 0x00, 0x04, 0x0e, 0xff, 0x00, 0x04, 0x0c, 0xba, 0x00, 0x01,
+    0xf8, 0x2e, 0x00, 0x04, 0x0f, 0xa6, 0x00, 0x04, 0x0e, 0xe8, 0x00, 0x04, 0x0c, 0x82, 0x00, 0x01,
+    0xf8, 0x34, 0x00, 0x04, 0x0f, 0xb6, 0x00, 0x04, 0x0e, 0x3c, 0x00, 0x04, 0x0d, 0x7d, 0x00, 0x01,
+    0xf8, 0x40, 0x00, 0x04, 0x0f, 0xb3, 0x00, 0x04, 0x0e, 0x1b, 0x00, 0x04, 0x0d, 0x50, 0x00, 0x01,
+    0xf8, 0x46, 0x00, 0x09, 0x50, 0x80, 0x00, 0x40, 0x00, 0x04, 0x0f, 0x9e, 0x00, 0x04, 0x0d, 0xf7,
+    0x00, 0x04, 0x0d, 0x20, 0x00, 0x01, 0xf8, 0x4c, 0x00, 0x04, 0x0f, 0x99, 0x00, 0x04, 0x0e, 0x5d,
+    0x00, 0x04, 0x0d, 0xa8, 0x00, 0x01, 0xf8, 0x52, 0x00, 0x04, 0x0f, 0x92, 0x00, 0x04, 0x0f, 0x92,
+    0x00, 0x04, 0x0e, 0xd0, 0x00, 0x01, 0xf8, 0x64, 0x00, 0x09, 0xdd, 0x81, 0x00, 0x09, 0xdd, 0x54,
+    0x00, 0x09, 0xdd, 0x23, 0x00, 0x08, 0x8e, 0x0a, 0x00, 0x04, 0x0f, 0x8a, 0x00, 0x04, 0x0f, 0x8a,
+    0x00, 0x09, 0x52, 0xd0, 0x00, 0x01, 0xf8, 0x5e, 0x00, 0x09, 0xdd, 0x93, 0x00, 0x09, 0xdd, 0x93,
+    0x00, 0x09, 0xdc, 0xe9, 0x00, 0x08, 0x8c, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x19, 0x77, 0x00, 0x04, 0x18, 0xef,
+    0x00, 0x04, 0x16, 0xac, 0x00, 0x08, 0x8c, 0x86, 0x00, 0x09, 0x51, 0x00, 0x00, 0x40, 0x00, 0x09,
+    0xdd, 0x9c, 0x00, 0x09, 0xdd, 0x34, 0x00, 0x09, 0xdc, 0xa0, 0x00, 0x01, 0xfb, 0xa6, 0x00, 0x09,
+    0xdd, 0x9f, 0x00, 0x09, 0xdc, 0x1a, 0x00, 0x09, 0xdc, 0x3f, 0x00, 0x01, 0xfb, 0xac, 0x00, 0x04,
+    0x19, 0x59, 0x00, 0x04, 0x19, 0x59, 0x00, 0x09, 0xdd, 0x63, 0x00, 0x08, 0x8a, 0xaa, 0x00, 0x09,
+    0xdd, 0x8e, 0x00, 0x09, 0xdc, 0xbc, 0x00, 0x09, 0xdc, 0xd3, 0x00, 0x08, 0x8b, 0x3a, 0x00, 0x09,
+    0x54, 0x27, 0x00, 0x09, 0x54, 0x27, 0x00, 0x09, 0xdc, 0x63, 0x00, 0x08, 0x8b, 0xb8, 0x00, 0x09,
+    0xdd, 0x72, 0x00, 0x09, 0xdd, 0x72, 0x00, 0x09, 0xdc, 0xfe, 0x00, 0x08, 0x8b, 0xae, 0x00, 0x09,
+    0xdd, 0x7a, 0x00, 0x09, 0xdd, 0x7a, 0x00, 0x09, 0xdd, 0x11, 0x00, 0x08, 0x8b, 0xa4, 0x00, 0x09,
+    0xdd, 0x88, 0x00, 0x09, 0xdd, 0x88, 0x00, 0x09, 0xdb, 0xf0, 0x00, 0x08, 0x8e, 0x02, 0x00, 0x09,
+    0x51, 0x80, 0x00, 0x40, 0x00, 0x09, 0xdd, 0xa5, 0x00, 0x09, 0xdd, 0xab, 0x00, 0x09, 0xdd, 0xab,
+    0x00, 0x08, 0x8d, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0a, 0x21, 0x20, 0x20, 0x53, 0x56, 0x4e, 0x20, 0x49, 0x4e, 0x46, 0x4f,
+    0x3a, 0x0a, 0x21, 0x09, 0x52, 0x65, 0x76, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x3a, 0x20, 0x25, 0x73,
+    0x20, 0x2d, 0x2d, 0x20, 0x25, 0x73, 0x0a, 0x21, 0x09, 0x43, 0x6f, 0x6d, 0x6d, 0x69, 0x74, 0x20,
+    0x54, 0x69, 0x6d, 0x65, 0x3a, 0x20, 0x25, 0x73, 0x0a, 0x21, 0x09, 0x42, 0x75, 0x69, 0x6c, 0x64,
+    0x20, 0x54, 0x69, 0x6d, 0x65, 0x3a, 0x20, 0x25, 0x73, 0x0a, 0x00, 0x0a, 0x53, 0x79, 0x73, 0x74,
+    0x65, 0x6d, 0x20, 0x49, 0x6e, 0x74, 0x65, 0x72, 0x72, 0x75, 0x70, 0x74, 0x20, 0x49, 0x6e, 0x64,
+    0x69, 0x63, 0x61, 0x74, 0x00, 0x09, 0x52, 0x00, 0x00, 0x40, 0x69, 0x6f, 0x6e, 0x20, 0x52, 0x65,
+    0x67, 0x69, 0x73, 0x74, 0x65, 0x72, 0x3a, 0x00, 0x0a, 0x50, 0x72, 0x65, 0x73, 0x73, 0x20, 0x45,
+    0x73, 0x63, 0x20, 0x74, 0x6f, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x74, 0x6f, 0x20,
+    0x4e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x20, 0x4d, 0x6f, 0x64, 0x65, 0x3a, 0x0a, 0x00, 0x43, 0x75,
+    0x72, 0x72, 0x65, 0x6e, 0x74, 0x20, 0x43, 0x50, 0x55, 0x20, 0x75, 0x74, 0x69, 0x6c, 0x69, 0x7a,
+    0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x20, 0x25, 0x33, 0x64, 0x2e, 0x25, 0x31, 0x64, 0x25, 0x25,
+    0x0a, 0x00, 0x49, 0x64, 0x6c, 0x65, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x20, 0x63, 0x61, 0x6c, 0x6c,
+    0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x3a, 0x20, 0x25, 0x35, 0x64, 0x2c, 0x25, 0x30, 0x2e, 0x33,
+    0x64, 0x0a, 0x00, 0x57, 0x6f, 0x72, 0x73, 0x74, 0x20, 0x35, 0x00, 0x09, 0x52, 0x80, 0x00, 0x40,
+    0x30, 0x6d, 0x73, 0x20, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6c, 0x3a, 0x20, 0x25, 0x33,
+    0x64, 0x2e, 0x25, 0x31, 0x64, 0x25, 0x25, 0x0a, 0x00, 0x41, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x61,
+    0x74, 0x69, 0x6f, 0x6e, 0x20, 0x43, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x20, 0x43, 0x6f, 0x6e,
+    0x74, 0x65, 0x78, 0x74, 0x0a, 0x00, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x20, 0x49, 0x6e, 0x20, 0x34,
+    0x20, 0x73, 0x65, 0x63, 0x6f, 0x6e, 0x64, 0x73, 0x20, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x0a, 0x00,
+    0x44, 0x6f, 0x20, 0x61, 0x6e, 0x20, 0x69, 0x6c, 0x6c, 0x65, 0x67, 0x61, 0x6c, 0x20, 0x69, 0x6e,
+    0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x3a,
+    0x20, 0x55, 0x6e, 0x6b, 0x6e, 0x6f, 0x77, 0x6e, 0x20, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64,
+    0x00, 0x09, 0x53, 0x00, 0x00, 0x40, 0x20, 0x00, 0x0a, 0x20, 0x73, 0x77, 0x52, 0x65, 0x67, 0x41,
+    0x70, 0x70, 0x52, 0x65, 0x76, 0x43, 0x6f, 0x64, 0x65, 0x20, 0x3d, 0x20, 0x00, 0x45, 0x73, 0x74,
+    0x20, 0x43, 0x50, 0x55, 0x20, 0x63, 0x6c, 0x6f, 0x63, 0x6b, 0x3a, 0x20, 0x25, 0x39, 0x64, 0x0a,
+    0x00, 0x0a, 0x20, 0x50, 0x72, 0x6f, 0x64, 0x75, 0x63, 0x74, 0x20, 0x49, 0x44, 0x20, 0x3d, 0x20,
+    0x5a, 0x4c, 0x53, 0x00, 0x0a, 0x46, 0x6c, 0x61, 0x73, 0x68, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72,
+    0x20, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x00, 0x4e, 0x6f, 0x20, 0x66, 0x6c, 0x61, 0x73, 0x68, 0x20,
+    0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, 0x74, 0x0a, 0x00, 0x41, 0x64, 0x64, 0x72, 0x20, 0x6d, 0x75,
+    0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x68, 0x65, 0x78, 0x0a, 0x00, 0x42, 0x61, 0x64, 0x20, 0x49,
+    0x6d, 0x61, 0x67, 0x65, 0x20, 0x4e, 0x00, 0x09, 0x53, 0x80, 0x00, 0x40, 0x75, 0x6d, 0x62, 0x65,
+    0x72, 0x0a, 0x00, 0x4e, 0x6f, 0x74, 0x20, 0x70, 0x6f, 0x73, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x20,
+    0x25, 0x64, 0x0a, 0x20, 0x00, 0x4e, 0x6f, 0x74, 0x20, 0x70, 0x6f, 0x73, 0x73, 0x69, 0x62, 0x6c,
+    0x65, 0x20, 0x25, 0x64, 0x0a, 0x20, 0x00, 0x49, 0x64, 0x6c, 0x65, 0x20, 0x74, 0x69, 0x63, 0x6b,
+    0x73, 0x3a, 0x20, 0x25, 0x39, 0x64, 0x0a, 0x00, 0x42, 0x75, 0x73, 0x79, 0x20, 0x74, 0x69, 0x63,
+    0x6b, 0x73, 0x3a, 0x20, 0x25, 0x39, 0x64, 0x0a, 0x00, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x20, 0x54,
+    0x6f, 0x6f, 0x20, 0x4c, 0x6f, 0x6e, 0x67, 0x0a, 0x20, 0x00, 0x55, 0x73, 0x61, 0x67, 0x65, 0x3a,
+    0x0a, 0x20, 0x25, 0x73, 0x0a, 0x0a, 0x25, 0x73, 0x0a, 0x0a, 0x00, 0x0a, 0x43, 0x6f, 0x6d, 0x6d,
+    0x61, 0x6e, 0x64, 0x73, 0x3a, 0x0a, 0x00, 0x20, 0x25, 0x34, 0x78, 0x20, 0x00, 0x09, 0x54, 0x00,
+    0x00, 0x40, 0x25, 0x34, 0x78, 0x0a, 0x00, 0x4c, 0x45, 0x4e, 0x20, 0x25, 0x34, 0x78, 0x0a, 0x20,
+    0x00, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x00, 0x45, 0x63, 0x68, 0x6f, 0x4f, 0x66,
+    0x66, 0x00, 0x22, 0x25, 0x73, 0x22, 0x20, 0x0a, 0x00, 0x72, 0x64, 0x53, 0x69, 0x00, 0x20, 0x25,
+    0x73, 0x0a, 0x00, 0x25, 0x73, 0x3e, 0x20, 0x00, 0x0a, 0x20, 0x00, 0x20, 0x0a, 0x00, 0x08, 0x20,
+    0x08, 0x2e, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x06, 0x00, 0x00, 0x00, 0x00, 0x09, 0xdf, 0x64, 0x00, 0x09,
+    0xb1, 0x30, 0x00, 0x09, 0x54, 0x80, 0x00, 0x40, 0x00, 0x09, 0xb0, 0x70, 0x00, 0x09, 0xaf, 0xb0,
+    0x00, 0x09, 0xae, 0xf0, 0x00, 0x09, 0x94, 0x1c, 0x00, 0x09, 0x98, 0x9c, 0x00, 0x09, 0x96, 0x5c,
+    0x00, 0x09, 0x94, 0xdc, 0x00, 0x09, 0x93, 0x5c, 0x00, 0x09, 0x99, 0x5c, 0x00, 0x09, 0x95, 0x9c,
+    0x00, 0x09, 0x97, 0xdc, 0x00, 0x0a, 0x01, 0x98, 0x00, 0x0a, 0x03, 0xd8, 0x00, 0x0a, 0x18, 0x8c,
+    0x00, 0x0a, 0x19, 0x64, 0x00, 0x09, 0xde, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x55, 0x00, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0x55, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x56, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xfe, 0xfb, 0x00, 0x3b,
+    0x01, 0x60, 0x00, 0x6e, 0x03, 0x50, 0xfa, 0x43, 0x02, 0x3a, 0xf8, 0xba, 0x07, 0x36, 0x09, 0x98,
+    0xf2, 0x56, 0x06, 0x8e, 0xd4, 0xe8, 0x1e, 0xba, 0x08, 0x6a, 0x3f, 0xd2, 0xd0, 0x02, 0xdc, 0x63,
+    0x19, 0x29, 0x3f, 0xd3, 0x2f, 0xf3, 0xdd, 0xa3, 0xe4, 0xd4, 0x06, 0x8d, 0x2b, 0x2b, 0x1e, 0x60,
+    0xfa, 0xfa, 0xf8, 0xba, 0xf8, 0xc3, 0x09, 0x3d, 0x0c, 0x53, 0x00, 0x09, 0x56, 0x80, 0x00, 0x40,
+    0x00, 0x6e, 0xfc, 0xad, 0xfa, 0xa6, 0xfd, 0x68, 0x00, 0x76, 0x01, 0x0f, 0x00, 0x54, 0xff, 0xd8,
+    0x00, 0x03, 0xff, 0xf1, 0x00, 0xb5, 0xfe, 0xe7, 0xfe, 0x50, 0x00, 0xa6, 0x00, 0xba, 0xff, 0x81,
+    0x04, 0xe4, 0xff, 0xab, 0xf3, 0x01, 0x03, 0x20, 0x05, 0x53, 0xfb, 0xdb, 0x0d, 0x96, 0x00, 0x00,
+    0xf0, 0x9c, 0x04, 0x25, 0x02, 0xa1, 0xfc, 0xe0, 0x03, 0x3d, 0x00, 0x55, 0xfe, 0x3d, 0x00, 0x7f,
+    0x01, 0x8c, 0xff, 0x5a, 0x00, 0x01, 0x00, 0x00, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xf4, 0xff, 0xf0,
+    0xff, 0xee, 0xff, 0xf0, 0xff, 0xf7, 0x00, 0x05, 0x00, 0x18, 0x00, 0x2e, 0x00, 0x43, 0x00, 0x51,
+    0x00, 0x54, 0x00, 0x49, 0x00, 0x2f, 0x00, 0x0a, 0xff, 0xde, 0xff, 0xb6, 0xff, 0x9b, 0xff, 0x96,
+    0xff, 0xaa, 0xff, 0xd8, 0x00, 0x17, 0x00, 0x5c, 0x00, 0x95, 0x00, 0xb4, 0x00, 0xac, 0x00, 0x79,
+    0x00, 0x09, 0x57, 0x00, 0x00, 0x40, 0x00, 0x23, 0xff, 0xb7, 0xff, 0x4f, 0xff, 0x03, 0xfe, 0xea,
+    0xff, 0x11, 0xff, 0x78, 0x00, 0x0d, 0x00, 0xb2, 0x01, 0x41, 0x01, 0x94, 0x01, 0x8f, 0x01, 0x29,
+    0x00, 0x6e, 0xff, 0x83, 0xfe, 0x9a, 0xfd, 0xed, 0xfd, 0xad, 0xfd, 0xf6, 0xfe, 0xc6, 0xff, 0xf9,
+    0x01, 0x51, 0x02, 0x7d, 0x03, 0x30, 0x03, 0x30, 0x02, 0x6a, 0x00, 0xf8, 0xff, 0x22, 0xfd, 0x4f,
+    0xfb, 0xf1, 0xfb, 0x6a, 0xfb, 0xf1, 0xfd, 0x85, 0xff, 0xde, 0x02, 0x82, 0x04, 0xd3, 0x06, 0x39,
+    0x06, 0x42, 0x04, 0xc5, 0x01, 0xf2, 0xfe, 0x53, 0xfa, 0xaf, 0xf7, 0xea, 0xf6, 0xca, 0xf7, 0xca,
+    0xfa, 0xf0, 0xff, 0xbf, 0x05, 0x45, 0x0a, 0x44, 0x0d, 0x72, 0x0d, 0xc2, 0x0a, 0xb0, 0x04, 0x6a,
+    0xfb, 0xe7, 0xf2, 0xc8, 0xeb, 0x22, 0xe7, 0x1a, 0xe8, 0x80, 0xf0, 0x6c, 0xfe, 0xf5, 0x13, 0x16,
+    0x2a, 0xc2, 0x43, 0x29, 0x59, 0x28, 0x00, 0x09, 0x57, 0x80, 0x00, 0x40, 0x69, 0xc8, 0x72, 0xb9,
+    0x72, 0xb9, 0x69, 0xc8, 0x59, 0x28, 0x43, 0x29, 0x2a, 0xc2, 0x13, 0x16, 0xfe, 0xf5, 0xf0, 0x6c,
+    0xe8, 0x80, 0xe7, 0x1a, 0xeb, 0x22, 0xf2, 0xc8, 0xfb, 0xe7, 0x04, 0x6a, 0x0a, 0xb0, 0x0d, 0xc2,
+    0x0d, 0x72, 0x0a, 0x44, 0x05, 0x45, 0xff, 0xbf, 0xfa, 0xf0, 0xf7, 0xca, 0xf6, 0xca, 0xf7, 0xea,
+    0xfa, 0xaf, 0xfe, 0x53, 0x01, 0xf2, 0x04, 0xc5, 0x06, 0x42, 0x06, 0x39, 0x04, 0xd3, 0x02, 0x82,
+    0xff, 0xde, 0xfd, 0x85, 0xfb, 0xf1, 0xfb, 0x6a, 0xfb, 0xf1, 0xfd, 0x4f, 0xff, 0x22, 0x00, 0xf8,
+    0x02, 0x6a, 0x03, 0x30, 0x03, 0x30, 0x02, 0x7d, 0x01, 0x51, 0xff, 0xf9, 0xfe, 0xc6, 0xfd, 0xf6,
+    0xfd, 0xad, 0xfd, 0xed, 0xfe, 0x9a, 0xff, 0x83, 0x00, 0x6e, 0x01, 0x29, 0x01, 0x8f, 0x01, 0x94,
+    0x01, 0x41, 0x00, 0xb2, 0x00, 0x0d, 0xff, 0x78, 0xff, 0x11, 0xfe, 0xea, 0x00, 0x09, 0x58, 0x00,
+    0x00, 0x40, 0xff, 0x03, 0xff, 0x4f, 0xff, 0xb7, 0x00, 0x23, 0x00, 0x79, 0x00, 0xac, 0x00, 0xb4,
+    0x00, 0x95, 0x00, 0x5c, 0x00, 0x17, 0xff, 0xd8, 0xff, 0xaa, 0xff, 0x96, 0xff, 0x9b, 0xff, 0xb6,
+    0xff, 0xde, 0x00, 0x0a, 0x00, 0x2f, 0x00, 0x49, 0x00, 0x54, 0x00, 0x51, 0x00, 0x43, 0x00, 0x2e,
+    0x00, 0x18, 0x00, 0x05, 0xff, 0xf7, 0xff, 0xf0, 0xff, 0xee, 0xff, 0xf0, 0xff, 0xf4, 0xff, 0xf8,
+    0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0xff, 0xef, 0xff, 0xbe, 0xff, 0x84, 0xff, 0x5d, 0xff, 0x7c,
+    0xff, 0xe4, 0x00, 0x60, 0x00, 0x96, 0x00, 0x4c, 0xff, 0xad, 0xff, 0x39, 0xff, 0x66, 0x00, 0x30,
+    0x00, 0xfb, 0x01, 0x06, 0x00, 0x1a, 0xfe, 0xe2, 0xfe, 0x76, 0xff, 0x6b, 0x01, 0x20, 0x02, 0x1d,
+    0x01, 0x49, 0xff, 0x12, 0xfd, 0x4c, 0xfd, 0xc1, 0x00, 0x71, 0x03, 0x3a, 0x03, 0x77, 0x00, 0x71,
+    0xfc, 0x69, 0x00, 0x09, 0x58, 0x80, 0x00, 0x40, 0xfb, 0x08, 0xfe, 0x25, 0x03, 0xac, 0x06, 0xcb,
+    0x04, 0x02, 0xfc, 0xb7, 0xf6, 0xf4, 0xf8, 0xb0, 0x02, 0x19, 0x0c, 0x0a, 0x0c, 0xdb, 0x00, 0xbe,
+    0xef, 0x0b, 0xe7, 0x5e, 0xf7, 0x2d, 0x1e, 0xec, 0x4e, 0xfc, 0x6f, 0xb0, 0x6f, 0xb0, 0x4e, 0xfc,
+    0x1e, 0xec, 0xf7, 0x2d, 0xe7, 0x5e, 0xef, 0x0b, 0x00, 0xbe, 0x0c, 0xdb, 0x0c, 0x0a, 0x02, 0x19,
+    0xf8, 0xb0, 0xf6, 0xf4, 0xfc, 0xb7, 0x04, 0x02, 0x06, 0xcb, 0x03, 0xac, 0xfe, 0x25, 0xfb, 0x08,
+    0xfc, 0x69, 0x00, 0x71, 0x03, 0x77, 0x03, 0x3a, 0x00, 0x71, 0xfd, 0xc1, 0xfd, 0x4c, 0xff, 0x12,
+    0x01, 0x49, 0x02, 0x1d, 0x01, 0x20, 0xff, 0x6b, 0xfe, 0x76, 0xfe, 0xe2, 0x00, 0x1a, 0x01, 0x06,
+    0x00, 0xfb, 0x00, 0x30, 0xff, 0x66, 0xff, 0x39, 0xff, 0xad, 0x00, 0x4c, 0x00, 0x96, 0x00, 0x60,
+    0xff, 0xe4, 0xff, 0x7c, 0xff, 0x5d, 0xff, 0x84, 0x00, 0x09, 0x59, 0x00, 0x00, 0x40, 0xff, 0xbe,
+    0xff, 0xef, 0xff, 0xfe, 0x00, 0x19, 0xff, 0xea, 0xff, 0xe3, 0x00, 0x1b, 0x00, 0x37, 0xff, 0xde,
+    0xff, 0xa0, 0x00, 0x1f, 0x00, 0x9a, 0xff, 0xf8, 0xff, 0x1c, 0xff, 0xd3, 0x01, 0x3a, 0x00, 0x90,
+    0xfe, 0x71, 0xfe, 0xd0, 0x01, 0xd2, 0x02, 0x1a, 0xfe, 0x1a, 0xfc, 0xa4, 0x01, 0xa4, 0x05, 0x07,
+    0xff, 0x31, 0xf8, 0xcd, 0xfe, 0xf9, 0x0a, 0x1d, 0x04, 0xf4, 0xf1, 0x9e, 0xf0, 0xfe, 0x15, 0x2b,
+    0x3e, 0x82, 0x3e, 0x82, 0x15, 0x2b, 0xf0, 0xfe, 0xf1, 0x9e, 0x04, 0xf4, 0x0a, 0x1d, 0xfe, 0xf9,
+    0xf8, 0xcd, 0xff, 0x31, 0x05, 0x07, 0x01, 0xa4, 0xfc, 0xa4, 0xfe, 0x1a, 0x02, 0x1a, 0x01, 0xd2,
+    0xfe, 0xd0, 0xfe, 0x71, 0x00, 0x90, 0x01, 0x3a, 0xff, 0xd3, 0xff, 0x1c, 0xff, 0xf8, 0x00, 0x9a,
+    0x00, 0x1f, 0xff, 0xa0, 0xff, 0xde, 0x00, 0x37, 0x00, 0x1b, 0xff, 0xe3, 0xff, 0xea, 0x00, 0x09,
+    0x59, 0x80, 0x00, 0x40, 0x00, 0x19, 0xff, 0xfe, 0x00, 0x80, 0xfe, 0x65, 0xff, 0x40, 0x00, 0xb3,
+    0x01, 0x35, 0x00, 0xf4, 0x00, 0x24, 0xff, 0x43, 0xfe, 0xb5, 0xfe, 0xd5, 0xff, 0x9f, 0x00, 0xbe,
+    0x01, 0x9f, 0x01, 0xb8, 0x00, 0xd8, 0xff, 0x53, 0xfd, 0xe8, 0xfd, 0x6e, 0xfe, 0x5a, 0x00, 0x6e,
+    0x02, 0xb8, 0x03, 0xf2, 0x03, 0x26, 0x00, 0x42, 0xfc, 0x5b, 0xf9, 0x5e, 0xf9, 0x57, 0xfd, 0x82,
+    0x05, 0x99, 0x0f, 0xc2, 0x19, 0x11, 0x1e, 0x9f, 0x1e, 0x9f, 0x19, 0x11, 0x0f, 0xc2, 0x05, 0x99,
+    0xfd, 0x82, 0xf9, 0x57, 0xf9, 0x5e, 0xfc, 0x5b, 0x00, 0x42, 0x03, 0x26, 0x03, 0xf2, 0x02, 0xb8,
+    0x00, 0x6e, 0xfe, 0x5a, 0xfd, 0x6e, 0xfd, 0xe8, 0xff, 0x53, 0x00, 0xd8, 0x01, 0xb8, 0x01, 0x9f,
+    0x00, 0xbe, 0xff, 0x9f, 0xfe, 0xd5, 0xfe, 0xb5, 0xff, 0x43, 0x00, 0x24, 0x00, 0xf4, 0x01, 0x35,
+    0x00, 0xb3, 0xff, 0x40, 0x00, 0x09, 0x5a, 0x00, 0x00, 0x40, 0xfe, 0x65, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x01, 0x03, 0x04, 0x06, 0x07, 0x09, 0x0a, 0x0b, 0x0d, 0x0e, 0x10, 0x11, 0x12, 0x14, 0x15,
+    0x16, 0x18, 0x19, 0x1a, 0x1c, 0x1d, 0x1e, 0x20, 0x21, 0x22, 0x24, 0x25, 0x26, 0x28, 0x29, 0x2a,
+    0x2c, 0x2d, 0x2e, 0x2f, 0x31, 0x32, 0x33, 0x34, 0x36, 0x37, 0x38, 0x39, 0x3b, 0x3c, 0x3d, 0x3e,
+    0x3f, 0x41, 0x42, 0x43, 0x44, 0x45, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4d, 0x4e, 0x4f, 0x50, 0x51,
+    0x52, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x5c, 0x5d, 0x5e, 0x5f, 0x60, 0x61, 0x62, 0x63,
+    0x64, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x74, 0x75,
+    0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85,
+    0x86, 0x87, 0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f, 0x00, 0x09, 0x5a, 0x80, 0x00, 0x40,
+    0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0x9b, 0x9b, 0x9c, 0x9d, 0x9e,
+    0x9f, 0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xa9, 0xaa, 0xab, 0xac, 0xad,
+    0xae, 0xaf, 0xb0, 0xb1, 0xb2, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xb9, 0xba, 0xbb,
+    0xbc, 0xbd, 0xbe, 0xbf, 0xc0, 0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc6, 0xc7, 0xc8, 0xc9,
+    0xca, 0xcb, 0xcb, 0xcc, 0xcd, 0xce, 0xcf, 0xd0, 0xd0, 0xd1, 0xd2, 0xd3, 0xd4, 0xd4, 0xd5, 0xd6,
+    0xd7, 0xd8, 0xd8, 0xd9, 0xda, 0xdb, 0xdc, 0xdc, 0xdd, 0xde, 0xdf, 0xe0, 0xe0, 0xe1, 0xe2, 0xe3,
+    0xe4, 0xe4, 0xe5, 0xe6, 0xe7, 0xe7, 0xe8, 0xe9, 0xea, 0xea, 0xeb, 0xec, 0xed, 0xee, 0xee, 0xef,
+    0xf0, 0xf1, 0xf1, 0xf2, 0xf3, 0xf4, 0xf4, 0xf5, 0xf6, 0xf7, 0xf7, 0xf8, 0xf9, 0xf9, 0xfa, 0xfb,
+    0x00, 0x09, 0x5b, 0x00, 0x00, 0x40, 0xfc, 0xfc, 0xfd, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x04, 0xc1, 0x05, 0xa6, 0x06, 0xb7, 0x00, 0x08, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0x80, 0x00, 0x55, 0x00, 0x40, 0x00, 0x33, 0x00, 0x2b, 0x00, 0x25, 0x00, 0x20,
+    0x00, 0x80, 0x00, 0x20, 0x00, 0x80, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00,
+    0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xa0, 0x00, 0x7f, 0xff, 0xa1, 0x00, 0x7f, 0xff,
+    0xa2, 0x00, 0x1c, 0x1d, 0x1e, 0x34, 0x36, 0x38, 0x00, 0x00, 0x00, 0x08, 0xae, 0xc6, 0x00, 0x08,
+    0xb0, 0x24, 0x00, 0x08, 0xb0, 0xc6, 0x00, 0x08, 0xb1, 0x64, 0x00, 0x08, 0xb2, 0xec, 0x00, 0x08,
+    0xb4, 0x06, 0x00, 0x08, 0xb5, 0x46, 0x7f, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00,
+    0x40, 0x00, 0x2a, 0xab, 0x20, 0x00, 0x00, 0x09, 0x5b, 0x80, 0x00, 0x40, 0x19, 0x9a, 0x15, 0x55,
+    0x12, 0x49, 0x10, 0x00, 0x0e, 0x39, 0x0c, 0xcd, 0x0b, 0xa3, 0x0a, 0xab, 0x09, 0xd9, 0x09, 0x25,
+    0x08, 0x89, 0x08, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x04, 0x00, 0x05,
+    0x00, 0x06, 0x00, 0x07, 0x00, 0x08, 0x00, 0x09, 0x00, 0x0a, 0x00, 0x0b, 0x00, 0x0c, 0x00, 0x0d,
+    0x00, 0x0e, 0x00, 0x10, 0x00, 0x11, 0x00, 0x13, 0x00, 0x14, 0x00, 0x16, 0x00, 0x17, 0x00, 0x1a,
+    0x00, 0x1b, 0x00, 0x1e, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x24, 0x00, 0x29, 0x00, 0x2a, 0x00, 0x30,
+    0x00, 0x31, 0x00, 0x37, 0x00, 0x38, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x48, 0x00, 0x49, 0x00, 0x53,
+    0x00, 0x54, 0x00, 0x5f, 0x00, 0x60, 0x00, 0x6e, 0x00, 0x6f, 0x00, 0x80, 0x00, 0x00, 0x00, 0x16,
+    0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x00, 0x09, 0x5c, 0x00,
+    0x00, 0x40, 0x3f, 0xff, 0x2a, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x1f, 0xff, 0x1f, 0xff, 0x19, 0x99,
+    0x15, 0x55, 0x12, 0x49, 0x12, 0x49, 0x0f, 0xff, 0x0e, 0x38, 0x0b, 0xa2, 0x0a, 0xaa, 0x08, 0x88,
+    0x07, 0x1c, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x04, 0x04, 0x05, 0x06,
+    0x07, 0x07, 0x08, 0x09, 0x0b, 0x0c, 0x0f, 0x12, 0x00, 0x00, 0x00, 0x08, 0xc7, 0xec, 0x00, 0x08,
+    0xc7, 0xec, 0x00, 0x08, 0xbe, 0x0a, 0x00, 0x08, 0xc6, 0x86, 0x00, 0x08, 0xc6, 0x94, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x04, 0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x06,
+    0x00, 0x05, 0x00, 0x04, 0x00, 0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22,
+    0x00, 0x05, 0x00, 0x09, 0x5c, 0x80, 0x00, 0x40, 0x00, 0x14, 0x00, 0x2c, 0x00, 0x4f, 0x00, 0x7b,
+    0x00, 0xb1, 0x00, 0xf1, 0x01, 0x3b, 0x01, 0x8e, 0x01, 0xeb, 0x02, 0x51, 0x02, 0xc1, 0x03, 0x3b,
+    0x03, 0xbe, 0x04, 0x4a, 0x04, 0xdf, 0x05, 0x7e, 0x06, 0x25, 0x06, 0xd5, 0x07, 0x8f, 0x08, 0x50,
+    0x09, 0x1b, 0x09, 0xee, 0x0a, 0xc9, 0x0b, 0xad, 0x0c, 0x98, 0x0d, 0x8c, 0x0e, 0x87, 0x0f, 0x8a,
+    0x10, 0x94, 0x11, 0xa6, 0x12, 0xbf, 0x13, 0xde, 0x15, 0x05, 0x16, 0x32, 0x17, 0x66, 0x18, 0xa0,
+    0x19, 0xe0, 0x1b, 0x26, 0x1c, 0x71, 0x1d, 0xc2, 0x1f, 0x19, 0x20, 0x74, 0x21, 0xd5, 0x23, 0x39,
+    0x24, 0xa3, 0x26, 0x10, 0x27, 0x82, 0x28, 0xf7, 0x2a, 0x70, 0x2b, 0xec, 0x2d, 0x6c, 0x2e, 0xee,
+    0x30, 0x73, 0x31, 0xfa, 0x33, 0x83, 0x35, 0x0f, 0x36, 0x9c, 0x38, 0x2a, 0x39, 0xba, 0x3b, 0x4a,
+    0x3c, 0xdc, 0x3e, 0x6e, 0x40, 0x00, 0x41, 0x92, 0x00, 0x09, 0x5d, 0x00, 0x00, 0x40, 0x43, 0x24,
+    0x44, 0xb5, 0x46, 0x46, 0x47, 0xd5, 0x49, 0x64, 0x4a, 0xf1, 0x4c, 0x7c, 0x4e, 0x05, 0x4f, 0x8d,
+    0x51, 0x12, 0x52, 0x94, 0x54, 0x13, 0x55, 0x8f, 0x57, 0x08, 0x58, 0x7e, 0x59, 0xef, 0x5b, 0x5d,
+    0x5c, 0xc6, 0x5e, 0x2b, 0x5f, 0x8b, 0x60, 0xe7, 0x62, 0x3d, 0x63, 0x8e, 0x64, 0xda, 0x66, 0x20,
+    0x67, 0x60, 0x68, 0x99, 0x69, 0xcd, 0x6a, 0xfa, 0x6c, 0x21, 0x6d, 0x41, 0x6e, 0x5a, 0x6f, 0x6b,
+    0x70, 0x76, 0x71, 0x79, 0x72, 0x74, 0x73, 0x67, 0x74, 0x53, 0x75, 0x36, 0x76, 0x12, 0x76, 0xe5,
+    0x77, 0xaf, 0x78, 0x71, 0x79, 0x2a, 0x79, 0xda, 0x7a, 0x82, 0x7b, 0x20, 0x7b, 0xb6, 0x7c, 0x42,
+    0x7c, 0xc5, 0x7d, 0x3e, 0x7d, 0xae, 0x7e, 0x14, 0x7e, 0x71, 0x7e, 0xc5, 0x7f, 0x0e, 0x7f, 0x4e,
+    0x7f, 0x84, 0x7f, 0xb1, 0x7f, 0xd3, 0x7f, 0xec, 0x7f, 0xfb, 0x7f, 0xff, 0x7f, 0xfb, 0x00, 0x09,
+    0x5d, 0x80, 0x00, 0x40, 0x7f, 0xec, 0x7f, 0xd3, 0x7f, 0xb1, 0x7f, 0x84, 0x7f, 0x4e, 0x7f, 0x0e,
+    0x7e, 0xc5, 0x7e, 0x71, 0x7e, 0x14, 0x7d, 0xae, 0x7d, 0x3e, 0x7c, 0xc5, 0x7c, 0x42, 0x7b, 0xb6,
+    0x7b, 0x20, 0x7a, 0x82, 0x79, 0xda, 0x79, 0x2a, 0x78, 0x71, 0x77, 0xaf, 0x76, 0xe5, 0x76, 0x12,
+    0x75, 0x36, 0x74, 0x53, 0x73, 0x67, 0x72, 0x74, 0x71, 0x79, 0x70, 0x76, 0x6f, 0x6b, 0x6e, 0x5a,
+    0x6d, 0x41, 0x6c, 0x21, 0x6a, 0xfa, 0x69, 0xcd, 0x68, 0x99, 0x67, 0x60, 0x66, 0x20, 0x64, 0xda,
+    0x63, 0x8e, 0x62, 0x3d, 0x60, 0xe7, 0x5f, 0x8b, 0x5e, 0x2b, 0x5c, 0xc6, 0x5b, 0x5d, 0x59, 0xef,
+    0x58, 0x7e, 0x57, 0x08, 0x55, 0x8f, 0x54, 0x13, 0x52, 0x94, 0x51, 0x12, 0x4f, 0x8d, 0x4e, 0x05,
+    0x4c, 0x7c, 0x4a, 0xf1, 0x49, 0x64, 0x47, 0xd5, 0x46, 0x46, 0x44, 0xb5, 0x43, 0x24, 0x41, 0x92,
+    0x40, 0x00, 0x3e, 0x6e, 0x00, 0x09, 0x5e, 0x00, 0x00, 0x40, 0x3c, 0xdc, 0x3b, 0x4a, 0x39, 0xba,
+    0x38, 0x2a, 0x36, 0x9c, 0x35, 0x0f, 0x33, 0x83, 0x31, 0xfa, 0x30, 0x73, 0x2e, 0xee, 0x2d, 0x6c,
+    0x2b, 0xec, 0x2a, 0x70, 0x28, 0xf7, 0x27, 0x82, 0x26, 0x10, 0x24, 0xa3, 0x23, 0x39, 0x21, 0xd5,
+    0x20, 0x74, 0x1f, 0x19, 0x1d, 0xc2, 0x1c, 0x71, 0x1b, 0x26, 0x19, 0xe0, 0x18, 0xa0, 0x17, 0x66,
+    0x16, 0x32, 0x15, 0x05, 0x13, 0xde, 0x12, 0xbf, 0x11, 0xa6, 0x10, 0x94, 0x0f, 0x8a, 0x0e, 0x87,
+    0x0d, 0x8c, 0x0c, 0x98, 0x0b, 0xad, 0x0a, 0xc9, 0x09, 0xee, 0x09, 0x1b, 0x08, 0x50, 0x07, 0x8f,
+    0x06, 0xd5, 0x06, 0x25, 0x05, 0x7e, 0x04, 0xdf, 0x04, 0x4a, 0x03, 0xbe, 0x03, 0x3b, 0x02, 0xc1,
+    0x02, 0x51, 0x01, 0xeb, 0x01, 0x8e, 0x01, 0x3b, 0x00, 0xf1, 0x00, 0xb1, 0x00, 0x7b, 0x00, 0x4f,
+    0x00, 0x2c, 0x00, 0x14, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x5e, 0x80, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0x09, 0xea, 0x50,
+    0x60, 0xa9, 0x44, 0xe1, 0x38, 0xac, 0x31, 0x75, 0x2c, 0x92, 0x28, 0xfe, 0x26, 0x3c, 0x24, 0x08,
+    0x22, 0x38, 0x20, 0xb3, 0x1f, 0x67, 0x1e, 0x48, 0x1d, 0x4d, 0x1c, 0x6f, 0x1b, 0xaa, 0x1a, 0xf8,
+    0x1a, 0x59, 0x19, 0xc8, 0x19, 0x43, 0x18, 0xca, 0x18, 0x5b, 0x17, 0xf4, 0x17, 0x95, 0x17, 0x3c,
+    0x16, 0xea, 0x16, 0x9e, 0x16, 0x56, 0x16, 0x13, 0x15, 0xd4, 0x15, 0x98, 0x15, 0x60, 0x15, 0x2b,
+    0x15, 0x2b, 0x12, 0xf8, 0x11, 0xdb, 0x11, 0x37, 0x10, 0xd2, 0x10, 0x91, 0x10, 0x66, 0x10, 0x48,
+    0x10, 0x33, 0x10, 0x25, 0x10, 0x18, 0x10, 0x0d, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x0d, 0x60, 0x00,
+    0x00, 0x0d, 0xc0, 0x00, 0x00, 0x09, 0xfd, 0x94, 0x00, 0x09, 0xfd, 0x7c, 0x00, 0x09, 0xfd, 0x88,
+    0x00, 0x09, 0x5f, 0x00, 0x00, 0x40, 0x00, 0x09, 0xfd, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x10, 0x00, 0x00, 0x80, 0x00, 0x5a, 0x82, 0x49, 0xe7,
+    0x40, 0x00, 0x39, 0x3e, 0x34, 0x41, 0x30, 0x61, 0x2d, 0x41, 0x2a, 0xab, 0x28, 0x7a, 0x26, 0x98,
+    0x24, 0xf3, 0x23, 0x80, 0x22, 0x36, 0x21, 0x0d, 0x20, 0x00, 0x7f, 0xff, 0xff, 0xff, 0x23, 0x11,
+    0x89, 0x63, 0x00, 0x00, 0x00, 0x01, 0x96, 0x78, 0x54, 0x29, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x02, 0x46, 0x00, 0x00, 0x02, 0x8d, 0x00, 0x00,
+    0x02, 0xdd, 0x00, 0x00, 0x03, 0x37, 0x00, 0x09, 0x5f, 0x80, 0x00, 0x40, 0x00, 0x00, 0x03, 0x9b,
+    0x00, 0x00, 0x04, 0x0c, 0x00, 0x00, 0x04, 0x8a, 0x00, 0x00, 0x05, 0x18, 0x00, 0x00, 0x05, 0xb7,
+    0x00, 0x00, 0x06, 0x6a, 0x00, 0x00, 0x07, 0x32, 0x00, 0x00, 0x08, 0x13, 0x00, 0x00, 0x09, 0x0f,
+    0x00, 0x00, 0x0a, 0x2a, 0x00, 0x00, 0x0b, 0x68, 0x00, 0x00, 0x0c, 0xcc, 0x00, 0x00, 0x0e, 0x5c,
+    0x00, 0x00, 0x10, 0x1d, 0x00, 0x00, 0x12, 0x14, 0x00, 0x00, 0x14, 0x49, 0x00, 0x00, 0x16, 0xc3,
+    0x00, 0x00, 0x19, 0x8a, 0x00, 0x00, 0x1c, 0xa7, 0x00, 0x00, 0x20, 0x26, 0x00, 0x00, 0x24, 0x13,
+    0x00, 0x00, 0x28, 0x7a, 0x00, 0x00, 0x2d, 0x6a, 0x00, 0x00, 0x32, 0xf5, 0x00, 0x00, 0x39, 0x2c,
+    0x00, 0x00, 0x40, 0x26, 0x00, 0x00, 0x47, 0xfa, 0x00, 0x00, 0x50, 0xc3, 0x00, 0x00, 0x5a, 0x9d,
+    0x00, 0x00, 0x65, 0xac, 0x00, 0x00, 0x72, 0x14, 0x00, 0x00, 0x80, 0x00, 0x00, 0x09, 0x60, 0x00,
+    0x00, 0x40, 0x00, 0x00, 0x8f, 0x9e, 0x00, 0x00, 0xa1, 0x24, 0x00, 0x00, 0xb4, 0xce, 0x00, 0x00,
+    0xca, 0xdd, 0x00, 0x00, 0xe3, 0x9e, 0x00, 0x00, 0xff, 0x64, 0x00, 0x01, 0x1e, 0x8e, 0x00, 0x01,
+    0x41, 0x85, 0x00, 0x01, 0x68, 0xc0, 0x00, 0x01, 0x94, 0xc5, 0x00, 0x01, 0xc6, 0x29, 0x00, 0x01,
+    0xfd, 0x93, 0x00, 0x02, 0x3b, 0xc1, 0x00, 0x02, 0x81, 0x85, 0x00, 0x02, 0xcf, 0xcc, 0x00, 0x03,
+    0x27, 0xa0, 0x00, 0x03, 0x8a, 0x2b, 0x00, 0x03, 0xf8, 0xbd, 0x00, 0x04, 0x74, 0xcd, 0x00, 0x05,
+    0x00, 0x00, 0x00, 0x05, 0x9c, 0x2f, 0x00, 0x06, 0x4b, 0x6c, 0x00, 0x07, 0x10, 0x0c, 0x00, 0x07,
+    0xec, 0xa9, 0x00, 0x08, 0xfe, 0x9a, 0x00, 0x08, 0xfe, 0xbe, 0x00, 0x08, 0xfe, 0xec, 0x00, 0x08,
+    0xff, 0x18, 0x00, 0x08, 0xff, 0x54, 0x00, 0x08, 0xff, 0x90, 0x00, 0x08, 0xff, 0xf6, 0x00, 0x09,
+    0x00, 0x80, 0x00, 0x09, 0x60, 0x80, 0x00, 0x40, 0x00, 0x09, 0x01, 0x0e, 0x00, 0x09, 0x01, 0x44,
+    0x00, 0x09, 0x01, 0x64, 0x00, 0xaa, 0xaa, 0xab, 0x00, 0x66, 0x66, 0x66, 0x00, 0x49, 0x24, 0x92,
+    0x00, 0x38, 0xe3, 0x8a, 0x00, 0x2e, 0x8c, 0xc9, 0x00, 0x27, 0x34, 0x13, 0x00, 0x25, 0xe2, 0x25,
+    0x00, 0x0a, 0x1a, 0x9c, 0x00, 0x0a, 0x1a, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xaa, 0xaa,
+    0xff, 0xff, 0x49, 0xf5, 0x00, 0x00, 0x04, 0x55, 0xff, 0xff, 0xff, 0xe5, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xf2, 0xba, 0x00, 0x2a, 0x82, 0x40, 0x00, 0x00, 0x04, 0x18, 0x00, 0x06, 0x66, 0x66,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xaa, 0xaa, 0xff, 0xff, 0x49, 0xf5, 0x00, 0x00, 0x04, 0x55,
+    0xff, 0xff, 0xff, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x61, 0x00, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x0c, 0x06, 0x00,
+    0x00, 0x03, 0x18, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0xb0, 0x00,
+    0x00, 0x28, 0x3c, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x00,
+    0x00, 0x28, 0x00, 0x03, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x28, 0x00, 0x03, 0x00, 0x00, 0xb1, 0x00,
+    0x00, 0x28, 0x00, 0x04, 0x00, 0x00, 0xb2, 0x00, 0x00, 0x27, 0x00, 0x04, 0x00, 0x00, 0xb3, 0x00,
+    0x00, 0x27, 0x00, 0x05, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x26, 0x00, 0x05, 0x00, 0x00, 0xb5, 0x00,
+    0x00, 0x26, 0x00, 0x06, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x25, 0x00, 0x07, 0x00, 0x00, 0xb7, 0x00,
+    0x00, 0x25, 0x00, 0x08, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x24, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09,
+    0x61, 0x80, 0x00, 0x40, 0xb9, 0x00, 0x00, 0x24, 0x00, 0x0a, 0x00, 0x00, 0xba, 0x00, 0x00, 0x23,
+    0x00, 0x0b, 0x00, 0x00, 0xbb, 0x00, 0x00, 0x23, 0x00, 0x0d, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x22,
+    0x00, 0x0e, 0x00, 0x00, 0xbd, 0x00, 0x00, 0x22, 0x00, 0x10, 0x00, 0x00, 0xbe, 0x00, 0x00, 0x21,
+    0x00, 0x12, 0x00, 0x00, 0xbf, 0x00, 0x00, 0x21, 0x00, 0x14, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x20,
+    0x00, 0x17, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x20, 0x00, 0x1a, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x1f,
+    0x00, 0x1d, 0x00, 0x00, 0xc3, 0x00, 0x00, 0x1f, 0x00, 0x20, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x1e,
+    0x00, 0x24, 0x00, 0x00, 0xc5, 0x00, 0x00, 0x1e, 0x00, 0x29, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x1d,
+    0x00, 0x2e, 0x00, 0x00, 0xc7, 0x00, 0x00, 0x1d, 0x00, 0x33, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x1c,
+    0x00, 0x3a, 0x00, 0x00, 0x00, 0x09, 0x62, 0x00, 0x00, 0x40, 0xc9, 0x00, 0x00, 0x1c, 0x00, 0x41,
+    0x00, 0x00, 0xca, 0x00, 0x00, 0x1b, 0x00, 0x49, 0x00, 0x00, 0xcb, 0x00, 0x00, 0x1b, 0x00, 0x52,
+    0x00, 0x00, 0xcc, 0x00, 0x00, 0x1a, 0x00, 0x5c, 0x00, 0x00, 0xcd, 0x00, 0x00, 0x1a, 0x00, 0x67,
+    0x00, 0x00, 0xce, 0x00, 0x00, 0x19, 0x00, 0x74, 0x00, 0x00, 0xcf, 0x00, 0x00, 0x19, 0x00, 0x82,
+    0x00, 0x00, 0xd0, 0x00, 0x00, 0x18, 0x00, 0x92, 0x00, 0x00, 0xd1, 0x00, 0x00, 0x18, 0x00, 0xa4,
+    0x00, 0x00, 0xd2, 0x00, 0x00, 0x17, 0x00, 0xb8, 0x00, 0x00, 0xd3, 0x00, 0x00, 0x17, 0x00, 0xce,
+    0x00, 0x00, 0xd4, 0x00, 0x00, 0x16, 0x00, 0xe7, 0x00, 0x00, 0xd5, 0x00, 0x00, 0x16, 0x01, 0x04,
+    0x00, 0x00, 0xd6, 0x00, 0x00, 0x15, 0x01, 0x24, 0x00, 0x00, 0xd7, 0x00, 0x00, 0x15, 0x01, 0x47,
+    0x00, 0x00, 0xd8, 0x00, 0x00, 0x14, 0x01, 0x6f, 0x00, 0x00, 0x00, 0x09, 0x62, 0x80, 0x00, 0x40,
+    0xd9, 0x00, 0x00, 0x14, 0x01, 0x9c, 0x00, 0x00, 0xda, 0x00, 0x00, 0x13, 0x01, 0xce, 0x00, 0x00,
+    0xdb, 0x00, 0x00, 0x13, 0x02, 0x07, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x12, 0x02, 0x46, 0x00, 0x00,
+    0xdd, 0x00, 0x00, 0x12, 0x02, 0x8d, 0x00, 0x00, 0xde, 0x00, 0x00, 0x11, 0x02, 0xdd, 0x00, 0x00,
+    0xdf, 0x00, 0x00, 0x11, 0x03, 0x37, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x10, 0x03, 0x9b, 0x00, 0x00,
+    0xe1, 0x00, 0x00, 0x10, 0x04, 0x0c, 0x00, 0x00, 0xe2, 0x00, 0x00, 0x0f, 0x04, 0x8a, 0x00, 0x00,
+    0xe3, 0x00, 0x00, 0x0f, 0x05, 0x18, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x0e, 0x05, 0xb7, 0x00, 0x00,
+    0xe5, 0x00, 0x00, 0x0e, 0x06, 0x6a, 0x00, 0x00, 0xe6, 0x00, 0x00, 0x0d, 0x07, 0x32, 0x00, 0x00,
+    0xe7, 0x00, 0x00, 0x0d, 0x08, 0x13, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x0c, 0x09, 0x0f, 0x00, 0x00,
+    0x00, 0x09, 0x63, 0x00, 0x00, 0x40, 0xe9, 0x00, 0x00, 0x0c, 0x0a, 0x2a, 0x00, 0x00, 0xea, 0x00,
+    0x00, 0x0b, 0x0b, 0x68, 0x00, 0x00, 0xeb, 0x00, 0x00, 0x0b, 0x0c, 0xcc, 0x00, 0x00, 0xec, 0x00,
+    0x00, 0x0a, 0x0e, 0x5c, 0x00, 0x00, 0xed, 0x00, 0x00, 0x0a, 0x10, 0x1d, 0x00, 0x00, 0xee, 0x00,
+    0x00, 0x09, 0x12, 0x14, 0x00, 0x00, 0xef, 0x00, 0x00, 0x09, 0x14, 0x49, 0x00, 0x00, 0xf0, 0x00,
+    0x00, 0x08, 0x16, 0xc2, 0x00, 0x00, 0xf1, 0x00, 0x00, 0x08, 0x19, 0x89, 0x00, 0x00, 0xf2, 0x00,
+    0x00, 0x07, 0x1c, 0xa7, 0x00, 0x00, 0xf3, 0x00, 0x00, 0x07, 0x20, 0x26, 0x00, 0x00, 0xf4, 0x00,
+    0x00, 0x06, 0x24, 0x12, 0x00, 0x00, 0xf5, 0x00, 0x00, 0x06, 0x28, 0x79, 0x00, 0x00, 0xf6, 0x00,
+    0x00, 0x05, 0x2d, 0x6a, 0x00, 0x00, 0xf7, 0x00, 0x00, 0x05, 0x32, 0xf4, 0x00, 0x00, 0xf8, 0x00,
+    0x00, 0x04, 0x39, 0x2c, 0x00, 0x00, 0x00, 0x09, 0x63, 0x80, 0x00, 0x40, 0xf9, 0x00, 0x00, 0x04,
+    0x40, 0x26, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x03, 0x47, 0xfa, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x03,
+    0x50, 0xc2, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x02, 0x5a, 0x9d, 0x00, 0x00, 0xfd, 0x00, 0x00, 0x02,
+    0x65, 0xab, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x01, 0x72, 0x13, 0x00, 0x00, 0xff, 0x00, 0x00, 0x01,
+    0x7f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x28,
+    0x00, 0x00, 0x00, 0x2a, 0xb0, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x36, 0xb1, 0x00, 0x00, 0x28,
+    0x00, 0x00, 0x00, 0x44, 0xb2, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x55, 0xb3, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x00, 0x6b, 0xb4, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x87, 0xb5, 0x00, 0x00, 0x26,
+    0x00, 0x00, 0x00, 0xaa, 0xb6, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0xd7, 0x00, 0x09, 0x64, 0x00,
+    0x00, 0x40, 0xb7, 0x00, 0x00, 0x25, 0x00, 0x00, 0x01, 0x0e, 0xb8, 0x00, 0x00, 0x24, 0x00, 0x00,
+    0x01, 0x55, 0xb9, 0x00, 0x00, 0x24, 0x00, 0x00, 0x01, 0xad, 0xba, 0x00, 0x00, 0x23, 0x00, 0x00,
+    0x02, 0x1c, 0xbb, 0x00, 0x00, 0x23, 0x00, 0x00, 0x02, 0xa8, 0xbc, 0x00, 0x00, 0x22, 0x00, 0x00,
+    0x03, 0x58, 0xbd, 0x00, 0x00, 0x22, 0x00, 0x00, 0x04, 0x36, 0xbe, 0x00, 0x00, 0x21, 0x00, 0x00,
+    0x05, 0x4e, 0xbf, 0x00, 0x00, 0x21, 0x00, 0x00, 0x06, 0xad, 0xc0, 0x00, 0x00, 0x20, 0x00, 0x00,
+    0x08, 0x68, 0xc1, 0x00, 0x00, 0x20, 0x00, 0x00, 0x0a, 0x95, 0xc2, 0x00, 0x00, 0x1f, 0x00, 0x00,
+    0x0d, 0x53, 0xc3, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x10, 0xc6, 0xc4, 0x00, 0x00, 0x1e, 0x00, 0x00,
+    0x15, 0x1f, 0xc5, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x1a, 0x97, 0xc6, 0x00, 0x00, 0x1d, 0x00, 0x00,
+    0x21, 0x79, 0x00, 0x09, 0x64, 0x80, 0x00, 0x40, 0xc7, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x2a, 0x24,
+    0xc8, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x35, 0x0d, 0xc9, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x42, 0xca,
+    0xca, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x54, 0x15, 0xcb, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x69, 0xdb,
+    0xcc, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x85, 0x44, 0xcd, 0x00, 0x00, 0x1a, 0x00, 0x00, 0xa7, 0xc5,
+    0xce, 0x00, 0x00, 0x19, 0x00, 0x00, 0xd3, 0x36, 0xcf, 0x00, 0x00, 0x19, 0x00, 0x01, 0x09, 0xe6,
+    0xd0, 0x00, 0x00, 0x18, 0x00, 0x01, 0x4e, 0xbf, 0xd1, 0x00, 0x00, 0x18, 0x00, 0x01, 0xa5, 0x6c,
+    0xd2, 0x00, 0x00, 0x17, 0x00, 0x02, 0x12, 0x8a, 0xd3, 0x00, 0x00, 0x17, 0x00, 0x02, 0x9b, 0xe9,
+    0xd4, 0x00, 0x00, 0x16, 0x00, 0x03, 0x48, 0xda, 0xd5, 0x00, 0x00, 0x16, 0x00, 0x04, 0x22, 0x92,
+    0xd6, 0x00, 0x00, 0x15, 0x00, 0x05, 0x34, 0xa9, 0x00, 0x09, 0x65, 0x00, 0x00, 0x40, 0xd7, 0x00,
+    0x00, 0x15, 0x00, 0x06, 0x8d, 0xb8, 0xd8, 0x00, 0x00, 0x14, 0x00, 0x08, 0x40, 0x20, 0xd9, 0x00,
+    0x00, 0x14, 0x00, 0x0a, 0x63, 0x02, 0xda, 0x00, 0x00, 0x13, 0x00, 0x0d, 0x13, 0x7e, 0xdb, 0x00,
+    0x00, 0x13, 0x00, 0x10, 0x76, 0x3f, 0xdc, 0x00, 0x00, 0x12, 0x00, 0x14, 0xb9, 0x6b, 0xdd, 0x00,
+    0x00, 0x12, 0x00, 0x1a, 0x17, 0x21, 0xde, 0x00, 0x00, 0x11, 0x00, 0x20, 0xd8, 0x86, 0xdf, 0x00,
+    0x00, 0x11, 0x00, 0x29, 0x59, 0xb5, 0xe0, 0x00, 0x00, 0x10, 0x00, 0x34, 0x0e, 0x9d, 0xe1, 0x00,
+    0x00, 0x10, 0x00, 0x41, 0x89, 0x37, 0xe2, 0x00, 0x00, 0x0f, 0x00, 0x52, 0x81, 0x43, 0xe3, 0x00,
+    0x00, 0x0f, 0x00, 0x67, 0xde, 0x18, 0xe4, 0x00, 0x00, 0x0e, 0x00, 0x82, 0xc2, 0xf2, 0xe5, 0x00,
+    0x00, 0x0e, 0x00, 0xa4, 0x9e, 0x76, 0xe6, 0x00, 0x00, 0x0d, 0x00, 0xcf, 0x3e, 0x37, 0x00, 0x09,
+    0x65, 0x80, 0x00, 0x40, 0xe7, 0x00, 0x00, 0x0d, 0x01, 0x04, 0xe7, 0x4c, 0xe8, 0x00, 0x00, 0x0c,
+    0x01, 0x48, 0x75, 0x43, 0xe9, 0x00, 0x00, 0x0c, 0x01, 0x9d, 0x81, 0x13, 0xea, 0x00, 0x00, 0x0b,
+    0x02, 0x08, 0x92, 0x29, 0xeb, 0x00, 0x00, 0x0b, 0x02, 0x8f, 0x5c, 0x28, 0xec, 0x00, 0x00, 0x0a,
+    0x03, 0x39, 0x0c, 0xa2, 0xed, 0x00, 0x00, 0x0a, 0x04, 0x0e, 0xac, 0xf4, 0xee, 0x00, 0x00, 0x09,
+    0x05, 0x1b, 0x9d, 0x77, 0xef, 0x00, 0x00, 0x09, 0x06, 0x6e, 0x30, 0x9c, 0xf0, 0x00, 0x00, 0x08,
+    0x08, 0x18, 0x6e, 0x27, 0xf1, 0x00, 0x00, 0x08, 0x0a, 0x31, 0x08, 0xff, 0xf2, 0x00, 0x00, 0x07,
+    0x0c, 0xd4, 0x94, 0xa5, 0xf3, 0x00, 0x00, 0x07, 0x10, 0x27, 0x0a, 0xc3, 0xf4, 0x00, 0x00, 0x06,
+    0x14, 0x55, 0xb5, 0xa2, 0xf5, 0x00, 0x00, 0x06, 0x19, 0x99, 0x99, 0x99, 0xf6, 0x00, 0x00, 0x05,
+    0x20, 0x3a, 0x7e, 0x5b, 0x00, 0x09, 0x66, 0x00, 0x00, 0x40, 0xf7, 0x00, 0x00, 0x05, 0x28, 0x92,
+    0xc1, 0x8a, 0xf8, 0x00, 0x00, 0x04, 0x33, 0x14, 0x26, 0xae, 0xf9, 0x00, 0x00, 0x04, 0x40, 0x4d,
+    0xe6, 0x1f, 0xfa, 0x00, 0x00, 0x03, 0x50, 0xf4, 0x4d, 0x88, 0xfb, 0x00, 0x00, 0x03, 0x65, 0xea,
+    0x59, 0xfd, 0xfc, 0x00, 0x00, 0x02, 0x80, 0x4d, 0xce, 0x79, 0xfd, 0x00, 0x00, 0x02, 0xa1, 0x86,
+    0x6b, 0xa7, 0xfe, 0x00, 0x00, 0x01, 0xcb, 0x59, 0x18, 0x5d, 0xff, 0x00, 0x00, 0x01, 0xff, 0xff,
+    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
+    0x00, 0x08, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00,
+    0x00, 0x0d, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00,
+    0x00, 0x15, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x09, 0x66, 0x80, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x29,
+    0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x42,
+    0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x68,
+    0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0xa5,
+    0x00, 0x00, 0x00, 0xb9, 0x00, 0x00, 0x00, 0xcf, 0x00, 0x00, 0x00, 0xe9, 0x00, 0x00, 0x01, 0x05,
+    0x00, 0x00, 0x01, 0x25, 0x00, 0x00, 0x01, 0x48, 0x00, 0x00, 0x01, 0x71, 0x00, 0x00, 0x01, 0x9e,
+    0x00, 0x00, 0x01, 0xd0, 0x00, 0x00, 0x02, 0x09, 0x00, 0x00, 0x02, 0x48, 0x00, 0x00, 0x02, 0x8f,
+    0x00, 0x00, 0x02, 0xdf, 0x00, 0x00, 0x03, 0x39, 0x00, 0x00, 0x03, 0x9e, 0x00, 0x00, 0x04, 0x0f,
+    0x00, 0x09, 0x67, 0x00, 0x00, 0x40, 0x00, 0x00, 0x04, 0x8d, 0x00, 0x00, 0x05, 0x1c, 0x00, 0x00,
+    0x05, 0xbb, 0x00, 0x00, 0x06, 0x6e, 0x00, 0x00, 0x07, 0x37, 0x00, 0x00, 0x08, 0x18, 0x00, 0x00,
+    0x09, 0x15, 0x00, 0x00, 0x0a, 0x31, 0x00, 0x00, 0x0b, 0x6f, 0x00, 0x00, 0x0c, 0xd5, 0x00, 0x00,
+    0x0e, 0x65, 0x00, 0x00, 0x10, 0x27, 0x00, 0x00, 0x12, 0x20, 0x00, 0x00, 0x14, 0x56, 0x00, 0x00,
+    0x16, 0xd1, 0x00, 0x00, 0x19, 0x9a, 0x00, 0x00, 0x1c, 0xb9, 0x00, 0x00, 0x20, 0x3a, 0x00, 0x00,
+    0x24, 0x29, 0x00, 0x00, 0x28, 0x93, 0x00, 0x00, 0x2d, 0x86, 0x00, 0x00, 0x33, 0x14, 0x00, 0x00,
+    0x39, 0x50, 0x00, 0x00, 0x40, 0x4e, 0x00, 0x00, 0x48, 0x27, 0x00, 0x00, 0x50, 0xf4, 0x00, 0x00,
+    0x5a, 0xd5, 0x00, 0x00, 0x65, 0xea, 0x00, 0x00, 0x72, 0x5a, 0x00, 0x00, 0x80, 0x4e, 0x00, 0x00,
+    0x8f, 0xf6, 0x00, 0x00, 0xa1, 0x86, 0x00, 0x09, 0x67, 0x80, 0x00, 0x40, 0x00, 0x00, 0xb5, 0x3c,
+    0x00, 0x00, 0xcb, 0x59, 0x00, 0x00, 0xe4, 0x29, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x1f, 0x3d,
+    0x00, 0x01, 0x42, 0x49, 0x00, 0x01, 0x69, 0x9c, 0x00, 0x01, 0x95, 0xbc, 0x00, 0x01, 0xc7, 0x3d,
+    0x00, 0x01, 0xfe, 0xca, 0x00, 0x02, 0x3d, 0x1d, 0x00, 0x02, 0x83, 0x0b, 0x00, 0x02, 0xd1, 0x82,
+    0x00, 0x03, 0x29, 0x8b, 0x00, 0x03, 0x8c, 0x53, 0x00, 0x03, 0xfb, 0x28, 0x00, 0x04, 0x77, 0x83,
+    0x00, 0x05, 0x03, 0x0a, 0x00, 0x05, 0x9f, 0x98, 0x00, 0x06, 0x4f, 0x40, 0x00, 0x07, 0x14, 0x57,
+    0x00, 0x07, 0xf1, 0x7b, 0x00, 0x08, 0xe9, 0x9a, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0b, 0x38, 0x5e,
+    0x00, 0x0c, 0x96, 0xd9, 0x00, 0x0e, 0x20, 0x19, 0x00, 0x0f, 0xd9, 0x54, 0x00, 0x11, 0xc8, 0x65,
+    0x00, 0x13, 0xf3, 0xdf, 0x00, 0x16, 0x63, 0x20, 0x00, 0x19, 0x1e, 0x6e, 0x00, 0x09, 0x68, 0x00,
+    0x00, 0x40, 0x00, 0x1c, 0x2f, 0x0f, 0x00, 0x1f, 0x9f, 0x6e, 0x00, 0x23, 0x7b, 0x39, 0x00, 0x27,
+    0xcf, 0x8b, 0x00, 0x2c, 0xab, 0x1a, 0x00, 0x32, 0x1e, 0x65, 0x00, 0x38, 0x3b, 0xf0, 0x00, 0x3f,
+    0x18, 0x82, 0x00, 0x46, 0xcb, 0x69, 0x00, 0x4f, 0x6e, 0xce, 0x00, 0x59, 0x20, 0x06, 0x00, 0x64,
+    0x00, 0x00, 0x00, 0x70, 0x33, 0xac, 0x00, 0x7d, 0xe4, 0x7e, 0x00, 0x8d, 0x40, 0xf6, 0x00, 0x9e,
+    0x7d, 0x44, 0x00, 0xb1, 0xd3, 0xf4, 0x00, 0xc7, 0x86, 0xb7, 0x00, 0xdf, 0xdf, 0x43, 0x00, 0xfb,
+    0x30, 0x4b, 0x01, 0x19, 0xd6, 0x9a, 0x01, 0x3c, 0x3a, 0x4f, 0x01, 0x62, 0xd0, 0x3a, 0x01, 0x8e,
+    0x1b, 0x70, 0x01, 0xbe, 0xaf, 0x00, 0x01, 0xf5, 0x2f, 0xef, 0x02, 0x32, 0x57, 0x61, 0x02, 0x76,
+    0xf5, 0x15, 0x02, 0xc3, 0xf2, 0x1f, 0x03, 0x1a, 0x54, 0x07, 0x03, 0x7b, 0x40, 0x3d, 0x03, 0xe8,
+    0x00, 0x00, 0x00, 0x09, 0x68, 0x80, 0x00, 0x40, 0x00, 0x09, 0x19, 0xee, 0x00, 0x09, 0x19, 0xee,
+    0x00, 0x09, 0x19, 0xee, 0x00, 0x09, 0x19, 0xee, 0x00, 0x09, 0x19, 0xee, 0x00, 0x09, 0x19, 0xf2,
+    0x00, 0x09, 0x19, 0xfe, 0x00, 0x09, 0x1a, 0x0a, 0x00, 0x09, 0x1a, 0x16, 0x00, 0x09, 0x1a, 0x22,
+    0x00, 0x09, 0x1a, 0x2e, 0x00, 0x09, 0x1a, 0x3a, 0x00, 0x09, 0x1a, 0x46, 0x00, 0x09, 0x1a, 0x52,
+    0x00, 0x09, 0x1a, 0x5e, 0x00, 0x09, 0x1a, 0x6a, 0x00, 0x09, 0x1a, 0x76, 0x00, 0x09, 0x19, 0xee,
+    0x00, 0x09, 0x19, 0xee, 0x00, 0x09, 0x19, 0xee, 0x00, 0x09, 0x19, 0xee, 0x00, 0x09, 0x19, 0xee,
+    0x00, 0x09, 0x19, 0xee, 0x00, 0x09, 0x1a, 0x82, 0x00, 0x09, 0x1a, 0x8e, 0x00, 0x09, 0x19, 0xee,
+    0x00, 0x09, 0x19, 0xee, 0x00, 0x09, 0x19, 0xee, 0x00, 0x09, 0x19, 0xee, 0x00, 0x09, 0x19, 0xee,
+    0x00, 0x09, 0x19, 0xee, 0x00, 0x09, 0x19, 0xee, 0x00, 0x09, 0x69, 0x00, 0x00, 0x38, 0x00, 0x09,
+    0x19, 0xee, 0x00, 0x09, 0x1a, 0x9a, 0x00, 0x09, 0x1a, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0a, 0x55, 0xf6, 0x00, 0x08, 0x70, 0x6b, 0x00, 0x05, 0xf7, 0xa5, 0x00, 0x03,
+    0x16, 0xc5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x55, 0xf6, 0x00, 0x0b, 0x87, 0x2f, 0x00, 0x0b,
+    0xef, 0x4b, 0x00, 0x0b, 0x87, 0x2f, 0x00, 0x0a, 0x55, 0xf6, 0x00, 0x2a, 0xaa, 0xaa, 0xff, 0xff,
+    0x49, 0xf5, 0x00, 0x00, 0x04, 0x55, 0xff, 0xff, 0xff, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xaa, 0xaa, 0xff, 0xff, 0x49, 0xf5, 0x00, 0x00,
+    0x04, 0x55, 0xff, 0xff, 0xff, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x53, 0x00, 0x08,
+    0x01, 0x28, 0x00, 0x40, 0xfd, 0xc6, 0x00, 0x00, 0x00, 0x08, 0x40, 0x40, 0x91, 0x3d, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x29, 0x70,
+    0x00, 0x08, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x01, 0xa8, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x00, 0x77, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00,
 };
-const unsigned long programBaseAddress = 0x00080200;
-const unsigned long executionAddress = 0x00084040;
-const unsigned char haveProgramBaseAddress = 1;
-const unsigned short firmwareStreamLen = 2453;
+const unsigned long zl38063_fw_image_len = sizeof(zl38063_fw_image);
@@ -1,10 +1,8 @@
 #ifndef __ZL380xx_FIRMWARE_H__
 #define __ZL380xx_FIRMWARE_H__
 
-extern const twFwr st_twFirmware[];
-extern const unsigned short firmwareStreamLen;
-extern const unsigned long programBaseAddress;
-extern const unsigned long executionAddress;
-extern const unsigned char haveProgramBaseAddress;
+/*Binary block image made by audio_demo/tools/zl38063_fw2img, see VprocTwolfHbiBoot_alt()*/
+extern const unsigned char zl38063_fw_image[];
+extern const unsigned long zl38063_fw_image_len;
 
 #endif
@@ -33,7 +33,17 @@
 #include "MediaHal.h"
 #include "driver/i2s.h"
 #include "lock.h"
+#include "param.h"
 #include "InterruptionSal.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#ifdef CONFIG_IDF_TARGET_ESP32S2
+#include "esp32s2/rom/ets_sys.h"
+#endif
+#ifdef CONFIG_IDF_TARGET_ESP32
+#include "esp32/rom/ets_sys.h"
+#endif
 
 #define HAL_TAG "MEDIA_HAL"
 
@@ -44,6 +54,9 @@
     }
 
 #define I2S_OUT_VOL_DEFAULT     60
+#define MEDIA_HAL_LOW_LATENCY_BUF_COUNT 2   // the fewest DMA buffers the driver takes
+#define MEDIA_HAL_CODEC_DELAY_MS        1   // ADC and DAC filters of the codec
+#define MEDIA_HAL_PA_SETTLE_US          2000 // codec outputs back on their bias before the PA hears them
 #define SUPPOERTED_BITS 16
 #define I2S1_ENABLE     0   // Enable i2s1
 #define I2S_DAC_EN      0  //if enabled then a speaker can be connected to i2s output gpio(GPIO25 and GND or GPIO26 and GND), using DAC(8bits) to play music
@@ -52,6 +65,10 @@
 static int I2S_NUM = I2S_NUM_0;//only support 16 now and i2s0 or i2s1
 static char MUSIC_BITS = 16; //for re-bits feature, but only for 16 to 32
 static int AMPLIFIER = 1 << 8;//amplify the volume, fixed point
+static int I2S_CORE = -1;//core of the i2s interrupt, -1: the core calling MediaHalInit
+static int DMA_FIXED = 0;//the DMA buffers were sized by MediaHalSetLatency, the parameters do not apply
+static int STANDBY = 0;//in MediaHalStandby
+static int STANDBY_MUTED = 0;//soft muted already when the standby began, stays so on resume
 
 i2s_config_t i2s_config = {
 #if I2S_DAC_EN == 1
@@ -77,6 +94,7 @@ i2s_config_t i2s_config = {
     .dma_buf_count = 3,                            /*!< amount of the dam buffer sectors*/
     .dma_buf_len = 300,                            /*!< dam buffer size of each sector (word, i.e. 4 Bytes) */
     .intr_alloc_flags = I2S_INTER_FLAG,
+    .tx_desc_auto_clear = true,                    /*!< an underrun plays silence, not the last buffer again */
 #if I2S_DAC_EN == 0
     .use_apll = 1,
 #endif
@@ -118,6 +136,8 @@ struct media_hal {
     int (*codec_get_vol)(int *volume);
     int (*codec_set_mute)(int en);
     int (*codec_get_mute)(int *mute);
+    int (*codec_set_rate)(uint32_t rate);   // NULL: the codec follows MCLK and LRCK by itself
+    int (*codec_standby)(int en);           // NULL: the standby only switches the PA
 };
 
 
@@ -136,6 +156,7 @@ struct media_hal MediaHalConfig = {
     .codec_get_vol = Es8388GetVoiceVolume,
     .codec_set_mute = Es8388SetVoiceMute,
     .codec_get_mute = Es8388GetVoiceMute,
+    .codec_standby = Es8388Standby,
 #elif defined CONFIG_CODEC_CHIP_IS_ES8374
     .codec_init = Es8374Init,
     .codec_uninit = Es8374Uninit,
@@ -185,9 +206,82 @@ struct media_hal MediaHalConfig = {
     .codec_get_vol = Es8311GetVoiceVolume,
     .codec_set_mute = Es8311SetVoiceMute,
     .codec_get_mute = Es8311GetVoiceMute,
+    .codec_set_rate = Es8311SetSampleRate,
+    .codec_standby = Es8311Standby,
 #endif
 };
 
+/*
+ * Read -> process -> write round trip through the DMA: a read waits for one buffer to fill and a write
+ * queues behind dma_buf_count buffers, so it is (dma_buf_count + 1) * dma_buf_len frames plus the codec
+ */
+int MediaHalSetLatency(int target_ms, int core)
+{
+    if (MediaHalConfig.sMediaHalState == MEDIA_HAL_STATE_INIT) {
+        ESP_LOGE(HAL_TAG, "Set the latency before MediaHalInit");
+        return -1;
+    }
+    if (target_ms <= 0 || core >= portNUM_PROCESSORS) {
+        ESP_LOGE(HAL_TAG, "Latency %d ms or core %d is invalid", target_ms, core);
+        return -1;
+    }
+    int len = (target_ms - MEDIA_HAL_CODEC_DELAY_MS) * (int)i2s_config.sample_rate / 1000 / (MEDIA_HAL_LOW_LATENCY_BUF_COUNT + 1);
+    if (len < 8) {
+        len = 8;
+    } else if (len > 1024) {
+        len = 1024;
+    }
+    i2s_config.dma_buf_count = MEDIA_HAL_LOW_LATENCY_BUF_COUNT;
+    i2s_config.dma_buf_len = len;
+    I2S_CORE = core;
+    DMA_FIXED = 1;
+    ESP_LOGI(HAL_TAG, "DMA %d x %d frames, %d us round trip, i2s interrupt on core %d", i2s_config.dma_buf_count,
+             i2s_config.dma_buf_len, MediaHalGetDmaLatencyUs(), core);
+    return 0;
+}
+
+int MediaHalGetDmaLatencyUs(void)
+{
+    return (int)((int64_t)(i2s_config.dma_buf_count + 1) * i2s_config.dma_buf_len * 1000000 / i2s_config.sample_rate);
+}
+
+typedef struct {
+    int i2s_num;
+    int ret;
+    xSemaphoreHandle done;
+} I2sInstallArg;
+
+static void I2sInstallTask(void *pv)
+{
+    I2sInstallArg *arg = (I2sInstallArg *)pv;
+    arg->ret = i2s_driver_install(arg->i2s_num, &i2s_config, 0, NULL);
+    xSemaphoreGive(arg->done);
+    vTaskDelete(NULL);
+}
+
+// the interrupt is allocated on the core that installs the driver
+static int I2sInstall(int i2s_num)
+{
+    if (I2S_CORE < 0 || I2S_CORE == xPortGetCoreID()) {
+        return i2s_driver_install(i2s_num, &i2s_config, 0, NULL);
+    }
+    I2sInstallArg arg = {
+        .i2s_num = i2s_num,
+        .ret = -1,
+        .done = xSemaphoreCreateBinary(),
+    };
+    if (arg.done == NULL) {
+        return -1;
+    }
+    if (pdPASS != xTaskCreatePinnedToCore(I2sInstallTask, "i2s_install", 2048, &arg, uxTaskPriorityGet(NULL), NULL, I2S_CORE)) {
+        vSemaphoreDelete(arg.done);
+        return -1;
+    }
+    xSemaphoreTake(arg.done, portMAX_DELAY);
+    vSemaphoreDelete(arg.done);
+    return arg.ret;
+}
+
 int MediaHalInit(void *config)
 {
     int ret  = 0;
@@ -196,13 +290,17 @@ int MediaHalInit(void *config)
         ESP_LOGE(HAL_TAG, "Must set I2S_NUM as 0 or 1");
         return -1;
     }
-    ret = i2s_driver_install(I2S_NUM, &i2s_config, 0, NULL);
+    if (!DMA_FIXED) {
+        i2s_config.dma_buf_count = param_int("i2s.dma_count", i2s_config.dma_buf_count, MEDIA_HAL_LOW_LATENCY_BUF_COUNT, 16, "I2S DMA buffers per direction");
+        i2s_config.dma_buf_len = param_int("i2s.dma_len", i2s_config.dma_buf_len, 8, 1024, "I2S DMA buffer frames");
+    }
+    ret = I2sInstall(I2S_NUM);
     if (ret < 0) {
         ESP_LOGE(HAL_TAG, "I2S_NUM_0 install failed");
         return -1;
     }
 #if I2S1_ENABLE
-    ret = i2s_driver_install(I2S_NUM_1, &i2s_config, 0, NULL);
+    ret = I2sInstall(I2S_NUM_1);
     if (ret < 0) {
         ESP_LOGE(HAL_TAG, "I2S_NUM_1 install failed");
         return -1;
@@ -277,6 +375,7 @@ int MediaHalUninit(void)
 #endif
     MediaHalConfig._halLock = NULL;
     MUSIC_BITS = 0;
+    STANDBY = 0;
     MediaHalConfig._currentMode = CODEC_MODE_UNKNOWN;
     MediaHalConfig.sMediaHalState = MEDIA_HAL_STATE_UNKNOWN;
     return 0;
@@ -424,6 +523,7 @@ void MediaHalSetVolumeAmplify(float scale)
     mutex_lock(MediaHalConfig._halLock);
     AMPLIFIER = scale * (1 << 8);
     mutex_unlock(MediaHalConfig._halLock);
+    MediaHalGainRefresh(0);
 }
 
 int MediaHalGetVolumeAmplify()
@@ -490,8 +590,66 @@ int MediaHalSetClk(int i2s_num, uint32_t rate, uint8_t bits, uint32_t ch)
     }
 
     MUSIC_BITS = bits;
-    ret = i2s_set_clk((i2s_port_t)i2s_num, rate, SUPPOERTED_BITS, ch);
+    ret = i2s_set_clk((i2s_port_t)i2s_num, rate, i2s_config.bits_per_sample, ch);
+    if (ret == 0 && i2s_num == I2S_NUM) {
+        i2s_config.sample_rate = rate;
+#if I2S_DAC_EN == 0
+        if (MediaHalConfig.codec_set_rate) {
+            mutex_lock(MediaHalConfig._halLock);
+            ret = MediaHalConfig.codec_set_rate(rate);
+            mutex_unlock(MediaHalConfig._halLock);
+        }
+#endif
+    }
+
+    return ret;
+}
+
+/*
+ * i2s_set_clk keeps the driver and its DMA buffers when only the rate changes, it stops the port for the
+ * time it takes to retune the APLL. Whatever sits in the DMA then plays at the new rate, so the output is
+ * faded out first and the switch waits until the faded blocks have drained and only silence is queued.
+ */
+int MediaHalSetRate(uint32_t rate, int fade_ms)
+{
+    if (MediaHalConfig.sMediaHalState != MEDIA_HAL_STATE_INIT) {
+        ESP_LOGE(HAL_TAG, "Set the rate after MediaHalInit");
+        return -1;
+    }
+    if (rate == i2s_config.sample_rate) {
+        return 0;
+    }
+    int muted = MediaHalGetSoftMute();
+    if (!muted) {
+        MediaHalSetSoftMute(1, fade_ms);
+        vTaskDelay((fade_ms * 1000 + MediaHalGetDmaLatencyUs()) / 1000 / portTICK_PERIOD_MS + 1);
+    }
+    int ch = i2s_config.channel_format < I2S_CHANNEL_FMT_ONLY_RIGHT ? I2S_CHANNEL_STEREO : I2S_CHANNEL_MONO;
+    int ret = MediaHalSetClk(I2S_NUM, rate, MUSIC_BITS, ch);
+    if (ret != 0) {
+        ESP_LOGE(HAL_TAG, "Sample rate %d error", rate);
+    }
+    if (!muted) {
+        MediaHalSetSoftMute(0, fade_ms);
+    }
+    return ret;
+}
 
+/*
+ * The codec is a slave and takes the upper 16 bits of each 32 bit slot, so only the capture side
+ * changes: a 32 bit slot carries two 16 bit TDM slots of the ADC
+ */
+int MediaHalSetSlotBits(int bits)
+{
+    if (bits != 16 && bits != 32) {
+        ESP_LOGE(HAL_TAG, "slot should be 16 or 32 bits, %d", bits);
+        return -1;
+    }
+    int ret = i2s_set_clk((i2s_port_t)I2S_NUM, i2s_config.sample_rate, bits, I2S_CHANNEL_STEREO);
+    if (ret == 0) {
+        i2s_config.bits_per_sample = bits;
+        i2s_config.channel_format = I2S_CHANNEL_FMT_RIGHT_LEFT;
+    }
     return ret;
 }
 
@@ -513,7 +671,7 @@ int MediaHalGetI2sNum(void)
 
 int MediaHalGetI2sBits(void)
 {
-    return SUPPOERTED_BITS;
+    return i2s_config.bits_per_sample;
 }
 
 int MediaHalGetSrcBits(void)
@@ -541,6 +699,64 @@ int MediaHalPaPwr(int en)
     return 0;
 }
 
+/*
+ * A full MediaHalStop/MediaHalStart cycle reprograms the codec and pops. The standby leaves the codec
+ * configured and biased instead: the output fades out through MediaHalApplyGain, the PA goes off once only
+ * silence is in the DMA, and the codec powers down its converters and clocks. Resuming brings the codec up
+ * first and the PA only after the outputs have settled, then fades back in, so the next sound can be
+ * written right away and the PA never sees a step.
+ */
+int MediaHalStandby(int standby, int ramp_ms)
+{
+    int ret = 0;
+    if (MediaHalConfig.sMediaHalState != MEDIA_HAL_STATE_INIT) {
+        ESP_LOGE(HAL_TAG, "Standby after MediaHalInit");
+        return -1;
+    }
+    standby = standby ? 1 : 0;
+    if (standby == STANDBY) {
+        return 0;
+    }
+    if (standby) {
+        STANDBY_MUTED = MediaHalGetSoftMute();
+        if (!STANDBY_MUTED) {
+            MediaHalSetSoftMute(1, ramp_ms);
+            vTaskDelay((ramp_ms * 1000 + MediaHalGetDmaLatencyUs()) / 1000 / portTICK_PERIOD_MS + 1);
+        }
+        MediaHalPaPwr(0);
+#if I2S_DAC_EN == 0
+        if (MediaHalConfig.codec_standby) {
+            mutex_lock(MediaHalConfig._halLock);
+            ret = MediaHalConfig.codec_standby(1);
+            mutex_unlock(MediaHalConfig._halLock);
+        }
+#endif
+    } else {
+#if I2S_DAC_EN == 0
+        if (MediaHalConfig.codec_standby) {
+            mutex_lock(MediaHalConfig._halLock);
+            ret = MediaHalConfig.codec_standby(0);
+            mutex_unlock(MediaHalConfig._halLock);
+            ets_delay_us(MEDIA_HAL_PA_SETTLE_US);
+        }
+#endif
+        MediaHalPaPwr(1);
+        if (!STANDBY_MUTED) {
+            MediaHalSetSoftMute(0, ramp_ms);
+        }
+    }
+    if (ret != 0) {
+        ESP_LOGE(HAL_TAG, "Codec standby %d failed", standby);
+    }
+    STANDBY = standby;
+    return ret;
+}
+
+int MediaHalGetStandby(void)
+{
+    return STANDBY;
+}
+
 int MediaHalGetState(MediaHalState *state)
 {
     if (state) {
@@ -25,6 +25,8 @@
 #ifndef _MEDIA_HAL_H_
 #define _MEDIA_HAL_H_
 
+#include <stdint.h>
+
 typedef enum CodecMode {
     CODEC_MODE_UNKNOWN,
     CODEC_MODE_ENCODE ,
@@ -55,6 +57,36 @@ typedef enum MediaHalState {
  */
 int MediaHalInit(void* config);
 
+/**
+ * @brief Low latency profile, call it before MediaHalInit.
+ *        The DMA buffers are sized so that a read -> process -> write loop stays under target_ms
+ *        and the i2s interrupt is allocated on core.
+ *
+ * @param  target_ms : mic to speaker latency to stay under
+ * @param  core : core of the i2s interrupt, -1 for the core calling MediaHalInit
+ *
+ * @return  int, 0--success, others--fail
+ */
+int MediaHalSetLatency(int target_ms, int core);
+
+/**
+ * @brief Round trip latency of the DMA buffers alone, in us.
+ *
+ * @return  int, latency in us
+ */
+int MediaHalGetDmaLatencyUs(void);
+
+/**
+ * @brief Measure the round trip latency: play a chirp, record it back and correlate.
+ *        It needs the speaker coupled to the mic (or a line loopback) and takes about half a second,
+ *        the I2S port of MediaHal is used in a read -> write loop of one DMA buffer per step.
+ *
+ * @param  round_trip_us : measured latency of the read -> write loop, in us
+ *
+ * @return  int, 0--success, -1--no chirp found in the recording or no memory
+ */
+int MediaHalMeasureLatency(int *round_trip_us);
+
 /**
  * @brief Uninitialize media codec driver.
  *
@@ -111,7 +143,7 @@ int MediaHalGetVolume(int *volume);
 
 /**
  * @brief Set the volume amplifier. This function is called when external ADC can not change volume or
- *          when users want to amplify the max volume.
+ *          when users want to amplify the max volume. It scales the gain of MediaHalApplyGain, up to 2.
  *
  * @param  scale: scale the voice volume, such as 0.5, or 1.3
  */
@@ -131,6 +163,59 @@ int MediaHalGetVolumeAmplify();
  */
 int MediaHalGetAmplifyType();
 
+/**
+ * @brief Volume through the digital gain stage: the codec is written over I2C only when the volume crosses
+ *          a step of 10, the fine part is a Q15 gain that MediaHalApplyGain ramps linearly, so a moving
+ *          slider gives neither zipper noise nor a stream of I2C writes. With a software amplifier
+ *          (MediaHalGetAmplifyType() == 1) the whole range is digital, at 0.5 dB a step.
+ *
+ * @param  volume: 0~100, below 3 is muted
+ * @param  ramp_ms: time to reach the new gain, e.g. 20
+ *
+ * @return     int, 0--success, others--the codec write failed
+ */
+int MediaHalSetVolumeSmooth(int volume, int ramp_ms);
+
+/**
+ * @brief The last MediaHalSetVolumeSmooth volume, -1 before the first call.
+ */
+int MediaHalGetVolumeSmooth(void);
+
+/**
+ * @brief Fade the output to silence, or back to the volume, without touching the codec.
+ *
+ * @param  mute: 1--fade out; 0--fade in
+ * @param  ramp_ms: length of the fade
+ */
+void MediaHalSetSoftMute(int mute, int ramp_ms);
+
+/**
+ * @brief Soft mute state.
+ *
+ * @return  int, 1--faded out by MediaHalSetSoftMute; 0--not
+ */
+int MediaHalGetSoftMute(void);
+
+/**
+ * @brief Recompute the gain after MediaHalSetVolumeAmplify.
+ */
+void MediaHalGainRefresh(int ramp_ms);
+
+/**
+ * @brief Apply the gain to interleaved 16-bit PCM in place, call it on every block before i2s_write.
+ *          Unity gain returns at once, a ramp is spread linearly over the block.
+ *
+ * @param  pcm: samples
+ * @param  frames: samples per channel
+ * @param  channels: 1 or 2
+ */
+void MediaHalApplyGain(int16_t *pcm, int frames, int channels);
+
+/**
+ * @brief The gain applied to the last block, Q15.
+ */
+int32_t MediaHalGetGainQ15(void);
+
 /**
  * @brief Set codec driver mute status.
  *
@@ -173,6 +258,34 @@ int MediaHalSetBits(int bitPerSample);
  */
 int MediaHalSetClk(int i2s_num, uint32_t rate, uint8_t bits, uint32_t ch);
 
+/**
+ * @brief Switch the sample rate while playing, without reinstalling the I2S driver.
+ *        The output fades out over fade_ms, the rate changes once the DMA holds only silence
+ *        (the APLL gives the 44.1k family exactly), the codec clocks are rewritten in one I2C
+ *        transaction and the output fades back in. Blocks for fade_ms plus the DMA latency.
+ *        The fades need MediaHalApplyGain on the written blocks; it stays muted when it was.
+ *
+ * @param rate new I2S sample rate (ex: 16000, 44100, 48000)
+ * @param fade_ms length of each fade
+ *
+ * @return
+ *     - 0   Success
+ *     - -1  Error
+ */
+int MediaHalSetRate(uint32_t rate, int fade_ms);
+
+/**
+ * @brief Set the slot width of the I2S port, stereo. Playback written afterwards goes in slots
+ *        of this width, the codec plays the upper 16 bits of each.
+ *
+ * @param bits 16 or 32
+ *
+ * @return
+ *     - 0   Success
+ *     - -1  Error
+ */
+int MediaHalSetSlotBits(int bits);
+
 /**
  * @brief Get i2s configuration.
  *
@@ -243,6 +356,28 @@ int MediaHalGetI2sAdcMode(void);
  */
 int MediaHalPaPwr(int en);
 
+/**
+ * @brief Low-power standby between sounds, instead of MediaHalStop/MediaHalStart which are slow and pop.
+ *        Entering fades the output out over ramp_ms (the blocks need MediaHalApplyGain), switches the PA
+ *        off once the DMA holds silence and puts the codec into standby with its references biased and its
+ *        registers kept; it blocks for ramp_ms plus the DMA latency. Leaving restores the codec in one I2C
+ *        transaction, switches the PA on after the outputs settle (about 2 ms) and fades back in, so the next
+ *        block can be written at once. The soft mute state is kept across.
+ *
+ * @param  standby: 1--enter; 0--leave
+ * @param  ramp_ms: length of the fades
+ *
+ * @return     int, 0-- success, -1 --fail, the PA follows standby either way
+ */
+int MediaHalStandby(int standby, int ramp_ms);
+
+/**
+ * @brief Standby state.
+ *
+ * @return  int, 1--in MediaHalStandby; 0--not
+ */
+int MediaHalGetStandby(void);
+
 /**
  * @brief Get MediaHal state.
  *
@@ -252,6 +387,30 @@ int MediaHalPaPwr(int en);
  */
 int MediaHalGetState(MediaHalState *state);
 
+/**
+ * @brief Capture a 2 or 4 mic array from an ES7210 on the data input of the MediaHal I2S port.
+ *        With 4 mics the ADC sends 16 bit TDM slots and the port runs 32 bit stereo, see MediaHalSetSlotBits.
+ *        Call it after MediaHalInit; the ES7210 takes MCLK from the same pin as the codec.
+ *
+ * @param  mics : 2 or 4
+ * @param  frames : frames of a MediaHalTdmRead, even
+ *
+ * @return  int, 0--success, -1--fail
+ */
+int MediaHalTdmInit(int mics, int frames);
+
+/**
+ * @brief Read one block of frames and split it into one plane per mic: mic n at planes + n * frames.
+ *        planes must be 4 byte aligned, mics * frames samples.
+ *
+ * @param  timeout_ms : wait for the DMA at most this long
+ *
+ * @return  int, frames read, -1--fail
+ */
+int MediaHalTdmRead(int16_t *planes, int timeout_ms);
+
+void MediaHalTdmUninit(void);
+
 void codec_init(void);
 
 #endif  //__MEDIA_HAL_H__
@@ -0,0 +1,212 @@
+/*
+ * ESPRESSIF MIT License
+ *
+ * Copyright (c) 2018 <ESPRESSIF SYSTEMS (SHANGHAI) PTE LTD>
+ *
+ * Permission is hereby granted for use on all ESPRESSIF SYSTEMS products, in which case,
+ * it is free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include <stdint.h>
+#include <math.h>
+#include <string.h>
+#include "driver/i2s.h"
+#include "freertos/FreeRTOS.h"
+#include "MediaHal.h"
+
+#define GAIN_UNITY          (1 << 15)
+#define GAIN_MAX            (2 * GAIN_UNITY - 1)    // +6 dB, a sample times it still fits 32 bits
+#define VOL_DB_PER_STEP     0.5f        // volume steps to dB, close to the DAC volume of the codecs
+#define VOL_COARSE_STEP     10          // the codec changes every this many steps, the rest is digital
+#define VOL_MUTE_BELOW      3           // as MediaHalSetVolume
+
+/*
+ * The gain moves linearly from gain to target over ramp_left samples. The setters only leave a new
+ * target and ramp behind, MediaHalApplyGain picks them up at the start of its next block.
+ */
+static struct {
+    int32_t gain;           // Q15
+    int32_t target;
+    int ramp_left;          // frames
+    int32_t volume_gain;    // the target without soft mute
+    int ramp_req;           // frames; -1 nothing new
+    int muted;
+    int volume;             // -1 until MediaHalSetVolumeSmooth is called, the stage is unity then
+    int codec_volume;       // last written over I2C
+} s_gain = {
+    .gain = GAIN_UNITY,
+    .target = GAIN_UNITY,
+    .volume_gain = GAIN_UNITY,
+    .ramp_req = -1,
+    .volume = -1,
+    .codec_volume = -1,
+};
+static portMUX_TYPE s_gain_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static int media_hal_ms_to_frames(int ms)
+{
+    i2s_config_t cfg;
+    MediaHalGetI2sConfig(MediaHalGetI2sNum(), &cfg);
+    return (int)((int64_t)cfg.sample_rate * ms / 1000);
+}
+
+static int32_t media_hal_db_to_q15(float db)
+{
+    float g = powf(10.0f, db / 20.0f) * GAIN_UNITY * MediaHalGetVolumeAmplify() / (1 << 8);
+    return g > GAIN_MAX ? GAIN_MAX : (int32_t)(g + 0.5f);
+}
+
+static void media_hal_gain_post(int ramp_ms)
+{
+    int frames = media_hal_ms_to_frames(ramp_ms);
+    portENTER_CRITICAL(&s_gain_lock);
+    s_gain.target = s_gain.muted ? 0 : s_gain.volume_gain;
+    s_gain.ramp_req = frames;
+    portEXIT_CRITICAL(&s_gain_lock);
+}
+
+int MediaHalSetVolumeSmooth(int volume, int ramp_ms)
+{
+    int ret = 0;
+    if (volume < 0) {
+        volume = 0;
+    } else if (volume > 100) {
+        volume = 100;
+    }
+
+    int codec_volume = 100;
+    float db = (volume - 100) * VOL_DB_PER_STEP;
+    if (MediaHalGetAmplifyType() == 0) {
+        // the codec takes the coarse steps, from above so the digital part only ever cuts
+        codec_volume = (volume + VOL_COARSE_STEP - 1) / VOL_COARSE_STEP * VOL_COARSE_STEP;
+        db = (volume - codec_volume) * VOL_DB_PER_STEP;
+    }
+    int32_t volume_gain = volume < VOL_MUTE_BELOW ? 0 : media_hal_db_to_q15(db);
+
+    // up a coarse step the digital cut lands first and the codec follows, down one the codec goes first,
+    // so the step dips for the time of the I2C write instead of overshooting
+    int up = codec_volume > s_gain.codec_volume;
+    if (!up && codec_volume != s_gain.codec_volume) {
+        ret = MediaHalSetVolume(codec_volume);
+        s_gain.codec_volume = codec_volume;
+    }
+    s_gain.volume_gain = volume_gain;
+    s_gain.volume = volume;
+    media_hal_gain_post(ramp_ms);
+    if (up) {
+        ret = MediaHalSetVolume(codec_volume);
+        s_gain.codec_volume = codec_volume;
+    }
+    return ret;
+}
+
+int MediaHalGetVolumeSmooth(void)
+{
+    return s_gain.volume;
+}
+
+void MediaHalSetSoftMute(int mute, int ramp_ms)
+{
+    s_gain.muted = mute;
+    media_hal_gain_post(ramp_ms);
+}
+
+int MediaHalGetSoftMute(void)
+{
+    return s_gain.muted;
+}
+
+void MediaHalGainRefresh(int ramp_ms)
+{
+    if (s_gain.volume >= 0) {
+        MediaHalSetVolumeSmooth(s_gain.volume, ramp_ms);
+    } else {
+        s_gain.volume_gain = media_hal_db_to_q15(0);
+        media_hal_gain_post(ramp_ms);
+    }
+}
+
+static inline int16_t media_hal_sat16(int32_t v)
+{
+    return v > INT16_MAX ? INT16_MAX : (v < INT16_MIN ? INT16_MIN : v);
+}
+
+// four samples a turn, the compiler keeps the gain in a register and pipelines the multiplies
+static void media_hal_gain_const(int16_t *pcm, int n, int32_t g)
+{
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        int32_t a = (pcm[i] * g) >> 15;
+        int32_t b = (pcm[i + 1] * g) >> 15;
+        int32_t c = (pcm[i + 2] * g) >> 15;
+        int32_t d = (pcm[i + 3] * g) >> 15;
+        pcm[i] = media_hal_sat16(a);
+        pcm[i + 1] = media_hal_sat16(b);
+        pcm[i + 2] = media_hal_sat16(c);
+        pcm[i + 3] = media_hal_sat16(d);
+    }
+    for (; i < n; i++) {
+        pcm[i] = media_hal_sat16((pcm[i] * g) >> 15);
+    }
+}
+
+void MediaHalApplyGain(int16_t *pcm, int frames, int channels)
+{
+    portENTER_CRITICAL(&s_gain_lock);
+    if (s_gain.ramp_req >= 0) {
+        s_gain.ramp_left = s_gain.ramp_req;
+        s_gain.ramp_req = -1;
+    }
+    int32_t target = s_gain.target;
+    portEXIT_CRITICAL(&s_gain_lock);
+
+    int32_t gain = s_gain.gain;
+    if (gain != target && s_gain.ramp_left > 0) {
+        // the ramp over this block, or the part of it that is left; gain in Q15 << 8 as it moves
+        int n = frames < s_gain.ramp_left ? frames : s_gain.ramp_left;
+        int32_t end = gain + (int32_t)((int64_t)(target - gain) * n / s_gain.ramp_left);
+        int32_t g = gain << 8;
+        int32_t step = ((end - gain) << 8) / n;
+        for (int f = 0; f < n; f++, g += step) {
+            int32_t q = g >> 8;
+            for (int c = 0; c < channels; c++, pcm++) {
+                *pcm = media_hal_sat16((*pcm * q) >> 15);
+            }
+        }
+        s_gain.ramp_left -= n;
+        s_gain.gain = s_gain.ramp_left ? end : target;
+        frames -= n;
+        gain = s_gain.gain;
+    } else {
+        s_gain.gain = gain = target;
+    }
+    if (frames == 0 || gain == GAIN_UNITY) {
+        return;
+    }
+    if (gain == 0) {
+        memset(pcm, 0, frames * channels * sizeof(int16_t));
+        return;
+    }
+    media_hal_gain_const(pcm, frames * channels, gain);
+}
+
+int32_t MediaHalGetGainQ15(void)
+{
+    return s_gain.gain;
+}
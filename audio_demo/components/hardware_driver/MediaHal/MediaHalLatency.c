@@ -0,0 +1,146 @@
+/*
+ * ESPRESSIF MIT License
+ *
+ * Copyright (c) 2018 <ESPRESSIF SYSTEMS (SHANGHAI) PTE LTD>
+ *
+ * Permission is hereby granted for use on all ESPRESSIF SYSTEMS products, in which case,
+ * it is free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "driver/i2s.h"
+#include "MediaHal.h"
+#include "EspAudioAlloc.h"
+
+#define LATENCY_TAG "MEDIA_HAL_LATENCY"
+
+#define CHIRP_MS        20
+#define CHIRP_LEAD_MS   100     // silence before the chirp, the codec and the PA settle
+#define RECORD_MS       500
+#define CHIRP_F0        500.0f
+#define CHIRP_F1        4000.0f
+#define CHIRP_AMPLITUDE 16000.0f
+#define MIN_CORRELATION 0.3f    // normalized peak, below it the chirp was not heard
+
+/*
+ * Reads and writes take turns one DMA buffer at a time, so frame p played and frame r recorded are in lock step
+ * and the offset of the chirp in the recording is the read -> write round trip of the loop, codec included
+ */
+int MediaHalMeasureLatency(int *round_trip_us)
+{
+    i2s_config_t cfg;
+    int ret = -1;
+    if (round_trip_us == NULL) {
+        return -1;
+    }
+    int i2s_num = MediaHalGetI2sNum();
+    MediaHalGetI2sConfig(i2s_num, &cfg);
+
+    int rate = cfg.sample_rate;
+    int ch = (cfg.channel_format == I2S_CHANNEL_FMT_RIGHT_LEFT) ? 2 : 1;
+    int block = cfg.dma_buf_len;
+    int chirp_len = rate * CHIRP_MS / 1000;
+    int lead = rate * CHIRP_LEAD_MS / 1000;
+    int rec_len = rate * RECORD_MS / 1000;
+
+    // every sample is written before it is read, none of them needs zeroing
+    int16_t *chirp = EspAudioMalloc(chirp_len * sizeof(int16_t), 0, 0);
+    int16_t *rec = EspAudioMalloc((rec_len + block) * sizeof(int16_t), 0, 0);
+    int16_t *io = EspAudioMalloc(block * ch * sizeof(int16_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT, 0);
+    if (chirp == NULL || rec == NULL || io == NULL) {
+        ESP_LOGE(LATENCY_TAG, "no memory for the chirp and the recording");
+        goto out;
+    }
+
+    // linear chirp, Hann window so its correlation has one clear peak
+    float chirp_energy = 0;
+    for (int k = 0; k < chirp_len; k++) {
+        float t = (float)k / rate;
+        float T = (float)chirp_len / rate;
+        float phase = 2 * (float)M_PI * (CHIRP_F0 * t + (CHIRP_F1 - CHIRP_F0) * t * t / (2 * T));
+        float w = 0.5f - 0.5f * cosf(2 * (float)M_PI * k / (chirp_len - 1));
+        chirp[k] = (int16_t)(CHIRP_AMPLITUDE * w * sinf(phase));
+        chirp_energy += (float)chirp[k] * chirp[k];
+    }
+
+    i2s_zero_dma_buffer(i2s_num);
+    int played = 0;
+    int recorded = 0;
+    while (recorded < rec_len) {
+        size_t bytes = 0;
+        i2s_read(i2s_num, io, block * ch * sizeof(int16_t), &bytes, portMAX_DELAY);
+        int frames = bytes / (ch * sizeof(int16_t));
+        for (int i = 0; i < frames; i++) {
+            rec[recorded + i] = io[i * ch];
+        }
+        recorded += frames;
+
+        for (int i = 0; i < block; i++) {
+            int k = played + i - lead;
+            int16_t v = (k >= 0 && k < chirp_len) ? chirp[k] : 0;
+            for (int c = 0; c < ch; c++) {
+                io[i * ch + c] = v;
+            }
+        }
+        i2s_write(i2s_num, io, block * ch * sizeof(int16_t), &bytes, portMAX_DELAY);
+        played += block;
+    }
+    i2s_zero_dma_buffer(i2s_num);
+
+    // normalized cross correlation over the lags after the chirp was written
+    float best = 0;
+    int best_lag = -1;
+    float win_energy = 0;
+    for (int k = 0; k < chirp_len; k++) {
+        win_energy += (float)rec[lead + k] * rec[lead + k];
+    }
+    for (int d = 0; lead + d + chirp_len <= rec_len; d++) {
+        int64_t acc = 0;
+        const int16_t *r = rec + lead + d;
+        for (int k = 0; k < chirp_len; k++) {
+            acc += (int32_t)r[k] * chirp[k];
+        }
+        if (win_energy > 0) {
+            float rho = fabsf((float)acc) / sqrtf(win_energy * chirp_energy);
+            if (rho > best) {
+                best = rho;
+                best_lag = d;
+            }
+        }
+        win_energy += (float)r[chirp_len] * r[chirp_len] - (float)r[0] * r[0];
+    }
+
+    if (best_lag < 0 || best < MIN_CORRELATION) {
+        ESP_LOGE(LATENCY_TAG, "chirp not found in the recording, peak %.2f", best);
+        goto out;
+    }
+    *round_trip_us = (int)((int64_t)best_lag * 1000000 / rate);
+    ESP_LOGI(LATENCY_TAG, "round trip %d us (%d frames, peak %.2f), DMA part %d us",
+             *round_trip_us, best_lag, best, MediaHalGetDmaLatencyUs());
+    ret = 0;
+
+out:
+    EspAudioFree(chirp);
+    EspAudioFree(rec);
+    EspAudioFree(io);
+    return ret;
+}
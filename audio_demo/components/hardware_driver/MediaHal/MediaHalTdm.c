@@ -0,0 +1,128 @@
+/*
+ * ESPRESSIF MIT License
+ *
+ * Copyright (c) 2018 <ESPRESSIF SYSTEMS (SHANGHAI) PTE LTD>
+ *
+ * Permission is hereby granted for use on all ESPRESSIF SYSTEMS products, in which case,
+ * it is free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "driver/i2s.h"
+#include "board.h"
+#include "es7210.h"
+#include "MediaHal.h"
+#include "EspAudioAlloc.h"
+
+#define TDM_TAG "MEDIA_HAL_TDM"
+
+static struct {
+    int mics;
+    int frames;
+    int words;          // 32 bit words per frame, two 16 bit slots each
+    uint32_t *io;       // one block as the I2S hands it over
+} s_tdm;
+
+int MediaHalTdmInit(int mics, int frames)
+{
+    Es7210Config cfg = AUDIO_CODEC_ES7210_DEFAULT();
+    if ((mics != 2 && mics != 4) || frames <= 0 || (frames & 1)) {
+        ESP_LOGE(TDM_TAG, "%d mics or %d frames is invalid", mics, frames);
+        return -1;
+    }
+    if (s_tdm.io) {
+        MediaHalTdmUninit();
+    }
+    s_tdm.io = EspAudioMalloc(frames * mics * sizeof(int16_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT, 4);
+    if (s_tdm.io == NULL) {
+        ESP_LOGE(TDM_TAG, "no memory for the read block");
+        return -1;
+    }
+    if (MediaHalSetSlotBits(mics * 8) != 0) {
+        ESP_LOGE(TDM_TAG, "I2S %d bit slots failed", mics * 8);
+        goto err;
+    }
+    cfg.mics = mics;
+    if (Es7210Init(&cfg) != 0) {
+        goto err;
+    }
+    s_tdm.mics = mics;
+    s_tdm.frames = frames;
+    s_tdm.words = mics / 2;
+    return 0;
+
+err:
+    EspAudioFree(s_tdm.io);
+    s_tdm.io = NULL;
+    return -1;
+}
+
+/*
+ * Slot 2k is the upper half of word k of a frame (it is sent first, MSB first), slot 2k + 1 the lower half.
+ * Each pass takes one word column into two planes and packs two frames per store, so there is one load
+ * per word and one store per two samples, and the planes are written front to back
+ */
+static void media_hal_tdm_split(const uint32_t *io, int words, int frames, int16_t *planes, int stride)
+{
+    for (int k = 0; k < words; k++) {
+        const uint32_t *w = io + k;
+        uint32_t *p0 = (uint32_t *)(planes + 2 * k * stride);
+        uint32_t *p1 = (uint32_t *)(planes + (2 * k + 1) * stride);
+        int n = 0;
+        for (; n + 1 < frames; n += 2, w += 2 * words) {
+            uint32_t a = w[0];
+            uint32_t b = w[words];
+            *p0++ = (a >> 16) | (b & 0xFFFF0000);
+            *p1++ = (a & 0xFFFF) | (b << 16);
+        }
+        if (n < frames) {
+            ((int16_t *)p0)[0] = w[0] >> 16;
+            ((int16_t *)p1)[0] = w[0];
+        }
+    }
+}
+
+int MediaHalTdmRead(int16_t *planes, int timeout_ms)
+{
+    size_t bytes = 0;
+    if (s_tdm.io == NULL || planes == NULL) {
+        return -1;
+    }
+    size_t len = s_tdm.frames * s_tdm.words * sizeof(uint32_t);
+    if (i2s_read(MediaHalGetI2sNum(), s_tdm.io, len, &bytes, timeout_ms / portTICK_PERIOD_MS) != ESP_OK) {
+        ESP_LOGE(TDM_TAG, "i2s read error");
+        return -1;
+    }
+    int frames = bytes / (s_tdm.words * sizeof(uint32_t));
+    media_hal_tdm_split(s_tdm.io, s_tdm.words, frames, planes, s_tdm.frames);
+    return frames;
+}
+
+void MediaHalTdmUninit(void)
+{
+    if (s_tdm.io == NULL) {
+        return;
+    }
+    Es7210Uninit();
+    MediaHalSetSlotBits(16);
+    EspAudioFree(s_tdm.io);
+    memset(&s_tdm, 0, sizeof(s_tdm));
+}
@@ -22,8 +22,9 @@ esp_err_t sd_card_mount(const char* basePath)
     sdmmc_host_t host = SDMMC_HOST_DEFAULT();
 
 #ifdef CONFIG_ESP_LYRAT_V4_3_BOARD
-    // To use 1-line SD mode, uncomment the following line:
+#ifndef CONFIG_SD_CARD_4BIT_MODE
     host.flags = SDMMC_HOST_FLAG_1BIT;
+#endif
     host.max_freq_khz = SDMMC_FREQ_HIGHSPEED;
 
     sdmmc_slot_config_t slot_config = SDMMC_SLOT_CONFIG_DEFAULT();
@@ -50,7 +51,7 @@ esp_err_t sd_card_mount(const char* basePath)
 
     esp_vfs_fat_sdmmc_mount_config_t mount_config = {
         .format_if_mount_failed = false,
-        .max_files = 5
+        .max_files = CONFIG_SD_CARD_MAX_FILES
     };
 
     sdmmc_card_t *card;
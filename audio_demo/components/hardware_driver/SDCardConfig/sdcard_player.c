@@ -0,0 +1,219 @@
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <sys/unistd.h>
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "driver/i2s.h"
+#include "EspAudioAlloc.h"
+#include "sdcard_player.h"
+
+#define SD_PLAY_TAG     "SD_PLAYER"
+
+typedef struct {
+    uint8_t *data;
+    int len;                // 0 end of file, -1 read error
+} sd_block_t;
+
+struct sd_player {
+    sd_player_config_t cfg;
+    int fd;
+    sd_block_t *blocks;
+    sd_block_t *cur;        // the block the consumer holds
+    QueueHandle_t free_q;
+    QueueHandle_t full_q;
+    SemaphoreHandle_t done;
+    volatile int stop;
+    int ended;
+    sd_player_stats_t stats;
+};
+
+static void sd_player_task(void *arg)
+{
+    struct sd_player *player = arg;
+    // the first read ends on a sector boundary of the file, all the others are whole sectors
+    int first = player->cfg.block_size - player->cfg.offset % 512;
+    sd_block_t *blk;
+
+    while (xQueueReceive(player->free_q, &blk, portMAX_DELAY) == pdTRUE) {
+        if (player->stop) {
+            break;
+        }
+        int64_t t0 = esp_timer_get_time();
+        blk->len = read(player->fd, blk->data, first ? first : player->cfg.block_size);
+        int64_t t1 = esp_timer_get_time();
+        first = 0;
+        if (blk->len < 0) {
+            ESP_LOGE(SD_PLAY_TAG, "read failed at %llu", player->cfg.offset + player->stats.bytes);
+            blk->len = -1;
+        } else {
+            player->stats.bytes += blk->len;
+            player->stats.reads++;
+        }
+        if (t1 - t0 > player->stats.max_read_us) {
+            player->stats.max_read_us = t1 - t0;
+        }
+        xQueueSend(player->full_q, &blk, portMAX_DELAY);
+        if (blk->len <= 0) {
+            break;
+        }
+    }
+    xSemaphoreGive(player->done);
+    vTaskDelete(NULL);
+}
+
+static void sd_player_free(struct sd_player *player)
+{
+    if (player->blocks) {
+        for (int i = 0; i < player->cfg.block_num; i++) {
+            EspAudioFree(player->blocks[i].data);
+        }
+        free(player->blocks);
+    }
+    if (player->free_q) {
+        vQueueDelete(player->free_q);
+    }
+    if (player->full_q) {
+        vQueueDelete(player->full_q);
+    }
+    if (player->done) {
+        vSemaphoreDelete(player->done);
+    }
+    if (player->fd >= 0) {
+        close(player->fd);
+    }
+    free(player);
+}
+
+sd_player_handle_t sd_player_open(const sd_player_config_t *config)
+{
+    if (config->path == NULL || config->block_size <= 0 || config->block_num < 2) {
+        ESP_LOGE(SD_PLAY_TAG, "invalid config");
+        return NULL;
+    }
+    struct sd_player *player = calloc(1, sizeof(struct sd_player));
+    if (player == NULL) {
+        return NULL;
+    }
+    player->cfg = *config;
+    player->cfg.block_size = (config->block_size + 511) & ~511;
+    player->fd = -1;
+    player->stats.min_ready = config->block_num;
+    player->blocks = calloc(player->cfg.block_num, sizeof(sd_block_t));
+    player->free_q = xQueueCreate(player->cfg.block_num, sizeof(sd_block_t *));
+    player->full_q = xQueueCreate(player->cfg.block_num, sizeof(sd_block_t *));
+    player->done = xSemaphoreCreateBinary();
+    if (player->blocks == NULL || player->free_q == NULL || player->full_q == NULL || player->done == NULL) {
+        goto err;
+    }
+    // the SD host and the I2S DMA both take these blocks without a bounce buffer
+    for (int i = 0; i < player->cfg.block_num; i++) {
+        sd_block_t *blk = &player->blocks[i];
+        blk->data = EspAudioMalloc(player->cfg.block_size, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL, 4);
+        if (blk->data == NULL) {
+            ESP_LOGE(SD_PLAY_TAG, "no memory for %d blocks of %d bytes", player->cfg.block_num, player->cfg.block_size);
+            goto err;
+        }
+        xQueueSend(player->free_q, &blk, 0);
+    }
+
+    player->fd = open(config->path, O_RDONLY);
+    if (player->fd < 0) {
+        ESP_LOGE(SD_PLAY_TAG, "open %s failed", config->path);
+        goto err;
+    }
+    if (config->offset && lseek(player->fd, config->offset, SEEK_SET) != config->offset) {
+        ESP_LOGE(SD_PLAY_TAG, "%s is shorter than %u bytes", config->path, config->offset);
+        goto err;
+    }
+    if (xTaskCreatePinnedToCore(sd_player_task, "sd_player", 3 * 1024, player, config->task_prio, NULL,
+                                config->task_core) != pdPASS) {
+        goto err;
+    }
+    return player;
+
+err:
+    sd_player_free(player);
+    return NULL;
+}
+
+int sd_player_acquire(sd_player_handle_t player, const uint8_t **data, TickType_t wait)
+{
+    if (player->ended) {
+        return player->ended < 0 ? -1 : 0;
+    }
+    int ready = uxQueueMessagesWaiting(player->full_q);
+    if (xQueueReceive(player->full_q, &player->cur, wait) != pdTRUE) {
+        player->cur = NULL;
+        player->stats.underruns++;
+        return SD_PLAYER_UNDERRUN;
+    }
+    if (ready < player->stats.min_ready) {
+        player->stats.min_ready = ready;
+    }
+    int len = player->cur->len;
+    if (len <= 0) {
+        // the task has left, the marker block goes back with the others
+        player->ended = len == 0 ? 1 : -1;
+        sd_player_release(player);
+        return len;
+    }
+    *data = player->cur->data;
+    return len;
+}
+
+void sd_player_release(sd_player_handle_t player)
+{
+    if (player->cur) {
+        xQueueSend(player->free_q, &player->cur, portMAX_DELAY);
+        player->cur = NULL;
+    }
+}
+
+int sd_player_feed_i2s(sd_player_handle_t player, int i2s_num, TickType_t wait)
+{
+    const uint8_t *data;
+    size_t written = 0;
+
+    int len = sd_player_acquire(player, &data, wait);
+    if (len <= 0) {
+        return len;
+    }
+    esp_err_t ret = i2s_write(i2s_num, data, len, &written, portMAX_DELAY);
+    sd_player_release(player);
+    return ret == ESP_OK ? (int)written : -1;
+}
+
+esp_err_t sd_player_close(sd_player_handle_t player)
+{
+    sd_block_t *blk;
+
+    if (player == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    sd_player_release(player);
+    // hand every prefetched block back, the task then picks one up, sees stop and leaves
+    player->stop = 1;
+    do {
+        while (xQueueReceive(player->full_q, &blk, 0) == pdTRUE) {
+            xQueueSend(player->free_q, &blk, portMAX_DELAY);
+        }
+    } while (xSemaphoreTake(player->done, pdMS_TO_TICKS(10)) != pdTRUE);
+
+    esp_err_t ret = player->ended < 0 ? ESP_FAIL : ESP_OK;
+    ESP_LOGI(SD_PLAY_TAG, "%s: %llu bytes in %u reads, slowest %lld us, %u underruns, %d blocks left at worst",
+             player->cfg.path, player->stats.bytes, player->stats.reads, player->stats.max_read_us,
+             player->stats.underruns, player->stats.min_ready);
+    sd_player_free(player);
+    return ret;
+}
+
+void sd_player_get_stats(sd_player_handle_t player, sd_player_stats_t *stats)
+{
+    *stats = player->stats;
+}
@@ -0,0 +1,68 @@
+#ifndef _SDCARD_PLAYER_H_
+#define _SDCARD_PLAYER_H_
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+
+/*
+ * Plays a file from the card. A prefetch task of its own keeps a ring of large blocks filled ahead of
+ * the consumer, which takes the blocks themselves with sd_player_acquire and hands them back with
+ * sd_player_release, so a slow card read only drains the ring instead of stalling the I2S feed.
+ */
+
+typedef struct {
+    const char *path;
+    uint32_t offset;        // bytes to skip, a WAV header for instance
+    int block_size;         // bytes per card read, rounded up to 512
+    int block_num;          // blocks in the ring, internal DMA capable RAM
+    int task_prio;
+    int task_core;
+} sd_player_config_t;
+
+#define SD_PLAYER_DEFAULT_CONFIG(file) {    \
+    .path = file,                           \
+    .offset = 0,                            \
+    .block_size = 16 * 1024,                \
+    .block_num = 4,                         \
+    .task_prio = 6,                         \
+    .task_core = tskNO_AFFINITY,            \
+}
+
+typedef struct {
+    uint64_t bytes;         // read from the card
+    uint32_t reads;
+    uint32_t underruns;     // sd_player_acquire found no block within its wait
+    int min_ready;          // fewest blocks ready in the ring when one was taken
+    int64_t max_read_us;    // slowest block read
+} sd_player_stats_t;
+
+typedef struct sd_player *sd_player_handle_t;
+
+#define SD_PLAYER_UNDERRUN  (-2)    // no block ready within the wait, try again
+
+sd_player_handle_t sd_player_open(const sd_player_config_t *config);
+
+/**
+ * @brief Take the next block, it stays valid until sd_player_release.
+ *
+ * @return Bytes in the block, 0 at the end of the file, -1 after a read error or SD_PLAYER_UNDERRUN
+ */
+int sd_player_acquire(sd_player_handle_t player, const uint8_t **data, TickType_t wait);
+void sd_player_release(sd_player_handle_t player);
+
+/**
+ * @brief Hand the next block to i2s_write straight from the ring.
+ *
+ * @return Bytes written, 0 at the end of the file, -1 on an error or SD_PLAYER_UNDERRUN
+ */
+int sd_player_feed_i2s(sd_player_handle_t player, int i2s_num, TickType_t wait);
+
+/**
+ * @brief Stop the prefetch task and close the file, a block still acquired has to be released first.
+ */
+esp_err_t sd_player_close(sd_player_handle_t player);
+
+void sd_player_get_stats(sd_player_handle_t player, sd_player_stats_t *stats);
+
+#endif
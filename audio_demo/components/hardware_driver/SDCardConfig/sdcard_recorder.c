@@ -0,0 +1,213 @@
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <sys/unistd.h>
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "esp_idf_version.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "EspAudioAlloc.h"
+#include "sdcard_recorder.h"
+
+#define SD_REC_TAG      "SD_RECORDER"
+
+typedef struct {
+    uint8_t *data;
+    int len;
+} sd_block_t;
+
+struct sd_recorder {
+    sd_recorder_config_t cfg;
+    int fd;
+    sd_block_t *blocks;
+    sd_block_t *cur;        // the block sd_recorder_write fills
+    QueueHandle_t free_q;
+    QueueHandle_t full_q;   // a NULL block tells the task to stop
+    SemaphoreHandle_t done;
+    volatile int error;     // set by the task, the writer gives up on it
+    sd_recorder_stats_t stats;
+};
+
+static void sd_recorder_task(void *arg)
+{
+    struct sd_recorder *rec = arg;
+    int64_t last_sync = esp_timer_get_time();
+    sd_block_t *blk;
+
+    while (xQueueReceive(rec->full_q, &blk, portMAX_DELAY) == pdTRUE && blk) {
+        if (!rec->error) {
+            int64_t t0 = esp_timer_get_time();
+            if (write(rec->fd, blk->data, blk->len) != blk->len) {
+                ESP_LOGE(SD_REC_TAG, "write of %d bytes failed", blk->len);
+                rec->error = 1;
+            }
+            int64_t t1 = esp_timer_get_time();
+            rec->stats.bytes += blk->len;
+            rec->stats.writes++;
+            if (t1 - t0 > rec->stats.max_write_us) {
+                rec->stats.max_write_us = t1 - t0;
+            }
+            if (rec->cfg.sync_ms && t1 - last_sync >= rec->cfg.sync_ms * 1000LL) {
+                fsync(rec->fd);
+                rec->stats.syncs++;
+                last_sync = esp_timer_get_time();
+            }
+        }
+        blk->len = 0;
+        xQueueSend(rec->free_q, &blk, portMAX_DELAY);
+    }
+    xSemaphoreGive(rec->done);
+    vTaskDelete(NULL);
+}
+
+static void sd_recorder_free(struct sd_recorder *rec)
+{
+    if (rec->blocks) {
+        for (int i = 0; i < rec->cfg.block_num; i++) {
+            EspAudioFree(rec->blocks[i].data);
+        }
+        free(rec->blocks);
+    }
+    if (rec->free_q) {
+        vQueueDelete(rec->free_q);
+    }
+    if (rec->full_q) {
+        vQueueDelete(rec->full_q);
+    }
+    if (rec->done) {
+        vSemaphoreDelete(rec->done);
+    }
+    if (rec->fd >= 0) {
+        close(rec->fd);
+    }
+    free(rec);
+}
+
+sd_recorder_handle_t sd_recorder_open(const sd_recorder_config_t *config)
+{
+    if (config->path == NULL || config->block_size <= 0 || config->block_num < 2) {
+        ESP_LOGE(SD_REC_TAG, "invalid config");
+        return NULL;
+    }
+    struct sd_recorder *rec = calloc(1, sizeof(struct sd_recorder));
+    if (rec == NULL) {
+        return NULL;
+    }
+    rec->cfg = *config;
+    rec->cfg.block_size = (config->block_size + 511) & ~511;
+    rec->fd = -1;
+    rec->blocks = calloc(rec->cfg.block_num, sizeof(sd_block_t));
+    rec->free_q = xQueueCreate(rec->cfg.block_num, sizeof(sd_block_t *));
+    rec->full_q = xQueueCreate(rec->cfg.block_num + 1, sizeof(sd_block_t *));
+    rec->done = xSemaphoreCreateBinary();
+    if (rec->blocks == NULL || rec->free_q == NULL || rec->full_q == NULL || rec->done == NULL) {
+        goto err;
+    }
+    // the SD host writes from DMA capable memory straight, anything else goes through a bounce sector
+    for (int i = 0; i < rec->cfg.block_num; i++) {
+        sd_block_t *blk = &rec->blocks[i];
+        blk->data = EspAudioMalloc(rec->cfg.block_size, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL, 4);
+        if (blk->data == NULL) {
+            ESP_LOGE(SD_REC_TAG, "no memory for %d blocks of %d bytes", rec->cfg.block_num, rec->cfg.block_size);
+            goto err;
+        }
+        xQueueSend(rec->free_q, &blk, 0);
+    }
+
+    rec->fd = open(config->path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (rec->fd < 0) {
+        ESP_LOGE(SD_REC_TAG, "open %s failed", config->path);
+        goto err;
+    }
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(4, 3, 0)
+    if (config->prealloc) {
+        // seeking past the end makes FatFs chain the clusters now, close cuts the file back with ftruncate
+        if (lseek(rec->fd, config->prealloc, SEEK_SET) != config->prealloc || lseek(rec->fd, 0, SEEK_SET) != 0) {
+            ESP_LOGW(SD_REC_TAG, "could not reserve %u bytes", config->prealloc);
+        }
+    }
+#else
+    if (config->prealloc) {
+        ESP_LOGW(SD_REC_TAG, "preallocation needs ftruncate, IDF v4.3");
+        rec->cfg.prealloc = 0;
+    }
+#endif
+    if (xTaskCreatePinnedToCore(sd_recorder_task, "sd_recorder", 3 * 1024, rec, config->task_prio, NULL,
+                                config->task_core) != pdPASS) {
+        goto err;
+    }
+    return rec;
+
+err:
+    sd_recorder_free(rec);
+    return NULL;
+}
+
+int sd_recorder_write(sd_recorder_handle_t rec, const void *data, int len, TickType_t wait)
+{
+    const uint8_t *src = data;
+    int done = 0;
+
+    if (rec->error) {
+        return -1;
+    }
+    while (done < len) {
+        if (rec->cur == NULL && xQueueReceive(rec->free_q, &rec->cur, wait) != pdTRUE) {
+            rec->cur = NULL;
+            rec->stats.dropped += len - done;
+            break;
+        }
+        int n = rec->cfg.block_size - rec->cur->len;
+        if (n > len - done) {
+            n = len - done;
+        }
+        memcpy(rec->cur->data + rec->cur->len, src + done, n);
+        rec->cur->len += n;
+        done += n;
+        if (rec->cur->len == rec->cfg.block_size) {
+            xQueueSend(rec->full_q, &rec->cur, portMAX_DELAY);
+            rec->cur = NULL;
+        }
+    }
+    return done;
+}
+
+esp_err_t sd_recorder_close(sd_recorder_handle_t rec)
+{
+    sd_block_t *stop = NULL;
+
+    if (rec == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (rec->cur && rec->cur->len) {
+        xQueueSend(rec->full_q, &rec->cur, portMAX_DELAY);
+    }
+    rec->cur = NULL;
+    xQueueSend(rec->full_q, &stop, portMAX_DELAY);
+    xSemaphoreTake(rec->done, portMAX_DELAY);
+
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(4, 3, 0)
+    if (rec->cfg.prealloc && ftruncate(rec->fd, rec->stats.bytes) != 0) {
+        ESP_LOGE(SD_REC_TAG, "could not cut %s to %llu bytes", rec->cfg.path, rec->stats.bytes);
+        rec->error = 1;
+    }
+#endif
+    if (fsync(rec->fd) != 0) {
+        rec->error = 1;
+    }
+    rec->stats.syncs++;
+    esp_err_t ret = rec->error ? ESP_FAIL : ESP_OK;
+    ESP_LOGI(SD_REC_TAG, "%s: %llu bytes in %u writes, slowest %lld us, %u bytes dropped", rec->cfg.path,
+             rec->stats.bytes, rec->stats.writes, rec->stats.max_write_us, rec->stats.dropped);
+    sd_recorder_free(rec);
+    return ret;
+}
+
+void sd_recorder_get_stats(sd_recorder_handle_t rec, sd_recorder_stats_t *stats)
+{
+    *stats = rec->stats;
+}
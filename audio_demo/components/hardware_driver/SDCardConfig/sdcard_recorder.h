@@ -0,0 +1,61 @@
+#ifndef _SDCARD_RECORDER_H_
+#define _SDCARD_RECORDER_H_
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+
+/*
+ * Streams a recording to a file on the card. sd_recorder_write only copies into a ring of blocks, a task
+ * of its own writes each full block with one write() call, so the card sees large sequential writes that
+ * start on cluster boundaries, and fsync runs on an interval instead of after every block.
+ */
+
+typedef struct {
+    const char *path;
+    int block_size;         // bytes per card write, rounded up to 512; 32 KB fills a cluster of any FAT size
+    int block_num;          // blocks in the ring, internal DMA capable RAM
+    uint32_t prealloc;      // bytes reserved for the file at open so its clusters stay contiguous, 0 none
+    int sync_ms;            // fsync interval, 0 only at close
+    int task_prio;
+    int task_core;
+} sd_recorder_config_t;
+
+#define SD_RECORDER_DEFAULT_CONFIG(file) {  \
+    .path = file,                           \
+    .block_size = 32 * 1024,                \
+    .block_num = 3,                         \
+    .prealloc = 0,                          \
+    .sync_ms = 2000,                        \
+    .task_prio = 5,                         \
+    .task_core = tskNO_AFFINITY,            \
+}
+
+typedef struct {
+    uint64_t bytes;         // written to the card
+    uint32_t writes;
+    uint32_t syncs;
+    uint32_t dropped;       // bytes sd_recorder_write gave up on, no free block in time
+    int64_t max_write_us;   // slowest block write, the ring has to cover it
+} sd_recorder_stats_t;
+
+typedef struct sd_recorder *sd_recorder_handle_t;
+
+sd_recorder_handle_t sd_recorder_open(const sd_recorder_config_t *config);
+
+/**
+ * @brief Copy len bytes into the ring.
+ *
+ * @param wait  How long to wait for a free block, 0 from a realtime path
+ * @return Bytes taken, short when no block got free in time; -1 after a card error
+ */
+int sd_recorder_write(sd_recorder_handle_t rec, const void *data, int len, TickType_t wait);
+
+/**
+ * @brief Write what is left, cut a preallocated file to the recorded length, fsync and close.
+ */
+esp_err_t sd_recorder_close(sd_recorder_handle_t rec);
+
+void sd_recorder_get_stats(sd_recorder_handle_t rec, sd_recorder_stats_t *stats);
+
+#endif
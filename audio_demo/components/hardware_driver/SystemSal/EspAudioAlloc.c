@@ -29,6 +29,15 @@
 #include "esp_heap_caps.h"
 
 #include "esp_log.h"
+#include "esp_idf_version.h"
+#include "freertos/FreeRTOS.h"
+#include "soc/soc_memory_layout.h"
+#include "EspAudioAlloc.h"
+
+// the functions stay for callers built without the header
+#undef EspAudioAlloc
+#undef EspAudioAllocInner
+#undef EspAudioMalloc
 
 void *EspAudioAlloc(int n, int size)
 {
@@ -77,6 +86,32 @@ void *EspAudioAllocInner(int n, int size)
     return data;
 }
 
+void *EspAudioMalloc(int size, uint32_t caps, int align)
+{
+    if (caps == 0) {
+#if CONFIG_SPIRAM_BOOT_INIT || CONFIG_MEMMAP_SPIRAM_ENABLE_MALLOC
+        caps = MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT;
+#else
+        caps = MALLOC_CAP_8BIT;
+#endif
+    }
+#if IDF_3_0
+    // the heap hands out word aligned blocks anyway
+    if (align <= 4) {
+        return heap_caps_malloc(size, caps);
+    }
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(4, 3, 0)
+    // from v4.3 free() takes these blocks too
+    return heap_caps_aligned_alloc(align, size, caps);
+#else
+    ESP_LOGE("ALLOC", "%d byte alignment needs IDF v4.3", align);
+    return NULL;
+#endif
+#else
+    return pvPortMallocCaps(size, caps);
+#endif
+}
+
 void EspAudioPrintMemory(const char *Tag)
 {
 #if IDF_3_0
@@ -107,3 +142,257 @@ void EspAudioMemoryShow(const char *Tag, const char *Info, int Line)
                    heap_caps_get_free_size(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT));
 }
 
+#ifdef CONFIG_ESP_AUDIO_ALLOC_TRACK
+
+#define ALLOC_TRACK_TAG_MAX     16
+#define ALLOC_REGION_INTERNAL   0
+#define ALLOC_REGION_PSRAM      1
+#define ALLOC_EVENT_ALLOC       0
+#define ALLOC_EVENT_FREE        1
+#define ALLOC_EVENT_FAIL        2
+
+typedef struct {
+    const char *tag;
+    int live[2];                // bytes, by region
+    int peak[2];
+    int count;                  // allocations
+    int failed;
+} alloc_tag_stat_t;
+
+typedef struct {
+    void *ptr;
+    int size;
+    uint32_t time_ms;
+    uint8_t tag;
+    uint8_t region;
+} alloc_live_t;
+
+typedef struct {
+    uint32_t time_ms;
+    uint32_t size;
+    uint32_t life_ms;           // frees only
+    uint8_t tag;
+    uint8_t type;
+    uint8_t region;
+    uint8_t dma;
+} alloc_event_t;
+
+static portMUX_TYPE s_track_lock = portMUX_INITIALIZER_UNLOCKED;
+static alloc_tag_stat_t s_tags[ALLOC_TRACK_TAG_MAX];
+static int s_tag_num;
+static alloc_live_t s_live[CONFIG_ESP_AUDIO_ALLOC_TRACK_LIVE];
+static int s_untracked;
+static alloc_event_t s_events[CONFIG_ESP_AUDIO_ALLOC_TRACK_EVENTS];
+static uint32_t s_event_count;
+
+// tags are string literals, the pointer is the key; the last slot takes whatever does not fit
+static int alloc_tag_index(const char *tag)
+{
+    for (int i = 0; i < s_tag_num; i++) {
+        if (s_tags[i].tag == tag) {
+            return i;
+        }
+    }
+    if (s_tag_num < ALLOC_TRACK_TAG_MAX) {
+        s_tags[s_tag_num].tag = tag;
+        return s_tag_num++;
+    }
+    s_tags[ALLOC_TRACK_TAG_MAX - 1].tag = "(other)";
+    return ALLOC_TRACK_TAG_MAX - 1;
+}
+
+static void alloc_event_add(int type, int tag, int size, int region, int dma, uint32_t life_ms)
+{
+    alloc_event_t *ev = &s_events[s_event_count++ % CONFIG_ESP_AUDIO_ALLOC_TRACK_EVENTS];
+    ev->time_ms = esp_log_timestamp();
+    ev->size = size;
+    ev->life_ms = life_ms;
+    ev->tag = tag;
+    ev->type = type;
+    ev->region = region;
+    ev->dma = dma;
+}
+
+static void alloc_live_drop(alloc_live_t *live, uint32_t now)
+{
+    alloc_tag_stat_t *st = &s_tags[live->tag];
+    st->live[live->region] -= live->size;
+    alloc_event_add(ALLOC_EVENT_FREE, live->tag, live->size, live->region, 0, now - live->time_ms);
+    live->ptr = NULL;
+}
+
+static void alloc_track(const char *Tag, void *ptr, int size)
+{
+    uint32_t now = esp_log_timestamp();
+
+    portENTER_CRITICAL(&s_track_lock);
+    int tag = alloc_tag_index(Tag);
+    alloc_tag_stat_t *st = &s_tags[tag];
+    if (ptr == NULL) {
+        st->failed++;
+        alloc_event_add(ALLOC_EVENT_FAIL, tag, size, 0, 0, 0);
+        portEXIT_CRITICAL(&s_track_lock);
+        return;
+    }
+    int region = esp_ptr_external_ram(ptr) ? ALLOC_REGION_PSRAM : ALLOC_REGION_INTERNAL;
+    alloc_live_t *slot = NULL;
+    for (int i = 0; i < CONFIG_ESP_AUDIO_ALLOC_TRACK_LIVE; i++) {
+        if (s_live[i].ptr == ptr) {
+            // an untracked free() let the address go
+            alloc_live_drop(&s_live[i], now);
+        }
+        if (s_live[i].ptr == NULL && slot == NULL) {
+            slot = &s_live[i];
+        }
+    }
+    st->count++;
+    st->live[region] += size;
+    if (st->live[region] > st->peak[region]) {
+        st->peak[region] = st->live[region];
+    }
+    alloc_event_add(ALLOC_EVENT_ALLOC, tag, size, region, esp_ptr_dma_capable(ptr), 0);
+    if (slot) {
+        slot->ptr = ptr;
+        slot->size = size;
+        slot->time_ms = now;
+        slot->tag = tag;
+        slot->region = region;
+    } else {
+        // counted in the peak, never taken off the live bytes
+        s_untracked++;
+    }
+    portEXIT_CRITICAL(&s_track_lock);
+}
+
+void *EspAudioAllocTag(const char *Tag, int n, int size)
+{
+    void *data = EspAudioAlloc(n, size);
+    alloc_track(Tag, data, n * size);
+    return data;
+}
+
+void *EspAudioAllocInnerTag(const char *Tag, int n, int size)
+{
+    void *data = EspAudioAllocInner(n, size);
+    alloc_track(Tag, data, n * size);
+    return data;
+}
+
+void *EspAudioMallocTag(const char *Tag, int size, uint32_t caps, int align)
+{
+    void *data = EspAudioMalloc(size, caps, align);
+    alloc_track(Tag, data, size);
+    return data;
+}
+
+void EspAudioFree(void *ptr)
+{
+    if (ptr == NULL) {
+        return;
+    }
+    uint32_t now = esp_log_timestamp();
+    portENTER_CRITICAL(&s_track_lock);
+    for (int i = 0; i < CONFIG_ESP_AUDIO_ALLOC_TRACK_LIVE; i++) {
+        if (s_live[i].ptr == ptr) {
+            alloc_live_drop(&s_live[i], now);
+            break;
+        }
+    }
+    portEXIT_CRITICAL(&s_track_lock);
+    free(ptr);
+}
+
+static const char *alloc_tag_name(const char *tag)
+{
+    const char *name = strrchr(tag, '/');
+    return name ? name + 1 : tag;
+}
+
+void EspAudioAllocReport(const char *Tag)
+{
+    alloc_tag_stat_t tags[ALLOC_TRACK_TAG_MAX];
+    int num, untracked;
+
+    portENTER_CRITICAL(&s_track_lock);
+    memcpy(tags, s_tags, sizeof(tags));
+    num = s_tag_num;
+    untracked = s_untracked;
+    portEXIT_CRITICAL(&s_track_lock);
+
+    ESP_LOGI(Tag, "%-24s %8s %8s %8s %8s %6s", "tag", "inter", "peak", "psram", "peak", "allocs");
+    for (int i = 0; i < num; i++) {
+        ESP_LOGI(Tag, "%-24s %8d %8d %8d %8d %6d%s", alloc_tag_name(tags[i].tag),
+                 tags[i].live[ALLOC_REGION_INTERNAL], tags[i].peak[ALLOC_REGION_INTERNAL],
+                 tags[i].live[ALLOC_REGION_PSRAM], tags[i].peak[ALLOC_REGION_PSRAM],
+                 tags[i].count, tags[i].failed ? " failed" : "");
+    }
+    if (untracked) {
+        ESP_LOGW(Tag, "%d blocks not tracked, raise CONFIG_ESP_AUDIO_ALLOC_TRACK_LIVE", untracked);
+    }
+
+    // how much of the free memory is not in the largest block
+    size_t free_in = heap_caps_get_free_size(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    size_t large_in = heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    size_t free_ps = heap_caps_get_free_size(MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    size_t large_ps = heap_caps_get_largest_free_block(MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    ESP_LOGI(Tag, "inter free %d largest %d frag %d%%, psram free %d largest %d frag %d%%",
+             free_in, large_in, free_in ? (int)(100 - large_in * 100 / free_in) : 0,
+             free_ps, large_ps, free_ps ? (int)(100 - large_ps * 100 / free_ps) : 0);
+}
+
+void EspAudioAllocEvents(const char *Tag)
+{
+    static const char *type_name[] = {"alloc", "free", "FAIL"};
+    static const char *region_name[] = {"inter", "psram"};
+    alloc_event_t ev;
+
+    uint32_t count = s_event_count;
+    uint32_t first = count > CONFIG_ESP_AUDIO_ALLOC_TRACK_EVENTS ? count - CONFIG_ESP_AUDIO_ALLOC_TRACK_EVENTS : 0;
+    for (uint32_t i = first; i < count; i++) {
+        portENTER_CRITICAL(&s_track_lock);
+        ev = s_events[i % CONFIG_ESP_AUDIO_ALLOC_TRACK_EVENTS];
+        const char *tag = s_tags[ev.tag].tag;
+        portEXIT_CRITICAL(&s_track_lock);
+        if (ev.type == ALLOC_EVENT_FREE) {
+            ESP_LOGI(Tag, "%8u %-5s %-24s %6u %s, lived %u ms", ev.time_ms, type_name[ev.type], alloc_tag_name(tag),
+                     ev.size, region_name[ev.region], ev.life_ms);
+        } else {
+            ESP_LOGI(Tag, "%8u %-5s %-24s %6u %s%s", ev.time_ms, type_name[ev.type], alloc_tag_name(tag),
+                     ev.size, region_name[ev.region], ev.dma ? " dma" : "");
+        }
+    }
+}
+
+#else
+
+void *EspAudioAllocTag(const char *Tag, int n, int size)
+{
+    return EspAudioAlloc(n, size);
+}
+
+void *EspAudioAllocInnerTag(const char *Tag, int n, int size)
+{
+    return EspAudioAllocInner(n, size);
+}
+
+void *EspAudioMallocTag(const char *Tag, int size, uint32_t caps, int align)
+{
+    return EspAudioMalloc(size, caps, align);
+}
+
+void EspAudioFree(void *ptr)
+{
+    free(ptr);
+}
+
+void EspAudioAllocReport(const char *Tag)
+{
+    ESP_LOGI(Tag, "allocation tracking is off, enable CONFIG_ESP_AUDIO_ALLOC_TRACK");
+    EspAudioPrintMemory(Tag);
+}
+
+void EspAudioAllocEvents(const char *Tag)
+{
+}
+
+#endif
@@ -26,6 +26,8 @@
 #define _ESP_AUDIO_ALLOC_H_
 
 //#include "esp_log.h"
+#include <stdint.h>
+#include "sdkconfig.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -36,6 +38,36 @@ void *EspAudioAllocInner(int n, int size);
 void EspAudioPrintMemory(const char *Tag);
 void EspAudioMemoryShow(const char *Tag, const char *Info, int Line);
 
+/*
+ * Not zeroed, for buffers a DMA transfer or a memcpy fills before they are read.
+ * caps: MALLOC_CAP_* as for heap_caps_malloc, 0 for where EspAudioAlloc puts it (PSRAM when it is on)
+ * align: 0 or a power of two, more than 4 needs IDF v4.3
+ */
+void *EspAudioMalloc(int size, uint32_t caps, int align);
+
+/*
+ * With CONFIG_ESP_AUDIO_ALLOC_TRACK, EspAudioAlloc, EspAudioAllocInner and EspAudioMalloc record the caller file as
+ * the tag of the block. Free the blocks with EspAudioFree so their lifetime is known, a block given
+ * to free() stays live in the report until its address is handed out again.
+ */
+void *EspAudioAllocTag(const char *Tag, int n, int size);
+void *EspAudioAllocInnerTag(const char *Tag, int n, int size);
+void *EspAudioMallocTag(const char *Tag, int size, uint32_t caps, int align);
+void EspAudioFree(void *ptr);
+
+/*
+ * Live and peak bytes of each tag, internal RAM and PSRAM apart, and the fragmentation of both heaps.
+ * EspAudioAllocEvents prints the last allocations and frees.
+ */
+void EspAudioAllocReport(const char *Tag);
+void EspAudioAllocEvents(const char *Tag);
+
+#ifdef CONFIG_ESP_AUDIO_ALLOC_TRACK
+#define EspAudioAlloc(n, size)          EspAudioAllocTag(__FILE__, n, size)
+#define EspAudioAllocInner(n, size)     EspAudioAllocInnerTag(__FILE__, n, size)
+#define EspAudioMalloc(size, caps, align)   EspAudioMallocTag(__FILE__, size, caps, align)
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,145 @@
+// Copyright 2018 Espressif Systems (Shanghai) PTE LTD
+// All rights reserved.
+
+#include <stdlib.h>
+#include "sdkconfig.h"
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "EspAudioPool.h"
+
+#define POOL_TAG    "AUDIO_POOL"
+#define POOL_END    0xffff
+
+/*
+ * Treiber stack of block indexes. head holds the top index in the low half and a change count in the
+ * high half, so a block taken and given back between the load and the compare exchange of another
+ * caller does not go unnoticed. The links live beside the blocks, a DMA block is never written to.
+ */
+struct EspAudioPool {
+    uint8_t *blocks;
+    uint16_t *next;
+    int block_size;
+    int block_num;
+    uint32_t head;
+    int free_now;
+    int free_low;
+};
+
+EspAudioPool *EspAudioPoolCreate(int block_size, int block_num, uint32_t caps)
+{
+    if (block_size <= 0 || block_num <= 0 || block_num >= POOL_END) {
+        ESP_LOGE(POOL_TAG, "invalid pool, %d blocks of %d bytes", block_num, block_size);
+        return NULL;
+    }
+    EspAudioPool *pool = calloc(1, sizeof(EspAudioPool));
+    if (pool == NULL) {
+        return NULL;
+    }
+    // word aligned blocks, as the DMA engines want them
+    pool->block_size = (block_size + 3) & ~3;
+    pool->block_num = block_num;
+    pool->blocks = heap_caps_malloc(pool->block_size * block_num, caps);
+    pool->next = malloc(block_num * sizeof(uint16_t));
+    if (pool->blocks == NULL || pool->next == NULL) {
+        ESP_LOGE(POOL_TAG, "no memory for %d blocks of %d bytes", block_num, pool->block_size);
+        EspAudioPoolDestroy(pool);
+        return NULL;
+    }
+    for (int i = 0; i < block_num; i++) {
+        pool->next[i] = (i + 1 < block_num) ? i + 1 : POOL_END;
+    }
+    pool->head = 0;
+    pool->free_now = block_num;
+    pool->free_low = block_num;
+    return pool;
+}
+
+void *EspAudioPoolAlloc(EspAudioPool *pool)
+{
+    uint32_t head = __atomic_load_n(&pool->head, __ATOMIC_ACQUIRE);
+    uint32_t top;
+    do {
+        top = head & 0xffff;
+        if (top == POOL_END) {
+            return NULL;
+        }
+        // next[top] may be stale if another caller won, the change count then fails the exchange
+    } while (!__atomic_compare_exchange_n(&pool->head, &head, ((head + 0x10000) & 0xffff0000) | pool->next[top],
+                                          1, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE));
+
+    int left = __atomic_sub_fetch(&pool->free_now, 1, __ATOMIC_RELAXED);
+    if (left < pool->free_low) {
+        // a watermark, a lost race only makes it a block off
+        pool->free_low = left;
+    }
+    return pool->blocks + top * pool->block_size;
+}
+
+void EspAudioPoolFree(EspAudioPool *pool, void *block)
+{
+    if (block == NULL) {
+        return;
+    }
+    uint32_t offset = (uint8_t *)block - pool->blocks;
+    uint32_t index = offset / pool->block_size;
+    if (index >= (uint32_t)pool->block_num || offset % pool->block_size) {
+        ESP_LOGE(POOL_TAG, "%p is not a block of the pool", block);
+        return;
+    }
+
+    uint32_t head = __atomic_load_n(&pool->head, __ATOMIC_RELAXED);
+    do {
+        pool->next[index] = head & 0xffff;
+    } while (!__atomic_compare_exchange_n(&pool->head, &head, ((head + 0x10000) & 0xffff0000) | index,
+                                          1, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+    __atomic_add_fetch(&pool->free_now, 1, __ATOMIC_RELAXED);
+}
+
+int EspAudioPoolBlockSize(EspAudioPool *pool)
+{
+    return pool->block_size;
+}
+
+void EspAudioPoolGetFree(EspAudioPool *pool, int *now, int *low)
+{
+    if (now) {
+        *now = __atomic_load_n(&pool->free_now, __ATOMIC_RELAXED);
+    }
+    if (low) {
+        *low = pool->free_low;
+    }
+}
+
+void EspAudioPoolDestroy(EspAudioPool *pool)
+{
+    if (pool == NULL) {
+        return;
+    }
+    if (pool->blocks && pool->free_now != pool->block_num) {
+        ESP_LOGW(POOL_TAG, "destroyed with %d blocks in use", pool->block_num - pool->free_now);
+    }
+    heap_caps_free(pool->blocks);
+    free(pool->next);
+    free(pool);
+}
+
+#ifdef CONFIG_ESP_AUDIO_DMA_POOL
+static EspAudioPool *s_dma_pool;
+
+// runs with the global constructors, before app_main and before the heap is fragmented by anyone
+__attribute__((constructor)) static void EspAudioPoolDmaReserve(void)
+{
+    s_dma_pool = EspAudioPoolCreate(CONFIG_ESP_AUDIO_DMA_POOL_BLOCK_SIZE, CONFIG_ESP_AUDIO_DMA_POOL_BLOCK_NUM,
+                                    MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+}
+
+EspAudioPool *EspAudioPoolDma(void)
+{
+    return s_dma_pool;
+}
+#else
+EspAudioPool *EspAudioPoolDma(void)
+{
+    return NULL;
+}
+#endif
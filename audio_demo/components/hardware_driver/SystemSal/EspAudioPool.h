@@ -0,0 +1,37 @@
+// Copyright 2018 Espressif Systems (Shanghai) PTE LTD
+// All rights reserved.
+
+#ifndef _ESP_AUDIO_POOL_H_
+#define _ESP_AUDIO_POOL_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Fixed-size blocks carved from one allocation at create time. Alloc and free are O(1) and lock free,
+ * so they can be called from any task or an ISR, and the pool never fragments the heap.
+ */
+typedef struct EspAudioPool EspAudioPool;
+
+// caps as for heap_caps_malloc, MALLOC_CAP_DMA for blocks handed to a driver; block_num < 65535
+EspAudioPool *EspAudioPoolCreate(int block_size, int block_num, uint32_t caps);
+// NULL when every block is in use, never waits
+void *EspAudioPoolAlloc(EspAudioPool *pool);
+void EspAudioPoolFree(EspAudioPool *pool, void *block);
+int EspAudioPoolBlockSize(EspAudioPool *pool);
+// free blocks now and the fewest there have been since create
+void EspAudioPoolGetFree(EspAudioPool *pool, int *now, int *low);
+// all blocks have to be back
+void EspAudioPoolDestroy(EspAudioPool *pool);
+
+// the DMA pool CONFIG_ESP_AUDIO_DMA_POOL reserves at boot, NULL when it is off
+EspAudioPool *EspAudioPoolDma(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
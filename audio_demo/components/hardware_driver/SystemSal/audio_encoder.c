@@ -0,0 +1,182 @@
+// Copyright 2018 Espressif Systems (Shanghai) PTE LTD
+// All rights reserved.
+
+/**
+* \file
+*   IMA ADPCM block encoder and decoder, and the encoder stage of the audio pipeline
+*/
+#include <stdlib.h>
+#include <string.h>
+#include "esp_log.h"
+#include "audio_encoder.h"
+
+#define ENC_TAG "AUDIO_ENC"
+
+static const int16_t adpcm_step_table[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+    337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+    2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+
+static const int8_t adpcm_index_table[8] = { -1, -1, -1, -1, 2, 4, 6, 8 };
+
+typedef struct {
+    audio_encoder_t base;
+    int predictor;
+    int index;
+} adpcm_encoder_t;
+
+static inline int adpcm_clamp(int v, int lo, int hi)
+{
+    return v < lo ? lo : (v > hi ? hi : v);
+}
+
+// the decoder side of a nibble, the encoder runs it too so both track the same predictor
+static inline void adpcm_step(int *predictor, int *index, int code)
+{
+    int step = adpcm_step_table[*index];
+    int diff = step >> 3;
+    if (code & 4) diff += step;
+    if (code & 2) diff += step >> 1;
+    if (code & 1) diff += step >> 2;
+    *predictor = adpcm_clamp(*predictor + ((code & 8) ? -diff : diff), INT16_MIN, INT16_MAX);
+    *index = adpcm_clamp(*index + adpcm_index_table[code & 7], 0, 88);
+}
+
+static inline int adpcm_encode_sample(int *predictor, int *index, int sample)
+{
+    int step = adpcm_step_table[*index];
+    int diff = sample - *predictor;
+    int code = 0;
+    if (diff < 0) {
+        code = 8;
+        diff = -diff;
+    }
+    if (diff >= step) {
+        code |= 4;
+        diff -= step;
+    }
+    if (diff >= step >> 1) {
+        code |= 2;
+        diff -= step >> 1;
+    }
+    if (diff >= step >> 2) {
+        code |= 1;
+    }
+    adpcm_step(predictor, index, code);
+    return code;
+}
+
+int audio_adpcm_block_samples(int block_bytes)
+{
+    return (block_bytes - 4) * 2 + 1;
+}
+
+static int adpcm_encode(audio_encoder_t *enc, const int16_t *pcm, uint8_t *out)
+{
+    adpcm_encoder_t *a = (adpcm_encoder_t *)enc;
+    int n = enc->frame_samples;
+
+    // the header restarts the decoder on the first sample, the index carries over from the last block
+    a->predictor = pcm[0];
+    out[0] = a->predictor & 0xff;
+    out[1] = (a->predictor >> 8) & 0xff;
+    out[2] = a->index;
+    out[3] = 0;
+    uint8_t *p = out + 4;
+    for (int i = 1; i < n; i += 2) {
+        int lo = adpcm_encode_sample(&a->predictor, &a->index, pcm[i]);
+        int hi = adpcm_encode_sample(&a->predictor, &a->index, pcm[i + 1]);
+        *p++ = lo | (hi << 4);
+    }
+    return enc->frame_bytes;
+}
+
+int audio_adpcm_decode_block(const uint8_t *block, int block_bytes, int16_t *pcm)
+{
+    int predictor = (int16_t)(block[0] | (block[1] << 8));
+    int index = adpcm_clamp(block[2], 0, 88);
+    int n = 0;
+
+    pcm[n++] = predictor;
+    for (int i = 4; i < block_bytes; i++) {
+        adpcm_step(&predictor, &index, block[i] & 0x0f);
+        pcm[n++] = predictor;
+        adpcm_step(&predictor, &index, block[i] >> 4);
+        pcm[n++] = predictor;
+    }
+    return n;
+}
+
+static void adpcm_destroy(audio_encoder_t *enc)
+{
+    free(enc);
+}
+
+audio_encoder_t *audio_encoder_adpcm_create(int sample_rate, int block_bytes)
+{
+    if (block_bytes < 8 || block_bytes % 4) {
+        ESP_LOGE(ENC_TAG, "ADPCM block of %d bytes, a multiple of 4 is needed", block_bytes);
+        return NULL;
+    }
+    adpcm_encoder_t *a = calloc(1, sizeof(adpcm_encoder_t));
+    if (a == NULL) {
+        return NULL;
+    }
+    a->base.name = "ima-adpcm";
+    a->base.sample_rate = sample_rate;
+    a->base.frame_samples = audio_adpcm_block_samples(block_bytes);
+    a->base.frame_bytes = block_bytes;
+    a->base.encode = adpcm_encode;
+    a->base.destroy = adpcm_destroy;
+    return &a->base;
+}
+
+static inline void wav_put16(uint8_t *p, uint32_t v)
+{
+    p[0] = v & 0xff;
+    p[1] = (v >> 8) & 0xff;
+}
+
+static inline void wav_put32(uint8_t *p, uint32_t v)
+{
+    wav_put16(p, v & 0xffff);
+    wav_put16(p + 2, v >> 16);
+}
+
+int audio_adpcm_wav_header(uint8_t *buf, int sample_rate, int block_bytes, uint32_t data_bytes)
+{
+    int samples = audio_adpcm_block_samples(block_bytes);
+
+    memcpy(buf, "RIFF", 4);
+    wav_put32(buf + 4, data_bytes ? 52 + data_bytes : 0xffffffff);
+    memcpy(buf + 8, "WAVEfmt ", 8);
+    wav_put32(buf + 16, 20);
+    wav_put16(buf + 20, 0x11);
+    wav_put16(buf + 22, 1);
+    wav_put32(buf + 24, sample_rate);
+    wav_put32(buf + 28, (uint32_t)((int64_t)sample_rate * block_bytes / samples));
+    wav_put16(buf + 32, block_bytes);
+    wav_put16(buf + 34, 4);
+    wav_put16(buf + 36, 2);
+    wav_put16(buf + 38, samples);
+    memcpy(buf + 40, "fact", 4);
+    wav_put32(buf + 44, 4);
+    wav_put32(buf + 48, data_bytes ? data_bytes / block_bytes * samples : 0);
+    memcpy(buf + 52, "data", 4);
+    wav_put32(buf + 56, data_bytes ? data_bytes : 0xffffffff - 52);
+    return 60;
+}
+
+int audio_element_encode(void *ctx, uint8_t *in, int in_len, uint8_t *out, int out_len)
+{
+    audio_encoder_t *enc = ctx;
+    if (in_len != enc->frame_samples * (int)sizeof(int16_t) || out_len < enc->frame_bytes) {
+        ESP_LOGE(ENC_TAG, "%s wants %d byte frames in and %d out, got %d and %d", enc->name,
+                 enc->frame_samples * (int)sizeof(int16_t), enc->frame_bytes, in_len, out_len);
+        return -1;
+    }
+    return enc->encode(enc, (const int16_t *)in, out);
+}
@@ -0,0 +1,61 @@
+// Copyright 2018 Espressif Systems (Shanghai) PTE LTD
+// All rights reserved.
+
+#ifndef _AUDIO_ENCODER_H_
+#define _AUDIO_ENCODER_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Frame encoders for the mic path, mono 16-bit in. Every frame takes frame_samples samples and gives
+ * frame_bytes bytes, so an encoder is one audio_pipeline stage with fixed frames on both sides and
+ * adds one frame of latency.
+ */
+typedef struct audio_encoder audio_encoder_t;
+
+struct audio_encoder {
+    const char *name;
+    int sample_rate;
+    int frame_samples;
+    int frame_bytes;
+    // return: frame_bytes, < 0 on an error
+    int (*encode)(audio_encoder_t *enc, const int16_t *pcm, uint8_t *out);
+    void (*destroy)(audio_encoder_t *enc);
+};
+
+/*
+ * IMA ADPCM, the blocks of WAVE format 0x11: a 4 byte header (first sample, step index) and 4 bits
+ * per sample after it. block_bytes 256 holds 505 samples, about 4:1; each block decodes on its own.
+ *
+ * Opus has no encoder in this tree. Wrap the one of the application (esp-adf, libopus) in an
+ * audio_encoder_t, in CBR mode so its packets have one size.
+ */
+audio_encoder_t *audio_encoder_adpcm_create(int sample_rate, int block_bytes);
+
+// samples of a block_bytes block
+int audio_adpcm_block_samples(int block_bytes);
+// one block back to block samples, for playback of what was recorded
+int audio_adpcm_decode_block(const uint8_t *block, int block_bytes, int16_t *pcm);
+
+// the 60 byte header of an IMA ADPCM WAV file, data_bytes 0 while the length is not known yet
+int audio_adpcm_wav_header(uint8_t *buf, int sample_rate, int block_bytes, uint32_t data_bytes);
+
+static inline void audio_encoder_destroy(audio_encoder_t *enc)
+{
+    if (enc) {
+        enc->destroy(enc);
+    }
+}
+
+// audio_pipeline stage, ctx is the audio_encoder_t; the frame before it has frame_samples samples
+int audio_element_encode(void *ctx, uint8_t *in, int in_len, uint8_t *out, int out_len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
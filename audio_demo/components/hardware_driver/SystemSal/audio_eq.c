@@ -0,0 +1,237 @@
+// Copyright 2018 Espressif Systems (Shanghai) PTE LTD
+// All rights reserved.
+
+/**
+* \file
+*   Biquad equalizer: cookbook design, Q28 cascade on interleaved PCM and the tuning kept in NVS
+*/
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <stddef.h>
+#include "sdkconfig.h"
+#include "esp_log.h"
+#include "nvs.h"
+#include "freertos/FreeRTOS.h"
+#include "audio_eq.h"
+
+#define EQ_TAG          "AUDIO_EQ"
+#define EQ_NVS_NS       "audio_eq"
+#define EQ_BLOB_MAGIC   0x5145          // "EQ"
+
+#if defined CONFIG_ESP_LYRAT_V4_3_BOARD
+#define EQ_BOARD_KEY    "lyrat_v4_3"
+#elif defined CONFIG_ESP_LYRAT_MINI_V1_1_BOARD
+#define EQ_BOARD_KEY    "lyrat_mini"
+#else
+#define EQ_BOARD_KEY    "board"
+#endif
+
+typedef struct {
+    uint16_t magic;
+    uint16_t stages;
+    audio_biquad_coef_t coef[AUDIO_EQ_MAX_STAGES];
+} eq_blob_t;
+
+struct audio_eq {
+    int channels;
+    int stages;
+    audio_biquad_coef_t coef[AUDIO_EQ_MAX_STAGES];
+    int64_t state[AUDIO_EQ_MAX_STAGES][AUDIO_EQ_MAX_CHANNELS][2];
+    // audio_eq_set_stages leaves the new set here, the process side swaps it in
+    int pending;
+    int pending_stages;
+    audio_biquad_coef_t pending_coef[AUDIO_EQ_MAX_STAGES];
+    portMUX_TYPE lock;
+};
+
+static int32_t eq_q28(double v)
+{
+    return (int32_t)lrint(v * (1 << AUDIO_EQ_COEF_SHIFT));
+}
+
+void audio_biquad_design(audio_biquad_type_t type, float fc, float q, float gain_db, int sample_rate,
+                         audio_biquad_coef_t *coef)
+{
+    double A = pow(10.0, gain_db / 40.0);
+    double w0 = 2 * M_PI * fc / sample_rate;
+    double cw = cos(w0);
+    double alpha = sin(w0) / (2 * q);
+    double b0, b1, b2, a0, a1, a2;
+
+    switch (type) {
+    case AUDIO_BIQUAD_LOWPASS:
+        b0 = (1 - cw) / 2;  b1 = 1 - cw;  b2 = (1 - cw) / 2;
+        a0 = 1 + alpha;     a1 = -2 * cw; a2 = 1 - alpha;
+        break;
+    case AUDIO_BIQUAD_HIGHPASS:
+        b0 = (1 + cw) / 2;  b1 = -(1 + cw); b2 = (1 + cw) / 2;
+        a0 = 1 + alpha;     a1 = -2 * cw;   a2 = 1 - alpha;
+        break;
+    case AUDIO_BIQUAD_PEAKING:
+        b0 = 1 + alpha * A; b1 = -2 * cw; b2 = 1 - alpha * A;
+        a0 = 1 + alpha / A; a1 = -2 * cw; a2 = 1 - alpha / A;
+        break;
+    case AUDIO_BIQUAD_LOWSHELF: {
+        double s = 2 * sqrt(A) * alpha;
+        b0 = A * ((A + 1) - (A - 1) * cw + s);
+        b1 = 2 * A * ((A - 1) - (A + 1) * cw);
+        b2 = A * ((A + 1) - (A - 1) * cw - s);
+        a0 = (A + 1) + (A - 1) * cw + s;
+        a1 = -2 * ((A - 1) + (A + 1) * cw);
+        a2 = (A + 1) + (A - 1) * cw - s;
+        break;
+    }
+    case AUDIO_BIQUAD_HIGHSHELF:
+    default: {
+        double s = 2 * sqrt(A) * alpha;
+        b0 = A * ((A + 1) + (A - 1) * cw + s);
+        b1 = -2 * A * ((A - 1) + (A + 1) * cw);
+        b2 = A * ((A + 1) + (A - 1) * cw - s);
+        a0 = (A + 1) - (A - 1) * cw + s;
+        a1 = 2 * ((A - 1) - (A + 1) * cw);
+        a2 = (A + 1) - (A - 1) * cw - s;
+        break;
+    }
+    }
+    coef->b0 = eq_q28(b0 / a0);
+    coef->b1 = eq_q28(b1 / a0);
+    coef->b2 = eq_q28(b2 / a0);
+    coef->a1 = eq_q28(a1 / a0);
+    coef->a2 = eq_q28(a2 / a0);
+}
+
+audio_eq_t *audio_eq_create(int channels)
+{
+    if (channels < 1 || channels > AUDIO_EQ_MAX_CHANNELS) {
+        ESP_LOGE(EQ_TAG, "%d channels, at most %d", channels, AUDIO_EQ_MAX_CHANNELS);
+        return NULL;
+    }
+    audio_eq_t *eq = calloc(1, sizeof(audio_eq_t));
+    if (eq == NULL) {
+        return NULL;
+    }
+    eq->channels = channels;
+    portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+    eq->lock = lock;
+    return eq;
+}
+
+void audio_eq_destroy(audio_eq_t *eq)
+{
+    free(eq);
+}
+
+esp_err_t audio_eq_set_stages(audio_eq_t *eq, const audio_biquad_coef_t *coef, int n)
+{
+    if (n < 0 || n > AUDIO_EQ_MAX_STAGES || (n && coef == NULL)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    portENTER_CRITICAL(&eq->lock);
+    memcpy(eq->pending_coef, coef, n * sizeof(audio_biquad_coef_t));
+    eq->pending_stages = n;
+    eq->pending = 1;
+    portEXIT_CRITICAL(&eq->lock);
+    return ESP_OK;
+}
+
+esp_err_t audio_eq_load_nvs(audio_eq_t *eq, const char *key)
+{
+    nvs_handle handle;
+    eq_blob_t blob;
+    size_t len = sizeof(blob);
+
+    esp_err_t ret = nvs_open(EQ_NVS_NS, NVS_READONLY, &handle);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    ret = nvs_get_blob(handle, key ? key : EQ_BOARD_KEY, &blob, &len);
+    nvs_close(handle);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    if (blob.magic != EQ_BLOB_MAGIC || blob.stages > AUDIO_EQ_MAX_STAGES
+        || len != offsetof(eq_blob_t, coef) + blob.stages * sizeof(audio_biquad_coef_t)) {
+        ESP_LOGE(EQ_TAG, "bad EQ blob \"%s\"", key ? key : EQ_BOARD_KEY);
+        return ESP_ERR_INVALID_SIZE;
+    }
+    ESP_LOGI(EQ_TAG, "%d stages from \"%s\"", blob.stages, key ? key : EQ_BOARD_KEY);
+    return audio_eq_set_stages(eq, blob.coef, blob.stages);
+}
+
+esp_err_t audio_eq_save_nvs(const char *key, const audio_biquad_coef_t *coef, int n)
+{
+    nvs_handle handle;
+    eq_blob_t blob = { .magic = EQ_BLOB_MAGIC, .stages = n };
+
+    if (n < 0 || n > AUDIO_EQ_MAX_STAGES) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    memcpy(blob.coef, coef, n * sizeof(audio_biquad_coef_t));
+    esp_err_t ret = nvs_open(EQ_NVS_NS, NVS_READWRITE, &handle);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    ret = nvs_set_blob(handle, key ? key : EQ_BOARD_KEY, &blob,
+                       offsetof(eq_blob_t, coef) + n * sizeof(audio_biquad_coef_t));
+    if (ret == ESP_OK) {
+        ret = nvs_commit(handle);
+    }
+    nvs_close(handle);
+    return ret;
+}
+
+static inline int16_t eq_sat16(int64_t v)
+{
+    return v > INT16_MAX ? INT16_MAX : (v < INT16_MIN ? INT16_MIN : (int16_t)v);
+}
+
+/*
+ * One stage over the block with its coefficients and state in locals. Samples and products are
+ * Q15 x Q28, the states stay in that Q43 scale and only the output is rounded back to 16 bits.
+ */
+static void eq_biquad_block(const audio_biquad_coef_t *c, int64_t *state, int16_t *pcm, int frames, int stride)
+{
+    const int64_t b0 = c->b0, b1 = c->b1, b2 = c->b2, a1 = c->a1, a2 = c->a2;
+    int64_t s1 = state[0], s2 = state[1];
+    const int64_t round = 1 << (AUDIO_EQ_COEF_SHIFT - 1);
+
+    for (int i = 0; i < frames; i++, pcm += stride) {
+        int64_t x = *pcm;
+        int64_t acc = b0 * x + s1;
+        int16_t y = eq_sat16((acc + round) >> AUDIO_EQ_COEF_SHIFT);
+        // the feedback takes the unsaturated output, a clipped sample must not detune the filter
+        int64_t yf = acc >> AUDIO_EQ_COEF_SHIFT;
+        s1 = b1 * x - a1 * yf + s2;
+        s2 = b2 * x - a2 * yf;
+        *pcm = y;
+    }
+    state[0] = s1;
+    state[1] = s2;
+}
+
+void audio_eq_process(audio_eq_t *eq, int16_t *pcm, int frames)
+{
+    if (eq->pending) {
+        portENTER_CRITICAL(&eq->lock);
+        memcpy(eq->coef, eq->pending_coef, eq->pending_stages * sizeof(audio_biquad_coef_t));
+        eq->stages = eq->pending_stages;
+        eq->pending = 0;
+        portEXIT_CRITICAL(&eq->lock);
+        memset(eq->state, 0, sizeof(eq->state));
+    }
+    for (int s = 0; s < eq->stages; s++) {
+        for (int ch = 0; ch < eq->channels; ch++) {
+            eq_biquad_block(&eq->coef[s], eq->state[s][ch], pcm + ch, frames, eq->channels);
+        }
+    }
+}
+
+int audio_element_eq(void *ctx, uint8_t *in, int in_len, uint8_t *out, int out_len)
+{
+    audio_eq_t *eq = ctx;
+    int len = in_len < out_len ? in_len : out_len;
+    memcpy(out, in, len);
+    audio_eq_process(eq, (int16_t *)out, len / (int)(eq->channels * sizeof(int16_t)));
+    return len;
+}
@@ -0,0 +1,65 @@
+// Copyright 2018 Espressif Systems (Shanghai) PTE LTD
+// All rights reserved.
+
+#ifndef _AUDIO_EQ_H_
+#define _AUDIO_EQ_H_
+
+#include <stdint.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Cascaded biquads for speaker tuning, Direct Form II transposed on 16-bit interleaved PCM.
+ * Coefficients are Q28 (a1 and a2 with the sign of the difference equation y = b0 x + ... - a1 y1 - a2 y2),
+ * the states keep the full products, so a low frequency shelf does not drift.
+ */
+
+#define AUDIO_EQ_MAX_STAGES     8
+#define AUDIO_EQ_MAX_CHANNELS   2
+#define AUDIO_EQ_COEF_SHIFT     28
+
+typedef struct {
+    int32_t b0, b1, b2, a1, a2;
+} audio_biquad_coef_t;
+
+typedef enum {
+    AUDIO_BIQUAD_LOWPASS,
+    AUDIO_BIQUAD_HIGHPASS,
+    AUDIO_BIQUAD_PEAKING,
+    AUDIO_BIQUAD_LOWSHELF,
+    AUDIO_BIQUAD_HIGHSHELF,
+} audio_biquad_type_t;
+
+// RBJ audio EQ cookbook, gain_db is ignored by lowpass and highpass
+void audio_biquad_design(audio_biquad_type_t type, float fc, float q, float gain_db, int sample_rate,
+                         audio_biquad_coef_t *coef);
+
+typedef struct audio_eq audio_eq_t;
+
+audio_eq_t *audio_eq_create(int channels);
+void audio_eq_destroy(audio_eq_t *eq);
+
+// takes effect at the next audio_eq_process block, n 0 is a bypass
+esp_err_t audio_eq_set_stages(audio_eq_t *eq, const audio_biquad_coef_t *coef, int n);
+
+/*
+ * Stages stored as one blob in NVS namespace "audio_eq". key NULL is the key of the board selected
+ * in menuconfig, so one image carries the tuning of every board.
+ */
+esp_err_t audio_eq_load_nvs(audio_eq_t *eq, const char *key);
+esp_err_t audio_eq_save_nvs(const char *key, const audio_biquad_coef_t *coef, int n);
+
+// in place, frames samples per channel
+void audio_eq_process(audio_eq_t *eq, int16_t *pcm, int frames);
+
+// audio_pipeline stage, ctx is the audio_eq_t; in and out frames of the same size
+int audio_element_eq(void *ctx, uint8_t *in, int in_len, uint8_t *out, int out_len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
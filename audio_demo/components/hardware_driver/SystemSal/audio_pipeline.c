@@ -0,0 +1,279 @@
+// Copyright 2018 Espressif Systems (Shanghai) PTE LTD
+// All rights reserved.
+
+/**
+* \file
+*   Audio pipeline: a source, processing stages and a sink, each in its own task,
+*   linked by single producer / single consumer rings accessed in place
+*/
+#include <stdio.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "driver/i2s.h"
+#include "esp_log.h"
+#include "media_clock.h"
+#include "ringbuf.h"
+#include "audio_pipeline.h"
+
+#define AP_TAG "AUDIO_PIPE"
+
+/*
+ * The rings hold whole frames only, so an acquired frame is always contiguous. ts[] keeps, for each frame
+ * slot, the media time (media_clock_now) the source started the frame; every element copies it to the frame it makes
+ */
+typedef struct {
+    RingBuf *rb;
+    int frame_bytes;
+    int64_t *ts;
+} audio_link_t;
+
+typedef struct {
+    audio_element_cfg_t cfg;
+    audio_link_t *in;
+    audio_link_t *out;
+    struct audio_pipeline *pipe;
+    int index;
+} audio_element_t;
+
+struct audio_pipeline {
+    audio_element_t elements[AUDIO_PIPELINE_ELEMENT_MAX];
+    audio_link_t links[AUDIO_PIPELINE_ELEMENT_MAX - 1];
+    int count;
+    int ring_frames;
+    xSemaphoreHandle exit_sem;
+    xSemaphoreHandle stats_mux;
+    volatile int running;
+    volatile int done;
+    audio_pipeline_stats_t stats;
+    int64_t latency_sum;
+};
+
+static inline int link_slot(audio_link_t *l, uint8_t *ptr)
+{
+    return (ptr - l->rb->p_o) / l->frame_bytes;
+}
+
+static void audio_element_task(void *pv)
+{
+    audio_element_t *el = (audio_element_t *)pv;
+    struct audio_pipeline *p = el->pipe;
+    audio_link_t *in = el->in;
+    audio_link_t *out = el->out;
+    uint8_t *ip = NULL;
+    uint8_t *op = NULL;
+    int contig;
+
+    while (p->running) {
+        int64_t ts = 0;
+        if (in) {
+            int ret = rb_acquire_read(in->rb, in->frame_bytes, &ip, &contig, portMAX_DELAY);
+            if (ret < 0 || contig < in->frame_bytes) {
+                // aborted, or the element before ended and a partial frame is all that is left
+                break;
+            }
+            ts = in->ts[link_slot(in, ip)];
+        }
+        if (out) {
+            if (rb_acquire_write(out->rb, out->frame_bytes, &op, &contig, portMAX_DELAY) < 0) {
+                break;
+            }
+        }
+
+        int64_t start = media_clock_now();
+        if (!in) {
+            ts = start;
+        }
+        int ret = el->cfg.process(el->cfg.ctx, ip, in ? in->frame_bytes : 0, op, out ? out->frame_bytes : 0);
+        int64_t end = media_clock_now();
+
+        xSemaphoreTake(p->stats_mux, portMAX_DELAY);
+        p->stats.busy_us[el->index] += end - start;
+        if (!out && ret >= 0) {
+            int64_t latency = end - ts;
+            p->stats.frames++;
+            p->latency_sum += latency;
+            if (p->stats.frames == 1 || latency < p->stats.latency_min_us) {
+                p->stats.latency_min_us = latency;
+            }
+            if (latency > p->stats.latency_max_us) {
+                p->stats.latency_max_us = latency;
+            }
+        }
+        xSemaphoreGive(p->stats_mux);
+
+        if (ret < 0) {
+            break;
+        }
+        if (out) {
+            out->ts[link_slot(out, op)] = ts;
+            rb_commit_write(out->rb, out->frame_bytes);
+        }
+        if (in) {
+            rb_commit_read(in->rb, in->frame_bytes);
+        }
+    }
+
+    if (out) {
+        out->rb->releaseReadWait(out->rb);
+    } else if (p->running) {
+        p->done = 1;
+    }
+    xSemaphoreGive(p->exit_sem);
+    vTaskDelete(NULL);
+}
+
+audio_pipeline_t *audio_pipeline_create(const audio_element_cfg_t *elements, int count, int ring_frames)
+{
+    if (elements == NULL || count < 2 || count > AUDIO_PIPELINE_ELEMENT_MAX || ring_frames < 2) {
+        ESP_LOGE(AP_TAG, "invalid pipeline, %d elements, %d frames\n", count, ring_frames);
+        return NULL;
+    }
+    for (int i = 0; i < count; i++) {
+        if (elements[i].process == NULL || (i < count - 1 && elements[i].out_frame_bytes <= 0)) {
+            ESP_LOGE(AP_TAG, "element %d has no process or no output frame\n", i);
+            return NULL;
+        }
+    }
+
+    struct audio_pipeline *p = calloc(1, sizeof(struct audio_pipeline));
+    if (p == NULL) {
+        ESP_LOGE(AP_TAG, "no memory for the pipeline\n");
+        return NULL;
+    }
+    p->count = count;
+    p->ring_frames = ring_frames;
+    p->exit_sem = xSemaphoreCreateCounting(AUDIO_PIPELINE_ELEMENT_MAX, 0);
+    p->stats_mux = xSemaphoreCreateMutex();
+    if (p->exit_sem == NULL || p->stats_mux == NULL) {
+        goto err;
+    }
+
+    for (int i = 0; i < count - 1; i++) {
+        audio_link_t *l = &p->links[i];
+        l->frame_bytes = elements[i].out_frame_bytes;
+        l->rb = rb_init_spsc(BUFFER_PROCESS, l->frame_bytes * ring_frames, l->frame_bytes);
+        l->ts = calloc(ring_frames, sizeof(int64_t));
+        if (l->rb == NULL || l->ts == NULL) {
+            goto err;
+        }
+    }
+    for (int i = 0; i < count; i++) {
+        audio_element_t *el = &p->elements[i];
+        el->cfg = elements[i];
+        el->in = (i > 0) ? &p->links[i - 1] : NULL;
+        el->out = (i < count - 1) ? &p->links[i] : NULL;
+        el->pipe = p;
+        el->index = i;
+    }
+    return p;
+
+err:
+    ESP_LOGE(AP_TAG, "no memory for the pipeline rings\n");
+    audio_pipeline_destroy(p);
+    return NULL;
+}
+
+int audio_pipeline_run(audio_pipeline_t *p)
+{
+    if (p == NULL || p->running) {
+        return -1;
+    }
+    for (int i = 0; i < p->count - 1; i++) {
+        rb_reset(p->links[i].rb);
+    }
+    memset(&p->stats, 0, sizeof(p->stats));
+    p->latency_sum = 0;
+    p->done = 0;
+    p->running = 1;
+
+    // the sink first, so every ring has its reader before data arrives
+    for (int i = p->count - 1; i >= 0; i--) {
+        audio_element_t *el = &p->elements[i];
+        if (pdPASS != xTaskCreatePinnedToCore(audio_element_task, el->cfg.name ? el->cfg.name : "audio_el",
+                                              el->cfg.stack_size ? el->cfg.stack_size : 3 * 1024, el,
+                                              el->cfg.priority, NULL, el->cfg.core)) {
+            ESP_LOGE(AP_TAG, "create task of element %d failed\n", i);
+            p->running = 0;
+            for (int j = 0; j < p->count - 1; j++) {
+                rb_abort(p->links[j].rb, 1);
+            }
+            for (int j = p->count - 1; j > i; j--) {
+                xSemaphoreTake(p->exit_sem, portMAX_DELAY);
+            }
+            return -1;
+        }
+    }
+    return 0;
+}
+
+int audio_pipeline_stop(audio_pipeline_t *p)
+{
+    if (p == NULL || !p->running) {
+        return -1;
+    }
+    p->running = 0;
+    for (int i = 0; i < p->count - 1; i++) {
+        rb_abort(p->links[i].rb, 1);
+    }
+    for (int i = 0; i < p->count; i++) {
+        xSemaphoreTake(p->exit_sem, portMAX_DELAY);
+    }
+    return 0;
+}
+
+int audio_pipeline_is_done(audio_pipeline_t *p)
+{
+    return p ? p->done : 0;
+}
+
+void audio_pipeline_destroy(audio_pipeline_t *p)
+{
+    if (p == NULL)
+        return;
+    if (p->running) {
+        audio_pipeline_stop(p);
+    }
+    for (int i = 0; i < AUDIO_PIPELINE_ELEMENT_MAX - 1; i++) {
+        if (p->links[i].rb) {
+            rb_unint(p->links[i].rb);
+        }
+        free(p->links[i].ts);
+    }
+    if (p->exit_sem) {
+        vSemaphoreDelete(p->exit_sem);
+    }
+    if (p->stats_mux) {
+        vSemaphoreDelete(p->stats_mux);
+    }
+    free(p);
+}
+
+void audio_pipeline_get_stats(audio_pipeline_t *p, audio_pipeline_stats_t *stats)
+{
+    if (p == NULL || stats == NULL)
+        return;
+    xSemaphoreTake(p->stats_mux, portMAX_DELAY);
+    *stats = p->stats;
+    stats->latency_avg_us = p->stats.frames ? p->latency_sum / p->stats.frames : 0;
+    xSemaphoreGive(p->stats_mux);
+}
+
+int audio_element_i2s_read(void *ctx, uint8_t *in, int in_len, uint8_t *out, int out_len)
+{
+    size_t bytes_read = 0;
+    if (i2s_read((i2s_port_t)(intptr_t)ctx, out, out_len, &bytes_read, portMAX_DELAY) != ESP_OK) {
+        return -1;
+    }
+    return bytes_read;
+}
+
+int audio_element_i2s_write(void *ctx, uint8_t *in, int in_len, uint8_t *out, int out_len)
+{
+    size_t bytes_written = 0;
+    if (i2s_write((i2s_port_t)(intptr_t)ctx, in, in_len, &bytes_written, portMAX_DELAY) != ESP_OK) {
+        return -1;
+    }
+    return bytes_written;
+}
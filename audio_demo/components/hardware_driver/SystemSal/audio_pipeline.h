@@ -0,0 +1,61 @@
+// Copyright 2018 Espressif Systems (Shanghai) PTE LTD
+// All rights reserved.
+
+#ifndef _AUDIO_PIPELINE_H_
+#define _AUDIO_PIPELINE_H_
+
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define AUDIO_PIPELINE_ELEMENT_MAX 8
+
+/*
+ * Process one frame, in is NULL for the source element and out is NULL for the sink.
+ * Both point into the rings between the elements, so a stage works in place without copies.
+ * return: >= 0 go on, < 0 end of stream (the elements after it drain and stop)
+ */
+typedef int (*audio_element_process_t)(void *ctx, uint8_t *in, int in_len, uint8_t *out, int out_len);
+
+typedef struct {
+    const char *name;
+    audio_element_process_t process;
+    void *ctx;
+    int out_frame_bytes;    // bytes of an output frame, 0 for the sink
+    int stack_size;         // 0: 3 KB
+    int priority;
+    int core;               // tskNO_AFFINITY for any
+} audio_element_cfg_t;
+
+typedef struct {
+    uint32_t frames;        // frames that reached the sink
+    int64_t latency_min_us; // source start of a frame to the sink end of it
+    int64_t latency_avg_us;
+    int64_t latency_max_us;
+    int64_t busy_us[AUDIO_PIPELINE_ELEMENT_MAX]; // time spent in each process callback
+} audio_pipeline_stats_t;
+
+typedef struct audio_pipeline audio_pipeline_t;
+
+// source -> stages -> sink, count >= 2, one task per element, linked by SPSC rings of ring_frames frames
+audio_pipeline_t *audio_pipeline_create(const audio_element_cfg_t *elements, int count, int ring_frames);
+int audio_pipeline_run(audio_pipeline_t *p);
+// abort the rings and wait for every element task to leave, then run can be called again
+int audio_pipeline_stop(audio_pipeline_t *p);
+// return 1 after the end of stream reached the sink, audio_pipeline_stop still has to be called
+int audio_pipeline_is_done(audio_pipeline_t *p);
+void audio_pipeline_destroy(audio_pipeline_t *p);
+void audio_pipeline_get_stats(audio_pipeline_t *p, audio_pipeline_stats_t *stats);
+
+// Ready made I2S elements, ctx is the i2s_port_t, the driver has to be installed (MediaHalInit does it)
+int audio_element_i2s_read(void *ctx, uint8_t *in, int in_len, uint8_t *out, int out_len);
+int audio_element_i2s_write(void *ctx, uint8_t *in, int in_len, uint8_t *out, int out_len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
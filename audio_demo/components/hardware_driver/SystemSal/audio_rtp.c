@@ -0,0 +1,376 @@
+// Copyright 2018 Espressif Systems (Shanghai) PTE LTD
+// All rights reserved.
+
+/**
+* \file
+*   RTP over UDP: the send sink and the jitter buffered receive source of the audio pipeline
+*/
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_system.h"
+#include "lwip/sockets.h"
+#include "audio_encoder.h"
+#include "audio_rtp.h"
+
+#define RTP_TAG "AUDIO_RTP"
+
+#define RTP_HEADER_BYTES 12
+#define RTP_HEADER_MAX   (RTP_HEADER_BYTES + 15 * 4 + 64)  // CSRCs and a short extension
+#define RTP_RX_SLOTS     16                                // power of 2, packets by sequence number
+
+struct audio_rtp_tx {
+    int sock;
+    struct sockaddr_in dest;
+    uint8_t payload_type;
+    uint8_t marker;         // first packet of the talk spurt
+    uint16_t seq;
+    uint32_t timestamp;
+    uint32_t ssrc;
+    int frame_samples;
+    uint32_t errors;
+};
+
+typedef struct {
+    uint8_t *buf;           // the whole packet as received
+    uint16_t seq;
+    uint8_t offset;         // payload start
+    uint8_t valid;
+} rtp_slot_t;
+
+struct audio_rtp_rx {
+    audio_rtp_rx_cfg_t cfg;
+    int sock;
+    int buf_size;
+    rtp_slot_t slot[RTP_RX_SLOTS];
+    uint8_t *spare;         // the next recv goes here, then it swaps with the slot of its sequence number
+    xSemaphoreHandle lock;
+    xSemaphoreHandle data_sem;
+    xSemaphoreHandle exit_sem;
+    volatile int running;
+    int playing;
+    uint16_t next;          // sequence number played next
+    uint16_t newest;
+    int missing;            // packets in a row played as silence
+    TickType_t wait;        // half a frame, how long a missing packet is waited for
+    audio_rtp_rx_stats_t stats;
+};
+
+static inline void rtp_put16(uint8_t *p, uint16_t v)
+{
+    p[0] = v >> 8;
+    p[1] = v & 0xFF;
+}
+
+static inline void rtp_put32(uint8_t *p, uint32_t v)
+{
+    p[0] = v >> 24;
+    p[1] = (v >> 16) & 0xFF;
+    p[2] = (v >> 8) & 0xFF;
+    p[3] = v & 0xFF;
+}
+
+audio_rtp_tx_t *audio_rtp_tx_create(const audio_rtp_tx_cfg_t *cfg)
+{
+    if (cfg == NULL || cfg->host == NULL || cfg->frame_samples <= 0) {
+        return NULL;
+    }
+    audio_rtp_tx_t *tx = calloc(1, sizeof(audio_rtp_tx_t));
+    if (tx == NULL) {
+        return NULL;
+    }
+    tx->dest.sin_family = AF_INET;
+    tx->dest.sin_port = htons(cfg->port);
+    if (inet_aton(cfg->host, &tx->dest.sin_addr) == 0) {
+        ESP_LOGE(RTP_TAG, "bad receiver address %s\n", cfg->host);
+        free(tx);
+        return NULL;
+    }
+    tx->sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (tx->sock < 0) {
+        ESP_LOGE(RTP_TAG, "udp socket failed\n");
+        free(tx);
+        return NULL;
+    }
+    // random starting points, as RFC 3550 asks
+    tx->seq = esp_random();
+    tx->timestamp = esp_random();
+    tx->ssrc = esp_random();
+    tx->payload_type = cfg->payload_type ? cfg->payload_type : 96;
+    tx->marker = 1;
+    tx->frame_samples = cfg->frame_samples;
+    return tx;
+}
+
+void audio_rtp_tx_destroy(audio_rtp_tx_t *tx)
+{
+    if (tx == NULL) {
+        return;
+    }
+    close(tx->sock);
+    free(tx);
+}
+
+int audio_element_rtp_send(void *ctx, uint8_t *in, int in_len, uint8_t *out, int out_len)
+{
+    audio_rtp_tx_t *tx = (audio_rtp_tx_t *)ctx;
+    uint8_t header[RTP_HEADER_BYTES];
+    header[0] = 0x80;   // version 2, no padding, extension or CSRC
+    header[1] = (tx->marker << 7) | tx->payload_type;
+    rtp_put16(header + 2, tx->seq);
+    rtp_put32(header + 4, tx->timestamp);
+    rtp_put32(header + 8, tx->ssrc);
+
+    // the payload is sent from the ring slot, lwIP copies header and frame into one pbuf
+    struct iovec iov[2] = {
+        { .iov_base = header, .iov_len = sizeof(header) },
+        { .iov_base = in, .iov_len = in_len },
+    };
+    struct msghdr msg = {
+        .msg_name = &tx->dest,
+        .msg_namelen = sizeof(tx->dest),
+        .msg_iov = iov,
+        .msg_iovlen = 2,
+    };
+    if (sendmsg(tx->sock, &msg, 0) < 0) {
+        // a lost packet is concealed by the receiver, the pipeline goes on
+        tx->errors++;
+    }
+    tx->marker = 0;
+    tx->seq++;
+    tx->timestamp += tx->frame_samples;
+    return 0;
+}
+
+// under rx->lock: forget every packet and wait for depth new ones
+static void rtp_rx_reset(audio_rtp_rx_t *rx)
+{
+    for (int i = 0; i < RTP_RX_SLOTS; i++) {
+        rx->slot[i].valid = 0;
+    }
+    rx->playing = 0;
+    rx->missing = 0;
+}
+
+// under rx->lock, not playing yet: start once depth packets up to newest are in, from the oldest of them
+static void rtp_rx_try_start(audio_rtp_rx_t *rx)
+{
+    int count = 0;
+    uint16_t oldest = rx->newest;
+    for (int i = 0; i < RTP_RX_SLOTS; i++) {
+        rtp_slot_t *s = &rx->slot[i];
+        int16_t age = rx->newest - s->seq;
+        if (s->valid && age >= 0 && age < RTP_RX_SLOTS) {
+            count++;
+            if ((int16_t)(s->seq - oldest) < 0) {
+                oldest = s->seq;
+            }
+        }
+    }
+    if (count >= rx->cfg.depth) {
+        rx->playing = 1;
+        rx->next = oldest;
+    }
+}
+
+static int rtp_rx_parse(audio_rtp_rx_t *rx, const uint8_t *p, int len, uint16_t *seq)
+{
+    if (len < RTP_HEADER_BYTES || (p[0] >> 6) != 2 || (p[1] & 0x7F) != rx->cfg.payload_type) {
+        return -1;
+    }
+    int offset = RTP_HEADER_BYTES + (p[0] & 0x0F) * 4;
+    if ((p[0] & 0x10) && len >= offset + 4) {
+        offset += 4 + ((p[offset + 2] << 8) | p[offset + 3]) * 4;
+    }
+    if (len - offset != rx->cfg.frame_bytes) {
+        return -1;
+    }
+    *seq = (p[2] << 8) | p[3];
+    return offset;
+}
+
+static void rtp_rx_task(void *pv)
+{
+    audio_rtp_rx_t *rx = (audio_rtp_rx_t *)pv;
+    while (rx->running) {
+        int len = recv(rx->sock, rx->spare, rx->buf_size, 0);
+        uint16_t seq;
+        int offset = len > 0 ? rtp_rx_parse(rx, rx->spare, len, &seq) : -1;
+        if (offset < 0) {
+            continue; // timeout, or not ours
+        }
+        xSemaphoreTake(rx->lock, portMAX_DELAY);
+        rx->stats.received++;
+        int16_t ahead = seq - rx->next;
+        if (rx->playing && ahead < 0) {
+            rx->stats.late++;
+            xSemaphoreGive(rx->lock);
+            continue;
+        }
+        if (rx->playing && ahead >= RTP_RX_SLOTS) {
+            // the sender restarted or the link was away for a while
+            rtp_rx_reset(rx);
+        }
+        rtp_slot_t *s = &rx->slot[seq & (RTP_RX_SLOTS - 1)];
+        uint8_t *buf = s->buf;
+        s->buf = rx->spare;
+        rx->spare = buf;
+        s->seq = seq;
+        s->offset = offset;
+        s->valid = 1;
+        if (!rx->playing || (int16_t)(seq - rx->newest) > 0) {
+            rx->newest = seq;
+        }
+        if (!rx->playing) {
+            rtp_rx_try_start(rx);
+        }
+        xSemaphoreGive(rx->lock);
+        xSemaphoreGive(rx->data_sem);
+    }
+    xSemaphoreGive(rx->exit_sem);
+    vTaskDelete(NULL);
+}
+
+int audio_element_rtp_receive(void *ctx, uint8_t *in, int in_len, uint8_t *out, int out_len)
+{
+    audio_rtp_rx_t *rx = (audio_rtp_rx_t *)ctx;
+    xSemaphoreTake(rx->lock, portMAX_DELAY);
+    if (!rx->playing) {
+        // buffering: feed the sink silence at about the frame rate
+        xSemaphoreGive(rx->lock);
+        xSemaphoreTake(rx->data_sem, rx->wait * 2);
+        memset(out, 0, out_len);
+        return 0;
+    }
+    // more than twice depth waiting: the sender clock is faster, skip the oldest
+    while ((int16_t)(rx->newest - rx->next) >= rx->cfg.depth * 2) {
+        rx->slot[rx->next & (RTP_RX_SLOTS - 1)].valid = 0;
+        rx->next++;
+        rx->stats.dropped++;
+    }
+    rtp_slot_t *s = &rx->slot[rx->next & (RTP_RX_SLOTS - 1)];
+    if (!s->valid || s->seq != rx->next) {
+        xSemaphoreGive(rx->lock);
+        xSemaphoreTake(rx->data_sem, rx->wait);
+        xSemaphoreTake(rx->lock, portMAX_DELAY);
+    }
+    if (rx->playing && s->valid && s->seq == rx->next) {
+        if (rx->cfg.adpcm) {
+            audio_adpcm_decode_block(s->buf + s->offset, rx->cfg.frame_bytes, (int16_t *)out);
+        } else {
+            memcpy(out, s->buf + s->offset, out_len < rx->cfg.frame_bytes ? out_len : rx->cfg.frame_bytes);
+        }
+        s->valid = 0;
+        rx->missing = 0;
+    } else {
+        memset(out, 0, out_len);
+        rx->stats.lost++;
+        // nothing came for depth packets: buffer up again instead of playing silence forever
+        if (++rx->missing >= rx->cfg.depth && (int16_t)(rx->newest - rx->next) <= 0) {
+            rtp_rx_reset(rx);
+        }
+    }
+    rx->next++;
+    xSemaphoreGive(rx->lock);
+    return 0;
+}
+
+void audio_rtp_rx_get_stats(audio_rtp_rx_t *rx, audio_rtp_rx_stats_t *stats)
+{
+    if (rx == NULL || stats == NULL) {
+        return;
+    }
+    xSemaphoreTake(rx->lock, portMAX_DELAY);
+    *stats = rx->stats;
+    xSemaphoreGive(rx->lock);
+}
+
+void audio_rtp_rx_destroy(audio_rtp_rx_t *rx)
+{
+    if (rx == NULL) {
+        return;
+    }
+    if (rx->running) {
+        rx->running = 0;
+        xSemaphoreTake(rx->exit_sem, portMAX_DELAY);
+    }
+    if (rx->sock >= 0) {
+        close(rx->sock);
+    }
+    for (int i = 0; i < RTP_RX_SLOTS; i++) {
+        free(rx->slot[i].buf);
+    }
+    free(rx->spare);
+    if (rx->lock) {
+        vSemaphoreDelete(rx->lock);
+    }
+    if (rx->data_sem) {
+        vSemaphoreDelete(rx->data_sem);
+    }
+    if (rx->exit_sem) {
+        vSemaphoreDelete(rx->exit_sem);
+    }
+    free(rx);
+}
+
+audio_rtp_rx_t *audio_rtp_rx_create(const audio_rtp_rx_cfg_t *cfg)
+{
+    if (cfg == NULL || cfg->frame_bytes <= 0 || cfg->frame_samples <= 0 || cfg->sample_rate <= 0) {
+        return NULL;
+    }
+    audio_rtp_rx_t *rx = calloc(1, sizeof(audio_rtp_rx_t));
+    if (rx == NULL) {
+        return NULL;
+    }
+    rx->cfg = *cfg;
+    rx->cfg.payload_type = cfg->payload_type ? cfg->payload_type : 96;
+    rx->cfg.depth = cfg->depth > 0 ? cfg->depth : 3;
+    if (rx->cfg.depth * 2 > RTP_RX_SLOTS) {
+        rx->cfg.depth = RTP_RX_SLOTS / 2;
+    }
+    rx->wait = (TickType_t)cfg->frame_samples * 1000 / cfg->sample_rate / 2 / portTICK_PERIOD_MS + 1;
+    rx->buf_size = RTP_HEADER_MAX + cfg->frame_bytes;
+    rx->sock = -1;
+    for (int i = 0; i < RTP_RX_SLOTS; i++) {
+        rx->slot[i].buf = malloc(rx->buf_size);
+        if (rx->slot[i].buf == NULL) {
+            goto err;
+        }
+    }
+    rx->spare = malloc(rx->buf_size);
+    rx->lock = xSemaphoreCreateMutex();
+    rx->data_sem = xSemaphoreCreateBinary();
+    rx->exit_sem = xSemaphoreCreateBinary();
+    if (rx->spare == NULL || rx->lock == NULL || rx->data_sem == NULL || rx->exit_sem == NULL) {
+        goto err;
+    }
+
+    struct sockaddr_in addr = {
+        .sin_family = AF_INET,
+        .sin_port = htons(cfg->port),
+        .sin_addr.s_addr = htonl(INADDR_ANY),
+    };
+    // a short receive timeout lets the task see destroy
+    struct timeval timeout = { .tv_sec = 0, .tv_usec = 100 * 1000 };
+    rx->sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (rx->sock < 0 || bind(rx->sock, (struct sockaddr *)&addr, sizeof(addr)) != 0) {
+        ESP_LOGE(RTP_TAG, "udp port %d bind failed\n", cfg->port);
+        goto err;
+    }
+    setsockopt(rx->sock, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    rx->running = 1;
+    if (pdPASS != xTaskCreate(rtp_rx_task, "rtp_rx", 3 * 1024, rx, cfg->priority, NULL)) {
+        rx->running = 0;
+        goto err;
+    }
+    return rx;
+
+err:
+    ESP_LOGE(RTP_TAG, "rtp receiver create failed\n");
+    audio_rtp_rx_destroy(rx);
+    return NULL;
+}
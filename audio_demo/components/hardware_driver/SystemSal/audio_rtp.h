@@ -0,0 +1,64 @@
+// Copyright 2018 Espressif Systems (Shanghai) PTE LTD
+// All rights reserved.
+
+#ifndef _AUDIO_RTP_H_
+#define _AUDIO_RTP_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * RTP over UDP for an intercom between two boards. The send side is the sink of the mic pipeline: every
+ * frame (PCM, or an audio_encoder frame) becomes one packet, sequence +1 and timestamp + frame_samples.
+ * The receive side is the source of a playback pipeline in front of audio_element_i2s_write: packets go
+ * into a jitter buffer by sequence number, playback starts once depth packets are in, a packet that is
+ * not there in time is played as silence, and when the buffer grows past twice depth (clock drift) the
+ * oldest packets are dropped to keep the delay down.
+ */
+typedef struct audio_rtp_tx audio_rtp_tx_t;
+typedef struct audio_rtp_rx audio_rtp_rx_t;
+
+typedef struct {
+    const char *host;       // receiver IPv4 address
+    uint16_t port;
+    uint8_t payload_type;   // 0: 96, the first dynamic type
+    int frame_samples;      // samples per packet
+} audio_rtp_tx_cfg_t;
+
+typedef struct {
+    uint16_t port;
+    uint8_t payload_type;   // 0: 96, other types are ignored
+    int frame_bytes;        // payload of a packet
+    int frame_samples;      // samples per packet, the output frame is frame_samples * 2 bytes
+    int sample_rate;        // paces the wait for a missing packet
+    int adpcm;              // 1: the payload is an IMA ADPCM block of frame_bytes, decoded here
+    int depth;              // packets buffered before playback, 0: 3
+    int priority;           // receive task
+} audio_rtp_rx_cfg_t;
+
+typedef struct {
+    uint32_t received;
+    uint32_t lost;          // played as silence
+    uint32_t late;          // arrived after their play time
+    uint32_t dropped;       // dropped to bring the delay back to depth
+} audio_rtp_rx_stats_t;
+
+audio_rtp_tx_t *audio_rtp_tx_create(const audio_rtp_tx_cfg_t *cfg);
+void audio_rtp_tx_destroy(audio_rtp_tx_t *tx);
+// audio_pipeline sink, ctx is the audio_rtp_tx_t
+int audio_element_rtp_send(void *ctx, uint8_t *in, int in_len, uint8_t *out, int out_len);
+
+audio_rtp_rx_t *audio_rtp_rx_create(const audio_rtp_rx_cfg_t *cfg);
+void audio_rtp_rx_destroy(audio_rtp_rx_t *rx);
+void audio_rtp_rx_get_stats(audio_rtp_rx_t *rx, audio_rtp_rx_stats_t *stats);
+// audio_pipeline source, ctx is the audio_rtp_rx_t, out_frame_bytes = frame_samples * 2
+int audio_element_rtp_receive(void *ctx, uint8_t *in, int in_len, uint8_t *out, int out_len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,95 @@
+// Copyright 2018 Espressif Systems (Shanghai) PTE LTD
+// All rights reserved.
+
+/**
+* \file
+*   Boot state of the external DSPs: poll for the firmware to come up instead of a fixed sleep,
+*   and remember in NVS which image was loaded, so a warm boot can skip the upload
+*/
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "nvs.h"
+#include "nvs_flash.h"
+#include "dsp_boot_state.h"
+
+#define DSP_BOOT_TAG "DSP_BOOT"
+#define DSP_BOOT_NAMESPACE "dsp_boot"
+
+uint32_t dsp_boot_hash(uint32_t hash, const void *data, size_t len)
+{
+    const uint8_t *p = (const uint8_t *)data;
+    while (len--) {
+        hash ^= *p++;
+        hash *= 0x01000193u;
+    }
+    return hash;
+}
+
+int dsp_boot_wait(dsp_boot_poll_t poll, void *ctx, int timeout_ms, int interval_ms)
+{
+    TickType_t start = xTaskGetTickCount();
+    TickType_t interval = interval_ms / portTICK_PERIOD_MS;
+    int ret;
+
+    if (interval == 0) {
+        interval = 1;
+    }
+    while ((ret = poll(ctx)) == 0) {
+        if ((int)((xTaskGetTickCount() - start) * portTICK_PERIOD_MS) >= timeout_ms) {
+            break;
+        }
+        vTaskDelay(interval);
+    }
+    ESP_LOGD(DSP_BOOT_TAG, "state %d after %d ms", ret, (int)((xTaskGetTickCount() - start) * portTICK_PERIOD_MS));
+    return ret;
+}
+
+static esp_err_t dsp_boot_open(nvs_open_mode open_mode, nvs_handle *handle)
+{
+    esp_err_t err = nvs_open(DSP_BOOT_NAMESPACE, open_mode, handle);
+    if (err == ESP_ERR_NVS_NOT_INITIALIZED) {
+        // the DSP may come up before the application touched NVS
+        err = nvs_flash_init();
+        if (err == ESP_OK) {
+            err = nvs_open(DSP_BOOT_NAMESPACE, open_mode, handle);
+        }
+    }
+    return err;
+}
+
+int dsp_boot_record_get(const char *key, dsp_boot_record_t *rec)
+{
+    nvs_handle handle;
+    size_t len = sizeof(dsp_boot_record_t);
+
+    if (dsp_boot_open(NVS_READONLY, &handle) != ESP_OK) {
+        return -1;
+    }
+    esp_err_t err = nvs_get_blob(handle, key, rec, &len);
+    nvs_close(handle);
+    if (err != ESP_OK || len != sizeof(dsp_boot_record_t)) {
+        return -1;
+    }
+    return 0;
+}
+
+int dsp_boot_record_set(const char *key, const dsp_boot_record_t *rec)
+{
+    nvs_handle handle;
+    esp_err_t err = dsp_boot_open(NVS_READWRITE, &handle);
+
+    if (err == ESP_OK) {
+        err = nvs_set_blob(handle, key, rec, sizeof(dsp_boot_record_t));
+        if (err == ESP_OK) {
+            err = nvs_commit(handle);
+        }
+        nvs_close(handle);
+    }
+    if (err != ESP_OK) {
+        ESP_LOGE(DSP_BOOT_TAG, "save %s failed, %d", key, err);
+        return -1;
+    }
+    return 0;
+}
@@ -0,0 +1,44 @@
+// Copyright 2018 Espressif Systems (Shanghai) PTE LTD
+// All rights reserved.
+
+#ifndef _DSP_BOOT_STATE_H_
+#define _DSP_BOOT_STATE_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DSP_BOOT_HASH_INIT  0x811c9dc5u     // FNV-1a offset basis
+#define DSP_BOOT_IN_FLASH   0x01            // the DSP keeps the image in its own flash and boots it by itself
+
+// What was last loaded into a DSP, kept in NVS across resets
+typedef struct {
+    uint32_t hash;
+    uint32_t flags;
+} dsp_boot_record_t;
+
+/*
+ * Check the DSP state once.
+ * return: < 0 error, 0 not up yet, > 0 a driver defined "up" state
+ */
+typedef int (*dsp_boot_poll_t)(void *ctx);
+
+// FNV-1a over data, chain calls starting from DSP_BOOT_HASH_INIT
+uint32_t dsp_boot_hash(uint32_t hash, const void *data, size_t len);
+
+// Poll every interval_ms until poll returns != 0 or timeout_ms passed, timeout_ms 0 polls once.
+// return: the last poll result, 0 on timeout
+int dsp_boot_wait(dsp_boot_poll_t poll, void *ctx, int timeout_ms, int interval_ms);
+
+// return: 0 record read, -1 nothing stored under key (at most 15 characters)
+int dsp_boot_record_get(const char *key, dsp_boot_record_t *rec);
+int dsp_boot_record_set(const char *key, const dsp_boot_record_t *rec);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -15,6 +15,8 @@
 #include "esp_log.h"
 #include "esp_err.h"
 #include "EspAudioAlloc.h"
+#include "trace.h"
+#include "mem_place.h"
 
 #define RB_TAG "RINGBUF"
 
@@ -38,7 +40,8 @@ RingBuf *rb_init(BufferTag tag, int32_t size, int32_t block_size, xSemaphoreHand
     if (size % block_size != 0) return NULL;
     r = malloc(sizeof(RingBuf));
     configASSERT(r);
-    buf = EspAudioAlloc(1, size);
+    // only bytes written into it are ever read
+    buf = EspAudioMalloc(size, 0, 0);
     configASSERT(buf);
 
     r->p_o = r->p_r = r->p_w = buf;
@@ -58,12 +61,57 @@ RingBuf *rb_init(BufferTag tag, int32_t size, int32_t block_size, xSemaphoreHand
     r->abort = 0;
 
     r->releaseReadWait = rb_releaseReadWait;
+    r->spsc = 0;
+    r->rd_pos = r->wr_pos = 0;
+    r->rd_wait = r->wr_wait = 0;
     return r;
 }
 
+/**
+* \brief init a RingBuf object for exactly one reader task and one writer task
+* \return the RingBuf, NULL if failed
+*/
+RingBuf *rb_init_spsc(BufferTag tag, int32_t size, int32_t block_size)
+{
+    RingBuf *r = rb_init(tag, size, block_size, NULL);
+    if (r == NULL) return NULL;
+    /* the mux is kept for rb_abort and rb_unint only */
+    r->spsc = 1;
+    return r;
+}
+
+/* filled bytes, the positions run over [0, 2 * size) so a full buffer differs from an empty one */
+static inline int32_t rb_spsc_count(RingBuf *r, uint32_t rd, uint32_t wr)
+{
+    return (wr >= rd) ? (wr - rd) : (wr + 2 * r->size - rd);
+}
+
+static inline uint32_t rb_spsc_advance(RingBuf *r, uint32_t pos, int32_t len)
+{
+    pos += len;
+    return (pos >= 2 * r->size) ? pos - 2 * r->size : pos;
+}
+
+/* copy len bytes at pos into buf (to_ring == 0) or from buf to pos, in two parts at the end of the buffer */
+static inline void rb_spsc_copy(RingBuf *r, uint32_t pos, uint8_t *buf, int32_t len, int to_ring)
+{
+    uint32_t idx = (pos >= r->size) ? pos - r->size : pos;
+    int32_t len1 = r->size - idx;
+    if (len1 > len) len1 = len;
+    if (to_ring) {
+        memcpy(r->p_o + idx, buf, len1);
+        memcpy(r->p_o, buf + len1, len - len1);
+        mem_place_bw_copy(MEM_PLACE_BW_AUDIO, r->p_o, buf, len);
+    } else {
+        memcpy(buf, r->p_o + idx, len1);
+        memcpy(buf + len1, r->p_o, len - len1);
+        mem_place_bw_copy(MEM_PLACE_BW_AUDIO, buf, r->p_o, len);
+    }
+}
+
 void rb_unint(RingBuf *rb)
 {
-    free(rb->p_o);
+    EspAudioFree(rb->p_o);
     rb->p_o = NULL;
     vSemaphoreDelete(rb->can_read);
     rb->can_read = NULL;
@@ -81,6 +129,7 @@ void rb_reset(RingBuf *rb)
         return;
     rb->p_r = rb->p_w = rb->p_o;
     rb->fill_cnt = 0;
+    rb->rd_pos = rb->wr_pos = 0;
     rb->_doneWrite = 0;
     rb_abort(rb, 0);
 }
@@ -90,14 +139,124 @@ void rb_reset(RingBuf *rb)
  */
 int32_t rb_available(RingBuf *r)
 {
+    if (r->spsc)
+        return (r->size - rb_spsc_count(r, r->rd_pos, r->wr_pos));
     return (r->size - r->fill_cnt);
 }
 
+/*
+ * @brief: the reader publishes rd_pos after the copy and the writer wr_pos, a side about to block sets its
+ *         wait flag and looks at the other position again, the full barriers order the flag against it
+ */
+static int rb_read_spsc(RingBuf *r, uint8_t *buf, int buf_len, TickType_t ticks_to_wait)
+{
+    int read_size, remainder;
+    int total_read_size = 0;
+    uint32_t rd = r->rd_pos;
+
+    while (buf_len) {
+        int32_t fill = rb_spsc_count(r, rd, __atomic_load_n(&r->wr_pos, __ATOMIC_ACQUIRE));
+        if (fill < buf_len) {
+            remainder = (r->_doneWrite == 0) ? fill % 4 : 0;
+            read_size = fill - remainder;
+        } else {
+            read_size = buf_len;
+        }
+        if (read_size > 0) {
+            rb_spsc_copy(r, rd, buf, read_size, 0);
+            rd = rb_spsc_advance(r, rd, read_size);
+            __atomic_store_n(&r->rd_pos, rd, __ATOMIC_RELEASE);
+            __atomic_thread_fence(__ATOMIC_SEQ_CST);
+            if (r->wr_wait) {
+                r->wr_wait = 0;
+                xSemaphoreGive(r->can_write);
+            }
+            buf_len -= read_size;
+            total_read_size += read_size;
+            buf += read_size;
+        }
+        if (buf_len == 0) {
+            break;
+        }
+        if (r->abort == 1) {
+            total_read_size = -1;
+            break;
+        }
+        if ((r->_doneWrite == 1)
+            && (rb_spsc_count(r, rd, r->wr_pos) == 0)) {
+            break;
+        }
+        if (!r->_doneWrite) {
+            r->rd_wait = 1;
+            __atomic_thread_fence(__ATOMIC_SEQ_CST);
+            if (rb_spsc_count(r, rd, r->wr_pos) == fill
+                && xSemaphoreTake(r->can_read, ticks_to_wait) != pdTRUE) {
+                r->rd_wait = 0;
+                break;
+            }
+            r->rd_wait = 0;
+        }
+    }
+
+    if (r->_doneWrite == 1 && total_read_size == 0) {
+        total_read_size = -2;
+    }
+    return total_read_size;
+}
+
+static int rb_write_spsc(RingBuf *r, uint8_t *buf, int buf_len, TickType_t ticks_to_wait)
+{
+    int write_size;
+    int total_write_size = 0;
+    uint32_t wr = r->wr_pos;
+
+    while (buf_len) {
+        int32_t room = r->size - rb_spsc_count(r, __atomic_load_n(&r->rd_pos, __ATOMIC_ACQUIRE), wr);
+        write_size = (room < buf_len) ? room : buf_len;
+        if (write_size > 0) {
+            rb_spsc_copy(r, wr, buf, write_size, 1);
+            wr = rb_spsc_advance(r, wr, write_size);
+            __atomic_store_n(&r->wr_pos, wr, __ATOMIC_RELEASE);
+            __atomic_thread_fence(__ATOMIC_SEQ_CST);
+            if (r->rd_wait) {
+                r->rd_wait = 0;
+                xSemaphoreGive(r->can_read);
+            }
+            buf_len -= write_size;
+            total_write_size += write_size;
+            buf += write_size;
+        }
+        if (buf_len == 0 || r->abort == 1) {
+            break;
+        }
+        r->wr_wait = 1;
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+        if (r->size - rb_spsc_count(r, r->rd_pos, wr) == room
+            && xSemaphoreTake(r->can_write, ticks_to_wait) != pdTRUE) {
+            r->wr_wait = 0;
+            break;
+        }
+        r->wr_wait = 0;
+    }
+
+    if (r->_doneWrite) {
+        return -2;
+    }
+    return total_write_size;
+}
+
 int rb_read(RingBuf *r, uint8_t *buf, int buf_len, TickType_t ticks_to_wait)
 {
     int read_size, remainder = 0;
     int total_read_size = 0;
 
+    TRACE_BEGIN("rb_read");
+    if (r->spsc) {
+        total_read_size = rb_read_spsc(r, buf, buf_len, ticks_to_wait);
+        TRACE_END("rb_read");
+        return total_read_size;
+    }
+
     xSemaphoreTake(r->mux, portMAX_DELAY);
 
     while (buf_len) {
@@ -121,6 +280,7 @@ int rb_read(RingBuf *r, uint8_t *buf, int buf_len, TickType_t ticks_to_wait)
             memcpy(buf, r->p_r, read_size);
             r->p_r = r->p_r + read_size;
         }
+        mem_place_bw_copy(MEM_PLACE_BW_AUDIO, buf, r->p_o, read_size);
 
         buf_len -= read_size;
         r->fill_cnt -= read_size;
@@ -156,6 +316,7 @@ out:
     if (r->_doneWrite == 1 && total_read_size == 0) {
         total_read_size = -2;
     }
+    TRACE_END("rb_read");
     return total_read_size;
 }
 
@@ -164,6 +325,13 @@ int rb_write(RingBuf *r, uint8_t *buf, int buf_len, TickType_t ticks_to_wait)
     int write_size = 0;
     int total_write_size = 0;
 
+    TRACE_BEGIN("rb_write");
+    if (r->spsc) {
+        total_write_size = rb_write_spsc(r, buf, buf_len, ticks_to_wait);
+        TRACE_END("rb_write");
+        return total_write_size;
+    }
+
     xSemaphoreTake(r->mux, portMAX_DELAY);
 
     while (buf_len) {
@@ -182,6 +350,7 @@ int rb_write(RingBuf *r, uint8_t *buf, int buf_len, TickType_t ticks_to_wait)
             memcpy(r->p_w, buf, write_size);
             r->p_w = r->p_w + write_size;
         }
+        mem_place_bw_copy(MEM_PLACE_BW_AUDIO, r->p_o, buf, write_size);
 
         buf_len -= write_size;
         r->fill_cnt += write_size;
@@ -211,12 +380,158 @@ out:
     if (total_write_size != 0 ) {
         xSemaphoreGive(r->can_read);
     }
+    TRACE_END("rb_write");
     if (r->_doneWrite) {
         return -2;
     }
     return total_write_size;
 }
 
+/* filled bytes in either mode, fill_cnt is read without the mux like rb_available does */
+static inline int32_t rb_fill(RingBuf *r)
+{
+    if (r->spsc)
+        return rb_spsc_count(r, __atomic_load_n(&r->rd_pos, __ATOMIC_ACQUIRE),
+                             __atomic_load_n(&r->wr_pos, __ATOMIC_ACQUIRE));
+    return r->fill_cnt;
+}
+
+/* block on sem until ready(r) >= need, 0: ready, -1: aborted, -3: timed out */
+static int rb_wait_for(RingBuf *r, int32_t need, int write_side, TickType_t ticks_to_wait)
+{
+    while (1) {
+        int32_t have = write_side ? r->size - rb_fill(r) : rb_fill(r);
+        if (have >= need) {
+            return 0;
+        }
+        if (r->abort == 1) {
+            return -1;
+        }
+        if (!write_side && r->_doneWrite) {
+            return 0;
+        }
+        volatile uint8_t *wait = write_side ? &r->wr_wait : &r->rd_wait;
+        xSemaphoreHandle sem = write_side ? r->can_write : r->can_read;
+        if (r->spsc) {
+            *wait = 1;
+            __atomic_thread_fence(__ATOMIC_SEQ_CST);
+            if ((write_side ? r->size - rb_fill(r) : rb_fill(r)) != have) {
+                *wait = 0;
+                continue;
+            }
+        }
+        if (xSemaphoreTake(sem, ticks_to_wait) != pdTRUE) {
+            *wait = 0;
+            return -3;
+        }
+        *wait = 0;
+    }
+}
+
+/*
+ * @brief: zero-copy write, wait until len bytes are free and point at the write position
+ * @param: ptr the write position in the buffer
+ * @param: contig bytes that can be written at ptr, less than len when the free space wraps at the end
+ *         of the buffer, a buffer size that is a multiple of the chunk size keeps whole chunks contiguous
+ * @return: 0 ready, -1 aborted, -3 timed out (ptr and contig still tell what is free)
+ * @note: write the data at ptr and hand it over with rb_commit_write
+ */
+int rb_acquire_write(RingBuf *r, int len, uint8_t **ptr, int *contig, TickType_t ticks_to_wait)
+{
+    int ret = rb_wait_for(r, (len < r->size) ? len : r->size, 1, ticks_to_wait);
+    if (ret == -1) {
+        return ret;
+    }
+    int32_t room = r->size - rb_fill(r);
+    uint8_t *p_w;
+    if (r->spsc) {
+        p_w = r->p_o + ((r->wr_pos >= r->size) ? r->wr_pos - r->size : r->wr_pos);
+    } else {
+        p_w = r->p_w;
+    }
+    int32_t end = r->p_o + r->size - p_w;
+    *ptr = p_w;
+    *contig = (room < end) ? room : end;
+    return ret;
+}
+
+int rb_commit_write(RingBuf *r, int len)
+{
+    if (len <= 0)
+        return 0;
+    if (r->spsc) {
+        __atomic_store_n(&r->wr_pos, rb_spsc_advance(r, r->wr_pos, len), __ATOMIC_RELEASE);
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+        if (r->rd_wait) {
+            r->rd_wait = 0;
+            xSemaphoreGive(r->can_read);
+        }
+        return len;
+    }
+    xSemaphoreTake(r->mux, portMAX_DELAY);
+    r->p_w += len;
+    if (r->p_w >= r->p_o + r->size) {
+        r->p_w -= r->size;
+    }
+    r->fill_cnt += len;
+    xSemaphoreGive(r->mux);
+    xSemaphoreGive(r->can_read);
+    return len;
+}
+
+/*
+ * @brief: zero-copy read, wait until len bytes are filled and point at the read position
+ * @param: contig bytes readable at ptr, less than len when the data wraps at the end of the buffer
+ * @return: 0 ready, -1 aborted, -2 write done and nothing left, -3 timed out
+ *          (ptr and contig still tell what is filled), after rb_releaseReadWait the rest is returned with 0
+ * @note: consume the data at ptr in place and release it with rb_commit_read
+ */
+int rb_acquire_read(RingBuf *r, int len, uint8_t **ptr, int *contig, TickType_t ticks_to_wait)
+{
+    int ret = rb_wait_for(r, (len < r->size) ? len : r->size, 0, ticks_to_wait);
+    if (ret == -1) {
+        return ret;
+    }
+    int32_t fill = rb_fill(r);
+    uint8_t *p_r;
+    if (r->spsc) {
+        p_r = r->p_o + ((r->rd_pos >= r->size) ? r->rd_pos - r->size : r->rd_pos);
+    } else {
+        p_r = r->p_r;
+    }
+    int32_t end = r->p_o + r->size - p_r;
+    *ptr = p_r;
+    *contig = (fill < end) ? fill : end;
+    if (ret == 0 && fill == 0 && r->_doneWrite) {
+        return -2;
+    }
+    return ret;
+}
+
+int rb_commit_read(RingBuf *r, int len)
+{
+    if (len <= 0)
+        return 0;
+    if (r->spsc) {
+        __atomic_store_n(&r->rd_pos, rb_spsc_advance(r, r->rd_pos, len), __ATOMIC_RELEASE);
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+        if (r->wr_wait) {
+            r->wr_wait = 0;
+            xSemaphoreGive(r->can_write);
+        }
+        return len;
+    }
+    xSemaphoreTake(r->mux, portMAX_DELAY);
+    r->p_r += len;
+    if (r->p_r >= r->p_o + r->size) {
+        r->p_r -= r->size;
+    }
+    r->fill_cnt -= len;
+    xSemaphoreGive(r->mux);
+    xSemaphoreGive(r->can_write);
+    return len;
+}
+
 void rb_abort(RingBuf *rb, int val)
 {
     if (rb == NULL)
@@ -256,6 +571,8 @@ int32_t rb_isFull(struct RingBuf *rb)
 {
     if (rb == NULL)
         return 0;
+    if (rb->spsc)
+        return (rb->size == rb_spsc_count(rb, rb->rd_pos, rb->wr_pos));
     return (rb->size == rb->fill_cnt);
 }
 
@@ -32,15 +32,32 @@ typedef struct RingBuf {
     int _doneWrite;  //to prevent infinite blocking for buffer read
 
     void (*releaseReadWait) (struct RingBuf *rb);
+
+    /* rb_init_spsc: one reader and one writer task, no mux. The positions run over [0, 2 * size),
+     * each is stored by its own side only, fill_cnt/p_r/p_w are not used */
+    uint8_t spsc;
+    volatile uint32_t rd_pos;
+    volatile uint32_t wr_pos;
+    volatile uint8_t rd_wait;   /* reader blocked on can_read */
+    volatile uint8_t wr_wait;   /* writer blocked on can_write */
 } RingBuf;
 
 //TODO: make the ringbuf methods as ringbuf "class member function" to prevent abuse
 struct RingBuf *rb_init(BufferTag tag, int32_t size, int32_t block_size, xSemaphoreHandle share_mux);
+// Single producer / single consumer buffer, rb_read and rb_write copy without taking a lock and only signal
+// the other side when it is blocked. Exactly one task may read and one task may write
+struct RingBuf *rb_init_spsc(BufferTag tag, int32_t size, int32_t block_size);
 void rb_abort(struct RingBuf *rb, int val);
 void rb_reset(struct RingBuf *rb);
 int32_t rb_available(struct RingBuf *r);
 int  rb_read(struct RingBuf *r, uint8_t *buf, int len, TickType_t ticks_to_wait);
 int rb_write(struct RingBuf *r, uint8_t *buf, int len, TickType_t ticks_to_wait);
+// Zero-copy access: acquire points into the buffer, at most contig bytes, and commit hands them to the
+// other side. 0: len bytes ready, -1: aborted, -2: (read) write done and empty, -3: timed out
+int rb_acquire_write(struct RingBuf *r, int len, uint8_t **ptr, int *contig, TickType_t ticks_to_wait);
+int rb_commit_write(struct RingBuf *r, int len);
+int rb_acquire_read(struct RingBuf *r, int len, uint8_t **ptr, int *contig, TickType_t ticks_to_wait);
+int rb_commit_read(struct RingBuf *r, int len);
 int isDoneWrite(struct RingBuf *rb);
 void rb_unint(RingBuf *rb);
 #endif
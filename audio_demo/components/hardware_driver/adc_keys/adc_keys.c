@@ -0,0 +1,282 @@
+/*
+  * ESPRESSIF MIT License
+  *
+  * Copyright (c) 2021 <ESPRESSIF SYSTEMS (SHANGHAI) PTE LTD>
+  *
+  * Permission is hereby granted for use on ESPRESSIF SYSTEMS products only, in which case,
+  * it is free of charge, to any person obtaining a copy of this software and associated
+  * documentation files (the "Software"), to deal in the Software without restriction, including
+  * without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+  * and/or sell copies of the Software, and to permit persons to whom the Software is furnished
+  * to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all copies or
+  * substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+  * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+  * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+  * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+  *
+  */
+#include <stdlib.h>
+#include <string.h>
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_idf_version.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "adc_keys.h"
+
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(4, 4, 0) && CONFIG_IDF_TARGET_ESP32S2
+#define ADC_KEYS_DMA            1
+#define ADC_KEYS_DMA_FREQ_HZ    (20 * 1000)
+#define ADC_KEYS_DMA_SHIFT      (13 - 11)   /*!< DMA results are 11 bit, the ranges are 13 bit */
+#define ADC_KEYS_TASK_STACK     (2048)
+#endif
+
+#define ADC_KEYS_FRAC_BITS      (4)         /*!< of the filter state */
+
+static const char *ADC_KEYS_TAG = "adc_keys";
+#define ADC_KEYS_CHECK(a, str, ret)  if(!(a)) {                                            \
+    ESP_LOGE(ADC_KEYS_TAG,"%s:%d (%s):%s", __FILE__, __LINE__, __FUNCTION__, str);     \
+    return (ret);                                                                   \
+    }
+
+struct adc_keys {
+    adc_keys_config_t cfg;
+    QueueHandle_t events;
+    int32_t filter;             /*!< -1 until the first reading */
+    int settled;                /*!< the key down, -1 for none */
+    int candidate;              /*!< the key the readings point to, not settled yet */
+    int64_t candidate_us;
+#ifdef ADC_KEYS_DMA
+    volatile bool stop;
+    xSemaphoreHandle task_exit;
+#else
+    esp_timer_handle_t timer;
+#endif
+};
+
+static int adc_keys_classify(struct adc_keys *keys, int level)
+{
+    for (int i = 0; i < keys->cfg.key_num; i++) {
+        if (level >= keys->cfg.keys[i].min && level < keys->cfg.keys[i].max) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static void adc_keys_emit(struct adc_keys *keys, int key, adc_key_event_type_t type, int64_t time_us)
+{
+    adc_key_event_t event = {
+        .key = key,
+        .type = type,
+        .time_us = time_us,
+    };
+    xQueueSend(keys->events, &event, 0);
+}
+
+/*
+ * One reading per period. A change of key starts a candidate, which becomes the settled key once the
+ * readings stayed on it for debounce_ms; the events carry the time the candidate started
+ */
+static void adc_keys_step(struct adc_keys *keys, int raw, int64_t now)
+{
+    if (keys->filter < 0) {
+        keys->filter = raw << ADC_KEYS_FRAC_BITS;
+    }
+    keys->filter += ((raw << ADC_KEYS_FRAC_BITS) - keys->filter) >> keys->cfg.filter_shift;
+
+    int key = adc_keys_classify(keys, keys->filter >> ADC_KEYS_FRAC_BITS);
+    if (key == keys->settled) {
+        keys->candidate = key;
+        return;
+    }
+    if (key != keys->candidate) {
+        keys->candidate = key;
+        keys->candidate_us = now;
+        return;
+    }
+    if (now - keys->candidate_us < keys->cfg.debounce_ms * 1000LL) {
+        return;
+    }
+    if (keys->settled >= 0) {
+        adc_keys_emit(keys, keys->settled, ADC_KEY_RELEASE, keys->candidate_us);
+    }
+    if (key >= 0) {
+        adc_keys_emit(keys, key, ADC_KEY_PRESS, keys->candidate_us);
+    }
+    keys->settled = key;
+}
+
+#ifdef ADC_KEYS_DMA
+static void adc_keys_task(void *arg)
+{
+    struct adc_keys *keys = (struct adc_keys *)arg;
+    int samples = ADC_KEYS_DMA_FREQ_HZ / 1000 * keys->cfg.period_ms;
+    uint8_t *buf = malloc(samples * sizeof(adc_digi_output_data_t));
+    uint32_t len;
+
+    while (buf && !keys->stop) {
+        // blocks until DMA has a block, or an overflow was caught up with
+        esp_err_t ret = adc_digi_read_bytes(buf, samples * sizeof(adc_digi_output_data_t), &len, 100);
+        if (ret != ESP_OK && ret != ESP_ERR_INVALID_STATE) {
+            continue;
+        }
+        uint32_t sum = 0;
+        int count = 0;
+        for (int i = 0; i + sizeof(adc_digi_output_data_t) <= len; i += sizeof(adc_digi_output_data_t)) {
+            adc_digi_output_data_t *p = (adc_digi_output_data_t *)&buf[i];
+            if (p->type2.channel == keys->cfg.channel) {
+                sum += p->type2.data;
+                count++;
+            }
+        }
+        if (count) {
+            adc_keys_step(keys, (sum / count) << ADC_KEYS_DMA_SHIFT, esp_timer_get_time());
+        }
+    }
+    free(buf);
+    xSemaphoreGive(keys->task_exit);
+    vTaskDelete(NULL);
+}
+
+static esp_err_t adc_keys_start(struct adc_keys *keys)
+{
+    adc_digi_init_config_t init = {
+        .max_store_buf_size = 4 * ADC_KEYS_DMA_FREQ_HZ / 1000 * keys->cfg.period_ms * sizeof(adc_digi_output_data_t),
+        .conv_num_each_intr = ADC_KEYS_DMA_FREQ_HZ / 1000 * keys->cfg.period_ms * sizeof(adc_digi_output_data_t),
+        .adc1_chan_mask = BIT(keys->cfg.channel),
+        .adc2_chan_mask = 0,
+    };
+    ADC_KEYS_CHECK(adc_digi_initialize(&init) == ESP_OK, "adc_digi_initialize error", ESP_FAIL);
+
+    adc_digi_pattern_config_t pattern = {
+        .atten = keys->cfg.atten,
+        .channel = keys->cfg.channel,
+        .unit = 0,
+        .bit_width = SOC_ADC_DIGI_MAX_BITWIDTH,
+    };
+    adc_digi_configuration_t dig = {
+        .conv_limit_en = 0,
+        .conv_limit_num = 250,
+        .pattern_num = 1,
+        .adc_pattern = &pattern,
+        .sample_freq_hz = ADC_KEYS_DMA_FREQ_HZ,
+        .conv_mode = ADC_CONV_SINGLE_UNIT_1,
+        .format = ADC_DIGI_OUTPUT_FORMAT_TYPE2,
+    };
+    if (adc_digi_controller_configure(&dig) != ESP_OK) {
+        adc_digi_deinitialize();
+        ESP_LOGE(ADC_KEYS_TAG, "adc_digi_controller_configure error");
+        return ESP_FAIL;
+    }
+
+    keys->task_exit = xSemaphoreCreateBinary();
+    if (keys->task_exit == NULL
+            || xTaskCreate(adc_keys_task, "adc_keys", ADC_KEYS_TASK_STACK, keys, keys->cfg.task_priority, NULL) != pdPASS) {
+        if (keys->task_exit) {
+            vSemaphoreDelete(keys->task_exit);
+            keys->task_exit = NULL;
+        }
+        adc_digi_deinitialize();
+        return ESP_ERR_NO_MEM;
+    }
+    adc_digi_start();
+    return ESP_OK;
+}
+
+static void adc_keys_stop(struct adc_keys *keys)
+{
+    if (keys->task_exit == NULL) {
+        return;
+    }
+    keys->stop = true;
+    xSemaphoreTake(keys->task_exit, portMAX_DELAY);
+    vSemaphoreDelete(keys->task_exit);
+    adc_digi_stop();
+    adc_digi_deinitialize();
+}
+#else
+static void adc_keys_timer_cb(void *arg)
+{
+    struct adc_keys *keys = (struct adc_keys *)arg;
+    adc_keys_step(keys, adc1_get_raw(keys->cfg.channel), esp_timer_get_time());
+}
+
+static esp_err_t adc_keys_start(struct adc_keys *keys)
+{
+    // the widest the target has, the ranges are at the full width
+    adc1_config_width(ADC_WIDTH_MAX - 1);
+    adc1_config_channel_atten(keys->cfg.channel, keys->cfg.atten);
+
+    esp_timer_create_args_t args = {
+        .callback = adc_keys_timer_cb,
+        .arg = keys,
+        .dispatch_method = ESP_TIMER_TASK,
+        .name = "adc_keys",
+    };
+    ADC_KEYS_CHECK(esp_timer_create(&args, &keys->timer) == ESP_OK, "esp_timer_create error", ESP_FAIL);
+    if (esp_timer_start_periodic(keys->timer, keys->cfg.period_ms * 1000) != ESP_OK) {
+        esp_timer_delete(keys->timer);
+        keys->timer = NULL;
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+static void adc_keys_stop(struct adc_keys *keys)
+{
+    if (keys->timer == NULL) {
+        return;
+    }
+    esp_timer_stop(keys->timer);
+    esp_timer_delete(keys->timer);
+}
+#endif
+
+adc_keys_handle_t adc_keys_create(const adc_keys_config_t *config)
+{
+    ADC_KEYS_CHECK(config && config->keys && config->key_num > 0, "no keys", NULL);
+    ADC_KEYS_CHECK(config->period_ms > 0 && config->filter_shift >= 0, "bad period or filter", NULL);
+    struct adc_keys *keys = calloc(1, sizeof(struct adc_keys));
+    ADC_KEYS_CHECK(keys, "no mem", NULL);
+    keys->cfg = *config;
+    keys->filter = -1;
+    keys->settled = -1;
+    keys->candidate = -1;
+    keys->events = xQueueCreate(config->queue_len, sizeof(adc_key_event_t));
+    if (keys->events == NULL || adc_keys_start(keys) != ESP_OK) {
+        if (keys->events) {
+            vQueueDelete(keys->events);
+        }
+        free(keys);
+        return NULL;
+    }
+    return keys;
+}
+
+esp_err_t adc_keys_get_event(adc_keys_handle_t keys, adc_key_event_t *event, TickType_t ticks_to_wait)
+{
+    return xQueueReceive(keys->events, event, ticks_to_wait) == pdTRUE ? ESP_OK : ESP_ERR_TIMEOUT;
+}
+
+int adc_keys_get_level(adc_keys_handle_t keys)
+{
+    return keys->filter < 0 ? 0 : keys->filter >> ADC_KEYS_FRAC_BITS;
+}
+
+void adc_keys_destroy(adc_keys_handle_t keys)
+{
+    if (keys == NULL) {
+        return;
+    }
+    adc_keys_stop(keys);
+    vQueueDelete(keys->events);
+    free(keys);
+}
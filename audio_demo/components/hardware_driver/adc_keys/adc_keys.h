@@ -0,0 +1,109 @@
+/*
+  * ESPRESSIF MIT License
+  *
+  * Copyright (c) 2021 <ESPRESSIF SYSTEMS (SHANGHAI) PTE LTD>
+  *
+  * Permission is hereby granted for use on ESPRESSIF SYSTEMS products only, in which case,
+  * it is free of charge, to any person obtaining a copy of this software and associated
+  * documentation files (the "Software"), to deal in the Software without restriction, including
+  * without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+  * and/or sell copies of the Software, and to permit persons to whom the Software is furnished
+  * to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all copies or
+  * substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+  * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+  * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+  * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+  *
+  */
+#ifndef _IOT_ADC_KEYS_H_
+#define _IOT_ADC_KEYS_H_
+#include <stdint.h>
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "driver/adc.h"
+
+/*
+ * Buttons on a resistor ladder, read on one ADC1 channel. The readings go through an IIR filter and
+ * a debouncer, and every settled change comes out as a press or a release event.
+ *
+ * From IDF v4.4 on the ESP32-S2 samples in continuous mode: DMA fills a block, the task wakes for it
+ * and takes its average. Otherwise an esp_timer takes one conversion per period. Either way nothing
+ * busy waits, and a press is seen within period_ms + debounce_ms.
+ */
+
+typedef enum {
+    ADC_KEY_PRESS = 0,
+    ADC_KEY_RELEASE,
+} adc_key_event_type_t;
+
+typedef struct {
+    int key;                    /*!< index in adc_keys_config_t.keys */
+    adc_key_event_type_t type;
+    int64_t time_us;            /*!< esp_timer_get_time() when the reading started to change */
+} adc_key_event_t;
+
+/**
+ * @brief The raw readings of one key, min included, max excluded. Raw is at the full one-shot width:
+ *        0~8191 on the ESP32-S2, 0~4095 on the ESP32
+ */
+typedef struct {
+    int min;
+    int max;
+} adc_key_range_t;
+
+typedef struct {
+    adc1_channel_t channel;
+    adc_atten_t atten;
+    const adc_key_range_t *keys;    /*!< not copied, a reading out of every range means no key */
+    int key_num;
+    int period_ms;                  /*!< one filtered reading per period */
+    int debounce_ms;                /*!< a new reading has to hold this long to be an event */
+    int filter_shift;               /*!< a reading weighs 1/2^filter_shift in the filter */
+    int queue_len;                  /*!< events not taken yet, more are dropped */
+    int task_priority;              /*!< of the DMA reader */
+} adc_keys_config_t;
+
+#define ADC_KEYS_DEFAULT_CONFIG() {     \
+    .channel = ADC1_CHANNEL_0,          \
+    .atten = ADC_ATTEN_DB_11,           \
+    .keys = NULL,                       \
+    .key_num = 0,                       \
+    .period_ms = 2,                     \
+    .debounce_ms = 10,                  \
+    .filter_shift = 2,                  \
+    .queue_len = 8,                     \
+    .task_priority = 10,                \
+}
+
+typedef struct adc_keys *adc_keys_handle_t;
+
+/**
+ * @brief Configure the channel and start scanning
+ *
+ * @return
+ *     - NULL Fail
+ *     - Others Success
+ */
+adc_keys_handle_t adc_keys_create(const adc_keys_config_t *config);
+
+/**
+ * @brief Take the next event
+ *
+ * @return ESP_ERR_TIMEOUT when there was none within ticks_to_wait
+ */
+esp_err_t adc_keys_get_event(adc_keys_handle_t keys, adc_key_event_t *event, TickType_t ticks_to_wait);
+
+/**
+ * @brief The last filtered reading, for calibrating the ranges
+ */
+int adc_keys_get_level(adc_keys_handle_t keys);
+
+void adc_keys_destroy(adc_keys_handle_t keys);
+
+#endif
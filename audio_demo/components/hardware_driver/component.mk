@@ -3,6 +3,7 @@ COMPONENT_ADD_INCLUDEDIRS := MediaHal \
                              MediaHal/Codec \
                              SystemSal \
                              i2c_bus \
+                             adc_keys \
                              userconfig \
                              SDCardConfig
 
@@ -10,7 +11,7 @@ COMPONENT_SRCDIRS :=  MediaHal \
                       MediaHal/Codec \
                       SystemSal \
                       i2c_bus \
+                      adc_keys \
                       SDCardConfig
-                 
-
 
+COMPONENT_ADD_LDFRAGMENTS += linker.lf
@@ -23,14 +23,38 @@
   */
 
 #include <stdio.h>
+#include <string.h>
 #include "esp_log.h"
+#include "esp_idf_version.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
 #include "driver/i2c.h"
 #include "i2c_bus.h"
 #include "lock.h"
 
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(4, 4, 0)
+#define I2C_BUS_STATIC_LINK     1
+// every transaction is at most 9 commands, start addr reg wdata start addr read read stop
+#define I2C_BUS_LINK_SIZE       I2C_LINK_RECOMMENDED_SIZE(2 * I2C_BUS_TRANS_MAX)
+#endif
+
+typedef struct {
+    i2c_bus_trans_t trans[I2C_BUS_TRANS_MAX];
+    int count;                  /*!< -1 asks the bus task to leave */
+    i2c_bus_done_cb_t cb;
+    void *arg;
+} i2c_bus_req_t;
+
 typedef struct {
     i2c_config_t i2c_conf;   /*!<I2C bus parameters*/
     i2c_port_t i2c_port;     /*!<I2C port number */
+    QueueHandle_t links;     /*!<free command link buffers */
+#ifdef I2C_BUS_STATIC_LINK
+    uint8_t link_buf[I2C_BUS_LINK_POOL_SIZE][I2C_BUS_LINK_SIZE];
+#endif
+    QueueHandle_t reqs;      /*!<async submits */
+    xSemaphoreHandle task_exit;
 } i2c_bus_t;
 
 static const char *I2C_BUS_TAG = "i2c_bus";
@@ -44,6 +68,117 @@ static const char *I2C_BUS_TAG = "i2c_bus";
 static i2c_bus_t *i2c_bus[I2C_NUM_MAX];
 static xSemaphoreHandle _busLock;
 
+/*
+ * Command links come from the pool of the port, so building one costs no heap and several tasks
+ * can build theirs while another transfer is on the bus. Before IDF v4.4 the driver has no static
+ * links, the pool then only bounds how many are built at once
+ */
+static i2c_cmd_handle_t i2c_bus_link_get(i2c_bus_t *bus, uint8_t **buf, portBASE_TYPE ticks_to_wait)
+{
+    if (xQueueReceive(bus->links, buf, ticks_to_wait) != pdTRUE) {
+        return NULL;
+    }
+#ifdef I2C_BUS_STATIC_LINK
+    i2c_cmd_handle_t cmd = i2c_cmd_link_create_static(*buf, I2C_BUS_LINK_SIZE);
+#else
+    i2c_cmd_handle_t cmd = i2c_cmd_link_create();
+#endif
+    if (cmd == NULL) {
+        xQueueSend(bus->links, buf, 0);
+    }
+    return cmd;
+}
+
+static void i2c_bus_link_put(i2c_bus_t *bus, i2c_cmd_handle_t cmd, uint8_t *buf)
+{
+#ifdef I2C_BUS_STATIC_LINK
+    i2c_cmd_link_delete_static(cmd);
+#else
+    i2c_cmd_link_delete(cmd);
+#endif
+    xQueueSend(bus->links, &buf, 0);
+}
+
+static int i2c_bus_build(i2c_cmd_handle_t cmd, const i2c_bus_trans_t *trans, int count)
+{
+    int res = 0;
+    for (int i = 0; i < count; i++) {
+        const i2c_bus_trans_t *t = &trans[i];
+        if (t->reg_len > 0 || t->wlen > 0 || t->rlen <= 0) {
+            res |= i2c_master_start(cmd);
+            res |= i2c_master_write_byte(cmd, t->addr & ~0x01, I2C_ACK_CHECK_EN);
+            if (t->reg_len > 0) {
+                res |= i2c_master_write(cmd, (uint8_t *)t->reg, t->reg_len, I2C_ACK_CHECK_EN);
+            }
+            if (t->wlen > 0) {
+                res |= i2c_master_write(cmd, (uint8_t *)t->wdata, t->wlen, I2C_ACK_CHECK_EN);
+            }
+        }
+        if (t->rlen > 0) {
+            res |= i2c_master_start(cmd);
+            res |= i2c_master_write_byte(cmd, t->addr | 0x01, I2C_ACK_CHECK_EN);
+            res |= i2c_master_read(cmd, t->rdata, t->rlen, I2C_MASTER_LAST_NACK);
+        }
+    }
+    res |= i2c_master_stop(cmd);
+    return res;
+}
+
+static esp_err_t i2c_bus_run(i2c_port_t port, const i2c_bus_trans_t *trans, int count, portBASE_TYPE ticks_to_wait)
+{
+    i2c_bus_t *bus = i2c_bus[port];
+    I2C_BUS_CHECK(bus != NULL, "I2C bus not created", ESP_ERR_INVALID_STATE);
+    uint8_t *buf = NULL;
+    i2c_cmd_handle_t cmd = i2c_bus_link_get(bus, &buf, ticks_to_wait);
+    if (cmd == NULL) {
+        ESP_LOGW(I2C_BUS_TAG, "no free command link on port %d", port);
+        return ESP_ERR_TIMEOUT;
+    }
+    // built outside the lock, only the transfer itself holds the bus
+    int res = i2c_bus_build(cmd, trans, count);
+    if (res == 0) {
+        mutex_lock(_busLock);
+        res = i2c_master_cmd_begin(port, cmd, ticks_to_wait);
+        mutex_unlock(_busLock);
+    }
+    i2c_bus_link_put(bus, cmd, buf);
+    return res == 0 ? ESP_OK : ESP_FAIL;
+}
+
+static void i2c_bus_task(void *pv)
+{
+    i2c_bus_t *bus = (i2c_bus_t *)pv;
+    i2c_bus_req_t req;
+    while (1) {
+        if (xQueueReceive(bus->reqs, &req, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+        if (req.count < 0) {
+            break;
+        }
+        esp_err_t err = i2c_bus_run(bus->i2c_port, req.trans, req.count, 1000 / portTICK_RATE_MS);
+        if (req.cb) {
+            req.cb(req.arg, err);
+        }
+    }
+    xSemaphoreGive(bus->task_exit);
+    vTaskDelete(NULL);
+}
+
+static void i2c_bus_free(i2c_bus_t *bus)
+{
+    if (bus->links) {
+        vQueueDelete(bus->links);
+    }
+    if (bus->reqs) {
+        vQueueDelete(bus->reqs);
+    }
+    if (bus->task_exit) {
+        vSemaphoreDelete(bus->task_exit);
+    }
+    free(bus);
+}
+
 i2c_bus_handle_t i2c_bus_create(i2c_port_t port, i2c_config_t *conf)
 {
     I2C_BUS_CHECK(port < I2C_NUM_MAX, "I2C port error", NULL);
@@ -52,45 +187,79 @@ i2c_bus_handle_t i2c_bus_create(i2c_port_t port, i2c_config_t *conf)
         ESP_LOGW(I2C_BUS_TAG, "%s:%d: I2C bus already create,[port:%d]", __FUNCTION__, __LINE__, port);
         return i2c_bus[port];
     }
-    i2c_bus[port] = (i2c_bus_t *) calloc(1, sizeof(i2c_bus_t));
-    i2c_bus[port]->i2c_conf = *conf;
-    i2c_bus[port]->i2c_port = port;
-    esp_err_t ret = i2c_param_config(i2c_bus[port]->i2c_port, &i2c_bus[port]->i2c_conf);
+    i2c_bus_t *bus = (i2c_bus_t *) calloc(1, sizeof(i2c_bus_t));
+    I2C_BUS_CHECK(bus != NULL, "No memory for the I2C bus", NULL);
+    bus->i2c_conf = *conf;
+    bus->i2c_port = port;
+    bus->links = xQueueCreate(I2C_BUS_LINK_POOL_SIZE, sizeof(uint8_t *));
+    bus->reqs = xQueueCreate(I2C_BUS_ASYNC_QUEUE_LEN, sizeof(i2c_bus_req_t));
+    bus->task_exit = xSemaphoreCreateBinary();
+    if (bus->links == NULL || bus->reqs == NULL || bus->task_exit == NULL) {
+        goto error;
+    }
+    for (int i = 0; i < I2C_BUS_LINK_POOL_SIZE; i++) {
+#ifdef I2C_BUS_STATIC_LINK
+        uint8_t *buf = bus->link_buf[i];
+#else
+        uint8_t *buf = NULL;
+#endif
+        xQueueSend(bus->links, &buf, 0);
+    }
+    esp_err_t ret = i2c_param_config(bus->i2c_port, &bus->i2c_conf);
     if (ret != ESP_OK) {
         goto error;
     }
-    ret = i2c_driver_install(i2c_bus[port]->i2c_port, i2c_bus[port]->i2c_conf.mode, ESP_I2C_MASTER_BUF_LEN, ESP_I2C_MASTER_BUF_LEN, ESP_INTR_FLG_DEFAULT);
+    ret = i2c_driver_install(bus->i2c_port, bus->i2c_conf.mode, ESP_I2C_MASTER_BUF_LEN, ESP_I2C_MASTER_BUF_LEN, ESP_INTR_FLG_DEFAULT);
     if (ret != ESP_OK) {
         goto error;
     }
-    if (_busLock) {
-        mutex_destroy(_busLock);
+    if (_busLock == NULL) {
+        _busLock = mutex_init();
     }
-    _busLock = mutex_init();
-    return (i2c_bus_handle_t) i2c_bus[port];
+    i2c_bus[port] = bus;
+    if (pdPASS != xTaskCreate(i2c_bus_task, "i2c_bus", I2C_BUS_TASK_STACK, bus, I2C_BUS_TASK_PRIO, NULL)) {
+        i2c_bus[port] = NULL;
+        i2c_driver_delete(port);
+        goto error;
+    }
+    return (i2c_bus_handle_t) bus;
 
 error:
-    if (i2c_bus[port]) {
-        free(i2c_bus[port]);
-    }
+    i2c_bus_free(bus);
     return NULL;
 }
 
+esp_err_t i2c_bus_submit(i2c_port_t port, const i2c_bus_trans_t *trans, int count, portBASE_TYPE ticks_to_wait)
+{
+    I2C_BUS_CHECK(port < I2C_NUM_MAX, "I2C port error", ESP_ERR_INVALID_ARG);
+    I2C_BUS_CHECK(trans != NULL && count > 0 && count <= I2C_BUS_TRANS_MAX, "Transaction error", ESP_ERR_INVALID_ARG);
+    return i2c_bus_run(port, trans, count, ticks_to_wait);
+}
+
+esp_err_t i2c_bus_submit_async(i2c_port_t port, const i2c_bus_trans_t *trans, int count, i2c_bus_done_cb_t cb, void *arg)
+{
+    I2C_BUS_CHECK(port < I2C_NUM_MAX, "I2C port error", ESP_ERR_INVALID_ARG);
+    I2C_BUS_CHECK(trans != NULL && count > 0 && count <= I2C_BUS_TRANS_MAX, "Transaction error", ESP_ERR_INVALID_ARG);
+    I2C_BUS_CHECK(i2c_bus[port] != NULL, "I2C bus not created", ESP_ERR_INVALID_STATE);
+    i2c_bus_req_t req;
+    memcpy(req.trans, trans, count * sizeof(i2c_bus_trans_t));
+    req.count = count;
+    req.cb = cb;
+    req.arg = arg;
+    if (xQueueSend(i2c_bus[port]->reqs, &req, 0) != pdTRUE) {
+        return ESP_ERR_TIMEOUT;
+    }
+    return ESP_OK;
+}
+
 esp_err_t i2c_bus_write_bytes(i2c_port_t port, int addr, uint8_t *reg, int regLen, uint8_t *data, int datalen)
 {
     I2C_BUS_CHECK(port < I2C_NUM_MAX, "I2C port error", ESP_FAIL);
     I2C_BUS_CHECK(data != NULL, "Pointer error", ESP_FAIL);
-    int res = 0;
-    mutex_lock(_busLock);
-    i2c_cmd_handle_t cmd = i2c_cmd_link_create();
-    res |= i2c_master_start(cmd);
-    res |= i2c_master_write_byte(cmd, addr, 1);
-    res |= i2c_master_write(cmd, reg, regLen, I2C_ACK_CHECK_EN);
-    res |= i2c_master_write(cmd, data, datalen, I2C_ACK_CHECK_EN);
-    res |= i2c_master_stop(cmd);
-    res |= i2c_master_cmd_begin(port, cmd, 1000 / portTICK_RATE_MS);
-    i2c_cmd_link_delete(cmd);
-    mutex_unlock(_busLock);
+    i2c_bus_trans_t t = {
+        .addr = addr, .reg = reg, .reg_len = regLen, .wdata = data, .wlen = datalen,
+    };
+    esp_err_t res = i2c_bus_run(port, &t, 1, 1000 / portTICK_RATE_MS);
     I2C_BUS_CHECK(res == 0, "I2C Bus WriteReg Error", ESP_FAIL);
     return res;
 }
@@ -99,16 +268,10 @@ esp_err_t i2c_bus_write_data(i2c_port_t port, int addr, uint8_t *data, int datal
 {
     I2C_BUS_CHECK(port < I2C_NUM_MAX, "I2C port error", ESP_FAIL);
     I2C_BUS_CHECK(data != NULL, "Pointer error", ESP_FAIL);
-    int res = 0;
-    mutex_lock(_busLock);
-    i2c_cmd_handle_t cmd = i2c_cmd_link_create();
-    res |= i2c_master_start(cmd);
-    res |= i2c_master_write_byte(cmd, addr, 1);
-    res |= i2c_master_write(cmd, data, datalen, I2C_ACK_CHECK_EN);
-    res |= i2c_master_stop(cmd);
-    res |= i2c_master_cmd_begin(port, cmd, 1000 / portTICK_RATE_MS);
-    i2c_cmd_link_delete(cmd);
-    mutex_unlock(_busLock);
+    i2c_bus_trans_t t = {
+        .addr = addr, .wdata = data, .wlen = datalen,
+    };
+    esp_err_t res = i2c_bus_run(port, &t, 1, 1000 / portTICK_RATE_MS);
     I2C_BUS_CHECK(res == 0, "I2C Bus WriteReg Error", ESP_FAIL);
     return res;
 }
@@ -117,21 +280,10 @@ esp_err_t i2c_bus_read_bytes(i2c_port_t port, int addr, uint8_t *outdata, int le
 {
     I2C_BUS_CHECK(port < I2C_NUM_MAX, "I2C port error", ESP_FAIL);
     I2C_BUS_CHECK(outdata != NULL, "Pointer error", ESP_FAIL);
-    int res = 0;
-    mutex_lock(_busLock);
-    i2c_cmd_handle_t cmd;
-    cmd = i2c_cmd_link_create();
-    res |= i2c_master_start(cmd);
-    res |= i2c_master_write_byte(cmd, addr, I2C_ACK_CHECK_EN);
-    int i = 0;
-    for (i = 0; i < len - 1; i++) {
-        res |= i2c_master_read_byte(cmd, &outdata[i], 0);
-    }
-    res |= i2c_master_read_byte(cmd, &outdata[i], 1);
-    res |= i2c_master_stop(cmd);
-    res |= i2c_master_cmd_begin(port, cmd, 1000 / portTICK_RATE_MS);
-    i2c_cmd_link_delete(cmd);
-    mutex_unlock(_busLock);
+    i2c_bus_trans_t t = {
+        .addr = addr, .rdata = outdata, .rlen = len,
+    };
+    esp_err_t res = i2c_bus_run(port, &t, 1, 1000 / portTICK_RATE_MS);
     I2C_BUS_CHECK(res == 0, "I2C Bus ReadReg Error", ESP_FAIL);
     return res;
 }
@@ -140,12 +292,27 @@ esp_err_t i2c_bus_delete(i2c_bus_handle_t bus)
 {
     I2C_BUS_CHECK(bus != NULL, "Handle error", ESP_FAIL);
     i2c_bus_t *p_bus = (i2c_bus_t *) bus;
-    i2c_driver_delete(p_bus->i2c_port);
-    free(p_bus);
+    // the bus task finishes what is queued before it sees the exit request
+    i2c_bus_req_t req = { .count = -1 };
+    xQueueSend(p_bus->reqs, &req, portMAX_DELAY);
+    xSemaphoreTake(p_bus->task_exit, portMAX_DELAY);
+    for (int i = 0; i < I2C_BUS_LINK_POOL_SIZE; i++) {
+        // wait for the links still in use by other tasks
+        uint8_t *buf;
+        xQueueReceive(p_bus->links, &buf, portMAX_DELAY);
+    }
     i2c_bus[p_bus->i2c_port] = NULL;
-    mutex_destroy(_busLock);
+    i2c_driver_delete(p_bus->i2c_port);
+    i2c_bus_free(p_bus);
 
-    _busLock = NULL;
+    int left = 0;
+    for (int i = 0; i < I2C_NUM_MAX; i++) {
+        left += i2c_bus[i] != NULL;
+    }
+    if (left == 0) {
+        mutex_destroy(_busLock);
+        _busLock = NULL;
+    }
     return ESP_OK;
 }
 
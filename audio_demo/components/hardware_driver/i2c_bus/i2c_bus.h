@@ -44,6 +44,65 @@ esp_err_t i2c_bus_write_bytes(i2c_port_t port, int addr, uint8_t *reg, int regLe
 esp_err_t i2c_bus_write_data(i2c_port_t port, int addr, uint8_t *data, int datalen);
 esp_err_t i2c_bus_read_bytes(i2c_port_t port, int addr, uint8_t *outdata, int len);
 
+#define I2C_BUS_TRANS_MAX       (8)     /*!< transactions in one submit, they share one command link */
+#define I2C_BUS_LINK_POOL_SIZE  (4)     /*!< preallocated command links of a port */
+#define I2C_BUS_ASYNC_QUEUE_LEN (8)     /*!< async submits waiting for the bus */
+#define I2C_BUS_TASK_PRIO       (10)
+#define I2C_BUS_TASK_STACK      (2048)
+
+/**
+ * @brief One transaction: start, addr, reg, wdata, then when rlen > 0 a repeated start, addr | 1 and rlen bytes read
+ */
+typedef struct {
+    int addr;                   /*!< 8 bit address with the write bit clear */
+    const uint8_t *reg;         /*!< can be NULL */
+    int reg_len;
+    const uint8_t *wdata;       /*!< can be NULL */
+    int wlen;
+    uint8_t *rdata;             /*!< can be NULL */
+    int rlen;
+} i2c_bus_trans_t;
+
+/**
+ * @brief Called from the bus task when an async submit is done, keep it short
+ */
+typedef void (*i2c_bus_done_cb_t)(void *arg, esp_err_t err);
+
+/**
+ * @brief Run up to I2C_BUS_TRANS_MAX transactions back to back, with repeated starts and one stop,
+ *        in a single command link taken from the pool of the port
+ *
+ * @param port I2C port number, the bus has to be created
+ * @param trans Transactions
+ * @param count Number of transactions
+ * @param ticks_to_wait Maximum blocking time for a free link and for the transfer
+ *
+ * @return
+ *     - ESP_OK Success
+ *     - ESP_ERR_INVALID_ARG Parameter error
+ *     - ESP_ERR_TIMEOUT No free link in time
+ *     - ESP_FAIL Transfer failed
+ */
+esp_err_t i2c_bus_submit(i2c_port_t port, const i2c_bus_trans_t *trans, int count, portBASE_TYPE ticks_to_wait);
+
+/**
+ * @brief Queue transactions to the bus task of the port and return at once
+ *
+ * The descriptors are copied, the buffers they point to must stay valid until cb is called
+ *
+ * @param port I2C port number, the bus has to be created
+ * @param trans Transactions
+ * @param count Number of transactions, up to I2C_BUS_TRANS_MAX
+ * @param cb Completion callback, can be NULL
+ * @param arg Passed to cb
+ *
+ * @return
+ *     - ESP_OK Queued
+ *     - ESP_ERR_INVALID_ARG Parameter error
+ *     - ESP_ERR_TIMEOUT Queue full
+ */
+esp_err_t i2c_bus_submit_async(i2c_port_t port, const i2c_bus_trans_t *trans, int count, i2c_bus_done_cb_t cb, void *arg);
+
 /**
  * @brief Delete and release the I2C bus object
  *
@@ -18,6 +18,7 @@
 #include "esp_err.h"
 #include "driver/ledc.h"
 #include "driver/timer.h"
+#include "driver/i2s.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 
@@ -26,6 +27,16 @@ extern "C" {
 #endif
 
 
+/**
+ * @brief pwm audio output backend
+ */
+typedef enum {
+    PWM_AUDIO_OUT_LEDC = 0, /*!< LEDC PWM, a timer interrupt per sample sets the duty, left and right GPIO */
+    PWM_AUDIO_OUT_I2S,      /*!< pulse density bit stream on the I2S data line fed by DMA, an interrupt per DMA buffer.
+                                 Mono on gpio_num_left (stereo data is mixed), 64 pulses per sample, the I2S port
+                                 is taken (the ESP32-S2 has only one, no camera or I2S LCD at the same time) */
+} pwm_audio_out_t;
+
 /**
  * @brief Configuration parameters of pwm audio for pwm_audio_init function
  */
@@ -41,7 +52,10 @@ typedef struct
     ledc_timer_t ledc_timer_sel;         /*!< Select the timer source of channel (0 - 3) */
     ledc_timer_bit_t duty_resolution;   /*!< ledc pwm bits */
 
-    uint32_t ringbuf_len;            /*!< ringbuffer size */
+    uint32_t ringbuf_len;            /*!< ringbuffer size, PWM_AUDIO_OUT_I2S: DMA buffer size */
+
+    pwm_audio_out_t out;              /*!< output backend */
+    i2s_port_t i2s_num;               /*!< PWM_AUDIO_OUT_I2S: I2S port, tg_num/timer_num/ledc_* are not used */
 
 } pwm_audio_config_t;
 
@@ -56,6 +70,17 @@ typedef enum {
 } pwm_audio_status_t;
 
 
+/**
+ * @brief pwm audio playback counters, see pwm_audio_get_stats
+ */
+typedef struct {
+    uint32_t frames_played;   /*!< frames sent since pwm_audio_init, free running and kept over stop and start */
+    uint32_t frames_queued;   /*!< frames written and not sent yet */
+    uint32_t underruns;       /*!< times the output ran dry while started, once per gap */
+    uint32_t overruns;        /*!< pwm_audio_write calls that waited ticks_to_wait on a full buffer and timed out, once per call */
+    int32_t drift_ppm;        /*!< output clock against media_clock_now(), positive when the output plays slow */
+} pwm_audio_stats_t;
+
 /**
  * @brief pwm audio channel.
  *
@@ -90,6 +115,8 @@ esp_err_t pwm_audio_start(void);
 /**
  * @brief Write data
  *
+ * A frame split between two writes is kept and completed by the next write, its bytes count as written
+ *
  * @param inbuf 
  * @param len 
  * @param bytes_written 
@@ -154,6 +181,49 @@ esp_err_t pwm_audio_set_sample_rate(int rate);
  */
 esp_err_t pwm_audio_get_status(pwm_audio_status_t *status);
 
+/**
+ * @brief get the playback counters
+ *
+ * The timer output counts every frame in its interrupt. The I2S output counts per DMA buffer sent, the
+ * frames queued include the one being sent, so they are up to a DMA buffer early
+ *
+ * @param stats counters
+ *
+ * @return
+ *     - ESP_OK Success
+ *     - ESP_ERR_INVALID_ARG Parameter error
+ */
+esp_err_t pwm_audio_get_stats(pwm_audio_stats_t *stats);
+
+/**
+ * @brief get the time a frame written now waits before it is played
+ *
+ * frames_queued at the current sample rate, the position of the output for A/V sync is the time of the
+ * frame last written less the latency
+ *
+ * @param latency_us latency in microseconds
+ *
+ * @return
+ *     - ESP_OK Success
+ *     - ESP_ERR_INVALID_ARG Parameter error
+ */
+esp_err_t pwm_audio_get_latency(uint32_t *latency_us);
+
+/**
+ * @brief get the media time a frame written now will be heard
+ *
+ * On the media_clock_now() time base the camera and LCD stamp frames with, the position of the output
+ * filtered over the marks of the output ISR (timer) or DMA events (I2S), so it follows the drift of the
+ * output clock. Compare with a frame timestamp for A/V sync, or with a deadline
+ *
+ * @param time_us media time in microseconds, 0 while the output is stopped or ran dry until it plays again
+ *
+ * @return
+ *     - ESP_OK Success
+ *     - ESP_ERR_INVALID_ARG Parameter error
+ */
+esp_err_t pwm_audio_get_play_time(int64_t *time_us);
+
 #ifdef __cplusplus
 }
 #endif
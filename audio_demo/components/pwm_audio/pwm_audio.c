@@ -17,18 +17,27 @@
 #include <string.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/semphr.h"
+#include "freertos/queue.h"
 #include "freertos/task.h"
 #include "driver/ledc.h"
 #include "esp_err.h"
 #include "esp_timer.h"
 #include "esp_log.h"
 #include "driver/timer.h"
+#include "driver/i2s.h"
 #include "soc/timer_group_struct.h"
 #include "soc/ledc_struct.h"
 #include "soc/ledc_reg.h"
 #include "hal/gpio_ll.h"
+#include "trace.h"
+#include "param.h"
+#include "media_clock.h"
+#if CONFIG_PM_ENABLE
+#include "esp_pm.h"
+#endif
 #include "soc/timer_group_caps.h"
 #include "pwm_audio.h"
+#include "pwm_audio_convert.h"
 #include "sdkconfig.h"
 
 #ifndef CONFIG_IDF_TARGET_ESP32S2
@@ -49,6 +58,8 @@
 
 static const char *TAG = "pwm_audio";
 
+#define PWM_AUDIO_CLOCK_MARK 256    /**< timer output: frames between clock marks, a power of 2 */
+
 #define PWM_AUDIO_CHECK(a, str, ret_val)                          \
     if (!(a))                                                     \
     {                                                             \
@@ -66,25 +77,41 @@ static const char *PWM_AUDIO_ALLOC_ERROR      = "PWM AUDIO ALLOC ERROR";
 static const char *PWM_AUDIO_RESOLUTION_ERROR = "PWM AUDIO RESOLUTION ERROR";
 
 #define BUFFER_MIN_SIZE (256UL)
+#define BUFFER_GIVE_FRAMES (BUFFER_MIN_SIZE >> 2) /**< Free frames that wake the writer by default, BUFFER_MIN_SIZE bytes of 16 bit stereo */
 #define SAMPLE_RATE_MAX (48000)
 #define SAMPLE_RATE_MIN (8000)
 #define CHANNEL_LEFT_INDEX  (0)
 #define CHANNEL_RIGHT_INDEX (1)
 #define CHANNEL_LEFT_MASK   (0x01)
 #define CHANNEL_RIGHT_MASK  (0x02)
+#define PDM_BITS            (64)  /**< I2S output: pulses per sample, one 32 bit left and right slot */
+#define PDM_LEVEL_SHIFT     (6)   /**< log2(PDM_BITS) */
+#define PDM_CHUNK_FRAMES    (64)  /**< frames modulated per i2s_write */
+#define PDM_DMA_BUF_COUNT   (4)   /**< default of the pwm.pdm_dma_cnt parameter */
+#define PDM_EVENT_PER_BUF   (4)   /**< TX done events kept per DMA buffer until a write or a query takes them */
 
 
+/**
+ * One frame per timer tick: left duty in the low half word, right duty in the high half word,
+ * already scaled to the PWM resolution, so the ISR does one aligned load per tick
+ */
 typedef struct {
-    char *buf;                         /**< Original pointer */
-    uint32_t volatile head;            /**< ending pointer */
-    uint32_t volatile tail;            /**< Read pointer */
-    uint32_t size;                     /**< Buffer size */
+    uint32_t *buf;                     /**< Original pointer */
+    uint32_t volatile head;            /**< Frames written, free running */
+    uint32_t volatile tail;            /**< Frames read, free running */
+    uint32_t size;                     /**< Buffer size in frames, a power of two */
+    uint32_t mask;                     /**< size - 1 */
     uint32_t is_give;                  /**< semaphore give flag */
     SemaphoreHandle_t semaphore_rb;    /**< Semaphore for ringbuffer */
 
 } ringBuf;
 typedef ringBuf *ringbuf_handle_t;
 
+/**
+ * Convert frames of input samples into duty frames, src may have any alignment
+ */
+typedef void (*pwm_audio_convert_t)(uint32_t *dst, const uint8_t *src, uint32_t frames, int32_t resolution);
+
 typedef struct {
     pwm_audio_config_t    config;                          /**< pwm audio config struct */
     ledc_channel_config_t ledc_channel[PWM_AUDIO_CH_MAX];  /**< ledc channel config */
@@ -93,13 +120,38 @@ typedef struct {
     ringbuf_handle_t      ringbuf;                         /**< audio ringbuffer pointer */
     uint32_t              channel_mask;                    /**< channel gpio mask */
     uint32_t              channel_set_num;                 /**< channel audio set number */
+    uint32_t              give_frames;                     /**< free frames that wake the writer, the pwm.give parameter */
     int32_t               framerate;                       /*!< frame rates in Hz */
     int32_t               bits_per_sample;                 /*!< bits per sample (8, 16, 32) */
+    pwm_audio_convert_t   convert;                         /**< sample format to duty frames kernel */
+    uint32_t              frame_bytes;                     /**< input bytes per frame */
+    uint8_t               carry[8];                        /**< start of a frame split between two writes */
+    uint32_t              carry_len;
+    uint32_t              pdm_err;                         /**< I2S output: quantization error carried to the next sample */
+    uint32_t              pdm_duty[PDM_CHUNK_FRAMES];      /**< I2S output: duty frames of a chunk */
+    uint32_t              pdm_bits[PDM_CHUNK_FRAMES * 2];  /**< I2S output: bit stream of a chunk */
+    uint32_t              pdm_dma_frames;                  /**< I2S output: frames per DMA buffer */
+    uint32_t              pdm_written;                     /**< I2S output: frames handed to the driver, free running */
+    QueueHandle_t         i2s_queue;                       /**< I2S output: driver events, a TX done per DMA buffer sent */
+
+    uint32_t volatile     frames_played;                   /**< frames sent since init, free running */
+    uint32_t volatile     underruns;                       /**< times the output ran dry while started */
+    uint32_t              overruns;                        /**< writes that timed out on a full buffer */
+    uint32_t volatile     starved;                         /**< the last frame time found nothing to play */
 
     pwm_audio_status_t status;
+#if CONFIG_PM_ENABLE
+    esp_pm_lock_handle_t pm_lock;                          /**< timer output: APB at max while started, the timer and LEDC count APB */
+#endif
 } pwm_audio_handle;
 typedef pwm_audio_handle *pwm_audio_handle_t;
 
+/**
+ * I2S output bit patterns, level q has q ones spread evenly over the PDM_BITS bits of a sample,
+ * sent MSB first as the left then the right slot
+ */
+static uint32_t g_pdm_table[PDM_BITS + 1][2];
+
 /**< ledc some register pointer */
 static volatile uint32_t *g_ledc_left_conf0_val  = NULL;
 static volatile uint32_t *g_ledc_left_conf1_val  = NULL;
@@ -111,6 +163,12 @@ static volatile uint32_t *g_ledc_right_duty_val  = NULL;
 /**< pwm audio handle pointer */
 static pwm_audio_handle_t g_pwm_audio_handle = NULL;
 
+/**
+ * Play position against media time, marked every PWM_AUDIO_CLOCK_MARK frames as they go out.
+ * Static, the timer ISR takes its lock and the handle may be in PSRAM
+ */
+static media_clock_stream_t g_pwm_audio_clock;
+
 /**
  * Ringbuffer for pwm audio
  */
@@ -140,13 +198,19 @@ static ringbuf_handle_t rb_create(int size)
     }
 
     ringbuf_handle_t rb = NULL;
-    char *buf = NULL;
+    uint32_t *buf = NULL;
+    uint32_t frames = 1;
+
+    /**< size is in bytes, round down to a power of two number of frames */
+    while ((frames << 1) * sizeof(uint32_t) <= size) {
+        frames <<= 1;
+    }
 
     do {
         bool _success =
             (
-                (rb             = malloc(sizeof(ringBuf))) &&
-                (buf            = malloc(size))   &&
+                (rb             = calloc(1, sizeof(ringBuf))) &&
+                (buf            = malloc(frames * sizeof(uint32_t)))   &&
                 (rb->semaphore_rb   = xSemaphoreCreateBinary())
 
             );
@@ -158,30 +222,29 @@ static ringbuf_handle_t rb_create(int size)
         rb->is_give = 0;
         rb->buf = buf;
         rb->head = rb->tail = 0;
-        rb->size = size;
+        rb->size = frames;
+        rb->mask = frames - 1;
         return rb;
 
     } while (0);
 
-    rb_destroy(rb);
+    if (rb) {
+        rb->buf = buf;
+        rb_destroy(rb);
+    } else {
+        free(buf);
+    }
     return NULL;
 }
 
 static uint32_t IRAM_ATTR rb_get_count(ringbuf_handle_t rb)
 {
-    uint32_t tail = rb->tail;
-
-    if (rb->head >= tail) {
-        return (rb->head - tail);
-    }
-
-    return (rb->size - (tail - rb->head));
+    return rb->head - rb->tail;
 }
 
 static uint32_t IRAM_ATTR rb_get_free(ringbuf_handle_t rb)
 {
-    /** < Free a byte to judge the ringbuffer direction */
-    return (rb->size - rb_get_count(rb) - 1);
+    return rb->size - rb_get_count(rb);
 }
 
 static esp_err_t rb_flush(ringbuf_handle_t rb)
@@ -190,47 +253,6 @@ static esp_err_t rb_flush(ringbuf_handle_t rb)
     return ESP_OK;
 }
 
-static esp_err_t IRAM_ATTR rb_read_byte(ringbuf_handle_t rb, uint8_t *outdata)
-{
-    uint32_t tail = rb->tail;
-
-    if (tail == rb->head) {
-        return ESP_FAIL;
-    }
-
-    // Send a byte from the buffer
-    *outdata = rb->buf[tail];
-
-    // Update tail position
-    tail++;
-
-    if (tail == rb->size) {
-        tail = 0;
-    }
-
-    rb->tail = tail;
-    return ESP_OK;
-}
-
-static esp_err_t rb_write_byte(ringbuf_handle_t rb, const uint8_t indata)
-{
-    // Calculate next head
-    uint32_t next_head = rb->head + 1;
-
-    if (next_head == rb->size) {
-        next_head = 0;
-    }
-
-    if (next_head == rb->tail) {
-        return ESP_FAIL;
-    }
-
-    // Store data and advance head
-    rb->buf[rb->head] = indata;
-    rb->head = next_head;
-    return ESP_OK;
-}
-
 static esp_err_t rb_wait_semaphore(ringbuf_handle_t rb, TickType_t ticks_to_wait)
 {
     rb->is_give = 0; /**< As long as it's written, it's allowed to give semaphore again */
@@ -298,75 +320,47 @@ static void IRAM_ATTR timer_group_isr(void *para)
 
 #endif /**< CONFIG_IDF_TARGET_ESP32 */
 
-    static uint8_t wave_h, wave_l;
-    static uint16_t value;
+    ringbuf_handle_t rb = handle->ringbuf;
+    uint32_t tail = rb->tail;
 
     /**
-     * It is believed that the channel configured with GPIO needs to output sound
-    */
-    if (handle->channel_mask & CHANNEL_LEFT_MASK) {
-        if (handle->config.duty_resolution > 8) {
-            rb_read_byte(handle->ringbuf, &wave_l);
-
-            if (ESP_OK == rb_read_byte(handle->ringbuf, &wave_h)) {
-                value = ((wave_h << 8) | wave_l);
-                ledc_set_left_duty_fast(value);/**< set the PWM duty */
-            }
-        } else {
-            if (ESP_OK == rb_read_byte(handle->ringbuf, &wave_h)) {
-                ledc_set_left_duty_fast(wave_h);/**< set the PWM duty */
-            }
-        }
-    }
+     * Mono data and left only output were sorted out when the frame was written,
+     * every channel configured with a GPIO just takes its half word
+     */
+    if (tail != rb->head) {
+        uint32_t frame = rb->buf[tail & rb->mask];
+        rb->tail = tail + 1;
 
-    /**
-     * If two gpios are configured, but the audio data has only one channel, copy the data to the right channel
-     * Instead, the right channel data is discarded
-    */
-    if (handle->channel_mask & CHANNEL_RIGHT_MASK) {
-        if (handle->channel_set_num == 1) {
-            if (handle->config.duty_resolution > 8) {
-                ledc_set_right_duty_fast(value);/**< set the PWM duty */
-            } else {
-                ledc_set_right_duty_fast(wave_h);/**< set the PWM duty */
-            }
-        } else {
-            if (handle->config.duty_resolution > 8) {
-                rb_read_byte(handle->ringbuf, &wave_l);
+        if (handle->channel_mask & CHANNEL_LEFT_MASK) {
+            ledc_set_left_duty_fast(frame & 0xffff);/**< set the PWM duty */
+        }
 
-                if (ESP_OK == rb_read_byte(handle->ringbuf, &wave_h)) {
-                    value = ((wave_h << 8) | wave_l);
-                    ledc_set_right_duty_fast(value);/**< set the PWM duty */
-                }
-            } else {
-                if (ESP_OK == rb_read_byte(handle->ringbuf, &wave_h)) {
-                    ledc_set_right_duty_fast(wave_h);/**< set the PWM duty */
-                }
-            }
+        if (handle->channel_mask & CHANNEL_RIGHT_MASK) {
+            ledc_set_right_duty_fast(frame >> 16);/**< set the PWM duty */
         }
-    } else {
-        if (handle->channel_set_num == 2) {
-            /**
-             * Discard the right channel data only if the right channel is configured but the audio data is stereo
-             * Read buffer but do nothing
-             */
-            if (handle->config.duty_resolution > 8) {
-                rb_read_byte(handle->ringbuf, &wave_h);
-                rb_read_byte(handle->ringbuf, &wave_h);
-            } else {
-                rb_read_byte(handle->ringbuf, &wave_h);
-            }
 
-            rb_read_byte(handle->ringbuf, &wave_l);
+        /**< the frame just set plays from now on, the first one after a gap starts the clock again */
+        if (handle->starved || (handle->frames_played & (PWM_AUDIO_CLOCK_MARK - 1)) == 0) {
+            media_clock_stream_mark(&g_pwm_audio_clock, handle->frames_played, media_clock_now());
         }
+
+        handle->frames_played++;
+        handle->starved = 0;
+    } else if (!handle->starved) {
+        /**< counted once per gap, not per silent tick */
+        handle->starved = 1;
+        handle->underruns++;
+        media_clock_stream_restart(&g_pwm_audio_clock);
+        TRACE_INSTANT("pwm_underrun");
     }
 
     /**
-     * Send semaphore when buffer free is more than BUFFER_MIN_SIZE
+     * Send semaphore when buffer free is more than give_frames
      */
-    if (0 == handle->ringbuf->is_give && rb_get_free(handle->ringbuf) > BUFFER_MIN_SIZE) {
+    if (0 == handle->ringbuf->is_give && rb_get_free(rb) > handle->give_frames) {
         /**< The execution time of the following code is 2.71 microsecond */
         handle->ringbuf->is_give = 1; /**< To prevent multiple give semaphores */
+        TRACE_COUNTER("pwm_free", rb_get_free(rb));
         BaseType_t xHigherPriorityTaskWoken;
         xSemaphoreGiveFromISR(handle->ringbuf->semaphore_rb, &xHigherPriorityTaskWoken);
 
@@ -383,6 +377,152 @@ esp_err_t pwm_audio_get_status(pwm_audio_status_t *status)
     return ESP_OK;
 }
 
+/**
+ * I2S output: account the DMA buffers sent since the last call. A buffer sent with fewer frames queued
+ * than it holds was padded with silence by tx_desc_auto_clear, the output ran dry.
+ * The events carry no time: only a single buffer done since the last call marks the clock, it is recent
+ */
+static void pdm_take_events(pwm_audio_handle_t handle)
+{
+    i2s_event_t event;
+    int done = 0;
+
+    while (xQueueReceive(handle->i2s_queue, &event, 0) == pdTRUE) {
+        if (event.type != I2S_EVENT_TX_DONE) {
+            continue;
+        }
+
+        done++;
+
+        uint32_t queued = handle->pdm_written - handle->frames_played;
+
+        if (queued >= handle->pdm_dma_frames) {
+            handle->frames_played += handle->pdm_dma_frames;
+            handle->starved = 0;
+        } else {
+            handle->frames_played += queued;
+
+            if (!handle->starved && handle->status == PWM_AUDIO_STATUS_BUSY) {
+                handle->starved = 1;
+                handle->underruns++;
+                media_clock_stream_restart(&g_pwm_audio_clock);
+            }
+        }
+    }
+
+    if (done == 1 && !handle->starved) {
+        media_clock_stream_mark(&g_pwm_audio_clock, handle->frames_played, media_clock_now());
+    }
+}
+
+esp_err_t pwm_audio_get_stats(pwm_audio_stats_t *stats)
+{
+    pwm_audio_handle_t handle = g_pwm_audio_handle;
+    PWM_AUDIO_CHECK(handle != NULL && stats != NULL, PWM_AUDIO_PARAM_ADDR_ERROR, ESP_ERR_INVALID_ARG);
+
+    if (handle->config.out == PWM_AUDIO_OUT_I2S) {
+        pdm_take_events(handle);
+        stats->frames_played = handle->frames_played;
+        stats->frames_queued = handle->pdm_written - handle->frames_played;
+    } else {
+        /**< the ISR moves tail before frames_played, read the ring first so queued + played never runs ahead */
+        stats->frames_queued = rb_get_count(handle->ringbuf);
+        stats->frames_played = handle->frames_played;
+    }
+
+    stats->underruns = handle->underruns;
+    stats->overruns = handle->overruns;
+    stats->drift_ppm = media_clock_stream_ppm(&g_pwm_audio_clock);
+    return ESP_OK;
+}
+
+esp_err_t pwm_audio_get_latency(uint32_t *latency_us)
+{
+    pwm_audio_stats_t stats;
+    PWM_AUDIO_CHECK(latency_us != NULL, PWM_AUDIO_PARAM_ADDR_ERROR, ESP_ERR_INVALID_ARG);
+    esp_err_t res = pwm_audio_get_stats(&stats);
+
+    if (ESP_OK == res) {
+        *latency_us = (uint64_t)stats.frames_queued * 1000000 / g_pwm_audio_handle->framerate;
+    }
+
+    return res;
+}
+
+esp_err_t pwm_audio_get_play_time(int64_t *time_us)
+{
+    pwm_audio_stats_t stats;
+    PWM_AUDIO_CHECK(time_us != NULL, PWM_AUDIO_PARAM_ADDR_ERROR, ESP_ERR_INVALID_ARG);
+    esp_err_t res = pwm_audio_get_stats(&stats);
+
+    if (ESP_OK == res) {
+        *time_us = media_clock_stream_time(&g_pwm_audio_clock, stats.frames_played + stats.frames_queued);
+    }
+
+    return res;
+}
+
+/**
+ * I2S output: the data line carries a pulse density stream instead of PCM, 32 bit slots in MSB mode
+ * make a sample period of PDM_BITS bit clocks, the clocks are not routed to any pin
+ */
+static esp_err_t pwm_audio_i2s_init(pwm_audio_handle_t handle)
+{
+    esp_err_t res;
+    PWM_AUDIO_CHECK(handle->config.i2s_num < I2S_NUM_MAX, PWM_AUDIO_PARAM_ERROR, ESP_ERR_INVALID_ARG);
+    PWM_AUDIO_CHECK(handle->config.gpio_num_left >= 0, PWM_AUDIO_PARAM_ERROR, ESP_ERR_INVALID_ARG);
+
+    for (uint32_t q = 0; q <= PDM_BITS; q++) {
+        g_pdm_table[q][0] = 0;
+        g_pdm_table[q][1] = 0;
+
+        for (uint32_t i = 0; i < PDM_BITS; i++) {
+            if ((i + 1) * q / PDM_BITS != i * q / PDM_BITS) {
+                g_pdm_table[q][i / 32] |= 0x80000000UL >> (i % 32);
+            }
+        }
+    }
+
+    /**< ringbuf_len is the whole DMA buffer, 8 bytes per frame */
+    uint32_t dma_count = param_int("pwm.pdm_dma_cnt", PDM_DMA_BUF_COUNT, 2, 16, "I2S output: DMA buffers ringbuf_len is split into");
+    uint32_t dma_len = handle->config.ringbuf_len / (8 * dma_count);
+
+    if (dma_len < 8) {
+        dma_len = 8;
+    } else if (dma_len > 1024) {
+        dma_len = 1024;
+    }
+
+    i2s_config_t i2s_config = {
+        .mode = I2S_MODE_MASTER | I2S_MODE_TX,
+        .sample_rate = 16000,
+        .bits_per_sample = I2S_BITS_PER_SAMPLE_32BIT,
+        .channel_format = I2S_CHANNEL_FMT_RIGHT_LEFT,
+        .communication_format = I2S_COMM_FORMAT_I2S_MSB,
+        .intr_alloc_flags = 0,
+        .dma_buf_count = dma_count,
+        .dma_buf_len = dma_len,
+        .use_apll = false,
+        .tx_desc_auto_clear = true,   /**< an underrun plays silence, not the last buffer again */
+    };
+    res = i2s_driver_install(handle->config.i2s_num, &i2s_config, dma_count * PDM_EVENT_PER_BUF, &handle->i2s_queue);
+    PWM_AUDIO_CHECK(ESP_OK == res, PWM_AUDIO_PARAM_ERROR, res);
+
+    i2s_pin_config_t pin_config = {
+        .bck_io_num = I2S_PIN_NO_CHANGE,
+        .ws_io_num = I2S_PIN_NO_CHANGE,
+        .data_out_num = handle->config.gpio_num_left,
+        .data_in_num = I2S_PIN_NO_CHANGE,
+    };
+    res = i2s_set_pin(handle->config.i2s_num, &pin_config);
+    PWM_AUDIO_CHECK(ESP_OK == res, PWM_AUDIO_PARAM_ERROR, res);
+
+    i2s_stop(handle->config.i2s_num);
+    handle->pdm_dma_frames = dma_len;
+    handle->channel_mask = CHANNEL_LEFT_MASK;
+    return ESP_OK;
+}
+
 esp_err_t pwm_audio_init(const pwm_audio_config_t *cfg)
 {
     esp_err_t res = ESP_OK;
@@ -397,11 +537,29 @@ esp_err_t pwm_audio_init(const pwm_audio_config_t *cfg)
     PWM_AUDIO_CHECK(handle != NULL, PWM_AUDIO_ALLOC_ERROR, ESP_ERR_NO_MEM);
     memset(handle, 0, sizeof(pwm_audio_handle));
 
+    handle->config = *cfg;
+    g_pwm_audio_handle = handle;
+
+    if (cfg->out == PWM_AUDIO_OUT_I2S) {
+        res = pwm_audio_i2s_init(handle);
+        PWM_AUDIO_CHECK(ESP_OK == res, PWM_AUDIO_PARAM_ERROR, res);
+
+        /**< set a initial parameter */
+        res = pwm_audio_set_param(16000, 8, 2);
+        PWM_AUDIO_CHECK(ESP_OK == res, PWM_AUDIO_PARAM_ERROR, ESP_ERR_INVALID_ARG);
+
+        handle->status = PWM_AUDIO_STATUS_IDLE;
+        return res;
+    }
+
     handle->ringbuf = rb_create(cfg->ringbuf_len);
     PWM_AUDIO_CHECK(handle->ringbuf != NULL, PWM_AUDIO_ALLOC_ERROR, ESP_ERR_NO_MEM);
 
-    handle->config = *cfg;
-    g_pwm_audio_handle = handle;
+    /**< a threshold the ring buffer can not reach would never wake the writer */
+    handle->give_frames = param_int("pwm.give", BUFFER_GIVE_FRAMES, 16, 4096, "timer output: free frames that wake the writer");
+    if (handle->give_frames >= handle->ringbuf->size) {
+        handle->give_frames = handle->ringbuf->size / 2;
+    }
 
     /**
      * config ledc to generate pwm
@@ -453,6 +611,11 @@ esp_err_t pwm_audio_init(const pwm_audio_config_t *cfg)
     res = ledc_timer_config(&handle->ledc_timer);
     PWM_AUDIO_CHECK(res == ESP_OK, PWM_AUDIO_PARAM_ERROR, ESP_ERR_INVALID_ARG);
 
+#if CONFIG_PM_ENABLE
+    res = esp_pm_lock_create(ESP_PM_APB_FREQ_MAX, 0, "pwm_audio", &handle->pm_lock);
+    PWM_AUDIO_CHECK(res == ESP_OK, PWM_AUDIO_ALLOC_ERROR, ESP_ERR_NO_MEM);
+#endif
+
     /**
      * Get the address of LEDC register to reduce the addressing time
      */
@@ -493,6 +656,28 @@ esp_err_t pwm_audio_set_param(int rate, ledc_timer_bit_t bits, int ch)
     handle->framerate = rate;
     handle->bits_per_sample = bits;
     handle->channel_set_num = ch;
+    handle->frame_bytes = bits / 8 * ch;
+    handle->carry_len = 0;
+    media_clock_stream_init(&g_pwm_audio_clock, rate);
+
+    switch (bits) {
+        case 8:
+            handle->convert = (ch == 2) ? convert_8_stereo : convert_8_mono;
+            break;
+
+        case 16:
+            handle->convert = (ch == 2) ? convert_16_stereo : convert_16_mono;
+            break;
+
+        default:
+            handle->convert = (ch == 2) ? convert_32_stereo : convert_32_mono;
+            break;
+    }
+
+    if (handle->config.out == PWM_AUDIO_OUT_I2S) {
+        handle->pdm_err = 0;
+        return i2s_set_clk(handle->config.i2s_num, rate, I2S_BITS_PER_SAMPLE_32BIT, I2S_CHANNEL_STEREO);
+    }
 
     /* Select and initialize basic parameters of the timer */
     timer_config_t config = {0};
@@ -526,11 +711,100 @@ esp_err_t pwm_audio_set_sample_rate(int rate)
 
     pwm_audio_handle_t handle = g_pwm_audio_handle;
     handle->framerate = rate;
+    media_clock_stream_init(&g_pwm_audio_clock, rate);
+
+    if (handle->config.out == PWM_AUDIO_OUT_I2S) {
+        return i2s_set_sample_rates(handle->config.i2s_num, rate);
+    }
+
     uint16_t div = (uint16_t)handle->timg_dev->hw_timer[handle->config.timer_num].config.divider;
     res = timer_set_alarm_value(handle->config.tg_num, handle->config.timer_num, (TIMER_BASE_CLK / div) / handle->framerate);
     return res;
 }
 
+/**
+ * Convert frames into the ring buffer, in its two linear regions when they wrap, and publish them at once
+ */
+static void rb_write_frames(pwm_audio_handle_t handle, const uint8_t *src, uint32_t frames)
+{
+    ringbuf_handle_t rb = handle->ringbuf;
+    uint32_t head = rb->head;
+    uint32_t pos = head & rb->mask;
+    uint32_t first = rb->size - pos;
+
+    if (first > frames) {
+        first = frames;
+    }
+
+    handle->convert(rb->buf + pos, src, first, handle->config.duty_resolution);
+
+    if (frames > first) {
+        handle->convert(rb->buf, src + first * handle->frame_bytes, frames - first, handle->config.duty_resolution);
+    }
+
+    rb->head = head + frames;
+}
+
+/**
+ * I2S output: duty frames are mixed to mono and modulated, the error of each sample is carried into
+ * the next one, so the resolution left below the PDM_BITS levels is kept on average
+ */
+static void pdm_modulate(pwm_audio_handle_t handle, uint32_t frames)
+{
+    int shift = handle->config.duty_resolution - PDM_LEVEL_SHIFT;
+    uint32_t err_mask = (1UL << shift) - 1;
+    uint32_t err = handle->pdm_err;
+    const uint32_t *duty = handle->pdm_duty;
+    uint32_t *bits = handle->pdm_bits;
+
+    for (uint32_t i = 0; i < frames; i++) {
+        uint32_t acc = (((duty[i] & 0xffff) + (duty[i] >> 16)) >> 1) + err;
+        uint32_t q = acc >> shift;
+        err = acc & err_mask;
+        bits[2 * i] = g_pdm_table[q][0];
+        bits[2 * i + 1] = g_pdm_table[q][1];
+    }
+
+    handle->pdm_err = err;
+}
+
+/**
+ * I2S output: returns 1 when a wait for room in the DMA buffers timed out
+ */
+static int pdm_write_frames(pwm_audio_handle_t handle, const uint8_t *src, uint32_t frames, TickType_t ticks_to_wait)
+{
+    int overrun = 0;
+
+    while (frames) {
+        uint32_t n = frames < PDM_CHUNK_FRAMES ? frames : PDM_CHUNK_FRAMES;
+        handle->convert(handle->pdm_duty, src, n, handle->config.duty_resolution);
+        pdm_modulate(handle, n);
+
+        /**< the driver copies into the DMA buffers, keep waiting like the ringbuffer writer does */
+        size_t len = n * 8;
+        size_t done = 0;
+
+        while (done < len) {
+            size_t w = 0;
+            i2s_write(handle->config.i2s_num, (uint8_t *)handle->pdm_bits + done, len - done, &w, ticks_to_wait);
+            done += w;
+
+            if (done < len) {
+                overrun = 1;
+            }
+        }
+
+        /**< the chunk is in the DMA buffers, its TX done can be among the events */
+        handle->pdm_written += n;
+        pdm_take_events(handle);
+
+        src += n * handle->frame_bytes;
+        frames -= n;
+    }
+
+    return overrun;
+}
+
 esp_err_t pwm_audio_write(uint8_t *inbuf, size_t inbuf_len, size_t *bytes_written, TickType_t ticks_to_wait)
 {
     esp_err_t res = ESP_OK;
@@ -539,123 +813,76 @@ esp_err_t pwm_audio_write(uint8_t *inbuf, size_t inbuf_len, size_t *bytes_writte
 
     *bytes_written = 0;
     ringbuf_handle_t rb = handle->ringbuf;
+    uint32_t frame_bytes = handle->frame_bytes;
+    int overrun = 0;    /**< counted once per call however often the wait times out */
 
-    while (inbuf_len) {
-        if (ESP_OK == rb_wait_semaphore(rb, ticks_to_wait)) {
-            uint32_t free = rb_get_free(rb);
-            uint32_t bytes_can_write = inbuf_len;
+    /**< a completed carry frame is written before the call returns, even when it took the last bytes */
+    while (inbuf_len || handle->carry_len) {
+        /**< A frame split by the last write is completed first, the bytes are taken once and kept until it fits */
+        if (handle->carry_len || inbuf_len < frame_bytes) {
+            uint32_t take = frame_bytes - handle->carry_len;
 
-            if (inbuf_len > free) {
-                bytes_can_write = free;
+            if (take > inbuf_len) {
+                take = inbuf_len;
             }
 
-            bytes_can_write &= 0xfffffffc;/**< Aligned data, bytes_can_write should be an integral multiple of 4 */
+            memcpy(handle->carry + handle->carry_len, inbuf, take);
+            handle->carry_len += take;
+            inbuf += take;
+            inbuf_len -= take;
+            *bytes_written += take;
 
-            if (0 == bytes_can_write) {
-                *bytes_written += inbuf_len;  /**< Discard the last misaligned bytes of data directly */
-                return ESP_OK;
+            if (handle->carry_len < frame_bytes) {
+                break;
             }
+        }
 
-            /**< Get the difference between PWM resolution and audio samplewidth */
-            int8_t shift = handle->bits_per_sample - handle->config.duty_resolution;
-            uint32_t len = bytes_can_write;
-
-            switch (handle->bits_per_sample) {
-                case 8: {
-                    if (shift < 0) {
-                        /**< When the PWM resolution is greater than 8 bits, the value needs to be expanded */
-                        uint16_t value;
-                        uint8_t temp;
-                        shift = -shift;
-                        len >>= 1;
-                        bytes_can_write >>= 1;
-
-                        for (size_t i = 0; i < len; i++) {
-                            temp = inbuf[i] + 0x7f; /**< offset */
-                            value = temp << shift;
-                            rb_write_byte(rb, value);
-                            rb_write_byte(rb, value >> 8);
-                        }
-                    } else {
-                        uint8_t value;
-
-                        for (size_t i = 0; i < len; i++) {
-                            value = inbuf[i] + 0x7f; /**< offset */
-                            rb_write_byte(rb, value);
-                        }
-                    }
-                }
-                break;
+        if (handle->config.out == PWM_AUDIO_OUT_I2S) {
+            if (handle->carry_len) {
+                overrun |= pdm_write_frames(handle, handle->carry, 1, ticks_to_wait);
+                handle->carry_len = 0;
+            }
 
-                case 16: {
-                    len >>= 1;
-                    uint16_t *buf_16b = (uint16_t *)inbuf;
-                    uint16_t value;
-                    int16_t temp;
-
-                    if (handle->config.duty_resolution > 8) {
-                        for (size_t i = 0; i < len; i++) {
-                            temp = buf_16b[i];
-                            value = temp + 0x7fff; /**< offset */
-                            value >>= shift;
-                            rb_write_byte(rb, value);
-                            rb_write_byte(rb, value >> 8);
-                        }
-                    } else {
-                        /**
-                         * When the PWM resolution is 8 bit, only one byte is transmitted
-                         */
-                        for (size_t i = 0; i < len; i++) {
-                            temp = buf_16b[i];
-                            value = temp + 0x7fff; /**< offset */
-                            value >>= shift;
-                            rb_write_byte(rb, value);
-                        }
-                    }
-                }
-                break;
+            uint32_t frames = inbuf_len / frame_bytes;
+            overrun |= pdm_write_frames(handle, inbuf, frames, ticks_to_wait);
+            inbuf += frames * frame_bytes;
+            inbuf_len -= frames * frame_bytes;
+            *bytes_written += frames * frame_bytes;
+        } else if (ESP_OK == rb_wait_semaphore(rb, ticks_to_wait)) {
+            uint32_t free = rb_get_free(rb);
 
-                case 32: {
-                    len >>= 2;
-                    uint32_t *buf_32b = (uint32_t *)inbuf;
-                    uint32_t value;
-                    int32_t temp;
-
-                    if (handle->config.duty_resolution > 8) {
-                        for (size_t i = 0; i < len; i++) {
-                            temp = buf_32b[i];
-                            value = temp + 0x7fffffff; /**< offset */
-                            value >>= shift;
-                            rb_write_byte(rb, value);
-                            rb_write_byte(rb, value >> 8);
-                        }
-                    } else {
-                        /**
-                         * When the PWM resolution is 8 bit, only one byte is transmitted
-                         */
-                        for (size_t i = 0; i < len; i++) {
-                            temp = buf_32b[i];
-                            value = temp + 0x7fffffff; /**< offset */
-                            value >>= shift;
-                            rb_write_byte(rb, value);
-                        }
-                    }
+            if (handle->carry_len) {
+                if (free == 0) {
+                    continue;   /**< a stale give while the ring is full, wait again */
                 }
-                break;
 
-                default:
-                    break;
+                rb_write_frames(handle, handle->carry, 1);
+                handle->carry_len = 0;
+                free--;
             }
 
-            inbuf += bytes_can_write;
-            inbuf_len -= bytes_can_write;
-            *bytes_written += bytes_can_write;
+            uint32_t frames = inbuf_len / frame_bytes;
+
+            if (frames > free) {
+                frames = free;
+            }
 
+            if (frames) {
+                rb_write_frames(handle, inbuf, frames);
+                inbuf += frames * frame_bytes;
+                inbuf_len -= frames * frame_bytes;
+                *bytes_written += frames * frame_bytes;
+            }
         } else {
+            overrun = 1;
             res = ESP_FAIL;
         }
     }
 
+    if (overrun) {
+        handle->overruns++;
+    }
+
     return res;
 }
 
@@ -666,7 +893,15 @@ esp_err_t pwm_audio_start(void)
     PWM_AUDIO_CHECK(handle->status == PWM_AUDIO_STATUS_IDLE, PWM_AUDIO_STATUS_ERROR, ESP_ERR_INVALID_STATE);
 
     handle->status = PWM_AUDIO_STATUS_BUSY;
+    handle->starved = 1;    /**< nothing written yet is no underrun */
 
+    if (handle->config.out == PWM_AUDIO_OUT_I2S) {
+        return i2s_start(handle->config.i2s_num);
+    }
+
+#if CONFIG_PM_ENABLE
+    esp_pm_lock_acquire(handle->pm_lock);
+#endif
     timer_enable_intr(handle->config.tg_num, handle->config.timer_num);
     res = timer_start(handle->config.tg_num, handle->config.timer_num);
     return res;
@@ -676,10 +911,29 @@ esp_err_t pwm_audio_stop(void)
 {
     pwm_audio_handle_t handle = g_pwm_audio_handle;
 
+    if (handle->config.out == PWM_AUDIO_OUT_I2S) {
+        i2s_stop(handle->config.i2s_num);
+        i2s_zero_dma_buffer(handle->config.i2s_num);
+        xQueueReset(handle->i2s_queue);
+        handle->pdm_written = handle->frames_played;    /**< what was queued is dropped */
+        media_clock_stream_restart(&g_pwm_audio_clock);
+        handle->carry_len = 0;
+        handle->pdm_err = 0;
+        handle->status = PWM_AUDIO_STATUS_IDLE;
+        return ESP_OK;
+    }
+
     /**< just disable timer ,keep pwm output to reduce switching nosie */
     timer_pause(handle->config.tg_num, handle->config.timer_num);
     timer_disable_intr(handle->config.tg_num, handle->config.timer_num);
+#if CONFIG_PM_ENABLE
+    if (handle->status == PWM_AUDIO_STATUS_BUSY) {
+        esp_pm_lock_release(handle->pm_lock);
+    }
+#endif
     rb_flush(handle->ringbuf);  /**< flush ringbuf, avoid play noise */
+    media_clock_stream_restart(&g_pwm_audio_clock);
+    handle->carry_len = 0;
     handle->status = PWM_AUDIO_STATUS_IDLE;
     return ESP_OK;
 }
@@ -689,8 +943,16 @@ esp_err_t pwm_audio_deinit(void)
     pwm_audio_handle_t handle = g_pwm_audio_handle;
     PWM_AUDIO_CHECK(handle != NULL, PWM_AUDIO_PARAM_ADDR_ERROR, ESP_FAIL);
 
-    handle->status = PWM_AUDIO_STATUS_UN_INIT;
     pwm_audio_stop();
+    handle->status = PWM_AUDIO_STATUS_UN_INIT;
+
+    if (handle->config.out == PWM_AUDIO_OUT_I2S) {
+        i2s_driver_uninstall(handle->config.i2s_num);
+        gpio_set_direction(handle->config.gpio_num_left, GPIO_MODE_INPUT);
+        free(handle);
+        g_pwm_audio_handle = NULL;
+        return ESP_OK;
+    }
 
     for (size_t i = 0; i < PWM_AUDIO_CH_MAX; i++) {
         if (handle->ledc_channel[i].gpio_num >= 0) {
@@ -705,7 +967,11 @@ esp_err_t pwm_audio_deinit(void)
         }
     }
 
-    free(handle);
     rb_destroy(handle->ringbuf);
+#if CONFIG_PM_ENABLE
+    esp_pm_lock_delete(handle->pm_lock);
+#endif
+    free(handle);
+    g_pwm_audio_handle = NULL;
     return ESP_OK;
 }
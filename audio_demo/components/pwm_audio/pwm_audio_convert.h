@@ -0,0 +1,110 @@
+// Copyright 2020 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+/**
+ * Private to pwm_audio.c, no driver dependencies so tools/host_bench can build the same kernels on a PC
+ */
+#include <stdint.h>
+
+/**
+ * Sample format kernels. Signed samples get their sign bit flipped to make them unsigned, then are shifted
+ * down to the PWM resolution; 8 bit data keeps the 0x7f offset it always had
+ */
+static inline uint32_t load_le32(const uint8_t *p)
+{
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static void convert_8_mono(uint32_t *dst, const uint8_t *src, uint32_t frames, int32_t resolution)
+{
+    int shift = resolution - 8;
+
+    for (uint32_t i = 0; i < frames; i++) {
+        uint32_t v = (uint8_t)(src[i] + 0x7f) << shift;
+        dst[i] = v | (v << 16);
+    }
+}
+
+static void convert_8_stereo(uint32_t *dst, const uint8_t *src, uint32_t frames, int32_t resolution)
+{
+    int shift = resolution - 8;
+
+    for (uint32_t i = 0; i < frames; i++, src += 2) {
+        dst[i] = ((uint8_t)(src[0] + 0x7f) << shift) | ((uint8_t)(src[1] + 0x7f) << (shift + 16));
+    }
+}
+
+static void convert_16_mono(uint32_t *dst, const uint8_t *src, uint32_t frames, int32_t resolution)
+{
+    int shift = 16 - resolution;
+    uint32_t mask = ((1 << resolution) - 1) * 0x00010001;
+    uint32_t i = 0;
+
+    /**< Two samples per aligned load, both end up in the low half word to be copied up */
+    if (((uintptr_t)src & 3) == 0) {
+        const uint32_t *src32 = (const uint32_t *)src;
+
+        for (; i + 1 < frames; i += 2) {
+            uint32_t w = ((*src32++ ^ 0x80008000) >> shift) & mask;
+            uint32_t l = w & 0xffff, h = w >> 16;
+            dst[i] = l | (l << 16);
+            dst[i + 1] = h | (h << 16);
+        }
+    }
+
+    for (; i < frames; i++) {
+        uint32_t v = ((uint16_t)(src[i * 2] | (src[i * 2 + 1] << 8)) ^ 0x8000) >> shift;
+        dst[i] = v | (v << 16);
+    }
+}
+
+static void convert_16_stereo(uint32_t *dst, const uint8_t *src, uint32_t frames, int32_t resolution)
+{
+    int shift = 16 - resolution;
+    uint32_t mask = ((1 << resolution) - 1) * 0x00010001;
+
+    /**< A little endian L/R pair is already a frame: flip both sign bits, shift, drop what crossed the half word */
+    if (((uintptr_t)src & 3) == 0) {
+        const uint32_t *src32 = (const uint32_t *)src;
+
+        for (uint32_t i = 0; i < frames; i++) {
+            dst[i] = ((src32[i] ^ 0x80008000) >> shift) & mask;
+        }
+    } else {
+        for (uint32_t i = 0; i < frames; i++, src += 4) {
+            dst[i] = ((load_le32(src) ^ 0x80008000) >> shift) & mask;
+        }
+    }
+}
+
+static void convert_32_mono(uint32_t *dst, const uint8_t *src, uint32_t frames, int32_t resolution)
+{
+    int shift = 32 - resolution;
+
+    for (uint32_t i = 0; i < frames; i++, src += 4) {
+        uint32_t v = (load_le32(src) ^ 0x80000000) >> shift;
+        dst[i] = v | (v << 16);
+    }
+}
+
+static void convert_32_stereo(uint32_t *dst, const uint8_t *src, uint32_t frames, int32_t resolution)
+{
+    int shift = 32 - resolution;
+
+    for (uint32_t i = 0; i < frames; i++, src += 8) {
+        dst[i] = ((load_le32(src) ^ 0x80000000) >> shift) | (((load_le32(src + 4) ^ 0x80000000) >> shift) << 16);
+    }
+}
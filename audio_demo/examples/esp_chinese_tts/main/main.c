@@ -24,29 +24,35 @@
 #include "esp_tts.h"
 #include "esp_tts_voice_xiaole.h"
 #include "esp_tts_player.h"
+#include "esp_tts_service.h"
 // #include "sdcard_init.h"
 #include "esp_log.h"
-#include "ringbuf.h"
-#include "esp_vfs.h"
-#include "esp_vfs_dev.h"
 #include "driver/uart.h"
 #include "driver/gpio.h"
 #include "driver/adc.h"
+#include "adc_keys.h"
+#include "boot_steps.h"
+#include "boot_marks.h"
+#include "power.h"
+#include "tts_uart.h"
+#include "tts_ubench.h"
+#include "param.h"
 
 #define TAG "ESP_TTS_zh_CN"
 
 
-#define DEFAULT_VREF    1100        //Use adc2_vref_to_gpio() to obtain a better estimate
-#define NO_OF_SAMPLES   64
-
-static const adc_channel_t channel = ADC_CHANNEL_5;     // GPIO7 if ADC1, GPIO17 if ADC2
-static const adc_bits_width_t width = ADC_WIDTH_BIT_13;
-
-static const adc_atten_t atten = ADC_ATTEN_DB_11;
-static const adc_unit_t unit = ADC_UNIT_1;
-static xQueueHandle adc_queue = NULL;
-
-struct RingBuf *urat_rb;
+/*
+ * The buttons of the board share one resistor ladder on ADC1 channel 5, raw 13 bit readings of each,
+ * in the order of button_prompts[]. Idle reads above 8000
+ */
+static const adc_key_range_t button_ranges[] = {
+    {7000, 8000},   // rec
+    {6000, 7000},   // mode
+    {5000, 6000},   // play
+    {3000, 4000},   // set
+    {2000, 3000},   // vol-
+    {1000, 2000},   // vol+
+};
 
 void tts_codec_init(void)
 {
@@ -81,7 +87,7 @@ void tts_codec_init(void)
     ESP_LOGI(TAG, "CONFIG_CODEC_CHIP_IS_ES8311");
 
 #endif
-    MediaHalSetVolume(60);
+    MediaHalSetVolumeSmooth(60, 0);
 }
 
 int iot_dac_audio_play(const uint8_t *data, int length, TickType_t ticks_to_wait)
@@ -93,119 +99,151 @@ int iot_dac_audio_play(const uint8_t *data, int length, TickType_t ticks_to_wait
 
 
 
-/* From WmfDecBytesPerFrame in dec_input_format_tab.cpp */
-const int sizes[] = { 12, 13, 15, 17, 19, 20, 26, 31, 5, 6, 5, 5, 0, 0, 0, 0 };
-#define URAT_BUF_LEN 1024
-
-
-void button_task(void *arg)
-{
-    //Continuously sample ADC1
-    while (1) {
-        uint32_t adc_reading = 0;
-
-        //Multisampling
-        for (int i = 0; i < NO_OF_SAMPLES; i++) {
-            if (unit == ADC_UNIT_1) {
-                adc_reading += adc1_get_raw((adc1_channel_t)channel);
-            } else {
-                int raw;
-                adc2_get_raw((adc2_channel_t)channel, width, &raw);
-                adc_reading += raw;
-            }
-        }
+#define UART_LINE_MAX 1024              // longest host announcement
+#define TTS_CACHE_BYTES (64 * 1024)     // the button prompts, about half a second each
 
-        adc_reading /= NO_OF_SAMPLES;
-        printf("ADC%d CH%d Raw: %d\t\n", unit, channel, adc_reading);
+#define TTS_RATE_STEP   0.25f           // vol-/vol+ change the speaking rate by this
 
-        if (adc_reading < 8191) {
-            xQueueSend(adc_queue, (uint32_t *)&adc_reading, 0);
-        }
+static const char *button_prompts[] = {"开始", "欢迎", "使用", "乐鑫", "测试", "结束"};
 
-        vTaskDelay(pdMS_TO_TICKS(200));
 
+#define TTS_SINK_BLOCK  256
+#define TTS_STANDBY_RAMP_MS 10          // fades into and out of the codec standby between prompts
 
+// the synthesizer output may be a cached clip, the gain goes on a copy
+static void tts_i2s_sink(const int16_t *pcm, int samples, void *ctx)
+{
+    int16_t block[TTS_SINK_BLOCK];
+    if (MediaHalGetStandby()) {
+        MediaHalStandby(0, TTS_STANDBY_RAMP_MS);
+    }
+    for (int i = 0; i < samples; i += TTS_SINK_BLOCK) {
+        int n = samples - i < TTS_SINK_BLOCK ? samples - i : TTS_SINK_BLOCK;
+        memcpy(block, pcm + i, n * sizeof(int16_t));
+        MediaHalApplyGain(block, n, 1);
+        boot_mark_once(BOOT_MARK_FIRST_AUDIO);
+        iot_dac_audio_play((const uint8_t *)block, n * sizeof(int16_t), portMAX_DELAY);
     }
 }
 
-void adc_init(void)
+// the queue ran dry, codec and PA idle until the next prompt; sink and end run on the same task
+static void tts_i2s_end(void *ctx)
 {
-    if (unit == ADC_UNIT_1) {
-        adc1_config_width(width);
-        adc1_config_channel_atten(channel, atten);
-    } else {
-        adc2_config_channel_atten((adc2_channel_t)channel, atten);
-    }
-
+    MediaHalStandby(1, TTS_STANDBY_RAMP_MS);
 }
 
-void tts_output_chinese(esp_tts_handle_t *tts_handle,  char *data)
+// A new button press cuts off the word being spoken
+void tts_output_chinese(esp_tts_service_handle_t tts_service,  char *data)
 {
-    if (esp_tts_parse_chinese(tts_handle, data)) {
-        int len[1] = {0};
-
-        do {
-            short *data = esp_tts_stream_play(tts_handle, len, 4);
-            iot_dac_audio_play(data, len[0] * 2, portMAX_DELAY);
-            // printf("data:?%d \n", len[0]);
-        } while (len[0] > 0);
-
-        i2s_zero_dma_buffer(0);
+    if (esp_tts_service_say(tts_service, data, ESP_TTS_SAY_PREEMPT) != ESP_OK) {
+        ESP_LOGW(TAG, "TTS queue full, \"%s\" dropped", data);
     }
 }
 
-void audio_task(esp_tts_handle_t *tts_handle)
+void audio_task(void *arg)
 {
-    uint32_t adc_reading = 0;
-    printf("task:%p\n", &tts_handle);
-
+    esp_tts_service_handle_t tts_handle = (esp_tts_service_handle_t)arg;
+    adc_keys_config_t keys_config = ADC_KEYS_DEFAULT_CONFIG();
+    keys_config.channel = ADC1_CHANNEL_5;
+    keys_config.keys = button_ranges;
+    keys_config.key_num = sizeof(button_ranges) / sizeof(button_ranges[0]);
+    keys_config.period_ms = param_int("keys.period_ms", keys_config.period_ms, 1, 50, "ADC key sampling period");
+    keys_config.debounce_ms = param_int("keys.debounce_ms", keys_config.debounce_ms, 0, 200, "ADC key debounce time");
+    adc_keys_handle_t keys = adc_keys_create(&keys_config);
+    adc_key_event_t event;
+    float rate = 1.0f;
+
+    if (keys == NULL) {
+        ESP_LOGE(TAG, "ADC keys create failed");
+        vTaskDelete(NULL);
+    }
     while (1) {
-        xQueueReceive(adc_queue, &adc_reading, portMAX_DELAY);
-
-        if (adc_reading > 8000) {
+        adc_keys_get_event(keys, &event, portMAX_DELAY);
+        if (event.type != ADC_KEY_PRESS) {
             continue;
-        } else if (adc_reading > 7000 && adc_reading <= 8000) {
-            tts_output_chinese(tts_handle, "开始");//rec
-            // vTaskDelay(pdMS_TO_TICKS(100));
-        } else if (adc_reading > 6000 && adc_reading <= 7000) {
-            tts_output_chinese(tts_handle, "欢迎");//mode
-            // vTaskDelay(pdMS_TO_TICKS(100));
-        } else if (adc_reading > 5000 && adc_reading <= 6000) {
-            tts_output_chinese(tts_handle, "使用");//play
-            // vTaskDelay(pdMS_TO_TICKS(100));
-        } else if (adc_reading > 3000 && adc_reading <= 4000) {
-            tts_output_chinese(tts_handle, "乐鑫");//set
-            // vTaskDelay(pdMS_TO_TICKS(100));
-        } else if (adc_reading > 2000 && adc_reading <= 3000) {
-            tts_output_chinese(tts_handle, "测试");//vol-
-            // vTaskDelay(pdMS_TO_TICKS(100));
-        } else if (adc_reading > 1000 && adc_reading <= 2000) {
-            tts_output_chinese(tts_handle, "结束");//vol+
-            // vTaskDelay(pdMS_TO_TICKS(100));
         }
+        ESP_LOGD(TAG, "key %d at %lld us", event.key, event.time_us);
+        if (event.key == 4) {               // vol-
+            rate = rate - TTS_RATE_STEP < 0.5f ? 0.5f : rate - TTS_RATE_STEP;
+            esp_tts_service_set_rate(tts_handle, rate);
+        } else if (event.key == 5) {        // vol+
+            rate = rate + TTS_RATE_STEP > 2.0f ? 2.0f : rate + TTS_RATE_STEP;
+            esp_tts_service_set_rate(tts_handle, rate);
+        }
+        tts_output_chinese(tts_handle, (char *)button_prompts[event.key]);
     }
 
 }
 
-int app_main()
+static int boot_codec(void *arg)
 {
-    adc_queue = xQueueCreate(1, sizeof(uint32_t));
     tts_codec_init();
-    adc_init();
-    printf("RAM size: %dKB\n", heap_caps_get_free_size(MALLOC_CAP_8BIT) / 1024);
+    return 0;
+}
+
+// The voice is loaded while the codec powers up, neither needs the other
+static int boot_tts(void *arg)
+{
+    esp_tts_service_config_t *tts_config = (esp_tts_service_config_t *)arg;
+    tts_config->tts = esp_tts_create((esp_tts_voice_t *)tts_config->voice);
+    tts_config->cache = esp_tts_cache_create(TTS_CACHE_BYTES);
+    return tts_config->tts ? 0 : -1;
+}
+
+int app_main()
+{
+    boot_mark(BOOT_MARK_APP_MAIN);
+#if CONFIG_TTS_UBENCH
+    tts_ubench_run();
+#endif
+#if CONFIG_PM_ENABLE
+    // the I2S driver holds its own lock while started, between prompts the CPU slows down or sleeps
+    power_config_t power_config = {
+        .light_sleep = 1,
+    };
+    power_init(&power_config);
+#endif
     esp_tts_voice_t *voice = &esp_tts_voice_xiaole;
-    esp_tts_handle_t *tts_handle = esp_tts_create(voice);
-    //void *amr = amrnb_decoder_init();
-    urat_rb = rb_init(BUFFER_PROCESS + 1, URAT_BUF_LEN, 1, NULL);
-    char data[URAT_BUF_LEN + 1];
-    char buf;
-    int data_len = 0;
-
-    tts_output_chinese(tts_handle, "乐鑫牛逼");
-
-    printf("main:%p\n", &tts_handle);
-    xTaskCreatePinnedToCore(&button_task, "button_task", 3 * 1024, NULL, 5, NULL, 0);
-    xTaskCreatePinnedToCore(&audio_task, "audio_task", 3 * 1024, (esp_tts_handle_t *)tts_handle, 5, NULL, 0);
+    esp_tts_service_config_t tts_config = ESP_TTS_SERVICE_DEFAULT_CONFIG();
+    tts_config.voice = voice;
+    const boot_step_t steps[] = {
+        {.name = "codec", .fn = boot_codec},
+        {.name = "tts", .fn = boot_tts, .arg = &tts_config, .stack_size = 8192},
+    };
+    if (boot_steps_run(steps, sizeof(steps) / sizeof(steps[0])) != 0) {
+        ESP_LOGE(TAG, "boot failed");
+        return -1;
+    }
+    printf("RAM size: %dKB\n", heap_caps_get_free_size(MALLOC_CAP_8BIT) / 1024);
+    tts_config.sink = tts_i2s_sink;
+    tts_config.end = tts_i2s_end;
+    tts_config.queue_len = 1 + sizeof(button_prompts) / sizeof(button_prompts[0]);
+    tts_config.rate_control = true;
+    esp_tts_service_handle_t tts_handle = esp_tts_service_create(&tts_config);
+    if (tts_handle == NULL) {
+        ESP_LOGE(TAG, "TTS service create failed");
+        return -1;
+    }
+    // AMR-NB prompts go through esp_tts_play_by_amr(), given a decoder such as the amrnb one of esp-adf
+    esp_tts_service_say(tts_handle, "乐鑫牛逼", ESP_TTS_SAY_QUEUE);
+    for (int i = 0; i < sizeof(button_prompts) / sizeof(button_prompts[0]); i++) {
+        esp_tts_service_prewarm(tts_handle, button_prompts[i]);
+    }
+
+    xTaskCreatePinnedToCore(&audio_task, "audio_task", 3 * 1024, tts_handle, 5, NULL, 0);
+
+    // lines the host writes to the console UART are spoken after what is playing
+    tts_uart_config_t uart_config = {
+        .port = UART_NUM_0,
+        .line_max = UART_LINE_MAX,
+        .task_priority = 4,
+        .mode = ESP_TTS_SAY_QUEUE,
+    };
+    tts_uart_start(tts_handle, &uart_config);
+
+    // the greeting is playing by now
+    vTaskDelay(pdMS_TO_TICKS(3000));
+    boot_marks_print();
 
     while (1) {
         vTaskDelay(10000);
@@ -0,0 +1,138 @@
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "esp_log.h"
+#include "tts_uart.h"
+#include "param.h"
+
+#define TAG "TTS_UART"
+
+#define TTS_UART_EVENT_LEN      16
+#define TTS_UART_PATTERN_LEN    16      // line ends the driver remembers before the task reads them
+#define TTS_UART_RETRY_MS       50      // wait for room in the TTS queue
+
+typedef struct {
+    esp_tts_service_handle_t tts;
+    tts_uart_config_t cfg;
+    QueueHandle_t events;
+} tts_uart_t;
+
+// Drop n bytes of the driver buffer
+static void tts_uart_skip(tts_uart_t *u, int n)
+{
+    uint8_t buf[64];
+    while (n > 0) {
+        int len = uart_read_bytes(u->cfg.port, buf, n < sizeof(buf) ? n : sizeof(buf), 0);
+        if (len <= 0) {
+            break;
+        }
+        n -= len;
+    }
+}
+
+// Read the line that ends at pos and hand it to the TTS queue
+static void tts_uart_line(tts_uart_t *u, int pos)
+{
+    int len = pos + 1;
+    if (len > u->cfg.line_max) {
+        ESP_LOGW(TAG, "line of %d bytes dropped", len);
+        tts_uart_skip(u, len);
+        return;
+    }
+    char *text = malloc(len + 1);
+    if (text == NULL) {
+        tts_uart_skip(u, len);
+        return;
+    }
+    len = uart_read_bytes(u->cfg.port, (uint8_t *)text, len, 0);
+    while (len > 0 && (text[len - 1] == '\n' || text[len - 1] == '\r')) {
+        len--;
+    }
+    if (len <= 0) {
+        free(text);
+        return;
+    }
+    text[len] = '\0';
+    // "param ..." 行是调参命令，不播报
+    if (param_command(text) != 1) {
+        free(text);
+        return;
+    }
+    // 队列满时不再读 UART，后面的行留在驱动缓冲区中
+    while (esp_tts_service_say_take(u->tts, text, u->cfg.mode) != ESP_OK) {
+        vTaskDelay(pdMS_TO_TICKS(TTS_UART_RETRY_MS));
+    }
+}
+
+static void tts_uart_task(void *arg)
+{
+    tts_uart_t *u = arg;
+    uart_event_t event;
+    while (1) {
+        if (xQueueReceive(u->events, &event, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+        switch (event.type) {
+        case UART_PATTERN_DET: {
+            int pos = uart_pattern_pop_pos(u->cfg.port);
+            if (pos < 0) {
+                // the position queue overflowed, no telling where the lines are
+                ESP_LOGW(TAG, "line ends lost, input flushed");
+                uart_flush_input(u->cfg.port);
+                uart_pattern_queue_reset(u->cfg.port, TTS_UART_PATTERN_LEN);
+            } else {
+                tts_uart_line(u, pos);
+            }
+            break;
+        }
+        case UART_FIFO_OVF:
+        case UART_BUFFER_FULL:
+            ESP_LOGW(TAG, "rx overflow, input flushed");
+            uart_flush_input(u->cfg.port);
+            uart_pattern_queue_reset(u->cfg.port, TTS_UART_PATTERN_LEN);
+            xQueueReset(u->events);
+            break;
+        default:
+            break;  // UART_DATA: a line in progress, it is read once its '\n' comes
+        }
+    }
+}
+
+esp_err_t tts_uart_start(esp_tts_service_handle_t tts, const tts_uart_config_t *config)
+{
+    tts_uart_t *u = calloc(1, sizeof(tts_uart_t));
+    if (u == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    u->tts = tts;
+    u->cfg = *config;
+    u->cfg.rx_buffer_size = config->rx_buffer_size ? config->rx_buffer_size : 4096;
+    u->cfg.line_max = config->line_max ? config->line_max : 1024;
+    esp_err_t ret = ESP_OK;
+    if (config->baud_rate) {
+        ret = uart_set_baudrate(config->port, config->baud_rate);
+    }
+    if (ret == ESP_OK) {
+        ret = uart_driver_install(config->port, u->cfg.rx_buffer_size, 0, TTS_UART_EVENT_LEN, &u->events, 0);
+    }
+    if (ret == ESP_OK) {
+        // one '\n', no idle time around it: line ends inside a stream at full speed
+        ret = uart_enable_pattern_det_baud_intr(config->port, '\n', 1, 1, 0, 0);
+    }
+    if (ret == ESP_OK) {
+        ret = uart_pattern_queue_reset(config->port, TTS_UART_PATTERN_LEN);
+    }
+    if (ret == ESP_OK && xTaskCreate(tts_uart_task, "tts_uart", 3 * 1024, u, config->task_priority, NULL) != pdPASS) {
+        ret = ESP_ERR_NO_MEM;
+    }
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "UART %d ingest start failed: %d", config->port, ret);
+        if (u->events) {
+            uart_driver_delete(config->port);
+        }
+        free(u);
+    }
+    return ret;
+}
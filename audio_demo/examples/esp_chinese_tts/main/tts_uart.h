@@ -0,0 +1,32 @@
+#pragma once
+
+#include "driver/uart.h"
+#include "esp_tts_service.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Text lines from a host over UART, each one spoken through the TTS service. The driver detects the
+ * '\n' pattern in its receive interrupt and posts its position to the event queue, the ingest task only
+ * wakes up once per line and reads it straight into the buffer the TTS queue then owns. While the TTS
+ * queue is full the task stops reading, the lines wait in the driver ring buffer and then in the FIFO,
+ * so a host streaming at full baud is held back by flow control or loses lines at the driver, never
+ * half lines.
+ */
+
+typedef struct {
+    uart_port_t port;
+    int baud_rate;              // 0: keep the current one, e.g. the console of UART0
+    int rx_buffer_size;         // driver ring buffer, several lines, 0: 4096
+    int line_max;               // longer lines are dropped, 0: 1024
+    int task_priority;
+    esp_tts_say_mode_t mode;    // queue after what is playing, or cut it off
+} tts_uart_config_t;
+
+esp_err_t tts_uart_start(esp_tts_service_handle_t tts, const tts_uart_config_t *config);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,71 @@
+#include <stdlib.h>
+#include <string.h>
+#include "ringbuf.h"
+#include "ubench.h"
+#include "tts_ubench.h"
+
+#define TTS_UBENCH_RB_SIZE  (16 * 1024)
+#define TTS_UBENCH_CHUNK    512         // an I2S DMA buffer of 16 bit stereo
+
+typedef struct {
+    RingBuf *rb;
+    uint8_t buf[TTS_UBENCH_CHUNK];
+} tts_ubench_t;
+
+static int tts_ubench_setup(void **ctx, int spsc)
+{
+    tts_ubench_t *t = calloc(1, sizeof(tts_ubench_t));
+    if (t == NULL) {
+        return -1;
+    }
+    t->rb = spsc ? rb_init_spsc(BUFFER_PROCESS, TTS_UBENCH_RB_SIZE, 1)
+            : rb_init(BUFFER_PROCESS, TTS_UBENCH_RB_SIZE, 1, NULL);
+    if (t->rb == NULL) {
+        free(t);
+        return -1;
+    }
+    *ctx = t;
+    return 0;
+}
+
+static int tts_ubench_mux_setup(void **ctx)
+{
+    return tts_ubench_setup(ctx, 0);
+}
+
+static int tts_ubench_spsc_setup(void **ctx)
+{
+    return tts_ubench_setup(ctx, 1);
+}
+
+static void tts_ubench_teardown(void *ctx)
+{
+    tts_ubench_t *t = (tts_ubench_t *)ctx;
+    rb_unint(t->rb);
+    free(t);
+}
+
+// A chunk in and out again, neither side ever blocks
+static void tts_ubench_write_read(void *ctx)
+{
+    tts_ubench_t *t = (tts_ubench_t *)ctx;
+    rb_write(t->rb, t->buf, TTS_UBENCH_CHUNK, 0);
+    rb_read(t->rb, t->buf, TTS_UBENCH_CHUNK, 0);
+}
+
+// The mutex and the semaphores are FreeRTOS calls, the interrupts stay on
+UBENCH_CASE(rb_mux_write_read_512, .setup = tts_ubench_mux_setup, .run = tts_ubench_write_read,
+            .teardown = tts_ubench_teardown, .bytes = 2 * TTS_UBENCH_CHUNK, .mode = UBENCH_PINNED,
+            .iterations = 256);
+UBENCH_CASE(rb_spsc_write_read_512, .setup = tts_ubench_spsc_setup, .run = tts_ubench_write_read,
+            .teardown = tts_ubench_teardown, .bytes = 2 * TTS_UBENCH_CHUNK, .mode = UBENCH_PINNED,
+            .iterations = 256);
+
+void tts_ubench_run(void)
+{
+    ubench_register_mem();
+    UBENCH_REGISTER(rb_mux_write_read_512);
+    UBENCH_REGISTER(rb_spsc_write_read_512);
+    ubench_config_t config = UBENCH_DEFAULT_CONFIG();
+    ubench_run(&config);
+}
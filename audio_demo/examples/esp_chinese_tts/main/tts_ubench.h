@@ -0,0 +1,15 @@
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Time the SystemSal ring buffer and memcpy with the ubench component, one UBENCH JSON line per case
+ * on the console. Blocks until they are done.
+ */
+void tts_ubench_run(void);
+
+#ifdef __cplusplus
+}
+#endif
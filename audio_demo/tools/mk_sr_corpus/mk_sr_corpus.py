@@ -0,0 +1,60 @@
+# -*- coding:utf-8 -*-
+#
+# Pack audio clips into the sr_corpus partition image read by sr_corpus.c.
+#
+# Image layout, every field little-endian:
+#   "SRCI"
+#   u32 version
+#   u32 number of clips
+#   per clip: name (32 bytes, NUL padded), u32 offset from the image start, u32 size in bytes
+#   the clips, each one starting on a 4 byte boundary
+# A .wav clip is stored without its 44 byte header, like generate_audio_file.py does,
+# anything else (.pcm, .raw) is stored as it is. The clip name is the file name without extension.
+from __future__ import print_function
+import os
+import struct
+import sys
+
+IMG_MAGIC = b"SRCI"
+IMG_VERSION = 1
+NAME_LEN = 32
+WAV_HEAD = 44
+
+
+def load_clip(filename):
+    with open(filename, "rb") as f:
+        data = f.read()
+    if filename.endswith(".wav"):
+        data = data[WAV_HEAD:]
+    return data
+
+
+def make_image(files):
+    clips = []
+    for filename in files:
+        name = os.path.splitext(os.path.basename(filename))[0].encode()
+        if len(name) >= NAME_LEN:
+            raise ValueError("clip name too long: %s" % name)
+        clips.append((name, load_clip(filename)))
+
+    offset = 12 + len(clips) * (NAME_LEN + 8)
+    index = bytearray(IMG_MAGIC + struct.pack("<II", IMG_VERSION, len(clips)))
+    body = bytearray()
+    for name, data in clips:
+        pad = (-(offset + len(body))) % 4
+        body += b"\0" * pad
+        index += struct.pack("<%dsII" % NAME_LEN, name, offset + len(body), len(data))
+        body += data
+    return index + body, clips
+
+
+if __name__ == '__main__':
+    if len(sys.argv) < 3:
+        print("usage: %s <sr_corpus.bin> <clip.wav | clip.pcm>..." % sys.argv[0])
+        sys.exit(1)
+    img, clips = make_image(sys.argv[2:])
+    with open(sys.argv[1], "wb") as f:
+        f.write(img)
+    for name, data in clips:
+        print("%-32s %8d bytes" % (name.decode(), len(data)))
+    print("%d clips, %d bytes" % (len(clips), len(img)))
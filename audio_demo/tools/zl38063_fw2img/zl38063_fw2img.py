@@ -0,0 +1,109 @@
+# -*- coding:utf-8 -*-
+#
+# Convert a ZL38063 firmware (*.s3, or a zl38063_firmware.c made by tw_convert)
+# into the binary block image loaded by VprocTwolfHbiBoot_alt().
+#
+# Image layout, every field big-endian:
+#   "ZLFW"
+#   u32 execution address
+#   u32 program base address
+#   blocks until the end of the image:
+#     u32 target address, u16 number of words (1..64), the words
+# A block never crosses a 256 byte page 255 window, so it goes out as a single HBI write.
+from __future__ import print_function
+import re
+import struct
+import sys
+
+IMG_MAGIC = b"ZLFW"
+BLOCK_MAX_WORDS = 64
+PAGE_WINDOW = 0x100
+
+
+def parse_s3(filename):
+    """return (chunks, exec_addr), chunks is a list of (address, bytes)"""
+    chunks = []
+    exec_addr = 0
+    with open(filename, "r") as f:
+        for line in f:
+            line = line.strip()
+            if len(line) < 4 or line[0] != 'S':
+                continue
+            rec_type = int(line[1])
+            count = int(line[2:4], 16)
+            raw = bytearray.fromhex(line[4:4 + count * 2])
+            if rec_type in (1, 2, 3):
+                alen = rec_type + 1
+                addr = int(line[4:4 + alen * 2], 16)
+                chunks.append((addr, bytes(raw[alen:-1])))
+            elif rec_type in (7, 8, 9):
+                alen = 11 - rec_type
+                exec_addr = int(line[4:4 + alen * 2], 16)
+    return chunks, exec_addr
+
+
+def parse_c_table(filename):
+    """the st_twFirmware[] table: {{words}, numWords, targetAddr, useTargetAddr}"""
+    with open(filename, "r") as f:
+        text = f.read()
+    chunks = []
+    for words, num, addr in re.findall(r"\{\{([^}]*)\}\s*,\s*(\d+)\s*,\s*(0x[0-9a-fA-F]+)\s*,\s*\d+\s*\}", text):
+        vals = [int(w, 16) for w in words.split(",")][:int(num)]
+        chunks.append((int(addr, 16), struct.pack(">%dH" % len(vals), *vals)))
+    exec_addr = int(re.search(r"executionAddress\s*=\s*(0x[0-9a-fA-F]+)", text).group(1), 16)
+    return chunks, exec_addr
+
+
+def make_blocks(chunks):
+    """merge data contiguous with the record before it, then cut it at the page windows and at BLOCK_MAX_WORDS"""
+    runs = []
+    for addr, data in chunks:
+        if runs and runs[-1][0] + len(runs[-1][1]) == addr:
+            runs[-1][1].extend(data)
+        else:
+            runs.append([addr, bytearray(data)])
+    blocks = []
+    for addr, data in runs:
+        if (addr | len(data)) & 1:
+            raise ValueError("odd address or length at 0x%08x" % addr)
+        pos = 0
+        while pos < len(data):
+            room = min(PAGE_WINDOW - ((addr + pos) % PAGE_WINDOW), BLOCK_MAX_WORDS * 2)
+            blocks.append((addr + pos, bytes(data[pos:pos + room])))
+            pos += room
+    return blocks
+
+
+def make_image(chunks, exec_addr):
+    blocks = make_blocks(chunks)
+    prgm_base = blocks[0][0] if blocks else 0
+    img = bytearray(IMG_MAGIC + struct.pack(">II", exec_addr, prgm_base))
+    for addr, data in blocks:
+        img += struct.pack(">IH", addr, len(data) // 2) + data
+    return img, len(blocks)
+
+
+def write_c_file(img, nblocks, src, filename):
+    with open(filename, "w") as out:
+        print("/*Generated by zl38063_fw2img.py from %s, %d blocks, do not edit*/" % (src, nblocks), file=out)
+        print('#include "zl38063_firmware.h"\n', file=out)
+        print("const unsigned char zl38063_fw_image[] = {", file=out)
+        for i in range(0, len(img), 16):
+            print("    " + " ".join("0x%02x," % b for b in img[i:i + 16]), file=out)
+        print("};", file=out)
+        print("const unsigned long zl38063_fw_image_len = sizeof(zl38063_fw_image);", file=out)
+
+
+if __name__ == '__main__':
+    if len(sys.argv) != 3:
+        print("usage: %s <firmware.s3 | zl38063_firmware.c> <zl38063_firmware.c | image.bin>" % sys.argv[0])
+        sys.exit(1)
+    src, dst = sys.argv[1], sys.argv[2]
+    chunks, exec_addr = parse_c_table(src) if src.endswith(".c") else parse_s3(src)
+    img, nblocks = make_image(chunks, exec_addr)
+    if dst.endswith(".c"):
+        write_c_file(img, nblocks, src.split("/")[-1], dst)
+    else:
+        with open(dst, "wb") as f:
+            f.write(img)
+    print("%d records -> %d blocks, %d bytes, exec 0x%08x" % (len(chunks), nblocks, len(img), exec_addr))
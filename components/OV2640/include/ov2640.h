@@ -98,11 +98,41 @@ extern "C" {
 #define OV2640_SENSOR_HISTO_LOW  0x61
 #define OV2640_SENSOR_HISTO_HIGH 0x62
 
+typedef enum {
+    OV2640_FORMAT_RGB565 = 0,
+    OV2640_FORMAT_RGB565_SWAP,  // 高低字节交换,即OV2640_RGB565_Mode(true)
+    OV2640_FORMAT_YUV422,
+    OV2640_FORMAT_JPEG,
+} ov2640_format_t;
+
+//传感器配置档,对应OV2640_Init + 格式设置 + OV2640_ImageSize_Set/ImageWin_Set/OutSize_Set
+typedef struct {
+    const char *name;
+    uint8_t base;            // 0: SVGA初始化表, 1: UXGA初始化表
+    uint8_t format;          // ov2640_format_t
+    uint16_t image_width;
+    uint16_t image_height;
+    uint16_t win_x;
+    uint16_t win_y;
+    uint16_t win_width;
+    uint16_t win_height;
+    uint16_t out_width;
+    uint16_t out_height;
+} ov2640_profile_t;
+
 uint8_t OV2640_Init(uint8_t mode, uint8_t fre_double_en);
+uint8_t OV2640_Clock_Set(uint8_t div);
+void OV2640_Standby(uint8_t en);
+uint8_t OV2640_Profile_Add(const ov2640_profile_t *profile);
+uint8_t OV2640_Profile_Set(const char *name);
+void OV2640_YUV_Mode(void);
 void OV2640_JPEG_Mode(void);
 void OV2640_RGB565_Mode(uint8_t byte_swap_en);
 void OV2640_Auto_Exposure(uint8_t level);
 void OV2640_Light_Mode(uint8_t mode);
+void OV2640_Exposure_Set(uint16_t aec, uint8_t gain);
+void OV2640_WB_Gain_Set(uint8_t r, uint8_t g, uint8_t b);
+void OV2640_JPEG_Quality_Set(uint8_t qs);
 void OV2640_Color_Saturation(uint8_t sat);
 void OV2640_Brightness(uint8_t bright);
 void OV2640_Contrast(uint8_t contrast);
@@ -112,7 +142,9 @@ void OV2640_Window_Set(uint16_t sx, uint16_t sy, uint16_t width, uint16_t height
 uint8_t OV2640_OutSize_Set(uint16_t width, uint16_t height);
 uint8_t OV2640_ImageWin_Set(uint16_t offx, uint16_t offy, uint16_t width, uint16_t height);
 uint8_t OV2640_ImageSize_Set(uint16_t width, uint16_t height);
+uint8_t OV2640_ROI_Set(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t out_width, uint16_t out_height);
 void OV2640_Mirror(void);
+void OV2640_Flip_Set(uint8_t hmirror, uint8_t vflip);
 
 #ifdef __cplusplus
 }
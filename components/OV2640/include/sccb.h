@@ -13,6 +13,7 @@ void SCCB_Init(void);
 uint8_t SCCB_WR_Byte(uint8_t dat);
 uint8_t SCCB_RD_Byte(void);
 uint8_t SCCB_WR_Reg(uint8_t reg, uint8_t data);
+uint8_t SCCB_WR_Table(const uint8_t (*table)[2], uint16_t cnt);
 uint8_t SCCB_RD_Reg(uint8_t reg);
 
 #ifdef __cplusplus
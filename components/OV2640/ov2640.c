@@ -0,0 +1,646 @@
+#include <stdlib.h>
+#include <string.h>
+#include "ov2640.h"
+#include "ov2640cfg.h"
+#include "sccb.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+
+static const char *TAG = "OV2640";
+
+#define delay_ms(a) vTaskDelay(a / portTICK_RATE_MS);
+
+//初始化OV2640，XCLK输入12MHz时钟
+//配置完以后,默认输出是1600*1200尺寸的图片!!
+//返回值:0,成功
+//    其他,错误代码
+uint8_t OV2640_Init(uint8_t mode, uint8_t fre_double_en)
+{
+    uint16_t reg;
+
+    SCCB_Init();        		//初始化SCCB 的IO口
+     
+    SCCB_WR_Reg(OV2640_DSP_RA_DLMT, 0x01);	//操作sensor寄存器
+    SCCB_WR_Reg(OV2640_SENSOR_COM7, 0x80);	//软复位OV2640
+    delay_ms(50);
+    reg = SCCB_RD_Reg(OV2640_SENSOR_MIDH);	//读取厂家ID 高八位
+    reg <<= 8;
+    reg |= SCCB_RD_Reg(OV2640_SENSOR_MIDL);	//读取厂家ID 低八位
+
+    if (reg != OV2640_MID) {
+        ESP_LOGI(TAG, "MID:%d\r\n", reg);
+        return 1;
+    }
+
+    reg = SCCB_RD_Reg(OV2640_SENSOR_PIDH);	//读取厂家ID 高八位
+    reg <<= 8;
+    reg |= SCCB_RD_Reg(OV2640_SENSOR_PIDL);	//读取厂家ID 低八位
+
+    if (reg != OV2640_PID) {
+        ESP_LOGI(TAG, "HID:%d\r\n", reg);
+        //return 2;
+    }
+
+    if (mode == 0) {
+        //初始化 OV2640,采用SVGA分辨率(800*600)
+        SCCB_WR_Table(ov2640_svga_init_reg_tbl, sizeof(ov2640_svga_init_reg_tbl) / 2);
+    } else {
+        //初始化 OV2640,采用UXGA分辨率(1600*1200)
+        SCCB_WR_Table(ov2640_uxga_init_reg_tbl, sizeof(ov2640_uxga_init_reg_tbl) / 2);
+    }
+
+    if (fre_double_en) {
+        SCCB_WR_Reg(0xFF, 0x01);
+        uint8_t temp = SCCB_RD_Reg(OV2640_SENSOR_CLKRC);	
+        SCCB_WR_Reg(OV2640_SENSOR_CLKRC, temp | 0x80);
+    }
+OV2640_Mirror();	
+    return 0x00; 	//ok
+}
+
+//设置sensor时钟分频, PCLK = XCLK * (倍频 ? 2 : 1) / (div + 1), 帧率随之降低
+//div: 0~63, 保留 OV2640_Init 设置的倍频位
+//返回值:0,成功
+//    1,参数错误
+uint8_t OV2640_Clock_Set(uint8_t div)
+{
+    if (div > 0x3F) {
+        return 1;
+    }
+    SCCB_WR_Reg(0xFF, 0x01);
+    uint8_t temp = SCCB_RD_Reg(OV2640_SENSOR_CLKRC);
+    SCCB_WR_Reg(OV2640_SENSOR_CLKRC, (temp & 0x80) | div);
+    return 0;
+}
+
+//待机模式: COM2[4], 停止输出并关闭模拟电路, 寄存器内容保持
+//退出待机后不需要重新写初始化表, 曝光在 1~2 帧内恢复. SCCB 需要 XCLK: 先进入待机再关 XCLK, 先开 XCLK 再退出待机
+//en: 1,进入待机 0,退出待机
+void OV2640_Standby(uint8_t en)
+{
+    SCCB_WR_Reg(0xFF, 0x01);
+    uint8_t temp = SCCB_RD_Reg(OV2640_SENSOR_COM2);
+    SCCB_WR_Reg(OV2640_SENSOR_COM2, en ? (temp | 0x10) : (temp & ~0x10));
+}
+
+//OV2640切换为YUV模式
+void OV2640_YUV_Mode(void)
+{
+
+    //设置:YUV422格式
+    SCCB_WR_Table(ov2640_yuv422_reg_tbl, sizeof(ov2640_yuv422_reg_tbl) / 2);
+
+}
+
+//OV2640切换为JPEG模式
+void OV2640_JPEG_Mode(void)
+{
+    OV2640_YUV_Mode();
+    SCCB_WR_Reg(0xFF, 0x00);
+    uint8_t temp = SCCB_RD_Reg(OV2640_DSP_IMAGE_MODE);	
+    SCCB_WR_Reg(OV2640_DSP_IMAGE_MODE, temp | 0x10);
+    //设置:输出JPEG数据
+    SCCB_WR_Table(ov2640_jpeg_reg_tbl, sizeof(ov2640_jpeg_reg_tbl) / 2);
+}
+
+//OV2640切换为RGB565模式
+void OV2640_RGB565_Mode(uint8_t byte_swap_en)
+{
+
+    //设置:RGB565输出
+    SCCB_WR_Table(ov2640_rgb565_reg_tbl, sizeof(ov2640_rgb565_reg_tbl) / 2);
+
+    if (byte_swap_en) {
+        SCCB_WR_Reg(0xFF, 0x00);
+        uint8_t temp = SCCB_RD_Reg(OV2640_DSP_IMAGE_MODE);	
+        SCCB_WR_Reg(OV2640_DSP_IMAGE_MODE, temp | 0x01);
+    }
+}
+//自动曝光设置参数表,支持5个等级
+const static uint8_t OV2640_AUTOEXPOSURE_LEVEL[5][8] = {
+    {
+        0xFF, 0x01,
+        0x24, 0x20,
+        0x25, 0x18,
+        0x26, 0x60,
+    },
+    {
+        0xFF, 0x01,
+        0x24, 0x34,
+        0x25, 0x1c,
+        0x26, 0x00,
+    },
+    {
+        0xFF, 0x01,
+        0x24, 0x3e,
+        0x25, 0x38,
+        0x26, 0x81,
+    },
+    {
+        0xFF, 0x01,
+        0x24, 0x48,
+        0x25, 0x40,
+        0x26, 0x81,
+    },
+    {
+        0xFF, 0x01,
+        0x24, 0x58,
+        0x25, 0x50,
+        0x26, 0x92,
+    },
+};
+//OV2640自动曝光等级设置
+//level:0~4
+void OV2640_Auto_Exposure(uint8_t level)
+{
+    uint8_t i;
+    uint8_t *p = (uint8_t *)OV2640_AUTOEXPOSURE_LEVEL[level];
+
+    for (i = 0; i < 4; i++) {
+        SCCB_WR_Reg(p[i * 2], p[i * 2 + 1]);
+    }
+}
+//白平衡设置
+//0:自动
+//1:太阳sunny
+//2,阴天cloudy
+//3,办公室office
+//4,家里home
+void OV2640_Light_Mode(uint8_t mode)
+{
+    uint8_t regccval = 0X5E; //Sunny
+    uint8_t regcdval = 0X41;
+    uint8_t regceval = 0X54;
+
+    switch (mode) {
+        case 0://auto
+            SCCB_WR_Reg(0XFF, 0X00);
+            SCCB_WR_Reg(0XC7, 0X00); //AWB ON
+            return;
+
+        case 2://cloudy
+            regccval = 0X65;
+            regcdval = 0X41;
+            regceval = 0X4F;
+            break;
+
+        case 3://office
+            regccval = 0X52;
+            regcdval = 0X41;
+            regceval = 0X66;
+            break;
+
+        case 4://home
+            regccval = 0X42;
+            regcdval = 0X3F;
+            regceval = 0X71;
+            break;
+    }
+
+    SCCB_WR_Reg(0XFF, 0X00);
+    SCCB_WR_Reg(0XC7, 0X40);	//AWB OFF
+    SCCB_WR_Reg(0XCC, regccval);
+    SCCB_WR_Reg(0XCD, regcdval);
+    SCCB_WR_Reg(0XCE, regceval);
+}
+//手动曝光,供主机侧AE环路使用 (cam_get_stats)
+//aec: 曝光时间,单位为行, gain: AGC增益寄存器值
+//关闭AEC/AGC; COM8已在缓存中时重复写入会被SCCB缓存跳过
+void OV2640_Exposure_Set(uint16_t aec, uint8_t gain)
+{
+    SCCB_WR_Reg(0XFF, 0X01);
+    SCCB_WR_Reg(0X13, 0XE0);	//COM8: AEC/AGC OFF
+    SCCB_WR_Reg(0X04, (SCCB_RD_Reg(0X04) & 0XFC) | (aec & 0X03));
+    SCCB_WR_Reg(0X10, (aec >> 2) & 0XFF);
+    SCCB_WR_Reg(0X45, (SCCB_RD_Reg(0X45) & 0XC0) | ((aec >> 10) & 0X3F));
+    SCCB_WR_Reg(0X00, gain);
+}
+//JPEG量化系数(DSP QS寄存器),越小画质越好、帧越大,默认0X0C
+//供码率控制逐帧调整,未变化的值由SCCB缓存跳过
+void OV2640_JPEG_Quality_Set(uint8_t qs)
+{
+    SCCB_WR_Reg(0XFF, 0X00);
+    SCCB_WR_Reg(0X44, qs);
+}
+//手动白平衡增益,供主机侧AWB环路使用,0X40左右为1倍
+//未变化的增益由SCCB缓存跳过
+void OV2640_WB_Gain_Set(uint8_t r, uint8_t g, uint8_t b)
+{
+    SCCB_WR_Reg(0XFF, 0X00);
+    SCCB_WR_Reg(0XC7, 0X40);	//AWB OFF
+    SCCB_WR_Reg(0XCC, r);
+    SCCB_WR_Reg(0XCD, g);
+    SCCB_WR_Reg(0XCE, b);
+}
+//色度设置
+//0:-2
+//1:-1
+//2,0
+//3,+1
+//4,+2
+void OV2640_Color_Saturation(uint8_t sat)
+{
+    uint8_t reg7dval = ((sat + 2) << 4) | 0X08;
+    SCCB_WR_Reg(0XFF, 0X00);
+    SCCB_WR_Reg(0X7C, 0X00);
+    SCCB_WR_Reg(0X7D, 0X02);
+    SCCB_WR_Reg(0X7C, 0X03);
+    SCCB_WR_Reg(0X7D, reg7dval);
+    SCCB_WR_Reg(0X7D, reg7dval);
+}
+//亮度设置
+//0:(0X00)-2
+//1:(0X10)-1
+//2,(0X20) 0
+//3,(0X30)+1
+//4,(0X40)+2
+void OV2640_Brightness(uint8_t bright)
+{
+    SCCB_WR_Reg(0xff, 0x00);
+    SCCB_WR_Reg(0x7c, 0x00);
+    SCCB_WR_Reg(0x7d, 0x04);
+    SCCB_WR_Reg(0x7c, 0x09);
+    SCCB_WR_Reg(0x7d, bright << 4);
+    SCCB_WR_Reg(0x7d, 0x00);
+}
+//对比度设置
+//0:-2
+//1:-1
+//2,0
+//3,+1
+//4,+2
+void OV2640_Contrast(uint8_t contrast)
+{
+    uint8_t reg7d0val = 0X20; //默认为普通模式
+    uint8_t reg7d1val = 0X20;
+
+    switch (contrast) {
+        case 0://-2
+            reg7d0val = 0X18;
+            reg7d1val = 0X34;
+            break;
+
+        case 1://-1
+            reg7d0val = 0X1C;
+            reg7d1val = 0X2A;
+            break;
+
+        case 3://1
+            reg7d0val = 0X24;
+            reg7d1val = 0X16;
+            break;
+
+        case 4://2
+            reg7d0val = 0X28;
+            reg7d1val = 0X0C;
+            break;
+    }
+
+    SCCB_WR_Reg(0xff, 0x00);
+    SCCB_WR_Reg(0x7c, 0x00);
+    SCCB_WR_Reg(0x7d, 0x04);
+    SCCB_WR_Reg(0x7c, 0x07);
+    SCCB_WR_Reg(0x7d, 0x20);
+    SCCB_WR_Reg(0x7d, reg7d0val);
+    SCCB_WR_Reg(0x7d, reg7d1val);
+    SCCB_WR_Reg(0x7d, 0x06);
+}
+//特效设置
+//0:普通模式
+//1,负片
+//2,黑白
+//3,偏红色
+//4,偏绿色
+//5,偏蓝色
+//6,复古
+void OV2640_Special_Effects(uint8_t eft)
+{
+    uint8_t reg7d0val = 0X00; //默认为普通模式
+    uint8_t reg7d1val = 0X80;
+    uint8_t reg7d2val = 0X80;
+
+    switch (eft) {
+        case 1://负片
+            reg7d0val = 0X40;
+            break;
+
+        case 2://黑白
+            reg7d0val = 0X18;
+            break;
+
+        case 3://偏红色
+            reg7d0val = 0X18;
+            reg7d1val = 0X40;
+            reg7d2val = 0XC0;
+            break;
+
+        case 4://偏绿色
+            reg7d0val = 0X18;
+            reg7d1val = 0X40;
+            reg7d2val = 0X40;
+            break;
+
+        case 5://偏蓝色
+            reg7d0val = 0X18;
+            reg7d1val = 0XA0;
+            reg7d2val = 0X40;
+            break;
+
+        case 6://复古
+            reg7d0val = 0X18;
+            reg7d1val = 0X40;
+            reg7d2val = 0XA6;
+            break;
+    }
+
+    SCCB_WR_Reg(0xff, 0x00);
+    SCCB_WR_Reg(0x7c, 0x00);
+    SCCB_WR_Reg(0x7d, reg7d0val);
+    SCCB_WR_Reg(0x7c, 0x05);
+    SCCB_WR_Reg(0x7d, reg7d1val);
+    SCCB_WR_Reg(0x7d, reg7d2val);
+}
+//镜像/翻转设置,只改REG04的镜像位,保留AEC低位
+//hmirror: 1,左右镜像  vflip: 1,上下翻转
+//预览的镜像也可以交给LCD(lcd_set_rotation),采集的帧就不带镜像
+void OV2640_Flip_Set(uint8_t hmirror, uint8_t vflip)
+{
+    SCCB_WR_Reg(0XFF, 0X01);
+    uint8_t reg = SCCB_RD_Reg(0X04) & ~0XD0;
+    if (hmirror) {
+        reg |= 0X80;
+    }
+    if (vflip) {
+        reg |= 0X50;	//VFLIP需同时设置VREF位
+    }
+    SCCB_WR_Reg(0X04, reg);
+}
+void OV2640_Mirror(void)
+{
+    SCCB_WR_Reg(0xff, 0x01);
+    SCCB_WR_Reg(0x04, 0xa0);
+    SCCB_WR_Reg(0x08, 0xa0);
+}
+
+//彩条测试
+//sw:0,关闭彩条
+//   1,开启彩条(注意OV2640的彩条是叠加在图像上面的)
+void OV2640_Color_Bar(uint8_t sw)
+{
+    uint8_t reg;
+    SCCB_WR_Reg(0XFF, 0X01);
+    reg = SCCB_RD_Reg(0X12);
+    reg &= ~(1 << 1);
+
+    if (sw) {
+        reg |= 1 << 1;
+    }
+
+    SCCB_WR_Reg(0X12, reg);
+}
+//设置传感器输出窗口
+//sx,sy,起始地址
+//width,height:宽度(对应:horizontal)和高度(对应:vertical)
+void OV2640_Window_Set(uint16_t sx, uint16_t sy, uint16_t width, uint16_t height)
+{
+    uint16_t endx;
+    uint16_t endy;
+    uint8_t temp;
+    endx = sx + width / 2;	//V*2
+    endy = sy + height / 2;
+
+    SCCB_WR_Reg(0XFF, 0X01);
+    temp = SCCB_RD_Reg(0X03);				//读取Vref之前的值
+    temp &= 0XF0;
+    temp |= ((endy & 0X03) << 2) | (sy & 0X03);
+    SCCB_WR_Reg(0X03, temp);				//设置Vref的start和end的最低2位
+    SCCB_WR_Reg(0X19, sy >> 2);			//设置Vref的start高8位
+    SCCB_WR_Reg(0X1A, endy >> 2);			//设置Vref的end的高8位
+
+    temp = SCCB_RD_Reg(0X32);				//读取Href之前的值
+    temp &= 0XC0;
+    temp |= ((endx & 0X07) << 3) | (sx & 0X07);
+    SCCB_WR_Reg(0X32, temp);				//设置Href的start和end的最低3位
+    SCCB_WR_Reg(0X17, sx >> 3);			//设置Href的start高8位
+    SCCB_WR_Reg(0X18, endx >> 3);			//设置Href的end的高8位
+}
+static int ov2640_table_append(uint8_t (*table)[2], const uint8_t (*src)[2], int cnt)
+{
+    memcpy(table, src, cnt * 2);
+    return cnt;
+}
+
+//以下函数把尺寸设置的寄存器写操作填入表中,返回寄存器个数
+static int ov2640_outsize_regs(uint8_t (*table)[2], uint16_t width, uint16_t height)
+{
+    uint16_t outw = width / 4;
+    uint16_t outh = height / 4;
+    uint8_t temp = (outw >> 8) & 0X03;
+    temp |= (outh >> 6) & 0X04;
+    const uint8_t regs[6][2] = {
+        {0XFF, 0X00},
+        {0XE0, 0X04},
+        {0X5A, outw & 0XFF},		//设置OUTW的低八位
+        {0X5B, outh & 0XFF},		//设置OUTH的低八位
+        {0X5C, temp},				//设置OUTH/OUTW的高位
+        {0XE0, 0X00},
+    };
+    return ov2640_table_append(table, regs, 6);
+}
+
+static int ov2640_imagewin_regs(uint8_t (*table)[2], uint16_t offx, uint16_t offy, uint16_t width, uint16_t height)
+{
+    uint16_t hsize = width / 4;
+    uint16_t vsize = height / 4;
+    uint8_t temp = (vsize >> 1) & 0X80;
+    temp |= (offy >> 4) & 0X70;
+    temp |= (hsize >> 5) & 0X08;
+    temp |= (offx >> 8) & 0X07;
+    const uint8_t regs[9][2] = {
+        {0XFF, 0X00},
+        {0XE0, 0X04},
+        {0X51, hsize & 0XFF},		//设置H_SIZE的低八位
+        {0X52, vsize & 0XFF},		//设置V_SIZE的低八位
+        {0X53, offx & 0XFF},		//设置offx的低八位
+        {0X54, offy & 0XFF},		//设置offy的低八位
+        {0X55, temp},				//设置H_SIZE/V_SIZE/OFFX,OFFY的高位
+        {0X57, (hsize >> 2) & 0X80},	//设置H_SIZE/V_SIZE/OFFX,OFFY的高位
+        {0XE0, 0X00},
+    };
+    return ov2640_table_append(table, regs, 9);
+}
+
+static int ov2640_imagesize_regs(uint8_t (*table)[2], uint16_t width, uint16_t height)
+{
+    uint8_t temp = (width & 0X07) << 3;
+    temp |= height & 0X07;
+    temp |= (width >> 4) & 0X80;
+    const uint8_t regs[6][2] = {
+        {0XFF, 0X00},
+        {0XE0, 0X04},
+        {0XC0, (width) >> 3 & 0XFF},		//设置HSIZE的10:3位
+        {0XC1, (height) >> 3 & 0XFF},		//设置VSIZE的10:3位
+        {0X8C, temp},
+        {0XE0, 0X00},
+    };
+    return ov2640_table_append(table, regs, 6);
+}
+
+//设置图像输出大小
+//OV2640输出图像的大小(分辨率),完全由该函数确定
+//width,height:宽度(对应:horizontal)和高度(对应:vertical),width和height必须是4的倍数
+//返回值:0,设置成功
+//    其他,设置失败
+uint8_t OV2640_OutSize_Set(uint16_t width, uint16_t height)
+{
+    if (width % 4) {
+        return 1;
+    }
+
+    if (height % 4) {
+        return 2;
+    }
+
+    uint8_t table[6][2];
+    SCCB_WR_Table((const uint8_t (*)[2])table, ov2640_outsize_regs(table, width, height));
+    return 0;
+}
+//设置感兴趣区域(ROI),开窗和缩放都由传感器DSP完成
+//x,y,width,height:ROI在OV2640_ImageSize_Set图像中的位置和大小,会向外扩展到4的倍数
+//out_width,out_height:输出大小,必须是4的倍数且不大于ROI
+//返回值:0,设置成功
+//    其他,设置失败
+uint8_t OV2640_ROI_Set(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t out_width, uint16_t out_height)
+{
+    uint8_t ret;
+
+    if (out_width > width || out_height > height) {
+        return 3;
+    }
+
+    ret = OV2640_ImageWin_Set(x & ~0x3, y & ~0x3, (width + (x & 0x3) + 3) & ~0x3, (height + (y & 0x3) + 3) & ~0x3);
+    if (ret) {
+        return ret;
+    }
+    return OV2640_OutSize_Set(out_width, out_height);
+}
+//设置图像开窗大小
+//由:OV2640_ImageSize_Set确定传感器输出分辨率从大小.
+//该函数则在这个范围上面进行开窗,用于OV2640_OutSize_Set的输出
+//注意:本函数的宽度和高度,必须大于等于OV2640_OutSize_Set函数的宽度和高度
+//     OV2640_OutSize_Set设置的宽度和高度,根据本函数设置的宽度和高度,由DSP
+//     自动计算缩放比例,输出给外部设备.
+//width,height:宽度(对应:horizontal)和高度(对应:vertical),width和height必须是4的倍数
+//返回值:0,设置成功
+//    其他,设置失败
+uint8_t OV2640_ImageWin_Set(uint16_t offx, uint16_t offy, uint16_t width, uint16_t height)
+{
+    if (width % 4) {
+        return 1;
+    }
+
+    if (height % 4) {
+        return 2;
+    }
+
+    uint8_t table[9][2];
+    SCCB_WR_Table((const uint8_t (*)[2])table, ov2640_imagewin_regs(table, offx, offy, width, height));
+    return 0;
+}
+//该函数设置图像尺寸大小,也就是所选格式的输出分辨率
+//UXGA:1600*1200,SVGA:800*600,CIF:352*288
+//width,height:图像宽度和图像高度
+//返回值:0,设置成功
+//    其他,设置失败
+uint8_t OV2640_ImageSize_Set(uint16_t width, uint16_t height)
+{
+    uint8_t table[6][2];
+    SCCB_WR_Table((const uint8_t (*)[2])table, ov2640_imagesize_regs(table, width, height));
+    return 0;
+}
+
+//传感器配置档:按名字保存编译好的寄存器表,切换时只写与当前寄存器值不同的项(由SCCB影子缓存过滤)
+#define OV2640_PROFILE_MAX  8
+
+typedef struct {
+    const char *name;
+    uint8_t (*table)[2];
+    uint16_t cnt;
+} ov2640_profile_entry_t;
+
+static ov2640_profile_entry_t ov2640_profile[OV2640_PROFILE_MAX];
+
+//编译配置档,返回寄存器个数
+static int ov2640_profile_compile(const ov2640_profile_t *profile, uint8_t (*table)[2])
+{
+    int n = 0;
+    if (profile->base == 0) {
+        n += ov2640_table_append(&table[n], ov2640_svga_init_reg_tbl, sizeof(ov2640_svga_init_reg_tbl) / 2);
+    } else {
+        n += ov2640_table_append(&table[n], ov2640_uxga_init_reg_tbl, sizeof(ov2640_uxga_init_reg_tbl) / 2);
+    }
+    switch (profile->format) {
+        case OV2640_FORMAT_RGB565:
+        case OV2640_FORMAT_RGB565_SWAP:
+            n += ov2640_table_append(&table[n], ov2640_rgb565_reg_tbl, sizeof(ov2640_rgb565_reg_tbl) / 2);
+            if (profile->format == OV2640_FORMAT_RGB565_SWAP) {
+                table[n][0] = 0xFF; table[n++][1] = 0x00;
+                table[n][0] = OV2640_DSP_IMAGE_MODE; table[n++][1] = 0x09; //ov2640_rgb565_reg_tbl中为0x08
+            }
+            break;
+        case OV2640_FORMAT_YUV422:
+            n += ov2640_table_append(&table[n], ov2640_yuv422_reg_tbl, sizeof(ov2640_yuv422_reg_tbl) / 2);
+            break;
+        case OV2640_FORMAT_JPEG:
+            n += ov2640_table_append(&table[n], ov2640_yuv422_reg_tbl, sizeof(ov2640_yuv422_reg_tbl) / 2);
+            n += ov2640_table_append(&table[n], ov2640_jpeg_reg_tbl, sizeof(ov2640_jpeg_reg_tbl) / 2);
+            break;
+    }
+    n += ov2640_imagesize_regs(&table[n], profile->image_width, profile->image_height);
+    n += ov2640_imagewin_regs(&table[n], profile->win_x, profile->win_y, profile->win_width, profile->win_height);
+    n += ov2640_outsize_regs(&table[n], profile->out_width, profile->out_height);
+    return n;
+}
+
+//添加配置档,profile->name需一直有效
+//返回值:0,成功
+//    其他,失败
+uint8_t OV2640_Profile_Add(const ov2640_profile_t *profile)
+{
+    if ((profile->win_width % 4) || (profile->win_height % 4) || (profile->out_width % 4) || (profile->out_height % 4)) {
+        return 1;
+    }
+    for (int i = 0; i < OV2640_PROFILE_MAX; i++) {
+        if (ov2640_profile[i].name) {
+            continue;
+        }
+        int max = sizeof(ov2640_uxga_init_reg_tbl) / 2 + sizeof(ov2640_svga_init_reg_tbl) / 2 + 32;
+        uint8_t (*table)[2] = malloc(max * 2);
+        if (!table) {
+            return 2;
+        }
+        ov2640_profile[i].cnt = ov2640_profile_compile(profile, table);
+        ov2640_profile[i].table = realloc(table, ov2640_profile[i].cnt * 2);
+        if (!ov2640_profile[i].table) {
+            ov2640_profile[i].table = table;
+        }
+        ov2640_profile[i].name = profile->name;
+        ESP_LOGI(TAG, "profile %s: %d regs\n", profile->name, ov2640_profile[i].cnt);
+        return 0;
+    }
+    return 3;
+}
+
+//切换到配置档,只写与当前状态不同的寄存器
+//返回值:0,成功
+//    其他,失败
+uint8_t OV2640_Profile_Set(const char *name)
+{
+    for (int i = 0; i < OV2640_PROFILE_MAX; i++) {
+        if (ov2640_profile[i].name && strcmp(ov2640_profile[i].name, name) == 0) {
+            return SCCB_WR_Table((const uint8_t (*)[2])ov2640_profile[i].table, ov2640_profile[i].cnt);
+        }
+    }
+    return 1;
+}
\ No newline at end of file
@@ -0,0 +1,193 @@
+#include "sccb.h"
+#include <string.h>
+#include "driver/i2c.h"
+#include "i2c_arb.h"
+
+int i2c_master_port = 1;
+
+#define SCL   GPIO_NUM_7
+#define SDA   GPIO_NUM_8
+
+#define WRITE_BIT                          I2C_MASTER_WRITE /*!< I2C master write */
+#define READ_BIT                           I2C_MASTER_READ  /*!< I2C master read */
+#define ACK_CHECK_EN                       0x1              /*!< I2C master will check ack from slave*/
+#define ACK_CHECK_DIS                      0x0              /*!< I2C master will not check ack from slave */
+#define ACK_VAL                            0x0              /*!< I2C ack value */
+#define NACK_VAL                           0x1              /*!< I2C nack value */
+
+#define SCCB_BANK_REG     0xFF    // 0: DSP 寄存器组, 1: sensor 寄存器组
+#define SCCB_BATCH_MAX    32      // 每个 cmd link 打包的写操作数, 也是其他设备插队前最多等待的写操作数
+#define SCCB_PRIORITY     1       // 寄存器表加载是批量操作, 让位于音频 codec 等对延迟敏感的设备
+#define SCCB_TIMEOUT_MS   1000
+
+static i2c_arb_dev_t *sccb_dev = NULL; // Kaluga 上与音频 codec 共用 GPIO 7/8
+
+// 寄存器影子缓存,跳过与芯片当前值相同的写操作
+static uint8_t sccb_cache[2][256];
+static uint8_t sccb_cache_valid[2][256 / 8];
+static int sccb_bank = -1;        // -1: 未知
+
+static void sccb_cache_invalidate(void)
+{
+    memset(sccb_cache_valid, 0, sizeof(sccb_cache_valid));
+    sccb_bank = -1;
+}
+
+// 复位寄存器、间接访问端口以及AEC/AGC自动修改的寄存器每次都要写
+static int sccb_cache_volatile(int bank, uint8_t reg)
+{
+    if (bank == 0) {
+        return reg == 0xE0 || reg == 0x7C || reg == 0x7D;
+    }
+    return reg == 0x12 || reg == 0x00 || reg == 0x04 || reg == 0x10 || reg == 0x45;
+}
+
+// 返回1表示该写操作可以跳过,否则更新缓存
+static int sccb_cache_update(uint8_t reg, uint8_t data)
+{
+    if (reg == SCCB_BANK_REG) {
+        if (sccb_bank == (data & 0x01)) {
+            return 1;
+        }
+        sccb_bank = data & 0x01;
+        return 0;
+    }
+    if (sccb_bank < 0) {
+        return 0;
+    }
+    if (sccb_cache_volatile(sccb_bank, reg)) {
+        if (sccb_bank == 1 && (data & 0x80)) {
+            sccb_cache_invalidate(); // COM7 软复位, 恢复默认值
+            sccb_bank = 1;
+        }
+        return 0;
+    }
+    uint8_t *valid = &sccb_cache_valid[sccb_bank][reg / 8];
+    if ((*valid & (1 << (reg % 8))) && sccb_cache[sccb_bank][reg] == data) {
+        return 1;
+    }
+    sccb_cache[sccb_bank][reg] = data;
+    *valid |= 1 << (reg % 8);
+    return 0;
+}
+
+//初始化SCCB接口 
+void SCCB_Init(void)
+{											      	 
+  i2c_arb_config_t config;
+  config.name = "sccb";
+  config.port = i2c_master_port;
+  config.conf.mode = I2C_MODE_MASTER;
+  config.conf.sda_io_num = SDA;
+  config.conf.sda_pullup_en = GPIO_PULLUP_ENABLE;
+  config.conf.scl_io_num = SCL;
+  config.conf.scl_pullup_en = GPIO_PULLUP_ENABLE;
+  config.conf.master.clk_speed = 200000;
+  config.priority = SCCB_PRIORITY;
+  if (!sccb_dev) {
+    sccb_dev = i2c_arb_add(&config);
+  }
+}			 
+
+//写寄存器
+//返回值:0,成功;1,失败.
+uint8_t SCCB_WR_Reg(uint8_t reg, uint8_t data)
+{
+    esp_err_t ret = ESP_FAIL;
+    if (sccb_cache_update(reg, data)) {
+        return 0;
+    }
+    i2c_cmd_handle_t cmd = i2c_cmd_link_create();
+    i2c_master_start(cmd);
+    i2c_master_write_byte(cmd, SCCB_ID | WRITE_BIT, ACK_CHECK_EN);
+    i2c_master_write_byte(cmd, reg, ACK_CHECK_EN);
+    i2c_master_write_byte(cmd, data, ACK_CHECK_EN);
+    i2c_master_stop(cmd);
+    ret = i2c_arb_cmd_begin(sccb_dev, cmd, SCCB_TIMEOUT_MS);
+    i2c_cmd_link_delete(cmd);
+    if (ret != ESP_OK) {
+        sccb_cache_invalidate(); // 芯片状态未知
+    }
+    return ret == ESP_OK ? 0 : 1;
+}
+
+//批量写寄存器表,每SCCB_BATCH_MAX个写操作打包到一个cmd link,跳过缓存中相同的值
+//返回值:0,成功;1,失败.
+uint8_t SCCB_WR_Table(const uint8_t (*table)[2], uint16_t cnt)
+{
+    esp_err_t ret = ESP_OK;
+    uint16_t i = 0;
+
+    while (i < cnt && ret == ESP_OK) {
+        i2c_cmd_handle_t cmd = i2c_cmd_link_create();
+        int num = 0;
+        for (; i < cnt && num < SCCB_BATCH_MAX; i++) {
+            if (sccb_cache_update(table[i][0], table[i][1])) {
+                continue;
+            }
+            i2c_master_start(cmd);
+            i2c_master_write_byte(cmd, SCCB_ID | WRITE_BIT, ACK_CHECK_EN);
+            i2c_master_write_byte(cmd, table[i][0], ACK_CHECK_EN);
+            i2c_master_write_byte(cmd, table[i][1], ACK_CHECK_EN);
+            i2c_master_stop(cmd);
+            num++;
+        }
+        if (num) {
+            ret = i2c_arb_cmd_begin(sccb_dev, cmd, SCCB_TIMEOUT_MS); // 每批之间总线可以让给优先级更高的设备
+        }
+        i2c_cmd_link_delete(cmd);
+    }
+    if (ret != ESP_OK) {
+        sccb_cache_invalidate();
+    }
+    return ret == ESP_OK ? 0 : 1;
+}
+//读寄存器
+//返回值:读到的寄存器值
+uint8_t SCCB_RD_Reg(uint8_t reg)
+{
+    uint8_t val = 0;
+    esp_err_t ret = i2c_arb_acquire(sccb_dev, SCCB_TIMEOUT_MS); // 写地址和读数据之间不让出总线
+    if (ret != ESP_OK) return -1;
+    i2c_cmd_handle_t cmd = i2c_cmd_link_create();
+    i2c_master_start(cmd);
+    i2c_master_write_byte(cmd, SCCB_ID | WRITE_BIT, ACK_CHECK_EN);
+    i2c_master_write_byte(cmd, reg, ACK_CHECK_EN);
+    i2c_master_stop(cmd);
+    ret = i2c_arb_cmd_begin(sccb_dev, cmd, SCCB_TIMEOUT_MS);
+    i2c_cmd_link_delete(cmd);
+    if (ret != ESP_OK) {
+        i2c_arb_release(sccb_dev);
+        return -1;
+    }
+    cmd = i2c_cmd_link_create();
+    i2c_master_start(cmd);
+    i2c_master_write_byte(cmd, SCCB_ID | READ_BIT, ACK_CHECK_EN);
+    i2c_master_read_byte(cmd, &val, NACK_VAL);
+    i2c_master_stop(cmd);
+    ret = i2c_arb_cmd_begin(sccb_dev, cmd, SCCB_TIMEOUT_MS);
+    i2c_cmd_link_delete(cmd);
+    i2c_arb_release(sccb_dev);
+
+    if (ret != ESP_OK) {
+        printf("SCCB_RD_Reg error\n");
+    }
+
+    return val;
+}
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
@@ -0,0 +1,446 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "recorder.h"
+#include "avi_mux.h"
+
+static const char *TAG = "avi_mux";
+
+#define AVI_FOURCC(a, b, c, d) ((uint32_t)(a) | ((uint32_t)(b) << 8) | ((uint32_t)(c) << 16) | ((uint32_t)(d) << 24))
+#define AVI_VIDEO_ID      AVI_FOURCC('0', '0', 'd', 'c')
+#define AVI_AUDIO_ID      AVI_FOURCC('0', '1', 'w', 'b')
+#define AVIF_HASINDEX     (0x10)
+#define AVIF_ISINTERLEAVED (0x100)
+#define AVIIF_KEYFRAME    (0x10)
+#define AVI_HEADER_MAX    (384)
+#define AVI_AUDIO_SLACK   (40 * 1000) // us of audio timestamp jitter tolerated before padding or trimming
+
+typedef struct {
+    uint32_t ckid;
+    uint32_t flags;
+    uint32_t offset;  // from the movi fourcc
+    uint32_t size;
+} avi_mux_index_t;
+
+typedef struct {
+    avi_mux_config_t config;
+    char path[64];
+    SemaphoreHandle_t lock;
+    avi_mux_index_t *index;
+    uint32_t index_max;
+    uint32_t index_cnt;
+    uint32_t header_size;
+    uint32_t movi_len;        // bytes after the movi fourcc
+    uint32_t frames;          // video chunks, empty ones included
+    uint32_t max_video;
+    uint32_t dropped;
+    uint8_t started;
+    int64_t start;            // capture time of the first frame, time 0 of both streams
+    uint32_t unit;            // audio block align
+    uint32_t unit_samples;    // samples per channel in one unit
+    uint32_t byte_rate;
+    uint32_t audio_bytes;     // audio written to the file
+    uint32_t max_audio;
+    uint8_t *audio_buf;
+    uint32_t audio_size;
+    uint32_t audio_len;       // staged, follows audio_bytes on the timeline
+} avi_mux_obj_t;
+
+static avi_mux_obj_t *avi_mux_obj = NULL;
+
+static inline uint8_t *avi_put16(uint8_t *p, uint16_t v)
+{
+    p[0] = v & 0xFF;
+    p[1] = v >> 8;
+    return p + 2;
+}
+
+static inline uint8_t *avi_put32(uint8_t *p, uint32_t v)
+{
+    p[0] = v & 0xFF;
+    p[1] = (v >> 8) & 0xFF;
+    p[2] = (v >> 16) & 0xFF;
+    p[3] = v >> 24;
+    return p + 4;
+}
+
+static uint8_t *avi_put_list(uint8_t *p, uint8_t **size, uint32_t type)
+{
+    p = avi_put32(p, AVI_FOURCC('L', 'I', 'S', 'T'));
+    *size = p;
+    p = avi_put32(p, 0);
+    return avi_put32(p, type);
+}
+
+static inline void avi_end_list(uint8_t *size, uint8_t *end)
+{
+    avi_put32(size, end - size - 4);
+}
+
+// RIFF, hdrl and the movi list head with the counts so far, the same size at start and stop
+static uint32_t avi_mux_header(uint8_t *buf)
+{
+    avi_mux_config_t *config = &avi_mux_obj->config;
+    uint32_t file_len = avi_mux_obj->header_size + avi_mux_obj->movi_len + 8 + avi_mux_obj->index_cnt * sizeof(avi_mux_index_t);
+    uint32_t duration_ms = avi_mux_obj->frames * 1000 / config->fps;
+    uint8_t *p = buf;
+    uint8_t *hdrl, *strl;
+
+    p = avi_put32(p, AVI_FOURCC('R', 'I', 'F', 'F'));
+    p = avi_put32(p, file_len - 8);
+    p = avi_put32(p, AVI_FOURCC('A', 'V', 'I', ' '));
+    p = avi_put_list(p, &hdrl, AVI_FOURCC('h', 'd', 'r', 'l'));
+
+    p = avi_put32(p, AVI_FOURCC('a', 'v', 'i', 'h'));
+    p = avi_put32(p, 56);
+    p = avi_put32(p, 1000000 / config->fps);
+    p = avi_put32(p, duration_ms ? (uint64_t)avi_mux_obj->movi_len * 1000 / duration_ms : 0);
+    p = avi_put32(p, 0);
+    p = avi_put32(p, AVIF_HASINDEX | AVIF_ISINTERLEAVED);
+    p = avi_put32(p, avi_mux_obj->frames);
+    p = avi_put32(p, 0);
+    p = avi_put32(p, config->audio ? 2 : 1);
+    p = avi_put32(p, avi_mux_obj->max_video + 8);
+    p = avi_put32(p, config->width);
+    p = avi_put32(p, config->high);
+    memset(p, 0, 16);
+    p += 16;
+
+    p = avi_put_list(p, &strl, AVI_FOURCC('s', 't', 'r', 'l'));
+    p = avi_put32(p, AVI_FOURCC('s', 't', 'r', 'h'));
+    p = avi_put32(p, 56);
+    p = avi_put32(p, AVI_FOURCC('v', 'i', 'd', 's'));
+    p = avi_put32(p, AVI_FOURCC('M', 'J', 'P', 'G'));
+    p = avi_put32(p, 0);          // flags
+    p = avi_put32(p, 0);          // priority, language
+    p = avi_put32(p, 0);          // initial frames
+    p = avi_put32(p, 1);          // scale
+    p = avi_put32(p, config->fps); // rate
+    p = avi_put32(p, 0);          // start
+    p = avi_put32(p, avi_mux_obj->frames);
+    p = avi_put32(p, avi_mux_obj->max_video);
+    p = avi_put32(p, 0xFFFFFFFF); // quality
+    p = avi_put32(p, 0);          // sample size
+    p = avi_put16(p, 0);
+    p = avi_put16(p, 0);
+    p = avi_put16(p, config->width);
+    p = avi_put16(p, config->high);
+    p = avi_put32(p, AVI_FOURCC('s', 't', 'r', 'f'));
+    p = avi_put32(p, 40);         // BITMAPINFOHEADER
+    p = avi_put32(p, 40);
+    p = avi_put32(p, config->width);
+    p = avi_put32(p, config->high);
+    p = avi_put16(p, 1);
+    p = avi_put16(p, 24);
+    p = avi_put32(p, AVI_FOURCC('M', 'J', 'P', 'G'));
+    p = avi_put32(p, config->width * config->high * 3);
+    memset(p, 0, 16);
+    p += 16;
+    avi_end_list(strl, p);
+
+    if (config->audio) {
+        int adpcm = config->audio == AVI_AUDIO_ADPCM;
+        p = avi_put_list(p, &strl, AVI_FOURCC('s', 't', 'r', 'l'));
+        p = avi_put32(p, AVI_FOURCC('s', 't', 'r', 'h'));
+        p = avi_put32(p, 56);
+        p = avi_put32(p, AVI_FOURCC('a', 'u', 'd', 's'));
+        p = avi_put32(p, 0);
+        p = avi_put32(p, 0);
+        p = avi_put32(p, 0);
+        p = avi_put32(p, 0);
+        p = avi_put32(p, avi_mux_obj->unit);      // scale
+        p = avi_put32(p, avi_mux_obj->byte_rate); // rate
+        p = avi_put32(p, 0);
+        p = avi_put32(p, avi_mux_obj->audio_bytes / avi_mux_obj->unit);
+        p = avi_put32(p, avi_mux_obj->max_audio);
+        p = avi_put32(p, 0xFFFFFFFF);
+        p = avi_put32(p, avi_mux_obj->unit);      // sample size
+        memset(p, 0, 8);
+        p += 8;
+        p = avi_put32(p, AVI_FOURCC('s', 't', 'r', 'f'));
+        p = avi_put32(p, adpcm ? 20 : 16);        // WAVEFORMATEX
+        p = avi_put16(p, adpcm ? 0x11 : 1);
+        p = avi_put16(p, config->channels);
+        p = avi_put32(p, config->sample_rate);
+        p = avi_put32(p, avi_mux_obj->byte_rate);
+        p = avi_put16(p, avi_mux_obj->unit);
+        p = avi_put16(p, adpcm ? 4 : 16);
+        if (adpcm) {
+            p = avi_put16(p, 2);
+            p = avi_put16(p, config->block_samples);
+        }
+        avi_end_list(strl, p);
+    }
+    avi_end_list(hdrl, p);
+
+    p = avi_put32(p, AVI_FOURCC('L', 'I', 'S', 'T'));
+    p = avi_put32(p, 4 + avi_mux_obj->movi_len);
+    p = avi_put32(p, AVI_FOURCC('m', 'o', 'v', 'i'));
+    return p - buf;
+}
+
+static int avi_mux_put_chunk(uint32_t ckid, const uint8_t *data, uint32_t len, uint32_t flags)
+{
+    if (avi_mux_obj->index_cnt >= avi_mux_obj->index_max) {
+        return -1;
+    }
+    uint8_t head[8];
+    avi_put32(avi_put32(head, ckid), len);
+    // chunks start on even offsets
+    recorder_iov_t iov[3] = {
+        {.buf = head, .len = 8},
+        {.buf = data, .len = len},
+        {.buf = "", .len = len & 1},
+    };
+    if (recorder_writev(iov, 3) != 0) {
+        return -1;
+    }
+    avi_mux_index_t *entry = &avi_mux_obj->index[avi_mux_obj->index_cnt++];
+    entry->ckid = ckid;
+    entry->flags = flags;
+    entry->offset = 4 + avi_mux_obj->movi_len;
+    entry->size = len;
+    avi_mux_obj->movi_len += 8 + len + (len & 1);
+    return 0;
+}
+
+static inline int64_t avi_mux_audio_time(uint32_t bytes)
+{
+    return avi_mux_obj->start + (int64_t)(bytes / avi_mux_obj->unit) * avi_mux_obj->unit_samples * 1000000 / avi_mux_obj->config.sample_rate;
+}
+
+// Whole units of audio in us
+static inline uint32_t avi_mux_audio_bytes(int64_t us)
+{
+    return us * avi_mux_obj->config.sample_rate / 1000000 / avi_mux_obj->unit_samples * avi_mux_obj->unit;
+}
+
+// Write the first len staged bytes as one chunk, they stay staged if the recorder is busy
+static void avi_mux_flush_audio(uint32_t len)
+{
+    if (!len || avi_mux_put_chunk(AVI_AUDIO_ID, avi_mux_obj->audio_buf, len, AVIIF_KEYFRAME) != 0) {
+        return;
+    }
+    avi_mux_obj->audio_bytes += len;
+    avi_mux_obj->audio_len -= len;
+    memmove(avi_mux_obj->audio_buf, avi_mux_obj->audio_buf + len, avi_mux_obj->audio_len);
+    if (len > avi_mux_obj->max_audio) {
+        avi_mux_obj->max_audio = len;
+    }
+}
+
+// Stage audio, data NULL: silence. Zero bytes are silence in PCM and in IMA ADPCM blocks as well
+static void avi_mux_stage_audio(const uint8_t *data, uint32_t len)
+{
+    while (len) {
+        if (avi_mux_obj->audio_len == avi_mux_obj->audio_size) {
+            avi_mux_flush_audio(avi_mux_obj->audio_len);
+            if (avi_mux_obj->audio_len == avi_mux_obj->audio_size) {
+                // 写不进去时丢掉暂存的音频，后面的音频会按时间戳补静音
+                avi_mux_obj->audio_len = 0;
+            }
+        }
+        uint32_t n = avi_mux_obj->audio_size - avi_mux_obj->audio_len;
+        n = len < n ? len : n;
+        if (data) {
+            memcpy(avi_mux_obj->audio_buf + avi_mux_obj->audio_len, data, n);
+            data += n;
+        } else {
+            memset(avi_mux_obj->audio_buf + avi_mux_obj->audio_len, 0, n);
+        }
+        avi_mux_obj->audio_len += n;
+        len -= n;
+    }
+}
+
+int avi_mux_audio(const uint8_t *data, size_t len, int64_t timestamp)
+{
+    if (!avi_mux_obj || !avi_mux_obj->config.audio) {
+        return -1;
+    }
+    xSemaphoreTake(avi_mux_obj->lock, portMAX_DELAY);
+    if (!avi_mux_obj->started) {
+        xSemaphoreGive(avi_mux_obj->lock);
+        return 0;
+    }
+    int64_t expect = avi_mux_audio_time(avi_mux_obj->audio_bytes + avi_mux_obj->audio_len);
+    if (timestamp > expect + AVI_AUDIO_SLACK) {
+        avi_mux_stage_audio(NULL, avi_mux_audio_bytes(timestamp - expect));
+    } else if (timestamp < expect - AVI_AUDIO_SLACK) {
+        // 重叠或者早于第一帧的部分
+        uint32_t skip = avi_mux_audio_bytes(expect - timestamp);
+        skip = skip < len ? skip : len;
+        data += skip;
+        len -= skip;
+    }
+    avi_mux_stage_audio(data, len);
+    xSemaphoreGive(avi_mux_obj->lock);
+    return 0;
+}
+
+int avi_mux_video(const uint8_t *jpeg, size_t len, int64_t timestamp)
+{
+    if (!avi_mux_obj) {
+        return -1;
+    }
+    xSemaphoreTake(avi_mux_obj->lock, portMAX_DELAY);
+    if (!avi_mux_obj->started) {
+        avi_mux_obj->start = timestamp;
+        avi_mux_obj->started = 1;
+    }
+    if (avi_mux_obj->config.audio && avi_mux_obj->audio_len) {
+        // 先写这一帧之前采到的音频
+        int64_t t = timestamp - avi_mux_obj->start;
+        uint32_t upto = t > 0 ? avi_mux_audio_bytes(t) : 0;
+        uint32_t n = upto > avi_mux_obj->audio_bytes ? upto - avi_mux_obj->audio_bytes : 0;
+        avi_mux_flush_audio(n < avi_mux_obj->audio_len ? n : avi_mux_obj->audio_len);
+    }
+    // frames missing at the nominal rate become empty chunks, the timeline stays at fps
+    uint32_t slot = ((timestamp - avi_mux_obj->start) * avi_mux_obj->config.fps + 500000) / 1000000;
+    while (avi_mux_obj->frames < slot && avi_mux_put_chunk(AVI_VIDEO_ID, NULL, 0, 0) == 0) {
+        avi_mux_obj->frames++;
+    }
+    int ret = avi_mux_put_chunk(AVI_VIDEO_ID, jpeg, len, AVIIF_KEYFRAME);
+    if (ret == 0) {
+        avi_mux_obj->frames++;
+        if (len > avi_mux_obj->max_video) {
+            avi_mux_obj->max_video = len;
+        }
+    } else {
+        avi_mux_obj->dropped++;
+    }
+    xSemaphoreGive(avi_mux_obj->lock);
+    return ret;
+}
+
+static void avi_mux_free(void)
+{
+    if (avi_mux_obj->lock) {
+        vSemaphoreDelete(avi_mux_obj->lock);
+    }
+    free(avi_mux_obj->index);
+    free(avi_mux_obj->audio_buf);
+    free(avi_mux_obj);
+    avi_mux_obj = NULL;
+}
+
+// idx1 goes after movi, then the header is rewritten with the final counts
+static int avi_mux_finish(void)
+{
+    uint8_t header[AVI_HEADER_MAX];
+    int fd = open(avi_mux_obj->path, O_RDWR);
+    if (fd < 0) {
+        return -1;
+    }
+    int ret = -1;
+    uint32_t end = avi_mux_obj->header_size + avi_mux_obj->movi_len;
+    uint32_t size = avi_mux_obj->index_cnt * sizeof(avi_mux_index_t);
+    avi_put32(avi_put32(header, AVI_FOURCC('i', 'd', 'x', '1')), size);
+    if (lseek(fd, end, SEEK_SET) == end && write(fd, header, 8) == 8 &&
+        write(fd, avi_mux_obj->index, size) == size && lseek(fd, 0, SEEK_SET) == 0) {
+        size = avi_mux_header(header);
+        ret = write(fd, header, size) == size ? 0 : -1;
+    }
+    close(fd);
+    return ret;
+}
+
+int avi_mux_stop(void)
+{
+    if (!avi_mux_obj) {
+        return -1;
+    }
+    xSemaphoreTake(avi_mux_obj->lock, portMAX_DELAY);
+    if (avi_mux_obj->config.audio) {
+        avi_mux_flush_audio(avi_mux_obj->audio_len / avi_mux_obj->unit * avi_mux_obj->unit);
+    }
+    recorder_stop();
+    int ret = avi_mux_finish();
+    if (ret != 0) {
+        ESP_LOGE(TAG, "%s: index or header write error\n", avi_mux_obj->path);
+    }
+    ESP_LOGI(TAG, "%s: %u frames, %u audio bytes, %u chunks, dropped: %u\n", avi_mux_obj->path, avi_mux_obj->frames,
+             avi_mux_obj->audio_bytes, avi_mux_obj->index_cnt, avi_mux_obj->dropped);
+    avi_mux_free();
+    return ret;
+}
+
+int avi_mux_start(const avi_mux_config_t *config)
+{
+    if (avi_mux_obj || !config->path || strlen(config->path) >= sizeof(avi_mux_obj->path) ||
+        (config->audio && !config->sample_rate) ||
+        (config->audio == AVI_AUDIO_ADPCM && (!config->block_bytes || !config->block_samples))) {
+        ESP_LOGE(TAG, "avi mux busy or config error\n");
+        return -1;
+    }
+    avi_mux_obj = (avi_mux_obj_t *)calloc(1, sizeof(avi_mux_obj_t));
+    if (!avi_mux_obj) {
+        ESP_LOGE(TAG, "avi mux object malloc error\n");
+        return -1;
+    }
+    avi_mux_obj->config = *config;
+    avi_mux_obj->config.fps = config->fps ? config->fps : 15;
+    avi_mux_obj->config.channels = config->channels ? config->channels : 1;
+    strcpy(avi_mux_obj->path, config->path);
+    avi_mux_obj->config.path = avi_mux_obj->path;
+    avi_mux_obj->index_max = config->max_chunks ? config->max_chunks : 16384;
+    size_t buffer_size = config->buffer_size ? config->buffer_size : 32 * 1024;
+
+    if (config->audio == AVI_AUDIO_ADPCM) {
+        avi_mux_obj->unit = config->block_bytes;
+        avi_mux_obj->unit_samples = config->block_samples;
+        avi_mux_obj->byte_rate = (uint64_t)config->sample_rate * config->block_bytes / config->block_samples;
+    } else if (config->audio) {
+        avi_mux_obj->unit = 2 * avi_mux_obj->config.channels;
+        avi_mux_obj->unit_samples = 1;
+        avi_mux_obj->byte_rate = config->sample_rate * avi_mux_obj->unit;
+    }
+    if (config->audio) {
+        // 一个音频 chunk 要能放进 recorder 的一个 buffer
+        uint32_t size = config->audio_buffer_size ? config->audio_buffer_size : avi_mux_obj->byte_rate / 2;
+        size = size < buffer_size - 16 ? size : buffer_size - 16;
+        avi_mux_obj->audio_size = size / avi_mux_obj->unit * avi_mux_obj->unit;
+        if (!avi_mux_obj->audio_size) {
+            ESP_LOGE(TAG, "audio block larger than the write buffer\n");
+            avi_mux_free();
+            return -1;
+        }
+        avi_mux_obj->audio_buf = (uint8_t *)malloc(avi_mux_obj->audio_size);
+    }
+    avi_mux_obj->lock = xSemaphoreCreateMutex();
+    avi_mux_obj->index = (avi_mux_index_t *)heap_caps_malloc(avi_mux_obj->index_max * sizeof(avi_mux_index_t), MALLOC_CAP_SPIRAM);
+    if (!avi_mux_obj->index) {
+        avi_mux_obj->index = (avi_mux_index_t *)malloc(avi_mux_obj->index_max * sizeof(avi_mux_index_t));
+    }
+    if (!avi_mux_obj->lock || !avi_mux_obj->index || (config->audio && !avi_mux_obj->audio_buf)) {
+        ESP_LOGE(TAG, "avi mux malloc error\n");
+        avi_mux_free();
+        return -1;
+    }
+
+    recorder_config_t recorder_config = {
+        .path = avi_mux_obj->path,
+        .file_size = config->file_size,
+        .buffer_size = buffer_size,
+        .max_frames = avi_mux_obj->index_max + 1, // the header is one more write
+        .sync_ms = config->sync_ms,
+        .task_pri = config->task_pri,
+        .no_index = 1,
+    };
+    if (recorder_start(&recorder_config) != 0) {
+        avi_mux_free();
+        return -1;
+    }
+    uint8_t header[AVI_HEADER_MAX];
+    avi_mux_obj->header_size = avi_mux_header(header); // placeholder sizes until avi_mux_finish
+    recorder_write(header, avi_mux_obj->header_size);
+    ESP_LOGI(TAG, "avi %s: %dx%d@%d, audio: %d\n", avi_mux_obj->path, config->width, config->high,
+             avi_mux_obj->config.fps, config->audio);
+    return 0;
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Record JPEG frames (OV2640_JPEG_Mode, jpeg_enc) and mic audio into one MJPEG AVI through the recorder.
+// Chunks go out in timestamp order: audio staged since the last frame is written up to the frame's capture
+// time before the frame itself. The first frame sets the start of both streams, a frame that is missing at
+// the nominal rate is written as an empty 00dc chunk (players repeat the previous one) and audio gaps are
+// filled with silence, so the two streams stay in step. The idx1 index is kept in RAM and appended at stop.
+
+typedef enum {
+    AVI_AUDIO_NONE = 0,
+    AVI_AUDIO_PCM,      // 16 bit little endian samples
+    AVI_AUDIO_ADPCM,    // IMA ADPCM blocks of WAVE format 0x11
+} avi_audio_t;
+
+typedef struct {
+    const char *path;
+    uint16_t width;
+    uint16_t high;
+    uint8_t fps;                // nominal sensor rate, 0: 15
+    uint8_t audio;              // avi_audio_t
+    uint8_t channels;           // 0: 1
+    uint32_t sample_rate;
+    uint16_t block_bytes;       // ADPCM: bytes per block, audio is written in whole blocks
+    uint16_t block_samples;     // ADPCM: samples per channel in one block
+    uint32_t audio_buffer_size; // audio staged between frames, 0: half a second
+    uint32_t max_chunks;        // idx1 capacity, audio and video chunks, 0: 16384
+    size_t file_size;           // recorder_config_t
+    size_t buffer_size;
+    uint32_t sync_ms;
+    uint8_t task_pri;
+} avi_mux_config_t;
+
+// One JPEG frame, timestamp is the capture time from cam_frame_t in us.
+// Returns -1 when the frame was dropped
+int avi_mux_video(const uint8_t *jpeg, size_t len, int64_t timestamp);
+
+// Audio bytes, whole samples or ADPCM blocks, timestamp is the capture time of the first sample in us.
+// Audio from before the first frame is discarded
+int avi_mux_audio(const uint8_t *data, size_t len, int64_t timestamp);
+
+int avi_mux_start(const avi_mux_config_t *config);
+
+// Write the remaining audio, the index and the final headers, after the video and audio producers stopped
+int avi_mux_stop(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,91 @@
+#include <stdio.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_attr.h"
+#include "esp_log.h"
+#include "esp_system.h"
+#include "esp_timer.h"
+#include "boot_marks.h"
+
+static const char *TAG = "boot_marks";
+
+#define BOOT_MARKS_MAGIC 0x424d4b31 // "BMK1"
+
+typedef struct {
+    char name[BOOT_MARK_NAME_LEN];
+    int64_t time;
+} boot_mark_entry_t;
+
+typedef struct {
+    uint32_t magic;
+    uint32_t cnt;
+    uint32_t reset_reason;  // esp_reset_reason_t that ended this boot, set by the next one
+    boot_mark_entry_t mark[BOOT_MARKS_MAX];
+} boot_marks_log_t;
+
+// [0]: this boot, [1]: the boot before. Not initialised, power on leaves garbage the magic check rejects
+static RTC_NOINIT_ATTR boot_marks_log_t boot_marks_log[2];
+static portMUX_TYPE boot_marks_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static __attribute__((constructor)) void boot_marks_startup(void)
+{
+    if (boot_marks_log[0].magic == BOOT_MARKS_MAGIC && boot_marks_log[0].cnt <= BOOT_MARKS_MAX) {
+        boot_marks_log[1] = boot_marks_log[0];
+        boot_marks_log[1].reset_reason = esp_reset_reason();
+    } else {
+        boot_marks_log[1].magic = 0;
+    }
+    boot_marks_log[0].magic = BOOT_MARKS_MAGIC;
+    boot_marks_log[0].cnt = 0;
+    boot_mark("startup");
+}
+
+void boot_mark(const char *name)
+{
+    int64_t time = esp_timer_get_time();
+    portENTER_CRITICAL_SAFE(&boot_marks_lock);
+    boot_marks_log_t *log = &boot_marks_log[0];
+    if (log->cnt < BOOT_MARKS_MAX) {
+        boot_mark_entry_t *mark = &log->mark[log->cnt++];
+        strncpy(mark->name, name, BOOT_MARK_NAME_LEN - 1);
+        mark->name[BOOT_MARK_NAME_LEN - 1] = '\0';
+        mark->time = time;
+    }
+    portEXIT_CRITICAL_SAFE(&boot_marks_lock);
+}
+
+void boot_mark_once(const char *name)
+{
+    boot_marks_log_t *log = &boot_marks_log[0];
+    for (int i = 0; i < log->cnt; i++) {
+        if (strncmp(log->mark[i].name, name, BOOT_MARK_NAME_LEN - 1) == 0) {
+            return;
+        }
+    }
+    boot_mark(name);
+}
+
+static void boot_marks_print_log(const char *title, const boot_marks_log_t *log)
+{
+    ESP_LOGI(TAG, "%s: %u marks", title, log->cnt);
+    int64_t last = 0;
+    for (int i = 0; i < log->cnt; i++) {
+        const boot_mark_entry_t *mark = &log->mark[i];
+        printf("BOOT %-15s %8lld  +%lld\n", mark->name, mark->time, mark->time - last);
+        last = mark->time;
+    }
+}
+
+void boot_marks_print(void)
+{
+    boot_marks_log_t log;
+    portENTER_CRITICAL(&boot_marks_lock);
+    log = boot_marks_log[0];
+    portEXIT_CRITICAL(&boot_marks_lock);
+    boot_marks_print_log("this boot", &log);
+    if (boot_marks_log[1].magic == BOOT_MARKS_MAGIC) {
+        ESP_LOGI(TAG, "previous boot ended by reset reason %u", boot_marks_log[1].reset_reason);
+        boot_marks_print_log("previous boot", &boot_marks_log[1]);
+    }
+}
@@ -0,0 +1,131 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/event_groups.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "boot_steps.h"
+#include "boot_marks.h"
+
+static const char *TAG = "boot_steps";
+
+typedef enum {
+    BOOT_STEP_OK = 0,
+    BOOT_STEP_FAILED,
+    BOOT_STEP_SKIPPED,
+} boot_step_state_t;
+
+typedef struct boot_steps_obj boot_steps_obj_t;
+
+typedef struct {
+    const boot_step_t *step;
+    boot_steps_obj_t *obj;
+    int64_t start;
+    int64_t end;
+    uint8_t state;
+} boot_step_run_t;
+
+struct boot_steps_obj {
+    EventGroupHandle_t done;  // bit n: step n finished, whatever its state
+    int64_t base;
+    boot_step_run_t run[BOOT_STEPS_MAX];
+};
+
+static void boot_step_exec(boot_step_run_t *run)
+{
+    boot_steps_obj_t *obj = run->obj;
+    const boot_step_t *step = run->step;
+
+    if (step->deps) {
+        xEventGroupWaitBits(obj->done, step->deps, pdFALSE, pdTRUE, portMAX_DELAY);
+    }
+    run->state = BOOT_STEP_OK;
+    for (int i = 0; i < BOOT_STEPS_MAX; i++) {
+        if ((step->deps & BOOT_STEP(i)) && obj->run[i].state != BOOT_STEP_OK) {
+            run->state = BOOT_STEP_SKIPPED;
+        }
+    }
+    run->start = esp_timer_get_time();
+    if (run->state == BOOT_STEP_OK && step->fn(step->arg) != 0) {
+        run->state = BOOT_STEP_FAILED;
+    }
+    run->end = esp_timer_get_time();
+    boot_mark(step->name);
+    // the state is written before the bit, a dependent reads it only after its wait returned
+    xEventGroupSetBits(obj->done, BOOT_STEP(run - obj->run));
+}
+
+static void boot_step_task(void *arg)
+{
+    boot_step_exec((boot_step_run_t *)arg);
+    vTaskDelete(NULL);
+}
+
+static void boot_steps_report(boot_steps_obj_t *obj, int cnt, int64_t total)
+{
+    static const char *state_str[] = {"ok", "failed", "skipped"};
+    int64_t serial = 0;
+    for (int i = 0; i < cnt; i++) {
+        boot_step_run_t *run = &obj->run[i];
+        ESP_LOGI(TAG, "%-12s %6lld ~ %6lld ms, %6lld ms, %s", run->step->name, (run->start - obj->base) / 1000,
+                 (run->end - obj->base) / 1000, (run->end - run->start) / 1000, state_str[run->state]);
+        serial += run->end - run->start;
+    }
+    // the sum is what the same steps would take one after another
+    ESP_LOGI(TAG, "boot: %lld ms, steps in sequence: %lld ms", total / 1000, serial / 1000);
+}
+
+int boot_steps_run(const boot_step_t *steps, int cnt)
+{
+    if (cnt <= 0 || cnt > BOOT_STEPS_MAX) {
+        ESP_LOGE(TAG, "step count error\n");
+        return -1;
+    }
+    // only earlier steps may be waited for, so the graph can not have a cycle
+    for (int i = 0; i < cnt; i++) {
+        if (steps[i].deps & ~(BOOT_STEP(i) - 1)) {
+            ESP_LOGE(TAG, "%s depends on a later step\n", steps[i].name);
+            return -1;
+        }
+    }
+    boot_steps_obj_t *obj = (boot_steps_obj_t *)calloc(1, sizeof(boot_steps_obj_t));
+    if (!obj) {
+        ESP_LOGE(TAG, "boot steps object malloc error\n");
+        return -1;
+    }
+    obj->done = xEventGroupCreate();
+    if (!obj->done) {
+        ESP_LOGE(TAG, "boot steps event group create error\n");
+        free(obj);
+        return -1;
+    }
+    obj->base = esp_timer_get_time();
+
+    UBaseType_t priority = uxTaskPriorityGet(NULL);
+    uint32_t all = 0;
+    for (int i = 0; i < cnt; i++) {
+        boot_step_run_t *run = &obj->run[i];
+        run->step = &steps[i];
+        run->obj = obj;
+        uint32_t stack_size = steps[i].stack_size ? steps[i].stack_size : 4096;
+        if (xTaskCreate(boot_step_task, steps[i].name, stack_size, run, priority, NULL) != pdPASS) {
+            // run it here instead, dependents are still ordered by the done bits
+            ESP_LOGW(TAG, "%s task create error, running it in sequence\n", steps[i].name);
+            boot_step_exec(run);
+        }
+        all |= BOOT_STEP(i);
+    }
+    xEventGroupWaitBits(obj->done, all, pdFALSE, pdTRUE, portMAX_DELAY);
+    boot_steps_report(obj, cnt, esp_timer_get_time() - obj->base);
+
+    int failed = 0;
+    for (int i = 0; i < cnt; i++) {
+        if (obj->run[i].state != BOOT_STEP_OK) {
+            failed++;
+        }
+    }
+    vEventGroupDelete(obj->done);
+    free(obj);
+    return failed;
+}
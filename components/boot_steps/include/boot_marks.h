@@ -0,0 +1,31 @@
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Boot milestones: esp_timer time stamps (us since the 2nd stage startup) kept in RTC memory, so after a
+// software reset, panic or watchdog the marks of the boot before can still be printed next to the new ones.
+// "startup" is marked before app_main by a constructor, each boot_steps step marks its end.
+
+#define BOOT_MARKS_MAX       24
+#define BOOT_MARK_NAME_LEN   16
+
+#define BOOT_MARK_APP_MAIN    "app_main"
+#define BOOT_MARK_FIRST_FRAME "first_frame"  // first camera frame taken
+#define BOOT_MARK_FIRST_AUDIO "first_audio"  // first samples written to I2S
+
+// Record a milestone, the name is copied and cut to BOOT_MARK_NAME_LEN - 1. Marks past BOOT_MARKS_MAX are lost
+void boot_mark(const char *name);
+
+// Record the milestone only the first time it is reached in this boot, e.g. from a loop
+void boot_mark_once(const char *name);
+
+// Log the marks of this boot and of the one before as "BOOT name us +us" lines a script can compare between releases
+void boot_marks_print(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Boot orchestrator: run init steps concurrently, each in its own task as soon as the steps it depends on
+// are done, so the delays of one peripheral (LCD reset, codec power up) overlap with the work of another
+// (sensor registers, model load). Prints when each step started and ended, relative to boot_steps_run.
+
+#define BOOT_STEPS_MAX 24
+#define BOOT_STEP(n)   (1UL << (n)) // dependency on the step at index n
+
+typedef int (*boot_step_fn_t)(void *arg); // 0: ok
+
+typedef struct {
+    const char *name;
+    boot_step_fn_t fn;
+    void *arg;
+    uint32_t deps;        // BOOT_STEP() of earlier steps, they must return 0 first
+    uint32_t stack_size;  // 0: 4096
+} boot_step_t;
+
+// Run all steps and return once every one has finished, at the priority of the calling task.
+// A failed step skips the steps depending on it. Returns the number of steps that failed or were skipped
+int boot_steps_run(const boot_step_t *steps, int cnt);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,1558 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_system.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "driver/ledc.h"
+#include "driver/gpio.h"
+#include "cam.h"
+#include "cam_hw.h"
+#include "pixel.h"
+#include "trace.h"
+#include "mem_place.h"
+#include "media_clock.h"
+#if CONFIG_PM_ENABLE
+#include "esp_pm.h"
+#endif
+
+static const char *TAG = "cam";
+
+#define CAM_DMA_MAX_SIZE     (4095)
+#define CAM_EVENT_VSYNC      (-1)
+#define CAM_EVENT_RESET      (-2) // cam_reconfigure: drop the frame in progress and acknowledge
+#define CAM_EVENT_RESYNC     (-3) // VSYNC moved the DMA back to the frame start, drop the frame in progress
+#define CAM_JPEG_EVENT_CNT   (4)
+#define CAM_STATS_STEP       (4)  // statistics sample every 4th pixel of every 4th line
+#define CAM_SUB_MAX          (4)
+#define CAM_BAND_PRIME       (16777619) // FNV-1a
+#define CAM_BAND_BASIS       (2166136261u)
+
+typedef struct {
+    cam_stats_t out;
+    uint32_t zone_sum[CAM_STATS_ZONES][CAM_STATS_ZONES];
+    uint32_t zone_cnt[CAM_STATS_ZONES][CAM_STATS_ZONES];
+} cam_stats_acc_t;
+
+typedef struct {
+    cam_frame_t fb;
+    lldesc_t *dma;      // zero copy: descriptor chain covering the whole frame buffer
+    uint8_t refs;       // consumers holding the frame, it goes back to the free queue at 0
+} cam_slot_t;
+
+struct cam_sub {
+    const char *name;
+    QueueHandle_t queue; // indexes of the frames it holds a reference to, oldest first
+    uint8_t drop;        // cam_sub_drop_t
+    uint32_t delivered;
+    uint32_t dropped;
+};
+
+typedef struct {
+    uint32_t buffer_size;
+    uint32_t half_buffer_size;
+    uint32_t node_cnt;
+    uint32_t half_node_cnt;
+    uint32_t dma_size;
+    uint32_t total_cnt;
+    uint32_t frame_node_cnt;
+    uint32_t frame_size;
+    uint32_t buffer_cap; // allocated ping-pong buffer bytes, kept across cam_reconfigure
+    uint32_t node_cap;   // allocated ping-pong descriptors
+    uint16_t width;
+    uint16_t high;
+    uint8_t roi;        // copy mode: crop and/or decimate while copying
+    uint8_t line_ops;   // copy mode: copy line by line through cam_copy_half
+    uint8_t convert;    // pixel_convert_t
+    uint8_t scale;      // box downscale factor
+    uint8_t rotate;
+    uint16_t *line_buf; // one line of scratch for the fused kernels
+    uint16_t roi_x;
+    uint16_t roi_y;
+    uint16_t roi_width;
+    uint16_t roi_high;
+    uint8_t decimate;
+    uint8_t format;     // cam_format_t
+    uint32_t out_size;  // bytes cam_task stores per frame
+    uint8_t stats_mode; // cam_stats_mode_t
+    uint8_t stats_valid;
+    cam_stats_acc_t *stats_acc; // frame being copied
+    cam_stats_t *stats;         // last finished frame, read by cam_get_stats
+    uint8_t band_lines;
+    uint16_t band_cnt;
+    uint32_t band_mask;         // two pixels
+    uint32_t band_hash;         // band being copied, it may span half buffers
+    uint32_t *band_sum;         // band_cnt per slot
+    lldesc_t *dma;
+    uint8_t *buffer;
+    cam_slot_t *frame;
+    uint8_t frame_cnt;
+    uint8_t frame_max;  // slots and queue depth allocated by cam_init
+    uint8_t started;
+    volatile uint8_t sync_wait; // raw modes: cam_start armed, the DMA starts on the next VSYNC edge
+    uint8_t zero_copy;
+    uint8_t latest;
+    uint8_t jpeg;
+    uint8_t stream;
+    uint8_t pin_vsync;
+    cam_stream_cb_t stream_cb;
+    void *stream_arg;
+    int isr_cnt;        // half buffers received since the DMA was (re)started
+    uint8_t frame_cur;  // zero copy: frame the DMA is writing
+    uint8_t frame_next; // zero copy: frame the DMA continues with once frame_cur is full
+    uint32_t seq;
+    uint32_t dropped;
+    uint32_t overrun;
+    uint32_t resync;
+    int64_t event_time;  // last event sent to the capture task
+    uint32_t wake_max;   // us
+    uint8_t skip;        // frames skipped for every delivered one
+    uint8_t skip_cnt;
+    volatile uint8_t burst_left; // cam_burst: frames still to capture, the DMA halts after the last one
+    cam_config_t config;         // last cam_init/cam_reconfigure, cam_burst returns to it
+    QueueHandle_t event_queue;
+    QueueHandle_t frame_free_queue;   // indexes of frames that can be filled
+    QueueHandle_t frame_buffer_queue; // indexes of filled frames, oldest first, unused once there are subscribers
+    cam_sub_t *sub[CAM_SUB_MAX];
+    volatile uint8_t sub_cnt;         // entries are filled in before the count covers them
+    SemaphoreHandle_t reset_sem;      // given by the capture task once it handled CAM_EVENT_RESET
+#if CONFIG_PM_ENABLE
+    esp_pm_lock_handle_t pm_lock;     // APB at max while started, XCLK and the I2S sampling run from it
+#endif
+} cam_obj_t;
+
+static cam_obj_t *cam_obj = NULL;
+static portMUX_TYPE cam_sync_lock = portMUX_INITIALIZER_UNLOCKED; // sync_wait against cam_stop on the other core
+static portMUX_TYPE cam_stats_lock = portMUX_INITIALIZER_UNLOCKED; // cam_task publishing against cam_get_stats
+static portMUX_TYPE cam_ref_lock = portMUX_INITIALIZER_UNLOCKED;   // frame reference counts, from the ISR and the consumers
+
+// Stamp a finished frame before it is handed to the consumer
+static void IRAM_ATTR cam_frame_done(int frame, size_t len)
+{
+    cam_frame_t *fb = &cam_obj->frame[frame].fb;
+    fb->len = len;
+    fb->timestamp = media_clock_now();
+    fb->seq = cam_obj->seq++;
+    fb->dropped = cam_obj->dropped;
+    fb->overrun = cam_obj->overrun;
+    fb->resync = cam_obj->resync;
+}
+
+// Back to the pool once the last consumer let go. HPTaskAwoken is NULL outside the ISR
+static void IRAM_ATTR cam_slot_unref(int frame, BaseType_t *HPTaskAwoken)
+{
+    cam_slot_t *slot = &cam_obj->frame[frame];
+    portENTER_CRITICAL_SAFE(&cam_ref_lock);
+    int refs = slot->refs ? --slot->refs : -1;
+    portEXIT_CRITICAL_SAFE(&cam_ref_lock);
+    if (refs != 0) {
+        return;
+    }
+    if (HPTaskAwoken) {
+        xQueueSendFromISR(cam_obj->frame_free_queue, (void *)&frame, HPTaskAwoken);
+    } else {
+        xQueueSend(cam_obj->frame_free_queue, (void *)&frame, 0);
+    }
+}
+
+static void IRAM_ATTR cam_slot_ref(int frame)
+{
+    portENTER_CRITICAL_SAFE(&cam_ref_lock);
+    cam_obj->frame[frame].refs++;
+    portEXIT_CRITICAL_SAFE(&cam_ref_lock);
+}
+
+// Queue a reference for the subscriber, a full queue drops by its policy. Never blocks
+static void IRAM_ATTR cam_sub_send(cam_sub_t *sub, int frame, BaseType_t *HPTaskAwoken)
+{
+    int old = -1;
+    cam_slot_ref(frame);
+    for (int i = 0; i < 2; i++) {
+        BaseType_t ret = HPTaskAwoken ? xQueueSendFromISR(sub->queue, (void *)&frame, HPTaskAwoken) : xQueueSend(sub->queue, (void *)&frame, 0);
+        if (ret == pdTRUE) {
+            sub->delivered++;
+            return;
+        }
+        if (sub->drop != CAM_SUB_DROP_OLDEST) {
+            break;
+        }
+        ret = HPTaskAwoken ? xQueueReceiveFromISR(sub->queue, (void *)&old, HPTaskAwoken) : xQueueReceive(sub->queue, (void *)&old, 0);
+        if (ret == pdTRUE) {
+            sub->dropped++;
+            cam_slot_unref(old, HPTaskAwoken);
+        }
+    }
+    sub->dropped++;
+    cam_slot_unref(frame, HPTaskAwoken);
+}
+
+// Hand a finished frame to cam_take_frame, or with subscribers a reference to each of them
+static void IRAM_ATTR cam_frame_publish(int frame, BaseType_t *HPTaskAwoken)
+{
+    int sub_cnt = cam_obj->burst_left ? 0 : cam_obj->sub_cnt;
+    if (cam_obj->burst_left && --cam_obj->burst_left == 0) {
+        cam_hw_halt(); // in the vertical blank, before the next frame lands on a burst buffer
+    }
+    if (sub_cnt == 0) {
+        if (HPTaskAwoken) {
+            xQueueSendFromISR(cam_obj->frame_buffer_queue, (void *)&frame, HPTaskAwoken);
+        } else {
+            xQueueSend(cam_obj->frame_buffer_queue, (void *)&frame, portMAX_DELAY);
+        }
+        return;
+    }
+    // 分发期间持有一个引用，先拿到帧的订阅者释放时不会提前回收
+    cam_obj->frame[frame].refs = 1;
+    for (int i = 0; i < sub_cnt; i++) {
+        cam_sub_send(cam_obj->sub[i], frame, HPTaskAwoken);
+    }
+    cam_slot_unref(frame, HPTaskAwoken);
+}
+
+// Frame skip: start only every (skip + 1)th frame, the skipped ones are not counted as dropped
+static bool IRAM_ATTR cam_frame_skip(void)
+{
+    if (cam_obj->skip == 0) {
+        return false;
+    }
+    if (cam_obj->skip_cnt < cam_obj->skip) {
+        cam_obj->skip_cnt++;
+        cam_obj->seq++;
+        return true;
+    }
+    cam_obj->skip_cnt = 0;
+    return false;
+}
+
+// Get a frame to fill: a free one, or with the latest policy the oldest ready one
+static int IRAM_ATTR cam_frame_get_from_isr(BaseType_t *HPTaskAwoken)
+{
+    int frame = -1;
+    if (xQueueReceiveFromISR(cam_obj->frame_free_queue, (void *)&frame, HPTaskAwoken) == pdTRUE) {
+        return frame;
+    }
+    if (cam_obj->latest && xQueueReceiveFromISR(cam_obj->frame_buffer_queue, (void *)&frame, HPTaskAwoken) == pdTRUE) {
+        cam_obj->dropped++;
+        return frame;
+    }
+    return -1;
+}
+
+// Point the tail of the frame being written to the next frame buffer.
+// If no buffer can be had, loop back onto the same frame and drop it.
+static void IRAM_ATTR cam_frame_link_next(BaseType_t *HPTaskAwoken)
+{
+    int cur = cam_obj->frame_cur;
+    int next = cam_frame_get_from_isr(HPTaskAwoken);
+    if (next < 0) {
+        next = cur;
+    }
+    cam_obj->frame[cur].dma[cam_obj->frame_node_cnt - 1].empty = cam_obj->frame[next].dma;
+    cam_obj->frame_next = next;
+}
+
+static void IRAM_ATTR cam_frame_eof(int cnt, BaseType_t *HPTaskAwoken)
+{
+    if (cnt == 0) {
+        cam_frame_link_next(HPTaskAwoken);
+    } else if (cnt == cam_obj->total_cnt - 1) {
+        // the last frame of a burst has no next buffer, the DMA halts once it is published
+        if (cam_obj->frame_next != cam_obj->frame_cur || cam_obj->burst_left == 1) {
+            int frame = cam_obj->frame_cur;
+            if (cam_frame_skip()) {
+                // The DMA already wrote it, hand the buffer straight back
+                xQueueSendFromISR(cam_obj->frame_free_queue, (void *)&frame, HPTaskAwoken);
+            } else {
+                cam_frame_done(frame, cam_obj->frame_size);
+                cam_frame_publish(frame, HPTaskAwoken);
+            }
+            cam_obj->frame_cur = cam_obj->frame_next;
+        } else {
+            cam_obj->dropped++;
+            cam_obj->seq++;
+        }
+    }
+}
+
+void IRAM_ATTR cam_eof_from_isr(BaseType_t *HPTaskAwoken)
+{
+    TRACE_BEGIN("cam_isr");
+    int cnt = cam_obj->isr_cnt;
+    cam_obj->event_time = esp_timer_get_time();
+    if (cam_obj->jpeg) {
+        if (xQueueSendFromISR(cam_obj->event_queue, (void *)&cnt, HPTaskAwoken) != pdTRUE) {
+            cam_obj->overrun++;
+        }
+    } else if (cam_obj->zero_copy) {
+        cam_frame_eof(cnt, HPTaskAwoken);
+    } else {
+        if (uxQueueMessagesWaitingFromISR(cam_obj->event_queue)) {
+            cam_obj->overrun++; // cam_task is behind, the pending half buffer is lost
+        }
+        xQueueOverwriteFromISR(cam_obj->event_queue, (void *)&cnt, HPTaskAwoken);
+    }
+    cnt++;
+    if (cnt == cam_obj->total_cnt) {
+        cnt = 0;
+    }
+    cam_obj->isr_cnt = cnt;
+    TRACE_END("cam_isr");
+}
+
+// At the frame start every half buffer of the last frame has had its EOF. When two EOFs came closer than the
+// interrupt latency they were handled as one and the count fell behind, restart the DMA at the head of the frame
+static void IRAM_ATTR cam_vsync_check(BaseType_t *HPTaskAwoken)
+{
+    int cnt = cam_obj->isr_cnt;
+    if (cnt == 0 || (cnt == cam_obj->total_cnt - 1 && cam_hw_eof_pending())) {
+        return; // in step, or the last EOF is waiting behind this interrupt
+    }
+    TRACE_INSTANT("cam_resync");
+    cam_hw_halt();
+    cam_obj->isr_cnt = 0;
+    cam_obj->resync++;
+    if (cam_obj->zero_copy) {
+        int cur = cam_obj->frame_cur;
+        if (cam_obj->frame_next != cur) {
+            int next = cam_obj->frame_next;
+            xQueueSendFromISR(cam_obj->frame_free_queue, (void *)&next, HPTaskAwoken);
+            cam_obj->frame_next = cur;
+        }
+        cam_obj->frame[cur].dma[cam_obj->frame_node_cnt - 1].empty = cam_obj->frame[cur].dma;
+        cam_hw_resume(cam_obj->frame[cur].dma);
+        return;
+    }
+    int event = CAM_EVENT_RESYNC;
+    xQueueOverwriteFromISR(cam_obj->event_queue, (void *)&event, HPTaskAwoken);
+    cam_hw_resume(&cam_obj->dma[0]);
+}
+
+static void IRAM_ATTR cam_vsync_isr(void *arg)
+{
+#if CONFIG_CAM_JPEG_MODE
+    if (cam_obj->jpeg) {
+        // JPEG frames have no fixed length, the end of frame is taken from the VSYNC edge
+        BaseType_t HPTaskAwoken = pdFALSE;
+        int event = CAM_EVENT_VSYNC;
+        cam_obj->event_time = esp_timer_get_time();
+        xQueueSendFromISR(cam_obj->event_queue, (void *)&event, &HPTaskAwoken);
+
+        if(HPTaskAwoken == pdTRUE) {
+            portYIELD_FROM_ISR();
+        }
+        return;
+    }
+#endif
+    // Raw frames carry no marker, start in the vertical blank so half buffer 0 is the top of a frame
+    BaseType_t HPTaskAwoken = pdFALSE;
+    portENTER_CRITICAL_ISR(&cam_sync_lock);
+    if (cam_obj->sync_wait) {
+        cam_obj->sync_wait = 0;
+        cam_hw_start();
+    } else if (cam_obj->started) {
+        cam_vsync_check(&HPTaskAwoken);
+    }
+    portEXIT_CRITICAL_ISR(&cam_sync_lock);
+
+    if(HPTaskAwoken == pdTRUE) {
+        portYIELD_FROM_ISR();
+    }
+}
+
+static void cam_vsync_config(const cam_config_t *config)
+{
+    gpio_install_isr_service(ESP_INTR_FLAG_IRAM); // may already be installed by the application
+    gpio_set_intr_type(config->pin.vsync, GPIO_INTR_POSEDGE);
+    gpio_isr_handler_add(config->pin.vsync, cam_vsync_isr, NULL);
+    gpio_intr_disable(config->pin.vsync);
+}
+
+static void cam_set_xclk(const cam_config_t *config)
+{
+    ledc_timer_config_t ledc_timer = {
+        .duty_resolution = LEDC_TIMER_1_BIT,
+        .freq_hz = config->xclk_fre,
+        .speed_mode = LEDC_LOW_SPEED_MODE,
+        .timer_num = LEDC_TIMER_1
+    };
+    ledc_timer_config(&ledc_timer);
+    ledc_channel_config_t ledc_channel = {
+        .channel    = LEDC_CHANNEL_2,
+        .duty       = 1,
+        .gpio_num   = config->pin.xclk,
+        .speed_mode = LEDC_LOW_SPEED_MODE,
+        .timer_sel  = LEDC_TIMER_1,
+        .hpoint     = 0
+    };
+    ledc_channel_config(&ledc_channel);
+    ESP_LOGI(TAG, "cam_xclk_pin setup\n");
+}
+
+void cam_set_xclk_enable(uint8_t en)
+{
+    if (en) {
+        ledc_timer_resume(LEDC_LOW_SPEED_MODE, LEDC_TIMER_1);
+    } else {
+        ledc_timer_pause(LEDC_LOW_SPEED_MODE, LEDC_TIMER_1);
+    }
+}
+
+void cam_stop(void)
+{
+#if CONFIG_PM_ENABLE
+    if (cam_obj->started) {
+        esp_pm_lock_release(cam_obj->pm_lock);
+    }
+#endif
+    cam_obj->started = 0;
+    gpio_intr_disable(cam_obj->pin_vsync);
+    portENTER_CRITICAL(&cam_sync_lock);
+    cam_obj->sync_wait = 0;
+    cam_hw_stop();
+    portEXIT_CRITICAL(&cam_sync_lock);
+}
+
+// Point the DMA at the head of the ping-pong buffer or of the current frame, whatever it was doing at cam_stop
+static void cam_dma_rewind(void)
+{
+    cam_obj->isr_cnt = 0;
+    if (!cam_obj->zero_copy) {
+        cam_hw_set_link(&cam_obj->dma[0], cam_obj->half_buffer_size);
+        return;
+    }
+    int cur = cam_obj->frame_cur;
+    if (cam_obj->frame_next != cur) {
+        // linked at the first EOF of the interrupted frame, it is linked again at the first EOF after the start
+        int next = cam_obj->frame_next;
+        xQueueSend(cam_obj->frame_free_queue, (void *)&next, 0);
+        cam_obj->frame_next = cur;
+    }
+    cam_obj->frame[cur].dma[cam_obj->frame_node_cnt - 1].empty = cam_obj->frame[cur].dma;
+    cam_hw_set_link(cam_obj->frame[cur].dma, cam_obj->half_buffer_size);
+}
+
+void cam_start(void)
+{
+    if (cam_obj->started) {
+        return;
+    }
+#if CONFIG_PM_ENABLE
+    esp_pm_lock_acquire(cam_obj->pm_lock);
+#endif
+    cam_dma_rewind();
+    cam_obj->started = 1;
+    if (cam_obj->jpeg) {
+        cam_hw_start(); // the JPEG task finds the frame start from VSYNC and the SOI marker
+    } else {
+        cam_obj->sync_wait = 1;
+    }
+    gpio_intr_enable(cam_obj->pin_vsync);
+}
+
+// Rewind the DMA to the head of the ping-pong buffer, so the next frame starts at half buffer 0
+static void cam_dma_restart(void)
+{
+    cam_hw_halt();
+    cam_obj->isr_cnt = 0;
+    cam_hw_resume(&cam_obj->dma[0]);
+}
+
+static int cam_frame_get(void)
+{
+    int frame = -1;
+    if (xQueueReceive(cam_obj->frame_free_queue, (void *)&frame, 0) == pdTRUE) {
+        return frame;
+    }
+    if (cam_obj->latest && xQueueReceive(cam_obj->frame_buffer_queue, (void *)&frame, 0) == pdTRUE) {
+        cam_obj->dropped++;
+        return frame;
+    }
+    return -1;
+}
+
+static void cam_frame_drop(int frame)
+{
+    cam_obj->dropped++;
+    cam_obj->seq++;
+    if (frame != -1) {
+        xQueueSend(cam_obj->frame_free_queue, (void *)&frame, portMAX_DELAY);
+    }
+}
+
+// YUYV line to a Y line and optionally an interleaved UV line, four pixels per word when aligned
+static void cam_copy_yuv_line(uint8_t *out_y, uint8_t *out_uv, const uint8_t *line, int out_width, int dec)
+{
+    int x = 0;
+    if (dec == 1 && !(((uint32_t)line | (uint32_t)out_y | (uint32_t)out_uv) & 0x3)) {
+        const uint32_t *src = (const uint32_t *)line;
+        uint32_t *y32 = (uint32_t *)out_y;
+        uint32_t *uv32 = (uint32_t *)out_uv;
+        for (; x + 4 <= out_width; x += 4) {
+            uint32_t w0 = *src++; // Y0 U0 Y1 V0
+            uint32_t w1 = *src++; // Y2 U1 Y3 V1
+            *y32++ = (w0 & 0xff) | ((w0 >> 8) & 0xff00) | ((w1 & 0xff) << 16) | ((w1 << 8) & 0xff000000);
+            if (uv32) {
+                *uv32++ = ((w0 >> 8) & 0xff) | ((w0 >> 16) & 0xff00) | ((w1 << 8) & 0xff0000) | (w1 & 0xff000000);
+            }
+        }
+    }
+    for (; x < out_width; x++) {
+        int sp = x * dec;
+        out_y[x] = line[sp * 2];
+        if (out_uv) {
+            out_uv[x] = line[(sp & ~1) * 2 + ((x & 1) ? 3 : 1)];
+        }
+    }
+}
+
+// Copy half buffer cnt into the frame. With line ops each roi line is cropped, decimated or box scaled,
+// converted and optionally rotated on its way from the DMA buffer into the frame, no extra frame pass
+static void cam_copy_half(uint8_t *frame, const uint8_t *src, int cnt)
+{
+    if (!cam_obj->line_ops) {
+        memcpy(&frame[cnt * cam_obj->half_buffer_size], src, cam_obj->half_buffer_size);
+        return;
+    }
+    uint32_t line_size = cam_obj->width * 2;
+    int lines = cam_obj->half_buffer_size / line_size; // the DMA plan keeps whole lines in each half
+    int dec = cam_obj->decimate;
+    int step = dec * cam_obj->scale;
+    int out_width = cam_obj->roi_width / step;
+    int out_high = cam_obj->roi_high / step;
+    int y = cnt * lines - cam_obj->roi_y;
+    if (y + lines <= 0 || y >= cam_obj->roi_high) {
+        return; // no roi line in this half
+    }
+    uint8_t *uv_plane = frame + out_width * out_high;
+    int ps = pixel_convert_size(cam_obj->convert);
+    for (int r = 0; r < lines; r++, y++) {
+        if (y < 0 || y % step || y / step >= out_high) {
+            continue;
+        }
+        int oy = y / step;
+        const uint8_t *line = src + r * line_size + cam_obj->roi_x * 2;
+        if (cam_obj->format != CAM_FORMAT_RAW) {
+            uint8_t *out_uv = (cam_obj->format == CAM_FORMAT_Y_UV) ? uv_plane + oy * out_width : NULL;
+            cam_copy_yuv_line(frame + oy * out_width, out_uv, line, out_width, dec);
+            continue;
+        }
+        const uint16_t *pix = (const uint16_t *)line;
+        uint16_t *tmp = cam_obj->line_buf;
+        if (cam_obj->scale > 1) {
+            // the scale lines of the box are in this half, the plan and roi_y keep them aligned
+            pixel_box_rgb565(tmp, pix, cam_obj->width, out_width, cam_obj->scale);
+            pix = tmp;
+        } else if (dec > 1) {
+            for (int x = 0; x < out_width; x++) {
+                tmp[x] = pix[x * dec];
+            }
+            pix = tmp;
+        }
+        if (!cam_obj->rotate) {
+            pixel_convert(cam_obj->convert, frame + oy * out_width * ps, pix, out_width);
+            continue;
+        }
+        pixel_convert(cam_obj->convert, (uint8_t *)tmp, pix, out_width);
+        uint16_t *col = (uint16_t *)frame + (out_high - 1 - oy);
+        for (int x = 0; x < out_width; x++) {
+            col[x * out_high] = tmp[x];
+        }
+    }
+}
+
+static inline uint8_t cam_stats_clamp(int v)
+{
+    return v < 0 ? 0 : (v > 255 ? 255 : v);
+}
+
+// One sensor line into the statistics, zy is its zone row. The line is still in the internal DMA
+// buffer the copy just read, sampling a quarter of its pixels keeps the extra reads small
+static void cam_stats_line(cam_stats_acc_t *acc, const uint8_t *line, int zy)
+{
+    int width = cam_obj->width;
+    uint32_t r_sum = 0, g_sum = 0, b_sum = 0;
+    int x = 0;
+    for (int zx = 0; zx < CAM_STATS_ZONES; zx++) {
+        int x_end = width * (zx + 1) / CAM_STATS_ZONES;
+        uint32_t sum = 0, cnt = 0;
+        for (; x < x_end; x += CAM_STATS_STEP, cnt++) {
+            const uint8_t *p = line + x * 2;
+            int r, g, b, y;
+            if (cam_obj->stats_mode == CAM_STATS_YUV422) {
+                // x is even: Y0 U Y1 V
+                int u = p[1] - 128;
+                int v = p[3] - 128;
+                y = p[0];
+                r = cam_stats_clamp(y + ((359 * v) >> 8));
+                g = cam_stats_clamp(y - ((88 * u + 183 * v) >> 8));
+                b = cam_stats_clamp(y + ((454 * u) >> 8));
+            } else {
+                uint16_t v = (p[0] << 8) | p[1];
+                r = (v >> 8) & 0xF8;
+                g = (v >> 3) & 0xFC;
+                b = (v << 3) & 0xF8;
+                y = (r * 77 + g * 150 + b * 29) >> 8;
+            }
+            acc->out.hist[y >> 3]++;
+            sum += y;
+            r_sum += r;
+            g_sum += g;
+            b_sum += b;
+        }
+        acc->zone_sum[zy][zx] += sum;
+        acc->zone_cnt[zy][zx] += cnt;
+    }
+    acc->out.r_sum += r_sum;
+    acc->out.g_sum += g_sum;
+    acc->out.b_sum += b_sum;
+}
+
+// Statistics of half buffer cnt, gathered right after it was copied
+static void cam_stats_half(const uint8_t *src, int cnt)
+{
+    cam_stats_acc_t *acc = cam_obj->stats_acc;
+    uint32_t line_size = cam_obj->width * 2;
+    int lines = cam_obj->half_buffer_size / line_size;
+    int y = cnt * lines;
+    if (cnt == 0) {
+        memset(acc, 0, sizeof(cam_stats_acc_t));
+    }
+    for (int r = (CAM_STATS_STEP - y % CAM_STATS_STEP) % CAM_STATS_STEP; r < lines; r += CAM_STATS_STEP) {
+        cam_stats_line(acc, src + r * line_size, (y + r) * CAM_STATS_ZONES / cam_obj->high);
+    }
+}
+
+static void cam_stats_publish(uint32_t seq)
+{
+    cam_stats_acc_t *acc = cam_obj->stats_acc;
+    acc->out.seq = seq;
+    acc->out.samples = 0;
+    for (int zy = 0; zy < CAM_STATS_ZONES; zy++) {
+        for (int zx = 0; zx < CAM_STATS_ZONES; zx++) {
+            uint32_t cnt = acc->zone_cnt[zy][zx];
+            acc->out.zone_mean[zy][zx] = cnt ? acc->zone_sum[zy][zx] / cnt : 0;
+            acc->out.samples += cnt;
+        }
+    }
+    portENTER_CRITICAL(&cam_stats_lock);
+    *cam_obj->stats = acc->out;
+    cam_obj->stats_valid = 1;
+    portEXIT_CRITICAL(&cam_stats_lock);
+}
+
+int cam_get_stats(cam_stats_t *stats)
+{
+    if (!cam_obj || !cam_obj->stats_mode) {
+        return -1;
+    }
+    portENTER_CRITICAL(&cam_stats_lock);
+    int valid = cam_obj->stats_valid;
+    if (valid) {
+        *stats = *cam_obj->stats;
+    }
+    portEXIT_CRITICAL(&cam_stats_lock);
+    return valid ? 0 : -1;
+}
+
+// Band checksums of half buffer cnt, in the sensor lines it holds, which are the frame lines without line ops
+static void cam_band_half(int frame, const uint8_t *src, int cnt)
+{
+    int words = cam_obj->width / 2;
+    int lines = cam_obj->half_buffer_size / (cam_obj->width * 2);
+    uint32_t *sum = (uint32_t *)cam_obj->frame[frame].fb.band_sum;
+    uint32_t mask = cam_obj->band_mask;
+    uint32_t h = cam_obj->band_hash;
+    const uint32_t *w = (const uint32_t *)src;
+    for (int y = cnt * lines; y < (cnt + 1) * lines && y < cam_obj->high; y++) {
+        if (y % cam_obj->band_lines == 0) {
+            h = CAM_BAND_BASIS;
+        }
+        for (int x = 0; x < words; x++) {
+            h = (h ^ (*w++ & mask)) * CAM_BAND_PRIME;
+        }
+        if ((y + 1) % cam_obj->band_lines == 0 || y + 1 == cam_obj->high) {
+            sum[y / cam_obj->band_lines] = h;
+        }
+    }
+    cam_obj->band_hash = h;
+}
+
+//Copy fram from DMA buffer to fram buffer
+static void cam_wake_record(void)
+{
+    uint32_t latency = esp_timer_get_time() - cam_obj->event_time;
+    if (latency > cam_obj->wake_max) {
+        cam_obj->wake_max = latency;
+    }
+}
+
+uint32_t cam_get_resync_cnt(void)
+{
+    return cam_obj->resync;
+}
+
+uint32_t cam_get_wake_latency(void)
+{
+    return cam_obj->wake_max;
+}
+
+void cam_set_skip(uint8_t skip)
+{
+    cam_obj->skip = skip;
+    cam_obj->skip_cnt = 0;
+}
+
+int cam_get_ready_cnt(void)
+{
+    int cnt = uxQueueMessagesWaiting(cam_obj->frame_buffer_queue);
+    for (int i = 0; i < cam_obj->sub_cnt; i++) {
+        int waiting = uxQueueMessagesWaiting(cam_obj->sub[i]->queue);
+        cnt = waiting > cnt ? waiting : cnt;
+    }
+    return cnt;
+}
+
+static void cam_task(void *arg)
+{
+    int frame = -1;
+    int cnt = 0;
+    int next_cnt = 0;
+    // a half buffer has to be copied before the DMA comes back to it, one half buffer period later. The
+    // period is the shortest seen between the EOFs of consecutive half buffers, the budget follows it
+    trace_stage_t copy_stage = trace_stage_register("cam_copy", 0);
+    int64_t last_event = 0;
+    uint32_t half_us = UINT32_MAX;
+
+    while (1) {
+        xQueueReceive(cam_obj->event_queue, (void *)&cnt, portMAX_DELAY);
+        cam_wake_record();
+        int64_t event = cam_obj->event_time;
+        if (cnt >= 0 && cnt == next_cnt && last_event && event - last_event < half_us) {
+            half_us = event - last_event;
+            trace_stage_set_budget(copy_stage, half_us);
+        }
+        last_event = cnt >= 0 ? event : 0;
+        if (cnt == CAM_EVENT_RESET) {
+            frame = -1; // the frame queues are rebuilt by cam_reconfigure
+            next_cnt = 0;
+            half_us = UINT32_MAX;
+            trace_stage_set_budget(copy_stage, 0);
+            xSemaphoreGive(cam_obj->reset_sem);
+            continue;
+        }
+        if (cnt == CAM_EVENT_RESYNC) {
+            if (frame != -1) {
+                cam_frame_drop(frame);
+                frame = -1;
+            }
+            next_cnt = 0;
+            continue;
+        }
+        if (frame != -1 && cnt != next_cnt) {
+            // A half buffer was overwritten before we copied it, never hand out a torn frame
+            cam_frame_drop(frame);
+            frame = -1;
+        }
+        next_cnt = (cnt + 1) % cam_obj->total_cnt;
+        if (frame == -1) {
+            if (cnt != 0 || cam_frame_skip()) {
+                continue; // skipped frames are not copied at all
+            }
+            frame = cam_frame_get();
+            if (frame == -1) {
+                cam_frame_drop(frame);
+                continue;
+            }
+        }
+        TRACE_BEGIN("cam_copy");
+        trace_stage_begin(copy_stage);
+        uint8_t *src = &cam_obj->buffer[(cnt % 2) * cam_obj->half_buffer_size];
+        cam_copy_half(cam_obj->frame[frame].fb.buf, src, cnt);
+        // the DMA wrote the half buffer, the copy read it back
+        mem_place_bw_io(MEM_PLACE_BW_CAM, src, cam_obj->half_buffer_size);
+        mem_place_bw_copy(MEM_PLACE_BW_CAM, cam_obj->frame[frame].fb.buf, src, cam_obj->half_buffer_size);
+        if (cam_obj->stats_mode) {
+            cam_stats_half(src, cnt);
+        }
+        if (cam_obj->band_lines) {
+            cam_band_half(frame, src, cnt);
+        }
+        trace_stage_end(copy_stage);
+        TRACE_END("cam_copy");
+        if (cnt == cam_obj->total_cnt - 1) {
+            TRACE_INSTANT("cam_frame");
+            cam_frame_done(frame, cam_obj->out_size);
+            if (cam_obj->stats_mode) {
+                cam_stats_publish(cam_obj->frame[frame].fb.seq);
+            }
+            cam_frame_publish(frame, NULL);
+            frame = -1;
+        }
+    }
+}
+
+// Hand each half buffer straight to the consumer while the DMA fills the other half
+static void cam_stream_task(void *arg)
+{
+    int cnt = 0;
+    int next_cnt = 0;
+    uint8_t sync = 0;
+
+    while (1) {
+        xQueueReceive(cam_obj->event_queue, (void *)&cnt, portMAX_DELAY);
+        cam_wake_record();
+        if (cnt == CAM_EVENT_RESET || cnt == CAM_EVENT_RESYNC) {
+            sync = 0;
+            next_cnt = 0;
+            if (cnt == CAM_EVENT_RESET) {
+                xSemaphoreGive(cam_obj->reset_sem);
+            }
+            continue;
+        }
+        if (sync && cnt != next_cnt) {
+            // The consumer missed a half buffer, wait for the next frame start so its data stays in place
+            cam_obj->dropped++;
+            sync = 0;
+        }
+        next_cnt = (cnt + 1) % cam_obj->total_cnt;
+        if (cnt == 0) {
+            sync = 1;
+            cam_obj->seq++;
+        }
+        if (!sync) {
+            continue;
+        }
+        cam_obj->stream_cb(&cam_obj->buffer[(cnt % 2) * cam_obj->half_buffer_size], cam_obj->half_buffer_size, cnt * cam_obj->half_buffer_size, cam_obj->stream_arg);
+    }
+}
+
+#if CONFIG_CAM_JPEG_MODE
+// JPEG data never contains 0xFFD9 other than the EOI marker, the first one after the frame start ends the picture
+static size_t cam_jpeg_find_eoi(uint8_t *buffer, size_t start, size_t end)
+{
+    for (size_t x = start; x + 1 < end; x++) {
+        if (buffer[x] == 0xFF && buffer[x + 1] == 0xD9) {
+            return x + 2;
+        }
+    }
+    return 0;
+}
+
+//Collect the half buffers of one JPEG frame until VSYNC, then trim it at the EOI marker
+static void cam_jpeg_task(void *arg)
+{
+    int frame = -1;
+    int event = 0;
+    size_t pos = 0;
+    size_t last = 0;
+    uint8_t overflow = 0;
+
+    while (1) {
+        xQueueReceive(cam_obj->event_queue, (void *)&event, portMAX_DELAY);
+        cam_wake_record();
+        if (event == CAM_EVENT_RESET) {
+            frame = -1;
+            pos = 0;
+            last = 0;
+            overflow = 0;
+            xSemaphoreGive(cam_obj->reset_sem);
+            continue;
+        }
+        if (event != CAM_EVENT_VSYNC) {
+            if (frame == -1 || overflow) {
+                continue;
+            }
+            if (pos + cam_obj->half_buffer_size > cam_obj->frame_size) {
+                overflow = 1; // compressed frame larger than frame_buffer_size
+                continue;
+            }
+            memcpy(&cam_obj->frame[frame].fb.buf[pos], &cam_obj->buffer[(event % 2) * cam_obj->half_buffer_size], cam_obj->half_buffer_size);
+            last = pos;
+            pos += cam_obj->half_buffer_size;
+            continue;
+        }
+
+        // The tail of the frame sits in the half buffer the DMA had not finished yet
+        int half = cam_obj->isr_cnt % 2;
+        cam_dma_restart();
+        if (frame != -1) {
+            size_t len = 0;
+            if (!overflow) {
+                size_t tail = cam_obj->frame_size - pos;
+                if (tail > cam_obj->half_buffer_size) {
+                    tail = cam_obj->half_buffer_size;
+                }
+                memcpy(&cam_obj->frame[frame].fb.buf[pos], &cam_obj->buffer[half * cam_obj->half_buffer_size], tail);
+                // from the last byte before the final half buffer, an FF D9 can straddle the half buffer boundary
+                len = cam_jpeg_find_eoi(cam_obj->frame[frame].fb.buf, last ? last - 1 : 0, pos + tail);
+            }
+            uint8_t *buffer = cam_obj->frame[frame].fb.buf;
+            if (len && buffer[0] == 0xFF && buffer[1] == 0xD8) {
+                cam_frame_done(frame, len);
+                cam_frame_publish(frame, NULL);
+            } else {
+                cam_frame_drop(frame);
+            }
+        }
+        if (cam_frame_skip()) {
+            frame = -1;
+        } else {
+            frame = cam_frame_get();
+            if (frame == -1) {
+                cam_frame_drop(frame);
+            }
+        }
+        pos = 0;
+        last = 0;
+        overflow = 0;
+    }
+}
+#endif
+
+cam_frame_t *cam_take_frame(void)
+{
+    int frame = -1;
+    xQueueReceive(cam_obj->frame_buffer_queue, (void *)&frame, portMAX_DELAY);
+    cam_frame_t *fb = &cam_obj->frame[frame].fb;
+    cam_obj->frame[frame].refs = 1;
+    if (cam_obj->zero_copy) {
+        cam_hw_invalidate(fb->buf, cam_obj->frame_size);
+    }
+    return fb;
+}
+
+void cam_give_frame(cam_frame_t *frame)
+{
+    cam_frame_unref(frame);
+}
+
+void cam_frame_ref(cam_frame_t *frame)
+{
+    cam_slot_ref((cam_slot_t *)frame - cam_obj->frame); // fb is the first member of the slot
+}
+
+void cam_frame_unref(cam_frame_t *frame)
+{
+    cam_slot_unref((cam_slot_t *)frame - cam_obj->frame, NULL);
+}
+
+cam_sub_t *cam_sub_add(const cam_sub_config_t *config)
+{
+    if (cam_obj->stream) {
+        ESP_LOGE(TAG, "stream mode has no frames to subscribe to\n");
+        return NULL;
+    }
+    cam_sub_t *sub = (cam_sub_t *)mem_place_calloc("cam_sub", MEM_PLACE_ISR, 1, sizeof(cam_sub_t));
+    if (!sub) {
+        ESP_LOGE(TAG, "subscriber malloc error\n");
+        return NULL;
+    }
+    sub->name = config->name ? config->name : "sub";
+    sub->drop = config->drop;
+    sub->queue = xQueueCreate(config->depth ? config->depth : 1, sizeof(int));
+    int added = 0;
+    portENTER_CRITICAL(&cam_ref_lock);
+    if (sub->queue && cam_obj->sub_cnt < CAM_SUB_MAX) {
+        cam_obj->sub[cam_obj->sub_cnt] = sub;
+        cam_obj->sub_cnt++;
+        added = 1;
+    }
+    portEXIT_CRITICAL(&cam_ref_lock);
+    if (!added) {
+        ESP_LOGE(TAG, "%s: subscriber add error, %d at most\n", sub->name, CAM_SUB_MAX);
+        if (sub->queue) {
+            vQueueDelete(sub->queue);
+        }
+        mem_place_free(sub);
+        return NULL;
+    }
+    ESP_LOGI(TAG, "%s: subscribed, depth: %d, drop: %s\n", sub->name, config->depth ? config->depth : 1,
+             sub->drop == CAM_SUB_DROP_OLDEST ? "oldest" : "newest");
+    return sub;
+}
+
+cam_frame_t *cam_sub_take(cam_sub_t *sub, uint32_t timeout_ms)
+{
+    int frame = -1;
+    TickType_t ticks = timeout_ms == portMAX_DELAY ? portMAX_DELAY : timeout_ms / portTICK_PERIOD_MS;
+    if (xQueueReceive(sub->queue, (void *)&frame, ticks) != pdTRUE) {
+        return NULL;
+    }
+    cam_frame_t *fb = &cam_obj->frame[frame].fb;
+    if (cam_obj->zero_copy) {
+        // the lines are clean, dropping them again under another subscriber only costs a refetch
+        cam_hw_invalidate(fb->buf, cam_obj->frame_size);
+    }
+    return fb;
+}
+
+void cam_sub_get_stats(cam_sub_t *sub, uint32_t *delivered, uint32_t *dropped)
+{
+    *delivered = sub->delivered;
+    *dropped = sub->dropped;
+}
+
+uint8_t *cam_take(void)
+{
+    return cam_take_frame()->buf;
+}
+
+size_t cam_get_frame_len(uint8_t *buffer)
+{
+    for (int x = 0; x < cam_obj->frame_cnt; x++) {
+        if (buffer == cam_obj->frame[x].fb.buf) {
+            return cam_obj->frame[x].fb.len;
+        }
+    }
+    return 0;
+}
+
+void cam_give(uint8_t *buffer)
+{
+    for (int x = 0; x < cam_obj->frame_cnt; x++) {
+        if (buffer == cam_obj->frame[x].fb.buf) {
+            cam_slot_unref(x, NULL);
+            break;
+        }
+    }
+}
+
+// Split len bytes into dma_size descriptors and a short tail node, chained in order. Returns the node count
+static int cam_dma_fill(lldesc_t *dma, uint8_t *buffer, uint32_t len)
+{
+    int x = 0;
+    for (x = 0; len > 0; x++) {
+        uint32_t size = len > cam_obj->dma_size ? cam_obj->dma_size : len;
+        dma[x].size = size;
+        dma[x].length = size;
+        dma[x].eof = 1;
+        dma[x].owner = 1;
+        dma[x].buf = buffer;
+        dma[x].empty = &dma[x + 1];
+        buffer += size;
+        len -= size;
+    }
+    return x;
+}
+
+// One descriptor chain per frame buffer, so the DMA lands the pixels in their final place
+static int cam_frame_dma_config(void)
+{
+    for (int x = 0; x < cam_obj->frame_cnt; x++) {
+        if (cam_obj->frame[x].dma) {
+            mem_place_free(cam_obj->frame[x].dma);
+        }
+        lldesc_t *dma = (lldesc_t *)mem_place_alloc("cam_frame_dma", MEM_PLACE_DMA, cam_obj->frame_node_cnt * sizeof(lldesc_t));
+        if (!dma) {
+            ESP_LOGE(TAG, "frame dma malloc error\n");
+            return -1;
+        }
+        cam_dma_fill(dma, cam_obj->frame[x].fb.buf, cam_obj->frame_size);
+        dma[cam_obj->frame_node_cnt - 1].empty = &dma[0];
+        cam_obj->frame[x].dma = dma;
+    }
+    return 0;
+}
+
+// DMA ping-pong buffer, cam_task copies each finished half into the frame buffer.
+// The allocation only grows, so switching back and forth between sizes does not fragment the heap
+static int cam_ping_pong_config(void)
+{
+    if (cam_obj->node_cnt > cam_obj->node_cap) {
+        mem_place_free(cam_obj->dma);
+        cam_obj->dma = (lldesc_t *)mem_place_alloc("cam_dma", MEM_PLACE_DMA, cam_obj->node_cnt * sizeof(lldesc_t));
+        cam_obj->node_cap = cam_obj->dma ? cam_obj->node_cnt : 0;
+    }
+    if (cam_obj->buffer_size > cam_obj->buffer_cap) {
+        mem_place_free(cam_obj->buffer);
+        cam_obj->buffer = (uint8_t *)mem_place_alloc("cam_dma_buffer", MEM_PLACE_DMA, cam_obj->buffer_size * sizeof(uint8_t));
+        cam_obj->buffer_cap = cam_obj->buffer ? cam_obj->buffer_size : 0;
+    }
+    if (!cam_obj->dma || !cam_obj->buffer) {
+        ESP_LOGE(TAG, "dma buffer malloc error\n");
+        return -1;
+    }
+
+    // Each half ends on a node boundary
+    cam_dma_fill(&cam_obj->dma[0], cam_obj->buffer, cam_obj->half_buffer_size);
+    cam_dma_fill(&cam_obj->dma[cam_obj->half_node_cnt], cam_obj->buffer + cam_obj->half_buffer_size, cam_obj->half_buffer_size);
+    cam_obj->dma[cam_obj->node_cnt - 1].empty = &cam_obj->dma[0];
+
+    cam_hw_set_link(&cam_obj->dma[0], cam_obj->half_buffer_size); // 乒乓操作
+    return 0;
+}
+
+#if CONFIG_CAM_JPEG_MODE
+// JPEG frames have no fixed size to divide, use full size nodes and a ping-pong buffer of whole nodes
+static void cam_jpeg_dma_config(cam_config_t *config)
+{
+    cam_obj->dma_size = CAM_DMA_MAX_SIZE & ~0x3;
+    uint32_t max_half = config->max_buffer_size / 2 < CAM_HW_EOF_MAX ? config->max_buffer_size / 2 : CAM_HW_EOF_MAX;
+    cam_obj->half_node_cnt = max_half / cam_obj->dma_size;
+    if (cam_obj->half_node_cnt == 0) {
+        cam_obj->half_node_cnt = 1;
+    }
+    cam_obj->node_cnt = cam_obj->half_node_cnt * 2;
+    cam_obj->half_buffer_size = cam_obj->half_node_cnt * cam_obj->dma_size;
+    cam_obj->buffer_size = cam_obj->half_buffer_size * 2;
+    cam_obj->total_cnt = 2;
+    cam_obj->frame_size = config->frame_buffer_size;
+
+    ESP_LOGI(TAG, "cam_jpeg_buffer_size: %d, cam_dma_size: %d, cam_dma_node_cnt: %d, cam_frame_size: %d\n", cam_obj->buffer_size, cam_obj->dma_size, cam_obj->node_cnt, cam_obj->frame_size);
+}
+#endif
+
+// Plan the DMA for a raw frame: the EOF interval is a whole number of lines dividing the frame,
+// as large as half of max_buffer_size allows, split into near-max size nodes
+static int cam_dma_plan(cam_config_t *config)
+{
+    uint32_t line_size = config->size.width * 2;
+    uint32_t max_half = config->max_buffer_size / 2 < CAM_HW_EOF_MAX ? config->max_buffer_size / 2 : CAM_HW_EOF_MAX;
+    uint32_t align = cam_obj->zero_copy ? CAM_HW_EXT_ALIGN : 4; // zero copy nodes may land in PSRAM
+    uint32_t lines = 0;
+    for (uint32_t x = config->size.high; x > 0; x--) { // 每次中断拷贝的行数，需整除帧高
+        if (config->size.high % x == 0 && x * line_size <= max_half && (x * line_size) % align == 0 && x % cam_obj->scale == 0) {
+            lines = x;
+            break;
+        }
+    }
+    if (lines == 0) {
+        ESP_LOGE(TAG, "max_buffer_size %d can not hold two %d byte aligned line groups of %d bytes\n", config->max_buffer_size, align, line_size);
+        return -1;
+    }
+    cam_obj->half_buffer_size = lines * line_size;
+    cam_obj->buffer_size = cam_obj->half_buffer_size * 2;
+    cam_obj->half_node_cnt = (cam_obj->half_buffer_size + CAM_DMA_MAX_SIZE - 1) / CAM_DMA_MAX_SIZE;
+    // Even nodes, aligned, only the last node of each half may come out short
+    cam_obj->dma_size = ((cam_obj->half_buffer_size + cam_obj->half_node_cnt - 1) / cam_obj->half_node_cnt + align - 1) & ~(align - 1);
+    if (cam_obj->dma_size > CAM_DMA_MAX_SIZE) {
+        cam_obj->dma_size = CAM_DMA_MAX_SIZE & ~(align - 1);
+        cam_obj->half_node_cnt = (cam_obj->half_buffer_size + cam_obj->dma_size - 1) / cam_obj->dma_size;
+    }
+    cam_obj->node_cnt = cam_obj->half_node_cnt * 2; // DMA节点个数
+    cam_obj->frame_size = config->size.width * config->size.high * 2;
+    cam_obj->total_cnt = cam_obj->frame_size / cam_obj->half_buffer_size; // 产生中断拷贝的次数, 乒乓拷贝
+    cam_obj->frame_node_cnt = (cam_obj->frame_size + cam_obj->dma_size - 1) / cam_obj->dma_size;
+
+    ESP_LOGI(TAG, "cam_buffer_size: %d, cam_dma_size: %d, cam_dma_tail: %d, cam_dma_node_cnt: %d, cam_eof_lines: %d, cam_total_cnt: %d\n",
+             cam_obj->buffer_size, cam_obj->dma_size, cam_obj->half_buffer_size - (cam_obj->half_node_cnt - 1) * cam_obj->dma_size,
+             cam_obj->node_cnt, lines, cam_obj->total_cnt);
+    return 0;
+}
+
+int cam_dma_config(cam_config_t *config) 
+{
+#if CONFIG_CAM_JPEG_MODE
+    if (cam_obj->jpeg) {
+        cam_jpeg_dma_config(config);
+        return cam_ping_pong_config();
+    }
+#endif
+    if (cam_dma_plan(config) != 0) {
+        return -1;
+    }
+
+    if (cam_obj->zero_copy) {
+        if (cam_frame_dma_config() != 0) {
+            return -1;
+        }
+        // The frame chains replace the ping-pong buffer, start on the first free frame looping onto itself
+        int frame = cam_frame_get();
+        if (frame == -1) {
+            ESP_LOGE(TAG, "zero copy mode needs at least one frame buffer\n");
+            return -1;
+        }
+        cam_obj->frame_cur = cam_obj->frame_next = frame;
+        cam_hw_set_link(cam_obj->frame[cam_obj->frame_cur].dma, cam_obj->half_buffer_size);
+        return 0;
+    }
+
+    return cam_ping_pong_config();
+}
+
+static int cam_roi_config(const cam_config_t *config)
+{
+    cam_obj->decimate = config->decimate ? config->decimate : 1;
+    cam_obj->scale = config->scale ? config->scale : 1;
+    cam_obj->convert = config->convert;
+    cam_obj->rotate = config->rotate;
+    cam_obj->format = config->format;
+    cam_obj->roi = config->roi.width || cam_obj->decimate > 1;
+    cam_obj->line_ops = cam_obj->roi || cam_obj->format != CAM_FORMAT_RAW || cam_obj->convert != PIXEL_CONVERT_NONE ||
+                        cam_obj->scale > 1 || cam_obj->rotate;
+    cam_obj->roi_x = config->roi.width ? config->roi.x : 0;
+    cam_obj->roi_y = config->roi.width ? config->roi.y : 0;
+    cam_obj->roi_width = config->roi.width ? config->roi.width : config->size.width;
+    cam_obj->roi_high = config->roi.width ? config->roi.high : config->size.high;
+    cam_obj->out_size = config->size.width * config->size.high * 2;
+    if (!cam_obj->line_ops) {
+        return 0;
+    }
+    if (cam_obj->jpeg || cam_obj->zero_copy || cam_obj->stream) {
+        ESP_LOGE(TAG, "roi, decimate, scale, convert and yuv formats need the copy mode\n");
+        return -1;
+    }
+    if (cam_obj->roi_x + cam_obj->roi_width > config->size.width || cam_obj->roi_y + cam_obj->roi_high > config->size.high) {
+        ESP_LOGE(TAG, "roi is outside the frame\n");
+        return -1;
+    }
+    if (cam_obj->format != CAM_FORMAT_RAW && (cam_obj->convert != PIXEL_CONVERT_NONE || cam_obj->scale > 1 || cam_obj->rotate)) {
+        ESP_LOGE(TAG, "scale, convert and rotate work on RGB565 only\n");
+        return -1;
+    }
+    if ((cam_obj->scale != 1 && cam_obj->scale != 2 && cam_obj->scale != 4) || (cam_obj->scale > 1 && cam_obj->decimate > 1) ||
+        (cam_obj->roi_y % cam_obj->scale)) {
+        ESP_LOGE(TAG, "scale must be 2 or 4 without decimate, roi.y a multiple of it\n");
+        return -1;
+    }
+    if (cam_obj->rotate && pixel_convert_size(cam_obj->convert) != 2) {
+        ESP_LOGE(TAG, "rotate needs 16 bit output\n");
+        return -1;
+    }
+    mem_place_free(cam_obj->line_buf);
+    cam_obj->line_buf = (uint16_t *)mem_place_alloc("cam_line_buf", MEM_PLACE_HOT, config->size.width * 2);
+    if (!cam_obj->line_buf) {
+        ESP_LOGE(TAG, "line buffer malloc error\n");
+        return -1;
+    }
+    int step = cam_obj->decimate * cam_obj->scale;
+    cam_obj->out_size = (cam_obj->roi_width / step) * (cam_obj->roi_high / step);
+    if (cam_obj->format == CAM_FORMAT_RAW) {
+        cam_obj->out_size *= pixel_convert_size(cam_obj->convert);
+    } else if (cam_obj->format == CAM_FORMAT_Y_UV) {
+        cam_obj->out_size *= 2;
+    }
+    ESP_LOGI(TAG, "cam_roi: %d,%d %dx%d, decimate: %d, scale: %d, format: %d, convert: %d, rotate: %d, cam_out_size: %d\n",
+             cam_obj->roi_x, cam_obj->roi_y, cam_obj->roi_width, cam_obj->roi_high, cam_obj->decimate, cam_obj->scale,
+             cam_obj->format, cam_obj->convert, cam_obj->rotate, cam_obj->out_size);
+    return 0;
+}
+
+static int cam_stats_config(const cam_config_t *config)
+{
+    cam_obj->stats_mode = config->stats;
+    cam_obj->stats_valid = 0;
+    if (!cam_obj->stats_mode) {
+        return 0;
+    }
+    if (cam_obj->jpeg || cam_obj->zero_copy || cam_obj->stream) {
+        ESP_LOGE(TAG, "stats need the copy mode\n");
+        return -1;
+    }
+    if (cam_obj->stats_mode > CAM_STATS_YUV422 || (cam_obj->format != CAM_FORMAT_RAW && cam_obj->stats_mode != CAM_STATS_YUV422)) {
+        ESP_LOGE(TAG, "stats mode error, the Y formats need CAM_STATS_YUV422\n");
+        return -1;
+    }
+    if (!cam_obj->stats_acc) {
+        // kept across cam_reconfigure, cam_task only touches them while it copies
+        cam_obj->stats_acc = (cam_stats_acc_t *)mem_place_alloc("cam_stats_acc", MEM_PLACE_HOT, sizeof(cam_stats_acc_t));
+        cam_obj->stats = (cam_stats_t *)mem_place_alloc("cam_stats", MEM_PLACE_HOT, sizeof(cam_stats_t));
+        if (!cam_obj->stats_acc || !cam_obj->stats) {
+            ESP_LOGE(TAG, "stats malloc error\n");
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static int cam_band_config(const cam_config_t *config)
+{
+    uint16_t band_cnt = config->band_lines ? (config->size.high + config->band_lines - 1) / config->band_lines : 0;
+    cam_obj->band_lines = config->band_lines;
+    cam_obj->band_mask = config->band_mask ? config->band_mask | ((uint32_t)config->band_mask << 16) : 0xffffffff;
+    if (band_cnt && (cam_obj->jpeg || cam_obj->zero_copy || cam_obj->stream || cam_obj->line_ops || (config->size.width % 2))) {
+        ESP_LOGE(TAG, "band checksums need the copy mode without line ops and an even width\n");
+        return -1;
+    }
+    if (band_cnt != cam_obj->band_cnt) {
+        mem_place_free(cam_obj->band_sum);
+        cam_obj->band_sum = NULL;
+        cam_obj->band_cnt = 0;
+        if (band_cnt) {
+            cam_obj->band_sum = (uint32_t *)mem_place_calloc("cam_band_sum", MEM_PLACE_HOT, cam_obj->frame_max * band_cnt, sizeof(uint32_t));
+            if (!cam_obj->band_sum) {
+                ESP_LOGE(TAG, "band checksum malloc error\n");
+                return -1;
+            }
+            cam_obj->band_cnt = band_cnt;
+        }
+    }
+    for (int x = 0; x < cam_obj->frame_max; x++) {
+        cam_obj->frame[x].fb.band_sum = band_cnt ? cam_obj->band_sum + x * band_cnt : NULL;
+        cam_obj->frame[x].fb.band_cnt = band_cnt;
+    }
+    return 0;
+}
+
+// Hand the configured frame buffers to the slots and the free queue
+static int cam_frame_setup(const cam_config_t *config)
+{
+    uint8_t *frame_buffer[2] = {config->frame1_buffer, config->frame2_buffer};
+    uint8_t **buffers = frame_buffer;
+    int frame_cnt = 2;
+    if (config->frame_cnt) {
+        buffers = config->frame_buffer;
+        frame_cnt = config->frame_cnt;
+    }
+    if (frame_cnt > cam_obj->frame_max) {
+        ESP_LOGE(TAG, "frame_cnt %d is deeper than the %d frames set up by cam_init\n", frame_cnt, cam_obj->frame_max);
+        return -1;
+    }
+    cam_obj->frame_cnt = 0;
+    for (int x = 0; x < frame_cnt; x++) {
+        if (buffers[x] == NULL) {
+            continue;
+        }
+        int frame = cam_obj->frame_cnt++;
+        cam_obj->frame[frame].fb.buf = buffers[x];
+        xQueueSend(cam_obj->frame_free_queue, (void *)&frame, 0);
+    }
+    return 0;
+}
+
+static BaseType_t cam_task_core(uint8_t core)
+{
+    switch (core) {
+        case CAM_CORE_0:
+            return 0;
+        case CAM_CORE_1:
+            return portNUM_PROCESSORS > 1 ? 1 : tskNO_AFFINITY;
+        case CAM_CORE_ANY:
+            return tskNO_AFFINITY;
+        default:
+            break;
+    }
+#if portNUM_PROCESSORS > 1
+    // Wi-Fi and lwIP run on core 0 unless they were moved to core 1
+#if CONFIG_ESP32_WIFI_TASK_PINNED_TO_CORE_1 || CONFIG_LWIP_TCPIP_TASK_AFFINITY_CPU1
+    return 0;
+#else
+    return 1;
+#endif
+#else
+    return tskNO_AFFINITY;
+#endif
+}
+
+// Resolve the requested mode bits against each other and the features built in menuconfig
+static int cam_mode_config(const cam_config_t *config, uint8_t *stream, uint8_t *jpeg, uint8_t *zero_copy)
+{
+    *stream = config->mode.stream;
+    *jpeg = *stream ? 0 : config->mode.jpeg;
+    *zero_copy = (*stream || *jpeg) ? 0 : config->mode.zero_copy;
+#if !CONFIG_CAM_JPEG_MODE
+    if (*jpeg) {
+        ESP_LOGE(TAG, "jpeg mode is disabled, enable CONFIG_CAM_JPEG_MODE\n");
+        return -1;
+    }
+#endif
+#if !CONFIG_CAM_ZERO_COPY
+    if (*zero_copy) {
+        ESP_LOGW(TAG, "zero copy is disabled, frames are copied by cam_task\n");
+        *zero_copy = 0;
+    }
+#endif
+    return 0;
+}
+
+int cam_reconfigure(const cam_config_t *config)
+{
+    uint8_t stream, jpeg, zero_copy;
+    if (cam_mode_config(config, &stream, &jpeg, &zero_copy) != 0) {
+        return -1;
+    }
+    if (stream != cam_obj->stream || jpeg != cam_obj->jpeg || zero_copy != cam_obj->zero_copy) {
+        ESP_LOGE(TAG, "cam_reconfigure can not change the capture mode\n");
+        return -1;
+    }
+    if (jpeg && config->frame_buffer_size == 0) {
+        ESP_LOGE(TAG, "jpeg mode needs frame_buffer_size\n");
+        return -1;
+    }
+
+    uint8_t started = cam_obj->started;
+    if (started) {
+        cam_stop();
+    }
+    if (!zero_copy) {
+        // Wait for the capture task to finish the event in hand and forget its frame
+        xQueueReset(cam_obj->event_queue);
+        int event = CAM_EVENT_RESET;
+        cam_obj->event_time = esp_timer_get_time();
+        xQueueSend(cam_obj->event_queue, (void *)&event, portMAX_DELAY);
+        xSemaphoreTake(cam_obj->reset_sem, portMAX_DELAY);
+    }
+    xQueueReset(cam_obj->frame_free_queue);
+    xQueueReset(cam_obj->frame_buffer_queue);
+    for (int i = 0; i < cam_obj->sub_cnt; i++) {
+        xQueueReset(cam_obj->sub[i]->queue);
+    }
+    for (int x = 0; x < cam_obj->frame_max; x++) {
+        cam_obj->frame[x].refs = 0;
+    }
+
+    cam_obj->width = config->size.width;
+    cam_obj->high = config->size.high;
+    cam_obj->latest = config->mode.latest;
+    cam_obj->isr_cnt = 0;
+    if (cam_roi_config(config) != 0 || cam_stats_config(config) != 0 || cam_band_config(config) != 0 ||
+        cam_frame_setup(config) != 0) {
+        return -1;
+    }
+    cam_hw_reset_in();
+    if (cam_dma_config((cam_config_t *)config) != 0) {
+        return -1;
+    }
+    cam_obj->config = *config;
+    if (started) {
+        cam_start();
+    }
+    return 0;
+}
+
+int cam_burst(const cam_burst_config_t *burst, cam_frame_t *frames)
+{
+    if (cam_obj->stream || cam_obj->jpeg || burst->frame_cnt == 0 || burst->frame_cnt > cam_obj->frame_max) {
+        ESP_LOGE(TAG, "burst of %d frames error, raw modes and %d frames at most\n", burst->frame_cnt, cam_obj->frame_max);
+        return -1;
+    }
+    // 保存当前的帧 buffer，burst 结束后恢复
+    int pool_cnt = cam_obj->frame_cnt;
+    uint8_t **pool = (uint8_t **)malloc(pool_cnt * sizeof(uint8_t *));
+    if (!pool) {
+        ESP_LOGE(TAG, "burst malloc error\n");
+        return -1;
+    }
+    for (int x = 0; x < pool_cnt; x++) {
+        pool[x] = cam_obj->frame[x].fb.buf;
+    }
+    uint8_t started = cam_obj->started;
+    uint8_t skip = cam_obj->skip;
+    cam_config_t config = cam_obj->config;
+    cam_config_t config_saved = cam_obj->config;
+    cam_stop();
+
+    cam_config_t burst_config = config;
+    burst_config.frame_cnt = burst->frame_cnt;
+    burst_config.frame_buffer = burst->frame_buffer;
+    burst_config.mode.latest = 0;
+    cam_obj->skip = 0;
+    int ret = cam_reconfigure(&burst_config);
+    int cnt = 0;
+    if (ret == 0) {
+        TickType_t ticks = (burst->timeout_ms ? burst->timeout_ms : 1000 + 200 * burst->frame_cnt) / portTICK_PERIOD_MS;
+        TickType_t start = xTaskGetTickCount();
+        cam_obj->burst_left = burst->frame_cnt;
+        cam_start();
+        for (; cnt < burst->frame_cnt; cnt++) {
+            TickType_t spent = xTaskGetTickCount() - start;
+            int frame = -1;
+            if (spent >= ticks || xQueueReceive(cam_obj->frame_buffer_queue, (void *)&frame, ticks - spent) != pdTRUE) {
+                break;
+            }
+            frames[cnt] = cam_obj->frame[frame].fb;
+            if (cam_obj->zero_copy) {
+                cam_hw_invalidate(frames[cnt].buf, cam_obj->frame_size);
+            }
+        }
+        cam_stop();
+        cam_obj->burst_left = 0;
+    }
+
+    cam_obj->skip = skip;
+    config.frame_cnt = pool_cnt;
+    config.frame_buffer = pool;
+    if (cam_reconfigure(&config) != 0) {
+        ESP_LOGE(TAG, "frame pool restore after the burst error\n");
+        ret = -1;
+    }
+    free(pool);
+    cam_obj->config = config_saved;
+    if (started) {
+        cam_start();
+    }
+    if (ret == 0 && cnt < burst->frame_cnt) {
+        ESP_LOGE(TAG, "burst timeout, %d of %d frames\n", cnt, burst->frame_cnt);
+        ret = -1;
+    }
+    return ret;
+}
+
+int cam_init(const cam_config_t *config)
+{
+    // the ISRs read it, the DMA never does
+    cam_obj = (cam_obj_t *)mem_place_calloc("cam_obj", MEM_PLACE_ISR, 1, sizeof(cam_obj_t));
+    if (!cam_obj) {
+        ESP_LOGI(TAG, "camera object malloc error\n");
+        return -1;
+    }
+    memset(cam_obj, 0, sizeof(cam_obj_t));
+    cam_obj->width = config->size.width;
+    cam_obj->high = config->size.high;
+    if (cam_mode_config(config, &cam_obj->stream, &cam_obj->jpeg, &cam_obj->zero_copy) != 0) {
+        return -1;
+    }
+    cam_obj->stream_cb = config->stream_cb;
+    cam_obj->stream_arg = config->stream_arg;
+    cam_obj->latest = config->mode.latest;
+    cam_obj->pin_vsync = config->pin.vsync;
+    if (cam_obj->jpeg && config->frame_buffer_size == 0) {
+        ESP_LOGE(TAG, "jpeg mode needs frame_buffer_size\n");
+        return -1;
+    }
+    if (cam_obj->stream && !cam_obj->stream_cb) {
+        ESP_LOGE(TAG, "stream mode needs stream_cb\n");
+        return -1;
+    }
+
+    cam_obj->frame_max = config->frame_cnt ? config->frame_cnt : 2;
+    cam_obj->frame_max = config->burst_cnt > cam_obj->frame_max ? config->burst_cnt : cam_obj->frame_max;
+    cam_obj->frame = (cam_slot_t *)mem_place_calloc("cam_slots", MEM_PLACE_ISR, cam_obj->frame_max, sizeof(cam_slot_t));
+    if (!cam_obj->frame) {
+        ESP_LOGI(TAG, "camera frame malloc error\n");
+        return -1;
+    }
+
+    cam_obj->event_queue = xQueueCreate(cam_obj->jpeg ? CAM_JPEG_EVENT_CNT : 1, sizeof(int));
+    cam_obj->frame_free_queue = xQueueCreate(cam_obj->frame_max, sizeof(int));
+    cam_obj->frame_buffer_queue = xQueueCreate(cam_obj->frame_max, sizeof(int));
+    cam_obj->reset_sem = xSemaphoreCreateBinary();
+#if CONFIG_PM_ENABLE
+    if (esp_pm_lock_create(ESP_PM_APB_FREQ_MAX, 0, "cam", &cam_obj->pm_lock) != ESP_OK) {
+        ESP_LOGE(TAG, "cam pm lock create error\n");
+        return -1;
+    }
+#endif
+    if (cam_roi_config(config) != 0 || cam_stats_config(config) != 0 || cam_band_config(config) != 0 ||
+        cam_frame_setup(config) != 0) {
+        return -1;
+    }
+
+    cam_set_xclk(config);
+    if (cam_hw_init(config) != 0 || cam_dma_config(config) != 0) {
+        return -1;
+    }
+    cam_vsync_config(config); // JPEG framing, raw modes start the DMA on it
+    cam_obj->config = *config;
+
+    TaskFunction_t task = NULL;
+    if (cam_obj->stream) {
+        task = cam_stream_task;
+#if CONFIG_CAM_JPEG_MODE
+    } else if (cam_obj->jpeg) {
+        task = cam_jpeg_task;
+#endif
+    } else if (!cam_obj->zero_copy) {
+        task = cam_task;
+    }
+    if (task && xTaskCreatePinnedToCore(task, "cam_task", config->task_stack ? config->task_stack : 1024 * 4, NULL,
+                                        config->task_pri, NULL, cam_task_core(config->task_core)) != pdPASS) {
+        ESP_LOGE(TAG, "cam_task create error\n");
+        return -1;
+    }
+    return 0;
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <stdbool.h>
+#include "freertos/FreeRTOS.h"
+#include "cam.h"
+#if CONFIG_IDF_TARGET_ESP32S3
+#include "soc/lldesc.h"
+#else
+#include "esp32s2/rom/lldesc.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Capture peripheral backend used by cam.c.
+// ESP32-S2: I2S0 camera mode, cam_i2s.c. ESP32-S3: the camera half of LCD_CAM on a GDMA RX channel, cam_lcd_cam.c
+
+#if CONFIG_IDF_TARGET_ESP32S3
+#define CAM_HW_EOF_MAX     (0x10000) // cam_rec_data_bytelen is 16 bits
+#define CAM_HW_EXT_ALIGN   (16)      // PSRAM block size, zero copy node sizes and frame buffers
+#else
+#define CAM_HW_EOF_MAX     (0xFFFFFFFF)
+#define CAM_HW_EXT_ALIGN   (4)
+#endif
+
+// cam.c: one EOF of the size given to cam_hw_set_link arrived, called from the backend interrupt
+void cam_eof_from_isr(BaseType_t *HPTaskAwoken);
+
+// Input pins, the capture peripheral, its DMA and the EOF interrupt. XCLK is set up by cam.c
+int cam_hw_init(const cam_config_t *config);
+
+// Descriptor chain the next start continues with, and the bytes between EOF interrupts
+void cam_hw_set_link(lldesc_t *dma, uint32_t eof_size);
+
+// Sample and receive from the linked chain, IRAM: raw modes call it from the VSYNC interrupt.
+// cam_hw_stop: stop sampling and receiving
+void cam_hw_start(void);
+void cam_hw_stop(void);
+
+// Halt the DMA and restart it at dma with a clean FIFO, sampling stays enabled in between
+void cam_hw_halt(void);
+void cam_hw_resume(lldesc_t *dma);
+
+// An EOF is latched and its interrupt not handled yet, IRAM: the VSYNC interrupt asks
+bool cam_hw_eof_pending(void);
+
+// Drop whatever the input DMA holds before the descriptors are rebuilt
+void cam_hw_reset_in(void);
+
+// The DMA wrote behind the cache, drop stale lines before the CPU reads buf
+void cam_hw_invalidate(void *buf, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
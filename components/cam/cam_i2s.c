@@ -0,0 +1,210 @@
+#include <stdio.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_log.h"
+#include "soc/i2s_struct.h"
+#include "esp32s2/rom/cache.h"
+#include "driver/periph_ctrl.h"
+#include "driver/gpio.h"
+#include "cam_hw.h"
+
+static const char *TAG = "cam_i2s";
+
+static void IRAM_ATTR cam_i2s_isr(void *arg)
+{
+    typeof(I2S0.int_st) int_st = I2S0.int_st;
+    I2S0.int_clr.val = int_st.val;
+    BaseType_t HPTaskAwoken = pdFALSE;
+    if (int_st.in_suc_eof) {
+        cam_eof_from_isr(&HPTaskAwoken);
+    }
+
+    if(HPTaskAwoken == pdTRUE) {
+        portYIELD_FROM_ISR();
+    }
+}
+
+static void cam_i2s_set_pin(const cam_config_t *config)
+{
+    PIN_FUNC_SELECT(GPIO_PIN_MUX_REG[config->pin.pclk], PIN_FUNC_GPIO);
+    gpio_set_direction(config->pin.pclk, GPIO_MODE_INPUT);
+    gpio_set_pull_mode(config->pin.pclk, GPIO_FLOATING);
+    gpio_matrix_in(config->pin.pclk, I2S0I_WS_IN_IDX, false);
+
+    PIN_FUNC_SELECT(GPIO_PIN_MUX_REG[config->pin.vsync], PIN_FUNC_GPIO);
+    gpio_set_direction(config->pin.vsync, GPIO_MODE_INPUT);
+    gpio_set_pull_mode(config->pin.vsync, GPIO_FLOATING);
+    gpio_matrix_in(config->pin.vsync, I2S0I_V_SYNC_IDX, true);
+
+    PIN_FUNC_SELECT(GPIO_PIN_MUX_REG[config->pin.hsync], PIN_FUNC_GPIO);
+    gpio_set_direction(config->pin.hsync, GPIO_MODE_INPUT);
+    gpio_set_pull_mode(config->pin.hsync, GPIO_FLOATING);
+    gpio_matrix_in(config->pin.hsync, I2S0I_H_SYNC_IDX, false);
+
+    for(int i = 0; i < config->bit_width; i++) {
+        PIN_FUNC_SELECT(GPIO_PIN_MUX_REG[config->pin_data[i]], PIN_FUNC_GPIO);
+        gpio_set_direction(config->pin_data[i], GPIO_MODE_INPUT);
+        gpio_set_pull_mode(config->pin_data[i], GPIO_FLOATING);
+        // 高位对齐，IN16总是最高位
+        // fifo按bit来访问数据，rx_bits_mod为8时，数据需要按8位对齐
+        gpio_matrix_in(config->pin_data[i], I2S0I_DATA_IN0_IDX + (16 - config->bit_width) + i, false);
+    }
+}
+
+static void cam_i2s_config(const cam_config_t *config)
+{
+    //Enable I2S periph
+    periph_module_enable(PERIPH_I2S0_MODULE);
+
+    // 配置时钟
+    I2S0.clkm_conf.val = 0;
+    I2S0.clkm_conf.clkm_div_num = 2;
+    I2S0.clkm_conf.clkm_div_b = 0;
+    I2S0.clkm_conf.clkm_div_a = 0;
+    I2S0.clkm_conf.clk_sel = 2;
+    I2S0.clkm_conf.clk_en = 1;
+
+    // 配置采样率
+    I2S0.sample_rate_conf.val = 0;
+    I2S0.sample_rate_conf.tx_bck_div_num = 2;
+    I2S0.sample_rate_conf.tx_bits_mod = 8;
+    I2S0.sample_rate_conf.rx_bck_div_num = 1;
+    I2S0.sample_rate_conf.rx_bits_mod = config->bit_width;
+
+    // 配置数据格式
+    I2S0.conf.val = 0;
+    I2S0.conf.tx_right_first = 1;
+    I2S0.conf.tx_msb_right = 1;
+    I2S0.conf.tx_dma_equal = 1;
+    I2S0.conf.rx_right_first = 1;
+    I2S0.conf.rx_msb_right = 1;
+    I2S0.conf.rx_dma_equal = 1;
+
+    I2S0.conf1.val = 0;
+    I2S0.conf1.tx_pcm_bypass = 1;
+    I2S0.conf1.tx_stop_en = 1;
+    I2S0.conf1.rx_pcm_bypass = 1;
+
+    I2S0.conf2.val = 0;
+    I2S0.conf2.cam_sync_fifo_reset = 1;
+    I2S0.conf2.cam_sync_fifo_reset = 0;
+    I2S0.conf2.lcd_en = 1;
+    I2S0.conf2.camera_en = 1;
+    I2S0.conf2.i_v_sync_filter_en = 1;
+    I2S0.conf2.i_v_sync_filter_thres = 1;
+
+    I2S0.conf_chan.val = 0;
+    I2S0.conf_chan.tx_chan_mod = 1;
+    I2S0.conf_chan.rx_chan_mod = 1;
+
+    I2S0.fifo_conf.val = 0;
+    I2S0.fifo_conf.rx_fifo_mod_force_en = 1;
+    I2S0.fifo_conf.rx_data_num = 32;
+    I2S0.fifo_conf.rx_fifo_mod = 2;
+    I2S0.fifo_conf.tx_fifo_mod_force_en = 1;
+    I2S0.fifo_conf.tx_data_num = 32;
+    I2S0.fifo_conf.tx_fifo_mod = 2;
+    I2S0.fifo_conf.dscr_en = 1;
+
+    I2S0.lc_conf.out_rst  = 1;
+    I2S0.lc_conf.out_rst  = 0;
+    I2S0.lc_conf.in_rst  = 1;
+    I2S0.lc_conf.in_rst  = 0;
+    I2S0.lc_conf.ext_mem_bk_size = 0; // 16 byte PSRAM burst for zero copy frames
+
+    I2S0.timing.val = 0;
+
+    I2S0.int_ena.val = 0;
+    I2S0.int_clr.val = ~0;
+
+    I2S0.lc_conf.check_owner = 0;
+}
+
+int cam_hw_init(const cam_config_t *config)
+{
+    cam_i2s_set_pin(config);
+    cam_i2s_config(config);
+    if (esp_intr_alloc(ETS_I2S0_INTR_SOURCE, 0, cam_i2s_isr, NULL, NULL) != ESP_OK) {
+        ESP_LOGE(TAG, "cam i2s interrupt alloc error\n");
+        return -1;
+    }
+    return 0;
+}
+
+void cam_hw_set_link(lldesc_t *dma, uint32_t eof_size)
+{
+    I2S0.in_link.addr = ((uint32_t)dma) & 0xfffff;
+    I2S0.rx_eof_num = eof_size;
+}
+
+// H_ENABLE 接常高 / 常低来开关采样
+static void IRAM_ATTR cam_i2s_enable(void)
+{
+    gpio_matrix_in(0x38, I2S0I_H_ENABLE_IDX, false);
+}
+
+static void cam_i2s_disable(void)
+{
+    gpio_matrix_in(0x30, I2S0I_H_ENABLE_IDX, false);
+}
+
+void IRAM_ATTR cam_hw_start(void)
+{
+    I2S0.int_clr.in_suc_eof = 1;
+    I2S0.int_ena.in_suc_eof = 1;
+    I2S0.conf.rx_reset = 1;
+    I2S0.conf.rx_reset = 0;
+    I2S0.conf2.cam_sync_fifo_reset = 1;
+    I2S0.conf2.cam_sync_fifo_reset = 0;
+    I2S0.in_link.start = 1;
+    I2S0.conf.rx_start = 1;
+    cam_i2s_enable();
+}
+
+bool IRAM_ATTR cam_hw_eof_pending(void)
+{
+    return I2S0.int_raw.in_suc_eof;
+}
+
+void cam_hw_stop(void)
+{
+    cam_i2s_disable();
+    I2S0.conf.rx_start = 0;
+    I2S0.in_link.stop = 1;
+    I2S0.int_ena.in_suc_eof = 0;
+    I2S0.conf2.cam_sync_fifo_reset = 1;
+    I2S0.conf2.cam_sync_fifo_reset = 0;
+    I2S0.int_clr.in_suc_eof = 1;
+}
+
+void IRAM_ATTR cam_hw_halt(void)
+{
+    I2S0.conf.rx_start = 0;
+    I2S0.in_link.stop = 1;
+    I2S0.int_ena.in_suc_eof = 0;
+}
+
+void IRAM_ATTR cam_hw_resume(lldesc_t *dma)
+{
+    I2S0.lc_conf.in_rst = 1;
+    I2S0.lc_conf.in_rst = 0;
+    I2S0.conf.rx_reset = 1;
+    I2S0.conf.rx_reset = 0;
+    I2S0.conf2.cam_sync_fifo_reset = 1;
+    I2S0.conf2.cam_sync_fifo_reset = 0;
+    I2S0.in_link.addr = ((uint32_t)dma) & 0xfffff;
+    I2S0.int_clr.in_suc_eof = 1;
+    I2S0.int_ena.in_suc_eof = 1;
+    I2S0.in_link.start = 1;
+    I2S0.conf.rx_start = 1;
+}
+
+void cam_hw_reset_in(void)
+{
+    I2S0.lc_conf.in_rst = 1;
+    I2S0.lc_conf.in_rst = 0;
+}
+
+void IRAM_ATTR cam_hw_invalidate(void *buf, size_t len)
+{
+    Cache_Invalidate_Addr((uint32_t)buf, len);
+}
@@ -0,0 +1,182 @@
+#include <stdio.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_log.h"
+#include "soc/lcd_cam_struct.h"
+#include "soc/gdma_struct.h"
+#include "hal/gdma_ll.h"
+#include "esp_private/gdma.h"
+#include "esp32s3/rom/cache.h"
+#include "driver/periph_ctrl.h"
+#include "driver/gpio.h"
+#include "cam_hw.h"
+
+// ESP32-S3 LCD_CAM camera backend, needs IDF v4.4 or later for the GDMA driver and the LCD_CAM headers.
+// The channel comes from the GDMA driver, start and stop go through gdma_ll so cam_dma_restart can stay in IRAM
+
+static const char *TAG = "cam_lcd_cam";
+
+typedef struct {
+    gdma_channel_handle_t dma_chan;
+    int dma_id;
+    lldesc_t *link;    // chain cam_hw_start continues with
+} cam_lcd_cam_obj_t;
+
+static cam_lcd_cam_obj_t cam_lcd_cam_obj;
+
+static bool IRAM_ATTR cam_lcd_cam_eof(gdma_channel_handle_t dma_chan, gdma_event_data_t *event_data, void *user_data)
+{
+    BaseType_t HPTaskAwoken = pdFALSE;
+    cam_eof_from_isr(&HPTaskAwoken);
+    return HPTaskAwoken == pdTRUE; // the GDMA driver yields on return
+}
+
+static void cam_lcd_cam_set_pin(const cam_config_t *config)
+{
+    PIN_FUNC_SELECT(GPIO_PIN_MUX_REG[config->pin.pclk], PIN_FUNC_GPIO);
+    gpio_set_direction(config->pin.pclk, GPIO_MODE_INPUT);
+    gpio_set_pull_mode(config->pin.pclk, GPIO_FLOATING);
+    gpio_matrix_in(config->pin.pclk, CAM_PCLK_IDX, false);
+
+    PIN_FUNC_SELECT(GPIO_PIN_MUX_REG[config->pin.vsync], PIN_FUNC_GPIO);
+    gpio_set_direction(config->pin.vsync, GPIO_MODE_INPUT);
+    gpio_set_pull_mode(config->pin.vsync, GPIO_FLOATING);
+    gpio_matrix_in(config->pin.vsync, CAM_V_SYNC_IDX, true);
+
+    // HREF 作为 DE，HSYNC 接常高
+    PIN_FUNC_SELECT(GPIO_PIN_MUX_REG[config->pin.hsync], PIN_FUNC_GPIO);
+    gpio_set_direction(config->pin.hsync, GPIO_MODE_INPUT);
+    gpio_set_pull_mode(config->pin.hsync, GPIO_FLOATING);
+    gpio_matrix_in(config->pin.hsync, CAM_H_ENABLE_IDX, false);
+    gpio_matrix_in(0x38, CAM_H_SYNC_IDX, false);
+
+    for(int i = 0; i < config->bit_width; i++) {
+        PIN_FUNC_SELECT(GPIO_PIN_MUX_REG[config->pin_data[i]], PIN_FUNC_GPIO);
+        gpio_set_direction(config->pin_data[i], GPIO_MODE_INPUT);
+        gpio_set_pull_mode(config->pin_data[i], GPIO_FLOATING);
+        // 低位对齐，8位时只用 IN0 ~ IN7
+        gpio_matrix_in(config->pin_data[i], CAM_DATA_IN0_IDX + i, false);
+    }
+}
+
+static void cam_lcd_cam_config(const cam_config_t *config)
+{
+    // LCD 和 CAM 共用一个模块，各自配置自己的一半，可以同时工作
+    periph_module_enable(PERIPH_LCD_CAM_MODULE);
+
+    // 配置时钟, 160MHz / 2 = 80MHz, PCLK 用它来采样
+    LCD_CAM.cam_ctrl.val = 0;
+    LCD_CAM.cam_ctrl.cam_clk_sel = 3;
+    LCD_CAM.cam_ctrl.cam_clkm_div_num = 2;
+    LCD_CAM.cam_ctrl.cam_clkm_div_b = 0;
+    LCD_CAM.cam_ctrl.cam_clkm_div_a = 0;
+    LCD_CAM.cam_ctrl.cam_vsync_filter_thres = 1;
+    LCD_CAM.cam_ctrl.cam_vs_eof_en = 0; // EOF 由 cam_rec_data_bytelen 决定
+
+    LCD_CAM.cam_ctrl1.val = 0;
+    LCD_CAM.cam_ctrl1.cam_vsync_filter_en = 1;
+    LCD_CAM.cam_ctrl1.cam_2byte_en = config->bit_width == 16;
+    LCD_CAM.cam_ctrl1.cam_vh_de_mode_en = 0;
+    LCD_CAM.cam_rgb_yuv.val = 0;
+    LCD_CAM.cam_ctrl.cam_update = 1;
+}
+
+static int cam_lcd_cam_dma_config(void)
+{
+    gdma_channel_alloc_config_t alloc = {
+        .direction = GDMA_CHANNEL_DIRECTION_RX,
+    };
+    if (gdma_new_channel(&alloc, &cam_lcd_cam_obj.dma_chan) != ESP_OK) {
+        return -1;
+    }
+    gdma_connect(cam_lcd_cam_obj.dma_chan, GDMA_MAKE_TRIGGER(GDMA_TRIG_PERIPH_CAM, 0));
+    gdma_strategy_config_t strategy = {
+        .owner_check = false,
+        .auto_update_desc = false,
+    };
+    gdma_apply_strategy(cam_lcd_cam_obj.dma_chan, &strategy);
+    // zero copy frames in PSRAM are written through EDMA in 16 byte blocks
+    gdma_transfer_ability_t ability = {
+        .sram_trans_align = 4,
+        .psram_trans_align = CAM_HW_EXT_ALIGN,
+    };
+    gdma_set_transfer_ability(cam_lcd_cam_obj.dma_chan, &ability);
+    gdma_get_channel_id(cam_lcd_cam_obj.dma_chan, &cam_lcd_cam_obj.dma_id);
+    gdma_rx_event_callbacks_t cbs = {
+        .on_recv_eof = cam_lcd_cam_eof,
+    };
+    if (gdma_register_rx_event_callbacks(cam_lcd_cam_obj.dma_chan, &cbs, NULL) != ESP_OK) {
+        return -1;
+    }
+    gdma_ll_rx_enable_interrupt(&GDMA, cam_lcd_cam_obj.dma_id, GDMA_LL_EVENT_RX_SUC_EOF, false);
+    return 0;
+}
+
+int cam_hw_init(const cam_config_t *config)
+{
+    cam_lcd_cam_set_pin(config);
+    cam_lcd_cam_config(config);
+    if (cam_lcd_cam_dma_config() != 0) {
+        ESP_LOGE(TAG, "cam gdma channel error\n");
+        return -1;
+    }
+    return 0;
+}
+
+void cam_hw_set_link(lldesc_t *dma, uint32_t eof_size)
+{
+    cam_lcd_cam_obj.link = dma;
+    LCD_CAM.cam_ctrl1.cam_rec_data_bytelen = eof_size - 1;
+    LCD_CAM.cam_ctrl.cam_update = 1;
+}
+
+void IRAM_ATTR cam_hw_resume(lldesc_t *dma)
+{
+    int id = cam_lcd_cam_obj.dma_id;
+    LCD_CAM.cam_ctrl1.cam_afifo_reset = 1;
+    LCD_CAM.cam_ctrl1.cam_afifo_reset = 0;
+    gdma_ll_rx_reset_channel(&GDMA, id);
+    gdma_ll_rx_set_desc_addr(&GDMA, id, (uint32_t)dma);
+    gdma_ll_rx_clear_interrupt_status(&GDMA, id, GDMA_LL_EVENT_RX_SUC_EOF);
+    gdma_ll_rx_enable_interrupt(&GDMA, id, GDMA_LL_EVENT_RX_SUC_EOF, true);
+    gdma_ll_rx_start(&GDMA, id);
+}
+
+void IRAM_ATTR cam_hw_halt(void)
+{
+    gdma_ll_rx_stop(&GDMA, cam_lcd_cam_obj.dma_id);
+    gdma_ll_rx_enable_interrupt(&GDMA, cam_lcd_cam_obj.dma_id, GDMA_LL_EVENT_RX_SUC_EOF, false);
+}
+
+void IRAM_ATTR cam_hw_start(void)
+{
+    LCD_CAM.cam_ctrl1.cam_reset = 1;
+    LCD_CAM.cam_ctrl1.cam_reset = 0;
+    cam_hw_resume(cam_lcd_cam_obj.link);
+    LCD_CAM.cam_ctrl.cam_update = 1;
+    LCD_CAM.cam_ctrl1.cam_start = 1;
+}
+
+bool IRAM_ATTR cam_hw_eof_pending(void)
+{
+    return gdma_ll_rx_get_interrupt_status(&GDMA, cam_lcd_cam_obj.dma_id) & GDMA_LL_EVENT_RX_SUC_EOF;
+}
+
+void cam_hw_stop(void)
+{
+    LCD_CAM.cam_ctrl1.cam_start = 0;
+    LCD_CAM.cam_ctrl.cam_update = 1;
+    cam_hw_halt();
+    LCD_CAM.cam_ctrl1.cam_afifo_reset = 1;
+    LCD_CAM.cam_ctrl1.cam_afifo_reset = 0;
+    gdma_ll_rx_clear_interrupt_status(&GDMA, cam_lcd_cam_obj.dma_id, GDMA_LL_EVENT_RX_SUC_EOF);
+}
+
+void cam_hw_reset_in(void)
+{
+    gdma_ll_rx_reset_channel(&GDMA, cam_lcd_cam_obj.dma_id);
+}
+
+void IRAM_ATTR cam_hw_invalidate(void *buf, size_t len)
+{
+    Cache_Invalidate_Addr((uint32_t)buf, len);
+}
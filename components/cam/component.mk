@@ -0,0 +1,3 @@
+COMPONENT_ADD_LDFRAGMENTS += linker.lf
+# GNU Make builds stop at the S2, the S3 backend is CMake only
+COMPONENT_OBJEXCLUDE := cam_lcd_cam.o
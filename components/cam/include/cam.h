@@ -0,0 +1,205 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Called from cam_task for every finished half buffer, offset is its byte position in the frame.
+// buf is internal DMA memory that the DMA refills one half buffer time later.
+typedef void (*cam_stream_cb_t)(uint8_t *buf, size_t len, uint32_t offset, void *arg);
+
+typedef enum {
+    CAM_FORMAT_RAW = 0, // frame holds the sensor output as is, RGB565 or YUV422
+    CAM_FORMAT_Y,       // YUYV sensor output, frame holds the Y plane only
+    CAM_FORMAT_Y_UV,    // YUYV sensor output, frame holds the Y plane followed by an interleaved UV plane
+} cam_format_t;
+
+typedef enum {
+    CAM_STATS_OFF = 0,
+    CAM_STATS_RGB565,   // sensor sends big-endian RGB565
+    CAM_STATS_YUV422,   // sensor sends YUYV, the only choice with the Y formats
+} cam_stats_mode_t;
+
+#define CAM_STATS_HIST_BINS  (32) // 8 luma levels per bin
+#define CAM_STATS_ZONES      (4)  // zones per side, CAM_STATS_ZONES * CAM_STATS_ZONES in all
+
+// Exposure and white balance statistics of one frame, taken from every 4th pixel of every 4th line
+// of the whole sensor frame (the roi does not apply)
+typedef struct {
+    uint32_t seq;                      // cam_frame_t seq of the frame they were taken from
+    uint32_t samples;
+    uint32_t hist[CAM_STATS_HIST_BINS]; // luma histogram
+    uint8_t zone_mean[CAM_STATS_ZONES][CAM_STATS_ZONES]; // mean luma, [row][column]
+    uint32_t r_sum;                    // 8 bit channel sums over the samples
+    uint32_t g_sum;
+    uint32_t b_sum;
+} cam_stats_t;
+
+typedef enum {
+    CAM_CORE_AUTO = 0, // single core: no affinity, dual core: the core the network stack is not pinned to
+    CAM_CORE_0,
+    CAM_CORE_1,
+    CAM_CORE_ANY,      // no affinity
+} cam_core_t;
+
+typedef struct {
+    uint8_t bit_width;
+    uint32_t xclk_fre;
+    union {
+        struct {
+            uint32_t xclk:   8;
+            uint32_t pclk:   8;
+            uint32_t vsync:  8;
+            uint32_t hsync:  8;
+        };
+        uint32_t val;
+    } pin;
+    uint8_t pin_data[16];
+    union {
+        struct {
+            uint32_t width:   16;
+            uint32_t high:    16;
+        };
+        uint32_t val;
+    } size;
+    uint32_t max_buffer_size; // DMA used
+    // Priority scheme: the capture task must drain a half buffer before the next EOF, so keep it
+    // above every frame consumer (LCD, encoder, network senders) and above lwIP (tcpip_thread, 18),
+    // below the Wi-Fi task (23) whose bursts are short. Zero copy mode has no capture task.
+    uint8_t task_pri;
+    uint8_t task_core;        // cam_core_t
+    uint32_t task_stack;      // bytes, 0: 4096
+    union {
+        struct {
+            uint32_t jpeg:      1; // variable length frames ended by VSYNC, zero_copy is ignored
+            uint32_t zero_copy: 1; // DMA writes straight into frame buffers, no cam_task copy
+            uint32_t latest:    1; // latest frame wins: recycle the oldest ready frame when no buffer is free
+            uint32_t stream:    1; // hand each half buffer to stream_cb, no frame buffers, jpeg/zero_copy are ignored
+        };
+        uint32_t val;
+    } mode;
+    uint8_t *frame1_buffer;
+    uint8_t *frame2_buffer; // zero_copy: frame buffers are DMA targets, PSRAM buffers must be 4 byte aligned, 16 on the S3
+    uint8_t frame_cnt;       // frame pool depth, 0: use frame1_buffer/frame2_buffer
+    uint8_t **frame_buffer;  // frame_cnt frame buffers
+    uint32_t frame_buffer_size; // jpeg: bytes per frame buffer, raw modes always use width * high * 2
+    cam_stream_cb_t stream_cb;  // stream: half buffer consumer
+    void *stream_arg;
+    struct {
+        uint16_t x;
+        uint16_t y;
+        uint16_t width;         // 0: whole frame
+        uint16_t high;
+    } roi;                      // copy mode: region of the sensor output kept in the frame buffer
+    uint8_t decimate;           // copy mode: keep every Nth pixel and line of the roi, 0/1: all
+    uint8_t format;             // copy mode: cam_format_t, set the sensor to YUV422 for the Y formats
+    uint8_t convert;            // copy mode: pixel_convert_t applied to RGB565 lines while copying
+    uint8_t scale;              // copy mode: 2/4 box downscale while copying, 0/1: off
+    uint8_t rotate;             // copy mode: 1: rotate 90 degrees clockwise, 16 bit output only
+    uint8_t stats;              // copy mode: cam_stats_mode_t, gather cam_stats_t while copying
+    uint8_t burst_cnt;          // raw modes: frame slots set aside for cam_burst, more than the pool depth
+    uint8_t band_lines;         // copy mode without line ops: checksum every band_lines lines while copying, 0: off
+    uint16_t band_mask;         // band_lines: pixel bits the checksums take in, as stored, to ignore sensor noise. 0: all
+} cam_config_t;
+
+typedef struct {
+    uint8_t *buf;        // frame data
+    size_t len;          // valid bytes, the compressed size in jpeg mode
+    int64_t timestamp;   // media_clock_now() when the frame was complete, us
+    uint32_t seq;        // capture sequence number, a gap means frames were dropped
+    uint32_t dropped;    // frames dropped by the driver since cam_init
+    uint32_t overrun;    // half buffer events lost since cam_init, each one tears a frame
+    uint32_t resync;     // raw modes: VSYNC found the DMA off the frame start since cam_init, see cam_get_resync_cnt
+    const uint32_t *band_sum; // band_lines: checksum of each band of lines, equal sums mean the band is unchanged
+    uint16_t band_cnt;        // band_lines: entries of band_sum, the last band may be short
+} cam_frame_t;
+
+void cam_start(void);
+void cam_stop(void);
+cam_frame_t *cam_take_frame(void);
+void cam_give_frame(cam_frame_t *frame);
+uint8_t *cam_take(void);
+void cam_give(uint8_t *buffer);
+size_t cam_get_frame_len(uint8_t *buffer); // valid bytes in a frame from cam_take, the compressed size in jpeg mode
+int cam_init(const cam_config_t *config);
+
+// Reference counted frames, for several consumers of one frame without copies. cam_take_frame hands out a frame
+// with one reference and cam_give_frame drops it, cam_frame_ref adds one for every further holder. The frame goes
+// back to the pool when the last one is dropped. Holders only read the frame, in zero copy mode each of them
+// invalidates the cache over it
+void cam_frame_ref(cam_frame_t *frame);
+void cam_frame_unref(cam_frame_t *frame);
+
+typedef struct cam_sub cam_sub_t;
+
+typedef enum {
+    CAM_SUB_DROP_OLDEST = 0, // a full queue gives up its oldest frame for the new one: display, preview
+    CAM_SUB_DROP_NEWEST,     // a full queue skips the new frame: consumers that want the frames they have in order
+} cam_sub_drop_t;
+
+typedef struct {
+    const char *name;
+    uint8_t depth;  // frames queued for the subscriber, 0: 1
+    uint8_t drop;   // cam_sub_drop_t
+} cam_sub_config_t;
+
+// Subscribers get a reference to every finished frame in a queue of their own, so a slow one drops frames by its
+// policy without holding back the others. Once there is a subscriber cam_take_frame/cam_take get nothing, take
+// frames with cam_sub_take and release them with cam_frame_unref. A subscriber holds up to depth + 1 frames,
+// make frame_cnt cover the sum over the subscribers plus one for the capture, with fewer the driver drops.
+// Up to 4, added after cam_init and kept for the life of the camera. NULL on error
+cam_sub_t *cam_sub_add(const cam_sub_config_t *config);
+
+// Next frame of the subscriber, NULL on timeout
+cam_frame_t *cam_sub_take(cam_sub_t *sub, uint32_t timeout_ms);
+
+// Frames queued for the subscriber and frames it missed because its queue was full
+void cam_sub_get_stats(cam_sub_t *sub, uint32_t *delivered, uint32_t *dropped);
+
+// Worst EOF interrupt to capture task wake up time since cam_init in us, 0 in zero copy mode
+uint32_t cam_get_wake_latency(void);
+
+typedef struct {
+    uint8_t frame_cnt;          // frames back to back, at most burst_cnt or the pool depth of cam_init
+    uint8_t **frame_buffer;     // frame_cnt buffers of the current frame size, zero_copy: aligned as frame_buffer
+    uint32_t timeout_ms;        // the whole burst, 0: 1 s plus 200 ms per frame
+} cam_burst_config_t;
+
+// Capture frame_cnt consecutive frames at the sensor rate into the buffers, with no consumer in the loop: no frame
+// skip, no latest policy, no subscribers. Blocks until the last frame is in, frames[i] then describes the frame in
+// buffer i with its timestamp and seq, a gap in seq means copy mode fell behind. The DMA stops on the last frame,
+// the frame pool and the capture state from before are restored after it. Give back every taken frame first.
+// Raw modes only. -1 on error or timeout
+int cam_burst(const cam_burst_config_t *burst, cam_frame_t *frames);
+
+// Raw modes check the half buffer count at every VSYNC edge. An EOF interrupt that merged into the next one under
+// load leaves it off by one, which would shift every later frame. The DMA is moved back to the frame start then,
+// the frame in progress is dropped and this counts up. Zero after cam_init
+uint32_t cam_get_resync_cnt(void);
+
+// Gate the sensor clock while capture is stopped, the sensor keeps its registers. The OV2640 needs XCLK for SCCB:
+// put it in standby before gating and ungate before waking it
+void cam_set_xclk_enable(uint8_t en);
+
+// Deliver only one of every skip + 1 frames, skipped frames are not copied and not counted as dropped.
+// Stream mode ignores it
+void cam_set_skip(uint8_t skip);
+
+// Finished frames waiting for cam_take/cam_take_frame, with subscribers the longest of their queues
+int cam_get_ready_cnt(void);
+
+// Statistics of the last frame cam_task copied, for an AE/AWB loop driving the sensor registers.
+// -1 when stats is off or no frame was finished yet
+int cam_get_stats(cam_stats_t *stats);
+
+// Change size, frame buffers or max_buffer_size without cam_init, the capture mode must stay the same.
+// Give back every taken frame first, capture resumes if it was running
+int cam_reconfigure(const cam_config_t *config);
+
+#ifdef __cplusplus
+}
+#endif
+
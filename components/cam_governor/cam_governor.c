@@ -0,0 +1,113 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "cam.h"
+#include "ov2640.h"
+#include "cam_governor.h"
+
+static const char *TAG = "cam_governor";
+
+#define CAM_GOVERNOR_UP_WINDOWS 2 // windows with headroom before the rate goes back up
+
+typedef struct {
+    uint8_t clkrc_max;
+    uint8_t skip_max;
+    int64_t period;
+    int level;
+    int64_t window_start;
+    uint32_t frames;
+    uint32_t ready_sum;  // ready frames seen before each take
+    int64_t wait;        // us the consumer blocked in cam_take_frame
+    uint32_t dropped_base;
+    uint8_t has_base;
+    uint8_t headroom;
+} cam_governor_obj_t;
+
+static cam_governor_obj_t *cam_governor_obj = NULL;
+
+// Levels first raise the CLKRC divider, then the frame skip
+static void cam_governor_apply(int level)
+{
+    int div = level < cam_governor_obj->clkrc_max ? level : cam_governor_obj->clkrc_max;
+    int skip = level - div;
+    OV2640_Clock_Set(div);
+    cam_set_skip(skip);
+    ESP_LOGI(TAG, "level: %d, clkrc: %d, skip: %d\n", level, div, skip);
+}
+
+static void cam_governor_evaluate(cam_frame_t *frame, int64_t window)
+{
+    int level = cam_governor_obj->level;
+    int level_max = cam_governor_obj->clkrc_max + cam_governor_obj->skip_max;
+    uint32_t dropped = frame->dropped - cam_governor_obj->dropped_base;
+    cam_governor_obj->dropped_base = frame->dropped;
+
+    if (dropped > 0 || cam_governor_obj->ready_sum >= cam_governor_obj->frames) {
+        // 消费者跟不上：有帧被回收，或者总有帧在排队
+        cam_governor_obj->headroom = 0;
+        if (level < level_max) {
+            level++;
+        }
+    } else if (cam_governor_obj->wait * 4 > window) {
+        // 消费者有超过 1/4 的时间在等帧，连续几个窗口后再提高帧率，避免来回振荡
+        if (++cam_governor_obj->headroom >= CAM_GOVERNOR_UP_WINDOWS && level > 0) {
+            cam_governor_obj->headroom = 0;
+            level--;
+        }
+    } else {
+        cam_governor_obj->headroom = 0;
+    }
+    if (level != cam_governor_obj->level) {
+        cam_governor_obj->level = level;
+        cam_governor_apply(level);
+    }
+}
+
+cam_frame_t *cam_governor_take(void)
+{
+    int64_t start = esp_timer_get_time();
+    int ready = cam_get_ready_cnt();
+    cam_frame_t *frame = cam_take_frame();
+    int64_t now = esp_timer_get_time();
+    if (!cam_governor_obj->has_base) {
+        cam_governor_obj->has_base = 1;
+        cam_governor_obj->dropped_base = frame->dropped;
+        cam_governor_obj->window_start = now;
+        return frame;
+    }
+    cam_governor_obj->wait += now - start;
+    cam_governor_obj->ready_sum += ready;
+    cam_governor_obj->frames++;
+    if (now - cam_governor_obj->window_start >= cam_governor_obj->period) {
+        cam_governor_evaluate(frame, now - cam_governor_obj->window_start);
+        cam_governor_obj->window_start = now;
+        cam_governor_obj->frames = 0;
+        cam_governor_obj->ready_sum = 0;
+        cam_governor_obj->wait = 0;
+    }
+    return frame;
+}
+
+int cam_governor_get_level(void)
+{
+    return cam_governor_obj ? cam_governor_obj->level : 0;
+}
+
+int cam_governor_init(const cam_governor_config_t *config)
+{
+    if (config->clkrc_max > 0x3F) {
+        ESP_LOGE(TAG, "clkrc_max error\n");
+        return -1;
+    }
+    cam_governor_obj = (cam_governor_obj_t *)calloc(1, sizeof(cam_governor_obj_t));
+    if (!cam_governor_obj) {
+        ESP_LOGE(TAG, "governor object malloc error\n");
+        return -1;
+    }
+    cam_governor_obj->clkrc_max = config->clkrc_max;
+    cam_governor_obj->skip_max = config->skip_max;
+    cam_governor_obj->period = (int64_t)(config->period_ms ? config->period_ms : 1000) * 1000;
+    cam_governor_apply(0);
+    return 0;
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <stdint.h>
+#include "cam.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Frame rate governor: match what the OV2640 produces to what the consumer takes.
+// Every period it looks at recycled frames, ready queue occupancy and how long the consumer
+// waited in cam_take_frame, then steps the sensor clock divider (CLKRC) and the driver frame skip.
+// Slowing the sensor first saves PCLK, DMA and interrupt work, skip covers what the divider can not.
+
+typedef struct {
+    uint8_t clkrc_max;  // largest CLKRC divider, 0 ~ 63
+    uint8_t skip_max;   // largest frame skip, see cam_set_skip
+    uint32_t period_ms; // evaluation window, 0: 1000
+} cam_governor_config_t;
+
+// Use instead of cam_take_frame in the consumer loop
+cam_frame_t *cam_governor_take(void);
+
+// Current step, 0: full rate
+int cam_governor_get_level(void);
+
+int cam_governor_init(const cam_governor_config_t *config);
+
+#ifdef __cplusplus
+}
+#endif
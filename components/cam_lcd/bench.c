@@ -0,0 +1,81 @@
+#include <stdio.h>
+#include <string.h>
+#include "esp_timer.h"
+#include "bench.h"
+
+#define BENCH_BUCKET_US   (100) // histogram resolution
+#define BENCH_BUCKET_CNT  (400) // 0 ~ 40ms, slower samples land in the last bucket
+
+typedef struct {
+    int64_t min;
+    int64_t max;
+    int64_t sum;
+    uint32_t cnt;
+    uint16_t hist[BENCH_BUCKET_CNT];
+} bench_stat_t;
+
+static const char *bench_name[BENCH_MAX] = {"take", "set_index", "write", "give", "frame", "latency"};
+static bench_stat_t bench_stat[BENCH_MAX];
+static int64_t bench_time = 0;
+static int64_t bench_period = 0;
+
+void bench_init(uint32_t report_ms)
+{
+    memset(bench_stat, 0, sizeof(bench_stat));
+    bench_period = (int64_t)report_ms * 1000;
+    bench_time = esp_timer_get_time();
+}
+
+void bench_record(bench_point_t point, int64_t us)
+{
+    bench_stat_t *stat = &bench_stat[point];
+    if (stat->cnt == 0 || us < stat->min) {
+        stat->min = us;
+    }
+    if (us > stat->max) {
+        stat->max = us;
+    }
+    stat->sum += us;
+    stat->cnt++;
+    int bucket = us / BENCH_BUCKET_US;
+    if (bucket >= BENCH_BUCKET_CNT) {
+        bucket = BENCH_BUCKET_CNT - 1;
+    }
+    if (stat->hist[bucket] != UINT16_MAX) {
+        stat->hist[bucket]++;
+    }
+}
+
+// Upper edge of the bucket holding the 99th percentile sample
+static int64_t bench_p99(bench_stat_t *stat)
+{
+    uint32_t target = stat->cnt - stat->cnt / 100;
+    uint32_t cnt = 0;
+    for (int x = 0; x < BENCH_BUCKET_CNT; x++) {
+        cnt += stat->hist[x];
+        if (cnt >= target) {
+            return (int64_t)(x + 1) * BENCH_BUCKET_US;
+        }
+    }
+    return stat->max;
+}
+
+void bench_report(void)
+{
+    int64_t now = esp_timer_get_time();
+    if (now - bench_time < bench_period) {
+        return;
+    }
+    uint32_t frames = bench_stat[BENCH_FRAME].cnt;
+    printf("BENCH fps: %.1f\n", frames * 1000000.0 / (now - bench_time));
+    for (int x = 0; x < BENCH_MAX; x++) {
+        bench_stat_t *stat = &bench_stat[x];
+        if (stat->cnt == 0) {
+            continue;
+        }
+        printf("BENCH %-9s min: %6lld avg: %6lld p99: %6lld max: %6lld us, n: %u\n", bench_name[x],
+               stat->min, stat->sum / stat->cnt, bench_p99(stat), stat->max, stat->cnt);
+    }
+    memset(bench_stat, 0, sizeof(bench_stat));
+    bench_time = now;
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    BENCH_TAKE = 0,  // cam_take
+    BENCH_SET_INDEX, // lcd_set_index
+    BENCH_WRITE,     // lcd_write_data until the last byte is out
+    BENCH_GIVE,      // cam_give
+    BENCH_FRAME,     // one loop iteration
+    BENCH_LATENCY,   // capture done to display done
+    BENCH_MAX,
+} bench_point_t;
+
+// report_ms: period of the UART report
+void bench_init(uint32_t report_ms);
+
+void bench_record(bench_point_t point, int64_t us);
+
+// Print and reset the statistics once report_ms has passed since the last report
+void bench_report(void);
+
+// Time the memcpy, LCD push and SCCB write micro-benchmarks, the LCD and sensor must be initialized
+void bench_ubench_run(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,93 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_heap_caps.h"
+#include "lcd.h"
+#include "sccb.h"
+#include "ubench.h"
+#include "bench.h"
+
+#define UBENCH_LCD_WIDTH  (320)
+#define UBENCH_LCD_HIGH   (240)
+#define UBENCH_LCD_BYTES  (UBENCH_LCD_WIDTH * UBENCH_LCD_HIGH * 2)
+#define UBENCH_LCD_LINES  (16)  // one stripe from internal RAM, a whole frame does not fit there
+
+typedef struct {
+    uint8_t *frame;
+} ubench_lcd_t;
+
+static int ubench_lcd_setup(void **ctx, uint32_t caps, int bytes)
+{
+    ubench_lcd_t *l = (ubench_lcd_t *)calloc(1, sizeof(ubench_lcd_t));
+    if (!l) {
+        return -1;
+    }
+    l->frame = heap_caps_malloc(bytes, caps);
+    if (!l->frame) {
+        free(l);
+        return -1;
+    }
+    // 灰色竖条, 推屏过程中可以看到
+    for (int i = 0; i < bytes; i++) {
+        l->frame[i] = (i / 64) & 1 ? 0x84 : 0x10;
+    }
+    *ctx = l;
+    return 0;
+}
+
+static int ubench_lcd_frame_setup(void **ctx)
+{
+    return ubench_lcd_setup(ctx, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT, UBENCH_LCD_BYTES);
+}
+
+static int ubench_lcd_lines_setup(void **ctx)
+{
+    return ubench_lcd_setup(ctx, MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA, UBENCH_LCD_WIDTH * UBENCH_LCD_LINES * 2);
+}
+
+static void ubench_lcd_teardown(void *ctx)
+{
+    ubench_lcd_t *l = (ubench_lcd_t *)ctx;
+    heap_caps_free(l->frame);
+    free(l);
+}
+
+// One frame until the last byte is out, the way the preview sends it
+static void ubench_lcd_push(void *ctx)
+{
+    ubench_lcd_t *l = (ubench_lcd_t *)ctx;
+    lcd_set_index(0, 0, UBENCH_LCD_WIDTH - 1, UBENCH_LCD_HIGH - 1);
+    lcd_write_data(l->frame, UBENCH_LCD_BYTES);
+}
+
+static void ubench_lcd_push_lines(void *ctx)
+{
+    ubench_lcd_t *l = (ubench_lcd_t *)ctx;
+    lcd_set_index(0, 0, UBENCH_LCD_WIDTH - 1, UBENCH_LCD_LINES - 1);
+    lcd_write_data(l->frame, UBENCH_LCD_WIDTH * UBENCH_LCD_LINES * 2);
+}
+
+static uint8_t ubench_sccb_bank = 0;
+
+// The bank register alternates so the shadow cache can not skip the write, each call is a bus transaction
+static void ubench_sccb_write(void *ctx)
+{
+    ubench_sccb_bank ^= 1;
+    SCCB_WR_Reg(0xFF, ubench_sccb_bank);
+}
+
+UBENCH_CASE(lcd_push_frame, .setup = ubench_lcd_frame_setup, .run = ubench_lcd_push, .teardown = ubench_lcd_teardown,
+            .bytes = UBENCH_LCD_BYTES, .mode = UBENCH_PINNED, .warmup = 2, .iterations = 16);
+UBENCH_CASE(lcd_push_lines, .setup = ubench_lcd_lines_setup, .run = ubench_lcd_push_lines, .teardown = ubench_lcd_teardown,
+            .bytes = UBENCH_LCD_WIDTH * UBENCH_LCD_LINES * 2, .mode = UBENCH_PINNED);
+UBENCH_CASE(sccb_write, .run = ubench_sccb_write, .mode = UBENCH_PINNED);
+
+void bench_ubench_run(void)
+{
+    ubench_register_mem();
+    UBENCH_REGISTER(lcd_push_frame);
+    UBENCH_REGISTER(lcd_push_lines);
+    UBENCH_REGISTER(sccb_write);
+    ubench_config_t config = UBENCH_DEFAULT_CONFIG();
+    ubench_run(&config);
+}
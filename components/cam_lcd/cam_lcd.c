@@ -0,0 +1,465 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "esp_system.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "media_clock.h"
+#include "cam.h"
+#include "ov2640.h"
+#include "lcd.h"
+#include "motion.h"
+#include "jobs.h"
+#include "qr_scan.h"
+#include "screenshot.h"
+#include "cam_governor.h"
+#include "sysmon.h"
+#include "boot_steps.h"
+#include "boot_marks.h"
+#include "power.h"
+#include "mem_place.h"
+#include "param.h"
+#include "bench.h"
+#include "selftest.h"
+#include "cam_lcd.h"
+
+static const char *TAG = "cam_lcd";
+
+#define ESP_KALUGA_V1_2 1
+
+#if ESP_KALUGA_V1_2
+
+#define LCD_CLK   GPIO_NUM_15
+#define LCD_MOSI  GPIO_NUM_9
+#define LCD_DC    GPIO_NUM_13
+#define LCD_RST   GPIO_NUM_16
+#define LCD_CS    GPIO_NUM_11
+#define LCD_BK    GPIO_NUM_6
+
+#define CAM_XCLK  GPIO_NUM_1
+#define CAM_PCLK  GPIO_NUM_33 //修改位置
+#define CAM_VSYNC GPIO_NUM_2
+#define CAM_HSYNC GPIO_NUM_3
+
+#define CAM_D0    GPIO_NUM_46
+#define CAM_D1    GPIO_NUM_45
+#define CAM_D2    GPIO_NUM_41
+#define CAM_D3    GPIO_NUM_42
+#define CAM_D4    GPIO_NUM_39
+#define CAM_D5    GPIO_NUM_40
+#define CAM_D6    GPIO_NUM_21
+#define CAM_D7    GPIO_NUM_38
+
+#else
+
+#define LCD_CLK   GPIO_NUM_15
+#define LCD_MOSI  GPIO_NUM_9
+#define LCD_DC    GPIO_NUM_13
+#define LCD_RST   GPIO_NUM_16
+#define LCD_CS    GPIO_NUM_11
+#define LCD_BK    GPIO_NUM_6
+
+#define CAM_XCLK  GPIO_NUM_1
+#define CAM_PCLK  GPIO_NUM_0
+#define CAM_VSYNC GPIO_NUM_2
+#define CAM_HSYNC GPIO_NUM_3
+
+#define CAM_D0    GPIO_NUM_46
+#define CAM_D1    GPIO_NUM_45
+#define CAM_D2    GPIO_NUM_41
+#define CAM_D3    GPIO_NUM_42
+#define CAM_D4    GPIO_NUM_39
+#define CAM_D5    GPIO_NUM_40
+#define CAM_D6    GPIO_NUM_21
+#define CAM_D7    GPIO_NUM_38
+
+#endif
+
+#define CAM_WIDTH   (320)
+#define CAM_HIGH    (240)
+
+// 送屏方式在 menuconfig -> Camera LCD loopback 中选择
+#define CAM_LCD_BENCH  CONFIG_CAM_LCD_PIPELINE_BENCH  // 统计各环节耗时，周期性通过串口输出 min/avg/p99
+#define CAM_LCD_STREAM CONFIG_CAM_LCD_PIPELINE_STREAM // 每个半 buffer 直接送屏，不使用 PSRAM 帧 buffer，延迟更低
+#define CAM_LCD_MOTION CONFIG_CAM_LCD_MOTION          // 只刷新有运动的区域，静止画面不送屏
+#define CAM_LCD_GOVERNOR CONFIG_CAM_LCD_GOVERNOR      // 根据送屏速度调整 sensor 时钟和跳帧
+#define CAM_LCD_SYSMON CONFIG_CAM_LCD_SYSMON          // 周期性打印各核负载、任务 CPU 占用和栈余量
+#define CAM_LCD_POWER CONFIG_CAM_LCD_POWER            // 空闲时降频或进入 light sleep
+#define CAM_LCD_QR CONFIG_CAM_LCD_QR                  // 在低优先级任务中识别二维码，不影响送屏帧率
+#define CAM_LCD_LCD_MIRROR CONFIG_CAM_LCD_LCD_MIRROR  // 预览镜像由 LCD MADCTL 完成，采集的帧不镜像
+#define CAM_LCD_SCREENSHOT CONFIG_CAM_LCD_SCREENSHOT  // 通过 HTTP 按需抓取送屏帧的 JPEG 截图，用于现场诊断
+#define CAM_LCD_UBENCH CONFIG_CAM_LCD_UBENCH          // 预览开始前运行 memcpy、送屏、SCCB 的微基准测试
+#define CAM_LCD_UPSCALE CONFIG_CAM_LCD_UPSCALE        // 采集 160x120，送屏时放大 2 倍，PSRAM 带宽降为 1/4
+#define CAM_LCD_BANDS CONFIG_CAM_LCD_BANDS            // 按行带校验和只刷新变化的行，静止画面几乎不占用 SPI
+#define CAM_LCD_PARAM_CONSOLE CONFIG_CAM_LCD_PARAM_CONSOLE // 通过串口 "param set" 修改时钟和 buffer 大小，重启后生效
+#define CAM_LCD_SELFTEST CONFIG_CAM_LCD_SELFTEST      // 启动时用 sensor 彩条检查采集通路和帧率，工厂测试及现场诊断
+#define CAM_LCD_JOBS CONFIG_CAM_LCD_JOBS              // 运动检测按块行拆成任务，由各核的工作线程分担
+
+// 采集尺寸，CAM_WIDTH x CAM_HIGH 为屏上的预览尺寸
+#if CAM_LCD_UPSCALE
+#define CAP_WIDTH   (CAM_WIDTH / 2)
+#define CAP_HIGH    (CAM_HIGH / 2)
+#else
+#define CAP_WIDTH   CAM_WIDTH
+#define CAP_HIGH    CAM_HIGH
+#endif
+
+#if CAM_LCD_BANDS
+#define CAM_LCD_BAND_LINES   (16)
+#define CAM_LCD_BAND_MASK    (0x18c7) // 大端 RGB565 每个通道只取高 2~3 位，忽略噪声
+#define CAM_LCD_BAND_REFRESH (30)     // 每 30 帧整屏刷新一次
+#define CAM_LCD_BAND_CNT     ((CAM_HIGH + CAM_LCD_BAND_LINES - 1) / CAM_LCD_BAND_LINES)
+
+// Mark the bands whose checksum differs from the one on screen, 1 if any
+static int cam_lcd_bands_mark(const cam_frame_t *frame, uint32_t *shown, int full)
+{
+    int changed = 0;
+    for (int b = 0; b < frame->band_cnt && b < CAM_LCD_BAND_CNT; b++) {
+        if (!full && frame->band_sum[b] == shown[b]) {
+            continue;
+        }
+        int y_end = (b + 1) * CAM_LCD_BAND_LINES < CAM_HIGH ? (b + 1) * CAM_LCD_BAND_LINES : CAM_HIGH;
+        lcd_mark_dirty(0, b * CAM_LCD_BAND_LINES, CAM_WIDTH - 1, y_end - 1);
+        shown[b] = frame->band_sum[b];
+        changed = 1;
+    }
+    return changed;
+}
+#endif
+
+#if CAM_LCD_QR
+static void cam_lcd_qr_cb(const char *text, size_t len, void *arg)
+{
+    ESP_LOGI(TAG, "QR code: %s", text);
+}
+#endif
+
+#if CAM_LCD_SCREENSHOT
+static void cam_lcd_screenshot_release(const uint8_t *frame, void *arg)
+{
+    cam_frame_unref((cam_frame_t *)arg);
+}
+#endif
+
+#if CAM_LCD_STREAM
+static void cam_stream_cb(uint8_t *buf, size_t len, uint32_t offset, void *arg)
+{
+    if (offset == 0) {
+        lcd_set_index(0, 0, CAM_WIDTH - 1, CAM_HIGH - 1);
+    }
+    lcd_write_data(buf, len);
+}
+#endif
+
+#if !CAM_LCD_STREAM
+// 工厂固件在 menuconfig 中打开，现场设备通过 "param set cam.selftest on" 在下次启动时运行
+static void cam_lcd_selftest(void)
+{
+#if CAM_LCD_SELFTEST
+    const bool on = true;
+#else
+    const bool on = false;
+#endif
+    if (!param_bool("cam.selftest", on, "check the camera path with the color bar at boot")) {
+        return;
+    }
+    selftest_config_t config = {
+        .width = CAP_WIDTH,
+        .high = CAP_HIGH,
+        .frames = param_int("cam.st_frames", 60, 10, 600, "frames the self-test checks"),
+        .min_fps = param_int("cam.st_min_fps", 25, 0, 60, "sensor frame rate the self-test needs, 0: any"),
+        .poison = CAM_LCD_BANDS, // 只有拷贝模式可以清空帧 buffer，zero copy 时 DMA 绕过 cache 写入
+    };
+    selftest_result_t result;
+    selftest_run(&config, &result);
+}
+#endif
+
+// The LCD reset sleeps about 300 ms, the sensor is configured over SCCB meanwhile
+static int cam_lcd_lcd_init(void *arg)
+{
+    lcd_config_t lcd_config = {
+        .clk_fre = param_int("lcd.clk_hz", 80 * 1000 * 1000, 10 * 1000 * 1000, 80 * 1000 * 1000, "LCD SPI clock"),
+        .pin_clk = LCD_CLK,
+        .pin_mosi = LCD_MOSI,
+        .pin_dc = LCD_DC,
+        .pin_cs = LCD_CS,
+        .pin_rst = LCD_RST,
+        .pin_bk = LCD_BK,
+        .max_buffer_size = param_int("lcd.buf", 16 * 1024, 4 * 1024, 64 * 1024, "LCD DMA and bounce buffer bytes"),
+        .bounce = 1, // PSRAM 帧经两个内部 buffer 中转发送
+        .horizontal = 2 // 2: UP, 3： DOWN
+    };
+
+    if (lcd_init(&lcd_config) != 0) {
+        return -1;
+    }
+#if CAM_LCD_LCD_MIRROR
+    lcd_set_rotation(lcd_config.horizontal, 1);
+#endif
+    return 0;
+}
+
+static int cam_lcd_cam_init(void *arg)
+{
+    cam_config_t cam_config = {
+        .bit_width = 8,
+        .xclk_fre = param_int("cam.xclk_hz", 16 * 1000 * 1000, 8 * 1000 * 1000, 24 * 1000 * 1000, "sensor XCLK"),
+        .pin = {
+            .xclk  = CAM_XCLK,
+            .pclk  = CAM_PCLK,
+            .vsync = CAM_VSYNC,
+            .hsync = CAM_HSYNC,
+        },
+        .pin_data = {CAM_D0, CAM_D1, CAM_D2, CAM_D3, CAM_D4, CAM_D5, CAM_D6, CAM_D7},
+        .size = {
+            .width = CAP_WIDTH,
+            .high  = CAP_HIGH,
+        },
+        .max_buffer_size = param_int("cam.buf", 64 * 1024, 8 * 1024, 128 * 1024, "camera DMA buffer bytes, two halves"),
+        .task_pri = 10, // 高于送屏任务 (5)，见 cam.h 中的优先级说明
+        .task_core = CAM_CORE_AUTO,
+#if CAM_LCD_STREAM
+        .mode.stream = 1,
+        .stream_cb = cam_stream_cb,
+#elif CAM_LCD_BANDS
+        .mode.latest = 1,
+        .band_lines = CAM_LCD_BAND_LINES, // 校验和在 cam_task 拷贝时计算，不能使用 zero copy
+        .band_mask = CAM_LCD_BAND_MASK,
+#else
+        .mode.zero_copy = 1, // DMA 直接写入帧 buffer，省去 cam_task 的拷贝
+        .mode.latest = 1,    // 显示跟不上时丢弃最旧的帧
+#endif
+    };
+
+#if !CAM_LCD_STREAM
+    // 使用PingPang buffer，帧率更高， 也可以单独使用一个buffer节省内存
+    cam_config.frame1_buffer = (uint8_t *)mem_place_alloc("cam_frame", MEM_PLACE_BULK, CAP_WIDTH * CAP_HIGH * 2 * sizeof(uint8_t));
+    cam_config.frame2_buffer = (uint8_t *)mem_place_alloc("cam_frame", MEM_PLACE_BULK, CAP_WIDTH * CAP_HIGH * 2 * sizeof(uint8_t));
+#endif
+
+    if (cam_init(&cam_config) != 0) {
+        return -1;
+    }
+    if (OV2640_Init(0, 1) == 1) {
+        return -1;
+    }
+	OV2640_RGB565_Mode(false);	//RGB565模式
+    OV2640_ImageSize_Set(800, 600);
+    OV2640_ImageWin_Set(0, 0, 800, 600);
+  	OV2640_OutSize_Set(CAP_WIDTH, CAP_HIGH); 
+#if CAM_LCD_LCD_MIRROR
+    OV2640_Flip_Set(0, 0); // OV2640_Init 默认镜像，交给 LCD
+#endif
+    ESP_LOGI(TAG, "camera init done\n");
+    return 0;
+}
+
+static void cam_lcd_task(void *arg)
+{
+    static const boot_step_t steps[] = {
+        {.name = "lcd", .fn = cam_lcd_lcd_init},
+        {.name = "cam", .fn = cam_lcd_cam_init},
+    };
+    if (boot_steps_run(steps, sizeof(steps) / sizeof(steps[0])) != 0) {
+        vTaskDelete(NULL);
+        return;
+    }
+    mem_place_report();
+#if CAM_LCD_UBENCH
+    bench_ubench_run();
+#endif
+#if CAM_LCD_MOTION
+    motion_config_t motion_config = {
+        .width = CAP_WIDTH,
+        .high = CAP_HIGH,
+        .bpp = 2,
+        .scale = 4,
+        .block = 8,
+        .threshold = 12,
+        .jobs = jobs_workers(),
+    };
+    motion_init(&motion_config);
+#endif
+#if CAM_LCD_QR
+    qr_scan_config_t qr_config = {
+        .width = CAP_WIDTH,
+        .high = CAP_HIGH,
+        .format = QR_SCAN_RGB565,
+        .scale = 1,
+        .task_pri = 4, // 低于送屏任务，空闲时才解码
+        .task_core = -1,
+        .cb = cam_lcd_qr_cb,
+    };
+    qr_scan_init(&qr_config);
+#endif
+#if CAM_LCD_SCREENSHOT
+    screenshot_config_t screenshot_config = {
+        .task_pri = 2, // 编码在这个任务中进行，低于送屏和二维码识别
+        .task_core = -1,
+        .size[SCREENSHOT_LCD] = {.width = CAP_WIDTH, .high = CAP_HIGH},
+    };
+    screenshot_init(&screenshot_config);
+#endif
+#if CAM_LCD_GOVERNOR
+    cam_governor_config_t governor_config = {
+        .clkrc_max = 3,
+        .skip_max = 4,
+    };
+    cam_governor_init(&governor_config);
+#endif
+    cam_start();
+#if !CAM_LCD_STREAM
+    cam_lcd_selftest();
+#endif
+#if CAM_LCD_STREAM
+    vTaskDelete(NULL); // 送屏在 cam_stream_cb 中完成
+#endif
+#if CAM_LCD_BENCH
+    bench_init(5000);
+    while (1) {
+        int64_t start = esp_timer_get_time();
+        cam_frame_t *frame = cam_take_frame();
+        int64_t t1 = esp_timer_get_time();
+        lcd_set_index(0, 0, CAM_WIDTH - 1, CAM_HIGH - 1);
+        int64_t t2 = esp_timer_get_time();
+        lcd_write_data(frame->buf, frame->len);
+        int64_t t3 = esp_timer_get_time();
+        cam_give_frame(frame);
+        int64_t t4 = esp_timer_get_time();
+        bench_record(BENCH_TAKE, t1 - start);
+        bench_record(BENCH_SET_INDEX, t2 - t1);
+        bench_record(BENCH_WRITE, t3 - t2);
+        bench_record(BENCH_GIVE, t4 - t3);
+        bench_record(BENCH_FRAME, t4 - start);
+        bench_record(BENCH_LATENCY, t3 - frame->timestamp);
+        bench_report();
+    }
+#endif
+    int64_t stat_time = media_clock_now();
+    int64_t present_latency = 0;
+    uint32_t stat_seq = 0;
+    int stat_cnt = 0;
+    int first_frame = 1;
+#if CAM_LCD_MOTION
+    int full_refresh = 1;
+#endif
+#if CAM_LCD_BANDS
+    static uint32_t band_shown[CAM_LCD_BAND_CNT];
+    int band_frames = 0;
+#endif
+    while (1) {
+#if CAM_LCD_GOVERNOR
+        cam_frame_t *frame = cam_governor_take();
+#else
+        cam_frame_t *frame = cam_take_frame();
+#endif
+        if (first_frame) {
+            first_frame = 0;
+            boot_mark(BOOT_MARK_FIRST_FRAME);
+            boot_marks_print();
+        }
+        int64_t latency = media_clock_now() - frame->timestamp;
+#if CAM_LCD_MOTION
+        motion_event_t motion;
+        int ret = motion_detect(frame->buf, &motion);
+#if CAM_LCD_UPSCALE
+        if (ret == 1 || full_refresh) { // 放大后的区域刷新不划算，有运动时整屏刷新
+            lcd_set_index(0, 0, CAM_WIDTH - 1, CAM_HIGH - 1);
+            lcd_write_scaled2x(frame->buf, CAP_WIDTH, CAP_HIGH);
+            stat_cnt++;
+        }
+#else
+        if (ret == 1) {
+            lcd_mark_dirty(motion.x, motion.y, motion.x + motion.width - 1, motion.y + motion.high - 1);
+            lcd_flush_dirty(frame->buf, CAM_WIDTH);
+            stat_cnt++;
+        } else if (full_refresh) { // 第一帧没有参考，整屏刷新
+            lcd_set_index(0, 0, CAM_WIDTH - 1, CAM_HIGH - 1);
+            lcd_write_data(frame->buf, frame->len);
+            stat_cnt++;
+        }
+#endif
+        full_refresh = 0;
+#elif CAM_LCD_BANDS
+        if (cam_lcd_bands_mark(frame, band_shown, band_frames == 0)) {
+            lcd_flush_dirty(frame->buf, CAM_WIDTH);
+            stat_cnt++;
+        }
+        band_frames = (band_frames + 1) % CAM_LCD_BAND_REFRESH;
+#else
+        lcd_set_index(0, 0, CAM_WIDTH - 1, CAM_HIGH - 1);
+        // 帧在后台发送，CPU 可以同时处理统计等工作
+#if CAM_LCD_UPSCALE
+        lcd_write_scaled2x_async(frame->buf, CAP_WIDTH, CAP_HIGH);
+#else
+        lcd_write_data_async(frame->buf, frame->len);
+#endif
+        stat_cnt++;
+#endif
+#if CAM_LCD_QR
+        qr_scan_submit(frame->buf); // 解码任务空闲时才复制亮度，否则跳过这一帧
+#endif
+        // 整帧送屏时记录从采集完成到开始显示的时间，区域刷新不更新
+        if (lcd_get_present_time() >= frame->timestamp) {
+            present_latency = lcd_get_present_time() - frame->timestamp;
+        }
+        // 每秒打印一次显示帧率、采集帧率及丢帧统计
+        if (frame->timestamp - stat_time >= 1000 * 1000) {
+            ESP_LOGI(TAG, "fps: %d, cam fps: %u, latency: %lld us, present: %lld us, dropped: %u, overrun: %u, resync: %u, wake: %u us",
+                     stat_cnt, frame->seq - stat_seq, latency, present_latency, frame->dropped, frame->overrun, frame->resync, cam_get_wake_latency());
+            stat_time = frame->timestamp;
+            stat_seq = frame->seq;
+            stat_cnt = 0;
+        }
+        lcd_wait_done();
+#if CAM_LCD_SCREENSHOT
+        // 有截图请求时截图任务持有一个引用，编码完成后释放
+        cam_frame_ref(frame);
+        if (screenshot_submit(SCREENSHOT_LCD, frame->buf, cam_lcd_screenshot_release, frame) != 1) {
+            cam_frame_unref(frame);
+        }
+#endif
+        cam_give_frame(frame);
+        // 使用逻辑分析仪观察帧率
+        gpio_set_level(LCD_BK, 1);
+        gpio_set_level(LCD_BK, 0);  
+    }
+    vTaskDelete(NULL);
+}
+
+int cam_lcd_start(void)
+{
+#if CAM_LCD_PARAM_CONSOLE
+    param_console_start(CONFIG_ESP_CONSOLE_UART_NUM, 2);
+#endif
+#if CAM_LCD_POWER
+    power_config_t power_config = {
+        .min_mhz = 40,
+        .light_sleep = 1,
+    };
+    power_init(&power_config);
+#endif
+#if CAM_LCD_JOBS
+    jobs_config_t jobs_config = {
+        .task_pri = 6, // 高于送屏任务，帧内的块行尽快完成
+    };
+    jobs_init(&jobs_config);
+#endif
+#if CAM_LCD_SYSMON
+    sysmon_config_t sysmon_config = {
+        .period_ms = 5000,
+        .top = 5,
+        .stall_probe_us = 500,
+    };
+    sysmon_init(&sysmon_config);
+#endif
+    if (xTaskCreate(cam_lcd_task, "cam_lcd_task", 4096, NULL, 5, NULL) != pdPASS) {
+        ESP_LOGE(TAG, "cam_lcd task create error\n");
+        return -1;
+    }
+    return 0;
+}
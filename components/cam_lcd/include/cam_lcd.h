@@ -0,0 +1,13 @@
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Camera to LCD loopback on the ESP32-S2-Kaluga-1, shared by cam_lcd_demo and factory_demo.
+// The pipeline (frame buffers, streaming or benchmark) is selected in menuconfig -> Camera LCD loopback.
+int cam_lcd_start(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,229 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_timer.h"
+#include "esp_log.h"
+#include "cam.h"
+#include "ov2640.h"
+#include "selftest.h"
+
+static const char *TAG = "selftest";
+
+#define SELFTEST_BARS     (8)
+#define SELFTEST_GUARD    (2)   // pixels either side of a bar edge left out, the edges are soft
+#define SELFTEST_WARMUP   (4)   // frames thrown away after the bar is switched on
+#define SELFTEST_SHIFT    (8)   // widest sideways shift told apart from a corrupt row
+#define SELFTEST_MATCH    (90)  // percent of a row the orientation has to match on the first frame
+#define SELFTEST_NONE     (0xFF)
+
+// Bars of the OV2640 from left to right, unmirrored, as RGB565
+static const uint16_t selftest_bar[SELFTEST_BARS] = {
+    0xFFFF, 0xFFE0, 0x07FF, 0x07E0, 0xF81F, 0xF800, 0x001F, 0x0000, // white yellow cyan green magenta red blue black
+};
+
+// The top bit of each channel: bars are saturated, so the class survives gain, gamma and white balance
+static inline uint8_t selftest_class(uint16_t pixel)
+{
+    return ((pixel >> 13) & 0x4) | ((pixel >> 9) & 0x2) | ((pixel >> 4) & 0x1);
+}
+
+static inline uint16_t selftest_pixel(const uint8_t *row, int x)
+{
+    return (row[2 * x] << 8) | row[2 * x + 1];
+}
+
+// Expected class of every column, SELFTEST_NONE on the guard pixels
+static void selftest_map(uint8_t *map, int width, int mirror, int swap)
+{
+    for (int x = 0; x < width; x++) {
+        int bar = x * SELFTEST_BARS / width;
+        int edge = x * SELFTEST_BARS % width;
+        if (edge < SELFTEST_GUARD * SELFTEST_BARS || width - edge <= SELFTEST_GUARD * SELFTEST_BARS) {
+            map[x] = SELFTEST_NONE;
+            continue;
+        }
+        uint16_t pixel = selftest_bar[mirror ? SELFTEST_BARS - 1 - bar : bar];
+        map[x] = selftest_class(swap ? (pixel << 8) | (pixel >> 8) : pixel);
+    }
+}
+
+// Columns that do not match map when the row is moved by shift pixels
+static int selftest_row_errors(const uint8_t *row, const uint8_t *map, int width, int shift)
+{
+    int errors = 0;
+    for (int x = 0; x < width; x++) {
+        int s = x + shift;
+        if (map[x] == SELFTEST_NONE || s < 0 || s >= width) {
+            continue;
+        }
+        errors += selftest_class(selftest_pixel(row, s)) != map[x];
+    }
+    return errors;
+}
+
+static int selftest_row_cleared(const uint8_t *row, int width)
+{
+    for (int x = 0; x < width * 2; x++) {
+        if (row[x]) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+// Pick the orientation from the middle row of the first frame, -1 when no orientation matches
+static int selftest_orient(const uint8_t *frame, uint8_t *map, int width, int high, selftest_result_t *result)
+{
+    const uint8_t *row = frame + (high / 2) * width * 2;
+    int best = -1, best_errors = width;
+    for (int i = 0; i < 4; i++) {
+        selftest_map(map, width, i & 1, i >> 1);
+        int errors = selftest_row_errors(row, map, width, 0);
+        if (errors < best_errors) {
+            best = i;
+            best_errors = errors;
+        }
+    }
+    if (best < 0 || best_errors * 100 > width * (100 - SELFTEST_MATCH)) {
+        printf("SELFTEST no color bar found, middle row classes:");
+        for (int b = 0; b < SELFTEST_BARS; b++) {
+            printf(" %u", selftest_class(selftest_pixel(row, b * width / SELFTEST_BARS + width / SELFTEST_BARS / 2)));
+        }
+        printf("\n");
+        return -1;
+    }
+    result->mirrored = best & 1;
+    result->swapped = best >> 1;
+    selftest_map(map, width, result->mirrored, 0);
+    return result->swapped ? -1 : 0;
+}
+
+// Sort every row into good, lost, shifted or corrupt. 1 when the frame has a bad row
+static int selftest_check(const cam_frame_t *frame, const uint8_t *map, int width, int high, selftest_result_t *result)
+{
+    int tolerance = width / 64;
+    int bad = 0;
+    for (int y = 0; y < high; y++) {
+        const uint8_t *row = frame->buf + y * width * 2;
+        if (selftest_row_errors(row, map, width, 0) <= tolerance) {
+            continue;
+        }
+        if (!bad) {
+            ESP_LOGW(TAG, "frame %u: first bad row %d", frame->seq, y);
+        }
+        bad = 1;
+        if (selftest_row_cleared(row, width)) {
+            result->lost_rows++;
+            continue;
+        }
+        int shifted = 0;
+        for (int s = 1; s <= SELFTEST_SHIFT && !shifted; s++) {
+            shifted = selftest_row_errors(row, map, width, s) <= tolerance || selftest_row_errors(row, map, width, -s) <= tolerance;
+        }
+        if (shifted) {
+            result->shifted_rows++;
+        } else {
+            result->corrupt_rows++;
+        }
+    }
+    return bad;
+}
+
+static int selftest_cmp(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+    return x < y ? -1 : x > y;
+}
+
+static void selftest_latency(uint32_t *latency, int cnt, selftest_result_t *result)
+{
+    uint64_t sum = 0;
+    qsort(latency, cnt, sizeof(uint32_t), selftest_cmp);
+    for (int i = 0; i < cnt; i++) {
+        sum += latency[i];
+    }
+    result->latency_min = latency[0];
+    result->latency_max = latency[cnt - 1];
+    result->latency_avg = sum / cnt;
+    result->latency_p99 = latency[cnt - 1 - cnt / 100];
+}
+
+int selftest_run(const selftest_config_t *config, selftest_result_t *result)
+{
+    int width = config->width, high = config->high;
+    size_t frame_len = (size_t)width * high * 2;
+    memset(result, 0, sizeof(selftest_result_t));
+    if (config->frames == 0 || width < SELFTEST_BARS * SELFTEST_GUARD * 4) {
+        ESP_LOGE(TAG, "%d frames of %d pixels can not be checked\n", config->frames, width);
+        return -1;
+    }
+    uint8_t *map = malloc(width);
+    uint32_t *latency = malloc(config->frames * sizeof(uint32_t));
+    if (!map || !latency) {
+        ESP_LOGE(TAG, "no memory\n");
+        free(map);
+        free(latency);
+        return -1;
+    }
+
+    OV2640_Color_Bar(1);
+    for (int i = 0; i < SELFTEST_WARMUP; i++) {
+        cam_give_frame(cam_take_frame());
+    }
+    int ret = 0;
+    cam_frame_t first = {0}, last = {0};
+    int64_t start = esp_timer_get_time();
+    for (int i = 0; i < config->frames; i++) {
+        cam_frame_t *frame = cam_take_frame();
+        int64_t now = esp_timer_get_time();
+        latency[i] = now - frame->timestamp;
+        if (i == 0) {
+            first = *frame;
+        }
+        last = *frame;
+        result->frames++;
+        if (frame->len != frame_len) {
+            result->short_frames++;
+            result->bad_frames++;
+        } else if (i == 0 && selftest_orient(frame->buf, map, width, high, result) != 0) {
+            result->bad_frames++;
+            ret = -1;
+            cam_give_frame(frame);
+            break;
+        } else {
+            result->bad_frames += selftest_check(frame, map, width, high, result);
+        }
+        if (config->poison) {
+            memset(frame->buf, 0, frame_len);
+        }
+        cam_give_frame(frame);
+    }
+    int64_t elapsed = esp_timer_get_time() - start;
+    OV2640_Color_Bar(0);
+
+    result->dropped = last.dropped - first.dropped;
+    result->overrun = last.overrun - first.overrun;
+    result->resync = last.resync - first.resync;
+    if (last.timestamp > first.timestamp) {
+        result->sensor_fps = (last.seq - first.seq) * 1000000.0f / (last.timestamp - first.timestamp);
+    }
+    result->fps = elapsed > 0 ? result->frames * 1000000.0f / elapsed : 0;
+    selftest_latency(latency, result->frames, result);
+    free(latency);
+    free(map);
+
+    if (result->bad_frames || result->overrun || result->resync) {
+        ret = -1;
+    }
+    if (config->min_fps && result->sensor_fps < config->min_fps) {
+        ret = -1;
+    }
+    printf("SELFTEST %s frames: %u bad: %u rows lost: %u shifted: %u corrupt: %u short frames: %u%s%s\n",
+           ret ? "FAIL" : "PASS", result->frames, result->bad_frames, result->lost_rows, result->shifted_rows,
+           result->corrupt_rows, result->short_frames, result->swapped ? " byte swapped" : "", result->mirrored ? " mirrored" : "");
+    printf("SELFTEST sensor fps: %.1f (min %u) checked fps: %.1f dropped: %u overrun: %u resync: %u\n",
+           result->sensor_fps, config->min_fps, result->fps, result->dropped, result->overrun, result->resync);
+    printf("SELFTEST latency min: %u avg: %u p99: %u max: %u us\n",
+           result->latency_min, result->latency_avg, result->latency_p99, result->latency_max);
+    return ret;
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    uint16_t width;          // frame size of cam_init, RGB565 big-endian as the sensor sends it
+    uint16_t high;
+    uint16_t frames;         // frames checked after the warm-up
+    uint16_t min_fps;        // sensor frame rate below this fails, 0: not checked
+    uint8_t poison;          // copy mode: clear each frame before giving it back, so a half buffer cam_task
+                             // never wrote shows up. Never in zero copy mode, the DMA writes behind the cache
+} selftest_config_t;
+
+typedef struct {
+    uint32_t frames;         // frames checked
+    uint32_t bad_frames;     // frames with at least one bad row
+    uint32_t lost_rows;      // rows still cleared: a half buffer lost on the way
+    uint32_t shifted_rows;   // rows with the bars moved sideways: a torn or misaligned frame
+    uint32_t corrupt_rows;   // rows that match the bars nowhere
+    uint32_t short_frames;   // len is not a whole frame
+    uint8_t swapped;         // the bars come out with the bytes of each pixel swapped
+    uint8_t mirrored;        // the bars run right to left, follows the sensor mirror setting
+    uint32_t dropped;        // driver counters over the test
+    uint32_t overrun;
+    uint32_t resync;
+    float sensor_fps;        // frames through the DMA per second, from seq and timestamp
+    float fps;               // frames taken and checked per second
+    uint32_t latency_min;    // capture done to cam_take_frame, us
+    uint32_t latency_avg;
+    uint32_t latency_p99;
+    uint32_t latency_max;
+} selftest_result_t;
+
+// Switch the OV2640 to its color bar, check config->frames frames of the running capture against it and
+// switch it off again. Every row of every frame is compared with the 8 bars and the timing of each take
+// is kept. The bars are laid over the image, point the camera at something dark or cover the lens.
+// Prints SELFTEST lines and fills result. 0 when everything matched and the frame rate was reached, -1 otherwise
+int selftest_run(const selftest_config_t *config, selftest_result_t *result);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,203 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_http_client.h"
+#include "cam.h"
+#include "cam_upload.h"
+
+static const char *TAG = "cam_upload";
+
+typedef struct {
+    uint8_t *buf;
+    size_t len;
+    int64_t time; // queued, latency counts from here
+} cam_upload_job_t;
+
+typedef struct {
+    esp_http_client_handle_t client;
+    uint8_t close;   // the server answered with Connection: close
+} cam_upload_worker_t;
+
+typedef struct {
+    cam_upload_config_t config;
+    QueueHandle_t queue;
+    cam_upload_worker_t *worker;
+    uint32_t ok;
+    uint32_t failed;
+    uint32_t max_latency_ms;
+} cam_upload_obj_t;
+
+static cam_upload_obj_t *cam_upload_obj = NULL;
+
+static esp_err_t cam_upload_event(esp_http_client_event_t *evt)
+{
+    cam_upload_worker_t *worker = (cam_upload_worker_t *)evt->user_data;
+    if (evt->event_id == HTTP_EVENT_ON_HEADER && !strcasecmp(evt->header_key, "Connection") &&
+        !strcasecmp(evt->header_value, "close")) {
+        worker->close = 1;
+    }
+    return ESP_OK;
+}
+
+static int cam_upload_write(esp_http_client_handle_t client, const char *data, int len)
+{
+    while (len > 0) {
+        int ret = esp_http_client_write(client, data, len);
+        if (ret <= 0) {
+            return -1;
+        }
+        data += ret;
+        len -= ret;
+    }
+    return 0;
+}
+
+// One POST on the worker's connection, esp_http_client_open only connects when it is not connected already
+static int cam_upload_post(cam_upload_worker_t *worker, const uint8_t *buf, size_t len)
+{
+    char head[16];
+    worker->close = 0;
+    if (esp_http_client_open(worker->client, -1) != ESP_OK) { // -1: Transfer-Encoding: chunked
+        return -1;
+    }
+    for (size_t offset = 0; offset < len; offset += cam_upload_obj->config.chunk_size) {
+        size_t n = len - offset < cam_upload_obj->config.chunk_size ? len - offset : cam_upload_obj->config.chunk_size;
+        int head_len = snprintf(head, sizeof(head), "%x\r\n", n);
+        // 数据直接从帧 buffer 交给 socket，不经过 client 的 buffer
+        if (cam_upload_write(worker->client, head, head_len) != 0 ||
+            cam_upload_write(worker->client, (const char *)buf + offset, n) != 0 ||
+            cam_upload_write(worker->client, "\r\n", 2) != 0) {
+            return -1;
+        }
+    }
+    if (cam_upload_write(worker->client, "0\r\n\r\n", 5) != 0 || esp_http_client_fetch_headers(worker->client) < 0) {
+        return -1;
+    }
+    int status = esp_http_client_get_status_code(worker->client);
+    // read the rest of the answer so the next request starts on a clean stream
+    while (esp_http_client_read(worker->client, head, sizeof(head)) > 0);
+    if (worker->close) {
+        esp_http_client_close(worker->client);
+    }
+    return status;
+}
+
+static void cam_upload_task(void *arg)
+{
+    cam_upload_worker_t *worker = (cam_upload_worker_t *)arg;
+    cam_upload_job_t job;
+    while (1) {
+        xQueueReceive(cam_upload_obj->queue, &job, portMAX_DELAY);
+        int status = -1;
+        for (int i = 0; i <= cam_upload_obj->config.retry; i++) {
+            if (i) {
+                vTaskDelay(cam_upload_obj->config.retry_delay_ms / portTICK_PERIOD_MS);
+            }
+            status = cam_upload_post(worker, job.buf, job.len);
+            if (status >= 200 && status < 300) {
+                break;
+            }
+            // 连接可能已经断了，下次重新连接
+            esp_http_client_close(worker->client);
+            if (status >= 400 && status < 500) {
+                break; // the request itself is wrong, sending it again will not help
+            }
+        }
+        cam_give(job.buf);
+        uint32_t latency_ms = (esp_timer_get_time() - job.time) / 1000;
+        if (status >= 200 && status < 300) {
+            cam_upload_obj->ok++;
+        } else {
+            cam_upload_obj->failed++;
+            ESP_LOGW(TAG, "upload failed, status: %d\n", status);
+        }
+        if (latency_ms > cam_upload_obj->max_latency_ms) {
+            cam_upload_obj->max_latency_ms = latency_ms;
+        }
+        if (cam_upload_obj->config.done_cb) {
+            cam_upload_obj->config.done_cb(status, latency_ms, cam_upload_obj->config.done_arg);
+        }
+    }
+}
+
+int cam_upload(uint8_t *buffer)
+{
+    if (!cam_upload_obj) {
+        return -1;
+    }
+    cam_upload_job_t job = {
+        .buf = buffer,
+        .len = cam_get_frame_len(buffer),
+        .time = esp_timer_get_time(),
+    };
+    return xQueueSend(cam_upload_obj->queue, &job, 0) == pdTRUE ? 0 : -1;
+}
+
+void cam_upload_get_stats(uint32_t *ok, uint32_t *failed, uint32_t *max_latency_ms)
+{
+    *ok = cam_upload_obj ? cam_upload_obj->ok : 0;
+    *failed = cam_upload_obj ? cam_upload_obj->failed : 0;
+    *max_latency_ms = cam_upload_obj ? cam_upload_obj->max_latency_ms : 0;
+}
+
+int cam_upload_init(const cam_upload_config_t *config)
+{
+    if (cam_upload_obj || !config->url) {
+        ESP_LOGE(TAG, "cam upload busy or config error\n");
+        return -1;
+    }
+    cam_upload_obj = (cam_upload_obj_t *)calloc(1, sizeof(cam_upload_obj_t));
+    if (!cam_upload_obj) {
+        ESP_LOGE(TAG, "cam upload object malloc error\n");
+        return -1;
+    }
+    cam_upload_obj->config = *config;
+    cam_upload_obj->config.url = NULL;
+    cam_upload_obj->config.content_type = config->content_type ? config->content_type : "image/jpeg";
+    cam_upload_obj->config.workers = config->workers ? config->workers : 1;
+    cam_upload_obj->config.queue_len = config->queue_len ? config->queue_len : cam_upload_obj->config.workers;
+    cam_upload_obj->config.retry_delay_ms = config->retry_delay_ms ? config->retry_delay_ms : 500;
+    cam_upload_obj->config.timeout_ms = config->timeout_ms ? config->timeout_ms : 5000;
+    cam_upload_obj->config.chunk_size = config->chunk_size ? config->chunk_size : 16 * 1024;
+    cam_upload_obj->queue = xQueueCreate(cam_upload_obj->config.queue_len, sizeof(cam_upload_job_t));
+    if (!cam_upload_obj->queue) {
+        ESP_LOGE(TAG, "cam upload queue create error\n");
+        free(cam_upload_obj);
+        cam_upload_obj = NULL;
+        return -1;
+    }
+    cam_upload_obj->worker = (cam_upload_worker_t *)calloc(cam_upload_obj->config.workers, sizeof(cam_upload_worker_t));
+    if (!cam_upload_obj->worker) {
+        ESP_LOGE(TAG, "cam upload worker malloc error\n");
+        return -1;
+    }
+    for (int i = 0; i < cam_upload_obj->config.workers; i++) {
+        cam_upload_worker_t *worker = &cam_upload_obj->worker[i];
+        // client 会复制 url 和 header，调用者的字符串不需要一直有效
+        esp_http_client_config_t http_config = {
+            .url = config->url,
+            .method = HTTP_METHOD_POST,
+            .timeout_ms = cam_upload_obj->config.timeout_ms,
+            .event_handler = cam_upload_event,
+            .user_data = worker,
+        };
+        worker->client = esp_http_client_init(&http_config);
+        if (!worker->client) {
+            ESP_LOGE(TAG, "http client init error\n");
+            return -1;
+        }
+        esp_http_client_set_header(worker->client, "Content-Type", cam_upload_obj->config.content_type);
+        if (xTaskCreate(cam_upload_task, "cam_upload", 1024 * 4, worker, config->task_pri, NULL) != pdPASS) {
+            ESP_LOGE(TAG, "cam upload task create error\n");
+            return -1;
+        }
+    }
+    ESP_LOGI(TAG, "uploading to %s, workers: %d\n", config->url, cam_upload_obj->config.workers);
+    return 0;
+}
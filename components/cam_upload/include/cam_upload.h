@@ -0,0 +1,42 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// POST jpeg frames from cam_take() to an HTTP server. The body goes out in chunked transfer encoding straight
+// from the frame buffer, the frame is given back with cam_give once the server answered or the last retry
+// failed. Every worker keeps its own keep-alive connection, so workers is the number of uploads in flight
+
+// Called by the worker after the frame went back to the camera, status: HTTP status, -1: no answer
+typedef void (*cam_upload_done_cb_t)(int status, uint32_t latency_ms, void *arg);
+
+typedef struct {
+    const char *url;
+    const char *content_type;   // NULL: image/jpeg
+    uint8_t workers;            // connections, 0: 1
+    uint8_t queue_len;          // frames waiting for a worker, 0: workers
+    uint8_t retry;              // attempts after the first one
+    uint32_t retry_delay_ms;    // 0: 500
+    uint32_t timeout_ms;        // network timeout, 0: 5000
+    uint32_t chunk_size;        // body bytes per chunk, 0: 16 KB
+    uint8_t task_pri;
+    cam_upload_done_cb_t done_cb; // optional
+    void *done_arg;
+} cam_upload_config_t;
+
+// Queue a frame from cam_take, its size comes from cam_get_frame_len.
+// Returns -1 when the queue is full, the caller still owns the frame then
+int cam_upload(uint8_t *buffer);
+
+// Uploads answered with 2xx, uploads given up, and the slowest one since cam_upload_init in ms
+void cam_upload_get_stats(uint32_t *ok, uint32_t *failed, uint32_t *max_latency_ms);
+
+int cam_upload_init(const cam_upload_config_t *config);
+
+#ifdef __cplusplus
+}
+#endif
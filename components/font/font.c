@@ -0,0 +1,477 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_partition.h"
+#include "esp_spi_flash.h"
+#include "lcd.h"
+#include "font.h"
+
+static const char *TAG = "font";
+
+#define FONT_ASCII_FIRST  0x20
+#define FONT_ASCII_CNT    (0x7F - FONT_ASCII_FIRST)
+#define FONT_NONE         (-1)
+
+typedef struct {
+    uint32_t code;
+    uint16_t font;
+    uint16_t color;      // RGB565 boxes, 0 for alpha
+    int32_t bg;          // FONT_BG_NONE: 4 bit alpha, else the color the box was blended against
+    void *pixels;
+    uint32_t size;
+    int16_t prev;        // LRU list, head is the most recent
+    int16_t next;
+    int16_t hash_next;
+} font_cache_t;
+
+typedef struct {
+    spi_flash_mmap_handle_t mmap;
+    const uint8_t *base;
+    uint32_t size;
+    uint32_t count;
+    const font_entry_t *entry;
+    int32_t *ascii;      // count * FONT_ASCII_CNT glyph indexes, printable ASCII skips the search
+    uint32_t cache_size;
+    uint32_t cache_used;
+    uint16_t max_glyphs;
+    uint32_t caps;
+    uint8_t mark_dirty;
+    font_cache_t *cache;
+    int16_t *bucket;     // hash chains
+    uint32_t bucket_mask;
+    int16_t head;
+    int16_t tail;
+    int16_t free;        // unused entries, chained by next
+    uint32_t hits;
+    uint32_t misses;
+    SemaphoreHandle_t lock;
+} font_obj_t;
+
+static font_obj_t *font_obj = NULL;
+
+// Next code point of a UTF-8 string, 0 at the end, U+FFFD for a broken sequence
+static uint32_t font_utf8_next(const char **text)
+{
+    const uint8_t *s = (const uint8_t *)*text;
+    uint32_t code = s[0];
+    int len = 0;
+    if (code == 0) {
+        return 0;
+    }
+    if (code < 0x80) {
+        *text += 1;
+        return code;
+    }
+    if ((code & 0xE0) == 0xC0) {
+        code &= 0x1F;
+        len = 1;
+    } else if ((code & 0xF0) == 0xE0) {
+        code &= 0x0F;
+        len = 2;
+    } else if ((code & 0xF8) == 0xF0) {
+        code &= 0x07;
+        len = 3;
+    } else {
+        *text += 1;
+        return 0xFFFD;
+    }
+    for (int i = 1; i <= len; i++) {
+        if ((s[i] & 0xC0) != 0x80) {
+            *text += i; // stop at the byte that broke it, it may start the next character
+            return 0xFFFD;
+        }
+        code = (code << 6) | (s[i] & 0x3F);
+    }
+    *text += len + 1;
+    return code;
+}
+
+static int32_t font_search(int font, uint32_t code)
+{
+    const font_entry_t *entry = &font_obj->entry[font];
+    const font_glyph_t *table = (const font_glyph_t *)(font_obj->base + entry->offset);
+    int32_t lo = 0, hi = (int32_t)entry->glyphs - 1;
+    while (lo <= hi) {
+        int32_t mid = (lo + hi) / 2;
+        if (table[mid].code == code) {
+            return mid;
+        }
+        if (table[mid].code < code) {
+            lo = mid + 1;
+        } else {
+            hi = mid - 1;
+        }
+    }
+    return FONT_NONE;
+}
+
+// Glyph of code, U+FFFD or '?' when the font does not have it
+static const font_glyph_t *font_glyph(int font, uint32_t code)
+{
+    const font_glyph_t *table = (const font_glyph_t *)(font_obj->base + font_obj->entry[font].offset);
+    int32_t index;
+    if (code >= FONT_ASCII_FIRST && code < FONT_ASCII_FIRST + FONT_ASCII_CNT) {
+        index = font_obj->ascii[font * FONT_ASCII_CNT + code - FONT_ASCII_FIRST];
+    } else {
+        index = font_search(font, code);
+        if (index == FONT_NONE) {
+            index = font_search(font, 0xFFFD);
+        }
+    }
+    if (index == FONT_NONE) {
+        index = font_obj->ascii[font * FONT_ASCII_CNT + '?' - FONT_ASCII_FIRST];
+    }
+    return index == FONT_NONE ? NULL : &table[index];
+}
+
+static uint32_t font_hash(uint32_t code, int font, uint16_t color, int32_t bg)
+{
+    return ((code * 2654435761u) ^ (font << 24) ^ (color * 40503u) ^ ((uint32_t)bg * 9973u)) & font_obj->bucket_mask;
+}
+
+static void font_lru_unlink(int16_t i)
+{
+    font_cache_t *e = &font_obj->cache[i];
+    if (e->prev != FONT_NONE) {
+        font_obj->cache[e->prev].next = e->next;
+    } else {
+        font_obj->head = e->next;
+    }
+    if (e->next != FONT_NONE) {
+        font_obj->cache[e->next].prev = e->prev;
+    } else {
+        font_obj->tail = e->prev;
+    }
+}
+
+static void font_lru_push(int16_t i)
+{
+    font_cache_t *e = &font_obj->cache[i];
+    e->prev = FONT_NONE;
+    e->next = font_obj->head;
+    if (font_obj->head != FONT_NONE) {
+        font_obj->cache[font_obj->head].prev = i;
+    } else {
+        font_obj->tail = i;
+    }
+    font_obj->head = i;
+}
+
+// Drop the least recently used glyph, 0 when the cache is empty
+static int font_evict(void)
+{
+    int16_t i = font_obj->tail;
+    if (i == FONT_NONE) {
+        return 0;
+    }
+    font_cache_t *e = &font_obj->cache[i];
+    int16_t *link = &font_obj->bucket[font_hash(e->code, e->font, e->color, e->bg)];
+    while (*link != i) {
+        link = &font_obj->cache[*link].hash_next;
+    }
+    *link = e->hash_next;
+    font_lru_unlink(i);
+    free(e->pixels);
+    e->pixels = NULL;
+    font_obj->cache_used -= e->size;
+    e->next = font_obj->free;
+    font_obj->free = i;
+    return 1;
+}
+
+static void *font_malloc(uint32_t size)
+{
+    void *p = heap_caps_malloc(size, font_obj->caps);
+    return p ? p : heap_caps_malloc(size, MALLOC_CAP_DEFAULT);
+}
+
+// Cached pixels of a glyph, rasterized from the partition on a miss
+static font_cache_t *font_cache_get(int font, const font_glyph_t *glyph, uint16_t color, int32_t bg)
+{
+    if (bg == FONT_BG_NONE) {
+        color = 0; // alpha does not depend on the color
+    }
+    uint32_t hash = font_hash(glyph->code, font, color, bg);
+    for (int16_t i = font_obj->bucket[hash]; i != FONT_NONE; i = font_obj->cache[i].hash_next) {
+        font_cache_t *e = &font_obj->cache[i];
+        if (e->code == glyph->code && e->font == font && e->color == color && e->bg == bg) {
+            font_obj->hits++;
+            font_lru_unlink(i);
+            font_lru_push(i);
+            return e;
+        }
+    }
+    font_obj->misses++;
+    int stride = (glyph->width + 1) / 2;
+    uint32_t size = bg == FONT_BG_NONE ? stride * glyph->height : glyph->width * glyph->height * sizeof(uint16_t);
+    if (size > font_obj->cache_size) {
+        return NULL;
+    }
+    while (font_obj->free == FONT_NONE || font_obj->cache_used + size > font_obj->cache_size) {
+        if (!font_evict()) {
+            return NULL;
+        }
+    }
+    void *pixels = font_malloc(size);
+    if (pixels == NULL) {
+        return NULL;
+    }
+    const uint8_t *bitmap = font_obj->base + glyph->offset;
+    if (bg == FONT_BG_NONE) {
+        memcpy(pixels, bitmap, size);
+    } else {
+        // blend once against the background, drawing the glyph again is a copy
+        pixel_surface_t box = {(uint16_t *)pixels, glyph->width, glyph->height, 0};
+        pixel_mask_t mask = {bitmap, 4, stride, glyph->width, glyph->height};
+        pixel_fill(&box, NULL, bg);
+        pixel_blend(&box, 0, 0, NULL, &mask, color);
+    }
+    int16_t i = font_obj->free;
+    font_cache_t *e = &font_obj->cache[i];
+    font_obj->free = e->next;
+    e->code = glyph->code;
+    e->font = font;
+    e->color = color;
+    e->bg = bg;
+    e->pixels = pixels;
+    e->size = size;
+    e->hash_next = font_obj->bucket[hash];
+    font_obj->bucket[hash] = i;
+    font_lru_push(i);
+    font_obj->cache_used += size;
+    return e;
+}
+
+static void font_draw_glyph(int font, const pixel_surface_t *dst, int gx, int gy, const font_glyph_t *glyph, uint16_t color, int32_t bg)
+{
+    font_cache_t *e = font_cache_get(font, glyph, color, bg);
+    pixel_mask_t mask = {font_obj->base + glyph->offset, 4, (glyph->width + 1) / 2, glyph->width, glyph->height};
+    if (e == NULL) {
+        pixel_blend(dst, gx, gy, NULL, &mask, color); // no room in the cache, blend straight from flash
+        return;
+    }
+    if (bg == FONT_BG_NONE) {
+        mask.data = (const uint8_t *)e->pixels;
+        pixel_blend(dst, gx, gy, NULL, &mask, color);
+    } else {
+        pixel_surface_t box = {(uint16_t *)e->pixels, glyph->width, glyph->height, 0};
+        pixel_blit(dst, gx, gy, &box, NULL);
+    }
+}
+
+int font_find(const char *name)
+{
+    if (font_obj == NULL) {
+        return -1;
+    }
+    for (int i = 0; i < font_obj->count; i++) {
+        if (strncmp(font_obj->entry[i].name, name, FONT_NAME_LEN) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+int font_get_line_height(int font)
+{
+    if (font_obj == NULL || font < 0 || font >= font_obj->count) {
+        return -1;
+    }
+    return font_obj->entry[font].line_height;
+}
+
+int font_measure(int font, const char *text, int *width, int *height)
+{
+    if (font_obj == NULL || font < 0 || font >= font_obj->count) {
+        return -1;
+    }
+    int w = 0, line_w = 0, lines = 1;
+    uint32_t code;
+    while ((code = font_utf8_next(&text)) != 0) {
+        if (code == '\n') {
+            lines++;
+            line_w = 0;
+            continue;
+        }
+        const font_glyph_t *glyph = font_glyph(font, code);
+        if (glyph) {
+            line_w += glyph->advance;
+            w = line_w > w ? line_w : w;
+        }
+    }
+    *width = w;
+    *height = lines * font_obj->entry[font].line_height;
+    return 0;
+}
+
+int font_draw(int font, const pixel_surface_t *dst, int y0, int x, int y, const char *text, uint16_t color, int32_t bg,
+              pixel_rect_t *bounds)
+{
+    if (font_obj == NULL || font < 0 || font >= font_obj->count || dst == NULL || text == NULL) {
+        return -1;
+    }
+    int line_height = font_obj->entry[font].line_height;
+    int pen_x = x, line_y = y - y0; // stripe coordinates from here on
+    int width = 0, lines = 1;
+    uint32_t code;
+    xSemaphoreTake(font_obj->lock, portMAX_DELAY);
+    while ((code = font_utf8_next(&text)) != 0) {
+        if (code == '\n') {
+            pen_x = x;
+            line_y += line_height;
+            lines++;
+            continue;
+        }
+        const font_glyph_t *glyph = font_glyph(font, code);
+        if (glyph == NULL) {
+            continue;
+        }
+        // cell and box together, only the glyphs that reach into the stripe cost a cache lookup
+        int left = pen_x + (glyph->x_off < 0 ? glyph->x_off : 0);
+        int right = pen_x + (glyph->x_off + glyph->width > glyph->advance ? glyph->x_off + glyph->width : glyph->advance);
+        int top = line_y + (glyph->y_off < 0 ? glyph->y_off : 0);
+        int bottom = line_y + (glyph->y_off + glyph->height > line_height ? glyph->y_off + glyph->height : line_height);
+        if (bottom > 0 && top < dst->high && right > 0 && left < dst->width) {
+            if (bg != FONT_BG_NONE) {
+                pixel_rect_t cell = {pen_x, line_y, glyph->advance, line_height};
+                pixel_fill(dst, &cell, bg);
+            }
+            if (glyph->width && glyph->height) {
+                font_draw_glyph(font, dst, pen_x + glyph->x_off, line_y + glyph->y_off, glyph, color, bg);
+            }
+        }
+        pen_x += glyph->advance;
+        width = pen_x - x > width ? pen_x - x : width;
+    }
+    xSemaphoreGive(font_obj->lock);
+    pixel_rect_t area = {x, y, width, lines * line_height};
+    if (font_obj->mark_dirty) {
+        int x0 = area.x < 0 ? 0 : area.x, y1 = area.y < 0 ? 0 : area.y;
+        if (area.x + area.width > x0 && area.y + area.high > y1) {
+            lcd_mark_dirty(x0, y1, area.x + area.width - 1, area.y + area.high - 1);
+        }
+    }
+    if (bounds) {
+        *bounds = area;
+    }
+    return 0;
+}
+
+void font_flush(void)
+{
+    if (font_obj == NULL) {
+        return;
+    }
+    xSemaphoreTake(font_obj->lock, portMAX_DELAY);
+    while (font_evict());
+    xSemaphoreGive(font_obj->lock);
+}
+
+void font_get_stats(uint32_t *hits, uint32_t *misses)
+{
+    *hits = font_obj ? font_obj->hits : 0;
+    *misses = font_obj ? font_obj->misses : 0;
+}
+
+void font_deinit(void)
+{
+    if (font_obj == NULL) {
+        return;
+    }
+    if (font_obj->cache) {
+        for (int i = 0; i < font_obj->max_glyphs; i++) {
+            free(font_obj->cache[i].pixels);
+        }
+        free(font_obj->cache);
+    }
+    free(font_obj->bucket);
+    free(font_obj->ascii);
+    if (font_obj->base) {
+        spi_flash_munmap(font_obj->mmap);
+    }
+    if (font_obj->lock) {
+        vSemaphoreDelete(font_obj->lock);
+    }
+    free(font_obj);
+    font_obj = NULL;
+}
+
+int font_init(const font_config_t *config)
+{
+    const char *label = config->partition ? config->partition : "font";
+    const esp_partition_t *part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label);
+    if (part == NULL) {
+        ESP_LOGE(TAG, "partition %s not found\n", label);
+        return -1;
+    }
+    font_obj = (font_obj_t *)calloc(1, sizeof(font_obj_t));
+    if (font_obj == NULL) {
+        ESP_LOGE(TAG, "font object malloc error\n");
+        return -1;
+    }
+    font_obj->cache_size = config->cache_size ? config->cache_size : 64 * 1024;
+    font_obj->max_glyphs = config->max_glyphs ? config->max_glyphs : 512;
+    font_obj->caps = config->caps ? config->caps : MALLOC_CAP_SPIRAM;
+    font_obj->mark_dirty = config->mark_dirty;
+    font_obj->size = part->size;
+    if (font_obj->max_glyphs > INT16_MAX) {
+        font_obj->max_glyphs = INT16_MAX;
+    }
+    if (esp_partition_mmap(part, 0, part->size, SPI_FLASH_MMAP_DATA, (const void **)&font_obj->base, &font_obj->mmap) != ESP_OK) {
+        ESP_LOGE(TAG, "partition %s mmap error\n", label);
+        font_obj->base = NULL;
+        goto err;
+    }
+    const font_header_t *header = (const font_header_t *)font_obj->base;
+    // count is bounded before it is multiplied, a corrupt one must not wrap the index size past the check
+    if (font_obj->size < sizeof(font_header_t) || header->magic != FONT_MAGIC ||
+        header->count > (font_obj->size - sizeof(font_header_t)) / sizeof(font_entry_t)) {
+        ESP_LOGE(TAG, "partition %s holds no font index\n", label);
+        goto err;
+    }
+    font_obj->count = header->count;
+    font_obj->entry = (const font_entry_t *)(header + 1);
+    for (int i = 0; i < font_obj->count; i++) {
+        const font_entry_t *entry = &font_obj->entry[i];
+        if (entry->offset > font_obj->size || entry->glyphs > (font_obj->size - entry->offset) / sizeof(font_glyph_t)) {
+            ESP_LOGE(TAG, "font %d out of the partition\n", i);
+            goto err;
+        }
+    }
+    font_obj->ascii = (int32_t *)malloc(font_obj->count * FONT_ASCII_CNT * sizeof(int32_t));
+    uint32_t buckets = 1;
+    while (buckets < font_obj->max_glyphs) {
+        buckets <<= 1;
+    }
+    font_obj->bucket_mask = buckets - 1;
+    font_obj->bucket = (int16_t *)malloc(buckets * sizeof(int16_t));
+    font_obj->cache = (font_cache_t *)calloc(font_obj->max_glyphs, sizeof(font_cache_t));
+    font_obj->lock = xSemaphoreCreateMutex();
+    if (font_obj->ascii == NULL || font_obj->bucket == NULL || font_obj->cache == NULL || font_obj->lock == NULL) {
+        ESP_LOGE(TAG, "font cache malloc error\n");
+        goto err;
+    }
+    for (int i = 0; i < font_obj->count; i++) {
+        for (int c = 0; c < FONT_ASCII_CNT; c++) {
+            font_obj->ascii[i * FONT_ASCII_CNT + c] = font_search(i, FONT_ASCII_FIRST + c);
+        }
+    }
+    for (int i = 0; i < buckets; i++) {
+        font_obj->bucket[i] = FONT_NONE;
+    }
+    for (int i = 0; i < font_obj->max_glyphs; i++) {
+        font_obj->cache[i].next = i + 1 < font_obj->max_glyphs ? i + 1 : FONT_NONE;
+    }
+    font_obj->free = 0;
+    font_obj->head = font_obj->tail = FONT_NONE;
+    ESP_LOGI(TAG, "%d fonts, cache %d glyphs in %d bytes\n", font_obj->count, font_obj->max_glyphs, font_obj->cache_size);
+    return 0;
+
+err:
+    font_deinit();
+    return -1;
+}
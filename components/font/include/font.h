@@ -0,0 +1,81 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "pixel_blit.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Anti-aliased text from pre-rasterized 4 bit alpha glyphs in a flash partition, built on the host with mkfont.py
+// (any TTF/OTF, CJK subsets from a text file). The partition is memory mapped, glyphs in use are kept in a bounded
+// LRU cache in PSRAM: as 4 bit alpha when text is blended over what is drawn already, as RGB565 boxes blended once
+// against the background when text is drawn on a solid color, so a repeated string costs a line copy per glyph row.
+
+#define FONT_MAGIC     0x30544E46 // "FNT0"
+#define FONT_NAME_LEN  24
+
+// Partition layout, little endian: font_header_t, count font_entry_t, then per font its glyph table and bitmaps
+typedef struct {
+    uint32_t magic;
+    uint32_t count;
+} __attribute__((packed)) font_header_t;
+
+typedef struct {
+    char name[FONT_NAME_LEN];   // zero padded
+    uint32_t offset;            // glyph table from the start of the partition, font_glyph_t sorted by code
+    uint32_t glyphs;
+    uint16_t line_height;
+    uint16_t ascent;            // baseline below the line top
+} __attribute__((packed)) font_entry_t;
+
+typedef struct {
+    uint32_t code;              // unicode code point
+    uint32_t offset;            // bitmap from the start of the partition, rows of (width + 1) / 2 bytes, left pixel high
+    uint8_t width;
+    uint8_t height;
+    int8_t x_off;               // box left from the pen position
+    int8_t y_off;               // box top from the line top
+    uint8_t advance;
+    uint8_t reserved[3];
+} __attribute__((packed)) font_glyph_t;
+
+typedef struct {
+    const char *partition;      // data partition label, NULL: "font"
+    uint32_t cache_size;        // bytes of cached glyphs, 0: 64 KB
+    uint16_t max_glyphs;        // cached glyphs, 0: 512
+    uint32_t caps;              // heap caps of the glyphs, 0: MALLOC_CAP_SPIRAM, falls back to the default heap
+    uint8_t mark_dirty;         // 1: font_draw marks what it drew with lcd_mark_dirty
+} font_config_t;
+
+#define FONT_BG_NONE  (-1)      // font_draw bg: blend over the pixels in dst
+
+int font_init(const font_config_t *config);
+
+void font_deinit(void);
+
+// Font index by name, -1: not found
+int font_find(const char *name);
+
+int font_get_line_height(int font);
+
+// Width of the widest line and height of the UTF-8 text
+int font_measure(int font, const char *text, int *width, int *height);
+
+// Draw UTF-8 text with the top left of its first line at screen x, y, '\n' starts a new line.
+// dst holds screen lines y0 to y0 + dst->high - 1 (a stripe, or the whole frame with y0 0): calling font_draw
+// for every stripe with the same text renders it across stripes, glyphs outside the stripe cost nothing.
+// bg is an LCD order color: every glyph cell is filled with it, or FONT_BG_NONE to leave the cells alone.
+// bounds, when not NULL, gets the screen area the whole text covers
+int font_draw(int font, const pixel_surface_t *dst, int y0, int x, int y, const char *text, uint16_t color, int32_t bg,
+              pixel_rect_t *bounds);
+
+// Drop every cached glyph
+void font_flush(void);
+
+void font_get_stats(uint32_t *hits, uint32_t *misses);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,106 @@
+#!/usr/bin/env python
+#
+# Build a font partition image from TTF/OTF files with Pillow, see include/font.h for the layout.
+# Each --font is name:file:pixel_size[:chars.txt], printable ASCII is always in, chars.txt adds every character
+# it contains (a CJK subset: the strings of the product, the TTS prompts).
+#
+#   python mkfont.py font.bin --font ui16:NotoSans-Regular.ttf:16 --font cjk16:NotoSansSC-Regular.otf:16:zh.txt
+#   parttool.py write_partition --partition-name=font --input=font.bin
+#
+import argparse
+import struct
+import sys
+
+from PIL import Image, ImageDraw, ImageFont
+
+MAGIC = 0x30544E46  # "FNT0"
+NAME_LEN = 24
+HEADER = struct.Struct('<II')
+ENTRY = struct.Struct('<%dsIIHH' % NAME_LEN)
+GLYPH = struct.Struct('<IIBBbbB3x')
+
+
+def font_chars(path, chars):
+    """Drop the characters the font has no glyph for, when fontTools is there to tell."""
+    try:
+        from fontTools.ttLib import TTFont
+    except ImportError:
+        return chars
+    cmap = TTFont(path, fontNumber=0).getBestCmap()
+    missing = [c for c in chars if ord(c) not in cmap]
+    if missing:
+        print('%s: no glyph for %d characters' % (path, len(missing)))
+    return [c for c in chars if ord(c) in cmap]
+
+
+def rasterize(font, ascent, ch):
+    """Tight 4 bit alpha box of one character, offsets from the pen position and the line top."""
+    left, top, right, bottom = font.getbbox(ch, anchor='ls')
+    advance = int(round(font.getlength(ch)))
+    width, height = max(right - left, 0), max(bottom - top, 0)
+    if width == 0 or height == 0:
+        return advance, 0, 0, 0, 0, b''
+    img = Image.new('L', (width, height), 0)
+    ImageDraw.Draw(img).text((-left, -top), ch, font=font, fill=255, anchor='ls')
+    stride = (width + 1) // 2
+    bitmap = bytearray(stride * height)
+    pixels = img.load()
+    for y in range(height):
+        for x in range(width):
+            a = (pixels[x, y] * 15 + 127) // 255
+            bitmap[y * stride + x // 2] |= a << (0 if x & 1 else 4)
+    return advance, width, height, left, ascent + top, bytes(bitmap)
+
+
+def build_font(spec):
+    parts = spec.split(':')
+    if len(parts) not in (3, 4):
+        sys.exit('%s: expected name:file:size[:chars.txt]' % spec)
+    name, path, size = parts[0].encode(), parts[1], int(parts[2])
+    if len(name) > NAME_LEN:
+        sys.exit('%s: name longer than %d bytes' % (spec, NAME_LEN))
+    chars = set(chr(c) for c in range(0x20, 0x7F))
+    if len(parts) == 4:
+        chars |= set(c for c in open(parts[3], encoding='utf-8').read() if c.isprintable())
+    chars = font_chars(path, sorted(chars))
+    font = ImageFont.truetype(path, size)
+    ascent, descent = font.getmetrics()
+    glyphs = []
+    for ch in chars:
+        advance, width, height, x_off, y_off, bitmap = rasterize(font, ascent, ch)
+        if width > 255 or height > 255 or advance > 255 or not -128 <= x_off < 128 or not -128 <= y_off < 128:
+            sys.exit('%s: U+%04X does not fit the glyph table, use a smaller size' % (path, ord(ch)))
+        glyphs.append((ord(ch), width, height, x_off, y_off, advance, bitmap))
+    return name, ascent + descent, ascent, glyphs
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('output', help='partition image to write')
+    parser.add_argument('--font', action='append', required=True, help='name:file:pixel_size[:chars.txt]')
+    parser.add_argument('--size', type=lambda s: int(s, 0), help='pad to the partition size and check it fits')
+    args = parser.parse_args()
+
+    fonts = [build_font(spec) for spec in args.font]
+    image = bytearray(HEADER.size + ENTRY.size * len(fonts))
+    entries = []
+    for name, line_height, ascent, glyphs in fonts:
+        image += b'\0' * (-len(image) % 4)
+        table = len(image)
+        image += b'\0' * (GLYPH.size * len(glyphs))
+        for i, (code, width, height, x_off, y_off, advance, bitmap) in enumerate(glyphs):
+            GLYPH.pack_into(image, table + i * GLYPH.size, code, len(image), width, height, x_off, y_off, advance)
+            image += bitmap
+        entries.append(ENTRY.pack(name, table, len(glyphs), line_height, ascent))
+        print('%s: %d glyphs, line height %d' % (name.decode(), len(glyphs), line_height))
+    image[:HEADER.size + ENTRY.size * len(fonts)] = HEADER.pack(MAGIC, len(fonts)) + b''.join(entries)
+    if args.size is not None:
+        if len(image) > args.size:
+            sys.exit('%d bytes do not fit the %d byte partition' % (len(image), args.size))
+        image += b'\xff' * (args.size - len(image))
+    open(args.output, 'wb').write(image)
+    print('%s: %d fonts, %d bytes' % (args.output, len(fonts), len(image)))
+
+
+if __name__ == '__main__':
+    main()
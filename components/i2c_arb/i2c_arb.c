@@ -0,0 +1,236 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "i2c_arb.h"
+
+static const char *TAG = "i2c_arb";
+
+typedef struct {
+    int sda;
+    int scl;
+    i2c_port_t port;
+    uint32_t clk_speed;
+    volatile int ready;         // driver installed
+    int busy;
+    uint32_t ticket;            // arrival order of the waiters
+    i2c_arb_dev_t *devs;
+} i2c_arb_bus_t;
+
+struct i2c_arb_dev {
+    const char *name;
+    i2c_arb_bus_t *bus;
+    uint8_t priority;
+    SemaphoreHandle_t lock;     // recursive: one task of the device at a time, i2c_arb_cmd_begin inside i2c_arb_acquire
+    SemaphoreHandle_t grant;    // given by the device that hands the bus over
+    int depth;
+    int waiting;
+    uint32_t ticket;
+    uint32_t transfers;
+    uint32_t max_wait_us;
+    i2c_arb_dev_t *next;
+};
+
+static i2c_arb_bus_t *i2c_arb_bus[I2C_NUM_MAX];
+
+static portMUX_TYPE i2c_arb_lock = portMUX_INITIALIZER_UNLOCKED; // waiter bookkeeping of every bus
+
+static TickType_t i2c_arb_ticks(uint32_t timeout_ms)
+{
+    return timeout_ms == portMAX_DELAY ? portMAX_DELAY : timeout_ms / portTICK_PERIOD_MS;
+}
+
+esp_err_t i2c_arb_acquire(i2c_arb_dev_t *dev, uint32_t timeout_ms)
+{
+    if (xSemaphoreTakeRecursive(dev->lock, i2c_arb_ticks(timeout_ms)) != pdTRUE) {
+        return ESP_ERR_TIMEOUT;
+    }
+    if (dev->depth++ > 0) {
+        return ESP_OK;
+    }
+    i2c_arb_bus_t *bus = dev->bus;
+    int64_t start = esp_timer_get_time();
+    portENTER_CRITICAL(&i2c_arb_lock);
+    if (!bus->busy) {
+        bus->busy = 1;
+        portEXIT_CRITICAL(&i2c_arb_lock);
+        return ESP_OK;
+    }
+    dev->waiting = 1;
+    dev->ticket = bus->ticket++;
+    portEXIT_CRITICAL(&i2c_arb_lock);
+
+    if (xSemaphoreTake(dev->grant, i2c_arb_ticks(timeout_ms)) != pdTRUE) {
+        portENTER_CRITICAL(&i2c_arb_lock);
+        int granted = !dev->waiting;
+        dev->waiting = 0;
+        portEXIT_CRITICAL(&i2c_arb_lock);
+        if (!granted) {
+            ESP_LOGW(TAG, "%s: bus wait timeout\n", dev->name);
+            dev->depth--;
+            xSemaphoreGiveRecursive(dev->lock);
+            return ESP_ERR_TIMEOUT;
+        }
+        // handed over as the wait timed out, the grant is on its way
+        xSemaphoreTake(dev->grant, portMAX_DELAY);
+    }
+    uint32_t wait_us = esp_timer_get_time() - start;
+    if (wait_us > dev->max_wait_us) {
+        dev->max_wait_us = wait_us;
+    }
+    return ESP_OK;
+}
+
+void i2c_arb_release(i2c_arb_dev_t *dev)
+{
+    if (--dev->depth > 0) {
+        xSemaphoreGiveRecursive(dev->lock);
+        return;
+    }
+    i2c_arb_bus_t *bus = dev->bus;
+    i2c_arb_dev_t *next = NULL;
+    portENTER_CRITICAL(&i2c_arb_lock);
+    for (i2c_arb_dev_t *d = bus->devs; d; d = d->next) {
+        if (d->waiting && (!next || d->priority > next->priority ||
+                           (d->priority == next->priority && (int32_t)(d->ticket - next->ticket) < 0))) {
+            next = d;
+        }
+    }
+    if (next) {
+        next->waiting = 0; // the bus stays busy, it belongs to next from here
+    } else {
+        bus->busy = 0;
+    }
+    portEXIT_CRITICAL(&i2c_arb_lock);
+    if (next) {
+        xSemaphoreGive(next->grant);
+    }
+    xSemaphoreGiveRecursive(dev->lock);
+}
+
+esp_err_t i2c_arb_cmd_begin(i2c_arb_dev_t *dev, i2c_cmd_handle_t cmd, uint32_t timeout_ms)
+{
+    esp_err_t ret = i2c_arb_acquire(dev, timeout_ms);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    ret = i2c_master_cmd_begin(dev->bus->port, cmd, i2c_arb_ticks(timeout_ms));
+    dev->transfers++;
+    i2c_arb_release(dev);
+    return ret;
+}
+
+i2c_port_t i2c_arb_get_port(i2c_arb_dev_t *dev)
+{
+    return dev->bus->port;
+}
+
+void i2c_arb_get_stats(i2c_arb_dev_t *dev, uint32_t *transfers, uint32_t *max_wait_us)
+{
+    *transfers = dev->transfers;
+    *max_wait_us = dev->max_wait_us;
+}
+
+// Bus on the pins of conf, created with the driver installed on port when there is none yet
+static i2c_arb_bus_t *i2c_arb_bus_get(i2c_port_t port, const i2c_config_t *conf)
+{
+    i2c_arb_bus_t *bus = (i2c_arb_bus_t *)calloc(1, sizeof(i2c_arb_bus_t));
+    if (!bus) {
+        return NULL;
+    }
+    bus->sda = conf->sda_io_num;
+    bus->scl = conf->scl_io_num;
+    bus->port = port;
+    bus->clk_speed = conf->master.clk_speed;
+    bus->busy = 1; // until the driver is installed
+    i2c_arb_bus_t *found = NULL;
+    portENTER_CRITICAL(&i2c_arb_lock);
+    for (int i = 0; i < I2C_NUM_MAX; i++) {
+        if (i2c_arb_bus[i] && i2c_arb_bus[i]->sda == bus->sda && i2c_arb_bus[i]->scl == bus->scl) {
+            found = i2c_arb_bus[i];
+        }
+    }
+    if (!found && i2c_arb_bus[port]) {
+        portEXIT_CRITICAL(&i2c_arb_lock);
+        ESP_LOGE(TAG, "port %d is on other pins\n", port);
+        free(bus);
+        return NULL;
+    }
+    if (!found) {
+        i2c_arb_bus[port] = bus;
+    }
+    portEXIT_CRITICAL(&i2c_arb_lock);
+    if (found) {
+        free(bus);
+        // another device is installing the driver
+        while (!found->ready) {
+            vTaskDelay(1);
+        }
+        return found;
+    }
+    esp_err_t ret = i2c_param_config(port, conf);
+    if (ret == ESP_OK) {
+        ret = i2c_driver_install(port, I2C_MODE_MASTER, 0, 0, 0);
+    }
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "i2c driver install error\n");
+        portENTER_CRITICAL(&i2c_arb_lock);
+        i2c_arb_bus[port] = NULL;
+        portEXIT_CRITICAL(&i2c_arb_lock);
+        free(bus);
+        return NULL;
+    }
+    bus->busy = 0;
+    bus->ready = 1;
+    ESP_LOGI(TAG, "bus on port %d, sda: %d, scl: %d, %u Hz\n", port, bus->sda, bus->scl, bus->clk_speed);
+    return bus;
+}
+
+i2c_arb_dev_t *i2c_arb_add(const i2c_arb_config_t *config)
+{
+    if (config->port >= I2C_NUM_MAX || config->conf.mode != I2C_MODE_MASTER) {
+        ESP_LOGE(TAG, "i2c arb config error\n");
+        return NULL;
+    }
+    i2c_arb_dev_t *dev = (i2c_arb_dev_t *)calloc(1, sizeof(i2c_arb_dev_t));
+    if (!dev) {
+        ESP_LOGE(TAG, "i2c arb device malloc error\n");
+        return NULL;
+    }
+    dev->name = config->name ? config->name : "i2c";
+    dev->priority = config->priority;
+    dev->lock = xSemaphoreCreateRecursiveMutex();
+    dev->grant = xSemaphoreCreateBinary();
+    dev->bus = dev->lock && dev->grant ? i2c_arb_bus_get(config->port, &config->conf) : NULL;
+    if (!dev->bus) {
+        if (dev->lock) {
+            vSemaphoreDelete(dev->lock);
+        }
+        if (dev->grant) {
+            vSemaphoreDelete(dev->grant);
+        }
+        free(dev);
+        return NULL;
+    }
+    portENTER_CRITICAL(&i2c_arb_lock);
+    dev->next = dev->bus->devs;
+    dev->bus->devs = dev;
+    portEXIT_CRITICAL(&i2c_arb_lock);
+
+    // 总线按最慢的设备运行
+    if (config->conf.master.clk_speed < dev->bus->clk_speed && i2c_arb_acquire(dev, portMAX_DELAY) == ESP_OK) {
+        i2c_config_t conf = config->conf;
+        conf.sda_io_num = dev->bus->sda;
+        conf.scl_io_num = dev->bus->scl;
+        if (i2c_param_config(dev->bus->port, &conf) == ESP_OK) {
+            dev->bus->clk_speed = conf.master.clk_speed;
+        }
+        i2c_arb_release(dev);
+    }
+    ESP_LOGI(TAG, "%s on port %d, priority %d\n", dev->name, dev->bus->port, dev->priority);
+    return dev;
+}
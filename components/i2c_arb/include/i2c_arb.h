@@ -0,0 +1,45 @@
+#pragma once
+
+#include <stdint.h>
+#include "driver/i2c.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Priority arbitration of I2C buses shared by several drivers. On Kaluga the OV2640 SCCB and the audio codec
+// sit on the same GPIO 7/8 pair: each driver registers a device with a priority and sends its command links
+// through i2c_arb_cmd_begin, which queues it behind the transfer on the bus. When the bus frees up, the highest
+// priority device waiting gets it, first come first served within a priority. Drivers merge register writes into
+// links of a bounded size (SCCB_WR_Table, EsRegCache batches), so a codec volume change waits for at most one
+// batch of a sensor table load instead of the whole table.
+
+typedef struct i2c_arb_dev i2c_arb_dev_t;
+
+typedef struct {
+    const char *name;
+    i2c_port_t port;        // used by the first device on the pins, later ones share its port
+    i2c_config_t conf;      // master mode. the bus runs at the lowest clk_speed of its devices
+    uint8_t priority;       // higher goes first: latency sensitive control above bulk table loads
+} i2c_arb_config_t;
+
+// Add a device, the first one on a pin pair installs the I2C driver. NULL on error
+i2c_arb_dev_t *i2c_arb_add(const i2c_arb_config_t *config);
+
+// Run a command link once the device gets the bus, timeout_ms bounds the wait and the transfer each
+esp_err_t i2c_arb_cmd_begin(i2c_arb_dev_t *dev, i2c_cmd_handle_t cmd, uint32_t timeout_ms);
+
+// Hold the bus across several command links, e.g. a register address write and the read that follows
+esp_err_t i2c_arb_acquire(i2c_arb_dev_t *dev, uint32_t timeout_ms);
+
+void i2c_arb_release(i2c_arb_dev_t *dev);
+
+// Port of the bus the device is on
+i2c_port_t i2c_arb_get_port(i2c_arb_dev_t *dev);
+
+// Links run for the device and its longest wait for the bus in us
+void i2c_arb_get_stats(i2c_arb_dev_t *dev, uint32_t *transfers, uint32_t *max_wait_us);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Shared pool for bursty processing work: downscaling, JPEG decode, FFT, inference batches. A stage splits
+// its work into jobs instead of running it all in its own task, so a burst spreads over whatever core has
+// time for it. One worker task per core, each with a queue per priority class: a job goes to the back of
+// the queue of the core that submits it, the worker of that core takes the newest job first (its data is
+// still in the cache) and an idle worker steals the oldest job of another core. Higher classes go first.
+// Jobs run to the end on a worker and must not block: ISR handoffs and work with a deadline of its own
+// stay on their dedicated tasks.
+
+typedef enum {
+    JOBS_PRI_HIGH = 0,  // a frame or audio chunk in flight waits for it
+    JOBS_PRI_NORMAL,
+    JOBS_PRI_LOW,       // background: statistics, uploads
+    JOBS_PRI_MAX,
+} jobs_pri_t;
+
+typedef void (*jobs_fn_t)(void *arg);
+
+// Runs the items [start, end) of a jobs_parallel
+typedef void (*jobs_range_fn_t)(void *arg, int start, int end);
+
+// Jobs one task waits for together, e.g. on its stack
+typedef struct {
+    int pending;
+    int waiting;
+    SemaphoreHandle_t done;
+    StaticSemaphore_t done_buf;
+} jobs_group_t;
+
+typedef struct {
+    uint8_t task_pri;       // priority of the workers, above the stages that submit keeps the latency low
+    uint8_t cores;          // workers, 0: one per core
+    uint16_t stack_size;    // per worker, 0: 3072
+} jobs_config_t;
+
+int jobs_init(const jobs_config_t *config);
+
+// Runs the jobs still queued, then stops the workers
+void jobs_deinit(void);
+
+void jobs_group_init(jobs_group_t *group);
+
+// Run fn(arg) on a worker. Without the pool or with the queue full it runs in the calling task before returning
+void jobs_submit(jobs_group_t *group, jobs_pri_t pri, jobs_fn_t fn, void *arg);
+
+// Block until every job submitted to the group has run, one task waits for a group at a time
+void jobs_wait(jobs_group_t *group);
+
+// Split count items into up to parts ranges and run them as jobs, the last range in the calling task,
+// and return when all are done. Ranges run at the same time, fn must only touch data of its own range
+void jobs_parallel(jobs_pri_t pri, int count, int parts, jobs_range_fn_t fn, void *arg);
+
+// Workers of the pool, 0 when it is not running: how many parts a stage should split its work into
+int jobs_workers(void);
+
+// Print per worker the jobs run and stolen and the queue high water, as "JOBS" lines
+void jobs_print_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,351 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "sdkconfig.h"
+#include "jobs.h"
+
+static const char *TAG = "jobs";
+
+#define JOBS_QUEUE_LEN   CONFIG_JOBS_QUEUE_LEN
+
+typedef struct {
+    jobs_fn_t fn;
+    jobs_range_fn_t range;  // instead of fn for a range of jobs_parallel
+    void *arg;
+    jobs_group_t *group;
+    int start;
+    int end;
+} jobs_job_t;
+
+// Ring of jobs: the owner takes from the back, thieves from the front
+typedef struct {
+    jobs_job_t job[JOBS_QUEUE_LEN];
+    uint16_t head;
+    uint16_t cnt;
+} jobs_queue_t;
+
+typedef struct {
+    jobs_queue_t queue[JOBS_PRI_MAX];
+    portMUX_TYPE lock;
+    TaskHandle_t task;
+    volatile int idle;
+    uint32_t run;
+    uint32_t stolen;
+    uint32_t inline_run;    // submitted on this core to a full queue
+    uint16_t high_water;
+} jobs_worker_t;
+
+typedef struct {
+    jobs_worker_t *worker;
+    int num;
+    volatile int stop;
+    SemaphoreHandle_t exit;
+} jobs_obj_t;
+
+static jobs_obj_t *jobs_obj = NULL;
+
+static portMUX_TYPE jobs_group_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static void jobs_group_done(jobs_group_t *group)
+{
+    portENTER_CRITICAL(&jobs_group_lock);
+    int give = --group->pending == 0 && group->waiting;
+    if (give) {
+        group->waiting = 0;
+    }
+    portEXIT_CRITICAL(&jobs_group_lock);
+    if (give) {
+        xSemaphoreGive(group->done);
+    }
+}
+
+static void jobs_run(const jobs_job_t *job)
+{
+    if (job->range) {
+        job->range(job->arg, job->start, job->end);
+    } else {
+        job->fn(job->arg);
+    }
+    if (job->group) {
+        jobs_group_done(job->group);
+    }
+}
+
+static int jobs_push(jobs_worker_t *w, jobs_pri_t pri, const jobs_job_t *job)
+{
+    jobs_queue_t *q = &w->queue[pri];
+    int ret = -1;
+    portENTER_CRITICAL(&w->lock);
+    if (q->cnt < JOBS_QUEUE_LEN) {
+        q->job[(q->head + q->cnt) % JOBS_QUEUE_LEN] = *job;
+        q->cnt++;
+        if (q->cnt > w->high_water) {
+            w->high_water = q->cnt;
+        }
+        ret = 0;
+    }
+    portEXIT_CRITICAL(&w->lock);
+    return ret;
+}
+
+// The newest job, from the back
+static int jobs_pop(jobs_worker_t *w, jobs_pri_t pri, jobs_job_t *job)
+{
+    jobs_queue_t *q = &w->queue[pri];
+    int ret = 0;
+    portENTER_CRITICAL(&w->lock);
+    if (q->cnt) {
+        q->cnt--;
+        *job = q->job[(q->head + q->cnt) % JOBS_QUEUE_LEN];
+        ret = 1;
+    }
+    portEXIT_CRITICAL(&w->lock);
+    return ret;
+}
+
+// The oldest job, from the front
+static int jobs_steal(jobs_worker_t *w, jobs_pri_t pri, jobs_job_t *job)
+{
+    jobs_queue_t *q = &w->queue[pri];
+    int ret = 0;
+    portENTER_CRITICAL(&w->lock);
+    if (q->cnt) {
+        *job = q->job[q->head];
+        q->head = (q->head + 1) % JOBS_QUEUE_LEN;
+        q->cnt--;
+        ret = 1;
+    }
+    portEXIT_CRITICAL(&w->lock);
+    return ret;
+}
+
+// A higher class of another core goes before a lower class of our own
+static int jobs_take(jobs_worker_t *self, jobs_job_t *job)
+{
+    int num = jobs_obj->num;
+    int me = self - jobs_obj->worker;
+    for (int pri = 0; pri < JOBS_PRI_MAX; pri++) {
+        if (jobs_pop(self, pri, job)) {
+            return 1;
+        }
+        for (int i = 1; i < num; i++) {
+            if (jobs_steal(&jobs_obj->worker[(me + i) % num], pri, job)) {
+                self->stolen++;
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+static jobs_worker_t *jobs_home(void)
+{
+    return &jobs_obj->worker[xPortGetCoreID() % jobs_obj->num];
+}
+
+static jobs_worker_t *jobs_self(void)
+{
+    TaskHandle_t task = xTaskGetCurrentTaskHandle();
+    for (int i = 0; jobs_obj && i < jobs_obj->num; i++) {
+        if (jobs_obj->worker[i].task == task) {
+            return &jobs_obj->worker[i];
+        }
+    }
+    return NULL;
+}
+
+static void jobs_task(void *arg)
+{
+    jobs_worker_t *self = (jobs_worker_t *)arg;
+    jobs_job_t job;
+    while (1) {
+        if (jobs_take(self, &job)) {
+            jobs_run(&job);
+            self->run++;
+            continue;
+        }
+        // idle is set before the last look, a job pushed after it finds the flag and wakes us
+        self->idle = 1;
+        if (jobs_take(self, &job)) {
+            self->idle = 0;
+            jobs_run(&job);
+            self->run++;
+            continue;
+        }
+        if (jobs_obj->stop) {
+            break;
+        }
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        self->idle = 0;
+    }
+    xSemaphoreGive(jobs_obj->exit);
+    vTaskDelete(NULL);
+}
+
+static void jobs_post(const jobs_job_t *job, jobs_pri_t pri)
+{
+    if (job->group) {
+        portENTER_CRITICAL(&jobs_group_lock);
+        job->group->pending++;
+        portEXIT_CRITICAL(&jobs_group_lock);
+    }
+    if (pri >= JOBS_PRI_MAX) {
+        pri = JOBS_PRI_LOW;
+    }
+    if (!jobs_obj || jobs_obj->stop) {
+        jobs_run(job);
+        return;
+    }
+    jobs_worker_t *home = jobs_home();
+    if (jobs_push(home, pri, job) != 0) {
+        home->inline_run++;
+        jobs_run(job);
+        return;
+    }
+    xTaskNotifyGive(home->task);
+    for (int i = 0; i < jobs_obj->num; i++) {
+        jobs_worker_t *w = &jobs_obj->worker[i];
+        if (w != home && w->idle) {
+            xTaskNotifyGive(w->task);
+        }
+    }
+}
+
+void jobs_group_init(jobs_group_t *group)
+{
+    memset(group, 0, sizeof(jobs_group_t));
+    group->done = xSemaphoreCreateBinaryStatic(&group->done_buf);
+}
+
+void jobs_submit(jobs_group_t *group, jobs_pri_t pri, jobs_fn_t fn, void *arg)
+{
+    jobs_job_t job = {
+        .fn = fn,
+        .arg = arg,
+        .group = group,
+    };
+    jobs_post(&job, pri);
+}
+
+void jobs_wait(jobs_group_t *group)
+{
+    // a worker waiting inside a job keeps running jobs, it may be the only one left to run its own
+    jobs_worker_t *self = jobs_self();
+    jobs_job_t job;
+    while (self && group->pending && jobs_take(self, &job)) {
+        jobs_run(&job);
+        self->run++;
+    }
+    portENTER_CRITICAL(&jobs_group_lock);
+    int wait = group->pending > 0;
+    group->waiting = wait;
+    portEXIT_CRITICAL(&jobs_group_lock);
+    if (wait) {
+        xSemaphoreTake(group->done, portMAX_DELAY);
+    }
+}
+
+void jobs_parallel(jobs_pri_t pri, int count, int parts, jobs_range_fn_t fn, void *arg)
+{
+    if (count <= 0) {
+        return;
+    }
+    parts = parts < 1 ? 1 : parts > count ? count : parts;
+    jobs_group_t group;
+    jobs_group_init(&group);
+    int start = 0;
+    for (int i = 1; i < parts; i++) {
+        int end = (int64_t)count * i / parts;
+        jobs_job_t job = {
+            .range = fn,
+            .arg = arg,
+            .group = &group,
+            .start = start,
+            .end = end,
+        };
+        jobs_post(&job, pri);
+        start = end;
+    }
+    fn(arg, start, count);
+    jobs_wait(&group);
+}
+
+int jobs_workers(void)
+{
+    return jobs_obj ? jobs_obj->num : 0;
+}
+
+void jobs_print_stats(void)
+{
+    for (int i = 0; jobs_obj && i < jobs_obj->num; i++) {
+        jobs_worker_t *w = &jobs_obj->worker[i];
+        printf("JOBS worker %d run %u stolen %u inline %u queue high water %u\n",
+               i, w->run, w->stolen, w->inline_run, w->high_water);
+    }
+}
+
+void jobs_deinit(void)
+{
+    if (!jobs_obj) {
+        return;
+    }
+    jobs_obj->stop = 1;
+    for (int i = 0; i < jobs_obj->num; i++) {
+        if (jobs_obj->worker[i].task) {
+            xTaskNotifyGive(jobs_obj->worker[i].task);
+            xSemaphoreTake(jobs_obj->exit, portMAX_DELAY);
+        }
+    }
+    vSemaphoreDelete(jobs_obj->exit);
+    free(jobs_obj->worker);
+    free(jobs_obj);
+    jobs_obj = NULL;
+}
+
+int jobs_init(const jobs_config_t *config)
+{
+    int num = config->cores ? config->cores : portNUM_PROCESSORS;
+    if (num > portNUM_PROCESSORS) {
+        num = portNUM_PROCESSORS;
+    }
+    jobs_deinit();
+    // the locks must not be in PSRAM
+    jobs_obj = (jobs_obj_t *)heap_caps_calloc(1, sizeof(jobs_obj_t), MALLOC_CAP_INTERNAL);
+    if (!jobs_obj) {
+        ESP_LOGE(TAG, "jobs object malloc error\n");
+        return -1;
+    }
+    jobs_obj->worker = (jobs_worker_t *)heap_caps_calloc(num, sizeof(jobs_worker_t), MALLOC_CAP_INTERNAL);
+    jobs_obj->exit = xSemaphoreCreateCounting(num, 0);
+    if (!jobs_obj->worker || !jobs_obj->exit) {
+        ESP_LOGE(TAG, "worker malloc error\n");
+        if (jobs_obj->exit) {
+            vSemaphoreDelete(jobs_obj->exit);
+        }
+        free(jobs_obj->worker);
+        free(jobs_obj);
+        jobs_obj = NULL;
+        return -1;
+    }
+    jobs_obj->num = num;
+    for (int i = 0; i < num; i++) {
+        vPortCPUInitializeMutex(&jobs_obj->worker[i].lock);
+    }
+    for (int i = 0; i < num; i++) {
+        // one worker per core pinned to it, fewer float
+        BaseType_t core = num == portNUM_PROCESSORS ? i : tskNO_AFFINITY;
+        if (xTaskCreatePinnedToCore(jobs_task, "jobs", config->stack_size ? config->stack_size : 3072, &jobs_obj->worker[i],
+                                    config->task_pri, &jobs_obj->worker[i].task, core) != pdPASS) {
+            ESP_LOGE(TAG, "worker %d task create error\n", i);
+            jobs_deinit();
+            return -1;
+        }
+    }
+    ESP_LOGI(TAG, "%d workers, priority %d\n", num, config->task_pri);
+    return 0;
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Baseline JPEG encoder for RGB565 frames (LCD order), 4:2:0, standard Huffman tables.
+// A frame is read one MCU row (16 lines) at a time: color conversion and chroma subsampling fill a
+// stripe buffer, a fixed-point DCT and quantization follow, so only a stripe of working memory is needed
+// and a frame from cam_take() can be encoded while the sensor stays in RGB565 for the preview.
+
+// Output sink, called with up to out_size bytes at a time, return 0 to go on, -1 to abort the frame
+typedef int (*jpeg_enc_write_t)(const uint8_t *data, size_t len, void *arg);
+
+typedef struct {
+    uint16_t width;          // source frame size in pixels
+    uint16_t high;
+    uint8_t quality;         // 1~100, 0: 80
+    uint8_t scale;           // thumbnails: 2/4 box downscale while converting, 0/1: full size
+    jpeg_enc_write_t write;
+    void *write_arg;
+    uint16_t out_size;       // output chunk bytes, 0: 1024
+    uint8_t restart_rows;    // a restart marker every N MCU rows, a decoder can start at any of them, 0: none
+} jpeg_enc_config_t;
+
+// Encode one frame, returns the JPEG size, -1 when the sink aborted
+int jpeg_enc_frame(const uint8_t *frame);
+
+int jpeg_enc_init(const jpeg_enc_config_t *config);
+
+void jpeg_enc_deinit(void);
+
+#ifdef __cplusplus
+}
+#endif
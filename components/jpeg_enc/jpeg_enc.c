@@ -0,0 +1,518 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "jpeg_enc.h"
+
+static const char *TAG = "jpeg_enc";
+
+#define JPEG_ENC_MCU        (16)   // 4:2:0, one MCU is 16x16 pixels: four Y blocks, one Cb and one Cr
+#define JPEG_ENC_CONST_BITS (13)
+#define JPEG_ENC_PASS1_BITS (2)
+#define JPEG_ENC_DESCALE(x, n) (((x) + (1 << ((n) - 1))) >> (n))
+
+typedef struct {
+    uint16_t code[256];
+    uint8_t size[256];
+} jpeg_enc_huff_t;
+
+typedef struct {
+    jpeg_enc_config_t config;
+    int out_width;
+    int out_high;
+    int stripe_width;           // out_width rounded up to whole MCUs
+    uint8_t *y;                 // one MCU row of luma, 16 lines of stripe_width
+    uint8_t *cb;                // 8 lines of stripe_width / 2
+    uint8_t *cr;
+    uint8_t qt[2][64];          // quantization tables in zigzag order, as written to DQT
+    uint16_t recip[2][64];      // 65536 / (8 * q) in natural order, the DCT output is scaled by 8
+    jpeg_enc_huff_t dc[2];
+    jpeg_enc_huff_t ac[2];
+    uint8_t *out;
+    size_t out_len;
+    size_t out_total;
+    int error;
+    uint32_t bits;              // pending bits, left aligned
+    int bit_cnt;
+    int dc_pred[3];
+} jpeg_enc_obj_t;
+
+static jpeg_enc_obj_t *jpeg_enc_obj = NULL;
+
+static const uint8_t jpeg_enc_zigzag[64] = {
+    0,  1,  8, 16,  9,  2,  3, 10, 17, 24, 32, 25, 18, 11,  4,  5,
+    12, 19, 26, 33, 40, 48, 41, 34, 27, 20, 13,  6,  7, 14, 21, 28,
+    35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23, 30, 37, 44, 51,
+    58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63,
+};
+
+// ITU-T T.81 Annex K tables, natural order
+static const uint8_t jpeg_enc_qt_luma[64] = {
+    16, 11, 10, 16,  24,  40,  51,  61,
+    12, 12, 14, 19,  26,  58,  60,  55,
+    14, 13, 16, 24,  40,  57,  69,  56,
+    14, 17, 22, 29,  51,  87,  80,  62,
+    18, 22, 37, 56,  68, 109, 103,  77,
+    24, 35, 55, 64,  81, 104, 113,  92,
+    49, 64, 78, 87, 103, 121, 120, 101,
+    72, 92, 95, 98, 112, 100, 103,  99,
+};
+
+static const uint8_t jpeg_enc_qt_chroma[64] = {
+    17, 18, 24, 47, 99, 99, 99, 99,
+    18, 21, 26, 66, 99, 99, 99, 99,
+    24, 26, 56, 99, 99, 99, 99, 99,
+    47, 66, 99, 99, 99, 99, 99, 99,
+    99, 99, 99, 99, 99, 99, 99, 99,
+    99, 99, 99, 99, 99, 99, 99, 99,
+    99, 99, 99, 99, 99, 99, 99, 99,
+    99, 99, 99, 99, 99, 99, 99, 99,
+};
+
+static const uint8_t jpeg_enc_dc_luma_bits[16] = {0, 1, 5, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0};
+static const uint8_t jpeg_enc_dc_chroma_bits[16] = {0, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0};
+static const uint8_t jpeg_enc_dc_vals[12] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+
+static const uint8_t jpeg_enc_ac_luma_bits[16] = {0, 2, 1, 3, 3, 2, 4, 3, 5, 5, 4, 4, 0, 0, 1, 0x7d};
+static const uint8_t jpeg_enc_ac_luma_vals[162] = {
+    0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07,
+    0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xa1, 0x08, 0x23, 0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0,
+    0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0a, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x25, 0x26, 0x27, 0x28,
+    0x29, 0x2a, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+    0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+    0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
+    0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7,
+    0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5,
+    0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2,
+    0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8,
+    0xf9, 0xfa,
+};
+
+static const uint8_t jpeg_enc_ac_chroma_bits[16] = {0, 2, 1, 2, 4, 4, 3, 4, 7, 5, 4, 4, 0, 1, 2, 0x77};
+static const uint8_t jpeg_enc_ac_chroma_vals[162] = {
+    0x00, 0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71,
+    0x13, 0x22, 0x32, 0x81, 0x08, 0x14, 0x42, 0x91, 0xa1, 0xb1, 0xc1, 0x09, 0x23, 0x33, 0x52, 0xf0,
+    0x15, 0x62, 0x72, 0xd1, 0x0a, 0x16, 0x24, 0x34, 0xe1, 0x25, 0xf1, 0x17, 0x18, 0x19, 0x1a, 0x26,
+    0x27, 0x28, 0x29, 0x2a, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48,
+    0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
+    0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5,
+    0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3,
+    0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda,
+    0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8,
+    0xf9, 0xfa,
+};
+
+static void jpeg_enc_flush(void)
+{
+    if (jpeg_enc_obj->out_len && !jpeg_enc_obj->error &&
+        jpeg_enc_obj->config.write(jpeg_enc_obj->out, jpeg_enc_obj->out_len, jpeg_enc_obj->config.write_arg) != 0) {
+        jpeg_enc_obj->error = 1;
+    }
+    jpeg_enc_obj->out_total += jpeg_enc_obj->out_len;
+    jpeg_enc_obj->out_len = 0;
+}
+
+static inline void jpeg_enc_put_byte(uint8_t c)
+{
+    jpeg_enc_obj->out[jpeg_enc_obj->out_len++] = c;
+    if (jpeg_enc_obj->out_len == jpeg_enc_obj->config.out_size) {
+        jpeg_enc_flush();
+    }
+}
+
+static void jpeg_enc_put_bytes(const uint8_t *data, size_t len)
+{
+    for (int i = 0; i < len; i++) {
+        jpeg_enc_put_byte(data[i]);
+    }
+}
+
+static void jpeg_enc_put_marker(uint8_t marker, uint16_t len)
+{
+    uint8_t head[4] = {0xFF, marker, len >> 8, len & 0xFF}; // len counts itself, not the marker
+    jpeg_enc_put_bytes(head, 4);
+}
+
+// Entropy coded bits, a 0xFF byte is followed by a stuffed 0x00
+static inline void jpeg_enc_put_bits(uint32_t code, int size)
+{
+    jpeg_enc_obj->bits |= (code & ((1 << size) - 1)) << (32 - jpeg_enc_obj->bit_cnt - size);
+    jpeg_enc_obj->bit_cnt += size;
+    while (jpeg_enc_obj->bit_cnt >= 8) {
+        uint8_t c = jpeg_enc_obj->bits >> 24;
+        jpeg_enc_put_byte(c);
+        if (c == 0xFF) {
+            jpeg_enc_put_byte(0);
+        }
+        jpeg_enc_obj->bits <<= 8;
+        jpeg_enc_obj->bit_cnt -= 8;
+    }
+}
+
+// Canonical codes from the code length counts, T.81 Annex C
+static void jpeg_enc_huff_build(jpeg_enc_huff_t *huff, const uint8_t *bits, const uint8_t *vals)
+{
+    int code = 0;
+    int k = 0;
+    for (int len = 1; len <= 16; len++) {
+        for (int i = 0; i < bits[len - 1]; i++) {
+            huff->code[vals[k]] = code++;
+            huff->size[vals[k]] = len;
+            k++;
+        }
+        code <<= 1;
+    }
+}
+
+static void jpeg_enc_put_dht(uint8_t class_id, const uint8_t *bits, const uint8_t *vals)
+{
+    int cnt = 0;
+    for (int i = 0; i < 16; i++) {
+        cnt += bits[i];
+    }
+    jpeg_enc_put_byte(class_id);
+    jpeg_enc_put_bytes(bits, 16);
+    jpeg_enc_put_bytes(vals, cnt);
+}
+
+static void jpeg_enc_headers(void)
+{
+    static const uint8_t app0[14] = {'J', 'F', 'I', 'F', 0, 1, 1, 0, 0, 1, 0, 1, 0, 0};
+    static const uint8_t sos[10] = {3, 1, 0x00, 2, 0x11, 3, 0x11, 0, 63, 0};
+
+    jpeg_enc_put_byte(0xFF);
+    jpeg_enc_put_byte(0xD8);
+    jpeg_enc_put_marker(0xE0, 2 + sizeof(app0));
+    jpeg_enc_put_bytes(app0, sizeof(app0));
+
+    jpeg_enc_put_marker(0xDB, 2 + 2 * 65);
+    for (int t = 0; t < 2; t++) {
+        jpeg_enc_put_byte(t);
+        jpeg_enc_put_bytes(jpeg_enc_obj->qt[t], 64);
+    }
+
+    // Y 2x2 sampled on table 0, Cb and Cr 1x1 on table 1
+    uint8_t sof[15] = {8, jpeg_enc_obj->out_high >> 8, jpeg_enc_obj->out_high & 0xFF,
+                       jpeg_enc_obj->out_width >> 8, jpeg_enc_obj->out_width & 0xFF,
+                       3, 1, 0x22, 0, 2, 0x11, 1, 3, 0x11, 1};
+    jpeg_enc_put_marker(0xC0, 2 + sizeof(sof));
+    jpeg_enc_put_bytes(sof, sizeof(sof));
+
+    jpeg_enc_put_marker(0xC4, 2 + 4 * 17 + 2 * sizeof(jpeg_enc_dc_vals) + sizeof(jpeg_enc_ac_luma_vals) + sizeof(jpeg_enc_ac_chroma_vals));
+    jpeg_enc_put_dht(0x00, jpeg_enc_dc_luma_bits, jpeg_enc_dc_vals);
+    jpeg_enc_put_dht(0x10, jpeg_enc_ac_luma_bits, jpeg_enc_ac_luma_vals);
+    jpeg_enc_put_dht(0x01, jpeg_enc_dc_chroma_bits, jpeg_enc_dc_vals);
+    jpeg_enc_put_dht(0x11, jpeg_enc_ac_chroma_bits, jpeg_enc_ac_chroma_vals);
+
+    if (jpeg_enc_obj->config.restart_rows) {
+        // DRI counts MCUs, whole MCU rows
+        uint16_t interval = jpeg_enc_obj->config.restart_rows * (jpeg_enc_obj->stripe_width / JPEG_ENC_MCU);
+        jpeg_enc_put_marker(0xDD, 4);
+        jpeg_enc_put_byte(interval >> 8);
+        jpeg_enc_put_byte(interval & 0xFF);
+    }
+
+    jpeg_enc_put_marker(0xDA, 2 + sizeof(sos));
+    jpeg_enc_put_bytes(sos, sizeof(sos));
+}
+
+// Integer forward DCT in the style of the IJG islow DCT, the output is scaled up by 8
+static void jpeg_enc_fdct(int32_t *data)
+{
+    int32_t tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7;
+    int32_t tmp10, tmp11, tmp12, tmp13;
+    int32_t z1, z2, z3, z4, z5;
+
+    for (int pass = 0; pass < 2; pass++) {
+        // rows first, then columns
+        int step = pass ? 8 : 1;
+        int next = pass ? 1 : 8;
+        int shift = pass ? JPEG_ENC_CONST_BITS + JPEG_ENC_PASS1_BITS : JPEG_ENC_CONST_BITS - JPEG_ENC_PASS1_BITS;
+        int32_t *p = data;
+        for (int i = 0; i < 8; i++, p += next) {
+            tmp0 = p[0 * step] + p[7 * step];
+            tmp7 = p[0 * step] - p[7 * step];
+            tmp1 = p[1 * step] + p[6 * step];
+            tmp6 = p[1 * step] - p[6 * step];
+            tmp2 = p[2 * step] + p[5 * step];
+            tmp5 = p[2 * step] - p[5 * step];
+            tmp3 = p[3 * step] + p[4 * step];
+            tmp4 = p[3 * step] - p[4 * step];
+
+            tmp10 = tmp0 + tmp3;
+            tmp13 = tmp0 - tmp3;
+            tmp11 = tmp1 + tmp2;
+            tmp12 = tmp1 - tmp2;
+
+            if (pass) {
+                p[0 * step] = JPEG_ENC_DESCALE(tmp10 + tmp11, JPEG_ENC_PASS1_BITS);
+                p[4 * step] = JPEG_ENC_DESCALE(tmp10 - tmp11, JPEG_ENC_PASS1_BITS);
+            } else {
+                p[0 * step] = (tmp10 + tmp11) << JPEG_ENC_PASS1_BITS;
+                p[4 * step] = (tmp10 - tmp11) << JPEG_ENC_PASS1_BITS;
+            }
+
+            z1 = (tmp12 + tmp13) * 4433;                                  // 0.541196100
+            p[2 * step] = JPEG_ENC_DESCALE(z1 + tmp13 * 6270, shift);     // 0.765366865
+            p[6 * step] = JPEG_ENC_DESCALE(z1 - tmp12 * 15137, shift);    // 1.847759065
+
+            z1 = tmp4 + tmp7;
+            z2 = tmp5 + tmp6;
+            z3 = tmp4 + tmp6;
+            z4 = tmp5 + tmp7;
+            z5 = (z3 + z4) * 9633;  // 1.175875602
+
+            tmp4 *= 2446;           // 0.298631336
+            tmp5 *= 16819;          // 2.053119869
+            tmp6 *= 25172;          // 3.072711026
+            tmp7 *= 12299;          // 1.501321110
+            z1 *= -7373;            // 0.899976223
+            z2 *= -20995;           // 2.562915447
+            z3 = z3 * -16069 + z5;  // 1.961570560
+            z4 = z4 * -3196 + z5;   // 0.390180644
+
+            p[7 * step] = JPEG_ENC_DESCALE(tmp4 + z1 + z3, shift);
+            p[5 * step] = JPEG_ENC_DESCALE(tmp5 + z2 + z4, shift);
+            p[3 * step] = JPEG_ENC_DESCALE(tmp6 + z2 + z3, shift);
+            p[1 * step] = JPEG_ENC_DESCALE(tmp7 + z1 + z4, shift);
+        }
+    }
+}
+
+static inline int jpeg_enc_nbits(uint32_t v)
+{
+    return v ? 32 - __builtin_clz(v) : 0;
+}
+
+static void jpeg_enc_block(const uint8_t *src, int stride, int comp)
+{
+    int t = comp ? 1 : 0;
+    int32_t blk[64];
+    for (int y = 0; y < 8; y++, src += stride) {
+        for (int x = 0; x < 8; x++) {
+            blk[y * 8 + x] = src[x] - 128;
+        }
+    }
+    jpeg_enc_fdct(blk);
+
+    // Quantize by multiplying with the reciprocal, rounding half away from zero
+    int16_t coef[64];
+    const uint16_t *recip = jpeg_enc_obj->recip[t];
+    for (int k = 0; k < 64; k++) {
+        int n = jpeg_enc_zigzag[k];
+        int32_t v = blk[n];
+        int32_t q = (int32_t)(((uint32_t)(v < 0 ? -v : v) * recip[n] + 0x8000) >> 16);
+        coef[k] = v < 0 ? -q : q;
+    }
+
+    int diff = coef[0] - jpeg_enc_obj->dc_pred[comp];
+    jpeg_enc_obj->dc_pred[comp] = coef[0];
+    int size = jpeg_enc_nbits(diff < 0 ? -diff : diff);
+    jpeg_enc_put_bits(jpeg_enc_obj->dc[t].code[size], jpeg_enc_obj->dc[t].size[size]);
+    if (size) {
+        jpeg_enc_put_bits(diff < 0 ? diff - 1 : diff, size);
+    }
+
+    const jpeg_enc_huff_t *ac = &jpeg_enc_obj->ac[t];
+    int run = 0;
+    for (int k = 1; k < 64; k++) {
+        int v = coef[k];
+        if (v == 0) {
+            run++;
+            continue;
+        }
+        while (run > 15) {
+            jpeg_enc_put_bits(ac->code[0xF0], ac->size[0xF0]); // ZRL, 16 zeros
+            run -= 16;
+        }
+        size = jpeg_enc_nbits(v < 0 ? -v : v);
+        int sym = (run << 4) | size;
+        jpeg_enc_put_bits(ac->code[sym], ac->size[sym]);
+        jpeg_enc_put_bits(v < 0 ? v - 1 : v, size);
+        run = 0;
+    }
+    if (run) {
+        jpeg_enc_put_bits(ac->code[0x00], ac->size[0x00]); // EOB
+    }
+}
+
+// One output pixel as 8 bit R, G, B, averaged over scale x scale source pixels for thumbnails
+static inline void jpeg_enc_rgb(const uint8_t *frame, int x, int y, int *r, int *g, int *b)
+{
+    int scale = jpeg_enc_obj->config.scale;
+    size_t line_size = jpeg_enc_obj->config.width * 2;
+    const uint8_t *p = frame + (size_t)y * scale * line_size + x * scale * 2;
+    if (scale == 1) {
+        *r = p[0] & 0xf8;
+        *g = ((p[0] & 0x07) << 5) | ((p[1] & 0xe0) >> 3);
+        *b = (p[1] & 0x1f) << 3;
+        return;
+    }
+    int sr = 0, sg = 0, sb = 0;
+    for (int j = 0; j < scale; j++, p += line_size) {
+        for (int i = 0; i < scale * 2; i += 2) {
+            sr += p[i] & 0xf8;
+            sg += ((p[i] & 0x07) << 5) | ((p[i + 1] & 0xe0) >> 3);
+            sb += (p[i + 1] & 0x1f) << 3;
+        }
+    }
+    int n = scale * scale;
+    *r = sr / n;
+    *g = sg / n;
+    *b = sb / n;
+}
+
+static inline uint8_t jpeg_enc_clamp(int v)
+{
+    return v < 0 ? 0 : (v > 255 ? 255 : v);
+}
+
+// Convert MCU row mcu_y into the stripe: Y for every pixel, Cb/Cr from the sum of each 2x2 group.
+// Pixels past the right and bottom edge repeat the last column and line
+static void jpeg_enc_stripe(const uint8_t *frame, int mcu_y)
+{
+    int sw = jpeg_enc_obj->stripe_width;
+    int max_x = jpeg_enc_obj->out_width - 1;
+    int max_y = jpeg_enc_obj->out_high - 1;
+    for (int cy = 0; cy < JPEG_ENC_MCU / 2; cy++) {
+        int y0 = mcu_y * JPEG_ENC_MCU + cy * 2;
+        int sy[2] = {y0 < max_y ? y0 : max_y, y0 + 1 < max_y ? y0 + 1 : max_y};
+        uint8_t *yl[2] = {jpeg_enc_obj->y + cy * 2 * sw, jpeg_enc_obj->y + (cy * 2 + 1) * sw};
+        for (int cx = 0; cx < sw / 2; cx++) {
+            int sr = 0, sg = 0, sb = 0;
+            for (int j = 0; j < 2; j++) {
+                for (int i = 0; i < 2; i++) {
+                    int x = cx * 2 + i;
+                    int r, g, b;
+                    jpeg_enc_rgb(frame, x < max_x ? x : max_x, sy[j], &r, &g, &b);
+                    yl[j][cx * 2 + i] = (77 * r + 150 * g + 29 * b + 128) >> 8;
+                    sr += r;
+                    sg += g;
+                    sb += b;
+                }
+            }
+            jpeg_enc_obj->cb[cy * (sw / 2) + cx] = jpeg_enc_clamp(((-43 * sr - 85 * sg + 128 * sb + 512) >> 10) + 128);
+            jpeg_enc_obj->cr[cy * (sw / 2) + cx] = jpeg_enc_clamp(((128 * sr - 107 * sg - 21 * sb + 512) >> 10) + 128);
+        }
+    }
+}
+
+// Byte align with 1 bits, RSTn and a fresh DC prediction
+static void jpeg_enc_restart(int n)
+{
+    if (jpeg_enc_obj->bit_cnt) {
+        jpeg_enc_put_bits(0x7F, 8 - jpeg_enc_obj->bit_cnt);
+    }
+    jpeg_enc_put_byte(0xFF);
+    jpeg_enc_put_byte(0xD0 + (n & 7));
+    memset(jpeg_enc_obj->dc_pred, 0, sizeof(jpeg_enc_obj->dc_pred));
+}
+
+int jpeg_enc_frame(const uint8_t *frame)
+{
+    jpeg_enc_obj->out_len = 0;
+    jpeg_enc_obj->out_total = 0;
+    jpeg_enc_obj->error = 0;
+    jpeg_enc_obj->bits = 0;
+    jpeg_enc_obj->bit_cnt = 0;
+    memset(jpeg_enc_obj->dc_pred, 0, sizeof(jpeg_enc_obj->dc_pred));
+
+    jpeg_enc_headers();
+    int sw = jpeg_enc_obj->stripe_width;
+    int rows = (jpeg_enc_obj->out_high + JPEG_ENC_MCU - 1) / JPEG_ENC_MCU;
+    for (int mcu_y = 0; mcu_y < rows && !jpeg_enc_obj->error; mcu_y++) {
+        if (mcu_y && jpeg_enc_obj->config.restart_rows && mcu_y % jpeg_enc_obj->config.restart_rows == 0) {
+            jpeg_enc_restart(mcu_y / jpeg_enc_obj->config.restart_rows - 1);
+        }
+        jpeg_enc_stripe(frame, mcu_y);
+        for (int x = 0; x < sw; x += JPEG_ENC_MCU) {
+            jpeg_enc_block(jpeg_enc_obj->y + x, sw, 0);
+            jpeg_enc_block(jpeg_enc_obj->y + x + 8, sw, 0);
+            jpeg_enc_block(jpeg_enc_obj->y + 8 * sw + x, sw, 0);
+            jpeg_enc_block(jpeg_enc_obj->y + 8 * sw + x + 8, sw, 0);
+            jpeg_enc_block(jpeg_enc_obj->cb + x / 2, sw / 2, 1);
+            jpeg_enc_block(jpeg_enc_obj->cr + x / 2, sw / 2, 2);
+        }
+    }
+    // pad the last byte with 1 bits
+    if (jpeg_enc_obj->bit_cnt) {
+        jpeg_enc_put_bits(0x7F, 8 - jpeg_enc_obj->bit_cnt);
+    }
+    jpeg_enc_put_byte(0xFF);
+    jpeg_enc_put_byte(0xD9);
+    jpeg_enc_flush();
+    return jpeg_enc_obj->error ? -1 : jpeg_enc_obj->out_total;
+}
+
+static void jpeg_enc_quant_config(int quality)
+{
+    // IJG quality scaling
+    int scale = quality < 50 ? 5000 / quality : 200 - quality * 2;
+    const uint8_t *base[2] = {jpeg_enc_qt_luma, jpeg_enc_qt_chroma};
+    for (int t = 0; t < 2; t++) {
+        for (int k = 0; k < 64; k++) {
+            int n = jpeg_enc_zigzag[k];
+            int q = (base[t][n] * scale + 50) / 100;
+            q = q < 1 ? 1 : (q > 255 ? 255 : q);
+            jpeg_enc_obj->qt[t][k] = q;
+            jpeg_enc_obj->recip[t][n] = (65536 + 4 * q) / (8 * q);
+        }
+    }
+}
+
+void jpeg_enc_deinit(void)
+{
+    if (!jpeg_enc_obj) {
+        return;
+    }
+    heap_caps_free(jpeg_enc_obj->y);
+    heap_caps_free(jpeg_enc_obj->cb);
+    heap_caps_free(jpeg_enc_obj->cr);
+    heap_caps_free(jpeg_enc_obj->out);
+    free(jpeg_enc_obj);
+    jpeg_enc_obj = NULL;
+}
+
+int jpeg_enc_init(const jpeg_enc_config_t *config)
+{
+    int scale = config->scale ? config->scale : 1;
+    if (!config->write || config->quality > 100 || (scale != 1 && scale != 2 && scale != 4) ||
+        config->width / scale == 0 || config->high / scale == 0 ||
+        config->restart_rows * ((config->width / scale + JPEG_ENC_MCU - 1) / JPEG_ENC_MCU) > 0xFFFF) {
+        ESP_LOGE(TAG, "jpeg encoder config error\n");
+        return -1;
+    }
+    jpeg_enc_obj = (jpeg_enc_obj_t *)calloc(1, sizeof(jpeg_enc_obj_t));
+    if (!jpeg_enc_obj) {
+        ESP_LOGE(TAG, "jpeg encoder object malloc error\n");
+        return -1;
+    }
+    jpeg_enc_obj->config = *config;
+    jpeg_enc_obj->config.scale = scale;
+    jpeg_enc_obj->config.out_size = config->out_size ? config->out_size : 1024;
+    jpeg_enc_obj->out_width = config->width / scale;
+    jpeg_enc_obj->out_high = config->high / scale;
+    jpeg_enc_obj->stripe_width = (jpeg_enc_obj->out_width + JPEG_ENC_MCU - 1) & ~(JPEG_ENC_MCU - 1);
+
+    int sw = jpeg_enc_obj->stripe_width;
+    jpeg_enc_obj->y = (uint8_t *)heap_caps_malloc(JPEG_ENC_MCU * sw, MALLOC_CAP_INTERNAL);
+    jpeg_enc_obj->cb = (uint8_t *)heap_caps_malloc(JPEG_ENC_MCU / 2 * sw / 2, MALLOC_CAP_INTERNAL);
+    jpeg_enc_obj->cr = (uint8_t *)heap_caps_malloc(JPEG_ENC_MCU / 2 * sw / 2, MALLOC_CAP_INTERNAL);
+    jpeg_enc_obj->out = (uint8_t *)heap_caps_malloc(jpeg_enc_obj->config.out_size, MALLOC_CAP_INTERNAL);
+    if (!jpeg_enc_obj->y || !jpeg_enc_obj->cb || !jpeg_enc_obj->cr || !jpeg_enc_obj->out) {
+        ESP_LOGE(TAG, "jpeg encoder stripe malloc error\n");
+        jpeg_enc_deinit();
+        return -1;
+    }
+
+    jpeg_enc_quant_config(config->quality ? config->quality : 80);
+    jpeg_enc_huff_build(&jpeg_enc_obj->dc[0], jpeg_enc_dc_luma_bits, jpeg_enc_dc_vals);
+    jpeg_enc_huff_build(&jpeg_enc_obj->dc[1], jpeg_enc_dc_chroma_bits, jpeg_enc_dc_vals);
+    jpeg_enc_huff_build(&jpeg_enc_obj->ac[0], jpeg_enc_ac_luma_bits, jpeg_enc_ac_luma_vals);
+    jpeg_enc_huff_build(&jpeg_enc_obj->ac[1], jpeg_enc_ac_chroma_bits, jpeg_enc_ac_chroma_vals);
+    ESP_LOGI(TAG, "jpeg_enc: %dx%d, quality: %d, stripe: %d bytes\n", jpeg_enc_obj->out_width, jpeg_enc_obj->out_high,
+             config->quality ? config->quality : 80, JPEG_ENC_MCU * sw * 3 / 2);
+    return 0;
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <stdint.h>
+#include "cam.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Rate control of the OV2640 JPEG output. The sender reports every frame it sent with the time the socket took,
+// the controller keeps running averages of the frame size and of the link throughput while sending, and every
+// period steps the sensor quantization scale (QS) so that frames fit target_kbps / target_fps, or what the link
+// carried when that is less. Frames waiting in the camera pool mean the sender is behind, the budget then shrinks
+// until they are gone. JPEG size is about inversely proportional to QS, one step moves QS by at most a quarter.
+
+typedef struct {
+    uint32_t target_kbps;   // stream bitrate
+    uint8_t target_fps;     // 0: 15
+    uint8_t qs_min;         // best quality allowed, 0: 4
+    uint8_t qs_max;         // worst quality allowed, 0: 40
+    uint8_t qs_init;        // 0: 12, the OV2640 default
+    uint32_t period_ms;     // QS changes at most this often, a change shows a frame or two later, 0: 500
+} jpeg_rate_config_t;
+
+// Call after each frame was sent, before it is given back. send_us: the time the socket took for it
+void jpeg_rate_update(const cam_frame_t *frame, uint32_t send_us);
+
+int jpeg_rate_get_qs(void);
+
+// Average frame size in bytes and link throughput while sending in kbps
+void jpeg_rate_get_stats(uint32_t *frame_bytes, uint32_t *link_kbps);
+
+int jpeg_rate_init(const jpeg_rate_config_t *config);
+
+void jpeg_rate_deinit(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,122 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "cam.h"
+#include "ov2640.h"
+#include "jpeg_rate.h"
+
+static const char *TAG = "jpeg_rate";
+
+#define JPEG_RATE_LINK_USE   80  // percent of the measured link the stream may fill
+#define JPEG_RATE_DEADBAND   10  // percent off the frame budget that is left alone
+#define JPEG_RATE_SQUEEZE_MIN 25 // percent of the budget left after the pool keeps backing up
+
+typedef struct {
+    jpeg_rate_config_t config;
+    int qs;
+    int64_t period;
+    int64_t period_start;
+    uint32_t frame_avg;     // bytes, running average over about 4 frames
+    uint32_t link_kbps;     // throughput while sending, running average over about 4 frames
+    int squeeze;            // percent of the budget while frames wait in the pool
+} jpeg_rate_obj_t;
+
+static jpeg_rate_obj_t *jpeg_rate_obj = NULL;
+
+static void jpeg_rate_evaluate(int backlog)
+{
+    jpeg_rate_obj_t *r = jpeg_rate_obj;
+    if (backlog) {
+        // 发送跟不上采集，帧在 pool 中排队，每个周期继续压缩预算直到排空
+        r->squeeze = r->squeeze * 3 / 4 > JPEG_RATE_SQUEEZE_MIN ? r->squeeze * 3 / 4 : JPEG_RATE_SQUEEZE_MIN;
+    } else if (r->squeeze < 100) {
+        r->squeeze = r->squeeze + 10 < 100 ? r->squeeze + 10 : 100;
+    }
+    uint32_t kbps = r->config.target_kbps;
+    if (r->link_kbps && r->link_kbps * JPEG_RATE_LINK_USE / 100 < kbps) {
+        kbps = r->link_kbps * JPEG_RATE_LINK_USE / 100;
+    }
+    uint32_t budget = (uint64_t)kbps * 1000 / 8 * r->squeeze / 100 / r->config.target_fps;
+    if (budget == 0 || r->frame_avg == 0) {
+        return;
+    }
+    uint32_t diff = r->frame_avg > budget ? r->frame_avg - budget : budget - r->frame_avg;
+    if (diff * 100 <= budget * JPEG_RATE_DEADBAND) {
+        return;
+    }
+    // 帧大小约与 QS 成反比
+    int qs = (uint64_t)r->qs * r->frame_avg / budget;
+    int step = r->qs / 4 > 1 ? r->qs / 4 : 1;
+    qs = qs > r->qs + step ? r->qs + step : (qs < r->qs - step ? r->qs - step : qs);
+    qs = qs < r->config.qs_min ? r->config.qs_min : (qs > r->config.qs_max ? r->config.qs_max : qs);
+    if (qs != r->qs) {
+        ESP_LOGD(TAG, "qs: %d -> %d, frame: %u, budget: %u, link: %u kbps\n", r->qs, qs, r->frame_avg, budget, r->link_kbps);
+        r->qs = qs;
+        OV2640_JPEG_Quality_Set(qs);
+    }
+}
+
+void jpeg_rate_update(const cam_frame_t *frame, uint32_t send_us)
+{
+    jpeg_rate_obj_t *r = jpeg_rate_obj;
+    if (!r) {
+        return;
+    }
+    r->frame_avg = r->frame_avg ? r->frame_avg - r->frame_avg / 4 + frame->len / 4 : frame->len;
+    if (send_us) {
+        uint64_t kbps = (uint64_t)frame->len * 8000 / send_us;
+        kbps = kbps > 1000000 ? 1000000 : kbps; // the socket buffer took it all at once
+        r->link_kbps = r->link_kbps ? r->link_kbps - r->link_kbps / 4 + kbps / 4 : kbps;
+    }
+    int64_t now = esp_timer_get_time();
+    if (now - r->period_start >= r->period) {
+        r->period_start = now;
+        jpeg_rate_evaluate(cam_get_ready_cnt() > 0);
+    }
+}
+
+int jpeg_rate_get_qs(void)
+{
+    return jpeg_rate_obj ? jpeg_rate_obj->qs : 0;
+}
+
+void jpeg_rate_get_stats(uint32_t *frame_bytes, uint32_t *link_kbps)
+{
+    *frame_bytes = jpeg_rate_obj ? jpeg_rate_obj->frame_avg : 0;
+    *link_kbps = jpeg_rate_obj ? jpeg_rate_obj->link_kbps : 0;
+}
+
+void jpeg_rate_deinit(void)
+{
+    free(jpeg_rate_obj);
+    jpeg_rate_obj = NULL;
+}
+
+int jpeg_rate_init(const jpeg_rate_config_t *config)
+{
+    jpeg_rate_config_t c = *config;
+    c.target_fps = c.target_fps ? c.target_fps : 15;
+    c.qs_min = c.qs_min ? c.qs_min : 4;
+    c.qs_max = c.qs_max ? c.qs_max : 40;
+    c.qs_init = c.qs_init ? c.qs_init : 12;
+    c.period_ms = c.period_ms ? c.period_ms : 500;
+    if (c.target_kbps == 0 || c.qs_min > c.qs_max || c.qs_max > 63 || c.qs_init < c.qs_min || c.qs_init > c.qs_max) {
+        ESP_LOGE(TAG, "jpeg rate config error\n");
+        return -1;
+    }
+    jpeg_rate_deinit();
+    jpeg_rate_obj = (jpeg_rate_obj_t *)calloc(1, sizeof(jpeg_rate_obj_t));
+    if (!jpeg_rate_obj) {
+        ESP_LOGE(TAG, "jpeg rate object malloc error\n");
+        return -1;
+    }
+    jpeg_rate_obj->config = c;
+    jpeg_rate_obj->qs = c.qs_init;
+    jpeg_rate_obj->period = (int64_t)c.period_ms * 1000;
+    jpeg_rate_obj->period_start = esp_timer_get_time();
+    jpeg_rate_obj->squeeze = 100;
+    OV2640_JPEG_Quality_Set(c.qs_init);
+    ESP_LOGI(TAG, "target: %u kbps at %d fps, qs %d~%d\n", c.target_kbps, c.target_fps, c.qs_min, c.qs_max);
+    return 0;
+}
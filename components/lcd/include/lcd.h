@@ -0,0 +1,131 @@
+#pragma once
+
+#include "driver/gpio.h"
+#include "driver/spi_master.h"
+#include "pixel_rle.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Called from the SPI ISR once the last byte of an lcd_write_data_async call is sent
+typedef void (*lcd_done_cb_t)(void *arg);
+
+typedef struct {
+    uint16_t x_start;
+    uint16_t y_start;
+    uint16_t x_end;   // inclusive
+    uint16_t y_end;   // inclusive
+} lcd_rect_t;
+
+// A pre-rendered RGB565 (LCD order) layer drawn over everything sent inside its area
+typedef struct {
+    uint16_t x;              // panel coordinates, the same as lcd_set_index
+    uint16_t y;
+    uint16_t width;
+    uint16_t high;
+    const uint16_t *pixels;  // width * high
+    const uint8_t *mask;     // optional 1 bit alpha, MSB first, (width + 7) / 8 bytes per line
+    uint16_t key;            // without mask, pixels equal to key are transparent
+} lcd_overlay_t;
+
+typedef enum {
+    LCD_BUS_SPI = 0, // ST7789 4-wire SPI on HSPI
+    LCD_BUS_I2S,     // 8-bit 8080 parallel. S2: I2S0 LCD mode, one I2S so no camera at the same time.
+                     // S3: the LCD half of LCD_CAM, runs next to the camera
+} lcd_bus_t;
+
+typedef struct {
+    uint32_t clk_fre;  // SPI clock, or WR clock on LCD_BUS_I2S
+    uint8_t bus;       // lcd_bus_t
+    uint8_t pin_clk;
+    uint8_t pin_mosi;
+    uint8_t pin_wr;      // LCD_BUS_I2S
+    uint8_t pin_data[8]; // LCD_BUS_I2S, D0 ~ D7
+    uint8_t pin_dc;
+    uint8_t pin_cs;
+    uint8_t pin_rst;
+    uint8_t pin_bk;
+    uint8_t horizontal;       // orientation at init, see lcd_set_rotation
+    uint32_t max_buffer_size; // DMA used, also the bounce buffer size
+    uint8_t bounce;           // LCD_BUS_SPI: send PSRAM and flash-mapped data through two internal max_buffer_size bounce buffers
+    lcd_done_cb_t done_cb;    // optional, async write completion
+    void *done_arg;
+    uint8_t te_enable;        // start full frame writes on the panel's TE (vertical blanking) edge
+    uint8_t pin_te;           // te_enable: GPIO wired to the panel TE output
+    uint8_t te_divisor;       // te_enable: present on every Nth refresh (60Hz / N), a late frame waits for the next slot, 0/1: every refresh
+} lcd_config_t;
+
+void lcd_rst();
+
+// With te_enable, data starting a window of at least 240x240 pixels (a full frame) waits for the TE edge of the
+// next presentation slot, so the write runs ahead of the panel scan and does not tear. Partial updates are not gated
+void lcd_write_data(uint8_t *data, size_t len);
+
+// Queue the data and return, it must stay valid until lcd_wait_done returns or done_cb fires
+void lcd_write_data_async(uint8_t *data, size_t len);
+
+// Block until every queued transaction is sent
+void lcd_wait_done(void);
+
+void lcd_set_index(uint16_t x_start, uint16_t y_start, uint16_t x_end, uint16_t y_end);
+
+// Orientation by the panel's MADCTL, free of any pixel work: 0 ~ 3 as lcd_config_t.horizontal, mirror flips
+// the picture left to right. The command is queued behind the pixels in flight and takes effect from the
+// next lcd_set_index, call it between frames. Mirroring a camera preview here instead of in the sensor
+// keeps the captured frames unmirrored
+void lcd_set_rotation(uint8_t rotation, uint8_t mirror);
+
+// Record a changed region, overlapping and touching regions are merged
+void lcd_mark_dirty(uint16_t x_start, uint16_t y_start, uint16_t x_end, uint16_t y_end);
+
+// Send only the dirty regions of an RGB565 frame that is width pixels wide, then clear them
+void lcd_flush_dirty(uint8_t *frame, uint16_t width);
+
+// 8 bit indexed color: each write expands the indexes through a 256 entry palette into the bounce buffers
+// chunk by chunk as they are sent, the frame stays one byte per pixel (75 KB at 320x240) and the data can be
+// reused once the call returns. LCD_BUS_SPI with bounce only.
+// A palette change applies to the chunks expanded after it, change it between frames to animate colors
+int lcd_set_palette(const uint16_t *colors, int first, int cnt); // LCD order RGB565
+
+void lcd_write_indexed(const uint8_t *data, size_t cnt);
+
+void lcd_write_indexed_async(const uint8_t *data, size_t cnt);
+
+// lcd_flush_dirty for an indexed frame
+void lcd_flush_dirty_indexed(const uint8_t *frame, uint16_t width);
+
+// Pixel doubled RGB565 (LCD order): a width x high frame goes out as 2 * width x 2 * high, each source line is
+// widened into the bounce buffers and sent twice, set the window of the doubled size with lcd_set_index first.
+// A camera can then capture a quarter of the pixels, which is a quarter of the PSRAM writes and reads.
+// width * 8 must fit max_buffer_size. LCD_BUS_SPI with bounce only
+void lcd_write_scaled2x(const uint8_t *data, uint16_t width, uint16_t high);
+
+void lcd_write_scaled2x_async(const uint8_t *data, uint16_t width, uint16_t high);
+
+// Run-length compressed static layer (pixel_rle.h): the area is decoded into the bounce buffers chunk by chunk
+// as it is sent and the overlays are composited on top, so a static screen costs its compressed size in RAM
+// and the dynamic parts go in as overlays. LCD_BUS_SPI with bounce only.
+// lcd_write_rle sends the area (layer coordinates, inclusive) into the window set by lcd_set_index
+void lcd_write_rle(const pixel_rle_t *rle, uint16_t x_start, uint16_t y_start, uint16_t x_end, uint16_t y_end);
+
+// lcd_flush_dirty for a compressed full screen layer
+void lcd_flush_dirty_rle(const pixel_rle_t *rle);
+
+// Composite up to 8 layers into every later pixel write, only the pixels they cover cost time.
+// Layers are copied, their pixels and mask must stay valid, cnt 0 removes them.
+// PSRAM and flash-mapped data is composited in the bounce buffers, internal data in place; LCD_BUS_SPI only
+int lcd_set_overlay(const lcd_overlay_t *overlay, int cnt);
+
+int lcd_init(lcd_config_t *config);
+
+// TE edges since lcd_init and full frames that missed their presentation slot, 0 without te_enable
+void lcd_get_te_stats(uint32_t *edges, uint32_t *late);
+
+// media_clock_now() when the last full frame started to show: its TE edge with te_enable, the start of its
+// data otherwise. 0 before the first full frame
+int64_t lcd_get_present_time(void);
+
+#ifdef __cplusplus
+}
+#endif
\ No newline at end of file
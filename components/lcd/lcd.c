@@ -0,0 +1,968 @@
+
+#include <stdio.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "soc/soc_memory_layout.h"
+#include "soc/gpio_struct.h"
+#include "lcd.h"
+#include "lcd_i2s.h"
+#include "trace.h"
+#include "mem_place.h"
+#include "media_clock.h"
+
+static const char *TAG = "lcd";
+
+#define LCD_TRANS_MAX   (8)   // SPI transactions in flight
+#define LCD_TRANS_DC    (0x1)
+#define LCD_TRANS_DONE  (0x2) // last transaction of an lcd_write_data_async call
+#define LCD_DIRTY_MAX   (8)   // dirty rectangles tracked before they are folded together
+#define LCD_OVERLAY_MAX (8)
+#define LCD_TE_MIN_SIZE (240) // windows at least this wide and high are full frames, gated on TE
+#define LCD_TE_TIMEOUT  (100) // ms, a missing TE signal must not stop the output
+#define LCD_ROW_OFFSET  (80)  // 320 line frame memory, 240 line glass
+
+#if CONFIG_IDF_TARGET_ESP32S3
+#define LCD_SPI_HOST     SPI3_HOST
+#define LCD_SPI_DMA_CHAN SPI_DMA_CH_AUTO // the S3 SPI DMA is a GDMA channel
+#else
+#define LCD_SPI_HOST     HSPI_HOST
+#define LCD_SPI_DMA_CHAN HSPI_HOST
+#endif
+
+typedef struct {
+    spi_device_handle_t spi;
+    uint8_t bus;
+    uint8_t horizontal;
+    uint16_t x_offset;     // frame memory offset of the window, follows MADCTL
+    uint16_t y_offset;
+    uint32_t buffer_size; // DMA used
+    uint8_t dc_state;
+    spi_transaction_t trans[LCD_TRANS_MAX];
+    uint8_t trans_head;    // next transaction to queue
+    uint8_t trans_pending; // queued transactions not reclaimed yet
+    uint32_t trans_queued;
+    uint32_t trans_done;
+    uint8_t *bounce[2];     // internal DMA copies of PSRAM data, one fills while the other is sent
+    uint32_t bounce_seq[2]; // trans_queued of the transaction still reading each bounce buffer
+    uint8_t bounce_idx;
+    uint16_t palette[256];  // 8 bit indexed writes, LCD order
+    lcd_done_cb_t done_cb;
+    void *done_arg;
+    lcd_rect_t dirty[LCD_DIRTY_MAX];
+    uint8_t dirty_cnt;
+    lcd_rect_t window;      // last lcd_set_index
+    uint32_t window_offset; // pixel data bytes queued since then
+    lcd_overlay_t overlay[LCD_OVERLAY_MAX];
+    uint8_t overlay_cnt;
+    uint8_t pin_dc;
+    volatile uint32_t *dc_w1ts; // set and clear registers of the bank pin_dc is in
+    volatile uint32_t *dc_w1tc;
+    uint32_t dc_mask;
+    uint8_t pin_cs;
+    uint8_t pin_rst;
+    uint8_t pin_bk;
+    uint8_t pin_te;
+    uint8_t te_divisor;
+    SemaphoreHandle_t te_sem; // given on every TE edge, NULL: no TE gating
+    volatile uint32_t te_count;
+    uint32_t te_present;    // te_count of the last presentation
+    uint8_t te_started;     // te_present is set
+    uint32_t te_late;
+    int64_t te_time;        // media_clock_now() of the last TE edge
+    int64_t present_time;   // the last full frame started to show
+} lcd_obj_t;
+
+static lcd_obj_t *lcd_obj = NULL;
+static portMUX_TYPE lcd_te_lock = portMUX_INITIALIZER_UNLOCKED; // te_time from the TE ISR, 64 bit
+
+void inline lcd_set_rst(uint8_t state)
+{
+    gpio_set_level(lcd_obj->pin_rst, state);
+}
+
+void inline lcd_set_dc(uint8_t state)
+{
+    *(state ? lcd_obj->dc_w1ts : lcd_obj->dc_w1tc) = lcd_obj->dc_mask;
+}
+
+void inline lcd_set_cs(uint8_t state)
+{
+    gpio_set_level(lcd_obj->pin_cs, state);
+}
+
+void inline lcd_set_blk(uint8_t state)
+{
+    gpio_set_level(lcd_obj->pin_bk, state);
+}
+
+// D/C travels with each transaction, commands may be queued behind data still in flight
+// Runs before every transaction, so no call into gpio_set_level: one store to a precomputed register
+static void IRAM_ATTR spi_pre_transfer_callback(spi_transaction_t *t)
+{
+    *(((int)t->user & LCD_TRANS_DC) ? lcd_obj->dc_w1ts : lcd_obj->dc_w1tc) = lcd_obj->dc_mask;
+}
+
+static void IRAM_ATTR spi_post_transfer_callback(spi_transaction_t *t)
+{
+    if (((int)t->user & LCD_TRANS_DONE) && lcd_obj->done_cb) {
+        lcd_obj->done_cb(lcd_obj->done_arg);
+    }
+}
+
+static void IRAM_ATTR lcd_te_isr(void *arg)
+{
+    BaseType_t HPTaskAwoken = pdFALSE;
+    int64_t now = media_clock_now();
+    portENTER_CRITICAL_ISR(&lcd_te_lock);
+    lcd_obj->te_time = now;
+    portEXIT_CRITICAL_ISR(&lcd_te_lock);
+    lcd_obj->te_count++;
+    xSemaphoreGiveFromISR(lcd_obj->te_sem, &HPTaskAwoken);
+
+    if(HPTaskAwoken == pdTRUE) {
+        portYIELD_FROM_ISR();
+    }
+}
+
+// Wait for the TE edge of the next presentation slot, te_divisor refreshes after the last one.
+// A late frame takes the next slot on the same cadence, so the output rate stays refresh / te_divisor
+static void lcd_te_wait(void)
+{
+    uint32_t target = lcd_obj->te_present + lcd_obj->te_divisor;
+    if (!lcd_obj->te_started) {
+        target = lcd_obj->te_count + 1; // the first frame sets the cadence
+        lcd_obj->te_started = 1;
+    } else if ((int32_t)(lcd_obj->te_count - target) >= 0) {
+        lcd_obj->te_late++;
+        target += ((lcd_obj->te_count - target) / lcd_obj->te_divisor + 1) * lcd_obj->te_divisor;
+    }
+    xSemaphoreTake(lcd_obj->te_sem, 0); // an edge given before the wait started
+    while ((int32_t)(lcd_obj->te_count - target) < 0) {
+        if (xSemaphoreTake(lcd_obj->te_sem, LCD_TE_TIMEOUT / portTICK_RATE_MS) != pdTRUE) {
+            ESP_LOGE(TAG, "no TE signal\n");
+            lcd_obj->present_time = media_clock_now();
+            lcd_obj->te_present = lcd_obj->te_count;
+            return;
+        }
+    }
+    lcd_obj->te_present = lcd_obj->te_count;
+    portENTER_CRITICAL(&lcd_te_lock);
+    lcd_obj->present_time = lcd_obj->te_time;
+    portEXIT_CRITICAL(&lcd_te_lock);
+}
+
+// Data starting a full frame window waits for vertical blanking. Without TE the frame shows as it is sent
+static void lcd_te_gate(void)
+{
+    if (lcd_obj->window_offset == 0 &&
+        lcd_obj->window.x_end - lcd_obj->window.x_start + 1 >= LCD_TE_MIN_SIZE &&
+        lcd_obj->window.y_end - lcd_obj->window.y_start + 1 >= LCD_TE_MIN_SIZE) {
+        if (lcd_obj->te_sem) {
+            lcd_te_wait();
+        } else {
+            lcd_obj->present_time = media_clock_now();
+        }
+    }
+}
+
+static void spi_reclaim(void)
+{
+    spi_transaction_t *rtrans;
+    spi_device_get_trans_result(lcd_obj->spi, &rtrans, portMAX_DELAY);
+    lcd_obj->trans_pending--;
+    lcd_obj->trans_done++;
+}
+
+// Next bounce buffer, once the SPI is done reading it. The caller fills it and queues it right away
+static uint8_t *spi_bounce_get(void)
+{
+    int idx = lcd_obj->bounce_idx;
+    lcd_obj->bounce_idx = !idx;
+    while (lcd_obj->trans_pending && (int32_t)(lcd_obj->trans_done - lcd_obj->bounce_seq[idx]) < 0) {
+        spi_reclaim();
+    }
+    lcd_obj->bounce_seq[idx] = lcd_obj->trans_queued + 1;
+    return lcd_obj->bounce[idx];
+}
+
+// Copy a PSRAM chunk into the next bounce buffer
+static uint8_t *spi_bounce(uint8_t *data, size_t size)
+{
+    uint8_t *buf = spi_bounce_get();
+    memcpy(buf, data, size);
+    return buf;
+}
+
+// Indexed pixels through the palette, two pixels per store, four indexes per load when aligned
+static void lcd_palette_expand(uint16_t *dst, const uint8_t *src, size_t cnt)
+{
+    const uint16_t *palette = lcd_obj->palette;
+    uint32_t *dst32 = (uint32_t *)dst; // bounce buffers are word aligned
+    size_t x = 0;
+    if (!((uint32_t)src & 0x3)) {
+        const uint32_t *src32 = (const uint32_t *)src;
+        for (; x + 4 <= cnt; x += 4) {
+            uint32_t w = *src32++;
+            *dst32++ = palette[w & 0xff] | ((uint32_t)palette[(w >> 8) & 0xff] << 16);
+            *dst32++ = palette[(w >> 16) & 0xff] | ((uint32_t)palette[w >> 24] << 16);
+        }
+    }
+    for (; x < cnt; x++) {
+        dst[x] = palette[src[x]];
+    }
+}
+
+// Draw the overlay layers over the part of the current window that one chunk covers
+static void lcd_overlay_apply(uint8_t *buf, size_t size)
+{
+    int width = lcd_obj->window.x_end - lcd_obj->window.x_start + 1;
+    int high = lcd_obj->window.y_end - lcd_obj->window.y_start + 1;
+    int start = lcd_obj->window_offset / 2; // first pixel of the chunk in the window
+    int end = start + size / 2;
+    uint16_t *pixels = (uint16_t *)buf;
+    for (int i = 0; i < lcd_obj->overlay_cnt; i++) {
+        const lcd_overlay_t *layer = &lcd_obj->overlay[i];
+        int lx = layer->x - lcd_obj->window.x_start; // layer origin in window coordinates
+        int ly = layer->y - lcd_obj->window.y_start;
+        int y0 = ly > start / width ? ly : start / width;
+        int y1 = ly + layer->high - 1;
+        y1 = y1 < (end - 1) / width ? y1 : (end - 1) / width;
+        y1 = y1 < high - 1 ? y1 : high - 1;
+        for (int y = y0; y <= y1; y++) {
+            int row = y * width;
+            int x0 = lx > 0 ? lx : 0;
+            int x1 = lx + layer->width < width ? lx + layer->width : width; // exclusive
+            x0 = row + x0 < start ? start - row : x0;
+            x1 = row + x1 > end ? end - row : x1;
+            if (x0 >= x1) {
+                continue;
+            }
+            uint16_t *dst = pixels + row + x0 - start;
+            const uint16_t *src = layer->pixels + (y - ly) * layer->width + (x0 - lx);
+            if (layer->mask) {
+                const uint8_t *mask = layer->mask + (y - ly) * ((layer->width + 7) / 8);
+                for (int x = x0 - lx; x < x1 - lx; x++, dst++, src++) {
+                    if (mask[x >> 3] & (0x80 >> (x & 0x7))) {
+                        *dst = *src;
+                    }
+                }
+            } else {
+                for (int x = x0; x < x1; x++, dst++, src++) {
+                    if (*src != layer->key) {
+                        *dst = *src;
+                    }
+                }
+            }
+        }
+    }
+}
+
+// Queue one transaction of at most buffer_size bytes, only blocks when all slots are in flight
+static void spi_queue_chunk(uint8_t *tx, size_t size, int flags)
+{
+    if (lcd_obj->trans_pending == LCD_TRANS_MAX) {
+        spi_reclaim(); // frees the oldest slot, which is trans_head
+    }
+    spi_transaction_t *t = &lcd_obj->trans[lcd_obj->trans_head];
+    lcd_obj->trans_head = (lcd_obj->trans_head + 1) % LCD_TRANS_MAX;
+    memset(t, 0, sizeof(spi_transaction_t));
+    t->length = 8 * size;
+    t->tx_buffer = tx;
+    // 叠加层在数据进入 DMA 前合成，PSRAM 帧和 flash 中的图片在 bounce buffer 中合成，不修改原数据
+    if (lcd_obj->overlay_cnt && (flags & LCD_TRANS_DC) && esp_ptr_dma_capable(tx)) {
+        lcd_overlay_apply(tx, size);
+    }
+    lcd_obj->window_offset += size;
+    t->user = (void *)flags;
+    spi_device_queue_trans(lcd_obj->spi, t, portMAX_DELAY);
+    lcd_obj->trans_pending++;
+    lcd_obj->trans_queued++;
+}
+
+// Split data into buffer_size transactions and queue them
+static void spi_queue_data(uint8_t *data, size_t len, int flags)
+{
+    if (lcd_obj->bus == LCD_BUS_I2S) {
+        lcd_i2s_write(data, len, flags & LCD_TRANS_DC, flags & LCD_TRANS_DONE);
+        return;
+    }
+    while (len > 0) {
+        size_t size = len > lcd_obj->buffer_size ? lcd_obj->buffer_size : len;
+        // PSRAM and memory-mapped flash (const images, assets partitions) are out of reach of the SPI DMA
+        uint8_t *tx = (lcd_obj->bounce[0] && !esp_ptr_dma_capable(data)) ? spi_bounce(data, size) : data;
+        spi_queue_chunk(tx, size, (len == size) ? flags : (flags & ~LCD_TRANS_DONE));
+        data += size;
+        len -= size;
+    }
+}
+
+// Decode an area of a compressed layer into the bounce buffers and queue it, lines may span chunks
+static void spi_queue_rle(const pixel_rle_t *rle, const lcd_rect_t *area, int flags)
+{
+    size_t max = lcd_obj->buffer_size / 2;
+    int width = area->x_end - area->x_start + 1;
+    int x = 0, y = area->y_start;
+    size_t left = width * (area->y_end - area->y_start + 1);
+    while (left > 0) {
+        size_t n = left > max ? max : left;
+        uint16_t *buf = (uint16_t *)spi_bounce_get();
+        for (size_t i = 0; i < n;) {
+            int seg = width - x < n - i ? width - x : n - i;
+            pixel_rle_decode(rle, y, area->x_start + x, seg, buf + i);
+            i += seg;
+            x += seg;
+            if (x == width) {
+                x = 0;
+                y++;
+            }
+        }
+        spi_queue_chunk((uint8_t *)buf, n * 2, (left == n) ? flags : (flags & ~LCD_TRANS_DONE));
+        left -= n;
+    }
+}
+
+// Expand cnt indexed pixels into the bounce buffers half a buffer_size of pixels at a time and queue them,
+// the expansion of the next chunk runs while the previous one is sent
+static void spi_queue_indexed(const uint8_t *data, size_t cnt, int flags)
+{
+    size_t max = lcd_obj->buffer_size / 2;
+    while (cnt > 0) {
+        size_t n = cnt > max ? max : cnt;
+        uint8_t *buf = spi_bounce_get();
+        lcd_palette_expand((uint16_t *)buf, data, n);
+        spi_queue_chunk(buf, n * 2, (cnt == n) ? flags : (flags & ~LCD_TRANS_DONE));
+        data += n;
+        cnt -= n;
+    }
+}
+
+// Double an RGB565 frame of width x high into the bounce buffers, each source line becomes two lines of twice the
+// pixels. Whole line pairs go into a chunk, the next chunk is scaled while the previous one is sent
+static void spi_queue_scaled2x(const uint8_t *data, uint16_t width, uint16_t high, int flags)
+{
+    size_t pair = width * 8; // bytes of the two output lines of one source line
+    int lines = lcd_obj->buffer_size / pair;
+    const uint16_t *src = (const uint16_t *)data;
+    while (high > 0) {
+        int n = high > lines ? lines : high;
+        uint8_t *buf = spi_bounce_get();
+        uint32_t *dst32 = (uint32_t *)buf; // bounce buffers are word aligned
+        for (int y = 0; y < n; y++) {
+            uint32_t *line = dst32;
+            for (int x = 0; x < width; x++) {
+                uint32_t p = *src++;
+                *dst32++ = p | (p << 16);
+            }
+            memcpy(dst32, line, width * 4);
+            dst32 += width;
+        }
+        spi_queue_chunk(buf, n * pair, (high == n) ? flags : (flags & ~LCD_TRANS_DONE));
+        high -= n;
+    }
+}
+
+void lcd_wait_done(void)
+{
+    if (lcd_obj->bus == LCD_BUS_I2S) {
+        lcd_i2s_wait_done();
+        return;
+    }
+    while (lcd_obj->trans_pending) {
+        spi_reclaim();
+    }
+}
+
+static void spi_write_data(uint8_t *data, size_t len)
+{
+    if (len <= 0) {
+        return;
+    }
+    TRACE_BEGIN("spi_write_data");
+    spi_queue_data(data, len, lcd_obj->dc_state ? LCD_TRANS_DC : 0);
+    lcd_wait_done();
+    TRACE_END("spi_write_data");
+}
+
+
+static void lcd_delay_ms(uint32_t time)
+{
+    vTaskDelay(time / portTICK_RATE_MS);
+}
+
+static void lcd_write_cmd(uint8_t data)
+{
+    lcd_obj->dc_state = 0;
+    spi_write_data(&data, 1);
+}
+
+static void lcd_write_byte(uint8_t data)
+{
+    lcd_obj->dc_state = 1;
+    spi_write_data(&data, 1);
+}
+
+void lcd_write_data(uint8_t *data, size_t len)
+{
+    if (len <= 0) {
+        return;
+    }
+    lcd_obj->dc_state = 1;
+    lcd_te_gate();
+    mem_place_bw_io(MEM_PLACE_BW_LCD, data, len);
+    spi_write_data(data, len);
+}
+
+void lcd_write_data_async(uint8_t *data, size_t len)
+{
+    if (len <= 0) {
+        return;
+    }
+    lcd_obj->dc_state = 1;
+    lcd_te_gate();
+    mem_place_bw_io(MEM_PLACE_BW_LCD, data, len);
+#if CONFIG_LCD_ASYNC
+    spi_queue_data(data, len, LCD_TRANS_DC | LCD_TRANS_DONE);
+#else
+    spi_write_data(data, len);
+    if (lcd_obj->done_cb) {
+        lcd_obj->done_cb(lcd_obj->done_arg);
+    }
+#endif
+}
+
+static int lcd_bounce_check(void)
+{
+    if (lcd_obj->bus != LCD_BUS_SPI || !lcd_obj->bounce[0]) {
+        ESP_LOGE(TAG, "indexed, scaled and rle writes need LCD_BUS_SPI with bounce buffers\n");
+        return -1;
+    }
+    return 0;
+}
+
+int lcd_set_palette(const uint16_t *colors, int first, int cnt)
+{
+    if (first < 0 || cnt < 0 || first + cnt > 256) {
+        ESP_LOGE(TAG, "palette range error\n");
+        return -1;
+    }
+    memcpy(&lcd_obj->palette[first], colors, cnt * sizeof(uint16_t));
+    return 0;
+}
+
+void lcd_write_indexed(const uint8_t *data, size_t cnt)
+{
+    if (cnt <= 0 || lcd_bounce_check() != 0) {
+        return;
+    }
+    lcd_obj->dc_state = 1;
+    lcd_te_gate();
+    TRACE_BEGIN("spi_write_indexed");
+    spi_queue_indexed(data, cnt, LCD_TRANS_DC);
+    lcd_wait_done();
+    TRACE_END("spi_write_indexed");
+}
+
+void lcd_write_indexed_async(const uint8_t *data, size_t cnt)
+{
+    if (cnt <= 0 || lcd_bounce_check() != 0) {
+        return;
+    }
+    lcd_obj->dc_state = 1;
+    lcd_te_gate();
+#if CONFIG_LCD_ASYNC
+    spi_queue_indexed(data, cnt, LCD_TRANS_DC | LCD_TRANS_DONE);
+#else
+    spi_queue_indexed(data, cnt, LCD_TRANS_DC);
+    lcd_wait_done();
+    if (lcd_obj->done_cb) {
+        lcd_obj->done_cb(lcd_obj->done_arg);
+    }
+#endif
+}
+
+static int lcd_scaled2x_check(uint16_t width, uint16_t high)
+{
+    if (lcd_bounce_check() != 0) {
+        return -1;
+    }
+    if (width == 0 || high == 0 || width * 8 > lcd_obj->buffer_size) {
+        ESP_LOGE(TAG, "scaled frame of %d x %d error\n", width, high);
+        return -1;
+    }
+    return 0;
+}
+
+void lcd_write_scaled2x(const uint8_t *data, uint16_t width, uint16_t high)
+{
+    if (lcd_scaled2x_check(width, high) != 0) {
+        return;
+    }
+    lcd_obj->dc_state = 1;
+    lcd_te_gate();
+    TRACE_BEGIN("spi_write_scaled2x");
+    spi_queue_scaled2x(data, width, high, LCD_TRANS_DC);
+    lcd_wait_done();
+    TRACE_END("spi_write_scaled2x");
+}
+
+void lcd_write_scaled2x_async(const uint8_t *data, uint16_t width, uint16_t high)
+{
+    if (lcd_scaled2x_check(width, high) != 0) {
+        return;
+    }
+    lcd_obj->dc_state = 1;
+    lcd_te_gate();
+#if CONFIG_LCD_ASYNC
+    spi_queue_scaled2x(data, width, high, LCD_TRANS_DC | LCD_TRANS_DONE);
+#else
+    spi_queue_scaled2x(data, width, high, LCD_TRANS_DC);
+    lcd_wait_done();
+    if (lcd_obj->done_cb) {
+        lcd_obj->done_cb(lcd_obj->done_arg);
+    }
+#endif
+}
+
+void lcd_write_rle(const pixel_rle_t *rle, uint16_t x_start, uint16_t y_start, uint16_t x_end, uint16_t y_end)
+{
+    lcd_rect_t area = {x_start, y_start, x_end, y_end};
+    if (lcd_bounce_check() != 0 || x_start > x_end || y_start > y_end || x_end >= rle->width || y_end >= rle->high) {
+        return;
+    }
+    lcd_obj->dc_state = 1;
+    lcd_te_gate();
+    TRACE_BEGIN("spi_write_rle");
+    spi_queue_rle(rle, &area, LCD_TRANS_DC);
+    lcd_wait_done();
+    TRACE_END("spi_write_rle");
+}
+
+void lcd_rst()
+{
+    lcd_set_rst(0);
+    lcd_delay_ms(100);
+    lcd_set_rst(1);
+    lcd_delay_ms(100);
+}
+
+// MADCTL of the four orientations: 0: 0x00, 1: MY MX, 2: MX MV ML, 3: MY MV
+static const uint8_t lcd_madctl[4] = {0x00, 0xC0, 0x70, 0xA0};
+
+// MADCTL for an orientation, also sets the window offsets lcd_set_index applies from then on.
+// The 240 line glass sits at the top of the 320 line frame memory, so whenever MY counts the memory rows
+// from the bottom, the rows (columns once MV swaps them) start LCD_ROW_OFFSET further in
+static uint8_t lcd_rotation_config(uint8_t rotation, uint8_t mirror)
+{
+    uint8_t madctl = lcd_madctl[rotation & 0x3];
+    if (mirror) {
+        madctl ^= (madctl & 0x20) ? 0x80 : 0x40; // flip what is horizontal on the screen: MY once MV, else MX
+    }
+    uint16_t offset = (madctl & 0x80) ? LCD_ROW_OFFSET : 0;
+    lcd_obj->x_offset = (madctl & 0x20) ? offset : 0;
+    lcd_obj->y_offset = (madctl & 0x20) ? 0 : offset;
+    lcd_obj->horizontal = rotation & 0x3;
+    return madctl;
+}
+
+static void lcd_st7789_config(lcd_config_t *config)
+{
+    lcd_set_cs(0);
+
+    lcd_write_cmd(0x36); // MADCTL (36h): Memory Data Access Control
+    lcd_write_byte(lcd_rotation_config(config->horizontal, 0));
+
+    lcd_write_cmd(0x3A);  // COLMOD (3Ah): Interface Pixel Format 
+    lcd_write_byte(0x05);
+
+    lcd_write_cmd(0xB2); // PORCTRL (B2h): Porch Setting 
+    lcd_write_byte(0x0C);
+    lcd_write_byte(0x0C);
+    lcd_write_byte(0x00);
+    lcd_write_byte(0x33);
+    lcd_write_byte(0x33); 
+
+    lcd_write_cmd(0xB7); // GCTRL (B7h): Gate Control 
+    lcd_write_byte(0x35);  
+
+    lcd_write_cmd(0xBB); // VCOMS (BBh): VCOM Setting 
+    lcd_write_byte(0x19);
+
+    lcd_write_cmd(0xC0); // LCMCTRL (C0h): LCM Control 
+    lcd_write_byte(0x2C);
+
+    lcd_write_cmd(0xC2); // VDVVRHEN (C2h): VDV and VRH Command Enable
+    lcd_write_byte(0x01);
+
+    lcd_write_cmd(0xC3); // VRHS (C3h): VRH Set
+    lcd_write_byte(0x12);   
+
+    lcd_write_cmd(0xC4); // VDVS (C4h): VDV Set 
+    lcd_write_byte(0x20);  
+
+    lcd_write_cmd(0xC6); // FRCTRL2 (C6h): Frame Rate Control in Normal Mode 
+    lcd_write_byte(0x0F);    
+
+    lcd_write_cmd(0xD0); // PWCTRL1 (D0h): Power Control 1 
+    lcd_write_byte(0xA4);
+    lcd_write_byte(0xA1);
+
+    lcd_write_cmd(0xE0); // PVGAMCTRL (E0h): Positive Voltage Gamma Control
+    lcd_write_byte(0xD0);
+    lcd_write_byte(0x04);
+    lcd_write_byte(0x0D);
+    lcd_write_byte(0x11);
+    lcd_write_byte(0x13);
+    lcd_write_byte(0x2B);
+    lcd_write_byte(0x3F);
+    lcd_write_byte(0x54);
+    lcd_write_byte(0x4C);
+    lcd_write_byte(0x18);
+    lcd_write_byte(0x0D);
+    lcd_write_byte(0x0B);
+    lcd_write_byte(0x1F);
+    lcd_write_byte(0x23);
+
+    lcd_write_cmd(0xE1); // NVGAMCTRL (E1h): Negative Voltage Gamma Control
+    lcd_write_byte(0xD0);
+    lcd_write_byte(0x04);
+    lcd_write_byte(0x0C);
+    lcd_write_byte(0x11);
+    lcd_write_byte(0x13);
+    lcd_write_byte(0x2C);
+    lcd_write_byte(0x3F);
+    lcd_write_byte(0x44);
+    lcd_write_byte(0x51);
+    lcd_write_byte(0x2F);
+    lcd_write_byte(0x1F);
+    lcd_write_byte(0x1F);
+    lcd_write_byte(0x20);
+    lcd_write_byte(0x23);
+
+    lcd_write_cmd(0x20); // INVON (21h): Display Inversion On
+
+    if (config->te_enable) {
+        lcd_write_cmd(0x35); // TEON (35h): Tearing Effect Line On
+        lcd_write_byte(0x00); // V-Blanking information only
+    }
+
+    lcd_write_cmd(0x11); // SLPOUT (11h): Sleep Out 
+
+    lcd_write_cmd(0x29); // DISPON (29h): Display On
+}
+
+int lcd_init(lcd_config_t *config)
+{
+    lcd_obj = (lcd_obj_t *)heap_caps_calloc(1, sizeof(lcd_obj_t), MALLOC_CAP_DMA);
+    if (!lcd_obj) {
+        ESP_LOGI(TAG, "lcd object malloc error\n");
+        return -1;
+    }
+    esp_err_t ret;
+    spi_bus_config_t buscfg = {
+        .miso_io_num = -1,
+        .mosi_io_num = config->pin_mosi,
+        .sclk_io_num = config->pin_clk,
+        .quadwp_io_num = -1,
+        .quadhd_io_num = -1,
+        .max_transfer_sz = config->max_buffer_size
+    };
+    spi_device_interface_config_t devcfg = {
+        .clock_speed_hz = config->clk_fre,           //Clock out at 10 MHz
+        .mode = 0,                                //SPI mode 0
+        .spics_io_num = -1,                       //CS pin
+        .queue_size = LCD_TRANS_MAX,              //Keep a whole frame of transactions in flight
+        .pre_cb = spi_pre_transfer_callback,  //Specify pre-transfer callback to handle D/C line
+        .post_cb = spi_post_transfer_callback, //Signal the end of an async write
+        .flags = SPI_DEVICE_HALFDUPLEX
+    };
+
+    lcd_obj->bus = config->bus;
+    if (lcd_obj->bus == LCD_BUS_I2S) {
+        if (lcd_i2s_init(config) != 0) {
+            return -1;
+        }
+    } else {
+        //Initialize the SPI bus
+        ret=spi_bus_initialize(LCD_SPI_HOST, &buscfg, LCD_SPI_DMA_CHAN);
+        ESP_ERROR_CHECK(ret);
+        //Attach the LCD to the SPI bus
+        ret=spi_bus_add_device(LCD_SPI_HOST, &devcfg, &lcd_obj->spi);
+        ESP_ERROR_CHECK(ret);
+        if (config->bounce) {
+            lcd_obj->bounce[0] = (uint8_t *)heap_caps_malloc(config->max_buffer_size, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+            lcd_obj->bounce[1] = (uint8_t *)heap_caps_malloc(config->max_buffer_size, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+            if (!lcd_obj->bounce[0] || !lcd_obj->bounce[1]) {
+                ESP_LOGE(TAG, "lcd bounce buffer malloc error\n");
+                return -1;
+            }
+        }
+    }
+
+    lcd_obj->buffer_size = config->max_buffer_size;
+    lcd_obj->horizontal = config->horizontal;
+    lcd_obj->done_cb = config->done_cb;
+    lcd_obj->done_arg = config->done_arg;
+
+    //Initialize non-SPI GPIOs
+    gpio_config_t io_conf;
+    io_conf.intr_type = GPIO_PIN_INTR_DISABLE;
+    io_conf.mode = GPIO_MODE_OUTPUT;
+    io_conf.pin_bit_mask = (1ULL << config->pin_dc) | (1ULL << config->pin_rst) | (1ULL << config->pin_cs) | (1ULL << config->pin_bk);
+    io_conf.pull_down_en = 0;
+    io_conf.pull_up_en = 0;
+    gpio_config(&io_conf);
+
+    lcd_obj->pin_dc = config->pin_dc;
+    if (config->pin_dc < 32) {
+        lcd_obj->dc_w1ts = &GPIO.out_w1ts;
+        lcd_obj->dc_w1tc = &GPIO.out_w1tc;
+        lcd_obj->dc_mask = 1UL << config->pin_dc;
+    } else {
+        lcd_obj->dc_w1ts = &GPIO.out1_w1ts.val;
+        lcd_obj->dc_w1tc = &GPIO.out1_w1tc.val;
+        lcd_obj->dc_mask = 1UL << (config->pin_dc - 32);
+    }
+    lcd_obj->pin_cs = config->pin_cs;
+    lcd_obj->pin_rst = config->pin_rst;
+    lcd_obj->pin_bk = config->pin_bk;
+    lcd_set_cs(1);
+
+    lcd_rst();//lcd_rst before LCD Init.
+    lcd_delay_ms(100);
+    lcd_st7789_config(config);
+
+    if (config->te_enable) {
+        lcd_obj->pin_te = config->pin_te;
+        lcd_obj->te_divisor = config->te_divisor ? config->te_divisor : 1;
+        lcd_obj->te_sem = xSemaphoreCreateBinary();
+        if (!lcd_obj->te_sem) {
+            ESP_LOGE(TAG, "lcd te semaphore create error\n");
+            return -1;
+        }
+        gpio_config_t te_conf = {
+            .intr_type = GPIO_PIN_INTR_POSEDGE,
+            .mode = GPIO_MODE_INPUT,
+            .pin_bit_mask = 1ULL << config->pin_te,
+            .pull_down_en = 0,
+            .pull_up_en = 0,
+        };
+        gpio_config(&te_conf);
+        gpio_install_isr_service(ESP_INTR_FLAG_IRAM); // may already be installed by the application
+        gpio_isr_handler_add(config->pin_te, lcd_te_isr, NULL);
+    }
+
+    lcd_set_blk(0);
+    ESP_LOGI(TAG, "lcd init ok\n");
+
+    return 0;
+}
+
+// Queue a command and up to 4 parameter bytes, the bytes live in the transaction so nothing waits
+static void spi_queue_cmd(uint8_t cmd, const uint8_t *data, int len)
+{
+    if (lcd_obj->bus == LCD_BUS_I2S) {
+        lcd_i2s_write(&cmd, 1, 0, false);
+        lcd_i2s_write((uint8_t *)data, len, 1, false);
+        return;
+    }
+    for (int i = 0; i < 2; i++) {
+        if (i == 1 && len == 0) {
+            break;
+        }
+        if (lcd_obj->trans_pending == LCD_TRANS_MAX) {
+            spi_reclaim();
+        }
+        spi_transaction_t *t = &lcd_obj->trans[lcd_obj->trans_head];
+        lcd_obj->trans_head = (lcd_obj->trans_head + 1) % LCD_TRANS_MAX;
+        memset(t, 0, sizeof(spi_transaction_t));
+        t->flags = SPI_TRANS_USE_TXDATA;
+        if (i == 0) {
+            t->length = 8;
+            t->tx_data[0] = cmd;
+            t->user = (void *)0;
+        } else {
+            t->length = 8 * len;
+            memcpy(t->tx_data, data, len);
+            t->user = (void *)LCD_TRANS_DC;
+        }
+        spi_device_queue_trans(lcd_obj->spi, t, portMAX_DELAY);
+        lcd_obj->trans_pending++;
+        lcd_obj->trans_queued++;
+    }
+}
+
+void lcd_set_index(uint16_t x_start, uint16_t y_start, uint16_t x_end, uint16_t y_end)
+{
+    uint16_t start_pos, end_pos;
+    uint8_t data[4];
+    lcd_obj->window.x_start = x_start;
+    lcd_obj->window.y_start = y_start;
+    lcd_obj->window.x_end = x_end;
+    lcd_obj->window.y_end = y_end;
+    lcd_obj->window_offset = 0;
+    start_pos = x_start + lcd_obj->x_offset;
+    end_pos = x_end + lcd_obj->x_offset;
+    data[0] = start_pos >> 8;
+    data[1] = start_pos & 0xFF;
+    data[2] = end_pos >> 8;
+    data[3] = end_pos & 0xFF;
+    spi_queue_cmd(0x2a, data, 4);    // CASET (2Ah): Column Address Set
+
+    start_pos = y_start + lcd_obj->y_offset;
+    end_pos = y_end + lcd_obj->y_offset;
+    data[0] = start_pos >> 8;
+    data[1] = start_pos & 0xFF;
+    data[2] = end_pos >> 8;
+    data[3] = end_pos & 0xFF;
+    spi_queue_cmd(0x2b, data, 4);    // RASET (2Bh): Row Address Set
+    spi_queue_cmd(0x2c, NULL, 0);    // RAMWR (2Ch): Memory Write, the pixel data queued next follows it
+}
+
+void lcd_set_rotation(uint8_t rotation, uint8_t mirror)
+{
+    // queued behind the pixels already in flight and before the next lcd_set_index, so it lands between frames
+    uint8_t madctl = lcd_rotation_config(rotation, mirror);
+    spi_queue_cmd(0x36, &madctl, 1);
+}
+
+static uint32_t lcd_rect_area(const lcd_rect_t *rect)
+{
+    return (uint32_t)(rect->x_end - rect->x_start + 1) * (rect->y_end - rect->y_start + 1);
+}
+
+static void lcd_rect_union(lcd_rect_t *dst, const lcd_rect_t *src)
+{
+    dst->x_start = dst->x_start < src->x_start ? dst->x_start : src->x_start;
+    dst->y_start = dst->y_start < src->y_start ? dst->y_start : src->y_start;
+    dst->x_end = dst->x_end > src->x_end ? dst->x_end : src->x_end;
+    dst->y_end = dst->y_end > src->y_end ? dst->y_end : src->y_end;
+}
+
+// Overlapping or touching rectangles, the union costs no extra pixels worth a second window
+static bool lcd_rect_adjoin(const lcd_rect_t *a, const lcd_rect_t *b)
+{
+    return a->x_start <= b->x_end + 1 && b->x_start <= a->x_end + 1 &&
+           a->y_start <= b->y_end + 1 && b->y_start <= a->y_end + 1;
+}
+
+void lcd_mark_dirty(uint16_t x_start, uint16_t y_start, uint16_t x_end, uint16_t y_end)
+{
+    lcd_rect_t rect = {x_start, y_start, x_end, y_end};
+    if (x_start > x_end || y_start > y_end) {
+        return;
+    }
+    // Merging can make the rectangle overlap others, keep folding until it stands alone
+    for (int i = 0; i < lcd_obj->dirty_cnt;) {
+        if (lcd_rect_adjoin(&rect, &lcd_obj->dirty[i])) {
+            lcd_rect_union(&rect, &lcd_obj->dirty[i]);
+            lcd_obj->dirty[i] = lcd_obj->dirty[--lcd_obj->dirty_cnt];
+            i = 0;
+        } else {
+            i++;
+        }
+    }
+    if (lcd_obj->dirty_cnt < LCD_DIRTY_MAX) {
+        lcd_obj->dirty[lcd_obj->dirty_cnt++] = rect;
+        return;
+    }
+    // List full, grow the rectangle that gets the least bigger
+    int best = 0;
+    uint32_t best_cost = UINT32_MAX;
+    for (int i = 0; i < lcd_obj->dirty_cnt; i++) {
+        lcd_rect_t merged = lcd_obj->dirty[i];
+        lcd_rect_union(&merged, &rect);
+        uint32_t cost = lcd_rect_area(&merged) - lcd_rect_area(&lcd_obj->dirty[i]);
+        if (cost < best_cost) {
+            best_cost = cost;
+            best = i;
+        }
+    }
+    lcd_rect_union(&lcd_obj->dirty[best], &rect);
+}
+
+int lcd_set_overlay(const lcd_overlay_t *overlay, int cnt)
+{
+    if (cnt < 0 || cnt > LCD_OVERLAY_MAX) {
+        ESP_LOGE(TAG, "overlay count error\n");
+        return -1;
+    }
+    for (int i = 0; i < cnt; i++) {
+        lcd_obj->overlay[i] = overlay[i];
+    }
+    lcd_obj->overlay_cnt = cnt;
+    return 0;
+}
+
+void lcd_flush_dirty(uint8_t *frame, uint16_t width)
+{
+    for (int i = 0; i < lcd_obj->dirty_cnt; i++) {
+        lcd_rect_t *rect = &lcd_obj->dirty[i];
+        size_t line_size = (rect->x_end - rect->x_start + 1) * 2;
+        lcd_set_index(rect->x_start, rect->y_start, rect->x_end, rect->y_end);
+        lcd_obj->dc_state = 1;
+        if (line_size == width * 2) { // full width rows are contiguous in the frame
+            spi_queue_data(&frame[rect->y_start * width * 2], line_size * (rect->y_end - rect->y_start + 1), LCD_TRANS_DC);
+            continue;
+        }
+        for (int y = rect->y_start; y <= rect->y_end; y++) {
+            spi_queue_data(&frame[(y * width + rect->x_start) * 2], line_size, LCD_TRANS_DC);
+        }
+    }
+    lcd_obj->dirty_cnt = 0;
+    lcd_wait_done();
+}
+
+void lcd_flush_dirty_indexed(const uint8_t *frame, uint16_t width)
+{
+    if (lcd_bounce_check() != 0) {
+        return;
+    }
+    for (int i = 0; i < lcd_obj->dirty_cnt; i++) {
+        lcd_rect_t *rect = &lcd_obj->dirty[i];
+        size_t line_cnt = rect->x_end - rect->x_start + 1;
+        lcd_set_index(rect->x_start, rect->y_start, rect->x_end, rect->y_end);
+        lcd_obj->dc_state = 1;
+        if (line_cnt == width) {
+            spi_queue_indexed(&frame[rect->y_start * width], line_cnt * (rect->y_end - rect->y_start + 1), LCD_TRANS_DC);
+            continue;
+        }
+        for (int y = rect->y_start; y <= rect->y_end; y++) {
+            spi_queue_indexed(&frame[y * width + rect->x_start], line_cnt, LCD_TRANS_DC);
+        }
+    }
+    lcd_obj->dirty_cnt = 0;
+    lcd_wait_done();
+}
+
+void lcd_flush_dirty_rle(const pixel_rle_t *rle)
+{
+    if (lcd_bounce_check() != 0) {
+        return;
+    }
+    for (int i = 0; i < lcd_obj->dirty_cnt; i++) {
+        lcd_rect_t *rect = &lcd_obj->dirty[i];
+        if (rect->x_end >= rle->width || rect->y_end >= rle->high) {
+            continue; // outside the layer
+        }
+        lcd_set_index(rect->x_start, rect->y_start, rect->x_end, rect->y_end);
+        lcd_obj->dc_state = 1;
+        spi_queue_rle(rle, rect, LCD_TRANS_DC);
+    }
+    lcd_obj->dirty_cnt = 0;
+    lcd_wait_done();
+}
+
+void lcd_get_te_stats(uint32_t *edges, uint32_t *late)
+{
+    *edges = lcd_obj->te_sem ? lcd_obj->te_count : 0;
+    *late = lcd_obj->te_late;
+}
+
+int64_t lcd_get_present_time(void)
+{
+    return lcd_obj->present_time;
+}
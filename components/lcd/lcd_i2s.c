@@ -0,0 +1,221 @@
+
+#include <stdio.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "soc/i2s_struct.h"
+#include "esp32s2/rom/lldesc.h"
+#include "driver/periph_ctrl.h"
+#include "lcd_i2s.h"
+#if CONFIG_PM_ENABLE
+#include "esp_pm.h"
+#endif
+
+static const char *TAG = "lcd_i2s";
+
+#define LCD_I2S_DMA_MAX_SIZE  (4092) // word aligned, below the 4095 descriptor limit
+#define LCD_I2S_SMALL_SIZE    (4)    // commands and parameters are copied, callers pass stack bytes
+
+typedef struct {
+    lldesc_t *dma;
+    uint32_t node_cnt;
+    uint32_t buffer_size;  // bytes one descriptor chain can cover
+    uint8_t *small;        // DMA copy of command bytes
+    uint8_t pin_dc;
+    volatile uint8_t busy;
+    uint8_t done;
+    SemaphoreHandle_t done_sem;
+    lcd_done_cb_t done_cb;
+    void *done_arg;
+#if CONFIG_PM_ENABLE
+    esp_pm_lock_handle_t pm_lock; // held from the start of a chain to its EOF, the WR clock comes from APB
+#endif
+} lcd_i2s_obj_t;
+
+static lcd_i2s_obj_t *lcd_i2s_obj = NULL;
+
+static void IRAM_ATTR lcd_i2s_isr(void *arg)
+{
+    typeof(I2S0.int_st) int_st = I2S0.int_st;
+    I2S0.int_clr.val = int_st.val;
+    BaseType_t HPTaskAwoken = pdFALSE;
+    if (int_st.out_total_eof) {
+        lcd_i2s_obj->busy = 0;
+#if CONFIG_PM_ENABLE
+        esp_pm_lock_release(lcd_i2s_obj->pm_lock);
+#endif
+        if (lcd_i2s_obj->done && lcd_i2s_obj->done_cb) {
+            lcd_i2s_obj->done_cb(lcd_i2s_obj->done_arg);
+        }
+        xSemaphoreGiveFromISR(lcd_i2s_obj->done_sem, &HPTaskAwoken);
+    }
+
+    if(HPTaskAwoken == pdTRUE) {
+        portYIELD_FROM_ISR();
+    }
+}
+
+static void lcd_i2s_set_pin(lcd_config_t *config)
+{
+    for (int i = 0; i < 8; i++) {
+        PIN_FUNC_SELECT(GPIO_PIN_MUX_REG[config->pin_data[i]], PIN_FUNC_GPIO);
+        gpio_set_direction(config->pin_data[i], GPIO_MODE_OUTPUT);
+        gpio_set_pull_mode(config->pin_data[i], GPIO_FLOATING);
+        // 高位对齐，8位数据从 OUT16 开始
+        gpio_matrix_out(config->pin_data[i], I2S0O_DATA_OUT16_IDX + i, false, false);
+    }
+    PIN_FUNC_SELECT(GPIO_PIN_MUX_REG[config->pin_wr], PIN_FUNC_GPIO);
+    gpio_set_direction(config->pin_wr, GPIO_MODE_OUTPUT);
+    gpio_set_pull_mode(config->pin_wr, GPIO_FLOATING);
+    gpio_matrix_out(config->pin_wr, I2S0O_WS_OUT_IDX, true, false); // 数据在 WR 上升沿锁存
+}
+
+static void lcd_i2s_config(lcd_config_t *config)
+{
+    //Enable I2S periph
+    periph_module_enable(PERIPH_I2S0_MODULE);
+
+    // 配置时钟, 160MHz / 2 = 80MHz
+    I2S0.clkm_conf.val = 0;
+    I2S0.clkm_conf.clkm_div_num = 2;
+    I2S0.clkm_conf.clkm_div_b = 0;
+    I2S0.clkm_conf.clkm_div_a = 0;
+    I2S0.clkm_conf.clk_sel = 2;
+    I2S0.clkm_conf.clk_en = 1;
+
+    // 配置 WR 频率
+    uint32_t div = (80 * 1000 * 1000) / config->clk_fre;
+    I2S0.sample_rate_conf.val = 0;
+    I2S0.sample_rate_conf.tx_bck_div_num = div < 2 ? 2 : div;
+    I2S0.sample_rate_conf.tx_bits_mod = 8;
+
+    // 配置数据格式
+    I2S0.conf.val = 0;
+    I2S0.conf.tx_right_first = 1;
+    I2S0.conf.tx_msb_right = 1;
+    I2S0.conf.tx_dma_equal = 1;
+
+    I2S0.conf1.val = 0;
+    I2S0.conf1.tx_pcm_bypass = 1;
+    I2S0.conf1.tx_stop_en = 1;
+
+    I2S0.conf2.val = 0;
+    I2S0.conf2.lcd_en = 1;
+
+    I2S0.conf_chan.val = 0;
+    I2S0.conf_chan.tx_chan_mod = 1;
+
+    I2S0.fifo_conf.val = 0;
+    I2S0.fifo_conf.tx_fifo_mod_force_en = 1;
+    I2S0.fifo_conf.tx_data_num = 32;
+    I2S0.fifo_conf.tx_fifo_mod = 2;
+    I2S0.fifo_conf.dscr_en = 1;
+
+    I2S0.lc_conf.out_rst  = 1;
+    I2S0.lc_conf.out_rst  = 0;
+    I2S0.lc_conf.ext_mem_bk_size = 0; // PSRAM frames go out through EDMA
+
+    I2S0.timing.val = 0;
+
+    I2S0.int_ena.val = 0;
+    I2S0.int_clr.val = ~0;
+    I2S0.int_ena.out_total_eof = 1;
+
+    I2S0.lc_conf.check_owner = 0;
+
+    esp_intr_alloc(ETS_I2S0_INTR_SOURCE, 0, lcd_i2s_isr, NULL, NULL);
+}
+
+void lcd_i2s_wait_done(void)
+{
+    while (lcd_i2s_obj->busy) {
+        xSemaphoreTake(lcd_i2s_obj->done_sem, portMAX_DELAY);
+    }
+}
+
+// Send one descriptor chain, len is at most buffer_size
+static void lcd_i2s_start(uint8_t *data, size_t len, bool done)
+{
+    int x = 0;
+    for (x = 0; len > 0; x++) {
+        size_t size = len > LCD_I2S_DMA_MAX_SIZE ? LCD_I2S_DMA_MAX_SIZE : len;
+        lcd_i2s_obj->dma[x].size = size;
+        lcd_i2s_obj->dma[x].length = size;
+        lcd_i2s_obj->dma[x].buf = data;
+        lcd_i2s_obj->dma[x].eof = 0;
+        lcd_i2s_obj->dma[x].empty = &lcd_i2s_obj->dma[x + 1];
+        data += size;
+        len -= size;
+    }
+    lcd_i2s_obj->dma[x - 1].eof = 1;
+    lcd_i2s_obj->dma[x - 1].empty = NULL;
+
+    xSemaphoreTake(lcd_i2s_obj->done_sem, 0);
+    lcd_i2s_obj->done = done;
+    lcd_i2s_obj->busy = 1;
+#if CONFIG_PM_ENABLE
+    esp_pm_lock_acquire(lcd_i2s_obj->pm_lock);
+#endif
+    I2S0.conf.tx_reset = 1;
+    I2S0.conf.tx_reset = 0;
+    I2S0.lc_conf.out_rst = 1;
+    I2S0.lc_conf.out_rst = 0;
+    I2S0.out_link.addr = ((uint32_t)&lcd_i2s_obj->dma[0]) & 0xfffff;
+    I2S0.out_link.start = 1;
+    I2S0.conf.tx_start = 1;
+}
+
+void lcd_i2s_write(uint8_t *data, size_t len, int dc, bool done)
+{
+    while (len > 0) {
+        size_t size = len > lcd_i2s_obj->buffer_size ? lcd_i2s_obj->buffer_size : len;
+        lcd_i2s_wait_done();
+        gpio_set_level(lcd_i2s_obj->pin_dc, dc);
+        if (size <= LCD_I2S_SMALL_SIZE) {
+            memcpy(lcd_i2s_obj->small, data, size);
+            lcd_i2s_start(lcd_i2s_obj->small, size, done && size == len);
+        } else {
+            lcd_i2s_start(data, size, done && size == len);
+        }
+        data += size;
+        len -= size;
+    }
+}
+
+int lcd_i2s_init(lcd_config_t *config)
+{
+    lcd_i2s_obj = (lcd_i2s_obj_t *)heap_caps_calloc(1, sizeof(lcd_i2s_obj_t), MALLOC_CAP_INTERNAL);
+    if (!lcd_i2s_obj) {
+        ESP_LOGI(TAG, "lcd i2s object malloc error\n");
+        return -1;
+    }
+    lcd_i2s_obj->node_cnt = (config->max_buffer_size + LCD_I2S_DMA_MAX_SIZE - 1) / LCD_I2S_DMA_MAX_SIZE;
+    lcd_i2s_obj->buffer_size = lcd_i2s_obj->node_cnt * LCD_I2S_DMA_MAX_SIZE;
+    lcd_i2s_obj->dma = (lldesc_t *)heap_caps_calloc(lcd_i2s_obj->node_cnt, sizeof(lldesc_t), MALLOC_CAP_DMA);
+    lcd_i2s_obj->small = (uint8_t *)heap_caps_malloc(LCD_I2S_SMALL_SIZE, MALLOC_CAP_DMA);
+    lcd_i2s_obj->done_sem = xSemaphoreCreateBinary();
+    if (!lcd_i2s_obj->dma || !lcd_i2s_obj->small || !lcd_i2s_obj->done_sem) {
+        ESP_LOGE(TAG, "lcd i2s dma malloc error\n");
+        return -1;
+    }
+#if CONFIG_PM_ENABLE
+    if (esp_pm_lock_create(ESP_PM_APB_FREQ_MAX, 0, "lcd_i2s", &lcd_i2s_obj->pm_lock) != ESP_OK) {
+        ESP_LOGE(TAG, "lcd i2s pm lock create error\n");
+        return -1;
+    }
+#endif
+    for (int x = 0; x < lcd_i2s_obj->node_cnt; x++) {
+        lcd_i2s_obj->dma[x].owner = 1;
+    }
+    lcd_i2s_obj->pin_dc = config->pin_dc;
+    lcd_i2s_obj->done_cb = config->done_cb;
+    lcd_i2s_obj->done_arg = config->done_arg;
+
+    lcd_i2s_set_pin(config);
+    lcd_i2s_config(config);
+    ESP_LOGI(TAG, "lcd_i2s_node_cnt: %d, lcd_i2s_wr_div: %d\n", lcd_i2s_obj->node_cnt, I2S0.sample_rate_conf.tx_bck_div_num);
+    return 0;
+}
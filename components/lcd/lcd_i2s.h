@@ -0,0 +1,22 @@
+#pragma once
+
+#include "lcd.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 8080 backend used by lcd.c when config->bus is LCD_BUS_I2S.
+// ESP32-S2: I2S0 LCD mode, lcd_i2s.c. ESP32-S3: the LCD half of LCD_CAM, lcd_lcd_cam.c
+
+int lcd_i2s_init(lcd_config_t *config);
+
+// Start sending len bytes with D/C at dc, waits for the previous write first.
+// done: call config->done_cb once the data is out
+void lcd_i2s_write(uint8_t *data, size_t len, int dc, bool done);
+
+void lcd_i2s_wait_done(void);
+
+#ifdef __cplusplus
+}
+#endif
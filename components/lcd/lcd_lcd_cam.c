@@ -0,0 +1,247 @@
+#include <stdio.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "soc/lcd_cam_struct.h"
+#include "soc/gdma_struct.h"
+#include "soc/lldesc.h"
+#include "hal/gdma_ll.h"
+#include "esp_private/gdma.h"
+#include "esp32s3/rom/ets_sys.h"
+#include "driver/periph_ctrl.h"
+#include "lcd_i2s.h"
+#if CONFIG_PM_ENABLE
+#include "esp_pm.h"
+#endif
+
+// ESP32-S3 8080 backend on the LCD half of LCD_CAM with a GDMA TX channel, behind the lcd_i2s interface.
+// The camera half runs on its own GDMA RX channel, so capture and display work at the same time. Needs IDF v4.4 or later
+
+static const char *TAG = "lcd_lcd_cam";
+
+#define LCD_LCD_CAM_DMA_MAX_SIZE  (4080) // 16 byte PSRAM blocks, below the 4095 descriptor limit
+#define LCD_LCD_CAM_SMALL_SIZE    (4)    // commands and parameters are copied, callers pass stack bytes
+
+typedef struct {
+    lldesc_t *dma;
+    uint32_t node_cnt;
+    uint32_t buffer_size;  // bytes one descriptor chain can cover
+    uint8_t *small;        // DMA copy of command bytes
+    uint8_t pin_dc;
+    volatile uint8_t busy;
+    uint8_t done;
+    SemaphoreHandle_t done_sem;
+    lcd_done_cb_t done_cb;
+    void *done_arg;
+    gdma_channel_handle_t dma_chan;
+    int dma_id;
+#if CONFIG_PM_ENABLE
+    esp_pm_lock_handle_t pm_lock; // held from the start of a chain to its end, GDMA runs from APB
+#endif
+} lcd_lcd_cam_obj_t;
+
+static lcd_lcd_cam_obj_t *lcd_lcd_cam_obj = NULL;
+
+static void IRAM_ATTR lcd_lcd_cam_isr(void *arg)
+{
+    typeof(LCD_CAM.lc_dma_int_st) int_st = LCD_CAM.lc_dma_int_st;
+    LCD_CAM.lc_dma_int_clr.val = int_st.val;
+    BaseType_t HPTaskAwoken = pdFALSE;
+    if (int_st.lcd_trans_done_int_st) {
+        lcd_lcd_cam_obj->busy = 0;
+#if CONFIG_PM_ENABLE
+        esp_pm_lock_release(lcd_lcd_cam_obj->pm_lock);
+#endif
+        if (lcd_lcd_cam_obj->done && lcd_lcd_cam_obj->done_cb) {
+            lcd_lcd_cam_obj->done_cb(lcd_lcd_cam_obj->done_arg);
+        }
+        xSemaphoreGiveFromISR(lcd_lcd_cam_obj->done_sem, &HPTaskAwoken);
+    }
+
+    if(HPTaskAwoken == pdTRUE) {
+        portYIELD_FROM_ISR();
+    }
+}
+
+static void lcd_lcd_cam_set_pin(lcd_config_t *config)
+{
+    for (int i = 0; i < 8; i++) {
+        PIN_FUNC_SELECT(GPIO_PIN_MUX_REG[config->pin_data[i]], PIN_FUNC_GPIO);
+        gpio_set_direction(config->pin_data[i], GPIO_MODE_OUTPUT);
+        gpio_set_pull_mode(config->pin_data[i], GPIO_FLOATING);
+        gpio_matrix_out(config->pin_data[i], LCD_DATA_OUT0_IDX + i, false, false);
+    }
+    PIN_FUNC_SELECT(GPIO_PIN_MUX_REG[config->pin_wr], PIN_FUNC_GPIO);
+    gpio_set_direction(config->pin_wr, GPIO_MODE_OUTPUT);
+    gpio_set_pull_mode(config->pin_wr, GPIO_FLOATING);
+    gpio_matrix_out(config->pin_wr, LCD_PCLK_IDX, false, false);
+}
+
+static void lcd_lcd_cam_config(lcd_config_t *config)
+{
+    // LCD 和 CAM 共用一个模块，各自配置自己的一半，可以同时工作
+    periph_module_enable(PERIPH_LCD_CAM_MODULE);
+
+    // 配置时钟, 160MHz / 2 = 80MHz
+    LCD_CAM.lcd_clock.val = 0;
+    LCD_CAM.lcd_clock.clk_en = 1;
+    LCD_CAM.lcd_clock.lcd_clk_sel = 3;
+    LCD_CAM.lcd_clock.lcd_clkm_div_num = 2;
+    LCD_CAM.lcd_clock.lcd_clkm_div_b = 0;
+    LCD_CAM.lcd_clock.lcd_clkm_div_a = 0;
+
+    // 配置 WR 频率, WR 空闲为高，数据在 WR 上升沿锁存
+    uint32_t div = (80 * 1000 * 1000) / config->clk_fre;
+    LCD_CAM.lcd_clock.lcd_clkcnt_n = (div < 2 ? 2 : div) - 1;
+    LCD_CAM.lcd_clock.lcd_clk_equ_sysclk = 0;
+    LCD_CAM.lcd_clock.lcd_ck_idle_edge = 1;
+    LCD_CAM.lcd_clock.lcd_ck_out_edge = 0;
+
+    // 只有数据阶段，长度由 DMA 链决定
+    LCD_CAM.lcd_ctrl.val = 0;
+    LCD_CAM.lcd_ctrl.lcd_rgb_mode_en = 0;
+    LCD_CAM.lcd_user.val = 0;
+    LCD_CAM.lcd_user.lcd_2byte_en = 0;
+    LCD_CAM.lcd_user.lcd_cmd = 0;
+    LCD_CAM.lcd_user.lcd_dummy = 0;
+    LCD_CAM.lcd_user.lcd_dout = 1;
+    LCD_CAM.lcd_user.lcd_always_out_en = 1;
+    LCD_CAM.lcd_misc.val = 0;
+    LCD_CAM.lcd_misc.lcd_next_frame_en = 0;
+    LCD_CAM.lcd_user.lcd_reset = 1;
+    LCD_CAM.lcd_user.lcd_reset = 0;
+    LCD_CAM.lcd_misc.lcd_afifo_reset = 1;
+    LCD_CAM.lcd_misc.lcd_afifo_reset = 0;
+    LCD_CAM.lcd_user.lcd_update = 1;
+
+    LCD_CAM.lc_dma_int_clr.lcd_trans_done_int_clr = 1;
+    LCD_CAM.lc_dma_int_ena.lcd_trans_done_int_ena = 1;
+}
+
+static int lcd_lcd_cam_dma_config(void)
+{
+    gdma_channel_alloc_config_t alloc = {
+        .direction = GDMA_CHANNEL_DIRECTION_TX,
+    };
+    if (gdma_new_channel(&alloc, &lcd_lcd_cam_obj->dma_chan) != ESP_OK) {
+        return -1;
+    }
+    gdma_connect(lcd_lcd_cam_obj->dma_chan, GDMA_MAKE_TRIGGER(GDMA_TRIG_PERIPH_LCD, 0));
+    gdma_strategy_config_t strategy = {
+        .owner_check = false,
+        .auto_update_desc = false,
+    };
+    gdma_apply_strategy(lcd_lcd_cam_obj->dma_chan, &strategy);
+    // PSRAM frames go out through EDMA
+    gdma_transfer_ability_t ability = {
+        .sram_trans_align = 4,
+        .psram_trans_align = 16,
+    };
+    gdma_set_transfer_ability(lcd_lcd_cam_obj->dma_chan, &ability);
+    gdma_get_channel_id(lcd_lcd_cam_obj->dma_chan, &lcd_lcd_cam_obj->dma_id);
+    return 0;
+}
+
+void lcd_i2s_wait_done(void)
+{
+    while (lcd_lcd_cam_obj->busy) {
+        xSemaphoreTake(lcd_lcd_cam_obj->done_sem, portMAX_DELAY);
+    }
+}
+
+// Send one descriptor chain, len is at most buffer_size
+static void lcd_lcd_cam_start(uint8_t *data, size_t len, bool done)
+{
+    int x = 0;
+    for (x = 0; len > 0; x++) {
+        size_t size = len > LCD_LCD_CAM_DMA_MAX_SIZE ? LCD_LCD_CAM_DMA_MAX_SIZE : len;
+        lcd_lcd_cam_obj->dma[x].size = size;
+        lcd_lcd_cam_obj->dma[x].length = size;
+        lcd_lcd_cam_obj->dma[x].buf = data;
+        lcd_lcd_cam_obj->dma[x].eof = 0;
+        lcd_lcd_cam_obj->dma[x].empty = &lcd_lcd_cam_obj->dma[x + 1];
+        data += size;
+        len -= size;
+    }
+    lcd_lcd_cam_obj->dma[x - 1].eof = 1;
+    lcd_lcd_cam_obj->dma[x - 1].empty = NULL;
+
+    xSemaphoreTake(lcd_lcd_cam_obj->done_sem, 0);
+    lcd_lcd_cam_obj->done = done;
+    lcd_lcd_cam_obj->busy = 1;
+#if CONFIG_PM_ENABLE
+    esp_pm_lock_acquire(lcd_lcd_cam_obj->pm_lock);
+#endif
+    int id = lcd_lcd_cam_obj->dma_id;
+    gdma_ll_tx_reset_channel(&GDMA, id);
+    LCD_CAM.lcd_misc.lcd_afifo_reset = 1;
+    LCD_CAM.lcd_misc.lcd_afifo_reset = 0;
+    gdma_ll_tx_set_desc_addr(&GDMA, id, (uint32_t)&lcd_lcd_cam_obj->dma[0]);
+    gdma_ll_tx_start(&GDMA, id);
+    ets_delay_us(1); // 等 DMA 先把数据送进 FIFO
+    LCD_CAM.lcd_user.lcd_update = 1;
+    LCD_CAM.lcd_user.lcd_start = 1;
+}
+
+void lcd_i2s_write(uint8_t *data, size_t len, int dc, bool done)
+{
+    while (len > 0) {
+        size_t size = len > lcd_lcd_cam_obj->buffer_size ? lcd_lcd_cam_obj->buffer_size : len;
+        lcd_i2s_wait_done();
+        gpio_set_level(lcd_lcd_cam_obj->pin_dc, dc);
+        if (size <= LCD_LCD_CAM_SMALL_SIZE) {
+            memcpy(lcd_lcd_cam_obj->small, data, size);
+            lcd_lcd_cam_start(lcd_lcd_cam_obj->small, size, done && size == len);
+        } else {
+            lcd_lcd_cam_start(data, size, done && size == len);
+        }
+        data += size;
+        len -= size;
+    }
+}
+
+int lcd_i2s_init(lcd_config_t *config)
+{
+    lcd_lcd_cam_obj = (lcd_lcd_cam_obj_t *)heap_caps_calloc(1, sizeof(lcd_lcd_cam_obj_t), MALLOC_CAP_INTERNAL);
+    if (!lcd_lcd_cam_obj) {
+        ESP_LOGI(TAG, "lcd lcd_cam object malloc error\n");
+        return -1;
+    }
+    lcd_lcd_cam_obj->node_cnt = (config->max_buffer_size + LCD_LCD_CAM_DMA_MAX_SIZE - 1) / LCD_LCD_CAM_DMA_MAX_SIZE;
+    lcd_lcd_cam_obj->buffer_size = lcd_lcd_cam_obj->node_cnt * LCD_LCD_CAM_DMA_MAX_SIZE;
+    lcd_lcd_cam_obj->dma = (lldesc_t *)heap_caps_calloc(lcd_lcd_cam_obj->node_cnt, sizeof(lldesc_t), MALLOC_CAP_DMA);
+    lcd_lcd_cam_obj->small = (uint8_t *)heap_caps_malloc(LCD_LCD_CAM_SMALL_SIZE, MALLOC_CAP_DMA);
+    lcd_lcd_cam_obj->done_sem = xSemaphoreCreateBinary();
+    if (!lcd_lcd_cam_obj->dma || !lcd_lcd_cam_obj->small || !lcd_lcd_cam_obj->done_sem) {
+        ESP_LOGE(TAG, "lcd lcd_cam dma malloc error\n");
+        return -1;
+    }
+#if CONFIG_PM_ENABLE
+    if (esp_pm_lock_create(ESP_PM_APB_FREQ_MAX, 0, "lcd_lcd_cam", &lcd_lcd_cam_obj->pm_lock) != ESP_OK) {
+        ESP_LOGE(TAG, "lcd lcd_cam pm lock create error\n");
+        return -1;
+    }
+#endif
+    for (int x = 0; x < lcd_lcd_cam_obj->node_cnt; x++) {
+        lcd_lcd_cam_obj->dma[x].owner = 1;
+    }
+    lcd_lcd_cam_obj->pin_dc = config->pin_dc;
+    lcd_lcd_cam_obj->done_cb = config->done_cb;
+    lcd_lcd_cam_obj->done_arg = config->done_arg;
+
+    lcd_lcd_cam_set_pin(config);
+    lcd_lcd_cam_config(config);
+    if (lcd_lcd_cam_dma_config() != 0) {
+        ESP_LOGE(TAG, "lcd gdma channel error\n");
+        return -1;
+    }
+    if (esp_intr_alloc(ETS_LCD_CAM_INTR_SOURCE, 0, lcd_lcd_cam_isr, NULL, NULL) != ESP_OK) {
+        ESP_LOGE(TAG, "lcd lcd_cam interrupt alloc error\n");
+        return -1;
+    }
+    ESP_LOGI(TAG, "lcd_lcd_cam_node_cnt: %d, lcd_lcd_cam_wr_div: %d\n", lcd_lcd_cam_obj->node_cnt, LCD_CAM.lcd_clock.lcd_clkcnt_n + 1);
+    return 0;
+}
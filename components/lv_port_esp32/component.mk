@@ -0,0 +1,9 @@
+#
+# "main" pseudo-component makefile.
+#
+# (Uses default behaviour of compiling all source files in directory, adding 'include' to include path.)
+
+# LVGL is not part of this repository, the port is only built once it is added as components/lvgl
+ifeq ($(wildcard $(COMPONENT_PATH)/../lvgl),)
+COMPONENT_SRCDIRS :=
+endif
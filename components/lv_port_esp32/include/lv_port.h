@@ -0,0 +1,27 @@
+#pragma once
+
+#include <stdint.h>
+#include "lcd.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// LVGL display port on top of lcd.c.
+// LVGL draws into one of two internal DMA stripe buffers while the other one is sent with
+// lcd_write_data_async, and lv_disp_flush_ready is called from the SPI done callback.
+// lv_conf.h needs LV_COLOR_DEPTH 16 and LV_COLOR_16_SWAP 1, the ST7789 takes big-endian RGB565.
+
+typedef struct {
+    uint16_t width;
+    uint16_t high;
+    uint16_t stripe_lines; // lines per draw buffer, 0: high / 10
+} lv_port_config_t;
+
+// Calls lv_init and lcd_init, config->done_cb is taken over by the port.
+// The application then calls lv_task_handler periodically, the tick comes from an esp_timer.
+int lv_port_init(lcd_config_t *lcd_config, const lv_port_config_t *config);
+
+#ifdef __cplusplus
+}
+#endif
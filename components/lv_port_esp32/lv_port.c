@@ -0,0 +1,80 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "lvgl.h"
+#include "lcd.h"
+#include "lv_port.h"
+
+static const char *TAG = "lv_port";
+
+#define LV_PORT_TICK_MS 1
+
+#if LV_COLOR_DEPTH != 16 || LV_COLOR_16_SWAP != 1
+#error "lv_port needs LV_COLOR_DEPTH 16 and LV_COLOR_16_SWAP 1"
+#endif
+
+static lv_disp_buf_t lv_port_disp_buf;
+static lv_disp_drv_t lv_port_disp_drv;
+
+// SPI ISR, the stripe is on the panel and LVGL may draw into it again
+static void lv_port_flush_done(void *arg)
+{
+    lv_disp_flush_ready((lv_disp_drv_t *)arg);
+}
+
+static void lv_port_flush(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p)
+{
+    size_t len = (area->x2 - area->x1 + 1) * (area->y2 - area->y1 + 1) * sizeof(lv_color_t);
+    lcd_set_index(area->x1, area->y1, area->x2, area->y2);
+    // 异步发送，LVGL 同时在另一个 buffer 中绘制下一条
+    lcd_write_data_async((uint8_t *)color_p, len);
+}
+
+static void lv_port_tick(void *arg)
+{
+    lv_tick_inc(LV_PORT_TICK_MS);
+}
+
+int lv_port_init(lcd_config_t *lcd_config, const lv_port_config_t *config)
+{
+    uint16_t lines = config->stripe_lines ? config->stripe_lines : config->high / 10;
+    size_t size = config->width * lines; // pixels per draw buffer
+
+    lv_init();
+    lcd_config->done_cb = lv_port_flush_done;
+    lcd_config->done_arg = &lv_port_disp_drv;
+    if (lcd_init(lcd_config) != 0) {
+        return -1;
+    }
+
+    lv_color_t *buf1 = (lv_color_t *)heap_caps_malloc(size * sizeof(lv_color_t), MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+    lv_color_t *buf2 = (lv_color_t *)heap_caps_malloc(size * sizeof(lv_color_t), MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+    if (!buf1 || !buf2) {
+        ESP_LOGE(TAG, "draw buffer malloc error\n");
+        free(buf1);
+        free(buf2);
+        return -1;
+    }
+    lv_disp_buf_init(&lv_port_disp_buf, buf1, buf2, size);
+
+    lv_disp_drv_init(&lv_port_disp_drv);
+    lv_port_disp_drv.hor_res = config->width;
+    lv_port_disp_drv.ver_res = config->high;
+    lv_port_disp_drv.flush_cb = lv_port_flush;
+    lv_port_disp_drv.buffer = &lv_port_disp_buf;
+    lv_disp_drv_register(&lv_port_disp_drv);
+
+    const esp_timer_create_args_t timer_args = {
+        .callback = lv_port_tick,
+        .name = "lv_tick",
+    };
+    esp_timer_handle_t timer;
+    if (esp_timer_create(&timer_args, &timer) != ESP_OK || esp_timer_start_periodic(timer, LV_PORT_TICK_MS * 1000) != ESP_OK) {
+        ESP_LOGE(TAG, "tick timer error\n");
+        return -1;
+    }
+    ESP_LOGI(TAG, "draw buffers: 2x%d lines\n", lines);
+    return 0;
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_timer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// One time base for camera frames, audio blocks and LCD presentation: microseconds of esp_timer. A capture
+// time, the time a sample is heard and the time a frame starts to show compare directly, for A/V sync,
+// latency and deadlines. Reading it is one esp_timer_get_time, also from an IRAM ISR.
+//
+// An audio output runs from its own divider or the APLL and drifts against esp_timer by tens of ppm, a few
+// milliseconds per minute. A media_clock_stream_t follows the sample counter of an output: the driver marks
+// (counter, time) pairs as the hardware takes the samples, cheaply and from its ISR, and readers convert
+// sample positions to media time and back. The marks go through a phase and rate filter when they are read,
+// the rate follows the drift and the jitter of marks taken in a task averages out.
+
+static inline int64_t media_clock_now(void)
+{
+    return esp_timer_get_time();
+}
+
+// Positions are free running sample counters, differences are taken modulo 2^32
+typedef struct {
+    portMUX_TYPE lock;
+    uint32_t rate;          // nominal samples per second
+    uint32_t base_pos;      // filtered: sample base_pos plays at base_time
+    int64_t base_time;      // Q16 us, the phase keeps the part of a microsecond the jitter averages to
+    int64_t period;         // filtered us per sample, Q32
+    uint32_t mark_pos;      // last mark, the filter has not taken it yet
+    int64_t mark_time;
+    uint32_t marks;
+    uint32_t filtered;      // marks when the filter last ran
+    uint32_t resyncs;       // marks far off the estimate, a gap in the output: the filter restarted on them
+} media_clock_stream_t;
+
+// In internal RAM, the ISR of the output takes its lock
+void media_clock_stream_init(media_clock_stream_t *stream, uint32_t rate);
+
+// Sample pos starts to play at media time now. IRAM, from the output ISR or a task
+void media_clock_stream_mark(media_clock_stream_t *stream, uint32_t pos, int64_t now);
+
+// The output stopped or ran dry, positions no longer follow time: forget the phase, keep the rate.
+// Times read 0 until the next mark. IRAM, from the output ISR or a task
+void media_clock_stream_restart(media_clock_stream_t *stream);
+
+// Media time sample pos plays (or played) at, 0 before the first mark
+int64_t media_clock_stream_time(media_clock_stream_t *stream, uint32_t pos);
+
+// The sample playing at media time time, 0 before the first mark
+uint32_t media_clock_stream_pos(media_clock_stream_t *stream, int64_t time);
+
+// Rate of the output against esp_timer in ppm, positive when the output is slow
+int32_t media_clock_stream_ppm(media_clock_stream_t *stream);
+
+#ifdef __cplusplus
+}
+#endif
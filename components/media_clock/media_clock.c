@@ -0,0 +1,125 @@
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_attr.h"
+#include "media_clock.h"
+
+#define MEDIA_CLOCK_PHASE_DIV   32      // a mark moves the phase by 1/32 of its error
+#define MEDIA_CLOCK_RATE_DIV    2048    // and the period by 1/2048 of its error per sample: settles in seconds, marks taken in a task jitter by 1 ms
+#define MEDIA_CLOCK_RESYNC_US   20000   // a mark off by more restarts the phase there: a gap or a restart of the output
+#define MEDIA_CLOCK_SPAN_S      60      // marks further apart restart it too, the products stay in 64 bit
+#define MEDIA_CLOCK_PPM_MAX     1000    // the rate is held within the tolerance of a crystal or the APLL
+
+// n * period in Q16 us, period in Q32, n of either sign
+static int64_t media_clock_span(int64_t period, int32_t n)
+{
+    int64_t hi = period >> 32;
+    int64_t lo = (uint32_t)period >> 1;
+    return ((n * hi) << 16) + (((int64_t)n * lo) >> 15);
+}
+
+static int64_t media_clock_nominal(uint32_t rate)
+{
+    return ((int64_t)1000000 << 32) / rate;
+}
+
+// Take the last mark into the estimate, lock held
+static void media_clock_filter(media_clock_stream_t *stream)
+{
+    if (stream->filtered == stream->marks) {
+        return;
+    }
+    int first = stream->filtered == 0;
+    stream->filtered = stream->marks;
+    int32_t n = stream->mark_pos - stream->base_pos;
+    if (!first && n <= 0) {
+        return; // the counter has not moved since the last mark
+    }
+    if (!first && n <= (int32_t)(stream->rate * MEDIA_CLOCK_SPAN_S)) {
+        int64_t predicted = stream->base_time + media_clock_span(stream->period, n);
+        int64_t err = (stream->mark_time << 16) - predicted;
+        if (err > -(MEDIA_CLOCK_RESYNC_US << 16) && err < (MEDIA_CLOCK_RESYNC_US << 16)) {
+            int64_t nominal = media_clock_nominal(stream->rate);
+            int64_t limit = nominal / (1000000 / MEDIA_CLOCK_PPM_MAX);
+            stream->base_pos = stream->mark_pos;
+            stream->base_time = predicted + err / MEDIA_CLOCK_PHASE_DIV;
+            stream->period += err * ((int64_t)1 << 16) / n / MEDIA_CLOCK_RATE_DIV;
+            if (stream->period > nominal + limit) {
+                stream->period = nominal + limit;
+            } else if (stream->period < nominal - limit) {
+                stream->period = nominal - limit;
+            }
+            return;
+        }
+    }
+    // the rate measured so far is kept
+    if (!first) {
+        stream->resyncs++;
+    }
+    stream->base_pos = stream->mark_pos;
+    stream->base_time = stream->mark_time << 16;
+}
+
+void media_clock_stream_init(media_clock_stream_t *stream, uint32_t rate)
+{
+    memset(stream, 0, sizeof(media_clock_stream_t));
+    vPortCPUInitializeMutex(&stream->lock);
+    stream->rate = rate ? rate : 1;
+    stream->period = media_clock_nominal(stream->rate);
+}
+
+void IRAM_ATTR media_clock_stream_mark(media_clock_stream_t *stream, uint32_t pos, int64_t now)
+{
+    portENTER_CRITICAL_SAFE(&stream->lock);
+    stream->mark_pos = pos;
+    stream->mark_time = now;
+    // never 0 again once marked, filtered 0 means no mark yet
+    stream->marks = stream->marks + 1 ? stream->marks + 1 : 1;
+    portEXIT_CRITICAL_SAFE(&stream->lock);
+}
+
+void IRAM_ATTR media_clock_stream_restart(media_clock_stream_t *stream)
+{
+    portENTER_CRITICAL_SAFE(&stream->lock);
+    stream->marks = 0;
+    stream->filtered = 0;
+    portEXIT_CRITICAL_SAFE(&stream->lock);
+}
+
+int64_t media_clock_stream_time(media_clock_stream_t *stream, uint32_t pos)
+{
+    int64_t time = 0;
+    portENTER_CRITICAL_SAFE(&stream->lock);
+    media_clock_filter(stream);
+    if (stream->filtered) {
+        time = (stream->base_time + media_clock_span(stream->period, pos - stream->base_pos)) >> 16;
+    }
+    portEXIT_CRITICAL_SAFE(&stream->lock);
+    return time;
+}
+
+uint32_t media_clock_stream_pos(media_clock_stream_t *stream, int64_t time)
+{
+    uint32_t pos = 0;
+    portENTER_CRITICAL_SAFE(&stream->lock);
+    media_clock_filter(stream);
+    if (stream->filtered) {
+        int64_t d = (time << 16) - stream->base_time;
+        if (d > -(1LL << 46) && d < (1LL << 46)) {
+            pos = stream->base_pos + d * ((int64_t)1 << 16) / stream->period;
+        } else {
+            pos = stream->base_pos + (d >> 16) * stream->rate / 1000000;
+        }
+    }
+    portEXIT_CRITICAL_SAFE(&stream->lock);
+    return pos;
+}
+
+int32_t media_clock_stream_ppm(media_clock_stream_t *stream)
+{
+    portENTER_CRITICAL_SAFE(&stream->lock);
+    media_clock_filter(stream);
+    int64_t nominal = media_clock_nominal(stream->rate);
+    int32_t ppm = (stream->period - nominal) * 1000000 / nominal;
+    portEXIT_CRITICAL_SAFE(&stream->lock);
+    return ppm;
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_attr.h"
+#include "soc/soc_memory_layout.h"
+#include "sdkconfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Placement of media buffers between internal RAM and PSRAM. Callers state how a buffer is accessed instead of
+// MALLOC_CAP_* flags, the policy picks the region that suits it from what is free at the time and spills to the
+// other one when that runs short. Every placement is kept in a map, mem_place_report prints where the buffers
+// of a build ended up and which of them did not get their first choice.
+
+typedef enum {
+    MEM_PLACE_DMA = 0,  // DMA descriptors and buffers the peripheral reads or writes: internal DMA RAM, no spill
+    MEM_PLACE_ISR,      // reached from interrupts, which may run while the flash and PSRAM cache is off: internal RAM, no spill
+    MEM_PLACE_IO,       // filled by a driver that bounces through its own buffer when it has to: DMA RAM, spills to PSRAM
+    MEM_PLACE_HOT,      // touched by the CPU per pixel or per sample, control blocks: internal RAM, spills to PSRAM
+    MEM_PLACE_BULK,     // frames, compressed streams, indexes: PSRAM, falls back to internal RAM above the reserve
+    MEM_PLACE_MAX,
+} mem_place_class_t;
+
+typedef enum {
+    MEM_PLACE_REGION_INTERNAL = 0,
+    MEM_PLACE_REGION_PSRAM,
+} mem_place_region_t;
+
+// Allocate size bytes for a buffer of the class, name is kept by pointer in the map. NULL when neither region fits
+void *mem_place_alloc(const char *name, mem_place_class_t cls, size_t size);
+
+// Zeroed, as calloc
+void *mem_place_calloc(const char *name, mem_place_class_t cls, size_t n, size_t size);
+
+// Free a buffer of mem_place_alloc, NULL is ignored. A buffer given to free() stays in the map until its address is reused
+void mem_place_free(void *ptr);
+
+// Region a buffer was placed in
+mem_place_region_t mem_place_region(const void *ptr);
+
+// Print the map: each buffer with its class, size and region, the totals per region and the free heap
+void mem_place_report(void);
+
+// Bandwidth of the bulk movers per subsystem. Each copy or transfer adds its bytes to the counters of its
+// subsystem, with the bytes that crossed the PSRAM bus apart: a copy counts once for each side in PSRAM.
+// mem_place_bw_start samples the counters every period, mem_place_bw_report prints MB/s over the last
+// second and the whole history next to what the PSRAM bus can carry, so it shows who takes the shared bus.
+// Without CONFIG_MEM_PLACE_BW the counting calls compile to nothing.
+
+typedef enum {
+    MEM_PLACE_BW_CAM = 0,   // camera DMA and the frame copy of the capture task
+    MEM_PLACE_BW_LCD,       // pixels pushed to the LCD
+    MEM_PLACE_BW_AUDIO,     // audio ring buffers
+    MEM_PLACE_BW_SD,        // SD card writes
+    MEM_PLACE_BW_JPEG,      // JPEG decoder input and output
+    MEM_PLACE_BW_TTS,       // voice data
+    MEM_PLACE_BW_MAX,
+} mem_place_bw_sub_t;
+
+typedef struct {
+    uint32_t bytes_per_s;   // moved
+    uint32_t psram_per_s;   // over the PSRAM bus
+} mem_place_bw_rate_t;
+
+#if CONFIG_MEM_PLACE_BW
+void mem_place_bw_add(mem_place_bw_sub_t sub, uint32_t bytes, uint32_t psram);
+
+// A CPU copy of bytes from src to dst, either may be NULL for data generated or consumed in registers
+static inline void mem_place_bw_copy(mem_place_bw_sub_t sub, const void *dst, const void *src, size_t bytes)
+{
+    mem_place_bw_add(sub, bytes, ((dst && esp_ptr_external_ram(dst)) + (src && esp_ptr_external_ram(src))) * bytes);
+}
+
+// A DMA or driver transfer of bytes from or to buf
+static inline void mem_place_bw_io(mem_place_bw_sub_t sub, const void *buf, size_t bytes)
+{
+    mem_place_bw_add(sub, bytes, esp_ptr_external_ram(buf) ? bytes : 0);
+}
+#else
+static inline void mem_place_bw_copy(mem_place_bw_sub_t sub, const void *dst, const void *src, size_t bytes)
+{
+}
+
+static inline void mem_place_bw_io(mem_place_bw_sub_t sub, const void *buf, size_t bytes)
+{
+}
+#endif
+
+// Sample the counters every period_ms, 0: 100. -1 when the timer could not be started or counting is off
+int mem_place_bw_start(uint32_t period_ms);
+
+// Rate of a subsystem over the last window_ms, as far as the history goes back. -1 before two samples
+int mem_place_bw_get(mem_place_bw_sub_t sub, uint32_t window_ms, mem_place_bw_rate_t *rate);
+
+// PSRAM bus bandwidth the configured clock and mode allow, in bytes per second
+uint32_t mem_place_bw_psram_peak(void);
+
+// Print the rate of every subsystem over the last second and the whole history, and their PSRAM total
+void mem_place_bw_report(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,183 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "soc/soc_memory_layout.h"
+#include "sdkconfig.h"
+#include "mem_place.h"
+
+static const char *TAG = "mem_place";
+
+#define MEM_PLACE_CAPS_DMA   (MALLOC_CAP_DMA | MALLOC_CAP_8BIT)
+#define MEM_PLACE_CAPS_INT   (MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT)
+#define MEM_PLACE_CAPS_PSRAM (MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT)
+
+#define MEM_PLACE_RESERVE (CONFIG_MEM_PLACE_INTERNAL_RESERVE * 1024)
+
+typedef struct {
+    void *ptr;
+    const char *name;
+    uint32_t size;
+    uint8_t cls;
+    uint8_t region;
+} mem_place_record_t;
+
+static mem_place_record_t mem_place_map[CONFIG_MEM_PLACE_RECORDS];
+static int mem_place_untracked;
+static int mem_place_failed;
+
+static portMUX_TYPE mem_place_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static const char *mem_place_class_name[MEM_PLACE_MAX] = {"dma", "isr", "io", "hot", "bulk"};
+
+mem_place_region_t mem_place_region(const void *ptr)
+{
+    return esp_ptr_external_ram(ptr) ? MEM_PLACE_REGION_PSRAM : MEM_PLACE_REGION_INTERNAL;
+}
+
+// Not where the class goes first
+static int mem_place_spilled(const mem_place_record_t *r)
+{
+    return r->region != (r->cls == MEM_PLACE_BULK ? MEM_PLACE_REGION_PSRAM : MEM_PLACE_REGION_INTERNAL);
+}
+
+// Internal RAM left for DMA buffers after size more bytes
+static int mem_place_spare(size_t size)
+{
+    return heap_caps_get_free_size(MEM_PLACE_CAPS_INT) >= size + MEM_PLACE_RESERVE;
+}
+
+static void mem_place_track(const char *name, mem_place_class_t cls, void *ptr, size_t size)
+{
+    mem_place_record_t *slot = NULL;
+    portENTER_CRITICAL(&mem_place_lock);
+    for (int i = 0; i < CONFIG_MEM_PLACE_RECORDS; i++) {
+        // 地址被重新分配说明原来的 buffer 已经被 free() 释放
+        if (mem_place_map[i].ptr == ptr) {
+            slot = &mem_place_map[i];
+            break;
+        }
+        if (!slot && mem_place_map[i].ptr == NULL) {
+            slot = &mem_place_map[i];
+        }
+    }
+    if (slot) {
+        slot->ptr = ptr;
+        slot->name = name;
+        slot->size = size;
+        slot->cls = cls;
+        slot->region = mem_place_region(ptr);
+    } else {
+        mem_place_untracked++;
+    }
+    portEXIT_CRITICAL(&mem_place_lock);
+}
+
+void *mem_place_alloc(const char *name, mem_place_class_t cls, size_t size)
+{
+    void *ptr = NULL;
+    switch (cls) {
+        case MEM_PLACE_DMA:
+            ptr = heap_caps_malloc(size, MEM_PLACE_CAPS_DMA);
+            break;
+        case MEM_PLACE_ISR:
+            ptr = heap_caps_malloc(size, MEM_PLACE_CAPS_INT);
+            break;
+        case MEM_PLACE_IO:
+            if (mem_place_spare(size)) {
+                ptr = heap_caps_malloc(size, MEM_PLACE_CAPS_DMA);
+            }
+            if (!ptr) {
+                ptr = heap_caps_malloc(size, MEM_PLACE_CAPS_PSRAM);
+            }
+            break;
+        case MEM_PLACE_HOT:
+            if (mem_place_spare(size)) {
+                ptr = heap_caps_malloc(size, MEM_PLACE_CAPS_INT);
+            }
+            if (!ptr) {
+                ptr = heap_caps_malloc(size, MEM_PLACE_CAPS_PSRAM);
+            }
+            if (!ptr) {
+                // 没有 PSRAM 时不受预留限制，慢总比没有好
+                ptr = heap_caps_malloc(size, MEM_PLACE_CAPS_INT);
+            }
+            break;
+        case MEM_PLACE_BULK:
+            ptr = heap_caps_malloc(size, MEM_PLACE_CAPS_PSRAM);
+            if (!ptr && mem_place_spare(size)) {
+                ptr = heap_caps_malloc(size, MEM_PLACE_CAPS_INT);
+            }
+            break;
+        default:
+            ESP_LOGE(TAG, "%s: class %d error\n", name, cls);
+            return NULL;
+    }
+    if (!ptr) {
+        ESP_LOGE(TAG, "%s: %u bytes of %s malloc error\n", name, size, mem_place_class_name[cls]);
+        portENTER_CRITICAL(&mem_place_lock);
+        mem_place_failed++;
+        portEXIT_CRITICAL(&mem_place_lock);
+        return NULL;
+    }
+    mem_place_track(name, cls, ptr, size);
+    return ptr;
+}
+
+void *mem_place_calloc(const char *name, mem_place_class_t cls, size_t n, size_t size)
+{
+    void *ptr = mem_place_alloc(name, cls, n * size);
+    if (ptr) {
+        memset(ptr, 0, n * size);
+    }
+    return ptr;
+}
+
+void mem_place_free(void *ptr)
+{
+    if (!ptr) {
+        return;
+    }
+    portENTER_CRITICAL(&mem_place_lock);
+    for (int i = 0; i < CONFIG_MEM_PLACE_RECORDS; i++) {
+        if (mem_place_map[i].ptr == ptr) {
+            mem_place_map[i].ptr = NULL;
+            break;
+        }
+    }
+    portEXIT_CRITICAL(&mem_place_lock);
+    heap_caps_free(ptr);
+}
+
+void mem_place_report(void)
+{
+    static mem_place_record_t map[CONFIG_MEM_PLACE_RECORDS];
+    portENTER_CRITICAL(&mem_place_lock);
+    memcpy(map, mem_place_map, sizeof(map));
+    int untracked = mem_place_untracked;
+    int failed = mem_place_failed;
+    portEXIT_CRITICAL(&mem_place_lock);
+
+    uint32_t bytes[2] = {0, 0};
+    int cnt[2] = {0, 0};
+    int spilled = 0;
+    ESP_LOGI(TAG, "%-16s %-5s %8s  %s\n", "buffer", "class", "bytes", "region");
+    for (int i = 0; i < CONFIG_MEM_PLACE_RECORDS; i++) {
+        if (!map[i].ptr) {
+            continue;
+        }
+        bytes[map[i].region] += map[i].size;
+        cnt[map[i].region]++;
+        spilled += mem_place_spilled(&map[i]);
+        ESP_LOGI(TAG, "%-16s %-5s %8u  %s%s\n", map[i].name, mem_place_class_name[map[i].cls], map[i].size,
+                 map[i].region == MEM_PLACE_REGION_PSRAM ? "psram" : "internal", mem_place_spilled(&map[i]) ? " (spilled)" : "");
+    }
+    ESP_LOGI(TAG, "internal: %u bytes in %d, psram: %u bytes in %d, spilled: %d, failed: %d, untracked: %d\n",
+             bytes[MEM_PLACE_REGION_INTERNAL], cnt[MEM_PLACE_REGION_INTERNAL], bytes[MEM_PLACE_REGION_PSRAM], cnt[MEM_PLACE_REGION_PSRAM],
+             spilled, failed, untracked);
+    ESP_LOGI(TAG, "free internal: %u (largest %u), dma: %u, psram: %u\n",
+             heap_caps_get_free_size(MEM_PLACE_CAPS_INT), heap_caps_get_largest_free_block(MEM_PLACE_CAPS_INT),
+             heap_caps_get_free_size(MEM_PLACE_CAPS_DMA), heap_caps_get_free_size(MEM_PLACE_CAPS_PSRAM));
+}
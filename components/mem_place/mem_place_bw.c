@@ -0,0 +1,158 @@
+#include <stdio.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+#include "esp_attr.h"
+#include "sdkconfig.h"
+#include "mem_place.h"
+
+static const char *TAG = "mem_place_bw";
+
+static const char *mem_place_bw_name[MEM_PLACE_BW_MAX] = {"cam", "lcd", "audio", "sd", "jpeg", "tts"};
+
+uint32_t mem_place_bw_psram_peak(void)
+{
+    // quad SPI, 4 bits a clock
+#if CONFIG_SPIRAM_SPEED_80M
+    return 80000000 / 2;
+#elif CONFIG_SPIRAM_SPEED_40M
+    return 40000000 / 2;
+#elif CONFIG_SPIRAM_SPEED_26M
+    return 26000000 / 2;
+#elif CONFIG_SPIRAM_SPEED_20M
+    return 20000000 / 2;
+#else
+    return 0;
+#endif
+}
+
+#if CONFIG_MEM_PLACE_BW
+
+#define MEM_PLACE_BW_PERIOD_MS 100
+
+typedef struct {
+    int64_t time;
+    uint32_t bytes[MEM_PLACE_BW_MAX];
+    uint32_t psram[MEM_PLACE_BW_MAX];
+} mem_place_bw_sample_t;
+
+// free running, the differences of two samples are right across a wrap
+static DRAM_ATTR uint32_t mem_place_bw_bytes[MEM_PLACE_BW_MAX];
+static DRAM_ATTR uint32_t mem_place_bw_psram[MEM_PLACE_BW_MAX];
+static portMUX_TYPE mem_place_bw_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static mem_place_bw_sample_t mem_place_bw_history[CONFIG_MEM_PLACE_BW_HISTORY];
+static uint32_t mem_place_bw_head;     // samples taken, the history holds the last CONFIG_MEM_PLACE_BW_HISTORY
+static uint32_t mem_place_bw_period_ms;
+static esp_timer_handle_t mem_place_bw_timer;
+
+void IRAM_ATTR mem_place_bw_add(mem_place_bw_sub_t sub, uint32_t bytes, uint32_t psram)
+{
+    portENTER_CRITICAL_SAFE(&mem_place_bw_lock);
+    mem_place_bw_bytes[sub] += bytes;
+    mem_place_bw_psram[sub] += psram;
+    portEXIT_CRITICAL_SAFE(&mem_place_bw_lock);
+}
+
+static void mem_place_bw_sample(void *arg)
+{
+    mem_place_bw_sample_t *s = &mem_place_bw_history[mem_place_bw_head % CONFIG_MEM_PLACE_BW_HISTORY];
+    s->time = esp_timer_get_time();
+    portENTER_CRITICAL(&mem_place_bw_lock);
+    memcpy(s->bytes, mem_place_bw_bytes, sizeof(s->bytes));
+    memcpy(s->psram, mem_place_bw_psram, sizeof(s->psram));
+    portEXIT_CRITICAL(&mem_place_bw_lock);
+    mem_place_bw_head++;
+}
+
+int mem_place_bw_start(uint32_t period_ms)
+{
+    if (mem_place_bw_timer) {
+        return 0;
+    }
+    mem_place_bw_period_ms = period_ms ? period_ms : MEM_PLACE_BW_PERIOD_MS;
+    const esp_timer_create_args_t args = {
+        .callback = mem_place_bw_sample,
+        .name = "mem_place_bw",
+    };
+    if (esp_timer_create(&args, &mem_place_bw_timer) != ESP_OK) {
+        ESP_LOGE(TAG, "timer create error\n");
+        return -1;
+    }
+    mem_place_bw_sample(NULL);
+    if (esp_timer_start_periodic(mem_place_bw_timer, mem_place_bw_period_ms * 1000) != ESP_OK) {
+        ESP_LOGE(TAG, "timer start error\n");
+        esp_timer_delete(mem_place_bw_timer);
+        mem_place_bw_timer = NULL;
+        return -1;
+    }
+    return 0;
+}
+
+int mem_place_bw_get(mem_place_bw_sub_t sub, uint32_t window_ms, mem_place_bw_rate_t *rate)
+{
+    // the sampler runs in the esp_timer task, a copy of the two ends is consistent enough for a rate
+    uint32_t head = mem_place_bw_head;
+    uint32_t kept = head < CONFIG_MEM_PLACE_BW_HISTORY ? head : CONFIG_MEM_PLACE_BW_HISTORY;
+    if (sub >= MEM_PLACE_BW_MAX || kept < 2) {
+        return -1;
+    }
+    uint32_t back = window_ms / mem_place_bw_period_ms;
+    back = back < 1 ? 1 : (back > kept - 1 ? kept - 1 : back);
+    const mem_place_bw_sample_t *last = &mem_place_bw_history[(head - 1) % CONFIG_MEM_PLACE_BW_HISTORY];
+    const mem_place_bw_sample_t *first = &mem_place_bw_history[(head - 1 - back) % CONFIG_MEM_PLACE_BW_HISTORY];
+    int64_t us = last->time - first->time;
+    if (us <= 0) {
+        return -1;
+    }
+    rate->bytes_per_s = (uint64_t)(last->bytes[sub] - first->bytes[sub]) * 1000000 / us;
+    rate->psram_per_s = (uint64_t)(last->psram[sub] - first->psram[sub]) * 1000000 / us;
+    return 0;
+}
+
+// MB/s with two decimals
+#define MEM_PLACE_BW_MB(r) (r) / 1000000, (r) / 10000 % 100
+
+void mem_place_bw_report(void)
+{
+    mem_place_bw_rate_t now, all;
+    uint32_t psram_now = 0;
+    uint32_t span = CONFIG_MEM_PLACE_BW_HISTORY * mem_place_bw_period_ms;
+
+    ESP_LOGI(TAG, "%-6s %10s %10s %10s %10s  (MB/s, last 1 s and %u s)\n", "sub", "moved", "psram", "moved", "psram", span / 1000);
+    for (int sub = 0; sub < MEM_PLACE_BW_MAX; sub++) {
+        if (mem_place_bw_get(sub, 1000, &now) != 0 || mem_place_bw_get(sub, span, &all) != 0) {
+            ESP_LOGI(TAG, "not sampled yet, call mem_place_bw_start\n");
+            return;
+        }
+        psram_now += now.psram_per_s;
+        if (all.bytes_per_s == 0) {
+            continue;
+        }
+        ESP_LOGI(TAG, "%-6s %7u.%02u %7u.%02u %7u.%02u %7u.%02u\n", mem_place_bw_name[sub],
+                 MEM_PLACE_BW_MB(now.bytes_per_s), MEM_PLACE_BW_MB(now.psram_per_s),
+                 MEM_PLACE_BW_MB(all.bytes_per_s), MEM_PLACE_BW_MB(all.psram_per_s));
+    }
+    uint32_t peak = mem_place_bw_psram_peak();
+    ESP_LOGI(TAG, "psram: %u.%02u of %u.%02u MB/s peak, %u%%\n", MEM_PLACE_BW_MB(psram_now), MEM_PLACE_BW_MB(peak),
+             peak ? (uint32_t)((uint64_t)psram_now * 100 / peak) : 0);
+}
+
+#else
+
+int mem_place_bw_start(uint32_t period_ms)
+{
+    return -1;
+}
+
+int mem_place_bw_get(mem_place_bw_sub_t sub, uint32_t window_ms, mem_place_bw_rate_t *rate)
+{
+    return -1;
+}
+
+void mem_place_bw_report(void)
+{
+}
+
+#endif
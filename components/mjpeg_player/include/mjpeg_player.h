@@ -0,0 +1,47 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Play MJPEG clips on the LCD in three stages, each its own task: the reader reads the next JPEG frame ahead,
+// the decoder decodes the current one with tjpgd a row of MCUs at a time, and the LCD task sends finished rows
+// with lcd_write_data_async while the rows below them are still being decoded.
+// Frames start decoding on a fixed schedule of fps, a frame more than one period late is skipped so playback
+// keeps the clip's time line
+
+// Next JPEG frame into buf (size bytes), returns its length, 0: show the previous frame again, -1: end of clip
+typedef int (*mjpeg_player_read_t)(uint8_t *buf, size_t size, void *arg);
+
+typedef struct {
+    const char *path;            // an avi_mux AVI or a recorder file with its .idx, NULL: frames come from read_cb
+    mjpeg_player_read_t read_cb; // e.g. a network client
+    void *read_arg;
+    uint16_t x;                  // LCD window, the scaled frame is cropped to it
+    uint16_t y;
+    uint16_t width;
+    uint16_t high;
+    uint8_t scale;               // 0 ~ 3, decode at 1 / (1 << scale)
+    uint8_t fps;                 // 0: the AVI frame rate, 15 for other sources
+    uint8_t loop;                // start path over at its end
+    uint32_t frame_buffer_size;  // largest JPEG frame, 0: 64 KB
+    uint8_t task_pri;
+} mjpeg_player_config_t;
+
+int mjpeg_player_start(const mjpeg_player_config_t *config);
+
+// Wait for the end of the clip, returns -1 on timeout
+int mjpeg_player_wait(uint32_t timeout_ms);
+
+// Stop the tasks and free everything, also needed after the clip ended
+void mjpeg_player_stop(void);
+
+// Frames sent to the LCD and frames skipped because they were late
+void mjpeg_player_get_stats(uint32_t *shown, uint32_t *skipped);
+
+#ifdef __cplusplus
+}
+#endif
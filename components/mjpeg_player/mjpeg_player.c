@@ -0,0 +1,475 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "tjpgd.h"
+#include "lcd.h"
+#include "recorder.h"
+#include "mem_place.h"
+#include "mjpeg_player.h"
+
+static const char *TAG = "mjpeg_player";
+
+#define MJPEG_PLAYER_FRAME_CNT  (2)  // one being decoded, one read ahead
+#define MJPEG_PLAYER_STRIPE_CNT (3)  // one on the bus, one queued behind it, one being decoded
+#define MJPEG_PLAYER_STRIPE_LINES (16) // a row of 16x16 MCUs at 1:1
+#define MJPEG_PLAYER_WORK_SIZE  (2780 + 4096) // tjpgd work space with the JD_FASTDECODE lookup tables
+#define MJPEG_PLAYER_WAIT       (100 / portTICK_PERIOD_MS)
+
+typedef struct {
+    uint8_t *buf;
+    int len;       // -1: end of clip
+} mjpeg_player_frame_t;
+
+typedef struct {
+    uint16_t *buf; // NULL: end of clip
+    uint16_t ypos;
+    uint16_t lines;
+    uint16_t width;  // window of the frame the stripe belongs to
+    uint16_t high;
+} mjpeg_player_stripe_t;
+
+typedef struct {
+    mjpeg_player_config_t config;
+    volatile uint8_t run;
+    mjpeg_player_read_t read;
+    void *read_arg;
+    // file source
+    int fd;
+    int idx_fd;       // recorder file: its .idx, -1 for AVI
+    uint32_t movi_start;
+    uint32_t movi_end;
+    uint32_t pos;
+    int64_t period;   // us per frame
+    uint8_t *frame[MJPEG_PLAYER_FRAME_CNT];
+    uint16_t *stripe[MJPEG_PLAYER_STRIPE_CNT];
+    uint16_t *spare;  // stripe buffer returned by the last stripe callback of a frame
+    uint16_t out_width;
+    uint16_t out_high;
+    uint8_t *work;
+    QueueHandle_t frame_free;
+    QueueHandle_t frame_full;
+    QueueHandle_t stripe_free;
+    QueueHandle_t stripe_full;
+    SemaphoreHandle_t end_sem;
+    SemaphoreHandle_t done_sem; // one give per task that exited
+    uint8_t task_cnt;
+    uint32_t shown;
+    uint32_t skipped;
+} mjpeg_player_obj_t;
+
+static mjpeg_player_obj_t *mjpeg_player_obj = NULL;
+
+// Queue helpers that give up once mjpeg_player_stop clears run
+static int mjpeg_player_send(QueueHandle_t queue, const void *item)
+{
+    while (xQueueSend(queue, item, MJPEG_PLAYER_WAIT) != pdTRUE) {
+        if (!mjpeg_player_obj->run) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static int mjpeg_player_recv(QueueHandle_t queue, void *item)
+{
+    while (xQueueReceive(queue, item, MJPEG_PLAYER_WAIT) != pdTRUE) {
+        if (!mjpeg_player_obj->run) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static inline uint32_t mjpeg_player_le32(const uint8_t *p)
+{
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static int mjpeg_player_read_at(uint32_t pos, void *buf, size_t len)
+{
+    if (lseek(mjpeg_player_obj->fd, pos, SEEK_SET) != pos || read(mjpeg_player_obj->fd, buf, len) != len) {
+        return -1;
+    }
+    return 0;
+}
+
+// AVI: walk the movi list chunk by chunk, only stream 00 video chunks are returned
+static int mjpeg_player_avi_read(uint8_t *buf, size_t size, void *arg)
+{
+    uint8_t head[12];
+    while (mjpeg_player_obj->pos + 8 <= mjpeg_player_obj->movi_end) {
+        uint32_t pos = mjpeg_player_obj->pos;
+        if (mjpeg_player_read_at(pos, head, 12) != 0) {
+            return -1;
+        }
+        uint32_t len = mjpeg_player_le32(head + 4);
+        if (!memcmp(head, "LIST", 4)) {
+            mjpeg_player_obj->pos = pos + 12; // 'rec ' groups
+            continue;
+        }
+        mjpeg_player_obj->pos = pos + 8 + len + (len & 1);
+        if (head[0] != '0' || head[1] != '0' || head[2] != 'd' || (head[3] != 'c' && head[3] != 'b')) {
+            continue;
+        }
+        if (len > size) {
+            ESP_LOGW(TAG, "frame of %u bytes skipped, frame_buffer_size is %u\n", len, size);
+            continue;
+        }
+        if (len && mjpeg_player_read_at(pos + 8, buf, len) != 0) {
+            return -1;
+        }
+        return len;
+    }
+    return -1;
+}
+
+// recorder: frames back to back, located by the .idx entries
+static int mjpeg_player_idx_read(uint8_t *buf, size_t size, void *arg)
+{
+    recorder_index_t index;
+    while (read(mjpeg_player_obj->idx_fd, &index, sizeof(index)) == sizeof(index)) {
+        if (index.len > size) {
+            ESP_LOGW(TAG, "frame of %u bytes skipped, frame_buffer_size is %u\n", index.len, size);
+            continue;
+        }
+        if (mjpeg_player_read_at(index.offset, buf, index.len) != 0) {
+            return -1;
+        }
+        return index.len;
+    }
+    return -1;
+}
+
+static void mjpeg_player_rewind(void)
+{
+    if (mjpeg_player_obj->idx_fd >= 0) {
+        lseek(mjpeg_player_obj->idx_fd, 0, SEEK_SET);
+    } else {
+        mjpeg_player_obj->pos = mjpeg_player_obj->movi_start;
+    }
+}
+
+static int mjpeg_player_open(const char *path)
+{
+    uint8_t head[12];
+    mjpeg_player_obj->fd = open(path, O_RDONLY);
+    if (mjpeg_player_obj->fd < 0 || mjpeg_player_read_at(0, head, 12) != 0) {
+        return -1;
+    }
+    if (memcmp(head, "RIFF", 4) || memcmp(head + 8, "AVI ", 4)) {
+        char idx_path[72];
+        snprintf(idx_path, sizeof(idx_path), "%s.idx", path);
+        mjpeg_player_obj->idx_fd = open(idx_path, O_RDONLY);
+        mjpeg_player_obj->read = mjpeg_player_idx_read;
+        return mjpeg_player_obj->idx_fd < 0 ? -1 : 0;
+    }
+    // top level lists: hdrl for the frame period, movi for the chunks
+    uint32_t pos = 12;
+    while (mjpeg_player_read_at(pos, head, 12) == 0) {
+        uint32_t len = mjpeg_player_le32(head + 4);
+        if (!memcmp(head, "LIST", 4) && !memcmp(head + 8, "hdrl", 4) && mjpeg_player_read_at(pos + 12, head, 12) == 0 &&
+            !memcmp(head, "avih", 4) && mjpeg_player_le32(head + 8)) {
+            mjpeg_player_obj->period = mjpeg_player_le32(head + 8);
+        } else if (!memcmp(head, "LIST", 4) && !memcmp(head + 8, "movi", 4)) {
+            mjpeg_player_obj->movi_start = pos + 12;
+            mjpeg_player_obj->movi_end = pos + 8 + len;
+            mjpeg_player_obj->pos = pos + 12;
+            mjpeg_player_obj->read = mjpeg_player_avi_read;
+            return 0;
+        }
+        pos += 8 + len + (len & 1);
+    }
+    return -1;
+}
+
+static void mjpeg_player_reader_task(void *arg)
+{
+    mjpeg_player_frame_t frame;
+    while (mjpeg_player_recv(mjpeg_player_obj->frame_free, &frame.buf) == 0) {
+        frame.len = mjpeg_player_obj->read(frame.buf, mjpeg_player_obj->config.frame_buffer_size, mjpeg_player_obj->read_arg);
+        if (frame.len < 0 && mjpeg_player_obj->config.loop) {
+            mjpeg_player_rewind();
+            frame.len = mjpeg_player_obj->read(frame.buf, mjpeg_player_obj->config.frame_buffer_size, mjpeg_player_obj->read_arg);
+        }
+        if (mjpeg_player_send(mjpeg_player_obj->frame_full, &frame) != 0 || frame.len < 0) {
+            break;
+        }
+    }
+    xSemaphoreGive(mjpeg_player_obj->done_sem);
+    vTaskDelete(NULL);
+}
+
+// A row of MCUs is done: hand it to the LCD task and decode the next one into a free buffer
+static uint16_t *mjpeg_player_stripe_cb(JDEC *jd, uint16_t *buf, JRECT *rect)
+{
+    mem_place_bw_copy(MEM_PLACE_BW_JPEG, buf, NULL, (rect->bottom - rect->top + 1) * mjpeg_player_obj->out_width * 2);
+    mjpeg_player_stripe_t stripe = {
+        .buf = buf,
+        .ypos = rect->top,
+        .lines = rect->bottom - rect->top + 1,
+        .width = mjpeg_player_obj->out_width,
+        .high = mjpeg_player_obj->out_high,
+    };
+    mjpeg_player_obj->spare = NULL;
+    if (mjpeg_player_send(mjpeg_player_obj->stripe_full, &stripe) != 0 ||
+        mjpeg_player_recv(mjpeg_player_obj->stripe_free, &buf) != 0) {
+        return NULL;
+    }
+    mjpeg_player_obj->spare = buf;
+    return buf;
+}
+
+static void mjpeg_player_decode(const uint8_t *jpg, int len)
+{
+    JDEC jd;
+    uint16_t *buf;
+    mjpeg_player_config_t *config = &mjpeg_player_obj->config;
+    JRESULT r = jd_prepare_mem(&jd, jpg, len, mjpeg_player_obj->work, MJPEG_PLAYER_WORK_SIZE, NULL);
+    mem_place_bw_copy(MEM_PLACE_BW_JPEG, NULL, jpg, len);
+    if (r != JDR_OK) {
+        ESP_LOGW(TAG, "jd_prepare error: %d\n", r);
+        return;
+    }
+    uint16_t w = jd.width >> config->scale;
+    uint16_t h = jd.height >> config->scale;
+    mjpeg_player_obj->out_width = w < config->width ? w : config->width;
+    mjpeg_player_obj->out_high = h < config->high ? h : config->high;
+    if (mjpeg_player_recv(mjpeg_player_obj->stripe_free, &buf) != 0) {
+        return;
+    }
+    mjpeg_player_obj->spare = buf;
+    r = jd_decomp_stripe(&jd, mjpeg_player_stripe_cb, buf, mjpeg_player_obj->out_width,
+                         mjpeg_player_obj->out_width, mjpeg_player_obj->out_high, config->scale);
+    if (r != JDR_OK && r != JDR_INTR) {
+        ESP_LOGW(TAG, "jd_decomp error: %d\n", r);
+    }
+    if (mjpeg_player_obj->spare) {
+        xQueueSend(mjpeg_player_obj->stripe_free, &mjpeg_player_obj->spare, 0);
+        mjpeg_player_obj->spare = NULL;
+    }
+}
+
+static void mjpeg_player_decode_task(void *arg)
+{
+    mjpeg_player_frame_t frame;
+    mjpeg_player_stripe_t end = {0};
+    int64_t start = esp_timer_get_time();
+    int64_t n = 0;
+    while (mjpeg_player_recv(mjpeg_player_obj->frame_full, &frame) == 0) {
+        if (frame.len < 0) {
+            mjpeg_player_send(mjpeg_player_obj->stripe_full, &end);
+            break;
+        }
+        int64_t due = start + n++ * mjpeg_player_obj->period;
+        int64_t now = esp_timer_get_time();
+        if (now > due + mjpeg_player_obj->period) {
+            // 落后超过一帧就跳过，保持时间轴
+            mjpeg_player_obj->skipped++;
+        } else {
+            if (now < due) {
+                vTaskDelay((due - now) / 1000 / portTICK_PERIOD_MS);
+            }
+            if (frame.len > 0) {
+                mjpeg_player_decode(frame.buf, frame.len);
+            }
+            mjpeg_player_obj->shown++;
+        }
+        xQueueSend(mjpeg_player_obj->frame_free, &frame.buf, 0);
+    }
+    xSemaphoreGive(mjpeg_player_obj->done_sem);
+    vTaskDelete(NULL);
+}
+
+// Keep one stripe queued behind the one on the bus, a stripe goes back only once the next one is queued
+static void mjpeg_player_lcd_task(void *arg)
+{
+    mjpeg_player_config_t *config = &mjpeg_player_obj->config;
+    mjpeg_player_stripe_t stripe;
+    uint16_t *prev = NULL;
+    while (mjpeg_player_obj->run) {
+        if (xQueueReceive(mjpeg_player_obj->stripe_full, &stripe, MJPEG_PLAYER_WAIT) != pdTRUE) {
+            if (prev) {
+                lcd_wait_done();
+                xQueueSend(mjpeg_player_obj->stripe_free, &prev, 0);
+                prev = NULL;
+            }
+            continue;
+        }
+        if (prev) {
+            lcd_wait_done();
+            xQueueSend(mjpeg_player_obj->stripe_free, &prev, 0);
+            prev = NULL;
+        }
+        if (!stripe.buf) {
+            xSemaphoreGive(mjpeg_player_obj->end_sem);
+            break;
+        }
+        if (stripe.ypos == 0) {
+            lcd_set_index(config->x, config->y, config->x + stripe.width - 1, config->y + stripe.high - 1);
+        }
+        lcd_write_data_async((uint8_t *)stripe.buf, stripe.lines * stripe.width * 2);
+        prev = stripe.buf;
+    }
+    if (prev) {
+        lcd_wait_done();
+    }
+    xSemaphoreGive(mjpeg_player_obj->done_sem);
+    vTaskDelete(NULL);
+}
+
+int mjpeg_player_wait(uint32_t timeout_ms)
+{
+    if (!mjpeg_player_obj || xSemaphoreTake(mjpeg_player_obj->end_sem, timeout_ms / portTICK_PERIOD_MS) != pdTRUE) {
+        return -1;
+    }
+    xSemaphoreGive(mjpeg_player_obj->end_sem);
+    return 0;
+}
+
+void mjpeg_player_get_stats(uint32_t *shown, uint32_t *skipped)
+{
+    *shown = mjpeg_player_obj ? mjpeg_player_obj->shown : 0;
+    *skipped = mjpeg_player_obj ? mjpeg_player_obj->skipped : 0;
+}
+
+static void mjpeg_player_free(void)
+{
+    if (mjpeg_player_obj->fd >= 0) {
+        close(mjpeg_player_obj->fd);
+    }
+    if (mjpeg_player_obj->idx_fd >= 0) {
+        close(mjpeg_player_obj->idx_fd);
+    }
+    for (int i = 0; i < MJPEG_PLAYER_FRAME_CNT; i++) {
+        mem_place_free(mjpeg_player_obj->frame[i]);
+    }
+    for (int i = 0; i < MJPEG_PLAYER_STRIPE_CNT; i++) {
+        mem_place_free(mjpeg_player_obj->stripe[i]);
+    }
+    mem_place_free(mjpeg_player_obj->work);
+    if (mjpeg_player_obj->frame_free) {
+        vQueueDelete(mjpeg_player_obj->frame_free);
+    }
+    if (mjpeg_player_obj->frame_full) {
+        vQueueDelete(mjpeg_player_obj->frame_full);
+    }
+    if (mjpeg_player_obj->stripe_free) {
+        vQueueDelete(mjpeg_player_obj->stripe_free);
+    }
+    if (mjpeg_player_obj->stripe_full) {
+        vQueueDelete(mjpeg_player_obj->stripe_full);
+    }
+    if (mjpeg_player_obj->end_sem) {
+        vSemaphoreDelete(mjpeg_player_obj->end_sem);
+    }
+    if (mjpeg_player_obj->done_sem) {
+        vSemaphoreDelete(mjpeg_player_obj->done_sem);
+    }
+    free(mjpeg_player_obj);
+    mjpeg_player_obj = NULL;
+}
+
+void mjpeg_player_stop(void)
+{
+    if (!mjpeg_player_obj) {
+        return;
+    }
+    mjpeg_player_obj->run = 0;
+    for (int i = 0; i < mjpeg_player_obj->task_cnt; i++) {
+        xSemaphoreTake(mjpeg_player_obj->done_sem, portMAX_DELAY);
+    }
+    ESP_LOGI(TAG, "shown: %u, skipped: %u\n", mjpeg_player_obj->shown, mjpeg_player_obj->skipped);
+    mjpeg_player_free();
+}
+
+int mjpeg_player_start(const mjpeg_player_config_t *config)
+{
+    if (mjpeg_player_obj || (!config->path && !config->read_cb) || !config->width || !config->high || config->scale > 3) {
+        ESP_LOGE(TAG, "player busy or config error\n");
+        return -1;
+    }
+    mjpeg_player_obj = (mjpeg_player_obj_t *)calloc(1, sizeof(mjpeg_player_obj_t));
+    if (!mjpeg_player_obj) {
+        ESP_LOGE(TAG, "player object malloc error\n");
+        return -1;
+    }
+    mjpeg_player_obj->config = *config;
+    mjpeg_player_obj->config.path = NULL; // only used here, the caller's string may go away
+    mjpeg_player_obj->config.loop = config->loop && config->path;
+    mjpeg_player_obj->config.frame_buffer_size = config->frame_buffer_size ? config->frame_buffer_size : 64 * 1024;
+    mjpeg_player_obj->fd = -1;
+    mjpeg_player_obj->idx_fd = -1;
+    mjpeg_player_obj->period = 1000000 / 15;
+    mjpeg_player_obj->read = config->read_cb;
+    mjpeg_player_obj->read_arg = config->read_arg;
+    mjpeg_player_obj->run = 1;
+    if (config->path && mjpeg_player_open(config->path) != 0) {
+        ESP_LOGE(TAG, "open %s error\n", config->path);
+        mjpeg_player_free();
+        return -1;
+    }
+    if (config->fps) {
+        mjpeg_player_obj->period = 1000000 / config->fps;
+    }
+
+    mjpeg_player_obj->frame_free = xQueueCreate(MJPEG_PLAYER_FRAME_CNT, sizeof(uint8_t *));
+    mjpeg_player_obj->frame_full = xQueueCreate(MJPEG_PLAYER_FRAME_CNT, sizeof(mjpeg_player_frame_t));
+    mjpeg_player_obj->stripe_free = xQueueCreate(MJPEG_PLAYER_STRIPE_CNT, sizeof(uint16_t *));
+    mjpeg_player_obj->stripe_full = xQueueCreate(MJPEG_PLAYER_STRIPE_CNT + 1, sizeof(mjpeg_player_stripe_t));
+    mjpeg_player_obj->end_sem = xSemaphoreCreateBinary();
+    mjpeg_player_obj->done_sem = xSemaphoreCreateCounting(3, 0);
+    mjpeg_player_obj->work = (uint8_t *)mem_place_alloc("mjpeg_work", MEM_PLACE_HOT, MJPEG_PLAYER_WORK_SIZE);
+    if (!mjpeg_player_obj->frame_free || !mjpeg_player_obj->frame_full || !mjpeg_player_obj->stripe_free ||
+        !mjpeg_player_obj->stripe_full || !mjpeg_player_obj->end_sem || !mjpeg_player_obj->done_sem || !mjpeg_player_obj->work) {
+        ESP_LOGE(TAG, "player malloc error\n");
+        mjpeg_player_free();
+        return -1;
+    }
+    for (int i = 0; i < MJPEG_PLAYER_FRAME_CNT; i++) {
+        // 压缩帧放 PSRAM，tjpgd 按字节顺序读
+        mjpeg_player_obj->frame[i] = (uint8_t *)mem_place_alloc("mjpeg_frame", MEM_PLACE_BULK, mjpeg_player_obj->config.frame_buffer_size);
+        if (!mjpeg_player_obj->frame[i]) {
+            ESP_LOGE(TAG, "frame buffer malloc error\n");
+            mjpeg_player_free();
+            return -1;
+        }
+        xQueueSend(mjpeg_player_obj->frame_free, &mjpeg_player_obj->frame[i], 0);
+    }
+    for (int i = 0; i < MJPEG_PLAYER_STRIPE_CNT; i++) {
+        // 条带直接交给 SPI DMA
+        mjpeg_player_obj->stripe[i] = (uint16_t *)mem_place_alloc("mjpeg_stripe", MEM_PLACE_DMA, config->width * MJPEG_PLAYER_STRIPE_LINES * 2);
+        if (!mjpeg_player_obj->stripe[i]) {
+            ESP_LOGE(TAG, "stripe buffer malloc error\n");
+            mjpeg_player_free();
+            return -1;
+        }
+        xQueueSend(mjpeg_player_obj->stripe_free, &mjpeg_player_obj->stripe[i], 0);
+    }
+
+    // LCD and reader above the decoder so the bus is refilled and the next read issued as soon as they can be
+    if (xTaskCreate(mjpeg_player_lcd_task, "mjpeg_lcd", 2048, NULL, config->task_pri + 1, NULL) == pdPASS) {
+        mjpeg_player_obj->task_cnt++;
+    }
+    if (xTaskCreate(mjpeg_player_reader_task, "mjpeg_reader", 3072, NULL, config->task_pri + 1, NULL) == pdPASS) {
+        mjpeg_player_obj->task_cnt++;
+    }
+    if (xTaskCreate(mjpeg_player_decode_task, "mjpeg_decode", 4096, NULL, config->task_pri, NULL) == pdPASS) {
+        mjpeg_player_obj->task_cnt++;
+    }
+    if (mjpeg_player_obj->task_cnt != 3) {
+        ESP_LOGE(TAG, "player task create error\n");
+        mjpeg_player_stop();
+        return -1;
+    }
+    ESP_LOGI(TAG, "playing %s, %dx%d at %d us per frame\n", config->path ? config->path : "stream", config->width,
+             config->high, (int)mjpeg_player_obj->period);
+    return 0;
+}
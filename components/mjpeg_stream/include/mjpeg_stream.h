@@ -0,0 +1,25 @@
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    uint16_t port;              // HTTP port, 0: 80
+    uint8_t task_pri;
+    uint32_t send_timeout_ms;   // a client that can not take a frame within this time is dropped, 0: 2000
+    uint32_t max_age_ms;        // frames older than this when taken are given back unsent, 0: 200
+    uint32_t target_kbps;       // step the OV2640 JPEG quality to hold this bitrate, see jpeg_rate.h, 0: fixed quality
+    uint8_t target_fps;         // frame rate the bitrate is shared by, 0: 15
+} mjpeg_stream_config_t;
+
+// Serve the camera as multipart MJPEG on http://<ip>:<port>/, one client at a time.
+// The camera must run in jpeg mode, the streaming task takes and gives its frames.
+// Use mode.latest so capture keeps running while a slow client holds a frame
+int mjpeg_stream_start(const mjpeg_stream_config_t *config);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,146 @@
+#include <stdio.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "lwip/sockets.h"
+#include "cam.h"
+#include "jpeg_rate.h"
+#include "mjpeg_stream.h"
+
+static const char *TAG = "mjpeg_stream";
+
+#define MJPEG_BOUNDARY  "123456789000000000000987654321"
+
+static const char *mjpeg_header = "HTTP/1.1 200 OK\r\n"
+                                  "Content-Type: multipart/x-mixed-replace;boundary=" MJPEG_BOUNDARY "\r\n"
+                                  "Cache-Control: no-cache\r\n"
+                                  "Connection: close\r\n\r\n";
+
+static const char *mjpeg_part = "\r\n--" MJPEG_BOUNDARY "\r\n"
+                                "Content-Type: image/jpeg\r\n"
+                                "Content-Length: %u\r\n\r\n";
+
+typedef struct {
+    uint16_t port;
+    uint32_t send_timeout_ms;
+    int64_t max_age;
+    uint32_t sent;
+    uint32_t dropped;
+} mjpeg_stream_obj_t;
+
+static mjpeg_stream_obj_t *mjpeg_obj = NULL;
+
+static int mjpeg_send_all(int fd, const uint8_t *data, size_t len)
+{
+    while (len > 0) {
+        int ret = send(fd, data, len, 0);
+        if (ret <= 0) {
+            return -1; // error, or the send timeout hit
+        }
+        data += ret;
+        len -= ret;
+    }
+    return 0;
+}
+
+// Stream to one client until it goes away or stalls
+static void mjpeg_client(int fd)
+{
+    char part[128];
+    struct timeval timeout = {
+        .tv_sec = mjpeg_obj->send_timeout_ms / 1000,
+        .tv_usec = (mjpeg_obj->send_timeout_ms % 1000) * 1000,
+    };
+    setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    // Any request gets the stream, read it only to get it out of the way
+    recv(fd, part, sizeof(part), 0);
+
+    if (mjpeg_send_all(fd, (const uint8_t *)mjpeg_header, strlen(mjpeg_header)) != 0) {
+        return;
+    }
+    int64_t stat_time = esp_timer_get_time();
+    while (1) {
+        cam_frame_t *frame = cam_take_frame();
+        if (esp_timer_get_time() - frame->timestamp > mjpeg_obj->max_age) {
+            // We fell behind, sending a stale frame would only delay the fresh ones
+            cam_give_frame(frame);
+            mjpeg_obj->dropped++;
+            continue;
+        }
+        int len = snprintf(part, sizeof(part), mjpeg_part, frame->len);
+        int64_t send_start = esp_timer_get_time();
+        // Straight from the frame buffer, it goes back to the camera only once the socket has the data
+        int ret = mjpeg_send_all(fd, (const uint8_t *)part, len);
+        if (ret == 0) {
+            ret = mjpeg_send_all(fd, frame->buf, frame->len);
+        }
+        if (ret == 0) {
+            jpeg_rate_update(frame, esp_timer_get_time() - send_start); // no-op without rate control
+        }
+        cam_give_frame(frame);
+        if (ret != 0) {
+            return;
+        }
+        mjpeg_obj->sent++;
+        if (esp_timer_get_time() - stat_time >= 5 * 1000 * 1000) {
+            ESP_LOGI(TAG, "sent: %u, dropped: %u", mjpeg_obj->sent, mjpeg_obj->dropped);
+            stat_time = esp_timer_get_time();
+        }
+    }
+}
+
+static void mjpeg_stream_task(void *arg)
+{
+    struct sockaddr_in addr = {
+        .sin_family = AF_INET,
+        .sin_port = htons(mjpeg_obj->port),
+        .sin_addr.s_addr = htonl(INADDR_ANY),
+    };
+    int listen_fd = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (listen_fd < 0 || bind(listen_fd, (struct sockaddr *)&addr, sizeof(addr)) != 0 || listen(listen_fd, 1) != 0) {
+        ESP_LOGE(TAG, "socket setup error\n");
+        vTaskDelete(NULL);
+        return;
+    }
+    ESP_LOGI(TAG, "listening on port %d\n", mjpeg_obj->port);
+
+    while (1) {
+        int fd = accept(listen_fd, NULL, NULL);
+        if (fd < 0) {
+            continue;
+        }
+        ESP_LOGI(TAG, "client connected\n");
+        mjpeg_client(fd);
+        close(fd);
+        ESP_LOGI(TAG, "client closed, sent: %u, dropped: %u\n", mjpeg_obj->sent, mjpeg_obj->dropped);
+    }
+}
+
+int mjpeg_stream_start(const mjpeg_stream_config_t *config)
+{
+    mjpeg_obj = (mjpeg_stream_obj_t *)calloc(1, sizeof(mjpeg_stream_obj_t));
+    if (!mjpeg_obj) {
+        ESP_LOGE(TAG, "mjpeg stream object malloc error\n");
+        return -1;
+    }
+    mjpeg_obj->port = config->port ? config->port : 80;
+    mjpeg_obj->send_timeout_ms = config->send_timeout_ms ? config->send_timeout_ms : 2000;
+    mjpeg_obj->max_age = (int64_t)(config->max_age_ms ? config->max_age_ms : 200) * 1000;
+    if (config->target_kbps) {
+        jpeg_rate_config_t rate_config = {
+            .target_kbps = config->target_kbps,
+            .target_fps = config->target_fps,
+        };
+        if (jpeg_rate_init(&rate_config) != 0) {
+            return -1;
+        }
+    }
+    if (xTaskCreate(mjpeg_stream_task, "mjpeg_stream", 1024 * 4, NULL, config->task_pri, NULL) != pdPASS) {
+        ESP_LOGE(TAG, "mjpeg stream task create error\n");
+        return -1;
+    }
+    return 0;
+}
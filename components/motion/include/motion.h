@@ -0,0 +1,47 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Frame-to-frame motion detection on a downscaled luma copy.
+// Each frame is reduced to one luma sample per scale x scale pixels, compared block by block
+// with the previous one, and the moved blocks are reported as one bounding box in frame pixels.
+
+typedef struct {
+    uint16_t x;
+    uint16_t y;
+    uint16_t width;
+    uint16_t high;
+    uint16_t blocks;  // number of moved blocks inside the box
+} motion_event_t;
+
+typedef void (*motion_cb_t)(const motion_event_t *event, void *arg);
+
+typedef struct {
+    uint16_t width;      // frame size in pixels
+    uint16_t high;
+    uint8_t bpp;         // 2: RGB565 (LCD order), 1: 8 bit luma (CAM_FORMAT_Y)
+    uint8_t scale;       // one luma sample per scale x scale pixels, width / scale must be a multiple of 4
+    uint8_t block;       // block side in samples, a multiple of 4 up to 32
+    uint8_t threshold;   // mean per sample luma difference (0~255) above which a block has moved
+    uint16_t min_blocks; // moved blocks needed for an event, 0: 1
+    uint8_t jobs;        // split each frame into this many bands of block rows on the job pool (jobs.h), 0/1: in the calling task
+    motion_cb_t cb;      // 可选，检测到运动时在 motion_detect 中调用
+    void *arg;
+} motion_config_t;
+
+// Returns 1 and fills event (may be NULL) when the frame moved against the previous one,
+// 0 for a static frame or the first frame after init, -1 on error
+int motion_detect(const uint8_t *frame, motion_event_t *event);
+
+int motion_init(const motion_config_t *config);
+
+void motion_deinit(void);
+
+#ifdef __cplusplus
+}
+#endif
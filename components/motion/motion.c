@@ -0,0 +1,235 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_log.h"
+#include "jobs.h"
+#include "motion.h"
+
+static const char *TAG = "motion";
+
+#define MOTION_LANE_MSB 0x80808080
+#define MOTION_LANE_LOW 0x7f7f7f7f
+
+// Moved blocks of one row of blocks
+typedef struct {
+    uint16_t moved;
+    uint16_t x_min;
+    uint16_t x_max;
+} motion_row_t;
+
+typedef struct {
+    motion_config_t config;
+    int sample_width;
+    int sample_high;
+    int block_width;   // blocks per row
+    int block_high;
+    uint32_t block_threshold;
+    uint8_t *ref;      // previous frame samples
+    uint8_t *cur;
+    int has_ref;
+    const uint8_t *frame;  // of the motion_detect running
+    motion_row_t *rows;
+} motion_obj_t;
+
+static motion_obj_t *motion_obj = NULL;
+
+// Samples are kept as 7 bit luma, so the byte lanes of a word can be subtracted without borrows
+static inline uint8_t motion_luma(const uint8_t *p)
+{
+    uint32_t r = p[0] & 0xf8;
+    uint32_t g = ((p[0] & 0x07) << 5) | ((p[1] & 0xe0) >> 3);
+    uint32_t b = (p[1] & 0x1f) << 3;
+    return (r * 77 + g * 150 + b * 29) >> 9;
+}
+
+// Sample rows [start, end)
+static void motion_downscale(const uint8_t *frame, uint8_t *dst, int start, int end)
+{
+    int scale = motion_obj->config.scale;
+    size_t line_size = motion_obj->config.width * motion_obj->config.bpp;
+    dst += start * motion_obj->sample_width;
+    for (int y = start; y < end; y++) {
+        const uint8_t *line = frame + y * scale * line_size;
+        if (motion_obj->config.bpp == 1) {
+            for (int x = 0; x < motion_obj->sample_width; x++) {
+                dst[x] = line[x * scale] >> 1;
+            }
+        } else {
+            for (int x = 0; x < motion_obj->sample_width; x++) {
+                dst[x] = motion_luma(line + x * scale * 2);
+            }
+        }
+        dst += motion_obj->sample_width;
+    }
+}
+
+// |a - b| of four 7 bit lanes at once
+static inline uint32_t motion_absdiff4(uint32_t a, uint32_t b)
+{
+    uint32_t ab = (a | MOTION_LANE_MSB) - b; // lane MSB stays set where a >= b
+    uint32_t ba = (b | MOTION_LANE_MSB) - a;
+    uint32_t mask = ((ab & MOTION_LANE_MSB) >> 7) * 0x7f;
+    return (ab & mask) | (ba & ~mask & MOTION_LANE_LOW);
+}
+
+static uint32_t motion_block_sad(const uint8_t *a, const uint8_t *b)
+{
+    int stride = motion_obj->sample_width;
+    int words = motion_obj->config.block / 4;
+    uint32_t acc = 0; // two 16 bit lanes, at most 32 * 8 * 254 per lane
+    for (int y = 0; y < motion_obj->config.block; y++) {
+        const uint32_t *a32 = (const uint32_t *)(a + y * stride);
+        const uint32_t *b32 = (const uint32_t *)(b + y * stride);
+        for (int x = 0; x < words; x++) {
+            uint32_t d = motion_absdiff4(a32[x], b32[x]);
+            acc += (d & 0x00ff00ff) + ((d >> 8) & 0x00ff00ff);
+        }
+    }
+    return (acc & 0xffff) + (acc >> 16);
+}
+
+// Block rows [start, end): their samples, then the blocks against the reference. A range of jobs_parallel,
+// it only writes its own sample rows and motion_row_t
+static void motion_rows(void *arg, int start, int end)
+{
+    int block = motion_obj->config.block;
+    // the last range also takes the sample rows left over by the grid, they become part of the reference
+    motion_downscale(motion_obj->frame, motion_obj->cur, start * block,
+                     end == motion_obj->block_high ? motion_obj->sample_high : end * block);
+    if (!motion_obj->has_ref) {
+        return;
+    }
+    for (int by = start; by < end; by++) {
+        motion_row_t row = {.x_min = motion_obj->block_width};
+        size_t offset = by * block * motion_obj->sample_width;
+        for (int bx = 0; bx < motion_obj->block_width; bx++, offset += block) {
+            if (motion_block_sad(motion_obj->cur + offset, motion_obj->ref + offset) <= motion_obj->block_threshold) {
+                continue;
+            }
+            row.moved++;
+            row.x_min = bx < row.x_min ? bx : row.x_min;
+            row.x_max = bx;
+        }
+        motion_obj->rows[by] = row;
+    }
+}
+
+int motion_detect(const uint8_t *frame, motion_event_t *event)
+{
+    if (!motion_obj || !frame) {
+        return -1;
+    }
+    motion_obj->frame = frame;
+    if (motion_obj->config.jobs > 1) {
+        jobs_parallel(JOBS_PRI_HIGH, motion_obj->block_high, motion_obj->config.jobs, motion_rows, NULL);
+    } else {
+        motion_rows(NULL, 0, motion_obj->block_high);
+    }
+    if (!motion_obj->has_ref) {
+        motion_obj->has_ref = 1;
+        uint8_t *tmp = motion_obj->ref;
+        motion_obj->ref = motion_obj->cur;
+        motion_obj->cur = tmp;
+        return 0;
+    }
+
+    int block = motion_obj->config.block;
+    int x_min = motion_obj->block_width, y_min = motion_obj->block_high, x_max = -1, y_max = -1;
+    int moved = 0;
+    for (int by = 0; by < motion_obj->block_high; by++) {
+        const motion_row_t *row = &motion_obj->rows[by];
+        if (!row->moved) {
+            continue;
+        }
+        moved += row->moved;
+        x_min = row->x_min < x_min ? row->x_min : x_min;
+        x_max = row->x_max > x_max ? row->x_max : x_max;
+        y_min = by < y_min ? by : y_min;
+        y_max = by;
+    }
+    // 当前帧成为下一帧的参考，交换指针即可
+    uint8_t *tmp = motion_obj->ref;
+    motion_obj->ref = motion_obj->cur;
+    motion_obj->cur = tmp;
+    if (moved < motion_obj->config.min_blocks) {
+        return 0;
+    }
+
+    motion_event_t motion = {0};
+    int size = block * motion_obj->config.scale; // block side in frame pixels
+    motion.x = x_min * size;
+    motion.y = y_min * size;
+    motion.width = (x_max + 1) * size - motion.x;
+    motion.high = (y_max + 1) * size - motion.y;
+    if (x_max == motion_obj->block_width - 1) { // edge blocks also cover the pixels left over by the grid
+        motion.width = motion_obj->config.width - motion.x;
+    }
+    if (y_max == motion_obj->block_high - 1) {
+        motion.high = motion_obj->config.high - motion.y;
+    }
+    motion.blocks = moved;
+    if (event) {
+        *event = motion;
+    }
+    if (motion_obj->config.cb) {
+        motion_obj->config.cb(&motion, motion_obj->config.arg);
+    }
+    return 1;
+}
+
+void motion_deinit(void)
+{
+    if (!motion_obj) {
+        return;
+    }
+    free(motion_obj->ref);
+    free(motion_obj->cur);
+    free(motion_obj->rows);
+    free(motion_obj);
+    motion_obj = NULL;
+}
+
+int motion_init(const motion_config_t *config)
+{
+    if (config->scale == 0 || (config->bpp != 1 && config->bpp != 2)) {
+        ESP_LOGE(TAG, "scale or bpp error\n");
+        return -1;
+    }
+    if (config->block == 0 || config->block % 4 || config->block > 32) {
+        ESP_LOGE(TAG, "block must be a multiple of 4 up to 32\n");
+        return -1;
+    }
+    int sample_width = config->width / config->scale;
+    int sample_high = config->high / config->scale;
+    if (sample_width % 4 || sample_width < config->block || sample_high < config->block) {
+        ESP_LOGE(TAG, "frame %dx%d can not be split into blocks\n", config->width, config->high);
+        return -1;
+    }
+    motion_deinit();
+    motion_obj = (motion_obj_t *)calloc(1, sizeof(motion_obj_t));
+    if (!motion_obj) {
+        ESP_LOGE(TAG, "motion object malloc error\n");
+        return -1;
+    }
+    motion_obj->config = *config;
+    if (motion_obj->config.min_blocks == 0) {
+        motion_obj->config.min_blocks = 1;
+    }
+    motion_obj->sample_width = sample_width;
+    motion_obj->sample_high = sample_high;
+    motion_obj->block_width = sample_width / config->block;
+    motion_obj->block_high = sample_high / config->block;
+    // threshold 是 8 bit 亮度的平均差，样本为 7 bit
+    motion_obj->block_threshold = (uint32_t)config->threshold * config->block * config->block / 2;
+    // 小图放在内部 RAM，按字访问
+    motion_obj->ref = (uint8_t *)malloc(sample_width * sample_high);
+    motion_obj->cur = (uint8_t *)malloc(sample_width * sample_high);
+    motion_obj->rows = (motion_row_t *)calloc(motion_obj->block_high, sizeof(motion_row_t));
+    if (!motion_obj->ref || !motion_obj->cur || !motion_obj->rows) {
+        ESP_LOGE(TAG, "sample buffer malloc error\n");
+        motion_deinit();
+        return -1;
+    }
+    ESP_LOGI(TAG, "samples: %dx%d, blocks: %dx%d\n", sample_width, sample_high, motion_obj->block_width, motion_obj->block_high);
+    return 0;
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Tuning knobs read at run time instead of compile-time constants: buffer sizes, clocks, DMA depths.
+// A component reads a knob at init or reconfigure time with param_int or param_bool, naming its default
+// and range. The first read registers it, and every read returns the value NVS holds for it, or the
+// default when there is none or it is out of range. The console changes values and stores them in NVS
+// ("param set lcd.clk_hz 40000000"), so a sweep over a knob needs a restart or a re-init of its
+// component per point, not a rebuild.
+//
+// Names are NVS keys: at most 15 characters, by convention "<component>.<knob>". They are kept by pointer.
+
+// Value of an integer knob within [min, max], def when not set
+int32_t param_int(const char *name, int32_t def, int32_t min, int32_t max, const char *help);
+
+// Value of an on/off knob
+bool param_bool(const char *name, bool def, const char *help);
+
+// Change a registered knob and store it in NVS, read again by its component at the next init.
+// -1 when it is not registered, out of range, or NVS fails
+int param_set(const char *name, int32_t value);
+
+// Back to the default and out of NVS, NULL: every knob
+int param_reset(const char *name);
+
+// Print every registered knob with its value, default, range and help
+void param_list(void);
+
+// Run a console line: "param list", "param get <name>", "param set <name> <value>", "param reset [<name>]".
+// 1 when the line is no param command, so a reader of other lines can hand it on; 0 done, -1 failed
+int param_command(const char *line);
+
+// Run the lines that come in on a UART as param commands, for applications that do not read the port
+// otherwise. Installs the UART driver. -1 when the driver or the task could not be created
+int param_console_start(int uart_port, int task_priority);
+
+#ifdef __cplusplus
+}
+#endif
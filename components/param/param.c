@@ -0,0 +1,338 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "nvs_flash.h"
+#include "nvs.h"
+#include "driver/uart.h"
+#include "sdkconfig.h"
+#include "param.h"
+
+static const char *TAG = "param";
+
+#define PARAM_NVS_NAMESPACE "param"
+#define PARAM_NAME_MAX      15      // NVS key length
+#define PARAM_LINE_MAX      96
+#define PARAM_ARGS_MAX      4
+
+typedef enum {
+    PARAM_TYPE_INT = 0,
+    PARAM_TYPE_BOOL,
+} param_type_t;
+
+typedef struct {
+    const char *name;
+    const char *help;
+    int32_t def;
+    int32_t min;
+    int32_t max;
+    int32_t value;
+    uint8_t type;
+    uint8_t stored;     // the value came from NVS
+} param_t;
+
+static param_t param_map[CONFIG_PARAM_MAX];
+static int param_num;
+static int param_dropped;
+
+static portMUX_TYPE param_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static int param_find(const char *name)
+{
+    for (int i = 0; i < param_num; i++) {
+        if (strcmp(param_map[i].name, name) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static esp_err_t param_nvs_open(nvs_open_mode_t mode, nvs_handle_t *nvs)
+{
+    // already up is fine, the application may have done it
+    esp_err_t err = nvs_flash_init();
+    if (err != ESP_OK) {
+        return err;
+    }
+    return nvs_open(PARAM_NVS_NAMESPACE, mode, nvs);
+}
+
+static int32_t param_register(const char *name, param_type_t type, int32_t def, int32_t min, int32_t max, const char *help)
+{
+    param_t p = {
+        .name = name,
+        .help = help,
+        .def = def,
+        .min = min,
+        .max = max,
+        .value = def,
+        .type = type,
+    };
+    int32_t value;
+    int i;
+
+    portENTER_CRITICAL(&param_lock);
+    i = param_find(name);
+    value = i >= 0 ? param_map[i].value : 0;
+    portEXIT_CRITICAL(&param_lock);
+    if (i >= 0) {
+        return value;
+    }
+
+    nvs_handle_t nvs;
+    if (strlen(name) <= PARAM_NAME_MAX && param_nvs_open(NVS_READONLY, &nvs) == ESP_OK) {
+        if (nvs_get_i32(nvs, name, &value) == ESP_OK) {
+            if (value >= min && value <= max) {
+                p.value = value;
+                p.stored = 1;
+            } else {
+                // the range changed with the firmware
+                ESP_LOGW(TAG, "%s: stored %d out of %d..%d, default %d used\n", name, value, min, max, def);
+            }
+        }
+        nvs_close(nvs);
+    }
+
+    portENTER_CRITICAL(&param_lock);
+    i = param_find(name);
+    if (i >= 0) {
+        p.value = param_map[i].value;
+    } else if (param_num < CONFIG_PARAM_MAX) {
+        param_map[param_num++] = p;
+    } else {
+        param_dropped++;
+    }
+    portEXIT_CRITICAL(&param_lock);
+    if (p.stored) {
+        ESP_LOGI(TAG, "%s = %d\n", name, p.value);
+    }
+    return p.value;
+}
+
+int32_t param_int(const char *name, int32_t def, int32_t min, int32_t max, const char *help)
+{
+    return param_register(name, PARAM_TYPE_INT, def, min, max, help);
+}
+
+bool param_bool(const char *name, bool def, const char *help)
+{
+    return param_register(name, PARAM_TYPE_BOOL, def, 0, 1, help) != 0;
+}
+
+int param_set(const char *name, int32_t value)
+{
+    param_t p;
+    int i;
+
+    portENTER_CRITICAL(&param_lock);
+    i = param_find(name);
+    if (i >= 0) {
+        p = param_map[i];
+    }
+    portEXIT_CRITICAL(&param_lock);
+    if (i < 0) {
+        ESP_LOGE(TAG, "%s: no such parameter\n", name);
+        return -1;
+    }
+    if (value < p.min || value > p.max) {
+        ESP_LOGE(TAG, "%s: %d out of %d..%d\n", name, value, p.min, p.max);
+        return -1;
+    }
+
+    nvs_handle_t nvs;
+    esp_err_t err = param_nvs_open(NVS_READWRITE, &nvs);
+    if (err == ESP_OK) {
+        err = nvs_set_i32(nvs, name, value);
+        if (err == ESP_OK) {
+            err = nvs_commit(nvs);
+        }
+        nvs_close(nvs);
+    }
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "%s: nvs write error %d\n", name, err);
+        return -1;
+    }
+    portENTER_CRITICAL(&param_lock);
+    param_map[i].value = value;
+    param_map[i].stored = 1;
+    portEXIT_CRITICAL(&param_lock);
+    return 0;
+}
+
+int param_reset(const char *name)
+{
+    nvs_handle_t nvs;
+    esp_err_t err;
+    int i = -1;
+
+    if (name) {
+        portENTER_CRITICAL(&param_lock);
+        i = param_find(name);
+        portEXIT_CRITICAL(&param_lock);
+        if (i < 0) {
+            ESP_LOGE(TAG, "%s: no such parameter\n", name);
+            return -1;
+        }
+    }
+    err = param_nvs_open(NVS_READWRITE, &nvs);
+    if (err == ESP_OK) {
+        err = name ? nvs_erase_key(nvs, name) : nvs_erase_all(nvs);
+        if (err == ESP_ERR_NVS_NOT_FOUND) {
+            err = ESP_OK;
+        }
+        if (err == ESP_OK) {
+            err = nvs_commit(nvs);
+        }
+        nvs_close(nvs);
+    }
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "nvs erase error %d\n", err);
+        return -1;
+    }
+    portENTER_CRITICAL(&param_lock);
+    for (int k = 0; k < param_num; k++) {
+        if (i < 0 || k == i) {
+            param_map[k].value = param_map[k].def;
+            param_map[k].stored = 0;
+        }
+    }
+    portEXIT_CRITICAL(&param_lock);
+    return 0;
+}
+
+static void param_print(const param_t *p)
+{
+    if (p->type == PARAM_TYPE_BOOL) {
+        printf("%-15s %11s%c  default %s  %s\n", p->name, p->value ? "on" : "off", p->stored ? '*' : ' ',
+               p->def ? "on" : "off", p->help ? p->help : "");
+    } else {
+        printf("%-15s %11d%c  default %d, %d..%d  %s\n", p->name, p->value, p->stored ? '*' : ' ',
+               p->def, p->min, p->max, p->help ? p->help : "");
+    }
+}
+
+void param_list(void)
+{
+    static param_t map[CONFIG_PARAM_MAX];
+    portENTER_CRITICAL(&param_lock);
+    int num = param_num;
+    int dropped = param_dropped;
+    memcpy(map, param_map, num * sizeof(param_t));
+    portEXIT_CRITICAL(&param_lock);
+
+    for (int i = 0; i < num; i++) {
+        param_print(&map[i]);
+    }
+    printf("%d parameters, * set in NVS%s\n", num, dropped ? ", some not registered: raise CONFIG_PARAM_MAX" : "");
+}
+
+// "on" and "off" for the on/off knobs, decimal or 0x hex otherwise
+static int param_parse(const char *text, int32_t *value)
+{
+    char *end;
+    if (strcmp(text, "on") == 0 || strcmp(text, "off") == 0) {
+        *value = text[1] == 'n';
+        return 0;
+    }
+    *value = strtol(text, &end, 0);
+    return *end == '\0' && end != text ? 0 : -1;
+}
+
+int param_command(const char *line)
+{
+    char buf[PARAM_LINE_MAX];
+    char *argv[PARAM_ARGS_MAX];
+    char *save;
+    int argc = 0;
+
+    strlcpy(buf, line, sizeof(buf));
+    for (char *tok = strtok_r(buf, " \t\r\n", &save); tok && argc < PARAM_ARGS_MAX; tok = strtok_r(NULL, " \t\r\n", &save)) {
+        argv[argc++] = tok;
+    }
+    if (argc == 0 || strcmp(argv[0], "param") != 0) {
+        return 1;
+    }
+    if (argc == 1 || strcmp(argv[1], "list") == 0) {
+        param_list();
+        return 0;
+    }
+    if (strcmp(argv[1], "get") == 0 && argc == 3) {
+        param_t p;
+        int i;
+        portENTER_CRITICAL(&param_lock);
+        i = param_find(argv[2]);
+        if (i >= 0) {
+            p = param_map[i];
+        }
+        portEXIT_CRITICAL(&param_lock);
+        if (i < 0) {
+            printf("%s: no such parameter\n", argv[2]);
+            return -1;
+        }
+        param_print(&p);
+        return 0;
+    }
+    if (strcmp(argv[1], "set") == 0 && argc == 4) {
+        int32_t value;
+        if (param_parse(argv[3], &value) != 0) {
+            printf("%s: not a number\n", argv[3]);
+            return -1;
+        }
+        if (param_set(argv[2], value) != 0) {
+            return -1;
+        }
+        printf("%s = %s, read at the next init of its component\n", argv[2], argv[3]);
+        return 0;
+    }
+    if (strcmp(argv[1], "reset") == 0 && argc <= 3) {
+        return param_reset(argc == 3 ? argv[2] : NULL);
+    }
+    printf("param list | get <name> | set <name> <value> | reset [<name>]\n");
+    return -1;
+}
+
+static void param_console_task(void *arg)
+{
+    uart_port_t port = (uart_port_t)(intptr_t)arg;
+    char line[PARAM_LINE_MAX];
+    int len = 0;
+    uint8_t c;
+
+    while (1) {
+        if (uart_read_bytes(port, &c, 1, portMAX_DELAY) != 1) {
+            continue;
+        }
+        if (c == '\r' || c == '\n') {
+            uart_write_bytes(port, "\r\n", 2);
+            line[len] = '\0';
+            if (len && param_command(line) == 1) {
+                printf("not a param command\n");
+            }
+            len = 0;
+        } else if (c == '\b' || c == 0x7f) {
+            if (len) {
+                len--;
+                uart_write_bytes(port, "\b \b", 3);
+            }
+        } else if (len < sizeof(line) - 1) {
+            line[len++] = c;
+            uart_write_bytes(port, (const char *)&c, 1);
+        }
+    }
+}
+
+int param_console_start(int uart_port, int task_priority)
+{
+    if (uart_driver_install(uart_port, 256, 0, 0, NULL, 0) != ESP_OK) {
+        ESP_LOGE(TAG, "uart %d driver install error\n", uart_port);
+        return -1;
+    }
+    if (xTaskCreate(param_console_task, "param_console", 3072, (void *)(intptr_t)uart_port, task_priority, NULL) != pdPASS) {
+        ESP_LOGE(TAG, "console task create error\n");
+        uart_driver_delete(uart_port);
+        return -1;
+    }
+    return 0;
+}
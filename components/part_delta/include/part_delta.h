@@ -0,0 +1,47 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_partition.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Versioned data partitions (voice packs, model coefficients, assets) updated by block deltas instead of
+// whole images. Each one has two slots in the partition table, "<label>" and "<label>_b", and NVS keeps
+// which of them is active and the version it holds. tools/part_delta.py makes a patch from the image in the
+// active slot to the new one; part_delta_write applies it as it arrives, in chunks of any size, reading the
+// old blocks from the active slot and writing the new ones into the other. part_delta_end checks the SHA-256
+// of the result and only then switches the slots, so a download cut short or a patch for another base leaves
+// the active image as it was. Readers find the active slot with part_delta_active and pick up a new image
+// the next time they open it.
+//
+// A partition without a "<label>_b" slot is not versioned, part_delta_active returns it as is.
+
+typedef struct part_delta *part_delta_handle_t;
+
+// Active slot of a versioned partition, NULL when there is no "<label>" partition
+const esp_partition_t *part_delta_active(const char *label);
+
+// Version of the image in the active slot, 0 for the one flashed with the application
+uint32_t part_delta_version(const char *label);
+
+// Start an update of the partition, the patch follows in part_delta_write. -1 when it has no second slot
+int part_delta_begin(const char *label, part_delta_handle_t *handle);
+
+// Apply the next len bytes of the patch. The header, first, is checked against the label and the image in the
+// active slot, which takes a pass over it. -1 on a bad patch or a flash error, every later call fails too
+// and part_delta_end or part_delta_abort still has to free the handle
+int part_delta_write(part_delta_handle_t handle, const void *data, size_t len);
+
+// Check the new image and make its slot the active one. -1 when the patch was incomplete or the result does
+// not match, the active slot stays. The handle is freed either way
+int part_delta_end(part_delta_handle_t handle);
+
+// Drop an update, the active slot stays
+void part_delta_abort(part_delta_handle_t handle);
+
+#ifdef __cplusplus
+}
+#endif
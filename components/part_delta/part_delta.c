@@ -0,0 +1,431 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_spi_flash.h"
+#include "nvs.h"
+#include "mbedtls/sha256.h"
+#include "sdkconfig.h"
+#if CONFIG_IDF_TARGET_ESP32S3
+#include "esp32s3/rom/miniz.h"
+#elif CONFIG_IDF_TARGET_ESP32S2
+#include "esp32s2/rom/miniz.h"
+#else
+#include "esp32/rom/miniz.h"
+#endif
+#include "part_delta.h"
+
+static const char *TAG = "part_delta";
+
+#define PART_DELTA_NVS_NAMESPACE "part_delta"
+#define PART_DELTA_MAGIC         "PDLT"
+#define PART_DELTA_FORMAT        1
+#define PART_DELTA_LABEL_LEN     16
+#define PART_DELTA_LABEL_MAX     (PART_DELTA_LABEL_LEN - 3) // "<label>_b" and its NUL fit a partition label
+#define PART_DELTA_BLOCK         SPI_FLASH_SEC_SIZE
+
+// Ops of tools/part_delta.py, one per block of the new image
+#define PART_DELTA_OP_COPY       0   // u32 offset in the old image
+#define PART_DELTA_OP_FILL       1   // u8 value
+#define PART_DELTA_OP_XOR        2   // u32 offset, u32 length, zlib stream XOR the old bytes at offset
+#define PART_DELTA_OP_DATA       3   // u32 length, zlib stream
+
+#define PART_DELTA_INFLATE_FLAGS (TINFL_FLAG_PARSE_ZLIB_HEADER | TINFL_FLAG_USING_NON_WRAPPING_OUTPUT_BUF)
+
+typedef struct __attribute__((packed)) {
+    char magic[4];
+    uint32_t format;
+    char label[PART_DELTA_LABEL_LEN];
+    uint32_t version;       // of the new image
+    uint32_t block_size;
+    uint32_t block_count;
+    uint32_t base_size;
+    uint32_t new_size;
+    uint8_t base_sha[32];
+    uint8_t new_sha[32];
+} part_delta_header_t;
+
+// NVS record of a versioned partition, by label
+typedef struct {
+    uint32_t version;
+    uint8_t slot;
+} part_delta_state_t;
+
+typedef enum {
+    PART_DELTA_HEADER = 0,
+    PART_DELTA_OP,
+    PART_DELTA_ARG,
+    PART_DELTA_ZDATA,
+    PART_DELTA_DONE,
+    PART_DELTA_FAILED,
+} part_delta_step_t;
+
+struct part_delta {
+    char label[PART_DELTA_LABEL_LEN];
+    const esp_partition_t *src;     // active slot
+    const esp_partition_t *dst;
+    uint8_t dst_slot;
+    part_delta_step_t step;
+    part_delta_header_t hdr;
+    uint32_t got;                   // bytes of the header or the op argument so far
+    uint8_t op;
+    uint8_t arg[8];
+    uint32_t arg_len;
+    uint32_t zleft;                 // bytes of the zlib stream still to come
+    uint32_t out;                   // bytes of the block inflated
+    uint32_t block;                 // blocks written
+    uint8_t *buf;                   // the new block
+    uint8_t *old;                   // the old bytes it is made from
+    tinfl_decompressor *inflate;
+    mbedtls_sha256_context sha;
+};
+
+static const esp_partition_t *part_delta_slot(const char *label, int slot)
+{
+    char name[sizeof(((esp_partition_t *)0)->label)];
+    snprintf(name, sizeof(name), slot ? "%s_b" : "%s", label);
+    return esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, name);
+}
+
+static void part_delta_get_state(const char *label, part_delta_state_t *state)
+{
+    nvs_handle_t nvs;
+    size_t len = sizeof(part_delta_state_t);
+
+    if (nvs_open(PART_DELTA_NVS_NAMESPACE, NVS_READONLY, &nvs) == ESP_OK) {
+        esp_err_t err = nvs_get_blob(nvs, label, state, &len);
+        nvs_close(nvs);
+        if (err == ESP_OK && len == sizeof(part_delta_state_t)) {
+            return;
+        }
+    }
+    // never updated: the image flashed into slot 0
+    state->version = 0;
+    state->slot = 0;
+}
+
+static int part_delta_set_state(const char *label, const part_delta_state_t *state)
+{
+    nvs_handle_t nvs;
+    esp_err_t err = nvs_open(PART_DELTA_NVS_NAMESPACE, NVS_READWRITE, &nvs);
+
+    if (err == ESP_OK) {
+        err = nvs_set_blob(nvs, label, state, sizeof(part_delta_state_t));
+        if (err == ESP_OK) {
+            err = nvs_commit(nvs);
+        }
+        nvs_close(nvs);
+    }
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "%s: nvs write error %d\n", label, err);
+        return -1;
+    }
+    return 0;
+}
+
+const esp_partition_t *part_delta_active(const char *label)
+{
+    part_delta_state_t state;
+    const esp_partition_t *part = NULL;
+
+    part_delta_get_state(label, &state);
+    if (state.slot) {
+        part = part_delta_slot(label, 1);
+    }
+    return part ? part : part_delta_slot(label, 0);
+}
+
+uint32_t part_delta_version(const char *label)
+{
+    part_delta_state_t state;
+    part_delta_get_state(label, &state);
+    return state.version;
+}
+
+static void part_delta_free(part_delta_handle_t handle)
+{
+    mbedtls_sha256_free(&handle->sha);
+    heap_caps_free(handle->inflate);
+    heap_caps_free(handle->buf);
+    heap_caps_free(handle->old);
+    free(handle);
+}
+
+int part_delta_begin(const char *label, part_delta_handle_t *handle)
+{
+    if (strlen(label) > PART_DELTA_LABEL_MAX) {
+        ESP_LOGE(TAG, "%s: label longer than %d characters, %s_b does not fit", label, PART_DELTA_LABEL_MAX, label);
+        return -1;
+    }
+    part_delta_state_t state;
+    part_delta_get_state(label, &state);
+    const esp_partition_t *src = part_delta_active(label);
+    const esp_partition_t *dst = part_delta_slot(label, !state.slot);
+    if (src == NULL || dst == NULL || src == dst) {
+        ESP_LOGE(TAG, "%s: no second slot %s%s\n", label, label, state.slot ? "" : "_b");
+        return -1;
+    }
+    part_delta_handle_t h = calloc(1, sizeof(struct part_delta));
+    if (h == NULL) {
+        ESP_LOGE(TAG, "handle malloc error\n");
+        return -1;
+    }
+    mbedtls_sha256_init(&h->sha);
+    // flash writes are not taken from PSRAM, the decompressor may live there
+    h->buf = heap_caps_malloc(PART_DELTA_BLOCK, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    h->old = heap_caps_malloc(PART_DELTA_BLOCK, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    h->inflate = heap_caps_malloc(sizeof(tinfl_decompressor), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (h->inflate == NULL) {
+        h->inflate = heap_caps_malloc(sizeof(tinfl_decompressor), MALLOC_CAP_8BIT);
+    }
+    if (h->buf == NULL || h->old == NULL || h->inflate == NULL) {
+        ESP_LOGE(TAG, "buffer malloc error\n");
+        part_delta_free(h);
+        return -1;
+    }
+    strcpy(h->label, label);
+    h->src = src;
+    h->dst = dst;
+    h->dst_slot = !state.slot;
+    *handle = h;
+    ESP_LOGI(TAG, "%s: version %u in %s, updating %s\n", label, state.version, src->label, dst->label);
+    return 0;
+}
+
+// The header is for this partition, the new image fits the slot and the active slot holds the base
+static int part_delta_check_header(part_delta_handle_t h)
+{
+    const part_delta_header_t *hdr = &h->hdr;
+    uint8_t sha[32];
+
+    if (memcmp(hdr->magic, PART_DELTA_MAGIC, 4) || hdr->format != PART_DELTA_FORMAT || hdr->block_size != PART_DELTA_BLOCK) {
+        ESP_LOGE(TAG, "%s: not a patch\n", h->label);
+        return -1;
+    }
+    if (strncmp(hdr->label, h->label, PART_DELTA_LABEL_LEN)) {
+        ESP_LOGE(TAG, "%s: patch for %.16s\n", h->label, hdr->label);
+        return -1;
+    }
+    if (hdr->new_size > h->dst->size || hdr->block_count != (hdr->new_size + PART_DELTA_BLOCK - 1) / PART_DELTA_BLOCK) {
+        ESP_LOGE(TAG, "%s: %u bytes do not fit %s\n", h->label, hdr->new_size, h->dst->label);
+        return -1;
+    }
+    if (hdr->base_size > h->src->size) {
+        ESP_LOGE(TAG, "%s: base larger than %s\n", h->label, h->src->label);
+        return -1;
+    }
+    mbedtls_sha256_starts_ret(&h->sha, 0);
+    for (uint32_t pos = 0; pos < hdr->base_size; pos += PART_DELTA_BLOCK) {
+        uint32_t n = hdr->base_size - pos < PART_DELTA_BLOCK ? hdr->base_size - pos : PART_DELTA_BLOCK;
+        if (esp_partition_read(h->src, pos, h->old, n) != ESP_OK) {
+            ESP_LOGE(TAG, "%s: read error\n", h->src->label);
+            return -1;
+        }
+        mbedtls_sha256_update_ret(&h->sha, h->old, n);
+    }
+    mbedtls_sha256_finish_ret(&h->sha, sha);
+    if (memcmp(sha, hdr->base_sha, sizeof(sha))) {
+        ESP_LOGE(TAG, "%s: patch for another image than the one in %s\n", h->label, h->src->label);
+        return -1;
+    }
+    mbedtls_sha256_starts_ret(&h->sha, 0);
+    ESP_LOGI(TAG, "%s: version %u, %u blocks\n", h->label, hdr->version, hdr->block_count);
+    return 0;
+}
+
+// The old image from offset on, erased flash past its end
+static int part_delta_read_old(part_delta_handle_t h, uint32_t offset)
+{
+    uint32_t n = 0;
+
+    if (offset < h->hdr.base_size) {
+        n = h->hdr.base_size - offset < PART_DELTA_BLOCK ? h->hdr.base_size - offset : PART_DELTA_BLOCK;
+        if (esp_partition_read(h->src, offset, h->old, n) != ESP_OK) {
+            ESP_LOGE(TAG, "%s: read error\n", h->src->label);
+            return -1;
+        }
+    }
+    memset(h->old + n, 0xff, PART_DELTA_BLOCK - n);
+    return 0;
+}
+
+static int part_delta_write_block(part_delta_handle_t h)
+{
+    uint32_t offset = h->block * PART_DELTA_BLOCK;
+    uint32_t used = h->hdr.new_size - offset < PART_DELTA_BLOCK ? h->hdr.new_size - offset : PART_DELTA_BLOCK;
+
+    if (esp_partition_erase_range(h->dst, offset, PART_DELTA_BLOCK) != ESP_OK ||
+        esp_partition_write(h->dst, offset, h->buf, PART_DELTA_BLOCK) != ESP_OK) {
+        ESP_LOGE(TAG, "%s: write error at 0x%x\n", h->dst->label, offset);
+        return -1;
+    }
+    mbedtls_sha256_update_ret(&h->sha, h->buf, used);
+    h->block++;
+    h->step = h->block == h->hdr.block_count ? PART_DELTA_DONE : PART_DELTA_OP;
+    return 0;
+}
+
+static uint32_t part_delta_arg(part_delta_handle_t h, int index)
+{
+    uint32_t v;
+    memcpy(&v, h->arg + index * 4, 4);
+    return v;
+}
+
+// The argument of an op is in, a copy or a fill makes the block, a zlib stream follows otherwise
+static int part_delta_run_op(part_delta_handle_t h)
+{
+    switch (h->op) {
+        case PART_DELTA_OP_COPY:
+            if (part_delta_read_old(h, part_delta_arg(h, 0)) != 0) {
+                return -1;
+            }
+            memcpy(h->buf, h->old, PART_DELTA_BLOCK);
+            return part_delta_write_block(h);
+        case PART_DELTA_OP_FILL:
+            memset(h->buf, h->arg[0], PART_DELTA_BLOCK);
+            return part_delta_write_block(h);
+        case PART_DELTA_OP_XOR:
+            if (part_delta_read_old(h, part_delta_arg(h, 0)) != 0) {
+                return -1;
+            }
+            h->zleft = part_delta_arg(h, 1);
+            break;
+        default:
+            h->zleft = part_delta_arg(h, 0);
+            break;
+    }
+    tinfl_init(h->inflate);
+    h->out = 0;
+    h->step = PART_DELTA_ZDATA;
+    return 0;
+}
+
+// Feed up to len bytes of the zlib stream, the number taken or -1
+static int part_delta_inflate(part_delta_handle_t h, const uint8_t *data, size_t len)
+{
+    size_t in = len < h->zleft ? len : h->zleft;
+    size_t out = PART_DELTA_BLOCK - h->out;
+    int more = in < h->zleft ? TINFL_FLAG_HAS_MORE_INPUT : 0;
+    tinfl_status status = tinfl_decompress(h->inflate, data, &in, h->buf, h->buf + h->out, &out, PART_DELTA_INFLATE_FLAGS | more);
+
+    h->zleft -= in;
+    h->out += out;
+    if (status == TINFL_STATUS_DONE) {
+        if (h->zleft || h->out != PART_DELTA_BLOCK) {
+            ESP_LOGE(TAG, "%s: block %u inflates to %u bytes\n", h->label, h->block, h->out);
+            return -1;
+        }
+        if (h->op == PART_DELTA_OP_XOR) {
+            for (int i = 0; i < PART_DELTA_BLOCK; i++) {
+                h->buf[i] ^= h->old[i];
+            }
+        }
+        return part_delta_write_block(h) == 0 ? in : -1;
+    }
+    // a full block still waits for the adler32 at the end of the stream, more output with no input taken is not
+    if (status < 0 || (status == TINFL_STATUS_HAS_MORE_OUTPUT && in == 0) || h->zleft == 0) {
+        ESP_LOGE(TAG, "%s: block %u inflate error %d\n", h->label, h->block, status);
+        return -1;
+    }
+    return in;
+}
+
+static int part_delta_apply(part_delta_handle_t h, const uint8_t *data, size_t len)
+{
+    while (len) {
+        size_t n;
+        switch (h->step) {
+            case PART_DELTA_HEADER:
+                n = sizeof(part_delta_header_t) - h->got < len ? sizeof(part_delta_header_t) - h->got : len;
+                memcpy((uint8_t *)&h->hdr + h->got, data, n);
+                h->got += n;
+                if (h->got == sizeof(part_delta_header_t)) {
+                    if (part_delta_check_header(h) != 0) {
+                        return -1;
+                    }
+                    h->step = h->hdr.block_count ? PART_DELTA_OP : PART_DELTA_DONE;
+                }
+                break;
+            case PART_DELTA_OP:
+                n = 1;
+                h->op = data[0];
+                h->got = 0;
+                h->arg_len = h->op == PART_DELTA_OP_FILL ? 1 : h->op == PART_DELTA_OP_XOR ? 8 : 4;
+                if (h->op > PART_DELTA_OP_DATA) {
+                    ESP_LOGE(TAG, "%s: block %u bad op %u\n", h->label, h->block, h->op);
+                    return -1;
+                }
+                h->step = PART_DELTA_ARG;
+                break;
+            case PART_DELTA_ARG:
+                n = h->arg_len - h->got < len ? h->arg_len - h->got : len;
+                memcpy(h->arg + h->got, data, n);
+                h->got += n;
+                if (h->got == h->arg_len && part_delta_run_op(h) != 0) {
+                    return -1;
+                }
+                break;
+            case PART_DELTA_ZDATA: {
+                int in = part_delta_inflate(h, data, len);
+                if (in < 0) {
+                    return -1;
+                }
+                n = in;
+                break;
+            }
+            default:
+                ESP_LOGE(TAG, "%s: %u bytes past the patch\n", h->label, len);
+                return -1;
+        }
+        data += n;
+        len -= n;
+    }
+    return 0;
+}
+
+int part_delta_write(part_delta_handle_t handle, const void *data, size_t len)
+{
+    if (handle->step == PART_DELTA_FAILED) {
+        return -1;
+    }
+    if (part_delta_apply(handle, data, len) != 0) {
+        handle->step = PART_DELTA_FAILED;
+        return -1;
+    }
+    return 0;
+}
+
+int part_delta_end(part_delta_handle_t h)
+{
+    uint8_t sha[32];
+    int ret = -1;
+
+    if (h->step == PART_DELTA_DONE) {
+        mbedtls_sha256_finish_ret(&h->sha, sha);
+        if (memcmp(sha, h->hdr.new_sha, sizeof(sha)) == 0) {
+            part_delta_state_t state = {
+                .version = h->hdr.version,
+                .slot = h->dst_slot,
+            };
+            ret = part_delta_set_state(h->label, &state);
+        } else {
+            ESP_LOGE(TAG, "%s: SHA-256 mismatch\n", h->dst->label);
+        }
+    } else if (h->step != PART_DELTA_FAILED) {
+        ESP_LOGE(TAG, "%s: patch incomplete, %u of %u blocks\n", h->label, h->block, h->hdr.block_count);
+    }
+    if (ret == 0) {
+        ESP_LOGI(TAG, "%s: version %u active in %s\n", h->label, h->hdr.version, h->dst->label);
+    }
+    part_delta_free(h);
+    return ret;
+}
+
+void part_delta_abort(part_delta_handle_t handle)
+{
+    if (handle) {
+        part_delta_free(handle);
+    }
+}
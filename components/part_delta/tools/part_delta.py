@@ -0,0 +1,180 @@
+#!/usr/bin/env python
+#
+# Block delta between two images of a data partition (voice pack, model, assets), applied on the device by
+# part_delta_write while it streams into the inactive slot, see part_delta.h.
+#
+#   python part_delta.py diff voice_v3.bin voice_v4.bin voice_3to4.pdl --label voice --version 4
+#   python part_delta.py diff - voice_v4.bin voice_full.pdl --label voice --version 4   # no base: full image
+#   python part_delta.py apply voice_v3.bin voice_3to4.pdl out.bin                      # check a patch
+#
+# Each 4 KB block of the new image is one op, whichever is the smallest: a copy of 4 KB of the old image,
+# a fill with one byte, the zlib-compressed XOR with 4 KB of the old image, which is mostly zeros where a
+# model or a voice set changed in place, or the zlib-compressed block itself. The old bytes may start at any
+# offset: the blocks are matched through content defined anchors, so data that moved because something was
+# inserted before it is still found. The old image is taken as padded with 0xff, as the flash past it reads
+# on the device. The patch names the SHA-256 of the old image it applies to and of the image it makes, the
+# device checks both.
+#
+from __future__ import print_function
+import argparse
+import hashlib
+import struct
+import sys
+import zlib
+
+MAGIC = b'PDLT'
+VERSION = 1
+BLOCK_SIZE = 4096
+LABEL_LEN = 16
+LABEL_MAX = LABEL_LEN - 3   # "<label>_b" and its NUL fit a partition label, as part_delta_begin checks
+# magic, format version, label, image version, block size, block count, base size, new size, base SHA-256,
+# new SHA-256
+HEADER = struct.Struct('<4sI16sIIIII32s32s')
+OP_COPY = 0     # u32 offset in the old image
+OP_FILL = 1     # u8 value
+OP_XOR = 2      # u32 offset in the old image, u32 length, zlib stream of the block XOR the old bytes there
+OP_DATA = 3     # u32 length, zlib stream of the block
+ANCHOR_LEN = 32
+ANCHOR_EVERY = 64
+CANDIDATES = 4
+
+
+def old_block(old, offset):
+    return old[offset:offset + BLOCK_SIZE].ljust(BLOCK_SIZE, b'\xff')
+
+
+def xor(a, b):
+    return bytes(bytearray(x ^ y for x, y in zip(bytearray(a), bytearray(b))))
+
+
+def anchors(image):
+    # offsets of the windows that hash to 0 mod ANCHOR_EVERY, by their hash: content defined, so they move
+    # with the data when something is inserted or removed before them
+    out = {}
+    for pos in range(len(image) - ANCHOR_LEN + 1):
+        h = zlib.adler32(image[pos:pos + ANCHOR_LEN])
+        if h % ANCHOR_EVERY == 0:
+            out.setdefault(h, pos)
+    return out
+
+
+def candidates(block, index, old_len):
+    # old offsets the block may have moved from
+    found = []
+    for pos in range(len(block) - ANCHOR_LEN + 1):
+        h = zlib.adler32(block[pos:pos + ANCHOR_LEN])
+        if h % ANCHOR_EVERY == 0 and h in index:
+            offset = index[h] - pos
+            if 0 <= offset < old_len and offset not in found:
+                found.append(offset)
+                if len(found) == CANDIDATES:
+                    break
+    return found
+
+
+def diff(old, new, label, version):
+    count = (len(new) + BLOCK_SIZE - 1) // BLOCK_SIZE
+    index = anchors(old)
+    out = [HEADER.pack(MAGIC, VERSION, label.encode(), version, BLOCK_SIZE, count, len(old), len(new),
+                       hashlib.sha256(old).digest(), hashlib.sha256(new).digest())]
+    stats = [0, 0, 0, 0]
+    for i in range(count):
+        # the last block only counts up to the end of the image, the rest is left as erased
+        used = new[i * BLOCK_SIZE:(i + 1) * BLOCK_SIZE]
+        b = used.ljust(BLOCK_SIZE, b'\xff')
+        offsets = ([i * BLOCK_SIZE] if i * BLOCK_SIZE < len(old) else []) + candidates(used, index, len(old))
+        if used == used[:1] * len(used):
+            op = struct.pack('<BB', OP_FILL, bytearray(used)[0])
+        else:
+            op = struct.pack('<BI', OP_DATA, 0) + zlib.compress(b, 9)
+            for offset in offsets:
+                ref = old_block(old, offset)
+                if ref[:len(used)] == used:
+                    op = struct.pack('<BI', OP_COPY, offset)
+                    break
+                z = zlib.compress(xor(b, ref), 9)
+                if 9 + len(z) < len(op):
+                    op = struct.pack('<BII', OP_XOR, offset, len(z)) + z
+            if bytearray(op)[0] == OP_DATA:
+                op = struct.pack('<BI', OP_DATA, len(op) - 5) + op[5:]
+        stats[bytearray(op)[0]] += 1
+        out.append(op)
+    return b''.join(out), stats
+
+
+def apply(old, patch):
+    magic, ver, label, version, bs, count, base_size, new_size, base_sha, new_sha = HEADER.unpack_from(patch)
+    if magic != MAGIC or ver != VERSION or bs != BLOCK_SIZE:
+        sys.exit('not a part_delta patch')
+    if len(old) < base_size or hashlib.sha256(old[:base_size]).digest() != base_sha:
+        sys.exit('the patch is for another base image')
+    old = old[:base_size]
+    pos = HEADER.size
+    out = []
+    for i in range(count):
+        op = bytearray(patch[pos:pos + 1])[0]
+        if op == OP_COPY:
+            out.append(old_block(old, struct.unpack_from('<I', patch, pos + 1)[0]))
+            pos += 5
+        elif op == OP_FILL:
+            out.append(patch[pos + 1:pos + 2] * BLOCK_SIZE)
+            pos += 2
+        elif op == OP_XOR:
+            offset, n = struct.unpack_from('<II', patch, pos + 1)
+            out.append(xor(zlib.decompress(patch[pos + 9:pos + 9 + n]), old_block(old, offset)))
+            pos += 9 + n
+        elif op == OP_DATA:
+            n = struct.unpack_from('<I', patch, pos + 1)[0]
+            out.append(zlib.decompress(patch[pos + 5:pos + 5 + n]))
+            pos += 5 + n
+        else:
+            sys.exit('block %d: bad op %d' % (i, op))
+    image = b''.join(out)[:new_size]
+    if hashlib.sha256(image).digest() != new_sha:
+        sys.exit('the result does not match the SHA-256 of the patch')
+    print('%s version %d, %d bytes' % (label.rstrip(b'\0').decode(), version, new_size))
+    return image
+
+
+def read(path):
+    if path == '-':
+        return b''
+    with open(path, 'rb') as f:
+        return f.read()
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Block delta of a data partition image')
+    sub = parser.add_subparsers(dest='cmd')
+    p = sub.add_parser('diff', help='make a patch from the old image to the new one, - for no old image')
+    p.add_argument('old')
+    p.add_argument('new')
+    p.add_argument('patch')
+    p.add_argument('--label', required=True, help='partition label of slot 0, the second slot is <label>_b')
+    p.add_argument('--version', type=int, required=True, help='version of the new image')
+    p = sub.add_parser('apply', help='apply a patch on the host, as the device does')
+    p.add_argument('old')
+    p.add_argument('patch')
+    p.add_argument('out')
+    args = parser.parse_args()
+
+    if args.cmd == 'diff':
+        if len(args.label) > LABEL_MAX:
+            sys.exit('label longer than %d characters, <label>_b does not fit' % LABEL_MAX)
+        new = read(args.new)
+        patch, stats = diff(read(args.old), new, args.label, args.version)
+        with open(args.patch, 'wb') as f:
+            f.write(patch)
+        print('%d blocks: %d copied, %d filled, %d xor, %d data; patch %d bytes, %.1f%% of the image' %
+              (sum(stats), stats[OP_COPY], stats[OP_FILL], stats[OP_XOR], stats[OP_DATA], len(patch),
+               100.0 * len(patch) / max(len(new), 1)))
+    elif args.cmd == 'apply':
+        image = apply(read(args.old), read(args.patch))
+        with open(args.out, 'wb') as f:
+            f.write(image)
+    else:
+        parser.print_help()
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// RGB565 pixels are in LCD order: big-endian, as the OV2640 sends them and the ST7789 expects them.
+// The kernels work on whole lines so cam_task can run them fused into its DMA copy.
+
+typedef enum {
+    PIXEL_CONVERT_NONE = 0,
+    PIXEL_CONVERT_SWAP,    // RGB565 byte swap, big-endian <-> little-endian
+    PIXEL_CONVERT_GRAY,    // RGB565 to 8 bit gray
+    PIXEL_CONVERT_RGB888,  // RGB565 to R, G, B bytes
+} pixel_convert_t;
+
+// Output bytes per pixel of a conversion
+int pixel_convert_size(pixel_convert_t convert);
+
+// Convert n pixels, dst may equal src for PIXEL_CONVERT_NONE/SWAP
+void pixel_convert(pixel_convert_t convert, uint8_t *dst, const uint16_t *src, size_t n);
+
+void pixel_swap16(uint16_t *dst, const uint16_t *src, size_t n);
+void pixel_rgb565_to_gray(uint8_t *dst, const uint16_t *src, size_t n);
+void pixel_rgb565_to_rgb888(uint8_t *dst, const uint16_t *src, size_t n);
+
+// Box filter factor (2 or 4) source lines, stride pixels apart, into one line of width output pixels
+void pixel_box_rgb565(uint16_t *dst, const uint16_t *src, size_t stride, size_t width, int factor);
+
+// Rotate a width x high RGB565 image 90 degrees clockwise into a high x width image
+void pixel_rotate90_rgb565(uint16_t *dst, const uint16_t *src, size_t width, size_t high);
+
+#ifdef __cplusplus
+}
+#endif
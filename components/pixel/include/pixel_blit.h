@@ -0,0 +1,63 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 2D primitives on RGB565 buffers in LCD order (see pixel.h), colors included. Every call clips
+// against the destination surface, so callers can draw partly off screen.
+
+typedef struct {
+    uint16_t *buf;
+    int width;
+    int high;
+    int stride;   // pixels from one line to the next, 0: width
+} pixel_surface_t;
+
+typedef struct {
+    int x;
+    int y;
+    int width;
+    int high;
+} pixel_rect_t;
+
+typedef struct {
+    const uint8_t *data;
+    uint8_t bpp;  // 1 or 4, leftmost pixel in the high bits of a byte
+    int stride;   // bytes from one line to the next
+    int width;
+    int high;
+} pixel_mask_t;
+
+// 8 bit R, G, B to an RGB565 color in LCD order
+static inline uint16_t pixel_color(uint8_t r, uint8_t g, uint8_t b)
+{
+    uint16_t v = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+    return (v >> 8) | (v << 8);
+}
+
+// Fill rect (NULL: the whole surface) with color, two pixels per store
+void pixel_fill(const pixel_surface_t *dst, const pixel_rect_t *rect, uint16_t color);
+
+// Copy area of src (NULL: all of it) to x, y of dst. dst and src may be the same surface, e.g. to scroll
+void pixel_blit(const pixel_surface_t *dst, int x, int y, const pixel_surface_t *src, const pixel_rect_t *area);
+
+// Draw mask at x, y of dst: each pixel is blended towards the pixel of src at the same mask position, or
+// towards color when src is NULL (glyphs, anti-aliased icons). 1 bit masks draw or skip
+void pixel_blend(const pixel_surface_t *dst, int x, int y, const pixel_surface_t *src, const pixel_mask_t *mask, uint16_t color);
+
+// Scale area of src (NULL: all of it) to cover rect of dst, nearest or bilinear
+void pixel_blit_scaled(const pixel_surface_t *dst, const pixel_rect_t *rect, const pixel_surface_t *src, const pixel_rect_t *area,
+                       int bilinear);
+
+// Draw src rotated clockwise by angle (0.1 degree) and zoomed (256: 1x) about its pixel px, py, which lands on x, y
+// of dst. Pixels of dst that map outside src are left as they are
+void pixel_blit_transform(const pixel_surface_t *dst, int x, int y, const pixel_surface_t *src, int px, int py, int angle, int zoom,
+                          int bilinear);
+
+#ifdef __cplusplus
+}
+#endif
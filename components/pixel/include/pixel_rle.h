@@ -0,0 +1,48 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Run-length compressed RGB565 (LCD order) images for static screen layers. A flat UI background shrinks
+// 5-20x, the blob can live in PSRAM or memory mapped flash, and any part of any line decodes without the
+// lines above it, so the LCD driver can expand it stripe by stripe into its DMA chunks.
+//
+// Blob, little endian: pixel_rle_header_t, high uint32_t byte offsets of the lines from the blob start,
+// then per line uint16_t runs that never cross the line end:
+//   n | PIXEL_RLE_REPEAT, color   n pixels of color
+//   n, n pixels                   n literal pixels
+
+#define PIXEL_RLE_MAGIC   0x30454C52 // "RLE0"
+#define PIXEL_RLE_REPEAT  0x8000
+#define PIXEL_RLE_RUN_MAX 0x7FFF
+
+typedef struct {
+    uint32_t magic;
+    uint16_t width;
+    uint16_t high;
+} __attribute__((packed)) pixel_rle_header_t;
+
+typedef struct {
+    uint16_t width;
+    uint16_t high;
+    const uint8_t *blob;
+    const uint32_t *line;
+} pixel_rle_t;
+
+// Compress width x high pixels, stride pixels from one line to the next, into out. Returns the blob size,
+// -1 when it does not fit out_size. out NULL: only compute the size
+int pixel_rle_encode(const uint16_t *pixels, int width, int high, int stride, uint8_t *out, size_t out_size);
+
+// Check a blob and set rle up to read it, the blob must stay valid
+int pixel_rle_open(pixel_rle_t *rle, const void *blob, size_t size);
+
+// Decode cnt pixels of line y starting at x into dst, clipped to the line
+void pixel_rle_decode(const pixel_rle_t *rle, int y, int x, int cnt, uint16_t *dst);
+
+#ifdef __cplusplus
+}
+#endif
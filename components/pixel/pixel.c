@@ -0,0 +1,123 @@
+#include <stdio.h>
+#include <string.h>
+#include "pixel.h"
+
+#define PIXEL_R(p)  ((((p) >> 8) & 0xF8) | (((p) >> 13) & 0x07))
+#define PIXEL_G(p)  ((((p) >> 3) & 0xFC) | (((p) >> 9) & 0x03))
+#define PIXEL_B(p)  ((((p) << 3) & 0xF8) | (((p) >> 2) & 0x07))
+
+// Big-endian pixel in memory to its RGB565 value
+static inline uint16_t pixel_get(uint16_t p)
+{
+    return (p >> 8) | (p << 8);
+}
+
+int pixel_convert_size(pixel_convert_t convert)
+{
+    switch (convert) {
+        case PIXEL_CONVERT_GRAY:
+            return 1;
+        case PIXEL_CONVERT_RGB888:
+            return 3;
+        default:
+            return 2;
+    }
+}
+
+void pixel_swap16(uint16_t *dst, const uint16_t *src, size_t n)
+{
+    size_t x = 0;
+    if (!(((uint32_t)dst | (uint32_t)src) & 0x3)) {
+        const uint32_t *s32 = (const uint32_t *)src;
+        uint32_t *d32 = (uint32_t *)dst;
+        for (; x + 2 <= n; x += 2) {
+            uint32_t w = *s32++;
+            *d32++ = ((w & 0xFF00FF00) >> 8) | ((w & 0x00FF00FF) << 8);
+        }
+    }
+    for (; x < n; x++) {
+        dst[x] = (src[x] >> 8) | (src[x] << 8);
+    }
+}
+
+void pixel_rgb565_to_gray(uint8_t *dst, const uint16_t *src, size_t n)
+{
+    size_t x = 0;
+    if (!(((uint32_t)dst | (uint32_t)src) & 0x3)) {
+        const uint32_t *s32 = (const uint32_t *)src;
+        uint32_t *d32 = (uint32_t *)dst;
+        for (; x + 4 <= n; x += 4) {
+            uint32_t w0 = *s32++;
+            uint32_t w1 = *s32++;
+            uint32_t g = 0;
+            uint16_t p[4] = {pixel_get(w0), pixel_get(w0 >> 16), pixel_get(w1), pixel_get(w1 >> 16)};
+            for (int i = 0; i < 4; i++) {
+                g |= (uint32_t)((PIXEL_R(p[i]) * 77 + PIXEL_G(p[i]) * 150 + PIXEL_B(p[i]) * 29) >> 8) << (i * 8);
+            }
+            *d32++ = g;
+        }
+    }
+    for (; x < n; x++) {
+        uint16_t p = pixel_get(src[x]);
+        dst[x] = (PIXEL_R(p) * 77 + PIXEL_G(p) * 150 + PIXEL_B(p) * 29) >> 8;
+    }
+}
+
+void pixel_rgb565_to_rgb888(uint8_t *dst, const uint16_t *src, size_t n)
+{
+    for (size_t x = 0; x < n; x++) {
+        uint16_t p = pixel_get(src[x]);
+        *dst++ = PIXEL_R(p);
+        *dst++ = PIXEL_G(p);
+        *dst++ = PIXEL_B(p);
+    }
+}
+
+void pixel_convert(pixel_convert_t convert, uint8_t *dst, const uint16_t *src, size_t n)
+{
+    switch (convert) {
+        case PIXEL_CONVERT_SWAP:
+            pixel_swap16((uint16_t *)dst, src, n);
+            break;
+        case PIXEL_CONVERT_GRAY:
+            pixel_rgb565_to_gray(dst, src, n);
+            break;
+        case PIXEL_CONVERT_RGB888:
+            pixel_rgb565_to_rgb888(dst, src, n);
+            break;
+        default:
+            if ((const uint8_t *)src != dst) {
+                memcpy(dst, src, n * 2);
+            }
+            break;
+    }
+}
+
+void pixel_box_rgb565(uint16_t *dst, const uint16_t *src, size_t stride, size_t width, int factor)
+{
+    int shift = (factor == 4) ? 4 : 2; // log2(factor * factor)
+    for (size_t x = 0; x < width; x++) {
+        uint32_t r = 0, g = 0, b = 0;
+        const uint16_t *line = src + x * factor;
+        for (int j = 0; j < factor; j++, line += stride) {
+            for (int i = 0; i < factor; i++) {
+                uint16_t p = pixel_get(line[i]);
+                r += p >> 11;
+                g += (p >> 5) & 0x3F;
+                b += p & 0x1F;
+            }
+        }
+        uint16_t v = ((r >> shift) << 11) | ((g >> shift) << 5) | (b >> shift);
+        dst[x] = (v >> 8) | (v << 8);
+    }
+}
+
+void pixel_rotate90_rgb565(uint16_t *dst, const uint16_t *src, size_t width, size_t high)
+{
+    for (size_t y = 0; y < high; y++) {
+        uint16_t *col = dst + (high - 1 - y);
+        for (size_t x = 0; x < width; x++) {
+            col[x * high] = src[y * width + x];
+        }
+    }
+}
@@ -0,0 +1,313 @@
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "pixel_blit.h"
+
+#define PIXEL_SPREAD_MASK  (0x07E0F81F) // G moved to the high half, R and B stay, room for 5 bit weights
+
+#define PIXEL_STRIDE(s)    ((s)->stride ? (s)->stride : (s)->width)
+
+// LCD order pixel to R_B and G fields far enough apart to multiply all three at once
+static inline uint32_t pixel_spread(uint16_t p)
+{
+    uint32_t v = (uint16_t)((p >> 8) | (p << 8));
+    return (v | (v << 16)) & PIXEL_SPREAD_MASK;
+}
+
+static inline uint16_t pixel_pack(uint32_t w)
+{
+    w &= PIXEL_SPREAD_MASK;
+    uint16_t v = w | (w >> 16);
+    return (v >> 8) | (v << 8);
+}
+
+// a: 0..32 weight of s
+static inline uint16_t pixel_mix(uint16_t s, uint16_t d, uint32_t a)
+{
+    return pixel_pack((pixel_spread(s) * a + pixel_spread(d) * (32 - a)) >> 5);
+}
+
+// Intersect r with the surface, 0 when nothing is left
+static int pixel_clip(const pixel_surface_t *s, pixel_rect_t *r)
+{
+    if (r->x < 0) {
+        r->width += r->x;
+        r->x = 0;
+    }
+    if (r->y < 0) {
+        r->high += r->y;
+        r->y = 0;
+    }
+    if (r->x + r->width > s->width) {
+        r->width = s->width - r->x;
+    }
+    if (r->y + r->high > s->high) {
+        r->high = s->high - r->y;
+    }
+    return r->width > 0 && r->high > 0;
+}
+
+// Clip a width x high draw at x, y of dst, dst_r gets the visible part and ox, oy its offset into the source
+static int pixel_clip_draw(const pixel_surface_t *dst, int x, int y, int width, int high, pixel_rect_t *dst_r, int *ox, int *oy)
+{
+    dst_r->x = x;
+    dst_r->y = y;
+    dst_r->width = width;
+    dst_r->high = high;
+    if (!pixel_clip(dst, dst_r)) {
+        return 0;
+    }
+    *ox = dst_r->x - x;
+    *oy = dst_r->y - y;
+    return 1;
+}
+
+static void pixel_fill_line(uint16_t *p, int n, uint16_t color)
+{
+    if (n > 0 && ((uintptr_t)p & 0x2)) {
+        *p++ = color;
+        n--;
+    }
+    uint32_t c = color | ((uint32_t)color << 16);
+    uint32_t *p32 = (uint32_t *)p;
+    for (; n >= 8; n -= 8) {
+        p32[0] = c;
+        p32[1] = c;
+        p32[2] = c;
+        p32[3] = c;
+        p32 += 4;
+    }
+    for (; n >= 2; n -= 2) {
+        *p32++ = c;
+    }
+    if (n) {
+        *(uint16_t *)p32 = color;
+    }
+}
+
+void pixel_fill(const pixel_surface_t *dst, const pixel_rect_t *rect, uint16_t color)
+{
+    pixel_rect_t r = rect ? *rect : (pixel_rect_t) {0, 0, dst->width, dst->high};
+    if (!pixel_clip(dst, &r)) {
+        return;
+    }
+    int stride = PIXEL_STRIDE(dst);
+    uint16_t *p = dst->buf + r.y * stride + r.x;
+    if (r.width == stride) {
+        pixel_fill_line(p, r.width * r.high, color); // contiguous lines, one run
+        return;
+    }
+    for (int y = 0; y < r.high; y++, p += stride) {
+        pixel_fill_line(p, r.width, color);
+    }
+}
+
+void pixel_blit(const pixel_surface_t *dst, int x, int y, const pixel_surface_t *src, const pixel_rect_t *area)
+{
+    pixel_rect_t a = area ? *area : (pixel_rect_t) {0, 0, src->width, src->high};
+    int ax = a.x, ay = a.y;
+    if (!pixel_clip(src, &a)) {
+        return;
+    }
+    x += a.x - ax;
+    y += a.y - ay;
+    pixel_rect_t r;
+    int ox, oy;
+    if (!pixel_clip_draw(dst, x, y, a.width, a.high, &r, &ox, &oy)) {
+        return;
+    }
+    int ds = PIXEL_STRIDE(dst), ss = PIXEL_STRIDE(src);
+    uint16_t *d = dst->buf + r.y * ds + r.x;
+    const uint16_t *s = src->buf + (a.y + oy) * ss + a.x + ox;
+    size_t len = r.width * 2;
+    if (dst->buf == src->buf) {
+        // same surface: copy the lines in the order that never reads a line already overwritten
+        if (d > s) {
+            d += (r.high - 1) * ds;
+            s += (r.high - 1) * ss;
+            ds = -ds;
+            ss = -ss;
+        }
+        for (int j = 0; j < r.high; j++, d += ds, s += ss) {
+            memmove(d, s, len);
+        }
+        return;
+    }
+    if (r.width == ds && ds == ss) {
+        memcpy(d, s, len * r.high);
+        return;
+    }
+    // memcpy moves words once source and destination share their alignment
+    for (int j = 0; j < r.high; j++, d += ds, s += ss) {
+        memcpy(d, s, len);
+    }
+}
+
+static void pixel_blend_a1(uint16_t *d, const uint16_t *s, const uint8_t *m, int ox, int n, uint16_t color)
+{
+    for (int i = 0; i < n;) {
+        int bit = ox + i;
+        uint8_t bits = m[bit >> 3];
+        if (!(bit & 7) && i + 8 <= n && (bits == 0x00 || bits == 0xFF)) {
+            // whole byte of the mask empty or full, the common case inside glyphs and icons
+            if (bits) {
+                if (s) {
+                    memcpy(d + i, s + i, 16);
+                } else {
+                    pixel_fill_line(d + i, 8, color);
+                }
+            }
+            i += 8;
+            continue;
+        }
+        if (bits & (0x80 >> (bit & 7))) {
+            d[i] = s ? s[i] : color;
+        }
+        i++;
+    }
+}
+
+static void pixel_blend_a4(uint16_t *d, const uint16_t *s, const uint8_t *m, int ox, int n, uint16_t color)
+{
+    for (int i = 0; i < n; i++) {
+        int px = ox + i;
+        uint32_t a = (m[px >> 1] >> ((px & 1) ? 0 : 4)) & 0x0F;
+        if (a == 0) {
+            continue;
+        }
+        uint16_t c = s ? s[i] : color;
+        d[i] = (a == 0x0F) ? c : pixel_mix(c, d[i], (a * 137) >> 6); // 0..15 to 0..32
+    }
+}
+
+void pixel_blend(const pixel_surface_t *dst, int x, int y, const pixel_surface_t *src, const pixel_mask_t *mask, uint16_t color)
+{
+    int width = mask->width, high = mask->high;
+    if (src) {
+        width = width < src->width ? width : src->width;
+        high = high < src->high ? high : src->high;
+    }
+    pixel_rect_t r;
+    int ox, oy;
+    if ((mask->bpp != 1 && mask->bpp != 4) || !pixel_clip_draw(dst, x, y, width, high, &r, &ox, &oy)) {
+        return;
+    }
+    int ds = PIXEL_STRIDE(dst);
+    uint16_t *d = dst->buf + r.y * ds + r.x;
+    const uint16_t *s = NULL;
+    int ss = 0;
+    if (src) {
+        ss = PIXEL_STRIDE(src);
+        s = src->buf + oy * ss + ox;
+    }
+    const uint8_t *m = mask->data + oy * mask->stride;
+    for (int j = 0; j < r.high; j++, d += ds, m += mask->stride) {
+        if (mask->bpp == 1) {
+            pixel_blend_a1(d, s, m, ox, r.width, color);
+        } else {
+            pixel_blend_a4(d, s, m, ox, r.width, color);
+        }
+        if (s) {
+            s += ss;
+        }
+    }
+}
+
+// src at 16.16 fx, fy with its right and lower neighbours, clamped at the last column and line
+static inline uint16_t pixel_bilinear(const uint16_t *buf, int stride, int width, int high, int32_t fx, int32_t fy)
+{
+    int x0 = fx >> 16, y0 = fy >> 16;
+    int x1 = x0 + 1 < width ? x0 + 1 : x0;
+    const uint16_t *l0 = buf + y0 * stride;
+    const uint16_t *l1 = y0 + 1 < high ? l0 + stride : l0;
+    uint32_t ax = (fx >> 11) & 0x1F, ay = (fy >> 11) & 0x1F;
+    uint32_t top = ((pixel_spread(l0[x0]) * (32 - ax) + pixel_spread(l0[x1]) * ax) >> 5) & PIXEL_SPREAD_MASK;
+    uint32_t bottom = ((pixel_spread(l1[x0]) * (32 - ax) + pixel_spread(l1[x1]) * ax) >> 5) & PIXEL_SPREAD_MASK;
+    return pixel_pack((top * (32 - ay) + bottom * ay) >> 5);
+}
+
+void pixel_blit_scaled(const pixel_surface_t *dst, const pixel_rect_t *rect, const pixel_surface_t *src, const pixel_rect_t *area,
+                       int bilinear)
+{
+    pixel_rect_t a = area ? *area : (pixel_rect_t) {0, 0, src->width, src->high};
+    pixel_rect_t full = rect ? *rect : (pixel_rect_t) {0, 0, dst->width, dst->high};
+    pixel_rect_t r = full;
+    if (!pixel_clip(src, &a) || full.width <= 0 || full.high <= 0 || !pixel_clip(dst, &r)) {
+        return;
+    }
+    if (a.width == full.width && a.high == full.high) {
+        pixel_blit(dst, full.x, full.y, src, &a);
+        return;
+    }
+    int32_t step_x = ((int64_t)a.width << 16) / full.width;
+    int32_t step_y = ((int64_t)a.high << 16) / full.high;
+    // sample at the source position of each destination pixel centre
+    int32_t x0 = (a.x << 16) + step_x / 2 + (r.x - full.x) * step_x;
+    int32_t fy = (a.y << 16) + step_y / 2 + (r.y - full.y) * step_y;
+    if (bilinear) {
+        x0 -= 0x8000;
+        fy -= 0x8000;
+    }
+    int32_t min_x = a.x << 16, min_y = a.y << 16;
+    int ds = PIXEL_STRIDE(dst), ss = PIXEL_STRIDE(src);
+    uint16_t *d = dst->buf + r.y * ds + r.x;
+    for (int j = 0; j < r.high; j++, d += ds, fy += step_y) {
+        int32_t sy = fy < min_y ? min_y : fy;
+        int32_t fx = x0;
+        if (!bilinear) {
+            const uint16_t *s = src->buf + (sy >> 16) * ss;
+            for (int i = 0; i < r.width; i++, fx += step_x) {
+                d[i] = s[fx >> 16];
+            }
+            continue;
+        }
+        // the area is the image for bilinear, never blend in pixels around it
+        const uint16_t *s = src->buf + a.y * ss + a.x;
+        for (int i = 0; i < r.width; i++, fx += step_x) {
+            int32_t sx = fx < min_x ? min_x : fx;
+            d[i] = pixel_bilinear(s, ss, a.width, a.high, sx - min_x, sy - min_y);
+        }
+    }
+}
+
+void pixel_blit_transform(const pixel_surface_t *dst, int x, int y, const pixel_surface_t *src, int px, int py, int angle, int zoom,
+                          int bilinear)
+{
+    if (zoom <= 0) {
+        return;
+    }
+    float rad = angle * (float)M_PI / 1800;
+    float c = cosf(rad), s = sinf(rad), z = zoom / 256.0f;
+    // bounding box of the rotated source corners in dst
+    int min_x = x, max_x = x, min_y = y, max_y = y;
+    const int corner[4][2] = {{0, 0}, {src->width, 0}, {0, src->high}, {src->width, src->high}};
+    for (int k = 0; k < 4; k++) {
+        float u = (corner[k][0] - px) * z, v = (corner[k][1] - py) * z;
+        int cx = x + (int)floorf(u * c - v * s), cy = y + (int)floorf(u * s + v * c);
+        min_x = cx < min_x ? cx : min_x;
+        max_x = cx > max_x ? cx : max_x;
+        min_y = cy < min_y ? cy : min_y;
+        max_y = cy > max_y ? cy : max_y;
+    }
+    pixel_rect_t r = {min_x, min_y, max_x - min_x + 2, max_y - min_y + 2};
+    if (!pixel_clip(dst, &r)) {
+        return;
+    }
+    // inverse map of the destination pixel centres, one 16.16 step per pixel along x and along y
+    int32_t cos16 = (int32_t)(c / z * 65536), sin16 = (int32_t)(s / z * 65536);
+    int32_t bias = bilinear ? 0x8000 : 0; // bilinear weights count from the source pixel centres
+    int ds = PIXEL_STRIDE(dst), ss = PIXEL_STRIDE(src);
+    uint16_t *d = dst->buf + r.y * ds + r.x;
+    for (int j = 0; j < r.high; j++, d += ds) {
+        int64_t u = 2 * (r.x - x) + 1, v = 2 * (r.y + j - y) + 1;
+        int32_t fx = (int32_t)(((int64_t)px << 16) + (u * cos16 + v * sin16) / 2 - bias);
+        int32_t fy = (int32_t)(((int64_t)py << 16) + (v * cos16 - u * sin16) / 2 - bias);
+        for (int i = 0; i < r.width; i++, fx += cos16, fy -= sin16) {
+            int sx = fx >> 16, sy = fy >> 16;
+            if ((unsigned)sx >= (unsigned)src->width || (unsigned)sy >= (unsigned)src->high) {
+                continue;
+            }
+            d[i] = bilinear ? pixel_bilinear(src->buf, ss, src->width, src->high, fx, fy) : src->buf[sy * ss + sx];
+        }
+    }
+}
@@ -0,0 +1,130 @@
+#include <stdio.h>
+#include <string.h>
+#include "pixel_rle.h"
+
+#define PIXEL_RLE_MIN_REPEAT 3 // a repeat run costs two words, shorter ones stay literal
+
+static void pixel_rle_fill(uint16_t *p, int n, uint16_t color)
+{
+    if (n > 0 && ((uintptr_t)p & 0x2)) {
+        *p++ = color;
+        n--;
+    }
+    uint32_t c = color | ((uint32_t)color << 16);
+    uint32_t *p32 = (uint32_t *)p;
+    for (; n >= 2; n -= 2) {
+        *p32++ = c;
+    }
+    if (n) {
+        *(uint16_t *)p32 = color;
+    }
+}
+
+// Equal pixels from x on, up to the run limit
+static int pixel_rle_repeat(const uint16_t *line, int x, int width)
+{
+    int n = 1;
+    while (x + n < width && n < PIXEL_RLE_RUN_MAX && line[x + n] == line[x]) {
+        n++;
+    }
+    return n;
+}
+
+int pixel_rle_encode(const uint16_t *pixels, int width, int high, int stride, uint8_t *out, size_t out_size)
+{
+    size_t size = sizeof(pixel_rle_header_t) + high * sizeof(uint32_t);
+    uint16_t *w = out ? (uint16_t *)(out + size) : NULL;
+    if (out && size > out_size) {
+        return -1;
+    }
+    for (int y = 0; y < high; y++) {
+        const uint16_t *line = pixels + y * stride;
+        if (out) {
+            ((uint32_t *)(out + sizeof(pixel_rle_header_t)))[y] = size;
+        }
+        for (int x = 0; x < width;) {
+            int n = pixel_rle_repeat(line, x, width);
+            if (n >= PIXEL_RLE_MIN_REPEAT) {
+                size += 2 * sizeof(uint16_t);
+                if (out) {
+                    if (size > out_size) {
+                        return -1;
+                    }
+                    *w++ = PIXEL_RLE_REPEAT | n;
+                    *w++ = line[x];
+                }
+                x += n;
+                continue;
+            }
+            // literal run up to the next repeat worth its header
+            int start = x;
+            while (x < width && x - start < PIXEL_RLE_RUN_MAX && (n = pixel_rle_repeat(line, x, width)) < PIXEL_RLE_MIN_REPEAT) {
+                x += n;
+            }
+            if (x - start > PIXEL_RLE_RUN_MAX) {
+                x = start + PIXEL_RLE_RUN_MAX;
+            }
+            size += (1 + x - start) * sizeof(uint16_t);
+            if (out) {
+                if (size > out_size) {
+                    return -1;
+                }
+                *w++ = x - start;
+                memcpy(w, line + start, (x - start) * sizeof(uint16_t));
+                w += x - start;
+            }
+        }
+    }
+    if (out) {
+        pixel_rle_header_t header = {PIXEL_RLE_MAGIC, width, high};
+        memcpy(out, &header, sizeof(header));
+    }
+    return size;
+}
+
+int pixel_rle_open(pixel_rle_t *rle, const void *blob, size_t size)
+{
+    const pixel_rle_header_t *header = (const pixel_rle_header_t *)blob;
+    if (((uintptr_t)blob & 0x3) || size < sizeof(pixel_rle_header_t) || header->magic != PIXEL_RLE_MAGIC ||
+        size < sizeof(pixel_rle_header_t) + header->high * sizeof(uint32_t)) {
+        return -1;
+    }
+    rle->width = header->width;
+    rle->high = header->high;
+    rle->blob = (const uint8_t *)blob;
+    rle->line = (const uint32_t *)(rle->blob + sizeof(pixel_rle_header_t));
+    for (int y = 0; y < rle->high; y++) {
+        if (rle->line[y] >= size || (rle->line[y] & 0x1)) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+void pixel_rle_decode(const pixel_rle_t *rle, int y, int x, int cnt, uint16_t *dst)
+{
+    if (y < 0 || y >= rle->high || x < 0 || x >= rle->width) {
+        return;
+    }
+    int end = x + cnt < rle->width ? x + cnt : rle->width;
+    const uint16_t *p = (const uint16_t *)(rle->blob + rle->line[y]);
+    // runs before x are skipped by their headers, a stripe that starts mid line costs a few reads
+    for (int pos = 0; pos < end;) {
+        uint16_t n = *p++;
+        int len = n & PIXEL_RLE_RUN_MAX;
+        int a = pos > x ? pos : x;
+        int b = pos + len < end ? pos + len : end;
+        if (n & PIXEL_RLE_REPEAT) {
+            if (a < b) {
+                pixel_rle_fill(dst + a - x, b - a, *p);
+            }
+            p++;
+        } else {
+            if (a < b) {
+                memcpy(dst + a - x, p + a - pos, (b - a) * sizeof(uint16_t));
+            }
+            p += len;
+        }
+        pos += len;
+    }
+}
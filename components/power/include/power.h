@@ -0,0 +1,24 @@
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Board power governor: turn on dynamic frequency scaling and, with CONFIG_FREERTOS_USE_TICKLESS_IDLE,
+// automatic light sleep. The drivers hold an APB frequency lock only while they stream (cam between cam_start
+// and cam_stop, pwm_audio between start and stop, LCD I2S and SPI transfers), so the CPU runs at max_mhz while
+// data moves and drops to min_mhz or sleeps between frames and audio blocks. Needs CONFIG_PM_ENABLE.
+
+typedef struct {
+    uint16_t max_mhz;    // 0: CONFIG_ESP32S2_DEFAULT_CPU_FREQ_MHZ
+    uint16_t min_mhz;    // 0: the XTAL frequency, 40
+    uint8_t light_sleep; // sleep when no lock is held and no task is ready
+} power_config_t;
+
+int power_init(const power_config_t *config);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,36 @@
+#include <stdio.h>
+#include "sdkconfig.h"
+#include "esp_log.h"
+#include "esp_pm.h"
+#include "esp32s2/pm.h"
+#include "power.h"
+
+static const char *TAG = "power";
+
+int power_init(const power_config_t *config)
+{
+#if CONFIG_PM_ENABLE
+    esp_pm_config_esp32s2_t pm_config = {
+        .max_freq_mhz = config->max_mhz ? config->max_mhz : CONFIG_ESP32S2_DEFAULT_CPU_FREQ_MHZ,
+        .min_freq_mhz = config->min_mhz ? config->min_mhz : 40,
+#if CONFIG_FREERTOS_USE_TICKLESS_IDLE
+        .light_sleep_enable = config->light_sleep ? true : false,
+#endif
+    };
+#if !CONFIG_FREERTOS_USE_TICKLESS_IDLE
+    if (config->light_sleep) {
+        ESP_LOGW(TAG, "light sleep needs FREERTOS_USE_TICKLESS_IDLE, frequency scaling only\n");
+    }
+#endif
+    esp_err_t ret = esp_pm_configure(&pm_config);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "pm configure error: %s\n", esp_err_to_name(ret));
+        return -1;
+    }
+    ESP_LOGI(TAG, "cpu %d ~ %d MHz, light sleep: %d\n", pm_config.min_freq_mhz, pm_config.max_freq_mhz, config->light_sleep);
+    return 0;
+#else
+    ESP_LOGE(TAG, "enable PM_ENABLE\n");
+    return -1;
+#endif
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "dl_lib_coefgetter_if.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Person presence from a small CNN on a 96x96 gray copy of the frame, so the display and the network can
+// sleep while nobody is in front of the device. The frame is center cropped to a square and averaged down
+// to 96x96, scaled to [-1, 1) and run through four 3x3 stride 2 convolutions with zero padding of one and
+// ReLU (1 -> 8 -> 16 -> 32 -> 32 channels), a global average pool and a 32 -> 2 fully connected layer.
+// Products run on the dl_dotq kernel the app selected with dl_dotq_init, activations come from a dl_arena.
+//
+// The coefficients are quantized matrices fetched by name through a model_coeff_getter_t, usually
+// dl_coef_partition_getter of a data partition written by the training tools:
+//   presence_conv1_kernel .. presence_conv4_kernel: w = output channels, h = 9 * input channels,
+//       items of an output channel in (ky, kx, input channel) order
+//   presence_conv1_bias .. presence_conv4_bias: w = output channels, h = 1, its exponent is the layer output exponent
+//   presence_fc_kernel: w = 2, h = 32, presence_fc_bias: w = 2, h = 1
+// Output 1 minus output 0 is the score, the person logit over the background logit.
+
+#define PRESENCE_INPUT_SIZE 96
+
+typedef enum {
+    PRESENCE_Y = 0,   // 8 bit luma (CAM_FORMAT_Y)
+    PRESENCE_YUYV,    // YUV422 as the sensor sends it
+    PRESENCE_RGB565,  // RGB565 in LCD byte order
+} presence_format_t;
+
+// Called by the inference task when the state changes: 1 when a person shows up, 0 after hold_ms without one
+typedef void (*presence_cb_t)(int present, float score, void *arg);
+
+typedef struct {
+    uint16_t width;               // frame size in pixels
+    uint16_t high;
+    uint8_t format;               // presence_format_t
+    const model_coeff_getter_t *coeff;
+    float threshold;              // score above which a frame shows a person
+    uint32_t interval_ms;         // between inferences while nobody is there, 0: 1000
+    uint32_t interval_present_ms; // between inferences while somebody is there, 0: interval_ms
+    uint32_t hold_ms;             // stay present this long after the last positive frame, 0: 10000
+    uint8_t task_pri;             // below the preview
+    presence_cb_t cb;
+    void *arg;
+} presence_config_t;
+
+// Copy the frame for an inference when one is due and the task is idle: 1 copied, 0 skipped, -1 error.
+// Cheap enough to call for every frame, the interval sets the inference rate
+int presence_submit(const uint8_t *frame);
+
+// Run the network on a 96x96 gray image in the caller's task, -1 on error
+int presence_infer(const uint8_t *gray, float *score);
+
+// 1 while a person is present
+int presence_get_state(void);
+
+// Inferences since presence_init, and the slowest one in ms
+void presence_get_stats(uint32_t *inferences, uint32_t *max_infer_ms);
+
+int presence_init(const presence_config_t *config);
+
+void presence_deinit(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,335 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "dl_lib_matrixq.h"
+#include "dl_lib_dotq.h"
+#include "dl_lib_arena.h"
+#include "presence.h"
+
+static const char *TAG = "presence";
+
+#define PRESENCE_LAYERS    4       // convolutions, the fully connected layer comes after them
+#define PRESENCE_CLASSES   2
+#define PRESENCE_INPUT_EXP (-15)   // gray (g - 128) * 256, [-1, 1)
+#define PRESENCE_POOL_SIZE (PRESENCE_INPUT_SIZE >> PRESENCE_LAYERS)
+
+typedef struct {
+    const char *kernel;
+    const char *bias;
+    int cin;
+    int cout;
+} presence_layer_t;
+
+static const presence_layer_t presence_layer[PRESENCE_LAYERS + 1] = {
+    {"presence_conv1_kernel", "presence_conv1_bias", 1, 8},
+    {"presence_conv2_kernel", "presence_conv2_bias", 8, 16},
+    {"presence_conv3_kernel", "presence_conv3_bias", 16, 32},
+    {"presence_conv4_kernel", "presence_conv4_bias", 32, 32},
+    {"presence_fc_kernel", "presence_fc_bias", 32, PRESENCE_CLASSES},
+};
+
+// Activations ping-pong between two buffers: the input and layers 2 and 4 in one, layers 1 and 3 in the other
+#define PRESENCE_BUF0 (PRESENCE_INPUT_SIZE * PRESENCE_INPUT_SIZE * sizeof(qtp_t))
+#define PRESENCE_BUF1 ((PRESENCE_INPUT_SIZE / 2) * (PRESENCE_INPUT_SIZE / 2) * 8 * sizeof(qtp_t))
+#define PRESENCE_PATCH (9 * 32 * sizeof(qtp_t))
+#define PRESENCE_ARENA (PRESENCE_BUF0 + PRESENCE_BUF1 + PRESENCE_PATCH + 256)
+
+typedef struct {
+    presence_config_t config;
+    const dl_matrix2dq_t *kernel[PRESENCE_LAYERS + 1];
+    const dl_matrix2dq_t *bias[PRESENCE_LAYERS + 1];
+    dl_arena_t *arena;
+    uint8_t *gray;           // the copy of the last submitted frame
+    TaskHandle_t task;
+    volatile int busy;
+    int64_t next_time;       // next inference due, us
+    int64_t last_positive;
+    int present;
+    uint32_t inferences;
+    uint32_t max_infer_ms;
+} presence_obj_t;
+
+static presence_obj_t *presence_obj = NULL;
+
+static inline qtp_t presence_clip(int64_t v)
+{
+    return v > DL_QTP_RANGE ? DL_QTP_RANGE : (v < -DL_QTP_RANGE - 1 ? -DL_QTP_RANGE - 1 : v);
+}
+
+// Move a sum to an exponent shift bits higher, rounding to nearest
+static inline int64_t presence_rescale(int64_t acc, int shift)
+{
+    if (shift > 0) {
+        return shift >= 62 ? 0 : (acc + ((int64_t)1 << (shift - 1))) >> shift;
+    }
+    // anything this large is clipped to 16 bit afterwards anyway
+    acc = acc > INT32_MAX ? INT32_MAX : (acc < INT32_MIN ? INT32_MIN : acc);
+    return acc * ((int64_t)1 << (-shift > 31 ? 31 : -shift));
+}
+
+// 3x3 stride 2 convolution, zero padding of one, ReLU. in and out are HWC, returns the output exponent
+static int presence_conv(int layer, const qtp_t *in, int in_size, int in_exp, qtp_t *out, qtp_t *patch)
+{
+    const dl_matrix2dq_t *k = presence_obj->kernel[layer];
+    const dl_matrix2dq_t *b = presence_obj->bias[layer];
+    int cin = presence_layer[layer].cin;
+    int cout = presence_layer[layer].cout;
+    int out_size = in_size / 2;
+    int len = 9 * cin;
+    int shift = b->exponent - (in_exp + k->exponent);
+    for (int oy = 0; oy < out_size; oy++) {
+        for (int ox = 0; ox < out_size; ox++) {
+            // 输入窗口展开成一个向量，每个输出通道与卷积核做一次点积
+            qtp_t *p = patch;
+            for (int ky = 0; ky < 3; ky++) {
+                int iy = 2 * oy + ky - 1;
+                for (int kx = 0; kx < 3; kx++, p += cin) {
+                    int ix = 2 * ox + kx - 1;
+                    if (iy < 0 || ix < 0 || iy >= in_size || ix >= in_size) {
+                        memset(p, 0, cin * sizeof(qtp_t));
+                    } else {
+                        memcpy(p, in + (iy * in_size + ix) * cin, cin * sizeof(qtp_t));
+                    }
+                }
+            }
+            qtp_t *o = out + (oy * out_size + ox) * cout;
+            for (int c = 0; c < cout; c++) {
+                int64_t v = presence_rescale(dl_dotq(patch, k->itemq + c * k->stride, len), shift) + b->itemq[c * b->stride];
+                o[c] = v > 0 ? presence_clip(v) : 0;
+            }
+        }
+    }
+    return b->exponent;
+}
+
+int presence_infer(const uint8_t *gray, float *score)
+{
+    if (!presence_obj || !gray || !score) {
+        return -1;
+    }
+    dl_arena_begin(presence_obj->arena);
+    qtp_t *buf0 = (qtp_t *)malloc(PRESENCE_BUF0);
+    qtp_t *buf1 = (qtp_t *)malloc(PRESENCE_BUF1);
+    qtp_t *patch = (qtp_t *)malloc(PRESENCE_PATCH);
+    int ret = -1;
+    if (buf0 && buf1 && patch) {
+        for (int i = 0; i < PRESENCE_INPUT_SIZE * PRESENCE_INPUT_SIZE; i++) {
+            buf0[i] = ((int)gray[i] - 128) * 256;
+        }
+        int exp = PRESENCE_INPUT_EXP;
+        int size = PRESENCE_INPUT_SIZE;
+        for (int layer = 0; layer < PRESENCE_LAYERS; layer++, size /= 2) {
+            qtp_t *in = (layer & 1) ? buf1 : buf0;
+            qtp_t *out = (layer & 1) ? buf0 : buf1;
+            exp = presence_conv(layer, in, size, exp, out, patch);
+        }
+        // global average pool of the last layer (in buf0), then the fully connected layer
+        int cin = presence_layer[PRESENCE_LAYERS].cin;
+        int n = PRESENCE_POOL_SIZE * PRESENCE_POOL_SIZE;
+        for (int c = 0; c < cin; c++) {
+            int32_t sum = 0;
+            for (int i = 0; i < n; i++) {
+                sum += buf0[i * cin + c];
+            }
+            patch[c] = (sum + n / 2) / n;
+        }
+        const dl_matrix2dq_t *k = presence_obj->kernel[PRESENCE_LAYERS];
+        const dl_matrix2dq_t *b = presence_obj->bias[PRESENCE_LAYERS];
+        int64_t logit[PRESENCE_CLASSES];
+        for (int c = 0; c < PRESENCE_CLASSES; c++) {
+            logit[c] = presence_rescale(dl_dotq(patch, k->itemq + c * k->stride, cin), b->exponent - (exp + k->exponent)) +
+                       b->itemq[c * b->stride];
+        }
+        *score = ldexpf((float)(logit[1] - logit[0]), b->exponent);
+        ret = 0;
+    } else {
+        ESP_LOGE(TAG, "activation malloc error\n");
+    }
+    free(patch);
+    free(buf1);
+    free(buf0);
+    dl_arena_end(presence_obj->arena);
+    return ret;
+}
+
+static inline uint8_t presence_luma(const uint8_t *line, int x)
+{
+    switch (presence_obj->config.format) {
+        case PRESENCE_Y:
+            return line[x];
+        case PRESENCE_YUYV:
+            return line[x * 2];
+        default: {
+            const uint8_t *p = line + x * 2;
+            uint32_t r = p[0] & 0xf8;
+            uint32_t g = ((p[0] & 0x07) << 5) | ((p[1] & 0xe0) >> 3);
+            uint32_t b = (p[1] & 0x1f) << 3;
+            return (r * 77 + g * 150 + b * 29) >> 8;
+        }
+    }
+}
+
+// Center square of the frame to 96x96, the mean of 2x2 pixels around every sample point
+static void presence_downscale(const uint8_t *frame)
+{
+    int width = presence_obj->config.width, high = presence_obj->config.high;
+    int side = width < high ? width : high;
+    int x0 = (width - side) / 2, y0 = (high - side) / 2;
+    size_t line_size = width * (presence_obj->config.format == PRESENCE_Y ? 1 : 2);
+    uint8_t *dst = presence_obj->gray;
+    for (int oy = 0; oy < PRESENCE_INPUT_SIZE; oy++) {
+        int sy = y0 + (2 * oy + 1) * side / (2 * PRESENCE_INPUT_SIZE);
+        const uint8_t *l0 = frame + sy * line_size;
+        const uint8_t *l1 = sy + 1 < high ? l0 + line_size : l0;
+        for (int ox = 0; ox < PRESENCE_INPUT_SIZE; ox++) {
+            int sx = x0 + (2 * ox + 1) * side / (2 * PRESENCE_INPUT_SIZE);
+            int sx1 = sx + 1 < width ? sx + 1 : sx;
+            *dst++ = (presence_luma(l0, sx) + presence_luma(l0, sx1) + presence_luma(l1, sx) + presence_luma(l1, sx1) + 2) >> 2;
+        }
+    }
+}
+
+static void presence_task(void *arg)
+{
+    while (1) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        int64_t start = esp_timer_get_time();
+        float score = 0;
+        int ret = presence_infer(presence_obj->gray, &score);
+        int64_t now = esp_timer_get_time();
+        uint32_t infer_ms = (now - start) / 1000;
+        presence_obj->inferences++;
+        if (infer_ms > presence_obj->max_infer_ms) {
+            presence_obj->max_infer_ms = infer_ms;
+        }
+        if (ret == 0) {
+            int change = -1;
+            if (score > presence_obj->config.threshold) {
+                presence_obj->last_positive = now;
+                if (!presence_obj->present) {
+                    change = 1;
+                }
+            } else if (presence_obj->present && now - presence_obj->last_positive >= (int64_t)presence_obj->config.hold_ms * 1000) {
+                change = 0;
+            }
+            if (change >= 0) {
+                presence_obj->present = change;
+                ESP_LOGI(TAG, "%s, score: %.2f\n", change ? "present" : "absent", score);
+                if (presence_obj->config.cb) {
+                    presence_obj->config.cb(change, score, presence_obj->config.arg);
+                }
+            }
+        }
+        presence_obj->busy = 0;
+    }
+}
+
+int presence_submit(const uint8_t *frame)
+{
+    if (!presence_obj || !frame) {
+        return -1;
+    }
+    int64_t now = esp_timer_get_time();
+    if (presence_obj->busy || now < presence_obj->next_time) {
+        return 0;
+    }
+    presence_downscale(frame);
+    uint32_t interval = presence_obj->present ? presence_obj->config.interval_present_ms : presence_obj->config.interval_ms;
+    presence_obj->next_time = now + (int64_t)interval * 1000;
+    presence_obj->busy = 1;
+    xTaskNotifyGive(presence_obj->task);
+    return 1;
+}
+
+int presence_get_state(void)
+{
+    return presence_obj ? presence_obj->present : 0;
+}
+
+void presence_get_stats(uint32_t *inferences, uint32_t *max_infer_ms)
+{
+    *inferences = presence_obj ? presence_obj->inferences : 0;
+    *max_infer_ms = presence_obj ? presence_obj->max_infer_ms : 0;
+}
+
+void presence_deinit(void)
+{
+    if (!presence_obj) {
+        return;
+    }
+    while (presence_obj->busy) {
+        vTaskDelay(10 / portTICK_PERIOD_MS);
+    }
+    if (presence_obj->task) {
+        vTaskDelete(presence_obj->task);
+    }
+    const model_coeff_getter_t *coeff = presence_obj->config.coeff;
+    for (int i = 0; i <= PRESENCE_LAYERS; i++) {
+        if (coeff->free_q && presence_obj->kernel[i]) {
+            coeff->free_q(presence_obj->kernel[i]);
+        }
+        if (coeff->free_q && presence_obj->bias[i]) {
+            coeff->free_q(presence_obj->bias[i]);
+        }
+    }
+    dl_arena_destroy(presence_obj->arena);
+    free(presence_obj->gray);
+    free(presence_obj);
+    presence_obj = NULL;
+}
+
+int presence_init(const presence_config_t *config)
+{
+    if (!config->coeff || !config->coeff->getter_q || config->format > PRESENCE_RGB565) {
+        ESP_LOGE(TAG, "coefficients or format error\n");
+        return -1;
+    }
+    if (config->width < PRESENCE_INPUT_SIZE || config->high < PRESENCE_INPUT_SIZE) {
+        ESP_LOGE(TAG, "frame %dx%d smaller than the input\n", config->width, config->high);
+        return -1;
+    }
+    presence_deinit();
+    presence_obj = (presence_obj_t *)calloc(1, sizeof(presence_obj_t));
+    if (!presence_obj) {
+        ESP_LOGE(TAG, "presence object malloc error\n");
+        return -1;
+    }
+    presence_obj->config = *config;
+    presence_obj->config.interval_ms = config->interval_ms ? config->interval_ms : 1000;
+    presence_obj->config.interval_present_ms = config->interval_present_ms ? config->interval_present_ms : presence_obj->config.interval_ms;
+    presence_obj->config.hold_ms = config->hold_ms ? config->hold_ms : 10000;
+
+    for (int i = 0; i <= PRESENCE_LAYERS; i++) {
+        const presence_layer_t *l = &presence_layer[i];
+        int k_size = i < PRESENCE_LAYERS ? 9 * l->cin : l->cin;
+        const dl_matrix2dq_t *k = presence_obj->kernel[i] = config->coeff->getter_q(l->kernel, NULL, 0);
+        const dl_matrix2dq_t *b = presence_obj->bias[i] = config->coeff->getter_q(l->bias, NULL, 0);
+        if (!k || !b || k->w != l->cout || k->h != k_size || b->w != l->cout) {
+            ESP_LOGE(TAG, "%s or %s missing or not %dx%d\n", l->kernel, l->bias, l->cout, k_size);
+            presence_deinit();
+            return -1;
+        }
+    }
+    // 激活值在内部 RAM 的 arena 中，每次推理复用同一块内存
+    presence_obj->arena = dl_arena_create(PRESENCE_ARENA, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    presence_obj->gray = (uint8_t *)malloc(PRESENCE_INPUT_SIZE * PRESENCE_INPUT_SIZE);
+    if (!presence_obj->arena || !presence_obj->gray) {
+        ESP_LOGE(TAG, "arena or input malloc error\n");
+        presence_deinit();
+        return -1;
+    }
+    if (xTaskCreate(presence_task, "presence", 1024 * 4, NULL, config->task_pri, &presence_obj->task) != pdPASS) {
+        ESP_LOGE(TAG, "presence task create error\n");
+        presence_deinit();
+        return -1;
+    }
+    ESP_LOGI(TAG, "every %u ms, %u ms while present, dot kernel: %s\n", presence_obj->config.interval_ms,
+             presence_obj->config.interval_present_ms, dl_dotq_impl_name());
+    return 0;
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// QR code reader for provisioning codes shown to the camera, versions 1 to 6 (up to 21x21 .. 41x41 modules,
+// 134 bytes at level L), numeric, alphanumeric and byte segments.
+// qr_scan_submit copies a downscaled luma plane of the frame when the scanner is idle and returns at once,
+// the decode runs in its own task below the preview: a frame that comes while it is busy is not scanned.
+// The decoder binarizes the plane against local block means, looks for finder patterns line by line and
+// stops there when there are not three of them, which is the cost of a frame without a code.
+
+typedef enum {
+    QR_SCAN_Y = 0,   // 8 bit luma (CAM_FORMAT_Y)
+    QR_SCAN_YUYV,    // YUV422 as the sensor sends it, luma in the even bytes
+    QR_SCAN_RGB565,  // RGB565 in LCD byte order
+} qr_scan_format_t;
+
+// Called by the scan task for every frame a code was read in, text is NUL terminated
+typedef void (*qr_scan_cb_t)(const char *text, size_t len, void *arg);
+
+typedef struct {
+    uint16_t width;      // frame size in pixels
+    uint16_t high;
+    uint8_t format;      // qr_scan_format_t
+    uint8_t scale;       // scan one pixel per scale x scale, 0: 1. keep 3 pixels or more per module after it
+    uint8_t task_pri;    // below the preview task
+    int8_t task_core;    // -1: no affinity, single core chips ignore it
+    qr_scan_cb_t cb;
+    void *arg;
+} qr_scan_config_t;
+
+// 1: the frame was copied for a scan, 0: the scanner is busy and the frame was skipped, -1: error
+int qr_scan_submit(const uint8_t *frame);
+
+// Decode in the caller's task. luma is overwritten by its binarized image.
+// Returns the text length, text is NUL terminated, or -1 when no code was read
+int qr_scan_decode(uint8_t *luma, int width, int high, char *text, size_t size);
+
+// Frames scanned, frames a code was read in, and the slowest decode since qr_scan_init in ms
+void qr_scan_get_stats(uint32_t *scanned, uint32_t *decoded, uint32_t *max_decode_ms);
+
+int qr_scan_init(const qr_scan_config_t *config);
+
+void qr_scan_deinit(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,981 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "qr_scan.h"
+
+static const char *TAG = "qr_scan";
+
+#define QR_VERSION_MAX   6
+#define QR_SIZE_MAX      (17 + 4 * QR_VERSION_MAX)
+#define QR_CODEWORDS_MAX 172
+#define QR_ECC_MAX       28
+#define QR_BLOCK         8   // binarization block side in pixels
+#define QR_RANGE_MIN     24  // blocks with less contrast take the threshold of their neighbours
+#define QR_FINDER_MAX    32
+#define QR_TRY_MAX       8   // finder candidates combined into triples
+#define QR_TEXT_MAX      256
+
+typedef struct {
+    float x;        // centre, pixel centres are at .5
+    float y;
+    float module;   // module size in pixels
+    int hits;       // lines the pattern was found in
+} qr_finder_t;
+
+typedef struct {
+    const uint8_t *bin;  // 1: dark
+    int width;
+    int high;
+    int size;            // modules per side
+    float h[8];          // module coordinates to pixels
+    uint8_t grid[QR_SIZE_MAX][QR_SIZE_MAX];
+    uint8_t raw[QR_CODEWORDS_MAX];
+    uint8_t data[QR_CODEWORDS_MAX];
+} qr_code_t;
+
+typedef struct {
+    qr_scan_config_t config;
+    int width;           // scanned plane
+    int high;
+    uint8_t *luma;
+    TaskHandle_t task;
+    volatile int busy;
+    uint32_t scanned;
+    uint32_t decoded;
+    uint32_t max_decode_ms;
+} qr_scan_obj_t;
+
+static qr_scan_obj_t *qr_scan_obj = NULL;
+
+// Error correction of versions 1 to 6: codewords per block and number of blocks, levels L, M, Q, H
+static const uint16_t qr_codewords[QR_VERSION_MAX + 1] = {0, 26, 44, 70, 100, 134, 172};
+static const uint8_t qr_ecc[QR_VERSION_MAX + 1][4][2] = {
+    {{0, 0}, {0, 0}, {0, 0}, {0, 0}},
+    {{7, 1}, {10, 1}, {13, 1}, {17, 1}},
+    {{10, 1}, {16, 1}, {22, 1}, {28, 1}},
+    {{15, 1}, {26, 1}, {18, 2}, {22, 2}},
+    {{20, 1}, {18, 2}, {26, 2}, {16, 4}},
+    {{26, 1}, {24, 2}, {18, 4}, {22, 4}},
+    {{18, 2}, {16, 4}, {24, 4}, {28, 4}},
+};
+
+static uint8_t gf_exp[512];
+static uint8_t gf_log[256];
+
+static void gf_init(void)
+{
+    if (gf_exp[0]) {
+        return;
+    }
+    int x = 1;
+    for (int i = 0; i < 255; i++) {
+        gf_exp[i] = x;
+        gf_log[x] = i;
+        x <<= 1;
+        if (x & 0x100) {
+            x ^= 0x11d;
+        }
+    }
+    for (int i = 255; i < 512; i++) {
+        gf_exp[i] = gf_exp[i - 255];
+    }
+}
+
+static inline uint8_t gf_mul(uint8_t a, uint8_t b)
+{
+    return (a && b) ? gf_exp[gf_log[a] + gf_log[b]] : 0;
+}
+
+static inline uint8_t gf_div(uint8_t a, uint8_t b)
+{
+    return a ? gf_exp[gf_log[a] + 255 - gf_log[b]] : 0;
+}
+
+// p[0] is the constant term
+static uint8_t gf_eval(const uint8_t *p, int len, uint8_t x)
+{
+    uint8_t v = 0;
+    for (int i = len - 1; i >= 0; i--) {
+        v = gf_mul(v, x) ^ p[i];
+    }
+    return v;
+}
+
+// Reed-Solomon correction of one block, the first codeword is the highest power. 0: ok, -1: too many errors
+static int qr_rs_correct(uint8_t *block, int n, int ecc)
+{
+    uint8_t s[QR_ECC_MAX];
+    int errors = 0;
+    for (int i = 0; i < ecc; i++) {
+        uint8_t v = 0;
+        for (int j = 0; j < n; j++) {
+            v = gf_mul(v, gf_exp[i]) ^ block[j];
+        }
+        s[i] = v;
+        errors |= v;
+    }
+    if (!errors) {
+        return 0;
+    }
+    // Berlekamp-Massey for the error locator
+    uint8_t c[QR_ECC_MAX + 1] = {1}, b[QR_ECC_MAX + 1] = {1}, t[QR_ECC_MAX + 1];
+    int l = 0, m = 1;
+    uint8_t bd = 1;
+    for (int k = 0; k < ecc; k++) {
+        uint8_t d = s[k];
+        for (int i = 1; i <= l; i++) {
+            d ^= gf_mul(c[i], s[k - i]);
+        }
+        if (!d) {
+            m++;
+            continue;
+        }
+        uint8_t coef = gf_div(d, bd);
+        memcpy(t, c, sizeof(t));
+        for (int i = 0; i + m <= ecc; i++) {
+            c[i + m] ^= gf_mul(coef, b[i]);
+        }
+        if (2 * l <= k) {
+            l = k + 1 - l;
+            memcpy(b, t, sizeof(b));
+            bd = d;
+            m = 1;
+        } else {
+            m++;
+        }
+    }
+    if (2 * l > ecc) {
+        return -1;
+    }
+    // error evaluator s(x) * c(x) mod x^ecc, and the formal derivative of the locator
+    uint8_t omega[QR_ECC_MAX], dc[QR_ECC_MAX + 1] = {0};
+    for (int k = 0; k < ecc; k++) {
+        omega[k] = 0;
+        for (int i = 0; i <= k && i <= l; i++) {
+            omega[k] ^= gf_mul(s[k - i], c[i]);
+        }
+    }
+    for (int i = 1; i <= l; i += 2) {
+        dc[i - 1] = c[i];
+    }
+    // Chien search over the codeword positions, Forney for the values
+    int found = 0;
+    for (int j = 0; j < n; j++) {
+        int power = n - 1 - j;
+        uint8_t x_inv = gf_exp[(255 - power) % 255];
+        if (gf_eval(c, l + 1, x_inv)) {
+            continue;
+        }
+        uint8_t den = gf_eval(dc, l, x_inv);
+        if (!den) {
+            return -1;
+        }
+        block[j] ^= gf_mul(gf_exp[power], gf_div(gf_eval(omega, ecc, x_inv), den));
+        found++;
+    }
+    return found == l ? 0 : -1;
+}
+
+// Hybrid binarization: the threshold of a block is the mean of the 5x5 blocks around it, flat blocks take
+// half their minimum (light) unless their neighbours are darker. img becomes 1 for dark, 0 for light
+static int qr_binarize(uint8_t *img, int width, int high)
+{
+    int bw = (width + QR_BLOCK - 1) / QR_BLOCK;
+    int bh = (high + QR_BLOCK - 1) / QR_BLOCK;
+    uint8_t *avg = (uint8_t *)malloc(bw * bh);
+    if (!avg) {
+        return -1;
+    }
+    for (int by = 0; by < bh; by++) {
+        for (int bx = 0; bx < bw; bx++) {
+            int x0 = bx * QR_BLOCK, y0 = by * QR_BLOCK;
+            int x1 = x0 + QR_BLOCK < width ? x0 + QR_BLOCK : width;
+            int y1 = y0 + QR_BLOCK < high ? y0 + QR_BLOCK : high;
+            int sum = 0, min = 255, max = 0;
+            for (int y = y0; y < y1; y++) {
+                const uint8_t *p = img + y * width;
+                for (int x = x0; x < x1; x++) {
+                    sum += p[x];
+                    min = p[x] < min ? p[x] : min;
+                    max = p[x] > max ? p[x] : max;
+                }
+            }
+            int mean = sum / ((x1 - x0) * (y1 - y0));
+            if (max - min <= QR_RANGE_MIN) {
+                mean = min / 2;
+                if (by && bx) {
+                    int nb = (avg[(by - 1) * bw + bx] + 2 * avg[by * bw + bx - 1] + avg[(by - 1) * bw + bx - 1]) / 4;
+                    if (min < nb) {
+                        mean = nb;
+                    }
+                }
+            }
+            avg[by * bw + bx] = mean;
+        }
+    }
+    for (int by = 0; by < bh; by++) {
+        for (int bx = 0; bx < bw; bx++) {
+            int cx = bx < 2 ? 2 : (bx > bw - 3 ? bw - 3 : bx);
+            int cy = by < 2 ? 2 : (by > bh - 3 ? bh - 3 : by);
+            int sum = 0, n = 0;
+            for (int y = cy - 2; y <= cy + 2; y++) {
+                for (int x = cx - 2; x <= cx + 2; x++) {
+                    if (x >= 0 && x < bw && y >= 0 && y < bh) {
+                        sum += avg[y * bw + x];
+                        n++;
+                    }
+                }
+            }
+            int threshold = sum / n;
+            int x0 = bx * QR_BLOCK, y0 = by * QR_BLOCK;
+            int x1 = x0 + QR_BLOCK < width ? x0 + QR_BLOCK : width;
+            int y1 = y0 + QR_BLOCK < high ? y0 + QR_BLOCK : high;
+            for (int y = y0; y < y1; y++) {
+                uint8_t *p = img + y * width;
+                for (int x = x0; x < x1; x++) {
+                    p[x] = p[x] <= threshold;
+                }
+            }
+        }
+    }
+    free(avg);
+    return 0;
+}
+
+// 1:1:3:1:1 within half a module
+static int qr_finder_ratio(const int *r)
+{
+    int total = r[0] + r[1] + r[2] + r[3] + r[4];
+    if (total < 7) {
+        return 0;
+    }
+    int var = total / 2;
+    return abs(7 * r[0] - total) < var && abs(7 * r[1] - total) < var && abs(7 * r[2] - 3 * total) < 3 * var &&
+           abs(7 * r[3] - total) < var && abs(7 * r[4] - total) < var;
+}
+
+// Runs of a finder pattern through the dark pixel (x, y) along (dx, dy).
+// Returns the pattern length and the centre of its middle run in *center, 0 when it is no finder
+static int qr_finder_cross(const qr_code_t *qr, int x, int y, int dx, int dy, int max_total, float *center)
+{
+#define QR_IN(px, py) ((px) >= 0 && (px) < qr->width && (py) >= 0 && (py) < qr->high)
+#define QR_PIX(px, py) (qr->bin[(py) * qr->width + (px)])
+    int r[5] = {0};
+    int px = x, py = y;
+    int back = 0, fwd = 0;
+    while (QR_IN(px, py) && QR_PIX(px, py)) {
+        back++;
+        px -= dx;
+        py -= dy;
+    }
+    for (int i = 1, colour = 0; i >= 0; i--, colour ^= 1) {
+        while (QR_IN(px, py) && QR_PIX(px, py) == colour && r[i] <= max_total) {
+            r[i]++;
+            px -= dx;
+            py -= dy;
+        }
+    }
+    px = x + dx;
+    py = y + dy;
+    while (QR_IN(px, py) && QR_PIX(px, py)) {
+        fwd++;
+        px += dx;
+        py += dy;
+    }
+    for (int i = 3, colour = 0; i <= 4; i++, colour ^= 1) {
+        while (QR_IN(px, py) && QR_PIX(px, py) == colour && r[i] <= max_total) {
+            r[i]++;
+            px += dx;
+            py += dy;
+        }
+    }
+#undef QR_IN
+#undef QR_PIX
+    r[2] = back + fwd;
+    if (!qr_finder_ratio(r)) {
+        return 0;
+    }
+    int pos = dx ? x : y;
+    *center = pos - back + 1 + r[2] / 2.0f;
+    return r[0] + r[1] + r[2] + r[3] + r[4];
+}
+
+static void qr_finder_add(qr_finder_t *f, int *cnt, float x, float y, float module)
+{
+    for (int i = 0; i < *cnt; i++) {
+        if (abs((int)(f[i].x - x)) <= f[i].module && abs((int)(f[i].y - y)) <= f[i].module &&
+            (module - f[i].module <= 1.0f || module <= f[i].module * 1.4f) &&
+            (f[i].module - module <= 1.0f || f[i].module <= module * 1.4f)) {
+            int n = f[i].hits;
+            f[i].x = (f[i].x * n + x) / (n + 1);
+            f[i].y = (f[i].y * n + y) / (n + 1);
+            f[i].module = (f[i].module * n + module) / (n + 1);
+            f[i].hits++;
+            return;
+        }
+    }
+    int i = *cnt;
+    if (i == QR_FINDER_MAX) {
+        // full of noise seen in one line each, a real pattern is seen in several
+        for (i = QR_FINDER_MAX - 1; i >= 0 && f[i].hits > 1; i--);
+        if (i < 0) {
+            return;
+        }
+    } else {
+        (*cnt)++;
+    }
+    f[i].x = x;
+    f[i].y = y;
+    f[i].module = module;
+    f[i].hits = 1;
+}
+
+// Scan every line for the 1:1:3:1:1 run sequence, confirm it vertically and again horizontally
+static int qr_find_finders(const qr_code_t *qr, qr_finder_t *f)
+{
+    int cnt = 0;
+    for (int y = 0; y < qr->high; y++) {
+        const uint8_t *line = qr->bin + y * qr->width;
+        int r[5] = {0};
+        int runs = 0, colour = line[0], len = 0;
+        for (int x = 0; x <= qr->width; x++) {
+            int p = x < qr->width ? line[x] : !colour;
+            if (p == colour) {
+                len++;
+                continue;
+            }
+            memmove(r, r + 1, sizeof(int) * 4);
+            r[4] = len;
+            runs++;
+            colour = p;
+            len = 1;
+            if (p || runs < 5 || !qr_finder_ratio(r)) {
+                continue; // the run that ended was light, or no pattern yet
+            }
+            int total = r[0] + r[1] + r[2] + r[3] + r[4];
+            int cx = x - r[4] - r[3] - r[2] / 2 - 1;
+            float cy, fx;
+            int total_v = qr_finder_cross(qr, cx, y, 0, 1, total * 2, &cy);
+            if (!total_v || 5 * abs(total_v - total) >= 2 * total) {
+                continue;
+            }
+            int total_h = qr_finder_cross(qr, cx, (int)cy, 1, 0, total * 2, &fx);
+            if (!total_h || 5 * abs(total_h - total) >= 2 * total) {
+                continue;
+            }
+            qr_finder_add(f, &cnt, fx, cy, (total_h + total_v) / 14.0f);
+        }
+    }
+    // patterns seen in one line only are noise
+    int n = 0;
+    for (int i = 0; i < cnt; i++) {
+        if (f[i].hits >= 2) {
+            f[n++] = f[i];
+        }
+    }
+    // most hits first, they are combined first
+    for (int i = 1; i < n; i++) {
+        for (int j = i; j > 0 && f[j].hits > f[j - 1].hits; j--) {
+            qr_finder_t t = f[j];
+            f[j] = f[j - 1];
+            f[j - 1] = t;
+        }
+    }
+    return n;
+}
+
+// Projective map taking the module coordinates m to the pixels p
+static int qr_homography(qr_code_t *qr, const float m[4][2], const float p[4][2])
+{
+    float a[8][9];
+    for (int i = 0; i < 4; i++) {
+        float x = m[i][0], y = m[i][1], u = p[i][0], v = p[i][1];
+        float r0[9] = {x, y, 1, 0, 0, 0, -x * u, -y * u, u};
+        float r1[9] = {0, 0, 0, x, y, 1, -x * v, -y * v, v};
+        memcpy(a[2 * i], r0, sizeof(r0));
+        memcpy(a[2 * i + 1], r1, sizeof(r1));
+    }
+    for (int col = 0; col < 8; col++) {
+        int pivot = col;
+        for (int row = col + 1; row < 8; row++) {
+            if ((a[row][col] < 0 ? -a[row][col] : a[row][col]) > (a[pivot][col] < 0 ? -a[pivot][col] : a[pivot][col])) {
+                pivot = row;
+            }
+        }
+        if (a[pivot][col] > -1e-6f && a[pivot][col] < 1e-6f) {
+            return -1;
+        }
+        if (pivot != col) {
+            float t[9];
+            memcpy(t, a[col], sizeof(t));
+            memcpy(a[col], a[pivot], sizeof(t));
+            memcpy(a[pivot], t, sizeof(t));
+        }
+        for (int row = 0; row < 8; row++) {
+            if (row == col || a[row][col] == 0) {
+                continue;
+            }
+            float k = a[row][col] / a[col][col];
+            for (int i = col; i < 9; i++) {
+                a[row][i] -= k * a[col][i];
+            }
+        }
+    }
+    for (int i = 0; i < 8; i++) {
+        qr->h[i] = a[i][8] / a[i][i];
+    }
+    return 0;
+}
+
+// Sample the centre of every module through the projective map taking m to p, -1 when the code leaves the image
+static int qr_sample(qr_code_t *qr, const float m[4][2], const float p[4][2])
+{
+    if (qr_homography(qr, m, p) != 0) {
+        return -1;
+    }
+    const float *h = qr->h;
+    for (int r = 0; r < qr->size; r++) {
+        // numerators and denominator grow linearly along a module row
+        float y = r + 0.5f;
+        float u = h[0] * 0.5f + h[1] * y + h[2];
+        float v = h[3] * 0.5f + h[4] * y + h[5];
+        float w = h[6] * 0.5f + h[7] * y + 1.0f;
+        for (int c = 0; c < qr->size; c++, u += h[0], v += h[3], w += h[6]) {
+            if (w <= 0) {
+                return -1;
+            }
+            float px = u / w, py = v / w;
+            if (px < 0 || py < 0 || px >= qr->width || py >= qr->high) {
+                return -1;
+            }
+            qr->grid[r][c] = qr->bin[(int)py * qr->width + (int)px];
+        }
+    }
+    return 0;
+}
+
+// Modules of the two timing lines that break the dark, light alternation
+static int qr_timing_errors(const qr_code_t *qr)
+{
+    int errors = 0;
+    for (int i = 8; i < qr->size - 8; i++) {
+        errors += qr->grid[6][i] != !(i & 1);
+        errors += qr->grid[i][6] != !(i & 1);
+    }
+    return errors;
+}
+
+// Best match of the 5x5 alignment pattern near (x, y), eu and ev are one module along the code axes
+static int qr_find_alignment(const qr_code_t *qr, float *x, float *y, const float *eu, const float *ev, float module)
+{
+    int range = (int)(module * 3) + 2;
+    int best = 0;
+    float bx = 0, by = 0, best_dist = 0;
+    for (int dy = -range; dy <= range; dy++) {
+        for (int dx = -range; dx <= range; dx++) {
+            float cx = *x + dx, cy = *y + dy;
+            int score = 0;
+            for (int j = -2; j <= 2; j++) {
+                for (int i = -2; i <= 2; i++) {
+                    int px = (int)(cx + i * eu[0] + j * ev[0]);
+                    int py = (int)(cy + i * eu[1] + j * ev[1]);
+                    if (px < 0 || py < 0 || px >= qr->width || py >= qr->high) {
+                        continue;
+                    }
+                    int dark = (abs(i) == 2 || abs(j) == 2 || (i == 0 && j == 0));
+                    score += qr->bin[py * qr->width + px] == dark;
+                }
+            }
+            float dist = (float)(dx * dx + dy * dy);
+            if (score > best || (score == best && dist < best_dist)) {
+                best = score;
+                best_dist = dist;
+                bx = cx;
+                by = cy;
+            }
+        }
+    }
+    if (best < 22) {
+        return -1;
+    }
+    *x = bx;
+    *y = by;
+    return 0;
+}
+
+static int qr_is_function(int size, int version, int r, int c)
+{
+    if ((r < 9 && c < 9) || (r < 9 && c >= size - 8) || (r >= size - 8 && c < 9) || r == 6 || c == 6) {
+        return 1;
+    }
+    int a = size - 7;
+    return version >= 2 && abs(r - a) <= 2 && abs(c - a) <= 2;
+}
+
+static int qr_mask(int mask, int i, int j)
+{
+    switch (mask) {
+        case 0: return (i + j) % 2 == 0;
+        case 1: return i % 2 == 0;
+        case 2: return j % 3 == 0;
+        case 3: return (i + j) % 3 == 0;
+        case 4: return (i / 2 + j / 3) % 2 == 0;
+        case 5: return (i * j) % 2 + (i * j) % 3 == 0;
+        case 6: return ((i * j) % 2 + (i * j) % 3) % 2 == 0;
+        default: return ((i + j) % 2 + (i * j) % 3) % 2 == 0;
+    }
+}
+
+// 15 bit format word, error level and mask, of the closest valid word within 3 bits. -1: none
+static int qr_format_decode(int bits)
+{
+    for (int d = 0; d < 32; d++) {
+        int v = d << 10;
+        for (int i = 4; i >= 0; i--) {
+            if (v & (1 << (i + 10))) {
+                v ^= 0x537 << i;
+            }
+        }
+        int word = ((d << 10) | v) ^ 0x5412;
+        if (__builtin_popcount(word ^ bits) <= 3) {
+            return d;
+        }
+    }
+    return -1;
+}
+
+static int qr_read_format(const qr_code_t *qr)
+{
+    int size = qr->size, a = 0, b = 0;
+    for (int i = 0; i <= 5; i++) {
+        a |= qr->grid[i][8] << i;
+    }
+    a |= qr->grid[7][8] << 6;
+    a |= qr->grid[8][8] << 7;
+    a |= qr->grid[8][7] << 8;
+    for (int i = 9; i < 15; i++) {
+        a |= qr->grid[8][14 - i] << i;
+    }
+    for (int i = 0; i < 8; i++) {
+        b |= qr->grid[8][size - 1 - i] << i;
+    }
+    for (int i = 8; i < 15; i++) {
+        b |= qr->grid[size - 15 + i][8] << i;
+    }
+    int d = qr_format_decode(a);
+    return d >= 0 ? d : qr_format_decode(b);
+}
+
+static int qr_bits(const uint8_t *data, int len, int *pos, int n)
+{
+    int v = 0;
+    if (*pos + n > len * 8) {
+        return -1;
+    }
+    for (int i = 0; i < n; i++, (*pos)++) {
+        v = (v << 1) | ((data[*pos >> 3] >> (7 - (*pos & 7))) & 1);
+    }
+    return v;
+}
+
+// Segments of the corrected data codewords to text, -1 on a segment this reader does not know
+static int qr_parse(const uint8_t *data, int len, char *text, size_t size)
+{
+    static const char alnum[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ $%*+-./:";
+    size_t out = 0;
+    int pos = 0;
+#define QR_PUT(ch) do { if (out + 1 >= size) return -1; text[out++] = (ch); } while (0)
+    while (1) {
+        int mode = qr_bits(data, len, &pos, 4);
+        if (mode <= 0) {
+            break; // terminator, or the data ended
+        }
+        if (mode == 7) { // ECI designator, the bytes are passed on as they are
+            int v = qr_bits(data, len, &pos, 8);
+            if (v < 0 || ((v & 0x80) && qr_bits(data, len, &pos, (v & 0x40) ? 16 : 8) < 0)) {
+                return -1;
+            }
+            continue;
+        }
+        if (mode == 5 || mode == 9) { // FNC1
+            if (mode == 9 && qr_bits(data, len, &pos, 8) < 0) {
+                return -1;
+            }
+            continue;
+        }
+        int count = qr_bits(data, len, &pos, mode == 1 ? 10 : (mode == 2 ? 9 : 8));
+        if (count < 0) {
+            return -1;
+        }
+        if (mode == 1) {
+            for (; count >= 3; count -= 3) {
+                int v = qr_bits(data, len, &pos, 10);
+                if (v < 0 || v > 999) {
+                    return -1;
+                }
+                QR_PUT('0' + v / 100);
+                QR_PUT('0' + v / 10 % 10);
+                QR_PUT('0' + v % 10);
+            }
+            if (count) {
+                int v = qr_bits(data, len, &pos, count == 2 ? 7 : 4);
+                if (v < 0 || v >= (count == 2 ? 100 : 10)) {
+                    return -1;
+                }
+                if (count == 2) {
+                    QR_PUT('0' + v / 10);
+                }
+                QR_PUT('0' + v % 10);
+            }
+        } else if (mode == 2) {
+            for (; count >= 2; count -= 2) {
+                int v = qr_bits(data, len, &pos, 11);
+                if (v < 0 || v >= 45 * 45) {
+                    return -1;
+                }
+                QR_PUT(alnum[v / 45]);
+                QR_PUT(alnum[v % 45]);
+            }
+            if (count) {
+                int v = qr_bits(data, len, &pos, 6);
+                if (v < 0 || v >= 45) {
+                    return -1;
+                }
+                QR_PUT(alnum[v]);
+            }
+        } else if (mode == 4) {
+            while (count--) {
+                int v = qr_bits(data, len, &pos, 8);
+                if (v < 0) {
+                    return -1;
+                }
+                QR_PUT(v);
+            }
+        } else {
+            return -1; // kanji and structured append
+        }
+    }
+#undef QR_PUT
+    text[out] = '\0';
+    return out;
+}
+
+// Read the grid sampled for version, -1 when it is no valid code of that version
+static int qr_decode_grid(qr_code_t *qr, int version, char *text, size_t size)
+{
+    int format = qr_read_format(qr);
+    if (format < 0) {
+        return -1;
+    }
+    int level = (format >> 3) ^ 1; // format order M, L, H, Q to L, M, Q, H
+    int mask = format & 7;
+    int total = qr_codewords[version];
+
+    // codewords in two module columns, upwards and downwards in turn, from the right
+    int n = 0;
+    memset(qr->raw, 0, total);
+    for (int right = qr->size - 1; right >= 1; right -= 2) {
+        if (right == 6) {
+            right = 5;
+        }
+        int upward = ((right + 1) & 2) == 0;
+        for (int vert = 0; vert < qr->size; vert++) {
+            int r = upward ? qr->size - 1 - vert : vert;
+            for (int j = 0; j < 2; j++) {
+                int c = right - j;
+                if (qr_is_function(qr->size, version, r, c) || n >= total * 8) {
+                    continue;
+                }
+                if (qr->grid[r][c] ^ qr_mask(mask, r, c)) {
+                    qr->raw[n >> 3] |= 0x80 >> (n & 7);
+                }
+                n++;
+            }
+        }
+    }
+
+    // blocks are interleaved codeword by codeword, the long blocks come last
+    int ecc = qr_ecc[version][level][0];
+    int blocks = qr_ecc[version][level][1];
+    int short_len = total / blocks;
+    int short_cnt = blocks - total % blocks;
+    uint8_t block[QR_CODEWORDS_MAX];
+    int data_len = 0;
+    for (int b = 0; b < blocks; b++) {
+        int len = short_len + (b >= short_cnt);
+        int dlen = len - ecc;
+        for (int i = 0; i < dlen; i++) {
+            // data codeword i of block b sits after i codewords of every block, plus the short blocks' missing one
+            int k = i * blocks + b;
+            if (i == short_len - ecc) {
+                k = i * blocks + b - short_cnt;
+            }
+            block[i] = qr->raw[k];
+        }
+        int data_total = total - ecc * blocks;
+        for (int i = 0; i < ecc; i++) {
+            block[dlen + i] = qr->raw[data_total + i * blocks + b];
+        }
+        if (qr_rs_correct(block, len, ecc) != 0) {
+            return -1;
+        }
+        memcpy(qr->data + data_len, block, dlen);
+        data_len += dlen;
+    }
+    return qr_parse(qr->data, data_len, text, size);
+}
+
+// Try three finder patterns as the corners of a code, the one at the right angle is top left
+static int qr_try(qr_code_t *qr, const qr_finder_t *f0, const qr_finder_t *f1, const qr_finder_t *f2, char *text, size_t size)
+{
+    const qr_finder_t *f[3] = {f0, f1, f2};
+    float min = f0->module, max = f0->module;
+    for (int i = 1; i < 3; i++) {
+        min = f[i]->module < min ? f[i]->module : min;
+        max = f[i]->module > max ? f[i]->module : max;
+    }
+    if (max > min * 1.5f) {
+        return -1;
+    }
+    float d[3]; // d[i]: squared side opposite f[i]
+    for (int i = 0; i < 3; i++) {
+        const qr_finder_t *a = f[(i + 1) % 3], *b = f[(i + 2) % 3];
+        d[i] = (a->x - b->x) * (a->x - b->x) + (a->y - b->y) * (a->y - b->y);
+    }
+    int c = d[0] > d[1] ? (d[0] > d[2] ? 0 : 2) : (d[1] > d[2] ? 1 : 2);
+    const qr_finder_t *tl = f[c], *tr = f[(c + 1) % 3], *bl = f[(c + 2) % 3];
+    float l1 = d[(c + 2) % 3], l2 = d[(c + 1) % 3]; // squared legs to tr and bl
+    if (l1 > l2 * 1.6f || l2 > l1 * 1.6f || d[c] > (l1 + l2) * 1.3f || d[c] < (l1 + l2) * 0.7f) {
+        return -1;
+    }
+    // image y points down: top right to bottom left turns clockwise around top left
+    if ((tr->x - tl->x) * (bl->y - tl->y) - (tr->y - tl->y) * (bl->x - tl->x) < 0) {
+        const qr_finder_t *t = tr;
+        tr = bl;
+        bl = t;
+    }
+    float module = (tl->module + tr->module + bl->module) / 3;
+    float side = sqrtf((l1 + l2) / 2);
+    int estimate = (int)((side / module + 7 - 17) / 4 + 0.5f);
+    static const int order[5] = {0, -1, 1, -2, 2};
+    int jittered = 0;
+    for (int k = 0; k < 5; k++) {
+        int version = estimate + order[k];
+        if (version < 1 || version > QR_VERSION_MAX) {
+            continue;
+        }
+        int s = 17 + 4 * version;
+        float span = s - 7;
+        float eu[2] = {(tr->x - tl->x) / span, (tr->y - tl->y) / span};
+        float ev[2] = {(bl->x - tl->x) / span, (bl->y - tl->y) / span};
+        float m[4][2] = {{3.5f, 3.5f}, {s - 3.5f, 3.5f}, {3.5f, s - 3.5f}, {s - 3.5f, s - 3.5f}};
+        float p[4][2] = {{tl->x, tl->y}, {tr->x, tr->y}, {bl->x, bl->y}, {tr->x + bl->x - tl->x, tr->y + bl->y - tl->y}};
+        if (version >= 2) {
+            float ax = tl->x + (s - 10) * (eu[0] + ev[0]);
+            float ay = tl->y + (s - 10) * (eu[1] + ev[1]);
+            if (qr_find_alignment(qr, &ax, &ay, eu, ev, module) == 0) {
+                m[3][0] = m[3][1] = s - 6.5f;
+                p[3][0] = ax;
+                p[3][1] = ay;
+            }
+        }
+        qr->size = s;
+        // a wrong version or a bad map shows in the timing lines, long before the error correction
+        if (qr_sample(qr, m, p) != 0 || qr_timing_errors(qr) * 2 > s - 16 || qr_read_format(qr) < 0) {
+            continue;
+        }
+        int len = qr_decode_grid(qr, version, text, size);
+        if (len >= 0) {
+            return len;
+        }
+        if (jittered) {
+            continue;
+        }
+        // Perspective moves the far corner off the estimate, most of all without an alignment pattern:
+        // try it up to one module away, closest first
+        jittered = 1;
+        float p3[2] = {p[3][0], p[3][1]};
+        for (int i = 1; i < 25; i++) {
+            static const int8_t step[25][2] = {
+                {0, 0}, {1, 0}, {-1, 0}, {0, 1}, {0, -1}, {1, 1}, {1, -1}, {-1, 1}, {-1, -1},
+                {2, 0}, {-2, 0}, {0, 2}, {0, -2}, {2, 1}, {2, -1}, {-2, 1}, {-2, -1},
+                {1, 2}, {-1, 2}, {1, -2}, {-1, -2}, {2, 2}, {2, -2}, {-2, 2}, {-2, -2},
+            };
+            p[3][0] = p3[0] + (step[i][0] * eu[0] + step[i][1] * ev[0]) / 2;
+            p[3][1] = p3[1] + (step[i][0] * eu[1] + step[i][1] * ev[1]) / 2;
+            if (qr_sample(qr, m, p) != 0 || qr_timing_errors(qr) * 2 > s - 16) {
+                continue;
+            }
+            len = qr_decode_grid(qr, version, text, size);
+            if (len >= 0) {
+                return len;
+            }
+        }
+    }
+    return -1;
+}
+
+int qr_scan_decode(uint8_t *luma, int width, int high, char *text, size_t size)
+{
+    if (!luma || !text || size == 0 || width < 21 || high < 21) {
+        return -1;
+    }
+    gf_init();
+    if (qr_binarize(luma, width, high) != 0) {
+        return -1;
+    }
+    qr_code_t *qr = (qr_code_t *)malloc(sizeof(qr_code_t));
+    if (!qr) {
+        return -1;
+    }
+    qr->bin = luma;
+    qr->width = width;
+    qr->high = high;
+    qr_finder_t f[QR_FINDER_MAX];
+    int cnt = qr_find_finders(qr, f);
+    cnt = cnt < QR_TRY_MAX ? cnt : QR_TRY_MAX;
+    int len = -1;
+    // 少于三个定位图案时直接返回，没有二维码的帧只花二值化和逐行扫描的时间
+    for (int i = 0; i < cnt && len < 0; i++) {
+        for (int j = i + 1; j < cnt && len < 0; j++) {
+            for (int k = j + 1; k < cnt && len < 0; k++) {
+                len = qr_try(qr, &f[i], &f[j], &f[k], text, size);
+            }
+        }
+    }
+    free(qr);
+    return len;
+}
+
+static void qr_scan_downscale(const uint8_t *frame)
+{
+    qr_scan_config_t *config = &qr_scan_obj->config;
+    int scale = config->scale;
+    size_t line_size = config->width * (config->format == QR_SCAN_Y ? 1 : 2);
+    uint8_t *dst = qr_scan_obj->luma;
+    for (int y = 0; y < qr_scan_obj->high; y++) {
+        const uint8_t *line = frame + y * scale * line_size;
+        if (config->format == QR_SCAN_Y) {
+            for (int x = 0; x < qr_scan_obj->width; x++) {
+                dst[x] = line[x * scale];
+            }
+        } else if (config->format == QR_SCAN_YUYV) {
+            for (int x = 0; x < qr_scan_obj->width; x++) {
+                dst[x] = line[x * scale * 2];
+            }
+        } else {
+            for (int x = 0; x < qr_scan_obj->width; x++) {
+                const uint8_t *p = line + x * scale * 2;
+                uint32_t r = p[0] & 0xf8;
+                uint32_t g = ((p[0] & 0x07) << 5) | ((p[1] & 0xe0) >> 3);
+                uint32_t b = (p[1] & 0x1f) << 3;
+                dst[x] = (r * 77 + g * 150 + b * 29) >> 8;
+            }
+        }
+        dst += qr_scan_obj->width;
+    }
+}
+
+static void qr_scan_task(void *arg)
+{
+    char *text = (char *)malloc(QR_TEXT_MAX);
+    while (1) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        int64_t start = esp_timer_get_time();
+        int len = text ? qr_scan_decode(qr_scan_obj->luma, qr_scan_obj->width, qr_scan_obj->high, text, QR_TEXT_MAX) : -1;
+        uint32_t decode_ms = (esp_timer_get_time() - start) / 1000;
+        qr_scan_obj->scanned++;
+        if (decode_ms > qr_scan_obj->max_decode_ms) {
+            qr_scan_obj->max_decode_ms = decode_ms;
+        }
+        if (len >= 0) {
+            qr_scan_obj->decoded++;
+            ESP_LOGD(TAG, "decoded in %u ms: %s\n", decode_ms, text);
+            if (qr_scan_obj->config.cb) {
+                qr_scan_obj->config.cb(text, len, qr_scan_obj->config.arg);
+            }
+        }
+        qr_scan_obj->busy = 0;
+    }
+}
+
+int qr_scan_submit(const uint8_t *frame)
+{
+    if (!qr_scan_obj || !frame) {
+        return -1;
+    }
+    if (qr_scan_obj->busy) {
+        return 0;
+    }
+    qr_scan_downscale(frame);
+    qr_scan_obj->busy = 1;
+    xTaskNotifyGive(qr_scan_obj->task);
+    return 1;
+}
+
+void qr_scan_get_stats(uint32_t *scanned, uint32_t *decoded, uint32_t *max_decode_ms)
+{
+    *scanned = qr_scan_obj ? qr_scan_obj->scanned : 0;
+    *decoded = qr_scan_obj ? qr_scan_obj->decoded : 0;
+    *max_decode_ms = qr_scan_obj ? qr_scan_obj->max_decode_ms : 0;
+}
+
+void qr_scan_deinit(void)
+{
+    if (!qr_scan_obj) {
+        return;
+    }
+    // 等待正在进行的解码结束
+    while (qr_scan_obj->busy) {
+        vTaskDelay(10 / portTICK_PERIOD_MS);
+    }
+    if (qr_scan_obj->task) {
+        vTaskDelete(qr_scan_obj->task);
+    }
+    free(qr_scan_obj->luma);
+    free(qr_scan_obj);
+    qr_scan_obj = NULL;
+}
+
+int qr_scan_init(const qr_scan_config_t *config)
+{
+    if (config->format > QR_SCAN_RGB565) {
+        ESP_LOGE(TAG, "format error\n");
+        return -1;
+    }
+    int scale = config->scale ? config->scale : 1;
+    if (config->width / scale < 21 || config->high / scale < 21) {
+        ESP_LOGE(TAG, "frame %dx%d too small\n", config->width, config->high);
+        return -1;
+    }
+    qr_scan_deinit();
+    qr_scan_obj = (qr_scan_obj_t *)calloc(1, sizeof(qr_scan_obj_t));
+    if (!qr_scan_obj) {
+        ESP_LOGE(TAG, "qr scan object malloc error\n");
+        return -1;
+    }
+    qr_scan_obj->config = *config;
+    qr_scan_obj->config.scale = scale;
+    qr_scan_obj->width = config->width / scale;
+    qr_scan_obj->high = config->high / scale;
+    // 二值化和逐行扫描都在这块内存上进行，放在内部 RAM
+    qr_scan_obj->luma = (uint8_t *)malloc(qr_scan_obj->width * qr_scan_obj->high);
+    if (!qr_scan_obj->luma) {
+        ESP_LOGE(TAG, "luma buffer malloc error\n");
+        qr_scan_deinit();
+        return -1;
+    }
+    BaseType_t core = (config->task_core < 0 || config->task_core >= portNUM_PROCESSORS) ? tskNO_AFFINITY : config->task_core;
+    if (xTaskCreatePinnedToCore(qr_scan_task, "qr_scan", 1024 * 4, NULL, config->task_pri, &qr_scan_obj->task, core) != pdPASS) {
+        ESP_LOGE(TAG, "qr scan task create error\n");
+        qr_scan_deinit();
+        return -1;
+    }
+    ESP_LOGI(TAG, "scanning %dx%d\n", qr_scan_obj->width, qr_scan_obj->high);
+    return 0;
+}
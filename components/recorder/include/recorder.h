@@ -0,0 +1,99 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "driver/sdmmc_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Record JPEG frames back to back into one file on a mounted FAT volume (e.g. sd_card_mount("/sdcard")).
+// Frames are copied into one of two write buffers so the caller can give the camera frame back at once,
+// a writer task sends full buffers to the card with large sequential writes and syncs only every sync_ms.
+//
+// With a card instead of a path the frames go to a raw store: a log in a region of sectors no file system uses.
+// There are no cluster allocations or FAT updates in between, every buffer is one multi-sector write at the
+// head of the log, so the write time stays flat near the raw rate of the card. Each recording is a segment,
+// its index goes into the log every sync_ms and a small checkpoint records the head; after a power cut the
+// next start rolls forward from the last checkpoint over the blocks that made it to the card.
+// tools/rawlog.py lists the segments of a card image and extracts them as a data file and its .idx.
+
+#define RECORDER_RAW_SECTOR     512
+#define RECORDER_RAW_CHECKPOINT 0x30434c52 // "RLC0"
+#define RECORDER_RAW_BLOCK      0x30424c52 // "RLB0"
+
+typedef enum {
+    RECORDER_RAW_DATA = 0, // frame bytes, the payloads of a segment back to back are its data stream
+    RECORDER_RAW_INDEX,    // recorder_index_t entries into the data stream of the segment
+} recorder_raw_type_t;
+
+// Raw store layout, little endian, in sectors from raw_start: checkpoints in sectors 0 and 1, written in turn,
+// then the log. A block is whole sectors: recorder_raw_block_t, the payload, and the block seq again in the
+// last 4 bytes, so a block torn by a power cut is told from a complete one.
+typedef struct {
+    uint32_t magic;
+    uint32_t store;      // random id of the format, blocks left from an earlier one do not match
+    uint32_t seq;        // checkpoint number, the valid slot with the higher one is current
+    uint32_t head;       // sector the next block goes to
+    uint32_t next_seq;   // seq of that block
+    uint16_t segment;    // last recording started
+    uint16_t reserved;
+    uint32_t check;      // ~sum of the words above
+} __attribute__((packed)) recorder_raw_checkpoint_t;
+
+typedef struct {
+    uint32_t magic;
+    uint32_t store;
+    uint32_t seq;        // consecutive through the log
+    uint16_t segment;
+    uint8_t type;        // recorder_raw_type_t
+    uint8_t reserved;
+    uint32_t len;        // payload bytes after the header
+    uint32_t sectors;    // block size, the next block follows
+} __attribute__((packed)) recorder_raw_block_t;
+
+typedef struct {
+    uint32_t offset;  // frame start in the data file
+    uint32_t len;
+} recorder_index_t;
+
+typedef struct {
+    const char *path;    // data file, the index (recorder_index_t entries) goes to path + ".idx"
+    size_t file_size;    // bytes allocated up front so writes do not have to grow the FAT chain
+    size_t buffer_size;  // bytes per write, a multiple of the cluster size, 0: 32 KB
+    uint32_t max_frames; // index capacity, 0: 4096
+    uint32_t sync_ms;    // fsync interval, 0: 1000
+    uint8_t task_pri;
+    uint8_t no_index;    // 1: no .idx file, for containers that carry their own index
+    sdmmc_card_t *card;  // raw store instead of path, buffer_size a multiple of RECORDER_RAW_SECTOR
+    uint32_t raw_start;  // card: first sector of the region kept for the store
+    uint32_t raw_sectors; // card: region size, recording stops dropping frames when the log reaches its end
+    uint8_t raw_format;  // card: 1: start the store over, the recordings in it are lost
+} recorder_config_t;
+
+typedef struct {
+    const void *buf;
+    size_t len;
+} recorder_iov_t;
+
+// Copy one frame into the write buffer, returns -1 when both buffers are busy and the frame was dropped
+int recorder_write(const uint8_t *buf, size_t len);
+
+// recorder_write for a frame in several parts, e.g. a chunk header, the data and a pad byte.
+// The parts are stored back to back as one index entry, or dropped together
+int recorder_writev(const recorder_iov_t *iov, int cnt);
+
+uint32_t recorder_get_dropped(void);
+
+// Longest single buffer write to the card so far, in us
+uint32_t recorder_get_write_max_us(void);
+
+int recorder_start(const recorder_config_t *config);
+
+// Write what is buffered, the index, and close both files. Raw store: the index blocks and a checkpoint
+int recorder_stop(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,483 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_system.h"
+#include "sdmmc_cmd.h"
+#include "mem_place.h"
+#include "recorder.h"
+
+static const char *TAG = "recorder";
+
+#define RECORDER_BUFFER_CNT 2
+// Index blocks, checkpoints and the sectors read back at start
+#define RECORDER_RAW_BUF    4096
+#define RECORDER_RAW_TAIL   4      // block seq in the last bytes of a block
+
+typedef struct {
+    uint8_t *buf; // NULL: stop
+    size_t len;
+} recorder_block_t;
+
+typedef struct {
+    char path[64];
+    int fd;
+    int idx_fd;
+    size_t buffer_size;
+    uint8_t *buffer[RECORDER_BUFFER_CNT];
+    uint8_t *cur;             // buffer being filled by recorder_write
+    size_t cur_len;
+    uint32_t data_len;        // bytes accepted so far
+    volatile uint32_t written; // bytes handed to the card by the writer task
+    recorder_index_t *index;
+    uint32_t index_max;
+    volatile uint32_t index_cnt;
+    uint32_t index_synced;
+    uint32_t sync_ms;
+    uint32_t dropped;
+    QueueHandle_t free_queue; // buffers that can be filled
+    QueueHandle_t full_queue; // blocks waiting for the writer task
+    SemaphoreHandle_t done_sem;
+    uint32_t write_max_us;
+    size_t data_off;          // block header in front of the frames of every buffer, 0 for a file
+    size_t fill_size;         // bytes of a buffer the header and frames may fill
+    sdmmc_card_t *card;       // raw store, NULL: file
+    uint32_t raw_start;
+    uint32_t raw_sectors;
+    uint8_t *raw_buf;
+    recorder_raw_checkpoint_t cp; // state of the log, written out at every sync
+    uint32_t cp_head;         // head of the last checkpoint written
+    uint8_t raw_full;
+} recorder_obj_t;
+
+static recorder_obj_t *recorder_obj = NULL;
+
+static uint32_t recorder_raw_check(const recorder_raw_checkpoint_t *cp)
+{
+    uint32_t word[offsetof(recorder_raw_checkpoint_t, check) / 4];
+    uint32_t sum = 0;
+    memcpy(word, cp, sizeof(word));
+    for (int i = 0; i < sizeof(word) / 4; i++) {
+        sum += word[i];
+    }
+    return ~sum;
+}
+
+// Append a block at the head of the log, buf starts with room for the header and holds len bytes with it
+static int recorder_raw_put(uint8_t *buf, size_t len, uint8_t type)
+{
+    recorder_raw_checkpoint_t *cp = &recorder_obj->cp;
+    uint32_t sectors = (len + RECORDER_RAW_TAIL + RECORDER_RAW_SECTOR - 1) / RECORDER_RAW_SECTOR;
+    if (cp->head + sectors > recorder_obj->raw_sectors) {
+        if (!recorder_obj->raw_full) {
+            ESP_LOGE(TAG, "raw store full\n");
+        }
+        recorder_obj->raw_full = 1;
+        return -1;
+    }
+    recorder_raw_block_t *block = (recorder_raw_block_t *)buf;
+    block->magic = RECORDER_RAW_BLOCK;
+    block->store = cp->store;
+    block->seq = cp->next_seq;
+    block->segment = cp->segment;
+    block->type = type;
+    block->reserved = 0;
+    block->len = len - sizeof(recorder_raw_block_t);
+    block->sectors = sectors;
+    memcpy(buf + sectors * RECORDER_RAW_SECTOR - RECORDER_RAW_TAIL, &cp->next_seq, RECORDER_RAW_TAIL);
+    if (sdmmc_write_sectors(recorder_obj->card, buf, recorder_obj->raw_start + cp->head, sectors) != ESP_OK) {
+        ESP_LOGE(TAG, "raw write at sector %u error\n", cp->head);
+        return -1;
+    }
+    cp->head += sectors;
+    cp->next_seq++;
+    return 0;
+}
+
+// Checkpoints alternate between the two slots, a torn one leaves the other
+static void recorder_raw_checkpoint(void)
+{
+    recorder_raw_checkpoint_t *cp = &recorder_obj->cp;
+    cp->seq++;
+    cp->check = recorder_raw_check(cp);
+    memset(recorder_obj->raw_buf, 0xff, RECORDER_RAW_SECTOR);
+    memcpy(recorder_obj->raw_buf, cp, sizeof(recorder_raw_checkpoint_t));
+    if (sdmmc_write_sectors(recorder_obj->card, recorder_obj->raw_buf, recorder_obj->raw_start + (cp->seq & 1), 1) != ESP_OK) {
+        ESP_LOGE(TAG, "checkpoint write error\n");
+        return;
+    }
+    recorder_obj->cp_head = cp->head;
+}
+
+// Index entries from first to cnt into the log as index blocks
+static void recorder_raw_index(uint32_t first, uint32_t cnt)
+{
+    size_t max = (RECORDER_RAW_BUF - sizeof(recorder_raw_block_t) - RECORDER_RAW_TAIL) / sizeof(recorder_index_t);
+    while (first < cnt) {
+        size_t n = cnt - first < max ? cnt - first : max;
+        memcpy(recorder_obj->raw_buf + sizeof(recorder_raw_block_t), &recorder_obj->index[first], n * sizeof(recorder_index_t));
+        if (recorder_raw_put(recorder_obj->raw_buf, sizeof(recorder_raw_block_t) + n * sizeof(recorder_index_t), RECORDER_RAW_INDEX) != 0) {
+            return;
+        }
+        first += n;
+    }
+}
+
+static int recorder_raw_read(uint32_t sector)
+{
+    return sdmmc_read_sectors(recorder_obj->card, recorder_obj->raw_buf, recorder_obj->raw_start + sector, 1) == ESP_OK ? 0 : -1;
+}
+
+// Find the head of the log: the newest valid checkpoint, then every complete block written after it
+static int recorder_raw_open(uint8_t format)
+{
+    recorder_raw_checkpoint_t *cp = &recorder_obj->cp;
+    recorder_raw_checkpoint_t slot;
+    int found = 0;
+    for (int i = 0; i < 2 && !format; i++) {
+        if (recorder_raw_read(i) != 0) {
+            ESP_LOGE(TAG, "raw read error\n");
+            return -1;
+        }
+        memcpy(&slot, recorder_obj->raw_buf, sizeof(slot));
+        if (slot.magic == RECORDER_RAW_CHECKPOINT && slot.check == recorder_raw_check(&slot) && (!found || slot.seq > cp->seq)) {
+            *cp = slot;
+            found = 1;
+        }
+    }
+    if (!found) {
+        memset(cp, 0, sizeof(recorder_raw_checkpoint_t));
+        cp->magic = RECORDER_RAW_CHECKPOINT;
+        cp->store = esp_random();
+        cp->head = 2;
+        ESP_LOGI(TAG, "raw store formatted, %u sectors\n", recorder_obj->raw_sectors);
+    } else {
+        // 检查点之后写完整的块仍然有效，逐块向前恢复
+        uint32_t recovered = 0;
+        recorder_raw_block_t block;
+        uint32_t tail;
+        while (cp->head < recorder_obj->raw_sectors && recorder_raw_read(cp->head) == 0) {
+            memcpy(&block, recorder_obj->raw_buf, sizeof(block));
+            if (block.magic != RECORDER_RAW_BLOCK || block.store != cp->store || block.seq != cp->next_seq ||
+                    block.sectors == 0 || cp->head + block.sectors > recorder_obj->raw_sectors ||
+                    recorder_raw_read(cp->head + block.sectors - 1) != 0) {
+                break;
+            }
+            memcpy(&tail, recorder_obj->raw_buf + RECORDER_RAW_SECTOR - RECORDER_RAW_TAIL, RECORDER_RAW_TAIL);
+            if (tail != block.seq) {
+                break;
+            }
+            cp->head += block.sectors;
+            cp->next_seq++;
+            cp->segment = block.segment;
+            recovered++;
+        }
+        ESP_LOGI(TAG, "raw store: segment %u, %u of %u sectors used, %u blocks recovered\n", cp->segment, cp->head,
+                 recorder_obj->raw_sectors, recovered);
+    }
+    cp->segment++;
+    recorder_raw_checkpoint();
+    return 0;
+}
+
+static void recorder_sync(void)
+{
+    if (!recorder_obj->card) {
+        fsync(recorder_obj->fd);
+    }
+    if (recorder_obj->idx_fd < 0 && !recorder_obj->card) {
+        return;
+    }
+    // 只把数据已经写到卡上的帧加入索引，掉电后索引仍然有效
+    uint32_t cnt = recorder_obj->index_synced;
+    while (cnt < recorder_obj->index_cnt && recorder_obj->index[cnt].offset + recorder_obj->index[cnt].len <= recorder_obj->written) {
+        cnt++;
+    }
+    if (recorder_obj->card) {
+        recorder_raw_index(recorder_obj->index_synced, cnt);
+        recorder_obj->index_synced = cnt;
+        if (recorder_obj->cp.head != recorder_obj->cp_head) {
+            recorder_raw_checkpoint();
+        }
+        return;
+    }
+    if (cnt > recorder_obj->index_synced) {
+        size_t size = (cnt - recorder_obj->index_synced) * sizeof(recorder_index_t);
+        if (write(recorder_obj->idx_fd, &recorder_obj->index[recorder_obj->index_synced], size) != size) {
+            ESP_LOGE(TAG, "index write error\n");
+        }
+        fsync(recorder_obj->idx_fd);
+        recorder_obj->index_synced = cnt;
+    }
+}
+
+static void recorder_task(void *arg)
+{
+    recorder_block_t block;
+    int64_t sync_time = esp_timer_get_time();
+    while (1) {
+        xQueueReceive(recorder_obj->full_queue, (void *)&block, portMAX_DELAY);
+        if (!block.buf) {
+            break;
+        }
+        int64_t start = esp_timer_get_time();
+        mem_place_bw_io(MEM_PLACE_BW_SD, block.buf, block.len);
+        if (recorder_obj->card) {
+            if (recorder_raw_put(block.buf, block.len, RECORDER_RAW_DATA) == 0) {
+                recorder_obj->written += block.len - recorder_obj->data_off;
+            }
+        } else {
+            if (write(recorder_obj->fd, block.buf, block.len) != block.len) {
+                ESP_LOGE(TAG, "data write error\n");
+            }
+            recorder_obj->written += block.len;
+        }
+        uint32_t us = esp_timer_get_time() - start;
+        recorder_obj->write_max_us = us > recorder_obj->write_max_us ? us : recorder_obj->write_max_us;
+        xQueueSend(recorder_obj->free_queue, (void *)&block.buf, portMAX_DELAY);
+        if (esp_timer_get_time() - sync_time >= recorder_obj->sync_ms * 1000LL) {
+            recorder_sync();
+            sync_time = esp_timer_get_time();
+        }
+    }
+    recorder_sync();
+    xSemaphoreGive(recorder_obj->done_sem);
+    vTaskDelete(NULL);
+}
+
+static void recorder_submit(uint8_t *buf, size_t len)
+{
+    recorder_block_t block = {
+        .buf = buf,
+        .len = len,
+    };
+    xQueueSend(recorder_obj->full_queue, (void *)&block, portMAX_DELAY);
+}
+
+// Copy one part into the current buffer, switching to next when it fills up
+static void recorder_copy(const uint8_t *buf, size_t len, uint8_t **next)
+{
+    while (len) {
+        size_t room = recorder_obj->fill_size - recorder_obj->cur_len;
+        size_t n = len < room ? len : room;
+        memcpy(recorder_obj->cur + recorder_obj->cur_len, buf, n);
+        recorder_obj->cur_len += n;
+        buf += n;
+        len -= n;
+        if (recorder_obj->cur_len == recorder_obj->fill_size && *next) {
+            recorder_submit(recorder_obj->cur, recorder_obj->fill_size);
+            recorder_obj->cur = *next;
+            recorder_obj->cur_len = recorder_obj->data_off;
+            *next = NULL;
+        }
+    }
+}
+
+int recorder_writev(const recorder_iov_t *iov, int cnt)
+{
+    size_t len = 0;
+    for (int i = 0; i < cnt; i++) {
+        len += iov[i].len;
+    }
+    if (!recorder_obj || len > recorder_obj->fill_size - recorder_obj->data_off) {
+        return -1;
+    }
+    if (recorder_obj->index_cnt >= recorder_obj->index_max || recorder_obj->raw_full) {
+        recorder_obj->dropped++;
+        return -1;
+    }
+    size_t room = recorder_obj->fill_size - recorder_obj->cur_len;
+    uint8_t *next = NULL;
+    // 帧会填满当前 buffer 时先确认另一个 buffer 已经写完，否则丢弃这一帧而不是等待 SD 卡
+    if (len >= room && xQueueReceive(recorder_obj->free_queue, (void *)&next, 0) != pdTRUE) {
+        recorder_obj->dropped++;
+        return -1;
+    }
+    recorder_obj->index[recorder_obj->index_cnt].offset = recorder_obj->data_len;
+    recorder_obj->index[recorder_obj->index_cnt].len = len;
+    recorder_obj->index_cnt++;
+    recorder_obj->data_len += len;
+
+    for (int i = 0; i < cnt; i++) {
+        recorder_copy((const uint8_t *)iov[i].buf, iov[i].len, &next);
+    }
+    return 0;
+}
+
+int recorder_write(const uint8_t *buf, size_t len)
+{
+    recorder_iov_t iov = {
+        .buf = buf,
+        .len = len,
+    };
+    return recorder_writev(&iov, 1);
+}
+
+uint32_t recorder_get_dropped(void)
+{
+    return recorder_obj ? recorder_obj->dropped : 0;
+}
+
+uint32_t recorder_get_write_max_us(void)
+{
+    return recorder_obj ? recorder_obj->write_max_us : 0;
+}
+
+static void recorder_free(void)
+{
+    if (recorder_obj->fd >= 0) {
+        close(recorder_obj->fd);
+    }
+    if (recorder_obj->idx_fd >= 0) {
+        close(recorder_obj->idx_fd);
+    }
+    for (int i = 0; i < RECORDER_BUFFER_CNT; i++) {
+        mem_place_free(recorder_obj->buffer[i]);
+    }
+    mem_place_free(recorder_obj->index);
+    mem_place_free(recorder_obj->raw_buf);
+    if (recorder_obj->free_queue) {
+        vQueueDelete(recorder_obj->free_queue);
+    }
+    if (recorder_obj->full_queue) {
+        vQueueDelete(recorder_obj->full_queue);
+    }
+    if (recorder_obj->done_sem) {
+        vSemaphoreDelete(recorder_obj->done_sem);
+    }
+    free(recorder_obj);
+    recorder_obj = NULL;
+}
+
+int recorder_stop(void)
+{
+    if (!recorder_obj) {
+        return -1;
+    }
+    if (recorder_obj->cur_len > recorder_obj->data_off) {
+        recorder_submit(recorder_obj->cur, recorder_obj->cur_len);
+    }
+    recorder_submit(NULL, 0);
+    xSemaphoreTake(recorder_obj->done_sem, portMAX_DELAY);
+    uint32_t data_len = recorder_obj->data_len;
+    ESP_LOGI(TAG, "%s: %u frames, %u bytes, dropped: %u, longest write: %u us\n", recorder_obj->path, recorder_obj->index_cnt,
+             data_len, recorder_obj->dropped, recorder_obj->write_max_us);
+    if (recorder_obj->card) {
+        recorder_free();
+        return 0;
+    }
+    close(recorder_obj->fd);
+    recorder_obj->fd = -1;
+    // 去掉预分配但没有用到的部分
+    if (truncate(recorder_obj->path, data_len) != 0) {
+        ESP_LOGW(TAG, "truncate error, the file keeps its preallocated size\n");
+    }
+    recorder_free();
+    return 0;
+}
+
+static int recorder_open_file(const recorder_config_t *config)
+{
+    char idx_path[sizeof(recorder_obj->path)];
+    snprintf(idx_path, sizeof(idx_path), "%s.idx", config->path);
+    recorder_obj->fd = open(config->path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (!config->no_index) {
+        recorder_obj->idx_fd = open(idx_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    }
+    if (recorder_obj->fd < 0 || (!config->no_index && recorder_obj->idx_fd < 0)) {
+        ESP_LOGE(TAG, "open %s error\n", config->path);
+        return -1;
+    }
+    if (config->file_size) {
+        // 一次性分配整个文件的簇链，之后的写入只覆盖已分配的簇，不再更新 FAT
+        size_t size = (config->file_size + recorder_obj->buffer_size - 1) / recorder_obj->buffer_size * recorder_obj->buffer_size;
+        if (lseek(recorder_obj->fd, size - 1, SEEK_SET) != size - 1 || write(recorder_obj->fd, "", 1) != 1) {
+            ESP_LOGW(TAG, "preallocate %u bytes error\n", size);
+        }
+        fsync(recorder_obj->fd);
+        lseek(recorder_obj->fd, 0, SEEK_SET);
+    }
+    return 0;
+}
+
+int recorder_start(const recorder_config_t *config)
+{
+    if (recorder_obj || (!config->card && (!config->path || strlen(config->path) + 5 > sizeof(recorder_obj->path)))) {
+        ESP_LOGE(TAG, "recorder busy or path error\n");
+        return -1;
+    }
+    if (config->card && ((config->buffer_size % RECORDER_RAW_SECTOR) || config->raw_sectors < 3)) {
+        ESP_LOGE(TAG, "raw store buffer size or region error\n");
+        return -1;
+    }
+    recorder_obj = (recorder_obj_t *)calloc(1, sizeof(recorder_obj_t));
+    if (!recorder_obj) {
+        ESP_LOGE(TAG, "recorder object malloc error\n");
+        return -1;
+    }
+    recorder_obj->fd = -1;
+    recorder_obj->idx_fd = -1;
+    recorder_obj->buffer_size = config->buffer_size ? config->buffer_size : 32 * 1024;
+    recorder_obj->index_max = config->max_frames ? config->max_frames : 4096;
+    recorder_obj->sync_ms = config->sync_ms ? config->sync_ms : 1000;
+    recorder_obj->fill_size = recorder_obj->buffer_size;
+    if (config->card) {
+        // 每个 buffer 就是日志中的一个块，前面留出块头，最后留出块序号
+        recorder_obj->card = config->card;
+        recorder_obj->raw_start = config->raw_start;
+        recorder_obj->raw_sectors = config->raw_sectors;
+        recorder_obj->data_off = sizeof(recorder_raw_block_t);
+        recorder_obj->fill_size = recorder_obj->buffer_size - RECORDER_RAW_TAIL;
+        strcpy(recorder_obj->path, "raw");
+    } else {
+        strcpy(recorder_obj->path, config->path);
+    }
+
+    recorder_obj->free_queue = xQueueCreate(RECORDER_BUFFER_CNT, sizeof(uint8_t *));
+    recorder_obj->full_queue = xQueueCreate(RECORDER_BUFFER_CNT + 1, sizeof(recorder_block_t));
+    recorder_obj->done_sem = xSemaphoreCreateBinary();
+    recorder_obj->index = (recorder_index_t *)mem_place_alloc("rec_index", MEM_PLACE_BULK, recorder_obj->index_max * sizeof(recorder_index_t));
+    if (!recorder_obj->free_queue || !recorder_obj->full_queue || !recorder_obj->done_sem || !recorder_obj->index) {
+        ESP_LOGE(TAG, "recorder malloc error\n");
+        recorder_free();
+        return -1;
+    }
+    for (int i = 0; i < RECORDER_BUFFER_CNT; i++) {
+        // 内部 DMA buffer 可以让 SDMMC 驱动直接多块写入，放不下时驱动经自己的 buffer 逐块写
+        recorder_obj->buffer[i] = (uint8_t *)mem_place_alloc("rec_buffer", MEM_PLACE_IO, recorder_obj->buffer_size);
+        if (!recorder_obj->buffer[i]) {
+            ESP_LOGE(TAG, "write buffer malloc error\n");
+            recorder_free();
+            return -1;
+        }
+    }
+    recorder_obj->cur = recorder_obj->buffer[0];
+    recorder_obj->cur_len = recorder_obj->data_off;
+    xQueueSend(recorder_obj->free_queue, (void *)&recorder_obj->buffer[1], 0);
+
+    if (config->card) {
+        recorder_obj->raw_buf = (uint8_t *)mem_place_alloc("rec_raw", MEM_PLACE_DMA, RECORDER_RAW_BUF);
+        if (!recorder_obj->raw_buf || recorder_raw_open(config->raw_format) != 0) {
+            ESP_LOGE(TAG, "raw store open error\n");
+            recorder_free();
+            return -1;
+        }
+    } else if (recorder_open_file(config) != 0) {
+        recorder_free();
+        return -1;
+    }
+    if (xTaskCreate(recorder_task, "recorder_task", 1024 * 3, NULL, config->task_pri, NULL) != pdPASS) {
+        ESP_LOGE(TAG, "recorder task create error\n");
+        recorder_free();
+        return -1;
+    }
+    ESP_LOGI(TAG, "recording to %s, buffer: 2x%u\n", recorder_obj->path, recorder_obj->buffer_size);
+    return 0;
+}
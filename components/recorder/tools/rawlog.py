@@ -0,0 +1,93 @@
+# -*- coding:utf-8 -*-
+#
+# List and extract the recordings of a recorder raw store, see include/recorder.h for the layout.
+#
+#   dd if=/dev/sdX of=card.img bs=512 skip=<raw_start> count=<raw_sectors>
+#   python rawlog.py card.img                   # list the segments
+#   python rawlog.py card.img 3 rec3.mjpeg      # segment 3 as a data file and rec3.mjpeg.idx
+#
+# --start takes the region from an image of the whole card instead. The log is read as the recorder reads it at
+# start: from the newest checkpoint over every complete block, so a recording cut by a power loss comes out up
+# to its last block. Its index ends at the last sync, frames written after that are in the data file only.
+from __future__ import print_function
+import argparse
+import struct
+import sys
+
+SECTOR = 512
+CHECKPOINT = struct.Struct('<IIIIIHHI')
+BLOCK = struct.Struct('<IIIHBBII')
+MAGIC_CHECKPOINT = 0x30434c52  # "RLC0"
+MAGIC_BLOCK = 0x30424c52  # "RLB0"
+TYPE_DATA = 0
+TYPE_INDEX = 1
+
+
+def checkpoint(img, start, slot):
+    raw = img[(start + slot) * SECTOR:(start + slot) * SECTOR + CHECKPOINT.size]
+    if len(raw) < CHECKPOINT.size:
+        return None
+    cp = CHECKPOINT.unpack(raw)
+    words = struct.unpack('<6I', raw[:24])
+    if cp[0] != MAGIC_CHECKPOINT or cp[7] != (~sum(words)) & 0xFFFFFFFF:
+        return None
+    return cp
+
+
+def blocks(img, start):
+    """Complete blocks of the log in order: (segment, type, payload)."""
+    cps = [cp for cp in (checkpoint(img, start, 0), checkpoint(img, start, 1)) if cp]
+    if not cps:
+        raise ValueError('no valid checkpoint, not a raw store')
+    store = max(cps, key=lambda cp: cp[2])[1]
+    head = 2
+    seq = 0
+    end = len(img) // SECTOR - start
+    while head < end:
+        pos = (start + head) * SECTOR
+        magic, bstore, bseq, segment, btype, _, length, sectors = BLOCK.unpack(img[pos:pos + BLOCK.size])
+        if magic != MAGIC_BLOCK or bstore != store or bseq != seq or sectors == 0 or head + sectors > end:
+            break
+        tail = struct.unpack('<I', img[pos + sectors * SECTOR - 4:pos + sectors * SECTOR])[0]
+        if tail != seq or BLOCK.size + length > sectors * SECTOR - 4:
+            break
+        yield segment, btype, img[pos + BLOCK.size:pos + BLOCK.size + length]
+        head += sectors
+        seq += 1
+
+
+def segments(img, start):
+    segs = {}
+    for segment, btype, payload in blocks(img, start):
+        seg = segs.setdefault(segment, {'data': bytearray(), 'index': bytearray()})
+        seg['data' if btype == TYPE_DATA else 'index'] += payload
+    return segs
+
+
+def main():
+    parser = argparse.ArgumentParser(description='recorder raw store tool')
+    parser.add_argument('image', help='image of the store region, or of the card with --start')
+    parser.add_argument('segment', nargs='?', type=int, help='segment to extract')
+    parser.add_argument('output', nargs='?', help='data file, the index goes to output + ".idx"')
+    parser.add_argument('--start', type=lambda s: int(s, 0), default=0, help='first sector of the store in the image')
+    args = parser.parse_args()
+
+    img = open(args.image, 'rb').read()
+    try:
+        segs = segments(img, args.start)
+    except ValueError as e:
+        sys.exit('%s: %s' % (args.image, e))
+    if args.segment is None:
+        for n in sorted(segs):
+            print('segment %u: %u bytes, %u frames indexed' % (n, len(segs[n]['data']), len(segs[n]['index']) // 8))
+        return
+    if args.segment not in segs or not args.output:
+        sys.exit('segment %d not found or no output given' % args.segment)
+    seg = segs[args.segment]
+    open(args.output, 'wb').write(seg['data'])
+    open(args.output + '.idx', 'wb').write(seg['index'])
+    print('%s: %u bytes, %u frames' % (args.output, len(seg['data']), len(seg['index']) // 8))
+
+
+if __name__ == '__main__':
+    main()
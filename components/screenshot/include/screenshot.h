@@ -0,0 +1,52 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// On demand JPEG snapshots for field diagnostics: GET http://<ip>:<port>/lcd.jpg returns the frame the LCD is
+// showing, /cam.jpg a camera frame. A request only raises a flag, the frame owner hands its next frame over by
+// reference with screenshot_submit (a flag test when nothing is asked for) and goes on with the other buffers,
+// the snapshot task encodes it with jpeg_enc at its own low priority, gives the frame back through release and
+// only then sends the JPEG. One snapshot at a time, at most one per min_interval_ms, frames are never copied.
+// jpeg_enc is set up and torn down around each snapshot, nothing else may use it meanwhile.
+
+typedef enum {
+    SCREENSHOT_LCD = 0,  // the frame being sent to the LCD
+    SCREENSHOT_CAM,      // a camera frame, for pipelines whose LCD shows something else
+    SCREENSHOT_SOURCE_MAX,
+} screenshot_source_t;
+
+// Called from the snapshot task once the frame is encoded, the owner may reuse it from then on
+typedef void (*screenshot_release_t)(const uint8_t *frame, void *arg);
+
+typedef struct {
+    uint16_t port;              // HTTP port, 0: 8080
+    uint8_t task_pri;           // below every real-time task, the encode runs here
+    int8_t task_core;           // -1: no affinity, single core chips ignore it
+    uint8_t quality;            // 1~100, 0: 80
+    uint8_t scale;              // 2/4: downscaled snapshots, less CPU and a shorter hold, 0/1: full size
+    uint32_t jpeg_size;         // JPEG buffer bytes, PSRAM when there is some, 0: width * high / 2 of the largest source
+    uint32_t wait_ms;           // how long a request waits for a frame, 0: 2000
+    uint32_t min_interval_ms;   // requests sooner than this after the last snapshot get 503, 0: 1000
+    struct {
+        uint16_t width;         // RGB565 frames in LCD byte order, 0: source not served
+        uint16_t high;
+    } size[SCREENSHOT_SOURCE_MAX];
+} screenshot_config_t;
+
+// Offer a frame of source. 1: a request was waiting, the frame is held and passed to release when encoded,
+// 0: nothing asked for or a snapshot is in progress, the caller keeps the frame, -1: error
+int screenshot_submit(uint8_t source, const uint8_t *frame, screenshot_release_t release, void *arg);
+
+// Snapshots served, requests that got no frame within wait_ms or came too soon, and the slowest encode in ms
+void screenshot_get_stats(uint32_t *served, uint32_t *missed, uint32_t *max_encode_ms);
+
+int screenshot_init(const screenshot_config_t *config);
+
+#ifdef __cplusplus
+}
+#endif
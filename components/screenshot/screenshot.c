@@ -0,0 +1,270 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "lwip/sockets.h"
+#include "jpeg_enc.h"
+#include "mem_place.h"
+#include "screenshot.h"
+
+static const char *TAG = "screenshot";
+
+static const char *screenshot_path[SCREENSHOT_SOURCE_MAX] = {"/lcd.jpg", "/cam.jpg"};
+
+static const char *screenshot_header = "HTTP/1.1 200 OK\r\n"
+                                       "Content-Type: image/jpeg\r\n"
+                                       "Content-Length: %u\r\n"
+                                       "Cache-Control: no-cache\r\n"
+                                       "Connection: close\r\n\r\n";
+
+static const char *screenshot_error = "HTTP/1.1 %s\r\n"
+                                      "Content-Type: text/plain\r\n"
+                                      "Connection: close\r\n\r\n"
+                                      "%s\n";
+
+typedef struct {
+    screenshot_config_t config;
+    TaskHandle_t task;
+    volatile int pending;           // source a request waits for, -1: none
+    const uint8_t *frame;           // frame handed over by screenshot_submit
+    screenshot_release_t release;
+    void *release_arg;
+    uint8_t *jpeg;
+    size_t jpeg_len;
+    int64_t last_time;
+    uint32_t served;
+    uint32_t missed;
+    uint32_t max_encode_ms;
+} screenshot_obj_t;
+
+static screenshot_obj_t *screenshot_obj = NULL;
+
+static portMUX_TYPE screenshot_lock = portMUX_INITIALIZER_UNLOCKED; // frame owner against the snapshot task
+
+static int screenshot_send_all(int fd, const uint8_t *data, size_t len)
+{
+    while (len > 0) {
+        int ret = send(fd, data, len, 0);
+        if (ret <= 0) {
+            return -1;
+        }
+        data += ret;
+        len -= ret;
+    }
+    return 0;
+}
+
+static void screenshot_send_error(int fd, const char *status, const char *text)
+{
+    char buf[192];
+    int len = snprintf(buf, sizeof(buf), screenshot_error, status, text);
+    screenshot_send_all(fd, (const uint8_t *)buf, len);
+}
+
+static int screenshot_jpeg_write(const uint8_t *data, size_t len, void *arg)
+{
+    if (screenshot_obj->jpeg_len + len > screenshot_obj->config.jpeg_size) {
+        return -1;
+    }
+    memcpy(screenshot_obj->jpeg + screenshot_obj->jpeg_len, data, len);
+    screenshot_obj->jpeg_len += len;
+    return 0;
+}
+
+// Wait for the frame owner to hand over a frame of source, NULL when none came within wait_ms
+static const uint8_t *screenshot_wait_frame(int source)
+{
+    ulTaskNotifyTake(pdTRUE, 0); // a hand over that raced the last timeout
+    portENTER_CRITICAL(&screenshot_lock);
+    screenshot_obj->frame = NULL;
+    screenshot_obj->pending = source;
+    portEXIT_CRITICAL(&screenshot_lock);
+    ulTaskNotifyTake(pdTRUE, screenshot_obj->config.wait_ms / portTICK_PERIOD_MS);
+    portENTER_CRITICAL(&screenshot_lock);
+    const uint8_t *frame = screenshot_obj->frame;
+    screenshot_obj->pending = -1;
+    portEXIT_CRITICAL(&screenshot_lock);
+    return frame;
+}
+
+// Encode a frame of source into the JPEG buffer, the frame goes back to its owner before anything is sent
+static int screenshot_encode(int source)
+{
+    jpeg_enc_config_t jpeg_config = {
+        .width = screenshot_obj->config.size[source].width,
+        .high = screenshot_obj->config.size[source].high,
+        .quality = screenshot_obj->config.quality,
+        .scale = screenshot_obj->config.scale,
+        .write = screenshot_jpeg_write,
+    };
+    // 先申请编码器内存，失败时不占用帧
+    if (jpeg_enc_init(&jpeg_config) != 0) {
+        return -1;
+    }
+    const uint8_t *frame = screenshot_wait_frame(source);
+    if (!frame) {
+        jpeg_enc_deinit();
+        return -2;
+    }
+    int64_t start = esp_timer_get_time();
+    screenshot_obj->jpeg_len = 0;
+    int ret = jpeg_enc_frame(frame);
+    uint32_t encode_ms = (esp_timer_get_time() - start) / 1000;
+    screenshot_obj->release(frame, screenshot_obj->release_arg);
+    jpeg_enc_deinit();
+    if (encode_ms > screenshot_obj->max_encode_ms) {
+        screenshot_obj->max_encode_ms = encode_ms;
+    }
+    if (ret < 0) {
+        ESP_LOGE(TAG, "jpeg larger than %u bytes\n", screenshot_obj->config.jpeg_size);
+        return -1;
+    }
+    return ret;
+}
+
+static void screenshot_client(int fd)
+{
+    char req[128];
+    struct timeval timeout = {.tv_sec = 2, .tv_usec = 0};
+    setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    // Only the request line matters: "GET /lcd.jpg HTTP/1.1"
+    int len = recv(fd, req, sizeof(req) - 1, 0);
+    if (len <= 0) {
+        return;
+    }
+    req[len] = '\0';
+    int source = -1;
+    for (int i = 0; i < SCREENSHOT_SOURCE_MAX; i++) {
+        size_t n = strlen(screenshot_path[i]);
+        if (screenshot_obj->config.size[i].width && !strncmp(req, "GET ", 4) && !strncmp(req + 4, screenshot_path[i], n) &&
+            (req[4 + n] == ' ' || req[4 + n] == '?')) {
+            source = i;
+        }
+    }
+    if (source < 0) {
+        screenshot_send_error(fd, "404 Not Found", "GET /lcd.jpg or /cam.jpg");
+        return;
+    }
+    if (screenshot_obj->last_time &&
+        esp_timer_get_time() - screenshot_obj->last_time < (int64_t)screenshot_obj->config.min_interval_ms * 1000) {
+        screenshot_obj->missed++;
+        screenshot_send_error(fd, "503 Service Unavailable", "too soon after the last snapshot");
+        return;
+    }
+    int ret = screenshot_encode(source);
+    screenshot_obj->last_time = esp_timer_get_time();
+    if (ret == -2) {
+        screenshot_obj->missed++;
+        screenshot_send_error(fd, "503 Service Unavailable", "no frame");
+        return;
+    }
+    if (ret < 0) {
+        screenshot_send_error(fd, "500 Internal Server Error", "encode error");
+        return;
+    }
+    len = snprintf(req, sizeof(req), screenshot_header, ret);
+    if (screenshot_send_all(fd, (const uint8_t *)req, len) == 0 &&
+        screenshot_send_all(fd, screenshot_obj->jpeg, screenshot_obj->jpeg_len) == 0) {
+        screenshot_obj->served++;
+        ESP_LOGI(TAG, "%s: %d bytes\n", screenshot_path[source], ret);
+    }
+}
+
+static void screenshot_task(void *arg)
+{
+    struct sockaddr_in addr = {
+        .sin_family = AF_INET,
+        .sin_port = htons(screenshot_obj->config.port),
+        .sin_addr.s_addr = htonl(INADDR_ANY),
+    };
+    int listen_fd = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (listen_fd < 0 || bind(listen_fd, (struct sockaddr *)&addr, sizeof(addr)) != 0 || listen(listen_fd, 1) != 0) {
+        ESP_LOGE(TAG, "socket setup error\n");
+        vTaskDelete(NULL);
+        return;
+    }
+    ESP_LOGI(TAG, "listening on port %d\n", screenshot_obj->config.port);
+
+    while (1) {
+        int fd = accept(listen_fd, NULL, NULL);
+        if (fd < 0) {
+            continue;
+        }
+        screenshot_client(fd);
+        close(fd);
+    }
+}
+
+int screenshot_submit(uint8_t source, const uint8_t *frame, screenshot_release_t release, void *arg)
+{
+    if (!screenshot_obj || !frame || !release || source >= SCREENSHOT_SOURCE_MAX) {
+        return -1;
+    }
+    if (screenshot_obj->pending != source) {
+        return 0;
+    }
+    portENTER_CRITICAL(&screenshot_lock);
+    int take = screenshot_obj->pending == source && !screenshot_obj->frame;
+    if (take) {
+        screenshot_obj->frame = frame;
+        screenshot_obj->release = release;
+        screenshot_obj->release_arg = arg;
+        screenshot_obj->pending = -1;
+    }
+    portEXIT_CRITICAL(&screenshot_lock);
+    if (take) {
+        xTaskNotifyGive(screenshot_obj->task);
+    }
+    return take;
+}
+
+void screenshot_get_stats(uint32_t *served, uint32_t *missed, uint32_t *max_encode_ms)
+{
+    *served = screenshot_obj ? screenshot_obj->served : 0;
+    *missed = screenshot_obj ? screenshot_obj->missed : 0;
+    *max_encode_ms = screenshot_obj ? screenshot_obj->max_encode_ms : 0;
+}
+
+int screenshot_init(const screenshot_config_t *config)
+{
+    uint32_t max_pixels = 0;
+    for (int i = 0; i < SCREENSHOT_SOURCE_MAX; i++) {
+        uint32_t pixels = config->size[i].width * config->size[i].high;
+        max_pixels = pixels > max_pixels ? pixels : max_pixels;
+    }
+    if (max_pixels == 0 || config->quality > 100) {
+        ESP_LOGE(TAG, "screenshot config error\n");
+        return -1;
+    }
+    screenshot_obj = (screenshot_obj_t *)calloc(1, sizeof(screenshot_obj_t));
+    if (!screenshot_obj) {
+        ESP_LOGE(TAG, "screenshot object malloc error\n");
+        return -1;
+    }
+    screenshot_obj->config = *config;
+    screenshot_obj->config.port = config->port ? config->port : 8080;
+    screenshot_obj->config.jpeg_size = config->jpeg_size ? config->jpeg_size : max_pixels / 2;
+    screenshot_obj->config.wait_ms = config->wait_ms ? config->wait_ms : 2000;
+    screenshot_obj->config.min_interval_ms = config->min_interval_ms ? config->min_interval_ms : 1000;
+    screenshot_obj->pending = -1;
+    screenshot_obj->jpeg = (uint8_t *)mem_place_alloc("screenshot_jpeg", MEM_PLACE_BULK, screenshot_obj->config.jpeg_size);
+    if (!screenshot_obj->jpeg) {
+        ESP_LOGE(TAG, "jpeg buffer malloc error\n");
+        free(screenshot_obj);
+        screenshot_obj = NULL;
+        return -1;
+    }
+    BaseType_t core = (config->task_core < 0 || config->task_core >= portNUM_PROCESSORS) ? tskNO_AFFINITY : config->task_core;
+    if (xTaskCreatePinnedToCore(screenshot_task, "screenshot", 1024 * 4, NULL, config->task_pri, &screenshot_obj->task, core) != pdPASS) {
+        ESP_LOGE(TAG, "screenshot task create error\n");
+        mem_place_free(screenshot_obj->jpeg);
+        free(screenshot_obj);
+        screenshot_obj = NULL;
+        return -1;
+    }
+    return 0;
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// System monitor: a low priority task that every period samples the FreeRTOS run time counters and stack
+// high water marks of all tasks, then logs the load of each core, the busiest tasks and the smallest stack
+// margins. Needs CONFIG_FREERTOS_USE_TRACE_FACILITY and CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS.
+// With stall_probe_us an IRAM timer ISR also samples whether the flash cache is disabled, the report then
+// shows how often and how long code running from flash (anything not in IRAM) was stalled by flash writes.
+
+typedef struct {
+    uint32_t period_ms;     // sampling period, 0: 5000
+    uint8_t top;            // busiest tasks listed, 0: 5
+    uint16_t stack_warn;    // warn about tasks with fewer free stack bytes than this, 0: 256
+    uint16_t stall_probe_us; // flash cache sampling period on TIMER_GROUP_1 timer 1, 0: off
+} sysmon_config_t;
+
+int sysmon_init(const sysmon_config_t *config);
+
+#ifdef __cplusplus
+}
+#endif
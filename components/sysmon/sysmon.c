@@ -0,0 +1,262 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_spi_flash.h"
+#include "driver/timer.h"
+#include "sysmon.h"
+
+static const char *TAG = "sysmon";
+
+#if configUSE_TRACE_FACILITY && configGENERATE_RUN_TIME_STATS
+
+#define SYSMON_TASK_SLACK 4 // spare entries so a few new tasks do not need a realloc
+
+typedef struct {
+    TaskHandle_t handle;
+    uint32_t run_time;
+} sysmon_prev_t;
+
+typedef struct {
+    TickType_t period;
+    uint8_t top;
+    uint16_t stack_warn;
+    UBaseType_t cap;
+    TaskStatus_t *status;
+    uint32_t *delta;        // run time of each status entry since the last sample
+    sysmon_prev_t *prev;
+    UBaseType_t prev_num;
+    uint32_t prev_total;
+} sysmon_obj_t;
+
+static sysmon_obj_t *sysmon_obj = NULL;
+
+#define SYSMON_PROBE_GROUP TIMER_GROUP_1
+#define SYSMON_PROBE_TIMER TIMER_1
+
+typedef struct {
+    uint32_t samples;
+    uint32_t off;           // samples that found the cache disabled
+    uint32_t windows;       // times it was found disabled after being enabled
+    uint32_t run;           // current disabled run, in samples
+    uint32_t run_max;
+} sysmon_probe_t;
+
+static DRAM_ATTR sysmon_probe_t sysmon_probe;
+static portMUX_TYPE sysmon_probe_lock = portMUX_INITIALIZER_UNLOCKED;
+static uint32_t sysmon_probe_us;
+
+// IRAM code and DRAM data only, it runs while the cache is off, which is what it looks for
+static void IRAM_ATTR sysmon_probe_isr(void *arg)
+{
+    timer_group_clr_intr_status_in_isr(SYSMON_PROBE_GROUP, SYSMON_PROBE_TIMER);
+    timer_group_enable_alarm_in_isr(SYSMON_PROBE_GROUP, SYSMON_PROBE_TIMER);
+    portENTER_CRITICAL_ISR(&sysmon_probe_lock);
+    sysmon_probe.samples++;
+    if (!spi_flash_cache_enabled()) {
+        sysmon_probe.off++;
+        if (sysmon_probe.run++ == 0) {
+            sysmon_probe.windows++;
+        }
+        if (sysmon_probe.run > sysmon_probe.run_max) {
+            sysmon_probe.run_max = sysmon_probe.run;
+        }
+    } else {
+        sysmon_probe.run = 0;
+    }
+    portEXIT_CRITICAL_ISR(&sysmon_probe_lock);
+}
+
+static int sysmon_probe_start(uint32_t period_us)
+{
+    timer_config_t config = {
+        .alarm_en = TIMER_ALARM_EN,
+        .counter_en = TIMER_PAUSE,
+        .intr_type = TIMER_INTR_LEVEL,
+        .counter_dir = TIMER_COUNT_UP,
+        .auto_reload = TIMER_AUTORELOAD_EN,
+        .divider = 80, // 1 MHz from the 80 MHz APB
+    };
+    if (timer_init(SYSMON_PROBE_GROUP, SYSMON_PROBE_TIMER, &config) != ESP_OK) {
+        return -1;
+    }
+    timer_set_counter_value(SYSMON_PROBE_GROUP, SYSMON_PROBE_TIMER, 0);
+    timer_set_alarm_value(SYSMON_PROBE_GROUP, SYSMON_PROBE_TIMER, period_us);
+    timer_enable_intr(SYSMON_PROBE_GROUP, SYSMON_PROBE_TIMER);
+    if (timer_isr_register(SYSMON_PROBE_GROUP, SYSMON_PROBE_TIMER, sysmon_probe_isr, NULL, ESP_INTR_FLAG_IRAM, NULL) != ESP_OK) {
+        return -1;
+    }
+    sysmon_probe_us = period_us;
+    return timer_start(SYSMON_PROBE_GROUP, SYSMON_PROBE_TIMER) == ESP_OK ? 0 : -1;
+}
+
+static void sysmon_probe_report(void)
+{
+    if (!sysmon_probe_us) {
+        return;
+    }
+    portENTER_CRITICAL(&sysmon_probe_lock);
+    sysmon_probe_t probe = sysmon_probe;
+    sysmon_probe.samples = 0;
+    sysmon_probe.off = 0;
+    sysmon_probe.windows = 0;
+    sysmon_probe.run_max = sysmon_probe.run;
+    portEXIT_CRITICAL(&sysmon_probe_lock);
+    // resolution is one probe period, windows shorter than that are seen only some of the time
+    ESP_LOGI(TAG, "flash stall: %u windows, %u us, longest %u us", probe.windows,
+             probe.off * sysmon_probe_us, probe.run_max * sysmon_probe_us);
+}
+
+static int sysmon_reserve(UBaseType_t num)
+{
+    if (num <= sysmon_obj->cap) {
+        return 0;
+    }
+    UBaseType_t cap = num + SYSMON_TASK_SLACK;
+    TaskStatus_t *status = realloc(sysmon_obj->status, cap * sizeof(TaskStatus_t));
+    if (status) {
+        sysmon_obj->status = status;
+    }
+    uint32_t *delta = realloc(sysmon_obj->delta, cap * sizeof(uint32_t));
+    if (delta) {
+        sysmon_obj->delta = delta;
+    }
+    sysmon_prev_t *prev = realloc(sysmon_obj->prev, cap * sizeof(sysmon_prev_t));
+    if (prev) {
+        sysmon_obj->prev = prev;
+    }
+    if (!status || !delta || !prev) {
+        return -1;
+    }
+    sysmon_obj->cap = cap;
+    return 0;
+}
+
+// Run time of a task in the previous sample, a task created since then ran all of it in this window
+static uint32_t sysmon_prev_run_time(TaskHandle_t handle)
+{
+    for (int i = 0; i < sysmon_obj->prev_num; i++) {
+        if (sysmon_obj->prev[i].handle == handle) {
+            return sysmon_obj->prev[i].run_time;
+        }
+    }
+    return 0;
+}
+
+static void sysmon_report(UBaseType_t num, uint32_t elapsed)
+{
+    TaskStatus_t *status = sysmon_obj->status;
+    uint32_t *delta = sysmon_obj->delta;
+
+    // the run time counter advances on every core at once, what the idle task did not take was load
+    for (int core = 0; core < portNUM_PROCESSORS; core++) {
+        TaskHandle_t idle = xTaskGetIdleTaskHandleForCPU(core);
+        uint32_t idle_time = 0;
+        for (int i = 0; i < num; i++) {
+            if (status[i].xHandle == idle) {
+                idle_time = delta[i];
+                break;
+            }
+        }
+        uint32_t load = idle_time < elapsed ? (uint32_t)((uint64_t)(elapsed - idle_time) * 1000 / elapsed) : 0;
+        ESP_LOGI(TAG, "core %d load: %u.%u%%", core, load / 10, load % 10);
+    }
+
+    // selection sort of the busiest few, the list is short and this runs once a period
+    int top = sysmon_obj->top < num ? sysmon_obj->top : num;
+    for (int n = 0; n < top; n++) {
+        int max = n;
+        for (int i = n + 1; i < num; i++) {
+            if (delta[i] > delta[max]) {
+                max = i;
+            }
+        }
+        if (max != n) {
+            TaskStatus_t s = status[n];
+            status[n] = status[max];
+            status[max] = s;
+            uint32_t d = delta[n];
+            delta[n] = delta[max];
+            delta[max] = d;
+        }
+        uint32_t load = (uint32_t)((uint64_t)delta[n] * 1000 / elapsed);
+        ESP_LOGI(TAG, "%-16s cpu: %3u.%u%%, prio: %2u, stack free: %u", status[n].pcTaskName,
+                 load / 10, load % 10, status[n].uxCurrentPriority, status[n].usStackHighWaterMark);
+    }
+
+    // usStackHighWaterMark is in bytes here, StackType_t is uint8_t on Xtensa
+    for (int i = 0; i < num; i++) {
+        if (status[i].usStackHighWaterMark < sysmon_obj->stack_warn) {
+            ESP_LOGW(TAG, "%s stack free: %u", status[i].pcTaskName, status[i].usStackHighWaterMark);
+        }
+    }
+    sysmon_probe_report();
+}
+
+static void sysmon_task(void *arg)
+{
+    TickType_t wake = xTaskGetTickCount();
+    while (1) {
+        vTaskDelayUntil(&wake, sysmon_obj->period);
+        if (sysmon_reserve(uxTaskGetNumberOfTasks()) != 0) {
+            ESP_LOGE(TAG, "task list malloc error\n");
+            continue;
+        }
+        uint32_t total = 0;
+        UBaseType_t num = uxTaskGetSystemState(sysmon_obj->status, sysmon_obj->cap, &total);
+        if (num == 0) {
+            continue;
+        }
+        for (int i = 0; i < num; i++) {
+            sysmon_obj->delta[i] = sysmon_obj->status[i].ulRunTimeCounter - sysmon_prev_run_time(sysmon_obj->status[i].xHandle);
+        }
+        uint32_t elapsed = total - sysmon_obj->prev_total;
+        // the first sample only sets the base
+        if (sysmon_obj->prev_total != 0 && elapsed > 0) {
+            sysmon_report(num, elapsed);
+        }
+        // sysmon_report may have reordered the list, the handles still pair with their counters
+        for (int i = 0; i < num; i++) {
+            sysmon_obj->prev[i].handle = sysmon_obj->status[i].xHandle;
+            sysmon_obj->prev[i].run_time = sysmon_obj->status[i].ulRunTimeCounter;
+        }
+        sysmon_obj->prev_num = num;
+        sysmon_obj->prev_total = total;
+    }
+    vTaskDelete(NULL);
+}
+
+int sysmon_init(const sysmon_config_t *config)
+{
+    sysmon_obj = (sysmon_obj_t *)calloc(1, sizeof(sysmon_obj_t));
+    if (!sysmon_obj) {
+        ESP_LOGE(TAG, "sysmon object malloc error\n");
+        return -1;
+    }
+    sysmon_obj->period = pdMS_TO_TICKS(config->period_ms ? config->period_ms : 5000);
+    sysmon_obj->top = config->top ? config->top : 5;
+    sysmon_obj->stack_warn = config->stack_warn ? config->stack_warn : 256;
+    if (config->stall_probe_us && sysmon_probe_start(config->stall_probe_us) != 0) {
+        ESP_LOGE(TAG, "stall probe timer error\n");
+    }
+    // lowest priority above idle, sampling never delays the real work
+    if (xTaskCreate(sysmon_task, "sysmon", 2560, NULL, 1, NULL) != pdPASS) {
+        ESP_LOGE(TAG, "sysmon task create error\n");
+        free(sysmon_obj);
+        sysmon_obj = NULL;
+        return -1;
+    }
+    return 0;
+}
+
+#else
+
+int sysmon_init(const sysmon_config_t *config)
+{
+    ESP_LOGE(TAG, "enable FREERTOS_USE_TRACE_FACILITY and FREERTOS_GENERATE_RUN_TIME_STATS\n");
+    return -1;
+}
+
+#endif
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <stdint.h>
+#include "cam.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Periodic single shots with everything down in between. After each shot capture stops, which drops the cam APB
+// lock, the OV2640 goes to standby and XCLK is gated; the task then waits for the next period, so with
+// power_init(.light_sleep = 1) the SoC light-sleeps. To wake, XCLK comes back and the standby bit is cleared, the
+// sensor keeps its registers so nothing else is written. warmup frames let exposure settle, the next one is handed to
+// cb. Set up the camera in JPEG mode (mode.jpeg, OV2640_JPEG_Mode) before timelapse_start and leave it stopped.
+
+// frame is valid during the call only
+typedef void (*timelapse_cb_t)(const cam_frame_t *frame, void *arg);
+
+typedef struct {
+    uint32_t period_ms;     // shot to shot
+    uint8_t warmup;         // frames dropped after waking, 0: 2
+    uint32_t timeout_ms;    // for the frames of one shot, 0: 2000
+    uint8_t task_pri;
+    timelapse_cb_t cb;
+    void *arg;
+} timelapse_config_t;
+
+int timelapse_start(const timelapse_config_t *config);
+
+// Ends after the shot in progress, the camera is left stopped and the sensor in standby
+void timelapse_stop(void);
+
+// Shots taken, shots that timed out and the longest wake to frame time in us
+void timelapse_get_stats(uint32_t *shots, uint32_t *failed, uint32_t *wake_max_us);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,152 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "cam.h"
+#include "ov2640.h"
+#include "timelapse.h"
+
+static const char *TAG = "timelapse";
+
+typedef struct {
+    timelapse_config_t config;
+    cam_sub_t *sub;
+    TaskHandle_t task;
+    volatile uint8_t stop;
+    uint32_t shots;
+    uint32_t failed;
+    uint32_t wake_max;
+} timelapse_obj_t;
+
+static timelapse_obj_t *timelapse_obj = NULL;
+
+// Frames left over from the last shot
+static void timelapse_drain(void)
+{
+    cam_frame_t *frame;
+    while ((frame = cam_sub_take(timelapse_obj->sub, 0)) != NULL) {
+        cam_frame_unref(frame);
+    }
+}
+
+static void timelapse_sleep(void)
+{
+    cam_stop();
+    timelapse_drain();
+    // 先进入待机再关 XCLK
+    OV2640_Standby(1);
+    cam_set_xclk_enable(0);
+}
+
+static int timelapse_shot(void)
+{
+    int64_t start = esp_timer_get_time();
+    cam_set_xclk_enable(1);
+    OV2640_Standby(0);
+    cam_start();
+    cam_frame_t *frame = NULL;
+    for (int i = 0; i <= timelapse_obj->config.warmup; i++) {
+        if (frame) {
+            cam_frame_unref(frame);
+        }
+        frame = cam_sub_take(timelapse_obj->sub, timelapse_obj->config.timeout_ms);
+        if (frame == NULL) {
+            ESP_LOGE(TAG, "frame %d of shot %u timeout\n", i, timelapse_obj->shots);
+            timelapse_sleep();
+            return -1;
+        }
+    }
+    uint32_t wake = esp_timer_get_time() - start;
+    if (wake > timelapse_obj->wake_max) {
+        timelapse_obj->wake_max = wake;
+    }
+    // 回调期间传感器仍在输出，多出的帧在 timelapse_sleep 中丢弃
+    timelapse_obj->config.cb(frame, timelapse_obj->config.arg);
+    cam_frame_unref(frame);
+    timelapse_sleep();
+    return 0;
+}
+
+static void timelapse_task(void *arg)
+{
+    TickType_t last = xTaskGetTickCount();
+    while (!timelapse_obj->stop) {
+        if (timelapse_shot() == 0) {
+            timelapse_obj->shots++;
+        } else {
+            timelapse_obj->failed++;
+        }
+        // 等待期间没有 PM 锁，tickless idle 下进入 light sleep
+        vTaskDelayUntil(&last, pdMS_TO_TICKS(timelapse_obj->config.period_ms));
+    }
+    timelapse_obj->task = NULL;
+    vTaskDelete(NULL);
+}
+
+int timelapse_start(const timelapse_config_t *config)
+{
+    if (config->cb == NULL || config->period_ms == 0) {
+        ESP_LOGE(TAG, "config error\n");
+        return -1;
+    }
+    if (timelapse_obj == NULL) {
+        timelapse_obj = (timelapse_obj_t *)calloc(1, sizeof(timelapse_obj_t));
+        if (timelapse_obj == NULL) {
+            ESP_LOGE(TAG, "timelapse object malloc error\n");
+            return -1;
+        }
+        // 只保留最新的一帧
+        cam_sub_config_t sub_config = {
+            .name = "timelapse",
+            .depth = 1,
+            .drop = CAM_SUB_DROP_OLDEST,
+        };
+        timelapse_obj->sub = cam_sub_add(&sub_config);
+        if (timelapse_obj->sub == NULL) {
+            ESP_LOGE(TAG, "cam subscriber error\n");
+            free(timelapse_obj);
+            timelapse_obj = NULL;
+            return -1;
+        }
+    } else if (timelapse_obj->task) {
+        ESP_LOGE(TAG, "already started\n");
+        return -1;
+    }
+    timelapse_obj->config = *config;
+    timelapse_obj->config.warmup = config->warmup ? config->warmup : 2;
+    timelapse_obj->config.timeout_ms = config->timeout_ms ? config->timeout_ms : 2000;
+    timelapse_obj->stop = 0;
+    timelapse_sleep();
+    if (xTaskCreate(timelapse_task, "timelapse", 3 * 1024, NULL, config->task_pri, &timelapse_obj->task) != pdPASS) {
+        ESP_LOGE(TAG, "task create error\n");
+        timelapse_obj->task = NULL;
+        return -1;
+    }
+    ESP_LOGI(TAG, "every %u ms, %d warmup frames\n", timelapse_obj->config.period_ms, timelapse_obj->config.warmup);
+    return 0;
+}
+
+void timelapse_stop(void)
+{
+    if (timelapse_obj == NULL) {
+        return;
+    }
+    timelapse_obj->stop = 1;
+    // 最多等一个周期加一次拍摄
+    while (timelapse_obj->task) {
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+}
+
+void timelapse_get_stats(uint32_t *shots, uint32_t *failed, uint32_t *wake_max_us)
+{
+    if (timelapse_obj == NULL) {
+        *shots = *failed = *wake_max_us = 0;
+        return;
+    }
+    *shots = timelapse_obj->shots;
+    *failed = timelapse_obj->failed;
+    *wake_max_us = timelapse_obj->wake_max;
+}
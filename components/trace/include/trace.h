@@ -0,0 +1,84 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sdkconfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Timeline events for the real, concurrent system. Each event takes the CCOUNT of its core, the task
+// (or none in an ISR) and a name, which must be a string literal: only the pointer is stored.
+// Events go to a RAM ring per core without a lock, the writer masks the interrupts of its own core for
+// the few instructions it takes, so they are safe in IRAM ISRs. trace_dump prints the rings on the console,
+// tools/trace_json.py turns the log into a JSON file chrome://tracing or Perfetto can load.
+
+typedef enum {
+    TRACE_EV_BEGIN,
+    TRACE_EV_END,
+    TRACE_EV_INSTANT,
+    TRACE_EV_COUNTER,
+    TRACE_EV_MISS,
+} trace_ev_t;
+
+#if CONFIG_TRACE_ENABLE
+#define TRACE_BEGIN(name)           trace_record(TRACE_EV_BEGIN, name, 0)
+#define TRACE_END(name)             trace_record(TRACE_EV_END, name, 0)
+#define TRACE_INSTANT(name)         trace_record(TRACE_EV_INSTANT, name, 0)
+#define TRACE_COUNTER(name, value)  trace_record(TRACE_EV_COUNTER, name, value)
+#else
+#define TRACE_BEGIN(name)           do {} while (0)
+#define TRACE_END(name)             do {} while (0)
+#define TRACE_INSTANT(name)         do {} while (0)
+#define TRACE_COUNTER(name, value)  do {} while (0)
+#endif
+
+void trace_record(trace_ev_t ev, const char *name, int32_t value);
+
+// Recording is on from boot, trace_stop freezes the rings, e.g. right after a glitch was seen
+void trace_start(void);
+void trace_stop(void);
+
+// Print the rings oldest first and empty them, recording goes on if it was on
+void trace_dump(void);
+
+// Deadlines of pipeline stages, e.g. one audio frame for the AFE. A run between trace_stage_begin and
+// trace_stage_end is timed by CCOUNT, a run over the budget of its stage bumps the counters of the stage and,
+// with recording on, puts a TRACE_EV_MISS event in the ring: the stage, the overrun in us and the task that
+// was running on the other core. The counters are kept whether trace events are compiled in or not.
+// A stage is run by one task or ISR at a time. The budget is converted to cycles at the CPU frequency of the
+// time it is set, hold the CPU at that frequency while the stage runs when power management is on.
+
+typedef struct trace_stage *trace_stage_t;
+
+typedef struct {
+    const char *name;
+    uint32_t budget_us;     // 0: the runs are counted, never missed
+    uint32_t runs;
+    uint32_t misses;
+    uint32_t worst_us;      // longest run
+    uint32_t last_over_us;  // overrun of the last miss
+} trace_stage_stats_t;
+
+// The stage of name, registered with budget_us the first time. name must be a string literal.
+// NULL when all CONFIG_TRACE_STAGES are taken, the other stage functions ignore a NULL stage
+trace_stage_t trace_stage_register(const char *name, uint32_t budget_us);
+
+void trace_stage_set_budget(trace_stage_t stage, uint32_t budget_us);
+
+void trace_stage_begin(trace_stage_t stage);
+void trace_stage_end(trace_stage_t stage);
+
+// Counters of the index-th stage registered, false past the last one
+bool trace_stage_get(int index, trace_stage_stats_t *stats);
+
+// Misses of all the stages since boot
+uint32_t trace_stage_misses(void);
+
+// Print the counters of every stage
+void trace_stage_report(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,96 @@
+# -*- coding:utf-8 -*-
+#
+# Turn the "TRACE" lines trace_dump prints into a Trace Event JSON file for chrome://tracing or Perfetto.
+#
+#   python trace_json.py monitor.log trace.json
+#
+# The log may hold anything else around the dump, the last dump in it is converted.
+# Each core is a process, each task a thread, events recorded in an ISR go to the "isr" thread of their core.
+# CCOUNT wraps every few seconds, it is unwrapped along each ring, so a dump covers any length of time as long
+# as consecutive events of a core are less than one wrap apart. The cores are assumed to count in step.
+from __future__ import print_function
+import json
+import sys
+
+CCOUNT_WRAP = 1 << 32
+
+
+def parse(lines):
+    dump = None
+    for line in lines:
+        line = line.strip()
+        pos = line.find("TRACE ")
+        if pos < 0:
+            continue
+        field = line[pos:].split(" ", 7)
+        if field[1] == "start":
+            dump = {"cpu_hz": int(field[2]), "cores": int(field[3]), "tasks": {}, "events": [], "lost": {}}
+        elif dump is None:
+            continue
+        elif field[1] == "task":
+            dump["tasks"][field[2]] = line[pos:].split(" ", 3)[3]
+        elif field[1] == "ev":
+            dump["events"].append((int(field[2]), int(field[3]), field[4], field[5], int(field[6]), field[7], None))
+        elif field[1] == "miss":
+            # a stage over its budget: value is the overrun in us, peer the task on the other core
+            field = line[pos:].split(" ", 7)
+            dump["events"].append((int(field[2]), int(field[3]), "M", field[4], int(field[6]), field[7], field[5]))
+        elif field[1] == "lost":
+            dump["lost"][int(field[2])] = int(field[3])
+    return dump
+
+
+def convert(dump):
+    events = []
+    last = {}
+    base = {}
+    for core, ccount, ph, task, value, name, peer in dump["events"]:
+        if core in last and ccount < last[core]:
+            base[core] = base.get(core, 0) + CCOUNT_WRAP
+        last[core] = ccount
+        cycles = base.get(core, 0) + ccount
+        # viewers want numeric ids, the task handle is one and no task sits at 0
+        tid = int(task, 16) if task not in ("(nil)", "0x0") else 0
+        ev = {"name": name, "ph": ph, "pid": core, "tid": tid, "cycles": cycles}
+        if ph == "I":
+            ev["ph"] = "i"
+            ev["s"] = "t"
+        elif ph == "C":
+            ev["args"] = {name: value}
+        elif ph == "M":
+            ev["name"] = name + " miss"
+            ev["ph"] = "i"
+            ev["s"] = "p"
+            ev["args"] = {"overrun_us": value, "other core": dump["tasks"].get(peer, peer)}
+        events.append(ev)
+
+    start = min(ev["cycles"] for ev in events) if events else 0
+    for ev in events:
+        ev["ts"] = (ev.pop("cycles") - start) * 1e6 / dump["cpu_hz"]
+
+    for core in range(dump["cores"]):
+        events.append({"name": "process_name", "ph": "M", "pid": core, "args": {"name": "core %d" % core}})
+        events.append({"name": "thread_name", "ph": "M", "pid": core, "tid": 0, "args": {"name": "isr"}})
+        for task, name in dump["tasks"].items():
+            events.append({"name": "thread_name", "ph": "M", "pid": core, "tid": int(task, 16), "args": {"name": name}})
+        if dump["lost"].get(core):
+            print("core %d: %d older events were overwritten" % (core, dump["lost"][core]))
+    return {"traceEvents": events, "displayTimeUnit": "ns"}
+
+
+def main():
+    if len(sys.argv) != 3:
+        print("usage: %s <monitor log> <trace.json>" % sys.argv[0])
+        sys.exit(1)
+    with open(sys.argv[1], "r") as f:
+        dump = parse(f)
+    if dump is None:
+        print("no trace dump in %s" % sys.argv[1])
+        sys.exit(1)
+    with open(sys.argv[2], "w") as f:
+        json.dump(convert(dump), f)
+    print("%d events" % len(dump["events"]))
+
+
+if __name__ == "__main__":
+    main()
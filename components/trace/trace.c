@@ -0,0 +1,242 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_attr.h"
+#include "esp32s2/clk.h"
+#include "trace.h"
+
+#if CONFIG_TRACE_ENABLE
+
+typedef struct {
+    uint32_t ccount;
+    const char *name;
+    void *task;         // NULL in an ISR
+    void *peer;         // TRACE_EV_MISS: task on the other core, NULL on a single core
+    int32_t value;
+    uint8_t ev;
+} trace_event_t;
+
+typedef struct {
+    uint32_t head;      // events written since the last dump, the ring holds the last CONFIG_TRACE_EVENTS
+    trace_event_t event[CONFIG_TRACE_EVENTS];
+} trace_ring_t;
+
+static DRAM_ATTR trace_ring_t s_ring[portNUM_PROCESSORS];
+static DRAM_ATTR volatile uint8_t s_on = 1;
+
+static const char s_ev_char[] = { 'B', 'E', 'I', 'C', 'M' };
+#endif
+
+static inline uint32_t trace_ccount(void)
+{
+    uint32_t ccount;
+    __asm__ __volatile__("rsr %0, ccount" : "=a"(ccount));
+    return ccount;
+}
+
+#if CONFIG_TRACE_ENABLE
+static void IRAM_ATTR trace_record_peer(trace_ev_t ev, const char *name, int32_t value, void *peer)
+{
+    if (!s_on) {
+        return;
+    }
+    // only this core writes its ring, holding off its interrupts is all the locking needed
+    uint32_t state = portSET_INTERRUPT_MASK_FROM_ISR();
+    trace_ring_t *ring = &s_ring[xPortGetCoreID()];
+    trace_event_t *e = &ring->event[ring->head % CONFIG_TRACE_EVENTS];
+    e->ccount = trace_ccount();
+    e->name = name;
+    e->task = xPortInIsrContext() ? NULL : xTaskGetCurrentTaskHandle();
+    e->peer = peer;
+    e->value = value;
+    e->ev = ev;
+    ring->head++;
+    portCLEAR_INTERRUPT_MASK_FROM_ISR(state);
+}
+
+void IRAM_ATTR trace_record(trace_ev_t ev, const char *name, int32_t value)
+{
+    trace_record_peer(ev, name, value, NULL);
+}
+
+void trace_start(void)
+{
+    s_on = 1;
+}
+
+void trace_stop(void)
+{
+    s_on = 0;
+}
+
+static void trace_dump_tasks(void)
+{
+#if configUSE_TRACE_FACILITY
+    UBaseType_t num = uxTaskGetNumberOfTasks();
+    TaskStatus_t *status = malloc(num * sizeof(TaskStatus_t));
+    if (status == NULL) {
+        return;
+    }
+    num = uxTaskGetSystemState(status, num, NULL);
+    for (int i = 0; i < num; i++) {
+        printf("TRACE task %p %s\n", status[i].xHandle, status[i].pcTaskName);
+    }
+    free(status);
+#endif
+}
+
+void trace_dump(void)
+{
+    uint8_t on = s_on;
+    s_on = 0;
+    // a writer that passed the s_on check before has finished once the other core took a tick
+    vTaskDelay(1);
+
+    printf("TRACE start %d %d\n", esp_clk_cpu_freq(), portNUM_PROCESSORS);
+    trace_dump_tasks();
+    for (int core = 0; core < portNUM_PROCESSORS; core++) {
+        trace_ring_t *ring = &s_ring[core];
+        uint32_t first = ring->head > CONFIG_TRACE_EVENTS ? ring->head - CONFIG_TRACE_EVENTS : 0;
+        for (uint32_t i = first; i < ring->head; i++) {
+            trace_event_t *e = &ring->event[i % CONFIG_TRACE_EVENTS];
+            if (e->ev == TRACE_EV_MISS) {
+                printf("TRACE miss %d %u %p %p %d %s\n", core, e->ccount, e->task, e->peer, e->value, e->name);
+                continue;
+            }
+            printf("TRACE ev %d %u %c %p %d %s\n", core, e->ccount, s_ev_char[e->ev], e->task, e->value, e->name);
+        }
+        printf("TRACE lost %d %u\n", core, first);
+        ring->head = 0;
+    }
+    printf("TRACE end\n");
+    s_on = on;
+}
+
+#else
+
+void trace_record(trace_ev_t ev, const char *name, int32_t value)
+{
+}
+
+void trace_start(void)
+{
+}
+
+void trace_stop(void)
+{
+}
+
+void trace_dump(void)
+{
+}
+
+#endif
+
+struct trace_stage {
+    const char *name;
+    uint32_t mhz;           // CCOUNT rate when the budget was set, an ISR can not ask for it
+    uint32_t budget;        // cycles
+    uint32_t start;
+    uint32_t runs;
+    uint32_t misses;
+    uint32_t worst;         // cycles
+    uint32_t last_over_us;
+};
+
+static DRAM_ATTR struct trace_stage s_stage[CONFIG_TRACE_STAGES];
+static int s_stage_num;
+static DRAM_ATTR volatile uint32_t s_stage_misses;
+static portMUX_TYPE s_stage_lock = portMUX_INITIALIZER_UNLOCKED;
+
+trace_stage_t trace_stage_register(const char *name, uint32_t budget_us)
+{
+    trace_stage_t stage = NULL;
+    portENTER_CRITICAL(&s_stage_lock);
+    for (int i = 0; i < s_stage_num; i++) {
+        if (strcmp(s_stage[i].name, name) == 0) {
+            stage = &s_stage[i];
+            break;
+        }
+    }
+    if (stage == NULL && s_stage_num < CONFIG_TRACE_STAGES) {
+        stage = &s_stage[s_stage_num];
+        stage->name = name;
+        s_stage_num++;
+        trace_stage_set_budget(stage, budget_us);
+    }
+    portEXIT_CRITICAL(&s_stage_lock);
+    return stage;
+}
+
+void trace_stage_set_budget(trace_stage_t stage, uint32_t budget_us)
+{
+    if (stage == NULL) {
+        return;
+    }
+    stage->mhz = esp_clk_cpu_freq() / 1000000;
+    stage->budget = budget_us * stage->mhz;
+}
+
+void IRAM_ATTR trace_stage_begin(trace_stage_t stage)
+{
+    if (stage) {
+        stage->start = trace_ccount();
+    }
+}
+
+void IRAM_ATTR trace_stage_end(trace_stage_t stage)
+{
+    if (stage == NULL) {
+        return;
+    }
+    uint32_t cycles = trace_ccount() - stage->start;
+    stage->runs++;
+    if (cycles > stage->worst) {
+        stage->worst = cycles;
+    }
+    if (stage->budget == 0 || cycles <= stage->budget) {
+        return;
+    }
+    stage->misses++;
+    __atomic_fetch_add(&s_stage_misses, 1, __ATOMIC_RELAXED);   // stages of both cores
+    stage->last_over_us = (cycles - stage->budget) / stage->mhz;
+#if CONFIG_TRACE_ENABLE
+    void *peer = NULL;
+#if portNUM_PROCESSORS > 1
+    peer = xTaskGetCurrentTaskHandleForCPU(!xPortGetCoreID());
+#endif
+    trace_record_peer(TRACE_EV_MISS, stage->name, stage->last_over_us, peer);
+#endif
+}
+
+bool trace_stage_get(int index, trace_stage_stats_t *stats)
+{
+    if (index < 0 || index >= s_stage_num) {
+        return false;
+    }
+    const struct trace_stage *stage = &s_stage[index];
+    stats->name = stage->name;
+    stats->budget_us = stage->budget / stage->mhz;
+    stats->runs = stage->runs;
+    stats->misses = stage->misses;
+    stats->worst_us = stage->worst / stage->mhz;
+    stats->last_over_us = stage->last_over_us;
+    return true;
+}
+
+uint32_t trace_stage_misses(void)
+{
+    return s_stage_misses;
+}
+
+void trace_stage_report(void)
+{
+    trace_stage_stats_t stats;
+    printf("%-16s %9s %9s %8s %9s %9s\n", "stage", "budget us", "runs", "misses", "worst us", "over us");
+    for (int i = 0; trace_stage_get(i, &stats); i++) {
+        printf("%-16s %9u %9u %8u %9u %9u\n", stats.name, stats.budget_us, stats.runs, stats.misses,
+               stats.worst_us, stats.last_over_us);
+    }
+}
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "freertos/FreeRTOS.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Micro-benchmarks timed in CPU cycles (CCOUNT). A case is one iteration of a hot path with an optional
+// setup and teardown; ubench_run runs every registered case in a task pinned to one core, warmup
+// iterations first, and prints one JSON line per case on the console UART:
+//   UBENCH {"name":"memcpy_int_psram","mode":"no_irq","core":0,"cpu_hz":240000000,"bytes":16384,"iterations":64,
+//           "min":...,"median":...,"p90":...,"max":...,"mean":...,"stddev":...,"median_ns":...,"mbps":...}
+// Cycle fields are per iteration, with the cost of reading CCOUNT taken off.
+
+#define UBENCH_WARMUP          4
+#define UBENCH_ITERATIONS      64
+#define UBENCH_ITERATIONS_MAX  1024
+#define UBENCH_CASES_MAX       32
+
+typedef enum {
+    UBENCH_PINNED = 0,  // interrupts stay on: for code that waits for DMA, a driver or another task
+    UBENCH_NO_IRQ,      // the interrupts of the core are masked around each iteration: computation and copies
+} ubench_mode_t;
+
+typedef struct {
+    const char *name;
+    int (*setup)(void **ctx);       // NULL, or 0 when ready; anything else skips the case, e.g. without PSRAM
+    void (*run)(void *ctx);         // one iteration, the timed part
+    void (*teardown)(void *ctx);    // NULL, or undo setup
+    uint32_t bytes;                 // moved by one iteration, for the mbps field; 0 leaves it out
+    ubench_mode_t mode;
+    uint16_t warmup;                // untimed iterations, 0: UBENCH_WARMUP
+    uint16_t iterations;            // timed iterations, 0: UBENCH_ITERATIONS
+} ubench_case_t;
+
+// Define a case named after id, the remaining fields as designated initializers:
+//   UBENCH_CASE(lcd_push, .setup = lcd_push_setup, .run = lcd_push_run, .bytes = 320 * 240 * 2);
+#define UBENCH_CASE(id, ...) \
+    const ubench_case_t ubench_case_##id = { .name = #id, __VA_ARGS__ }
+
+// Register a case defined with UBENCH_CASE in any file, the reference also keeps it in the link
+#define UBENCH_REGISTER(id) do { \
+        extern const ubench_case_t ubench_case_##id; \
+        ubench_register(&ubench_case_##id); \
+    } while (0)
+
+typedef struct {
+    uint32_t iterations;
+    uint32_t min;           // cycles
+    uint32_t median;
+    uint32_t p90;
+    uint32_t max;
+    uint32_t mean;
+    uint32_t stddev;
+} ubench_stats_t;
+
+typedef struct {
+    const char *filter;     // run the cases whose name starts with it, NULL for all
+    int core;               // core of the benchmark task
+    int priority;           // of the benchmark task, above everything the cases do not wait for
+    uint32_t stack_size;
+} ubench_config_t;
+
+#define UBENCH_DEFAULT_CONFIG() { \
+        .filter = NULL, \
+        .core = 0, \
+        .priority = configMAX_PRIORITIES - 1, \
+        .stack_size = 4096, \
+    }
+
+static inline uint32_t ubench_ccount(void)
+{
+    uint32_t ccount;
+    __asm__ __volatile__("rsr %0, ccount" : "=a"(ccount));
+    return ccount;
+}
+
+// Cycles to nanoseconds at the current CPU clock, for ad hoc timing with ubench_ccount
+uint32_t ubench_cycles_to_ns(uint32_t cycles);
+
+// 0: registered, -1: table full
+int ubench_register(const ubench_case_t *c);
+
+// The memcpy cases: internal to internal, internal to PSRAM, PSRAM to internal and PSRAM to PSRAM
+void ubench_register_mem(void);
+
+// Time one case in the calling task. 0: done, 1: skipped by its setup, -1: error
+int ubench_measure(const ubench_case_t *c, ubench_stats_t *stats);
+
+// Run the registered cases in a pinned task and print their JSON lines, blocks until they are done.
+// Returns the number of cases run, -1 on error
+int ubench_run(const ubench_config_t *config);
+
+#ifdef __cplusplus
+}
+#endif
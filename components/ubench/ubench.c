@@ -0,0 +1,189 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp32s2/clk.h"
+#include "ubench.h"
+
+static const char *TAG = "ubench";
+
+typedef struct {
+    const ubench_config_t *config;
+    SemaphoreHandle_t done;
+    int ran;
+} ubench_job_t;
+
+static const ubench_case_t *ubench_cases[UBENCH_CASES_MAX];
+static int ubench_case_num = 0;
+
+static const char *ubench_mode_name[] = {"pinned", "no_irq"};
+
+uint32_t ubench_cycles_to_ns(uint32_t cycles)
+{
+    return (uint64_t)cycles * 1000000000ULL / esp_clk_cpu_freq();
+}
+
+int ubench_register(const ubench_case_t *c)
+{
+    for (int i = 0; i < ubench_case_num; i++) {
+        if (ubench_cases[i] == c) {
+            return 0;
+        }
+    }
+    if (ubench_case_num >= UBENCH_CASES_MAX) {
+        ESP_LOGE(TAG, "case table full, %s not registered\n", c->name);
+        return -1;
+    }
+    ubench_cases[ubench_case_num++] = c;
+    return 0;
+}
+
+static void ubench_nop(void *ctx)
+{
+}
+
+static uint32_t ubench_time(const ubench_case_t *c, void *ctx)
+{
+    uint32_t state = 0;
+    if (c->mode == UBENCH_NO_IRQ) {
+        state = portSET_INTERRUPT_MASK_FROM_ISR();
+    }
+    uint32_t start = ubench_ccount();
+    c->run(ctx);
+    uint32_t cycles = ubench_ccount() - start;
+    if (c->mode == UBENCH_NO_IRQ) {
+        portCLEAR_INTERRUPT_MASK_FROM_ISR(state);
+    }
+    return cycles;
+}
+
+// Cycles of the timing itself: the fastest of a few empty iterations
+static uint32_t ubench_overhead(void)
+{
+    const ubench_case_t nop = {.run = ubench_nop, .mode = UBENCH_NO_IRQ};
+    uint32_t min = UINT32_MAX;
+    for (int i = 0; i < 8; i++) {
+        uint32_t cycles = ubench_time(&nop, NULL);
+        min = cycles < min ? cycles : min;
+    }
+    return min;
+}
+
+static int ubench_cmp(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+    return x < y ? -1 : x > y;
+}
+
+int ubench_measure(const ubench_case_t *c, ubench_stats_t *stats)
+{
+    int iterations = c->iterations ? c->iterations : UBENCH_ITERATIONS;
+    int warmup = c->warmup ? c->warmup : UBENCH_WARMUP;
+    if (iterations > UBENCH_ITERATIONS_MAX || c->run == NULL) {
+        ESP_LOGE(TAG, "%s: case config error\n", c->name);
+        return -1;
+    }
+    uint32_t *cycles = malloc(iterations * sizeof(uint32_t));
+    if (!cycles) {
+        ESP_LOGE(TAG, "%s: samples malloc error\n", c->name);
+        return -1;
+    }
+    void *ctx = NULL;
+    if (c->setup && c->setup(&ctx) != 0) {
+        free(cycles);
+        return 1;
+    }
+    uint32_t overhead = ubench_overhead();
+    for (int i = 0; i < warmup; i++) {
+        ubench_time(c, ctx);
+    }
+    for (int i = 0; i < iterations; i++) {
+        uint32_t t = ubench_time(c, ctx);
+        cycles[i] = t > overhead ? t - overhead : 0;
+    }
+    if (c->teardown) {
+        c->teardown(ctx);
+    }
+
+    // 排序后取中位数和 p90, 均值和标准差按全部样本计算
+    qsort(cycles, iterations, sizeof(uint32_t), ubench_cmp);
+    uint64_t sum = 0;
+    for (int i = 0; i < iterations; i++) {
+        sum += cycles[i];
+    }
+    double mean = (double)sum / iterations;
+    double var = 0;
+    for (int i = 0; i < iterations; i++) {
+        var += (cycles[i] - mean) * (cycles[i] - mean);
+    }
+    stats->iterations = iterations;
+    stats->min = cycles[0];
+    stats->median = cycles[iterations / 2];
+    stats->p90 = cycles[iterations * 9 / 10];
+    stats->max = cycles[iterations - 1];
+    stats->mean = (uint32_t)(mean + 0.5);
+    stats->stddev = (uint32_t)(sqrt(var / iterations) + 0.5);
+    free(cycles);
+    return 0;
+}
+
+static void ubench_print(const ubench_case_t *c, const ubench_stats_t *s)
+{
+    uint32_t cpu_hz = esp_clk_cpu_freq();
+    printf("UBENCH {\"name\":\"%s\",\"mode\":\"%s\",\"core\":%d,\"cpu_hz\":%u,\"bytes\":%u,\"iterations\":%u,"
+           "\"min\":%u,\"median\":%u,\"p90\":%u,\"max\":%u,\"mean\":%u,\"stddev\":%u,\"median_ns\":%u",
+           c->name, ubench_mode_name[c->mode], xPortGetCoreID(), cpu_hz, c->bytes, s->iterations,
+           s->min, s->median, s->p90, s->max, s->mean, s->stddev, ubench_cycles_to_ns(s->median));
+    if (c->bytes && s->median) {
+        // MB/s at the median
+        printf(",\"mbps\":%.2f", (double)c->bytes * cpu_hz / s->median / 1000000);
+    }
+    printf("}\n");
+}
+
+static void ubench_task(void *arg)
+{
+    ubench_job_t *job = (ubench_job_t *)arg;
+    const char *filter = job->config->filter;
+    for (int i = 0; i < ubench_case_num; i++) {
+        const ubench_case_t *c = ubench_cases[i];
+        if (filter && strncmp(c->name, filter, strlen(filter)) != 0) {
+            continue;
+        }
+        ubench_stats_t stats;
+        int ret = ubench_measure(c, &stats);
+        if (ret == 0) {
+            ubench_print(c, &stats);
+            job->ran++;
+        } else if (ret == 1) {
+            printf("UBENCH {\"name\":\"%s\",\"skipped\":true}\n", c->name);
+        }
+    }
+    printf("UBENCH_DONE {\"cases\":%d}\n", job->ran);
+    xSemaphoreGive(job->done);
+    vTaskDelete(NULL);
+}
+
+int ubench_run(const ubench_config_t *config)
+{
+    ubench_job_t job = {
+        .config = config,
+        .done = xSemaphoreCreateBinary(),
+    };
+    if (!job.done) {
+        ESP_LOGE(TAG, "semaphore create error\n");
+        return -1;
+    }
+    if (xTaskCreatePinnedToCore(ubench_task, "ubench", config->stack_size, &job, config->priority, NULL, config->core) != pdPASS) {
+        ESP_LOGE(TAG, "ubench task create error\n");
+        vSemaphoreDelete(job.done);
+        return -1;
+    }
+    xSemaphoreTake(job.done, portMAX_DELAY);
+    vSemaphoreDelete(job.done);
+    return job.ran;
+}
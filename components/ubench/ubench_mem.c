@@ -0,0 +1,86 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_heap_caps.h"
+#include "ubench.h"
+
+#define UBENCH_MEM_BYTES (16 * 1024) // 不小于 PSRAM 的数据 cache, PSRAM 的用例测到的主要是外部总线带宽
+
+typedef struct {
+    uint8_t *dst;
+    uint8_t *src;
+} ubench_mem_t;
+
+static int ubench_mem_setup(void **ctx, uint32_t dst_caps, uint32_t src_caps)
+{
+    ubench_mem_t *m = (ubench_mem_t *)calloc(1, sizeof(ubench_mem_t));
+    if (!m) {
+        return -1;
+    }
+    m->dst = heap_caps_malloc(UBENCH_MEM_BYTES, dst_caps);
+    m->src = heap_caps_malloc(UBENCH_MEM_BYTES, src_caps);
+    if (!m->dst || !m->src) {
+        heap_caps_free(m->dst);
+        heap_caps_free(m->src);
+        free(m);
+        return -1;
+    }
+    memset(m->src, 0x5a, UBENCH_MEM_BYTES);
+    *ctx = m;
+    return 0;
+}
+
+static void ubench_mem_teardown(void *ctx)
+{
+    ubench_mem_t *m = (ubench_mem_t *)ctx;
+    heap_caps_free(m->dst);
+    heap_caps_free(m->src);
+    free(m);
+}
+
+static void ubench_mem_run(void *ctx)
+{
+    ubench_mem_t *m = (ubench_mem_t *)ctx;
+    memcpy(m->dst, m->src, UBENCH_MEM_BYTES);
+}
+
+#define UBENCH_MEM_INT (MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT)
+#define UBENCH_MEM_EXT (MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT)
+
+static int ubench_mem_int_int(void **ctx)
+{
+    return ubench_mem_setup(ctx, UBENCH_MEM_INT, UBENCH_MEM_INT);
+}
+
+static int ubench_mem_int_psram(void **ctx)
+{
+    return ubench_mem_setup(ctx, UBENCH_MEM_EXT, UBENCH_MEM_INT);
+}
+
+static int ubench_mem_psram_int(void **ctx)
+{
+    return ubench_mem_setup(ctx, UBENCH_MEM_INT, UBENCH_MEM_EXT);
+}
+
+static int ubench_mem_psram_psram(void **ctx)
+{
+    return ubench_mem_setup(ctx, UBENCH_MEM_EXT, UBENCH_MEM_EXT);
+}
+
+// 源在前, 目的在后
+UBENCH_CASE(memcpy_int_int, .setup = ubench_mem_int_int, .run = ubench_mem_run, .teardown = ubench_mem_teardown,
+            .bytes = UBENCH_MEM_BYTES, .mode = UBENCH_NO_IRQ);
+UBENCH_CASE(memcpy_int_psram, .setup = ubench_mem_int_psram, .run = ubench_mem_run, .teardown = ubench_mem_teardown,
+            .bytes = UBENCH_MEM_BYTES, .mode = UBENCH_NO_IRQ);
+UBENCH_CASE(memcpy_psram_int, .setup = ubench_mem_psram_int, .run = ubench_mem_run, .teardown = ubench_mem_teardown,
+            .bytes = UBENCH_MEM_BYTES, .mode = UBENCH_NO_IRQ);
+UBENCH_CASE(memcpy_psram_psram, .setup = ubench_mem_psram_psram, .run = ubench_mem_run, .teardown = ubench_mem_teardown,
+            .bytes = UBENCH_MEM_BYTES, .mode = UBENCH_NO_IRQ);
+
+void ubench_register_mem(void)
+{
+    UBENCH_REGISTER(memcpy_int_int);
+    UBENCH_REGISTER(memcpy_int_psram);
+    UBENCH_REGISTER(memcpy_psram_int);
+    UBENCH_REGISTER(memcpy_psram_psram);
+}
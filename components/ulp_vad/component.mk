@@ -0,0 +1,5 @@
+#
+# The ULP-RISC-V program is built by ulp_embed_binary of the CMake build only, with make the component is empty.
+#
+COMPONENT_ADD_INCLUDEDIRS := include
+COMPONENT_SRCDIRS :=
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Speech onset detection on the ULP-RISC-V while the main CPU sleeps. The ULP samples an analog mic on an ADC1
+// channel at ULP_VAD_RATE into a ring in RTC slow memory and runs an energy / zero-crossing VAD over 20ms frames:
+// a frame is speech when its energy is ratio over the noise floor and its zero crossings are in the voiced range.
+// After onset_frames of speech in a row the ring is frozen and the main CPU woken; ulp_vad_get_preroll hands the
+// samples before and during the onset to WakeNet at 16kHz, so the start of the wake word is not lost while the
+// I2S path comes up. Needs CONFIG_ESP32S2_ULP_COPROC_ENABLED, CONFIG_ESP32S2_ULP_COPROC_RISCV and
+// CONFIG_ESP32S2_ULP_COPROC_RESERVE_MEM of at least 6144.
+
+#define ULP_VAD_RATE        8000
+#define ULP_VAD_FRAME       160     // 20ms
+#define ULP_VAD_RING        2048    // samples of pre-roll, 256ms
+
+typedef struct {
+    int adc1_channel;       // the mic amplifier output, biased to mid scale
+    uint8_t ratio;          // frame energy over the noise floor for speech, 0: 8 (9dB)
+    uint8_t onset_frames;   // speech frames in a row that wake, 0: 3
+    uint8_t zc_min;         // zero crossings per frame of voiced speech, 0: 4 (100Hz)
+    uint8_t zc_max;         // above it the frame is hiss or clicks, 0: 60 (1.5kHz)
+} ulp_vad_config_t;
+
+// Load the ULP program and set up the ADC channel for it. Once, the I2S capture must not use ADC1
+int ulp_vad_init(const ulp_vad_config_t *config);
+
+// Arm the VAD and light-sleep until it detects speech; the ULP keeps the ring while the CPU runs afterwards.
+// Returns 0 on a speech wake, 1 on any other wakeup source, -1 on error
+int ulp_vad_sleep(void);
+
+// The last samples of the ring up to the wake point, upsampled to 16kHz, DC removed and scaled to 16 bit.
+// Returns the samples written, at most samples and 2 * ULP_VAD_RING
+int ulp_vad_get_preroll(int16_t *pcm, int samples);
+
+// Frames run and wakes since ulp_vad_init, and the noise floor at the last wake (mean square, 12 bit ADC)
+void ulp_vad_get_stats(uint32_t *frames, uint32_t *wakes, uint32_t *floor);
+
+#ifdef __cplusplus
+}
+#endif
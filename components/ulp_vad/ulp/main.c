@@ -0,0 +1,109 @@
+// ULP-RISC-V side of ulp_vad: sample the ADC into the ring, run the VAD per frame, wake the main CPU on onset.
+// Every global lands in RTC slow memory and is seen by the main CPU as ulp_<name>.
+#include <stdint.h>
+#include "soc/soc.h"
+#include "soc/sens_reg.h"
+#include "ulp_riscv/ulp_riscv_utils.h"
+#include "../include/ulp_vad.h"
+
+#define DC_SHIFT    10      // the DC estimate follows the last ~128ms
+#define FLOOR_SHIFT 6       // the noise floor rises 3.4dB a second at most, falls at once
+#define FLOOR_MIN   16
+#define ZC_BAND     8       // hysteresis of the zero crossings, ADC steps
+#define SETTLE      8       // frames before the first decision, the DC and the floor settle
+
+uint32_t armed;             // set by the main CPU before it sleeps, cleared at the wake
+uint32_t channel;
+uint32_t period;            // ULP cycles per sample
+uint32_t ratio;
+uint32_t onset;
+uint32_t zc_min;
+uint32_t zc_max;
+uint32_t pos;               // next sample of the ring
+uint32_t wake_pos;          // pos at the wake, the ring is frozen until armed again
+uint32_t frames;
+uint32_t wakes;
+uint32_t late;              // samples taken after their time, the loop did not keep up
+uint32_t noise_floor;
+int16_t ring[ULP_VAD_RING];
+
+static inline uint32_t cycles(void)
+{
+    uint32_t c;
+    asm volatile("rdcycle %0" : "=r"(c));
+    return c;
+}
+
+static inline int adc_read(void)
+{
+    CLEAR_PERI_REG_MASK(SENS_SAR_MEAS1_CTRL2_REG, SENS_MEAS1_START_SAR);
+    SET_PERI_REG_MASK(SENS_SAR_MEAS1_CTRL2_REG, SENS_MEAS1_START_SAR);
+    while (!REG_GET_FIELD(SENS_SAR_MEAS1_CTRL2_REG, SENS_MEAS1_DONE_SAR)) {
+    }
+    return REG_GET_FIELD(SENS_SAR_MEAS1_CTRL2_REG, SENS_MEAS1_DATA_SAR);
+}
+
+int main(void)
+{
+    // restarted by the ULP timer, nothing to do until the main CPU arms it
+    if (!armed) {
+        ulp_riscv_shutdown();
+    }
+    REG_SET_FIELD(SENS_SAR_MEAS1_CTRL2_REG, SENS_SAR1_EN_PAD, 1 << channel);
+
+    int32_t dc = adc_read() << DC_SHIFT;
+    int settle = SETTLE;
+    int run = 0;
+    noise_floor = 0;
+    uint32_t next = cycles();
+    while (armed) {
+        uint32_t energy = 0;
+        int zc = 0;
+        int sign = 1;
+        for (int n = 0; n < ULP_VAD_FRAME; n++) {
+            next += period;
+            while ((int32_t)(cycles() - next) < 0) {
+            }
+            int x = adc_read();
+            ring[pos] = x;
+            pos = (pos + 1) & (ULP_VAD_RING - 1);
+            dc += x - (dc >> DC_SHIFT);
+            int y = x - (dc >> DC_SHIFT);
+            energy += (uint32_t)(y * y) >> 8;
+            if (sign < 0 ? y > ZC_BAND : y < -ZC_BAND) {
+                sign = -sign;
+                zc++;
+            }
+        }
+        if ((int32_t)(cycles() - next) > (int32_t)period) {
+            late++;
+            next = cycles();
+        }
+        frames++;
+        energy /= ULP_VAD_FRAME;
+        if (settle) {
+            settle--;
+            noise_floor = energy > FLOOR_MIN ? energy : FLOOR_MIN;
+            continue;
+        }
+        if (energy > noise_floor * ratio && zc >= (int)zc_min && zc <= (int)zc_max) {
+            run++;
+        } else {
+            run = 0;
+        }
+        // speech keeps the floor where it was, so a long word does not raise it
+        if (energy < noise_floor) {
+            noise_floor = energy > FLOOR_MIN ? energy : FLOOR_MIN;
+        } else if (!run) {
+            noise_floor += (noise_floor >> FLOOR_SHIFT) + 1;
+        }
+        if (run >= (int)onset) {
+            wake_pos = pos;
+            wakes++;
+            armed = 0;
+            ulp_riscv_wakeup_main_processor();
+        }
+    }
+    ulp_riscv_shutdown();
+    return 0;
+}
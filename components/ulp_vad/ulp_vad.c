@@ -0,0 +1,121 @@
+#include <stdio.h>
+#include <string.h>
+#include "esp_log.h"
+#include "esp_sleep.h"
+#include "driver/adc.h"
+#include "soc/rtc.h"
+#include "esp32s2/ulp.h"
+#include "esp32s2/ulp_riscv.h"
+#include "ulp_vad_main.h"
+#include "ulp_vad.h"
+
+static const char *TAG = "ulp_vad";
+
+#define ULP_VAD_RESTART_US  10000   // an idle ULP looks for the arm flag this often
+
+extern const uint8_t ulp_vad_bin_start[] asm("_binary_ulp_vad_main_bin_start");
+extern const uint8_t ulp_vad_bin_end[]   asm("_binary_ulp_vad_main_bin_end");
+
+static int ulp_vad_ready;
+
+// ULP cycles per sample, the ULP-RISC-V runs from RTC_FAST_CLK, the 8MHz RC oscillator, which is off by a few percent
+static uint32_t ulp_vad_period(void)
+{
+    uint32_t cal = rtc_clk_cal(RTC_CAL_8MD256, 100);
+    uint64_t hz = (uint64_t)256 * 1000000 * (1 << RTC_CLK_CAL_FRACT) / cal;
+    return hz / ULP_VAD_RATE;
+}
+
+int ulp_vad_init(const ulp_vad_config_t *config)
+{
+    if (config->adc1_channel < 0 || config->adc1_channel >= ADC1_CHANNEL_MAX) {
+        ESP_LOGE(TAG, "adc1 channel %d error\n", config->adc1_channel);
+        return -1;
+    }
+    adc1_config_width(ADC_WIDTH_BIT_13);
+    adc1_config_channel_atten(config->adc1_channel, ADC_ATTEN_DB_11);
+    // one conversion leaves ADC1 under the RTC controller, which the ULP then drives
+    adc1_get_raw(config->adc1_channel);
+    adc_power_on();
+
+    esp_err_t ret = ulp_riscv_load_binary(ulp_vad_bin_start, ulp_vad_bin_end - ulp_vad_bin_start);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "ulp load error: %s\n", esp_err_to_name(ret));
+        return -1;
+    }
+    ulp_armed = 0;
+    ulp_channel = config->adc1_channel;
+    ulp_period = ulp_vad_period();
+    ulp_ratio = config->ratio ? config->ratio : 8;
+    ulp_onset = config->onset_frames ? config->onset_frames : 3;
+    ulp_zc_min = config->zc_min ? config->zc_min : 4;
+    ulp_zc_max = config->zc_max ? config->zc_max : 60;
+    ulp_set_wakeup_period(0, ULP_VAD_RESTART_US);
+    ret = ulp_riscv_run();
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "ulp run error: %s\n", esp_err_to_name(ret));
+        return -1;
+    }
+    ulp_vad_ready = 1;
+    ESP_LOGI(TAG, "adc1 channel %d, %u ulp cycles a sample\n", config->adc1_channel, ulp_period);
+    return 0;
+}
+
+int ulp_vad_sleep(void)
+{
+    if (!ulp_vad_ready) {
+        ESP_LOGE(TAG, "not initialized\n");
+        return -1;
+    }
+    // the SAR ADC is an RTC peripheral, it has to stay powered while the CPU sleeps
+    esp_sleep_pd_config(ESP_PD_DOMAIN_RTC_PERIPH, ESP_PD_OPTION_ON);
+    esp_sleep_enable_ulp_wakeup();
+    ulp_armed = 1;
+    esp_light_sleep_start();
+    esp_sleep_wakeup_cause_t cause = esp_sleep_get_wakeup_cause();
+    if (cause == ESP_SLEEP_WAKEUP_COCPU || cause == ESP_SLEEP_WAKEUP_ULP) {
+        return 0;
+    }
+    // woken by something else, the ULP finishes its frame and goes idle
+    ulp_armed = 0;
+    return 1;
+}
+
+int ulp_vad_get_preroll(int16_t *pcm, int samples)
+{
+    const volatile int16_t *ring = (const volatile int16_t *)&ulp_ring;
+    int n = samples / 2 < ULP_VAD_RING ? samples / 2 : ULP_VAD_RING;
+    uint32_t start = (ulp_wake_pos - n) & (ULP_VAD_RING - 1);
+    int32_t sum = 0;
+
+    if (n <= 0) {
+        return 0;
+    }
+    for (int i = 0; i < n; i++) {
+        sum += ring[(start + i) & (ULP_VAD_RING - 1)];
+    }
+    int32_t dc = sum / n;
+    // 13 bit ADC to 16 bit, and every other sample interpolated to 16kHz
+    int32_t prev = (ring[start] - dc) << 3;
+    for (int i = 0; i < n; i++) {
+        int32_t y = (ring[(start + i) & (ULP_VAD_RING - 1)] - dc) << 3;
+        y = y > INT16_MAX ? INT16_MAX : (y < INT16_MIN ? INT16_MIN : y);
+        pcm[2 * i] = (prev + y) / 2;
+        pcm[2 * i + 1] = y;
+        prev = y;
+    }
+    return 2 * n;
+}
+
+void ulp_vad_get_stats(uint32_t *frames, uint32_t *wakes, uint32_t *floor)
+{
+    if (frames) {
+        *frames = ulp_frames;
+    }
+    if (wakes) {
+        *wakes = ulp_wakes;
+    }
+    if (floor) {
+        *floor = ulp_noise_floor;
+    }
+}
@@ -1,33 +0,0 @@
-#pragma once
-
-#include <stdio.h>
-#include <stdint.h>
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-#define SCCB_ID   			0X60  			//OV2640的ID
-
-void SCCB_Init(void);
-uint8_t SCCB_WR_Byte(uint8_t dat);
-uint8_t SCCB_RD_Byte(void);
-uint8_t SCCB_WR_Reg(uint8_t reg, uint8_t data);
-uint8_t SCCB_RD_Reg(uint8_t reg);
-
-#ifdef __cplusplus
-}
-#endif
-
-
-
-
-
-
-
-
-
-
-
-
-
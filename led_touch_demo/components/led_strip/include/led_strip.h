@@ -31,6 +31,12 @@ typedef struct led_strip_s led_strip_t;
 */
 typedef void *led_strip_dev_t;
 
+/**
+* @brief Called from the interrupt when a frame of refresh_async has been sent, keep it short
+*
+*/
+typedef void (*led_strip_done_cb_t)(led_strip_t *strip, void *arg);
+
 /**
 * @brief Declare of LED Strip Type
 *
@@ -68,6 +74,25 @@ struct led_strip_s {
     */
     esp_err_t (*refresh)(led_strip_t *strip, uint32_t timeout_ms);
 
+    /**
+    * @brief Start sending the colors in memory and return, the next frame can be set meanwhile
+    *
+    * @param strip: LED strip
+    * @param timeout_ms: longest wait for the previous frame to be sent
+    * @param done_cb: called when this frame has been sent, can be NULL
+    * @param arg: argument of done_cb
+    *
+    * @return
+    *      - ESP_OK: The frame is on its way
+    *      - ESP_ERR_TIMEOUT: The previous frame is still being sent
+    *      - ESP_FAIL: Refresh failed because some other error occurred
+    *
+    * @note:
+    *      set_pixel writes a second buffer that starts as a copy of the frame sent, so frame N+1 can be
+    *      drawn while frame N is on the wire.
+    */
+    esp_err_t (*refresh_async)(led_strip_t *strip, uint32_t timeout_ms, led_strip_done_cb_t done_cb, void *arg);
+
     /**
     * @brief Clear LED strip (turn off all LEDs)
     *
@@ -121,6 +146,53 @@ typedef struct {
 */
 led_strip_t *led_strip_new_rmt_ws2812(const led_strip_config_t *config);
 
+#define LED_STRIP_MULTI_MAX (8) /*!< Channels of one multi-channel strip */
+
+/**
+* @brief Multi-channel LED Strip Configuration Type
+*
+*/
+typedef struct {
+    uint32_t max_leds;                          /*!< LEDs of the whole strip, split evenly over the devices */
+    uint32_t dev_num;                           /*!< Number of devices, up to LED_STRIP_MULTI_MAX */
+    led_strip_dev_t devs[LED_STRIP_MULTI_MAX];  /*!< RMT channel of each part, in pixel order */
+} led_strip_multi_config_t;
+
+/**
+* @brief Install a ws2812 driver that sends one logical strip over several RMT channels at once
+*
+* @param config: LED strip configuration, every channel configured and its RMT driver installed
+* @return
+*      LED strip instance or NULL
+*
+* @note:
+*      Pixel i goes to channel i / ceil(max_leds / dev_num). A refresh starts all channels together, in one
+*      RMT group when the chip has one, and completes when the last one is sent, so a refresh takes about the
+*      time of one part.
+*/
+led_strip_t *led_strip_new_rmt_ws2812_multi(const led_strip_multi_config_t *config);
+
+/**
+* @brief Bytes a ws2812 SPI transfer of leds takes, the least max_transfer_sz of the bus
+*
+*/
+#define LED_STRIP_SPI_WS2812_BYTES(leds) (4 + (leds) * 9 + 90)
+
+/**
+* @brief Install a ws2812 driver that sends the strip as the MOSI line of a SPI bus
+*
+* @param config: LED strip configuration, dev is the spi_host_device_t of a bus initialized with DMA, the strip
+*                on its MOSI pin and max_transfer_sz of at least LED_STRIP_SPI_WS2812_BYTES(max_leds)
+* @return
+*      LED strip instance or NULL
+*
+* @note:
+*      Every ws2812 bit is three SPI bits at 2.5MHz, 100 for a 0 and 110 for a 1, looked up per byte when the
+*      pixel is set. A refresh is one DMA transfer of the whole strip with a single interrupt at its end, the
+*      strip length is only bounded by DMA capable memory, 18 bytes per LED. The bus is taken by the strip.
+*/
+led_strip_t *led_strip_new_spi_ws2812(const led_strip_config_t *config);
+
 #ifdef __cplusplus
 }
 #endif
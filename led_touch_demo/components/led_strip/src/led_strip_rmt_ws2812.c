@@ -16,6 +16,9 @@
 #include <sys/cdefs.h>
 #include "esp_log.h"
 #include "esp_attr.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
 #include "led_strip.h"
 #include "driver/rmt.h"
 
@@ -42,13 +45,29 @@ static uint32_t ws2812_t1h_ticks = 0;
 static uint32_t ws2812_t0l_ticks = 0;
 static uint32_t ws2812_t1l_ticks = 0;
 
+// RMT items of every nibble, MSB first, filled once the counter clock is known
+static DRAM_ATTR uint32_t ws2812_nibble_items[16][4];
+
+/*
+ * set_pixel writes the back buffer while the front one is on the wire. A refresh waits for the front
+ * to be sent, swaps the two and starts the new front, after copying it to the back so the next frame
+ * starts from what is shown
+ */
 typedef struct {
     led_strip_t parent;
     rmt_channel_t rmt_channel;
     uint32_t strip_len;
+    SemaphoreHandle_t idle;         // given while nothing is sent
+    led_strip_done_cb_t done_cb;
+    void *done_arg;
+    uint8_t *front;
+    uint8_t *back;
     uint8_t buffer[0];
 } ws2812_t;
 
+// the RMT driver has one end callback for all channels
+static ws2812_t *ws2812_channels[RMT_CHANNEL_MAX];
+
 /**
  * @brief Conver RGB data to RMT format.
  *
@@ -69,23 +88,23 @@ static void IRAM_ATTR ws2812_rmt_adapter(const void *src, rmt_item32_t *dest, si
         *item_num = 0;
         return;
     }
-    const rmt_item32_t bit0 = {{{ ws2812_t0h_ticks, 1, ws2812_t0l_ticks, 0 }}}; //Logical 0
-    const rmt_item32_t bit1 = {{{ ws2812_t1h_ticks, 1, ws2812_t1l_ticks, 0 }}}; //Logical 1
     size_t size = 0;
     size_t num = 0;
-    uint8_t *psrc = (uint8_t *)src;
-    rmt_item32_t *pdest = dest;
+    const uint8_t *psrc = (const uint8_t *)src;
+    uint32_t *pdest = (uint32_t *)dest;
     while (size < src_size && num < wanted_num) {
-        for (int i = 0; i < 8; i++) {
-            // MSB first
-            if (*psrc & (1 << (7 - i))) {
-                pdest->val =  bit1.val;
-            } else {
-                pdest->val =  bit0.val;
-            }
-            num++;
-            pdest++;
-        }
+        const uint32_t *hi = ws2812_nibble_items[*psrc >> 4];
+        const uint32_t *lo = ws2812_nibble_items[*psrc & 0x0F];
+        pdest[0] = hi[0];
+        pdest[1] = hi[1];
+        pdest[2] = hi[2];
+        pdest[3] = hi[3];
+        pdest[4] = lo[0];
+        pdest[5] = lo[1];
+        pdest[6] = lo[2];
+        pdest[7] = lo[3];
+        pdest += 8;
+        num += 8;
         size++;
         psrc++;
     }
@@ -93,6 +112,24 @@ static void IRAM_ATTR ws2812_rmt_adapter(const void *src, rmt_item32_t *dest, si
     *item_num = num;
 }
 
+static void IRAM_ATTR ws2812_tx_end(rmt_channel_t channel, void *arg)
+{
+    ws2812_t *ws2812 = ws2812_channels[channel];
+    BaseType_t task_awoken = pdFALSE;
+
+    if (ws2812 == NULL) {
+        return;
+    }
+    led_strip_done_cb_t done_cb = ws2812->done_cb;
+    xSemaphoreGiveFromISR(ws2812->idle, &task_awoken);
+    if (done_cb) {
+        done_cb(&ws2812->parent, ws2812->done_arg);
+    }
+    if (task_awoken == pdTRUE) {
+        portYIELD_FROM_ISR();
+    }
+}
+
 static esp_err_t ws2812_set_pixel(led_strip_t *strip, uint32_t index, uint32_t red, uint32_t green, uint32_t blue)
 {
     esp_err_t ret = ESP_OK;
@@ -100,36 +137,70 @@ static esp_err_t ws2812_set_pixel(led_strip_t *strip, uint32_t index, uint32_t r
     STRIP_CHECK(index < ws2812->strip_len, "index out of the maximum number of leds", err, ESP_ERR_INVALID_ARG);
     uint32_t start = index * 3;
     // In thr order of GRB
-    ws2812->buffer[start + 0] = green & 0xFF;
-    ws2812->buffer[start + 1] = red & 0xFF;
-    ws2812->buffer[start + 2] = blue & 0xFF;
+    ws2812->back[start + 0] = green & 0xFF;
+    ws2812->back[start + 1] = red & 0xFF;
+    ws2812->back[start + 2] = blue & 0xFF;
     return ESP_OK;
 err:
     return ret;
 }
 
-static esp_err_t ws2812_refresh(led_strip_t *strip, uint32_t timeout_ms)
+static esp_err_t ws2812_refresh_async(led_strip_t *strip, uint32_t timeout_ms, led_strip_done_cb_t done_cb, void *arg)
 {
     esp_err_t ret = ESP_OK;
     ws2812_t *ws2812 = __containerof(strip, ws2812_t, parent);
-    STRIP_CHECK(rmt_write_sample(ws2812->rmt_channel, ws2812->buffer, ws2812->strip_len * 3, true) == ESP_OK,
-                "transmit RMT samples failed", err, ESP_FAIL);
-    return rmt_wait_tx_done(ws2812->rmt_channel, pdMS_TO_TICKS(timeout_ms));
+    STRIP_CHECK(xSemaphoreTake(ws2812->idle, pdMS_TO_TICKS(timeout_ms)) == pdTRUE,
+                "previous frame still sending", err, ESP_ERR_TIMEOUT);
+
+    uint8_t *front = ws2812->back;
+    ws2812->back = ws2812->front;
+    ws2812->front = front;
+    memcpy(ws2812->back, ws2812->front, ws2812->strip_len * 3);
+    ws2812->done_cb = done_cb;
+    ws2812->done_arg = arg;
+    if (rmt_write_sample(ws2812->rmt_channel, ws2812->front, ws2812->strip_len * 3, false) != ESP_OK) {
+        xSemaphoreGive(ws2812->idle);
+        STRIP_CHECK(0, "transmit RMT samples failed", err, ESP_FAIL);
+    }
+    return ESP_OK;
 err:
     return ret;
 }
 
+static esp_err_t ws2812_refresh(led_strip_t *strip, uint32_t timeout_ms)
+{
+    esp_err_t ret = ESP_OK;
+    ws2812_t *ws2812 = __containerof(strip, ws2812_t, parent);
+    TickType_t start = xTaskGetTickCount();
+    ret = ws2812_refresh_async(strip, timeout_ms, NULL, NULL);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    // what is left of the timeout for this frame
+    TickType_t spent = xTaskGetTickCount() - start;
+    TickType_t ticks = pdMS_TO_TICKS(timeout_ms);
+    if (xSemaphoreTake(ws2812->idle, ticks > spent ? ticks - spent : 0) != pdTRUE) {
+        return ESP_ERR_TIMEOUT;
+    }
+    xSemaphoreGive(ws2812->idle);
+    return ESP_OK;
+}
+
 static esp_err_t ws2812_clear(led_strip_t *strip, uint32_t timeout_ms)
 {
     ws2812_t *ws2812 = __containerof(strip, ws2812_t, parent);
     // Write zero to turn off all leds
-    memset(ws2812->buffer, 0, ws2812->strip_len * 3);
+    memset(ws2812->back, 0, ws2812->strip_len * 3);
     return ws2812_refresh(strip, timeout_ms);
 }
 
 static esp_err_t ws2812_del(led_strip_t *strip)
 {
     ws2812_t *ws2812 = __containerof(strip, ws2812_t, parent);
+    // the front buffer may still be on the wire
+    xSemaphoreTake(ws2812->idle, portMAX_DELAY);
+    ws2812_channels[ws2812->rmt_channel] = NULL;
+    vSemaphoreDelete(ws2812->idle);
     free(ws2812);
     return ESP_OK;
 }
@@ -139,8 +210,8 @@ led_strip_t *led_strip_new_rmt_ws2812(const led_strip_config_t *config)
     led_strip_t *ret = NULL;
     STRIP_CHECK(config, "configuration can't be null", err, NULL);
 
-    // 24 bits per led
-    uint32_t ws2812_size = sizeof(ws2812_t) + config->max_leds * 3;
+    // 24 bits per led, front and back
+    uint32_t ws2812_size = sizeof(ws2812_t) + config->max_leds * 3 * 2;
     ws2812_t *ws2812 = calloc(1, ws2812_size);
     STRIP_CHECK(ws2812, "request memory for ws2812 failed", err, NULL);
 
@@ -154,14 +225,33 @@ led_strip_t *led_strip_new_rmt_ws2812(const led_strip_config_t *config)
     ws2812_t1h_ticks = (uint32_t)(ratio * WS2812_T1H_NS);
     ws2812_t1l_ticks = (uint32_t)(ratio * WS2812_T1L_NS);
 
+    const rmt_item32_t bit0 = {{{ ws2812_t0h_ticks, 1, ws2812_t0l_ticks, 0 }}}; //Logical 0
+    const rmt_item32_t bit1 = {{{ ws2812_t1h_ticks, 1, ws2812_t1l_ticks, 0 }}}; //Logical 1
+    for (int n = 0; n < 16; n++) {
+        for (int i = 0; i < 4; i++) {
+            ws2812_nibble_items[n][i] = (n & (1 << (3 - i))) ? bit1.val : bit0.val;
+        }
+    }
+
     // set ws2812 to rmt adapter
     rmt_translator_init((rmt_channel_t)config->dev, ws2812_rmt_adapter);
 
+    ws2812->idle = xSemaphoreCreateBinary();
+    if (ws2812->idle == NULL) {
+        free(ws2812);
+        STRIP_CHECK(0, "create semaphore failed", err, NULL);
+    }
+    xSemaphoreGive(ws2812->idle);
     ws2812->rmt_channel = (rmt_channel_t)config->dev;
     ws2812->strip_len = config->max_leds;
+    ws2812->front = ws2812->buffer;
+    ws2812->back = ws2812->buffer + config->max_leds * 3;
+    ws2812_channels[ws2812->rmt_channel] = ws2812;
+    rmt_register_tx_end_callback(ws2812_tx_end, NULL);
 
     ws2812->parent.set_pixel = ws2812_set_pixel;
     ws2812->parent.refresh = ws2812_refresh;
+    ws2812->parent.refresh_async = ws2812_refresh_async;
     ws2812->parent.clear = ws2812_clear;
     ws2812->parent.del = ws2812_del;
 
@@ -169,3 +259,178 @@ led_strip_t *led_strip_new_rmt_ws2812(const led_strip_config_t *config)
 err:
     return ret;
 }
+
+/*
+ * One ws2812_t per channel, the parts are only reached through the multi strip, a part refreshed
+ * on its own would wait for the others of its group forever
+ */
+typedef struct {
+    led_strip_t parent;
+    uint32_t part_num;
+    uint32_t part_len;
+    led_strip_t *parts[LED_STRIP_MULTI_MAX];
+    SemaphoreHandle_t idle;
+    portMUX_TYPE lock;
+    uint32_t pending;               // parts still sending, and one while they are started
+    led_strip_done_cb_t done_cb;
+    void *done_arg;
+} ws2812_multi_t;
+
+#if defined(SOC_RMT_SUPPORT_TX_GROUP) || defined(SOC_RMT_SUPPORT_TX_SYNCHRO)
+#define WS2812_MULTI_SYNC 1
+#endif
+
+static void IRAM_ATTR ws2812_multi_done(ws2812_multi_t *multi, uint32_t count)
+{
+    BaseType_t task_awoken = pdFALSE;
+
+    portENTER_CRITICAL_SAFE(&multi->lock);
+    multi->pending -= count;
+    uint32_t pending = multi->pending;
+    portEXIT_CRITICAL_SAFE(&multi->lock);
+    if (pending) {
+        return;
+    }
+    led_strip_done_cb_t done_cb = multi->done_cb;
+    if (xPortInIsrContext()) {
+        xSemaphoreGiveFromISR(multi->idle, &task_awoken);
+    } else {
+        xSemaphoreGive(multi->idle);
+    }
+    if (done_cb) {
+        done_cb(&multi->parent, multi->done_arg);
+    }
+    if (task_awoken == pdTRUE) {
+        portYIELD_FROM_ISR();
+    }
+}
+
+static void IRAM_ATTR ws2812_multi_part_done(led_strip_t *part, void *arg)
+{
+    ws2812_multi_done((ws2812_multi_t *)arg, 1);
+}
+
+static esp_err_t ws2812_multi_set_pixel(led_strip_t *strip, uint32_t index, uint32_t red, uint32_t green, uint32_t blue)
+{
+    esp_err_t ret = ESP_OK;
+    ws2812_multi_t *multi = __containerof(strip, ws2812_multi_t, parent);
+    uint32_t part = index / multi->part_len;
+    STRIP_CHECK(part < multi->part_num, "index out of the maximum number of leds", err, ESP_ERR_INVALID_ARG);
+    return ws2812_set_pixel(multi->parts[part], index % multi->part_len, red, green, blue);
+err:
+    return ret;
+}
+
+static esp_err_t ws2812_multi_refresh_async(led_strip_t *strip, uint32_t timeout_ms, led_strip_done_cb_t done_cb, void *arg)
+{
+    esp_err_t ret = ESP_OK;
+    ws2812_multi_t *multi = __containerof(strip, ws2812_multi_t, parent);
+    STRIP_CHECK(xSemaphoreTake(multi->idle, pdMS_TO_TICKS(timeout_ms)) == pdTRUE,
+                "previous frame still sending", err, ESP_ERR_TIMEOUT);
+
+    multi->done_cb = done_cb;
+    multi->done_arg = arg;
+    multi->pending = multi->part_num + 1;
+    uint32_t failed = 0;
+    for (int i = 0; i < multi->part_num; i++) {
+        // the parts are idle once the multi strip is
+        if (ws2812_refresh_async(multi->parts[i], 0, ws2812_multi_part_done, multi) != ESP_OK) {
+            failed++;
+        }
+    }
+    ws2812_multi_done(multi, 1 + failed);
+    STRIP_CHECK(failed == 0, "%d of %d parts not sent", err, ESP_FAIL, failed, multi->part_num);
+    return ESP_OK;
+err:
+    return ret;
+}
+
+static esp_err_t ws2812_multi_refresh(led_strip_t *strip, uint32_t timeout_ms)
+{
+    esp_err_t ret = ESP_OK;
+    ws2812_multi_t *multi = __containerof(strip, ws2812_multi_t, parent);
+    TickType_t start = xTaskGetTickCount();
+    ret = ws2812_multi_refresh_async(strip, timeout_ms, NULL, NULL);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    TickType_t spent = xTaskGetTickCount() - start;
+    TickType_t ticks = pdMS_TO_TICKS(timeout_ms);
+    if (xSemaphoreTake(multi->idle, ticks > spent ? ticks - spent : 0) != pdTRUE) {
+        return ESP_ERR_TIMEOUT;
+    }
+    xSemaphoreGive(multi->idle);
+    return ESP_OK;
+}
+
+static esp_err_t ws2812_multi_clear(led_strip_t *strip, uint32_t timeout_ms)
+{
+    ws2812_multi_t *multi = __containerof(strip, ws2812_multi_t, parent);
+    for (int i = 0; i < multi->part_num; i++) {
+        ws2812_t *ws2812 = __containerof(multi->parts[i], ws2812_t, parent);
+        memset(ws2812->back, 0, ws2812->strip_len * 3);
+    }
+    return ws2812_multi_refresh(strip, timeout_ms);
+}
+
+static esp_err_t ws2812_multi_del(led_strip_t *strip)
+{
+    ws2812_multi_t *multi = __containerof(strip, ws2812_multi_t, parent);
+    if (multi->idle) {
+        xSemaphoreTake(multi->idle, portMAX_DELAY);
+        vSemaphoreDelete(multi->idle);
+    }
+    for (int i = 0; i < multi->part_num; i++) {
+        if (multi->parts[i] == NULL) {
+            continue;
+        }
+#ifdef WS2812_MULTI_SYNC
+        rmt_remove_channel_from_group(__containerof(multi->parts[i], ws2812_t, parent)->rmt_channel);
+#endif
+        ws2812_del(multi->parts[i]);
+    }
+    free(multi);
+    return ESP_OK;
+}
+
+led_strip_t *led_strip_new_rmt_ws2812_multi(const led_strip_multi_config_t *config)
+{
+    led_strip_t *ret = NULL;
+    STRIP_CHECK(config && config->dev_num > 0 && config->dev_num <= LED_STRIP_MULTI_MAX && config->max_leds > 0,
+                "bad configuration", err, NULL);
+    ws2812_multi_t *multi = calloc(1, sizeof(ws2812_multi_t));
+    STRIP_CHECK(multi, "request memory for ws2812 failed", err, NULL);
+
+    multi->part_len = (config->max_leds + config->dev_num - 1) / config->dev_num;
+    multi->part_num = (config->max_leds + multi->part_len - 1) / multi->part_len;
+    multi->lock = (portMUX_TYPE)portMUX_INITIALIZER_UNLOCKED;
+    multi->parent.set_pixel = ws2812_multi_set_pixel;
+    multi->parent.refresh = ws2812_multi_refresh;
+    multi->parent.refresh_async = ws2812_multi_refresh_async;
+    multi->parent.clear = ws2812_multi_clear;
+    multi->parent.del = ws2812_multi_del;
+
+    for (int i = 0; i < multi->part_num; i++) {
+        uint32_t first = i * multi->part_len;
+        led_strip_config_t part_config = LED_STRIP_DEFAULT_CONFIG(config->max_leds - first < multi->part_len ?
+                                         config->max_leds - first : multi->part_len, config->devs[i]);
+        multi->parts[i] = led_strip_new_rmt_ws2812(&part_config);
+        if (multi->parts[i] == NULL) {
+            ws2812_multi_del(&multi->parent);
+            STRIP_CHECK(0, "install part %d failed", err, NULL, i);
+        }
+#ifdef WS2812_MULTI_SYNC
+        // the channels of a group start when the last of them is started
+        rmt_add_channel_to_group((rmt_channel_t)config->devs[i]);
+#endif
+    }
+    multi->idle = xSemaphoreCreateBinary();
+    if (multi->idle == NULL) {
+        ws2812_multi_del(&multi->parent);
+        STRIP_CHECK(0, "create semaphore failed", err, NULL);
+    }
+    xSemaphoreGive(multi->idle);
+    return &multi->parent;
+err:
+    return ret;
+}
@@ -0,0 +1,226 @@
+// Copyright 2019 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <stdlib.h>
+#include <string.h>
+#include <sys/cdefs.h>
+#include "esp_log.h"
+#include "esp_attr.h"
+#include "esp_heap_caps.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "led_strip.h"
+#include "driver/spi_master.h"
+
+static const char *TAG = "ws2812_spi";
+#define STRIP_CHECK(a, str, goto_tag, ret_value, ...)                             \
+    do                                                                            \
+    {                                                                             \
+        if (!(a))                                                                 \
+        {                                                                         \
+            ESP_LOGE(TAG, "%s(%d): " str, __FUNCTION__, __LINE__, ##__VA_ARGS__); \
+            ret = ret_value;                                                      \
+            goto goto_tag;                                                        \
+        }                                                                         \
+    } while (0)
+
+// 400ns per SPI bit: a 0 is 400ns high and 800ns low, a 1 800ns high and 400ns low
+#define WS2812_SPI_CLOCK_HZ (2500000)
+#define WS2812_SPI_LEAD     (4)     // low bytes before the first bit, MOSI may idle high
+#define WS2812_SPI_RESET    (90)    // low bytes after the last bit, 288us
+
+// SPI bytes of every color byte, MSB first
+static uint8_t ws2812_spi_lut[256][3];
+
+/*
+ * The frames are kept encoded, set_pixel writes 9 bytes of the back buffer while the front one is on
+ * the wire. A refresh waits for the front to be sent, swaps the two and queues the new front, after
+ * copying it to the back so the next frame starts from what is shown
+ */
+typedef struct {
+    led_strip_t parent;
+    spi_device_handle_t spi;
+    uint32_t strip_len;
+    uint32_t frame_len;
+    SemaphoreHandle_t idle;         // given while nothing is sent
+    led_strip_done_cb_t done_cb;
+    void *done_arg;
+    spi_transaction_t trans;
+    uint8_t *front;
+    uint8_t *back;
+} ws2812_spi_t;
+
+static void IRAM_ATTR ws2812_spi_tx_end(spi_transaction_t *trans)
+{
+    ws2812_spi_t *ws2812 = trans->user;
+    BaseType_t task_awoken = pdFALSE;
+
+    led_strip_done_cb_t done_cb = ws2812->done_cb;
+    xSemaphoreGiveFromISR(ws2812->idle, &task_awoken);
+    if (done_cb) {
+        done_cb(&ws2812->parent, ws2812->done_arg);
+    }
+    if (task_awoken == pdTRUE) {
+        portYIELD_FROM_ISR();
+    }
+}
+
+static esp_err_t ws2812_spi_set_pixel(led_strip_t *strip, uint32_t index, uint32_t red, uint32_t green, uint32_t blue)
+{
+    esp_err_t ret = ESP_OK;
+    ws2812_spi_t *ws2812 = __containerof(strip, ws2812_spi_t, parent);
+    STRIP_CHECK(index < ws2812->strip_len, "index out of the maximum number of leds", err, ESP_ERR_INVALID_ARG);
+    uint8_t *dst = ws2812->back + WS2812_SPI_LEAD + index * 9;
+    // In the order of GRB
+    memcpy(dst + 0, ws2812_spi_lut[green & 0xFF], 3);
+    memcpy(dst + 3, ws2812_spi_lut[red & 0xFF], 3);
+    memcpy(dst + 6, ws2812_spi_lut[blue & 0xFF], 3);
+    return ESP_OK;
+err:
+    return ret;
+}
+
+static esp_err_t ws2812_spi_refresh_async(led_strip_t *strip, uint32_t timeout_ms, led_strip_done_cb_t done_cb, void *arg)
+{
+    esp_err_t ret = ESP_OK;
+    ws2812_spi_t *ws2812 = __containerof(strip, ws2812_spi_t, parent);
+    STRIP_CHECK(xSemaphoreTake(ws2812->idle, pdMS_TO_TICKS(timeout_ms)) == pdTRUE,
+                "previous frame still sending", err, ESP_ERR_TIMEOUT);
+
+    // the result of the previous frame, queued with no wait so it is back by now
+    spi_transaction_t *done;
+    spi_device_get_trans_result(ws2812->spi, &done, 0);
+
+    uint8_t *front = ws2812->back;
+    ws2812->back = ws2812->front;
+    ws2812->front = front;
+    memcpy(ws2812->back, ws2812->front, ws2812->frame_len);
+    ws2812->done_cb = done_cb;
+    ws2812->done_arg = arg;
+    ws2812->trans.length = ws2812->frame_len * 8;
+    ws2812->trans.tx_buffer = ws2812->front;
+    ws2812->trans.user = ws2812;
+    if (spi_device_queue_trans(ws2812->spi, &ws2812->trans, 0) != ESP_OK) {
+        xSemaphoreGive(ws2812->idle);
+        STRIP_CHECK(0, "queue SPI transfer failed", err, ESP_FAIL);
+    }
+    return ESP_OK;
+err:
+    return ret;
+}
+
+static esp_err_t ws2812_spi_refresh(led_strip_t *strip, uint32_t timeout_ms)
+{
+    esp_err_t ret = ESP_OK;
+    ws2812_spi_t *ws2812 = __containerof(strip, ws2812_spi_t, parent);
+    TickType_t start = xTaskGetTickCount();
+    ret = ws2812_spi_refresh_async(strip, timeout_ms, NULL, NULL);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    // what is left of the timeout for this frame
+    TickType_t spent = xTaskGetTickCount() - start;
+    TickType_t ticks = pdMS_TO_TICKS(timeout_ms);
+    if (xSemaphoreTake(ws2812->idle, ticks > spent ? ticks - spent : 0) != pdTRUE) {
+        return ESP_ERR_TIMEOUT;
+    }
+    xSemaphoreGive(ws2812->idle);
+    return ESP_OK;
+}
+
+static esp_err_t ws2812_spi_clear(led_strip_t *strip, uint32_t timeout_ms)
+{
+    ws2812_spi_t *ws2812 = __containerof(strip, ws2812_spi_t, parent);
+    // Write zero to turn off all leds
+    for (uint32_t i = 0; i < ws2812->strip_len; i++) {
+        ws2812_spi_set_pixel(strip, i, 0, 0, 0);
+    }
+    return ws2812_spi_refresh(strip, timeout_ms);
+}
+
+static esp_err_t ws2812_spi_del(led_strip_t *strip)
+{
+    ws2812_spi_t *ws2812 = __containerof(strip, ws2812_spi_t, parent);
+    if (ws2812->idle) {
+        // the front buffer may still be on the wire
+        xSemaphoreTake(ws2812->idle, portMAX_DELAY);
+        vSemaphoreDelete(ws2812->idle);
+    }
+    if (ws2812->spi) {
+        spi_transaction_t *done;
+        spi_device_get_trans_result(ws2812->spi, &done, 0);
+        spi_bus_remove_device(ws2812->spi);
+    }
+    heap_caps_free(ws2812->front);
+    heap_caps_free(ws2812->back);
+    free(ws2812);
+    return ESP_OK;
+}
+
+led_strip_t *led_strip_new_spi_ws2812(const led_strip_config_t *config)
+{
+    led_strip_t *ret = NULL;
+    STRIP_CHECK(config && config->max_leds > 0, "bad configuration", err, NULL);
+
+    ws2812_spi_t *ws2812 = calloc(1, sizeof(ws2812_spi_t));
+    STRIP_CHECK(ws2812, "request memory for ws2812 failed", err, NULL);
+
+    for (int n = 0; n < 256; n++) {
+        uint32_t bits = 0;
+        for (int i = 7; i >= 0; i--) {
+            bits = (bits << 3) | ((n & (1 << i)) ? 0x6 : 0x4);
+        }
+        ws2812_spi_lut[n][0] = bits >> 16;
+        ws2812_spi_lut[n][1] = bits >> 8;
+        ws2812_spi_lut[n][2] = bits;
+    }
+
+    ws2812->strip_len = config->max_leds;
+    ws2812->frame_len = LED_STRIP_SPI_WS2812_BYTES(config->max_leds);
+    // the lead and the reset stay zero, the pixels start off
+    ws2812->front = heap_caps_calloc(1, ws2812->frame_len, MALLOC_CAP_DMA);
+    ws2812->back = heap_caps_calloc(1, ws2812->frame_len, MALLOC_CAP_DMA);
+    ws2812->idle = xSemaphoreCreateBinary();
+    if (!ws2812->front || !ws2812->back || !ws2812->idle) {
+        ws2812_spi_del(&ws2812->parent);
+        STRIP_CHECK(0, "request memory for %u leds failed", err, NULL, config->max_leds);
+    }
+    xSemaphoreGive(ws2812->idle);
+
+    spi_device_interface_config_t dev_config = {
+        .clock_speed_hz = WS2812_SPI_CLOCK_HZ,
+        .mode = 0,
+        .spics_io_num = -1,
+        .queue_size = 1,
+        .post_cb = ws2812_spi_tx_end,
+    };
+    if (spi_bus_add_device((spi_host_device_t)config->dev, &dev_config, &ws2812->spi) != ESP_OK) {
+        ws2812->spi = NULL;
+        ws2812_spi_del(&ws2812->parent);
+        STRIP_CHECK(0, "add SPI device failed", err, NULL);
+    }
+    for (uint32_t i = 0; i < ws2812->strip_len; i++) {
+        ws2812_spi_set_pixel(&ws2812->parent, i, 0, 0, 0);
+    }
+
+    ws2812->parent.set_pixel = ws2812_spi_set_pixel;
+    ws2812->parent.refresh = ws2812_spi_refresh;
+    ws2812->parent.refresh_async = ws2812_spi_refresh_async;
+    ws2812->parent.clear = ws2812_spi_clear;
+    ws2812->parent.del = ws2812_spi_del;
+
+    return &ws2812->parent;
+err:
+    return ret;
+}
@@ -0,0 +1,357 @@
+/* LED feedback of the touch example
+
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+#include <string.h>
+#include <math.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_attr.h"
+#include "freertos/semphr.h"
+#include "led_effect.h"
+
+static const char *TAG = "LED effect";
+
+#define LED_EFFECT_QUEUE_LEN    8
+#define LED_EFFECT_GAMMA        2.2f
+
+typedef enum {
+    EFFECT_CMD_PLAY,
+    EFFECT_CMD_BRIGHTNESS,
+    EFFECT_CMD_SUSPEND,
+    EFFECT_CMD_RESUME,
+} led_effect_cmd_type_t;
+
+typedef struct {
+    led_effect_cmd_type_t type;
+    led_keyframe_t key;             // a single fade, when keys is NULL
+    const led_keyframe_t *keys;
+    int num;
+    bool loop;
+    uint8_t brightness;
+    int64_t touch_us;
+} led_effect_cmd_t;
+
+typedef struct {
+    led_strip_t *strip;
+    TaskHandle_t task;
+    esp_timer_handle_t timer;
+    bool running;                   // the timer
+    uint8_t lut[256];               // gamma and brightness
+    uint8_t brightness;
+    led_keyframe_t single;
+    const led_keyframe_t *keys;
+    int num;
+    int index;                      // the keyframe faded to, num when done
+    bool loop;
+    uint8_t from[3];
+    uint8_t color[3];               // before the table
+    int64_t key_start_us;
+    int64_t touch_us;               // waiting for its first frame
+} led_effect_t;
+
+// what suspend turned off, kept through deep sleep
+typedef struct {
+    bool valid;
+    uint8_t color[3];
+    uint8_t brightness;
+} led_effect_saved_t;
+
+static led_effect_t effect;
+static RTC_DATA_ATTR led_effect_saved_t effect_saved;
+static SemaphoreHandle_t effect_suspended = NULL;
+static QueueHandle_t que_effect = NULL;
+static led_effect_stats_t effect_stats;
+static portMUX_TYPE stats_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static void led_effect_build_lut(uint8_t brightness)
+{
+    effect.brightness = brightness;
+    for (int i = 0; i < 256; i++) {
+        effect.lut[i] = (uint8_t)(powf(i / 255.0f, LED_EFFECT_GAMMA) * brightness + 0.5f);
+    }
+}
+
+static void led_effect_timer_cb(void *arg)
+{
+    xTaskNotifyGive(effect.task);
+}
+
+static void led_effect_begin_key(int index, int64_t now)
+{
+    effect.index = index;
+    effect.key_start_us = now;
+    memcpy(effect.from, effect.color, sizeof(effect.from));
+}
+
+static void led_effect_apply(const led_effect_cmd_t *cmd, int64_t now)
+{
+    switch (cmd->type) {
+    case EFFECT_CMD_BRIGHTNESS:
+        led_effect_build_lut(cmd->brightness);
+        return;
+
+    case EFFECT_CMD_SUSPEND:
+        // stop where it is, the color is shown again as it was on resume
+        effect_saved.valid = true;
+        memcpy(effect_saved.color, effect.color, sizeof(effect_saved.color));
+        effect_saved.brightness = effect.brightness;
+        effect.index = effect.num;
+        memset(effect.color, 0, sizeof(effect.color));
+        return;
+
+    case EFFECT_CMD_RESUME:
+        if (effect_saved.valid) {
+            effect_saved.valid = false;
+            led_effect_build_lut(effect_saved.brightness);
+            memcpy(effect.color, effect_saved.color, sizeof(effect.color));
+            effect.index = effect.num;
+        }
+        return;
+
+    default:
+        break;
+    }
+    if (cmd->keys) {
+        effect.keys = cmd->keys;
+        effect.num = cmd->num;
+    } else {
+        effect.single = cmd->key;
+        effect.keys = &effect.single;
+        effect.num = 1;
+    }
+    effect.loop = cmd->loop;
+    if (cmd->touch_us) {
+        effect.touch_us = cmd->touch_us;
+    }
+    led_effect_begin_key(0, now);
+}
+
+/*
+ * Move the color to where the keyframes are at now. Returns false once the last one is reached
+ */
+static bool led_effect_advance(int64_t now)
+{
+    while (effect.index < effect.num) {
+        const led_keyframe_t *key = &effect.keys[effect.index];
+        const uint8_t to[3] = {key->red, key->green, key->blue};
+        int64_t elapsed = now - effect.key_start_us;
+        int64_t length = key->ms * 1000LL;
+
+        if (elapsed < length) {
+            for (int i = 0; i < 3; i++) {
+                effect.color[i] = effect.from[i] + (to[i] - effect.from[i]) * elapsed / length;
+            }
+            return true;
+        }
+        memcpy(effect.color, to, sizeof(effect.color));
+        int next = effect.index + 1;
+        if (next == effect.num && effect.loop) {
+            next = 0;
+        }
+        // the next key starts when this one ended, late frames do not stretch the animation
+        effect.key_start_us += length;
+        effect.index = next;
+        memcpy(effect.from, effect.color, sizeof(effect.from));
+        if (effect.loop && length == 0 && next == 0) {
+            // a loop of jumps only, hold the last color until the next frame
+            effect.key_start_us = now;
+            return true;
+        }
+    }
+    return false;
+}
+
+/*
+ * Returns false when the frame before is still on the wire, the frame is skipped
+ */
+static bool led_effect_draw(int64_t wake_us)
+{
+    led_strip_t *strip = effect.strip;
+
+    strip->set_pixel(strip, 0, effect.lut[effect.color[0]], effect.lut[effect.color[1]], effect.lut[effect.color[2]]);
+    esp_err_t ret = strip->refresh_async(strip, 0, NULL, NULL);
+    int64_t now = esp_timer_get_time();
+
+    portENTER_CRITICAL(&stats_lock);
+    if (ret == ESP_OK) {
+        effect_stats.frames++;
+        if (now - wake_us > effect_stats.max_frame_us) {
+            effect_stats.max_frame_us = now - wake_us;
+        }
+    } else {
+        effect_stats.overruns++;
+    }
+    if (ret == ESP_OK && effect.touch_us) {
+        int64_t latency = now - effect.touch_us;
+        effect_stats.count++;
+        effect_stats.last_us = latency;
+        if (latency > effect_stats.max_us) {
+            effect_stats.max_us = latency;
+        }
+        effect.touch_us = 0;
+    }
+    portEXIT_CRITICAL(&stats_lock);
+    return ret == ESP_OK;
+}
+
+static void led_effect_task(void *arg)
+{
+    led_effect_cmd_t cmd;
+    led_strip_t *strip = effect.strip;
+
+    // clear() would refresh as well, the first frame covers it
+    for (int i = 1; i < CONFIG_EXAMPLE_STRIP_LED_NUMBER; i++) {
+        strip->set_pixel(strip, i, 0, 0, 0);
+    }
+
+    while (1) {
+        // a command or a frame tick
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        int64_t now = esp_timer_get_time();
+        bool changed = false;
+
+        while (xQueueReceive(que_effect, &cmd, 0) == pdTRUE) {
+            led_effect_apply(&cmd, now);
+            changed = true;
+            if (cmd.type == EFFECT_CMD_SUSPEND) {
+                // off on the wire before the caller goes on
+                strip->set_pixel(strip, 0, 0, 0, 0);
+                strip->refresh(strip, 100);
+                xSemaphoreGive(effect_suspended);
+                changed = false;
+            }
+        }
+        bool moving = led_effect_advance(now);
+        if ((changed || effect.running) && !led_effect_draw(now)) {
+            // try again on the next tick
+            moving = true;
+        }
+
+        if (moving && !effect.running) {
+            effect.running = esp_timer_start_periodic(effect.timer, LED_EFFECT_FRAME_MS * 1000) == ESP_OK;
+        } else if (!moving && effect.running) {
+            esp_timer_stop(effect.timer);
+            effect.running = false;
+        }
+    }
+}
+
+static esp_err_t led_effect_post(const led_effect_cmd_t *cmd)
+{
+    if (que_effect == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (xQueueSend(que_effect, cmd, 0) != pdTRUE) {
+        ESP_LOGW(TAG, "command dropped");
+        return ESP_ERR_TIMEOUT;
+    }
+    xTaskNotifyGive(effect.task);
+    return ESP_OK;
+}
+
+esp_err_t led_effect_start(led_strip_t *strip, int priority)
+{
+    if (que_effect) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    effect.strip = strip;
+    led_effect_build_lut(255);
+
+    esp_timer_create_args_t timer_args = {
+        .callback = led_effect_timer_cb,
+        .name = "led_effect",
+    };
+    if (esp_timer_create(&timer_args, &effect.timer) != ESP_OK) {
+        return ESP_FAIL;
+    }
+    que_effect = xQueueCreate(LED_EFFECT_QUEUE_LEN, sizeof(led_effect_cmd_t));
+    effect_suspended = xSemaphoreCreateBinary();
+    if (que_effect == NULL || effect_suspended == NULL) {
+        if (que_effect) {
+            vQueueDelete(que_effect);
+            que_effect = NULL;
+        }
+        if (effect_suspended) {
+            vSemaphoreDelete(effect_suspended);
+            effect_suspended = NULL;
+        }
+        esp_timer_delete(effect.timer);
+        return ESP_ERR_NO_MEM;
+    }
+    if (xTaskCreate(&led_effect_task, "led_effect_task", 2048, NULL, priority, &effect.task) != pdPASS) {
+        vQueueDelete(que_effect);
+        que_effect = NULL;
+        esp_timer_delete(effect.timer);
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+esp_err_t led_effect_fade_to(uint8_t red, uint8_t green, uint8_t blue, uint32_t ms, int64_t touch_us)
+{
+    led_effect_cmd_t cmd = {
+        .type = EFFECT_CMD_PLAY,
+        .key = {red, green, blue, ms},
+        .touch_us = touch_us,
+    };
+    return led_effect_post(&cmd);
+}
+
+esp_err_t led_effect_play(const led_keyframe_t *keys, int num, bool loop, int64_t touch_us)
+{
+    if (keys == NULL || num <= 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    led_effect_cmd_t cmd = {
+        .type = EFFECT_CMD_PLAY,
+        .keys = keys,
+        .num = num,
+        .loop = loop,
+        .touch_us = touch_us,
+    };
+    return led_effect_post(&cmd);
+}
+
+esp_err_t led_effect_set_brightness(uint8_t brightness)
+{
+    led_effect_cmd_t cmd = {
+        .type = EFFECT_CMD_BRIGHTNESS,
+        .brightness = brightness,
+    };
+    return led_effect_post(&cmd);
+}
+
+esp_err_t led_effect_suspend(uint32_t timeout_ms)
+{
+    led_effect_cmd_t cmd = {
+        .type = EFFECT_CMD_SUSPEND,
+    };
+    esp_err_t ret = led_effect_post(&cmd);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    return xSemaphoreTake(effect_suspended, pdMS_TO_TICKS(timeout_ms)) == pdTRUE ? ESP_OK : ESP_ERR_TIMEOUT;
+}
+
+esp_err_t led_effect_resume(void)
+{
+    led_effect_cmd_t cmd = {
+        .type = EFFECT_CMD_RESUME,
+    };
+    return led_effect_post(&cmd);
+}
+
+void led_effect_get_stats(led_effect_stats_t *stats)
+{
+    portENTER_CRITICAL(&stats_lock);
+    *stats = effect_stats;
+    portEXIT_CRITICAL(&stats_lock);
+}
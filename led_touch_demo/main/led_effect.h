@@ -0,0 +1,84 @@
+/* LED feedback of the touch example
+
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "led_strip.h"
+
+/*
+ * The first LED of the strip is animated by its own task: the calls below only post a command and
+ * return, so a touch never waits on the strip. While a fade runs, a periodic timer wakes the task
+ * every LED_EFFECT_FRAME_MS, the color is computed from the time and drawn through one table that
+ * holds both the gamma curve and the brightness, then sent with refresh_async.
+ */
+
+#define LED_EFFECT_FRAME_MS     16      // about 60 FPS while something moves
+
+typedef struct {
+    uint8_t red;
+    uint8_t green;
+    uint8_t blue;
+    uint32_t ms;            // to fade from the color before, 0 to jump
+} led_keyframe_t;
+
+typedef struct {
+    uint32_t count;         // touches shown
+    int64_t last_us;        // from the touch to its first frame on the wire
+    int64_t max_us;
+    uint32_t frames;
+    uint32_t overruns;      // frames skipped, the one before was still being sent
+    int64_t max_frame_us;   // the longest a frame took to draw and start
+} led_effect_stats_t;
+
+/**
+ * @brief Start the task driving the first LED of the strip
+ */
+esp_err_t led_effect_start(led_strip_t *strip, int priority);
+
+/**
+ * @brief Fade the first LED to a color, all other LEDs stay off
+ *
+ * @param ms       0 shows it in the next frame
+ * @param touch_us esp_timer_get_time() of the touch, for the latency stats, 0 if none
+ */
+esp_err_t led_effect_fade_to(uint8_t red, uint8_t green, uint8_t blue, uint32_t ms, int64_t touch_us);
+
+static inline esp_err_t led_effect_show(uint8_t red, uint8_t green, uint8_t blue, int64_t touch_us)
+{
+    return led_effect_fade_to(red, green, blue, 0, touch_us);
+}
+
+/**
+ * @brief Run the keyframes one after the other, from the color shown
+ *
+ * @param keys Not copied, has to stay until the next command
+ * @param loop Start over after the last one, until the next command
+ */
+esp_err_t led_effect_play(const led_keyframe_t *keys, int num, bool loop, int64_t touch_us);
+
+/**
+ * @brief Scale every color, 255 is full, applied from the next frame
+ */
+esp_err_t led_effect_set_brightness(uint8_t brightness);
+
+/**
+ * @brief Turn the LED off before sleep, returns once the strip is off
+ *
+ *        The color and the brightness are kept in RTC memory, so they survive deep sleep as well.
+ */
+esp_err_t led_effect_suspend(uint32_t timeout_ms);
+
+/**
+ * @brief Show again what led_effect_suspend turned off, nothing if it was not called
+ */
+esp_err_t led_effect_resume(void);
+
+void led_effect_get_stats(led_effect_stats_t *stats);
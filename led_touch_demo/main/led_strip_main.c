@@ -15,19 +15,17 @@
 #include "soc/rtc_periph.h"
 #include "soc/sens_periph.h"
 #include "driver/rmt.h"
+#include "driver/spi_master.h"
 #include "led_strip.h"
+#include "led_effect.h"
+#include "touch_service.h"
+#include "touch_sleep.h"
+#include "esp_attr.h"
 
 
 static const char *TAG = "Touch pad";
 #define RMT_TX_CHANNEL RMT_CHANNEL_0
-
-static QueueHandle_t que_touch = NULL;
-typedef struct touch_msg {
-    touch_pad_intr_mask_t intr_mask;
-    uint32_t pad_num;
-    uint32_t pad_status;
-    uint32_t pad_val;
-} touch_event_t;
+#define STRIP_SPI_HOST SPI2_HOST
 
 led_strip_t *strip;
 
@@ -83,44 +81,6 @@ static const float button_threshold[TOUCH_BUTTON_NUM] = {
     0.01
 };
 
-/*
-  Handle an interrupt triggered when a pad is touched.
-  Recognize what pad has been touched and save it in a table.
- */
-static void touchsensor_interrupt_cb(void *arg)
-{
-    int task_awoken = pdFALSE;
-    touch_event_t evt;
-
-    evt.intr_mask = touch_pad_read_intr_status_mask();
-    evt.pad_status = touch_pad_get_status();
-    evt.pad_num = touch_pad_get_current_meas_channel();
-
-    if (evt.intr_mask & TOUCH_PAD_INTR_MASK_DONE) {
-        touch_pad_filter_read_baseline(evt.pad_num, &evt.pad_val);
-    }
-
-    xQueueSendFromISR(que_touch, &evt, &task_awoken);
-
-    if (task_awoken == pdTRUE) {
-        portYIELD_FROM_ISR();
-    }
-}
-
-static void tp_example_set_thresholds(void)
-{
-    uint32_t touch_value;
-
-    for (int i = 0; i < TOUCH_BUTTON_NUM; i++) {
-        //read baseline value
-        touch_pad_filter_read_baseline(button[i], &touch_value);
-        //set interrupt threshold.
-        touch_pad_set_thresh(button[i], touch_value * button_threshold[i]);
-        ESP_LOGI(TAG, "touch pad [%d] base %d, thresh %d", \
-                 button[i], touch_value, (uint32_t)(touch_value * button_threshold[i]));
-    }
-}
-
 static void touchsensor_filter_set(touch_filter_mode_t mode)
 {
     /* Filter function */
@@ -138,180 +98,149 @@ static void touchsensor_filter_set(touch_filter_mode_t mode)
     ESP_LOGI(TAG, "touch pad filter init");
 }
 
-static void tp_example_read_task(void *pvParameter)
+/*
+ * Touch actions. They run as soon as the touch service reports the press and leave the LED to led_effect,
+ * nothing here waits on the strip
+ */
+#define TOUCH_FADE_MS  120   // colors fade in rather than jump
+
+#if !ESP_TEST
+static RTC_DATA_ATTR int brightness = 255;     // kept through deep sleep, as the LED is
+
+static void touch_step_brightness(int step)
+{
+    brightness += step;
+    brightness = (brightness > 255) ? 255 : (brightness < 1) ? 1 : brightness;
+    printf(step > 0 ? "vol_up:%d\n" : "vol_down:%d\n", brightness);
+    led_effect_set_brightness(brightness);
+}
+#endif
+
+// red, green, blue, off, the first LED at boot
+static const led_keyframe_t boot_keys[] = {
+    {255, 0, 0, 300},
+    {0, 255, 0, 300},
+    {0, 0, 255, 300},
+    {0, 0, 0, 300},
+};
+
+static void touch_dispatch(int index, int64_t touch_us)
 {
-    touch_event_t evt = {0};
-    static uint8_t guard_mode_flag = 0;
-    /* Wait touch sensor init done */
-    vTaskDelay(100 / portTICK_RATE_MS);
-    tp_example_set_thresholds();
-    int red = 0;
-    int green = 0;
-    int blue = 0;
-    bool flag = 0;
-
-    while (1) {
-        int ret = xQueueReceive(que_touch, &evt, (portTickType)portMAX_DELAY);
-
-        if (ret != pdTRUE) {
-            continue;
-        }
-
-        if (evt.intr_mask & TOUCH_PAD_INTR_MASK_ACTIVE) {
-            /* if guard pad be touched, other pads no response. */
-            if (evt.pad_num == button[TOUCH_BUTTON_PHOTO]) {
-                printf("photo\n");
-                strip->clear(strip, 0);
-                vTaskDelay(100 / portTICK_PERIOD_MS);
-
-                #if ESP_TEST
-                ESP_ERROR_CHECK(strip->set_pixel(strip, 0, 255, 0, 0));//photo -> 红色
-                ESP_ERROR_CHECK(strip->refresh(strip, 0));
-                #else
-                ESP_ERROR_CHECK(strip->set_pixel(strip, 0, LEDC_COLOR, 0, 0));
-                flag = true;
-                red = LEDC_COLOR;
-                green = 0;
-                blue = 0;
-                // vTaskDelay(100 / portTICK_PERIOD_MS);
-                ESP_ERROR_CHECK(strip->refresh(strip, 0));
-                // vTaskDelay(100 / portTICK_PERIOD_MS);
-                #endif
-            }
-
-            if (evt.pad_num == button[TOUCH_BUTTON_PLAY]) {
-                printf("play\n");
-                strip->clear(strip, 0);
-                vTaskDelay(100 / portTICK_PERIOD_MS);
-
-                #if ESP_TEST
-                ESP_ERROR_CHECK(strip->set_pixel(strip, 0, 0, 0, 0));//play -> 关闭
-                ESP_ERROR_CHECK(strip->refresh(strip, 0));
-                #else
-                ESP_ERROR_CHECK(strip->set_pixel(strip, 0, 0, LEDC_COLOR, 0));
-                flag = true;
-                red = 0;
-                green = LEDC_COLOR;
-                blue = 0;
-                ESP_ERROR_CHECK(strip->refresh(strip, 0));
-                #endif
-            }
-
-            if (evt.pad_num == button[TOUCH_BUTTON_NETWORK]) {
-                printf("network\n");
-                strip->clear(strip, 0);
-                vTaskDelay(100 / portTICK_PERIOD_MS);
-
-                #if ESP_TEST
-                ESP_ERROR_CHECK(strip->set_pixel(strip, 0, 0, 255, 0));//network -> 绿色
-                ESP_ERROR_CHECK(strip->refresh(strip, 0));
-                #else
-                ESP_ERROR_CHECK(strip->set_pixel(strip, 0, 0, 0, LEDC_COLOR));
-                flag = true;
-                red = 0;
-                green = 0;
-                blue = LEDC_COLOR;
-                ESP_ERROR_CHECK(strip->refresh(strip, 0));
-                #endif  
-            }
-
-            if (evt.pad_num == button[TOUCH_BUTTON_RECORD]) {
-                printf("record\n");
-                strip->clear(strip, 0);
-                vTaskDelay(100 / portTICK_PERIOD_MS);
-                #if ESP_TEST
-                ESP_ERROR_CHECK(strip->set_pixel(strip, 0, 0, 0, 255));//network -> 蓝色
-                ESP_ERROR_CHECK(strip->refresh(strip, 0));
-                #else
-                flag = false;
-                #endif
-            }
-
-            if (evt.pad_num == button[TOUCH_BUTTON_VOLUP]) {
-                
-                #if ESP_TEST
-                strip->clear(strip, 0);
-                vTaskDelay(100 / portTICK_PERIOD_MS);
-                ESP_ERROR_CHECK(strip->set_pixel(strip, 0, 255, 255, 255));//volup -> 白色
-                ESP_ERROR_CHECK(strip->refresh(strip, 0));
-                #else
-                if (flag) {
-                    // strip->clear(strip, 0);
-                    vTaskDelay(100 / portTICK_PERIOD_MS);
-
-                    if (red) {
-                        red = (red + LEDC_RANGE > 255) ? 255 : red + LEDC_RANGE;
-                        ESP_ERROR_CHECK(strip->set_pixel(strip, 0, red, 0, 0));
-                        ret = red;
-                    } else if (green) {
-                        green = (green + LEDC_RANGE > 255) ? 255 : green + LEDC_RANGE;
-                        ESP_ERROR_CHECK(strip->set_pixel(strip, 0, 0, green, 0));
-                        ret = green;
-                    } else if (blue) {
-                        blue = (blue + LEDC_RANGE > 255) ? 255 : blue + LEDC_RANGE;
-                        ESP_ERROR_CHECK(strip->set_pixel(strip, 0, 0, 0, blue));
-                        ret = blue;
-                    }
-                    printf("vol_up:%d\n", ret);
-                    ESP_ERROR_CHECK(strip->refresh(strip, 0));
-                }
-                #endif 
-            }
-
-            if (evt.pad_num == button[TOUCH_BUTTON_VOLDOWN]) {
-
-                #if ESP_TEST
-                strip->clear(strip, 0);
-                vTaskDelay(100 / portTICK_PERIOD_MS);
-                ESP_ERROR_CHECK(strip->set_pixel(strip, 0, 255, 255, 0));//network -> 绿色
-                ESP_ERROR_CHECK(strip->refresh(strip, 0));
-                #else
-                int ret = 0;
-
-                if (flag) {
-                    // strip->clear(strip, 0);
-                    vTaskDelay(100 / portTICK_PERIOD_MS);
-
-                    if (red) {
-                        red = (red - LEDC_RANGE < 1) ? 1 : red - LEDC_RANGE;
-                        ESP_ERROR_CHECK(strip->set_pixel(strip, 0, red, 0, 0));
-                        ret = red;
-                    } else if (green) {
-                        green = (green - LEDC_RANGE < 1) ? 1 : green - LEDC_RANGE;
-                        ESP_ERROR_CHECK(strip->set_pixel(strip, 0, 0, green, 0));
-                        ret = green;
-                    } else if (blue) {
-                        blue = (blue - LEDC_RANGE < 1) ? 1 : blue - LEDC_RANGE;
-                        ESP_ERROR_CHECK(strip->set_pixel(strip, 0, 0, 0, blue));
-                        ret = blue;
-                    }
-
-                    printf("vol_down:%d\n", ret);
-                    ESP_ERROR_CHECK(strip->refresh(strip, 0));
-                }
-                #endif
-            }
-        }
-
-        // if (evt.intr_mask & TOUCH_PAD_INTR_MASK_INACTIVE) {
-        //     /* if guard pad be touched, other pads no response. */
-        //     if (evt.pad_num == button[3]) {
-        //         guard_mode_flag = 0;
-        //         ESP_LOGW(TAG, "TouchSensor [%d] be activated, exit guard mode", evt.pad_num);
-        //     } else {
-        //         if (guard_mode_flag == 0) {
-        //             ESP_LOGI(TAG, "TouchSensor [%d] be inactivated, status mask 0x%x", evt.pad_num, evt.pad_status);
-        //         }
-        //     }
-        // }
-        // if (evt.intr_mask & TOUCH_PAD_INTR_MASK_DONE) {
-        //     ESP_LOGI(TAG, "TouchSensor [%d] measure done, raw data %d", evt.pad_num, evt.pad_val);
-        // }
+    switch (index) {
+    case TOUCH_BUTTON_PHOTO:
+        printf("photo\n");
+#if ESP_TEST
+        led_effect_fade_to(255, 0, 0, TOUCH_FADE_MS, touch_us);       //photo -> 红色
+#else
+        led_effect_fade_to(LEDC_COLOR, 0, 0, TOUCH_FADE_MS, touch_us);
+#endif
+        break;
+
+    case TOUCH_BUTTON_PLAY:
+        printf("play\n");
+#if ESP_TEST
+        led_effect_fade_to(0, 0, 0, TOUCH_FADE_MS, touch_us);         //play -> 关闭
+#else
+        led_effect_fade_to(0, LEDC_COLOR, 0, TOUCH_FADE_MS, touch_us);
+#endif
+        break;
+
+    case TOUCH_BUTTON_NETWORK:
+        printf("network\n");
+#if ESP_TEST
+        led_effect_fade_to(0, 255, 0, TOUCH_FADE_MS, touch_us);       //network -> 绿色
+#else
+        led_effect_fade_to(0, 0, LEDC_COLOR, TOUCH_FADE_MS, touch_us);
+#endif
+        break;
+
+    case TOUCH_BUTTON_RECORD:
+        printf("record\n");
+#if ESP_TEST
+        led_effect_fade_to(0, 0, 255, TOUCH_FADE_MS, touch_us);       //record -> 蓝色
+#else
+        led_effect_fade_to(0, 0, 0, TOUCH_FADE_MS, touch_us);
+#endif
+        break;
+
+    case TOUCH_BUTTON_VOLUP:
+#if ESP_TEST
+        led_effect_fade_to(255, 255, 255, TOUCH_FADE_MS, touch_us);   //volup -> 白色
+#else
+        touch_step_brightness(LEDC_RANGE);
+#endif
+        break;
+
+    case TOUCH_BUTTON_VOLDOWN:
+#if ESP_TEST
+        led_effect_fade_to(255, 255, 0, TOUCH_FADE_MS, touch_us);     //voldown -> 黄色
+#else
+        touch_step_brightness(-LEDC_RANGE);
+#endif
+        break;
+
+    default:
+        break;
+    }
+}
+
+static void touch_long_press(int index)
+{
+    ESP_LOGI(TAG, "long press [%d]", button[index]);
+#if !ESP_TEST
+    // straight to the ends of the brightness
+    if (index == TOUCH_BUTTON_VOLUP) {
+        touch_step_brightness(255);
+    } else if (index == TOUCH_BUTTON_VOLDOWN) {
+        touch_step_brightness(-255);
+    }
+#endif
+}
+
+static void touch_event_cb(const touch_evt_t *evt, void *arg)
+{
+    led_effect_stats_t stats;
+
+    touch_sleep_note_event();
+
+    switch (evt->type) {
+    case TOUCH_EVT_PRESS:
+        touch_dispatch(evt->button, evt->time_us);
+        break;
+
+    case TOUCH_EVT_LONG_PRESS:
+        touch_long_press(evt->button);
+        break;
+
+    case TOUCH_EVT_RELEASE:
+        // the LED of the touch is long done when the pad is released
+        led_effect_get_stats(&stats);
+        ESP_LOGI(TAG, "touch to LED %lld us, max %lld us over %u touches; %u frames, %u skipped, longest %lld us",
+                 stats.last_us, stats.max_us, stats.count, stats.frames, stats.overruns, stats.max_frame_us);
+        break;
+
+    default:
+        break;
     }
 }
 
 void app_main(void)
 {
+#ifdef CONFIG_EXAMPLE_STRIP_SPI
+    spi_bus_config_t bus_config = {
+        .mosi_io_num = CONFIG_EXAMPLE_RMT_TX_GPIO,
+        .miso_io_num = -1,
+        .sclk_io_num = -1,
+        .quadwp_io_num = -1,
+        .quadhd_io_num = -1,
+        .max_transfer_sz = LED_STRIP_SPI_WS2812_BYTES(CONFIG_EXAMPLE_STRIP_LED_NUMBER),
+    };
+    // the DMA channel is the host on the ESP32-S2
+    ESP_ERROR_CHECK(spi_bus_initialize(STRIP_SPI_HOST, &bus_config, STRIP_SPI_HOST));
+
+    led_strip_config_t strip_config = LED_STRIP_DEFAULT_CONFIG(CONFIG_EXAMPLE_STRIP_LED_NUMBER, (led_strip_dev_t)STRIP_SPI_HOST);
+    strip = led_strip_new_spi_ws2812(&strip_config);
+#else
     rmt_config_t config = RMT_DEFAULT_CONFIG_TX(CONFIG_EXAMPLE_RMT_TX_GPIO, RMT_TX_CHANNEL);
     // set counter clock to 40MHz
     config.clk_div = 2;
@@ -321,6 +250,7 @@ void app_main(void)
 
     led_strip_config_t strip_config = LED_STRIP_DEFAULT_CONFIG(CONFIG_EXAMPLE_STRIP_LED_NUMBER, (led_strip_dev_t)config.channel);
     strip = led_strip_new_rmt_ws2812(&strip_config);
+#endif
 
     if (!strip) {
         ESP_LOGE(TAG, "install WS2812 driver failed");
@@ -331,10 +261,6 @@ void app_main(void)
     // Show simple rainbow chasing pattern
     ESP_LOGI(TAG, "Start");
 
-    if (que_touch == NULL) {
-        que_touch = xQueueCreate(TOUCH_BUTTON_NUM, sizeof(touch_event_t));
-    }
-
     // Initialize touch pad peripheral, it will start a timer to run a filter
     ESP_LOGI(TAG, "Initializing touch pad");
     /* Initialize touch pad peripheral. */
@@ -382,15 +308,36 @@ void app_main(void)
 
     /* Filter setting */
     touchsensor_filter_set(TOUCH_PAD_FILTER_IIR_8);
-    /* Register touch interrupt ISR, enable intr type. */
-    touch_pad_isr_register(touchsensor_interrupt_cb, NULL, TOUCH_PAD_INTR_MASK_ALL);
-    touch_pad_intr_enable(TOUCH_PAD_INTR_MASK_ACTIVE | TOUCH_PAD_INTR_MASK_INACTIVE);
-    // touch_pad_intr_enable(TOUCH_PAD_INTR_MASK_DONE); // Use for debug
 
     /* Enable touch sensor clock. Work mode is "timer trigger". */
     touch_pad_set_fsm_mode(TOUCH_FSM_MODE_TIMER);
     touch_pad_fsm_start();
 
-    // Start a task to show what pads have been touched
-    xTaskCreate(&tp_example_read_task, "touch_pad_read_task", 2048, NULL, 5, NULL);
+    // The LED follows the touches from its own task
+    ESP_ERROR_CHECK(led_effect_start(strip, 5));
+    if (touch_sleep_woke_from_deep()) {
+        led_effect_resume();
+    } else {
+        led_effect_play(boot_keys, sizeof(boot_keys) / sizeof(boot_keys[0]), false, 0);
+    }
+
+    // Thresholds, the interrupt and the gestures
+    touch_service_config_t touch_config = TOUCH_SERVICE_DEFAULT_CONFIG();
+    touch_config.pads = button;
+    touch_config.thresholds = button_threshold;
+    touch_config.pad_num = TOUCH_BUTTON_NUM;
+    touch_config.cb = touch_event_cb;
+    ESP_ERROR_CHECK(touch_service_start(&touch_config));
+
+#ifndef CONFIG_EXAMPLE_TOUCH_SLEEP_NONE
+    touch_sleep_config_t sleep_config = {
+        .idle_ms = CONFIG_EXAMPLE_TOUCH_SLEEP_IDLE_MS,
+#ifdef CONFIG_EXAMPLE_TOUCH_SLEEP_DEEP
+        .deep = true,
+#endif
+        .wake_pad = button[TOUCH_BUTTON_PHOTO],
+        .wake_threshold = button_threshold[TOUCH_BUTTON_PHOTO],
+    };
+    ESP_ERROR_CHECK(touch_sleep_start(&sleep_config));
+#endif
 }
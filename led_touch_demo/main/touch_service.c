@@ -0,0 +1,222 @@
+/* Touch events of the touch example
+
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+#include <stdbool.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "touch_service.h"
+
+static const char *TAG = "Touch service";
+
+#define TOUCH_SERVICE_PAD_MAX   14
+
+typedef struct {
+    bool down;
+    bool long_sent;
+    int64_t down_us;
+} touch_pad_state_t;
+
+static touch_service_config_t service;
+static TaskHandle_t service_task = NULL;
+static touch_pad_state_t pad_state[TOUCH_SERVICE_PAD_MAX];
+static int slider_position = -1;
+
+// written by the interrupt
+static portMUX_TYPE isr_lock = portMUX_INITIALIZER_UNLOCKED;
+static uint32_t isr_status;
+static uint32_t isr_latched;        // every pad active since the task looked
+static int64_t isr_time_us;
+
+static void touch_service_isr(void *arg)
+{
+    BaseType_t task_awoken = pdFALSE;
+    uint32_t status = touch_pad_get_status();
+
+    touch_pad_read_intr_status_mask();
+    portENTER_CRITICAL_ISR(&isr_lock);
+    isr_status = status;
+    isr_latched |= status;
+    isr_time_us = esp_timer_get_time();
+    portEXIT_CRITICAL_ISR(&isr_lock);
+
+    vTaskNotifyGiveFromISR(service_task, &task_awoken);
+    if (task_awoken == pdTRUE) {
+        portYIELD_FROM_ISR();
+    }
+}
+
+static void touch_service_emit(touch_evt_type_t type, int button, int position, int64_t time_us)
+{
+    touch_evt_t evt = {
+        .type = type,
+        .button = button,
+        .position = position,
+        .time_us = time_us,
+    };
+    service.cb(&evt, service.arg);
+}
+
+static void touch_service_set_thresholds(bool log)
+{
+    uint32_t baseline;
+
+    for (int i = 0; i < service.pad_num; i++) {
+        touch_pad_filter_read_baseline(service.pads[i], &baseline);
+        touch_pad_set_thresh(service.pads[i], baseline * service.thresholds[i]);
+        if (log) {
+            ESP_LOGI(TAG, "touch pad [%d] base %d, thresh %d",
+                     service.pads[i], baseline, (uint32_t)(baseline * service.thresholds[i]));
+        }
+    }
+}
+
+/*
+ * The centroid of how much each slider pad is above its baseline, -1 when none is
+ */
+static int touch_service_slider_position(void)
+{
+    uint32_t smooth, baseline;
+    int64_t sum = 0, weighted = 0;
+
+    for (int i = 0; i < service.slider_num; i++) {
+        touch_pad_t pad = service.pads[service.slider[i]];
+        touch_pad_filter_read_smooth(pad, &smooth);
+        touch_pad_filter_read_baseline(pad, &baseline);
+        if (smooth > baseline) {
+            sum += smooth - baseline;
+            weighted += (int64_t)(smooth - baseline) * i;
+        }
+    }
+    if (sum == 0) {
+        return -1;
+    }
+    return service.slider_num > 1 ? weighted * 255 / (sum * (service.slider_num - 1)) : 0;
+}
+
+static void touch_service_update(uint32_t status, uint32_t latched, int64_t stamp_us, int64_t now)
+{
+    bool slider_held = false;
+
+    for (int i = 0; i < service.pad_num; i++) {
+        touch_pad_state_t *state = &pad_state[i];
+        uint32_t bit = BIT(service.pads[i]);
+        bool active = status & bit;
+
+        if (!state->down && (latched & bit)) {
+            state->down = true;
+            state->long_sent = false;
+            state->down_us = stamp_us;
+            touch_service_emit(TOUCH_EVT_PRESS, i, 0, stamp_us);
+        }
+        if (!state->down) {
+            continue;
+        }
+        if (!active) {
+            // a tap shorter than the wake up comes with press and release at once
+            state->down = false;
+            touch_service_emit(TOUCH_EVT_RELEASE, i, 0, stamp_us);
+            if (!state->long_sent) {
+                touch_service_emit(TOUCH_EVT_TAP, i, 0, stamp_us);
+            }
+        } else if (!state->long_sent && now - state->down_us >= service.long_press_ms * 1000LL) {
+            state->long_sent = true;
+            touch_service_emit(TOUCH_EVT_LONG_PRESS, i, 0, now);
+        }
+    }
+
+    for (int i = 0; i < service.slider_num; i++) {
+        slider_held |= pad_state[service.slider[i]].down;
+    }
+    if (slider_held) {
+        int position = touch_service_slider_position();
+        if (position >= 0 && position != slider_position) {
+            slider_position = position;
+            touch_service_emit(TOUCH_EVT_SLIDE, -1, position, now);
+        }
+    } else {
+        slider_position = -1;
+    }
+}
+
+static void touch_service_task(void *arg)
+{
+    int64_t recal_us = 0;
+    bool held = false;
+
+    /* Wait touch sensor init done */
+    vTaskDelay(100 / portTICK_RATE_MS);
+    touch_service_set_thresholds(true);
+    touch_pad_isr_register(touch_service_isr, NULL, TOUCH_PAD_INTR_MASK_ACTIVE | TOUCH_PAD_INTR_MASK_INACTIVE);
+    touch_pad_intr_enable(TOUCH_PAD_INTR_MASK_ACTIVE | TOUCH_PAD_INTR_MASK_INACTIVE);
+
+    while (1) {
+        // held pads are polled for long presses and the slider, otherwise the interrupt wakes the task
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(held ? service.tick_ms : service.recal_ms));
+        int64_t now = esp_timer_get_time();
+
+        portENTER_CRITICAL(&isr_lock);
+        uint32_t status = isr_status;
+        uint32_t latched = isr_latched;
+        int64_t stamp_us = isr_time_us;
+        isr_latched = 0;
+        portEXIT_CRITICAL(&isr_lock);
+
+        touch_service_update(status, latched, stamp_us, now);
+
+        held = false;
+        for (int i = 0; i < service.pad_num; i++) {
+            held |= pad_state[i].down;
+        }
+        // the filter only moves the baseline of untouched pads, follow it
+        if (!held && now - recal_us >= service.recal_ms * 1000LL) {
+            touch_service_set_thresholds(false);
+            recal_us = now;
+        }
+    }
+}
+
+esp_err_t touch_service_start(const touch_service_config_t *config)
+{
+    if (service_task) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (config->pads == NULL || config->thresholds == NULL || config->cb == NULL
+            || config->pad_num <= 0 || config->pad_num > TOUCH_SERVICE_PAD_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    service = *config;
+    if (xTaskCreate(&touch_service_task, "touch_service", 3072, NULL, config->task_priority, &service_task) != pdPASS) {
+        service_task = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+bool touch_service_busy(void)
+{
+    for (int i = 0; i < service.pad_num; i++) {
+        if (pad_state[i].down) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void touch_service_poll(void)
+{
+    uint32_t status = touch_pad_get_status();
+
+    portENTER_CRITICAL(&isr_lock);
+    isr_status = status;
+    isr_latched |= status;
+    isr_time_us = esp_timer_get_time();
+    portEXIT_CRITICAL(&isr_lock);
+    xTaskNotifyGive(service_task);
+}
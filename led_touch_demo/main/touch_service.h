@@ -0,0 +1,81 @@
+/* Touch events of the touch example
+
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "driver/touch_pad.h"
+
+/*
+ * The touch FSM, its IIR filter, denoise and waterproof run in hardware and decide which pads are
+ * active. The interrupt only latches that status mask and wakes the service task, nothing is queued,
+ * so a fast series of touches cannot overflow anything and a tap shorter than the wake up is still
+ * seen. The task turns pad states into taps, long presses and slider moves, and keeps the thresholds
+ * relative to the baselines the filter tracks.
+ */
+
+typedef enum {
+    TOUCH_EVT_PRESS = 0,        // the pad became active
+    TOUCH_EVT_RELEASE,
+    TOUCH_EVT_TAP,              // released before long_press_ms, after TOUCH_EVT_RELEASE
+    TOUCH_EVT_LONG_PRESS,       // still held after long_press_ms, once per press
+    TOUCH_EVT_SLIDE,            // position: where a finger is on the slider, 0~255
+} touch_evt_type_t;
+
+typedef struct {
+    touch_evt_type_t type;
+    int button;                 // index in touch_service_config_t.pads, -1 for the slider
+    int position;
+    int64_t time_us;            // esp_timer_get_time() of the interrupt
+} touch_evt_t;
+
+/**
+ * @brief Called from the service task, a long handler delays the next events
+ */
+typedef void (*touch_evt_cb_t)(const touch_evt_t *evt, void *arg);
+
+typedef struct {
+    const touch_pad_t *pads;    // configured with touch_pad_config(), not copied
+    const float *thresholds;    // of each pad, a share of its baseline
+    int pad_num;
+    const int *slider;          // indexes in pads, in order along the slider, can be NULL
+    int slider_num;
+    uint32_t long_press_ms;
+    uint32_t tick_ms;           // while a pad is held
+    uint32_t recal_ms;          // thresholds follow the baselines at this period while no pad is held
+    touch_evt_cb_t cb;
+    void *arg;
+    int task_priority;
+} touch_service_config_t;
+
+#define TOUCH_SERVICE_DEFAULT_CONFIG() {    \
+    .long_press_ms = 800,                   \
+    .tick_ms = 20,                          \
+    .recal_ms = 1000,                       \
+    .task_priority = 5,                     \
+}
+
+/**
+ * @brief Set the thresholds, hook the interrupt and start the service task
+ *
+ *        Call it after the touch FSM was started, the first thresholds are taken once the filter
+ *        has a baseline.
+ */
+esp_err_t touch_service_start(const touch_service_config_t *config);
+
+/**
+ * @brief Whether a pad is held
+ */
+bool touch_service_busy(void);
+
+/**
+ * @brief Read the pad status as the interrupt does, e.g. after a wake up by touch
+ */
+void touch_service_poll(void);
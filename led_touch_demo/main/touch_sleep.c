@@ -0,0 +1,103 @@
+/* Sleep of the touch example
+
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_sleep.h"
+#include "esp_system.h"
+#include "led_effect.h"
+#include "touch_service.h"
+#include "touch_sleep.h"
+
+static const char *TAG = "Touch sleep";
+
+#define TOUCH_SLEEP_CHECK_MS    100
+
+static touch_sleep_config_t sleep_config;
+static TaskHandle_t sleep_task = NULL;
+static volatile int64_t last_event_us;
+static volatile int64_t wake_us = -1;       // waiting for the first event after it
+
+static void touch_sleep_light(void)
+{
+    int64_t start = esp_timer_get_time();
+
+    esp_sleep_enable_touchpad_wakeup();
+    esp_light_sleep_start();
+    wake_us = esp_timer_get_time();
+    last_event_us = wake_us;
+    ESP_LOGI(TAG, "woke after %lld ms", (wake_us - start) / 1000);
+
+    led_effect_resume();
+    // the interrupt of the touch that woke the chip may be gone
+    touch_service_poll();
+}
+
+static void touch_sleep_deep(void)
+{
+    uint32_t baseline;
+
+    touch_pad_filter_read_baseline(sleep_config.wake_pad, &baseline);
+    touch_pad_sleep_channel_enable(sleep_config.wake_pad, true);
+    touch_pad_sleep_set_threshold(sleep_config.wake_pad, baseline * sleep_config.wake_threshold);
+    esp_sleep_enable_touchpad_wakeup();
+    ESP_LOGI(TAG, "deep sleep, touch pad [%d] wakes", sleep_config.wake_pad);
+    esp_deep_sleep_start();
+}
+
+static void touch_sleep_task(void *arg)
+{
+    while (1) {
+        vTaskDelay(TOUCH_SLEEP_CHECK_MS / portTICK_PERIOD_MS);
+        if (esp_timer_get_time() - last_event_us < sleep_config.idle_ms * 1000LL || touch_service_busy()) {
+            continue;
+        }
+        led_effect_suspend(100);
+        if (sleep_config.deep) {
+            touch_sleep_deep();
+        } else {
+            touch_sleep_light();
+        }
+    }
+}
+
+esp_err_t touch_sleep_start(const touch_sleep_config_t *config)
+{
+    if (sleep_task) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    sleep_config = *config;
+    last_event_us = esp_timer_get_time();
+    if (touch_sleep_woke_from_deep()) {
+        // the touch only woke the chip, esp_timer counts from the boot
+        ESP_LOGI(TAG, "woke from deep sleep, ready %lld us after boot", last_event_us);
+    }
+    if (xTaskCreate(&touch_sleep_task, "touch_sleep", 2048, NULL, 4, &sleep_task) != pdPASS) {
+        sleep_task = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+void touch_sleep_note_event(void)
+{
+    int64_t now = esp_timer_get_time();
+
+    last_event_us = now;
+    if (wake_us >= 0) {
+        ESP_LOGI(TAG, "first event %lld us after wake up", now - wake_us);
+        wake_us = -1;
+    }
+}
+
+bool touch_sleep_woke_from_deep(void)
+{
+    return esp_reset_reason() == ESP_RST_DEEPSLEEP && esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_TOUCHPAD;
+}
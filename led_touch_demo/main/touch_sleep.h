@@ -0,0 +1,43 @@
+/* Sleep of the touch example
+
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "driver/touch_pad.h"
+
+/*
+ * Once no touch event came for idle_ms and no pad is held, the LED is turned off and the chip sleeps
+ * with touch wake up, the touch FSM goes on measuring in the timer mode. The waterproof logic runs in
+ * the FSM too, so water on the guard ring does not wake the chip.
+ */
+
+typedef struct {
+    uint32_t idle_ms;
+    bool deep;                  // else light sleep
+    touch_pad_t wake_pad;       // deep sleep only, the chip wakes on one pad
+    float wake_threshold;       // of wake_pad, a share of its baseline
+} touch_sleep_config_t;
+
+/**
+ * @brief Start the task that puts the chip to sleep
+ */
+esp_err_t touch_sleep_start(const touch_sleep_config_t *config);
+
+/**
+ * @brief Call it for every touch event, it keeps the chip awake and measures how long the first
+ *        event after a wake up took
+ */
+void touch_sleep_note_event(void);
+
+/**
+ * @brief Whether this boot is a wake up from deep sleep by touch
+ */
+bool touch_sleep_woke_from_deep(void);
@@ -0,0 +1,394 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_partition.h"
+#include "esp_spi_flash.h"
+#include "tjpgd.h"
+#include "assets.h"
+
+static const char *TAG = "assets";
+
+// Decoder work space: stream buffer, tables, IDCT and MCU buffers plus the 4K of Huffman lookup tables
+#define ASSETS_WORKSZ (2780 + 4096)
+// Rows of the tallest stripe, a row of 16x16 MCUs at 1:1
+#define ASSETS_STRIPE_LINES 16
+
+typedef struct {
+    uint16_t image;
+    uint8_t scale;
+    uint8_t valid;      // pixels decoded
+    uint16_t tx;
+    uint16_t ty;
+    uint32_t stamp;     // last use, 0: free
+    uint16_t *pixels;   // tile_size * tile_size, row pitch tile_size
+} assets_tile_t;
+
+typedef struct {
+    spi_flash_mmap_handle_t mmap;
+    const uint8_t *base;
+    uint32_t size;
+    uint32_t count;
+    const assets_entry_t *entry;
+    uint16_t tile_size;
+    uint16_t max_tiles;
+    uint32_t caps;
+    assets_tile_t *tile;
+    uint32_t clock;
+    uint32_t hits;
+    uint32_t misses;
+    SemaphoreHandle_t lock;
+} assets_obj_t;
+
+// The tile row a decode fills
+typedef struct {
+    int y0;                 // scaled rows of the band
+    int width;              // scaled image width
+    int cols;
+    assets_tile_t **fill;   // by tx, NULL: cached already or no room
+} assets_band_t;
+
+static assets_obj_t *assets_obj = NULL;
+
+static assets_tile_t *assets_find_tile(int image, uint8_t scale, int tx, int ty)
+{
+    for (int i = 0; i < assets_obj->max_tiles; i++) {
+        assets_tile_t *tile = &assets_obj->tile[i];
+        if (tile->valid && tile->image == image && tile->scale == scale && tile->tx == tx && tile->ty == ty) {
+            return tile;
+        }
+    }
+    return NULL;
+}
+
+// Free slot or the least recently used one outside the band being filled (stamp now)
+static assets_tile_t *assets_take_slot(int image, uint8_t scale, int tx, int ty, uint32_t now)
+{
+    assets_tile_t *slot = NULL;
+    for (int i = 0; i < assets_obj->max_tiles; i++) {
+        assets_tile_t *tile = &assets_obj->tile[i];
+        if (tile->stamp != now && (slot == NULL || tile->stamp < slot->stamp)) {
+            slot = tile;
+        }
+    }
+    if (slot == NULL) {
+        return NULL;
+    }
+    if (slot->pixels == NULL) {
+        size_t size = assets_obj->tile_size * assets_obj->tile_size * sizeof(uint16_t);
+        slot->pixels = (uint16_t *)heap_caps_malloc(size, assets_obj->caps);
+        if (slot->pixels == NULL) {
+            slot->pixels = (uint16_t *)heap_caps_malloc(size, MALLOC_CAP_DEFAULT);
+        }
+        if (slot->pixels == NULL) {
+            return NULL;
+        }
+    }
+    slot->image = image;
+    slot->scale = scale;
+    slot->tx = tx;
+    slot->ty = ty;
+    slot->valid = 0;
+    slot->stamp = now;
+    return slot;
+}
+
+static uint16_t *assets_stripe(JDEC *jd, uint16_t *stripe, JRECT *rect)
+{
+    assets_band_t *band = (assets_band_t *)jd->device;
+    int size = assets_obj->tile_size;
+    for (int y = rect->top; y <= rect->bottom; y++) {
+        if (y < band->y0) {
+            continue; // above the band, decoded only to get through the stream
+        }
+        for (int tx = 0; tx < band->cols; tx++) {
+            if (band->fill[tx]) {
+                int w = band->width - tx * size < size ? band->width - tx * size : size;
+                memcpy(band->fill[tx]->pixels + (y - band->y0) * size, stripe + (y - rect->top) * band->width + tx * size, w * sizeof(uint16_t));
+            }
+        }
+    }
+    return stripe;
+}
+
+// Decode the tile row ty of an image into every slot the cache can spare, tile tx first
+static int assets_fill(int image, uint8_t scale, int tx, int ty)
+{
+    const assets_entry_t *entry = &assets_obj->entry[image];
+    int size = assets_obj->tile_size;
+    int width = entry->width >> scale;
+    int height = entry->height >> scale;
+    uint32_t now = ++assets_obj->clock;
+    assets_band_t band = {
+        .y0 = ty * size,
+        .width = width,
+        .cols = (width + size - 1) / size,
+    };
+    int y1 = band.y0 + size < height ? band.y0 + size : height;
+    char *work = NULL;
+    uint16_t *stripe = NULL;
+    JDEC jd;
+    int r;
+    int ret = -1;
+
+    band.fill = (assets_tile_t **)calloc(band.cols, sizeof(assets_tile_t *));
+    if (band.fill == NULL) {
+        return -1;
+    }
+    band.fill[tx] = assets_take_slot(image, scale, tx, ty, now);
+    if (band.fill[tx] == NULL) {
+        ESP_LOGE(TAG, "no memory for a tile\n");
+        goto done;
+    }
+    // 这一行已经缓存的 tile 不能被顺便解码的 tile 挤掉
+    for (int i = 0; i < band.cols; i++) {
+        assets_tile_t *tile = assets_find_tile(image, scale, i, ty);
+        if (tile) {
+            tile->stamp = now;
+        }
+    }
+    // 同一行的其他 tile 顺便解码，解码器反正要走到这一行
+    for (int i = 0; i < band.cols; i++) {
+        if (i != tx && !assets_find_tile(image, scale, i, ty)) {
+            band.fill[i] = assets_take_slot(image, scale, i, ty, now);
+            if (band.fill[i] == NULL) {
+                break;
+            }
+        }
+    }
+
+    work = (char *)malloc(ASSETS_WORKSZ);
+    stripe = (uint16_t *)heap_caps_malloc(width * ASSETS_STRIPE_LINES * sizeof(uint16_t), assets_obj->caps);
+    if (stripe == NULL) {
+        stripe = (uint16_t *)heap_caps_malloc(width * ASSETS_STRIPE_LINES * sizeof(uint16_t), MALLOC_CAP_DEFAULT);
+    }
+    if (work == NULL || stripe == NULL) {
+        ESP_LOGE(TAG, "no memory for the decoder\n");
+        goto done;
+    }
+    r = jd_prepare_mem(&jd, assets_obj->base + entry->offset, entry->len, work, ASSETS_WORKSZ, &band);
+    if (r == JDR_OK) {
+        // 解码到这一行的底部就停下
+        r = jd_decomp_stripe(&jd, assets_stripe, stripe, width, width, y1, scale);
+    }
+    if (r != JDR_OK) {
+        ESP_LOGE(TAG, "%.*s: decode failed (%d)\n", ASSETS_NAME_LEN, entry->name, r);
+        goto done;
+    }
+    ret = 0;
+
+done:
+    for (int i = 0; i < band.cols; i++) {
+        if (band.fill[i]) {
+            band.fill[i]->valid = (ret == 0);
+            if (ret != 0) {
+                band.fill[i]->stamp = 0;
+            }
+        }
+    }
+    free(band.fill);
+    free(work);
+    free(stripe);
+    return ret;
+}
+
+int assets_find(const char *name)
+{
+    if (assets_obj == NULL) {
+        return -1;
+    }
+    for (int i = 0; i < assets_obj->count; i++) {
+        if (strncmp(assets_obj->entry[i].name, name, ASSETS_NAME_LEN) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+int assets_get_size(int image, int *width, int *height)
+{
+    if (assets_obj == NULL || image < 0 || image >= assets_obj->count) {
+        return -1;
+    }
+    *width = assets_obj->entry[image].width;
+    *height = assets_obj->entry[image].height;
+    return 0;
+}
+
+const uint16_t *assets_get_pixels(int image)
+{
+    if (assets_obj == NULL || image < 0 || image >= assets_obj->count || assets_obj->entry[image].format != ASSETS_FORMAT_RGB565) {
+        return NULL;
+    }
+    return (const uint16_t *)(assets_obj->base + assets_obj->entry[image].offset);
+}
+
+// RGB565 images come from the mapping as they are, every 1 << scale pixel when scaled down
+static void assets_draw_raw(int image, uint8_t scale, int x, int y, int x0, int y0, int x1, int y1, uint16_t *dst, int stride)
+{
+    const assets_entry_t *entry = &assets_obj->entry[image];
+    const uint16_t *pixels = (const uint16_t *)(assets_obj->base + entry->offset);
+    for (int r = y0; r < y1; r++) {
+        const uint16_t *src = pixels + (r << scale) * entry->width + (x0 << scale);
+        uint16_t *out = dst + (r - y) * stride + (x0 - x);
+        if (scale == 0) {
+            memcpy(out, src, (x1 - x0) * sizeof(uint16_t));
+        } else {
+            for (int c = x0; c < x1; c++, src += 1 << scale) {
+                *out++ = *src;
+            }
+        }
+    }
+}
+
+int assets_draw(int image, uint8_t scale, int x, int y, int width, int height, uint16_t *dst, int stride)
+{
+    if (assets_obj == NULL || image < 0 || image >= assets_obj->count || scale > 3 || dst == NULL) {
+        return -1;
+    }
+    int size = assets_obj->tile_size;
+    int sw = assets_obj->entry[image].width >> scale;
+    int sh = assets_obj->entry[image].height >> scale;
+    int x0 = x < 0 ? 0 : x;
+    int y0 = y < 0 ? 0 : y;
+    int x1 = x + width < sw ? x + width : sw;
+    int y1 = y + height < sh ? y + height : sh;
+    int ret = 0;
+
+    if (x0 >= x1 || y0 >= y1) {
+        return 0; // nothing of the image in the area
+    }
+    if (assets_obj->entry[image].format == ASSETS_FORMAT_RGB565) {
+        assets_draw_raw(image, scale, x, y, x0, y0, x1, y1, dst, stride);
+        return 0;
+    }
+    xSemaphoreTake(assets_obj->lock, portMAX_DELAY);
+    for (int ty = y0 / size; ty * size < y1 && ret == 0; ty++) {
+        for (int tx = x0 / size; tx * size < x1; tx++) {
+            assets_tile_t *tile = assets_find_tile(image, scale, tx, ty);
+            if (tile) {
+                assets_obj->hits++;
+            } else {
+                assets_obj->misses++;
+                if (assets_fill(image, scale, tx, ty) != 0 || (tile = assets_find_tile(image, scale, tx, ty)) == NULL) {
+                    ret = -1;
+                    break;
+                }
+            }
+            tile->stamp = ++assets_obj->clock;
+            // 当前 tile 和绘制区域的交集
+            int cx0 = tx * size > x0 ? tx * size : x0;
+            int cx1 = (tx + 1) * size < x1 ? (tx + 1) * size : x1;
+            int cy0 = ty * size > y0 ? ty * size : y0;
+            int cy1 = (ty + 1) * size < y1 ? (ty + 1) * size : y1;
+            for (int r = cy0; r < cy1; r++) {
+                memcpy(dst + (r - y) * stride + (cx0 - x), tile->pixels + (r - ty * size) * size + (cx0 - tx * size), (cx1 - cx0) * sizeof(uint16_t));
+            }
+        }
+    }
+    xSemaphoreGive(assets_obj->lock);
+    return ret;
+}
+
+void assets_flush(void)
+{
+    if (assets_obj == NULL) {
+        return;
+    }
+    xSemaphoreTake(assets_obj->lock, portMAX_DELAY);
+    for (int i = 0; i < assets_obj->max_tiles; i++) {
+        assets_obj->tile[i].valid = 0;
+        assets_obj->tile[i].stamp = 0;
+    }
+    xSemaphoreGive(assets_obj->lock);
+}
+
+void assets_get_stats(uint32_t *hits, uint32_t *misses)
+{
+    *hits = assets_obj ? assets_obj->hits : 0;
+    *misses = assets_obj ? assets_obj->misses : 0;
+}
+
+void assets_deinit(void)
+{
+    if (assets_obj == NULL) {
+        return;
+    }
+    if (assets_obj->tile) {
+        for (int i = 0; i < assets_obj->max_tiles; i++) {
+            free(assets_obj->tile[i].pixels);
+        }
+        free(assets_obj->tile);
+    }
+    if (assets_obj->base) {
+        spi_flash_munmap(assets_obj->mmap);
+    }
+    if (assets_obj->lock) {
+        vSemaphoreDelete(assets_obj->lock);
+    }
+    free(assets_obj);
+    assets_obj = NULL;
+}
+
+int assets_init(const assets_config_t *config)
+{
+    const char *label = config->partition ? config->partition : "assets";
+    const esp_partition_t *part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label);
+    if (part == NULL) {
+        ESP_LOGE(TAG, "partition %s not found\n", label);
+        return -1;
+    }
+    assets_obj = (assets_obj_t *)calloc(1, sizeof(assets_obj_t));
+    if (assets_obj == NULL) {
+        ESP_LOGE(TAG, "assets object malloc error\n");
+        return -1;
+    }
+    assets_obj->tile_size = config->tile_size ? config->tile_size : 64;
+    assets_obj->max_tiles = config->max_tiles ? config->max_tiles : 32;
+    assets_obj->caps = config->caps ? config->caps : MALLOC_CAP_SPIRAM;
+    assets_obj->size = part->size;
+    if (esp_partition_mmap(part, 0, part->size, SPI_FLASH_MMAP_DATA, (const void **)&assets_obj->base, &assets_obj->mmap) != ESP_OK) {
+        ESP_LOGE(TAG, "partition %s mmap error\n", label);
+        assets_obj->base = NULL;
+        goto err;
+    }
+    const assets_header_t *header = (const assets_header_t *)assets_obj->base;
+    // count is bounded before it is multiplied, a corrupt one must not wrap the index size past the check
+    if (assets_obj->size < sizeof(assets_header_t) || header->magic != ASSETS_MAGIC ||
+        header->count > (assets_obj->size - sizeof(assets_header_t)) / sizeof(assets_entry_t)) {
+        ESP_LOGE(TAG, "partition %s holds no asset index\n", label);
+        goto err;
+    }
+    assets_obj->count = header->count;
+    assets_obj->entry = (const assets_entry_t *)(header + 1);
+    for (int i = 0; i < assets_obj->count; i++) {
+        const assets_entry_t *entry = &assets_obj->entry[i];
+        if (entry->offset > assets_obj->size || entry->len > assets_obj->size - entry->offset) {
+            ESP_LOGE(TAG, "asset %d out of the partition\n", i);
+            goto err;
+        }
+        if (entry->format == ASSETS_FORMAT_RGB565 && ((entry->offset & 3) || entry->len < entry->width * entry->height * sizeof(uint16_t))) {
+            ESP_LOGE(TAG, "asset %d: bad RGB565 image\n", i);
+            goto err;
+        }
+        if (entry->format > ASSETS_FORMAT_RGB565) {
+            ESP_LOGE(TAG, "asset %d: format %d error\n", i, entry->format);
+            goto err;
+        }
+    }
+    assets_obj->tile = (assets_tile_t *)calloc(assets_obj->max_tiles, sizeof(assets_tile_t));
+    assets_obj->lock = xSemaphoreCreateMutex();
+    if (assets_obj->tile == NULL || assets_obj->lock == NULL) {
+        ESP_LOGE(TAG, "assets cache malloc error\n");
+        goto err;
+    }
+    ESP_LOGI(TAG, "%d images, cache %d tiles of %dx%d\n", assets_obj->count, assets_obj->max_tiles, assets_obj->tile_size, assets_obj->tile_size);
+    return 0;
+
+err:
+    assets_deinit();
+    return -1;
+}
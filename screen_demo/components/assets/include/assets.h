@@ -0,0 +1,72 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// JPEG images in a flash partition, built on the host with mkassets.py, with decoded tiles in a bounded LRU cache.
+// The partition is memory mapped and every image is decoded in place, a miss decodes the whole tile row it falls
+// in, so drawing a screen again is served from the cache without touching the decoder.
+// Raw RGB565 images are stored already in LCD byte order and read straight from the mapping, no decode, no cache.
+
+#define ASSETS_MAGIC    0x31545341 // "AST1"
+#define ASSETS_NAME_LEN 24
+
+typedef enum {
+    ASSETS_FORMAT_JPEG = 0,
+    ASSETS_FORMAT_RGB565,   // width * height big-endian RGB565 pixels, 4 byte aligned
+} assets_format_t;
+
+// Partition layout, little endian: assets_header_t, count assets_entry_t, then the image data
+typedef struct {
+    char name[ASSETS_NAME_LEN]; // zero padded, no extension
+    uint32_t offset;            // from the start of the partition
+    uint32_t len;
+    uint16_t width;             // full scale size
+    uint16_t height;
+    uint8_t format;             // assets_format_t
+    uint8_t reserved[3];
+} __attribute__((packed)) assets_entry_t;
+
+typedef struct {
+    uint32_t magic;
+    uint32_t count;
+} __attribute__((packed)) assets_header_t;
+
+typedef struct {
+    const char *partition; // data partition label, NULL: "assets"
+    uint16_t tile_size;    // tile edge in pixels of the scaled image, 0: 64
+    uint16_t max_tiles;    // cache bound, 0: 32 (256 KB of 64x64 tiles)
+    uint32_t caps;         // heap caps of the tiles, 0: MALLOC_CAP_SPIRAM, falls back to the default heap
+} assets_config_t;
+
+int assets_init(const assets_config_t *config);
+
+void assets_deinit(void);
+
+// Image index by name, -1: not found
+int assets_find(const char *name);
+
+// Full scale size of an image
+int assets_get_size(int image, int *width, int *height);
+
+// Pixels of an RGB565 image in the flash mapping, row pitch width, NULL for a JPEG image.
+// Hand them to lcd_write_data() as they are: the LCD bounce buffers take them from flash chunk by chunk, the image
+// is never decoded or copied whole into RAM. Valid until assets_deinit
+const uint16_t *assets_get_pixels(int image);
+
+// Copy width x height pixels at (x, y) of the image decoded at 1 / (1 << scale) to dst, big-endian RGB565.
+// The area is cropped to the scaled image, the rest of dst is not touched. RGB565 images are subsampled
+int assets_draw(int image, uint8_t scale, int x, int y, int width, int height, uint16_t *dst, int stride);
+
+// Drop the cached tiles of every image
+void assets_flush(void);
+
+void assets_get_stats(uint32_t *hits, uint32_t *misses);
+
+#ifdef __cplusplus
+}
+#endif
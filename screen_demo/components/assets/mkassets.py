@@ -0,0 +1,98 @@
+#!/usr/bin/env python
+#
+# Build an assets partition image from baseline JPEG files, see include/assets.h for the layout.
+# Other images (png, bmp, ...) and the JPEG files given with --raw are stored as RGB565 in LCD byte order,
+# which draws without decoding at 2 bytes per pixel of flash; the conversion needs Pillow.
+#
+#   python mkassets.py assets.bin img/*.jpg icons/*.png
+#   parttool.py write_partition --partition-name=assets --input=assets.bin
+#
+import argparse
+import os
+import struct
+import sys
+
+MAGIC = 0x31545341  # "AST1"
+NAME_LEN = 24
+ENTRY = struct.Struct('<%dsIIHHB3x' % NAME_LEN)
+FORMAT_JPEG = 0
+FORMAT_RGB565 = 1
+HEADER = struct.Struct('<II')
+
+
+def jpeg_size(data):
+    """Width and height from the SOF0 segment, TJpgDec decodes baseline files only."""
+    if data[:2] != b'\xff\xd8':
+        raise ValueError('not a jpeg file')
+    pos = 2
+    while pos + 4 <= len(data):
+        if data[pos] != 0xFF:
+            raise ValueError('broken segment at %d' % pos)
+        marker = data[pos + 1]
+        length = struct.unpack('>H', data[pos + 2:pos + 4])[0]
+        if marker == 0xC0:
+            height, width = struct.unpack('>HH', data[pos + 5:pos + 9])
+            return width, height
+        if marker in (0xC1, 0xC2, 0xC3, 0xC5, 0xC6, 0xC7, 0xC9, 0xCA, 0xCB, 0xCD, 0xCE, 0xCF):
+            raise ValueError('not a baseline jpeg (progressive files are not supported)')
+        if marker == 0xDA:
+            break
+        pos += 2 + length
+    raise ValueError('no SOF0 segment')
+
+
+def rgb565(path):
+    """Big-endian RGB565 pixels of any image Pillow opens, the byte order the LCD takes."""
+    try:
+        from PIL import Image
+    except ImportError:
+        raise ValueError('RGB565 conversion needs Pillow (pip install Pillow)')
+    img = Image.open(path).convert('RGB')
+    data = bytearray()
+    for r, g, b in img.getdata():
+        data += struct.pack('>H', ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3))
+    return img.size[0], img.size[1], bytes(data)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('output', help='partition image to write')
+    parser.add_argument('images', nargs='+', help='image files, the name is the file name without extension')
+    parser.add_argument('--raw', action='store_true', help='store the jpeg files as RGB565 too')
+    parser.add_argument('--size', type=lambda s: int(s, 0), help='pad to the partition size and check it fits')
+    args = parser.parse_args()
+
+    entries = []
+    blobs = []
+    offset = HEADER.size + ENTRY.size * len(args.images)
+    for path in args.images:
+        name = os.path.splitext(os.path.basename(path))[0].encode()
+        if len(name) > NAME_LEN:
+            sys.exit('%s: name longer than %d bytes' % (path, NAME_LEN))
+        jpeg = os.path.splitext(path)[1].lower() in ('.jpg', '.jpeg') and not args.raw
+        try:
+            if jpeg:
+                data = open(path, 'rb').read()
+                width, height = jpeg_size(data)
+            else:
+                width, height, data = rgb565(path)
+        except (ValueError, IOError) as e:
+            sys.exit('%s: %s' % (path, e))
+        offset = (offset + 3) & ~3
+        entries.append(ENTRY.pack(name, offset, len(data), width, height, FORMAT_JPEG if jpeg else FORMAT_RGB565))
+        blobs.append((offset, data))
+        offset += len(data)
+
+    image = bytearray(HEADER.pack(MAGIC, len(entries)) + b''.join(entries))
+    for offset, data in blobs:
+        image += b'\xff' * (offset - len(image)) + data
+    if args.size is not None:
+        if len(image) > args.size:
+            sys.exit('%d bytes do not fit the %d byte partition' % (len(image), args.size))
+        image += b'\xff' * (args.size - len(image))
+    open(args.output, 'wb').write(image)
+    print('%s: %d images, %d bytes' % (args.output, len(entries), len(image)))
+
+
+if __name__ == '__main__':
+    main()
@@ -7,9 +7,11 @@
 /* System Configurations */
 
 #define	JD_SZBUF		512	/* Size of stream input buffer */
-#define JD_FORMAT		0	/* Output pixel format 0:RGB888 (3 BYTE/pix), 1:RGB565 (1 WORD/pix) */
+#define JD_FORMAT		2	/* Output pixel format 0:RGB888 (3 BYTE/pix), 1:RGB565 (1 WORD/pix), 2:big-endian RGB565 straight to a frame buffer (jd_decomp_rgb565 only) */
 #define	JD_USE_SCALE	1	/* Use descaling feature for output */
 #define JD_TBLCLIP		1	/* Use table for saturation (might be a bit faster but increases 1K bytes of code size) */
+#define JD_FASTDECODE	1	/* Huffman decoding 0:bit by bit search, 1:JD_HUFFBIT bit lookup tables from the pool left after jd_prepare (up to 4K bytes) */
+#define JD_HUFFBIT		9	/* Code length resolved by the lookup tables, longer codes fall back to the search */
 
 /*---------------------------------------------------------------------------*/
 
@@ -65,6 +67,14 @@ struct JDEC {
 	uint8_t* huffbits[2][2];	/* Huffman bit distribution tables [id][dcac] */
 	uint16_t* huffcode[2][2];	/* Huffman code word tables [id][dcac] */
 	uint8_t* huffdata[2][2];	/* Huffman decoded data tables [id][dcac] */
+#if JD_FASTDECODE
+	uint16_t* hufflut[2][2];	/* Huffman lookup tables [id][dcac], code length << 8 | data, 0: longer code (null: no room in the pool) */
+	uint32_t wreg;				/* Bit stream working register */
+	uint8_t dbit;				/* Number of valid bits in wreg */
+	uint8_t marker;				/* Marker found while filling wreg, 0: none */
+	const uint8_t* inmem;		/* Memory input (jd_prepare_mem), null: read through infunc */
+	uint32_t inlen, inofs;		/* Size of the memory input and read offset in it */
+#endif
 	int32_t* qttbl[4];			/* Dequantizer tables [id] */
 	void* workbuf;				/* Working buffer for IDCT and RGB output */
 	uint8_t* mcubuf;			/* Working buffer for the MCU */
@@ -78,7 +88,22 @@ struct JDEC {
 
 /* TJpgDec API functions */
 JRESULT jd_prepare (JDEC*, uint16_t(*)(JDEC*,uint8_t*,uint16_t), void*, uint16_t, void*);
+#if JD_FASTDECODE
+JRESULT jd_prepare_mem (JDEC*, const uint8_t*, uint32_t, void*, uint16_t, void*);
+#endif
+#if JD_FORMAT < 2
 JRESULT jd_decomp (JDEC*, uint16_t(*)(JDEC*,void*,JRECT*), uint8_t);
+#else
+JRESULT jd_decomp_rgb565 (JDEC*, uint16_t*, uint16_t, uint16_t, uint16_t, uint8_t);
+JRESULT jd_decomp_stripe (JDEC*, uint16_t*(*)(JDEC*,uint16_t*,JRECT*), uint16_t*, uint16_t, uint16_t, uint16_t, uint8_t);
+#if JD_FASTDECODE
+/* Restart intervals of a memory input are independent, jd_decomp_rows decodes a range of them in a decompressor
+   object of its own (jd_clone) so that parts of one image can be decoded at the same time */
+uint16_t jd_restarts (JDEC*, uint32_t*, uint16_t);
+JRESULT jd_clone (JDEC*, const JDEC*, void*, uint16_t);
+JRESULT jd_decomp_rows (JDEC*, const uint32_t*, uint16_t, uint16_t, uint16_t*, uint16_t, uint16_t, uint16_t, uint8_t);
+#endif
+#endif
 
 
 #ifdef __cplusplus
@@ -20,6 +20,7 @@
 /----------------------------------------------------------------------------*/
 
 #include "tjpgd.h"
+#include <string.h>
 
 
 /*-----------------------------------------------*/
@@ -237,6 +238,48 @@ static int create_huffman_tbl (	/* 0:OK, !0:Failed */
 
 
 
+#if JD_FASTDECODE
+/*-----------------------------------------------------------------------*/
+/* Create huffman lookup tables from the rest of the memory pool         */
+/*-----------------------------------------------------------------------*/
+
+static void create_huffman_lut (
+	JDEC* jd			/* Pointer to the decompressor object */
+)
+{
+	uint16_t i, j, k, n, b, bl, cls, num, *pl;
+	const uint8_t *hb, *hd;
+	const uint16_t *hc;
+
+
+	for (cls = 2; cls--; ) {			/* AC tables first, they decode most of the codes */
+		for (num = 0; num < 2; num++) {
+			jd->hufflut[num][cls] = 0;
+			hb = jd->huffbits[num][cls];
+			if (!hb) continue;
+			pl = alloc_pool(jd, (uint16_t)(sizeof (uint16_t) << JD_HUFFBIT));
+			if (!pl) continue;			/* No room, this table falls back to the bit by bit search */
+			hc = jd->huffcode[num][cls];
+			hd = jd->huffdata[num][cls];
+			for (i = 0; i < 1 << JD_HUFFBIT; pl[i++] = 0) ;
+			for (j = 0, bl = 1; bl <= JD_HUFFBIT; bl++) {	/* Every code up to JD_HUFFBIT bits fills all entries it prefixes */
+				n = 1 << (JD_HUFFBIT - bl);
+				for (b = hb[bl - 1]; b; b--, j++) {
+					for (i = hc[j] << (JD_HUFFBIT - bl), k = 0; k < n; k++) {
+						pl[i + k] = (uint16_t)(bl << 8 | hd[j]);
+					}
+				}
+			}
+			jd->hufflut[num][cls] = pl;
+		}
+	}
+}
+
+
+
+
+#endif
+#if !JD_FASTDECODE
 /*-----------------------------------------------------------------------*/
 /* Extract N bits from input stream                                      */
 /*-----------------------------------------------------------------------*/
@@ -343,6 +386,148 @@ static int16_t huffext (	/* >=0: decoded data, <0: error code */
 
 	return 0 - (int16_t)JDR_FMT1;	/* Err: code not found (may be collapted data) */
 }
+#else
+/*-----------------------------------------------------------------------*/
+/* Get the next chunk of the input stream                                */
+/*-----------------------------------------------------------------------*/
+
+static uint16_t refill (	/* Number of bytes available at *dp (0: read error or end of stream) */
+	JDEC* jd,		/* Pointer to the decompressor object */
+	uint8_t** dp	/* Receives the read ptr */
+)
+{
+	uint32_t n;
+
+
+	if (jd->inmem) {	/* Memory input: read the source in place, nothing is copied */
+		n = jd->inlen - jd->inofs;
+		if (n > 0x8000) n = 0x8000;
+		*dp = (uint8_t*)jd->inmem + jd->inofs;	/* Never written, the fast decoder does not patch the stream */
+		jd->inofs += n;
+		return (uint16_t)n;
+	}
+	*dp = jd->inbuf;	/* Top of input buffer */
+	return jd->infunc(jd, jd->inbuf, JD_SZBUF);
+}
+
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Fill the working register with at least N bits from input stream     */
+/*-----------------------------------------------------------------------*/
+
+static int fillbits (	/* 0: OK, <0: error code */
+	JDEC* jd,		/* Pointer to the decompressor object */
+	uint8_t nbit	/* Number of bits required (1 to 16) */
+)
+{
+	uint8_t d, wbit, *dp;
+	uint16_t dc, i;
+	uint32_t w;
+
+
+	wbit = jd->dbit; w = jd->wreg; dc = jd->dctr; dp = jd->dptr;
+	while (wbit < nbit) {
+		if (jd->marker) {
+			d = 0xFF;			/* Stalled at a marker, feed stuff bits until the marker is processed */
+		} else {
+			for (i = 0; i < 2; i++) {	/* Get a byte and the trailing byte of a flag sequence */
+				if (!dc) {		/* No input data is available, re-fill input buffer */
+					dc = refill(jd, &dp);
+					if (!dc) return 0 - (int16_t)JDR_INP;	/* Err: read error or wrong stream termination */
+				} else {
+					dp++;		/* Next data ptr */
+				}
+				dc--;			/* Decrement number of available bytes */
+				if (i) {		/* In flag sequence? */
+					if (*dp != 0) jd->marker = *dp;	/* Not a data 0xFF but a marker */
+				} else if (*dp != 0xFF) {
+					break;
+				}
+			}
+			d = i ? 0xFF : *dp;
+		}
+		w = w << 8 | d;		/* Shift 8 bits in the working register */
+		wbit += 8;
+	}
+	jd->dbit = wbit; jd->wreg = w; jd->dctr = dc; jd->dptr = dp;
+
+	return 0;
+}
+
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Extract N bits from input stream                                      */
+/*-----------------------------------------------------------------------*/
+
+static int bitext (	/* >=0: extracted data, <0: error code */
+	JDEC* jd,		/* Pointer to the decompressor object */
+	int nbit		/* Number of bits to extract (1 to 11) */
+)
+{
+	int rc;
+
+
+	rc = fillbits(jd, (uint8_t)nbit);
+	if (rc) return rc;
+	jd->dbit -= nbit;
+
+	return (int)((jd->wreg >> jd->dbit) & ((1UL << nbit) - 1));
+}
+
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Extract a huffman decoded data from input stream                      */
+/*-----------------------------------------------------------------------*/
+
+static int16_t huffext (	/* >=0: decoded data, <0: error code */
+	JDEC* jd,				/* Pointer to the decompressor object */
+	const uint8_t* hbits,	/* Pointer to the bit distribution table */
+	const uint16_t* hcode,	/* Pointer to the code word table */
+	const uint8_t* hdata,	/* Pointer to the data table */
+	const uint16_t* hlut	/* Pointer to the lookup table (null: search all codes) */
+)
+{
+	uint8_t wbit;
+	uint16_t d, bl, nd;
+	uint32_t w;
+	int rc;
+
+
+	rc = fillbits(jd, 16);	/* Longest code */
+	if (rc) return (int16_t)rc;
+	wbit = jd->dbit; w = jd->wreg;
+	bl = 1;
+
+	if (hlut) {
+		d = hlut[(w >> (wbit - JD_HUFFBIT)) & ((1 << JD_HUFFBIT) - 1)];	/* Peek JD_HUFFBIT bits */
+		if (d) {					/* Hit in the short codes */
+			jd->dbit = wbit - (d >> 8);	/* Snip the code */
+			return d & 0xFF;		/* Return the decoded data */
+		}
+		for (nd = 0; bl <= JD_HUFFBIT; bl++) nd += *hbits++;	/* Skip the short codes */
+		hcode += nd; hdata += nd;
+	}
+
+	for ( ; bl <= 16; bl++) {		/* Search the code word in each bit length */
+		d = (uint16_t)((w >> (wbit - bl)) & ((1UL << bl) - 1));
+		for (nd = *hbits++; nd; nd--) {
+			if (d == *hcode++) {	/* Matched? */
+				jd->dbit = wbit - bl;
+				return *hdata;		/* Return the decoded data */
+			}
+			hdata++;
+		}
+	}
+
+	return 0 - (int16_t)JDR_FMT1;	/* Err: code not found (may be collapted data) */
+}
+#endif
 
 
 
@@ -459,6 +644,118 @@ static void block_idct (
 
 
 
+/*-----------------------------------------------------------------------*/
+/* Inverse-DCT of a block with only the top-left 4x4 elements non-zero   */
+/*-----------------------------------------------------------------------*/
+
+static void block_idct4 (
+	int32_t* src,	/* Input block data, zero except src[0..3], src[8..11], src[16..19] and src[24..27] */
+	uint8_t* dst	/* Pointer to the destination to store the block as byte array */
+)
+{
+	const int32_t M13 = (int32_t)(1.41421*4096), M2 = (int32_t)(1.08239*4096), M4 = (int32_t)(2.61313*4096), M5 = (int32_t)(1.84776*4096);
+	int32_t v0, v1, v2, v3, v4, v5, v6, v7;
+	int32_t t11, t12, t13;
+	uint16_t i;
+
+	/* Same flow as block_idct with the zero elements dropped, results are identical */
+
+	/* Process columns, the right four are all zero */
+	for (i = 0; i < 4; i++) {
+		v0 = src[8 * 0];	/* Get even elements */
+		v1 = src[8 * 2];
+
+		t11 = (v1 * M13 >> 12) - v1;	/* Process the even elements */
+		v3 = v0 - v1;
+		v2 = v0 - t11;
+		v1 = t11 + v0;
+		v0 = v0 + src[8 * 2];
+
+		v5 = src[8 * 1];	/* Get odd elements */
+		v7 = src[8 * 3];
+
+		t12 = -v7;			/* Process the odd elements */
+		t13 = (v5 + t12) * M5 >> 12;
+		v4 = t13 - (v5 * M2 >> 12);
+		v6 = t13 - (t12 * M4 >> 12) - (v7 + v5);
+		v5 = ((v5 - v7) * M13 >> 12) - v6;
+		v7 += src[8 * 1];
+		v4 -= v5;
+
+		src[8 * 0] = v0 + v7;	/* Write-back transformed values */
+		src[8 * 7] = v0 - v7;
+		src[8 * 1] = v1 + v6;
+		src[8 * 6] = v1 - v6;
+		src[8 * 2] = v2 + v5;
+		src[8 * 5] = v2 - v5;
+		src[8 * 3] = v3 + v4;
+		src[8 * 4] = v3 - v4;
+
+		src++;	/* Next column */
+	}
+
+	/* Process rows, the right four elements of each are zero */
+	src -= 4;
+	for (i = 0; i < 8; i++) {
+		v0 = src[0] + (128L << 8);	/* Get even elements (remove DC offset (-128) here) */
+		v1 = src[2];
+
+		t11 = (v1 * M13 >> 12) - v1;	/* Process the even elements */
+		v3 = v0 - v1;
+		v2 = v0 - t11;
+		v1 = t11 + v0;
+		v0 = v0 + src[2];
+
+		v5 = src[1];				/* Get odd elements */
+		v7 = src[3];
+
+		t12 = -v7;					/* Process the odd elements */
+		t13 = (v5 + t12) * M5 >> 12;
+		v4 = t13 - (v5 * M2 >> 12);
+		v6 = t13 - (t12 * M4 >> 12) - (v7 + v5);
+		v5 = ((v5 - v7) * M13 >> 12) - v6;
+		v7 += src[1];
+		v4 -= v5;
+
+		dst[0] = BYTECLIP((v0 + v7) >> 8);	/* Descale the transformed values 8 bits and output */
+		dst[7] = BYTECLIP((v0 - v7) >> 8);
+		dst[1] = BYTECLIP((v1 + v6) >> 8);
+		dst[6] = BYTECLIP((v1 - v6) >> 8);
+		dst[2] = BYTECLIP((v2 + v5) >> 8);
+		dst[5] = BYTECLIP((v2 - v5) >> 8);
+		dst[3] = BYTECLIP((v3 + v4) >> 8);
+		dst[4] = BYTECLIP((v3 - v4) >> 8);
+		dst += 8;
+
+		src += 8;	/* Next row */
+	}
+}
+
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Inverse-DCT of a block with only the DC element: a flat block         */
+/*-----------------------------------------------------------------------*/
+
+static void block_dc (
+	int32_t dc,		/* De-quantized and pre-scaled DC element */
+	uint8_t* dst	/* Pointer to the destination, 4 byte aligned */
+)
+{
+	uint32_t v, *d = (uint32_t*)dst;
+	uint16_t i;
+
+
+	v = BYTECLIP((dc + (128L << 8)) >> 8) * 0x01010101UL;	/* What block_idct gives for every pixel */
+	for (i = 0; i < 64 / 4; i += 4) {	/* Four pixels per store */
+		d[i + 0] = v; d[i + 1] = v; d[i + 2] = v; d[i + 3] = v;
+	}
+}
+
+
+
+
 /*-----------------------------------------------------------------------*/
 /* Load all blocks in the MCU into working buffer                        */
 /*-----------------------------------------------------------------------*/
@@ -469,10 +766,13 @@ static JRESULT mcu_load (
 {
 	int32_t *tmp = (int32_t*)jd->workbuf;	/* Block working buffer for de-quantize and IDCT */
 	int b, d, e;
-	uint16_t blk, nby, nbc, i, z, id, cmp;
+	uint16_t blk, nby, nbc, i, z, id, cmp, ac;
 	uint8_t *bp;
 	const uint8_t *hb, *hd;
 	const uint16_t *hc;
+#if JD_FASTDECODE
+	const uint16_t *hl;
+#endif
 	const int32_t *dqf;
 
 
@@ -488,7 +788,11 @@ static JRESULT mcu_load (
 		hb = jd->huffbits[id][0];				/* Huffman table for the DC element */
 		hc = jd->huffcode[id][0];
 		hd = jd->huffdata[id][0];
+#if JD_FASTDECODE
+		b = huffext(jd, hb, hc, hd, jd->hufflut[id][0]);	/* Extract a huffman coded data (bit length) */
+#else
 		b = huffext(jd, hb, hc, hd);			/* Extract a huffman coded data (bit length) */
+#endif
 		if (b < 0) return 0 - b;				/* Err: invalid code or input */
 		d = jd->dcv[cmp];						/* DC value of previous block */
 		if (b) {								/* If there is any difference from previous block */
@@ -501,15 +805,23 @@ static JRESULT mcu_load (
 		}
 		dqf = jd->qttbl[jd->qtid[cmp]];			/* De-quantizer table ID for this component */
 		tmp[0] = d * dqf[0] >> 8;				/* De-quantize, apply scale factor of Arai algorithm and descale 8 bits */
+		ac = 0;									/* OR of the raster indexes of the non-zero AC elements */
 
 		/* Extract following 63 AC elements from input stream */
 		for (i = 1; i < 64; tmp[i++] = 0) ;		/* Clear rest of elements */
 		hb = jd->huffbits[id][1];				/* Huffman table for the AC elements */
 		hc = jd->huffcode[id][1];
 		hd = jd->huffdata[id][1];
+#if JD_FASTDECODE
+		hl = jd->hufflut[id][1];
+#endif
 		i = 1;					/* Top of the AC elements */
 		do {
+#if JD_FASTDECODE
+			b = huffext(jd, hb, hc, hd, hl);	/* Extract a huffman coded value (zero runs and bit length) */
+#else
 			b = huffext(jd, hb, hc, hd);		/* Extract a huffman coded value (zero runs and bit length) */
+#endif
 			if (b == 0) break;					/* EOB? */
 			if (b < 0) return 0 - b;			/* Err: invalid code or input error */
 			z = (uint16_t)b >> 4;				/* Number of leading zero elements */
@@ -523,14 +835,22 @@ static JRESULT mcu_load (
 				b = 1 << (b - 1);				/* MSB position */
 				if (!(d & b)) d -= (b << 1) - 1;/* Restore negative value if needed */
 				z = ZIG(i);						/* Zigzag-order to raster-order converted index */
+				if (JD_USE_SCALE && jd->scale && (z & 0x24)) continue;	/* Drop what a scaled output cannot show (beyond the top-left 4x4) */
 				tmp[z] = d * dqf[z] >> 8;		/* De-quantize, apply scale factor of Arai algorithm and descale 8 bits */
+				ac |= z;
 			}
 		} while (++i < 64);		/* Next AC element */
 
 		if (JD_USE_SCALE && jd->scale == 3) {
 			*bp = (uint8_t)((*tmp / 256) + 128);	/* If scale ratio is 1/8, IDCT can be ommited and only DC element is used */
 		} else {
-			block_idct(tmp, bp);		/* Apply IDCT and store the block to the MCU buffer */
+			if (!ac) {					/* Most blocks of flat areas */
+				block_dc(tmp[0], bp);
+			} else if (!(ac & 0x24)) {	/* Column and row below 4: all in the top-left 4x4 */
+				block_idct4(tmp, bp);
+			} else {
+				block_idct(tmp, bp);	/* Apply IDCT and store the block to the MCU buffer */
+			}
 		}
 
 		bp += 64;				/* Next block */
@@ -542,6 +862,7 @@ static JRESULT mcu_load (
 
 
 
+#if JD_FORMAT < 2
 /*-----------------------------------------------------------------------*/
 /* Output an MCU: Convert YCrCb to RGB and output it in RGB form         */
 /*-----------------------------------------------------------------------*/
@@ -688,6 +1009,126 @@ static JRESULT mcu_output (
 	/* Output the RGB rectangular */
 	return outfunc(jd, jd->workbuf, &rect) ? JDR_OK : JDR_INTR;
 }
+#else
+/*-----------------------------------------------------------------------*/
+/* Average each square of a block into the top-left of the block         */
+/*-----------------------------------------------------------------------*/
+
+static void block_shrink (
+	uint8_t* blk,	/* 8x8 block, the result is (8 >> sx) x (8 >> sy) with a row pitch of 8 */
+	uint8_t sx,		/* Horizontal shift (0 to 2) */
+	uint8_t sy		/* Vertical shift (0 to 2) */
+)
+{
+	uint16_t x, y, i, j, a;
+	uint8_t *p;
+
+
+	if (!sx && !sy) return;
+	for (y = 0; y < 8 >> sy; y++) {
+		for (x = 0; x < 8 >> sx; x++) {	/* Every square is read before anything above or left of it is written */
+			p = blk + (y << sy) * 8 + (x << sx);
+			for (a = j = 0; j < 1 << sy; j++, p += 8) {
+				for (i = 0; i < 1 << sx; i++) a += p[i];
+			}
+			blk[y * 8 + x] = (uint8_t)(a >> (sx + sy));
+		}
+	}
+}
+
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Output an MCU: Convert YCrCb straight to big-endian RGB565 in place   */
+/*-----------------------------------------------------------------------*/
+
+static void mcu_output_rgb565 (
+	JDEC* jd,		/* Pointer to the decompressor object */
+	uint16_t* fbuf,	/* Frame buffer, pixel (x, y) of the scaled image is at fbuf[(y - top) * stride + x] */
+	uint16_t stride,
+	uint16_t top,	/* Row of the scaled image at the top of fbuf */
+	uint16_t fw,	/* Pixels beyond fw x fh of the scaled image are cropped */
+	uint16_t fh,
+	uint16_t x,		/* MCU position in the image (left of the MCU) */
+	uint16_t y		/* MCU position in the image (top of the MCU) */
+)
+{
+	const int16_t CVACC = (sizeof (int16_t) > 2) ? 1024 : 128;
+	uint16_t ix, iy, mx, my, rx, ry, v, i, n, s, m;
+	int16_t yy, cb, cr;
+	uint8_t *py, *pc, r, g, b;
+	uint16_t *d;
+
+
+	mx = jd->msx * 8; my = jd->msy * 8;					/* MCU size (pixel) */
+	rx = (x + mx <= jd->width) ? mx : jd->width - x;	/* Output rectangular size (it may be clipped at right/bottom end) */
+	ry = (y + my <= jd->height) ? my : jd->height - y;
+	if (JD_USE_SCALE) {
+		rx >>= jd->scale; ry >>= jd->scale;
+		x >>= jd->scale; y >>= jd->scale;
+	}
+	if (x >= fw || y >= fh) return;						/* Out of the frame buffer */
+	if (x + rx > fw) rx = fw - x;
+	if (y + ry > fh) ry = fh - y;
+
+	n = jd->msx * jd->msy;				/* Number of Y blocks */
+	s = 3 - jd->scale;					/* Pixels of a shrunk block: 1 << s square */
+	m = (jd->scale < 3) ? 0xFFFF : 0;	/* 1/8: one chroma value for the MCU */
+	if (JD_USE_SCALE && jd->scale && jd->scale < 3) {	/* Average the square each pixel covers, at 1/8 mcu_load left only the DC value at the top of each block */
+		for (i = 0; i < n; i++) block_shrink(jd->mcubuf + i * 64, jd->scale, jd->scale);
+		block_shrink(jd->mcubuf + n * 64, jd->scale - (mx >> 4), jd->scale - (my >> 4));
+		block_shrink(jd->mcubuf + n * 64 + 64, jd->scale - (mx >> 4), jd->scale - (my >> 4));
+	}
+
+	for (iy = 0; iy < ry; iy++) {
+		d = fbuf + (uint32_t)(y + iy - top) * stride + x;
+		if (JD_USE_SCALE && jd->scale) {
+			py = jd->mcubuf + (iy >> s) * jd->msx * 64 + (iy & ((1 << s) - 1)) * 8;
+			pc = jd->mcubuf + n * 64 + ((iy * 8) & m);
+			for (ix = 0; ix < rx; ix++) {
+				yy = py[(ix >> s) * 64 + (ix & ((1 << s) - 1))];	/* Get Y component */
+				cb = pc[ix & m] - 128; 	/* Get Cb/Cr component and restore right level */
+				cr = pc[(ix & m) + 64] - 128;
+
+				/* Convert YCbCr to RGB565 */
+				r = BYTECLIP(yy + ((int16_t)(1.402 * CVACC) * cr) / CVACC);
+				g = BYTECLIP(yy - ((int16_t)(0.344 * CVACC) * cb + (int16_t)(0.714 * CVACC) * cr) / CVACC);
+				b = BYTECLIP(yy + ((int16_t)(1.772 * CVACC) * cb) / CVACC);
+				v = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+				*d++ = (v >> 8) | (v << 8);	/* Big-endian, as the LCD takes it */
+			}
+			continue;
+		}
+		pc = jd->mcubuf;
+		py = pc + iy * 8;
+		if (my == 16) {		/* Double block height? */
+			pc += 64 * 4 + (iy >> 1) * 8;
+			if (iy >= 8) py += 64;
+		} else {			/* Single block height */
+			pc += mx * 8 + iy * 8;
+		}
+		for (ix = 0; ix < rx; ix++) {	/* Truncated pixels are never converted */
+			cb = pc[0] - 128; 	/* Get Cb/Cr component and restore right level */
+			cr = pc[64] - 128;
+			if (mx == 16) {					/* Double block width? */
+				if (ix == 8) py += 64 - 8;	/* Jump to next block if double block heigt */
+				pc += ix & 1;				/* Increase chroma pointer every two pixels */
+			} else {						/* Single block width */
+				pc++;						/* Increase chroma pointer every pixel */
+			}
+			yy = *py++;			/* Get Y component */
+
+			/* Convert YCbCr to RGB565 */
+			r = BYTECLIP(yy + ((int16_t)(1.402 * CVACC) * cr) / CVACC);
+			g = BYTECLIP(yy - ((int16_t)(0.344 * CVACC) * cb + (int16_t)(0.714 * CVACC) * cr) / CVACC);
+			b = BYTECLIP(yy + ((int16_t)(1.772 * CVACC) * cb) / CVACC);
+			v = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+			*d++ = (v >> 8) | (v << 8);	/* Big-endian, as the LCD takes it */
+		}
+	}
+}
+#endif
 
 
 
@@ -709,10 +1150,26 @@ static JRESULT restart (
 	/* Discard padding bits and get two bytes from the input stream */
 	dp = jd->dptr; dc = jd->dctr;
 	d = 0;
+#if JD_FASTDECODE
+	jd->dbit = 0;
+	if (jd->marker) {	/* The marker has been read ahead by fillbits */
+		d = 0xFF00 | jd->marker;
+		jd->marker = 0;
+		i = 2;
+	} else {
+		i = 0;
+	}
+	for ( ; i < 2; i++) {
+#else
 	for (i = 0; i < 2; i++) {
+#endif
 		if (!dc) {	/* No input data is available, re-fill input buffer */
+#if JD_FASTDECODE
+			dc = refill(jd, &dp);
+#else
 			dp = jd->inbuf;
 			dc = jd->infunc(jd, dp, JD_SZBUF);
+#endif
 			if (!dc) return JDR_INP;
 		} else {
 			dp++;
@@ -737,13 +1194,13 @@ static JRESULT restart (
 
 
 /*-----------------------------------------------------------------------*/
-/* Analyze the JPEG image and Initialize decompressor object             */
+/* Analyze the JPEG image and Initialize decompressor object (common)    */
 /*-----------------------------------------------------------------------*/
 
 #define	LDB_WORD(ptr)		(uint16_t)(((uint16_t)*((uint8_t*)(ptr))<<8)|(uint16_t)*(uint8_t*)((ptr)+1))
 
 
-JRESULT jd_prepare (
+static JRESULT prepare (
 	JDEC* jd,			/* Blank decompressor object */
 	uint16_t (*infunc)(JDEC*, uint8_t*, uint16_t),	/* JPEG strem input function */
 	void* pool,			/* Working buffer for the decompression session */
@@ -872,15 +1329,26 @@ JRESULT jd_prepare (
 			/* Allocate working buffer for MCU and RGB */
 			n = jd->msy * jd->msx;						/* Number of Y blocks in the MCU */
 			if (!n) return JDR_FMT1;					/* Err: SOF0 has not been loaded */
+#if JD_FORMAT < 2
 			len = n * 64 * 2 + 64;						/* Allocate buffer for IDCT and RGB output */
 			if (len < 256) len = 256;					/* but at least 256 byte is required for IDCT */
+#else
+			len = 256;									/* Only IDCT, pixels go straight to the frame buffer */
+#endif
 			jd->workbuf = alloc_pool(jd, len);			/* and it may occupy a part of following MCU working buffer for RGB output */
 			if (!jd->workbuf) return JDR_MEM1;			/* Err: not enough memory */
 			jd->mcubuf = (uint8_t*)alloc_pool(jd, (uint16_t)((n + 2) * 64));	/* Allocate MCU working buffer */
 			if (!jd->mcubuf) return JDR_MEM1;			/* Err: not enough memory */
 
 			/* Pre-load the JPEG data to extract it from the bit stream */
+#if JD_FASTDECODE
+			create_huffman_lut(jd);						/* Lookup tables take what is left of the pool */
+			jd->wreg = 0; jd->dbit = 0; jd->marker = 0;
+#endif
 			jd->dptr = seg; jd->dctr = 0; jd->dmsk = 0;	/* Prepare to read bit stream */
+#if JD_FASTDECODE
+			if (jd->inmem) ofs = 0;						/* Memory input: the first refill points right at the stream */
+#endif
 			if (ofs %= JD_SZBUF) {						/* Align read offset to JD_SZBUF */
 				jd->dctr = jd->infunc(jd, seg + ofs, (uint16_t)(JD_SZBUF - ofs));
 				jd->dptr = seg + ofs - 1;
@@ -915,6 +1383,74 @@ JRESULT jd_prepare (
 
 
 
+/*-----------------------------------------------------------------------*/
+/* Analyze the JPEG image and Initialize decompressor object             */
+/*-----------------------------------------------------------------------*/
+
+JRESULT jd_prepare (
+	JDEC* jd,			/* Blank decompressor object */
+	uint16_t (*infunc)(JDEC*, uint8_t*, uint16_t),	/* JPEG strem input function */
+	void* pool,			/* Working buffer for the decompression session */
+	uint16_t sz_pool,	/* Size of working buffer */
+	void* dev			/* I/O device identifier for the session */
+)
+{
+#if JD_FASTDECODE
+	jd->inmem = 0;
+#endif
+	return prepare(jd, infunc, pool, sz_pool, dev);
+}
+
+
+
+
+#if JD_FASTDECODE
+/*-----------------------------------------------------------------------*/
+/* Stream input function of memory input, used for the headers only    */
+/*-----------------------------------------------------------------------*/
+
+static uint16_t mem_infunc (
+	JDEC* jd,		/* Pointer to the decompressor object */
+	uint8_t* buf,	/* Destination, null: skip */
+	uint16_t nd		/* Number of bytes to read */
+)
+{
+	if (nd > jd->inlen - jd->inofs) nd = (uint16_t)(jd->inlen - jd->inofs);
+	if (buf) memcpy(buf, jd->inmem + jd->inofs, nd);
+	jd->inofs += nd;
+
+	return nd;
+}
+
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Analyze a JPEG image in memory (e.g. mmapped flash)                   */
+/*-----------------------------------------------------------------------*/
+
+JRESULT jd_prepare_mem (
+	JDEC* jd,			/* Blank decompressor object */
+	const uint8_t* data,	/* JPEG stream, it must stay mapped until the decompression is done */
+	uint32_t len,		/* Size of the JPEG stream, 32-bit offsets */
+	void* pool,			/* Working buffer for the decompression session */
+	uint16_t sz_pool,	/* Size of working buffer */
+	void* dev			/* I/O device identifier for the session */
+)
+{
+	if (!data) return JDR_PAR;
+
+	jd->inmem = data;
+	jd->inlen = len;
+	jd->inofs = 0;
+	return prepare(jd, mem_infunc, pool, sz_pool, dev);	/* The entropy coded data is then read in place */
+}
+#endif
+
+
+
+
+#if JD_FORMAT < 2
 /*-----------------------------------------------------------------------*/
 /* Start to decompress the JPEG picture                                  */
 /*-----------------------------------------------------------------------*/
@@ -955,6 +1491,206 @@ JRESULT jd_decomp (
 
 	return rc;
 }
+#else
+/*-----------------------------------------------------------------------*/
+/* Decompress MCU rows into a frame buffer or a stripe buffer            */
+/*-----------------------------------------------------------------------*/
+
+static JRESULT decomp_rgb565 (
+	JDEC* jd,								/* Initialized decompression object */
+	uint16_t* (*stripefunc)(JDEC*, uint16_t*, JRECT*),	/* Stripe output function, null: fbuf holds the whole window */
+	uint16_t* fbuf,
+	uint16_t stride,
+	uint16_t fw,
+	uint16_t fh,
+	uint8_t scale,
+	uint16_t ys,	/* First MCU row, the start of the stream or of a restart interval */
+	uint16_t ye,	/* MCU row to stop at */
+	uint16_t rsn	/* Number of the next RSTn marker */
+)
+{
+	uint16_t x, y, mx, my, ry, top;
+	uint16_t rst, rsc;
+	uint32_t yend;
+	JRESULT rc;
+	JRECT rect;
+
+
+	if (!fbuf || !fw || !fh || stride < fw || scale > (JD_USE_SCALE ? 3 : 0)) return JDR_PAR;
+	jd->scale = scale;
+
+	mx = jd->msx * 8; my = jd->msy * 8;			/* Size of the MCU (pixel) */
+	yend = (uint32_t)ye * my;
+
+	jd->dcv[2] = jd->dcv[1] = jd->dcv[0] = 0;	/* Initialize DC values */
+	rst = 0; rsc = rsn;
+
+	rc = JDR_OK;
+	for (y = ys * my; y < jd->height && y < yend && (y >> scale) < fh; y += my) {	/* Vertical loop of MCUs, stop below fbuf */
+		top = stripefunc ? y >> scale : 0;		/* A stripe holds one row of MCUs */
+		for (x = 0; x < jd->width; x += mx) {	/* Horizontal loop of MCUs */
+			if (jd->nrst && rst++ == jd->nrst) {	/* Process restart interval if enabled */
+				rc = restart(jd, rsc++);
+				if (rc != JDR_OK) return rc;
+				rst = 1;
+			}
+			rc = mcu_load(jd);					/* Load an MCU (decompress huffman coded stream and apply IDCT) */
+			if (rc != JDR_OK) return rc;
+			mcu_output_rgb565(jd, fbuf, stride, top, fw, fh, x, y);	/* Color space conversion straight into the frame buffer */
+		}
+		if (stripefunc) {						/* Hand over the finished stripe */
+			ry = ((y + my <= jd->height) ? my : jd->height - y) >> scale;	/* Rows of this stripe, clipped as mcu_output does */
+			if (top + ry > fh) ry = fh - top;
+			rect.left = 0; rect.right = ((jd->width >> scale) < fw ? (jd->width >> scale) : fw) - 1;
+			rect.top = top; rect.bottom = top + ry - 1;
+			if (ry) {							/* Not rounded off to nothing */
+				fbuf = stripefunc(jd, fbuf, &rect);	/* Buffer for the next stripe */
+				if (!fbuf) return JDR_INTR;
+			}
+		}
+	}
+
+	return rc;
+}
+
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Start to decompress the JPEG picture into a big-endian RGB565 buffer  */
+/*-----------------------------------------------------------------------*/
+
+JRESULT jd_decomp_rgb565 (
+	JDEC* jd,								/* Initialized decompression object */
+	uint16_t* fbuf,							/* Frame buffer (window) to receive the scaled image */
+	uint16_t stride,						/* Pixels from one row of fbuf to the next */
+	uint16_t fw,							/* Size of the frame buffer, the scaled image is cropped to it */
+	uint16_t fh,
+	uint8_t scale							/* Output de-scaling factor (0 to 3) */
+)
+{
+	return decomp_rgb565(jd, 0, fbuf, stride, fw, fh, scale, 0, 0xFFFF, 0);
+}
+
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Start to decompress the JPEG picture one row of MCUs at a time        */
+/*-----------------------------------------------------------------------*/
+
+JRESULT jd_decomp_stripe (
+	JDEC* jd,								/* Initialized decompression object */
+	uint16_t* (*stripefunc)(JDEC*, uint16_t*, JRECT*),	/* Gets each finished stripe, returns the buffer for the next one (null: abort) */
+	uint16_t* sbuf,							/* Stripe buffer of (jd->msy * 8 >> scale) rows */
+	uint16_t stride,						/* Pixels from one row of a stripe buffer to the next */
+	uint16_t fw,							/* Size of the output, the scaled image is cropped to it */
+	uint16_t fh,
+	uint8_t scale							/* Output de-scaling factor (0 to 3) */
+)
+{
+	if (!stripefunc) return JDR_PAR;
+
+	return decomp_rgb565(jd, stripefunc, sbuf, stride, fw, fh, scale, 0, 0xFFFF, 0);
+}
 
 
 
+
+#if JD_FASTDECODE
+/*-----------------------------------------------------------------------*/
+/* Locate the restart intervals of a memory input                        */
+/*-----------------------------------------------------------------------*/
+
+uint16_t jd_restarts (	/* Number of intervals found (0: no restart interval) */
+	JDEC* jd,			/* Decompressor object of jd_prepare_mem, before any decompression */
+	uint32_t* rstofs,	/* Receives the stream offset of each interval, [0] is the start of the entropy coded data */
+	uint16_t n			/* Size of rstofs, the scan stops once it is full */
+)
+{
+	uint32_t i;
+	uint16_t cnt;
+
+
+	if (!jd->inmem || !jd->nrst || !n) return 0;
+
+	rstofs[0] = jd->inofs; cnt = 1;				/* jd_prepare_mem stopped right after the SOS segment */
+	for (i = jd->inofs; i + 1 < jd->inlen && cnt < n; i++) {
+		if (jd->inmem[i] != 0xFF) continue;
+		if ((jd->inmem[i + 1] & 0xF8) == 0xD0) {	/* RSTn, the next interval follows it */
+			rstofs[cnt++] = i + 2;
+			i++;
+		} else if (jd->inmem[i + 1] == 0xD9) {		/* EOI */
+			break;
+		}											/* Stuffed 0x00 or fill 0xFF */
+	}
+
+	return cnt;
+}
+
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Second decompressor object on the tables of a prepared one            */
+/*-----------------------------------------------------------------------*/
+
+JRESULT jd_clone (
+	JDEC* jd,			/* Blank decompressor object */
+	const JDEC* src,	/* Decompressor object of jd_prepare_mem, its tables are shared and must outlive the copy */
+	void* pool,			/* Work memory for the IDCT and MCU buffers of the copy, 1K is plenty */
+	uint16_t sz_pool
+)
+{
+	uint16_t n;
+
+
+	if (!src->inmem || !pool) return JDR_PAR;
+
+	*jd = *src;									/* Tables, geometry and input are read only from here on */
+	jd->pool = pool;
+	jd->sz_pool = sz_pool;
+	n = jd->msy * jd->msx;
+	jd->workbuf = alloc_pool(jd, 256);			/* Only IDCT, as in prepare */
+	if (!jd->workbuf) return JDR_MEM1;
+	jd->mcubuf = (uint8_t*)alloc_pool(jd, (uint16_t)((n + 2) * 64));
+	if (!jd->mcubuf) return JDR_MEM1;
+
+	return JDR_OK;
+}
+
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Decompress a range of MCU rows into a frame buffer                    */
+/*-----------------------------------------------------------------------*/
+
+JRESULT jd_decomp_rows (
+	JDEC* jd,				/* Decompressor object of jd_prepare_mem or jd_clone */
+	const uint32_t* rstofs,	/* Interval offsets of jd_restarts, up to the one row starts */
+	uint16_t row,			/* First MCU row, (row * MCUs per row) must be a multiple of the restart interval */
+	uint16_t nrow,			/* Number of MCU rows */
+	uint16_t* fbuf,			/* As jd_decomp_rgb565: the whole window, only the rows of the range are written */
+	uint16_t stride,
+	uint16_t fw,
+	uint16_t fh,
+	uint8_t scale
+)
+{
+	uint32_t mcu, k;
+
+
+	if (!jd->inmem || !rstofs || !jd->nrst) return JDR_PAR;
+
+	mcu = (uint32_t)row * ((jd->width + jd->msx * 8 - 1) / (jd->msx * 8));	/* MCUs before the range */
+	if (mcu % jd->nrst) return JDR_PAR;			/* Err: the range does not start an interval */
+	k = mcu / jd->nrst;
+
+	jd->inofs = rstofs[k];						/* Restart the bit stream at the interval */
+	jd->dctr = 0; jd->wreg = 0; jd->dbit = 0; jd->marker = 0;
+
+	return decomp_rgb565(jd, 0, fbuf, stride, fw, fh, scale, row, row + nrow, (uint16_t)k);	/* Interval k ends with RST(k) */
+}
+#endif
+#endif
@@ -20,7 +20,10 @@ format if you want to use a different image file.
 #include "decode_image.h"
 #include "tjpgd.h"
 #include "esp_log.h"
-#include <string.h>
+#include "esp_heap_caps.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
 
 //Reference the binary-included jpeg file
 extern const uint8_t image_jpg_start[] asm("_binary_image_jpg_start");
@@ -32,118 +35,242 @@ extern const uint8_t image_jpg_end[] asm("_binary_image_jpg_end");
 
 const char *TAG = "ImageDec";
 
-//Data that is passed from the decoder function to the infunc/outfunc functions.
+//Data that is passed from the decoder function to the stripefunc function. The jpeg itself is
+//read in place (jd_prepare_mem), straight from flash or RAM without copying.
 typedef struct {
-    const unsigned char *inData; //Pointer to jpeg data
-    uint16_t inPos;              //Current position in jpeg data
-    uint16_t **outData;          //Array of IMAGE_H pointers to arrays of IMAGE_W 16-bit pixel values
-    int outW;                    //Width of the resulting file
-    int outH;                    //Height of the resulting file
+    decode_image_stripe_cb_t stripeCb; //Stripe consumer, NULL when decoding into a window
+    void *stripeArg;
 } JpegDev;
 
-//Input function for jpeg decoder. Just returns bytes from the inData field of the JpegDev structure.
-static uint16_t infunc(JDEC *decoder, uint8_t *buf, uint16_t len)
+//Stripe function for jpeg decoder. Hands a finished row of MCUs to the stripe consumer, which
+//returns the buffer for the next one.
+static uint16_t *stripefunc(JDEC *decoder, uint16_t *stripe, JRECT *rect)
 {
-    //Read bytes from input file
     JpegDev *jd = (JpegDev *)decoder->device;
-    if (buf != NULL) {
-        memcpy(buf, jd->inData + jd->inPos, len);
-    }
-    jd->inPos += len;
-    return len;
+    return jd->stripeCb(stripe, rect->top, rect->bottom - rect->top + 1, jd->stripeArg);
 }
 
-//Output function. Re-encodes the RGB888 data from the decoder as big-endian RGB565 and
-//stores it in the outData array of the JpegDev structure.
-static uint16_t outfunc(JDEC *decoder, void *bitmap, JRECT *rect)
+//Size of the work space for the jpeg decoder. The decoder writes big-endian RGB565 straight
+//into the image (JD_FORMAT 2), so it needs no RGB work buffer. The last 4K hold the four
+//Huffman lookup tables (JD_FASTDECODE), with less the decoder falls back to the slower search.
+#define WORKSZ (2780 + 4096)
+
+#if CONFIG_JPEG_PARALLEL
+//Work space of the second decoder, only its IDCT and MCU buffers: the tables are the first decoder's.
+#define CLONESZ 1024
+
+//A range of MCU rows for a decoder of its own.
+typedef struct {
+    JDEC *decoder;
+    const uint32_t *rstofs;
+    uint16_t row;
+    uint16_t nrow;
+    uint16_t *buf;
+    int stride;
+    int width;
+    int height;
+    uint8_t scale;
+    JRESULT result;
+    SemaphoreHandle_t done;
+} DecodeRows;
+
+static void decode_rows(DecodeRows *part)
 {
-    JpegDev *jd = (JpegDev *)decoder->device;
-    uint8_t *in = (uint8_t *)bitmap;
-    for (int y = rect->top; y <= rect->bottom; y++) {
-        for (int x = rect->left; x <= rect->right; x++) {
-            //We need to convert the 3 bytes in `in` to a rgb565 value.
-            uint16_t v = 0;
-            v |= ((in[0] >> 3) << 11);
-            v |= ((in[1] >> 2) << 5);
-            v |= ((in[2] >> 3) << 0);
-            //The LCD wants the 16-bit value in big-endian, so swap bytes
-            v = (v >> 8) | (v << 8);
-            jd->outData[y][x] = v;
-            in += 3;
+    part->result = jd_decomp_rows(part->decoder, part->rstofs, part->row, part->nrow, part->buf, part->stride,
+                                  part->width, part->height, part->scale);
+}
+
+static void decode_rows_task(void *arg)
+{
+    DecodeRows *part = (DecodeRows *)arg;
+    decode_rows(part);
+    xSemaphoreGive(part->done);
+    vTaskDelete(NULL);
+}
+
+//Split the MCU rows in the window at the restart interval nearest the middle and decode the lower part on the
+//other core. Returns JDR_PAR without decoding anything when there is no such interval.
+static JRESULT decode_parallel(JDEC *decoder, uint16_t *buf, int stride, int width, int height, uint8_t scale)
+{
+    int my = decoder->msy * 8;
+    int mcur = (decoder->width + decoder->msx * 8 - 1) / (decoder->msx * 8);
+    int h = decoder->height < (height << scale) ? decoder->height : (height << scale);
+    int rows = (h + my - 1) / my;
+    int split = 0;
+    if (!decoder->nrst) {
+        return JDR_PAR;
+    }
+    for (int d = 0; d < rows / 2 && !split; d++) {
+        if (rows / 2 - d > 0 && ((rows / 2 - d) * mcur) % decoder->nrst == 0) {
+            split = rows / 2 - d;
+        } else if (rows / 2 + d < rows && ((rows / 2 + d) * mcur) % decoder->nrst == 0) {
+            split = rows / 2 + d;
         }
     }
-    return 1;
-}
+    if (!split) {
+        return JDR_PAR;
+    }
+    //Only the intervals up to the split are needed, the scan stops there
+    int k = split * mcur / decoder->nrst;
+    uint32_t *rstofs = calloc(k + 1, sizeof(uint32_t));
+    char *work = calloc(CLONESZ, 1);
+    JDEC clone;
+    DecodeRows top = {decoder, rstofs, 0, split, buf, stride, width, height, scale, JDR_OK, NULL};
+    DecodeRows bottom = {&clone, rstofs, split, rows - split, buf, stride, width, height, scale, JDR_OK, NULL};
+    JRESULT r = JDR_PAR;
+    if (rstofs == NULL || work == NULL || jd_restarts(decoder, rstofs, k + 1) != k + 1 ||
+            jd_clone(&clone, decoder, work, CLONESZ) != JDR_OK) {
+        goto done;
+    }
+    bottom.done = xSemaphoreCreateBinary();
+    if (bottom.done != NULL && xTaskCreatePinnedToCore(decode_rows_task, "jpeg_rows", 3072, &bottom, uxTaskPriorityGet(NULL),
+                                                      NULL, !xPortGetCoreID()) == pdPASS) {
+        decode_rows(&top);
+        xSemaphoreTake(bottom.done, portMAX_DELAY);
+    } else {
+        decode_rows(&top); //No worker, both parts on this core
+        decode_rows(&bottom);
+    }
+    r = top.result != JDR_OK ? top.result : bottom.result;
 
-//Size of the work space for the jpeg decoder.
-#define WORKSZ 3100
+done:
+    if (bottom.done != NULL) {
+        vSemaphoreDelete(bottom.done);
+    }
+    free(work);
+    free(rstofs);
+    return r;
+}
+#endif
 
-//Decode the embedded image into pixel lines that can be used with the rest of the logic.
-esp_err_t decode_image(uint16_t ***pixels)
+//Decode a jpeg at 1/(1 << scale) into a window, or one row of MCUs at a time when cb is set.
+static esp_err_t decode_run(const uint8_t *jpg, size_t len, uint16_t *buf, int stride, int width, int height,
+                            uint8_t scale, decode_image_stripe_cb_t cb, void *arg)
 {
     char *work = NULL;
     int r;
     JDEC decoder;
     JpegDev jd;
-    *pixels = NULL;
     esp_err_t ret = ESP_OK;
 
-    //Alocate pixel memory. Each line is an array of IMAGE_W 16-bit pixels; the `*pixels` array itself contains pointers to these lines.
-    *pixels = calloc(IMAGE_H, sizeof(uint16_t *));
-    if (*pixels == NULL) {
-        ESP_LOGE(TAG, "Error allocating memory for lines");
-        ret = ESP_ERR_NO_MEM;
-        goto err;
-    }
-    for (int i = 0; i < IMAGE_H; i++) {
-        (*pixels)[i] = malloc(IMAGE_W * sizeof(uint16_t));
-        if ((*pixels)[i] == NULL) {
-            ESP_LOGE(TAG, "Error allocating memory for line %d", i);
-            ret = ESP_ERR_NO_MEM;
-            goto err;
-        }
+    if (buf == NULL || width <= 0 || height <= 0 || stride < width || scale > 3) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (jpg == NULL) {
+        jpg = image_jpg_start;
+        len = image_jpg_end - image_jpg_start;
     }
 
     //Allocate the work space for the jpeg decoder.
     work = calloc(WORKSZ, 1);
     if (work == NULL) {
         ESP_LOGE(TAG, "Cannot allocate workspace");
-        ret = ESP_ERR_NO_MEM;
-        goto err;
+        return ESP_ERR_NO_MEM;
     }
 
     //Populate fields of the JpegDev struct.
-    jd.inData = image_jpg_start;
-    jd.inPos = 0;
-    jd.outData = *pixels;
-    jd.outW = IMAGE_W;
-    jd.outH = IMAGE_H;
-
-    //Prepare and decode the jpeg.
-    r = jd_prepare(&decoder, infunc, work, WORKSZ, (void *)&jd);
+    jd.stripeCb = cb;
+    jd.stripeArg = arg;
+
+    //Prepare and decode the jpeg. Rows of MCUs below the window are not decoded at all.
+    r = jd_prepare_mem(&decoder, jpg, len, work, WORKSZ, (void *)&jd);
     if (r != JDR_OK) {
         ESP_LOGE(TAG, "Image decoder: jd_prepare failed (%d)", r);
         ret = ESP_ERR_NOT_SUPPORTED;
-        goto err;
+        goto done;
     }
-    r = jd_decomp(&decoder, outfunc, 0);
-    if (r != JDR_OK && r != JDR_FMT1) {
+    if (cb != NULL) {
+        r = jd_decomp_stripe(&decoder, stripefunc, buf, stride, width, height, scale);
+    } else {
+#if CONFIG_JPEG_PARALLEL
+        r = decode_parallel(&decoder, buf, stride, width, height, scale);
+        if (r == JDR_PAR) {
+            r = jd_decomp_rgb565(&decoder, buf, stride, width, height, scale);
+        }
+#else
+        r = jd_decomp_rgb565(&decoder, buf, stride, width, height, scale);
+#endif
+    }
+    if (r == JDR_INTR) {
+        ret = ESP_FAIL; //Stopped by the stripe consumer
+    } else if (r != JDR_OK && r != JDR_FMT1) {
         ESP_LOGE(TAG, "Image decoder: jd_decode failed (%d)", r);
         ret = ESP_ERR_NOT_SUPPORTED;
-        goto err;
     }
 
-    //All done! Free the work area (as we don't need it anymore) and return victoriously.
+done:
+    //Free the work area, we don't need it anymore.
     free(work);
     return ret;
-err:
-    //Something went wrong! Exit cleanly, de-allocating everything we allocated.
-    if (*pixels != NULL) {
-        for (int i = 0; i < IMAGE_H; i++) {
-            free((*pixels)[i]);
-        }
-        free(*pixels);
+}
+
+//Decode a jpeg at 1/(1 << scale) into a window of a caller buffer, cropped to the window.
+esp_err_t decode_image_window(const uint8_t *jpg, size_t len, const decode_image_t *window, uint8_t scale)
+{
+    return decode_run(jpg, len, window->data, window->stride, window->width, window->height, scale, NULL, NULL);
+}
+
+//Decode a jpeg at 1/(1 << scale) one stripe at a time, nothing but the stripe buffers holds pixels.
+esp_err_t decode_image_stripes(const uint8_t *jpg, size_t len, uint16_t *stripe, int width, int height,
+                               uint8_t scale, decode_image_stripe_cb_t cb, void *arg)
+{
+    if (cb == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    return decode_run(jpg, len, stripe, width, width, height, scale, cb, arg);
+}
+
+//Decode the embedded image into one contiguous, stride-addressed buffer allocated with caps.
+esp_err_t decode_image_contiguous(decode_image_t *image, uint32_t caps)
+{
+    esp_err_t ret;
+
+    //One allocation for the whole image: no heap fragmentation and no row pointer to fetch per pixel.
+    image->width = IMAGE_W;
+    image->height = IMAGE_H;
+    image->stride = IMAGE_W;
+    image->data = heap_caps_malloc(IMAGE_W * IMAGE_H * sizeof(uint16_t), caps ? caps : MALLOC_CAP_DEFAULT);
+    if (image->data == NULL) {
+        ESP_LOGE(TAG, "Error allocating memory for the image");
+        return ESP_ERR_NO_MEM;
+    }
+
+    ret = decode_image_window(NULL, 0, image, 0);
+    if (ret != ESP_OK) {
+        //Something went wrong! Exit cleanly, de-allocating everything we allocated.
+        free(image->data);
+        image->data = NULL;
+    }
+    return ret;
+}
+
+//Build an array of row pointers into a contiguous image.
+esp_err_t decode_image_rows(const decode_image_t *image, uint16_t ***pixels)
+{
+    *pixels = calloc(image->height, sizeof(uint16_t *));
+    if (*pixels == NULL) {
+        ESP_LOGE(TAG, "Error allocating memory for lines");
+        return ESP_ERR_NO_MEM;
+    }
+    for (int i = 0; i < image->height; i++) {
+        (*pixels)[i] = image->data + i * image->stride;
+    }
+    return ESP_OK;
+}
+
+//Decode the embedded image into pixel lines that can be used with the rest of the logic.
+//The lines are views into one contiguous buffer, (*pixels)[0] is its start.
+esp_err_t decode_image(uint16_t ***pixels)
+{
+    decode_image_t image;
+    *pixels = NULL;
+    esp_err_t ret = decode_image_contiguous(&image, 0);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    ret = decode_image_rows(&image, pixels);
+    if (ret != ESP_OK) {
+        free(image.data);
     }
-    free(work);
     return ret;
 }
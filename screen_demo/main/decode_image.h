@@ -1,14 +1,104 @@
 #pragma once
 #include <stdint.h>
+#include <stddef.h>
 #include "esp_err.h"
 
+/**
+ * @brief A decoded image in one allocation. Pixel (x, y) is ``data[y * stride + x]``, big-endian RGB565.
+ */
+typedef struct {
+    uint16_t *data;
+    int width;
+    int height;
+    int stride;  //Pixels from the start of one row to the next
+} decode_image_t;
+
+//Most rows decode_image_stripes hands out at once: a row of 16x16 MCUs at 1:1 scale.
+#define DECODE_IMAGE_STRIPE_LINES 16
+
+/**
+ * @brief Consumer of the stripes of decode_image_stripes.
+ *
+ * @param stripe Big-endian RGB565 rows, pixel (x, ypos + i) is ``stripe[i * width + x]``.
+ * @param ypos First row of the stripe in the scaled image.
+ * @param lines Rows in the stripe.
+ * @param arg As given to decode_image_stripes.
+ * @return The buffer to decode the next stripe into, e.g. the other one of two while this one is still
+ *         being sent to the LCD by DMA; NULL to stop decoding.
+ */
+typedef uint16_t *(*decode_image_stripe_cb_t)(uint16_t *stripe, int ypos, int lines, void *arg);
+
 /**
  * @brief Decode the jpeg ``image.jpg`` embedded into the program file into pixel data.
  *
  * @param pixels A pointer to a pointer for an array of rows, which themselves are an array of pixels.
  *        Effectively, you can get the pixel data by doing ``decode_image(&myPixels); pixelval=myPixels[ypos][xpos];``
+ *        The rows are views into one contiguous buffer starting at ``myPixels[0]``.
  * @return - ESP_ERR_NOT_SUPPORTED if image is malformed or a progressive jpeg file
  *         - ESP_ERR_NO_MEM if out of memory
  *         - ESP_OK on succesful decode
  */
-esp_err_t decode_image(uint16_t ***pixels);
\ No newline at end of file
+esp_err_t decode_image(uint16_t ***pixels);
+
+/**
+ * @brief Decode the jpeg ``image.jpg`` into one contiguous, stride-addressed buffer.
+ *
+ * @param image Filled with the buffer and its geometry; free ``image->data`` when done.
+ * @param caps heap_caps_malloc capabilities for the buffer, e.g. MALLOC_CAP_SPIRAM; 0 for the default heap.
+ * @return - ESP_ERR_NOT_SUPPORTED if image is malformed or a progressive jpeg file
+ *         - ESP_ERR_NO_MEM if out of memory
+ *         - ESP_OK on succesful decode
+ */
+esp_err_t decode_image_contiguous(decode_image_t *image, uint32_t caps);
+
+/**
+ * @brief Build a row-pointer view of a contiguous image, for code written against decode_image.
+ *
+ * @param image Image from decode_image_contiguous; it must outlive the view.
+ * @param pixels Receives an array of ``image->height`` row pointers; free only the array.
+ * @return - ESP_ERR_NO_MEM if out of memory
+ *         - ESP_OK on success
+ */
+esp_err_t decode_image_rows(const decode_image_t *image, uint16_t ***pixels);
+
+/**
+ * @brief Decode a baseline jpeg at 1/1, 1/2, 1/4 or 1/8 scale straight into a window of a caller buffer.
+ *
+ * Use it to put a preview of a large still, e.g. a 1600x1200 OV2640 UXGA jpeg at 1/8 scale, into an LCD
+ * frame buffer: point ``window->data`` at the top-left pixel of the area and set ``stride`` to the frame
+ * buffer width. The scaled image is cropped to ``window->width`` x ``window->height``, pixels outside
+ * the scaled image are left untouched, and rows below the window are never decoded.
+ *
+ * @param jpg Jpeg data, NULL for the embedded ``image.jpg``.
+ * @param len Size of ``jpg`` in bytes.
+ * @param window Destination, big-endian RGB565.
+ * @param scale 0 to 3, the image is reduced by ``1 << scale`` in both directions.
+ * @return - ESP_ERR_INVALID_ARG if the window or scale is invalid
+ *         - ESP_ERR_NOT_SUPPORTED if image is malformed or a progressive jpeg file
+ *         - ESP_ERR_NO_MEM if out of memory
+ *         - ESP_OK on succesful decode
+ */
+esp_err_t decode_image_window(const uint8_t *jpg, size_t len, const decode_image_t *window, uint8_t scale);
+
+/**
+ * @brief Decode a baseline jpeg one row of MCUs at a time, without the decoded image in RAM.
+ *
+ * Every stripe goes to ``cb`` as soon as it is complete, so the first lines can be on the LCD while the rest
+ * is still being decoded. Memory use is the decoder work space plus the stripe buffers.
+ *
+ * @param jpg Jpeg data, NULL for the embedded ``image.jpg``.
+ * @param len Size of ``jpg`` in bytes.
+ * @param stripe First stripe buffer, ``width * DECODE_IMAGE_STRIPE_LINES`` pixels; ``cb`` may return others of the same size.
+ * @param width Pixels per stripe row, the scaled image is cropped to it.
+ * @param height Rows to decode, the scaled image is cropped to it.
+ * @param scale 0 to 3, the image is reduced by ``1 << scale`` in both directions.
+ * @param cb Stripe consumer.
+ * @param arg Passed to ``cb``.
+ * @return - ESP_ERR_INVALID_ARG if a parameter is invalid
+ *         - ESP_ERR_NOT_SUPPORTED if image is malformed or a progressive jpeg file
+ *         - ESP_ERR_NO_MEM if out of memory
+ *         - ESP_FAIL if ``cb`` stopped the decode
+ *         - ESP_OK on succesful decode
+ */
+esp_err_t decode_image_stripes(const uint8_t *jpg, size_t len, uint16_t *stripe, int width, int height,
+                               uint8_t scale, decode_image_stripe_cb_t cb, void *arg);
@@ -15,14 +15,14 @@
 
 #include "decode_image.h"
 
-uint16_t **pixels;
+static decode_image_t image;
 
 static inline uint16_t get_bgnd_pixel(int x, int y)
 {
     //Image has an 8x8 pixel margin, so we can also resolve e.g. [-3, 243]
     x += 8;
     y += 8;
-    return pixels[y][x];
+    return image.data[y * image.stride + x];
 }
 
 // #ifdef CONFIG_IDF_TARGET_ESP32
@@ -48,45 +48,104 @@ static inline uint16_t get_bgnd_pixel(int x, int y)
 // #endif
 
 
-//This variable is used to detect the next frame.
-static int prev_frame = -1;
+#define EFFECT_W 320
+#define EFFECT_H 240
+#define EFFECT_MARGIN 8 //the image margin, offsets stay within +-4 pixels of it
+
+//sin(i * 2 * pi / 256) * 127, rounded. Phases are kept in 1/65536 of a turn so the table index
+//is the phase >> 8; no double math and no libm call is needed while animating.
+static const int8_t sin_q7[256] = {
+       0,    3,    6,    9,   12,   16,   19,   22,   25,   28,   31,   34,   37,   40,   43,   46,
+      49,   51,   54,   57,   60,   63,   65,   68,   71,   73,   76,   78,   81,   83,   85,   88,
+      90,   92,   94,   96,   98,  100,  102,  104,  106,  107,  109,  111,  112,  113,  115,  116,
+     117,  118,  120,  121,  122,  122,  123,  124,  125,  125,  126,  126,  126,  127,  127,  127,
+     127,  127,  127,  127,  126,  126,  126,  125,  125,  124,  123,  122,  122,  121,  120,  118,
+     117,  116,  115,  113,  112,  111,  109,  107,  106,  104,  102,  100,   98,   96,   94,   92,
+      90,   88,   85,   83,   81,   78,   76,   73,   71,   68,   65,   63,   60,   57,   54,   51,
+      49,   46,   43,   40,   37,   34,   31,   28,   25,   22,   19,   16,   12,    9,    6,    3,
+       0,   -3,   -6,   -9,  -12,  -16,  -19,  -22,  -25,  -28,  -31,  -34,  -37,  -40,  -43,  -46,
+     -49,  -51,  -54,  -57,  -60,  -63,  -65,  -68,  -71,  -73,  -76,  -78,  -81,  -83,  -85,  -88,
+     -90,  -92,  -94,  -96,  -98, -100, -102, -104, -106, -107, -109, -111, -112, -113, -115, -116,
+    -117, -118, -120, -121, -122, -122, -123, -124, -125, -125, -126, -126, -126, -127, -127, -127,
+    -127, -127, -127, -127, -126, -126, -126, -125, -125, -124, -123, -122, -122, -121, -120, -118,
+    -117, -116, -115, -113, -112, -111, -109, -107, -106, -104, -102, -100,  -98,  -96,  -94,  -92,
+     -90,  -88,  -85,  -83,  -81,  -78,  -76,  -73,  -71,  -68,  -65,  -63,  -60,  -57,  -54,  -51,
+     -49,  -46,  -43,  -40,  -37,  -34,  -31,  -28,  -25,  -22,  -19,  -16,  -12,   -9,   -6,   -3
+};
+
+//Radians to a phase step in 1/65536 turn, folded by the compiler since rad is always a constant
+#define PHASE(rad) ((uint32_t)((rad) * (65536.0 / (2 * M_PI)) + 0.5))
+
+//sin(phase) * 4 truncated towards zero like the int8 conversion of the double version, offsets may differ by one
+//pixel from it where the sine crosses an integer
+static inline int8_t sin4(uint32_t phase)
+{
+    return (sin_q7[((phase + 0x80) >> 8) & 0xff] * 4) / 127;
+}
 
-//Instead of calculating the offsets for each pixel we grab, we pre-calculate the valueswhenever a frame changes, then re-use
+//Instead of calculating the offsets for each pixel we grab, we pre-calculate the values whenever a frame changes, then re-use
 //these as we go through all the pixels in the frame. This is much, much faster.
-static int8_t xofs[320], yofs[240];
-static int8_t xcomp[320], ycomp[240];
+//A pixel (x, y) samples the image at (x + yofs[y] + xcomp[x], y + xofs[x] + ycomp[y]). The row only moves by xofs[x],
+//so each output line touches 9 image rows: rowsel[x] picks one of them and col[x] is the column within it.
+//There is a set of tables for even and one for odd frames, so the stripes of two frames can be rendered at once.
+typedef struct {
+    int frame;          //Frame the tables are for, -1: none
+    int8_t yofs[EFFECT_H], ycomp[EFFECT_H];
+    uint8_t rowsel[EFFECT_W];
+    int16_t col[EFFECT_W];
+} effect_tables_t;
+
+static effect_tables_t tables[2] = {
+    { .frame = -1 },
+    { .frame = -1 },
+};
+
+void pretty_effect_begin_frame(int frame)
+{
+    effect_tables_t *t = &tables[frame & 1];
+    if (t->frame == frame) {
+        return;
+    }
+    uint32_t xofs_phase = frame * PHASE(0.15), xcomp_phase = frame * PHASE(0.11);
+    for (int x = 0; x < EFFECT_W; x++) {
+        t->rowsel[x] = sin4(xofs_phase + x * PHASE(0.06)) + 4;
+        t->col[x] = x + sin4(xcomp_phase + x * PHASE(0.12)) + EFFECT_MARGIN;
+    }
+    uint32_t yofs_phase = frame * PHASE(0.1), ycomp_phase = frame * PHASE(0.07);
+    for (int y = 0; y < EFFECT_H; y++) {
+        t->yofs[y] = sin4(yofs_phase + y * PHASE(0.05));
+        t->ycomp[y] = sin4(ycomp_phase + y * PHASE(0.15));
+    }
+    t->frame = frame;
+}
+
+//One 320 pixel line, the fixed trip count and the 4x unroll keep the loop free of bounds math
+static inline void pretty_effect_calc_line(uint16_t *dest, const uint16_t *const rows[9], const uint8_t *rowsel, const int16_t *col)
+{
+    for (int x = 0; x < EFFECT_W; x += 4) {
+        dest[x + 0] = rows[rowsel[x + 0]][col[x + 0]];
+        dest[x + 1] = rows[rowsel[x + 1]][col[x + 1]];
+        dest[x + 2] = rows[rowsel[x + 2]][col[x + 2]];
+        dest[x + 3] = rows[rowsel[x + 3]][col[x + 3]];
+    }
+}
 
 //Calculate the pixel data for a set of lines (with implied line size of 320). Pixels go in dest, line is the Y-coordinate of the
 //first line to be calculated, linect is the amount of lines to calculate. Frame increases by one every time the entire image
 //is displayed; this is used to go to the next frame of animation.
 void pretty_effect_calc_lines(uint16_t *dest, int line, int frame, int linect)
 {
-    if (frame != prev_frame) {
-        //We need to calculate a new set of offset coefficients. Take some random sines as offsets to make everything
-        //look pretty and fluid-y.
-        for (int x = 0; x < 320; x++) {
-            xofs[x] = sin(frame * 0.15 + x * 0.06) * 4;
-        }
-
-        for (int y = 0; y < 240; y++) {
-            yofs[y] = sin(frame * 0.1 + y * 0.05) * 4;
-        }
-
-        for (int x = 0; x < 320; x++) {
-            xcomp[x] = sin(frame * 0.11 + x * 0.12) * 4;
-        }
-
-        for (int y = 0; y < 240; y++) {
-            ycomp[y] = sin(frame * 0.07 + y * 0.15) * 4;
-        }
-
-        prev_frame = frame;
-    }
+    const effect_tables_t *t = &tables[frame & 1];
+    pretty_effect_begin_frame(frame);
 
+    const uint16_t *rows[9];
     for (int y = line; y < line + linect; y++) {
-        for (int x = 0; x < 320; x++) {
-            *dest++ = get_bgnd_pixel(x + yofs[y] + xcomp[x], y + xofs[x] + ycomp[y]);
+        int row = y + t->ycomp[y] + EFFECT_MARGIN - 4;
+        for (int i = 0; i < 9; i++) {
+            rows[i] = image.data + (row + i) * image.stride + t->yofs[y];
         }
+        pretty_effect_calc_line(dest, rows, t->rowsel, t->col);
+        dest += EFFECT_W;
     }
 }
 
@@ -103,10 +162,10 @@ void pretty_effect_static_lines(uint16_t *dest, int line, int frame, int linect)
 esp_err_t pretty_effect_init(void)
 {
 
-    return decode_image(&pixels);
+    return decode_image_contiguous(&image, 0);
 
 #ifdef CONFIG_IDF_TARGET_ESP32
-    return decode_image(&pixels);
+    return decode_image_contiguous(&image, 0);
 #elif defined CONFIG_IDF_TARGET_ESP32S2
     //esp32s2 doesn't have enough memory to hold the decoded image, calculate instead
     return ESP_OK;
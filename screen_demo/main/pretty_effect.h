@@ -13,6 +13,13 @@
  */
 void pretty_effect_calc_lines(uint16_t *dest, int line, int frame, int linect);
 
+/**
+ * @brief Calculate the tables of a frame before its lines, pretty_effect_calc_lines does it on the first line otherwise.
+ *        Call it before rendering stripes of the frame from several tasks; the stripes of at most two consecutive
+ *        frames may be rendered at the same time.
+ */
+void pretty_effect_begin_frame(int frame);
+
 void pretty_effect_static_lines(uint16_t *dest, int line, int frame, int linect);
 /**
  * @brief Initialize the effect
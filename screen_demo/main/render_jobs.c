@@ -0,0 +1,82 @@
+/*
+   Render job scheduler: stripes go to a job queue drained by one worker task per core, the workers report
+   finished stripes through a completion queue and the sender takes them in screen order.
+
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "render_jobs.h"
+
+typedef struct {
+    uint16_t *dest;
+    int line;
+    int frame;
+    int linect;
+    int slot;
+} render_job_t;
+
+static render_job_fn_t render_fn;
+static QueueHandle_t job_queue;     //render_job_t, to the workers
+static QueueHandle_t done_queue;    //slot numbers, back to the sender
+static uint32_t done_mask;          //Slots reported done and not waited for yet
+static int workers;
+
+static void render_worker(void *arg)
+{
+    render_job_t job;
+    while (1) {
+        xQueueReceive(job_queue, &job, portMAX_DELAY);
+        render_fn(job.dest, job.line, job.frame, job.linect);
+        xQueueSend(done_queue, &job.slot, portMAX_DELAY);
+    }
+}
+
+esp_err_t render_jobs_init(render_job_fn_t fn, int slots)
+{
+    render_fn = fn;
+    job_queue = xQueueCreate(slots, sizeof(render_job_t));
+    done_queue = xQueueCreate(slots, sizeof(int));
+    if (job_queue == NULL || done_queue == NULL) return ESP_ERR_NO_MEM;
+    //Same priority as the sender: it mostly blocks on the completions, the workers share the cores with it
+    UBaseType_t prio = uxTaskPriorityGet(NULL);
+    for (int i = 0; i < portNUM_PROCESSORS; i++) {
+        if (xTaskCreatePinnedToCore(render_worker, "render", 2048, NULL, prio, NULL, i) != pdPASS) return ESP_ERR_NO_MEM;
+        workers++;
+    }
+    return ESP_OK;
+}
+
+int render_jobs_workers(void)
+{
+    return workers;
+}
+
+void render_jobs_submit(int slot, uint16_t *dest, int line, int frame, int linect)
+{
+    render_job_t job = {
+        .dest = dest,
+        .line = line,
+        .frame = frame,
+        .linect = linect,
+        .slot = slot,
+    };
+    xQueueSend(job_queue, &job, portMAX_DELAY);
+}
+
+void render_jobs_wait(int slot)
+{
+    int done;
+    //Stripes finish out of order, keep the early ones until their turn
+    while ((done_mask & (1 << slot)) == 0) {
+        xQueueReceive(done_queue, &done, portMAX_DELAY);
+        done_mask |= 1 << done;
+    }
+    done_mask &= ~(1 << slot);
+}
@@ -0,0 +1,38 @@
+#pragma once
+#include <stdint.h>
+#include "esp_err.h"
+
+/**
+ * @brief Renders a stripe, e.g. pretty_effect_calc_lines. Called from the worker tasks, several stripes of the
+ *        same frame (and the first stripes of the next one) are rendered at the same time.
+ */
+typedef void (*render_job_fn_t)(uint16_t *dest, int line, int frame, int linect);
+
+/**
+ * @brief Start one render worker per core, each pinned to its core.
+ *
+ * @param fn Stripe renderer.
+ * @param slots Number of stripe buffers the caller hands out, at most 32.
+ * @return - ESP_ERR_NO_MEM if the queues or tasks can't be created
+ *         - ESP_OK otherwise
+ */
+esp_err_t render_jobs_init(render_job_fn_t fn, int slots);
+
+/**
+ * @brief Number of workers, the most stripes worth handing out ahead of the one being sent.
+ */
+int render_jobs_workers(void);
+
+/**
+ * @brief Queue a stripe for the next free worker.
+ *
+ * @param slot Buffer index, the completion is reported by it. A slot must be waited for before it is submitted again.
+ * @param dest Buffer of linect * 320 pixels.
+ */
+void render_jobs_submit(int slot, uint16_t *dest, int line, int frame, int linect);
+
+/**
+ * @brief Wait until the stripe of a slot is rendered. Completions arrive through one queue in any order, the ones
+ *        not waited for yet are kept, so the stripes can be taken in screen order.
+ */
+void render_jobs_wait(int slot);
@@ -9,13 +9,21 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stdbool.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "esp_system.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
 #include "driver/spi_master.h"
 #include "driver/gpio.h"
+#include "nvs_flash.h"
+#include "nvs.h"
+#include "param.h"
 
 #include "pretty_effect.h"
+#include "decode_image.h"
+#include "render_jobs.h"
 
 /*
  This code displays some fancy graphics on the 320x240 LCD on an ESP-WROVER_KIT board.
@@ -70,9 +78,16 @@
 #endif
 #endif
 
-//To speed up transfers, every SPI transfer sends a bunch of lines. This define specifies how many. More means more memory use,
-//but less overhead for setting up / finishing transfers. Make sure 240 is dividable by this.
-#define PARALLEL_LINES 16
+//To speed up transfers, every SPI transfer sends a bunch of lines. This specifies the most and sizes the line
+//buffers, the renderer can use fewer at run time. More means more memory use, but less overhead for setting up /
+//finishing transfers. The lcd.lines parameter overrides the menuconfig value without a rebuild.
+static int parallel_lines=CONFIG_LCD_PARALLEL_LINES;
+
+//Stripe buffers: one is calculated while the others are queued to the SPI driver.
+#define LCD_STRIPE_BUFFERS CONFIG_LCD_STRIPE_BUFFERS
+
+//Stripes that can be queued to the SPI driver at the same time, each one takes a set of 6 transactions.
+#define LCD_DLIST_DEPTH (LCD_STRIPE_BUFFERS-1)
 
 /*
  The LCD needs a bunch of command/argument values to be initialized. They are stored in this struct.
@@ -248,6 +263,9 @@ uint32_t lcd_get_id(spi_device_handle_t spi)
     return *(uint32_t*)t.rx_data;
 }
 
+//Memory data access control set by the init commands, the clock probe changes it and puts it back
+static uint8_t lcd_madctl;
+
 //Initialize the display
 void lcd_init(spi_device_handle_t spi)
 {
@@ -309,6 +327,7 @@ void lcd_init(spi_device_handle_t spi)
 
     //Send all the commands
     while (lcd_init_cmds[cmd].databytes!=0xff) {
+        if (lcd_init_cmds[cmd].cmd==0x36) lcd_madctl=lcd_init_cmds[cmd].data[0];
         lcd_cmd(spi, lcd_init_cmds[cmd].cmd);
         lcd_data(spi, lcd_init_cmds[cmd].data, lcd_init_cmds[cmd].databytes&0x1F);
         if (lcd_init_cmds[cmd].databytes&0x80) {
@@ -322,56 +341,222 @@ void lcd_init(spi_device_handle_t spi)
 }
 
 
+/* The LCD clock. The panels are specified for 10MHz but most run a lot faster, and how much faster depends on the
+ * panel and the wiring. lcd_clock_calibrate steps the clock up and checks at every step that the panel still gets
+ * what is written: a few memory data access control (MADCTL) values are written at the clock under test and read
+ * back over MISO at the reference clock, where reads are reliable. The best clock that passes, with every slower one
+ * passing too, is stored in NVS and only checked again at the next boots.
+ */
+#define LCD_CLOCK_REF_HZ    (10*1000*1000)
+#define LCD_CLOCK_ROUNDS    3
+
+#if CONFIG_LCD_CLOCK_AUTO
+
+//The SPI clock is 80MHz divided by an integer, these are the steps worth trying
+static const int lcd_clock_steps[]={10*1000*1000, 13333333, 16*1000*1000, 20*1000*1000, 26666666, 40*1000*1000, 80*1000*1000};
+static const uint8_t lcd_probe_madctl[]={0x00, 0x08, 0x60, 0xA8};
+
+static spi_device_interface_config_t lcd_devcfg;
+
+//Attach the LCD again at another clock. The panel keeps its state, nothing may be queued to the old handle.
+static esp_err_t lcd_set_clock(spi_device_handle_t *spi, int hz)
+{
+    esp_err_t ret=spi_bus_remove_device(*spi);
+    if (ret!=ESP_OK) return ret;
+    lcd_devcfg.clock_speed_hz=hz;
+    return spi_bus_add_device(LCD_HOST, &lcd_devcfg, spi);
+}
+
+static uint32_t lcd_read_madctl(spi_device_handle_t spi)
+{
+    lcd_cmd(spi, 0x0B);     //Read display MADCTL
+
+    spi_transaction_t t;
+    memset(&t, 0, sizeof(t));
+    t.length=8*2;           //A dummy clock, then the value
+    t.flags = SPI_TRANS_USE_RXDATA;
+    t.user = (void*)1;
+
+    esp_err_t ret = spi_device_polling_transmit(spi, &t);
+    assert( ret == ESP_OK );
+
+    return *(uint32_t*)t.rx_data&0xffff;
+}
+
+//Write every probe value at hz and check it reads back as at the reference clock. Leaves the reference clock set.
+static bool lcd_clock_probe(spi_device_handle_t *spi, int hz, const uint32_t *ref)
+{
+    bool ok=true;
+    for (int r=0; r<LCD_CLOCK_ROUNDS && ok; r++) {
+        for (int i=0; i<sizeof(lcd_probe_madctl) && ok; i++) {
+            if (lcd_set_clock(spi, hz)!=ESP_OK) {
+                //The driver refuses the clock, e.g. above what the GPIO matrix allows
+                ESP_ERROR_CHECK(lcd_set_clock(spi, LCD_CLOCK_REF_HZ));
+                return false;
+            }
+            lcd_cmd(*spi, 0x36);
+            lcd_data(*spi, &lcd_probe_madctl[i], 1);
+            ESP_ERROR_CHECK(lcd_set_clock(spi, LCD_CLOCK_REF_HZ));
+            ok=(lcd_read_madctl(*spi)==ref[i]);
+        }
+    }
+    lcd_cmd(*spi, 0x36);
+    lcd_data(*spi, &lcd_madctl, 1);
+    return ok;
+}
+
+//Find the fastest clock the panel keeps up with and switch to it. Returns the clock used.
+static int lcd_clock_calibrate(spi_device_handle_t *spi)
+{
+    uint32_t ref[sizeof(lcd_probe_madctl)];
+    nvs_handle_t nvs;
+    int32_t stored=0;
+    int best=LCD_CLOCK_REF_HZ;
+
+    bool have_nvs=(nvs_open("lcd", NVS_READWRITE, &nvs)==ESP_OK);
+    if (have_nvs) nvs_get_i32(nvs, "clk_hz", &stored);
+
+    //Reference readbacks; without MISO (or a panel without read support) they don't tell the values apart
+    ESP_ERROR_CHECK(lcd_set_clock(spi, LCD_CLOCK_REF_HZ));
+    for (int i=0; i<sizeof(lcd_probe_madctl); i++) {
+        lcd_cmd(*spi, 0x36);
+        lcd_data(*spi, &lcd_probe_madctl[i], 1);
+        ref[i]=lcd_read_madctl(*spi);
+    }
+    lcd_cmd(*spi, 0x36);
+    lcd_data(*spi, &lcd_madctl, 1);
+    for (int i=1; i<sizeof(lcd_probe_madctl); i++) {
+        if (ref[i]==ref[0]) {
+            printf("LCD clock: no readback, staying at %d Hz\n", best);
+            if (have_nvs) nvs_close(nvs);
+            return best;
+        }
+    }
+
+    if (stored>LCD_CLOCK_REF_HZ && lcd_clock_probe(spi, stored, ref)) {
+        best=stored;
+    } else {
+        for (int i=1; i<sizeof(lcd_clock_steps)/sizeof(lcd_clock_steps[0]); i++) {
+            if (!lcd_clock_probe(spi, lcd_clock_steps[i], ref)) break;
+            best=lcd_clock_steps[i];
+        }
+        if (have_nvs && best!=stored) {
+            nvs_set_i32(nvs, "clk_hz", best);
+            nvs_commit(nvs);
+        }
+    }
+    if (have_nvs) nvs_close(nvs);
+    ESP_ERROR_CHECK(lcd_set_clock(spi, best));
+    printf("LCD clock: %d Hz%s\n", best, (best==stored)?" (stored)":"");
+    return best;
+}
+#endif
+
+
 /* To send a set of lines we have to send a command, 2 data bytes, another command, 2 more data bytes and another command
  * before sending the line data itself; a total of 6 transactions. (We can't put all of this in just one transaction
  * because the D/C line needs to be toggled in the middle.)
- * This routine queues these commands up as interrupt transactions so they get
- * sent faster (compared to calling spi_device_transmit several times), and at
- * the mean while the lines for next transactions can get calculated.
+ * These 6 transactions are a display list: the sets are built once by lcd_dlist_init and per stripe only the page
+ * address and the line data are patched. LCD_DLIST_DEPTH sets are used round robin, so as many stripes can be queued
+ * at once while the lines for the next ones get calculated.
  */
-static void send_lines(spi_device_handle_t spi, int ypos, uint16_t *linedata)
+typedef struct {
+    //Transaction descriptors. Static so they're not allocated on the stack; the SPI driver needs this memory
+    //until the transactions are done, even while we're already calculating the next lines.
+    spi_transaction_t trans[LCD_DLIST_DEPTH][6];
+    int head;       //Next set to queue
+    int queued;     //Sets queued and not finished yet, the oldest one is (head - queued)
+} lcd_dlist_t;
+
+static lcd_dlist_t lcd_dlist;
+
+//Bus idle accounting: the post-transfer callback notes when the line data of a set is done, a set queued after all
+//the others are done finds the bus idle since then.
+typedef struct {
+    uint32_t sent;              //Sets queued since lcd_dlist_init
+    volatile uint32_t done;     //Sets whose line data has been sent
+    volatile int64_t done_us;   //When the last one was done
+    int64_t idle_us;            //Bus idle time between sets
+    uint32_t stalls;            //Times the bus ran dry
+} lcd_bus_stats_t;
+
+static lcd_bus_stats_t lcd_bus_stats;
+
+static void lcd_dlist_init(void)
 {
-    esp_err_t ret;
-    int x;
-    //Transaction descriptors. Declared static so they're not allocated on the stack; we need this memory even when this
-    //function is finished because the SPI driver needs access to it even while we're already calculating the next line.
-    static spi_transaction_t trans[6];
-
-    //In theory, it's better to initialize trans and data only once and hang on to the initialized
-    //variables. We allocate them on the stack, so we need to re-init them each call.
-    for (x=0; x<6; x++) {
-        memset(&trans[x], 0, sizeof(spi_transaction_t));
-        if ((x&1)==0) {
-            //Even transfers are commands
-            trans[x].length=8;
-            trans[x].user=(void*)0;
-        } else {
-            //Odd transfers are data
-            trans[x].length=8*4;
-            trans[x].user=(void*)1;
+    memset(&lcd_dlist, 0, sizeof(lcd_dlist));
+    memset(&lcd_bus_stats, 0, sizeof(lcd_bus_stats));
+    for (int i=0; i<LCD_DLIST_DEPTH; i++) {
+        spi_transaction_t *trans=lcd_dlist.trans[i];
+        for (int x=0; x<6; x++) {
+            if ((x&1)==0) {
+                //Even transfers are commands
+                trans[x].length=8;
+                trans[x].user=(void*)0;
+            } else {
+                //Odd transfers are data
+                trans[x].length=8*4;
+                trans[x].user=(void*)1;
+            }
+            trans[x].flags=SPI_TRANS_USE_TXDATA;
         }
-        trans[x].flags=SPI_TRANS_USE_TXDATA;
+        trans[0].tx_data[0]=0x2A;           //Column Address Set
+        trans[1].tx_data[0]=0;              //Start Col High
+        trans[1].tx_data[1]=0;              //Start Col Low
+        trans[1].tx_data[2]=(320)>>8;       //End Col High
+        trans[1].tx_data[3]=(320)&0xff;     //End Col Low
+        trans[2].tx_data[0]=0x2B;           //Page address set
+        trans[4].tx_data[0]=0x2C;           //memory write
+        trans[5].flags=0;                   //The line data is sent from its buffer
+    }
+}
+
+//Wait for the oldest queued set of lines to be done and get back the results.
+static void send_line_finish(spi_device_handle_t spi)
+{
+    spi_transaction_t *rtrans;
+    esp_err_t ret;
+    if (lcd_dlist.queued==0) return;
+    for (int x=0; x<6; x++) {
+        ret=spi_device_get_trans_result(spi, &rtrans, portMAX_DELAY);
+        assert(ret==ESP_OK);
+        //We could inspect rtrans now if we received any info back. The LCD is treated as write-only, though.
+    }
+    lcd_dlist.queued--;
+}
+
+//Wait for every queued set of lines.
+static void send_line_flush(spi_device_handle_t spi)
+{
+    while (lcd_dlist.queued) send_line_finish(spi);
+}
+
+static void send_lines_n(spi_device_handle_t spi, int ypos, int lines, uint16_t *linedata)
+{
+    esp_err_t ret;
+    //All sets in flight, the oldest one is reused
+    if (lcd_dlist.queued==LCD_DLIST_DEPTH) send_line_finish(spi);
+    //Nothing left in flight: the bus has been idle since the last set was done
+    if (lcd_bus_stats.sent && lcd_bus_stats.done==lcd_bus_stats.sent) {
+        lcd_bus_stats.idle_us+=esp_timer_get_time()-lcd_bus_stats.done_us;
+        lcd_bus_stats.stalls++;
     }
-    trans[0].tx_data[0]=0x2A;           //Column Address Set
-    trans[1].tx_data[0]=0;              //Start Col High
-    trans[1].tx_data[1]=0;              //Start Col Low
-    trans[1].tx_data[2]=(320)>>8;       //End Col High
-    trans[1].tx_data[3]=(320)&0xff;     //End Col Low
-    trans[2].tx_data[0]=0x2B;           //Page address set
+    spi_transaction_t *trans=lcd_dlist.trans[lcd_dlist.head];
     trans[3].tx_data[0]=ypos>>8;        //Start page high
     trans[3].tx_data[1]=ypos&0xff;      //start page low
-    trans[3].tx_data[2]=(ypos+PARALLEL_LINES)>>8;    //end page high
-    trans[3].tx_data[3]=(ypos+PARALLEL_LINES)&0xff;  //end page low
-    trans[4].tx_data[0]=0x2C;           //memory write
+    trans[3].tx_data[2]=(ypos+lines)>>8;    //end page high
+    trans[3].tx_data[3]=(ypos+lines)&0xff;  //end page low
     trans[5].tx_buffer=linedata;        //finally send the line data
-    trans[5].length=320*2*8*PARALLEL_LINES;          //Data length, in bits
-    trans[5].flags=0; //undo SPI_TRANS_USE_TXDATA flag
+    trans[5].length=320*2*8*lines;      //Data length, in bits
 
     //Queue all transactions.
-    for (x=0; x<6; x++) {
+    for (int x=0; x<6; x++) {
         ret=spi_device_queue_trans(spi, &trans[x], portMAX_DELAY);
         assert(ret==ESP_OK);
     }
+    lcd_dlist.head=(lcd_dlist.head+1)%LCD_DLIST_DEPTH;
+    lcd_dlist.queued++;
+    lcd_bus_stats.sent++;
 
     //When we are here, the SPI driver is busy (in the background) getting the transactions sent. That happens
     //mostly using DMA, so the CPU doesn't have much to do here. We're not going to wait for the transaction to
@@ -380,78 +565,187 @@ static void send_lines(spi_device_handle_t spi, int ypos, uint16_t *linedata)
 }
 
 
-static void send_line_finish(spi_device_handle_t spi)
+static bool lcd_dlist_owns(spi_transaction_t *t)
 {
-    spi_transaction_t *rtrans;
-    esp_err_t ret;
-    //Wait for all 6 transactions to be done and get back the results.
-    for (int x=0; x<6; x++) {
-        ret=spi_device_get_trans_result(spi, &rtrans, portMAX_DELAY);
-        assert(ret==ESP_OK);
-        //We could inspect rtrans now if we received any info back. The LCD is treated as write-only, though.
+    return t>=&lcd_dlist.trans[0][0] && t<&lcd_dlist.trans[LCD_DLIST_DEPTH][0];
+}
+
+//This function is called (in irq context!) when a transmission is done. The line data of a display list set is
+//its last transaction, note when it went out for the bus idle stats.
+void lcd_spi_post_transfer_callback(spi_transaction_t *t)
+{
+    if ((t->flags&SPI_TRANS_USE_TXDATA)==0 && lcd_dlist_owns(t)) {
+        lcd_bus_stats.done_us=esp_timer_get_time();
+        lcd_bus_stats.done++;
     }
 }
 
 
+//Most stripe buffers of the renderer: the stripes in flight on the bus and one being rendered by each worker.
+#define RENDER_SLOTS (LCD_DLIST_DEPTH+portNUM_PROCESSORS)
+
+//Stripe handed to a render worker
+typedef struct {
+    int frame;
+    int y;
+    int lines;
+} render_stripe_t;
+
+//Stripes are handed out in screen order, a new stripe height starts with the next frame.
+typedef struct {
+    render_stripe_t next;
+    int next_lines;
+    int slot;
+    int nbuf;
+    uint16_t *buf[RENDER_SLOTS];
+    render_stripe_t stripe[RENDER_SLOTS];
+} render_state_t;
+
+static void render_submit_next(render_state_t *rs)
+{
+    render_stripe_t *st=&rs->stripe[rs->slot];
+    if (rs->next.y==0) {
+        rs->next.lines=rs->next_lines;
+        //The frame tables are ready before any worker renders its stripes
+        pretty_effect_begin_frame(rs->next.frame);
+    }
+    st->frame=rs->next.frame;
+    st->y=rs->next.y;
+    st->lines=(240-st->y<rs->next.lines)?240-st->y:rs->next.lines;
+    render_jobs_submit(rs->slot, rs->buf[rs->slot], st->y, st->frame, st->lines);
+    rs->slot=(rs->slot+1)%rs->nbuf;
+    rs->next.y+=st->lines;
+    if (rs->next.y>=240) {
+        rs->next.y=0;
+        rs->next.frame++;
+    }
+}
+
 //Simple routine to generate some patterns and send them to the LCD. Don't expect anything too
-//impressive. Because the SPI driver handles transactions in the background, we can calculate the next line
-//while the previous one is being sent.
-static void display_pretty_colors(spi_device_handle_t spi)
+//impressive. The stripes are rendered by one worker task per core and sent in screen order: because the SPI
+//driver handles transactions in the background, every worker renders a stripe while up to LCD_DLIST_DEPTH
+//stripes are still being sent. lines is the number of lines per stripe, at most parallel_lines.
+static void display_pretty_colors(spi_device_handle_t spi, int lines)
 {
-    uint16_t *lines[2];
+    static render_state_t rs;
+    int workers=render_jobs_workers();
     //Allocate memory for the pixel buffers
-    for (int i=0; i<2; i++) {
-        lines[i]=heap_caps_malloc(320*PARALLEL_LINES*sizeof(uint16_t), MALLOC_CAP_DMA);
-        assert(lines[i]!=NULL);
+    rs.nbuf=LCD_DLIST_DEPTH+workers;
+    for (int i=0; i<rs.nbuf; i++) {
+        rs.buf[i]=heap_caps_malloc(320*parallel_lines*sizeof(uint16_t), MALLOC_CAP_DMA);
+        assert(rs.buf[i]!=NULL);
     }
+#if CONFIG_LCD_STRIPE_SWEEP
+    lines=4;
+#endif
+    if (lines<1 || lines>parallel_lines) lines=parallel_lines;
+    rs.next.frame=1;
+    rs.next_lines=lines;
     int frame=0;
-    //Indexes of the line currently being sent to the LCD and the line we're calculating.
-    int sending_line=-1;
-    int calc_line=0;
+    int64_t start=esp_timer_get_time();
+    int64_t idle=lcd_bus_stats.idle_us;
+    uint32_t stalls=lcd_bus_stats.stalls;
+
+    //Every worker gets a stripe ahead of the one being sent
+    for (int i=0; i<workers; i++) render_submit_next(&rs);
+    for (int send=0; ; send=(send+1)%rs.nbuf) {
+        render_stripe_t *st=&rs.stripe[send];
+        render_jobs_wait(send);
+        //Queue it; the actual sending happens in the background. Sending waits for the oldest stripe when all
+        //display list sets are in flight, so its buffer is free to render the next stripe into.
+        send_lines_n(spi, st->y, st->lines, rs.buf[send]);
+        int last=(st->y+st->lines>=240);
+        render_submit_next(&rs);
+        if (!last) continue;
 
-    while(1) {
         frame++;
-        for (int y=0; y<240; y+=PARALLEL_LINES) {
-            //Calculate a line.
-            // pretty_effect_calc_lines(lines[calc_line], y, frame, PARALLEL_LINES);
-             pretty_effect_static_lines(lines[calc_line], y, frame, PARALLEL_LINES);
-            //Finish up the sending process of the previous line, if any
-            if (sending_line!=-1) send_line_finish(spi);
-            //Swap sending_line and calc_line
-            sending_line=calc_line;
-            calc_line=(calc_line==1)?0:1;
-            //Send the line we currently calculated.
-            send_lines(spi, y, lines[sending_line]);
-            //The line set is queued up for sending now; the actual sending happens in the
-            //background. We can go on to calculate the next line set as long as we do not
-            //touch line[sending_line]; the SPI sending process is still reading from that.
+        if (frame%50==0) {
+            int64_t now=esp_timer_get_time();
+            printf("%d lines x %d buffers, %d workers: %lld us/frame, bus idle %lld us/frame in %u gaps (%lld%%)\n", lines,
+                   rs.nbuf, workers, (now-start)/50, (lcd_bus_stats.idle_us-idle)/50, (lcd_bus_stats.stalls-stalls)/50,
+                   (lcd_bus_stats.idle_us-idle)*100/(now-start));
+#if CONFIG_LCD_STRIPE_SWEEP
+            //Next stripe size from the next frame handed out on, 4, 8, 16, 24, ... up to parallel_lines
+            lines=(lines<parallel_lines)?((lines<16)?lines*2:lines+8):4;
+            if (lines>parallel_lines) lines=parallel_lines;
+            rs.next_lines=lines;
+#endif
+            start=now;
+            idle=lcd_bus_stats.idle_us;
+            stalls=lcd_bus_stats.stalls;
         }
     }
 }
 
+#if CONFIG_JPEG_STREAM
+typedef struct {
+    spi_device_handle_t spi;
+    uint16_t *lines[LCD_DLIST_DEPTH+1];
+    int next;               //Buffer handed out for the next stripe
+} jpeg_stream_t;
+
+//Called with every decoded stripe: queue it and decode the next one into a free buffer meanwhile.
+static uint16_t *jpeg_stream_stripe(uint16_t *stripe, int ypos, int lines, void *arg)
+{
+    jpeg_stream_t *st = (jpeg_stream_t *)arg;
+    //Waits for the oldest stripe when LCD_DLIST_DEPTH are in flight, its buffer is the one handed out next
+    send_lines_n(st->spi, ypos, lines, stripe);
+    st->next = (st->next + 1) % (LCD_DLIST_DEPTH + 1);
+    return st->lines[st->next];
+}
+
+//Show the embedded jpeg by decoding it straight into LCD stripes, the decoded image is never in RAM.
+static void display_jpeg_stream(spi_device_handle_t spi)
+{
+    jpeg_stream_t st = {
+        .spi = spi,
+    };
+    for (int i=0; i<LCD_DLIST_DEPTH+1; i++) {
+        st.lines[i]=heap_caps_malloc(320*DECODE_IMAGE_STRIPE_LINES*sizeof(uint16_t), MALLOC_CAP_DMA);
+        assert(st.lines[i]!=NULL);
+    }
+    int64_t start = esp_timer_get_time();
+    esp_err_t ret = decode_image_stripes(NULL, 0, st.lines[0], 320, 240, 0, jpeg_stream_stripe, &st);
+    send_line_flush(spi);
+    printf("jpeg streamed to the LCD in %lld us (%s)\n", esp_timer_get_time() - start, esp_err_to_name(ret));
+    for (int i=0; i<LCD_DLIST_DEPTH+1; i++) {
+        free(st.lines[i]);
+    }
+}
+#endif
+
 void app_main(void)
 {
     esp_err_t ret;
     spi_device_handle_t spi;
+    //Tuning knobs, read before anything is sized by them; "param set" on the console changes them for the next boot
+    parallel_lines=param_int("lcd.lines", CONFIG_LCD_PARALLEL_LINES, 1, 60, "lines per stripe buffer");
+    param_console_start(CONFIG_ESP_CONSOLE_UART_NUM, 2);
     spi_bus_config_t buscfg={
         .miso_io_num=PIN_NUM_MISO,
         .mosi_io_num=PIN_NUM_MOSI,
         .sclk_io_num=PIN_NUM_CLK,
         .quadwp_io_num=-1,
         .quadhd_io_num=-1,
-        .max_transfer_sz=PARALLEL_LINES*320*2+8
+        .max_transfer_sz=((parallel_lines>DECODE_IMAGE_STRIPE_LINES)?parallel_lines:DECODE_IMAGE_STRIPE_LINES)*320*2+8
     };
     spi_device_interface_config_t devcfg={
-#ifdef CONFIG_LCD_OVERCLOCK
+#if CONFIG_LCD_CLOCK_AUTO
+        .clock_speed_hz=LCD_CLOCK_REF_HZ,       //Start at 10 MHz, calibrated after the init
+#elif defined CONFIG_LCD_OVERCLOCK
         .clock_speed_hz=26*1000*1000,           //Clock out at 26 MHz
 #else
         .clock_speed_hz=10*1000*1000,           //Clock out at 10 MHz
 #endif
         .mode=0,                                //SPI mode 0
         .spics_io_num=PIN_NUM_CS,               //CS pin
-        .queue_size=7,                          //We want to be able to queue 7 transactions at a time
+        .queue_size=6*LCD_DLIST_DEPTH+1,        //Every display list set can be queued at a time
         .pre_cb=lcd_spi_pre_transfer_callback,  //Specify pre-transfer callback to handle D/C line
+        .post_cb=lcd_spi_post_transfer_callback, //And a post-transfer callback for the bus idle stats
     };
+#if !CONFIG_LCD_CLOCK_AUTO
+    devcfg.clock_speed_hz=param_int("lcd.clk_hz", devcfg.clock_speed_hz, 1*1000*1000, 80*1000*1000, "LCD SPI clock");
+#endif
     //Initialize the SPI bus
     ret=spi_bus_initialize(LCD_HOST, &buscfg, DMA_CHAN);
     ESP_ERROR_CHECK(ret);
@@ -460,10 +754,30 @@ void app_main(void)
     ESP_ERROR_CHECK(ret);
     //Initialize the LCD
     lcd_init(spi);
+#if CONFIG_LCD_CLOCK_AUTO
+    //The calibration result lives in NVS
+    ret=nvs_flash_init();
+    if (ret==ESP_ERR_NVS_NO_FREE_PAGES || ret==ESP_ERR_NVS_NEW_VERSION_FOUND) {
+        ESP_ERROR_CHECK(nvs_flash_erase());
+        ret=nvs_flash_init();
+    }
+    ESP_ERROR_CHECK(ret);
+    lcd_devcfg=devcfg;
+    lcd_clock_calibrate(&spi);
+#endif
+    lcd_dlist_init();
+#if CONFIG_JPEG_STREAM
+    display_jpeg_stream(spi);
+    return;
+#endif
     //Initialize the effect displayed
     ret=pretty_effect_init();
     ESP_ERROR_CHECK(ret);
+    //And the workers rendering it, one per core
+    // ret=render_jobs_init(pretty_effect_calc_lines, RENDER_SLOTS);
+    ret=render_jobs_init(pretty_effect_static_lines, RENDER_SLOTS);
+    ESP_ERROR_CHECK(ret);
 
     //Go do nice stuff.
-    display_pretty_colors(spi);
+    display_pretty_colors(spi, parallel_lines);
 }
@@ -0,0 +1,47 @@
+#include <stdio.h>
+#include <time.h>
+#include "bench.h"
+
+int bench_runs = 5;
+
+double bench_now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+double bench_best(bench_fn_t fn, void *arg)
+{
+    double best = 0;
+    fn(arg);
+    for (int i = 0; i < bench_runs; i++) {
+        double start = bench_now();
+        fn(arg);
+        double t = bench_now() - start;
+        if (i == 0 || t < best) {
+            best = t;
+        }
+    }
+    return best;
+}
+
+void bench_report(const char *name, const char *unit, double amount, double seconds)
+{
+    char rate[16];
+    snprintf(rate, sizeof(rate), "M%s/s", unit);
+    printf("%-36s %10.2f %-9s %10.3f ms/run\n", name, amount / seconds / 1e6, rate, seconds * 1e3);
+}
+
+void bench_fill(void *buf, uint32_t len, uint32_t seed)
+{
+    uint8_t *p = buf;
+    uint32_t x = seed ? seed : 1;
+    for (uint32_t i = 0; i < len; i++) {
+        // xorshift32
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        p[i] = x >> 24;
+    }
+}
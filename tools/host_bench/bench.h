@@ -0,0 +1,34 @@
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Timed runs of a benchmark body, the best of bench_runs is reported so a busy host disturbs the numbers less
+extern int bench_runs;
+
+typedef void (*bench_fn_t)(void *arg);
+
+// Monotonic time in seconds
+double bench_now(void);
+
+// Seconds of the fastest of bench_runs calls of fn, after one untimed call to warm the caches
+double bench_best(bench_fn_t fn, void *arg);
+
+// One result line: amount units were processed by one run in seconds, e.g. ("tjpgd 336x256", "B", bytes, t)
+void bench_report(const char *name, const char *unit, double amount, double seconds);
+
+// Fill buf with a fixed pseudo random sequence, the same on every run and host
+void bench_fill(void *buf, uint32_t len, uint32_t seed);
+
+void bench_tjpgd(void);
+void bench_ringbuf(void);
+void bench_pretty_effect(void);
+void bench_pwm_audio(void);
+void bench_ws2812(void);
+
+#ifdef __cplusplus
+}
+#endif
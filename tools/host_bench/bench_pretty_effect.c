@@ -0,0 +1,62 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "pretty_effect.h"
+#include "decode_image.h"
+#include "bench.h"
+
+#define EFFECT_W        320
+#define EFFECT_H        240
+#define EFFECT_LINES    16      // lines per SPI transaction in spi_master_example_main.c
+#define EFFECT_FRAMES   64
+
+// The effect reads the background through this, a fixed pattern of image.jpg's size stands in for the jpeg
+esp_err_t decode_image_contiguous(decode_image_t *image, uint32_t caps)
+{
+    image->width = 336;
+    image->height = 256;
+    image->stride = image->width;
+    image->data = malloc(image->width * image->height * sizeof(uint16_t));
+    if (image->data == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    bench_fill(image->data, image->width * image->height * sizeof(uint16_t), 2);
+    return ESP_OK;
+}
+
+typedef struct {
+    uint16_t lines[EFFECT_W * EFFECT_LINES];
+    int frame;
+} effect_bench_t;
+
+// Whole frames in stripes, every frame a new one so the tables are rebuilt each time like on the LCD
+static void effect_run(void *arg)
+{
+    effect_bench_t *b = arg;
+    for (int f = 0; f < EFFECT_FRAMES; f++, b->frame++) {
+        for (int y = 0; y < EFFECT_H; y += EFFECT_LINES) {
+            pretty_effect_calc_lines(b->lines, y, b->frame, EFFECT_LINES);
+        }
+    }
+}
+
+static void effect_static_run(void *arg)
+{
+    effect_bench_t *b = arg;
+    for (int f = 0; f < EFFECT_FRAMES; f++) {
+        for (int y = 0; y < EFFECT_H; y += EFFECT_LINES) {
+            pretty_effect_static_lines(b->lines, y, f, EFFECT_LINES);
+        }
+    }
+}
+
+void bench_pretty_effect(void)
+{
+    if (pretty_effect_init() != ESP_OK) {
+        fprintf(stderr, "pretty_effect: init failed\n");
+        return;
+    }
+    effect_bench_t *b = calloc(1, sizeof(effect_bench_t));
+    bench_report("pretty_effect calc_lines", "pix", EFFECT_W * EFFECT_H * EFFECT_FRAMES, bench_best(effect_run, b));
+    bench_report("pretty_effect static_lines", "pix", EFFECT_W * EFFECT_H * EFFECT_FRAMES, bench_best(effect_static_run, b));
+    free(b);
+}
@@ -0,0 +1,56 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "pwm_audio_convert.h"
+#include "bench.h"
+
+#define PWM_FRAMES      4096
+#define PWM_PASSES      1024
+#define PWM_RESOLUTION  10      // LEDC_TIMER_10_BIT, the pwm_audio default
+
+typedef struct {
+    void (*convert)(uint32_t *dst, const uint8_t *src, uint32_t frames, int32_t resolution);
+    const uint8_t *src;
+    uint32_t dst[PWM_FRAMES];
+} pwm_bench_t;
+
+static void pwm_run(void *arg)
+{
+    pwm_bench_t *b = arg;
+    for (int i = 0; i < PWM_PASSES; i++) {
+        b->convert(b->dst, b->src, PWM_FRAMES, PWM_RESOLUTION);
+    }
+}
+
+// The pwm_audio_write kernels, in samples (frames times channels) per second. The unaligned
+// cases take the byte path of the kernels, like a write of a buffer at an odd address does
+void bench_pwm_audio(void)
+{
+    static const struct {
+        const char *name;
+        void (*convert)(uint32_t *dst, const uint8_t *src, uint32_t frames, int32_t resolution);
+        int bytes;
+        int ch;
+        int offset;
+    } kernels[] = {
+        {"pwm_audio 8 bit mono", convert_8_mono, 1, 1, 0},
+        {"pwm_audio 8 bit stereo", convert_8_stereo, 1, 2, 0},
+        {"pwm_audio 16 bit mono", convert_16_mono, 2, 1, 0},
+        {"pwm_audio 16 bit mono unaligned", convert_16_mono, 2, 1, 1},
+        {"pwm_audio 16 bit stereo", convert_16_stereo, 2, 2, 0},
+        {"pwm_audio 16 bit stereo unaligned", convert_16_stereo, 2, 2, 1},
+        {"pwm_audio 32 bit mono", convert_32_mono, 4, 1, 0},
+        {"pwm_audio 32 bit stereo", convert_32_stereo, 4, 2, 0},
+    };
+    // 32 bit stereo frames and one byte to misalign
+    uint8_t *src = malloc(PWM_FRAMES * 8 + 4);
+    pwm_bench_t *b = malloc(sizeof(pwm_bench_t));
+    bench_fill(src, PWM_FRAMES * 8 + 4, 3);
+
+    for (int i = 0; i < sizeof(kernels) / sizeof(kernels[0]); i++) {
+        b->convert = kernels[i].convert;
+        b->src = src + kernels[i].offset;
+        bench_report(kernels[i].name, "S", (double)PWM_FRAMES * PWM_PASSES * kernels[i].ch, bench_best(pwm_run, b));
+    }
+    free(b);
+    free(src);
+}
@@ -0,0 +1,85 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "ringbuf.h"
+#include "bench.h"
+
+#define RB_SIZE     (16 * 1024)
+#define RB_CHUNK    512             // an I2S DMA buffer of 16 bit stereo
+#define RB_OPS      (64 * 1024)     // writes and reads of one single thread run
+#define RB_BYTES    (64 * 1024 * 1024)
+
+typedef struct {
+    RingBuf *rb;
+    uint8_t in[RB_CHUNK];
+    uint8_t out[RB_CHUNK];
+} rb_bench_t;
+
+// One task: write a chunk, read it back, never blocks
+static void rb_copy_run(void *arg)
+{
+    rb_bench_t *b = arg;
+    for (int i = 0; i < RB_OPS / 2; i++) {
+        rb_write(b->rb, b->in, RB_CHUNK, portMAX_DELAY);
+        rb_read(b->rb, b->out, RB_CHUNK, portMAX_DELAY);
+    }
+}
+
+static void rb_zero_copy_run(void *arg)
+{
+    rb_bench_t *b = arg;
+    uint8_t *ptr;
+    int contig;
+    for (int i = 0; i < RB_OPS / 2; i++) {
+        rb_acquire_write(b->rb, RB_CHUNK, &ptr, &contig, portMAX_DELAY);
+        ptr[0] = i;
+        rb_commit_write(b->rb, RB_CHUNK);
+        rb_acquire_read(b->rb, RB_CHUNK, &ptr, &contig, portMAX_DELAY);
+        b->out[0] = ptr[0];
+        rb_commit_read(b->rb, RB_CHUNK);
+    }
+}
+
+static void *rb_producer(void *arg)
+{
+    rb_bench_t *b = arg;
+    for (int i = 0; i < RB_BYTES / RB_CHUNK; i++) {
+        rb_write(b->rb, b->in, RB_CHUNK, portMAX_DELAY);
+    }
+    return NULL;
+}
+
+// Reader and writer in two threads, they block on the buffer like the audio tasks do
+static void rb_threads_run(void *arg)
+{
+    rb_bench_t *b = arg;
+    pthread_t producer;
+    pthread_create(&producer, NULL, rb_producer, b);
+    for (int i = 0; i < RB_BYTES / RB_CHUNK; i++) {
+        rb_read(b->rb, b->out, RB_CHUNK, portMAX_DELAY);
+    }
+    pthread_join(producer, NULL);
+}
+
+static void rb_bench(const char *name, RingBuf *rb)
+{
+    rb_bench_t b = {.rb = rb};
+    char line[64];
+    bench_fill(b.in, RB_CHUNK, 1);
+
+    snprintf(line, sizeof(line), "ringbuf %s copy", name);
+    bench_report(line, "ops", RB_OPS, bench_best(rb_copy_run, &b));
+    snprintf(line, sizeof(line), "ringbuf %s zero copy", name);
+    bench_report(line, "ops", RB_OPS, bench_best(rb_zero_copy_run, &b));
+    snprintf(line, sizeof(line), "ringbuf %s 2 threads", name);
+    bench_report(line, "B", RB_BYTES, bench_best(rb_threads_run, &b));
+    rb_unint(rb);
+}
+
+// Rates of one chunk of RB_CHUNK bytes per op, a copy run counts its writes and reads
+void bench_ringbuf(void)
+{
+    rb_bench("mux", rb_init(BUFFER_PROCESS, RB_SIZE, 1, NULL));
+    rb_bench("spsc", rb_init_spsc(BUFFER_PROCESS, RB_SIZE, 1));
+}
@@ -0,0 +1,78 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "tjpgd.h"
+#include "bench.h"
+
+// The work space of decode_image.c is sized for 32 bit pointers, twice that is plenty on a 64 bit host
+#define TJPGD_WORKSZ ((2780 + 4096) * 2)
+
+typedef struct {
+    const uint8_t *jpg;
+    uint32_t len;
+    uint16_t *out;
+    uint16_t width;
+    uint16_t height;
+    uint8_t scale;
+    uint8_t work[TJPGD_WORKSZ];
+} tjpgd_bench_t;
+
+static void tjpgd_run(void *arg)
+{
+    tjpgd_bench_t *b = arg;
+    JDEC jdec;
+    if (jd_prepare_mem(&jdec, b->jpg, b->len, b->work, sizeof(b->work), NULL) != JDR_OK
+        || jd_decomp_rgb565(&jdec, b->out, b->width >> b->scale, b->width >> b->scale,
+                            b->height >> b->scale, b->scale) != JDR_OK) {
+        fprintf(stderr, "tjpgd: decode failed\n");
+        exit(1);
+    }
+}
+
+static uint8_t *load_file(const char *path, uint32_t *len)
+{
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) {
+        return NULL;
+    }
+    fseek(f, 0, SEEK_END);
+    *len = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    uint8_t *data = malloc(*len);
+    if (data && fread(data, 1, *len, f) != *len) {
+        free(data);
+        data = NULL;
+    }
+    fclose(f);
+    return data;
+}
+
+// The screen_demo background, rates are in compressed bytes so they compare across images
+void bench_tjpgd(void)
+{
+    tjpgd_bench_t *b = calloc(1, sizeof(tjpgd_bench_t));
+    b->jpg = load_file(HOST_BENCH_IMAGE, &b->len);
+    if (b->jpg == NULL) {
+        fprintf(stderr, "tjpgd: cannot read %s\n", HOST_BENCH_IMAGE);
+        free(b);
+        return;
+    }
+    JDEC jdec;
+    if (jd_prepare_mem(&jdec, b->jpg, b->len, b->work, sizeof(b->work), NULL) != JDR_OK) {
+        fprintf(stderr, "tjpgd: %s is not a baseline jpeg\n", HOST_BENCH_IMAGE);
+        free((void *)b->jpg);
+        free(b);
+        return;
+    }
+    b->width = jdec.width;
+    b->height = jdec.height;
+    b->out = malloc(b->width * b->height * sizeof(uint16_t));
+
+    for (b->scale = 0; b->scale <= 3; b->scale++) {
+        char name[64];
+        snprintf(name, sizeof(name), "tjpgd %ux%u 1/%d", b->width, b->height, 1 << b->scale);
+        bench_report(name, "B", b->len, bench_best(tjpgd_run, b));
+    }
+    free(b->out);
+    free((void *)b->jpg);
+    free(b);
+}
@@ -0,0 +1,65 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "driver/rmt.h"
+#include "led_strip.h"
+#include "bench.h"
+
+#define WS2812_LEDS         1024
+#define WS2812_BLOCK_ITEMS  64      // half of the 2 blocks of RMT memory a channel refills from the translator
+#define WS2812_FRAMES       256
+
+typedef struct {
+    led_strip_t *strip;
+    sample_to_rmt_t adapter;
+    uint8_t grb[WS2812_LEDS * 3];
+    rmt_item32_t items[WS2812_BLOCK_ITEMS];
+} ws2812_bench_t;
+
+// ws2812_rmt_adapter alone, fed the way the RMT driver refills its memory
+static void ws2812_adapter_run(void *arg)
+{
+    ws2812_bench_t *b = arg;
+    for (int f = 0; f < WS2812_FRAMES; f++) {
+        const uint8_t *src = b->grb;
+        size_t left = sizeof(b->grb);
+        while (left) {
+            size_t translated, num;
+            b->adapter(src, b->items, left, WS2812_BLOCK_ITEMS, &translated, &num);
+            src += translated;
+            left -= translated;
+        }
+    }
+}
+
+// set_pixel for every LED and a refresh: the buffer swap and copy, then the translation
+static void ws2812_frame_run(void *arg)
+{
+    ws2812_bench_t *b = arg;
+    for (int f = 0; f < WS2812_FRAMES; f++) {
+        for (uint32_t i = 0; i < WS2812_LEDS; i++) {
+            b->strip->set_pixel(b->strip, i, i + f, i >> 2, f);
+        }
+        b->strip->refresh(b->strip, 100);
+    }
+}
+
+// Rates in RMT items, 24 per LED
+void bench_ws2812(void)
+{
+    led_strip_config_t config = LED_STRIP_DEFAULT_CONFIG(WS2812_LEDS, (led_strip_dev_t)RMT_CHANNEL_0);
+    ws2812_bench_t *b = calloc(1, sizeof(ws2812_bench_t));
+    b->strip = led_strip_new_rmt_ws2812(&config);
+    if (b->strip == NULL) {
+        fprintf(stderr, "ws2812: strip create failed\n");
+        free(b);
+        return;
+    }
+    b->adapter = host_rmt_translator(RMT_CHANNEL_0);
+    bench_fill(b->grb, sizeof(b->grb), 4);
+
+    double items = (double)WS2812_LEDS * 24 * WS2812_FRAMES;
+    bench_report("ws2812 rmt_adapter", "items", items, bench_best(ws2812_adapter_run, b));
+    bench_report("ws2812 set_pixel + refresh", "items", items, bench_best(ws2812_frame_run, b));
+    b->strip->del(b->strip);
+    free(b);
+}
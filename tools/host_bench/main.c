@@ -0,0 +1,60 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bench.h"
+
+static const struct {
+    const char *name;
+    void (*run)(void);
+} benches[] = {
+    {"tjpgd", bench_tjpgd},
+    {"ringbuf", bench_ringbuf},
+    {"pretty_effect", bench_pretty_effect},
+    {"pwm_audio", bench_pwm_audio},
+    {"ws2812", bench_ws2812},
+};
+
+#define BENCH_NUM (sizeof(benches) / sizeof(benches[0]))
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "usage: %s [-r runs] [bench ...]\nbenches:", prog);
+    for (int i = 0; i < BENCH_NUM; i++) {
+        fprintf(stderr, " %s", benches[i].name);
+    }
+    fprintf(stderr, "\n");
+}
+
+int main(int argc, char **argv)
+{
+    int selected[BENCH_NUM] = {0};
+    int any = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-r") == 0 && i + 1 < argc) {
+            bench_runs = atoi(argv[++i]);
+            continue;
+        }
+        int found = 0;
+        for (int b = 0; b < BENCH_NUM; b++) {
+            if (strcmp(argv[i], benches[b].name) == 0) {
+                selected[b] = found = any = 1;
+            }
+        }
+        if (!found) {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (bench_runs < 1) {
+        usage(argv[0]);
+        return 1;
+    }
+    printf("best of %d runs\n", bench_runs);
+    for (int b = 0; b < BENCH_NUM; b++) {
+        if (!any || selected[b]) {
+            benches[b].run();
+        }
+    }
+    return 0;
+}
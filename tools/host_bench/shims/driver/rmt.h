@@ -0,0 +1,50 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    RMT_CHANNEL_0,
+    RMT_CHANNEL_1,
+    RMT_CHANNEL_2,
+    RMT_CHANNEL_3,
+    RMT_CHANNEL_MAX
+} rmt_channel_t;
+
+typedef struct {
+    union {
+        struct {
+            uint32_t duration0 : 15;
+            uint32_t level0 : 1;
+            uint32_t duration1 : 15;
+            uint32_t level1 : 1;
+        };
+        uint32_t val;
+    };
+} rmt_item32_t;
+
+typedef void (*sample_to_rmt_t)(const void *src, rmt_item32_t *dest, size_t src_size, size_t wanted_num,
+                                size_t *translated_size, size_t *item_num);
+typedef void (*rmt_tx_end_fn_t)(rmt_channel_t channel, void *arg);
+
+// The counter runs at 40 MHz like APB / 2 on the targets
+esp_err_t rmt_get_counter_clock(rmt_channel_t channel, uint32_t *clock_hz);
+esp_err_t rmt_translator_init(rmt_channel_t channel, sample_to_rmt_t fn);
+// Translates the whole frame in RMT memory sized chunks and ends it at once
+esp_err_t rmt_write_sample(rmt_channel_t channel, const uint8_t *src, size_t src_size, bool wait_tx_done);
+void rmt_register_tx_end_callback(rmt_tx_end_fn_t function, void *arg);
+esp_err_t rmt_add_channel_to_group(rmt_channel_t channel);
+esp_err_t rmt_remove_channel_from_group(rmt_channel_t channel);
+
+// Host only: the translator of a channel, for calling it straight from a benchmark
+sample_to_rmt_t host_rmt_translator(rmt_channel_t channel);
+
+#ifdef __cplusplus
+}
+#endif
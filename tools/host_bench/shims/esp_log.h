@@ -0,0 +1,10 @@
+#pragma once
+
+#include <stdio.h>
+
+// errors and warnings only, the benchmark output stays readable
+#define ESP_LOGE(tag, format, ...)  fprintf(stderr, "E %s: " format "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGW(tag, format, ...)  fprintf(stderr, "W %s: " format "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGI(tag, format, ...)  do {} while (0)
+#define ESP_LOGD(tag, format, ...)  do {} while (0)
+#define ESP_LOGV(tag, format, ...)  do {} while (0)
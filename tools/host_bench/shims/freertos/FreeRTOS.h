@@ -0,0 +1,39 @@
+#pragma once
+
+// Just enough FreeRTOS for the benchmarked sources, semaphores are pthread based, a tick is 1 ms
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdFALSE                 0
+#define pdTRUE                  1
+#define pdPASS                  pdTRUE
+#define pdFAIL                  pdFALSE
+#define portMAX_DELAY           ((TickType_t)0xffffffff)
+#define portTICK_PERIOD_MS      1
+#define portTICK_RATE_MS        portTICK_PERIOD_MS
+#define pdMS_TO_TICKS(ms)       ((TickType_t)(ms))
+#define configASSERT(x)         assert(x)
+
+// one thread at a time is all the host needs, the benchmarks never share these across threads
+typedef int portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED    0
+#define portENTER_CRITICAL(mux)         ((void)(mux))
+#define portEXIT_CRITICAL(mux)          ((void)(mux))
+#define portENTER_CRITICAL_SAFE(mux)    ((void)(mux))
+#define portEXIT_CRITICAL_SAFE(mux)     ((void)(mux))
+#define portYIELD_FROM_ISR()            do {} while (0)
+#define xPortInIsrContext()             0
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct host_sem *SemaphoreHandle_t;
+typedef SemaphoreHandle_t xSemaphoreHandle;
+
+// max 1 is a binary semaphore, created empty; a mutex is a binary semaphore created given
+SemaphoreHandle_t host_sem_create(int count);
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem);
+void vSemaphoreDelete(SemaphoreHandle_t sem);
+
+#define xSemaphoreCreateBinary()            host_sem_create(0)
+#define xSemaphoreCreateMutex()             host_sem_create(1)
+#define vSemaphoreCreateBinary(sem)         ((sem) = host_sem_create(1))
+#define xSemaphoreGiveFromISR(sem, woken)   (*(woken) = pdFALSE, xSemaphoreGive(sem))
+
+#ifdef __cplusplus
+}
+#endif
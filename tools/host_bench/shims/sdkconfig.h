@@ -0,0 +1,3 @@
+#pragma once
+
+// No Kconfig on the host: every optional feature of the benchmarked sources (trace, PM, ...) is off
@@ -0,0 +1,160 @@
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+#include <pthread.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "driver/rmt.h"
+#include "EspAudioAlloc.h"
+
+struct host_sem {
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    int count;
+};
+
+static uint64_t host_now_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+TickType_t xTaskGetTickCount(void)
+{
+    return (TickType_t)host_now_ms();
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    struct timespec ts = {ticks / 1000, (ticks % 1000) * 1000000L};
+    nanosleep(&ts, NULL);
+}
+
+SemaphoreHandle_t host_sem_create(int count)
+{
+    struct host_sem *sem = calloc(1, sizeof(struct host_sem));
+    if (sem == NULL) {
+        return NULL;
+    }
+    pthread_mutex_init(&sem->lock, NULL);
+    pthread_cond_init(&sem->cond, NULL);
+    sem->count = count;
+    return sem;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks)
+{
+    struct timespec deadline;
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    if (ticks != portMAX_DELAY) {
+        deadline.tv_sec += ticks / 1000;
+        deadline.tv_nsec += (ticks % 1000) * 1000000L;
+        if (deadline.tv_nsec >= 1000000000L) {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1000000000L;
+        }
+    }
+    pthread_mutex_lock(&sem->lock);
+    while (sem->count == 0) {
+        if (ticks == portMAX_DELAY) {
+            pthread_cond_wait(&sem->cond, &sem->lock);
+        } else if (ticks == 0 || pthread_cond_timedwait(&sem->cond, &sem->lock, &deadline) == ETIMEDOUT) {
+            break;
+        }
+    }
+    BaseType_t ret = sem->count ? pdTRUE : pdFALSE;
+    if (ret == pdTRUE) {
+        sem->count = 0;
+    }
+    pthread_mutex_unlock(&sem->lock);
+    return ret;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem)
+{
+    pthread_mutex_lock(&sem->lock);
+    BaseType_t ret = sem->count ? pdFALSE : pdTRUE;
+    sem->count = 1;
+    pthread_cond_signal(&sem->cond);
+    pthread_mutex_unlock(&sem->lock);
+    return ret;
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t sem)
+{
+    pthread_cond_destroy(&sem->cond);
+    pthread_mutex_destroy(&sem->lock);
+    free(sem);
+}
+
+// SystemSal allocator, the capabilities mean nothing here
+void *EspAudioMalloc(int size, uint32_t caps, int align)
+{
+    return malloc(size);
+}
+
+void EspAudioFree(void *ptr)
+{
+    free(ptr);
+}
+
+// RMT: the translator runs on a scratch block of RMT memory, nothing is sent
+#define HOST_RMT_BLOCK_ITEMS 64
+
+static sample_to_rmt_t host_rmt_fn[RMT_CHANNEL_MAX];
+static rmt_tx_end_fn_t host_rmt_tx_end;
+static void *host_rmt_tx_end_arg;
+
+esp_err_t rmt_get_counter_clock(rmt_channel_t channel, uint32_t *clock_hz)
+{
+    *clock_hz = 40 * 1000 * 1000;
+    return ESP_OK;
+}
+
+esp_err_t rmt_translator_init(rmt_channel_t channel, sample_to_rmt_t fn)
+{
+    host_rmt_fn[channel] = fn;
+    return ESP_OK;
+}
+
+sample_to_rmt_t host_rmt_translator(rmt_channel_t channel)
+{
+    return host_rmt_fn[channel];
+}
+
+esp_err_t rmt_write_sample(rmt_channel_t channel, const uint8_t *src, size_t src_size, bool wait_tx_done)
+{
+    rmt_item32_t items[HOST_RMT_BLOCK_ITEMS];
+    while (src_size) {
+        size_t translated = 0, num = 0;
+        host_rmt_fn[channel](src, items, src_size, HOST_RMT_BLOCK_ITEMS, &translated, &num);
+        if (translated == 0) {
+            return ESP_FAIL;
+        }
+        src += translated;
+        src_size -= translated;
+    }
+    if (host_rmt_tx_end) {
+        host_rmt_tx_end(channel, host_rmt_tx_end_arg);
+    }
+    return ESP_OK;
+}
+
+void rmt_register_tx_end_callback(rmt_tx_end_fn_t function, void *arg)
+{
+    host_rmt_tx_end = function;
+    host_rmt_tx_end_arg = arg;
+}
+
+esp_err_t rmt_add_channel_to_group(rmt_channel_t channel)
+{
+    return ESP_OK;
+}
+
+esp_err_t rmt_remove_channel_from_group(rmt_channel_t channel)
+{
+    return ESP_OK;
+}
@@ -0,0 +1,9 @@
+#pragma once
+
+#include <stdbool.h>
+
+// Host memory is all internal
+static inline bool esp_ptr_external_ram(const void *p)
+{
+    return false;
+}
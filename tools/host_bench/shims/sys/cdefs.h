@@ -0,0 +1,8 @@
+#pragma once
+
+#include_next <sys/cdefs.h>
+
+// newlib has it, glibc does not
+#ifndef __containerof
+#define __containerof(ptr, type, member) ((type *)((char *)(ptr) - offsetof(type, member)))
+#endif